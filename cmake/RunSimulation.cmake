@@ -171,6 +171,13 @@ execute_process(COMMAND ${ECHO_CMD}
                 WORKING_DIRECTORY "${OUTPUT_DIR_PATH}"
                 RESULT_VARIABLE RESULT)
 
+# Report the wall time of performance tests, the iteration counts are in the output variables of the input file
+if( "${TEST_FILE_FOLDER}" STREQUAL "performance_tests" AND EXISTS "${OUTPUT_DIR_PATH}/eplusout.err" )
+  file(STRINGS "${OUTPUT_DIR_PATH}/eplusout.err" ELAPSED_TIME_LINE REGEX "Elapsed Time=")
+  string(REGEX MATCH "Elapsed Time=.*" ELAPSED_TIME "${ELAPSED_TIME_LINE}")
+  message("${IDF_NAME}: ${ELAPSED_TIME}")
+endif()
+
 if( RESULT EQUAL 0 )
   message("Test Passed")
 else()
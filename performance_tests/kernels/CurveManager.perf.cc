@@ -0,0 +1,153 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// EnergyPlus::CurveManager kernel timings
+
+// C++ Headers
+#include <chrono>
+#include <string>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// EnergyPlus Headers
+#include <CurveManager.hh>
+
+#include "Fixtures/CurveManagerFixture.hh"
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::CurveManager;
+
+TEST_F( CurveManagerFixture, CurveManager_EquationCurveTiming ) {
+	// nanoseconds per CurveValue call for each equation curve type
+	Array1D_int CurveTypes;
+	SetUpEquationCurves( CurveTypes );
+
+	int const NumPoints( 20000 );
+	Real64 Sum( 0.0 );
+	for ( int CurveNum = 1; CurveNum <= NumCurves; ++CurveNum ) {
+		auto const Start( std::chrono::steady_clock::now() );
+		for ( int i = 1; i <= NumPoints; ++i ) {
+			Sum += CurveValue( CurveNum, 0.05 + 2.0 * ( i % 100 ) / 100.0, 2.05 - 2.0 * ( i % 37 ) / 37.0, 1.0 );
+		}
+		auto const End( std::chrono::steady_clock::now() );
+		RecordProperty( "CurveType" + std::to_string( CurveTypes( CurveNum ) ) + "_NanosecondsPerCall", std::to_string( std::chrono::duration_cast< std::chrono::nanoseconds >( End - Start ).count() / NumPoints ) );
+	}
+	EXPECT_GT( Sum, 0.0 );
+}
+
+TEST_F( EnergyPlusFixture, Tables_DirectLookupTiming ) {
+	// nanoseconds per five variable table lookup, with direct grid indexing and with the DLAG search
+	NumCurves = 1;
+	PerfCurve.allocate( NumCurves );
+	PerfCurve( 1 ).ObjectType = CurveType_TableMultiIV;
+	PerfCurve( 1 ).InterpolationType = LagrangeInterpolationLinearExtrapolation;
+	PerfCurve( 1 ).TableIndex = 1;
+	PerfCurve( 1 ).Var1Min = 5.0;
+	PerfCurve( 1 ).Var1Max = 35.0;
+	PerfCurve( 1 ).Var2Min = 0.0;
+	PerfCurve( 1 ).Var2Max = 1.0;
+	PerfCurve( 1 ).Var3Min = 0.0;
+	PerfCurve( 1 ).Var3Max = 4.0;
+	PerfCurve( 1 ).Var4Min = 0.0;
+	PerfCurve( 1 ).Var4Max = 2.0;
+	PerfCurve( 1 ).Var5Min = -10.0;
+	PerfCurve( 1 ).Var5Max = 15.0;
+	GetCurvesInputFlag = false;
+
+	TableLookup.allocate( 1 );
+	auto & Table( TableLookup( 1 ) );
+	Table.NumIndependentVars = 5;
+	Table.InterpolationOrder = 3;
+	Table.X1Var.allocate( 5 );
+	Table.X1Var = { 10.0, 15.0, 20.0, 25.0, 30.0 };
+	Table.X2Var.allocate( 4 );
+	Table.X2Var = { 0.1, 0.3, 0.4, 0.8 };
+	Table.X3Var.allocate( 3 );
+	Table.X3Var = { 1.0, 2.0, 3.0 };
+	Table.X4Var.allocate( 2 );
+	Table.X4Var = { 0.5, 1.5 };
+	Table.X5Var.allocate( 4 );
+	Table.X5Var = { -5.0, 0.0, 5.0, 12.0 };
+	Table.NumX1Vars = Table.X1Var.isize();
+	Table.NumX2Vars = Table.X2Var.isize();
+	Table.NumX3Vars = Table.X3Var.isize();
+	Table.NumX4Vars = Table.X4Var.isize();
+	Table.NumX5Vars = Table.X5Var.isize();
+	Table.TableLookupZData.allocate( Table.NumX5Vars, Table.NumX4Vars, Table.NumX3Vars, Table.NumX2Vars, Table.NumX1Vars );
+	for ( int I = 1; I <= Table.TableLookupZData.isize(); ++I ) {
+		Table.TableLookupZData[ I - 1 ] = 1.0 + 0.01 * ( I % 17 );
+	}
+	SetUpTableLookupGrid( 1 );
+
+	int const NumEvaluations( 2000 );
+	Real64 Sum( 0.0 );
+	for ( bool const DirectLookup : { true, false } ) {
+		Table.DirectLookup = DirectLookup;
+		auto const Start( std::chrono::steady_clock::now() );
+		for ( int i = 1; i <= NumEvaluations; ++i ) {
+			Sum += TableLookupObject( 1, 10.0 + 0.01 * i, 0.33, 1.7, 0.9, 2.5 );
+		}
+		auto const End( std::chrono::steady_clock::now() );
+		RecordProperty( DirectLookup ? "DirectNanosecondsPerLookup" : "DLAGNanosecondsPerLookup", std::to_string( std::chrono::duration_cast< std::chrono::nanoseconds >( End - Start ).count() / NumEvaluations ) );
+	}
+	EXPECT_GT( Sum, 0.0 );
+}
@@ -0,0 +1,217 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// EnergyPlus::FluidProperties kernel timings
+
+// C++ Headers
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <DataSystemVariables.hh>
+#include <FluidProperties.hh>
+
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <ConfiguredFunctions.hh>
+
+using namespace EnergyPlus;
+using namespace ObjexxFCL;
+using namespace EnergyPlus::FluidProperties;
+
+namespace {
+
+	class FluidPropertiesTimingFixture : public EnergyPlusFixture
+	{
+	protected:
+		// Reads the shipped refrigerant data set, with the two default glycols at 40 percent added
+		void
+		ProcessShippedFluids()
+		{
+			std::vector< std::string > idf_lines;
+			std::ifstream dataset( configured_source_directory() + "/datasets/FluidPropertiesRefData.idf" );
+			std::string line;
+			while ( std::getline( dataset, line ) ) idf_lines.push_back( line );
+			std::string const Glycols[] = { "EthyleneGlycol", "PropyleneGlycol" };
+			for ( auto const & glycol : Glycols ) {
+				idf_lines.push_back( "FluidProperties:GlycolConcentration," );
+				idf_lines.push_back( "  Test" + glycol + ", " + glycol + ", , 0.4;" );
+			}
+			ASSERT_FALSE( process_idf( delimited_string( idf_lines ) ) );
+			int RefrigIndex( 1 );
+			GetSatPressureRefrig( "STEAM", 100.0, RefrigIndex, "Timing" ); // get input
+		}
+	};
+
+	std::string
+	NanosecondsPerCall(
+		std::chrono::steady_clock::time_point const & Start,
+		std::chrono::steady_clock::time_point const & End,
+		std::size_t const NumCalls
+	)
+	{
+		return std::to_string( std::chrono::duration_cast< std::chrono::nanoseconds >( End - Start ).count() / std::max( NumCalls, std::size_t( 1 ) ) );
+	}
+
+}
+
+TEST_F( FluidPropertiesTimingFixture, FluidProperties_IndexHintTiming )
+{
+	// saturated and superheated refrigerant properties and glycol properties over the whole temperature
+	// range of each shipped fluid, with the index hints and with interval halving from scratch
+	ProcessShippedFluids();
+
+	Real64 Sum( 0.0 );
+	for ( int RefrigNum = 1; RefrigNum <= NumOfRefrigerants; ++RefrigNum ) {
+		auto & refrig( RefrigData( RefrigNum ) );
+		std::string const Name( refrig.Name );
+		Real64 const LowTemp( max( refrig.PsLowTempValue, refrig.HfLowTempValue, refrig.RhofLowTempValue, refrig.SHTemps( 1 ) ) + 10.0 );
+		Real64 const HighTemp( min( refrig.PsHighTempValue, refrig.HfHighTempValue, refrig.RhofHighTempValue, refrig.SHTemps( refrig.NumSuperTempPts ) ) - 10.0 );
+		std::size_t NumCalls( 0 );
+		int Index( RefrigNum );
+		for ( bool const UseHints : { true, false } ) {
+			auto const Start( std::chrono::steady_clock::now() );
+			for ( Real64 Temp = LowTemp; Temp <= HighTemp; Temp += 0.25 ) {
+				if ( ! UseHints ) {
+					refrig.PsTempIndexHint = refrig.PsPresIndexHint = refrig.HTempIndexHint = refrig.CpTempIndexHint = 0;
+					refrig.RhoTempIndexHint = refrig.SHTempIndexHint = refrig.SHPressIndexHint = 0;
+				}
+				Real64 const Pressure( GetSatPressureRefrig( Name, Temp, Index, "Timing" ) );
+				Sum += GetSatTemperatureRefrig( Name, Pressure, Index, "Timing" );
+				Sum += GetSatEnthalpyRefrig( Name, Temp, 0.5, Index, "Timing" );
+				Sum += GetSatDensityRefrig( Name, Temp, 0.5, Index, "Timing" );
+				Sum += GetSatSpecificHeatRefrig( Name, Temp, 0.0, Index, "Timing" );
+				Sum += GetSupHeatEnthalpyRefrig( Name, Temp + 5.0, Pressure, Index, "Timing" );
+				if ( UseHints ) NumCalls += 6;
+			}
+			auto const End( std::chrono::steady_clock::now() );
+			RecordProperty( Name + ( UseHints ? "_HintNanosecondsPerCall" : "_HalvingNanosecondsPerCall" ), NanosecondsPerCall( Start, End, NumCalls ) );
+		}
+	}
+
+	for ( int GlycolNum = 1; GlycolNum <= NumOfGlycols; ++GlycolNum ) {
+		auto & glycol( GlycolData( GlycolNum ) );
+		std::string const Name( glycol.Name );
+		std::size_t NumCalls( 0 );
+		int Index( GlycolNum );
+		for ( bool const UseHints : { true, false } ) {
+			if ( ! UseHints ) glycol.CpTempStepInv = glycol.RhoTempStepInv = glycol.CondTempStepInv = glycol.ViscTempStepInv = 0.0;
+			auto const Start( std::chrono::steady_clock::now() );
+			for ( Real64 Temp = glycol.CpLowTempValue; Temp <= glycol.CpHighTempValue; Temp += 0.125 ) {
+				if ( ! UseHints ) glycol.CpTempIndexHint = glycol.RhoTempIndexHint = glycol.CondTempIndexHint = glycol.ViscTempIndexHint = 0;
+				Sum += GetSpecificHeatGlycol( Name, Temp, Index, "Timing" );
+				Sum += GetDensityGlycol( Name, Temp, Index, "Timing" );
+				Sum += GetConductivityGlycol( Name, Temp, Index, "Timing" );
+				Sum += GetViscosityGlycol( Name, Temp, Index, "Timing" );
+				if ( UseHints ) NumCalls += 4;
+			}
+			auto const End( std::chrono::steady_clock::now() );
+			RecordProperty( Name + ( UseHints ? "_HintNanosecondsPerCall" : "_HalvingNanosecondsPerCall" ), NanosecondsPerCall( Start, End, NumCalls ) );
+		}
+	}
+	EXPECT_GT( Sum, 0.0 );
+}
+
+TEST_F( FluidPropertiesTimingFixture, FluidProperties_SupHeatTempTableTiming )
+{
+	// Emulates the refrigerant state evaluations of a VRF system with 60 indoor units: the superheated
+	// outlet enthalpy of each unit, then the temperature after its piping heat gain, with the iterative
+	// solution and with the tables
+	ProcessShippedFluids();
+
+	std::string const Name( "R410A" );
+	int RefrigIndex( 0 );
+	GetSatPressureRefrig( Name, 5.0, RefrigIndex, "Timing" );
+
+	int const NumIU( 60 );
+	int const NumIter( 100 );
+	Real64 Sum( 0.0 );
+	auto const Evaluate = [&]() {
+		for ( int Iter = 0; Iter < NumIter; ++Iter ) {
+			Real64 const Te( 2.0 + 10.0 * Iter / NumIter );
+			Real64 const Pe( GetSatPressureRefrig( Name, Te, RefrigIndex, "Timing" ) );
+			Real64 const TSat( GetSatTemperatureRefrig( Name, Pe, RefrigIndex, "Timing" ) );
+			for ( int IU = 0; IU < NumIU; ++IU ) {
+				Real64 const SH( 1.0 + 0.1 * IU );
+				Real64 const Enthalpy( GetSupHeatEnthalpyRefrig( Name, TSat + SH, Pe, RefrigIndex, "Timing" ) + 50.0 * IU );
+				Sum += GetSupHeatTempRefrig( Name, Pe, Enthalpy, TSat, TSat + 30.0, RefrigIndex, "Timing" );
+			}
+		}
+	};
+	std::size_t const NumCalls( NumIter * NumIU );
+
+	auto Start( std::chrono::steady_clock::now() );
+	Evaluate();
+	RecordProperty( "Iterative_NanosecondsPerCall", NanosecondsPerCall( Start, std::chrono::steady_clock::now(), NumCalls ) );
+
+	DataSystemVariables::RefrigTablesEnvFlag = true;
+	Start = std::chrono::steady_clock::now();
+	SetupSupHeatTempTable( RefrigIndex );
+	RecordProperty( "TableSetup_Nanoseconds", NanosecondsPerCall( Start, std::chrono::steady_clock::now(), 1 ) );
+	Start = std::chrono::steady_clock::now();
+	Evaluate();
+	RecordProperty( "Table_NanosecondsPerCall", NanosecondsPerCall( Start, std::chrono::steady_clock::now(), NumCalls ) );
+	DataSystemVariables::RefrigTablesEnvFlag = false;
+
+	EXPECT_GT( Sum, 0.0 );
+}
@@ -307,6 +307,39 @@ namespace AirflowNetworkBalanceManager {
 	Array1D< AirflowNetworkReportVars > AirflowNetworkZnRpt;
 
 	Array1D< OccupantVentilationControlProp > OccupantVentilationControl;
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int MaxNums( 0 ); // Maximum number of numeric input fields
+		int MaxAlphas( 0 ); // Maximum number of alpha input fields
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		bool OneTimeFlag( true );
+		bool MyEnvrnFlag( true );
+		bool CalcAirflowNetworkAirBalanceOneTimeFlag( true );
+		bool ErrorsFound( false );
+		int ErrCountVar( 0 );
+		int ErrCountHighPre( 0 );
+		int ErrCountLowPre( 0 );
+		int ErrIndexHighPre( 0 );
+		int ErrIndexVar( 0 );
+		int ErrIndexLowPre( 0 );
+		bool MyOneTimeFlag( true );
+		bool MyOneTimeFlag1( true );
+		bool ValidateDistributionSystemOneTimeFlag( true );
+		bool ValidateDistributionSystemErrorsFound( false );
+		bool IsNotOK( false );
+		bool errFlag( false );
+		bool ValidateExhaustFanInputOneTimeFlag( true );
+		bool ValidateExhaustFanInputErrorsFound( false );
+		int HybridGlobalErrIndex( 0 );
+		int HybridGlobalErrCount( 0 );
+		int AFNNumOfExtOpenings( 0 ); // Total number of external openings in the model
+		int OpenNuminZone( 0 ); // Counts which opening this is in the zone, 1 or 2
+	}
+
 	// Functions
 
 	void
@@ -363,6 +396,31 @@ namespace AirflowNetworkBalanceManager {
 		IntraZoneNumOfZones = 0;
 		AirflowNetworkZnRpt.deallocate();
 		OccupantVentilationControl.deallocate();
+		MaxNums = 0;
+		MaxAlphas = 0;
+		TotalArgs = 0;
+		OneTimeFlag = true;
+		MyEnvrnFlag = true;
+		CalcAirflowNetworkAirBalanceOneTimeFlag = true;
+		ErrorsFound = false;
+		ErrCountVar = 0;
+		ErrCountHighPre = 0;
+		ErrCountLowPre = 0;
+		ErrIndexHighPre = 0;
+		ErrIndexVar = 0;
+		ErrIndexLowPre = 0;
+		MyOneTimeFlag = true;
+		MyOneTimeFlag1 = true;
+		ValidateDistributionSystemOneTimeFlag = true;
+		ValidateDistributionSystemErrorsFound = false;
+		IsNotOK = false;
+		errFlag = false;
+		ValidateExhaustFanInputOneTimeFlag = true;
+		ValidateExhaustFanInputErrorsFound = false;
+		HybridGlobalErrIndex = 0;
+		HybridGlobalErrCount = 0;
+		AFNNumOfExtOpenings = 0;
+		OpenNuminZone = 0;
 	}
 
 	void
@@ -585,9 +643,6 @@ namespace AirflowNetworkBalanceManager {
 		Array1D< Real64 > Numbers; // Numeric input items for object
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int MaxNums( 0 ); // Maximum number of numeric input fields
-		static int MaxAlphas( 0 ); // Maximum number of alpha input fields
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 		bool Errorfound1;
 
 		// Formats
@@ -3988,8 +4043,6 @@ namespace AirflowNetworkBalanceManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool OneTimeFlag( true );
-		static bool MyEnvrnFlag( true );
 		int i;
 		int j;
 		int ZoneNum;
@@ -4396,8 +4449,6 @@ namespace AirflowNetworkBalanceManager {
 		int j;
 		int n;
 		Real64 Vref;
-		static bool OneTimeFlag( true );
-		static bool ErrorsFound( false );
 		Real64 GlobalOpenFactor;
 		Real64 ZonePressure1;
 		Real64 ZonePressure2;
@@ -4406,20 +4457,14 @@ namespace AirflowNetworkBalanceManager {
 		Real64 const ErrorToler( 0.00001 );
 		int const MaxIte( 20 );
 		int SolFla;
-		static int ErrCountVar( 0 );
-		static int ErrCountHighPre( 0 );
-		static int ErrCountLowPre( 0 );
-		static int ErrIndexHighPre( 0 );
-		static int ErrIndexVar( 0 );
-		static int ErrIndexLowPre( 0 );
 		Real64 MinExhaustMassFlowrate;
 		Real64 MaxExhaustMassFlowrate;
 		Real64 MinReliefMassFlowrate;
 		Real64 MaxReliefMassFlowrate;
 
 		// Validate supply and return connections
-		if ( OneTimeFlag ) {
-			OneTimeFlag = false;
+		if ( CalcAirflowNetworkAirBalanceOneTimeFlag ) {
+			CalcAirflowNetworkAirBalanceOneTimeFlag = false;
 			if ( ErrorsFound ) {
 				ShowFatalError( "GetAirflowNetworkInput: Program terminates for preceding reason(s)." );
 			}
@@ -4576,7 +4621,7 @@ namespace AirflowNetworkBalanceManager {
 				} else {
 					//	if ( ZonePressure1 > PressureSet && ZonePressure2 < PressureSet ) {
 					Par( 1 ) = PressureSet;
-					SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, ExhaustFanMassFlowRate, AFNPressureResidual, MinExhaustMassFlowrate, MaxExhaustMassFlowrate, Par );
+					SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, ExhaustFanMassFlowRate, AFNPressureResidual, MinExhaustMassFlowrate, MaxExhaustMassFlowrate, Par, "CalcAirflowNetworkAirBalance" );
 					if ( SolFla == -1 ) {
 						if ( !WarmupFlag ) {
 							if ( ErrCountVar == 0 ) {
@@ -4636,7 +4681,7 @@ namespace AirflowNetworkBalanceManager {
 				} else {
 					//	if ( ZonePressure1 > PressureSet && ZonePressure2 < PressureSet ) {
 					Par( 1 ) = PressureSet;
-					SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, ReliefMassFlowRate, AFNPressureResidual, MinReliefMassFlowrate, MaxReliefMassFlowrate, Par );
+					SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, ReliefMassFlowRate, AFNPressureResidual, MinReliefMassFlowrate, MaxReliefMassFlowrate, Par, "CalcAirflowNetworkAirBalance" );
 					if ( SolFla == -1 ) {
 						if ( !WarmupFlag ) {
 							if ( ErrCountVar == 0 ) {
@@ -6588,8 +6633,6 @@ namespace AirflowNetworkBalanceManager {
 		Real64 NodeMass;
 		Real64 AFNMass;
 		bool WriteFlag;
-		static bool MyOneTimeFlag( true );
-		static bool MyOneTimeFlag1( true );
 
 		for ( auto & e : AirflowNetworkExchangeData ) {
 			e.SumMCp = 0.0;
@@ -7338,18 +7381,14 @@ namespace AirflowNetworkBalanceManager {
 		int S2;
 		int R1;
 		int R2;
-		static bool OneTimeFlag( true );
-		static bool ErrorsFound( false );
 		bool LocalError;
 		Array1D_bool NodeFound;
 		Real64 FanFlow;
-		static bool IsNotOK( false );
-		static bool errFlag( false );
 		Array1D_int NodeConnectionType; // Specifies the type of node connection
 		std::string CurrentModuleObject;
 
 		// Validate supply and return connections
-		if ( OneTimeFlag ) {
+		if ( ValidateDistributionSystemOneTimeFlag ) {
 			NodeFound.dimension( NumOfNodes, false );
 			// Validate inlet and outlet nodes for zone exhaust fans
 			for ( i = 1; i <= AirflowNetworkNumOfExhFan; ++i ) {
@@ -7374,12 +7413,12 @@ namespace AirflowNetworkBalanceManager {
 					if ( ! LocalError ) {
 						ShowSevereError( RoutineName + "The Node or Component Name defined in " + DisSysNodeData( i ).Name + " is not found in the " + DisSysNodeData( i ).EPlusType );
 						ShowContinueError( "The entered name is " + DisSysNodeData( i ).EPlusName + " in an AirflowNetwork:Distribution:Node object." );
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 				}
 				if ( DisSysNodeData( i ).EPlusNodeNum == 0 ) {
 					ShowSevereError( RoutineName + "Primary Air Loop Node is not found in AIRFLOWNETWORK:DISTRIBUTION:NODE = " + DisSysNodeData( i ).Name );
-					ErrorsFound = true;
+					ValidateDistributionSystemErrorsFound = true;
 				}
 			}
 
@@ -7471,10 +7510,10 @@ namespace AirflowNetworkBalanceManager {
 					// Check if this node is the OA relief node. For the time being, OA relief node is not used
 					if ( GetNumOAMixers() > 1 ) {
 						ShowSevereError( RoutineName + "Only one OutdoorAir:Mixer is allowed in the AirflowNetwork model." );
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					} else if ( GetNumOAMixers() == 0 ) {
 						ShowSevereError( RoutineName + NodeID( i ) + " is not defined as an AirflowNetwork:Distribution:Node object." );
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					} else {
 						if ( NumOfOAFans == 1 && DisSysCompOutdoorAirData( 1 ).InletNode == 0 ) {
 							DisSysCompOutdoorAirData( 1 ).InletNode = GetOAMixerInletNodeNumber( 1 );
@@ -7488,7 +7527,7 @@ namespace AirflowNetworkBalanceManager {
 							NodeFound( i ) = true;
 						} else {
 							ShowSevereError( RoutineName + NodeID( i ) + " is not defined as an AirflowNetwork:Distribution:Node object." );
-							ErrorsFound = true;
+							ValidateDistributionSystemErrorsFound = true;
 						}
 					}
 				}
@@ -7504,80 +7543,80 @@ namespace AirflowNetworkBalanceManager {
 				if ( SELECT_CASE_var == "COIL:COOLING:DX:SINGLESPEED" ) {
 					ValidateComponent( "Coil:Cooling:DX:SingleSpeed", DisSysCompCoilData( i ).Name, IsNotOK, RoutineName + CurrentModuleObject );
 					if ( IsNotOK ) {
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 
 				} else if ( SELECT_CASE_var == "COIL:HEATING:DX:SINGLESPEED" ) {
 					ValidateComponent( "Coil:Heating:DX:SingleSpeed", DisSysCompCoilData( i ).Name, IsNotOK, RoutineName + CurrentModuleObject );
 					if ( IsNotOK ) {
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 
 				} else if ( SELECT_CASE_var == "COIL:HEATING:FUEL" ) {
 					ValidateComponent( "Coil:Heating:Fuel", DisSysCompCoilData( i ).Name, IsNotOK, RoutineName + CurrentModuleObject );
 					if ( IsNotOK ) {
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 
 				} else if ( SELECT_CASE_var == "COIL:HEATING:ELECTRIC" ) {
 					ValidateComponent( "Coil:Heating:Electric", DisSysCompCoilData( i ).Name, IsNotOK, RoutineName + CurrentModuleObject );
 					if ( IsNotOK ) {
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 
 				} else if ( SELECT_CASE_var == "COIL:COOLING:WATER" ) {
 					ValidateComponent( "Coil:Cooling:Water", DisSysCompCoilData( i ).Name, IsNotOK, RoutineName + CurrentModuleObject );
 					if ( IsNotOK ) {
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 
 				} else if ( SELECT_CASE_var == "COIL:HEATING:WATER" ) {
 					ValidateComponent( "Coil:Heating:Water", DisSysCompCoilData( i ).Name, IsNotOK, RoutineName + CurrentModuleObject );
 					if ( IsNotOK ) {
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 
 				} else if ( SELECT_CASE_var == "COIL:COOLING:WATER:DETAILEDGEOMETRY" ) {
 					ValidateComponent( "Coil:Cooling:Water:DetailedGeometry", DisSysCompCoilData( i ).Name, IsNotOK, RoutineName + CurrentModuleObject );
 					if ( IsNotOK ) {
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 
 				} else if ( SELECT_CASE_var == "COIL:COOLING:DX:TWOSTAGEWITHHUMIDITYCONTROLMODE" ) {
 					ValidateComponent( "Coil:Cooling:DX:TwoStageWithHumidityControlMode", DisSysCompCoilData( i ).Name, IsNotOK, RoutineName + CurrentModuleObject );
 					if ( IsNotOK ) {
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 
 				} else if ( SELECT_CASE_var == "COIL:COOLING:DX:MULTISPEED" ) {
 					ValidateComponent( "Coil:Cooling:DX:MultiSpeed", DisSysCompCoilData( i ).Name, IsNotOK, RoutineName + CurrentModuleObject );
 					++MultiSpeedHPIndicator;
 					if ( IsNotOK ) {
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 
 				} else if ( SELECT_CASE_var == "COIL:HEATING:DX:MULTISPEED" ) {
 					ValidateComponent( "Coil:Heating:DX:MultiSpeed", DisSysCompCoilData( i ).Name, IsNotOK, RoutineName + CurrentModuleObject );
 					++MultiSpeedHPIndicator;
 					if ( IsNotOK ) {
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 
 				} else if ( SELECT_CASE_var == "COIL:HEATING:DESUPERHEATER" ) {
 					ValidateComponent( "Coil:Heating:Desuperheater", DisSysCompCoilData( i ).Name, IsNotOK, RoutineName + CurrentModuleObject );
 					if ( IsNotOK ) {
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 
 				} else if ( SELECT_CASE_var == "COIL:COOLING:DX:TWOSPEED" ) {
 					ValidateComponent( "Coil:Cooling:DX:TwoSpeed", DisSysCompCoilData( i ).Name, IsNotOK, RoutineName + CurrentModuleObject );
 					if ( IsNotOK ) {
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 
 				} else {
 					ShowSevereError( RoutineName + CurrentModuleObject + " Invalid coil type = " + DisSysCompCoilData( i ).Name );
-					ErrorsFound = true;
+					ValidateDistributionSystemErrorsFound = true;
 				}}
 			}
 
@@ -7587,18 +7626,18 @@ namespace AirflowNetworkBalanceManager {
 					LocalError = false;
 					if ( SameString( DisSysCompTermUnitData( i ).EPlusType, "AirTerminal:SingleDuct:ConstantVolume:Reheat" ) ) GetHVACSingleDuctSysIndex( DisSysCompTermUnitData( i ).Name, n, LocalError, "AirflowNetwork:Distribution:Component:TerminalUnit" );
 					if ( SameString( DisSysCompTermUnitData( i ).EPlusType, "AirTerminal:SingleDuct:VAV:Reheat" ) ) GetHVACSingleDuctSysIndex( DisSysCompTermUnitData( i ).Name, n, LocalError, "AirflowNetwork:Distribution:Component:TerminalUnit", DisSysCompTermUnitData( i ).DamperInletNode, DisSysCompTermUnitData( i ).DamperOutletNode );
-					if ( LocalError ) ErrorsFound = true;
+					if ( LocalError ) ValidateDistributionSystemErrorsFound = true;
 					if ( VAVSystem ) {
 						if ( ! SameString( DisSysCompTermUnitData( i ).EPlusType, "AirTerminal:SingleDuct:VAV:Reheat" ) ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + " Invalid terminal type for a VAV system = " + DisSysCompTermUnitData( i ).Name );
 							ShowContinueError( "The input type = " + DisSysCompTermUnitData( i ).EPlusType );
 							ShowContinueError( "A VAV system requires all ternimal units with type = AirTerminal:SingleDuct:VAV:Reheat" );
-							ErrorsFound = true;
+							ValidateDistributionSystemErrorsFound = true;
 						}
 					}
 				} else {
 					ShowSevereError( RoutineName + "AIRFLOWNETWORK:DISTRIBUTION:COMPONENT TERMINAL UNIT: Invalid Terminal unit type = " + DisSysCompTermUnitData( i ).Name );
-					ErrorsFound = true;
+					ValidateDistributionSystemErrorsFound = true;
 				}
 			}
 
@@ -7610,24 +7649,24 @@ namespace AirflowNetworkBalanceManager {
 				if ( SELECT_CASE_var == "HEATEXCHANGER:AIRTOAIR:FLATPLATE" ) {
 					ValidateComponent( "HeatExchanger:AirToAir:FlatPlate", DisSysCompHXData( i ).Name, IsNotOK, RoutineName + CurrentModuleObject );
 					if ( IsNotOK ) {
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 
 				} else if ( SELECT_CASE_var == "HEATEXCHANGER:AIRTOAIR:SENSIBLEANDLATENT" ) {
 					ValidateComponent( "HeatExchanger:AirToAir:SensibleAndLatent", DisSysCompHXData( i ).Name, IsNotOK, RoutineName + CurrentModuleObject );
 					if ( IsNotOK ) {
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 
 				} else if ( SELECT_CASE_var == "HEATEXCHANGER:DESICCANT:BALANCEDFLOW" ) {
 					ValidateComponent( "HeatExchanger:Desiccant:BalancedFlow", DisSysCompHXData( i ).Name, IsNotOK, RoutineName + CurrentModuleObject );
 					if ( IsNotOK ) {
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 
 				} else {
 					ShowSevereError( RoutineName + CurrentModuleObject + " Invalid heat exchanger type = " + DisSysCompHXData( i ).EPlusType );
-					ErrorsFound = true;
+					ValidateDistributionSystemErrorsFound = true;
 				}}
 			}
 
@@ -7684,49 +7723,49 @@ namespace AirflowNetworkBalanceManager {
 							if ( AirflowNetworkCompData( AirflowNetworkLinkageData( j ).CompNum ).CompTypeNum != CompTypeNum_DWC ) {
 								ShowSevereError( RoutineName + "An " + CurrentModuleObject + " object (" + AirflowNetworkLinkageData( i ).CompName + ')' );
 								ShowContinueError( "must connect a duct component upstream and not " + AirflowNetworkLinkageData( j ).Name );
-								ErrorsFound = true;
+								ValidateDistributionSystemErrorsFound = true;
 							}
 						}
 					}
 					if ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusTypeNum == EPlusTypeNum_SPL ) {
 						ShowSevereError( RoutineName + "An " + CurrentModuleObject + " object (" + AirflowNetworkLinkageData( i ).CompName + ')' );
 						ShowContinueError( "does not allow a AirLoopHVAC:ZoneSplitter node = " + AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).Name );
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 					if ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusTypeNum == EPlusTypeNum_SPL ) {
 						ShowSevereError( RoutineName + "An " + CurrentModuleObject + " object (" + AirflowNetworkLinkageData( i ).CompName + ')' );
 						ShowContinueError( "does not allow a AirLoopHVAC:ZoneSplitter node = " + AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).Name );
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 					if ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusTypeNum == EPlusTypeNum_MIX ) {
 						ShowSevereError( RoutineName + "An " + CurrentModuleObject + " object (" + AirflowNetworkLinkageData( i ).CompName + ')' );
 						ShowContinueError( "does not allow a AirLoopHVAC:ZoneMixer node = " + AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).Name );
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 					if ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusTypeNum == EPlusTypeNum_MIX ) {
 						ShowSevereError( RoutineName + "An " + CurrentModuleObject + " object (" + AirflowNetworkLinkageData( i ).CompName + ')' );
 						ShowContinueError( "does not allow a AirLoopHVAC:ZoneMixer node = " + AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).Name );
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 					if ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusNodeNum > 0 ) {
 						ShowSevereError( RoutineName + "An " + CurrentModuleObject + " object (" + AirflowNetworkLinkageData( i ).CompName + ')' );
 						ShowContinueError( "does not allow to connect an EnergyPlus node = " + AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).Name );
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 					if ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusNodeNum > 0 ) {
 						ShowSevereError( RoutineName + "An " + CurrentModuleObject + " object (" + AirflowNetworkLinkageData( i ).CompName + ')' );
 						ShowContinueError( "does not allow to connect an EnergyPlus node = " + AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).Name );
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 					if ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum > 0 ) {
 						ShowSevereError( RoutineName + "An " + CurrentModuleObject + " object (" + AirflowNetworkLinkageData( i ).CompName + ')' );
 						ShowContinueError( "does not allow to connect an EnergyPlus zone = " + AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).Name );
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 					if ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum > 0 ) {
 						ShowSevereError( RoutineName + "An " + CurrentModuleObject + " object (" + AirflowNetworkLinkageData( i ).CompName + ')' );
 						ShowContinueError( "does not allow to connect an EnergyPlus zone = " + AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).Name );
-						ErrorsFound = true;
+						ValidateDistributionSystemErrorsFound = true;
 					}
 				}
 			}
@@ -7737,7 +7776,7 @@ namespace AirflowNetworkBalanceManager {
 					j = GetSplitterOutletNumber( "", 1, LocalError );
 					SplitterNodeNumbers.allocate( j + 2 );
 					SplitterNodeNumbers = GetSplitterNodeNumbers( "", 1, LocalError );
-					if ( LocalError ) ErrorsFound = true;
+					if ( LocalError ) ValidateDistributionSystemErrorsFound = true;
 				}
 			}
 
@@ -7753,8 +7792,8 @@ namespace AirflowNetworkBalanceManager {
 				}
 			}
 
-			OneTimeFlag = false;
-			if ( ErrorsFound ) {
+			ValidateDistributionSystemOneTimeFlag = false;
+			if ( ValidateDistributionSystemErrorsFound ) {
 				ShowFatalError( RoutineName + "Program terminates for preceding reason(s)." );
 			}
 		}
@@ -7821,14 +7860,12 @@ namespace AirflowNetworkBalanceManager {
 		int i;
 		int j;
 		int k;
-		static bool OneTimeFlag( true );
-		static bool ErrorsFound( false );
 		bool found;
 		int EquipTypeNum; // Equipment type number
 		std::string CurrentModuleObject;
 
 		// Validate supply and return connections
-		if ( OneTimeFlag ) {
+		if ( ValidateExhaustFanInputOneTimeFlag ) {
 			CurrentModuleObject = "AirflowNetwork:MultiZone:Component:ZoneExhaustFan";
 			if ( std::any_of( ZoneEquipConfig.begin(), ZoneEquipConfig.end(), []( DataZoneEquipment::EquipConfiguration const & e ){ return e.IsControlled; } ) ) {
 				AirflowNetworkZoneExhaustFan.dimension( NumOfZones, false );
@@ -7838,7 +7875,7 @@ namespace AirflowNetworkBalanceManager {
 				ShowSevereError( RoutineName + "The number of " + CurrentModuleObject + " is not equal to the number of Fan:ZoneExhaust fans defined in ZoneHVAC:EquipmentConnections" );
 				ShowContinueError( "The number of " + CurrentModuleObject + " is " + RoundSigDigits( AirflowNetworkNumOfExhFan ) );
 				ShowContinueError( "The number of Zone exhaust fans defined in ZoneHVAC:EquipmentConnections is " + RoundSigDigits( NumOfExhaustFans ) );
-				ErrorsFound = true;
+				ValidateExhaustFanInputErrorsFound = true;
 			}
 
 			for ( i = 1; i <= AirflowNetworkNumOfExhFan; ++i ) {
@@ -7854,7 +7891,7 @@ namespace AirflowNetworkBalanceManager {
 				}
 				if ( MultizoneCompExhaustFanData( i ).EPlusZoneNum == 0 ) {
 					ShowSevereError( RoutineName + "Zone name in " + CurrentModuleObject + "  = " + MultizoneCompExhaustFanData( i ).Name + " does not match the zone name in ZoneHVAC:EquipmentConnections" );
-					ErrorsFound = true;
+					ValidateExhaustFanInputErrorsFound = true;
 				}
 				// Ensure a surface using zone exhaust fan to expose to the same zone
 				found = false;
@@ -7863,19 +7900,19 @@ namespace AirflowNetworkBalanceManager {
 						found = true;
 						if ( Surface( MultizoneSurfaceData( j ).SurfNum ).ExtBoundCond != ExternalEnvironment && ! ( Surface( MultizoneSurfaceData( i ).SurfNum ).ExtBoundCond == OtherSideCoefNoCalcExt && Surface( MultizoneSurfaceData( i ).SurfNum ).ExtWind ) ) {
 							ShowSevereError( RoutineName + "The surface using " + CurrentModuleObject + " is not an exterior surface: " + MultizoneSurfaceData( j ).SurfName );
-							ErrorsFound = true;
+							ValidateExhaustFanInputErrorsFound = true;
 						}
 						break;
 					}
 				}
 				if ( ! found ) {
 					ShowSevereError( CurrentModuleObject + "  = " + MultizoneCompExhaustFanData( i ).Name + " is defined and never used." );
-					ErrorsFound = true;
+					ValidateExhaustFanInputErrorsFound = true;
 				} else {
 					if ( MultizoneCompExhaustFanData( i ).EPlusZoneNum != Surface( MultizoneSurfaceData( j ).SurfNum ).Zone ) {
 						ShowSevereError( RoutineName + "Zone name in " + CurrentModuleObject + "  = " + MultizoneCompExhaustFanData( i ).Name + " does not match the zone name" );
 						ShowContinueError( "the surface is exposed to " + Surface( MultizoneSurfaceData( j ).SurfNum ).Name );
-						ErrorsFound = true;
+						ValidateExhaustFanInputErrorsFound = true;
 					} else {
 						AirflowNetworkZoneExhaustFan( MultizoneCompExhaustFanData( i ).EPlusZoneNum ) = true;
 					}
@@ -7898,15 +7935,15 @@ namespace AirflowNetworkBalanceManager {
 							if ( ! found ) {
 								ShowSevereError( RoutineName + "Fan:ZoneExhaust is not defined in " + CurrentModuleObject );
 								ShowContinueError( "Zone Air Exhaust Node in ZoneHVAC:EquipmentConnections =" + NodeID( ZoneEquipConfig( j ).ExhaustNode( k ) ) );
-								ErrorsFound = true;
+								ValidateExhaustFanInputErrorsFound = true;
 							}
 						}
 					}
 				}
 			}
 
-			OneTimeFlag = false;
-			if ( ErrorsFound ) {
+			ValidateExhaustFanInputOneTimeFlag = false;
+			if ( ValidateExhaustFanInputErrorsFound ) {
 				ShowFatalError( RoutineName + "Program terminates for preceding reason(s)." );
 			}
 		}
@@ -7968,8 +8005,6 @@ namespace AirflowNetworkBalanceManager {
 		int SurfNum; // Surface number
 		int ControlType; // Hybrid ventilation control type: 0 individual; 1 global
 		bool Found; // Logical to indicate whether a master surface is found or not
-		static int HybridGlobalErrIndex( 0 );
-		static int HybridGlobalErrCount( 0 );
 
 		for ( auto & e : MultizoneSurfaceData ) {
 			e.HybridVentClose = false;
@@ -8102,8 +8137,6 @@ namespace AirflowNetworkBalanceManager {
 		Array1D< Real64 > Sprime; // The dimensionless ratio of the window separation to the building width
 		Array1D< Real64 > CPV1; // Wind pressure coefficient for the first opening in the zone
 		Array1D< Real64 > CPV2; // Wind pressure coefficient for the second opening in the zone
-		static int AFNNumOfExtOpenings( 0 ); // Total number of external openings in the model
-		static int OpenNuminZone( 0 ); // Counts which opening this is in the zone, 1 or 2
 		std::string Name; // External node name
 		Array1D_int NumofExtSurfInZone; // List of the number of exterior openings in each zone
 
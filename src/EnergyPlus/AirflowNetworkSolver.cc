@@ -180,8 +180,56 @@ namespace AirflowNetworkSolver {
 	Array1D< Real64 > RhoProfT; // Density profile in TO zone [kg/m3]
 	Array2D< Real64 > DpL; // Array of stack pressures in link
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int L( 0 );
+		int ilayptr( 0 );
+	}
+
 	// Functions
 
+	// Clears the global data in AirflowNetworkSolver.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NetworkNumOfLinks = 0;
+		NetworkNumOfNodes = 0;
+		AFECTL.deallocate();
+		AFLOW2.deallocate();
+		AFLOW.deallocate();
+		PS.deallocate();
+		PW.deallocate();
+		PB = 0.0;
+		LIST = 0;
+		RHOZ.deallocate();
+		SQRTDZ.deallocate();
+		VISCZ.deallocate();
+		SUMAF.deallocate();
+		TZ.deallocate();
+		WZ.deallocate();
+		PZ.deallocate();
+		ID.deallocate();
+		IK.deallocate();
+		AD.deallocate();
+		AU.deallocate();
+		newIK.deallocate();
+		newAU.deallocate();
+		SUMF.deallocate();
+		Unit11 = 0;
+		Unit21 = 0;
+		DpProf.deallocate();
+		RhoProfF.deallocate();
+		RhoProfT.deallocate();
+		DpL.deallocate();
+		L = 0;
+		ilayptr = 0;
+	}
+
 	void
 	AllocateAirflowNetworkData()
 	{
@@ -5253,8 +5301,6 @@ Label90: ;
 		Real64 Rho0;
 		Real64 Rho1;
 		Real64 BetaRho;
-		static int L( 0 );
-		static int ilayptr( 0 );
 
 		// FLOW:
 		Dp = 0.0;
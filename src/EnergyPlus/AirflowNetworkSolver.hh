@@ -123,6 +123,11 @@ namespace AirflowNetworkSolver {
 
 	// Functions
 
+	// Clears the global data in AirflowNetworkSolver.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	AllocateAirflowNetworkData();
 
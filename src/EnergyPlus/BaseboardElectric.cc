@@ -124,6 +124,19 @@ namespace BaseboardElectric {
 	Array1D< BaseboardParams > Baseboard;
 	Array1D< BaseboardNumericFieldData > BaseboardNumericFields;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // one time get input flag
+		bool ErrorsFound( false ); // If errors detected in input
+		bool MyOneTimeFlag( true );
+		bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
+		Array1D_bool MyEnvrnFlag;
+	}
+
 	// Functions
 
 	void
@@ -134,6 +147,11 @@ namespace BaseboardElectric {
 		CheckEquipName.deallocate();
 		Baseboard.deallocate();
 		BaseboardNumericFields.deallocate();
+		GetInputFlag = true;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		ZoneEquipmentListChecked = false;
+		MyEnvrnFlag.deallocate();
 	}
 
 	void
@@ -181,7 +199,6 @@ namespace BaseboardElectric {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		int BaseboardNum; // index of unit in baseboard array
-		static bool GetInputFlag( true ); // one time get input flag
 		Real64 QZnReq; // zone load not yet satisfied
 
 		if ( GetInputFlag ) {
@@ -282,7 +299,6 @@ namespace BaseboardElectric {
 		int NumAlphas;
 		int NumNums;
 		int IOStat;
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool errFlag;
@@ -469,10 +485,7 @@ namespace BaseboardElectric {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ZoneNode;
-		static bool MyOneTimeFlag( true );
-		static bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
 		int Loop;
-		static Array1D_bool MyEnvrnFlag;
 
 		// Do the one time initializations
 		if ( MyOneTimeFlag ) {
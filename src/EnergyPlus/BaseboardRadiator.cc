@@ -151,6 +151,19 @@ namespace BaseboardRadiator {
 	Array1D< BaseboardParams > Baseboard;
 	Array1D< BaseboardParamsNumericFieldData > BaseboardParamsNumericFields;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // one time get input flag
+		bool ErrorsFound( false ); // If errors detected in input
+		bool MyOneTimeFlag( true );
+		bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
+		Array1D_bool MyEnvrnFlag;
+	}
+
 	// Functions
 
 	void
@@ -162,6 +175,11 @@ namespace BaseboardRadiator {
 		SetLoopIndexFlag.deallocate();
 		Baseboard.deallocate();
 		BaseboardParamsNumericFields.deallocate();
+		GetInputFlag = true;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		ZoneEquipmentListChecked = false;
+		MyEnvrnFlag.deallocate();
 	}
 
 	void
@@ -200,7 +218,6 @@ namespace BaseboardRadiator {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		int BaseboardNum; // index of unit in baseboard array
-		static bool GetInputFlag( true ); // one time get input flag
 		Real64 QZnReq; // zone load not yet satisfied
 		Real64 MaxWaterFlow;
 		Real64 MinWaterFlow;
@@ -330,7 +347,6 @@ namespace BaseboardRadiator {
 		int NumAlphas;
 		int NumNums;
 		int IOStat;
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool errFlag;
@@ -529,10 +545,7 @@ namespace BaseboardRadiator {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int WaterInletNode;
 		int ZoneNode;
-		static bool MyOneTimeFlag( true );
-		static bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
 		int Loop;
-		static Array1D_bool MyEnvrnFlag;
 		Real64 RhoAirStdInit;
 		Real64 rho; // local fluid density
 		Real64 Cp; // local fluid specific heat
@@ -634,7 +647,8 @@ namespace BaseboardRadiator {
 
 		// Using/Aliasing
 		using namespace DataSizing;
-		using General::SolveRegulaFalsi;
+		using General::SolveRoot;
+		using DataRootFinder::iMethodFalsePosition;
 		using General::RoundSigDigits;
 		using PlantUtilities::RegisterPlantCompDesignFlow;
 		using ReportSizingManager::ReportSizingOutput;
@@ -665,7 +679,6 @@ namespace BaseboardRadiator {
 		Real64 UA0; // lower bound for UA
 		Real64 UA1; // upper bound for UA
 		Real64 UA;
-		Array1D< Real64 > Par( 2 );
 		bool ErrorsFound( false ); // If errors detected in input
 		Real64 rho; // local fluid density
 		Real64 Cp; // local fluid specific heat
@@ -838,15 +851,12 @@ namespace BaseboardRadiator {
 					if ( DesCoilLoad >= SmallLoad ) {
 						// pick an air  mass flow rate that is twice the water mass flow rate (CR8842)
 						Baseboard( BaseboardNum ).DesAirMassFlowRate = 2.0 * rho * Baseboard( BaseboardNum ).WaterVolFlowRateMax;
-						// pass along the coil number and the design load to the residual calculation
-						Par( 1 ) = DesCoilLoad;
-						Par( 2 ) = BaseboardNum;
 						// set the lower and upper limits on the UA
 						UA0 = 0.001 * DesCoilLoad;
 						UA1 = DesCoilLoad;
 						// Invert the baseboard model: given the design inlet conditions and the design load,
 						// find the design UA.
-						SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, HWBaseboardUAResidual, UA0, UA1, Par );
+						SolveRoot( Acc, MaxIte, SolFla, UA, [&]( Real64 const UATrial ) { return HWBaseboardUAResidual( UATrial, BaseboardNum, DesCoilLoad ); }, UA0, UA1, iMethodFalsePosition, RoutineName.c_str() );
 						// if the numerical inversion failed, issue error messages.
 						if ( SolFla == -1 ) {
 							ShowSevereError( "SizeBaseboard: Autosizing of HW baseboard UA failed for " + cCMO_BBRadiator_Water + "=\"" + Baseboard( BaseboardNum ).EquipID + "\"" );
@@ -913,7 +923,7 @@ namespace BaseboardRadiator {
 
 	void
 	SimHWConvective(
-		int & BaseboardNum,
+		int const BaseboardNum,
 		Real64 & LoadMet
 	)
 	{
@@ -1156,7 +1166,8 @@ namespace BaseboardRadiator {
 	Real64
 	HWBaseboardUAResidual(
 		Real64 const UA, // UA of coil
-		Array1< Real64 > const & Par // par(1) = design coil load [W]
+		int const BaseboardNum, // index of the baseboard being sized
+		Real64 const DesCoilLoad // design coil load [W]
 	)
 	{
 
@@ -1197,13 +1208,11 @@ namespace BaseboardRadiator {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		int BaseboardIndex;
 		Real64 LoadMet;
 
-		BaseboardIndex = int( Par( 2 ) );
-		Baseboard( BaseboardIndex ).UA = UA;
-		SimHWConvective( BaseboardIndex, LoadMet );
-		Residuum = ( Par( 1 ) - LoadMet ) / Par( 1 );
+		Baseboard( BaseboardNum ).UA = UA;
+		SimHWConvective( BaseboardNum, LoadMet );
+		Residuum = ( DesCoilLoad - LoadMet ) / DesCoilLoad;
 
 		return Residuum;
 	}
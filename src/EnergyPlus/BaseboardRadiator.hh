@@ -212,7 +212,7 @@ namespace BaseboardRadiator {
 
 	void
 	SimHWConvective(
-		int & BaseboardNum,
+		int const BaseboardNum,
 		Real64 & LoadMet
 	);
 
@@ -225,7 +225,8 @@ namespace BaseboardRadiator {
 	Real64
 	HWBaseboardUAResidual(
 		Real64 const UA, // UA of coil
-		Array1< Real64 > const & Par // par(1) = design coil load [W]
+		int const BaseboardNum, // index of the baseboard being sized
+		Real64 const DesCoilLoad // design coil load [W]
 	);
 
 	void
@@ -147,6 +147,19 @@ namespace BoilerSteam {
 
 	// Beginning of Boiler Module Driver Subroutines
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInput( true ); // if TRUE read user input
+		bool ErrorsFound( false );
+		bool MyOneTimeFlag( true );
+		Array1D_bool MyFlag;
+		Array1D_bool MyEnvrnFlag;
+	}
+
 	// Functions
 
 	void
@@ -163,6 +176,11 @@ namespace BoilerSteam {
 		CheckEquipName.deallocate();
 		Boiler.deallocate();
 		BoilerReport.deallocate();
+		GetInput = true;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		MyFlag.deallocate();
+		MyEnvrnFlag.deallocate();
 	}
 
 	void
@@ -209,7 +227,6 @@ namespace BoilerSteam {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInput( true ); // if TRUE read user input
 		int BoilerNum; // boiler counter/identifier
 
 		//Get Input
@@ -302,7 +319,6 @@ namespace BoilerSteam {
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int SteamFluidIndex; // Fluid Index for Steam
-		static bool ErrorsFound( false );
 		bool errFlag;
 		Array1D_string BoilerFuelTypeForOutputVariable; // used to set up report variables
 
@@ -515,9 +531,6 @@ namespace BoilerSteam {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyFlag;
-		static Array1D_bool MyEnvrnFlag;
 		bool FatalError;
 		Real64 TempUpLimitBoilerOut; // C - Boiler outlet maximum temperature limit
 		Real64 EnthSteamOutWet;
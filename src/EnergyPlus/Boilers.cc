@@ -162,6 +162,19 @@ namespace Boilers {
 	// Beginning of Boiler Module Driver Subroutines
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInput( true ); // if TRUE read user input
+		bool ErrorsFound( false ); // Flag to show errors were found during GetInput
+		bool MyOneTimeFlag( true ); // one time flag
+		Array1D_bool MyEnvrnFlag; // environment flag
+		Array1D_bool MyFlag;
+	}
+
 	// Functions
 
 	void
@@ -177,6 +190,11 @@ namespace Boilers {
 		CheckEquipName.deallocate();
 		Boiler.deallocate();
 		BoilerReport.deallocate();
+		GetInput = true;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		MyEnvrnFlag.deallocate();
+		MyFlag.deallocate();
 	}
 
 	void
@@ -220,7 +238,6 @@ namespace Boilers {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInput( true ); // if TRUE read user input
 		int BoilerNum; // boiler counter/identifier
 
 		//FLOW
@@ -316,7 +333,6 @@ namespace Boilers {
 		int NumAlphas; // Number of elements in the alpha array
 		int NumNums; // Number of elements in the numeric array
 		int IOStat; // IO Status when calling get input subroutine
-		static bool ErrorsFound( false ); // Flag to show errors were found during GetInput
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool errFlag; // Flag to show errors were found during function call
@@ -594,9 +610,6 @@ namespace Boilers {
 		static std::string const RoutineName( "InitBoiler" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true ); // one time flag
-		static Array1D_bool MyEnvrnFlag; // environment flag
-		static Array1D_bool MyFlag;
 		Real64 rho;
 		bool FatalError;
 		bool errFlag;
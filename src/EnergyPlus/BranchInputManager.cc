@@ -157,6 +157,9 @@ namespace BranchInputManager {
 		// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
 		// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
 		bool GetBranchInputOneTimeFlag( true );
+		Array1D< ComponentData > GetBranchDataBComponents; // Component data to be returned
+		bool GetSplitterInputErrorsFound( false );
+		bool GetMixerInputErrorsFound( false );
 	}
 	//SUBROUTINE SPECIFICATIONS FOR MODULE BranchInputManager
 	//PUBLIC  TestAirPathIntegrity
@@ -192,6 +195,9 @@ namespace BranchInputManager {
 		ConnectorLists.deallocate(); // Connector List data for each Connector List
 		Splitters.deallocate(); // Splitter Data for each Splitter
 		Mixers.deallocate(); // Mixer Data for each Mixer
+		GetBranchDataBComponents.deallocate();
+		GetSplitterInputErrorsFound = false;
+		GetMixerInputErrorsFound = false;
 	}
 
 	void
@@ -451,13 +457,12 @@ namespace BranchInputManager {
 		int MinCompsAllowed;
 
 		// Object Data
-		static Array1D< ComponentData > BComponents; // Component data to be returned
 
 		// NumComps now defined on input
 
-		BComponents.allocate( NumComps );
+		GetBranchDataBComponents.allocate( NumComps );
 
-		GetInternalBranchData( LoopName, BranchName, PressCurveType, PressCurveIndex, NumComps, BComponents, ErrorsFound );
+		GetInternalBranchData( LoopName, BranchName, PressCurveType, PressCurveIndex, NumComps, GetBranchDataBComponents, ErrorsFound );
 
 		MinCompsAllowed = min( size( CompType ), size( CompName ), size( CompInletNodeNames ), size( CompInletNodeNums ), size( CompOutletNodeNames ), size( CompOutletNodeNums ) );
 		if ( MinCompsAllowed < NumComps ) {
@@ -468,14 +473,14 @@ namespace BranchInputManager {
 		}
 
 		for ( Count = 1; Count <= NumComps; ++Count ) {
-			CompType( Count ) = BComponents( Count ).CType;
-			CompName( Count ) = BComponents( Count ).Name;
-			CompInletNodeNames( Count ) = BComponents( Count ).InletNodeName;
-			CompInletNodeNums( Count ) = BComponents( Count ).InletNode;
-			CompOutletNodeNames( Count ) = BComponents( Count ).OutletNodeName;
-			CompOutletNodeNums( Count ) = BComponents( Count ).OutletNode;
+			CompType( Count ) = GetBranchDataBComponents( Count ).CType;
+			CompName( Count ) = GetBranchDataBComponents( Count ).Name;
+			CompInletNodeNames( Count ) = GetBranchDataBComponents( Count ).InletNodeName;
+			CompInletNodeNums( Count ) = GetBranchDataBComponents( Count ).InletNode;
+			CompOutletNodeNames( Count ) = GetBranchDataBComponents( Count ).OutletNodeName;
+			CompOutletNodeNums( Count ) = GetBranchDataBComponents( Count ).OutletNode;
 		}
-		BComponents.deallocate();
+		GetBranchDataBComponents.deallocate();
 
 	}
 
@@ -2079,7 +2084,6 @@ namespace BranchInputManager {
 		int Loop1;
 		int Count;
 		int Found;
-		static bool ErrorsFound( false );
 		std::string TestName;
 		std::string BranchListName;
 		std::string FoundSupplyDemandAir;
@@ -2126,13 +2130,13 @@ namespace BranchInputManager {
 			Found = FindItemInList( Splitters( Count ).InletBranchName, Branch );
 			if ( Found == 0 ) {
 				ShowSevereError( "GetSplitterInput: Invalid Branch=" + Splitters( Count ).InletBranchName + ", referenced as Inlet Branch to " + CurrentModuleObject + '=' + Splitters( Count ).Name );
-				ErrorsFound = true;
+				GetSplitterInputErrorsFound = true;
 			}
 			for ( Loop = 1; Loop <= Splitters( Count ).NumOutletBranches; ++Loop ) {
 				Found = FindItemInList( Splitters( Count ).OutletBranchNames( Loop ), Branch );
 				if ( Found == 0 ) {
 					ShowSevereError( "GetSplitterInput: Invalid Branch=" + Splitters( Count ).OutletBranchNames( Loop ) + ", referenced as Outlet Branch # " + TrimSigDigits( Loop ) + " to " + CurrentModuleObject + '=' + Splitters( Count ).Name );
-					ErrorsFound = true;
+					GetSplitterInputErrorsFound = true;
 				}
 			}
 		}
@@ -2145,7 +2149,7 @@ namespace BranchInputManager {
 				ShowSevereError( CurrentModuleObject + '=' + Splitters( Count ).Name + " specifies an outlet node name the same as the inlet node." );
 				ShowContinueError( "..Inlet Node=" + TestName );
 				ShowContinueError( "..Outlet Node #" + TrimSigDigits( Loop ) + " is duplicate." );
-				ErrorsFound = true;
+				GetSplitterInputErrorsFound = true;
 			}
 			for ( Loop = 1; Loop <= Splitters( Count ).NumOutletBranches; ++Loop ) {
 				for ( Loop1 = Loop + 1; Loop1 <= Splitters( Count ).NumOutletBranches; ++Loop1 ) {
@@ -2153,12 +2157,12 @@ namespace BranchInputManager {
 					ShowSevereError( CurrentModuleObject + '=' + Splitters( Count ).Name + " specifies duplicate outlet nodes in its outlet node list." );
 					ShowContinueError( "..Outlet Node #" + TrimSigDigits( Loop ) + " Name=" + Splitters( Count ).OutletBranchNames( Loop ) );
 					ShowContinueError( "..Outlet Node #" + TrimSigDigits( Loop ) + " is duplicate." );
-					ErrorsFound = true;
+					GetSplitterInputErrorsFound = true;
 				}
 			}
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetSplitterInputErrorsFound ) {
 			ShowFatalError( "GetSplitterInput: Fatal Errors Found in " + CurrentModuleObject + ", program terminates." );
 		}
 
@@ -2188,13 +2192,13 @@ namespace BranchInputManager {
 					ShowSevereError( "GetSplitterInput: Inlet Splitter Branch=\"" + TestName + "\" and BranchList=\"" + BranchListName + "\" not matched to a Air/Plant/Condenser Loop" );
 					ShowContinueError( "...and therefore, not a valid Loop Splitter." );
 					ShowContinueError( "..." + CurrentModuleObject + '=' + Splitters( Count ).Name );
-					ErrorsFound = true;
+					GetSplitterInputErrorsFound = true;
 				}
 			} else {
 				ShowSevereError( "GetSplitterInput: Inlet Splitter Branch=\"" + TestName + "\" not on BranchList" );
 				ShowContinueError( "...and therefore, not a valid Loop Splitter." );
 				ShowContinueError( "..." + CurrentModuleObject + '=' + Splitters( Count ).Name );
-				ErrorsFound = true;
+				GetSplitterInputErrorsFound = true;
 			}
 			for ( Loop = 1; Loop <= Splitters( Count ).NumOutletBranches; ++Loop ) {
 				TestName = Splitters( Count ).OutletBranchNames( Loop );
@@ -2219,25 +2223,25 @@ namespace BranchInputManager {
 							ShowContinueError( "...Outlet Branch is on \"" + FoundLoop + "\" on \"" + FoundSupplyDemandAir + "\" side." );
 							ShowContinueError( "...All branches in Loop Splitter must be on same kind of loop and supply/demand side." );
 							ShowContinueError( "..." + CurrentModuleObject + '=' + Splitters( Count ).Name );
-							ErrorsFound = true;
+							GetSplitterInputErrorsFound = true;
 						}
 					} else {
 						ShowSevereError( "GetSplitterInput: Outlet Splitter Branch=\"" + TestName + "\" and BranchList=\"" + BranchListName + "\" not matched to a Air/Plant/Condenser Loop" );
 						ShowContinueError( "...and therefore, not a valid Loop Splitter." );
 						ShowContinueError( "..." + CurrentModuleObject + '=' + Splitters( Count ).Name );
-						ErrorsFound = true;
+						GetSplitterInputErrorsFound = true;
 					}
 				} else {
 					ShowSevereError( "GetSplitterInput: Outlet Splitter Branch=\"" + TestName + "\" not on BranchList" );
 					ShowContinueError( "...and therefore, not a valid Loop Splitter" );
 					ShowContinueError( "..." + CurrentModuleObject + '=' + Splitters( Count ).Name );
-					ErrorsFound = true;
+					GetSplitterInputErrorsFound = true;
 				}
 			}
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetSplitterInputErrorsFound ) {
 			ShowFatalError( "GetSplitterInput: Fatal Errors Found in " + CurrentModuleObject + ", program terminates." );
 		}
 
@@ -2312,7 +2316,6 @@ namespace BranchInputManager {
 		int Loop1;
 		int Count;
 		int Found;
-		static bool ErrorsFound( false );
 		std::string TestName;
 		std::string BranchListName;
 		std::string FoundSupplyDemandAir;
@@ -2361,13 +2364,13 @@ namespace BranchInputManager {
 			Found = FindItemInList( Mixers( Count ).OutletBranchName, Branch );
 			if ( Found == 0 ) {
 				ShowSevereError( "GetMixerInput: Invalid Branch=" + Mixers( Count ).OutletBranchName + ", referenced as Outlet Branch in " + CurrentModuleObject + '=' + Mixers( Count ).Name );
-				ErrorsFound = true;
+				GetMixerInputErrorsFound = true;
 			}
 			for ( Loop = 1; Loop <= Mixers( Count ).NumInletBranches; ++Loop ) {
 				Found = FindItemInList( Mixers( Count ).InletBranchNames( Loop ), Branch );
 				if ( Found == 0 ) {
 					ShowSevereError( "GetMixerInput: Invalid Branch=" + Mixers( Count ).InletBranchNames( Loop ) + ", referenced as Inlet Branch # " + TrimSigDigits( Loop ) + " in " + CurrentModuleObject + '=' + Mixers( Count ).Name );
-					ErrorsFound = true;
+					GetMixerInputErrorsFound = true;
 				}
 			}
 		}
@@ -2380,7 +2383,7 @@ namespace BranchInputManager {
 				ShowSevereError( CurrentModuleObject + '=' + Mixers( Count ).Name + " specifies an inlet node name the same as the outlet node." );
 				ShowContinueError( "..Outlet Node=" + TestName );
 				ShowContinueError( "..Inlet Node #" + TrimSigDigits( Loop ) + " is duplicate." );
-				ErrorsFound = true;
+				GetMixerInputErrorsFound = true;
 			}
 			for ( Loop = 1; Loop <= Mixers( Count ).NumInletBranches; ++Loop ) {
 				for ( Loop1 = Loop + 1; Loop1 <= Mixers( Count ).NumInletBranches; ++Loop1 ) {
@@ -2388,12 +2391,12 @@ namespace BranchInputManager {
 					ShowSevereError( CurrentModuleObject + '=' + Mixers( Count ).Name + " specifies duplicate inlet nodes in its inlet node list." );
 					ShowContinueError( "..Inlet Node #" + TrimSigDigits( Loop ) + " Name=" + Mixers( Count ).InletBranchNames( Loop ) );
 					ShowContinueError( "..Inlet Node #" + TrimSigDigits( Loop ) + " is duplicate." );
-					ErrorsFound = true;
+					GetMixerInputErrorsFound = true;
 				}
 			}
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetMixerInputErrorsFound ) {
 			ShowFatalError( "GetMixerInput: Fatal Errors Found in " + CurrentModuleObject + ", program terminates." );
 		}
 
@@ -2423,13 +2426,13 @@ namespace BranchInputManager {
 					ShowSevereError( "GetMixerInput: Outlet Mixer Branch=\"" + TestName + "\" and BranchList=\"" + BranchListName + "\" not matched to a Air/Plant/Condenser Loop" );
 					ShowContinueError( "...and therefore, not a valid Loop Mixer." );
 					ShowContinueError( "..." + CurrentModuleObject + '=' + Mixers( Count ).Name );
-					ErrorsFound = true;
+					GetMixerInputErrorsFound = true;
 				}
 			} else {
 				ShowSevereError( "GetMixerInput: Outlet Mixer Branch=\"" + TestName + "\" not on BranchList" );
 				ShowContinueError( "...and therefore, not a valid Loop Mixer." );
 				ShowContinueError( "..." + CurrentModuleObject + '=' + Mixers( Count ).Name );
-				ErrorsFound = true;
+				GetMixerInputErrorsFound = true;
 			}
 			for ( Loop = 1; Loop <= Mixers( Count ).NumInletBranches; ++Loop ) {
 				TestName = Mixers( Count ).InletBranchNames( Loop );
@@ -2454,24 +2457,24 @@ namespace BranchInputManager {
 							ShowContinueError( "...Inlet Branch is on \"" + FoundLoop + "\" on \"" + FoundSupplyDemandAir + "\" side." );
 							ShowContinueError( "...All branches in Loop Mixer must be on same kind of loop and supply/demand side." );
 							ShowContinueError( "..." + CurrentModuleObject + '=' + Mixers( Count ).Name );
-							ErrorsFound = true;
+							GetMixerInputErrorsFound = true;
 						}
 					} else {
 						ShowSevereError( "GetMixerInput: Inlet Mixer Branch=\"" + TestName + "\" and BranchList=\"" + BranchListName + "\" not matched to a Air/Plant/Condenser Loop" );
 						ShowContinueError( "...and therefore, not a valid Loop Mixer." );
 						ShowContinueError( "..." + CurrentModuleObject + '=' + Mixers( Count ).Name );
-						ErrorsFound = true;
+						GetMixerInputErrorsFound = true;
 					}
 				} else {
 					ShowSevereError( "GetMixerInput: Inlet Mixer Branch=\"" + TestName + "\" not on BranchList" );
 					ShowContinueError( "...and therefore, not a valid Loop Mixer" );
 					ShowContinueError( "..." + CurrentModuleObject + '=' + Mixers( Count ).Name );
-					ErrorsFound = true;
+					GetMixerInputErrorsFound = true;
 				}
 			}
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetMixerInputErrorsFound ) {
 			ShowFatalError( "GetMixerInput: Fatal Errors Found in " + CurrentModuleObject + ", program terminates." );
 		}
 
@@ -125,6 +125,38 @@ namespace CTElectricGenerator {
 	Array1D< CTGeneratorSpecs > CTGenerator; // dimension to number of machines
 	Array1D< ReportVars > CTGeneratorReport;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false ); // error flag
+		bool MyOneTimeFlag( true ); // Initialization flag
+		Array1D_bool MyEnvrnFlag; // Used for initializations each begin environment flag
+		Array1D_bool MyPlantScanFlag;
+		Array1D_bool MySizeAndNodeInitFlag;
+	}
+
+	// Functions
+
+	// Clears the global data in CTElectricGenerator.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumCTGenerators = 0;
+		GetCTInput = true;
+		CheckEquipName.deallocate();
+		CTGenerator.deallocate();
+		CTGeneratorReport.deallocate();
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		MyEnvrnFlag.deallocate();
+		MyPlantScanFlag.deallocate();
+		MySizeAndNodeInitFlag.deallocate();
+	}
+
 	void
 	SimCTGenerator(
 		int const EP_UNUSED( GeneratorType ), // type of Generator
@@ -307,7 +339,6 @@ namespace CTElectricGenerator {
 		int IOStat; // IO Status when calling get input subroutine
 		Array1D_string AlphArray( 12 ); // character string data
 		Array1D< Real64 > NumArray( 12 ); // numeric data
-		static bool ErrorsFound( false ); // error flag
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 
@@ -818,11 +849,7 @@ namespace CTElectricGenerator {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int HeatRecInletNode; // inlet node number in heat recovery loop
 		int HeatRecOutletNode; // outlet node number in heat recovery loop
-		static bool MyOneTimeFlag( true ); // Initialization flag
 
-		static Array1D_bool MyEnvrnFlag; // Used for initializations each begin environment flag
-		static Array1D_bool MyPlantScanFlag;
-		static Array1D_bool MySizeAndNodeInitFlag;
 		Real64 mdot;
 		Real64 rho;
 		bool errFlag;
@@ -246,6 +246,11 @@ namespace CTElectricGenerator {
 
 	// Functions
 
+	// Clears the global data in CTElectricGenerator.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimCTGenerator(
 		int const GeneratorType, // type of Generator
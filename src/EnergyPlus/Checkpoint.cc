@@ -0,0 +1,1709 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// C++ Headers
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <vector>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// EnergyPlus Headers
+#include <Checkpoint.hh>
+#include <DataEnvironment.hh>
+#include <DataGlobals.hh>
+#include <DataHeatBalance.hh>
+#include <DataHeatBalFanSys.hh>
+#include <DataLoopNode.hh>
+#include <DataPlant.hh>
+#include <DataPlantPipingSystems.hh>
+#include <DataPrecisionGlobals.hh>
+#include <DataReportingFlags.hh>
+#include <DataRuntimeLanguage.hh>
+#include <DataSystemVariables.hh>
+#include <DisplayRoutines.hh>
+#include <EconomicTariff.hh>
+#include <ExteriorEnergyUse.hh>
+#include <General.hh>
+#include <GroundHeatExchangers.hh>
+#include <HeatBalanceSurfaceManager.hh>
+#include <DataStringGlobals.hh>
+#include <InputProcessor.hh>
+#include <OutputProcessor.hh>
+#include <OutputReportTabular.hh>
+#include <OutputReportTabularAnnual.hh>
+#include <SQLiteProcedures.hh>
+#include <ThermalComfort.hh>
+#include <UtilityRoutines.hh>
+#include <WaterThermalTanks.hh>
+
+namespace EnergyPlus {
+
+namespace Checkpoint {
+
+	// MODULE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2016
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS MODULE:
+	// Saves the state of a weather file run period at the end of each simulated day and restores
+	// it so that an interrupted simulation can be resumed after the last saved day.
+
+	// METHODOLOGY EMPLOYED:
+	// The checkpoint file starts with a line "Checkpoint,<environment number>,<day of simulation>,
+	// <overall simulation day>,<warmup days>,<environment name>" followed by named sections, each a
+	// line "Section,<name>,<number of values>" and the values.  On restart the weather is advanced
+	// to the day after the checkpoint and every section is restored by the module that owns the
+	// state, right after its begin environment initializations would otherwise have reset it.
+	// A new checkpoint is written to a temporary file that then replaces the previous one, so a run
+	// interrupted while writing still leaves a complete checkpoint behind.  The checkpoint also holds
+	// the sizes of the standard and meter output files; on restart the output written up to the
+	// checkpoint is kept aside and the output of the resumed run is appended to it at the end.
+	// The SQLite output of the interrupted run is kept aside as well, and its report records up to
+	// the checkpoint are copied into the database of the resumed run before the main simulation.
+	// The values a later segment of a split run period gathered for the tabular reports are saved
+	// in sections of the same format, for the first segment to merge them into its own.
+
+	// REFERENCES:
+	// na
+
+	// OTHER NOTES:
+	// Ground heat transfer domains, indoor, outdoor and underground pipes, surface and pond ground
+	// heat exchangers, ice storage, integral collector storage solar collectors and the annual
+	// tabular reports are not saved.  Checkpoints are not written for models that have them, and a
+	// restart of such a model stops.  The plant and condenser loops keep their fluid temperatures;
+	// component models other than water thermal tanks and vertical and slinky ground heat exchangers
+	// start the resumed environment from their normal initial state.
+
+	// Using/Aliasing
+	using namespace DataPrecisionGlobals;
+	using DataEnvironment::CurEnvirNum;
+	using DataEnvironment::CurrentOverallSimDay;
+	using DataEnvironment::EnvironmentName;
+	using DataGlobals::DayOfSim;
+	using DataSystemVariables::CheckpointFileName;
+
+	// Data
+	// MODULE VARIABLE DECLARATIONS:
+	bool RestartPending( false ); // True from reading the checkpoint until the first time step of the resumed environment
+	int RestartEnvrnNum( 0 ); // Environment that was being simulated at the checkpoint
+	std::string RestartEnvironmentName; // Name of that environment
+	int RestartDayOfSim( 0 ); // Last day of the environment simulated before the checkpoint
+	int RestartOverallSimDay( 0 ); // Simulation days of all environments completed at the checkpoint
+	int RestartWarmupDays( 0 ); // Warmup days of the environment
+
+	namespace {
+		struct SavedSection
+		{
+			Array1D< Real64 > State; // Saved values
+			bool Restored; // True once the section has been restored
+
+			SavedSection() :
+				Restored( false )
+			{}
+		};
+
+		std::map< std::string, SavedSection > Sections; // Sections read from the checkpoint
+		bool ModelChecked( false ); // True once the model has been checked for state that is not saved
+		bool ModelSaved( true ); // False if the model has state that a checkpoint does not hold
+		Real64 KeptEsoSize( 0.0 ); // Standard output written before the restart, kept in <file>.restart (0 if none)
+		Real64 KeptMtrSize( 0.0 ); // Meter output written before the restart, kept in <file>.restart (0 if none)
+
+		typedef std::function< void( Array1D< Real64 > &, bool const ) > ExchangeFunction;
+
+		// Copies between a packed section and the state it was saved from.  The section is
+		// dimensioned when gathering.  When merging, the section holds the values a later segment
+		// of a split run period gathered, and they are combined with the values of this segment.
+		class SectionExchange
+		{
+		public:
+			enum ExchangeMode {
+				GatherState, // copy the state into the section
+				RestoreState, // copy the section into the state
+				MergeState // combine the section with the state
+			};
+
+			SectionExchange(
+				Array1D< Real64 > & State,
+				ExchangeMode const Mode
+			) :
+				State_( State ),
+				Mode_( Mode ),
+				Pos_( 0 ),
+				Overrun_( false )
+			{
+				if ( Mode_ == GatherState ) State_.deallocate();
+			}
+
+			SectionExchange(
+				Array1D< Real64 > & State,
+				bool const Gather
+			) :
+				SectionExchange( State, Gather ? GatherState : RestoreState )
+			{}
+
+			// Copies a value, sums are added when merging
+			void
+			operator ()( Real64 & Value )
+			{
+				Real64 const Saved( next( Value ) );
+				if ( Mode_ == RestoreState ) {
+					Value = Saved;
+				} else if ( Mode_ == MergeState ) {
+					Value += Saved;
+				}
+			}
+
+			void
+			operator ()( int & Value )
+			{
+				Real64 RealValue( Value );
+				operator ()( RealValue );
+				Value = nint( RealValue );
+			}
+
+			// Copies a flag, either one set is kept when merging
+			void
+			operator ()( bool & Value )
+			{
+				Real64 RealValue( Value ? 1.0 : 0.0 );
+				operator ()( RealValue );
+				Value = ( RealValue != 0.0 );
+			}
+
+			template< typename T >
+			void
+			operator ()( Array< T > & Values )
+			{
+				for ( auto & Value : Values ) operator ()( Value );
+			}
+
+			// Copies values gathered one per time step, they are appended when merging
+			void
+			operator ()( std::vector< Real64 > & Values )
+			{
+				Real64 const Size( next( Real64( Values.size() ) ) );
+				if ( Mode_ == GatherState ) {
+					for ( auto const Value : Values ) next( Value );
+					return;
+				}
+				std::size_t const First( Mode_ == MergeState ? Values.size() : 0u );
+				Values.resize( First + std::size_t( std::max( Size, 0.0 ) ) );
+				for ( std::size_t Pos = First; Pos < Values.size(); ++Pos ) Values[ Pos ] = next( 0.0 );
+			}
+
+			// Copies a peak value, the larger one is kept when merging.  Returns true if the merged
+			// value was, so the values that go with the peak can be selected along with it.
+			bool
+			maximum( Real64 & Value )
+			{
+				Real64 const Saved( next( Value ) );
+				if ( Mode_ == RestoreState ) Value = Saved;
+				if ( Mode_ != MergeState || Saved <= Value ) return false;
+				Value = Saved;
+				return true;
+			}
+
+			// Copies a peak value, the smaller one is kept when merging
+			bool
+			minimum( Real64 & Value )
+			{
+				Real64 const Saved( next( Value ) );
+				if ( Mode_ == RestoreState ) Value = Saved;
+				if ( Mode_ != MergeState || Saved >= Value ) return false;
+				Value = Saved;
+				return true;
+			}
+
+			// Copies a value, the merged value replaces it only if Merged is true
+			void
+			select(
+				Real64 & Value,
+				bool const Merged
+			)
+			{
+				Real64 const Saved( next( Value ) );
+				if ( Mode_ == RestoreState || ( Mode_ == MergeState && Merged ) ) Value = Saved;
+			}
+
+			void
+			select(
+				int & Value,
+				bool const Merged
+			)
+			{
+				Real64 RealValue( Value );
+				select( RealValue, Merged );
+				Value = nint( RealValue );
+			}
+
+			template< typename T >
+			void
+			select(
+				Array< T > & Values,
+				bool const Merged
+			)
+			{
+				for ( auto & Value : Values ) select( Value, Merged );
+			}
+
+			// True if the section held exactly the values that were restored or merged
+			bool
+			matched() const
+			{
+				return ! Overrun_ && Pos_ == int( State_.size() );
+			}
+
+			~SectionExchange()
+			{
+				if ( Mode_ == GatherState ) {
+					State_.dimension( Values_.size() );
+					for ( std::size_t Pos = 0; Pos < Values_.size(); ++Pos ) State_[ Pos ] = Values_[ Pos ];
+				}
+			}
+
+		private:
+			// Gathers a value, or returns the next value of the section
+			Real64
+			next( Real64 const Value )
+			{
+				++Pos_;
+				if ( Mode_ == GatherState ) {
+					Values_.push_back( Value );
+					return Value;
+				}
+				if ( Pos_ > int( State_.size() ) ) {
+					Overrun_ = true;
+					return Value;
+				}
+				return State_( Pos_ );
+			}
+
+			Array1D< Real64 > & State_;
+			ExchangeMode const Mode_;
+			int Pos_;
+			bool Overrun_; // The section ran out of values
+			std::vector< Real64 > Values_;
+		};
+
+		void
+		ExchangeSurfaceHistories(
+			Array1D< Real64 > & State,
+			bool const Gather
+		)
+		{
+			if ( Gather ) {
+				HeatBalanceSurfaceManager::GetSurfaceHistoryState( State );
+			} else {
+				HeatBalanceSurfaceManager::SetSurfaceHistoryState( State );
+			}
+		}
+
+		void
+		ExchangeWaterThermalTank(
+			int const TankNum,
+			Array1D< Real64 > & State,
+			bool const Gather
+		)
+		{
+			auto & Tank( WaterThermalTanks::WaterThermalTank( TankNum ) );
+			SectionExchange exchange( State, Gather );
+			exchange( Tank.TankTemp );
+			exchange( Tank.SavedTankTemp );
+			exchange( Tank.TankTempAvg );
+			exchange( Tank.SourceOutletTemp );
+			exchange( Tank.SavedSourceOutletTemp );
+			exchange( Tank.UseOutletTemp );
+			exchange( Tank.SavedUseOutletTemp );
+			exchange( Tank.SavedHeaterOn1 );
+			exchange( Tank.SavedHeaterOn2 );
+			exchange( Tank.SavedMode );
+			for ( auto & Node : Tank.Node ) {
+				exchange( Node.Temp );
+				exchange( Node.SavedTemp );
+				exchange( Node.TempAvg );
+			}
+		}
+
+		// Fluid temperatures of the plant and condenser loops and of the nodes of their components
+		void
+		ExchangePlantLoops(
+			Array1D< Real64 > & State,
+			bool const Gather
+		)
+		{
+			using DataLoopNode::Node;
+			SectionExchange exchange( State, Gather );
+			for ( int LoopNum = 1; LoopNum <= DataPlant::TotNumLoops; ++LoopNum ) {
+				for ( auto & LoopSide : DataPlant::PlantLoop( LoopNum ).LoopSide ) {
+					exchange( LoopSide.TempInterfaceTankOutlet );
+					exchange( LoopSide.LastTempInterfaceTankOutlet );
+					exchange( LoopSide.LoopSideInlet_TankTemp );
+					exchange( LoopSide.TotalPumpHeat );
+					exchange( LoopSide.InletNode.TemperatureHistory );
+					exchange( LoopSide.InletNode.MassFlowRateHistory );
+					exchange( LoopSide.OutletNode.TemperatureHistory );
+					exchange( LoopSide.OutletNode.MassFlowRateHistory );
+					for ( auto const & Branch : LoopSide.Branch ) {
+						for ( auto const & Comp : Branch.Comp ) {
+							for ( int const NodeNum : { Comp.NodeNumIn, Comp.NodeNumOut } ) {
+								exchange( Node( NodeNum ).Temp );
+								exchange( Node( NodeNum ).TempLastTimestep );
+								exchange( Node( NodeNum ).MassFlowRate );
+								exchange( Node( NodeNum ).Enthalpy );
+							}
+						}
+					}
+				}
+			}
+		}
+
+		// Simulation time and time step history shared by the vertical and slinky ground heat exchangers
+		void
+		ExchangeGroundHeatExchangers(
+			Array1D< Real64 > & State,
+			bool const Gather
+		)
+		{
+			SectionExchange exchange( State, Gather );
+			exchange( GroundHeatExchangers::N );
+			exchange( GroundHeatExchangers::PrevN );
+			exchange( GroundHeatExchangers::currentSimTime );
+			exchange( GroundHeatExchangers::locHourOfDay );
+			exchange( GroundHeatExchangers::locDayOfSim );
+			exchange( GroundHeatExchangers::prevTimeSteps );
+			exchange( GroundHeatExchangers::ToutNew );
+			exchange( GroundHeatExchangers::updateCurSimTime );
+			exchange( GroundHeatExchangers::triggerDesignDayReset );
+		}
+
+		// Load history of a ground heat exchanger
+		void
+		ExchangeGroundHeatExchanger(
+			GroundHeatExchangers::GLHEBase & GLHE,
+			Array1D< Real64 > & State,
+			bool const Gather
+		)
+		{
+			using DataLoopNode::Node;
+			SectionExchange exchange( State, Gather );
+			exchange( GLHE.QnMonthlyAgg );
+			exchange( GLHE.QnHr );
+			exchange( GLHE.QnSubHr );
+			exchange( GLHE.LastHourN );
+			exchange( GLHE.prevHour );
+			exchange( GLHE.lastQnSubHr );
+			exchange( GLHE.QGLHE );
+			exchange( GLHE.inletTemp );
+			exchange( GLHE.outletTemp );
+			exchange( GLHE.aveFluidTemp );
+			exchange( GLHE.boreholeTemp );
+			exchange( Node( GLHE.inletNodeNum ).Temp );
+			exchange( Node( GLHE.outletNodeNum ).Temp );
+		}
+
+		std::string
+		GroundHeatExchangerSectionName(
+			std::string const & ObjectType,
+			GroundHeatExchangers::GLHEBase const & GLHE
+		)
+		{
+			return ObjectType + ':' + GLHE.Name;
+		}
+
+		// Values of the predefined reports accumulated for a zone or the building
+		void
+		ExchangePreDefRep(
+			SectionExchange & exchange,
+			DataHeatBalance::ZonePreDefRepType & Rep
+		)
+		{
+			exchange( Rep.NumOccAccum );
+			exchange( Rep.NumOccAccumTime );
+			exchange( Rep.TotTimeOcc );
+			exchange( Rep.MechVentVolTotal );
+			exchange.minimum( Rep.MechVentVolMin );
+			exchange( Rep.InfilVolTotal );
+			exchange.minimum( Rep.InfilVolMin );
+			exchange( Rep.AFNInfilVolTotal );
+			exchange.minimum( Rep.AFNInfilVolMin );
+			exchange( Rep.SimpVentVolTotal );
+			exchange.minimum( Rep.SimpVentVolMin );
+			exchange( Rep.SHGSAnHvacHt );
+			exchange( Rep.SHGSAnHvacCl );
+			exchange( Rep.SHGSAnHvacATUHt );
+			exchange( Rep.SHGSAnHvacATUCl );
+			exchange( Rep.SHGSAnSurfHt );
+			exchange( Rep.SHGSAnSurfCl );
+			exchange( Rep.SHGSAnPeoplAdd );
+			exchange( Rep.SHGSAnLiteAdd );
+			exchange( Rep.SHGSAnEquipAdd );
+			exchange( Rep.SHGSAnWindAdd );
+			exchange( Rep.SHGSAnIzaAdd );
+			exchange( Rep.SHGSAnInfilAdd );
+			exchange( Rep.SHGSAnOtherAdd );
+			exchange( Rep.SHGSAnEquipRem );
+			exchange( Rep.SHGSAnWindRem );
+			exchange( Rep.SHGSAnIzaRem );
+			exchange( Rep.SHGSAnInfilRem );
+			exchange( Rep.SHGSAnOtherRem );
+			bool const CoolingPeakMerged = exchange.minimum( Rep.clPeak );
+			exchange.select( Rep.clPtTimeStamp, CoolingPeakMerged );
+			exchange.select( Rep.SHGSClHvacHt, CoolingPeakMerged );
+			exchange.select( Rep.SHGSClHvacCl, CoolingPeakMerged );
+			exchange.select( Rep.SHGSClHvacATUHt, CoolingPeakMerged );
+			exchange.select( Rep.SHGSClHvacATUCl, CoolingPeakMerged );
+			exchange.select( Rep.SHGSClSurfHt, CoolingPeakMerged );
+			exchange.select( Rep.SHGSClSurfCl, CoolingPeakMerged );
+			exchange.select( Rep.SHGSClPeoplAdd, CoolingPeakMerged );
+			exchange.select( Rep.SHGSClLiteAdd, CoolingPeakMerged );
+			exchange.select( Rep.SHGSClEquipAdd, CoolingPeakMerged );
+			exchange.select( Rep.SHGSClWindAdd, CoolingPeakMerged );
+			exchange.select( Rep.SHGSClIzaAdd, CoolingPeakMerged );
+			exchange.select( Rep.SHGSClInfilAdd, CoolingPeakMerged );
+			exchange.select( Rep.SHGSClOtherAdd, CoolingPeakMerged );
+			exchange.select( Rep.SHGSClEquipRem, CoolingPeakMerged );
+			exchange.select( Rep.SHGSClWindRem, CoolingPeakMerged );
+			exchange.select( Rep.SHGSClIzaRem, CoolingPeakMerged );
+			exchange.select( Rep.SHGSClInfilRem, CoolingPeakMerged );
+			exchange.select( Rep.SHGSClOtherRem, CoolingPeakMerged );
+			bool const HeatingPeakMerged = exchange.maximum( Rep.htPeak );
+			exchange.select( Rep.htPtTimeStamp, HeatingPeakMerged );
+			exchange.select( Rep.SHGSHtHvacHt, HeatingPeakMerged );
+			exchange.select( Rep.SHGSHtHvacCl, HeatingPeakMerged );
+			exchange.select( Rep.SHGSHtHvacATUHt, HeatingPeakMerged );
+			exchange.select( Rep.SHGSHtHvacATUCl, HeatingPeakMerged );
+			exchange.select( Rep.SHGSHtSurfHt, HeatingPeakMerged );
+			exchange.select( Rep.SHGSHtSurfCl, HeatingPeakMerged );
+			exchange.select( Rep.SHGSHtPeoplAdd, HeatingPeakMerged );
+			exchange.select( Rep.SHGSHtLiteAdd, HeatingPeakMerged );
+			exchange.select( Rep.SHGSHtEquipAdd, HeatingPeakMerged );
+			exchange.select( Rep.SHGSHtWindAdd, HeatingPeakMerged );
+			exchange.select( Rep.SHGSHtIzaAdd, HeatingPeakMerged );
+			exchange.select( Rep.SHGSHtInfilAdd, HeatingPeakMerged );
+			exchange.select( Rep.SHGSHtOtherAdd, HeatingPeakMerged );
+			exchange.select( Rep.SHGSHtEquipRem, HeatingPeakMerged );
+			exchange.select( Rep.SHGSHtWindRem, HeatingPeakMerged );
+			exchange.select( Rep.SHGSHtIzaRem, HeatingPeakMerged );
+			exchange.select( Rep.SHGSHtInfilRem, HeatingPeakMerged );
+			exchange.select( Rep.SHGSHtOtherRem, HeatingPeakMerged );
+		}
+
+		// Values gathered over the run periods for the tabular reports and the utility tariffs.  When
+		// merging, the sums are added and the larger (or smaller) peaks are kept with their time
+		// stamps and the values that were gathered at the time of the peak.
+		void
+		ExchangeTabularReportValues( SectionExchange & exchange )
+		{
+			using namespace OutputReportTabular;
+			exchange( IsMonthGathered );
+			for ( int TableNum = 1; TableNum <= MonthlyTablesCount; ++TableNum ) {
+				auto const & Table( MonthlyTables( TableNum ) );
+				Array1D_bool MinMaxMerged( 12, false ); // The peak of the last maximum or minimum column is merged
+				for ( int ColumnNum = Table.firstColumn; ColumnNum < Table.firstColumn + Table.numColumns; ++ColumnNum ) {
+					auto & Column( MonthlyColumns( ColumnNum ) );
+					for ( int Month = 1; Month <= 12; ++Month ) {
+						bool Merged( false );
+						if ( Column.aggType == aggTypeMaximum || Column.aggType == aggTypeMaximumDuringHoursShown ) {
+							Merged = exchange.maximum( Column.reslt( Month ) );
+							if ( Column.aggType == aggTypeMaximum ) MinMaxMerged( Month ) = Merged;
+						} else if ( Column.aggType == aggTypeMinimum || Column.aggType == aggTypeMinimumDuringHoursShown ) {
+							Merged = exchange.minimum( Column.reslt( Month ) );
+							if ( Column.aggType == aggTypeMinimum ) MinMaxMerged( Month ) = Merged;
+						} else if ( Column.aggType == aggTypeValueWhenMaxMin ) {
+							Merged = MinMaxMerged( Month );
+							exchange.select( Column.reslt( Month ), Merged );
+						} else {
+							exchange( Column.reslt( Month ) );
+							exchange( Column.duration( Month ) );
+							exchange.select( Column.timeStamp( Month ), false );
+							continue;
+						}
+						exchange.select( Column.duration( Month ), Merged );
+						exchange.select( Column.timeStamp( Month ), Merged );
+					}
+				}
+			}
+			for ( auto & Bin : BinResults ) {
+				exchange( Bin.mnth );
+				exchange( Bin.hrly );
+			}
+			for ( auto & Bin : BinResultsBelow ) {
+				exchange( Bin.mnth );
+				exchange( Bin.hrly );
+			}
+			for ( auto & Bin : BinResultsAbove ) {
+				exchange( Bin.mnth );
+				exchange( Bin.hrly );
+			}
+			for ( auto & Statistics : BinStatistics ) {
+				exchange( Statistics.sum );
+				exchange( Statistics.sum2 );
+				exchange( Statistics.n );
+				exchange.minimum( Statistics.minimum );
+				exchange.maximum( Statistics.maximum );
+			}
+			exchange( gatherElapsedTimeBEPS );
+			exchange( gatherTotalsBEPS );
+			exchange( gatherTotalsBySourceBEPS );
+			exchange( gatherTotalsSource );
+			exchange( gatherTotalsBySource );
+			exchange( gatherEndUseBEPS );
+			exchange( gatherEndUseBySourceBEPS );
+			exchange( gatherEndUseSubBEPS );
+			Array1D_bool DemandMerged( gatherDemandTotal.size(), false ); // The peak demand of the resource is merged
+			for ( int iResource = 1; iResource <= gatherDemandTotal.isize(); ++iResource ) {
+				DemandMerged( iResource ) = exchange.maximum( gatherDemandTotal( iResource ) );
+				exchange.select( gatherDemandTimeStamp( iResource ), DemandMerged( iResource ) );
+				for ( int jEndUse = 1; jEndUse <= gatherDemandEndUse.isize2(); ++jEndUse ) {
+					exchange.select( gatherDemandEndUse( iResource, jEndUse ), DemandMerged( iResource ) );
+				}
+			}
+			if ( gatherDemandEndUseSub.allocated() ) {
+				for ( int kEndUseSub = 1; kEndUseSub <= gatherDemandEndUseSub.isize1(); ++kEndUseSub ) {
+					for ( int jEndUse = 1; jEndUse <= gatherDemandEndUseSub.isize2(); ++jEndUse ) {
+						for ( int iResource = 1; iResource <= gatherDemandEndUseSub.isize3(); ++iResource ) {
+							exchange.select( gatherDemandEndUseSub( kEndUseSub, jEndUse, iResource ), DemandMerged( iResource ) );
+						}
+					}
+				}
+			}
+			exchange( gatherPowerFuelFireGen );
+			exchange( gatherPowerPV );
+			exchange( gatherPowerWind );
+			exchange( gatherPowerHTGeothermal );
+			exchange( gatherElecProduced );
+			exchange( gatherElecPurchased );
+			exchange( gatherElecSurplusSold );
+			exchange( gatherElecStorage );
+			exchange( gatherPowerConversion );
+			exchange( gatherWaterHeatRecovery );
+			exchange( gatherAirHeatRecoveryCool );
+			exchange( gatherAirHeatRecoveryHeat );
+			exchange( gatherHeatHTGeothermal );
+			exchange( gatherHeatSolarWater );
+			exchange( gatherHeatSolarAir );
+			exchange( gatherRainWater );
+			exchange( gatherCondensate );
+			exchange( gatherWellwater );
+			exchange( gatherMains );
+			exchange( gatherWaterEndUseTotal );
+
+			for ( auto & Rep : DataHeatBalance::ZonePreDefRep ) ExchangePreDefRep( exchange, Rep );
+			ExchangePreDefRep( exchange, DataHeatBalance::BuildingPreDefRep );
+			for ( int LightsNum = 1; LightsNum <= DataHeatBalance::TotLights; ++LightsNum ) {
+				exchange( DataHeatBalance::Lights( LightsNum ).SumTimeNotZeroCons );
+				exchange( DataHeatBalance::Lights( LightsNum ).SumConsumption );
+			}
+			for ( int LightsNum = 1; LightsNum <= ExteriorEnergyUse::NumExteriorLights; ++LightsNum ) {
+				exchange( ExteriorEnergyUse::ExteriorLights( LightsNum ).SumTimeNotZeroCons );
+				exchange( ExteriorEnergyUse::ExteriorLights( LightsNum ).SumConsumption );
+			}
+			for ( int PeopleNum = 1; PeopleNum <= DataHeatBalance::TotPeople; ++PeopleNum ) {
+				auto & People( DataHeatBalance::People( PeopleNum ) );
+				exchange( People.TimeNotMetASH5590 );
+				exchange( People.TimeNotMetASH5580 );
+				exchange( People.TimeNotMetCEN15251CatI );
+				exchange( People.TimeNotMetCEN15251CatII );
+				exchange( People.TimeNotMetCEN15251CatIII );
+			}
+
+			for ( auto & Comfort : ThermalComfort::ThermalComfortInASH55 ) {
+				exchange( Comfort.totalTimeNotSummer );
+				exchange( Comfort.totalTimeNotWinter );
+				exchange( Comfort.totalTimeNotEither );
+			}
+			for ( auto & SetPoint : ThermalComfort::ThermalComfortSetPoint ) {
+				exchange( SetPoint.totalNotMetHeating );
+				exchange( SetPoint.totalNotMetCooling );
+				exchange( SetPoint.totalNotMetHeatingOccupied );
+				exchange( SetPoint.totalNotMetCoolingOccupied );
+			}
+			exchange( ThermalComfort::TotalAnyZoneTimeNotSimpleASH55Summer );
+			exchange( ThermalComfort::TotalAnyZoneTimeNotSimpleASH55Winter );
+			exchange( ThermalComfort::TotalAnyZoneTimeNotSimpleASH55Either );
+			exchange( ThermalComfort::TotalAnyZoneNotMetHeating );
+			exchange( ThermalComfort::TotalAnyZoneNotMetCooling );
+			exchange( ThermalComfort::TotalAnyZoneNotMetHeatingOccupied );
+			exchange( ThermalComfort::TotalAnyZoneNotMetCoolingOccupied );
+			exchange( ThermalComfort::TotalAnyZoneNotMetOccupied );
+
+			for ( int TariffNum = 1; TariffNum <= EconomicTariff::numTariff; ++TariffNum ) {
+				auto & Tariff( EconomicTariff::tariff( TariffNum ) );
+				exchange( Tariff.gatherEnergy );
+				for ( auto & Demand : Tariff.gatherDemand ) exchange.maximum( Demand );
+				exchange.select( Tariff.collectTime, false );
+				exchange.select( Tariff.collectEnergy, false );
+				for ( auto & Season : Tariff.seasonForMonth ) exchange.select( Season, Season == 0 );
+				exchange( Tariff.RTPcost );
+				exchange( Tariff.RTPaboveBaseCost );
+				exchange( Tariff.RTPbelowBaseCost );
+				exchange( Tariff.RTPaboveBaseEnergy );
+				exchange( Tariff.RTPbelowBaseEnergy );
+			}
+		}
+
+		void
+		ExchangeTabularReports(
+			Array1D< Real64 > & State,
+			bool const Gather
+		)
+		{
+			SectionExchange exchange( State, Gather );
+			ExchangeTabularReportValues( exchange );
+		}
+
+		// Occupied hours of the zones in the environment
+		void
+		ExchangeZoneOccupiedHourValues( SectionExchange & exchange )
+		{
+			exchange( ThermalComfort::ZoneOccHrs );
+		}
+
+		void
+		ExchangeZoneOccupiedHours(
+			Array1D< Real64 > & State,
+			bool const Gather
+		)
+		{
+			SectionExchange exchange( State, Gather );
+			ExchangeZoneOccupiedHourValues( exchange );
+		}
+
+		// Values gathered for the annual tabular reports, merged as the monthly ones.  The values of
+		// the binned columns are kept for every time step until the bins are set, they are appended.
+		void
+		ExchangeAnnualTableValues( SectionExchange & exchange )
+		{
+			for ( auto & Table : OutputReportTabularAnnual::annualTables ) {
+				auto & FieldSets( Table.fieldSets() );
+				std::size_t const NumRows( FieldSets.empty() ? 0u : FieldSets.front().m_cell.size() );
+				for ( std::size_t Row = 0; Row < NumRows; ++Row ) {
+					bool MinMaxMerged( false ); // The peak of the last maximum or minimum column is merged
+					for ( auto & FieldSet : FieldSets ) {
+						auto & Cell( FieldSet.m_cell[ Row ] );
+						bool Merged( false );
+						switch ( FieldSet.m_aggregate ) {
+						case AnnualFieldSet::maximum:
+							Merged = MinMaxMerged = exchange.maximum( Cell.result );
+							break;
+						case AnnualFieldSet::minimum:
+							Merged = MinMaxMerged = exchange.minimum( Cell.result );
+							break;
+						case AnnualFieldSet::maximumDuringHoursShown: // the smaller value is kept, as it is gathered
+							Merged = exchange.minimum( Cell.result );
+							break;
+						case AnnualFieldSet::minimumDuringHoursShown: // the larger value is kept, as it is gathered
+							Merged = exchange.maximum( Cell.result );
+							break;
+						case AnnualFieldSet::valueWhenMaxMin:
+							Merged = MinMaxMerged;
+							exchange.select( Cell.result, Merged );
+							break;
+						default:
+							exchange( Cell.result );
+							exchange( Cell.duration );
+							exchange.select( Cell.timeStamp, false );
+							exchange( Cell.deferredResults );
+							exchange( Cell.deferredElapsed );
+							continue;
+						}
+						exchange.select( Cell.duration, Merged );
+						exchange.select( Cell.timeStamp, Merged );
+					}
+				}
+			}
+		}
+
+		// Meter values accumulated for the tabular reports over the final year of the run periods
+		void
+		ExchangeMeterTotalValues( SectionExchange & exchange )
+		{
+			for ( int Meter = 1; Meter <= OutputProcessor::NumEnergyMeters; ++Meter ) {
+				auto & meter( OutputProcessor::EnergyMeters( Meter ) );
+				exchange( meter.FinYrSMValue );
+				bool const MaxMerged = exchange.maximum( meter.FinYrSMMaxVal );
+				exchange.select( meter.FinYrSMMaxValDate, MaxMerged );
+				bool const MinMerged = exchange.minimum( meter.FinYrSMMinVal );
+				exchange.select( meter.FinYrSMMinValDate, MinMerged );
+			}
+		}
+
+		typedef std::function< void( SectionExchange & ) > ValuesFunction;
+
+		// Values gathered for the tabular reports that the segments of a split run period merge
+		std::vector< std::pair< std::string, ValuesFunction > >
+		SegmentReportSections()
+		{
+			std::vector< std::pair< std::string, ValuesFunction > > ReportSections;
+			ReportSections.emplace_back( "TabularReports", ExchangeTabularReportValues );
+			ReportSections.emplace_back( "AnnualTables", ExchangeAnnualTableValues );
+			ReportSections.emplace_back( "ZoneOccupiedHours", ExchangeZoneOccupiedHourValues );
+			ReportSections.emplace_back( "MeterTotals", ExchangeMeterTotalValues );
+			return ReportSections;
+		}
+
+		// Meter values accumulated for monthly and run period reporting
+		void
+		ExchangeMeters(
+			Array1D< Real64 > & State,
+			bool const Gather
+		)
+		{
+			using OutputProcessor::EnergyMeters;
+			SectionExchange exchange( State, Gather );
+			for ( int Meter = 1; Meter <= OutputProcessor::NumEnergyMeters; ++Meter ) {
+				auto & meter( EnergyMeters( Meter ) );
+				exchange( meter.MNValue );
+				exchange( meter.MNMaxVal );
+				exchange( meter.MNMaxValDate );
+				exchange( meter.MNMinVal );
+				exchange( meter.MNMinValDate );
+				exchange( meter.SMValue );
+				exchange( meter.SMMaxVal );
+				exchange( meter.SMMaxValDate );
+				exchange( meter.SMMinVal );
+				exchange( meter.SMMinValDate );
+				exchange( meter.FinYrSMValue );
+				exchange( meter.FinYrSMMaxVal );
+				exchange( meter.FinYrSMMaxValDate );
+				exchange( meter.FinYrSMMinVal );
+				exchange( meter.FinYrSMMinValDate );
+			}
+		}
+
+		// Output variable values accumulated for monthly and run period reporting
+		void
+		ExchangeOutputVariables(
+			Array1D< Real64 > & State,
+			bool const Gather
+		)
+		{
+			using namespace OutputProcessor;
+			SectionExchange exchange( State, Gather );
+			for ( int Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
+				auto & rVar( RVariableTypes( Loop ).VarPtr() );
+				if ( rVar.ReportFreq != ReportMonthly && rVar.ReportFreq != ReportSim ) continue;
+				exchange( rVar.StoreValue );
+				exchange( rVar.NumStored );
+				exchange( rVar.MaxValue );
+				exchange( rVar.maxValueDate );
+				exchange( rVar.MinValue );
+				exchange( rVar.minValueDate );
+			}
+			for ( int Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
+				auto & iVar( IVariableTypes( Loop ).VarPtr() );
+				if ( iVar.ReportFreq != ReportMonthly && iVar.ReportFreq != ReportSim ) continue;
+				exchange( iVar.StoreValue );
+				exchange( iVar.NumStored );
+				exchange( iVar.MaxValue );
+				exchange( iVar.maxValueDate );
+				exchange( iVar.MinValue );
+				exchange( iVar.minValueDate );
+			}
+		}
+
+		// Numeric values of the EMS global variables
+		void
+		ExchangeErlVariables(
+			Array1D< Real64 > & State,
+			bool const Gather
+		)
+		{
+			using namespace DataRuntimeLanguage;
+			SectionExchange exchange( State, Gather );
+			for ( int Loop = 1; Loop <= NumErlVariables; ++Loop ) {
+				auto & Value( ErlVariable( Loop ).Value );
+				if ( ErlVariable( Loop ).StackNum != 0 ) continue;
+				bool IsNumber( Value.Type == ValueNumber );
+				exchange( IsNumber );
+				exchange( Value.Number );
+				if ( ! Gather && IsNumber ) {
+					Value.Type = ValueNumber;
+					Value.initialized = true;
+				}
+			}
+		}
+
+		// Logged values of the EMS trend variables
+		void
+		ExchangeTrendVariables(
+			Array1D< Real64 > & State,
+			bool const Gather
+		)
+		{
+			using namespace DataRuntimeLanguage;
+			SectionExchange exchange( State, Gather );
+			for ( int TrendNum = 1; TrendNum <= NumErlTrendVariables; ++TrendNum ) {
+				exchange( TrendVariable( TrendNum ).TrendValARR );
+			}
+		}
+
+		// Reports the state of the model that a checkpoint does not hold, returns false if there is any
+		bool
+		CheckModelSaved( std::string const & CallerName )
+		{
+			bool Saved( true );
+			auto const reportNotSaved = [&]( std::string const & What ) {
+				if ( Saved ) ShowSevereError( CallerName + ": A checkpoint cannot hold the state of this model." );
+				ShowContinueError( What + " are not saved in a checkpoint." );
+				Saved = false;
+			};
+			if ( ! DataPlantPipingSystems::PipingSystemDomains.empty() ) reportNotSaved( "Ground heat transfer domains" );
+			if ( InputProcessor::GetNumObjectsFound( "Pipe:Indoor" ) + InputProcessor::GetNumObjectsFound( "Pipe:Outdoor" ) + InputProcessor::GetNumObjectsFound( "Pipe:Underground" ) > 0 ) reportNotSaved( "Pipe heat transfer models" );
+			if ( InputProcessor::GetNumObjectsFound( "GroundHeatExchanger:Surface" ) + InputProcessor::GetNumObjectsFound( "GroundHeatExchanger:Pond" ) > 0 ) reportNotSaved( "Surface and pond ground heat exchangers" );
+			if ( InputProcessor::GetNumObjectsFound( "ThermalStorage:Ice:Simple" ) + InputProcessor::GetNumObjectsFound( "ThermalStorage:Ice:Detailed" ) > 0 ) reportNotSaved( "Ice storage tanks" );
+			if ( InputProcessor::GetNumObjectsFound( "SolarCollector:IntegralCollectorStorage" ) > 0 ) reportNotSaved( "Integral collector storage solar collectors" );
+			if ( OutputReportTabular::WriteTabularFiles && InputProcessor::GetNumObjectsFound( "Output:Table:Annual" ) > 0 ) reportNotSaved( "Annual tabular report accumulations" );
+			return Saved;
+		}
+
+		// Size of an output file after writing everything buffered
+		Real64
+		OutputFileSize( std::ostream * Stream )
+		{
+			if ( ! Stream ) return -1.0;
+			Stream->flush();
+			return Real64( Stream->tellp() );
+		}
+
+		// Copies the output written up to the checkpoint followed by the records the resumed run wrote
+		// after the stamp of the resumed environment.  Returns false if a file could not be read.
+		bool
+		MergeOutput(
+			std::string const & EarlierFileName, // Output written up to the checkpoint
+			Real64 const EarlierSize, // Size of that output at the checkpoint
+			std::string const & ResumedFileName, // Output of the resumed run
+			Real64 const ResumedSize, // Size of the resumed output to copy, negative to copy all of it
+			std::string const & MergedFileName
+		)
+		{
+			std::ifstream Earlier( EarlierFileName, std::ios::binary );
+			std::ifstream Resumed( ResumedFileName, std::ios::binary );
+			if ( ! Earlier || ! Resumed ) {
+				ShowWarningError( "MergeOutput: Could not read " + EarlierFileName + " or " + ResumedFileName + ", the output written before the checkpoint is not included." );
+				return false;
+			}
+			std::ofstream Merged( MergedFileName, std::ios::binary );
+
+			std::string Line;
+			auto const readLine = [&Line]( std::ifstream & File ) -> bool {
+				if ( ! std::getline( File, Line ) ) return false;
+				if ( ! Line.empty() && Line.back() == '\r' ) Line.pop_back();
+				return true;
+			};
+			auto const recordId = [&Line]() {
+				return std::atoi( Line.substr( 0, Line.find( ',' ) ).c_str() );
+			};
+			int const LastStampId( 5 ); // Environment and time stamps, which are not counted as records
+
+			// Output up to the end of the last day saved, counting the records after the data dictionary
+			int NumRecords( 0 );
+			bool InData( false );
+			while ( Earlier.tellg() < std::streampos( std::streamoff( EarlierSize ) ) && readLine( Earlier ) ) {
+				Merged << Line << '\n';
+				if ( InData ) {
+					if ( recordId() > LastStampId ) ++NumRecords;
+				} else if ( Line == "End of Data Dictionary" ) {
+					InData = true;
+				}
+			}
+
+			// Records of the resumed environment after its environment stamp
+			int EnvironmentStampId( 0 );
+			while ( readLine( Resumed ) && Line != "End of Data Dictionary" ) {
+				if ( Line.find( "Environment Title" ) != std::string::npos ) EnvironmentStampId = recordId();
+			}
+			while ( readLine( Resumed ) && recordId() != EnvironmentStampId ) {}
+			while ( ( ResumedSize < 0.0 || Resumed.tellg() < std::streampos( std::streamoff( ResumedSize ) ) ) && readLine( Resumed ) && Line != "End of Data" ) {
+				Merged << Line << '\n';
+				if ( recordId() > LastStampId ) ++NumRecords;
+			}
+			if ( ResumedSize >= 0.0 ) return true;
+
+			Merged << "End of Data\n";
+			while ( readLine( Resumed ) ) {
+				std::string::size_type const Count = Line.find( "Number of Records Written=" );
+				if ( Count != std::string::npos ) {
+					std::ostringstream Records;
+					Records << std::setw( 12 ) << NumRecords;
+					Line = Line.substr( 0, Count ) + "Number of Records Written=" + Records.str();
+				}
+				Merged << Line << '\n';
+			}
+			return true;
+		}
+
+		// Moves an output file of the interrupted run aside, returns the size of the output kept
+		Real64
+		KeepOutput(
+			std::string const & FileName, // Output file
+			Real64 const KeptSize, // Size of the output kept by the run that wrote the checkpoint (0 if none)
+			Real64 const Size // Size of the output file at the checkpoint
+		)
+		{
+			std::string const KeptFileName( FileName + ".restart" );
+			if ( KeptSize > 0.0 ) {
+				// The checkpoint was written by a resumed run, whose output is added to the output it kept
+				std::string const MergedFileName( KeptFileName + ".merge" );
+				if ( ! MergeOutput( KeptFileName, KeptSize, FileName, Size, MergedFileName ) ) return 0.0;
+				std::remove( KeptFileName.c_str() );
+				if ( std::rename( MergedFileName.c_str(), KeptFileName.c_str() ) != 0 ) return 0.0;
+				std::ifstream KeptFile( KeptFileName, std::ios::binary | std::ios::ate );
+				return Real64( KeptFile.tellg() );
+			}
+			std::remove( KeptFileName.c_str() );
+			if ( Size <= 0.0 || std::rename( FileName.c_str(), KeptFileName.c_str() ) != 0 ) return 0.0;
+			return Size;
+		}
+
+		// Completes an output file of the resumed run with the output kept from before the checkpoint
+		void
+		MergeKeptOutput(
+			std::string const & FileName, // Output file
+			Real64 const KeptSize // Size of the output kept (0 if none)
+		)
+		{
+			if ( KeptSize <= 0.0 ) return;
+			std::string const KeptFileName( FileName + ".restart" );
+			std::string const MergedFileName( FileName + ".merge" );
+			if ( ! MergeOutput( KeptFileName, KeptSize, FileName, -1.0, MergedFileName ) ) return;
+			std::remove( FileName.c_str() );
+			if ( std::rename( MergedFileName.c_str(), FileName.c_str() ) != 0 ) {
+				ShowWarningError( "MergeKeptOutput: Could not rename " + MergedFileName + " to " + FileName + '.' );
+				return;
+			}
+			std::remove( KeptFileName.c_str() );
+		}
+
+		// Writes a section of the checkpoint or segment reports file
+		void
+		WriteSection(
+			std::ostream & File,
+			std::string const & Name, // Section name
+			ExchangeFunction const & Exchange // Copies the section from the state of the model
+		)
+		{
+			Array1D< Real64 > State;
+			Exchange( State, true );
+			File << "Section," << Name << ',' << State.size() << '\n';
+			for ( auto const Value : State ) File << Value << '\n';
+		}
+
+		// Reads the sections that follow the first line of a checkpoint or segment reports file.
+		// Returns false if a section is incomplete, with its name in Name.
+		bool
+		ReadSections(
+			std::istream & File,
+			std::map< std::string, SavedSection > & Saved, // Sections read
+			std::string & Name
+		)
+		{
+			std::string Line;
+			while ( std::getline( File, Line ) ) {
+				if ( Line.compare( 0, 8, "Section," ) != 0 ) continue;
+				std::string::size_type const Comma = Line.rfind( ',' );
+				if ( Comma <= 7 ) continue;
+				Name = Line.substr( 8, Comma - 8 );
+				int const NumValues = std::atoi( Line.substr( Comma + 1 ).c_str() );
+				Array1D< Real64 > State( NumValues );
+				for ( int Pos = 1; Pos <= NumValues; ++Pos ) {
+					if ( ! ( File >> State( Pos ) ) ) return false;
+				}
+				Saved[ Name ].State = State;
+			}
+			return true;
+		}
+
+		void
+		RestoreSection(
+			std::string const & Name, // Section name
+			ExchangeFunction const & Exchange // Copies the section from or to the state of the model
+		)
+		{
+			auto const Saved = Sections.find( Name );
+			if ( Saved == Sections.end() ) {
+				ShowFatalError( "RestoreSection: Checkpoint file " + CheckpointFileName + " does not hold the \"" + Name + "\" state of this model." );
+			}
+			Array1D< Real64 > State;
+			Exchange( State, true );
+			if ( State.size() != Saved->second.State.size() ) {
+				ShowFatalError( "RestoreSection: The \"" + Name + "\" state in checkpoint file " + CheckpointFileName + " does not match this model." );
+			}
+			State = Saved->second.State;
+			Exchange( State, false );
+			Saved->second.Restored = true;
+		}
+	}
+
+	// Functions
+
+	void
+	clear_state()
+	{
+		RestartPending = false;
+		RestartEnvrnNum = 0;
+		RestartEnvironmentName.clear();
+		RestartDayOfSim = 0;
+		RestartOverallSimDay = 0;
+		RestartWarmupDays = 0;
+		Sections.clear();
+		ModelChecked = false;
+		ModelSaved = true;
+		KeptEsoSize = 0.0;
+		KeptMtrSize = 0.0;
+	}
+
+	void
+	ExchangeZoneAirState(
+		Array1D< Real64 > & State, // Packed zone air state
+		bool const Gather // True to copy from the zone air arrays into State, false for the reverse
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Copies the zone air conditions that are set along with the surface histories at the start
+		// of an environment between the zone air arrays and a flat array.
+
+		using namespace DataHeatBalFanSys;
+		SectionExchange exchange( State, Gather );
+		exchange( DataHeatBalance::MRT );
+		exchange( MAT );
+		exchange( ZT );
+		exchange( ZTAV );
+		exchange( XMAT );
+		exchange( XM2T );
+		exchange( XM3T );
+		exchange( XM4T );
+		exchange( XMPT );
+		exchange( DSXMAT );
+		exchange( DSXM2T );
+		exchange( DSXM3T );
+		exchange( DSXM4T );
+		exchange( ZoneTMX );
+		exchange( ZoneTM2 );
+		exchange( ZoneAirHumRatAvg );
+		exchange( ZoneAirHumRat );
+		exchange( ZoneAirHumRatOld );
+
+	}
+
+	void
+	ExchangeZoneAirHistoryState(
+		Array1D< Real64 > & State, // Packed zone air history state
+		bool const Gather // True to copy from the zone air history arrays into State, false for the reverse
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Copies the zone air temperature and humidity ratio histories of the predictor-corrector,
+		// which are reset with the zone set points, between the history arrays and a flat array.
+
+		using namespace DataHeatBalFanSys;
+		SectionExchange exchange( State, Gather );
+		exchange( ZTM1 );
+		exchange( ZTM2 );
+		exchange( ZTM3 );
+		exchange( WZoneTimeMinus1 );
+		exchange( WZoneTimeMinus2 );
+		exchange( WZoneTimeMinus3 );
+		exchange( WZoneTimeMinus4 );
+		exchange( WZoneTimeMinusP );
+		exchange( DSWZoneTimeMinus1 );
+		exchange( DSWZoneTimeMinus2 );
+		exchange( DSWZoneTimeMinus3 );
+		exchange( DSWZoneTimeMinus4 );
+		exchange( ZoneT1 );
+		exchange( ZoneW1 );
+		exchange( ZoneWMX );
+		exchange( ZoneWM2 );
+
+	}
+
+	void
+	WriteCheckpoint()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Saves the state at the end of the current day of the environment to the checkpoint file.
+		// No checkpoint is written for a model with state that a checkpoint does not hold.
+
+		if ( ! ModelChecked ) {
+			ModelChecked = true;
+			ModelSaved = CheckModelSaved( "WriteCheckpoint" );
+			if ( ! ModelSaved ) ShowContinueError( "No checkpoints are written to " + CheckpointFileName + " for this simulation." );
+		}
+		if ( ! ModelSaved ) return;
+
+		std::string const TempFileName( CheckpointFileName + ".tmp" );
+		{
+			std::ofstream CheckpointFile( TempFileName );
+			if ( ! CheckpointFile ) {
+				ShowWarningError( "WriteCheckpoint: Could not open file " + TempFileName + " for output (write)." );
+				return;
+			}
+			CheckpointFile << std::setprecision( 17 );
+			CheckpointFile << "Checkpoint," << CurEnvirNum << ',' << DayOfSim << ',' << CurrentOverallSimDay << ',' << DataReportingFlags::NumOfWarmupDays << ',' << EnvironmentName << '\n';
+
+			auto writeSection = [&]( std::string const & Name, ExchangeFunction const & Exchange ) {
+				WriteSection( CheckpointFile, Name, Exchange );
+			};
+			writeSection( "SurfaceHistories", ExchangeSurfaceHistories );
+			writeSection( "ZoneAir", ExchangeZoneAirState );
+			writeSection( "ZoneAirHistories", ExchangeZoneAirHistoryState );
+			for ( int TankNum = 1; TankNum <= WaterThermalTanks::NumWaterThermalTank; ++TankNum ) {
+				writeSection( "WaterThermalTank:" + WaterThermalTanks::WaterThermalTank( TankNum ).Name, std::bind( ExchangeWaterThermalTank, TankNum, std::placeholders::_1, std::placeholders::_2 ) );
+			}
+			writeSection( "Meters", ExchangeMeters );
+			writeSection( "OutputVariables", ExchangeOutputVariables );
+			writeSection( "ErlVariables", ExchangeErlVariables );
+			if ( DataRuntimeLanguage::NumErlTrendVariables > 0 ) writeSection( "TrendVariables", ExchangeTrendVariables );
+			if ( DataPlant::TotNumLoops > 0 ) writeSection( "PlantLoops", ExchangePlantLoops );
+			if ( ! GroundHeatExchangers::verticalGLHE.empty() || ! GroundHeatExchangers::slinkyGLHE.empty() ) writeSection( "GroundHeatExchangers", ExchangeGroundHeatExchangers );
+			for ( auto & GLHE : GroundHeatExchangers::verticalGLHE ) {
+				writeSection( GroundHeatExchangerSectionName( "GroundHeatExchanger:Vertical", GLHE ), std::bind( ExchangeGroundHeatExchanger, std::ref( GLHE ), std::placeholders::_1, std::placeholders::_2 ) );
+			}
+			for ( auto & GLHE : GroundHeatExchangers::slinkyGLHE ) {
+				writeSection( GroundHeatExchangerSectionName( "GroundHeatExchanger:Slinky", GLHE ), std::bind( ExchangeGroundHeatExchanger, std::ref( GLHE ), std::placeholders::_1, std::placeholders::_2 ) );
+			}
+			writeSection( "TabularReports", ExchangeTabularReports );
+			if ( ! ThermalComfort::ZoneOccHrs.empty() ) writeSection( "ZoneOccupiedHours", ExchangeZoneOccupiedHours );
+			if ( sqlite && sqlite->writeOutputToSQLite() ) {
+				Array1D_int Indices( 5 );
+				sqlite->getReportDataIndices( Indices( 1 ), Indices( 2 ), Indices( 3 ), Indices( 4 ), Indices( 5 ) );
+				CheckpointFile << "Section,SQLiteOutput,5\n";
+				for ( auto const Index : Indices ) CheckpointFile << Index << '\n';
+			}
+			CheckpointFile << "Section,OutputFileSizes,4\n" << KeptEsoSize << '\n' << KeptMtrSize << '\n';
+			CheckpointFile << OutputFileSize( DataGlobals::eso_stream ) << '\n' << OutputFileSize( DataGlobals::mtr_stream ) << '\n';
+
+			if ( ! CheckpointFile ) {
+				ShowWarningError( "WriteCheckpoint: Could not write file " + TempFileName + ", the previous checkpoint is kept." );
+				return;
+			}
+		}
+
+		std::remove( CheckpointFileName.c_str() );
+		if ( std::rename( TempFileName.c_str(), CheckpointFileName.c_str() ) != 0 ) {
+			ShowWarningError( "WriteCheckpoint: Could not rename " + TempFileName + " to " + CheckpointFileName + '.' );
+		}
+
+	}
+
+	void
+	ReadCheckpoint()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reads the checkpoint file to resume a simulation from.  The sections are kept until
+		// the modules restore them.
+
+		if ( CheckpointFileName.empty() ) {
+			ShowFatalError( "ReadCheckpoint: Restarting a simulation requires the " + DataSystemVariables::CheckpointEnvVar + " environment variable to name the checkpoint file." );
+		}
+
+		Sections.clear();
+		std::ifstream CheckpointFile( CheckpointFileName );
+		if ( ! CheckpointFile ) {
+			ShowFatalError( "ReadCheckpoint: Could not open checkpoint file " + CheckpointFileName + '.' );
+		}
+
+		std::string Line;
+		std::getline( CheckpointFile, Line );
+		std::vector< std::string > Fields;
+		std::string::size_type Start = 0;
+		for ( int Field = 1; Field <= 5; ++Field ) {
+			std::string::size_type const Comma = Line.find( ',', Start );
+			if ( Comma == std::string::npos ) break;
+			Fields.push_back( Line.substr( Start, Comma - Start ) );
+			Start = Comma + 1;
+		}
+		Fields.push_back( Line.substr( Start ) ); // the environment name may hold commas
+		if ( Fields.size() != 6 || Fields[ 0 ] != "Checkpoint" ) {
+			ShowFatalError( "ReadCheckpoint: " + CheckpointFileName + " is not a checkpoint file." );
+		}
+		RestartEnvrnNum = std::atoi( Fields[ 1 ].c_str() );
+		RestartDayOfSim = std::atoi( Fields[ 2 ].c_str() );
+		RestartOverallSimDay = std::atoi( Fields[ 3 ].c_str() );
+		RestartWarmupDays = std::atoi( Fields[ 4 ].c_str() );
+		RestartEnvironmentName = Fields[ 5 ];
+
+		std::string Name;
+		if ( ! ReadSections( CheckpointFile, Sections, Name ) ) {
+			ShowFatalError( "ReadCheckpoint: Incomplete \"" + Name + "\" state in checkpoint file " + CheckpointFileName + '.' );
+		}
+
+		Sections.erase( "OutputFileSizes" ); // used by KeepOutputBeforeRestart
+		if ( ! sqlite || ! sqlite->writeOutputToSQLite() ) Sections.erase( "SQLiteOutput" );
+
+		RestartPending = true;
+
+	}
+
+	void
+	RestoreHeatBalanceState()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Restores the surface histories and zone air conditions after the begin environment
+		// initializations of the surface heat balance.
+
+		if ( ! RestartPending ) return;
+		RestoreSection( "SurfaceHistories", ExchangeSurfaceHistories );
+		RestoreSection( "ZoneAir", ExchangeZoneAirState );
+
+	}
+
+	void
+	RestoreZoneAirHistories()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Restores the zone air temperature and humidity ratio histories after the begin environment
+		// initializations of the zone set points.
+
+		if ( ! RestartPending ) return;
+		RestoreSection( "ZoneAirHistories", ExchangeZoneAirHistoryState );
+
+	}
+
+	void
+	RestoreWaterThermalTank( int const TankNum ) // Water thermal tank index
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Restores the temperatures of a water thermal tank once its begin environment and end of
+		// warmup initializations are done.  The tank repeats these initializations on every call
+		// during the first time step, so it is restored on each of them.
+
+		if ( ! RestartPending ) return;
+		std::string const Name( "WaterThermalTank:" + WaterThermalTanks::WaterThermalTank( TankNum ).Name );
+		if ( Sections.find( Name ) == Sections.end() ) return;
+		RestoreSection( Name, std::bind( ExchangeWaterThermalTank, TankNum, std::placeholders::_1, std::placeholders::_2 ) );
+
+	}
+
+	void
+	RestorePlantLoops()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Restores the fluid temperatures of the plant and condenser loops after their begin
+		// environment initializations.
+
+		if ( ! RestartPending ) return;
+		if ( Sections.find( "PlantLoops" ) == Sections.end() ) return;
+		RestoreSection( "PlantLoops", ExchangePlantLoops );
+
+	}
+
+	void
+	RestoreGroundHeatExchanger(
+		std::string const & ObjectType, // Object type of the ground heat exchanger
+		GroundHeatExchangers::GLHEBase & GLHE // Ground heat exchanger
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Restores the load history of a vertical or slinky ground heat exchanger after its begin
+		// environment initializations, with the simulation time the ground heat exchangers share.
+
+		if ( ! RestartPending ) return;
+		auto const Shared = Sections.find( "GroundHeatExchangers" );
+		if ( Shared != Sections.end() && ! Shared->second.Restored ) RestoreSection( "GroundHeatExchangers", ExchangeGroundHeatExchangers );
+		std::string const Name( GroundHeatExchangerSectionName( ObjectType, GLHE ) );
+		if ( Sections.find( Name ) == Sections.end() ) return;
+		RestoreSection( Name, std::bind( ExchangeGroundHeatExchanger, std::ref( GLHE ), std::placeholders::_1, std::placeholders::_2 ) );
+
+	}
+
+	void
+	RestoreZoneOccupiedHours()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Restores the occupied hours of the zones, which thermal comfort resets at the start of
+		// the environment.
+
+		if ( ! RestartPending ) return;
+		if ( Sections.find( "ZoneOccupiedHours" ) == Sections.end() ) return;
+		RestoreSection( "ZoneOccupiedHours", ExchangeZoneOccupiedHours );
+
+	}
+
+	void
+	RestoreTrendVariables()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Restores the logged values of the EMS trend variables after they have been purged by the
+		// begin environment reset of the runtime language.
+
+		if ( ! RestartPending ) return;
+		RestoreSection( "TrendVariables", ExchangeTrendVariables );
+
+	}
+
+	void
+	RestoreReportingState()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Restores the meter and output variable accumulations, the tabular report gathers and the
+		// EMS global variables once the accumulations have been reset at the end of warmup.
+
+		if ( ! RestartPending ) return;
+		RestoreSection( "Meters", ExchangeMeters );
+		RestoreSection( "OutputVariables", ExchangeOutputVariables );
+		RestoreSection( "TabularReports", ExchangeTabularReports );
+		RestoreSection( "ErlVariables", ExchangeErlVariables );
+
+	}
+
+	void
+	RestoreSQLiteOutput()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Copies the SQLite report records written up to the checkpoint from the database kept by
+		// KeepOutputBeforeRestart into the database of the resumed run.
+
+		if ( ! RestartPending || ! sqlite || ! sqlite->writeOutputToSQLite() ) return;
+		std::string const KeptFileName( DataStringGlobals::outputSqlFileName + ".restart" );
+		auto const Saved = Sections.find( "SQLiteOutput" );
+		if ( Saved == Sections.end() || Saved->second.State.size() != 5u || ! std::ifstream( KeptFileName ) ) {
+			ShowWarningError( "RestoreSQLiteOutput: The SQLite output written before the checkpoint is not available, it is not included in " + DataStringGlobals::outputSqlFileName + '.' );
+			if ( Saved != Sections.end() ) Saved->second.Restored = true;
+			return;
+		}
+		auto const & Indices( Saved->second.State );
+		if ( ! sqlite->restoreReportData( KeptFileName, RestartEnvrnNum, nint( Indices( 1 ) ), nint( Indices( 2 ) ), nint( Indices( 3 ) ), nint( Indices( 4 ) ), nint( Indices( 5 ) ) ) ) {
+			ShowWarningError( "RestoreSQLiteOutput: Could not copy the SQLite output written before the checkpoint from " + KeptFileName + '.' );
+		} else {
+			std::remove( KeptFileName.c_str() );
+		}
+		Saved->second.Restored = true;
+
+	}
+
+	void
+	FinishRestart()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Ends the restart after the first time step of the resumed environment, when the input of
+		// all models has been read.  Sections that were not restored belong to models that were not
+		// initialized in that time step.
+
+		if ( ! CheckModelSaved( "FinishRestart" ) ) {
+			ShowFatalError( "FinishRestart: The simulation cannot be resumed from checkpoint file " + CheckpointFileName + '.' );
+		}
+		for ( auto const & Saved : Sections ) {
+			if ( ! Saved.second.Restored ) ShowWarningError( "FinishRestart: The \"" + Saved.first + "\" state in checkpoint file " + CheckpointFileName + " was not restored." );
+		}
+		Sections.clear();
+		RestartPending = false;
+
+	}
+
+	void
+	KeepOutputBeforeRestart()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Moves the standard, meter and SQLite output written up to the checkpoint aside before the
+		// output files of the resumed run are opened, so that MergeOutputAfterRestart and
+		// RestoreSQLiteOutput can add to it.
+
+		// METHODOLOGY EMPLOYED:
+		// The output files are opened before the checkpoint is read, so only the sections with the
+		// output file sizes and the SQLite report indices are read here.  If the checkpoint was
+		// written by a resumed run, the output that run kept is completed with its own output first.
+		// A kept SQLite database is only left by a resumed run that stopped before copying it, and
+		// then holds more than the database of that run.
+
+		std::ifstream CheckpointFile( CheckpointFileName );
+		std::string Line;
+		while ( std::getline( CheckpointFile, Line ) ) {
+			if ( Line == "Section,SQLiteOutput,5" ) {
+				std::string const KeptFileName( DataStringGlobals::outputSqlFileName + ".restart" );
+				if ( ! std::ifstream( KeptFileName ) ) std::rename( DataStringGlobals::outputSqlFileName.c_str(), KeptFileName.c_str() );
+				continue;
+			}
+			if ( Line != "Section,OutputFileSizes,4" ) continue;
+			Array1D< Real64 > Sizes( 4 );
+			for ( auto & Size : Sizes ) {
+				if ( ! ( CheckpointFile >> Size ) ) return;
+			}
+			KeptEsoSize = KeepOutput( DataStringGlobals::outputEsoFileName, Sizes( 1 ), Sizes( 3 ) );
+			KeptMtrSize = KeepOutput( DataStringGlobals::outputMtrFileName, Sizes( 2 ), Sizes( 4 ) );
+		}
+
+	}
+
+	void
+	MergeOutputAfterRestart()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Completes the standard and meter output files of a resumed run with the output kept from
+		// before the checkpoint, once the output files have been closed.
+
+		// METHODOLOGY EMPLOYED:
+		// The kept output is copied up to its size at the checkpoint, which ends with the last day
+		// saved.  The records the resumed run wrote after the stamp of the resumed environment
+		// follow, and the record count at the end is updated.
+
+		MergeKeptOutput( DataStringGlobals::outputEsoFileName, KeptEsoSize );
+		MergeKeptOutput( DataStringGlobals::outputMtrFileName, KeptMtrSize );
+
+	}
+
+	void
+	WriteSegmentReports()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Saves the values a later segment of a split run period gathered for the tabular reports,
+		// so that the first segment can merge them into the reports of the whole run period.
+
+		// METHODOLOGY EMPLOYED:
+		// The segment reports file starts with a line "SegmentReports,<segment>" followed by
+		// sections in the format of the checkpoint file.
+
+		std::ofstream SegmentReportsFile( DataStringGlobals::outputSegReportsFileName );
+		if ( ! SegmentReportsFile ) {
+			ShowFatalError( "WriteSegmentReports: Could not open file " + DataStringGlobals::outputSegReportsFileName + " for output (write)." );
+		}
+		SegmentReportsFile << std::setprecision( 17 );
+		SegmentReportsFile << "SegmentReports," << DataSystemVariables::SegmentNum << '\n';
+		for ( auto const & Section : SegmentReportSections() ) {
+			WriteSection( SegmentReportsFile, Section.first, [&]( Array1D< Real64 > & State, bool const Gather ) {
+				SectionExchange exchange( State, Gather );
+				Section.second( exchange );
+			} );
+		}
+		if ( ! SegmentReportsFile ) {
+			ShowFatalError( "WriteSegmentReports: Could not write file " + DataStringGlobals::outputSegReportsFileName + '.' );
+		}
+
+	}
+
+	bool
+	MergeSegmentReports( std::string const & FileName ) // Segment reports file of a later segment
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Merges the values a later segment of a split run period gathered for the tabular reports
+		// into the values of the first segment.  Returns false if the file could not be read or
+		// does not match this model.
+
+		// METHODOLOGY EMPLOYED:
+		// Sums are added.  Peaks are kept with their time stamps and with the values gathered at
+		// the time of the peak, from the earlier segment if they are equal.  The values of the
+		// binned annual report columns are appended.
+
+		std::ifstream SegmentReportsFile( FileName );
+		std::string Line;
+		if ( ! SegmentReportsFile || ! std::getline( SegmentReportsFile, Line ) || Line.compare( 0, 15, "SegmentReports," ) != 0 ) {
+			ShowSevereError( "MergeSegmentReports: " + FileName + " is not a segment reports file." );
+			return false;
+		}
+		std::map< std::string, SavedSection > Saved;
+		std::string Name;
+		if ( ! ReadSections( SegmentReportsFile, Saved, Name ) ) {
+			ShowSevereError( "MergeSegmentReports: Incomplete \"" + Name + "\" values in " + FileName + '.' );
+			return false;
+		}
+		for ( auto const & Section : SegmentReportSections() ) {
+			auto Found = Saved.find( Section.first );
+			bool Matched = ( Found != Saved.end() );
+			if ( Matched ) {
+				SectionExchange exchange( Found->second.State, SectionExchange::MergeState );
+				Section.second( exchange );
+				Matched = exchange.matched();
+			}
+			if ( ! Matched ) {
+				ShowSevereError( "MergeSegmentReports: The \"" + Section.first + "\" values in " + FileName + " do not match this model." );
+				return false;
+			}
+		}
+		return true;
+
+	}
+
+} // Checkpoint
+
+} // EnergyPlus
@@ -154,6 +154,19 @@ namespace CoolingPanelSimple {
 	Array1D< CoolingPanelParams > CoolingPanel;
 	Array1D< CoolingPanelSysNumericFieldData > CoolingPanelSysNumericFields;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false ); // If errors detected in input
+		bool ZoneEquipmentListChecked( false );
+		Array1D_bool MyEnvrnFlag;
+		int Iter( 0 );
+		bool UpdateCoolingPanelMyEnvrnFlag( true );
+	}
+
 	// Functions
 
 	void
@@ -172,6 +185,11 @@ namespace CoolingPanelSimple {
 		CoolingPanel.deallocate();
 		CoolingPanelSysNumericFields.deallocate();
 		MySizeFlagCoolPanel.deallocate();
+		ErrorsFound = false;
+		ZoneEquipmentListChecked = false;
+		MyEnvrnFlag.deallocate();
+		Iter = 0;
+		UpdateCoolingPanelMyEnvrnFlag = true;
 	}
 	
 	void
@@ -336,7 +354,6 @@ namespace CoolingPanelSimple {
 		int NumNumbers; // Number of Numbers for each GetobjectItem call
 		int SurfNum; // Surface number Do loop counter
 		int IOStat;
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 
@@ -697,8 +714,6 @@ namespace CoolingPanelSimple {
 		static std::string const RoutineName( "ChilledCeilingPanelSimple:InitCoolingPanel" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ZoneEquipmentListChecked( false );
-		static Array1D_bool MyEnvrnFlag;
 		int Loop;
 		int WaterInletNode;
 		int ZoneNode;
@@ -1407,15 +1422,13 @@ namespace CoolingPanelSimple {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int WaterInletNode;
 		int WaterOutletNode;
-		static int Iter( 0 );
-		static bool MyEnvrnFlag( true );
 
-		if ( BeginEnvrnFlag && MyEnvrnFlag ) {
+		if ( BeginEnvrnFlag && UpdateCoolingPanelMyEnvrnFlag ) {
 			Iter = 0;
-			MyEnvrnFlag = false;
+			UpdateCoolingPanelMyEnvrnFlag = false;
 		}
 		if ( ! BeginEnvrnFlag ) {
-			MyEnvrnFlag = true;
+			UpdateCoolingPanelMyEnvrnFlag = true;
 		}
 
 		// First, update the running average if necessary...
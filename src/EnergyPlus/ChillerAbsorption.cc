@@ -170,8 +170,62 @@ namespace ChillerAbsorption {
 	// Beginning of Absorption Chiller Module Driver Subroutines
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInput( true ); // when TRUE, calls subroutine to read input file.
+		bool ErrorsFound( false );
+		bool MyOneTimeFlag( true );
+		Array1D_bool MyFlag;
+		Array1D_bool MyEnvrnFlag;
+		int DummyWaterIndex( 1 );
+		int DummWaterIndex( 1 );
+		Array1D_bool MyEnvironFlag;
+		Array1D_bool MyEnvironSteamFlag;
+		int CalcBLASTAbsorberModelDummyWaterIndex( 1 );
+	}
+
 	// Functions
 
+	// Clears the global data in ChillerAbsorption.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumBLASTAbsorbers = 0;
+		CondMassFlowRate = 0.0;
+		EvapMassFlowRate = 0.0;
+		SteamMassFlowRate = 0.0;
+		CondOutletTemp = 0.0;
+		EvapOutletTemp = 0.0;
+		GenOutletTemp = 0.0;
+		SteamOutletEnthalpy = 0.0;
+		PumpingPower = 0.0;
+		PumpingEnergy = 0.0;
+		QGenerator = 0.0;
+		GeneratorEnergy = 0.0;
+		QEvaporator = 0.0;
+		EvaporatorEnergy = 0.0;
+		QCondenser = 0.0;
+		CondenserEnergy = 0.0;
+		CheckEquipName.deallocate();
+		BLASTAbsorber.deallocate();
+		BLASTAbsorberReport.deallocate();
+		GetInput = true;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		MyFlag.deallocate();
+		MyEnvrnFlag.deallocate();
+		DummyWaterIndex = 1;
+		DummWaterIndex = 1;
+		MyEnvironFlag.deallocate();
+		MyEnvironSteamFlag.deallocate();
+		CalcBLASTAbsorberModelDummyWaterIndex = 1;
+	}
+
 	void
 	SimBLASTAbsorber(
 		std::string const & EP_UNUSED( AbsorberType ), // type of Absorber
@@ -225,7 +279,6 @@ namespace ChillerAbsorption {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInput( true ); // when TRUE, calls subroutine to read input file.
 		int ChillNum; // Chiller number pointer
 
 		//Get Absorber data from input file
@@ -348,7 +401,6 @@ namespace ChillerAbsorption {
 		int NumNums; // Number of elements in the numeric array
 		int IOStat; // IO Status when calling get input subroutine
 		Array1D_bool GenInputOutputNodesUsed; // Used for SetupOutputVariable
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool errFlag;
@@ -611,9 +663,6 @@ namespace ChillerAbsorption {
 		static std::string const RoutineName( "InitBLASTAbsorberModel" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyFlag;
-		static Array1D_bool MyEnvrnFlag;
 		int CondInletNode; // node number of water inlet node to the condenser
 		int CondOutletNode; // node number of water outlet node from the condenser
 		bool errFlag;
@@ -627,7 +676,6 @@ namespace ChillerAbsorption {
 		Real64 SteamDeltaT; // amount of sub-cooling of steam condensate
 		int GeneratorInletNode; // generator inlet node number, steam/water side
 		Real64 SteamOutletTemp;
-		static int DummyWaterIndex( 1 );
 		Real64 mdotEvap; // local fluid mass flow rate thru evaporator
 		Real64 mdotCond; // local fluid mass flow rate thru condenser
 		Real64 mdotGen; // local fluid mass flow rate thru generator
@@ -849,7 +897,6 @@ namespace ChillerAbsorption {
 		Real64 tmpEvapVolFlowRate; // local evaporator design volume flow rate
 		Real64 tmpCondVolFlowRate; // local condenser design volume flow rate
 		Real64 tmpGeneratorVolFlowRate; // local generator design volume flow rate
-		static int DummWaterIndex( 1 );
 
 		Real64 NomCapUser( 0.0 ); // Hardsized nominal capacity for reporting
 		Real64 NomPumpPowerUser( 0.0 ); // Hardsized nominal pump power for reporting
@@ -1326,8 +1373,6 @@ namespace ChillerAbsorption {
 		Real64 EnthSteamOutDry; // enthalpy of dry steam at generator inlet
 		Real64 EnthSteamOutWet; // enthalpy of wet steam at generator inlet
 		Real64 HfgSteam; // heat of vaporization of steam
-		static Array1D_bool MyEnvironFlag;
-		static Array1D_bool MyEnvironSteamFlag;
 		Real64 FRAC;
 		//  LOGICAL,SAVE           :: PossibleSubcooling
 		Real64 CpFluid; // local specific heat of fluid
@@ -1335,7 +1380,6 @@ namespace ChillerAbsorption {
 		Real64 SteamOutletTemp;
 		int LoopNum;
 		int LoopSideNum;
-		static int DummyWaterIndex( 1 );
 
 		//set module level inlet and outlet nodes
 		EvapMassFlowRate = 0.0;
@@ -1576,7 +1620,7 @@ namespace ChillerAbsorption {
 				SteamDeltaT = BLASTAbsorber( ChillNum ).GeneratorSubcool;
 				SteamOutletTemp = Node( GeneratorInletNode ).Temp - SteamDeltaT;
 				HfgSteam = EnthSteamOutDry - EnthSteamOutWet;
-				CpFluid = GetSpecificHeatGlycol( fluidNameWater, SteamOutletTemp, DummyWaterIndex, calcChillerAbsorption + BLASTAbsorber( ChillNum ).Name );
+				CpFluid = GetSpecificHeatGlycol( fluidNameWater, SteamOutletTemp, CalcBLASTAbsorberModelDummyWaterIndex, calcChillerAbsorption + BLASTAbsorber( ChillNum ).Name );
 				SteamMassFlowRate = QGenerator / ( HfgSteam + CpFluid * SteamDeltaT );
 				SetComponentFlowRate( SteamMassFlowRate, GeneratorInletNode, GeneratorOutletNode, BLASTAbsorber( ChillNum ).GenLoopNum, BLASTAbsorber( ChillNum ).GenLoopSideNum, BLASTAbsorber( ChillNum ).GenBranchNum, BLASTAbsorber( ChillNum ).GenCompNum );
 
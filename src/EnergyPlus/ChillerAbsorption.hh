@@ -270,6 +270,11 @@ namespace ChillerAbsorption {
 
 	// Functions
 
+	// Clears the global data in ChillerAbsorption.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimBLASTAbsorber(
 		std::string const & AbsorberType, // type of Absorber
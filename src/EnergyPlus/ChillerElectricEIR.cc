@@ -189,8 +189,72 @@ namespace ChillerElectricEIR {
 	// Beginning of Electric EIR Chiller Module Driver Subroutine
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false ); // True when input errors are found
+		bool FoundNegValue( false ); // Used to evaluate PLFFPLR curve objects
+		int CurveCheck( 0 ); // Used to evaluate PLFFPLR curve objects
+		bool AllocatedFlag( false ); // True when arrays are allocated
+		bool MyOneTimeFlag( true ); // Flag used to execute code only once
+		Array1D_bool MyFlag; // TRUE in order to set component location
+		Array1D_bool MyEnvrnFlag; // TRUE when new environment is started
+		bool SizeElectricEIRChillerMyOneTimeFlag( true );
+		Array1D_bool SizeElectricEIRChillerMyFlag; // TRUE in order to calculate IPLV
+		Real64 TimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
+		Real64 CurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
+		std::string OutputChar; // character string for warning messages
+	}
+
 	// Functions
 
+	// Clears the global data in ChillerElectricEIR.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumElectricEIRChillers = 0;
+		CondMassFlowRate = 0.0;
+		EvapMassFlowRate = 0.0;
+		CondOutletTemp = 0.0;
+		CondOutletHumRat = 0.0;
+		EvapOutletTemp = 0.0;
+		EvapWaterConsumpRate = 0.0;
+		Power = 0.0;
+		QEvaporator = 0.0;
+		QCondenser = 0.0;
+		QHeatRecovered = 0.0;
+		HeatRecOutletTemp = 0.0;
+		CondenserFanPower = 0.0;
+		ChillerCapFT = 0.0;
+		ChillerEIRFT = 0.0;
+		ChillerEIRFPLR = 0.0;
+		ChillerPartLoadRatio = 0.0;
+		ChillerCyclingRatio = 0.0;
+		BasinHeaterPower = 0.0;
+		ChillerFalseLoadRate = 0.0;
+		AvgCondSinkTemp = 0.0;
+		CheckEquipName.deallocate();
+		GetInputEIR = true;
+		ElectricEIRChiller.deallocate();
+		ElectricEIRChillerReport.deallocate();
+		ErrorsFound = false;
+		FoundNegValue = false;
+		CurveCheck = 0;
+		AllocatedFlag = false;
+		MyOneTimeFlag = true;
+		MyFlag.deallocate();
+		MyEnvrnFlag.deallocate();
+		SizeElectricEIRChillerMyOneTimeFlag = true;
+		SizeElectricEIRChillerMyFlag.deallocate();
+		TimeStepSysLast = 0.0;
+		CurrentEndTimeLast = 0.0;
+		OutputChar.clear();
+	}
+
 	void
 	SimElectricEIRChiller(
 		std::string const & EP_UNUSED( EIRChillerType ), // Type of chiller
@@ -357,18 +421,14 @@ namespace ChillerElectricEIR {
 		int NumAlphas; // Number of elements in the alpha array
 		int NumNums; // Number of elements in the numeric array
 		int IOStat; // IO Status when calling get input subroutine
-		static bool ErrorsFound( false ); // True when input errors are found
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		Real64 CurveVal; // Used to verify EIR-FT and CAP-FT curves equal 1 at reference conditions
-		static bool FoundNegValue( false ); // Used to evaluate PLFFPLR curve objects
-		static int CurveCheck( 0 ); // Used to evaluate PLFFPLR curve objects
 		Array1D< Real64 > CurveValArray( 11 ); // Used to evaluate PLFFPLR curve objects
 		Real64 CurveValTmp; // Used to evaluate PLFFPLR curve objects
 		bool errFlag; // Used to tell if a unique chiller name has been specified
 		std::string StringVar; // Used for EIRFPLR warning messages
 		int CurveValPtr; // Index to EIRFPLR curve output
-		static bool AllocatedFlag( false ); // True when arrays are allocated
 		bool Okay;
 
 		// Formats
@@ -856,9 +916,6 @@ namespace ChillerElectricEIR {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static std::string const RoutineName( "InitElectricEIRChiller" );
-		static bool MyOneTimeFlag( true ); // Flag used to execute code only once
-		static Array1D_bool MyFlag; // TRUE in order to set component location
-		static Array1D_bool MyEnvrnFlag; // TRUE when new environment is started
 		int EvapInletNode; // Node number for evaporator water inlet node
 		int EvapOutletNode; // Node number for evaporator water outlet node
 		int CondInletNode; // Node number for condenser water inlet node
@@ -1128,8 +1185,6 @@ namespace ChillerElectricEIR {
 		Real64 tmpNomCap; // local nominal capacity cooling power
 		Real64 tmpEvapVolFlowRate; // local evaporator design volume flow rate
 		Real64 tmpCondVolFlowRate; // local condenser design volume flow rate
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyFlag; // TRUE in order to calculate IPLV
 		Real64 EvapVolFlowRateUser; // Hardsized evaporator flow for reporting
 		Real64 RefCapUser; // Hardsized reference capacity for reporting
 		Real64 CondVolFlowRateUser; // Hardsized condenser flow for reporting
@@ -1140,9 +1195,9 @@ namespace ChillerElectricEIR {
 		Real64 TempSize; // autosized value of coil input field
 		int SizingMethod; // Integer representation of sizing method (e.g., CoolingAirflowSizing, HeatingCapacitySizing, etc.)
 
-		if ( MyOneTimeFlag ) {
-			MyFlag.dimension( NumElectricEIRChillers, true );
-			MyOneTimeFlag = false;
+		if ( SizeElectricEIRChillerMyOneTimeFlag ) {
+			SizeElectricEIRChillerMyFlag.dimension( NumElectricEIRChillers, true );
+			SizeElectricEIRChillerMyOneTimeFlag = false;
 		}
 
 		PltSizNum = 0;
@@ -1358,9 +1413,9 @@ namespace ChillerElectricEIR {
 		// where is the heat recovery sizing? should be here but it is missing???
 
 		if ( PlantFinalSizesOkayToReport ) {
-			if ( MyFlag( EIRChillNum ) ) {
+			if ( SizeElectricEIRChillerMyFlag( EIRChillNum ) ) {
 				CalcChillerIPLV( ElectricEIRChiller( EIRChillNum ).Name, TypeOf_Chiller_ElectricEIR, ElectricEIRChiller( EIRChillNum ).RefCap, ElectricEIRChiller( EIRChillNum ).RefCOP, ElectricEIRChiller( EIRChillNum ).CondenserType, ElectricEIRChiller( EIRChillNum ).ChillerCapFT, ElectricEIRChiller( EIRChillNum ).ChillerEIRFT, ElectricEIRChiller( EIRChillNum ).ChillerEIRFPLR, ElectricEIRChiller( EIRChillNum ).MinUnloadRat );
-				MyFlag( EIRChillNum ) = false;
+				SizeElectricEIRChillerMyFlag( EIRChillNum ) = false;
 			}
 			//create predefined report
 			equipName = ElectricEIRChiller( EIRChillNum ).Name;
@@ -1457,10 +1512,7 @@ namespace ChillerElectricEIR {
 		int LoopSideNum; // Plant loop side which contains the current chiller (usually supply side)
 		int BranchNum;
 		int CompNum;
-		static Real64 TimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
 		Real64 CurrentEndTime; // end time of time step for current simulation time step
-		static Real64 CurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
-		static std::string OutputChar; // character string for warning messages
 		Real64 Cp; // local fluid specific heat
 		Real64 RhoAir; // air density [kg/m3]
 
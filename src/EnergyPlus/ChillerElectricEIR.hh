@@ -362,6 +362,11 @@ namespace ChillerElectricEIR {
 
 	// Functions
 
+	// Clears the global data in ChillerElectricEIR.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimElectricEIRChiller(
 		std::string const & EIRChillerType, // Type of chiller
@@ -166,6 +166,25 @@ namespace ChillerIndirectAbsorption {
 	// Beginning of Absorption Chiller Module Driver Subroutines
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInput( true ); // when TRUE, calls subroutine to read input file.
+		bool ErrorsFound( false );
+		bool MyOneTimeFlag( true );
+		Array1D_bool MyFlag;
+		Array1D_bool MyEnvrnFlag;
+		int DummWaterIndex( 1 );
+		Array1D_bool MyEnvironFlag;
+		Array1D_bool MyEnvironSteamFlag;
+		bool OneTimeFlag( true );
+		bool PossibleSubcooling; // flag to determine if supply water temperature is below setpoint
+		int DummyWaterIndex( 1 );
+	}
+
 	// Functions
 
 	void
@@ -221,7 +240,6 @@ namespace ChillerIndirectAbsorption {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInput( true ); // when TRUE, calls subroutine to read input file.
 		int ChillNum; // Chiller number pointer
 
 		if ( CompIndex != 0 ) {
@@ -345,7 +363,6 @@ namespace ChillerIndirectAbsorption {
 		int NumAlphas; // Number of elements in the alpha array
 		int NumNums; // Number of elements in the numeric array
 		int IOStat; // IO Status when calling get input subroutine
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool errFlag; // GetInput error flag
@@ -709,9 +726,6 @@ namespace ChillerIndirectAbsorption {
 		static std::string const RoutineName( "InitIndirectAbsorpChiller" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyFlag;
-		static Array1D_bool MyEnvrnFlag;
 		int CondInletNode; // node number of water inlet node to the condenser
 		int CondOutletNode; // node number of water outlet node from the condenser
 		bool errFlag;
@@ -927,7 +941,6 @@ namespace ChillerIndirectAbsorption {
 		Real64 tmpEvapVolFlowRate; // local evaporator design volume flow rate
 		Real64 tmpCondVolFlowRate; // local condenser design volume flow rate
 		Real64 tmpGeneratorVolFlowRate; // local generator design volume flow rate
-		static int DummWaterIndex( 1 );
 		Real64 NomCapUser; // Hardsized nominal capacity cooling power for reporting
 		Real64 NomPumpPowerUser; // Hardsized local nominal pump power for reporting
 		Real64 EvapVolFlowRateUser; // Hardsized local evaporator design volume flow rate for reporting
@@ -1452,11 +1465,7 @@ namespace ChillerIndirectAbsorption {
 		Real64 EnthSteamOutDry; // enthalpy of dry steam at generator inlet
 		Real64 EnthSteamOutWet; // enthalpy of wet steam at generator inlet
 		Real64 HfgSteam; // heat of vaporization of steam
-		static Array1D_bool MyEnvironFlag;
-		static Array1D_bool MyEnvironSteamFlag;
-		static bool OneTimeFlag( true );
 		Real64 FRAC; // fraction of time step chiller cycles
-		static bool PossibleSubcooling; // flag to determine if supply water temperature is below setpoint
 		Real64 CpFluid; // specific heat of generator fluid
 		Real64 SteamDeltaT; // temperature difference of fluid through generator
 		Real64 SteamOutletTemp; // generator outlet temperature
@@ -1471,7 +1480,6 @@ namespace ChillerIndirectAbsorption {
 		Real64 EnthPumpInlet; // enthalpy of condensed steam entering pump (includes loop losses)
 		int LoopSideNum;
 		int LoopNum;
-		static int DummyWaterIndex( 1 );
 
 		if ( OneTimeFlag ) {
 			MyEnvironFlag.allocate( NumIndirectAbsorbers );
@@ -2009,6 +2017,17 @@ namespace ChillerIndirectAbsorption {
 		ChillerONOFFCyclingFrac = 0.0 ;
 		IndirectAbsorber.deallocate();
 		IndirectAbsorberReport.deallocate();
+		GetInput = true;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		MyFlag.deallocate();
+		MyEnvrnFlag.deallocate();
+		DummWaterIndex = 1;
+		MyEnvironFlag.deallocate();
+		MyEnvironSteamFlag.deallocate();
+		OneTimeFlag = true;
+		PossibleSubcooling = false;
+		DummyWaterIndex = 1;
 	}
 
 } // ChillerIndirectAbsorption
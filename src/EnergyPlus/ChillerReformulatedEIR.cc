@@ -188,8 +188,61 @@ namespace ChillerReformulatedEIR {
 	// Beginning of Reformulated EIR Chiller Module Driver Subroutine
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false ); // True when input errors found
+		bool AllocatedFlag( false ); // True when arrays are allocated
+		bool MyOneTimeFlag( true ); // One time logic flag for allocating MyEnvrnFlag array
+		Array1D_bool MyFlag;
+		Array1D_bool MyEnvrnFlag; // Logical array to initialize when appropriate
+		bool FoundNegValue( false ); // Used to evaluate EIRFPLR curve objects
+		int CurveCheck( 0 ); // Used to evaluate EIRFPLR curve objects
+		bool SizeElecReformEIRChillerMyOneTimeFlag( true );
+		Array1D_bool SizeElecReformEIRChillerMyFlag; // TRUE in order to calculate IPLV
+	}
+
 	// Functions
 
+	// Clears the global data in ChillerReformulatedEIR.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumElecReformEIRChillers = 0;
+		CondMassFlowRate = 0.0;
+		EvapMassFlowRate = 0.0;
+		CondOutletTemp = 0.0;
+		EvapOutletTemp = 0.0;
+		Power = 0.0;
+		QEvaporator = 0.0;
+		QCondenser = 0.0;
+		QHeatRecovered = 0.0;
+		HeatRecOutletTemp = 0.0;
+		ChillerCapFT = 0.0;
+		ChillerEIRFT = 0.0;
+		ChillerEIRFPLR = 0.0;
+		ChillerPartLoadRatio = 0.0;
+		ChillerCyclingRatio = 0.0;
+		ChillerFalseLoadRate = 0.0;
+		AvgCondSinkTemp = 0.0;
+		GetInputREIR = true;
+		ElecReformEIRChiller.deallocate();
+		ElecReformEIRChillerReport.deallocate();
+		ErrorsFound = false;
+		AllocatedFlag = false;
+		MyOneTimeFlag = true;
+		MyFlag.deallocate();
+		MyEnvrnFlag.deallocate();
+		FoundNegValue = false;
+		CurveCheck = 0;
+		SizeElecReformEIRChillerMyOneTimeFlag = true;
+		SizeElecReformEIRChillerMyFlag.deallocate();
+	}
+
 	void
 	SimReformulatedEIRChiller(
 		std::string const & EP_UNUSED( EIRChillerType ), // Type of chiller !unused1208
@@ -351,11 +404,9 @@ namespace ChillerReformulatedEIR {
 		int NumAlphas; // Number of elements in the alpha array
 		int NumNums; // Number of elements in the numeric array
 		int IOStat; // IO Status when calling get input subroutine
-		static bool ErrorsFound( false ); // True when input errors found
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool errFlag; // Error flag, used to tell if a unique chiller name has been specified
-		static bool AllocatedFlag( false ); // True when arrays are allocated
 		std::string PartLoadCurveType; // Part load curve type
 
 		// FLOW
@@ -730,9 +781,6 @@ namespace ChillerReformulatedEIR {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static std::string const RoutineName( "InitElecReformEIRChiller" );
-		static bool MyOneTimeFlag( true ); // One time logic flag for allocating MyEnvrnFlag array
-		static Array1D_bool MyFlag;
-		static Array1D_bool MyEnvrnFlag; // Logical array to initialize when appropriate
 		int EvapInletNode; // Node number for evaporator water inlet node
 		int EvapOutletNode; // Node number for evaporator water outlet node
 		int CondInletNode; // Node number for condenser water inlet node
@@ -979,8 +1027,6 @@ namespace ChillerReformulatedEIR {
 		std::string equipName; // Name of chiller
 		Real64 CurveVal; // Used to verify EIR-FT/CAP-FT curves = 1 at reference conditions
 		Real64 CondTemp; // Used to verify EIRFPLR curve is > than 0 at reference conditions
-		static bool FoundNegValue( false ); // Used to evaluate EIRFPLR curve objects
-		static int CurveCheck( 0 ); // Used to evaluate EIRFPLR curve objects
 		Array1D< Real64 > CurveValArray( 11 ); // Used to evaluate EIRFPLR curve objects
 		Array1D< Real64 > CondTempArray( 11 ); // Used to evaluate EIRFPLR curve objects
 		Real64 CurveValTmp; // Used to evaluate EIRFPLR curve objects
@@ -997,8 +1043,6 @@ namespace ChillerReformulatedEIR {
 		Real64 tmpEvapVolFlowRate; // local evaporator design volume flow rate
 		Real64 tmpCondVolFlowRate; // local condenser design volume flow rate
 		Real64 tmpHeatRecVolFlowRate; // local heat recovery design volume flow rate
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyFlag; // TRUE in order to calculate IPLV
 		Real64 EvapVolFlowRateUser( 0.0 ); // Hardsized evaporator flow for reporting
 		Real64 RefCapUser( 0.0 ); // Hardsized reference capacity for reporting
 		Real64 CondVolFlowRateUser( 0.0 ); // Hardsized condenser flow for reporting
@@ -1008,9 +1052,9 @@ namespace ChillerReformulatedEIR {
 		static gio::Fmt Format_530( "('Cond Temp (C) = ',11(F7.2))" );
 		static gio::Fmt Format_531( "('Curve Output  = ',11(F7.2))" );
 
-		if ( MyOneTimeFlag ) {
-			MyFlag.dimension( NumElecReformEIRChillers, true );
-			MyOneTimeFlag = false;
+		if ( SizeElecReformEIRChillerMyOneTimeFlag ) {
+			SizeElecReformEIRChillerMyFlag.dimension( NumElecReformEIRChillers, true );
+			SizeElecReformEIRChillerMyOneTimeFlag = false;
 		}
 
 		tmpNomCap = ElecReformEIRChiller( EIRChillNum ).RefCap;
@@ -1240,9 +1284,9 @@ namespace ChillerReformulatedEIR {
 		}
 
 		if ( PlantFinalSizesOkayToReport ) {
-			if ( MyFlag( EIRChillNum ) ) {
+			if ( SizeElecReformEIRChillerMyFlag( EIRChillNum ) ) {
 				CalcChillerIPLV( ElecReformEIRChiller( EIRChillNum ).Name, TypeOf_Chiller_ElectricReformEIR, ElecReformEIRChiller( EIRChillNum ).RefCap, ElecReformEIRChiller( EIRChillNum ).RefCOP, ElecReformEIRChiller( EIRChillNum ).CondenserType, ElecReformEIRChiller( EIRChillNum ).ChillerCapFT, ElecReformEIRChiller( EIRChillNum ).ChillerEIRFT, ElecReformEIRChiller( EIRChillNum ).ChillerEIRFPLR, ElecReformEIRChiller( EIRChillNum ).MinUnloadRat, ElecReformEIRChiller( EIRChillNum ).EvapVolFlowRate, ElecReformEIRChiller( EIRChillNum ).CDLoopNum, ElecReformEIRChiller( EIRChillNum ).CompPowerToCondenserFrac );
-				MyFlag( EIRChillNum ) = false;
+				SizeElecReformEIRChillerMyFlag( EIRChillNum ) = false;
 			}
 			//create predefined report
 			equipName = ElecReformEIRChiller( EIRChillNum ).Name;
@@ -1490,7 +1534,7 @@ namespace ChillerReformulatedEIR {
 				//Par(5) = FlowLock !DSU
 				Par( 6 ) = EquipFlowCtrl;
 
-				SolveRegulaFalsi( Acc, MaxIter, SolFla, FalsiCondOutTemp, CondOutTempResidual, Tmin, Tmax, Par );
+				SolveRegulaFalsi( Acc, MaxIter, SolFla, FalsiCondOutTemp, CondOutTempResidual, Tmin, Tmax, Par, "ControlReformEIRChillerModel" );
 
 				if ( SolFla == -1 ) {
 					if ( ! WarmupFlag ) {
@@ -401,6 +401,11 @@ namespace ChillerReformulatedEIR {
 
 	// Functions
 
+	// Clears the global data in ChillerReformulatedEIR.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimReformulatedEIRChiller(
 		std::string const & EIRChillerType, // Type of chiller !unused1208
@@ -59,11 +59,24 @@
 // CLI Headers
 #include <ezOptionParser.hpp>
 
+// C++ Headers
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <map>
+
+#ifndef _WIN32
+ #include <sys/wait.h>
+ #include <unistd.h>
+#endif
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/gio.hh>
 
 // Project headers
 #include <CommandLineInterface.hh>
+#include <EnergyPlusPgm.hh>
 #include <DataGlobals.hh>
 #include <DataStringGlobals.hh>
 #include <DataSystemVariables.hh>
@@ -93,6 +106,12 @@ using namespace OutputProcessor;
 using namespace SolarShading;
 using namespace ez;
 
+namespace {
+	// Read end of the pipe on which the first segment of a split simulation learns that the later
+	// segments have completed (-1 if there is none)
+	int laterSegmentsPipe( -1 );
+}
+
 int
 ProcessArgs(int argc, const char * argv[])
 {
@@ -148,6 +167,10 @@ ProcessArgs(int argc, const char * argv[])
 
 	opt.add("", 0, 0, 0, "Force annual simulation", "-a", "--annual");
 
+	opt.add("", 0, 1, 0, "Run each input file listed in file (one per line), each in its own directory under the output directory", "-b", "--batch");
+
+	opt.add("", 0, 0, 0, "With segments, also simulate the run periods serially and report the differences of the merged output", "-c", "--compare-serial");
+
 	opt.add("", 0, 1, 0, "Output directory path (default: current directory)", "-d", "--output-directory");
 
 	opt.add("", 0, 0, 0, "Force design-day-only simulation", "-D", "--design-day");
@@ -156,12 +179,22 @@ ProcessArgs(int argc, const char * argv[])
 
 	opt.add("Energy+.idd", 0, 1, 0, "Input data dictionary path (default: Energy+.idd in executable directory)", "-i", "--idd");
 
+	opt.add("1", 0, 1, 0, "Number of batch runs to simulate at the same time (default: 1)", "-j", "--jobs");
+
 	opt.add("", 0, 0, 0, "Run EPMacro prior to simulation", "-m", "--epmacro");
 
+	opt.add("1", 0, 1, 0, "Number of segments the weather file run periods are split into, simulated at the same time (default: 1)", "-n", "--segments");
+
+	opt.add("7", 0, 1, 0, "Days simulated ahead of each segment to settle its initial state (default: 7)", "-o", "--overlap-days");
+
 	opt.add("", 0, 1, 0, "Prefix for output file names (default: eplus)", "-p", "--output-prefix");
 
 	opt.add("", 0, 0, 0, "Run ReadVarsESO after simulation", "-r", "--readvars");
 
+	opt.add("-1", 0, 1, 0, "Segment simulated by this run, set for the runs started by --segments (0 for the serial reference run)", "--segment-run");
+
+	opt.add("", 0, 0, 0, "Resume the simulation from the checkpoint file named by the CHECKPOINT_FILE environment variable", "-R", "--restart");
+
 	opt.add("L", 0, 1, 0, "Suffix style for output file names (default: L)\n   L: Legacy (e.g., eplustbl.csv)\n   C: Capital (e.g., eplusTable.csv)\n   D: Dash (e.g., eplus-table.csv)", "-s", "--output-suffix");
 
 	opt.add("", 0, 0, 0, "Display version information", "-v", "--version");
@@ -205,6 +238,8 @@ ProcessArgs(int argc, const char * argv[])
 
 	AnnualSimulation = opt.isSet("-a");
 
+	RestartSimulation = opt.isSet("-R");
+
 	// Process standard arguments
 	if (opt.isSet("-h")) {
 		DisplayString(usage);
@@ -216,6 +251,42 @@ ProcessArgs(int argc, const char * argv[])
 		exit(EXIT_SUCCESS);
 	}
 
+	if (opt.isSet("-b")) {
+		if (opt.lastArgs.size() > 0u) {
+			DisplayString("ERROR: Input files cannot be given together with a batch file.");
+			DisplayString(errorFollowUp);
+			exit(EXIT_FAILURE);
+		}
+
+		std::string batchFileName;
+		opt.get("-b")->getString(batchFileName);
+		makeNativePath(batchFileName);
+
+		int numJobs;
+		opt.get("-j")->getInt(numJobs);
+		if (numJobs < 1) {
+			DisplayString("ERROR: Number of batch jobs must be at least 1.");
+			DisplayString(errorFollowUp);
+			exit(EXIT_FAILURE);
+		}
+
+		makeNativePath(dirPathName);
+		if (opt.isSet("-d")) {
+			if (dirPathName[dirPathName.size()-1]!=pathChar) {
+				dirPathName+=pathChar;
+			}
+			makeDirectory(dirPathName);
+		}
+
+		// Each run starts in its own directory, so the batch options are not passed on
+		std::vector< std::string > runArgs( RunArguments(arguments, { "-b", "--batch", "-j", "--jobs", "-d", "--output-directory" }) );
+
+		if (opt.isSet("-i")) inputIddFileName = getAbsolutePath(inputIddFileName);
+		makeNativePath(inputIddFileName);
+
+		exit(RunBatch(batchFileName, numJobs, dirPathName, runArgs));
+	}
+
 	if (opt.lastArgs.size() == 1) {
 		for ( size_type i = 0; i < opt.lastArgs.size(); ++i ) {
 			std::string const & arg( *opt.lastArgs[i] );
@@ -369,6 +440,8 @@ ProcessArgs(int argc, const char * argv[])
 	outputSciFileName = outputFilePrefix + normalSuffix + ".sci";
 	outputWrlFileName = outputFilePrefix + normalSuffix + ".wrl";
 	outputSqlFileName = outputFilePrefix + normalSuffix + ".sql";
+	outputSegFileName = outputFilePrefix + normalSuffix + ".seg";
+	outputSegReportsFileName = outputFilePrefix + normalSuffix + ".sgr";
 	outputDbgFileName = outputFilePrefix + normalSuffix + ".dbg";
 	outputTblCsvFileName = outputFilePrefix + tableSuffix + ".csv";
 	outputTblHtmFileName = outputFilePrefix + tableSuffix + ".htm";
@@ -392,6 +465,7 @@ ProcessArgs(int argc, const char * argv[])
 		outputSqliteErrFileName = outputFilePrefix + sqliteSuffix + ".err";
 	}
 	outputScreenCsvFileName = outputFilePrefix + screenSuffix + ".csv";
+	GFunctionCacheFileName = dirPathName + "eplusgfn.cache";
 	outputDelightInFileName = "eplusout.delightin";
 	outputDelightOutFileName = "eplusout.delightout";
 	outputDelightEldmpFileName = "eplusout.delighteldmp";
@@ -509,6 +583,30 @@ ProcessArgs(int argc, const char * argv[])
 		}
 	}
 
+	int numSegments;
+	opt.get("-n")->getInt(numSegments);
+	int overlapDays;
+	opt.get("-o")->getInt(overlapDays);
+	int segmentRun;
+	opt.get("--segment-run")->getInt(segmentRun);
+	if (numSegments < 1 || overlapDays < 0) {
+		DisplayString("ERROR: Number of segments must be at least 1 and number of overlap days at least 0.");
+		DisplayString(errorFollowUp);
+		exit(EXIT_FAILURE);
+	}
+	if (numSegments > 1 && segmentRun >= 0) {
+		// A segment started by RunSegments
+		NumSegments = numSegments;
+		SegmentOverlapDays = overlapDays;
+		SegmentNum = segmentRun;
+	} else if (numSegments > 1 && !DDOnlySimulation) {
+		// Each segment starts in its own directory under the output directory
+		std::vector< std::string > runArgs( RunArguments(arguments, { "-n", "--segments", "-o", "--overlap-days", "-c", "--compare-serial", "-d", "--output-directory" }) );
+		runArgs.push_back(getAbsolutePath(inputIdfFileName));
+		inputIddFileName = getAbsolutePath(inputIddFileName);
+		exit(RunSegments(numSegments, overlapDays, opt.isSet("-c"), dirPathName, runArgs));
+	}
+
 	OutputFileDebug = GetNewUnitNumber();
 	{ IOFlags flags; flags.ACTION( "write" ); gio::open( OutputFileDebug, outputDbgFileName, flags ); iostatus = flags.ios(); }
 	if ( iostatus != 0 ) {
@@ -572,6 +670,846 @@ ProcessArgs(int argc, const char * argv[])
 	return 0;
 }
 
+int
+RunBatch(
+	std::string const & batchFileName, // File listing the input files, one per line
+	int const numJobs, // Maximum number of runs simulated at the same time
+	std::string const & outputDirectory, // Directory holding the run directories (blank for current directory)
+	std::vector< std::string > const & runArgs // Command line for each run, without the input file
+)
+{
+
+	// FUNCTION INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2016
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS FUNCTION:
+	// Simulates every input file listed in the batch file and reports the throughput.
+	// Returns EXIT_SUCCESS if all runs completed successfully.
+
+	// METHODOLOGY EMPLOYED:
+	// The data dictionary is processed once, then each run is forked from this process so
+	// it starts with the object definitions already in (copy-on-write) memory.  At most
+	// numJobs runs are active; a new one is started whenever one finishes.  Each run
+	// works in its own directory named after its input file so the output files of runs
+	// do not collide.  The data dictionary is never cleared in this process, so every run
+	// forked from it shares the same definitions.  Where fork is not available the runs are
+	// started one after another as separate energyplus processes, which read the data
+	// dictionary themselves; EnergyPlusPgm runs only one simulation per process.
+
+	struct BatchRun {
+		std::string inputFileName; // Absolute path of the input file
+		std::string directory; // Directory the run works in
+		int status = EXIT_FAILURE; // Exit status of the run
+		double elapsedSeconds = 0.0; // Wall clock time of the run
+		std::chrono::steady_clock::time_point startTime;
+	};
+
+	std::vector< BatchRun > runs;
+	std::map< std::string, int > directoryCount;
+
+	std::ifstream batchFile( batchFileName );
+	if ( ! batchFile ) {
+		DisplayString( "ERROR: Could not open batch file: " + getAbsolutePath( batchFileName ) + "." );
+		return EXIT_FAILURE;
+	}
+	std::string line;
+	while ( std::getline( batchFile, line ) ) {
+		std::string::size_type const first = line.find_first_not_of( " \t\r" );
+		if ( first == std::string::npos || line[ first ] == '!' || line[ first ] == '#' ) continue;
+		std::string inputFileName( line.substr( first, line.find_last_not_of( " \t\r" ) - first + 1 ) );
+		makeNativePath( inputFileName );
+		if ( ! fileExists( inputFileName ) ) {
+			DisplayString( "ERROR: Could not find input data file: " + getAbsolutePath( inputFileName ) + "." );
+			return EXIT_FAILURE;
+		}
+		BatchRun run;
+		run.inputFileName = getAbsolutePath( inputFileName );
+		std::string runName( removeFileExtension( getFileName( inputFileName ) ) );
+		int const count = ++directoryCount[ runName ];
+		if ( count > 1 ) runName += "-" + std::to_string( count );
+		run.directory = outputDirectory + runName + pathChar;
+		runs.push_back( run );
+	}
+	if ( runs.empty() ) {
+		DisplayString( "ERROR: No input files found in batch file: " + getAbsolutePath( batchFileName ) + "." );
+		return EXIT_FAILURE;
+	}
+
+	bool errorsInIDD( false );
+	InputProcessor::PreloadDataDictionary( inputIddFileName, errorsInIDD );
+	if ( errorsInIDD ) {
+		DisplayString( "ERROR: Could not process input data dictionary: " + getAbsolutePath( inputIddFileName ) + "." );
+		return EXIT_FAILURE;
+	}
+
+	int const numRuns = static_cast< int >( runs.size() );
+	DisplayString( "EnergyPlus Batch: " + std::to_string( numRuns ) + " runs, " + std::to_string( numJobs ) + " at a time" );
+
+	auto const batchStartTime = std::chrono::steady_clock::now();
+
+#ifndef _WIN32
+	std::map< pid_t, int > activeRuns; // Process of each active run
+	int nextRun = 0;
+	while ( nextRun < numRuns || ! activeRuns.empty() ) {
+		while ( nextRun < numRuns && static_cast< int >( activeRuns.size() ) < numJobs ) {
+			BatchRun & run( runs[ nextRun ] );
+			makeDirectory( run.directory );
+			std::cout.flush();
+			std::cerr.flush();
+			run.startTime = std::chrono::steady_clock::now();
+			pid_t const pid = fork();
+			if ( pid == 0 ) {
+				if ( chdir( run.directory.c_str() ) != 0 ) _exit( EXIT_FAILURE );
+				std::vector< const char * > argv;
+				for ( auto const & arg : runArgs ) argv.push_back( arg.c_str() );
+				argv.push_back( run.inputFileName.c_str() );
+				ProcessArgs( static_cast< int >( argv.size() ), &argv[ 0 ] );
+				std::exit( EnergyPlusPgm() );
+			} else if ( pid < 0 ) {
+				DisplayString( "ERROR: Could not start batch run for " + run.inputFileName + "." );
+			} else {
+				activeRuns[ pid ] = nextRun;
+			}
+			++nextRun;
+		}
+		if ( activeRuns.empty() ) continue;
+
+		int waitStatus;
+		pid_t const pid = waitpid( -1, &waitStatus, 0 );
+		auto const found = activeRuns.find( pid );
+		if ( found == activeRuns.end() ) continue;
+		BatchRun & run( runs[ found->second ] );
+		run.status = ( WIFEXITED( waitStatus ) ? WEXITSTATUS( waitStatus ) : EXIT_FAILURE );
+		run.elapsedSeconds = std::chrono::duration< double >( std::chrono::steady_clock::now() - run.startTime ).count();
+		activeRuns.erase( found );
+	}
+#else
+	if ( numJobs > 1 ) DisplayString( "EnergyPlus Batch: runs are simulated one at a time on this platform" );
+	for ( auto & run : runs ) {
+		makeDirectory( run.directory );
+		run.startTime = std::chrono::steady_clock::now();
+		std::string command( "\"" + getAbsolutePath( getProgramPath() ) + "\"" );
+		for ( auto arg = runArgs.begin() + 1; arg != runArgs.end(); ++arg ) command += " \"" + *arg + "\"";
+		command += " -d \"" + run.directory + "\" \"" + run.inputFileName + "\"";
+		// cmd.exe strips the outer quotes of a command line that starts with a quote
+		run.status = ( systemCall( "\"" + command + "\"" ) == 0 ? EXIT_SUCCESS : EXIT_FAILURE );
+		run.elapsedSeconds = std::chrono::duration< double >( std::chrono::steady_clock::now() - run.startTime ).count();
+	}
+#endif
+
+	double const batchSeconds = std::chrono::duration< double >( std::chrono::steady_clock::now() - batchStartTime ).count();
+
+	// Aggregate throughput, also written per run to the batch summary file
+	int numFailed = 0;
+	double runSeconds = 0.0;
+	std::ofstream summaryFile( outputDirectory + "eplusbatch.csv" );
+	summaryFile << "Input File,Directory,Exit Status,Elapsed Time {s}\n";
+	for ( auto const & run : runs ) {
+		if ( run.status != EXIT_SUCCESS ) {
+			++numFailed;
+			DisplayString( "EnergyPlus Batch: run failed: " + run.inputFileName );
+		}
+		runSeconds += run.elapsedSeconds;
+		summaryFile << run.inputFileName << ',' << run.directory << ',' << run.status << ',' << run.elapsedSeconds << '\n';
+	}
+	summaryFile.close();
+
+	DisplayString( "EnergyPlus Batch: " + std::to_string( numRuns - numFailed ) + " of " + std::to_string( numRuns ) + " runs completed successfully" );
+	DisplayString( "EnergyPlus Batch: elapsed time " + std::to_string( batchSeconds ) + " s, sum of run times " + std::to_string( runSeconds ) + " s" );
+	if ( batchSeconds > 0.0 ) {
+		DisplayString( "EnergyPlus Batch: throughput " + std::to_string( numRuns * 3600.0 / batchSeconds ) + " runs/hour" );
+	}
+
+	return ( numFailed == 0 ? EXIT_SUCCESS : EXIT_FAILURE );
+}
+
+std::vector< std::string >
+RunArguments(
+	std::vector< std::string > const & arguments, // Expanded command line of this process
+	std::vector< std::string > const & droppedOptions // Options (with their values) not passed on
+)
+{
+
+	// FUNCTION INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2016
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS FUNCTION:
+	// Returns the command line passed on to the runs started from this process, without the
+	// input file.
+
+	// METHODOLOGY EMPLOYED:
+	// The runs work in their own directories, so the weather and data dictionary paths are
+	// made absolute.  Arguments that are neither options nor option values are input files
+	// and are left out.
+
+	std::vector< std::string > const pathOptions( { "-w", "--weather", "-i", "--idd" } );
+	std::vector< std::string > const valueOptions( { "-b", "--batch", "-d", "--output-directory", "-j", "--jobs", "-n", "--segments", "-o", "--overlap-days", "-p", "--output-prefix", "-s", "--output-suffix", "--segment-run" } );
+	auto const isIn = []( std::string const & arg, std::vector< std::string > const & options ) {
+		return std::find( options.begin(), options.end(), arg ) != options.end();
+	};
+
+	std::vector< std::string > runArgs;
+	runArgs.push_back( arguments[ 0 ] );
+	for ( std::string::size_type i = 1; i < arguments.size(); ++i ) {
+		std::string const & arg( arguments[ i ] );
+		bool const hasValue = ( i + 1 < arguments.size() ) && ( isIn( arg, pathOptions ) || isIn( arg, valueOptions ) );
+		if ( isIn( arg, droppedOptions ) ) {
+			if ( hasValue ) ++i;
+		} else if ( hasValue && isIn( arg, pathOptions ) ) {
+			runArgs.push_back( arg );
+			std::string filePath( arguments[ ++i ] );
+			makeNativePath( filePath );
+			runArgs.push_back( getAbsolutePath( filePath ) );
+		} else if ( hasValue ) {
+			runArgs.push_back( arg );
+			runArgs.push_back( arguments[ ++i ] );
+		} else if ( arg.substr( 0, 1 ) == "-" ) {
+			runArgs.push_back( arg );
+		}
+	}
+	return runArgs;
+}
+
+int
+RunSegments(
+	int const numSegments, // Number of segments the weather file run periods are split into
+	int const overlapDays, // Days simulated ahead of each segment to settle its initial state
+	bool const compareSerial, // Also simulate the run periods serially and compare the outputs
+	std::string const & outputDirectory, // Directory holding the segment directories and the merged output
+	std::vector< std::string > const & runArgs // Command line for each segment
+)
+{
+
+	// FUNCTION INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2016
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS FUNCTION:
+	// Simulates the weather file run periods of the input file as consecutive segments, all at
+	// the same time, and merges the outputs of the segments.  Returns EXIT_SUCCESS if all
+	// segments completed successfully.
+
+	// METHODOLOGY EMPLOYED:
+	// The data dictionary is processed once and each segment is forked from this process, as
+	// for a batch run.  The first segment also simulates the sizing periods; every segment
+	// warms up on its first simulated day and then simulates the overlap days before its
+	// first reported day without reporting.  The later segments save their gathering for the
+	// tabular reports, which the first segment waits for and merges with its own and with
+	// their SQLite output before it writes the tabular reports of the whole run period.  The
+	// standard and meter outputs of the segments are merged here.  The zone air and inside
+	// surface temperatures at the end of each segment are compared with those the next
+	// segment reached at the end of its overlap days and written with the segment timings to
+	// the segment summary file.  If requested, an unsplit serial run is simulated at the same
+	// time as a reference, and the differences of the boundary states and of the merged
+	// standard output from it are added.  Where a process cannot be forked, the segments are
+	// started as separate programs one after another, the first segment last.
+
+	struct SegmentRun {
+		std::string directory; // Directory the segment works in
+		int status = EXIT_FAILURE; // Exit status of the segment
+		double elapsedSeconds = 0.0; // Wall clock time of the segment
+		std::chrono::steady_clock::time_point startTime;
+	};
+
+	// Output file names of this process, the segments set their own
+	std::string const esoFileName( outputEsoFileName );
+	std::string const mtrFileName( outputMtrFileName );
+	std::string const segFileName( outputSegFileName );
+	std::vector< std::string > const reportFileNames( { outputTblCsvFileName, outputTblHtmFileName, outputTblTabFileName, outputTblTxtFileName, outputTblXmlFileName, outputSqlFileName } );
+
+	// The serial reference run, if any, follows the segments
+	std::vector< SegmentRun > segments( numSegments + ( compareSerial ? 1 : 0 ) );
+	for ( int seg = 0; seg < numSegments; ++seg ) {
+		segments[ seg ].directory = getAbsolutePath( outputDirectory + "segment-" + std::to_string( seg + 1 ) ) + pathChar;
+	}
+	if ( compareSerial ) segments.back().directory = getAbsolutePath( outputDirectory + "serial" ) + pathChar;
+
+	// Command line of each segment, the input file stays last
+	auto const segmentArgs = [&]( int const seg ) {
+		std::vector< std::string > args( runArgs.begin(), runArgs.end() - 1 );
+		args.insert( args.end(), { "-n", std::to_string( numSegments ), "-o", std::to_string( overlapDays ), "--segment-run", std::to_string( seg < numSegments ? seg + 1 : 0 ), "-d", segments[ seg ].directory, runArgs.back() } );
+		return args;
+	};
+
+	DisplayString( "EnergyPlus Segments: " + std::to_string( numSegments ) + " segments, " + std::to_string( overlapDays ) + " overlap days" + ( compareSerial ? ", compared with a serial run" : "" ) );
+
+	auto const startTime = std::chrono::steady_clock::now();
+
+#ifndef _WIN32
+	bool errorsInIDD( false );
+	InputProcessor::PreloadDataDictionary( inputIddFileName, errorsInIDD );
+	if ( errorsInIDD ) {
+		DisplayString( "ERROR: Could not process input data dictionary: " + getAbsolutePath( inputIddFileName ) + "." );
+		return EXIT_FAILURE;
+	}
+
+	int pipeEnds[ 2 ]; // The first segment reads what this process writes when the later segments are done
+	if ( pipe( pipeEnds ) != 0 ) {
+		DisplayString( "ERROR: Could not start the segments." );
+		return EXIT_FAILURE;
+	}
+	std::map< pid_t, int > activeSegments; // Process of each active segment
+	for ( int seg = 0; seg < int( segments.size() ); ++seg ) {
+		SegmentRun & segment( segments[ seg ] );
+		makeDirectory( segment.directory );
+		std::cout.flush();
+		std::cerr.flush();
+		segment.startTime = std::chrono::steady_clock::now();
+		pid_t const pid = fork();
+		if ( pid == 0 ) {
+			if ( chdir( segment.directory.c_str() ) != 0 ) _exit( EXIT_FAILURE );
+			close( pipeEnds[ 1 ] );
+			if ( seg == 0 ) {
+				laterSegmentsPipe = pipeEnds[ 0 ];
+			} else {
+				close( pipeEnds[ 0 ] );
+			}
+			std::vector< std::string > const args( segmentArgs( seg ) );
+			std::vector< const char * > argv;
+			for ( auto const & arg : args ) argv.push_back( arg.c_str() );
+			ProcessArgs( static_cast< int >( argv.size() ), &argv[ 0 ] );
+			std::exit( EnergyPlusPgm() );
+		} else if ( pid < 0 ) {
+			DisplayString( "ERROR: Could not start segment " + std::to_string( seg + 1 ) + "." );
+		} else {
+			activeSegments[ pid ] = seg;
+		}
+	}
+	close( pipeEnds[ 0 ] );
+	bool laterSegmentsDone = ( numSegments < 2 );
+	while ( ! activeSegments.empty() ) {
+		int waitStatus;
+		pid_t const pid = waitpid( -1, &waitStatus, 0 );
+		if ( pid < 0 ) break;
+		auto const found = activeSegments.find( pid );
+		if ( found == activeSegments.end() ) continue;
+		SegmentRun & segment( segments[ found->second ] );
+		segment.status = ( WIFEXITED( waitStatus ) ? WEXITSTATUS( waitStatus ) : EXIT_FAILURE );
+		segment.elapsedSeconds = std::chrono::duration< double >( std::chrono::steady_clock::now() - segment.startTime ).count();
+		activeSegments.erase( found );
+		if ( ! laterSegmentsDone && std::none_of( activeSegments.begin(), activeSegments.end(), [&]( std::pair< pid_t const, int > const & active ){ return active.second > 0 && active.second < numSegments; } ) ) {
+			laterSegmentsDone = true;
+			bool const laterSegmentsOK = std::all_of( segments.begin() + 1, segments.begin() + numSegments, []( SegmentRun const & later ){ return later.status == EXIT_SUCCESS; } );
+			char const message( laterSegmentsOK ? '1' : '0' );
+			if ( write( pipeEnds[ 1 ], &message, 1 ) != 1 ) DisplayString( "ERROR: Could not signal the first segment." );
+			close( pipeEnds[ 1 ] );
+		}
+	}
+	if ( ! laterSegmentsDone ) close( pipeEnds[ 1 ] );
+#else
+	// A segment process cannot be started from the state of this process, so each segment is
+	// started as a separate program; the later segments run first for the first segment to merge
+	std::vector< int > order;
+	for ( int seg = 1; seg < numSegments; ++seg ) order.push_back( seg );
+	order.push_back( 0 );
+	if ( compareSerial ) order.push_back( numSegments );
+	DisplayString( "EnergyPlus Segments: segments are simulated one at a time on this platform" );
+	for ( int const seg : order ) {
+		SegmentRun & segment( segments[ seg ] );
+		if ( seg == 0 && std::any_of( segments.begin() + 1, segments.begin() + numSegments, []( SegmentRun const & later ){ return later.status != EXIT_SUCCESS; } ) ) continue;
+		makeDirectory( segment.directory );
+		segment.startTime = std::chrono::steady_clock::now();
+		std::vector< std::string > const args( segmentArgs( seg ) );
+		std::string command( "\"" + getAbsolutePath( getProgramPath() ) + "\"" );
+		for ( auto arg = args.begin() + 1; arg != args.end(); ++arg ) command += " \"" + *arg + "\"";
+		// cmd.exe strips the outer quotes of a command line that starts with a quote
+		segment.status = ( systemCall( "\"" + command + "\"" ) == 0 ? EXIT_SUCCESS : EXIT_FAILURE );
+		segment.elapsedSeconds = std::chrono::duration< double >( std::chrono::steady_clock::now() - segment.startTime ).count();
+	}
+#endif
+
+	double const elapsedSeconds = std::chrono::duration< double >( std::chrono::steady_clock::now() - startTime ).count();
+
+	int numFailed = 0;
+	double segmentSeconds = 0.0;
+	std::ofstream summaryFile( outputDirectory + "eplusseg.csv" );
+	summaryFile << "Segment,Directory,Exit Status,Elapsed Time {s}\n";
+	for ( int seg = 0; seg < int( segments.size() ); ++seg ) {
+		SegmentRun const & segment( segments[ seg ] );
+		std::string const segmentName( seg < numSegments ? std::to_string( seg + 1 ) : "Serial" );
+		if ( segment.status != EXIT_SUCCESS ) {
+			++numFailed;
+			DisplayString( "EnergyPlus Segments: " + ( seg < numSegments ? "segment " + segmentName : "serial run" ) + " failed, see " + segment.directory );
+		}
+		if ( seg < numSegments ) segmentSeconds += segment.elapsedSeconds;
+		summaryFile << segmentName << ',' << segment.directory << ',' << segment.status << ',' << segment.elapsedSeconds << '\n';
+	}
+	if ( numFailed > 0 ) return EXIT_FAILURE;
+
+	std::vector< std::string > segmentEsoFileNames;
+	std::vector< std::string > segmentMtrFileNames;
+	std::vector< std::string > segmentSegFileNames;
+	for ( int seg = 0; seg < numSegments; ++seg ) {
+		segmentEsoFileNames.push_back( segments[ seg ].directory + getFileName( esoFileName ) );
+		segmentMtrFileNames.push_back( segments[ seg ].directory + getFileName( mtrFileName ) );
+		segmentSegFileNames.push_back( segments[ seg ].directory + getFileName( segFileName ) );
+	}
+	bool const merged = MergeSegmentOutputs( segmentEsoFileNames, esoFileName ) && MergeSegmentOutputs( segmentMtrFileNames, mtrFileName );
+	// The first segment wrote the tabular reports and the SQLite output of the whole run period
+	for ( auto const & reportFileName : reportFileNames ) {
+		std::string const segmentReportFileName( segments[ 0 ].directory + getFileName( reportFileName ) );
+		if ( fileExists( segmentReportFileName ) ) moveFile( segmentReportFileName, reportFileName );
+	}
+
+	summaryFile << '\n';
+	std::string const serialSegFileName( compareSerial ? segments.back().directory + getFileName( segFileName ) : "" );
+	Real64 const maxDifference = CompareSegmentBoundaries( segmentSegFileNames, serialSegFileName, summaryFile );
+	Real64 maxSerialDifference = -1.0;
+	if ( compareSerial && merged ) {
+		summaryFile << '\n';
+		maxSerialDifference = CompareSerialOutput( esoFileName, segments.back().directory + getFileName( esoFileName ), summaryFile );
+	}
+	summaryFile.close();
+
+	DisplayString( "EnergyPlus Segments: elapsed time " + std::to_string( elapsedSeconds ) + " s, sum of segment times " + std::to_string( segmentSeconds ) + " s" );
+	if ( compareSerial ) {
+		DisplayString( "EnergyPlus Segments: serial run time " + std::to_string( segments.back().elapsedSeconds ) + " s" );
+	}
+	if ( maxDifference >= 0.0 ) {
+		DisplayString( "EnergyPlus Segments: largest temperature difference at a segment boundary " + std::to_string( maxDifference ) + " C" );
+	}
+	if ( maxSerialDifference >= 0.0 ) {
+		DisplayString( "EnergyPlus Segments: largest difference of the merged output from the serial run " + std::to_string( 100.0 * maxSerialDifference ) + " % of the largest value of the output variable, see eplusseg.csv" );
+	}
+
+	return ( merged ? EXIT_SUCCESS : EXIT_FAILURE );
+}
+
+std::string
+SegmentFileName(
+	std::string const & fileName, // Output file of this segment
+	int const segNum // Segment of interest
+)
+{
+
+	// FUNCTION INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2016
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS FUNCTION:
+	// Returns the name of an output file of another segment of the split simulation.
+
+	// METHODOLOGY EMPLOYED:
+	// The segment directories are next to each other under the output directory.
+
+	std::string const outputDirectory( getParentDirectoryPath( getParentDirectoryPath( getAbsolutePath( fileName ) ) ) );
+	return outputDirectory + "segment-" + std::to_string( segNum ) + pathChar + getFileName( fileName );
+}
+
+bool
+WaitForLaterSegments()
+{
+
+	// FUNCTION INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2016
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS FUNCTION:
+	// Waits in the first segment of a split simulation until the later segments have
+	// completed.  Returns false if one of them failed.
+
+	// METHODOLOGY EMPLOYED:
+	// RunSegments writes to a pipe once the later segments have exited.  Without the pipe the
+	// later segments were simulated before the first one.
+
+#ifndef _WIN32
+	if ( laterSegmentsPipe < 0 ) return true;
+	char message( '0' );
+	bool const received = ( read( laterSegmentsPipe, &message, 1 ) == 1 );
+	close( laterSegmentsPipe );
+	laterSegmentsPipe = -1;
+	return received && message == '1';
+#else
+	return true;
+#endif
+}
+
+bool
+MergeSegmentOutputs(
+	std::vector< std::string > const & segmentFileNames, // Standard or meter output of each segment, in order
+	std::string const & mergedFileName // Merged output
+)
+{
+
+	// FUNCTION INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2016
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS FUNCTION:
+	// Merges the standard (or meter) output files of the segments of a split simulation into
+	// the file a serial simulation writes.  Returns false if a file could not be read.
+
+	// METHODOLOGY EMPLOYED:
+	// The data dictionary of the first segment is used.  The data are grouped by environment
+	// stamp: an environment that later segments also simulated is followed by the records of
+	// that environment from each later segment, in order.  Records of the run period
+	// frequency cover only one segment, so they are left out for the split environments.
+
+	std::vector< std::ifstream > segmentFiles;
+	for ( auto const & fileName : segmentFileNames ) {
+		segmentFiles.emplace_back( fileName, std::ios::binary );
+		if ( ! segmentFiles.back() ) {
+			DisplayString( "ERROR: Could not open segment output file: " + fileName + "." );
+			return false;
+		}
+	}
+	std::ofstream mergedFile( mergedFileName, std::ios::binary );
+
+	auto const readLine = []( std::ifstream & file, std::string & line ) -> bool {
+		if ( ! std::getline( file, line ) ) return false;
+		if ( ! line.empty() && line.back() == '\r' ) line.pop_back();
+		return true;
+	};
+	auto const recordId = []( std::string const & line ) -> int {
+		std::string::size_type const comma = line.find( ',' );
+		if ( comma == 0 || comma == std::string::npos || line.find_first_not_of( "0123456789" ) != comma ) return 0;
+		return std::stoi( line.substr( 0, comma ) );
+	};
+
+	// The data dictionary names the environment and time stamps
+	int environmentStampId = 0;
+	int runPeriodStampId = 0;
+	std::vector< int > stampIds;
+	std::string line;
+	bool const firstLine = readLine( segmentFiles[ 0 ], line );
+	if ( firstLine ) mergedFile << line << '\n'; // program version
+	while ( readLine( segmentFiles[ 0 ], line ) ) {
+		mergedFile << line << '\n';
+		if ( line == "End of Data Dictionary" ) break;
+		int const id = recordId( line );
+		if ( line.find( "Environment Title" ) != std::string::npos ) {
+			environmentStampId = id;
+		} else if ( line.find( "Day of Simulation" ) != std::string::npos || line.find( "Days of Simulation" ) != std::string::npos ) {
+			stampIds.push_back( id );
+			if ( line.find( "Run Period" ) != std::string::npos ) runPeriodStampId = id;
+		}
+	}
+
+	// Where the data of each environment start and end in the later segments
+	struct EnvironmentData {
+		std::ifstream::pos_type begin; // First record after the environment stamp
+		std::ifstream::pos_type end; // Next environment stamp or end of data
+	};
+	std::vector< std::map< std::string, EnvironmentData > > segmentEnvironments( segmentFiles.size() );
+	auto const environmentTitle = []( std::string const & line ) {
+		std::string::size_type const comma = line.find( ',' );
+		return line.substr( comma + 1, line.find( ',', comma + 1 ) - comma - 1 );
+	};
+	for ( std::size_t seg = 1; seg < segmentFiles.size(); ++seg ) {
+		std::ifstream & file( segmentFiles[ seg ] );
+		while ( readLine( file, line ) && line != "End of Data Dictionary" ) {}
+		std::string title;
+		std::ifstream::pos_type lineStart = file.tellg();
+		while ( readLine( file, line ) ) {
+			bool const endOfData = ( line == "End of Data" );
+			if ( endOfData || recordId( line ) == environmentStampId ) {
+				if ( ! title.empty() ) segmentEnvironments[ seg ][ title ].end = lineStart;
+				if ( endOfData ) break;
+				title = environmentTitle( line );
+				segmentEnvironments[ seg ][ title ].begin = file.tellg();
+			}
+			lineStart = file.tellg();
+		}
+		file.clear();
+	}
+
+	// Copies records of a split environment, leaving out the run period records
+	bool inRunPeriod = false;
+	auto const copyRecord = [&]( std::string const & record ) {
+		int const id = recordId( record );
+		if ( id == runPeriodStampId ) {
+			inRunPeriod = true;
+		} else if ( std::find( stampIds.begin(), stampIds.end(), id ) != stampIds.end() ) {
+			inRunPeriod = false;
+		}
+		if ( ! inRunPeriod ) mergedFile << record << '\n';
+	};
+	auto const appendLaterSegments = [&]( std::string const & title ) {
+		for ( std::size_t seg = 1; seg < segmentFiles.size(); ++seg ) {
+			auto const found = segmentEnvironments[ seg ].find( title );
+			if ( found == segmentEnvironments[ seg ].end() ) continue;
+			std::ifstream & file( segmentFiles[ seg ] );
+			file.seekg( found->second.begin );
+			inRunPeriod = false;
+			std::string record;
+			while ( file.tellg() < found->second.end && readLine( file, record ) ) copyRecord( record );
+		}
+	};
+	auto const isSplit = [&]( std::string const & title ) {
+		for ( std::size_t seg = 1; seg < segmentFiles.size(); ++seg ) {
+			if ( segmentEnvironments[ seg ].count( title ) > 0 ) return true;
+		}
+		return false;
+	};
+
+	std::string title;
+	bool split = false;
+	while ( readLine( segmentFiles[ 0 ], line ) ) {
+		bool const endOfData = ( line == "End of Data" );
+		if ( endOfData || recordId( line ) == environmentStampId ) {
+			if ( split ) appendLaterSegments( title );
+			if ( endOfData ) break;
+			title = environmentTitle( line );
+			split = isSplit( title );
+			inRunPeriod = false;
+			mergedFile << line << '\n';
+		} else if ( split ) {
+			copyRecord( line );
+		} else {
+			mergedFile << line << '\n';
+		}
+	}
+	mergedFile << "End of Data" << '\n';
+
+	return true;
+}
+
+Real64
+CompareSegmentBoundaries(
+	std::vector< std::string > const & segmentFileNames, // Boundary states of each segment, in order
+	std::string const & serialFileName, // Boundary states of the serial reference run (empty if none)
+	std::ostream & reportFile // Report of the differences at each boundary
+)
+{
+
+	// FUNCTION INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2016
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS FUNCTION:
+	// Reports, for each segment boundary, the largest differences between the temperatures at
+	// the end of a segment and those the next segment reached at the end of its overlap days,
+	// and, with a serial reference run, the differences of both from the serial temperatures.
+	// Returns the largest difference between neighbouring segments, or -1 if no boundary could
+	// be compared.
+
+	// METHODOLOGY EMPLOYED:
+	// The difference between neighbouring segments shows how well the overlap days settled the
+	// state of the later segment.  Only the serial reference run shows the error of the split:
+	// a serial simulation continues from its own state at the end of the earlier segment.
+
+	struct BoundaryState {
+		int dayOfSim = 0;
+		std::vector< Real64 > zoneAirTemp;
+		std::vector< Real64 > surfaceInsideTemp;
+	};
+	typedef std::map< std::string, BoundaryState > StateMap; // By environment name
+	typedef std::map< std::string, std::map< int, BoundaryState > > SerialStateMap; // By environment name and day
+
+	std::vector< StateMap > startStates( segmentFileNames.size() );
+	std::vector< StateMap > endStates( segmentFileNames.size() );
+	SerialStateMap serialStates;
+	auto const readStates = [&]( std::string const & fileName, StateMap * start, StateMap * end ) {
+		std::ifstream file( fileName );
+		std::string line;
+		while ( std::getline( file, line ) ) {
+			if ( line.compare( 0, 9, "Boundary," ) != 0 ) continue;
+			std::vector< std::string > fields;
+			std::string::size_type pos = 0;
+			while ( pos != std::string::npos ) {
+				std::string::size_type const comma = line.find( ',', pos );
+				fields.push_back( line.substr( pos, comma == std::string::npos ? std::string::npos : comma - pos ) );
+				pos = ( comma == std::string::npos ? comma : comma + 1 );
+			}
+			if ( fields.size() != 6u ) continue;
+			int const dayOfSim = std::stoi( fields[ 3 ] );
+			BoundaryState & state( fields[ 1 ] == "Serial" ? serialStates[ fields[ 2 ] ][ dayOfSim ] : fields[ 1 ] == "Start" ? ( *start )[ fields[ 2 ] ] : ( *end )[ fields[ 2 ] ] );
+			state.dayOfSim = dayOfSim;
+			state.zoneAirTemp.resize( std::stoi( fields[ 4 ] ) );
+			state.surfaceInsideTemp.resize( std::stoi( fields[ 5 ] ) );
+			for ( auto & temp : state.zoneAirTemp ) file >> temp;
+			for ( auto & temp : state.surfaceInsideTemp ) file >> temp;
+		}
+	};
+	for ( std::size_t seg = 0; seg < segmentFileNames.size(); ++seg ) {
+		readStates( segmentFileNames[ seg ], &startStates[ seg ], &endStates[ seg ] );
+	}
+	if ( ! serialFileName.empty() ) readStates( serialFileName, nullptr, nullptr );
+
+	auto const maxDifference = []( std::vector< Real64 > const & a, std::vector< Real64 > const & b ) {
+		Real64 difference = 0.0;
+		for ( std::size_t i = 0; i < std::min( a.size(), b.size() ); ++i ) {
+			difference = std::max( difference, std::abs( a[ i ] - b[ i ] ) );
+		}
+		return difference;
+	};
+	auto const reportDifferences = [&]( BoundaryState const & a, BoundaryState const & b ) {
+		reportFile << ',' << maxDifference( a.zoneAirTemp, b.zoneAirTemp ) << ',' << maxDifference( a.surfaceInsideTemp, b.surfaceInsideTemp );
+	};
+
+	Real64 largestDifference = -1.0;
+	reportFile << "Environment,Last Day Before Boundary,Max Zone Air Temperature Difference {C},Max Inside Surface Temperature Difference {C}";
+	if ( ! serialFileName.empty() ) {
+		reportFile << ",End of Segment Max Zone Air Temperature Error {C},End of Segment Max Inside Surface Temperature Error {C}";
+		reportFile << ",Start of Next Segment Max Zone Air Temperature Error {C},Start of Next Segment Max Inside Surface Temperature Error {C}";
+	}
+	reportFile << '\n';
+	for ( std::size_t seg = 0; seg + 1 < segmentFileNames.size(); ++seg ) {
+		for ( auto const & end : endStates[ seg ] ) {
+			reportFile << end.first << ',' << end.second.dayOfSim;
+			auto const start = startStates[ seg + 1 ].find( end.first );
+			bool const overlap = ( start != startStates[ seg + 1 ].end() && start->second.dayOfSim == end.second.dayOfSim );
+			if ( overlap ) {
+				reportDifferences( end.second, start->second );
+				largestDifference = std::max( largestDifference, maxDifference( end.second.zoneAirTemp, start->second.zoneAirTemp ) );
+				largestDifference = std::max( largestDifference, maxDifference( end.second.surfaceInsideTemp, start->second.surfaceInsideTemp ) );
+			} else {
+				reportFile << ",,"; // no overlap days to compare
+			}
+			if ( ! serialFileName.empty() ) {
+				auto const serialEnvironment = serialStates.find( end.first );
+				auto const serial = ( serialEnvironment != serialStates.end() ? serialEnvironment->second.find( end.second.dayOfSim ) : std::map< int, BoundaryState >::const_iterator() );
+				if ( serialEnvironment != serialStates.end() && serial != serialEnvironment->second.end() ) {
+					reportDifferences( end.second, serial->second );
+					if ( overlap ) {
+						reportDifferences( start->second, serial->second );
+					} else {
+						reportFile << ",,";
+					}
+				} else {
+					reportFile << ",,,,";
+				}
+			}
+			reportFile << '\n';
+		}
+	}
+	return largestDifference;
+}
+
+Real64
+CompareSerialOutput(
+	std::string const & mergedFileName, // Merged standard output of the segments
+	std::string const & serialFileName, // Standard output of the serial reference run
+	std::ostream & reportFile // Report of the largest difference of each output variable
+)
+{
+
+	// FUNCTION INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2016
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS FUNCTION:
+	// Reports the largest difference of each output variable of the merged standard output from
+	// the standard output of the serial reference run.  Returns the largest difference relative
+	// to the largest magnitude of its variable in the serial run, or -1 if the outputs could not
+	// be compared.
+
+	// METHODOLOGY EMPLOYED:
+	// Both outputs have the same data dictionary and, apart from the run period records the
+	// merged output leaves out, the same records in the same order.  The first value of each
+	// record, which is the value reported at the end of its interval, is compared.
+
+	std::ifstream mergedFile( mergedFileName, std::ios::binary );
+	std::ifstream serialFile( serialFileName, std::ios::binary );
+	if ( ! mergedFile || ! serialFile ) {
+		DisplayString( "ERROR: Could not open " + mergedFileName + " or " + serialFileName + " to compare the outputs." );
+		return -1.0;
+	}
+
+	auto const readLine = []( std::ifstream & file, std::string & line ) -> bool {
+		if ( ! std::getline( file, line ) ) return false;
+		if ( ! line.empty() && line.back() == '\r' ) line.pop_back();
+		return true;
+	};
+	auto const recordId = []( std::string const & line ) -> int {
+		std::string::size_type const comma = line.find( ',' );
+		if ( comma == 0 || comma == std::string::npos || line.find_first_not_of( "0123456789" ) != comma ) return 0;
+		return std::stoi( line.substr( 0, comma ) );
+	};
+
+	// Names of the output variables and ids of the environment and time stamps
+	std::map< int, std::string > variableNames;
+	int environmentStampId = 0;
+	int runPeriodStampId = 0;
+	std::vector< int > stampIds;
+	std::string line;
+	while ( readLine( serialFile, line ) && line != "End of Data Dictionary" ) {
+		int const id = recordId( line );
+		if ( id == 0 ) continue;
+		if ( line.find( "Environment Title" ) != std::string::npos ) {
+			environmentStampId = id;
+		} else if ( line.find( "Day of Simulation" ) != std::string::npos || line.find( "Days of Simulation" ) != std::string::npos ) {
+			stampIds.push_back( id );
+			if ( line.find( "Run Period" ) != std::string::npos ) runPeriodStampId = id;
+		} else {
+			std::string::size_type const comma = line.find( ',', line.find( ',' ) + 1 );
+			variableNames[ id ] = ( comma == std::string::npos ? line : line.substr( comma + 1 ) );
+		}
+	}
+	while ( readLine( mergedFile, line ) && line != "End of Data Dictionary" ) {}
+
+	// Next record, leaving out the run period records
+	auto const nextRecord = [&]( std::ifstream & file, bool & inRunPeriod, std::string & record ) -> bool {
+		while ( readLine( file, record ) && record != "End of Data" ) {
+			int const id = recordId( record );
+			if ( id == runPeriodStampId ) {
+				inRunPeriod = true;
+			} else if ( id == environmentStampId || std::find( stampIds.begin(), stampIds.end(), id ) != stampIds.end() ) {
+				inRunPeriod = false;
+			}
+			if ( ! inRunPeriod ) return true;
+		}
+		return false;
+	};
+	auto const recordValue = []( std::string const & record ) {
+		return std::strtod( record.c_str() + record.find( ',' ) + 1, nullptr );
+	};
+
+	struct VariableDifference {
+		Real64 maxDifference = 0.0; // Largest difference from the serial run
+		Real64 maxSerialValue = 0.0; // Largest magnitude in the serial run
+	};
+	std::map< int, VariableDifference > differences;
+	bool mergedInRunPeriod = false;
+	bool serialInRunPeriod = false;
+	std::string mergedRecord;
+	std::string serialRecord;
+	while ( nextRecord( serialFile, serialInRunPeriod, serialRecord ) ) {
+		if ( ! nextRecord( mergedFile, mergedInRunPeriod, mergedRecord ) || recordId( mergedRecord ) != recordId( serialRecord ) ) {
+			DisplayString( "ERROR: The records of " + mergedFileName + " do not match those of " + serialFileName + "." );
+			return -1.0;
+		}
+		auto const name = variableNames.find( recordId( serialRecord ) );
+		if ( name == variableNames.end() ) continue; // stamps
+		Real64 const serialValue = recordValue( serialRecord );
+		VariableDifference & difference( differences[ name->first ] );
+		difference.maxDifference = std::max( difference.maxDifference, std::abs( recordValue( mergedRecord ) - serialValue ) );
+		difference.maxSerialValue = std::max( difference.maxSerialValue, std::abs( serialValue ) );
+	}
+
+	Real64 largestDifference = 0.0;
+	reportFile << "Output Variable,Max Difference from Serial Run,Max Magnitude in Serial Run,Max Relative Difference\n";
+	for ( auto const & difference : differences ) {
+		if ( difference.second.maxDifference == 0.0 ) continue;
+		reportFile << variableNames[ difference.first ] << ',' << difference.second.maxDifference << ',' << difference.second.maxSerialValue << ',';
+		if ( difference.second.maxSerialValue > 0.0 ) {
+			Real64 const relativeDifference = difference.second.maxDifference / difference.second.maxSerialValue;
+			reportFile << relativeDifference;
+			largestDifference = std::max( largestDifference, relativeDifference );
+		}
+		reportFile << '\n';
+	}
+	return largestDifference;
+}
+
 //Fix This is Fortranic code that needs to be brought up to C++ style
 //     All the index and len and strip should be eliminated and replaced by string calls only where needed
 //     I/o with std::string should not be pulling in trailing blanks so stripping should not be needed, etc.
@@ -621,8 +1559,8 @@ ReadINIFile(
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	static std::string LINE;
-	static std::string LINEOut;
+	std::string LINE;
+	std::string LINEOut;
 	std::string Param;
 	std::string::size_type ILB;
 	std::string::size_type IRB;
@@ -59,7 +59,10 @@
 #ifndef CommandLineInterface_hh_INCLUDED
 #define CommandLineInterface_hh_INCLUDED
 
+#include <ostream>
 #include <string>
+#include <vector>
+#include <EnergyPlus.hh>
 #include <EnergyPlusAPI.hh>
 
 namespace EnergyPlus{
@@ -70,6 +73,66 @@ namespace CommandLineInterface {
  int
  ENERGYPLUSLIB_API ProcessArgs( int argc, const char * argv[] );
 
+ // Simulate each input file listed in a batch file, returns the exit status
+ int
+ RunBatch(
+ 	std::string const & batchFileName, // File listing the input files, one per line
+ 	int const numJobs, // Maximum number of runs simulated at the same time
+ 	std::string const & outputDirectory, // Directory holding the run directories (blank for current directory)
+ 	std::vector< std::string > const & runArgs // Command line for each run, without the input file
+ );
+
+ // Command line passed on to runs started from this process, without the input file
+ std::vector< std::string >
+ RunArguments(
+ 	std::vector< std::string > const & arguments, // Expanded command line of this process
+ 	std::vector< std::string > const & droppedOptions // Options (with their values) not passed on
+ );
+
+ // Simulate the weather file run periods split into segments at the same time, returns the exit status
+ int
+ RunSegments(
+ 	int const numSegments, // Number of segments the weather file run periods are split into
+ 	int const overlapDays, // Days simulated ahead of each segment to settle its initial state
+ 	bool const compareSerial, // Also simulate the run periods serially and compare the outputs
+ 	std::string const & outputDirectory, // Directory holding the segment directories and the merged output
+ 	std::vector< std::string > const & runArgs // Command line for each segment
+ );
+
+ // Name of an output file of another segment of the split simulation
+ std::string
+ SegmentFileName(
+ 	std::string const & fileName, // Output file of this segment
+ 	int const segNum // Segment of interest
+ );
+
+ // Wait in the first segment until the later segments have completed, returns false if one of them failed
+ bool
+ WaitForLaterSegments();
+
+ // Merge the standard or meter output files of the segments, returns false if a file could not be read
+ bool
+ MergeSegmentOutputs(
+ 	std::vector< std::string > const & segmentFileNames, // Standard or meter output of each segment, in order
+ 	std::string const & mergedFileName // Merged output
+ );
+
+ // Report the temperature differences at the segment boundaries, returns the largest one between segments
+ Real64
+ CompareSegmentBoundaries(
+ 	std::vector< std::string > const & segmentFileNames, // Boundary states of each segment, in order
+ 	std::string const & serialFileName, // Boundary states of the serial reference run (empty if none)
+ 	std::ostream & reportFile // Report of the differences at each boundary
+ );
+
+ // Report the differences of the merged standard output from the serial run, returns the largest relative one
+ Real64
+ CompareSerialOutput(
+ 	std::string const & mergedFileName, // Merged standard output of the segments
+ 	std::string const & serialFileName, // Standard output of the serial reference run
+ 	std::ostream & reportFile // Report of the largest difference of each output variable
+ );
+
  void
  ReadINIFile(
  	int const UnitNumber, // Unit number of the opened INI file
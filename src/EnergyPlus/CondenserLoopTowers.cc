@@ -220,6 +220,42 @@ namespace CondenserLoopTowers {
 	// Beginning of CondenserLoopTowers Module Driver Subroutines
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false ); // Logical flag set .TRUE. if errors found while getting input data
+		bool InitTowerErrorsFound( false ); // Flag if input data errors are found
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool OneTimeFlagForEachTower;
+		int NumCellMin( 0 );
+		int NumCellMax( 0 );
+		int NumCellOn( 0 );
+		int SpeedSel( 0 );
+		int CalcTwoSpeedTowerNumCellMin( 0 );
+		int CalcTwoSpeedTowerNumCellMax( 0 );
+		int CalcTwoSpeedTowerNumCellOn( 0 );
+		Real64 TimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
+		Real64 CurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
+		int CalcVariableSpeedTowerNumCellMin( 0 );
+		int CalcVariableSpeedTowerNumCellMax( 0 );
+		int CalcVariableSpeedTowerNumCellOn( 0 );
+		Real64 PctAirFlow( 0.0 ); // air flow rate ratio (fan power ratio in the case of CoolTools model)
+		Real64 FlowFactor( 0.0 ); // water flow rate to air flow rate ratio (L/G) for YorkCalc model
+		std::string OutputChar; // character string for warning messages
+		std::string OutputCharLo; // character string for warning messages
+		std::string OutputCharHi; // character string for warning messages
+		std::string TrimValue; // character string for warning messages
+		Real64 CheckModelBoundsTimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
+		Real64 CurrentEndTime( 0.0 ); // end time of time step for current simulation time step
+		Real64 CheckModelBoundsCurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
+		Real64 BlowDownVdot( 0.0 );
+		Real64 DriftVdot( 0.0 );
+		Real64 EvapVdot( 0.0 );
+	}
+
 	// Functions
 	void
 	clear_state()
@@ -243,6 +279,34 @@ namespace CondenserLoopTowers {
 		SimpleTowerInlet.deallocate();
 		SimpleTowerReport.deallocate();
 		VSTower.deallocate();
+		ErrorsFound = false;
+		InitTowerErrorsFound = false;
+		MyEnvrnFlag.deallocate();
+		OneTimeFlagForEachTower.deallocate();
+		NumCellMin = 0;
+		NumCellMax = 0;
+		NumCellOn = 0;
+		SpeedSel = 0;
+		CalcTwoSpeedTowerNumCellMin = 0;
+		CalcTwoSpeedTowerNumCellMax = 0;
+		CalcTwoSpeedTowerNumCellOn = 0;
+		TimeStepSysLast = 0.0;
+		CurrentEndTimeLast = 0.0;
+		CalcVariableSpeedTowerNumCellMin = 0;
+		CalcVariableSpeedTowerNumCellMax = 0;
+		CalcVariableSpeedTowerNumCellOn = 0;
+		PctAirFlow = 0.0;
+		FlowFactor = 0.0;
+		OutputChar.clear();
+		OutputCharLo.clear();
+		OutputCharHi.clear();
+		TrimValue.clear();
+		CheckModelBoundsTimeStepSysLast = 0.0;
+		CurrentEndTime = 0.0;
+		CheckModelBoundsCurrentEndTimeLast = 0.0;
+		BlowDownVdot = 0.0;
+		DriftVdot = 0.0;
+		EvapVdot = 0.0;
 	}
 
 	void
@@ -493,7 +557,6 @@ namespace CondenserLoopTowers {
 		int CoeffNum; // Index for reading user defined VS tower coefficients
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
-		static bool ErrorsFound( false ); // Logical flag set .TRUE. if errors found while getting input data
 		std::string OutputChar; // report variable for warning messages
 		std::string OutputCharLo; // report variable for warning messages
 		std::string OutputCharHi; // report variable for warning messages
@@ -2187,10 +2250,7 @@ namespace CondenserLoopTowers {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false ); // Flag if input data errors are found
 
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool OneTimeFlagForEachTower;
 		//  LOGICAL                                 :: FatalError
 		int TypeOf_Num( 0 );
 		int LoopNum;
@@ -2225,8 +2285,8 @@ namespace CondenserLoopTowers {
 			}
 
 			// Locate the tower on the plant loops for later usage
-			ScanPlantLoopsForObject( SimpleTower( TowerNum ).Name, TypeOf_Num, SimpleTower( TowerNum ).LoopNum, SimpleTower( TowerNum ).LoopSideNum, SimpleTower( TowerNum ).BranchNum, SimpleTower( TowerNum ).CompNum, _, _, _, _, _, ErrorsFound );
-			if ( ErrorsFound ) {
+			ScanPlantLoopsForObject( SimpleTower( TowerNum ).Name, TypeOf_Num, SimpleTower( TowerNum ).LoopNum, SimpleTower( TowerNum ).LoopSideNum, SimpleTower( TowerNum ).BranchNum, SimpleTower( TowerNum ).CompNum, _, _, _, _, _, InitTowerErrorsFound );
+			if ( InitTowerErrorsFound ) {
 				ShowFatalError( "InitTower: Program terminated due to previous condition(s)." );
 			}
 
@@ -2554,7 +2614,7 @@ namespace CondenserLoopTowers {
 					SimpleTowerInlet( TowerNum ).AirPress = StdBaroPress;
 					SimpleTowerInlet( TowerNum ).AirHumRat = PsyWFnTdbTwbPb( SimpleTowerInlet( TowerNum ).AirTemp, SimpleTowerInlet( TowerNum ).AirWetBulb, SimpleTowerInlet( TowerNum ).AirPress );
 					//        SimpleTowerInlet(TowerNum)%AirHumRat = PsyWFnTdbTwbPb(35.,25.6,StdBaroPress)
-					SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleTowerUAResidual, UA0, UA1, Par );
+					SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleTowerUAResidual, UA0, UA1, Par, "SizeTower" );
 					if ( SolFla == -1 ) {
 						ShowSevereError( "Iteration limit exceeded in calculating tower UA" );
 						ShowFatalError( "Autosizing of cooling tower UA failed for tower " + SimpleTower( TowerNum ).Name );
@@ -2620,7 +2680,7 @@ namespace CondenserLoopTowers {
 				SimpleTowerInlet( TowerNum ).AirPress = StdBaroPress;
 				SimpleTowerInlet( TowerNum ).AirHumRat = PsyWFnTdbTwbPb( SimpleTowerInlet( TowerNum ).AirTemp, SimpleTowerInlet( TowerNum ).AirWetBulb, SimpleTowerInlet( TowerNum ).AirPress );
 				//      SimpleTowerInlet(TowerNum)%AirHumRat = PsyWFnTdbTwbPb(35.,25.6,StdBaroPress)
-				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleTowerUAResidual, UA0, UA1, Par );
+				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleTowerUAResidual, UA0, UA1, Par, "SizeTower" );
 				if ( SolFla == -1 ) {
 					ShowSevereError( "Iteration limit exceeded in calculating tower UA" );
 					ShowFatalError( "Autosizing of cooling tower UA failed for tower " + SimpleTower( TowerNum ).Name );
@@ -2749,7 +2809,7 @@ namespace CondenserLoopTowers {
 				SimpleTowerInlet( TowerNum ).AirWetBulb = 25.6; // 78F design inlet air wet-bulb temp
 				SimpleTowerInlet( TowerNum ).AirPress = StdBaroPress;
 				SimpleTowerInlet( TowerNum ).AirHumRat = PsyWFnTdbTwbPb( SimpleTowerInlet( TowerNum ).AirTemp, SimpleTowerInlet( TowerNum ).AirWetBulb, SimpleTowerInlet( TowerNum ).AirPress );
-				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleTowerUAResidual, UA0, UA1, Par );
+				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleTowerUAResidual, UA0, UA1, Par, "SizeTower" );
 				if ( SolFla == -1 ) {
 					ShowSevereError( "Iteration limit exceeded in calculating tower UA" );
 					ShowFatalError( "Autosizing of cooling tower UA failed for tower " + SimpleTower( TowerNum ).Name );
@@ -2820,7 +2880,7 @@ namespace CondenserLoopTowers {
 				SimpleTowerInlet( TowerNum ).AirWetBulb = 25.6; // 78F design inlet air wet-bulb temp
 				SimpleTowerInlet( TowerNum ).AirPress = StdBaroPress;
 				SimpleTowerInlet( TowerNum ).AirHumRat = PsyWFnTdbTwbPb( SimpleTowerInlet( TowerNum ).AirTemp, SimpleTowerInlet( TowerNum ).AirWetBulb, SimpleTowerInlet( TowerNum ).AirPress );
-				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleTowerUAResidual, UA0, UA1, Par );
+				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleTowerUAResidual, UA0, UA1, Par, "SizeTower" );
 				if ( SolFla == -1 ) {
 					ShowSevereError( "Iteration limit exceeded in calculating tower UA" );
 					ShowFatalError( "Autosizing of cooling tower UA failed for tower " + SimpleTower( TowerNum ).Name );
@@ -2898,7 +2958,7 @@ namespace CondenserLoopTowers {
 			}
 
 			if ( ModelCalibrated ) {
-				SolveRegulaFalsi( Acc, MaxIte, SolFla, WaterFlowRatio, SimpleTowerApproachResidual, constant_pointfive, MaxWaterFlowRateRatio, Par );
+				SolveRegulaFalsi( Acc, MaxIte, SolFla, WaterFlowRatio, SimpleTowerApproachResidual, constant_pointfive, MaxWaterFlowRateRatio, Par, "SizeTower" );
 				if ( SolFla == -1 ) {
 					ShowSevereError( "Iteration limit exceeded in calculating tower water flow ratio during calibration" );
 					ShowContinueError( "Inlet air wet-bulb, range, and/or approach temperature does not allow calibration of water flow rate ratio for this variable-speed cooling tower." );
@@ -3204,7 +3264,7 @@ namespace CondenserLoopTowers {
 				SimpleTowerInlet( TowerNum ).AirWetBulb = 25.6;
 				SimpleTowerInlet( TowerNum ).AirPress = StdBaroPress;
 				SimpleTowerInlet( TowerNum ).AirHumRat = PsyWFnTdbTwbPb( SimpleTowerInlet( TowerNum ).AirTemp, SimpleTowerInlet( TowerNum ).AirWetBulb, SimpleTowerInlet( TowerNum ).AirPress );
-				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleTowerUAResidual, UA0, UA1, Par );
+				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleTowerUAResidual, UA0, UA1, Par, "SizeVSMerkelTower" );
 				if ( SolFla == -1 ) {
 					ShowSevereError( "Iteration limit exceeded in calculating tower UA" );
 					ShowFatalError( "calculating cooling tower UA failed for tower " + SimpleTower( TowerNum ).Name );
@@ -3235,7 +3295,7 @@ namespace CondenserLoopTowers {
 				SimpleTowerInlet( TowerNum ).AirWetBulb = 25.6;
 				SimpleTowerInlet( TowerNum ).AirPress = StdBaroPress;
 				SimpleTowerInlet( TowerNum ).AirHumRat = PsyWFnTdbTwbPb( SimpleTowerInlet( TowerNum ).AirTemp, SimpleTowerInlet( TowerNum ).AirWetBulb, SimpleTowerInlet( TowerNum ).AirPress );
-				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleTowerUAResidual, UA0, UA1, Par );
+				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleTowerUAResidual, UA0, UA1, Par, "SizeVSMerkelTower" );
 				if ( SolFla == -1 ) {
 					ShowSevereError( "Iteration limit exceeded in calculating tower free convection UA" );
 					ShowFatalError( "calculating cooling tower UA failed for tower " + SimpleTower( TowerNum ).Name );
@@ -3389,7 +3449,7 @@ namespace CondenserLoopTowers {
 					SimpleTowerInlet( TowerNum ).AirWetBulb = 25.6;
 					SimpleTowerInlet( TowerNum ).AirPress = StdBaroPress;
 					SimpleTowerInlet( TowerNum ).AirHumRat = PsyWFnTdbTwbPb( SimpleTowerInlet( TowerNum ).AirTemp, SimpleTowerInlet( TowerNum ).AirWetBulb, SimpleTowerInlet( TowerNum ).AirPress );
-					SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleTowerUAResidual, UA0, UA1, Par );
+					SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleTowerUAResidual, UA0, UA1, Par, "SizeVSMerkelTower" );
 					if ( SolFla == -1 ) {
 						ShowSevereError( "Iteration limit exceeded in calculating tower UA" );
 						ShowFatalError( "calculating cooling tower UA failed for tower " + SimpleTower( TowerNum ).Name );
@@ -3419,7 +3479,7 @@ namespace CondenserLoopTowers {
 					SimpleTowerInlet( TowerNum ).AirWetBulb = 25.6;
 					SimpleTowerInlet( TowerNum ).AirPress = StdBaroPress;
 					SimpleTowerInlet( TowerNum ).AirHumRat = PsyWFnTdbTwbPb( SimpleTowerInlet( TowerNum ).AirTemp, SimpleTowerInlet( TowerNum ).AirWetBulb, SimpleTowerInlet( TowerNum ).AirPress );
-					SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleTowerUAResidual, UA0, UA1, Par );
+					SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleTowerUAResidual, UA0, UA1, Par, "SizeVSMerkelTower" );
 					if ( SolFla == -1 ) {
 						ShowSevereError( "Iteration limit exceeded in calculating tower free convection UA" );
 						ShowFatalError( "calculating cooling tower UA failed for tower " + SimpleTower( TowerNum ).Name );
@@ -3707,9 +3767,6 @@ namespace CondenserLoopTowers {
 		//Added variables for multicell
 		Real64 WaterMassFlowRatePerCellMin;
 		Real64 WaterMassFlowRatePerCellMax;
-		static int NumCellMin( 0 );
-		static int NumCellMax( 0 );
-		static int NumCellOn( 0 );
 		Real64 WaterMassFlowRatePerCell;
 		bool IncrNumCellFlag; // determine if yes or no we increase the number of cells
 
@@ -4017,14 +4074,10 @@ namespace CondenserLoopTowers {
 		int LoopNum;
 		int LoopSideNum;
 
-		static int SpeedSel( 0 );
 
 		//Added variables for multicell
 		Real64 WaterMassFlowRatePerCellMin;
 		Real64 WaterMassFlowRatePerCellMax;
-		static int NumCellMin( 0 );
-		static int NumCellMax( 0 );
-		static int NumCellOn( 0 );
 		Real64 WaterMassFlowRatePerCell;
 		bool IncrNumCellFlag; // determine if yes or no we increase the number of cells
 
@@ -4066,22 +4119,22 @@ namespace CondenserLoopTowers {
 			WaterMassFlowRatePerCellMax = SimpleTower( TowerNum ).DesWaterMassFlowRate * SimpleTower( TowerNum ).MaxFracFlowRate / SimpleTower( TowerNum ).NumCell;
 
 			//round it up to the nearest integer
-			NumCellMin = min( int( ( WaterMassFlowRate / WaterMassFlowRatePerCellMax ) + 0.9999 ), SimpleTower( TowerNum ).NumCell );
-			NumCellMax = min( int( ( WaterMassFlowRate / WaterMassFlowRatePerCellMin ) + 0.9999 ), SimpleTower( TowerNum ).NumCell );
+			CalcTwoSpeedTowerNumCellMin = min( int( ( WaterMassFlowRate / WaterMassFlowRatePerCellMax ) + 0.9999 ), SimpleTower( TowerNum ).NumCell );
+			CalcTwoSpeedTowerNumCellMax = min( int( ( WaterMassFlowRate / WaterMassFlowRatePerCellMin ) + 0.9999 ), SimpleTower( TowerNum ).NumCell );
 		}
 
 		// cap min at 1
-		if ( NumCellMin <= 0 ) NumCellMin = 1;
-		if ( NumCellMax <= 0 ) NumCellMax = 1;
+		if ( CalcTwoSpeedTowerNumCellMin <= 0 ) CalcTwoSpeedTowerNumCellMin = 1;
+		if ( CalcTwoSpeedTowerNumCellMax <= 0 ) CalcTwoSpeedTowerNumCellMax = 1;
 
 		if ( SimpleTower( TowerNum ).CellCtrl_Num == CellCtrl_MinCell ) {
-			NumCellOn = NumCellMin;
+			CalcTwoSpeedTowerNumCellOn = CalcTwoSpeedTowerNumCellMin;
 		} else {
-			NumCellOn = NumCellMax;
+			CalcTwoSpeedTowerNumCellOn = CalcTwoSpeedTowerNumCellMax;
 		}
 
-		SimpleTower( TowerNum ).NumCellOn = NumCellOn;
-		WaterMassFlowRatePerCell = WaterMassFlowRate / NumCellOn;
+		SimpleTower( TowerNum ).NumCellOn = CalcTwoSpeedTowerNumCellOn;
+		WaterMassFlowRatePerCell = WaterMassFlowRate / CalcTwoSpeedTowerNumCellOn;
 
 		IncrNumCellFlag = true;
 
@@ -4109,7 +4162,7 @@ namespace CondenserLoopTowers {
 				//     Setpoint was not met (or free conv. not used),turn on cooling tower 1st stage fan
 				UAdesign = SimpleTower( TowerNum ).LowSpeedTowerUA / SimpleTower( TowerNum ).NumCell;
 				AirFlowRate = SimpleTower( TowerNum ).LowSpeedAirFlowRate / SimpleTower( TowerNum ).NumCell;
-				FanPowerLow = SimpleTower( TowerNum ).LowSpeedFanPower * NumCellOn / SimpleTower( TowerNum ).NumCell;
+				FanPowerLow = SimpleTower( TowerNum ).LowSpeedFanPower * CalcTwoSpeedTowerNumCellOn / SimpleTower( TowerNum ).NumCell;
 
 				SimSimpleTower( TowerNum, WaterMassFlowRatePerCell, AirFlowRate, UAdesign, OutletWaterTemp1stStage );
 
@@ -4124,7 +4177,7 @@ namespace CondenserLoopTowers {
 					//         Setpoint was not met, turn on cooling tower 2nd stage fan
 					UAdesign = SimpleTower( TowerNum ).HighSpeedTowerUA / SimpleTower( TowerNum ).NumCell;
 					AirFlowRate = SimpleTower( TowerNum ).HighSpeedAirFlowRate / SimpleTower( TowerNum ).NumCell;
-					FanPowerHigh = SimpleTower( TowerNum ).HighSpeedFanPower * NumCellOn / SimpleTower( TowerNum ).NumCell;
+					FanPowerHigh = SimpleTower( TowerNum ).HighSpeedFanPower * CalcTwoSpeedTowerNumCellOn / SimpleTower( TowerNum ).NumCell;
 
 					SimSimpleTower( TowerNum, WaterMassFlowRatePerCell, AirFlowRate, UAdesign, OutletWaterTemp2ndStage );
 
@@ -4141,9 +4194,9 @@ namespace CondenserLoopTowers {
 						SpeedSel = 2;
 						FanModeFrac = 1.0;
 						// if possible increase the number of cells and do the calculations again with the new water mass flow rate per cell
-						if ( NumCellOn < SimpleTower( TowerNum ).NumCell && ( WaterMassFlowRate / ( NumCellOn + 1 ) ) >= WaterMassFlowRatePerCellMin ) {
-							++NumCellOn;
-							WaterMassFlowRatePerCell = WaterMassFlowRate / NumCellOn;
+						if ( CalcTwoSpeedTowerNumCellOn < SimpleTower( TowerNum ).NumCell && ( WaterMassFlowRate / ( CalcTwoSpeedTowerNumCellOn + 1 ) ) >= WaterMassFlowRatePerCellMin ) {
+							++CalcTwoSpeedTowerNumCellOn;
+							WaterMassFlowRatePerCell = WaterMassFlowRate / CalcTwoSpeedTowerNumCellOn;
 							IncrNumCellFlag = true;
 						}
 					}
@@ -4156,7 +4209,7 @@ namespace CondenserLoopTowers {
 		//output the fraction of the time step the fan is ON
 		FanCyclingRatio = FanModeFrac;
 		SimpleTower( TowerNum ).SpeedSelected = SpeedSel;
-		SimpleTower( TowerNum ).NumCellOn = NumCellOn;
+		SimpleTower( TowerNum ).NumCellOn = CalcTwoSpeedTowerNumCellOn;
 
 		CpWater = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, Node( WaterInletNode ).Temp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
 		Qactual = WaterMassFlowRate * CpWater * ( Node( WaterInletNode ).Temp - OutletWaterTemp );
@@ -4391,7 +4444,7 @@ namespace CondenserLoopTowers {
 			Par( 7 ) = CpWater;
 			Par( 8 ) = WaterMassFlowRate;
 
-			SolveRegulaFalsi( Acc, MaxIte, SolFla, AirFlowRateRatio, VSMerkelResidual, SimpleTower( TowerNum ).MinimumVSAirFlowFrac, 1.0, Par );
+			SolveRegulaFalsi( Acc, MaxIte, SolFla, AirFlowRateRatio, VSMerkelResidual, SimpleTower( TowerNum ).MinimumVSAirFlowFrac, 1.0, Par, "CalcMerkelVariableSpeedTower" );
 
 			if ( SolFla == -1 ) {
 				if ( ! WarmupFlag ) {
@@ -4624,18 +4677,13 @@ namespace CondenserLoopTowers {
 		std::string OutputChar3; // character string used for warning messages
 		std::string OutputChar4; // character string used for warning messages
 		std::string OutputChar5; // character string used for warning messages
-		static Real64 TimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
 		Real64 CurrentEndTime; // end time of time step for current simulation time step
-		static Real64 CurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
 		int LoopNum;
 		int LoopSideNum;
 
 		//Added variables for multicell
 		Real64 WaterMassFlowRatePerCellMin;
 		Real64 WaterMassFlowRatePerCellMax;
-		static int NumCellMin( 0 );
-		static int NumCellMax( 0 );
-		static int NumCellOn( 0 );
 		Real64 WaterMassFlowRatePerCell;
 		bool IncrNumCellFlag;
 
@@ -4645,22 +4693,22 @@ namespace CondenserLoopTowers {
 			WaterMassFlowRatePerCellMax = SimpleTower( TowerNum ).DesWaterMassFlowRate * SimpleTower( TowerNum ).MaxFracFlowRate / SimpleTower( TowerNum ).NumCell;
 
 			//round it up to the nearest integer
-			NumCellMin = min( int( ( WaterMassFlowRate / WaterMassFlowRatePerCellMax ) + 0.9999 ), SimpleTower( TowerNum ).NumCell );
-			NumCellMax = min( int( ( WaterMassFlowRate / WaterMassFlowRatePerCellMin ) + 0.9999 ), SimpleTower( TowerNum ).NumCell );
+			CalcVariableSpeedTowerNumCellMin = min( int( ( WaterMassFlowRate / WaterMassFlowRatePerCellMax ) + 0.9999 ), SimpleTower( TowerNum ).NumCell );
+			CalcVariableSpeedTowerNumCellMax = min( int( ( WaterMassFlowRate / WaterMassFlowRatePerCellMin ) + 0.9999 ), SimpleTower( TowerNum ).NumCell );
 		}
 
 		// cap min at 1
-		if ( NumCellMin <= 0 ) NumCellMin = 1;
-		if ( NumCellMax <= 0 ) NumCellMax = 1;
+		if ( CalcVariableSpeedTowerNumCellMin <= 0 ) CalcVariableSpeedTowerNumCellMin = 1;
+		if ( CalcVariableSpeedTowerNumCellMax <= 0 ) CalcVariableSpeedTowerNumCellMax = 1;
 
 		if ( SimpleTower( TowerNum ).CellCtrl_Num == CellCtrl_MinCell ) {
-			NumCellOn = NumCellMin;
+			CalcVariableSpeedTowerNumCellOn = CalcVariableSpeedTowerNumCellMin;
 		} else {
-			NumCellOn = NumCellMax;
+			CalcVariableSpeedTowerNumCellOn = CalcVariableSpeedTowerNumCellMax;
 		}
 
-		SimpleTower( TowerNum ).NumCellOn = NumCellOn;
-		WaterMassFlowRatePerCell = WaterMassFlowRate / NumCellOn;
+		SimpleTower( TowerNum ).NumCellOn = CalcVariableSpeedTowerNumCellOn;
+		WaterMassFlowRatePerCell = WaterMassFlowRate / CalcVariableSpeedTowerNumCellOn;
 
 		// Set inlet and outlet nodes and initialize subroutine variables
 
@@ -4721,12 +4769,12 @@ namespace CondenserLoopTowers {
 			if ( OutletWaterTempON > TempSetPoint ) {
 				FanCyclingRatio = 1.0;
 				AirFlowRateRatio = 1.0;
-				CTFanPower = SimpleTower( TowerNum ).HighSpeedFanPower * NumCellOn / SimpleTower( TowerNum ).NumCell;
+				CTFanPower = SimpleTower( TowerNum ).HighSpeedFanPower * CalcVariableSpeedTowerNumCellOn / SimpleTower( TowerNum ).NumCell;
 				OutletWaterTemp = OutletWaterTempON;
 				// if possible increase the number of cells and do the calculations again with the new water mass flow rate per cell
-				if ( NumCellOn < SimpleTower( TowerNum ).NumCell && ( WaterMassFlowRate / ( NumCellOn + 1 ) ) > WaterMassFlowRatePerCellMin ) {
-					++NumCellOn;
-					WaterMassFlowRatePerCell = WaterMassFlowRate / NumCellOn;
+				if ( CalcVariableSpeedTowerNumCellOn < SimpleTower( TowerNum ).NumCell && ( WaterMassFlowRate / ( CalcVariableSpeedTowerNumCellOn + 1 ) ) > WaterMassFlowRatePerCellMin ) {
+					++CalcVariableSpeedTowerNumCellOn;
+					WaterMassFlowRatePerCell = WaterMassFlowRate / CalcVariableSpeedTowerNumCellOn;
 					IncrNumCellFlag = true;
 				}
 			}
@@ -4754,10 +4802,10 @@ namespace CondenserLoopTowers {
 				if ( OutletWaterTempMIN < TempSetPoint ) {
 					//         if setpoint was exceeded, cycle the fan at minimum air flow to meet the setpoint temperature
 					if ( SimpleTower( TowerNum ).FanPowerfAirFlowCurve == 0 ) {
-						CTFanPower = pow_3( AirFlowRateRatio ) * SimpleTower( TowerNum ).HighSpeedFanPower * NumCellOn / SimpleTower( TowerNum ).NumCell;
+						CTFanPower = pow_3( AirFlowRateRatio ) * SimpleTower( TowerNum ).HighSpeedFanPower * CalcVariableSpeedTowerNumCellOn / SimpleTower( TowerNum ).NumCell;
 					} else {
 						FanCurveValue = CurveValue( SimpleTower( TowerNum ).FanPowerfAirFlowCurve, AirFlowRateRatio );
-						CTFanPower = max( 0.0, ( SimpleTower( TowerNum ).HighSpeedFanPower * FanCurveValue ) ) * NumCellOn / SimpleTower( TowerNum ).NumCell;
+						CTFanPower = max( 0.0, ( SimpleTower( TowerNum ).HighSpeedFanPower * FanCurveValue ) ) * CalcVariableSpeedTowerNumCellOn / SimpleTower( TowerNum ).NumCell;
 					}
 					//       fan is cycling ON and OFF at the minimum fan speed. Adjust fan power and air flow rate ratio according to cycling rate
 					FanCyclingRatio = ( ( OutletWaterTempOFF - TempSetPoint ) / ( OutletWaterTempOFF - OutletWaterTempMIN ) );
@@ -4784,7 +4832,7 @@ namespace CondenserLoopTowers {
 					Par( 5 ) = Ta; // desired approach temperature [C]
 					Par( 6 ) = 1.0; // calculate the air flow rate ratio required for a balance
 
-					SolveRegulaFalsi( Acc, MaxIte, SolFla, AirFlowRateRatio, SimpleTowerApproachResidual, SimpleTower( TowerNum ).MinimumVSAirFlowFrac, 1.0, Par );
+					SolveRegulaFalsi( Acc, MaxIte, SolFla, AirFlowRateRatio, SimpleTowerApproachResidual, SimpleTower( TowerNum ).MinimumVSAirFlowFrac, 1.0, Par, "CalcVariableSpeedTower" );
 					if ( SolFla == -1 ) {
 						if ( ! WarmupFlag ) ShowWarningError( "Cooling tower iteration limit exceeded when calculating air flow rate ratio for tower " + SimpleTower( TowerNum ).Name );
 						//           IF RegulaFalsi cannot find a solution then provide detailed output for debugging
@@ -4810,10 +4858,10 @@ namespace CondenserLoopTowers {
 
 					//         Use theoretical cubic for deterination of fan power if user has not specified a fan power ratio curve
 					if ( SimpleTower( TowerNum ).FanPowerfAirFlowCurve == 0 ) {
-						CTFanPower = pow_3( AirFlowRateRatio ) * SimpleTower( TowerNum ).HighSpeedFanPower * NumCellOn / SimpleTower( TowerNum ).NumCell;
+						CTFanPower = pow_3( AirFlowRateRatio ) * SimpleTower( TowerNum ).HighSpeedFanPower * CalcVariableSpeedTowerNumCellOn / SimpleTower( TowerNum ).NumCell;
 					} else {
 						FanCurveValue = CurveValue( SimpleTower( TowerNum ).FanPowerfAirFlowCurve, AirFlowRateRatio );
-						CTFanPower = max( 0.0, ( SimpleTower( TowerNum ).HighSpeedFanPower * FanCurveValue ) ) * NumCellOn / SimpleTower( TowerNum ).NumCell;
+						CTFanPower = max( 0.0, ( SimpleTower( TowerNum ).HighSpeedFanPower * FanCurveValue ) ) * CalcVariableSpeedTowerNumCellOn / SimpleTower( TowerNum ).NumCell;
 					}
 					//           outlet water temperature is calculated as the inlet air wet-bulb temperature plus tower approach temperature
 					OutletWaterTemp = Twb + Ta;
@@ -4824,7 +4872,7 @@ namespace CondenserLoopTowers {
 
 		CpWater = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, Node( SimpleTower( TowerNum ).WaterInletNodeNum ).Temp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
 		Qactual = WaterMassFlowRate * CpWater * ( Node( WaterInletNode ).Temp - OutletWaterTemp );
-		SimpleTower( TowerNum ).NumCellOn = NumCellOn;
+		SimpleTower( TowerNum ).NumCellOn = CalcVariableSpeedTowerNumCellOn;
 		// Set water and air properties
 		AirDensity = PsyRhoAirFnPbTdbW( SimpleTowerInlet( TowerNum ).AirPress, SimpleTowerInlet( TowerNum ).AirTemp, SimpleTowerInlet( TowerNum ).AirHumRat );
 		AirMassFlowRate = AirFlowRateRatio * SimpleTower( TowerNum ).HighSpeedAirFlowRate * AirDensity * SimpleTower( TowerNum ).NumCellOn / SimpleTower( TowerNum ).NumCell;
@@ -5085,7 +5133,7 @@ namespace CondenserLoopTowers {
 		Par( 2 ) = WaterFlowRateRatio; // water flow rate ratio
 		Par( 3 ) = AirFlowRateRatio; // air flow rate ratio
 		Par( 4 ) = Twb; // inlet air wet-bulb temperature [C]
-		SolveRegulaFalsi( Acc, MaxIte, SolFla, Tr, SimpleTowerTrResidual, 0.001, VSTower( SimpleTower( TowerNum ).VSTower ).MaxRangeTemp, Par );
+		SolveRegulaFalsi( Acc, MaxIte, SolFla, Tr, SimpleTowerTrResidual, 0.001, VSTower( SimpleTower( TowerNum ).VSTower ).MaxRangeTemp, Par, "SimVariableTower" );
 
 		OutletWaterTemp = SimpleTowerInlet( TowerNum ).WaterTemp - Tr;
 
@@ -5151,8 +5199,6 @@ namespace CondenserLoopTowers {
 		//    REAL(r64)        :: Twb                       ! Inlet air wet-bulb temperature [C] (or [F] for CoolTools Model)
 		//    REAL(r64)        :: Tr                        ! Cooling tower range (outlet water temp minus inlet air wet-bulb temp) [C]
 		//   (or [F] for CoolTools Model)
-		static Real64 PctAirFlow( 0.0 ); // air flow rate ratio (fan power ratio in the case of CoolTools model)
-		static Real64 FlowFactor( 0.0 ); // water flow rate to air flow rate ratio (L/G) for YorkCalc model
 
 		//    IF(SimpleTower(TowerNum)%TowerModelType .EQ. CoolToolsXFModel .OR. &
 		//        SimpleTower(TowerNum)%TowerModelType .EQ. CoolToolsCFModel .OR. &
@@ -5245,13 +5291,6 @@ namespace CondenserLoopTowers {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static std::string OutputChar; // character string for warning messages
-		static std::string OutputCharLo; // character string for warning messages
-		static std::string OutputCharHi; // character string for warning messages
-		static std::string TrimValue; // character string for warning messages
-		static Real64 TimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
-		static Real64 CurrentEndTime( 0.0 ); // end time of time step for current simulation time step
-		static Real64 CurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
 		// current end time is compared with last to see if time step changed
 
 		//   initialize capped variables in case independent variables are in bounds
@@ -5267,7 +5306,7 @@ namespace CondenserLoopTowers {
 		//   Wait for next time step to print warnings. If simulation iterates, print out
 		//   the warning for the last iteration only. Must wait for next time step to accomplish this.
 		//   If a warning occurs and the simulation down shifts, the warning is not valid.
-		if ( CurrentEndTime > CurrentEndTimeLast && TimeStepSys >= TimeStepSysLast ) {
+		if ( CurrentEndTime > CheckModelBoundsCurrentEndTimeLast && TimeStepSys >= CheckModelBoundsTimeStepSysLast ) {
 			if ( VSTower( SimpleTower( TowerNum ).VSTower ).PrintTrMessage ) {
 				++VSTower( SimpleTower( TowerNum ).VSTower ).VSErrorCountTR;
 				if ( VSTower( SimpleTower( TowerNum ).VSTower ).VSErrorCountTR < 2 ) {
@@ -5317,8 +5356,8 @@ namespace CondenserLoopTowers {
 		}
 
 		//   save last system time step and last end time of current time step (used to determine if warning is valid)
-		TimeStepSysLast = TimeStepSys;
-		CurrentEndTimeLast = CurrentEndTime;
+		CheckModelBoundsTimeStepSysLast = TimeStepSys;
+		CheckModelBoundsCurrentEndTimeLast = CurrentEndTime;
 
 		//   check boundaries of independent variables and post warnings to individual buffers to print at end of time step
 		if ( Twb < VSTower( SimpleTower( TowerNum ).VSTower ).MinInletAirWBTemp || Twb > VSTower( SimpleTower( TowerNum ).VSTower ).MaxInletAirWBTemp ) {
@@ -5674,9 +5713,6 @@ namespace CondenserLoopTowers {
 		Real64 AirDensity;
 		Real64 AirMassFlowRate;
 		Real64 AvailTankVdot;
-		static Real64 BlowDownVdot( 0.0 );
-		static Real64 DriftVdot( 0.0 );
-		static Real64 EvapVdot( 0.0 );
 		Real64 InletAirEnthalpy;
 		Real64 InSpecificHumRat;
 		Real64 OutSpecificHumRat;
@@ -162,8 +162,41 @@ namespace ConductionTransferFunctionCalc {
 
 	// MODULE SUBROUTINES:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false ); // Flag for input error condition
+	}
+
 	// Functions
 
+	// Clears the global data in ConductionTransferFunctionCalc.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		AExp.deallocate();
+		AInv.deallocate();
+		AMat.deallocate();
+		BMat = Array1D< Real64 >( 3 );
+		CMat = Array1D< Real64 >( 2 );
+		DMat = Array1D< Real64 >( 2 );
+		e.deallocate();
+		Gamma1.deallocate();
+		Gamma2.deallocate();
+		NodeSource = 0;
+		NodeUserTemp = 0;
+		rcmax = 0;
+		s.deallocate();
+		s0 = Array2D< Real64 >( 3, 4 );
+		TinyLimit = 0.0;
+		IdenMatrix.deallocate();
+		ErrorsFound = false;
+	}
+
 	void
 	InitConductionTransferFunctions()
 	{
@@ -290,7 +323,6 @@ namespace ConductionTransferFunctionCalc {
 		Real64 dxtmp; // Intermediate calculation variable ( = 1/dx/cap)
 		Real64 dyn; // Nodal spacing in the direction perpendicular to the main direction
 		// of heat transfer (only valid for a 2-D solution)
-		static bool ErrorsFound( false ); // Flag for input error condition
 		int HistTerm; // Loop counter
 		int ipts1; // Intermediate calculation for number of nodes per layer
 		int ir; // Loop control for constructing Identity Matrix
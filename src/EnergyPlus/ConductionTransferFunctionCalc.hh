@@ -114,6 +114,11 @@ namespace ConductionTransferFunctionCalc {
 
 	// Functions
 
+	// Clears the global data in ConductionTransferFunctionCalc.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	InitConductionTransferFunctions();
 
@@ -63,14 +63,14 @@
 
 namespace EnergyPlus {
 
-	std::string configured_source_directory()
+	inline std::string configured_source_directory()
 	{
 		return ("${CMAKE_SOURCE_DIR}");
 	}
 
-	std::string configured_build_directory()
+	inline std::string configured_build_directory()
 	{
-		return ("${CMAKE_BUILD_DIR}");
+		return ("${CMAKE_BINARY_DIR}");
 	}
 
 }
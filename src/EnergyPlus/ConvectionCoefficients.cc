@@ -255,8 +255,150 @@ namespace ConvectionCoefficients {
 	Array1D< HcOutsideFaceUserCurveStruct > HcOutsideUserCurve;
 	RoofGeoCharactisticsStruct RoofGeo;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool NodeCheck( true ); // for CeilingDiffuser Zones
+		bool ActiveSurfaceCheck( true ); // for radiant surfaces in zone
+		bool MyEnvirnFlag( true );
+		bool ErrorsFound( false );
+		bool errFlag( false );
+		bool IsValidType( false );
+		bool FirstRoofSurf( true );
+		int ActiveWallCount( 0 );
+		Real64 ActiveWallArea( 0.0 );
+		int ActiveCeilingCount( 0 );
+		Real64 ActiveCeilingArea( 0.0 );
+		int ActiveFloorCount( 0 );
+		Real64 ActiveFloorArea( 0.0 );
+		Real64 Hf( 0.0 ); // the forced, or wind driven portion of film coefficient
+		Real64 Hn( 0.0 ); // the natural, or bouyancy driven portion of film coefficient
+		Real64 DynamicExtConvSurfaceClassificationDeltaTemp( 0.0 );
+		int DynamicIntConvSurfaceClassificationZoneNum( 0 );
+		int PriorityEquipOn( 0 );
+		Array1D_int HeatingPriorityStack( {0,10}, 0 );
+		Array1D_int CoolingPriorityStack( {0,10}, 0 );
+		Array1D_int FlowRegimeStack( {0,10}, 0 );
+		int EquipNum( 0 );
+		int ZoneNode( 0 );
+		int EquipOnCount( 0 );
+		int EquipOnLoop( 0 );
+		int thisZoneInletNode( 0 );
+		int FinalFlowRegime( 0 );
+		Real64 Tmin( 0.0 ); // temporary min surf temp
+		Real64 Tmax( 0.0 ); // temporary max surf temp
+		Real64 GrH( 0.0 ); // Grashof number for zone height H
+		Real64 Re( 0.0 ); // Reynolds number for zone air system flow
+		Real64 Ri( 0.0 ); // Richardson Number, Gr/Re**2 for determining mixed regime
+		Real64 AirDensity( 0.0 ); // temporary zone air density
+		Real64 DynamicIntConvSurfaceClassificationDeltaTemp( 0.0 ); // temporary temperature difference (Tsurf - Tair)
+		int ErrorIndex( 0 );
+		int CalcAlamdariHammondStableHorizontalErrorIndex( 0 );
+		int CalcAlamdariHammondVerticalWallErrorIndex( 0 );
+		int CalcBeausoleilMorrisonMixedAssistedWallErrorIndex( 0 );
+		int CalcBeausoleilMorrisonMixedOpposingWallErrorIndex( 0 );
+		int ErrorIndex2( 0 );
+		int CalcBeausoleilMorrisonMixedStableFloorErrorIndex( 0 );
+		int CalcBeausoleilMorrisonMixedUnstableFloorErrorIndex( 0 );
+		int CalcBeausoleilMorrisonMixedStableCeilingErrorIndex( 0 );
+		int CalcBeausoleilMorrisonMixedUnstableCeilingErrorIndex( 0 );
+		Real64 RaH( 0.0 );
+		Real64 BetaFilm( 0.0 );
+		int CalcFohannoPolidoriVerticalWallErrorIndex( 0 );
+		int CalcGoldsteinNovoselacCeilingDiffuserWindowErrorIndex( 0 );
+		int CalcGoldsteinNovoselacCeilingDiffuserWindowErrorIndex2( 0 );
+		int CalcGoldsteinNovoselacCeilingDiffuserWallErrorIndex( 0 );
+		int CalcGoldsteinNovoselacCeilingDiffuserWallErrorIndex2( 0 );
+		int CalcGoldsteinNovoselacCeilingDiffuserFloorErrorIndex( 0 );
+		int CalcSparrowWindwardErrorIndex( 0 );
+		int CalcSparrowLeewardErrorIndex( 0 );
+		int CalcMitchellErrorIndex( 0 );
+		int CalcEmmelVerticalErrorIndex( 0 );
+		int CalcEmmelRoofErrorIndex( 0 );
+		int CalcClearRoofErrorIndex( 0 );
+	}
+
 	// Functions
 
+	// Clears the global data in ConvectionCoefficients.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		TotOutsideHcUserCurves = 0;
+		TotInsideHcUserCurves = 0;
+		GetUserSuppliedConvectionCoeffs = true;
+		ConvectionGeometryMetaDataSetup = false;
+		CubeRootOfOverallBuildingVolume = 0.0;
+		RoofLongAxisOutwardAzimuth = 0.0;
+		InsideFaceAdaptiveConvectionAlgo = InsideFaceAdaptiveConvAlgoStruct();
+		OutsideFaceAdaptiveConvectionAlgo = OutsideFaceAdpativeConvAlgoStruct();
+		HcInsideUserCurve.deallocate();
+		HcOutsideUserCurve.deallocate();
+		RoofGeo = RoofGeoCharactisticsStruct();
+		NodeCheck = true;
+		ActiveSurfaceCheck = true;
+		MyEnvirnFlag = true;
+		ErrorsFound = false;
+		errFlag = false;
+		IsValidType = false;
+		FirstRoofSurf = true;
+		ActiveWallCount = 0;
+		ActiveWallArea = 0.0;
+		ActiveCeilingCount = 0;
+		ActiveCeilingArea = 0.0;
+		ActiveFloorCount = 0;
+		ActiveFloorArea = 0.0;
+		Hf = 0.0;
+		Hn = 0.0;
+		DynamicExtConvSurfaceClassificationDeltaTemp = 0.0;
+		DynamicIntConvSurfaceClassificationZoneNum = 0;
+		PriorityEquipOn = 0;
+		HeatingPriorityStack = Array1D_int( {0,10}, 0 );
+		CoolingPriorityStack = Array1D_int( {0,10}, 0 );
+		FlowRegimeStack = Array1D_int( {0,10}, 0 );
+		EquipNum = 0;
+		ZoneNode = 0;
+		EquipOnCount = 0;
+		EquipOnLoop = 0;
+		thisZoneInletNode = 0;
+		FinalFlowRegime = 0;
+		Tmin = 0.0;
+		Tmax = 0.0;
+		GrH = 0.0;
+		Re = 0.0;
+		Ri = 0.0;
+		AirDensity = 0.0;
+		DynamicIntConvSurfaceClassificationDeltaTemp = 0.0;
+		ErrorIndex = 0;
+		CalcAlamdariHammondStableHorizontalErrorIndex = 0;
+		CalcAlamdariHammondVerticalWallErrorIndex = 0;
+		CalcBeausoleilMorrisonMixedAssistedWallErrorIndex = 0;
+		CalcBeausoleilMorrisonMixedOpposingWallErrorIndex = 0;
+		ErrorIndex2 = 0;
+		CalcBeausoleilMorrisonMixedStableFloorErrorIndex = 0;
+		CalcBeausoleilMorrisonMixedUnstableFloorErrorIndex = 0;
+		CalcBeausoleilMorrisonMixedStableCeilingErrorIndex = 0;
+		CalcBeausoleilMorrisonMixedUnstableCeilingErrorIndex = 0;
+		RaH = 0.0;
+		BetaFilm = 0.0;
+		CalcFohannoPolidoriVerticalWallErrorIndex = 0;
+		CalcGoldsteinNovoselacCeilingDiffuserWindowErrorIndex = 0;
+		CalcGoldsteinNovoselacCeilingDiffuserWindowErrorIndex2 = 0;
+		CalcGoldsteinNovoselacCeilingDiffuserWallErrorIndex = 0;
+		CalcGoldsteinNovoselacCeilingDiffuserWallErrorIndex2 = 0;
+		CalcGoldsteinNovoselacCeilingDiffuserFloorErrorIndex = 0;
+		CalcSparrowWindwardErrorIndex = 0;
+		CalcSparrowLeewardErrorIndex = 0;
+		CalcMitchellErrorIndex = 0;
+		CalcEmmelVerticalErrorIndex = 0;
+		CalcEmmelRoofErrorIndex = 0;
+		CalcClearRoofErrorIndex = 0;
+	}
+
 	void
 	InitInteriorConvectionCoeffs(
 		Array1S< Real64 > const SurfaceTemperatures, // Temperature of surfaces for evaluation of HcIn
@@ -321,9 +463,6 @@ namespace ConvectionCoefficients {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ZoneNum; // DO loop counter for zones
 		int SurfNum; // DO loop counter for surfaces in zone
-		static bool NodeCheck( true ); // for CeilingDiffuser Zones
-		static bool ActiveSurfaceCheck( true ); // for radiant surfaces in zone
-		static bool MyEnvirnFlag( true );
 
 		// FLOW:
 		if ( GetUserSuppliedConvectionCoeffs ) {
@@ -1186,9 +1325,6 @@ namespace ConvectionCoefficients {
 		int Count;
 		int Status;
 		int Found;
-		static bool ErrorsFound( false );
-		static bool errFlag( false );
-		static bool IsValidType( false );
 		int ExtValue;
 		int IntValue;
 		int Ptr;
@@ -4737,7 +4873,6 @@ namespace ConvectionCoefficients {
 		// DERIVED TYPE DEFINITIONS:
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool FirstRoofSurf( true );
 		int ZoneLoop;
 		int SurfLoop;
 		int VertLoop;
@@ -4821,14 +4956,14 @@ namespace ConvectionCoefficients {
 		Vector dummy1;
 		Vector dummy2;
 		Vector dummy3;
-		static FacadeGeoCharactisticsStruct NorthFacade( 332.5, 22.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 );
-		static FacadeGeoCharactisticsStruct NorthEastFacade( 22.5, 67.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 );
-		static FacadeGeoCharactisticsStruct EastFacade( 67.5, 112.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 );
-		static FacadeGeoCharactisticsStruct SouthEastFacade( 112.5, 157.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 );
-		static FacadeGeoCharactisticsStruct SouthFacade( 157.5, 202.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 );
-		static FacadeGeoCharactisticsStruct SouthWestFacade( 202.5, 247.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 );
-		static FacadeGeoCharactisticsStruct WestFacade( 247.5, 287.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 );
-		static FacadeGeoCharactisticsStruct NorthWestFacade( 287.5, 332.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 );
+		FacadeGeoCharactisticsStruct NorthFacade( 332.5, 22.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 );
+		FacadeGeoCharactisticsStruct NorthEastFacade( 22.5, 67.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 );
+		FacadeGeoCharactisticsStruct EastFacade( 67.5, 112.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 );
+		FacadeGeoCharactisticsStruct SouthEastFacade( 112.5, 157.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 );
+		FacadeGeoCharactisticsStruct SouthFacade( 157.5, 202.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 );
+		FacadeGeoCharactisticsStruct SouthWestFacade( 202.5, 247.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 );
+		FacadeGeoCharactisticsStruct WestFacade( 247.5, 287.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 );
+		FacadeGeoCharactisticsStruct NorthWestFacade( 287.5, 332.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 );
 
 		// Formats
 		static gio::Fmt Format_900( "('! <Surface Convection Parameters>, Surface Name, Outside Model Assignment, Outside Area [m2], ','Outside Perimeter [m], Outside Height [m], Inside Model Assignment, ','Inside Height [cm], Inside Perimeter Envelope [m], Inside Hydraulic Diameter [m], Window Wall Ratio [ ], ','Window Location [ ], Near Radiant [Yes/No], Has Active HVAC [Yes/No]')" );
@@ -5382,12 +5517,6 @@ namespace ConvectionCoefficients {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int ActiveWallCount( 0 );
-		static Real64 ActiveWallArea( 0.0 );
-		static int ActiveCeilingCount( 0 );
-		static Real64 ActiveCeilingArea( 0.0 );
-		static int ActiveFloorCount( 0 );
-		static Real64 ActiveFloorArea( 0.0 );
 		int ZoneLoop;
 		int SurfLoop;
 
@@ -5998,8 +6127,6 @@ namespace ConvectionCoefficients {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 Hf( 0.0 ); // the forced, or wind driven portion of film coefficient
-		static Real64 Hn( 0.0 ); // the natural, or bouyancy driven portion of film coefficient
 		int ConstructNum;
 		Real64 SurfWindSpeed;
 		Real64 HydraulicDiameter;
@@ -6196,11 +6323,10 @@ namespace ConvectionCoefficients {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 DeltaTemp( 0.0 );
 
 		if ( Surface( SurfNum ).Class == SurfaceClass_Roof ) {
-			DeltaTemp = TH( 1, 1, SurfNum ) - Surface( SurfNum ).OutDryBulbTemp;
-			if ( DeltaTemp < 0.0 ) {
+			DynamicExtConvSurfaceClassificationDeltaTemp = TH( 1, 1, SurfNum ) - Surface( SurfNum ).OutDryBulbTemp;
+			if ( DynamicExtConvSurfaceClassificationDeltaTemp < 0.0 ) {
 				Surface( SurfNum ).OutConvClassification = OutConvClass_RoofStable;
 			} else {
 				Surface( SurfNum ).OutConvClassification = OutConvClass_RoofUnstable;
@@ -6343,149 +6469,131 @@ namespace ConvectionCoefficients {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int ZoneNum( 0 );
-		static int PriorityEquipOn( 0 );
-		static Array1D_int HeatingPriorityStack( {0,10}, 0 );
-		static Array1D_int CoolingPriorityStack( {0,10}, 0 );
-		static Array1D_int FlowRegimeStack( {0,10}, 0 );
-		static int EquipNum( 0 );
-		static int ZoneNode( 0 );
-		static int EquipOnCount( 0 );
-		static int EquipOnLoop( 0 );
-		static int thisZoneInletNode( 0 );
 		//  INTEGER :: thisZnEqInletNode = 0
-		static int FinalFlowRegime( 0 );
-		static Real64 Tmin( 0.0 ); // temporary min surf temp
-		static Real64 Tmax( 0.0 ); // temporary max surf temp
-		static Real64 GrH( 0.0 ); // Grashof number for zone height H
-		static Real64 Re( 0.0 ); // Reynolds number for zone air system flow
-		static Real64 Ri( 0.0 ); // Richardson Number, Gr/Re**2 for determining mixed regime
-		static Real64 AirDensity( 0.0 ); // temporary zone air density
-		static Real64 DeltaTemp( 0.0 ); // temporary temperature difference (Tsurf - Tair)
 		int SurfLoop; // local for separate looping across surfaces in the zone that has SurfNum
 
 		EquipOnCount = 0;
-		ZoneNum = Surface( SurfNum ).Zone;
-		ZoneNode = Zone( ZoneNum ).SystemZoneNodeNumber;
+		DynamicIntConvSurfaceClassificationZoneNum = Surface( SurfNum ).Zone;
+		ZoneNode = Zone( DynamicIntConvSurfaceClassificationZoneNum ).SystemZoneNodeNumber;
 		FlowRegimeStack = 0;
 
 		//HVAC connections
-		if ( ! Zone( ZoneNum ).IsControlled ) { // no HVAC control
+		if ( ! Zone( DynamicIntConvSurfaceClassificationZoneNum ).IsControlled ) { // no HVAC control
 			FlowRegimeStack( 0 ) = InConvFlowRegime_A3;
 		} else { // is controlled, lets see by how and if that means is currently active
 
-			if ( ! ( ZoneEquipConfig( ZoneNum ).EquipListIndex > 0 ) ) {
+			if ( ! ( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex > 0 ) ) {
 				FlowRegimeStack( 0 ) = InConvFlowRegime_A3;
 			} else {
 
-				for ( EquipNum = 1; EquipNum <= ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).NumOfEquipTypes; ++EquipNum ) {
+				for ( EquipNum = 1; EquipNum <= ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).NumOfEquipTypes; ++EquipNum ) {
 
-					{ auto const SELECT_CASE_var( ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).EquipType_Num( EquipNum ) );
+					{ auto const SELECT_CASE_var( ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).EquipType_Num( EquipNum ) );
 
 					if ( ( SELECT_CASE_var == AirDistUnit_Num ) || ( SELECT_CASE_var == DirectAir_Num ) || ( SELECT_CASE_var == PurchasedAir_Num ) ) { // central air equipment
-						if ( ! ( allocated( ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).EquipData( EquipNum ).OutletNodeNums ) ) ) continue;
+						if ( ! ( allocated( ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).EquipData( EquipNum ).OutletNodeNums ) ) ) continue;
 						//get inlet node, not zone node if possible
-						thisZoneInletNode = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).EquipData( EquipNum ).OutletNodeNums( 1 );
+						thisZoneInletNode = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).EquipData( EquipNum ).OutletNodeNums( 1 );
 						if ( thisZoneInletNode > 0 ) {
 							if ( Node( thisZoneInletNode ).MassFlowRate > 0.0 ) {
 								EquipOnCount = min( EquipOnCount + 1, 10 );
 								FlowRegimeStack( EquipOnCount ) = InConvFlowRegime_C;
-								HeatingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).HeatingPriority( EquipNum );
-								CoolingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).CoolingPriority( EquipNum );
+								HeatingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).HeatingPriority( EquipNum );
+								CoolingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).CoolingPriority( EquipNum );
 							}
 						} else {
 							if ( Node( ZoneNode ).MassFlowRate > 0.0 ) {
 								EquipOnCount = min( EquipOnCount + 1, 10 );
 								FlowRegimeStack( EquipOnCount ) = InConvFlowRegime_C;
-								HeatingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).HeatingPriority( EquipNum );
-								CoolingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).CoolingPriority( EquipNum );
+								HeatingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).HeatingPriority( EquipNum );
+								CoolingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).CoolingPriority( EquipNum );
 							}
 						}
 					} else if ( ( SELECT_CASE_var == WindowAC_Num ) || ( SELECT_CASE_var == PkgTermHPAirToAir_Num ) || ( SELECT_CASE_var == PkgTermACAirToAir_Num ) || ( SELECT_CASE_var == ZoneDXDehumidifier_Num ) || ( SELECT_CASE_var == PkgTermHPWaterToAir_Num ) || ( SELECT_CASE_var == FanCoil4Pipe_Num ) || ( SELECT_CASE_var == UnitVentilator_Num ) || ( SELECT_CASE_var == UnitHeater_Num ) || ( SELECT_CASE_var == OutdoorAirUnit_Num ) ) {
-						if ( ! ( allocated( ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).EquipData( EquipNum ).OutletNodeNums ) ) ) continue;
-						thisZoneInletNode = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).EquipData( EquipNum ).OutletNodeNums( 1 );
+						if ( ! ( allocated( ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).EquipData( EquipNum ).OutletNodeNums ) ) ) continue;
+						thisZoneInletNode = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).EquipData( EquipNum ).OutletNodeNums( 1 );
 						if ( thisZoneInletNode > 0 ) {
 							if ( Node( thisZoneInletNode ).MassFlowRate > 0.0 ) {
 								EquipOnCount = min( EquipOnCount + 1, 10 );
 								FlowRegimeStack( EquipOnCount ) = InConvFlowRegime_D;
-								HeatingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).HeatingPriority( EquipNum );
-								CoolingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).CoolingPriority( EquipNum );
+								HeatingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).HeatingPriority( EquipNum );
+								CoolingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).CoolingPriority( EquipNum );
 							}
 						} else {
 							if ( Node( ZoneNode ).MassFlowRate > 0.0 ) {
 								EquipOnCount = min( EquipOnCount + 1, 10 );
 								FlowRegimeStack( EquipOnCount ) = InConvFlowRegime_D;
-								HeatingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).HeatingPriority( EquipNum );
-								CoolingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).CoolingPriority( EquipNum );
+								HeatingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).HeatingPriority( EquipNum );
+								CoolingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).CoolingPriority( EquipNum );
 							}
 						}
 					} else if ( ( SELECT_CASE_var == CoolingPanel_Num ) || ( SELECT_CASE_var == BBSteam_Num ) || ( SELECT_CASE_var == BBWaterConvective_Num ) || ( SELECT_CASE_var == BBElectricConvective_Num ) || ( SELECT_CASE_var == BBWater_Num ) ) {
 
-						if ( ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).EquipData( EquipNum ).ON ) {
+						if ( ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).EquipData( EquipNum ).ON ) {
 							EquipOnCount = min( EquipOnCount + 1, 10 );
 							FlowRegimeStack( EquipOnCount ) = InConvFlowRegime_B;
-							HeatingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).HeatingPriority( EquipNum );
-							CoolingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).CoolingPriority( EquipNum );
+							HeatingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).HeatingPriority( EquipNum );
+							CoolingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).CoolingPriority( EquipNum );
 						}
 					} else if ( ( SELECT_CASE_var == BBElectric_Num ) || ( SELECT_CASE_var == HiTempRadiant_Num ) ) {
-						if ( ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).EquipData( EquipNum ).ON ) {
+						if ( ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).EquipData( EquipNum ).ON ) {
 							EquipOnCount = min( EquipOnCount + 1, 10 );
 							FlowRegimeStack( EquipOnCount ) = InConvFlowRegime_B;
-							HeatingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).HeatingPriority( EquipNum );
-							CoolingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).CoolingPriority( EquipNum );
+							HeatingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).HeatingPriority( EquipNum );
+							CoolingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).CoolingPriority( EquipNum );
 						}
 					} else if ( ( SELECT_CASE_var == VentilatedSlab_Num ) || ( SELECT_CASE_var == LoTempRadiant_Num ) ) {
 
-						if ( ZoneEquipConfig( ZoneNum ).InFloorActiveElement ) {
-							for ( SurfLoop = Zone( ZoneNum ).SurfaceFirst; SurfLoop <= Zone( ZoneNum ).SurfaceLast; ++SurfLoop ) {
+						if ( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).InFloorActiveElement ) {
+							for ( SurfLoop = Zone( DynamicIntConvSurfaceClassificationZoneNum ).SurfaceFirst; SurfLoop <= Zone( DynamicIntConvSurfaceClassificationZoneNum ).SurfaceLast; ++SurfLoop ) {
 								if ( ! Surface( SurfLoop ).IntConvSurfHasActiveInIt ) continue;
 								if ( Surface( SurfLoop ).Class == SurfaceClass_Floor ) {
-									DeltaTemp = TH( 2, 1, SurfLoop ) - MAT( ZoneNum );
-									if ( DeltaTemp > ActiveDelTempThreshold ) { // assume heating with floor
+									DynamicIntConvSurfaceClassificationDeltaTemp = TH( 2, 1, SurfLoop ) - MAT( DynamicIntConvSurfaceClassificationZoneNum );
+									if ( DynamicIntConvSurfaceClassificationDeltaTemp > ActiveDelTempThreshold ) { // assume heating with floor
 										// system ON is not enough because floor surfaces can continue to heat because of thermal capacity
 										EquipOnCount = min( EquipOnCount + 1, 10 );
 										FlowRegimeStack( EquipOnCount ) = InConvFlowRegime_A1;
-										HeatingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).HeatingPriority( EquipNum );
-										CoolingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).CoolingPriority( EquipNum );
+										HeatingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).HeatingPriority( EquipNum );
+										CoolingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).CoolingPriority( EquipNum );
 										break;
 									}
 								}
 							}
 						}
 
-						if ( ZoneEquipConfig( ZoneNum ).InCeilingActiveElement ) {
-							for ( SurfLoop = Zone( ZoneNum ).SurfaceFirst; SurfLoop <= Zone( ZoneNum ).SurfaceLast; ++SurfLoop ) {
+						if ( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).InCeilingActiveElement ) {
+							for ( SurfLoop = Zone( DynamicIntConvSurfaceClassificationZoneNum ).SurfaceFirst; SurfLoop <= Zone( DynamicIntConvSurfaceClassificationZoneNum ).SurfaceLast; ++SurfLoop ) {
 								if ( ! Surface( SurfLoop ).IntConvSurfHasActiveInIt ) continue;
 								if ( Surface( SurfLoop ).Class == SurfaceClass_Roof ) {
-									DeltaTemp = TH( 2, 1, SurfLoop ) - MAT( ZoneNum );
-									if ( DeltaTemp < ActiveDelTempThreshold ) { // assume cooling with ceiling
+									DynamicIntConvSurfaceClassificationDeltaTemp = TH( 2, 1, SurfLoop ) - MAT( DynamicIntConvSurfaceClassificationZoneNum );
+									if ( DynamicIntConvSurfaceClassificationDeltaTemp < ActiveDelTempThreshold ) { // assume cooling with ceiling
 										// system ON is not enough because  surfaces can continue to cool because of thermal capacity
 										EquipOnCount = min( EquipOnCount + 1, 10 );
 										FlowRegimeStack( EquipOnCount ) = InConvFlowRegime_A1;
-										HeatingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).HeatingPriority( EquipNum );
-										CoolingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).CoolingPriority( EquipNum );
+										HeatingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).HeatingPriority( EquipNum );
+										CoolingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).CoolingPriority( EquipNum );
 										break;
 									}
 								}
 							}
 						}
 
-						if ( ZoneEquipConfig( ZoneNum ).InWallActiveElement ) {
-							for ( SurfLoop = Zone( ZoneNum ).SurfaceFirst; SurfLoop <= Zone( ZoneNum ).SurfaceLast; ++SurfLoop ) {
+						if ( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).InWallActiveElement ) {
+							for ( SurfLoop = Zone( DynamicIntConvSurfaceClassificationZoneNum ).SurfaceFirst; SurfLoop <= Zone( DynamicIntConvSurfaceClassificationZoneNum ).SurfaceLast; ++SurfLoop ) {
 								if ( ! Surface( SurfLoop ).IntConvSurfHasActiveInIt ) continue;
 								if ( Surface( SurfLoop ).Class == SurfaceClass_Wall || Surface( SurfLoop ).Class == SurfaceClass_Door ) {
-									DeltaTemp = TH( 2, 1, SurfLoop ) - MAT( ZoneNum );
-									if ( DeltaTemp > ActiveDelTempThreshold ) { // assume heating with wall panel
+									DynamicIntConvSurfaceClassificationDeltaTemp = TH( 2, 1, SurfLoop ) - MAT( DynamicIntConvSurfaceClassificationZoneNum );
+									if ( DynamicIntConvSurfaceClassificationDeltaTemp > ActiveDelTempThreshold ) { // assume heating with wall panel
 										// system ON is not enough because  surfaces can continue to heat because of thermal capacity
 										EquipOnCount = min( EquipOnCount + 1, 10 );
 										FlowRegimeStack( EquipOnCount ) = InConvFlowRegime_A2;
-										HeatingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).HeatingPriority( EquipNum );
-										CoolingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).CoolingPriority( EquipNum );
+										HeatingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).HeatingPriority( EquipNum );
+										CoolingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).CoolingPriority( EquipNum );
 									} else { // not heating, no special models wall cooling so use simple bouyancy
 										EquipOnCount = min( EquipOnCount + 1, 10 );
 										FlowRegimeStack( EquipOnCount ) = InConvFlowRegime_A3;
-										HeatingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).HeatingPriority( EquipNum );
-										CoolingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( ZoneNum ).EquipListIndex ).CoolingPriority( EquipNum );
+										HeatingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).HeatingPriority( EquipNum );
+										CoolingPriorityStack( EquipOnCount ) = ZoneEquipList( ZoneEquipConfig( DynamicIntConvSurfaceClassificationZoneNum ).EquipListIndex ).CoolingPriority( EquipNum );
 									}
 								}
 							}
@@ -6498,7 +6606,7 @@ namespace ConvectionCoefficients {
 
 		// now select which equipment type is dominant compared to all those that are ON
 		if ( EquipOnCount > 0 ) {
-			if ( SNLoadPredictedRate( ZoneNum ) >= 0.0 ) { // heating load
+			if ( SNLoadPredictedRate( DynamicIntConvSurfaceClassificationZoneNum ) >= 0.0 ) { // heating load
 				PriorityEquipOn = 1;
 				for ( EquipOnLoop = 1; EquipOnLoop <= EquipOnCount; ++EquipOnLoop ) {
 					//assume highest priority/first sim order is dominant for flow regime
@@ -6506,7 +6614,7 @@ namespace ConvectionCoefficients {
 						PriorityEquipOn = EquipOnLoop;
 					}
 				}
-			} else if ( SNLoadPredictedRate( ZoneNum ) < 0.0 ) { // cooling load
+			} else if ( SNLoadPredictedRate( DynamicIntConvSurfaceClassificationZoneNum ) < 0.0 ) { // cooling load
 				PriorityEquipOn = 1;
 				for ( EquipOnLoop = 1; EquipOnLoop <= EquipOnCount; ++EquipOnLoop ) {
 					//assume highest priority/first sim order is dominant for flow regime
@@ -6526,14 +6634,14 @@ namespace ConvectionCoefficients {
 
 			//Calculate Grashof, Reynolds, and Richardson numbers for the zone
 			//Grashof for zone air based on largest delta T between surfaces and zone height
-			Tmin = minval( TH( 2, 1, {Zone( ZoneNum ).SurfaceFirst,Zone( ZoneNum ).SurfaceLast} ) );
-			Tmax = maxval( TH( 2, 1, {Zone( ZoneNum ).SurfaceFirst,Zone( ZoneNum ).SurfaceLast} ) );
-			GrH = ( g * ( Tmax - Tmin ) * pow_3( Zone( ZoneNum ).CeilingHeight ) ) / ( ( MAT( ZoneNum ) + KelvinConv ) * pow_2( v ) );
+			Tmin = minval( TH( 2, 1, {Zone( DynamicIntConvSurfaceClassificationZoneNum ).SurfaceFirst,Zone( DynamicIntConvSurfaceClassificationZoneNum ).SurfaceLast} ) );
+			Tmax = maxval( TH( 2, 1, {Zone( DynamicIntConvSurfaceClassificationZoneNum ).SurfaceFirst,Zone( DynamicIntConvSurfaceClassificationZoneNum ).SurfaceLast} ) );
+			GrH = ( g * ( Tmax - Tmin ) * pow_3( Zone( DynamicIntConvSurfaceClassificationZoneNum ).CeilingHeight ) ) / ( ( MAT( DynamicIntConvSurfaceClassificationZoneNum ) + KelvinConv ) * pow_2( v ) );
 
 			// Reynolds number = Vdot supply / v * cube root of zone volume (Goldstein and Noveselac 2010)
 			if ( Node( ZoneNode ).MassFlowRate > 0.0 ) {
 				AirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, Node( ZoneNode ).Temp, PsyWFnTdpPb( Node( ZoneNode ).Temp, OutBaroPress ) );
-				Re = Node( ZoneNode ).MassFlowRate / ( v * AirDensity * std::pow( Zone( ZoneNum ).Volume, OneThird ) );
+				Re = Node( ZoneNode ).MassFlowRate / ( v * AirDensity * std::pow( Zone( DynamicIntConvSurfaceClassificationZoneNum ).Volume, OneThird ) );
 			} else {
 				Re = 0.0;
 			}
@@ -6557,19 +6665,19 @@ namespace ConvectionCoefficients {
 		{ auto const SELECT_CASE_var( FinalFlowRegime );
 
 		if ( SELECT_CASE_var == InConvFlowRegime_A1 ) {
-			DeltaTemp = TH( 2, 1, SurfNum ) - MAT( ZoneNum );
+			DynamicIntConvSurfaceClassificationDeltaTemp = TH( 2, 1, SurfNum ) - MAT( DynamicIntConvSurfaceClassificationZoneNum );
 			if ( Surface( SurfNum ).Class == SurfaceClass_Wall || Surface( SurfNum ).Class == SurfaceClass_Door ) {
 
 				if ( ( Surface( SurfNum ).Tilt > 85.0 ) && ( Surface( SurfNum ).Tilt < 95.0 ) ) { //vertical wall
 					Surface( SurfNum ).IntConvClassification = InConvClass_A1_VertWalls;
 				} else if ( Surface( SurfNum ).Tilt >= 95.0 ) { //tilted upwards
-					if ( DeltaTemp > 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A1_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A1_StableTilted;
 					}
 				} else if ( Surface( SurfNum ).Tilt <= 85.0 ) { //tilted downwards
-					if ( DeltaTemp < 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp < 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A1_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A1_StableTilted;
@@ -6580,13 +6688,13 @@ namespace ConvectionCoefficients {
 				if ( Surface( SurfNum ).IntConvSurfHasActiveInIt ) {
 					Surface( SurfNum ).IntConvClassification = InConvClass_A1_ChilledCeil;
 				} else if ( Surface( SurfNum ).Tilt < 5.0 ) {
-					if ( DeltaTemp < 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp < 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A1_UnstableHoriz;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A1_StableHoriz;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt >= 5.0 ) && ( ( Surface( SurfNum ).Tilt < 95.0 ) ) ) { //tilted downwards
-					if ( DeltaTemp < 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp < 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A1_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A1_StableTilted;
@@ -6594,7 +6702,7 @@ namespace ConvectionCoefficients {
 				} else if ( ( Surface( SurfNum ).Tilt > 85.0 ) && ( Surface( SurfNum ).Tilt < 95.0 ) ) { //vertical wall
 					Surface( SurfNum ).IntConvClassification = InConvClass_A1_VertWalls;
 				} else if ( Surface( SurfNum ).Tilt >= 95.0 ) { //tilted upwards
-					if ( DeltaTemp > 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A1_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A1_StableTilted;
@@ -6605,13 +6713,13 @@ namespace ConvectionCoefficients {
 				if ( Surface( SurfNum ).IntConvSurfHasActiveInIt ) {
 					Surface( SurfNum ).IntConvClassification = InConvClass_A1_HeatedFloor;
 				} else if ( Surface( SurfNum ).Tilt > 175.0 ) { //floor
-					if ( DeltaTemp > 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A1_UnstableHoriz;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A1_StableHoriz;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt <= 175.0 ) && ( Surface( SurfNum ).Tilt >= 95.0 ) ) {
-					if ( DeltaTemp > 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A1_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A1_StableTilted;
@@ -6621,7 +6729,7 @@ namespace ConvectionCoefficients {
 				Surface( SurfNum ).IntConvClassification = InConvClass_A1_Windows;
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_IntMass ) {
 				// assume horizontal upwards.
-				if ( DeltaTemp > 0.0 ) {
+				if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 					Surface( SurfNum ).IntConvClassification = InConvClass_A1_UnstableHoriz;
 				} else {
 					Surface( SurfNum ).IntConvClassification = InConvClass_A1_StableHoriz;
@@ -6633,7 +6741,7 @@ namespace ConvectionCoefficients {
 			}
 
 		} else if ( SELECT_CASE_var == InConvFlowRegime_A2 ) {
-			DeltaTemp = TH( 2, 1, SurfNum ) - MAT( ZoneNum );
+			DynamicIntConvSurfaceClassificationDeltaTemp = TH( 2, 1, SurfNum ) - MAT( DynamicIntConvSurfaceClassificationZoneNum );
 			if ( Surface( SurfNum ).Class == SurfaceClass_Wall || Surface( SurfNum ).Class == SurfaceClass_Door ) {
 
 				if ( Surface( SurfNum ).IntConvSurfHasActiveInIt ) {
@@ -6641,13 +6749,13 @@ namespace ConvectionCoefficients {
 				} else if ( ( Surface( SurfNum ).Tilt > 85.0 ) && ( Surface( SurfNum ).Tilt < 95.0 ) ) { //vertical wall
 					Surface( SurfNum ).IntConvClassification = InConvClass_A2_VertWallsNonHeated;
 				} else if ( Surface( SurfNum ).Tilt >= 95.0 ) { //tilted upwards
-					if ( DeltaTemp > 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A2_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A2_StableTilted;
 					}
 				} else if ( Surface( SurfNum ).Tilt <= 85.0 ) { //tilted downwards
-					if ( DeltaTemp < 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp < 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A2_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A2_StableTilted;
@@ -6656,13 +6764,13 @@ namespace ConvectionCoefficients {
 
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Roof ) {
 				if ( Surface( SurfNum ).Tilt < 5.0 ) {
-					if ( DeltaTemp < 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp < 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A2_UnstableHoriz;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A2_StableHoriz;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt >= 5.0 ) && ( ( Surface( SurfNum ).Tilt < 95.0 ) ) ) { //tilted downwards
-					if ( DeltaTemp < 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp < 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A2_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A2_StableTilted;
@@ -6670,7 +6778,7 @@ namespace ConvectionCoefficients {
 				} else if ( ( Surface( SurfNum ).Tilt > 85.0 ) && ( Surface( SurfNum ).Tilt < 95.0 ) ) { //vertical wall
 					Surface( SurfNum ).IntConvClassification = InConvClass_A2_VertWallsNonHeated;
 				} else if ( Surface( SurfNum ).Tilt >= 95.0 ) { //tilted upwards
-					if ( DeltaTemp > 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A2_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A2_StableTilted;
@@ -6679,13 +6787,13 @@ namespace ConvectionCoefficients {
 
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Floor ) {
 				if ( Surface( SurfNum ).Tilt > 175.0 ) {
-					if ( DeltaTemp > 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A2_UnstableHoriz;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A2_StableHoriz;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt <= 175.0 ) && ( Surface( SurfNum ).Tilt >= 95.0 ) ) {
-					if ( DeltaTemp > 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A2_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A2_StableTilted;
@@ -6695,7 +6803,7 @@ namespace ConvectionCoefficients {
 				Surface( SurfNum ).IntConvClassification = InConvClass_A2_Windows;
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_IntMass ) {
 				// assume horizontal upwards.
-				if ( DeltaTemp > 0.0 ) {
+				if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 					Surface( SurfNum ).IntConvClassification = InConvClass_A2_UnstableHoriz;
 				} else {
 					Surface( SurfNum ).IntConvClassification = InConvClass_A2_StableHoriz;
@@ -6706,19 +6814,19 @@ namespace ConvectionCoefficients {
 				ShowSevereError( "DynamicIntConvSurfaceClassification: failed to resolve Hc model for A2 surface named" + Surface( SurfNum ).Name );
 			}
 		} else if ( SELECT_CASE_var == InConvFlowRegime_A3 ) {
-			DeltaTemp = TH( 2, 1, SurfNum ) - MAT( ZoneNum );
+			DynamicIntConvSurfaceClassificationDeltaTemp = TH( 2, 1, SurfNum ) - MAT( DynamicIntConvSurfaceClassificationZoneNum );
 			if ( Surface( SurfNum ).Class == SurfaceClass_Wall || Surface( SurfNum ).Class == SurfaceClass_Door ) {
 
 				if ( ( Surface( SurfNum ).Tilt > 85.0 ) && ( Surface( SurfNum ).Tilt < 95.0 ) ) { //vertical wall
 					Surface( SurfNum ).IntConvClassification = InConvClass_A3_VertWalls;
 				} else if ( Surface( SurfNum ).Tilt >= 95.0 ) { //tilted upwards
-					if ( DeltaTemp > 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A3_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A3_StableTilted;
 					}
 				} else if ( Surface( SurfNum ).Tilt <= 85.0 ) { //tilted downwards
-					if ( DeltaTemp < 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp < 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A3_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A3_StableTilted;
@@ -6727,13 +6835,13 @@ namespace ConvectionCoefficients {
 
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Roof ) {
 				if ( Surface( SurfNum ).Tilt < 5.0 ) {
-					if ( DeltaTemp < 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp < 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A3_UnstableHoriz;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A3_StableHoriz;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt > 5.0 ) && ( ( Surface( SurfNum ).Tilt < 85.0 ) ) ) { //tilted downwards
-					if ( DeltaTemp < 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp < 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A3_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A3_StableTilted;
@@ -6741,7 +6849,7 @@ namespace ConvectionCoefficients {
 				} else if ( ( Surface( SurfNum ).Tilt > 85.0 ) && ( Surface( SurfNum ).Tilt < 95.0 ) ) { //vertical wall
 					Surface( SurfNum ).IntConvClassification = InConvClass_A3_VertWalls;
 				} else if ( Surface( SurfNum ).Tilt >= 95.0 ) { //tilted upwards
-					if ( DeltaTemp > 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A3_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A3_StableTilted;
@@ -6750,13 +6858,13 @@ namespace ConvectionCoefficients {
 
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Floor ) {
 				if ( Surface( SurfNum ).Tilt > 175.0 ) {
-					if ( DeltaTemp > 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A3_UnstableHoriz;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A3_StableHoriz;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt <= 175.0 ) && ( Surface( SurfNum ).Tilt >= 95.0 ) ) {
-					if ( DeltaTemp > 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A3_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_A3_StableTilted;
@@ -6766,7 +6874,7 @@ namespace ConvectionCoefficients {
 				Surface( SurfNum ).IntConvClassification = InConvClass_A3_Windows;
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_IntMass ) {
 				// assume horizontal upwards.
-				if ( DeltaTemp >= 0.0 ) {
+				if ( DynamicIntConvSurfaceClassificationDeltaTemp >= 0.0 ) {
 					Surface( SurfNum ).IntConvClassification = InConvClass_A3_UnstableHoriz;
 				} else {
 					Surface( SurfNum ).IntConvClassification = InConvClass_A3_StableHoriz;
@@ -6777,7 +6885,7 @@ namespace ConvectionCoefficients {
 				ShowSevereError( "DynamicIntConvSurfaceClassification: failed to resolve Hc model for A3 surface named" + Surface( SurfNum ).Name );
 			}
 		} else if ( SELECT_CASE_var == InConvFlowRegime_B ) {
-			DeltaTemp = TH( 2, 1, SurfNum ) - MAT( ZoneNum );
+			DynamicIntConvSurfaceClassificationDeltaTemp = TH( 2, 1, SurfNum ) - MAT( DynamicIntConvSurfaceClassificationZoneNum );
 			if ( Surface( SurfNum ).Class == SurfaceClass_Wall || Surface( SurfNum ).Class == SurfaceClass_Door ) {
 
 				if ( ( Surface( SurfNum ).Tilt > 85.0 ) && ( Surface( SurfNum ).Tilt < 95.0 ) ) { //vertical wall
@@ -6788,13 +6896,13 @@ namespace ConvectionCoefficients {
 					}
 
 				} else if ( Surface( SurfNum ).Tilt >= 95.0 ) { //tilted upwards
-					if ( DeltaTemp > 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_B_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_B_StableTilted;
 					}
 				} else if ( Surface( SurfNum ).Tilt <= 85.0 ) { //tilted downwards
-					if ( DeltaTemp < 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp < 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_B_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_B_StableTilted;
@@ -6803,13 +6911,13 @@ namespace ConvectionCoefficients {
 
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Roof ) {
 				if ( Surface( SurfNum ).Tilt < 5.0 ) {
-					if ( DeltaTemp < 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp < 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_B_UnstableHoriz;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_B_StableHoriz;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt >= 5.0 ) && ( ( Surface( SurfNum ).Tilt < 85.0 ) ) ) { //tilted downwards
-					if ( DeltaTemp < 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp < 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_B_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_B_StableTilted;
@@ -6821,7 +6929,7 @@ namespace ConvectionCoefficients {
 						Surface( SurfNum ).IntConvClassification = InConvClass_B_VertWalls;
 					}
 				} else if ( Surface( SurfNum ).Tilt >= 95.0 ) { //tilted upwards
-					if ( DeltaTemp > 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_B_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_B_StableTilted;
@@ -6830,13 +6938,13 @@ namespace ConvectionCoefficients {
 
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Floor ) {
 				if ( Surface( SurfNum ).Tilt > 175.0 ) {
-					if ( DeltaTemp > 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_B_UnstableHoriz;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_B_StableHoriz;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt <= 175.0 ) && ( Surface( SurfNum ).Tilt >= 95.0 ) ) {
-					if ( DeltaTemp > 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_B_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_B_StableTilted;
@@ -6846,7 +6954,7 @@ namespace ConvectionCoefficients {
 				Surface( SurfNum ).IntConvClassification = InConvClass_B_Windows;
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_IntMass ) {
 				// assume horizontal upwards.
-				if ( DeltaTemp > 0.0 ) {
+				if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 					Surface( SurfNum ).IntConvClassification = InConvClass_B_UnstableHoriz;
 				} else {
 					Surface( SurfNum ).IntConvClassification = InConvClass_B_StableHoriz;
@@ -6874,7 +6982,7 @@ namespace ConvectionCoefficients {
 
 		} else if ( SELECT_CASE_var == InConvFlowRegime_D ) {
 
-			DeltaTemp = TH( 2, 1, SurfNum ) - MAT( ZoneNum );
+			DynamicIntConvSurfaceClassificationDeltaTemp = TH( 2, 1, SurfNum ) - MAT( DynamicIntConvSurfaceClassificationZoneNum );
 			if ( Surface( SurfNum ).Class == SurfaceClass_Wall || Surface( SurfNum ).Class == SurfaceClass_Door ) {
 
 				if ( ( Surface( SurfNum ).Tilt > 85.0 ) && ( Surface( SurfNum ).Tilt < 95.0 ) ) { //vertical wall
@@ -6882,13 +6990,13 @@ namespace ConvectionCoefficients {
 					Surface( SurfNum ).IntConvClassification = InConvClass_D_Walls;
 
 				} else if ( Surface( SurfNum ).Tilt >= 95.0 ) { //tilted upwards
-					if ( DeltaTemp > 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_D_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_D_StableTilted;
 					}
 				} else if ( Surface( SurfNum ).Tilt <= 85.0 ) { //tilted downwards
-					if ( DeltaTemp < 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp < 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_D_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_D_StableTilted;
@@ -6897,13 +7005,13 @@ namespace ConvectionCoefficients {
 
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Roof ) {
 				if ( Surface( SurfNum ).Tilt < 5.0 ) {
-					if ( DeltaTemp < 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp < 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_D_UnstableHoriz;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_D_StableHoriz;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt >= 5.0 ) && ( ( Surface( SurfNum ).Tilt <= 85.0 ) ) ) { //tilted downwards
-					if ( DeltaTemp < 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp < 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_D_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_D_StableTilted;
@@ -6913,7 +7021,7 @@ namespace ConvectionCoefficients {
 					Surface( SurfNum ).IntConvClassification = InConvClass_D_Walls;
 
 				} else if ( Surface( SurfNum ).Tilt >= 95.0 ) { //tilted upwards
-					if ( DeltaTemp > 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_D_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_D_StableTilted;
@@ -6922,13 +7030,13 @@ namespace ConvectionCoefficients {
 
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Floor ) {
 				if ( Surface( SurfNum ).Tilt > 175.0 ) { //floor
-					if ( DeltaTemp > 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_D_UnstableHoriz;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_D_StableHoriz;
 					}
 				} else if ( ( Surface( SurfNum ).Tilt <= 175.0 ) && ( Surface( SurfNum ).Tilt >= 95.0 ) ) {
-					if ( DeltaTemp > 0.0 ) {
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 						Surface( SurfNum ).IntConvClassification = InConvClass_D_UnstableTilted;
 					} else {
 						Surface( SurfNum ).IntConvClassification = InConvClass_D_StableTilted;
@@ -6938,7 +7046,7 @@ namespace ConvectionCoefficients {
 				Surface( SurfNum ).IntConvClassification = InConvClass_D_Windows;
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_IntMass ) {
 				// assume horizontal upwards.
-				if ( DeltaTemp > 0.0 ) {
+				if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 					Surface( SurfNum ).IntConvClassification = InConvClass_D_UnstableHoriz;
 				} else {
 					Surface( SurfNum ).IntConvClassification = InConvClass_D_StableHoriz;
@@ -6951,7 +7059,7 @@ namespace ConvectionCoefficients {
 
 		} else if ( SELECT_CASE_var == InConvFlowRegime_E ) {
 
-			DeltaTemp = TH( 2, 1, SurfNum ) - MAT( ZoneNum );
+			DynamicIntConvSurfaceClassificationDeltaTemp = TH( 2, 1, SurfNum ) - MAT( DynamicIntConvSurfaceClassificationZoneNum );
 			if ( Surface( SurfNum ).Class == SurfaceClass_Wall || Surface( SurfNum ).Class == SurfaceClass_Door ) {
 
 				//mixed regime, but need to know what regime it was before it was mixed
@@ -6959,14 +7067,14 @@ namespace ConvectionCoefficients {
 
 				if ( SELECT_CASE_var1 == InConvFlowRegime_C ) {
 					//assume forced flow is down along wall (ceiling diffuser)
-					if ( DeltaTemp > 0.0 ) { // surface is hotter so plume upwards and forces oppose
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) { // surface is hotter so plume upwards and forces oppose
 						Surface( SurfNum ).IntConvClassification = InConvClass_E_OpposFlowWalls;
 					} else { // surface is cooler so plume down and forces assist
 						Surface( SurfNum ).IntConvClassification = InConvClass_E_AssistFlowWalls;
 					}
 				} else if ( SELECT_CASE_var1 == InConvFlowRegime_D ) {
 					// assume forced flow is upward along wall (perimeter zone HVAC with fan)
-					if ( DeltaTemp > 0.0 ) { // surface is hotter so plume up and forces assist
+					if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) { // surface is hotter so plume up and forces assist
 						Surface( SurfNum ).IntConvClassification = InConvClass_E_AssistFlowWalls;
 					} else { // surface is cooler so plume downward and forces oppose
 						Surface( SurfNum ).IntConvClassification = InConvClass_E_OpposFlowWalls;
@@ -6974,13 +7082,13 @@ namespace ConvectionCoefficients {
 				}}
 
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Roof ) {
-				if ( DeltaTemp > 0.0 ) { //surface is hotter so stable
+				if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) { //surface is hotter so stable
 					Surface( SurfNum ).IntConvClassification = InConvClass_E_StableCeiling;
 				} else {
 					Surface( SurfNum ).IntConvClassification = InConvClass_E_UnstableCieling;
 				}
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_Floor ) {
-				if ( DeltaTemp > 0.0 ) { //surface is hotter so unstable
+				if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) { //surface is hotter so unstable
 					Surface( SurfNum ).IntConvClassification = InConvClass_E_UnstableFloor;
 				} else {
 					Surface( SurfNum ).IntConvClassification = InConvClass_E_StableFloor;
@@ -6988,7 +7096,7 @@ namespace ConvectionCoefficients {
 			} else if ( ( Surface( SurfNum ).Class == SurfaceClass_Window ) || ( Surface( SurfNum ).Class == SurfaceClass_GlassDoor ) || ( Surface( SurfNum ).Class == SurfaceClass_TDD_Diffuser ) ) {
 				Surface( SurfNum ).IntConvClassification = InConvClass_E_Windows;
 			} else if ( Surface( SurfNum ).Class == SurfaceClass_IntMass ) {
-				if ( DeltaTemp > 0.0 ) {
+				if ( DynamicIntConvSurfaceClassificationDeltaTemp > 0.0 ) {
 					Surface( SurfNum ).IntConvClassification = InConvClass_E_UnstableFloor;
 				} else {
 					Surface( SurfNum ).IntConvClassification = InConvClass_E_StableFloor;
@@ -7805,7 +7913,6 @@ namespace ConvectionCoefficients {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static int ErrorIndex( 0 );
 
 		if ( HydraulicDiameter > 0.0 ) {
 			Hn = std::pow( pow_6( 1.4 * std::pow( std::abs( DeltaTemp ) / HydraulicDiameter, OneFourth ) ) + ( 1.63 * pow_2( DeltaTemp ) ), OneSixth ); //Tuned pow_6( std::pow( std::abs( DeltaTemp ), OneThird ) ) changed to pow_2( DeltaTemp )
@@ -7869,18 +7976,17 @@ namespace ConvectionCoefficients {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static int ErrorIndex( 0 );
 
 		if ( HydraulicDiameter > 0.0 ) {
 			Hn = 0.6 * std::pow( std::abs( DeltaTemp ) / pow_2( HydraulicDiameter ), OneFifth );
 		} else {
 			Hn = 9.999;
-			if ( ErrorIndex == 0 ) {
+			if ( CalcAlamdariHammondStableHorizontalErrorIndex == 0 ) {
 				ShowSevereMessage( "CalcAlamdariHammondStableHorizontal: Convection model not evaluated (would divide by zero)" );
 				ShowContinueError( "Effective hydraulic diameter is zero, convection model not applicable for surface =" + Surface( SurfNum ).Name );
 				ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 			}
-			ShowRecurringSevereErrorAtEnd( "CalcAlamdariHammondStableHorizontal: Convection model not evaluated because zero hydraulic diameter and set to 9.999 [W/m2-K]", ErrorIndex );
+			ShowRecurringSevereErrorAtEnd( "CalcAlamdariHammondStableHorizontal: Convection model not evaluated because zero hydraulic diameter and set to 9.999 [W/m2-K]", CalcAlamdariHammondStableHorizontalErrorIndex );
 		}
 
 		return Hn;
@@ -7932,18 +8038,17 @@ namespace ConvectionCoefficients {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static int ErrorIndex( 0 );
 
 		if ( Height > 0.0 ) {
 			Hn = std::pow( pow_6( 1.5 * std::pow( std::abs( DeltaTemp ) / Height, OneFourth ) ) + ( 1.23 * pow_2( DeltaTemp ) ), OneSixth ); //Tuned pow_6( std::pow( std::abs( DeltaTemp ), OneThird ) ) changed to pow_2( DeltaTemp )
 		} else {
 			Hn = 9.999;
-			if ( ErrorIndex == 0 ) {
+			if ( CalcAlamdariHammondVerticalWallErrorIndex == 0 ) {
 				ShowSevereMessage( "CalcAlamdariHammondVerticalWall: Convection model not evaluated (would divide by zero)" );
 				ShowContinueError( "Effective hydraulic diameter is zero, convection model not applicable for surface =" + Surface( SurfNum ).Name );
 				ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 			}
-			ShowRecurringSevereErrorAtEnd( "CalcAlamdariHammondVerticalWall: Convection model not evaluated because zero hydraulic diameter and set to 9.999 [W/m2-K]", ErrorIndex );
+			ShowRecurringSevereErrorAtEnd( "CalcAlamdariHammondVerticalWall: Convection model not evaluated because zero hydraulic diameter and set to 9.999 [W/m2-K]", CalcAlamdariHammondVerticalWallErrorIndex );
 		}
 
 		return Hn;
@@ -8356,7 +8461,6 @@ namespace ConvectionCoefficients {
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		Real64 cofpow;
-		static int ErrorIndex( 0 );
 
 		if ( ( DeltaTemp != 0.0 ) && ( Height != 0.0 ) ) {
 			cofpow = std::sqrt( pow_6( 1.5 * std::pow( std::abs( DeltaTemp ) / Height, OneFourth ) ) + std::pow( 1.23 * pow_2( DeltaTemp ), OneSixth ) ) + pow_3( ( ( SurfTemp - SupplyAirTemp ) / std::abs( DeltaTemp ) ) * ( -0.199 + 0.190 * std::pow( AirChangeRate, 0.8 ) ) ); //Tuned pow_6( std::pow( std::abs( DeltaTemp ), OneThird ) ) changed to pow_2( DeltaTemp )
@@ -8372,14 +8476,14 @@ namespace ConvectionCoefficients {
 				ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 			}
 			if ( DeltaTemp == 0.0 && ! WarmupFlag ) {
-				if ( ErrorIndex == 0 ) {
+				if ( CalcBeausoleilMorrisonMixedAssistedWallErrorIndex == 0 ) {
 					ShowWarningMessage( "CalcBeausoleilMorrisonMixedAssistedWall: Convection model not evaluated (would divide by zero)" );
 					ShowContinueError( "The temperature difference between surface and air is zero" );
 					ShowContinueError( "Occurs for zone named = " + Zone( ZoneNum ).Name );
 					ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 				}
 
-				ShowRecurringWarningErrorAtEnd( "CalcBeausoleilMorrisonMixedAssistedWall: Convection model not evaluated because of zero temperature difference and set to 9.999 [W/m2-K]", ErrorIndex );
+				ShowRecurringWarningErrorAtEnd( "CalcBeausoleilMorrisonMixedAssistedWall: Convection model not evaluated because of zero temperature difference and set to 9.999 [W/m2-K]", CalcBeausoleilMorrisonMixedAssistedWallErrorIndex );
 			}
 
 		}
@@ -8439,8 +8543,6 @@ namespace ConvectionCoefficients {
 		Real64 HcTmp2;
 		Real64 HcTmp3;
 		Real64 cofpow;
-		static int ErrorIndex( 0 );
-		static int ErrorIndex2( 0 );
 
 		if ( ( DeltaTemp != 0.0 ) ) { // protect divide by zero
 
@@ -8471,13 +8573,13 @@ namespace ConvectionCoefficients {
 		} else {
 			Hc = 9.999;
 			if ( ! WarmupFlag ) {
-				if ( ErrorIndex == 0 ) {
+				if ( CalcBeausoleilMorrisonMixedOpposingWallErrorIndex == 0 ) {
 					ShowSevereMessage( "CalcBeausoleilMorrisonMixedOpposingWall: Convection model not evaluated (would divide by zero)" );
 					ShowContinueError( "The temperature difference between surface and air is zero" );
 					ShowContinueError( "Occurs for zone named = " + Zone( ZoneNum ).Name );
 					ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 				}
-				ShowRecurringSevereErrorAtEnd( "CalcBeausoleilMorrisonMixedOpposingWall: Convection model not evaluated because of zero temperature difference and set to 9.999 [W/m2-K]", ErrorIndex );
+				ShowRecurringSevereErrorAtEnd( "CalcBeausoleilMorrisonMixedOpposingWall: Convection model not evaluated because of zero temperature difference and set to 9.999 [W/m2-K]", CalcBeausoleilMorrisonMixedOpposingWallErrorIndex );
 			}
 		}
 
@@ -8534,7 +8636,6 @@ namespace ConvectionCoefficients {
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		Real64 cofpow;
-		static int ErrorIndex( 0 );
 
 		if ( ( HydraulicDiameter != 0.0 ) && ( DeltaTemp != 0.0 ) ) {
 			cofpow = pow_3( 0.6 * std::pow( std::abs( DeltaTemp ) / HydraulicDiameter, OneFifth ) ) + pow_3( ( ( SurfTemp - SupplyAirTemp ) / std::abs( DeltaTemp ) ) * ( 0.159 + 0.116 * std::pow( AirChangeRate, 0.8 ) ) );
@@ -8550,14 +8651,14 @@ namespace ConvectionCoefficients {
 				ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 			}
 			if ( DeltaTemp == 0.0 && ! WarmupFlag ) {
-				if ( ErrorIndex == 0 ) {
+				if ( CalcBeausoleilMorrisonMixedStableFloorErrorIndex == 0 ) {
 					ShowWarningMessage( "CalcBeausoleilMorrisonMixedStableFloor: Convection model not evaluated (would divide by zero)" );
 					ShowContinueError( "The temperature difference between surface and air is zero" );
 					ShowContinueError( "Occurs for zone named = " + Zone( ZoneNum ).Name );
 					ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 				}
 
-				ShowRecurringWarningErrorAtEnd( "CalcBeausoleilMorrisonMixedStableFloor: Convection model not evaluated because of zero temperature difference and set to 9.999 [W/m2-K]", ErrorIndex );
+				ShowRecurringWarningErrorAtEnd( "CalcBeausoleilMorrisonMixedStableFloor: Convection model not evaluated because of zero temperature difference and set to 9.999 [W/m2-K]", CalcBeausoleilMorrisonMixedStableFloorErrorIndex );
 			}
 
 		}
@@ -8614,7 +8715,6 @@ namespace ConvectionCoefficients {
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		Real64 cofpow;
-		static int ErrorIndex( 0 );
 
 		if ( ( HydraulicDiameter != 0.0 ) && ( DeltaTemp != 0.0 ) ) {
 			cofpow = std::sqrt( pow_6( 1.4 * std::pow( std::abs( DeltaTemp ) / HydraulicDiameter, OneFourth ) ) + pow_6( 1.63 * std::pow( std::abs( DeltaTemp ), OneThird ) ) ) + pow_3( ( ( SurfTemp - SupplyAirTemp ) / std::abs( DeltaTemp ) ) * ( 0.159 + 0.116 * std::pow( AirChangeRate, 0.8 ) ) );
@@ -8630,14 +8730,14 @@ namespace ConvectionCoefficients {
 				ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 			}
 			if ( DeltaTemp == 0.0 && ! WarmupFlag ) {
-				if ( ErrorIndex == 0 ) {
+				if ( CalcBeausoleilMorrisonMixedUnstableFloorErrorIndex == 0 ) {
 					ShowWarningMessage( "CalcBeausoleilMorrisonMixedUnstableFloor: Convection model not evaluated (would divide by zero)" );
 					ShowContinueError( "The temperature difference between surface and air is zero" );
 					ShowContinueError( "Occurs for zone named = " + Zone( ZoneNum ).Name );
 					ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 				}
 
-				ShowRecurringWarningErrorAtEnd( "CalcBeausoleilMorrisonMixedUnstableFloor: Convection model not evaluated because of zero temperature difference and set to 9.999 [W/m2-K]", ErrorIndex );
+				ShowRecurringWarningErrorAtEnd( "CalcBeausoleilMorrisonMixedUnstableFloor: Convection model not evaluated because of zero temperature difference and set to 9.999 [W/m2-K]", CalcBeausoleilMorrisonMixedUnstableFloorErrorIndex );
 			}
 
 		}
@@ -8695,7 +8795,6 @@ namespace ConvectionCoefficients {
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		Real64 cofpow;
-		static int ErrorIndex( 0 );
 
 		if ( ( HydraulicDiameter != 0.0 ) && ( DeltaTemp != 0.0 ) ) {
 			cofpow = pow_3( 0.6 * std::pow( std::abs( DeltaTemp ) / HydraulicDiameter, OneFifth ) ) + pow_3( ( ( SurfTemp - SupplyAirTemp ) / std::abs( DeltaTemp ) ) * ( -0.166 + 0.484 * std::pow( AirChangeRate, 0.8 ) ) );
@@ -8711,14 +8810,14 @@ namespace ConvectionCoefficients {
 				ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 			}
 			if ( DeltaTemp == 0.0 && ! WarmupFlag ) {
-				if ( ErrorIndex == 0 ) {
+				if ( CalcBeausoleilMorrisonMixedStableCeilingErrorIndex == 0 ) {
 					ShowWarningMessage( "CalcBeausoleilMorrisonMixedStableCeiling: Convection model not evaluated (would divide by zero)" );
 					ShowContinueError( "The temperature difference between surface and air is zero" );
 					ShowContinueError( "Occurs for zone named = " + Zone( ZoneNum ).Name );
 					ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 				}
 
-				ShowRecurringWarningErrorAtEnd( "CalcBeausoleilMorrisonMixedStableCeiling: Convection model not evaluated because of zero temperature difference and set to 9.999 [W/m2-K]", ErrorIndex );
+				ShowRecurringWarningErrorAtEnd( "CalcBeausoleilMorrisonMixedStableCeiling: Convection model not evaluated because of zero temperature difference and set to 9.999 [W/m2-K]", CalcBeausoleilMorrisonMixedStableCeilingErrorIndex );
 			}
 
 		}
@@ -8775,7 +8874,6 @@ namespace ConvectionCoefficients {
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		Real64 cofpow;
-		static int ErrorIndex( 0 );
 
 		if ( ( HydraulicDiameter != 0.0 ) && ( DeltaTemp != 0.0 ) ) {
 			cofpow = std::sqrt( pow_6( 1.4 * std::pow( std::abs( DeltaTemp ) / HydraulicDiameter, OneFourth ) ) + pow_6( 1.63 * std::pow( std::abs( DeltaTemp ), OneThird ) ) ) + pow_3( ( ( SurfTemp - SupplyAirTemp ) / std::abs( DeltaTemp ) ) * ( -0.166 + 0.484 * std::pow( AirChangeRate, 0.8 ) ) );
@@ -8791,14 +8889,14 @@ namespace ConvectionCoefficients {
 				ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 			}
 			if ( DeltaTemp == 0.0 && ! WarmupFlag ) {
-				if ( ErrorIndex == 0 ) {
+				if ( CalcBeausoleilMorrisonMixedUnstableCeilingErrorIndex == 0 ) {
 					ShowWarningMessage( "CalcBeausoleilMorrisonMixedUnstableCeiling: Convection model not evaluated (would divide by zero)" );
 					ShowContinueError( "The temperature difference between surface and air is zero" );
 					ShowContinueError( "Occurs for zone named = " + Zone( ZoneNum ).Name );
 					ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 				}
 
-				ShowRecurringWarningErrorAtEnd( "CalcBeausoleilMorrisonMixedUnstableCeiling: Convection model not evaluated because of zero temperature difference and set to 9.999 [W/m2-K]", ErrorIndex );
+				ShowRecurringWarningErrorAtEnd( "CalcBeausoleilMorrisonMixedUnstableCeiling: Convection model not evaluated because of zero temperature difference and set to 9.999 [W/m2-K]", CalcBeausoleilMorrisonMixedUnstableCeilingErrorIndex );
 			}
 		}
 		return Hc;
@@ -8852,9 +8950,6 @@ namespace ConvectionCoefficients {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static Real64 RaH( 0.0 );
-		static Real64 BetaFilm( 0.0 );
-		static int ErrorIndex( 0 );
 
 		BetaFilm = 1.0 / ( KelvinConv + SurfTemp + 0.5 * DeltaTemp ); // TODO check sign on DeltaTemp
 		if ( Height > 0.0 ) {
@@ -8868,13 +8963,13 @@ namespace ConvectionCoefficients {
 		} else {
 			// bad value for Height, but we have little info to identify calling culprit
 			Hn = 9.999;
-			if ( ErrorIndex == 0 ) {
+			if ( CalcFohannoPolidoriVerticalWallErrorIndex == 0 ) {
 				ShowSevereMessage( "CalcFohannoPolidoriVerticalWall: Convection model not evaluated (would divide by zero)" );
 				ShowContinueError( "Effective surface height is zero, convection model not applicable for surface =" + Surface( SurfNum ).Name );
 				ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 
 			}
-			ShowRecurringSevereErrorAtEnd( "CalcFohannoPolidoriVerticalWall: Convection model not evaluated because zero height and set to 9.999 [W/m2-K]", ErrorIndex );
+			ShowRecurringSevereErrorAtEnd( "CalcFohannoPolidoriVerticalWall: Convection model not evaluated because zero height and set to 9.999 [W/m2-K]", CalcFohannoPolidoriVerticalWallErrorIndex );
 		}
 
 		return Hn;
@@ -8973,8 +9068,6 @@ namespace ConvectionCoefficients {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static int ErrorIndex( 0 );
-		static int ErrorIndex2( 0 );
 
 		if ( ZoneExtPerimLength > 0.0 ) {
 			if ( WindWallRatio <= 0.5 ) {
@@ -8990,26 +9083,26 @@ namespace ConvectionCoefficients {
 				} else {
 					//shouldn'tcome
 					Hc = 9.999;
-					if ( ErrorIndex == 0 ) {
+					if ( CalcGoldsteinNovoselacCeilingDiffuserWindowErrorIndex == 0 ) {
 						ShowSevereMessage( "CalcGoldsteinNovoselacCeilingDiffuserWindow: Convection model not evaluated (bad relative window location)" );
 						ShowContinueError( "Value for window location = " + RoundSigDigits( WindowLocationType ) );
 						ShowContinueError( "Occurs for zone named = " + Zone( ZoneNum ).Name );
 						ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 					}
-					ShowRecurringSevereErrorAtEnd( "CalcGoldsteinNovoselacCeilingDiffuserWindow: Convection model not evaluated because bad window location and set to 9.999 [W/m2-K]", ErrorIndex );
+					ShowRecurringSevereErrorAtEnd( "CalcGoldsteinNovoselacCeilingDiffuserWindow: Convection model not evaluated because bad window location and set to 9.999 [W/m2-K]", CalcGoldsteinNovoselacCeilingDiffuserWindowErrorIndex );
 				}
 			} else {
 				Hc = 0.103 * std::pow( AirSystemFlowRate / ZoneExtPerimLength, 0.8 );
 			}
 		} else {
 			Hc = 9.999;
-			if ( ErrorIndex2 == 0 ) {
+			if ( CalcGoldsteinNovoselacCeilingDiffuserWindowErrorIndex2 == 0 ) {
 				ShowSevereMessage( "CalcGoldsteinNovoselacCeilingDiffuserWindow: Convection model not evaluated (zero zone exterior perimeter length)" );
 				ShowContinueError( "Value for zone exterior perimeter length = " + RoundSigDigits( ZoneExtPerimLength, 5 ) );
 				ShowContinueError( "Occurs for zone named = " + Zone( ZoneNum ).Name );
 				ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 			}
-			ShowRecurringSevereErrorAtEnd( "CalcGoldsteinNovoselacCeilingDiffuserWindow: Convection model not evaluated because bad perimeter length and set to 9.999 [W/m2-K]", ErrorIndex2 );
+			ShowRecurringSevereErrorAtEnd( "CalcGoldsteinNovoselacCeilingDiffuserWindow: Convection model not evaluated because bad perimeter length and set to 9.999 [W/m2-K]", CalcGoldsteinNovoselacCeilingDiffuserWindowErrorIndex2 );
 		}
 		return Hc;
 
@@ -9059,8 +9152,6 @@ namespace ConvectionCoefficients {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static int ErrorIndex( 0 );
-		static int ErrorIndex2( 0 );
 
 		if ( ZoneExtPerimLength > 0.0 ) {
 			if ( WindowLocationType == InConvWinLoc_WindowAboveThis ) {
@@ -9071,24 +9162,24 @@ namespace ConvectionCoefficients {
 				Hc = 0.063 * std::pow( AirSystemFlowRate / ZoneExtPerimLength, 0.8 ); // assumption for case not covered by model
 			} else {
 				Hc = 9.999;
-				if ( ErrorIndex == 0 ) {
+				if ( CalcGoldsteinNovoselacCeilingDiffuserWallErrorIndex == 0 ) {
 					ShowSevereMessage( "CalcGoldsteinNovoselacCeilingDiffuserWall: Convection model not evaluated (bad relative window location)" );
 					ShowContinueError( "Value for window location = " + RoundSigDigits( WindowLocationType ) );
 					ShowContinueError( "Occurs for zone named = " + Zone( ZoneNum ).Name );
 					ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 				}
-				ShowRecurringSevereErrorAtEnd( "CalcGoldsteinNovoselacCeilingDiffuserWall: Convection model not evaluated because bad window location and set to 9.999 [W/m2-K]", ErrorIndex );
+				ShowRecurringSevereErrorAtEnd( "CalcGoldsteinNovoselacCeilingDiffuserWall: Convection model not evaluated because bad window location and set to 9.999 [W/m2-K]", CalcGoldsteinNovoselacCeilingDiffuserWallErrorIndex );
 
 			}
 		} else {
 			Hc = 9.999;
-			if ( ErrorIndex2 == 0 ) {
+			if ( CalcGoldsteinNovoselacCeilingDiffuserWallErrorIndex2 == 0 ) {
 				ShowSevereMessage( "CalcGoldsteinNovoselacCeilingDiffuserWall: Convection model not evaluated (zero zone exterior perimeter length)" );
 				ShowContinueError( "Value for zone exterior perimeter length = " + RoundSigDigits( ZoneExtPerimLength, 5 ) );
 				ShowContinueError( "Occurs for zone named = " + Zone( ZoneNum ).Name );
 				ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 			}
-			ShowRecurringSevereErrorAtEnd( "CalcGoldsteinNovoselacCeilingDiffuserWall: Convection model not evaluated because bad perimeter length and set to 9.999 [W/m2-K]", ErrorIndex2 );
+			ShowRecurringSevereErrorAtEnd( "CalcGoldsteinNovoselacCeilingDiffuserWall: Convection model not evaluated because bad perimeter length and set to 9.999 [W/m2-K]", CalcGoldsteinNovoselacCeilingDiffuserWallErrorIndex2 );
 
 		}
 		return Hc;
@@ -9138,18 +9229,17 @@ namespace ConvectionCoefficients {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static int ErrorIndex( 0 );
 
 		if ( ZoneExtPerimLength > 0.0 ) {
 			Hc = 0.048 * std::pow( AirSystemFlowRate / ZoneExtPerimLength, 0.8 );
 		} else {
-			if ( ErrorIndex == 0 ) {
+			if ( CalcGoldsteinNovoselacCeilingDiffuserFloorErrorIndex == 0 ) {
 				ShowSevereMessage( "CalcGoldsteinNovoselacCeilingDiffuserFloor: Convection model not evaluated (zero zone exterior perimeter length)" );
 				ShowContinueError( "Value for zone exterior perimeter length = " + RoundSigDigits( ZoneExtPerimLength, 5 ) );
 				ShowContinueError( "Occurs for zone named = " + Zone( ZoneNum ).Name );
 				ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 			}
-			ShowRecurringSevereErrorAtEnd( "CalcGoldsteinNovoselacCeilingDiffuserFloor: Convection model not evaluated because bad perimeter length and set to 9.999 [W/m2-K]", ErrorIndex );
+			ShowRecurringSevereErrorAtEnd( "CalcGoldsteinNovoselacCeilingDiffuserFloor: Convection model not evaluated because bad perimeter length and set to 9.999 [W/m2-K]", CalcGoldsteinNovoselacCeilingDiffuserFloorErrorIndex );
 
 			Hc = 9.999; // safe but noticeable
 		}
@@ -9209,19 +9299,18 @@ namespace ConvectionCoefficients {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static int ErrorIndex( 0 );
 
 		if ( FaceArea > 0.0 ) {
 			Hf = 2.53 * RoughnessMultiplier( RoughnessIndex ) * std::sqrt( FacePerimeter * WindAtZ / FaceArea );
 
 		} else {
-			if ( ErrorIndex == 0 ) {
+			if ( CalcSparrowWindwardErrorIndex == 0 ) {
 				ShowSevereMessage( "CalcSparrowWindward: Convection model not evaluated (bad face area)" );
 				ShowContinueError( "Value for effective face area = " + RoundSigDigits( FaceArea, 5 ) );
 				ShowContinueError( "Occurs for surface named = " + Surface( SurfNum ).Name );
 				ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 			}
-			ShowRecurringSevereErrorAtEnd( "CalcSparrowWindward: Convection model not evaluated because bad face area and set to 9.999 [W/m2-k]", ErrorIndex );
+			ShowRecurringSevereErrorAtEnd( "CalcSparrowWindward: Convection model not evaluated because bad face area and set to 9.999 [W/m2-k]", CalcSparrowWindwardErrorIndex );
 			Hf = 9.999; // safe but noticeable
 		}
 		return Hf;
@@ -9280,18 +9369,17 @@ namespace ConvectionCoefficients {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static int ErrorIndex( 0 );
 
 		if ( FaceArea > 0.0 ) {
 			Hf = 2.53 * 0.5 * RoughnessMultiplier( RoughnessIndex ) * std::sqrt( FacePerimeter * WindAtZ / FaceArea );
 		} else {
-			if ( ErrorIndex == 0 ) {
+			if ( CalcSparrowLeewardErrorIndex == 0 ) {
 				ShowSevereMessage( "CalcSparrowLeeward: Convection model not evaluated (bad face area)" );
 				ShowContinueError( "Value for effective face area = " + RoundSigDigits( FaceArea, 5 ) );
 				ShowContinueError( "Occurs for surface named = " + Surface( SurfNum ).Name );
 				ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 			}
-			ShowRecurringSevereErrorAtEnd( "CalcSparrowLeeward: Convection model not evaluated because bad face area and set to 9.999 [W/m2-k]", ErrorIndex );
+			ShowRecurringSevereErrorAtEnd( "CalcSparrowLeeward: Convection model not evaluated because bad face area and set to 9.999 [W/m2-k]", CalcSparrowLeewardErrorIndex );
 
 			Hf = 9.999; // safe but noticeable
 		}
@@ -9676,18 +9764,17 @@ namespace ConvectionCoefficients {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static int ErrorIndex( 0 );
 
 		if ( LengthScale > 0.0 ) {
 			Hf = 8.6 * std::pow( WindAtZ, 0.6 ) / std::pow( LengthScale, 0.4 );
 		} else {
-			if ( ErrorIndex == 0 ) {
+			if ( CalcMitchellErrorIndex == 0 ) {
 				ShowSevereMessage( "CalcMitchell: Convection model not evaluated (bad length scale)" );
 				ShowContinueError( "Value for effective length scale = " + RoundSigDigits( LengthScale, 5 ) );
 				ShowContinueError( "Occurs for surface named = " + Surface( SurfNum ).Name );
 				ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 			}
-			ShowRecurringSevereErrorAtEnd( "CalcMitchell: Convection model not evaluated because bad length scale and set to 9.999 [W/m2-k]", ErrorIndex );
+			ShowRecurringSevereErrorAtEnd( "CalcMitchell: Convection model not evaluated because bad length scale and set to 9.999 [W/m2-k]", CalcMitchellErrorIndex );
 			Hf = 9.999; // safe but noticeable
 		}
 		return Hf;
@@ -9807,7 +9894,6 @@ namespace ConvectionCoefficients {
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		Real64 Theta; // angle between wind and surface azimuth
-		static int ErrorIndex( 0 );
 
 		Theta = WindDir - SurfAzimuth - 90.0; //TODO double check theta
 		if ( Theta > 180.0 ) Theta -= 360.0;
@@ -9824,13 +9910,13 @@ namespace ConvectionCoefficients {
 			Hf = 3.54 * std::pow( WindAt10m, 0.76 );
 
 		} else {
-			if ( ErrorIndex == 0 ) {
+			if ( CalcEmmelVerticalErrorIndex == 0 ) {
 				ShowSevereMessage( "CalcEmmelVertical: Convection model wind angle calculation suspect (developer issue)" );
 				ShowContinueError( "Value for theta angle = " + RoundSigDigits( Theta, 5 ) );
 				ShowContinueError( "Occurs for surface named = " + Surface( SurfNum ).Name );
 				ShowContinueError( "Convection model uses high theta correlation and the simulation continues" );
 			}
-			ShowRecurringSevereErrorAtEnd( "CalcEmmelVertical: Convection model wind angle calculation suspect and high theta correlation", ErrorIndex );
+			ShowRecurringSevereErrorAtEnd( "CalcEmmelVertical: Convection model wind angle calculation suspect and high theta correlation", CalcEmmelVerticalErrorIndex );
 			Hf = 3.54 * std::pow( WindAt10m, 0.76 );
 		}
 		return Hf;
@@ -9884,7 +9970,6 @@ namespace ConvectionCoefficients {
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		Real64 Theta; // angle between wind and surface azimuth
-		static int ErrorIndex( 0 );
 
 		Theta = WindDir - LongAxisOutwardAzimuth - 90.0; //TODO double check theta
 		if ( Theta > 180.0 ) Theta -= 360.0;
@@ -9901,13 +9986,13 @@ namespace ConvectionCoefficients {
 			Hf = 3.54 * std::pow( WindAt10m, 0.76 );
 
 		} else {
-			if ( ErrorIndex == 0 ) {
+			if ( CalcEmmelRoofErrorIndex == 0 ) {
 				ShowSevereMessage( "CalcEmmelRoof: Convection model wind angle calculation suspect (developer issue)" );
 				ShowContinueError( "Value for theta angle = " + RoundSigDigits( Theta, 5 ) );
 				ShowContinueError( "Occurs for surface named = " + Surface( SurfNum ).Name );
 				ShowContinueError( "Convection model uses high theta correlation and the simulation continues" );
 			}
-			ShowRecurringSevereErrorAtEnd( "CalcEmmelRoof: Convection model wind angle calculation suspect and high theta correlation", ErrorIndex );
+			ShowRecurringSevereErrorAtEnd( "CalcEmmelRoof: Convection model wind angle calculation suspect and high theta correlation", CalcEmmelRoofErrorIndex );
 
 			Hf = 3.54 * std::pow( WindAt10m, 0.76 );
 		}
@@ -9977,7 +10062,6 @@ namespace ConvectionCoefficients {
 		Array1D< Real64 > RfARR( 6 );
 		Real64 Rf;
 		Real64 BetaFilm;
-		static int ErrorIndex( 0 );
 
 		RfARR = { 2.10, 1.67, 1.52, 1.13, 1.11, 1.0 };
 
@@ -10008,13 +10092,13 @@ namespace ConvectionCoefficients {
 		if ( x > 0.0 ) {
 			Hc = eta * ( k / Ln ) * 0.15 * std::pow( RaLn, OneThird ) + ( k / x ) * Rf * 0.0296 * std::pow( Rex, FourFifths ) * std::pow( Pr, OneThird );
 		} else {
-			if ( ErrorIndex == 0 ) {
+			if ( CalcClearRoofErrorIndex == 0 ) {
 				ShowSevereMessage( "CalcClearRoof: Convection model not evaluated (bad value for distance to roof edge)" );
 				ShowContinueError( "Value for distance to roof edge =" + RoundSigDigits( x, 3 ) );
 				ShowContinueError( "Occurs for surface named = " + Surface( SurfNum ).Name );
 				ShowContinueError( "Convection surface heat transfer coefficient set to 9.999 [W/m2-K] and the simulation continues" );
 			}
-			ShowRecurringSevereErrorAtEnd( "CalcClearRoof: Convection model not evaluated because bad value for distance to roof edge and set to 9.999 [W/m2-k]", ErrorIndex );
+			ShowRecurringSevereErrorAtEnd( "CalcClearRoof: Convection model not evaluated because bad value for distance to roof edge and set to 9.999 [W/m2-k]", CalcClearRoofErrorIndex );
 			Hc = 9.9999; // safe but noticeable
 		}
 		return Hc;
@@ -525,6 +525,11 @@ namespace ConvectionCoefficients {
 
 	// Functions
 
+	// Clears the global data in ConvectionCoefficients.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	InitInteriorConvectionCoeffs(
 		Array1S< Real64 > const SurfaceTemperatures, // Temperature of surfaces for evaluation of HcIn
@@ -128,6 +128,16 @@ namespace CoolTower {
 	// Object Data
 	Array1D< CoolTowerParams > CoolTowerSys;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true );
+		bool ErrorsFound( false ); // If errors detected in input
+	}
+
 	// Functions
 
 	void
@@ -135,6 +145,8 @@ namespace CoolTower {
 	{
 		NumCoolTowers = 0;
 		CoolTowerSys.deallocate();
+		GetInputFlag = true;
+		ErrorsFound = false;
 	}
 
 	void
@@ -174,7 +186,6 @@ namespace CoolTower {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInputFlag( true );
 		//unused1208  LOGICAL :: ErrorsFound=.FALSE.
 		//unused1208  INTEGER :: CoolTowerNum
 
@@ -246,7 +257,6 @@ namespace CoolTower {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int CoolTowerNum; // Cooltower number
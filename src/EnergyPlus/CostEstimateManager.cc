@@ -123,8 +123,27 @@ namespace CostEstimateManager {
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetCostInput( true );
+		bool GetCostEstimateInputErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+	}
+
 	// Functions
 
+	// Clears the global data in CostEstimateManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		GetCostInput = true;
+		GetCostEstimateInputErrorsFound = false;
+	}
+
 	void
 	SimCostEstimate()
 	{
@@ -161,7 +180,6 @@ namespace CostEstimateManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetCostInput( true );
 
 		if ( GetCostInput ) {
 			GetCostEstimateInput();
@@ -224,7 +242,6 @@ namespace CostEstimateManager {
 		int NumAlphas; // Number of Alphas for each GetObjectItem call
 		int NumNumbers; // Number of Numbers for each GetObjectItem call
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 
 		NumLineItems = GetNumObjectsFound( "ComponentCost:LineItem" );
 
@@ -282,7 +299,7 @@ namespace CostEstimateManager {
 
 		} else if ( NumCostAdjust > 1 ) {
 			ShowSevereError( cCurrentModuleObject + ": Only one instance of this object is allowed." );
-			ErrorsFound = true;
+			GetCostEstimateInputErrorsFound = true;
 		}
 
 		cCurrentModuleObject = "ComponentCost:Reference";
@@ -300,16 +317,16 @@ namespace CostEstimateManager {
 
 		} else if ( NumRefAdjust > 1 ) {
 			ShowSevereError( cCurrentModuleObject + " : Only one instance of this object is allowed." );
-			ErrorsFound = true;
+			GetCostEstimateInputErrorsFound = true;
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetCostEstimateInputErrorsFound ) {
 			ShowFatalError( "Errors found in processing cost estimate input" );
 		}
 
-		CheckCostEstimateInput( ErrorsFound );
+		CheckCostEstimateInput( GetCostEstimateInputErrorsFound );
 
-		if ( ErrorsFound ) {
+		if ( GetCostEstimateInputErrorsFound ) {
 			ShowFatalError( "Errors found in processing cost estimate input" );
 		}
 
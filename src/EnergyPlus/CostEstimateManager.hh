@@ -80,6 +80,11 @@ namespace CostEstimateManager {
 
 	// Functions
 
+	// Clears the global data in CostEstimateManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimCostEstimate();
 
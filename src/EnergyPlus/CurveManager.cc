@@ -225,6 +225,333 @@ namespace CurveManager {
 	Array1D< TableDataStruct > Temp2TableData;
 	Array1D< TableLookupData > TableLookup;
 
+	namespace {
+		// Curve equations, one function per curve type, looked up through CurveEquations by CurveType.  This replaces
+		// the test of the curve type on every evaluation by a single indirect call.  The independent variables
+		// are passed in after the curve limits have been imposed.
+		typedef Real64 ( *CurveEquation )( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const V2, Real64 const V3, Real64 const V4 );
+
+		Real64
+		NoEquation( PerfomanceCurveData const &, Real64 const, Real64 const, Real64 const, Real64 const )
+		{
+			return 0.0;
+		}
+
+		Real64
+		LinearEquation( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			return Curve.Coeff1 + V1 * Curve.Coeff2;
+		}
+
+		Real64
+		QuadraticEquation( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			return Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * Curve.Coeff3 );
+		}
+
+		Real64
+		QuadLinearEquation( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const V2, Real64 const V3, Real64 const V4 )
+		{
+			return Curve.Coeff1 + V1 * Curve.Coeff2 + V2 * Curve.Coeff3 + V3 * Curve.Coeff4 + V4 * Curve.Coeff5;
+		}
+
+		Real64
+		CubicEquation( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			return Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * ( Curve.Coeff3 + V1 * Curve.Coeff4 ) );
+		}
+
+		Real64
+		QuarticEquation( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			return Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * ( Curve.Coeff3 + V1 * ( Curve.Coeff4 + V1 * Curve.Coeff5 ) ) );
+		}
+
+		Real64
+		BiQuadraticEquation( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const V2, Real64 const, Real64 const )
+		{
+			return Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * Curve.Coeff3 ) + V2 * ( Curve.Coeff4 + V2 * Curve.Coeff5 ) + V1 * V2 * Curve.Coeff6;
+		}
+
+		Real64
+		QuadraticLinearEquation( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const V2, Real64 const, Real64 const )
+		{
+			return ( Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * Curve.Coeff3 ) ) + ( Curve.Coeff4 + V1 * ( Curve.Coeff5 + V1 * Curve.Coeff6 ) ) * V2;
+		}
+
+		Real64
+		CubicLinearEquation( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const V2, Real64 const, Real64 const )
+		{
+			return ( Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * ( Curve.Coeff3 + V1 * Curve.Coeff4 ) ) ) + ( Curve.Coeff5 + V1 * Curve.Coeff6 ) * V2;
+		}
+
+		Real64
+		BiCubicEquation( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const V2, Real64 const, Real64 const )
+		{
+			return Curve.Coeff1 + V1 * Curve.Coeff2 + V1 * V1 * Curve.Coeff3 + V2 * Curve.Coeff4 + V2 * V2 * Curve.Coeff5 + V1 * V2 * Curve.Coeff6 + V1 * V1 * V1 * Curve.Coeff7 + V2 * V2 * V2 * Curve.Coeff8 + V1 * V1 * V2 * Curve.Coeff9 + V1 * V2 * V2 * Curve.Coeff10;
+		}
+
+		Real64
+		ChillerPartLoadWithLiftEquation( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const V2, Real64 const V3, Real64 const )
+		{
+			return Curve.Coeff1 + Curve.Coeff2*V1 + Curve.Coeff3*V1*V1 + Curve.Coeff4*V2 + Curve.Coeff5*V2*V2 + Curve.Coeff6*V1*V2  + Curve.Coeff7*V1*V1*V1 + Curve.Coeff8*V2*V2*V2 + Curve.Coeff9*V1*V1*V2 + Curve.Coeff10*V1*V2*V2 + Curve.Coeff11*V1*V1*V2*V2 + Curve.Coeff12*V3*V2*V2*V2;
+		}
+
+		Real64
+		TriQuadraticEquation( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const V2, Real64 const V3, Real64 const )
+		{
+			auto const & Tri2ndOrder( Curve.Tri2ndOrder( 1 ) );
+			auto const V1s( V1 * V1 );
+			auto const V2s( V2 * V2 );
+			auto const V3s( V3 * V3 );
+			return Tri2ndOrder.CoeffA0 + Tri2ndOrder.CoeffA1 * V1s + Tri2ndOrder.CoeffA2 * V1 + Tri2ndOrder.CoeffA3 * V2s + Tri2ndOrder.CoeffA4 * V2 + Tri2ndOrder.CoeffA5 * V3s + Tri2ndOrder.CoeffA6 * V3 + Tri2ndOrder.CoeffA7 * V1s * V2s + Tri2ndOrder.CoeffA8 * V1 * V2 + Tri2ndOrder.CoeffA9 * V1 * V2s + Tri2ndOrder.CoeffA10 * V1s * V2 + Tri2ndOrder.CoeffA11 * V1s * V3s + Tri2ndOrder.CoeffA12 * V1 * V3 + Tri2ndOrder.CoeffA13 * V1 * V3s + Tri2ndOrder.CoeffA14 * V1s * V3 + Tri2ndOrder.CoeffA15 * V2s * V3s + Tri2ndOrder.CoeffA16 * V2 * V3 + Tri2ndOrder.CoeffA17 * V2 * V3s + Tri2ndOrder.CoeffA18 * V2s * V3 + Tri2ndOrder.CoeffA19 * V1s * V2s * V3s + Tri2ndOrder.CoeffA20 * V1s * V2s * V3 + Tri2ndOrder.CoeffA21 * V1s * V2 * V3s + Tri2ndOrder.CoeffA22 * V1 * V2s * V3s + Tri2ndOrder.CoeffA23 * V1s * V2 * V3 + Tri2ndOrder.CoeffA24 * V1 * V2s * V3 + Tri2ndOrder.CoeffA25 * V1 * V2 * V3s + Tri2ndOrder.CoeffA26 * V1 * V2 * V3;
+		}
+
+		Real64
+		ExponentEquation( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			return Curve.Coeff1 + Curve.Coeff2 * std::pow( V1, Curve.Coeff3 );
+		}
+
+		Real64
+		FanPressureRiseEquation( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const V2, Real64 const, Real64 const )
+		{
+			return V1 * ( Curve.Coeff1 * V1 + Curve.Coeff2 + Curve.Coeff3 * std::sqrt( V2 ) ) + Curve.Coeff4 * V2;
+		}
+
+		Real64
+		ExponentialSkewNormalEquation( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			static Real64 const sqrt_2_inv( 1.0 / std::sqrt( 2.0 ) );
+			Real64 const CoeffZ1( ( V1 - Curve.Coeff1 ) / Curve.Coeff2 );
+			Real64 const CoeffZ2( ( Curve.Coeff4 * V1 * std::exp( Curve.Coeff3 * V1 ) - Curve.Coeff1 ) / Curve.Coeff2 );
+			Real64 const CoeffZ3( -Curve.Coeff1 / Curve.Coeff2 );
+			Real64 const CurveValueNumer( std::exp( -0.5 * ( CoeffZ1 * CoeffZ1 ) ) * ( 1.0 + sign( 1.0, CoeffZ2 ) * std::erf( std::abs( CoeffZ2 ) * sqrt_2_inv ) ) );
+			Real64 const CurveValueDenom( std::exp( -0.5 * ( CoeffZ3 * CoeffZ3 ) ) * ( 1.0 + sign( 1.0, CoeffZ3 ) * std::erf( std::abs( CoeffZ3 ) * sqrt_2_inv ) ) );
+			return CurveValueNumer / CurveValueDenom;
+		}
+
+		Real64
+		SigmoidEquation( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			Real64 const CurveValueExp( std::exp( ( Curve.Coeff3 - V1 ) / Curve.Coeff4 ) );
+			return Curve.Coeff1 + Curve.Coeff2 / std::pow( 1.0 + CurveValueExp, Curve.Coeff5 );
+		}
+
+		Real64
+		RectangularHyperbola1Equation( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			return ( ( Curve.Coeff1 * V1 ) / ( Curve.Coeff2 + V1 ) ) + Curve.Coeff3;
+		}
+
+		Real64
+		RectangularHyperbola2Equation( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			return ( ( Curve.Coeff1 * V1 ) / ( Curve.Coeff2 + V1 ) ) + ( Curve.Coeff3 * V1 );
+		}
+
+		Real64
+		ExponentialDecayEquation( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			return Curve.Coeff1 + Curve.Coeff2 * std::exp( Curve.Coeff3 * V1 );
+		}
+
+		Real64
+		DoubleExponentialDecayEquation( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+		{
+			return Curve.Coeff1 + Curve.Coeff2 * std::exp( Curve.Coeff3 * V1 ) + Curve.Coeff4 * std::exp( Curve.Coeff5 * V1 );
+		}
+
+		// Indexed by CurveType (Linear = 1 ... ChillerPartLoadWithLift = 22); types without an equation evaluate to zero
+		CurveEquation const CurveEquations[] = {
+			NoEquation, // 0: not set
+			LinearEquation, // Linear
+			NoEquation, // BiLinear
+			QuadraticEquation, // Quadratic
+			BiQuadraticEquation, // BiQuadratic
+			CubicEquation, // Cubic
+			QuadraticLinearEquation, // QuadraticLinear
+			BiCubicEquation, // BiCubic
+			TriQuadraticEquation, // TriQuadratic
+			ExponentEquation, // Exponent
+			QuarticEquation, // Quartic
+			NoEquation, // FuncPressDrop
+			NoEquation, // MultiVariableLookup
+			FanPressureRiseEquation, // FanPressureRise
+			ExponentialSkewNormalEquation, // ExponentialSkewNormal
+			SigmoidEquation, // Sigmoid
+			RectangularHyperbola1Equation, // RectangularHyperbola1
+			RectangularHyperbola2Equation, // RectangularHyperbola2
+			ExponentialDecayEquation, // ExponentialDecay
+			DoubleExponentialDecayEquation, // DoubleExponentialDecay
+			QuadLinearEquation, // QuadLinear
+			CubicLinearEquation, // CubicLinear
+			ChillerPartLoadWithLiftEquation // ChillerPartLoadWithLift
+		};
+		int const NumCurveEquations( sizeof( CurveEquations ) / sizeof( CurveEquations[ 0 ] ) );
+
+		inline
+		CurveEquation
+		GetCurveEquation( int const CurveType )
+		{
+			return ( ( CurveType > 0 ) && ( CurveType < NumCurveEquations ) ) ? CurveEquations[ CurveType ] : NoEquation;
+		}
+
+		int const MaxTableInterpolationPoints( 5 ); // largest interpolation order handled by direct table lookup
+
+		// Interpolation points and Lagrange weights along one independent variable of a lookup table
+		struct TableAxisWeights
+		{
+			int Start; // first interpolation point
+			int NumPoints; // number of interpolation points
+			Real64 Weight[ MaxTableInterpolationPoints ]; // Lagrange weight of each interpolation point
+		};
+
+		Array1D< Real64 > const &
+		TableXVar(
+			TableLookupData const & Table,
+			int const IndVarNum
+		)
+		{
+			switch ( IndVarNum ) {
+			case 1: return Table.X1Var;
+			case 2: return Table.X2Var;
+			case 3: return Table.X3Var;
+			case 4: return Table.X4Var;
+			default: return Table.X5Var;
+			}
+		}
+
+		void
+		SetTableAxisWeights(
+			Real64 const V, // independent variable value
+			Array1D< Real64 > const & X, // independent variable grid, strictly increasing
+			Real64 const StepInv, // inverse grid spacing, 0 if unevenly spaced
+			int const InterpolationOrder, // number of points used for interpolation
+			TableAxisWeights & Axis
+		)
+		{
+			// Picks the same interpolation points as DLAG: the points around the first grid value above V,
+			// only two points when extrapolating and a single point when V is on the grid.
+			int const N( X.isize() );
+			int Mid; // first grid point greater than V, N + 1 if none
+			if ( StepInv > 0.0 ) {
+				Real64 const Pos( ( V - X( 1 ) ) * StepInv );
+				Mid = ( Pos < 0.0 ) ? 1 : ( ( Pos >= N ) ? N + 1 : int( Pos ) + 2 );
+				// the spacing is only even to round-off, so settle the guess against the grid itself
+				while ( Mid > 1 && X( Mid - 1 ) > V ) --Mid;
+				while ( Mid <= N && X( Mid ) <= V ) ++Mid;
+			} else {
+				int Low( 1 );
+				Mid = N + 1;
+				while ( Low < Mid ) {
+					int const Test( ( Low + Mid ) / 2 );
+					if ( X( Test ) > V ) {
+						Mid = Test;
+					} else {
+						Low = Test + 1;
+					}
+				}
+			}
+
+			if ( Mid > 1 && X( Mid - 1 ) == V ) {
+				Axis.Start = Mid - 1;
+				Axis.NumPoints = 1;
+				Axis.Weight[ 0 ] = 1.0;
+				return;
+			}
+
+			int NumPoints( min( InterpolationOrder, N ) );
+			int Start;
+			if ( Mid <= N ) {
+				if ( Mid == 1 ) NumPoints = min( NumPoints, 2 );
+				Start = max( Mid - ( NumPoints + 1 ) / 2, 1 );
+				if ( Start + NumPoints - 1 > N ) Start = N - NumPoints + 1;
+			} else {
+				NumPoints = min( NumPoints, 2 );
+				Start = N - NumPoints + 1;
+			}
+
+			Axis.Start = Start;
+			Axis.NumPoints = NumPoints;
+			for ( int J = Start; J < Start + NumPoints; ++J ) { // same operation order as Interpolate_Lagrange
+				Real64 Lagrange( 1.0 );
+				Real64 const X_J( X( J ) );
+				for ( int K = Start; K < Start + NumPoints; ++K ) {
+					if ( K != J ) {
+						Lagrange *= ( ( V - X( K ) ) / ( X_J - X( K ) ) );
+					}
+				}
+				Axis.Weight[ J - Start ] = Lagrange;
+			}
+		}
+
+		Real64
+		InterpolateTableGrid(
+			TableLookupData const & Table,
+			Real64 const V1, // 1st independent variable after limits imposed
+			Real64 const V2, // 2nd independent variable after limits imposed
+			Real64 const V3, // 3rd independent variable after limits imposed
+			Real64 const V4, // 4th independent variable after limits imposed
+			Real64 const V5 // 5th independent variable after limits imposed
+		)
+		{
+			// Interpolates only the points each independent variable needs, reducing the first independent
+			// variable first as the nested DLAG calls in TableLookupObject do, so results are identical.
+			Real64 const V[] = { V1, V2, V3, V4, V5 };
+			TableAxisWeights Axes[ 5 ];
+			for ( int IndVarNum = 1; IndVarNum <= 5; ++IndVarNum ) {
+				TableAxisWeights & Axis( Axes[ IndVarNum - 1 ] );
+				if ( IndVarNum <= Table.NumIndependentVars ) {
+					SetTableAxisWeights( V[ IndVarNum - 1 ], TableXVar( Table, IndVarNum ), Table.XVarStepInv( IndVarNum ), Table.InterpolationOrder, Axis );
+				} else {
+					Axis.Start = 1;
+					Axis.NumPoints = 1;
+					Axis.Weight[ 0 ] = 1.0;
+				}
+			}
+
+			auto const & Stride( Table.ZDataStride );
+			auto const & Z( Table.TableLookupZData );
+			Real64 Value5( 0.0 );
+			for ( int I5 = 0; I5 < Axes[ 4 ].NumPoints; ++I5 ) {
+				int const Offset5( ( Axes[ 4 ].Start + I5 - 1 ) * Stride( 5 ) );
+				Real64 Value4( 0.0 );
+				for ( int I4 = 0; I4 < Axes[ 3 ].NumPoints; ++I4 ) {
+					int const Offset4( Offset5 + ( Axes[ 3 ].Start + I4 - 1 ) * Stride( 4 ) );
+					Real64 Value3( 0.0 );
+					for ( int I3 = 0; I3 < Axes[ 2 ].NumPoints; ++I3 ) {
+						int const Offset3( Offset4 + ( Axes[ 2 ].Start + I3 - 1 ) * Stride( 3 ) );
+						Real64 Value2( 0.0 );
+						for ( int I2 = 0; I2 < Axes[ 1 ].NumPoints; ++I2 ) {
+							int const Offset2( Offset3 + ( Axes[ 1 ].Start + I2 - 1 ) * Stride( 2 ) );
+							Real64 Value1( 0.0 );
+							for ( int I1 = 0; I1 < Axes[ 0 ].NumPoints; ++I1 ) {
+								Value1 += Axes[ 0 ].Weight[ I1 ] * Z[ Offset2 + Axes[ 0 ].Start + I1 - 1 ];
+							}
+							Value2 += Axes[ 1 ].Weight[ I2 ] * Value1;
+						}
+						Value3 += Axes[ 2 ].Weight[ I3 ] * Value2;
+					}
+					Value4 += Axes[ 3 ].Weight[ I4 ] * Value3;
+				}
+				Value5 += Axes[ 4 ].Weight[ I5 ] * Value4;
+			}
+			return Value5;
+		}
+		bool MyBeginTimeStepFlag;
+		int MaxTableNums( 0 ); // Maximum number of numeric input fields in Tables
+		int MaxTableData( 0 ); // Maximum number of numeric input field pairs in Tables
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		int TableNum( 0 ); // Index to TableData structure
+		int TableDataIndex( 0 ); // Loop counter for table data
+		int NumTableEntries( 0 ); // Number of data pairs in table data
+		bool WriteHeaderOnce( true ); // eio header file write flag
+		bool SolveRegressionWriteHeaderOnce( true );
+		bool ErrsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool FrictionFactorErrorHasOccurred( false );
+	}
+
 	// Functions
 
 	// Clears the global data in CurveManager.
@@ -240,6 +567,17 @@ namespace CurveManager {
 		TempTableData.deallocate();
 		Temp2TableData.deallocate();
 		TableLookup.deallocate();
+		MyBeginTimeStepFlag = false;
+		MaxTableNums = 0;
+		MaxTableData = 0;
+		TotalArgs = 0;
+		TableNum = 0;
+		TableDataIndex = 0;
+		NumTableEntries = 0;
+		WriteHeaderOnce = true;
+		SolveRegressionWriteHeaderOnce = true;
+		ErrsFound = false;
+		FrictionFactorErrorHasOccurred = false;
 	}
 
 	void
@@ -336,7 +674,6 @@ namespace CurveManager {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static bool MyBeginTimeStepFlag;
 
 		// need to be careful on where and how resetting curve outputs to some "iactive value" is done
 		// EMS can intercept curves and modify output
@@ -476,13 +813,7 @@ namespace CurveManager {
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		std::string CurrentModuleObject; // for ease in renaming.
-		static int MaxTableNums( 0 ); // Maximum number of numeric input fields in Tables
-		static int MaxTableData( 0 ); // Maximum number of numeric input field pairs in Tables
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 		//   certain object in the input file
-		static int TableNum( 0 ); // Index to TableData structure
-		static int TableDataIndex( 0 ); // Loop counter for table data
-		static int NumTableEntries( 0 ); // Number of data pairs in table data
 		int NumXVar;
 		int NumX2Var;
 		Array1D< Real64 > XVar;
@@ -2717,6 +3048,11 @@ namespace CurveManager {
 
 		}
 
+		// prepare the lookup tables for direct interpolation
+		for ( int TableIndex = 1; TableIndex <= TableLookup.isize(); ++TableIndex ) {
+			SetUpTableLookupGrid( TableIndex );
+		}
+
 	}
 
 	void
@@ -2912,7 +3248,6 @@ namespace CurveManager {
 		int TotalDataSets;
 		int NumbersOffset;
 		int BaseOffset;
-		static bool WriteHeaderOnce( true ); // eio header file write flag
 		std::string CharTableData; // used to echo each line of table data read in to eio file
 		bool EchoTableDataToEio; // logical set equal to global and used to report to eio file
 		bool FileExists;
@@ -3822,7 +4157,7 @@ Label999: ;
 		// returns the value of an equipment performance curve.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The curve equation is looked up by curve type in CurveEquations.
 
 		// REFERENCES:
 		// na
@@ -3847,14 +4182,6 @@ Label999: ;
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 
-		static Real64 const sqrt_2_inv( 1.0 / std::sqrt( 2.0 ) );
-
-		Real64 CoeffZ1; // cpw22Aug2010 Coefficient Z1 in exponential skew normal curve
-		Real64 CoeffZ2; // cpw22Aug2010 Coefficient Z2 in exponential skew normal curve
-		Real64 CoeffZ3; // cpw22Aug2010 Coefficient Z3 in exponential skew normal curve
-		Real64 CurveValueNumer; // cpw22Aug2010 Numerator in in exponential skew normal curve
-		Real64 CurveValueDenom; // cpw22Aug2010 Numerator in in exponential skew normal curve
-		Real64 CurveValueExp; // cpw22Aug2010 Exponential term in sigmoid curve
 		auto const & Curve( PerfCurve( CurveIndex ) );
 
 		Real64 const V1( max( min( Var1, Curve.Var1Max ), Curve.Var1Min ) ); // 1st independent variable after limits imposed
@@ -3862,64 +4189,7 @@ Label999: ;
 		Real64 const V3( Var3.present() ? max( min( Var3, Curve.Var3Max ), Curve.Var3Min ) : 0.0 ); // 3rd independent variable after limits imposed
 		Real64 const V4( Var4.present() ? max( min( Var4, Curve.Var4Max ), Curve.Var4Min ) : 0.0 ); // 4th independent variable after limits imposed
 
-		{ auto const SELECT_CASE_var( Curve.CurveType );
-		if ( SELECT_CASE_var == Linear ) {
-			CurveValue = Curve.Coeff1 + V1 * Curve.Coeff2;
-		} else if ( SELECT_CASE_var == Quadratic ) {
-			CurveValue = Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * Curve.Coeff3 );
-		} else if ( SELECT_CASE_var == QuadLinear ) {
-			CurveValue = Curve.Coeff1 + V1 * Curve.Coeff2 + V2 * Curve.Coeff3 + V3 * Curve.Coeff4 + V4 * Curve.Coeff5;
-		} else if ( SELECT_CASE_var == Cubic ) {
-			CurveValue = Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * ( Curve.Coeff3 + V1 * Curve.Coeff4 ) );
-		} else if ( SELECT_CASE_var == Quartic ) {
-			CurveValue = Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * ( Curve.Coeff3 + V1 * ( Curve.Coeff4 + V1 * Curve.Coeff5 ) ) );
-		} else if ( SELECT_CASE_var == BiQuadratic ) {
-			CurveValue = Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * Curve.Coeff3 ) + V2 * ( Curve.Coeff4 + V2 * Curve.Coeff5 ) + V1 * V2 * Curve.Coeff6;
-		} else if ( SELECT_CASE_var == QuadraticLinear ) {
-			CurveValue = ( Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * Curve.Coeff3 ) ) + ( Curve.Coeff4 + V1 * ( Curve.Coeff5 + V1 * Curve.Coeff6 ) ) * V2;
-		} else if ( SELECT_CASE_var == CubicLinear ) {
-			CurveValue = ( Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * ( Curve.Coeff3 + V1 * Curve.Coeff4 ) ) ) + ( Curve.Coeff5 + V1 * Curve.Coeff6 ) * V2;
-		} else if ( SELECT_CASE_var == BiCubic ) {
-			CurveValue = Curve.Coeff1 + V1 * Curve.Coeff2 + V1 * V1 * Curve.Coeff3 + V2 * Curve.Coeff4 + V2 * V2 * Curve.Coeff5 + V1 * V2 * Curve.Coeff6 + V1 * V1 * V1 * Curve.Coeff7 + V2 * V2 * V2 * Curve.Coeff8 + V1 * V1 * V2 * Curve.Coeff9 + V1 * V2 * V2 * Curve.Coeff10;
-		} else if ( SELECT_CASE_var == ChillerPartLoadWithLift ) {
-			CurveValue = Curve.Coeff1 + Curve.Coeff2*V1 + Curve.Coeff3*V1*V1 + Curve.Coeff4*V2 + Curve.Coeff5*V2*V2 + Curve.Coeff6*V1*V2  + Curve.Coeff7*V1*V1*V1 + Curve.Coeff8*V2*V2*V2 + Curve.Coeff9*V1*V1*V2 + Curve.Coeff10*V1*V2*V2 + Curve.Coeff11*V1*V1*V2*V2 + Curve.Coeff12*V3*V2*V2*V2;
-		} else if ( SELECT_CASE_var == TriQuadratic ) {
-			auto const & Tri2ndOrder( Curve.Tri2ndOrder( 1 ) );
-			auto const V1s( V1 * V1 );
-			auto const V2s( V2 * V2 );
-			auto const V3s( V3 * V3 );
-			CurveValue = Tri2ndOrder.CoeffA0 + Tri2ndOrder.CoeffA1 * V1s + Tri2ndOrder.CoeffA2 * V1 + Tri2ndOrder.CoeffA3 * V2s + Tri2ndOrder.CoeffA4 * V2 + Tri2ndOrder.CoeffA5 * V3s + Tri2ndOrder.CoeffA6 * V3 + Tri2ndOrder.CoeffA7 * V1s * V2s + Tri2ndOrder.CoeffA8 * V1 * V2 + Tri2ndOrder.CoeffA9 * V1 * V2s + Tri2ndOrder.CoeffA10 * V1s * V2 + Tri2ndOrder.CoeffA11 * V1s * V3s + Tri2ndOrder.CoeffA12 * V1 * V3 + Tri2ndOrder.CoeffA13 * V1 * V3s + Tri2ndOrder.CoeffA14 * V1s * V3 + Tri2ndOrder.CoeffA15 * V2s * V3s + Tri2ndOrder.CoeffA16 * V2 * V3 + Tri2ndOrder.CoeffA17 * V2 * V3s + Tri2ndOrder.CoeffA18 * V2s * V3 + Tri2ndOrder.CoeffA19 * V1s * V2s * V3s + Tri2ndOrder.CoeffA20 * V1s * V2s * V3 + Tri2ndOrder.CoeffA21 * V1s * V2 * V3s + Tri2ndOrder.CoeffA22 * V1 * V2s * V3s + Tri2ndOrder.CoeffA23 * V1s * V2 * V3 + Tri2ndOrder.CoeffA24 * V1 * V2s * V3 + Tri2ndOrder.CoeffA25 * V1 * V2 * V3s + Tri2ndOrder.CoeffA26 * V1 * V2 * V3;
-		} else if ( SELECT_CASE_var == Exponent ) {
-			CurveValue = Curve.Coeff1 + Curve.Coeff2 * std::pow( V1, Curve.Coeff3 );
-		} else if ( SELECT_CASE_var == FanPressureRise ) { //cpw22Aug2010 Added Fan Pressure Rise curve
-			CurveValue = V1 * ( Curve.Coeff1 * V1 + Curve.Coeff2 + Curve.Coeff3 * std::sqrt( V2 ) ) + Curve.Coeff4 * V2;
-		} else if ( SELECT_CASE_var == ExponentialSkewNormal ) { //cpw22Aug2010 Added Exponential Skew Normal curve
-			CoeffZ1 = ( V1 - Curve.Coeff1 ) / Curve.Coeff2;
-			CoeffZ2 = ( Curve.Coeff4 * V1 * std::exp( Curve.Coeff3 * V1 ) - Curve.Coeff1 ) / Curve.Coeff2;
-			CoeffZ3 = -Curve.Coeff1 / Curve.Coeff2;
-			//    CurveValueNumer = EXP(-0.5d0 * CoeffZ1**2) * (1.0d0 + SIGN(1.0d0,CoeffZ2) * ErfFunction(ABS(CoeffZ2)/SQRT(2.0d0)))
-			//    CurveValueDenom = EXP(-0.5d0 * CoeffZ3**2) * (1.0d0 + SIGN(1.0d0,CoeffZ3) * ErfFunction(ABS(CoeffZ3)/SQRT(2.0d0)))
-			CurveValueNumer = std::exp( -0.5 * ( CoeffZ1 * CoeffZ1 ) ) * ( 1.0 + sign( 1.0, CoeffZ2 ) * std::erf( std::abs( CoeffZ2 ) * sqrt_2_inv ) );
-			CurveValueDenom = std::exp( -0.5 * ( CoeffZ3 * CoeffZ3 ) ) * ( 1.0 + sign( 1.0, CoeffZ3 ) * std::erf( std::abs( CoeffZ3 ) * sqrt_2_inv ) );
-			CurveValue = CurveValueNumer / CurveValueDenom;
-		} else if ( SELECT_CASE_var == Sigmoid ) { //cpw22Aug2010 Added Sigmoid curve
-			CurveValueExp = std::exp( ( Curve.Coeff3 - V1 ) / Curve.Coeff4 );
-			CurveValue = Curve.Coeff1 + Curve.Coeff2 / std::pow( 1.0 + CurveValueExp, Curve.Coeff5 );
-		} else if ( SELECT_CASE_var == RectangularHyperbola1 ) { //cpw22Aug2010 Added Rectangular Hyperbola Type 1 curve
-			CurveValueNumer = Curve.Coeff1 * V1;
-			CurveValueDenom = Curve.Coeff2 + V1;
-			CurveValue = ( CurveValueNumer / CurveValueDenom ) + Curve.Coeff3;
-		} else if ( SELECT_CASE_var == RectangularHyperbola2 ) { //cpw22Aug2010 Added Rectangular Hyperbola Type 2 curve
-			CurveValueNumer = Curve.Coeff1 * V1;
-			CurveValueDenom = Curve.Coeff2 + V1;
-			CurveValue = ( CurveValueNumer / CurveValueDenom ) + ( Curve.Coeff3 * V1 );
-		} else if ( SELECT_CASE_var == ExponentialDecay ) { //cpw22Aug2010 Added Exponential Decay curve
-			CurveValue = Curve.Coeff1 + Curve.Coeff2 * std::exp( Curve.Coeff3 * V1 );
-		} else if ( SELECT_CASE_var == DoubleExponentialDecay ) { //ykt Jul 2011 Added Double Exponential Decay curve
-			CurveValue = Curve.Coeff1 + Curve.Coeff2 * std::exp( Curve.Coeff3 * V1 ) + Curve.Coeff4 * std::exp( Curve.Coeff5 * V1 );
-		} else {
-			CurveValue = 0.0;
-		}}
+		CurveValue = GetCurveEquation( Curve.CurveType )( Curve, V1, V2, V3, V4 );
 
 		if ( Curve.CurveMinPresent ) CurveValue = max( CurveValue, Curve.CurveMin );
 		if ( Curve.CurveMaxPresent ) CurveValue = min( CurveValue, Curve.CurveMax );
@@ -4112,6 +4382,61 @@ Label999: ;
 
 	}
 
+	void
+	SetUpTableLookupGrid( int const TableIndex ) // index of table in TableLookup array
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Prepares a lookup table for direct interpolation in TableLookupObject.
+
+		// METHODOLOGY EMPLOYED:
+		// Tables with strictly increasing independent variables are interpolated directly on their grid:
+		// each independent variable is located by index arithmetic when evenly spaced (by bisection otherwise)
+		// and only the interpolation points that are needed are visited, using the data strides stored here.
+		// Other tables keep using the general DLAG interpolation.
+
+		auto & Table( TableLookup( TableIndex ) );
+		Table.GridSetUp = true;
+		Table.DirectLookup = false;
+
+		int const NumIndVars( Table.NumIndependentVars );
+		if ( NumIndVars < 1 || NumIndVars > 5 ) return;
+		if ( Table.InterpolationOrder < 1 || Table.InterpolationOrder > MaxTableInterpolationPoints ) return;
+
+		// TableLookupZData is dimensioned (X5,X4,X3,X2,X1) with the 1st independent variable varying fastest
+		auto const & Z( Table.TableLookupZData );
+		int const ZDataSize[] = { Z.isize5(), Z.isize4(), Z.isize3(), Z.isize2(), Z.isize1() };
+		Table.XVarStepInv.dimension( 5, 0.0 );
+		Table.ZDataStride.dimension( 5, 0 );
+		int Stride( 1 );
+		for ( int IndVarNum = 1; IndVarNum <= 5; ++IndVarNum ) {
+			Table.ZDataStride( IndVarNum ) = Stride;
+			Stride *= ZDataSize[ IndVarNum - 1 ];
+		}
+
+		for ( int IndVarNum = 1; IndVarNum <= NumIndVars; ++IndVarNum ) {
+			auto const & X( TableXVar( Table, IndVarNum ) );
+			int const N( X.isize() );
+			if ( N < 1 || N != ZDataSize[ IndVarNum - 1 ] ) return;
+			for ( int I = 2; I <= N; ++I ) {
+				if ( X( I ) <= X( I - 1 ) ) return;
+			}
+			if ( N > 1 ) {
+				Real64 const Step( ( X( N ) - X( 1 ) ) / ( N - 1 ) );
+				bool EvenlySpaced( true );
+				for ( int I = 2; I < N; ++I ) {
+					if ( std::abs( X( I ) - ( X( 1 ) + ( I - 1 ) * Step ) ) > 1.0e-6 * Step ) {
+						EvenlySpaced = false;
+						break;
+					}
+				}
+				if ( EvenlySpaced ) Table.XVarStepInv( IndVarNum ) = 1.0 / Step;
+			}
+		}
+		Table.DirectLookup = true;
+
+	}
+
 	Real64
 	TableLookupObject(
 		int const CurveIndex, // index of curve in curve array
@@ -4134,7 +4459,8 @@ Label999: ;
 		// returns the value of an equipment performance table lookup.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// Tables prepared by SetUpTableLookupGrid are interpolated directly on their grid, otherwise
+		// by nested calls to DLAG.  Both give the same result.
 
 		// REFERENCES:
 		// na
@@ -4280,7 +4606,11 @@ Label999: ;
 			V5 = 0.0;
 		}
 
-		{ auto const SELECT_CASE_var( TableLookup( TableIndex ).NumIndependentVars );
+		if ( ! TableLookup( TableIndex ).GridSetUp ) SetUpTableLookupGrid( TableIndex );
+
+		if ( TableLookup( TableIndex ).DirectLookup ) {
+			TableValue = InterpolateTableGrid( TableLookup( TableIndex ), V1, V2, V3, V4, V5 );
+		} else { auto const SELECT_CASE_var( TableLookup( TableIndex ).NumIndependentVars );
 		if ( SELECT_CASE_var == 1 ) {
 			NX = TableLookup( TableIndex ).NumX1Vars;
 			NY = 1;
@@ -4530,7 +4860,6 @@ Label999: ;
 		Array1D< Real64 > Results; // performance curve coefficients
 		Array2D< Real64 > A; // linear algebra matrix
 		std::string StrCurve; // string representation of curve type
-		static bool WriteHeaderOnce( true );
 		bool EchoTableDataToEio; // logical set equal to global and used to report to eio file
 
 		// Formats
@@ -4903,9 +5232,9 @@ Label999: ;
 
 		// echo new curve object to eio file
 		if ( EchoTableDataToEio ) {
-			if ( WriteHeaderOnce ) {
+			if ( SolveRegressionWriteHeaderOnce ) {
 				gio::write( OutputFileInits, Format_110 );
-				WriteHeaderOnce = false;
+				SolveRegressionWriteHeaderOnce = false;
 			}
 
 			gio::write( OutputFileInits, Format_130 );
@@ -5597,7 +5926,6 @@ Label999: ;
 		int NumAlphas; // Number of Alphas for each GetObjectItem call
 		int NumNumbers; // Number of Numbers for each GetObjectItem call
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrsFound( false ); // Set to true if errors in input, fatal at end of routine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int CurveNum;
@@ -5907,7 +6235,6 @@ Label999: ;
 		Real64 Term3;
 		std::string RR;
 		std::string Re;
-		static bool FrictionFactorErrorHasOccurred( false );
 
 		//Check for no flow before calculating values
 		if ( ReynoldsNumber == 0.0 ) {
@@ -388,6 +388,10 @@ namespace CurveManager {
 		int NumX5Vars; // Number of variables for independent variable #5
 		Array1D< Real64 > X5Var;
 		Array5D< Real64 > TableLookupZData;
+		bool GridSetUp; // true once SetUpTableLookupGrid has processed this table
+		bool DirectLookup; // true if the grid allows direct lookup, otherwise DLAG is used
+		Array1D< Real64 > XVarStepInv; // inverse spacing of each evenly spaced independent variable (0 if uneven)
+		Array1D_int ZDataStride; // distance in TableLookupZData between neighbouring values of each independent variable
 
 		// Default Constructor
 		TableLookupData() :
@@ -397,7 +401,9 @@ namespace CurveManager {
 			NumX2Vars( 0 ),
 			NumX3Vars( 0 ),
 			NumX4Vars( 0 ),
-			NumX5Vars( 0 )
+			NumX5Vars( 0 ),
+			GridSetUp( false ),
+			DirectLookup( false )
 		{}
 
 	};
@@ -482,6 +488,9 @@ namespace CurveManager {
 		Optional< Real64 const > Var3 = _ // 3rd independent variable
 	);
 
+	void
+	SetUpTableLookupGrid( int const TableIndex ); // index of table in TableLookup array
+
 	Real64
 	TableLookupObject(
 		int const CurveIndex, // index of curve in curve array
@@ -79,6 +79,7 @@
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
+#include <DataSystemVariables.hh>
 #include <DataWater.hh>
 #include <DataZoneEnergyDemands.hh>
 #include <DataZoneEquipment.hh>
@@ -212,6 +213,22 @@ namespace DXCoils {
 	int const FuelTypeOtherFuel1( 8 ); // Fuel type for other fuel #1
 	int const FuelTypeOtherFuel2( 9 ); // Fuel type for other fuel #2
 
+	// Memoized coil performance calculations (only used when the DXCOIL_MEMO environment variable is set)
+	int const Doe2FullLoadMemo( 1 ); // full load capacity and SHR of CalcDoe2DXCoil
+	int const TotCapSHRMemo( 2 ); // CalcTotCapSHR
+	int const VarSpeedTotCapSHRMemo( 3 ); // VariableSpeedCoils::CalcTotCapSHR_VSWSHP
+	int const NumCoilPerfMemos( 3 );
+	Array1D_string const cCoilPerfMemoNames( NumCoilPerfMemos, { "CalcDoe2DXCoil", "CalcTotCapSHR", "CalcTotCapSHR_VSWSHP" } );
+
+	// Resolution of the memoized inputs, well below the accuracy of the performance curves
+	Real64 const MemoTempQuantum( 1.0e-4 ); // [C]
+	Real64 const MemoHumRatQuantum( 1.0e-7 ); // [kgWater/kgDryAir]
+	Real64 const MemoEnthalpyQuantum( 0.1 ); // [J/kg]
+	Real64 const MemoPressureQuantum( 0.1 ); // [Pa]
+	Real64 const MemoMassFlowQuantum( 1.0e-7 ); // [kg/s]
+	Real64 const MemoRatioQuantum( 1.0e-7 ); // [-] flow ratios, bypass factors and speed ratios
+	Real64 const MemoCapacityQuantum( 1.0e-3 ); // [W]
+
 	// DERIVED TYPE DEFINITIONS
 
 	// MODULE VARIABLE DECLARATIONS:
@@ -266,6 +283,57 @@ namespace DXCoils {
 	// Object Data
 	Array1D< DXCoilData > DXCoil;
 	Array1D< DXCoilNumericFieldData > DXCoilNumericFields;
+	Array1D< CoilPerfMemoData > CoilPerfMemo;
+
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		Real64 S1RuntimeFraction( 0.0 ); // Stage 1   Run time fraction (overlaps with stage1&2 run time)
+		Real64 S12RuntimeFraction( 0.0 ); // Stage 1&2 Run time fraction (overlaps with stage1 run time)
+		Real64 MinAirHumRat( 0.0 ); // minimum of the inlet air humidity ratio and the outlet air humidity ratio
+		bool GetDXCoilsErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		int MaxNumbers( 0 ); // Maximum number of numeric input fields
+		int MaxAlphas( 0 ); // Maximum number of alpha input fields
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		Real64 SmallDifferenceTest( 0.00000001 );
+		Array1D_bool MyEnvrnFlag; // One time environment flag
+		Array1D_bool MySizeFlag; // One time sizing flag
+		bool CrankcaseHeaterReportVarFlag( true ); // One time flag used to report crankcase heater power for non-HP coils
+		bool InitDXCoilErrorsFound( false ); // TRUE when errors found
+		Real64 CompAmbTemp( 0.0 ); // Ambient temperature at compressor
+		Real64 CurrentEndTime( 0.0 ); // end time of time step for current simulation time step
+		Real64 CalcDoe2DXCoilMinAirHumRat( 0.0 ); // minimum of the inlet air humidity ratio and the outlet air humidity ratio
+		Real64 CalcVRFCoolingCoilCompAmbTemp( 0.0 ); // Ambient temperature at compressor
+		Real64 CalcVRFCoolingCoilCurrentEndTime( 0.0 ); // end time of time step for current simulation time step
+		Real64 CalcVRFCoolingCoilMinAirHumRat( 0.0 ); // minimum of the inlet air humidity ratio and the outlet air humidity ratio
+		int CalcDXHeatingCoilMode( 1 ); // Performance mode for MultiMode DX coil; Always 1 for other coil types
+		Real64 CalcMultiSpeedDXCoilMinAirHumRat( 0.0 ); // minimum of the inlet air humidity ratio and the outlet air humidity ratio
+		int CalcMultiSpeedDXCoilMode( 1 ); // Performance mode for MultiMode DX coil; Always 1 for other coil types
+		Real64 CalcCBFSmallDifferenceTest( 0.00000001 );
+		bool CBFErrors( false ); // Set to true if errors in CBF calculation, fatal at end of routine
+		Real64 CalcMultiSpeedDXCoilCoolingMinAirHumRat( 0.0 ); // minimum of the inlet air humidity ratio and the outlet air humidity ratio
+		int DXMode( 1 ); // Performance mode for MultiMode DX coil; Always 1 for other coil types
+		Real64 NetCoolingCapRated( 0.0 ); // Net Cooling Coil capacity at Rated conditions, accounting for supply fan heat [W]
+		Real64 EER( 0.0 ); // Energy Efficiency Ratio in SI [W/W]
+		Real64 IEER( 0.0 ); // Integerated Energy Efficiency Ratio in SI [W/W]
+		Real64 TotCapTempModFac( 0.0 ); // Total capacity modifier (function of entering wetbulb, outside drybulb) [-]
+		Real64 TotCapFlowModFac( 0.0 ); // Total capacity modifier (function of actual supply air flow vs rated flow) [-]
+		Real64 EIRTempModFac( 0.0 ); // EIR modifier (function of entering wetbulb, outside drybulb) [-]
+		Real64 EIRFlowModFac( 0.0 ); // EIR modifier (function of actual supply air flow vs rated flow) [-]
+		Real64 TempDryBulb_Leaving_Apoint( 0.0 );
+		Real64 AccuracyTolerance( 0.2 ); // tolerance in AHRI 340/360 Table 6 note 1
+		int MaximumIterations( 500 );
+		bool CalcTwoSpeedDXCoilStandardRatingErrorsFound( false );
+		bool OneTimeEIOHeaderWrite( true );
+		bool GetFanIndexForTwoSpeedCoilErrorsFound( false );
+		Real64 CalcVRFCoolingCoil_FluidTCtrlCompAmbTemp( 0.0 ); // Ambient temperature at compressor
+		Real64 CalcVRFCoolingCoil_FluidTCtrlCurrentEndTime( 0.0 ); // end time of time step for current simulation time step
+		Real64 CalcVRFCoolingCoil_FluidTCtrlMinAirHumRat( 0.0 ); // minimum of the inlet air humidity ratio and the outlet air humidity ratio
+		int CalcVRFHeatingCoil_FluidTCtrlMode( 1 ); // Performance mode for MultiMode DX coil. Always 1 for other coil types
+	}
 
 	// Functions
 
@@ -596,7 +664,6 @@ namespace DXCoils {
 		Real64 S1SensCoolingEnergyRate; // Stage 1   Sensible cooling rate [W]
 		Real64 S1LatCoolingEnergyRate; // Stage 1   Latent cooling rate [W]
 		Real64 S1ElecCoolingPower; // Stage 1   Electric power input [W]
-		static Real64 S1RuntimeFraction( 0.0 ); // Stage 1   Run time fraction (overlaps with stage1&2 run time)
 		Real64 S1EvapCondPumpElecPower; // Stage 1   Evaporative condenser pump electric power input [W]
 		Real64 S1EvapWaterConsumpRate; // Stage 1   Evap condenser water consumption rate [m3/s]
 		Real64 S1CrankcaseHeaterPower; // Stage 1   Report variable for average crankcase heater power [W]
@@ -613,13 +680,11 @@ namespace DXCoils {
 		Real64 S12LatCoolingEnergyRate; // Stage 1&2 Latent cooling rate [W]
 		Real64 S12ElecCoolingPower; // Stage 1&2 Electric power input [W]
 		Real64 S12ElecCoolFullLoadPower; // Stage 1&2 Electric power input at full load (PLR=1) [W]
-		static Real64 S12RuntimeFraction( 0.0 ); // Stage 1&2 Run time fraction (overlaps with stage1 run time)
 		Real64 S12EvapCondPumpElecPower; // Stage 1&2 Evaporative condenser pump electric power input [W]
 		Real64 S12EvapWaterConsumpRate; // Stage 1&2 Evap condenser water consumption rate [m3/s]
 		Real64 S12CrankcaseHeaterPower; // Stage 1&2 Report variable for average crankcase heater power [W]
 		Real64 S2PLR; // Stage 2   Ratio of actual sensible cooling load to
 		//           steady-state sensible cooling capacity
-		static Real64 MinAirHumRat( 0.0 ); // minimum of the inlet air humidity ratio and the outlet air humidity ratio
 		Real64 TSat; // calculation to avoid calling psych routines twice
 		Real64 NodePress; // Pressure at condenser inlet node (Pa)
 		// FLOW
@@ -961,7 +1026,6 @@ namespace DXCoils {
 		int IOStatus; // Input status returned from GetObjectItem
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		int DXHPWaterHeaterCoilNum; // Loop index for 1,NumDXHeatPumpWaterHeaterCoils
 		int CapacityStageNum; // Loop index for 1,Number of capacity stages
 		int DehumidModeNum; // Loop index for 1,Number of enhanced dehumidification modes
@@ -987,9 +1051,6 @@ namespace DXCoils {
 		Array1D< Real64 > Numbers; // Numeric input items for object
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int MaxNumbers( 0 ); // Maximum number of numeric input fields
-		static int MaxAlphas( 0 ); // Maximum number of alpha input fields
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 		//   certain object in the input file
 		Real64 MinCurveVal; // used for testing PLF curve output
 		Real64 MinCurvePLR; // used for testing PLF curve output
@@ -1117,12 +1178,12 @@ namespace DXCoils {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), DXCoil, DXCoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, Alphas( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 			DXCoil( DXCoilNum ).Name = Alphas( 1 );
 			// Initialize DataHeatBalance heat reclaim variable name for use by heat reclaim coils
@@ -1138,7 +1199,7 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cAlphaFields( 2 ) + "=\"" + Alphas( 2 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}
 			}
 			DXCoil( DXCoilNum ).RatedTotCap( 1 ) = Numbers( 1 );
@@ -1147,15 +1208,15 @@ namespace DXCoils {
 			if ( DXCoil( DXCoilNum ).RatedCOP( 1 ) <= 0.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 3 ) + " must be > 0.0, entered value=[" + TrimSigDigits( Numbers( 3 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).RatedAirVolFlowRate( 1 ) = Numbers( 4 );
 			DXCoil( DXCoilNum ).FanPowerPerEvapAirFlowRate( 1 ) = Numbers( 5 );
 
-			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 3 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 3 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
 
-			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 4 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 4 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			TestCompSet( CurrentModuleObject, Alphas( 1 ), Alphas( 3 ), Alphas( 4 ), "Air Nodes" );
 
@@ -1168,7 +1229,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 5 ) + "=\"" + Alphas( 5 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				// Verify Curve Object, only legal type is BiQuadratic
 				{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).CCapFTemp( 1 ) ) );
@@ -1180,7 +1241,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...illegal " + cAlphaFields( 5 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).CCapFTemp( 1 ) ) );
 					ShowContinueError( "Curve type must be Biquadratic." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}}
 			}
 
@@ -1193,7 +1254,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 6 ) + "=\"" + Alphas( 6 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				// Verify Curve Object, only legal type is Quadratic
 				{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).CCapFFlow( 1 ) ) );
@@ -1205,7 +1266,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...illegal " + cAlphaFields( 6 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).CCapFFlow( 1 ) ) );
 					ShowContinueError( "Curve type must be Quadratic or Cubic." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}}
 			}
 
@@ -1218,7 +1279,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 7 ) + "=\"" + Alphas( 7 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				// Verify Curve Object, only legal type is BiQuadratic
 				{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).EIRFTemp( 1 ) ) );
@@ -1230,7 +1291,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...illegal " + cAlphaFields( 7 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).EIRFTemp( 1 ) ) );
 					ShowContinueError( "Curve type must be Biquadratic." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}}
 			}
 
@@ -1243,7 +1304,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 8 ) + "=\"" + Alphas( 8 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				// Verify Curve Object, only legal type is Quadratic
 				{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).EIRFFlow( 1 ) ) );
@@ -1256,7 +1317,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...illegal " + cAlphaFields( 8 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).EIRFFlow( 1 ) ) );
 					ShowContinueError( "Curve type must be Quadratic or Cubic." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}}
 			}
 
@@ -1269,7 +1330,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 9 ) + "=\"" + Alphas( 9 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				// Verify Curve Object, only legal types are Quadratic or Cubic
 				{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).PLFFPLR( 1 ) ) );
@@ -1282,10 +1343,10 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...illegal " + cAlphaFields( 9 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).PLFFPLR( 1 ) ) );
 					ShowContinueError( "Curve type must be Quadratic or Cubic." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}}
 
-				if ( ! ErrorsFound ) {
+				if ( ! GetDXCoilsErrorsFound ) {
 					//     Test PLF curve minimum and maximum. Cap if less than 0.7 or greater than 1.0.
 					MinCurveVal = 999.0;
 					MaxCurveVal = -999.0;
@@ -1307,7 +1368,7 @@ namespace DXCoils {
 						ShowContinueError( "..." + cAlphaFields( 9 ) + "=\"" + Alphas( 9 ) + "\" has out of range values." );
 						ShowContinueError( "...Curve minimum must be >= 0.7, curve min at PLR = " + TrimSigDigits( MinCurvePLR, 2 ) + " is " + TrimSigDigits( MinCurveVal, 3 ) );
 						ShowContinueError( "...Setting curve minimum to 0.7 and simulation continues." );
-						SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), ErrorsFound, 0.7, _ );
+						SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), GetDXCoilsErrorsFound, 0.7, _ );
 					}
 
 					if ( MaxCurveVal > 1.0 ) {
@@ -1315,7 +1376,7 @@ namespace DXCoils {
 						ShowContinueError( "..." + cAlphaFields( 9 ) + " = " + Alphas( 9 ) + " has out of range value." );
 						ShowContinueError( "...Curve maximum must be <= 1.0, curve max at PLR = " + TrimSigDigits( MaxCurvePLR, 2 ) + " is " + TrimSigDigits( MaxCurveVal, 3 ) );
 						ShowContinueError( "...Setting curve maximum to 1.0 and simulation continues." );
-						SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), ErrorsFound, _, 1.0 );
+						SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), GetDXCoilsErrorsFound, _, 1.0 );
 					}
 
 				}
@@ -1337,7 +1398,7 @@ namespace DXCoils {
 			if ( lAlphaBlanks( 10 ) ) {
 				DXCoil( DXCoilNum ).CondenserInletNodeNum( 1 ) = 0;
 			} else {
-				DXCoil( DXCoilNum ).CondenserInletNodeNum( 1 ) = GetOnlySingleNode( Alphas( 10 ), ErrorsFound, CurrentModuleObject, DXCoil( DXCoilNum ).Name, NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsNotParent );
+				DXCoil( DXCoilNum ).CondenserInletNodeNum( 1 ) = GetOnlySingleNode( Alphas( 10 ), GetDXCoilsErrorsFound, CurrentModuleObject, DXCoil( DXCoilNum ).Name, NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsNotParent );
 
 				if ( ! CheckOutAirNodeNumber( DXCoil( DXCoilNum ).CondenserInletNodeNum( 1 ) ) ) {
 					ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", may be invalid" );
@@ -1355,7 +1416,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cAlphaFields( 11 ) + "=\"" + Alphas( 11 ) + "\":" );
 				ShowContinueError( "...must be AirCooled or EvaporativelyCooled." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).EvapCondEffect( 1 ) = Numbers( 10 );
@@ -1363,7 +1424,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 10 ) + " cannot be < 0.0 or > 1.0." );
 				ShowContinueError( "...entered value=[" + TrimSigDigits( Numbers( 10 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).EvapCondAirFlow( 1 ) = Numbers( 11 );
@@ -1371,7 +1432,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 11 ) + " cannot be < 0.0." );
 				ShowContinueError( "...entered value=[" + TrimSigDigits( Numbers( 11 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).EvapCondPumpElecNomPower( 1 ) = Numbers( 12 );
@@ -1379,7 +1440,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 12 ) + " cannot be < 0.0." );
 				ShowContinueError( "...entered value=[" + TrimSigDigits( Numbers( 12 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			//Set crankcase heater capacity
@@ -1388,7 +1449,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 13 ) + " cannot be < 0.0." );
 				ShowContinueError( "...entered value=[" + TrimSigDigits( Numbers( 13 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			//Set crankcase heater cutout temperature
@@ -1405,7 +1466,7 @@ namespace DXCoils {
 				DXCoil( DXCoilNum ).EvapWaterSupplyMode = WaterSupplyFromMains;
 			} else {
 				DXCoil( DXCoilNum ).EvapWaterSupplyMode = WaterSupplyFromTank;
-				SetupTankDemandComponent( DXCoil( DXCoilNum ).Name, CurrentModuleObject, DXCoil( DXCoilNum ).EvapWaterSupplyName, ErrorsFound, DXCoil( DXCoilNum ).EvapWaterSupTankID, DXCoil( DXCoilNum ).EvapWaterTankDemandARRID );
+				SetupTankDemandComponent( DXCoil( DXCoilNum ).Name, CurrentModuleObject, DXCoil( DXCoilNum ).EvapWaterSupplyName, GetDXCoilsErrorsFound, DXCoil( DXCoilNum ).EvapWaterSupTankID, DXCoil( DXCoilNum ).EvapWaterTankDemandARRID );
 			}
 
 			//A13; \field Name of Water Storage Tank for Condensate Collection
@@ -1414,7 +1475,7 @@ namespace DXCoils {
 				DXCoil( DXCoilNum ).CondensateCollectMode = CondensateDiscarded;
 			} else {
 				DXCoil( DXCoilNum ).CondensateCollectMode = CondensateToTank;
-				SetupTankSupplyComponent( DXCoil( DXCoilNum ).Name, CurrentModuleObject, DXCoil( DXCoilNum ).CondensateCollectName, ErrorsFound, DXCoil( DXCoilNum ).CondensateTankID, DXCoil( DXCoilNum ).CondensateTankSupplyARRID );
+				SetupTankSupplyComponent( DXCoil( DXCoilNum ).Name, CurrentModuleObject, DXCoil( DXCoilNum ).CondensateCollectName, GetDXCoilsErrorsFound, DXCoil( DXCoilNum ).CondensateTankID, DXCoil( DXCoilNum ).CondensateTankSupplyARRID );
 			}
 
 			//   Basin heater power as a function of temperature must be greater than or equal to 0
@@ -1423,7 +1484,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 15 ) + " must be >= 0.0." );
 				ShowContinueError( "...entered value=[" + TrimSigDigits( Numbers( 15 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).BasinHeaterSetPointTemp = Numbers( 16 );
@@ -1461,7 +1522,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 15 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).SHRFTemp( 1 ) ) );
 						ShowContinueError( "Curve type must be Biquadratic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}}
 				}
 			}
@@ -1480,7 +1541,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 16 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).SHRFFlow( 1 ) ) );
 						ShowContinueError( "Curve type must be quadratic or cubic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}}
 				}
 			}
@@ -1512,7 +1573,7 @@ namespace DXCoils {
 
 		} // end of the Doe2 DX coil loop
 
-		if ( ErrorsFound ) {
+		if ( GetDXCoilsErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in getting " + CurrentModuleObject + " input. Preceding condition(s) causes termination." );
 		}
 
@@ -1527,12 +1588,12 @@ namespace DXCoils {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), DXCoil, DXCoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, Alphas( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 			DXCoil( DXCoilNum ).Name = Alphas( 1 );
 			// Initialize DataHeatBalance heat reclaim variable name for use by heat reclaim coils
@@ -1548,13 +1609,13 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cAlphaFields( 2 ) + "=\"" + Alphas( 2 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}
 			}
 
-			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 3 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 3 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
 
-			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 4 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 4 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			TestCompSet( CurrentModuleObject, Alphas( 1 ), Alphas( 3 ), Alphas( 4 ), "Air Nodes" );
 
@@ -1563,7 +1624,7 @@ namespace DXCoils {
 			if ( DXCoil( DXCoilNum ).CrankcaseHeaterCapacity < 0.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 1 ) + " must be >= 0.0, entered value=[" + TrimSigDigits( Numbers( 1 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			//Set crankcase heater cutout temperature
@@ -1576,7 +1637,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "...illegal " + cNumericFields( 3 ) + " = " + TrimSigDigits( DXCoil( DXCoilNum ).NumCapacityStages ) );
 				ShowContinueError( "...Valid range is 1 to " + TrimSigDigits( MaxCapacityStages ) );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			//  Number of enhanced dehumidification modes
@@ -1586,7 +1647,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "...illegal " + cNumericFields( 4 ) + " = " + TrimSigDigits( DXCoil( DXCoilNum ).NumDehumidModes ) );
 				ShowContinueError( "...Valid range is 0 to " + TrimSigDigits( MaxDehumidModes ) );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			//  Set starting alpha index for coil performance inputs
@@ -1602,7 +1663,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not enough remaining fields for specified Number of Operating Modes." );
 						ShowContinueError( "...Need additional Coil Performance Object Type and Coil Performance Object Name fields." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					} else {
 						PerfObjectType = Alphas( AlphaIndex );
 						PerfObjectName = Alphas( AlphaIndex + 1 );
@@ -1614,7 +1675,7 @@ namespace DXCoils {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 							ShowContinueError( "...illegal " + cAlphaFields( AlphaIndex ) + "=\"" + PerfObjectType + "\"." );
 							ShowContinueError( "Must be \"CoilPerformance:DX:Cooling\"." );
-							ErrorsFound = true;
+							GetDXCoilsErrorsFound = true;
 						}
 						DXCoil( DXCoilNum ).CoilPerformanceName( PerfModeNum ) = PerfObjectName;
 						// Get for CoilPerformance object
@@ -1646,7 +1707,7 @@ namespace DXCoils {
 									ShowSevereError( RoutineName + PerfObjectType + "=\"" + PerfObjectName + "\", invalid" );
 									ShowContinueError( "...not found " + cAlphaFields2( 2 ) + "=\"" + Alphas2( 2 ) + "\"." );
 								}
-								ErrorsFound = true;
+								GetDXCoilsErrorsFound = true;
 							} else {
 								// Verify Curve Object, only legal type is BiQuadratic
 								{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).CCapFTemp( PerfModeNum ) ) );
@@ -1658,7 +1719,7 @@ namespace DXCoils {
 									ShowSevereError( RoutineName + PerfObjectType + "=\"" + PerfObjectName + "\", invalid" );
 									ShowContinueError( "...illegal " + cAlphaFields2( 2 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).CCapFTemp( PerfModeNum ) ) );
 									ShowContinueError( "Curve type must be BiQuadratic." );
-									ErrorsFound = true;
+									GetDXCoilsErrorsFound = true;
 								}}
 							}
 
@@ -1671,7 +1732,7 @@ namespace DXCoils {
 									ShowSevereError( RoutineName + PerfObjectType + "=\"" + PerfObjectName + "\", invalid" );
 									ShowContinueError( "...not found " + cAlphaFields2( 3 ) + "=\"" + Alphas2( 3 ) + "\"." );
 								}
-								ErrorsFound = true;
+								GetDXCoilsErrorsFound = true;
 							} else {
 								// Verify Curve Object, only legal type is Quadratic
 								{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).CCapFFlow( PerfModeNum ) ) );
@@ -1684,7 +1745,7 @@ namespace DXCoils {
 									ShowSevereError( RoutineName + PerfObjectType + "=\"" + PerfObjectName + "\", invalid" );
 									ShowContinueError( "...illegal " + cAlphaFields2( 3 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).CCapFFlow( PerfModeNum ) ) );
 									ShowContinueError( "Curve type must be Quadratic or Cubic." );
-									ErrorsFound = true;
+									GetDXCoilsErrorsFound = true;
 								}}
 							}
 
@@ -1697,7 +1758,7 @@ namespace DXCoils {
 									ShowSevereError( RoutineName + PerfObjectType + "=\"" + PerfObjectName + "\", invalid" );
 									ShowContinueError( "...not found " + cAlphaFields2( 4 ) + "=\"" + Alphas2( 4 ) + "\"." );
 								}
-								ErrorsFound = true;
+								GetDXCoilsErrorsFound = true;
 							} else {
 								// Verify Curve Object, only legal type is BiQuadratic
 								{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).EIRFTemp( PerfModeNum ) ) );
@@ -1709,7 +1770,7 @@ namespace DXCoils {
 									ShowSevereError( RoutineName + PerfObjectType + "=\"" + PerfObjectName + "\", invalid" );
 									ShowContinueError( "...illegal " + cAlphaFields2( 4 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).EIRFTemp( PerfModeNum ) ) );
 									ShowContinueError( "Curve type must be BiQuadratic." );
-									ErrorsFound = true;
+									GetDXCoilsErrorsFound = true;
 								}}
 							}
 
@@ -1722,7 +1783,7 @@ namespace DXCoils {
 									ShowSevereError( RoutineName + PerfObjectType + "=\"" + PerfObjectName + "\", invalid" );
 									ShowContinueError( "...not found " + cAlphaFields2( 5 ) + "=\"" + Alphas2( 5 ) + "\"." );
 								}
-								ErrorsFound = true;
+								GetDXCoilsErrorsFound = true;
 							} else {
 								// Verify Curve Object, only legal type is Quadratic
 								{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).EIRFFlow( PerfModeNum ) ) );
@@ -1735,7 +1796,7 @@ namespace DXCoils {
 									ShowSevereError( RoutineName + PerfObjectType + "=\"" + PerfObjectName + "\", invalid" );
 									ShowContinueError( "...illegal " + cAlphaFields2( 5 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).EIRFFlow( PerfModeNum ) ) );
 									ShowContinueError( "Curve type must be Quadratic or Cubic." );
-									ErrorsFound = true;
+									GetDXCoilsErrorsFound = true;
 								}}
 							}
 
@@ -1748,7 +1809,7 @@ namespace DXCoils {
 									ShowSevereError( RoutineName + PerfObjectType + "=\"" + PerfObjectName + "\", invalid" );
 									ShowContinueError( "...not found " + cAlphaFields2( 6 ) + "=\"" + Alphas2( 6 ) + "\"." );
 								}
-								ErrorsFound = true;
+								GetDXCoilsErrorsFound = true;
 							} else {
 								// Verify Curve Object, only legal types are Quadratic or Cubic
 								{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).PLFFPLR( PerfModeNum ) ) );
@@ -1761,10 +1822,10 @@ namespace DXCoils {
 									ShowSevereError( RoutineName + PerfObjectType + "=\"" + PerfObjectName + "\", invalid" );
 									ShowContinueError( "...illegal " + cAlphaFields2( 6 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).PLFFPLR( PerfModeNum ) ) );
 									ShowContinueError( "Curve type must be Quadratic or Cubic." );
-									ErrorsFound = true;
+									GetDXCoilsErrorsFound = true;
 								}}
 
-								if ( ! ErrorsFound ) {
+								if ( ! GetDXCoilsErrorsFound ) {
 									//             Test PLF curve minimum and maximum. Cap if less than 0.7 or greater than 1.0.
 									MinCurveVal = 999.0;
 									MaxCurveVal = -999.0;
@@ -1786,7 +1847,7 @@ namespace DXCoils {
 										ShowContinueError( "..." + cAlphaFields2( 6 ) + " = " + Alphas2( 6 ) + " has out of range value." );
 										ShowContinueError( "...Curve minimum must be >= 0.7, curve min at PLR = " + TrimSigDigits( MinCurvePLR, 2 ) + " is " + TrimSigDigits( MinCurveVal, 3 ) );
 										ShowContinueError( "...Setting curve minimum to 0.7 and simulation continues." );
-										SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( PerfModeNum ), ErrorsFound, 0.7, _ );
+										SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( PerfModeNum ), GetDXCoilsErrorsFound, 0.7, _ );
 									}
 
 									if ( MaxCurveVal > 1.0 ) {
@@ -1794,7 +1855,7 @@ namespace DXCoils {
 										ShowContinueError( "..." + cAlphaFields2( 6 ) + " = " + Alphas2( 6 ) + " has out of range value." );
 										ShowContinueError( "...Curve maximum must be <= 1.0, curve max at PLR = " + TrimSigDigits( MaxCurvePLR, 2 ) + " is " + TrimSigDigits( MaxCurveVal, 3 ) );
 										ShowContinueError( "...Setting curve maximum to 1.0 and simulation continues." );
-										SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( PerfModeNum ), ErrorsFound, _, 1.0 );
+										SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( PerfModeNum ), GetDXCoilsErrorsFound, _, 1.0 );
 									}
 
 								}
@@ -1815,7 +1876,7 @@ namespace DXCoils {
 							if ( lAlphaBlanks2( 7 ) ) {
 								DXCoil( DXCoilNum ).CondenserInletNodeNum( PerfModeNum ) = 0;
 							} else {
-								DXCoil( DXCoilNum ).CondenserInletNodeNum( PerfModeNum ) = GetOnlySingleNode( Alphas2( 7 ), ErrorsFound, PerfObjectType, PerfObjectName, NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsNotParent );
+								DXCoil( DXCoilNum ).CondenserInletNodeNum( PerfModeNum ) = GetOnlySingleNode( Alphas2( 7 ), GetDXCoilsErrorsFound, PerfObjectType, PerfObjectName, NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsNotParent );
 								if ( ! CheckOutAirNodeNumber( DXCoil( DXCoilNum ).CondenserInletNodeNum( PerfModeNum ) ) ) {
 									ShowWarningError( RoutineName + PerfObjectType + "=\"" + PerfObjectName + "\":" );
 									ShowContinueError( "may not be valid " + cAlphaFields2( 7 ) + "=\"" + Alphas2( 7 ) + "\"." );
@@ -1832,7 +1893,7 @@ namespace DXCoils {
 								ShowSevereError( RoutineName + PerfObjectType + "=\"" + PerfObjectName + "\", invalid" );
 								ShowContinueError( "..." + cAlphaFields2( 8 ) + "=\"" + Alphas2( 8 ) + "\":" );
 								ShowContinueError( "...must be AirCooled or EvaporativelyCooled." );
-								ErrorsFound = true;
+								GetDXCoilsErrorsFound = true;
 							}
 
 							DXCoil( DXCoilNum ).EvapCondEffect( PerfModeNum ) = Numbers2( 10 );
@@ -1840,7 +1901,7 @@ namespace DXCoils {
 								ShowSevereError( RoutineName + PerfObjectType + "=\"" + PerfObjectName + "\", invalid" );
 								ShowContinueError( "..." + cNumericFields2( 10 ) + " cannot be < 0.0 or > 1.0." );
 								ShowContinueError( "...entered value=[" + TrimSigDigits( Numbers2( 10 ), 2 ) + "]." );
-								ErrorsFound = true;
+								GetDXCoilsErrorsFound = true;
 							}
 
 							DXCoil( DXCoilNum ).EvapCondAirFlow( PerfModeNum ) = Numbers2( 11 );
@@ -1848,7 +1909,7 @@ namespace DXCoils {
 								ShowSevereError( RoutineName + PerfObjectType + "=\"" + PerfObjectName + "\", invalid" );
 								ShowContinueError( "..." + cNumericFields2( 11 ) + " cannot be < 0.0." );
 								ShowContinueError( "...entered value=[" + TrimSigDigits( Numbers2( 11 ), 2 ) + "]." );
-								ErrorsFound = true;
+								GetDXCoilsErrorsFound = true;
 							}
 
 							DXCoil( DXCoilNum ).EvapCondPumpElecNomPower( PerfModeNum ) = Numbers2( 12 );
@@ -1856,7 +1917,7 @@ namespace DXCoils {
 								ShowSevereError( RoutineName + PerfObjectType + "=\"" + PerfObjectName + "\", invalid" );
 								ShowContinueError( "..." + cNumericFields2( 12 ) + " cannot be less than zero." );
 								ShowContinueError( "...entered value=[" + TrimSigDigits( Numbers2( 12 ), 2 ) + "]." );
-								ErrorsFound = true;
+								GetDXCoilsErrorsFound = true;
 							}
 
 							DXCoil( DXCoilNum ).RatedEIR( PerfModeNum ) = 1.0 / DXCoil( DXCoilNum ).RatedCOP( PerfModeNum );
@@ -1876,7 +1937,7 @@ namespace DXCoils {
 										ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 										ShowContinueError( "...illegal " + cAlphaFields2( 9 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).SHRFTemp( PerfModeNum ) ) );
 										ShowContinueError( "Curve type must be Biquadratic." );
-										ErrorsFound = true;
+										GetDXCoilsErrorsFound = true;
 									}}
 								}
 							}
@@ -1895,7 +1956,7 @@ namespace DXCoils {
 										ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 										ShowContinueError( "...illegal " + cAlphaFields2( 10 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).SHRFFlow( PerfModeNum ) ) );
 										ShowContinueError( "Curve type must be quadratic or cubic." );
-										ErrorsFound = true;
+										GetDXCoilsErrorsFound = true;
 									}}
 								}
 							}
@@ -1908,7 +1969,7 @@ namespace DXCoils {
 						} else { // invalid performance object
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 							ShowContinueError( "... not found " + PerfObjectType + "=\"" + PerfObjectName + "\"." );
-							ErrorsFound = true;
+							GetDXCoilsErrorsFound = true;
 						} // end of valid performance object check
 						AlphaIndex += 2;
 					} // end of sufficient number of fields entered check
@@ -1938,7 +1999,7 @@ namespace DXCoils {
 				DXCoil( DXCoilNum ).EvapWaterSupplyMode = WaterSupplyFromMains;
 			} else {
 				DXCoil( DXCoilNum ).EvapWaterSupplyMode = WaterSupplyFromTank;
-				SetupTankDemandComponent( DXCoil( DXCoilNum ).Name, CurrentModuleObject, DXCoil( DXCoilNum ).EvapWaterSupplyName, ErrorsFound, DXCoil( DXCoilNum ).EvapWaterSupTankID, DXCoil( DXCoilNum ).EvapWaterTankDemandARRID );
+				SetupTankDemandComponent( DXCoil( DXCoilNum ).Name, CurrentModuleObject, DXCoil( DXCoilNum ).EvapWaterSupplyName, GetDXCoilsErrorsFound, DXCoil( DXCoilNum ).EvapWaterSupTankID, DXCoil( DXCoilNum ).EvapWaterTankDemandARRID );
 			}
 
 			//A14; \field Name of Water Storage Tank for Condensate Collection
@@ -1947,7 +2008,7 @@ namespace DXCoils {
 				DXCoil( DXCoilNum ).CondensateCollectMode = CondensateDiscarded;
 			} else {
 				DXCoil( DXCoilNum ).CondensateCollectMode = CondensateToTank;
-				SetupTankSupplyComponent( DXCoil( DXCoilNum ).Name, CurrentModuleObject, DXCoil( DXCoilNum ).CondensateCollectName, ErrorsFound, DXCoil( DXCoilNum ).CondensateTankID, DXCoil( DXCoilNum ).CondensateTankSupplyARRID );
+				SetupTankSupplyComponent( DXCoil( DXCoilNum ).Name, CurrentModuleObject, DXCoil( DXCoilNum ).CondensateCollectName, GetDXCoilsErrorsFound, DXCoil( DXCoilNum ).CondensateTankID, DXCoil( DXCoilNum ).CondensateTankSupplyARRID );
 			}
 
 			//Basin heater power as a function of temperature must be greater than or equal to 0
@@ -1956,7 +2017,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 5 ) + " must be >= 0." );
 				ShowContinueError( "...entered value=[" + TrimSigDigits( Numbers( 5 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).BasinHeaterSetPointTemp = Numbers( 6 );
@@ -1982,7 +2043,7 @@ namespace DXCoils {
 
 		} // end of the Multimode DX coil loop
 
-		if ( ErrorsFound ) {
+		if ( GetDXCoilsErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in getting " + CurrentModuleObject + " input.  Preceding condition(s) causes termination." );
 		}
 
@@ -2003,12 +2064,12 @@ namespace DXCoils {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), DXCoil, DXCoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, Alphas( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 			DXCoil( DXCoilNum ).Name = Alphas( 1 );
 			DXCoil( DXCoilNum ).DXCoilType = CurrentModuleObject;
@@ -2021,13 +2082,13 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cAlphaFields( 2 ) + "=\"" + Alphas( 2 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}
 			}
 
-			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 3 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 3 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
 
-			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 4 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 4 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			TestCompSet( CurrentModuleObject, Alphas( 1 ), Alphas( 3 ), Alphas( 4 ), "Air Nodes" );
 
@@ -2040,7 +2101,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 5 ) + "=\"" + Alphas( 5 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				// only legal types are Quadratic, BiQuadratic and Cubic
 				{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).CCapFTemp( 1 ) ) );
@@ -2058,7 +2119,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...illegal " + cAlphaFields( 5 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).CCapFTemp( 1 ) ) );
 					ShowContinueError( "Curve type must be Biquadratic, Quadratic or Cubic." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}}
 			}
 
@@ -2071,7 +2132,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 6 ) + "=\"" + Alphas( 6 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				// Verify Curve Object, only legal type is Quadratic
 				{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).CCapFFlow( 1 ) ) );
@@ -2084,7 +2145,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...illegal " + cAlphaFields( 6 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).CCapFFlow( 1 ) ) );
 					ShowContinueError( "Curve type must be Quadratic or Cubic." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}}
 			}
 
@@ -2097,7 +2158,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 7 ) + "=\"" + Alphas( 7 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				// only legal types are Quadratic, BiQuadratic and Cubic
 				{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).EIRFTemp( 1 ) ) );
@@ -2115,7 +2176,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...illegal " + cAlphaFields( 7 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).EIRFTemp( 1 ) ) );
 					ShowContinueError( "Curve type must be Biquadratic, Quadratic or Cubic." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}}
 			}
 
@@ -2128,7 +2189,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 8 ) + "=\"" + Alphas( 8 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				// Verify Curve Object, only legal type is Quadratic or Cubic
 				{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).EIRFFlow( 1 ) ) );
@@ -2141,7 +2202,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...illegal " + cAlphaFields( 8 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).EIRFFlow( 1 ) ) );
 					ShowContinueError( "Curve type must be Quadratic or Cubic." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}}
 			}
 
@@ -2154,7 +2215,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 9 ) + "=\"" + Alphas( 9 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				// Verify Curve Object, only legal types are Quadratic or Cubic
 				{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).PLFFPLR( 1 ) ) );
@@ -2167,10 +2228,10 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...illegal " + cAlphaFields( 9 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).PLFFPLR( 1 ) ) );
 					ShowContinueError( "Curve type must be Quadratic or Cubic." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}}
 
-				if ( ! ErrorsFound ) {
+				if ( ! GetDXCoilsErrorsFound ) {
 					//     Test PLF curve minimum and maximum. Cap if less than 0.7 or greater than 1.0.
 					MinCurveVal = 999.0;
 					MaxCurveVal = -999.0;
@@ -2192,7 +2253,7 @@ namespace DXCoils {
 						ShowContinueError( "..." + cAlphaFields( 9 ) + " = " + Alphas( 9 ) + " has out of range value." );
 						ShowContinueError( "...Curve minimum must be >= 0.7, curve min at PLR = " + TrimSigDigits( MinCurvePLR, 2 ) + " is " + TrimSigDigits( MinCurveVal, 3 ) );
 						ShowContinueError( "...Setting curve minimum to 0.7 and simulation continues." );
-						SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), ErrorsFound, 0.7, _ );
+						SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), GetDXCoilsErrorsFound, 0.7, _ );
 					}
 
 					if ( MaxCurveVal > 1.0 ) {
@@ -2200,7 +2261,7 @@ namespace DXCoils {
 						ShowContinueError( "..." + cAlphaFields( 9 ) + " = " + Alphas( 9 ) + " has out of range value." );
 						ShowContinueError( "...Curve maximum must be <= 1.0, curve max at PLR = " + TrimSigDigits( MaxCurvePLR, 2 ) + " is " + TrimSigDigits( MaxCurveVal, 3 ) );
 						ShowContinueError( "...Setting curve maximum to 1.0 and simulation continues." );
-						SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), ErrorsFound, _, 1.0 );
+						SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), GetDXCoilsErrorsFound, _, 1.0 );
 					}
 
 				}
@@ -2219,7 +2280,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( 10 ) + "=\"" + Alphas( 10 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is BiQuadratic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).DefrostEIRFT ) );
@@ -2230,7 +2291,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 10 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).DefrostEIRFT ) );
 						ShowContinueError( "Curve type must be BiQuadratic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}}
 				}
 			}
@@ -2241,7 +2302,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "...illegal " + cAlphaFields( 11 ) + "=\"" + Alphas( 11 ) + "\"." );
 				ShowContinueError( "...valid values for this field are ReverseCycle or Resistive." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			if ( SameString( Alphas( 12 ), "Timed" ) ) DXCoil( DXCoilNum ).DefrostControl = Timed;
@@ -2250,7 +2311,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "...illegal " + cAlphaFields( 12 ) + "=\"" + Alphas( 12 ) + "\"." );
 				ShowContinueError( "...valid values for this field are Timed or OnDemand." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).RatedSHR( 1 ) = 1.0;
@@ -2281,7 +2342,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 8 ) + " cannot be < 0.0." );
 				ShowContinueError( "...entered value=[" + TrimSigDigits( Numbers( 8 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			//Set crankcase heater cutout temperature
@@ -2314,7 +2375,7 @@ namespace DXCoils {
 			if ( lAlphaBlanks( 13 ) ) {
 				DXCoil( DXCoilNum ).CondenserInletNodeNum( 1 ) = 0;
 			} else {
-				DXCoil( DXCoilNum ).CondenserInletNodeNum( 1 ) = GetOnlySingleNode( Alphas( 13 ), ErrorsFound, CurrentModuleObject, DXCoil( DXCoilNum ).Name, NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsNotParent );
+				DXCoil( DXCoilNum ).CondenserInletNodeNum( 1 ) = GetOnlySingleNode( Alphas( 13 ), GetDXCoilsErrorsFound, CurrentModuleObject, DXCoil( DXCoilNum ).Name, NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsNotParent );
 				// warn if not an outdoor node, but allow
 				if ( ! CheckOutAirNodeNumber( DXCoil( DXCoilNum ).CondenserInletNodeNum( 1 ) ) ) {
 					ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", may be invalid" );
@@ -2369,7 +2430,7 @@ namespace DXCoils {
 
 		} // end of the DX heating coil loop
 
-		if ( ErrorsFound ) {
+		if ( GetDXCoilsErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in getting " + CurrentModuleObject + " input. Preceding condition(s) causes termination." );
 		}
 
@@ -2388,12 +2449,12 @@ namespace DXCoils {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), DXCoil, DXCoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, Alphas( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 			DXCoil( DXCoilNum ).Name = Alphas( 1 );
 			// Initialize DataHeatBalance heat reclaim variable name for use by heat reclaim coils
@@ -2409,7 +2470,7 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cAlphaFields( 2 ) + "=\"" + Alphas( 2 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}
 			}
 			DXCoil( DXCoilNum ).RatedTotCap( 1 ) = Numbers( 1 );
@@ -2424,9 +2485,9 @@ namespace DXCoils {
 				DXCoil( DXCoilNum ).RateWithInternalStaticAndFanObject = false;
 			}
 
-			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 3 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 3 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
 
-			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 4 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 4 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			TestCompSet( CurrentModuleObject, Alphas( 1 ), Alphas( 3 ), Alphas( 4 ), "Air Nodes" );
 
@@ -2439,7 +2500,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 5 ) + "=\"" + Alphas( 5 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				// Verify Curve Object, only legal type is BiQuadratic
 				{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).CCapFTemp( 1 ) ) );
@@ -2451,7 +2512,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...illegal " + cAlphaFields( 5 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).CCapFTemp( 1 ) ) );
 					ShowContinueError( "Curve type must be BiQuadratic." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}}
 			}
 
@@ -2464,7 +2525,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 6 ) + "=\"" + Alphas( 6 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				// Verify Curve Object, only legal type is Quadratic
 				{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).CCapFFlow( 1 ) ) );
@@ -2477,7 +2538,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...illegal " + cAlphaFields( 6 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).CCapFFlow( 1 ) ) );
 					ShowContinueError( "Curve type must be Quadratic or Cubic." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}}
 			}
 
@@ -2490,7 +2551,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 7 ) + "=\"" + Alphas( 7 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				// Verify Curve Object, only legal type is BiQuadratic
 				{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).EIRFTemp( 1 ) ) );
@@ -2502,7 +2563,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...illegal " + cAlphaFields( 7 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).EIRFTemp( 1 ) ) );
 					ShowContinueError( "Curve type must be BiQuadratic." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}}
 			}
 
@@ -2515,7 +2576,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 8 ) + "=\"" + Alphas( 8 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				// Verify Curve Object, only legal type is Quadratic
 				{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).EIRFFlow( 1 ) ) );
@@ -2528,7 +2589,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...illegal " + cAlphaFields( 8 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).EIRFFlow( 1 ) ) );
 					ShowContinueError( "Curve type must be Quadratic or Cubic." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}}
 			}
 
@@ -2541,7 +2602,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 9 ) + "=\"" + Alphas( 9 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				// Verify Curve Object, only legal types are Quadratic or Cubic
 				{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).PLFFPLR( 1 ) ) );
@@ -2554,10 +2615,10 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...illegal " + cAlphaFields( 9 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).PLFFPLR( 1 ) ) );
 					ShowContinueError( "Curve type must be Quadratic or Cubic." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}}
 
-				if ( ! ErrorsFound ) {
+				if ( ! GetDXCoilsErrorsFound ) {
 					//     Test PLF curve minimum and maximum. Cap if less than 0.7 or greater than 1.0.
 					MinCurveVal = 999.0;
 					MaxCurveVal = -999.0;
@@ -2579,7 +2640,7 @@ namespace DXCoils {
 						ShowContinueError( "..." + cAlphaFields( 9 ) + " = " + Alphas( 9 ) + " has out of range value." );
 						ShowContinueError( "...Curve minimum must be >= 0.7, curve min at PLR = " + TrimSigDigits( MinCurvePLR, 2 ) + " is " + TrimSigDigits( MinCurveVal, 3 ) );
 						ShowContinueError( "...Setting curve minimum to 0.7 and simulation continues." );
-						SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), ErrorsFound, 0.7, _ );
+						SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), GetDXCoilsErrorsFound, 0.7, _ );
 					}
 
 					if ( MaxCurveVal > 1.0 ) {
@@ -2587,7 +2648,7 @@ namespace DXCoils {
 						ShowContinueError( "..." + cAlphaFields( 9 ) + " = " + Alphas( 9 ) + " has out of range value." );
 						ShowContinueError( "...Curve maximum must be <= 1.0, curve max at PLR = " + TrimSigDigits( MaxCurvePLR, 2 ) + " is " + TrimSigDigits( MaxCurveVal, 3 ) );
 						ShowContinueError( "...Setting curve maximum to 1.0 and simulation continues." );
-						SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), ErrorsFound, _, 1.0 );
+						SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), GetDXCoilsErrorsFound, _, 1.0 );
 					}
 
 				}
@@ -2610,7 +2671,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 10 ) + "=\"" + Alphas( 10 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				// Verify Curve Object, only legal type is BiQuadratic
 				{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).CCapFTemp2 ) );
@@ -2622,7 +2683,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...illegal " + cAlphaFields( 10 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).CCapFTemp2 ) );
 					ShowContinueError( "Curve type must be BiQuadratic." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}}
 			}
 
@@ -2635,7 +2696,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 11 ) + "=\"" + Alphas( 11 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				// Verify Curve Object, only legal type is BiQuadratic
 				{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).EIRFTemp2 ) );
@@ -2647,7 +2708,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...illegal " + cAlphaFields( 11 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).EIRFTemp2 ) );
 					ShowContinueError( "Curve type must be BiQuadratic." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}}
 			}
 
@@ -2655,7 +2716,7 @@ namespace DXCoils {
 			if ( lAlphaBlanks( 12 ) ) {
 				DXCoil( DXCoilNum ).CondenserInletNodeNum( 1 ) = 0;
 			} else {
-				DXCoil( DXCoilNum ).CondenserInletNodeNum( 1 ) = GetOnlySingleNode( Alphas( 12 ), ErrorsFound, CurrentModuleObject, DXCoil( DXCoilNum ).Name, NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsNotParent );
+				DXCoil( DXCoilNum ).CondenserInletNodeNum( 1 ) = GetOnlySingleNode( Alphas( 12 ), GetDXCoilsErrorsFound, CurrentModuleObject, DXCoil( DXCoilNum ).Name, NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsNotParent );
 				if ( ! CheckOutAirNodeNumber( DXCoil( DXCoilNum ).CondenserInletNodeNum( 1 ) ) ) {
 					ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", may be invalid" );
 					ShowContinueError( cAlphaFields( 12 ) + "=\"" + Alphas( 12 ) + "\", node does not appear in an OutdoorAir:NodeList or as an OutdoorAir:Node." );
@@ -2672,7 +2733,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cAlphaFields( 13 ) + "=\"" + Alphas( 13 ) + "\":" );
 				ShowContinueError( "...must be AirCooled or EvaporativelyCooled." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).EvapCondEffect( 1 ) = Numbers( 10 );
@@ -2680,7 +2741,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 9 ) + " cannot be < 0.0 or > 1.0." );
 				ShowContinueError( "...entered value=[" + TrimSigDigits( Numbers( 10 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).EvapCondAirFlow( 1 ) = Numbers( 11 );
@@ -2688,7 +2749,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 10 ) + " cannot be < 0.0." );
 				ShowContinueError( "...entered value=[" + TrimSigDigits( Numbers( 11 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).EvapCondPumpElecNomPower( 1 ) = Numbers( 12 );
@@ -2696,7 +2757,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 11 ) + " cannot be < 0.0." );
 				ShowContinueError( "...entered value=[" + TrimSigDigits( Numbers( 12 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).EvapCondEffect2 = Numbers( 13 );
@@ -2704,7 +2765,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 12 ) + " cannot be cannot be < 0.0 or > 1.0." );
 				ShowContinueError( "...entered value=[" + TrimSigDigits( Numbers( 13 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).EvapCondAirFlow2 = Numbers( 14 );
@@ -2712,7 +2773,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 13 ) + " cannot be < 0.0." );
 				ShowContinueError( "...entered value=[" + TrimSigDigits( Numbers( 14 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).EvapCondPumpElecNomPower2 = Numbers( 15 );
@@ -2720,7 +2781,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 14 ) + " cannot be < 0.0." );
 				ShowContinueError( "...entered value=[" + TrimSigDigits( Numbers( 15 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).RatedEIR2 = 1.0 / DXCoil( DXCoilNum ).RatedCOP2;
@@ -2732,7 +2793,7 @@ namespace DXCoils {
 				DXCoil( DXCoilNum ).EvapWaterSupplyMode = WaterSupplyFromMains;
 			} else {
 				DXCoil( DXCoilNum ).EvapWaterSupplyMode = WaterSupplyFromTank;
-				SetupTankDemandComponent( DXCoil( DXCoilNum ).Name, CurrentModuleObject, DXCoil( DXCoilNum ).EvapWaterSupplyName, ErrorsFound, DXCoil( DXCoilNum ).EvapWaterSupTankID, DXCoil( DXCoilNum ).EvapWaterTankDemandARRID );
+				SetupTankDemandComponent( DXCoil( DXCoilNum ).Name, CurrentModuleObject, DXCoil( DXCoilNum ).EvapWaterSupplyName, GetDXCoilsErrorsFound, DXCoil( DXCoilNum ).EvapWaterSupTankID, DXCoil( DXCoilNum ).EvapWaterTankDemandARRID );
 			}
 
 			//A15; \field Name of Water Storage Tank for Condensate Collection
@@ -2741,7 +2802,7 @@ namespace DXCoils {
 				DXCoil( DXCoilNum ).CondensateCollectMode = CondensateDiscarded;
 			} else {
 				DXCoil( DXCoilNum ).CondensateCollectMode = CondensateToTank;
-				SetupTankSupplyComponent( DXCoil( DXCoilNum ).Name, CurrentModuleObject, DXCoil( DXCoilNum ).CondensateCollectName, ErrorsFound, DXCoil( DXCoilNum ).CondensateTankID, DXCoil( DXCoilNum ).CondensateTankSupplyARRID );
+				SetupTankSupplyComponent( DXCoil( DXCoilNum ).Name, CurrentModuleObject, DXCoil( DXCoilNum ).CondensateCollectName, GetDXCoilsErrorsFound, DXCoil( DXCoilNum ).CondensateTankID, DXCoil( DXCoilNum ).CondensateTankSupplyARRID );
 			}
 
 			// Basin heater power as a function of temperature must be greater than or equal to 0
@@ -2750,7 +2811,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 15 ) + " must be >= 0.0." );
 				ShowContinueError( "...entered value=[" + TrimSigDigits( Numbers( 16 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).BasinHeaterSetPointTemp = Numbers( 17 );
@@ -2790,7 +2851,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 17 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).SHRFTemp( 1 ) ) );
 						ShowContinueError( "Curve type must be Biquadratic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}}
 				}
 			}
@@ -2810,7 +2871,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 18 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).SHRFFlow( 1 ) ) );
 						ShowContinueError( "Curve type must be quadratic or cubic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}}
 				}
 			}
@@ -2829,7 +2890,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 19 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).SHRFTemp2 ) );
 						ShowContinueError( "Curve type must be Biquadratic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}}
 				}
 			}
@@ -2848,7 +2909,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 20 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).SHRFFlow2 ) );
 						ShowContinueError( "Curve type must be quadratic or cubic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}}
 				}
 			}
@@ -2871,7 +2932,7 @@ namespace DXCoils {
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetDXCoilsErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in getting " + CurrentModuleObject + " input.  Preceding condition(s) causes termination." );
 		}
 
@@ -2892,12 +2953,12 @@ namespace DXCoils {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), DXCoil, DXCoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, Alphas( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 			DXCoil( DXCoilNum ).Name = Alphas( 1 );
 			DXCoil( DXCoilNum ).DXCoilType = CurrentModuleObject;
@@ -2910,14 +2971,14 @@ namespace DXCoils {
 			if ( DXCoil( DXCoilNum ).RatedTotCap2 <= 0.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 1 ) + " must be > 0.0, entered value=[" + TrimSigDigits( Numbers( 1 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).RatedCOP( 1 ) = Numbers( 2 );
 			if ( DXCoil( DXCoilNum ).RatedCOP( 1 ) <= 0.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 2 ) + " must be > 0.0, entered value=[" + TrimSigDigits( Numbers( 2 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).RatedSHR( 1 ) = Numbers( 3 );
@@ -2925,28 +2986,28 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 3 ) + " must be > 0 and <= 1.  entered value=[" + TrimSigDigits( Numbers( 3 ), 3 ) + "]." );
 
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).RatedInletDBTemp = Numbers( 4 );
 			if ( DXCoil( DXCoilNum ).RatedInletDBTemp <= 5.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 4 ) + " must be > 5 {C}.  entered value=[" + TrimSigDigits( Numbers( 4 ), 1 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).RatedInletWBTemp = Numbers( 5 );
 			if ( DXCoil( DXCoilNum ).RatedInletWBTemp <= 5.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 5 ) + " must be > 5 {C}.  entered value=[" + TrimSigDigits( Numbers( 5 ), 1 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).RatedInletWaterTemp = Numbers( 6 );
 			if ( DXCoil( DXCoilNum ).RatedInletWaterTemp <= 25.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 6 ) + " must be > 25 {C}.  entered value=[" + TrimSigDigits( Numbers( 6 ), 1 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).RatedAirVolFlowRate( 1 ) = Numbers( 7 );
@@ -2954,7 +3015,7 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).RatedAirVolFlowRate( 1 ) <= 0.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cNumericFields( 7 ) + " must be > 0.0.  entered value=[" + TrimSigDigits( Numbers( 7 ), 3 ) + "]." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}
 			}
 
@@ -2964,7 +3025,7 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).RatedHPWHCondWaterFlow <= 0.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cNumericFields( 8 ) + " must be > 0.0  entered value=[" + TrimSigDigits( Numbers( 8 ), 3 ) + "]." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}
 				//   check the range of flow rate to be >= 1 gpm/ton and <= 5 gpm/ton
 				if ( DXCoil( DXCoilNum ).RatedHPWHCondWaterFlow / DXCoil( DXCoilNum ).RatedTotCap2 < 1.79405e-8 || DXCoil( DXCoilNum ).RatedHPWHCondWaterFlow / DXCoil( DXCoilNum ).RatedTotCap2 > 8.97024e-8 ) {
@@ -2981,7 +3042,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( ",,,invalid choice for " + cAlphaFields( 2 ) + ".  Entered choice = " + Alphas( 2 ) );
 				ShowContinueError( "Valid choices are Yes or No." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			if ( SameString( Alphas( 3 ), "Yes" ) || SameString( Alphas( 3 ), "No" ) ) {
@@ -2991,7 +3052,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( ",,,invalid choice for " + cAlphaFields( 3 ) + ".  Entered choice = " + Alphas( 3 ) );
 				ShowContinueError( "Valid choices are Yes or No." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			if ( SameString( Alphas( 4 ), "Yes" ) || SameString( Alphas( 4 ), "No" ) ) {
@@ -3001,27 +3062,27 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( ",,,invalid choice for " + cAlphaFields( 4 ) + ".  Entered choice = " + Alphas( 4 ) );
 				ShowContinueError( "Valid choices are Yes or No." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).HPWHCondPumpElecNomPower = Numbers( 9 );
 			if ( DXCoil( DXCoilNum ).HPWHCondPumpElecNomPower < 0.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 9 ) + " must be >= 0.0  entered value=[" + TrimSigDigits( Numbers( 9 ), 3 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).HPWHCondPumpFracToWater = Numbers( 10 );
 			if ( DXCoil( DXCoilNum ).HPWHCondPumpFracToWater <= 0.0 || DXCoil( DXCoilNum ).HPWHCondPumpFracToWater > 1.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 10 ) + " must be >= 0 and <= 1.  entered value=[" + TrimSigDigits( Numbers( 10 ), 3 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			//Air nodes
-			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 5 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 5 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
 
-			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 6 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 6 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			TestCompSet( CurrentModuleObject, Alphas( 1 ), Alphas( 5 ), Alphas( 6 ), "Air Nodes" );
 
@@ -3029,9 +3090,9 @@ namespace DXCoils {
 			DXCoil( DXCoilNum ).IsDXCoilInZone = ! CheckOutAirNodeNumber( DXCoil( DXCoilNum ).AirInNode );
 
 			//Water nodes
-			DXCoil( DXCoilNum ).WaterInNode = GetOnlySingleNode( Alphas( 7 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).WaterInNode = GetOnlySingleNode( Alphas( 7 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
 
-			DXCoil( DXCoilNum ).WaterOutNode = GetOnlySingleNode( Alphas( 8 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).WaterOutNode = GetOnlySingleNode( Alphas( 8 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
 
 			TestCompSet( CurrentModuleObject, Alphas( 1 ), Alphas( 7 ), Alphas( 8 ), "Water Nodes" );
 
@@ -3039,14 +3100,14 @@ namespace DXCoils {
 			if ( DXCoil( DXCoilNum ).CrankcaseHeaterCapacity < 0.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 11 ) + " must be >= 0.0  entered value=[" + TrimSigDigits( Numbers( 11 ), 1 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).MaxOATCrankcaseHeater = Numbers( 12 );
 			if ( DXCoil( DXCoilNum ).MaxOATCrankcaseHeater < 0.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 12 ) + " must be >= 0 {C}.  entered value=[" + TrimSigDigits( Numbers( 12 ), 1 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			if ( SameString( Alphas( 9 ), "DryBulbTemperature" ) ) {
@@ -3058,7 +3119,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cAlphaFields( 9 ) + " must be DryBulbTemperature or WetBulbTemperature." );
 				ShowContinueError( "...entered value=\"" + Alphas( 9 ) + "\"." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			// set rated inlet air temperature for curve object verification
@@ -3075,7 +3136,7 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).HCapFTemp == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 10 ) + "=\"" + Alphas( 10 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal types are BiQuadratic or Cubic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).HCapFTemp ) );
@@ -3092,7 +3153,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 10 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).HCapFTemp ) );
 						ShowContinueError( "Curve type must be BiQuadratic or Cubic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 						HeatCapFTemp = 1.0;
 					}}
 
@@ -3112,7 +3173,7 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).HCapFAirFlow == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 11 ) + "=\"" + Alphas( 11 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal types are Cubic or Quadratic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).HCapFAirFlow ) );
@@ -3127,7 +3188,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 11 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).HCapFAirFlow ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 						HeatCapFAirFlow = 1.0;
 					}}
 
@@ -3147,7 +3208,7 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).HCapFWaterFlow == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 12 ) + "=\"" + Alphas( 12 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal types are Cubic or Quadratic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).HCapFWaterFlow ) );
@@ -3162,7 +3223,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 12 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).HCapFWaterFlow ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 						HeatCapFWaterFlow = 1.0;
 					}}
 
@@ -3182,7 +3243,7 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).HCOPFTemp == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 13 ) + "=\"" + Alphas( 13 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal types are BiQuadratic or Cubic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).HCOPFTemp ) );
@@ -3199,7 +3260,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 13 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).HCOPFTemp ) );
 						ShowContinueError( "Curve type must be BiQuadratic or Cubic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 						HeatCOPFTemp = 1.0;
 					}}
 
@@ -3219,7 +3280,7 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).HCOPFAirFlow == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 14 ) + "=\"" + Alphas( 14 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal types are Cubic or Quadratic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).HCOPFAirFlow ) );
@@ -3234,7 +3295,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 14 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).HCOPFAirFlow ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 						HeatCOPFAirFlow = 1.0;
 					}}
 
@@ -3254,7 +3315,7 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).HCOPFWaterFlow == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 15 ) + "=\"" + Alphas( 15 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal types are Cubic or Quadratic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).HCOPFWaterFlow ) );
@@ -3269,7 +3330,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 15 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).HCOPFWaterFlow ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 						HeatCOPFWaterFlow = 1.0;
 					}}
 
@@ -3289,7 +3350,7 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).PLFFPLR( 1 ) == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 16 ) + "=\"" + Alphas( 16 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal types are Cubic or Quadratic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).PLFFPLR( 1 ) ) );
@@ -3302,10 +3363,10 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 16 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).PLFFPLR( 1 ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}}
 
-					if ( ! ErrorsFound ) {
+					if ( ! GetDXCoilsErrorsFound ) {
 						//       Test PLF curve minimum and maximum. Cap if less than 0.7 or greater than 1.0.
 						MinCurveVal = 999.0;
 						MaxCurveVal = -999.0;
@@ -3327,7 +3388,7 @@ namespace DXCoils {
 							ShowContinueError( "..." + cAlphaFields( 16 ) + " = " + Alphas( 16 ) + " has out of range value." );
 							ShowContinueError( "...Curve minimum must be >= 0.7, curve min at PLR = " + TrimSigDigits( MinCurvePLR, 2 ) + " is " + TrimSigDigits( MinCurveVal, 3 ) );
 							ShowContinueError( "...Setting curve minimum to 0.7 and simulation continues." );
-							SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), ErrorsFound, 0.7, _ );
+							SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), GetDXCoilsErrorsFound, 0.7, _ );
 						}
 
 						if ( MaxCurveVal > 1.0 ) {
@@ -3335,7 +3396,7 @@ namespace DXCoils {
 							ShowContinueError( "..." + cAlphaFields( 16 ) + " = " + Alphas( 16 ) + " has out of range value." );
 							ShowContinueError( "...Curve maximum must be <= 1.0, curve max at PLR = " + TrimSigDigits( MaxCurvePLR, 2 ) + " is " + TrimSigDigits( MaxCurveVal, 3 ) );
 							ShowContinueError( "...Setting curve maximum to 1.0 and simulation continues." );
-							SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), ErrorsFound, _, 1.0 );
+							SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), GetDXCoilsErrorsFound, _, 1.0 );
 						}
 
 					}
@@ -3351,7 +3412,7 @@ namespace DXCoils {
 
 		} // end of the DX water heater coil loop
 
-		if ( ErrorsFound ) {
+		if ( GetDXCoilsErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in getting " + CurrentModuleObject + " input. Preceding condition(s) causes termination." );
 		}
 		// Loop over the Wrapped DX Water Heater Coils and get & load the data
@@ -3371,12 +3432,12 @@ namespace DXCoils {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), DXCoil, DXCoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, Alphas( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 			DXCoil( DXCoilNum ).Name = Alphas( 1 );
 			DXCoil( DXCoilNum ).DXCoilType = CurrentModuleObject;
@@ -3389,14 +3450,14 @@ namespace DXCoils {
 			if ( DXCoil( DXCoilNum ).RatedTotCap2 <= 0.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 1 ) + " must be > 0.0, entered value=[" + TrimSigDigits( Numbers( 1 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).RatedCOP( 1 ) = Numbers( 2 );
 			if ( DXCoil( DXCoilNum ).RatedCOP( 1 ) <= 0.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 2 ) + " must be > 0.0, entered value=[" + TrimSigDigits( Numbers( 2 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).RatedSHR( 1 ) = Numbers( 3 );
@@ -3404,28 +3465,28 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 3 ) + " must be > 0 and <= 1.  entered value=[" + TrimSigDigits( Numbers( 3 ), 3 ) + "]." );
 
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).RatedInletDBTemp = Numbers( 4 );
 			if ( DXCoil( DXCoilNum ).RatedInletDBTemp <= 5.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 4 ) + " must be > 5 {C}.  entered value=[" + TrimSigDigits( Numbers( 4 ), 1 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).RatedInletWBTemp = Numbers( 5 );
 			if ( DXCoil( DXCoilNum ).RatedInletWBTemp <= 5.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 5 ) + " must be > 5 {C}.  entered value=[" + TrimSigDigits( Numbers( 5 ), 1 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).RatedInletWaterTemp = Numbers( 6 );
 			if ( DXCoil( DXCoilNum ).RatedInletWaterTemp <= 25.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 6 ) + " must be > 25 {C}.  entered value=[" + TrimSigDigits( Numbers( 6 ), 1 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).RatedAirVolFlowRate( 1 ) = Numbers( 7 );
@@ -3433,7 +3494,7 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).RatedAirVolFlowRate( 1 ) <= 0.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cNumericFields( 7 ) + " must be > 0.0.  entered value=[" + TrimSigDigits( Numbers( 7 ), 3 ) + "]." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}
 			}
 
@@ -3444,13 +3505,13 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( ",,,invalid choice for " + cAlphaFields( 2 ) + ".  Entered choice = " + Alphas( 2 ) );
 				ShowContinueError( "Valid choices are Yes or No." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			//Air nodes
-			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 3 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 3 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
 
-			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 4 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 4 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			TestCompSet( CurrentModuleObject, Alphas( 1 ), Alphas( 3 ), Alphas( 4 ), "Air Nodes" );
 
@@ -3459,9 +3520,9 @@ namespace DXCoils {
 
 			std::string const DummyCondenserInletName( "DUMMY CONDENSER INLET " + DXCoil( DXCoilNum ).Name );
 			std::string const DummyCondenserOutletName( "DUMMY CONDENSER OUTLET " + DXCoil( DXCoilNum ).Name );
-			DXCoil( DXCoilNum ).WaterInNode = GetOnlySingleNode( DummyCondenserInletName, ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).WaterInNode = GetOnlySingleNode( DummyCondenserInletName, GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
 
-			DXCoil( DXCoilNum ).WaterOutNode = GetOnlySingleNode( DummyCondenserOutletName, ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).WaterOutNode = GetOnlySingleNode( DummyCondenserOutletName, GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
 
 			TestCompSet( CurrentModuleObject, Alphas( 1 ), DummyCondenserInletName, DummyCondenserOutletName, "Water Nodes" );
 
@@ -3469,14 +3530,14 @@ namespace DXCoils {
 			if ( DXCoil( DXCoilNum ).CrankcaseHeaterCapacity < 0.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 8 ) + " must be >= 0.0  entered value=[" + TrimSigDigits( Numbers( 8 ), 1 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).MaxOATCrankcaseHeater = Numbers( 9 );
 			if ( DXCoil( DXCoilNum ).MaxOATCrankcaseHeater < 0.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 9 ) + " must be >= 0 {C}.  entered value=[" + TrimSigDigits( Numbers( 9 ), 1 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			if ( SameString( Alphas( 5 ), "DryBulbTemperature" ) ) {
@@ -3488,7 +3549,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cAlphaFields( 5 ) + " must be DryBulbTemperature or WetBulbTemperature." );
 				ShowContinueError( "...entered value=\"" + Alphas( 5 ) + "\"." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			// set rated inlet air temperature for curve object verification
@@ -3505,7 +3566,7 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).HCapFTemp == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 6 ) + "=\"" + Alphas( 6 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal types are BiQuadratic or Cubic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).HCapFTemp ) );
@@ -3522,7 +3583,7 @@ namespace DXCoils {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 							ShowContinueError( "...illegal " + cAlphaFields( 6 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).HCapFTemp ) );
 							ShowContinueError( "Curve type must be BiQuadratic or Cubic." );
-							ErrorsFound = true;
+							GetDXCoilsErrorsFound = true;
 							HeatCapFTemp = 1.0;
 						}}
 
@@ -3542,7 +3603,7 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).HCapFAirFlow == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 7 ) + "=\"" + Alphas( 7 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal types are Cubic or Quadratic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).HCapFAirFlow ) );
@@ -3557,7 +3618,7 @@ namespace DXCoils {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 							ShowContinueError( "...illegal " + cAlphaFields( 7 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).HCapFAirFlow ) );
 							ShowContinueError( "Curve type must be Quadratic or Cubic." );
-							ErrorsFound = true;
+							GetDXCoilsErrorsFound = true;
 							HeatCapFAirFlow = 1.0;
 						}}
 
@@ -3577,7 +3638,7 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).HCOPFTemp == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 8 ) + "=\"" + Alphas( 8 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal types are BiQuadratic or Cubic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).HCOPFTemp ) );
@@ -3594,7 +3655,7 @@ namespace DXCoils {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 							ShowContinueError( "...illegal " + cAlphaFields( 8 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).HCOPFTemp ) );
 							ShowContinueError( "Curve type must be BiQuadratic or Cubic." );
-							ErrorsFound = true;
+							GetDXCoilsErrorsFound = true;
 							HeatCOPFTemp = 1.0;
 						}}
 
@@ -3614,7 +3675,7 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).HCOPFAirFlow == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 9 ) + "=\"" + Alphas( 9 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal types are Cubic or Quadratic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).HCOPFAirFlow ) );
@@ -3629,7 +3690,7 @@ namespace DXCoils {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 							ShowContinueError( "...illegal " + cAlphaFields( 9 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).HCOPFAirFlow ) );
 							ShowContinueError( "Curve type must be Quadratic or Cubic." );
-							ErrorsFound = true;
+							GetDXCoilsErrorsFound = true;
 							HeatCOPFAirFlow = 1.0;
 						}}
 
@@ -3649,7 +3710,7 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).PLFFPLR( 1 ) == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 10 ) + "=\"" + Alphas( 10 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal types are Cubic or Quadratic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).PLFFPLR( 1 ) ) );
@@ -3662,10 +3723,10 @@ namespace DXCoils {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 							ShowContinueError( "...illegal " + cAlphaFields( 10 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).PLFFPLR( 1 ) ) );
 							ShowContinueError( "Curve type must be Quadratic or Cubic." );
-							ErrorsFound = true;
+							GetDXCoilsErrorsFound = true;
 						}}
 
-					if ( ! ErrorsFound ) {
+					if ( ! GetDXCoilsErrorsFound ) {
 						//       Test PLF curve minimum and maximum. Cap if less than 0.7 or greater than 1.0.
 						MinCurveVal = 999.0;
 						MaxCurveVal = -999.0;
@@ -3687,7 +3748,7 @@ namespace DXCoils {
 							ShowContinueError( "..." + cAlphaFields( 10 ) + " = " + Alphas( 10 ) + " has out of range value." );
 							ShowContinueError( "...Curve minimum must be >= 0.7, curve min at PLR = " + TrimSigDigits( MinCurvePLR, 2 ) + " is " + TrimSigDigits( MinCurveVal, 3 ) );
 							ShowContinueError( "...Setting curve minimum to 0.7 and simulation continues." );
-							SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), ErrorsFound, 0.7, _ );
+							SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), GetDXCoilsErrorsFound, 0.7, _ );
 						}
 
 						if ( MaxCurveVal > 1.0 ) {
@@ -3695,7 +3756,7 @@ namespace DXCoils {
 							ShowContinueError( "..." + cAlphaFields( 10 ) + " = " + Alphas( 10 ) + " has out of range value." );
 							ShowContinueError( "...Curve maximum must be <= 1.0, curve max at PLR = " + TrimSigDigits( MaxCurvePLR, 2 ) + " is " + TrimSigDigits( MaxCurveVal, 3 ) );
 							ShowContinueError( "...Setting curve maximum to 1.0 and simulation continues." );
-							SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), ErrorsFound, _, 1.0 );
+							SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), GetDXCoilsErrorsFound, _, 1.0 );
 						}
 
 					}
@@ -3711,7 +3772,7 @@ namespace DXCoils {
 
 		} // end of the DX water heater wrapped coil loop
 
-		if ( ErrorsFound ) {
+		if ( GetDXCoilsErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in getting " + CurrentModuleObject + " input. Preceding condition(s) causes termination." );
 		}
 
@@ -3732,12 +3793,12 @@ namespace DXCoils {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), DXCoil, DXCoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, Alphas( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 			DXCoil( DXCoilNum ).Name = Alphas( 1 );
 			// Initialize DataHeatBalance heat reclaim variable name for use by heat reclaim coils
@@ -3753,13 +3814,13 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cAlphaFields( 2 ) + "=\"" + Alphas( 2 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}
 			}
 
-			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 3 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 3 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
 
-			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 4 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 4 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			TestCompSet( CurrentModuleObject, Alphas( 1 ), Alphas( 3 ), Alphas( 4 ), "Air Nodes" );
 
@@ -3767,7 +3828,7 @@ namespace DXCoils {
 			if ( lAlphaBlanks( 5 ) ) {
 				DXCoil( DXCoilNum ).CondenserInletNodeNum( 1 ) = 0;
 			} else {
-				DXCoil( DXCoilNum ).CondenserInletNodeNum( 1 ) = GetOnlySingleNode( Alphas( 5 ), ErrorsFound, CurrentModuleObject, DXCoil( DXCoilNum ).Name, NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsNotParent );
+				DXCoil( DXCoilNum ).CondenserInletNodeNum( 1 ) = GetOnlySingleNode( Alphas( 5 ), GetDXCoilsErrorsFound, CurrentModuleObject, DXCoil( DXCoilNum ).Name, NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsNotParent );
 				if ( ! CheckOutAirNodeNumber( DXCoil( DXCoilNum ).CondenserInletNodeNum( 1 ) ) ) {
 					ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", may be invalid" );
 					ShowContinueError( cAlphaFields( 5 ) + "=\"" + Alphas( 5 ) + "\", node does not appear in an OutdoorAir:NodeList or as an OutdoorAir:Node." );
@@ -3784,7 +3845,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cAlphaFields( 6 ) + "=\"" + Alphas( 6 ) + "\":" );
 				ShowContinueError( "...must be AirCooled or EvaporativelyCooled." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			// Get Water System tank connections
@@ -3794,7 +3855,7 @@ namespace DXCoils {
 				DXCoil( DXCoilNum ).EvapWaterSupplyMode = WaterSupplyFromMains;
 			} else {
 				DXCoil( DXCoilNum ).EvapWaterSupplyMode = WaterSupplyFromTank;
-				SetupTankDemandComponent( DXCoil( DXCoilNum ).Name, CurrentModuleObject, DXCoil( DXCoilNum ).EvapWaterSupplyName, ErrorsFound, DXCoil( DXCoilNum ).EvapWaterSupTankID, DXCoil( DXCoilNum ).EvapWaterTankDemandARRID );
+				SetupTankDemandComponent( DXCoil( DXCoilNum ).Name, CurrentModuleObject, DXCoil( DXCoilNum ).EvapWaterSupplyName, GetDXCoilsErrorsFound, DXCoil( DXCoilNum ).EvapWaterSupTankID, DXCoil( DXCoilNum ).EvapWaterTankDemandARRID );
 			}
 
 			//A9; \field Name of Water Storage Tank for Condensate Collection
@@ -3803,7 +3864,7 @@ namespace DXCoils {
 				DXCoil( DXCoilNum ).CondensateCollectMode = CondensateDiscarded;
 			} else {
 				DXCoil( DXCoilNum ).CondensateCollectMode = CondensateToTank;
-				SetupTankSupplyComponent( DXCoil( DXCoilNum ).Name, CurrentModuleObject, DXCoil( DXCoilNum ).CondensateCollectName, ErrorsFound, DXCoil( DXCoilNum ).CondensateTankID, DXCoil( DXCoilNum ).CondensateTankSupplyARRID );
+				SetupTankSupplyComponent( DXCoil( DXCoilNum ).Name, CurrentModuleObject, DXCoil( DXCoilNum ).CondensateCollectName, GetDXCoilsErrorsFound, DXCoil( DXCoilNum ).CondensateTankID, DXCoil( DXCoilNum ).CondensateTankSupplyARRID );
 			}
 
 			//Set crankcase heater capacity
@@ -3812,7 +3873,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 1 ) + " cannot be < 0.0." );
 				ShowContinueError( "...entered value=[" + TrimSigDigits( Numbers( 1 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			//Set crankcase heater cutout temperature
@@ -3826,7 +3887,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( ",,,invalid choice for " + cAlphaFields( 9 ) + ".  Entered choice = " + Alphas( 9 ) );
 				ShowContinueError( "The allowed choices are Yes or No." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			if ( SameString( Alphas( 10 ), "Yes" ) ) {
@@ -3837,7 +3898,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( ",,,invalid choice for " + cAlphaFields( 10 ) + ".  Entered choice = " + Alphas( 10 ) );
 				ShowContinueError( "The allowed choices are Yes or No." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			//   Basin heater power as a function of temperature must be greater than or equal to 0
@@ -3845,7 +3906,7 @@ namespace DXCoils {
 			if ( Numbers( 3 ) < 0.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 3 ) + " must be >= 0.0, entered value=[" + TrimSigDigits( Numbers( 3 ), 3 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).BasinHeaterSetPointTemp = Numbers( 4 );
@@ -3892,14 +3953,14 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( ",,,invalid choice for " + cAlphaFields( 12 ) + ".  Entered choice = " + Alphas( 12 ) );
 				ShowContinueError( "Valid choices are Electricity, NaturalGas, PropaneGas, Diesel, Gasoline, FuelOil#1, FuelOil#2, OtherFuel1 or OtherFuel2" );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).NumOfSpeeds = Numbers( 5 ); // Number of speeds
 			if ( DXCoil( DXCoilNum ).NumOfSpeeds < 2 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 5 ) + " must be >= 2. entered number is " + TrimSigDigits( Numbers( 5 ), 0 ) );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			// Allocate arrays based on the number of speeds
@@ -3943,7 +4004,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( 13 + ( I - 1 ) * 6 ) + "=\"" + Alphas( 13 + ( I - 1 ) * 6 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is BiQuadratic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).MSCCapFTemp( I ) ) );
@@ -3960,7 +4021,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 13 + ( I - 1 ) * 6 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).MSCCapFTemp( I ) ) );
 						ShowContinueError( "Curve type must be BiQuadratic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}}
 				}
 
@@ -3973,7 +4034,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( 14 + ( I - 1 ) * 6 ) + "=\"" + Alphas( 14 + ( I - 1 ) * 6 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is Quadratic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).MSCCapFFlow( I ) ) );
@@ -3998,7 +4059,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 14 + ( I - 1 ) * 6 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).MSCCapFFlow( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}}
 				}
 
@@ -4011,7 +4072,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( 15 + ( I - 1 ) * 6 ) + "=\"" + Alphas( 15 + ( I - 1 ) * 6 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is BiQuadratic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).MSEIRFTemp( I ) ) );
@@ -4028,7 +4089,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 15 + ( I - 1 ) * 6 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).MSEIRFTemp( 1 ) ) );
 						ShowContinueError( "Curve type must be BiQuadratic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}}
 				}
 
@@ -4041,7 +4102,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( 16 + ( I - 1 ) * 6 ) + "=\"" + Alphas( 16 + ( I - 1 ) * 6 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is Quadratic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).MSEIRFFlow( I ) ) );
@@ -4066,7 +4127,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 16 + ( I - 1 ) * 6 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).MSEIRFFlow( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}}
 				}
 
@@ -4079,7 +4140,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( 17 + ( I - 1 ) * 6 ) + "=\"" + Alphas( 16 + ( I - 1 ) * 6 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal types are Quadratic or Cubic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).MSPLFFPLR( I ) ) );
@@ -4092,10 +4153,10 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 17 + ( I - 1 ) * 6 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).MSPLFFPLR( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}}
 
-					if ( ! ErrorsFound ) {
+					if ( ! GetDXCoilsErrorsFound ) {
 						//       Test PLF curve minimum and maximum. Cap if less than 0.7 or greater than 1.0.
 						MinCurveVal = 999.0;
 						MaxCurveVal = -999.0;
@@ -4117,7 +4178,7 @@ namespace DXCoils {
 							ShowContinueError( "..." + cAlphaFields2( 17 + ( I - 1 ) * 6 ) + " = " + Alphas2( 17 + ( I - 1 ) * 6 ) + " has out of range value." );
 							ShowContinueError( "...Curve minimum must be >= 0.7, curve min at PLR = " + TrimSigDigits( MinCurvePLR, 2 ) + " is " + TrimSigDigits( MinCurveVal, 3 ) );
 							ShowContinueError( "...Setting curve minimum to 0.7 and simulation continues." );
-							SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( PerfModeNum ), ErrorsFound, 0.7, _ );
+							SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( PerfModeNum ), GetDXCoilsErrorsFound, 0.7, _ );
 						}
 
 						if ( MaxCurveVal > 1.0 ) {
@@ -4125,7 +4186,7 @@ namespace DXCoils {
 							ShowContinueError( "..." + cAlphaFields2( 17 + ( I - 1 ) * 6 ) + " = " + Alphas2( 17 + ( I - 1 ) * 6 ) + " has out of range value." );
 							ShowContinueError( "...Curve maximum must be <= 1.0, curve max at PLR = " + TrimSigDigits( MaxCurvePLR, 2 ) + " is " + TrimSigDigits( MaxCurveVal, 3 ) );
 							ShowContinueError( "...Setting curve maximum to 1.0 and simulation continues." );
-							SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).MSPLFFPLR( I ), ErrorsFound, _, 1.0 );
+							SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).MSPLFFPLR( I ), GetDXCoilsErrorsFound, _, 1.0 );
 						}
 
 					}
@@ -4137,25 +4198,25 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).MSTwet_Rated( I ) < 0.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cNumericFields( 11 + ( I - 1 ) * 13 ) + " cannot be < 0.0, entered value=[" + TrimSigDigits( DXCoil( DXCoilNum ).MSTwet_Rated( I ), 4 ) + "]." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}
 				DXCoil( DXCoilNum ).MSGamma_Rated( I ) = Numbers( 12 + ( I - 1 ) * 13 );
 				if ( DXCoil( DXCoilNum ).MSGamma_Rated( I ) < 0.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cNumericFields( 12 + ( I - 1 ) * 13 ) + " cannot be < 0.0, entered value=[" + TrimSigDigits( DXCoil( DXCoilNum ).MSGamma_Rated( I ), 4 ) + "]." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}
 				DXCoil( DXCoilNum ).MSMaxONOFFCyclesperHour( I ) = Numbers( 13 + ( I - 1 ) * 13 );
 				if ( DXCoil( DXCoilNum ).Gamma_Rated( I ) < 0.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cNumericFields( 13 + ( I - 1 ) * 13 ) + " cannot be < 0.0, entered value=[" + TrimSigDigits( DXCoil( DXCoilNum ).MSMaxONOFFCyclesperHour( I ), 2 ) + "]." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}
 				DXCoil( DXCoilNum ).MSLatentCapacityTimeConstant( I ) = Numbers( 14 + ( I - 1 ) * 13 );
 				if ( DXCoil( DXCoilNum ).Gamma_Rated( I ) < 0.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cNumericFields( 14 + ( I - 1 ) * 13 ) + " cannot be < 0.0, entered value=[" + TrimSigDigits( DXCoil( DXCoilNum ).MSLatentCapacityTimeConstant( I ), 2 ) + "]." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}
 
 				DXCoil( DXCoilNum ).MSWasteHeatFrac( I ) = Numbers( 15 + ( I - 1 ) * 13 );
@@ -4179,7 +4240,7 @@ namespace DXCoils {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 							ShowContinueError( "...illegal " + cAlphaFields( 18 + ( I - 1 ) * 6 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).MSWasteHeat( I ) ) );
 							ShowContinueError( "Curve type must be BiQuadratic." );
-							ErrorsFound = true;
+							GetDXCoilsErrorsFound = true;
 						}}
 					}
 				}
@@ -4188,21 +4249,21 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).MSEvapCondEffect( I ) < 0.0 || DXCoil( DXCoilNum ).MSEvapCondEffect( I ) > 1.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cNumericFields( 16 + ( I - 1 ) * 13 ) + " cannot be < 0.0 or > 1.0, entered value=[" + TrimSigDigits( Numbers( 16 + ( I - 1 ) * 13 ), 3 ) + "]." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}
 
 				DXCoil( DXCoilNum ).MSEvapCondAirFlow( I ) = Numbers( 17 + ( I - 1 ) * 13 );
 				if ( DXCoil( DXCoilNum ).MSEvapCondAirFlow( I ) < 0.0 && DXCoil( DXCoilNum ).MSEvapCondAirFlow( I ) != AutoSize ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cNumericFields( 17 + ( I - 1 ) * 13 ) + " cannot be < 0.0, entered value=[" + TrimSigDigits( Numbers( 17 + ( I - 1 ) * 13 ), 3 ) + "]." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}
 
 				DXCoil( DXCoilNum ).MSEvapCondPumpElecNomPower( I ) = Numbers( 18 + ( I - 1 ) * 13 );
 				if ( DXCoil( DXCoilNum ).MSEvapCondPumpElecNomPower( I ) < 0.0 && DXCoil( DXCoilNum ).MSEvapCondPumpElecNomPower( I ) != AutoSize ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cNumericFields( 18 + ( I - 1 ) * 13 ) + " cannot be < 0.0, entered value=[" + TrimSigDigits( Numbers( 18 + ( I - 1 ) * 13 ), 3 ) + "]." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}
 
 			}
@@ -4219,7 +4280,7 @@ namespace DXCoils {
 			}
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetDXCoilsErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in getting " + CurrentModuleObject + " input. Preceding condition(s) causes termination." );
 		}
 
@@ -4241,12 +4302,12 @@ namespace DXCoils {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), DXCoil, DXCoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, Alphas( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 			DXCoil( DXCoilNum ).Name = Alphas( 1 );
 			// Initialize DataHeatBalance heat reclaim variable name for use by heat reclaim coils
@@ -4262,13 +4323,13 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cAlphaFields( 2 ) + "=\"" + Alphas( 2 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}
 			}
 
-			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 3 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 3 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
 
-			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 4 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 4 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			TestCompSet( CurrentModuleObject, Alphas( 1 ), Alphas( 3 ), Alphas( 4 ), "Air Nodes" );
 
@@ -4282,7 +4343,7 @@ namespace DXCoils {
 			if ( DXCoil( DXCoilNum ).CrankcaseHeaterCapacity < 0.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 3 ) + " cannot be < 0.0, entered value=[" + TrimSigDigits( Numbers( 3 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			//Set crankcase heater cutout temperature
@@ -4299,7 +4360,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( 5 ) + "=\"" + Alphas( 5 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is BiQuadratic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).DefrostEIRFT ) );
@@ -4315,7 +4376,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 5 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).DefrostEIRFT ) );
 						ShowContinueError( "Curve type must be BiQuadratic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}}
 				}
 			}
@@ -4326,7 +4387,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "...illegal " + cAlphaFields( 6 ) + "=\"" + Alphas( 6 ) + "\"." );
 				ShowContinueError( "...valid values for this field are ReverseCycle or Resistive." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			if ( SameString( Alphas( 7 ), "Timed" ) ) DXCoil( DXCoilNum ).DefrostControl = Timed;
@@ -4335,7 +4396,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "...illegal " + cAlphaFields( 7 ) + "=\"" + Alphas( 7 ) + "\"." );
 				ShowContinueError( "...valid values for this field are Timed or OnDemand." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			//Set maximum outdoor temp for defrost to occur
@@ -4363,7 +4424,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( ",,,invalid choice for " + cAlphaFields( 8 ) + ".  Entered choice = " + Alphas( 8 ) );
 				ShowContinueError( "The allowed choices are Yes or No." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			//A10; \field Fuel type
@@ -4389,7 +4450,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( ",,,invalid choice for " + cAlphaFields( 9 ) + ".  Entered choice = " + Alphas( 9 ) );
 				ShowContinueError( "Valid choices are Electricity, NaturalGas, PropaneGas, Diesel, Gasoline, FuelOil#1, FuelOil#2, OtherFuel1 or OtherFuel2" );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			DXCoil( DXCoilNum ).RegionNum = Numbers( 8 ); // Region Number for HSPF Calc
@@ -4397,7 +4458,7 @@ namespace DXCoils {
 			if ( DXCoil( DXCoilNum ).NumOfSpeeds < 2 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 9 ) + " must be >= 2. entered number is " + TrimSigDigits( Numbers( 9 ), 0 ) );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 
 			// Allocate arrays based on the number of speeds
@@ -4437,7 +4498,7 @@ namespace DXCoils {
 				DXCoil( DXCoilNum ).MSCCapFTemp( I ) = GetCurveIndex( Alphas( 10 + ( I - 1 ) * 6 ) ); // convert curve name to number
 				if ( DXCoil( DXCoilNum ).MSCCapFTemp( I ) == 0 ) {
 					ShowSevereError( CurrentModuleObject + ", \"" + DXCoil( DXCoilNum ).Name + "\" " + cAlphaFields( 10 + ( I - 1 ) * 6 ) + " not found:" + Alphas( 10 + ( I - 1 ) * 6 ) );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// only legal types are Quadratic, BiQuadratic and Cubic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).MSCCapFTemp( I ) ) );
@@ -4473,7 +4534,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 10 + ( I - 1 ) * 6 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).MSCCapFTemp( I ) ) );
 						ShowContinueError( "Curve type must be BiQuadratic, Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}}
 				}
 
@@ -4486,7 +4547,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( 11 + ( I - 1 ) * 6 ) + "=\"" + Alphas( 11 + ( I - 1 ) * 6 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is Quadratic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).MSCCapFFlow( I ) ) );
@@ -4511,7 +4572,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 11 + ( I - 1 ) * 6 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).MSCCapFFlow( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}}
 				}
 
@@ -4524,7 +4585,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( 12 + ( I - 1 ) * 6 ) + "=\"" + Alphas( 15 + ( I - 1 ) * 6 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// only legal types are Quadratic, BiQuadratic and Cubic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).MSEIRFTemp( I ) ) );
@@ -4560,7 +4621,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 12 + ( I - 1 ) * 6 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).MSEIRFTemp( I ) ) );
 						ShowContinueError( "Curve type must be BiQuadratic, Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}}
 				}
 
@@ -4573,7 +4634,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( 13 + ( I - 1 ) * 6 ) + "=\"" + Alphas( 13 + ( I - 1 ) * 6 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is Quadratic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).MSEIRFFlow( I ) ) );
@@ -4598,7 +4659,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 13 + ( I - 1 ) * 6 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).MSEIRFFlow( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}}
 				}
 
@@ -4611,7 +4672,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( 14 + ( I - 1 ) * 6 ) + "=\"" + Alphas( 14 + ( I - 1 ) * 6 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal types are Quadratic or Cubic
 					{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).MSPLFFPLR( I ) ) );
@@ -4624,10 +4685,10 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 14 + ( I - 1 ) * 6 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).MSPLFFPLR( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}}
 
-					if ( !ErrorsFound ) {
+					if ( !GetDXCoilsErrorsFound ) {
 						//       Test PLF curve minimum and maximum. Cap if less than 0.7 or greater than 1.0.
 						MinCurveVal = 999.0;
 						MaxCurveVal = -999.0;
@@ -4649,8 +4710,8 @@ namespace DXCoils {
 							ShowContinueError( "..." + cAlphaFields( 14 + ( I - 1 ) * 6 ) + " = " + Alphas( 14 + ( I - 1 ) * 6 ) + " has out of range value." );
 							ShowContinueError( "...Curve minimum must be >= 0.7, curve min at PLR = " + TrimSigDigits( MinCurvePLR, 2 ) + " is " + TrimSigDigits( MinCurveVal, 3 ) );
 							ShowContinueError( "...Setting curve minimum to 0.7 and simulation continues." );
-							SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), ErrorsFound, 0.7, _ );
-							SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).MSPLFFPLR( I ), ErrorsFound, 0.7, _ );
+							SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).PLFFPLR( 1 ), GetDXCoilsErrorsFound, 0.7, _ );
+							SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).MSPLFFPLR( I ), GetDXCoilsErrorsFound, 0.7, _ );
 						}
 
 						if ( MaxCurveVal > 1.0 ) {
@@ -4658,7 +4719,7 @@ namespace DXCoils {
 							ShowContinueError( "..." + cAlphaFields( 14 + ( I - 1 ) * 6 ) + " = " + Alphas( 14 + ( I - 1 ) * 6 ) + " has out of range value." );
 							ShowContinueError( "...Curve maximum must be <= 1.0, curve max at PLR = " + TrimSigDigits( MaxCurvePLR, 2 ) + " is " + TrimSigDigits( MaxCurveVal, 3 ) );
 							ShowContinueError( "...Setting curve maximum to 1.0 and simulation continues." );
-							SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).MSPLFFPLR( I ), ErrorsFound, _, 1.0 );
+							SetCurveOutputMinMaxValues( DXCoil( DXCoilNum ).MSPLFFPLR( I ), GetDXCoilsErrorsFound, _, 1.0 );
 						}
 
 					}
@@ -4684,7 +4745,7 @@ namespace DXCoils {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 							ShowContinueError( "...illegal " + cAlphaFields( 15 + ( I - 1 ) * 6 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).MSWasteHeat( I ) ) );
 							ShowContinueError( "Curve type must be BiQuadratic." );
-							ErrorsFound = true;
+							GetDXCoilsErrorsFound = true;
 						}}
 					}
 
@@ -4743,12 +4804,12 @@ namespace DXCoils {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), DXCoil, DXCoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, Alphas( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 			DXCoil( DXCoilNum ).Name = Alphas( 1 );
 			DXCoil( DXCoilNum ).DXCoilType = CurrentModuleObject;
@@ -4761,7 +4822,7 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cAlphaFields( 2 ) + "=\"" + Alphas( 2 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}
 			}
 			DXCoil( DXCoilNum ).RatedTotCap( 1 ) = Numbers( 1 );
@@ -4788,7 +4849,7 @@ namespace DXCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "...illegal " + cAlphaFields( 3 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).CCapFTemp( 1 ) ) );
 				ShowContinueError( "... Curve type must be Linear, Quadratic, Cubic, or BiQuadratic." );
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}}
 
 			DXCoil( DXCoilNum ).CCapFFlow( 1 ) = GetCurveIndex( Alphas( 4 ) ); // convert curve name to number
@@ -4800,7 +4861,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 4 ) + "=\"" + Alphas( 4 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				// Verify Curve Object, only legal type is Linear, Quadratic or Cubic
 				{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).CCapFFlow( 1 ) ) );
@@ -4811,13 +4872,13 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...illegal " + cAlphaFields( 4 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).CCapFFlow( 1 ) ) );
 					ShowContinueError( "... Curve type must be Linear, Quadratic or Cubic." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}}
 			}
 
-			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 5 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 5 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
 
-			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 6 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 6 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			TestCompSet( CurrentModuleObject, Alphas( 1 ), Alphas( 5 ), Alphas( 6 ), "Air Nodes" );
 
@@ -4826,12 +4887,12 @@ namespace DXCoils {
 				DXCoil( DXCoilNum ).CondensateCollectMode = CondensateDiscarded;
 			} else {
 				DXCoil( DXCoilNum ).CondensateCollectMode = CondensateToTank;
-				SetupTankSupplyComponent( DXCoil( DXCoilNum ).Name, CurrentModuleObject, DXCoil( DXCoilNum ).CondensateCollectName, ErrorsFound, DXCoil( DXCoilNum ).CondensateTankID, DXCoil( DXCoilNum ).CondensateTankSupplyARRID );
+				SetupTankSupplyComponent( DXCoil( DXCoilNum ).Name, CurrentModuleObject, DXCoil( DXCoilNum ).CondensateCollectName, GetDXCoilsErrorsFound, DXCoil( DXCoilNum ).CondensateTankID, DXCoil( DXCoilNum ).CondensateTankSupplyARRID );
 			}
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetDXCoilsErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in getting " + CurrentModuleObject + " input. Preceding condition(s) causes termination." );
 		}
 
@@ -4852,12 +4913,12 @@ namespace DXCoils {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), DXCoil, DXCoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, Alphas( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 			DXCoil( DXCoilNum ).Name = Alphas( 1 );
 			DXCoil( DXCoilNum ).DXCoilType = CurrentModuleObject;
@@ -4870,15 +4931,15 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cAlphaFields( 2 ) + "=\"" + Alphas( 2 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}
 			}
 			DXCoil( DXCoilNum ).RatedTotCap( 1 ) = Numbers( 1 );
 			DXCoil( DXCoilNum ).RatedAirVolFlowRate( 1 ) = Numbers( 2 );
 
-			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 3 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 3 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
 
-			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 4 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 4 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			TestCompSet( CurrentModuleObject, Alphas( 1 ), Alphas( 3 ), Alphas( 4 ), "Air Nodes" );
 
@@ -4891,7 +4952,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 5 ) + "=\"" + Alphas( 5 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				// Verify Curve Object, only legal type is Quadratic
 				{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).CCapFTemp( 1 ) ) );
@@ -4908,7 +4969,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...illegal " + cAlphaFields( 5 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).CCapFTemp( 1 ) ) );
 					ShowContinueError( "... Curve type must be Linear, Quadratic, Cubic or BiQuadratic." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}}
 			}
 
@@ -4921,7 +4982,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 6 ) + "=\"" + Alphas( 6 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				// Verify Curve Object, only legal type is Quadratic
 				{ auto const SELECT_CASE_var( GetCurveType( DXCoil( DXCoilNum ).CCapFFlow( 1 ) ) );
@@ -4932,13 +4993,13 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...illegal " + cAlphaFields( 5 ) + " type for this object = " + GetCurveType( DXCoil( DXCoilNum ).CCapFFlow( 1 ) ) );
 					ShowContinueError( "... Curve type must be linear, Quadratic or Cubic." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}}
 			}
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetDXCoilsErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in getting " + CurrentModuleObject + " input. Preceding condition(s) causes termination." );
 		}
 
@@ -4959,12 +5020,12 @@ namespace DXCoils {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), DXCoil, DXCoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, Alphas( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 			DXCoil( DXCoilNum ).Name = Alphas( 1 );
 			DXCoil( DXCoilNum ).DXCoilType = CurrentModuleObject;
@@ -4977,12 +5038,12 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cAlphaFields( 2 ) + "=\"" + Alphas( 2 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}
 			}
 
-			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 3 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 4 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 3 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 4 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 			TestCompSet( CurrentModuleObject, Alphas( 1 ), Alphas( 3 ), Alphas( 4 ), "Air Nodes" );
 
 			DXCoil( DXCoilNum ).RatedTotCap( 1 ) = Numbers( 1 );
@@ -5000,7 +5061,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 5 ) + "=\"" + Alphas( 5 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				{ auto const SELECT_CASE_var( GetCurveType( indexSHCurve ) );
 
@@ -5013,7 +5074,7 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 5 ) + " type for this object = " + GetCurveType( indexSHCurve ) );
 						ShowContinueError( "... Curve type must be Quadratic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}
 				}
 			}
@@ -5023,12 +5084,12 @@ namespace DXCoils {
 				DXCoil( DXCoilNum ).CondensateCollectMode = CondensateDiscarded;
 			} else {
 				DXCoil( DXCoilNum ).CondensateCollectMode = CondensateToTank;
-				SetupTankSupplyComponent( DXCoil( DXCoilNum ).Name, CurrentModuleObject, DXCoil( DXCoilNum ).CondensateCollectName, ErrorsFound, DXCoil( DXCoilNum ).CondensateTankID, DXCoil( DXCoilNum ).CondensateTankSupplyARRID );
+				SetupTankSupplyComponent( DXCoil( DXCoilNum ).Name, CurrentModuleObject, DXCoil( DXCoilNum ).CondensateCollectName, GetDXCoilsErrorsFound, DXCoil( DXCoilNum ).CondensateTankID, DXCoil( DXCoilNum ).CondensateTankSupplyARRID );
 			}
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetDXCoilsErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in getting " + CurrentModuleObject + " input. Preceding condition(s) causes termination." );
 		}
 
@@ -5049,12 +5110,12 @@ namespace DXCoils {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), DXCoil, DXCoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, Alphas( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			}
 			DXCoil( DXCoilNum ).Name = Alphas( 1 );
 			DXCoil( DXCoilNum ).DXCoilType = CurrentModuleObject;
@@ -5067,12 +5128,12 @@ namespace DXCoils {
 				if ( DXCoil( DXCoilNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cAlphaFields( 2 ) + "=\"" + Alphas( 2 ) + "\"." );
-					ErrorsFound = true;
+					GetDXCoilsErrorsFound = true;
 				}
 			}
 
-			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 3 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 4 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 3 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			DXCoil( DXCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 4 ), GetDXCoilsErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 			TestCompSet( CurrentModuleObject, Alphas( 1 ), Alphas( 3 ), Alphas( 4 ), "Air Nodes" );
 
 			DXCoil( DXCoilNum ).RatedTotCap( 1 ) = Numbers( 1 );
@@ -5089,7 +5150,7 @@ namespace DXCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 5 ) + "=\"" + Alphas( 5 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetDXCoilsErrorsFound = true;
 			} else {
 				{ auto const SELECT_CASE_var( GetCurveType( indexSCCurve ) );
 
@@ -5102,13 +5163,13 @@ namespace DXCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + DXCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 5 ) + " type for this object = " + GetCurveType( indexSCCurve ) );
 						ShowContinueError( "... Curve type must be Quadratic." );
-						ErrorsFound = true;
+						GetDXCoilsErrorsFound = true;
 					}
 				}
 			}
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetDXCoilsErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in getting " + CurrentModuleObject + " input. Preceding condition(s) causes termination." );
 		}
 
@@ -5445,7 +5506,6 @@ namespace DXCoils {
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		static Real64 SmallDifferenceTest( 0.00000001 );
 		static std::string const RoutineName( "InitDXCoil" );
 
 		// INTERFACE BLOCK SPECIFICATIONS
@@ -5455,14 +5515,10 @@ namespace DXCoils {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array1D_bool MyEnvrnFlag; // One time environment flag
-		static Array1D_bool MySizeFlag; // One time sizing flag
-		static bool CrankcaseHeaterReportVarFlag( true ); // One time flag used to report crankcase heater power for non-HP coils
 		Real64 RatedHeatPumpIndoorAirTemp; // Indoor dry-bulb temperature to heat pump evaporator at rated conditions [C]
 		Real64 RatedHeatPumpIndoorHumRat; // Inlet humidity ratio to heat pump evaporator at rated conditions [kgWater/kgDryAir]
 		Real64 RatedVolFlowPerRatedTotCap; // Rated Air Volume Flow Rate divided by Rated Total Capacity [m3/s-W)
 		Real64 HPInletAirHumRat; // Rated inlet air humidity ratio for heat pump water heater [kgWater/kgDryAir]
-		static bool ErrorsFound( false ); // TRUE when errors found
 		int CapacityStageNum; // Loop index for 1,Number of capacity stages
 		int DehumidModeNum; // Loop index for 1,Number of enhanced dehumidification modes
 		int Mode; // Performance mode for MultiMode DX coil; Always 1 for other coil types
@@ -5572,13 +5628,13 @@ namespace DXCoils {
 				// Check for zero capacity or zero max flow rate
 				if ( DXCoil( DXCoilNum ).RatedTotCap( Mode ) <= 0.0 ) {
 					ShowSevereError( "Sizing: " + DXCoil( DXCoilNum ).DXCoilType + ' ' + DXCoil( DXCoilNum ).Name + " has zero rated total capacity" );
-					ErrorsFound = true;
+					InitDXCoilErrorsFound = true;
 				}
 				if ( DXCoil( DXCoilNum ).RatedAirVolFlowRate( Mode ) <= 0.0 ) {
 					ShowSevereError( "Sizing: " + DXCoil( DXCoilNum ).DXCoilType + ' ' + DXCoil( DXCoilNum ).Name + " has zero rated air flow rate" );
-					ErrorsFound = true;
+					InitDXCoilErrorsFound = true;
 				}
-				if ( ErrorsFound ) {
+				if ( InitDXCoilErrorsFound ) {
 					ShowFatalError( "Preceding condition causes termination." );
 				}
 				
@@ -5605,14 +5661,14 @@ namespace DXCoils {
 						if ( DXCoil( DXCoilNum ).RatedTotCap( Mode ) <= 0.0 ) {
 							ShowSevereError( "Sizing: " + DXCoil( DXCoilNum ).DXCoilType + ' ' + DXCoil( DXCoilNum ).Name + " has zero rated total capacity" );
 							ShowContinueError( "for CoilPerformance:DX:Cooling mode: " + DXCoil( DXCoilNum ).CoilPerformanceName( Mode ) );
-							ErrorsFound = true;
+							InitDXCoilErrorsFound = true;
 						}
 						if ( DXCoil( DXCoilNum ).RatedAirVolFlowRate( Mode ) <= 0.0 ) {
 							ShowSevereError( "Sizing: " + DXCoil( DXCoilNum ).DXCoilType + ' ' + DXCoil( DXCoilNum ).Name + " has zero rated air flow rate" );
 							ShowContinueError( "for CoilPerformance:DX:Cooling mode: " + DXCoil( DXCoilNum ).CoilPerformanceName( Mode ) );
-							ErrorsFound = true;
+							InitDXCoilErrorsFound = true;
 						}
-						if ( ErrorsFound ) {
+						if ( InitDXCoilErrorsFound ) {
 							ShowFatalError( "Preceding condition causes termination." );
 						}
 						// Check for valid range of (Rated Air Volume Flow Rate / Rated Total Capacity)
@@ -5635,13 +5691,13 @@ namespace DXCoils {
 				Mode = 1;
 				if ( DXCoil( DXCoilNum ).RatedTotCap( Mode ) <= 0.0 ) {
 					ShowSevereError( "Sizing: " + DXCoil( DXCoilNum ).DXCoilType + ' ' + DXCoil( DXCoilNum ).Name + " has zero rated total capacity" );
-					ErrorsFound = true;
+					InitDXCoilErrorsFound = true;
 				}
 				if ( DXCoil( DXCoilNum ).RatedAirVolFlowRate( Mode ) <= 0.0 ) {
 					ShowSevereError( "Sizing: " + DXCoil( DXCoilNum ).DXCoilType + ' ' + DXCoil( DXCoilNum ).Name + " has zero rated air flow rate" );
-					ErrorsFound = true;
+					InitDXCoilErrorsFound = true;
 				}
-				if ( ErrorsFound ) {
+				if ( InitDXCoilErrorsFound ) {
 					ShowFatalError( "Preceding condition causes termination." );
 				}
 				RatedHeatPumpIndoorAirTemp = 21.11; // 21.11C or 70F
@@ -5683,13 +5739,13 @@ namespace DXCoils {
 					// Check for zero capacity or zero max flow rate
 					if ( DXCoil( DXCoilNum ).MSRatedTotCap( Mode ) <= 0.0 ) {
 						ShowSevereError( "Sizing: " + DXCoil( DXCoilNum ).DXCoilType + ' ' + DXCoil( DXCoilNum ).Name + " has zero rated total capacity at speed " + TrimSigDigits( Mode ) );
-						ErrorsFound = true;
+						InitDXCoilErrorsFound = true;
 					}
 					if ( DXCoil( DXCoilNum ).MSRatedAirVolFlowRate( Mode ) <= 0.0 ) {
 						ShowSevereError( "Sizing: " + DXCoil( DXCoilNum ).DXCoilType + ' ' + DXCoil( DXCoilNum ).Name + " has zero rated air flow rate at speed " + TrimSigDigits( Mode ) );
-						ErrorsFound = true;
+						InitDXCoilErrorsFound = true;
 					}
-					if ( ErrorsFound ) {
+					if ( InitDXCoilErrorsFound ) {
 						ShowFatalError( "Preceding condition causes termination." );
 					}
 					// Check for valid range of (Rated Air Volume Flow Rate / Rated Total Capacity)
@@ -7435,6 +7491,7 @@ namespace DXCoils {
 		using DataHeatBalance::Zone;
 		using DataHeatBalFanSys::ZoneAirHumRat;
 		using DataHeatBalFanSys::ZT;
+		using DataSystemVariables::MemoizeDXCoilEnvFlag;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -7499,7 +7556,6 @@ namespace DXCoils {
 		Real64 RhoAir; // Density of air [kg/m3]
 		Real64 RhoWater; // Density of water [kg/m3]
 		Real64 CrankcaseHeatingPower; // power due to crankcase heater
-		static Real64 CompAmbTemp( 0.0 ); // Ambient temperature at compressor
 		Real64 AirFlowRatio; // ratio of compressor on airflow to average timestep airflow
 		// used when constant fan mode yields different air flow rates when compressor is ON and OFF
 		// (e.g. Packaged Terminal Heat Pump)
@@ -7508,8 +7564,6 @@ namespace DXCoils {
 		Real64 OutdoorHumRat; // Outdoor humidity ratio at condenser (kg/kg)
 		Real64 OutdoorPressure; // Outdoor barometric pressure at condenser (Pa)
 
-		static Real64 CurrentEndTime( 0.0 ); // end time of time step for current simulation time step
-		static Real64 MinAirHumRat( 0.0 ); // minimum of the inlet air humidity ratio and the outlet air humidity ratio
 		//CHARACTER(len=6) :: OutputChar = ' '     ! character string for warning messages
 		//INTEGER,SAVE     :: ErrCount3=0    ! Counter used to minimize the occurrence of output warnings
 		//INTEGER,SAVE     :: ErrCount4=0    ! Counter used to minimize the occurrence of output warnings
@@ -7526,6 +7580,9 @@ namespace DXCoils {
 		Real64 DXcoolToHeatPLRRatio; // ratio of cooling PLR to heating PLR, used for cycling fan RH control
 		Real64 HeatRTF; // heating coil part-load ratio, used for cycling fan RH control
 		Real64 HeatingCoilPLF; // heating coil PLF (function of PLR), used for cycling fan RH control
+		CoilPerfMemoKey MemoKey; // quantized inputs of the full load capacity and SHR calculation
+		CoilPerfMemoValues MemoValues; // memoized full load capacity and SHR results
+		bool MemoFound; // true if the full load results were found in the memo
 
 		// If Performance mode not present, then set to 1.  Used only by Multimode/Multispeed DX coil (otherwise mode = 1)
 		if ( present( PerfMode ) ) {
@@ -7763,7 +7820,22 @@ namespace DXCoils {
 			//  InletAirHumRat may be modified in this ADP/BF loop, use temporary varible for calculations
 			InletAirHumRatTemp = InletAirHumRat;
 			AirMassFlowRatio = AirMassFlow / DXCoil( DXCoilNum ).RatedAirMassFlowRate( Mode );
-			while ( true ) {
+			// The full load capacity and SHR do not depend on the part load ratio, so parent objects searching
+			// for the part load ratio find them in the memo after the first iteration.  The rated capacity and
+			// bypass factor are part of the key because heat pump water heaters reset the rated capacity.
+			MemoFound = false;
+			if ( MemoizeDXCoilEnvFlag ) {
+				MemoKey = { { DXCoilNum, Mode, QuantizeCoilPerfMemo( InletAirDryBulbTemp, MemoTempQuantum ), QuantizeCoilPerfMemo( InletAirHumRat, MemoHumRatQuantum ), QuantizeCoilPerfMemo( InletAirEnthalpy, MemoEnthalpyQuantum ), QuantizeCoilPerfMemo( OutdoorPressure, MemoPressureQuantum ), QuantizeCoilPerfMemo( CondInletTemp, MemoTempQuantum ), QuantizeCoilPerfMemo( AirMassFlow, MemoMassFlowQuantum ), QuantizeCoilPerfMemo( DXCoil( DXCoilNum ).RatedTotCap( Mode ), MemoCapacityQuantum ), QuantizeCoilPerfMemo( CBF, MemoRatioQuantum ) } };
+				MemoFound = FindCoilPerfMemo( Doe2FullLoadMemo, MemoKey, MemoValues );
+				if ( MemoFound ) {
+					TotCap = MemoValues[ 0 ];
+					SHR = MemoValues[ 1 ];
+					hDelta = MemoValues[ 2 ];
+					InletAirWetBulbC = MemoValues[ 3 ];
+					Counter = int( MemoValues[ 4 ] );
+				}
+			}
+			while ( ! MemoFound ) {
 				if ( DXCoil( DXCoilNum ).DXCoilType_Num == CoilDX_HeatPumpWaterHeaterPumped || DXCoil( DXCoilNum ).DXCoilType_Num == CoilDX_HeatPumpWaterHeaterWrapped ) {
 					// Coil:DX:HeatPumpWaterHeater does not have total cooling capacity as a function of temp or flow curve
 					TotCapTempModFac = 1.0;
@@ -7851,6 +7923,11 @@ namespace DXCoils {
 				}
 			} // end of DO iteration loop
 
+			// Results of negative curve outputs are not memoized so that their warnings keep being counted
+			if ( MemoizeDXCoilEnvFlag && ! MemoFound && TotCapTempModFac > 0.0 && TotCapFlowModFac > 0.0 ) {
+				StoreCoilPerfMemo( Doe2FullLoadMemo, MemoKey, { { TotCap, SHR, hDelta, InletAirWetBulbC, Real64( Counter ) } } );
+			}
+
 			if ( DXCoil( DXCoilNum ).PLFFPLR( Mode ) > 0 ) {
 				PLF = CurveValue( DXCoil( DXCoilNum ).PLFFPLR( Mode ), PartLoadRatio ); // Calculate part-load factor
 			} else {
@@ -8147,8 +8224,8 @@ namespace DXCoils {
 			// Calculation for heat reclaim needs to be corrected to use compressor power (not including condenser fan power)
 			HeatReclaimDXCoil( DXCoilNum ).AvailCapacity = DXCoil( DXCoilNum ).TotalCoolingEnergyRate + DXCoil( DXCoilNum ).ElecCoolingPower;
 
-			MinAirHumRat = min( InletAirHumRat, OutletAirHumRat );
-			DXCoil( DXCoilNum ).SensCoolingEnergyRate = AirMassFlow * ( PsyHFnTdbW( InletAirDryBulbTemp, MinAirHumRat ) - PsyHFnTdbW( OutletAirTemp, MinAirHumRat ) );
+			CalcDoe2DXCoilMinAirHumRat = min( InletAirHumRat, OutletAirHumRat );
+			DXCoil( DXCoilNum ).SensCoolingEnergyRate = AirMassFlow * ( PsyHFnTdbW( InletAirDryBulbTemp, CalcDoe2DXCoilMinAirHumRat ) - PsyHFnTdbW( OutletAirTemp, CalcDoe2DXCoilMinAirHumRat ) );
 			//  Don't let sensible capacity be greater than total capacity
 			if ( DXCoil( DXCoilNum ).SensCoolingEnergyRate > DXCoil( DXCoilNum ).TotalCoolingEnergyRate ) {
 				DXCoil( DXCoilNum ).SensCoolingEnergyRate = DXCoil( DXCoilNum ).TotalCoolingEnergyRate;
@@ -8361,7 +8438,6 @@ namespace DXCoils {
 		Real64 CondAirMassFlow; // Condenser air mass flow rate [kg/s]
 		Real64 RhoAir; // Density of air [kg/m3]
 		Real64 CrankcaseHeatingPower; // power due to crankcase heater
-		static Real64 CompAmbTemp( 0.0 ); // Ambient temperature at compressor
 		Real64 AirFlowRatio; // ratio of compressor on airflow to average timestep airflow
 		// used when constant fan mode yields different air flow rates when compressor is ON and OFF
 		// (e.g. Packaged Terminal Heat Pump)
@@ -8370,8 +8446,6 @@ namespace DXCoils {
 		Real64 OutdoorHumRat; // Outdoor humidity ratio at condenser (kg/kg)
 		Real64 OutdoorPressure; // Outdoor barometric pressure at condenser (Pa)
 
-		static Real64 CurrentEndTime( 0.0 ); // end time of time step for current simulation time step
-		static Real64 MinAirHumRat( 0.0 ); // minimum of the inlet air humidity ratio and the outlet air humidity ratio
 		int Mode; // Performance mode for Multimode DX coil; Always 1 for other coil types
 		Real64 OutletAirTemp; // Supply air temperature (average value if constant fan, full output if cycling fan)
 		Real64 OutletAirHumRat; // Supply air humidity ratio (average value if constant fan, full output if cycling fan)
@@ -8443,33 +8517,33 @@ namespace DXCoils {
 			// (Outdoor wet-bulb temp from DataEnvironment) + (1.0-EvapCondEffectiveness) * (drybulb - wetbulb)
 			CondInletTemp = OutdoorWetBulb + ( OutdoorDryBulb - OutdoorWetBulb ) * ( 1.0 - DXCoil( DXCoilNum ).EvapCondEffect( Mode ) );
 			CondInletHumRat = PsyWFnTdbTwbPb( CondInletTemp, OutdoorWetBulb, OutdoorPressure );
-			CompAmbTemp = OutdoorDryBulb;
+			CalcVRFCoolingCoilCompAmbTemp = OutdoorDryBulb;
 		} else { // for air or water-cooled, inlet temp is stored in OutdoorDryBulb temp
 			CondInletTemp = OutdoorDryBulb; // Outdoor dry-bulb temp or water inlet temp
 			if ( DXCoil( DXCoilNum ).CondenserType( Mode ) == WaterCooled ) {
-				CompAmbTemp = OutDryBulbTemp; // for crankcase heater use actual outdoor temp for water-cooled
+				CalcVRFCoolingCoilCompAmbTemp = OutDryBulbTemp; // for crankcase heater use actual outdoor temp for water-cooled
 			} else {
-				CompAmbTemp = OutdoorDryBulb;
+				CalcVRFCoolingCoilCompAmbTemp = OutdoorDryBulb;
 			}
 		}
 
 		// Initialize crankcase heater, operates below OAT defined in input deck for HP DX cooling coil
 		// If used in a heat pump, the value of MaxOAT in the heating coil overrides that in the cooling coil (in GetInput)
-		if ( CompAmbTemp < DXCoil( DXCoilNum ).MaxOATCrankcaseHeater ) {
+		if ( CalcVRFCoolingCoilCompAmbTemp < DXCoil( DXCoilNum ).MaxOATCrankcaseHeater ) {
 			CrankcaseHeatingPower = DXCoil( DXCoilNum ).CrankcaseHeaterCapacity;
 		} else {
 			CrankcaseHeatingPower = 0.0;
 		}
 
 		// calculate end time of current time step to determine if error messages should be printed
-		CurrentEndTime = CurrentTime + SysTimeElapsed;
+		CalcVRFCoolingCoilCurrentEndTime = CurrentTime + SysTimeElapsed;
 
 		//   Print warning messages only when valid and only for the first ocurrance. Let summary provide statistics.
 		//   Wait for next time step to print warnings. If simulation iterates, print out
 		//   the warning for the last iteration only. Must wait for next time step to accomplish this.
 		//   If a warning occurs and the simulation down shifts, the warning is not valid.
 		if ( DXCoil( DXCoilNum ).PrintLowAmbMessage ) { // .AND. &
-			if ( CurrentEndTime > DXCoil( DXCoilNum ).CurrentEndTimeLast && TimeStepSys >= DXCoil( DXCoilNum ).TimeStepSysLast ) {
+			if ( CalcVRFCoolingCoilCurrentEndTime > DXCoil( DXCoilNum ).CurrentEndTimeLast && TimeStepSys >= DXCoil( DXCoilNum ).TimeStepSysLast ) {
 				if ( DXCoil( DXCoilNum ).LowAmbErrIndex == 0 ) {
 					ShowWarningMessage( DXCoil( DXCoilNum ).LowAmbBuffer1 );
 					ShowContinueError( DXCoil( DXCoilNum ).LowAmbBuffer2 );
@@ -8480,7 +8554,7 @@ namespace DXCoils {
 		}
 
 		if ( DXCoil( DXCoilNum ).PrintHighAmbMessage ) { // .AND. &
-			if ( CurrentEndTime > DXCoil( DXCoilNum ).CurrentEndTimeLast && TimeStepSys >= DXCoil( DXCoilNum ).TimeStepSysLast ) {
+			if ( CalcVRFCoolingCoilCurrentEndTime > DXCoil( DXCoilNum ).CurrentEndTimeLast && TimeStepSys >= DXCoil( DXCoilNum ).TimeStepSysLast ) {
 				if ( DXCoil( DXCoilNum ).HighAmbErrIndex == 0 ) {
 					ShowWarningMessage( DXCoil( DXCoilNum ).HighAmbBuffer1 );
 					ShowContinueError( DXCoil( DXCoilNum ).HighAmbBuffer2 );
@@ -8491,7 +8565,7 @@ namespace DXCoils {
 		}
 
 		if ( DXCoil( DXCoilNum ).PrintLowOutTempMessage ) {
-			if ( CurrentEndTime > DXCoil( DXCoilNum ).CurrentEndTimeLast && TimeStepSys >= DXCoil( DXCoilNum ).TimeStepSysLast ) {
+			if ( CalcVRFCoolingCoilCurrentEndTime > DXCoil( DXCoilNum ).CurrentEndTimeLast && TimeStepSys >= DXCoil( DXCoilNum ).TimeStepSysLast ) {
 				if ( DXCoil( DXCoilNum ).LowOutletTempIndex == 0 ) {
 					ShowWarningMessage( DXCoil( DXCoilNum ).LowOutTempBuffer1 );
 					ShowContinueError( DXCoil( DXCoilNum ).LowOutTempBuffer2 );
@@ -8506,7 +8580,7 @@ namespace DXCoils {
 
 		// save last system time step and last end time of current time step (used to determine if warning is valid)
 		DXCoil( DXCoilNum ).TimeStepSysLast = TimeStepSys;
-		DXCoil( DXCoilNum ).CurrentEndTimeLast = CurrentEndTime;
+		DXCoil( DXCoilNum ).CurrentEndTimeLast = CalcVRFCoolingCoilCurrentEndTime;
 		DXCoil( DXCoilNum ).PrintLowAmbMessage = false;
 		DXCoil( DXCoilNum ).PrintLowOutTempMessage = false;
 
@@ -8797,8 +8871,8 @@ Label50: ;
 			//! Calculation for heat reclaim needs to be corrected to use compressor power (not including condenser fan power)
 			//  HeatReclaimDXCoil(DXCoilNum)%AvailCapacity = DXCoil(DXCoilNum)%TotalCoolingEnergyRate + DXCoil(DXCoilNum)%ElecCoolingPower
 
-			MinAirHumRat = min( InletAirHumRat, OutletAirHumRat );
-			DXCoil( DXCoilNum ).SensCoolingEnergyRate = AirMassFlow * ( PsyHFnTdbW( InletAirDryBulbTemp, MinAirHumRat ) - PsyHFnTdbW( OutletAirTemp, MinAirHumRat ) );
+			CalcVRFCoolingCoilMinAirHumRat = min( InletAirHumRat, OutletAirHumRat );
+			DXCoil( DXCoilNum ).SensCoolingEnergyRate = AirMassFlow * ( PsyHFnTdbW( InletAirDryBulbTemp, CalcVRFCoolingCoilMinAirHumRat ) - PsyHFnTdbW( OutletAirTemp, CalcVRFCoolingCoilMinAirHumRat ) );
 			//  Don't let sensible capacity be greater than total capacity
 			if ( DXCoil( DXCoilNum ).SensCoolingEnergyRate > DXCoil( DXCoilNum ).TotalCoolingEnergyRate ) {
 				DXCoil( DXCoilNum ).SensCoolingEnergyRate = DXCoil( DXCoilNum ).TotalCoolingEnergyRate;
@@ -8949,7 +9023,6 @@ Label50: ;
 		Real64 OutdoorWetBulb; // Outdoor wet-bulb temperature at condenser (C)
 		Real64 OutdoorHumRat; // Outdoor humidity ratio at condenser (kg/kg)
 		Real64 OutdoorPressure; // Outdoor barometric pressure at condenser (Pa)
-		static int Mode( 1 ); // Performance mode for MultiMode DX coil; Always 1 for other coil types
 		Real64 AirFlowRatio; // Ratio of compressor on airflow to average timestep airflow
 		Real64 OutletAirTemp; // Supply air temperature (average value if constant fan, full output if cycling fan)
 		Real64 OutletAirHumRat; // Supply air humidity ratio (average value if constant fan, full output if cycling fan)
@@ -8964,7 +9037,7 @@ Label50: ;
 		// Get condenser outdoor node info from DX Heating Coil
 		if ( DXCoil( DXCoilNum ).CondenserInletNodeNum( 1 ) != 0 ) {
 			OutdoorDryBulb = Node( DXCoil( DXCoilNum ).CondenserInletNodeNum( 1 ) ).Temp;
-			if ( DXCoil( DXCoilNum ).CondenserType( Mode ) == WaterCooled ) {
+			if ( DXCoil( DXCoilNum ).CondenserType( CalcDXHeatingCoilMode ) == WaterCooled ) {
 				OutdoorHumRat = OutHumRat;
 				OutdoorPressure = OutBaroPress;
 				OutdoorWetBulb = OutWetBulbTemp;
@@ -9025,7 +9098,7 @@ Label50: ;
 			AirVolumeFlowRate = AirMassFlow / PsyRhoAirFnPbTdbW( OutdoorPressure, InletAirDryBulbTemp, InletAirHumRat );
 			//  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
 			//  AirVolumeFlowRate = AirMassFlow/PsyRhoAirFnPbTdbW(InletAirPressure,InletAirDryBulbTemp, InletAirHumRat)
-			VolFlowperRatedTotCap = AirVolumeFlowRate / DXCoil( DXCoilNum ).RatedTotCap( Mode );
+			VolFlowperRatedTotCap = AirVolumeFlowRate / DXCoil( DXCoilNum ).RatedTotCap( CalcDXHeatingCoilMode );
 
 			if ( ( VolFlowperRatedTotCap < MinOperVolFlowPerRatedTotCap( DXCT ) ) || ( VolFlowperRatedTotCap > MaxHeatVolFlowPerRatedTotCap( DXCT ) ) ) {
 				if ( DXCoil( DXCoilNum ).ErrIndex1 == 0 ) {
@@ -9042,12 +9115,12 @@ Label50: ;
 			// Model was extended to accept bi-quadratic curves. This allows sensitivity of the heating capacity
 			// to the entering dry-bulb temperature as well as the outside dry-bulb temperature. User is
 			// advised to use the bi-quaratic curve if sufficient manufacturer data is available.
-			if ( DXCoil( DXCoilNum ).TotCapTempModFacCurveType( Mode ) == BiQuadratic ) {
+			if ( DXCoil( DXCoilNum ).TotCapTempModFacCurveType( CalcDXHeatingCoilMode ) == BiQuadratic ) {
 				{ auto const SELECT_CASE_var( DXCoil( DXCoilNum ).HeatingPerformanceOATType );
 				if ( SELECT_CASE_var == DryBulbIndicator ) {
-					TotCapTempModFac = CurveValue( DXCoil( DXCoilNum ).CCapFTemp( Mode ), InletAirDryBulbTemp, OutdoorDryBulb );
+					TotCapTempModFac = CurveValue( DXCoil( DXCoilNum ).CCapFTemp( CalcDXHeatingCoilMode ), InletAirDryBulbTemp, OutdoorDryBulb );
 				} else if ( SELECT_CASE_var == WetBulbIndicator ) {
-					TotCapTempModFac = CurveValue( DXCoil( DXCoilNum ).CCapFTemp( Mode ), InletAirDryBulbTemp, OutdoorWetBulb );
+					TotCapTempModFac = CurveValue( DXCoil( DXCoilNum ).CCapFTemp( CalcDXHeatingCoilMode ), InletAirDryBulbTemp, OutdoorWetBulb );
 				} else {
 					TotCapTempModFac = 1.0;
 				}}
@@ -9055,15 +9128,15 @@ Label50: ;
 				{ auto const SELECT_CASE_var( DXCoil( DXCoilNum ).HeatingPerformanceOATType );
 				if ( SELECT_CASE_var == DryBulbIndicator ) {
 					if ( DXCoil( DXCoilNum ).DXCoilType_Num != CoilVRF_Heating && DXCoil( DXCoilNum ).DXCoilType_Num != CoilVRF_FluidTCtrl_Heating ) {
-						TotCapTempModFac = CurveValue( DXCoil( DXCoilNum ).CCapFTemp( Mode ), OutdoorDryBulb );
+						TotCapTempModFac = CurveValue( DXCoil( DXCoilNum ).CCapFTemp( CalcDXHeatingCoilMode ), OutdoorDryBulb );
 					} else {
-						TotCapTempModFac = CurveValue( DXCoil( DXCoilNum ).CCapFTemp( Mode ), InletAirDryBulbTemp );
+						TotCapTempModFac = CurveValue( DXCoil( DXCoilNum ).CCapFTemp( CalcDXHeatingCoilMode ), InletAirDryBulbTemp );
 					}
 				} else if ( SELECT_CASE_var == WetBulbIndicator ) {
 					if ( DXCoil( DXCoilNum ).DXCoilType_Num != CoilVRF_Heating && DXCoil( DXCoilNum ).DXCoilType_Num != CoilVRF_FluidTCtrl_Heating ) {
-						TotCapTempModFac = CurveValue( DXCoil( DXCoilNum ).CCapFTemp( Mode ), OutdoorWetBulb );
+						TotCapTempModFac = CurveValue( DXCoil( DXCoilNum ).CCapFTemp( CalcDXHeatingCoilMode ), OutdoorWetBulb );
 					} else {
-						TotCapTempModFac = CurveValue( DXCoil( DXCoilNum ).CCapFTemp( Mode ), InletAirDryBulbTemp );
+						TotCapTempModFac = CurveValue( DXCoil( DXCoilNum ).CCapFTemp( CalcDXHeatingCoilMode ), InletAirDryBulbTemp );
 					}
 				} else {
 					TotCapTempModFac = 1.0;
@@ -9071,11 +9144,11 @@ Label50: ;
 			}
 
 			//  Get total capacity modifying factor (function of mass flow) for off-rated conditions
-			AirMassFlowRatio = AirMassFlow / DXCoil( DXCoilNum ).RatedAirMassFlowRate( Mode );
-			TotCapFlowModFac = CurveValue( DXCoil( DXCoilNum ).CCapFFlow( Mode ), AirMassFlowRatio );
+			AirMassFlowRatio = AirMassFlow / DXCoil( DXCoilNum ).RatedAirMassFlowRate( CalcDXHeatingCoilMode );
+			TotCapFlowModFac = CurveValue( DXCoil( DXCoilNum ).CCapFFlow( CalcDXHeatingCoilMode ), AirMassFlowRatio );
 
 			// Calculate total heating capacity for off-rated conditions
-			TotCap = DXCoil( DXCoilNum ).RatedTotCap( Mode ) * TotCapFlowModFac * TotCapTempModFac;
+			TotCap = DXCoil( DXCoilNum ).RatedTotCap( CalcDXHeatingCoilMode ) * TotCapFlowModFac * TotCapTempModFac;
 
 			// Calculating adjustment factors for defrost
 			// Calculate delta w through outdoor coil by assuming a coil temp of 0.82*DBT-9.7(F) per DOE2.1E
@@ -9089,7 +9162,7 @@ Label50: ;
 			InputPowerMultiplier = 1.0;
 
 			// Check outdoor temperature to determine of defrost is active
-			if( OutdoorDryBulb <= DXCoil( DXCoilNum ).MaxOATDefrost && DXCoil( DXCoilNum ).CondenserType( Mode ) != WaterCooled ) {
+			if( OutdoorDryBulb <= DXCoil( DXCoilNum ).MaxOATDefrost && DXCoil( DXCoilNum ).CondenserType( CalcDXHeatingCoilMode ) != WaterCooled ) {
 				// Calculate defrost adjustment factors depending on defrost control type
 				if ( DXCoil( DXCoilNum ).DefrostControl == Timed ) {
 					FractionalDefrostTime = DXCoil( DXCoilNum ).DefrostTime;
@@ -9106,9 +9179,9 @@ Label50: ;
 				if ( FractionalDefrostTime > 0.0 ) {
 					// Calculate defrost adjustment factors depending on defrost control strategy
 					if ( DXCoil( DXCoilNum ).DefrostStrategy == ReverseCycle ) {
-						LoadDueToDefrost = ( 0.01 * FractionalDefrostTime ) * ( 7.222 - OutdoorDryBulb ) * ( DXCoil( DXCoilNum ).RatedTotCap( Mode ) / 1.01667 );
+						LoadDueToDefrost = ( 0.01 * FractionalDefrostTime ) * ( 7.222 - OutdoorDryBulb ) * ( DXCoil( DXCoilNum ).RatedTotCap( CalcDXHeatingCoilMode ) / 1.01667 );
 						DefrostEIRTempModFac = CurveValue( DXCoil( DXCoilNum ).DefrostEIRFT, max( 15.555, InletAirWetBulbC ), max( 15.555, OutdoorDryBulb ) );
-						DXCoil( DXCoilNum ).DefrostPower = DefrostEIRTempModFac * ( DXCoil( DXCoilNum ).RatedTotCap( Mode ) / 1.01667 ) * FractionalDefrostTime;
+						DXCoil( DXCoilNum ).DefrostPower = DefrostEIRTempModFac * ( DXCoil( DXCoilNum ).RatedTotCap( CalcDXHeatingCoilMode ) / 1.01667 ) * FractionalDefrostTime;
 					} else { // Defrost strategy is resistive
 						DXCoil( DXCoilNum ).DefrostPower = DXCoil( DXCoilNum ).DefrostCapacity * FractionalDefrostTime;
 					}
@@ -9159,22 +9232,22 @@ Label50: ;
 			// advised to use the bi-quaratic curve if sufficient manufacturer data is available.
 			if ( DXCoil( DXCoilNum ).DXCoilType_Num != CoilVRF_Heating && DXCoil( DXCoilNum ).DXCoilType_Num != CoilVRF_FluidTCtrl_Heating ) {
 				if ( ( DXCoil( DXCoilNum ).EIRTempModFacCurveType( 1 ) == Quadratic ) || ( DXCoil( DXCoilNum ).EIRTempModFacCurveType( 1 ) == Cubic ) ) {
-					EIRTempModFac = CurveValue( DXCoil( DXCoilNum ).EIRFTemp( Mode ), OutdoorDryBulb );
+					EIRTempModFac = CurveValue( DXCoil( DXCoilNum ).EIRFTemp( CalcDXHeatingCoilMode ), OutdoorDryBulb );
 				} else if ( DXCoil( DXCoilNum ).EIRTempModFacCurveType( 1 ) == BiQuadratic ) {
-					EIRTempModFac = CurveValue( DXCoil( DXCoilNum ).EIRFTemp( Mode ), InletAirDryBulbTemp, OutdoorDryBulb );
+					EIRTempModFac = CurveValue( DXCoil( DXCoilNum ).EIRFTemp( CalcDXHeatingCoilMode ), InletAirDryBulbTemp, OutdoorDryBulb );
 				} else {
 					assert( false );
 				}
-				EIRFlowModFac = CurveValue( DXCoil( DXCoilNum ).EIRFFlow( Mode ), AirMassFlowRatio );
+				EIRFlowModFac = CurveValue( DXCoil( DXCoilNum ).EIRFFlow( CalcDXHeatingCoilMode ), AirMassFlowRatio );
 			} else {
 				EIRTempModFac = 1.0;
 				EIRFlowModFac = 1.0;
 			}
-			EIR = DXCoil( DXCoilNum ).RatedEIR( Mode ) * EIRTempModFac * EIRFlowModFac;
+			EIR = DXCoil( DXCoilNum ).RatedEIR( CalcDXHeatingCoilMode ) * EIRTempModFac * EIRFlowModFac;
 			// Calculate modified PartLoadRatio due to defrost (reverse-cycle defrost only)
 			PLRHeating = min( 1.0, ( PartLoadRatio + ( LoadDueToDefrost * PartLoadRatio ) / TotCapAdj ) );
 			if ( DXCoil( DXCoilNum ).DXCoilType_Num != CoilVRF_Heating ) {
-				PLF = CurveValue( DXCoil( DXCoilNum ).PLFFPLR( Mode ), PLRHeating ); // Calculate part-load factor
+				PLF = CurveValue( DXCoil( DXCoilNum ).PLFFPLR( CalcDXHeatingCoilMode ), PLRHeating ); // Calculate part-load factor
 			} else {
 				PLF = 1.0;
 			}
@@ -9366,8 +9439,6 @@ Label50: ;
 		Real64 RhoWater; // Density of water [kg/m3]
 		Real64 CondAirMassFlow; // Condenser air mass flow rate [kg/s]
 		Real64 EvapCondPumpElecPower; // Evaporative condenser electric pump power [W]
-		static Real64 MinAirHumRat( 0.0 ); // minimum of the inlet air humidity ratio and the outlet air humidity ratio
-		static int Mode( 1 ); // Performance mode for MultiMode DX coil; Always 1 for other coil types
 		Real64 OutdoorDryBulb; // Outdoor dry-bulb temperature at condenser (C)
 		Real64 OutdoorWetBulb; // Outdoor wet-bulb temperature at condenser (C)
 		Real64 OutdoorHumRat; // Outdoor humidity ratio at condenser (kg/kg)
@@ -9381,8 +9452,8 @@ Label50: ;
 			LocalForceOn = false;
 		}
 
-		if ( DXCoil( DXCoilNum ).CondenserInletNodeNum( Mode ) != 0 ) {
-			OutdoorPressure = Node( DXCoil( DXCoilNum ).CondenserInletNodeNum( Mode ) ).Press;
+		if ( DXCoil( DXCoilNum ).CondenserInletNodeNum( CalcMultiSpeedDXCoilMode ) != 0 ) {
+			OutdoorPressure = Node( DXCoil( DXCoilNum ).CondenserInletNodeNum( CalcMultiSpeedDXCoilMode ) ).Press;
 			// If node is not connected to anything, pressure = default, use weather data
 			if ( OutdoorPressure == DefaultNodeValues.Press ) {
 				OutdoorDryBulb = OutDryBulbTemp;
@@ -9390,8 +9461,8 @@ Label50: ;
 				OutdoorPressure = OutBaroPress;
 				OutdoorWetBulb = OutWetBulbTemp;
 			} else {
-				OutdoorDryBulb = Node( DXCoil( DXCoilNum ).CondenserInletNodeNum( Mode ) ).Temp;
-				OutdoorHumRat = Node( DXCoil( DXCoilNum ).CondenserInletNodeNum( Mode ) ).HumRat;
+				OutdoorDryBulb = Node( DXCoil( DXCoilNum ).CondenserInletNodeNum( CalcMultiSpeedDXCoilMode ) ).Temp;
+				OutdoorHumRat = Node( DXCoil( DXCoilNum ).CondenserInletNodeNum( CalcMultiSpeedDXCoilMode ) ).HumRat;
 				OutdoorWetBulb = PsyTwbFnTdbWPb( OutdoorDryBulb, OutdoorHumRat, OutdoorPressure );
 			}
 			if ( DXCoil( DXCoilNum ).IsSecondaryDXCoilInZone ) {
@@ -9413,7 +9484,7 @@ Label50: ;
 		}
 
 		AirMassFlow = DXCoil( DXCoilNum ).InletAirMassFlowRate;
-		AirMassFlowRatio = DXCoil( DXCoilNum ).InletAirMassFlowRateMax / DXCoil( DXCoilNum ).RatedAirMassFlowRate( Mode );
+		AirMassFlowRatio = DXCoil( DXCoilNum ).InletAirMassFlowRateMax / DXCoil( DXCoilNum ).RatedAirMassFlowRate( CalcMultiSpeedDXCoilMode );
 		DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction = 0.0;
 		InletAirDryBulbTemp = DXCoil( DXCoilNum ).InletAirTemp;
 		InletAirEnthalpy = DXCoil( DXCoilNum ).InletAirEnthalpy;
@@ -9423,11 +9494,11 @@ Label50: ;
 		//InletAirPressure = DXCoil(DXCoilNum)%InletAirPressure
 		//InletAirWetBulbC = PsyTwbFnTdbWPb(InletAirDryBulbTemp,InletAirHumRat,InletAirPressure)
 		InletAirWetBulbC = PsyTwbFnTdbWPb( InletAirDryBulbTemp, InletAirHumRat, OutdoorPressure );
-		if ( DXCoil( DXCoilNum ).CondenserType( Mode ) == AirCooled ) {
+		if ( DXCoil( DXCoilNum ).CondenserType( CalcMultiSpeedDXCoilMode ) == AirCooled ) {
 			CondInletTemp = OutdoorDryBulb; // Outdoor dry-bulb temp
-		} else if ( DXCoil( DXCoilNum ).CondenserType( Mode ) == EvapCooled ) {
+		} else if ( DXCoil( DXCoilNum ).CondenserType( CalcMultiSpeedDXCoilMode ) == EvapCooled ) {
 			// Outdoor wet-bulb temp from DataEnvironment + (1.0-EvapCondEffectiveness) * (drybulb - wetbulb)
-			CondInletTemp = OutdoorWetBulb + ( OutdoorDryBulb - OutdoorWetBulb ) * ( 1.0 - DXCoil( DXCoilNum ).EvapCondEffect( Mode ) );
+			CondInletTemp = OutdoorWetBulb + ( OutdoorDryBulb - OutdoorWetBulb ) * ( 1.0 - DXCoil( DXCoilNum ).EvapCondEffect( CalcMultiSpeedDXCoilMode ) );
 			CondInletHumRat = PsyWFnTdbTwbPb( CondInletTemp, OutdoorWetBulb, OutdoorPressure );
 		}
 
@@ -9436,18 +9507,18 @@ Label50: ;
 			RhoAir = PsyRhoAirFnPbTdbW( OutdoorPressure, OutdoorDryBulb, OutdoorHumRat );
 			if ( SpeedRatio > 0.0 ) {
 				// Adjust high speed coil bypass factor for actual maximum air flow rate.
-				RatedCBFHS = DXCoil( DXCoilNum ).RatedCBF( Mode );
-				CBFHS = AdjustCBF( RatedCBFHS, DXCoil( DXCoilNum ).RatedAirMassFlowRate( Mode ), DXCoil( DXCoilNum ).InletAirMassFlowRateMax );
+				RatedCBFHS = DXCoil( DXCoilNum ).RatedCBF( CalcMultiSpeedDXCoilMode );
+				CBFHS = AdjustCBF( RatedCBFHS, DXCoil( DXCoilNum ).RatedAirMassFlowRate( CalcMultiSpeedDXCoilMode ), DXCoil( DXCoilNum ).InletAirMassFlowRateMax );
 				// get high speed total capacity and SHR at current conditions
-				CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, AirMassFlowRatio, DXCoil( DXCoilNum ).InletAirMassFlowRateMax, DXCoil( DXCoilNum ).RatedTotCap( Mode ), CBFHS, DXCoil( DXCoilNum ).CCapFTemp( Mode ), DXCoil( DXCoilNum ).CCapFFlow( Mode ), TotCapHS, SHRHS, CondInletTemp, OutdoorPressure );
+				CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, AirMassFlowRatio, DXCoil( DXCoilNum ).InletAirMassFlowRateMax, DXCoil( DXCoilNum ).RatedTotCap( CalcMultiSpeedDXCoilMode ), CBFHS, DXCoil( DXCoilNum ).CCapFTemp( CalcMultiSpeedDXCoilMode ), DXCoil( DXCoilNum ).CCapFFlow( CalcMultiSpeedDXCoilMode ), TotCapHS, SHRHS, CondInletTemp, OutdoorPressure );
 				//  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
 				//                       CondInletTemp, Node(DXCoil(DXCoilNum)%AirInNode)%Press)
 				// get the high speed SHR from user specified SHR modifier curves
 				if ( DXCoil( DXCoilNum ).UserSHRCurveExists ) {
-					SHRHS = CalcSHRUserDefinedCurves( InletAirDryBulbTemp, InletAirWetBulbC, AirMassFlowRatio, DXCoil( DXCoilNum ).SHRFTemp( Mode ), DXCoil( DXCoilNum ).SHRFFlow( Mode ), DXCoil( DXCoilNum ).RatedSHR( Mode ) );
+					SHRHS = CalcSHRUserDefinedCurves( InletAirDryBulbTemp, InletAirWetBulbC, AirMassFlowRatio, DXCoil( DXCoilNum ).SHRFTemp( CalcMultiSpeedDXCoilMode ), DXCoil( DXCoilNum ).SHRFFlow( CalcMultiSpeedDXCoilMode ), DXCoil( DXCoilNum ).RatedSHR( CalcMultiSpeedDXCoilMode ) );
 				}
 				// get low speed total capacity and SHR at current conditions
-				CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, 1.0, DXCoil( DXCoilNum ).RatedAirMassFlowRate2, DXCoil( DXCoilNum ).RatedTotCap2, DXCoil( DXCoilNum ).RatedCBF2, DXCoil( DXCoilNum ).CCapFTemp2, DXCoil( DXCoilNum ).CCapFFlow( Mode ), TotCapLS, SHRLS, CondInletTemp, OutdoorPressure );
+				CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, 1.0, DXCoil( DXCoilNum ).RatedAirMassFlowRate2, DXCoil( DXCoilNum ).RatedTotCap2, DXCoil( DXCoilNum ).RatedCBF2, DXCoil( DXCoilNum ).CCapFTemp2, DXCoil( DXCoilNum ).CCapFFlow( CalcMultiSpeedDXCoilMode ), TotCapLS, SHRLS, CondInletTemp, OutdoorPressure );
 				//  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
 				//                       Node(DXCoil(DXCoilNum)%AirInNode)%Press)
 				// get the low speed SHR from user specified SHR modifier curves
@@ -9455,9 +9526,9 @@ Label50: ;
 					SHRLS = CalcSHRUserDefinedCurves( InletAirDryBulbTemp, InletAirWetBulbC, AirMassFlowRatio2, DXCoil( DXCoilNum ).SHRFTemp2, DXCoil( DXCoilNum ).SHRFFlow2, DXCoil( DXCoilNum ).RatedSHR2 );
 				}
 				// get high speed EIR at current conditions
-				EIRTempModFacHS = CurveValue( DXCoil( DXCoilNum ).EIRFTemp( Mode ), InletAirWetBulbC, CondInletTemp );
-				EIRFlowModFacHS = CurveValue( DXCoil( DXCoilNum ).EIRFFlow( Mode ), AirMassFlowRatio );
-				EIRHS = DXCoil( DXCoilNum ).RatedEIR( Mode ) * EIRFlowModFacHS * EIRTempModFacHS;
+				EIRTempModFacHS = CurveValue( DXCoil( DXCoilNum ).EIRFTemp( CalcMultiSpeedDXCoilMode ), InletAirWetBulbC, CondInletTemp );
+				EIRFlowModFacHS = CurveValue( DXCoil( DXCoilNum ).EIRFFlow( CalcMultiSpeedDXCoilMode ), AirMassFlowRatio );
+				EIRHS = DXCoil( DXCoilNum ).RatedEIR( CalcMultiSpeedDXCoilMode ) * EIRFlowModFacHS * EIRTempModFacHS;
 				// get low speed EIR at current conditions
 				//    EIRTempModFacLS = CurveValue(DXCoil(DXCoilNum)%EIRFTemp(Mode),InletAirWetBulbC,CondInletTemp)
 				//    CR7307 changed EIRTempModFacLS calculation to that shown below.
@@ -9471,15 +9542,15 @@ Label50: ;
 					EIR = EIRHS;
 					CBFNom = CBFHS;
 					AirMassFlowNom = DXCoil( DXCoilNum ).InletAirMassFlowRateMax;
-					CondAirMassFlow = RhoAir * DXCoil( DXCoilNum ).EvapCondAirFlow( Mode );
-					EvapCondPumpElecPower = DXCoil( DXCoilNum ).EvapCondPumpElecNomPower( Mode );
+					CondAirMassFlow = RhoAir * DXCoil( DXCoilNum ).EvapCondAirFlow( CalcMultiSpeedDXCoilMode );
+					EvapCondPumpElecPower = DXCoil( DXCoilNum ).EvapCondPumpElecNomPower( CalcMultiSpeedDXCoilMode );
 				} else {
 					TotCap = SpeedRatio * TotCapHS + ( 1.0 - SpeedRatio ) * TotCapLS;
 					EIR = SpeedRatio * EIRHS + ( 1.0 - SpeedRatio ) * EIRLS;
 					CBFNom = SpeedRatio * CBFHS + ( 1.0 - SpeedRatio ) * DXCoil( DXCoilNum ).RatedCBF2;
 					AirMassFlowNom = SpeedRatio * DXCoil( DXCoilNum ).InletAirMassFlowRateMax + ( 1.0 - SpeedRatio ) * DXCoil( DXCoilNum ).RatedAirMassFlowRate2;
-					CondAirMassFlow = RhoAir * ( SpeedRatio * DXCoil( DXCoilNum ).EvapCondAirFlow( Mode ) + ( 1.0 - SpeedRatio ) * DXCoil( DXCoilNum ).EvapCondAirFlow2 );
-					EvapCondPumpElecPower = SpeedRatio * DXCoil( DXCoilNum ).EvapCondPumpElecNomPower( Mode ) + ( 1.0 - SpeedRatio ) * DXCoil( DXCoilNum ).EvapCondPumpElecNomPower2;
+					CondAirMassFlow = RhoAir * ( SpeedRatio * DXCoil( DXCoilNum ).EvapCondAirFlow( CalcMultiSpeedDXCoilMode ) + ( 1.0 - SpeedRatio ) * DXCoil( DXCoilNum ).EvapCondAirFlow2 );
+					EvapCondPumpElecPower = SpeedRatio * DXCoil( DXCoilNum ).EvapCondPumpElecNomPower( CalcMultiSpeedDXCoilMode ) + ( 1.0 - SpeedRatio ) * DXCoil( DXCoilNum ).EvapCondPumpElecNomPower2;
 				}
 				hDelta = TotCap / AirMassFlow;
 				if ( DXCoil( DXCoilNum ).UserSHRCurveExists ) {
@@ -9545,8 +9616,8 @@ Label50: ;
 				}
 				// calculate cooling rate and electrical power
 				DXCoil( DXCoilNum ).TotalCoolingEnergyRate = AirMassFlow * ( InletAirEnthalpy - OutletAirEnthalpy );
-				MinAirHumRat = min( InletAirHumRat, OutletAirHumRat );
-				DXCoil( DXCoilNum ).SensCoolingEnergyRate = AirMassFlow * ( PsyHFnTdbW( InletAirDryBulbTemp, MinAirHumRat ) - PsyHFnTdbW( OutletAirDryBulbTemp, MinAirHumRat ) );
+				CalcMultiSpeedDXCoilMinAirHumRat = min( InletAirHumRat, OutletAirHumRat );
+				DXCoil( DXCoilNum ).SensCoolingEnergyRate = AirMassFlow * ( PsyHFnTdbW( InletAirDryBulbTemp, CalcMultiSpeedDXCoilMinAirHumRat ) - PsyHFnTdbW( OutletAirDryBulbTemp, CalcMultiSpeedDXCoilMinAirHumRat ) );
 				// Don't let sensible capacity be greater than total capacity
 				if ( DXCoil( DXCoilNum ).SensCoolingEnergyRate > DXCoil( DXCoilNum ).TotalCoolingEnergyRate ) {
 					DXCoil( DXCoilNum ).SensCoolingEnergyRate = DXCoil( DXCoilNum ).TotalCoolingEnergyRate;
@@ -9564,7 +9635,7 @@ Label50: ;
 
 			} else if ( CycRatio > 0.0 ) {
 
-				if ( DXCoil( DXCoilNum ).CondenserType( Mode ) == EvapCooled ) {
+				if ( DXCoil( DXCoilNum ).CondenserType( CalcMultiSpeedDXCoilMode ) == EvapCooled ) {
 					// Outdoor wet-bulb temp from DataEnvironment + (1.0-EvapCondEffectiveness) * (drybulb - wetbulb)
 					CondInletTemp = OutdoorWetBulb + ( OutdoorDryBulb - OutdoorWetBulb ) * ( 1.0 - DXCoil( DXCoilNum ).EvapCondEffect2 );
 					CondInletHumRat = PsyWFnTdbTwbPb( CondInletTemp, OutdoorWetBulb, OutdoorPressure );
@@ -9573,7 +9644,7 @@ Label50: ;
 				// Adjust low speed coil bypass factor for actual flow rate.
 				// CBF = AdjustCBF(DXCoil(DXCoilNum)%RatedCBF2,DXCoil(DXCoilNum)%RatedAirMassFlowRate2,AirMassFlow)
 				// get low speed total capacity and SHR at current conditions
-				CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, 1.0, DXCoil( DXCoilNum ).RatedAirMassFlowRate2, DXCoil( DXCoilNum ).RatedTotCap2, DXCoil( DXCoilNum ).RatedCBF2, DXCoil( DXCoilNum ).CCapFTemp2, DXCoil( DXCoilNum ).CCapFFlow( Mode ), TotCapLS, SHRLS, CondInletTemp, OutdoorPressure );
+				CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, 1.0, DXCoil( DXCoilNum ).RatedAirMassFlowRate2, DXCoil( DXCoilNum ).RatedTotCap2, DXCoil( DXCoilNum ).RatedCBF2, DXCoil( DXCoilNum ).CCapFTemp2, DXCoil( DXCoilNum ).CCapFFlow( CalcMultiSpeedDXCoilMode ), TotCapLS, SHRLS, CondInletTemp, OutdoorPressure );
 				// get the low speed SHR from user specified SHR modifier curves
 				if ( DXCoil( DXCoilNum ).UserSHRCurveExists ) {
 					SHRLS = CalcSHRUserDefinedCurves( InletAirDryBulbTemp, InletAirWetBulbC, 1.0, DXCoil( DXCoilNum ).SHRFTemp2, DXCoil( DXCoilNum ).SHRFFlow2, DXCoil( DXCoilNum ).RatedSHR2 );
@@ -9643,7 +9714,7 @@ Label50: ;
 				EIRTempModFacLS = CurveValue( DXCoil( DXCoilNum ).EIRFTemp2, InletAirWetBulbC, CondInletTemp );
 				EIRLS = DXCoil( DXCoilNum ).RatedEIR2 * EIRTempModFacLS;
 				// get the part load factor that will account for cycling losses
-				PLF = CurveValue( DXCoil( DXCoilNum ).PLFFPLR( Mode ), CycRatio );
+				PLF = CurveValue( DXCoil( DXCoilNum ).PLFFPLR( CalcMultiSpeedDXCoilMode ), CycRatio );
 				if ( PLF < 0.7 ) {
 					PLF = 0.7;
 				}
@@ -9659,8 +9730,8 @@ Label50: ;
 				DXCoil( DXCoilNum ).TotalCoolingEnergyRate = AirMassFlow * ( InletAirEnthalpy - OutletAirEnthalpy );
 				//   Calculation for heat reclaim needs to be corrected to use compressor power (not including condenser fan power)
 				HeatReclaimDXCoil( DXCoilNum ).AvailCapacity = DXCoil( DXCoilNum ).TotalCoolingEnergyRate + DXCoil( DXCoilNum ).ElecCoolingPower;
-				MinAirHumRat = min( InletAirHumRat, OutletAirHumRat );
-				DXCoil( DXCoilNum ).SensCoolingEnergyRate = AirMassFlow * ( PsyHFnTdbW( InletAirDryBulbTemp, MinAirHumRat ) - PsyHFnTdbW( OutletAirDryBulbTemp, MinAirHumRat ) );
+				CalcMultiSpeedDXCoilMinAirHumRat = min( InletAirHumRat, OutletAirHumRat );
+				DXCoil( DXCoilNum ).SensCoolingEnergyRate = AirMassFlow * ( PsyHFnTdbW( InletAirDryBulbTemp, CalcMultiSpeedDXCoilMinAirHumRat ) - PsyHFnTdbW( OutletAirDryBulbTemp, CalcMultiSpeedDXCoilMinAirHumRat ) );
 				// Don't let sensible capacity be greater than total capacity
 				if ( DXCoil( DXCoilNum ).SensCoolingEnergyRate > DXCoil( DXCoilNum ).TotalCoolingEnergyRate ) {
 					DXCoil( DXCoilNum ).SensCoolingEnergyRate = DXCoil( DXCoilNum ).TotalCoolingEnergyRate;
@@ -9674,7 +9745,7 @@ Label50: ;
 
 			}
 
-			if ( DXCoil( DXCoilNum ).CondenserType( Mode ) == EvapCooled ) {
+			if ( DXCoil( DXCoilNum ).CondenserType( CalcMultiSpeedDXCoilMode ) == EvapCooled ) {
 				//******************
 				//             WATER CONSUMPTION IN m3 OF WATER FOR DIRECT
 				//             H2O [m3/sec] = Delta W[KgH2O/Kg air]*Mass Flow Air[Kg air]
@@ -9709,7 +9780,7 @@ Label50: ;
 			DXCoil( DXCoilNum ).EvapWaterConsumpRate = 0.0;
 
 			// Calculate basin heater power
-			if ( DXCoil( DXCoilNum ).CondenserType( Mode ) == EvapCooled ) {
+			if ( DXCoil( DXCoilNum ).CondenserType( CalcMultiSpeedDXCoilMode ) == EvapCooled ) {
 				CalcBasinHeaterPower( DXCoil( DXCoilNum ).BasinHeaterPowerFTempDiff, DXCoil( DXCoilNum ).BasinHeaterSchedulePtr, DXCoil( DXCoilNum ).BasinHeaterSetPointTemp, DXCoil( DXCoilNum ).BasinHeaterPower );
 			}
 		}
@@ -9894,7 +9965,6 @@ Label50: ;
 
 		// FUNCTION PARAMETER DEFINITIONS:
 		static std::string const RoutineName( "CalcCBF" );
-		static Real64 SmallDifferenceTest( 0.00000001 );
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -9923,7 +9993,6 @@ Label50: ;
 		Real64 Slope( 0.0 ); // Calculated Slope used while hunting for Tadp
 		Real64 Tolerance; // Convergence tolerance for CBF calculations
 		Real64 HTinHumRatOut; // Air enthalpy at inlet air temp and outlet air humidity ratio [J/kg]
-		static bool CBFErrors( false ); // Set to true if errors in CBF calculation, fatal at end of routine
 
 		DeltaH = TotCap / AirMassFlowRate;
 		InletAirEnthalpy = PsyHFnTdbW( InletAirTemp, InletAirHumRat );
@@ -9951,7 +10020,7 @@ Label50: ;
 			ShowContinueError( "...Air Mass Flow Rate used in calculation     = " + RoundSigDigits( AirMassFlowRate, 6 ) + " kg/s" );
 			ShowContinueError( "...Air Volume Flow Rate used in calculation   = " + RoundSigDigits( AirMassFlowRate / PsyRhoAirFnPbTdbW( BaroPress, InletAirTemp, InletAirHumRat, RoutineName ), 6 ) + " m3/s" );
 			if ( TotCap > 0.0 ) {
-				if ( ( ( MinRatedVolFlowPerRatedTotCap( DXCT ) - AirMassFlowRate / PsyRhoAirFnPbTdbW( BaroPress, InletAirTemp, InletAirHumRat, RoutineName ) / TotCap ) > SmallDifferenceTest ) || ( ( AirMassFlowRate / PsyRhoAirFnPbTdbW( BaroPress, InletAirTemp, InletAirHumRat, RoutineName ) / TotCap - MaxRatedVolFlowPerRatedTotCap( DXCT ) ) > SmallDifferenceTest ) ) {
+				if ( ( ( MinRatedVolFlowPerRatedTotCap( DXCT ) - AirMassFlowRate / PsyRhoAirFnPbTdbW( BaroPress, InletAirTemp, InletAirHumRat, RoutineName ) / TotCap ) > CalcCBFSmallDifferenceTest ) || ( ( AirMassFlowRate / PsyRhoAirFnPbTdbW( BaroPress, InletAirTemp, InletAirHumRat, RoutineName ) / TotCap - MaxRatedVolFlowPerRatedTotCap( DXCT ) ) > CalcCBFSmallDifferenceTest ) ) {
 					ShowContinueError( "...Air Volume Flow Rate per Watt of Rated Cooling Capacity is also out of bounds at = " + RoundSigDigits( AirMassFlowRate / PsyRhoAirFnPbTdbW( BaroPress, InletAirTemp, InletAirHumRat, RoutineName ) / TotCap, 7 ) + " m3/s/W" );
 				}
 			}
@@ -9975,7 +10044,7 @@ Label50: ;
 			ShowContinueError( "...Air Mass Flow Rate used in calculation     = " + RoundSigDigits( AirMassFlowRate, 6 ) + " kg/s" );
 			ShowContinueError( "...Air Volume Flow Rate used in calculation   = " + RoundSigDigits( AirMassFlowRate / PsyRhoAirFnPbTdbW( BaroPress, InletAirTemp, InletAirHumRat, RoutineName ), 6 ) + " m3/s" );
 			if ( TotCap > 0.0 ) {
-				if ( ( ( MinRatedVolFlowPerRatedTotCap( DXCT ) - AirMassFlowRate / PsyRhoAirFnPbTdbW( BaroPress, InletAirTemp, InletAirHumRat, RoutineName ) / TotCap ) > SmallDifferenceTest ) || ( ( AirMassFlowRate / PsyRhoAirFnPbTdbW( BaroPress, InletAirTemp, InletAirHumRat, RoutineName ) / TotCap - MaxRatedVolFlowPerRatedTotCap( DXCT ) ) > SmallDifferenceTest ) ) {
+				if ( ( ( MinRatedVolFlowPerRatedTotCap( DXCT ) - AirMassFlowRate / PsyRhoAirFnPbTdbW( BaroPress, InletAirTemp, InletAirHumRat, RoutineName ) / TotCap ) > CalcCBFSmallDifferenceTest ) || ( ( AirMassFlowRate / PsyRhoAirFnPbTdbW( BaroPress, InletAirTemp, InletAirHumRat, RoutineName ) / TotCap - MaxRatedVolFlowPerRatedTotCap( DXCT ) ) > CalcCBFSmallDifferenceTest ) ) {
 					ShowContinueError( "...Air Volume Flow Rate per Watt of Rated Cooling Capacity is also out of bounds at = " + RoundSigDigits( AirMassFlowRate / PsyRhoAirFnPbTdbW( BaroPress, InletAirTemp, InletAirHumRat, RoutineName ) / TotCap, 7 ) + " m3/s/W" );
 				}
 			}
@@ -10000,7 +10069,7 @@ Label50: ;
 			ShowContinueError( "...Air Mass Flow Rate used in calculation     = " + RoundSigDigits( AirMassFlowRate, 6 ) + " kg/s" );
 			ShowContinueError( "...Air Volume Flow Rate used in calculation   = " + RoundSigDigits( AirMassFlowRate / PsyRhoAirFnPbTdbW( BaroPress, InletAirTemp, InletAirHumRat, RoutineName ), 6 ) + " m3/s" );
 			if ( TotCap > 0.0 ) {
-				if ( ( ( MinRatedVolFlowPerRatedTotCap( DXCT ) - AirMassFlowRate / PsyRhoAirFnPbTdbW( BaroPress, InletAirTemp, InletAirHumRat, RoutineName ) / TotCap ) > SmallDifferenceTest ) || ( ( AirMassFlowRate / PsyRhoAirFnPbTdbW( BaroPress, InletAirTemp, InletAirHumRat, RoutineName ) / TotCap - MaxRatedVolFlowPerRatedTotCap( DXCT ) ) > SmallDifferenceTest ) ) {
+				if ( ( ( MinRatedVolFlowPerRatedTotCap( DXCT ) - AirMassFlowRate / PsyRhoAirFnPbTdbW( BaroPress, InletAirTemp, InletAirHumRat, RoutineName ) / TotCap ) > CalcCBFSmallDifferenceTest ) || ( ( AirMassFlowRate / PsyRhoAirFnPbTdbW( BaroPress, InletAirTemp, InletAirHumRat, RoutineName ) / TotCap - MaxRatedVolFlowPerRatedTotCap( DXCT ) ) > CalcCBFSmallDifferenceTest ) ) {
 					ShowContinueError( "...Air Volume Flow Rate per Watt of Rated Cooling Capacity is also out of bounds at = " + RoundSigDigits( AirMassFlowRate / PsyRhoAirFnPbTdbW( BaroPress, InletAirTemp, InletAirHumRat, RoutineName ) / TotCap, 7 ) + " m3/s/W" );
 				}
 			}
@@ -10391,6 +10460,7 @@ Label50: ;
 
 		// Using/Aliasing
 		using CurveManager::CurveValue;
+		using DataSystemVariables::MemoizeDXCoilEnvFlag;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -10423,6 +10493,17 @@ Label50: ;
 		Real64 TotCapCalc; // temporary calculated value of total capacity [W]
 		int Counter; // Counter for dry evaporator iterations
 		Real64 werror; // Deviation of humidity ratio in dry evaporator iteration loop
+		CoilPerfMemoKey MemoKey; // quantized inputs of the calculation
+		CoilPerfMemoValues MemoValues; // memoized total capacity and SHR
+
+		if ( MemoizeDXCoilEnvFlag ) {
+			MemoKey = { { QuantizeCoilPerfMemo( InletDryBulb, MemoTempQuantum ), QuantizeCoilPerfMemo( InletHumRat, MemoHumRatQuantum ), QuantizeCoilPerfMemo( InletEnthalpy, MemoEnthalpyQuantum ), QuantizeCoilPerfMemo( InletWetBulb, MemoTempQuantum ), QuantizeCoilPerfMemo( AirMassFlowRatio, MemoRatioQuantum ), QuantizeCoilPerfMemo( AirMassFlow, MemoMassFlowQuantum ), QuantizeCoilPerfMemo( TotCapNom, MemoCapacityQuantum ), QuantizeCoilPerfMemo( CBF, MemoRatioQuantum ), CCapFTemp, CCapFFlow, QuantizeCoilPerfMemo( CondInletTemp, MemoTempQuantum ), QuantizeCoilPerfMemo( Pressure, MemoPressureQuantum ) } };
+			if ( FindCoilPerfMemo( TotCapSHRMemo, MemoKey, MemoValues ) ) {
+				TotCap = MemoValues[ 0 ];
+				SHR = MemoValues[ 1 ];
+				return;
+			}
+		}
 
 		//  MaxIter = 30
 		//  RF = 0.4d0
@@ -10480,6 +10561,8 @@ Label50: ;
 		SHR = SHRCalc;
 		TotCap = TotCapCalc;
 
+		if ( MemoizeDXCoilEnvFlag ) StoreCoilPerfMemo( TotCapSHRMemo, MemoKey, { { TotCap, SHR } } );
+
 	}
 
 	void
@@ -10592,8 +10675,6 @@ Label50: ;
 		Real64 RhoWater; // Density of water [kg/m3]
 		Real64 CondAirMassFlow; // Condenser air mass flow rate [kg/s]
 		Real64 EvapCondPumpElecPower; // Evaporative condenser electric pump power [W]
-		static Real64 MinAirHumRat( 0.0 ); // minimum of the inlet air humidity ratio and the outlet air humidity ratio
-		static int DXMode( 1 ); // Performance mode for MultiMode DX coil; Always 1 for other coil types
 		Real64 OutdoorDryBulb; // Outdoor dry-bulb temperature at condenser (C)
 		Real64 OutdoorWetBulb; // Outdoor wet-bulb temperature at condenser (C)
 		Real64 OutdoorHumRat; // Outdoor humidity ratio at condenser (kg/kg)
@@ -10869,8 +10950,8 @@ Label50: ;
 				DXCoil( DXCoilNum ).TotalCoolingEnergyRate = MSHPMassFlowRateHigh * ( InletAirEnthalpy - HSOutletAirEnthalpy ) * SpeedRatio + MSHPMassFlowRateLow * ( InletAirEnthalpy - LSOutletAirEnthalpy ) * ( 1.0 - SpeedRatio );
 				// Average outlet enthalpy
 				OutletAirEnthalpy = InletAirEnthalpy - DXCoil( DXCoilNum ).TotalCoolingEnergyRate / DXCoil( DXCoilNum ).InletAirMassFlowRate;
-				MinAirHumRat = min( InletAirHumRat, SpeedRatio * HSOutletAirHumRat + ( 1.0 - SpeedRatio ) * LSOutletAirHumRat );
-				DXCoil( DXCoilNum ).SensCoolingEnergyRate = MSHPMassFlowRateHigh * ( PsyHFnTdbW( InletAirDryBulbTemp, MinAirHumRat ) - PsyHFnTdbW( HSOutletAirDryBulbTemp, MinAirHumRat ) ) * SpeedRatio + MSHPMassFlowRateLow * ( PsyHFnTdbW( InletAirDryBulbTemp, MinAirHumRat ) - PsyHFnTdbW( LSOutletAirDryBulbTemp, MinAirHumRat ) ) * ( 1.0 - SpeedRatio );
+				CalcMultiSpeedDXCoilCoolingMinAirHumRat = min( InletAirHumRat, SpeedRatio * HSOutletAirHumRat + ( 1.0 - SpeedRatio ) * LSOutletAirHumRat );
+				DXCoil( DXCoilNum ).SensCoolingEnergyRate = MSHPMassFlowRateHigh * ( PsyHFnTdbW( InletAirDryBulbTemp, CalcMultiSpeedDXCoilCoolingMinAirHumRat ) - PsyHFnTdbW( HSOutletAirDryBulbTemp, CalcMultiSpeedDXCoilCoolingMinAirHumRat ) ) * SpeedRatio + MSHPMassFlowRateLow * ( PsyHFnTdbW( InletAirDryBulbTemp, CalcMultiSpeedDXCoilCoolingMinAirHumRat ) - PsyHFnTdbW( LSOutletAirDryBulbTemp, CalcMultiSpeedDXCoilCoolingMinAirHumRat ) ) * ( 1.0 - SpeedRatio );
 				if ( DXCoil( DXCoilNum ).SensCoolingEnergyRate > DXCoil( DXCoilNum ).TotalCoolingEnergyRate ) {
 					DXCoil( DXCoilNum ).SensCoolingEnergyRate = DXCoil( DXCoilNum ).TotalCoolingEnergyRate;
 				}
@@ -10888,7 +10969,7 @@ Label50: ;
 					OutletAirDryBulbTemp = HSOutletAirDryBulbTemp;
 				} else {
 					if ( FanOpMode == ContFanCycCoil ) {
-						Hfg = PsyHfgAirFnWTdb( MinAirHumRat, HSOutletAirDryBulbTemp * SpeedRatio + ( 1.0 - SpeedRatio ) * LSOutletAirDryBulbTemp );
+						Hfg = PsyHfgAirFnWTdb( CalcMultiSpeedDXCoilCoolingMinAirHumRat, HSOutletAirDryBulbTemp * SpeedRatio + ( 1.0 - SpeedRatio ) * LSOutletAirDryBulbTemp );
 						// Average outlet HR
 						OutletAirHumRat = InletAirHumRat - DXCoil( DXCoilNum ).LatCoolingEnergyRate / Hfg / DXCoil( DXCoilNum ).InletAirMassFlowRate;
 					} else {
@@ -10898,8 +10979,8 @@ Label50: ;
 					if ( OutletAirDryBulbTemp < OutletAirDryBulbTempSat ) { // Limit to saturated conditions at OutletAirEnthalpy
 						OutletAirDryBulbTemp = OutletAirDryBulbTempSat;
 						OutletAirHumRat = PsyWFnTdbH( OutletAirDryBulbTemp, OutletAirEnthalpy, RoutineName );
-						MinAirHumRat = min( InletAirHumRat, OutletAirHumRat );
-						DXCoil( DXCoilNum ).SensCoolingEnergyRate = AirMassFlow * ( PsyHFnTdbW( InletAirDryBulbTemp, MinAirHumRat ) - PsyHFnTdbW( OutletAirDryBulbTemp, MinAirHumRat ) );
+						CalcMultiSpeedDXCoilCoolingMinAirHumRat = min( InletAirHumRat, OutletAirHumRat );
+						DXCoil( DXCoilNum ).SensCoolingEnergyRate = AirMassFlow * ( PsyHFnTdbW( InletAirDryBulbTemp, CalcMultiSpeedDXCoilCoolingMinAirHumRat ) - PsyHFnTdbW( OutletAirDryBulbTemp, CalcMultiSpeedDXCoilCoolingMinAirHumRat ) );
 						if ( DXCoil( DXCoilNum ).SensCoolingEnergyRate > DXCoil( DXCoilNum ).TotalCoolingEnergyRate ) {
 							DXCoil( DXCoilNum ).SensCoolingEnergyRate = DXCoil( DXCoilNum ).TotalCoolingEnergyRate;
 						}
@@ -11072,29 +11153,29 @@ Label50: ;
 				DXCoil( DXCoilNum ).TotalCoolingEnergyRate = AirMassFlow * ( InletAirEnthalpy - LSOutletAirEnthalpy ) * CycRatio;
 				if ( FanOpMode == ContFanCycCoil ) {
 					OutletAirEnthalpy = InletAirEnthalpy - DXCoil( DXCoilNum ).TotalCoolingEnergyRate / DXCoil( DXCoilNum ).InletAirMassFlowRate;
-					MinAirHumRat = min( InletAirHumRat, LSOutletAirHumRat );
-					DXCoil( DXCoilNum ).SensCoolingEnergyRate = AirMassFlow * ( PsyHFnTdbW( InletAirDryBulbTemp, MinAirHumRat ) - PsyHFnTdbW( LSOutletAirDryBulbTemp, MinAirHumRat ) ) * CycRatio;
+					CalcMultiSpeedDXCoilCoolingMinAirHumRat = min( InletAirHumRat, LSOutletAirHumRat );
+					DXCoil( DXCoilNum ).SensCoolingEnergyRate = AirMassFlow * ( PsyHFnTdbW( InletAirDryBulbTemp, CalcMultiSpeedDXCoilCoolingMinAirHumRat ) - PsyHFnTdbW( LSOutletAirDryBulbTemp, CalcMultiSpeedDXCoilCoolingMinAirHumRat ) ) * CycRatio;
 					if ( DXCoil( DXCoilNum ).SensCoolingEnergyRate > DXCoil( DXCoilNum ).TotalCoolingEnergyRate ) {
 						DXCoil( DXCoilNum ).SensCoolingEnergyRate = DXCoil( DXCoilNum ).TotalCoolingEnergyRate;
 					}
 					DXCoil( DXCoilNum ).LatCoolingEnergyRate = DXCoil( DXCoilNum ).TotalCoolingEnergyRate - DXCoil( DXCoilNum ).SensCoolingEnergyRate;
 					// Calculate avarage outlet conditions
-					Hfg = PsyHfgAirFnWTdb( MinAirHumRat, OutletAirDryBulbTemp * CycRatio + ( 1.0 - CycRatio ) * InletAirDryBulbTemp );
+					Hfg = PsyHfgAirFnWTdb( CalcMultiSpeedDXCoilCoolingMinAirHumRat, OutletAirDryBulbTemp * CycRatio + ( 1.0 - CycRatio ) * InletAirDryBulbTemp );
 					OutletAirHumRat = InletAirHumRat - DXCoil( DXCoilNum ).LatCoolingEnergyRate / Hfg / DXCoil( DXCoilNum ).InletAirMassFlowRate;
 					OutletAirDryBulbTemp = PsyTdbFnHW( OutletAirEnthalpy, OutletAirHumRat );
 					if ( OutletAirDryBulbTemp < OutletAirDryBulbTempSat ) { // Limit to saturated conditions at OutletAirEnthalpy
 						OutletAirDryBulbTemp = OutletAirDryBulbTempSat;
 						OutletAirHumRat = PsyWFnTdbH( OutletAirDryBulbTemp, OutletAirEnthalpy, RoutineName );
-						MinAirHumRat = min( InletAirHumRat, OutletAirHumRat );
-						DXCoil( DXCoilNum ).SensCoolingEnergyRate = DXCoil( DXCoilNum ).InletAirMassFlowRate * ( PsyHFnTdbW( InletAirDryBulbTemp, MinAirHumRat ) - PsyHFnTdbW( OutletAirDryBulbTemp, MinAirHumRat ) );
+						CalcMultiSpeedDXCoilCoolingMinAirHumRat = min( InletAirHumRat, OutletAirHumRat );
+						DXCoil( DXCoilNum ).SensCoolingEnergyRate = DXCoil( DXCoilNum ).InletAirMassFlowRate * ( PsyHFnTdbW( InletAirDryBulbTemp, CalcMultiSpeedDXCoilCoolingMinAirHumRat ) - PsyHFnTdbW( OutletAirDryBulbTemp, CalcMultiSpeedDXCoilCoolingMinAirHumRat ) );
 						if ( DXCoil( DXCoilNum ).SensCoolingEnergyRate > DXCoil( DXCoilNum ).TotalCoolingEnergyRate ) {
 							DXCoil( DXCoilNum ).SensCoolingEnergyRate = DXCoil( DXCoilNum ).TotalCoolingEnergyRate;
 						}
 						DXCoil( DXCoilNum ).LatCoolingEnergyRate = DXCoil( DXCoilNum ).TotalCoolingEnergyRate - DXCoil( DXCoilNum ).SensCoolingEnergyRate;
 					}
 				} else {
-					MinAirHumRat = min( InletAirHumRat, OutletAirHumRat );
-					DXCoil( DXCoilNum ).SensCoolingEnergyRate = AirMassFlow * ( PsyHFnTdbW( InletAirDryBulbTemp, MinAirHumRat ) - PsyHFnTdbW( LSOutletAirDryBulbTemp, MinAirHumRat ) ) * CycRatio;
+					CalcMultiSpeedDXCoilCoolingMinAirHumRat = min( InletAirHumRat, OutletAirHumRat );
+					DXCoil( DXCoilNum ).SensCoolingEnergyRate = AirMassFlow * ( PsyHFnTdbW( InletAirDryBulbTemp, CalcMultiSpeedDXCoilCoolingMinAirHumRat ) - PsyHFnTdbW( LSOutletAirDryBulbTemp, CalcMultiSpeedDXCoilCoolingMinAirHumRat ) ) * CycRatio;
 					// Don't let sensible capacity be greater than total capacity
 					if ( DXCoil( DXCoilNum ).SensCoolingEnergyRate > DXCoil( DXCoilNum ).TotalCoolingEnergyRate ) {
 						DXCoil( DXCoilNum ).SensCoolingEnergyRate = DXCoil( DXCoilNum ).TotalCoolingEnergyRate;
@@ -12101,13 +12182,6 @@ Label50: ;
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static std::string const RoutineName( "CalcTwoSpeedDXCoilStandardRating" );
 
-		static Real64 NetCoolingCapRated( 0.0 ); // Net Cooling Coil capacity at Rated conditions, accounting for supply fan heat [W]
-		static Real64 EER( 0.0 ); // Energy Efficiency Ratio in SI [W/W]
-		static Real64 IEER( 0.0 ); // Integerated Energy Efficiency Ratio in SI [W/W]
-		static Real64 TotCapTempModFac( 0.0 ); // Total capacity modifier (function of entering wetbulb, outside drybulb) [-]
-		static Real64 TotCapFlowModFac( 0.0 ); // Total capacity modifier (function of actual supply air flow vs rated flow) [-]
-		static Real64 EIRTempModFac( 0.0 ); // EIR modifier (function of entering wetbulb, outside drybulb) [-]
-		static Real64 EIRFlowModFac( 0.0 ); // EIR modifier (function of actual supply air flow vs rated flow) [-]
 		Real64 EIR;
 		Real64 TotalElecPowerRated;
 		Array1D< Real64 > EER_TestPoint_SI( 4 ); // 1 = A, 2 = B, 3= C, 4= D
@@ -12116,15 +12190,12 @@ Label50: ;
 		Array1D< Real64 > NetPower_TestPoint( 4 ); // 1 = A, 2 = B, 3= C, 4= D
 		Array1D< Real64 > SupAirMdot_TestPoint( 4 ); // 1 = A, 2 = B, 3= C, 4= D
 
-		static Real64 TempDryBulb_Leaving_Apoint( 0.0 );
 
 		Real64 HighSpeedNetCoolingCap;
 		Real64 LowSpeedNetCoolingCap;
 
 		Real64 PartLoadAirMassFlowRate;
 		Real64 AirMassFlowRatio;
-		static Real64 AccuracyTolerance( 0.2 ); // tolerance in AHRI 340/360 Table 6 note 1
-		static int MaximumIterations( 500 );
 		int SolverFlag;
 		Array1D< Real64 > Par( 12 ); // Parameter array passed to solver
 		Real64 EIR_HighSpeed;
@@ -12134,7 +12205,6 @@ Label50: ;
 		int Iter;
 		Real64 ExternalStatic;
 		Real64 FanStaticPressureRise;
-		static bool ErrorsFound( false );
 		Real64 FanHeatCorrection;
 		Real64 FanPowerCorrection;
 		Real64 FanPowerPerEvapAirFlowRate;
@@ -12151,7 +12221,6 @@ Label50: ;
 		Real64 PLF;
 		Real64 RunTimeFraction;
 		Real64 LowerBoundMassFlowRate;
-		static bool OneTimeEIOHeaderWrite( true );
 		int PartLoadTestPoint;
 		int countStaticInputs;
 		int index;
@@ -12199,8 +12268,8 @@ Label50: ;
 				}
 				FanStaticPressureRise = ExternalStatic + DXCoil( DXCoilNum ).InternalStaticPressureDrop;
 
-				FanInletNode = GetFanInletNode( "FAN:VARIABLEVOLUME", DXCoil( DXCoilNum ).SupplyFanName, ErrorsFound );
-				FanOutletNode = GetFanOutletNode( "FAN:VARIABLEVOLUME", DXCoil( DXCoilNum ).SupplyFanName, ErrorsFound );
+				FanInletNode = GetFanInletNode( "FAN:VARIABLEVOLUME", DXCoil( DXCoilNum ).SupplyFanName, CalcTwoSpeedDXCoilStandardRatingErrorsFound );
+				FanOutletNode = GetFanOutletNode( "FAN:VARIABLEVOLUME", DXCoil( DXCoilNum ).SupplyFanName, CalcTwoSpeedDXCoilStandardRatingErrorsFound );
 				// set node state variables in preparation for fan model.
 				Node( FanInletNode ).MassFlowRate = DXCoil( DXCoilNum ).RatedAirMassFlowRate( 1 );
 				Node( FanOutletNode ).MassFlowRate = DXCoil( DXCoilNum ).RatedAirMassFlowRate( 1 );
@@ -12298,7 +12367,7 @@ Label50: ;
 
 			LowerBoundMassFlowRate = 0.01 * DXCoil( DXCoilNum ).RatedAirMassFlowRate( 1 );
 
-			SolveRegulaFalsi( AccuracyTolerance, MaximumIterations, SolverFlag, PartLoadAirMassFlowRate, CalcTwoSpeedDXCoilIEERResidual, LowerBoundMassFlowRate, DXCoil( DXCoilNum ).RatedAirMassFlowRate( 1 ), Par );
+			SolveRegulaFalsi( AccuracyTolerance, MaximumIterations, SolverFlag, PartLoadAirMassFlowRate, CalcTwoSpeedDXCoilIEERResidual, LowerBoundMassFlowRate, DXCoil( DXCoilNum ).RatedAirMassFlowRate( 1 ), Par, "CalcTwoSpeedDXCoilStandardRating" );
 
 			if ( SolverFlag == -1 ) {
 
@@ -12532,7 +12601,6 @@ Label50: ;
 		int AirSysNum;
 		int BranchNum;
 		int CompNum;
-		static bool ErrorsFound( false );
 
 		FoundBranch = 0;
 		FoundAirSysNum = 0;
@@ -12563,7 +12631,7 @@ Label50: ;
 					for ( CompNum = 1; CompNum <= PrimaryAirSystem( FoundAirSysNum ).Branch( FoundBranch ).TotalComponents; ++CompNum ) {
 						if ( PrimaryAirSystem( FoundAirSysNum ).Branch( FoundBranch ).Comp( CompNum ).CompType_Num == Fan_Simple_VAV ) {
 							SupplyFanName = PrimaryAirSystem( FoundAirSysNum ).Branch( FoundBranch ).Comp( CompNum ).Name;
-							GetFanIndex( SupplyFanName, SupplyFanIndex, ErrorsFound );
+							GetFanIndex( SupplyFanName, SupplyFanIndex, GetFanIndexForTwoSpeedCoilErrorsFound );
 							break;
 							// these are specified in SimAirServingZones and need to be moved to a Data* file. UnitarySystem=19
 						} else if ( PrimaryAirSystem( FoundAirSysNum ).Branch( FoundBranch ).Comp( CompNum ).CompType_Num == UnitarySystem ) {
@@ -14589,7 +14657,6 @@ Label50: ;
 		Real64 CondAirMassFlow; // Condenser air mass flow rate [kg/s]
 		Real64 RhoAir; // Density of air [kg/m3]
 		Real64 CrankcaseHeatingPower; // power due to crankcase heater
-		static Real64 CompAmbTemp( 0.0 ); // Ambient temperature at compressor
 		Real64 AirFlowRatio; // ratio of compressor on airflow to average timestep airflow
 		// used when constant fan mode yields different air flow rates when compressor is ON and OFF
 		// (e.g. Packaged Terminal Heat Pump)
@@ -14600,8 +14667,6 @@ Label50: ;
 		Real64 tADP; // Apparatus dew point temperature [C]
 		Real64 wADP; // Apparatus dew point humidity ratio [kg/kg]
 
-		static Real64 CurrentEndTime( 0.0 ); // end time of time step for current simulation time step
-		static Real64 MinAirHumRat( 0.0 ); // minimum of the inlet air humidity ratio and the outlet air humidity ratio
 		int Mode; // Performance mode for Multimode DX coil; Always 1 for other coil types
 		Real64 OutletAirTemp; // Supply air temperature (average value if constant fan, full output if cycling fan)
 		Real64 OutletAirHumRat; // Supply air humidity ratio (average value if constant fan, full output if cycling fan)
@@ -14675,26 +14740,26 @@ Label50: ;
 			// (Outdoor wet-bulb temp from DataEnvironment) + (1.0-EvapCondEffectiveness) * (drybulb - wetbulb)
 			CondInletTemp = OutdoorWetBulb + ( OutdoorDryBulb - OutdoorWetBulb ) * ( 1.0 - DXCoil( DXCoilNum ).EvapCondEffect( Mode ) );
 			CondInletHumRat = PsyWFnTdbTwbPb( CondInletTemp, OutdoorWetBulb, OutdoorPressure );
-			CompAmbTemp = OutdoorDryBulb;
+			CalcVRFCoolingCoil_FluidTCtrlCompAmbTemp = OutdoorDryBulb;
 		} else { // for air or water-cooled, inlet temp is stored in OutdoorDryBulb temp
 			CondInletTemp = OutdoorDryBulb; // Outdoor dry-bulb temp or water inlet temp
 			if ( DXCoil( DXCoilNum ).CondenserType( Mode ) == WaterCooled ) {
-				CompAmbTemp = OutDryBulbTemp; // for crankcase heater use actual outdoor temp for water-cooled
+				CalcVRFCoolingCoil_FluidTCtrlCompAmbTemp = OutDryBulbTemp; // for crankcase heater use actual outdoor temp for water-cooled
 			} else {
-				CompAmbTemp = OutdoorDryBulb;
+				CalcVRFCoolingCoil_FluidTCtrlCompAmbTemp = OutdoorDryBulb;
 			}
 		}
 
 		// Initialize crankcase heater, operates below OAT defined in input deck for HP DX cooling coil
 		// If used in a heat pump, the value of MaxOAT in the heating coil overrides that in the cooling coil (in GetInput)
-		if ( CompAmbTemp < DXCoil( DXCoilNum ).MaxOATCrankcaseHeater ) {
+		if ( CalcVRFCoolingCoil_FluidTCtrlCompAmbTemp < DXCoil( DXCoilNum ).MaxOATCrankcaseHeater ) {
 			CrankcaseHeatingPower = DXCoil( DXCoilNum ).CrankcaseHeaterCapacity;
 		} else {
 			CrankcaseHeatingPower = 0.0;
 		}
 
 		// calculate end time of current time step to determine if error messages should be printed
-		CurrentEndTime = CurrentTime + SysTimeElapsed;
+		CalcVRFCoolingCoil_FluidTCtrlCurrentEndTime = CurrentTime + SysTimeElapsed;
 
 		// The following checks are not necessary for VRF-FluidTCtrl model. (1) OAT check is already performed in the VRF OU routines (2) VRF-FluidTCtrl
 		// model is physics based, not system curve based, and thus doesn't require special performance curves for operations at low inlet temperatures (zrp_Jul2016)
@@ -14725,7 +14790,7 @@ Label50: ;
 		// }
 
 		if ( DXCoil( DXCoilNum ).PrintLowOutTempMessage ) {
-			if ( CurrentEndTime > DXCoil( DXCoilNum ).CurrentEndTimeLast && TimeStepSys >= DXCoil( DXCoilNum ).TimeStepSysLast ) {
+			if ( CalcVRFCoolingCoil_FluidTCtrlCurrentEndTime > DXCoil( DXCoilNum ).CurrentEndTimeLast && TimeStepSys >= DXCoil( DXCoilNum ).TimeStepSysLast ) {
 				if ( DXCoil( DXCoilNum ).LowOutletTempIndex == 0 ) {
 					ShowWarningMessage( DXCoil( DXCoilNum ).LowOutTempBuffer1 );
 					ShowContinueError( DXCoil( DXCoilNum ).LowOutTempBuffer2 );
@@ -14740,7 +14805,7 @@ Label50: ;
 
 		// save last system time step and last end time of current time step (used to determine if warning is valid)
 		DXCoil( DXCoilNum ).TimeStepSysLast = TimeStepSys;
-		DXCoil( DXCoilNum ).CurrentEndTimeLast = CurrentEndTime;
+		DXCoil( DXCoilNum ).CurrentEndTimeLast = CalcVRFCoolingCoil_FluidTCtrlCurrentEndTime;
 		DXCoil( DXCoilNum ).PrintLowAmbMessage = false;
 		DXCoil( DXCoilNum ).PrintLowOutTempMessage = false;
 
@@ -14885,7 +14950,7 @@ Label50: ;
 			DXCoil( DXCoilNum ).TotalCoolingEnergyRate = AirMassFlow * ( InletAirEnthalpy - OutletAirEnthalpy );
 
 			// Coil sensible cooling
-			MinAirHumRat = min( InletAirHumRat, OutletAirHumRat );
+			CalcVRFCoolingCoil_FluidTCtrlMinAirHumRat = min( InletAirHumRat, OutletAirHumRat );
 			DXCoil( DXCoilNum ).SensCoolingEnergyRate = AirMassFlow * 1005.0 * ( InletAirDryBulbTemp - OutletAirTemp );
 			//  Don't let sensible capacity be greater than total capacity
 			if ( DXCoil( DXCoilNum ).SensCoolingEnergyRate > DXCoil( DXCoilNum ).TotalCoolingEnergyRate ) {
@@ -15024,7 +15089,6 @@ Label50: ;
 		Real64 OutdoorWetBulb; // Outdoor wet-bulb temperature at condenser (C)
 		Real64 OutdoorHumRat; // Outdoor humidity ratio at condenser (kg/kg)
 		Real64 OutdoorPressure; // Outdoor barometric pressure at condenser (Pa)
-		static int Mode( 1 ); // Performance mode for MultiMode DX coil. Always 1 for other coil types
 		Real64 AirFlowRatio; // Ratio of compressor on airflow to average timestep airflow
 		Real64 OutletAirTemp; // Supply air temperature (average value if constant fan, full output if cycling fan)
 		Real64 OutletAirHumRat; // Supply air humidity ratio (average value if constant fan, full output if cycling fan)
@@ -15069,7 +15133,7 @@ Label50: ;
 			( GetCurrentScheduleValue( DXCoil( DXCoilNum ).SchedPtr ) > 0.0 ) &&
 			( PartLoadRatio > 0.0 ) && ( OutdoorDryBulb > DXCoil( DXCoilNum ).MinOATCompressor ) ) {
 
-			TotCap = DXCoil( DXCoilNum ).RatedTotCap( Mode );
+			TotCap = DXCoil( DXCoilNum ).RatedTotCap( CalcVRFHeatingCoil_FluidTCtrlMode );
 			QCoilReq = PartLoadRatio * TotCap;
 			if( PartLoadRatio == 0.0 ){
 				AirMassFlowMin = OACompOffMassFlow;
@@ -15079,17 +15143,17 @@ Label50: ;
 
 			// Call ControlVRFIUCoil to calculate: (1) FanSpdRatio, (2) coil inlet/outlet conditions, and (3) SH/SC
 			ControlVRFIUCoil( DXCoilNum, QCoilReq, DXCoil( DXCoilNum ).InletAirTemp, DXCoil( DXCoilNum ).InletAirHumRat, DXCoil( DXCoilNum ).CondensingTemp, AirMassFlowMin, FanSpdRatio, OutletAirHumRat, OutletAirTemp, OutletAirEnthalpy, ActualSH, ActualSC );
-			AirMassFlow = FanSpdRatio * DXCoil( DXCoilNum ).RatedAirMassFlowRate( Mode );
+			AirMassFlow = FanSpdRatio * DXCoil( DXCoilNum ).RatedAirMassFlowRate( CalcVRFHeatingCoil_FluidTCtrlMode );
 
 
 			AirVolumeFlowRate = AirMassFlow / PsyRhoAirFnPbTdbW( OutdoorPressure, InletAirDryBulbTemp, InletAirHumRat );
 			// Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
-			VolFlowperRatedTotCap = AirVolumeFlowRate / DXCoil( DXCoilNum ).RatedTotCap( Mode );
+			VolFlowperRatedTotCap = AirVolumeFlowRate / DXCoil( DXCoilNum ).RatedTotCap( CalcVRFHeatingCoil_FluidTCtrlMode );
 			// VolFlowperRatedTotCap was checked at the initialization step
 			// No need to check VolFlowperRatedTotCap at the simulation
 			// New VRF_FluidTCtrl model implements VAV fan which can vary air flow rate during simulation
 
-			AirMassFlowRatio = AirMassFlow / DXCoil( DXCoilNum ).RatedAirMassFlowRate( Mode );
+			AirMassFlowRatio = AirMassFlow / DXCoil( DXCoilNum ).RatedAirMassFlowRate( CalcVRFHeatingCoil_FluidTCtrlMode );
 
 			// Calculating adjustment factors for defrost
 			// Calculate delta w through outdoor coil by assuming a coil temp of 0.82*DBT-9.7(F) per DOE2.1E
@@ -15131,23 +15195,23 @@ Label50: ;
 			// advised to use the bi-quaratic curve if sufficient manufacturer data is available.
 			if ( DXCoil( DXCoilNum ).DXCoilType_Num != CoilVRF_Heating && DXCoil( DXCoilNum ).DXCoilType_Num != CoilVRF_FluidTCtrl_Heating ) {
 				if ( ( DXCoil( DXCoilNum ).EIRTempModFacCurveType( 1 ) == Quadratic ) || ( DXCoil( DXCoilNum ).EIRTempModFacCurveType( 1 ) == Cubic ) ) {
-					EIRTempModFac = CurveValue( DXCoil( DXCoilNum ).EIRFTemp( Mode ), OutdoorDryBulb );
+					EIRTempModFac = CurveValue( DXCoil( DXCoilNum ).EIRFTemp( CalcVRFHeatingCoil_FluidTCtrlMode ), OutdoorDryBulb );
 				} else if ( DXCoil( DXCoilNum ).EIRTempModFacCurveType( 1 ) == BiQuadratic ) {
-					EIRTempModFac = CurveValue( DXCoil( DXCoilNum ).EIRFTemp( Mode ), InletAirDryBulbTemp, OutdoorDryBulb );
+					EIRTempModFac = CurveValue( DXCoil( DXCoilNum ).EIRFTemp( CalcVRFHeatingCoil_FluidTCtrlMode ), InletAirDryBulbTemp, OutdoorDryBulb );
 				} else {
 					assert( false );
 				}
-				EIRFlowModFac = CurveValue( DXCoil( DXCoilNum ).EIRFFlow( Mode ), AirMassFlowRatio );
+				EIRFlowModFac = CurveValue( DXCoil( DXCoilNum ).EIRFFlow( CalcVRFHeatingCoil_FluidTCtrlMode ), AirMassFlowRatio );
 			} else {
 				EIRTempModFac = 1.0;
 				EIRFlowModFac = 1.0;
 			}
-			EIR = DXCoil( DXCoilNum ).RatedEIR( Mode ) * EIRTempModFac * EIRFlowModFac;
+			EIR = DXCoil( DXCoilNum ).RatedEIR( CalcVRFHeatingCoil_FluidTCtrlMode ) * EIRTempModFac * EIRFlowModFac;
 
 			// Calculate PLRHeating: modified PartLoadRatio due to defrost ( reverse-cycle defrost only )
 			PLRHeating = min( 1.0, ( PartLoadRatio + LoadDueToDefrost / TotCap ) );
 			if ( DXCoil( DXCoilNum ).DXCoilType_Num != CoilVRF_Heating && DXCoil( DXCoilNum ).DXCoilType_Num != CoilVRF_FluidTCtrl_Heating ) {
-				PLF = CurveValue( DXCoil( DXCoilNum ).PLFFPLR( Mode ), PLRHeating ); // Calculate part-load factor
+				PLF = CurveValue( DXCoil( DXCoilNum ).PLFFPLR( CalcVRFHeatingCoil_FluidTCtrlMode ), PLRHeating ); // Calculate part-load factor
 			} else {
 				PLF = 1.0;
 			}
@@ -15367,7 +15431,7 @@ Label50: ;
 				Par( 5 ) = BF;
 
 				FanSpdRatioMax = 1.0;
-				SolveRegulaFalsi( 1.0e-3, MaxIter, SolFla, Ratio1, FanSpdResidualCool, FanSpdRatioMin, FanSpdRatioMax, Par );
+				SolveRegulaFalsi( 1.0e-3, MaxIter, SolFla, Ratio1, FanSpdResidualCool, FanSpdRatioMin, FanSpdRatioMax, Par, "ControlVRFIUCoil" );
 				if ( SolFla < 0 ) Ratio1 = FanSpdRatioMax; // over capacity
 				FanSpdRatio = Ratio1;
 				CoilOnOffRatio = 1.0;
@@ -15468,7 +15532,7 @@ Label50: ;
 				Par( 5 ) = BF;
 
 				FanSpdRatioMax = 1.0;
-				SolveRegulaFalsi( 1.0e-3, MaxIter, SolFla, Ratio1, FanSpdResidualHeat, FanSpdRatioMin, FanSpdRatioMax, Par );
+				SolveRegulaFalsi( 1.0e-3, MaxIter, SolFla, Ratio1, FanSpdResidualHeat, FanSpdRatioMin, FanSpdRatioMax, Par, "ControlVRFIUCoil" );
 				// this will likely cause problems eventually, -1 and -2 mean different things
 				if ( SolFla < 0 ) Ratio1 = FanSpdRatioMax; // over capacity
 				FanSpdRatio = Ratio1;
@@ -15871,6 +15935,155 @@ Label50: ;
 
 	}
 
+	std::int64_t
+	QuantizeCoilPerfMemo(
+		Real64 const Value, // value of an input of a memoized calculation
+		Real64 const Quantum // resolution at which two inputs are considered equal
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Rounds an input of a memoized coil calculation to a multiple of its quantum so that
+		// inputs differing only by round-off in the parent's PLR search map to the same key.
+
+		return static_cast< std::int64_t >( std::llround( Value / Quantum ) );
+
+	}
+
+	bool
+	FindCoilPerfMemo(
+		int const MemoNum, // index of the memoized calculation
+		CoilPerfMemoKey const & Key, // quantized inputs of the calculation
+		CoilPerfMemoValues & Values // results of the calculation, if found
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Looks up the results of a coil performance calculation with the same quantized inputs
+		// performed earlier in the current system time step.
+
+		// METHODOLOGY EMPLOYED:
+		// Results are only valid within one system time step. The memo is emptied the first time it
+		// is used in a new time step, so that curve overrides and schedules changing between time steps
+		// are always seen. A miss is counted here; the caller is expected to store its results.
+
+		// Using/Aliasing
+		using DataEnvironment::CurEnvirNum;
+		using DataGlobals::CurrentTime;
+		using DataGlobals::DayOfSim;
+		using DataHVACGlobals::SysTimeElapsed;
+
+		if ( ! allocated( CoilPerfMemo ) ) CoilPerfMemo.allocate( NumCoilPerfMemos );
+
+		auto & Memo( CoilPerfMemo( MemoNum ) );
+		Real64 const EndTime( CurrentTime + SysTimeElapsed );
+		if ( Memo.EnvrnNum != CurEnvirNum || Memo.DayNum != DayOfSim || Memo.EndTime != EndTime ) {
+			Memo.MaxResults = max( Memo.MaxResults, int( Memo.Results.size() ) );
+			Memo.Results.clear();
+			Memo.EnvrnNum = CurEnvirNum;
+			Memo.DayNum = DayOfSim;
+			Memo.EndTime = EndTime;
+		}
+
+		auto const found( Memo.Results.find( Key ) );
+		if ( found == Memo.Results.end() ) {
+			++Memo.NumMisses;
+			return false;
+		}
+		++Memo.NumHits;
+		Values = found->second;
+		return true;
+
+	}
+
+	void
+	StoreCoilPerfMemo(
+		int const MemoNum, // index of the memoized calculation
+		CoilPerfMemoKey const & Key, // quantized inputs of the calculation
+		CoilPerfMemoValues const & Values // results of the calculation
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Stores the results of a coil performance calculation after a miss in FindCoilPerfMemo.
+
+		if ( ! allocated( CoilPerfMemo ) ) CoilPerfMemo.allocate( NumCoilPerfMemos );
+
+		CoilPerfMemo( MemoNum ).Results[ Key ] = Values;
+
+	}
+
+	void
+	DumpCoilPerfMemoStatistics()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the hit and miss counts of the memoized coil performance calculations
+		// to a CSV file named "statistics.DXCoilMemo.csv".
+
+		// Using/Aliasing
+		using DataSystemVariables::MemoizeDXCoilEnvFlag;
+		using General::TrimSigDigits;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt fmtA( "(A)" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int FileUnit;
+		Real64 HitRate; // fraction of the calculations answered from the memo
+
+		if ( ! MemoizeDXCoilEnvFlag || ! allocated( CoilPerfMemo ) ) return;
+
+		std::string StatisticsFileName = "statistics.DXCoilMemo.csv";
+
+		FileUnit = GetNewUnitNumber();
+
+		if ( FileUnit <= 0 ) {
+			ShowWarningError( "DumpCoilPerfMemoStatistics: Invalid unit for DX coil memo statistics file=\"" + StatisticsFileName + "\"" );
+			return;
+		}
+
+		{ IOFlags flags; flags.ACTION( "write" ); gio::open( FileUnit, StatisticsFileName, flags ); if ( flags.err() ) ShowFatalError( "DumpCoilPerfMemoStatistics: Failed to open statistics file \"" + StatisticsFileName + "\" for output (write)." ); }
+
+		gio::write( FileUnit, fmtA ) << "Calculation,NumHits,NumMisses,HitRate,MaxResultsPerTimeStep";
+		for ( int MemoNum = 1; MemoNum <= NumCoilPerfMemos; ++MemoNum ) {
+			auto const & Memo( CoilPerfMemo( MemoNum ) );
+			if ( Memo.NumHits + Memo.NumMisses > 0 ) {
+				HitRate = double( Memo.NumHits ) / double( Memo.NumHits + Memo.NumMisses );
+			} else {
+				HitRate = 0.0;
+			}
+			gio::write( FileUnit, fmtA ) << cCoilPerfMemoNames( MemoNum ) + ',' + std::to_string( Memo.NumHits ) + ',' + std::to_string( Memo.NumMisses ) + ',' + TrimSigDigits( HitRate, 4 ) + ',' + TrimSigDigits( max( Memo.MaxResults, int( Memo.Results.size() ) ) );
+		}
+
+		gio::close( FileUnit );
+
+	}
+
 	// Clears the global data in DXCoils.
 	// Needed for unit tests, should not be normally called.
 	void
@@ -15909,7 +16122,50 @@ Label50: ;
 		DXCoilHeatInletAirDBTemp.deallocate();
 		DXCoilHeatInletAirWBTemp.deallocate();
 		CheckEquipName.deallocate();
-
+		CoilPerfMemo.deallocate();
+
+		S1RuntimeFraction = 0.0;
+		S12RuntimeFraction = 0.0;
+		MinAirHumRat = 0.0;
+		GetDXCoilsErrorsFound = false;
+		MaxNumbers = 0;
+		MaxAlphas = 0;
+		TotalArgs = 0;
+		SmallDifferenceTest = 0.00000001;
+		MyEnvrnFlag.deallocate();
+		MySizeFlag.deallocate();
+		CrankcaseHeaterReportVarFlag = true;
+		InitDXCoilErrorsFound = false;
+		CompAmbTemp = 0.0;
+		CurrentEndTime = 0.0;
+		CalcDoe2DXCoilMinAirHumRat = 0.0;
+		CalcVRFCoolingCoilCompAmbTemp = 0.0;
+		CalcVRFCoolingCoilCurrentEndTime = 0.0;
+		CalcVRFCoolingCoilMinAirHumRat = 0.0;
+		CalcDXHeatingCoilMode = 1;
+		CalcMultiSpeedDXCoilMinAirHumRat = 0.0;
+		CalcMultiSpeedDXCoilMode = 1;
+		CalcCBFSmallDifferenceTest = 0.00000001;
+		CBFErrors = false;
+		CalcMultiSpeedDXCoilCoolingMinAirHumRat = 0.0;
+		DXMode = 1;
+		NetCoolingCapRated = 0.0;
+		EER = 0.0;
+		IEER = 0.0;
+		TotCapTempModFac = 0.0;
+		TotCapFlowModFac = 0.0;
+		EIRTempModFac = 0.0;
+		EIRFlowModFac = 0.0;
+		TempDryBulb_Leaving_Apoint = 0.0;
+		AccuracyTolerance = 0.2;
+		MaximumIterations = 500;
+		CalcTwoSpeedDXCoilStandardRatingErrorsFound = false;
+		OneTimeEIOHeaderWrite = true;
+		GetFanIndexForTwoSpeedCoilErrorsFound = false;
+		CalcVRFCoolingCoil_FluidTCtrlCompAmbTemp = 0.0;
+		CalcVRFCoolingCoil_FluidTCtrlCurrentEndTime = 0.0;
+		CalcVRFCoolingCoil_FluidTCtrlMinAirHumRat = 0.0;
+		CalcVRFHeatingCoil_FluidTCtrlMode = 1;
 	}
 
 } // DXCoils
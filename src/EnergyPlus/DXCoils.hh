@@ -59,6 +59,11 @@
 #ifndef DXCoils_hh_INCLUDED
 #define DXCoils_hh_INCLUDED
 
+// C++ Headers
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Optional.hh>
@@ -133,6 +138,25 @@ namespace DXCoils {
 	extern int const FuelTypeOtherFuel1; // Fuel type for other fuel #1
 	extern int const FuelTypeOtherFuel2; // Fuel type for other fuel #2
 
+	// Memoized coil performance calculations (only used when the DXCOIL_MEMO environment variable is set)
+	extern int const Doe2FullLoadMemo; // full load capacity and SHR of CalcDoe2DXCoil
+	extern int const TotCapSHRMemo; // CalcTotCapSHR
+	extern int const VarSpeedTotCapSHRMemo; // VariableSpeedCoils::CalcTotCapSHR_VSWSHP
+	extern int const NumCoilPerfMemos;
+	extern Array1D_string const cCoilPerfMemoNames;
+
+	// Resolution of the memoized inputs, well below the accuracy of the performance curves
+	extern Real64 const MemoTempQuantum; // [C]
+	extern Real64 const MemoHumRatQuantum; // [kgWater/kgDryAir]
+	extern Real64 const MemoEnthalpyQuantum; // [J/kg]
+	extern Real64 const MemoPressureQuantum; // [Pa]
+	extern Real64 const MemoMassFlowQuantum; // [kg/s]
+	extern Real64 const MemoRatioQuantum; // [-] flow ratios, bypass factors and speed ratios
+	extern Real64 const MemoCapacityQuantum; // [W]
+
+	std::size_t const MaxCoilPerfMemoKeys( 20 ); // Maximum number of quantized inputs of a memoized calculation
+	std::size_t const MaxCoilPerfMemoValues( 6 ); // Maximum number of results of a memoized calculation
+
 	// DERIVED TYPE DEFINITIONS
 
 	// MODULE VARIABLE DECLARATIONS:
@@ -788,9 +812,49 @@ namespace DXCoils {
 
 	};
 
+	typedef std::array< std::int64_t, MaxCoilPerfMemoKeys > CoilPerfMemoKey;
+	typedef std::array< Real64, MaxCoilPerfMemoValues > CoilPerfMemoValues;
+
+	struct CoilPerfMemoKeyHash
+	{
+		std::size_t
+		operator ()( CoilPerfMemoKey const & Key ) const
+		{
+			std::size_t Hash( 0u );
+			for ( auto const Quantized : Key ) {
+				Hash ^= std::hash< std::int64_t >()( Quantized ) + 0x9e3779b9u + ( Hash << 6 ) + ( Hash >> 2 );
+			}
+			return Hash;
+		}
+	};
+
+	struct CoilPerfMemoData
+	{
+		// Members
+		std::unordered_map< CoilPerfMemoKey, CoilPerfMemoValues, CoilPerfMemoKeyHash > Results; // Results of the current time step
+		int EnvrnNum; // Environment of the time step the results belong to
+		int DayNum; // Day of simulation of the time step the results belong to
+		Real64 EndTime; // End time of the system time step the results belong to [hr]
+		std::int64_t NumHits; // Number of calculations answered from the memo
+		std::int64_t NumMisses; // Number of calculations performed and stored in the memo
+		int MaxResults; // Largest number of results held for one time step
+
+		// Default Constructor
+		CoilPerfMemoData() :
+			EnvrnNum( 0 ),
+			DayNum( 0 ),
+			EndTime( 0.0 ),
+			NumHits( 0 ),
+			NumMisses( 0 ),
+			MaxResults( 0 )
+		{}
+
+	};
+
 	// Object Data
 	extern Array1D< DXCoilData > DXCoil;
 	extern Array1D< DXCoilNumericFieldData > DXCoilNumericFields;
+	extern Array1D< CoilPerfMemoData > CoilPerfMemo;
 
 	// Functions
 
@@ -1256,6 +1320,29 @@ namespace DXCoils {
 	void
 	SetMSHPDXCoilHeatRecoveryFlag( int const DXCoilNum ); // must match coil names for the coil type
 
+	std::int64_t
+	QuantizeCoilPerfMemo(
+		Real64 const Value, // value of an input of a memoized calculation
+		Real64 const Quantum // resolution at which two inputs are considered equal
+	);
+
+	bool
+	FindCoilPerfMemo(
+		int const MemoNum, // index of the memoized calculation
+		CoilPerfMemoKey const & Key, // quantized inputs of the calculation
+		CoilPerfMemoValues & Values // results of the calculation, if found
+	);
+
+	void
+	StoreCoilPerfMemo(
+		int const MemoNum, // index of the memoized calculation
+		CoilPerfMemoKey const & Key, // quantized inputs of the calculation
+		CoilPerfMemoValues const & Values // results of the calculation
+	);
+
+	void
+	DumpCoilPerfMemoStatistics();
+
 	// Clears the global data in DXCoils.
 	// Needed for unit tests, should not be normally called.
 	void
@@ -118,8 +118,26 @@ namespace DXFEarClipping {
 
 	// rest of routines are private.
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int errcount( 0 );
+	}
+
 	// Functions
 
+	// Clears the global data in DXFEarClipping.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		trackit = false;
+		errcount = 0;
+	}
+
 	bool
 	InPolygon(
 		Vector const & point,
@@ -291,7 +309,6 @@ namespace DXFEarClipping {
 		//unused  double precision :: ang
 		//unused  double precision :: val
 		std::string line;
-		static int errcount( 0 );
 
 		// Object Data
 		Array1D< Vector_2d > vertex( nsides );
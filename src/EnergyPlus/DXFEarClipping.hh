@@ -87,6 +87,11 @@ namespace DXFEarClipping {
 
 	// Functions
 
+	// Clears the global data in DXFEarClipping.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	bool
 	InPolygon(
 		Vector const & point,
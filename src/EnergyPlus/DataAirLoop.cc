@@ -58,6 +58,7 @@
 
 // EnergyPlus Headers
 #include <DataAirLoop.hh>
+#include <DataConvergParams.hh>
 #include <DataPrecisionGlobals.hh>
 
 namespace EnergyPlus {
@@ -140,6 +141,76 @@ namespace DataAirLoop {
 		OutsideAirSys.deallocate();
 	}
 
+	void
+	RequestAirLoopSim(
+		int const AirLoopNum,
+		bool & SimAir // TRUE means all air loops must be (re)simulated
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Requests another simulation of the specified air loop within the current HVAC iteration.
+
+		// METHODOLOGY EMPLOYED:
+		// When only the changed air loops are resimulated (ConvergenceLimits), only the air loop is
+		// flagged and SimAir is left unchanged since SimAir triggers a simulation of all air loops.
+
+		// Using/Aliasing
+		using DataConvergParams::ResimChangedAirLoopsOnly;
+
+		if ( ResimChangedAirLoopsOnly ) {
+			AirLoopControlInfo( AirLoopNum ).SimLoopNeeded = true;
+		} else {
+			SimAir = true;
+		}
+
+	}
+
+	bool
+	AnyAirLoopsNeedSim()
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns TRUE if any air loop has been flagged by RequestAirLoopSim() and not simulated since.
+
+		for ( auto const & e : AirLoopControlInfo ) {
+			if ( e.SimLoopNeeded ) return true;
+		}
+		return false;
+
+	}
+
+	void
+	SetAllAirLoopSimFlags( bool const Value )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets the simulation flag of all air loops to the given value.
+
+		for ( auto & e : AirLoopControlInfo ) {
+			e.SimLoopNeeded = Value;
+		}
+
+	}
+
 } // DataAirLoop
 
 } // EnergyPlus
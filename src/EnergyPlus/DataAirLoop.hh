@@ -221,6 +221,7 @@ namespace DataAirLoop {
 		bool OASysComponentsSimulated; // - true after OA components have been simulated
 		bool AirLoopDCVFlag; // TRUE if the air loop has OA Controller specifying a Mechanical controller with DCV
 		// - internal flag only
+		bool SimLoopNeeded; // TRUE if the inputs of this air loop changed since it was last simulated
 
 		// Default Constructor
 		AirLoopControlData() :
@@ -254,7 +255,8 @@ namespace DataAirLoop {
 			CoolingActiveFlag( false ),
 			HeatingActiveFlag( false ),
 			OASysComponentsSimulated( false ),
-			AirLoopDCVFlag( true )
+			AirLoopDCVFlag( true ),
+			SimLoopNeeded( true )
 		{}
 
 	};
@@ -343,11 +345,25 @@ namespace DataAirLoop {
 	extern Array1D< AirLoopFlowData > AirLoopFlow;
 	extern Array1D< OutsideAirSysProps > OutsideAirSys;
 
+	// Functions
+
 	// Clears the global data in DataAirLoop.
 	// Needed for unit tests, should not be normally called.
 	void
 	clear_state();
 
+	void
+	RequestAirLoopSim(
+		int const AirLoopNum,
+		bool & SimAir // TRUE means all air loops must be (re)simulated
+	);
+
+	bool
+	AnyAirLoopsNeedSim();
+
+	void
+	SetAllAirLoopSimFlags( bool const Value );
+
 } // DataAirLoop
 
 } // EnergyPlus
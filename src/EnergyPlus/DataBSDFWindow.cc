@@ -134,6 +134,22 @@ namespace DataBSDFWindow {
 	// Object Data
 	Array1D< BSDFWindowGeomDescr > ComplexWind; // Window geometry structure: set in CalcPerSolarBeam/SolarShading
 
+	// Functions
+
+	// Clears the global data in DataBSDFWindow.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		TotComplexFenStates = 0;
+		FirstBSDF = 0;
+		MaxBkSurf = 20;
+		TotThermalModels = 0;
+		SUNCOSTS = Array3D< Real64 >( 60, 24, 3 );
+		BSDFTempMtrx.deallocate();
+		ComplexWind.deallocate();
+	}
+
 } // DataBSDFWindow
 
 } // EnergyPlus
@@ -231,6 +231,12 @@ namespace DataBSDFWindow {
 		// direction (Trn) (no of outgoing dir, NBKSurf)
 		Array2D< Real64 > ARhoVisOverlap; // Overlap areas multiplied with surface reflectance for each outgoing direction (Trn) (no of outgoing dir, NBKSurf)
 		Array1D< Real64 > AveRhoVisOverlap; // Average visible reflectance from overlap surface which originates from one outgoing direction
+		Array2D< Real64 > AOverlapLamda; // Overlap areas times Trn lambda values (NBKSurf, no of outgoing dir)
+		Array2D< Real64 > SolBmBkSurfOverlap; // Overlap areas weighted by the transmittance from each incident direction
+		// summed over outgoing directions (no of incident dir, NBKSurf), per unit cosine of incidence
+		Array2D_int BkSurfBestTrn; // Outgoing direction of a complex fenestration back surface that best matches each
+		// outgoing direction of this window (NBKSurf, no of outgoing dir)
+		Array1D_int BkSurfBestTrnState; // State of the back surface complex fenestration BkSurfBestTrn was found for (NBKSurf)
 		bool InitState; // Flag for marking that state needs to be initalized
 
 		// Default Constructor
@@ -326,6 +332,9 @@ namespace DataBSDFWindow {
 		Array1D< Real64 > WinBkHemAbs; // Back hemispherical absorptance (layers)
 		Array3D< Real64 > WinToSurfBmTrans; // Beam transmittance (hour, timestep, bk surf no)
 		//to back surface
+		Array2D< Real64 > IncBkSurfTrans; // Beam transmittance (incident basis dir, bk surf no) to back surface
+		Array1D< Real64 > IncDirHemiTrans; // Directional-hemispherical transmittance (incident basis dir)
+		Array1D< Real64 > BkIncDirHemiRefl; // Back directional-hemispherical reflectance (back incident basis dir)
 		//Note: the following will be evaluated only if the given back surface is a  window
 		Array1D< BSDFBkSurfDescr > BkSurf; // Structure dimensioned (bk surface no)
 		// Integrated beam values at front and back sides of window.  It is used in calculations of how much of the energy is
@@ -495,6 +504,13 @@ namespace DataBSDFWindow {
 	// Object Data
 	extern Array1D< BSDFWindowGeomDescr > ComplexWind; // Window geometry structure: set in CalcPerSolarBeam/SolarShading
 
+	// Functions
+
+	// Clears the global data in DataBSDFWindow.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 } // DataBSDFWindow
 
 } // EnergyPlus
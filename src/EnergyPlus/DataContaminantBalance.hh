@@ -413,6 +413,13 @@ namespace DataContaminantBalance {
 	extern Array1D< ZoneContamGenericDataDVS > ZoneContamGenericDVS;
 	extern Array1D< ZoneContamGenericDataDRS > ZoneContamGenericDRS;
 
+	// Functions
+
+	// Clears the global data in DataContaminantBalance.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 } // DataContaminantBalance
 
 } // EnergyPlus
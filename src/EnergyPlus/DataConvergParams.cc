@@ -130,6 +130,9 @@ namespace DataConvergParams {
 	int const CalledFromAirSystemDemandSide( 100 );
 	int const CalledFromAirSystemSupplySideDeck1( 101 );
 	int const CalledFromAirSystemSupplySideDeck2( 102 );
+
+	int const SysTimeStepZoneTempChange( 1 ); // System time step shortened on the zone air temperature change
+	int const SysTimeStepTruncationError( 2 ); // System time step shortened on the truncation error estimate
 	// DERIVED TYPE DEFINITIONS:
 	// na
 
@@ -147,6 +150,11 @@ namespace DataConvergParams {
 	int MaxPlantSubIterations( 8 ); // Iteration Max for Plant Simulation sub iterations
 	int MinPlantSubIterations( 2 ); // Iteration Min for Plant Simulation sub iterations
 
+	int SysTimeStepControl( SysTimeStepZoneTempChange ); // How the system time step is shortened within the zone time step
+	Real64 MaxZoneTempTruncError( 0.05 ); // max allowable truncation error estimate of the zone air temperature (C)
+	Real64 ControlEventTimeStep( 0.0 ); // System time step at zone control events (hr), 0 if not shortened
+	bool ResimChangedAirLoopsOnly( false ); // TRUE if only air loops with changed inputs are resimulated in an HVAC iteration
+
 	// Object Data
 	Array1D< HVACZoneInletConvergenceStruct > ZoneInletConvergence;
 	Array1D< HVACAirLoopIterationConvergenceStruct > AirLoopConvergence;
@@ -163,6 +171,10 @@ namespace DataConvergParams {
 		MaxIter = 20 ; // maximum number of iterations allowed
 		MaxPlantSubIterations = 8 ; // Iteration Max for Plant Simulation sub iterations
 		MinPlantSubIterations = 2 ; // Iteration Min for Plant Simulation sub iterations
+		SysTimeStepControl = SysTimeStepZoneTempChange;
+		MaxZoneTempTruncError = 0.05;
+		ControlEventTimeStep = 0.0;
+		ResimChangedAirLoopsOnly = false;
 		ZoneInletConvergence.deallocate();
 		AirLoopConvergence.deallocate();
 		PlantConvergence.deallocate();
@@ -127,6 +127,9 @@ namespace DataConvergParams {
 	extern int const CalledFromAirSystemDemandSide;
 	extern int const CalledFromAirSystemSupplySideDeck1;
 	extern int const CalledFromAirSystemSupplySideDeck2;
+
+	extern int const SysTimeStepZoneTempChange; // System time step shortened on the zone air temperature change
+	extern int const SysTimeStepTruncationError; // System time step shortened on the truncation error estimate
 	// DERIVED TYPE DEFINITIONS:
 	// na
 
@@ -144,6 +147,11 @@ namespace DataConvergParams {
 	extern int MaxPlantSubIterations; // Iteration Max for Plant Simulation sub iterations
 	extern int MinPlantSubIterations; // Iteration Min for Plant Simulation sub iterations
 
+	extern int SysTimeStepControl; // How the system time step is shortened within the zone time step
+	extern Real64 MaxZoneTempTruncError; // max allowable truncation error estimate of the zone air temperature (C)
+	extern Real64 ControlEventTimeStep; // System time step at zone control events (hr), 0 if not shortened
+	extern bool ResimChangedAirLoopsOnly; // TRUE if only air loops with changed inputs are resimulated in an HVAC iteration
+
 	// Types
 
 	struct HVACNodeConvergLogStruct
@@ -105,6 +105,23 @@ namespace DataCostEstimate {
 	CostAdjustmentStruct RefrncBldg( 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0 ); // holds total from line item cost calculations | holds user-defined constant cost model | holds user-defined fraction for design fees | holds user-defined fraction for contractor fees | holds user-defined fraction for contingencies | holds user-defined fraction for bonding costs | holds user-defined fraction for commissioning costs | holds user-defined multiplier to account for regional diffs | the Grand Total of all line items plus all other costs
 	Array1D< monetaryUnitType > monetaryUnit;
 
+	// Functions
+
+	// Clears the global data in DataCostEstimate.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumLineItems = 0;
+		DoCostEstimate = false;
+		numMonetaryUnit = 0;
+		selectedMonetaryUnit = 0;
+		CostLineItem.deallocate();
+		CurntBldg = CostAdjustmentStruct( 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0 );
+		RefrncBldg = CostAdjustmentStruct( 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0 );
+		monetaryUnit.deallocate();
+	}
+
 } // DataCostEstimate
 
 } // EnergyPlus
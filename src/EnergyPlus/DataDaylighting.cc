@@ -140,6 +140,28 @@ namespace DataDaylighting {
 	Array1D< DElightComplexFeneData> DElightComplexFene;
 
 
+	// Functions
+
+	// Clears the global data in DataDaylighting.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		TotIllumMaps = 0;
+		TotRefPoints = 0;
+		mapResultsToReport = false;
+		mapResultsReported = false;
+		MapColSep = 0;
+		DFSReportSizingDays = false;
+		DFSReportAllShadowCalculationDays = false;
+		TotDElightCFS = 0;
+		ZoneDaylight.deallocate();
+		IllumMap.deallocate();
+		IllumMapCalc.deallocate();
+		DaylRefPt.deallocate();
+		DElightComplexFene.deallocate();
+	}
+
 } // DataDaylighting
 
 } // EnergyPlus
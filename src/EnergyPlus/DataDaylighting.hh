@@ -376,6 +376,13 @@ namespace DataDaylighting {
 	extern Array1D< RefPointData > DaylRefPt;
 	extern Array1D< DElightComplexFeneData> DElightComplexFene;
 
+	// Functions
+
+	// Clears the global data in DataDaylighting.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 } // DataDaylighting
 
 } // EnergyPlus
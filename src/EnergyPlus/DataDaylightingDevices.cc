@@ -108,6 +108,19 @@ namespace DataDaylightingDevices {
 	Array1D< TDDPipeData > TDDPipe;
 	Array1D< ShelfData > Shelf;
 
+	// Functions
+
+	// Clears the global data in DataDaylightingDevices.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumOfTDDPipes = 0;
+		NumOfShelf = 0;
+		TDDPipe.deallocate();
+		Shelf.deallocate();
+	}
+
 } // DataDaylightingDevices
 
 } // EnergyPlus
@@ -192,6 +192,13 @@ namespace DataDaylightingDevices {
 	extern Array1D< TDDPipeData > TDDPipe;
 	extern Array1D< ShelfData > Shelf;
 
+	// Functions
+
+	// Clears the global data in DataDaylightingDevices.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 } // DataDaylightingDevices
 
 } // EnergyPlus
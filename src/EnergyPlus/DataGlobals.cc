@@ -99,6 +99,7 @@ namespace DataGlobals {
 	bool runReadVars(false);
 	bool DDOnlySimulation(false);
 	bool AnnualSimulation(false);
+	bool RestartSimulation( false ); // Resume the simulation from the last checkpoint
 
 	// MODULE PARAMETER DEFINITIONS:
 	int const BeginDay( 1 );
@@ -267,6 +268,7 @@ namespace DataGlobals {
 		runReadVars = false;
 		DDOnlySimulation = false;
 		AnnualSimulation = false;
+		RestartSimulation = false;
 		BeginDayFlag = false;
 		BeginEnvrnFlag = false;
 		BeginHourFlag = false;
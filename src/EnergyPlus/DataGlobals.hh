@@ -77,6 +77,7 @@ namespace DataGlobals {
 	extern bool runReadVars;
 	extern bool DDOnlySimulation;
 	extern bool AnnualSimulation;
+	extern bool RestartSimulation; // Resume the simulation from the last checkpoint
 
 	// MODULE PARAMETER DEFINITIONS:
 	extern int const BeginDay;
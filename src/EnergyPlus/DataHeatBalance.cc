@@ -376,6 +376,7 @@ namespace DataHeatBalance {
 	Array1D_int HeatTransferAlgosUsed;
 	int MaxNumberOfWarmupDays( 25 ); // Maximum number of warmup days allowed
 	int MinNumberOfWarmupDays( 6 ); // Minimum number of warmup days allowed
+	bool WarmupConvergenceAcceleration( false ); // True to extrapolate the surface histories during warmup
 	Real64 CondFDRelaxFactor( 1.0 ); // Relaxation factor, for looping across all the surfaces.
 	Real64 CondFDRelaxFactorInput( 1.0 ); // Relaxation factor, for looping across all the surfaces, user input value
 	//LOGICAL ::  CondFDVariableProperties = .FALSE. ! if true, then variable conductivity or enthalpy in Cond FD.
@@ -683,6 +684,15 @@ namespace DataHeatBalance {
 	Array1D< ZoneMassConservationData > MassConservation;
 	ZoneAirMassFlowConservation ZoneAirMassFlow;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		Array1D_int LayerPoint( MaxLayersInConstruct, 0 ); // Pointer array which refers back to
+	}
+
 	// Functions
 
 	// Clears the global data in DataHeatBalance.
@@ -707,6 +717,7 @@ namespace DataHeatBalance {
 		HeatTransferAlgosUsed.deallocate();
 		MaxNumberOfWarmupDays = 25;
 		MinNumberOfWarmupDays = 6;
+		WarmupConvergenceAcceleration = false;
 		CondFDRelaxFactor = 1.0;
 		CondFDRelaxFactorInput = 1.0;
 		ZoneAirSolutionAlgo = Use3rdOrder;
@@ -938,6 +949,7 @@ namespace DataHeatBalance {
 		ZnRpt.deallocate();
 		MassConservation.deallocate();
 		ZoneAirMassFlow = ZoneAirMassFlowConservation();
+		LayerPoint = Array1D_int( MaxLayersInConstruct, 0 );
 	}
 
 	void
@@ -1486,7 +1498,6 @@ namespace DataHeatBalance {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static Array1D_int LayerPoint( MaxLayersInConstruct, 0 ); // Pointer array which refers back to
 		int nLayer;
 		int Loop;
 		bool Found;
@@ -357,6 +357,7 @@ namespace DataHeatBalance {
 	extern Array1D_int HeatTransferAlgosUsed;
 	extern int MaxNumberOfWarmupDays; // Maximum number of warmup days allowed
 	extern int MinNumberOfWarmupDays; // Minimum number of warmup days allowed
+	extern bool WarmupConvergenceAcceleration; // True to extrapolate the surface histories during warmup
 	extern Real64 CondFDRelaxFactor; // Relaxation factor, for looping across all the surfaces.
 	extern Real64 CondFDRelaxFactorInput; // Relaxation factor, for looping across all the surfaces, user input value
 	//LOGICAL ::  CondFDVariableProperties = .FALSE. ! if true, then variable conductivity or enthalpy in Cond FD.
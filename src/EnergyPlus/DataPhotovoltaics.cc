@@ -143,6 +143,21 @@ namespace DataPhotovoltaics {
 	//     System Specialists, 2916 Marketplace Drive, Suite 104, Madison, WI 53719;
 	//     Tel: (608) 274-2577
 
+	// Functions
+
+	// Clears the global data in DataPhotovoltaics.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumPVs = 0;
+		Num1DiodePVModuleTypes = 0;
+		NumSimplePVModuleTypes = 0;
+		NumSNLPVModuleTypes = 0;
+		ShuntResistance = 0.0;
+		PVarray.deallocate();
+	}
+
 } // DataPhotovoltaics
 
 } // EnergyPlus
@@ -454,6 +454,13 @@ namespace DataPhotovoltaics {
 	// Object Data
 	extern Array1D< PVArrayStruct > PVarray;
 
+	// Functions
+
+	// Clears the global data in DataPhotovoltaics.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 } // DataPhotovoltaics
 
 } // EnergyPlus
@@ -64,6 +64,7 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/Array2D.hh>
 #include <ObjexxFCL/Array3D.hh>
 
 // EnergyPlus Headers
@@ -902,6 +903,31 @@ namespace DataPlantPipingSystems {
 
 	};
 
+	struct FieldCellSolverInfo // Flat (structure of arrays) storage for the field cell temperature sweeps
+	{
+		// Members
+		bool IsSetUp; // True once the cell lists and resistances match the current mesh and properties
+		int NumCells; // Total number of cells in the domain
+		int NumFieldCells; // Number of field, slab and insulation cells updated by the sweeps
+		int NumRedCells; // Field cells with an even X+Y+Z index sum, stored ahead of the black cells
+		Array1D_int CellIndex; // Linear index into Cells of each field cell
+		Array2D_int NeighborIndex; // (direction, field cell) linear index of the neighbor; the cell itself on the domain edge
+		Array2D< Real64 > Resistance; // (direction, field cell) conduction resistance to the neighbor [K/W]
+		Array2D< Real64 > Coefficient; // (direction, field cell) Beta / Resistance for the current time step, zero on the domain edge
+		Array1D< Real64 > Denominator; // 1 + sum of the coefficients for the current time step
+		Array1D< Real64 > PrevTimeStepTemperature; // Field cell temperature at the previous time step [C]
+		Array1D< Real64 > Temperature; // Copy of all cell temperatures by linear index, used during a sweep [C]
+
+		// Default Constructor
+		FieldCellSolverInfo() :
+			IsSetUp( false ),
+			NumCells( 0 ),
+			NumFieldCells( 0 ),
+			NumRedCells( 0 )
+		{}
+
+	};
+
 	struct FullDomainStructureInfo
 	{
 		// Members
@@ -986,6 +1012,9 @@ namespace DataPlantPipingSystems {
 		// Main 3D cells array
 		Array3D< CartesianCell > Cells;
 
+		// Flat arrays for the field cell sweeps
+		FieldCellSolverInfo FieldSolver;
+
 		// Default Constructor
 		FullDomainStructureInfo() :
 			MaxIterationsPerTS( 10 ),
@@ -106,6 +106,25 @@ namespace DataReportingFlags {
 	bool DebugOutput( false );
 	bool EvenDuringWarmup( false );
 
+	// Functions
+
+	// Clears the global data in DataReportingFlags.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumOfWarmupDays = 0;
+		cWarmupDay.clear();
+		DisplayPerfSimulationFlag = false;
+		DoWeatherInitReporting = false;
+		PrintEndDataDictionary = false;
+		IgnoreInteriorWindowTransmission = false;
+		MakeMirroredDetachedShading = true;
+		MakeMirroredAttachedShading = true;
+		DebugOutput = false;
+		EvenDuringWarmup = false;
+	}
+
 } // DataReportingFlags
 
 } // EnergyPlus
@@ -88,6 +88,13 @@ namespace DataReportingFlags {
 	extern bool DebugOutput;
 	extern bool EvenDuringWarmup;
 
+	// Functions
+
+	// Clears the global data in DataReportingFlags.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 } // DataReportingFlags
 
 } // EnergyPlus
@@ -130,8 +130,10 @@ namespace DataRootFinder {
 	int const iMethodFalsePosition( 2 ); // Step performed using false position method (aka regula falsi)
 	int const iMethodSecant( 3 ); // Step performed using secant method
 	int const iMethodBrent( 4 ); // Step performed using Brent's method
+	int const iMethodIllinois( 5 ); // Step performed using Illinois method (modified false position)
+	int const iMethodNewton( 6 ); // Step performed using Newton's method safeguarded by bisection
 	// Names for each solution method type
-	Array1D_string const SolutionMethodTypes( {-1,4}, { "No solution method", "Bracketting method", "Bisection method", "False position method", "Secant method", "Brent method" } );
+	Array1D_string const SolutionMethodTypes( {-1,6}, { "No solution method", "Bracketting method", "Bisection method", "False position method", "Secant method", "Brent method", "Illinois method", "Newton method" } );
 
 	// DERIVED TYPE DEFINITIONS
 	// Type declaration for the numerical controls.
@@ -144,7 +146,23 @@ namespace DataRootFinder {
 	// na
 
 	// MODULE VARIABLE DECLARATIONS:
-	// na
+	int NumRootSolverStats( 0 ); // Number of callers tracked by the root solver statistics
+
+	// Object Data
+	Array1D< RootSolverStatsType > RootSolverStats; // Convergence statistics for each root solver caller
+	std::unordered_map< std::string, int > RootSolverStatsIndex; // Caller name to RootSolverStats index
+
+	// Functions
+
+	// Clears the global data in DataRootFinder.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumRootSolverStats = 0;
+		RootSolverStats.deallocate();
+		RootSolverStatsIndex.clear();
+	}
 
 } // DataRootFinder
 
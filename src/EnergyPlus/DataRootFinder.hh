@@ -59,6 +59,10 @@
 #ifndef DataRootFinder_hh_INCLUDED
 #define DataRootFinder_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <unordered_map>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -115,6 +119,8 @@ namespace DataRootFinder {
 	extern int const iMethodFalsePosition; // Step performed using false position method (aka regula falsi)
 	extern int const iMethodSecant; // Step performed using secant method
 	extern int const iMethodBrent; // Step performed using Brent's method
+	extern int const iMethodIllinois; // Step performed using Illinois method (modified false position)
+	extern int const iMethodNewton; // Step performed using Newton's method safeguarded by bisection
 	// Names for each solution method type
 	extern Array1D_string const SolutionMethodTypes;
 
@@ -194,6 +200,45 @@ namespace DataRootFinder {
 
 	};
 
+	struct RootSolverStatsType
+	{
+		// Members
+		std::string Name; // Name of the caller (component or routine) using the root solver
+		int MethodType; // Solution method used on the last call (any of the iMethod<...> codes)
+		int NumCalls; // Number of root solver calls
+		int NumConverged; // Number of calls that converged within the iteration limit
+		int NumIterationLimit; // Number of calls that stopped at the iteration limit (Flag = -1)
+		int NumNotBracketed; // Number of calls with f(x0) and f(x1) of the same sign (Flag = -2)
+		int TotIterations; // Total number of iterations over all converged calls
+		int MaxIterations; // Maximum number of iterations needed by a converged call
+
+		// Default Constructor
+		RootSolverStatsType() :
+			MethodType( iMethodNone ),
+			NumCalls( 0 ),
+			NumConverged( 0 ),
+			NumIterationLimit( 0 ),
+			NumNotBracketed( 0 ),
+			TotIterations( 0 ),
+			MaxIterations( 0 )
+		{}
+
+	};
+
+	// MODULE VARIABLE DECLARATIONS:
+	extern int NumRootSolverStats; // Number of callers tracked by the root solver statistics
+
+	// Object Data
+	extern Array1D< RootSolverStatsType > RootSolverStats; // Convergence statistics for each root solver caller
+	extern std::unordered_map< std::string, int > RootSolverStatsIndex; // Caller name to RootSolverStats index
+
+	// Functions
+
+	// Clears the global data in DataRootFinder.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 } // DataRootFinder
 
 } // EnergyPlus
@@ -98,6 +98,16 @@ namespace DataShadowingCombinations {
 	// Object Data
 	Array1D< ShadowingCombinations > ShadowComb;
 
+	// Functions
+
+	// Clears the global data in DataShadowingCombinations.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		ShadowComb.deallocate();
+	}
+
 } // DataShadowingCombinations
 
 } // EnergyPlus
@@ -103,6 +103,13 @@ namespace DataShadowingCombinations {
 	// Object Data
 	extern Array1D< ShadowingCombinations > ShadowComb;
 
+	// Functions
+
+	// Clears the global data in DataShadowingCombinations.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 } // DataShadowingCombinations
 
 } // EnergyPlus
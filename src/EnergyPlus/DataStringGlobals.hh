@@ -116,6 +116,8 @@ namespace DataStringGlobals {
 	extern std::string outputSszTxtFileName;
 	extern std::string outputScreenCsvFileName;
 	extern std::string outputSqlFileName;
+	extern std::string outputSegFileName;
+	extern std::string outputSegReportsFileName;
 	extern std::string outputSqliteErrFileName;
 	extern std::string EnergyPlusIniFileName;
 	extern std::string inStatFileName;
@@ -173,6 +173,8 @@ namespace DataStringGlobals {
 	std::string outputSszTxtFileName("eplusssz.txt");
 	std::string outputScreenCsvFileName("eplusscreen.csv");
 	std::string outputSqlFileName("eplusout.sql");
+	std::string outputSegFileName("eplusout.seg");
+	std::string outputSegReportsFileName("eplusout.sgr");
 	std::string outputSqliteErrFileName("eplussqlite.err");
 	std::string EnergyPlusIniFileName;
 	std::string inStatFileName;
@@ -127,6 +127,14 @@ namespace DataSurfaceColors {
 
 	// Functions
 
+	// Clears the global data in DataSurfaceColors.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		DXFcolorno = Array1D_int( NumColors, defaultcolorno );
+	}
+
 	bool
 	MatchAndSetColorTextString(
 		std::string const & String, // string to be matched
@@ -105,6 +105,11 @@ namespace DataSurfaceColors {
 
 	// Functions
 
+	// Clears the global data in DataSurfaceColors.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	bool
 	MatchAndSetColorTextString(
 		std::string const & String, // string to be matched
@@ -141,6 +141,14 @@ namespace DataSystemVariables {
 	// solutions of all controllers on each air loop at each call to SimAirLoop()
 	std::string const TraceHVACControllerEnvVar( "TRACE_HVACCONTROLLER" ); // To generate a trace file for
 	//  each individual HVAC controller with all controller iterations
+	std::string const TrackRootSolverEnvVar( "TRACK_ROOTSOLVER" ); // To generate a file with convergence
+	// statistics for each caller of the General::SolveRoot family of root solvers
+	std::string const MemoizeDXCoilEnvVar( "DXCOIL_MEMO" ); // To reuse DX coil performance results within a time step
+	std::string const RefrigTablesEnvVar( "REFRIG_TABLES" ); // To evaluate superheated refrigerant temperatures from precomputed tables
+	std::string const WindowTablesEnvVar( "WINDOW_TABLES" ); // To start window layer heat balances from precomputed response tables
+	std::string const GFunctionCacheEnvVar( "GFUNCTION_CACHE" ); // Path of the file caching the ground heat exchanger g-functions
+	std::string const WarmStartEnvVar( "WARMSTART_FILE" ); // Path of the file holding converged warmup states
+	std::string const CheckpointEnvVar( "CHECKPOINT_FILE" ); // Path of the file holding the simulation state at the last day boundary
 
 	std::string const MinReportFrequencyEnvVar( "MINREPORTFREQUENCY" ); // environment var for reporting frequency.
 	std::string const cDisplayInputInAuditEnvVar( "DISPLAYINPUTINAUDIT" ); // environmental variable that enables the echoing of the input file into the audit file
@@ -166,6 +174,20 @@ namespace DataSystemVariables {
 	// HVAC controllers on each air loop at each call to SimAirLoop()
 	bool TraceHVACControllerEnvFlag( false ); // If TRUE generates a trace file for each individual HVAC
 	// controller with all controller iterations
+	bool TrackRootSolverEnvFlag( false ); // If TRUE generates a file with convergence statistics for each
+	// caller of the General::SolveRoot family of root solvers
+	bool MemoizeDXCoilEnvFlag( false ); // If TRUE DX coil performance results are reused for identical inlet
+	// states within a time step and hit/miss statistics are written to a file
+	bool RefrigTablesEnvFlag( false ); // If TRUE superheated refrigerant temperatures are interpolated from
+	// pressure-enthalpy tables built on first use instead of solved iteratively
+	bool WindowTablesEnvFlag( false ); // If TRUE bare window face temperatures are interpolated from response
+	// tables built on first use and corrected with a single heat balance iteration
+	std::string GFunctionCacheFileName( "eplusgfn.cache" ); // Ground heat exchanger g-functions calculated by earlier runs (set in the output directory)
+	std::string WarmStartFileName; // Surface histories and zone air state at the end of warmup saved by earlier runs (blank if not used)
+	std::string CheckpointFileName; // Simulation state saved at the end of each run period day (blank if not used)
+	int NumSegments( 0 ); // Number of segments the weather file run periods are split into (0 if not split)
+	int SegmentNum( 0 ); // Segment of the weather file run periods simulated by this run
+	int SegmentOverlapDays( 0 ); // Days simulated ahead of a segment, without reporting, to settle its initial state
 	bool ReportDuringWarmup( false ); // True when the report outputs even during warmup
 	bool ReportDuringHVACSizingSimulation( false ); // true when reporting outputs during HVAC sizing Simulation
 	bool ReportDetailedWarmupConvergence( false ); // True when the detailed warmup convergence is requested
@@ -196,8 +218,76 @@ namespace DataSystemVariables {
 	int iNominalTotSurfaces( 0 );
 	bool Threading( false );
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int EchoInputFile; // found unit number for "eplusout.audit"
+		bool firstTime( true );
+	}
+
 	// Functions
 
+	// Clears the global data in DataSystemVariables.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		DDOnly = false;
+		ReverseDD = false;
+		FullAnnualRun = false;
+		DeveloperFlag = false;
+		TimingFlag = false;
+		SutherlandHodgman = true;
+		DetailedSkyDiffuseAlgorithm = false;
+		DetailedSolarTimestepIntegration = false;
+		TrackAirLoopEnvFlag = false;
+		TraceAirLoopEnvFlag = false;
+		TraceHVACControllerEnvFlag = false;
+		TrackRootSolverEnvFlag = false;
+		MemoizeDXCoilEnvFlag = false;
+		RefrigTablesEnvFlag = false;
+		WindowTablesEnvFlag = false;
+		GFunctionCacheFileName = "eplusgfn.cache";
+		WarmStartFileName.clear();
+		CheckpointFileName.clear();
+		NumSegments = 0;
+		SegmentNum = 0;
+		SegmentOverlapDays = 0;
+		ReportDuringWarmup = false;
+		ReportDuringHVACSizingSimulation = false;
+		ReportDetailedWarmupConvergence = false;
+		UpdateDataDuringWarmupExternalInterface = false;
+		Elapsed_Time = 0.0;
+		Time_Start = 0.0;
+		Time_Finish = 0.0;
+		cMinReportFrequency.clear();
+		MinReportFrequency = -2;
+		SortedIDD = true;
+		lMinimalShadowing = false;
+		TempFullFileName.clear();
+		envinputpath1.clear();
+		envinputpath2.clear();
+		envprogrampath.clear();
+		TestAllPaths = false;
+		iEnvSetThreads = 0;
+		lEnvSetThreadsInput = false;
+		iepEnvSetThreads = 0;
+		lepSetThreadsInput = false;
+		iIDFSetThreads = 0;
+		lIDFSetThreadsInput = false;
+		inumActiveSims = 1;
+		lnumActiveSims = false;
+		MaxNumberOfThreads = 1;
+		NumberIntRadThreads = 1;
+		iNominalTotSurfaces = 0;
+		Threading = false;
+		EchoInputFile = 0;
+		firstTime = true;
+	}
+
 	void
 	CheckForActualFileName(
 		std::string const & originalInputFileName, // name as input for object
@@ -241,8 +331,6 @@ namespace DataSystemVariables {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		bool FileExist( false ); // initialize to false, then override to true if present
-		static int EchoInputFile; // found unit number for "eplusout.audit"
-		static bool firstTime( true );
 		std::string InputFileName; // save for changing out path characters
 		std::string::size_type pos;
 
@@ -110,6 +110,14 @@ namespace DataSystemVariables {
 	// solutions of all controllers on each air loop at each call to SimAirLoop()
 	extern std::string const TraceHVACControllerEnvVar; // To generate a trace file for
 	//  each individual HVAC controller with all controller iterations
+	extern std::string const TrackRootSolverEnvVar; // To generate a file with convergence
+	// statistics for each caller of the General::SolveRoot family of root solvers
+	extern std::string const MemoizeDXCoilEnvVar; // To reuse DX coil performance results within a time step
+	extern std::string const RefrigTablesEnvVar; // To evaluate superheated refrigerant temperatures from precomputed tables
+	extern std::string const WindowTablesEnvVar; // To start window layer heat balances from precomputed response tables
+	extern std::string const GFunctionCacheEnvVar; // Path of the file caching the ground heat exchanger g-functions
+	extern std::string const WarmStartEnvVar; // Path of the file holding converged warmup states
+	extern std::string const CheckpointEnvVar; // Path of the file holding the simulation state at the last day boundary
 
 	extern std::string const MinReportFrequencyEnvVar; // environment var for reporting frequency.
 	extern std::string const cDisplayInputInAuditEnvVar; // environmental variable that enables the echoing of the input file into the audit file
@@ -135,6 +143,20 @@ namespace DataSystemVariables {
 	// HVAC controllers on each air loop at each call to SimAirLoop()
 	extern bool TraceHVACControllerEnvFlag; // If TRUE generates a trace file for each individual HVAC
 	// controller with all controller iterations
+	extern bool TrackRootSolverEnvFlag; // If TRUE generates a file with convergence statistics for each
+	// caller of the General::SolveRoot family of root solvers
+	extern bool MemoizeDXCoilEnvFlag; // If TRUE DX coil performance results are reused for identical inlet
+	// states within a time step and hit/miss statistics are written to a file
+	extern bool RefrigTablesEnvFlag; // If TRUE superheated refrigerant temperatures are interpolated from
+	// pressure-enthalpy tables built on first use instead of solved iteratively
+	extern bool WindowTablesEnvFlag; // If TRUE bare window face temperatures are interpolated from response
+	// tables built on first use and corrected with a single heat balance iteration
+	extern std::string GFunctionCacheFileName; // Ground heat exchanger g-functions calculated by earlier runs
+	extern std::string WarmStartFileName; // Surface histories and zone air state at the end of warmup saved by earlier runs (blank if not used)
+	extern std::string CheckpointFileName; // Simulation state saved at the end of each run period day (blank if not used)
+	extern int NumSegments; // Number of segments the weather file run periods are split into (0 if not split)
+	extern int SegmentNum; // Segment of the weather file run periods simulated by this run
+	extern int SegmentOverlapDays; // Days simulated ahead of a segment, without reporting, to settle its initial state
 	extern bool ReportDuringWarmup; // True when the report outputs even during warmup
 	extern bool ReportDuringHVACSizingSimulation; // true when reporting outputs during HVAC sizing Simulation
 	extern bool ReportDetailedWarmupConvergence; // True when the detailed warmup convergence is requested
@@ -167,6 +189,11 @@ namespace DataSystemVariables {
 
 	// Functions
 
+	// Clears the global data in DataSystemVariables.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	CheckForActualFileName(
 		std::string const & originalInputFileName, // name as input for object
@@ -154,6 +154,46 @@ namespace DataTimings {
 
 	// Functions
 
+	// Clears the global data in DataTimings.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumTimingElements = 0;
+		MaxTimingElements = 0;
+		dailyWeatherTime = 0.0;
+		dailyExteriorEnergyUseTime = 0.0;
+		dailyHeatBalanceTime = 0.0;
+		hbdailyInit = 0.0;
+		hbdailyOutSurf = 0.0;
+		hbdailyInSurf = 0.0;
+		hbdailyHVAC = 0.0;
+		hbdailyRep = 0.0;
+		clockrate = 0.0;
+		lprocessingInputTiming = false;
+		lmanageSimulationTiming = false;
+		lcloseoutReportingTiming = false;
+#ifdef EP_Count_Calls
+		NumShadow_Calls = 0;
+		NumShadowAtTS_Calls = 0;
+		NumClipPoly_Calls = 0;
+		NumInitSolar_Calls = 0;
+		NumAnisoSky_Calls = 0;
+		NumDetPolyOverlap_Calls = 0;
+		NumCalcPerSolBeam_Calls = 0;
+		NumDetShadowCombs_Calls = 0;
+		NumIntSolarDist_Calls = 0;
+		NumIntRadExchange_Calls = 0;
+		NumIntRadExchangeZ_Calls = 0;
+		NumIntRadExchangeMain_Calls = 0;
+		NumIntRadExchangeOSurf_Calls = 0;
+		NumIntRadExchangeISurf_Calls = 0;
+		NumMaxInsideSurfIterations = 0;
+		NumCalcScriptF_Calls = 0;
+#endif
+		Timing.deallocate();
+	}
+
 	void
 	epStartTime(
 #ifdef EP_NO_Timings
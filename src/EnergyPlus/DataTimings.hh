@@ -146,6 +146,11 @@ namespace DataTimings {
 
 	// Functions
 
+	// Clears the global data in DataTimings.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	epStartTime( std::string const & ctimingElementstring );
 
@@ -103,6 +103,16 @@ namespace DataViewFactorInformation {
 	// Object Data
 	Array1D< ZoneViewFactorInformation > ZoneInfo;
 
+	// Functions
+
+	// Clears the global data in DataViewFactorInformation.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		ZoneInfo.deallocate();
+	}
+
 } // DataViewFactorInformation
 
 } // EnergyPlus
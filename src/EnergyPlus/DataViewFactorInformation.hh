@@ -107,6 +107,13 @@ namespace DataViewFactorInformation {
 	// Object Data
 	extern Array1D< ZoneViewFactorInformation > ZoneInfo;
 
+	// Functions
+
+	// Clears the global data in DataViewFactorInformation.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 } // DataViewFactorInformation
 
 } // EnergyPlus
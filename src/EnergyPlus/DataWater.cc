@@ -140,6 +140,28 @@ namespace DataWater {
 	Array1D< RainfallCollectorDataStruct > RainCollector;
 	Array1D< GroundwaterWellDataStruct > GroundwaterWell;
 
+	// Functions
+
+	// Clears the global data in DataWater.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumWaterStorageTanks = 0;
+		NumRainCollectors = 0;
+		NumGroundWaterWells = 0;
+		NumSiteRainFall = 0;
+		NumIrrigation = 0;
+		AnyWaterSystemsInModel = false;
+		WaterSystemGetInputCalled = false;
+		AnyIrrigationInModel = false;
+		RainFall = SiteRainFallDataStruct();
+		Irrigation = IrrigationDataStruct();
+		WaterStorage.deallocate();
+		RainCollector.deallocate();
+		GroundwaterWell.deallocate();
+	}
+
 } // DataWater
 
 } // EnergyPlus
@@ -366,6 +366,13 @@ namespace DataWater {
 	extern Array1D< RainfallCollectorDataStruct > RainCollector;
 	extern Array1D< GroundwaterWellDataStruct > GroundwaterWell;
 
+	// Functions
+
+	// Clears the global data in DataWater.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 } // DataWater
 
 } // EnergyPlus
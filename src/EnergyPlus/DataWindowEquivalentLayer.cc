@@ -117,6 +117,20 @@ namespace DataWindowEquivalentLayer {
 	Array1D< CFSTY > CFS;
 	Array1D< CFSGAP > CFSGaps;
 
+	// Functions
+
+	// Clears the global data in DataWindowEquivalentLayer.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		TotWinEquivLayerConstructs = 0;
+		SWP_ROOMBLK = CFSSWP();
+		CFSLayers.deallocate();
+		CFS.deallocate();
+		CFSGaps.deallocate();
+	}
+
 } // DataWindowEquivalentLayer
 
 } // EnergyPlus
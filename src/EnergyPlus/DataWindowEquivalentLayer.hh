@@ -298,6 +298,13 @@ namespace DataWindowEquivalentLayer {
 	extern Array1D< CFSTY > CFS;
 	extern Array1D< CFSGAP > CFSGaps;
 
+	// Functions
+
+	// Clears the global data in DataWindowEquivalentLayer.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 } // DataWindowEquivalentLayer
 
 } // EnergyPlus
@@ -213,8 +213,34 @@ namespace DaylightingDevices {
 
 	// MODULE SUBROUTINES:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int NumStored( 0 ); // Counter for number of pipes stored as they are calculated
+		bool ShelfReported( false );
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool GetShelfInputErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool MyEnvrnFlag( true );
+	}
+
 	// Functions
 
+	// Clears the global data in DaylightingDevices.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		COSAngle = Array1D< Real64 >( NumOfAngles );
+		NumStored = 0;
+		ShelfReported = false;
+		ErrorsFound = false;
+		GetShelfInputErrorsFound = false;
+		MyEnvrnFlag = true;
+	}
+
 	void
 	InitDaylightingDevices()
 	{
@@ -260,8 +286,6 @@ namespace DaylightingDevices {
 		int ShelfSurf; // Daylighting shelf surface number
 		int WinSurf; // Window surface number
 
-		static int NumStored( 0 ); // Counter for number of pipes stored as they are calculated
-		static bool ShelfReported( false );
 
 		struct TDDPipeStoredData
 		{
@@ -466,7 +490,6 @@ namespace DaylightingDevices {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		//unused1208  CHARACTER(len=MaxNameLength), &
 		//                   DIMENSION(20) :: Alphas                ! Alpha items for object
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		int IOStatus; // Used in GetObjectItem
 		bool IsBlank; // TRUE if the name is blank
 		bool IsNotOK; // TRUE if there was a problem with a list name
@@ -714,7 +737,6 @@ namespace DaylightingDevices {
 		// SUBROUTINE ARGUMENT DEFINITIONS: na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		int IOStatus; // Used in GetObjectItem
 		bool IsBlank; // TRUE if the name is blank
 		bool IsNotOK; // TRUE if there was a problem with a list name
@@ -738,7 +760,7 @@ namespace DaylightingDevices {
 				IsBlank = false;
 				VerifyName( cAlphaArgs( 1 ), Shelf, ShelfNum - 1, IsNotOK, IsBlank, "DaylightingDevice:Shelf" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetShelfInputErrorsFound = true;
 					if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 				}
 				Shelf( ShelfNum ).Name = cAlphaArgs( 1 );
@@ -748,35 +770,35 @@ namespace DaylightingDevices {
 
 				if ( SurfNum == 0 ) {
 					ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Window " + cAlphaArgs( 2 ) + " not found." );
-					ErrorsFound = true;
+					GetShelfInputErrorsFound = true;
 				} else {
 					if ( Surface( SurfNum ).Class != SurfaceClass_Window ) {
 						ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Window " + cAlphaArgs( 2 ) + " is not of surface type WINDOW." );
-						ErrorsFound = true;
+						GetShelfInputErrorsFound = true;
 					}
 
 					if ( Surface( SurfNum ).Shelf > 0 ) {
 						ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Window " + cAlphaArgs( 2 ) + " is referenced by more than one shelf." );
-						ErrorsFound = true;
+						GetShelfInputErrorsFound = true;
 					}
 
 					if ( Surface( SurfNum ).WindowShadingControlPtr > 0 ) {
 						ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Window " + cAlphaArgs( 2 ) + " must not have a shading control." );
-						ErrorsFound = true;
+						GetShelfInputErrorsFound = true;
 					}
 
 					if ( Surface( SurfNum ).FrameDivider > 0 ) {
 						ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Window " + cAlphaArgs( 2 ) + " must not have a frame/divider." );
-						ErrorsFound = true;
+						GetShelfInputErrorsFound = true;
 					}
 
 					if ( Surface( SurfNum ).Sides != 4 ) {
 						ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Window " + cAlphaArgs( 2 ) + " must have 4 sides." );
-						ErrorsFound = true;
+						GetShelfInputErrorsFound = true;
 					}
 					if ( Construct( Surface( SurfNum ).Construction ).WindowTypeEQL ) {
 						ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Window " + cAlphaArgs( 2 ) + " Equivalent Layer Window is not supported." );
-						ErrorsFound = true;
+						GetShelfInputErrorsFound = true;
 					}
 
 					Shelf( ShelfNum ).Window = SurfNum;
@@ -789,18 +811,18 @@ namespace DaylightingDevices {
 
 					if ( SurfNum == 0 ) {
 						ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Inside shelf " + cAlphaArgs( 3 ) + " not found." );
-						ErrorsFound = true;
+						GetShelfInputErrorsFound = true;
 					} else {
 						// No error if shelf belongs to more than one window, e.g. concave corners
 
 						if ( Surface( SurfNum ).ExtBoundCond != SurfNum ) {
 							ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Inside shelf " + cAlphaArgs( 3 ) + " must be its own Outside Boundary Condition Object." );
-							ErrorsFound = true;
+							GetShelfInputErrorsFound = true;
 						}
 
 						if ( Surface( SurfNum ).Sides != 4 ) {
 							ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Inside shelf " + cAlphaArgs( 3 ) + " must have 4 sides." );
-							ErrorsFound = true;
+							GetShelfInputErrorsFound = true;
 						}
 
 						Shelf( ShelfNum ).InSurf = SurfNum;
@@ -813,23 +835,23 @@ namespace DaylightingDevices {
 
 					if ( SurfNum == 0 ) {
 						ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Outside shelf " + cAlphaArgs( 4 ) + " not found." );
-						ErrorsFound = true;
+						GetShelfInputErrorsFound = true;
 					} else {
 						// No error if shelf belongs to more than one window, e.g. concave corners
 
 						if ( Surface( SurfNum ).Class != SurfaceClass_Shading ) {
 							ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Outside shelf " + cAlphaArgs( 4 ) + " is not a Shading:Zone:Detailed object." );
-							ErrorsFound = true;
+							GetShelfInputErrorsFound = true;
 						}
 
 						if ( Surface( SurfNum ).SchedShadowSurfIndex > 0 ) {
 							ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Outside shelf " + cAlphaArgs( 4 ) + " must not have a transmittance schedule." );
-							ErrorsFound = true;
+							GetShelfInputErrorsFound = true;
 						}
 
 						if ( Surface( SurfNum ).Sides != 4 ) {
 							ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Outside shelf " + cAlphaArgs( 4 ) + " must have 4 sides." );
-							ErrorsFound = true;
+							GetShelfInputErrorsFound = true;
 						}
 
 						// Get outside shelf construction (required if outside shelf is specified)
@@ -838,17 +860,17 @@ namespace DaylightingDevices {
 
 							if ( ConstrNum == 0 ) {
 								ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Outside shelf construction " + cAlphaArgs( 5 ) + " not found." );
-								ErrorsFound = true;
+								GetShelfInputErrorsFound = true;
 							} else if ( Construct( ConstrNum ).TypeIsWindow ) {
 								ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Outside shelf construction " + cAlphaArgs( 5 ) + " must not have WindowMaterial:Glazing." );
-								ErrorsFound = true;
+								GetShelfInputErrorsFound = true;
 							} else {
 								Shelf( ShelfNum ).Construction = ConstrNum;
 								Construct( ConstrNum ).IsUsed = true;
 							}
 						} else {
 							ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Outside shelf requires an outside shelf construction to be specified." );
-							ErrorsFound = true;
+							GetShelfInputErrorsFound = true;
 						}
 
 						// Get view factor to outside shelf (optional)
@@ -877,7 +899,7 @@ namespace DaylightingDevices {
 
 			} // ShelfNum
 
-			if ( ErrorsFound ) ShowFatalError( "Errors in DaylightingDevice:Shelf input." );
+			if ( GetShelfInputErrorsFound ) ShowFatalError( "Errors in DaylightingDevice:Shelf input." );
 		}
 
 	}
@@ -1582,7 +1604,6 @@ namespace DaylightingDevices {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyEnvrnFlag( true );
 		int Loop;
 
 		if ( NumOfTDDPipes == 0 ) return;
@@ -81,6 +81,11 @@ namespace DaylightingDevices {
 
 	// Functions
 
+	// Clears the global data in DaylightingDevices.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	InitDaylightingDevices();
 
@@ -239,8 +239,457 @@ namespace DaylightingManager {
 
 	// MODULE SUBROUTINES:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		Vector3< Real64 > AR; // Inside surface area sum for floor/wall/ceiling (m2)
+		Vector3< Real64 > ARH; // Inside surface area*reflectance sum for floor/wall/ceiling (m2)
+		Vector3< Real64 > AP; // Zone inside surface floor/wall/ceiling area without a selected
+		Vector3< Real64 > ARHP; // Zone inside surface floor/wall/ceiling area*reflectance without
+		bool firstTime( true );
+		bool FirstTimeDaylFacCalc( true );
+		bool CreateDFSReportFile( true );
+		bool doSkyReporting( true );
+		bool VeryFirstTime( true );
+		Vector3< Real64 > CalcDayltgCoeffsRefPointsW2; // Second vertex of window
+		Vector3< Real64 > CalcDayltgCoeffsRefPointsW3; // Third vertex of window
+		Vector3< Real64 > CalcDayltgCoeffsRefPointsW21; // Vector from window vertex 2 to window vertex 1
+		Vector3< Real64 > CalcDayltgCoeffsRefPointsW23; // Vector from window vertex 2 to window vertex 3
+		Vector3< Real64 > CalcDayltgCoeffsRefPointsRREF; // Location of a reference point in absolute coordinate system
+		Vector3< Real64 > CalcDayltgCoeffsRefPointsRREF2; // Location of virtual reference point in absolute coordinate system
+		Vector3< Real64 > CalcDayltgCoeffsRefPointsRWIN; // Center of a window element in absolute coordinate system
+		Vector3< Real64 > CalcDayltgCoeffsRefPointsRWIN2; // Center of a window element for TDD:DOME (if exists) in abs coord sys
+		Vector3< Real64 > CalcDayltgCoeffsRefPointsRay; // Unit vector along ray from reference point to window element
+		Vector3< Real64 > CalcDayltgCoeffsRefPointsWNORM2; // Unit vector normal to TDD:DOME (if exists)
+		Vector3< Real64 > CalcDayltgCoeffsRefPointsVIEWVC; // View vector in absolute coordinate system
+		Vector3< Real64 > CalcDayltgCoeffsRefPointsU2; // Second vertex of window for TDD:DOME (if exists)
+		Vector3< Real64 > CalcDayltgCoeffsRefPointsU21; // Vector from window vertex 2 to window vertex 1 for TDD:DOME (if exists)
+		Vector3< Real64 > CalcDayltgCoeffsRefPointsU23; // Vector from window vertex 2 to window vertex 3 for TDD:DOME (if exists)
+		Vector3< Real64 > CalcDayltgCoeffsRefPointsVIEWVC2; // Virtual view vector in absolute coordinate system
+		bool refFirstTime( true );
+		bool MySunIsUpFlag( false );
+		Vector3< Real64 > CalcDayltgCoeffsMapPointsW2; // Second vertex of window
+		Vector3< Real64 > CalcDayltgCoeffsMapPointsW3; // Third vertex of window
+		Vector3< Real64 > CalcDayltgCoeffsMapPointsU2; // Second vertex of window for TDD:DOME (if exists)
+		Vector3< Real64 > CalcDayltgCoeffsMapPointsRREF; // Location of a reference point in absolute coordinate system
+		Vector3< Real64 > CalcDayltgCoeffsMapPointsRREF2; // Location of virtual reference point in absolute coordinate system
+		Vector3< Real64 > CalcDayltgCoeffsMapPointsRWIN; // Center of a window element in absolute coordinate system
+		Vector3< Real64 > CalcDayltgCoeffsMapPointsRWIN2; // Center of a window element for TDD:DOME (if exists) in abs coord sys
+		Vector3< Real64 > CalcDayltgCoeffsMapPointsRay; // Unit vector along ray from reference point to window element
+		Vector3< Real64 > CalcDayltgCoeffsMapPointsW21; // Vector from window vertex 2 to window vertex 1
+		Vector3< Real64 > CalcDayltgCoeffsMapPointsW23; // Vector from window vertex 2 to window vertex 3
+		Vector3< Real64 > CalcDayltgCoeffsMapPointsU21; // Vector from window vertex 2 to window vertex 1 for TDD:DOME (if exists)
+		Vector3< Real64 > CalcDayltgCoeffsMapPointsU23; // Vector from window vertex 2 to window vertex 3 for TDD:DOME (if exists)
+		Vector3< Real64 > CalcDayltgCoeffsMapPointsWNORM2; // Unit vector normal to TDD:DOME (if exists)
+		Vector3< Real64 > CalcDayltgCoeffsMapPointsVIEWVC; // View vector in absolute coordinate system
+		Vector3< Real64 > CalcDayltgCoeffsMapPointsVIEWVC2; // Virtual view vector in absolute coordinate system
+		bool mapFirstTime( true );
+		bool CalcDayltgCoeffsMapPointsMySunIsUpFlag( false );
+		Vector3< Real64 > W1; // First vertex of window (where vertices are numbered
+		Vector3< Real64 > WC; // Center point of window
+		Vector3< Real64 > REFWC; // Vector from reference point to center of window
+		Vector3< Real64 > WNORM; // Unit vector normal to window (pointing away from room)
+		Vector3< Real64 > W2REF; // Vector from window origin to project of ref. pt. on window plane
+		Vector3< Real64 > REFD; // Vector from ref pt to center of win in TDD:DIFFUSER coord sys (if exists)
+		Vector3< Real64 > VIEWVD; // Virtual view vector in TDD:DIFFUSER coord sys (if exists)
+		Vector3< Real64 > U1; // First vertex of window for TDD:DOME (if exists)
+		Vector3< Real64 > U3; // Third vertex of window for TDD:DOME (if exists)
+		Vector3< Real64 > RayVector;
+		Vector3< Real64 > HitPtIntWin; // Intersection point on an interior window for ray from ref pt to ext win (m)
+		Vector3< Real64 > FigureDayltgCoeffsAtPointsForWindowElementsGroundHitPt; // Coordinates of point that ray hits ground (m)
+		Vector3< Real64 > URay; // Unit vector in (Phi,Theta) direction
+		Vector3< Real64 > ObsHitPt; // Coordinates of hit point on an obstruction (m)
+		Vector3< Real64 > FigureDayltgCoeffsAtPointsForWindowElementsRayVector;
+		Vector3< Real64 > InitializeCFSDaylightingW1;
+		Vector3< Real64 > InitializeCFSDaylightingW2;
+		Vector3< Real64 > InitializeCFSDaylightingW3;
+		Vector3< Real64 > InitializeCFSDaylightingW21;
+		Vector3< Real64 > InitializeCFSDaylightingW23;
+		Vector3< Real64 > InitializeCFSDaylightingWNorm; // unit vector from window (point towards outside)
+		Vector3< Real64 > InitializeCFSDaylightingRay; // vector along ray from window to reference point
+		Vector3< Real64 > RayNorm; // unit vector along ray from window to reference point
+		Vector3< Real64 > InterPoint; // Intersection point
+		Vector3< Real64 > InitializeCFSStateDataRWin; // window element center point (same as centroid)
+		Vector3< Real64 > V; // vector array
+		Vector3< Real64 > InitializeCFSStateDataGroundHitPt; // Coordinates of point that ray hits ground (m)
+		Vector3< Real64 > CFSRefPointSolidAngleRay;
+		Vector3< Real64 > CFSRefPointSolidAngleRayNorm;
+		Vector3< Real64 > CFSRefPointSolidAngleV;
+		Vector3< Real64 > CFSRefPointPosFactorV;
+		Vector3< Real64 > CFSRefPointPosFactorInterPoint;
+		Vector3< Real64 > CalcObstrMultiplierURay; // Unit vector in (Phi,Theta) direction
+		Vector3< Real64 > CalcObstrMultiplierObsHitPt; // Coordinates of hit point on an obstruction (m)
+		int AltSteps_last( 0 );
+		Array1D< Real64 > cos_Phi( AltAngStepsForSolReflCalc / 2 ); // cos( Phi ) table
+		Array1D< Real64 > sin_Phi( AltAngStepsForSolReflCalc / 2 ); // sin( Phi ) table
+		int AzimSteps_last( 0 );
+		Array1D< Real64 > cos_Theta( 2 * AzimAngStepsForSolReflCalc ); // cos( Theta ) table
+		Array1D< Real64 > sin_Theta( 2 * AzimAngStepsForSolReflCalc ); // sin( Theta ) table
+		Vector4< Real64 > XEDIRSK; // Illuminance contribution from luminance element, sky-related
+		Vector4< Real64 > XAVWLSK; // Luminance of window element, sky-related
+		Vector3< Real64 > RAYCOS; // Unit vector from reference point to sun
+		Array1D< Real64 > TransBmBmMult( MaxSlatAngs ); // Beam-beam transmittance of isolated blind
+		Array1D< Real64 > TransBmBmMultRefl( MaxSlatAngs ); // As above but for beam reflected from exterior obstruction
+		Vector3< Real64 > HP; // Hit coordinates, if ray hits
+		Vector3< Real64 > FigureDayltgCoeffsAtPointsForSunPositionNearestHitPt; // Hit point of ray on nearest obstruction
+		Vector3< Real64 > FigureDayltgCoeffsAtPointsForSunPositionGroundHitPt; // Coordinates of point that ray hits ground (m)
+		Vector3< Real64 > FigureDayltgCoeffsAtPointsForSunPositionObsHitPt; // Coordinates of hit point on an obstruction (m)
+		Vector3< Real64 > ReflNorm; // Normal vector to reflecting surface
+		Vector3< Real64 > SunVecMir; // Sun ray mirrored in reflecting surface
+		Vector3< Real64 > HitPtRefl; // Point that ray hits reflecting surface
+		Vector3< Real64 > HitPtObs; // Hit point on obstruction
+		Vector3< Real64 > HitPtIntWinDisk; // Intersection point on an interior window for ray from ref pt to sun (m)
+		Real64 CosBldgRotAppGonly(0.0); // Cosine of the building rotation for appendix G only (relative north)
+		Real64 SinBldgRotAppGonly(0.0); // Sine of the building rotation for appendix G only (relative north)
+		bool CheckTDDsAndLightShelvesInDaylitZones_firstTime( true );
+		int const NTH( 18 ); // Number of azimuth steps for sky integration
+		int const NPH( 8 ); // Number of altitude steps for sky integration
+		Array1D< Real64 > PH( NPH ); // Altitude of sky element (radians)
+		Array1D< Real64 > TH( NTH ); // Azimuth of sky element (radians)
+		Array1D< Real64 > SPHCPH( NPH ); // Sine times cosine of altitude of sky element
+		bool DayltgExtHorizIllum_firstTime( true ); // flag for first time thru to initialize
+		Vector3< Real64 > DayltgHitObstructionHP; // Hit coordinates, if ray hits an obstruction
+		Vector3< Real64 > DayltgHitInteriorObstructionHP; // Hit coordinates, if ray hits an obstruction
+		Vector3< Real64 > DayltgHitInteriorObstructionRN; // Unit vector along ray
+		Vector3< Real64 > DayltgHitBetWinObstructionHP; // Hit coordinates, if ray hits an obstruction surface (m)
+		Vector3< Real64 > DayltgHitBetWinObstructionRN; // Unit vector along ray from R1 to R2
+		Vector2< Real64 > SetPnt; // Illuminance setpoint at reference points (lux)
+		Array2D< Real64 > DFSKHR( 2, 4 ); // Sky daylight factor for sky type (first index),
+		Vector2< Real64 > DFSUHR; // Sun daylight factor for bare/shaded window
+		Array2D< Real64 > BFSKHR( 2, 4 ); // Sky background luminance factor for sky type (first index),
+		Vector2< Real64 > BFSUHR; // Sun background luminance factor for bare/shaded window
+		Array2D< Real64 > SFSKHR( 2, 4 ); // Sky source luminance factor for sky type (first index),
+		Vector2< Real64 > SFSUHR; // Sun source luminance factor for bare/shaded window
+		Array2D< Real64 > WDAYIL( 2, 2 ); // Illuminance from window at reference point (first index)
+		Array2D< Real64 > WBACLU( 2, 2 ); // Background illuminance from window at reference point (first index)
+		Vector2< Real64 > RDAYIL; // Illuminance from window at reference point after closing shade
+		Vector2< Real64 > RBACLU; // Background illuminance from window at reference point after closing shade
+		Vector2< Real64 > GLRNDX; // Glare index at reference point
+		Vector2< Real64 > GLRNEW; // New glare index at reference point
+		Vector4< Real64 > HorIllSky; // Horizontal illuminance for different sky types
+		Real64 tmpSWSL1( 0.0 );
+		Real64 tmpSWSL2( 0.0 );
+		Real64 tmpSWFactor( 0.0 ); // new switching factor to meet glare criteria
+		Real64 tmpMult( 0.0 );
+		bool GlareOK( false );
+		Array3D< Real64 > tmpIllumFromWinAtRefPt;
+		Array3D< Real64 > tmpBackLumFromWinAtRefPt;
+		Array3D< Real64 > tmpSourceLumFromWinAtRefPt;
+		bool DayltgInteriorIllum_firstTime( true ); // true first time routine is called
+		bool blnCycle( false );
+		Vector4< Real64 > TDDTransVisDiff; // Weighted diffuse visible transmittance for each sky type
+		Array2D< Real64 > FLFWSK( MaxSlatAngs+1, 4 ); // Sky-related downgoing luminous flux
+		Array1D< Real64 > FLFWSU( MaxSlatAngs+1 ); // Sun-related downgoing luminous flux, excluding entering beam
+		Array1D< Real64 > FLFWSUdisk( MaxSlatAngs+1 ); // Sun-related downgoing luminous flux, due to entering beam
+		Array2D< Real64 > FLCWSK( MaxSlatAngs+1, 4 ); // Sky-related upgoing luminous flux
+		Array1D< Real64 > FLCWSU( MaxSlatAngs+1 ); // Sun-related upgoing luminous flux
+		Array1D< Real64 > TransMult( MaxSlatAngs ); // Transmittance multiplier
+		Array1D< Real64 > DayltgInterReflectedIllumTransBmBmMult( MaxSlatAngs ); // Isolated blind beam-beam transmittance
+		Vector4< Real64 > ZSK; // Sky-related and sun-related illuminance on window from sky/ground
+		Vector3< Real64 > U; // Unit vector in (PH,TH) direction
+		int const NPHMAX( 10 ); // Number of sky/ground integration steps in altitude
+		int const NTHMAX( 16 ); // Number of sky/ground integration steps in azimuth
+		Array2D< Real64 > ObTransM( NPHMAX, NTHMAX ); // ObTrans value for each (TH,PH) direction
+		Vector3< Real64 > DayltgInterReflectedIllumNearestHitPt; // Hit point of ray on nearest obstruction (m)
+		Array2D< Real64 > DayltgInterReflectedIllumSkyObstructionMult( NPHMAX, NTHMAX ); // Ratio of obstructed to unobstructed sky diffuse at
+		Vector3< Real64 > DayltgInterReflectedIllumGroundHitPt; // Coordinates of point that ray from window center hits the ground (m)
+		Vector3< Real64 > DayltgInterReflectedIllumObsHitPt; // Coordinates of hit point on an obstruction (m)
+		Vector3< Real64 > DayltgInterReflectedIllumURay; // Unit vector in (Phi,Theta) direction
+		Vector3< Real64 > ComplexFenestrationLuminancesObsHitPt; // Coordinates of hit point on an obstruction (m)
+		Vector3< Real64 > ComplexFenestrationLuminancesGroundHitPt; // Coordinates of point that ray from window center hits the ground (m)
+		Vector4< Real64 > FFSKTot;
+		Vector4< Real64 > WinLumSK; // Sky related window luminance
+		Vector4< Real64 > EDirSky; // Sky related direct illuminance
+		Vector3< Real64 > DayltgDirectSunDiskComplexFenestrationV; // temporary vector
+		Vector3< Real64 > DayltgDirectSunDiskComplexFenestrationRWin; // Window center
+		Vector3< Real64 > WinNorm; // Window outward normal unit vector
+		Vector3< Real64 > SunPrime; // Projection of sun vector onto plane (perpendicular to
+		Vector3< Real64 > WinNormCrossBase; // Cross product of WinNorm and vector along window baseline
+		Vector3< Real64 > HitPt; // Hit point on an obstruction (m)
+		Vector3< Real64 > DayltgSurfaceLumFromSunReflNorm; // Unit normal to reflecting surface (m)
+		Vector3< Real64 > DayltgSurfaceLumFromSunObsHitPt; // Hit point on obstruction (m)
+		Array1D< Real64 > daylight_illum;
+		Array2D< Real64 > DayltgInteriorMapIllumDFSKHR( 2, 4 ); // Sky daylight factor for sky type (first index),
+		Vector2< Real64 > DayltgInteriorMapIllumDFSUHR; // Sun daylight factor for bare/shaded window
+		Array2D< Real64 > DayltgInteriorMapIllumBFSKHR( 2, 4 ); // Sky background luminance factor for sky type (first index),
+		Vector2< Real64 > DayltgInteriorMapIllumBFSUHR; // Sun background luminance factor for bare/shaded window
+		Array2D< Real64 > DayltgInteriorMapIllumSFSKHR( 2, 4 ); // Sky source luminance factor for sky type (first index),
+		Vector2< Real64 > DayltgInteriorMapIllumSFSUHR; // Sun source luminance factor for bare/shaded window
+		Vector4< Real64 > DayltgInteriorMapIllumHorIllSky; // Horizontal illuminance for different sky types
+		Array1D< Real64 > BACLUM;
+		Array1D< Real64 > DayltgInteriorMapIllumGLRNDX;
+		bool FirstTimeFlag( true );
+		Real64 VTDark( 0.0 ); // Visible transmittance (VT) of electrochromic (EC) windows in fully dark state
+		Real64 VTMULT( 1.0 ); // VT multiplier for EC windows
+		int IConstShaded( 0 ); // The shaded window construction for switchable windows
+		bool ReportIllumMap_firstTime( true );
+		Array1D_bool FirstTimeMaps;
+		Array1D_bool EnvrnPrint;
+		Array1D_string SavedMnDy;
+		Array2D_string RefPts;
+		Array1D< Real64 > XValue;
+		Array1D< Real64 > YValue;
+		Array2D< Real64 > IllumValue;
+		bool SQFirstTime( true );
+		int MapOutputFile;
+		int ios( 0 );
+		Vector3< Real64 > CalcMinIntWinSolidAngsW1; // Window vertices
+		Vector3< Real64 > CalcMinIntWinSolidAngsW2;
+		Vector3< Real64 > CalcMinIntWinSolidAngsW3;
+		Vector3< Real64 > CalcMinIntWinSolidAngsWC; // Center point of window
+		Vector3< Real64 > CalcMinIntWinSolidAngsW21; // Unit vectors from window vertex 2 to 1 and 2 to 3
+		Vector3< Real64 > CalcMinIntWinSolidAngsW23;
+		Vector3< Real64 > CalcMinIntWinSolidAngsRREF; // Location of a reference point in absolute coordinate system
+		Vector3< Real64 > CalcMinIntWinSolidAngsRay; // Unit vector along ray from reference point to window center
+		Vector3< Real64 > CalcMinIntWinSolidAngsREFWC; // Vector from reference point to center of window
+		Vector3< Real64 > CalcMinIntWinSolidAngsWNORM; // Unit vector normal to window (pointing away from room)
+		Array1D_string cAlphas( 1 );
+		Array1D< Real64 > rNumerics;
+	}
+
 	// Functions
 
+	// Clears the global data in DaylightingManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		TotWindowsWithDayl = 0;
+		OutputFileDFS = 0;
+		DaylIllum = Array1D< Real64 >( MaxRefPoints, 0.0 );
+		PHSUN = 0.0;
+		SPHSUN = 0.0;
+		CPHSUN = 0.0;
+		THSUN = 0.0;
+		PHSUNHR = Array1D< Real64 >( 24, 0.0 );
+		SPHSUNHR = Array1D< Real64 >( 24, 0.0 );
+		CPHSUNHR = Array1D< Real64 >( 24, 0.0 );
+		THSUNHR = Array1D< Real64 >( 24, 0.0 );
+		EINTSK = Array3D< Real64 >( 24, MaxSlatAngs+1, 4, 0.0 );
+		EINTSU = Array2D< Real64 >( 24, MaxSlatAngs+1, 0.0 );
+		EINTSUdisk = Array2D< Real64 >( 24, MaxSlatAngs+1, 0.0 );
+		WLUMSK = Array3D< Real64 >( 24, MaxSlatAngs+1, 4, 0.0 );
+		WLUMSU = Array2D< Real64 >( 24, MaxSlatAngs+1, 0.0 );
+		WLUMSUdisk = Array2D< Real64 >( 24, MaxSlatAngs+1, 0.0 );
+		GILSK = Array2D< Real64 >( 24, 4, 0.0 );
+		GILSU = Array1D< Real64 >( 24, 0.0 );
+		EDIRSK = Array3D< Real64 >( 24, MaxSlatAngs+1, 4 );
+		EDIRSU = Array2D< Real64 >( 24, MaxSlatAngs+1 );
+		EDIRSUdisk = Array2D< Real64 >( 24, MaxSlatAngs+1 );
+		AVWLSK = Array3D< Real64 >( 24, MaxSlatAngs+1, 4 );
+		AVWLSU = Array2D< Real64 >( 24, MaxSlatAngs+1 );
+		AVWLSUdisk = Array2D< Real64 >( 24, MaxSlatAngs+1 );
+		TDDTransVisBeam.deallocate();
+		TDDFluxInc.deallocate();
+		TDDFluxTrans.deallocate();
+		MapErrIndex.deallocate();
+		RefErrIndex.deallocate();
+		CheckTDDZone.deallocate();
+		mapLine.clear();
+		AR = 0.0;
+		ARH = 0.0;
+		AP = 0.0;
+		ARHP = 0.0;
+		firstTime = true;
+		FirstTimeDaylFacCalc = true;
+		CreateDFSReportFile = true;
+		doSkyReporting = true;
+		VeryFirstTime = true;
+		CalcDayltgCoeffsRefPointsW2 = 0.0;
+		CalcDayltgCoeffsRefPointsW3 = 0.0;
+		CalcDayltgCoeffsRefPointsW21 = 0.0;
+		CalcDayltgCoeffsRefPointsW23 = 0.0;
+		CalcDayltgCoeffsRefPointsRREF = 0.0;
+		CalcDayltgCoeffsRefPointsRREF2 = 0.0;
+		CalcDayltgCoeffsRefPointsRWIN = 0.0;
+		CalcDayltgCoeffsRefPointsRWIN2 = 0.0;
+		CalcDayltgCoeffsRefPointsRay = 0.0;
+		CalcDayltgCoeffsRefPointsWNORM2 = 0.0;
+		CalcDayltgCoeffsRefPointsVIEWVC = 0.0;
+		CalcDayltgCoeffsRefPointsU2 = 0.0;
+		CalcDayltgCoeffsRefPointsU21 = 0.0;
+		CalcDayltgCoeffsRefPointsU23 = 0.0;
+		CalcDayltgCoeffsRefPointsVIEWVC2 = 0.0;
+		refFirstTime = true;
+		MySunIsUpFlag = false;
+		CalcDayltgCoeffsMapPointsW2 = 0.0;
+		CalcDayltgCoeffsMapPointsW3 = 0.0;
+		CalcDayltgCoeffsMapPointsU2 = 0.0;
+		CalcDayltgCoeffsMapPointsRREF = 0.0;
+		CalcDayltgCoeffsMapPointsRREF2 = 0.0;
+		CalcDayltgCoeffsMapPointsRWIN = 0.0;
+		CalcDayltgCoeffsMapPointsRWIN2 = 0.0;
+		CalcDayltgCoeffsMapPointsRay = 0.0;
+		CalcDayltgCoeffsMapPointsW21 = 0.0;
+		CalcDayltgCoeffsMapPointsW23 = 0.0;
+		CalcDayltgCoeffsMapPointsU21 = 0.0;
+		CalcDayltgCoeffsMapPointsU23 = 0.0;
+		CalcDayltgCoeffsMapPointsWNORM2 = 0.0;
+		CalcDayltgCoeffsMapPointsVIEWVC = 0.0;
+		CalcDayltgCoeffsMapPointsVIEWVC2 = 0.0;
+		mapFirstTime = true;
+		CalcDayltgCoeffsMapPointsMySunIsUpFlag = false;
+		W1 = 0.0;
+		WC = 0.0;
+		REFWC = 0.0;
+		WNORM = 0.0;
+		W2REF = 0.0;
+		REFD = 0.0;
+		VIEWVD = 0.0;
+		U1 = 0.0;
+		U3 = 0.0;
+		RayVector = 0.0;
+		HitPtIntWin = 0.0;
+		FigureDayltgCoeffsAtPointsForWindowElementsGroundHitPt = 0.0;
+		URay = 0.0;
+		ObsHitPt = 0.0;
+		FigureDayltgCoeffsAtPointsForWindowElementsRayVector = 0.0;
+		InitializeCFSDaylightingW1 = 0.0;
+		InitializeCFSDaylightingW2 = 0.0;
+		InitializeCFSDaylightingW3 = 0.0;
+		InitializeCFSDaylightingW21 = 0.0;
+		InitializeCFSDaylightingW23 = 0.0;
+		InitializeCFSDaylightingWNorm = 0.0;
+		InitializeCFSDaylightingRay = 0.0;
+		RayNorm = 0.0;
+		InterPoint = 0.0;
+		InitializeCFSStateDataRWin = 0.0;
+		V = 0.0;
+		InitializeCFSStateDataGroundHitPt = 0.0;
+		CFSRefPointSolidAngleRay = 0.0;
+		CFSRefPointSolidAngleRayNorm = 0.0;
+		CFSRefPointSolidAngleV = 0.0;
+		CFSRefPointPosFactorV = 0.0;
+		CFSRefPointPosFactorInterPoint = 0.0;
+		CalcObstrMultiplierURay = 0.0;
+		CalcObstrMultiplierObsHitPt = 0.0;
+		AltSteps_last = 0;
+		cos_Phi = Array1D< Real64 >( AltAngStepsForSolReflCalc / 2 );
+		sin_Phi = Array1D< Real64 >( AltAngStepsForSolReflCalc / 2 );
+		AzimSteps_last = 0;
+		cos_Theta = Array1D< Real64 >( 2 * AzimAngStepsForSolReflCalc );
+		sin_Theta = Array1D< Real64 >( 2 * AzimAngStepsForSolReflCalc );
+		XEDIRSK = 0.0;
+		XAVWLSK = 0.0;
+		RAYCOS = 0.0;
+		TransBmBmMult = Array1D< Real64 >( MaxSlatAngs );
+		TransBmBmMultRefl = Array1D< Real64 >( MaxSlatAngs );
+		HP = 0.0;
+		FigureDayltgCoeffsAtPointsForSunPositionNearestHitPt = 0.0;
+		FigureDayltgCoeffsAtPointsForSunPositionGroundHitPt = 0.0;
+		FigureDayltgCoeffsAtPointsForSunPositionObsHitPt = 0.0;
+		ReflNorm = 0.0;
+		SunVecMir = 0.0;
+		HitPtRefl = 0.0;
+		HitPtObs = 0.0;
+		HitPtIntWinDisk = 0.0;
+		CosBldgRotAppGonly = 0.0;
+		SinBldgRotAppGonly = 0.0;
+		CheckTDDsAndLightShelvesInDaylitZones_firstTime = true;
+		PH = Array1D< Real64 >( NPH );
+		TH = Array1D< Real64 >( NTH );
+		SPHCPH = Array1D< Real64 >( NPH );
+		DayltgExtHorizIllum_firstTime = true;
+		DayltgHitObstructionHP = 0.0;
+		DayltgHitInteriorObstructionHP = 0.0;
+		DayltgHitInteriorObstructionRN = 0.0;
+		DayltgHitBetWinObstructionHP = 0.0;
+		DayltgHitBetWinObstructionRN = 0.0;
+		SetPnt = 0.0;
+		DFSKHR = Array2D< Real64 >( 2, 4 );
+		DFSUHR = 0.0;
+		BFSKHR = Array2D< Real64 >( 2, 4 );
+		BFSUHR = 0.0;
+		SFSKHR = Array2D< Real64 >( 2, 4 );
+		SFSUHR = 0.0;
+		WDAYIL = Array2D< Real64 >( 2, 2 );
+		WBACLU = Array2D< Real64 >( 2, 2 );
+		RDAYIL = 0.0;
+		RBACLU = 0.0;
+		GLRNDX = 0.0;
+		GLRNEW = 0.0;
+		HorIllSky = 0.0;
+		tmpSWSL1 = 0.0;
+		tmpSWSL2 = 0.0;
+		tmpSWFactor = 0.0;
+		tmpMult = 0.0;
+		GlareOK = false;
+		tmpIllumFromWinAtRefPt.deallocate();
+		tmpBackLumFromWinAtRefPt.deallocate();
+		tmpSourceLumFromWinAtRefPt.deallocate();
+		DayltgInteriorIllum_firstTime = true;
+		blnCycle = false;
+		TDDTransVisDiff = 0.0;
+		FLFWSK = Array2D< Real64 >( MaxSlatAngs+1, 4 );
+		FLFWSU = Array1D< Real64 >( MaxSlatAngs+1 );
+		FLFWSUdisk = Array1D< Real64 >( MaxSlatAngs+1 );
+		FLCWSK = Array2D< Real64 >( MaxSlatAngs+1, 4 );
+		FLCWSU = Array1D< Real64 >( MaxSlatAngs+1 );
+		TransMult = Array1D< Real64 >( MaxSlatAngs );
+		DayltgInterReflectedIllumTransBmBmMult = Array1D< Real64 >( MaxSlatAngs );
+		ZSK = 0.0;
+		U = 0.0;
+		ObTransM = Array2D< Real64 >( NPHMAX, NTHMAX );
+		DayltgInterReflectedIllumNearestHitPt = 0.0;
+		DayltgInterReflectedIllumSkyObstructionMult = Array2D< Real64 >( NPHMAX, NTHMAX );
+		DayltgInterReflectedIllumGroundHitPt = 0.0;
+		DayltgInterReflectedIllumObsHitPt = 0.0;
+		DayltgInterReflectedIllumURay = 0.0;
+		ComplexFenestrationLuminancesObsHitPt = 0.0;
+		ComplexFenestrationLuminancesGroundHitPt = 0.0;
+		FFSKTot = 0.0;
+		WinLumSK = 0.0;
+		EDirSky = 0.0;
+		DayltgDirectSunDiskComplexFenestrationV = 0.0;
+		DayltgDirectSunDiskComplexFenestrationRWin = 0.0;
+		WinNorm = 0.0;
+		SunPrime = 0.0;
+		WinNormCrossBase = 0.0;
+		HitPt = 0.0;
+		DayltgSurfaceLumFromSunReflNorm = 0.0;
+		DayltgSurfaceLumFromSunObsHitPt = 0.0;
+		daylight_illum.deallocate();
+		DayltgInteriorMapIllumDFSKHR = Array2D< Real64 >( 2, 4 );
+		DayltgInteriorMapIllumDFSUHR = 0.0;
+		DayltgInteriorMapIllumBFSKHR = Array2D< Real64 >( 2, 4 );
+		DayltgInteriorMapIllumBFSUHR = 0.0;
+		DayltgInteriorMapIllumSFSKHR = Array2D< Real64 >( 2, 4 );
+		DayltgInteriorMapIllumSFSUHR = 0.0;
+		DayltgInteriorMapIllumHorIllSky = 0.0;
+		BACLUM.deallocate();
+		DayltgInteriorMapIllumGLRNDX.deallocate();
+		FirstTimeFlag = true;
+		VTDark = 0.0;
+		VTMULT = 1.0;
+		IConstShaded = 0;
+		ReportIllumMap_firstTime = true;
+		FirstTimeMaps.deallocate();
+		EnvrnPrint.deallocate();
+		SavedMnDy.deallocate();
+		RefPts.deallocate();
+		XValue.deallocate();
+		YValue.deallocate();
+		IllumValue.deallocate();
+		SQFirstTime = true;
+		MapOutputFile = 0;
+		ios = 0;
+		CalcMinIntWinSolidAngsW1 = 0.0;
+		CalcMinIntWinSolidAngsW2 = 0.0;
+		CalcMinIntWinSolidAngsW3 = 0.0;
+		CalcMinIntWinSolidAngsWC = 0.0;
+		CalcMinIntWinSolidAngsW21 = 0.0;
+		CalcMinIntWinSolidAngsW23 = 0.0;
+		CalcMinIntWinSolidAngsRREF = 0.0;
+		CalcMinIntWinSolidAngsRay = 0.0;
+		CalcMinIntWinSolidAngsREFWC = 0.0;
+		CalcMinIntWinSolidAngsWNORM = 0.0;
+		cAlphas = Array1D_string( 1 );
+		rNumerics.deallocate();
+	}
+
 	void
 	DayltgAveInteriorReflectance( int & ZoneNum ) // Zone number
 	{
@@ -296,11 +745,7 @@ namespace DaylightingManager {
 		int IWin; // Window number
 		int ITILT; // Surface tilt category (1 = floor, 2 = wall, 3 = ceiling)
 		int IT; // Tilt index
-		static Vector3< Real64 > AR; // Inside surface area sum for floor/wall/ceiling (m2)
-		static Vector3< Real64 > ARH; // Inside surface area*reflectance sum for floor/wall/ceiling (m2)
-		static Vector3< Real64 > AP; // Zone inside surface floor/wall/ceiling area without a selected
 		//  floor/wall/ceiling (m2)
-		static Vector3< Real64 > ARHP; // Zone inside surface floor/wall/ceiling area*reflectance without
 		//  a selected floor/wall/ceiling (m2)
 		Real64 ATWL; // Opaque surface area (m2)
 		Real64 ARHTWL; // ATWL times inside visible reflectance of surface (m2)
@@ -513,8 +958,6 @@ namespace DaylightingManager {
 		int IHR; // Hour of day counter
 		int IWin; // Window counter
 		int loop; // DO loop indices
-		static bool firstTime( true );
-		static bool FirstTimeDaylFacCalc( true );
 		Real64 DaylFac1; // sky daylight factor at ref pt 1
 		Real64 DaylFac2; // sky daylight factor at ref pt 2
 
@@ -533,8 +976,6 @@ namespace DaylightingManager {
 		int ICtrl;
 		int ISlatAngle;
 
-		static bool CreateDFSReportFile( true );
-		static bool doSkyReporting( true );
 
 		// Formats
 		static gio::Fmt Format_700( "('! <Sky Daylight Factors>, MonthAndDay, Zone Name, Window Name, Daylight Fac: Ref Pt #1, Daylight Fac: Ref Pt #2')" );
@@ -882,7 +1323,6 @@ namespace DaylightingManager {
 		int IWin; // Window counter
 		int PipeNum; // TDD pipe object number
 		int loopwin; // loop index for exterior windows associated with a daylit zone
-		static bool VeryFirstTime( true );
 		int TZoneNum;
 		bool ErrorsFound;
 		int MapNum;
@@ -972,23 +1412,8 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static Vector3< Real64 > W2; // Second vertex of window
-		static Vector3< Real64 > W3; // Third vertex of window
-		static Vector3< Real64 > W21; // Vector from window vertex 2 to window vertex 1
-		static Vector3< Real64 > W23; // Vector from window vertex 2 to window vertex 3
-		static Vector3< Real64 > RREF; // Location of a reference point in absolute coordinate system
-		static Vector3< Real64 > RREF2; // Location of virtual reference point in absolute coordinate system
-		static Vector3< Real64 > RWIN; // Center of a window element in absolute coordinate system
-		static Vector3< Real64 > RWIN2; // Center of a window element for TDD:DOME (if exists) in abs coord sys
-		static Vector3< Real64 > Ray; // Unit vector along ray from reference point to window element
-		static Vector3< Real64 > WNORM2; // Unit vector normal to TDD:DOME (if exists)
-		static Vector3< Real64 > VIEWVC; // View vector in absolute coordinate system
-		static Vector3< Real64 > U2; // Second vertex of window for TDD:DOME (if exists)
-		static Vector3< Real64 > U21; // Vector from window vertex 2 to window vertex 1 for TDD:DOME (if exists)
-		static Vector3< Real64 > U23; // Vector from window vertex 2 to window vertex 3 for TDD:DOME (if exists)
 //		static Vector2< Real64 > ZF; // Fraction of zone controlled by each reference point //Unused
 
-		static Vector3< Real64 > VIEWVC2; // Virtual view vector in absolute coordinate system
 		int IHR; // Hour of day counter
 		int NRF; // Number of daylighting reference points in a zone
 		int IL; // Reference point counter
@@ -1027,14 +1452,12 @@ namespace DaylightingManager {
 		Real64 DAXY; // Area of window element
 		Real64 SkyObstructionMult; // Ratio of obstructed to unobstructed sky diffuse at a ground point
 		int ExtWinType; // Exterior window type (InZoneExtWin, AdjZoneExtWin, NotInOrAdjZoneExtWin)
-		static bool refFirstTime( true );
 		int BRef;
 		int ILB;
 		bool hitIntObs; // True iff interior obstruction hit
 		bool hitExtObs; // True iff ray from ref pt to ext win hits an exterior obstruction
 		Real64 TVISIntWin; // Visible transmittance of int win at COSBIntWin for light from ext win
 		Real64 TVISIntWinDisk; // Visible transmittance of int win at COSBIntWin for sun
-		static bool MySunIsUpFlag( false );
 
 		int WinEl; // Current window element
 
@@ -1047,9 +1470,9 @@ namespace DaylightingManager {
 		// Azimuth of view vector in absolute coord sys
 		AZVIEW = ( ZoneDaylight( ZoneNum ).ViewAzimuthForGlare + Zone( ZoneNum ).RelNorth + BuildingAzimuth + BuildingRotationAppendixG ) * DegToRadians;
 		// View vector components in absolute coord sys
-		VIEWVC( 1 ) = std::sin( AZVIEW );
-		VIEWVC( 2 ) = std::cos( AZVIEW );
-		VIEWVC( 3 ) = 0.0;
+		CalcDayltgCoeffsRefPointsVIEWVC( 1 ) = std::sin( AZVIEW );
+		CalcDayltgCoeffsRefPointsVIEWVC( 2 ) = std::cos( AZVIEW );
+		CalcDayltgCoeffsRefPointsVIEWVC( 3 ) = 0.0;
 
 		ZoneDaylight( ZoneNum ).DaylIllumAtRefPt = 0.0; // Daylight illuminance at reference points (lux)
 		ZoneDaylight( ZoneNum ).GlareIndexAtRefPt = 0.0; // Glare index at reference points
@@ -1088,14 +1511,14 @@ namespace DaylightingManager {
 
 		for ( IL = 1; IL <= NRF; ++IL ) {
 			// Reference point in absolute coordinate system
-			RREF = ZoneDaylight( ZoneNum ).DaylRefPtAbsCoord( {1,3}, IL ); // (x, y, z)
+			CalcDayltgCoeffsRefPointsRREF = ZoneDaylight( ZoneNum ).DaylRefPtAbsCoord( {1,3}, IL ); // (x, y, z)
 
 			//           -------------
 			// ---------- WINDOW LOOP ----------
 			//           -------------
 			for ( loopwin = 1; loopwin <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loopwin ) {
 
-				FigureDayltgCoeffsAtPointsSetupForWindow( ZoneNum, IL, loopwin, CalledForRefPoint, RREF, VIEWVC, IWin, IWin2, NWX, NWY, W2, W3, W21, W23, LSHCAL, InShelfSurf, ICtrl, ShType, BlNum, WNORM2, ExtWinType, IConst, RREF2, DWX, DWY, DAXY, U2, U23, U21, VIEWVC2, is_Rectangle, is_Triangle );
+				FigureDayltgCoeffsAtPointsSetupForWindow( ZoneNum, IL, loopwin, CalledForRefPoint, CalcDayltgCoeffsRefPointsRREF, CalcDayltgCoeffsRefPointsVIEWVC, IWin, IWin2, NWX, NWY, CalcDayltgCoeffsRefPointsW2, CalcDayltgCoeffsRefPointsW3, CalcDayltgCoeffsRefPointsW21, CalcDayltgCoeffsRefPointsW23, LSHCAL, InShelfSurf, ICtrl, ShType, BlNum, CalcDayltgCoeffsRefPointsWNORM2, ExtWinType, IConst, CalcDayltgCoeffsRefPointsRREF2, DWX, DWY, DAXY, CalcDayltgCoeffsRefPointsU2, CalcDayltgCoeffsRefPointsU23, CalcDayltgCoeffsRefPointsU21, CalcDayltgCoeffsRefPointsVIEWVC2, is_Rectangle, is_Triangle );
 				//           ---------------------
 				// ---------- WINDOW ELEMENT LOOP ----------
 				//           ---------------------
@@ -1113,7 +1536,7 @@ namespace DaylightingManager {
 
 						++WinEl;
 
-						FigureDayltgCoeffsAtPointsForWindowElements( ZoneNum, IL, loopwin, CalledForRefPoint, WinEl, IWin, IWin2, IX, IY, SkyObstructionMult, W2, W21, W23, RREF, NWYlim, VIEWVC2, DWX, DWY, DAXY, U2, U23, U21, RWIN, RWIN2, Ray, PHRAY, LSHCAL, COSB, ObTrans, TVISB, DOMEGA, THRAY, hitIntObs, hitExtObs, WNORM2, ExtWinType, IConst, RREF2, is_Triangle, TVISIntWin, TVISIntWinDisk );
+						FigureDayltgCoeffsAtPointsForWindowElements( ZoneNum, IL, loopwin, CalledForRefPoint, WinEl, IWin, IWin2, IX, IY, SkyObstructionMult, CalcDayltgCoeffsRefPointsW2, CalcDayltgCoeffsRefPointsW21, CalcDayltgCoeffsRefPointsW23, CalcDayltgCoeffsRefPointsRREF, NWYlim, CalcDayltgCoeffsRefPointsVIEWVC2, DWX, DWY, DAXY, CalcDayltgCoeffsRefPointsU2, CalcDayltgCoeffsRefPointsU23, CalcDayltgCoeffsRefPointsU21, CalcDayltgCoeffsRefPointsRWIN, CalcDayltgCoeffsRefPointsRWIN2, CalcDayltgCoeffsRefPointsRay, PHRAY, LSHCAL, COSB, ObTrans, TVISB, DOMEGA, THRAY, hitIntObs, hitExtObs, CalcDayltgCoeffsRefPointsWNORM2, ExtWinType, IConst, CalcDayltgCoeffsRefPointsRREF2, is_Triangle, TVISIntWin, TVISIntWinDisk );
 
 						//           -------------------
 						// ---------- SUN POSITION LOOP ----------
@@ -1126,7 +1549,7 @@ namespace DaylightingManager {
 							ISunPos = 0;
 							for ( IHR = 1; IHR <= 24; ++IHR ) {
 
-								FigureDayltgCoeffsAtPointsForSunPosition( ZoneNum, IL, IX, NWX, IY, NWYlim, WinEl, IWin, IWin2, IHR, ISunPos, SkyObstructionMult, RWIN2, Ray, PHRAY, LSHCAL, InShelfSurf, COSB, ObTrans, TVISB, DOMEGA, ICtrl, ShType, BlNum, THRAY, WNORM2, ExtWinType, IConst, AZVIEW, RREF2, hitIntObs, hitExtObs, CalledForRefPoint, TVISIntWin, TVISIntWinDisk );
+								FigureDayltgCoeffsAtPointsForSunPosition( ZoneNum, IL, IX, NWX, IY, NWYlim, WinEl, IWin, IWin2, IHR, ISunPos, SkyObstructionMult, CalcDayltgCoeffsRefPointsRWIN2, CalcDayltgCoeffsRefPointsRay, PHRAY, LSHCAL, InShelfSurf, COSB, ObTrans, TVISB, DOMEGA, ICtrl, ShType, BlNum, THRAY, CalcDayltgCoeffsRefPointsWNORM2, ExtWinType, IConst, AZVIEW, CalcDayltgCoeffsRefPointsRREF2, hitIntObs, hitExtObs, CalledForRefPoint, TVISIntWin, TVISIntWinDisk );
 
 							} // End of hourly sun position loop, IHR
 						} else { //timestep integrated
@@ -1142,7 +1565,7 @@ namespace DaylightingManager {
 								ISunPos = -1;
 							}
 
-							FigureDayltgCoeffsAtPointsForSunPosition( ZoneNum, IL, IX, NWX, IY, NWYlim, WinEl, IWin, IWin2, HourOfDay, ISunPos, SkyObstructionMult, RWIN2, Ray, PHRAY, LSHCAL, InShelfSurf, COSB, ObTrans, TVISB, DOMEGA, ICtrl, ShType, BlNum, THRAY, WNORM2, ExtWinType, IConst, AZVIEW, RREF2, hitIntObs, hitExtObs, CalledForRefPoint, TVISIntWin, TVISIntWinDisk );
+							FigureDayltgCoeffsAtPointsForSunPosition( ZoneNum, IL, IX, NWX, IY, NWYlim, WinEl, IWin, IWin2, HourOfDay, ISunPos, SkyObstructionMult, CalcDayltgCoeffsRefPointsRWIN2, CalcDayltgCoeffsRefPointsRay, PHRAY, LSHCAL, InShelfSurf, COSB, ObTrans, TVISB, DOMEGA, ICtrl, ShType, BlNum, THRAY, CalcDayltgCoeffsRefPointsWNORM2, ExtWinType, IConst, AZVIEW, CalcDayltgCoeffsRefPointsRREF2, hitIntObs, hitExtObs, CalledForRefPoint, TVISIntWin, TVISIntWinDisk );
 						}
 
 					} // End of window Y-element loop, IY
@@ -1225,21 +1648,6 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static Vector3< Real64 > W2; // Second vertex of window
-		static Vector3< Real64 > W3; // Third vertex of window
-		static Vector3< Real64 > U2; // Second vertex of window for TDD:DOME (if exists)
-		static Vector3< Real64 > RREF; // Location of a reference point in absolute coordinate system
-		static Vector3< Real64 > RREF2; // Location of virtual reference point in absolute coordinate system
-		static Vector3< Real64 > RWIN; // Center of a window element in absolute coordinate system
-		static Vector3< Real64 > RWIN2; // Center of a window element for TDD:DOME (if exists) in abs coord sys
-		static Vector3< Real64 > Ray; // Unit vector along ray from reference point to window element
-		static Vector3< Real64 > W21; // Vector from window vertex 2 to window vertex 1
-		static Vector3< Real64 > W23; // Vector from window vertex 2 to window vertex 3
-		static Vector3< Real64 > U21; // Vector from window vertex 2 to window vertex 1 for TDD:DOME (if exists)
-		static Vector3< Real64 > U23; // Vector from window vertex 2 to window vertex 3 for TDD:DOME (if exists)
-		static Vector3< Real64 > WNORM2; // Unit vector normal to TDD:DOME (if exists)
-		static Vector3< Real64 > VIEWVC; // View vector in absolute coordinate system
-		static Vector3< Real64 > VIEWVC2; // Virtual view vector in absolute coordinate system
 //		static Vector2< Real64 > ZF; // Fraction of zone controlled by each reference point //Unused
 		//  In the following four variables, I=1 for clear sky, 2 for overcast.
 		int IHR; // Hour of day counter
@@ -1289,8 +1697,6 @@ namespace DaylightingManager {
 //		Array2D< Real64 > MapWindowSolidAngAtRefPt; //Inactive Only allocated and assigning to: Also only 1 value used at a time
 //		Array2D< Real64 > MapWindowSolidAngAtRefPtWtd; // Only 1 value used at a time: Replaced by below
 		Real64 MapWindowSolidAngAtRefPtWtd;
-		static bool mapFirstTime( true );
-		static bool MySunIsUpFlag( false );
 		int WinEl; // window elements counter
 
 		if ( mapFirstTime && TotIllumMaps > 0 ) {
@@ -1305,9 +1711,9 @@ namespace DaylightingManager {
 		// Azimuth of view vector in absolute coord sys
 		AZVIEW = ( ZoneDaylight( ZoneNum ).ViewAzimuthForGlare + Zone( ZoneNum ).RelNorth + BuildingAzimuth + BuildingRotationAppendixG ) * DegToRadians;
 		// View vector components in absolute coord sys
-		VIEWVC( 1 ) = std::sin( AZVIEW );
-		VIEWVC( 2 ) = std::cos( AZVIEW );
-		VIEWVC( 3 ) = 0.0;
+		CalcDayltgCoeffsMapPointsVIEWVC( 1 ) = std::sin( AZVIEW );
+		CalcDayltgCoeffsMapPointsVIEWVC( 2 ) = std::cos( AZVIEW );
+		CalcDayltgCoeffsMapPointsVIEWVC( 3 ) = 0.0;
 
 		for ( MapNum = 1; MapNum <= TotIllumMaps; ++MapNum ) {
 
@@ -1348,7 +1754,7 @@ namespace DaylightingManager {
 
 			for ( IL = 1; IL <= NRF; ++IL ) {
 
-				RREF = IllumMapCalc( MapNum ).MapRefPtAbsCoord( {1,3}, IL ); // (x, y, z)
+				CalcDayltgCoeffsMapPointsRREF = IllumMapCalc( MapNum ).MapRefPtAbsCoord( {1,3}, IL ); // (x, y, z)
 
 				//           -------------
 				// ---------- WINDOW LOOP ----------
@@ -1359,7 +1765,7 @@ namespace DaylightingManager {
 
 				for ( loopwin = 1; loopwin <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loopwin ) {
 
-					FigureDayltgCoeffsAtPointsSetupForWindow( ZoneNum, IL, loopwin, CalledForMapPoint, RREF, VIEWVC, IWin, IWin2, NWX, NWY, W2, W3, W21, W23, LSHCAL, InShelfSurf, ICtrl, ShType, BlNum, WNORM2, ExtWinType, IConst, RREF2, DWX, DWY, DAXY, U2, U23, U21, VIEWVC2, is_Rectangle, is_Triangle, MapNum, MapWindowSolidAngAtRefPtWtd ); // Inactive MapWindowSolidAngAtRefPt arg removed
+					FigureDayltgCoeffsAtPointsSetupForWindow( ZoneNum, IL, loopwin, CalledForMapPoint, CalcDayltgCoeffsMapPointsRREF, CalcDayltgCoeffsMapPointsVIEWVC, IWin, IWin2, NWX, NWY, CalcDayltgCoeffsMapPointsW2, CalcDayltgCoeffsMapPointsW3, CalcDayltgCoeffsMapPointsW21, CalcDayltgCoeffsMapPointsW23, LSHCAL, InShelfSurf, ICtrl, ShType, BlNum, CalcDayltgCoeffsMapPointsWNORM2, ExtWinType, IConst, CalcDayltgCoeffsMapPointsRREF2, DWX, DWY, DAXY, CalcDayltgCoeffsMapPointsU2, CalcDayltgCoeffsMapPointsU23, CalcDayltgCoeffsMapPointsU21, CalcDayltgCoeffsMapPointsVIEWVC2, is_Rectangle, is_Triangle, MapNum, MapWindowSolidAngAtRefPtWtd ); // Inactive MapWindowSolidAngAtRefPt arg removed
 					//           ---------------------
 					// ---------- WINDOW ELEMENT LOOP ----------
 					//           ---------------------
@@ -1376,7 +1782,7 @@ namespace DaylightingManager {
 
 							++WinEl;
 
-							FigureDayltgCoeffsAtPointsForWindowElements( ZoneNum, IL, loopwin, CalledForMapPoint, WinEl, IWin, IWin2, IX, IY, SkyObstructionMult, W2, W21, W23, RREF, NWYlim, VIEWVC2, DWX, DWY, DAXY, U2, U23, U21, RWIN, RWIN2, Ray, PHRAY, LSHCAL, COSB, ObTrans, TVISB, DOMEGA, THRAY, hitIntObs, hitExtObs, WNORM2, ExtWinType, IConst, RREF2, is_Triangle, TVISIntWin, TVISIntWinDisk, MapNum, MapWindowSolidAngAtRefPtWtd ); // Inactive MapWindowSolidAngAtRefPt arg removed
+							FigureDayltgCoeffsAtPointsForWindowElements( ZoneNum, IL, loopwin, CalledForMapPoint, WinEl, IWin, IWin2, IX, IY, SkyObstructionMult, CalcDayltgCoeffsMapPointsW2, CalcDayltgCoeffsMapPointsW21, CalcDayltgCoeffsMapPointsW23, CalcDayltgCoeffsMapPointsRREF, NWYlim, CalcDayltgCoeffsMapPointsVIEWVC2, DWX, DWY, DAXY, CalcDayltgCoeffsMapPointsU2, CalcDayltgCoeffsMapPointsU23, CalcDayltgCoeffsMapPointsU21, CalcDayltgCoeffsMapPointsRWIN, CalcDayltgCoeffsMapPointsRWIN2, CalcDayltgCoeffsMapPointsRay, PHRAY, LSHCAL, COSB, ObTrans, TVISB, DOMEGA, THRAY, hitIntObs, hitExtObs, CalcDayltgCoeffsMapPointsWNORM2, ExtWinType, IConst, CalcDayltgCoeffsMapPointsRREF2, is_Triangle, TVISIntWin, TVISIntWinDisk, MapNum, MapWindowSolidAngAtRefPtWtd ); // Inactive MapWindowSolidAngAtRefPt arg removed
 							//           -------------------
 							// ---------- SUN POSITION LOOP ----------
 							//           -------------------
@@ -1386,21 +1792,21 @@ namespace DaylightingManager {
 							if ( ! DetailedSolarTimestepIntegration ) {
 								ISunPos = 0;
 								for ( IHR = 1; IHR <= 24; ++IHR ) {
-									FigureDayltgCoeffsAtPointsForSunPosition( ZoneNum, IL, IX, NWX, IY, NWYlim, WinEl, IWin, IWin2, IHR, ISunPos, SkyObstructionMult, RWIN2, Ray, PHRAY, LSHCAL, InShelfSurf, COSB, ObTrans, TVISB, DOMEGA, ICtrl, ShType, BlNum, THRAY, WNORM2, ExtWinType, IConst, AZVIEW, RREF2, hitIntObs, hitExtObs, CalledForMapPoint, TVISIntWin, TVISIntWinDisk, MapNum, MapWindowSolidAngAtRefPtWtd );
+									FigureDayltgCoeffsAtPointsForSunPosition( ZoneNum, IL, IX, NWX, IY, NWYlim, WinEl, IWin, IWin2, IHR, ISunPos, SkyObstructionMult, CalcDayltgCoeffsMapPointsRWIN2, CalcDayltgCoeffsMapPointsRay, PHRAY, LSHCAL, InShelfSurf, COSB, ObTrans, TVISB, DOMEGA, ICtrl, ShType, BlNum, THRAY, CalcDayltgCoeffsMapPointsWNORM2, ExtWinType, IConst, AZVIEW, CalcDayltgCoeffsMapPointsRREF2, hitIntObs, hitExtObs, CalledForMapPoint, TVISIntWin, TVISIntWinDisk, MapNum, MapWindowSolidAngAtRefPtWtd );
 								} // End of hourly sun position loop, IHR
 							} else {
-								if ( SunIsUp && ! MySunIsUpFlag ) {
+								if ( SunIsUp && ! CalcDayltgCoeffsMapPointsMySunIsUpFlag ) {
 									ISunPos = 0;
-									MySunIsUpFlag = true;
-								} else if ( SunIsUp && MySunIsUpFlag ) {
+									CalcDayltgCoeffsMapPointsMySunIsUpFlag = true;
+								} else if ( SunIsUp && CalcDayltgCoeffsMapPointsMySunIsUpFlag ) {
 									ISunPos = 1;
-								} else if ( ! SunIsUp && MySunIsUpFlag ) {
-									MySunIsUpFlag = false;
+								} else if ( ! SunIsUp && CalcDayltgCoeffsMapPointsMySunIsUpFlag ) {
+									CalcDayltgCoeffsMapPointsMySunIsUpFlag = false;
 									ISunPos = -1;
-								} else if ( ! SunIsUp && ! MySunIsUpFlag ) {
+								} else if ( ! SunIsUp && ! CalcDayltgCoeffsMapPointsMySunIsUpFlag ) {
 									ISunPos = -1;
 								}
-								FigureDayltgCoeffsAtPointsForSunPosition( ZoneNum, IL, IX, NWX, IY, NWYlim, WinEl, IWin, IWin2, HourOfDay, ISunPos, SkyObstructionMult, RWIN2, Ray, PHRAY, LSHCAL, InShelfSurf, COSB, ObTrans, TVISB, DOMEGA, ICtrl, ShType, BlNum, THRAY, WNORM2, ExtWinType, IConst, AZVIEW, RREF2, hitIntObs, hitExtObs, CalledForMapPoint, TVISIntWin, TVISIntWinDisk, MapNum, MapWindowSolidAngAtRefPtWtd );
+								FigureDayltgCoeffsAtPointsForSunPosition( ZoneNum, IL, IX, NWX, IY, NWYlim, WinEl, IWin, IWin2, HourOfDay, ISunPos, SkyObstructionMult, CalcDayltgCoeffsMapPointsRWIN2, CalcDayltgCoeffsMapPointsRay, PHRAY, LSHCAL, InShelfSurf, COSB, ObTrans, TVISB, DOMEGA, ICtrl, ShType, BlNum, THRAY, CalcDayltgCoeffsMapPointsWNORM2, ExtWinType, IConst, AZVIEW, CalcDayltgCoeffsMapPointsRREF2, hitIntObs, hitExtObs, CalledForMapPoint, TVISIntWin, TVISIntWinDisk, MapNum, MapWindowSolidAngAtRefPtWtd );
 
 							}
 						} // End of window Y-element loop, IY
@@ -1507,20 +1913,15 @@ namespace DaylightingManager {
 		int ZoneNumThisWin; // A window's zone number
 		int ShelfNum; // Daylighting shelf object number
 
-		static Vector3< Real64 > W1; // First vertex of window (where vertices are numbered
 		// counter-clockwise starting at upper left as viewed
 		// from inside of room
 		int IConstShaded; // Shaded construction counter
 //		int ScNum; // Window screen number //Unused Set but never used
 		Real64 WW; // Window width (m)
 		Real64 HW; // Window height (m)
-		static Vector3< Real64 > WC; // Center point of window
-		static Vector3< Real64 > REFWC; // Vector from reference point to center of window
-		static Vector3< Real64 > WNORM; // Unit vector normal to window (pointing away from room)
 		int NDIVX; // Number of window x divisions for daylighting calc
 		int NDIVY; // Number of window y divisions for daylighting calc
 		Real64 ALF; // Distance from reference point to window plane (m)
-		static Vector3< Real64 > W2REF; // Vector from window origin to project of ref. pt. on window plane
 		Real64 D1a; // Projection of vector from window origin to reference
 		//  on window X  axis (m)
 		Real64 D1b; // Projection of vector from window origin to reference
@@ -1529,10 +1930,6 @@ namespace DaylightingManager {
 		Real64 SolidAngMinIntWin; // Approx. smallest solid angle subtended by an int. window wrt ref pt
 		Real64 SolidAngRatio; // Ratio of SolidAngExtWin and SolidAngMinIntWin
 		int PipeNum; // TDD pipe object number
-		static Vector3< Real64 > REFD; // Vector from ref pt to center of win in TDD:DIFFUSER coord sys (if exists)
-		static Vector3< Real64 > VIEWVD; // Virtual view vector in TDD:DIFFUSER coord sys (if exists)
-		static Vector3< Real64 > U1; // First vertex of window for TDD:DOME (if exists)
-		static Vector3< Real64 > U3; // Third vertex of window for TDD:DOME (if exists)
 		Real64 SinCornerAng; // For triangle, sine of corner angle of window element
 
 		// Complex fenestration variables
@@ -1540,7 +1937,6 @@ namespace DaylightingManager {
 //		int NReflSurf; // Number of blocked beams for complex fenestration //Unused Set but never used
 		int NRefPts; // number of reference points
 //		int WinEl; // Current window element //Unused Set but never used
-		static Vector3< Real64 > RayVector;
 //		Real64 TransBeam; // Obstructions transmittance for incoming BSDF rays (temporary variable) //Unused Set but never used
 
 		// Complex fenestration variables
@@ -1967,7 +2363,6 @@ namespace DaylightingManager {
 		bool hitIntWin; // Ray from ref pt passes through interior window
 		int PipeNum; // TDD pipe object number
 		int IntWin; // Interior window surface index
-		static Vector3< Real64 > HitPtIntWin; // Intersection point on an interior window for ray from ref pt to ext win (m)
 		Real64 COSBIntWin; // Cos of angle between int win outward normal and ray betw ref pt and
 		//  exterior window element or between ref pt and sun
 
@@ -1975,16 +2370,12 @@ namespace DaylightingManager {
 		Real64 Beta; // Intermediate variable
 		Real64 HorDis; // Distance between ground hit point and proj'n of center
 		//  of window element onto ground (m)
-		static Vector3< Real64 > GroundHitPt; // Coordinates of point that ray hits ground (m)
-		static Vector3< Real64 > URay; // Unit vector in (Phi,Theta) direction
-		static Vector3< Real64 > ObsHitPt; // Coordinates of hit point on an obstruction (m)
 
 		// Local complex fenestration variables
 		int CplxFenState; // Current complex fenestration state
 		int NReflSurf; // Number of blocked beams for complex fenestration
 		int ICplxFen; // Complex fenestration counter
 		int RayIndex;
-		static Vector3< Real64 > RayVector;
 		Real64 TransBeam; // Obstructions transmittance for incoming BSDF rays (temporary variable)
 
 		++LSHCAL;
@@ -2162,9 +2553,9 @@ namespace DaylightingManager {
 						} else {
 							RayIndex = ComplexWind( IWin ).DaylghtGeom( CplxFenState ).IlluminanceMap( iRefPoint, MapNum ).RefSurfIndex( ICplxFen, WinEl );
 						}
-						RayVector = ComplexWind( IWin ).Geom( CplxFenState ).sInc( RayIndex );
+						FigureDayltgCoeffsAtPointsForWindowElementsRayVector = ComplexWind( IWin ).Geom( CplxFenState ).sInc( RayIndex );
 						// It will get product of all transmittances
-						DayltgHitObstruction( HourOfDay, IWin, RWIN, RayVector, TransBeam );
+						DayltgHitObstruction( HourOfDay, IWin, RWIN, FigureDayltgCoeffsAtPointsForWindowElementsRayVector, TransBeam );
 						// IF (TransBeam > 0.0d0) ObTrans = TransBeam
 						if ( CalledFrom == CalledForRefPoint ) {
 							ComplexWind( IWin ).DaylghtGeom( CplxFenState ).RefPoint( iRefPoint ).TransOutSurf( ICplxFen, WinEl ) = TransBeam;
@@ -2186,11 +2577,11 @@ namespace DaylightingManager {
 				Alfa = std::acos( -Ray( 3 ) );
 				Beta = std::atan2( Ray( 2 ), Ray( 1 ) );
 				HorDis = ( RWIN2( 3 ) - GroundLevelZ ) * std::tan( Alfa );
-				GroundHitPt( 3 ) = GroundLevelZ;
-				GroundHitPt( 1 ) = RWIN2( 1 ) + HorDis * std::cos( Beta );
-				GroundHitPt( 2 ) = RWIN2( 2 ) + HorDis * std::sin( Beta );
+				FigureDayltgCoeffsAtPointsForWindowElementsGroundHitPt( 3 ) = GroundLevelZ;
+				FigureDayltgCoeffsAtPointsForWindowElementsGroundHitPt( 1 ) = RWIN2( 1 ) + HorDis * std::cos( Beta );
+				FigureDayltgCoeffsAtPointsForWindowElementsGroundHitPt( 2 ) = RWIN2( 2 ) + HorDis * std::sin( Beta );
 
-				SkyObstructionMult = CalcObstrMultiplier( GroundHitPt, AltAngStepsForSolReflCalc, AzimAngStepsForSolReflCalc );
+				SkyObstructionMult = CalcObstrMultiplier( FigureDayltgCoeffsAtPointsForWindowElementsGroundHitPt, AltAngStepsForSolReflCalc, AzimAngStepsForSolReflCalc );
 			} // End of check if solar reflection calculation is in effect
 
 		} // End of check if COSB > 0
@@ -2240,11 +2631,6 @@ namespace DaylightingManager {
 		Real64 WinElArea; // Window element area
 
 		// window coordinates and vectors
-		static Vector3< Real64 > W1;
-		static Vector3< Real64 > W2;
-		static Vector3< Real64 > W3;
-		static Vector3< Real64 > W21;
-		static Vector3< Real64 > W23;
 
 		// window elements counters
 		// integer :: IX ! horizontal elements
@@ -2252,7 +2638,6 @@ namespace DaylightingManager {
 
 		// TYPE(Vector) :: HitPt ! surface hit point
 		// REAL(r64), dimension(3) :: RWin ! window element center point (same as centroid)
-		static Vector3< Real64 > WNorm; // unit vector from window (point towards outside)
 
 		//REAL(r64) :: DotProd     !Temporary variable for manipulating dot product .dot.
 		//REAL(r64) :: LeastHitDsq  ! dist^2 from window element center to hit point
@@ -2264,9 +2649,6 @@ namespace DaylightingManager {
 
 		// reference point variables
 		// REAL(r64), dimension(3) :: RefPoint ! reference point
-		static Vector3< Real64 > Ray; // vector along ray from window to reference point
-		static Vector3< Real64 > RayNorm; // unit vector along ray from window to reference point
-		static Vector3< Real64 > InterPoint; // Intersection point
 
 		// Position factor variables
 		Real64 AZVIEW; // Azimuth of view vector
@@ -2284,31 +2666,31 @@ namespace DaylightingManager {
 
 		// Perform necessary calculations for window coordinates and vectors.  This will be used to calculate centroids for
 		// each window element
-		W1 = 0.0;
-		W2 = 0.0;
-		W3 = 0.0;
+		InitializeCFSDaylightingW1 = 0.0;
+		InitializeCFSDaylightingW2 = 0.0;
+		InitializeCFSDaylightingW3 = 0.0;
 
 		if ( Surface( IWin ).Sides == 4 ) {
-			W3 = Surface( IWin ).Vertex( 2 );
-			W2 = Surface( IWin ).Vertex( 3 );
-			W1 = Surface( IWin ).Vertex( 4 );
+			InitializeCFSDaylightingW3 = Surface( IWin ).Vertex( 2 );
+			InitializeCFSDaylightingW2 = Surface( IWin ).Vertex( 3 );
+			InitializeCFSDaylightingW1 = Surface( IWin ).Vertex( 4 );
 		} else if ( Surface( IWin ).Sides == 3 ) {
-			W3 = Surface( IWin ).Vertex( 2 );
-			W2 = Surface( IWin ).Vertex( 3 );
-			W1 = Surface( IWin ).Vertex( 1 );
+			InitializeCFSDaylightingW3 = Surface( IWin ).Vertex( 2 );
+			InitializeCFSDaylightingW2 = Surface( IWin ).Vertex( 3 );
+			InitializeCFSDaylightingW1 = Surface( IWin ).Vertex( 1 );
 		}
 
-		W21 = W1 - W2;
-		W23 = W3 - W2;
+		InitializeCFSDaylightingW21 = InitializeCFSDaylightingW1 - InitializeCFSDaylightingW2;
+		InitializeCFSDaylightingW23 = InitializeCFSDaylightingW3 - InitializeCFSDaylightingW2;
 
-		W21 /= Surface( IWin ).Height;
-		W23 /= Surface( IWin ).Width;
+		InitializeCFSDaylightingW21 /= Surface( IWin ).Height;
+		InitializeCFSDaylightingW23 /= Surface( IWin ).Width;
 
-		WNorm = Surface( IWin ).lcsz;
+		InitializeCFSDaylightingWNorm = Surface( IWin ).lcsz;
 
 		WinElArea = DWX * DWY;
 		if ( Surface( IWin ).Sides == 3 ) {
-			WinElArea *= std::sqrt( 1.0 - pow_2( dot( W21, W23 ) ) );
+			WinElArea *= std::sqrt( 1.0 - pow_2( dot( InitializeCFSDaylightingW21, InitializeCFSDaylightingW23 ) ) );
 		}
 
 		if ( CalledFrom == CalledForMapPoint ) {
@@ -2348,7 +2730,7 @@ namespace DaylightingManager {
 
 					AllocateForCFSRefPointsState( ComplexWind( IWin ).DaylghtGeom( CurFenState ).IlluminanceMap( iRefPoint, MapNum ), NumOfWinEl, NBasis, NTrnBasis );
 
-					InitializeCFSStateData( ComplexWind( IWin ).DaylghtGeom( CurFenState ).IlluminanceMap( iRefPoint, MapNum ), ComplexWind( IWin ).IlluminanceMap( iRefPoint, MapNum ), ZoneNum, IWin, RefPoint, CurFenState, NBasis, NTrnBasis, AZVIEW, NWX, NWY, W2, W21, W23, DWX, DWY, WNorm, WinElArea, CalledFrom, MapNum );
+					InitializeCFSStateData( ComplexWind( IWin ).DaylghtGeom( CurFenState ).IlluminanceMap( iRefPoint, MapNum ), ComplexWind( IWin ).IlluminanceMap( iRefPoint, MapNum ), ZoneNum, IWin, RefPoint, CurFenState, NBasis, NTrnBasis, AZVIEW, NWX, NWY, InitializeCFSDaylightingW2, InitializeCFSDaylightingW21, InitializeCFSDaylightingW23, DWX, DWY, InitializeCFSDaylightingWNorm, WinElArea, CalledFrom, MapNum );
 				}
 
 			} else if ( CalledFrom == CalledForRefPoint ) {
@@ -2358,7 +2740,7 @@ namespace DaylightingManager {
 
 				AllocateForCFSRefPointsState( ComplexWind( IWin ).DaylghtGeom( CurFenState ).RefPoint( iRefPoint ), NumOfWinEl, NBasis, NTrnBasis );
 
-				InitializeCFSStateData( ComplexWind( IWin ).DaylghtGeom( CurFenState ).RefPoint( iRefPoint ), ComplexWind( IWin ).RefPoint( iRefPoint ), ZoneNum, IWin, RefPoint, CurFenState, NBasis, NTrnBasis, AZVIEW, NWX, NWY, W2, W21, W23, DWX, DWY, WNorm, WinElArea, CalledFrom, MapNum );
+				InitializeCFSStateData( ComplexWind( IWin ).DaylghtGeom( CurFenState ).RefPoint( iRefPoint ), ComplexWind( IWin ).RefPoint( iRefPoint ), ZoneNum, IWin, RefPoint, CurFenState, NBasis, NTrnBasis, AZVIEW, NWX, NWY, InitializeCFSDaylightingW2, InitializeCFSDaylightingW21, InitializeCFSDaylightingW23, DWX, DWY, InitializeCFSDaylightingWNorm, WinElArea, CalledFrom, MapNum );
 			}
 		}
 
@@ -2423,14 +2805,11 @@ namespace DaylightingManager {
 		int MaxTotHits;
 		int IX;
 		int IY;
-		static Vector3< Real64 > RWin; // window element center point (same as centroid)
-		static Vector3< Real64 > V; // vector array
 		Real64 LeastHitDsq; // dist^2 from window element center to hit point
 		Real64 HitDsq;
 		Real64 TransRSurf;
 		int I;
 		int J;
-		static Vector3< Real64 > GroundHitPt; // Coordinates of point that ray hits ground (m)
 
 		// Refrence point data
 		// integer :: iRefPoint
@@ -2463,9 +2842,9 @@ namespace DaylightingManager {
 
 				// centroid coordinates for current window element
 				Centroid = W2 + ( double( IX ) - 0.5 ) * W23 * DWX + ( double( IY ) - 0.5 ) * W21 * DWY;
-				RWin = Centroid;
+				InitializeCFSStateDataRWin = Centroid;
 
-				CFSRefPointSolidAngle( RefPoint, RWin, WNorm, StateRefPoint, DaylghtGeomDescr, iWin, CurFenState, NTrnBasis, curWinEl, WinElArea );
+				CFSRefPointSolidAngle( RefPoint, InitializeCFSStateDataRWin, WNorm, StateRefPoint, DaylghtGeomDescr, iWin, CurFenState, NTrnBasis, curWinEl, WinElArea );
 
 				NSky = 0;
 				NGnd = 0;
@@ -2573,8 +2952,8 @@ namespace DaylightingManager {
 
 							// for solar reflectance calculations, need to precalculate obstruction multipliers
 							if ( CalcSolRefl ) {
-								GroundHitPt = TmpGndPt( NGnd );
-								TmpGndMultiplier( NGnd ) = CalcObstrMultiplier( GroundHitPt, AltAngStepsForSolReflCalc, AzimAngStepsForSolReflCalc );
+								InitializeCFSStateDataGroundHitPt = TmpGndPt( NGnd );
+								TmpGndMultiplier( NGnd ) = CalcObstrMultiplier( InitializeCFSStateDataGroundHitPt, AltAngStepsForSolReflCalc, AzimAngStepsForSolReflCalc );
 							}
 						} else {
 							//A sky ray
@@ -2800,9 +3179,6 @@ namespace DaylightingManager {
 		//integer, intent(in) :: iRefPoint
 
 		// SUBROUTINE LOCAL VARIABLES
-		static Vector3< Real64 > Ray;
-		static Vector3< Real64 > RayNorm;
-		static Vector3< Real64 > V;
 		Real64 BestMatch;
 		int iTrnRay;
 		Real64 temp;
@@ -2810,13 +3186,13 @@ namespace DaylightingManager {
 		Real64 CosB;
 
 		// calculate vector from center of window element to the current reference point
-		Ray = RefPoint - RWin;
+		CFSRefPointSolidAngleRay = RefPoint - RWin;
 
 		// figure out outgoing beam direction from current reference point
 		BestMatch = 0.0;
 		for ( iTrnRay = 1; iTrnRay <= NTrnBasis; ++iTrnRay ) {
-			V = ComplexWind( iWin ).Geom( CurFenState ).sTrn( iTrnRay );
-			temp = dot( Ray, V );
+			CFSRefPointSolidAngleV = ComplexWind( iWin ).Geom( CurFenState ).sTrn( iTrnRay );
+			temp = dot( CFSRefPointSolidAngleRay, CFSRefPointSolidAngleV );
 			if ( temp > BestMatch ) {
 				BestMatch = temp;
 				RefPointMap.RefPointIndex( curWinEl ) = iTrnRay;
@@ -2824,10 +3200,10 @@ namespace DaylightingManager {
 		}
 
 		// calculate solid view angle
-		Dist = Ray.magnitude();
-		RayNorm = Ray / ( -Dist );
-		RefPointGeomMap.SolidAngleVec( curWinEl ) = RayNorm;
-		CosB = dot( WNorm, RayNorm );
+		Dist = CFSRefPointSolidAngleRay.magnitude();
+		CFSRefPointSolidAngleRayNorm = CFSRefPointSolidAngleRay / ( -Dist );
+		RefPointGeomMap.SolidAngleVec( curWinEl ) = CFSRefPointSolidAngleRayNorm;
+		CosB = dot( WNorm, CFSRefPointSolidAngleRayNorm );
 		RefPointGeomMap.SolidAngle( curWinEl ) = WinElArea * CosB / ( Dist * Dist );
 
 	}
@@ -2869,22 +3245,20 @@ namespace DaylightingManager {
 		int iTrnRay;
 		Real64 XR;
 		Real64 YR;
-		static Vector3< Real64 > V;
 		bool hit;
-		static Vector3< Real64 > InterPoint;
 
 		// Object Data
 		BSDFDaylghtPosition elPos; // altitude and azimuth of intersection element
 
 		auto const & sTrn( ComplexWind( iWin ).Geom( CurFenState ).sTrn );
 		for ( iTrnRay = 1; iTrnRay <= NTrnBasis; ++iTrnRay ) {
-			V = sTrn( iTrnRay );
-			V.negate();
-			PierceSurface( iWin, RefPoint, V, InterPoint, hit );
+			CFSRefPointPosFactorV = sTrn( iTrnRay );
+			CFSRefPointPosFactorV.negate();
+			PierceSurface( iWin, RefPoint, CFSRefPointPosFactorV, CFSRefPointPosFactorInterPoint, hit );
 			if ( hit ) {
 				RefPointMap.RefPointIntersection( iTrnRay ) = true;
 
-				elPos = DaylghtAltAndAzimuth( V );
+				elPos = DaylghtAltAndAzimuth( CFSRefPointPosFactorV );
 
 				XR = std::tan( std::abs( PiOvr2 - AZVIEW - elPos.Azimuth ) + 0.001 );
 				YR = std::tan( elPos.Altitude + 0.001 );
@@ -2927,7 +3301,6 @@ namespace DaylightingManager {
 		Real64 ObstrMultiplier;
 
 		// Locals
-		static Vector3< Real64 > URay; // Unit vector in (Phi,Theta) direction
 		Real64 DPhi; // Phi increment (radians)
 		Real64 DTheta; // Theta increment (radians)
 		Real64 SkyGndUnObs; // Unobstructed sky irradiance at a ground point
@@ -2942,13 +3315,6 @@ namespace DaylightingManager {
 		Real64 dOmegaGnd; // Solid angle element of ray from ground point (steradians)
 		Real64 IncAngSolidAngFac; // CosIncAngURay*dOmegaGnd/Pi
 		bool hitObs; // True iff obstruction is hit
-		static Vector3< Real64 > ObsHitPt; // Coordinates of hit point on an obstruction (m)
-		static int AltSteps_last( 0 );
-		static Array1D< Real64 > cos_Phi( AltAngStepsForSolReflCalc / 2 ); // cos( Phi ) table
-		static Array1D< Real64 > sin_Phi( AltAngStepsForSolReflCalc / 2 ); // sin( Phi ) table
-		static int AzimSteps_last( 0 );
-		static Array1D< Real64 > cos_Theta( 2 * AzimAngStepsForSolReflCalc ); // cos( Theta ) table
-		static Array1D< Real64 > sin_Theta( 2 * AzimAngStepsForSolReflCalc ); // sin( Theta ) table
 
 		assert( AzimSteps <= AzimAngStepsForSolReflCalc );
 
@@ -2983,15 +3349,15 @@ namespace DaylightingManager {
 			CPhi = cos_Phi( IPhi );
 
 			// Third component of ground ray unit vector in (Theta,Phi) direction
-			URay( 3 ) = SPhi;
+			CalcObstrMultiplierURay( 3 ) = SPhi;
 			dOmegaGnd = CPhi * DTheta * DPhi;
 			// Cosine of angle of incidence of ground ray on ground plane
 			CosIncAngURay = SPhi;
 			IncAngSolidAngFac = CosIncAngURay * dOmegaGnd / Pi;
 			// Azimuth loop
 			for ( int ITheta = 1; ITheta <= 2 * AzimSteps; ++ITheta ) {
-				URay( 1 ) = CPhi * cos_Theta( ITheta );
-				URay( 2 ) = CPhi * sin_Theta( ITheta );
+				CalcObstrMultiplierURay( 1 ) = CPhi * cos_Theta( ITheta );
+				CalcObstrMultiplierURay( 2 ) = CPhi * sin_Theta( ITheta );
 				SkyGndUnObs += IncAngSolidAngFac;
 				// Does this ground ray hit an obstruction?
 				hitObs = false;
@@ -2999,7 +3365,7 @@ namespace DaylightingManager {
 
 					for ( int ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
 						if ( Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) {
-							PierceSurface( ObsSurfNum, GroundHitPt, URay, ObsHitPt, hitObs ); // Check if ray pierces surface
+							PierceSurface( ObsSurfNum, GroundHitPt, CalcObstrMultiplierURay, CalcObstrMultiplierObsHitPt, hitObs ); // Check if ray pierces surface
 							if ( hitObs ) break;
 						}
 					}
@@ -3009,7 +3375,7 @@ namespace DaylightingManager {
 					// Lambda function for the octree to test for surface hit
 					auto surfaceHit = [&GroundHitPt,&hitObs]( SurfaceData const & surface ) -> bool {
 						if ( surface.ShadowSurfPossibleObstruction ) {
-							PierceSurface( surface, GroundHitPt, URay, ObsHitPt, hitObs ); // Check if ray pierces surface
+							PierceSurface( surface, GroundHitPt, CalcObstrMultiplierURay, CalcObstrMultiplierObsHitPt, hitObs ); // Check if ray pierces surface
 							return hitObs; // Ray pierces surface
 						} else {
 							return false;
@@ -3017,8 +3383,8 @@ namespace DaylightingManager {
 					};
 
 					// Check octree surface candidates until a hit is found, if any
-					Vector3< Real64 > const URay_inv( SurfaceOctreeCube::safe_inverse( URay ) );
-					surfaceOctree.hasSurfaceRayIntersectsCube( GroundHitPt, URay, URay_inv, surfaceHit );
+					Vector3< Real64 > const URay_inv( SurfaceOctreeCube::safe_inverse( CalcObstrMultiplierURay ) );
+					surfaceOctree.hasSurfaceRayIntersectsCube( GroundHitPt, CalcObstrMultiplierURay, URay_inv, surfaceHit );
 
 				}
 
@@ -3118,13 +3484,8 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static Vector3< Real64 > const RREF( 0.0 ); // Location of a reference point in absolute coordinate system //Autodesk Was used uninitialized: Never set here // Made static for performance and const for now until issue addressed
-		static Vector4< Real64 > XEDIRSK; // Illuminance contribution from luminance element, sky-related
 //		Real64 XEDIRSU; // Illuminance contribution from luminance element, sun-related //Unused Set but never used
-		static Vector4< Real64 > XAVWLSK; // Luminance of window element, sky-related
-		static Vector3< Real64 > RAYCOS; // Unit vector from reference point to sun
 		int JB; // Slat angle counter
-		static Array1D< Real64 > TransBmBmMult( MaxSlatAngs ); // Beam-beam transmittance of isolated blind
-		static Array1D< Real64 > TransBmBmMultRefl( MaxSlatAngs ); // As above but for beam reflected from exterior obstruction
 		Real64 ProfAng; // Solar profile angle on a window (radians)
 		Real64 POSFAC; // Position factor for a window element / ref point / view vector combination
 		Real64 XR; // Horizontal displacement ratio
@@ -3133,7 +3494,6 @@ namespace DaylightingManager {
 
 		Real64 ObTransDisk; // Product of solar transmittances of exterior obstructions hit by ray
 		// from reference point to sun
-		static Vector3< Real64 > HP; // Hit coordinates, if ray hits
 		Real64 LumAtHitPtFrSun; // Luminance at hit point of obstruction by reflection of direct light from
 		//  sun (cd/m2)
 		int ISky; // Sky type index: 1=clear, 2=clear turbid, 3=intermediate, 4=overcast
@@ -3149,13 +3509,10 @@ namespace DaylightingManager {
 		Real64 SlatAng; // Blind slat angle (rad)
 		int NearestHitSurfNum; // Surface number of nearest obstruction
 		int NearestHitSurfNumX; // Surface number to use when obstruction is a shadowing surface
-		static Vector3< Real64 > NearestHitPt; // Hit point of ray on nearest obstruction
 //		Real64 SunObstructionMult; // = 1.0 if sun hits a ground point; otherwise = 0.0
 		Real64 Alfa; // Intermediate variables
 //		Real64 Beta; //Unused
-		static Vector3< Real64 > GroundHitPt; // Coordinates of point that ray hits ground (m)
 		bool hitObs; // True iff obstruction is hit
-		static Vector3< Real64 > ObsHitPt; // Coordinates of hit point on an obstruction (m)
 		int ObsConstrNum; // Construction number of obstruction
 		Real64 ObsVisRefl; // Visible reflectance of obstruction
 		Real64 SkyReflVisLum; // Reflected sky luminance at hit point divided by
@@ -3163,16 +3520,12 @@ namespace DaylightingManager {
 		int RecSurfNum; // Receiving surface number
 		int ReflSurfNum; // Reflecting surface number
 		int ReflSurfNumX;
-		static Vector3< Real64 > ReflNorm; // Normal vector to reflecting surface
 		Real64 CosIncAngRefl; // Cos of angle of incidence of beam on reflecting surface
-		static Vector3< Real64 > SunVecMir; // Sun ray mirrored in reflecting surface
 		Real64 CosIncAngRec; // Cos of angle of incidence of reflected beam on receiving window
 		bool hitRefl; // True iff ray hits reflecting surface
-		static Vector3< Real64 > HitPtRefl; // Point that ray hits reflecting surface
 		Real64 ReflDistanceSq; // Distance squared between ref pt and hit point on reflecting surf (m^2)
 		Real64 ReflDistance; // Distance between ref pt and hit point on reflecting surf (m)
 		bool hitObsRefl; // True iff obstruction hit between ref pt and reflection point
-		static Vector3< Real64 > HitPtObs; // Hit point on obstruction
 		int ReflSurfRecNum; // Receiving surface number for a reflecting window
 		Real64 SpecReflectance; // Specular reflectance of a reflecting surface
 		Real64 TVisRefl; // Bare window vis trans for reflected beam
@@ -3185,7 +3538,6 @@ namespace DaylightingManager {
 		bool hitIntObsDisk; // True iff ray from ref pt to sun hits an interior obstruction
 //		bool hitExtObsDisk; // True iff ray from ref pt to sun hits an exterior obstruction //Unused Set but never used
 
-		static Vector3< Real64 > HitPtIntWinDisk; // Intersection point on an interior window for ray from ref pt to sun (m)
 		int IntWinDiskHitNum; // Surface number of int window intersected by ray betw ref pt and sun
 		Real64 COSBIntWin; // Cos of angle between int win outward normal and ray betw ref pt and
 		//  exterior window element or between ref pt and sun
@@ -3254,12 +3606,12 @@ namespace DaylightingManager {
 			// One or more exterior obstructions was hit; get contribution of reflection
 			// from nearest obstruction.
 			// Find obstruction whose hit point is closest to this ray's window element
-			DayltgClosestObstruction( RWIN2, Ray, NearestHitSurfNum, NearestHitPt );
+			DayltgClosestObstruction( RWIN2, Ray, NearestHitSurfNum, FigureDayltgCoeffsAtPointsForSunPositionNearestHitPt );
 			if ( NearestHitSurfNum > 0 ) {
 
 				// Beam solar reflected from nearest obstruction
 
-				DayltgSurfaceLumFromSun( iHour, Ray, NearestHitSurfNum, NearestHitPt, LumAtHitPtFrSun );
+				DayltgSurfaceLumFromSun( iHour, Ray, NearestHitSurfNum, FigureDayltgCoeffsAtPointsForSunPositionNearestHitPt, LumAtHitPtFrSun );
 				AVWLSU( iHour, 1 ) += LumAtHitPtFrSun * TVISB;
 				if ( PHRAY >= 0.0 ) EDIRSU( iHour, 1 ) += LumAtHitPtFrSun * DOMEGA_Ray_3 * TVISB;
 
@@ -3339,18 +3691,18 @@ namespace DaylightingManager {
 					Real64 const Ray_2( Ray( 2 ) );
 //					Beta = std::atan2( Ray_2, Ray_1 ); //Unused Tuning below eliminated use
 					Real64 HorDis( ( RWIN2( 3 ) - GroundLevelZ ) * std::tan( Alfa ) ); // Distance between ground hit point and proj'n of center
-					GroundHitPt( 3 ) = GroundLevelZ;
+					FigureDayltgCoeffsAtPointsForSunPositionGroundHitPt( 3 ) = GroundLevelZ;
 //Tuned Replaced by below: sqrt is faster than sincos
 //					GroundHitPt( 1 ) = RWIN2( 1 ) + HorDis * std::cos( Beta );
 //					GroundHitPt( 2 ) = RWIN2( 2 ) + HorDis * std::sin( Beta );
 					Real64 const Ray_r( std::sqrt( square( Ray_1 ) + square( Ray_2 ) ) );
 					if ( Ray_r > 0.0 ) {
 						HorDis /= Ray_r;
-						GroundHitPt( 1 ) = RWIN2( 1 ) + HorDis * Ray_1;
-						GroundHitPt( 2 ) = RWIN2( 2 ) + HorDis * Ray_2;
+						FigureDayltgCoeffsAtPointsForSunPositionGroundHitPt( 1 ) = RWIN2( 1 ) + HorDis * Ray_1;
+						FigureDayltgCoeffsAtPointsForSunPositionGroundHitPt( 2 ) = RWIN2( 2 ) + HorDis * Ray_2;
 					} else { // Treat as angle==0
-						GroundHitPt( 1 ) = RWIN2( 1 ) + HorDis;
-						GroundHitPt( 2 ) = RWIN2( 2 );
+						FigureDayltgCoeffsAtPointsForSunPositionGroundHitPt( 1 ) = RWIN2( 1 ) + HorDis;
+						FigureDayltgCoeffsAtPointsForSunPositionGroundHitPt( 2 ) = RWIN2( 2 );
 					}
 				}
 				Real64 const GILSK_mult( ( GndReflectanceForDayltg / Pi ) * ObTrans * SkyObstructionMult );
@@ -3381,7 +3733,7 @@ namespace DaylightingManager {
 								hitObs = false;
 								for ( int ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
 									if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
-									PierceSurface( ObsSurfNum, GroundHitPt, SUNCOS_iHour, ObsHitPt, hitObs );
+									PierceSurface( ObsSurfNum, FigureDayltgCoeffsAtPointsForSunPositionGroundHitPt, SUNCOS_iHour, FigureDayltgCoeffsAtPointsForSunPositionObsHitPt, hitObs );
 									if ( hitObs ) break;
 								}
 								//if ( hitObs ) SunObstructionMult = 0.0;
@@ -4312,8 +4664,6 @@ namespace DaylightingManager {
 		Real64 SinBldgRelNorth; // Sine of Building rotation
 		Real64 CosZoneRelNorth; // Cosine of Zone rotation
 		Real64 SinZoneRelNorth; // Sine of Zone rotation
-		static Real64 CosBldgRotAppGonly(0.0); // Cosine of the building rotation for appendix G only (relative north)
-		static Real64 SinBldgRotAppGonly(0.0); // Sine of the building rotation for appendix G only (relative north)
 		Real64 Xb; // temp var for transformation calc
 		Real64 Yb; // temp var for transformation calc
 		Real64 Xo;
@@ -5033,11 +5383,10 @@ namespace DaylightingManager {
 		int ShelfNum; // light shelf object number
 		int SurfNum; // daylight device surface number
 		bool ErrorsFound;
-		static bool firstTime( true );
 
-		if ( firstTime ) {
+		if ( CheckTDDsAndLightShelvesInDaylitZones_firstTime ) {
 			CheckTDDZone.dimension( NumOfZones, true );
-			firstTime = false;
+			CheckTDDsAndLightShelvesInDaylitZones_firstTime = false;
 		}
 
 		ErrorsFound = false;
@@ -5396,8 +5745,6 @@ namespace DaylightingManager {
 		//   illuminance (lux)
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		int const NTH( 18 ); // Number of azimuth steps for sky integration
-		int const NPH( 8 ); // Number of altitude steps for sky integration
 		Real64 const DTH( ( 2.0 * Pi ) / double( NTH ) ); // Sky integration azimuth stepsize (radians)
 		Real64 const DPH( PiOvr2 / double( NPH ) ); // Sky integration altitude stepsize (radians)
 
@@ -5410,11 +5757,7 @@ namespace DaylightingManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int IPH; // Altitude index for sky integration
 		int ITH; // Azimuth index for sky integration
-		static Array1D< Real64 > PH( NPH ); // Altitude of sky element (radians)
-		static Array1D< Real64 > TH( NTH ); // Azimuth of sky element (radians)
 		int ISky; // Sky type index
-		static Array1D< Real64 > SPHCPH( NPH ); // Sine times cosine of altitude of sky element
-		static bool firstTime( true ); // flag for first time thru to initialize
 
 		// FLOW:
 		// Integrate to obtain illuminance from sky.
@@ -5422,7 +5765,7 @@ namespace DaylightingManager {
 		// is L(TH,PH)*SIN(PH)*COS(PH)*DTH*DPH, where L(TH,PH) is the luminance
 		// of the patch in cd/m2.
 		//  Init
-		if ( firstTime ) {
+		if ( DayltgExtHorizIllum_firstTime ) {
 			for ( IPH = 1; IPH <= NPH; ++IPH ) {
 				PH( IPH ) = ( IPH - 0.5 ) * DPH;
 				SPHCPH( IPH ) = std::sin( PH( IPH ) ) * std::cos( PH( IPH ) ); // DA = COS(PH)*DTH*DPH
@@ -5430,7 +5773,7 @@ namespace DaylightingManager {
 			for ( ITH = 1; ITH <= NTH; ++ITH ) {
 				TH( ITH ) = ( ITH - 0.5 ) * DTH;
 			}
-			firstTime = false;
+			DayltgExtHorizIllum_firstTime = false;
 		}
 
 		HISK = 0.0;
@@ -5492,7 +5835,6 @@ namespace DaylightingManager {
 
 		// Local declarations
 		int IType; // Surface type/class:  mirror surfaces of shading surfaces
-		static Vector3< Real64 > HP; // Hit coordinates, if ray hits an obstruction
 		bool hit; // True iff a particular obstruction is hit
 
 		ObTrans = 1.0;
@@ -5510,13 +5852,13 @@ namespace DaylightingManager {
 				if ( ! surface.ShadowSurfPossibleObstruction ) continue;
 				IType = surface.Class;
 				if ( ( IType == SurfaceClass_Wall || IType == SurfaceClass_Roof || IType == SurfaceClass_Floor ) && ( ISurf != window_iBaseSurf ) ) {
-					PierceSurface( ISurf, R1, RN, HP, hit );
+					PierceSurface( ISurf, R1, RN, DayltgHitObstructionHP, hit );
 					if ( hit ) { // Building element is hit (assumed opaque)
 						ObTrans = 0.0;
 						break;
 					}
 				} else if ( surface.ShadowingSurf ) {
-					PierceSurface( ISurf, R1, RN, HP, hit );
+					PierceSurface( ISurf, R1, RN, DayltgHitObstructionHP, hit );
 					if ( hit ) { // Shading surface is hit
 						// Get solar transmittance of the shading surface
 						Real64 const Trans( surface.SchedShadowSurfIndex > 0 ? LookUpScheduleValue( surface.SchedShadowSurfIndex, IHOUR, 1 ) : 0.0 );
@@ -5540,13 +5882,13 @@ namespace DaylightingManager {
 				if ( ! surface.ShadowSurfPossibleObstruction ) return false; //Do Consider separate octree without filtered surfaces
 				auto const sClass( surface.Class );
 				if ( ( sClass == SurfaceClass_Wall || sClass == SurfaceClass_Roof || sClass == SurfaceClass_Floor ) && ( &surface != window_base_p ) ) {
-					PierceSurface( surface, R1, RN, HP, hit );
+					PierceSurface( surface, R1, RN, DayltgHitObstructionHP, hit );
 					if ( hit ) { // Building element is hit (assumed opaque)
 						ObTrans = 0.0;
 						return true;
 					}
 				} else if ( surface.ShadowingSurf ) {
-					PierceSurface( surface, R1, RN, HP, hit );
+					PierceSurface( surface, R1, RN, DayltgHitObstructionHP, hit );
 					if ( hit ) { // Shading surface is hit
 						// Get solar transmittance of the shading surface
 						Real64 const Trans( surface.SchedShadowSurfIndex > 0 ? LookUpScheduleValue( surface.SchedShadowSurfIndex, IHOUR, 1 ) : 0.0 );
@@ -5593,11 +5935,9 @@ namespace DaylightingManager {
 
 		// Local declarations
 		int IType; // Surface type/class
-		static Vector3< Real64 > HP; // Hit coordinates, if ray hits an obstruction
-		static Vector3< Real64 > RN; // Unit vector along ray
 
 		hit = false;
-		RN = ( R2 - R1 ).normalize(); // Make unit vector
+		DayltgHitInteriorObstructionRN = ( R2 - R1 ).normalize(); // Make unit vector
 		Real64 const d12( distance( R1, R2 ) ); // Distance between R1 and R2
 
 		auto const & window( Surface( IWin ) );
@@ -5617,7 +5957,7 @@ namespace DaylightingManager {
 				 ( IType == SurfaceClass_Wall || IType == SurfaceClass_Roof || IType == SurfaceClass_Floor ) &&
 				 ( ISurf != window_iBaseSurf ) && ( ISurf != window_base_iExtBoundCond ) ) ) // Exclude window's base or base-adjacent surfaces
 				{
-					PierceSurface( ISurf, R1, RN, d12, HP, hit ); // Check if R2-R1 segment pierces surface
+					PierceSurface( ISurf, R1, DayltgHitInteriorObstructionRN, d12, DayltgHitInteriorObstructionHP, hit ); // Check if R2-R1 segment pierces surface
 					if ( hit ) break; // Segment pierces surface: Don't check the rest
 				}
 			}
@@ -5636,7 +5976,7 @@ namespace DaylightingManager {
 				 ( sClass == SurfaceClass_Wall || sClass == SurfaceClass_Roof || sClass == SurfaceClass_Floor ) && // Wall, ceiling/roof, or floor
 				 ( &surface != window_base_p ) && ( &surface != window_base_adjacent_p ) ) ) // Exclude window's base or base-adjacent surfaces
 				{
-					PierceSurface( surface, R1, RN, d12, HP, hit ); // Check if R2-R1 segment pierces surface
+					PierceSurface( surface, R1, DayltgHitInteriorObstructionRN, d12, DayltgHitInteriorObstructionHP, hit ); // Check if R2-R1 segment pierces surface
 					return hit;
 				} else {
 					return false;
@@ -5675,11 +6015,9 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int IType; // Surface type/class
-		static Vector3< Real64 > HP; // Hit coordinates, if ray hits an obstruction surface (m)
-		static Vector3< Real64 > RN; // Unit vector along ray from R1 to R2
 
 		hit = false;
-		RN = ( R2 - R1 ).normalize(); // Unit vector
+		DayltgHitBetWinObstructionRN = ( R2 - R1 ).normalize(); // Unit vector
 		Real64 const d12( distance( R1, R2 ) ); // Distance between R1 and R2 (m)
 
 		auto const & window1( Surface( IWin1 ) );
@@ -5708,7 +6046,7 @@ namespace DaylightingManager {
 				 ( ISurf != window1_iBaseSurf ) && ( ISurf != window2_iBaseSurf ) && // Exclude windows' base surfaces
 				 ( ISurf != window1_base_iExtBoundCond ) && ( ISurf != window2_base_iExtBoundCond ) ) ) // Exclude windows' base-adjacent surfaces
 				{
-					PierceSurface( ISurf, R1, RN, d12, HP, hit ); // Check if R2-R1 segment pierces surface
+					PierceSurface( ISurf, R1, DayltgHitBetWinObstructionRN, d12, DayltgHitBetWinObstructionHP, hit ); // Check if R2-R1 segment pierces surface
 					if ( hit ) break; // Segment pierces surface: Don't check the rest
 				}
 			}
@@ -5732,7 +6070,7 @@ namespace DaylightingManager {
 				 ( &surface != window1_base_p ) && ( &surface != window2_base_p ) && // Exclude windows' base surfaces
 				 ( &surface != window1_base_adjacent_p ) && ( &surface != window2_base_adjacent_p ) ) ) // Exclude windows' base-adjacent surfaces
 				{
-					PierceSurface( surface, R1, RN, d12, HP, hit ); // Check if R2-R1 segment pierces surface
+					PierceSurface( surface, R1, DayltgHitBetWinObstructionRN, d12, DayltgHitBetWinObstructionHP, hit ); // Check if R2-R1 segment pierces surface
 					return hit;
 				} else {
 					return false;
@@ -5807,24 +6145,11 @@ namespace DaylightingManager {
 		int ISky; // Sky type index
 		int ISky1; // Sky type index values for averaging two sky types
 		int ISky2;
-		static Vector2< Real64 > SetPnt; // Illuminance setpoint at reference points (lux)
-		static Array2D< Real64 > DFSKHR( 2, 4 ); // Sky daylight factor for sky type (first index),
 		//   bare/shaded window (second index)
-		static Vector2< Real64 > DFSUHR; // Sun daylight factor for bare/shaded window
-		static Array2D< Real64 > BFSKHR( 2, 4 ); // Sky background luminance factor for sky type (first index),
 		//   bare/shaded window (second index)
-		static Vector2< Real64 > BFSUHR; // Sun background luminance factor for bare/shaded window
-		static Array2D< Real64 > SFSKHR( 2, 4 ); // Sky source luminance factor for sky type (first index),
 		//   bare/shaded window (second index)
-		static Vector2< Real64 > SFSUHR; // Sun source luminance factor for bare/shaded window
-		static Array2D< Real64 > WDAYIL( 2, 2 ); // Illuminance from window at reference point (first index)
 		//   for shade open/closed (second index)
-		static Array2D< Real64 > WBACLU( 2, 2 ); // Background illuminance from window at reference point (first index)
 		//   for shade open/closed (second index)
-		static Vector2< Real64 > RDAYIL; // Illuminance from window at reference point after closing shade
-		static Vector2< Real64 > RBACLU; // Background illuminance from window at reference point after closing shade
-		static Vector2< Real64 > GLRNDX; // Glare index at reference point
-		static Vector2< Real64 > GLRNEW; // New glare index at reference point
 		int IL; // Reference point index
 		int IWin; // Window index
 		int IS; // IS=1 for unshaded window, =2 for shaded window
@@ -5843,7 +6168,6 @@ namespace DaylightingManager {
 		Real64 VTRAT; // Ratio between switched and unswitched visible transmittance at normal incidence
 		Real64 BACL; // Window background (surround) luminance for glare calc (cd/m2)
 		Real64 SkyWeight; // Weighting factor used to average two different sky types
-		static Vector4< Real64 > HorIllSky; // Horizontal illuminance for different sky types
 		Real64 HorIllSkyFac; // Ratio between horizontal illuminance from sky horizontal irradiance and
 		//   luminous efficacy and horizontal illuminance from averaged sky
 		Real64 SlatAng; // Blind slat angle (rad)
@@ -5856,29 +6180,19 @@ namespace DaylightingManager {
 		Real64 VTMaster; // VT of the base/master TC window
 
 		// Added variables for glare iterations for switchable glazings
-		static Real64 tmpSWSL1( 0.0 );
-		static Real64 tmpSWSL2( 0.0 );
-		static Real64 tmpSWFactor( 0.0 ); // new switching factor to meet glare criteria
 //		static Real64 tmpSWFactor0( 0.0 ); // original switching factor to meet daylight illuminance //Unused Set but never used
-		static Real64 tmpMult( 0.0 );
-		static bool GlareOK( false );
-		static Array3D< Real64 > tmpIllumFromWinAtRefPt;
-		static Array3D< Real64 > tmpBackLumFromWinAtRefPt;
-		static Array3D< Real64 > tmpSourceLumFromWinAtRefPt;
-		static bool firstTime( true ); // true first time routine is called
 
-		static bool blnCycle( false );
 
 		if ( ZoneDaylight( ZoneNum ).DaylightMethod != SplitFluxDaylighting ) return;
 
 		// Three arrays to save original clear and dark (fully switched) states'
 		//  zone/window daylighting properties.
-		if ( firstTime ) {
+		if ( DayltgInteriorIllum_firstTime ) {
 			int const d1( max( maxval( Zone, &ZoneData::NumSubSurfaces ), maxval( ZoneDaylight, &ZoneDaylightCalc::NumOfDayltgExtWins ) ) );
 			tmpIllumFromWinAtRefPt.allocate( d1, 2, 2 );
 			tmpBackLumFromWinAtRefPt.allocate( d1, 2, 2 );
 			tmpSourceLumFromWinAtRefPt.allocate( d1, 2, 2 );
-			firstTime = false;
+			DayltgInteriorIllum_firstTime = false;
 		}
 		tmpIllumFromWinAtRefPt = 0.0;
 		tmpBackLumFromWinAtRefPt = 0.0;
@@ -6537,7 +6851,6 @@ namespace DaylightingManager {
 		int PipeNum; // TDD pipe object number
 		Real64 TDDTransVisDiffNow; // TDD diffuse visible transmittance at the current hour
 		Real64 TDDTransVisDiffPrev; // TDD diffuse visible transmittance at the previous hour
-		static Vector4< Real64 > TDDTransVisDiff; // Weighted diffuse visible transmittance for each sky type
 		int ISky; // Sky type index
 		int ISky1; // Sky type index values for averaging two sky types
 		int ISky2;
@@ -6893,8 +7206,6 @@ namespace DaylightingManager {
 		//  quantities that do not depend on sun position.
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		int const NPHMAX( 10 ); // Number of sky/ground integration steps in altitude
-		int const NTHMAX( 16 ); // Number of sky/ground integration steps in azimuth
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -6906,16 +7217,9 @@ namespace DaylightingManager {
 		// In the following I,J arrays:
 		// I = sky type;
 		// J = 1 for bare window, 2 and above for window with shade or blind.
-		static Array2D< Real64 > FLFWSK( MaxSlatAngs+1, 4 ); // Sky-related downgoing luminous flux
-		static Array1D< Real64 > FLFWSU( MaxSlatAngs+1 ); // Sun-related downgoing luminous flux, excluding entering beam
-		static Array1D< Real64 > FLFWSUdisk( MaxSlatAngs+1 ); // Sun-related downgoing luminous flux, due to entering beam
-		static Array2D< Real64 > FLCWSK( MaxSlatAngs+1, 4 ); // Sky-related upgoing luminous flux
-		static Array1D< Real64 > FLCWSU( MaxSlatAngs+1 ); // Sun-related upgoing luminous flux
 
 		int ISky; // Sky type index: 1=clear, 2=clear turbid,
 		//  3=intermediate, 4=overcast
-		static Array1D< Real64 > TransMult( MaxSlatAngs ); // Transmittance multiplier
-		static Array1D< Real64 > TransBmBmMult( MaxSlatAngs ); // Isolated blind beam-beam transmittance
 		Real64 DPH; // Sky/ground element altitude and azimuth increments (radians)
 		Real64 DTH;
 		int IPH; // Sky/ground element altitude and azimuth indices
@@ -6936,12 +7240,9 @@ namespace DaylightingManager {
 		Real64 COSB; // Cosine of angle of incidence of light from sky or ground
 		Real64 TVISBR; // Transmittance of window without shading at COSB
 		//  (times light well efficiency, if appropriate)
-		static Vector4< Real64 > ZSK; // Sky-related and sun-related illuminance on window from sky/ground
 		Real64 ZSU;
 		//  element for clear and overcast sky
-		static Vector3< Real64 > U; // Unit vector in (PH,TH) direction
 		Real64 ObTrans; // Product of solar transmittances of obstructions seen by a light ray
-		static Array2D< Real64 > ObTransM( NPHMAX, NTHMAX ); // ObTrans value for each (TH,PH) direction
 		//unused  REAL(r64)         :: HitPointLumFrClearSky     ! Luminance of obstruction from clear sky (cd/m2)
 		//unused  REAL(r64)         :: HitPointLumFrOvercSky     ! Luminance of obstruction from overcast sky (cd/m2)
 		//unused  REAL(r64)         :: HitPointLumFrSun          ! Luminance of obstruction from sun (cd/m2)
@@ -6993,26 +7294,21 @@ namespace DaylightingManager {
 		//  obstruction (for unit beam normal illuminance)
 		int NearestHitSurfNum; // Surface number of nearest obstruction
 		int NearestHitSurfNumX; // Surface number to use when obstruction is a shadowing surface
-		static Vector3< Real64 > NearestHitPt; // Hit point of ray on nearest obstruction (m)
 		Real64 LumAtHitPtFrSun; // Luminance at hit point on obstruction from solar reflection
 		//  for unit beam normal illuminance (cd/m2)
 		Real64 SunObstructionMult; // = 1 if sun hits a ground point; otherwise = 0
-		static Array2D< Real64 > SkyObstructionMult( NPHMAX, NTHMAX ); // Ratio of obstructed to unobstructed sky diffuse at
 		// a ground point for each (TH,PH) direction
 		Real64 Alfa; // Direction angles for ray heading towards the ground (radians)
 		Real64 Beta;
 		Real64 HorDis; // Distance between ground hit point and proj'n of window center onto ground (m)
-		static Vector3< Real64 > GroundHitPt; // Coordinates of point that ray from window center hits the ground (m)
 		int ObsSurfNum; // Obstruction surface number
 		bool hitObs; // True iff obstruction is hit
-		static Vector3< Real64 > ObsHitPt; // Coordinates of hit point on an obstruction (m)
 		int ObsConstrNum; // Construction number of obstruction
 		Real64 ObsVisRefl; // Visible reflectance of obstruction
 		Real64 SkyReflVisLum; // Reflected sky luminance at hit point divided by unobstructed sky
 		//  diffuse horizontal illuminance [(cd/m2)/lux]
 		Real64 dReflObsSky; // Contribution to sky-related illuminance on window due to sky diffuse
 		//  reflection from an obstruction
-		static Vector3< Real64 > URay; // Unit vector in (Phi,Theta) direction
 		Real64 TVisSunRefl; // Diffuse vis trans of bare window for beam reflection calc
 		//  (times light well efficiency, if appropriate)
 		Real64 ZSU1refl; // Beam normal illuminance times ZSU1refl = illuminance on window
@@ -7154,7 +7450,7 @@ namespace DaylightingManager {
 				// (There may also be contributions from reflection from obstructions; see 'BEAM SOLAR AND SKY SOLAR
 				// REFLECTED FROM NEAREST OBSTRUCTION,' below.)
 
-				if ( ISunPos == 1 ) SkyObstructionMult( IPH, ITH ) = 1.0;
+				if ( ISunPos == 1 ) DayltgInterReflectedIllumSkyObstructionMult( IPH, ITH ) = 1.0;
 				if ( PH > 0.0 ) { // Contribution is from sky
 					for ( ISky = 1; ISky <= 4; ++ISky ) {
 						ZSK( ISky ) = DayltgSkyLuminance( ISky, TH, PH ) * COSB * DA * ObTransM( IPH, ITH );
@@ -7169,16 +7465,16 @@ namespace DaylightingManager {
 						Alfa = std::acos( -U( 3 ) );
 						Beta = std::atan2( U( 2 ), U( 1 ) );
 						HorDis = ( SurfaceWindow( IWin ).WinCenter( 3 ) - GroundLevelZ ) * std::tan( Alfa );
-						GroundHitPt( 3 ) = GroundLevelZ;
-						GroundHitPt( 1 ) = SurfaceWindow( IWin ).WinCenter( 1 ) + HorDis * std::cos( Beta );
-						GroundHitPt( 2 ) = SurfaceWindow( IWin ).WinCenter( 2 ) + HorDis * std::sin( Beta );
+						DayltgInterReflectedIllumGroundHitPt( 3 ) = GroundLevelZ;
+						DayltgInterReflectedIllumGroundHitPt( 1 ) = SurfaceWindow( IWin ).WinCenter( 1 ) + HorDis * std::cos( Beta );
+						DayltgInterReflectedIllumGroundHitPt( 2 ) = SurfaceWindow( IWin ).WinCenter( 2 ) + HorDis * std::sin( Beta );
 
-						SkyObstructionMult( IPH, ITH ) = CalcObstrMultiplier( GroundHitPt, AltAngStepsForSolReflCalc, AzimAngStepsForSolReflCalc );
+						DayltgInterReflectedIllumSkyObstructionMult( IPH, ITH ) = CalcObstrMultiplier( DayltgInterReflectedIllumGroundHitPt, AltAngStepsForSolReflCalc, AzimAngStepsForSolReflCalc );
 					} // End of check if solar reflection calc is in effect
 					for ( ISky = 1; ISky <= 4; ++ISky ) {
 						// Below, luminance of ground in cd/m2 is illuminance on ground in lumens/m2
 						// times ground reflectance, divided by pi, times obstruction multiplier.
-						ZSK( ISky ) = ( GILSK( IHR, ISky ) * GndReflectanceForDayltg / Pi ) * COSB * DA * ObTransM( IPH, ITH ) * SkyObstructionMult( IPH, ITH );
+						ZSK( ISky ) = ( GILSK( IHR, ISky ) * GndReflectanceForDayltg / Pi ) * COSB * DA * ObTransM( IPH, ITH ) * DayltgInterReflectedIllumSkyObstructionMult( IPH, ITH );
 					}
 					// Determine if sun illuminates the point that ray hits the ground. If the solar reflection
 					// calculation has been requested (CalcSolRefl = .TRUE.) shading by obstructions, including
@@ -7190,7 +7486,7 @@ namespace DaylightingManager {
 						hitObs = false;
 						for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
 							if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
-							PierceSurface( ObsSurfNum, GroundHitPt, SUNCOS_IHR, ObsHitPt, hitObs );
+							PierceSurface( ObsSurfNum, DayltgInterReflectedIllumGroundHitPt, SUNCOS_IHR, DayltgInterReflectedIllumObsHitPt, hitObs );
 							if ( hitObs ) break;
 						}
 						if ( hitObs ) SunObstructionMult = 0.0;
@@ -7202,11 +7498,11 @@ namespace DaylightingManager {
 
 				if ( CalcSolRefl && ObTransM( IPH, ITH ) < 1.0 ) {
 					// Find obstruction whose hit point is closest to the center of the window
-					DayltgClosestObstruction( SurfaceWindow( IWin ).WinCenter, U, NearestHitSurfNum, NearestHitPt );
+					DayltgClosestObstruction( SurfaceWindow( IWin ).WinCenter, U, NearestHitSurfNum, DayltgInterReflectedIllumNearestHitPt );
 					if ( NearestHitSurfNum > 0 ) {
 
 						// Beam solar reflected from nearest obstruction.
-						DayltgSurfaceLumFromSun( IHR, U, NearestHitSurfNum, NearestHitPt, LumAtHitPtFrSun );
+						DayltgSurfaceLumFromSun( IHR, U, NearestHitSurfNum, DayltgInterReflectedIllumNearestHitPt, LumAtHitPtFrSun );
 						ZSUObsRefl = LumAtHitPtFrSun * COSB * DA;
 						ZSU += ZSUObsRefl;
 
@@ -7308,7 +7604,7 @@ namespace DaylightingManager {
 							hitObs = false;
 							for ( IntWinLoop = 1; IntWinLoop <= ZoneDaylight( ZoneNum ).IntWinAdjZoneExtWin( IntWinAdjZoneExtWinNum ).NumOfIntWindows; ++IntWinLoop ) {
 								IntWinNum = ZoneDaylight( ZoneNum ).IntWinAdjZoneExtWin( IntWinAdjZoneExtWinNum ).IntWinNum( IntWinLoop );
-								PierceSurface( IntWinNum, SurfaceWindow( IntWinNum ).WinCenter, SUNCOS_IHR, ObsHitPt, hitObs );
+								PierceSurface( IntWinNum, SurfaceWindow( IntWinNum ).WinCenter, SUNCOS_IHR, DayltgInterReflectedIllumObsHitPt, hitObs );
 								if ( hitObs ) { // disk passes thru
 									// cosine of incidence angle of light from sky or ground element for
 									COSBintWin = SPH * std::sin( SurfaceWindow( IntWinNum ).Phi ) + CPH * std::cos( SurfaceWindow( IntWinNum ).Phi ) * std::cos( TH - SurfaceWindow( IntWinNum ).Theta );
@@ -7374,7 +7670,7 @@ namespace DaylightingManager {
 					if ( SurfaceWindow( IWin ).SolarDiffusing ) IConstShaded = Surface( IWin ).Construction;
 
 					// Transmittance of window including shade, screen or blind
-					TransBmBmMult = 0.0;
+					DayltgInterReflectedIllumTransBmBmMult = 0.0;
 					TransMult = 0.0;
 
 					if ( ShadeOn ) { // Shade
@@ -7392,7 +7688,7 @@ namespace DaylightingManager {
 						ReflScDiffDiffBack = SurfaceScreens( SurfaceWindow( IWin ).ScreenNumber ).DifReflectVis;
 						TransScBmDiffFront = SurfaceScreens( SurfaceWindow( IWin ).ScreenNumber ).BmDifTransVis;
 						TransMult( 1 ) = TransScBmDiffFront * SurfaceWindow( IWin ).GlazedFrac * Construct( IConst ).TransDiffVis / ( 1 - ReflGlDiffDiffFront * ReflScDiffDiffBack ) * SurfaceWindow( IWin ).LightWellEff;
-						TransBmBmMult( 1 ) = SurfaceScreens( SurfaceWindow( IWin ).ScreenNumber ).BmBmTransVis;
+						DayltgInterReflectedIllumTransBmBmMult( 1 ) = SurfaceScreens( SurfaceWindow( IWin ).ScreenNumber ).BmBmTransVis;
 
 					} else if ( BlindOn ) { // Blind: get beam-diffuse and beam-beam vis trans of blind+glazing system
 						// PETER:  As long as only interior blinds are allowed for TDDs, no need to change TransMult calculation
@@ -7442,7 +7738,7 @@ namespace DaylightingManager {
 							} else {
 								SlatAng = Blind( BlNum ).SlatAngle * DegToRadians;
 							}
-							TransBmBmMult( JB ) = TVISBR * BlindBeamBeamTrans( ProfAng, SlatAng, Blind( BlNum ).SlatWidth, Blind( BlNum ).SlatSeparation, Blind( BlNum ).SlatThickness );
+							DayltgInterReflectedIllumTransBmBmMult( JB ) = TVISBR * BlindBeamBeamTrans( ProfAng, SlatAng, Blind( BlNum ).SlatWidth, Blind( BlNum ).SlatSeparation, Blind( BlNum ).SlatThickness );
 						} // End of loop over slat angles
 
 					} else { // Diffusing glass
@@ -7451,12 +7747,12 @@ namespace DaylightingManager {
 
 					if ( SurfaceWindow( IWin ).OriginalClass == SurfaceClass_TDD_Dome ) {
 						// No beam is transmitted.  This takes care of all types of screens and blinds.
-						TransBmBmMult = 0.0;
+						DayltgInterReflectedIllumTransBmBmMult = 0.0;
 					}
 
 					// Daylighting shelf simplification:  No beam makes it past end of shelf, all light is diffuse
 					if ( InShelfSurf > 0 ) { // Inside daylighting shelf
-						TransBmBmMult = 0.0; // No beam, diffuse only
+						DayltgInterReflectedIllumTransBmBmMult = 0.0; // No beam, diffuse only
 					}
 
 					// TransBmBmMult is used in the following for windows with blinds or screens to get contribution from light
@@ -7469,15 +7765,15 @@ namespace DaylightingManager {
 
 							WLUMSK( IHR, JB + 1, ISky ) += ZSK( ISky ) * TransMult( JB ) / Pi;
 							FLFWSK( JB + 1, ISky ) += ZSK( ISky ) * TransMult( JB ) * ( 1.0 - SurfaceWindow( IWin ).FractionUpgoing );
-							if ( PH > 0.0 && ( BlindOn || ScreenOn ) ) FLFWSK( JB + 1, ISky ) += ZSK( ISky ) * TransBmBmMult( JB );
+							if ( PH > 0.0 && ( BlindOn || ScreenOn ) ) FLFWSK( JB + 1, ISky ) += ZSK( ISky ) * DayltgInterReflectedIllumTransBmBmMult( JB );
 							FLCWSK( JB + 1, ISky ) += ZSK( ISky ) * TransMult( JB ) * SurfaceWindow( IWin ).FractionUpgoing;
-							if ( PH <= 0.0 && ( BlindOn || ScreenOn ) ) FLCWSK( JB + 1, ISky ) += ZSK( ISky ) * TransBmBmMult( JB );
+							if ( PH <= 0.0 && ( BlindOn || ScreenOn ) ) FLCWSK( JB + 1, ISky ) += ZSK( ISky ) * DayltgInterReflectedIllumTransBmBmMult( JB );
 							if ( ISky == 1 ) {
 								WLUMSU( IHR, JB + 1 ) += ZSU * TransMult( JB ) / Pi;
 								FLFWSU( JB + 1 ) += ZSU * TransMult( JB ) * ( 1.0 - SurfaceWindow( IWin ).FractionUpgoing );
-								if ( PH > 0.0 && ( BlindOn || ScreenOn ) ) FLFWSU( JB + 1 ) += ZSU * TransBmBmMult( JB );
+								if ( PH > 0.0 && ( BlindOn || ScreenOn ) ) FLFWSU( JB + 1 ) += ZSU * DayltgInterReflectedIllumTransBmBmMult( JB );
 								FLCWSU( JB + 1 ) += ZSU * TransMult( JB ) * SurfaceWindow( IWin ).FractionUpgoing;
-								if ( PH <= 0.0 && ( BlindOn || ScreenOn ) ) FLCWSU( JB + 1 ) += ZSU * TransBmBmMult( JB );
+								if ( PH <= 0.0 && ( BlindOn || ScreenOn ) ) FLCWSU( JB + 1 ) += ZSU * DayltgInterReflectedIllumTransBmBmMult( JB );
 							}
 						}
 					}
@@ -7569,7 +7865,7 @@ namespace DaylightingManager {
 
 				// -- Window with shade, screen, blind or diffusing glass
 				if ( ShadeOn || BlindOn || ScreenOn || SurfaceWindow( IWin ).SolarDiffusing ) {
-					TransBmBmMult = 0.0;
+					DayltgInterReflectedIllumTransBmBmMult = 0.0;
 					TransMult = 0.0;
 
 					// TH 7/7/2010 moved from inside the loop: DO JB = 1,MaxSlatAngs
@@ -7630,23 +7926,23 @@ namespace DaylightingManager {
 							} else {
 								SlatAng = Blind( BlNum ).SlatAngle * DegToRadians;
 							}
-							TransBmBmMult( JB ) = TVISBSun * BlindBeamBeamTrans( ProfAng, SlatAng, Blind( BlNum ).SlatWidth, Blind( BlNum ).SlatSeparation, Blind( BlNum ).SlatThickness );
+							DayltgInterReflectedIllumTransBmBmMult( JB ) = TVISBSun * BlindBeamBeamTrans( ProfAng, SlatAng, Blind( BlNum ).SlatWidth, Blind( BlNum ).SlatSeparation, Blind( BlNum ).SlatThickness );
 						} // ShadeOn/ScreenOn/BlindOn/Diffusing glass
 
 						if ( SurfaceWindow( IWin ).OriginalClass == SurfaceClass_TDD_Dome ) {
-							TransBmBmMult = 0.0; // No beam, diffuse only
+							DayltgInterReflectedIllumTransBmBmMult = 0.0; // No beam, diffuse only
 						}
 
 						// Daylighting shelf simplification:  No beam makes it past end of shelf, all light is diffuse
 						if ( InShelfSurf > 0 ) { // Inside daylighting shelf
-							TransBmBmMult = 0.0; // No beam, diffuse only (Not sure if this really works)
+							DayltgInterReflectedIllumTransBmBmMult = 0.0; // No beam, diffuse only (Not sure if this really works)
 							// SurfaceWindow(IWin)%FractionUpgoing is already set to 1.0 earlier
 						}
 
 						WLUMSU( IHR, JB + 1 ) += ZSU1 * TransMult( JB ) / Pi;
-						WLUMSUdisk( IHR, JB + 1 ) = ZSU1 * TransBmBmMult( JB ) / Pi;
+						WLUMSUdisk( IHR, JB + 1 ) = ZSU1 * DayltgInterReflectedIllumTransBmBmMult( JB ) / Pi;
 						FLFWSU( JB + 1 ) += ZSU1 * TransMult( JB ) * ( 1.0 - SurfaceWindow( IWin ).FractionUpgoing );
-						FLFWSUdisk( JB + 1 ) = ZSU1 * TransBmBmMult( JB );
+						FLFWSUdisk( JB + 1 ) = ZSU1 * DayltgInterReflectedIllumTransBmBmMult( JB );
 						FLCWSU( JB + 1 ) += ZSU1 * TransMult( JB ) * SurfaceWindow( IWin ).FractionUpgoing;
 					} // End of loop over slat angles
 				} // End of window with shade or blind
@@ -7677,7 +7973,7 @@ namespace DaylightingManager {
 				// -- Window with shade, blind or diffusing glass
 
 				if ( ShadeOn || BlindOn || ScreenOn || SurfaceWindow( IWin ).SolarDiffusing ) {
-					TransBmBmMult = 0.0;
+					DayltgInterReflectedIllumTransBmBmMult = 0.0;
 					TransMult = 0.0;
 
 					for ( JB = 1; JB <= MaxSlatAngs; ++JB ) {
@@ -7784,8 +8080,6 @@ namespace DaylightingManager {
 		Real64 BeamObstrMultiplier; // beam obstruction multiplier in case incoming beam is from the ground
 		int ObsSurfNum; // Obstruction surface number
 		bool hitObs; // True iff obstruction is hit
-		static Vector3< Real64 > ObsHitPt; // Coordinates of hit point on an obstruction (m)
-		static Vector3< Real64 > GroundHitPt; // Coordinates of point that ray from window center hits the ground (m)
 
 		int NRefl; // number of exterior obstructions
 		int iReflElem; // incoming direction blocking surfaces element counter
@@ -7884,16 +8178,16 @@ namespace DaylightingManager {
 				for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
 					if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 					if ( CalledFrom == CalledForRefPoint ) {
-						GroundHitPt( 1 ) = ComplexWind( IWin ).DaylghtGeom( CurCplxFenState ).RefPoint( iRefPoint ).GndPt( iGndElem, WinEl ).x;
-						GroundHitPt( 2 ) = ComplexWind( IWin ).DaylghtGeom( CurCplxFenState ).RefPoint( iRefPoint ).GndPt( iGndElem, WinEl ).y;
-						GroundHitPt( 3 ) = ComplexWind( IWin ).DaylghtGeom( CurCplxFenState ).RefPoint( iRefPoint ).GndPt( iGndElem, WinEl ).z;
+						ComplexFenestrationLuminancesGroundHitPt( 1 ) = ComplexWind( IWin ).DaylghtGeom( CurCplxFenState ).RefPoint( iRefPoint ).GndPt( iGndElem, WinEl ).x;
+						ComplexFenestrationLuminancesGroundHitPt( 2 ) = ComplexWind( IWin ).DaylghtGeom( CurCplxFenState ).RefPoint( iRefPoint ).GndPt( iGndElem, WinEl ).y;
+						ComplexFenestrationLuminancesGroundHitPt( 3 ) = ComplexWind( IWin ).DaylghtGeom( CurCplxFenState ).RefPoint( iRefPoint ).GndPt( iGndElem, WinEl ).z;
 					} else {
-						GroundHitPt( 1 ) = ComplexWind( IWin ).DaylghtGeom( CurCplxFenState ).IlluminanceMap( iRefPoint, MapNum ).GndPt( iGndElem, WinEl ).x;
-						GroundHitPt( 2 ) = ComplexWind( IWin ).DaylghtGeom( CurCplxFenState ).IlluminanceMap( iRefPoint, MapNum ).GndPt( iGndElem, WinEl ).y;
-						GroundHitPt( 3 ) = ComplexWind( IWin ).DaylghtGeom( CurCplxFenState ).IlluminanceMap( iRefPoint, MapNum ).GndPt( iGndElem, WinEl ).z;
+						ComplexFenestrationLuminancesGroundHitPt( 1 ) = ComplexWind( IWin ).DaylghtGeom( CurCplxFenState ).IlluminanceMap( iRefPoint, MapNum ).GndPt( iGndElem, WinEl ).x;
+						ComplexFenestrationLuminancesGroundHitPt( 2 ) = ComplexWind( IWin ).DaylghtGeom( CurCplxFenState ).IlluminanceMap( iRefPoint, MapNum ).GndPt( iGndElem, WinEl ).y;
+						ComplexFenestrationLuminancesGroundHitPt( 3 ) = ComplexWind( IWin ).DaylghtGeom( CurCplxFenState ).IlluminanceMap( iRefPoint, MapNum ).GndPt( iGndElem, WinEl ).z;
 					}
 
-					PierceSurface( ObsSurfNum, GroundHitPt, SUNCOS_IHR, ObsHitPt, hitObs );
+					PierceSurface( ObsSurfNum, ComplexFenestrationLuminancesGroundHitPt, SUNCOS_IHR, ComplexFenestrationLuminancesObsHitPt, hitObs );
 					if ( hitObs ) break;
 				}
 				if ( hitObs ) SunObstrMultiplier = 0.0;
@@ -7955,7 +8249,6 @@ namespace DaylightingManager {
 		Real64 FLSUdiskTot;
 
 		// Total for first relflected fluxes
-		static Vector4< Real64 > FFSKTot;
 		Real64 FFSUTot;
 		Real64 FFSUdiskTot;
 
@@ -8105,11 +8398,9 @@ namespace DaylightingManager {
 		Array1D< Real64 > ElementLuminanceSunDisk; // sun related luminance at window element (exterior side),
 		// due to sun beam
 
-		static Vector4< Real64 > WinLumSK; // Sky related window luminance
 		Real64 WinLumSU; // Sun related window luminance, excluding entering beam
 		//REAL(r64) :: WinLumSUdisk  ! Sun related window luminance, due to entering beam
 
-		static Vector4< Real64 > EDirSky; // Sky related direct illuminance
 		Real64 EDirSun; // Sun related direct illuminance, excluding entering beam
 //		Real64 EDirSunDisk; // Sun related direct illuminance, due to entering beam //Unused Set but never used
 
@@ -8238,8 +8529,6 @@ namespace DaylightingManager {
 		Real64 WinLumSunDisk; // window luminance from sun disk
 		Real64 ELumSunDisk; // window illuminance from sun disk
 		Real64 TransBeam; // transmittance of the beam for given direction
-		static Vector3< Real64 > V; // temporary vector
-		static Vector3< Real64 > RWin; // Window center
 		Real64 RayZ; // z component of unit vector for outgoing direction
 		bool refPointIntersect;
 
@@ -8293,16 +8582,16 @@ namespace DaylightingManager {
 					}
 					LambdaTrn = ComplexWind( iWin ).Geom( CurCplxFenState ).Trn.Lamda( iTrnElem );
 
-					V( 1 ) = ComplexWind( iWin ).Geom( CurCplxFenState ).sTrn( iTrnElem ).x;
-					V( 2 ) = ComplexWind( iWin ).Geom( CurCplxFenState ).sTrn( iTrnElem ).y;
-					V( 3 ) = ComplexWind( iWin ).Geom( CurCplxFenState ).sTrn( iTrnElem ).z;
-					V = -V;
+					DayltgDirectSunDiskComplexFenestrationV( 1 ) = ComplexWind( iWin ).Geom( CurCplxFenState ).sTrn( iTrnElem ).x;
+					DayltgDirectSunDiskComplexFenestrationV( 2 ) = ComplexWind( iWin ).Geom( CurCplxFenState ).sTrn( iTrnElem ).y;
+					DayltgDirectSunDiskComplexFenestrationV( 3 ) = ComplexWind( iWin ).Geom( CurCplxFenState ).sTrn( iTrnElem ).z;
+					DayltgDirectSunDiskComplexFenestrationV = -DayltgDirectSunDiskComplexFenestrationV;
 
-					RWin( 1 ) = Surface( iWin ).Centroid.x;
-					RWin( 2 ) = Surface( iWin ).Centroid.y;
-					RWin( 3 ) = Surface( iWin ).Centroid.z;
+					DayltgDirectSunDiskComplexFenestrationRWin( 1 ) = Surface( iWin ).Centroid.x;
+					DayltgDirectSunDiskComplexFenestrationRWin( 2 ) = Surface( iWin ).Centroid.y;
+					DayltgDirectSunDiskComplexFenestrationRWin( 3 ) = Surface( iWin ).Centroid.z;
 
-					DayltgHitObstruction( iHour, iWin, RWin, V, TransBeam );
+					DayltgHitObstruction( iHour, iWin, DayltgDirectSunDiskComplexFenestrationRWin, DayltgDirectSunDiskComplexFenestrationV, TransBeam );
 
 					WinLumSunDisk += ( 14700.0 * std::sqrt( 0.000068 * PosFac ) * double( NumEl ) / std::pow( WindowSolidAngleDaylightPoint, 0.8 ) ) * dirTrans * LambdaTrn * TransBeam;
 
@@ -8465,12 +8754,9 @@ namespace DaylightingManager {
 		Real64 ElevWin; // Window elevation: angle between window outward normal and horizontal (radians)
 		Real64 AzimWin; // Window azimuth (radians)
 		Real64 AzimSun; // Sun azimuth (radians)
-		static Vector3< Real64 > WinNorm; // Window outward normal unit vector
 		Real64 ThWin; // Azimuth angle of WinNorm
-		static Vector3< Real64 > SunPrime; // Projection of sun vector onto plane (perpendicular to
 		//  window plane) determined by WinNorm and vector along
 		//  baseline of window
-		static Vector3< Real64 > WinNormCrossBase; // Cross product of WinNorm and vector along window baseline
 		//  INTEGER            :: IComp             ! Vector component index
 
 		// FLOW:
@@ -8544,7 +8830,6 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		// na
-		static Vector3< Real64 > HitPt; // Hit point on an obstruction (m)
 		bool hit; // True iff obstruction is hit
 
 		// FLOW:
@@ -8661,10 +8946,8 @@ namespace DaylightingManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Vector3< Real64 > ReflNorm; // Unit normal to reflecting surface (m)
 		int ObsSurfNum; // Obstruction surface number
 		bool hitObs; // True iff obstruction is hit
-		static Vector3< Real64 > ObsHitPt; // Hit point on obstruction (m)
 		Real64 CosIncAngAtHitPt; // Cosine of angle of incidence of sun at HitPt
 		Real64 DiffVisRefl; // Diffuse visible reflectance of ReflSurfNum
 
@@ -8674,15 +8957,15 @@ namespace DaylightingManager {
 		// Skip daylighting shelves since reflection from these is separately calculated
 		if ( Surface( ReflSurfNum ).Shelf > 0 ) return;
 		// Normal to reflecting surface in hemisphere containing window element
-		ReflNorm = Surface( ReflSurfNum ).OutNormVec;
+		DayltgSurfaceLumFromSunReflNorm = Surface( ReflSurfNum ).OutNormVec;
 		if ( Surface( ReflSurfNum ).ShadowingSurf ) {
-			if ( dot( ReflNorm, Ray ) > 0.0 ) {
-				ReflNorm *= -1.0;
+			if ( dot( DayltgSurfaceLumFromSunReflNorm, Ray ) > 0.0 ) {
+				DayltgSurfaceLumFromSunReflNorm *= -1.0;
 			}
 		}
 		// Cosine of angle of incidence of sun at HitPt if sun were to reach HitPt
 		Vector3< Real64 > const SUNCOS_IHR( SUNCOSHR( IHR, {1,3} ) );
-		CosIncAngAtHitPt = dot( ReflNorm, SUNCOS_IHR );
+		CosIncAngAtHitPt = dot( DayltgSurfaceLumFromSunReflNorm, SUNCOS_IHR );
 		// Require that the sun be in front of this surface relative to window element
 		if ( CosIncAngAtHitPt <= 0.0 ) return; // Sun is in back of reflecting surface
 		// Sun reaches ReflHitPt if vector from ReflHitPt to sun is unobstructed
@@ -8691,7 +8974,7 @@ namespace DaylightingManager {
 			if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 			// Exclude as a possible obstructor ReflSurfNum and its base surface (if it has one)
 			if ( ObsSurfNum == ReflSurfNum || ObsSurfNum == Surface( ReflSurfNum ).BaseSurf ) continue;
-			PierceSurface( ObsSurfNum, ReflHitPt, SUNCOS_IHR, ObsHitPt, hitObs );
+			PierceSurface( ObsSurfNum, ReflHitPt, SUNCOS_IHR, DayltgSurfaceLumFromSunObsHitPt, hitObs );
 			if ( hitObs ) break;
 		}
 		if ( hitObs ) return; // Obstruction was hit, blocking sun
@@ -8753,7 +9036,6 @@ namespace DaylightingManager {
 		using General::InterpSlatAng;
 
 		// Locals
-		static Array1D< Real64 > daylight_illum;
 
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
@@ -8772,15 +9054,9 @@ namespace DaylightingManager {
 		int ISky; // Sky type index
 		int ISky1; // Sky type index values for averaging two sky types
 		int ISky2;
-		static Array2D< Real64 > DFSKHR( 2, 4 ); // Sky daylight factor for sky type (first index),
 		//   bare/shaded window (second index)
-		static Vector2< Real64 > DFSUHR; // Sun daylight factor for bare/shaded window
-		static Array2D< Real64 > BFSKHR( 2, 4 ); // Sky background luminance factor for sky type (first index),
 		//   bare/shaded window (second index)
-		static Vector2< Real64 > BFSUHR; // Sun background luminance factor for bare/shaded window
-		static Array2D< Real64 > SFSKHR( 2, 4 ); // Sky source luminance factor for sky type (first index),
 		//   bare/shaded window (second index)
-		static Vector2< Real64 > SFSUHR; // Sun source luminance factor for bare/shaded window
 		int IL; // Reference point index
 		int IWin; // Window index
 		int IS; // IS=1 for unshaded window, =2 for shaded window
@@ -8789,7 +9065,6 @@ namespace DaylightingManager {
 		//                                   !  daylighting setpoint; =0 otherwise.
 		int ICtrl; // Window shading control pointer
 		Real64 SkyWeight; // Weighting factor used to average two different sky types
-		static Vector4< Real64 > HorIllSky; // Horizontal illuminance for different sky types
 		Real64 HorIllSkyFac; // Ratio between horizontal illuminance from sky horizontal irradiance and
 		//   luminous efficacy and horizontal illuminance from averaged sky
 		Real64 SlatAng; // Blind slat angle (rad)
@@ -8798,9 +9073,6 @@ namespace DaylightingManager {
 		Real64 GTOT;
 		Real64 GTOT1;
 		Real64 GTOT2;
-		static Array1D< Real64 > BACLUM;
-		static Array1D< Real64 > GLRNDX;
-		static bool FirstTimeFlag( true );
 		int ILB;
 
 		int IConst;
@@ -8808,16 +9080,13 @@ namespace DaylightingManager {
 		Real64 VTNow;
 		Real64 VTMaster;
 
-		static Real64 VTDark( 0.0 ); // Visible transmittance (VT) of electrochromic (EC) windows in fully dark state
-		static Real64 VTMULT( 1.0 ); // VT multiplier for EC windows
-		static int IConstShaded( 0 ); // The shaded window construction for switchable windows
 		int MapNum;
 		int ILM;
 
 		if ( FirstTimeFlag ) {
 			daylight_illum.allocate( MaxMapRefPoints );
 			BACLUM.allocate( MaxMapRefPoints );
-			GLRNDX.allocate( MaxMapRefPoints );
+			DayltgInteriorMapIllumGLRNDX.allocate( MaxMapRefPoints );
 			FirstTimeFlag = false;
 		}
 
@@ -8831,7 +9100,7 @@ namespace DaylightingManager {
 
 			daylight_illum = 0.0;
 			BACLUM = 0.0;
-			GLRNDX = 0.0;
+			DayltgInteriorMapIllumGLRNDX = 0.0;
 
 			if ( SkyClearness > 3.0 ) { //Sky is average of clear and clear turbid
 				SkyWeight = min( 1.0, ( SkyClearness - 3.0 ) / 3.0 );
@@ -8876,22 +9145,22 @@ namespace DaylightingManager {
 					//          Daylight factors for current sun position
 					for ( ISky = 1; ISky <= 4; ++ISky ) {
 						//                                ===Bare window===
-						DFSKHR( 1, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylIllFacSky( HourOfDay, 1, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylIllFacSky( PreviousHour, 1, ISky, ILB, loop ) );
+						DayltgInteriorMapIllumDFSKHR( 1, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylIllFacSky( HourOfDay, 1, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylIllFacSky( PreviousHour, 1, ISky, ILB, loop ) );
 
 						if ( ISky == 1 ) {
-							DFSUHR( 1 ) = VTRatio * ( WeightNow * ( IllumMapCalc( MapNum ).DaylIllFacSun( HourOfDay, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylIllFacSunDisk( HourOfDay, 1, ILB, loop ) ) + WeightPreviousHour * ( IllumMapCalc( MapNum ).DaylIllFacSun( PreviousHour, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylIllFacSunDisk( PreviousHour, 1, ILB, loop ) ) );
+							DayltgInteriorMapIllumDFSUHR( 1 ) = VTRatio * ( WeightNow * ( IllumMapCalc( MapNum ).DaylIllFacSun( HourOfDay, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylIllFacSunDisk( HourOfDay, 1, ILB, loop ) ) + WeightPreviousHour * ( IllumMapCalc( MapNum ).DaylIllFacSun( PreviousHour, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylIllFacSunDisk( PreviousHour, 1, ILB, loop ) ) );
 						}
 
-						BFSKHR( 1, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSky( HourOfDay, 1, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSky( PreviousHour, 1, ISky, ILB, loop ) );
+						DayltgInteriorMapIllumBFSKHR( 1, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSky( HourOfDay, 1, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSky( PreviousHour, 1, ISky, ILB, loop ) );
 
 						if ( ISky == 1 ) {
-							BFSUHR( 1 ) = VTRatio * ( WeightNow * ( IllumMapCalc( MapNum ).DaylBackFacSun( HourOfDay, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylBackFacSunDisk( HourOfDay, 1, ILB, loop ) ) + WeightPreviousHour * ( IllumMapCalc( MapNum ).DaylBackFacSun( PreviousHour, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylBackFacSunDisk( PreviousHour, 1, ILB, loop ) ) );
+							DayltgInteriorMapIllumBFSUHR( 1 ) = VTRatio * ( WeightNow * ( IllumMapCalc( MapNum ).DaylBackFacSun( HourOfDay, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylBackFacSunDisk( HourOfDay, 1, ILB, loop ) ) + WeightPreviousHour * ( IllumMapCalc( MapNum ).DaylBackFacSun( PreviousHour, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylBackFacSunDisk( PreviousHour, 1, ILB, loop ) ) );
 						}
 
-						SFSKHR( 1, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSky( HourOfDay, 1, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSky( PreviousHour, 1, ISky, ILB, loop ) );
+						DayltgInteriorMapIllumSFSKHR( 1, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSky( HourOfDay, 1, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSky( PreviousHour, 1, ISky, ILB, loop ) );
 
 						if ( ISky == 1 ) {
-							SFSUHR( 1 ) = VTRatio * ( WeightNow * ( IllumMapCalc( MapNum ).DaylSourceFacSun( HourOfDay, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylSourceFacSunDisk( HourOfDay, 1, ILB, loop ) ) + WeightPreviousHour * ( IllumMapCalc( MapNum ).DaylSourceFacSun( PreviousHour, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylSourceFacSunDisk( PreviousHour, 1, ILB, loop ) ) );
+							DayltgInteriorMapIllumSFSUHR( 1 ) = VTRatio * ( WeightNow * ( IllumMapCalc( MapNum ).DaylSourceFacSun( HourOfDay, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylSourceFacSunDisk( HourOfDay, 1, ILB, loop ) ) + WeightPreviousHour * ( IllumMapCalc( MapNum ).DaylSourceFacSun( PreviousHour, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylSourceFacSunDisk( PreviousHour, 1, ILB, loop ) ) );
 						}
 
 						if ( SurfaceWindow( IWin ).ShadingFlag >= 1 || SurfaceWindow( IWin ).SolarDiffusing ) {
@@ -8899,31 +9168,31 @@ namespace DaylightingManager {
 							//                                 ===Shaded window===
 							if ( ! SurfaceWindow( IWin ).MovableSlats ) {
 								// Shade, screen, blind with fixed slats, or diffusing glass
-								DFSKHR( 2, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylIllFacSky( HourOfDay, 2, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylIllFacSky( PreviousHour, 2, ISky, ILB, loop ) );
+								DayltgInteriorMapIllumDFSKHR( 2, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylIllFacSky( HourOfDay, 2, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylIllFacSky( PreviousHour, 2, ISky, ILB, loop ) );
 
 								if ( ISky == 1 ) {
-									DFSUHR( 2 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylIllFacSun( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylIllFacSun( PreviousHour, 2, ILB, loop ) );
+									DayltgInteriorMapIllumDFSUHR( 2 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylIllFacSun( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylIllFacSun( PreviousHour, 2, ILB, loop ) );
 
 									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										DFSUHR( 2 ) += VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylIllFacSunDisk( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylIllFacSunDisk( PreviousHour, 2, ILB, loop ) );
+										DayltgInteriorMapIllumDFSUHR( 2 ) += VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylIllFacSunDisk( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylIllFacSunDisk( PreviousHour, 2, ILB, loop ) );
 									}
 								}
 
-								BFSKHR( 2, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSky( HourOfDay, 2, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSky( PreviousHour, 2, ISky, ILB, loop ) );
+								DayltgInteriorMapIllumBFSKHR( 2, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSky( HourOfDay, 2, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSky( PreviousHour, 2, ISky, ILB, loop ) );
 
 								if ( ISky == 1 ) {
-									BFSUHR( 2 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSun( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSun( PreviousHour, 2, ILB, loop ) );
+									DayltgInteriorMapIllumBFSUHR( 2 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSun( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSun( PreviousHour, 2, ILB, loop ) );
 									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										BFSUHR( 2 ) += VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSunDisk( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSunDisk( PreviousHour, 2, ILB, loop ) );
+										DayltgInteriorMapIllumBFSUHR( 2 ) += VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSunDisk( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSunDisk( PreviousHour, 2, ILB, loop ) );
 									}
 								}
 
-								SFSKHR( 2, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSky( HourOfDay, 2, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSky( PreviousHour, 2, ISky, ILB, loop ) );
+								DayltgInteriorMapIllumSFSKHR( 2, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSky( HourOfDay, 2, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSky( PreviousHour, 2, ISky, ILB, loop ) );
 
 								if ( ISky == 1 ) {
-									SFSUHR( 2 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSun( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSun( PreviousHour, 2, ILB, loop ) );
+									DayltgInteriorMapIllumSFSUHR( 2 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSun( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSun( PreviousHour, 2, ILB, loop ) );
 									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										SFSUHR( 2 ) += VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSunDisk( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSunDisk( PreviousHour, 2, ILB, loop ) );
+										DayltgInteriorMapIllumSFSUHR( 2 ) += VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSunDisk( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSunDisk( PreviousHour, 2, ILB, loop ) );
 									}
 								}
 
@@ -8931,37 +9200,37 @@ namespace DaylightingManager {
 								VarSlats = SurfaceWindow( IWin ).MovableSlats;
 								SlatAng = SurfaceWindow( IWin ).SlatAngThisTS;
 
-								DFSKHR( 2, ISky ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSky( HourOfDay, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSky( PreviousHour, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) );
+								DayltgInteriorMapIllumDFSKHR( 2, ISky ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSky( HourOfDay, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSky( PreviousHour, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) );
 
 								if ( ISky == 1 ) {
-									DFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSun( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSun( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
+									DayltgInteriorMapIllumDFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSun( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSun( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
 
 									// We add the contribution from the solar disk if slats do not block beam solar
 									// TH CR 8010, DaylIllFacSunDisk needs to be interpolated
 									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										DFSUHR( 2 ) += VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSunDisk( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSunDisk( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
+										DayltgInteriorMapIllumDFSUHR( 2 ) += VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSunDisk( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSunDisk( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
 									}
 								}
 
-								BFSKHR( 2, ISky ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSky( HourOfDay, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSky( PreviousHour, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) );
+								DayltgInteriorMapIllumBFSKHR( 2, ISky ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSky( HourOfDay, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSky( PreviousHour, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) );
 
 								if ( ISky == 1 ) {
-									BFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSun( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSun( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
+									DayltgInteriorMapIllumBFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSun( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSun( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
 
 									// TH CR 8010, DaylBackFacSunDisk needs to be interpolated
 									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										BFSUHR( 2 ) += VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSunDisk( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSunDisk( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
+										DayltgInteriorMapIllumBFSUHR( 2 ) += VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSunDisk( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSunDisk( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
 									}
 								}
 
-								SFSKHR( 2, ISky ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSky( HourOfDay, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSky( PreviousHour, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) );
+								DayltgInteriorMapIllumSFSKHR( 2, ISky ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSky( HourOfDay, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSky( PreviousHour, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) );
 
 								if ( ISky == 1 ) {
-									SFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSun( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSun( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
+									DayltgInteriorMapIllumSFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSun( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSun( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
 
 									// TH CR 8010, DaylSourceFacSunDisk needs to be interpolated
 									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
-										SFSUHR( 2 ) += VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSunDisk( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSunDisk( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
+										DayltgInteriorMapIllumSFSUHR( 2 ) += VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSunDisk( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSunDisk( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
 									}
 								}
 
@@ -8977,22 +9246,22 @@ namespace DaylightingManager {
 					// Adding 0.001 in the following prevents zero HorIllSky in early morning or late evening when sun
 					// is up in the present time step but GILSK(ISky,HourOfDay) and GILSK(ISky,NextHour) are both zero.
 					for ( ISky = 1; ISky <= 4; ++ISky ) {
-						HorIllSky( ISky ) = WeightNow * GILSK( HourOfDay, ISky ) + WeightPreviousHour * GILSK( PreviousHour, ISky ) + 0.001;
+						DayltgInteriorMapIllumHorIllSky( ISky ) = WeightNow * GILSK( HourOfDay, ISky ) + WeightPreviousHour * GILSK( PreviousHour, ISky ) + 0.001;
 					}
 
 					// HISKF is current time step horizontal illuminance from sky, calculated in DayltgLuminousEfficacy,
 					// which is called in WeatherManager. HISUNF is current time step horizontal illuminance from sun,
 					// also calculated in DayltgLuminousEfficacy.
-					HorIllSkyFac = HISKF / ( ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) + SkyWeight * HorIllSky( ISky1 ) );
+					HorIllSkyFac = HISKF / ( ( 1.0 - SkyWeight ) * DayltgInteriorMapIllumHorIllSky( ISky2 ) + SkyWeight * DayltgInteriorMapIllumHorIllSky( ISky1 ) );
 
 					for ( IS = 1; IS <= 2; ++IS ) {
 						if ( IS == 2 && SurfaceWindow( IWin ).ShadingFlag <= 0 && ! SurfaceWindow( IWin ).SolarDiffusing ) break;
 
-						IllumMapCalc( MapNum ).IllumFromWinAtMapPt( loop, IS, ILB ) = DFSUHR( IS ) * HISUNF + HorIllSkyFac * ( DFSKHR( IS, ISky1 ) * SkyWeight * HorIllSky( ISky1 ) + DFSKHR( IS, ISky2 ) * ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) );
+						IllumMapCalc( MapNum ).IllumFromWinAtMapPt( loop, IS, ILB ) = DayltgInteriorMapIllumDFSUHR( IS ) * HISUNF + HorIllSkyFac * ( DayltgInteriorMapIllumDFSKHR( IS, ISky1 ) * SkyWeight * DayltgInteriorMapIllumHorIllSky( ISky1 ) + DayltgInteriorMapIllumDFSKHR( IS, ISky2 ) * ( 1.0 - SkyWeight ) * DayltgInteriorMapIllumHorIllSky( ISky2 ) );
 
-						IllumMapCalc( MapNum ).BackLumFromWinAtMapPt( loop, IS, ILB ) = BFSUHR( IS ) * HISUNF + HorIllSkyFac * ( BFSKHR( IS, ISky1 ) * SkyWeight * HorIllSky( ISky1 ) + BFSKHR( IS, ISky2 ) * ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) );
+						IllumMapCalc( MapNum ).BackLumFromWinAtMapPt( loop, IS, ILB ) = DayltgInteriorMapIllumBFSUHR( IS ) * HISUNF + HorIllSkyFac * ( DayltgInteriorMapIllumBFSKHR( IS, ISky1 ) * SkyWeight * DayltgInteriorMapIllumHorIllSky( ISky1 ) + DayltgInteriorMapIllumBFSKHR( IS, ISky2 ) * ( 1.0 - SkyWeight ) * DayltgInteriorMapIllumHorIllSky( ISky2 ) );
 
-						IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( loop, IS, ILB ) = SFSUHR( IS ) * HISUNF + HorIllSkyFac * ( SFSKHR( IS, ISky1 ) * SkyWeight * HorIllSky( ISky1 ) + SFSKHR( IS, ISky2 ) * ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) );
+						IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( loop, IS, ILB ) = DayltgInteriorMapIllumSFSUHR( IS ) * HISUNF + HorIllSkyFac * ( DayltgInteriorMapIllumSFSKHR( IS, ISky1 ) * SkyWeight * DayltgInteriorMapIllumHorIllSky( ISky1 ) + DayltgInteriorMapIllumSFSKHR( IS, ISky2 ) * ( 1.0 - SkyWeight ) * DayltgInteriorMapIllumHorIllSky( ISky2 ) );
 						IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( loop, IS, ILB ) = max( IllumMapCalc( MapNum ).SourceLumFromWinAtMapPt( loop, IS, ILB ), 0.0 );
 					}
 
@@ -9066,15 +9335,15 @@ namespace DaylightingManager {
 				}
 
 				// Glare index (adding 0.000001 prevents LOG10 (0))
-				GLRNDX( IL ) = 10.0 * std::log10( GTOT + 0.000001 );
+				DayltgInteriorMapIllumGLRNDX( IL ) = 10.0 * std::log10( GTOT + 0.000001 );
 				// Set glare index to zero for GTOT < 1
-				GLRNDX( IL ) = max( 0.0, GLRNDX( IL ) );
+				DayltgInteriorMapIllumGLRNDX( IL ) = max( 0.0, DayltgInteriorMapIllumGLRNDX( IL ) );
 			}
 
 			//              Variables for reporting
 			for ( IL = 1; IL <= NREFPT; ++IL ) {
 				IllumMapCalc( MapNum ).DaylIllumAtMapPt( IL ) = max( daylight_illum( IL ), 0.0 );
-				IllumMapCalc( MapNum ).GlareIndexAtMapPt( IL ) = GLRNDX( IL );
+				IllumMapCalc( MapNum ).GlareIndexAtMapPt( IL ) = DayltgInteriorMapIllumGLRNDX( IL );
 			}
 		}
 
@@ -9129,29 +9398,20 @@ namespace DaylightingManager {
 		//  REAL(r64)           :: NumOut
 		int IllumOut;
 
-		static bool firstTime( true );
-		static Array1D_bool FirstTimeMaps;
-		static Array1D_bool EnvrnPrint;
-		static Array1D_string SavedMnDy;
-		static Array2D_string RefPts;
 		std::string MapNoString;
 		std::string HrString;
 		int linelen;
 		std::string AddXorYString;
 		// BSLLC Start
-		static Array1D< Real64 > XValue;
-		static Array1D< Real64 > YValue;
-		static Array2D< Real64 > IllumValue;
 		int SQMonth;
 		int SQDayOfMonth;
 		int IllumIndex;
-		static bool SQFirstTime( true );
 //		static bool CommaDelimited( true ); //Unused Set but never used
 		// BSLLC Finish
 
 		// FLOW:
-		if ( firstTime ) {
-			firstTime = false;
+		if ( ReportIllumMap_firstTime ) {
+			ReportIllumMap_firstTime = false;
 			FirstTimeMaps.dimension( TotIllumMaps, true );
 			EnvrnPrint.dimension( TotIllumMaps, true );
 			RefPts.allocate( NumOfZones, MaxRefPoints );
@@ -9331,9 +9591,7 @@ Label903: ;
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int MapOutputFile;
 		int MapNum;
-		static int ios( 0 );
 		int NumLines;
 
 		if ( TotIllumMaps > 0 ) {
@@ -9920,18 +10178,8 @@ Label903: ;
 		// one or more exterior windows
 		Real64 IntWinSolidAng; // Approximation to solid angle subtended by an interior window
 		// from a point a distance SQRT(zone floor area) away.
-		static Vector3< Real64 > W1; // Window vertices
-		static Vector3< Real64 > W2;
-		static Vector3< Real64 > W3;
-		static Vector3< Real64 > WC; // Center point of window
-		static Vector3< Real64 > W21; // Unit vectors from window vertex 2 to 1 and 2 to 3
-		static Vector3< Real64 > W23;
 		Real64 HW; // Window height and width (m)
 		Real64 WW;
-		static Vector3< Real64 > RREF; // Location of a reference point in absolute coordinate system
-		static Vector3< Real64 > Ray; // Unit vector along ray from reference point to window center
-		static Vector3< Real64 > REFWC; // Vector from reference point to center of window
-		static Vector3< Real64 > WNORM; // Unit vector normal to window (pointing away from room)
 		Real64 DIS; // Distance from ref point to window center (m)
 		Real64 COSB; // Cosine of angle between ray from ref pt to center of window
 		//  and window outward normal
@@ -9955,44 +10203,44 @@ Label903: ;
 					if ( IntWinNextToIntWinAdjZone ) {
 						for ( IL = 1; IL <= ZoneDaylight( ZoneNum ).TotalDaylRefPoints; ++IL ) {
 							// Reference point in absolute coordinate system
-							RREF = ZoneDaylight( ZoneNum ).DaylRefPtAbsCoord( {1,3}, IL );
+							CalcMinIntWinSolidAngsRREF = ZoneDaylight( ZoneNum ).DaylRefPtAbsCoord( {1,3}, IL );
 							is_Triangle = ( Surface( IWin ).Sides == 3 );
 							is_Rectangle = ( Surface( IWin ).Sides == 4 );
 							if ( is_Rectangle ) {
 								// Vertices of window numbered counter-clockwise starting at upper left as viewed
 								// from inside of room. Assumes original vertices are numbered counter-clockwise from
 								// upper left as viewed from outside.
-								W3 = Surface( IWin ).Vertex( 2 );
-								W2 = Surface( IWin ).Vertex( 3 );
-								W1 = Surface( IWin ).Vertex( 4 );
+								CalcMinIntWinSolidAngsW3 = Surface( IWin ).Vertex( 2 );
+								CalcMinIntWinSolidAngsW2 = Surface( IWin ).Vertex( 3 );
+								CalcMinIntWinSolidAngsW1 = Surface( IWin ).Vertex( 4 );
 							} else if ( is_Triangle ) {
-								W3 = Surface( IWin ).Vertex( 2 );
-								W2 = Surface( IWin ).Vertex( 3 );
-								W1 = Surface( IWin ).Vertex( 1 );
+								CalcMinIntWinSolidAngsW3 = Surface( IWin ).Vertex( 2 );
+								CalcMinIntWinSolidAngsW2 = Surface( IWin ).Vertex( 3 );
+								CalcMinIntWinSolidAngsW1 = Surface( IWin ).Vertex( 1 );
 							}
 							// Unit vectors from window vertex 2 to 1 and 2 to 3, center point of window,
 							// and vector from ref pt to center of window
-							W21 = W1 - W2;
-							W23 = W3 - W2;
-							HW = W21.magnitude();
-							WW = W23.magnitude();
+							CalcMinIntWinSolidAngsW21 = CalcMinIntWinSolidAngsW1 - CalcMinIntWinSolidAngsW2;
+							CalcMinIntWinSolidAngsW23 = CalcMinIntWinSolidAngsW3 - CalcMinIntWinSolidAngsW2;
+							HW = CalcMinIntWinSolidAngsW21.magnitude();
+							WW = CalcMinIntWinSolidAngsW23.magnitude();
 							if ( is_Rectangle ) {
-								WC = W2 + ( W23 + W21 ) / 2.0;
+								CalcMinIntWinSolidAngsWC = CalcMinIntWinSolidAngsW2 + ( CalcMinIntWinSolidAngsW23 + CalcMinIntWinSolidAngsW21 ) / 2.0;
 							} else if ( is_Triangle ) {
-								WC = W2 + ( W23 + W21 ) / 3.0;
+								CalcMinIntWinSolidAngsWC = CalcMinIntWinSolidAngsW2 + ( CalcMinIntWinSolidAngsW23 + CalcMinIntWinSolidAngsW21 ) / 3.0;
 							}
 							// Vector from ref point to center of window
-							REFWC = WC - RREF;
-							W21 /= HW;
-							W23 /= WW;
+							CalcMinIntWinSolidAngsREFWC = CalcMinIntWinSolidAngsWC - CalcMinIntWinSolidAngsRREF;
+							CalcMinIntWinSolidAngsW21 /= HW;
+							CalcMinIntWinSolidAngsW23 /= WW;
 							// Unit vector normal to window (pointing away from room)
-							WNORM = Surface( IWin ).OutNormVec;
+							CalcMinIntWinSolidAngsWNORM = Surface( IWin ).OutNormVec;
 							// Distance from ref point to center of window
-							DIS =  REFWC.magnitude();
+							DIS =  CalcMinIntWinSolidAngsREFWC.magnitude();
 							// Unit vector from ref point to center of window
-							Ray = REFWC / DIS;
+							CalcMinIntWinSolidAngsRay = CalcMinIntWinSolidAngsREFWC / DIS;
 							// Cosine of angle between ray from ref pt to center of window and window outward normal
-							COSB = dot( WNORM, Ray );
+							COSB = dot( CalcMinIntWinSolidAngsWNORM, CalcMinIntWinSolidAngsRay );
 							if ( COSB > 0.01765 ) { // 0 <= B < 89 deg
 								// Above test avoids case where ref point cannot receive daylight directly from the
 								// interior window
@@ -10050,8 +10298,6 @@ Label903: ;
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array1D_string cAlphas( 1 );
-		static Array1D< Real64 > rNumerics;
 		int NAlphas;
 		int NNum;
 		int IOStat;
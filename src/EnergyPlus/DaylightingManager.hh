@@ -134,6 +134,11 @@ namespace DaylightingManager {
 
 	// Functions
 
+	// Clears the global data in DaylightingManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	DayltgAveInteriorReflectance( int & ZoneNum ); // Zone number
 
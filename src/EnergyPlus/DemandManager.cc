@@ -151,6 +151,22 @@ namespace DemandManager {
 
 	// MODULE SUBROUTINES:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool firstTime; // Flag to allow Demand Manager List to simulate at least once
+		bool ManageDemandResimExt; // Flag to resimulate the exterior energy use simulation
+		bool ManageDemandResimHB; // Flag to resimulate the heat balance simulation (including HVAC)
+		bool ManageDemandResimHVAC; // Flag to resimulate the HVAC simulation
+		bool BeginDemandSim; // TRUE in the first timestep after warmup of a new environment
+		bool ClearHistory; // TRUE in the first timestep during warmup of a new environment
+		bool ErrorsFound( false );
+		bool GetDemandManagerInputErrorsFound( false );
+	}
+
 	// Functions
 
 	// Clears the global data in DemandManager.
@@ -166,6 +182,14 @@ namespace DemandManager {
 		GetInput = true;
 		DemandManagerList.deallocate();
 		DemandMgr.deallocate();
+		firstTime = false;
+		ManageDemandResimExt = false;
+		ManageDemandResimHB = false;
+		ManageDemandResimHVAC = false;
+		BeginDemandSim = false;
+		ClearHistory = false;
+		ErrorsFound = false;
+		GetDemandManagerInputErrorsFound = false;
 	}
 
 	void
@@ -190,12 +214,6 @@ namespace DemandManager {
 		// Locals
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ListNum;
-		static bool firstTime; // Flag to allow Demand Manager List to simulate at least once
-		static bool ResimExt; // Flag to resimulate the exterior energy use simulation
-		static bool ResimHB; // Flag to resimulate the heat balance simulation (including HVAC)
-		static bool ResimHVAC; // Flag to resimulate the HVAC simulation
-		static bool BeginDemandSim; // TRUE in the first timestep after warmup of a new environment
-		static bool ClearHistory; // TRUE in the first timestep during warmup of a new environment
 
 		// FLOW:
 		if ( GetInput && ! DoingSizing ) {
@@ -245,22 +263,22 @@ namespace DemandManager {
 				DemandManagerHVACIterations = 0;
 
 				firstTime = true;
-				ResimExt = false;
-				ResimHB = false;
-				ResimHVAC = false;
+				ManageDemandResimExt = false;
+				ManageDemandResimHB = false;
+				ManageDemandResimHVAC = false;
 
-				while ( firstTime || ResimExt || ResimHB || ResimHVAC ) {
+				while ( firstTime || ManageDemandResimExt || ManageDemandResimHB || ManageDemandResimHVAC ) {
 					firstTime = false;
 
-					Resimulate( ResimExt, ResimHB, ResimHVAC );
-					ResimExt = false;
-					ResimHB = false;
-					ResimHVAC = false;
+					Resimulate( ManageDemandResimExt, ManageDemandResimHB, ManageDemandResimHVAC );
+					ManageDemandResimExt = false;
+					ManageDemandResimHB = false;
+					ManageDemandResimHVAC = false;
 
 					SurveyDemandManagers(); // Determines which Demand Managers can reduce demand
 
 					for ( ListNum = 1; ListNum <= NumDemandManagerList; ++ListNum ) {
-						SimulateDemandManagerList( ListNum, ResimExt, ResimHB, ResimHVAC );
+						SimulateDemandManagerList( ListNum, ManageDemandResimExt, ManageDemandResimHB, ManageDemandResimHVAC );
 					} // ListNum
 
 					ActivateDemandManagers(); // Sets limits on loads
@@ -445,7 +463,6 @@ namespace DemandManager {
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		std::string Units; // String for meter units
-		static bool ErrorsFound( false );
 		std::string CurrentModuleObject; // for ease in renaming.
 
 		// FLOW:
@@ -669,7 +686,6 @@ namespace DemandManager {
 		Array1D< Real64 > NumArray; // Numeric data
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
-		static bool ErrorsFound( false );
 		std::string CurrentModuleObject; // for ease in renaming.
 		int Item;
 		int Item1;
@@ -735,7 +751,7 @@ namespace DemandManager {
 				IsBlank = false;
 				VerifyName( AlphArray( 1 ), DemandMgr, MgrNum - StartIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 					if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 				}
 				DemandMgr( MgrNum ).Name = AlphArray( 1 );
@@ -747,7 +763,7 @@ namespace DemandManager {
 
 					if ( DemandMgr( MgrNum ).AvailSchedule == 0 ) {
 						ShowSevereError( CurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid " + cAlphaFieldNames( 2 ) + "=\"" + AlphArray( 2 ) + "\" not found." );
-						ErrorsFound = true;
+						GetDemandManagerInputErrorsFound = true;
 					}
 				} else {
 					DemandMgr( MgrNum ).AvailSchedule = ScheduleAlwaysOn;
@@ -767,7 +783,7 @@ namespace DemandManager {
 				} else {
 					ShowSevereError( CurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid value" + cAlphaFieldNames( 3 ) + "=\"" + AlphArray( 3 ) + "\"." );
 					ShowContinueError( "...value must be one of Off, Fixed, or Variable." );
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 				}}
 
 				if ( NumArray( 1 ) == 0.0 )
@@ -791,7 +807,7 @@ namespace DemandManager {
 				} else {
 					ShowSevereError( CurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid value" + cAlphaFieldNames( 4 ) + "=\"" + AlphArray( 4 ) + "\"." );
 					ShowContinueError( "...value must be one of All, RotateOne, or RotateMany." );
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 				}}
 
 				if ( NumArray( 4 ) == 0.0 )
@@ -812,7 +828,7 @@ namespace DemandManager {
 
 						} else {
 							ShowSevereError( CurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid " + cAlphaFieldNames( LoadNum + 4 ) + "=\"" + AlphArray( LoadNum + 4 ) + "\" not found." );
-							ErrorsFound = true;
+							GetDemandManagerInputErrorsFound = true;
 
 						}
 					} // LoadNum
@@ -821,7 +837,7 @@ namespace DemandManager {
 				{
 					ShowSevereError(CurrentModuleObject + "=\"" + cAlphaArgs(1) + "\" invalid value for number of loads.");
 					ShowContinueError("Number of loads is calculated to be less than one. Demand manager must have at least one load assigned.");
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 				}
 
 			} // MgrNum
@@ -840,7 +856,7 @@ namespace DemandManager {
 				IsBlank = false;
 				VerifyName( AlphArray( 1 ), DemandMgr, MgrNum - StartIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 					if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 				}
 				DemandMgr( MgrNum ).Name = AlphArray( 1 );
@@ -852,7 +868,7 @@ namespace DemandManager {
 
 					if ( DemandMgr( MgrNum ).AvailSchedule == 0 ) {
 						ShowSevereError( CurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid " + cAlphaFieldNames( 2 ) + "=\"" + AlphArray( 2 ) + "\" not found." );
-						ErrorsFound = true;
+						GetDemandManagerInputErrorsFound = true;
 					}
 				} else {
 					DemandMgr( MgrNum ).AvailSchedule = ScheduleAlwaysOn;
@@ -872,7 +888,7 @@ namespace DemandManager {
 				} else {
 					ShowSevereError( CurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid value" + cAlphaFieldNames( 3 ) + "=\"" + AlphArray( 3 ) + "\"." );
 					ShowContinueError( "...value must be one of Off, Fixed, or Variable." );
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 				}}
 
 				if ( NumArray( 1 ) == 0.0 )
@@ -896,7 +912,7 @@ namespace DemandManager {
 				} else {
 					ShowSevereError( CurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid value" + cAlphaFieldNames( 4 ) + "=\"" + AlphArray( 4 ) + "\"." );
 					ShowContinueError( "...value must be one of All, RotateOne, or RotateMany." );
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 				}}
 
 				if ( NumArray( 4 ) == 0.0 )
@@ -916,7 +932,7 @@ namespace DemandManager {
 							++DemandMgr( MgrNum ).NumOfLoads;
 						} else {
 							ShowSevereError( CurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid " + cAlphaFieldNames( LoadNum + 4 ) + "=\"" + AlphArray( LoadNum + 4 ) + "\" not found." );
-							ErrorsFound = true;
+							GetDemandManagerInputErrorsFound = true;
 						}
 					}
 				}
@@ -946,7 +962,7 @@ namespace DemandManager {
 				{
 					ShowSevereError(CurrentModuleObject + "=\"" + cAlphaArgs(1) + "\" invalid value for number of loads.");
 					ShowContinueError("Number of loads is calculated to be less than one. Demand manager must have at least one load assigned.");
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 				}
 
 			} // MgrNum
@@ -965,7 +981,7 @@ namespace DemandManager {
 				IsBlank = false;
 				VerifyName( AlphArray( 1 ), DemandMgr, MgrNum - StartIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 					if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 				}
 				DemandMgr( MgrNum ).Name = AlphArray( 1 );
@@ -977,7 +993,7 @@ namespace DemandManager {
 
 					if ( DemandMgr( MgrNum ).AvailSchedule == 0 ) {
 						ShowSevereError( CurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid " + cAlphaFieldNames( 2 ) + "=\"" + AlphArray( 2 ) + "\" not found." );
-						ErrorsFound = true;
+						GetDemandManagerInputErrorsFound = true;
 					}
 				} else {
 					DemandMgr( MgrNum ).AvailSchedule = ScheduleAlwaysOn;
@@ -997,7 +1013,7 @@ namespace DemandManager {
 				} else {
 					ShowSevereError( CurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid value" + cAlphaFieldNames( 3 ) + "=\"" + AlphArray( 3 ) + "\"." );
 					ShowContinueError( "...value must be one of Off, Fixed, or Variable." );
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 				}}
 
 				if ( NumArray( 1 ) == 0.0 )
@@ -1021,7 +1037,7 @@ namespace DemandManager {
 				} else {
 					ShowSevereError( CurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid value" + cAlphaFieldNames( 4 ) + "=\"" + AlphArray( 4 ) + "\"." );
 					ShowContinueError( "...value must be one of All, RotateOne, or RotateMany." );
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 				}}
 
 				if ( NumArray( 4 ) == 0.0 )
@@ -1041,7 +1057,7 @@ namespace DemandManager {
 							++DemandMgr( MgrNum ).NumOfLoads;
 						} else {
 							ShowSevereError( CurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid " + cAlphaFieldNames( LoadNum + 4 ) + "=\"" + AlphArray( LoadNum + 4 ) + "\" not found." );
-							ErrorsFound = true;
+							GetDemandManagerInputErrorsFound = true;
 						}
 					}
 				}
@@ -1071,7 +1087,7 @@ namespace DemandManager {
 				{
 					ShowSevereError(CurrentModuleObject + "=\"" + cAlphaArgs(1) + "\" invalid value for number of loads.");
 					ShowContinueError("Number of loads is calculated to be less than one. Demand manager must have at least one load assigned.");
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 				}
 
 			} // MgrNum
@@ -1090,7 +1106,7 @@ namespace DemandManager {
 				IsBlank = false;
 				VerifyName( AlphArray( 1 ), DemandMgr, MgrNum - StartIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 					if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 				}
 				DemandMgr( MgrNum ).Name = AlphArray( 1 );
@@ -1102,7 +1118,7 @@ namespace DemandManager {
 
 					if ( DemandMgr( MgrNum ).AvailSchedule == 0 ) {
 						ShowSevereError( CurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid " + cAlphaFieldNames( 2 ) + "=\"" + AlphArray( 2 ) + "\" not found." );
-						ErrorsFound = true;
+						GetDemandManagerInputErrorsFound = true;
 					}
 				} else {
 					DemandMgr( MgrNum ).AvailSchedule = ScheduleAlwaysOn;
@@ -1122,7 +1138,7 @@ namespace DemandManager {
 				} else {
 					ShowSevereError( CurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid value" + cAlphaFieldNames( 3 ) + "=\"" + AlphArray( 3 ) + "\"." );
 					ShowContinueError( "...value must be one of Off, Fixed, or Variable." );
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 				}}
 
 				if ( NumArray( 1 ) == 0.0 )
@@ -1137,7 +1153,7 @@ namespace DemandManager {
 					ShowSevereError( "Invalid input for " + CurrentModuleObject + " = " + AlphArray( 1 ) );
 					ShowContinueError( cNumericFieldNames( 2 ) + " [" + RoundSigDigits( NumArray( 2 ), 2 ) + "] > " + cNumericFieldNames( 3 ) + " [" + RoundSigDigits( NumArray( 3 ), 2 ) + ']' );
 					ShowContinueError( cNumericFieldNames( 2 ) + " cannot be greater than " + cNumericFieldNames( 3 ) );
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 				}
 
 				// Validate Selection Control
@@ -1154,7 +1170,7 @@ namespace DemandManager {
 				} else {
 					ShowSevereError( CurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid value" + cAlphaFieldNames( 4 ) + "=\"" + AlphArray( 4 ) + "\"." );
 					ShowContinueError( "...value must be one of All, RotateOne, or RotateMany." );
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 				}}
 
 				if ( NumArray( 5 ) == 0.0 )
@@ -1174,7 +1190,7 @@ namespace DemandManager {
 							++DemandMgr( MgrNum ).NumOfLoads;
 						} else {
 							ShowSevereError( CurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid " + cAlphaFieldNames( LoadNum + 4 ) + "=\"" + AlphArray( LoadNum + 4 ) + "\" not found." );
-							ErrorsFound = true;
+							GetDemandManagerInputErrorsFound = true;
 						}
 					}
 				}
@@ -1202,7 +1218,7 @@ namespace DemandManager {
 				{
 					ShowSevereError(CurrentModuleObject + "=\"" + cAlphaArgs(1) + "\" invalid value for number of loads.");
 					ShowContinueError("Number of loads is calculated to be less than one. Demand manager must have at least one load assigned.");
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 				}
 
 			} // MgrNum
@@ -1221,7 +1237,7 @@ namespace DemandManager {
 				IsBlank = false;
 				VerifyName( AlphArray( 1 ), DemandMgr, MgrNum - StartIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 					if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 				}
 				DemandMgr( MgrNum ).Name = AlphArray( 1 );
@@ -1233,7 +1249,7 @@ namespace DemandManager {
 
 					if ( DemandMgr( MgrNum ).AvailSchedule == 0 ) {
 						ShowSevereError( CurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid " + cAlphaFieldNames( 2 ) + "=\"" + AlphArray( 2 ) + "\" not found." );
-						ErrorsFound = true;
+						GetDemandManagerInputErrorsFound = true;
 					}
 				}
 				else {
@@ -1257,7 +1273,7 @@ namespace DemandManager {
 				else {
 					ShowSevereError( CurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid value" + cAlphaFieldNames( 3 ) + "=\"" + AlphArray( 3 ) + "\"." );
 					ShowContinueError( "...value must be one of Off, FixedRate, or ReductionRatio." );
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 				}}
 
 				if ( NumArray( 1 ) == 0.0 )
@@ -1289,7 +1305,7 @@ namespace DemandManager {
 				else {
 					ShowSevereError( CurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid value" + cAlphaFieldNames( 4 ) + "=\"" + AlphArray( 4 ) + "\"." );
 					ShowContinueError( "...value must be one of All, RotateOne, or RotateMany." );
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 				}}
 
 				if ( NumArray( 5 ) == 0.0 )
@@ -1310,7 +1326,7 @@ namespace DemandManager {
 					}
 					else {
 						ShowSevereError( CurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid " + cAlphaFieldNames( LoadNum + AlphaShift ) + "=\"" + AlphArray( LoadNum + AlphaShift ) + "\" not found." );
-						ErrorsFound = true;
+						GetDemandManagerInputErrorsFound = true;
 					}
 				}
 
@@ -1327,7 +1343,7 @@ namespace DemandManager {
 				{
 					ShowSevereError(CurrentModuleObject + "=\"" + cAlphaArgs(1) + "\" invalid value for number of loads.");
 					ShowContinueError("Number of loads is calculated to be less than one. Demand manager must have at least one load assigned.");
-					ErrorsFound = true;
+					GetDemandManagerInputErrorsFound = true;
 				}
 			} // MgrNum
 
@@ -1336,7 +1352,7 @@ namespace DemandManager {
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetDemandManagerInputErrorsFound ) {
 			ShowFatalError( "Errors found in processing input for demand managers. Preceding condition causes termination." );
 		}
 
@@ -198,6 +198,22 @@ namespace DesiccantDehumidifiers {
 		// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
 		bool GetInputDesiccantDehumidifier( true ); // First time, input is "gotten"
 		bool InitDesiccantDehumidifierOneTimeFlag( true );
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool ErrorsFound2( false ); // Set to true if errors in input, fatal at end of routine
+		bool ErrorsFoundGeneric( false ); // Set to true if errors in input, fatal at end of routine
+		int MaxNums( 0 ); // Maximum number of numeric input fields
+		int MaxAlphas( 0 ); // Maximum number of alpha input fields
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		Real64 SteamDensity( 0.0 ); // density of steam at 100C
+		bool MySetPointCheckFlag( true );
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool MyPlantScanFlag; // Used for init plant component for heating coils
+		bool InitDesiccantDehumidifierErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool MyOneTimeFlag( true ); // one time flag
+		Real64 RhoAirStdInit;
+		Real64 QRegen( 0.0 ); // required coil load passed to sim heating coil routine (W)
+		bool CalcGenericDesiccantDehumidifierMyOneTimeFlag( true ); // one time flag
+		Real64 CalcGenericDesiccantDehumidifierRhoAirStdInit; // standard air density (kg/m3)
 	}
 
 	// Name Public routines, optionally name Private routines within this module
@@ -386,9 +402,6 @@ namespace DesiccantDehumidifiers {
 		int NumAlphas; // Number of Alphas for each GetObjectItem call
 		int NumNumbers; // Number of Numbers for each GetObjectItem call
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
-		static bool ErrorsFound2( false ); // Set to true if errors in input, fatal at end of routine
-		static bool ErrorsFoundGeneric( false ); // Set to true if errors in input, fatal at end of routine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool OANodeError; // Flag for check on outside air node
@@ -410,16 +423,12 @@ namespace DesiccantDehumidifiers {
 		Array1D< Real64 > Numbers; // Numeric input items for object
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int MaxNums( 0 ); // Maximum number of numeric input fields
-		static int MaxAlphas( 0 ); // Maximum number of alpha input fields
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 		//  certain object in the input file
 		int RegenCoilAirInletNode; // regen heating coil air inlet node number
 		int RegenCoilAirOutletNode; // regen heating coil air outlet node number
 		bool errFlag; // local error flag
 		std::string RegenCoilType; // Regen heating coil type
 		std::string RegenCoilName; // Regen heating coil name
-		static Real64 SteamDensity( 0.0 ); // density of steam at 100C
 		int SteamIndex; // steam coil Index
 		bool RegairHeatingCoilFlag( false ); // local error flag
 
@@ -1442,11 +1451,7 @@ namespace DesiccantDehumidifiers {
 		int ProcInNode; // inlet node number
 		int RegenInNode; // inlet node number
 		int ControlNode; // control node number
-		static bool MySetPointCheckFlag( true );
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool MyPlantScanFlag; // Used for init plant component for heating coils
 
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		int SteamIndex; // steam coil index
 		Real64 FluidDensity; // steam or water coil fluid density
 		Real64 CoilMaxVolFlowRate; // water or steam max volumetric water flow rate
@@ -1577,7 +1582,7 @@ namespace DesiccantDehumidifiers {
 							ErrorFlag = false;
 							CoilMaxVolFlowRate = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", DesicDehum( DesicDehumNum ).RegenCoilName, ErrorFlag );
 							if ( ErrorFlag ) {
-								ErrorsFound = true;
+								InitDesiccantDehumidifierErrorsFound = true;
 							}
 							if ( CoilMaxVolFlowRate != AutoSize ) {
 								FluidDensity = GetDensityGlycol( PlantLoop( DesicDehum( DesicDehumNum ).LoopNum ).FluidName, DataGlobals::CWInitConvTemp, PlantLoop( DesicDehum( DesicDehumNum ).LoopNum ).FluidIndex, RoutineName );
@@ -1589,7 +1594,7 @@ namespace DesiccantDehumidifiers {
 							ErrorFlag = false;
 							CoilMaxVolFlowRate = GetCoilMaxSteamFlowRate( DesicDehum( DesicDehumNum ).RegenCoilIndex, ErrorFlag );
 							if ( ErrorFlag ) {
-								ErrorsFound = true;
+								InitDesiccantDehumidifierErrorsFound = true;
 							}
 							if ( CoilMaxVolFlowRate != AutoSize ) {
 								SteamIndex = 0; // Function GetSatDensityRefrig will look up steam index if 0 is passed
@@ -1854,8 +1859,6 @@ namespace DesiccantDehumidifiers {
 		Real64 PartLoad; // fraction of dehumidification capacity required to meet setpoint
 		bool UnitOn; // unit on flag
 
-		static bool MyOneTimeFlag( true ); // one time flag
-		static Real64 RhoAirStdInit;
 
 		// Variables for hardwired coefficients for default performance model
 
@@ -2210,7 +2213,6 @@ namespace DesiccantDehumidifiers {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Real64 DDPartLoadRatio; // fraction of dehumidification capacity required to meet setpoint
-		static Real64 QRegen( 0.0 ); // required coil load passed to sim heating coil routine (W)
 		Real64 MassFlowRateNew; // new required mass flow rate calculated to keep regen setpoint temperature (kg/s)
 		Real64 CondenserWasteHeat; // Condenser waste heat (W)
 		Real64 CpAir; // Specific heat of air (J/kg-K)
@@ -2226,8 +2228,6 @@ namespace DesiccantDehumidifiers {
 		int CompanionCoilIndexNum; // index for companion DX cooling coil, 0 when DX coil is not used
 		std::string MinVol; // character string used for error messages
 		std::string VolFlowChar; // character string used for error messages
-		static bool MyOneTimeFlag( true ); // one time flag
-		static Real64 RhoAirStdInit; // standard air density (kg/m3)
 		bool UnitOn; // unit on flag
 		//  LOGICAL       :: SimFlag                    ! used to turn off additional simulation if DX Coil is off
 		Real64 QRegen_OASysFanAdjust; // temporary variable used to adjust regen heater load during iteration
@@ -2251,9 +2251,9 @@ namespace DesiccantDehumidifiers {
 			CompanionCoilIndexNum = 0;
 		}
 
-		if ( MyOneTimeFlag ) {
-			RhoAirStdInit = StdRhoAir;
-			MyOneTimeFlag = false;
+		if ( CalcGenericDesiccantDehumidifierMyOneTimeFlag ) {
+			CalcGenericDesiccantDehumidifierRhoAirStdInit = StdRhoAir;
+			CalcGenericDesiccantDehumidifierMyOneTimeFlag = false;
 		}
 
 		if ( HumRatNeeded < Node( DesicDehum( DesicDehumNum ).ProcAirInNode ).HumRat ) {
@@ -2525,7 +2525,7 @@ namespace DesiccantDehumidifiers {
 
 		// check condenser minimum flow per rated total capacity
 		if ( DDPartLoadRatio > 0.0 && DesicDehum( DesicDehumNum ).ExhaustFanMaxVolFlowRate > 0.0 ) {
-			VolFlowPerRatedTotQ = ( Node( DesicDehum( DesicDehumNum ).RegenAirInNode ).MassFlowRate + ExhaustFanMassFlowRate ) / max( 0.00001, ( DesicDehum( DesicDehumNum ).CompanionCoilCapacity * DDPartLoadRatio * RhoAirStdInit ) );
+			VolFlowPerRatedTotQ = ( Node( DesicDehum( DesicDehumNum ).RegenAirInNode ).MassFlowRate + ExhaustFanMassFlowRate ) / max( 0.00001, ( DesicDehum( DesicDehumNum ).CompanionCoilCapacity * DDPartLoadRatio * CalcGenericDesiccantDehumidifierRhoAirStdInit ) );
 			if ( ! WarmupFlag && ( VolFlowPerRatedTotQ < MinVolFlowPerRatedTotQ ) ) {
 				gio::write( VolFlowChar, fmtLD ) << VolFlowPerRatedTotQ;
 				++DesicDehum( DesicDehumNum ).ErrCount;
@@ -2765,7 +2765,7 @@ namespace DesiccantDehumidifiers {
 						Par( 2 ) = 0.0;
 					}
 					Par( 3 ) = RegenCoilLoad;
-					SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, HotWaterMdot, HotWaterCoilResidual, MinWaterFlow, MaxHotWaterFlow, Par );
+					SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, HotWaterMdot, HotWaterCoilResidual, MinWaterFlow, MaxHotWaterFlow, Par, "CalcNonDXHeatingCoils" );
 					if ( SolFlag == -1 ) {
 						if ( DesicDehum( DesicDehumNum ).HotWaterCoilMaxIterIndex == 0 ) {
 							ShowWarningMessage( "CalcNonDXHeatingCoils: Hot water coil control failed for " + DesicDehum( DesicDehumNum ).DehumType + "=\"" + DesicDehum( DesicDehumNum ).Name + "\"" );
@@ -2892,6 +2892,22 @@ namespace DesiccantDehumidifiers {
 		GetInputDesiccantDehumidifier = true;
 		InitDesiccantDehumidifierOneTimeFlag = true;	
 		DesicDehum.deallocate();
+		ErrorsFound = false;
+		ErrorsFound2 = false;
+		ErrorsFoundGeneric = false;
+		MaxNums = 0;
+		MaxAlphas = 0;
+		TotalArgs = 0;
+		SteamDensity = 0.0;
+		MySetPointCheckFlag = true;
+		MyEnvrnFlag.deallocate();
+		MyPlantScanFlag.deallocate();
+		InitDesiccantDehumidifierErrorsFound = false;
+		MyOneTimeFlag = true;
+		RhoAirStdInit = 0.0;
+		QRegen = 0.0;
+		CalcGenericDesiccantDehumidifierMyOneTimeFlag = true;
+		CalcGenericDesiccantDehumidifierRhoAirStdInit = 0.0;
 	}
 
 	//        End of Reporting subroutines for the SimAir Module
@@ -136,6 +136,11 @@ namespace DirectAirManager {
 		// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
 		// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
 		bool GetDirectAirInputFlag( true );
+		bool ErrorsFound( false );
+		bool MyOneTimeFlag( true );
+		bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool MySizeFlag;
 	}
 
 	//SUBROUTINE SPECIFICATIONS FOR MODULE AirLoopSplitter
@@ -150,6 +155,11 @@ namespace DirectAirManager {
 		CheckEquipName.deallocate();
 		DirectAir.deallocate();
 		GetDirectAirInputFlag = true;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		ZoneEquipmentListChecked = false;
+		MyEnvrnFlag.deallocate();
+		MySizeFlag.deallocate();
 	}
 
 	// Functions
@@ -286,7 +296,6 @@ namespace DirectAirManager {
 		int DirectAirNum;
 		int IOStat;
 		static std::string const RoutineName( "GetDirectAirInput: " ); // include trailing blank space
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int Loop; // Do Loop Index
@@ -429,10 +438,6 @@ namespace DirectAirManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true );
-		static bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool MySizeFlag;
 		int ZoneNode;
 		int Loop;
 
@@ -88,6 +88,11 @@ namespace DisplacementVentMgr {
 
 	// Functions
 
+	// Clears the global data in DisplacementVentMgr.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	ManageUCSDDVModel( int const ZoneNum ); // index number for the specified zone
 
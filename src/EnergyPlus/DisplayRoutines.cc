@@ -244,7 +244,7 @@ DisplaySimDaysProgress( // This doesn't do anything!
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	static int percent( 0 ); // Current percent progress
+	int percent( 0 ); // Current percent progress
 
 	if ( KickOffSimulation && ! DeveloperFlag ) return;
 	if ( TotalSimDays > 0 ) {
@@ -161,6 +161,81 @@ namespace DualDuct {
 	Array1D< DamperFlowConditions > DamperOAInlet; // VAV:OutdoorAir Outdoor Air Inlet
 	Array1D< DamperFlowConditions > DamperRecircAirInlet; // VAV:OutdoorAir Recirculated Air Inlet
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		Array1D< Real64 > NumArray( 2, 0.0 );
+		Array1D_string AlphArray( 7 );
+		Array1D_string cAlphaFields( 7 ); // Alpha field names
+		Array1D_string cNumericFields( 2 ); // Numeric field names
+		Array1D_bool lAlphaBlanks( 7, true ); // Logical array, alpha field input BLANK = .TRUE.
+		Array1D_bool lNumericBlanks( 2, true ); // Logical array, numeric field input BLANK = .TRUE.
+		bool ErrorsFound( false ); // If errors detected in input
+		Real64 DummyOAFlow( 0.0 );
+		bool MyOneTimeFlag( true );
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool MySizeFlag;
+		Array1D_bool MyAirLoopFlag;
+		bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
+		bool FirstTimeOnly( true );
+		Array1D_bool RecircIsUsedARR;
+		Array1D_string DamperNamesARR;
+		Array1D< Real64 > GetDualDuctOutdoorAirRecircUseNumArray( 2, 0.0 );
+		Array1D_string GetDualDuctOutdoorAirRecircUseAlphArray( 7 );
+		Array1D_string GetDualDuctOutdoorAirRecircUse_cAlphaFields( 7 ); // Alpha field names
+		Array1D_string GetDualDuctOutdoorAirRecircUse_cNumericFields( 2 ); // Numeric field names
+		Array1D_bool GetDualDuctOutdoorAirRecircUse_lAlphaBlanks( 7, true ); // Logical array, alpha field input BLANK = .TRUE.
+		Array1D_bool GetDualDuctOutdoorAirRecircUse_lNumericBlanks( 2, true ); // Logical array, numeric field input BLANK = .TRUE.
+	}
+
+	// Functions
+
+	// Clears the global data in DualDuct.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		CheckEquipName.deallocate();
+		NumDampers = 0;
+		NumDualDuctConstVolDampers = 0;
+		NumDualDuctVarVolDampers = 0;
+		NumDualDuctVarVolOA = 0;
+		MassFlowSetToler = 0.0;
+		GetDualDuctInputFlag = true;
+		Damper.deallocate();
+		DamperInlet.deallocate();
+		DamperHotAirInlet.deallocate();
+		DamperColdAirInlet.deallocate();
+		DamperOutlet.deallocate();
+		DamperOAInlet.deallocate();
+		DamperRecircAirInlet.deallocate();
+		NumArray = Array1D< Real64 >( 2, 0.0 );
+		AlphArray = Array1D_string( 7 );
+		cAlphaFields = Array1D_string( 7 );
+		cNumericFields = Array1D_string( 2 );
+		lAlphaBlanks = Array1D_bool( 7, true );
+		lNumericBlanks = Array1D_bool( 2, true );
+		ErrorsFound = false;
+		DummyOAFlow = 0.0;
+		MyOneTimeFlag = true;
+		MyEnvrnFlag.deallocate();
+		MySizeFlag.deallocate();
+		MyAirLoopFlag.deallocate();
+		ZoneEquipmentListChecked = false;
+		FirstTimeOnly = true;
+		RecircIsUsedARR.deallocate();
+		DamperNamesARR.deallocate();
+		GetDualDuctOutdoorAirRecircUseNumArray = Array1D< Real64 >( 2, 0.0 );
+		GetDualDuctOutdoorAirRecircUseAlphArray = Array1D_string( 7 );
+		GetDualDuctOutdoorAirRecircUse_cAlphaFields = Array1D_string( 7 );
+		GetDualDuctOutdoorAirRecircUse_cNumericFields = Array1D_string( 2 );
+		GetDualDuctOutdoorAirRecircUse_lAlphaBlanks = Array1D_bool( 7, true );
+		GetDualDuctOutdoorAirRecircUse_lNumericBlanks = Array1D_bool( 2, true );
+	}
+
 	void
 	SimulateDualDuct(
 		std::string const & CompName,
@@ -325,20 +400,12 @@ namespace DualDuct {
 		int NumAlphas;
 		int NumNums;
 		int IOStat;
-		static Array1D< Real64 > NumArray( 2, 0.0 );
-		static Array1D_string AlphArray( 7 );
-		static Array1D_string cAlphaFields( 7 ); // Alpha field names
-		static Array1D_string cNumericFields( 2 ); // Numeric field names
-		static Array1D_bool lAlphaBlanks( 7, true ); // Logical array, alpha field input BLANK = .TRUE.
-		static Array1D_bool lNumericBlanks( 2, true ); // Logical array, numeric field input BLANK = .TRUE.
 		std::string CurrentModuleObject; // for ease in getting objects
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int CtrlZone; // controlled zone do loop index
 		int SupAirIn; // controlled zone supply air inlet index
 		int ADUNum; // loop control to search Air Distribution Units
-		static Real64 DummyOAFlow( 0.0 );
 
 		// Flow
 		NumDualDuctConstVolDampers = GetNumObjectsFound( cCMO_DDConstantVolume );
@@ -713,11 +780,6 @@ namespace DualDuct {
 		int OAInNode; // Outdoor Air Inlet Node for VAV:OutdoorAir units
 		int RAInNode; // Reciruclated Air Inlet Node for VAV:OutdoorAir units
 		int OutNode;
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool MySizeFlag;
-		static Array1D_bool MyAirLoopFlag;
-		static bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
 		int Loop; // Loop checking control variable
 		Real64 PeopleFlow; // local sum variable, m3/s
 		// FLOW:
@@ -2160,17 +2222,8 @@ namespace DualDuct {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		//  INTEGER :: DamperNum
-		static bool FirstTimeOnly( true );
-		static Array1D_bool RecircIsUsedARR;
-		static Array1D_string DamperNamesARR;
 		int DamperIndex; // Loop index to Damper that you are currently loading input into
 		std::string CurrentModuleObject; // for ease in getting objects
-		static Array1D< Real64 > NumArray( 2, 0.0 );
-		static Array1D_string AlphArray( 7 );
-		static Array1D_string cAlphaFields( 7 ); // Alpha field names
-		static Array1D_string cNumericFields( 2 ); // Numeric field names
-		static Array1D_bool lAlphaBlanks( 7, true ); // Logical array, alpha field input BLANK = .TRUE.
-		static Array1D_bool lNumericBlanks( 2, true ); // Logical array, numeric field input BLANK = .TRUE.
 		int NumAlphas;
 		int NumNums;
 		int IOStat;
@@ -2192,9 +2245,9 @@ namespace DualDuct {
 
 					CurrentModuleObject = cCMO_DDVarVolOA;
 
-					GetObjectItem( CurrentModuleObject, DamperIndex, AlphArray, NumAlphas, NumArray, NumNums, IOStat, lNumericBlanks, lAlphaBlanks, cAlphaFields, cNumericFields );
-					DamperNamesARR( DamperIndex ) = AlphArray( 1 );
-					if ( ! lAlphaBlanks( 5 ) ) {
+					GetObjectItem( CurrentModuleObject, DamperIndex, GetDualDuctOutdoorAirRecircUseAlphArray, NumAlphas, GetDualDuctOutdoorAirRecircUseNumArray, NumNums, IOStat, GetDualDuctOutdoorAirRecircUse_lNumericBlanks, GetDualDuctOutdoorAirRecircUse_lAlphaBlanks, GetDualDuctOutdoorAirRecircUse_cAlphaFields, GetDualDuctOutdoorAirRecircUse_cNumericFields );
+					DamperNamesARR( DamperIndex ) = GetDualDuctOutdoorAirRecircUseAlphArray( 1 );
+					if ( ! GetDualDuctOutdoorAirRecircUse_lAlphaBlanks( 5 ) ) {
 						RecircIsUsedARR( DamperIndex ) = true;
 					} else {
 						RecircIsUsedARR( DamperIndex ) = false;
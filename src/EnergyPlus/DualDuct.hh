@@ -231,6 +231,11 @@ namespace DualDuct {
 
 	// Functions
 
+	// Clears the global data in DualDuct.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimulateDualDuct(
 		std::string const & CompName,
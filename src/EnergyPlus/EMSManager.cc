@@ -134,6 +134,31 @@ namespace EMSManager {
 
 	// SUBROUTINE SPECIFICATIONS:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false );
+		int MaxNumAlphas( 0 ); // argument for call to GetObjectDefMaxArgs
+		int MaxNumNumbers( 0 ); // argument for call to GetObjectDefMaxArgs
+		int TotalArgs( 0 ); // argument for call to GetObjectDefMaxArgs
+		bool ProcessEMSInputErrorsFound( false );
+		bool lDummy; // not going to setup a pointer to logical control //Fix Changed to static: Passed to SetupEMSActuator as source of persistent Reference
+		int TrendNum( 0 ); // local loop counter
+		int ErlVarNum( 0 );
+		int TrendDepth( 0 );
+		Real64 currentVal( 0.0 );
+		int Loop( 0 ); // local do loop index
+		bool FoundControl( false );
+		int numAirLoops( 0 );
+		int SetupPrimaryAirSystemAvailMgrAsActuatorsLoop( 0 );
+		bool SetupPrimaryAirSystemAvailMgrAsActuators_lDummy; //Fix Changed to static: Passed to SetupEMSActuator as source of persistent Reference
+		int loopSurfNum( 0 ); // local do loop index
+		int SetupThermostatActuatorsLoop( 0 ); // local do loop index
+	}
+
 	// Functions
 	void
 	clear_state()
@@ -141,6 +166,23 @@ namespace EMSManager {
 		GetEMSUserInput = true ;
 		ZoneThermostatActuatorsHaveBeenSetup = false ;
 		FinishProcessingUserInput = true ;
+		ErrorsFound = false;
+		MaxNumAlphas = 0;
+		MaxNumNumbers = 0;
+		TotalArgs = 0;
+		ProcessEMSInputErrorsFound = false;
+		lDummy = false;
+		TrendNum = 0;
+		ErlVarNum = 0;
+		TrendDepth = 0;
+		currentVal = 0.0;
+		Loop = 0;
+		FoundControl = false;
+		numAirLoops = 0;
+		SetupPrimaryAirSystemAvailMgrAsActuatorsLoop = 0;
+		SetupPrimaryAirSystemAvailMgrAsActuators_lDummy = false;
+		loopSurfNum = 0;
+		SetupThermostatActuatorsLoop = 0;
 	}
 
 	void
@@ -647,7 +689,6 @@ namespace EMSManager {
 		//  REAL(r64), DIMENSION(1)          :: NumArray  ! Numeric data
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
-		static bool ErrorsFound( false );
 		//  CHARACTER(len=MaxNameLength)   :: objNameMsg = ' '
 		Array1D_string cAlphaFieldNames;
 		Array1D_string cNumericFieldNames;
@@ -667,9 +708,6 @@ namespace EMSManager {
 		int InternVarNum; // do loop counter for internal variables used (outer)
 		int InternalVarAvailNum; // do loop counter for internal variables available (inner)
 		int Loop; // do loop counter
-		static int MaxNumAlphas( 0 ); // argument for call to GetObjectDefMaxArgs
-		static int MaxNumNumbers( 0 ); // argument for call to GetObjectDefMaxArgs
-		static int TotalArgs( 0 ); // argument for call to GetObjectDefMaxArgs
 		bool errFlag;
 
 		// FLOW:
@@ -1119,7 +1157,6 @@ namespace EMSManager {
 		//  INTEGER :: VariableNum  ! local do loop index
 		int VarIndex;
 		int VarType;
-		static bool ErrorsFound( false );
 		int ActuatorNum;
 		bool FoundObjectType;
 		bool FoundObjectName;
@@ -1148,7 +1185,7 @@ namespace EMSManager {
 						ShowSevereError( "Invalid Output:Variable or Output:Meter Name =" + Sensor( SensorNum ).OutputVarName );
 						ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + Sensor( SensorNum ).Name );
 						ShowContinueError( "Output:Variable Name not found" );
-						ErrorsFound = true;
+						ProcessEMSInputErrorsFound = true;
 					}
 				} else if ( VarIndex == 0 ) {
 					if ( reportErrors ) {
@@ -1156,7 +1193,7 @@ namespace EMSManager {
 						ShowContinueError( "For Output:Variable or Output:Meter = " + Sensor( SensorNum ).OutputVarName );
 						ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + Sensor( SensorNum ).Name );
 						ShowContinueError( "Unique Key Name not found." );
-						ErrorsFound = true;
+						ProcessEMSInputErrorsFound = true;
 					}
 				} else {
 					Sensor( SensorNum ).Type = VarType;
@@ -1172,7 +1209,7 @@ namespace EMSManager {
 								ShowContinueError( "For Output:Variable or Output:Meter = " + Sensor( SensorNum ).OutputVarName );
 								ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + Sensor( SensorNum ).Name );
 								ShowContinueError( "Schedule Name not found." );
-								ErrorsFound = true;
+								ProcessEMSInputErrorsFound = true;
 							}
 						}
 					}
@@ -1231,7 +1268,7 @@ namespace EMSManager {
 					} else {
 						ShowContinueError( "Use Output:EnergyManagementSystem object to create .edd file for valid component types." );
 					}
-					ErrorsFound = true;
+					ProcessEMSInputErrorsFound = true;
 				}
 			}
 
@@ -1245,7 +1282,7 @@ namespace EMSManager {
 					} else {
 						ShowContinueError( "Use Output:EnergyManagementSystem object to create .edd file for valid component names." );
 					}
-					ErrorsFound = true;
+					ProcessEMSInputErrorsFound = true;
 				}
 			}
 
@@ -1259,7 +1296,7 @@ namespace EMSManager {
 					} else {
 						ShowContinueError( "Use Output:EnergyManagementSystem object to create .edd file for valid component control types." );
 					}
-					ErrorsFound = true;
+					ProcessEMSInputErrorsFound = true;
 				}
 			} else {
 				EMSActuatorUsed( ActuatorNum ).ActuatorVariableNum = ActuatorVariableNum;
@@ -1287,7 +1324,7 @@ namespace EMSManager {
 					ShowSevereError( "Invalid Internal Data Type =" + EMSInternalVarsUsed( InternVarNum ).InternalDataTypeName );
 					ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + EMSInternalVarsUsed( InternVarNum ).Name );
 					ShowContinueError( "Internal data type name not found" );
-					ErrorsFound = true;
+					ProcessEMSInputErrorsFound = true;
 				}
 			}
 
@@ -1296,7 +1333,7 @@ namespace EMSManager {
 					ShowSevereError( "Invalid Internal Data Index Key Name =" + EMSInternalVarsUsed( InternVarNum ).UniqueIDName );
 					ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + EMSInternalVarsUsed( InternVarNum ).Name );
 					ShowContinueError( "Internal data unique identifier not found" );
-					ErrorsFound = true;
+					ProcessEMSInputErrorsFound = true;
 				}
 			} else {
 				EMSInternalVarsUsed( InternVarNum ).InternVarNum = InternalVarAvailNum;
@@ -1309,7 +1346,7 @@ namespace EMSManager {
 			EchoOutInternalVariableChoices();
 		}
 
-		if ( ErrorsFound ) {
+		if ( ProcessEMSInputErrorsFound ) {
 			ShowFatalError( "Errors found in processing Energy Management System input. Preceding condition causes termination." );
 		}
 
@@ -1557,7 +1594,6 @@ namespace EMSManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int LoopNode; // local do loop index
-		static bool lDummy; // not going to setup a pointer to logical control //Fix Changed to static: Passed to SetupEMSActuator as source of persistent Reference
 		// (could this ever cause a fault?) // It caused illegal memory access/corruption
 		// make it optional in Setup call?
 		int OutsideAirNodeNum; // local do loop index
@@ -1631,10 +1667,6 @@ namespace EMSManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		// na
-		static int TrendNum( 0 ); // local loop counter
-		static int ErlVarNum( 0 );
-		static int TrendDepth( 0 );
-		static Real64 currentVal( 0.0 );
 
 		// checks with quick return if no updates needed.
 		if ( ! AnyEnergyManagementSystemInModel ) return;
@@ -1694,11 +1726,9 @@ namespace EMSManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int Loop( 0 ); // local do loop index
 		std::string cControlTypeName;
 		std::string cComponentTypeName;
 		std::string cNodeName;
-		static bool FoundControl( false );
 
 		FoundControl = false;
 
@@ -1791,16 +1821,13 @@ namespace EMSManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int numAirLoops( 0 );
-		static int Loop( 0 );
-		static bool lDummy; //Fix Changed to static: Passed to SetupEMSActuator as source of persistent Reference
 
-		lDummy = false;
+		SetupPrimaryAirSystemAvailMgrAsActuators_lDummy = false;
 
 		if ( allocated( PriAirSysAvailMgr ) ) {
 			numAirLoops = isize( PriAirSysAvailMgr );
-			for ( Loop = 1; Loop <= numAirLoops; ++Loop ) {
-				SetupEMSActuator( "AirLoopHVAC", PrimaryAirSystem( Loop ).Name, "Availability Status", "[ ]", lDummy, PriAirSysAvailMgr( Loop ).AvailStatus );
+			for ( SetupPrimaryAirSystemAvailMgrAsActuatorsLoop = 1; SetupPrimaryAirSystemAvailMgrAsActuatorsLoop <= numAirLoops; ++SetupPrimaryAirSystemAvailMgrAsActuatorsLoop ) {
+				SetupEMSActuator( "AirLoopHVAC", PrimaryAirSystem( SetupPrimaryAirSystemAvailMgrAsActuatorsLoop ).Name, "Availability Status", "[ ]", SetupPrimaryAirSystemAvailMgrAsActuators_lDummy, PriAirSysAvailMgr( SetupPrimaryAirSystemAvailMgrAsActuatorsLoop ).AvailStatus );
 
 			}
 
@@ -1850,7 +1877,6 @@ namespace EMSManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int loopSurfNum( 0 ); // local do loop index
 
 		for ( loopSurfNum = 1; loopSurfNum <= TotSurfaces; ++loopSurfNum ) {
 
@@ -1905,21 +1931,20 @@ namespace EMSManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int Loop( 0 ); // local do loop index
 
-		for ( Loop = 1; Loop <= NumTempControlledZones; ++Loop ) {
-			SetupEMSActuator( "Zone Temperature Control", TempControlledZone( Loop ).ZoneName, "Heating Setpoint", "[C]", TempControlledZone( Loop ).EMSOverrideHeatingSetPointOn, TempControlledZone( Loop ).EMSOverrideHeatingSetPointValue );
-			SetupEMSActuator( "Zone Temperature Control", TempControlledZone( Loop ).ZoneName, "Cooling Setpoint", "[C]", TempControlledZone( Loop ).EMSOverrideCoolingSetPointOn, TempControlledZone( Loop ).EMSOverrideCoolingSetPointValue );
+		for ( SetupThermostatActuatorsLoop = 1; SetupThermostatActuatorsLoop <= NumTempControlledZones; ++SetupThermostatActuatorsLoop ) {
+			SetupEMSActuator( "Zone Temperature Control", TempControlledZone( SetupThermostatActuatorsLoop ).ZoneName, "Heating Setpoint", "[C]", TempControlledZone( SetupThermostatActuatorsLoop ).EMSOverrideHeatingSetPointOn, TempControlledZone( SetupThermostatActuatorsLoop ).EMSOverrideHeatingSetPointValue );
+			SetupEMSActuator( "Zone Temperature Control", TempControlledZone( SetupThermostatActuatorsLoop ).ZoneName, "Cooling Setpoint", "[C]", TempControlledZone( SetupThermostatActuatorsLoop ).EMSOverrideCoolingSetPointOn, TempControlledZone( SetupThermostatActuatorsLoop ).EMSOverrideCoolingSetPointValue );
 		}
 
-		for ( Loop = 1; Loop <= NumHumidityControlZones; ++Loop ) {
-			SetupEMSActuator( "Zone Humidity Control", HumidityControlZone( Loop ).ZoneName, "Relative Humidity Humidifying Setpoint", "[%]", HumidityControlZone( Loop ).EMSOverrideHumidifySetPointOn, HumidityControlZone( Loop ).EMSOverrideHumidifySetPointValue );
-			SetupEMSActuator( "Zone Humidity Control", HumidityControlZone( Loop ).ZoneName, "Relative Humidity Dehumidifying Setpoint", "[%]", HumidityControlZone( Loop ).EMSOverrideDehumidifySetPointOn, HumidityControlZone( Loop ).EMSOverrideDehumidifySetPointValue );
+		for ( SetupThermostatActuatorsLoop = 1; SetupThermostatActuatorsLoop <= NumHumidityControlZones; ++SetupThermostatActuatorsLoop ) {
+			SetupEMSActuator( "Zone Humidity Control", HumidityControlZone( SetupThermostatActuatorsLoop ).ZoneName, "Relative Humidity Humidifying Setpoint", "[%]", HumidityControlZone( SetupThermostatActuatorsLoop ).EMSOverrideHumidifySetPointOn, HumidityControlZone( SetupThermostatActuatorsLoop ).EMSOverrideHumidifySetPointValue );
+			SetupEMSActuator( "Zone Humidity Control", HumidityControlZone( SetupThermostatActuatorsLoop ).ZoneName, "Relative Humidity Dehumidifying Setpoint", "[%]", HumidityControlZone( SetupThermostatActuatorsLoop ).EMSOverrideDehumidifySetPointOn, HumidityControlZone( SetupThermostatActuatorsLoop ).EMSOverrideDehumidifySetPointValue );
 		}
 
-		for ( Loop = 1; Loop <= NumComfortControlledZones; ++Loop ) {
-			SetupEMSActuator( "Zone Comfort Control", ComfortControlledZone( Loop ).ZoneName, "Heating Setpoint", "[]", ComfortControlledZone( Loop ).EMSOverrideHeatingSetPointOn, ComfortControlledZone( Loop ).EMSOverrideHeatingSetPointValue );
-			SetupEMSActuator( "Zone Comfort Control", ComfortControlledZone( Loop ).ZoneName, "Cooling Setpoint", "[]", ComfortControlledZone( Loop ).EMSOverrideCoolingSetPointOn, ComfortControlledZone( Loop ).EMSOverrideCoolingSetPointValue );
+		for ( SetupThermostatActuatorsLoop = 1; SetupThermostatActuatorsLoop <= NumComfortControlledZones; ++SetupThermostatActuatorsLoop ) {
+			SetupEMSActuator( "Zone Comfort Control", ComfortControlledZone( SetupThermostatActuatorsLoop ).ZoneName, "Heating Setpoint", "[]", ComfortControlledZone( SetupThermostatActuatorsLoop ).EMSOverrideHeatingSetPointOn, ComfortControlledZone( SetupThermostatActuatorsLoop ).EMSOverrideHeatingSetPointValue );
+			SetupEMSActuator( "Zone Comfort Control", ComfortControlledZone( SetupThermostatActuatorsLoop ).ZoneName, "Cooling Setpoint", "[]", ComfortControlledZone( SetupThermostatActuatorsLoop ).EMSOverrideCoolingSetPointOn, ComfortControlledZone( SetupThermostatActuatorsLoop ).EMSOverrideCoolingSetPointValue );
 		}
 
 	}
@@ -143,8 +143,32 @@ namespace EarthTube {
 	// MODULE SUBROUTINES:
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true );
+		bool ManageEarthTubeErrorsFound( false );
+		Array1D< Real64 > EVF; // DESIGN EARTHTUBE FLOW RATE (M**3/SEC)
+	}
+
 	// Functions
 
+	// Clears the global data in EarthTube.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		TotEarthTube = 0;
+		EarthTubeSys.deallocate();
+		ZnRptET.deallocate();
+		GetInputFlag = true;
+		ManageEarthTubeErrorsFound = false;
+		EVF.deallocate();
+	}
+
 	void
 	ManageEarthTube()
 	{
@@ -183,12 +207,10 @@ namespace EarthTube {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInputFlag( true );
-		static bool ErrorsFound( false );
 
 		// Obtains and Allocates heat balance related parameters from input file
 		if ( GetInputFlag ) {
-			GetEarthTube( ErrorsFound );
+			GetEarthTube( ManageEarthTubeErrorsFound );
 			GetInputFlag = false;
 		}
 
@@ -497,7 +519,6 @@ namespace EarthTube {
 		Real64 OutletAirEnthalpy;
 		Real64 InsideDewPointTemp;
 		Real64 InsideHumRat;
-		static Array1D< Real64 > EVF; // DESIGN EARTHTUBE FLOW RATE (M**3/SEC)
 
 		// Allocate the EVF array
 		if ( ! allocated( EVF ) ) EVF.allocate( NumOfZones );
@@ -199,6 +199,11 @@ namespace EarthTube {
 
 	// Functions
 
+	// Clears the global data in EarthTube.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	ManageEarthTube();
 
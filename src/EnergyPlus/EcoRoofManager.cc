@@ -145,8 +145,136 @@ namespace EcoRoofManager {
 
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int FirstEcoSurf( 0 ); // Indicates lowest numbered surface that is an ecoroof
+		bool QuickConductionSurf( false ); // indicator for quick conduction surface
+		Real64 LAI( 0.2 ); // Leaf area index
+		Real64 epsilonf( 0.95 ); // Leaf Emisivity
+		Real64 epsilong( 0.95 ); // Soil Emisivity
+		Real64 CalcEcoRoofAlphag( 0.3 ); // Ground Albedo
+		Real64 Alphaf( 0.2 ); // Leaf Albedo (reflectivity to solar radiation)
+		Real64 e0( 2.0 ); // Windless lower limit of exchange coefficient (from FASST docs)
+		Real64 RH( 50.0 ); // Relative humidity (%)
+		Real64 Pa( 101325.0 ); // Atmospheric Pressure (PA)
+		Real64 CalcEcoRoofTg( 10.0 ); // Ground Surface temperature C ***** FROM PREVIOUS TIME STEP
+		Real64 CalcEcoRoofTf( 10.0 ); // Leaf temperature C ***** FROM PREVIOUS TIME STEP
+		Real64 Zf( 0.2 ); // Height of plants (m)
+		Real64 CalcEcoRoofMoisture; // m^3/m^3.The moisture content in the soil is the value provided by a user
+		Real64 CalcEcoRoofMoistureResidual( 0.05 ); // m^3/m^3. Residual & maximum water contents are unique to each material.
+		Real64 CalcEcoRoofMoistureMax( 0.5 ); // Maximum volumetric moisture content (porosity) m^3/m^3
+		Real64 CalcEcoRoofMeanRootMoisture; // Mean value of root moisture m^3/m^3
+		Real64 CalcEcoRoofSoilThickness( 0.2 ); // Soil thickness (m)
+		Real64 StomatalResistanceMin; // s/m . ! Minimum stomatal resistance is unique for each veg. type.
+		Real64 f3( 1.0 ); // As the value of gd for tall grass is 0, then f3 = 1
+		Real64 Zog( 0.001 ); // Ground roughness length scale (m)
+		Real64 Za( 2.0 ); // Instrument height where atmospheric wind speed is measured (m)
+		Real64 Lf; // latent heat flux
+		Real64 CalcEcoRoofVfluxf( 0.0 ); // Water evapotr. rate associated with latent heat from vegetation [m/s]
+		Real64 CalcEcoRoofQsoil( 0.0 ); // heat flux from the soil layer
+		Real64 sheatf; // sensible heat flux coeff for foliage (W/m^2K)
+		Real64 sensiblef; // sensible heat transfer TO foliage (W/m^2) DJS Jan 2011
+		Real64 sheatg; // intermediate calculation variable - sensible flux coef (W/m^2K for ground)
+		Real64 sensibleg; // sensible heat flux TO ground (w/m^2) DJS Jan 2011
+		Real64 Lg( 0.0 ); // latent heat flux from ground surface
+		Real64 CalcEcoRoofVfluxg( 0.0 ); // Water evapotr. rate associated with latent heat from ground surface [m/s]
+		int CalcEcoRoof_unit( 0 );
+		bool MyEnvrnFlag( true );
+		Real64 TopDepth; // Thickness of "near-surface" soil layer
+		Real64 RootDepth( 0.0 ); // Thickness of "root zone" soil layer //Autodesk Was used uninitialized
+		Real64 TimeStepZoneSec; // Seconds per TimeStep
+		Real64 DryCond; // Dry soil value of conductivity
+		Real64 DryDens; // Dry soil value of density
+		Real64 DryAbsorp; // Dry soil value of solar absorptance (1-albedo)
+		Real64 DrySpecHeat; // Dry soil value of specific heat
+		bool UpdatebeginFlag( true ); // one time flag
+		Real64 CapillaryPotentialTop( -3.8997 ); // This variable keeps track of the capillary potential of the soil in both layers and time (m)
+		Real64 CapillaryPotentialRoot( -3.8997 ); // This variable keeps track of the capillary potential of the soil in both layers and time (m)
+		Real64 SoilHydroConductivityTop( 8.72e-6 ); // This is the soil water conductivity in the soil (m/s)
+		Real64 SoilHydroConductivityRoot( 8.72e-6 ); // This is the soil water conductivity in the soil (m/s)
+		Real64 SoilConductivityAveTop( 8.72e-6 ); // This is the average soil water conductivity (m/s)
+		Real64 SoilConductivityAveRoot( 8.72e-6 );
+		Real64 RelativeSoilSaturationTop; // Relative Soil Saturation (soil moisture-residual soil moisture)/(saturation soil moisture-residual soil moisture)
+		Real64 RelativeSoilSaturationRoot;
+		Real64 TestMoisture( 0.15 ); // This makes sure that the moisture cannot change by too much in each step
+		int ErrIndex( 0 );
+	}
+
 	// Functions
 
+	// Clears the global data in EcoRoofManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		CumRunoff = 0.0;
+		CumET = 0.0;
+		CumPrecip = 0.0;
+		CumIrrigation = 0.0;
+		CurrentRunoff = 0.0;
+		CurrentET = 0.0;
+		CurrentPrecipitation = 0.0;
+		CurrentIrrigation = 0.0;
+		Tfold = 0.0;
+		Tgold = 0.0;
+		EcoRoofbeginFlag = true;
+		FirstEcoSurf = 0;
+		QuickConductionSurf = false;
+		LAI = 0.2;
+		epsilonf = 0.95;
+		epsilong = 0.95;
+		CalcEcoRoofAlphag = 0.3;
+		Alphaf = 0.2;
+		e0 = 2.0;
+		RH = 50.0;
+		Pa = 101325.0;
+		CalcEcoRoofTg = 10.0;
+		CalcEcoRoofTf = 10.0;
+		Zf = 0.2;
+		CalcEcoRoofMoisture = 0.0;
+		CalcEcoRoofMoistureResidual = 0.05;
+		CalcEcoRoofMoistureMax = 0.5;
+		CalcEcoRoofMeanRootMoisture = 0.0;
+		CalcEcoRoofSoilThickness = 0.2;
+		StomatalResistanceMin = 0.0;
+		f3 = 1.0;
+		Zog = 0.001;
+		Za = 2.0;
+		Lf = 0.0;
+		CalcEcoRoofVfluxf = 0.0;
+		CalcEcoRoofQsoil = 0.0;
+		sheatf = 0.0;
+		sensiblef = 0.0;
+		sheatg = 0.0;
+		sensibleg = 0.0;
+		Lg = 0.0;
+		CalcEcoRoofVfluxg = 0.0;
+		CalcEcoRoof_unit = 0;
+		MyEnvrnFlag = true;
+		TopDepth = 0.0;
+		RootDepth = 0.0;
+		TimeStepZoneSec = 0.0;
+		DryCond = 0.0;
+		DryDens = 0.0;
+		DryAbsorp = 0.0;
+		DrySpecHeat = 0.0;
+		UpdatebeginFlag = true;
+		CapillaryPotentialTop = -3.8997;
+		CapillaryPotentialRoot = -3.8997;
+		SoilHydroConductivityTop = 8.72e-6;
+		SoilHydroConductivityRoot = 8.72e-6;
+		SoilConductivityAveTop = 8.72e-6;
+		SoilConductivityAveRoot = 8.72e-6;
+		RelativeSoilSaturationTop = 0.0;
+		RelativeSoilSaturationRoot = 0.0;
+		TestMoisture = 0.15;
+		ErrIndex = 0;
+	}
+
 	void
 	CalcEcoRoof(
 		int const SurfNum, // Indicator of Surface Number for the current surface
@@ -202,7 +330,6 @@ namespace EcoRoofManager {
 		Real64 const Cpa( 1005.6 ); // Specific heat of Water Vapor. (J/Kg.K)
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int FirstEcoSurf( 0 ); // Indicates lowest numbered surface that is an ecoroof
 		// used to determine WHEN to updatesoilProps...
 		int EcoLoop; // an integer loop variable for the simultaneous solution iteration
 
@@ -214,35 +341,14 @@ namespace EcoRoofManager {
 		//  INTEGER :: OPtr
 		//  INTEGER :: OSCScheduleIndex    ! Index number for OSC ConstTempSurfaceName
 
-		static bool QuickConductionSurf( false ); // indicator for quick conduction surface
-		static Real64 LAI( 0.2 ); // Leaf area index
-		static Real64 epsilonf( 0.95 ); // Leaf Emisivity
-		static Real64 epsilong( 0.95 ); // Soil Emisivity
-		static Real64 Alphag( 0.3 ); // Ground Albedo
-		static Real64 Alphaf( 0.2 ); // Leaf Albedo (reflectivity to solar radiation)
-		static Real64 e0( 2.0 ); // Windless lower limit of exchange coefficient (from FASST docs)
-		static Real64 RH( 50.0 ); // Relative humidity (%)
-		static Real64 Pa( 101325.0 ); // Atmospheric Pressure (PA)
-		static Real64 Tg( 10.0 ); // Ground Surface temperature C ***** FROM PREVIOUS TIME STEP
-		static Real64 Tf( 10.0 ); // Leaf temperature C ***** FROM PREVIOUS TIME STEP
 		Real64 Tgk; // Ground temperature in Kelvin
-		static Real64 Zf( 0.2 ); // Height of plants (m)
 		// DJS Oct 2007 release - note I got rid of the initialization of moisture and meanrootmoisture here as these
 		// values are now set at beginning of each new DD and each new warm-up loop.
 		// DJS
-		static Real64 Moisture; // m^3/m^3.The moisture content in the soil is the value provided by a user
-		static Real64 MoistureResidual( 0.05 ); // m^3/m^3. Residual & maximum water contents are unique to each material.
 		// See Frankenstein et al (2004b) for data.
-		static Real64 MoistureMax( 0.5 ); // Maximum volumetric moisture content (porosity) m^3/m^3
-		static Real64 MeanRootMoisture; // Mean value of root moisture m^3/m^3
-		static Real64 SoilThickness( 0.2 ); // Soil thickness (m)
-		static Real64 StomatalResistanceMin; // s/m . ! Minimum stomatal resistance is unique for each veg. type.
-		static Real64 f3( 1.0 ); // As the value of gd for tall grass is 0, then f3 = 1
 		// ECMWF 2002 CY25R1 report has gd=0.0 for all veg except trees where gd=0.03.
 
 		Real64 Ta; // current air temperature
-		static Real64 Zog( 0.001 ); // Ground roughness length scale (m)
-		static Real64 Za( 2.0 ); // Instrument height where atmospheric wind speed is measured (m)
 		Real64 Ws; // Wind Speed (m/s)
 		Real64 Waf; // Windspeed within canopy (m/s)
 
@@ -250,10 +356,7 @@ namespace EcoRoofManager {
 		Real64 qaf; // mixing ratio of air near canopy
 
 		Real64 qg; // mixing ratio of air at surface.
-		static Real64 Lf; // latent heat flux
-		static Real64 Vfluxf( 0.0 ); // Water evapotr. rate associated with latent heat from vegetation [m/s]
 		Real64 RS; // shortwave radiation
-		static Real64 Qsoil( 0.0 ); // heat flux from the soil layer
 
 		Real64 EpsilonOne;
 		//unused1208  REAL(r64) :: e
@@ -270,8 +373,6 @@ namespace EcoRoofManager {
 		Real64 Zo; // foliage roughness length (m)
 		Real64 Cfhn; // transfer coefficient at near-neutral conditions
 		Real64 Cf; // bulk Transfer coefficient, equation 10 page 6 (FASST).
-		static Real64 sheatf; // sensible heat flux coeff for foliage (W/m^2K)
-		static Real64 sensiblef; // sensible heat transfer TO foliage (W/m^2) DJS Jan 2011
 		Real64 ra; // Aerodynamic Resistance
 
 		Real64 f1inv; // intermediate calculation variable
@@ -304,8 +405,6 @@ namespace EcoRoofManager {
 		Real64 Ce; // bulk transfer coefficient (this is in fact Ceg in equation 28 main report)
 		Real64 Gammah; // latent heat exchange stability correction factor
 		Real64 Chg; // in fact it is the same as Ce (=Ceg) is transfer coefficient (but wot?)
-		static Real64 sheatg; // intermediate calculation variable - sensible flux coef (W/m^2K for ground)
-		static Real64 sensibleg; // sensible heat flux TO ground (w/m^2) DJS Jan 2011
 		Real64 T3G; // intermediate variable in the equation for Tg
 		Real64 T2G; // intermediate variable in the equation for Tg
 		Real64 LeafTK; // the current leaf's temperature (Kelvin)
@@ -314,15 +413,11 @@ namespace EcoRoofManager {
 		Real64 Tif; // previous leaf temperature
 		Real64 rn; // rn is the combined effect of both stomatal and aerodynamic resistances
 		// in fact this is called r'' in the main report
-		static Real64 Lg( 0.0 ); // latent heat flux from ground surface
-		static Real64 Vfluxg( 0.0 ); // Water evapotr. rate associated with latent heat from ground surface [m/s]
 		Real64 T1G; // intermediate variable in the equation for Tg
 		Real64 Qsoilpart1; // intermediate variable for evaluating Qsoil (part without the unknown)
 		Real64 Qsoilpart2; // intermediate variable for evaluating Qsoil (part coeff of the ground temperature)
 
 		//  INTEGER,EXTERNAL :: GetNewUnitNumber ! external function to return a new (unique) unit for ecoroof writing
-		static int unit( 0 );
-		static bool MyEnvrnFlag( true );
 
 		Ws = WindSpeedAt( Surface( SurfNum ).Centroid.z ); // use windspeed at Z of roof
 		if ( Ws < 2.0 ) { // Later we need to adjust for building roof height...
@@ -349,17 +444,17 @@ namespace EcoRoofManager {
 			// ONLY READ ECOROOF PROPERTIES IN THE FIRST TIME
 			Zf = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).HeightOfPlants; // Plant height (m)
 			LAI = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).LAI; // Leaf Area Index
-			Alphag = 1.0 - Material( Construct( ConstrNum ).LayerPoint( 1 ) ).AbsorpSolar; // albedo rather than absorptivity
+			CalcEcoRoofAlphag = 1.0 - Material( Construct( ConstrNum ).LayerPoint( 1 ) ).AbsorpSolar; // albedo rather than absorptivity
 			Alphaf = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).Lreflectivity; // Leaf Reflectivity
 			epsilonf = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).LEmissitivity; // Leaf Emisivity
 			StomatalResistanceMin = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).RStomata; // Leaf min stomatal resistance
 			epsilong = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).AbsorpThermal; // Soil Emisivity
-			MoistureMax = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).Porosity; // Max moisture content in soil
-			MoistureResidual = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).MinMoisture; // Min moisture content in soil
-			Moisture = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).InitMoisture; // Initial moisture content in soil
-			MeanRootMoisture = Moisture; // DJS Oct 2007 Release --> all soil at same initial moisture for Reverse DD fix
+			CalcEcoRoofMoistureMax = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).Porosity; // Max moisture content in soil
+			CalcEcoRoofMoistureResidual = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).MinMoisture; // Min moisture content in soil
+			CalcEcoRoofMoisture = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).InitMoisture; // Initial moisture content in soil
+			CalcEcoRoofMeanRootMoisture = CalcEcoRoofMoisture; // DJS Oct 2007 Release --> all soil at same initial moisture for Reverse DD fix
 
-			SoilThickness = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).Thickness; // Total thickness of soil layer (m)
+			CalcEcoRoofSoilThickness = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).Thickness; // Total thickness of soil layer (m)
 
 			//DJS - This set of statements and the corresponding write statement in the UpdateSoilProps subroutine should
 			//      be removed (or commented out) prior to deployment in a working version of EnergyPlus
@@ -376,14 +471,14 @@ namespace EcoRoofManager {
 
 			// DJS NOVEMBER 2010 - Make calls to SetupOutput Variable to allow for reporting of ecoroof variables
 
-			SetupOutputVariable( "Green Roof Soil Temperature [C]", Tg, "Zone", "State", "Environment" );
-			SetupOutputVariable( "Green Roof Vegetation Temperature [C]", Tf, "Zone", "State", "Environment" );
-			SetupOutputVariable( "Green Roof Soil Root Moisture Ratio []", MeanRootMoisture, "Zone", "State", "Environment" );
-			SetupOutputVariable( "Green Roof Soil Near Surface Moisture Ratio []", Moisture, "Zone", "State", "Environment" );
+			SetupOutputVariable( "Green Roof Soil Temperature [C]", CalcEcoRoofTg, "Zone", "State", "Environment" );
+			SetupOutputVariable( "Green Roof Vegetation Temperature [C]", CalcEcoRoofTf, "Zone", "State", "Environment" );
+			SetupOutputVariable( "Green Roof Soil Root Moisture Ratio []", CalcEcoRoofMeanRootMoisture, "Zone", "State", "Environment" );
+			SetupOutputVariable( "Green Roof Soil Near Surface Moisture Ratio []", CalcEcoRoofMoisture, "Zone", "State", "Environment" );
 			SetupOutputVariable( "Green Roof Soil Sensible Heat Transfer Rate per Area [W/m2]", sensibleg, "Zone", "State", "Environment" );
 			SetupOutputVariable( "Green Roof Vegetation Sensible Heat Transfer Rate per Area [W/m2]", sensiblef, "Zone", "State", "Environment" );
-			SetupOutputVariable( "Green Roof Vegetation Moisture Transfer Rate [m/s]", Vfluxf, "Zone", "State", "Environment" );
-			SetupOutputVariable( "Green Roof Soil Moisture Transfer Rate [m/s]", Vfluxg, "Zone", "State", "Environment" );
+			SetupOutputVariable( "Green Roof Vegetation Moisture Transfer Rate [m/s]", CalcEcoRoofVfluxf, "Zone", "State", "Environment" );
+			SetupOutputVariable( "Green Roof Soil Moisture Transfer Rate [m/s]", CalcEcoRoofVfluxg, "Zone", "State", "Environment" );
 			SetupOutputVariable( "Green Roof Vegetation Latent Heat Transfer Rate per Area [W/m2]", Lf, "Zone", "State", "Environment" );
 			SetupOutputVariable( "Green Roof Soil Latent Heat Transfer Rate per Area [W/m2]", Lg, "Zone", "State", "Environment" );
 
@@ -405,19 +500,19 @@ namespace EcoRoofManager {
 		// for Reverse DD testing
 
 		if ( BeginEnvrnFlag || WarmupFlag ) {
-			Moisture = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).InitMoisture; // Initial moisture content in soil
-			MeanRootMoisture = Moisture; // Start the root zone moisture at the same value as the surface.
-			Alphag = 1.0 - Material( Construct( ConstrNum ).LayerPoint( 1 ) ).AbsorpSolar; // albedo rather than absorptivity
+			CalcEcoRoofMoisture = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).InitMoisture; // Initial moisture content in soil
+			CalcEcoRoofMeanRootMoisture = CalcEcoRoofMoisture; // Start the root zone moisture at the same value as the surface.
+			CalcEcoRoofAlphag = 1.0 - Material( Construct( ConstrNum ).LayerPoint( 1 ) ).AbsorpSolar; // albedo rather than absorptivity
 		}
 		// DJS July 2007
 
 		if ( BeginEnvrnFlag && MyEnvrnFlag ) {
 			Tgold = OutDryBulbTempAt( Surface( SurfNum ).Centroid.z ); //OutDryBulbTemp           ! initial guess
 			Tfold = OutDryBulbTempAt( Surface( SurfNum ).Centroid.z ); //OutDryBulbTemp           ! initial guess
-			Tg = 10.0;
-			Tf = 10.0;
-			Vfluxf = 0.0;
-			Vfluxg = 0.0;
+			CalcEcoRoofTg = 10.0;
+			CalcEcoRoofTf = 10.0;
+			CalcEcoRoofVfluxf = 0.0;
+			CalcEcoRoofVfluxg = 0.0;
 			CumRunoff = 0.0;
 			CumET = 0.0;
 			CumPrecip = 0.0;
@@ -435,11 +530,11 @@ namespace EcoRoofManager {
 
 		// If current surface is = FirstEcoSurf then for this time step we need to update the soil moisture
 		if ( SurfNum == FirstEcoSurf ) {
-			UpdateSoilProps( Moisture, MeanRootMoisture, MoistureMax, MoistureResidual, SoilThickness, Vfluxf, Vfluxg, ConstrNum, Alphag, unit, Tg, Tf, Qsoil );
+			UpdateSoilProps( CalcEcoRoofMoisture, CalcEcoRoofMeanRootMoisture, CalcEcoRoofMoistureMax, CalcEcoRoofMoistureResidual, CalcEcoRoofSoilThickness, CalcEcoRoofVfluxf, CalcEcoRoofVfluxg, ConstrNum, CalcEcoRoofAlphag, CalcEcoRoof_unit, CalcEcoRoofTg, CalcEcoRoofTf, CalcEcoRoofQsoil );
 
 			Ta = OutDryBulbTempAt( Surface( SurfNum ).Centroid.z ); // temperature outdoor - Surface is dry, use normal correlation
-			Tg = Tgold;
-			Tf = Tfold;
+			CalcEcoRoofTg = Tgold;
+			CalcEcoRoofTf = Tfold;
 
 			if ( Construct( ConstrNum ).CTFCross( 0 ) > 0.01 ) {
 				QuickConductionSurf = true;
@@ -453,7 +548,7 @@ namespace EcoRoofManager {
 			Qsoilpart2 = Construct( ConstrNum ).CTFOutside( 0 ) - F1temp * Construct( ConstrNum ).CTFCross( 0 );
 
 			Pa = StdBaroPress; // standard atmospheric pressure (apparently in Pascals)
-			Tgk = Tg + KelvinConv;
+			Tgk = CalcEcoRoofTg + KelvinConv;
 			Tak = Ta + KelvinConv;
 
 			sigmaf = 0.9 - 0.7 * std::exp( -0.75 * LAI ); // Fractional veg cover based on (2) from FASST TR-04-25
@@ -465,7 +560,7 @@ namespace EcoRoofManager {
 			eair = ( RH / 100.0 ) * 611.2 * std::exp( 17.67 * Ta / ( Tak - 29.65 ) );
 			qa = ( 0.622 * eair ) / ( Pa - 1.000 * eair ); // Mixing Ratio of air
 			Rhoa = Pa / ( Rair * Tak ); // Density of air. kg/m^3
-			Tif = Tf;
+			Tif = CalcEcoRoofTf;
 
 			// Air Temperature within the canopy is given as
 			// (Deardorff (1987)). Kelvin. based of the previous temperatures
@@ -483,7 +578,7 @@ namespace EcoRoofManager {
 			Waf = 0.83 * std::sqrt( Cfhn ) * sigmaf * Ws + ( 1.0 - sigmaf ) * Ws; // Wind Speed inside foliage. Equation #6, FASST model
 			Cf = 0.01 * ( 1.0 + 0.3 / Waf ); // The bulk Transfer coefficient, equation 10 page 6.
 			sheatf = e0 + 1.1 * LAI * Rhoaf * Cpa * Cf * Waf; // Intermediate calculation for Sensible Heat Transfer
-			sensiblef = sheatf * ( Taf - Tf ); // DJS Jan 2011 sensible flux TO foliage into air (Frankenstein 2004, eqn7)
+			sensiblef = sheatf * ( Taf - CalcEcoRoofTf ); // DJS Jan 2011 sensible flux TO foliage into air (Frankenstein 2004, eqn7)
 			//sourced from Frankenstein et al (2004a). Added e0 windless correction factor.
 			//an early version had (1.0-0.7)*sigmaf in calc of sensiblef... how did that get there!?! Fixed.
 
@@ -504,10 +599,10 @@ namespace EcoRoofManager {
 
 			f1inv = min( 1.0, ( 0.004 * RS + 0.005 ) / ( 0.81 * ( 0.004 * RS + 1.0 ) ) ); // SW radiation-related term
 			f1 = 1.0 / f1inv;
-			if ( MoistureMax == MoistureResidual ) {
+			if ( CalcEcoRoofMoistureMax == CalcEcoRoofMoistureResidual ) {
 				f2inv = 1.0e10;
 			} else {
-				f2inv = ( MeanRootMoisture - MoistureResidual ) / ( MoistureMax - MoistureResidual ); //Equation 19 p. 9 FASST model
+				f2inv = ( CalcEcoRoofMeanRootMoisture - CalcEcoRoofMoistureResidual ) / ( CalcEcoRoofMoistureMax - CalcEcoRoofMoistureResidual ); //Equation 19 p. 9 FASST model
 			}
 
 			//In FASST, Eq 20 is used to compute Moisture.
@@ -521,7 +616,7 @@ namespace EcoRoofManager {
 			rn = ra / ( ra + r_s ); //rn is foliage surface wetness ... NOT a resistance
 
 			// This routine is to calculate ground moisture factor. This factor is from *****
-			Mg = Moisture / MoistureMax; // m^3/m^3.
+			Mg = CalcEcoRoofMoisture / CalcEcoRoofMoistureMax; // m^3/m^3.
 			dOne = 1.0 - sigmaf * ( 0.6 * ( 1.0 - rn ) + 0.1 * ( 1.0 - Mg ) );
 
 			//Latent heat of vaporation at leaf surface temperature. The source of this
@@ -533,9 +628,9 @@ namespace EcoRoofManager {
 			//Derivative of Saturation vapor pressure, which is used in the calculation of
 			//derivative of saturation specific humidity.
 
-			Desf = 611.2 * std::exp( 17.67 * ( Tf / ( Tf + KelvinConv - 29.65 ) ) ) * ( 17.67 * Tf * ( -1.0 ) * std::pow( Tf + KelvinConv - 29.65, -2 ) + 17.67 / ( KelvinConv - 29.65 + Tf ) );
+			Desf = 611.2 * std::exp( 17.67 * ( CalcEcoRoofTf / ( CalcEcoRoofTf + KelvinConv - 29.65 ) ) ) * ( 17.67 * CalcEcoRoofTf * ( -1.0 ) * std::pow( CalcEcoRoofTf + KelvinConv - 29.65, -2 ) + 17.67 / ( KelvinConv - 29.65 + CalcEcoRoofTf ) );
 			dqf = ( ( 0.622 * Pa ) / pow_2( Pa - esf ) ) * Desf; //Derivative of saturation specific humidity
-			esg = 611.2 * std::exp( 17.67 * ( Tg / ( ( Tg + KelvinConv ) - 29.65 ) ) ); //Pa saturation vapor pressure
+			esg = 611.2 * std::exp( 17.67 * ( CalcEcoRoofTg / ( ( CalcEcoRoofTg + KelvinConv ) - 29.65 ) ) ); //Pa saturation vapor pressure
 			// From Garratt - eqn. A21, p284.
 			// Note that Tg and Tg+KelvinConv usage is correct.
 			qsg = 0.622 * esg / ( Pa - esg ); //Saturation mixing ratio at ground surface temperature.
@@ -545,7 +640,7 @@ namespace EcoRoofManager {
 			//Check to see if ice is sublimating or frost is forming.
 			if ( Tgold < 0.0 ) Leg = 2.838e6; // per FASST documentation p.15 after eqn. 37.
 
-			Desg = 611.2 * std::exp( 17.67 * ( Tg / ( Tg + KelvinConv - 29.65 ) ) ) * ( 17.67 * Tg * ( -1.0 ) * std::pow( Tg + KelvinConv - 29.65, -2 ) + 17.67 / ( KelvinConv - 29.65 + Tg ) );
+			Desg = 611.2 * std::exp( 17.67 * ( CalcEcoRoofTg / ( CalcEcoRoofTg + KelvinConv - 29.65 ) ) ) * ( 17.67 * CalcEcoRoofTg * ( -1.0 ) * std::pow( CalcEcoRoofTg + KelvinConv - 29.65, -2 ) + 17.67 / ( KelvinConv - 29.65 + CalcEcoRoofTg ) );
 			dqg = ( 0.622 * Pa / pow_2( Pa - esg ) ) * Desg;
 
 			//Final Ground Atmosphere Energy Balance
@@ -554,7 +649,7 @@ namespace EcoRoofManager {
 
 			//Average density of air with respect to ground surface and air temperature
 			Rhoag = ( Rhoa + Rhog ) / 2.0;
-			Rib = 2.0 * g1 * Za * ( Taf - Tg ) / ( ( Tafk + Tgk ) * pow_2( Waf ) ); //Richardson Number
+			Rib = 2.0 * g1 * Za * ( Taf - CalcEcoRoofTg ) / ( ( Tafk + Tgk ) * pow_2( Waf ) ); //Richardson Number
 
 			// Compute the stability factor Gammah
 			if ( Rib < 0.0 ) {
@@ -583,7 +678,7 @@ namespace EcoRoofManager {
 			Chng = pow_2( Kv / std::log( Za / Zog ) ) / rch; // bulk transfer coefficient near ground
 			Chg = Gammah * ( ( 1.0 - sigmaf ) * Chng + sigmaf * Cfhn );
 			sheatg = e0 + Rhoag * Cpa * Chg * Waf; // added the e0 windless correction
-			sensibleg = sheatg * ( Taf - Tg ); // sensible flux TO soil (W/m^2) DJS Jan 2011 (eqn. 32 in Frankenstein 2004)
+			sensibleg = sheatg * ( Taf - CalcEcoRoofTg ); // sensible flux TO soil (W/m^2) DJS Jan 2011 (eqn. 32 in Frankenstein 2004)
 
 			Chne = pow_2( Kv / std::log( Za / Zog ) ) / rche;
 			Ce = Gammah * ( ( 1.0 - sigmaf ) * Chne + sigmaf * Cfhn ); // this is in fact Ceg in eq (28)
@@ -603,10 +698,10 @@ namespace EcoRoofManager {
 			// a sign difference !!! (qsf -qaf) and (qg - qaf) ?!
 			// These may be useful, however for telling the UpdateSoilProps routine
 			// how much evaporation has taken place...
-			Vfluxf = -1.0 * Lf / Lef / 990.0; // water evapotranspire rate [m/s]
-			Vfluxg = -1.0 * Lg / Leg / 990.0; // water evapotranspire rate [m/s]
-			if ( Vfluxf < 0.0 ) Vfluxf = 0.0; // According to FASST Veg. Models p. 11, eqn 26-27, if Qfsat > qaf the actual
-			if ( Vfluxg < 0.0 ) Vfluxg = 0.0; // evaporative fluxes should be set to zero (delta_c = 1 or 0).
+			CalcEcoRoofVfluxf = -1.0 * Lf / Lef / 990.0; // water evapotranspire rate [m/s]
+			CalcEcoRoofVfluxg = -1.0 * Lg / Leg / 990.0; // water evapotranspire rate [m/s]
+			if ( CalcEcoRoofVfluxf < 0.0 ) CalcEcoRoofVfluxf = 0.0; // According to FASST Veg. Models p. 11, eqn 26-27, if Qfsat > qaf the actual
+			if ( CalcEcoRoofVfluxg < 0.0 ) CalcEcoRoofVfluxg = 0.0; // evaporative fluxes should be set to zero (delta_c = 1 or 0).
 
 			// P1, P2, P3 corespond to first, second and third terms of equation 37 in the main report.
 
@@ -615,8 +710,8 @@ namespace EcoRoofManager {
 			//   revisit this issue later.
 			//   Implement an iterative solution scheme to solve the simultaneous equations for Leaf and Soil temperature.
 			//   Prior experience suggests that no more than 3 iterations are likely needed
-			LeafTK = Tf + KelvinConv;
-			SoilTK = Tg + KelvinConv;
+			LeafTK = CalcEcoRoofTf + KelvinConv;
+			SoilTK = CalcEcoRoofTg + KelvinConv;
 
 			for ( EcoLoop = 1; EcoLoop <= 3; ++EcoLoop ) {
 				P1 = sigmaf * ( RS * ( 1.0 - Alphaf ) + epsilonf * Latm ) - 3.0 * sigmaf * epsilonf * epsilong * Sigma * pow_4( SoilTK ) / EpsilonOne - 3.0 * ( -sigmaf * epsilonf * Sigma - sigmaf * epsilonf * epsilong * Sigma / EpsilonOne ) * pow_4( LeafTK ) + sheatf * ( 1.0 - 0.7 * sigmaf ) * ( Ta + KelvinConv ) + LAI * Rhoaf * Cf * Lef * Waf * rn * ( ( 1.0 - 0.7 * sigmaf ) / dOne ) * qa + LAI * Rhoaf * Cf * Lef * Waf * rn * ( ( ( 0.6 * sigmaf * rn ) / dOne ) - 1.0 ) * ( qsf - LeafTK * dqf ) + LAI * Rhoaf * Cf * Lef * Waf * rn * ( ( 0.1 * sigmaf * Mg ) / dOne ) * ( qsg - SoilTK * dqg );
@@ -628,7 +723,7 @@ namespace EcoRoofManager {
 				//  as with the equations for vegetation the first term in the ground eqn in FASST has a
 				//  term starting with gamma_p --- if no precip this vanishes. Again, revisit this issue later.
 
-				T1G = ( 1.0 - sigmaf ) * ( RS * ( 1.0 - Alphag ) + epsilong * Latm ) - ( 3.0 * ( sigmaf * epsilonf * epsilong * Sigma ) / EpsilonOne ) * pow_4( LeafTK ) - 3.0 * ( -( 1.0 - sigmaf ) * epsilong * Sigma - sigmaf * epsilonf * epsilong * Sigma / EpsilonOne ) * pow_4( SoilTK ) + sheatg * ( 1.0 - 0.7 * sigmaf ) * ( Ta + KelvinConv ) + Rhoag * Ce * Leg * Waf * Mg * ( ( 1.0 - 0.7 * sigmaf ) / dOne ) * qa + Rhoag * Ce * Leg * Waf * Mg * ( 0.1 * sigmaf * Mg / dOne - Mg ) * ( qsg - SoilTK * dqg ) + Rhoag * Ce * Leg * Waf * Mg * ( 0.6 * sigmaf * rn / dOne ) * ( qsf - LeafTK * dqf ) + Qsoilpart1 + Qsoilpart2 * ( KelvinConv ); //finished by T1G
+				T1G = ( 1.0 - sigmaf ) * ( RS * ( 1.0 - CalcEcoRoofAlphag ) + epsilong * Latm ) - ( 3.0 * ( sigmaf * epsilonf * epsilong * Sigma ) / EpsilonOne ) * pow_4( LeafTK ) - 3.0 * ( -( 1.0 - sigmaf ) * epsilong * Sigma - sigmaf * epsilonf * epsilong * Sigma / EpsilonOne ) * pow_4( SoilTK ) + sheatg * ( 1.0 - 0.7 * sigmaf ) * ( Ta + KelvinConv ) + Rhoag * Ce * Leg * Waf * Mg * ( ( 1.0 - 0.7 * sigmaf ) / dOne ) * qa + Rhoag * Ce * Leg * Waf * Mg * ( 0.1 * sigmaf * Mg / dOne - Mg ) * ( qsg - SoilTK * dqg ) + Rhoag * Ce * Leg * Waf * Mg * ( 0.6 * sigmaf * rn / dOne ) * ( qsf - LeafTK * dqf ) + Qsoilpart1 + Qsoilpart2 * ( KelvinConv ); //finished by T1G
 
 				T2G = 4.0 * ( -( 1.0 - sigmaf ) * epsilong * Sigma - sigmaf * epsilonf * epsilong * Sigma / EpsilonOne ) * pow_3( SoilTK ) + ( 0.1 * sigmaf - 1.0 ) * sheatg + Rhoag * Ce * Leg * Waf * Mg * ( 0.1 * sigmaf * Mg / dOne - Mg ) * dqg - Qsoilpart2;
 
@@ -644,7 +739,7 @@ namespace EcoRoofManager {
 				// difference scheme this loop structure should be removed.
 
 			} // This loop does an iterative solution of the simultaneous equations
-			Qsoil = -1.0 * ( Qsoilpart1 - Qsoilpart2 * ( SoilTK - KelvinConv ) ); // This is heat flux INTO top of the soil
+			CalcEcoRoofQsoil = -1.0 * ( Qsoilpart1 - Qsoilpart2 * ( SoilTK - KelvinConv ) ); // This is heat flux INTO top of the soil
 			Tfold = LeafTK - KelvinConv;
 			Tgold = SoilTK - KelvinConv;
 
@@ -721,10 +816,7 @@ namespace EcoRoofManager {
 		Real64 RatioMax;
 		Real64 RatioMin;
 		Real64 MoistureDiffusion; // moisture transport down from near-surface to root zone
-		static Real64 TopDepth; // Thickness of "near-surface" soil layer
-		static Real64 RootDepth( 0.0 ); // Thickness of "root zone" soil layer //Autodesk Was used uninitialized
 		// Note TopDepth+RootDepth = thickness of ecoroof soil layer
-		static Real64 TimeStepZoneSec; // Seconds per TimeStep
 		Real64 SoilConductivity; // Moisture dependent conductivity to be fed back into CTF Calculator
 		Real64 SoilSpecHeat; // Moisture dependent Spec. Heat to be fed back into CTF Calculator
 		Real64 SoilAbsorpSolar; // Moisture dependent Solar absorptance (1-albedo)
@@ -733,25 +825,10 @@ namespace EcoRoofManager {
 		Real64 SatRatio;
 		Real64 TestRatio; // Ratio to determine if timestep change in properties is too abrupt for CTF
 
-		static Real64 DryCond; // Dry soil value of conductivity
-		static Real64 DryDens; // Dry soil value of density
-		static Real64 DryAbsorp; // Dry soil value of solar absorptance (1-albedo)
-		static Real64 DrySpecHeat; // Dry soil value of specific heat
 		Real64 AvgMoisture; // Average soil moisture over depth of ecoroof media
 
-		static bool UpdatebeginFlag( true ); // one time flag
-
-		static Real64 CapillaryPotentialTop( -3.8997 ); // This variable keeps track of the capillary potential of the soil in both layers and time (m)
-		static Real64 CapillaryPotentialRoot( -3.8997 ); // This variable keeps track of the capillary potential of the soil in both layers and time (m)
-		static Real64 SoilHydroConductivityTop( 8.72e-6 ); // This is the soil water conductivity in the soil (m/s)
-		static Real64 SoilHydroConductivityRoot( 8.72e-6 ); // This is the soil water conductivity in the soil (m/s)
-		static Real64 SoilConductivityAveTop( 8.72e-6 ); // This is the average soil water conductivity (m/s)
-		static Real64 SoilConductivityAveRoot( 8.72e-6 );
-		static Real64 RelativeSoilSaturationTop; // Relative Soil Saturation (soil moisture-residual soil moisture)/(saturation soil moisture-residual soil moisture)
-		static Real64 RelativeSoilSaturationRoot;
-		static Real64 TestMoisture( 0.15 ); // This makes sure that the moisture cannot change by too much in each step
+
 		int index1;
-		static int ErrIndex( 0 );
 
 		// NOTE:  As Energyplus calls the energy balance manager (and hence CalcEcoroof)
 		// once for each surface within each zone that has an ecoroof
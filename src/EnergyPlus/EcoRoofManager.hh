@@ -90,6 +90,11 @@ namespace EcoRoofManager {
 
 	// Functions
 
+	// Clears the global data in EcoRoofManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	CalcEcoRoof(
 		int const SurfNum, // Indicator of Surface Number for the current surface
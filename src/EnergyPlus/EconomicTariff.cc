@@ -335,6 +335,19 @@ namespace EconomicTariff {
 		using DataGlobals::DoOutputReporting;
 		using DataGlobals::KindOfSim;
 		using DataGlobals::ksRunPeriodWeather;
+
+		GetInputEconomics();
+		if ( DoOutputReporting && ( KindOfSim == ksRunPeriodWeather ) ) {
+			GatherForEconomics();
+		}
+	}
+
+	void
+	GetInputEconomics()
+	{
+		//    Gets the input of the tariffs the first time it is called.  A simulation resumed from a
+		//    checkpoint calls it before restoring the gathered energy and demand.
+
 		using OutputReportTabular::AddTOCEntry;
 		using OutputReportTabular::displayEconomicResultSummary;
 
@@ -358,9 +371,6 @@ namespace EconomicTariff {
 			Update_GetInput = false;
 			if ( ErrorsFound ) ShowFatalError( "UpdateUtilityBills: Preceding errors cause termination." );
 		}
-		if ( DoOutputReporting && ( KindOfSim == ksRunPeriodWeather ) ) {
-			GatherForEconomics();
-		}
 	}
 
 	//======================================================================================================================
@@ -681,6 +681,9 @@ namespace EconomicTariff {
 	void
 	UpdateUtilityBills();
 
+	void
+	GetInputEconomics();
+
 	//======================================================================================================================
 	//======================================================================================================================
 
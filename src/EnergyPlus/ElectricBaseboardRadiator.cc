@@ -147,8 +147,48 @@ namespace ElectricBaseboardRadiator {
 	Array1D< ElecBaseboardParams > ElecBaseboard;
 	Array1D< ElecBaseboardNumericFieldData > ElecBaseboardNumericFields;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // One time get input flag
+		bool ErrorsFound( false ); // If errors detected in input
+		bool MyOneTimeFlag( true );
+		bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
+		Array1D_bool MyEnvrnFlag;
+		int Iter( 0 );
+		bool UpdateElectricBaseboardMyEnvrnFlag( true );
+	}
+
 	// Functions
 
+	// Clears the global data in ElectricBaseboardRadiator.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumElecBaseboards = 0;
+		QBBElecRadSource.deallocate();
+		QBBElecRadSrcAvg.deallocate();
+		ZeroSourceSumHATsurf.deallocate();
+		LastQBBElecRadSrc.deallocate();
+		LastSysTimeElapsed.deallocate();
+		LastTimeStepSys.deallocate();
+		MySizeFlag.deallocate();
+		CheckEquipName.deallocate();
+		ElecBaseboard.deallocate();
+		ElecBaseboardNumericFields.deallocate();
+		GetInputFlag = true;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		ZoneEquipmentListChecked = false;
+		MyEnvrnFlag.deallocate();
+		Iter = 0;
+		UpdateElectricBaseboardMyEnvrnFlag = true;
+	}
+
 	void
 	SimElecBaseboard(
 		std::string const & EquipName,
@@ -193,7 +233,6 @@ namespace ElectricBaseboardRadiator {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int BaseboardNum; // Index of unit in baseboard array
-		static bool GetInputFlag( true ); // One time get input flag
 
 		if ( GetInputFlag ) {
 			GetElectricBaseboardInput();
@@ -306,7 +345,6 @@ namespace ElectricBaseboardRadiator {
 		int NumNumbers;
 		int SurfNum; // surface number that radiant heat delivered
 		int IOStat;
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool errFlag;
@@ -582,11 +620,8 @@ namespace ElectricBaseboardRadiator {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ZoneNode;
-		static bool MyOneTimeFlag( true );
-		static bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
 		int ZoneNum;
 		int Loop;
-		static Array1D_bool MyEnvrnFlag;
 
 		// Do the one time initializations
 		if ( MyOneTimeFlag ) {
@@ -953,15 +988,13 @@ namespace ElectricBaseboardRadiator {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int Iter( 0 );
-		static bool MyEnvrnFlag( true );
 
-		if ( BeginEnvrnFlag && MyEnvrnFlag ) {
+		if ( BeginEnvrnFlag && UpdateElectricBaseboardMyEnvrnFlag ) {
 			Iter = 0;
-			MyEnvrnFlag = false;
+			UpdateElectricBaseboardMyEnvrnFlag = false;
 		}
 		if ( ! BeginEnvrnFlag ) {
-			MyEnvrnFlag = true;
+			UpdateElectricBaseboardMyEnvrnFlag = true;
 		}
 
 		// First, update the running average if necessary...
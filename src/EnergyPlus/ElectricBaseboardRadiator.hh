@@ -174,6 +174,11 @@ namespace ElectricBaseboardRadiator {
 
 	// Functions
 
+	// Clears the global data in ElectricBaseboardRadiator.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimElecBaseboard(
 		std::string const & EquipName,
@@ -220,6 +220,8 @@
 #include <Psychrometrics.hh>
 #include <ScheduleManager.hh>
 #include <SimulationManager.hh>
+#include <SQLiteProcedures.hh>
+#include <StateManagement.hh>
 #include <UtilityRoutines.hh>
 
 #ifdef _WIN32
@@ -229,7 +231,7 @@
  #include <unistd.h>
 #endif
 
-void
+int
 EnergyPlusPgm( std::string const & filepath )
 {
 	// Using/Aliasing
@@ -303,7 +305,8 @@ EnergyPlusPgm( std::string const & filepath )
 	// na
 
 	// PROGRAM LOCAL VARIABLE DECLARATIONS:
-	static std::string cEnvValue;
+	std::string cEnvValue;
+	static std::string const BaseVerString( VerString ); // VerString before the run date/time is appended
 
 	//                           INITIALIZE VARIABLES
 	Time_Start = epElapsedTime();
@@ -312,7 +315,7 @@ EnergyPlusPgm( std::string const & filepath )
 #endif
 
 	CreateCurrentDateTimeString( CurrentDateTime );
-	VerString += "," + CurrentDateTime;
+	VerString = BaseVerString + "," + CurrentDateTime;
 
 	get_environment_variable( DDOnlyEnvVar, cEnvValue );
 	DDOnly = env_var_on( cEnvValue ); // Yes or True
@@ -398,6 +401,28 @@ EnergyPlusPgm( std::string const & filepath )
 	get_environment_variable( TraceHVACControllerEnvVar, cEnvValue );
 	if ( ! cEnvValue.empty() ) TraceHVACControllerEnvFlag = env_var_on( cEnvValue ); // Yes or True
 
+	// Initialize env flag for root solver convergence statistics
+	get_environment_variable( TrackRootSolverEnvVar, cEnvValue );
+	if ( ! cEnvValue.empty() ) TrackRootSolverEnvFlag = env_var_on( cEnvValue ); // Yes or True
+
+	// Initialize env flag for DX coil performance memoization
+	get_environment_variable( MemoizeDXCoilEnvVar, cEnvValue );
+	if ( ! cEnvValue.empty() ) MemoizeDXCoilEnvFlag = env_var_on( cEnvValue ); // Yes or True
+
+	// Initialize env flag for tabulated superheated refrigerant temperatures
+	get_environment_variable( RefrigTablesEnvVar, cEnvValue );
+	if ( ! cEnvValue.empty() ) RefrigTablesEnvFlag = env_var_on( cEnvValue ); // Yes or True
+
+	// Initialize env flag for tabulated window thermal response
+	get_environment_variable( WindowTablesEnvVar, cEnvValue );
+	if ( ! cEnvValue.empty() ) WindowTablesEnvFlag = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( WarmStartEnvVar, cEnvValue );
+	WarmStartFileName = cEnvValue;
+
+	get_environment_variable( CheckpointEnvVar, cEnvValue );
+	CheckpointFileName = cEnvValue;
+
 	get_environment_variable( cDisplayInputInAuditEnvVar, cEnvValue );
 	if ( ! cEnvValue.empty() ) DisplayInputInAudit = env_var_on( cEnvValue ); // Yes or True
 
@@ -423,6 +448,10 @@ EnergyPlusPgm( std::string const & filepath )
 		CommandLineInterface::ProcessArgs( dummy_argc, dummy_argv );
 	}
 
+	// The g-function cache defaults to the output directory set by ProcessArgs
+	get_environment_variable( GFunctionCacheEnvVar, cEnvValue );
+	if ( ! cEnvValue.empty() ) GFunctionCacheFileName = cEnvValue;
+
 	OutputStandardError = GetNewUnitNumber();
 	{
 		IOFlags flags;
@@ -529,7 +558,13 @@ EnergyPlusPgm( std::string const & filepath )
 		AbortEnergyPlus();
 	}
 
-	EndEnergyPlus();
+	int const status = EndEnergyPlus();
+
+	// Leave the module state as it was before the run so that a library client can call again
+	sqlite.reset();
+	StateManagement::clear_all_states();
+
+	return status;
 }
 
 void StoreProgressCallback( void(*f)( int const ) )
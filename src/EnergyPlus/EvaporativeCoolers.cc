@@ -188,8 +188,85 @@ namespace EvaporativeCoolers {
 	// MODULE SUBROUTINES:
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false );
+		bool MySetPointCheckFlag( true );
+		bool MyOneTimeFlag( true );
+		bool localSetPointCheck( false );
+		bool CoolerOnOApath( false );
+		bool CoolerOnMainAirLoop( false );
+		int AirSysBranchLoop( 0 );
+		int BranchComp( 0 );
+		Real64 BlowDownVdot( 0.0 );
+		Real64 DriftVdot( 0.0 );
+		Real64 EvapVdot( 0.0 );
+		Real64 CalcIndirectResearchSpecialEvapCoolerAdvancedBlowDownVdot( 0.0 );
+		Real64 CalcIndirectResearchSpecialEvapCoolerAdvancedDriftVdot( 0.0 );
+		Real64 CalcIndirectResearchSpecialEvapCoolerAdvancedEvapVdot( 0.0 );
+		Real64 CalcDirectResearchSpecialEvapCoolerBlowDownVdot( 0.0 );
+		Real64 CalcDirectResearchSpecialEvapCoolerDriftVdot( 0.0 );
+		Real64 CalcDirectResearchSpecialEvapCoolerEvapVdot( 0.0 );
+		Real64 AvailWaterRate( 0.0 );
+		bool GetInputZoneEvaporativeCoolerUnitErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		Array1D_bool InitZoneEvaporativeCoolerUnitMySizeFlag;
+		bool InitZoneEvaporativeCoolerUnitMyOneTimeFlag( true ); // one time flag
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool MyFanFlag;
+		Array1D_bool MyZoneEqFlag; // used to set up zone equipment availability managers
+		bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
+		Real64 ErrorToler( 0.001 ); // error tolerance
+	}
+
 	// Functions
 
+	// Clears the global data in EvaporativeCoolers.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		GetInputEvapComponentsFlag = true;
+		NumEvapCool = 0;
+		MySizeFlag.deallocate();
+		CheckEquipName.deallocate();
+		NumZoneEvapUnits = 0;
+		CheckZoneEvapUnitName.deallocate();
+		GetInputZoneEvapUnit = true;
+		EvapCond.deallocate();
+		ZoneEvapUnit.deallocate();
+		ZoneEvapCoolerUnitFields.deallocate();
+		ErrorsFound = false;
+		MySetPointCheckFlag = true;
+		MyOneTimeFlag = true;
+		localSetPointCheck = false;
+		CoolerOnOApath = false;
+		CoolerOnMainAirLoop = false;
+		AirSysBranchLoop = 0;
+		BranchComp = 0;
+		BlowDownVdot = 0.0;
+		DriftVdot = 0.0;
+		EvapVdot = 0.0;
+		CalcIndirectResearchSpecialEvapCoolerAdvancedBlowDownVdot = 0.0;
+		CalcIndirectResearchSpecialEvapCoolerAdvancedDriftVdot = 0.0;
+		CalcIndirectResearchSpecialEvapCoolerAdvancedEvapVdot = 0.0;
+		CalcDirectResearchSpecialEvapCoolerBlowDownVdot = 0.0;
+		CalcDirectResearchSpecialEvapCoolerDriftVdot = 0.0;
+		CalcDirectResearchSpecialEvapCoolerEvapVdot = 0.0;
+		AvailWaterRate = 0.0;
+		GetInputZoneEvaporativeCoolerUnitErrorsFound = false;
+		InitZoneEvaporativeCoolerUnitMySizeFlag.deallocate();
+		InitZoneEvaporativeCoolerUnitMyOneTimeFlag = true;
+		MyEnvrnFlag.deallocate();
+		MyFanFlag.deallocate();
+		MyZoneEqFlag.deallocate();
+		ZoneEquipmentListChecked = false;
+		ErrorToler = 0.001;
+	}
+
 	void
 	SimEvapCooler(
 		std::string const & CompName,
@@ -345,7 +422,6 @@ namespace EvaporativeCoolers {
 		int NumAlphas;
 		int NumNums;
 		int IOStat;
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 
@@ -827,9 +903,6 @@ namespace EvaporativeCoolers {
 		int ControlNode;
 		int OutNode;
 		int EvapUnitNum;
-		static bool MySetPointCheckFlag( true );
-		static bool MyOneTimeFlag( true );
-		static bool localSetPointCheck( false );
 
 		if ( MyOneTimeFlag ) {
 			MySizeFlag.dimension( NumEvapCool, true );
@@ -993,10 +1066,6 @@ namespace EvaporativeCoolers {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool CoolerOnOApath( false );
-		static bool CoolerOnMainAirLoop( false );
-		static int AirSysBranchLoop( 0 );
-		static int BranchComp( 0 );
 		bool HardSizeNoDesRun;			// Indicator to a hard-sized field with no design sizing data
 		bool IsAutoSize;				// Indicator to autosize
 		Real64 IndirectVolFlowRateDes;	// Autosized volume flow rate for reporting
@@ -2052,9 +2121,6 @@ namespace EvaporativeCoolers {
 		Real64 PurgeHumRat;
 		Real64 PurgeEnthalpy;
 		Real64 PurgeTemp;
-		static Real64 BlowDownVdot( 0.0 );
-		static Real64 DriftVdot( 0.0 );
-		static Real64 EvapVdot( 0.0 );
 
 		// If the Evaporative Cooler  is operating there should be some mass flow rate
 		//  Also the evap cooler has to be scheduled to be available
@@ -2308,9 +2374,6 @@ namespace EvaporativeCoolers {
 		Real64 RhoWater;
 		Real64 RhoAir; // Density of the primary side air
 		Real64 MassFlowRateSecMin;
-		static Real64 BlowDownVdot( 0.0 );
-		static Real64 DriftVdot( 0.0 );
-		static Real64 EvapVdot( 0.0 );
 
 		FlowRatioSecDry = 0.0;
 		FlowRatioSecWet = 0.0;
@@ -2352,7 +2415,7 @@ namespace EvaporativeCoolers {
 			Par( 4 ) = InletDryBulbTempSec;
 			Par( 5 ) = InletWetBulbTempSec;
 			Par( 6 ) = InletHumRatioSec;
-			SolveRegulaFalsi( TempTol, MaxIte, SolFla, AirMassFlowSec, CalcEvapCoolRDDSecFlowResidual, MassFlowRateSecMin, MassFlowRateSecMax, Par );
+			SolveRegulaFalsi( TempTol, MaxIte, SolFla, AirMassFlowSec, CalcEvapCoolRDDSecFlowResidual, MassFlowRateSecMin, MassFlowRateSecMax, Par, "CalcIndirectResearchSpecialEvapCoolerAdvanced" );
 			// if the numerical inversion failed, issue error messages.
 			if ( SolFla == -1 ) {
 				if ( !WarmupFlag ) {
@@ -2403,7 +2466,7 @@ namespace EvaporativeCoolers {
 			Par( 6 ) = InletHumRatioSec;
 			// get dry operation performance first
 			Par( 2 ) = double( DryModulated );
-			SolveRegulaFalsi( TempTol, MaxIte, SolFla, AirMassFlowSec, CalcEvapCoolRDDSecFlowResidual, MassFlowRateSecMin, MassFlowRateSecMax, Par );
+			SolveRegulaFalsi( TempTol, MaxIte, SolFla, AirMassFlowSec, CalcEvapCoolRDDSecFlowResidual, MassFlowRateSecMin, MassFlowRateSecMax, Par, "CalcIndirectResearchSpecialEvapCoolerAdvanced" );
 			// if the numerical inversion failed, issue error messages.
 			if ( SolFla == -1 ) {
 				if ( !WarmupFlag ) {
@@ -2442,7 +2505,7 @@ namespace EvaporativeCoolers {
 			EvapCoolerTotalElectricPowerDry = IndEvapCoolerPower( EvapCoolNum, DryModulated, FlowRatioSecDry );
 			// get wet operation performance
 			Par( 2 ) = double( WetModulated );
-			SolveRegulaFalsi( TempTol, MaxIte, SolFla, AirMassFlowSec, CalcEvapCoolRDDSecFlowResidual, MassFlowRateSecMin, MassFlowRateSecMax, Par );
+			SolveRegulaFalsi( TempTol, MaxIte, SolFla, AirMassFlowSec, CalcEvapCoolRDDSecFlowResidual, MassFlowRateSecMin, MassFlowRateSecMax, Par, "CalcIndirectResearchSpecialEvapCoolerAdvanced" );
 			// if the numerical inversion failed, issue error messages.
 			if ( SolFla == -1 ) {
 				if ( !WarmupFlag ) {
@@ -2502,7 +2565,7 @@ namespace EvaporativeCoolers {
 			Par( 4 ) = InletDryBulbTempSec;
 			Par( 5 ) = InletWetBulbTempSec;
 			Par( 6 ) = InletHumRatioSec;
-			SolveRegulaFalsi( TempTol, MaxIte, SolFla, AirMassFlowSec, CalcEvapCoolRDDSecFlowResidual, MassFlowRateSecMin, MassFlowRateSecMax, Par );
+			SolveRegulaFalsi( TempTol, MaxIte, SolFla, AirMassFlowSec, CalcEvapCoolRDDSecFlowResidual, MassFlowRateSecMin, MassFlowRateSecMax, Par, "CalcIndirectResearchSpecialEvapCoolerAdvanced" );
 			// if the numerical inversion failed, issue error messages.
 			if ( SolFla == -1 ) {
 				if ( !WarmupFlag ) {
@@ -2576,15 +2639,15 @@ namespace EvaporativeCoolers {
 				CalcSecondaryAirOutletCondition( EvapCoolNum, EvapCond( EvapCoolNum ).EvapCoolerRDDOperatingMode, EvapCond( EvapCoolNum ).SecInletMassFlowRate, InletDryBulbTempSec, InletWetBulbTempSec, InletHumRatioSec, QHX, QHXLatent );
 				RhoWater = RhoH2O( OutDryBulbTemp ); // this if it is at the outside air inlet node condition
 				hfg = PsyHfgAirFnWTdb( InletHumRatioSec, InletDryBulbTempSec );
-				EvapVdot = ( QHXLatent ) / ( hfg * RhoWater );
-				DriftVdot = EvapVdot * EvapCond( EvapCoolNum ).DriftFraction;
+				CalcIndirectResearchSpecialEvapCoolerAdvancedEvapVdot = ( QHXLatent ) / ( hfg * RhoWater );
+				CalcIndirectResearchSpecialEvapCoolerAdvancedDriftVdot = CalcIndirectResearchSpecialEvapCoolerAdvancedEvapVdot * EvapCond( EvapCoolNum ).DriftFraction;
 				if ( EvapCond( EvapCoolNum ).BlowDownRatio > 0.0 ) {
-					BlowDownVdot = EvapVdot / ( EvapCond( EvapCoolNum ).BlowDownRatio - 1 ) - DriftVdot;
-					if ( BlowDownVdot < 0.0 ) BlowDownVdot = 0.0;
+					CalcIndirectResearchSpecialEvapCoolerAdvancedBlowDownVdot = CalcIndirectResearchSpecialEvapCoolerAdvancedEvapVdot / ( EvapCond( EvapCoolNum ).BlowDownRatio - 1 ) - CalcIndirectResearchSpecialEvapCoolerAdvancedDriftVdot;
+					if ( CalcIndirectResearchSpecialEvapCoolerAdvancedBlowDownVdot < 0.0 ) CalcIndirectResearchSpecialEvapCoolerAdvancedBlowDownVdot = 0.0;
 				} else {
-					BlowDownVdot = 0.0;
+					CalcIndirectResearchSpecialEvapCoolerAdvancedBlowDownVdot = 0.0;
 				}
-				EvapCond( EvapCoolNum ).EvapWaterConsumpRate = EvapVdot + DriftVdot + BlowDownVdot;
+				EvapCond( EvapCoolNum ).EvapWaterConsumpRate = CalcIndirectResearchSpecialEvapCoolerAdvancedEvapVdot + CalcIndirectResearchSpecialEvapCoolerAdvancedDriftVdot + CalcIndirectResearchSpecialEvapCoolerAdvancedBlowDownVdot;
 				// A numerical check to keep from having very tiny negative water consumption values being reported
 				if ( EvapCond( EvapCoolNum ).EvapWaterConsumpRate < 0.0 ) EvapCond( EvapCoolNum ).EvapWaterConsumpRate = 0.0;
 			} else {
@@ -3008,9 +3071,6 @@ namespace EvaporativeCoolers {
 		Real64 MassFlowRateSysDesign; // primary air design mass flow rate
 		Real64 MassFlowRateSys; // primary air current mass flow rate
 		int InletNode; // inlet node number
-		static Real64 BlowDownVdot( 0.0 );
-		static Real64 DriftVdot( 0.0 );
-		static Real64 EvapVdot( 0.0 );
 		bool EvapCoolerOperatingLimitFlag( false );
 
 
@@ -3098,17 +3158,17 @@ namespace EvaporativeCoolers {
 			//                                /RhoWater [kg H2O/m3 H2O]
 			//******************
 			RhoWater = RhoH2O( EvapCond( EvapCoolNum ).OutletTemp );
-			EvapVdot = ( EvapCond( EvapCoolNum ).OutletHumRat - EvapCond( EvapCoolNum ).InletHumRat ) * EvapCond( EvapCoolNum ).InletMassFlowRate / RhoWater;
-			DriftVdot = EvapVdot * EvapCond( EvapCoolNum ).DriftFraction;
+			CalcDirectResearchSpecialEvapCoolerEvapVdot = ( EvapCond( EvapCoolNum ).OutletHumRat - EvapCond( EvapCoolNum ).InletHumRat ) * EvapCond( EvapCoolNum ).InletMassFlowRate / RhoWater;
+			CalcDirectResearchSpecialEvapCoolerDriftVdot = CalcDirectResearchSpecialEvapCoolerEvapVdot * EvapCond( EvapCoolNum ).DriftFraction;
 
 			if ( EvapCond( EvapCoolNum ).BlowDownRatio > 0.0 ) {
-				BlowDownVdot = EvapVdot / ( EvapCond( EvapCoolNum ).BlowDownRatio - 1.0 ) - DriftVdot;
-				if ( BlowDownVdot < 0.0 ) BlowDownVdot = 0.0;
+				CalcDirectResearchSpecialEvapCoolerBlowDownVdot = CalcDirectResearchSpecialEvapCoolerEvapVdot / ( EvapCond( EvapCoolNum ).BlowDownRatio - 1.0 ) - CalcDirectResearchSpecialEvapCoolerDriftVdot;
+				if ( CalcDirectResearchSpecialEvapCoolerBlowDownVdot < 0.0 ) CalcDirectResearchSpecialEvapCoolerBlowDownVdot = 0.0;
 			} else {
-				BlowDownVdot = 0.0;
+				CalcDirectResearchSpecialEvapCoolerBlowDownVdot = 0.0;
 			}
 
-			EvapCond( EvapCoolNum ).EvapWaterConsumpRate = EvapVdot + DriftVdot + BlowDownVdot;
+			EvapCond( EvapCoolNum ).EvapWaterConsumpRate = CalcDirectResearchSpecialEvapCoolerEvapVdot + CalcDirectResearchSpecialEvapCoolerDriftVdot + CalcDirectResearchSpecialEvapCoolerBlowDownVdot;
 
 			// A numerical check to keep from having very tiny negative water consumption values being reported
 			if ( EvapCond( EvapCoolNum ).EvapWaterConsumpRate < 0.0 ) EvapCond( EvapCoolNum ).EvapWaterConsumpRate = 0.0;
@@ -3184,7 +3244,6 @@ namespace EvaporativeCoolers {
 		int InletNode;
 		int OutletNodeSec;
 		int InletNodeSec;
-		static Real64 AvailWaterRate( 0.0 );
 
 		OutletNode = EvapCond( EvapCoolNum ).OutletNode;
 		InletNode = EvapCond( EvapCoolNum ).InletNode;
@@ -3441,7 +3500,6 @@ namespace EvaporativeCoolers {
 		int MaxNumbers; // Maximum number of numeric fields in all objects
 		int NumFields; // Total number of fields in object
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool errFlag;
@@ -3486,7 +3544,7 @@ namespace EvaporativeCoolers {
 				IsBlank = false;
 				VerifyName( Alphas( 1 ), ZoneEvapUnit, UnitLoop - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetInputZoneEvaporativeCoolerUnitErrorsFound = true;
 					if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 				}
 				ZoneEvapUnit( UnitLoop ).Name = Alphas( 1 );
@@ -3497,7 +3555,7 @@ namespace EvaporativeCoolers {
 					if ( ZoneEvapUnit( UnitLoop ).AvailSchedIndex == 0 ) {
 						ShowSevereError( CurrentModuleObject + "=\"" + ZoneEvapUnit( UnitLoop ).Name + "\" invalid data." );
 						ShowContinueError( "invalid-not found " + cAlphaFields( 2 ) + "=\"" + Alphas( 2 ) + "\"." );
-						ErrorsFound = true;
+						GetInputZoneEvaporativeCoolerUnitErrorsFound = true;
 					}
 				}
 
@@ -3505,12 +3563,12 @@ namespace EvaporativeCoolers {
 					ZoneEvapUnit( UnitLoop ).AvailManagerListName = Alphas( 3 );
 				}
 
-				ZoneEvapUnit( UnitLoop ).OAInletNodeNum = GetOnlySingleNode( Alphas( 4 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_OutsideAir, 1, ObjectIsParent );
+				ZoneEvapUnit( UnitLoop ).OAInletNodeNum = GetOnlySingleNode( Alphas( 4 ), GetInputZoneEvaporativeCoolerUnitErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_OutsideAir, 1, ObjectIsParent );
 
-				ZoneEvapUnit( UnitLoop ).UnitOutletNodeNum = GetOnlySingleNode( Alphas( 5 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsParent );
+				ZoneEvapUnit( UnitLoop ).UnitOutletNodeNum = GetOnlySingleNode( Alphas( 5 ), GetInputZoneEvaporativeCoolerUnitErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsParent );
 
 				if ( ! lAlphaBlanks( 6 ) ) {
-					ZoneEvapUnit( UnitLoop ).UnitReliefNodeNum = GetOnlySingleNode( Alphas( 6 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsParent );
+					ZoneEvapUnit( UnitLoop ).UnitReliefNodeNum = GetOnlySingleNode( Alphas( 6 ), GetInputZoneEvaporativeCoolerUnitErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsParent );
 				}
 
 				ZoneEvapUnit( UnitLoop ).FanObjectClassName = Alphas( 7 );
@@ -3520,7 +3578,7 @@ namespace EvaporativeCoolers {
 				FanVolFlow = 0.0;
 				if ( errFlag ) {
 					ShowContinueError( "specified in " + CurrentModuleObject + " = " + ZoneEvapUnit( UnitLoop ).Name );
-					ErrorsFound = true;
+					GetInputZoneEvaporativeCoolerUnitErrorsFound = true;
 				} else {
 					GetFanIndex( ZoneEvapUnit( UnitLoop ).FanName, ZoneEvapUnit( UnitLoop ).FanIndex, errFlag, CurrentModuleObject );
 					ZoneEvapUnit( UnitLoop ).FanInletNodeNum = GetFanInletNode( ZoneEvapUnit( UnitLoop ).FanObjectClassName, ZoneEvapUnit( UnitLoop ).FanName, errFlag );
@@ -3531,7 +3589,7 @@ namespace EvaporativeCoolers {
 					ZoneEvapUnit( UnitLoop ).FanAvailSchedPtr = GetFanAvailSchPtr( ZoneEvapUnit( UnitLoop ).FanObjectClassName, ZoneEvapUnit( UnitLoop ).FanName, errFlag );
 					if ( errFlag ) {
 						ShowContinueError( "...specified in " + CurrentModuleObject + " = " + ZoneEvapUnit( UnitLoop ).Name );
-						ErrorsFound = true;
+						GetInputZoneEvaporativeCoolerUnitErrorsFound = true;
 					}
 				}
 
@@ -3545,7 +3603,7 @@ namespace EvaporativeCoolers {
 				} else {
 					ShowSevereError( CurrentModuleObject + "=\"" + ZoneEvapUnit( UnitLoop ).Name + "\" invalid data." );
 					ShowContinueError( "invalid choice found " + cAlphaFields( 9 ) + "=\"" + Alphas( 9 ) + "\"." );
-					ErrorsFound = true;
+					GetInputZoneEvaporativeCoolerUnitErrorsFound = true;
 				}}
 
 				// get the zone numer served by the zoneHVAC evaporative cooler
@@ -3569,7 +3627,7 @@ namespace EvaporativeCoolers {
 				} else {
 					ShowSevereError( CurrentModuleObject + "=\"" + ZoneEvapUnit( UnitLoop ).Name + "\" invalid data." );
 					ShowContinueError( "invalid choice found " + cAlphaFields( 10 ) + "=\"" + Alphas( 10 ) + "\"." );
-					ErrorsFound = true;
+					GetInputZoneEvaporativeCoolerUnitErrorsFound = true;
 				}}
 
 				ZoneEvapUnit( UnitLoop ).ThrottlingRange = Numbers( 2 );
@@ -3595,7 +3653,7 @@ namespace EvaporativeCoolers {
 				} else {
 					ShowSevereError( CurrentModuleObject + "=\"" + ZoneEvapUnit( UnitLoop ).Name + "\" invalid data." );
 					ShowContinueError( "invalid choice found " + cAlphaFields( 11 ) + "=\"" + Alphas( 11 ) + "\"." );
-					ErrorsFound = true;
+					GetInputZoneEvaporativeCoolerUnitErrorsFound = true;
 				}}
 
 				ZoneEvapUnit( UnitLoop ).EvapCooler_1_Name = Alphas( 12 );
@@ -3603,7 +3661,7 @@ namespace EvaporativeCoolers {
 				if ( ZoneEvapUnit( UnitLoop ).EvapCooler_1_Index == 0 ) {
 					ShowSevereError( CurrentModuleObject + "=\"" + ZoneEvapUnit( UnitLoop ).Name + "\" invalid data." );
 					ShowContinueError( "invalid, not found " + cAlphaFields( 12 ) + "=\"" + Alphas( 12 ) + "\"." );
-					ErrorsFound = true;
+					GetInputZoneEvaporativeCoolerUnitErrorsFound = true;
 				}
 
 				if ( ! lAlphaBlanks( 13 ) ) {
@@ -3627,7 +3685,7 @@ namespace EvaporativeCoolers {
 					} else {
 						ShowSevereError( CurrentModuleObject + "=\"" + ZoneEvapUnit( UnitLoop ).Name + "\" invalid data." );
 						ShowContinueError( "invalid choice found " + cAlphaFields( 13 ) + "=\"" + Alphas( 13 ) + "\"." );
-						ErrorsFound = true;
+						GetInputZoneEvaporativeCoolerUnitErrorsFound = true;
 					}}
 					if ( ! lAlphaBlanks( 14 ) ) {
 						ZoneEvapUnit( UnitLoop ).EvapCooler_2_Name = Alphas( 14 );
@@ -3635,12 +3693,12 @@ namespace EvaporativeCoolers {
 						if ( ZoneEvapUnit( UnitLoop ).EvapCooler_2_Index == 0 ) {
 							ShowSevereError( CurrentModuleObject + "=\"" + ZoneEvapUnit( UnitLoop ).Name + "\" invalid data." );
 							ShowContinueError( "invalid, not found " + cAlphaFields( 14 ) + "=\"" + Alphas( 14 ) + "\"." );
-							ErrorsFound = true;
+							GetInputZoneEvaporativeCoolerUnitErrorsFound = true;
 						}
 					} else {
 						ShowSevereError( CurrentModuleObject + "=\"" + ZoneEvapUnit( UnitLoop ).Name + "\" invalid data." );
 						ShowContinueError( "missing input for " + cAlphaFields( 14 ) );
-						ErrorsFound = true;
+						GetInputZoneEvaporativeCoolerUnitErrorsFound = true;
 					}
 				}
 
@@ -3650,7 +3708,7 @@ namespace EvaporativeCoolers {
 					if ( ZoneEvapUnit( UnitLoop ).HVACSizingIndex == 0 ) {
 						ShowSevereError( cAlphaFields( 15 ) + " = " + Alphas( 15 ) + " not found." );
 						ShowContinueError( "Occurs in " + CurrentModuleObject + " = " + ZoneEvapUnit( UnitLoop ).Name );
-						ErrorsFound = true;
+						GetInputZoneEvaporativeCoolerUnitErrorsFound = true;
 					}
 				}
 
@@ -3672,12 +3730,12 @@ namespace EvaporativeCoolers {
 						ShowSevereError( CurrentModuleObject + "=\"" + ZoneEvapUnit( UnitLoop ).Name + "\" invalid data." );
 						ShowContinueError( "Fan:ConstantVolume is not consistent with control method ZoneCoolingLoadVariableSpeedFan." );
 						ShowContinueError( "Change to a variable speed fan object type" );
-						ErrorsFound = true;
+						GetInputZoneEvaporativeCoolerUnitErrorsFound = true;
 					} else if ( ZoneEvapUnit( UnitLoop ).FanType_Num == FanType_SimpleOnOff ) {
 						ShowSevereError( CurrentModuleObject + "=\"" + ZoneEvapUnit( UnitLoop ).Name + "\" invalid data." );
 						ShowContinueError( "Fan:OnOff is not consistent with control method ZoneCoolingLoadVariableSpeedFan." );
 						ShowContinueError( "Change to a variable speed fan object type" );
-						ErrorsFound = true;
+						GetInputZoneEvaporativeCoolerUnitErrorsFound = true;
 					}
 
 				}
@@ -3695,7 +3753,7 @@ namespace EvaporativeCoolers {
 		lAlphaBlanks.deallocate();
 		lNumericBlanks.deallocate();
 
-		if ( ErrorsFound ) {
+		if ( GetInputZoneEvaporativeCoolerUnitErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in getting input." );
 			ShowContinueError( "... Preceding condition causes termination." );
 		}
@@ -3755,7 +3813,6 @@ namespace EvaporativeCoolers {
 		using Fans::GetFanVolFlow;
 
 		// Locals
-		static Array1D_bool MySizeFlag;
 
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
@@ -3769,21 +3826,16 @@ namespace EvaporativeCoolers {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true ); // one time flag
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool MyFanFlag;
-		static Array1D_bool MyZoneEqFlag; // used to set up zone equipment availability managers
 		int Loop;
-		static bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
 		Real64 TimeElapsed;
 
-		if ( MyOneTimeFlag ) {
-			MySizeFlag.dimension( NumZoneEvapUnits, true );
+		if ( InitZoneEvaporativeCoolerUnitMyOneTimeFlag ) {
+			InitZoneEvaporativeCoolerUnitMySizeFlag.dimension( NumZoneEvapUnits, true );
 			MyEnvrnFlag.dimension( NumZoneEvapUnits, true );
 			MyFanFlag.dimension( NumZoneEvapUnits, true );
 			MyZoneEqFlag.allocate ( NumZoneEvapUnits );
 			MyZoneEqFlag = true;
-			MyOneTimeFlag = false;
+			InitZoneEvaporativeCoolerUnitMyOneTimeFlag = false;
 		}
 
 		if ( allocated( ZoneComp ) ) {
@@ -3806,9 +3858,9 @@ namespace EvaporativeCoolers {
 			}
 		}
 
-		if ( ! SysSizingCalc && MySizeFlag( UnitNum ) ) {
+		if ( ! SysSizingCalc && InitZoneEvaporativeCoolerUnitMySizeFlag( UnitNum ) ) {
 			SizeZoneEvaporativeCoolerUnit( UnitNum );
-			MySizeFlag( UnitNum ) = false;
+			InitZoneEvaporativeCoolerUnitMySizeFlag( UnitNum ) = false;
 		}
 
 		if ( MyFanFlag( UnitNum ) ) {
@@ -4388,7 +4440,6 @@ namespace EvaporativeCoolers {
 		Real64 MinHumRat;
 		Array1D< Real64 > Par( 5 ); // Parameters passed to RegulaFalsi
 		Real64 FanSpeedRatio;
-		static Real64 ErrorToler( 0.001 ); // error tolerance
 		int SolFla; // Flag of RegulaFalsi solver
 		Real64 FullFlowSensibleOutputProvided;
 
@@ -4433,7 +4484,7 @@ namespace EvaporativeCoolers {
 			Par( 5 ) = ZoneCoolingLoad;
 			FanSpeedRatio = 1.0;
 
-			SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, FanSpeedRatio, VSEvapUnitLoadResidual, 0.0, 1.0, Par );
+			SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, FanSpeedRatio, VSEvapUnitLoadResidual, 0.0, 1.0, Par, "ControlVSEvapUnitToMeetLoad" );
 			if ( SolFla == -1 ) {
 				if ( ZoneEvapUnit( UnitNum ).UnitVSControlMaxIterErrorIndex == 0 ) {
 					ShowWarningError( "Iteration limit exceeded calculating variable speed evap unit fan speed ratio, for unit=" + ZoneEvapUnit( UnitNum ).Name );
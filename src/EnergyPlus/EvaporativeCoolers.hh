@@ -443,6 +443,11 @@ namespace EvaporativeCoolers {
 
 	// Functions
 
+	// Clears the global data in EvaporativeCoolers.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimEvapCooler(
 		std::string const & CompName,
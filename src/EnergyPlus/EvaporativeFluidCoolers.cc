@@ -201,8 +201,55 @@ namespace EvaporativeFluidCoolers {
 	// Beginning of EvaporativeFluidCoolers Module Driver Subroutines
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInput( true );
+		bool ErrorsFound( false ); // Logical flag set .TRUE. if errors found while getting input data
+		bool InitEvapFluidCoolerErrorsFound( false ); // Flag if input data errors are found
+		bool MyOneTimeFlag( true );
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool OneTimeFlagForEachEvapFluidCooler;
+		Real64 BlowDownVdot( 0.0 );
+		Real64 DriftVdot( 0.0 );
+		Real64 EvapVdot( 0.0 );
+	}
+
 	// Functions
 
+	// Clears the global data in EvaporativeFluidCoolers.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumSimpleEvapFluidCoolers = 0;
+		InletWaterTemp = 0.0;
+		OutletWaterTemp = 0.0;
+		WaterInletNode = 0;
+		WaterOutletNode = 0;
+		WaterMassFlowRate = 0.0;
+		Qactual = 0.0;
+		FanPower = 0.0;
+		AirFlowRateRatio = 0.0;
+		WaterUsage = 0.0;
+		CheckEquipName.deallocate();
+		SimpleEvapFluidCooler.deallocate();
+		SimpleEvapFluidCoolerInlet.deallocate();
+		SimpleEvapFluidCoolerReport.deallocate();
+		GetInput = true;
+		ErrorsFound = false;
+		InitEvapFluidCoolerErrorsFound = false;
+		MyOneTimeFlag = true;
+		MyEnvrnFlag.deallocate();
+		OneTimeFlagForEachEvapFluidCooler.deallocate();
+		BlowDownVdot = 0.0;
+		DriftVdot = 0.0;
+		EvapVdot = 0.0;
+	}
+
 	void
 	SimEvapFluidCoolers(
 		std::string const & EvapFluidCoolerType,
@@ -253,7 +300,6 @@ namespace EvaporativeFluidCoolers {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInput( true );
 		int EvapFluidCoolerNum; // Pointer to EvapFluidCooler
 
 		//GET INPUT
@@ -408,7 +454,6 @@ namespace EvaporativeFluidCoolers {
 		int IOStat; // IO Status when calling get input subroutine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
-		static bool ErrorsFound( false ); // Logical flag set .TRUE. if errors found while getting input data
 		Array1D< Real64 > NumArray( 25 ); // Numeric input data array
 		Array1D_string AlphArray( 13 ); // Character string input data array
 		std::string FluidName;
@@ -1095,10 +1140,6 @@ namespace EvaporativeFluidCoolers {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false ); // Flag if input data errors are found
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool OneTimeFlagForEachEvapFluidCooler;
 		int TypeOf_Num( 0 );
 		int LoopNum;
 		int LoopSideNum;
@@ -1128,11 +1169,11 @@ namespace EvaporativeFluidCoolers {
 			} else {
 				assert( false );
 			}
-			ErrorsFound = false;
+			InitEvapFluidCoolerErrorsFound = false;
 			// Locate the tower on the plant loops for later usage
-			ScanPlantLoopsForObject( SimpleEvapFluidCooler( EvapFluidCoolerNum ).Name, TypeOf_Num, SimpleEvapFluidCooler( EvapFluidCoolerNum ).LoopNum, SimpleEvapFluidCooler( EvapFluidCoolerNum ).LoopSideNum, SimpleEvapFluidCooler( EvapFluidCoolerNum ).BranchNum, SimpleEvapFluidCooler( EvapFluidCoolerNum ).CompNum, _, _, _, _, _, ErrorsFound );
+			ScanPlantLoopsForObject( SimpleEvapFluidCooler( EvapFluidCoolerNum ).Name, TypeOf_Num, SimpleEvapFluidCooler( EvapFluidCoolerNum ).LoopNum, SimpleEvapFluidCooler( EvapFluidCoolerNum ).LoopSideNum, SimpleEvapFluidCooler( EvapFluidCoolerNum ).BranchNum, SimpleEvapFluidCooler( EvapFluidCoolerNum ).CompNum, _, _, _, _, _, InitEvapFluidCoolerErrorsFound );
 
-			if ( ErrorsFound ) {
+			if ( InitEvapFluidCoolerErrorsFound ) {
 				ShowFatalError( "InitEvapFluidCooler: Program terminated due to previous condition(s)." );
 			}
 
@@ -1140,16 +1181,16 @@ namespace EvaporativeFluidCoolers {
 				if ( SimpleEvapFluidCooler( EvapFluidCoolerNum ).DesignWaterFlowRate > 0.0 ) {
 					if ( SimpleEvapFluidCooler( EvapFluidCoolerNum ).HighSpeedAirFlowRate <= SimpleEvapFluidCooler( EvapFluidCoolerNum ).LowSpeedAirFlowRate ) {
 						ShowSevereError( "EvaporativeFluidCooler:TwoSpeed \"" + SimpleEvapFluidCooler( EvapFluidCoolerNum ).Name + "\". Low speed air flow rate must be less than the high speed air flow rate." );
-						ErrorsFound = true;
+						InitEvapFluidCoolerErrorsFound = true;
 					}
 					if ( SimpleEvapFluidCooler( EvapFluidCoolerNum ).HighSpeedEvapFluidCoolerUA <= SimpleEvapFluidCooler( EvapFluidCoolerNum ).LowSpeedEvapFluidCoolerUA ) {
 						ShowSevereError( "EvaporativeFluidCooler:TwoSpeed \"" + SimpleEvapFluidCooler( EvapFluidCoolerNum ).Name + "\". Evaporative fluid cooler UA at low fan speed must be less than the evaporative fluid cooler UA at high fan speed." );
-						ErrorsFound = true;
+						InitEvapFluidCoolerErrorsFound = true;
 					}
 				}
 			}
 
-			if ( ErrorsFound ) {
+			if ( InitEvapFluidCoolerErrorsFound ) {
 				ShowFatalError( "InitEvapFluidCooler: Program terminated due to previous condition(s)." );
 			}
 
@@ -1467,7 +1508,7 @@ namespace EvaporativeFluidCoolers {
 					SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirWetBulb = 25.6;
 					SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirPress = StdBaroPress;
 					SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirHumRat = PsyWFnTdbTwbPb( SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirTemp, SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirWetBulb, SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirPress );
-					SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleEvapFluidCoolerUAResidual, UA0, UA1, Par );
+					SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleEvapFluidCoolerUAResidual, UA0, UA1, Par, "SizeEvapFluidCooler" );
 					if ( SolFla == -1 ) {
 						ShowWarningError( "Iteration limit exceeded in calculating evaporative fluid cooler UA." );
 						ShowContinueError( "Autosizing of fluid cooler UA failed for evaporative fluid cooler = " + SimpleEvapFluidCooler( EvapFluidCoolerNum ).Name );
@@ -1555,7 +1596,7 @@ namespace EvaporativeFluidCoolers {
 				SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirWetBulb = 25.6; // 78F design inlet air wet-bulb temp
 				SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirPress = StdBaroPress;
 				SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirHumRat = PsyWFnTdbTwbPb( SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirTemp, SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirWetBulb, SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirPress );
-				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleEvapFluidCoolerUAResidual, UA0, UA1, Par );
+				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleEvapFluidCoolerUAResidual, UA0, UA1, Par, "SizeEvapFluidCooler" );
 				if ( SolFla == -1 ) {
 					ShowWarningError( "Iteration limit exceeded in calculating evaporative fluid cooler UA." );
 					ShowContinueError( "Autosizing of fluid cooler UA failed for evaporative fluid cooler = " + SimpleEvapFluidCooler( EvapFluidCoolerNum ).Name );
@@ -1610,7 +1651,7 @@ namespace EvaporativeFluidCoolers {
 				SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirWetBulb = SimpleEvapFluidCooler( EvapFluidCoolerNum ).DesignEnteringAirWetBulbTemp;
 				SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirPress = StdBaroPress;
 				SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirHumRat = PsyWFnTdbTwbPb( SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirTemp, SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirWetBulb, SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirPress );
-				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleEvapFluidCoolerUAResidual, UA0, UA1, Par );
+				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleEvapFluidCoolerUAResidual, UA0, UA1, Par, "SizeEvapFluidCooler" );
 				if ( SolFla == -1 ) {
 					ShowWarningError( "Iteration limit exceeded in calculating evaporative fluid cooler UA." );
 					ShowContinueError( "Autosizing of fluid cooler UA failed for evaporative fluid cooler = " + SimpleEvapFluidCooler( EvapFluidCoolerNum ).Name );
@@ -1727,7 +1768,7 @@ namespace EvaporativeFluidCoolers {
 				SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirWetBulb = 25.6; // 78F design inlet air wet-bulb temp
 				SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirPress = StdBaroPress;
 				SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirHumRat = PsyWFnTdbTwbPb( SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirTemp, SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirWetBulb, SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirPress );
-				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleEvapFluidCoolerUAResidual, UA0, UA1, Par );
+				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleEvapFluidCoolerUAResidual, UA0, UA1, Par, "SizeEvapFluidCooler" );
 				if ( SolFla == -1 ) {
 					ShowWarningError( "Iteration limit exceeded in calculating evaporative fluid cooler UA." );
 					ShowContinueError( "Autosizing of fluid cooler UA failed for evaporative fluid cooler = " + SimpleEvapFluidCooler( EvapFluidCoolerNum ).Name );
@@ -1772,7 +1813,7 @@ namespace EvaporativeFluidCoolers {
 				SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirWetBulb = SimpleEvapFluidCooler( EvapFluidCoolerNum ).DesignEnteringAirWetBulbTemp;
 				SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirPress = StdBaroPress;
 				SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirHumRat = PsyWFnTdbTwbPb( SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirTemp, SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirWetBulb, SimpleEvapFluidCoolerInlet( EvapFluidCoolerNum ).AirPress );
-				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleEvapFluidCoolerUAResidual, UA0, UA1, Par );
+				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleEvapFluidCoolerUAResidual, UA0, UA1, Par, "SizeEvapFluidCooler" );
 				if ( SolFla == -1 ) {
 					ShowSevereError( "Iteration limit exceeded in calculating EvaporativeFluidCooler UA" );
 					ShowFatalError( "Autosizing of EvaporativeFluidCooler UA failed for EvaporativeFluidCooler " + SimpleEvapFluidCooler( EvapFluidCoolerNum ).Name );
@@ -2447,9 +2488,6 @@ namespace EvaporativeFluidCoolers {
 		Real64 AirDensity;
 		Real64 AirMassFlowRate;
 		Real64 AvailTankVdot;
-		static Real64 BlowDownVdot( 0.0 );
-		static Real64 DriftVdot( 0.0 );
-		static Real64 EvapVdot( 0.0 );
 		Real64 InletAirEnthalpy;
 		Real64 InSpecificHumRat;
 		Real64 OutSpecificHumRat;
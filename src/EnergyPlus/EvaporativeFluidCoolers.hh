@@ -372,6 +372,11 @@ namespace EvaporativeFluidCoolers {
 
 	// Functions
 
+	// Clears the global data in EvaporativeFluidCoolers.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimEvapFluidCoolers(
 		std::string const & EvapFluidCoolerType,
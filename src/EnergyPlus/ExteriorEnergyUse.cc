@@ -138,6 +138,17 @@ namespace ExteriorEnergyUse {
 	Array1D< ExteriorLightUsage > ExteriorLights; // Structure for Exterior Light reporting
 	Array1D< ExteriorEquipmentUsage > ExteriorEquipment; // Structure for Exterior Equipment Reporting
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // First time, input is "gotten"
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		Real64 sumDesignLevel( 0.0 ); // for predefined report of design level total
+	}
+
 	// Functions
 
 	// Clears the global data in ExteriorEnergyUse.
@@ -149,6 +160,9 @@ namespace ExteriorEnergyUse {
 		NumExteriorEqs = 0;
 		ExteriorLights.deallocate();
 		ExteriorEquipment.deallocate();
+		GetInputFlag = true;
+		ErrorsFound = false;
+		sumDesignLevel = 0.0;
 	}
 
 	void
@@ -187,7 +201,6 @@ namespace ExteriorEnergyUse {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInputFlag( true ); // First time, input is "gotten"
 
 		if ( GetInputFlag ) {
 			GetExteriorEnergyUseInput();
@@ -249,7 +262,6 @@ namespace ExteriorEnergyUse {
 		int NumAlphas; // Number of Alphas for each GetObjectItem call
 		int NumNumbers; // Number of Numbers for each GetObjectItem call
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		int NumFuelEq; // Temporary -- number of ExteriorFuelEquipment statements
 		int NumWtrEq; // Temporary -- number of ExteriorWaterEquipment statements
 		std::string TypeString; // Fuel Type string (returned from Validation)
@@ -259,7 +271,6 @@ namespace ExteriorEnergyUse {
 		bool IsBlank;
 		Real64 SchMax; // Max value of schedule for item
 		Real64 SchMin; // Min value of schedule for item
-		static Real64 sumDesignLevel( 0.0 ); // for predefined report of design level total
 
 		NumExteriorLights = GetNumObjectsFound( "Exterior:Lights" );
 		ExteriorLights.allocate( NumExteriorLights );
@@ -172,8 +172,79 @@ namespace ExternalInterface {
 	Array1D< FMUType > FMUTemp; // Variable Types structure
 	Array1D< checkFMUInstanceNameType > checkInstanceName; // Variable Types structure for checking instance names
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // First time, input is "gotten"
+		bool firstCall( true ); // First time, input has been read
+		int nOutVal; // Number of output values (E+ -> ExternalInterface)
+		int nInpVar; // Number of input values (ExternalInterface -> E+)
+		bool FirstCallGetSetDoStep( true ); // Flag to check when External Interface is called first time
+		bool FirstCallIni( true ); // First time, input has been read
+		bool FirstCallDesignDays( true ); // Flag fo first call during warmup
+		bool FirstCallWUp( true ); // Flag fo first call during warmup
+		bool FirstCallTStep( true ); // Flag for first call during time stepping
+		int CalcExternalInterfaceFMUImport_fmiEndSimulation(0); // Flag to indicate end of simulation
+		bool CalcExternalInterface_firstCall( true );
+		bool showContinuationWithoutUpdate( true );
+	}
+
 	// Functions
 
+	// Clears the global data in ExternalInterface.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		tComm = 0.0;
+		tStop = 3600.0;
+		tStart = 0.0;
+		hStep = 15.0;
+		FlagReIni = false;
+		FMURootWorkingFolder.clear();
+		nInKeys = 3;
+		NumExternalInterfaces = 0;
+		NumExternalInterfacesBCVTB = 0;
+		NumExternalInterfacesFMUImport = 0;
+		NumExternalInterfacesFMUExport = 0;
+		NumFMUObjects = 0;
+		FMUExportActivate = 0;
+		haveExternalInterfaceBCVTB = false;
+		haveExternalInterfaceFMUImport = false;
+		haveExternalInterfaceFMUExport = false;
+		simulationStatus = 1;
+		keyVarIndexes.deallocate();
+		varTypes.deallocate();
+		varInd.deallocate();
+		socketFD = -1;
+		ErrorsFound = false;
+		noMoreValues = false;
+		varKeys.deallocate();
+		varNames.deallocate();
+		inpVarTypes.deallocate();
+		inpVarNames.deallocate();
+		configuredControlPoints = false;
+		useEMS = false;
+		FMU.deallocate();
+		FMUTemp.deallocate();
+		checkInstanceName.deallocate();
+		GetInputFlag = true;
+		firstCall = true;
+		nOutVal = 0;
+		nInpVar = 0;
+		FirstCallGetSetDoStep = true;
+		FirstCallIni = true;
+		FirstCallDesignDays = true;
+		FirstCallWUp = true;
+		FirstCallTStep = true;
+		CalcExternalInterfaceFMUImport_fmiEndSimulation = 0;
+		CalcExternalInterface_firstCall = true;
+		showContinuationWithoutUpdate = true;
+	}
+
 	void
 	ExternalInterfaceExchangeVariables()
 	{
@@ -193,7 +264,6 @@ namespace ExternalInterface {
 		using DataGlobals::ksRunPeriodWeather;
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInputFlag( true ); // First time, input is "gotten"
 		std::string errorMessage; // Error message
 		int retValErrMsg;
 
@@ -498,7 +568,6 @@ namespace ExternalInterface {
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
 
-		static bool firstCall( true ); // First time, input has been read
 		std::string const simCfgFilNam("variables.cfg"); // Configuration file
 		std::string const xmlStrInKey("schedule,variable,actuator\0"); // xml values in string, separated by ','
 
@@ -507,8 +576,6 @@ namespace ExternalInterface {
 		std::string xmlStrOut; // xml values in string, separated by ';'
 		std::string xmlStrOutTyp; // xml values in string, separated by ';'
 		std::string xmlStrIn; // xml values in string, separated by ';'
-		static int nOutVal; // Number of output values (E+ -> ExternalInterface)
-		static int nInpVar; // Number of input values (ExternalInterface -> E+)
 		int retVal; // Return value of function call, used for error handling
 		int mainVersion; // The version number
 		bool socFileExist; // Set to true if socket configuration
@@ -708,7 +775,6 @@ namespace ExternalInterface {
 		using General::TrimSigDigits;
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		static bool FirstCallGetSetDoStep( true ); // Flag to check when External Interface is called first time
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int i, j, k; // Loop counters
@@ -1062,7 +1128,6 @@ namespace ExternalInterface {
 		Array1D_string NameListInstances( 5 );
 		bool IsNotOK;
 		bool IsBlank;
-		static bool FirstCallIni( true ); // First time, input has been read
 		bool fileExist;
 		std::string tempFullFileName;
 		Array1D_string strippedFileName; // remove path from entered file name
@@ -1748,10 +1813,6 @@ namespace ExternalInterface {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int i, j, k; // Loop counter
 
-		static bool FirstCallDesignDays( true ); // Flag fo first call during warmup
-		static bool FirstCallWUp( true ); // Flag fo first call during warmup
-		static bool FirstCallTStep( true ); // Flag for first call during time stepping
-		static int fmiEndSimulation(0); // Flag to indicate end of simulation
 
 		Array1D_string Alphas( 5 );
 		Array1D_int keyIndexes( 1 ); // Array index for
@@ -1834,7 +1895,7 @@ namespace ExternalInterface {
 					StopExternalInterfaceIfError();
 
 					// Terminate all FMUs
-					TerminateResetFreeFMUImport(fmiEndSimulation);
+					TerminateResetFreeFMUImport(CalcExternalInterfaceFMUImport_fmiEndSimulation);
 
 					// Reset the communication time step
 					tComm = tStart;
@@ -1888,7 +1949,7 @@ namespace ExternalInterface {
 				tComm = tStart;
 
 				// Terminate all FMUs
-				TerminateResetFreeFMUImport(fmiEndSimulation);
+				TerminateResetFreeFMUImport(CalcExternalInterfaceFMUImport_fmiEndSimulation);
 
 				// Reinstantiate and reinitialize the FMUs
 				InstantiateInitializeFMUImport();
@@ -1933,8 +1994,8 @@ namespace ExternalInterface {
 					tComm += hStep;
 				} else {
 					// Terminate reset and free Slaves
-					fmiEndSimulation = 1;
-					TerminateResetFreeFMUImport(fmiEndSimulation);
+					CalcExternalInterfaceFMUImport_fmiEndSimulation = 1;
+					TerminateResetFreeFMUImport(CalcExternalInterfaceFMUImport_fmiEndSimulation);
 					for ( i = 1; i <= NumFMUObjects; ++i ) {
 						for ( j = 1; j <= FMU( i ).NumInstances; ++j ) {
 							// Deallocate used objects
@@ -2055,13 +2116,11 @@ namespace ExternalInterface {
 		Array1D< Real64 > dblValRea( nDblMax );
 		std::string retValCha;
 		bool continueSimulation; // Flag, true if simulation should continue
-		static bool firstCall( true );
-		static bool showContinuationWithoutUpdate( true );
 
 		// Formats
 		static gio::Fmt Format_1000( "(I2)" );
 
-		if ( firstCall ) {
+		if ( CalcExternalInterface_firstCall ) {
 			DisplayString( "ExternalInterface starts first data exchange." );
 			simulationStatus = 2;
 			preSimTim = 0; // In the first call, E+ did not reset SimTimeSteps to zero
@@ -2085,7 +2144,7 @@ namespace ExternalInterface {
 			flaWri = 0;
 
 			// Get EnergyPlus variables
-			if ( firstCall ) { // bug fix causing external interface to send zero at the beginning of sim, Thierry Nouidui
+			if ( CalcExternalInterface_firstCall ) { // bug fix causing external interface to send zero at the beginning of sim, Thierry Nouidui
 				for ( i = 1; i <= nDblWri; ++i ) {
 					dblValWri( i ) = GetInternalVariableValue( varTypes( i ), keyVarIndexes( i ) );
 				}
@@ -2159,7 +2218,7 @@ namespace ExternalInterface {
 			ManageEMS( emsCallFromExternalInterface, anyRan );
 		}
 
-		firstCall = false; // bug fix causing external interface to send zero at the beginning of sim, Thierry Nouidui
+		CalcExternalInterface_firstCall = false; // bug fix causing external interface to send zero at the beginning of sim, Thierry Nouidui
 
 	}
 
@@ -377,6 +377,11 @@ namespace ExternalInterface {
 
 	// Functions
 
+	// Clears the global data in ExternalInterface.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	ExternalInterfaceExchangeVariables();
 
@@ -193,6 +193,23 @@ namespace FanCoilUnits {
 	namespace {
 		bool InitFanCoilUnitsOneTimeFlag( true );
 		bool InitFanCoilUnitsCheckInZoneEquipmentListFlag( false ); // True after the Zone Equipment List has been checked for items
+		bool GetFanCoilUnitsErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool errFlag( false ); // Local error flag for GetOAMixerNodeNums
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		bool ZoneExNodeNotFound( false ); // used in error checking
+		bool ZoneInNodeNotFound( false ); // used in error checking
+		int ATMixerNum( 0 ); // index of air terminal mixer in the air terminal mixer data array
+		int ATMixerType( 0 ); // type of air terminal mixer (1=inlet side; 2=supply side)
+		int ATMixerPriNode( 0 ); // node number of the air terminal mixer primary air inlet
+		int ATMixerSecNode( 0 ); // node number of the air terminal mixer secondary air inlet
+		int ATMixerOutNode( 0 ); // node number of the air terminal mixer secondary air inlet
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool MyPlantScanFlag;
+		Array1D_bool MyZoneEqFlag; // used to set up zone equipment availability managers
+		int CoilWaterInletNode( 0 );
+		int CoilWaterOutletNode( 0 );
+		int ATMixOutNode( 0 ); // outlet node of ATM Mixer
+		int ZoneNode( 0 ); // zone node
 	}
 
 	int NumFanCoils( 0 );
@@ -230,6 +247,23 @@ namespace FanCoilUnits {
 		FanCoilNumericFields.deallocate();
 		InitFanCoilUnitsOneTimeFlag = true;
 		InitFanCoilUnitsCheckInZoneEquipmentListFlag = false;
+		GetFanCoilUnitsErrorsFound = false;
+		errFlag = false;
+		TotalArgs = 0;
+		ZoneExNodeNotFound = false;
+		ZoneInNodeNotFound = false;
+		ATMixerNum = 0;
+		ATMixerType = 0;
+		ATMixerPriNode = 0;
+		ATMixerSecNode = 0;
+		ATMixerOutNode = 0;
+		MyEnvrnFlag.deallocate();
+		MyPlantScanFlag.deallocate();
+		MyZoneEqFlag.deallocate();
+		CoilWaterInletNode = 0;
+		CoilWaterOutletNode = 0;
+		ATMixOutNode = 0;
+		ZoneNode = 0;
 	}
 
 	void
@@ -401,8 +435,6 @@ namespace FanCoilUnits {
 		int NumNumbers; // Number of Numbers for each GetObjectItem call
 		Array1D_int OANodeNums( 4 ); // Node numbers of Outdoor air mixer (OA, EA, RA, MA)
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
-		static bool errFlag( false ); // Local error flag for GetOAMixerNodeNums
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		std::string CurrentModuleObject; // Object type for getting and error messages
@@ -412,16 +444,8 @@ namespace FanCoilUnits {
 		Array1D< Real64 > Numbers; // Numeric input items for object
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 		int CtrlZone; // index to loop counter
 		int NodeNum; // index to loop counter
-		static bool ZoneExNodeNotFound( false ); // used in error checking
-		static bool ZoneInNodeNotFound( false ); // used in error checking
-		static int ATMixerNum( 0 ); // index of air terminal mixer in the air terminal mixer data array
-		static int ATMixerType( 0 ); // type of air terminal mixer (1=inlet side; 2=supply side)
-		static int ATMixerPriNode( 0 ); // node number of the air terminal mixer primary air inlet
-		static int ATMixerSecNode( 0 ); // node number of the air terminal mixer secondary air inlet
-		static int ATMixerOutNode( 0 ); // node number of the air terminal mixer secondary air inlet
 		std::string ATMixerName;
 
 		// FLOW
@@ -459,7 +483,7 @@ namespace FanCoilUnits {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), FanCoil, FanCoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetFanCoilUnitsErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			FanCoil( FanCoilNum ).Name = Alphas( 1 );
@@ -473,7 +497,7 @@ namespace FanCoilUnits {
 				if ( FanCoil( FanCoilNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", invalid" );
 					ShowContinueError( "invalid-not found: " + cAlphaFields( 2 ) + "=\"" + Alphas( 2 ) + "\"." );
-					ErrorsFound = true;
+					GetFanCoilUnitsErrorsFound = true;
 				}
 			}
 
@@ -492,7 +516,7 @@ namespace FanCoilUnits {
 			} else {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + FanCoil( FanCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "illegal value: " + cAlphaFields( 3 ) + "=\"" + Alphas( 3 ) + "\"." );
-				ErrorsFound = true;
+				GetFanCoilUnitsErrorsFound = true;
 			}
 
 			FanCoil( FanCoilNum ).SchedOutAir = Alphas( 4 );
@@ -500,7 +524,7 @@ namespace FanCoilUnits {
 			if ( FanCoil( FanCoilNum ).SchedOutAirPtr == 0 && ( ! lAlphaBlanks( 4 ) ) ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + FanCoil( FanCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "illegal value: " + cAlphaFields( 4 ) + "=\"" + Alphas( 4 ) + "\"." );
-				ErrorsFound = true;
+				GetFanCoilUnitsErrorsFound = true;
 			}
 			FanCoil( FanCoilNum ).MaxAirVolFlow = Numbers( 1 );
 			FanCoil( FanCoilNum ).LowSpeedRatio = Numbers( 2 );
@@ -518,9 +542,9 @@ namespace FanCoilUnits {
 
 			FanCoil( FanCoilNum ).OutAirVolFlow = Numbers( 4 );
 
-			FanCoil( FanCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 5 ), ErrorsFound, FanCoil( FanCoilNum ).UnitType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsParent ); // air input node
+			FanCoil( FanCoilNum ).AirInNode = GetOnlySingleNode( Alphas( 5 ), GetFanCoilUnitsErrorsFound, FanCoil( FanCoilNum ).UnitType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsParent ); // air input node
 
-			FanCoil( FanCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 6 ), ErrorsFound, FanCoil( FanCoilNum ).UnitType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsParent ); // air outlet node
+			FanCoil( FanCoilNum ).AirOutNode = GetOnlySingleNode( Alphas( 6 ), GetFanCoilUnitsErrorsFound, FanCoil( FanCoilNum ).UnitType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsParent ); // air outlet node
 
 			FanCoil( FanCoilNum ).OAMixType = Alphas( 7 );
 			FanCoil( FanCoilNum ).OAMixName = Alphas( 8 );
@@ -530,14 +554,14 @@ namespace FanCoilUnits {
 				ValidateComponent( FanCoil( FanCoilNum ).OAMixType, FanCoil( FanCoilNum ).OAMixName, errFlag, CurrentModuleObject );
 				if ( errFlag ) {
 					ShowContinueError( "specified in " + CurrentModuleObject + " = \"" + FanCoil( FanCoilNum ).Name + "\"." );
-					ErrorsFound = true;
+					GetFanCoilUnitsErrorsFound = true;
 				} else {
 					// Get outdoor air mixer node numbers
 					OANodeNums = GetOAMixerNodeNumbers( FanCoil( FanCoilNum ).OAMixName, errFlag );
 					if ( errFlag ) {
 						ShowContinueError( "that was specified in " + CurrentModuleObject + " = " + FanCoil( FanCoilNum ).Name );
 						ShowContinueError( "..OutdoorAir:Mixer is required. Enter an OutdoorAir:Mixer object with this name." );
-						ErrorsFound = true;
+						GetFanCoilUnitsErrorsFound = true;
 					} else {
 						FanCoil( FanCoilNum ).OutsideAirNode = OANodeNums( 1 );
 						FanCoil( FanCoilNum ).AirReliefNode = OANodeNums( 2 );
@@ -570,7 +594,7 @@ namespace FanCoilUnits {
 				}
 				if ( SameString( Alphas( 11 ), "CoilSystem:Cooling:Water:HeatExchangerAssisted" ) ) {
 					FanCoil( FanCoilNum ).CCoilType_Num = CCoil_HXAssist;
-					GetHXCoilTypeAndName( FanCoil( FanCoilNum ).CCoilType, FanCoil( FanCoilNum ).CCoilName, ErrorsFound, FanCoil( FanCoilNum ).CCoilPlantType, FanCoil( FanCoilNum ).CCoilPlantName );
+					GetHXCoilTypeAndName( FanCoil( FanCoilNum ).CCoilType, FanCoil( FanCoilNum ).CCoilName, GetFanCoilUnitsErrorsFound, FanCoil( FanCoilNum ).CCoilPlantType, FanCoil( FanCoilNum ).CCoilPlantName );
 					if ( SameString( FanCoil( FanCoilNum ).CCoilPlantType, "Coil:Cooling:Water" ) ) {
 						FanCoil( FanCoilNum ).CCoilPlantTypeOfNum = TypeOf_CoilWaterCooling;
 					} else if ( SameString( FanCoil( FanCoilNum ).CCoilPlantType, "Coil:Cooling:Water:DetailedGeometry" ) ) {
@@ -580,14 +604,14 @@ namespace FanCoilUnits {
 						ShowContinueError( "For: " + cAlphaFields( 11 ) + "=\"" + Alphas( 11 ) + "\"." );
 						ShowContinueError( "Invalid Coil Type=" + FanCoil( FanCoilNum ).CCoilPlantType + ", Name=" + FanCoil( FanCoilNum ).CCoilPlantName );
 						ShowContinueError( "must be \"Coil:Cooling:Water\" or \"Coil:Cooling:Water:DetailedGeometry\"" );
-						ErrorsFound = true;
+						GetFanCoilUnitsErrorsFound = true;
 					}
 				}
 				IsNotOK = false;
 				ValidateComponent( FanCoil( FanCoilNum ).CCoilType, FanCoil( FanCoilNum ).CCoilName, IsNotOK, FanCoil( FanCoilNum ).UnitType );
 				if ( IsNotOK ) {
 					ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + FanCoil( FanCoilNum ).Name + "\"." );
-					ErrorsFound = true;
+					GetFanCoilUnitsErrorsFound = true;
 				} else {
 					if ( FanCoil( FanCoilNum ).CCoilType_Num != CCoil_HXAssist ) {
 						// mine the cold water node from the coil object
@@ -598,13 +622,13 @@ namespace FanCoilUnits {
 					// Other error checks should trap before it gets to this point in the code, but including just in case.
 					if ( IsNotOK ) {
 						ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + FanCoil( FanCoilNum ).Name + "\"." );
-						ErrorsFound = true;
+						GetFanCoilUnitsErrorsFound = true;
 					}
 				}
 			} else {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + FanCoil( FanCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "illegal value: " + cAlphaFields( 11 ) + "=\"" + Alphas( 11 ) + "\"." );
-				ErrorsFound = true;
+				GetFanCoilUnitsErrorsFound = true;
 			}
 
 			if ( SameString( Alphas( 13 ), "Coil:Heating:Water" ) ) {
@@ -614,13 +638,13 @@ namespace FanCoilUnits {
 				ValidateComponent( FanCoil( FanCoilNum ).HCoilType, FanCoil( FanCoilNum ).HCoilName, IsNotOK, CurrentModuleObject );
 				if ( IsNotOK ) {
 					ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + FanCoil( FanCoilNum ).Name + "\"." );
-					ErrorsFound = true;
+					GetFanCoilUnitsErrorsFound = true;
 				} else {
 					// mine the hot water node from the coil object
 					FanCoil( FanCoilNum ).HotControlNode = GetCoilWaterInletNode( FanCoil( FanCoilNum ).HCoilType, FanCoil( FanCoilNum ).HCoilName, IsNotOK );
 					if ( IsNotOK ) {
 						ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + FanCoil( FanCoilNum ).Name + "\"." );
-						ErrorsFound = true;
+						GetFanCoilUnitsErrorsFound = true;
 					}
 				}
 			} else if ( SameString( Alphas( 13 ), "Coil:Heating:Electric" ) ) {
@@ -629,18 +653,18 @@ namespace FanCoilUnits {
 				ValidateComponent( FanCoil( FanCoilNum ).HCoilType, FanCoil( FanCoilNum ).HCoilName, IsNotOK, CurrentModuleObject );
 				if ( IsNotOK ) {
 					ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + FanCoil( FanCoilNum ).Name + "\"." );
-					ErrorsFound = true;
+					GetFanCoilUnitsErrorsFound = true;
 				} else {
 					FanCoil( FanCoilNum ).DesignHeatingCapacity = GetHeatingCoilCapacity( FanCoil( FanCoilNum ).HCoilType, FanCoil( FanCoilNum ).HCoilName, errFlag );
 					if ( errFlag ) {
 						ShowContinueError( "Occurs in " + CurrentModuleObject + " = " + FanCoil( FanCoilNum ).Name );
-						ErrorsFound = true;
+						GetFanCoilUnitsErrorsFound = true;
 					}
 				}
 			} else {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + FanCoil( FanCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "illegal value: " + cAlphaFields( 13 ) + "=\"" + Alphas( 13 ) + "\"." );
-				ErrorsFound = true;
+				GetFanCoilUnitsErrorsFound = true;
 			}
 
 			FanCoil( FanCoilNum ).FanType = Alphas( 9 );
@@ -656,7 +680,7 @@ namespace FanCoilUnits {
 				if ( FanCoil( FanCoilNum ).HVACSizingIndex == 0 ) {
 					ShowSevereError( cAlphaFields( 16 ) + " = " + Alphas( 16 ) + " not found." );
 					ShowContinueError( "Occurs in " + cMO_FanCoil + " = " + FanCoil( FanCoilNum ).Name );
-					ErrorsFound = true;
+					GetFanCoilUnitsErrorsFound = true;
 				}
 			}
 
@@ -664,7 +688,7 @@ namespace FanCoilUnits {
 			ValidateComponent( FanCoil( FanCoilNum ).FanType, FanCoil( FanCoilNum ).FanName, errFlag, CurrentModuleObject );
 			if ( errFlag ) {
 				ShowContinueError( "specified in " + CurrentModuleObject + " = \"" + FanCoil( FanCoilNum ).Name + "\"." );
-				ErrorsFound = true;
+				GetFanCoilUnitsErrorsFound = true;
 			} else {
 				GetFanType( FanCoil( FanCoilNum ).FanName, FanCoil( FanCoilNum ).FanType_Num, errFlag, CurrentModuleObject, FanCoil( FanCoilNum ).Name );
 				{ auto const SELECT_CASE_var( FanCoil( FanCoilNum ).FanType_Num );
@@ -690,13 +714,13 @@ namespace FanCoilUnits {
 						ShowContinueError( "...for CyclingFan a Fan:OnOff is valid." );
 						ShowContinueError( "...for VariableFanVariableFlow or VariableFanConstantFlow a Fan:VariableVolume is valid." );
 						ShowContinueError( "...for ASHRAE90.1 a Fan:OnOff or Fan:VariableVolume is valid." );
-						ErrorsFound = true;
+						GetFanCoilUnitsErrorsFound = true;
 					}
 
 				} else {
 					ShowSevereError( CurrentModuleObject + " = \"" + Alphas( 1 ) + "\"" );
 					ShowContinueError( "Fan Type must be Fan:OnOff, Fan:ConstantVolume or Fan:VariableVolume." );
-					ErrorsFound = true;
+					GetFanCoilUnitsErrorsFound = true;
 				}}
 			}
 
@@ -743,7 +767,7 @@ namespace FanCoilUnits {
 					ShowSevereError( CurrentModuleObject + " = \"" + FanCoil( FanCoilNum ).Name + "\". Fan coil unit air inlet node name must be the same as an air terminal mixer outlet node name." );
 					ShowContinueError( "..Air terminal mixer outlet node name is specified in AirTerminal:SingleDuct:InletSideMixer object." );
 					ShowContinueError( "..Fan coil unit air inlet node name = " + NodeID( FanCoil( FanCoilNum ).AirInNode ) );
-					ErrorsFound = true;
+					GetFanCoilUnitsErrorsFound = true;
 				}
 				// check for supply side air terminal mixer
 			} else if ( ATMixerType == ATMixer_SupplySide ) {
@@ -764,7 +788,7 @@ namespace FanCoilUnits {
 					ShowSevereError( CurrentModuleObject + " = \"" + FanCoil( FanCoilNum ).Name + "\". Fan coil unit air outlet node name must be the same as the air terminal mixer secondary air inlet node name." );
 					ShowContinueError( "..Air terminal mixer secondary inlet node name is specified in AirTerminal:SingleDuct:SupplySideMixer object." );
 					ShowContinueError( "..Fan coil unit air outlet node name = " + NodeID( FanCoil( FanCoilNum ).AirOutNode ) );
-					ErrorsFound = true;
+					GetFanCoilUnitsErrorsFound = true;
 				}
 				// no air terminal mixer; do the normal connectivity checks
 			} else {
@@ -782,7 +806,7 @@ namespace FanCoilUnits {
 					ShowSevereError( CurrentModuleObject + " = \"" + FanCoil( FanCoilNum ).Name + "\". Fan coil unit air inlet node name must be the same as a zone exhaust node name." );
 					ShowContinueError( "..Zone exhaust node name is specified in ZoneHVAC:EquipmentConnections object." );
 					ShowContinueError( "..Fan coil unit air inlet node name = " + NodeID( FanCoil( FanCoilNum ).AirInNode ) );
-					ErrorsFound = true;
+					GetFanCoilUnitsErrorsFound = true;
 				}
 				// check that the fan coil outlet node is the same as one of the zone inlet nodes
 				ZoneInNodeNotFound = true;
@@ -800,7 +824,7 @@ namespace FanCoilUnits {
 					ShowContinueError( "..Zone inlet node name is specified in ZoneHVAC:EquipmentConnections object." );
 					ShowContinueError( "..Fan coil unit air outlet node name = " + NodeID( FanCoil( FanCoilNum ).AirOutNode ) );
 
-					ErrorsFound = true;
+					GetFanCoilUnitsErrorsFound = true;
 				}
 			}
 			if ( FanCoil( FanCoilNum ).CapCtrlMeth == "MULTISPEEDFAN" ) {
@@ -811,12 +835,12 @@ namespace FanCoilUnits {
 						ShowContinueError( "For " + cAlphaFields( 17 ) + " = " + Alphas( 17 ) );
 						ShowContinueError( "Illegal " + cAlphaFields( 9 ) + " = " + Alphas( 9 ) );
 						ShowContinueError( "...fan operating schedule is allowed for on off fan type only )" );
-						ErrorsFound = true;
+						GetFanCoilUnitsErrorsFound = true;
 					} else {
 						if ( FanCoil( FanCoilNum ).FanOpModeSchedPtr == 0 ) {
 							ShowSevereError( CurrentModuleObject + " = " + FanCoil( FanCoilNum ).Name );
 							ShowContinueError( "Illegal " + cAlphaFields( 17 ) + " = " + Alphas( 17 ) );
-							ErrorsFound = true;
+							GetFanCoilUnitsErrorsFound = true;
 						}
 					}
 				} else {
@@ -831,7 +855,7 @@ namespace FanCoilUnits {
 			} else if ( ! lNumericBlanks( 12 ) ) {
 				ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + FanCoil( FanCoilNum ).Name + "\"," );
 				ShowContinueError( "... " + cNumericFields( 11 ) + " and " + cNumericFields( 12 ) + " must be used in unison." );
-				ErrorsFound = true;
+				GetFanCoilUnitsErrorsFound = true;
 			}
 
 			if ( ! lNumericBlanks( 12 ) ) {
@@ -842,13 +866,13 @@ namespace FanCoilUnits {
 						ShowContinueError( "... " + cNumericFields( 11 ) + " is greater than " + cNumericFields( 12 ) + "." );
 						ShowContinueError( "... " + cNumericFields( 11 ) + " = " + TrimSigDigits( FanCoil( FanCoilNum ).MinSATempCooling, 2 ) + " [C]." );
 						ShowContinueError( "... " + cNumericFields( 12 ) + " = " + TrimSigDigits( FanCoil( FanCoilNum ).MaxSATempHeating, 2 ) + " [C]." );
-						ErrorsFound = true;
+						GetFanCoilUnitsErrorsFound = true;
 					}
 				}
 			} else if( ! lNumericBlanks( 11 ) ) {
 				ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + FanCoil( FanCoilNum ).Name + "\"," );
 				ShowContinueError( "... " + cNumericFields( 11 ) + " and " + cNumericFields( 12 ) + " must be used in unison." );
-				ErrorsFound = true;
+				GetFanCoilUnitsErrorsFound = true;
 			}
 
 			if ( FanCoil( FanCoilNum ).MinSATempCooling > 0.0 && FanCoil( FanCoilNum ).MaxSATempHeating > 0.0 ) {
@@ -882,7 +906,7 @@ namespace FanCoilUnits {
 		lAlphaBlanks.deallocate();
 		lNumericBlanks.deallocate();
 
-		if ( ErrorsFound ) {
+		if ( GetFanCoilUnitsErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in input. Preceding condition(s) cause termination." );
 		}
 
@@ -958,9 +982,6 @@ namespace FanCoilUnits {
 		int AirRelNode; // relief air node number in fan coil loop
 		Real64 RhoAir; // air density at InNode
 		int Loop;
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool MyPlantScanFlag;
-		static Array1D_bool MyZoneEqFlag; // used to set up zone equipment availability managers
 		Real64 rho;
 		bool errFlag;
 
@@ -1188,8 +1209,6 @@ namespace FanCoilUnits {
 		int PltSizCoolNum; // index of plant sizing object for 1st cooling loop
 		bool ErrorsFound; // TRUE if errors foind during sizing
 		Real64 DesCoilLoad; // coil load used for sizing [W]
-		static int CoilWaterInletNode( 0 );
-		static int CoilWaterOutletNode( 0 );
 		std::string CoolingCoilName;
 		std::string CoolingCoilType;
 		Real64 rho;
@@ -1979,13 +1998,13 @@ namespace FanCoilUnits {
 					if ( FirstHVACIteration ) Par( 2 ) = 1.0;
 					Par( 3 ) = ControlledZoneNum;
 					Par( 4 ) = QZnReq;
-					SolveRegulaFalsi( 0.001, MaxIterCycl, SolFlag, CWFlow, CalcFanCoilCWLoadResidual, 0.0, MaxWaterFlow, Par );
+					SolveRegulaFalsi( 0.001, MaxIterCycl, SolFlag, CWFlow, CalcFanCoilCWLoadResidual, 0.0, MaxWaterFlow, Par, "Sim4PipeFanCoil" );
 					if ( SolFlag == -1 ) {
 						// tighten limits on water flow rate to see if this allows convergence
 						CoolingLoad = true;
 						HeatingLoad = false;
 						TightenWaterFlowLimits( FanCoilNum, CoolingLoad, HeatingLoad, FanCoil( FanCoilNum ).ColdControlNode, ControlledZoneNum, FirstHVACIteration, QZnReq, MinWaterFlow, MaxWaterFlow );
-						SolveRegulaFalsi( 0.001, MaxIterCycl, SolFlag, CWFlow, CalcFanCoilCWLoadResidual, MinWaterFlow, MaxWaterFlow, Par );
+						SolveRegulaFalsi( 0.001, MaxIterCycl, SolFlag, CWFlow, CalcFanCoilCWLoadResidual, MinWaterFlow, MaxWaterFlow, Par, "Sim4PipeFanCoil" );
 						if ( SolFlag == -1 ) {
 							++FanCoil( FanCoilNum ).ConvgErrCountC;
 							if ( FanCoil( FanCoilNum ).ConvgErrCountC < 2 ) {
@@ -2091,13 +2110,13 @@ namespace FanCoilUnits {
 						if ( FirstHVACIteration ) Par( 2 ) = 1.0;
 						Par( 3 ) = ControlledZoneNum;
 						Par( 4 ) = QZnReq;
-						SolveRegulaFalsi( 0.001, MaxIterCycl, SolFlag, HWFlow, CalcFanCoilHWLoadResidual, 0.0, MaxWaterFlow, Par );
+						SolveRegulaFalsi( 0.001, MaxIterCycl, SolFlag, HWFlow, CalcFanCoilHWLoadResidual, 0.0, MaxWaterFlow, Par, "Sim4PipeFanCoil" );
 						if ( SolFlag == -1 ) {
 							// tighten limits on water flow rate to see if this allows convergence
 							CoolingLoad = false;
 							HeatingLoad = true;
 							TightenWaterFlowLimits( FanCoilNum, CoolingLoad, HeatingLoad, FanCoil( FanCoilNum ).HotControlNode, ControlledZoneNum, FirstHVACIteration, QZnReq, MinWaterFlow, MaxWaterFlow );
-							SolveRegulaFalsi( 0.001, MaxIterCycl, SolFlag, HWFlow, CalcFanCoilHWLoadResidual, MinWaterFlow, MaxWaterFlow, Par );
+							SolveRegulaFalsi( 0.001, MaxIterCycl, SolFlag, HWFlow, CalcFanCoilHWLoadResidual, MinWaterFlow, MaxWaterFlow, Par, "Sim4PipeFanCoil" );
 							if ( SolFlag == -1 ) {
 								++FanCoil( FanCoilNum ).ConvgErrCountH;
 								if ( FanCoil( FanCoilNum ).ConvgErrCountH < 2 ) {
@@ -2141,7 +2160,7 @@ namespace FanCoilUnits {
 						if ( FirstHVACIteration ) Par( 2 ) = 1.0;
 						Par( 3 ) = ControlledZoneNum;
 						Par( 4 ) = QZnReq;
-						SolveRegulaFalsi( 0.001, MaxIterCycl, SolFlag, PLR, CalcFanCoilLoadResidual, 0.0, 1.0, Par );
+						SolveRegulaFalsi( 0.001, MaxIterCycl, SolFlag, PLR, CalcFanCoilLoadResidual, 0.0, 1.0, Par, "Sim4PipeFanCoil" );
 					}
 				} else {
 					// demand greater than capacity
@@ -2274,13 +2293,13 @@ namespace FanCoilUnits {
 					Par( 3 ) = ControlledZoneNum;
 					Par( 4 ) = QZnReq;
 					Par( 5 ) = double( FanCoil( FanCoilNum ).ColdControlNode );
-					SolveRegulaFalsi( 0.001, MaxIterCycl, SolFlag, PLR, CalcFanCoilPLRResidual, 0.0, 1.0, Par );
+					SolveRegulaFalsi( 0.001, MaxIterCycl, SolFlag, PLR, CalcFanCoilPLRResidual, 0.0, 1.0, Par, "Sim4PipeFanCoil" );
 					if ( SolFlag == -1 ) {
 						// tighten limits on water flow rate to see if this allows convergence
 						CoolingLoad = true;
 						HeatingLoad = false;
 						TightenAirAndWaterFlowLimits( FanCoilNum, CoolingLoad, HeatingLoad, FanCoil( FanCoilNum ).ColdControlNode, ControlledZoneNum, FirstHVACIteration, QZnReq, PLRMin, PLRMax );
-						SolveRegulaFalsi( 0.001, MaxIterCycl, SolFlag, PLR, CalcFanCoilPLRResidual, PLRMin, PLRMax, Par );
+						SolveRegulaFalsi( 0.001, MaxIterCycl, SolFlag, PLR, CalcFanCoilPLRResidual, PLRMin, PLRMax, Par, "Sim4PipeFanCoil" );
 						if ( SolFlag == -1 ) {
 							++FanCoil( FanCoilNum ).ConvgErrCountC;
 							if ( FanCoil( FanCoilNum ).ConvgErrCountC < 2 ) {
@@ -2350,13 +2369,13 @@ namespace FanCoilUnits {
 						Par( 3 ) = ControlledZoneNum;
 						Par( 4 ) = QZnReq;
 						Par( 5 ) = double( FanCoil( FanCoilNum ).HotControlNode );
-						SolveRegulaFalsi( 0.001, MaxIterCycl, SolFlag, PLR, CalcFanCoilPLRResidual, 0.0, 1.0, Par );
+						SolveRegulaFalsi( 0.001, MaxIterCycl, SolFlag, PLR, CalcFanCoilPLRResidual, 0.0, 1.0, Par, "Sim4PipeFanCoil" );
 						if ( SolFlag == -1 ) {
 							// tighten limits on water flow rate to see if this allows convergence
 							CoolingLoad = false;
 							HeatingLoad = true;
 							TightenAirAndWaterFlowLimits( FanCoilNum, CoolingLoad, HeatingLoad, FanCoil( FanCoilNum ).HotControlNode, ControlledZoneNum, FirstHVACIteration, QZnReq, PLRMin, PLRMax );
-							SolveRegulaFalsi( 0.001, MaxIterCycl, SolFlag, PLR, CalcFanCoilPLRResidual, PLRMin, PLRMax, Par );
+							SolveRegulaFalsi( 0.001, MaxIterCycl, SolFlag, PLR, CalcFanCoilPLRResidual, PLRMin, PLRMax, Par, "Sim4PipeFanCoil" );
 							if ( SolFlag == -1 ) {
 								++FanCoil( FanCoilNum ).ConvgErrCountH;
 								if ( FanCoil( FanCoilNum ).ConvgErrCountH < 2 ) {
@@ -2401,7 +2420,7 @@ namespace FanCoilUnits {
 						if ( FirstHVACIteration ) Par( 2 ) = 1.0;
 						Par( 3 ) = ControlledZoneNum;
 						Par( 4 ) = QZnReq;
-						SolveRegulaFalsi( 0.001, MaxIterCycl, SolFlag, PLR, CalcFanCoilLoadResidual, 0.0, 1.0, Par );
+						SolveRegulaFalsi( 0.001, MaxIterCycl, SolFlag, PLR, CalcFanCoilLoadResidual, 0.0, 1.0, Par, "Sim4PipeFanCoil" );
 
 					}
 				} else {
@@ -2492,7 +2511,7 @@ namespace FanCoilUnits {
 					Par( 3 ) = ControlledZoneNum;
 					Par( 4 ) = QZnReq;
 					Par( 5 ) = double( FanCoil( FanCoilNum ).ColdControlNode );
-					SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, mdot, CalcFanCoilWaterFlowResidual, 0.0, FanCoil( FanCoilNum ).MaxColdWaterFlow, Par );
+					SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, mdot, CalcFanCoilWaterFlowResidual, 0.0, FanCoil( FanCoilNum ).MaxColdWaterFlow, Par, "Sim4PipeFanCoil" );
 					SetComponentFlowRate( mdot, FanCoil( FanCoilNum ).ColdControlNode, FanCoil( FanCoilNum ).ColdPlantOutletNode, FanCoil( FanCoilNum ).CWLoopNum, FanCoil( FanCoilNum ).CWLoopSide, FanCoil( FanCoilNum ).CWBranchNum, FanCoil( FanCoilNum ).CWCompNum );
 					if ( SolFlag == -1 ) {
 						ShowWarningError( "Cold Water control failed in fan coil unit " + FanCoil( FanCoilNum ).Name );
@@ -2516,7 +2535,7 @@ namespace FanCoilUnits {
 					Par( 3 ) = ControlledZoneNum;
 					Par( 4 ) = FanCoil( FanCoilNum ).DesZoneCoolingLoad * FanCoil( FanCoilNum ).LowSpeedRatio; // QZnReq
 					Par( 5 ) = double( FanCoil( FanCoilNum ).ColdControlNode );
-					SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, mdot, CalcFanCoilWaterFlowResidual, 0.0, FanCoil( FanCoilNum ).MaxColdWaterFlow, Par );
+					SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, mdot, CalcFanCoilWaterFlowResidual, 0.0, FanCoil( FanCoilNum ).MaxColdWaterFlow, Par, "Sim4PipeFanCoil" );
 					if ( SolFlag == -1 ) {
 						ShowWarningError( "Cold Water control failed in fan coil unit " + FanCoil( FanCoilNum ).Name );
 						ShowContinueError( "  Iteration limit exceeded in calculating water flow rate " );
@@ -2538,7 +2557,7 @@ namespace FanCoilUnits {
 						Par( 4 ) = QZnReq;
 						Par( 5 ) = double( FanCoil( FanCoilNum ).ColdControlNode );
 						Par( 6 ) = mdot;
-						SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, PLR, CalcFanCoilAirAndWaterFlowResidual, 0.0, 1.0, Par );
+						SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, PLR, CalcFanCoilAirAndWaterFlowResidual, 0.0, 1.0, Par, "Sim4PipeFanCoil" );
 						Node( FanCoil( FanCoilNum ).ColdControlNode ).MassFlowRate = mdot + ( PLR * ( FanCoil( FanCoilNum ).MaxColdWaterFlow - mdot ) );
 						SetComponentFlowRate( Node( FanCoil( FanCoilNum ).ColdControlNode ).MassFlowRate, FanCoil( FanCoilNum ).ColdControlNode, FanCoil( FanCoilNum ).ColdPlantOutletNode, FanCoil( FanCoilNum ).CWLoopNum, FanCoil( FanCoilNum ).CWLoopSide, FanCoil( FanCoilNum ).CWBranchNum, FanCoil( FanCoilNum ).CWCompNum );
 						if ( SolFlag == -1 ) {
@@ -2567,7 +2586,7 @@ namespace FanCoilUnits {
 					Par( 3 ) = ControlledZoneNum;
 					Par( 4 ) = QZnReq;
 					Par( 5 ) = double( FanCoil( FanCoilNum ).ColdControlNode );
-					SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, mdot, CalcFanCoilWaterFlowResidual, 0.0, FanCoil( FanCoilNum ).MaxColdWaterFlow, Par );
+					SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, mdot, CalcFanCoilWaterFlowResidual, 0.0, FanCoil( FanCoilNum ).MaxColdWaterFlow, Par, "Sim4PipeFanCoil" );
 					SetComponentFlowRate( mdot, FanCoil( FanCoilNum ).ColdControlNode, FanCoil( FanCoilNum ).ColdPlantOutletNode, FanCoil( FanCoilNum ).CWLoopNum, FanCoil( FanCoilNum ).CWLoopSide, FanCoil( FanCoilNum ).CWBranchNum, FanCoil( FanCoilNum ).CWCompNum );
 					if ( SolFlag == -1 ) {
 						ShowWarningError( "Cold Water control failed in fan coil unit " + FanCoil( FanCoilNum ).Name );
@@ -2598,7 +2617,7 @@ namespace FanCoilUnits {
 					Par( 4 ) = FanCoil( FanCoilNum ).MinSATempCooling;
 					Par( 5 ) = QZnReq;
 					Par( 6 ) = double( FanCoil( FanCoilNum ).ColdControlNode );
-					SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, mdot, CalcFanCoilWaterFlowTempResidual, 0.0, FanCoil( FanCoilNum ).MaxColdWaterFlow, Par );
+					SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, mdot, CalcFanCoilWaterFlowTempResidual, 0.0, FanCoil( FanCoilNum ).MaxColdWaterFlow, Par, "Sim4PipeFanCoil" );
 					SetComponentFlowRate( mdot, FanCoil( FanCoilNum ).ColdControlNode, FanCoil( FanCoilNum ).ColdPlantOutletNode, FanCoil( FanCoilNum ).CWLoopNum, FanCoil( FanCoilNum ).CWLoopSide, FanCoil( FanCoilNum ).CWBranchNum, FanCoil( FanCoilNum ).CWCompNum );
 					if ( SolFlag == -1 ) {
 						ShowWarningError( "Cold Water control failed in fan coil unit " + FanCoil( FanCoilNum ).Name );
@@ -2643,7 +2662,7 @@ namespace FanCoilUnits {
 						Par( 4 ) = QZnReq;
 						Par( 5 ) = double( FanCoil( FanCoilNum ).HotControlNode );
 						if ( FanCoil( FanCoilNum ).HCoilType_Num == HCoil_Water ) {
-							SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, mdot, CalcFanCoilWaterFlowResidual, 0.0, FanCoil( FanCoilNum ).MaxHotWaterFlow, Par );
+							SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, mdot, CalcFanCoilWaterFlowResidual, 0.0, FanCoil( FanCoilNum ).MaxHotWaterFlow, Par, "Sim4PipeFanCoil" );
 							SetComponentFlowRate( mdot, FanCoil( FanCoilNum ).HotControlNode, FanCoil( FanCoilNum ).HotPlantOutletNode, FanCoil( FanCoilNum ).HWLoopNum, FanCoil( FanCoilNum ).HWLoopSide, FanCoil( FanCoilNum ).HWBranchNum, FanCoil( FanCoilNum ).HWCompNum );
 							if ( SolFlag == -1 ) {
 								ShowWarningError( "Hot Water control failed in fan coil unit " + FanCoil( FanCoilNum ).Name );
@@ -2664,7 +2683,7 @@ namespace FanCoilUnits {
 
 						} else if( FanCoil( FanCoilNum ).HCoilType_Num == HCoil_Electric ) {
 							Par( 6 ) = 0.0;
-							SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, PLR, CalcFanCoilElecHeatResidual, 0.0, 1.0, Par );
+							SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, PLR, CalcFanCoilElecHeatResidual, 0.0, 1.0, Par, "Sim4PipeFanCoil" );
 							if( SolFlag == -1 ) {
 								ShowWarningError( "Electric heating coil control failed in fan coil unit " + FanCoil( FanCoilNum ).Name );
 								ShowContinueError( "  Iteration limit exceeded in calculating heating coil part load ratio." );
@@ -2699,7 +2718,7 @@ namespace FanCoilUnits {
 					Par( 4 ) = FanCoil( FanCoilNum ).DesZoneHeatingLoad * FanCoil( FanCoilNum ).LowSpeedRatio; // QZnReq
 					Par( 5 ) = double( FanCoil( FanCoilNum ).HotControlNode );
 					if( FanCoil( FanCoilNum ).HCoilType_Num == HCoil_Water ) {
-						SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, mdot, CalcFanCoilWaterFlowResidual, 0.0, FanCoil( FanCoilNum ).MaxHotWaterFlow, Par );
+						SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, mdot, CalcFanCoilWaterFlowResidual, 0.0, FanCoil( FanCoilNum ).MaxHotWaterFlow, Par, "Sim4PipeFanCoil" );
 						Low_mdot = mdot;
 						if ( SolFlag == -1 ) {
 							ShowWarningError( "Hot Water control failed in fan coil unit " + FanCoil( FanCoilNum ).Name );
@@ -2721,7 +2740,7 @@ namespace FanCoilUnits {
 						Par( 3 ) = ControlledZoneNum;
 						Par( 4 ) = FanCoil( FanCoilNum ).DesZoneHeatingLoad; // QZnReq;
 						Par( 5 ) = double( FanCoil( FanCoilNum ).HotControlNode );
-						SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, mdot, CalcFanCoilWaterFlowResidual, 0.0, FanCoil( FanCoilNum ).MaxHotWaterFlow, Par );
+						SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, mdot, CalcFanCoilWaterFlowResidual, 0.0, FanCoil( FanCoilNum ).MaxHotWaterFlow, Par, "Sim4PipeFanCoil" );
 						if ( SolFlag == -1 ) {
 							ShowWarningError( "Hot Water control failed in fan coil unit " + FanCoil( FanCoilNum ).Name );
 							ShowContinueError( "  Iteration limit exceeded in calculating water flow rate " );
@@ -2743,7 +2762,7 @@ namespace FanCoilUnits {
 							Par( 5 ) = Low_mdot;
 							Par( 6 ) = mdot;
 							Par( 7 ) = double( FanCoil( FanCoilNum ).HotControlNode );
-							SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, PLR, CalcFanCoilBothFlowResidual, 0.0, 1.0, Par );
+							SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, PLR, CalcFanCoilBothFlowResidual, 0.0, 1.0, Par, "Sim4PipeFanCoil" );
 							if ( SolFlag == -1 ) {
 								ShowWarningError( "Hot Water control failed in fan coil unit " + FanCoil( FanCoilNum ).Name );
 								ShowContinueError( "  Iteration limit exceeded in calculating air flow rate " );
@@ -2780,7 +2799,7 @@ namespace FanCoilUnits {
 							Par( 5 ) = MaxSAMassFlowRate;
 							Par( 6 ) = -1.0; // also modulate air flow rate
 						}
-						SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, PLR, CalcFanCoilElecHeatResidual, 0.0, 1.0, Par );
+						SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, PLR, CalcFanCoilElecHeatResidual, 0.0, 1.0, Par, "Sim4PipeFanCoil" );
 						if( SolFlag == -1 ) {
 							ShowWarningError( "Electric heating coil control failed in fan coil unit " + FanCoil( FanCoilNum ).Name );
 							ShowContinueError( "  Iteration limit exceeded in calculating heating coil part load ratio." );
@@ -2805,7 +2824,7 @@ namespace FanCoilUnits {
 					Par( 4 ) = QZnReq;
 					Par( 5 ) = double( FanCoil( FanCoilNum ).HotControlNode );
 					if( FanCoil( FanCoilNum ).HCoilType_Num == HCoil_Water ) {
-						SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, mdot, CalcFanCoilWaterFlowResidual, 0.0, FanCoil( FanCoilNum ).MaxHotWaterFlow, Par );
+						SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, mdot, CalcFanCoilWaterFlowResidual, 0.0, FanCoil( FanCoilNum ).MaxHotWaterFlow, Par, "Sim4PipeFanCoil" );
 						if ( SolFlag == -1 ) {
 							ShowWarningError( "Hot Water control failed in fan coil unit " + FanCoil( FanCoilNum ).Name );
 							ShowContinueError( "  Iteration limit exceeded in calculating water flow rate " );
@@ -2821,7 +2840,7 @@ namespace FanCoilUnits {
 
 						Par( 6 ) = 0.0;
 						Node( InletNode ).MassFlowRate = MaxSAMassFlowRate;
-						SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, PLR, CalcFanCoilElecHeatResidual, 0.0, 1.0, Par );
+						SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, PLR, CalcFanCoilElecHeatResidual, 0.0, 1.0, Par, "Sim4PipeFanCoil" );
 						if( SolFlag == -1 ) {
 							ShowWarningError( "Electric heating coil control failed in fan coil unit " + FanCoil( FanCoilNum ).Name );
 							ShowContinueError( "  Iteration limit exceeded in calculating heating coil part load ratio." );
@@ -2859,13 +2878,13 @@ namespace FanCoilUnits {
 						Par( 5 ) = QZnReq;
 						Par( 6 ) = double( FanCoil( FanCoilNum ).HotControlNode );
 						SetComponentFlowRate( mdot, FanCoil( FanCoilNum ).HotControlNode, FanCoil( FanCoilNum ).HotPlantOutletNode, FanCoil( FanCoilNum ).HWLoopNum, FanCoil( FanCoilNum ).HWLoopSide, FanCoil( FanCoilNum ).HWBranchNum, FanCoil( FanCoilNum ).HWCompNum );
-						SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, mdot, CalcFanCoilWaterFlowTempResidual, 0.0, FanCoil( FanCoilNum ).MaxHotWaterFlow, Par );
+						SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, mdot, CalcFanCoilWaterFlowTempResidual, 0.0, FanCoil( FanCoilNum ).MaxHotWaterFlow, Par, "Sim4PipeFanCoil" );
 						Calc4PipeFanCoil( FanCoilNum, ControlledZoneNum, FirstHVACIteration, QUnitOut );
 					} else {
 						Par( 5 ) = FanCoil( FanCoilNum ).MaxAirMassFlow;
 						Par( 6 ) = -1.0; // modulate air flow and heating coil PLR
 						Par( 7 ) = MinSAMassFlowRate;
-						SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, PLR, CalcFanCoilElecHeatTempResidual, 0.0, 1.0, Par );
+						SolveRegulaFalsi( ControlOffset, MaxIterCycl, SolFlag, PLR, CalcFanCoilElecHeatTempResidual, 0.0, 1.0, Par, "Sim4PipeFanCoil" );
 						Calc4PipeFanCoil( FanCoilNum, ControlledZoneNum, FirstHVACIteration, QUnitOut, PLR );
 					}
 					if( SolFlag == -1 ) {
@@ -3316,8 +3335,6 @@ namespace FanCoilUnits {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int OutletNode; // unit air outlet node
 		int InletNode; // unit air inlet node
-		static int ATMixOutNode( 0 ); // outlet node of ATM Mixer
-		static int ZoneNode( 0 ); // zone node
 		Real64 AirMassFlow; // total mass flow through the unit
 		Real64 PartLoad; // if PLR present PartLoad = PLR
 		Real64 OASchedValue; // value of OASchedValue, =1 if not schedule
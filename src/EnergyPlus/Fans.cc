@@ -178,6 +178,14 @@ namespace Fans {
 		Array1D_bool MySizeFlag;
 		Array1D_bool MyEnvrnFlag;
 		Array1D_bool CheckEquipName;
+		bool GetFanInputErrorsFound( false ); // If errors detected in input
+		Real64 VFDSpdRatio( 0.0 ); // Ratio of motor speed to motor max speed [-]
+		Real64 VFDOutPwrRatio( 0.0 ); // Ratio of VFD output power to max VFD output power [-]
+		Real64 FlowFracForPower( 0.0 ); // Variable Volume Fan Flow Fraction for power calcs[-]
+		Real64 FlowFracActual( 0.0 ); // actual VAV fan flow fraction
+		int ErrCount( 0 );
+		Real64 SimComponentModelFanVFDSpdRatio( 0.0 ); // Ratio of motor speed to motor max speed [-]
+		Real64 SimComponentModelFanVFDOutPwrRatio( 0.0 ); // Ratio of VFD output power to max VFD output power [-]
 	}
 
 	// Subroutine Specifications for the Module
@@ -381,7 +389,6 @@ namespace Fans {
 		int NumNums;
 		int checkNum;
 		int IOStat;
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		static std::string const RoutineName( "GetFanInput: " ); // include trailing blank space
@@ -465,7 +472,7 @@ namespace Fans {
 			IsBlank = false;
 			VerifyName( cAlphaArgs( 1 ), Fan, &FanEquipConditions::FanName, FanNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetFanInputErrorsFound = true;
 				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 			}
 			Fan( FanNum ).FanName = cAlphaArgs( 1 );
@@ -477,7 +484,7 @@ namespace Fans {
 				Fan( FanNum ).AvailSchedPtrNum = GetScheduleIndex( cAlphaArgs( 2 ) );
 				if ( Fan( FanNum ).AvailSchedPtrNum == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + ": invalid " + cAlphaFieldNames( 2 ) + " entered =" + cAlphaArgs( 2 ) + " for " + cAlphaFieldNames( 1 ) + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetFanInputErrorsFound = true;
 				}
 			}
 			Fan( FanNum ).FanType_Num = FanType_SimpleConstVolume;
@@ -493,8 +500,8 @@ namespace Fans {
 			Fan( FanNum ).MotInAirFrac = rNumericArgs( 5 );
 			Fan( FanNum ).MinAirFlowRate = 0.0;
 
-			Fan( FanNum ).InletNodeNum = GetOnlySingleNode( cAlphaArgs( 3 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			Fan( FanNum ).OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			Fan( FanNum ).InletNodeNum = GetOnlySingleNode( cAlphaArgs( 3 ), GetFanInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			Fan( FanNum ).OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), GetFanInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			if ( NumAlphas > 4 ) {
 				Fan( FanNum ).EndUseSubcategoryName = cAlphaArgs( 5 );
@@ -519,7 +526,7 @@ namespace Fans {
 			IsBlank = false;
 			VerifyName( cAlphaArgs( 1 ), Fan, &FanEquipConditions::FanName, FanNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetFanInputErrorsFound = true;
 				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 			}
 			Fan( FanNum ).FanName = cAlphaArgs( 1 );
@@ -531,7 +538,7 @@ namespace Fans {
 				Fan( FanNum ).AvailSchedPtrNum = GetScheduleIndex( cAlphaArgs( 2 ) );
 				if ( Fan( FanNum ).AvailSchedPtrNum == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + ": invalid " + cAlphaFieldNames( 2 ) + " entered =" + cAlphaArgs( 2 ) + " for " + cAlphaFieldNames( 1 ) + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetFanInputErrorsFound = true;
 				}
 			}
 			Fan( FanNum ).FanType_Num = FanType_SimpleVAV;
@@ -550,7 +557,7 @@ namespace Fans {
 			} else {
 				ShowSevereError( cAlphaFieldNames( 3 ) + " should be either Fraction or FixedFlowRate." );
 				ShowContinueError( "Occurs in " + Fan( FanNum ).FanName + " object." );
-				ErrorsFound = true;
+				GetFanInputErrorsFound = true;
 			}
 			//        Fan(FanNum)%MinAirFlowRate= rNumericArgs(4)
 			Fan( FanNum ).FanMinFrac = rNumericArgs( 4 );
@@ -566,8 +573,8 @@ namespace Fans {
 				ShowWarningError( "Fan Coefficients are all zero.  No Fan power will be reported." );
 				ShowContinueError( "For " + cCurrentModuleObject + ", Fan=" + cAlphaArgs( 1 ) );
 			}
-			Fan( FanNum ).InletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			Fan( FanNum ).OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			Fan( FanNum ).InletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), GetFanInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			Fan( FanNum ).OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), GetFanInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			if ( NumAlphas > 5 ) {
 				Fan( FanNum ).EndUseSubcategoryName = cAlphaArgs( 6 );
@@ -592,7 +599,7 @@ namespace Fans {
 			IsBlank = false;
 			VerifyName( cAlphaArgs( 1 ), Fan, &FanEquipConditions::FanName, FanNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetFanInputErrorsFound = true;
 				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 			}
 			Fan( FanNum ).FanName = cAlphaArgs( 1 );
@@ -604,7 +611,7 @@ namespace Fans {
 				Fan( FanNum ).AvailSchedPtrNum = GetScheduleIndex( cAlphaArgs( 2 ) );
 				if ( Fan( FanNum ).AvailSchedPtrNum == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + ": invalid " + cAlphaFieldNames( 2 ) + " entered =" + cAlphaArgs( 2 ) + " for " + cAlphaFieldNames( 1 ) + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetFanInputErrorsFound = true;
 				} else {
 					if ( HasFractionalScheduleValue( Fan( FanNum ).AvailSchedPtrNum ) ) {
 						ShowWarningError( cCurrentModuleObject + "=\"" + Fan( FanNum ).FanName + "\" has fractional values in Schedule=" + cAlphaArgs( 2 ) + ". Only 0.0 in the schedule value turns the fan off." );
@@ -627,8 +634,8 @@ namespace Fans {
 				ShowWarningError( cCurrentModuleObject + "=\"" + Fan( FanNum ).FanName + "\" has specified 0.0 max air flow rate. It will not be used in the simulation." );
 			}
 
-			Fan( FanNum ).InletNodeNum = GetOnlySingleNode( cAlphaArgs( 3 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			Fan( FanNum ).OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			Fan( FanNum ).InletNodeNum = GetOnlySingleNode( cAlphaArgs( 3 ), GetFanInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			Fan( FanNum ).OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), GetFanInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			if ( NumAlphas > 4 && ! lAlphaFieldBlanks( 5 ) ) {
 				Fan( FanNum ).EndUseSubcategoryName = cAlphaArgs( 5 );
@@ -640,13 +647,13 @@ namespace Fans {
 				Fan( FanNum ).FlowFractSchedNum = GetScheduleIndex( cAlphaArgs( 6 ) );
 				if ( Fan( FanNum ).FlowFractSchedNum == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + ": invalid " + cAlphaFieldNames( 6 ) + " entered =" + cAlphaArgs( 6 ) + " for " + cAlphaFieldNames( 1 ) + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetFanInputErrorsFound = true;
 				} else if ( Fan( FanNum ).FlowFractSchedNum > 0 ) {
 					if ( ! CheckScheduleValueMinMax( Fan( FanNum ).FlowFractSchedNum, ">=", 0.0, "<=", 1.0 ) ) {
 						ShowSevereError( RoutineName + cCurrentModuleObject + ": invalid " + cAlphaFieldNames( 6 ) + " for " + cAlphaFieldNames( 1 ) + '=' + cAlphaArgs( 1 ) );
 						ShowContinueError( "Error found in " + cAlphaFieldNames( 6 ) + " = " + cAlphaArgs( 6 ) );
 						ShowContinueError( "Schedule values must be (>=0., <=1.)" );
-						ErrorsFound = true;
+						GetFanInputErrorsFound = true;
 					}
 				}
 			} else {
@@ -661,7 +668,7 @@ namespace Fans {
 					Fan( FanNum ).AvailManagerMode = ExhaustFanDecoupledFromAvailManagers;
 				} else {
 					ShowSevereError( RoutineName + cCurrentModuleObject + ": invalid " + cAlphaFieldNames( 7 ) + " entered =" + cAlphaArgs( 7 ) + " for " + cAlphaFieldNames( 1 ) + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetFanInputErrorsFound = true;
 				}}
 			} else {
 				Fan( FanNum ).AvailManagerMode = ExhaustFanCoupledToAvailManagers;
@@ -671,7 +678,7 @@ namespace Fans {
 				Fan( FanNum ).MinTempLimitSchedNum = GetScheduleIndex( cAlphaArgs( 8 ) );
 				if ( Fan( FanNum ).MinTempLimitSchedNum == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + ": invalid " + cAlphaFieldNames( 8 ) + " entered =" + cAlphaArgs( 8 ) + " for " + cAlphaFieldNames( 1 ) + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetFanInputErrorsFound = true;
 				}
 			} else {
 				Fan( FanNum ).MinTempLimitSchedNum = 0;
@@ -681,13 +688,13 @@ namespace Fans {
 				Fan( FanNum ).BalancedFractSchedNum = GetScheduleIndex( cAlphaArgs( 9 ) );
 				if ( Fan( FanNum ).BalancedFractSchedNum == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + ": invalid " + cAlphaFieldNames( 9 ) + " entered =" + cAlphaArgs( 9 ) + " for " + cAlphaFieldNames( 1 ) + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetFanInputErrorsFound = true;
 				} else if ( Fan( FanNum ).BalancedFractSchedNum > 0 ) {
 					if ( ! CheckScheduleValueMinMax( Fan( FanNum ).BalancedFractSchedNum, ">=", 0.0, "<=", 1.0 ) ) {
 						ShowSevereError( RoutineName + cCurrentModuleObject + ": invalid " + cAlphaFieldNames( 9 ) + " for " + cAlphaFieldNames( 1 ) + '=' + cAlphaArgs( 1 ) );
 						ShowContinueError( "Error found in " + cAlphaFieldNames( 9 ) + " = " + cAlphaArgs( 9 ) );
 						ShowContinueError( "Schedule values must be (>=0., <=1.)" );
-						ErrorsFound = true;
+						GetFanInputErrorsFound = true;
 					}
 				}
 			} else {
@@ -712,7 +719,7 @@ namespace Fans {
 			IsBlank = false;
 			VerifyName( cAlphaArgs( 1 ), Fan, &FanEquipConditions::FanName, FanNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetFanInputErrorsFound = true;
 				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 			}
 			Fan( FanNum ).FanName = cAlphaArgs( 1 );
@@ -724,7 +731,7 @@ namespace Fans {
 				Fan( FanNum ).AvailSchedPtrNum = GetScheduleIndex( cAlphaArgs( 2 ) );
 				if ( Fan( FanNum ).AvailSchedPtrNum == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + ": invalid " + cAlphaFieldNames( 2 ) + " entered =" + cAlphaArgs( 2 ) + " for " + cAlphaFieldNames( 1 ) + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetFanInputErrorsFound = true;
 				}
 			}
 			Fan( FanNum ).FanType_Num = FanType_SimpleOnOff;
@@ -745,8 +752,8 @@ namespace Fans {
 			Fan( FanNum ).MotInAirFrac = rNumericArgs( 5 );
 			Fan( FanNum ).MinAirFlowRate = 0.0;
 
-			Fan( FanNum ).InletNodeNum = GetOnlySingleNode( cAlphaArgs( 3 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			Fan( FanNum ).OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			Fan( FanNum ).InletNodeNum = GetOnlySingleNode( cAlphaArgs( 3 ), GetFanInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			Fan( FanNum ).OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), GetFanInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			if ( NumAlphas > 4 && ! lAlphaFieldBlanks( 5 ) ) {
 				Fan( FanNum ).FanPowerRatAtSpeedRatCurveIndex = GetCurveIndex( cAlphaArgs( 5 ) );
@@ -788,7 +795,7 @@ namespace Fans {
 			IsBlank = false;
 			VerifyName( cAlphaArgs( 1 ), NightVentPerf, &NightVentPerfData::FanName, NVPerfNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetFanInputErrorsFound = true;
 				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 			}
 			NightVentPerf( NVPerfNum ).FanName = cAlphaArgs( 1 );
@@ -808,7 +815,7 @@ namespace Fans {
 			}
 			if ( ! NVPerfFanFound ) {
 				ShowSevereError( cCurrentModuleObject + ", fan name not found=" + cAlphaArgs( 1 ) );
-				ErrorsFound = true;
+				GetFanInputErrorsFound = true;
 			}
 
 		}
@@ -828,14 +835,14 @@ namespace Fans {
 			IsBlank = false;
 			VerifyName( cAlphaArgs( 1 ), Fan, &FanEquipConditions::FanName, FanNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetFanInputErrorsFound = true;
 				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 			}
 			Fan( FanNum ).FanName = cAlphaArgs( 1 ); // Fan name
 			Fan( FanNum ).FanType = cCurrentModuleObject;
 
-			Fan( FanNum ).InletNodeNum = GetOnlySingleNode( cAlphaArgs( 2 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent ); // Air inlet node name
-			Fan( FanNum ).OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 3 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent ); // Air outlet node name
+			Fan( FanNum ).InletNodeNum = GetOnlySingleNode( cAlphaArgs( 2 ), GetFanInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent ); // Air inlet node name
+			Fan( FanNum ).OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 3 ), GetFanInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent ); // Air outlet node name
 
 			TestCompSet( cCurrentModuleObject, cAlphaArgs( 1 ), cAlphaArgs( 2 ), cAlphaArgs( 3 ), "Air Nodes" );
 
@@ -846,7 +853,7 @@ namespace Fans {
 				Fan( FanNum ).AvailSchedPtrNum = GetScheduleIndex( cAlphaArgs( 4 ) );
 				if ( Fan( FanNum ).AvailSchedPtrNum == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + ": invalid " + cAlphaFieldNames( 4 ) + " entered =" + cAlphaArgs( 4 ) + " for " + cAlphaFieldNames( 1 ) + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetFanInputErrorsFound = true;
 				}
 			}
 
@@ -909,13 +916,13 @@ namespace Fans {
 		for ( FanNum = 1; FanNum <= NumFans; ++FanNum ) {
 			for ( checkNum = FanNum + 1; checkNum <= NumFans; ++checkNum ) {
 				if ( Fan( FanNum ).InletNodeNum == Fan( checkNum ).InletNodeNum ) {
-					ErrorsFound = true;
+					GetFanInputErrorsFound = true;
 					ShowSevereError( "GetFanInput, duplicate fan inlet node names, must be unique for fans." );
 					ShowContinueError( "Fan=" + Fan( FanNum ).FanType + ':' + Fan( FanNum ).FanName + " and Fan=" + Fan( checkNum ).FanType + ':' + Fan( checkNum ).FanName + '.' );
 					ShowContinueError( "Inlet Node Name=\"" + NodeID( Fan( FanNum ).InletNodeNum ) + "\"." );
 				}
 				if ( Fan( FanNum ).OutletNodeNum == Fan( checkNum ).OutletNodeNum ) {
-					ErrorsFound = true;
+					GetFanInputErrorsFound = true;
 					ShowSevereError( "GetFanInput, duplicate fan outlet node names, must be unique for fans." );
 					ShowContinueError( "Fan=" + Fan( FanNum ).FanType + ':' + Fan( FanNum ).FanName + " and Fan=" + Fan( checkNum ).FanType + ':' + Fan( checkNum ).FanName + '.' );
 					ShowContinueError( "Outlet Node Name=\"" + NodeID( Fan( FanNum ).OutletNodeNum ) + "\"." );
@@ -923,7 +930,7 @@ namespace Fans {
 			}
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetFanInputErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in input.  Program terminates." );
 		}
 
@@ -1190,8 +1197,6 @@ namespace Fans {
 		Real64 XmotorMax; // Factor for motor max eff curve [ln hp]
 		Real64 MotorOutPwrRatio; // Ratio of motor output power to max motor output power [-]
 		Real64 MotorPLEff; // Motor normalized (part-load) efficiency [-]
-		static Real64 VFDSpdRatio( 0.0 ); // Ratio of motor speed to motor max speed [-]
-		static Real64 VFDOutPwrRatio( 0.0 ); // Ratio of VFD output power to max VFD output power [-]
 		std::string CompName; // component name
 		std::string	CompType; // component type
 		std::string SizingString; // input field sizing description (e.g., Nominal Capacity)
@@ -1660,8 +1665,6 @@ namespace Fans {
 		Real64 PartLoadFrac;
 		//unused0909      REAL(r64) MaxFlowFrac   !Variable Volume Fan Max Flow Fraction [-]
 		Real64 MinFlowFrac; // Variable Volume Fan Min Flow Fraction [-]
-		static Real64 FlowFracForPower( 0.0 ); // Variable Volume Fan Flow Fraction for power calcs[-]
-		static Real64 FlowFracActual( 0.0 ); // actual VAV fan flow fraction
 		Real64 FanShaftPower; // power delivered to fan shaft
 		Real64 PowerLossToAir; // fan and motor loss to air stream (watts)
 		int NVPerfNum;
@@ -1866,7 +1869,6 @@ namespace Fans {
 		Real64 PowerLossToAir; // fan and motor loss to air stream (watts)
 		Real64 SpeedRaisedToPower; // Result of the speed ratio raised to the power of n (Curve object)
 		Real64 EffRatioAtSpeedRatio; // Efficeincy ratio at current speed ratio (Curve object)
-		static int ErrCount( 0 );
 
 		//unused0909   Tin        = Fan(FanNum)%InletAirTemp
 		//unused0909   Win        = Fan(FanNum)%InletAirHumRat
@@ -2221,8 +2223,6 @@ namespace Fans {
 		Real64 BeltPLEff; // Belt normalized (part-load) efficiency [-]
 		Real64 MotorOutPwrRatio; // Ratio of motor output power to max motor output power [-]
 		Real64 MotorPLEff; // Motor normalized (part-load) efficiency [-]
-		static Real64 VFDSpdRatio( 0.0 ); // Ratio of motor speed to motor max speed [-]
-		static Real64 VFDOutPwrRatio( 0.0 ); // Ratio of VFD output power to max VFD output power [-]
 		Real64 PowerLossToAir; // Energy input to air stream (W)
 		Real64 FanEnthalpyChange; // Air enthalpy change due to fan, belt, and motor losses [kJ/kg]
 
@@ -2334,12 +2334,12 @@ namespace Fans {
 
 			// Calculate VFD efficiency using correlations and coefficients based on VFD type
 			if ( ( Fan( FanNum ).VFDEffType == "SPEED" ) && ( Fan( FanNum ).VFDEffCurveIndex != 0 ) ) {
-				VFDSpdRatio = MotorSpeed / Fan( FanNum ).MotorMaxSpd; //[-]
-				Fan( FanNum ).VFDEff = CurveValue( Fan( FanNum ).VFDEffCurveIndex, VFDSpdRatio ); //[-]
+				SimComponentModelFanVFDSpdRatio = MotorSpeed / Fan( FanNum ).MotorMaxSpd; //[-]
+				Fan( FanNum ).VFDEff = CurveValue( Fan( FanNum ).VFDEffCurveIndex, SimComponentModelFanVFDSpdRatio ); //[-]
 			} else {
 				if ( ( Fan( FanNum ).VFDEffType == "POWER" ) && ( Fan( FanNum ).VFDEffCurveIndex != 0 ) ) {
-					VFDOutPwrRatio = Fan( FanNum ).MotorInputPower / Fan( FanNum ).VFDMaxOutPwr; //[-]
-					Fan( FanNum ).VFDEff = CurveValue( Fan( FanNum ).VFDEffCurveIndex, VFDOutPwrRatio ); //[-]
+					SimComponentModelFanVFDOutPwrRatio = Fan( FanNum ).MotorInputPower / Fan( FanNum ).VFDMaxOutPwr; //[-]
+					Fan( FanNum ).VFDEff = CurveValue( Fan( FanNum ).VFDEffCurveIndex, SimComponentModelFanVFDOutPwrRatio ); //[-]
 				} else {
 					// No curve specified - use constant efficiency
 					Fan( FanNum ).VFDMaxOutPwr = 0.0;
@@ -3414,6 +3414,14 @@ namespace Fans {
 		NightVentPerf.deallocate();
 		FanNumericFields.deallocate();
 
+		GetFanInputErrorsFound = false;
+		VFDSpdRatio = 0.0;
+		VFDOutPwrRatio = 0.0;
+		FlowFracForPower = 0.0;
+		FlowFracActual = 0.0;
+		ErrCount = 0;
+		SimComponentModelFanVFDSpdRatio = 0.0;
+		SimComponentModelFanVFDOutPwrRatio = 0.0;
 	}
 
 	// End of Utility subroutines for the Fan Module
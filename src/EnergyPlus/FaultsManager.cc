@@ -164,8 +164,42 @@ namespace FaultsManager {
 	Array1D< FaultProperties > FaultsHumidistatOffset;
 	Array1D< FaultProperties > FaultsFouledAirFilters;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool RunMeOnceFlag( false );
+		bool ErrorsFound( false ); // If errors detected in input
+		Array1D_bool lAlphaFieldBlanks( 10, false );
+		Array1D_bool lNumericFieldBlanks( 10, false );
+	}
+
 	// Functions
 
+	// Clears the global data in FaultsManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		AnyFaultsInModel = false;
+		NumFaults = 0;
+		NumFouledCoil = 0;
+		NumFaultyThermostat = 0;
+		NumFaultyHumidistat = 0;
+		NumFaultyAirFilter = 0;
+		Faults.deallocate();
+		FouledCoils.deallocate();
+		FaultsThermostatOffset.deallocate();
+		FaultsHumidistatOffset.deallocate();
+		FaultsFouledAirFilters.deallocate();
+		RunMeOnceFlag = false;
+		ErrorsFound = false;
+		lAlphaFieldBlanks = Array1D_bool( 10, false );
+		lNumericFieldBlanks = Array1D_bool( 10, false );
+	}
+
 	void
 	CheckAndReadFaults()
 	{
@@ -206,15 +240,11 @@ namespace FaultsManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool RunMeOnceFlag( false );
 
-		static bool ErrorsFound( false ); // If errors detected in input
 		int NumAlphas; // Number of Alphas for each GetobjectItem call
 		int NumNumbers; // Number of Numbers for each GetobjectItem call
 		int IOStatus;
 		Array1D_string cAlphaArgs( 10 ); // Alpha input items for object
-		static Array1D_bool lAlphaFieldBlanks( 10, false );
-		static Array1D_bool lNumericFieldBlanks( 10, false );
 		Array1D_string cAlphaFieldNames( 10 );
 		Array1D_string cNumericFieldNames( 10 );
 		Array1D< Real64 > rNumericArgs( 10 ); // Numeric input items for object
@@ -228,6 +228,11 @@ namespace FaultsManager {
 
 	// Functions
 
+	// Clears the global data in FaultsManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	CheckAndReadFaults();
 
@@ -190,8 +190,47 @@ namespace FluidCoolers {
 	// Beginning of CondenserLoopFluidCoolers Module Driver Subroutines
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInput( true );
+		bool ErrorsFound( false ); // Logical flag set .TRUE. if errors found while getting input data
+		bool InitFluidCoolerErrorsFound( false ); // Flag if input data errors are found
+		bool MyOneTimeFlag( true );
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool OneTimeFlagForEachFluidCooler;
+	}
+
 	// Functions
 
+	// Clears the global data in FluidCoolers.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumSimpleFluidCoolers = 0;
+		InletWaterTemp = 0.0;
+		OutletWaterTemp = 0.0;
+		WaterInletNode = 0;
+		WaterOutletNode = 0;
+		WaterMassFlowRate = 0.0;
+		Qactual = 0.0;
+		FanPower = 0.0;
+		CheckEquipName.deallocate();
+		SimpleFluidCooler.deallocate();
+		SimpleFluidCoolerInlet.deallocate();
+		SimpleFluidCoolerReport.deallocate();
+		GetInput = true;
+		ErrorsFound = false;
+		InitFluidCoolerErrorsFound = false;
+		MyOneTimeFlag = true;
+		MyEnvrnFlag.deallocate();
+		OneTimeFlagForEachFluidCooler.deallocate();
+	}
+
 	void
 	SimFluidCoolers(
 		std::string & FluidCoolerType,
@@ -239,7 +278,6 @@ namespace FluidCoolers {
 		// na
 
 		// LOCAL VARIABLE DECLARATIONS:
-		static bool GetInput( true );
 		int FluidCoolerNum;
 
 		// GET INPUT
@@ -373,7 +411,6 @@ namespace FluidCoolers {
 		int IOStat; // IO Status when calling get input subroutine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
-		static bool ErrorsFound( false ); // Logical flag set .TRUE. if errors found while getting input data
 		Array1D< Real64 > NumArray( 16 ); // Numeric input data array
 		Array1D_string AlphArray( 5 ); // Character string input data array
 
@@ -913,10 +950,6 @@ namespace FluidCoolers {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false ); // Flag if input data errors are found
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool OneTimeFlagForEachFluidCooler;
 		int TypeOf_Num( 0 );
 		int LoopNum;
 		int LoopSideNum;
@@ -947,9 +980,9 @@ namespace FluidCoolers {
 			}
 
 			// Locate the tower on the plant loops for later usage
-			ScanPlantLoopsForObject( SimpleFluidCooler( FluidCoolerNum ).Name, TypeOf_Num, SimpleFluidCooler( FluidCoolerNum ).LoopNum, SimpleFluidCooler( FluidCoolerNum ).LoopSideNum, SimpleFluidCooler( FluidCoolerNum ).BranchNum, SimpleFluidCooler( FluidCoolerNum ).CompNum, _, _, _, _, _, ErrorsFound );
+			ScanPlantLoopsForObject( SimpleFluidCooler( FluidCoolerNum ).Name, TypeOf_Num, SimpleFluidCooler( FluidCoolerNum ).LoopNum, SimpleFluidCooler( FluidCoolerNum ).LoopSideNum, SimpleFluidCooler( FluidCoolerNum ).BranchNum, SimpleFluidCooler( FluidCoolerNum ).CompNum, _, _, _, _, _, InitFluidCoolerErrorsFound );
 
-			if ( ErrorsFound ) {
+			if ( InitFluidCoolerErrorsFound ) {
 				ShowFatalError( "InitFluidCooler: Program terminated due to previous condition(s)." );
 			}
 
@@ -1268,7 +1301,7 @@ namespace FluidCoolers {
 					SimpleFluidCoolerInlet( FluidCoolerNum ).AirWetBulb = SimpleFluidCooler( FluidCoolerNum ).DesignEnteringAirWetBulbTemp;
 					SimpleFluidCoolerInlet( FluidCoolerNum ).AirPress = StdBaroPress;
 					SimpleFluidCoolerInlet( FluidCoolerNum ).AirHumRat = PsyWFnTdbTwbPb( SimpleFluidCoolerInlet( FluidCoolerNum ).AirTemp, SimpleFluidCoolerInlet( FluidCoolerNum ).AirWetBulb, SimpleFluidCoolerInlet( FluidCoolerNum ).AirPress, CalledFrom );
-					SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleFluidCoolerUAResidual, UA0, UA1, Par );
+					SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleFluidCoolerUAResidual, UA0, UA1, Par, "SizeFluidCooler" );
 					if ( SolFla == -1 ) {
 						ShowWarningError( "Iteration limit exceeded in calculating fluid cooler UA." );
 						ShowContinueError( "Autosizing of fluid cooler UA failed for fluid cooler = " + SimpleFluidCooler( FluidCoolerNum ).Name );
@@ -1356,7 +1389,7 @@ namespace FluidCoolers {
 				SimpleFluidCoolerInlet( FluidCoolerNum ).AirWetBulb = SimpleFluidCooler( FluidCoolerNum ).DesignEnteringAirWetBulbTemp; // design inlet air wet-bulb temp
 				SimpleFluidCoolerInlet( FluidCoolerNum ).AirPress = StdBaroPress;
 				SimpleFluidCoolerInlet( FluidCoolerNum ).AirHumRat = PsyWFnTdbTwbPb( SimpleFluidCoolerInlet( FluidCoolerNum ).AirTemp, SimpleFluidCoolerInlet( FluidCoolerNum ).AirWetBulb, SimpleFluidCoolerInlet( FluidCoolerNum ).AirPress );
-				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleFluidCoolerUAResidual, UA0, UA1, Par );
+				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleFluidCoolerUAResidual, UA0, UA1, Par, "SizeFluidCooler" );
 				if ( SolFla == -1 ) {
 					ShowWarningError( "Iteration limit exceeded in calculating fluid cooler UA." );
 					ShowContinueError( "Autosizing of fluid cooler UA failed for fluid cooler = " + SimpleFluidCooler( FluidCoolerNum ).Name );
@@ -1483,7 +1516,7 @@ namespace FluidCoolers {
 				SimpleFluidCoolerInlet( FluidCoolerNum ).AirWetBulb = SimpleFluidCooler( FluidCoolerNum ).DesignEnteringAirWetBulbTemp; // design inlet air wet-bulb temp
 				SimpleFluidCoolerInlet( FluidCoolerNum ).AirPress = StdBaroPress;
 				SimpleFluidCoolerInlet( FluidCoolerNum ).AirHumRat = PsyWFnTdbTwbPb( SimpleFluidCoolerInlet( FluidCoolerNum ).AirTemp, SimpleFluidCoolerInlet( FluidCoolerNum ).AirWetBulb, SimpleFluidCoolerInlet( FluidCoolerNum ).AirPress, CalledFrom );
-				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleFluidCoolerUAResidual, UA0, UA1, Par );
+				SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleFluidCoolerUAResidual, UA0, UA1, Par, "SizeFluidCooler" );
 				if ( SolFla == -1 ) {
 					ShowWarningError( "Iteration limit exceeded in calculating fluid cooler UA." );
 					ShowContinueError( "Autosizing of fluid cooler UA failed for fluid cooler = " + SimpleFluidCooler( FluidCoolerNum ).Name );
@@ -274,6 +274,11 @@ namespace FluidCoolers {
 	extern Array1D< ReportVars > SimpleFluidCoolerReport; // report variables
 
 	// Functions
+
+	// Clears the global data in FluidCoolers.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
 	bool
 	TestFluidCoolerSingleSpeedInputForDesign(
 		std::string const & cCurrentModuleObject,
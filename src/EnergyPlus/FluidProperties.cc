@@ -69,6 +69,7 @@
 // EnergyPlus Headers
 #include <FluidProperties.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
 #include <UtilityRoutines.hh>
@@ -142,6 +143,8 @@ namespace FluidProperties {
 	int const PropyleneGlycolIndex( -1 );
 	int const iRefrig( 1 );
 	int const iGlycol( 1 );
+	int const NumSHTempTablePress( 101 ); // Pressure points of the superheated temperature tables
+	int const NumSHTempTableEnth( 201 ); // Enthalpy points of the superheated temperature tables
 
 	// DERIVED TYPE DEFINITIONS
 
@@ -174,6 +177,29 @@ namespace FluidProperties {
 	// Data Initializer Forward Declarations
 	// See GetFluidPropertiesData "SUBROUTINE LOCAL DATA" for actual data.
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetFluidPropertiesDataErrorsFound( false );
+		int SatErrCount( 0 );
+		int GetSupHeatDensityRefrigSatErrCount( 0 );
+		int HighTempLimitErr( 0 );
+		int LowTempLimitErr( 0 );
+		int GetDensityGlycolHighTempLimitErr( 0 );
+		int GetDensityGlycolLowTempLimitErr( 0 );
+		int GetConductivityGlycolHighTempLimitErr( 0 );
+		int GetConductivityGlycolLowTempLimitErr( 0 );
+		int GetViscosityGlycolHighTempLimitErr( 0 );
+		int GetViscosityGlycolLowTempLimitErr( 0 );
+		int TempLoRangeErrIndex( 0 );
+		int TempHiRangeErrIndex( 0 );
+		int TempRangeErrCount( 0 ); // cumulative error counter
+		int TempRangeErrIndex( 0 );
+	}
+
 	void
 	clear_state()
 	{
@@ -194,6 +220,21 @@ namespace FluidProperties {
 		GlyRawData.deallocate();
 		GlycolData.deallocate();
 		GlycolErrorTracking.deallocate();
+		GetFluidPropertiesDataErrorsFound = false;
+		SatErrCount = 0;
+		GetSupHeatDensityRefrigSatErrCount = 0;
+		HighTempLimitErr = 0;
+		LowTempLimitErr = 0;
+		GetDensityGlycolHighTempLimitErr = 0;
+		GetDensityGlycolLowTempLimitErr = 0;
+		GetConductivityGlycolHighTempLimitErr = 0;
+		GetConductivityGlycolLowTempLimitErr = 0;
+		GetViscosityGlycolHighTempLimitErr = 0;
+		GetViscosityGlycolLowTempLimitErr = 0;
+		TempLoRangeErrIndex = 0;
+		TempHiRangeErrIndex = 0;
+		TempRangeErrCount = 0;
+		TempRangeErrIndex = 0;
 	}
 
 	void
@@ -323,7 +364,6 @@ namespace FluidProperties {
 		bool FirstSHMatch;
 		int NumOfPressPts;
 		int NumOfConcPts;
-		static bool ErrorsFound( false );
 		int Index;
 		int NumOfGlyConcs;
 		bool GlycolFound;
@@ -528,7 +568,7 @@ namespace FluidProperties {
 			VerifyName( Alphas( 1 ), FluidNames, FluidNum, ErrorInName, IsBlank, CurrentModuleObject + " Name" );
 			if ( ErrorInName ) {
 				ShowContinueError( "...Fluid names must be unique regardless of subtype." );
-				ErrorsFound = true;
+				GetFluidPropertiesDataErrorsFound = true;
 				continue;
 			}
 			++FluidNum;
@@ -542,11 +582,11 @@ namespace FluidProperties {
 			} else {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", invalid type" );
 				ShowContinueError( "...entered value=\"" + Alphas( 2 ) + ", Only REFRIGERANT or GLYCOL allowed as " + cAlphaFieldNames( 2 ) );
-				ErrorsFound = true;
+				GetFluidPropertiesDataErrorsFound = true;
 			}
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetFluidPropertiesDataErrorsFound ) {
 			ShowFatalError( RoutineName + " Previous errors in input cause program termination." );
 		}
 
@@ -637,7 +677,7 @@ namespace FluidProperties {
 				if ( FluidTemps( Loop ).Temps( TempLoop ) <= FluidTemps( Loop ).Temps( TempLoop - 1 ) ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + " name=" + FluidTemps( Loop ).Name + ", lists must have data in ascending order" );
 					ShowContinueError( "First out of order occurance at Temperature #(" + RoundSigDigits( TempLoop - 1 ) + ") {" + RoundSigDigits( FluidTemps( Loop ).Temps( TempLoop - 1 ), 3 ) + "} >= Temp(" + RoundSigDigits( TempLoop ) + ") {" + RoundSigDigits( FluidTemps( Loop ).Temps( TempLoop ), 3 ) + '}' );
-					ErrorsFound = true;
+					GetFluidPropertiesDataErrorsFound = true;
 					break;
 				}
 			}
@@ -679,7 +719,7 @@ namespace FluidProperties {
 								ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 								ShowContinueError( "Temperature Name=" + TempsName + ", Temperature array and fluid saturation pressure array must have the same number of points" );
 								ShowContinueError( "Temperature # points=" + RoundSigDigits( NumNumbers ) + " whereas " + RefrigData( Loop ).Name + " # pressure points=" + RoundSigDigits( RefrigData( Loop ).NumPsPoints ) );
-								ErrorsFound = true;
+								GetFluidPropertiesDataErrorsFound = true;
 								break; // the TempLoop DO Loop
 							}
 
@@ -696,7 +736,7 @@ namespace FluidProperties {
 							ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 							ShowContinueError( "Found saturated fluid gas/fluid pressure input but no matching temperature array" );
 							ShowContinueError( "Entered Temperature Name=" + TempsName );
-							ErrorsFound = true;
+							GetFluidPropertiesDataErrorsFound = true;
 						}
 
 					} // ...end of FluidTemps DO loop
@@ -710,7 +750,7 @@ namespace FluidProperties {
 				if ( InData == NumOfSatFluidPropArrays ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 					ShowContinueError( "No Gas/Fluid Saturation Pressure found. Need properties with " + cAlphaFieldNames( 2 ) + "=\"Pressure\" and " + cAlphaFieldNames( 3 ) + "=\"FluidGas\"." );
-					ErrorsFound = true;
+					GetFluidPropertiesDataErrorsFound = true;
 				}
 
 			} // ...end of DO loop through all of the input syntax trying to find saturation pressure for this refrigerant
@@ -739,7 +779,7 @@ namespace FluidProperties {
 								ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 								ShowSevereError( "Temperature Name=" + TempsName + ", Temperature array and saturated fluid enthalpy array must have the same number of points" );
 								ShowContinueError( "Temperature # points=" + RoundSigDigits( NumNumbers ) + " whereas " + RefrigData( Loop ).Name + " # points=" + RoundSigDigits( RefrigData( Loop ).NumHPoints ) );
-								ErrorsFound = true;
+								GetFluidPropertiesDataErrorsFound = true;
 								break; // the TempLoop DO Loop
 							}
 
@@ -756,7 +796,7 @@ namespace FluidProperties {
 							ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 							ShowContinueError( "Found saturated fluid enthalpy input but no matching temperature array" );
 							ShowContinueError( "Entered Temperature Name=" + TempsName );
-							ErrorsFound = true;
+							GetFluidPropertiesDataErrorsFound = true;
 						}
 
 					} // ...end of FluidTemps DO loop
@@ -769,7 +809,7 @@ namespace FluidProperties {
 				if ( InData == NumOfSatFluidPropArrays ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 					ShowContinueError( "No Saturated Fluid Enthalpy found. Need properties to be entered with " + cAlphaFieldNames( 2 ) + "=\"Enthalpy\" and " + cAlphaFieldNames( 3 ) + "=\"Fluid\"." );
-					ErrorsFound = true;
+					GetFluidPropertiesDataErrorsFound = true;
 				}
 
 			} // ...end of DO loop through all of the input syntax trying to find saturated fluid enthalpy for this refrigerant
@@ -789,7 +829,7 @@ namespace FluidProperties {
 								ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 								ShowContinueError( "Temperatures for enthalpy fluid and gas/fluid points are not the same" );
 								ShowContinueError( "Name=" + Alphas( 4 ) + " => " + FluidTemps( TempLoop ).Name + " /= " + TempsName );
-								ErrorsFound = true;
+								GetFluidPropertiesDataErrorsFound = true;
 								break;
 							}
 							// At this point, we have found the correct input line and found a match
@@ -801,7 +841,7 @@ namespace FluidProperties {
 								ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 								ShowContinueError( "Temperature Name=" + TempsName + ", Temperature array and saturated gas/fluid enthalpy array must have the same number of points" );
 								ShowContinueError( "Temperature # points=" + RoundSigDigits( NumNumbers ) + " whereas " + RefrigData( Loop ).Name + " # points=" + RoundSigDigits( RefrigData( Loop ).NumHPoints ) );
-								ErrorsFound = true;
+								GetFluidPropertiesDataErrorsFound = true;
 								break; // the TempLoop DO Loop
 							}
 
@@ -817,7 +857,7 @@ namespace FluidProperties {
 							ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 							ShowContinueError( "Found saturated gas/fluid enthalpy input but no matching temperature array" );
 							ShowContinueError( "Entered Temperature Name=" + TempsName );
-							ErrorsFound = true;
+							GetFluidPropertiesDataErrorsFound = true;
 						}
 
 					} // ...end of FluidTemps DO loop
@@ -830,7 +870,7 @@ namespace FluidProperties {
 				if ( InData == NumOfSatFluidPropArrays ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 					ShowContinueError( "No Saturated Gas/Fluid Enthalpy found. Need properties to be entered with " + cAlphaFieldNames( 2 ) + "=\"Enthalpy\" and " + cAlphaFieldNames( 3 ) + "=\"FluidGas\"." );
-					ErrorsFound = true;
+					GetFluidPropertiesDataErrorsFound = true;
 				}
 
 			} // ...end of DO loop through all of the input syntax trying to find saturated gas/fluid enthalpy for this refrigerant
@@ -859,7 +899,7 @@ namespace FluidProperties {
 								ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 								ShowSevereError( "Temperature Name=" + TempsName + ", Temperature array and saturated fluid Cp array must have the same number of points" );
 								ShowContinueError( "Temperature # points=" + RoundSigDigits( NumNumbers ) + " whereas " + RefrigData( Loop ).Name + " # Cp points=" + RoundSigDigits( RefrigData( Loop ).NumCpPoints ) );
-								ErrorsFound = true;
+								GetFluidPropertiesDataErrorsFound = true;
 								break; // the TempLoop DO Loop
 							}
 
@@ -876,7 +916,7 @@ namespace FluidProperties {
 							ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 							ShowContinueError( "Found saturated fluid specific heat (Cp) input but no matching temperature array" );
 							ShowContinueError( "Entered Temperature Name=" + TempsName );
-							ErrorsFound = true;
+							GetFluidPropertiesDataErrorsFound = true;
 						}
 
 					} // ...end of FluidTemps DO loop
@@ -889,7 +929,7 @@ namespace FluidProperties {
 				if ( InData == NumOfSatFluidPropArrays ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 					ShowContinueError( "No Saturated Fluid Specific Heat found. Need properties to be entered with " + cAlphaFieldNames( 2 ) + "=\"SpecificHeat\" and " + cAlphaFieldNames( 3 ) + "=\"Fluid\"." );
-					ErrorsFound = true;
+					GetFluidPropertiesDataErrorsFound = true;
 				}
 
 			} // ...end of DO loop through all of the input syntax trying to find saturated fluid Cp for this refrigerant
@@ -909,7 +949,7 @@ namespace FluidProperties {
 								ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 								ShowContinueError( "Temperatures for specific heat fluid and gas/fluid points are not the same" );
 								ShowContinueError( "Name=" + Alphas( 4 ) + " => " + FluidTemps( TempLoop ).Name + " /= " + TempsName );
-								ErrorsFound = true;
+								GetFluidPropertiesDataErrorsFound = true;
 								break;
 							}
 							// At this point, we have found the correct input line and found a match
@@ -921,7 +961,7 @@ namespace FluidProperties {
 								ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 								ShowContinueError( "Temperature Name=" + TempsName + ", Temperature array and saturated gas/fluid Cp array must have the same number of points" );
 								ShowContinueError( "Temperature # points=" + RoundSigDigits( NumNumbers ) + " whereas " + RefrigData( Loop ).Name + " # Cp points=" + RoundSigDigits( RefrigData( Loop ).NumCpPoints ) );
-								ErrorsFound = true;
+								GetFluidPropertiesDataErrorsFound = true;
 								break; // the TempLoop DO Loop
 							}
 
@@ -937,7 +977,7 @@ namespace FluidProperties {
 							ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 							ShowContinueError( "Found saturated gas/fluid specific heat (Cp) input but no matching temperature array" );
 							ShowContinueError( "Entered Temperature Name=" + TempsName );
-							ErrorsFound = true;
+							GetFluidPropertiesDataErrorsFound = true;
 						}
 
 					} // ...end of FluidTemps DO loop
@@ -950,7 +990,7 @@ namespace FluidProperties {
 				if ( InData == NumOfSatFluidPropArrays ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 					ShowContinueError( "No Saturated Gas/Fluid Specific Heat found. Need properties to be entered with " + cAlphaFieldNames( 2 ) + "=\"SpecificHeat\" and " + cAlphaFieldNames( 3 ) + "=\"FluidGas\"." );
-					ErrorsFound = true;
+					GetFluidPropertiesDataErrorsFound = true;
 				}
 
 			} // ...end of DO loop through all of the input syntax trying to find saturated gas/fluid Cp for this refrigerant
@@ -979,7 +1019,7 @@ namespace FluidProperties {
 								ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 								ShowContinueError( "Temperature Name=" + TempsName + ", Temperature array and saturated fluid density array must have the same number of points" );
 								ShowContinueError( "Temperature # points=" + RoundSigDigits( NumNumbers ) + " whereas " + RefrigData( Loop ).Name + " # Density points=" + RoundSigDigits( RefrigData( Loop ).NumRhoPoints ) );
-								ErrorsFound = true;
+								GetFluidPropertiesDataErrorsFound = true;
 								break; // the TempLoop DO Loop
 							}
 
@@ -996,7 +1036,7 @@ namespace FluidProperties {
 							ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 							ShowContinueError( "Found saturated fluid density input but no matching temperature array" );
 							ShowContinueError( "Entered Temperature Name=" + TempsName );
-							ErrorsFound = true;
+							GetFluidPropertiesDataErrorsFound = true;
 						}
 
 					} // ...end of FluidTemps DO loop
@@ -1009,7 +1049,7 @@ namespace FluidProperties {
 				if ( InData == NumOfSatFluidPropArrays ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 					ShowContinueError( "No Saturated Fluid Density found. Need properties to be entered with " + cAlphaFieldNames( 2 ) + "=\"Density\" and " + cAlphaFieldNames( 3 ) + "=\"Fluid\"." );
-					ErrorsFound = true;
+					GetFluidPropertiesDataErrorsFound = true;
 				}
 
 			} // ...end of DO loop through all of the input syntax trying to find saturated fluid enthalpy for this refrigerant
@@ -1029,7 +1069,7 @@ namespace FluidProperties {
 								ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 								ShowContinueError( "Temperatures for density fluid and gas/fluid points are not the same" );
 								ShowContinueError( "Name=" + Alphas( 4 ) + " => " + FluidTemps( TempLoop ).Name + " /= " + TempsName );
-								ErrorsFound = true;
+								GetFluidPropertiesDataErrorsFound = true;
 								break;
 							}
 							// At this point, we have found the correct input line and found a match
@@ -1041,7 +1081,7 @@ namespace FluidProperties {
 								ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 								ShowContinueError( "Temperature Name=" + TempsName + ", Temperature array and saturated gas/fluid density array must have the same number of points" );
 								ShowContinueError( "Temperature # points=" + RoundSigDigits( NumNumbers ) + " whereas " + RefrigData( Loop ).Name + " # density points=" + RoundSigDigits( RefrigData( Loop ).NumRhoPoints ) );
-								ErrorsFound = true;
+								GetFluidPropertiesDataErrorsFound = true;
 								break; // the TempLoop DO Loop
 							}
 
@@ -1057,7 +1097,7 @@ namespace FluidProperties {
 							ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 							ShowContinueError( "Found saturated gas/fluid density input but no matching temperature array" );
 							ShowContinueError( "Entered Temperature Name=" + TempsName );
-							ErrorsFound = true;
+							GetFluidPropertiesDataErrorsFound = true;
 						}
 
 					} // ...end of FluidTemps DO loop
@@ -1070,7 +1110,7 @@ namespace FluidProperties {
 				if ( InData == NumOfSatFluidPropArrays ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 					ShowSevereError( "No Saturated Gas/Fluid Density found. Need properties to be entered with " + cAlphaFieldNames( 2 ) + "=\"Density\" and " + cAlphaFieldNames( 3 ) + "=\"FluidGas\"." );
-					ErrorsFound = true;
+					GetFluidPropertiesDataErrorsFound = true;
 				}
 
 			} // ...end of DO loop through all of the input syntax trying to find saturated gas/fluid density for this refrigerant
@@ -1161,7 +1201,7 @@ namespace FluidProperties {
 							ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 							ShowContinueError( "All superheated data for the same property must use the same temperature list" );
 							ShowContinueError( "Expected name=" + TempsName + ", Entered name=" + Alphas( 3 ) );
-							ErrorsFound = true;
+							GetFluidPropertiesDataErrorsFound = true;
 						}
 					}
 				}
@@ -1169,7 +1209,7 @@ namespace FluidProperties {
 			if ( NumOfPressPts == 0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 				ShowContinueError( "No pressure data found for superheated enthalpy" );
-				ErrorsFound = true;
+				GetFluidPropertiesDataErrorsFound = true;
 			}
 
 			// Now allocate the arrays and read the data into the proper place
@@ -1185,7 +1225,7 @@ namespace FluidProperties {
 					ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 					ShowContinueError( "No match for temperature array name found with superheated enthalpy data" );
 					ShowContinueError( "Entered Temperature Name=" + TempsName );
-					ErrorsFound = true;
+					GetFluidPropertiesDataErrorsFound = true;
 				}
 			}
 
@@ -1206,7 +1246,7 @@ namespace FluidProperties {
 					if ( Numbers( 1 ) <= 0.0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 						ShowContinueError( "Negative pressures not allowed in fluid property input data, Value =[" + RoundSigDigits( Numbers( 1 ), 3 ) + "]." );
-						ErrorsFound = true;
+						GetFluidPropertiesDataErrorsFound = true;
 					}
 					PressurePtr( NumOfPressPts ).Pressure = Numbers( 1 );
 					PressurePtr( NumOfPressPts ).InPtr = InData;
@@ -1238,7 +1278,7 @@ namespace FluidProperties {
 						ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 						ShowContinueError( "Pressures must be entered in ascending order for fluid property data" );
 						ShowContinueError( "First Occurance at Pressure(" + RoundSigDigits( InData - 1 ) + ") {" + RoundSigDigits( RefrigData( Loop ).SHPress( InData - 1 ), 3 ) + "} >= Pressure(" + RoundSigDigits( InData ) + ") {" + RoundSigDigits( RefrigData( Loop ).SHPress( InData ), 3 ) + '}' );
-						ErrorsFound = true;
+						GetFluidPropertiesDataErrorsFound = true;
 						break;
 					}
 				}
@@ -1247,7 +1287,7 @@ namespace FluidProperties {
 				} else {
 					ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 					ShowContinueError( "Number of superheated enthalpy data points not equal to number of temperature points" );
-					ErrorsFound = true;
+					GetFluidPropertiesDataErrorsFound = true;
 				}
 			}
 
@@ -1268,7 +1308,7 @@ namespace FluidProperties {
 					if ( Numbers( 1 ) <= 0.0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 						ShowContinueError( "Negative pressures not allowed in fluid property input data, Value =[" + RoundSigDigits( Numbers( 1 ), 3 ) + "]." );
-						ErrorsFound = true;
+						GetFluidPropertiesDataErrorsFound = true;
 					}
 					PressurePtr( NumOfPressPts ).Pressure = Numbers( 1 );
 					PressurePtr( NumOfPressPts ).InPtr = InData;
@@ -1296,19 +1336,19 @@ namespace FluidProperties {
 				if ( std::abs( Numbers( 1 ) - RefrigData( Loop ).SHPress( InData ) ) > PressToler ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 					ShowContinueError( "All superheated data for the same refrigerant must use the same pressure data" );
-					ErrorsFound = true;
+					GetFluidPropertiesDataErrorsFound = true;
 				}
 				if ( ! SameString( TempsName, Alphas( 3 ) ) ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 					ShowContinueError( "All superheated data for the same property must use the same temperature list" );
-					ErrorsFound = true;
+					GetFluidPropertiesDataErrorsFound = true;
 				}
 				if ( ( NumNumbers - 1 ) == RefrigData( Loop ).NumSuperTempPts ) {
 					RefrigData( Loop ).RhoshValues( InData, {1,RefrigData( Loop ).NumSuperTempPts} ) = Numbers( {2,NumNumbers} );
 				} else {
 					ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 					ShowContinueError( "Number of superheated density data points not equal to number of temperature points" );
-					ErrorsFound = true;
+					GetFluidPropertiesDataErrorsFound = true;
 				}
 			}
 
@@ -1339,12 +1379,12 @@ namespace FluidProperties {
 			if ( NumOfPressPts == 0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 				ShowSevereError( "No pressure data found for superheated density" );
-				ErrorsFound = true;
+				GetFluidPropertiesDataErrorsFound = true;
 			}
 			if ( NumOfPressPts != RefrigData( Loop ).NumSuperPressPts ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + RefrigData( Loop ).Name );
 				ShowSevereError( "Number of pressure points for superheated data different for enthalpy and density" );
-				ErrorsFound = true;
+				GetFluidPropertiesDataErrorsFound = true;
 			}
 
 		} // ...end of DO loop through all of the refrigerants
@@ -1375,7 +1415,7 @@ namespace FluidProperties {
 							ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + GlyRawData( Loop ).Name );
 							ShowContinueError( "All glycol specific heat data for the same glycol must use the same temperature list" );
 							ShowContinueError( "Expected name=" + TempsName + ", Entered name=" + Alphas( 3 ) );
-							ErrorsFound = true;
+							GetFluidPropertiesDataErrorsFound = true;
 						}
 					}
 				}
@@ -1394,7 +1434,7 @@ namespace FluidProperties {
 					if ( TempLoop == NumOfFluidTempArrays ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + GlyRawData( Loop ).Name );
 						ShowContinueError( "No match for temperature array name found with glycol data" );
-						ErrorsFound = true;
+						GetFluidPropertiesDataErrorsFound = true;
 					}
 				}
 
@@ -1416,13 +1456,13 @@ namespace FluidProperties {
 							if ( GlyRawData( Loop ).CpConcs( NumOfConcPts ) < 0.0 ) {
 								ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + GlyRawData( Loop ).Name );
 								ShowContinueError( "Negative concentrations not allowed in fluid property input data" );
-								ErrorsFound = true;
+								GetFluidPropertiesDataErrorsFound = true;
 							}
 						} else {
 							if ( GlyRawData( Loop ).CpConcs( NumOfConcPts ) <= GlyRawData( Loop ).CpConcs( NumOfConcPts - 1 ) ) {
 								ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + GlyRawData( Loop ).Name );
 								ShowContinueError( "Concentrations must be entered in ascending order for fluid property data" );
-								ErrorsFound = true;
+								GetFluidPropertiesDataErrorsFound = true;
 							}
 						}
 						if ( ( NumNumbers - 1 ) == GlyRawData( Loop ).NumCpTempPts ) {
@@ -1430,7 +1470,7 @@ namespace FluidProperties {
 						} else {
 							ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + GlyRawData( Loop ).Name );
 							ShowContinueError( "Number of specific heat data points not equal to number of temperature points" );
-							ErrorsFound = true;
+							GetFluidPropertiesDataErrorsFound = true;
 						}
 					}
 				}
@@ -1455,7 +1495,7 @@ namespace FluidProperties {
 							ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + GlyRawData( Loop ).Name );
 							ShowContinueError( "All glycol density data for the same glycol must use the same temperature list" );
 							ShowContinueError( "Expected name=" + TempsName + ", Entered name=" + Alphas( 3 ) );
-							ErrorsFound = true;
+							GetFluidPropertiesDataErrorsFound = true;
 						}
 					}
 				}
@@ -1474,7 +1514,7 @@ namespace FluidProperties {
 					if ( TempLoop == NumOfFluidTempArrays ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + GlyRawData( Loop ).Name );
 						ShowContinueError( "No match for temperature array name found with glycol data" );
-						ErrorsFound = true;
+						GetFluidPropertiesDataErrorsFound = true;
 					}
 				}
 
@@ -1496,13 +1536,13 @@ namespace FluidProperties {
 							if ( GlyRawData( Loop ).RhoConcs( NumOfConcPts ) < 0.0 ) {
 								ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + GlyRawData( Loop ).Name );
 								ShowContinueError( "Negative concentrations not allowed in fluid property input data" );
-								ErrorsFound = true;
+								GetFluidPropertiesDataErrorsFound = true;
 							}
 						} else {
 							if ( GlyRawData( Loop ).RhoConcs( NumOfConcPts ) <= GlyRawData( Loop ).RhoConcs( NumOfConcPts - 1 ) ) {
 								ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + GlyRawData( Loop ).Name );
 								ShowContinueError( "Concentrations must be entered in ascending order for fluid property data" );
-								ErrorsFound = true;
+								GetFluidPropertiesDataErrorsFound = true;
 							}
 						}
 						if ( ( NumNumbers - 1 ) == GlyRawData( Loop ).NumRhoTempPts ) {
@@ -1510,7 +1550,7 @@ namespace FluidProperties {
 						} else {
 							ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + GlyRawData( Loop ).Name );
 							ShowContinueError( "Number of density data points not equal to number of temperature points" );
-							ErrorsFound = true;
+							GetFluidPropertiesDataErrorsFound = true;
 						}
 					}
 				}
@@ -1535,7 +1575,7 @@ namespace FluidProperties {
 							ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + GlyRawData( Loop ).Name );
 							ShowContinueError( "All glycol conductivity data for the same glycol must use the same temperature list" );
 							ShowContinueError( "Expected name=" + TempsName + ", Entered name=" + Alphas( 3 ) );
-							ErrorsFound = true;
+							GetFluidPropertiesDataErrorsFound = true;
 						}
 					}
 				}
@@ -1554,7 +1594,7 @@ namespace FluidProperties {
 					if ( TempLoop == NumOfFluidTempArrays ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + GlyRawData( Loop ).Name );
 						ShowContinueError( "No match for temperature array name found with glycol data" );
-						ErrorsFound = true;
+						GetFluidPropertiesDataErrorsFound = true;
 					}
 				}
 
@@ -1576,13 +1616,13 @@ namespace FluidProperties {
 							if ( GlyRawData( Loop ).CondConcs( NumOfConcPts ) < 0.0 ) {
 								ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + GlyRawData( Loop ).Name );
 								ShowContinueError( "Negative concentrations not allowed in fluid property input data" );
-								ErrorsFound = true;
+								GetFluidPropertiesDataErrorsFound = true;
 							}
 						} else {
 							if ( GlyRawData( Loop ).CondConcs( NumOfConcPts ) <= GlyRawData( Loop ).CondConcs( NumOfConcPts - 1 ) ) {
 								ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + GlyRawData( Loop ).Name );
 								ShowContinueError( "Concentrations must be entered in ascending order for fluid property data" );
-								ErrorsFound = true;
+								GetFluidPropertiesDataErrorsFound = true;
 							}
 						}
 						if ( ( NumNumbers - 1 ) == GlyRawData( Loop ).NumCondTempPts ) {
@@ -1590,7 +1630,7 @@ namespace FluidProperties {
 						} else {
 							ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + GlyRawData( Loop ).Name );
 							ShowContinueError( "Number of conductivity data points not equal to number of temperature points" );
-							ErrorsFound = true;
+							GetFluidPropertiesDataErrorsFound = true;
 						}
 					}
 				}
@@ -1615,7 +1655,7 @@ namespace FluidProperties {
 							ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + GlyRawData( Loop ).Name );
 							ShowContinueError( "All glycol viscosity data for the same glycol must use the same temperature list" );
 							ShowContinueError( "Expected name=" + TempsName + ", Entered name=" + Alphas( 3 ) );
-							ErrorsFound = true;
+							GetFluidPropertiesDataErrorsFound = true;
 						}
 					}
 				}
@@ -1634,7 +1674,7 @@ namespace FluidProperties {
 					if ( TempLoop == NumOfFluidTempArrays ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + GlyRawData( Loop ).Name );
 						ShowContinueError( "No match for temperature array name found with glycol data" );
-						ErrorsFound = true;
+						GetFluidPropertiesDataErrorsFound = true;
 					}
 				}
 
@@ -1656,13 +1696,13 @@ namespace FluidProperties {
 							if ( GlyRawData( Loop ).ViscConcs( NumOfConcPts ) < 0.0 ) {
 								ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + GlyRawData( Loop ).Name );
 								ShowContinueError( "Negative concentrations not allowed in fluid property input data" );
-								ErrorsFound = true;
+								GetFluidPropertiesDataErrorsFound = true;
 							}
 						} else {
 							if ( GlyRawData( Loop ).ViscConcs( NumOfConcPts ) <= GlyRawData( Loop ).ViscConcs( NumOfConcPts - 1 ) ) {
 								ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + GlyRawData( Loop ).Name );
 								ShowContinueError( "Concentrations must be entered in ascending order for fluid property data" );
-								ErrorsFound = true;
+								GetFluidPropertiesDataErrorsFound = true;
 							}
 						}
 						if ( ( NumNumbers - 1 ) == GlyRawData( Loop ).NumViscTempPts ) {
@@ -1670,7 +1710,7 @@ namespace FluidProperties {
 						} else {
 							ShowSevereError( RoutineName + CurrentModuleObject + " Name=" + GlyRawData( Loop ).Name );
 							ShowContinueError( "Number of viscosity data points not equal to number of temperature points" );
-							ErrorsFound = true;
+							GetFluidPropertiesDataErrorsFound = true;
 						}
 					}
 				}
@@ -1753,7 +1793,7 @@ namespace FluidProperties {
 			VerifyName( Alphas( 1 ), GlycolData, NumOfGlyConcs, ErrorInName, IsBlank, CurrentModuleObject + " Name" );
 			if ( ErrorInName ) {
 				ShowContinueError( "...Fluid names must be unique regardless of subtype." );
-				ErrorsFound = true;
+				GetFluidPropertiesDataErrorsFound = true;
 				continue;
 			}
 			GlycolFound = false;
@@ -1781,13 +1821,13 @@ namespace FluidProperties {
 				} else {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", invalid reference" );
 					ShowContinueError( "... not found in the FluidProperties:Name list: \"" + Alphas( 3 ) + "\"." );
-					ErrorsFound = true;
+					GetFluidPropertiesDataErrorsFound = true;
 				}
 			} else {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", invalid field" );
 				ShowContinueError( "..." + cAlphaFieldNames( 2 ) + "=\"" + Alphas( 2 ) + "\"." );
 				ShowContinueError( "... Legal values are PropoleneGlycol, EthyleneGlycol or UserDefinedGlycolType." );
-				ErrorsFound = true;
+				GetFluidPropertiesDataErrorsFound = true;
 			}
 			if ( ! GlycolFound ) continue;
 			GlycolData( NumOfGlyConcs ).Concentration = Numbers( 1 );
@@ -1862,7 +1902,7 @@ namespace FluidProperties {
 					ShowContinueError( "ALL data must be entered for user-defined glycols" );
 					ShowContinueError( "Glycol mixture name = " + GlycolData( Loop ).Name );
 					ShowContinueError( "Glycol fluid name = " + GlycolData( Loop ).GlycolName );
-					ErrorsFound = true;
+					GetFluidPropertiesDataErrorsFound = true;
 				}
 
 				// Density data:
@@ -1878,7 +1918,7 @@ namespace FluidProperties {
 					ShowContinueError( "ALL data must be entered for user-defined glycols" );
 					ShowContinueError( "Glycol mixture name = " + GlycolData( Loop ).Name );
 					ShowContinueError( "Glycol fluid name = " + GlycolData( Loop ).GlycolName );
-					ErrorsFound = true;
+					GetFluidPropertiesDataErrorsFound = true;
 				}
 
 				// Conductivity data:
@@ -1894,7 +1934,7 @@ namespace FluidProperties {
 					ShowContinueError( "ALL data must be entered for user-defined glycols" );
 					ShowContinueError( "Glycol mixture name = " + GlycolData( Loop ).Name );
 					ShowContinueError( "Glycol fluid name = " + GlycolData( Loop ).GlycolName );
-					ErrorsFound = true;
+					GetFluidPropertiesDataErrorsFound = true;
 				}
 
 				// Viscosity data:
@@ -1910,7 +1950,7 @@ namespace FluidProperties {
 					ShowContinueError( "ALL data must be entered for user-defined glycols" );
 					ShowContinueError( "Glycol mixture name = " + GlycolData( Loop ).Name );
 					ShowContinueError( "Glycol fluid name = " + GlycolData( Loop ).GlycolName );
-					ErrorsFound = true;
+					GetFluidPropertiesDataErrorsFound = true;
 				}
 
 			}
@@ -1921,9 +1961,9 @@ namespace FluidProperties {
 		GlycolErrorTracking.allocate( NumOfGlycols );
 		for ( std::size_t i = 0; i < GlycolErrorTracking.size(); ++i ) GlycolErrorTracking[ i ].Name = GlycolData[ i ].Name;
 
-		if ( ! ErrorsFound ) InitializeGlycolTempLimits( ErrorsFound ); // Initialize the Temp limits for the glycols
+		if ( ! GetFluidPropertiesDataErrorsFound ) InitializeGlycolTempLimits( GetFluidPropertiesDataErrorsFound ); // Initialize the Temp limits for the glycols
 
-		if ( ! ErrorsFound ) InitializeRefrigerantLimits( ErrorsFound ); // Initialize the limits for the refrigerants
+		if ( ! GetFluidPropertiesDataErrorsFound ) InitializeRefrigerantLimits( GetFluidPropertiesDataErrorsFound ); // Initialize the limits for the refrigerants
 
 		FluidTemps.deallocate();
 
@@ -1934,7 +1974,7 @@ namespace FluidProperties {
 		cNumericFieldNames.deallocate();
 		lNumericFieldBlanks.deallocate();
 
-		if ( ErrorsFound ) {
+		if ( GetFluidPropertiesDataErrorsFound ) {
 			ShowFatalError( RoutineName + "Previous errors in input cause program termination." );
 		}
 
@@ -2696,6 +2736,11 @@ namespace FluidProperties {
 				ShowSevereError( "InitializeGlycolTempLimits: Required values for Glycol=" + GlycolData( GlycolNum ).Name + " are all zeroes for some data types." );
 				ErrorsFound = true;
 			}
+			// Evenly spaced temperature lists (all of the default glycol data) are searched by index arithmetic
+			if ( GlycolData( GlycolNum ).CpDataPresent ) GlycolData( GlycolNum ).CpTempStepInv = EvenSpacingInverse( GlycolData( GlycolNum ).CpTemps );
+			if ( GlycolData( GlycolNum ).RhoDataPresent ) GlycolData( GlycolNum ).RhoTempStepInv = EvenSpacingInverse( GlycolData( GlycolNum ).RhoTemps );
+			if ( GlycolData( GlycolNum ).CondDataPresent ) GlycolData( GlycolNum ).CondTempStepInv = EvenSpacingInverse( GlycolData( GlycolNum ).CondTemps );
+			if ( GlycolData( GlycolNum ).ViscDataPresent ) GlycolData( GlycolNum ).ViscTempStepInv = EvenSpacingInverse( GlycolData( GlycolNum ).ViscTemps );
 		}
 
 	}
@@ -3509,10 +3554,10 @@ namespace FluidProperties {
 			}
 			RefrigIndex = RefrigNum;
 		}
-		auto const & refrig( RefrigData( RefrigNum ) );
+		auto & refrig( RefrigData( RefrigNum ) );
 
 		// determine array indices for
-		LoTempIndex = FindArrayIndex( Temperature, refrig.PsTemps, refrig.PsLowTempIndex, refrig.PsHighTempIndex );
+		LoTempIndex = FindArrayIndex( Temperature, refrig.PsTemps, refrig.PsLowTempIndex, refrig.PsHighTempIndex, refrig.PsTempIndexHint );
 		HiTempIndex = LoTempIndex + 1;
 
 		// check for out of data bounds problems
@@ -3553,7 +3598,8 @@ namespace FluidProperties {
 		std::string const & Refrigerant, // carries in substance name
 		Real64 const Pressure, // actual temperature given as input
 		int & RefrigIndex, // Index to Refrigerant Properties
-		std::string const & CalledFrom // routine this function was called from (error messages)
+		std::string const & CalledFrom, // routine this function was called from (error messages)
+		bool const SuppressWarnings // if calling function is evaluating points at the edges of the data
 	)
 	{
 
@@ -3622,10 +3668,10 @@ namespace FluidProperties {
 			}
 			RefrigIndex = RefrigNum;
 		}
-		auto const & refrig( RefrigData( RefrigNum ) );
+		auto & refrig( RefrigData( RefrigNum ) );
 
 		// get the array indices
-		LoPresIndex = FindArrayIndex( Pressure, refrig.PsValues, refrig.PsLowPresIndex, refrig.PsHighPresIndex );
+		LoPresIndex = FindArrayIndex( Pressure, refrig.PsValues, refrig.PsLowPresIndex, refrig.PsHighPresIndex, refrig.PsPresIndexHint );
 		HiPresIndex = LoPresIndex + 1;
 
 		// check for out of data bounds problems
@@ -3643,7 +3689,7 @@ namespace FluidProperties {
 			ReturnValue = refrig.PsTemps( LoPresIndex ) + PresInterpRatio * ( refrig.PsTemps( HiPresIndex ) - refrig.PsTemps( LoPresIndex ) );
 		}
 
-		if ( ! WarmupFlag && ErrorFlag ) {
+		if ( ! WarmupFlag && ! SuppressWarnings && ErrorFlag ) {
 			++RefrigErrorTracking( RefrigNum ).SatPressErrCount;
 			// send warning
 			if ( RefrigErrorTracking( RefrigNum ).SatPressErrCount <= RefrigerantErrorLimitTest ) {
@@ -3735,10 +3781,10 @@ namespace FluidProperties {
 			}
 			RefrigIndex = RefrigNum;
 		}
-		auto const & refrig( RefrigData( RefrigNum ) );
+		auto & refrig( RefrigData( RefrigNum ) );
 
 		// Apply linear interpolation function
-		return GetInterpolatedSatProp( Temperature, refrig.HTemps, refrig.HfValues, refrig.HfgValues, Quality, CalledFrom, refrig.HfLowTempIndex, refrig.HfHighTempIndex );
+		return GetInterpolatedSatProp( Temperature, refrig.HTemps, refrig.HfValues, refrig.HfgValues, Quality, CalledFrom, refrig.HfLowTempIndex, refrig.HfHighTempIndex, refrig.HTempIndexHint );
 
 	}
 
@@ -3831,11 +3877,11 @@ namespace FluidProperties {
 			}
 			RefrigIndex = RefrigNum;
 		}
-		auto const & refrig( RefrigData( RefrigNum ) );
+		auto & refrig( RefrigData( RefrigNum ) );
 
 		ErrorFlag = false;
 
-		LoTempIndex = FindArrayIndex( Temperature, refrig.RhoTemps, refrig.RhofLowTempIndex, refrig.RhofHighTempIndex );
+		LoTempIndex = FindArrayIndex( Temperature, refrig.RhoTemps, refrig.RhofLowTempIndex, refrig.RhofHighTempIndex, refrig.RhoTempIndexHint );
 		HiTempIndex = LoTempIndex + 1;
 
 		//Error check to make sure the temperature is not out of bounds
@@ -3965,10 +4011,10 @@ namespace FluidProperties {
 			}
 			RefrigIndex = RefrigNum;
 		}
-		auto const & refrig( RefrigData( RefrigNum ) );
+		auto & refrig( RefrigData( RefrigNum ) );
 
 		// Apply linear interpolation function
-		ReturnValue = GetInterpolatedSatProp( Temperature, refrig.CpTemps, refrig.CpfValues, refrig.CpfgValues, Quality, CalledFrom, refrig.CpfLowTempIndex, refrig.CpfHighTempIndex );
+		ReturnValue = GetInterpolatedSatProp( Temperature, refrig.CpTemps, refrig.CpfValues, refrig.CpfgValues, Quality, CalledFrom, refrig.CpfLowTempIndex, refrig.CpfHighTempIndex, refrig.CpTempIndexHint );
 
 		return ReturnValue;
 
@@ -3982,7 +4028,8 @@ namespace FluidProperties {
 		Real64 const Temperature, // actual temperature given as input
 		Real64 const Pressure, // actual pressure given as input
 		int & RefrigIndex, // Index to Refrigerant Properties
-		std::string const & CalledFrom // routine this function was called from (error messages)
+		std::string const & CalledFrom, // routine this function was called from (error messages)
+		bool const SuppressWarnings // if calling function is evaluating points at the edges of the data
 	)
 	{
 
@@ -4052,7 +4099,6 @@ namespace FluidProperties {
 		int ErrCount; // error counter for current call
 		int CurTempRangeErrCount; // error counter for current call
 		int CurPresRangeErrCount; // error counter for current call
-		static int SatErrCount( 0 );
 
 		// see if data is there
 		if ( GetInput ) {
@@ -4082,10 +4128,10 @@ namespace FluidProperties {
 			}
 			RefrigIndex = RefrigNum;
 		}
-		auto const & refrig( RefrigData( RefrigNum ) );
+		auto & refrig( RefrigData( RefrigNum ) );
 
-		TempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts );
-		LoPressIndex = FindArrayIndex( Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts );
+		TempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts, refrig.SHTempIndexHint );
+		LoPressIndex = FindArrayIndex( Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts, refrig.SHPressIndexHint );
 
 		// check temperature data range and attempt to cap if necessary
 		if ( ( TempIndex > 0 ) && ( TempIndex < refrig.NumSuperTempPts ) ) { // in range
@@ -4159,7 +4205,7 @@ namespace FluidProperties {
 			// set return value
 			ReturnValue = GetSatEnthalpyRefrig( Refrigerant, Temperature, 1.0, RefrigNum, RoutineNameNoSpace + CalledFrom );
 			// send warning
-			if ( ! WarmupFlag ) {
+			if ( ! WarmupFlag && ! SuppressWarnings ) {
 				RefrigErrorTracking( RefrigNum ).SatSupEnthalpyErrCount += SatErrCount;
 				// send warning
 				if ( RefrigErrorTracking( RefrigNum ).SatTempDensityErrCount <= RefrigerantErrorLimitTest ) {
@@ -4175,7 +4221,7 @@ namespace FluidProperties {
 			return ReturnValue;
 		}
 
-		if ( ! WarmupFlag ) {
+		if ( ! WarmupFlag && ! SuppressWarnings ) {
 			// some checks...
 			if ( ErrCount > 0 ) {
 				// send temp range error if flagged
@@ -4325,9 +4371,9 @@ namespace FluidProperties {
 			}
 			RefrigIndex = RefrigNum;
 		}
-		auto const & refrig( RefrigData( RefrigNum ) );
+		auto & refrig( RefrigData( RefrigNum ) );
 
-		LoTempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts );
+		LoTempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts, refrig.SHTempIndexHint );
 		HiTempIndex = LoTempIndex + 1;
 
 		// check temperature data range and attempt to cap if necessary
@@ -4508,9 +4554,12 @@ namespace FluidProperties {
 
 		// METHODOLOGY EMPLOYED:
 		// Perform iterations to identify the temperature by calling GetSupHeatEnthalpyRefrig.
+		// If RefrigTablesEnvFlag is set, the temperature is interpolated instead from a table of
+		// converged solutions at regularly spaced pressures and enthalpies (see SetupSupHeatTempTable).
 
 		// USE STATEMENTS:
 		using General::SolveRegulaFalsi;
+		using DataSystemVariables::RefrigTablesEnvFlag;
 
 		// Return value
 		Real64 ReturnValue;
@@ -4550,7 +4599,7 @@ namespace FluidProperties {
 			}
 			RefrigIndex = RefrigNum;
 		}
-		auto const & refrig( RefrigData( RefrigNum ) );
+		auto & refrig( RefrigData( RefrigNum ) );
 
 		// check temperature data range and attempt to cap if necessary
 		RefTHigh = refrig.PsHighTempValue;
@@ -4575,7 +4624,27 @@ namespace FluidProperties {
 			TempLow = RefTSat;
 			TempUp = RefTHigh;
 		}
-		
+
+		if ( RefrigTablesEnvFlag ) {
+			if ( ! refrig.SHTempTableBuilt ) SetupSupHeatTempTable( RefrigNum );
+			if ( Pressure >= refrig.SHTempTablePressLow && Pressure <= refrig.SHTempTablePressHigh ) {
+				// Interpolate linearly in pressure the enthalpy range and then the temperatures at the
+				// fraction of that range given by the enthalpy
+				Real64 const PressPos( ( Pressure - refrig.SHTempTablePressLow ) * refrig.SHTempTablePressStepInv );
+				int const LoPress( min( int( PressPos ), NumSHTempTablePress - 2 ) + 1 );
+				Real64 const PressRatio( PressPos - ( LoPress - 1 ) );
+				Real64 const EnthSat( refrig.SHTempTableEnthSat( LoPress ) + PressRatio * ( refrig.SHTempTableEnthSat( LoPress + 1 ) - refrig.SHTempTableEnthSat( LoPress ) ) );
+				Real64 const EnthHigh( refrig.SHTempTableEnthHigh( LoPress ) + PressRatio * ( refrig.SHTempTableEnthHigh( LoPress + 1 ) - refrig.SHTempTableEnthHigh( LoPress ) ) );
+				Real64 const EnthPos( max( 0.0, min( ( Enthalpy - EnthSat ) / ( EnthHigh - EnthSat ), 1.0 ) ) * ( NumSHTempTableEnth - 1 ) );
+				int const LoEnth( min( int( EnthPos ), NumSHTempTableEnth - 2 ) + 1 );
+				Real64 const EnthRatio( EnthPos - ( LoEnth - 1 ) );
+				Real64 const TempLoPress( refrig.SHTempTableValues( LoPress, LoEnth ) + EnthRatio * ( refrig.SHTempTableValues( LoPress, LoEnth + 1 ) - refrig.SHTempTableValues( LoPress, LoEnth ) ) );
+				Real64 const TempHiPress( refrig.SHTempTableValues( LoPress + 1, LoEnth ) + EnthRatio * ( refrig.SHTempTableValues( LoPress + 1, LoEnth + 1 ) - refrig.SHTempTableValues( LoPress + 1, LoEnth ) ) );
+				ReturnValue = max( TempLow, min( TempLoPress + PressRatio * ( TempHiPress - TempLoPress ), TempUp ) );
+				return ReturnValue;
+			}
+		}
+
 		// check enthalpy data range and attempt to cap if necessary
 		EnthalpyLow = GetSupHeatEnthalpyRefrig( Refrigerant, TempLow, Pressure, RefrigNum, RoutineNameNoSpace + CalledFrom );
 		EnthalpyHigh = GetSupHeatEnthalpyRefrig( Refrigerant, TempUp, Pressure, RefrigNum, RoutineNameNoSpace + CalledFrom );
@@ -4598,15 +4667,87 @@ namespace FluidProperties {
 			Par( 1 ) = RefrigNum;
 			Par( 2 ) = Enthalpy;
 			Par( 3 ) = Pressure;
+			Par( 4 ) = 0.0; // report warnings
 			
-			SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, Temp, GetSupHeatTempRefrigResidual, TempLow, TempUp, Par );
+			SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, Temp, GetSupHeatTempRefrigResidual, TempLow, TempUp, Par, "GetSupHeatTempRefrig" );
 			ReturnValue = Temp;
 		}
 
 		return ReturnValue;
 
 	}
-	
+
+	void
+	SetupSupHeatTempTable( int const RefrigNum ) // index for refrigerant under consideration
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Tabulates the superheated refrigerant temperature as a function of pressure and enthalpy,
+		// so that GetSupHeatTempRefrig can interpolate it instead of iterating on the enthalpy.
+
+		// METHODOLOGY EMPLOYED:
+		// The pressures are spaced evenly over the range covered by both the saturation and the
+		// superheated data. At each of them the enthalpy range from saturated vapor to the highest
+		// saturation temperature is divided evenly, and the temperature of each point is found with
+		// the same residual as GetSupHeatTempRefrig at a tighter tolerance. Normalizing the enthalpy
+		// by its range at each pressure keeps the saturation line on a grid line of the table.
+
+		// USE STATEMENTS:
+		using General::SolveRegulaFalsi;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const RoutineName( "SetupSupHeatTempTable" );
+		Real64 const ErrorTol( 1.0e-9 ); // tolerance for RegulaFalsi iterations
+		int const MaxIte( 500 ); // maximum number of iterations
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Array1D< Real64 > Par( 4 ); // Parameters passed to RegulaFalsi
+		int SolFla; // Flag of RegulaFalsi solver
+		Real64 Temp; // Temperature of the superheated refrigerant at the table point
+		int RefrigIndex( RefrigNum ); // Index to Refrigerant Properties
+
+		auto & refrig( RefrigData( RefrigNum ) );
+		std::string const & Refrigerant( RefrigErrorTracking( RefrigNum ).Name );
+		refrig.SHTempTableBuilt = true;
+		refrig.SHTempTablePressLow = max( refrig.PsLowPresValue, refrig.SHPress( 1 ) );
+		refrig.SHTempTablePressHigh = min( refrig.PsHighPresValue, refrig.SHPress( refrig.NumSuperPressPts ) );
+		if ( refrig.SHTempTablePressHigh <= refrig.SHTempTablePressLow ) return; // no table, always iterate
+		refrig.SHTempTablePressStepInv = ( NumSHTempTablePress - 1 ) / ( refrig.SHTempTablePressHigh - refrig.SHTempTablePressLow );
+		refrig.SHTempTableEnthSat.allocate( NumSHTempTablePress );
+		refrig.SHTempTableEnthHigh.allocate( NumSHTempTablePress );
+		refrig.SHTempTableValues.allocate( NumSHTempTablePress, NumSHTempTableEnth );
+
+		// The table points reach the edges of the data, which are not reported as warnings
+		bool const SuppressWarnings( true );
+
+		Real64 const THigh( refrig.PsHighTempValue );
+		for ( int i = 1; i <= NumSHTempTablePress; ++i ) {
+			Real64 const Pressure( refrig.SHTempTablePressLow + ( i - 1 ) / refrig.SHTempTablePressStepInv );
+			Real64 const TSat( GetSatTemperatureRefrig( Refrigerant, Pressure, RefrigIndex, RoutineName, SuppressWarnings ) );
+			Real64 const EnthSat( GetSupHeatEnthalpyRefrig( Refrigerant, TSat, Pressure, RefrigIndex, RoutineName, SuppressWarnings ) );
+			Real64 const EnthHigh( GetSupHeatEnthalpyRefrig( Refrigerant, THigh, Pressure, RefrigIndex, RoutineName, SuppressWarnings ) );
+			refrig.SHTempTableEnthSat( i ) = EnthSat;
+			refrig.SHTempTableEnthHigh( i ) = EnthHigh;
+			refrig.SHTempTableValues( i, 1 ) = TSat;
+			refrig.SHTempTableValues( i, NumSHTempTableEnth ) = THigh;
+			Par( 1 ) = RefrigNum;
+			Par( 3 ) = Pressure;
+			Par( 4 ) = 1.0; // suppress warnings
+			for ( int j = 2; j < NumSHTempTableEnth; ++j ) {
+				Real64 const EnthFrac( Real64( j - 1 ) / ( NumSHTempTableEnth - 1 ) );
+				Par( 2 ) = EnthSat + EnthFrac * ( EnthHigh - EnthSat );
+				SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, Temp, GetSupHeatTempRefrigResidual, TSat, THigh, Par, "SetupSupHeatTempTable" );
+				if ( SolFla < 0 ) Temp = TSat + EnthFrac * ( THigh - TSat );
+				refrig.SHTempTableValues( i, j ) = Temp;
+			}
+		}
+	}
+
 	Real64
 	GetSupHeatTempRefrigResidual(
 		Real64 const Temp, // temperature of the refrigerant
@@ -4640,6 +4781,7 @@ namespace FluidProperties {
 		// Par( 1 ) = RefrigNum;
 		// Par( 2 ) = Enthalpy;
 		// Par( 3 ) = Pressure;
+		// Par( 4 ) = 1.0 to suppress the warnings of the enthalpy evaluation, 0.0 otherwise
 
 		// FUNCTION PARAMETER DEFINITIONS:
 		//  na
@@ -4652,7 +4794,6 @@ namespace FluidProperties {
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		static std::string const RoutineNameNoSpace( "GetSupHeatTempRefrigResidual" );
-		std::string Refrigerant; // carries in substance name
 		int RefrigNum; // index for refrigerant under consideration
 		Real64 Pressure; // pressure of the refrigerant 
 		Real64 Enthalpy_Req; // enthalpy of the refrigerant to meet
@@ -4661,10 +4802,10 @@ namespace FluidProperties {
 		RefrigNum = int( Par( 1 ) );
 		Enthalpy_Req = Par( 2 );
 		Pressure = Par( 3 );
-		Refrigerant = RefrigErrorTracking( RefrigNum ).Name;
+		std::string const & Refrigerant( RefrigErrorTracking( RefrigNum ).Name ); // carries in substance name
 		if ( std::abs( Enthalpy_Req ) < 100.0 ) Enthalpy_Req = sign( 100.0, Enthalpy_Req );
 		
-		Enthalpy_Act = GetSupHeatEnthalpyRefrig( Refrigerant, Temp, Pressure, RefrigNum, RoutineNameNoSpace);
+		Enthalpy_Act = GetSupHeatEnthalpyRefrig( Refrigerant, Temp, Pressure, RefrigNum, RoutineNameNoSpace, Par( 4 ) > 0.0 );
 		
 		TempResidual = ( Enthalpy_Act - Enthalpy_Req ) / Enthalpy_Req;
 
@@ -4743,7 +4884,6 @@ namespace FluidProperties {
 		int RefrigNum; // index for refrigerant under consideration
 		int TempIndex; // low index value of Temperature from table
 		// error counters and dummy string
-		static int SatErrCount( 0 );
 		int ErrCount; // error counter for current call
 		int CurTempRangeErrCount; // error counter for current call
 		int CurPresRangeErrCount; // error counter for current call
@@ -4776,10 +4916,10 @@ namespace FluidProperties {
 			}
 			RefrigIndex = RefrigNum;
 		}
-		auto const & refrig( RefrigData( RefrigNum ) );
+		auto & refrig( RefrigData( RefrigNum ) );
 
 		// check temperature data range and attempt to cap if necessary
-		TempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts );
+		TempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts, refrig.SHTempIndexHint );
 		if ( ( TempIndex > 0 ) && ( TempIndex < refrig.NumSuperTempPts ) ) { // in range
 			HiTempIndex = TempIndex + 1;
 			TempInterpRatio = ( Temperature - refrig.SHTemps( TempIndex ) ) / ( refrig.SHTemps( HiTempIndex ) - refrig.SHTemps( TempIndex ) );
@@ -4799,7 +4939,7 @@ namespace FluidProperties {
 		}
 
 		// check pressure data range and attempt to cap if necessary
-		LoPressIndex = FindArrayIndex( Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts );
+		LoPressIndex = FindArrayIndex( Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts, refrig.SHPressIndexHint );
 		if ( ( LoPressIndex > 0 ) && ( LoPressIndex < refrig.NumSuperPressPts ) ) { // in range
 			HiPressIndex = LoPressIndex + 1;
 			Real64 const SHPress_Lo( refrig.SHPress( LoPressIndex ) );
@@ -4857,9 +4997,9 @@ namespace FluidProperties {
 			// interpolate w.r.t. temperature
 			ReturnValue = TempInterpRatio * DensityHigh + ( 1.0 - TempInterpRatio ) * DensityLow;
 		} else { // All data is at zero: we are completely inside the saturation dome. Best thing we can do is return saturation value
-			++SatErrCount;
+			++GetSupHeatDensityRefrigSatErrCount;
 			// send warning
-			RefrigErrorTracking( RefrigNum ).SatSupDensityErrCount += SatErrCount;
+			RefrigErrorTracking( RefrigNum ).SatSupDensityErrCount += GetSupHeatDensityRefrigSatErrCount;
 			// send warning
 			if ( RefrigErrorTracking( RefrigNum ).SatSupDensityErrCount <= RefrigerantErrorLimitTest ) {
 				ShowWarningMessage( RoutineName + ": Refrigerant [" + RefrigErrorTracking( RefrigNum ).Name + "] is saturated at the given conditions, saturated density at given temperature returned. **" );
@@ -4869,7 +5009,7 @@ namespace FluidProperties {
 				ShowContinueError( "Returned Density value = " + RoundSigDigits( saturated_density, 3 ) );
 				ShowContinueErrorTimeStamp( "" );
 			}
-			if ( SatErrCount > 0 ) {
+			if ( GetSupHeatDensityRefrigSatErrCount > 0 ) {
 				ShowRecurringWarningErrorAtEnd( RoutineName + ": Refrigerant [" + RefrigErrorTracking( RefrigNum ).Name + "] saturated at the given conditions **", RefrigErrorTracking( RefrigNum ).SatSupEnthalpyErrIndex, Temperature, Temperature, _, "{C}", "{C}" );
 			}
 			return saturated_density;
@@ -4955,8 +5095,6 @@ namespace FluidProperties {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static int HighTempLimitErr( 0 );
-		static int LowTempLimitErr( 0 );
 
 		// Get the input if we haven't already
 		if ( GetInput ) {
@@ -5019,12 +5157,12 @@ namespace FluidProperties {
 			//}
 			//assert( std::is_sorted( glycol_CpTemps.begin(), glycol_CpTemps.end() ) ); // Sorted temperature array is assumed: Enable if/when arrays have begin()/end()
 			assert( glycol_CpTemps.size() <= static_cast< std::size_t >( std::numeric_limits< int >::max() ) ); // Array indexes are int now so this is future protection
-			int beg( 1 ), mid, end( glycol_CpTemps.isize() ); // 1-based indexing
-			assert( end > 0 );
-			while ( beg + 1 < end ) {
-				mid = ( ( beg + end ) >> 1 ); // bit shifting is faster than /2
-				( Temperature > glycol_CpTemps( mid ) ? beg : end ) = mid;
-			} // Invariant: glycol_CpTemps[beg] <= Temperature <= glycol_CpTemps[end]
+			int const NumCpTemps( glycol_CpTemps.isize() ); // 1-based indexing
+			assert( NumCpTemps > 0 );
+			// Interval halving over the whole list (or its cached/evenly spaced equivalent)
+			int const beg( FindArrayIndex( Temperature, glycol_CpTemps, 1, NumCpTemps, GlycolData( GlycolIndex ).CpTempIndexHint, glycol_data.CpTempStepInv ) );
+			int const end( min( beg + 1, NumCpTemps ) );
+			// Invariant: glycol_CpTemps[beg] <= Temperature <= glycol_CpTemps[end]
 			return GetInterpValue_fast( Temperature, glycol_CpTemps( beg ), glycol_CpTemps( end ), glycol_CpValues( beg ), glycol_CpValues( end ) );
 		}
 
@@ -5080,9 +5218,6 @@ namespace FluidProperties {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		int Loop; // DO loop counter
-		static int HighTempLimitErr( 0 );
-		static int LowTempLimitErr( 0 );
 		int GlycolNum;
 		bool LowErrorThisTime;
 		bool HighErrorThisTime;
@@ -5125,12 +5260,12 @@ namespace FluidProperties {
 			HighErrorThisTime = true;
 			ReturnValue = GlycolData( GlycolIndex ).RhoValues( GlycolData( GlycolIndex ).RhoHighTempIndex );
 		} else { // Temperature somewhere between the lowest and highest value
-			ReturnValue = GlycolData( GlycolIndex ).RhoValues( GlycolData( GlycolIndex ).RhoLowTempIndex );
+			auto & glycol_data( GlycolData( GlycolIndex ) );
+			ReturnValue = glycol_data.RhoValues( glycol_data.RhoLowTempIndex );
 			// bracket is temp > low, <= high (for interpolation
-			for ( Loop = GlycolData( GlycolIndex ).RhoLowTempIndex + 1; Loop <= GlycolData( GlycolIndex ).RhoHighTempIndex; ++Loop ) {
-				if ( Temperature > GlycolData( GlycolIndex ).RhoTemps( Loop ) ) continue;
-				ReturnValue = GetInterpValue( Temperature, GlycolData( GlycolIndex ).RhoTemps( Loop - 1 ), GlycolData( GlycolIndex ).RhoTemps( Loop ), GlycolData( GlycolIndex ).RhoValues( Loop - 1 ), GlycolData( GlycolIndex ).RhoValues( Loop ) );
-				break; // DO loop
+			int const LoTempIndex( FindArrayIndex( Temperature, glycol_data.RhoTemps, glycol_data.RhoLowTempIndex, glycol_data.RhoHighTempIndex, glycol_data.RhoTempIndexHint, glycol_data.RhoTempStepInv ) );
+			if ( LoTempIndex < glycol_data.RhoHighTempIndex ) {
+				ReturnValue = GetInterpValue( Temperature, glycol_data.RhoTemps( LoTempIndex ), glycol_data.RhoTemps( LoTempIndex + 1 ), glycol_data.RhoValues( LoTempIndex ), glycol_data.RhoValues( LoTempIndex + 1 ) );
 			}
 		}
 
@@ -5141,14 +5276,14 @@ namespace FluidProperties {
 			//    IF (HighErrorThisTime) HighTempLimitErr = HighTempLimitErr + 1
 			if ( LowErrorThisTime ) {
 				++GlycolErrorTracking( GlycolIndex ).DensityLowErrCount;
-				LowTempLimitErr = GlycolErrorTracking( GlycolIndex ).DensityLowErrCount;
+				GetDensityGlycolLowTempLimitErr = GlycolErrorTracking( GlycolIndex ).DensityLowErrCount;
 			}
 			if ( HighErrorThisTime ) {
 				++GlycolErrorTracking( GlycolIndex ).DensityHighErrCount;
-				HighTempLimitErr = GlycolErrorTracking( GlycolIndex ).DensityHighErrCount;
+				GetDensityGlycolHighTempLimitErr = GlycolErrorTracking( GlycolIndex ).DensityHighErrCount;
 			}
 
-			if ( ( LowErrorThisTime ) && ( LowTempLimitErr <= GlycolErrorLimitTest ) ) {
+			if ( ( LowErrorThisTime ) && ( GetDensityGlycolLowTempLimitErr <= GlycolErrorLimitTest ) ) {
 				ShowWarningMessage( RoutineName + "Temperature is out of range (too low) for fluid [" + GlycolData( GlycolIndex ).Name + "] density **" );
 				ShowContinueError( "..Called From:" + CalledFrom + ",Temperature=[" + RoundSigDigits( Temperature, 2 ) + "], supplied data range=[" + RoundSigDigits( GlycolData( GlycolIndex ).RhoLowTempValue, 2 ) + ',' + RoundSigDigits( GlycolData( GlycolIndex ).RhoHighTempValue, 2 ) + ']' );
 				ShowContinueErrorTimeStamp( "" );
@@ -5157,7 +5292,7 @@ namespace FluidProperties {
 				ShowRecurringWarningErrorAtEnd( RoutineName + "Temperature out of range (too low) for fluid [" + GlycolData( GlycolIndex ).Name + "] density **", GlycolErrorTracking( GlycolIndex ).DensityLowErrIndex, Temperature, Temperature, _, "{C}", "{C}" );
 			}
 
-			if ( ( HighErrorThisTime ) && ( HighTempLimitErr <= GlycolErrorLimitTest ) ) {
+			if ( ( HighErrorThisTime ) && ( GetDensityGlycolHighTempLimitErr <= GlycolErrorLimitTest ) ) {
 				ShowWarningMessage( RoutineName + "Temperature is out of range (too high) for fluid [" + GlycolData( GlycolIndex ).Name + "] density **" );
 				ShowContinueError( "..Called From:" + CalledFrom + ",Temperature=[" + RoundSigDigits( Temperature, 2 ) + "], supplied data range=[" + RoundSigDigits( GlycolData( GlycolIndex ).RhoLowTempValue, 2 ) + ',' + RoundSigDigits( GlycolData( GlycolIndex ).RhoHighTempValue, 2 ) + ']' );
 				ShowContinueErrorTimeStamp( "" );
@@ -5221,9 +5356,6 @@ namespace FluidProperties {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		int Loop; // DO loop counter
-		static int HighTempLimitErr( 0 );
-		static int LowTempLimitErr( 0 );
 		int GlycolNum;
 		bool LowErrorThisTime;
 		bool HighErrorThisTime;
@@ -5266,12 +5398,12 @@ namespace FluidProperties {
 			HighErrorThisTime = true;
 			ReturnValue = GlycolData( GlycolIndex ).CondValues( GlycolData( GlycolIndex ).CondHighTempIndex );
 		} else { // Temperature somewhere between the lowest and highest value
-			ReturnValue = GlycolData( GlycolIndex ).CondValues( GlycolData( GlycolIndex ).CondLowTempIndex );
+			auto & glycol_data( GlycolData( GlycolIndex ) );
+			ReturnValue = glycol_data.CondValues( glycol_data.CondLowTempIndex );
 			// bracket is temp > low, <= high (for interpolation
-			for ( Loop = GlycolData( GlycolIndex ).CondLowTempIndex + 1; Loop <= GlycolData( GlycolIndex ).CondHighTempIndex; ++Loop ) {
-				if ( Temperature > GlycolData( GlycolIndex ).CondTemps( Loop ) ) continue;
-				ReturnValue = GetInterpValue( Temperature, GlycolData( GlycolIndex ).CondTemps( Loop - 1 ), GlycolData( GlycolIndex ).CondTemps( Loop ), GlycolData( GlycolIndex ).CondValues( Loop - 1 ), GlycolData( GlycolIndex ).CondValues( Loop ) );
-				break; // DO loop
+			int const LoTempIndex( FindArrayIndex( Temperature, glycol_data.CondTemps, glycol_data.CondLowTempIndex, glycol_data.CondHighTempIndex, glycol_data.CondTempIndexHint, glycol_data.CondTempStepInv ) );
+			if ( LoTempIndex < glycol_data.CondHighTempIndex ) {
+				ReturnValue = GetInterpValue( Temperature, glycol_data.CondTemps( LoTempIndex ), glycol_data.CondTemps( LoTempIndex + 1 ), glycol_data.CondValues( LoTempIndex ), glycol_data.CondValues( LoTempIndex + 1 ) );
 			}
 		}
 
@@ -5282,14 +5414,14 @@ namespace FluidProperties {
 			//    IF (HighErrorThisTime) HighTempLimitErr = HighTempLimitErr + 1
 			if ( LowErrorThisTime ) {
 				++GlycolErrorTracking( GlycolIndex ).ConductivityLowErrCount;
-				LowTempLimitErr = GlycolErrorTracking( GlycolIndex ).ConductivityLowErrCount;
+				GetConductivityGlycolLowTempLimitErr = GlycolErrorTracking( GlycolIndex ).ConductivityLowErrCount;
 			}
 			if ( HighErrorThisTime ) {
 				++GlycolErrorTracking( GlycolIndex ).ConductivityHighErrCount;
-				HighTempLimitErr = GlycolErrorTracking( GlycolIndex ).ConductivityHighErrCount;
+				GetConductivityGlycolHighTempLimitErr = GlycolErrorTracking( GlycolIndex ).ConductivityHighErrCount;
 			}
 
-			if ( ( LowErrorThisTime ) && ( LowTempLimitErr <= GlycolErrorLimitTest ) ) {
+			if ( ( LowErrorThisTime ) && ( GetConductivityGlycolLowTempLimitErr <= GlycolErrorLimitTest ) ) {
 				ShowWarningMessage( RoutineName + "Temperature is out of range (too low) for fluid [" + GlycolData( GlycolIndex ).Name + "] conductivity **" );
 				ShowContinueError( "..Called From:" + CalledFrom + ",Temperature=[" + RoundSigDigits( Temperature, 2 ) + "], supplied data range=[" + RoundSigDigits( GlycolData( GlycolIndex ).CondLowTempValue, 2 ) + ',' + RoundSigDigits( GlycolData( GlycolIndex ).CondHighTempValue, 2 ) + ']' );
 				ShowContinueErrorTimeStamp( "" );
@@ -5298,7 +5430,7 @@ namespace FluidProperties {
 				ShowRecurringWarningErrorAtEnd( RoutineName + "Temperature out of range (too low) for fluid [" + GlycolData( GlycolIndex ).Name + "] conductivity **", GlycolErrorTracking( GlycolIndex ).ConductivityLowErrIndex, Temperature, Temperature, _, "{C}", "{C}" );
 			}
 
-			if ( ( HighErrorThisTime ) && ( HighTempLimitErr <= GlycolErrorLimitTest ) ) {
+			if ( ( HighErrorThisTime ) && ( GetConductivityGlycolHighTempLimitErr <= GlycolErrorLimitTest ) ) {
 				ShowWarningMessage( RoutineName + "Temperature is out of range (too high) for fluid [" + GlycolData( GlycolIndex ).Name + "] conductivity **" );
 				ShowContinueError( "..Called From:" + CalledFrom + ",Temperature=[" + RoundSigDigits( Temperature, 2 ) + "], supplied data range=[" + RoundSigDigits( GlycolData( GlycolIndex ).CondLowTempValue, 2 ) + ',' + RoundSigDigits( GlycolData( GlycolIndex ).CondHighTempValue, 2 ) + ']' );
 				ShowContinueErrorTimeStamp( "" );
@@ -5362,9 +5494,6 @@ namespace FluidProperties {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		int Loop; // DO loop counter
-		static int HighTempLimitErr( 0 );
-		static int LowTempLimitErr( 0 );
 		int GlycolNum;
 		bool LowErrorThisTime;
 		bool HighErrorThisTime;
@@ -5407,12 +5536,12 @@ namespace FluidProperties {
 			HighErrorThisTime = true;
 			ReturnValue = GlycolData( GlycolIndex ).ViscValues( GlycolData( GlycolIndex ).ViscHighTempIndex );
 		} else { // Temperature somewhere between the lowest and highest value
-			ReturnValue = GlycolData( GlycolIndex ).ViscValues( GlycolData( GlycolIndex ).ViscLowTempIndex );
+			auto & glycol_data( GlycolData( GlycolIndex ) );
+			ReturnValue = glycol_data.ViscValues( glycol_data.ViscLowTempIndex );
 			// bracket is temp > low, <= high (for interpolation
-			for ( Loop = GlycolData( GlycolIndex ).ViscLowTempIndex + 1; Loop <= GlycolData( GlycolIndex ).ViscHighTempIndex; ++Loop ) {
-				if ( Temperature > GlycolData( GlycolIndex ).ViscTemps( Loop ) ) continue;
-				ReturnValue = GetInterpValue( Temperature, GlycolData( GlycolIndex ).ViscTemps( Loop - 1 ), GlycolData( GlycolIndex ).ViscTemps( Loop ), GlycolData( GlycolIndex ).ViscValues( Loop - 1 ), GlycolData( GlycolIndex ).ViscValues( Loop ) );
-				break; // DO loop
+			int const LoTempIndex( FindArrayIndex( Temperature, glycol_data.ViscTemps, glycol_data.ViscLowTempIndex, glycol_data.ViscHighTempIndex, glycol_data.ViscTempIndexHint, glycol_data.ViscTempStepInv ) );
+			if ( LoTempIndex < glycol_data.ViscHighTempIndex ) {
+				ReturnValue = GetInterpValue( Temperature, glycol_data.ViscTemps( LoTempIndex ), glycol_data.ViscTemps( LoTempIndex + 1 ), glycol_data.ViscValues( LoTempIndex ), glycol_data.ViscValues( LoTempIndex + 1 ) );
 			}
 		}
 
@@ -5423,14 +5552,14 @@ namespace FluidProperties {
 			//    IF (HighErrorThisTime) HighTempLimitErr = HighTempLimitErr + 1
 			if ( LowErrorThisTime ) {
 				++GlycolErrorTracking( GlycolIndex ).ViscosityLowErrCount;
-				LowTempLimitErr = GlycolErrorTracking( GlycolIndex ).ViscosityLowErrCount;
+				GetViscosityGlycolLowTempLimitErr = GlycolErrorTracking( GlycolIndex ).ViscosityLowErrCount;
 			}
 			if ( HighErrorThisTime ) {
 				++GlycolErrorTracking( GlycolIndex ).ViscosityHighErrCount;
-				HighTempLimitErr = GlycolErrorTracking( GlycolIndex ).ViscosityHighErrCount;
+				GetViscosityGlycolHighTempLimitErr = GlycolErrorTracking( GlycolIndex ).ViscosityHighErrCount;
 			}
 
-			if ( ( LowErrorThisTime ) && ( LowTempLimitErr <= GlycolErrorLimitTest ) ) {
+			if ( ( LowErrorThisTime ) && ( GetViscosityGlycolLowTempLimitErr <= GlycolErrorLimitTest ) ) {
 				ShowWarningMessage( RoutineName + "Temperature is out of range (too low) for fluid [" + GlycolData( GlycolIndex ).Name + "] viscosity **" );
 				ShowContinueError( "..Called From:" + CalledFrom + ",Temperature=[" + RoundSigDigits( Temperature, 2 ) + "], supplied data range=[" + RoundSigDigits( GlycolData( GlycolIndex ).ViscLowTempValue, 2 ) + ',' + RoundSigDigits( GlycolData( GlycolIndex ).ViscHighTempValue, 2 ) + ']' );
 				ShowContinueErrorTimeStamp( "" );
@@ -5439,7 +5568,7 @@ namespace FluidProperties {
 				ShowRecurringWarningErrorAtEnd( RoutineName + "Temperature out of range (too low) for fluid [" + GlycolData( GlycolIndex ).Name + "] viscosity **", GlycolErrorTracking( GlycolIndex ).ViscosityLowErrIndex, Temperature, Temperature, _, "{C}", "{C}" );
 			}
 
-			if ( ( HighErrorThisTime ) && ( HighTempLimitErr <= GlycolErrorLimitTest ) ) {
+			if ( ( HighErrorThisTime ) && ( GetViscosityGlycolHighTempLimitErr <= GlycolErrorLimitTest ) ) {
 				ShowWarningMessage( RoutineName + "Temperature is out of range (too high) for fluid [" + GlycolData( GlycolIndex ).Name + "] viscosity **" );
 				ShowContinueError( "..Called From:" + CalledFrom + ",Temperature=[" + RoundSigDigits( Temperature, 2 ) + "], supplied data range=[" + RoundSigDigits( GlycolData( GlycolIndex ).ViscLowTempValue, 2 ) + ',' + RoundSigDigits( GlycolData( GlycolIndex ).ViscHighTempValue, 2 ) + ']' );
 				ShowContinueErrorTimeStamp( "" );
@@ -5513,8 +5642,6 @@ namespace FluidProperties {
 		int HiTempIndex; // array index for temp above input temp
 		int LoTempIndex; // array index for temp below input temp
 		Real64 TempInterpRatio; // ratio to interpolate in temperature domain
-		static int TempLoRangeErrIndex( 0 );
-		static int TempHiRangeErrIndex( 0 );
 
 		// FLOW:
 		if ( GetInput ) {
@@ -5539,9 +5666,9 @@ namespace FluidProperties {
 			}
 			RefrigIndex = RefrigNum;
 		}
-		auto const & refrig( RefrigData( RefrigNum ) );
+		auto & refrig( RefrigData( RefrigNum ) );
 
-		LoTempIndex = FindArrayIndex( Temperature, refrig.HTemps, refrig.HfLowTempIndex, refrig.HfHighTempIndex );
+		LoTempIndex = FindArrayIndex( Temperature, refrig.HTemps, refrig.HfLowTempIndex, refrig.HfHighTempIndex, refrig.HTempIndexHint );
 		HiTempIndex = LoTempIndex + 1;
 
 		// check on the data bounds and adjust indices to give clamped return value
@@ -5883,6 +6010,67 @@ namespace FluidProperties {
 		}
 	}
 
+	int
+	FindArrayIndex(
+		Real64 const Value, // Value to be placed/found within the array of values
+		Array1D< Real64 > const & Array, // Array of values in ascending order
+		int const LowBound, // Valid values lower bound (set by calling program)
+		int const UpperBound, // Valid values upper bound (set by calling program)
+		int & IndexHint, // Index found by the previous search of this array (updated)
+		Real64 const StepInv // Inverse spacing of evenly spaced Array values (0.0 if unevenly spaced)
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the same index as FindArrayIndex( Value, Array, LowBound, UpperBound ) for
+		// callers that search the same array over and over with slowly changing values.
+
+		// METHODOLOGY EMPLOYED:
+		// The interval found by the previous search (IndexHint) and the one above it are tried
+		// first.  Otherwise evenly spaced arrays are entered by index arithmetic and the guess is
+		// corrected against the array values, and other arrays use interval halving.
+
+		if ( Value < Array( LowBound ) ) return 0;
+		if ( Value > Array( UpperBound ) ) return UpperBound;
+		if ( UpperBound == LowBound ) return LowBound;
+
+		// Interval Index brackets Value the way interval halving does: Array(Index) < Value <= Array(Index+1)
+		auto const brackets = [&]( int const Index ) {
+			return ( Index >= LowBound ) && ( Index < UpperBound ) && ( ( Index == LowBound ) || ( Array( Index ) < Value ) ) && ( Value <= Array( Index + 1 ) );
+		};
+		if ( brackets( IndexHint ) ) return IndexHint;
+		if ( brackets( IndexHint + 1 ) ) return ++IndexHint;
+
+		int Index;
+		if ( StepInv > 0.0 ) {
+			Index = min( LowBound + static_cast< int >( ( Value - Array( LowBound ) ) * StepInv ), UpperBound - 1 );
+			while ( ( Index > LowBound ) && ( Array( Index ) >= Value ) ) --Index;
+			while ( ( Index < UpperBound - 1 ) && ( Array( Index + 1 ) < Value ) ) ++Index;
+		} else {
+			Index = FindArrayIndex( Value, Array, LowBound, UpperBound );
+		}
+		IndexHint = Index;
+		return Index;
+	}
+
+	Real64
+	EvenSpacingInverse( Array1D< Real64 > const & Array ) // Array of values in ascending order
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the inverse of the spacing of evenly spaced array values, or 0.0 if the
+		// values are not evenly spaced, for use with FindArrayIndex.
+
+		int const NumValues( Array.isize() );
+		if ( NumValues < 2 ) return 0.0;
+		Real64 const Step( ( Array( Array.u() ) - Array( Array.l() ) ) / ( NumValues - 1 ) );
+		if ( Step <= 0.0 ) return 0.0;
+		for ( int Loop = 1; Loop < NumValues - 1; ++Loop ) {
+			if ( std::abs( Array( Array.l() + Loop ) - ( Array( Array.l() ) + Loop * Step ) ) > 1.0e-6 * Step ) return 0.0;
+		}
+		return 1.0 / Step;
+	}
+
 	//*****************************************************************************
 
 	Real64
@@ -5894,7 +6082,8 @@ namespace FluidProperties {
 		Real64 const Quality, // Quality
 		std::string const & CalledFrom, // routine this function was called from (error messages)
 		int const LowBound, // Valid values lower bound (set by calling program)
-		int const UpperBound // Valid values upper bound (set by calling program)
+		int const UpperBound, // Valid values upper bound (set by calling program)
+		int & IndexHint // Index found by the previous search of PropTemps (updated)
 	)
 	{
 
@@ -5943,10 +6132,8 @@ namespace FluidProperties {
 
 		// error counters and dummy string
 		bool ErrorFlag( false ); // error flag for current call
-		static int TempRangeErrCount( 0 ); // cumulative error counter
-		static int TempRangeErrIndex( 0 );
 
-		int const LoTempIndex = FindArrayIndex( Temperature, PropTemps, LowBound, UpperBound );  // array index for temp above input temp
+		int const LoTempIndex = FindArrayIndex( Temperature, PropTemps, LowBound, UpperBound, IndexHint );  // array index for temp above input temp
 
 		if ( LoTempIndex == 0 ) {
 			ReturnValue = LiqProp( LowBound ) + Quality * ( VapProp( LowBound ) - LiqProp( LowBound ) );
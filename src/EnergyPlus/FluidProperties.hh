@@ -98,6 +98,8 @@ namespace FluidProperties {
 	extern int const PropyleneGlycolIndex;
 	extern int const iRefrig;
 	extern int const iGlycol;
+	extern int const NumSHTempTablePress; // Pressure points of the superheated temperature tables
+	extern int const NumSHTempTableEnth; // Enthalpy points of the superheated temperature tables
 
 	// DERIVED TYPE DEFINITIONS
 
@@ -179,6 +181,23 @@ namespace FluidProperties {
 		Array1D< Real64 > SHPress; // Pressures for superheated gas
 		Array2D< Real64 > HshValues; // Enthalpy of superheated gas at HshTemps, HshPress
 		Array2D< Real64 > RhoshValues; // Density of superheated gas at HshTemps, HshPress
+		// Last indexes found by FindArrayIndex, tried first by the next search of the same array
+		int PsTempIndexHint; // in PsTemps
+		int PsPresIndexHint; // in PsValues
+		int HTempIndexHint; // in HTemps
+		int CpTempIndexHint; // in CpTemps
+		int RhoTempIndexHint; // in RhoTemps
+		int SHTempIndexHint; // in SHTemps
+		int SHPressIndexHint; // in SHPress
+		// Superheated temperature as a function of pressure and enthalpy, built on first use if RefrigTablesEnvFlag
+		bool SHTempTableBuilt; // True once the table below has been set up
+		Real64 SHTempTablePressLow; // Lowest pressure of the table
+		Real64 SHTempTablePressHigh; // Highest pressure of the table (below SHTempTablePressLow if no table)
+		Real64 SHTempTablePressStepInv; // Inverse spacing of the table pressures
+		Array1D< Real64 > SHTempTableEnthSat; // Saturated vapor enthalpy at the table pressures
+		Array1D< Real64 > SHTempTableEnthHigh; // Enthalpy at PsHighTempValue at the table pressures
+		Array2D< Real64 > SHTempTableValues; // Temperature at the table pressures and evenly spaced enthalpies
+		// between SHTempTableEnthSat and SHTempTableEnthHigh
 
 		// Default Constructor
 		FluidPropsRefrigerantData() :
@@ -219,7 +238,18 @@ namespace FluidProperties {
 			RhofgLowTempIndex( 0 ),
 			RhofgHighTempIndex( 0 ),
 			NumSuperTempPts( 0 ),
-			NumSuperPressPts( 0 )
+			NumSuperPressPts( 0 ),
+			PsTempIndexHint( 0 ),
+			PsPresIndexHint( 0 ),
+			HTempIndexHint( 0 ),
+			CpTempIndexHint( 0 ),
+			RhoTempIndexHint( 0 ),
+			SHTempIndexHint( 0 ),
+			SHPressIndexHint( 0 ),
+			SHTempTableBuilt( false ),
+			SHTempTablePressLow( 0.0 ),
+			SHTempTablePressHigh( -1.0 ),
+			SHTempTablePressStepInv( 0.0 )
 		{}
 
 	};
@@ -312,6 +342,16 @@ namespace FluidProperties {
 		int ViscHighTempIndex; // High Temperature Max Index for Visc (>0.0)
 		Array1D< Real64 > ViscTemps; // Temperatures for viscosity of glycol
 		Array1D< Real64 > ViscValues; // viscosity values (mPa-s)
+		// Evenly spaced temperature lists are searched by index arithmetic (see InitializeGlycolTempLimits),
+		// the others starting from the index found by the previous search
+		Real64 CpTempStepInv; // Inverse spacing of CpTemps (0.0 if unevenly spaced)
+		int CpTempIndexHint; // Last index found in CpTemps
+		Real64 RhoTempStepInv; // Inverse spacing of RhoTemps (0.0 if unevenly spaced)
+		int RhoTempIndexHint; // Last index found in RhoTemps
+		Real64 CondTempStepInv; // Inverse spacing of CondTemps (0.0 if unevenly spaced)
+		int CondTempIndexHint; // Last index found in CondTemps
+		Real64 ViscTempStepInv; // Inverse spacing of ViscTemps (0.0 if unevenly spaced)
+		int ViscTempIndexHint; // Last index found in ViscTemps
 
 		// Default Constructor
 		FluidPropsGlycolData() :
@@ -340,7 +380,15 @@ namespace FluidProperties {
 			ViscLowTempValue( 0.0 ),
 			ViscHighTempValue( 0.0 ),
 			ViscLowTempIndex( 0 ),
-			ViscHighTempIndex( 0 )
+			ViscHighTempIndex( 0 ),
+			CpTempStepInv( 0.0 ),
+			CpTempIndexHint( 0 ),
+			RhoTempStepInv( 0.0 ),
+			RhoTempIndexHint( 0 ),
+			CondTempStepInv( 0.0 ),
+			CondTempIndexHint( 0 ),
+			ViscTempStepInv( 0.0 ),
+			ViscTempIndexHint( 0 )
 		{}
 
 	};
@@ -523,7 +571,8 @@ namespace FluidProperties {
 		std::string const & Refrigerant, // carries in substance name
 		Real64 const Pressure, // actual temperature given as input
 		int & RefrigIndex, // Index to Refrigerant Properties
-		std::string const & CalledFrom // routine this function was called from (error messages)
+		std::string const & CalledFrom, // routine this function was called from (error messages)
+		bool const SuppressWarnings = false // if calling function is evaluating points at the edges of the data
 	);
 
 	//*****************************************************************************
@@ -567,7 +616,8 @@ namespace FluidProperties {
 		Real64 const Temperature, // actual temperature given as input
 		Real64 const Pressure, // actual pressure given as input
 		int & RefrigIndex, // Index to Refrigerant Properties
-		std::string const & CalledFrom // routine this function was called from (error messages)
+		std::string const & CalledFrom, // routine this function was called from (error messages)
+		bool const SuppressWarnings = false // if calling function is evaluating points at the edges of the data
 	);
 
 	//*****************************************************************************
@@ -594,6 +644,9 @@ namespace FluidProperties {
 		std::string const & CalledFrom // routine this function was called from (error messages)
 	);
 
+	void
+	SetupSupHeatTempTable( int const RefrigNum ); // index for refrigerant under consideration
+
 	Real64
 	GetSupHeatTempRefrigResidual(
 		Real64 const Temperature, // temperature of the refrigerant
@@ -766,6 +819,19 @@ namespace FluidProperties {
 		Array1D< Real64 > const & Array // Array of values in ascending order
 	);
 
+	int
+	FindArrayIndex(
+		Real64 const Value, // Value to be placed/found within the array of values
+		Array1D< Real64 > const & Array, // Array of values in ascending order
+		int const LowBound, // Valid values lower bound (set by calling program)
+		int const UpperBound, // Valid values upper bound (set by calling program)
+		int & IndexHint, // Index found by the previous search of this array (updated)
+		Real64 const StepInv = 0.0 // Inverse spacing of evenly spaced Array values (0.0 if unevenly spaced)
+	);
+
+	Real64
+	EvenSpacingInverse( Array1D< Real64 > const & Array ); // Array of values in ascending order
+
 	//*****************************************************************************
 
 	Real64
@@ -777,7 +843,8 @@ namespace FluidProperties {
 		Real64 const Quality, // Quality
 		std::string const & CalledFrom, // routine this function was called from (error messages)
 		int const LowBound, // Valid values lower bound (set by calling program)
-		int const UpperBound // Valid values upper bound (set by calling program)
+		int const UpperBound, // Valid values upper bound (set by calling program)
+		int & IndexHint // Index found by the previous search of PropTemps (updated)
 	);
 
 	//*****************************************************************************
@@ -138,6 +138,49 @@ namespace FuelCellElectricGenerator {
 	bool GetFuelCellInput( true ); // When TRUE, calls subroutine to read input file.
 	Array1D_bool CheckEquipName;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false ); // error flag
+		bool MyOneTimeFlag( true );
+		Real64 CalcFuelCellGeneratorModelPpcuLosses; // losses in inverter [W]
+		bool ConstrainedFCPM( false ); // true if power prod is constrained for some reason
+		bool ConstrainedFCPMTrans( false );
+		Real64 waterFract( 0.0 );
+		Real64 NdotWaterCond( 0.0 );
+		bool InitGeneratorOnce( true ); // flag for 1 time initialization
+		Array1D_bool MyEnvrnFlag; // flag for init once at start of environment
+		Array1D_bool MyWarmupFlag; // flag for init after warmup complete
+		Array1D_bool MyPlantScanFlag;
+		bool FigureFuelCellZoneGainsMyEnvrnFlag( true );
+	}
+
+	// Functions
+
+	// Clears the global data in FuelCellElectricGenerator.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		GetFuelCellInput = true;
+		CheckEquipName.deallocate();
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		CalcFuelCellGeneratorModelPpcuLosses = 0.0;
+		ConstrainedFCPM = false;
+		ConstrainedFCPMTrans = false;
+		waterFract = 0.0;
+		NdotWaterCond = 0.0;
+		InitGeneratorOnce = true;
+		MyEnvrnFlag.deallocate();
+		MyWarmupFlag.deallocate();
+		MyPlantScanFlag.deallocate();
+		FigureFuelCellZoneGainsMyEnvrnFlag = true;
+	}
+
 	void
 	SimFuelCellGenerator(
 		int const EP_UNUSED( GeneratorType ), // type of Generator
@@ -263,7 +306,6 @@ namespace FuelCellElectricGenerator {
 		int IOStat; // IO Status when calling get input subroutine
 		Array1D_string AlphArray( 25 ); // character string data
 		Array1D< Real64 > NumArray( 200 ); // numeric data TODO deal with allocatable for extensible
-		static bool ErrorsFound( false ); // error flag
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int NumFuelCellPMs; // number of power subsystems in input file
@@ -290,7 +332,6 @@ namespace FuelCellElectricGenerator {
 		int thisFuelCell; // temporary index
 		int otherFuelCell; // loop counter and temporary indexer
 		int i; // loop counter
-		static bool MyOneTimeFlag( true );
 		std::string thisName;
 		int NumHardCodedConstituents;
 		int thisConstituent;
@@ -1173,13 +1214,10 @@ namespace FuelCellElectricGenerator {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 PpcuLosses; // losses in inverter [W]
 		Real64 Pel; // DC power generated in Fuel Cell Power Module
 		Real64 Pdemand;
 		Real64 Eel;
 		Real64 Tavg; // working average temperature
-		static bool ConstrainedFCPM( false ); // true if power prod is constrained for some reason
-		static bool ConstrainedFCPMTrans( false );
 		Real64 PelDiff;
 		int iter; // loop index over repeating set of inter dependent calculaitons
 		Real64 NdotO2; // molar rate coeff working varible
@@ -1266,7 +1304,7 @@ namespace FuelCellElectricGenerator {
 		// Note: MyLoad (input) is Pdemand (electical Power requested)
 		Pdemand = MyLoad;
 		PacAncillariesTotal = 0.0;
-		PpcuLosses = 0.0;
+		CalcFuelCellGeneratorModelPpcuLosses = 0.0;
 		Pstorage = 0.0;
 		PgridExtra = 0.0;
 		PoutofInverter = 0.0;
@@ -1275,20 +1313,20 @@ namespace FuelCellElectricGenerator {
 		//!BEGIN SEQUENTIAL SUBSTITUTION to handle a lot of inter-related calcs
 		for ( iter = 1; iter <= 20; ++iter ) {
 			if ( iter > 1 ) {
-				FigurePowerConditioningLosses( GeneratorNum, PoutofInverter, PpcuLosses );
+				FigurePowerConditioningLosses( GeneratorNum, PoutofInverter, CalcFuelCellGeneratorModelPpcuLosses );
 				FigureACAncillaries( GeneratorNum, PacAncillariesTotal );
-				Pdemand = MyLoad + PacAncillariesTotal + PpcuLosses;
+				Pdemand = MyLoad + PacAncillariesTotal + CalcFuelCellGeneratorModelPpcuLosses;
 			} else {
 				// control Step 1a: Figure ancillary AC power draws
 				FigureACAncillaries( GeneratorNum, PacAncillariesTotal );
 				Pdemand = MyLoad + PacAncillariesTotal;
 				// Control Step 1b: Calculate losses associated with Power conditioning
-				FigurePowerConditioningLosses( GeneratorNum, Pdemand, PpcuLosses );
-				Pdemand += PpcuLosses;
+				FigurePowerConditioningLosses( GeneratorNum, Pdemand, CalcFuelCellGeneratorModelPpcuLosses );
+				Pdemand += CalcFuelCellGeneratorModelPpcuLosses;
 				Pel = Pdemand;
 			}
 
-			FuelCell( GeneratorNum ).Inverter.PCUlosses = PpcuLosses;
+			FuelCell( GeneratorNum ).Inverter.PCUlosses = CalcFuelCellGeneratorModelPpcuLosses;
 
 			// Control step 2: adjust for transient and startup/shut down constraints
 
@@ -1650,7 +1688,7 @@ namespace FuelCellElectricGenerator {
 			Par( 2 ) = tmpTotProdGasEnthalphy;
 			Par( 3 ) = FuelCell( GeneratorNum ).FCPM.NdotProdGas;
 			tmpTprodGas = FuelCell( GeneratorNum ).FCPM.TprodGasLeavingFCPM;
-			SolveRegulaFalsi( Acc, MaxIter, SolverFlag, tmpTprodGas, FuelCellProductGasEnthResidual, MinProductGasTemp, MaxProductGasTemp, Par );
+			SolveRegulaFalsi( Acc, MaxIter, SolverFlag, tmpTprodGas, FuelCellProductGasEnthResidual, MinProductGasTemp, MaxProductGasTemp, Par, "CalcFuelCellGeneratorModel" );
 
 			if ( SolverFlag == -2 ) {
 
@@ -1671,26 +1709,26 @@ namespace FuelCellElectricGenerator {
 			// Control Step 3 determine interaction with electrical storage
 			// How much power is really going into inverter?
 			PintoInverter = Pel + Pstorage; // Back out so we can reapply
-			ManageElectStorInteractions( GeneratorNum, Pdemand, PpcuLosses, ConstrainedStorage, Pstorage, PgridExtra );
+			ManageElectStorInteractions( GeneratorNum, Pdemand, CalcFuelCellGeneratorModelPpcuLosses, ConstrainedStorage, Pstorage, PgridExtra );
 			PintoInverter = Pel - Pstorage;
 			// refine power conditioning losses with more current power production
 
 			if ( FuelCell( GeneratorNum ).Inverter.EffMode == InverterEffConstant ) {
 
-				PpcuLosses = ( 1.0 - FuelCell( GeneratorNum ).Inverter.ConstEff ) * PintoInverter;
+				CalcFuelCellGeneratorModelPpcuLosses = ( 1.0 - FuelCell( GeneratorNum ).Inverter.ConstEff ) * PintoInverter;
 
 			}
 
 			if ( FuelCell( GeneratorNum ).Inverter.EffMode == InverterEffQuadratic ) {
 
-				PpcuLosses = ( 1.0 - CurveValue( FuelCell( GeneratorNum ).Inverter.EffQuadraticCurveID, PintoInverter ) ) * PintoInverter;
+				CalcFuelCellGeneratorModelPpcuLosses = ( 1.0 - CurveValue( FuelCell( GeneratorNum ).Inverter.EffQuadraticCurveID, PintoInverter ) ) * PintoInverter;
 
 			}
 
-			PoutofInverter = PintoInverter - PpcuLosses;
+			PoutofInverter = PintoInverter - CalcFuelCellGeneratorModelPpcuLosses;
 
 			FuelCell( GeneratorNum ).ACPowerGen = PoutofInverter - FuelCell( GeneratorNum ).FCPM.PelancillariesAC - FuelCell( GeneratorNum ).AirSup.PairCompEl - FuelSupply( FuelCell( GeneratorNum ).FuelSupNum ).PfuelCompEl - FuelCell( GeneratorNum ).WaterSup.PwaterCompEl;
-			FuelCell( GeneratorNum ).Inverter.PCUlosses = PpcuLosses;
+			FuelCell( GeneratorNum ).Inverter.PCUlosses = CalcFuelCellGeneratorModelPpcuLosses;
 			// model assumes air intake is drawn over power conditioner to recovery heat
 			FuelCell( GeneratorNum ).Inverter.QairIntake = FuelCell( GeneratorNum ).Inverter.PCUlosses;
 
@@ -3369,12 +3407,10 @@ namespace FuelCellElectricGenerator {
 		Real64 TwaterOut( 0.0 );
 		Real64 hgas;
 		Real64 hwater;
-		static Real64 waterFract( 0.0 );
 		Real64 NdotWaterVapor;
 		Real64 TcondThresh;
 		Real64 hxl1;
 		Real64 hxl2;
-		static Real64 NdotWaterCond( 0.0 );
 		Real64 hfpwater;
 		int i;
 
@@ -3787,13 +3823,9 @@ namespace FuelCellElectricGenerator {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool InitGeneratorOnce( true ); // flag for 1 time initialization
-		static Array1D_bool MyEnvrnFlag; // flag for init once at start of environment
-		static Array1D_bool MyWarmupFlag; // flag for init after warmup complete
 		int inNode; // inlet index in Node array
 		int outNode; // outlet, index in Node array
 		Real64 TimeElapsed; // Fraction of the current hour that has elapsed (h)
-		static Array1D_bool MyPlantScanFlag;
 		Real64 mdot; // local temporary mass flow rate
 		Real64 rho; // local temporary fluid density
 		bool errFlag;
@@ -3978,13 +4010,12 @@ namespace FuelCellElectricGenerator {
 		Real64 TotalZoneHeatGain; // working variable for zone gain [w]
 		//  INTEGER :: ZoneNum
 		int FCnum; // number of fuel cell
-		static bool MyEnvrnFlag( true );
 
 		if ( NumFuelCellGenerators == 0 ) return;
 
-		if ( BeginEnvrnFlag && MyEnvrnFlag ) {
+		if ( BeginEnvrnFlag && FigureFuelCellZoneGainsMyEnvrnFlag ) {
 			for ( auto & e : FuelSupply ) e.QskinLoss = 0.0;
-			MyEnvrnFlag = false;
+			FigureFuelCellZoneGainsMyEnvrnFlag = false;
 			for ( int i = FuelCell.l(), e = FuelCell.u(); i <= e; ++i) {
 				auto & cell( FuelCell( i ) );
 				cell.FCPM.HasBeenOn = false;
@@ -4003,7 +4034,7 @@ namespace FuelCellElectricGenerator {
 			}
 		}
 
-		if ( ! BeginEnvrnFlag ) MyEnvrnFlag = true;
+		if ( ! BeginEnvrnFlag ) FigureFuelCellZoneGainsMyEnvrnFlag = true;
 
 		// this routine needs to do something for zone gains during sizing
 
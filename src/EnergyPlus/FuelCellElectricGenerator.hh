@@ -84,6 +84,11 @@ namespace FuelCellElectricGenerator {
 
 	// Functions
 
+	// Clears the global data in FuelCellElectricGenerator.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimFuelCellGenerator(
 		int const GeneratorType, // type of Generator
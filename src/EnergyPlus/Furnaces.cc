@@ -273,6 +273,68 @@ namespace Furnaces {
 	// MODULE SUBROUTINES:
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // Logical to allow "GetInput" only once per simulation
+		Real64 Dummy( 0.0 );
+		bool ErrorsFound( false ); // If errors detected in input
+		bool MyOneTimeFlag( true ); // one time allocation flag
+		Array1D_bool MyEnvrnFlag; // environment flag
+		Array1D_bool MySecondOneTimeFlag; // additional one time flag
+		Array1D_bool MyFanFlag; // used for sizing fan inputs one time
+		Array1D_bool MyCheckFlag; // Used to obtain the zone inlet node number in the controlled zone
+		Array1D_bool MyFlowFracFlag; // Used for calculatig flow fraction once
+		Array1D_bool MyPlantScanFlag; // used to initializa plant comp for water and steam heating coils
+		Array1D_bool MySuppCoilPlantScanFlag; // used to initialize plant comp for water and steam heating coils
+		int ZoneInSysIndex( 0 ); // number of zone inlet nodes counter in an airloop
+		int NumAirLoopZones( 0 ); // number of zone inlet nodes in an air loop
+		int ZoneInletNodeNum( 0 ); // zone inlet nodes node number
+		bool FlowFracFlagReady( true ); // one time flag for calculating flow fraction through controlled zone
+		Real64 SumOfMassFlowRateMax( 0.0 ); // the sum of mass flow rates at inlet to zones in an airloop
+		Real64 CntrlZoneTerminalUnitMassFlowRateMax( 0.0 ); // Maximum mass flow rate through controlled zone terminal unit
+		int EquipNum( 0 ); // local do loop index for equipment listed for a zone
+		bool InitFurnaceErrorsFound( false ); // flag returned from mining call
+		Real64 mdot( 0.0 ); // local temporary for mass flow rate (kg/s)
+		Real64 rho( 0.0 ); // local for fluid density
+		int SteamIndex( 0 ); // index of steam quality for steam heating coil
+		Real64 SteamDensity( 0.0 ); // density of steam at 100C, used for steam heating coils
+		Real64 CoilMaxVolFlowRate( 0.0 ); // coil fluid maximum volume flow rate
+		Real64 QActual( 0.0 ); // coil actual capacity
+		Real64 SUPHEATERLOAD( 0.0 ); // SUPPLEMENTAL HEATER LOAD
+		bool MyAirLoopPass( true ); // one time allocation flag
+		Real64 Error( 1.0 );
+		int Iter( 0 ); // Iteration counter
+		Real64 CoolCoilLoad; // Negative value means cooling required
+		Real64 SystemSensibleLoad; // Positive value means heating required
+		bool HumControl( false ); // Logical flag signaling when dehumidification is required
+		Real64 TotalZoneLatentLoad; // Total ZONE latent load (not including outside air)
+		Real64 TotalZoneSensLoad; // Total ZONE heating load (not including outside air)
+		Real64 CalcWaterToAirHeatPumpCoolPartLoadRatio; // Part load ratio (greater of sensible or latent part load ratio for cooling)
+		Real64 CalcWaterToAirHeatPumpHeatPartLoadRatio; // Part load ratio (greater of sensible or latent part load ratio for cooling)
+		Real64 CalcWaterToAirHeatPumpDummy( 0.0 ); // Dummy var. for generic calc. furnace output arg. (n/a for heat pump)
+		std::string HeatingCoilName; // name of heating coil
+		std::string HeatingCoilType; // type of heating coil
+		int CoilTypeNum( 0 ); // heating coil type number
+		int HeatingCoilIndex( 0 ); // heating coil index
+		int CoilControlNode( 0 ); // control node for hot water and steam heating coils
+		int CoilOutletNode( 0 ); // air outlet node of the heatiing coils
+		int LoopNum( 0 ); // plant loop number
+		int LoopSideNum( 0 ); // plant loop side number
+		int BranchNum( 0 ); // plant branch number
+		int CompNum( 0 ); // Numeric Equivalent for Supplemental Heat Coil Type
+		int SimVariableSpeedHPSpeedNum( 1 ); // Speed number
+		Real64 SimVariableSpeedHPSupHeaterLoad( 0.0 ); // supplement heater load
+		Real64 SimVariableSpeedHPTotalZoneLatentLoad; // Total ZONE latent load
+		Real64 TotalZoneSensibleLoad; // Total ZONE sensible load
+		Real64 SimVariableSpeedHPSystemSensibleLoad; // Positive value means heating required
+		int ErrCountCyc( 0 ); // Counter used to minimize the occurrence of output warnings
+		int ErrCountVar( 0 ); // Counter used to minimize the occurrence of output warnings
+	}
+
 	// Functions
 	void
 	clear_state() {
@@ -297,6 +359,60 @@ namespace Furnaces {
 		SaveCompressorPLR = 0.0;
 		CurrentModuleObject = "";
 		Furnace.deallocate();
+		GetInputFlag = true;
+		Dummy = 0.0;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		MyEnvrnFlag.deallocate();
+		MySecondOneTimeFlag.deallocate();
+		MyFanFlag.deallocate();
+		MyCheckFlag.deallocate();
+		MyFlowFracFlag.deallocate();
+		MyPlantScanFlag.deallocate();
+		MySuppCoilPlantScanFlag.deallocate();
+		ZoneInSysIndex = 0;
+		NumAirLoopZones = 0;
+		ZoneInletNodeNum = 0;
+		FlowFracFlagReady = true;
+		SumOfMassFlowRateMax = 0.0;
+		CntrlZoneTerminalUnitMassFlowRateMax = 0.0;
+		EquipNum = 0;
+		InitFurnaceErrorsFound = false;
+		mdot = 0.0;
+		rho = 0.0;
+		SteamIndex = 0;
+		SteamDensity = 0.0;
+		CoilMaxVolFlowRate = 0.0;
+		QActual = 0.0;
+		SUPHEATERLOAD = 0.0;
+		MyAirLoopPass = true;
+		Error = 1.0;
+		Iter = 0;
+		CoolCoilLoad = 0.0;
+		SystemSensibleLoad = 0.0;
+		HumControl = false;
+		TotalZoneLatentLoad = 0.0;
+		TotalZoneSensLoad = 0.0;
+		CalcWaterToAirHeatPumpCoolPartLoadRatio = 0.0;
+		CalcWaterToAirHeatPumpHeatPartLoadRatio = 0.0;
+		CalcWaterToAirHeatPumpDummy = 0.0;
+		HeatingCoilName.clear();
+		HeatingCoilType.clear();
+		CoilTypeNum = 0;
+		HeatingCoilIndex = 0;
+		CoilControlNode = 0;
+		CoilOutletNode = 0;
+		LoopNum = 0;
+		LoopSideNum = 0;
+		BranchNum = 0;
+		CompNum = 0;
+		SimVariableSpeedHPSpeedNum = 1;
+		SimVariableSpeedHPSupHeaterLoad = 0.0;
+		SimVariableSpeedHPTotalZoneLatentLoad = 0.0;
+		TotalZoneSensibleLoad = 0.0;
+		SimVariableSpeedHPSystemSensibleLoad = 0.0;
+		ErrCountCyc = 0;
+		ErrCountVar = 0;
 	}
 
 
@@ -361,7 +477,6 @@ namespace Furnaces {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int FurnaceNum; // Furnace number
-		static bool GetInputFlag( true ); // Logical to allow "GetInput" only once per simulation
 		Real64 HeatCoilLoad( 0.0 ); // Zone heating coil load
 		Real64 ReheatCoilLoad; // Load to be met by the reheat coil (if high humidity control)
 		Real64 ZoneLoad; // Control zone sensible load
@@ -369,7 +484,6 @@ namespace Furnaces {
 		Real64 H2OHtOfVap; // Heat of vaporization of air
 		int FurnaceInletNode; // Inlet node to furnace or unitary system
 		Real64 FurnaceSavMdot; // saved furnace inlet air mass flow rate [m3/s]
-		static Real64 Dummy( 0.0 );
 		int CompOp; // compressor operation; 1=on, 0=off
 		Real64 OnOffAirFlowRatio; // Ratio of compressor ON air flow to AVERAGE air flow over time step
 		int FanOpMode; // Fan operating mode (1=CycFanCycCoil, 2=ContFanCycCoil)
@@ -828,7 +942,6 @@ namespace Furnaces {
 		std::string CompSetCoolInlet;
 		std::string CompSetHeatInlet;
 		std::string CompSetHeatOutlet;
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int NumHeatOnly; // Number of heat only furnaces
@@ -4447,14 +4560,6 @@ namespace Furnaces {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true ); // one time allocation flag
-		static Array1D_bool MyEnvrnFlag; // environment flag
-		static Array1D_bool MySecondOneTimeFlag; // additional one time flag
-		static Array1D_bool MyFanFlag; // used for sizing fan inputs one time
-		static Array1D_bool MyCheckFlag; // Used to obtain the zone inlet node number in the controlled zone
-		static Array1D_bool MyFlowFracFlag; // Used for calculatig flow fraction once
-		static Array1D_bool MyPlantScanFlag; // used to initializa plant comp for water and steam heating coils
-		static Array1D_bool MySuppCoilPlantScanFlag; // used to initialize plant comp for water and steam heating coils
 		bool errFlag; // error flag for mining functions
 		Real64 FanVolFlowRate; // fan volumetric flow rate (m3/s)
 		Real64 QZnReq; // furnace load based on control zone frac (W)
@@ -4476,28 +4581,12 @@ namespace Furnaces {
 		std::string FanType; // used in warning messages
 		std::string FanName; // used in warning messages
 
-		static int ZoneInSysIndex( 0 ); // number of zone inlet nodes counter in an airloop
-		static int NumAirLoopZones( 0 ); // number of zone inlet nodes in an air loop
-		static int ZoneInletNodeNum( 0 ); // zone inlet nodes node number
-		static bool FlowFracFlagReady( true ); // one time flag for calculating flow fraction through controlled zone
-		static Real64 SumOfMassFlowRateMax( 0.0 ); // the sum of mass flow rates at inlet to zones in an airloop
-		static Real64 CntrlZoneTerminalUnitMassFlowRateMax( 0.0 ); // Maximum mass flow rate through controlled zone terminal unit
-		static int EquipNum( 0 ); // local do loop index for equipment listed for a zone
-
-		static bool ErrorsFound( false ); // flag returned from mining call
-		static Real64 mdot( 0.0 ); // local temporary for mass flow rate (kg/s)
-		static Real64 rho( 0.0 ); // local for fluid density
-		static int SteamIndex( 0 ); // index of steam quality for steam heating coil
-		static Real64 SteamDensity( 0.0 ); // density of steam at 100C, used for steam heating coils
-		static Real64 CoilMaxVolFlowRate( 0.0 ); // coil fluid maximum volume flow rate
-		static Real64 QActual( 0.0 ); // coil actual capacity
-		static Real64 SUPHEATERLOAD( 0.0 ); // SUPPLEMENTAL HEATER LOAD
+
 		int NumOfSpeedCooling; // Number of speeds for cooling
 		int NumOfSpeedHeating; // Number of speeds for heating
 		int InNode; // Inlet node number in MSHP loop
 		int OutNode; // Outlet node number in MSHP loop
 		Real64 RhoAir; // Air density at InNode
-		static bool MyAirLoopPass( true ); // one time allocation flag
 		int IHPIndex( 0 ); // coil id of IHP coil
 		int OperatingMode; // track cooling, heating, and no cooling or heating modes
 		int OperatingModeMinusOne;
@@ -4594,7 +4683,7 @@ namespace Furnaces {
 					if ( errFlag ) {
 						ShowFatalError( "InitFurnace: Program terminated for previous conditions." );
 					}
-					Furnace( FurnaceNum ).MaxHeatCoilFluidFlow = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", Furnace( FurnaceNum ).HeatingCoilName, ErrorsFound );
+					Furnace( FurnaceNum ).MaxHeatCoilFluidFlow = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", Furnace( FurnaceNum ).HeatingCoilName, InitFurnaceErrorsFound );
 					if ( Furnace( FurnaceNum ).MaxHeatCoilFluidFlow > 0.0 ) {
 						rho = GetDensityGlycol( PlantLoop( Furnace( FurnaceNum ).LoopNum ).FluidName, CWInitConvTemp, PlantLoop( Furnace( FurnaceNum ).LoopNum ).FluidIndex, RoutineName );
 						Furnace( FurnaceNum ).MaxHeatCoilFluidFlow *= rho;
@@ -4606,7 +4695,7 @@ namespace Furnaces {
 					if ( errFlag ) {
 						ShowFatalError( "InitFurnace: Program terminated for previous conditions." );
 					}
-					Furnace( FurnaceNum ).MaxHeatCoilFluidFlow = GetCoilMaxSteamFlowRate( Furnace( FurnaceNum ).HeatingCoilIndex, ErrorsFound );
+					Furnace( FurnaceNum ).MaxHeatCoilFluidFlow = GetCoilMaxSteamFlowRate( Furnace( FurnaceNum ).HeatingCoilIndex, InitFurnaceErrorsFound );
 					if ( Furnace( FurnaceNum ).MaxHeatCoilFluidFlow > 0.0 ) {
 						SteamIndex = 0; // Function GetSatDensityRefrig will look up steam index if 0 is passed
 						SteamDensity = GetSatDensityRefrig( fluidNameSteam, TempSteamIn, 1.0, SteamIndex, RoutineName );
@@ -4634,7 +4723,7 @@ namespace Furnaces {
 					if ( errFlag ) {
 						ShowFatalError( "InitFurnace: Program terminated for previous conditions." );
 					}
-					Furnace( FurnaceNum ).MaxSuppCoilFluidFlow = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", Furnace( FurnaceNum ).SuppHeatCoilName, ErrorsFound );
+					Furnace( FurnaceNum ).MaxSuppCoilFluidFlow = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", Furnace( FurnaceNum ).SuppHeatCoilName, InitFurnaceErrorsFound );
 					if ( Furnace( FurnaceNum ).MaxSuppCoilFluidFlow > 0.0 ) {
 						rho = GetDensityGlycol( PlantLoop( Furnace( FurnaceNum ).LoopNumSupp ).FluidName, CWInitConvTemp, PlantLoop( Furnace( FurnaceNum ).LoopNumSupp ).FluidIndex, RoutineName );
 						Furnace( FurnaceNum ).MaxSuppCoilFluidFlow *= rho;
@@ -4645,7 +4734,7 @@ namespace Furnaces {
 					if ( errFlag ) {
 						ShowFatalError( "InitFurnace: Program terminated for previous conditions." );
 					}
-					Furnace( FurnaceNum ).MaxSuppCoilFluidFlow = GetCoilMaxSteamFlowRate( Furnace( FurnaceNum ).SuppHeatCoilIndex, ErrorsFound );
+					Furnace( FurnaceNum ).MaxSuppCoilFluidFlow = GetCoilMaxSteamFlowRate( Furnace( FurnaceNum ).SuppHeatCoilIndex, InitFurnaceErrorsFound );
 					if ( Furnace( FurnaceNum ).MaxSuppCoilFluidFlow > 0.0 ) {
 						SteamIndex = 0; // Function GetSatDensityRefrig will look up steam index if 0 is passed
 						SteamDensity = GetSatDensityRefrig( fluidNameSteam, TempSteamIn, 1.0, SteamIndex, RoutineName );
@@ -4689,7 +4778,7 @@ namespace Furnaces {
 					// If water coil max water flow rate is autosized, simulate once in order to mine max flow rate
 					if ( Furnace( FurnaceNum ).HeatingCoilType_Num == Coil_HeatingWater ) {
 						SimulateWaterCoilComponents( Furnace( FurnaceNum ).HeatingCoilName, FirstHVACIteration, Furnace( FurnaceNum ).HeatingCoilIndex );
-						CoilMaxVolFlowRate = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", Furnace( FurnaceNum ).HeatingCoilName, ErrorsFound );
+						CoilMaxVolFlowRate = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", Furnace( FurnaceNum ).HeatingCoilName, InitFurnaceErrorsFound );
 						if ( CoilMaxVolFlowRate != AutoSize ) {
 							rho = GetDensityGlycol( PlantLoop( Furnace( FurnaceNum ).LoopNum ).FluidName, CWInitConvTemp, PlantLoop( Furnace( FurnaceNum ).LoopNum ).FluidIndex, RoutineName );
 							Furnace( FurnaceNum ).MaxHeatCoilFluidFlow = CoilMaxVolFlowRate * rho;
@@ -4698,7 +4787,7 @@ namespace Furnaces {
 					// If steam coil max steam flow rate is autosized, simulate once in order to mine max flow rate
 					if ( Furnace( FurnaceNum ).HeatingCoilType_Num == Coil_HeatingSteam ) {
 						SimulateSteamCoilComponents( Furnace( FurnaceNum ).HeatingCoilName, FirstHVACIteration, Furnace( FurnaceNum ).HeatingCoilIndex, 1.0, QActual ); //QCoilReq, simulate any load > 0 to get max capacity
-						CoilMaxVolFlowRate = GetCoilMaxSteamFlowRate( Furnace( FurnaceNum ).HeatingCoilIndex, ErrorsFound );
+						CoilMaxVolFlowRate = GetCoilMaxSteamFlowRate( Furnace( FurnaceNum ).HeatingCoilIndex, InitFurnaceErrorsFound );
 						if ( CoilMaxVolFlowRate != AutoSize ) {
 							SteamIndex = 0; // Function GetSatDensityRefrig will look up steam index if 0 is passed
 							SteamDensity = GetSatDensityRefrig( fluidNameSteam, TempSteamIn, 1.0, SteamIndex, RoutineName );
@@ -4714,7 +4803,7 @@ namespace Furnaces {
 					if ( Furnace( FurnaceNum ).SuppHeatCoilType_Num == Coil_HeatingWater ) {
 						// If water coil max water flow rate is autosized, simulate once in order to mine max flow rate
 						SimulateWaterCoilComponents( Furnace( FurnaceNum ).SuppHeatCoilName, FirstHVACIteration, Furnace( FurnaceNum ).SuppHeatCoilIndex );
-						CoilMaxVolFlowRate = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", Furnace( FurnaceNum ).SuppHeatCoilName, ErrorsFound );
+						CoilMaxVolFlowRate = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", Furnace( FurnaceNum ).SuppHeatCoilName, InitFurnaceErrorsFound );
 						if ( CoilMaxVolFlowRate != AutoSize ) {
 							rho = GetDensityGlycol( PlantLoop( Furnace( FurnaceNum ).LoopNumSupp ).FluidName, CWInitConvTemp, PlantLoop( Furnace( FurnaceNum ).LoopNumSupp ).FluidIndex, RoutineName );
 							Furnace( FurnaceNum ).MaxSuppCoilFluidFlow = CoilMaxVolFlowRate * rho;
@@ -4722,7 +4811,7 @@ namespace Furnaces {
 					}
 					if ( Furnace( FurnaceNum ).SuppHeatCoilType_Num == Coil_HeatingSteam ) {
 						SimulateSteamCoilComponents( Furnace( FurnaceNum ).SuppHeatCoilName, FirstHVACIteration, Furnace( FurnaceNum ).SuppHeatCoilIndex, 1.0, QActual ); //QCoilReq, simulate any load > 0 to get max capacity
-						CoilMaxVolFlowRate = GetCoilMaxSteamFlowRate( Furnace( FurnaceNum ).SuppHeatCoilIndex, ErrorsFound );
+						CoilMaxVolFlowRate = GetCoilMaxSteamFlowRate( Furnace( FurnaceNum ).SuppHeatCoilIndex, InitFurnaceErrorsFound );
 						if ( CoilMaxVolFlowRate != AutoSize ) {
 							SteamIndex = 0; // Function GetSatDensityRefrig will look up steam index if 0 is passed
 							SteamDensity = GetSatDensityRefrig( fluidNameSteam, TempSteamIn, 1.0, SteamIndex, RoutineName );
@@ -4952,7 +5041,7 @@ namespace Furnaces {
 
 				//     simulate steam coil to find operating capacity
 				SimulateSteamCoilComponents( Furnace( FurnaceNum ).HeatingCoilName, FirstHVACIteration, Furnace( FurnaceNum ).HeatingCoilIndex, 1.0, QActual ); //QCoilReq, simulate any load > 0 to get max capacity of steam coil
-				Furnace( FurnaceNum ).DesignHeatingCapacity = GetSteamCoilCapacity( Furnace( FurnaceNum ).HeatingCoilType, Furnace( FurnaceNum ).HeatingCoilName, ErrorsFound );
+				Furnace( FurnaceNum ).DesignHeatingCapacity = GetSteamCoilCapacity( Furnace( FurnaceNum ).HeatingCoilType, Furnace( FurnaceNum ).HeatingCoilName, InitFurnaceErrorsFound );
 
 			} // from IF(Furnace(FurnaceNum)%HeatingCoilType_Num == Coil_HeatingSteam) THEN
 
@@ -4976,7 +5065,7 @@ namespace Furnaces {
 
 				//     simulate steam coil to find operating capacity
 				SimulateSteamCoilComponents( Furnace( FurnaceNum ).SuppHeatCoilName, FirstHVACIteration, Furnace( FurnaceNum ).SuppHeatCoilIndex, 1.0, QActual ); //QCoilReq, simulate any load > 0 to get max capacity of steam coil
-				Furnace( FurnaceNum ).DesignSuppHeatingCapacity = GetSteamCoilCapacity( Furnace( FurnaceNum ).SuppHeatCoilType, Furnace( FurnaceNum ).SuppHeatCoilName, ErrorsFound );
+				Furnace( FurnaceNum ).DesignSuppHeatingCapacity = GetSteamCoilCapacity( Furnace( FurnaceNum ).SuppHeatCoilType, Furnace( FurnaceNum ).SuppHeatCoilName, InitFurnaceErrorsFound );
 
 			} // from IF(Furnace(FurnaceNum)%SuppHeatCoilType_Num == Coil_HeatingSteam) THEN
 		} // from IF( FirstHVACIteration ) THEN
@@ -5816,7 +5905,6 @@ namespace Furnaces {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Real64 cpair;
-		static Real64 Error( 1.0 );
 		Real64 SystemSensibleLoad; // Sensible load to be met by furnace (W)
 		Real64 FullSensibleOutput; // Full sensible output of furnace (W)
 		Real64 FullLatentOutput; // Full latent output of furnace = 0 (W)
@@ -5830,7 +5918,6 @@ namespace Furnaces {
 		Real64 deltaT; // Heater outlet temp minus design heater outlet temp
 		//  CHARACTER(len=20) :: ErrNum = ' '         ! For displaying error message in cooling
 		//  INTEGER,SAVE      :: ErrCount = 0
-		static int Iter( 0 ); // Iteration counter
 		int FurnaceInletNode; // Node number of furnace inlet
 		int FurnaceOutletNode; // Node number of furnace outlet
 		int OpMode; // Mode of Operation (fan cycling or fan continuous)
@@ -6071,8 +6158,6 @@ namespace Furnaces {
 		int FurnaceInletNode; // Inlet node to furnace or unitary system
 		int FurnaceOutletNode; // Outlet node of furnace or unitary system
 		int OpMode; // Mode of Operation (fan cycling = 1 or fan continuous = 2)
-		static Real64 CoolCoilLoad; // Negative value means cooling required
-		static Real64 SystemSensibleLoad; // Positive value means heating required
 		Real64 CoolErrorToler; // Error tolerance in cooling mode
 		Real64 HeatErrorToler; // Error tolerance in heating mode
 		Real64 ActualSensibleOutput; // Actual furnace sensible capacity
@@ -6084,7 +6169,6 @@ namespace Furnaces {
 		Real64 TempHeatOutput; // Temporary Sensible output of heating coil while iterating on PLR (W)
 		Real64 TempLatentOutput; // Temporary Latent output of AC at increasing PLR (W)
 		//                                           ! (Temp variables are used to find min PLR for positive latent removal)
-		static bool HumControl( false ); // Logical flag signaling when dehumidification is required
 		Array1D< Real64 > Par( 10 ); // parameters passed to RegulaFalsi function
 		int SolFlag; // return flag from RegulaFalsi
 		Real64 TempMinPLR; // Temporary min latent PLR when hum control is required and iter is exceeded
@@ -6279,7 +6363,7 @@ namespace Furnaces {
 							Par( 9 ) = 0.0; // HXUnitOn is always false for HX
 							Par( 10 ) = 0.0;
 							//         HeatErrorToler is in fraction of load, MaxIter = 30, SolFalg = # of iterations or error as appropriate
-							SolveRegulaFalsi( HeatErrorToler, MaxIter, SolFlag, PartLoadRatio, CalcFurnaceResidual, 0.0, 1.0, Par );
+							SolveRegulaFalsi( HeatErrorToler, MaxIter, SolFlag, PartLoadRatio, CalcFurnaceResidual, 0.0, 1.0, Par, "CalcNewZoneHeatCoolFlowRates" );
 							//         OnOffAirFlowRatio is updated during the above iteration. Reset to correct value based on PLR.
 							OnOffAirFlowRatio = OnOffAirFlowRatioSave;
 							if ( SolFlag == -1 ) {
@@ -6459,7 +6543,7 @@ namespace Furnaces {
 							Par( 9 ) = 0.0; // HXUnitOn is always false for HX
 							Par( 10 ) = 0.0;
 							//         HeatErrorToler is in fraction load, MaxIter = 30, SolFalg = # of iterations or error as appropriate
-							SolveRegulaFalsi( HeatErrorToler, MaxIter, SolFlag, PartLoadRatio, CalcFurnaceResidual, 0.0, 1.0, Par );
+							SolveRegulaFalsi( HeatErrorToler, MaxIter, SolFlag, PartLoadRatio, CalcFurnaceResidual, 0.0, 1.0, Par, "CalcNewZoneHeatCoolFlowRates" );
 							//         OnOffAirFlowRatio is updated during the above iteration. Reset to correct value based on PLR.
 							OnOffAirFlowRatio = OnOffAirFlowRatioSave;
 							//         Reset HeatCoilLoad calculated in CalcFurnaceResidual (in case it was reset because output temp > DesignMaxOutletTemp)
@@ -6491,7 +6575,7 @@ namespace Furnaces {
 									CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, 0.0, TempMinPLR, HeatCoilLoad, 0.0, TempHeatOutput, TempLatentOutput, OnOffAirFlowRatio, false );
 								}
 								//           Now solve again with tighter PLR limits
-								SolveRegulaFalsi( HeatErrorToler, MaxIter, SolFlag, PartLoadRatio, CalcFurnaceResidual, TempMinPLR, TempMaxPLR, Par );
+								SolveRegulaFalsi( HeatErrorToler, MaxIter, SolFlag, PartLoadRatio, CalcFurnaceResidual, TempMinPLR, TempMaxPLR, Par, "CalcNewZoneHeatCoolFlowRates" );
 								if ( ModifiedHeatCoilLoad > 0.0 ) {
 									HeatCoilLoad = ModifiedHeatCoilLoad;
 								} else {
@@ -6637,7 +6721,7 @@ namespace Furnaces {
 							//             Par(10) is the heating coil PLR, set this value to 0 for sensible PLR calculations.
 							Par( 10 ) = 0.0;
 							//             CoolErrorToler is in fraction of load, MaxIter = 30, SolFalg = # of iterations or error as appropriate
-							SolveRegulaFalsi( CoolErrorToler, MaxIter, SolFlag, PartLoadRatio, CalcFurnaceResidual, 0.0, 1.0, Par );
+							SolveRegulaFalsi( CoolErrorToler, MaxIter, SolFlag, PartLoadRatio, CalcFurnaceResidual, 0.0, 1.0, Par, "CalcNewZoneHeatCoolFlowRates" );
 							//             OnOffAirFlowRatio is updated during the above iteration. Reset to correct value based on PLR.
 							OnOffAirFlowRatio = OnOffAirFlowRatioSave;
 							if ( SolFlag == -1 ) {
@@ -6753,7 +6837,7 @@ namespace Furnaces {
 								Par( 10 ) = 0.0;
 							}
 							//           CoolErrorToler is in fraction of load, MaxIter = 30, SolFalg = # of iterations or error as appropriate
-							SolveRegulaFalsi( CoolErrorToler, MaxIter, SolFlag, LatentPartLoadRatio, CalcFurnaceResidual, 0.0, 1.0, Par );
+							SolveRegulaFalsi( CoolErrorToler, MaxIter, SolFlag, LatentPartLoadRatio, CalcFurnaceResidual, 0.0, 1.0, Par, "CalcNewZoneHeatCoolFlowRates" );
 							//           OnOffAirFlowRatio is updated during the above iteration. Reset to correct value based on PLR.
 							OnOffAirFlowRatio = OnOffAirFlowRatioSave;
 							if ( SolFlag == -1 ) {
@@ -6803,7 +6887,7 @@ namespace Furnaces {
 									CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, TempMinPLR2, 0.0, 0.0, 0.0, TempCoolOutput, TempLatentOutput, OnOffAirFlowRatio, HXUnitOn, CoolingHeatingPLRRatio );
 								}
 								//             tighter boundary of solution has been found, call RegulaFalsi a second time
-								SolveRegulaFalsi( CoolErrorToler, MaxIter, SolFlag, LatentPartLoadRatio, CalcFurnaceResidual, TempMinPLR2, TempMaxPLR, Par );
+								SolveRegulaFalsi( CoolErrorToler, MaxIter, SolFlag, LatentPartLoadRatio, CalcFurnaceResidual, TempMinPLR2, TempMaxPLR, Par, "CalcNewZoneHeatCoolFlowRates" );
 								//             OnOffAirFlowRatio is updated during the above iteration. Reset to correct value based on PLR.
 								OnOffAirFlowRatio = OnOffAirFlowRatioSave;
 								if ( SolFlag == -1 ) {
@@ -7053,9 +7137,7 @@ namespace Furnaces {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Real64 OnOffAirFlowRatio; // Ratio of compressor ON air mass flow to AVERAGE air mass flow over time step
-		static Real64 TotalZoneLatentLoad; // Total ZONE latent load (not including outside air)
 		// to be removed by furnace/unitary system
-		static Real64 TotalZoneSensLoad; // Total ZONE heating load (not including outside air)
 		// to be removed by furnace/unitary system
 		Real64 cpair; // Heat capacity of air
 		Real64 ZoneSensLoadMet; // Actual zone sensible load met by heat pump (W)
@@ -7074,9 +7156,6 @@ namespace Furnaces {
 		int OASysInletNode; // node number of return air inlet to OA sys
 		int OASysOutletNode; // node number of mixed air outlet of OA sys
 		int OpMode; // Mode of Operation (fan cycling = 1 or fan continuous = 2)
-		static Real64 CoolPartLoadRatio; // Part load ratio (greater of sensible or latent part load ratio for cooling)
-		static Real64 HeatPartLoadRatio; // Part load ratio (greater of sensible or latent part load ratio for cooling)
-		static Real64 Dummy( 0.0 ); // Dummy var. for generic calc. furnace output arg. (n/a for heat pump)
 		bool HumControl; // Logical flag signaling when dehumidification is required
 		Real64 SuppHeatCoilLoad; // Load passed to supplemental heater (W)
 		Real64 CoolErrorToler; // convergence tolerance used in cooling mode
@@ -7085,7 +7164,7 @@ namespace Furnaces {
 		Array1D< Real64 > Par( 9 ); // parameters passed to iteration routine
 
 		// Set local variables
-		Dummy = 0.0;
+		CalcWaterToAirHeatPumpDummy = 0.0;
 		OnOffAirFlowRatio = 1.0;
 		FurnaceOutletNode = Furnace( FurnaceNum ).FurnaceOutletNodeNum;
 		FurnaceInletNode = Furnace( FurnaceNum ).FurnaceInletNodeNum;
@@ -7145,19 +7224,19 @@ namespace Furnaces {
 			Furnace( FurnaceNum ).CompPartLoadRatio = 0.0; //compressor off
 			Furnace( FurnaceNum ).InitHeatPump = true; //initialization call to Calc Furnace
 			Furnace( FurnaceNum ).WSHPRuntimeFrac = 0.0;
-			CoolPartLoadRatio = 0.0;
+			CalcWaterToAirHeatPumpCoolPartLoadRatio = 0.0;
 
 			//Get no load result in order to calculate the effect of the fan and the mixed air equipment
-			CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CoolPartLoadRatio, HeatPartLoadRatio, Dummy, Dummy, ZoneSensLoadMetFanONCompOFF, ZoneLatLoadMetFanONCompOFF, OnOffAirFlowRatio, false );
+			CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CalcWaterToAirHeatPumpCoolPartLoadRatio, CalcWaterToAirHeatPumpHeatPartLoadRatio, CalcWaterToAirHeatPumpDummy, CalcWaterToAirHeatPumpDummy, ZoneSensLoadMetFanONCompOFF, ZoneLatLoadMetFanONCompOFF, OnOffAirFlowRatio, false );
 
 			//Set the input parameters for CalcFurnaceOutput
 			Furnace( FurnaceNum ).CoolingCoilSensDemand = 1.0;
 			Furnace( FurnaceNum ).CompPartLoadRatio = 1.0; //compressor ON
 			Furnace( FurnaceNum ).WSHPRuntimeFrac = 1.0;
-			CoolPartLoadRatio = 1.0;
+			CalcWaterToAirHeatPumpCoolPartLoadRatio = 1.0;
 
 			//Get full load result in order to estimate the operating part load ratio for continuous fan operation
-			CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CoolPartLoadRatio, HeatPartLoadRatio, Dummy, Dummy, ZoneSensLoadMetFanONCompON, ZoneLatLoadMetFanONCompON, OnOffAirFlowRatio, false );
+			CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CalcWaterToAirHeatPumpCoolPartLoadRatio, CalcWaterToAirHeatPumpHeatPartLoadRatio, CalcWaterToAirHeatPumpDummy, CalcWaterToAirHeatPumpDummy, ZoneSensLoadMetFanONCompON, ZoneLatLoadMetFanONCompON, OnOffAirFlowRatio, false );
 
 			//Calculate the heating coil demand for continuous fan operation as:
 			//    (the zone sensible load - the zone sensible load met by fan heat and mixed air)
@@ -7173,24 +7252,24 @@ namespace Furnaces {
 
 			//Calculate the part load ratio for continuous fan operation with cycling coil
 			if ( HPCoilSensCapacity == 0.0 ) {
-				CoolPartLoadRatio = 0.0;
+				CalcWaterToAirHeatPumpCoolPartLoadRatio = 0.0;
 			} else {
-				CoolPartLoadRatio = max( MinPLR, min( 1.0, std::abs( HPCoilSensDemand ) / std::abs( HPCoilSensCapacity ) ) );
+				CalcWaterToAirHeatPumpCoolPartLoadRatio = max( MinPLR, min( 1.0, std::abs( HPCoilSensDemand ) / std::abs( HPCoilSensCapacity ) ) );
 			}
 
 			Furnace( FurnaceNum ).InitHeatPump = false;
 
 			//       check bounds on sensible output prior to iteration using RegulaFalsi
 			if ( ZoneSensLoadMetFanONCompON > TotalZoneSensLoad ) {
-				CoolPartLoadRatio = 1.0;
+				CalcWaterToAirHeatPumpCoolPartLoadRatio = 1.0;
 				HPCoilSensDemand = std::abs( ZoneSensLoadMetFanONCompON - ZoneSensLoadMetFanONCompOFF );
 				Furnace( FurnaceNum ).CoolingCoilSensDemand = HPCoilSensDemand;
 			} else if ( ZoneSensLoadMetFanONCompOFF < TotalZoneSensLoad ) {
-				CoolPartLoadRatio = 0.0;
+				CalcWaterToAirHeatPumpCoolPartLoadRatio = 0.0;
 				Furnace( FurnaceNum ).CompPartLoadRatio = 0.0; //compressor OFF
 				Furnace( FurnaceNum ).WSHPRuntimeFrac = 0.0;
 				Furnace( FurnaceNum ).CoolingCoilSensDemand = 0.0;
-				CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CoolPartLoadRatio, HeatPartLoadRatio, Dummy, Dummy, ZoneSensLoadMetFanONCompOFF, ZoneLatLoadMetFanONCompOFF, OnOffAirFlowRatio, false );
+				CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CalcWaterToAirHeatPumpCoolPartLoadRatio, CalcWaterToAirHeatPumpHeatPartLoadRatio, CalcWaterToAirHeatPumpDummy, CalcWaterToAirHeatPumpDummy, ZoneSensLoadMetFanONCompOFF, ZoneLatLoadMetFanONCompOFF, OnOffAirFlowRatio, false );
 			} else {
 				//         Calculate the sensible part load ratio through iteration
 				CoolErrorToler = Furnace( FurnaceNum ).CoolingConvergenceTolerance;
@@ -7206,10 +7285,10 @@ namespace Furnaces {
 				Par( 8 ) = ZoneSensLoadMetFanONCompOFF; // Output with fan ON compressor OFF
 				Par( 9 ) = 0.0; // HX is off for water-to-air HP
 				//         CoolErrorToler is in fraction of load, MaxIter = 600, SolFalg = # of iterations or error as appropriate
-				SolveRegulaFalsi( CoolErrorToler, MaxIter, SolFlag, CoolPartLoadRatio, CalcWaterToAirResidual, 0.0, 1.0, Par );
+				SolveRegulaFalsi( CoolErrorToler, MaxIter, SolFlag, CalcWaterToAirHeatPumpCoolPartLoadRatio, CalcWaterToAirResidual, 0.0, 1.0, Par, "CalcWaterToAirHeatPump" );
 				if ( SolFlag == -1 && !WarmupFlag && !FirstHVACIteration ) {
 					OnOffFanPartLoadFraction = OnOffFanPartLoadFractionSave;
-					CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CoolPartLoadRatio, 0.0, 0.0, 0.0, ZoneSensLoadMet, ZoneLatLoadMet, OnOffAirFlowRatio, false );
+					CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CalcWaterToAirHeatPumpCoolPartLoadRatio, 0.0, 0.0, 0.0, ZoneSensLoadMet, ZoneLatLoadMet, OnOffAirFlowRatio, false );
 					if ( std::abs( ZoneSensLoadMet - TotalZoneSensLoad ) / TotalZoneSensLoad > CoolErrorToler ) {
 						if ( Furnace( FurnaceNum ).SensibleMaxIterIndex == 0 ) {
 							ShowWarningMessage( "Cooling coil control failed to converge for " + cFurnaceTypes( Furnace( FurnaceNum ).FurnaceType_Num ) + ':' + Furnace( FurnaceNum ).Name );
@@ -7219,14 +7298,14 @@ namespace Furnaces {
 						ShowRecurringWarningErrorAtEnd( cFurnaceTypes( Furnace( FurnaceNum ).FurnaceType_Num ) + " \"" + Furnace( FurnaceNum ).Name + "\" - Iteration limit exceeded in calculating sensible cooling part-load ratio error continues. Sensible load statistics:", Furnace( FurnaceNum ).SensibleMaxIterIndex, TotalZoneSensLoad, TotalZoneSensLoad );
 					}
 				} else if ( SolFlag == -2 && !WarmupFlag && !FirstHVACIteration ) {
-					CoolPartLoadRatio = max( MinPLR, min( 1.0, std::abs( HPCoilSensDemand ) / std::abs( HPCoilSensCapacity ) ) );
+					CalcWaterToAirHeatPumpCoolPartLoadRatio = max( MinPLR, min( 1.0, std::abs( HPCoilSensDemand ) / std::abs( HPCoilSensCapacity ) ) );
 					OnOffFanPartLoadFraction = 1.0;
-					CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CoolPartLoadRatio, 0.0, 0.0, 0.0, ZoneSensLoadMet, ZoneLatLoadMet, OnOffAirFlowRatio, false );
+					CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CalcWaterToAirHeatPumpCoolPartLoadRatio, 0.0, 0.0, 0.0, ZoneSensLoadMet, ZoneLatLoadMet, OnOffAirFlowRatio, false );
 					if ( ( ZoneSensLoadMet - TotalZoneSensLoad ) / TotalZoneSensLoad > CoolErrorToler ) {
 						if ( Furnace( FurnaceNum ).SensibleRegulaFalsiFailedIndex == 0 ) {
 							ShowWarningMessage( "Cooling coil control failed for " + cFurnaceTypes( Furnace( FurnaceNum ).FurnaceType_Num ) + ':' + Furnace( FurnaceNum ).Name );
 							ShowContinueError( "  Cooling sensible part-load ratio determined to be outside the range of 0-1." );
-							ShowContinueError( "  An estimated part-load ratio = " + TrimSigDigits( CoolPartLoadRatio, 2 ) + " will be used and the simulation continues." );
+							ShowContinueError( "  An estimated part-load ratio = " + TrimSigDigits( CalcWaterToAirHeatPumpCoolPartLoadRatio, 2 ) + " will be used and the simulation continues." );
 							ShowContinueError( "  The estimated part-load ratio provides a cooling sensible capacity = " + TrimSigDigits( ZoneSensLoadMet, 2 ) );
 							ShowContinueErrorTimeStamp( "  Cooling sensible load required = " + TrimSigDigits( TotalZoneSensLoad, 2 ) );
 						}
@@ -7236,7 +7315,7 @@ namespace Furnaces {
 			}
 
 			if ( OpMode == CycFanCycCoil ) {
-				Furnace( FurnaceNum ).MdotFurnace *= CoolPartLoadRatio;
+				Furnace( FurnaceNum ).MdotFurnace *= CalcWaterToAirHeatPumpCoolPartLoadRatio;
 			}
 
 			//*********HEATING CALCULATIONS****************
@@ -7257,20 +7336,20 @@ namespace Furnaces {
 			Furnace( FurnaceNum ).CompPartLoadRatio = 0.0; //compressor off
 			Furnace( FurnaceNum ).InitHeatPump = true; //initialization call to Calc Furnace
 			Furnace( FurnaceNum ).WSHPRuntimeFrac = 0.0;
-			HeatPartLoadRatio = 0.0;
+			CalcWaterToAirHeatPumpHeatPartLoadRatio = 0.0;
 
 			//Get no load result in order to calculate the effect of the fan and the mixed air equipment
-			CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CoolPartLoadRatio, HeatPartLoadRatio, Dummy, Dummy, ZoneSensLoadMetFanONCompOFF, ZoneLatLoadMetFanONCompOFF, OnOffAirFlowRatio, false );
+			CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CalcWaterToAirHeatPumpCoolPartLoadRatio, CalcWaterToAirHeatPumpHeatPartLoadRatio, CalcWaterToAirHeatPumpDummy, CalcWaterToAirHeatPumpDummy, ZoneSensLoadMetFanONCompOFF, ZoneLatLoadMetFanONCompOFF, OnOffAirFlowRatio, false );
 
 			//Set the input parameters for CalcFurnaceOutput
 			Furnace( FurnaceNum ).HeatingCoilSensDemand = 1.0;
 			Furnace( FurnaceNum ).CompPartLoadRatio = 1.0; //compressor ON
 			Furnace( FurnaceNum ).WSHPRuntimeFrac = 1.0;
-			HeatPartLoadRatio = 1.0;
+			CalcWaterToAirHeatPumpHeatPartLoadRatio = 1.0;
 
 			//Get full load result in order to estimate the operating part load ratio for continuous fan operation
 
-			CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CoolPartLoadRatio, HeatPartLoadRatio, Dummy, Dummy, ZoneSensLoadMetFanONCompON, ZoneLatLoadMetFanONCompON, OnOffAirFlowRatio, false );
+			CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CalcWaterToAirHeatPumpCoolPartLoadRatio, CalcWaterToAirHeatPumpHeatPartLoadRatio, CalcWaterToAirHeatPumpDummy, CalcWaterToAirHeatPumpDummy, ZoneSensLoadMetFanONCompON, ZoneLatLoadMetFanONCompON, OnOffAirFlowRatio, false );
 
 			//Calculate the heating coil demand for continuous fan operation as:
 			//    (the zone sensible load - the zone sensible load met by fan heat and mixed air)
@@ -7286,25 +7365,25 @@ namespace Furnaces {
 
 			//Calculate the part load ratio for continuous fan operation with cycling coil
 			if ( HPCoilSensCapacity == 0.0 ) {
-				HeatPartLoadRatio = 0.0;
+				CalcWaterToAirHeatPumpHeatPartLoadRatio = 0.0;
 			} else {
-				HeatPartLoadRatio = max( MinPLR, min( 1.0, std::abs( HPCoilSensDemand ) / std::abs( HPCoilSensCapacity ) ) );
+				CalcWaterToAirHeatPumpHeatPartLoadRatio = max( MinPLR, min( 1.0, std::abs( HPCoilSensDemand ) / std::abs( HPCoilSensCapacity ) ) );
 			}
 
 			Furnace( FurnaceNum ).InitHeatPump = false;
 
 			//       check bounds on sensible output prior to iteration using RegulaFalsi
 			if ( ZoneSensLoadMetFanONCompON < TotalZoneSensLoad ) {
-				HeatPartLoadRatio = 1.0;
+				CalcWaterToAirHeatPumpHeatPartLoadRatio = 1.0;
 				ZoneSensLoadMet = ZoneSensLoadMetFanONCompON;
 				HPCoilSensDemand = std::abs( ZoneSensLoadMetFanONCompON - ZoneSensLoadMetFanONCompOFF );
 				Furnace( FurnaceNum ).HeatingCoilSensDemand = HPCoilSensDemand;
 			} else if ( ZoneSensLoadMetFanONCompOFF > TotalZoneSensLoad ) {
-				HeatPartLoadRatio = 0.0;
+				CalcWaterToAirHeatPumpHeatPartLoadRatio = 0.0;
 				ZoneSensLoadMet = ZoneSensLoadMetFanONCompOFF;
 				Furnace( FurnaceNum ).CompPartLoadRatio = 0.0; //compressor ON
 				Furnace( FurnaceNum ).WSHPRuntimeFrac = 0.0;
-				CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CoolPartLoadRatio, HeatPartLoadRatio, Dummy, Dummy, ZoneSensLoadMet, ZoneLatLoadMet, OnOffAirFlowRatio, false );
+				CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CalcWaterToAirHeatPumpCoolPartLoadRatio, CalcWaterToAirHeatPumpHeatPartLoadRatio, CalcWaterToAirHeatPumpDummy, CalcWaterToAirHeatPumpDummy, ZoneSensLoadMet, ZoneLatLoadMet, OnOffAirFlowRatio, false );
 			} else {
 				//         Calculate the sensible part load ratio through iteration
 				HeatErrorToler = Furnace( FurnaceNum ).HeatingConvergenceTolerance;
@@ -7320,9 +7399,9 @@ namespace Furnaces {
 				Par( 8 ) = ZoneSensLoadMetFanONCompOFF; // Output with fan ON compressor OFF
 				Par( 9 ) = 0.0; // HX is OFF for water-to-air HP
 				//         HeatErrorToler is in fraction of load, MaxIter = 600, SolFalg = # of iterations or error as appropriate
-				SolveRegulaFalsi( HeatErrorToler, MaxIter, SolFlag, HeatPartLoadRatio, CalcWaterToAirResidual, 0.0, 1.0, Par );
+				SolveRegulaFalsi( HeatErrorToler, MaxIter, SolFlag, CalcWaterToAirHeatPumpHeatPartLoadRatio, CalcWaterToAirResidual, 0.0, 1.0, Par, "CalcWaterToAirHeatPump" );
 				OnOffFanPartLoadFraction = OnOffFanPartLoadFractionSave;
-				CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CoolPartLoadRatio, HeatPartLoadRatio, Dummy, Dummy, ZoneSensLoadMet, ZoneLatLoadMet, OnOffAirFlowRatio, false );
+				CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CalcWaterToAirHeatPumpCoolPartLoadRatio, CalcWaterToAirHeatPumpHeatPartLoadRatio, CalcWaterToAirHeatPumpDummy, CalcWaterToAirHeatPumpDummy, ZoneSensLoadMet, ZoneLatLoadMet, OnOffAirFlowRatio, false );
 				if ( SolFlag == -1 && !WarmupFlag && !FirstHVACIteration ) {
 					if ( std::abs( ZoneSensLoadMet - TotalZoneSensLoad ) / TotalZoneSensLoad > HeatErrorToler ) {
 						if ( Furnace( FurnaceNum ).WSHPHeatMaxIterIndex == 0 ) {
@@ -7333,13 +7412,13 @@ namespace Furnaces {
 						ShowRecurringWarningErrorAtEnd( cFurnaceTypes( Furnace( FurnaceNum ).FurnaceType_Num ) + " \"" + Furnace( FurnaceNum ).Name + "\" - Iteration limit exceeded in calculating sensible heating part-load ratio error continues.", Furnace( FurnaceNum ).WSHPHeatMaxIterIndex, TotalZoneSensLoad, TotalZoneSensLoad );
 					}
 				} else if ( SolFlag == -2 ) {
-					HeatPartLoadRatio = max( MinPLR, min( 1.0, std::abs( HPCoilSensDemand ) / std::abs( HPCoilSensCapacity ) ) );
-					CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, 0.0, HeatPartLoadRatio, 0.0, 0.0, ZoneSensLoadMet, ZoneLatLoadMet, OnOffAirFlowRatio, false );
+					CalcWaterToAirHeatPumpHeatPartLoadRatio = max( MinPLR, min( 1.0, std::abs( HPCoilSensDemand ) / std::abs( HPCoilSensCapacity ) ) );
+					CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, 0.0, CalcWaterToAirHeatPumpHeatPartLoadRatio, 0.0, 0.0, ZoneSensLoadMet, ZoneLatLoadMet, OnOffAirFlowRatio, false );
 					if ( ( ZoneSensLoadMet - TotalZoneSensLoad ) / TotalZoneSensLoad > HeatErrorToler ) {
 						if ( Furnace( FurnaceNum ).WSHPHeatRegulaFalsiFailedIndex == 0 ) {
 							ShowWarningError( "Heating coil control failed for " + cFurnaceTypes( Furnace( FurnaceNum ).FurnaceType_Num ) + ':' + Furnace( FurnaceNum ).Name );
 							ShowContinueError( "  Heating sensible part-load ratio determined to be outside the range of 0-1." );
-							ShowContinueError( "  An estimated part-load ratio = " + TrimSigDigits( HeatPartLoadRatio, 2 ) + " will be used and the simulation continues." );
+							ShowContinueError( "  An estimated part-load ratio = " + TrimSigDigits( CalcWaterToAirHeatPumpHeatPartLoadRatio, 2 ) + " will be used and the simulation continues." );
 							ShowContinueError( "  The estimated part-load ratio provides a heating sensible capacity = " + TrimSigDigits( ZoneSensLoadMet, 2 ) );
 							ShowContinueErrorTimeStamp( "  Heating sensible load required = " + TrimSigDigits( TotalZoneSensLoad, 2 ) );
 						}
@@ -7349,20 +7428,20 @@ namespace Furnaces {
 			}
 
 			//       CALL supplemental heater if required
-			if ( ( TotalZoneSensLoad - ZoneSensLoadMet ) > SmallLoad && HeatPartLoadRatio >= 1.0 ) {
+			if ( ( TotalZoneSensLoad - ZoneSensLoadMet ) > SmallLoad && CalcWaterToAirHeatPumpHeatPartLoadRatio >= 1.0 ) {
 				SuppHeatCoilLoad = TotalZoneSensLoad - ZoneSensLoadMet;
-				CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CoolPartLoadRatio, HeatPartLoadRatio, SuppHeatCoilLoad, Dummy, ZoneSensLoadMet, ZoneLatLoadMet, OnOffAirFlowRatio, false );
+				CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CalcWaterToAirHeatPumpCoolPartLoadRatio, CalcWaterToAirHeatPumpHeatPartLoadRatio, SuppHeatCoilLoad, CalcWaterToAirHeatPumpDummy, ZoneSensLoadMet, ZoneLatLoadMet, OnOffAirFlowRatio, false );
 			}
 
 			if ( OpMode == CycFanCycCoil ) {
-				Furnace( FurnaceNum ).MdotFurnace *= HeatPartLoadRatio;
+				Furnace( FurnaceNum ).MdotFurnace *= CalcWaterToAirHeatPumpHeatPartLoadRatio;
 			}
 
 			//**********HVAC Scheduled ON, but no cooling, dehumidification or heating load*********
 		} else if ( GetCurrentScheduleValue( Furnace( FurnaceNum ).SchedPtr ) > 0.0 ) {
 			Furnace( FurnaceNum ).InitHeatPump = true; //initialization call to Calc Furnace
-			HeatPartLoadRatio = 0.0;
-			CoolPartLoadRatio = 0.0;
+			CalcWaterToAirHeatPumpHeatPartLoadRatio = 0.0;
+			CalcWaterToAirHeatPumpCoolPartLoadRatio = 0.0;
 			OnOffFanPartLoadFraction = 1.0; //!see 'Note' under INITIAL CALCULATIONS
 			//set report variables
 			Furnace( FurnaceNum ).CompPartLoadRatio = 0.0;
@@ -7372,23 +7451,23 @@ namespace Furnaces {
 			if ( OpMode == CycFanCycCoil ) {
 				Furnace( FurnaceNum ).MdotFurnace = 0.0;
 				OnOffFanPartLoadFraction = 1.0; //see 'Note' under INITIAL CALCULATIONS
-				CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CoolPartLoadRatio, HeatPartLoadRatio, Dummy, Dummy, ZoneSensLoadMet, ZoneLatLoadMet, OnOffAirFlowRatio, false );
+				CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CalcWaterToAirHeatPumpCoolPartLoadRatio, CalcWaterToAirHeatPumpHeatPartLoadRatio, CalcWaterToAirHeatPumpDummy, CalcWaterToAirHeatPumpDummy, ZoneSensLoadMet, ZoneLatLoadMet, OnOffAirFlowRatio, false );
 				Furnace( FurnaceNum ).MdotFurnace = 0.0;
 			} else { //continuous fan, cycling coil
-				CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CoolPartLoadRatio, HeatPartLoadRatio, Dummy, Dummy, ZoneSensLoadMet, ZoneLatLoadMet, OnOffAirFlowRatio, false );
+				CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CalcWaterToAirHeatPumpCoolPartLoadRatio, CalcWaterToAirHeatPumpHeatPartLoadRatio, CalcWaterToAirHeatPumpDummy, CalcWaterToAirHeatPumpDummy, ZoneSensLoadMet, ZoneLatLoadMet, OnOffAirFlowRatio, false );
 			}
 			//*********No heating or cooling or dehumidification*********
 		} else {
 			Furnace( FurnaceNum ).InitHeatPump = true; //initialization call to Calc Furnace
 			Furnace( FurnaceNum ).MdotFurnace = 0.0;
-			HeatPartLoadRatio = 0.0;
-			CoolPartLoadRatio = 0.0;
+			CalcWaterToAirHeatPumpHeatPartLoadRatio = 0.0;
+			CalcWaterToAirHeatPumpCoolPartLoadRatio = 0.0;
 			OnOffFanPartLoadFraction = 1.0; //see 'Note' under INITIAL CALCULATIONS
 			Furnace( FurnaceNum ).CompPartLoadRatio = 0.0;
 			Furnace( FurnaceNum ).CoolingCoilSensDemand = 0.0;
 			Furnace( FurnaceNum ).CoolingCoilLatentDemand = 0.0;
 			Furnace( FurnaceNum ).HeatingCoilSensDemand = 0.0;
-			CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CoolPartLoadRatio, HeatPartLoadRatio, Dummy, Dummy, ZoneSensLoadMet, ZoneLatLoadMet, OnOffAirFlowRatio, false );
+			CalcFurnaceOutput( FurnaceNum, FirstHVACIteration, OpMode, CompOp, CalcWaterToAirHeatPumpCoolPartLoadRatio, CalcWaterToAirHeatPumpHeatPartLoadRatio, CalcWaterToAirHeatPumpDummy, CalcWaterToAirHeatPumpDummy, ZoneSensLoadMet, ZoneLatLoadMet, OnOffAirFlowRatio, false );
 			Furnace( FurnaceNum ).MdotFurnace = 0.0;
 		}
 
@@ -8298,16 +8377,6 @@ namespace Furnaces {
 		Real64 HotWaterMdot; // actual hot water mass flow rate
 		Array1D< Real64 > Par( 4 );
 		int SolFlag;
-		static std::string HeatingCoilName; // name of heating coil
-		static std::string HeatingCoilType; // type of heating coil
-		static int CoilTypeNum( 0 ); // heating coil type number
-		static int HeatingCoilIndex( 0 ); // heating coil index
-		static int CoilControlNode( 0 ); // control node for hot water and steam heating coils
-		static int CoilOutletNode( 0 ); // air outlet node of the heatiing coils
-		static int LoopNum( 0 ); // plant loop number
-		static int LoopSideNum( 0 ); // plant loop side number
-		static int BranchNum( 0 ); // plant branch number
-		static int CompNum( 0 ); // Numeric Equivalent for Supplemental Heat Coil Type
 
 		QActual = 0.0;
 
@@ -8358,7 +8427,7 @@ namespace Furnaces {
 					} else {
 						Par( 4 ) = 0.0;
 					}
-					SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, HotWaterMdot, HotWaterCoilResidual, MinWaterFlow, MaxHotWaterFlow, Par );
+					SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, HotWaterMdot, HotWaterCoilResidual, MinWaterFlow, MaxHotWaterFlow, Par, "CalcNonDXHeatingCoils" );
 					if ( SolFlag == -1 ) {
 						if ( Furnace( FurnaceNum ).HotWaterCoilMaxIterIndex == 0 ) {
 							ShowWarningMessage( "CalcNonDXHeatingCoils: Hot water coil control failed for " + cFurnaceTypes( Furnace( FurnaceNum ).FurnaceType_Num ) + "=\"" + Furnace( FurnaceNum ).Name + "\"" );
@@ -8521,18 +8590,13 @@ namespace Furnaces {
 		int OpMode; // operating mode (fan cycling or continious; DX coil always cycles)
 		int ZoneNum; // Controlled zone number
 		Real64 QTotUnitOut; // capacity output
-		static int SpeedNum( 1 ); // Speed number
-		static Real64 SupHeaterLoad( 0.0 ); // supplement heater load
 		int CompOp; // compressor operation; 1=on, 0=off
 		int AirLoopNumber; // Index to air loop
 		Real64 SaveMassFlowRate; // saved inlet air mass flow rate [kg/s]
 		Real64 QSensUnitOut; // sensible capacity output
 		Real64 QLatUnitOut; // latent capacity output
-		static Real64 TotalZoneLatentLoad; // Total ZONE latent load
-		static Real64 TotalZoneSensibleLoad; // Total ZONE sensible load
 		Real64 ActualSensibleOutput; // Actual furnace sensible capacity
 		Real64 ReheatCoilLoad; // reheat coil load due to dehumidification
-		static Real64 SystemSensibleLoad; // Positive value means heating required
 		Real64 QToHeatSetPt; // Load required to meet heating setpoint temp (>0 is a heating load)
 		Real64 NoCompOutput; // output when no active compressor [W]
 		int TotBranchNum; // total exit branch number
@@ -8548,9 +8612,9 @@ namespace Furnaces {
 		SaveCompressorPLR = 0.0;
 		ElecHeatingCoilPower = 0.0;
 
-		SystemSensibleLoad = QZnReq;
+		SimVariableSpeedHPSystemSensibleLoad = QZnReq;
 		TotalZoneSensibleLoad = QZnReq;
-		TotalZoneLatentLoad = QLatReq;
+		SimVariableSpeedHPTotalZoneLatentLoad = QLatReq;
 
 		// initialize local variables
 		UnitOn = true;
@@ -8597,21 +8661,21 @@ namespace Furnaces {
 		SaveMassFlowRate = Node( InletNode ).MassFlowRate;
 		//decide current working mode for IHP
 		if ( ( FirstHVACIteration ) && ( Furnace( FurnaceNum ).bIsIHP ) )
-			DecideWorkMode( Furnace( FurnaceNum ).CoolingCoilIndex, TotalZoneSensibleLoad, TotalZoneLatentLoad );
+			DecideWorkMode( Furnace( FurnaceNum ).CoolingCoilIndex, TotalZoneSensibleLoad, SimVariableSpeedHPTotalZoneLatentLoad );
 
-		if ( !FirstHVACIteration && Furnace( FurnaceNum ).OpMode == CycFanCycCoil && ( QZnReq < ( -1.0 * SmallLoad ) || TotalZoneLatentLoad < ( -1.0 * SmallLoad ) ) && EconoActive ) {
+		if ( !FirstHVACIteration && Furnace( FurnaceNum ).OpMode == CycFanCycCoil && ( QZnReq < ( -1.0 * SmallLoad ) || SimVariableSpeedHPTotalZoneLatentLoad < ( -1.0 * SmallLoad ) ) && EconoActive ) {
 			// for cycling fan, cooling load, check whether furnace can meet load with compressor off
 			CompOp = Off;
-			ControlVSHPOutput( FurnaceNum, FirstHVACIteration, CompOp, OpMode, TotalZoneSensibleLoad, TotalZoneLatentLoad, ZoneNum, SpeedNum, SpeedRatio, PartLoadFrac, OnOffAirFlowRatio, SupHeaterLoad );
+			ControlVSHPOutput( FurnaceNum, FirstHVACIteration, CompOp, OpMode, TotalZoneSensibleLoad, SimVariableSpeedHPTotalZoneLatentLoad, ZoneNum, SimVariableSpeedHPSpeedNum, SpeedRatio, PartLoadFrac, OnOffAirFlowRatio, SimVariableSpeedHPSupHeaterLoad );
 
 			TotalZoneSensibleLoad = QZnReq;
-			TotalZoneLatentLoad = QLatReq;
+			SimVariableSpeedHPTotalZoneLatentLoad = QLatReq;
 
-			if ( SpeedNum == Furnace( FurnaceNum ).NumOfSpeedCooling && SpeedRatio == 1.0 ) {
+			if ( SimVariableSpeedHPSpeedNum == Furnace( FurnaceNum ).NumOfSpeedCooling && SpeedRatio == 1.0 ) {
 				// compressor on (reset inlet air mass flow rate to starting value)
 				Node( InletNode ).MassFlowRate = SaveMassFlowRate;
 				CompOp = On;
-				ControlVSHPOutput( FurnaceNum, FirstHVACIteration, CompOp, OpMode, TotalZoneSensibleLoad, TotalZoneLatentLoad, ZoneNum, SpeedNum, SpeedRatio, PartLoadFrac, OnOffAirFlowRatio, SupHeaterLoad );
+				ControlVSHPOutput( FurnaceNum, FirstHVACIteration, CompOp, OpMode, TotalZoneSensibleLoad, SimVariableSpeedHPTotalZoneLatentLoad, ZoneNum, SimVariableSpeedHPSpeedNum, SpeedRatio, PartLoadFrac, OnOffAirFlowRatio, SimVariableSpeedHPSupHeaterLoad );
 			}
 		} else {
 			// compressor on
@@ -8620,13 +8684,13 @@ namespace Furnaces {
 			//     if ( QZnReq < -1000.0 .AND. FurnaceNum == 1 ) then
 			//       CompOp      = On
 			//     end if
-			ControlVSHPOutput( FurnaceNum, FirstHVACIteration, CompOp, OpMode, TotalZoneSensibleLoad, TotalZoneLatentLoad, ZoneNum, SpeedNum, SpeedRatio, PartLoadFrac, OnOffAirFlowRatio, SupHeaterLoad );
+			ControlVSHPOutput( FurnaceNum, FirstHVACIteration, CompOp, OpMode, TotalZoneSensibleLoad, SimVariableSpeedHPTotalZoneLatentLoad, ZoneNum, SimVariableSpeedHPSpeedNum, SpeedRatio, PartLoadFrac, OnOffAirFlowRatio, SimVariableSpeedHPSupHeaterLoad );
 		}
 
 		if ( Furnace( FurnaceNum ).FurnaceType_Num == UnitarySys_HeatCool ) {
 			SaveCompressorPLR = PartLoadFrac;
 		} else {
-			if ( SpeedNum > 1 ) {
+			if ( SimVariableSpeedHPSpeedNum > 1 ) {
 				SaveCompressorPLR = 1.0;
 			}
 
@@ -8637,10 +8701,10 @@ namespace Furnaces {
 
 		ReheatCoilLoad = 0.0;
 		TotalZoneSensibleLoad = QZnReq;
-		TotalZoneLatentLoad = QLatReq;
+		SimVariableSpeedHPTotalZoneLatentLoad = QLatReq;
 		//     Calculate the reheat coil output
 		if ( ( GetCurrentScheduleValue( Furnace( FurnaceNum ).SchedPtr ) > 0.0 && CoolingLoad ) && ( Furnace( FurnaceNum ).Humidistat && Furnace( FurnaceNum ).DehumidControlType_Num == DehumidControl_CoolReheat && ( QLatReq < 0.0 ) ) ) { // if a Humidistat is installed and dehumdification control type is CoolReheat
-			CalcVarSpeedHeatPump( FurnaceNum, FirstHVACIteration, CompOp, SpeedNum, SpeedRatio, PartLoadFrac, ActualSensibleOutput, QLatUnitOut, TotalZoneSensibleLoad, TotalZoneLatentLoad, OnOffAirFlowRatio, ReheatCoilLoad );
+			CalcVarSpeedHeatPump( FurnaceNum, FirstHVACIteration, CompOp, SimVariableSpeedHPSpeedNum, SpeedRatio, PartLoadFrac, ActualSensibleOutput, QLatUnitOut, TotalZoneSensibleLoad, SimVariableSpeedHPTotalZoneLatentLoad, OnOffAirFlowRatio, ReheatCoilLoad );
 			if ( Furnace( FurnaceNum ).ZoneSequenceHeatingNum > 0 ) {
 				QToHeatSetPt = ( ZoneSysEnergyDemand( Furnace( FurnaceNum ).ControlZoneNum ).SequencedOutputRequiredToHeatingSP( Furnace( FurnaceNum ).ZoneSequenceHeatingNum ) / Furnace( FurnaceNum ).ControlZoneMassFlowFrac );
 			} else {
@@ -8660,14 +8724,14 @@ namespace Furnaces {
 				ReheatCoilLoad = 0.0;
 			}
 
-			SupHeaterLoad = 0.0;
-			CalcVarSpeedHeatPump( FurnaceNum, FirstHVACIteration, CompOp, 1, 0.0, 0.0, NoCompOutput, QLatUnitOut, 0.0, 0.0, OnOffAirFlowRatio, SupHeaterLoad );
+			SimVariableSpeedHPSupHeaterLoad = 0.0;
+			CalcVarSpeedHeatPump( FurnaceNum, FirstHVACIteration, CompOp, 1, 0.0, 0.0, NoCompOutput, QLatUnitOut, 0.0, 0.0, OnOffAirFlowRatio, SimVariableSpeedHPSupHeaterLoad );
 
-			if ( NoCompOutput > SystemSensibleLoad && SystemSensibleLoad > 0.0 && ReheatCoilLoad > 0.0 ) {
+			if ( NoCompOutput > SimVariableSpeedHPSystemSensibleLoad && SimVariableSpeedHPSystemSensibleLoad > 0.0 && ReheatCoilLoad > 0.0 ) {
 				//Reduce reheat coil load if you are controlling high humidity but outside air
 				// and/or the supply air fan is providing enough heat to meet the system sensible load.
 				// This will bring the zone temp closer to the heating setpoint temp.
-				ReheatCoilLoad = max( 0.0, ReheatCoilLoad - ( NoCompOutput - SystemSensibleLoad ) );
+				ReheatCoilLoad = max( 0.0, ReheatCoilLoad - ( NoCompOutput - SimVariableSpeedHPSystemSensibleLoad ) );
 			}
 		} else {
 			//       No humidistat installed
@@ -8675,11 +8739,11 @@ namespace Furnaces {
 		}
 
 		TotalZoneSensibleLoad = QZnReq;
-		TotalZoneLatentLoad = QLatReq;
+		SimVariableSpeedHPTotalZoneLatentLoad = QLatReq;
 		if ( ReheatCoilLoad > 0.0 ) {
-			CalcVarSpeedHeatPump( FurnaceNum, FirstHVACIteration, CompOp, SpeedNum, SpeedRatio, PartLoadFrac, QSensUnitOut, QLatUnitOut, TotalZoneSensibleLoad, TotalZoneLatentLoad, OnOffAirFlowRatio, ReheatCoilLoad );
+			CalcVarSpeedHeatPump( FurnaceNum, FirstHVACIteration, CompOp, SimVariableSpeedHPSpeedNum, SpeedRatio, PartLoadFrac, QSensUnitOut, QLatUnitOut, TotalZoneSensibleLoad, SimVariableSpeedHPTotalZoneLatentLoad, OnOffAirFlowRatio, ReheatCoilLoad );
 		} else {
-			CalcVarSpeedHeatPump( FurnaceNum, FirstHVACIteration, CompOp, SpeedNum, SpeedRatio, PartLoadFrac, QSensUnitOut, QLatUnitOut, TotalZoneSensibleLoad, TotalZoneLatentLoad, OnOffAirFlowRatio, SupHeaterLoad );
+			CalcVarSpeedHeatPump( FurnaceNum, FirstHVACIteration, CompOp, SimVariableSpeedHPSpeedNum, SpeedRatio, PartLoadFrac, QSensUnitOut, QLatUnitOut, TotalZoneSensibleLoad, SimVariableSpeedHPTotalZoneLatentLoad, OnOffAirFlowRatio, SimVariableSpeedHPSupHeaterLoad );
 		}
 
 		// calculate delivered capacity
@@ -8721,10 +8785,10 @@ namespace Furnaces {
 
 		Furnace( FurnaceNum ).CompPartLoadRatio = SaveCompressorPLR;
 		if ( Furnace( FurnaceNum ).OpMode == CycFanCycCoil ) {
-			if ( SupHeaterLoad > 0.0 ) {
+			if ( SimVariableSpeedHPSupHeaterLoad > 0.0 ) {
 				Furnace( FurnaceNum ).FanPartLoadRatio = 1.0;
 			} else {
-				if ( SpeedNum < 2 ) {
+				if ( SimVariableSpeedHPSpeedNum < 2 ) {
 					Furnace( FurnaceNum ).FanPartLoadRatio = PartLoadFrac;
 				} else {
 					Furnace( FurnaceNum ).FanPartLoadRatio = 1.0;
@@ -8734,7 +8798,7 @@ namespace Furnaces {
 			if ( UnitOn ) {
 				Furnace( FurnaceNum ).FanPartLoadRatio = 1.0;
 			} else {
-				if ( SpeedNum < 2 ) {
+				if ( SimVariableSpeedHPSpeedNum < 2 ) {
 					Furnace( FurnaceNum ).FanPartLoadRatio = PartLoadFrac;
 				} else {
 					Furnace( FurnaceNum ).FanPartLoadRatio = 1.0;
@@ -8805,8 +8869,6 @@ namespace Furnaces {
 		Real64 CpAir; // air specific heat
 		Real64 QCoilActual; // coil load actually delivered returned to calling component
 		int i; // Speed index
-		static int ErrCountCyc( 0 ); // Counter used to minimize the occurrence of output warnings
-		static int ErrCountVar( 0 ); // Counter used to minimize the occurrence of output warnings
 		IHPOperationMode IHPMode( IHPOperationMode::IdleMode );
 
 		// FLOW
@@ -8938,7 +9000,7 @@ namespace Furnaces {
 					Par( 5 ) = QLatReq;
 				}
 
-				SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, PartLoadFrac, VSHPCyclingResidual, 0.0, 1.0, Par );
+				SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, PartLoadFrac, VSHPCyclingResidual, 0.0, 1.0, Par, "ControlVSHPOutput" );
 				if ( SolFla == -1 ) {
 					if ( !WarmupFlag ) {
 						if ( ErrCountCyc == 0 ) {
@@ -8987,7 +9049,7 @@ namespace Furnaces {
 					Par( 5 ) = QLatReq;
 				}
 
-				SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, SpeedRatio, VSHPSpeedResidual, 1.0e-10, 1.0, Par );
+				SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, SpeedRatio, VSHPSpeedResidual, 1.0e-10, 1.0, Par, "ControlVSHPOutput" );
 				if ( SolFla == -1 ) {
 					if ( !WarmupFlag ) {
 						if ( ErrCountVar == 0 ) {
@@ -128,8 +128,73 @@ namespace General {
 	//PUBLIC  SaveCompDesWaterFlow
 	//PUBLIC  ErfFunction
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		Array1D_int EndDayofMonth( 12, { 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365 } );
+		bool SurfVert( false );
+		bool SurfDet( false );
+		bool SurfDetWVert( false );
+		bool DXFReport( false );
+		std::string DXFOption1;
+		std::string DXFOption2;
+		bool DXFWFReport( false );
+		std::string DXFWFOption1;
+		std::string DXFWFOption2;
+		bool VRMLReport( false );
+		std::string VRMLOption1;
+		std::string VRMLOption2;
+		bool CostInfo( false );
+		bool ViewFactorInfo( false );
+		std::string ViewRptOption1;
+		bool Constructions( false );
+		bool Materials( false );
+		bool LineRpt( false );
+		std::string LineRptOption1;
+		bool VarDict( false );
+		bool EMSoutput( false );
+		std::string VarDictOption1;
+		std::string VarDictOption2;
+		bool GetReportInput( true );
+	}
+
 	// Functions
 
+	// Clears the global data in General.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		EndDayofMonth = Array1D_int( 12, { 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365 } );
+		SurfVert = false;
+		SurfDet = false;
+		SurfDetWVert = false;
+		DXFReport = false;
+		DXFOption1.clear();
+		DXFOption2.clear();
+		DXFWFReport = false;
+		DXFWFOption1.clear();
+		DXFWFOption2.clear();
+		VRMLReport = false;
+		VRMLOption1.clear();
+		VRMLOption2.clear();
+		CostInfo = false;
+		ViewFactorInfo = false;
+		ViewRptOption1.clear();
+		Constructions = false;
+		Materials = false;
+		LineRpt = false;
+		LineRptOption1.clear();
+		VarDict = false;
+		EMSoutput = false;
+		VarDictOption1.clear();
+		VarDictOption2.clear();
+		GetReportInput = true;
+	}
+
 	void
 	SolveRegulaFalsi(
 		Real64 const Eps, // required absolute accuracy
@@ -139,7 +204,8 @@ namespace General {
 		std::function< Real64( Real64 const, Array1< Real64 > const & ) > f,
 		Real64 const X_0, // 1st bound of interval that contains the solution
 		Real64 const X_1, // 2nd bound of interval that contains the solution
-		Array1< Real64 > const & Par // array with additional parameters used for function evaluation
+		Array1< Real64 > const & Par, // array with additional parameters used for function evaluation
+		char const * CallerName // name used to gather convergence statistics
 	)
 	{
 
@@ -147,7 +213,7 @@ namespace General {
 		//       AUTHOR         Michael Wetter
 		//       DATE WRITTEN   March 1999
 		//       MODIFIED       Fred Buhl November 2000, R. Raustad October 2006 - made subroutine RECURSIVE
-		//       RE-ENGINEERED  na
+		//       RE-ENGINEERED  Regula falsi iteration moved to the SolveRoot template
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// Find the value of x between x0 and x1 such that f(x,Par)
@@ -155,111 +221,18 @@ namespace General {
 
 		// METHODOLOGY EMPLOYED:
 		// Uses the Regula Falsi (false position) method (similar to secant method)
+		// New code should call SolveRoot directly with a lambda instead of packing a Par array.
 
 		// REFERENCES:
 		// See Press et al., Numerical Recipes in Fortran, Cambridge University Press,
 		// 2nd edition, 1992. Page 347 ff.
 
-		// USE STATEMENTS:
-		// na
-
-		// Argument array dimensioning
-
-		// Locals
-		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// Flag:
 		// = -2: f(x0) and f(x1) have the same sign
 		// = -1: no convergence
 		// >  0: number of iterations performed
-		// optional
-		// SUBROUTINE PARAMETER DEFINITIONS:
-		Real64 const SMALL( 1.e-10 );
-
-		// INTERFACE BLOCK SPECIFICATIONS
-
-		// DERIVED TYPE DEFINITIONS
-		// na
-
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 X0; // present 1st bound
-		Real64 X1; // present 2nd bound
-		Real64 XTemp; // new estimate
-		Real64 Y0; // f at X0
-		Real64 Y1; // f at X1
-		Real64 YTemp; // f at XTemp
-		Real64 DY; // DY = Y0 - Y1
-		bool Conv; // flag, true if convergence is achieved
-		bool StopMaxIte; // stop due to exceeding of maximum # of iterations
-		bool Cont; // flag, if true, continue searching
-		int NIte; // number of interations
-
-		X0 = X_0;
-		X1 = X_1;
-		Conv = false;
-		StopMaxIte = false;
-		Cont = true;
-		NIte = 0;
-
-		Y0 = f( X0, Par );
-		Y1 = f( X1, Par );
-		// check initial values
-		if ( Y0 * Y1 > 0 ) {
-			Flag = -2;
-			XRes = X0;
-			return;
-		}
-
-		while ( Cont ) {
-
-			DY = Y0 - Y1;
-			if ( std::abs( DY ) < SMALL ) DY = SMALL;
-			// new estimation
-			XTemp = ( Y0 * X1 - Y1 * X0 ) / DY;
-			YTemp = f( XTemp, Par );
 
-			++NIte;
-
-			// check convergence
-			if ( std::abs( YTemp ) < Eps ) Conv = true;
-
-			if ( NIte > MaxIte ) StopMaxIte = true;
-
-			if ( ( ! Conv ) && ( ! StopMaxIte ) ) {
-				Cont = true;
-			} else {
-				Cont = false;
-			}
-
-			if ( Cont ) {
-
-				// reassign values (only if further iteration required)
-				if ( Y0 < 0.0 ) {
-					if ( YTemp < 0.0 ) {
-						X0 = XTemp;
-						Y0 = YTemp;
-					} else {
-						X1 = XTemp;
-						Y1 = YTemp;
-					}
-				} else {
-					if ( YTemp < 0.0 ) {
-						X1 = XTemp;
-						Y1 = YTemp;
-					} else {
-						X0 = XTemp;
-						Y0 = YTemp;
-					}
-				} // ( Y0 < 0 )
-
-			} // (Cont)
-
-		} // Cont
-
-		if ( Conv ) {
-			Flag = NIte;
-		} else {
-			Flag = -1;
-		}
-		XRes = XTemp;
+		SolveRoot( Eps, MaxIte, Flag, XRes, [&]( Real64 const X ) { return f( X, Par ); }, X_0, X_1, DataRootFinder::iMethodFalsePosition, CallerName );
 
 	}
 
@@ -271,7 +244,8 @@ namespace General {
 		Real64 & XRes, // value of x that solves f(x) = 0
 		std::function< Real64( Real64 const ) > f,
 		Real64 const X_0, // 1st bound of interval that contains the solution
-		Real64 const X_1 // 2nd bound of interval that contains the solution
+		Real64 const X_1, // 2nd bound of interval that contains the solution
+		char const * CallerName // name used to gather convergence statistics
 	)
 	{
 
@@ -279,7 +253,7 @@ namespace General {
 		//       AUTHOR         Michael Wetter
 		//       DATE WRITTEN   March 1999
 		//       MODIFIED       Fred Buhl November 2000, R. Raustad October 2006 - made subroutine RECURSIVE
-		//       RE-ENGINEERED  na
+		//       RE-ENGINEERED  Regula falsi iteration moved to the SolveRoot template
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// Find the value of x between x0 and x1 such that f(x)
@@ -292,106 +266,12 @@ namespace General {
 		// See Press et al., Numerical Recipes in Fortran, Cambridge University Press,
 		// 2nd edition, 1992. Page 347 ff.
 
-		// USE STATEMENTS:
-		// na
-
-		// Argument array dimensioning
-
-		// Locals
-		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// Flag:
 		// = -2: f(x0) and f(x1) have the same sign
 		// = -1: no convergence
 		// >  0: number of iterations performed
-		// optional
-		// SUBROUTINE PARAMETER DEFINITIONS:
-		Real64 const SMALL( 1.e-10 );
-
-		// INTERFACE BLOCK SPECIFICATIONS
-
-		// DERIVED TYPE DEFINITIONS
-		// na
-
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 X0; // present 1st bound
-		Real64 X1; // present 2nd bound
-		Real64 XTemp; // new estimate
-		Real64 Y0; // f at X0
-		Real64 Y1; // f at X1
-		Real64 YTemp; // f at XTemp
-		Real64 DY; // DY = Y0 - Y1
-		bool Conv; // flag, true if convergence is achieved
-		bool StopMaxIte; // stop due to exceeding of maximum # of iterations
-		bool Cont; // flag, if true, continue searching
-		int NIte; // number of interations
-
-		X0 = X_0;
-		X1 = X_1;
-		Conv = false;
-		StopMaxIte = false;
-		Cont = true;
-		NIte = 0;
-
-		Y0 = f( X0 );
-		Y1 = f( X1 );
-		// check initial values
-		if ( Y0 * Y1 > 0 ) {
-			Flag = -2;
-			XRes = X0;
-			return;
-		}
-
-		while ( Cont ) {
 
-			DY = Y0 - Y1;
-			if ( std::abs( DY ) < SMALL ) DY = SMALL;
-			// new estimation
-			XTemp = ( Y0 * X1 - Y1 * X0 ) / DY;
-			YTemp = f( XTemp );
-
-			++NIte;
-
-			// check convergence
-			if ( std::abs( YTemp ) < Eps ) Conv = true;
-
-			if ( NIte > MaxIte ) StopMaxIte = true;
-
-			if ( ( ! Conv ) && ( ! StopMaxIte ) ) {
-				Cont = true;
-			} else {
-				Cont = false;
-			}
-
-			if ( Cont ) {
-
-				// reassign values (only if further iteration required)
-				if ( Y0 < 0.0 ) {
-					if ( YTemp < 0.0 ) {
-						X0 = XTemp;
-						Y0 = YTemp;
-					} else {
-						X1 = XTemp;
-						Y1 = YTemp;
-					}
-				} else {
-					if ( YTemp < 0.0 ) {
-						X1 = XTemp;
-						Y1 = YTemp;
-					} else {
-						X0 = XTemp;
-						Y0 = YTemp;
-					}
-				} // ( Y0 < 0 )
-
-			} // (Cont)
-
-		} // Cont
-
-		if ( Conv ) {
-			Flag = NIte;
-		} else {
-			Flag = -1;
-		}
-		XRes = XTemp;
+		SolveRoot( Eps, MaxIte, Flag, XRes, f, X_0, X_1, DataRootFinder::iMethodFalsePosition, CallerName );
 
 	}
 
@@ -1938,7 +1818,6 @@ namespace General {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array1D_int EndDayofMonth( 12, { 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365 } );
 		// End day numbers of each month (without Leap Year)
 
 		if ( Month == 1 ) {
@@ -3097,32 +2976,8 @@ namespace General {
 		int NumNames;
 		int NumNumbers;
 		int IOStat;
-		static bool SurfVert( false );
-		static bool SurfDet( false );
-		static bool SurfDetWVert( false );
-		static bool DXFReport( false );
-		static std::string DXFOption1;
-		static std::string DXFOption2;
-		static bool DXFWFReport( false );
-		static std::string DXFWFOption1;
-		static std::string DXFWFOption2;
-		static bool VRMLReport( false );
-		static std::string VRMLOption1;
-		static std::string VRMLOption2;
-		static bool CostInfo( false );
-		static bool ViewFactorInfo( false );
-		static std::string ViewRptOption1;
-		static bool Constructions( false );
-		static bool Materials( false );
-		static bool LineRpt( false );
-		static std::string LineRptOption1;
-		static bool VarDict( false );
-		static bool EMSoutput( false );
-		static std::string VarDictOption1;
-		static std::string VarDictOption2;
 		//  LOGICAL,SAVE :: SchRpt = .FALSE.
 		//  CHARACTER(len=MaxNameLength) :: SchRptOption
-		static bool GetReportInput( true );
 
 		if ( GetReportInput ) {
 
@@ -60,7 +60,10 @@
 #define General_hh_INCLUDED
 
 // C++ Headers
+#include <cmath>
 #include <functional>
+#include <limits>
+#include <string>
 #include <type_traits>
 
 // ObjexxFCL Headers
@@ -72,6 +75,8 @@
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
+#include <DataRootFinder.hh>
+#include <RootFinder.hh>
 
 namespace EnergyPlus {
 
@@ -99,6 +104,11 @@ namespace General {
 
 	// Functions
 
+	// Clears the global data in General.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SolveRegulaFalsi(
 		Real64 const Eps, // required absolute accuracy
@@ -108,7 +118,8 @@ namespace General {
 		std::function< Real64( Real64 const, Array1< Real64 > const & ) > f,
 		Real64 const X_0, // 1st bound of interval that contains the solution
 		Real64 const X_1, // 2nd bound of interval that contains the solution
-		Array1< Real64 > const & Par // array with additional parameters used for function evaluation
+		Array1< Real64 > const & Par, // array with additional parameters used for function evaluation
+		char const * CallerName = nullptr // name used to gather convergence statistics
 	);
 
 	void
@@ -119,9 +130,235 @@ namespace General {
 		Real64 & XRes, // value of x that solves f(x) = 0
 		std::function< Real64( Real64 const ) > f,
 		Real64 const X_0, // 1st bound of interval that contains the solution
-		Real64 const X_1 // 2nd bound of interval that contains the solution
+		Real64 const X_1, // 2nd bound of interval that contains the solution
+		char const * CallerName = nullptr // name used to gather convergence statistics
 	);
 
+	// Typed root solvers
+	// Find the value of x between X_0 and X_1 such that f(x) is equal to zero, where f is any
+	// callable (typically a lambda capturing the component state) taking a single Real64.
+	// The exit status follows SolveRegulaFalsi:
+	// Flag = -2: f(X_0) and f(X_1) have the same sign, XRes = X_0
+	// Flag = -1: no convergence within MaxIte iterations, XRes = last estimate
+	// Flag >  0: number of iterations performed to reach |f(XRes)| < Eps
+	// Method is any of DataRootFinder::iMethodFalsePosition (same iterates as SolveRegulaFalsi),
+	// iMethodIllinois, iMethodBisection or iMethodBrent. When CallerName is given the
+	// outcome is accumulated in the root solver statistics (see RootFinder::DumpRootSolverStatistics).
+
+	template< typename Function >
+	void
+	SolveRoot(
+		Real64 const Eps, // required absolute accuracy
+		int const MaxIte, // maximum number of allowed iterations
+		int & Flag, // integer storing exit status
+		Real64 & XRes, // value of x that solves f(x) = 0
+		Function && f, // residual function f(x)
+		Real64 const X_0, // 1st bound of interval that contains the solution
+		Real64 const X_1, // 2nd bound of interval that contains the solution
+		int const Method = DataRootFinder::iMethodFalsePosition, // solution method
+		char const * CallerName = nullptr // name used to gather convergence statistics
+	)
+	{
+		Real64 const SMALL( 1.e-10 );
+
+		Real64 X0( X_0 ); // present 1st bound
+		Real64 X1( X_1 ); // present 2nd bound
+		Real64 XTemp( X_0 ); // new estimate
+		Real64 YTemp; // f at XTemp
+		bool Conv( false ); // flag, true if convergence is achieved
+		int NIte( 0 ); // number of iterations
+
+		Real64 Y0( f( X0 ) ); // f at X0
+		Real64 Y1( f( X1 ) ); // f at X1
+		// check initial values
+		if ( Y0 * Y1 > 0 ) {
+			Flag = -2;
+			XRes = X0;
+			RootFinder::UpdateRootSolverStats( CallerName, Method, Flag );
+			return;
+		}
+
+		if ( Method == DataRootFinder::iMethodBrent ) {
+			// Brent's method: inverse quadratic interpolation safeguarded by bisection.
+			// X1 holds the best estimate, X0 the previous one and XC the counterpoint with f(XC) of opposite sign.
+			Real64 XC( X0 );
+			Real64 YC( Y0 );
+			Real64 D( X1 - X0 ); // current step
+			Real64 E( D ); // step before last
+			while ( true ) {
+				if ( ( Y1 > 0.0 && YC > 0.0 ) || ( Y1 < 0.0 && YC < 0.0 ) ) {
+					XC = X0;
+					YC = Y0;
+					D = E = X1 - X0;
+				}
+				if ( std::abs( YC ) < std::abs( Y1 ) ) {
+					X0 = X1;
+					X1 = XC;
+					XC = X0;
+					Y0 = Y1;
+					Y1 = YC;
+					YC = Y0;
+				}
+				Real64 const Tol( 2.0 * std::numeric_limits< Real64 >::epsilon() * std::abs( X1 ) );
+				Real64 const XMid( 0.5 * ( XC - X1 ) );
+				if ( NIte > 0 && std::abs( XMid ) <= Tol ) break; // bracket collapsed without reaching Eps
+				if ( std::abs( E ) >= Tol && std::abs( Y0 ) > std::abs( Y1 ) ) {
+					Real64 P;
+					Real64 Q;
+					Real64 const S( Y1 / Y0 );
+					if ( X0 == XC ) { // secant step
+						P = 2.0 * XMid * S;
+						Q = 1.0 - S;
+					} else { // inverse quadratic interpolation
+						Real64 const QQ( Y0 / YC );
+						Real64 const R( Y1 / YC );
+						P = S * ( 2.0 * XMid * QQ * ( QQ - R ) - ( X1 - X0 ) * ( R - 1.0 ) );
+						Q = ( QQ - 1.0 ) * ( R - 1.0 ) * ( S - 1.0 );
+					}
+					if ( P > 0.0 ) Q = -Q;
+					P = std::abs( P );
+					if ( 2.0 * P < std::min( 3.0 * XMid * Q - std::abs( Tol * Q ), std::abs( E * Q ) ) ) {
+						E = D;
+						D = P / Q;
+					} else {
+						D = XMid;
+						E = D;
+					}
+				} else {
+					D = XMid;
+					E = D;
+				}
+				X0 = X1;
+				Y0 = Y1;
+				X1 += ( std::abs( D ) > Tol ) ? D : ( XMid > 0.0 ? Tol : -Tol );
+				Y1 = f( X1 );
+				++NIte;
+				if ( std::abs( Y1 ) < Eps ) {
+					Conv = true;
+					break;
+				}
+				if ( NIte > MaxIte ) break;
+			}
+			XTemp = X1;
+		} else {
+			// False position family; the Illinois variant halves the retained end point value when
+			// the same bound is replaced twice in a row, which avoids the one-sided stagnation of
+			// plain regula falsi on strongly curved residuals.
+			bool const Illinois( Method == DataRootFinder::iMethodIllinois );
+			bool const Bisection( Method == DataRootFinder::iMethodBisection );
+			int LastSide( 0 ); // bound replaced on the last iteration (0: none, 1: X0, 2: X1)
+			while ( true ) {
+				// new estimation
+				if ( Bisection ) {
+					XTemp = 0.5 * ( X0 + X1 );
+				} else {
+					Real64 DY( Y0 - Y1 );
+					if ( std::abs( DY ) < SMALL ) DY = SMALL;
+					XTemp = ( Y0 * X1 - Y1 * X0 ) / DY;
+				}
+				YTemp = f( XTemp );
+
+				++NIte;
+
+				// check convergence
+				if ( std::abs( YTemp ) < Eps ) {
+					Conv = true;
+					break;
+				}
+				if ( NIte > MaxIte ) break;
+
+				// reassign values (only if further iteration required), keeping a bound with f = 0
+				if ( ( Y0 < 0.0 ) == ( YTemp < 0.0 ) && Y0 != 0.0 ) {
+					X0 = XTemp;
+					Y0 = YTemp;
+					if ( Illinois && LastSide == 1 ) Y1 *= 0.5;
+					LastSide = 1;
+				} else {
+					X1 = XTemp;
+					Y1 = YTemp;
+					if ( Illinois && LastSide == 2 ) Y0 *= 0.5;
+					LastSide = 2;
+				}
+			}
+		}
+
+		if ( Conv ) {
+			Flag = NIte;
+		} else {
+			Flag = -1;
+		}
+		XRes = XTemp;
+		RootFinder::UpdateRootSolverStats( CallerName, Method, Flag );
+	}
+
+	// Newton's method safeguarded by bisection: find x between X_0 and X_1 such that f(x) = 0
+	// given the derivative dfdx(x). Steps that leave the current bracket fall back to bisection,
+	// so the method converges whenever the root is bracketed. Exit status as for SolveRoot.
+
+	template< typename Function, typename Derivative >
+	void
+	SolveRootNewton(
+		Real64 const Eps, // required absolute accuracy
+		int const MaxIte, // maximum number of allowed iterations
+		int & Flag, // integer storing exit status
+		Real64 & XRes, // value of x that solves f(x) = 0
+		Function && f, // residual function f(x)
+		Derivative && dfdx, // derivative of the residual function df/dx(x)
+		Real64 const X_0, // 1st bound of interval that contains the solution
+		Real64 const X_1, // 2nd bound of interval that contains the solution
+		char const * CallerName = nullptr // name used to gather convergence statistics
+	)
+	{
+		Real64 const Y0( f( X_0 ) );
+		Real64 const Y1( f( X_1 ) );
+		if ( Y0 * Y1 > 0 ) {
+			Flag = -2;
+			XRes = X_0;
+			RootFinder::UpdateRootSolverStats( CallerName, DataRootFinder::iMethodNewton, Flag );
+			return;
+		}
+
+		// XNeg and XPos bracket the root with f(XNeg) < 0 <= f(XPos); start from the better bound
+		Real64 XNeg( Y0 < 0.0 ? X_0 : X_1 );
+		Real64 XPos( Y0 < 0.0 ? X_1 : X_0 );
+		Real64 X( std::abs( Y0 ) < std::abs( Y1 ) ? X_0 : X_1 );
+		Real64 Y( std::abs( Y0 ) < std::abs( Y1 ) ? Y0 : Y1 );
+		bool Conv( false );
+		int NIte( 0 );
+
+		if ( std::abs( Y ) < Eps ) { // the root is on a bound
+			Conv = true;
+			NIte = 1;
+		}
+
+		while ( ! Conv ) {
+			Real64 const DYDX( dfdx( X ) );
+			Real64 XNew( DYDX != 0.0 ? X - Y / DYDX : XNeg );
+			if ( ( XNew - XNeg ) * ( XNew - XPos ) >= 0.0 ) XNew = 0.5 * ( XNeg + XPos );
+			X = XNew;
+			Y = f( X );
+			++NIte;
+			if ( std::abs( Y ) < Eps ) {
+				Conv = true;
+				break;
+			}
+			if ( NIte > MaxIte ) break;
+			if ( Y < 0.0 ) {
+				XNeg = X;
+			} else {
+				XPos = X;
+			}
+		}
+
+		if ( Conv ) {
+			Flag = NIte;
+		} else {
+			Flag = -1;
+		}
+		XRes = X;
+		RootFinder::UpdateRootSolverStats( CallerName, DataRootFinder::iMethodNewton, Flag );
+	}
+
 	Real64
 	InterpSw(
 		Real64 const SwitchFac, // Switching factor: 0.0 if glazing is unswitched, = 1.0 if fully switched
@@ -111,6 +111,29 @@ namespace EnergyPlus {
 
 static gio::Fmt fmtLD( "*" );
 
+namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+	bool ICSCollectorIsOn( false ); // ICS collector has OSCM on
+	bool MyICSEnvrnFlag( true ); // Local environment flag for ICS
+}
+
+namespace GeneralRoutines {
+
+	// Clears the global data in GeneralRoutines.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		ICSCollectorIsOn = false;
+		MyICSEnvrnFlag = true;
+	}
+
+} // GeneralRoutines
+
 void
 ControlCompOutput(
 	std::string const & CompName, // the component Name
@@ -194,7 +217,7 @@ ControlCompOutput(
 	//Interval Half Type used for Controller
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	static int Iter( 0 ); // Iteration limit for the interval halving process
+	int Iter( 0 ); // Iteration limit for the interval halving process
 	Real64 CpAir; // specific heat of air (J/kg-C)
 	bool Converged;
 	Real64 Denom; // the denominator of the control signal
@@ -203,7 +226,7 @@ ControlCompOutput(
 	//INTEGER, SAVE    :: ErrCount1=0 ! for recurring error
 	bool WaterCoilAirFlowControl; // True if controlling air flow through water coil, water flow fixed
 	int SimCompNum; // internal number for case statement
-	static Real64 HalvingPrec( 0.0 ); // precision of halving algorithm
+	Real64 HalvingPrec( 0.0 ); // precision of halving algorithm
 
 	struct IntervalHalf
 	{
@@ -281,8 +304,8 @@ ControlCompOutput(
 	};
 
 	// Object Data
-	static IntervalHalf ZoneInterHalf( 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, false, false, false, false );
-	static ZoneEquipControllerProps ZoneController( 0.0, 0.0, 0.0, 0.0, 0.0 );
+	IntervalHalf ZoneInterHalf( 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, false, false, false, false );
+	ZoneEquipControllerProps ZoneController( 0.0, 0.0, 0.0, 0.0, 0.0 );
 
 	if ( ControlCompTypeNum != 0 ) {
 		SimCompNum = ControlCompTypeNum;
@@ -1034,11 +1057,9 @@ CalcPassiveExteriorBaffleGap(
 	Real64 LocalOutDryBulbTemp; // OutDryBulbTemp for here
 	Real64 LocalWetBulbTemp; // OutWetBulbTemp for here
 	Real64 LocalOutHumRat; // OutHumRat for here
-	static bool ICSCollectorIsOn( false ); // ICS collector has OSCM on
 	int CollectorNum; // current solar collector index
 	Real64 ICSWaterTemp; // ICS solar collector water temp
 	Real64 ICSULossbottom; // ICS solar collector bottom loss Conductance
-	static bool MyICSEnvrnFlag( true ); // Local environment flag for ICS
 
 	Real64 const surfaceArea( sum_sub( Surface, &SurfaceData::Area, SurfPtrARR ) );
 
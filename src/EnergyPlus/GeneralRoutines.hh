@@ -69,6 +69,15 @@
 
 namespace EnergyPlus {
 
+namespace GeneralRoutines {
+
+	// Clears the global data in GeneralRoutines.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
+} // GeneralRoutines
+
 void
 ControlCompOutput(
 	std::string const & CompName, // the component Name
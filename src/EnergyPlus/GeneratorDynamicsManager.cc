@@ -130,8 +130,33 @@ namespace GeneratorDynamicsManager {
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE <module_name>:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int InletCWnode( 0 ); // cooling water inlet node ID
+		bool InternalFlowControl( false );
+		Real64 ManageGeneratorControlStateTcwIn( 0.0 ); // inlet cooling water temperature (C)
+		Real64 TrialMdotcw( 0.0 ); // test or estimate of what the plant flows are going to be (kg/s)
+		Real64 LimitMinMdotcw( 0.0 ); // lower limit for cooling water flow for generatior operation (kg/s)
+	}
+
 	// Functions
 
+	// Clears the global data in GeneratorDynamicsManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		InletCWnode = 0;
+		InternalFlowControl = false;
+		ManageGeneratorControlStateTcwIn = 0.0;
+		TrialMdotcw = 0.0;
+		LimitMinMdotcw = 0.0;
+	}
+
 	void
 	SetupGeneratorControlStateManager( int const GenNum ) // index of generator to setup
 	{
@@ -325,11 +350,6 @@ namespace GeneratorDynamicsManager {
 		bool PLRStartUp; // true if subtimestep issue involving startup
 		bool PLRShutDown;
 		//  INTEGER :: OutletCWnode        = 0 ! cooling water outlet node ID
-		static int InletCWnode( 0 ); // cooling water inlet node ID
-		static bool InternalFlowControl( false );
-		static Real64 TcwIn( 0.0 ); // inlet cooling water temperature (C)
-		static Real64 TrialMdotcw( 0.0 ); // test or estimate of what the plant flows are going to be (kg/s)
-		static Real64 LimitMinMdotcw( 0.0 ); // lower limit for cooling water flow for generatior operation (kg/s)
 
 		// inits
 		PLRforSubtimestepStartUp = 1.0;
@@ -349,7 +369,7 @@ namespace GeneratorDynamicsManager {
 			DynaCntrlNum = MicroCHP( GeneratorNum ).DynamicsControlID;
 			// OutletCWnode = MicroCHP(GeneratorNum)%PlantOutletNodeID
 			InletCWnode = MicroCHP( GeneratorNum ).PlantInletNodeID;
-			TcwIn = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).Temp;
+			ManageGeneratorControlStateTcwIn = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).Temp;
 			if ( MicroCHP( GeneratorNum ).A42Model.InternalFlowControl ) {
 				InternalFlowControl = true;
 			}
@@ -381,7 +401,7 @@ namespace GeneratorDynamicsManager {
 
 		// get data to check if sufficient flow available from Plant
 		if ( InternalFlowControl && ( SchedVal > 0.0 ) ) {
-			TrialMdotcw = FuncDetermineCWMdotForInternalFlowControl( GeneratorNum, Pel, TcwIn );
+			TrialMdotcw = FuncDetermineCWMdotForInternalFlowControl( GeneratorNum, Pel, ManageGeneratorControlStateTcwIn );
 		} else {
 			TrialMdotcw = Node( InletCWnode ).MassFlowRate;
 		}
@@ -83,6 +83,11 @@ namespace GeneratorDynamicsManager {
 
 	// Functions
 
+	// Clears the global data in GeneratorDynamicsManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SetupGeneratorControlStateManager( int const GenNum ); // index of generator to setup
 
@@ -134,8 +134,27 @@ namespace GeneratorFuelSupply {
 
 	// <name Public routines, optionally name Private routines within this module>
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetGeneratorFuelSupplyInputErrorsFound( false ); // error flag
+		bool MyOneTimeFlag( true );
+	}
+
 	// Functions
 
+	// Clears the global data in GeneratorFuelSupply.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		GetGeneratorFuelSupplyInputErrorsFound = false;
+		MyOneTimeFlag = true;
+	}
+
 	void
 	GetGeneratorFuelSupplyInput()
 	{
@@ -190,11 +209,9 @@ namespace GeneratorFuelSupply {
 		int IOStat; // IO Status when calling get input subroutine
 		Array1D_string AlphArray( 25 ); // character string data
 		Array1D< Real64 > NumArray( 200 ); // numeric data TODO deal with allocatable for extensible
-		static bool ErrorsFound( false ); // error flag
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int FuelSupNum;
-		static bool MyOneTimeFlag( true );
 		std::string ObjMSGName;
 		int ConstitNum;
 
@@ -204,7 +221,7 @@ namespace GeneratorFuelSupply {
 
 			if ( NumGeneratorFuelSups <= 0 ) {
 				ShowSevereError( "No " + cCurrentModuleObject + " equipment specified in input file" );
-				ErrorsFound = true;
+				GetGeneratorFuelSupplyInputErrorsFound = true;
 			}
 
 			FuelSupply.allocate( NumGeneratorFuelSups );
@@ -216,7 +233,7 @@ namespace GeneratorFuelSupply {
 				IsBlank = false;
 				VerifyName( AlphArray( 1 ), FuelSupply, FuelSupNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetGeneratorFuelSupplyInputErrorsFound = true;
 					if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 				}
 
@@ -229,18 +246,18 @@ namespace GeneratorFuelSupply {
 				} else {
 					ShowSevereError( "Invalid, " + cAlphaFieldNames( 2 ) + " = " + AlphArray( 2 ) );
 					ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + AlphArray( 1 ) );
-					ErrorsFound = true;
+					GetGeneratorFuelSupplyInputErrorsFound = true;
 				}
 
 				FuelSupply( FuelSupNum ).NodeName = AlphArray( 3 );
-				FuelSupply( FuelSupNum ).NodeNum = GetOnlySingleNode( AlphArray( 3 ), ErrorsFound, cCurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Sensor, 1, ObjectIsNotParent );
+				FuelSupply( FuelSupNum ).NodeNum = GetOnlySingleNode( AlphArray( 3 ), GetGeneratorFuelSupplyInputErrorsFound, cCurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Sensor, 1, ObjectIsNotParent );
 
 				FuelSupply( FuelSupNum ).SchedNum = GetScheduleIndex( AlphArray( 4 ) );
 				if ( ( FuelSupply( FuelSupNum ).SchedNum == 0 ) && ( FuelSupply( FuelSupNum ).FuelTempMode == FuelInTempSchedule ) ) {
 					ShowSevereError( "Invalid, " + cAlphaFieldNames( 4 ) + " = " + AlphArray( 4 ) );
 					ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + AlphArray( 1 ) );
 					ShowContinueError( "Schedule named was not found" );
-					ErrorsFound = true;
+					GetGeneratorFuelSupplyInputErrorsFound = true;
 				}
 
 				FuelSupply( FuelSupNum ).CompPowerCurveID = GetCurveIndex( AlphArray( 5 ) );
@@ -248,7 +265,7 @@ namespace GeneratorFuelSupply {
 					ShowSevereError( "Invalid, " + cAlphaFieldNames( 5 ) + " = " + AlphArray( 5 ) );
 					ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + AlphArray( 1 ) );
 					ShowContinueError( "Curve named was not found " );
-					ErrorsFound = true;
+					GetGeneratorFuelSupplyInputErrorsFound = true;
 				}
 
 				for ( auto & e : FuelSupply ) e.CompPowerLossFactor = NumArray( 1 );
@@ -260,7 +277,7 @@ namespace GeneratorFuelSupply {
 				} else {
 					ShowSevereError( "Invalid, " + cAlphaFieldNames( 6 ) + " = " + AlphArray( 6 ) );
 					ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + AlphArray( 1 ) );
-					ErrorsFound = true;
+					GetGeneratorFuelSupplyInputErrorsFound = true;
 				}
 
 				FuelSupply( FuelSupNum ).LHVliquid = NumArray( 2 ) * 1000.0; //generic liquid LHV  (kJ/kG input converted to J/kG )
@@ -274,11 +291,11 @@ namespace GeneratorFuelSupply {
 
 					if ( NumFuelConstit > 12 ) {
 						ShowSevereError( cCurrentModuleObject + " model not set up for more than 12 fuel constituents" );
-						ErrorsFound = true;
+						GetGeneratorFuelSupplyInputErrorsFound = true;
 					}
 					if ( NumFuelConstit < 1 ) {
 						ShowSevereError( cCurrentModuleObject + " model needs at least one fuel constituent" );
-						ErrorsFound = true;
+						GetGeneratorFuelSupplyInputErrorsFound = true;
 					}
 
 					for ( ConstitNum = 1; ConstitNum <= NumFuelConstit; ++ConstitNum ) {
@@ -292,7 +309,7 @@ namespace GeneratorFuelSupply {
 						ShowSevereError( cCurrentModuleObject + " molar fractions do not sum to 1.0" );
 						ShowContinueError( "Sum was=" + RoundSigDigits( sum( FuelSupply( FuelSupNum ).ConstitMolalFract ), 5 ) );
 						ShowContinueError( "Entered in " + cCurrentModuleObject + " = " + AlphArray( 1 ) );
-						ErrorsFound = true;
+						GetGeneratorFuelSupplyInputErrorsFound = true;
 					}
 				}
 
@@ -301,10 +318,10 @@ namespace GeneratorFuelSupply {
 			//now make calls to Setup
 
 			for ( FuelSupNum = 1; FuelSupNum <= NumGeneratorFuelSups; ++FuelSupNum ) {
-				SetupFuelConstituentData( FuelSupNum, ErrorsFound );
+				SetupFuelConstituentData( FuelSupNum, GetGeneratorFuelSupplyInputErrorsFound );
 			}
 
-			if ( ErrorsFound ) {
+			if ( GetGeneratorFuelSupplyInputErrorsFound ) {
 				ShowFatalError( "Problem found processing input for " + cCurrentModuleObject );
 			}
 
@@ -82,6 +82,11 @@ namespace GeneratorFuelSupply {
 
 	// Functions
 
+	// Clears the global data in GeneratorFuelSupply.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	GetGeneratorFuelSupplyInput();
 
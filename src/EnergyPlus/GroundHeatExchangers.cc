@@ -57,7 +57,14 @@
 // in binary and source code form.
 
 // C++ Headers
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -66,12 +73,14 @@
 // EnergyPlus Headers
 #include <GroundHeatExchangers.hh>
 #include <BranchNodeConnections.hh>
+#include <Checkpoint.hh>
 #include <DataEnvironment.hh>
 #include <DataHVACGlobals.hh>
 #include <DataIPShortCuts.hh>
 #include <DataLoopNode.hh>
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <DisplayRoutines.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
@@ -104,7 +113,7 @@ namespace GroundHeatExchangers {
 	// applied heat pulses. The response to each pulse is calculated from a non-
 	// dimensionalized response function, or G-function, that is specific to the
 	// given borehole field arrangement, depth and spacing. The data defining
-	// this function is read from input.
+	// this function is read from input, or calculated from the borehole layout.
 	// The heat pulse histories need to be recorded over an extended period (months).
 	// To aid computational efficiency past pulses are continuously agregated into
 	// equivalent heat pulses of longer duration, as each pulse becomes less recent.
@@ -148,9 +157,35 @@ namespace GroundHeatExchangers {
 	Real64 currentSimTime( 0.0 ); // Current simulation time in hours
 	int locHourOfDay( 0 );
 	int locDayOfSim( 0 );
+	Real64 ToutNew( 19.375 );
+	int PrevN( 1 ); // The saved value of N at previous time step
+	bool updateCurSimTime( true ); // Used to reset the CurSimTime to reset after WarmupFlag
+	bool triggerDesignDayReset( false );
 	namespace {
 		bool GetInput( true );
 		bool errorsFound( false );
+
+		std::string
+		gFunctionCacheHash( std::string const & key )
+		{
+			// 64 bit FNV-1a hash, stable between builds so the cache file can be shared
+			std::uint64_t hash( 14695981039346656037ULL );
+			for ( char const c : key ) {
+				hash ^= static_cast< unsigned char >( c );
+				hash *= 1099511628211ULL;
+			}
+			std::ostringstream hashString;
+			hashString << std::hex << hash;
+			return hashString.str();
+		}
+
+		Real64
+		integratedErrorFunction( Real64 const x )
+		{
+			// Integral of erf from 0 to x
+			return x * std::erf( x ) + std::expm1( -pow_2( x ) ) / std::sqrt( DataGlobals::Pi );
+		}
+		int numErrorCalls( 0 );
 	}
 
 	Array1D< Real64 > prevTimeSteps; // This is used to store only the Last Few time step's time
@@ -183,6 +218,11 @@ namespace GroundHeatExchangers {
 		checkEquipName.deallocate();
 		verticalGLHE.deallocate();
 		slinkyGLHE.deallocate();
+		ToutNew = 19.375;
+		PrevN = 1;
+		updateCurSimTime = true;
+		triggerDesignDayReset = false;
+		numErrorCalls = 0;
 	}
 
 
@@ -225,8 +265,276 @@ namespace GroundHeatExchangers {
 	void
 	GLHEVert::calcGFunctions()
 	{
-		// Nothing to see here. Move along.
-		// Just a stub out for future work.
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR:          Matt Mitchell
+		//       DATE WRITTEN:    February, 2015
+		//       MODIFIED         Calculate from the borehole layout
+		//       RE-ENGINEERED    na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Calculates the g-functions of a vertical borehole field from its borehole layout.
+		// Without a GroundHeatExchanger:Vertical:Layout the g-function pairs from input are kept.
+
+		// METHODOLOGY EMPLOYED:
+		// Uniform heat flux finite line sources. The field g-function is the mean response of the
+		// boreholes to all boreholes, so one response is evaluated per distinct distance between
+		// boreholes, which for regular fields is far fewer than the number of borehole pairs.
+		// With time expressed as ln(t/ts) the g-function only depends on the field geometry, so
+		// results are kept in the g-function cache file keyed by the geometry.
+
+		// REFERENCES:
+		// Cimmino, M., M. Bernier. 2014. 'A semi-analytical method to generate g-functions for
+		//   geothermal bore fields.' International Journal of Heat and Mass Transfer 70: 641-650.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const lnttsMin( -15.0 ); // First ln(t/ts) of the calculated g-function
+		Real64 const lnttsStep( 0.5 ); // ln(t/ts) step of the calculated g-function
+		Real64 const distanceTol( 1.0e-6 ); // Borehole distances within this share one response [m]
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int numLayoutBoreholes;
+		Real64 steadyStateTime; // ts [s]
+		Real64 lnttsMax;
+		Real64 alphaTime; // Ground diffusivity times time [m2]
+		Real64 gFunc;
+		int NT;
+		std::vector< Real64 > pairDistances;
+		std::vector< Real64 > distances; // Borehole radius, then the distinct distances between boreholes
+		std::vector< Real64 > distanceCount; // Number of ordered borehole pairs at each distance
+		std::vector< Real64 > responses;
+
+		if ( boreholeX.empty() ) return;
+
+		numLayoutBoreholes = boreholeX.size();
+		steadyStateTime = pow_2( boreholeLength ) / ( 9.0 * diffusivityGround );
+		lnttsMax = max( 3.0, std::ceil( std::log( maxSimYears * 8760.0 * SecInHour / steadyStateTime ) ) );
+		NPairs = static_cast< int >( ( lnttsMax - lnttsMin ) / lnttsStep ) + 1;
+
+		LNTTS.dimension( NPairs, 0.0 );
+		GFNC.dimension( NPairs, 0.0 );
+		for ( NT = 1; NT <= NPairs; ++NT ) {
+			LNTTS( NT ) = lnttsMin + ( NT - 1 ) * lnttsStep;
+		}
+
+		// The calculated g-functions are based on the actual radius, so no correction is needed
+		gReferenceRatio = boreholeRadius / boreholeLength;
+
+		std::ostringstream key;
+		key.precision( 17 );
+		key << "GroundHeatExchanger:Vertical " << boreholeLength << ' ' << boreholeTopDepth << ' ' << boreholeRadius << ' ' << lnttsMin << ' ' << lnttsStep << ' ' << NPairs;
+		for ( int i = 1; i <= numLayoutBoreholes; ++i ) {
+			key << ' ' << boreholeX( i ) << ' ' << boreholeY( i );
+		}
+		if ( readGFunctionCache( key.str(), NPairs, GFNC ) ) return;
+
+		// Group the borehole pairs by distance
+		pairDistances.reserve( numLayoutBoreholes * ( numLayoutBoreholes - 1 ) / 2 );
+		for ( int i = 1; i <= numLayoutBoreholes; ++i ) {
+			for ( int j = i + 1; j <= numLayoutBoreholes; ++j ) {
+				pairDistances.push_back( std::sqrt( pow_2( boreholeX( i ) - boreholeX( j ) ) + pow_2( boreholeY( i ) - boreholeY( j ) ) ) );
+			}
+		}
+		std::sort( pairDistances.begin(), pairDistances.end() );
+
+		distances.reserve( pairDistances.size() + 1 );
+		distanceCount.reserve( pairDistances.size() + 1 );
+		distances.push_back( boreholeRadius );
+		distanceCount.push_back( numLayoutBoreholes );
+		Real64 groupDistance( -1.0 );
+		for ( auto const pairDistance : pairDistances ) {
+			if ( distances.size() > 1 && pairDistance - groupDistance <= distanceTol ) {
+				distanceCount.back() += 2.0;
+			} else {
+				groupDistance = pairDistance;
+				distances.push_back( max( pairDistance, boreholeRadius ) );
+				distanceCount.push_back( 2.0 );
+			}
+		}
+
+		for ( NT = 1; NT <= NPairs; ++NT ) {
+			alphaTime = diffusivityGround * steadyStateTime * std::exp( LNTTS( NT ) );
+			finiteLineSourceResponses( distances, boreholeLength, boreholeTopDepth, alphaTime, responses );
+			gFunc = 0.0;
+			for ( std::size_t i = 0; i < distances.size(); ++i ) {
+				gFunc += distanceCount[ i ] * responses[ i ];
+			}
+			GFNC( NT ) = gFunc / numLayoutBoreholes;
+		}
+
+		writeGFunctionCache( key.str(), NPairs, GFNC );
+	}
+
+	//******************************************************************************
+
+	void
+	finiteLineSourceResponses(
+		std::vector< Real64 > const & dist, // Distances between boreholes, or the borehole radius [m]
+		Real64 const length, // Borehole length [m]
+		Real64 const depth, // Depth of the top of the boreholes [m]
+		Real64 const alphaTime, // Ground diffusivity times time [m2]
+		std::vector< Real64 > & response
+	)
+	{
+		// PURPOSE OF THIS SUBROUTINE:
+		// Mean temperature response along a borehole to a unit heat rate per length in a parallel
+		// borehole of the same length and depth at each of the given distances. The ground surface
+		// is kept at constant temperature. The temperature change is the heat rate per length over
+		// 2*Pi*k times the response.
+
+		// METHODOLOGY EMPLOYED:
+		// Integral form of the finite line source with its image (Claesson and Javed 2011), on a
+		// grid in ln(s) shared by all distances so the erf terms are only evaluated once.
+		// Simpson's 1/3 rule; exp(-dist^2*s^2) below exp(-50) is neglected.
+
+		// REFERENCES:
+		// Claesson, J., S. Javed. 2011. 'An Analytical Method to Calculate Borehole Fluid
+		//   Temperatures for Time-scales from Minutes to Decades.' ASHRAE Transactions 117(2): 279-288.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const maxStep( 0.05 ); // Largest integration step in ln(s)
+		Real64 const expCutoff( 50.0 );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 sLow;
+		Real64 sHigh;
+		Real64 zLow;
+		Real64 h;
+		int numIntervals;
+		Array1D< Real64 > s;
+		Array1D< Real64 > weightedIls; // Simpson weight times the line source integral over s
+
+		response.assign( dist.size(), 0.0 );
+		if ( dist.empty() ) return;
+
+		sLow = 1.0 / std::sqrt( 4.0 * alphaTime );
+		sHigh = std::sqrt( expCutoff ) / *std::min_element( dist.begin(), dist.end() );
+		if ( sLow >= sHigh ) return;
+
+		zLow = std::log( sLow );
+		numIntervals = 2 * max( 1, static_cast< int >( std::ceil( 0.5 * ( std::log( sHigh ) - zLow ) / maxStep ) ) );
+		h = ( std::log( sHigh ) - zLow ) / numIntervals;
+
+		s.dimension( numIntervals + 1 );
+		weightedIls.dimension( numIntervals + 1 );
+		for ( int i = 1; i <= numIntervals + 1; ++i ) {
+			s( i ) = std::exp( zLow + ( i - 1 ) * h );
+			Real64 const Hs( length * s( i ) );
+			Real64 const Ds( depth * s( i ) );
+			Real64 const ils( 2.0 * integratedErrorFunction( Hs ) + 2.0 * integratedErrorFunction( Hs + 2.0 * Ds ) - integratedErrorFunction( 2.0 * Ds ) - integratedErrorFunction( 2.0 * Hs + 2.0 * Ds ) );
+			// ds / s^2 = dz / s
+			Real64 weight( 2.0 );
+			if ( i == 1 || i == numIntervals + 1 ) {
+				weight = 1.0;
+			} else if ( i % 2 == 0 ) {
+				weight = 4.0;
+			}
+			weightedIls( i ) = weight * ils / ( length * s( i ) );
+		}
+
+		for ( std::size_t j = 0; j < dist.size(); ++j ) {
+			Real64 const dist2( pow_2( dist[ j ] ) );
+			Real64 const sCutoff2( expCutoff / dist2 );
+			Real64 sumIntF( 0.0 );
+			for ( int i = 1; i <= numIntervals + 1; ++i ) {
+				Real64 const s2( pow_2( s( i ) ) );
+				if ( s2 > sCutoff2 ) break;
+				sumIntF += weightedIls( i ) * std::exp( -dist2 * s2 );
+			}
+			response[ j ] = 0.5 * ( h / 3.0 ) * sumIntF;
+		}
+	}
+
+	//******************************************************************************
+
+	bool
+	readGFunctionCache(
+		std::string const & key,
+		int const nPairs,
+		Array1D< Real64 > & gFunc
+	)
+	{
+		// PURPOSE OF THIS FUNCTION:
+		// Looks up g-function values calculated by an earlier run for the geometry described by key.
+
+		// METHODOLOGY EMPLOYED:
+		// Each line of the cache file holds the hash of a key, the number of values and the values.
+
+		std::ifstream cacheFile( DataSystemVariables::GFunctionCacheFileName );
+		if ( ! cacheFile ) return false;
+
+		std::string const hash( gFunctionCacheHash( key ) );
+		std::string line;
+		while ( std::getline( cacheFile, line ) ) {
+			std::istringstream lineStream( line );
+			std::string lineHash;
+			int lineNumPairs( 0 );
+			if ( ! ( lineStream >> lineHash >> lineNumPairs ) || lineHash != hash || lineNumPairs != nPairs ) continue;
+			Array1D< Real64 > values( nPairs );
+			bool valid( true );
+			for ( int i = 1; i <= nPairs; ++i ) {
+				if ( ! ( lineStream >> values( i ) ) ) {
+					valid = false;
+					break;
+				}
+			}
+			if ( ! valid ) continue;
+			gFunc = values;
+			return true;
+		}
+		return false;
+	}
+
+	//******************************************************************************
+
+	void
+	writeGFunctionCache(
+		std::string const & key,
+		int const nPairs,
+		Array1D< Real64 > const & gFunc
+	)
+	{
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds calculated g-function values to the cache file. A cache that cannot be written
+		// only means the values are calculated again by the next run.
+
+		// METHODOLOGY EMPLOYED:
+		// The cache is copied to a temporary file with the new line added, which then replaces the cache,
+		// so runs sharing the cache never read a partly written line. When two runs replace the cache
+		// at the same time one of the new lines may be lost, and that g-function is calculated again.
+
+		std::string const & cacheFileName( DataSystemVariables::GFunctionCacheFileName );
+		std::string const hash( gFunctionCacheHash( key ) );
+		std::string const tempFileName( cacheFileName + '.' + hash + '.' + std::to_string( std::chrono::steady_clock::now().time_since_epoch().count() ) + ".tmp" );
+
+		{
+			std::ofstream tempFile( tempFileName );
+			if ( ! tempFile ) return;
+
+			std::ifstream cacheFile( cacheFileName );
+			std::string line;
+			while ( std::getline( cacheFile, line ) ) {
+				tempFile << line << '\n';
+			}
+
+			tempFile.precision( 17 );
+			tempFile << hash << ' ' << nPairs;
+			for ( int i = 1; i <= nPairs; ++i ) {
+				tempFile << ' ' << gFunc( i );
+			}
+			tempFile << '\n';
+
+			if ( ! tempFile ) {
+				tempFile.close();
+				std::remove( tempFileName.c_str() );
+				return;
+			}
+		}
+
+		if ( std::rename( tempFileName.c_str(), cacheFileName.c_str() ) != 0 ) {
+			// Windows does not replace an existing file on rename
+			std::remove( cacheFileName.c_str() );
+			if ( std::rename( tempFileName.c_str(), cacheFileName.c_str() ) != 0 ) std::remove( tempFileName.c_str() );
+		}
 	}
 
 	//******************************************************************************
@@ -242,6 +550,7 @@ namespace GroundHeatExchangers {
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// calculates g-functions for the slinky ground heat exchanger model
+		// Results are kept in the g-function cache file, so later runs with the same field skip the ring integrals.
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Real64 tLg_max( 0.0 );
@@ -290,9 +599,15 @@ namespace GroundHeatExchangers {
 
 		for ( i = 1; i <= NPairs; ++i ) {
 			GFNC( i ) = 0.0;
-			LNTTS( i ) = 0.0;
+			LNTTS( i ) = tLg_min + tLg_grid * ( i - 1 );
 		}
 
+		// The g-functions depend on the field geometry and the ground diffusivity
+		std::ostringstream key;
+		key.precision( 17 );
+		key << "GroundHeatExchanger:Slinky " << verticalConfig << ' ' << coilDiameter << ' ' << coilPitch << ' ' << coilDepth << ' ' << numTrenches << ' ' << trenchSpacing << ' ' << numCoils << ' ' << pipeOutDia << ' ' << diffusivityGround << ' ' << NPairs;
+		if ( readGFunctionCache( key.str(), NPairs, GFNC ) ) return;
+
 		// Calculate the number of loops (per trench) and number of trenchs to be involved
 			// Due to the symmetry of a slinky GHX field, we need only calculate about
 			// on quarter of the rings' tube wall temperature perturbation to get the
@@ -414,6 +729,8 @@ namespace GroundHeatExchangers {
 			LNTTS( NT ) = tLg;
 
 		} // NT time
+
+		writeGFunctionCache( key.str(), NPairs, GFNC );
 	}
 	//******************************************************************************
 
@@ -859,7 +1176,6 @@ namespace GroundHeatExchangers {
 		Real64 kGroundFactor;
 		Real64 cpFluid;
 		Real64 gFuncVal; // Interpolated G function value at a sub-hour
-		static Real64 ToutNew( 19.375 );
 		Real64 fluidAveTemp;
 		Real64 C_1;
 		int numOfMonths; // the number of months of simulation elapsed
@@ -880,16 +1196,12 @@ namespace GroundHeatExchangers {
 		Real64 C1; // **Intermediate constants used
 		Real64 C2; // **in explicit  calcualtion of the
 		Real64 C3; // **temperature at the U tube outlet.
-		static int PrevN( 1 ); // The saved value of N at previous time step
 		int IndexN; // Used to index the LastHourN array
-		static bool updateCurSimTime( true ); // Used to reset the CurSimTime to reset after WarmupFlag
-		static bool triggerDesignDayReset( false );
-		static bool firstTime( true );
 
 		// Calculate G-Functions
-		if ( firstTime ) {
+		if ( ! gFunctionsExist ) {
 			calcGFunctions();
-			firstTime = false;
+			gFunctionsExist = true;
 		}
 
 		inletTemp = Node( inletNodeNum ).Temp;
@@ -1148,7 +1460,6 @@ namespace GroundHeatExchangers {
 		Real64 fluidDensity;
 		Real64 const deltaTempLimit( 100.0 ); // temp limit for warnings
 		Real64 GLHEdeltaTemp; // ABS(Outlet temp -inlet temp)
-		static int numErrorCalls( 0 );
 
 		SafeCopyPlantNode( inletNodeNum, outletNodeNum );
 
@@ -1265,6 +1576,7 @@ namespace GroundHeatExchangers {
 		// Using/Aliasing
 		using InputProcessor::GetNumObjectsFound;
 		using InputProcessor::GetObjectItem;
+		using InputProcessor::FindItemInList;
 		using InputProcessor::VerifyName;
 		using InputProcessor::SameString;
 		using namespace DataIPShortCuts;
@@ -1297,6 +1609,8 @@ namespace GroundHeatExchangers {
 		int indexNum;
 		int pairNum;
 		bool allocated;
+		int numLayouts;
+		int numCoordinates;
 
 		// VERTICAL GLHE
 
@@ -1444,6 +1758,45 @@ namespace GroundHeatExchangers {
 				}
 			}
 
+			// Borehole layouts, from which the g-functions are calculated
+			cCurrentModuleObject = "GroundHeatExchanger:Vertical:Layout";
+			numLayouts = GetNumObjectsFound( cCurrentModuleObject );
+			for ( int layoutNum = 1; layoutNum <= numLayouts; ++layoutNum ) {
+				GetObjectItem( cCurrentModuleObject, layoutNum, cAlphaArgs, numAlphas, rNumericArgs, numNums, IOStat, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
+
+				GLHENum = FindItemInList( cAlphaArgs( 1 ), verticalGLHE );
+				if ( GLHENum == 0 ) {
+					ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid " + cAlphaFieldNames( 1 ) + '.' );
+					ShowContinueError( "...GroundHeatExchanger:Vertical not found." );
+					errorsFound = true;
+					continue;
+				}
+				auto & thisGLHE( verticalGLHE( GLHENum ) );
+				if ( ! thisGLHE.boreholeX.empty() ) {
+					ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", duplicate layout for this GroundHeatExchanger:Vertical." );
+					errorsFound = true;
+					continue;
+				}
+
+				thisGLHE.boreholeTopDepth = rNumericArgs( 1 );
+				numCoordinates = ( numNums - 1 ) / 2;
+				if ( numCoordinates != thisGLHE.numBoreholes || numNums != 1 + 2 * numCoordinates ) {
+					ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid number of borehole coordinates." );
+					ShowContinueError( "...Number of Bore Holes=[" + TrimSigDigits( thisGLHE.numBoreholes ) + "], borehole coordinate pairs=[" + TrimSigDigits( numCoordinates ) + "]." );
+					errorsFound = true;
+					continue;
+				}
+				thisGLHE.boreholeX.dimension( numCoordinates, 0.0 );
+				thisGLHE.boreholeY.dimension( numCoordinates, 0.0 );
+				for ( int i = 1; i <= numCoordinates; ++i ) {
+					thisGLHE.boreholeX( i ) = rNumericArgs( 2 * i );
+					thisGLHE.boreholeY( i ) = rNumericArgs( 2 * i + 1 );
+				}
+			}
+			if ( errorsFound ) {
+				ShowFatalError( "Errors found in processing input for " + cCurrentModuleObject );
+			}
+
 			//Set up report variables
 			for ( GLHENum = 1; GLHENum <= numVerticalGLHEs; ++GLHENum ) {
 				SetupOutputVariable( "Ground Heat Exchanger Average Borehole Temperature [C]", verticalGLHE( GLHENum ).boreholeTemp, "System", "Average", verticalGLHE( GLHENum ).Name );
@@ -2060,6 +2413,8 @@ namespace GroundHeatExchangers {
 			currentSimTime = 0.0;
 			QGLHE = 0.0;
 			prevHour = 1;
+
+			Checkpoint::RestoreGroundHeatExchanger( "GroundHeatExchanger:Vertical", *this );
 		}
 
 		massFlowRate = RegulateCondenserCompFlowReqOp( loopNum, loopSideNum, branchNum, compNum, designMassFlow );
@@ -2152,6 +2507,8 @@ namespace GroundHeatExchangers {
 			currentSimTime = 0.0;
 			QGLHE = 0.0;
 			prevHour = 1;
+
+			Checkpoint::RestoreGroundHeatExchanger( "GroundHeatExchanger:Slinky", *this );
 		}
 
 		tempGround = this->groundTempModel->getGroundTempAtTimeInSeconds( coilDepth, CurTime );
@@ -59,6 +59,9 @@
 #ifndef GroundHeatExchangers_hh_INCLUDED
 #define GroundHeatExchangers_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -84,7 +87,15 @@ namespace GroundHeatExchangers {
 	extern int const maxTSinHr; // Max number of time step in a hour
 
 	// MODULE VARIABLE DECLARATIONS:
-	//na
+	extern int N; // COUNTER OF TIME STEP
+	extern Real64 currentSimTime; // Current simulation time in hours
+	extern int locHourOfDay;
+	extern int locDayOfSim;
+	extern Real64 ToutNew;
+	extern int PrevN; // The saved value of N at previous time step
+	extern bool updateCurSimTime; // Used to reset the CurSimTime to reset after WarmupFlag
+	extern bool triggerDesignDayReset;
+	extern Array1D< Real64 > prevTimeSteps; // Times of the last few time steps
 
 	// Types
 
@@ -143,6 +154,7 @@ namespace GroundHeatExchangers {
 		Real64 totalTubeLength; // The total length of pipe. NumBoreholes * BoreholeDepth OR Pi * Dcoil * NumCoils
 		Real64 timeSS; // Steady state time
 		Real64 timeSSFactor; // Steady state time factor for calculation
+		bool gFunctionsExist; // True once calcGFunctions has been called
 		std::shared_ptr< BaseGroundTempsModel > groundTempModel;
 
 		// Default Constructor
@@ -181,7 +193,8 @@ namespace GroundHeatExchangers {
 			lastQnSubHr( 0.0 ),
 			HXResistance( 0.0 ),
 			timeSS( 0.0 ),
-			timeSSFactor( 0.0 )
+			timeSSFactor( 0.0 ),
+			gFunctionsExist( false )
 		{}
 
 		virtual void
@@ -233,6 +246,9 @@ namespace GroundHeatExchangers {
 		Real64 kGrout; // Grout thermal conductivity                [W/(mK)]
 		Real64 UtubeDist; // Distance between the legs of the Utube    [m]
 		bool runFlag;
+		Real64 boreholeTopDepth; // Depth of the top of the boreholes [m]
+		Array1D< Real64 > boreholeX; // Borehole positions from GroundHeatExchanger:Vertical:Layout [m]
+		Array1D< Real64 > boreholeY; // No layout: the g-function pairs from input are used
 
 		// Default Constructor
 		GLHEVert() :
@@ -243,7 +259,8 @@ namespace GroundHeatExchangers {
 			boreholeRadius( 0.0 ),
 			kGrout( 0.0 ),
 			UtubeDist( 0.0 ),
-			runFlag( false )
+			runFlag( false ),
+			boreholeTopDepth( 0.0 )
 		{}
 
 		void
@@ -413,6 +430,29 @@ namespace GroundHeatExchangers {
 	void
 	GetGroundHeatExchangerInput();
 
+	void
+	finiteLineSourceResponses(
+		std::vector< Real64 > const & dist, // Distances between boreholes, or the borehole radius [m]
+		Real64 const length, // Borehole length [m]
+		Real64 const depth, // Depth of the top of the boreholes [m]
+		Real64 const alphaTime, // Ground diffusivity times time [m2]
+		std::vector< Real64 > & response
+	);
+
+	bool
+	readGFunctionCache(
+		std::string const & key,
+		int const nPairs,
+		Array1D< Real64 > & gFunc
+	);
+
+	void
+	writeGFunctionCache(
+		std::string const & key,
+		int const nPairs,
+		Array1D< Real64 > const & gFunc
+	);
+
 } // GroundHeatExchangers
 
 } // EnergyPlus
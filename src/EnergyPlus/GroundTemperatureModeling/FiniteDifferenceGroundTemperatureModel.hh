@@ -91,6 +91,10 @@ namespace EnergyPlus {
 			Real64 dayOfMinDailyAirTemp;
 			Real64 depth;
 			Real64 simTimeInDays;
+			Real64 rhoCp_soil_liq_1 = 0.0; // Set by evaluateSoilRhoCp on initialization
+			Real64 rhoCP_soil_liq = 0.0;
+			Real64 rhoCP_soil_transient = 0.0;
+			Real64 rhoCP_soil_ice = 0.0;
 
 		// Default constructor
 		FiniteDiffGroundTempsModel() :
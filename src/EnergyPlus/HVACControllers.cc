@@ -266,6 +266,11 @@ namespace HVACControllers {
 	namespace {
 		bool InitControllerOneTimeFlag( true );
 		bool InitControllerSetPointCheckFlag( true );
+		bool ErrorsFound( false );
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool MySizeFlag;
+		Array1D_bool MyPlantIndexsFlag;
+		int SetupIndividualControllerTracerTraceFileUnit( 0 );
 	}
 
 	static gio::Fmt fmtLD( "*" );
@@ -293,6 +298,11 @@ namespace HVACControllers {
 		RootFinders.deallocate();
 		AirLoopStats.deallocate();
 		CheckEquipName.deallocate();
+		ErrorsFound = false;
+		MyEnvrnFlag.deallocate();
+		MySizeFlag.deallocate();
+		MyPlantIndexsFlag.deallocate();
+		SetupIndividualControllerTracerTraceFileUnit = 0;
 	}
 
 	void
@@ -616,7 +626,6 @@ namespace HVACControllers {
 		std::string CurrentModuleObject; // for ease in getting objects
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
-		static bool ErrorsFound( false );
 		int iNodeType; // for checking actuator node type
 		bool NodeNotFound; // flag true if the sensor node is on the coil air outlet node
 		bool EMSSetPointErrorFlag; // flag true is EMS is used to set node setpoints
@@ -916,6 +925,10 @@ namespace HVACControllers {
 		// Allow reusing the previous solution while identifying brackets if
 		// this is not the first HVAC step of the environment
 		ControllerProps( ControlNum ).ReusePreviousSolutionFlag = true;
+		// Newton step from the previous solution only armed once that solution has been tried
+		ControllerProps( ControlNum ).WarmStartNewtonFlag = false;
+		ControllerProps( ControlNum ).WarmStartFlag = false;
+		ControllerProps( ControlNum ).NumNewtonSteps = 0;
 		// Always reset to false by default. Set in CalcSimpleController() on the first controller iteration.
 		ControllerProps( ControlNum ).ReuseIntermediateSolutionFlag = false;
 		// By default not converged
@@ -997,9 +1010,6 @@ namespace HVACControllers {
 		int ActuatedNode;
 		int SensedNode;
 		int ControllerIndex;
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool MySizeFlag;
-		static Array1D_bool MyPlantIndexsFlag;
 		//////////// hoisted into namespace ////////////////////////////////////////////////
 		// static bool MyOneTimeFlag( true ); // InitControllerOneTimeFlag
 		// static bool MySetPointCheckFlag( true ); // InitControllerSetPointCheckFlag
@@ -1626,6 +1636,8 @@ namespace HVACControllers {
 		bool PreviousSolutionDefinedFlag;
 		int PreviousSolutionMode;
 		Real64 PreviousSolutionValue;
+		Real64 PreviousSolutionSensitivity;
+		Real64 NewtonValue;
 
 		// Obtain actuated and sensed nodes
 		ActuatedNode = ControllerProps( ControlNum ).ActuatedNode;
@@ -1652,6 +1664,7 @@ namespace HVACControllers {
 			PreviousSolutionDefinedFlag = ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).DefinedFlag;
 			PreviousSolutionMode = ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).Mode;
 			PreviousSolutionValue = ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).ActuatedValue;
+			PreviousSolutionSensitivity = ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).Sensitivity;
 
 			// Attempt to use root at previous HVAC step in place of the candidate produced by the
 			// root finder.
@@ -1669,6 +1682,23 @@ namespace HVACControllers {
 
 				// Turn off flag since we can only use the previous solution once per HVAC iteration
 				ControllerProps( ControlNum ).ReusePreviousSolutionFlag = false;
+				ControllerProps( ControlNum ).WarmStartFlag = true;
+
+				// Once the residual at the previous solution is known, correct it with a Newton step
+				// using the slope saved with that solution instead of the root finder candidate.
+				ControllerProps( ControlNum ).WarmStartNewtonFlag = ( PreviousSolutionSensitivity != 0.0 );
+			} else if ( ControllerProps( ControlNum ).WarmStartNewtonFlag ) {
+				// The current iterate is the previous solution: only one Newton step is attempted per
+				// HVAC iteration, after which the root finder resumes with its own candidates.
+				ControllerProps( ControlNum ).WarmStartNewtonFlag = false;
+				NewtonValue = ControllerProps( ControlNum ).ActuatedValue - ControllerProps( ControlNum ).DeltaSensed / PreviousSolutionSensitivity;
+
+				if ( CheckRootFinderCandidate( RootFinders( ControlNum ), NewtonValue ) ) {
+					ControllerProps( ControlNum ).NextActuatedValue = NewtonValue;
+					++ControllerProps( ControlNum ).NumNewtonSteps;
+				} else {
+					ControllerProps( ControlNum ).NextActuatedValue = RootFinders( ControlNum ).XCandidate;
+				}
 			} else {
 				// By default, use candidate value computed by root finder
 				ControllerProps( ControlNum ).NextActuatedValue = RootFinders( ControlNum ).XCandidate;
@@ -2127,6 +2157,10 @@ namespace HVACControllers {
 		// Updates solution trackers if simple controller is converged.
 
 		// METHODOLOGY EMPLOYED:
+		// The local sensitivity of the sensed value to the actuated value is saved along with an
+		// active solution. It is estimated with the secant through the 2 best iterates kept in the
+		// root finder history and is used for the warm start Newton step in FindRootSimpleController().
+		// The sensitivity saved with the previous solution is kept if no secant is available.
 
 		// REFERENCES:
 
@@ -2162,6 +2196,10 @@ namespace HVACControllers {
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).DefinedFlag = true;
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).Mode = ControllerProps( ControlNum ).Mode;
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).ActuatedValue = ControllerProps( ControlNum ).NextActuatedValue;
+				auto const & History( RootFinders( ControlNum ).History );
+				if ( RootFinders( ControlNum ).NumHistory >= 2 && History( 1 ).DefinedFlag && History( 2 ).DefinedFlag && History( 1 ).X != History( 2 ).X ) {
+					ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).Sensitivity = ( History( 2 ).Y - History( 1 ).Y ) / ( History( 2 ).X - History( 1 ).X );
+				}
 			} else {
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).DefinedFlag = false;
 				ControllerProps( ControlNum ).SolutionTrackers( PreviousSolutionIndex ).Mode = ControllerProps( ControlNum ).Mode;
@@ -2540,6 +2578,13 @@ namespace HVACControllers {
 
 			AirLoopStats( AirLoopNum ).ControllerStats( AirLoopControlNum ).MaxIterations( Mode ) = max( AirLoopStats( AirLoopNum ).ControllerStats( AirLoopControlNum ).MaxIterations( Mode ), IterationCount );
 
+			// Iterations needed when the solution memory was used to warm start the root finder
+			if ( ControllerProps( ControlIndex ).WarmStartFlag ) {
+				++AirLoopStats( AirLoopNum ).ControllerStats( AirLoopControlNum ).NumWarmStarts;
+				AirLoopStats( AirLoopNum ).ControllerStats( AirLoopControlNum ).TotWarmStartIterations += IterationCount;
+			}
+			AirLoopStats( AirLoopNum ).ControllerStats( AirLoopControlNum ).NumNewtonSteps += ControllerProps( ControlIndex ).NumNewtonSteps;
+
 		}
 
 	}
@@ -2741,6 +2786,16 @@ Label100: ;
 			}
 			gio::write( FileUnit, fmtAAA ) << "AvgIterations" << ',' << TrimSigDigits( AvgIterations, 10 );
 
+			// Number of times the previous solution was reused as a candidate and iterations needed then
+			gio::write( FileUnit, fmtAAA ) << "NumWarmStarts" << ',' << TrimSigDigits( ThisAirLoopStats.ControllerStats( AirLoopControlNum ).NumWarmStarts );
+			gio::write( FileUnit, fmtAAA ) << "NumNewtonSteps" << ',' << TrimSigDigits( ThisAirLoopStats.ControllerStats( AirLoopControlNum ).NumNewtonSteps );
+			if ( ThisAirLoopStats.ControllerStats( AirLoopControlNum ).NumWarmStarts == 0 ) {
+				AvgIterations = 0.0;
+			} else {
+				AvgIterations = double( ThisAirLoopStats.ControllerStats( AirLoopControlNum ).TotWarmStartIterations ) / double( ThisAirLoopStats.ControllerStats( AirLoopControlNum ).NumWarmStarts );
+			}
+			gio::write( FileUnit, fmtAAA ) << "AvgWarmStartIterations" << ',' << TrimSigDigits( AvgIterations, 10 );
+
 			// Dump iteration trackers for each operating mode
 			for ( iModeNum = iFirstMode; iModeNum <= iLastMode; ++iModeNum ) {
 
@@ -3081,12 +3136,11 @@ Label100: ;
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int TraceFileUnit( 0 );
 
 		// Open and write column header in trace file for each individual controller
-		TraceFileUnit = GetNewUnitNumber();
+		SetupIndividualControllerTracerTraceFileUnit = GetNewUnitNumber();
 
-		if ( TraceFileUnit <= 0 ) {
+		if ( SetupIndividualControllerTracerTraceFileUnit <= 0 ) {
 			ShowFatalError( "SetupIndividualControllerTracer: Invalid unit (<=0) for setting up controller trace file" );
 			return;
 		}
@@ -3095,20 +3149,20 @@ Label100: ;
 		strip( TraceFileName );
 
 		//WRITE(*,*) 'Trace file name="', TRIM(TraceFileName) , '"'
-		{ IOFlags flags; flags.ACTION( "write" ); gio::open( TraceFileUnit, TraceFileName, flags ); if ( flags.err() ) goto Label100; }
+		{ IOFlags flags; flags.ACTION( "write" ); gio::open( SetupIndividualControllerTracerTraceFileUnit, TraceFileName, flags ); if ( flags.err() ) goto Label100; }
 
 		// Store trace file unit
-		ControllerProps( ControlNum ).TraceFileUnit = TraceFileUnit;
+		ControllerProps( ControlNum ).TraceFileUnit = SetupIndividualControllerTracerTraceFileUnit;
 
 		// Write header row
 		// Masss flow rate
 		// Convergence analysis
-		{ IOFlags flags; flags.ADVANCE( "No" ); gio::write( TraceFileUnit, "(19(A,A))", flags ) << "EnvironmentNum" << "WarmupFlag" << "SysTimeStamp" << "SysTimeInterval" << "AirLoopPass" << "FirstHVACIteration" << "Operation" << "NumCalcCalls" << "SensedNode%MassFlowRate" << "ActuatedNode%MassFlowRateMinAvail" << "ActuatedNode%MassFlowRateMaxAvail" << "X" << "Y" << "Setpoint" << "DeltaSensed" << "Offset" << "Mode" << "IsConvergedFlag" << "NextActuatedValue"; }
+		{ IOFlags flags; flags.ADVANCE( "No" ); gio::write( SetupIndividualControllerTracerTraceFileUnit, "(19(A,A))", flags ) << "EnvironmentNum" << "WarmupFlag" << "SysTimeStamp" << "SysTimeInterval" << "AirLoopPass" << "FirstHVACIteration" << "Operation" << "NumCalcCalls" << "SensedNode%MassFlowRate" << "ActuatedNode%MassFlowRateMinAvail" << "ActuatedNode%MassFlowRateMaxAvail" << "X" << "Y" << "Setpoint" << "DeltaSensed" << "Offset" << "Mode" << "IsConvergedFlag" << "NextActuatedValue"; }
 
-		WriteRootFinderTraceHeader( TraceFileUnit );
+		WriteRootFinderTraceHeader( SetupIndividualControllerTracerTraceFileUnit );
 
 		// Finally skip line
-		gio::write( TraceFileUnit, fmtLD );
+		gio::write( SetupIndividualControllerTracerTraceFileUnit, fmtLD );
 
 		return;
 
@@ -150,12 +150,14 @@ namespace HVACControllers {
 		bool DefinedFlag; // Flag set to TRUE when tracker is up-to-date. FALSE otherwise.
 		Real64 ActuatedValue; // Actuated value
 		int Mode; // Operational model of controller
+		Real64 Sensitivity; // Local slope d(DeltaSensed)/d(Actuated) at the saved solution. Zero if unknown.
 
 		// Default Constructor
 		SolutionTrackerType() :
 			DefinedFlag( true ),
 			ActuatedValue( 0.0 ),
-			Mode( iModeNone )
+			Mode( iModeNone ),
+			Sensitivity( 0.0 )
 		{}
 
 	};
@@ -191,6 +193,12 @@ namespace HVACControllers {
 		// The first tracker is used to track the solution when FirstHVACIteration is TRUE.
 		// The second tracker is used to track the solution at FirstHVACIteration is FALSE.
 		Array1D< SolutionTrackerType > SolutionTrackers;
+		// Flag set once the previous solution has been tried as a candidate so that the next candidate
+		// is obtained with a Newton step using the sensitivity saved with that solution.
+		bool WarmStartNewtonFlag;
+		// Flag set when the previous solution was reused as a candidate since last call to Reset()
+		bool WarmStartFlag;
+		int NumNewtonSteps; // Number of warm start Newton steps since last call to Reset()
 		// --------------------
 		// Operational limits at min/max avail values for actuated variable and the corresponding sensed values
 		// --------------------
@@ -254,6 +262,9 @@ namespace HVACControllers {
 			ReuseIntermediateSolutionFlag( false ),
 			ReusePreviousSolutionFlag( false ),
 			SolutionTrackers( 2 ),
+			WarmStartNewtonFlag( false ),
+			WarmStartFlag( false ),
+			NumNewtonSteps( 0 ),
 			MaxAvailActuated( 0.0 ),
 			MaxAvailSensed( 0.0 ),
 			MinAvailActuated( 0.0 ),
@@ -291,12 +302,18 @@ namespace HVACControllers {
 		Array1D_int NumCalls; // Number of times this controller operated in each mode
 		Array1D_int TotIterations; // Total number of iterations required to solve this controller
 		Array1D_int MaxIterations; // Maximum number of iterations required to solve this controller
+		int NumWarmStarts; // Number of times the previous solution was reused as a candidate
+		int TotWarmStartIterations; // Total number of iterations required when the previous solution was reused
+		int NumNewtonSteps; // Number of warm start Newton steps taken from the previous solution
 
 		// Default Constructor
 		ControllerStatsType() :
 			NumCalls( {iFirstMode,iLastMode}, 0 ),
 			TotIterations( {iFirstMode,iLastMode}, 0 ),
-			MaxIterations( {iFirstMode,iLastMode}, 0 )
+			MaxIterations( {iFirstMode,iLastMode}, 0 ),
+			NumWarmStarts( 0 ),
+			TotWarmStartIterations( 0 ),
+			NumNewtonSteps( 0 )
 		{}
 
 	};
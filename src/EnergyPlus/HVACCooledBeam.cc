@@ -160,8 +160,134 @@ namespace HVACCooledBeam {
 	// Object Data
 	Array1D< CoolBeamData > CoolBeam;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // First time, input is "gotten"
+		int NumAlphas( 0 ); // Number of Alphas for each GetObjectItem call
+		int NumNumbers( 0 ); // Number of Numbers for each GetObjectItem call
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool MyOneTimeFlag( true );
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool MySizeFlag;
+		Array1D_bool PlantLoopScanFlag;
+		bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
+		int PltSizCoolNum( 0 ); // index of plant sizing object for the cooling loop
+		int NumBeams( 0 ); // number of beams in the zone
+		int Iter( 0 ); // beam length iteration index
+		Real64 DesCoilLoad( 0.0 ); // total cooling capacity of the beams in the zone [W]
+		Real64 DesLoadPerBeam( 0.0 ); // cooling capacity per individual beam [W]
+		Real64 DesAirVolFlow( 0.0 ); // design total supply air flow rate [m3/s]
+		Real64 DesAirFlowPerBeam( 0.0 ); // design supply air volumetric flow per beam [m3/s]
+		Real64 RhoAir( 0.0 );
+		Real64 CpAir( 0.0 );
+		Real64 WaterVel( 0.0 ); // design water velocity in beam
+		Real64 IndAirFlowPerBeamL( 0.0 ); // induced volumetric air flow rate per beam length [m3/s-m]
+		Real64 DT( 0.0 ); // air - water delta T [C]
+		Real64 LengthX( 0.0 ); // test value for beam length [m]
+		Real64 Length( 0.0 ); // beam length [m]
+		Real64 ConvFlow( 0.0 ); // convective and induced air mass flow rate across beam per beam plan area [kg/s-m2]
+		Real64 K( 0.0 ); // coil (beam) heat transfer coefficient [W/m2-K]
+		Real64 WaterVolFlowPerBeam( 0.0 ); // Cooling water volumetric flow per beam [m3]
+		Real64 ControlCoolBeamQMin( 0.0 ); // cooled beam output at minimum water flow [W]
+		Real64 ControlCoolBeamQMax( 0.0 ); // cooled beam output at maximum water flow [W]
+		Real64 QSup( 0.0 ); // heating or cooling by supply air [W]
+		Real64 PowerMet( 0.0 ); // power supplied
+		Real64 ControlCoolBeamCWFlow( 0.0 ); // cold water flow [kg/s]
+		Real64 AirMassFlow( 0.0 ); // air mass flow rate for the cooled beam system [kg/s]
+		Real64 MaxColdWaterFlow( 0.0 ); // max water mass flow rate for the cooled beam system [kg/s]
+		Real64 MinColdWaterFlow( 0.0 ); // min water mass flow rate for the cooled beam system [kg/s]
+		Real64 CpAirZn( 0.0 ); // specific heat of air at zone conditions [J/kg-C]
+		Real64 CpAirSys( 0.0 ); // specific heat of air at supply air conditions [J/kg-C]
+		Real64 ControlCoolBeamTWOut( 0.0 ); // outlet water tamperature [C]
+		int CalcCoolBeamIter( 0 ); // TWOut iteration index
+		Real64 TWIn( 0.0 ); // Inlet water temperature [C]
+		Real64 ZTemp( 0.0 ); // zone air temperature [C]
+		Real64 WaterCoolPower( 0.0 ); // cooling power from water side [W]
+		Real64 CalcCoolBeamDT( 0.0 ); // approximate air - water delta T [C]
+		Real64 IndFlow( 0.0 ); // induced air flow rate per beam length [m3/s-m]
+		Real64 CoilFlow( 0.0 ); // mass air flow rate of air passing through "coil" [kg/m2-s]
+		Real64 CalcCoolBeamWaterVel( 0.0 ); // water velocity [m/s]
+		Real64 CalcCoolBeamK( 0.0 ); // coil heat transfer coefficient [W/m2-K]
+		Real64 AirCoolPower( 0.0 ); // cooling power from the air side [W]
+		Real64 CWFlowPerBeam( 0.0 ); // water mass flow rate per beam
+		Real64 Coeff( 0.0 ); // iteration parameter
+		Real64 Delta( 0.0 );
+		Real64 mdot( 0.0 );
+		Real64 UnitOutput( 0.0 );
+		Real64 CoolBeamResidualTWOut( 0.0 );
+	}
+
 	// Functions
 
+	// Clears the global data in HVACCooledBeam.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		CheckEquipName.deallocate();
+		NumCB = 0;
+		CoolBeam.deallocate();
+		GetInputFlag = true;
+		NumAlphas = 0;
+		NumNumbers = 0;
+		TotalArgs = 0;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		MyEnvrnFlag.deallocate();
+		MySizeFlag.deallocate();
+		PlantLoopScanFlag.deallocate();
+		ZoneEquipmentListChecked = false;
+		PltSizCoolNum = 0;
+		NumBeams = 0;
+		Iter = 0;
+		DesCoilLoad = 0.0;
+		DesLoadPerBeam = 0.0;
+		DesAirVolFlow = 0.0;
+		DesAirFlowPerBeam = 0.0;
+		RhoAir = 0.0;
+		CpAir = 0.0;
+		WaterVel = 0.0;
+		IndAirFlowPerBeamL = 0.0;
+		DT = 0.0;
+		LengthX = 0.0;
+		Length = 0.0;
+		ConvFlow = 0.0;
+		K = 0.0;
+		WaterVolFlowPerBeam = 0.0;
+		ControlCoolBeamQMin = 0.0;
+		ControlCoolBeamQMax = 0.0;
+		QSup = 0.0;
+		PowerMet = 0.0;
+		ControlCoolBeamCWFlow = 0.0;
+		AirMassFlow = 0.0;
+		MaxColdWaterFlow = 0.0;
+		MinColdWaterFlow = 0.0;
+		CpAirZn = 0.0;
+		CpAirSys = 0.0;
+		ControlCoolBeamTWOut = 0.0;
+		CalcCoolBeamIter = 0;
+		TWIn = 0.0;
+		ZTemp = 0.0;
+		WaterCoolPower = 0.0;
+		CalcCoolBeamDT = 0.0;
+		IndFlow = 0.0;
+		CoilFlow = 0.0;
+		CalcCoolBeamWaterVel = 0.0;
+		CalcCoolBeamK = 0.0;
+		AirCoolPower = 0.0;
+		CWFlowPerBeam = 0.0;
+		Coeff = 0.0;
+		Delta = 0.0;
+		mdot = 0.0;
+		UnitOutput = 0.0;
+		CoolBeamResidualTWOut = 0.0;
+	}
+
 	void
 	SimCoolBeam(
 		std::string const & CompName, // name of the cooled beam unit
@@ -207,7 +333,6 @@ namespace HVACCooledBeam {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int CBNum; // index of cooled beam unit being simulated
-		static bool GetInputFlag( true ); // First time, input is "gotten"
 
 		// First time SimIndUnit is called, get the input for all the cooled beam units
 		if ( GetInputFlag ) {
@@ -312,12 +437,8 @@ namespace HVACCooledBeam {
 		Array1D< Real64 > Numbers; // Numeric input items for object
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int NumAlphas( 0 ); // Number of Alphas for each GetObjectItem call
-		static int NumNumbers( 0 ); // Number of Numbers for each GetObjectItem call
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 		//  certain object in the input file
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int CtrlZone; // controlled zome do loop index
@@ -502,12 +623,7 @@ namespace HVACCooledBeam {
 		int InWaterNode; // unit inlet chilled water node
 		int OutWaterNode; // unit outlet chilled water node
 		Real64 RhoAir; // air density at outside pressure and standard temperature and humidity
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool MySizeFlag;
-		static Array1D_bool PlantLoopScanFlag;
 		Real64 rho; // local fluid density
-		static bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
 		int Loop; // Loop checking control variable
 		std::string CurrentModuleObject;
 		bool errFlag;
@@ -648,23 +764,6 @@ namespace HVACCooledBeam {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static std::string const RoutineName( "SizeCoolBeam" );
-		static int PltSizCoolNum( 0 ); // index of plant sizing object for the cooling loop
-		static int NumBeams( 0 ); // number of beams in the zone
-		static int Iter( 0 ); // beam length iteration index
-		static Real64 DesCoilLoad( 0.0 ); // total cooling capacity of the beams in the zone [W]
-		static Real64 DesLoadPerBeam( 0.0 ); // cooling capacity per individual beam [W]
-		static Real64 DesAirVolFlow( 0.0 ); // design total supply air flow rate [m3/s]
-		static Real64 DesAirFlowPerBeam( 0.0 ); // design supply air volumetric flow per beam [m3/s]
-		static Real64 RhoAir( 0.0 );
-		static Real64 CpAir( 0.0 );
-		static Real64 WaterVel( 0.0 ); // design water velocity in beam
-		static Real64 IndAirFlowPerBeamL( 0.0 ); // induced volumetric air flow rate per beam length [m3/s-m]
-		static Real64 DT( 0.0 ); // air - water delta T [C]
-		static Real64 LengthX( 0.0 ); // test value for beam length [m]
-		static Real64 Length( 0.0 ); // beam length [m]
-		static Real64 ConvFlow( 0.0 ); // convective and induced air mass flow rate across beam per beam plan area [kg/s-m2]
-		static Real64 K( 0.0 ); // coil (beam) heat transfer coefficient [W/m2-K]
-		static Real64 WaterVolFlowPerBeam( 0.0 ); // Cooling water volumetric flow per beam [m3]
 		bool ErrorsFound;
 		Real64 rho; // local fluid density
 		Real64 Cp; // local fluid specific heat
@@ -852,7 +951,8 @@ namespace HVACCooledBeam {
 
 		// Using/Aliasing
 		using namespace DataZoneEnergyDemands;
-		using General::SolveRegulaFalsi;
+		using General::SolveRoot;
+		using DataRootFinder::iMethodFalsePosition;
 		using PlantUtilities::SetComponentFlowRate;
 
 		// Locals
@@ -871,21 +971,9 @@ namespace HVACCooledBeam {
 		Real64 QZnReq; // heating or cooling needed by zone [Watts]
 		Real64 QToHeatSetPt; // [W]  remaining load to heating setpoint
 		Real64 QToCoolSetPt; // [W]  remaining load to cooling setpoint
-		static Real64 QMin( 0.0 ); // cooled beam output at minimum water flow [W]
-		static Real64 QMax( 0.0 ); // cooled beam output at maximum water flow [W]
-		static Real64 QSup( 0.0 ); // heating or cooling by supply air [W]
-		static Real64 PowerMet( 0.0 ); // power supplied
-		static Real64 CWFlow( 0.0 ); // cold water flow [kg/s]
-		static Real64 AirMassFlow( 0.0 ); // air mass flow rate for the cooled beam system [kg/s]
-		static Real64 MaxColdWaterFlow( 0.0 ); // max water mass flow rate for the cooled beam system [kg/s]
-		static Real64 MinColdWaterFlow( 0.0 ); // min water mass flow rate for the cooled beam system [kg/s]
-		static Real64 CpAirZn( 0.0 ); // specific heat of air at zone conditions [J/kg-C]
-		static Real64 CpAirSys( 0.0 ); // specific heat of air at supply air conditions [J/kg-C]
-		static Real64 TWOut( 0.0 ); // outlet water tamperature [C]
 		int ControlNode; // the water inlet node
 		int InAirNode; // the air inlet node
 		bool UnitOn; // TRUE if unit is on
-		Array1D< Real64 > Par( 5 );
 		int SolFlag;
 		Real64 ErrTolerance;
 
@@ -912,7 +1000,7 @@ namespace HVACCooledBeam {
 		// set the air volumetric flow rate per beam
 		CoolBeam( CBNum ).BeamFlow = Node( InAirNode ).MassFlowRate / ( StdRhoAir * CoolBeam( CBNum ).NumBeams );
 		// fire the unit at min water flow
-		CalcCoolBeam( CBNum, ZoneNodeNum, MinColdWaterFlow, QMin, TWOut );
+		CalcCoolBeam( CBNum, ZoneNodeNum, MinColdWaterFlow, ControlCoolBeamQMin, ControlCoolBeamTWOut );
 		// cooling by supply air
 		QSup = AirMassFlow * ( CpAirSys * Node( InAirNode ).Temp - CpAirZn * Node( ZoneNodeNum ).Temp );
 		// load on the beams is QToCoolSetPt-QSup
@@ -920,17 +1008,13 @@ namespace HVACCooledBeam {
 			if ( ( QToCoolSetPt - QSup ) < -SmallLoad ) {
 				// There is a cooling demand on the cooled beam system.
 				// First, see if the system can meet the load
-				CalcCoolBeam( CBNum, ZoneNodeNum, MaxColdWaterFlow, QMax, TWOut );
-				if ( ( QMax < QToCoolSetPt - QSup - SmallLoad ) && ( QMax != QMin ) ) {
+				CalcCoolBeam( CBNum, ZoneNodeNum, MaxColdWaterFlow, ControlCoolBeamQMax, ControlCoolBeamTWOut );
+				if ( ( ControlCoolBeamQMax < QToCoolSetPt - QSup - SmallLoad ) && ( ControlCoolBeamQMax != ControlCoolBeamQMin ) ) {
 					// The cooled beam system can meet the demand.
 					// Set up the iterative calculation of chilled water flow rate
-					Par( 1 ) = double( CBNum );
-					Par( 2 ) = double( ZoneNodeNum );
-					Par( 3 ) = QToCoolSetPt - QSup; // load to be met by the beams
-					Par( 4 ) = QMin;
-					Par( 5 ) = QMax;
+					Real64 const BeamLoad( QToCoolSetPt - QSup ); // load to be met by the beams
 					ErrTolerance = 0.01;
-					SolveRegulaFalsi( ErrTolerance, 50, SolFlag, CWFlow, CoolBeamResidual, MinColdWaterFlow, MaxColdWaterFlow, Par );
+					SolveRoot( ErrTolerance, 50, SolFlag, ControlCoolBeamCWFlow, [&]( Real64 const CWFlowTrial ) { return CoolBeamResidual( CWFlowTrial, CBNum, ZoneNodeNum, BeamLoad, ControlCoolBeamQMin, ControlCoolBeamQMax ); }, MinColdWaterFlow, MaxColdWaterFlow, iMethodFalsePosition, "ControlCooledBeam" );
 					if ( SolFlag == -1 ) {
 						ShowWarningError( "Cold water control failed in cooled beam unit " + CoolBeam( CBNum ).Name );
 						ShowContinueError( "  Iteration limit exceeded in calculating cold water mass flow rate" );
@@ -940,18 +1024,18 @@ namespace HVACCooledBeam {
 					}
 				} else {
 					// unit maxed out
-					CWFlow = MaxColdWaterFlow;
+					ControlCoolBeamCWFlow = MaxColdWaterFlow;
 				}
 			} else {
 				// unit has no load
-				CWFlow = MinColdWaterFlow;
+				ControlCoolBeamCWFlow = MinColdWaterFlow;
 			}
 		} else {
 			// unit Off
-			CWFlow = MinColdWaterFlow;
+			ControlCoolBeamCWFlow = MinColdWaterFlow;
 		}
 		// Get the cooling output at the chosen water flow rate
-		CalcCoolBeam( CBNum, ZoneNodeNum, CWFlow, PowerMet, TWOut );
+		CalcCoolBeam( CBNum, ZoneNodeNum, ControlCoolBeamCWFlow, PowerMet, ControlCoolBeamTWOut );
 		CoolBeam( CBNum ).BeamCoolingRate = -PowerMet;
 		if ( QSup < 0.0 ) {
 			CoolBeam( CBNum ).SupAirCoolingRate = std::abs( QSup );
@@ -959,7 +1043,7 @@ namespace HVACCooledBeam {
 			CoolBeam( CBNum ).SupAirHeatingRate = QSup;
 		}
 		CoolBeam( CBNum ).CoolWaterMassFlow = Node( ControlNode ).MassFlowRate;
-		CoolBeam( CBNum ).TWOut = TWOut;
+		CoolBeam( CBNum ).TWOut = ControlCoolBeamTWOut;
 		CoolBeam( CBNum ).EnthWaterOut = Node( ControlNode ).Enthalpy + CoolBeam( CBNum ).BeamCoolingRate;
 		//  Node(ControlNode)%MassFlowRate = CWFlow
 		NonAirSysOutput = PowerMet;
@@ -1011,21 +1095,7 @@ namespace HVACCooledBeam {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int Iter( 0 ); // TWOut iteration index
-		static Real64 TWIn( 0.0 ); // Inlet water temperature [C]
-		static Real64 ZTemp( 0.0 ); // zone air temperature [C]
-		static Real64 WaterCoolPower( 0.0 ); // cooling power from water side [W]
-		static Real64 DT( 0.0 ); // approximate air - water delta T [C]
-		static Real64 IndFlow( 0.0 ); // induced air flow rate per beam length [m3/s-m]
-		static Real64 CoilFlow( 0.0 ); // mass air flow rate of air passing through "coil" [kg/m2-s]
-		static Real64 WaterVel( 0.0 ); // water velocity [m/s]
-		static Real64 K( 0.0 ); // coil heat transfer coefficient [W/m2-K]
-		static Real64 AirCoolPower( 0.0 ); // cooling power from the air side [W]
 		Real64 Diff; // difference between water side cooling power and air side cooling power [W]
-		static Real64 CWFlowPerBeam( 0.0 ); // water mass flow rate per beam
-		static Real64 Coeff( 0.0 ); // iteration parameter
-		static Real64 Delta( 0.0 );
-		static Real64 mdot( 0.0 );
 		Real64 Cp; // local fluid specific heat
 		Real64 rho; // local fluid density
 
@@ -1048,26 +1118,26 @@ namespace HVACCooledBeam {
 			TWOut = TWIn;
 			return;
 		}
-		for ( Iter = 1; Iter <= 200; ++Iter ) {
-			if ( Iter > 50 && Iter < 100 ) {
+		for ( CalcCoolBeamIter = 1; CalcCoolBeamIter <= 200; ++CalcCoolBeamIter ) {
+			if ( CalcCoolBeamIter > 50 && CalcCoolBeamIter < 100 ) {
 				Coeff = 0.1 * Coeff2;
-			} else if ( Iter > 100 ) {
+			} else if ( CalcCoolBeamIter > 100 ) {
 				Coeff = 0.01 * Coeff2;
 			} else {
 				Coeff = Coeff2;
 			}
 
 			WaterCoolPower = CWFlowPerBeam * Cp * ( TWOut - TWIn );
-			DT = max( ZTemp - 0.5 * ( TWIn + TWOut ), 0.0 );
-			IndFlow = CoolBeam( CBNum ).K1 * std::pow( DT, CoolBeam( CBNum ).n ) + CoolBeam( CBNum ).Kin * CoolBeam( CBNum ).BeamFlow / CoolBeam( CBNum ).BeamLength;
+			CalcCoolBeamDT = max( ZTemp - 0.5 * ( TWIn + TWOut ), 0.0 );
+			IndFlow = CoolBeam( CBNum ).K1 * std::pow( CalcCoolBeamDT, CoolBeam( CBNum ).n ) + CoolBeam( CBNum ).Kin * CoolBeam( CBNum ).BeamFlow / CoolBeam( CBNum ).BeamLength;
 			CoilFlow = ( IndFlow / CoolBeam( CBNum ).a0 ) * StdRhoAir;
-			WaterVel = CWFlowPerBeam / ( rho * Pi * pow_2( CoolBeam( CBNum ).InDiam ) / 4.0 );
-			if ( WaterVel > MinWaterVel ) {
-				K = CoolBeam( CBNum ).a * std::pow( DT, CoolBeam( CBNum ).n1 ) * std::pow( CoilFlow, CoolBeam( CBNum ).n2 ) * std::pow( WaterVel, CoolBeam( CBNum ).n3 );
+			CalcCoolBeamWaterVel = CWFlowPerBeam / ( rho * Pi * pow_2( CoolBeam( CBNum ).InDiam ) / 4.0 );
+			if ( CalcCoolBeamWaterVel > MinWaterVel ) {
+				CalcCoolBeamK = CoolBeam( CBNum ).a * std::pow( CalcCoolBeamDT, CoolBeam( CBNum ).n1 ) * std::pow( CoilFlow, CoolBeam( CBNum ).n2 ) * std::pow( CalcCoolBeamWaterVel, CoolBeam( CBNum ).n3 );
 			} else {
-				K = CoolBeam( CBNum ).a * std::pow( DT, CoolBeam( CBNum ).n1 ) * std::pow( CoilFlow, CoolBeam( CBNum ).n2 ) * std::pow( MinWaterVel, CoolBeam( CBNum ).n3 ) * ( WaterVel / MinWaterVel );
+				CalcCoolBeamK = CoolBeam( CBNum ).a * std::pow( CalcCoolBeamDT, CoolBeam( CBNum ).n1 ) * std::pow( CoilFlow, CoolBeam( CBNum ).n2 ) * std::pow( MinWaterVel, CoolBeam( CBNum ).n3 ) * ( CalcCoolBeamWaterVel / MinWaterVel );
 			}
-			AirCoolPower = K * CoolBeam( CBNum ).CoilArea * DT * CoolBeam( CBNum ).BeamLength;
+			AirCoolPower = CalcCoolBeamK * CoolBeam( CBNum ).CoilArea * CalcCoolBeamDT * CoolBeam( CBNum ).BeamLength;
 			Diff = WaterCoolPower - AirCoolPower;
 			Delta = TWOut * ( std::abs( Diff ) / Coeff );
 			if ( std::abs( Diff ) > 0.1 ) {
@@ -1096,7 +1166,11 @@ namespace HVACCooledBeam {
 	Real64
 	CoolBeamResidual(
 		Real64 const CWFlow, // cold water flow rate in kg/s
-		Array1< Real64 > const & Par
+		int const CBIndex, // cooled beam unit index
+		int const ZoneNodeIndex, // zone node number
+		Real64 const BeamLoad, // load to be met by the beams [W]
+		Real64 const QMin, // unit output at minimum cold water flow [W]
+		Real64 const QMax // unit output at maximum cold water flow [W]
 	)
 	{
 
@@ -1136,15 +1210,9 @@ namespace HVACCooledBeam {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		int CBIndex;
-		int ZoneNodeIndex;
-		static Real64 UnitOutput( 0.0 );
-		static Real64 TWOut( 0.0 );
-
-		CBIndex = int( Par( 1 ) );
-		ZoneNodeIndex = int( Par( 2 ) );
-		CalcCoolBeam( CBIndex, ZoneNodeIndex, CWFlow, UnitOutput, TWOut );
-		Residuum = ( Par( 3 ) - UnitOutput ) / ( Par( 5 ) - Par( 4 ) );
+
+		CalcCoolBeam( CBIndex, ZoneNodeIndex, CWFlow, UnitOutput, CoolBeamResidualTWOut );
+		Residuum = ( BeamLoad - UnitOutput ) / ( QMax - QMin );
 
 		return Residuum;
 	}
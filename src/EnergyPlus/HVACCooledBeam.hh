@@ -201,6 +201,11 @@ namespace HVACCooledBeam {
 
 	// Functions
 
+	// Clears the global data in HVACCooledBeam.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimCoolBeam(
 		std::string const & CompName, // name of the cooled beam unit
@@ -244,7 +249,11 @@ namespace HVACCooledBeam {
 	Real64
 	CoolBeamResidual(
 		Real64 const CWFlow, // cold water flow rate in kg/s
-		Array1< Real64 > const & Par
+		int const CBIndex, // cooled beam unit index
+		int const ZoneNodeIndex, // zone node number
+		Real64 const BeamLoad, // load to be met by the beams [W]
+		Real64 const QMin, // unit output at minimum cold water flow [W]
+		Real64 const QMax // unit output at maximum cold water flow [W]
 	);
 
 	void
@@ -145,6 +145,40 @@ namespace HVACDXHeatPumpSystem {
 	// MODULE SUBROUTINES:
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // Flag to get input only once
+		Real64 QZnReq( 0.001 ); // Zone load (W), input to variable-speed DX coil
+		Real64 QLatReq( 0.0 ); // Zone latent load, input to variable-speed DX coil
+		Real64 MaxONOFFCyclesperHour( 4.0 ); // Maximum cycling rate of heat pump [cycles/hr]
+		Real64 HPTimeConstant( 0.0 ); // Heat pump time constant [s]
+		Real64 FanDelayTime( 0.0 ); // Fan delay time, time delay for the HP's fan to
+		Real64 OnOffAirFlowRatio( 1.0 ); // ratio of compressor on flow to average flow over time step
+		bool ErrorsFound( false ); // If errors detected in input
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		bool MySetPointCheckFlag( true );
+		int SpeedNum( 1 ); // speed number of variable speed DX cooling coil
+		Real64 VSCoilCyclingResidualQZnReq( 0.001 ); // Zone load (W), input to variable-speed DX coil
+		Real64 VSCoilCyclingResidualQLatReq( 0.0 ); // Zone latent load, input to variable-speed DX coil
+		Real64 VSCoilCyclingResidualMaxONOFFCyclesperHour( 4.0 ); // Maximum cycling rate of heat pump [cycles/hr]
+		Real64 VSCoilCyclingResidualHPTimeConstant( 0.0 ); // Heat pump time constant [s]
+		Real64 VSCoilCyclingResidualFanDelayTime( 0.0 ); // Fan delay time, time delay for the HP's fan to
+		Real64 VSCoilCyclingResidualOnOffAirFlowRatio( 1.0 ); // ratio of compressor on flow to average flow over time step
+		Real64 VSCoilCyclingResidualSpeedRatio( 0.0 ); // SpeedRatio varies between 1.0 (higher speed) and 0.0 (lower speed)
+		int VSCoilSpeedResidualSpeedNum( 1 ); // speed number of variable speed DX cooling coil
+		Real64 VSCoilSpeedResidualQZnReq( 0.001 ); // Zone load (W), input to variable-speed DX coil
+		Real64 VSCoilSpeedResidualQLatReq( 0.0 ); // Zone latent load, input to variable-speed DX coil
+		Real64 VSCoilSpeedResidualMaxONOFFCyclesperHour( 4.0 ); // Maximum cycling rate of heat pump [cycles/hr]
+		Real64 VSCoilSpeedResidualHPTimeConstant( 0.0 ); // Heat pump time constant [s]
+		Real64 VSCoilSpeedResidualFanDelayTime( 0.0 ); // Fan delay time, time delay for the HP's fan to
+		Real64 VSCoilSpeedResidualOnOffAirFlowRatio( 1.0 ); // ratio of compressor on flow to average flow over time step
+		Real64 VSCoilSpeedResidualPartLoadRatio( 1.0 ); // SpeedRatio varies between 1.0 (higher speed) and 0.0 (lower speed)
+	}
+
 	// Functions
 
 	void
@@ -154,6 +188,32 @@ namespace HVACDXHeatPumpSystem {
 		EconomizerFlag = false;
 		CheckEquipName.deallocate();
 		DXHeatPumpSystem.deallocate();
+		GetInputFlag = true;
+		QZnReq = 0.001;
+		QLatReq = 0.0;
+		MaxONOFFCyclesperHour = 4.0;
+		HPTimeConstant = 0.0;
+		FanDelayTime = 0.0;
+		OnOffAirFlowRatio = 1.0;
+		ErrorsFound = false;
+		TotalArgs = 0;
+		MySetPointCheckFlag = true;
+		SpeedNum = 1;
+		VSCoilCyclingResidualQZnReq = 0.001;
+		VSCoilCyclingResidualQLatReq = 0.0;
+		VSCoilCyclingResidualMaxONOFFCyclesperHour = 4.0;
+		VSCoilCyclingResidualHPTimeConstant = 0.0;
+		VSCoilCyclingResidualFanDelayTime = 0.0;
+		VSCoilCyclingResidualOnOffAirFlowRatio = 1.0;
+		VSCoilCyclingResidualSpeedRatio = 0.0;
+		VSCoilSpeedResidualSpeedNum = 1;
+		VSCoilSpeedResidualQZnReq = 0.001;
+		VSCoilSpeedResidualQLatReq = 0.0;
+		VSCoilSpeedResidualMaxONOFFCyclesperHour = 4.0;
+		VSCoilSpeedResidualHPTimeConstant = 0.0;
+		VSCoilSpeedResidualFanDelayTime = 0.0;
+		VSCoilSpeedResidualOnOffAirFlowRatio = 1.0;
+		VSCoilSpeedResidualPartLoadRatio = 1.0;
 	}
 
 	void
@@ -211,17 +271,10 @@ namespace HVACDXHeatPumpSystem {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		std::string CompName; // Name of CoilSystem:Heating:DX object
 		int DXSystemNum; // Index to CoilSystem:Heating:DX object
-		static bool GetInputFlag( true ); // Flag to get input only once
 		Real64 AirMassFlow; // DX System air mass flow rate
 		int InletNodeNum; // DX System inlet node number
 		int OutletNodeNum; // DX System outlet node number
 		//local variables for calling variable speed coil
-		static Real64 QZnReq( 0.001 ); // Zone load (W), input to variable-speed DX coil
-		static Real64 QLatReq( 0.0 ); // Zone latent load, input to variable-speed DX coil
-		static Real64 MaxONOFFCyclesperHour( 4.0 ); // Maximum cycling rate of heat pump [cycles/hr]
-		static Real64 HPTimeConstant( 0.0 ); // Heat pump time constant [s]
-		static Real64 FanDelayTime( 0.0 ); // Fan delay time, time delay for the HP's fan to
-		static Real64 OnOffAirFlowRatio( 1.0 ); // ratio of compressor on flow to average flow over time step
 
 		// Obtains and Allocates DX Cooling System related parameters from input file
 		if ( GetInputFlag ) { //First time subroutine has been entered
@@ -349,7 +402,6 @@ namespace HVACDXHeatPumpSystem {
 		int NumNums;
 		int IOStat;
 		static std::string const RoutineName( "GetDXHeatPumpSystemInput: " ); // include trailing blank space
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int DXHeatSysNum;
@@ -360,7 +412,6 @@ namespace HVACDXHeatPumpSystem {
 		Array1D< Real64 > Numbers; // Numeric input items for object
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 		//  certain object in the input file
 
 		// Flow
@@ -523,7 +574,6 @@ namespace HVACDXHeatPumpSystem {
 		int ControlNode; // control node number
 		int DXSysIndex;
 		//  LOGICAL,SAVE        :: MyOneTimeFlag = .TRUE.
-		static bool MySetPointCheckFlag( true );
 		int OutdoorAirUnitNum; // "ONLY" for ZoneHVAC:OutdoorAirUnit
 		Real64 OAUCoilOutletTemp; // "ONLY" for zoneHVAC:OutdoorAirUnit
 		// FLOW:
@@ -738,7 +788,7 @@ namespace HVACDXHeatPumpSystem {
 							Par( 2 ) = DesOutTemp;
 							Par( 3 ) = 1.0; //OnOffAirFlowFrac assume = 1.0 for continuous fan dx system
 							Par( 5 ) = double( FanOpMode );
-							SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, DXHeatingCoilResidual, 0.0, 1.0, Par );
+							SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, DXHeatingCoilResidual, 0.0, 1.0, Par, "ControlDXHeatingSystem" );
 							if ( SolFla == -1 ) {
 								if ( ! WarmupFlag ) {
 									if ( DXHeatPumpSystem( DXSystemNum ).DXCoilSensPLRIter < 1 ) {
@@ -853,7 +903,7 @@ namespace HVACDXHeatPumpSystem {
 								Par( 2 ) = DesOutTemp;
 								Par( 5 ) = double( FanOpMode );
 								Par( 3 ) = double( SpeedNum );
-								SolveRegulaFalsi( Acc, MaxIte, SolFla, SpeedRatio, VSCoilSpeedResidual, 1.0e-10, 1.0, Par );
+								SolveRegulaFalsi( Acc, MaxIte, SolFla, SpeedRatio, VSCoilSpeedResidual, 1.0e-10, 1.0, Par, "ControlDXHeatingSystem" );
 
 								if ( SolFla == -1 ) {
 									if ( ! WarmupFlag ) {
@@ -885,7 +935,7 @@ namespace HVACDXHeatPumpSystem {
 								Par( 1 ) = double( VSCoilIndex );
 								Par( 2 ) = DesOutTemp;
 								Par( 5 ) = double( FanOpMode );
-								SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, VSCoilCyclingResidual, 1.0e-10, 1.0, Par );
+								SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, VSCoilCyclingResidual, 1.0e-10, 1.0, Par, "ControlDXHeatingSystem" );
 								if ( SolFla == -1 ) {
 									if ( ! WarmupFlag ) {
 										if ( DXHeatPumpSystem( DXSystemNum ).DXCoilSensPLRIter < 1 ) {
@@ -1044,19 +1094,11 @@ namespace HVACDXHeatPumpSystem {
 		int CoilIndex; // index of this coil
 		Real64 OutletAirTemp; // outlet air temperature [C]
 		int FanOpMode; // Supply air fan operating mode
-		static int SpeedNum( 1 ); // speed number of variable speed DX cooling coil
-		static Real64 QZnReq( 0.001 ); // Zone load (W), input to variable-speed DX coil
-		static Real64 QLatReq( 0.0 ); // Zone latent load, input to variable-speed DX coil
-		static Real64 MaxONOFFCyclesperHour( 4.0 ); // Maximum cycling rate of heat pump [cycles/hr]
-		static Real64 HPTimeConstant( 0.0 ); // Heat pump time constant [s]
-		static Real64 FanDelayTime( 0.0 ); // Fan delay time, time delay for the HP's fan to
-		static Real64 OnOffAirFlowRatio( 1.0 ); // ratio of compressor on flow to average flow over time step
-		static Real64 SpeedRatio( 0.0 ); // SpeedRatio varies between 1.0 (higher speed) and 0.0 (lower speed)
 
 		CoilIndex = int( Par( 1 ) );
 		FanOpMode = int( Par( 5 ) );
 
-		SimVariableSpeedCoils( "", CoilIndex, FanOpMode, MaxONOFFCyclesperHour, HPTimeConstant, FanDelayTime, On, PartLoadRatio, SpeedNum, SpeedRatio, QZnReq, QLatReq, OnOffAirFlowRatio );
+		SimVariableSpeedCoils( "", CoilIndex, FanOpMode, VSCoilCyclingResidualMaxONOFFCyclesperHour, VSCoilCyclingResidualHPTimeConstant, VSCoilCyclingResidualFanDelayTime, On, PartLoadRatio, SpeedNum, VSCoilCyclingResidualSpeedRatio, VSCoilCyclingResidualQZnReq, VSCoilCyclingResidualQLatReq, VSCoilCyclingResidualOnOffAirFlowRatio );
 
 		OutletAirTemp = VarSpeedCoil( CoilIndex ).OutletAirDBTemp;
 		Residuum = Par( 2 ) - OutletAirTemp;
@@ -1114,20 +1156,12 @@ namespace HVACDXHeatPumpSystem {
 		int CoilIndex; // index of this coil
 		Real64 OutletAirTemp; // outlet air temperature [C]
 		int FanOpMode; // Supply air fan operating mode
-		static int SpeedNum( 1 ); // speed number of variable speed DX cooling coil
-		static Real64 QZnReq( 0.001 ); // Zone load (W), input to variable-speed DX coil
-		static Real64 QLatReq( 0.0 ); // Zone latent load, input to variable-speed DX coil
-		static Real64 MaxONOFFCyclesperHour( 4.0 ); // Maximum cycling rate of heat pump [cycles/hr]
-		static Real64 HPTimeConstant( 0.0 ); // Heat pump time constant [s]
-		static Real64 FanDelayTime( 0.0 ); // Fan delay time, time delay for the HP's fan to
-		static Real64 OnOffAirFlowRatio( 1.0 ); // ratio of compressor on flow to average flow over time step
-		static Real64 PartLoadRatio( 1.0 ); // SpeedRatio varies between 1.0 (higher speed) and 0.0 (lower speed)
 
 		CoilIndex = int( Par( 1 ) );
 		FanOpMode = int( Par( 5 ) );
-		SpeedNum = int( Par( 3 ) );
+		VSCoilSpeedResidualSpeedNum = int( Par( 3 ) );
 
-		SimVariableSpeedCoils( "", CoilIndex, FanOpMode, MaxONOFFCyclesperHour, HPTimeConstant, FanDelayTime, On, PartLoadRatio, SpeedNum, SpeedRatio, QZnReq, QLatReq, OnOffAirFlowRatio );
+		SimVariableSpeedCoils( "", CoilIndex, FanOpMode, VSCoilSpeedResidualMaxONOFFCyclesperHour, VSCoilSpeedResidualHPTimeConstant, VSCoilSpeedResidualFanDelayTime, On, VSCoilSpeedResidualPartLoadRatio, VSCoilSpeedResidualSpeedNum, SpeedRatio, VSCoilSpeedResidualQZnReq, VSCoilSpeedResidualQLatReq, VSCoilSpeedResidualOnOffAirFlowRatio );
 
 		OutletAirTemp = VarSpeedCoil( CoilIndex ).OutletAirDBTemp;
 		Residuum = Par( 2 ) - OutletAirTemp;
@@ -172,6 +172,57 @@ namespace HVACDXSystem {
 	// MODULE SUBROUTINES:
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		Real64 QZnReq( 0.001 ); // Zone load (W), input to variable-speed DX coil
+		Real64 QLatReq( 0.0 ); // Zone latent load, input to variable-speed DX coil
+		Real64 MaxONOFFCyclesperHour( 4.0 ); // Maximum cycling rate of heat pump [cycles/hr]
+		Real64 HPTimeConstant( 0.0 ); // Heat pump time constant [s]
+		Real64 FanDelayTime( 0.0 ); // Fan delay time, time delay for the HP's fan to
+		Real64 OnOffAirFlowRatio( 1.0 ); // ratio of compressor on flow to average flow over time step
+		bool ErrorsFound( false ); // If errors detected in input
+		bool GetDXCoolingSystemInputErrFound( false ); // used for mining functions
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		bool MyOneTimeFlag( true );
+		bool MySetPointCheckFlag( true );
+		int SpeedNum( 1 ); // speed number of variable speed DX cooling coil
+		Real64 VSCoilCyclingResidualQZnReq( 0.001 ); // Zone load (W), input to variable-speed DX coil
+		Real64 VSCoilCyclingResidualQLatReq( 0.0 ); // Zone latent load, input to variable-speed DX coil
+		Real64 VSCoilCyclingResidualMaxONOFFCyclesperHour( 4.0 ); // Maximum cycling rate of heat pump [cycles/hr]
+		Real64 VSCoilCyclingResidualHPTimeConstant( 0.0 ); // Heat pump time constant [s]
+		Real64 VSCoilCyclingResidualFanDelayTime( 0.0 ); // Fan delay time, time delay for the HP's fan to
+		Real64 VSCoilCyclingResidualOnOffAirFlowRatio( 1.0 ); // ratio of compressor on flow to average flow over time step
+		Real64 VSCoilCyclingResidualSpeedRatio( 0.0 ); // SpeedRatio varies between 1.0 (higher speed) and 0.0 (lower speed)
+		int VSCoilSpeedResidualSpeedNum( 1 ); // speed number of variable speed DX cooling coil
+		Real64 VSCoilSpeedResidualQZnReq( 0.001 ); // Zone load (W), input to variable-speed DX coil
+		Real64 VSCoilSpeedResidualQLatReq( 0.0 ); // Zone latent load, input to variable-speed DX coil
+		Real64 VSCoilSpeedResidualMaxONOFFCyclesperHour( 4.0 ); // Maximum cycling rate of heat pump [cycles/hr]
+		Real64 VSCoilSpeedResidualHPTimeConstant( 0.0 ); // Heat pump time constant [s]
+		Real64 VSCoilSpeedResidualFanDelayTime( 0.0 ); // Fan delay time, time delay for the HP's fan to
+		Real64 VSCoilSpeedResidualOnOffAirFlowRatio( 1.0 ); // ratio of compressor on flow to average flow over time step
+		Real64 VSCoilSpeedResidualPartLoadRatio( 1.0 ); // SpeedRatio varies between 1.0 (higher speed) and 0.0 (lower speed)
+		int VSCoilCyclingHumResidualSpeedNum( 1 ); // speed number of variable speed DX cooling coil
+		Real64 VSCoilCyclingHumResidualQZnReq( 0.001 ); // Zone load (W), input to variable-speed DX coil
+		Real64 VSCoilCyclingHumResidualQLatReq( 0.0 ); // Zone latent load, input to variable-speed DX coil
+		Real64 VSCoilCyclingHumResidualMaxONOFFCyclesperHour( 4.0 ); // Maximum cycling rate of heat pump [cycles/hr]
+		Real64 VSCoilCyclingHumResidualHPTimeConstant( 0.0 ); // Heat pump time constant [s]
+		Real64 VSCoilCyclingHumResidualFanDelayTime( 0.0 ); // Fan delay time, time delay for the HP's fan to
+		Real64 VSCoilCyclingHumResidualOnOffAirFlowRatio( 1.0 ); // ratio of compressor on flow to average flow over time step
+		Real64 VSCoilCyclingHumResidualSpeedRatio( 0.0 ); // SpeedRatio varies between 1.0 (higher speed) and 0.0 (lower speed)
+		int VSCoilSpeedHumResidualSpeedNum( 1 ); // speed number of variable speed DX cooling coil
+		Real64 VSCoilSpeedHumResidualQZnReq( 0.001 ); // Zone load (W), input to variable-speed DX coil
+		Real64 VSCoilSpeedHumResidualQLatReq( 0.0 ); // Zone latent load, input to variable-speed DX coil
+		Real64 VSCoilSpeedHumResidualMaxONOFFCyclesperHour( 4.0 ); // Maximum cycling rate of heat pump [cycles/hr]
+		Real64 VSCoilSpeedHumResidualHPTimeConstant( 0.0 ); // Heat pump time constant [s]
+		Real64 VSCoilSpeedHumResidualFanDelayTime( 0.0 ); // Fan delay time, time delay for the HP's fan to
+		Real64 VSCoilSpeedHumResidualOnOffAirFlowRatio( 1.0 ); // ratio of compressor on flow to average flow over time step
+		Real64 VSCoilSpeedHumResidualPartLoadRatio( 1.0 ); // SpeedRatio varies between 1.0 (higher speed) and 0.0 (lower speed)
+	}
+
 	// Functions
 
 	void
@@ -182,6 +233,49 @@ namespace HVACDXSystem {
 		GetInputFlag = true;
 		CheckEquipName.deallocate();
 		DXCoolingSystem.deallocate();
+		QZnReq = 0.001;
+		QLatReq = 0.0;
+		MaxONOFFCyclesperHour = 4.0;
+		HPTimeConstant = 0.0;
+		FanDelayTime = 0.0;
+		OnOffAirFlowRatio = 1.0;
+		ErrorsFound = false;
+		GetDXCoolingSystemInputErrFound = false;
+		TotalArgs = 0;
+		MyOneTimeFlag = true;
+		MySetPointCheckFlag = true;
+		SpeedNum = 1;
+		VSCoilCyclingResidualQZnReq = 0.001;
+		VSCoilCyclingResidualQLatReq = 0.0;
+		VSCoilCyclingResidualMaxONOFFCyclesperHour = 4.0;
+		VSCoilCyclingResidualHPTimeConstant = 0.0;
+		VSCoilCyclingResidualFanDelayTime = 0.0;
+		VSCoilCyclingResidualOnOffAirFlowRatio = 1.0;
+		VSCoilCyclingResidualSpeedRatio = 0.0;
+		VSCoilSpeedResidualSpeedNum = 1;
+		VSCoilSpeedResidualQZnReq = 0.001;
+		VSCoilSpeedResidualQLatReq = 0.0;
+		VSCoilSpeedResidualMaxONOFFCyclesperHour = 4.0;
+		VSCoilSpeedResidualHPTimeConstant = 0.0;
+		VSCoilSpeedResidualFanDelayTime = 0.0;
+		VSCoilSpeedResidualOnOffAirFlowRatio = 1.0;
+		VSCoilSpeedResidualPartLoadRatio = 1.0;
+		VSCoilCyclingHumResidualSpeedNum = 1;
+		VSCoilCyclingHumResidualQZnReq = 0.001;
+		VSCoilCyclingHumResidualQLatReq = 0.0;
+		VSCoilCyclingHumResidualMaxONOFFCyclesperHour = 4.0;
+		VSCoilCyclingHumResidualHPTimeConstant = 0.0;
+		VSCoilCyclingHumResidualFanDelayTime = 0.0;
+		VSCoilCyclingHumResidualOnOffAirFlowRatio = 1.0;
+		VSCoilCyclingHumResidualSpeedRatio = 0.0;
+		VSCoilSpeedHumResidualSpeedNum = 1;
+		VSCoilSpeedHumResidualQZnReq = 0.001;
+		VSCoilSpeedHumResidualQLatReq = 0.0;
+		VSCoilSpeedHumResidualMaxONOFFCyclesperHour = 4.0;
+		VSCoilSpeedHumResidualHPTimeConstant = 0.0;
+		VSCoilSpeedHumResidualFanDelayTime = 0.0;
+		VSCoilSpeedHumResidualOnOffAirFlowRatio = 1.0;
+		VSCoilSpeedHumResidualPartLoadRatio = 1.0;
 	}
 
 	void
@@ -250,12 +344,6 @@ namespace HVACDXSystem {
 		int InletNodeNum; // DX System inlet node number
 		int OutletNodeNum; // DX System outlet node number
 		//local variables for calling variable speed coil
-		static Real64 QZnReq( 0.001 ); // Zone load (W), input to variable-speed DX coil
-		static Real64 QLatReq( 0.0 ); // Zone latent load, input to variable-speed DX coil
-		static Real64 MaxONOFFCyclesperHour( 4.0 ); // Maximum cycling rate of heat pump [cycles/hr]
-		static Real64 HPTimeConstant( 0.0 ); // Heat pump time constant [s]
-		static Real64 FanDelayTime( 0.0 ); // Fan delay time, time delay for the HP's fan to
-		static Real64 OnOffAirFlowRatio( 1.0 ); // ratio of compressor on flow to average flow over time step
 
 		// Obtains and Allocates DX Cooling System related parameters from input file
 		if ( GetInputFlag ) { //First time subroutine has been entered
@@ -402,8 +490,6 @@ namespace HVACDXSystem {
 		int NumNums;
 		int IOStat;
 		static std::string const RoutineName( "GetDXCoolingSystemInput: " ); // include trailing blank space
-		static bool ErrorsFound( false ); // If errors detected in input
-		static bool ErrFound( false ); // used for mining functions
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int DXCoolSysNum;
@@ -417,7 +503,6 @@ namespace HVACDXSystem {
 		Array1D< Real64 > Numbers; // Numeric input items for object
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 		//  certain object in the input file
 
 		// Flow
@@ -479,32 +564,32 @@ namespace HVACDXSystem {
 				DXCoolingSystem( DXCoolSysNum ).CoolingCoilType = Alphas( 6 );
 				DXCoolingSystem( DXCoolSysNum ).CoolingCoilName = Alphas( 7 );
 
-				ErrFound = false;
+				GetDXCoolingSystemInputErrFound = false;
 				if ( SameString( Alphas( 6 ), "Coil:Cooling:DX:SingleSpeed" ) ) {
 					DXCoolingSystem( DXCoolSysNum ).CoolingCoilType_Num = CoilDX_CoolingSingleSpeed;
-					GetDXCoilIndex( DXCoolingSystem( DXCoolSysNum ).CoolingCoilName, DXCoolingSystem( DXCoolSysNum ).CoolingCoilIndex, ErrFound, CurrentModuleObject );
-					if ( ErrFound ) {
+					GetDXCoilIndex( DXCoolingSystem( DXCoolSysNum ).CoolingCoilName, DXCoolingSystem( DXCoolSysNum ).CoolingCoilIndex, GetDXCoolingSystemInputErrFound, CurrentModuleObject );
+					if ( GetDXCoolingSystemInputErrFound ) {
 						ShowContinueError( "...occurs in " + CurrentModuleObject + " = " + DXCoolingSystem( DXCoolSysNum ).Name );
 						ErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( 6 ), "Coil:Cooling:DX:VariableSpeed" ) ) {
 					DXCoolingSystem( DXCoolSysNum ).CoolingCoilType_Num = Coil_CoolingAirToAirVariableSpeed;
-					DXCoolingSystem( DXCoolSysNum ).CoolingCoilIndex = GetCoilIndexVariableSpeed( "Coil:Cooling:DX:VariableSpeed", DXCoolingSystem( DXCoolSysNum ).CoolingCoilName, ErrFound );
-					if ( ErrFound ) {
+					DXCoolingSystem( DXCoolSysNum ).CoolingCoilIndex = GetCoilIndexVariableSpeed( "Coil:Cooling:DX:VariableSpeed", DXCoolingSystem( DXCoolSysNum ).CoolingCoilName, GetDXCoolingSystemInputErrFound );
+					if ( GetDXCoolingSystemInputErrFound ) {
 						ShowContinueError( "...occurs in " + CurrentModuleObject + " = " + DXCoolingSystem( DXCoolSysNum ).Name );
 						ErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( 6 ), "Coil:Cooling:DX:TwoSpeed" ) ) {
 					DXCoolingSystem( DXCoolSysNum ).CoolingCoilType_Num = CoilDX_CoolingTwoSpeed;
-					GetDXCoilIndex( DXCoolingSystem( DXCoolSysNum ).CoolingCoilName, DXCoolingSystem( DXCoolSysNum ).CoolingCoilIndex, ErrFound, CurrentModuleObject );
-					if ( ErrFound ) {
+					GetDXCoilIndex( DXCoolingSystem( DXCoolSysNum ).CoolingCoilName, DXCoolingSystem( DXCoolSysNum ).CoolingCoilIndex, GetDXCoolingSystemInputErrFound, CurrentModuleObject );
+					if ( GetDXCoolingSystemInputErrFound ) {
 						ShowContinueError( "...occurs in " + CurrentModuleObject + " = " + DXCoolingSystem( DXCoolSysNum ).Name );
 						ErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( 6 ), "CoilSystem:Cooling:DX:HeatExchangerAssisted" ) ) {
 					DXCoolingSystem( DXCoolSysNum ).CoolingCoilType_Num = CoilDX_CoolingHXAssisted;
-					GetHXDXCoilIndex( DXCoolingSystem( DXCoolSysNum ).CoolingCoilName, DXCoolingSystem( DXCoolSysNum ).CoolingCoilIndex, ErrFound, CurrentModuleObject );
-					if ( ErrFound ) {
+					GetHXDXCoilIndex( DXCoolingSystem( DXCoolSysNum ).CoolingCoilName, DXCoolingSystem( DXCoolSysNum ).CoolingCoilIndex, GetDXCoolingSystemInputErrFound, CurrentModuleObject );
+					if ( GetDXCoolingSystemInputErrFound ) {
 						ShowContinueError( "...occurs in " + CurrentModuleObject + " = " + DXCoolingSystem( DXCoolSysNum ).Name );
 						ErrorsFound = true;
 					}
@@ -519,15 +604,15 @@ namespace HVACDXSystem {
 
 				} else if ( SameString( Alphas( 6 ), "Coil:Cooling:DX:TwoStageWithHumidityControlMode" ) ) {
 					DXCoolingSystem( DXCoolSysNum ).CoolingCoilType_Num = CoilDX_CoolingTwoStageWHumControl;
-					GetDXCoilIndex( DXCoolingSystem( DXCoolSysNum ).CoolingCoilName, DXCoolingSystem( DXCoolSysNum ).CoolingCoilIndex, ErrFound, CurrentModuleObject );
-					if ( ErrFound ) {
+					GetDXCoilIndex( DXCoolingSystem( DXCoolSysNum ).CoolingCoilName, DXCoolingSystem( DXCoolSysNum ).CoolingCoilIndex, GetDXCoolingSystemInputErrFound, CurrentModuleObject );
+					if ( GetDXCoolingSystemInputErrFound ) {
 						ShowContinueError( "...occurs in " + CurrentModuleObject + " = " + DXCoolingSystem( DXCoolSysNum ).Name );
 						ErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( 6 ), "Coil:Cooling:DX:SingleSpeed:ThermalStorage" ) ) {
 					DXCoolingSystem( DXCoolSysNum ).CoolingCoilType_Num = CoilDX_PackagedThermalStorageCooling;
-					GetTESCoilIndex( DXCoolingSystem( DXCoolSysNum ).CoolingCoilName, DXCoolingSystem( DXCoolSysNum ).CoolingCoilIndex, ErrFound, CurrentModuleObject );
-					if ( ErrFound ) {
+					GetTESCoilIndex( DXCoolingSystem( DXCoolSysNum ).CoolingCoilName, DXCoolingSystem( DXCoolSysNum ).CoolingCoilIndex, GetDXCoolingSystemInputErrFound, CurrentModuleObject );
+					if ( GetDXCoolingSystemInputErrFound ) {
 						ShowContinueError( "...occurs in " + CurrentModuleObject + " = " + DXCoolingSystem( DXCoolSysNum ).Name );
 						ErrorsFound = true;
 					}
@@ -717,8 +802,6 @@ namespace HVACDXSystem {
 		int OutNode; // outlet node number
 		int ControlNode; // control node number
 		int DXSysIndex;
-		static bool MyOneTimeFlag( true );
-		static bool MySetPointCheckFlag( true );
 		int OutdoorAirUnitNum; // "ONLY" for ZoneHVAC:OutdoorAirUnit
 		Real64 OAUCoilOutletTemp; // "ONLY" for zoneHVAC:OutdoorAirUnit
 		// FLOW:
@@ -1030,7 +1113,7 @@ namespace HVACDXSystem {
 							Par( 1 ) = double( DXCoolingSystem( DXSystemNum ).CoolingCoilIndex );
 							Par( 2 ) = DesOutTemp;
 							Par( 5 ) = double( FanOpMode );
-							SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, DOE2DXCoilResidual, 0.0, 1.0, Par );
+							SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, DOE2DXCoilResidual, 0.0, 1.0, Par, "ControlDXSystem" );
 							if ( SolFla == -1 ) {
 								if ( ! WarmupFlag ) {
 									if ( DXCoolingSystem( DXSystemNum ).DXCoilSensPLRIter < 1 ) {
@@ -1084,7 +1167,7 @@ namespace HVACDXSystem {
 							Par( 1 ) = double( DXCoolingSystem( DXSystemNum ).CoolingCoilIndex );
 							Par( 2 ) = DesOutHumRat;
 							Par( 5 ) = double( FanOpMode );
-							SolveRegulaFalsi( HumRatAcc, MaxIte, SolFla, PartLoadFrac, DOE2DXCoilHumRatResidual, 0.0, 1.0, Par );
+							SolveRegulaFalsi( HumRatAcc, MaxIte, SolFla, PartLoadFrac, DOE2DXCoilHumRatResidual, 0.0, 1.0, Par, "ControlDXSystem" );
 							if ( SolFla == -1 ) {
 								if ( ! WarmupFlag ) {
 									if ( DXCoolingSystem( DXSystemNum ).DXCoilLatPLRIter < 1 ) {
@@ -1176,7 +1259,7 @@ namespace HVACDXSystem {
 								Par( 4 ) = 0.0;
 							}
 							Par( 5 ) = double( FanOpMode );
-							SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, HXAssistedCoolCoilTempResidual, 0.0, 1.0, Par );
+							SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, HXAssistedCoolCoilTempResidual, 0.0, 1.0, Par, "ControlDXSystem" );
 							if ( SolFla == -1 ) {
 
 								//               RegulaFalsi may not find sensible PLR when the latent degradation model is used.
@@ -1203,7 +1286,7 @@ namespace HVACDXSystem {
 								TempMinPLR = max( 0.0, ( TempMinPLR - 0.01 ) );
 								TempMaxPLR = min( 1.0, ( TempMaxPLR + 0.01 ) );
 								//               tighter boundary of solution has been found, call RegulaFalsi a second time
-								SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, HXAssistedCoolCoilTempResidual, TempMinPLR, TempMaxPLR, Par );
+								SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, HXAssistedCoolCoilTempResidual, TempMinPLR, TempMaxPLR, Par, "ControlDXSystem" );
 								if ( SolFla == -1 ) {
 									if ( ! WarmupFlag ) {
 										if ( DXCoolingSystem( DXSystemNum ).HXAssistedSensPLRIter < 1 ) {
@@ -1291,7 +1374,7 @@ namespace HVACDXSystem {
 								Par( 4 ) = 0.0;
 							}
 							Par( 5 ) = double( FanOpMode );
-							SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, HXAssistedCoolCoilTempResidual, 0.0, 1.0, Par );
+							SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, HXAssistedCoolCoilTempResidual, 0.0, 1.0, Par, "ControlDXSystem" );
 							if ( SolFla == -1 ) {
 								if ( ! WarmupFlag ) {
 									if ( DXCoolingSystem( DXSystemNum ).HXAssistedLatPLRIter < 1 ) {
@@ -1347,7 +1430,7 @@ namespace HVACDXSystem {
 								Par( 4 ) = 0.0;
 							}
 							Par( 5 ) = double( FanOpMode );
-							SolveRegulaFalsi( HumRatAcc, MaxIte, SolFla, PartLoadFrac, HXAssistedCoolCoilHRResidual, 0.0, 1.0, Par );
+							SolveRegulaFalsi( HumRatAcc, MaxIte, SolFla, PartLoadFrac, HXAssistedCoolCoilHRResidual, 0.0, 1.0, Par, "ControlDXSystem" );
 							if ( SolFla == -1 ) {
 
 								//               RegulaFalsi may not find latent PLR when the latent degradation model is used.
@@ -1370,7 +1453,7 @@ namespace HVACDXSystem {
 									OutletHumRatDXCoil = HXAssistedCoilOutletHumRat( DXCoolingSystem( DXSystemNum ).CoolingCoilIndex );
 								}
 								//               tighter boundary of solution has been found, call RegulaFalsi a second time
-								SolveRegulaFalsi( HumRatAcc, MaxIte, SolFla, PartLoadFrac, HXAssistedCoolCoilHRResidual, TempMinPLR, TempMaxPLR, Par );
+								SolveRegulaFalsi( HumRatAcc, MaxIte, SolFla, PartLoadFrac, HXAssistedCoolCoilHRResidual, TempMinPLR, TempMaxPLR, Par, "ControlDXSystem" );
 								if ( SolFla == -1 ) {
 									if ( ! WarmupFlag ) {
 										if ( DXCoolingSystem( DXSystemNum ).HXAssistedCRLatPLRIter < 1 ) {
@@ -1428,7 +1511,7 @@ namespace HVACDXSystem {
 						if ( OutletTempHS < DesOutTemp ) {
 							Par( 1 ) = double( DXCoolingSystem( DXSystemNum ).CoolingCoilIndex );
 							Par( 2 ) = DesOutTemp;
-							SolveRegulaFalsi( Acc, MaxIte, SolFla, SpeedRatio, DXCoilVarSpeedResidual, 0.0, 1.0, Par );
+							SolveRegulaFalsi( Acc, MaxIte, SolFla, SpeedRatio, DXCoilVarSpeedResidual, 0.0, 1.0, Par, "ControlDXSystem" );
 							if ( SolFla == -1 ) {
 								if ( ! WarmupFlag ) {
 									if ( DXCoolingSystem( DXSystemNum ).MSpdSensPLRIter < 1 ) {
@@ -1449,7 +1532,7 @@ namespace HVACDXSystem {
 						SpeedRatio = 0.0;
 						Par( 1 ) = double( DXCoolingSystem( DXSystemNum ).CoolingCoilIndex );
 						Par( 2 ) = DesOutTemp;
-						SolveRegulaFalsi( Acc, MaxIte, SolFla, CycRatio, DXCoilCyclingResidual, 0.0, 1.0, Par );
+						SolveRegulaFalsi( Acc, MaxIte, SolFla, CycRatio, DXCoilCyclingResidual, 0.0, 1.0, Par, "ControlDXSystem" );
 						if ( SolFla == -1 ) {
 							if ( ! WarmupFlag ) {
 								if ( DXCoolingSystem( DXSystemNum ).MSpdCycSensPLRIter < 1 ) {
@@ -1494,7 +1577,7 @@ namespace HVACDXSystem {
 								if ( OutletHumRatHS < DesOutHumRat ) {
 									Par( 1 ) = double( DXCoolingSystem( DXSystemNum ).CoolingCoilIndex );
 									Par( 2 ) = DesOutHumRat;
-									SolveRegulaFalsi( HumRatAcc, MaxIte, SolFla, SpeedRatio, DXCoilVarSpeedHumRatResidual, 0.0, 1.0, Par );
+									SolveRegulaFalsi( HumRatAcc, MaxIte, SolFla, SpeedRatio, DXCoilVarSpeedHumRatResidual, 0.0, 1.0, Par, "ControlDXSystem" );
 									if ( SolFla == -1 ) {
 										if ( ! WarmupFlag ) {
 											if ( DXCoolingSystem( DXSystemNum ).MSpdLatPLRIter < 1 ) {
@@ -1515,7 +1598,7 @@ namespace HVACDXSystem {
 								SpeedRatio = 0.0;
 								Par( 1 ) = double( DXCoolingSystem( DXSystemNum ).CoolingCoilIndex );
 								Par( 2 ) = DesOutHumRat;
-								SolveRegulaFalsi( HumRatAcc, MaxIte, SolFla, CycRatio, DXCoilCyclingHumRatResidual, 0.0, 1.0, Par );
+								SolveRegulaFalsi( HumRatAcc, MaxIte, SolFla, CycRatio, DXCoilCyclingHumRatResidual, 0.0, 1.0, Par, "ControlDXSystem" );
 								if ( SolFla == -1 ) {
 									if ( ! WarmupFlag ) {
 										if ( DXCoolingSystem( DXSystemNum ).MSpdCycLatPLRIter < 1 ) {
@@ -1571,7 +1654,7 @@ namespace HVACDXSystem {
 							// Dehumidification mode = 0 for normal mode, 1+ for enhanced mode
 							Par( 3 ) = double( DehumidMode );
 							Par( 4 ) = double( FanOpMode );
-							SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, MultiModeDXCoilResidual, 0.0, 1.0, Par );
+							SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, MultiModeDXCoilResidual, 0.0, 1.0, Par, "ControlDXSystem" );
 							if ( SolFla == -1 ) {
 								if ( ! WarmupFlag ) {
 									if ( DXCoolingSystem( DXSystemNum ).MModeSensPLRIter < 1 ) {
@@ -1630,7 +1713,7 @@ namespace HVACDXSystem {
 								// Dehumidification mode = 0 for normal mode, 1+ for enhanced mode
 								Par( 3 ) = double( DehumidMode );
 								Par( 4 ) = double( FanOpMode );
-								SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, MultiModeDXCoilHumRatResidual, 0.0, 1.0, Par );
+								SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, MultiModeDXCoilHumRatResidual, 0.0, 1.0, Par, "ControlDXSystem" );
 								if ( SolFla == -1 ) {
 									if ( ! WarmupFlag ) {
 										if ( DXCoolingSystem( DXSystemNum ).MModeLatPLRIter < 1 ) {
@@ -1661,7 +1744,7 @@ namespace HVACDXSystem {
 								// Dehumidification mode = 0 for normal mode, 1+ for enhanced mode
 								Par( 3 ) = double( DehumidMode );
 								Par( 4 ) = double( FanOpMode );
-								SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, MultiModeDXCoilResidual, 0.0, 1.0, Par );
+								SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, MultiModeDXCoilResidual, 0.0, 1.0, Par, "ControlDXSystem" );
 								if ( SolFla == -1 ) {
 									if ( ! WarmupFlag ) {
 										if ( DXCoolingSystem( DXSystemNum ).MModeLatPLRIter < 1 ) {
@@ -1712,7 +1795,7 @@ namespace HVACDXSystem {
 							// Dehumidification mode = 0 for normal mode, 1+ for enhanced mode
 							Par( 3 ) = double( DehumidMode );
 							Par( 4 ) = double( FanOpMode );
-							SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, MultiModeDXCoilHumRatResidual, 0.0, 1.0, Par );
+							SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, MultiModeDXCoilHumRatResidual, 0.0, 1.0, Par, "ControlDXSystem" );
 							if ( SolFla == -1 ) {
 								if ( ! WarmupFlag ) {
 									if ( DXCoolingSystem( DXSystemNum ).MModeLatPLRIter2 < 1 ) {
@@ -1822,7 +1905,7 @@ namespace HVACDXSystem {
 								Par( 2 ) = DesOutTemp;
 								Par( 5 ) = double( FanOpMode );
 								Par( 3 ) = double( SpeedNum );
-								SolveRegulaFalsi( Acc, MaxIte, SolFla, SpeedRatio, VSCoilSpeedResidual, 1.0e-10, 1.0, Par );
+								SolveRegulaFalsi( Acc, MaxIte, SolFla, SpeedRatio, VSCoilSpeedResidual, 1.0e-10, 1.0, Par, "ControlDXSystem" );
 
 								if ( SolFla == -1 ) {
 									if ( ! WarmupFlag ) {
@@ -1851,7 +1934,7 @@ namespace HVACDXSystem {
 								Par( 1 ) = double( VSCoilIndex );
 								Par( 2 ) = DesOutTemp;
 								Par( 5 ) = double( FanOpMode );
-								SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, VSCoilCyclingResidual, 1.0e-10, 1.0, Par );
+								SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadFrac, VSCoilCyclingResidual, 1.0e-10, 1.0, Par, "ControlDXSystem" );
 								if ( SolFla == -1 ) {
 									if ( ! WarmupFlag ) {
 										if ( DXCoolingSystem( DXSystemNum ).DXCoilSensPLRIter < 1 ) {
@@ -1929,7 +2012,7 @@ namespace HVACDXSystem {
 								Par( 2 ) = DesOutHumRat;
 								Par( 5 ) = double( FanOpMode );
 								Par( 3 ) = double( SpeedNum );
-								SolveRegulaFalsi( HumRatAcc, MaxIte, SolFla, SpeedRatio, VSCoilSpeedHumResidual, 1.0e-10, 1.0, Par );
+								SolveRegulaFalsi( HumRatAcc, MaxIte, SolFla, SpeedRatio, VSCoilSpeedHumResidual, 1.0e-10, 1.0, Par, "ControlDXSystem" );
 
 								if ( SolFla == -1 ) {
 									if ( ! WarmupFlag ) {
@@ -1958,7 +2041,7 @@ namespace HVACDXSystem {
 								Par( 1 ) = double( VSCoilIndex );
 								Par( 2 ) = DesOutHumRat;
 								Par( 5 ) = double( FanOpMode );
-								SolveRegulaFalsi( HumRatAcc, MaxIte, SolFla, PartLoadFrac, VSCoilCyclingHumResidual, 1.0e-10, 1.0, Par );
+								SolveRegulaFalsi( HumRatAcc, MaxIte, SolFla, PartLoadFrac, VSCoilCyclingHumResidual, 1.0e-10, 1.0, Par, "ControlDXSystem" );
 								if ( SolFla == -1 ) {
 									if ( ! WarmupFlag ) {
 										if ( DXCoolingSystem( DXSystemNum ).DXCoilLatPLRIter < 1 ) {
@@ -2983,19 +3066,11 @@ namespace HVACDXSystem {
 		int CoilIndex; // index of this coil
 		Real64 OutletAirTemp; // outlet air temperature [C]
 		int FanOpMode; // Supply air fan operating mode
-		static int SpeedNum( 1 ); // speed number of variable speed DX cooling coil
-		static Real64 QZnReq( 0.001 ); // Zone load (W), input to variable-speed DX coil
-		static Real64 QLatReq( 0.0 ); // Zone latent load, input to variable-speed DX coil
-		static Real64 MaxONOFFCyclesperHour( 4.0 ); // Maximum cycling rate of heat pump [cycles/hr]
-		static Real64 HPTimeConstant( 0.0 ); // Heat pump time constant [s]
-		static Real64 FanDelayTime( 0.0 ); // Fan delay time, time delay for the HP's fan to
-		static Real64 OnOffAirFlowRatio( 1.0 ); // ratio of compressor on flow to average flow over time step
-		static Real64 SpeedRatio( 0.0 ); // SpeedRatio varies between 1.0 (higher speed) and 0.0 (lower speed)
 
 		CoilIndex = int( Par( 1 ) );
 		FanOpMode = int( Par( 5 ) );
 
-		SimVariableSpeedCoils( "", CoilIndex, FanOpMode, MaxONOFFCyclesperHour, HPTimeConstant, FanDelayTime, On, PartLoadRatio, SpeedNum, SpeedRatio, QZnReq, QLatReq, OnOffAirFlowRatio );
+		SimVariableSpeedCoils( "", CoilIndex, FanOpMode, VSCoilCyclingResidualMaxONOFFCyclesperHour, VSCoilCyclingResidualHPTimeConstant, VSCoilCyclingResidualFanDelayTime, On, PartLoadRatio, SpeedNum, VSCoilCyclingResidualSpeedRatio, VSCoilCyclingResidualQZnReq, VSCoilCyclingResidualQLatReq, VSCoilCyclingResidualOnOffAirFlowRatio );
 
 		OutletAirTemp = VarSpeedCoil( CoilIndex ).OutletAirDBTemp;
 		Residuum = Par( 2 ) - OutletAirTemp;
@@ -3052,20 +3127,12 @@ namespace HVACDXSystem {
 		int CoilIndex; // index of this coil
 		Real64 OutletAirTemp; // outlet air temperature [C]
 		int FanOpMode; // Supply air fan operating mode
-		static int SpeedNum( 1 ); // speed number of variable speed DX cooling coil
-		static Real64 QZnReq( 0.001 ); // Zone load (W), input to variable-speed DX coil
-		static Real64 QLatReq( 0.0 ); // Zone latent load, input to variable-speed DX coil
-		static Real64 MaxONOFFCyclesperHour( 4.0 ); // Maximum cycling rate of heat pump [cycles/hr]
-		static Real64 HPTimeConstant( 0.0 ); // Heat pump time constant [s]
-		static Real64 FanDelayTime( 0.0 ); // Fan delay time, time delay for the HP's fan to
-		static Real64 OnOffAirFlowRatio( 1.0 ); // ratio of compressor on flow to average flow over time step
-		static Real64 PartLoadRatio( 1.0 ); // SpeedRatio varies between 1.0 (higher speed) and 0.0 (lower speed)
 
 		CoilIndex = int( Par( 1 ) );
 		FanOpMode = int( Par( 5 ) );
-		SpeedNum = int( Par( 3 ) );
+		VSCoilSpeedResidualSpeedNum = int( Par( 3 ) );
 
-		SimVariableSpeedCoils( "", CoilIndex, FanOpMode, MaxONOFFCyclesperHour, HPTimeConstant, FanDelayTime, On, PartLoadRatio, SpeedNum, SpeedRatio, QZnReq, QLatReq, OnOffAirFlowRatio );
+		SimVariableSpeedCoils( "", CoilIndex, FanOpMode, VSCoilSpeedResidualMaxONOFFCyclesperHour, VSCoilSpeedResidualHPTimeConstant, VSCoilSpeedResidualFanDelayTime, On, VSCoilSpeedResidualPartLoadRatio, VSCoilSpeedResidualSpeedNum, SpeedRatio, VSCoilSpeedResidualQZnReq, VSCoilSpeedResidualQLatReq, VSCoilSpeedResidualOnOffAirFlowRatio );
 
 		OutletAirTemp = VarSpeedCoil( CoilIndex ).OutletAirDBTemp;
 		Residuum = Par( 2 ) - OutletAirTemp;
@@ -3120,19 +3187,11 @@ namespace HVACDXSystem {
 		int CoilIndex; // index of this coil
 		Real64 OutletAirHumRat; // outlet air humidity ratio [kg/kg]
 		int FanOpMode; // Supply air fan operating mode
-		static int SpeedNum( 1 ); // speed number of variable speed DX cooling coil
-		static Real64 QZnReq( 0.001 ); // Zone load (W), input to variable-speed DX coil
-		static Real64 QLatReq( 0.0 ); // Zone latent load, input to variable-speed DX coil
-		static Real64 MaxONOFFCyclesperHour( 4.0 ); // Maximum cycling rate of heat pump [cycles/hr]
-		static Real64 HPTimeConstant( 0.0 ); // Heat pump time constant [s]
-		static Real64 FanDelayTime( 0.0 ); // Fan delay time, time delay for the HP's fan to
-		static Real64 OnOffAirFlowRatio( 1.0 ); // ratio of compressor on flow to average flow over time step
-		static Real64 SpeedRatio( 0.0 ); // SpeedRatio varies between 1.0 (higher speed) and 0.0 (lower speed)
 
 		CoilIndex = int( Par( 1 ) );
 		FanOpMode = int( Par( 5 ) );
 
-		SimVariableSpeedCoils( "", CoilIndex, FanOpMode, MaxONOFFCyclesperHour, HPTimeConstant, FanDelayTime, On, PartLoadRatio, SpeedNum, SpeedRatio, QZnReq, QLatReq, OnOffAirFlowRatio );
+		SimVariableSpeedCoils( "", CoilIndex, FanOpMode, VSCoilCyclingHumResidualMaxONOFFCyclesperHour, VSCoilCyclingHumResidualHPTimeConstant, VSCoilCyclingHumResidualFanDelayTime, On, PartLoadRatio, VSCoilCyclingHumResidualSpeedNum, VSCoilCyclingHumResidualSpeedRatio, VSCoilCyclingHumResidualQZnReq, VSCoilCyclingHumResidualQLatReq, VSCoilCyclingHumResidualOnOffAirFlowRatio );
 
 		OutletAirHumRat = VarSpeedCoil( CoilIndex ).OutletAirHumRat;
 		Residuum = Par( 2 ) - OutletAirHumRat;
@@ -3190,20 +3249,12 @@ namespace HVACDXSystem {
 		int CoilIndex; // index of this coil
 		Real64 OutletAirHumRat; // outlet air humidity ratio [kg/kg]
 		int FanOpMode; // Supply air fan operating mode
-		static int SpeedNum( 1 ); // speed number of variable speed DX cooling coil
-		static Real64 QZnReq( 0.001 ); // Zone load (W), input to variable-speed DX coil
-		static Real64 QLatReq( 0.0 ); // Zone latent load, input to variable-speed DX coil
-		static Real64 MaxONOFFCyclesperHour( 4.0 ); // Maximum cycling rate of heat pump [cycles/hr]
-		static Real64 HPTimeConstant( 0.0 ); // Heat pump time constant [s]
-		static Real64 FanDelayTime( 0.0 ); // Fan delay time, time delay for the HP's fan to
-		static Real64 OnOffAirFlowRatio( 1.0 ); // ratio of compressor on flow to average flow over time step
-		static Real64 PartLoadRatio( 1.0 ); // SpeedRatio varies between 1.0 (higher speed) and 0.0 (lower speed)
 
 		CoilIndex = int( Par( 1 ) );
 		FanOpMode = int( Par( 5 ) );
-		SpeedNum = int( Par( 3 ) );
+		VSCoilSpeedHumResidualSpeedNum = int( Par( 3 ) );
 
-		SimVariableSpeedCoils( "", CoilIndex, FanOpMode, MaxONOFFCyclesperHour, HPTimeConstant, FanDelayTime, On, PartLoadRatio, SpeedNum, SpeedRatio, QZnReq, QLatReq, OnOffAirFlowRatio );
+		SimVariableSpeedCoils( "", CoilIndex, FanOpMode, VSCoilSpeedHumResidualMaxONOFFCyclesperHour, VSCoilSpeedHumResidualHPTimeConstant, VSCoilSpeedHumResidualFanDelayTime, On, VSCoilSpeedHumResidualPartLoadRatio, VSCoilSpeedHumResidualSpeedNum, SpeedRatio, VSCoilSpeedHumResidualQZnReq, VSCoilSpeedHumResidualQLatReq, VSCoilSpeedHumResidualOnOffAirFlowRatio );
 
 		OutletAirHumRat = VarSpeedCoil( CoilIndex ).OutletAirHumRat;
 		Residuum = Par( 2 ) - OutletAirHumRat;
@@ -125,8 +125,34 @@ namespace HVACDuct {
 	// Object Data
 	Array1D< DuctData > Duct;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // First time, input is "gotten"
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool MyOneTimeFlag( true );
+		Array1D_bool MyEnvrnFlag;
+	}
+
 	// Functions
 
+	// Clears the global data in HVACDuct.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumDucts = 0;
+		CheckEquipName.deallocate();
+		Duct.deallocate();
+		GetInputFlag = true;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		MyEnvrnFlag.deallocate();
+	}
+
 	void
 	SimDuct(
 		std::string const & CompName, // name of the duct component
@@ -167,7 +193,6 @@ namespace HVACDuct {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInputFlag( true ); // First time, input is "gotten"
 		int DuctNum; // index of duct being simulated
 
 		if ( GetInputFlag ) {
@@ -251,7 +276,6 @@ namespace HVACDuct {
 		int NumAlphas; // Number of Alphas for each GetObjectItem call
 		int NumNumbers; // Number of Numbers for each GetObjectItem call
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 
@@ -318,8 +342,6 @@ namespace HVACDuct {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyEnvrnFlag;
 
 		// do one time initializations
 		if ( MyOneTimeFlag ) {
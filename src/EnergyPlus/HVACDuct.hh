@@ -108,6 +108,11 @@ namespace HVACDuct {
 
 	// Functions
 
+	// Clears the global data in HVACDuct.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimDuct(
 		std::string const & CompName, // name of the duct component
@@ -99,6 +99,34 @@ namespace FourPipeBeam {
 	Array1D< std::shared_ptr< HVACFourPipeBeam > > FourPipeBeams; // dimension to number of machines
 
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int NumAlphas( 0 ); // Number of Alphas for each GetObjectItem call
+		int NumNumbers( 0 ); // Number of Numbers for each GetObjectItem call
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		int pltSizCoolNum( 0 ); // index of plant sizing object for the cooling loop
+		int pltSizHeatNum( 0 );
+	}
+
+	// Functions
+
+	// Clears the global data in FourPipeBeam.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		FourPipeBeams.deallocate();
+		NumAlphas = 0;
+		NumNumbers = 0;
+		ErrorsFound = false;
+		pltSizCoolNum = 0;
+		pltSizHeatNum = 0;
+	}
+
 //	HVACFourPipeBeam::HVACFourPipeBeam(){}
 	///// Note use of shared_ptr here is not a good pattern, not to be replicated without further discussion.
 	std::shared_ptr< AirTerminalUnit >
@@ -134,13 +162,10 @@ namespace FourPipeBeam {
 		int beamIndex; // loop index
 
 
-		static int NumAlphas( 0 ); // Number of Alphas for each GetObjectItem call
-		static int NumNumbers( 0 ); // Number of Numbers for each GetObjectItem call
 
 		//  certain object in the input file
 		int IOStatus; // Used in GetObjectItem
 		bool errFlag = false;
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		bool found = false;
 		int ctrlZone; // controlled zome do loop index
 		int supAirIn; // controlled zone supply air inlet index
@@ -595,8 +620,6 @@ namespace FourPipeBeam {
 		using General::SolveRegulaFalsi;
 
 		static std::string const routineName( "HVACFourPipeBeam::set_size " );
-		static int pltSizCoolNum( 0 ); // index of plant sizing object for the cooling loop
-		static int pltSizHeatNum( 0 );
 
 		bool ErrorsFound = false;
 		Real64 rho; // local fluid density
@@ -719,7 +742,7 @@ namespace FourPipeBeam {
 				this->airAvailable = true;
 				this->coolingAvailable = true;
 				this->heatingAvailable = false;
-				SolveRegulaFalsi( ErrTolerance, 50, SolFlag, mDotAirSolutionCooling, std::bind( &HVACFourPipeBeam::residualSizing, this, _1 ), minFlow, maxFlowCool );
+				SolveRegulaFalsi( ErrTolerance, 50, SolFlag, mDotAirSolutionCooling, std::bind( &HVACFourPipeBeam::residualSizing, this, _1 ), minFlow, maxFlowCool, "HVACFourPipeBeam::set_size" );
 				if ( SolFlag == -1 ) {
 					ShowWarningError( "Cooling load sizing search failed in four pipe beam unit called " + this->name );
 					ShowContinueError( "  Iteration limit exceeded in calculating size for design cooling load" );
@@ -760,7 +783,7 @@ namespace FourPipeBeam {
 				this->airAvailable = true;
 				this->heatingAvailable = true;
 				this->coolingAvailable = false;
-				SolveRegulaFalsi( ErrTolerance, 50, SolFlag, mDotAirSolutionHeating, std::bind( &HVACFourPipeBeam::residualSizing, this, _1 ), 0.0, maxFlowHeat );
+				SolveRegulaFalsi( ErrTolerance, 50, SolFlag, mDotAirSolutionHeating, std::bind( &HVACFourPipeBeam::residualSizing, this, _1 ), 0.0, maxFlowHeat, "HVACFourPipeBeam::set_size" );
 				if ( SolFlag == -1 ) {
 					ShowWarningError( "Heating load sizing search failed in four pipe beam unit called " + this->name );
 					ShowContinueError( "  Iteration limit exceeded in calculating size for design heating load" );
@@ -1009,7 +1032,7 @@ namespace FourPipeBeam {
 				// can overcool, modulate chilled water flow rate to meet load
 				this->qDotBeamCoolingMax = this->qDotBeamCooling;
 				ErrTolerance = 0.01;
-				SolveRegulaFalsi( ErrTolerance, 50, SolFlag, this->mDotCW, std::bind( &HVACFourPipeBeam::residualCooling, this, _1 ), 0.0, this->mDotDesignCW );
+				SolveRegulaFalsi( ErrTolerance, 50, SolFlag, this->mDotCW, std::bind( &HVACFourPipeBeam::residualCooling, this, _1 ), 0.0, this->mDotDesignCW, "HVACFourPipeBeam::control" );
 				if ( SolFlag == -1 ) {
 					//ShowWarningError( "Cold water control failed in four pipe beam unit called " + this->name );
 					//ShowContinueError( "  Iteration limit exceeded in calculating cold water mass flow rate" );
@@ -1042,7 +1065,7 @@ namespace FourPipeBeam {
 				this->qDotBeamHeatingMax = this->qDotBeamHeating;
 				// can overheat, modulate hot water flow to meet load
 				ErrTolerance = 0.01;
-				SolveRegulaFalsi( ErrTolerance, 50, SolFlag, this->mDotHW, std::bind( &HVACFourPipeBeam::residualHeating, this , _1), 0.0, this->mDotDesignHW);
+				SolveRegulaFalsi( ErrTolerance, 50, SolFlag, this->mDotHW, std::bind( &HVACFourPipeBeam::residualHeating, this , _1), 0.0, this->mDotDesignHW, "HVACFourPipeBeam::control" );
 				if ( SolFlag == -1 ) {
 					//ShowWarningError( "Hot water control failed in four pipe beam unit called " + this->name );
 					//ShowContinueError( "  Iteration limit exceeded in calculating hot water mass flow rate" );
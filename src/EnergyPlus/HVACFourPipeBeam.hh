@@ -304,6 +304,13 @@ private: // data
 extern Array1D< std::shared_ptr< HVACFourPipeBeam > > FourPipeBeams; // dimension to number of machines
 
 
+	// Functions
+
+	// Clears the global data in FourPipeBeam.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 } // FourPipeBeam
 
 } // EnergyPlus
@@ -158,8 +158,43 @@ namespace HVACHXAssistedCoolingCoil {
 	// MODULE SUBROUTINES:
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetHXAssistedCoolingCoilInputErrorsFound( false ); // set TRUE if errors detected in input
+		int MaxNums( 0 ); // Maximum number of numeric input fields
+		int MaxAlphas( 0 ); // Maximum number of alpha input fields
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		Real64 CoilOutputTempLast; // Exiting cooling coil temperature from last iteration
+		int ErrCount( 0 );
+		int GetCoilMaxWaterFlowRateErrCount( 0 );
+	}
+
 	// Functions
 
+	// Clears the global data in HVACHXAssistedCoolingCoil.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		TotalNumHXAssistedCoils = 0;
+		HXAssistedCoilOutletTemp.deallocate();
+		HXAssistedCoilOutletHumRat.deallocate();
+		GetCoilsInputFlag = true;
+		CheckEquipName.deallocate();
+		HXAssistedCoil.deallocate();
+		GetHXAssistedCoolingCoilInputErrorsFound = false;
+		MaxNums = 0;
+		MaxAlphas = 0;
+		TotalArgs = 0;
+		CoilOutputTempLast = 0.0;
+		ErrCount = 0;
+		GetCoilMaxWaterFlowRateErrCount = 0;
+	}
+
 	void
 	SimHXAssistedCoolingCoil(
 		std::string const & HXAssistedCoilName, // Name of HXAssistedCoolingCoil
@@ -337,7 +372,6 @@ namespace HVACHXAssistedCoolingCoil {
 		int NumAlphas; // Number of alpha inputs
 		int NumNums; // Number of number inputs
 		int IOStat; // Return status from GetObjectItem call
-		static bool ErrorsFound( false ); // set TRUE if errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int NumHXAssistedDXCoils; // Number of HXAssistedCoolingCoil objects using a DX coil
@@ -358,9 +392,6 @@ namespace HVACHXAssistedCoolingCoil {
 		Array1D< Real64 > NumArray; // Numeric input items for object
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int MaxNums( 0 ); // Maximum number of numeric input fields
-		static int MaxAlphas( 0 ); // Maximum number of alpha input fields
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 
 		NumHXAssistedDXCoils = GetNumObjectsFound( "CoilSystem:Cooling:DX:HeatExchangerAssisted" );
 		NumHXAssistedWaterCoils = GetNumObjectsFound( "CoilSystem:Cooling:Water:HeatExchangerAssisted" );
@@ -395,7 +426,7 @@ namespace HVACHXAssistedCoolingCoil {
 			IsBlank = false;
 			VerifyName( AlphArray( 1 ), HXAssistedCoil, HXAssistedCoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetHXAssistedCoolingCoilInputErrorsFound = true;
 				if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 			}
 			HXAssistedCoil( HXAssistedCoilNum ).Name = AlphArray( 1 );
@@ -412,7 +443,7 @@ namespace HVACHXAssistedCoolingCoil {
 			} else {
 				ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + HXAssistedCoil( HXAssistedCoilNum ).Name + "\"" );
 				ShowContinueError( "Invalid " + cAlphaFields( 2 ) + "=\"" + HXAssistedCoil( HXAssistedCoilNum ).HeatExchangerType + "\"" );
-				ErrorsFound = true;
+				GetHXAssistedCoolingCoilInputErrorsFound = true;
 			}
 
 			HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilType = AlphArray( 4 );
@@ -426,12 +457,12 @@ namespace HVACHXAssistedCoolingCoil {
 				GetDXCoilIndex( HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilName, HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilIndex, CoolingCoilErrFlag, HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilType );
 				if ( CoolingCoilErrFlag ) {
 					ShowContinueError( "...occurs in " + CurrentModuleObject + "=\"" + HXAssistedCoil( HXAssistedCoilNum ).Name + "\"" );
-					ErrorsFound = true;
+					GetHXAssistedCoolingCoilInputErrorsFound = true;
 				}
 			} else {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + HXAssistedCoil( HXAssistedCoilNum ).Name + "\"" );
 				ShowContinueError( "Invalid " + cAlphaFields( 4 ) + "=\"" + HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilType + "\"" );
-				ErrorsFound = true;
+				GetHXAssistedCoolingCoilInputErrorsFound = true;
 			}
 
 			HXErrFlag = false;
@@ -472,7 +503,7 @@ namespace HVACHXAssistedCoolingCoil {
 					ShowContinueError( "must match the cooling coil inlet node name in = " + HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilType + "=\"" + HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilName + "\"" );
 					ShowContinueError( "Heat exchanger supply air outlet node name=\"" + NodeID( SupplyAirOutletNode ) + "\"" );
 					ShowContinueError( "Cooling coil air inlet node name=\"" + NodeID( CoolingCoilInletNodeNum ) + "\"" );
-					ErrorsFound = true;
+					GetHXAssistedCoolingCoilInputErrorsFound = true;
 				}
 				CoolingCoilErrFlag = false;
 				CoolingCoilOutletNodeNum = GetDXCoilOutletNode( HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilType, HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilName, CoolingCoilErrFlag );
@@ -486,17 +517,17 @@ namespace HVACHXAssistedCoolingCoil {
 					ShowContinueError( "must match the cooling coil air outlet node name in = " + HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilType + "=\"" + HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilName + "\"." );
 					ShowContinueError( "Heat exchanger secondary air inlet node name =\"" + NodeID( SecondaryAirInletNode ) + "\"." );
 					ShowContinueError( "Cooling coil air outlet node name =\"" + NodeID( CoolingCoilOutletNodeNum ) + "\"." );
-					ErrorsFound = true;
+					GetHXAssistedCoolingCoilInputErrorsFound = true;
 				}
 
 			}
 
 			TestCompSet( HXAssistedCoil( HXAssistedCoilNum ).HXAssistedCoilType, HXAssistedCoil( HXAssistedCoilNum ).Name, NodeID( SupplyAirInletNode ), NodeID( SecondaryAirOutletNode ), "Air Nodes" );
 
-			HXAssistedCoil( HXAssistedCoilNum ).HXAssistedCoilInletNodeNum = GetOnlySingleNode( NodeID( SupplyAirInletNode ), ErrorsFound, CurrentModuleObject, HXAssistedCoil( HXAssistedCoilNum ).Name, NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsParent );
-			CoolingCoilInletNodeNum = GetOnlySingleNode( NodeID( SupplyAirOutletNode ), ErrorsFound, CurrentModuleObject, HXAssistedCoil( HXAssistedCoilNum ).Name, NodeType_Air, NodeConnectionType_Internal, 1, ObjectIsParent );
-			HXAssistedCoil( HXAssistedCoilNum ).HXExhaustAirInletNodeNum = GetOnlySingleNode( NodeID( SecondaryAirInletNode ), ErrorsFound, CurrentModuleObject, HXAssistedCoil( HXAssistedCoilNum ).Name, NodeType_Air, NodeConnectionType_Internal, 1, ObjectIsParent );
-			HXAssistedCoil( HXAssistedCoilNum ).HXAssistedCoilOutletNodeNum = GetOnlySingleNode( NodeID( SecondaryAirOutletNode ), ErrorsFound, CurrentModuleObject, HXAssistedCoil( HXAssistedCoilNum ).Name, NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsParent );
+			HXAssistedCoil( HXAssistedCoilNum ).HXAssistedCoilInletNodeNum = GetOnlySingleNode( NodeID( SupplyAirInletNode ), GetHXAssistedCoolingCoilInputErrorsFound, CurrentModuleObject, HXAssistedCoil( HXAssistedCoilNum ).Name, NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsParent );
+			CoolingCoilInletNodeNum = GetOnlySingleNode( NodeID( SupplyAirOutletNode ), GetHXAssistedCoolingCoilInputErrorsFound, CurrentModuleObject, HXAssistedCoil( HXAssistedCoilNum ).Name, NodeType_Air, NodeConnectionType_Internal, 1, ObjectIsParent );
+			HXAssistedCoil( HXAssistedCoilNum ).HXExhaustAirInletNodeNum = GetOnlySingleNode( NodeID( SecondaryAirInletNode ), GetHXAssistedCoolingCoilInputErrorsFound, CurrentModuleObject, HXAssistedCoil( HXAssistedCoilNum ).Name, NodeType_Air, NodeConnectionType_Internal, 1, ObjectIsParent );
+			HXAssistedCoil( HXAssistedCoilNum ).HXAssistedCoilOutletNodeNum = GetOnlySingleNode( NodeID( SecondaryAirOutletNode ), GetHXAssistedCoolingCoilInputErrorsFound, CurrentModuleObject, HXAssistedCoil( HXAssistedCoilNum ).Name, NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsParent );
 
 			// Add cooling coil to component sets array
 			SetUpCompSets( HXAssistedCoil( HXAssistedCoilNum ).HXAssistedCoilType, HXAssistedCoil( HXAssistedCoilNum ).Name, HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilType, HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilName, NodeID( SupplyAirOutletNode ), NodeID( SecondaryAirInletNode ), "Air Nodes" );
@@ -516,7 +547,7 @@ namespace HVACHXAssistedCoolingCoil {
 			IsBlank = false;
 			VerifyName( AlphArray( 1 ), HXAssistedCoil, HXAssistedCoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetHXAssistedCoolingCoilInputErrorsFound = true;
 				if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 			}
 			HXAssistedCoil( HXAssistedCoilNum ).Name = AlphArray( 1 );
@@ -534,7 +565,7 @@ namespace HVACHXAssistedCoolingCoil {
 			} else {
 				ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + HXAssistedCoil( HXAssistedCoilNum ).Name + "\"" );
 				ShowContinueError( "Invalid " + cAlphaFields( 2 ) + "=\"" + HXAssistedCoil( HXAssistedCoilNum ).HeatExchangerType + "\"" );
-				ErrorsFound = true;
+				GetHXAssistedCoolingCoilInputErrorsFound = true;
 			}
 
 			HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilType = AlphArray( 4 );
@@ -585,7 +616,7 @@ namespace HVACHXAssistedCoolingCoil {
 					ShowContinueError( "must match the cooling coil inlet node name in = " + HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilType + "=\"" + HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilName + "\"" );
 					ShowContinueError( "Heat exchanger supply air outlet node name =\"" + NodeID( SupplyAirOutletNode ) + "\"" );
 					ShowContinueError( "Cooling coil air inlet node name = \"" + NodeID( CoolingCoilInletNodeNum ) + "\"" );
-					ErrorsFound = true;
+					GetHXAssistedCoolingCoilInputErrorsFound = true;
 				}
 				CoolingCoilErrFlag = false;
 				CoolingCoilOutletNodeNum = GetWaterCoilOutletNode( HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilType, HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilName, CoolingCoilErrFlag );
@@ -597,21 +628,21 @@ namespace HVACHXAssistedCoolingCoil {
 					ShowContinueError( "must match the cooling coil air outlet node name in = " + HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilType + "=\"" + HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilName + "\"." );
 					ShowContinueError( "Heat exchanger secondary air inlet node name = \"" + NodeID( SecondaryAirInletNode ) + "\"." );
 					ShowContinueError( "Cooling coil air outlet node name = \"" + NodeID( CoolingCoilOutletNodeNum ) + "\"." );
-					ErrorsFound = true;
+					GetHXAssistedCoolingCoilInputErrorsFound = true;
 				}
 
 			} else {
 				ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + HXAssistedCoil( HXAssistedCoilNum ).Name + "\"" );
 				ShowContinueError( "Invalid " + cAlphaFields( 4 ) + "=\"" + HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilType + "\"" );
-				ErrorsFound = true;
+				GetHXAssistedCoolingCoilInputErrorsFound = true;
 			}
 
 			TestCompSet( HXAssistedCoil( HXAssistedCoilNum ).HXAssistedCoilType, HXAssistedCoil( HXAssistedCoilNum ).Name, NodeID( SupplyAirInletNode ), NodeID( SecondaryAirOutletNode ), "Air Nodes" );
 
-			HXAssistedCoil( HXAssistedCoilNum ).HXAssistedCoilInletNodeNum = GetOnlySingleNode( NodeID( SupplyAirInletNode ), ErrorsFound, CurrentModuleObject, HXAssistedCoil( HXAssistedCoilNum ).Name, NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsParent );
-			CoolingCoilInletNodeNum = GetOnlySingleNode( NodeID( SupplyAirOutletNode ), ErrorsFound, CurrentModuleObject, HXAssistedCoil( HXAssistedCoilNum ).Name, NodeType_Air, NodeConnectionType_Internal, 1, ObjectIsParent );
-			HXAssistedCoil( HXAssistedCoilNum ).HXExhaustAirInletNodeNum = GetOnlySingleNode( NodeID( SecondaryAirInletNode ), ErrorsFound, CurrentModuleObject, HXAssistedCoil( HXAssistedCoilNum ).Name, NodeType_Air, NodeConnectionType_Internal, 1, ObjectIsParent );
-			HXAssistedCoil( HXAssistedCoilNum ).HXAssistedCoilOutletNodeNum = GetOnlySingleNode( NodeID( SecondaryAirOutletNode ), ErrorsFound, CurrentModuleObject, HXAssistedCoil( HXAssistedCoilNum ).Name, NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsParent );
+			HXAssistedCoil( HXAssistedCoilNum ).HXAssistedCoilInletNodeNum = GetOnlySingleNode( NodeID( SupplyAirInletNode ), GetHXAssistedCoolingCoilInputErrorsFound, CurrentModuleObject, HXAssistedCoil( HXAssistedCoilNum ).Name, NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsParent );
+			CoolingCoilInletNodeNum = GetOnlySingleNode( NodeID( SupplyAirOutletNode ), GetHXAssistedCoolingCoilInputErrorsFound, CurrentModuleObject, HXAssistedCoil( HXAssistedCoilNum ).Name, NodeType_Air, NodeConnectionType_Internal, 1, ObjectIsParent );
+			HXAssistedCoil( HXAssistedCoilNum ).HXExhaustAirInletNodeNum = GetOnlySingleNode( NodeID( SecondaryAirInletNode ), GetHXAssistedCoolingCoilInputErrorsFound, CurrentModuleObject, HXAssistedCoil( HXAssistedCoilNum ).Name, NodeType_Air, NodeConnectionType_Internal, 1, ObjectIsParent );
+			HXAssistedCoil( HXAssistedCoilNum ).HXAssistedCoilOutletNodeNum = GetOnlySingleNode( NodeID( SecondaryAirOutletNode ), GetHXAssistedCoolingCoilInputErrorsFound, CurrentModuleObject, HXAssistedCoil( HXAssistedCoilNum ).Name, NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsParent );
 
 			// Add cooling coil to component sets array
 			SetUpCompSets( HXAssistedCoil( HXAssistedCoilNum ).HXAssistedCoilType, HXAssistedCoil( HXAssistedCoilNum ).Name, HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilType, HXAssistedCoil( HXAssistedCoilNum ).CoolingCoilName, NodeID( SupplyAirOutletNode ), NodeID( SecondaryAirInletNode ), "Air Nodes" );
@@ -628,7 +659,7 @@ namespace HVACHXAssistedCoolingCoil {
 		lAlphaBlanks.deallocate();
 		lNumericBlanks.deallocate();
 
-		if ( ErrorsFound ) {
+		if ( GetHXAssistedCoolingCoilInputErrorsFound ) {
 			ShowFatalError( RoutineName + "Previous error condition causes termination." );
 		}
 
@@ -741,7 +772,6 @@ namespace HVACHXAssistedCoolingCoil {
 		//  na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 CoilOutputTempLast; // Exiting cooling coil temperature from last iteration
 		Real64 AirMassFlow; // Inlet air mass flow rate
 		Real64 Error; // Error (exiting coil temp from last iteration minus current coil exiting temp)
 		int Iter; // Number of iterations
@@ -1002,7 +1032,6 @@ namespace HVACHXAssistedCoolingCoil {
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		int WhichCoil;
-		static int ErrCount( 0 );
 		bool errFlag;
 
 		// Obtains and allocates HXAssistedCoolingCoil related parameters from input file
@@ -1838,7 +1867,6 @@ namespace HVACHXAssistedCoolingCoil {
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		int WhichCoil;
-		static int ErrCount( 0 );
 
 		// Obtains and allocates HXAssistedCoolingCoil related parameters from input file
 		if ( GetCoilsInputFlag ) { // First time subroutine has been called, get input data
@@ -1855,7 +1883,7 @@ namespace HVACHXAssistedCoolingCoil {
 				if ( WhichCoil != 0 ) {
 					// coil does not specify MaxWaterFlowRate
 					MaxWaterFlowRate = 0.0;
-					ShowRecurringWarningErrorAtEnd( "Requested Max Water Flow Rate from CoilSystem:Cooling:DX:HeatExchangerAssisted N/A", ErrCount );
+					ShowRecurringWarningErrorAtEnd( "Requested Max Water Flow Rate from CoilSystem:Cooling:DX:HeatExchangerAssisted N/A", GetCoilMaxWaterFlowRateErrCount );
 				}
 			} else if ( SameString( CoilType, "CoilSystem:Cooling:Water:HeatExchangerAssisted" ) ) {
 				if ( WhichCoil != 0 ) {
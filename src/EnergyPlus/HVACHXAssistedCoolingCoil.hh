@@ -156,6 +156,11 @@ namespace HVACHXAssistedCoolingCoil {
 
 	// Functions
 
+	// Clears the global data in HVACHXAssistedCoolingCoil.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimHXAssistedCoolingCoil(
 		std::string const & HXAssistedCoilName, // Name of HXAssistedCoolingCoil
@@ -133,8 +133,93 @@ namespace HVACInterfaceManager {
 
 	// MODULE SUBROUTINES:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		Array1D< Real64 > TmpRealARR( DataConvergParams::ConvergLogStackDepth ); //Tuned Made static
+		Real64 MdotPri( 0.0 ); // flow rate on primary side kg/s
+		Real64 MdotSec( 0.0 ); // flow rate on secondary side kg/s
+		Real64 MdotPriRCLeg( 0.0 ); // flow rate of primary recirculation thru common pipe kg/s
+		Real64 MdotSecRCLeg( 0.0 ); // flow rate of secondary recirculation thru common pipe kg/s
+		Real64 TempSecInlet( 0.0 ); // temperature at secondary inlet deg C
+		Real64 TempPriInlet( 0.0 ); // temperature at primary inlet deg C
+		Real64 TempPriOutTankOut( 0.0 );
+		Real64 TempSecOutTankOut( 0.0 );
+		int NodeNumPriOut( 0 );
+		int NodeNumSecOut( 0 );
+		int NodeNumPriIn( 0 );
+		int NodeNumSecIn( 0 );
+		Array1D_bool MyEnvrnFlag;
+		bool OneTimeData( true );
+		Array1D_bool ManageTwoWayCommonPipeMyEnvrnFlag;
+		bool ManageTwoWayCommonPipeOneTimeData( true );
+		Real64 ManageTwoWayCommonPipeMdotPri( 0.0 ); // flow rate on primary side kg/s
+		Real64 ManageTwoWayCommonPipeMdotSec( 0.0 ); // flow rate on secondary side kg/s
+		Real64 MdotPriToSec( 0.0 ); // flow rate between primary and secondary side kg/s
+		Real64 ManageTwoWayCommonPipeMdotPriRCLeg( 0.0 ); // flow rate on primary recirculation common pipe kg/s
+		Real64 ManageTwoWayCommonPipeMdotSecRCLeg( 0.0 ); // flow rate on secondary recirculation common pipe kg/s
+		Real64 ManageTwoWayCommonPipeTempSecInlet( 0.0 ); // temperature at secondary inlet deg C
+		Real64 ManageTwoWayCommonPipeTempPriInlet( 0.0 ); // temperature at primary inlet deg C
+		Real64 ManageTwoWayCommonPipeTempPriOutTankOut( 0.0 );
+		Real64 ManageTwoWayCommonPipeTempSecOutTankOut( 0.0 );
+		Real64 TempCPPrimaryCntrlSetPoint( 0.0 );
+		Real64 TempCPSecondaryCntrlSetPoint( 0.0 );
+		int ManageTwoWayCommonPipeNodeNumPriOut( 0 );
+		int ManageTwoWayCommonPipeNodeNumSecOut( 0 );
+		int ManageTwoWayCommonPipeNodeNumPriIn( 0 );
+		int ManageTwoWayCommonPipeNodeNumSecIn( 0 );
+		int MaxIterLimitCaseA( 8 );
+		int MaxIterLimitCaseB( 4 );
+	}
+
 	// Functions
 
+	// Clears the global data in HVACInterfaceManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		CommonPipeSetupFinished = false;
+		PlantCommonPipe.deallocate();
+		TmpRealARR = Array1D< Real64 >( DataConvergParams::ConvergLogStackDepth );
+		MdotPri = 0.0;
+		MdotSec = 0.0;
+		MdotPriRCLeg = 0.0;
+		MdotSecRCLeg = 0.0;
+		TempSecInlet = 0.0;
+		TempPriInlet = 0.0;
+		TempPriOutTankOut = 0.0;
+		TempSecOutTankOut = 0.0;
+		NodeNumPriOut = 0;
+		NodeNumSecOut = 0;
+		NodeNumPriIn = 0;
+		NodeNumSecIn = 0;
+		MyEnvrnFlag.deallocate();
+		OneTimeData = true;
+		ManageTwoWayCommonPipeMyEnvrnFlag.deallocate();
+		ManageTwoWayCommonPipeOneTimeData = true;
+		ManageTwoWayCommonPipeMdotPri = 0.0;
+		ManageTwoWayCommonPipeMdotSec = 0.0;
+		MdotPriToSec = 0.0;
+		ManageTwoWayCommonPipeMdotPriRCLeg = 0.0;
+		ManageTwoWayCommonPipeMdotSecRCLeg = 0.0;
+		ManageTwoWayCommonPipeTempSecInlet = 0.0;
+		ManageTwoWayCommonPipeTempPriInlet = 0.0;
+		ManageTwoWayCommonPipeTempPriOutTankOut = 0.0;
+		ManageTwoWayCommonPipeTempSecOutTankOut = 0.0;
+		TempCPPrimaryCntrlSetPoint = 0.0;
+		TempCPSecondaryCntrlSetPoint = 0.0;
+		ManageTwoWayCommonPipeNodeNumPriOut = 0;
+		ManageTwoWayCommonPipeNodeNumSecOut = 0;
+		ManageTwoWayCommonPipeNodeNumPriIn = 0;
+		ManageTwoWayCommonPipeNodeNumSecIn = 0;
+		MaxIterLimitCaseA = 8;
+		MaxIterLimitCaseB = 4;
+	}
+
 	void
 	UpdateHVACInterface(
 		int const AirLoopNum, // airloop number for which air loop this is
@@ -179,7 +264,6 @@ namespace HVACInterfaceManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array1D< Real64 > TmpRealARR( ConvergLogStackDepth ); //Tuned Made static
 		Real64 DeltaEnergy;
 		// FLOW:
 
@@ -923,21 +1007,7 @@ namespace HVACInterfaceManager {
 
 		// Locals
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS
-		static Real64 MdotPri( 0.0 ); // flow rate on primary side kg/s
-		static Real64 MdotSec( 0.0 ); // flow rate on secondary side kg/s
-		static Real64 MdotPriRCLeg( 0.0 ); // flow rate of primary recirculation thru common pipe kg/s
-		static Real64 MdotSecRCLeg( 0.0 ); // flow rate of secondary recirculation thru common pipe kg/s
-		static Real64 TempSecInlet( 0.0 ); // temperature at secondary inlet deg C
-		static Real64 TempPriInlet( 0.0 ); // temperature at primary inlet deg C
-		static Real64 TempPriOutTankOut( 0.0 );
-		static Real64 TempSecOutTankOut( 0.0 );
-		static int NodeNumPriOut( 0 );
-		static int NodeNumSecOut( 0 );
-		static int NodeNumPriIn( 0 );
-		static int NodeNumSecIn( 0 );
 		int CPFlowDir; // flow direction in single common pipe
-		static Array1D_bool MyEnvrnFlag;
-		static bool OneTimeData( true );
 		Real64 CommonPipeTemp;
 
 		//One time call to set up report variables and set common pipe 'type' flag
@@ -1082,78 +1152,59 @@ namespace HVACInterfaceManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array1D_bool MyEnvrnFlag;
-		static bool OneTimeData( true );
 		int CurCallingCase; // local temporary
-		static Real64 MdotPri( 0.0 ); // flow rate on primary side kg/s
-		static Real64 MdotSec( 0.0 ); // flow rate on secondary side kg/s
-		static Real64 MdotPriToSec( 0.0 ); // flow rate between primary and secondary side kg/s
-		static Real64 MdotPriRCLeg( 0.0 ); // flow rate on primary recirculation common pipe kg/s
-		static Real64 MdotSecRCLeg( 0.0 ); // flow rate on secondary recirculation common pipe kg/s
-		static Real64 TempSecInlet( 0.0 ); // temperature at secondary inlet deg C
-		static Real64 TempPriInlet( 0.0 ); // temperature at primary inlet deg C
-		static Real64 TempPriOutTankOut( 0.0 );
-		static Real64 TempSecOutTankOut( 0.0 );
-		static Real64 TempCPPrimaryCntrlSetPoint( 0.0 );
 		// REAL(r64)  :: TempCPCntrlCurrent  = 0.0d0
-		static Real64 TempCPSecondaryCntrlSetPoint( 0.0 );
 		// REAL(r64)  :: TempCPCntrlCurrent  = 0.0d0
-		static int NodeNumPriOut( 0 );
-		static int NodeNumSecOut( 0 );
-		static int NodeNumPriIn( 0 );
-		static int NodeNumSecIn( 0 );
 
-		static int MaxIterLimitCaseA( 8 );
-		static int MaxIterLimitCaseB( 4 );
 
 		int loop; // interation loop counter
 		//  INTEGER    :: loop2
 
 		// one time setups
-		if ( OneTimeData ) {
+		if ( ManageTwoWayCommonPipeOneTimeData ) {
 			if ( ! CommonPipeSetupFinished ) SetupCommonPipes();
-			MyEnvrnFlag.dimension( TotNumLoops, true );
-			OneTimeData = false;
+			ManageTwoWayCommonPipeMyEnvrnFlag.dimension( TotNumLoops, true );
+			ManageTwoWayCommonPipeOneTimeData = false;
 		}
 
 		//fill local node indexes
-		NodeNumPriIn = PlantLoop( LoopNum ).LoopSide( SupplySide ).NodeNumIn;
-		NodeNumPriOut = PlantLoop( LoopNum ).LoopSide( SupplySide ).NodeNumOut;
-		NodeNumSecIn = PlantLoop( LoopNum ).LoopSide( DemandSide ).NodeNumIn;
-		NodeNumSecOut = PlantLoop( LoopNum ).LoopSide( DemandSide ).NodeNumOut;
+		ManageTwoWayCommonPipeNodeNumPriIn = PlantLoop( LoopNum ).LoopSide( SupplySide ).NodeNumIn;
+		ManageTwoWayCommonPipeNodeNumPriOut = PlantLoop( LoopNum ).LoopSide( SupplySide ).NodeNumOut;
+		ManageTwoWayCommonPipeNodeNumSecIn = PlantLoop( LoopNum ).LoopSide( DemandSide ).NodeNumIn;
+		ManageTwoWayCommonPipeNodeNumSecOut = PlantLoop( LoopNum ).LoopSide( DemandSide ).NodeNumOut;
 
 		// begin environment inits
-		if ( MyEnvrnFlag( LoopNum ) && BeginEnvrnFlag ) {
+		if ( ManageTwoWayCommonPipeMyEnvrnFlag( LoopNum ) && BeginEnvrnFlag ) {
 			PlantCommonPipe( LoopNum ).PriToSecFlow = 0.0;
 			PlantCommonPipe( LoopNum ).SecToPriFlow = 0.0;
 			PlantCommonPipe( LoopNum ).PriCPLegFlow = 0.0;
 			PlantCommonPipe( LoopNum ).SecCPLegFlow = 0.0;
-			MyEnvrnFlag( LoopNum ) = false;
+			ManageTwoWayCommonPipeMyEnvrnFlag( LoopNum ) = false;
 		}
 
 		if ( ! BeginEnvrnFlag ) {
-			MyEnvrnFlag( LoopNum ) = true;
+			ManageTwoWayCommonPipeMyEnvrnFlag( LoopNum ) = true;
 		}
 
 		// every time inits
-		MdotSec = Node( NodeNumSecOut ).MassFlowRate; // assume known and fixed by demand side operation
-		TempCPPrimaryCntrlSetPoint = Node( NodeNumPriIn ).TempSetPoint;
-		TempCPSecondaryCntrlSetPoint = Node( NodeNumSecIn ).TempSetPoint;
+		ManageTwoWayCommonPipeMdotSec = Node( ManageTwoWayCommonPipeNodeNumSecOut ).MassFlowRate; // assume known and fixed by demand side operation
+		TempCPPrimaryCntrlSetPoint = Node( ManageTwoWayCommonPipeNodeNumPriIn ).TempSetPoint;
+		TempCPSecondaryCntrlSetPoint = Node( ManageTwoWayCommonPipeNodeNumSecIn ).TempSetPoint;
 
 		// 6 unknowns follow, fill with current values
 		MdotPriToSec = PlantCommonPipe( LoopNum ).PriToSecFlow;
-		MdotPriRCLeg = PlantCommonPipe( LoopNum ).PriCPLegFlow;
-		MdotSecRCLeg = PlantCommonPipe( LoopNum ).SecCPLegFlow;
-		TempSecInlet = Node( NodeNumSecIn ).Temp;
-		TempPriInlet = Node( NodeNumPriIn ).Temp;
-		MdotPri = Node( NodeNumPriOut ).MassFlowRate; //may or may not be an unknown, If variable speed primary side, then unknown
+		ManageTwoWayCommonPipeMdotPriRCLeg = PlantCommonPipe( LoopNum ).PriCPLegFlow;
+		ManageTwoWayCommonPipeMdotSecRCLeg = PlantCommonPipe( LoopNum ).SecCPLegFlow;
+		ManageTwoWayCommonPipeTempSecInlet = Node( ManageTwoWayCommonPipeNodeNumSecIn ).Temp;
+		ManageTwoWayCommonPipeTempPriInlet = Node( ManageTwoWayCommonPipeNodeNumPriIn ).Temp;
+		ManageTwoWayCommonPipeMdotPri = Node( ManageTwoWayCommonPipeNodeNumPriOut ).MassFlowRate; //may or may not be an unknown, If variable speed primary side, then unknown
 
 		if ( LoopSide == SupplySide ) {
-			TempSecOutTankOut = TankOutletTemp;
-			TempPriOutTankOut = PlantLoop( LoopNum ).LoopSide( DemandSide ).LoopSideInlet_TankTemp;
+			ManageTwoWayCommonPipeTempSecOutTankOut = TankOutletTemp;
+			ManageTwoWayCommonPipeTempPriOutTankOut = PlantLoop( LoopNum ).LoopSide( DemandSide ).LoopSideInlet_TankTemp;
 		} else {
-			TempPriOutTankOut = TankOutletTemp;
-			TempSecOutTankOut = PlantLoop( LoopNum ).LoopSide( SupplySide ).LoopSideInlet_TankTemp;
+			ManageTwoWayCommonPipeTempPriOutTankOut = TankOutletTemp;
+			ManageTwoWayCommonPipeTempSecOutTankOut = PlantLoop( LoopNum ).LoopSide( SupplySide ).LoopSideInlet_TankTemp;
 		}
 
 		// determine current case
@@ -1186,26 +1237,26 @@ namespace HVACInterfaceManager {
 			for ( loop = 1; loop <= MaxIterLimitCaseA; ++loop ) {
 
 				// eq 1
-				if ( std::abs( TempSecOutTankOut - TempCPPrimaryCntrlSetPoint ) > DeltaTempTol ) {
-					MdotPriToSec = MdotPriRCLeg * ( TempCPPrimaryCntrlSetPoint - TempPriOutTankOut ) / ( TempSecOutTankOut - TempCPPrimaryCntrlSetPoint );
+				if ( std::abs( ManageTwoWayCommonPipeTempSecOutTankOut - TempCPPrimaryCntrlSetPoint ) > DeltaTempTol ) {
+					MdotPriToSec = ManageTwoWayCommonPipeMdotPriRCLeg * ( TempCPPrimaryCntrlSetPoint - ManageTwoWayCommonPipeTempPriOutTankOut ) / ( ManageTwoWayCommonPipeTempSecOutTankOut - TempCPPrimaryCntrlSetPoint );
 					if ( MdotPriToSec < MassFlowTolerance ) MdotPriToSec = 0.0;
-					if ( MdotPriToSec > MdotSec ) MdotPriToSec = MdotSec;
+					if ( MdotPriToSec > ManageTwoWayCommonPipeMdotSec ) MdotPriToSec = ManageTwoWayCommonPipeMdotSec;
 				} else {
-					MdotPriToSec = MdotSec; //  what to do (?)
+					MdotPriToSec = ManageTwoWayCommonPipeMdotSec; //  what to do (?)
 				}
 				// eq. 5
-				MdotPriRCLeg = MdotPri - MdotPriToSec;
-				if ( MdotPriRCLeg < MassFlowTolerance ) MdotPriRCLeg = 0.0;
+				ManageTwoWayCommonPipeMdotPriRCLeg = ManageTwoWayCommonPipeMdotPri - MdotPriToSec;
+				if ( ManageTwoWayCommonPipeMdotPriRCLeg < MassFlowTolerance ) ManageTwoWayCommonPipeMdotPriRCLeg = 0.0;
 
 				// eq. 4
-				MdotSecRCLeg = MdotSec - MdotPriToSec;
-				if ( MdotSecRCLeg < MassFlowTolerance ) MdotSecRCLeg = 0.0;
+				ManageTwoWayCommonPipeMdotSecRCLeg = ManageTwoWayCommonPipeMdotSec - MdotPriToSec;
+				if ( ManageTwoWayCommonPipeMdotSecRCLeg < MassFlowTolerance ) ManageTwoWayCommonPipeMdotSecRCLeg = 0.0;
 
 				// eq  6
-				if ( ( MdotPriToSec + MdotSecRCLeg ) > MassFlowTolerance ) {
-					TempSecInlet = ( MdotPriToSec * TempPriOutTankOut + MdotSecRCLeg * TempSecOutTankOut ) / ( MdotPriToSec + MdotSecRCLeg );
+				if ( ( MdotPriToSec + ManageTwoWayCommonPipeMdotSecRCLeg ) > MassFlowTolerance ) {
+					ManageTwoWayCommonPipeTempSecInlet = ( MdotPriToSec * ManageTwoWayCommonPipeTempPriOutTankOut + ManageTwoWayCommonPipeMdotSecRCLeg * ManageTwoWayCommonPipeTempSecOutTankOut ) / ( MdotPriToSec + ManageTwoWayCommonPipeMdotSecRCLeg );
 				} else {
-					TempSecInlet = TempPriOutTankOut;
+					ManageTwoWayCommonPipeTempSecInlet = ManageTwoWayCommonPipeTempPriOutTankOut;
 				}
 
 				// eq. 3
@@ -1216,21 +1267,21 @@ namespace HVACInterfaceManager {
 						//            MdotPri = (MdotSec *  TempSecInlet +  MdotPriRCLeg *TempPriOutTankOut - MdotSecRCLeg * TempSecOutTankOut )  &
 						//                          /  (TempPriOutTankOut )
 
-						MdotPri = ( MdotPriRCLeg * TempPriOutTankOut + MdotPriToSec * TempSecOutTankOut ) / ( TempCPPrimaryCntrlSetPoint );
+						ManageTwoWayCommonPipeMdotPri = ( ManageTwoWayCommonPipeMdotPriRCLeg * ManageTwoWayCommonPipeTempPriOutTankOut + MdotPriToSec * ManageTwoWayCommonPipeTempSecOutTankOut ) / ( TempCPPrimaryCntrlSetPoint );
 
 						//   ENDDO
-						if ( MdotPri < MassFlowTolerance ) MdotPri = 0.0;
+						if ( ManageTwoWayCommonPipeMdotPri < MassFlowTolerance ) ManageTwoWayCommonPipeMdotPri = 0.0;
 					} else {
-						MdotPri = MdotSec;
+						ManageTwoWayCommonPipeMdotPri = ManageTwoWayCommonPipeMdotSec;
 					}
-					SetActuatedBranchFlowRate( MdotPri, NodeNumPriIn, LoopNum, SupplySide, 1, false );
+					SetActuatedBranchFlowRate( ManageTwoWayCommonPipeMdotPri, ManageTwoWayCommonPipeNodeNumPriIn, LoopNum, SupplySide, 1, false );
 				}
 
 				// eq. 2
-				if ( ( MdotPriToSec + MdotPriRCLeg ) > MassFlowTolerance ) {
-					TempPriInlet = ( MdotPriToSec * TempSecOutTankOut + MdotPriRCLeg * TempPriOutTankOut ) / ( MdotPriToSec + MdotPriRCLeg );
+				if ( ( MdotPriToSec + ManageTwoWayCommonPipeMdotPriRCLeg ) > MassFlowTolerance ) {
+					ManageTwoWayCommonPipeTempPriInlet = ( MdotPriToSec * ManageTwoWayCommonPipeTempSecOutTankOut + ManageTwoWayCommonPipeMdotPriRCLeg * ManageTwoWayCommonPipeTempPriOutTankOut ) / ( MdotPriToSec + ManageTwoWayCommonPipeMdotPriRCLeg );
 				} else {
-					TempPriInlet = TempSecOutTankOut;
+					ManageTwoWayCommonPipeTempPriInlet = ManageTwoWayCommonPipeTempSecOutTankOut;
 				}
 
 			}
@@ -1240,46 +1291,46 @@ namespace HVACInterfaceManager {
 			// six equations and six unknowns (although one has a setpoint)
 			for ( loop = 1; loop <= MaxIterLimitCaseB; ++loop ) {
 				// eq 1,
-				if ( std::abs( TempPriOutTankOut - TempSecOutTankOut ) > DeltaTempTol ) {
-					MdotPriToSec = MdotSec * ( TempCPSecondaryCntrlSetPoint - TempSecOutTankOut ) / ( TempPriOutTankOut - TempSecOutTankOut );
+				if ( std::abs( ManageTwoWayCommonPipeTempPriOutTankOut - ManageTwoWayCommonPipeTempSecOutTankOut ) > DeltaTempTol ) {
+					MdotPriToSec = ManageTwoWayCommonPipeMdotSec * ( TempCPSecondaryCntrlSetPoint - ManageTwoWayCommonPipeTempSecOutTankOut ) / ( ManageTwoWayCommonPipeTempPriOutTankOut - ManageTwoWayCommonPipeTempSecOutTankOut );
 					if ( MdotPriToSec < MassFlowTolerance ) MdotPriToSec = 0.0;
-					if ( MdotPriToSec > MdotSec ) MdotPriToSec = MdotSec;
+					if ( MdotPriToSec > ManageTwoWayCommonPipeMdotSec ) MdotPriToSec = ManageTwoWayCommonPipeMdotSec;
 				} else {
-					MdotPriToSec = MdotSec;
+					MdotPriToSec = ManageTwoWayCommonPipeMdotSec;
 				}
 
 				// eq. 2,
-				if ( ( MdotPriToSec + MdotPriRCLeg ) > MassFlowTolerance ) {
-					TempPriInlet = ( MdotPriToSec * TempSecOutTankOut + MdotPriRCLeg * TempPriOutTankOut ) / ( MdotPriToSec + MdotPriRCLeg );
+				if ( ( MdotPriToSec + ManageTwoWayCommonPipeMdotPriRCLeg ) > MassFlowTolerance ) {
+					ManageTwoWayCommonPipeTempPriInlet = ( MdotPriToSec * ManageTwoWayCommonPipeTempSecOutTankOut + ManageTwoWayCommonPipeMdotPriRCLeg * ManageTwoWayCommonPipeTempPriOutTankOut ) / ( MdotPriToSec + ManageTwoWayCommonPipeMdotPriRCLeg );
 				} else {
-					TempPriInlet = TempSecOutTankOut;
+					ManageTwoWayCommonPipeTempPriInlet = ManageTwoWayCommonPipeTempSecOutTankOut;
 				}
 
 				// eq. 3
 				if ( ( PlantCommonPipe( LoopNum ).SupplySideInletPumpType == VariableFlow ) && ( CurCallingCase == DemandLedPrimaryInletUpdate ) ) {
 					// MdotPri is a variable to be calculated and flow request made
-					if ( std::abs( TempPriOutTankOut - TempPriInlet ) > DeltaTempTol ) {
-						MdotPri = MdotSec * ( TempCPSecondaryCntrlSetPoint - TempSecOutTankOut ) / ( TempPriOutTankOut - TempPriInlet );
-						if ( MdotPri < MassFlowTolerance ) MdotPri = 0.0;
+					if ( std::abs( ManageTwoWayCommonPipeTempPriOutTankOut - ManageTwoWayCommonPipeTempPriInlet ) > DeltaTempTol ) {
+						ManageTwoWayCommonPipeMdotPri = ManageTwoWayCommonPipeMdotSec * ( TempCPSecondaryCntrlSetPoint - ManageTwoWayCommonPipeTempSecOutTankOut ) / ( ManageTwoWayCommonPipeTempPriOutTankOut - ManageTwoWayCommonPipeTempPriInlet );
+						if ( ManageTwoWayCommonPipeMdotPri < MassFlowTolerance ) ManageTwoWayCommonPipeMdotPri = 0.0;
 					} else {
-						MdotPri = MdotSec;
+						ManageTwoWayCommonPipeMdotPri = ManageTwoWayCommonPipeMdotSec;
 					}
-					SetActuatedBranchFlowRate( MdotPri, NodeNumPriIn, LoopNum, SupplySide, 1, false );
+					SetActuatedBranchFlowRate( ManageTwoWayCommonPipeMdotPri, ManageTwoWayCommonPipeNodeNumPriIn, LoopNum, SupplySide, 1, false );
 				}
 
 				// eq. 4
-				MdotSecRCLeg = MdotSec - MdotPriToSec;
-				if ( MdotSecRCLeg < MassFlowTolerance ) MdotSecRCLeg = 0.0;
+				ManageTwoWayCommonPipeMdotSecRCLeg = ManageTwoWayCommonPipeMdotSec - MdotPriToSec;
+				if ( ManageTwoWayCommonPipeMdotSecRCLeg < MassFlowTolerance ) ManageTwoWayCommonPipeMdotSecRCLeg = 0.0;
 
 				// eq. 5
-				MdotPriRCLeg = MdotPri - MdotPriToSec;
-				if ( MdotPriRCLeg < MassFlowTolerance ) MdotPriRCLeg = 0.0;
+				ManageTwoWayCommonPipeMdotPriRCLeg = ManageTwoWayCommonPipeMdotPri - MdotPriToSec;
+				if ( ManageTwoWayCommonPipeMdotPriRCLeg < MassFlowTolerance ) ManageTwoWayCommonPipeMdotPriRCLeg = 0.0;
 
 				// eq  6
-				if ( ( MdotPriToSec + MdotSecRCLeg ) > MassFlowTolerance ) {
-					TempSecInlet = ( MdotPriToSec * TempPriOutTankOut + MdotSecRCLeg * TempSecOutTankOut ) / ( MdotPriToSec + MdotSecRCLeg );
+				if ( ( MdotPriToSec + ManageTwoWayCommonPipeMdotSecRCLeg ) > MassFlowTolerance ) {
+					ManageTwoWayCommonPipeTempSecInlet = ( MdotPriToSec * ManageTwoWayCommonPipeTempPriOutTankOut + ManageTwoWayCommonPipeMdotSecRCLeg * ManageTwoWayCommonPipeTempSecOutTankOut ) / ( MdotPriToSec + ManageTwoWayCommonPipeMdotSecRCLeg );
 				} else {
-					TempSecInlet = TempPriOutTankOut;
+					ManageTwoWayCommonPipeTempSecInlet = ManageTwoWayCommonPipeTempPriOutTankOut;
 				}
 
 			}
@@ -1292,10 +1343,10 @@ namespace HVACInterfaceManager {
 		//update
 		PlantCommonPipe( LoopNum ).PriToSecFlow = MdotPriToSec;
 		PlantCommonPipe( LoopNum ).SecToPriFlow = MdotPriToSec;
-		PlantCommonPipe( LoopNum ).PriCPLegFlow = MdotPriRCLeg;
-		PlantCommonPipe( LoopNum ).SecCPLegFlow = MdotSecRCLeg;
-		Node( NodeNumSecIn ).Temp = TempSecInlet;
-		Node( NodeNumPriIn ).Temp = TempPriInlet;
+		PlantCommonPipe( LoopNum ).PriCPLegFlow = ManageTwoWayCommonPipeMdotPriRCLeg;
+		PlantCommonPipe( LoopNum ).SecCPLegFlow = ManageTwoWayCommonPipeMdotSecRCLeg;
+		Node( ManageTwoWayCommonPipeNodeNumSecIn ).Temp = ManageTwoWayCommonPipeTempSecInlet;
+		Node( ManageTwoWayCommonPipeNodeNumPriIn ).Temp = ManageTwoWayCommonPipeTempPriInlet;
 
 	}
 
@@ -147,6 +147,11 @@ namespace HVACInterfaceManager {
 
 	// Functions
 
+	// Clears the global data in HVACInterfaceManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	UpdateHVACInterface(
 		int const AirLoopNum, // airloop number for which air loop this is
@@ -215,6 +215,26 @@ namespace HVACManager {
 		bool SimHVACIterSetup( false );
 		bool TriggerGetAFN( true );
 		bool ReportAirHeatBalanceFirstTimeFlag( true );
+		bool PrintedWarmup( false );
+		bool MyEnvrnFlag( true );
+		bool InitVentReportFlag( true );
+		bool DebugNamesReported( false );
+		int ZTempTrendsNumSysSteps( 0 );
+		int SysTimestepLoop( 0 );
+		int ErrCount( 0 ); // Number of times that the maximum iterations was exceeded
+		bool MySetPointInit( true );
+		int MaxErrCount( 0 );
+		std::string ErrEnvironmentName;
+		bool SimSelectedEquipmentMyEnvrnFlag( true );
+		bool FlowMaxAvailAlreadyReset( false );
+		bool FlowResolutionNeeded( false );
+		Array1D< Real64 > MixSenLoad; // Mixing sensible loss or gain
+		Array1D< Real64 > MixLatLoad; // Mixing latent loss or gain
+		int AirLoopNum( 0 ); // the air loop index
+		bool MyOneTimeFlag( true );
+		bool CyclingFan( false ); // TRUE means air loop operates in cycling fan mode at some point
+		int ZoneNum( 0 ); // zone index
+		Real64 CycFanMaxVal( 0.0 ); // max value of cycling fan schedule
 	}
 	//SUBROUTINE SPECIFICATIONS FOR MODULE PrimaryPlantLoops
 	// and zone equipment simulations
@@ -230,6 +250,26 @@ namespace HVACManager {
 		SimHVACIterSetup = false;
 		TriggerGetAFN = true;
 		ReportAirHeatBalanceFirstTimeFlag = true;
+		PrintedWarmup = false;
+		MyEnvrnFlag = true;
+		InitVentReportFlag = true;
+		DebugNamesReported = false;
+		ZTempTrendsNumSysSteps = 0;
+		SysTimestepLoop = 0;
+		ErrCount = 0;
+		MySetPointInit = true;
+		MaxErrCount = 0;
+		ErrEnvironmentName.clear();
+		SimSelectedEquipmentMyEnvrnFlag = true;
+		FlowMaxAvailAlreadyReset = false;
+		FlowResolutionNeeded = false;
+		MixSenLoad.deallocate();
+		MixLatLoad.deallocate();
+		AirLoopNum = 0;
+		MyOneTimeFlag = true;
+		CyclingFan = false;
+		ZoneNum = 0;
+		CycFanMaxVal = 0.0;
 	}
 
 
@@ -257,10 +297,11 @@ namespace HVACManager {
 
 		// Using/Aliasing
 		using DataConvergParams::MinTimeStepSys; // =0.0166667     != 1 minute | 0.3 C = (1% OF 300 C) =max allowable diff between ZoneAirTemp at Time=T & T-1
-		using DataConvergParams::MaxZoneTempDiff;
 
 		using ZoneTempPredictorCorrector::ManageZoneAirUpdates;
 		using ZoneTempPredictorCorrector::DetectOscillatingZoneTemp;
+		using ZoneTempPredictorCorrector::DetectZoneControlEvents;
+		using ZoneTempPredictorCorrector::ZoneTempTruncationError;
 
 		using NodeInputManager::CalcMoreNodeInfo;
 		using ZoneEquipmentManager::UpdateZoneSizing;
@@ -329,14 +370,8 @@ namespace HVACManager {
 		int NodeNum;
 		bool ReportDebug;
 		int ZoneNum;
-		static bool PrintedWarmup( false );
 
-		static bool MyEnvrnFlag( true );
-		static bool InitVentReportFlag( true );
-		static bool DebugNamesReported( false );
 
-		static int ZTempTrendsNumSysSteps( 0 );
-		static int SysTimestepLoop( 0 );
 		bool DummyLogical;
 
 		// Formats
@@ -418,6 +453,8 @@ namespace HVACManager {
 
 		if ( Contaminant.SimulateContaminants ) ManageZoneContaminanUpdates( iPredictStep, ShortenTimeStepSys, UseZoneTimeStepHistory, PriorTimeStep );
 
+		bool const ControlEvent = ( ControlEventTimeStep > 0.0 && DetectZoneControlEvents() );
+
 		SimHVAC();
 
 		if ( AnyIdealCondEntSetPointInModel && MetersHaveBeenInitialized && ! WarmupFlag ) {
@@ -439,10 +476,10 @@ namespace HVACManager {
 		ManageZoneAirUpdates( iCorrectStep, ZoneTempChange, ShortenTimeStepSys, UseZoneTimeStepHistory, PriorTimeStep );
 		if ( Contaminant.SimulateContaminants ) ManageZoneContaminanUpdates( iCorrectStep, ShortenTimeStepSys, UseZoneTimeStepHistory, PriorTimeStep );
 
-		if ( ZoneTempChange > MaxZoneTempDiff && ! KickOffSimulation ) {
+		// model how many system timesteps we want in zone timestep
+		ZTempTrendsNumSysSteps = NumSysTimeStepsWanted( ZoneTempChange, ZoneTempTruncationError, ControlEvent );
+		if ( ZTempTrendsNumSysSteps > 1 && ! KickOffSimulation ) {
 			//determine value of adaptive system time step
-			// model how many system timesteps we want in zone timestep
-			ZTempTrendsNumSysSteps = int( ZoneTempChange / MaxZoneTempDiff + 1.0 ); // add 1 for truncation
 			NumOfSysTimeSteps = min( ZTempTrendsNumSysSteps, LimitNumSysSteps );
 			//then determine timestep length for even distribution, protect div by zero
 			if ( NumOfSysTimeSteps > 0 ) TimeStepSys = TimeStepZone / NumOfSysTimeSteps;
@@ -628,6 +665,54 @@ namespace HVACManager {
 
 	}
 
+	int
+	NumSysTimeStepsWanted(
+		Real64 const ZoneTempChange, // Largest change of a zone air temperature over the zone time step
+		Real64 const ZoneTempTruncError, // Largest truncation error estimate of a zone air temperature
+		bool const ControlEvent // True if a zone control event happens at this zone time step
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the number of system time steps wanted in the zone time step, 1 if the zone
+		// time step need not be divided.
+
+		// METHODOLOGY EMPLOYED:
+		// With ZoneTemperatureChange control the zone time step is divided so that no zone air
+		// temperature changes by more than MaxZoneTempDiff per system time step.  With
+		// TruncationError control the third difference of the zone air temperature history
+		// is used instead; it scales with the cube of the time step and stays small while the
+		// temperature follows a steady trend, however large the change, so quiescent and
+		// steadily drifting periods keep the zone time step.  In zone time steps with a control
+		// event the system time step is at most ControlEventTimeStep.
+
+		// Using/Aliasing
+		using DataHeatBalance::ZoneAirSolutionAlgo;
+		using DataHeatBalance::Use3rdOrder;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int NumSysSteps( 1 );
+
+		if ( SysTimeStepControl == SysTimeStepTruncationError && ZoneAirSolutionAlgo == Use3rdOrder ) {
+			if ( ZoneTempTruncError > MaxZoneTempTruncError ) {
+				NumSysSteps = int( std::cbrt( ZoneTempTruncError / MaxZoneTempTruncError ) + 1.0 ); // add 1 for truncation
+			}
+		} else if ( ZoneTempChange > MaxZoneTempDiff ) {
+			NumSysSteps = int( ZoneTempChange / MaxZoneTempDiff + 1.0 ); // add 1 for truncation
+		}
+		if ( ControlEvent && ControlEventTimeStep > 0.0 ) {
+			NumSysSteps = max( NumSysSteps, nint( TimeStepZone / ControlEventTimeStep ) );
+		}
+
+		return NumSysSteps;
+	}
+
 	void
 	SimHVAC()
 	{
@@ -708,11 +793,7 @@ namespace HVACManager {
 		/////////// hoisted into namespace SimHVACIterSetup ////////////
 		//static bool IterSetup( false ); // Set to TRUE after the variable is setup for Output Reporting
 		/////////////////////////
-		static int ErrCount( 0 ); // Number of times that the maximum iterations was exceeded
-		static bool MySetPointInit( true );
 		std::string CharErrOut; // a character string equivalent of ErrCount
-		static int MaxErrCount( 0 );
-		static std::string ErrEnvironmentName;
 		int LoopNum;
 		int LoopSide;
 		int ThisLoopSide;
@@ -840,7 +921,7 @@ namespace HVACManager {
 
 		// Main iteration loop for HVAC.  If any of the simulation flags are
 		// true, then specific components must be resimulated.
-		while ( ( SimAirLoopsFlag || SimZoneEquipmentFlag || SimNonZoneEquipmentFlag || SimPlantLoopsFlag || SimElecCircuitsFlag ) && ( HVACManageIteration <= MaxIter ) ) {
+		while ( ( SimAirLoopsFlag || SimZoneEquipmentFlag || SimNonZoneEquipmentFlag || SimPlantLoopsFlag || SimElecCircuitsFlag || ( ResimChangedAirLoopsOnly && AnyAirLoopsNeedSim() ) ) && ( HVACManageIteration <= MaxIter ) ) {
 
 			ManageEMS( emsCallFromHVACIterationLoop, anyEMSRan ); // calling point id
 
@@ -911,7 +992,7 @@ namespace HVACManager {
 				gio::write( CharErrOut, "(I5)" ) << MaxIter;
 				strip( CharErrOut );
 				ShowWarningError( "SimHVAC: Maximum iterations (" + CharErrOut + ") exceeded for all HVAC loops, at " + EnvironmentName + ", " + CurMnDy + ' ' + CreateSysTimeIntervalString() );
-				if ( SimAirLoopsFlag ) {
+				if ( SimAirLoopsFlag || ( ResimChangedAirLoopsOnly && AnyAirLoopsNeedSim() ) ) {
 					ShowContinueError( "The solution for one or more of the Air Loop HVAC systems did not appear to converge" );
 				}
 				if ( SimZoneEquipmentFlag ) {
@@ -1554,9 +1635,6 @@ namespace HVACManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int IterAir; // counts iterations to enforce maximum iteration limit
-		static bool MyEnvrnFlag( true );
-		static bool FlowMaxAvailAlreadyReset( false );
-		static bool FlowResolutionNeeded( false );
 
 		// FLOW:
 
@@ -1572,17 +1650,17 @@ namespace HVACManager {
 		}
 		ResetAllPlantInterConnectFlags();
 
-		if ( BeginEnvrnFlag && MyEnvrnFlag ) {
+		if ( BeginEnvrnFlag && SimSelectedEquipmentMyEnvrnFlag ) {
 			// Following comment is incorrect!  (LKL) Even the first time through this does more than read in data.
 			// Zone equipment data needs to be read in before air loop data to allow the
 			// determination of which zones are connected to which air loops.
 			// This call of ManageZoneEquipment does nothing except force the
 			// zone equipment data to be read in.
 			ManageZoneEquipment( FirstHVACIteration, SimZoneEquipment, SimAirLoops );
-			MyEnvrnFlag = false;
+			SimSelectedEquipmentMyEnvrnFlag = false;
 		}
 		if ( ! BeginEnvrnFlag ) {
-			MyEnvrnFlag = true;
+			SimSelectedEquipmentMyEnvrnFlag = true;
 		}
 
 		if ( FirstHVACIteration ) {
@@ -1608,14 +1686,14 @@ namespace HVACManager {
 			facilityElectricServiceObj->manageElectricPowerService( FirstHVACIteration, SimElecCircuitsFlag, false );
 		} else {
 			FlowResolutionNeeded = false;
-			while ( ( SimAirLoops || SimZoneEquipment ) && ( IterAir <= MaxAir ) ) {
+			while ( ( SimAirLoops || SimZoneEquipment || ( ResimChangedAirLoopsOnly && AnyAirLoopsNeedSim() ) ) && ( IterAir <= MaxAir ) ) {
 				++IterAir; // Increment the iteration counter
 				// Call AirflowNetwork simulation to calculate air flows and pressures
 				ResimulateAirZone = false;
 				if ( SimulateAirflowNetwork > AirflowNetworkControlSimple ) {
 					ManageAirflowNetworkBalance( FirstHVACIteration, IterAir, ResimulateAirZone );
 				}
-				if ( SimAirLoops ) {
+				if ( SimAirLoops || ( ResimChangedAirLoopsOnly && AnyAirLoopsNeedSim() ) ) {
 					ManageAirLoops( FirstHVACIteration, SimAirLoops, SimZoneEquipment );
 					SimElecCircuits = true; //If this was simulated there are possible electric changes that need to be simulated
 				}
@@ -1655,6 +1733,8 @@ namespace HVACManager {
 				AirLoopConvergFail = 0;
 			}
 			// Check to see if any components have been locked out. If so, SimAirLoops will be reset to TRUE.
+			// With ChangedAirLoops only the locked out air loops are flagged, and the flagged air loops are
+			// resimulated with the next HVAC iteration without setting SimAirLoops, which resimulates all.
 			ResolveLockoutFlags( SimAirLoops );
 
 			if ( SimNonZoneEquipment ) {
@@ -1882,7 +1962,7 @@ namespace HVACManager {
 		// if any components have been locked out
 
 		// METHODOLOGY EMPLOYED:
-		// Checks if loop lockout flags are .TRUE.; if so, sets SimAirLoops to .TRUE.
+		// Checks if loop lockout flags are .TRUE.; if so, requests resimulation of that air loop.
 
 		// REFERENCES:
 		// na
@@ -1909,7 +1989,7 @@ namespace HVACManager {
 			// check if economizer ia active and if there is a request that it be locked out
 			if ( AirLoopControlInfo( AirLoopIndex ).EconoActive && ( AirLoopControlInfo( AirLoopIndex ).ReqstEconoLockoutWithCompressor || AirLoopControlInfo( AirLoopIndex ).ReqstEconoLockoutWithHeating ) ) {
 				AirLoopControlInfo( AirLoopIndex ).EconoLockout = true;
-				SimAir = true;
+				RequestAirLoopSim( AirLoopIndex, SimAir );
 			}
 		}
 
@@ -2184,8 +2264,6 @@ namespace HVACManager {
 		Real64 H2OHtOfVap; // Heat of vaporization of air
 		Real64 TotalLoad; // Total loss or gain
 		int MixNum; // Counter for MIXING and Cross Mixing statements
-		static Array1D< Real64 > MixSenLoad; // Mixing sensible loss or gain
-		static Array1D< Real64 > MixLatLoad; // Mixing latent loss or gain
 		int j; // Index in a do-loop
 		int VentZoneNum; // Number of ventilation object per zone
 		Real64 VentZoneMassflow; // Total mass flow rate per zone
@@ -2569,14 +2647,9 @@ namespace HVACManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int AirLoopNum( 0 ); // the air loop index
 		int ControlledZoneNum; // controlled zone index
-		static bool MyOneTimeFlag( true );
-		static bool CyclingFan( false ); // TRUE means air loop operates in cycling fan mode at some point
-		static int ZoneNum( 0 ); // zone index
 		int LightNum; // Lights object index
 		int SurfNum; // Surface index
-		static Real64 CycFanMaxVal( 0.0 ); // max value of cycling fan schedule
 
 		if ( ! AirLoopsSimOnce ) return;
 
@@ -88,6 +88,13 @@ namespace HVACManager {
 	void
 	ManageHVAC();
 
+	int
+	NumSysTimeStepsWanted(
+		Real64 const ZoneTempChange, // Largest change of a zone air temperature over the zone time step
+		Real64 const ZoneTempTruncError, // Largest truncation error estimate of a zone air temperature
+		bool const ControlEvent // True if a zone control event happens at this zone time step
+	);
+
 	void
 	SimHVAC();
 
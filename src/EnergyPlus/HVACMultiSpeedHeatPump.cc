@@ -230,8 +230,98 @@ namespace HVACMultiSpeedHeatPump {
 	Array1D< MSHeatPumpData > MSHeatPump;
 	Array1D< MSHeatPumpReportData > MSHeatPumpReport;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // Get input flag
+		bool ErrorsFound( false ); // True when input errors found
+		bool AllocatedFlag( false ); // True when arrays are allocated
+		int MaxNums( 0 ); // Maximum number of numeric input fields
+		int MaxAlphas( 0 ); // Maximum number of alpha input fields
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		bool MyOneTimeFlag( true ); // Initialization flag
+		Array1D_bool MyEnvrnFlag; // Used for initializations each begin environment flag
+		Array1D_bool MySizeFlag; // Used for sizing MSHP inputs one time
+		Array1D_bool MyCheckFlag; // Used to obtain the zone inlet node number in the controlled zone
+		Array1D_bool MyFlowFracFlag; // Used for calculatig flow fraction once
+		Array1D_bool MyPlantScantFlag; // used for finding on heat recovery plant loop
+		Array1D_bool MyStagedFlag; // used for finding on staged thermostat
+		int ZoneInSysIndex( 0 ); // number of zone inlet nodes counter in an airloop
+		int NumAirLoopZones( 0 ); // number of zone inlet nodes in an air loop
+		int ZoneInletNodeNum( 0 ); // zone inlet nodes node number
+		bool FlowFracFlagReady( true ); // one time flag for calculating flow fraction through controlled zone
+		Real64 SumOfMassFlowRateMax( 0.0 ); // the sum of mass flow rates at inlet to zones in an airloop
+		Real64 CntrlZoneTerminalUnitMassFlowRateMax( 0.0 ); // Maximum mass flow rate through controlled zone terminal unit
+		int EquipNum( 0 ); // local do loop index for equipment listed for a zone
+		bool InitMSHeatPumpErrorsFound( false ); // flag returned from mining call
+		int SteamIndex( 0 ); // index of steam quality for steam heating coil
+		Real64 mdot( 0.0 ); // local temporary for mass flow rate (kg/s)
+		Real64 SteamDensity( 0.0 ); // density of steam at 100C, used for steam heating coils
+		Real64 CoilMaxVolFlowRate( 0.0 ); // coil fluid maximum volume flow rate
+		Real64 QActual( 0.0 ); // coil actual capacity
+		int CoilAvailSchPtr( 0 ); // DX coil availability schedule pointer
+		int ErrCountCyc( 0 ); // Counter used to minimize the occurrence of output warnings
+		int ErrCountVar( 0 ); // Counter used to minimize the occurrence of output warnings
+		std::string HeatCoilName;
+	}
+
 	// Functions
 
+	// Clears the global data in HVACMultiSpeedHeatPump.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumMSHeatPumps = 0;
+		AirLoopPass = 0;
+		TempSteamIn = 100.0;
+		CurrentModuleObject.clear();
+		CompOnMassFlow = 0.0;
+		CompOffMassFlow = 0.0;
+		CompOnFlowRatio = 0.0;
+		CompOffFlowRatio = 0.0;
+		FanSpeedRatio = 0.0;
+		SupHeaterLoad = 0.0;
+		SaveLoadResidual = 0.0;
+		SaveCompressorPLR = 0.0;
+		CheckEquipName.deallocate();
+		MSHeatPump.deallocate();
+		MSHeatPumpReport.deallocate();
+		GetInputFlag = true;
+		ErrorsFound = false;
+		AllocatedFlag = false;
+		MaxNums = 0;
+		MaxAlphas = 0;
+		TotalArgs = 0;
+		MyOneTimeFlag = true;
+		MyEnvrnFlag.deallocate();
+		MySizeFlag.deallocate();
+		MyCheckFlag.deallocate();
+		MyFlowFracFlag.deallocate();
+		MyPlantScantFlag.deallocate();
+		MyStagedFlag.deallocate();
+		ZoneInSysIndex = 0;
+		NumAirLoopZones = 0;
+		ZoneInletNodeNum = 0;
+		FlowFracFlagReady = true;
+		SumOfMassFlowRateMax = 0.0;
+		CntrlZoneTerminalUnitMassFlowRateMax = 0.0;
+		EquipNum = 0;
+		InitMSHeatPumpErrorsFound = false;
+		SteamIndex = 0;
+		mdot = 0.0;
+		SteamDensity = 0.0;
+		CoilMaxVolFlowRate = 0.0;
+		QActual = 0.0;
+		CoilAvailSchPtr = 0;
+		ErrCountCyc = 0;
+		ErrCountVar = 0;
+		HeatCoilName.clear();
+	}
+
 	void
 	SimMSHeatPump(
 		std::string const & CompName, // Name of the unitary engine driven heat pump system
@@ -273,7 +363,6 @@ namespace HVACMultiSpeedHeatPump {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int MSHeatPumpNum; // index of fan coil unit being simulated
-		static bool GetInputFlag( true ); // Get input flag
 		Real64 OnOffAirFlowRatio; // Ratio of compressor ON airflow to average airflow over timestep
 		Real64 QZnLoad; // Zone load required by all zones served by this air loop system
 		Real64 QSensUnitOut; // MSHP sensible capacity output [W]
@@ -595,10 +684,8 @@ namespace HVACMultiSpeedHeatPump {
 		int NumAlphas; // Number of elements in the alpha array
 		int NumNumbers; // Number of Numbers for each GetObjectItem call
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // True when input errors found
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
-		static bool AllocatedFlag( false ); // True when arrays are allocated
 		bool AirNodeFound; // True when an air node is found
 		bool AirLoopFound; // True when an air loop is found
 		int ControlledZoneNum; // Controlled zone number
@@ -623,9 +710,6 @@ namespace HVACMultiSpeedHeatPump {
 		Array1D< Real64 > Numbers; // Numeric input items for object
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int MaxNums( 0 ); // Maximum number of numeric input fields
-		static int MaxAlphas( 0 ); // Maximum number of alpha input fields
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 		//  certain object in the input file
 		bool errFlag;
 		int SteamIndex; // steam coil steam inlet density
@@ -1610,13 +1694,6 @@ namespace HVACMultiSpeedHeatPump {
 		int OutNode; // Outlet node number in MSHP loop
 		int ZoneInNode; // Zone inlet node number in the controlled zone for MSHP
 		Real64 RhoAir; // Air density at InNode
-		static bool MyOneTimeFlag( true ); // Initialization flag
-		static Array1D_bool MyEnvrnFlag; // Used for initializations each begin environment flag
-		static Array1D_bool MySizeFlag; // Used for sizing MSHP inputs one time
-		static Array1D_bool MyCheckFlag; // Used to obtain the zone inlet node number in the controlled zone
-		static Array1D_bool MyFlowFracFlag; // Used for calculatig flow fraction once
-		static Array1D_bool MyPlantScantFlag; // used for finding on heat recovery plant loop
-		static Array1D_bool MyStagedFlag; // used for finding on staged thermostat
 
 		Real64 QSensUnitOut; // Output of MSHP system with coils off
 		Real64 PartLoadFrac; // Part-load ratio
@@ -1629,26 +1706,12 @@ namespace HVACMultiSpeedHeatPump {
 		Real64 MinHumRat; // Minimum humidity ratio for sensible capacity calculation (kg/kg)
 		Real64 DeltaMassRate; // Difference of mass flow rate between inlet node and system outlet node
 
-		static int ZoneInSysIndex( 0 ); // number of zone inlet nodes counter in an airloop
-		static int NumAirLoopZones( 0 ); // number of zone inlet nodes in an air loop
-		static int ZoneInletNodeNum( 0 ); // zone inlet nodes node number
-		static bool FlowFracFlagReady( true ); // one time flag for calculating flow fraction through controlled zone
-		static Real64 SumOfMassFlowRateMax( 0.0 ); // the sum of mass flow rates at inlet to zones in an airloop
-		static Real64 CntrlZoneTerminalUnitMassFlowRateMax( 0.0 ); // Maximum mass flow rate through controlled zone terminal unit
 		bool errFlag;
 		Real64 rho; // local fluid density
 		Real64 MdotHR; // local temporary for heat recovery fluid mass flow rate (kg/s)
 		Real64 ZoneLoadToCoolSPSequenced;
 		Real64 ZoneLoadToHeatSPSequenced;
-		static int EquipNum( 0 ); // local do loop index for equipment listed for a zone
 
-		static bool ErrorsFound( false ); // flag returned from mining call
-		static int SteamIndex( 0 ); // index of steam quality for steam heating coil
-		static Real64 mdot( 0.0 ); // local temporary for mass flow rate (kg/s)
-		static Real64 SteamDensity( 0.0 ); // density of steam at 100C, used for steam heating coils
-		static Real64 CoilMaxVolFlowRate( 0.0 ); // coil fluid maximum volume flow rate
-		static Real64 QActual( 0.0 ); // coil actual capacity
-		static int CoilAvailSchPtr( 0 ); // DX coil availability schedule pointer
 
 		// FLOW
 		InNode = MSHeatPump( MSHeatPumpNum ).AirInletNodeNum;
@@ -1695,11 +1758,11 @@ namespace HVACMultiSpeedHeatPump {
 				if ( errFlag ) {
 					ShowFatalError( "InitMSHeatPump: Program terminated for previous conditions." );
 				}
-				MSHeatPump( MSHeatPumpNum ).MaxCoilFluidFlow = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", MSHeatPump( MSHeatPumpNum ).HeatCoilName, ErrorsFound );
+				MSHeatPump( MSHeatPumpNum ).MaxCoilFluidFlow = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", MSHeatPump( MSHeatPumpNum ).HeatCoilName, InitMSHeatPumpErrorsFound );
 
 				if ( MSHeatPump( MSHeatPumpNum ).MaxCoilFluidFlow > 0.0 ) {
 					rho = GetDensityGlycol( PlantLoop( MSHeatPump( MSHeatPumpNum ).LoopNum ).FluidName, CWInitConvTemp, PlantLoop( MSHeatPump( MSHeatPumpNum ).LoopNum ).FluidIndex, RoutineName );
-					MSHeatPump( MSHeatPumpNum ).MaxCoilFluidFlow = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", MSHeatPump( MSHeatPumpNum ).HeatCoilName, ErrorsFound ) * rho;
+					MSHeatPump( MSHeatPumpNum ).MaxCoilFluidFlow = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", MSHeatPump( MSHeatPumpNum ).HeatCoilName, InitMSHeatPumpErrorsFound ) * rho;
 				}
 				// fill outlet node for coil
 				MSHeatPump( MSHeatPumpNum ).CoilOutletNode = PlantLoop( MSHeatPump( MSHeatPumpNum ).LoopNum ).LoopSide( MSHeatPump( MSHeatPumpNum ).LoopSide ).Branch( MSHeatPump( MSHeatPumpNum ).BranchNum ).Comp( MSHeatPump( MSHeatPumpNum ).CompNum ).NodeNumOut;
@@ -1711,7 +1774,7 @@ namespace HVACMultiSpeedHeatPump {
 				if ( errFlag ) {
 					ShowFatalError( "InitMSHeatPump: Program terminated for previous conditions." );
 				}
-				MSHeatPump( MSHeatPumpNum ).MaxCoilFluidFlow = GetCoilMaxSteamFlowRate( MSHeatPump( MSHeatPumpNum ).HeatCoilNum, ErrorsFound );
+				MSHeatPump( MSHeatPumpNum ).MaxCoilFluidFlow = GetCoilMaxSteamFlowRate( MSHeatPump( MSHeatPumpNum ).HeatCoilNum, InitMSHeatPumpErrorsFound );
 				if ( MSHeatPump( MSHeatPumpNum ).MaxCoilFluidFlow > 0.0 ) {
 					SteamIndex = 0; // Function GetSatDensityRefrig will look up steam index if 0 is passed
 					SteamDensity = GetSatDensityRefrig( fluidNameSteam, TempSteamIn, 1.0, SteamIndex, RoutineName );
@@ -1729,11 +1792,11 @@ namespace HVACMultiSpeedHeatPump {
 				if ( errFlag ) {
 					ShowFatalError( "InitMSHeatPump: Program terminated for previous conditions." );
 				}
-				MSHeatPump( MSHeatPumpNum ).MaxSuppCoilFluidFlow = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", MSHeatPump( MSHeatPumpNum ).SuppHeatCoilName, ErrorsFound );
+				MSHeatPump( MSHeatPumpNum ).MaxSuppCoilFluidFlow = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", MSHeatPump( MSHeatPumpNum ).SuppHeatCoilName, InitMSHeatPumpErrorsFound );
 
 				if ( MSHeatPump( MSHeatPumpNum ).MaxSuppCoilFluidFlow > 0.0 ) {
 					rho = GetDensityGlycol( PlantLoop( MSHeatPump( MSHeatPumpNum ).SuppLoopNum ).FluidName, CWInitConvTemp, PlantLoop( MSHeatPump( MSHeatPumpNum ).SuppLoopNum ).FluidIndex, RoutineName );
-					MSHeatPump( MSHeatPumpNum ).MaxSuppCoilFluidFlow = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", MSHeatPump( MSHeatPumpNum ).SuppHeatCoilName, ErrorsFound ) * rho;
+					MSHeatPump( MSHeatPumpNum ).MaxSuppCoilFluidFlow = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", MSHeatPump( MSHeatPumpNum ).SuppHeatCoilName, InitMSHeatPumpErrorsFound ) * rho;
 				}
 				// fill outlet node for coil
 				MSHeatPump( MSHeatPumpNum ).SuppCoilOutletNode = PlantLoop( MSHeatPump( MSHeatPumpNum ).SuppLoopNum ).LoopSide( MSHeatPump( MSHeatPumpNum ).SuppLoopSide ).Branch( MSHeatPump( MSHeatPumpNum ).SuppBranchNum ).Comp( MSHeatPump( MSHeatPumpNum ).SuppCompNum ).NodeNumOut;
@@ -1745,7 +1808,7 @@ namespace HVACMultiSpeedHeatPump {
 				if ( errFlag ) {
 					ShowFatalError( "InitMSHeatPump: Program terminated for previous conditions." );
 				}
-				MSHeatPump( MSHeatPumpNum ).MaxSuppCoilFluidFlow = GetCoilMaxSteamFlowRate( MSHeatPump( MSHeatPumpNum ).SuppHeatCoilNum, ErrorsFound );
+				MSHeatPump( MSHeatPumpNum ).MaxSuppCoilFluidFlow = GetCoilMaxSteamFlowRate( MSHeatPump( MSHeatPumpNum ).SuppHeatCoilNum, InitMSHeatPumpErrorsFound );
 				if ( MSHeatPump( MSHeatPumpNum ).MaxSuppCoilFluidFlow > 0.0 ) {
 					SteamIndex = 0; // Function GetSatDensityRefrig will look up steam index if 0 is passed
 					SteamDensity = GetSatDensityRefrig( fluidNameSteam, TempSteamIn, 1.0, SteamIndex, RoutineName );
@@ -1886,7 +1949,7 @@ namespace HVACMultiSpeedHeatPump {
 					if ( MSHeatPump( MSHeatPumpNum ).HeatCoilType == Coil_HeatingWater ) {
 						SimulateWaterCoilComponents( MSHeatPump( MSHeatPumpNum ).HeatCoilName, FirstHVACIteration, MSHeatPump( MSHeatPumpNum ).HeatCoilNum );
 
-						CoilMaxVolFlowRate = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", MSHeatPump( MSHeatPumpNum ).HeatCoilName, ErrorsFound );
+						CoilMaxVolFlowRate = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", MSHeatPump( MSHeatPumpNum ).HeatCoilName, InitMSHeatPumpErrorsFound );
 						if ( CoilMaxVolFlowRate != AutoSize ) {
 							rho = GetDensityGlycol( PlantLoop( MSHeatPump( MSHeatPumpNum ).LoopNum ).FluidName, CWInitConvTemp, PlantLoop( MSHeatPump( MSHeatPumpNum ).LoopNum ).FluidIndex, RoutineName );
 							MSHeatPump( MSHeatPumpNum ).MaxCoilFluidFlow = CoilMaxVolFlowRate * rho;
@@ -1896,7 +1959,7 @@ namespace HVACMultiSpeedHeatPump {
 					if ( MSHeatPump( MSHeatPumpNum ).HeatCoilType == Coil_HeatingSteam ) {
 
 						SimulateSteamCoilComponents( MSHeatPump( MSHeatPumpNum ).HeatCoilName, FirstHVACIteration, MSHeatPump( MSHeatPumpNum ).HeatCoilNum, 1.0, QActual ); //QCoilReq, simulate any load > 0 to get max capacity of steam coil
-						CoilMaxVolFlowRate = GetCoilMaxSteamFlowRate( MSHeatPump( MSHeatPumpNum ).HeatCoilNum, ErrorsFound );
+						CoilMaxVolFlowRate = GetCoilMaxSteamFlowRate( MSHeatPump( MSHeatPumpNum ).HeatCoilNum, InitMSHeatPumpErrorsFound );
 
 						if ( CoilMaxVolFlowRate != AutoSize ) {
 							SteamIndex = 0; // Function GetSatDensityRefrig will look up steam index if 0 is passed
@@ -1912,7 +1975,7 @@ namespace HVACMultiSpeedHeatPump {
 					if ( MSHeatPump( MSHeatPumpNum ).SuppHeatCoilType == Coil_HeatingWater ) {
 						SimulateWaterCoilComponents( MSHeatPump( MSHeatPumpNum ).SuppHeatCoilName, FirstHVACIteration, MSHeatPump( MSHeatPumpNum ).SuppHeatCoilNum );
 
-						CoilMaxVolFlowRate = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", MSHeatPump( MSHeatPumpNum ).SuppHeatCoilName, ErrorsFound );
+						CoilMaxVolFlowRate = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", MSHeatPump( MSHeatPumpNum ).SuppHeatCoilName, InitMSHeatPumpErrorsFound );
 						if ( CoilMaxVolFlowRate != AutoSize ) {
 							rho = GetDensityGlycol( PlantLoop( MSHeatPump( MSHeatPumpNum ).SuppLoopNum ).FluidName, CWInitConvTemp, PlantLoop( MSHeatPump( MSHeatPumpNum ).SuppLoopNum ).FluidIndex, RoutineName );
 							MSHeatPump( MSHeatPumpNum ).MaxSuppCoilFluidFlow = CoilMaxVolFlowRate * rho;
@@ -1922,7 +1985,7 @@ namespace HVACMultiSpeedHeatPump {
 					if ( MSHeatPump( MSHeatPumpNum ).SuppHeatCoilType == Coil_HeatingSteam ) {
 
 						SimulateSteamCoilComponents( MSHeatPump( MSHeatPumpNum ).SuppHeatCoilName, FirstHVACIteration, MSHeatPump( MSHeatPumpNum ).SuppHeatCoilNum, 1.0, QActual ); //QCoilReq, simulate any load > 0 to get max capacity of steam coil
-						CoilMaxVolFlowRate = GetCoilMaxSteamFlowRate( MSHeatPump( MSHeatPumpNum ).SuppHeatCoilNum, ErrorsFound );
+						CoilMaxVolFlowRate = GetCoilMaxSteamFlowRate( MSHeatPump( MSHeatPumpNum ).SuppHeatCoilNum, InitMSHeatPumpErrorsFound );
 
 						if ( CoilMaxVolFlowRate != AutoSize ) {
 							SteamIndex = 0; // Function GetSatDensityRefrig will look up steam index if 0 is passed
@@ -2124,8 +2187,8 @@ namespace HVACMultiSpeedHeatPump {
 		// Check availability of DX coils
 		if ( GetCurrentScheduleValue( MSHeatPump( MSHeatPumpNum ).AvaiSchedPtr ) > 0.0 ) {
 			if ( MSHeatPump( MSHeatPumpNum ).HeatCoolMode == CoolingMode ) {
-				CoilAvailSchPtr = GetDXCoilAvailSchPtr( "Coil:Cooling:DX:MultiSpeed", MSHeatPump( MSHeatPumpNum ).DXCoolCoilName, ErrorsFound, MSHeatPump( MSHeatPumpNum ).DXCoolCoilIndex );
-				if ( ErrorsFound ) {
+				CoilAvailSchPtr = GetDXCoilAvailSchPtr( "Coil:Cooling:DX:MultiSpeed", MSHeatPump( MSHeatPumpNum ).DXCoolCoilName, InitMSHeatPumpErrorsFound, MSHeatPump( MSHeatPumpNum ).DXCoolCoilIndex );
+				if ( InitMSHeatPumpErrorsFound ) {
 					ShowFatalError( "InitMSHeatPump, The previous error causes termination." );
 				}
 				if ( GetCurrentScheduleValue( CoilAvailSchPtr ) == 0.0 ) {
@@ -2140,8 +2203,8 @@ namespace HVACMultiSpeedHeatPump {
 				}
 			}
 			if ( MSHeatPump( MSHeatPumpNum ).HeatCoolMode == HeatingMode && MSHeatPump( MSHeatPumpNum ).HeatCoilType == MultiSpeedHeatingCoil ) {
-				CoilAvailSchPtr = GetDXCoilAvailSchPtr( "Coil:Heating:DX:MultiSpeed", MSHeatPump( MSHeatPumpNum ).DXHeatCoilName, ErrorsFound, MSHeatPump( MSHeatPumpNum ).DXHeatCoilIndex );
-				if ( ErrorsFound ) {
+				CoilAvailSchPtr = GetDXCoilAvailSchPtr( "Coil:Heating:DX:MultiSpeed", MSHeatPump( MSHeatPumpNum ).DXHeatCoilName, InitMSHeatPumpErrorsFound, MSHeatPump( MSHeatPumpNum ).DXHeatCoilIndex );
+				if ( InitMSHeatPumpErrorsFound ) {
 					ShowFatalError( "InitMSHeatPump, The previous error causes termination." );
 				}
 				if ( GetCurrentScheduleValue( CoilAvailSchPtr ) == 0.0 ) {
@@ -2248,7 +2311,7 @@ namespace HVACMultiSpeedHeatPump {
 
 				//     simulate steam coil to find operating capacity
 				SimulateSteamCoilComponents( MSHeatPump( MSHeatPumpNum ).SuppHeatCoilName, FirstHVACIteration, MSHeatPump( MSHeatPumpNum ).SuppHeatCoilNum, 1.0, QActual ); //QCoilReq, simulate any load > 0 to get max capacity of steam coil
-				MSHeatPump( MSHeatPumpNum ).DesignSuppHeatingCapacity = GetSteamCoilCapacity( "Coil:Heating:Steam", MSHeatPump( MSHeatPumpNum ).SuppHeatCoilName, ErrorsFound );
+				MSHeatPump( MSHeatPumpNum ).DesignSuppHeatingCapacity = GetSteamCoilCapacity( "Coil:Heating:Steam", MSHeatPump( MSHeatPumpNum ).SuppHeatCoilName, InitMSHeatPumpErrorsFound );
 
 			} // from IF(MSHeatPump(MSHeatPumpNum)%SuppHeatCoilType == Coil_HeatingSteam) THEN
 		} // from IF( FirstHVACIteration ) THEN
@@ -2469,8 +2532,6 @@ namespace HVACMultiSpeedHeatPump {
 		Real64 OutsideDryBulbTemp; // Outside air temperature at external node height
 		Real64 QCoilActual; // coil load actually delivered returned to calling component
 		int i; // Speed index
-		static int ErrCountCyc( 0 ); // Counter used to minimize the occurrence of output warnings
-		static int ErrCountVar( 0 ); // Counter used to minimize the occurrence of output warnings
 
 		// FLOW
 		SupHeaterLoad = 0.0;
@@ -2568,7 +2629,7 @@ namespace HVACMultiSpeedHeatPump {
 			if ( ( QZnReq > 0.0 && QZnReq <= LowOutput ) || ( QZnReq < 0.0 && QZnReq >= LowOutput ) ) {
 				SpeedRatio = 0.0;
 				SpeedNum = 1;
-				SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, PartLoadFrac, MSHPCyclingResidual, 0.0, 1.0, Par );
+				SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, PartLoadFrac, MSHPCyclingResidual, 0.0, 1.0, Par, "ControlMSHPOutput" );
 				if ( SolFla == -1 ) {
 					if ( ! WarmupFlag ) {
 						if ( ErrCountCyc == 0 ) {
@@ -2605,7 +2666,7 @@ namespace HVACMultiSpeedHeatPump {
 					}
 				}
 				Par( 8 ) = SpeedNum;
-				SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, SpeedRatio, MSHPVarSpeedResidual, 0.0, 1.0, Par );
+				SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, SpeedRatio, MSHPVarSpeedResidual, 0.0, 1.0, Par, "ControlMSHPOutput" );
 				if ( SolFla == -1 ) {
 					if ( ! WarmupFlag ) {
 						if ( ErrCountVar == 0 ) {
@@ -2642,7 +2703,7 @@ namespace HVACMultiSpeedHeatPump {
 					CalcMSHeatPump( MSHeatPumpNum, FirstHVACIteration, CompOp, 1, 0.0, 1.0, LowOutput, QZnReq, OnOffAirFlowRatio, SupHeaterLoad );
 					SpeedRatio = 0.0;
 					if ( ( QZnReq > 0.0 && QZnReq <= LowOutput ) || ( QZnReq < 0.0 && QZnReq >= LowOutput ) ) {
-						SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, PartLoadFrac, MSHPCyclingResidual, 0.0, 1.0, Par );
+						SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, PartLoadFrac, MSHPCyclingResidual, 0.0, 1.0, Par, "ControlMSHPOutput" );
 						if ( SolFla == -1 ) {
 							if ( ! WarmupFlag ) {
 								if ( ErrCountCyc == 0 ) {
@@ -2672,7 +2733,7 @@ namespace HVACMultiSpeedHeatPump {
 						CalcMSHeatPump( MSHeatPumpNum, FirstHVACIteration, CompOp, SpeedNum, 1.0, 1.0, FullOutput, QZnReq, OnOffAirFlowRatio, SupHeaterLoad );
 						if ( ( QZnReq > 0.0 && QZnReq <= FullOutput ) || ( QZnReq < 0.0 && QZnReq >= FullOutput ) ) {
 							Par( 8 ) = SpeedNum;
-							SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, SpeedRatio, MSHPVarSpeedResidual, 0.0, 1.0, Par );
+							SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, SpeedRatio, MSHPVarSpeedResidual, 0.0, 1.0, Par, "ControlMSHPOutput" );
 							if ( SolFla == -1 ) {
 								if ( ! WarmupFlag ) {
 									if ( ErrCountVar == 0 ) {
@@ -3493,7 +3554,6 @@ namespace HVACMultiSpeedHeatPump {
 		Array1D< Real64 > Par( 3 );
 		int SolFlag;
 
-		static std::string HeatCoilName;
 		int HeatCoilType;
 		int HeatCoilNum;
 		Real64 MaxCoilFluidFlow;
@@ -3565,7 +3625,7 @@ namespace HVACMultiSpeedHeatPump {
 							Par( 2 ) = 0.0;
 						}
 						Par( 3 ) = HeatingLoad;
-						SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, HotWaterMdot, HotWaterCoilResidual, MinWaterFlow, MaxHotWaterFlow, Par );
+						SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, HotWaterMdot, HotWaterCoilResidual, MinWaterFlow, MaxHotWaterFlow, Par, "CalcNonDXHeatingCoils" );
 						if ( SolFlag == -1 ) {
 							if ( MSHeatPump( MSHeatPumpNum ).HotWaterCoilMaxIterIndex == 0 ) {
 								ShowWarningMessage( "CalcNonDXHeatingCoils: Hot water coil control failed for " + CurrentModuleObject + "=\"" + MSHeatPump( MSHeatPumpNum ).Name + "\"" );
@@ -395,6 +395,11 @@ namespace HVACMultiSpeedHeatPump {
 
 	// Functions
 
+	// Clears the global data in HVACMultiSpeedHeatPump.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimMSHeatPump(
 		std::string const & CompName, // Name of the unitary engine driven heat pump system
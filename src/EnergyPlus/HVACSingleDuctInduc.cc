@@ -156,8 +156,50 @@ namespace HVACSingleDuctInduc {
 	// Object Data
 	Array1D< IndUnitData > IndUnit;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int NumAlphas( 0 ); // Number of Alphas for each GetObjectItem call
+		int NumNumbers( 0 ); // Number of Numbers for each GetObjectItem call
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool MyOneTimeFlag( true );
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool MySizeFlag;
+		Array1D_bool MyPlantScanFlag;
+		bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
+		int CoilWaterInletNode( 0 );
+		int CoilWaterOutletNode( 0 );
+	}
+
 	// Functions
 
+	// Clears the global data in HVACSingleDuctInduc.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumIndUnits = 0;
+		NumFourPipes = 0;
+		CheckEquipName.deallocate();
+		GetIUInputFlag = true;
+		IndUnit.deallocate();
+		NumAlphas = 0;
+		NumNumbers = 0;
+		TotalArgs = 0;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		MyEnvrnFlag.deallocate();
+		MySizeFlag.deallocate();
+		MyPlantScanFlag.deallocate();
+		ZoneEquipmentListChecked = false;
+		CoilWaterInletNode = 0;
+		CoilWaterOutletNode = 0;
+	}
+
 	void
 	SimIndUnit(
 		std::string const & CompName, // name of the terminal unit
@@ -326,12 +368,8 @@ namespace HVACSingleDuctInduc {
 		Array1D< Real64 > Numbers; // Numeric input items for object
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int NumAlphas( 0 ); // Number of Alphas for each GetObjectItem call
-		static int NumNumbers( 0 ); // Number of Numbers for each GetObjectItem call
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 		//  certain object in the input file
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int CtrlZone; // controlled zome do loop index
@@ -554,12 +592,7 @@ namespace HVACSingleDuctInduc {
 		int ColdConNode; // cold water control node  number
 		Real64 IndRat; // unit induction ratio
 		Real64 RhoAir; // air density at outside pressure and standard temperature and humidity
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool MySizeFlag;
-		static Array1D_bool MyPlantScanFlag;
 
-		static bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
 		int Loop; // Loop checking control variable
 		Real64 rho; // local fluid density
 		int HWOutletNode; // local node index for hot water coil's outlet node
@@ -738,8 +771,6 @@ namespace HVACSingleDuctInduc {
 		Real64 DesPriVolFlow;
 		Real64 RhoAir;
 		Real64 CpAir;
-		static int CoilWaterInletNode( 0 );
-		static int CoilWaterOutletNode( 0 );
 		bool ErrorsFound;
 		Real64 Cp; // local fluid specific heat
 		Real64 rho; // local fluid density
@@ -1100,7 +1131,7 @@ namespace HVACSingleDuctInduc {
 					Par( 6 ) = QPriOnly;
 					Par( 7 ) = PowerMet;
 					ErrTolerance = IndUnit( IUNum ).HotControlOffset;
-					SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, HWFlow, FourPipeIUHeatingResidual, MinHotWaterFlow, MaxHotWaterFlow, Par );
+					SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, HWFlow, FourPipeIUHeatingResidual, MinHotWaterFlow, MaxHotWaterFlow, Par, "SimFourPipeIndUnit" );
 					if ( SolFlag == -1 ) {
 						if ( IndUnit( IUNum ).HWCoilFailNum1 == 0 ) {
 							ShowWarningMessage( "SimFourPipeIndUnit: Hot water coil control failed for " + IndUnit( IUNum ).UnitType + "=\"" + IndUnit( IUNum ).Name + "\"" );
@@ -1136,7 +1167,7 @@ namespace HVACSingleDuctInduc {
 					Par( 6 ) = QPriOnly;
 					Par( 7 ) = PowerMet;
 					ErrTolerance = IndUnit( IUNum ).ColdControlOffset;
-					SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, CWFlow, FourPipeIUCoolingResidual, MinColdWaterFlow, MaxColdWaterFlow, Par );
+					SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, CWFlow, FourPipeIUCoolingResidual, MinColdWaterFlow, MaxColdWaterFlow, Par, "SimFourPipeIndUnit" );
 					if ( SolFlag == -1 ) {
 						if ( IndUnit( IUNum ).CWCoilFailNum1 == 0 ) {
 							ShowWarningMessage( "SimFourPipeIndUnit: Cold water coil control failed for " + IndUnit( IUNum ).UnitType + "=\"" + IndUnit( IUNum ).Name + "\"" );
@@ -200,6 +200,11 @@ namespace HVACSingleDuctInduc {
 
 	// Functions
 
+	// Clears the global data in HVACSingleDuctInduc.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimIndUnit(
 		std::string const & CompName, // name of the terminal unit
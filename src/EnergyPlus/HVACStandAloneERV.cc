@@ -172,6 +172,23 @@ namespace HVACStandAloneERV {
 	// Object Data
 	Array1D< StandAloneERVData > StandAloneERV;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetStandAloneERVErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		int ControlledZoneNum( 0 ); // used to find zone with humidistat
+		bool ZoneNodeFound( false ); // used to find zone with humidistat
+		bool HStatFound( false ); // used to find zone with humidistat
+		Array1D_bool InitStandAloneERVMySizeFlag;
+		bool MyOneTimeFlag( true );
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool MyZoneEqFlag; // used to set up zone equipment availability managers
+		bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
+	}
+
 	// Functions
 
 	void
@@ -182,6 +199,15 @@ namespace HVACStandAloneERV {
 		MySizeFlag.deallocate();
 		CheckEquipName.deallocate();
 		StandAloneERV.deallocate();
+		GetStandAloneERVErrorsFound = false;
+		ControlledZoneNum = 0;
+		ZoneNodeFound = false;
+		HStatFound = false;
+		InitStandAloneERVMySizeFlag.deallocate();
+		MyOneTimeFlag = true;
+		MyEnvrnFlag.deallocate();
+		MyZoneEqFlag.deallocate();
+		ZoneEquipmentListChecked = false;
 	}
 
 	void
@@ -352,7 +378,6 @@ namespace HVACStandAloneERV {
 		int MaxAlphas; // Max between the two objects gotten here
 		int MaxNumbers; // Max between the two objects gotten here
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int NumERVCtrlrs; // total number of CONTROLLER:STAND ALONE ERV objects
@@ -362,9 +387,6 @@ namespace HVACStandAloneERV {
 		int NodeNumber; // used to find zone with humidistat
 		int HStatZoneNum; // used to find zone with humidistat
 		int NumHstatZone; // index to humidity controlled zones
-		static int ControlledZoneNum( 0 ); // used to find zone with humidistat
-		static bool ZoneNodeFound( false ); // used to find zone with humidistat
-		static bool HStatFound( false ); // used to find zone with humidistat
 		bool errFlag; // Error flag used in mining calls
 		Real64 SAFanVolFlowRate; // supply air fan volumetric flow rate [m3/s]
 		Real64 EAFanVolFlowRate; // exhaust air fan volumetric flow rate [m3/s]
@@ -409,7 +431,7 @@ namespace HVACStandAloneERV {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), StandAloneERV, StandAloneERVNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			StandAloneERV( StandAloneERVNum ).Name = Alphas( 1 );
@@ -421,13 +443,13 @@ namespace HVACStandAloneERV {
 				StandAloneERV( StandAloneERVNum ).SchedPtr = GetScheduleIndex( Alphas( 2 ) ); // convert schedule name to pointer
 				if ( StandAloneERV( StandAloneERVNum ).SchedPtr == 0 ) {
 					ShowSevereError( CurrentModuleObject + ", \"" + StandAloneERV( StandAloneERVNum ).Name + "\" " + cAlphaFields( 2 ) + " not found = " + Alphas( 2 ) );
-					ErrorsFound = true;
+					GetStandAloneERVErrorsFound = true;
 				}
 			}
 
 			VerifyName( Alphas( 3 ), StandAloneERV, &StandAloneERVData::HeatExchangerName, StandAloneERVNum - 1, IsNotOK, IsBlank, "HeatExchanger:AirToAir:SensibleAndLatent" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 				if ( IsBlank ) Alphas( 3 ) = "xxxxx";
 			}
 			StandAloneERV( StandAloneERVNum ).HeatExchangerName = Alphas( 3 );
@@ -435,28 +457,28 @@ namespace HVACStandAloneERV {
 			StandAloneERV( StandAloneERVNum ).HeatExchangerTypeNum = GetHeatExchangerObjectTypeNum( StandAloneERV( StandAloneERVNum ).HeatExchangerName, errFlag );
 			if ( errFlag ) {
 				ShowContinueError( "... occurs in " + CurrentModuleObject + " \"" + StandAloneERV( StandAloneERVNum ).Name + "\"" );
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 			}
 
 			errFlag = false;
 			HXSupAirFlowRate = GetGenericSupplyAirFlowRate( StandAloneERV( StandAloneERVNum ).HeatExchangerName, errFlag );
 			if ( errFlag ) {
 				ShowContinueError( "... occurs in " + CurrentModuleObject + " \"" + StandAloneERV( StandAloneERVNum ).Name + "\"" );
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 			}
 			StandAloneERV( StandAloneERVNum ).DesignHXVolFlowRate = HXSupAirFlowRate;
 
 			StandAloneERV( StandAloneERVNum ).SupplyAirFanName = Alphas( 4 );
 			VerifyName( Alphas( 4 ), StandAloneERV, &StandAloneERVData::SupplyAirFanName, StandAloneERVNum - 1, IsNotOK, IsBlank, "Fan:OnOff" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 				if ( IsBlank ) Alphas( 4 ) = "xxxxx";
 			}
 
 			errFlag = false;
 			GetFanType( StandAloneERV( StandAloneERVNum ).SupplyAirFanName, SAFanTypeNum, errFlag, CurrentModuleObject, StandAloneERV( StandAloneERVNum ).Name );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 			}
 			StandAloneERV( StandAloneERVNum ).SupplyAirFanType_Num = SAFanTypeNum;
 
@@ -464,7 +486,7 @@ namespace HVACStandAloneERV {
 			StandAloneERV( StandAloneERVNum ).SupplyAirFanSchPtr = GetFanAvailSchPtr( cFanTypes( SAFanTypeNum ), StandAloneERV( StandAloneERVNum ).SupplyAirFanName, errFlag );
 			if ( errFlag ) {
 				ShowContinueError( "... occurs in " + CurrentModuleObject + " \"" + StandAloneERV( StandAloneERVNum ).Name + "\"" );
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 			}
 
 			GetFanIndex( StandAloneERV( StandAloneERVNum ).SupplyAirFanName, StandAloneERV( StandAloneERVNum ).SupplyAirFanIndex, errFlag, CurrentModuleObject + " \"" + StandAloneERV( StandAloneERVNum ).Name + "\"" );
@@ -475,14 +497,14 @@ namespace HVACStandAloneERV {
 			SAFanVolFlowRate = GetFanDesignVolumeFlowRate( cFanTypes( SAFanTypeNum ), StandAloneERV( StandAloneERVNum ).SupplyAirFanName, errFlag );
 			if ( errFlag ) {
 				ShowContinueError( "... occurs in " + CurrentModuleObject + " =" + StandAloneERV( StandAloneERVNum ).Name );
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 			}
 			StandAloneERV( StandAloneERVNum ).DesignSAFanVolFlowRate = SAFanVolFlowRate;
 
 			StandAloneERV( StandAloneERVNum ).ExhaustAirFanName = Alphas( 5 );
 			VerifyName( Alphas( 5 ), StandAloneERV, &StandAloneERVData::ExhaustAirFanName, StandAloneERVNum - 1, IsNotOK, IsBlank, "Fan:OnOff Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 				if ( IsBlank ) Alphas( 5 ) = "xxxxx";
 			}
 			errFlag = false;
@@ -493,7 +515,7 @@ namespace HVACStandAloneERV {
 				StandAloneERV( StandAloneERVNum ).ExhaustAirFanSchPtr = GetFanAvailSchPtr( cFanTypes( EAFanTypeNum ), StandAloneERV( StandAloneERVNum ).ExhaustAirFanName, errFlag );
 				GetFanIndex( StandAloneERV( StandAloneERVNum ).ExhaustAirFanName, StandAloneERV( StandAloneERVNum ).ExhaustAirFanIndex, errFlag, CurrentModuleObject + " \"" + StandAloneERV( StandAloneERVNum ).Name + "\"" );
 			} else {
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 			}
 
 			//Set the EA Design Fan Volume Flow Rate
@@ -502,7 +524,7 @@ namespace HVACStandAloneERV {
 			EAFanVolFlowRate = GetFanDesignVolumeFlowRate( cFanTypes( EAFanTypeNum ), StandAloneERV( StandAloneERVNum ).ExhaustAirFanName, errFlag );
 			if ( errFlag ) {
 				ShowContinueError( "... occurs in " + CurrentModuleObject + " =" + StandAloneERV( StandAloneERVNum ).Name );
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 			}
 			StandAloneERV( StandAloneERVNum ).DesignEAFanVolFlowRate = EAFanVolFlowRate;
 
@@ -511,7 +533,7 @@ namespace HVACStandAloneERV {
 			StandAloneERV( StandAloneERVNum ).ExhaustAirInletNode = GetHXSecondaryInletNode( StandAloneERV( StandAloneERVNum ).HeatExchangerName, errFlag );
 			if ( errFlag ) {
 				ShowContinueError( "... occurs in " + CurrentModuleObject + " =" + StandAloneERV( StandAloneERVNum ).Name );
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 			}
 
 			errFlag = false;
@@ -519,20 +541,20 @@ namespace HVACStandAloneERV {
 			StandAloneERV( StandAloneERVNum ).ExhaustAirOutletNode = GetFanOutletNode( cFanTypes( EAFanTypeNum ), StandAloneERV( StandAloneERVNum ).ExhaustAirFanName, errFlag );
 			if ( errFlag ) {
 				ShowContinueError( "... occurs in " + CurrentModuleObject + " =" + StandAloneERV( StandAloneERVNum ).Name );
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 			}
 
-			StandAloneERV( StandAloneERVNum ).SupplyAirInletNode = GetOnlySingleNode( NodeID( StandAloneERV( StandAloneERVNum ).SupplyAirInletNode ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsParent );
-			StandAloneERV( StandAloneERVNum ).SupplyAirOutletNode = GetOnlySingleNode( NodeID( StandAloneERV( StandAloneERVNum ).SupplyAirOutletNode ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsParent );
-			StandAloneERV( StandAloneERVNum ).ExhaustAirInletNode = GetOnlySingleNode( NodeID( StandAloneERV( StandAloneERVNum ).ExhaustAirInletNode ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 2, ObjectIsParent );
-			StandAloneERV( StandAloneERVNum ).ExhaustAirOutletNode = GetOnlySingleNode( NodeID( StandAloneERV( StandAloneERVNum ).ExhaustAirOutletNode ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_ReliefAir, 2, ObjectIsParent );
+			StandAloneERV( StandAloneERVNum ).SupplyAirInletNode = GetOnlySingleNode( NodeID( StandAloneERV( StandAloneERVNum ).SupplyAirInletNode ), GetStandAloneERVErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsParent );
+			StandAloneERV( StandAloneERVNum ).SupplyAirOutletNode = GetOnlySingleNode( NodeID( StandAloneERV( StandAloneERVNum ).SupplyAirOutletNode ), GetStandAloneERVErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsParent );
+			StandAloneERV( StandAloneERVNum ).ExhaustAirInletNode = GetOnlySingleNode( NodeID( StandAloneERV( StandAloneERVNum ).ExhaustAirInletNode ), GetStandAloneERVErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 2, ObjectIsParent );
+			StandAloneERV( StandAloneERVNum ).ExhaustAirOutletNode = GetOnlySingleNode( NodeID( StandAloneERV( StandAloneERVNum ).ExhaustAirOutletNode ), GetStandAloneERVErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_ReliefAir, 2, ObjectIsParent );
 
 			//   Check that supply air inlet node is an OA node
 			if ( ! CheckOutAirNodeNumber( StandAloneERV( StandAloneERVNum ).SupplyAirInletNode ) ) {
 				ShowSevereError( "For " + CurrentModuleObject + " \"" + StandAloneERV( StandAloneERVNum ).Name + "\"" );
 				ShowContinueError( " Node name of supply air inlet node not valid Outdoor Air Node = " + NodeID( StandAloneERV( StandAloneERVNum ).SupplyAirInletNode ) );
 				ShowContinueError( "...does not appear in an OutdoorAir:NodeList or as an OutdoorAir:Node." );
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 			}
 
 			//   Check to make sure inlet and exhaust nodes are listed in a ZoneHVAC:EquipmentConnections object
@@ -562,13 +584,13 @@ namespace HVACStandAloneERV {
 				ShowSevereError( "For " + CurrentModuleObject + " \"" + StandAloneERV( StandAloneERVNum ).Name + "\"" );
 				ShowContinueError( "... Node name of supply air outlet node does not appear in a ZoneHVAC:EquipmentConnections object." );
 				ShowContinueError( "... Supply air outlet node = " + NodeID( StandAloneERV( StandAloneERVNum ).SupplyAirOutletNode ) );
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 			}
 			if ( ! ZoneExhaustNodeFound ) {
 				ShowSevereError( "For " + CurrentModuleObject + " \"" + StandAloneERV( StandAloneERVNum ).Name + "\"" );
 				ShowContinueError( "... Node name of exhaust air inlet node does not appear in a ZoneHVAC:EquipmentConnections object." );
 				ShowContinueError( "... Exhaust air inlet node = " + NodeID( StandAloneERV( StandAloneERVNum ).ExhaustAirInletNode ) );
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 			}
 			//   If nodes are found, make sure they are in the same zone
 			if ( ZoneInletNodeFound && ZoneExhaustNodeFound ) {
@@ -579,7 +601,7 @@ namespace HVACStandAloneERV {
 					ShowContinueError( "... ZoneHVAC:EquipmentConnections Zone Name = " + ZoneEquipConfig( ZoneInletCZN ).ZoneName );
 					ShowContinueError( "... Exhaust air inlet node = " + NodeID( StandAloneERV( StandAloneERVNum ).ExhaustAirInletNode ) );
 					ShowContinueError( "... ZoneHVAC:EquipmentConnections Zone Name = " + ZoneEquipConfig( ZoneExhaustCZN ).ZoneName );
-					ErrorsFound = true;
+					GetStandAloneERVErrorsFound = true;
 				}
 			}
 
@@ -593,14 +615,14 @@ namespace HVACStandAloneERV {
 				VerifyName( Alphas( 6 ), StandAloneERV, &StandAloneERVData::ControllerName, StandAloneERVNum - 1, IsNotOK, IsBlank, "ZoneHVAC:EnergyRecoveryVentilator:Controller Name" );
 				StandAloneERV( StandAloneERVNum ).ControllerNameDefined = true;
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetStandAloneERVErrorsFound = true;
 					if ( IsBlank ) Alphas( 6 ) = "xxxxx";
 					StandAloneERV( StandAloneERVNum ).ControllerNameDefined = false;
 				}
 
 				if ( GetObjectItemNum( "ZoneHVAC:EnergyRecoveryVentilator:Controller", StandAloneERV( StandAloneERVNum ).ControllerName ) <= 0 ) {
 					ShowSevereError( CurrentModuleObject + " controller type ZoneHVAC:EnergyRecoveryVentilator:Controller not found = " + Alphas( 6 ) );
-					ErrorsFound = true;
+					GetStandAloneERVErrorsFound = true;
 					StandAloneERV( StandAloneERVNum ).ControllerNameDefined = false;
 				}
 			}
@@ -650,19 +672,19 @@ namespace HVACStandAloneERV {
 				if ( StandAloneERV( StandAloneERVNum ).SupplyAirVolFlow <= 0.0 ) {
 					ShowSevereError( CurrentModuleObject + " = " + StandAloneERV( StandAloneERVNum ).Name + " has a " + cNumericFields( 1 ) + " <= 0.0, it must be >0.0" );
 					ShowContinueError( "... Entered value=" + RoundSigDigits( StandAloneERV( StandAloneERVNum ).SupplyAirVolFlow, 2 ) );
-					ErrorsFound = true;
+					GetStandAloneERVErrorsFound = true;
 				}
 			} else {
 				if ( StandAloneERV( StandAloneERVNum ).AirVolFlowPerFloorArea == 0.0 && StandAloneERV( StandAloneERVNum ).AirVolFlowPerOccupant == 0.0 ) {
 					ShowSevereError( CurrentModuleObject + " \"" + StandAloneERV( StandAloneERVNum ).Name + "\"" );
 					ShowContinueError( "... Autosizing " + cNumericFields( 1 ) + " requires at least one input for " + cNumericFields( 3 ) + " or " + cNumericFields( 4 ) + '.' );
-					ErrorsFound = true;
+					GetStandAloneERVErrorsFound = true;
 				}
 				// both inputs must be autosized
 				if ( StandAloneERV( StandAloneERVNum ).ExhaustAirVolFlow != AutoSize ) {
 					ShowSevereError( CurrentModuleObject + " \"" + StandAloneERV( StandAloneERVNum ).Name + "\"" );
 					ShowContinueError( "... When autosizing, " + cNumericFields( 1 ) + " and " + cNumericFields( 2 ) + " must both be autosized." );
-					ErrorsFound = true;
+					GetStandAloneERVErrorsFound = true;
 				}
 			}
 
@@ -679,18 +701,18 @@ namespace HVACStandAloneERV {
 				if ( StandAloneERV( StandAloneERVNum ).ExhaustAirVolFlow <= 0.0 ) {
 					ShowSevereError( CurrentModuleObject + " = " + StandAloneERV( StandAloneERVNum ).Name + " has an " + cNumericFields( 2 ) + " <= 0.0, it must be >0.0" );
 					ShowContinueError( "... Entered value=" + RoundSigDigits( StandAloneERV( StandAloneERVNum ).ExhaustAirVolFlow, 2 ) );
-					ErrorsFound = true;
+					GetStandAloneERVErrorsFound = true;
 				}
 			} else {
 				if ( StandAloneERV( StandAloneERVNum ).AirVolFlowPerFloorArea == 0.0 && StandAloneERV( StandAloneERVNum ).AirVolFlowPerOccupant == 0.0 ) {
 					ShowSevereError( CurrentModuleObject + " \"" + StandAloneERV( StandAloneERVNum ).Name + "\"" );
 					ShowContinueError( "... Autosizing " + cNumericFields( 2 ) + " requires at least one input for " + cNumericFields( 3 ) + " or " + cNumericFields( 4 ) + '.' );
-					ErrorsFound = true;
+					GetStandAloneERVErrorsFound = true;
 				}
 				if ( StandAloneERV( StandAloneERVNum ).SupplyAirVolFlow != AutoSize ) {
 					ShowSevereError( CurrentModuleObject + " \"" + StandAloneERV( StandAloneERVNum ).Name + "\"" );
 					ShowContinueError( "... When autosizing, " + cNumericFields( 1 ) + " and " + cNumericFields( 2 ) + " must both be autosized." );
-					ErrorsFound = true;
+					GetStandAloneERVErrorsFound = true;
 				}
 			}
 
@@ -714,18 +736,18 @@ namespace HVACStandAloneERV {
 			// Verify HX name in Stand Alone ERV object matches name of valid HX object
 			if ( GetObjectItemNum( "HeatExchanger:AirToAir:SensibleAndLatent", StandAloneERV( StandAloneERVNum ).HeatExchangerName ) <= 0 ) {
 				ShowSevereError( CurrentModuleObject + " heat exchanger type HeatExchanger:AirToAir:SensibleAndLatent not found = " + StandAloneERV( StandAloneERVNum ).HeatExchangerName );
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 			}
 			// Verify supply air fan name in Stand Alone ERV object matches name of valid fan object
 			if ( GetObjectItemNum( "Fan:OnOff", StandAloneERV( StandAloneERVNum ).SupplyAirFanName ) <= 0 ) {
 				ShowSevereError( CurrentModuleObject + " supply fan type Fan:OnOff not found = " + StandAloneERV( StandAloneERVNum ).SupplyAirFanName );
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 			}
 
 			// Verify exhaust air fan name in Stand Alone ERV object matches name of valid fan object
 			if ( GetObjectItemNum( "Fan:OnOff", StandAloneERV( StandAloneERVNum ).ExhaustAirFanName ) <= 0 ) {
 				ShowSevereError( CurrentModuleObject + " exhaust fan type Fan:OnOff not found = " + StandAloneERV( StandAloneERVNum ).ExhaustAirFanName );
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 			}
 
 		}
@@ -741,7 +763,7 @@ namespace HVACStandAloneERV {
 			IsBlank = false;
 			CheckOAControllerName( Alphas( 1 ), ERVControllerNum, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 
@@ -757,7 +779,7 @@ namespace HVACStandAloneERV {
 				StandAloneERV( WhichERV ).ControllerIndex = OutAirNum;
 			} else {
 				ShowSevereError( "GetERVController: Could not find ZoneHVAC:EnergyRecoveryVentilator with " + cAlphaFields( 1 ) + " = \"" + Alphas( 1 ) + "\"" );
-				ErrorsFound = true;
+				GetStandAloneERVErrorsFound = true;
 				AirFlowRate = -1000.0;
 			}
 			thisOAController.MaxOA = AirFlowRate;
@@ -809,7 +831,7 @@ namespace HVACStandAloneERV {
 				if ( GetCurveIndex( Alphas( 2 ) ) == 0 ) {
 					ShowSevereError( CurrentModuleObject + " \"" + Alphas( 1 ) + "\"" );
 					ShowContinueError( "..." + cAlphaFields( 2 ) + " not found:" + Alphas( 2 ) );
-					ErrorsFound = true;
+					GetStandAloneERVErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal types are Quadratic and Cubic
 					{ auto const SELECT_CASE_var( GetCurveType( GetCurveIndex( Alphas( 2 ) ) ) );
@@ -821,7 +843,7 @@ namespace HVACStandAloneERV {
 					} else {
 						ShowSevereError( CurrentModuleObject + " \"" + Alphas( 1 ) + "\"" );
 						ShowContinueError( "...illegal " + cAlphaFields( 2 ) + " type for this object = " + GetCurveType( GetCurveIndex( Alphas( 2 ) ) ) );
-						ErrorsFound = true;
+						GetStandAloneERVErrorsFound = true;
 					}}
 				}
 			}
@@ -904,7 +926,7 @@ namespace HVACStandAloneERV {
 						ShowContinueError( "... Did not find Air Node (Zone with Humidistat)" );
 						ShowContinueError( "... Specified " + cAlphaFields( 7 ) + " = " + Alphas( 7 ) );
 						ShowContinueError( "... A ZoneHVAC:EquipmentConnections object must be specified for this zone." );
-						ErrorsFound = true;
+						GetStandAloneERVErrorsFound = true;
 					} else {
 						for ( NumHstatZone = 1; NumHstatZone <= NumHumidityControlZones; ++NumHstatZone ) {
 							if ( HumidityControlZone( NumHstatZone ).ActualZoneNum != HStatZoneNum ) continue;
@@ -915,14 +937,14 @@ namespace HVACStandAloneERV {
 							ShowSevereError( CurrentModuleObject + " \"" + Alphas( 1 ) + "\"" );
 							ShowContinueError( "... Did not find zone humidistat" );
 							ShowContinueError( "... A ZoneControl:Humidistat object must be specified for this zone." );
-							ErrorsFound = true;
+							GetStandAloneERVErrorsFound = true;
 						}
 					}
 				} else {
 					ShowSevereError( CurrentModuleObject + " \"" + Alphas( 1 ) + "\"" );
 					ShowContinueError( "... Did not find Air Node (Zone with Humidistat)" );
 					ShowContinueError( "... A ZoneHVAC:EquipmentConnections object must be specified for this zone." );
-					ErrorsFound = true;
+					GetStandAloneERVErrorsFound = true;
 				}
 
 				if ( Numbers( 5 ) <= 0.0 && NumNumbers > 4 ) {
@@ -983,7 +1005,7 @@ namespace HVACStandAloneERV {
 						}
 					}
 				} else {
-					ErrorsFound = true;
+					GetStandAloneERVErrorsFound = true;
 				}
 
 				errFlag = false;
@@ -1003,13 +1025,13 @@ namespace HVACStandAloneERV {
 						}
 					}
 				} else {
-					ErrorsFound = true;
+					GetStandAloneERVErrorsFound = true;
 				}
 			} // IF(WhichERV /= 0)THEN
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetStandAloneERVErrorsFound ) {
 			ShowFatalError( "Errors found in getting ZoneHVAC:EnergyRecoveryVentilator input." );
 		}
 
@@ -1076,7 +1098,6 @@ namespace HVACStandAloneERV {
 		using MixedAir::OAController;
 
 		// Locals
-		static Array1D_bool MySizeFlag;
 
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
@@ -1094,20 +1115,16 @@ namespace HVACStandAloneERV {
 		int ExhInNode; // exhaust air inlet node number
 		int SupInletNode; // supply air inlet node number for Stand Alone ERV 'StandAloneERVNum'
 		Real64 RhoAir; // air density at SupInNode, standard conditions (dry air @ 20C,actual elevation pressure)
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool MyZoneEqFlag; // used to set up zone equipment availability managers
-		static bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
 		int Loop; // loop counter
 
 		// Do the one time initializations
 		if ( MyOneTimeFlag ) {
 
 			MyEnvrnFlag.allocate( NumStandAloneERVs );
-			MySizeFlag.allocate( NumStandAloneERVs );
+			InitStandAloneERVMySizeFlag.allocate( NumStandAloneERVs );
 			MyZoneEqFlag.allocate ( NumStandAloneERVs );
 			MyEnvrnFlag = true;
-			MySizeFlag = true;
+			InitStandAloneERVMySizeFlag = true;
 			MyZoneEqFlag = true;
 			MyOneTimeFlag = false;
 
@@ -1131,9 +1148,9 @@ namespace HVACStandAloneERV {
 			}
 		}
 
-		if ( ! SysSizingCalc && MySizeFlag( StandAloneERVNum ) ) {
+		if ( ! SysSizingCalc && InitStandAloneERVMySizeFlag( StandAloneERVNum ) ) {
 			SizeStandAloneERV( StandAloneERVNum );
-			MySizeFlag( StandAloneERVNum ) = false;
+			InitStandAloneERVMySizeFlag( StandAloneERVNum ) = false;
 		}
 
 		// Do the Begin Environment initializations
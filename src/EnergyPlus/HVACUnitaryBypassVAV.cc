@@ -223,8 +223,63 @@ namespace HVACUnitaryBypassVAV {
 	// Object Data
 	Array1D< CBVAVData > CBVAV;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // First time, input is "gotten"
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool DXErrorsFound( false ); // Set to true if errors in get coil input
+		bool FanErrFlag( false ); // Error flag returned during CALL to GetFanType
+		bool errFlag( false ); // Error flag returned during CALL to mining functions
+		int EquipNum( 0 ); // local do loop index for equipment listed for a zone
+		bool MyOneTimeFlag( true ); // Initialization flag
+		Array1D_bool MyEnvrnFlag; // Used for initializations each begin environment flag
+		Array1D_bool MySizeFlag; // Used for sizing CBVAV inputs one time
+		Array1D_bool MyPlantScanFlag; // Used for initializations plant component for heating coils
+		bool InitCBVAVFanErrFlag( false ); // Error flag returned during CALL to GetFanType
+		bool EMSSetPointCheck( false ); // local temporary
+		bool InitCBVAVErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+	}
+
 	// Functions
 
+	// Clears the global data in HVACUnitaryBypassVAV.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumCBVAV = 0;
+		CompOnMassFlow = 0.0;
+		OACompOnMassFlow = 0.0;
+		CompOffMassFlow = 0.0;
+		OACompOffMassFlow = 0.0;
+		CompOnFlowRatio = 0.0;
+		CompOffFlowRatio = 0.0;
+		FanSpeedRatio = 0.0;
+		BypassDuctFlowFraction = 0.0;
+		PartLoadFrac = 0.0;
+		SaveCompressorPLR = 0.0;
+		TempSteamIn = 100.0;
+		CheckEquipName.deallocate();
+		CBVAV.deallocate();
+		GetInputFlag = true;
+		ErrorsFound = false;
+		DXErrorsFound = false;
+		FanErrFlag = false;
+		errFlag = false;
+		EquipNum = 0;
+		MyOneTimeFlag = true;
+		MyEnvrnFlag.deallocate();
+		MySizeFlag.deallocate();
+		MyPlantScanFlag.deallocate();
+		InitCBVAVFanErrFlag = false;
+		EMSSetPointCheck = false;
+		InitCBVAVErrorsFound = false;
+	}
+
 	void
 	SimUnitaryBypassVAV(
 		std::string const & CompName, // Name of the CBVAV system
@@ -267,7 +322,6 @@ namespace HVACUnitaryBypassVAV {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int CBVAVNum; // Index of CBVAV system being simulated
-		static bool GetInputFlag( true ); // First time, input is "gotten"
 		Real64 OnOffAirFlowRatio; // Ratio of compressor ON airflow to average airflow over timestep
 		Real64 QUnitOut; // Sensible capacity delivered by this air loop system
 		Real64 QZnLoad; // Zone load required by all zones served by this air loop system
@@ -535,14 +589,10 @@ namespace HVACUnitaryBypassVAV {
 		int NumAlphas; // Number of Alphas for each GetObjectItem call
 		int NumNumbers; // Number of Numbers for each GetObjectItem call
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
-		static bool DXErrorsFound( false ); // Set to true if errors in get coil input
 		//unused0509  LOGICAL                        :: FanErrorsFound=.FALSE. ! Set to true if errors in get fan input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		std::string CurrentModuleObject; // Object type for getting and error messages
-		static bool FanErrFlag( false ); // Error flag returned during CALL to GetFanType
-		static bool errFlag( false ); // Error flag returned during CALL to mining functions
 		int FanIndex; // Index to CBVAV's supply air fan
 		Real64 FanVolFlow; // Maximum air volumetric flow rate of fan
 		int AirLoopNum; // Index to air loop served by this system
@@ -562,7 +612,6 @@ namespace HVACUnitaryBypassVAV {
 		Array1D_string cNumericFields( 11 ); // Numeric field names
 		Array1D_bool lAlphaBlanks( 19 ); // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks( 11 ); // Logical array, numeric field input BLANK = .TRUE.
-		static int EquipNum( 0 ); // local do loop index for equipment listed for a zone
 		int HeatCoilInletNodeNum; // Heating coil air inlet node number
 		int HeatCoilOutletNodeNum; // Heating coil air outlet node number
 		int SteamIndex; // steam coil index
@@ -1271,17 +1320,10 @@ namespace HVACUnitaryBypassVAV {
 		int OutNode; // Outlet node number in CBVAV loop
 		int MixerOutsideAirNode; // Outside air node number in CBVAV loop
 		Real64 RhoAir; // Air density at InNode
-		static bool MyOneTimeFlag( true ); // Initialization flag
-		static Array1D_bool MyEnvrnFlag; // Used for initializations each begin environment flag
-		static Array1D_bool MySizeFlag; // Used for sizing CBVAV inputs one time
-		static Array1D_bool MyPlantScanFlag; // Used for initializations plant component for heating coils
 		Real64 QSensUnitOut; // Output of CBVAV system with coils off
 		Real64 OutsideAirMultiplier; // Outside air multiplier schedule (= 1.0 if no schedule)
-		static bool FanErrFlag( false ); // Error flag returned during CALL to GetFanType
 		int FanIndex; // Index to CBVAV's supply air fan
 		std::string CurrentModuleObject; // Object type for error messages
-		static bool EMSSetPointCheck( false ); // local temporary
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		int SteamIndex; // steam coil index
 		Real64 FluidDensity; // steam or water coil fluid density
 		Real64 CoilMaxVolFlowRate; // water or steam max volumetric water flow rate
@@ -1316,11 +1358,11 @@ namespace HVACUnitaryBypassVAV {
 						ShowFatalError( "InitCBVAV: Program terminated for previous conditions." );
 					}
 
-					CBVAV( CBVAVNum ).MaxHeatCoilFluidFlow = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", CBVAV( CBVAVNum ).HeatCoilName, ErrorsFound );
+					CBVAV( CBVAVNum ).MaxHeatCoilFluidFlow = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", CBVAV( CBVAVNum ).HeatCoilName, InitCBVAVErrorsFound );
 
 					if ( CBVAV( CBVAVNum ).MaxHeatCoilFluidFlow > 0.0 ) {
 						FluidDensity = GetDensityGlycol( PlantLoop( CBVAV( CBVAVNum ).LoopNum ).FluidName, DataGlobals::CWInitConvTemp, PlantLoop( CBVAV( CBVAVNum ).LoopNum ).FluidIndex, RoutineName );
-						CBVAV( CBVAVNum ).MaxHeatCoilFluidFlow = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", CBVAV( CBVAVNum ).HeatCoilName, ErrorsFound ) * FluidDensity;
+						CBVAV( CBVAVNum ).MaxHeatCoilFluidFlow = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", CBVAV( CBVAVNum ).HeatCoilName, InitCBVAVErrorsFound ) * FluidDensity;
 					}
 
 				} else if ( CBVAV( CBVAVNum ).HeatCoilType_Num == Coil_HeatingSteam ) {
@@ -1332,12 +1374,12 @@ namespace HVACUnitaryBypassVAV {
 						ShowFatalError( "InitCBVAV: Program terminated for previous conditions." );
 					}
 
-					CBVAV( CBVAVNum ).MaxHeatCoilFluidFlow = GetCoilMaxSteamFlowRate( CBVAV( CBVAVNum ).HeatCoilIndex, ErrorsFound );
+					CBVAV( CBVAVNum ).MaxHeatCoilFluidFlow = GetCoilMaxSteamFlowRate( CBVAV( CBVAVNum ).HeatCoilIndex, InitCBVAVErrorsFound );
 
 					if ( CBVAV( CBVAVNum ).MaxHeatCoilFluidFlow > 0.0 ) {
 						SteamIndex = 0; // Function GetSatDensityRefrig will look up steam index if 0 is passed
 						FluidDensity = GetSatDensityRefrig( fluidNameSteam, TempSteamIn, 1.0, SteamIndex, RoutineName );
-						CBVAV( CBVAVNum ).MaxHeatCoilFluidFlow = GetCoilMaxSteamFlowRate( CBVAV( CBVAVNum ).HeatCoilIndex, ErrorsFound ) * FluidDensity;
+						CBVAV( CBVAVNum ).MaxHeatCoilFluidFlow = GetCoilMaxSteamFlowRate( CBVAV( CBVAVNum ).HeatCoilIndex, InitCBVAVErrorsFound ) * FluidDensity;
 					}
 
 				}
@@ -1398,7 +1440,7 @@ namespace HVACUnitaryBypassVAV {
 						ErrorFlag = false;
 						CoilMaxVolFlowRate = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", CBVAV( CBVAVNum ).HeatCoilName, ErrorFlag );
 						if ( ErrorFlag ) {
-							ErrorsFound = true;
+							InitCBVAVErrorsFound = true;
 						}
 						if ( CoilMaxVolFlowRate != AutoSize ) {
 							FluidDensity = GetDensityGlycol( PlantLoop( CBVAV( CBVAVNum ).LoopNum ).FluidName, DataGlobals::CWInitConvTemp, PlantLoop( CBVAV( CBVAVNum ).LoopNum ).FluidIndex, RoutineName );
@@ -1410,7 +1452,7 @@ namespace HVACUnitaryBypassVAV {
 						ErrorFlag = false;
 						CoilMaxVolFlowRate = GetCoilMaxSteamFlowRate( CBVAV( CBVAVNum ).HeatCoilIndex, ErrorFlag );
 						if ( ErrorFlag ) {
-							ErrorsFound = true;
+							InitCBVAVErrorsFound = true;
 						}
 						if ( CoilMaxVolFlowRate != AutoSize ) {
 							SteamIndex = 0; // Function GetSatDensityRefrig will look up steam index if 0 is passed
@@ -1432,9 +1474,9 @@ namespace HVACUnitaryBypassVAV {
 		// IF CBVAV system was not autosized and the fan is autosized, check that fan volumetric flow rate is greater than CBVAV flow rates
 		if ( ! DoingSizing && CBVAV( CBVAVNum ).CheckFanFlow ) {
 			CurrentModuleObject = "AirLoopHVAC:UnitaryHeatCool:VAVChangeoverBypass";
-			FanErrFlag = false;
-			GetFanIndex( CBVAV( CBVAVNum ).FanName, FanIndex, FanErrFlag );
-			if ( FanErrFlag ) {
+			InitCBVAVFanErrFlag = false;
+			GetFanIndex( CBVAV( CBVAVNum ).FanName, FanIndex, InitCBVAVFanErrFlag );
+			if ( InitCBVAVFanErrFlag ) {
 				ShowContinueError( "...Fan occurs in " + CurrentModuleObject + " =" + CBVAV( CBVAVNum ).Name );
 			} else {
 				//     Only get the fan volumetric flow rate if the fan is valid, otherwise GetFanVolFlow returns a 0 and
@@ -2050,7 +2092,7 @@ namespace HVACUnitaryBypassVAV {
 						} else {
 							Par( 6 ) = 0.0;
 						}
-						SolveRegulaFalsi( SmallTempDiff, MaxIte, SolFla, PartLoadFrac, HXAssistDXCoilResidual, 0.0, 1.0, Par );
+						SolveRegulaFalsi( SmallTempDiff, MaxIte, SolFla, PartLoadFrac, HXAssistDXCoilResidual, 0.0, 1.0, Par, "CalcCBVAV" );
 						SimHXAssistedCoolingCoil( CBVAV( CBVAVNum ).DXCoolCoilName, FirstHVACIteration, On, PartLoadFrac, CBVAV( CBVAVNum ).CoolCoilCompIndex, ContFanCycCoil, HXUnitOn );
 						if ( SolFla == -1 && ! WarmupFlag ) {
 							if ( CBVAV( CBVAVNum ).HXDXIterationExceeded < 1 ) {
@@ -2082,7 +2124,7 @@ namespace HVACUnitaryBypassVAV {
 						Par( 1 ) = double( CBVAV( CBVAVNum ).CoolCoilCompIndex );
 						Par( 2 ) = CBVAV( CBVAVNum ).CoilTempSetPoint;
 						Par( 3 ) = OnOffAirFlowRatio;
-						SolveRegulaFalsi( SmallTempDiff, MaxIte, SolFla, PartLoadFrac, DOE2DXCoilResidual, 0.0, 1.0, Par );
+						SolveRegulaFalsi( SmallTempDiff, MaxIte, SolFla, PartLoadFrac, DOE2DXCoilResidual, 0.0, 1.0, Par, "CalcCBVAV" );
 						SimDXCoil( CBVAV( CBVAVNum ).DXCoolCoilName, On, FirstHVACIteration, CBVAV( CBVAVNum ).CoolCoilCompIndex, ContFanCycCoil, PartLoadFrac, OnOffAirFlowRatio );
 						if ( SolFla == -1 && ! WarmupFlag ) {
 							if ( CBVAV( CBVAVNum ).DXIterationExceeded < 1 ) {
@@ -2128,7 +2170,7 @@ namespace HVACUnitaryBypassVAV {
 						Par( 2 ) = CBVAV( CBVAVNum ).CoilTempSetPoint;
 						// Dehumidification mode = 0 for normal mode, 1+ for enhanced mode
 						Par( 3 ) = double( DehumidMode );
-						SolveRegulaFalsi( SmallTempDiff, MaxIte, SolFla, PartLoadFrac, MultiModeDXCoilResidual, 0.0, 1.0, Par );
+						SolveRegulaFalsi( SmallTempDiff, MaxIte, SolFla, PartLoadFrac, MultiModeDXCoilResidual, 0.0, 1.0, Par, "CalcCBVAV" );
 						if ( SolFla == -1 ) {
 							if ( CBVAV( CBVAVNum ).MMDXIterationExceeded < 1 ) {
 								++CBVAV( CBVAVNum ).MMDXIterationExceeded;
@@ -2172,7 +2214,7 @@ namespace HVACUnitaryBypassVAV {
 							Par( 2 ) = CBVAV( CBVAVNum ).CoilTempSetPoint;
 							// Dehumidification mode = 0 for normal mode, 1+ for enhanced mode
 							Par( 3 ) = double( DehumidMode );
-							SolveRegulaFalsi( SmallTempDiff, MaxIte, SolFla, PartLoadFrac, MultiModeDXCoilResidual, 0.0, 1.0, Par );
+							SolveRegulaFalsi( SmallTempDiff, MaxIte, SolFla, PartLoadFrac, MultiModeDXCoilResidual, 0.0, 1.0, Par, "CalcCBVAV" );
 							if ( SolFla == -1 ) {
 								if ( CBVAV( CBVAVNum ).DMDXIterationExceeded < 1 ) {
 									++CBVAV( CBVAVNum ).DMDXIterationExceeded;
@@ -2227,7 +2269,7 @@ namespace HVACUnitaryBypassVAV {
 							Par( 2 ) = CBVAV( CBVAVNum ).CoilTempSetPoint;
 							// Dehumidification mode = 0 for normal mode, 1+ for enhanced mode
 							Par( 3 ) = double( DehumidMode );
-							SolveRegulaFalsi( SmallTempDiff, MaxIte, SolFla, PartLoadFrac, MultiModeDXCoilResidual, 0.0, 1.0, Par );
+							SolveRegulaFalsi( SmallTempDiff, MaxIte, SolFla, PartLoadFrac, MultiModeDXCoilResidual, 0.0, 1.0, Par, "CalcCBVAV" );
 							if ( SolFla == -1 ) {
 								if ( CBVAV( CBVAVNum ).CRDXIterationExceeded < 1 ) {
 									++CBVAV( CBVAVNum ).CRDXIterationExceeded;
@@ -2297,7 +2339,7 @@ namespace HVACUnitaryBypassVAV {
 						Par( 1 ) = double( CBVAV( CBVAVNum ).HeatCoilIndex );
 						Par( 2 ) = min( CBVAV( CBVAVNum ).CoilTempSetPoint, CBVAV( CBVAVNum ).MaxLATHeating );
 						Par( 3 ) = OnOffAirFlowRatio;
-						SolveRegulaFalsi( SmallTempDiff, MaxIte, SolFla, PartLoadFrac, DXHeatingCoilResidual, 0.0, 1.0, Par );
+						SolveRegulaFalsi( SmallTempDiff, MaxIte, SolFla, PartLoadFrac, DXHeatingCoilResidual, 0.0, 1.0, Par, "CalcCBVAV" );
 						SimDXCoil( CBVAV( CBVAVNum ).HeatCoilName, On, FirstHVACIteration, CBVAV( CBVAVNum ).HeatCoilIndex, ContFanCycCoil, PartLoadFrac, OnOffAirFlowRatio );
 						if ( SolFla == -1 && ! WarmupFlag ) {
 							ShowWarningError( "Iteration limit exceeded calculating DX unit part-load ratio, for unit = " + CBVAV( CBVAVNum ).HeatCoilName );
@@ -3157,7 +3199,7 @@ namespace HVACUnitaryBypassVAV {
 						Par( 2 ) = 0.0;
 					}
 					Par( 3 ) = HeatCoilLoad;
-					SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, HotWaterMdot, HotWaterCoilResidual, MinWaterFlow, MaxHotWaterFlow, Par );
+					SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, HotWaterMdot, HotWaterCoilResidual, MinWaterFlow, MaxHotWaterFlow, Par, "CalcNonDXHeatingCoils" );
 					if ( SolFlag == -1 ) {
 						if ( CBVAV( CBVAVNum ).HotWaterCoilMaxIterIndex == 0 ) {
 							ShowWarningMessage( "CalcNonDXHeatingCoils: Hot water coil control failed for " + CBVAV( CBVAVNum ).UnitType + "=\"" + CBVAV( CBVAVNum ).Name + "\"" );
@@ -387,6 +387,11 @@ namespace HVACUnitaryBypassVAV {
 
 	// Functions
 
+	// Clears the global data in HVACUnitaryBypassVAV.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimUnitaryBypassVAV(
 		std::string const & CompName, // Name of the CBVAV system
@@ -281,6 +281,27 @@ namespace HVACVariableRefrigerantFlow {
 	// MODULE SUBROUTINES:
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		Real64 CurrentEndTime; // end time of current time step
+		Real64 CurrentEndTimeLast; // end time of last time step
+		Real64 TimeStepSysLast; // system time step on last time step
+		Real64 InitVRFCurrentEndTime; // end time of current time step
+		Real64 InitVRFCurrentEndTimeLast; // end time of last time step
+		Real64 InitVRFTimeStepSysLast; // system time step on last time step
+		Array1D_bool CheckVRFCombinationRatio;
+		bool MyOneTimeEIOFlag( true ); // eio header flag reporting
+		int ATMixOutNode( 0 ); // terminal unit mixer outlet node
+		Real64 CalcVRFCondenser_FluidTCtrlCurrentEndTime; // end time of current time step
+		Real64 CalcVRFCondenser_FluidTCtrlCurrentEndTimeLast; // end time of last time step
+		Real64 CalcVRFCondenser_FluidTCtrlTimeStepSysLast; // system time step on last time step
+		int CalcVRF_FluidTCtrlATMixOutNode( 0 ); // outlet node of ATM Mixer
+	}
+
 	// Functions
 
 	void
@@ -630,9 +651,6 @@ namespace HVACVariableRefrigerantFlow {
 		Real64 HREIRFTConst; // stead-state EIR fraction
 		Real64 HRInitialEIRFrac; // Fractional cooling degradation at the start of heat recovery from cooling mode
 		Real64 HREIRTC; // Time constant used to recover from initial degradation in cooling heat recovery
-		static Real64 CurrentEndTime; // end time of current time step
-		static Real64 CurrentEndTimeLast; // end time of last time step
-		static Real64 TimeStepSysLast; // system time step on last time step
 		Real64 SUMultiplier; // multiplier for simulating mode changes
 		Real64 CondPower; // condenser power [W]
 		Real64 CondCapacity; // condenser heat rejection [W]
@@ -3944,9 +3962,6 @@ namespace HVACVariableRefrigerantFlow {
 		int TUListIndex; // pointer to TU list for this VRF system
 		int IndexToTUInTUList; // index to TU in TerminalUnilList
 		Real64 RhoAir; // air density at InNode
-		static Real64 CurrentEndTime; // end time of current time step
-		static Real64 CurrentEndTimeLast; // end time of last time step
-		static Real64 TimeStepSysLast; // system time step on last time step
 		Real64 TempOutput; // Sensible output of TU
 		Real64 LoadToCoolingSP; // thermostat load to cooling setpoint (W)
 		Real64 LoadToHeatingSP; // thermostat load to heating setpoint (W)
@@ -4213,14 +4228,14 @@ namespace HVACVariableRefrigerantFlow {
 		} // IF(MyVRFFlag(VRFTUNum))THEN
 
 		// calculate end time of current time step to determine if max capacity reset is required
-		CurrentEndTime = CurrentTime + SysTimeElapsed;
+		InitVRFCurrentEndTime = CurrentTime + SysTimeElapsed;
 
 		// Initialize the maximum allowed terminal unit capacity. Total terminal unit capacity must not
 		// exceed the available condenser capacity. This variable is used to limit the terminal units
 		// providing more capacity than allowed. Example: TU loads are 1-ton, 2-ton, 3-ton, and 4-ton connected
 		// to a condenser having only 9-tons available. This variable will be set to 3-tons and the 4-ton
 		// terminal unit will be limited to 3-tons (see SimVRFCondenser where this variable is calculated).
-		if ( CurrentEndTime > CurrentEndTimeLast || TimeStepSysLast > TimeStepSys || ( FirstHVACIteration && MyBeginTimeStepFlag( VRFCond ) ) ) {
+		if ( InitVRFCurrentEndTime > InitVRFCurrentEndTimeLast || InitVRFTimeStepSysLast > TimeStepSys || ( FirstHVACIteration && MyBeginTimeStepFlag( VRFCond ) ) ) {
 			MaxCoolingCapacity( VRFCond ) = MaxCap;
 			MaxHeatingCapacity( VRFCond ) = MaxCap;
 			MyBeginTimeStepFlag( VRFCond ) = false;
@@ -4230,8 +4245,8 @@ namespace HVACVariableRefrigerantFlow {
 
 		// Do the following initializations (every time step).
 
-		TimeStepSysLast = TimeStepSys;
-		CurrentEndTimeLast = CurrentEndTime;
+		InitVRFTimeStepSysLast = TimeStepSys;
+		InitVRFCurrentEndTimeLast = InitVRFCurrentEndTime;
 
 		//  TUListNum = VRFTU(VRFTUNum)%TUListIndex
 
@@ -4952,7 +4967,6 @@ namespace HVACVariableRefrigerantFlow {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array1D_bool CheckVRFCombinationRatio;
 		bool FoundAll; // temporary variable used to check all terminal units
 		bool errFlag; // temporary variable used for error checking
 		Real64 TUCoolingCapacity; // total terminal unit cooling capacity
@@ -4961,7 +4975,6 @@ namespace HVACVariableRefrigerantFlow {
 		int TUListNum; // index to terminal unit list
 		int TUIndex; // index to terminal unit
 		int NumTU; // DO Loop index counter
-		static bool MyOneTimeEIOFlag( true ); // eio header flag reporting
 		Real64 OnOffAirFlowRat; // temporary variable used when sizing coils
 		Real64 DXCoilCap; // capacity of DX cooling coil (W)
 		bool IsAutoSize; // Indicator to autosize
@@ -6031,7 +6044,7 @@ namespace HVACVariableRefrigerantFlow {
 			//    Par(4) = OpMode
 			Par( 5 ) = QZnReq;
 			Par( 6 ) = OnOffAirFlowRatio;
-			SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, PartLoadRatio, PLRResidual, 0.0, 1.0, Par );
+			SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, PartLoadRatio, PLRResidual, 0.0, 1.0, Par, "ControlVRF" );
 			if ( SolFla == -1 ) {
 				//     Very low loads may not converge quickly. Tighten PLR boundary and try again.
 				TempMaxPLR = -0.1;
@@ -6067,7 +6080,7 @@ namespace HVACVariableRefrigerantFlow {
 					if ( VRFHeatingMode && TempOutput < QZnReq ) ContinueIter = false;
 					if ( VRFCoolingMode && TempOutput > QZnReq ) ContinueIter = false;
 				}
-				SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, PartLoadRatio, PLRResidual, TempMinPLR, TempMaxPLR, Par );
+				SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, PartLoadRatio, PLRResidual, TempMinPLR, TempMaxPLR, Par, "ControlVRF" );
 				if ( SolFla == -1 ) {
 					if ( ! FirstHVACIteration && ! WarmupFlag ) {
 						if ( VRFTU( VRFTUNum ).IterLimitExceeded == 0 ) {
@@ -6192,7 +6205,6 @@ namespace HVACVariableRefrigerantFlow {
 		Real64 SpecHumIn; // specific humidity ratio at inlet node
 		int TUListIndex; // index to TU list for this VRF system
 		int IndexToTUInTUList; // index to TU in specific list for the VRF system
-		static int ATMixOutNode( 0 ); // terminal unit mixer outlet node
 		int ZoneNode; // Zone node of VRFTU is serving
 		// FLOW
 
@@ -7763,9 +7775,6 @@ namespace HVACVariableRefrigerantFlow {
 		Real64 HRCapTC; // Time constant used to recover from initial degradation in cooling heat recovery
 		Real64 HRInitialEIRFrac; // Fractional cooling degradation at the start of heat recovery from cooling mode
 		Real64 HREIRTC; // Time constant used to recover from initial degradation in cooling heat recovery
-		static Real64 CurrentEndTime; // end time of current time step
-		static Real64 CurrentEndTimeLast; // end time of last time step
-		static Real64 TimeStepSysLast; // system time step on last time step
 		Real64 SUMultiplier; // multiplier for simulating mode changes
 		Real64 CondPower; // condenser power [W]
 		Real64 CondCapacity; // condenser heat rejection [W]
@@ -7896,7 +7905,8 @@ namespace HVACVariableRefrigerantFlow {
 		// Refrigerant data
 		RefMinTe = -15;
 		RefMaxPc = 4000000.0;
-		RefrigerantIndex = FindRefrigerant( this->RefrigerantName );
+		if ( this->RefIndex == 0 ) this->RefIndex = FindRefrigerant( this->RefrigerantName );
+		RefrigerantIndex = this->RefIndex;
 		RefMinPe = GetSatPressureRefrig( this->RefrigerantName, RefMinTe, RefrigerantIndex, RoutineName );
 		RefMinPe = GetSatPressureRefrig( this->RefrigerantName, RefMinTe, RefrigerantIndex, RoutineName );
 		RefTLow = RefrigData( RefrigerantIndex ).PsLowTempValue; // High Temperature Value for Ps (max in tables)
@@ -8044,12 +8054,12 @@ namespace HVACVariableRefrigerantFlow {
 
 			} else {
 
+				RefTSat = GetSatTemperatureRefrig( this->RefrigerantName, max( min( Pevap, RefPHigh ), RefPLow ), RefrigerantIndex, RoutineName );
 				for ( NumTU = 1; NumTU <= NumTUInList; NumTU++ ){ // Calc total refrigerant flow rate
 					if( TerminalUnitList( TUListNum ).TotalCoolLoad( NumTU ) > 0 ) {
 						TUIndex = TerminalUnitList( TUListNum ).ZoneTUPtr( NumTU );
 						CoolCoilIndex = VRFTU( TUIndex ).CoolCoilIndex;
 
-						RefTSat = GetSatTemperatureRefrig( this->RefrigerantName, max( min( Pevap, RefPHigh ), RefPLow ), RefrigerantIndex, RoutineName );
 						h_IU_evap_out_i = GetSupHeatEnthalpyRefrig( this->RefrigerantName, max( RefTSat, this->IUEvaporatingTemp + DXCoil( CoolCoilIndex ).ActualSH ), max( min( Pevap, RefPHigh ), RefPLow ), RefrigerantIndex, RoutineName );
 
 						if( h_IU_evap_out_i > h_IU_evap_in  ) {
@@ -8064,7 +8074,6 @@ namespace HVACVariableRefrigerantFlow {
 					h_IU_evap_out = h_IU_evap_out / m_ref_IU_evap;
 					SH_IU_merged = SH_IU_merged / m_ref_IU_evap;
 				} else {
-					RefTSat = GetSatTemperatureRefrig( this->RefrigerantName, max( min( Pevap, RefPHigh ), RefPLow ), RefrigerantIndex, RoutineName );
 					h_IU_evap_out = GetSupHeatEnthalpyRefrig( this->RefrigerantName, max( RefTSat, this->IUEvaporatingTemp + 3 ), max( min( Pevap, RefPHigh ), RefPLow ), RefrigerantIndex, RoutineName );
 					SH_IU_merged = 3;
 					m_ref_IU_evap = TU_CoolingLoad / ( h_IU_evap_out - h_IU_evap_in );
@@ -8397,12 +8406,12 @@ namespace HVACVariableRefrigerantFlow {
 			m_ref_IU_evap = 0;
 			h_IU_evap_out = 0;
 			SH_IU_merged = 0;
+			RefTSat = GetSatTemperatureRefrig( this->RefrigerantName, max( min( Pevap, RefPHigh ), RefPLow ), RefrigerantIndex, RoutineName );
 			for ( NumTU = 1; NumTU <= NumTUInList; NumTU++ ){ // Calc total refrigerant flow rate
 				if( TerminalUnitList( TUListNum ).TotalCoolLoad( NumTU ) > 0  ) {
 					TUIndex = TerminalUnitList( TUListNum ).ZoneTUPtr( NumTU );
 					CoolCoilIndex = VRFTU( TUIndex ).CoolCoilIndex;
 
-					RefTSat = GetSatTemperatureRefrig( this->RefrigerantName, max( min( Pevap, RefPHigh ), RefPLow ), RefrigerantIndex, RoutineName );
 					h_IU_evap_out_i = GetSupHeatEnthalpyRefrig( this->RefrigerantName, max( RefTSat, this->IUEvaporatingTemp + DXCoil( CoolCoilIndex ).ActualSH ), max( min( Pevap, RefPHigh ), RefPLow ), RefrigerantIndex, RoutineName );
 				
 					if( h_IU_evap_out_i > h_IU_evap_in  ) {
@@ -8417,7 +8426,6 @@ namespace HVACVariableRefrigerantFlow {
 				h_IU_evap_out = h_IU_evap_out / m_ref_IU_evap;
 				SH_IU_merged = SH_IU_merged / m_ref_IU_evap;
 			} else {
-				RefTSat = GetSatTemperatureRefrig( this->RefrigerantName, max( min( Pevap, RefPHigh ), RefPLow ), RefrigerantIndex, RoutineName );
 				h_IU_evap_out = GetSupHeatEnthalpyRefrig( this->RefrigerantName, max( RefTSat, this->IUEvaporatingTemp + 3 ), max( min( Pevap, RefPHigh ), RefPLow ), RefrigerantIndex, RoutineName );
 				SH_IU_merged = 3;
 				m_ref_IU_evap = TU_CoolingLoad / ( h_IU_evap_out - h_IU_evap_in );
@@ -8673,19 +8681,19 @@ namespace HVACVariableRefrigerantFlow {
 			// Calculate the capacity modification factor (SUMultiplier) for the HR mode transition period
 			{
 			// calculate end time of current time step to determine if max capacity reset is required
-			CurrentEndTime = double( ( DayOfSim - 1 ) * 24 ) + CurrentTime - TimeStepZone + SysTimeElapsed;
+			CalcVRFCondenser_FluidTCtrlCurrentEndTime = double( ( DayOfSim - 1 ) * 24 ) + CurrentTime - TimeStepZone + SysTimeElapsed;
 
 			if ( this->ModeChange || this->HRModeChange ) {
 				if ( this->HRCoolingActive && this->HRTimer == 0.0 ) {
-					this->HRTimer = CurrentEndTimeLast;
+					this->HRTimer = CalcVRFCondenser_FluidTCtrlCurrentEndTimeLast;
 				} else if ( this->HRHeatingActive && this->HRTimer == 0.0 ) {
-					this->HRTimer = CurrentEndTimeLast;
+					this->HRTimer = CalcVRFCondenser_FluidTCtrlCurrentEndTimeLast;
 				} else if ( ! this->HRCoolingActive && ! this->HRHeatingActive ) {
 					this->HRTimer = 0.0;
 				}
 			}
 
-			this->HRTime = max( 0.0, CurrentEndTime - this->HRTimer );
+			this->HRTime = max( 0.0, CalcVRFCondenser_FluidTCtrlCurrentEndTime - this->HRTimer );
 			if ( this->HRTime < ( HRCapTC * 5.0 ) ) {
 				if ( HRCapTC > 0.0 ) {
 					SUMultiplier = min( 1.0, 1.0 - std::exp( -this->HRTime / HRCapTC ) );
@@ -8699,8 +8707,8 @@ namespace HVACVariableRefrigerantFlow {
 			}
 			this->SUMultiplier = SUMultiplier;
 
-			TimeStepSysLast = TimeStepSys;
-			CurrentEndTimeLast = CurrentEndTime;
+			CalcVRFCondenser_FluidTCtrlTimeStepSysLast = TimeStepSys;
+			CalcVRFCondenser_FluidTCtrlCurrentEndTimeLast = CalcVRFCondenser_FluidTCtrlCurrentEndTime;
 			}
 
 			// Modify HR capacity for the transition period
@@ -8995,7 +9003,7 @@ namespace HVACVariableRefrigerantFlow {
 			//    Par(4) = OpMode
 			Par( 5 ) = QZnReq;
 			Par( 6 ) = OnOffAirFlowRatio;
-			SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, PartLoadRatio, PLRResidual, 0.0, 1.0, Par );
+			SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, PartLoadRatio, PLRResidual, 0.0, 1.0, Par, "ControlVRF_FluidTCtrl" );
 			if ( SolFla == -1 ) {
 				//     Very low loads may not converge quickly. Tighten PLR boundary and try again.
 				TempMaxPLR = -0.1;
@@ -9019,7 +9027,7 @@ namespace HVACVariableRefrigerantFlow {
 					if ( VRFHeatingMode && TempOutput < QZnReq ) ContinueIter = false;
 					if ( VRFCoolingMode && TempOutput > QZnReq ) ContinueIter = false;
 				}
-				SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, PartLoadRatio, PLRResidual, TempMinPLR, TempMaxPLR, Par );
+				SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, PartLoadRatio, PLRResidual, TempMinPLR, TempMaxPLR, Par, "ControlVRF_FluidTCtrl" );
 				if ( SolFla == -1 ) {
 					if ( ! FirstHVACIteration && ! WarmupFlag ) {
 						if ( this->IterLimitExceeded == 0 ) {
@@ -9118,7 +9126,6 @@ namespace HVACVariableRefrigerantFlow {
 		int IndexToTUInTUList; // index to TU in specific list for the VRF system
 		Real64 EvapTemp; //evaporating temperature
 		Real64 CondTemp; //condensing temperature
-		static int ATMixOutNode( 0 ); // outlet node of ATM Mixer
 		int ZoneNode; // Zone node of VRFTU is serving
 
 		// FLOW
@@ -9147,7 +9154,7 @@ namespace HVACVariableRefrigerantFlow {
 
 		if ( this->ATMixerExists ) {
 			// There is an air terminal mixer
-			ATMixOutNode = this->ATMixerOutNode;
+			CalcVRF_FluidTCtrlATMixOutNode = this->ATMixerOutNode;
 			if ( this->ATMixerType == ATMixer_InletSide ) { // if there is an inlet side air terminal mixer
 				// set the primary air inlet mass flow rate
 				Node( this->ATMixerPriNode ).MassFlowRate = min( Node( this->ATMixerPriNode ).MassFlowRateMaxAvail, Node( VRFTUInletNodeNum ).MassFlowRate );
@@ -9156,7 +9163,7 @@ namespace HVACVariableRefrigerantFlow {
 				SimATMixer( this->ATMixerName, FirstHVACIteration, this->ATMixerIndex );
 			}
 		} else {
-			ATMixOutNode = 0;
+			CalcVRF_FluidTCtrlATMixOutNode = 0;
 			// simulate OA Mixer
 		if ( this->OAMixerUsed ) SimOAMixer( this->OAMixerName, FirstHVACIteration, this->OAMixerIndex );
 		}
@@ -9207,8 +9214,8 @@ namespace HVACVariableRefrigerantFlow {
 		if ( this->ATMixerExists ) {
 			if ( this->ATMixerType == ATMixer_SupplySide ) {
 				// Air terminal supply side mixer
-				MinHumRat = min( Node( ZoneNode ).HumRat, Node( ATMixOutNode ).HumRat );
-				LoadMet = Node( ATMixOutNode ).MassFlowRate * ( PsyHFnTdbW( Node( ATMixOutNode ).Temp, MinHumRat ) - PsyHFnTdbW( Node( ZoneNode ).Temp, MinHumRat ) );
+				MinHumRat = min( Node( ZoneNode ).HumRat, Node( CalcVRF_FluidTCtrlATMixOutNode ).HumRat );
+				LoadMet = Node( CalcVRF_FluidTCtrlATMixOutNode ).MassFlowRate * ( PsyHFnTdbW( Node( CalcVRF_FluidTCtrlATMixOutNode ).Temp, MinHumRat ) - PsyHFnTdbW( Node( ZoneNode ).Temp, MinHumRat ) );
 			} else {
 				// Air terminal inlet side mixer
 				MinHumRat = min( Node( ZoneNode ).HumRat, Node( VRFTUOutletNodeNum ).HumRat );
@@ -9334,7 +9341,7 @@ namespace HVACVariableRefrigerantFlow {
 		Par( 7 ) = OACompOnMassFlow;
 
 		FanSpdRatioMax = 1.0;
-		SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, FanSpdRatio, VRFTUAirFlowResidual_FluidTCtrl, FanSpdRatioMin, FanSpdRatioMax, Par );
+		SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, FanSpdRatio, VRFTUAirFlowResidual_FluidTCtrl, FanSpdRatioMin, FanSpdRatioMax, Par, "CalVRFTUAirFlowRate_FluidTCtrl" );
 		if( SolFla < 0) FanSpdRatio = FanSpdRatioMax; //over capacity
 
 		AirMassFlowRate = FanSpdRatio * DXCoil( DXCoilNum ).RatedAirMassFlowRate( Mode );
@@ -10038,7 +10045,8 @@ namespace HVACVariableRefrigerantFlow {
 		static std::string const RoutineName( "VRFOU_CapModFactor" );
 		
 		// variable initializations
-		RefrigerantIndex = FindRefrigerant( this->RefrigerantName );
+		if ( this->RefIndex == 0 ) this->RefIndex = FindRefrigerant( this->RefrigerantName );
+		RefrigerantIndex = this->RefIndex;
 		
 		//Saturated temperature at real evaporating pressure
 		RefTSat = GetSatTemperatureRefrig( this->RefrigerantName, P_evap_real, RefrigerantIndex, RoutineName );
@@ -10142,7 +10150,8 @@ namespace HVACVariableRefrigerantFlow {
 		
 		// variable initializations
 		TUListNum = this->ZoneTUListPtr;
-		RefrigerantIndex = FindRefrigerant( this->RefrigerantName );
+		if ( this->RefIndex == 0 ) this->RefIndex = FindRefrigerant( this->RefrigerantName );
+		RefrigerantIndex = this->RefIndex;
 		RefPLow = RefrigData( RefrigerantIndex ).PsLowPresValue;
 		RefPHigh = RefrigData( RefrigerantIndex ).PsHighPresValue;
 		NumTUInList = TerminalUnitList( TUListNum ).NumTUInList;
@@ -10160,6 +10169,7 @@ namespace HVACVariableRefrigerantFlow {
 		Pipe_m_ref_i = 0;
 		Pipe_SH_merged = 0;
 		Pe_update = GetSatPressureRefrig( this->RefrigerantName, Te_update, RefrigerantIndex, RoutineName );
+		RefTSat = GetSatTemperatureRefrig( this->RefrigerantName, Pe_update, RefrigerantIndex, RoutineName );
 		
 		// Re-calculate total refrigerant flow rate, with updated SH
 		for ( int NumTU = 1; NumTU <= NumTUInList; NumTU++ ){
@@ -10176,7 +10186,6 @@ namespace HVACVariableRefrigerantFlow {
 				else
 					SH_IU_update = ( - this->C2Te + std::pow( ( pow_2( this->C2Te ) - 4 * ( this->C1Te - Tfs + Te_update ) * this->C3Te) , 0.5 ) ) / ( 2 * this->C3Te );
 				
-				RefTSat = GetSatTemperatureRefrig( this->RefrigerantName, Pe_update, RefrigerantIndex, RoutineName );
 				Pipe_h_IU_out_i = GetSupHeatEnthalpyRefrig( this->RefrigerantName, max( RefTSat, Te_update + SH_IU_update ), Pe_update, RefrigerantIndex, RoutineName ); // hB_i for the IU
 			
 				if( Pipe_h_IU_out_i > Pipe_h_IU_in ) {
@@ -10192,7 +10201,6 @@ namespace HVACVariableRefrigerantFlow {
 			Pipe_SH_merged = Pipe_SH_merged /Pipe_m_ref;
 		} else {
 			Pipe_SH_merged = this->SH;
-			RefTSat = GetSatTemperatureRefrig( this->RefrigerantName, Pe_update, RefrigerantIndex, RoutineName );
 			Pipe_h_IU_out = GetSupHeatEnthalpyRefrig( this->RefrigerantName, max( RefTSat, Te_update + Pipe_SH_merged ), Pe_update, RefrigerantIndex, RoutineName );	
 		}
 
@@ -10284,7 +10292,8 @@ namespace HVACVariableRefrigerantFlow {
 		// variable initializations: component index
 		TUListNum = this->ZoneTUListPtr;
 		NumTUInList = TerminalUnitList( TUListNum ).NumTUInList;
-		RefrigerantIndex = FindRefrigerant( this->RefrigerantName );
+		if ( this->RefIndex == 0 ) this->RefIndex = FindRefrigerant( this->RefrigerantName );
+		RefrigerantIndex = this->RefIndex;
 		RefPLow = RefrigData( RefrigerantIndex ).PsLowPresValue;
 		RefPHigh = RefrigData( RefrigerantIndex ).PsHighPresValue;
 		
@@ -10442,7 +10451,8 @@ namespace HVACVariableRefrigerantFlow {
 		// variable initializations: component index
 		TUListNum = this->ZoneTUListPtr;
 		NumTUInList = TerminalUnitList( TUListNum ).NumTUInList;
-		RefrigerantIndex = FindRefrigerant( this->RefrigerantName );
+		if ( this->RefIndex == 0 ) this->RefIndex = FindRefrigerant( this->RefrigerantName );
+		RefrigerantIndex = this->RefIndex;
 		RefPLow = RefrigData( RefrigerantIndex ).PsLowPresValue;
 		RefPHigh = RefrigData( RefrigerantIndex ).PsHighPresValue;
 		
@@ -10610,7 +10620,8 @@ namespace HVACVariableRefrigerantFlow {
 		Q_evap_req = TU_load + Pipe_Q;
 		
 		TUListNum = this->ZoneTUListPtr;
-		RefrigerantIndex = FindRefrigerant( this->RefrigerantName );
+		if ( this->RefIndex == 0 ) this->RefIndex = FindRefrigerant( this->RefrigerantName );
+		RefrigerantIndex = this->RefIndex;
 		RefPLow = RefrigData( RefrigerantIndex ).PsLowPresValue;
 		RefPHigh = RefrigData( RefrigerantIndex ).PsHighPresValue;
 		NumTUInList = TerminalUnitList( TUListNum ).NumTUInList;
@@ -10676,7 +10687,7 @@ namespace HVACVariableRefrigerantFlow {
 					MinOutdoorUnitPe = max( P_discharge - this->CompMaxDeltaP, MinRefriPe );
 					MinOutdoorUnitTe = GetSatTemperatureRefrig( this->RefrigerantName, max( min( MinOutdoorUnitPe, RefPHigh ), RefPLow ), RefrigerantIndex, RoutineName );
 					
-					SolveRegulaFalsi( 1.0e-3, MaxIter, SolFla, SmallLoadTe, CompResidual_FluidTCtrl, MinOutdoorUnitTe, T_suction, Par ); // SmallLoadTe is the updated Te'
+					SolveRegulaFalsi( 1.0e-3, MaxIter, SolFla, SmallLoadTe, CompResidual_FluidTCtrl, MinOutdoorUnitTe, T_suction, Par, "VRFOU_CalcCompC" ); // SmallLoadTe is the updated Te'
 					if( SolFla < 0 ) SmallLoadTe = 6; //MinOutdoorUnitTe; //SmallLoadTe( Te'_new ) is constant during iterations
 					
 					//Get an updated Te corresponding to the updated Te'
@@ -10698,6 +10709,7 @@ namespace HVACVariableRefrigerantFlow {
 					Pipe_m_ref_i = 0;
 					Pipe_SH_merged = 0;
 					Pipe_Pe_assumed = GetSatPressureRefrig( this->RefrigerantName, Pipe_Te_assumed, RefrigerantIndex, RoutineName );
+					RefTSat = GetSatTemperatureRefrig( this->RefrigerantName, max( min( Pipe_Pe_assumed, RefPHigh ), RefPLow ), RefrigerantIndex, RoutineName );
 					
 					// Re-calculate total refrigerant flow rate, with updated SH
 					for ( int NumTU = 1; NumTU <= NumTUInList; NumTU++ ){
@@ -10713,7 +10725,6 @@ namespace HVACVariableRefrigerantFlow {
 							else
 								Modifi_SHin = ( -this->C2Te + std::pow( ( pow_2( this->C2Te ) - 4 * ( this->C1Te - Tfs + Pipe_Te_assumed ) * this->C3Te) , 0.5 ) ) / ( 2 * this->C3Te );
 							
-							RefTSat = GetSatTemperatureRefrig( this->RefrigerantName, max( min( Pipe_Pe_assumed, RefPHigh ), RefPLow ), RefrigerantIndex, RoutineName );
 							Pipe_h_IU_out_i = GetSupHeatEnthalpyRefrig( this->RefrigerantName, max( RefTSat, Pipe_Te_assumed + Modifi_SHin ), max( min( Pipe_Pe_assumed, RefPHigh ), RefPLow ), RefrigerantIndex, RoutineName );
 						
 							if( Pipe_h_IU_out_i > Pipe_h_IU_in ) {
@@ -10729,7 +10740,6 @@ namespace HVACVariableRefrigerantFlow {
 						Pipe_SH_merged = Pipe_SH_merged /Pipe_m_ref;
 					} else {
 						Pipe_SH_merged = this->SH;
-						RefTSat = GetSatTemperatureRefrig( this->RefrigerantName, max( min( Pipe_Pe_assumed, RefPHigh ), RefPLow ), RefrigerantIndex, RoutineName );
 						Pipe_h_IU_out = GetSupHeatEnthalpyRefrig( this->RefrigerantName, max( RefTSat, Pipe_Te_assumed + Pipe_SH_merged ), max( min( Pipe_Pe_assumed, RefPHigh ), RefPLow ), RefrigerantIndex, RoutineName );
 					}
 
@@ -10900,7 +10910,8 @@ namespace HVACVariableRefrigerantFlow {
 		Q_evap_req = TU_load + Pipe_Q - Ncomp;
 		
 		TUListNum = this->ZoneTUListPtr;
-		RefrigerantIndex = FindRefrigerant( this->RefrigerantName );
+		if ( this->RefIndex == 0 ) this->RefIndex = FindRefrigerant( this->RefrigerantName );
+		RefrigerantIndex = this->RefIndex;
 		RefPLow = RefrigData( RefrigerantIndex ).PsLowPresValue;
 		RefPHigh = RefrigData( RefrigerantIndex ).PsHighPresValue;
 		NumTUInList = TerminalUnitList( TUListNum ).NumTUInList;
@@ -10948,7 +10959,7 @@ namespace HVACVariableRefrigerantFlow {
 					Par( 2 ) = Q_evap_req * C_cap_operation / this->RatedEvapCapacity;
 					Par( 3 ) = this->OUCoolingCAPFT( CounterCompSpdTemp );
 
-					SolveRegulaFalsi( 1.0e-3, MaxIter, SolFla, SmallLoadTe, CompResidual_FluidTCtrl, MinOutdoorUnitTe, T_suction, Par );
+					SolveRegulaFalsi( 1.0e-3, MaxIter, SolFla, SmallLoadTe, CompResidual_FluidTCtrl, MinOutdoorUnitTe, T_suction, Par, "VRFOU_CalcCompH" );
 					if( SolFla < 0 ) SmallLoadTe = MinOutdoorUnitTe;
 					
 					T_suction = SmallLoadTe;
@@ -11091,7 +11102,8 @@ namespace HVACVariableRefrigerantFlow {
 		C_OU_HexRatio = this->HROUHexRatio;
 		
 		// Initializations: component index
-		RefrigerantIndex = FindRefrigerant( this->RefrigerantName );
+		if ( this->RefIndex == 0 ) this->RefIndex = FindRefrigerant( this->RefrigerantName );
+		RefrigerantIndex = this->RefIndex;
 		RefPLow = RefrigData( RefrigerantIndex ).PsLowPresValue;
 		RefPHigh = RefrigData( RefrigerantIndex ).PsHighPresValue;
 		
@@ -11275,7 +11287,7 @@ namespace HVACVariableRefrigerantFlow {
 			Par( 6 ) = Q_c_TU_PL;
 			Par( 7 ) = m_air_evap_rated;
 
-			SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, Tsuction_new, VRFOUTeResidual_FluidTCtrl, Tsuction_LB, Tsuction_HB, Par );
+			SolveRegulaFalsi( ErrorTol, MaxIte, SolFla, Tsuction_new, VRFOUTeResidual_FluidTCtrl, Tsuction_LB, Tsuction_HB, Par, "VRFHR_OU_HR_Mode" );
 			if( SolFla < 0) Tsuction_new = Tsuction_LB;
 
 			// Update Q_c_tot_temp using updated Tsuction_new
@@ -11484,7 +11496,8 @@ namespace HVACVariableRefrigerantFlow {
 		Pipe_cp_ref = 1.6;
 		
 		// Refrigerant data
-		RefrigerantIndex = FindRefrigerant( this->RefrigerantName );
+		if ( this->RefIndex == 0 ) this->RefIndex = FindRefrigerant( this->RefrigerantName );
+		RefrigerantIndex = this->RefIndex;
 		Real64 RefPLow = RefrigData( RefrigerantIndex ).PsLowPresValue; // Low Pressure Value for Ps (>0.0)
 		Real64 RefPHigh = RefrigData( RefrigerantIndex ).PsHighPresValue; // High Pressure Value for Ps (max in tables)
 		
@@ -11634,7 +11647,8 @@ namespace HVACVariableRefrigerantFlow {
 		Pipe_cp_ref = 1.6;
 		
 		// Refrigerant data
-		RefrigerantIndex = FindRefrigerant( this->RefrigerantName );
+		if ( this->RefIndex == 0 ) this->RefIndex = FindRefrigerant( this->RefrigerantName );
+		RefrigerantIndex = this->RefIndex;
 		Real64 RefTHigh = RefrigData( RefrigerantIndex ).PsHighTempValue; // High Temperature Value for Ps (max in tables)
 		Real64 RefPLow = RefrigData( RefrigerantIndex ).PsLowPresValue; // Low Pressure Value for Ps (>0.0)
 		Real64 RefPHigh = RefrigData( RefrigerantIndex ).PsHighPresValue; // High Pressure Value for Ps (max in tables)
@@ -11741,6 +11755,19 @@ namespace HVACVariableRefrigerantFlow {
 		MyVRFFlag.deallocate();
 		MyVRFCondFlag.deallocate();
 		MyZoneEqFlag.deallocate();
+		CurrentEndTime = 0.0;
+		CurrentEndTimeLast = 0.0;
+		TimeStepSysLast = 0.0;
+		InitVRFCurrentEndTime = 0.0;
+		InitVRFCurrentEndTimeLast = 0.0;
+		InitVRFTimeStepSysLast = 0.0;
+		CheckVRFCombinationRatio.deallocate();
+		MyOneTimeEIOFlag = true;
+		ATMixOutNode = 0;
+		CalcVRFCondenser_FluidTCtrlCurrentEndTime = 0.0;
+		CalcVRFCondenser_FluidTCtrlCurrentEndTimeLast = 0.0;
+		CalcVRFCondenser_FluidTCtrlTimeStepSysLast = 0.0;
+		CalcVRF_FluidTCtrlATMixOutNode = 0;
 	}
 
 	// End of Utility subroutines for the Module
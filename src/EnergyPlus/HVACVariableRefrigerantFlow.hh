@@ -408,6 +408,7 @@ namespace HVACVariableRefrigerantFlow {
 		Real64 OUEvapHeatRate; // Outdoor Unit Evaporator Heat Extract Rate, excluding piping loss  [W]
 		Real64 OUFanPower; // Outdoor unit fan power at real conditions[W]
 		std::string RefrigerantName; // Name of refrigerant, must match name in FluidName (see fluidpropertiesrefdata.idf)
+		int RefIndex; // Index of the refrigerant in FluidProperties::RefrigData (0 until first looked up)
 		Real64 RatedEvapCapacity; // Rated Evaporative Capacity [W]
 		Real64 RatedCompPower; // Rated Compressor Power [W]
 		Real64 RatedCompPowerPerCapcity; // Rated Compressor Power per Evaporative Capacity [W]
@@ -630,6 +631,7 @@ namespace HVACVariableRefrigerantFlow {
 			OUCondHeatRate( 0.0 ),
 			OUEvapHeatRate( 0.0 ),
 			OUFanPower( 0.0 ),
+			RefIndex( 0 ),
 			RatedEvapCapacity( 40000.0 ),
 			RatedCompPower( 14000.0 ),
 			RatedCompPowerPerCapcity( 0.35 ),
@@ -168,8 +168,49 @@ namespace HWBaseboardRadiator {
 	Array1D< HWBaseboardParams > HWBaseboard;
 	Array1D< HWBaseboardNumericFieldData > HWBaseboardNumericFields;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // One time get input flag
+		bool ErrorsFound( false ); // If errors detected in input
+		bool MyOneTimeFlag( true );
+		bool ZoneEquipmentListChecked( false );
+		Array1D_bool MyEnvrnFlag;
+		int Iter( 0 );
+		bool UpdateHWBaseboardMyEnvrnFlag( true );
+	}
+
 	// Functions
 
+	// Clears the global data in HWBaseboardRadiator.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumHWBaseboards = 0;
+		QBBRadSource.deallocate();
+		QBBRadSrcAvg.deallocate();
+		ZeroSourceSumHATsurf.deallocate();
+		LastQBBRadSrc.deallocate();
+		LastSysTimeElapsed.deallocate();
+		LastTimeStepSys.deallocate();
+		MySizeFlag.deallocate();
+		CheckEquipName.deallocate();
+		SetLoopIndexFlag.deallocate();
+		HWBaseboard.deallocate();
+		HWBaseboardNumericFields.deallocate();
+		GetInputFlag = true;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		ZoneEquipmentListChecked = false;
+		MyEnvrnFlag.deallocate();
+		Iter = 0;
+		UpdateHWBaseboardMyEnvrnFlag = true;
+	}
+
 	void
 	SimHWBaseboard(
 		std::string const & EquipName,
@@ -215,7 +256,6 @@ namespace HWBaseboardRadiator {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int BaseboardNum; // Index of unit in baseboard array
-		static bool GetInputFlag( true ); // One time get input flag
 		Real64 QZnReq; // Zone load not yet satisfied
 		Real64 MaxWaterFlow;
 		Real64 MinWaterFlow;
@@ -365,7 +405,6 @@ namespace HWBaseboardRadiator {
 		int NumNumbers; // Number of Numbers for each GetobjectItem call
 		int SurfNum; // Surface number Do loop counter
 		int IOStat;
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool errFlag;
@@ -700,9 +739,6 @@ namespace HWBaseboardRadiator {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true );
-		static bool ZoneEquipmentListChecked( false );
-		static Array1D_bool MyEnvrnFlag;
 		int Loop;
 		int WaterInletNode;
 		int ZoneNode;
@@ -1317,15 +1353,13 @@ namespace HWBaseboardRadiator {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int WaterInletNode;
 		int WaterOutletNode;
-		static int Iter( 0 );
-		static bool MyEnvrnFlag( true );
 
-		if ( BeginEnvrnFlag && MyEnvrnFlag ) {
+		if ( BeginEnvrnFlag && UpdateHWBaseboardMyEnvrnFlag ) {
 			Iter = 0;
-			MyEnvrnFlag = false;
+			UpdateHWBaseboardMyEnvrnFlag = false;
 		}
 		if ( ! BeginEnvrnFlag ) {
-			MyEnvrnFlag = true;
+			UpdateHWBaseboardMyEnvrnFlag = true;
 		}
 
 		// First, update the running average if necessary...
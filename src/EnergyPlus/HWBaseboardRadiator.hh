@@ -227,6 +227,11 @@ namespace HWBaseboardRadiator {
 
 	// Functions
 
+	// Clears the global data in HWBaseboardRadiator.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimHWBaseboard(
 		std::string const & EquipName,
@@ -244,6 +244,17 @@ namespace HeatBalFiniteDiffManager {
 	// MODULE SUBROUTINES:
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false ); // If errors detected in input
+		bool MyEnvrnFlag( true );
+		Real64 MaxDelTemp( 0.0 );
+	}
+
 	// Functions
 
 	void
@@ -264,6 +275,9 @@ namespace HeatBalFiniteDiffManager {
 		ConstructFD.deallocate();
 		SurfaceFD.deallocate();
 		MaterialFD.deallocate();
+		ErrorsFound = false;
+		MyEnvrnFlag = true;
+		MaxDelTemp = 0.0;
 	}
 
 	void
@@ -373,7 +387,6 @@ namespace HeatBalFiniteDiffManager {
 		int MaterialNumAlpha; // Number of material alpha names being passed
 		int MaterialNumProp; // Number of material properties being passed
 		Array1D< Real64 > MaterialProps( 40 ); // Temporary array to transfer material properties
-		static bool ErrorsFound( false ); // If errors detected in input
 		//  INTEGER :: CondFDMat                ! Number of variable property CondFD materials in input
 		int Loop;
 		int NumAlphas;
@@ -608,7 +621,6 @@ namespace HeatBalFiniteDiffManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyEnvrnFlag( true );
 		int SurfNum;
 		int ConstrNum; // Loop counter
 		bool ErrorsFound;
@@ -807,6 +819,7 @@ namespace HeatBalFiniteDiffManager {
 			ConstructFD( ConstrNum ).Name.allocate( Construct( ConstrNum ).TotLayers );
 			ConstructFD( ConstrNum ).Thickness.allocate( Construct( ConstrNum ).TotLayers );
 			ConstructFD( ConstrNum ).NodeNumPoint.allocate( Construct( ConstrNum ).TotLayers );
+			ConstructFD( ConstrNum ).LinearLayer.dimension( Construct( ConstrNum ).TotLayers, false );
 			ConstructFD( ConstrNum ).DelX.allocate( Construct( ConstrNum ).TotLayers );
 			ConstructFD( ConstrNum ).TempStability.allocate( Construct( ConstrNum ).TotLayers );
 			ConstructFD( ConstrNum ).MoistStability.allocate( Construct( ConstrNum ).TotLayers );
@@ -962,6 +975,15 @@ namespace HeatBalFiniteDiffManager {
 
 				TotNodes += Ipts1; //  number of full size nodes
 				ConstructFD( ConstrNum ).NodeNumPoint( Layer ) = Ipts1; //  number of full size nodes
+
+				// Layers with two or more interior nodes and no phase change or temperature dependent conductivity
+				// form a linear tridiagonal system that is solved directly inside the Gauss-Seidel loop
+				if ( Ipts1 > 2 ) {
+					auto const & matFD( MaterialFD( CurrentLayer ) );
+					bool const IsPCM( matFD.TempEnth( 2, 1 ) + matFD.TempEnth( 2, 2 ) + matFD.TempEnth( 2, 3 ) >= 0.0 );
+					bool const IsVariableCond( ( matFD.TempCond( 2, 1 ) + matFD.TempCond( 2, 2 ) + matFD.TempCond( 2, 3 ) >= 0.0 ) || ( matFD.tk1 != 0.0 ) );
+					ConstructFD( ConstrNum ).LinearLayer( Layer ) = ( ! IsPCM ) && ( ! IsVariableCond );
+				}
 			} //  end of layer loop.
 
 			ConstructFD( ConstrNum ).TotNodes = TotNodes;
@@ -1030,6 +1052,8 @@ namespace HeatBalFiniteDiffManager {
 			SurfaceFD( Surf ).CpDelXRhoS1.allocate( TotNodes + 1 );
 			SurfaceFD( Surf ).CpDelXRhoS2.allocate( TotNodes + 1 );
 			SurfaceFD( Surf ).TDpriortimestep.allocate( TotNodes + 1 );
+			SurfaceFD( Surf ).LayerSolveCoef.allocate( TotNodes + 1 );
+			SurfaceFD( Surf ).LayerSolveRhs.allocate( TotNodes + 1 );
 
 			//Initialize the allocated arrays.
 			SurfaceFD( Surf ).T = TempInitValue;
@@ -1052,6 +1076,8 @@ namespace HeatBalFiniteDiffManager {
 			SurfaceFD( Surf ).CpDelXRhoS1 = 0.0;
 			SurfaceFD( Surf ).CpDelXRhoS2 = 0.0;
 			SurfaceFD( Surf ).TDpriortimestep = 0.0;
+			SurfaceFD( Surf ).LayerSolveCoef = 0.0;
+			SurfaceFD( Surf ).LayerSolveRhs = 0.0;
 		}
 
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
@@ -1142,7 +1168,9 @@ namespace HeatBalFiniteDiffManager {
 		//      all building surface constructs.
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// Gauss-Seidel iteration over the node equations of the surface.  Interior nodes of layers with
+		// constant properties are solved directly as a block (tridiagonal) each sweep so that only the
+		// boundary, interface and nonlinear (PCM, variable conductivity) nodes need to iterate.
 
 		// REFERENCES:
 		// na
@@ -1166,7 +1194,6 @@ namespace HeatBalFiniteDiffManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static Real64 MaxDelTemp( 0.0 );
 
 		int const ConstrNum( Surface( Surf ).Construction );
 
@@ -1219,9 +1246,15 @@ namespace HeatBalFiniteDiffManager {
 					// For the Layer Interior nodes.  Arrive here after exterior surface node or interface node
 
 					if ( TotNodes != 1 ) {
-						for ( int ctr = 2, ctr_end = ConstructFD( ConstrNum ).NodeNumPoint( Lay ); ctr <= ctr_end; ++ctr ) {
-							++i;
-							InteriorNodeEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew );
+						if ( ConstructFD( ConstrNum ).LinearLayer( Lay ) ) {
+							int const LastNode( i + ConstructFD( ConstrNum ).NodeNumPoint( Lay ) - 1 );
+							LinearLayerNodeEqns( Delt, i + 1, LastNode, Lay, Surf, TD, TDT );
+							i = LastNode;
+						} else {
+							for ( int ctr = 2, ctr_end = ConstructFD( ConstrNum ).NodeNumPoint( Lay ); ctr <= ctr_end; ++ctr ) {
+								++i;
+								InteriorNodeEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew );
+							}
 						}
 					}
 
@@ -1905,6 +1938,93 @@ namespace HeatBalFiniteDiffManager {
 		SurfaceFD( Surf ).CpDelXRhoS1( i ) = SurfaceFD( Surf ).CpDelXRhoS2( i ) = ( Cp * DelX * RhoS ) / 2.0; // Save this for computing node flux values, half nodes are the same here
 	}
 
+	void
+	LinearLayerNodeEqns(
+		int const Delt, // Time Increment
+		int const FirstNode, // First interior node of the layer
+		int const LastNode, // Last interior node of the layer
+		int const Lay, // Layer Number for Construction
+		int const Surf, // Surface number
+		Array1< Real64 > const & TD, // OLD NODE TEMPERATURES OF EACH HEAT TRANSFER SURF IN CONDFD.
+		Array1< Real64 > & TDT // NEW NODE TEMPERATURES OF EACH HEAT TRANSFER SURF IN CONDFD.
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solve the interior node equations of a constant property layer simultaneously.
+
+		// METHODOLOGY EMPLOYED:
+		// With constant conductivity and specific heat the InteriorNodeEqns equations for the nodes
+		// FirstNode..LastNode form a tridiagonal system whose end conditions are the current values of the
+		// layer's boundary or interface nodes.  The system is solved with the Thomas algorithm, giving the
+		// same temperatures that repeated InteriorNodeEqns sweeps converge to.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+
+		int const ConstrNum( Surface( Surf ).Construction );
+
+		int const MatLay( Construct( ConstrNum ).LayerPoint( Lay ) );
+		auto const & mat( Material( MatLay ) );
+
+		auto & surfaceFD( SurfaceFD( Surf ) );
+		auto & Coef( surfaceFD.LayerSolveCoef );
+		auto & Rhs( surfaceFD.LayerSolveRhs );
+
+		Real64 const kt( mat.Conductivity );
+		Real64 const Cp( mat.SpecHeat );
+		Real64 const RhoS( mat.Density );
+		Real64 const DelX( ConstructFD( ConstrNum ).DelX( Lay ) );
+		Real64 const Cp_DelX_RhoS_Delt( Cp * DelX * RhoS / Delt );
+
+		bool const CrankNicholson( CondFDSchemeType == CrankNicholsonSecondOrder );
+		assert( CrankNicholson || ( CondFDSchemeType == FullyImplicitFirstOrder ) );
+		Real64 const OffDiag( CrankNicholson ? kt / ( 2.0 * DelX ) : kt / DelX ); // Coupling to each neighbor node
+		Real64 const Diag( OffDiag + OffDiag + Cp_DelX_RhoS_Delt );
+
+		// Forward elimination
+		for ( int i = FirstNode; i <= LastNode; ++i ) {
+			Real64 const TD_i( TD( i ) );
+			Real64 Rhs_i( Cp_DelX_RhoS_Delt * TD_i );
+			if ( CrankNicholson ) Rhs_i += OffDiag * ( TD( i + 1 ) - TD_i + TD( i - 1 ) - TD_i );
+			Real64 Denom( Diag );
+			if ( i == FirstNode ) {
+				Rhs_i += OffDiag * TDT( i - 1 );
+			} else {
+				Denom -= OffDiag * Coef( i - 1 );
+				Rhs_i += OffDiag * Rhs( i - 1 );
+			}
+			if ( i == LastNode ) Rhs_i += OffDiag * TDT( i + 1 );
+			Coef( i ) = OffDiag / Denom;
+			Rhs( i ) = Rhs_i / Denom;
+		}
+
+		// Back substitution with limit clipping
+		Real64 TDT_p( 0.0 );
+		for ( int i = LastNode; i >= FirstNode; --i ) {
+			Real64 TDT_i( Rhs( i ) );
+			if ( i != LastNode ) TDT_i += Coef( i ) * TDT_p;
+			if ( TDT_i < MinSurfaceTempLimit ) {
+				TDT_i = MinSurfaceTempLimit;
+			} else if ( TDT_i > MaxSurfaceTempLimit ) {
+				TDT_i = MaxSurfaceTempLimit;
+			}
+			TDT( i ) = TDT_p = TDT_i;
+			surfaceFD.CpDelXRhoS1( i ) = surfaceFD.CpDelXRhoS2( i ) = ( Cp * DelX * RhoS ) / 2.0; // Save this for computing node flux values, half nodes are the same here
+		}
+	}
+
 	void
 	IntInterfaceNodeEqns(
 		int const Delt, // Time Increment
@@ -145,6 +145,7 @@ namespace HeatBalFiniteDiffManager {
 		Array1D< Real64 > TempStability;
 		Array1D< Real64 > MoistStability;
 		Array1D_int NodeNumPoint;
+		Array1D_bool LinearLayer; // true if the interior nodes of the layer have constant properties (solved directly)
 		//  INTEGER, ALLOCATABLE, DIMENSION(:) :: InterfaceNodeNums   ! Layer interfaces occur at these nodes
 		Array1D< Real64 > Thickness;
 		Array1D< Real64 > NodeXlocation; // sized to TotNode, contains X distance in m from outside face
@@ -182,6 +183,8 @@ namespace HeatBalFiniteDiffManager {
 		Array1D< Real64 > CpDelXRhoS1; // Current outer half-node Cp * DelX * RhoS / Delt
 		Array1D< Real64 > CpDelXRhoS2; // Current inner half-node Cp * DelX * RhoS / Delt
 		Array1D< Real64 > TDpriortimestep; // Node temperatures from previous timestep
+		Array1D< Real64 > LayerSolveCoef; // Scratch modified upper diagonal for linear layer tridiagonal solve
+		Array1D< Real64 > LayerSolveRhs; // Scratch modified right hand side for linear layer tridiagonal solve
 		int SourceNodeNum; // Node number for internal source layer (zero if no source)
 		Real64 QSource; // Internal source flux [W/m2]
 		int GSloopCounter; // count of inner loop iterations
@@ -330,6 +333,17 @@ namespace HeatBalFiniteDiffManager {
 		Array1< Real64 > & EnthNew // New Nodal enthalpy
 	);
 
+	void
+	LinearLayerNodeEqns(
+		int const Delt, // Time Increment
+		int const FirstNode, // First interior node of the layer
+		int const LastNode, // Last interior node of the layer
+		int const Lay, // Layer Number for Construction
+		int const Surf, // Surface number
+		Array1< Real64 > const & TD, // OLD NODE TEMPERATURES OF EACH HEAT TRANSFER SURF IN CONDFD.
+		Array1< Real64 > & TDT // NEW NODE TEMPERATURES OF EACH HEAT TRANSFER SURF IN CONDFD.
+	);
+
 	void
 	IntInterfaceNodeEqns(
 		int const Delt, // Time Increment
@@ -141,6 +141,7 @@ namespace HeatBalanceAirManager {
 	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
 	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
 		bool ManageAirHeatBalanceGetInputFlag( true );
+		bool GetAirHeatBalanceInputErrorsFound( false );
 	}
 	//         Subroutine Specifications for the Heat Balance Module
 	// Driver Routines
@@ -160,6 +161,7 @@ namespace HeatBalanceAirManager {
 	clear_state()
 	{
 		ManageAirHeatBalanceGetInputFlag =  true;
+		GetAirHeatBalanceInputErrorsFound = false;
 	}
 
 
@@ -262,18 +264,17 @@ namespace HeatBalanceAirManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false );
 
 		// FLOW:
 
-		GetAirFlowFlag( ErrorsFound );
+		GetAirFlowFlag( GetAirHeatBalanceInputErrorsFound );
 
 		SetZoneMassConservationFlag();
 
 		// get input parameters for modeling of room air flow
-		GetRoomAirModelParameters( ErrorsFound );
+		GetRoomAirModelParameters( GetAirHeatBalanceInputErrorsFound );
 
-		if ( ErrorsFound ) {
+		if ( GetAirHeatBalanceInputErrorsFound ) {
 			ShowFatalError( "GetAirHeatBalanceInput: Errors found in getting Air inputs" );
 		}
 
@@ -107,6 +107,12 @@ namespace HeatBalanceHAMTManager {
 	// with the option of including the latent heat, then liquid and vapor transfer. The process is ittereated.
 	// Once the temperatures have converged the internal surface
 	// temperature and vapor densities are passed back to EnergyPlus.
+	// With the linearized solution algorithm the cell equations of each iteration are
+	// assembled, with the material properties held fixed, into banded (tridiagonal) systems
+	// for temperature and relative humidity that are solved directly, and the material data
+	// are looked up through uniform bin tables.  Its iterations continue until the relative
+	// humidities have converged as well as the temperatures, and are damped once they take
+	// long enough to suggest the properties are making them oscillate.
 
 	// Temperatures and relative humidities are updated once EnergyPlus has checked that
 	// the zone temperatures have converged.
@@ -154,8 +160,16 @@ namespace HeatBalanceHAMTManager {
 	Real64 const wspech( 4180.0 ); // Specific Heat Capacity of Water J.kg-1.K-1 (at 20C)
 	Real64 const whv( 2489000.0 ); // Evaporation enthalpy of water J.kg-1
 	Real64 const convt( 0.002 ); // Temperature convergence limit
+	Real64 const convrh( 0.0001 ); // RH convergence limit of the linearized solution
+	int const relaxitter( 10 ); // Iterations of the linearized solution before it is damped
+	Real64 const relaxfactor( 0.5 ); // Damping of the linearized solution
 	Real64 const qvplim( 100000.0 ); // Maximum latent heat W
 	Real64 const rhmax( 1.01 ); // Maximum RH value
+	int const tablebins( 4 ); // Uniform table bins per material data interval
+
+	// Solution algorithms
+	int const IterativeSolution( 1 ); // Cell by cell iteration
+	int const LinearizedSolution( 2 ); // Banded solve of the linearized cell equations
 
 	static std::string const BlankString;
 
@@ -192,13 +206,75 @@ namespace HeatBalanceHAMTManager {
 	bool latswitch( false ); // latent heat switch,
 	bool rainswitch( false ); // rain switch,
 
+	int SolutionAlgorithm( IterativeSolution ); // IterativeSolution or LinearizedSolution
+
+	Array1D< Real64 > bandlower; // Coefficient of the outside neighbour cell in the banded system
+	Array1D< Real64 > banddiag; // Diagonal coefficient of the banded system
+	Array1D< Real64 > bandupper; // Coefficient of the inside neighbour cell in the banded system
+	Array1D< Real64 > bandrhs; // Right hand side of the banded system
+	Array1D< Real64 > bandwork; // Eliminated coefficients of the inside neighbour cells
+	Array1D< Real64 > bandsolution; // Solution of the banded system
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE HeatBalanceHAMTManager:
 
 	// Object Data
 	Array1D< subcell > cells;
+	Array1D< materialtables > mattables;
+
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool OneTimeFlag( true );
+		int qvpErrCount( 0 );
+		int qvpErrReport( 0 );
+	}
 
 	// Functions
 
+	void
+	clear_state()
+	{
+		firstcell.deallocate();
+		lastcell.deallocate();
+		Extcell.deallocate();
+		ExtRadcell.deallocate();
+		ExtConcell.deallocate();
+		ExtSkycell.deallocate();
+		ExtGrncell.deallocate();
+		Intcell.deallocate();
+		IntConcell.deallocate();
+		watertot.deallocate();
+		surfrh.deallocate();
+		surfextrh.deallocate();
+		surftemp.deallocate();
+		surfexttemp.deallocate();
+		surfvp.deallocate();
+		extvtc.deallocate();
+		intvtc.deallocate();
+		extvtcflag.deallocate();
+		intvtcflag.deallocate();
+		MyEnvrnFlag.deallocate();
+		deltat = 0.0;
+		TotCellsMax = 0;
+		latswitch = false;
+		rainswitch = false;
+		SolutionAlgorithm = IterativeSolution;
+		bandlower.deallocate();
+		banddiag.deallocate();
+		bandupper.deallocate();
+		bandrhs.deallocate();
+		bandwork.deallocate();
+		bandsolution.deallocate();
+		cells.deallocate();
+		mattables.deallocate();
+		OneTimeFlag = true;
+		qvpErrCount = 0;
+		qvpErrReport = 0;
+	}
+
 	void
 	ManageHeatBalHAMT(
 		int const SurfNum,
@@ -239,7 +315,6 @@ namespace HeatBalanceHAMTManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static bool OneTimeFlag( true );
 
 		if ( OneTimeFlag ) {
 			OneTimeFlag = false;
@@ -286,6 +361,7 @@ namespace HeatBalanceHAMTManager {
 		static std::string const cHAMTObject5( "MaterialProperty:HeatAndMoistureTransfer:Diffusion" );
 		static std::string const cHAMTObject6( "MaterialProperty:HeatAndMoistureTransfer:ThermalConductivity" );
 		static std::string const cHAMTObject7( "SurfaceProperties:VaporCoefficients" );
+		static std::string const cHAMTObject8( "HeatBalanceSettings:CombinedHeatAndMoistureFiniteElement" );
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -387,6 +463,9 @@ namespace HeatBalanceHAMTManager {
 		GetObjectDefMaxArgs( cHAMTObject7, NumParams, NumAlphas, NumNums );
 		MaxAlphas = max( MaxAlphas, NumAlphas );
 		MaxNums = max( MaxNums, NumNums );
+		GetObjectDefMaxArgs( cHAMTObject8, NumParams, NumAlphas, NumNums );
+		MaxAlphas = max( MaxAlphas, NumAlphas );
+		MaxNums = max( MaxNums, NumNums );
 
 		ErrorsFound = false;
 
@@ -654,6 +733,26 @@ namespace HeatBalanceHAMTManager {
 
 		}
 
+		// Solution settings
+		if ( GetNumObjectsFound( cHAMTObject8 ) > 0 ) { // HeatBalanceSettings:CombinedHeatAndMoistureFiniteElement
+			GetObjectItem( cHAMTObject8, 1, AlphaArray, NumAlphas, NumArray, NumNums, status, lNumericBlanks, lAlphaBlanks, cAlphaFieldNames, cNumericFieldNames );
+
+			if ( ! lAlphaBlanks( 1 ) ) {
+
+				{ auto const SELECT_CASE_var( AlphaArray( 1 ) );
+
+				if ( SELECT_CASE_var == "ITERATIVE" ) {
+					SolutionAlgorithm = IterativeSolution;
+				} else if ( SELECT_CASE_var == "LINEARIZED" ) {
+					SolutionAlgorithm = LinearizedSolution;
+				} else {
+					ShowSevereError( cHAMTObject8 + ": invalid " + cAlphaFieldNames( 1 ) + " entered=" + AlphaArray( 1 ) + ", must match Iterative or Linearized." );
+					ErrorsFound = true;
+				}}
+
+			}
+		}
+
 		AlphaArray.deallocate();
 		cAlphaFieldNames.deallocate();
 		cNumericFieldNames.deallocate();
@@ -824,6 +923,23 @@ namespace HeatBalanceHAMTManager {
 
 		// Make the cells and initialise
 		cells.allocate( TotCellsMax );
+		bandlower.dimension( TotCellsMax, 0.0 );
+		banddiag.dimension( TotCellsMax, 0.0 );
+		bandupper.dimension( TotCellsMax, 0.0 );
+		bandrhs.dimension( TotCellsMax, 0.0 );
+		bandwork.dimension( TotCellsMax, 0.0 );
+		bandsolution.dimension( TotCellsMax, 0.0 );
+
+		// Uniform lookup tables for the material data, used by the linearized solution
+		mattables.allocate( TotMaterials );
+		for ( matid = 1; matid <= TotMaterials; ++matid ) {
+			auto const & mat( Material( matid ) );
+			SetupUniformTable( mat.niso, mat.isorh, mattables( matid ).iso );
+			SetupUniformTable( mat.nsuc, mat.sucwater, mattables( matid ).suc );
+			SetupUniformTable( mat.nred, mat.redwater, mattables( matid ).red );
+			SetupUniformTable( mat.nmu, mat.murh, mattables( matid ).mu );
+			SetupUniformTable( mat.ntc, mat.tcwater, mattables( matid ).tc );
+		}
 		for ( auto & e : cells ) {
 			e.adjs = -1;
 			e.adjsl = -1;
@@ -1048,7 +1164,11 @@ namespace HeatBalanceHAMTManager {
 		// To calculate the heat and moisture transfer through the surface
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The material properties are updated from the cell water contents and relative humidities, then the
+		// cell temperatures and relative humidities are updated, repeating until the temperatures converge.
+		// The iterative solution updates each cell in turn from its neighbours.  The linearized solution
+		// assembles the equations of all cells, with the properties held fixed, into tridiagonal systems
+		// that are solved directly so that only the property nonlinearity needs iterating.
 
 		// REFERENCES:
 		// na
@@ -1092,6 +1212,8 @@ namespace HeatBalanceHAMTManager {
 		Real64 vaporr2;
 		Real64 vpdiff;
 		Real64 sumtp1;
+		Real64 sumrhp1;
+		Real64 relax;
 		Real64 tempmax;
 		Real64 tempmin;
 
@@ -1104,10 +1226,12 @@ namespace HeatBalanceHAMTManager {
 		int adjl;
 
 		//    INTEGER, SAVE :: tempErrCount=0
-		static int qvpErrCount( 0 );
 		//    INTEGER, SAVE :: tempErrReport=0
-		static int qvpErrReport( 0 );
 		Real64 denominator;
+		Real64 coupling;
+		bool bandadj;
+
+		bool const linearized( SolutionAlgorithm == LinearizedSolution );
 
 		if ( BeginEnvrnFlag && MyEnvrnFlag( sid ) ) {
 			cells( Extcell( sid ) ).rh = 0.0;
@@ -1231,6 +1355,8 @@ namespace HeatBalanceHAMTManager {
 		itter = 0;
 		while ( true ) {
 			++itter;
+			// the direct solution is damped when the material properties make it oscillate
+			relax = ( itter > relaxitter ) ? relaxfactor : 1.0;
 			// Update Moisture values
 
 			for ( cid = firstcell( sid ); cid <= lastcell( sid ); ++cid ) {
@@ -1238,7 +1364,18 @@ namespace HeatBalanceHAMTManager {
 				cells( cid ).vp = RHtoVP( cells( cid ).rh, cells( cid ).temp );
 				cells( cid ).vpp1 = RHtoVP( cells( cid ).rhp1, cells( cid ).tempp1 );
 				cells( cid ).vpsat = PsyPsatFnTemp( cells( cid ).tempp1 );
-				if ( matid > 0 ) {
+				if ( ( matid > 0 ) && linearized ) {
+					auto const & mat( Material( matid ) );
+					auto const & tables( mattables( matid ) );
+					interpuniform( tables.iso, mat.niso, mat.isorh, mat.isodata, cells( cid ).rhp1, cells( cid ).water, cells( cid ).dwdphi );
+					if ( IsRain && rainswitch ) {
+						interpuniform( tables.suc, mat.nsuc, mat.sucwater, mat.sucdata, cells( cid ).water, cells( cid ).dw );
+					} else {
+						interpuniform( tables.red, mat.nred, mat.redwater, mat.reddata, cells( cid ).water, cells( cid ).dw );
+					}
+					interpuniform( tables.mu, mat.nmu, mat.murh, mat.mudata, cells( cid ).rhp1, cells( cid ).mu );
+					interpuniform( tables.tc, mat.ntc, mat.tcwater, mat.tcdata, cells( cid ).water, cells( cid ).wthermalc );
+				} else if ( matid > 0 ) {
 					interp( Material( matid ).niso, Material( matid ).isorh, Material( matid ).isodata, cells( cid ).rhp1, cells( cid ).water, cells( cid ).dwdphi );
 					if ( IsRain && rainswitch ) {
 						interp( Material( matid ).nsuc, Material( matid ).sucwater, Material( matid ).sucdata, cells( cid ).water, cells( cid ).dw );
@@ -1255,10 +1392,16 @@ namespace HeatBalanceHAMTManager {
 				torsum = 0.0;
 				oorsum = 0.0;
 				vpdiff = 0.0;
+				if ( linearized ) {
+					bandlower( cid ) = 0.0;
+					bandupper( cid ) = 0.0;
+				}
 				for ( ii = 1; ii <= adjmax; ++ii ) {
 					adj = cells( cid ).adjs( ii );
 					adjl = cells( cid ).adjsl( ii );
 					if ( adj == -1 ) break;
+					// neighbouring surface cells are solved for together, the boundary cells are fixed
+					bandadj = linearized && ( ( ( adj == cid - 1 ) && ( adj >= Extcell( sid ) ) ) || ( ( adj == cid + 1 ) && ( adj <= Intcell( sid ) ) ) );
 
 					if ( cells( cid ).htc > 0 ) {
 						thermr1 = 1.0 / ( cells( cid ).overlap( ii ) * cells( cid ).htc );
@@ -1294,7 +1437,13 @@ namespace HeatBalanceHAMTManager {
 
 					if ( thermr1 + thermr2 > 0 ) {
 						oorsum += 1.0 / ( thermr1 + thermr2 );
-						torsum += cells( adj ).tempp1 / ( thermr1 + thermr2 );
+						if ( ! bandadj ) {
+							torsum += cells( adj ).tempp1 / ( thermr1 + thermr2 );
+						} else if ( adj < cid ) {
+							bandlower( cid ) = 1.0 / ( thermr1 + thermr2 );
+						} else {
+							bandupper( cid ) = 1.0 / ( thermr1 + thermr2 );
+						}
 					}
 					if ( vaporr1 + vaporr2 > 0 ) {
 						vpdiff += ( cells( adj ).vp - cells( cid ).vp ) / ( vaporr1 + vaporr2 );
@@ -1323,7 +1472,18 @@ namespace HeatBalanceHAMTManager {
 				}
 
 				// Calculate the temperature for the next time step
-				cells( cid ).tempp1 = ( torsum + qvp + cells( cid ).Qadds + ( tcap * cells( cid ).temp / deltat ) ) / ( oorsum + ( tcap / deltat ) );
+				if ( linearized ) {
+					banddiag( cid ) = oorsum + ( tcap / deltat );
+					bandrhs( cid ) = torsum + qvp + cells( cid ).Qadds + ( tcap * cells( cid ).temp / deltat );
+				} else {
+					cells( cid ).tempp1 = ( torsum + qvp + cells( cid ).Qadds + ( tcap * cells( cid ).temp / deltat ) ) / ( oorsum + ( tcap / deltat ) );
+				}
+			}
+			if ( linearized ) {
+				SolveBand( Extcell( sid ), Intcell( sid ), MaxSurfaceTempLimitBeforeFatal );
+				for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+					cells( cid ).tempp1 = cells( cid ).tempp2 + relax * ( bandsolution( cid ) - cells( cid ).tempp2 );
+				}
 			}
 
 			// Check for silly temperatures
@@ -1368,11 +1528,17 @@ namespace HeatBalanceHAMTManager {
 				phiorsum = 0.0;
 				vpoosum = 0.0;
 				vporsum = 0.0;
+				if ( linearized ) {
+					bandlower( cid ) = 0.0;
+					bandupper( cid ) = 0.0;
+				}
 
 				for ( ii = 1; ii <= adjmax; ++ii ) {
 					adj = cells( cid ).adjs( ii );
 					adjl = cells( cid ).adjsl( ii );
 					if ( adj == -1 ) break;
+					bandadj = linearized && ( ( ( adj == cid - 1 ) && ( adj >= Extcell( sid ) ) ) || ( ( adj == cid + 1 ) && ( adj <= Intcell( sid ) ) ) );
+					coupling = 0.0;
 
 					if ( cells( cid ).vtc > 0 ) {
 						vaporr1 = 1.0 / ( cells( cid ).overlap( ii ) * cells( cid ).vtc );
@@ -1391,7 +1557,12 @@ namespace HeatBalanceHAMTManager {
 					}
 					if ( vaporr1 + vaporr2 > 0 ) {
 						vpoosum += 1.0 / ( vaporr1 + vaporr2 );
-						vporsum += ( cells( adj ).vpp1 / ( vaporr1 + vaporr2 ) );
+						if ( bandadj ) {
+							// vpp1 = rhp1 * vpsat for the neighbour
+							coupling += cells( adj ).vpsat / ( vaporr1 + vaporr2 );
+						} else {
+							vporsum += ( cells( adj ).vpp1 / ( vaporr1 + vaporr2 ) );
+						}
 					}
 
 					if ( ( cells( cid ).dw > 0 ) && ( cells( cid ).dwdphi > 0 ) ) {
@@ -1408,7 +1579,17 @@ namespace HeatBalanceHAMTManager {
 					//             IF(rhr1+rhr2>0)THEN
 					if ( rhr1 * rhr2 > 0 ) {
 						phioosum += 1.0 / ( rhr1 + rhr2 );
-						phiorsum += ( cells( adj ).rhp1 / ( rhr1 + rhr2 ) );
+						if ( bandadj ) {
+							coupling += 1.0 / ( rhr1 + rhr2 );
+						} else {
+							phiorsum += ( cells( adj ).rhp1 / ( rhr1 + rhr2 ) );
+						}
+					}
+
+					if ( bandadj && ( adj < cid ) ) {
+						bandlower( cid ) = coupling;
+					} else if ( bandadj ) {
+						bandupper( cid ) = coupling;
 					}
 
 				}
@@ -1422,7 +1603,10 @@ namespace HeatBalanceHAMTManager {
 
 				// Calculate the RH for the next time step
 				denominator = ( phioosum + vpoosum * cells( cid ).vpsat + wcap / deltat );
-				if ( denominator != 0.0 ) {
+				if ( ( denominator != 0.0 ) && linearized ) {
+					banddiag( cid ) = denominator;
+					bandrhs( cid ) = phiorsum + vporsum + ( wcap * cells( cid ).rh ) / deltat;
+				} else if ( denominator != 0.0 ) {
 					cells( cid ).rhp1 = ( phiorsum + vporsum + ( wcap * cells( cid ).rh ) / deltat ) / denominator;
 				} else {
 					ShowSevereError( "CalcHeatBalHAMT: demoninator in calculating RH is zero.  Check material properties for accuracy." );
@@ -1434,15 +1618,24 @@ namespace HeatBalanceHAMTManager {
 					cells( cid ).rhp1 = rhmax;
 				}
 			}
+			if ( linearized ) {
+				SolveBand( Extcell( sid ), Intcell( sid ), rhmax );
+				for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+					cells( cid ).rhp1 = cells( cid ).rhp2 + relax * ( bandsolution( cid ) - cells( cid ).rhp2 );
+				}
+			}
 
 			//Check for convergence or too many itterations
 			sumtp1 = 0.0;
+			sumrhp1 = 0.0;
 			for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
 				if ( sumtp1 < std::abs( cells( cid ).tempp2 - cells( cid ).tempp1 ) ) {
 					sumtp1 = std::abs( cells( cid ).tempp2 - cells( cid ).tempp1 );
 				}
+				if ( linearized ) sumrhp1 = max( sumrhp1, std::abs( cells( cid ).rhp2 - cells( cid ).rhp1 ) );
 			}
-			if ( sumtp1 < convt ) {
+			// the direct solution reaches the temperatures in a few iterations, the RH must converge as well
+			if ( ( sumtp1 < convt ) && ( sumrhp1 < convrh ) ) {
 				break;
 			}
 			if ( itter > ittermax ) {
@@ -1615,6 +1808,207 @@ namespace HeatBalanceHAMTManager {
 		}
 	}
 
+	void
+	SetupUniformTable(
+		int const ndata,
+		Array1A< Real64 > const xx,
+		uniformtable & table
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// To set up the uniform bins used by interpuniform to find a data interval without searching.
+
+		// METHODOLOGY EMPLOYED:
+		// The range of the data is split into tablebins equal bins per data interval.  For each bin
+		// the first data point not below the start of the bin is stored.  Unsorted data are left
+		// without bins and are searched by interp.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int step;
+		int bin;
+		int nbins;
+
+		table.firststep.deallocate();
+		if ( ndata <= 1 ) return;
+
+		// Argument array dimensioning
+		xx.dim( ndata );
+
+		if ( xx( ndata ) <= xx( 1 ) ) return;
+		for ( step = 2; step <= ndata; ++step ) {
+			if ( xx( step ) < xx( step - 1 ) ) return;
+		}
+
+		nbins = tablebins * ( ndata - 1 );
+		table.xlow = xx( 1 );
+		table.invstep = double( nbins ) / ( xx( ndata ) - xx( 1 ) );
+		table.firststep.allocate( nbins );
+		step = 2;
+		for ( bin = 1; bin <= nbins; ++bin ) {
+			Real64 const binstart( xx( 1 ) + double( bin - 1 ) / table.invstep );
+			while ( ( step <= ndata ) && ( xx( step ) < binstart ) ) {
+				++step;
+			}
+			table.firststep( bin ) = step;
+		}
+	}
+
+	void
+	interpuniform(
+		uniformtable const & table,
+		int const ndata,
+		Array1A< Real64 > const xx,
+		Array1A< Real64 > const yy,
+		Real64 const invalue,
+		Real64 & outvalue,
+		Optional< Real64 > outgrad
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// To find the same value and gradient as interp, using the uniform bins set up by SetupUniformTable.
+
+		// METHODOLOGY EMPLOYED:
+		// The bin of the input value gives the data interval directly, apart from the rare bins that hold a
+		// data point, where a short step to the neighbouring interval is made.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 binpos;
+		Real64 xxlow;
+		Real64 xxhigh;
+		Real64 mygrad;
+		int nbins;
+		int step;
+
+		if ( table.firststep.empty() ) {
+			interp( ndata, xx, yy, invalue, outvalue, outgrad );
+			return;
+		}
+
+		// Argument array dimensioning
+		xx.dim( ndata );
+		yy.dim( ndata );
+
+		// Find the first data point with x not below the input value, as the search in interp does
+		nbins = table.firststep.isize();
+		binpos = ( invalue - table.xlow ) * table.invstep;
+		if ( binpos < 0.0 ) {
+			step = 2;
+		} else {
+			step = table.firststep( binpos < double( nbins ) ? int( binpos ) + 1 : nbins );
+			while ( ( step > 2 ) && ( invalue <= xx( step - 1 ) ) ) {
+				--step;
+			}
+			while ( ( step <= ndata ) && ( invalue > xx( step ) ) ) {
+				++step;
+			}
+		}
+
+		mygrad = 0.0;
+		if ( step > ndata ) {
+			outvalue = yy( ndata );
+		} else {
+			xxlow = xx( step - 1 );
+			xxhigh = xx( step );
+			if ( xxhigh > xxlow ) {
+				mygrad = ( yy( step ) - yy( step - 1 ) ) / ( xxhigh - xxlow );
+				outvalue = ( invalue - xxlow ) * mygrad + yy( step - 1 );
+			} else {
+				outvalue = yy( step - 1 );
+			}
+		}
+
+		if ( present( outgrad ) ) {
+			// return gradient if required
+			outgrad = mygrad;
+		}
+	}
+
+	void
+	SolveBand(
+		int const firstcid,
+		int const lastcid,
+		Real64 const limit
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// To solve the banded system of the surface cells firstcid to lastcid,
+		//   banddiag*x(cid) - bandlower*x(cid-1) - bandupper*x(cid+1) = bandrhs
+		// returning x in bandsolution.  Cells with x above limit are held at the limit, as the
+		// iterative solution does when it updates the cells one at a time.
+
+		// METHODOLOGY EMPLOYED:
+		// Tridiagonal (Thomas) algorithm.  The equations of the cells above the limit are replaced
+		// by x(cid) = limit and the system is solved again until no cell is above the limit.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int cid;
+		Real64 denominator;
+		bool held;
+
+		do {
+			// Forward elimination
+			bandwork( firstcid ) = bandupper( firstcid ) / banddiag( firstcid );
+			bandsolution( firstcid ) = bandrhs( firstcid ) / banddiag( firstcid );
+			for ( cid = firstcid + 1; cid <= lastcid; ++cid ) {
+				denominator = banddiag( cid ) - bandlower( cid ) * bandwork( cid - 1 );
+				bandwork( cid ) = bandupper( cid ) / denominator;
+				bandsolution( cid ) = ( bandrhs( cid ) + bandlower( cid ) * bandsolution( cid - 1 ) ) / denominator;
+			}
+
+			// Back substitution
+			for ( cid = lastcid - 1; cid >= firstcid; --cid ) {
+				bandsolution( cid ) += bandwork( cid ) * bandsolution( cid + 1 );
+			}
+
+			// Hold the cells above the limit
+			held = false;
+			for ( cid = firstcid; cid <= lastcid; ++cid ) {
+				if ( bandsolution( cid ) <= limit ) continue;
+				bandlower( cid ) = 0.0;
+				banddiag( cid ) = 1.0;
+				bandupper( cid ) = 0.0;
+				bandrhs( cid ) = limit;
+				held = true;
+			}
+		} while ( held );
+	}
+
 	Real64
 	RHtoVP(
 		Real64 const RH,
@@ -61,6 +61,7 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
+#include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Optional.hh>
 
 // EnergyPlus Headers
@@ -79,8 +80,16 @@ namespace HeatBalanceHAMTManager {
 	extern Real64 const wspech; // Specific Heat Capacity of Water J.kg-1.K-1 (at 20C)
 	extern Real64 const whv; // Evaporation enthalpy of water J.kg-1
 	extern Real64 const convt; // Temperature convergence limit
+	extern Real64 const convrh; // RH convergence limit of the linearized solution
+	extern int const relaxitter; // Iterations of the linearized solution before it is damped
+	extern Real64 const relaxfactor; // Damping of the linearized solution
 	extern Real64 const qvplim; // Maximum latent heat W
 	extern Real64 const rhmax; // Maximum RH value
+	extern int const tablebins; // Uniform table bins per material data interval
+
+	// Solution algorithms
+	extern int const IterativeSolution; // Cell by cell iteration
+	extern int const LinearizedSolution; // Banded solve of the linearized cell equations
 
 	// DERIVED TYPE DEFINITIONS:
 
@@ -115,6 +124,15 @@ namespace HeatBalanceHAMTManager {
 	extern bool latswitch; // latent heat switch,
 	extern bool rainswitch; // rain switch,
 
+	extern int SolutionAlgorithm; // IterativeSolution or LinearizedSolution
+
+	extern Array1D< Real64 > bandlower; // Coefficient of the outside neighbour cell in the banded system
+	extern Array1D< Real64 > banddiag; // Diagonal coefficient of the banded system
+	extern Array1D< Real64 > bandupper; // Coefficient of the inside neighbour cell in the banded system
+	extern Array1D< Real64 > bandrhs; // Right hand side of the banded system
+	extern Array1D< Real64 > bandwork; // Eliminated coefficients of the inside neighbour cells
+	extern Array1D< Real64 > bandsolution; // Solution of the banded system
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE HeatBalanceHAMTManager:
 
 	// Types
@@ -189,11 +207,45 @@ namespace HeatBalanceHAMTManager {
 
 	};
 
+	struct uniformtable
+	{
+		// Members
+		Real64 xlow; // First data x value
+		Real64 invstep; // Inverse of the uniform bin width
+		Array1D_int firststep; // First data index with x value not below the start of each bin
+
+		// Default Constructor
+		uniformtable() :
+			xlow( 0.0 ),
+			invstep( 0.0 )
+		{}
+
+	};
+
+	struct materialtables
+	{
+		// Members
+		uniformtable iso; // Isotherm, indexed by relative humidity
+		uniformtable suc; // Liquid transport coefficient (suction), indexed by water content
+		uniformtable red; // Liquid transport coefficient (redistribution), indexed by water content
+		uniformtable mu; // Vapor diffusion resistance factor, indexed by relative humidity
+		uniformtable tc; // Thermal conductivity, indexed by water content
+
+		// Default Constructor
+		materialtables()
+		{}
+
+	};
+
 	// Object Data
 	extern Array1D< subcell > cells;
+	extern Array1D< materialtables > mattables;
 
 	// Functions
 
+	void
+	clear_state();
+
 	void
 	ManageHeatBalHAMT(
 		int const SurfNum,
@@ -227,6 +279,31 @@ namespace HeatBalanceHAMTManager {
 		Optional< Real64 > outgrad = _
 	);
 
+	void
+	SetupUniformTable(
+		int const ndata,
+		Array1A< Real64 > const xx,
+		uniformtable & table
+	);
+
+	void
+	interpuniform(
+		uniformtable const & table,
+		int const ndata,
+		Array1A< Real64 > const xx,
+		Array1A< Real64 > const yy,
+		Real64 const invalue,
+		Real64 & outvalue,
+		Optional< Real64 > outgrad = _
+	);
+
+	void
+	SolveBand(
+		int const firstcid,
+		int const lastcid,
+		Real64 const limit
+	);
+
 	Real64
 	RHtoVP(
 		Real64 const RH,
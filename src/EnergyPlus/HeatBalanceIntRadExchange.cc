@@ -143,6 +143,10 @@ namespace HeatBalanceIntRadExchange {
 	int MaxNumOfZoneSurfaces( 0 ); // Max saved to get large enough space for user input view factors
 	namespace {
 		bool CalcInteriorRadExchangefirstTime( true ); // Logical flag for one-time initializations
+		Array1D< Real64 > SendSurfaceTempInKto4thPrecalc;
+		bool ViewFactorReport; // Flag to output view factor report in eio file
+		bool InitInteriorRadExchangeErrorsFound( false );
+		int LargestSurf( 0 );
 	}
 	// SUBROUTINE SPECIFICATIONS FOR MODULE HeatBalanceIntRadExchange
 
@@ -152,6 +156,10 @@ namespace HeatBalanceIntRadExchange {
 	{
 		MaxNumOfZoneSurfaces = 0 ;
 		CalcInteriorRadExchangefirstTime = true;
+		SendSurfaceTempInKto4thPrecalc.deallocate();
+		ViewFactorReport = false;
+		InitInteriorRadExchangeErrorsFound = false;
+		LargestSurf = 0;
 	}
 
 	void
@@ -214,7 +222,6 @@ namespace HeatBalanceIntRadExchange {
 
 		//variables added as part of strategy to reduce calculation time - Glazer 2011-04-22
 		Real64 RecSurfTempInKTo4th; // Receiving surface temperature in K to 4th power
-		static Array1D< Real64 > SendSurfaceTempInKto4thPrecalc;
 
 		// FLOW:
 
@@ -538,8 +545,6 @@ namespace HeatBalanceIntRadExchange {
 		int Vindex; // index for vertices
 		int NumZonesWithUserFbyS; // Zones with user input,  used for flag here
 		bool NoUserInputF; // Logical flag signifying no input F's for zone
-		static bool ViewFactorReport; // Flag to output view factor report in eio file
-		static bool ErrorsFound( false );
 		Real64 CheckValue1;
 		Real64 CheckValue2;
 		Real64 FinalCheckValue;
@@ -631,7 +636,7 @@ namespace HeatBalanceIntRadExchange {
 
 			if ( NumZonesWithUserFbyS > 0 ) {
 
-				GetInputViewFactorsbyName( ZoneInfo( ZoneNum ).Name, NumOfZoneSurfaces, ZoneInfo( ZoneNum ).F, ZoneInfo( ZoneNum ).SurfacePtr, NoUserInputF, ErrorsFound ); // Obtains user input view factors from input file
+				GetInputViewFactorsbyName( ZoneInfo( ZoneNum ).Name, NumOfZoneSurfaces, ZoneInfo( ZoneNum ).F, ZoneInfo( ZoneNum ).SurfacePtr, NoUserInputF, InitInteriorRadExchangeErrorsFound ); // Obtains user input view factors from input file
 			}
 
 			if ( NoUserInputF ) {
@@ -786,7 +791,7 @@ namespace HeatBalanceIntRadExchange {
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( InitInteriorRadExchangeErrorsFound ) {
 			ShowFatalError( "InitInteriorRadExchange: Errors found during initialization of radiant exchange.  Program terminated." );
 		}
 
@@ -1168,7 +1173,6 @@ namespace HeatBalanceIntRadExchange {
 		bool Converged;
 		int i;
 		int j;
-		static int LargestSurf( 0 );
 
 		// FLOW:
 		OriginalCheckValue = std::abs( sum( F ) - N );
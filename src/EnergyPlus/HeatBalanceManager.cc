@@ -203,6 +203,34 @@ namespace HeatBalanceManager {
 		// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
 		// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
 		bool ManageHeatBalanceGetInputFlag( true );
+		bool GetHeatBalanceInputErrorsFound( false ); // If errors detected in input
+		bool DoReport( false );
+		int iTC( 0 );
+		int iMat( 0 );
+		bool NoRegularMaterialsUsed( true );
+		bool ChangeSet( true ); // Toggle for checking storm windows
+		bool FirstWarmupWrite( true );
+		bool WarmupConvergenceWarning( false );
+		bool SizingWarmupConvergenceWarning( false );
+		bool ReportWarmupConvergenceFirstWarmupWrite( true );
+		int W5DataFileNum;
+		int CreateTCConstructions_iTC( 0 );
+		int CreateTCConstructions_iMat( 0 );
+		int NumNewConst( 0 );
+		int iTCG( 0 );
+		Real64 Riw( 0.0 ); // thermal resistance of interior film coefficient under winter conditions (m2-K/W)
+		Real64 Row( 0.0 ); // theraml resistance of exterior film coefficient under winter conditions (m2-K/W)
+		Real64 Rlw( 0.0 ); // thermal resistance of block model layer (m2-K/W)
+		Real64 Ris( 0.0 ); // thermal resistance of interior film coefficient under summer conditions (m2-K/W)
+		Real64 Ros( 0.0 ); // theraml resistance of exterior film coefficient under summer conditions (m2-K/W)
+		Real64 InflowFraction( 0.0 ); // inward flowing fraction for SHGC, intermediate value non dimensional
+		Real64 SolarAbsorb( 0.0 ); // solar aborptance
+		bool SetupSimpleWindowGlazingSystemErrorsFound( false );
+		Real64 TsolLowSide( 0.0 ); // intermediate solar transmission for interpolating
+		Real64 TsolHiSide( 0.0 ); // intermediate solar transmission for interpolating
+		Real64 DeltaSHGCandTsol( 0.0 ); // intermediate difference
+		Real64 RLowSide( 0.0 );
+		Real64 RHiSide( 0.0 );
 	}
 
 
@@ -234,6 +262,10 @@ namespace HeatBalanceManager {
 	Array2D< Real64 > MaxLoadZoneRpt; // Maximum zone load for reporting calcs
 	int CountWarmupDayPoints; // Count of warmup timesteps (to achieve warmup)
 
+	Array1D< Real64 > WarmupStateLastDay; // Surface history state at the end of the last warmup day
+	Array1D< Real64 > WarmupStateChange; // Change in the surface history state over the last warmup day
+	int NumWarmupDaysTracked( 0 ); // Warmup days ending since the start of warmup or the last extrapolation
+
 	std::string CurrentModuleObject; // to assist in getting input
 
 	// Subroutine Specifications for the Heat Balance Module
@@ -283,8 +315,39 @@ namespace HeatBalanceManager {
 		LoadZoneRptStdDev.deallocate();
 		MaxLoadZoneRpt.deallocate();
 		CountWarmupDayPoints = int();
+		WarmupStateLastDay.deallocate();
+		WarmupStateChange.deallocate();
+		NumWarmupDaysTracked = 0;
 		CurrentModuleObject = std::string();
 		WarmupConvergenceValues.deallocate();
+		GetHeatBalanceInputErrorsFound = false;
+		DoReport = false;
+		iTC = 0;
+		iMat = 0;
+		NoRegularMaterialsUsed = true;
+		ChangeSet = true;
+		FirstWarmupWrite = true;
+		WarmupConvergenceWarning = false;
+		SizingWarmupConvergenceWarning = false;
+		ReportWarmupConvergenceFirstWarmupWrite = true;
+		W5DataFileNum = 0;
+		CreateTCConstructions_iTC = 0;
+		CreateTCConstructions_iMat = 0;
+		NumNewConst = 0;
+		iTCG = 0;
+		Riw = 0.0;
+		Row = 0.0;
+		Rlw = 0.0;
+		Ris = 0.0;
+		Ros = 0.0;
+		InflowFraction = 0.0;
+		SolarAbsorb = 0.0;
+		SetupSimpleWindowGlazingSystemErrorsFound = false;
+		TsolLowSide = 0.0;
+		TsolHiSide = 0.0;
+		DeltaSHGCandTsol = 0.0;
+		RLowSide = 0.0;
+		RHiSide = 0.0;
 	}
 
 	void
@@ -388,7 +451,11 @@ namespace HeatBalanceManager {
 				DayOfSim = 0; // Reset DayOfSim if Warmup converged
 				DayOfSimChr = "0";
 
+				if ( ! DataSystemVariables::WarmStartFileName.empty() ) HeatBalanceSurfaceManager::SaveWarmStartState();
+
 				ManageEMS( emsCallFromBeginNewEvironmentAfterWarmUp, anyRan ); // calling point
+			} else if ( WarmupConvergenceAcceleration ) {
+				AccelerateWarmup();
 			}
 
 		}
@@ -440,42 +507,41 @@ namespace HeatBalanceManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool ValidSimulationWithNoZones;
 
 		// FLOW:
 
-		GetProjectControlData( ErrorsFound );
+		GetProjectControlData( GetHeatBalanceInputErrorsFound );
 
-		GetSiteAtmosphereData( ErrorsFound );
+		GetSiteAtmosphereData( GetHeatBalanceInputErrorsFound );
 
-		GetWindowGlassSpectralData( ErrorsFound );
+		GetWindowGlassSpectralData( GetHeatBalanceInputErrorsFound );
 
-		GetMaterialData( ErrorsFound ); // Read materials from input file/transfer from legacy data structure
+		GetMaterialData( GetHeatBalanceInputErrorsFound ); // Read materials from input file/transfer from legacy data structure
 
-		GetFrameAndDividerData( ErrorsFound );
+		GetFrameAndDividerData( GetHeatBalanceInputErrorsFound );
 
-		GetConstructData( ErrorsFound ); // Read constructs from input file/transfer from legacy data structure
+		GetConstructData( GetHeatBalanceInputErrorsFound ); // Read constructs from input file/transfer from legacy data structure
 
-		GetBuildingData( ErrorsFound ); // Read building data from input file
+		GetBuildingData( GetHeatBalanceInputErrorsFound ); // Read building data from input file
 
 		// Added SV 6/26/2013 to load scheduled surface gains
-		GetScheduledSurfaceGains( ErrorsFound );
+		GetScheduledSurfaceGains( GetHeatBalanceInputErrorsFound );
 
 		// Added TH 1/9/2009 to create thermochromic window constructions
-		CreateTCConstructions( ErrorsFound );
+		CreateTCConstructions( GetHeatBalanceInputErrorsFound );
 
 		if ( TotSurfaces > 0 && NumOfZones == 0 ) {
 			ValidSimulationWithNoZones = CheckValidSimulationObjects();
 			if ( ! ValidSimulationWithNoZones ) {
 				ShowSevereError( "GetHeatBalanceInput: There are surfaces in input but no zones found.  Invalid simulation." );
-				ErrorsFound = true;
+				GetHeatBalanceInputErrorsFound = true;
 			}
 		}
 
-		CheckUsedConstructions( ErrorsFound );
+		CheckUsedConstructions( GetHeatBalanceInputErrorsFound );
 
-		if ( ErrorsFound ) {
+		if ( GetHeatBalanceInputErrorsFound ) {
 			ShowFatalError( "Errors found in Building Input, Program Stopped" );
 		}
 
@@ -857,6 +923,8 @@ namespace HeatBalanceManager {
 				ShowWarningError( RoutineName + CurrentModuleObject + ": " + cNumericFieldNames( 5 ) + " [" + RoundSigDigits( MinNumberOfWarmupDays ) + "]  is greater than " + cNumericFieldNames( 4 ) + " [" + RoundSigDigits( MaxNumberOfWarmupDays ) + "], " + RoundSigDigits( MinNumberOfWarmupDays ) + " will be used." );
 				MaxNumberOfWarmupDays = MinNumberOfWarmupDays;
 			}
+			// Warmup Convergence Acceleration
+			WarmupConvergenceAcceleration = ( NumAlpha >= 4 && SameString( AlphaName( 4 ), "Yes" ) );
 			if ( MinNumberOfWarmupDays < 6 ) {
 				ShowWarningError( RoutineName + CurrentModuleObject + ": " + cNumericFieldNames( 5 ) + " potentially invalid. Experience has shown that most files will converge within " + RoundSigDigits( DefaultMaxNumberOfWarmupDays ) + " warmup days. " );
 				ShowContinueError( "...Choosing less than " + RoundSigDigits( DefaultMinNumberOfWarmupDays ) + " warmup days may have adverse effects on the simulation results, particularly design day simulations. " );
@@ -1376,13 +1444,10 @@ namespace HeatBalanceManager {
 		Real64 ReflectivityVis; // Glass reflectivity, visible
 		Real64 TransmittivitySol; // Glass transmittivity, solar
 		Real64 TransmittivityVis; // Glass transmittivity, visible
-		static bool DoReport( false );
 		Real64 DenomRGas; // Denominator for WindowGas calculations of NominalR
 		Real64 Openness; // insect screen oppenness fraction = (1-d/s)^2
 
 		// Added TH 1/9/2009 to read the thermochromic glazings
-		static int iTC( 0 );
-		static int iMat( 0 );
 
 		// Added TH 7/27/2009 for constructions defined with F or C factro method
 		int TotFfactorConstructs; // Number of slabs-on-grade or underground floor constructions defined with F factors
@@ -3677,7 +3742,6 @@ namespace HeatBalanceManager {
 		bool ConstructionFound; // True if input window construction name is found in the
 		//  Window5 data file
 		bool EOFonW5File; // True if EOF encountered reading Window5 data file
-		static bool NoRegularMaterialsUsed( true );
 		int MaterialLayerGroup; // window contruction layer material group index
 
 		int iMatGlass; // number of glass layers
@@ -4505,7 +4569,6 @@ namespace HeatBalanceManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int StormWinNum; // Number of StormWindow object
 		int SurfNum; // Surface number
-		static bool ChangeSet( true ); // Toggle for checking storm windows
 
 		// FLOW:
 
@@ -4754,7 +4817,6 @@ namespace HeatBalanceManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ZoneNum;
 		int SurfNum;
-		static bool FirstWarmupWrite( true );
 
 		// Formats
 		static gio::Fmt Format_731( "(' Warmup Convergence Information, ',A,',',A,',',A,',',A,',',A)" );
@@ -4854,8 +4916,6 @@ namespace HeatBalanceManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ZoneNum;
-		static bool WarmupConvergenceWarning( false );
-		static bool SizingWarmupConvergenceWarning( false );
 		bool ConvergenceChecksFailed;
 
 		// Convergence criteria for warmup days:
@@ -4980,6 +5040,79 @@ namespace HeatBalanceManager {
 
 	}
 
+	void
+	AccelerateWarmup()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Speeds up warmup for buildings whose heavy mass makes the surface histories approach
+		// their periodic state slowly.
+
+		// METHODOLOGY EMPLOYED:
+		// Each warmup day repeats the same weather and schedules, so the surface history state at
+		// the end of a day is a (nearly linear) function of the state at the end of the day before.
+		// Once the approach is dominated by one slowly decaying mode, the change from one day to the
+		// next shrinks by a constant ratio r, and the remaining approach is the geometric series
+		// r/(1-r) times the last change.  The ratio is estimated from the last two daily changes;
+		// the state is only extrapolated when those changes point the same way and r is well below 1.
+		// Tracking restarts after each extrapolation.  The usual convergence checks still decide
+		// when warmup ends, so at least one full day is simulated from the extrapolated state.
+
+		// REFERENCES:
+		// Aitken delta-squared / minimal polynomial extrapolation of a fixed point iteration.
+
+		// Using/Aliasing
+		using HeatBalanceSurfaceManager::GetSurfaceHistoryState;
+		using HeatBalanceSurfaceManager::SetSurfaceHistoryState;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const MaxRatio( 0.9 ); // Largest daily decay ratio extrapolated (limits the step to 9 changes)
+		Real64 const MinAlignment( 0.9 ); // Smallest cosine of the angle between successive daily changes
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Array1D< Real64 > State; // Surface history state at the end of this warmup day
+
+		if ( DayOfSim <= 1 ) NumWarmupDaysTracked = 0; // New environment
+
+		GetSurfaceHistoryState( State );
+		if ( State.size() == 0u ) return;
+
+		if ( NumWarmupDaysTracked == 0 || State.size() != WarmupStateLastDay.size() ) {
+			WarmupStateLastDay = State;
+			NumWarmupDaysTracked = 1;
+			return;
+		}
+
+		Array1D< Real64 > Change( State - WarmupStateLastDay );
+		if ( NumWarmupDaysTracked >= 2 ) {
+			Real64 const ChangeDotLast( dot( Change, WarmupStateChange ) );
+			Real64 const LastDotLast( dot( WarmupStateChange, WarmupStateChange ) );
+			Real64 const ChangeDotChange( dot( Change, Change ) );
+			if ( LastDotLast > 0.0 && ChangeDotChange > 0.0 ) {
+				Real64 const Ratio( ChangeDotLast / LastDotLast );
+				Real64 const Alignment( ChangeDotLast / std::sqrt( LastDotLast * ChangeDotChange ) );
+				if ( Ratio > 0.0 && Ratio <= MaxRatio && Alignment >= MinAlignment ) {
+					State += ( Ratio / ( 1.0 - Ratio ) ) * Change;
+					SetSurfaceHistoryState( State );
+					WarmupStateLastDay = State;
+					NumWarmupDaysTracked = 1;
+					return;
+				}
+			}
+		}
+
+		WarmupStateChange = Change;
+		WarmupStateLastDay = State;
+		++NumWarmupDaysTracked;
+
+	}
+
 	void
 	ReportWarmupConvergence()
 	{
@@ -5017,7 +5150,6 @@ namespace HeatBalanceManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ZoneNum;
-		static bool FirstWarmupWrite( true );
 		Real64 AverageZoneTemp;
 		Real64 AverageZoneLoad;
 		Real64 StdDevZoneTemp;
@@ -5031,9 +5163,9 @@ namespace HeatBalanceManager {
 
 		if ( ! WarmupFlag ) { // Report out average/std dev
 			// Write Warmup Convervence Information to the initialization output file
-			if ( FirstWarmupWrite && NumOfZones > 0 ) {
+			if ( ReportWarmupConvergenceFirstWarmupWrite && NumOfZones > 0 ) {
 				gio::write( OutputFileInits, Format_730 );
-				FirstWarmupWrite = false;
+				ReportWarmupConvergenceFirstWarmupWrite = false;
 			}
 
 			TempZoneRptStdDev = 0.0;
@@ -5389,7 +5521,6 @@ namespace HeatBalanceManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int W5DataFileNum;
 		int FileLineCount; // counter for number of lines read (used in some error messages)
 		Array1D_string DataLine( 100 ); // Array of data lines
 		std::string NextLine; // Line of data
@@ -6817,18 +6948,14 @@ Label1000: ;
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		int Loop;
-		static int iTC( 0 );
-		static int iMat( 0 );
-		static int NumNewConst( 0 );
-		static int iTCG( 0 );
 
 		NumNewConst = 0;
 		for ( Loop = 1; Loop <= TotConstructs; ++Loop ) {
 			if ( Construct( Loop ).TCFlag == 1 ) {
 				iTCG = Material( Construct( Loop ).TCLayer ).TCParent;
 				if ( iTCG == 0 ) continue; // hope this was caught already
-				iMat = TCGlazings( iTCG ).NumGlzMat;
-				for ( iTC = 1; iTC <= iMat; ++iTC ) {
+				CreateTCConstructions_iMat = TCGlazings( iTCG ).NumGlzMat;
+				for ( CreateTCConstructions_iTC = 1; CreateTCConstructions_iTC <= CreateTCConstructions_iMat; ++CreateTCConstructions_iTC ) {
 					++NumNewConst;
 				}
 			}
@@ -6846,12 +6973,12 @@ Label1000: ;
 			if ( Construct( Loop ).TCFlag == 1 ) {
 				iTCG = Material( Construct( Loop ).TCLayer ).TCParent;
 				if ( iTCG == 0 ) continue; // hope this was caught already
-				iMat = TCGlazings( iTCG ).NumGlzMat;
-				for ( iTC = 1; iTC <= iMat; ++iTC ) {
+				CreateTCConstructions_iMat = TCGlazings( iTCG ).NumGlzMat;
+				for ( CreateTCConstructions_iTC = 1; CreateTCConstructions_iTC <= CreateTCConstructions_iMat; ++CreateTCConstructions_iTC ) {
 					++NumNewConst;
 					Construct( NumNewConst ) = Construct( Loop ); // copy data
-					Construct( NumNewConst ).Name = Construct( Loop ).Name + "_TC_" + RoundSigDigits( TCGlazings( iTCG ).SpecTemp( iTC ), 0 );
-					Construct( NumNewConst ).TCLayer = TCGlazings( iTCG ).LayerPoint( iTC );
+					Construct( NumNewConst ).Name = Construct( Loop ).Name + "_TC_" + RoundSigDigits( TCGlazings( iTCG ).SpecTemp( CreateTCConstructions_iTC ), 0 );
+					Construct( NumNewConst ).TCLayer = TCGlazings( iTCG ).LayerPoint( CreateTCConstructions_iTC );
 					Construct( NumNewConst ).LayerPoint( Construct( Loop ).TCLayerID ) = Construct( NumNewConst ).TCLayer;
 					Construct( NumNewConst ).TCFlag = 1;
 					Construct( NumNewConst ).TCMasterConst = Loop;
@@ -6901,19 +7028,6 @@ Label1000: ;
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 Riw( 0.0 ); // thermal resistance of interior film coefficient under winter conditions (m2-K/W)
-		static Real64 Row( 0.0 ); // theraml resistance of exterior film coefficient under winter conditions (m2-K/W)
-		static Real64 Rlw( 0.0 ); // thermal resistance of block model layer (m2-K/W)
-		static Real64 Ris( 0.0 ); // thermal resistance of interior film coefficient under summer conditions (m2-K/W)
-		static Real64 Ros( 0.0 ); // theraml resistance of exterior film coefficient under summer conditions (m2-K/W)
-		static Real64 InflowFraction( 0.0 ); // inward flowing fraction for SHGC, intermediate value non dimensional
-		static Real64 SolarAbsorb( 0.0 ); // solar aborptance
-		static bool ErrorsFound( false );
-		static Real64 TsolLowSide( 0.0 ); // intermediate solar transmission for interpolating
-		static Real64 TsolHiSide( 0.0 ); // intermediate solar transmission for interpolating
-		static Real64 DeltaSHGCandTsol( 0.0 ); // intermediate difference
-		static Real64 RLowSide( 0.0 );
-		static Real64 RHiSide( 0.0 );
 
 		// first fill out defaults
 		Material( MaterNum ).GlassSpectralDataPtr = 0;
@@ -6955,7 +7069,7 @@ Label1000: ;
 			NominalR( MaterNum ) = Rlw;
 			Material( MaterNum ).Resistance = Rlw;
 		} else {
-			ErrorsFound = true;
+			SetupSimpleWindowGlazingSystemErrorsFound = true;
 			ShowSevereError( "WindowMaterial:SimpleGlazingSystem: " + Material( MaterNum ).Name + " has Conductivity <= 0.0, must be >0.0, Check value of U-factor" );
 		}
 
@@ -7050,7 +7164,7 @@ Label1000: ;
 
 		//step 8.  Hemispherical terms are averaged using standard method
 
-		if ( ErrorsFound ) {
+		if ( SetupSimpleWindowGlazingSystemErrorsFound ) {
 			ShowFatalError( "Program halted because of input problem(s) in WindowMaterial:SimpleGlazingSystem" );
 		}
 
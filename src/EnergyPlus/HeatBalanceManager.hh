@@ -107,6 +107,10 @@ namespace HeatBalanceManager {
 	extern Array2D< Real64 > MaxLoadZoneRpt; // Maximum zone load for reporting calcs
 	extern int CountWarmupDayPoints; // Count of warmup timesteps (to achieve warmup)
 
+	extern Array1D< Real64 > WarmupStateLastDay; // Surface history state at the end of the last warmup day
+	extern Array1D< Real64 > WarmupStateChange; // Change in the surface history state over the last warmup day
+	extern int NumWarmupDaysTracked; // Warmup days ending since the start of warmup or the last extrapolation
+
 	extern std::string CurrentModuleObject; // to assist in getting input
 
 	// Subroutine Specifications for the Heat Balance Module
@@ -242,6 +246,9 @@ namespace HeatBalanceManager {
 	void
 	CheckWarmupConvergence();
 
+	void
+	AccelerateWarmup();
+
 	void
 	ReportWarmupConvergence();
 
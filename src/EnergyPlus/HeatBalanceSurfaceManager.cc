@@ -60,6 +60,10 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <map>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -71,6 +75,7 @@
 
 // EnergyPlus Headers
 #include <HeatBalanceSurfaceManager.hh>
+#include <Checkpoint.hh>
 #include <CommandLineInterface.hh>
 #include <ConvectionCoefficients.hh>
 #include <ChilledCeilingPanelSimple.hh>
@@ -194,6 +199,66 @@ namespace HeatBalanceSurfaceManager {
 		bool UpdateThermalHistoriesFirstTimeFlag( true );
 		bool CalculateZoneMRTfirstTime( true ); // Flag for first time calculations
 		bool calcHeatBalanceInsideSurfFirstTime( true ); // Used for trapping errors or other problems
+		bool WarmStartFileRead( false ); // True once the warm start file has been read
+
+		// Converged state of one environment saved at the end of warmup
+		struct WarmStartState
+		{
+			Array1D< Real64 > SurfaceHistories; // Surface temperature and flux histories
+			Array1D< Real64 > ZoneAir; // Zone air temperatures and humidity ratios
+			Array1D< Real64 > ZoneAirHistories; // Zone air temperature and humidity ratio histories
+		};
+
+		std::map< std::string, WarmStartState > WarmStartStates; // Saved state for each environment
+		Array1D< Real64 > WarmStartZoneAirHistories; // Zone air histories still to be restored with the zone set points
+		Real64 windowAreaWMult( 0.0 );
+		Real64 fenTotArea( 0.0 );
+		Real64 fenTotAreaNorth( 0.0 );
+		Real64 fenTotAreaNonNorth( 0.0 );
+		Real64 ufactArea( 0.0 );
+		Real64 ufactAreaNorth( 0.0 );
+		Real64 ufactAreaNonNorth( 0.0 );
+		Real64 shgcArea( 0.0 );
+		Real64 shgcAreaNorth( 0.0 );
+		Real64 shgcAreaNonNorth( 0.0 );
+		Real64 vistranArea( 0.0 );
+		Real64 vistranAreaNorth( 0.0 );
+		Real64 vistranAreaNonNorth( 0.0 );
+		Real64 intFenTotArea( 0.0 );
+		Real64 intUfactArea( 0.0 );
+		Real64 intShgcArea( 0.0 );
+		Real64 intVistranArea( 0.0 );
+		Array1D< Real64 > AbsDiffWin( CFSMAXNL ); // Diffuse solar absorptance of glass layers //Tuned Made static
+		Array1D< Real64 > AbsDiffWinGnd( CFSMAXNL ); // Ground diffuse solar absorptance of glass layers //Tuned Made static
+		Array1D< Real64 > AbsDiffWinSky( CFSMAXNL ); // Sky diffuse solar absorptance of glass layers //Tuned Made static
+		Real64 curQL( 0.0 ); // radiant value prior to adjustment for pulse for load component report
+		Real64 adjQL( 0.0 ); // radiant value including adjustment for pulse for load component report
+		Array1D_bool FirstCalcZone; // for error message
+		Array2D< Real64 > D;
+		bool SurfPropOverridesPresent( false ); // detect if EMS ever used for this and inits need to execute
+		bool SurfConstructOverridesPresent( false ); // detect if EMS ever used for this and inits need to execute
+		Array1D< Real64 > QExt1; // Heat flux at the exterior surface during first time step/series
+		Array1D< Real64 > QInt1; // Heat flux at the interior surface during first time step/series
+		Array1D< Real64 > TempInt1; // Temperature of interior surface during first time step/series
+		Array1D< Real64 > TempExt1; // Temperature of exterior surface during first time step/series
+		Array1D< Real64 > Qsrc1; // Heat source/sink (during first time step/series)
+		Array1D< Real64 > Tsrc1; // Temperature at source/sink (during first time step/series)
+		Array1D< Real64 > Tuser1; // Temperature at the user specified location (during first time step/series)
+		Array1D< Real64 > SumTime; // Amount of time that has elapsed from start of master history to
+		Array1D< Real64 > SurfaceAE; // Product of area and emissivity for each surface
+		Array1D< Real64 > ZoneAESum; // Sum of area times emissivity for all zone surfaces
+		int TimeStepInDay( 0 );
+		Array1D< Real64 > TempInsOld; // Holds previous iteration's value for convergence check
+		int MinIterations; // Minimum number of iterations for the inside heat balance
+		int ErrCount( 0 );
+		Array1D< Real64 > RefAirTemp; // reference air temperatures
+		bool MyEnvrnFlag( true );
+		int InsideSurfErrCount( 0 );
+		int CalcHeatBalanceInsideSurfWarmupSurfTemp;
+		int CalcHeatBalanceInsideSurfTimeStepInDay( 0 ); // time step number
+		int iZone( 0 );
+		int jSurf( 0 );
+		int GatherComponentLoadsSurfAbsFactTimeStepInDay( 0 );
 	}
 	// DERIVED TYPE DEFINITIONS:
 	// na
@@ -228,6 +293,57 @@ namespace HeatBalanceSurfaceManager {
 		UpdateThermalHistoriesFirstTimeFlag = true;
 		CalculateZoneMRTfirstTime = true;
 		calcHeatBalanceInsideSurfFirstTime = true;
+		WarmStartFileRead = false;
+		WarmStartStates.clear();
+		WarmStartZoneAirHistories.deallocate();
+		windowAreaWMult = 0.0;
+		fenTotArea = 0.0;
+		fenTotAreaNorth = 0.0;
+		fenTotAreaNonNorth = 0.0;
+		ufactArea = 0.0;
+		ufactAreaNorth = 0.0;
+		ufactAreaNonNorth = 0.0;
+		shgcArea = 0.0;
+		shgcAreaNorth = 0.0;
+		shgcAreaNonNorth = 0.0;
+		vistranArea = 0.0;
+		vistranAreaNorth = 0.0;
+		vistranAreaNonNorth = 0.0;
+		intFenTotArea = 0.0;
+		intUfactArea = 0.0;
+		intShgcArea = 0.0;
+		intVistranArea = 0.0;
+		AbsDiffWin = Array1D< Real64 >( CFSMAXNL );
+		AbsDiffWinGnd = Array1D< Real64 >( CFSMAXNL );
+		AbsDiffWinSky = Array1D< Real64 >( CFSMAXNL );
+		curQL = 0.0;
+		adjQL = 0.0;
+		FirstCalcZone.deallocate();
+		D.deallocate();
+		SurfPropOverridesPresent = false;
+		SurfConstructOverridesPresent = false;
+		QExt1.deallocate();
+		QInt1.deallocate();
+		TempInt1.deallocate();
+		TempExt1.deallocate();
+		Qsrc1.deallocate();
+		Tsrc1.deallocate();
+		Tuser1.deallocate();
+		SumTime.deallocate();
+		SurfaceAE.deallocate();
+		ZoneAESum.deallocate();
+		TimeStepInDay = 0;
+		TempInsOld.deallocate();
+		MinIterations = 0;
+		ErrCount = 0;
+		RefAirTemp.deallocate();
+		MyEnvrnFlag = true;
+		InsideSurfErrCount = 0;
+		CalcHeatBalanceInsideSurfWarmupSurfTemp = 0;
+		CalcHeatBalanceInsideSurfTimeStepInDay = 0;
+		iZone = 0;
+		jSurf = 0;
+		GatherComponentLoadsSurfAbsFactTimeStepInDay = 0;
 	}
 
 	void
@@ -469,6 +585,8 @@ namespace HeatBalanceSurfaceManager {
 		if ( BeginEnvrnFlag ) {
 			if ( InitSurfaceHeatBalancefirstTime ) DisplayString( "Initializing Temperature and Flux Histories" );
 			InitThermalAndFluxHistories(); // Set initial temperature and flux histories
+			if ( ! DataSystemVariables::WarmStartFileName.empty() ) RestoreWarmStartState();
+			Checkpoint::RestoreHeatBalanceState();
 		}
 
 		// There are no daily initializations done in this portion of the surface heat balance
@@ -876,23 +994,6 @@ namespace HeatBalanceSurfaceManager {
 		int errFlag;
 		int curWSC;
 		//following variables are totals for fenestration table
-		static Real64 windowAreaWMult( 0.0 );
-		static Real64 fenTotArea( 0.0 );
-		static Real64 fenTotAreaNorth( 0.0 );
-		static Real64 fenTotAreaNonNorth( 0.0 );
-		static Real64 ufactArea( 0.0 );
-		static Real64 ufactAreaNorth( 0.0 );
-		static Real64 ufactAreaNonNorth( 0.0 );
-		static Real64 shgcArea( 0.0 );
-		static Real64 shgcAreaNorth( 0.0 );
-		static Real64 shgcAreaNonNorth( 0.0 );
-		static Real64 vistranArea( 0.0 );
-		static Real64 vistranAreaNorth( 0.0 );
-		static Real64 vistranAreaNonNorth( 0.0 );
-		static Real64 intFenTotArea( 0.0 );
-		static Real64 intUfactArea( 0.0 );
-		static Real64 intShgcArea( 0.0 );
-		static Real64 intVistranArea( 0.0 );
 		bool isNorth;
 
 		numSurfaces = 0;
@@ -1743,6 +1844,272 @@ namespace HeatBalanceSurfaceManager {
 
 	}
 
+	namespace {
+		// Copies the surface history state between the CTF history arrays and a flat array.
+		// Only CTF surfaces are included: the other heat transfer algorithms keep their
+		// state in their own modules.
+		void
+		ExchangeSurfaceHistoryState(
+			Array1D< Real64 > & State, // Packed surface history state
+			bool const Gather // True to copy from the history arrays into State, false for the reverse
+		)
+		{
+			int NumStateSurfaces = 0;
+			for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				if ( Surface( SurfNum ).HeatTransSurf && Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CTF ) ++NumStateSurfaces;
+			}
+			int const ValuesPerSurface = 8 * MaxCTFTerms + 3 + ( AnyConstructInternalSourceInInput ? 6 * MaxCTFTerms : 0 );
+			if ( Gather ) State.dimension( NumStateSurfaces * ValuesPerSurface, 0.0 );
+			assert( State.isize() == NumStateSurfaces * ValuesPerSurface );
+
+			int Pos = 0;
+			auto exchange = [&]( Real64 & Value ) {
+				++Pos;
+				if ( Gather ) {
+					State( Pos ) = Value;
+				} else {
+					Value = State( Pos );
+				}
+			};
+			for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				if ( ! Surface( SurfNum ).HeatTransSurf || Surface( SurfNum ).HeatTransferAlgorithm != HeatTransferModel_CTF ) continue;
+				for ( int Term = 1; Term <= MaxCTFTerms; ++Term ) {
+					for ( int Side = 1; Side <= 2; ++Side ) {
+						exchange( TH( Side, Term, SurfNum ) );
+						exchange( QH( Side, Term, SurfNum ) );
+						exchange( THM( Side, Term, SurfNum ) );
+						exchange( QHM( Side, Term, SurfNum ) );
+					}
+				}
+				exchange( TempSurfIn( SurfNum ) );
+				exchange( TempSurfInTmp( SurfNum ) );
+				exchange( TempSurfOut( SurfNum ) );
+				if ( AnyConstructInternalSourceInInput ) {
+					for ( int Term = 1; Term <= MaxCTFTerms; ++Term ) {
+						exchange( TsrcHist( SurfNum, Term ) );
+						exchange( TuserHist( SurfNum, Term ) );
+						exchange( QsrcHist( SurfNum, Term ) );
+						exchange( TsrcHistM( SurfNum, Term ) );
+						exchange( TuserHistM( SurfNum, Term ) );
+						exchange( QsrcHistM( SurfNum, Term ) );
+					}
+				}
+			}
+		}
+	}
+
+	void
+	GetSurfaceHistoryState( Array1D< Real64 > & State ) // Packed surface history state
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Packs the temperature and flux histories of the CTF surfaces into one array so that
+		// the state carried from one day to the next can be extrapolated or saved.
+
+		ExchangeSurfaceHistoryState( State, true );
+
+	}
+
+	void
+	SetSurfaceHistoryState( Array1D< Real64 > const & State ) // Packed surface history state
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Unpacks a state from GetSurfaceHistoryState into the surface history arrays.
+
+		Array1D< Real64 > StateCopy( State );
+		ExchangeSurfaceHistoryState( StateCopy, false );
+
+	}
+
+	namespace {
+		// Reads a line "<name>,<number of values>" followed by the values
+		bool
+		ReadWarmStartSection(
+			std::istream & WarmStartFile,
+			std::string const & Name, // Section name
+			Array1D< Real64 > & Values
+		)
+		{
+			std::string Line;
+			if ( ! std::getline( WarmStartFile >> std::ws, Line ) || Line.compare( 0, Name.size() + 1, Name + ',' ) != 0 ) return false;
+			int const NumValues = std::atoi( Line.substr( Name.size() + 1 ).c_str() );
+			if ( NumValues < 0 ) return false;
+			Values.dimension( NumValues );
+			for ( auto & Value : Values ) {
+				if ( ! ( WarmStartFile >> Value ) ) return false;
+			}
+			return true;
+		}
+
+		void
+		WriteWarmStartSection(
+			std::ostream & WarmStartFile,
+			std::string const & Name, // Section name
+			Array1D< Real64 > const & Values
+		)
+		{
+			WarmStartFile << Name << ',' << Values.size() << '\n';
+			for ( auto const Value : Values ) WarmStartFile << Value << '\n';
+		}
+	}
+
+	void
+	ReadWarmStartFile()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reads the surface history and zone air states saved by earlier runs.
+
+		// METHODOLOGY EMPLOYED:
+		// The file holds, for each environment, a line "Environment,<name>" followed by the sections
+		// SurfaceHistories, ZoneAir and ZoneAirHistories, each a line "<section>,<number of values>"
+		// and the values.  A file that does not exist or cannot be read is ignored.
+
+		WarmStartFileRead = true;
+		WarmStartStates.clear();
+
+		std::ifstream WarmStartFile( DataSystemVariables::WarmStartFileName );
+		if ( ! WarmStartFile ) return;
+
+		std::string Line;
+		while ( std::getline( WarmStartFile, Line ) ) {
+			if ( Line.compare( 0, 12, "Environment," ) != 0 ) continue;
+			std::string const EnvName( Line.substr( 12 ) );
+			WarmStartState State;
+			if ( ! ReadWarmStartSection( WarmStartFile, "SurfaceHistories", State.SurfaceHistories ) || ! ReadWarmStartSection( WarmStartFile, "ZoneAir", State.ZoneAir ) || ! ReadWarmStartSection( WarmStartFile, "ZoneAirHistories", State.ZoneAirHistories ) ) {
+				ShowWarningError( "ReadWarmStartFile: Incomplete warm start state for Environment=\"" + EnvName + "\" in " + DataSystemVariables::WarmStartFileName + ", it will not be used." );
+				WarmStartStates.clear();
+				return;
+			}
+			WarmStartStates[ EnvName ] = State;
+		}
+
+	}
+
+	void
+	RestoreWarmStartState()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Replaces the initial temperature and flux histories and zone air conditions of the
+		// environment by the converged state saved by an earlier run on the same model, so that
+		// warmup starts close to the periodic state.  Warmup still runs until the convergence
+		// criteria are met.
+
+		// METHODOLOGY EMPLOYED:
+		// The zone air histories are reset later, with the zone set points, so they are kept
+		// until RestoreWarmStartZoneAirHistories is called from there.
+
+		if ( ! WarmStartFileRead ) ReadWarmStartFile();
+
+		auto const Saved = WarmStartStates.find( EnvironmentName );
+		if ( Saved == WarmStartStates.end() ) return;
+
+		Array1D< Real64 > SurfaceHistories;
+		Array1D< Real64 > ZoneAir;
+		GetSurfaceHistoryState( SurfaceHistories );
+		Checkpoint::ExchangeZoneAirState( ZoneAir, true );
+		if ( SurfaceHistories.size() != Saved->second.SurfaceHistories.size() || ZoneAir.size() != Saved->second.ZoneAir.size() ) {
+			ShowWarningError( "RestoreWarmStartState: Saved warm start state for Environment=\"" + EnvironmentName + "\" does not match the surfaces and zones of this model, it will not be used." );
+			return;
+		}
+		SetSurfaceHistoryState( Saved->second.SurfaceHistories );
+		ZoneAir = Saved->second.ZoneAir;
+		Checkpoint::ExchangeZoneAirState( ZoneAir, false );
+		WarmStartZoneAirHistories = Saved->second.ZoneAirHistories;
+		DisplayString( "Warm Starting Temperature and Flux Histories" );
+
+	}
+
+	void
+	RestoreWarmStartZoneAirHistories()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Replaces the zone air temperature and humidity ratio histories by those saved with the
+		// warm start state restored at the start of the environment, after the begin environment
+		// initializations of the zone set points.
+
+		if ( WarmStartZoneAirHistories.empty() ) return;
+
+		Array1D< Real64 > ZoneAirHistories;
+		Checkpoint::ExchangeZoneAirHistoryState( ZoneAirHistories, true );
+		if ( ZoneAirHistories.size() == WarmStartZoneAirHistories.size() ) {
+			Checkpoint::ExchangeZoneAirHistoryState( WarmStartZoneAirHistories, false );
+		} else {
+			ShowWarningError( "RestoreWarmStartZoneAirHistories: Saved zone air histories for Environment=\"" + EnvironmentName + "\" do not match the zones of this model, they will not be used." );
+		}
+		WarmStartZoneAirHistories.deallocate();
+
+	}
+
+	void
+	SaveWarmStartState()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Saves the converged temperature and flux histories and zone air state at the end of
+		// warmup for the current environment, keeping the states saved for the other environments.
+
+		if ( ! WarmStartFileRead ) ReadWarmStartFile();
+
+		auto & State( WarmStartStates[ EnvironmentName ] );
+		GetSurfaceHistoryState( State.SurfaceHistories );
+		Checkpoint::ExchangeZoneAirState( State.ZoneAir, true );
+		Checkpoint::ExchangeZoneAirHistoryState( State.ZoneAirHistories, true );
+
+		std::ofstream WarmStartFile( DataSystemVariables::WarmStartFileName );
+		if ( ! WarmStartFile ) {
+			ShowWarningError( "SaveWarmStartState: Could not open file " + DataSystemVariables::WarmStartFileName + " for output (write)." );
+			return;
+		}
+		WarmStartFile << std::setprecision( 17 );
+		for ( auto const & Saved : WarmStartStates ) {
+			WarmStartFile << "Environment," << Saved.first << '\n';
+			WriteWarmStartSection( WarmStartFile, "SurfaceHistories", Saved.second.SurfaceHistories );
+			WriteWarmStartSection( WarmStartFile, "ZoneAir", Saved.second.ZoneAir );
+			WriteWarmStartSection( WarmStartFile, "ZoneAirHistories", Saved.second.ZoneAirHistories );
+		}
+
+	}
+
 	void
 	InitSolarHeatGains()
 	{
@@ -1821,9 +2188,6 @@ namespace HeatBalanceSurfaceManager {
 		int TotGlassLay; // Number of glass layers
 		int TotSolidLay; // Number of solid layers in fenestration system (glass + shading)
 		int CurrentState; // Current state for Complex Fenestration
-		static Array1D< Real64 > AbsDiffWin( CFSMAXNL ); // Diffuse solar absorptance of glass layers //Tuned Made static
-		static Array1D< Real64 > AbsDiffWinGnd( CFSMAXNL ); // Ground diffuse solar absorptance of glass layers //Tuned Made static
-		static Array1D< Real64 > AbsDiffWinSky( CFSMAXNL ); // Sky diffuse solar absorptance of glass layers //Tuned Made static
 		int Lay; // Layer number
 		Real64 DividerAbs; // Window divider solar absorptance
 		Real64 DividerRefl; // Window divider solar reflectance
@@ -2706,8 +3070,6 @@ namespace HeatBalanceSurfaceManager {
 		Real64 AbsDiffBkBl; // Blind diffuse back solar absorptance as part of glazing system
 		Real64 EffBlEmiss; // Blind emissivity (thermal absorptance) as part of glazing system
 		Real64 pulseMultipler; // use to create a pulse for the load component report computations
-		static Real64 curQL( 0.0 ); // radiant value prior to adjustment for pulse for load component report
-		static Real64 adjQL( 0.0 ); // radiant value including adjustment for pulse for load component report
 		int EQLNum; // equivalent layer fenestration index
 		int Lay; // equivalent layer fenestration layer index
 
@@ -3295,7 +3657,6 @@ namespace HeatBalanceSurfaceManager {
 		Real64 DividerRefl; // Window divider short-wave reflectance
 
 
-		static Array1D_bool FirstCalcZone; // for error message
 
 		// FLOW:
 
@@ -3471,7 +3832,6 @@ namespace HeatBalanceSurfaceManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array2D< Real64 > D;
 		int SurfNum;
 		int IZ;
 		int JZ;
@@ -3616,7 +3976,6 @@ namespace HeatBalanceSurfaceManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool SurfPropOverridesPresent( false ); // detect if EMS ever used for this and inits need to execute
 		int MaterNum; // do loop counter over materials
 		int ConstrNum; // do loop counter over constructions
 		int TotLayers; // count of material layers in a construction
@@ -3713,7 +4072,6 @@ namespace HeatBalanceSurfaceManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool SurfConstructOverridesPresent( false ); // detect if EMS ever used for this and inits need to execute
 
 		if ( std::any_of( Surface.begin(), Surface.end(), []( DataSurfaces::SurfaceData const & e ){ return e.EMSConstructionOverrideON; } ) ) SurfConstructOverridesPresent = true;
 
@@ -3955,14 +4313,6 @@ namespace HeatBalanceSurfaceManager {
 		int SideNum; // DO loop counter for surfaces sides (inside, outside)
 		int SurfNum; // Surface number DO loop counter
 
-		static Array1D< Real64 > QExt1; // Heat flux at the exterior surface during first time step/series
-		static Array1D< Real64 > QInt1; // Heat flux at the interior surface during first time step/series
-		static Array1D< Real64 > TempInt1; // Temperature of interior surface during first time step/series
-		static Array1D< Real64 > TempExt1; // Temperature of exterior surface during first time step/series
-		static Array1D< Real64 > Qsrc1; // Heat source/sink (during first time step/series)
-		static Array1D< Real64 > Tsrc1; // Temperature at source/sink (during first time step/series)
-		static Array1D< Real64 > Tuser1; // Temperature at the user specified location (during first time step/series)
-		static Array1D< Real64 > SumTime; // Amount of time that has elapsed from start of master history to
 		// the current time step
 
 
@@ -4270,9 +4620,7 @@ namespace HeatBalanceSurfaceManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		Real64 SumAET; // Intermediate calculational variable (area*emissivity*T) sum
-		static Array1D< Real64 > SurfaceAE; // Product of area and emissivity for each surface
 		int SurfNum; // Surface number
-		static Array1D< Real64 > ZoneAESum; // Sum of area times emissivity for all zone surfaces
 		int ZoneNum; // Zone number
 
 		// FLOW:
@@ -4362,7 +4710,6 @@ namespace HeatBalanceSurfaceManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int SurfNum;
 		int ZoneNum;
-		static int TimeStepInDay( 0 );
 
 		ZoneMRT( {1,NumOfZones} ) = MRT( {1,NumOfZones} );
 
@@ -5144,15 +5491,12 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	int RoughSurf; // Outside surface roughness
 	Real64 EmisOut; // Glass outside surface emissivity
 
-	static Array1D< Real64 > TempInsOld; // Holds previous iteration's value for convergence check
 	Real64 TempSurfOutTmp; // Local Temporary Surface temperature for the outside surface face
 	Real64 TempSurfInSat; // Local temperary surface dew point temperature
 
 	int OtherSideSurfNum; // Surface number index for other side of an interzone partition
-	static int MinIterations; // Minimum number of iterations for the inside heat balance
 	//  CHARACTER(len=25):: ErrMsg
 	//  CHARACTER(len=5) :: TimeStmp
-	static int ErrCount( 0 );
 	int PipeNum; // TDD pipe object number
 	int SurfNum2; // TDD:DIFFUSER object number
 	Real64 Ueff; // 1 / effective R value between TDD:DOME and TDD:DIFFUSER
@@ -5165,15 +5509,10 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	Real64 MassFlowRate;
 	Real64 NodeTemp;
 	Real64 CpAir;
-	static Array1D< Real64 > RefAirTemp; // reference air temperatures
-	static bool MyEnvrnFlag( true );
 	//  LOGICAL, SAVE     :: DoThisLoop
-	static int InsideSurfErrCount( 0 );
 	Real64 Wsurf; // Moisture ratio for HAMT
 	Real64 RhoAirZone; // Zone moisture density for HAMT
 	int OtherSideZoneNum; // Zone Number index for other side of an interzone partition HAMT
-	static int WarmupSurfTemp;
-	static int TimeStepInDay( 0 ); // time step number
 
 	// FLOW:
 	if ( calcHeatBalanceInsideSurfFirstTime ) {
@@ -5192,7 +5531,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 		TempInsOld = 23.0;
 		RefAirTemp = 23.0;
 		TempEffBulkAir = 23.0;
-		WarmupSurfTemp = 0;
+		CalcHeatBalanceInsideSurfWarmupSurfTemp = 0;
 		MyEnvrnFlag = false;
 	}
 	if ( ! BeginEnvrnFlag ) {
@@ -5663,12 +6002,12 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 			// sizing for both the normal and pulse cases so that load components can be derived later.
 			if ( ZoneSizingCalc && CompLoadReportIsReq ) {
 				if ( ! WarmupFlag ) {
-					TimeStepInDay = ( HourOfDay - 1 ) * NumOfTimeStepInHour + TimeStep;
+					CalcHeatBalanceInsideSurfTimeStepInDay = ( HourOfDay - 1 ) * NumOfTimeStepInHour + TimeStep;
 					if ( isPulseZoneSizing ) {
-						loadConvectedWithPulse( CurOverallSimDay, TimeStepInDay, SurfNum ) = QdotConvInRep( SurfNum );
+						loadConvectedWithPulse( CurOverallSimDay, CalcHeatBalanceInsideSurfTimeStepInDay, SurfNum ) = QdotConvInRep( SurfNum );
 					} else {
-						loadConvectedNormal( CurOverallSimDay, TimeStepInDay, SurfNum ) = QdotConvInRep( SurfNum );
-						netSurfRadSeq( CurOverallSimDay, TimeStepInDay, SurfNum ) = QdotRadNetSurfInRep( SurfNum );
+						loadConvectedNormal( CurOverallSimDay, CalcHeatBalanceInsideSurfTimeStepInDay, SurfNum ) = QdotConvInRep( SurfNum );
+						netSurfRadSeq( CurOverallSimDay, CalcHeatBalanceInsideSurfTimeStepInDay, SurfNum ) = QdotRadNetSurfInRep( SurfNum );
 					}
 				}
 			}
@@ -5689,7 +6028,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 			}
 
 			if ( ( TH12 > MaxSurfaceTempLimit ) || ( TH12 < MinSurfaceTempLimit ) ) {
-				TestSurfTempCalcHeatBalanceInsideSurf( TH12, surface, zone, WarmupSurfTemp );
+				TestSurfTempCalcHeatBalanceInsideSurf( TH12, surface, zone, CalcHeatBalanceInsideSurfWarmupSurfTemp );
 			}
 
 		} // ...end of loop over all surfaces for inside heat balances
@@ -6391,20 +6730,17 @@ GatherComponentLoadsSurfAbsFact()
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	static int iZone( 0 );
-	static int jSurf( 0 );
-	static int TimeStepInDay( 0 );
 
 	if ( CompLoadReportIsReq && ! isPulseZoneSizing ) {
-		TimeStepInDay = ( HourOfDay - 1 ) * NumOfTimeStepInHour + TimeStep;
+		GatherComponentLoadsSurfAbsFactTimeStepInDay = ( HourOfDay - 1 ) * NumOfTimeStepInHour + TimeStep;
 		for ( iZone = 1; iZone <= NumOfZones; ++iZone ) {
-			TMULTseq( CurOverallSimDay, TimeStepInDay, iZone ) = TMULT( iZone );
+			TMULTseq( CurOverallSimDay, GatherComponentLoadsSurfAbsFactTimeStepInDay, iZone ) = TMULT( iZone );
 		}
 		for ( jSurf = 1; jSurf <= TotSurfaces; ++jSurf ) {
 			iZone = Surface( jSurf ).Zone;
 			if ( ! Surface( jSurf ).HeatTransSurf || iZone == 0 ) continue; // Skip non-heat transfer surfaces
 			if ( Surface( jSurf ).Class == SurfaceClass_TDD_Dome ) continue; // Skip tubular daylighting device domes
-			ITABSFseq( CurOverallSimDay, TimeStepInDay, jSurf ) = ITABSF( jSurf );
+			ITABSFseq( CurOverallSimDay, GatherComponentLoadsSurfAbsFactTimeStepInDay, jSurf ) = ITABSF( jSurf );
 		}
 	}
 }
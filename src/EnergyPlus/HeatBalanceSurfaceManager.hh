@@ -60,6 +60,7 @@
 #define HeatBalanceSurfaceManager_hh_INCLUDED
 
 // ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Optional.hh>
 
 // EnergyPlus Headers
@@ -122,6 +123,24 @@ namespace HeatBalanceSurfaceManager {
 	void
 	InitThermalAndFluxHistories();
 
+	void
+	GetSurfaceHistoryState( Array1D< Real64 > & State ); // Packed surface history state
+
+	void
+	SetSurfaceHistoryState( Array1D< Real64 > const & State ); // Packed surface history state
+
+	void
+	ReadWarmStartFile();
+
+	void
+	RestoreWarmStartState();
+
+	void
+	RestoreWarmStartZoneAirHistories();
+
+	void
+	SaveWarmStartState();
+
 	void
 	InitSolarHeatGains();
 
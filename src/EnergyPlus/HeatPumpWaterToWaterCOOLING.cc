@@ -138,6 +138,54 @@ namespace HeatPumpWaterToWaterCOOLING {
 	Array1D< GshpSpecs > GSHP; // dimension to number of machines
 	Array1D< ReportVars > GSHPReport;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInput( true ); // then TRUE, calls subroutine to read input file.
+		bool ErrorsFound( false );
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool MyPlanScanFlag;
+		bool MyOneTimeFlag( true );
+		Real64 CurrentSimTime( 0.0 );
+		Real64 PrevSimTime( 0.0 );
+		bool OneTimeFlag( true );
+	}
+
+	// Functions
+
+	// Clears the global data in HeatPumpWaterToWaterCOOLING.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		CheckEquipName.deallocate();
+		GSHPRefrigerant = "R22";
+		GSHPRefrigIndex = 0;
+		NumGSHPs = 0;
+		LoadSideWaterMassFlowRate = 0.0;
+		SourceSideWaterMassFlowRate = 0.0;
+		Power = 0.0;
+		QLoad = 0.0;
+		QSource = 0.0;
+		SourceSideWaterOutletTemp = 0.0;
+		SourceSideWaterInletTemp = 0.0;
+		LoadSideWaterOutletTemp = 0.0;
+		LoadSideWaterInletTemp = 0.0;
+		GSHP.deallocate();
+		GSHPReport.deallocate();
+		GetInput = true;
+		ErrorsFound = false;
+		MyEnvrnFlag.deallocate();
+		MyPlanScanFlag.deallocate();
+		MyOneTimeFlag = true;
+		CurrentSimTime = 0.0;
+		PrevSimTime = 0.0;
+		OneTimeFlag = true;
+	}
+
 	void
 	SimHPWatertoWaterCOOLING(
 		std::string const & GSHPType, // type ofGSHP
@@ -186,7 +234,6 @@ namespace HeatPumpWaterToWaterCOOLING {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInput( true ); // then TRUE, calls subroutine to read input file.
 		int GSHPNum;
 
 		//Get input from IDF
@@ -288,7 +335,6 @@ namespace HeatPumpWaterToWaterCOOLING {
 		Array1D_string AlphArray( 5 ); // character string data
 		Array1D< Real64 > NumArray( 23 ); // numeric data
 
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool errFlag;
@@ -501,9 +547,6 @@ namespace HeatPumpWaterToWaterCOOLING {
 		static std::string const RoutineName( "InitGshp" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool MyPlanScanFlag;
-		static bool MyOneTimeFlag( true );
 		Real64 rho; // local fluid density
 		bool errFlag;
 
@@ -665,9 +708,6 @@ namespace HeatPumpWaterToWaterCOOLING {
 		Real64 DutyFactor;
 		int IterationCount;
 
-		static Real64 CurrentSimTime( 0.0 );
-		static Real64 PrevSimTime( 0.0 );
-		static bool OneTimeFlag( true );
 		// Nodes
 		int SourceSideInletNode; // Source Side inlet node number, water side
 		int SourceSideOutletNode; // Source Side outlet node number, water side
@@ -236,6 +236,11 @@ namespace HeatPumpWaterToWaterCOOLING {
 
 	// Functions
 
+	// Clears the global data in HeatPumpWaterToWaterCOOLING.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimHPWatertoWaterCOOLING(
 		std::string const & GSHPType, // type ofGSHP
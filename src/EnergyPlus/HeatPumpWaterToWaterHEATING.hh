@@ -237,6 +237,11 @@ namespace HeatPumpWaterToWaterHEATING {
 
 	// Functions
 
+	// Clears the global data in HeatPumpWaterToWaterHEATING.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimHPWatertoWaterHEATING(
 		std::string const & GSHPType, // type ofGSHP
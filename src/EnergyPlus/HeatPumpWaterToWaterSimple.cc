@@ -130,6 +130,12 @@ namespace HeatPumpWaterToWaterSimple {
 	namespace {
 		bool GetInputFlag( true ); // then TRUE, calls subroutine to read input file.
 		bool InitWatertoWaterHPOneTimeFlag( true );
+		bool ErrorsFound( false );
+		Array1D_bool MyEnvrnFlag; // Flag required to keep track of initialization
+		bool OneTimeFlag( true ); // One Time Flag
+		Real64 CurrentSimTime( 0.0 ); // Current Simulation Time
+		Real64 PrevSimTime( 0.0 ); // Previous Simulation Time
+		Array1D_bool MyPlanScanFlag;
 	}
 
 	// Object Data
@@ -143,6 +149,12 @@ namespace HeatPumpWaterToWaterSimple {
 		InitWatertoWaterHPOneTimeFlag = true;
 		GSHP.deallocate();
 		GSHPReport.deallocate();
+		ErrorsFound = false;
+		MyEnvrnFlag.deallocate();
+		OneTimeFlag = true;
+		CurrentSimTime = 0.0;
+		PrevSimTime = 0.0;
+		MyPlanScanFlag.deallocate();
 	}
 
 	void
@@ -309,7 +321,6 @@ namespace HeatPumpWaterToWaterSimple {
 		Array1D_string AlphArray( 5 ); // character string data
 		Array1D< Real64 > NumArray( 15 ); // numeric data
 
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool errFlag;
@@ -511,11 +522,6 @@ namespace HeatPumpWaterToWaterSimple {
 		int LoadSideOutletNode; // Load Side Outlet Node
 		int SourceSideInletNode; // Source Side Inlet Node
 		int SourceSideOutletNode; // Source Side Outlet Node
-		static Array1D_bool MyEnvrnFlag; // Flag required to keep track of initialization
-		static bool OneTimeFlag( true ); // One Time Flag
-		static Real64 CurrentSimTime( 0.0 ); // Current Simulation Time
-		static Real64 PrevSimTime( 0.0 ); // Previous Simulation Time
-		static Array1D_bool MyPlanScanFlag;
 
 		int LoopNum;
 		int LoopSideNum;
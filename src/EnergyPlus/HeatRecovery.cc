@@ -163,6 +163,61 @@ namespace HeatRecovery {
 
 	namespace {
 		bool MyOneTimeAllocate( true );
+		bool GetHeatRecoveryInputErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		std::string HeatExchPerfType; // Desiccant balanced heat exchanger performance data type
+		Array1D_bool MySetPointTest;
+		Array1D_bool MySizeFlag;
+		Real64 NTU0( 0.0 ); // lower bound for NTU
+		Real64 NTU1( 50.0 ); // upper bound for NTU
+		std::string OutputChar; // character string for warning messages
+		std::string OutputCharLo; // character string for warning messages
+		std::string OutputCharHi; // character string for warning messages
+		std::string CharValue; // character string for warning messages
+		Real64 TimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
+		Real64 CurrentEndTime( 0.0 ); // end time of time step for current simulation time step
+		Real64 CurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
+		std::string CheckModelBoundsHumRatEqOutputChar; // character string for warning messages
+		std::string CheckModelBoundsHumRatEqOutputCharLo; // character string for warning messages
+		std::string CheckModelBoundsHumRatEqOutputCharHi; // character string for warning messages
+		std::string CheckModelBoundsHumRatEqCharValue; // character string for warning messages
+		Real64 CheckModelBoundsHumRatEqTimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
+		Real64 CheckModelBoundsHumRatEqCurrentEndTime( 0.0 ); // end time of time step for current simulation time step
+		Real64 CheckModelBoundsHumRatEqCurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
+		std::string CheckModelBoundOutput_TempOutputChar; // character string for warning messages
+		std::string CheckModelBoundOutput_TempOutputCharLo; // character string for warning messages
+		std::string CheckModelBoundOutput_TempOutputCharHi; // character string for warning messages
+		std::string CheckModelBoundOutput_TempCharValue; // character string for warning messages
+		Real64 CheckModelBoundOutput_TempTimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
+		Real64 CheckModelBoundOutput_TempCurrentEndTime( 0.0 ); // end time of time step for current simulation time step
+		Real64 CheckModelBoundOutput_TempCurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
+		std::string CheckModelBoundOutput_HumRatOutputChar; // character string for warning messages
+		std::string CheckModelBoundOutput_HumRatOutputCharLo; // character string for warning messages
+		std::string CheckModelBoundOutput_HumRatOutputCharHi; // character string for warning messages
+		std::string CheckModelBoundOutput_HumRatCharValue; // character string for warning messages
+		Real64 CheckModelBoundOutput_HumRatTimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
+		Real64 CheckModelBoundOutput_HumRatCurrentEndTime( 0.0 ); // end time of time step for current simulation time step
+		Real64 CheckModelBoundOutput_HumRatCurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
+		Real64 RegenInletRH( 0.0 ); // Regeneration inlet air relative humidity
+		Real64 ProcInletRH( 0.0 ); // Process inlet air relative humidity
+		std::string CheckModelBoundsRH_TempEqOutputChar; // character string for warning messages
+		std::string CheckModelBoundsRH_TempEqOutputCharLo; // character string for warning messages
+		std::string CheckModelBoundsRH_TempEqOutputCharHi; // character string for warning messages
+		Real64 CheckModelBoundsRH_TempEqTimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
+		Real64 CheckModelBoundsRH_TempEqCurrentEndTime( 0.0 ); // end time of time step for current simulation time step
+		Real64 CheckModelBoundsRH_TempEqCurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
+		Real64 CheckModelBoundsRH_HumRatEqRegenInletRH( 0.0 ); // Regeneration inlet air relative humidity
+		Real64 CheckModelBoundsRH_HumRatEqProcInletRH( 0.0 ); // Process inlet air relative humidity
+		std::string CheckModelBoundsRH_HumRatEqOutputChar; // character string for warning messages
+		std::string CheckModelBoundsRH_HumRatEqOutputCharLo; // character string for warning messages
+		std::string CheckModelBoundsRH_HumRatEqOutputCharHi; // character string for warning messages
+		Real64 CheckModelBoundsRH_HumRatEqTimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
+		Real64 CheckModelBoundsRH_HumRatEqCurrentEndTime( 0.0 ); // end time of time step for current simulation time step
+		Real64 CheckModelBoundsRH_HumRatEqCurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
+		std::string OutputCharProc; // character string for warning messages
+		std::string OutputCharRegen; // character string for warning messages
+		Real64 CheckForBalancedFlowTimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
+		Real64 CheckForBalancedFlowCurrentEndTime( 0.0 ); // end time of time step for current simulation time step
+		Real64 CheckForBalancedFlowCurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
 	}
 
 	// DERIVED TYPE DEFINITIONS:
@@ -221,6 +276,61 @@ namespace HeatRecovery {
 		MyOneTimeAllocate = true;
 		HeatExchCondNumericFields.deallocate();
 		BalDesDehumPerfNumericFields.deallocate();
+		GetHeatRecoveryInputErrorsFound = false;
+		HeatExchPerfType.clear();
+		MySetPointTest.deallocate();
+		MySizeFlag.deallocate();
+		NTU0 = 0.0;
+		NTU1 = 50.0;
+		OutputChar.clear();
+		OutputCharLo.clear();
+		OutputCharHi.clear();
+		CharValue.clear();
+		TimeStepSysLast = 0.0;
+		CurrentEndTime = 0.0;
+		CurrentEndTimeLast = 0.0;
+		CheckModelBoundsHumRatEqOutputChar.clear();
+		CheckModelBoundsHumRatEqOutputCharLo.clear();
+		CheckModelBoundsHumRatEqOutputCharHi.clear();
+		CheckModelBoundsHumRatEqCharValue.clear();
+		CheckModelBoundsHumRatEqTimeStepSysLast = 0.0;
+		CheckModelBoundsHumRatEqCurrentEndTime = 0.0;
+		CheckModelBoundsHumRatEqCurrentEndTimeLast = 0.0;
+		CheckModelBoundOutput_TempOutputChar.clear();
+		CheckModelBoundOutput_TempOutputCharLo.clear();
+		CheckModelBoundOutput_TempOutputCharHi.clear();
+		CheckModelBoundOutput_TempCharValue.clear();
+		CheckModelBoundOutput_TempTimeStepSysLast = 0.0;
+		CheckModelBoundOutput_TempCurrentEndTime = 0.0;
+		CheckModelBoundOutput_TempCurrentEndTimeLast = 0.0;
+		CheckModelBoundOutput_HumRatOutputChar.clear();
+		CheckModelBoundOutput_HumRatOutputCharLo.clear();
+		CheckModelBoundOutput_HumRatOutputCharHi.clear();
+		CheckModelBoundOutput_HumRatCharValue.clear();
+		CheckModelBoundOutput_HumRatTimeStepSysLast = 0.0;
+		CheckModelBoundOutput_HumRatCurrentEndTime = 0.0;
+		CheckModelBoundOutput_HumRatCurrentEndTimeLast = 0.0;
+		RegenInletRH = 0.0;
+		ProcInletRH = 0.0;
+		CheckModelBoundsRH_TempEqOutputChar.clear();
+		CheckModelBoundsRH_TempEqOutputCharLo.clear();
+		CheckModelBoundsRH_TempEqOutputCharHi.clear();
+		CheckModelBoundsRH_TempEqTimeStepSysLast = 0.0;
+		CheckModelBoundsRH_TempEqCurrentEndTime = 0.0;
+		CheckModelBoundsRH_TempEqCurrentEndTimeLast = 0.0;
+		CheckModelBoundsRH_HumRatEqRegenInletRH = 0.0;
+		CheckModelBoundsRH_HumRatEqProcInletRH = 0.0;
+		CheckModelBoundsRH_HumRatEqOutputChar.clear();
+		CheckModelBoundsRH_HumRatEqOutputCharLo.clear();
+		CheckModelBoundsRH_HumRatEqOutputCharHi.clear();
+		CheckModelBoundsRH_HumRatEqTimeStepSysLast = 0.0;
+		CheckModelBoundsRH_HumRatEqCurrentEndTime = 0.0;
+		CheckModelBoundsRH_HumRatEqCurrentEndTimeLast = 0.0;
+		OutputCharProc.clear();
+		OutputCharRegen.clear();
+		CheckForBalancedFlowTimeStepSysLast = 0.0;
+		CheckForBalancedFlowCurrentEndTime = 0.0;
+		CheckForBalancedFlowCurrentEndTimeLast = 0.0;
 	}
 
 	void
@@ -407,10 +517,8 @@ namespace HeatRecovery {
 		int NumAlphas; // Number of Alphas for each GetObjectItem call
 		int NumNumbers; // Number of Numbers for each GetObjectItem call
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
-		static std::string HeatExchPerfType; // Desiccant balanced heat exchanger performance data type
 		static std::string const RoutineName( "GetHeatRecoveryInput: " ); // include trailing blank space
 
 		NumAirToAirPlateExchs = GetNumObjectsFound( "HeatExchanger:AirToAir:FlatPlate" );
@@ -443,7 +551,7 @@ namespace HeatRecovery {
 			IsBlank = false;
 			VerifyName( cAlphaArgs( 1 ), ExchCond, ExchNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 			}
 			ExchCond( ExchNum ).Name = cAlphaArgs( 1 );
@@ -454,7 +562,7 @@ namespace HeatRecovery {
 				ExchCond( ExchNum ).SchedPtr = GetScheduleIndex( cAlphaArgs( 2 ) );
 				if ( ExchCond( ExchNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + ": invalid " + cAlphaFieldNames( 2 ) + " entered =" + cAlphaArgs( 2 ) + " for " + cAlphaFieldNames( 1 ) + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetHeatRecoveryInputErrorsFound = true;
 				}
 			}
 			{ auto const SELECT_CASE_var( cAlphaArgs( 3 ) );
@@ -466,7 +574,7 @@ namespace HeatRecovery {
 				ExchCond( ExchNum ).FlowArr = Cross_Flow_Both_Unmixed;
 			} else {
 				ShowSevereError( cCurrentModuleObject + ": incorrect flow arrangement: " + cAlphaArgs( 3 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}}
 			{ auto const SELECT_CASE_var( cAlphaArgs( 4 ) );
 			if ( SELECT_CASE_var == "YES" ) {
@@ -478,7 +586,7 @@ namespace HeatRecovery {
 					ExchCond( ExchNum ).EconoLockOut = EconoLockOut_Yes;
 				} else {
 					ShowSevereError( cCurrentModuleObject + ": incorrect econo lockout: " + cAlphaArgs( 4 ) );
-					ErrorsFound = true;
+					GetHeatRecoveryInputErrorsFound = true;
 				}
 			}}
 			ExchCond( ExchNum ).hARatio = rNumericArgs( 1 );
@@ -488,10 +596,10 @@ namespace HeatRecovery {
 			ExchCond( ExchNum ).NomSecAirVolFlow = rNumericArgs( 5 );
 			ExchCond( ExchNum ).NomSecAirInTemp = rNumericArgs( 6 );
 			ExchCond( ExchNum ).NomElecPower = rNumericArgs( 7 );
-			ExchCond( ExchNum ).SupInletNode = GetOnlySingleNode( cAlphaArgs( 5 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			ExchCond( ExchNum ).SupOutletNode = GetOnlySingleNode( cAlphaArgs( 6 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
-			ExchCond( ExchNum ).SecInletNode = GetOnlySingleNode( cAlphaArgs( 7 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
-			ExchCond( ExchNum ).SecOutletNode = GetOnlySingleNode( cAlphaArgs( 8 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+			ExchCond( ExchNum ).SupInletNode = GetOnlySingleNode( cAlphaArgs( 5 ), GetHeatRecoveryInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			ExchCond( ExchNum ).SupOutletNode = GetOnlySingleNode( cAlphaArgs( 6 ), GetHeatRecoveryInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			ExchCond( ExchNum ).SecInletNode = GetOnlySingleNode( cAlphaArgs( 7 ), GetHeatRecoveryInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+			ExchCond( ExchNum ).SecOutletNode = GetOnlySingleNode( cAlphaArgs( 8 ), GetHeatRecoveryInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
 
 			TestCompSet( cHXTypes( ExchCond( ExchNum ).ExchTypeNum ), ExchCond( ExchNum ).Name, cAlphaArgs( 5 ), cAlphaArgs( 6 ), "Process Air Nodes" );
 
@@ -511,7 +619,7 @@ namespace HeatRecovery {
 			IsBlank = false;
 			VerifyName( cAlphaArgs( 1 ), ExchCond, ExchNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 			}
 			ExchCond( ExchNum ).Name = cAlphaArgs( 1 );
@@ -522,7 +630,7 @@ namespace HeatRecovery {
 				ExchCond( ExchNum ).SchedPtr = GetScheduleIndex( cAlphaArgs( 2 ) );
 				if ( ExchCond( ExchNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + ": invalid " + cAlphaFieldNames( 2 ) + " entered =" + cAlphaArgs( 2 ) + " for " + cAlphaFieldNames( 1 ) + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetHeatRecoveryInputErrorsFound = true;
 				}
 			}
 			ExchCond( ExchNum ).NomSupAirVolFlow = rNumericArgs( 1 );
@@ -550,10 +658,10 @@ namespace HeatRecovery {
 				ShowWarningError( cCurrentModuleObject + " \"" + ExchCond( ExchNum ).Name + "\" latent cooling effectiveness at 75% rated flow is less than at 100% rated flow." );
 				ShowContinueError( "Latent cooling effectiveness at 75% rated flow is usually greater than at 100% rated flow." );
 			}
-			ExchCond( ExchNum ).SupInletNode = GetOnlySingleNode( cAlphaArgs( 3 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			ExchCond( ExchNum ).SupOutletNode = GetOnlySingleNode( cAlphaArgs( 4 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
-			ExchCond( ExchNum ).SecInletNode = GetOnlySingleNode( cAlphaArgs( 5 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
-			ExchCond( ExchNum ).SecOutletNode = GetOnlySingleNode( cAlphaArgs( 6 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+			ExchCond( ExchNum ).SupInletNode = GetOnlySingleNode( cAlphaArgs( 3 ), GetHeatRecoveryInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			ExchCond( ExchNum ).SupOutletNode = GetOnlySingleNode( cAlphaArgs( 4 ), GetHeatRecoveryInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			ExchCond( ExchNum ).SecInletNode = GetOnlySingleNode( cAlphaArgs( 5 ), GetHeatRecoveryInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+			ExchCond( ExchNum ).SecOutletNode = GetOnlySingleNode( cAlphaArgs( 6 ), GetHeatRecoveryInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
 
 			ExchCond( ExchNum ).NomElecPower = rNumericArgs( 10 );
 
@@ -563,7 +671,7 @@ namespace HeatRecovery {
 				if ( ! SameString( cAlphaArgs( 7 ), "No" ) ) {
 					ShowSevereError( "Rotary HX Speed Modulation or Plate Bypass for Temperature Control for " );
 					ShowContinueError( ExchCond( ExchNum ).Name + " must be set to Yes or No" );
-					ErrorsFound = true;
+					GetHeatRecoveryInputErrorsFound = true;
 				}
 			}
 
@@ -574,7 +682,7 @@ namespace HeatRecovery {
 			} else {
 				ShowSevereError( cCurrentModuleObject + " configuration not found= " + cAlphaArgs( 8 ) );
 				ShowContinueError( "HX configuration must be either Plate or Rotary" );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 
 			// Added additional inputs for frost control
@@ -584,7 +692,7 @@ namespace HeatRecovery {
 					if ( ! SameString( ExchCond( ExchNum ).FrostControlType, "ExhaustAirRecirculation" ) ) {
 						if ( ! SameString( ExchCond( ExchNum ).FrostControlType, "MinimumExhaustTemperature" ) ) {
 							ShowSevereError( "Invalid Frost Control method for " + ExchCond( ExchNum ).Name + " =  " + cAlphaArgs( 9 ) );
-							ErrorsFound = true;
+							GetHeatRecoveryInputErrorsFound = true;
 						}
 					}
 				}
@@ -606,7 +714,7 @@ namespace HeatRecovery {
 					ExchCond( ExchNum ).EconoLockOut = EconoLockOut_Yes;
 				} else {
 					ShowSevereError( cCurrentModuleObject + ": incorrect econo lockout: " + cAlphaArgs( 10 ) );
-					ErrorsFound = true;
+					GetHeatRecoveryInputErrorsFound = true;
 				}
 			}}
 
@@ -627,7 +735,7 @@ namespace HeatRecovery {
 			IsBlank = false;
 			VerifyName( cAlphaArgs( 1 ), ExchCond, ExchNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 			}
 			ExchCond( ExchNum ).Name = cAlphaArgs( 1 );
@@ -638,17 +746,17 @@ namespace HeatRecovery {
 				ExchCond( ExchNum ).SchedPtr = GetScheduleIndex( cAlphaArgs( 2 ) );
 				if ( ExchCond( ExchNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + ": invalid " + cAlphaFieldNames( 2 ) + " entered =" + cAlphaArgs( 2 ) + " for " + cAlphaFieldNames( 1 ) + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetHeatRecoveryInputErrorsFound = true;
 				}
 			}
 			// desiccant HX's usually refer to process and regeneration air streams
 			// In this module, Sup = Regeneration nodes and Sec = Process nodes
 			// regeneration air inlet and outlet nodes
-			ExchCond( ExchNum ).SupInletNode = GetOnlySingleNode( cAlphaArgs( 3 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			ExchCond( ExchNum ).SupOutletNode = GetOnlySingleNode( cAlphaArgs( 4 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			ExchCond( ExchNum ).SupInletNode = GetOnlySingleNode( cAlphaArgs( 3 ), GetHeatRecoveryInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			ExchCond( ExchNum ).SupOutletNode = GetOnlySingleNode( cAlphaArgs( 4 ), GetHeatRecoveryInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 			// process air inlet and outlet nodes
-			ExchCond( ExchNum ).SecInletNode = GetOnlySingleNode( cAlphaArgs( 5 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
-			ExchCond( ExchNum ).SecOutletNode = GetOnlySingleNode( cAlphaArgs( 6 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+			ExchCond( ExchNum ).SecInletNode = GetOnlySingleNode( cAlphaArgs( 5 ), GetHeatRecoveryInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+			ExchCond( ExchNum ).SecOutletNode = GetOnlySingleNode( cAlphaArgs( 6 ), GetHeatRecoveryInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
 
 			// Set up the component set for the process side of the HX (Sec = Process)
 			TestCompSet( cHXTypes( ExchCond( ExchNum ).ExchTypeNum ), ExchCond( ExchNum ).Name, NodeID( ExchCond( ExchNum ).SecInletNode ), NodeID( ExchCond( ExchNum ).SecOutletNode ), "Process Air Nodes" );
@@ -660,7 +768,7 @@ namespace HeatRecovery {
 				ShowSevereError( cCurrentModuleObject + " \"" + ExchCond( ExchNum ).Name + "\"" );
 				ShowContinueError( "Invalid performance data type selected." );
 				ShowContinueError( "...performance data type selected = " + HeatExchPerfType );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 
 			ExchCond( ExchNum ).HeatExchPerfName = cAlphaArgs( 8 );
@@ -675,7 +783,7 @@ namespace HeatRecovery {
 					ExchCond( ExchNum ).EconoLockOut = EconoLockOut_No;
 				} else {
 					ShowSevereError( cCurrentModuleObject + ": incorrect econo lockout: " + cAlphaArgs( 9 ) );
-					ErrorsFound = true;
+					GetHeatRecoveryInputErrorsFound = true;
 				}
 			}}
 
@@ -696,7 +804,7 @@ namespace HeatRecovery {
 			IsBlank = false;
 			VerifyName( cAlphaArgs( 1 ), BalDesDehumPerfData, PerfDataNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 			}
 			BalDesDehumPerfData( PerfDataNum ).Name = cAlphaArgs( 1 );
@@ -707,7 +815,7 @@ namespace HeatRecovery {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Nominal air flow rate must be greater than zero." );
 				ShowContinueError( "... value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).NomSupAirVolFlow, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 
 			BalDesDehumPerfData( PerfDataNum ).NomProcAirFaceVel = rNumericArgs( 2 );
@@ -716,7 +824,7 @@ namespace HeatRecovery {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Nominal air face velocity cannot be less than or equal to zero or greater than 6 m/s." );
 				ShowContinueError( "... value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).NomProcAirFaceVel, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 			BalDesDehumPerfData( PerfDataNum ).NomElecPower = rNumericArgs( 3 );
 			// check validity
@@ -724,7 +832,7 @@ namespace HeatRecovery {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Nominal electric power cannot be less than zero." );
 				ShowContinueError( "... value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).NomElecPower, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 
 			// regen outlet temp variables
@@ -746,21 +854,21 @@ namespace HeatRecovery {
 				ShowContinueError( "... the minimum value of regeneration inlet air humidity ratio must be less than the maximum." );
 				ShowContinueError( "... minimum value entered by user = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MinRegenAirInHumRat, 6 ) );
 				ShowContinueError( "... maximum value entered by user = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MaxRegenAirInHumRat, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 			if ( BalDesDehumPerfData( PerfDataNum ).T_MinRegenAirInHumRat < 0.0 ) {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Error found in min boundary for the regen outlet air temperature equation." );
 				ShowContinueError( "... the minimum value of regeneration inlet air humidity ratio must be greater than or equal to 0." );
 				ShowContinueError( "... minimum value entered by user = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MinRegenAirInHumRat, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 			if ( BalDesDehumPerfData( PerfDataNum ).T_MaxRegenAirInHumRat > 1.0 ) {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Error found in max boundary for the regen outlet air temperature equation." );
 				ShowContinueError( "... the maximum value of regeneration inlet air humidity ratio must be less than or equal to 1." );
 				ShowContinueError( "... maximum value entered by user = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MaxRegenAirInHumRat, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 
 			BalDesDehumPerfData( PerfDataNum ).T_MinRegenAirInTemp = rNumericArgs( 14 );
@@ -771,7 +879,7 @@ namespace HeatRecovery {
 				ShowContinueError( "... the minimum value of regeneration inlet air temperature must be less than the maximum." );
 				ShowContinueError( "... minimum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MinRegenAirInTemp, 6 ) );
 				ShowContinueError( "... maximum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MaxRegenAirInTemp, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 
 			BalDesDehumPerfData( PerfDataNum ).T_MinProcAirInHumRat = rNumericArgs( 16 );
@@ -782,21 +890,21 @@ namespace HeatRecovery {
 				ShowContinueError( "... the minimum value of process inlet air humidity ratio must be less than the maximum." );
 				ShowContinueError( "... minimum value entered by user = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MinProcAirInHumRat, 6 ) );
 				ShowContinueError( "... maximum value entered by user = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MaxProcAirInHumRat, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 			if ( BalDesDehumPerfData( PerfDataNum ).T_MinProcAirInHumRat < 0.0 ) {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Error found in min boundary for the regen outlet air temperature equation." );
 				ShowContinueError( "... the minimum value of process inlet air humidity ratio must be greater than or equal to 0." );
 				ShowContinueError( "... minimum value entered by user = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MinProcAirInHumRat, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 			if ( BalDesDehumPerfData( PerfDataNum ).T_MaxProcAirInHumRat > 1.0 ) {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Error found in max boundary for the regen outlet air temperature equation." );
 				ShowContinueError( "... the maximum value of process inlet air humidity ratio must be less than or equal to 1." );
 				ShowContinueError( "... maximum value entered by user = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MaxProcAirInHumRat, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 
 			BalDesDehumPerfData( PerfDataNum ).T_MinProcAirInTemp = rNumericArgs( 18 );
@@ -807,7 +915,7 @@ namespace HeatRecovery {
 				ShowContinueError( "... the minimum value of process inlet air temperature must be less than the maximum." );
 				ShowContinueError( "... minimum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MinProcAirInTemp, 6 ) );
 				ShowContinueError( "... maximum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MaxProcAirInTemp, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 
 			BalDesDehumPerfData( PerfDataNum ).T_MinFaceVel = rNumericArgs( 20 );
@@ -818,7 +926,7 @@ namespace HeatRecovery {
 				ShowContinueError( "... the minimum value of regen air velocity must be less than the maximum." );
 				ShowContinueError( "... minimum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MinFaceVel, 6 ) );
 				ShowContinueError( "... maximum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MaxFaceVel, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 
 			BalDesDehumPerfData( PerfDataNum ).MinRegenAirOutTemp = rNumericArgs( 22 );
@@ -829,7 +937,7 @@ namespace HeatRecovery {
 				ShowContinueError( "... the minimum value of regen outlet air temperature must be less than the maximum." );
 				ShowContinueError( "... minimum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).MinRegenAirOutTemp, 6 ) );
 				ShowContinueError( "... maximum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).MaxRegenAirOutTemp, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 
 			BalDesDehumPerfData( PerfDataNum ).T_MinRegenAirInRelHum = rNumericArgs( 24 ) / 100.0;
@@ -840,21 +948,21 @@ namespace HeatRecovery {
 				ShowContinueError( "... the minimum value of regen inlet air relative humidity must be less than the maximum." );
 				ShowContinueError( "... minimum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MinRegenAirInRelHum * 100.0, 6 ) );
 				ShowContinueError( "... maximum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MaxRegenAirInRelHum * 100.0, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 			if ( BalDesDehumPerfData( PerfDataNum ).T_MinRegenAirInRelHum < 0.0 ) {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Error found in min boundary for the regen outlet air temperature equation." );
 				ShowContinueError( "... the minimum value of regen inlet air relative humidity must be greater than or equal to 0." );
 				ShowContinueError( "... minimum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MinRegenAirInRelHum * 100.0, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 			if ( BalDesDehumPerfData( PerfDataNum ).T_MaxRegenAirInRelHum > 1.0 ) {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Error found in max boundary for the regen outlet air temperature equation." );
 				ShowContinueError( "... the maximum value of regen inlet air relative humidity must be less than or equal to 100." );
 				ShowContinueError( "... maximum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MaxRegenAirInRelHum * 100.0, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 
 			BalDesDehumPerfData( PerfDataNum ).T_MinProcAirInRelHum = rNumericArgs( 26 ) / 100.0;
@@ -865,21 +973,21 @@ namespace HeatRecovery {
 				ShowContinueError( "... the minimum value of process inlet air relative humidity must be less than the maximum." );
 				ShowContinueError( "... minimum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MinProcAirInRelHum * 100.0, 6 ) );
 				ShowContinueError( "... maximum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MaxProcAirInRelHum * 100.0, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 			if ( BalDesDehumPerfData( PerfDataNum ).T_MinProcAirInRelHum < 0.0 ) {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Error found in min boundary for the regen outlet air temperature equation." );
 				ShowContinueError( "... the minimum value of process inlet air relative humidity must be greater than or equal to 0." );
 				ShowContinueError( "... minimum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MinProcAirInRelHum * 100.0, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 			if ( BalDesDehumPerfData( PerfDataNum ).T_MaxProcAirInRelHum > 1.0 ) {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Error found in max boundary for the regen outlet air temperature equation." );
 				ShowContinueError( "... the maximum value of process inlet air relative humidity must be less than or equal to 100." );
 				ShowContinueError( "... maximum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).T_MaxProcAirInRelHum * 100.0, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 
 			// regen outlet humidity ratio variables
@@ -901,21 +1009,21 @@ namespace HeatRecovery {
 				ShowContinueError( "... the minimum value of regeneration inlet air humidity ratio must be less than the maximum." );
 				ShowContinueError( "... minimum value entered by user = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MinRegenAirInHumRat, 6 ) );
 				ShowContinueError( "... maximum value entered by user = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MaxRegenAirInHumRat, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 			if ( BalDesDehumPerfData( PerfDataNum ).H_MinRegenAirInHumRat < 0.0 ) {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Error found in min boundary for the regen outlet air humidity ratio equation." );
 				ShowContinueError( "... the minimum value of regeneration inlet air humidity ratio must be greater than or equal to 0." );
 				ShowContinueError( "... minimum value entered by user = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MinRegenAirInHumRat, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 			if ( BalDesDehumPerfData( PerfDataNum ).H_MaxRegenAirInHumRat > 1.0 ) {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Error found in max boundary for the regen outlet air humidity ratio equation." );
 				ShowContinueError( "... the maximum value of regeneration inlet air humidity ratio must be less than or equal to 1." );
 				ShowContinueError( "... maximum value entered by user = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MaxRegenAirInHumRat, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 
 			BalDesDehumPerfData( PerfDataNum ).H_MinRegenAirInTemp = rNumericArgs( 38 );
@@ -926,7 +1034,7 @@ namespace HeatRecovery {
 				ShowContinueError( "... the minimum value of regeneration inlet air temperature must be less than the maximum." );
 				ShowContinueError( "... minimum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MinRegenAirInTemp, 6 ) );
 				ShowContinueError( "... maximum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MaxRegenAirInTemp, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 
 			BalDesDehumPerfData( PerfDataNum ).H_MinProcAirInHumRat = rNumericArgs( 40 );
@@ -937,21 +1045,21 @@ namespace HeatRecovery {
 				ShowContinueError( "... the minimum value of process inlet air humidity ratio must be less than the maximum." );
 				ShowContinueError( "... minimum value entered by user = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MinProcAirInHumRat, 6 ) );
 				ShowContinueError( "... maximum value entered by user = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MaxProcAirInHumRat, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 			if ( BalDesDehumPerfData( PerfDataNum ).H_MinProcAirInHumRat < 0.0 ) {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Error found in min boundary for the regen outlet air humidity ratio equation." );
 				ShowContinueError( "... the minimum value of process inlet air humidity ratio must be greater than or equal to 0." );
 				ShowContinueError( "... minimum value entered by user = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MinProcAirInHumRat, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 			if ( BalDesDehumPerfData( PerfDataNum ).H_MaxProcAirInHumRat > 1.0 ) {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Error found in max boundary for the regen outlet air humidity ratio equation." );
 				ShowContinueError( "... the maximum value of process inlet air humidity ratio must be less than or equal to 1." );
 				ShowContinueError( "... maximum value entered by user = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MaxProcAirInHumRat, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 
 			BalDesDehumPerfData( PerfDataNum ).H_MinProcAirInTemp = rNumericArgs( 42 );
@@ -962,7 +1070,7 @@ namespace HeatRecovery {
 				ShowContinueError( "... the minimum value of process inlet air temperature must be less than the maximum." );
 				ShowContinueError( "... minimum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MinProcAirInTemp, 6 ) );
 				ShowContinueError( "... maximum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MaxProcAirInTemp, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 
 			BalDesDehumPerfData( PerfDataNum ).H_MinFaceVel = rNumericArgs( 44 );
@@ -973,7 +1081,7 @@ namespace HeatRecovery {
 				ShowContinueError( "... the minimum value of regen air velocity must be less than the maximum." );
 				ShowContinueError( "... minimum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MinFaceVel, 6 ) );
 				ShowContinueError( "... maximum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MaxFaceVel, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 
 			BalDesDehumPerfData( PerfDataNum ).MinRegenAirOutHumRat = rNumericArgs( 46 );
@@ -984,21 +1092,21 @@ namespace HeatRecovery {
 				ShowContinueError( "... the minimum value of regen outlet air humidity ratio must be less than the maximum." );
 				ShowContinueError( "... minimum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).MinRegenAirOutHumRat, 6 ) );
 				ShowContinueError( "... maximum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).MaxRegenAirOutHumRat, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 			if ( BalDesDehumPerfData( PerfDataNum ).MinRegenAirOutHumRat < 0.0 ) {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Error found in min boundary for the regen outlet air humidity ratio equation." );
 				ShowContinueError( "... the minimum value of regen outlet air humidity ratio must be greater than or equal to 0." );
 				ShowContinueError( "... minimum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).MinRegenAirOutHumRat, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 			if ( BalDesDehumPerfData( PerfDataNum ).MaxRegenAirOutHumRat > 1.0 ) {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Error found in max boundary for the regen outlet air humidity ratio equation." );
 				ShowContinueError( "... the maximum value of regen outlet air humidity ratio must be less or equal to 1." );
 				ShowContinueError( "... maximum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).MaxRegenAirOutHumRat, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 
 			BalDesDehumPerfData( PerfDataNum ).H_MinRegenAirInRelHum = rNumericArgs( 48 ) / 100.0;
@@ -1009,21 +1117,21 @@ namespace HeatRecovery {
 				ShowContinueError( "... the minimum value of regen inlet air relative humidity must be less than the maximum." );
 				ShowContinueError( "... minimum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MinRegenAirInRelHum * 100.0, 6 ) );
 				ShowContinueError( "... maximum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MaxRegenAirInRelHum * 100.0, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 			if ( BalDesDehumPerfData( PerfDataNum ).H_MinRegenAirInRelHum < 0.0 ) {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Error found in min boundary for the regen outlet air humidity ratio equation." );
 				ShowContinueError( "... the minimum value of regen inlet air relative humidity must be greater than or equal to 0." );
 				ShowContinueError( "... minimum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MinRegenAirInRelHum * 100.0, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 			if ( BalDesDehumPerfData( PerfDataNum ).H_MaxRegenAirInRelHum > 1.0 ) {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Error found in max boundary for the regen outlet air humidity ratio equation." );
 				ShowContinueError( "... the maximum value of regen inlet air relative humidity must be less or equal to 100." );
 				ShowContinueError( "... maximum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MaxRegenAirInRelHum * 100.0, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 
 			BalDesDehumPerfData( PerfDataNum ).H_MinProcAirInRelHum = rNumericArgs( 50 ) / 100.0;
@@ -1034,21 +1142,21 @@ namespace HeatRecovery {
 				ShowContinueError( "... the minimum value of process inlet air relative humidity must be less than the maximum." );
 				ShowContinueError( "... minimum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MinProcAirInRelHum * 100.0, 6 ) );
 				ShowContinueError( "... maximum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MaxProcAirInRelHum * 100.0, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 			if ( BalDesDehumPerfData( PerfDataNum ).H_MinProcAirInRelHum < 0.0 ) {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Error found in min boundary for the regen outlet air humidity ratio equation." );
 				ShowContinueError( "... the minimum value of process inlet air relative humidity must be greater than or equal to 0." );
 				ShowContinueError( "... minimum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MinProcAirInRelHum * 100.0, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 			if ( BalDesDehumPerfData( PerfDataNum ).H_MaxProcAirInRelHum > 1.0 ) {
 				ShowSevereError( cCurrentModuleObject + " \"" + BalDesDehumPerfData( PerfDataNum ).Name + "\"" );
 				ShowContinueError( "Error found in max boundary for the regen outlet air humidity ratio equation." );
 				ShowContinueError( "... the maximum value of process inlet air relative humidity must be less than or equal to 100." );
 				ShowContinueError( "... maximum value entered = " + RoundSigDigits( BalDesDehumPerfData( PerfDataNum ).H_MaxProcAirInRelHum * 100.0, 6 ) );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			}
 
 		}
@@ -1066,9 +1174,9 @@ namespace HeatRecovery {
 			if ( ExchCond( ExchNum ).PerfDataIndex == 0 ) {
 				ShowSevereError( cHXTypes( ExchCond( ExchNum ).ExchTypeNum ) + " \"" + ExchCond( ExchNum ).Name + "\"" );
 				ShowContinueError( "... Performance data set not found = " + ExchCond( ExchNum ).HeatExchPerfName );
-				ErrorsFound = true;
+				GetHeatRecoveryInputErrorsFound = true;
 			} else {
-				if ( ! ErrorsFound ) {
+				if ( ! GetHeatRecoveryInputErrorsFound ) {
 					ExchCond( ExchNum ).FaceArea = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).NomSupAirVolFlow / ( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).NomProcAirFaceVel );
 				}
 			}
@@ -1109,7 +1217,7 @@ namespace HeatRecovery {
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetHeatRecoveryInputErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in input.  Program terminates." );
 		}
 
@@ -1174,8 +1282,6 @@ namespace HeatRecovery {
 		//////////// hoisted into namespace ////////////////////////////////////////////////
 		// static bool MyOneTimeAllocate( true );
 		////////////////////////////////////////////////////////////////////////////////////
-		static Array1D_bool MySetPointTest;
-		static Array1D_bool MySizeFlag;
 		int ErrStat; // error status returned by CalculateNTUfromEpsAndZ
 		bool FatalError; // fatal error flag
 		bool LocalWarningError; // warning error flag
@@ -3270,14 +3376,12 @@ namespace HeatRecovery {
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 
 		int SolFla; // Flag of solver
-		static Real64 NTU0( 0.0 ); // lower bound for NTU
-		static Real64 NTU1( 50.0 ); // upper bound for NTU
 		Array1D< Real64 > Par( 2 );
 
 		Par( 1 ) = Eps;
 		Par( 2 ) = Z;
 
-		SolveRegulaFalsi( Acc, MaxIte, SolFla, NTU, GetResidCrossFlowBothUnmixed, NTU0, NTU1, Par );
+		SolveRegulaFalsi( Acc, MaxIte, SolFla, NTU, GetResidCrossFlowBothUnmixed, NTU0, NTU1, Par, "GetNTUforCrossFlowBothUnmixed" );
 
 		if ( SolFla == -2 ) {
 			ShowFatalError( "HeatRecovery: Bad initial bounds for NTU in GetNTUforCrossFlowBothUnmixed" );
@@ -3396,13 +3500,6 @@ namespace HeatRecovery {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static std::string OutputChar; // character string for warning messages
-		static std::string OutputCharLo; // character string for warning messages
-		static std::string OutputCharHi; // character string for warning messages
-		static std::string CharValue; // character string for warning messages
-		static Real64 TimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
-		static Real64 CurrentEndTime( 0.0 ); // end time of time step for current simulation time step
-		static Real64 CurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
 		// current end time is compared with last to see if time step changed
 
 		//   calculate end time of current time step
@@ -3672,23 +3769,16 @@ namespace HeatRecovery {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static std::string OutputChar; // character string for warning messages
-		static std::string OutputCharLo; // character string for warning messages
-		static std::string OutputCharHi; // character string for warning messages
-		static std::string CharValue; // character string for warning messages
-		static Real64 TimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
-		static Real64 CurrentEndTime( 0.0 ); // end time of time step for current simulation time step
-		static Real64 CurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
 		// current end time is compared with last to see if time step changed
 
 		//   calculate end time of current time step
-		CurrentEndTime = CurrentTime + SysTimeElapsed;
+		CheckModelBoundsHumRatEqCurrentEndTime = CurrentTime + SysTimeElapsed;
 
 		//   Print warning messages only when valid and only for the first ocurrance. Let summary provide statistics.
 		//   Wait for next time step to print warnings. If simulation iterates, print out
 		//   the warning for the last iteration only. Must wait for next time step to accomplish this.
 		//   If a warning occurs and the simulation down shifts, the warning is not valid.
-		if ( CurrentEndTime > CurrentEndTimeLast && TimeStepSys >= TimeStepSysLast ) {
+		if ( CheckModelBoundsHumRatEqCurrentEndTime > CheckModelBoundsHumRatEqCurrentEndTimeLast && TimeStepSys >= CheckModelBoundsHumRatEqTimeStepSysLast ) {
 
 			// print error for variables of regeneration outlet humidity ratio equation
 			// Regen inlet temp for humidity ratio eqn
@@ -3754,8 +3844,8 @@ namespace HeatRecovery {
 		} // IF(CurrentEndTime .GT. CurrentEndTimeLast .AND. TimeStepSys .GE. TimeStepSysLast)THEN
 
 		//   save last system time step and last end time of current time step (used to determine if warning is valid)
-		TimeStepSysLast = TimeStepSys;
-		CurrentEndTimeLast = CurrentEndTime;
+		CheckModelBoundsHumRatEqTimeStepSysLast = TimeStepSys;
+		CheckModelBoundsHumRatEqCurrentEndTimeLast = CheckModelBoundsHumRatEqCurrentEndTime;
 
 		//   If regen and procees inlet temperatures are the same the coil is off, do not print out of bounds warning for this case
 		if ( std::abs( H_RegenInTemp - H_ProcInTemp ) < SMALL ) {
@@ -3772,9 +3862,9 @@ namespace HeatRecovery {
 		// Regen inlet temp
 		if ( H_RegenInTemp < BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinRegenAirInTemp || H_RegenInTemp > BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxRegenAirInTemp ) {
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_RegenInTempLast = H_RegenInTemp;
-			OutputChar = RoundSigDigits( H_RegenInTemp, 2 );
-			OutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinRegenAirInTemp, 2 );
-			OutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxRegenAirInTemp, 2 );
+			CheckModelBoundsHumRatEqOutputChar = RoundSigDigits( H_RegenInTemp, 2 );
+			CheckModelBoundsHumRatEqOutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinRegenAirInTemp, 2 );
+			CheckModelBoundsHumRatEqOutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxRegenAirInTemp, 2 );
 			if ( H_RegenInTemp < BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinRegenAirInTemp ) {
 				H_RegenInTemp = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinRegenAirInTemp;
 			}
@@ -3783,10 +3873,10 @@ namespace HeatRecovery {
 			}
 			if ( ! WarmupFlag && ! FirstHVACIteration ) {
 				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintH_RegenInTempMessage = true;
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_RegenInTempBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Regeneration inlet air temperature used in regen outlet air humidity ratio equation is outside model boundaries at " + OutputChar + '.';
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_RegenInTempBuffer2 = "...Valid range = " + OutputCharLo + " to " + OutputCharHi + ". Occurrence info = " + EnvironmentName + ", " + CurMnDy + " , " + CreateSysTimeIntervalString();
-				CharValue = RoundSigDigits( H_RegenInTemp, 2 );
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_RegenInTempBuffer3 = "...Regeneration outlet air humidity ratio equation: regeneration inlet air temperature passed to the model = " + CharValue;
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_RegenInTempBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Regeneration inlet air temperature used in regen outlet air humidity ratio equation is outside model boundaries at " + CheckModelBoundsHumRatEqOutputChar + '.';
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_RegenInTempBuffer2 = "...Valid range = " + CheckModelBoundsHumRatEqOutputCharLo + " to " + CheckModelBoundsHumRatEqOutputCharHi + ". Occurrence info = " + EnvironmentName + ", " + CurMnDy + " , " + CreateSysTimeIntervalString();
+				CheckModelBoundsHumRatEqCharValue = RoundSigDigits( H_RegenInTemp, 2 );
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_RegenInTempBuffer3 = "...Regeneration outlet air humidity ratio equation: regeneration inlet air temperature passed to the model = " + CheckModelBoundsHumRatEqCharValue;
 			} else {
 				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintH_RegenInTempMessage = false;
 			}
@@ -3796,9 +3886,9 @@ namespace HeatRecovery {
 		// regen inlet humidity ratio
 		if ( H_RegenInHumRat < BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinRegenAirInHumRat || H_RegenInHumRat > BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxRegenAirInHumRat ) {
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_RegenInHumRatLast = H_RegenInHumRat;
-			OutputChar = RoundSigDigits( H_RegenInHumRat, 6 );
-			OutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinRegenAirInHumRat, 6 );
-			OutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxRegenAirInHumRat, 6 );
+			CheckModelBoundsHumRatEqOutputChar = RoundSigDigits( H_RegenInHumRat, 6 );
+			CheckModelBoundsHumRatEqOutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinRegenAirInHumRat, 6 );
+			CheckModelBoundsHumRatEqOutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxRegenAirInHumRat, 6 );
 			if ( H_RegenInHumRat < BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinRegenAirInHumRat ) {
 				H_RegenInHumRat = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinRegenAirInHumRat;
 			}
@@ -3807,10 +3897,10 @@ namespace HeatRecovery {
 			}
 			if ( ! WarmupFlag && ! FirstHVACIteration ) {
 				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintH_RegenInHumRatMessage = true;
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_RegenInHumRatBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Regeneration inlet air humidity ratio used in regen outlet air humidity ratio equation is outside model boundaries at " + OutputChar + '.';
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_RegenInHumRatBuffer2 = "...Valid range = " + OutputCharLo + " to " + OutputCharHi + ". Occurrence info = " + EnvironmentName + ", " + CurMnDy + ' ' + CreateSysTimeIntervalString();
-				CharValue = RoundSigDigits( H_RegenInHumRat, 6 );
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_RegenInHumRatBuffer3 = "...Regeneration outlet air humidity ratio equation: regeneration inlet air humidity ratio passed to the model = " + CharValue;
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_RegenInHumRatBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Regeneration inlet air humidity ratio used in regen outlet air humidity ratio equation is outside model boundaries at " + CheckModelBoundsHumRatEqOutputChar + '.';
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_RegenInHumRatBuffer2 = "...Valid range = " + CheckModelBoundsHumRatEqOutputCharLo + " to " + CheckModelBoundsHumRatEqOutputCharHi + ". Occurrence info = " + EnvironmentName + ", " + CurMnDy + ' ' + CreateSysTimeIntervalString();
+				CheckModelBoundsHumRatEqCharValue = RoundSigDigits( H_RegenInHumRat, 6 );
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_RegenInHumRatBuffer3 = "...Regeneration outlet air humidity ratio equation: regeneration inlet air humidity ratio passed to the model = " + CheckModelBoundsHumRatEqCharValue;
 			} else {
 				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintH_RegenInHumRatMessage = false;
 			}
@@ -3820,9 +3910,9 @@ namespace HeatRecovery {
 		// process inlet temp
 		if ( H_ProcInTemp < BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinProcAirInTemp || H_ProcInTemp > BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxProcAirInTemp ) {
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_ProcInTempLast = H_ProcInTemp;
-			OutputChar = RoundSigDigits( H_ProcInTemp, 2 );
-			OutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinProcAirInTemp, 2 );
-			OutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxProcAirInTemp, 2 );
+			CheckModelBoundsHumRatEqOutputChar = RoundSigDigits( H_ProcInTemp, 2 );
+			CheckModelBoundsHumRatEqOutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinProcAirInTemp, 2 );
+			CheckModelBoundsHumRatEqOutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxProcAirInTemp, 2 );
 			if ( H_ProcInTemp < BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinProcAirInTemp ) {
 				H_ProcInTemp = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinProcAirInTemp;
 			}
@@ -3833,10 +3923,10 @@ namespace HeatRecovery {
 				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintH_ProcInTempMessage = true;
 				//       Suppress warning message when process inlet temperature = 0 (DX coil is off)
 				if ( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_ProcInTempLast == 0.0 ) BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintH_ProcInTempMessage = false;
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_ProcInTempBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Process inlet air temperature used in regen outlet air humidity ratio equation is outside model boundaries at " + OutputChar + '.';
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_ProcInTempBuffer2 = "...Valid range = " + OutputCharLo + " to " + OutputCharHi + ". Occurrence info = " + EnvironmentName + ", " + CurMnDy + ' ' + CreateSysTimeIntervalString();
-				CharValue = RoundSigDigits( H_ProcInTemp, 6 );
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_ProcInTempBuffer3 = "...Regeneration outlet air humidity ratio equation: process inlet air temperature passed to the model = " + CharValue;
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_ProcInTempBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Process inlet air temperature used in regen outlet air humidity ratio equation is outside model boundaries at " + CheckModelBoundsHumRatEqOutputChar + '.';
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_ProcInTempBuffer2 = "...Valid range = " + CheckModelBoundsHumRatEqOutputCharLo + " to " + CheckModelBoundsHumRatEqOutputCharHi + ". Occurrence info = " + EnvironmentName + ", " + CurMnDy + ' ' + CreateSysTimeIntervalString();
+				CheckModelBoundsHumRatEqCharValue = RoundSigDigits( H_ProcInTemp, 6 );
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_ProcInTempBuffer3 = "...Regeneration outlet air humidity ratio equation: process inlet air temperature passed to the model = " + CheckModelBoundsHumRatEqCharValue;
 			} else {
 				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintH_ProcInTempMessage = false;
 			}
@@ -3846,9 +3936,9 @@ namespace HeatRecovery {
 		// process inlet humidity ratio
 		if ( H_ProcInHumRat < BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinProcAirInHumRat || H_ProcInHumRat > BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxProcAirInHumRat ) {
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_ProcInHumRatLast = H_ProcInHumRat;
-			OutputChar = RoundSigDigits( H_ProcInHumRat, 6 );
-			OutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinProcAirInHumRat, 6 );
-			OutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxProcAirInHumRat, 6 );
+			CheckModelBoundsHumRatEqOutputChar = RoundSigDigits( H_ProcInHumRat, 6 );
+			CheckModelBoundsHumRatEqOutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinProcAirInHumRat, 6 );
+			CheckModelBoundsHumRatEqOutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxProcAirInHumRat, 6 );
 			if ( H_ProcInHumRat < BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinProcAirInHumRat ) {
 				H_ProcInHumRat = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinProcAirInHumRat;
 			}
@@ -3859,10 +3949,10 @@ namespace HeatRecovery {
 				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintH_ProcInHumRatMessage = true;
 				//       Suppress warning message when process inlet humrat = 0 (DX coil is off)
 				if ( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_ProcInHumRatLast == 0.0 ) BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintH_ProcInHumRatMessage = false;
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_ProcInHumRatBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Process inlet air humidity ratio used in regen outlet air humidity ratio equation is outside model boundaries at " + OutputChar + '.';
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_ProcInHumRatBuffer2 = "...Valid range = " + OutputCharLo + " to " + OutputCharHi + ". Occurrence info = " + EnvironmentName + ", " + CurMnDy + ", " + CreateSysTimeIntervalString();
-				CharValue = RoundSigDigits( H_ProcInHumRat, 6 );
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_ProcInHumRatBuffer3 = "...Regeneration outlet air humidity ratio equation: process inlet air humidity ratio passed to the model = " + CharValue;
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_ProcInHumRatBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Process inlet air humidity ratio used in regen outlet air humidity ratio equation is outside model boundaries at " + CheckModelBoundsHumRatEqOutputChar + '.';
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_ProcInHumRatBuffer2 = "...Valid range = " + CheckModelBoundsHumRatEqOutputCharLo + " to " + CheckModelBoundsHumRatEqOutputCharHi + ". Occurrence info = " + EnvironmentName + ", " + CurMnDy + ", " + CreateSysTimeIntervalString();
+				CheckModelBoundsHumRatEqCharValue = RoundSigDigits( H_ProcInHumRat, 6 );
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_ProcInHumRatBuffer3 = "...Regeneration outlet air humidity ratio equation: process inlet air humidity ratio passed to the model = " + CheckModelBoundsHumRatEqCharValue;
 			} else {
 				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintH_ProcInHumRatMessage = false;
 			}
@@ -3872,9 +3962,9 @@ namespace HeatRecovery {
 		// regeneration and process face velocity
 		if ( H_FaceVel < BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinFaceVel || H_FaceVel > BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxFaceVel ) {
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_FaceVelLast = H_FaceVel;
-			OutputChar = RoundSigDigits( H_FaceVel, 6 );
-			OutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinFaceVel, 6 );
-			OutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxFaceVel, 6 );
+			CheckModelBoundsHumRatEqOutputChar = RoundSigDigits( H_FaceVel, 6 );
+			CheckModelBoundsHumRatEqOutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinFaceVel, 6 );
+			CheckModelBoundsHumRatEqOutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxFaceVel, 6 );
 			if ( H_FaceVel < BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinFaceVel ) {
 				H_FaceVel = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinFaceVel;
 			}
@@ -3883,10 +3973,10 @@ namespace HeatRecovery {
 			}
 			if ( ! WarmupFlag && ! FirstHVACIteration ) {
 				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintH_FaceVelMessage = true;
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_FaceVelBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Process and regen inlet air face velocity used in regen outlet air humidity ratio equation is outside model boundaries at " + OutputChar + '.';
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_FaceVelBuffer2 = "...Valid range = " + OutputCharLo + " to " + OutputCharHi + ". Occurrence info = " + EnvironmentName + ", " + CurMnDy + ", " + CreateSysTimeIntervalString();
-				CharValue = RoundSigDigits( H_FaceVel, 6 );
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_FaceVelBuffer3 = "...Regeneration outlet air humidity ratio equation: process and regeneration face velocity passed to the model = " + CharValue;
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_FaceVelBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Process and regen inlet air face velocity used in regen outlet air humidity ratio equation is outside model boundaries at " + CheckModelBoundsHumRatEqOutputChar + '.';
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_FaceVelBuffer2 = "...Valid range = " + CheckModelBoundsHumRatEqOutputCharLo + " to " + CheckModelBoundsHumRatEqOutputCharHi + ". Occurrence info = " + EnvironmentName + ", " + CurMnDy + ", " + CreateSysTimeIntervalString();
+				CheckModelBoundsHumRatEqCharValue = RoundSigDigits( H_FaceVel, 6 );
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_FaceVelBuffer3 = "...Regeneration outlet air humidity ratio equation: process and regeneration face velocity passed to the model = " + CheckModelBoundsHumRatEqCharValue;
 			} else {
 				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintH_FaceVelMessage = false;
 			}
@@ -3944,23 +4034,16 @@ namespace HeatRecovery {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static std::string OutputChar; // character string for warning messages
-		static std::string OutputCharLo; // character string for warning messages
-		static std::string OutputCharHi; // character string for warning messages
-		static std::string CharValue; // character string for warning messages
-		static Real64 TimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
-		static Real64 CurrentEndTime( 0.0 ); // end time of time step for current simulation time step
-		static Real64 CurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
 		// current end time is compared with last to see if time step changed
 
 		//   calculate end time of current time step
-		CurrentEndTime = CurrentTime + SysTimeElapsed;
+		CheckModelBoundOutput_TempCurrentEndTime = CurrentTime + SysTimeElapsed;
 
 		//   Print warning messages only when valid and only for the first ocurrance. Let summary provide statistics.
 		//   Wait for next time step to print warnings. If simulation iterates, print out
 		//   the warning for the last iteration only. Must wait for next time step to accomplish this.
 		//   If a warning occurs and the simulation down shifts, the warning is not valid.
-		if ( CurrentEndTime > CurrentEndTimeLast && TimeStepSys >= TimeStepSysLast ) {
+		if ( CheckModelBoundOutput_TempCurrentEndTime > CheckModelBoundOutput_TempCurrentEndTimeLast && TimeStepSys >= CheckModelBoundOutput_TempTimeStepSysLast ) {
 
 			// print error when regeneration outlet temperature is greater than regen inlet temperature
 			if ( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintRegenOutTempFailedMessage ) {
@@ -3989,23 +4072,23 @@ namespace HeatRecovery {
 		} // IF(CurrentEndTime .GT. CurrentEndTimeLast .AND. TimeStepSys .GE. TimeStepSysLast)THEN
 
 		//   save last system time step and last end time of current time step (used to determine if warning is valid)
-		TimeStepSysLast = TimeStepSys;
-		CurrentEndTimeLast = CurrentEndTime;
+		CheckModelBoundOutput_TempTimeStepSysLast = TimeStepSys;
+		CheckModelBoundOutput_TempCurrentEndTimeLast = CheckModelBoundOutput_TempCurrentEndTime;
 
 		// checking model regeneration outlet temperature to always be less than or equal to regeneration inlet temperature
 		if ( RegenOutTemp > RegenInTemp ) {
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutTempFailedLast = RegenOutTemp;
-			OutputChar = RoundSigDigits( RegenOutTemp, 2 );
-			OutputCharHi = RoundSigDigits( RegenInTemp, 2 );
+			CheckModelBoundOutput_TempOutputChar = RoundSigDigits( RegenOutTemp, 2 );
+			CheckModelBoundOutput_TempOutputCharHi = RoundSigDigits( RegenInTemp, 2 );
 			//      IF(RegenOutTemp .GT. RegenInTemp)THEN
 			//        RegenOutTemp = RegenInTemp
 			//      END IF
 			if ( ! WarmupFlag && ! FirstHVACIteration ) {
 				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintRegenOutTempFailedMessage = true;
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutTempFailedBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Regeneration outlet air temperature is greater than inlet temperature at " + OutputChar + '.';
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutTempFailedBuffer2 = "...Regen inlet air temperature = " + OutputCharHi + ". Occurrence info = " + EnvironmentName + ", " + CurMnDy + ", " + CreateSysTimeIntervalString();
-				CharValue = RoundSigDigits( RegenOutTemp, 6 );
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutTempFailedBuffer3 = "...Regen outlet air temperature equation: regeneration outlet air temperature allowed from the model = " + CharValue;
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutTempFailedBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Regeneration outlet air temperature is greater than inlet temperature at " + CheckModelBoundOutput_TempOutputChar + '.';
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutTempFailedBuffer2 = "...Regen inlet air temperature = " + CheckModelBoundOutput_TempOutputCharHi + ". Occurrence info = " + EnvironmentName + ", " + CurMnDy + ", " + CreateSysTimeIntervalString();
+				CheckModelBoundOutput_TempCharValue = RoundSigDigits( RegenOutTemp, 6 );
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutTempFailedBuffer3 = "...Regen outlet air temperature equation: regeneration outlet air temperature allowed from the model = " + CheckModelBoundOutput_TempCharValue;
 			} else {
 				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintRegenOutTempMessage = false;
 			}
@@ -4017,9 +4100,9 @@ namespace HeatRecovery {
 		// checking model bounds for regeneration outlet temperature
 		if ( RegenOutTemp < BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).MinRegenAirOutTemp || RegenOutTemp > BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).MaxRegenAirOutTemp ) {
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutTempLast = RegenOutTemp;
-			OutputChar = RoundSigDigits( RegenOutTemp, 2 );
-			OutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).MinRegenAirOutTemp, 2 );
-			OutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).MaxRegenAirOutTemp, 2 );
+			CheckModelBoundOutput_TempOutputChar = RoundSigDigits( RegenOutTemp, 2 );
+			CheckModelBoundOutput_TempOutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).MinRegenAirOutTemp, 2 );
+			CheckModelBoundOutput_TempOutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).MaxRegenAirOutTemp, 2 );
 			if ( RegenOutTemp < BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).MinRegenAirOutTemp ) {
 				RegenOutTemp = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).MinRegenAirOutTemp;
 			}
@@ -4028,10 +4111,10 @@ namespace HeatRecovery {
 			}
 			if ( ! WarmupFlag && ! FirstHVACIteration ) {
 				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintRegenOutTempMessage = true;
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutTempBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Regeneration outlet air temperature equation is outside model boundaries at " + OutputChar + '.';
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutTempBuffer2 = "...Valid range = " + OutputCharLo + " to " + OutputCharHi + ". Occurrence info = " + EnvironmentName + ", " + CurMnDy + ", " + CreateSysTimeIntervalString();
-				CharValue = RoundSigDigits( RegenOutTemp, 6 );
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutTempBuffer3 = "...Regen outlet air temperature equation: regeneration outlet air temperature allowed from the model = " + CharValue;
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutTempBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Regeneration outlet air temperature equation is outside model boundaries at " + CheckModelBoundOutput_TempOutputChar + '.';
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutTempBuffer2 = "...Valid range = " + CheckModelBoundOutput_TempOutputCharLo + " to " + CheckModelBoundOutput_TempOutputCharHi + ". Occurrence info = " + EnvironmentName + ", " + CurMnDy + ", " + CreateSysTimeIntervalString();
+				CheckModelBoundOutput_TempCharValue = RoundSigDigits( RegenOutTemp, 6 );
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutTempBuffer3 = "...Regen outlet air temperature equation: regeneration outlet air temperature allowed from the model = " + CheckModelBoundOutput_TempCharValue;
 			} else {
 				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintRegenOutTempMessage = false;
 			}
@@ -4089,23 +4172,16 @@ namespace HeatRecovery {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static std::string OutputChar; // character string for warning messages
-		static std::string OutputCharLo; // character string for warning messages
-		static std::string OutputCharHi; // character string for warning messages
-		static std::string CharValue; // character string for warning messages
-		static Real64 TimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
-		static Real64 CurrentEndTime( 0.0 ); // end time of time step for current simulation time step
-		static Real64 CurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
 		// current end time is compared with last to see if time step changed
 
 		//   calculate end time of current time step
-		CurrentEndTime = CurrentTime + SysTimeElapsed;
+		CheckModelBoundOutput_HumRatCurrentEndTime = CurrentTime + SysTimeElapsed;
 
 		//   Print warning messages only when valid and only for the first ocurrance. Let summary provide statistics.
 		//   Wait for next time step to print warnings. If simulation iterates, print out
 		//   the warning for the last iteration only. Must wait for next time step to accomplish this.
 		//   If a warning occurs and the simulation down shifts, the warning is not valid.
-		if ( CurrentEndTime > CurrentEndTimeLast && TimeStepSys >= TimeStepSysLast ) {
+		if ( CheckModelBoundOutput_HumRatCurrentEndTime > CheckModelBoundOutput_HumRatCurrentEndTimeLast && TimeStepSys >= CheckModelBoundOutput_HumRatTimeStepSysLast ) {
 
 			// print error when regeneration outlet humidity ratio is less than regeneration inlet humidity ratio
 			if ( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintRegenOutHumRatFailedMess ) {
@@ -4134,23 +4210,23 @@ namespace HeatRecovery {
 		} // IF(CurrentEndTime .GT. CurrentEndTimeLast .AND. TimeStepSys .GE. TimeStepSysLast)THEN
 
 		//   save last system time step and last end time of current time step (used to determine if warning is valid)
-		TimeStepSysLast = TimeStepSys;
-		CurrentEndTimeLast = CurrentEndTime;
+		CheckModelBoundOutput_HumRatTimeStepSysLast = TimeStepSys;
+		CheckModelBoundOutput_HumRatCurrentEndTimeLast = CheckModelBoundOutput_HumRatCurrentEndTime;
 
 		// checking for regeneration outlet humidity ratio less than or equal to regeneration inlet humidity ratio
 		if ( RegenOutHumRat < RegenInHumRat ) {
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutHumRatFailedLast = RegenOutHumRat;
-			OutputChar = RoundSigDigits( RegenOutHumRat, 6 );
-			OutputCharHi = RoundSigDigits( RegenInHumRat, 6 );
+			CheckModelBoundOutput_HumRatOutputChar = RoundSigDigits( RegenOutHumRat, 6 );
+			CheckModelBoundOutput_HumRatOutputCharHi = RoundSigDigits( RegenInHumRat, 6 );
 			//      IF(RegenOutHumRat .LT. RegenInHumRat)THEN
 			//        RegenOutHumRat = RegenInHumRat
 			//      END IF
 			if ( ! WarmupFlag && ! FirstHVACIteration ) {
 				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintRegenOutHumRatFailedMess = true;
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutHumRatFailedBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Regeneration outlet air humidity ratio is less than the inlet air humidity ratio at " + OutputChar + '.';
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutHumRatFailedBuffer2 = "...Regen inlet air humidity ratio = " + OutputCharHi + ". Occurrence info = " + EnvironmentName + ", " + CurMnDy + ", " + CreateSysTimeIntervalString();
-				CharValue = RoundSigDigits( RegenOutHumRat, 6 );
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutHumRatFailedBuffer3 = "...Regen outlet air humidity ratio equation: regeneration outlet air humidity ratio allowed from the model = " + CharValue;
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutHumRatFailedBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Regeneration outlet air humidity ratio is less than the inlet air humidity ratio at " + CheckModelBoundOutput_HumRatOutputChar + '.';
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutHumRatFailedBuffer2 = "...Regen inlet air humidity ratio = " + CheckModelBoundOutput_HumRatOutputCharHi + ". Occurrence info = " + EnvironmentName + ", " + CurMnDy + ", " + CreateSysTimeIntervalString();
+				CheckModelBoundOutput_HumRatCharValue = RoundSigDigits( RegenOutHumRat, 6 );
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutHumRatFailedBuffer3 = "...Regen outlet air humidity ratio equation: regeneration outlet air humidity ratio allowed from the model = " + CheckModelBoundOutput_HumRatCharValue;
 			} else {
 				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintRegenOutHumRatFailedMess = false;
 			}
@@ -4162,9 +4238,9 @@ namespace HeatRecovery {
 		// checking model bounds for regeneration outlet humidity ratio
 		if ( RegenOutHumRat < BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).MinRegenAirOutHumRat || RegenOutHumRat > BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).MaxRegenAirOutHumRat ) {
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutHumRatLast = RegenOutHumRat;
-			OutputChar = RoundSigDigits( RegenOutHumRat, 6 );
-			OutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).MinRegenAirOutHumRat, 6 );
-			OutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).MaxRegenAirOutHumRat, 6 );
+			CheckModelBoundOutput_HumRatOutputChar = RoundSigDigits( RegenOutHumRat, 6 );
+			CheckModelBoundOutput_HumRatOutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).MinRegenAirOutHumRat, 6 );
+			CheckModelBoundOutput_HumRatOutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).MaxRegenAirOutHumRat, 6 );
 			if ( RegenOutHumRat < BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).MinRegenAirOutHumRat ) {
 				RegenOutHumRat = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).MinRegenAirOutHumRat;
 			}
@@ -4173,10 +4249,10 @@ namespace HeatRecovery {
 			}
 			if ( ! WarmupFlag && ! FirstHVACIteration ) {
 				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintRegenOutHumRatMessage = true;
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutHumRatBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Regeneration outlet air humidity ratio is outside model boundaries at " + OutputChar + '.';
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutHumRatBuffer2 = "...Valid range = " + OutputCharLo + " to " + OutputCharHi + ". Occurrence info = " + EnvironmentName + ", " + CurMnDy + ", " + CreateSysTimeIntervalString();
-				CharValue = RoundSigDigits( RegenOutHumRat, 6 );
-				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutHumRatBuffer3 = "...Regen outlet air humidity ratio equation: regeneration outlet air humidity ratio allowed from the model = " + CharValue;
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutHumRatBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Regeneration outlet air humidity ratio is outside model boundaries at " + CheckModelBoundOutput_HumRatOutputChar + '.';
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutHumRatBuffer2 = "...Valid range = " + CheckModelBoundOutput_HumRatOutputCharLo + " to " + CheckModelBoundOutput_HumRatOutputCharHi + ". Occurrence info = " + EnvironmentName + ", " + CurMnDy + ", " + CreateSysTimeIntervalString();
+				CheckModelBoundOutput_HumRatCharValue = RoundSigDigits( RegenOutHumRat, 6 );
+				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenOutHumRatBuffer3 = "...Regen outlet air humidity ratio equation: regeneration outlet air humidity ratio allowed from the model = " + CheckModelBoundOutput_HumRatCharValue;
 			} else {
 				BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintRegenOutHumRatMessage = false;
 			}
@@ -4237,26 +4313,18 @@ namespace HeatRecovery {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 RegenInletRH( 0.0 ); // Regeneration inlet air relative humidity
-		static Real64 ProcInletRH( 0.0 ); // Process inlet air relative humidity
-		static std::string OutputChar; // character string for warning messages
-		static std::string OutputCharLo; // character string for warning messages
-		static std::string OutputCharHi; // character string for warning messages
-		static Real64 TimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
-		static Real64 CurrentEndTime( 0.0 ); // end time of time step for current simulation time step
-		static Real64 CurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
 		// current end time is compared with last to see if time step changed
 
 		if ( WarmupFlag || FirstHVACIteration ) return;
 
 		//   calculate end time of current time step
-		CurrentEndTime = CurrentTime + SysTimeElapsed;
+		CheckModelBoundsRH_TempEqCurrentEndTime = CurrentTime + SysTimeElapsed;
 
 		//   Print warning messages only when valid and only for the first ocurrance. Let summary provide statistics.
 		//   Wait for next time step to print warnings. If simulation iterates, print out
 		//   the warning for the last iteration only. Must wait for next time step to accomplish this.
 		//   If a warning occurs and the simulation down shifts, the warning is not valid.
-		if ( CurrentEndTime > CurrentEndTimeLast && TimeStepSys >= TimeStepSysLast ) {
+		if ( CheckModelBoundsRH_TempEqCurrentEndTime > CheckModelBoundsRH_TempEqCurrentEndTimeLast && TimeStepSys >= CheckModelBoundsRH_TempEqTimeStepSysLast ) {
 
 			// print error when regeneration inlet relative humidity is outside model boundaries
 			if ( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintRegenInRelHumTempMess ) {
@@ -4287,8 +4355,8 @@ namespace HeatRecovery {
 		} // IF(CurrentEndTime .GT. CurrentEndTimeLast .AND. TimeStepSys .GE. TimeStepSysLast)THEN
 
 		//     save last system time step and last end time of current time step (used to determine if warning is valid)
-		TimeStepSysLast = TimeStepSys;
-		CurrentEndTimeLast = CurrentEndTime;
+		CheckModelBoundsRH_TempEqTimeStepSysLast = TimeStepSys;
+		CheckModelBoundsRH_TempEqCurrentEndTimeLast = CheckModelBoundsRH_TempEqCurrentEndTime;
 
 		//     Check that condition is not above saturation curve prior to next calc (PsyRhFnTdbWPb) to avoid psyc routine errors
 		//                           *
@@ -4320,13 +4388,13 @@ namespace HeatRecovery {
 		// checking if regeneration inlet relative humidity is within model boundaries
 		if ( RegenInletRH < BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).T_MinRegenAirInRelHum || RegenInletRH > BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).T_MaxRegenAirInRelHum ) {
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenInRelHumTempLast = RegenInletRH * 100.0;
-			OutputChar = RoundSigDigits( RegenInletRH * 100.0, 1 );
-			OutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).T_MinRegenAirInRelHum * 100.0, 1 );
-			OutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).T_MaxRegenAirInRelHum * 100.0, 1 );
+			CheckModelBoundsRH_TempEqOutputChar = RoundSigDigits( RegenInletRH * 100.0, 1 );
+			CheckModelBoundsRH_TempEqOutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).T_MinRegenAirInRelHum * 100.0, 1 );
+			CheckModelBoundsRH_TempEqOutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).T_MaxRegenAirInRelHum * 100.0, 1 );
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintRegenInRelHumTempMess = true;
 
-			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenInRelHumTempBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Regeneration inlet air relative humidity related to regen outlet air temperature equation is outside model boundaries at " + OutputChar + '.';
-			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenInRelHumTempBuffer2 = "...Model limit on regeneration inlet air relative humidity is " + OutputCharLo + " to " + OutputCharHi + '.';
+			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenInRelHumTempBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Regeneration inlet air relative humidity related to regen outlet air temperature equation is outside model boundaries at " + CheckModelBoundsRH_TempEqOutputChar + '.';
+			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenInRelHumTempBuffer2 = "...Model limit on regeneration inlet air relative humidity is " + CheckModelBoundsRH_TempEqOutputCharLo + " to " + CheckModelBoundsRH_TempEqOutputCharHi + '.';
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenInRelHumTempBuffer3 = "...Occurrence info = " + EnvironmentName + ", " + CurMnDy + ", " + CreateSysTimeIntervalString();
 		} else {
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintRegenInRelHumTempMess = false;
@@ -4335,13 +4403,13 @@ namespace HeatRecovery {
 		// checking if process inlet relative humidity is within model boundaries
 		if ( ProcInletRH < BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).T_MinProcAirInRelHum || ProcInletRH > BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).T_MaxProcAirInRelHum ) {
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).ProcInRelHumTempLast = ProcInletRH * 100.0;
-			OutputChar = RoundSigDigits( ProcInletRH * 100.0, 1 );
-			OutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).T_MinProcAirInRelHum * 100.0, 1 );
-			OutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).T_MaxProcAirInRelHum * 100.0, 1 );
+			CheckModelBoundsRH_TempEqOutputChar = RoundSigDigits( ProcInletRH * 100.0, 1 );
+			CheckModelBoundsRH_TempEqOutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).T_MinProcAirInRelHum * 100.0, 1 );
+			CheckModelBoundsRH_TempEqOutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).T_MaxProcAirInRelHum * 100.0, 1 );
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintProcInRelHumTempMess = true;
 
-			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).ProcInRelHumTempBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Process inlet air relative humidity related to regen outlet air temperature equation is outside model boundaries at " + OutputChar + '.';
-			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).ProcInRelHumTempBuffer2 = "...Model limit on process inlet air relative humidity is " + OutputCharLo + " to " + OutputCharHi + '.';
+			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).ProcInRelHumTempBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Process inlet air relative humidity related to regen outlet air temperature equation is outside model boundaries at " + CheckModelBoundsRH_TempEqOutputChar + '.';
+			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).ProcInRelHumTempBuffer2 = "...Model limit on process inlet air relative humidity is " + CheckModelBoundsRH_TempEqOutputCharLo + " to " + CheckModelBoundsRH_TempEqOutputCharHi + '.';
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).ProcInRelHumTempBuffer3 = "...Occurrence info = " + EnvironmentName + ", " + CurMnDy + ", " + CreateSysTimeIntervalString();
 		} else {
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintProcInRelHumTempMess = false;
@@ -4400,26 +4468,18 @@ namespace HeatRecovery {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 RegenInletRH( 0.0 ); // Regeneration inlet air relative humidity
-		static Real64 ProcInletRH( 0.0 ); // Process inlet air relative humidity
-		static std::string OutputChar; // character string for warning messages
-		static std::string OutputCharLo; // character string for warning messages
-		static std::string OutputCharHi; // character string for warning messages
-		static Real64 TimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
-		static Real64 CurrentEndTime( 0.0 ); // end time of time step for current simulation time step
-		static Real64 CurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
 		// current end time is compared with last to see if time step changed
 
 		if ( WarmupFlag || FirstHVACIteration ) return;
 
 		//   calculate end time of current time step
-		CurrentEndTime = CurrentTime + SysTimeElapsed;
+		CheckModelBoundsRH_HumRatEqCurrentEndTime = CurrentTime + SysTimeElapsed;
 
 		//   Print warning messages only when valid and only for the first ocurrance. Let summary provide statistics.
 		//   Wait for next time step to print warnings. If simulation iterates, print out
 		//   the warning for the last iteration only. Must wait for next time step to accomplish this.
 		//   If a warning occurs and the simulation down shifts, the warning is not valid.
-		if ( CurrentEndTime > CurrentEndTimeLast && TimeStepSys >= TimeStepSysLast ) {
+		if ( CheckModelBoundsRH_HumRatEqCurrentEndTime > CheckModelBoundsRH_HumRatEqCurrentEndTimeLast && TimeStepSys >= CheckModelBoundsRH_HumRatEqTimeStepSysLast ) {
 
 			// print error when regeneration inlet relative humidity is outside model boundaries
 			if ( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintRegenInRelHumHumRatMess ) {
@@ -4450,8 +4510,8 @@ namespace HeatRecovery {
 		} // IF(CurrentEndTime .GT. CurrentEndTimeLast .AND. TimeStepSys .GE. TimeStepSysLast)THEN
 
 		//     save last system time step and last end time of current time step (used to determine if warning is valid)
-		TimeStepSysLast = TimeStepSys;
-		CurrentEndTimeLast = CurrentEndTime;
+		CheckModelBoundsRH_HumRatEqTimeStepSysLast = TimeStepSys;
+		CheckModelBoundsRH_HumRatEqCurrentEndTimeLast = CheckModelBoundsRH_HumRatEqCurrentEndTime;
 
 		//     Check that condition is not above saturation curve prior to next calc (PsyRhFnTdbWPb) to avoid psyc routine errors
 		//                           *
@@ -4477,34 +4537,34 @@ namespace HeatRecovery {
 			return;
 		}
 
-		RegenInletRH = PsyRhFnTdbWPb( H_RegenInTemp, H_RegenInHumRat, OutBaroPress );
-		ProcInletRH = min( 1.0, PsyRhFnTdbWPb( H_ProcInTemp, H_ProcInHumRat, OutBaroPress ) );
+		CheckModelBoundsRH_HumRatEqRegenInletRH = PsyRhFnTdbWPb( H_RegenInTemp, H_RegenInHumRat, OutBaroPress );
+		CheckModelBoundsRH_HumRatEqProcInletRH = min( 1.0, PsyRhFnTdbWPb( H_ProcInTemp, H_ProcInHumRat, OutBaroPress ) );
 
 		// checking if regeneration inlet relative humidity is within model boundaries
-		if ( RegenInletRH < BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinRegenAirInRelHum || RegenInletRH > BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxRegenAirInRelHum ) {
-			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenInRelHumHumRatLast = RegenInletRH * 100.0;
-			OutputChar = RoundSigDigits( RegenInletRH * 100.0, 1 );
-			OutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinRegenAirInRelHum * 100.0, 1 );
-			OutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxRegenAirInRelHum * 100.0, 1 );
+		if ( CheckModelBoundsRH_HumRatEqRegenInletRH < BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinRegenAirInRelHum || CheckModelBoundsRH_HumRatEqRegenInletRH > BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxRegenAirInRelHum ) {
+			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenInRelHumHumRatLast = CheckModelBoundsRH_HumRatEqRegenInletRH * 100.0;
+			CheckModelBoundsRH_HumRatEqOutputChar = RoundSigDigits( CheckModelBoundsRH_HumRatEqRegenInletRH * 100.0, 1 );
+			CheckModelBoundsRH_HumRatEqOutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinRegenAirInRelHum * 100.0, 1 );
+			CheckModelBoundsRH_HumRatEqOutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxRegenAirInRelHum * 100.0, 1 );
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintRegenInRelHumHumRatMess = true;
 
-			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenInRelHumHumRatBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Regeneration inlet air relative humidity related to regen outlet air humidity ratio equation is outside model boundaries at " + OutputChar + '.';
-			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenInRelHumHumRatBuffer2 = "...Model limit on regeneration inlet air relative humidity is " + OutputCharLo + " to " + OutputCharHi + '.';
+			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenInRelHumHumRatBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Regeneration inlet air relative humidity related to regen outlet air humidity ratio equation is outside model boundaries at " + CheckModelBoundsRH_HumRatEqOutputChar + '.';
+			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenInRelHumHumRatBuffer2 = "...Model limit on regeneration inlet air relative humidity is " + CheckModelBoundsRH_HumRatEqOutputCharLo + " to " + CheckModelBoundsRH_HumRatEqOutputCharHi + '.';
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).RegenInRelHumHumRatBuffer3 = "...Occurrence info = " + EnvironmentName + ", " + CurMnDy + ", " + CreateSysTimeIntervalString();
 		} else {
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintRegenInRelHumHumRatMess = false;
 		}
 
 		// checking if process inlet relative humidity is within model boundaries
-		if ( ProcInletRH < BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinProcAirInRelHum || ProcInletRH > BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxProcAirInRelHum ) {
-			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).ProcInRelHumHumRatLast = ProcInletRH * 100.0;
-			OutputChar = RoundSigDigits( ProcInletRH * 100.0, 1 );
-			OutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinProcAirInRelHum * 100.0, 1 );
-			OutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxProcAirInRelHum * 100.0, 1 );
+		if ( CheckModelBoundsRH_HumRatEqProcInletRH < BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinProcAirInRelHum || CheckModelBoundsRH_HumRatEqProcInletRH > BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxProcAirInRelHum ) {
+			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).ProcInRelHumHumRatLast = CheckModelBoundsRH_HumRatEqProcInletRH * 100.0;
+			CheckModelBoundsRH_HumRatEqOutputChar = RoundSigDigits( CheckModelBoundsRH_HumRatEqProcInletRH * 100.0, 1 );
+			CheckModelBoundsRH_HumRatEqOutputCharLo = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MinProcAirInRelHum * 100.0, 1 );
+			CheckModelBoundsRH_HumRatEqOutputCharHi = RoundSigDigits( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).H_MaxProcAirInRelHum * 100.0, 1 );
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintProcInRelHumHumRatMess = true;
 
-			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).ProcInRelHumHumRatBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Process inlet air relative humidity related to regen outlet air humidity ratio equation is outside model boundaries at " + OutputChar + '.';
-			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).ProcInRelHumHumRatBuffer2 = "...Model limit on process inlet air relative humidity is " + OutputCharLo + " to " + OutputCharHi + '.';
+			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).ProcInRelHumHumRatBuffer1 = BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PerfType + " \"" + BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).Name + "\" - Process inlet air relative humidity related to regen outlet air humidity ratio equation is outside model boundaries at " + CheckModelBoundsRH_HumRatEqOutputChar + '.';
+			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).ProcInRelHumHumRatBuffer2 = "...Model limit on process inlet air relative humidity is " + CheckModelBoundsRH_HumRatEqOutputCharLo + " to " + CheckModelBoundsRH_HumRatEqOutputCharHi + '.';
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).ProcInRelHumHumRatBuffer3 = "...Occurrence info = " + EnvironmentName + ", " + CurMnDy + ", " + CreateSysTimeIntervalString();
 		} else {
 			BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintProcInRelHumHumRatMess = false;
@@ -4555,24 +4615,19 @@ namespace HeatRecovery {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static std::string OutputCharProc; // character string for warning messages
-		static std::string OutputCharRegen; // character string for warning messages
-		static Real64 TimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
-		static Real64 CurrentEndTime( 0.0 ); // end time of time step for current simulation time step
-		static Real64 CurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
 		// current end time is compared with last to see if time step changed
 		Real64 ABSImbalancedFlow; // absolute value of process and regeneration air flow imbalance fraction
 
 		if ( WarmupFlag || FirstHVACIteration ) return;
 
 		//   calculate end time of current time step
-		CurrentEndTime = CurrentTime + SysTimeElapsed;
+		CheckForBalancedFlowCurrentEndTime = CurrentTime + SysTimeElapsed;
 
 		//   Print warning messages only when valid and only for the first ocurrance. Let summary provide statistics.
 		//   Wait for next time step to print warnings. If simulation iterates, print out
 		//   the warning for the last iteration only. Must wait for next time step to accomplish this.
 		//   If a warning occurs and the simulation down shifts, the warning is not valid.
-		if ( CurrentEndTime > CurrentEndTimeLast && TimeStepSys >= TimeStepSysLast ) {
+		if ( CheckForBalancedFlowCurrentEndTime > CheckForBalancedFlowCurrentEndTimeLast && TimeStepSys >= CheckForBalancedFlowTimeStepSysLast ) {
 
 			// print error when regeneration inlet relative humidity is outside model boundaries
 			if ( BalDesDehumPerfData( ExchCond( ExchNum ).PerfDataIndex ).PrintImbalancedMassFlowMess ) {
@@ -4592,8 +4647,8 @@ namespace HeatRecovery {
 		} // IF(CurrentEndTime .GT. CurrentEndTimeLast .AND. TimeStepSys .GE. TimeStepSysLast)THEN
 
 		//     save last system time step and last end time of current time step (used to determine if warning is valid)
-		TimeStepSysLast = TimeStepSys;
-		CurrentEndTimeLast = CurrentEndTime;
+		CheckForBalancedFlowTimeStepSysLast = TimeStepSys;
+		CheckForBalancedFlowCurrentEndTimeLast = CheckForBalancedFlowCurrentEndTime;
 
 		// checking if regeneration inlet relative humidity is within model boundaries
 		ABSImbalancedFlow = std::abs( RegenInMassFlow - ProcessInMassFlow ) / RegenInMassFlow;
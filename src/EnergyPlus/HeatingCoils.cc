@@ -191,6 +191,23 @@ namespace HeatingCoils {
 	// MODULE SUBROUTINES:
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int SourceIndexNum( 0 ); // Index to reclaim heating source (condenser) of a specific type
+		int MaxNums( 0 ); // Maximum number of numeric input fields
+		int MaxAlphas( 0 ); // Maximum number of alpha input fields
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		int ValidSourceTypeCounter( 0 ); // Counter used to determine if desuperheater source name is valid
+		bool HeatingCoilFatalError( false ); // used for error checking
+		Array1D_bool MySPTestFlag; // used for error checking
+		Array1D_bool ShowSingleWarning; // Used for single warning message for desuperheater coil
+		Array1D_bool MyEnvrnFlag; // one time environment flag
+	}
+
 	// Functions
 
 	void
@@ -387,7 +404,6 @@ namespace HeatingCoils {
 		int FuelCoilNum;
 		int DesuperheaterCoilNum; // Index to desuperheater heating coil
 		int RemainingCoils; // Index for error checking DO loop for desuperheater coils on remaining heating coil
-		static int SourceIndexNum( 0 ); // Index to reclaim heating source (condenser) of a specific type
 		std::string SourceTypeString; // character string used in error message for desuperheating coil
 		std::string SourceNameString; // character string used in error message for desuperheating coil
 		std::string CurrentModuleObject; // for ease in getting objects
@@ -397,9 +413,6 @@ namespace HeatingCoils {
 		Array1D< Real64 > Numbers; // Numeric input items for object
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int MaxNums( 0 ); // Maximum number of numeric input fields
-		static int MaxAlphas( 0 ); // Maximum number of alpha input fields
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 		//  certain object in the input file
 		int NumAlphas;
 		int NumNums;
@@ -1006,11 +1019,6 @@ namespace HeatingCoils {
 		int RackNum; // Index to refrigerated case compressor rack
 		int CondNum; // Index to refrigeration condenser
 		int DXCoilNum; // Index to DX cooling coil
-		static int ValidSourceTypeCounter( 0 ); // Counter used to determine if desuperheater source name is valid
-		static bool HeatingCoilFatalError( false ); // used for error checking
-		static Array1D_bool MySPTestFlag; // used for error checking
-		static Array1D_bool ShowSingleWarning; // Used for single warning message for desuperheater coil
-		static Array1D_bool MyEnvrnFlag; // one time environment flag
 
 		if ( MyOneTimeFlag ) {
 			// initialize the environment and sizing flags
@@ -3373,6 +3381,15 @@ namespace HeatingCoils {
 		HeatingCoil.deallocate();
 		HeatingCoilNumericFields.deallocate();
 
+		SourceIndexNum = 0;
+		MaxNums = 0;
+		MaxAlphas = 0;
+		TotalArgs = 0;
+		ValidSourceTypeCounter = 0;
+		HeatingCoilFatalError = false;
+		MySPTestFlag.deallocate();
+		ShowSingleWarning.deallocate();
+		MyEnvrnFlag.deallocate();
 	}
 
 	void
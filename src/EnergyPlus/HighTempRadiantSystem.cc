@@ -173,6 +173,19 @@ namespace HighTempRadiantSystem {
 	Array1D< HighTempRadiantSystemData > HighTempRadSys;
 	Array1D< HighTempRadSysNumericFieldData > HighTempRadSysNumericFields;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // First time, input is "gotten"
+		bool firstTime( true ); // For one-time initializations
+		bool MyEnvrnFlag( true );
+		bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
+		bool UpdateHighTempRadiantSystemMyEnvrnFlag( true );
+	}
+
 	// Functions
 	void
  	clear_state()
@@ -188,6 +201,11 @@ namespace HighTempRadiantSystem {
 		CheckEquipName.deallocate();
 		HighTempRadSys.deallocate();
 		HighTempRadSysNumericFields.deallocate();
+		GetInputFlag = true;
+		firstTime = true;
+		MyEnvrnFlag = true;
+		ZoneEquipmentListChecked = false;
+		UpdateHighTempRadiantSystemMyEnvrnFlag = true;
 	}
 
 	
@@ -234,7 +252,6 @@ namespace HighTempRadiantSystem {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInputFlag( true ); // First time, input is "gotten"
 		bool ErrorsFoundInGet; // Set to true when there are severe errors during the Get routine
 		int RadSysNum; // Radiant system number/index in local derived types
 
@@ -719,10 +736,7 @@ namespace HighTempRadiantSystem {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool firstTime( true ); // For one-time initializations
 		int ZoneNum; // Intermediate variable for keeping track of the zone number
-		static bool MyEnvrnFlag( true );
-		static bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
 		int Loop;
 
 		// FLOW:
@@ -1202,14 +1216,13 @@ namespace HighTempRadiantSystem {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ZoneNum; // Zone index number for the current radiant system
-		static bool MyEnvrnFlag( true );
 
 		// FLOW:
-		if ( BeginEnvrnFlag && MyEnvrnFlag ) {
-			MyEnvrnFlag = false;
+		if ( BeginEnvrnFlag && UpdateHighTempRadiantSystemMyEnvrnFlag ) {
+			UpdateHighTempRadiantSystemMyEnvrnFlag = false;
 		}
 		if ( ! BeginEnvrnFlag ) {
-			MyEnvrnFlag = true;
+			UpdateHighTempRadiantSystemMyEnvrnFlag = true;
 		}
 		// First, update the running average if necessary...
 		if ( LastSysTimeElapsed( RadSysNum ) == SysTimeElapsed ) {
@@ -150,6 +150,18 @@ namespace Humidifiers {
 	// Object Data
 	Array1D< HumidifierData > Humidifier;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // First time, input is "gotten"
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		bool SizeHumidifierErrorsFound( false ); // TRUE if errors detected in input
+	}
+
 	// Clears the global data in Humidifiers.
 	// Needed for unit tests, should not be normally called.
 	void
@@ -160,6 +172,10 @@ namespace Humidifiers {
 		NumGasSteamHums = 0;
 		CheckEquipName.deallocate();
 		Humidifier.deallocate();
+		GetInputFlag = true;
+		ErrorsFound = false;
+		TotalArgs = 0;
+		SizeHumidifierErrorsFound = false;
 	}
 
 	void
@@ -203,7 +219,6 @@ namespace Humidifiers {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int HumNum; // index of humidifier unit being simulated
-		static bool GetInputFlag( true ); // First time, input is "gotten"
 		Real64 WaterAddNeeded; // output in kg/s needed from humidifier to meet humidity setpoint
 
 		if ( GetInputFlag ) {
@@ -319,7 +334,6 @@ namespace Humidifiers {
 		int MaxNums; // maximum Number of Numbers for each GetObjectItem call
 		int MaxAlphas; // maximum Number of Numbers for each GetObjectItem call
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		std::string CurrentModuleObject; // for ease in getting objects
@@ -329,7 +343,6 @@ namespace Humidifiers {
 		Array1D< Real64 > Numbers; // Numeric input items for object
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 		//  certain object in the input file
 
 		CurrentModuleObject = "Humidifier:Steam:Electric";
@@ -685,7 +698,6 @@ namespace Humidifiers {
 		Real64 WaterSatEnthalpy; // enthalpy of saturated water at 100C, J/kg
 		bool IsAutoSize;			// Indicator to autosize
 		bool HardSizeNoDesRun;		// Indicator to a hard-sized field with no design sizing data
-		static bool ErrorsFound( false ); // TRUE if errors detected in input
 		Real64 NomPowerDes;			// Autosized nominal power for reporting
 		Real64 NomPowerUser;		// Hardsized nominal power for reporting
 		Real64 MassFlowDes;			// Design air mass flow rate
@@ -870,7 +882,7 @@ namespace Humidifiers {
 			}
 		}
 
-		if ( ErrorsFound ) {
+		if ( SizeHumidifierErrorsFound ) {
 			ShowFatalError( CalledFrom + ": Mismatch was found in the Rated Gas Use Rate and Thermal Efficiency for gas fired steam humidifier = " + Name + ". " );
 		}
 	}
@@ -257,6 +257,11 @@ namespace ICEngineElectricGenerator {
 
 	// Functions
 
+	// Clears the global data in ICEngineElectricGenerator.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimICEngineGenerator(
 		int const GeneratorType, // type of Generator
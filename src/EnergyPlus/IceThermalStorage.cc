@@ -222,8 +222,78 @@ namespace IceThermalStorage {
 
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool firstTime( true );
+		bool MyEnvrnFlag( true );
+		bool MyOneTimeFlag( true );
+		Array1D_bool MyPlantScanFlag;
+		Array1D_bool InitDetailedIceStorageMyEnvrnFlag;
+		Array1D_bool InitSimpleIceStorageMyPlantScanFlag;
+		bool InitSimpleIceStorageMyOneTimeFlag( true );
+		Array1D_bool InitSimpleIceStorageMyEnvrnFlag;
+		Real64 Umax( 0.0 ); // Max Urate adjusted Urate based on Error protection (I) [fraction]
+		Real64 Umin( 0.0 ); // Min Urate adjusted Urate based on Error protection (I) [fraction]
+		Real64 Uact( 0.0 ); // Acting between Usys and UsysLow Urate adjusted Urate based on Error protection (I) [fraction]
+		Real64 Umyload( 0.0 );
+		Real64 Qice( 0.0 );
+		Real64 DeltaTemp( 0.0 );
+	}
+
 	// Functions
 
+	// Clears the global data in IceThermalStorage.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		ResetXForITSFlag = false;
+		ITSNomCap = 0.0;
+		InletNodeNum = 0;
+		OutletNodeNum = 0;
+		IceNum = 0;
+		NumIceStorages = 0;
+		IceStorageNotFound = false;
+		NumDetIceStorages = 0;
+		TotalIceStorages = 0;
+		UAIceCh = 0.0;
+		UAIceDisCh = 0.0;
+		HLoss = 0.0;
+		XCurIceFrac = 0.0;
+		U = 0.0;
+		Urate = 0.0;
+		ITSMassFlowRate = 0.0;
+		ITSInletTemp = 0.0;
+		ITSOutletTemp = 0.0;
+		ITSOutletSetPointTemp = 0.0;
+		ITSCoolingRate = 0.0;
+		ITSCoolingEnergy = 0.0;
+		ChillerOutletTemp = 0.0;
+		CheckEquipName.deallocate();
+		IceStorage.deallocate();
+		IceStorageReport.deallocate();
+		DetIceStor.deallocate();
+		IceStorageTypeMap.deallocate();
+		firstTime = true;
+		MyEnvrnFlag = true;
+		MyOneTimeFlag = true;
+		MyPlantScanFlag.deallocate();
+		InitDetailedIceStorageMyEnvrnFlag.deallocate();
+		InitSimpleIceStorageMyPlantScanFlag.deallocate();
+		InitSimpleIceStorageMyOneTimeFlag = true;
+		InitSimpleIceStorageMyEnvrnFlag.deallocate();
+		Umax = 0.0;
+		Umin = 0.0;
+		Uact = 0.0;
+		Umyload = 0.0;
+		Qice = 0.0;
+		DeltaTemp = 0.0;
+	}
+
 	void
 	SimIceStorage(
 		std::string const & IceStorageType,
@@ -277,8 +347,6 @@ namespace IceThermalStorage {
 		// DERIVED TYPE DEFINITIONS
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool firstTime( true );
-		static bool MyEnvrnFlag( true );
 		int IceStorageNum;
 
 		// FLOW
@@ -1258,17 +1326,14 @@ namespace IceThermalStorage {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyPlantScanFlag;
-		static Array1D_bool MyEnvrnFlag;
 		int CompNum; // local do loop index
 		// FLOW:
 
 		if ( MyOneTimeFlag ) {
 			MyPlantScanFlag.allocate( NumDetIceStorages );
-			MyEnvrnFlag.allocate( NumDetIceStorages );
+			InitDetailedIceStorageMyEnvrnFlag.allocate( NumDetIceStorages );
 			MyPlantScanFlag = true;
-			MyEnvrnFlag = true;
+			InitDetailedIceStorageMyEnvrnFlag = true;
 			MyOneTimeFlag = false;
 		}
 
@@ -1278,7 +1343,7 @@ namespace IceThermalStorage {
 			MyPlantScanFlag( IceNum ) = false;
 		}
 
-		if ( BeginEnvrnFlag && MyEnvrnFlag( IceNum ) ) { // Beginning of environment initializations
+		if ( BeginEnvrnFlag && InitDetailedIceStorageMyEnvrnFlag( IceNum ) ) { // Beginning of environment initializations
 			// Make sure all state variables are reset at the beginning of every environment to avoid problems.
 			// The storage unit is assumed to be fully charged at the start of any environment.
 			// The IceNum variable is a module level variable that is already set before this subroutine is called.
@@ -1302,9 +1367,9 @@ namespace IceThermalStorage {
 
 			}
 
-			MyEnvrnFlag( IceNum ) = false;
+			InitDetailedIceStorageMyEnvrnFlag( IceNum ) = false;
 		}
-		if ( ! BeginEnvrnFlag ) MyEnvrnFlag( IceNum ) = true;
+		if ( ! BeginEnvrnFlag ) InitDetailedIceStorageMyEnvrnFlag( IceNum ) = true;
 
 		// Initializations that are done every iteration
 		// Make sure all of the reporting variables are always reset at the start of any iteration
@@ -1365,31 +1430,28 @@ namespace IceThermalStorage {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array1D_bool MyPlantScanFlag;
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyEnvrnFlag;
 		bool errFlag;
 		int CompNum; // local do loop counter
 
-		if ( MyOneTimeFlag ) {
-			MyPlantScanFlag.allocate( NumIceStorages );
-			MyEnvrnFlag.allocate( NumIceStorages );
-			MyOneTimeFlag = false;
-			MyPlantScanFlag = true;
-			MyEnvrnFlag = true;
+		if ( InitSimpleIceStorageMyOneTimeFlag ) {
+			InitSimpleIceStorageMyPlantScanFlag.allocate( NumIceStorages );
+			InitSimpleIceStorageMyEnvrnFlag.allocate( NumIceStorages );
+			InitSimpleIceStorageMyOneTimeFlag = false;
+			InitSimpleIceStorageMyPlantScanFlag = true;
+			InitSimpleIceStorageMyEnvrnFlag = true;
 		}
 
-		if ( MyPlantScanFlag( IceNum ) ) {
+		if ( InitSimpleIceStorageMyPlantScanFlag( IceNum ) ) {
 			// Locate the storage on the plant loops for later usage
 			errFlag = false;
 			ScanPlantLoopsForObject( IceStorage( IceNum ).Name, TypeOf_TS_IceSimple, IceStorage( IceNum ).LoopNum, IceStorage( IceNum ).LoopSideNum, IceStorage( IceNum ).BranchNum, IceStorage( IceNum ).CompNum, _, _, _, _, _, errFlag );
 			if ( errFlag ) {
 				ShowFatalError( "InitSimpleIceStorage: Program terminated due to previous condition(s)." );
 			}
-			MyPlantScanFlag( IceNum ) = false;
+			InitSimpleIceStorageMyPlantScanFlag( IceNum ) = false;
 		}
 
-		if ( BeginEnvrnFlag && MyEnvrnFlag( IceNum ) ) {
+		if ( BeginEnvrnFlag && InitSimpleIceStorageMyEnvrnFlag( IceNum ) ) {
 			IceStorage( IceNum ).DesignMassFlowRate = PlantLoop( IceStorage( IceNum ).LoopNum ).MaxMassFlowRate;
 			//no design flow rates for model, assume min is zero and max is plant loop's max
 			InitComponentNodes( 0.0, IceStorage( IceNum ).DesignMassFlowRate, IceStorage( IceNum ).PltInletNodeNum, IceStorage( IceNum ).PltOutletNodeNum, IceStorage( IceNum ).LoopNum, IceStorage( IceNum ).LoopSideNum, IceStorage( IceNum ).BranchNum, IceStorage( IceNum ).CompNum );
@@ -1412,10 +1474,10 @@ namespace IceThermalStorage {
 			IceStorageReport( IceNum ).ITSInletTemp = 0.0;
 			IceStorageReport( IceNum ).ITSOutletTemp = 0.0;
 
-			MyEnvrnFlag( IceNum ) = false;
+			InitSimpleIceStorageMyEnvrnFlag( IceNum ) = false;
 		}
 
-		if ( ! BeginEnvrnFlag ) MyEnvrnFlag( IceNum ) = true;
+		if ( ! BeginEnvrnFlag ) InitSimpleIceStorageMyEnvrnFlag( IceNum ) = true;
 
 		ITSNomCap = IceStorage( IceNum ).ITSNomCap;
 		InletNodeNum = IceStorage( IceNum ).PltInletNodeNum;
@@ -1889,13 +1951,7 @@ namespace IceThermalStorage {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		// External function
 		// Local
-		static Real64 Umax( 0.0 ); // Max Urate adjusted Urate based on Error protection (I) [fraction]
-		static Real64 Umin( 0.0 ); // Min Urate adjusted Urate based on Error protection (I) [fraction]
-		static Real64 Uact( 0.0 ); // Acting between Usys and UsysLow Urate adjusted Urate based on Error protection (I) [fraction]
-		static Real64 Umyload( 0.0 );
 		// unused  REAL(r64)    :: QiceMin
-		static Real64 Qice( 0.0 );
-		static Real64 DeltaTemp( 0.0 );
 
 		int LoopNum;
 		int LoopSideNum;
@@ -354,6 +354,11 @@ namespace IceThermalStorage {
 
 	// Functions
 
+	// Clears the global data in IceThermalStorage.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimIceStorage(
 		std::string const & IceStorageType,
@@ -170,6 +170,26 @@ namespace InputProcessor {
 		Array1D< Real64 > NumberArgs;
 		Array1D_bool AlphaArgsBlank;
 		Array1D_bool NumberArgsBlank;
+		bool ErrorsInIDD( false ); // to check for any errors flagged during data dictionary processing
+		Array1D_bool AddObjectDefandParseAlphaOrNumeric; // Array of argument designations, True is Alpha, False is numeric, saved in ObjectDef when done
+		Array1D_bool AddObjectDefandParseRequiredFields; // Array of argument required fields
+		Array1D_bool AlphRetainCase; // Array of argument for retain case
+		Array1D_string AlphFieldChecks; // Array with alpha field names
+		Array1D_string AlphFieldDefaults; // Array with alpha field defaults
+		int MaxANArgs( 7700 ); // Current count of Max args to object  (9/2010)
+		int PrevSizeNumNumeric( -1 );
+		int PrevCount( -1 );
+		int PrevSizeNumAlpha( -1 );
+		Array1D< RangeCheckDef > NumRangeChecks; // Structure for Range Check, Defaults of numeric fields
+		Array1D< RangeCheckDef > TempChecks; // Structure (ref: NumRangeChecks) for re-allocation procedure
+		bool errFlag( false );
+		int const dimLineBuf( 10 );
+		Array1D_string ValidateObjectandParseLineBuf( dimLineBuf );
+		int ValidateObjectandParseStartLine;
+		int ValidateObjectandParseNumConxLines;
+		int CurLines;
+		int ValidateObjectandParseCurQPtr;
+		std::string CurObject;
 	}
 
 	//Integer Variables for the Module
@@ -215,6 +235,7 @@ namespace InputProcessor {
 	std::string CurrentFieldName; // Current Field Name (IDD)
 	Array1D_string ObsoleteObjectsRepNames; // Array of Replacement names for Obsolete objects
 	std::string ReplacementName;
+	std::string PreloadedIddFileName; // Data dictionary already processed by PreloadDataDictionary (blank if none)
 
 	//Logical Variables for Module
 	bool OverallErrorFlag( false ); // If errors found during parse of IDF, will fatal at end
@@ -296,6 +317,7 @@ namespace InputProcessor {
 		InputLine = std::string();
 		CurrentFieldName = std::string();
 		ReplacementName = std::string();
+		PreloadedIddFileName = std::string();
 
 		OverallErrorFlag = false;
 		EchoInputLine = true;
@@ -315,6 +337,25 @@ namespace InputProcessor {
 		NumberArgsBlank.deallocate();
 
 		echo_stream = nullptr;
+		ErrorsInIDD = false;
+		AddObjectDefandParseAlphaOrNumeric.deallocate();
+		AddObjectDefandParseRequiredFields.deallocate();
+		AlphRetainCase.deallocate();
+		AlphFieldChecks.deallocate();
+		AlphFieldDefaults.deallocate();
+		MaxANArgs = 7700;
+		PrevSizeNumNumeric = -1;
+		PrevCount = -1;
+		PrevSizeNumAlpha = -1;
+		NumRangeChecks.deallocate();
+		TempChecks.deallocate();
+		errFlag = false;
+		ValidateObjectandParseLineBuf = Array1D_string( dimLineBuf );
+		ValidateObjectandParseStartLine = 0;
+		ValidateObjectandParseNumConxLines = 0;
+		CurLines = 0;
+		ValidateObjectandParseCurQPtr = 0;
+		CurObject.clear();
 	}
 
 	void
@@ -365,7 +406,6 @@ namespace InputProcessor {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		bool FileExists; // Check variable for .idd/.idf files
-		static bool ErrorsInIDD( false ); // to check for any errors flagged during data dictionary processing
 		int Loop;
 		int CountErr;
 		int Num1;
@@ -399,23 +439,29 @@ namespace InputProcessor {
 			ShowFatalError( "ProcessInput: Could not open file " + outputIperrFileName + " for output (write)." );
 		}
 
-		std::ifstream idd_stream( inputIddFileName, std::ios_base::in | std::ios_base::binary );
-		if ( ! idd_stream ) {
-			if ( idd_stream.is_open() ) idd_stream.close();
-			if ( ! gio::file_exists( inputIddFileName ) ) { // No such file
-				ShowFatalError( "ProcessInput: Energy+.idd missing. Program terminates. Fullname=" + inputIddFileName );
-			} else {
-				ShowFatalError( "ProcessInput: Could not open file \"" + inputIddFileName + "\" for input (read)." );
-			}
-		}
-		NumLines = 0;
-
 		DoingInputProcessing = true;
 		gio::write( EchoInputFile, fmtLD ) << " Processing Data Dictionary -- Start";
-		DisplayString( "Processing Data Dictionary" );
-		ProcessingIDD = true;
-		ProcessDataDicFile( idd_stream, ErrorsInIDD );
-		idd_stream.close();
+		if ( ! PreloadedIddFileName.empty() && PreloadedIddFileName == inputIddFileName ) {
+			// Object definitions were read once before this run was started (batch mode)
+			DisplayString( "Using Preloaded Data Dictionary" );
+			ProcessingIDD = true;
+		} else {
+			std::ifstream idd_stream( inputIddFileName, std::ios_base::in | std::ios_base::binary );
+			if ( ! idd_stream ) {
+				if ( idd_stream.is_open() ) idd_stream.close();
+				if ( ! gio::file_exists( inputIddFileName ) ) { // No such file
+					ShowFatalError( "ProcessInput: Energy+.idd missing. Program terminates. Fullname=" + inputIddFileName );
+				} else {
+					ShowFatalError( "ProcessInput: Could not open file \"" + inputIddFileName + "\" for input (read)." );
+				}
+			}
+			NumLines = 0;
+
+			DisplayString( "Processing Data Dictionary" );
+			ProcessingIDD = true;
+			ProcessDataDicFile( idd_stream, ErrorsInIDD );
+			idd_stream.close();
+		}
 
 		ListOfObjects.allocate( NumObjectDefs );
 		for ( int i = 1; i <= NumObjectDefs; ++i ) ListOfObjects( i ) = ObjectDef( i ).Name;
@@ -568,6 +614,46 @@ namespace InputProcessor {
 
 	}
 
+	void
+	PreloadDataDictionary(
+		std::string const & IddFileName, // Data dictionary to process
+		bool & ErrorsFound // set to true if the file could not be read or any errors flagged during IDD processing
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine reads the data dictionary ahead of ProcessInput so that the object
+		// definitions can be shared by several runs (batch mode forks each run from this state).
+		// ProcessInput skips reading the data dictionary when inputIddFileName matches IddFileName.
+
+		// METHODOLOGY EMPLOYED:
+		// No output files are open at this point; nothing is echoed.
+
+		std::ifstream idd_stream( IddFileName, std::ios_base::in | std::ios_base::binary );
+		if ( ! idd_stream ) {
+			ErrorsFound = true;
+			return;
+		}
+		NumLines = 0;
+		ProcessingIDD = true;
+		ProcessDataDicFile( idd_stream, ErrorsFound );
+		ProcessingIDD = false;
+		idd_stream.close();
+
+		if ( ErrorsFound || NumObjectDefs == 0 ) {
+			ErrorsFound = true;
+			return;
+		}
+		PreloadedIddFileName = IddFileName;
+
+	}
+
 	void
 	ProcessDataDicFile(
 		std::istream & idd_stream,
@@ -778,11 +864,6 @@ namespace InputProcessor {
 		bool errFlag; // Local Error condition flag, when true, object not added to Global list
 		char TargetChar; // Single character scanned to test for current field type (A or N)
 		bool BlankLine; // True when this line is "blank" (may have comment characters as first character on line)
-		static Array1D_bool AlphaOrNumeric; // Array of argument designations, True is Alpha, False is numeric, saved in ObjectDef when done
-		static Array1D_bool RequiredFields; // Array of argument required fields
-		static Array1D_bool AlphRetainCase; // Array of argument for retain case
-		static Array1D_string AlphFieldChecks; // Array with alpha field names
-		static Array1D_string AlphFieldDefaults; // Array with alpha field defaults
 		bool MinMax; // Set to true when MinMax field has been found by ReadInputLine
 		bool Default; // Set to true when Default field has been found by ReadInputLine
 		bool AutoSize; // Set to true when Autosizable field has been found by ReadInputLine
@@ -792,19 +873,13 @@ namespace InputProcessor {
 		int WhichMinMax; // =0 (none/invalid), =1 \min, =2 \min>, =3 \max, =4 \max<
 		Real64 Value; // Value returned by ReadInputLine (either min, max, default, autosize or autocalculate)
 		bool MinMaxError; // Used to see if min, max, defaults have been set appropriately (True if error)
-		static int MaxANArgs( 7700 ); // Current count of Max args to object  (9/2010)
 		bool ErrorsFoundFlag;
-		static int PrevSizeNumNumeric( -1 );
-		static int PrevCount( -1 );
-		static int PrevSizeNumAlpha( -1 );
 
 		// Object Data
-		static Array1D< RangeCheckDef > NumRangeChecks; // Structure for Range Check, Defaults of numeric fields
-		static Array1D< RangeCheckDef > TempChecks; // Structure (ref: NumRangeChecks) for re-allocation procedure
 
-		if ( ! allocated( AlphaOrNumeric ) ) {
-			AlphaOrNumeric.allocate( {0,MaxANArgs} );
-			RequiredFields.allocate( {0,MaxANArgs} );
+		if ( ! allocated( AddObjectDefandParseAlphaOrNumeric ) ) {
+			AddObjectDefandParseAlphaOrNumeric.allocate( {0,MaxANArgs} );
+			AddObjectDefandParseRequiredFields.allocate( {0,MaxANArgs} );
 			AlphRetainCase.allocate( {0,MaxANArgs} );
 			NumRangeChecks.allocate( MaxANArgs );
 			AlphFieldChecks.allocate( MaxANArgs );
@@ -866,8 +941,8 @@ namespace InputProcessor {
 			PrevCount = MaxANArgs;
 		}
 
-		AlphaOrNumeric( {0,PrevCount} ) = true;
-		RequiredFields( {0,PrevCount} ) = false;
+		AddObjectDefandParseAlphaOrNumeric( {0,PrevCount} ) = true;
+		AddObjectDefandParseRequiredFields( {0,PrevCount} ) = false;
 		AlphRetainCase( {0,PrevCount} ) = false;
 
 		if ( PrevSizeNumAlpha == -1 ) {
@@ -920,8 +995,8 @@ namespace InputProcessor {
 
 					if ( Count > MaxANArgs ) { // Reallocation
 						int const newANArgs( MaxANArgs + ANArgsDefAllocInc );
-						AlphaOrNumeric.redimension( {0,newANArgs}, false );
-						RequiredFields.redimension( {0,newANArgs}, false );
+						AddObjectDefandParseAlphaOrNumeric.redimension( {0,newANArgs}, false );
+						AddObjectDefandParseRequiredFields.redimension( {0,newANArgs}, false );
 						AlphRetainCase.redimension( {0,newANArgs}, false );
 						NumRangeChecks.redimension( newANArgs );
 						AlphFieldChecks.redimension( newANArgs );
@@ -932,21 +1007,21 @@ namespace InputProcessor {
 					TargetChar = InputLine[ CurPos + Pos ];
 
 					if ( TargetChar == 'A' || TargetChar == 'a' ) {
-						AlphaOrNumeric( Count ) = true;
+						AddObjectDefandParseAlphaOrNumeric( Count ) = true;
 						++ObjectDef( NumObjectDefs ).NumAlpha;
 						if ( FieldSet ) AlphFieldChecks( ObjectDef( NumObjectDefs ).NumAlpha ) = CurrentFieldName;
 						if ( ObjectDef( NumObjectDefs ).NumAlpha == 1 ) {
 							if ( hasi( CurrentFieldName, "NAME" ) ) ObjectDef( NumObjectDefs ).NameAlpha1 = true;
 						}
 					} else {
-						AlphaOrNumeric( Count ) = false;
+						AddObjectDefandParseAlphaOrNumeric( Count ) = false;
 						++ObjectDef( NumObjectDefs ).NumNumeric;
 						if ( FieldSet ) NumRangeChecks( ObjectDef( NumObjectDefs ).NumNumeric ).FieldName = CurrentFieldName;
 					}
 
 				} else {
 					ReadInputLine( idd_stream, CurPos, BlankLine, EndofFile, MinMax, WhichMinMax, MinMaxString, Value, Default, AlphDefaultString, AutoSize, AutoCalculate, RetainCaseFlag, ErrorsFoundFlag );
-					if ( ! AlphaOrNumeric( Count ) ) {
+					if ( ! AddObjectDefandParseAlphaOrNumeric( Count ) ) {
 						// only record for numeric fields
 						if ( MinMax ) {
 							NumRangeChecks( ObjectDef( NumObjectDefs ).NumNumeric ).MinMaxChk = true;
@@ -985,7 +1060,7 @@ namespace InputProcessor {
 						ErrorsFoundFlag = false;
 					}
 					if ( RequiredField ) {
-						RequiredFields( Count ) = true;
+						AddObjectDefandParseRequiredFields( Count ) = true;
 						MinimumNumberOfFields = max( Count, MinimumNumberOfFields );
 					}
 					if ( RetainCaseFlag ) {
@@ -1053,12 +1128,12 @@ namespace InputProcessor {
 					NumRangeChecks( ObjectDef( NumObjectDefs ).NumNumeric ).MinMaxValue( 2 ) = Value;
 				}
 			}
-			if ( Default && ! AlphaOrNumeric( Count ) ) {
+			if ( Default && ! AddObjectDefandParseAlphaOrNumeric( Count ) ) {
 				NumRangeChecks( ObjectDef( NumObjectDefs ).NumNumeric ).DefaultChk = true;
 				NumRangeChecks( ObjectDef( NumObjectDefs ).NumNumeric ).Default = Value;
 				if ( AlphDefaultString == "AUTOSIZE" ) NumRangeChecks( ObjectDef( NumObjectDefs ).NumNumeric ).DefAutoSize = true;
 				if ( AlphDefaultString == "AUTOCALCULATE" ) NumRangeChecks( ObjectDef( NumObjectDefs ).NumNumeric ).DefAutoCalculate = true;
-			} else if ( Default && AlphaOrNumeric( Count ) ) {
+			} else if ( Default && AddObjectDefandParseAlphaOrNumeric( Count ) ) {
 				AlphFieldDefaults( ObjectDef( NumObjectDefs ).NumAlpha ) = AlphDefaultString;
 			}
 			if ( AutoSize ) {
@@ -1081,7 +1156,7 @@ namespace InputProcessor {
 		}
 
 		if ( RequiredField ) {
-			RequiredFields( Count ) = true;
+			AddObjectDefandParseRequiredFields( Count ) = true;
 			MinimumNumberOfFields = max( Count, MinimumNumberOfFields );
 		}
 		if ( RetainCaseFlag ) {
@@ -1111,7 +1186,7 @@ namespace InputProcessor {
 		NumNumericArgsFound += ObjectDef( NumObjectDefs ).NumNumeric;
 		MaxNumericArgsFound = max( MaxNumericArgsFound, ObjectDef( NumObjectDefs ).NumNumeric );
 		ObjectDef( NumObjectDefs ).AlphaOrNumeric.allocate( Count );
-		ObjectDef( NumObjectDefs ).AlphaOrNumeric = AlphaOrNumeric( {1,Count} );
+		ObjectDef( NumObjectDefs ).AlphaOrNumeric = AddObjectDefandParseAlphaOrNumeric( {1,Count} );
 		ObjectDef( NumObjectDefs ).AlphRetainCase.allocate( Count );
 		ObjectDef( NumObjectDefs ).AlphRetainCase = AlphRetainCase( {1,Count} );
 		PrevCount = Count;
@@ -1130,7 +1205,7 @@ namespace InputProcessor {
 		}
 		PrevSizeNumAlpha = ObjectDef( NumObjectDefs ).NumAlpha;
 		ObjectDef( NumObjectDefs ).ReqField.allocate( Count );
-		ObjectDef( NumObjectDefs ).ReqField = RequiredFields( {1,Count} );
+		ObjectDef( NumObjectDefs ).ReqField = AddObjectDefandParseRequiredFields( {1,Count} );
 		for ( Count = 1; Count <= ObjectDef( NumObjectDefs ).NumNumeric; ++Count ) {
 			if ( ObjectDef( NumObjectDefs ).NumRangeChks( Count ).MinMaxChk ) {
 				// Checking MinMax Range (min vs. max and vice versa)
@@ -1450,7 +1525,6 @@ namespace InputProcessor {
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		int const dimLineBuf( 10 );
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -1469,7 +1543,6 @@ namespace InputProcessor {
 		std::string::size_type Pos;
 		bool EndofObject;
 		bool BlankLine;
-		static bool errFlag( false );
 		std::string::size_type LenLeft;
 		int Count;
 		std::string FieldString;
@@ -1477,11 +1550,6 @@ namespace InputProcessor {
 		std::string Message;
 		std::string cStartLine;
 		std::string cStartName;
-		static Array1D_string LineBuf( dimLineBuf );
-		static int StartLine;
-		static int NumConxLines;
-		static int CurLines;
-		static int CurQPtr;
 
 		std::string String;
 		bool IDidntMeanIt;
@@ -1624,20 +1692,20 @@ namespace InputProcessor {
 		++CurPos;
 
 		//  Keep context buffer in case of errors
-		LineBuf = BlankString;
-		NumConxLines = 0;
-		StartLine = NumLines;
+		ValidateObjectandParseLineBuf = BlankString;
+		ValidateObjectandParseNumConxLines = 0;
+		ValidateObjectandParseStartLine = NumLines;
 		cStartLine = InputLine.substr( 0, 300 );
 		cStartName = BlankString;
-		NumConxLines = 0;
+		ValidateObjectandParseNumConxLines = 0;
 		CurLines = NumLines;
-		CurQPtr = 0;
+		ValidateObjectandParseCurQPtr = 0;
 
 		while ( ! EndofFile && ! EndofObject ) {
 			if ( CurLines != NumLines ) {
-				NumConxLines = min( NumConxLines + 1, dimLineBuf );
-				++CurQPtr;
-				if ( CurQPtr == 1 && is_blank( cStartName ) && not_blank( InputLine ) ) {
+				ValidateObjectandParseNumConxLines = min( ValidateObjectandParseNumConxLines + 1, dimLineBuf );
+				++ValidateObjectandParseCurQPtr;
+				if ( ValidateObjectandParseCurQPtr == 1 && is_blank( cStartName ) && not_blank( InputLine ) ) {
 					if ( Found > 0 ) {
 						if ( ObjectDef( Found ).NameAlpha1 ) {
 							Pos = index( InputLine, ',' );
@@ -1647,8 +1715,8 @@ namespace InputProcessor {
 						}
 					}
 				}
-				if ( CurQPtr > dimLineBuf ) CurQPtr = 1;
-				LineBuf( CurQPtr ) = InputLine;
+				if ( ValidateObjectandParseCurQPtr > dimLineBuf ) ValidateObjectandParseCurQPtr = 1;
+				ValidateObjectandParseLineBuf( ValidateObjectandParseCurQPtr ) = InputLine;
 				CurLines = NumLines;
 			}
 			if ( CurPos < static_cast< std::string::size_type >( InputLineLength ) ) {
@@ -1665,11 +1733,11 @@ namespace InputProcessor {
 					} else {
 						if ( InputLine[ InputLineLength - 1 ] == '!' ) {
 							Pos = InputLineLength - CurPos;
-							DumpCurrentLineBuffer( StartLine, cStartLine, cStartName, NumLines, NumConxLines, LineBuf, CurQPtr );
+							DumpCurrentLineBuffer( ValidateObjectandParseStartLine, cStartLine, cStartName, NumLines, ValidateObjectandParseNumConxLines, ValidateObjectandParseLineBuf, ValidateObjectandParseCurQPtr );
 							ShowWarningError( "IP: IDF line~" + IPTrimSigDigits( NumLines ) + " Comma being inserted after:\"" + InputLine.substr( CurPos, InputLineLength - CurPos - 1 ) + "\" in Object=" + SqueezedObject, EchoInputFile );
 						} else {
 							Pos = InputLineLength - CurPos + 1;
-							DumpCurrentLineBuffer( StartLine, cStartLine, cStartName, NumLines, NumConxLines, LineBuf, CurQPtr );
+							DumpCurrentLineBuffer( ValidateObjectandParseStartLine, cStartLine, cStartName, NumLines, ValidateObjectandParseNumConxLines, ValidateObjectandParseLineBuf, ValidateObjectandParseCurQPtr );
 							ShowWarningError( "IP: IDF line~" + IPTrimSigDigits( NumLines ) + " Comma being inserted after:\"" + InputLine.substr( CurPos, InputLineLength - CurPos ) + "\" in Object=" + SqueezedObject, EchoInputFile );
 						}
 					}
@@ -1683,7 +1751,7 @@ namespace InputProcessor {
 					if ( Pos > 0 ) {
 						SqueezedArg = MakeUPPERCase( stripped( InputLine.substr( CurPos, Pos ) ) );
 						if ( len( stripped( InputLine.substr( CurPos, Pos ) ) ) > static_cast< std::string::size_type >( MaxAlphaArgLength ) ) {
-							DumpCurrentLineBuffer( StartLine, cStartLine, cStartName, NumLines, NumConxLines, LineBuf, CurQPtr );
+							DumpCurrentLineBuffer( ValidateObjectandParseStartLine, cStartLine, cStartName, NumLines, ValidateObjectandParseNumConxLines, ValidateObjectandParseLineBuf, ValidateObjectandParseCurQPtr );
 							ShowWarningError( "IP: IDF line~" + IPTrimSigDigits( NumLines ) + " Alpha Argument length exceeds maximum, will be truncated=" + InputLine.substr( CurPos, Pos - 1 ), EchoInputFile );
 							ShowContinueError( "Will be processed as Alpha=" + SqueezedArg, EchoInputFile );
 						}
@@ -1691,7 +1759,7 @@ namespace InputProcessor {
 						SqueezedArg = BlankString;
 					}
 					if ( NumArg == NumArgExpected && ! ObjectDef( Found ).ExtensibleObject ) {
-						DumpCurrentLineBuffer( StartLine, cStartLine, cStartName, NumLines, NumConxLines, LineBuf, CurQPtr );
+						DumpCurrentLineBuffer( ValidateObjectandParseStartLine, cStartLine, cStartName, NumLines, ValidateObjectandParseNumConxLines, ValidateObjectandParseLineBuf, ValidateObjectandParseCurQPtr );
 						ShowSevereError( "IP: IDF line~" + IPTrimSigDigits( NumLines ) + " Error detected for Object=" + ObjectDef( Found ).Name, EchoInputFile );
 						ShowContinueError( " Maximum arguments reached for this object, trying to process ->" + SqueezedArg + "<-", EchoInputFile );
 						errFlag = true;
@@ -1702,7 +1770,7 @@ namespace InputProcessor {
 						++NumArg;
 						if ( ObjectDef( Found ).AlphaOrNumeric( NumArg ) ) {
 							if ( NumAlpha == ObjectDef( Found ).NumAlpha ) {
-								DumpCurrentLineBuffer( StartLine, cStartLine, cStartName, NumLines, NumConxLines, LineBuf, CurQPtr );
+								DumpCurrentLineBuffer( ValidateObjectandParseStartLine, cStartLine, cStartName, NumLines, ValidateObjectandParseNumConxLines, ValidateObjectandParseLineBuf, ValidateObjectandParseCurQPtr );
 								ShowSevereError( "IP: IDF line~" + IPTrimSigDigits( NumLines ) + " Error detected for Object=" + ObjectDef( Found ).Name, EchoInputFile );
 								ShowContinueError( " Too many Alphas for this object, trying to process ->" + SqueezedArg + "<-", EchoInputFile );
 								errFlag = true;
@@ -1720,10 +1788,10 @@ namespace InputProcessor {
 										LineItem.Alphas( NumAlpha ) = ObjectDef( Found ).AlphFieldDefs( NumAlpha );
 									} else {
 										if ( ObjectDef( Found ).NameAlpha1 && NumAlpha != 1 ) {
-											DumpCurrentLineBuffer( StartLine, cStartLine, cStartName, NumLines, NumConxLines, LineBuf, CurQPtr );
+											DumpCurrentLineBuffer( ValidateObjectandParseStartLine, cStartLine, cStartName, NumLines, ValidateObjectandParseNumConxLines, ValidateObjectandParseLineBuf, ValidateObjectandParseCurQPtr );
 											ShowSevereError( "IP: IDF line~" + IPTrimSigDigits( NumLines ) + " Error detected in Object=" + ObjectDef( Found ).Name + ", name=" + LineItem.Alphas( 1 ), EchoInputFile );
 										} else {
-											DumpCurrentLineBuffer( StartLine, cStartLine, cStartName, NumLines, NumConxLines, LineBuf, CurQPtr );
+											DumpCurrentLineBuffer( ValidateObjectandParseStartLine, cStartLine, cStartName, NumLines, ValidateObjectandParseNumConxLines, ValidateObjectandParseLineBuf, ValidateObjectandParseCurQPtr );
 											ShowSevereError( "IP: IDF line~" + IPTrimSigDigits( NumLines ) + " Error detected in Object=" + ObjectDef( Found ).Name, EchoInputFile );
 										}
 										ShowContinueError( "Field [" + ObjectDef( Found ).AlphFieldChks( NumAlpha ) + "] is required but was blank", EchoInputFile );
@@ -1738,7 +1806,7 @@ namespace InputProcessor {
 							}
 						} else {
 							if ( NumNumeric == ObjectDef( Found ).NumNumeric ) {
-								DumpCurrentLineBuffer( StartLine, cStartLine, cStartName, NumLines, NumConxLines, LineBuf, CurQPtr );
+								DumpCurrentLineBuffer( ValidateObjectandParseStartLine, cStartLine, cStartName, NumLines, ValidateObjectandParseNumConxLines, ValidateObjectandParseLineBuf, ValidateObjectandParseCurQPtr );
 								ShowSevereError( "IP: IDF line~" + IPTrimSigDigits( NumLines ) + " Error detected for Object=" + ObjectDef( Found ).Name, EchoInputFile );
 								ShowContinueError( " Too many Numbers for this object, trying to process ->" + SqueezedArg + "<-", EchoInputFile );
 								errFlag = true;
@@ -1771,11 +1839,11 @@ namespace InputProcessor {
 									} else { // blank arg does not have default
 										if ( ObjectDef( Found ).ReqField( NumArg ) ) { // arg is required
 											if ( ObjectDef( Found ).NameAlpha1 ) { // object has name field - more context for error
-												DumpCurrentLineBuffer( StartLine, cStartLine, cStartName, NumLines, NumConxLines, LineBuf, CurQPtr );
+												DumpCurrentLineBuffer( ValidateObjectandParseStartLine, cStartLine, cStartName, NumLines, ValidateObjectandParseNumConxLines, ValidateObjectandParseLineBuf, ValidateObjectandParseCurQPtr );
 												ShowSevereError( "IP: IDF line~" + IPTrimSigDigits( NumLines ) + " Error detected in Object=" + ObjectDef( Found ).Name + ", name=" + LineItem.Alphas( 1 ), EchoInputFile );
 												errFlag = true;
 											} else { // object does not have name field
-												DumpCurrentLineBuffer( StartLine, cStartLine, cStartName, NumLines, NumConxLines, LineBuf, CurQPtr );
+												DumpCurrentLineBuffer( ValidateObjectandParseStartLine, cStartLine, cStartName, NumLines, ValidateObjectandParseNumConxLines, ValidateObjectandParseLineBuf, ValidateObjectandParseCurQPtr );
 												ShowSevereError( "IP: IDF line~" + IPTrimSigDigits( NumLines ) + " Error detected in Object=" + ObjectDef( Found ).Name, EchoInputFile );
 												errFlag = true;
 											}
@@ -1799,7 +1867,7 @@ namespace InputProcessor {
 										if ( ObjectDef( Found ).NameAlpha1 ) {
 											Message += "=" + LineItem.Alphas( 1 );
 										}
-										DumpCurrentLineBuffer( StartLine, cStartLine, cStartName, NumLines, NumConxLines, LineBuf, CurQPtr );
+										DumpCurrentLineBuffer( ValidateObjectandParseStartLine, cStartLine, cStartName, NumLines, ValidateObjectandParseNumConxLines, ValidateObjectandParseLineBuf, ValidateObjectandParseCurQPtr );
 										ShowSevereError( "IP: IDF line~" + IPTrimSigDigits( NumLines ) + ' ' + Message, EchoInputFile );
 									} else { // parametric in Numeric field
 										errFlag = false;
@@ -1816,7 +1884,7 @@ namespace InputProcessor {
 					if ( not_blank( InputLine.substr( CurPos + Pos + 1 ) ) ) {
 						NextChr = FindNonSpace( InputLine.substr( CurPos + Pos + 1 ) );
 						if ( ( NextChr == std::string::npos ) || ( InputLine[ CurPos + Pos + 1 + NextChr ] != '!' ) ) {
-							DumpCurrentLineBuffer( StartLine, cStartLine, cStartName, NumLines, NumConxLines, LineBuf, CurQPtr );
+							DumpCurrentLineBuffer( ValidateObjectandParseStartLine, cStartLine, cStartName, NumLines, ValidateObjectandParseNumConxLines, ValidateObjectandParseLineBuf, ValidateObjectandParseCurQPtr );
 							ShowWarningError( "IP: IDF line~" + IPTrimSigDigits( NumLines ) + " End of Object=\"" + ObjectDef( Found ).Name + "\" reached, but next part of line not comment.", EchoInputFile );
 							ShowContinueError( "Final line above shows line that contains error." );
 						}
@@ -3177,7 +3245,6 @@ namespace InputProcessor {
 		int Count;
 		//  LOGICAL :: MaxArgsChanged
 		std::string charout;
-		static std::string CurObject;
 
 		gio::write( EchoInputFile, fmtA ) << "Attempting to auto-extend object=" + ObjectDef( ObjectNum ).Name;
 		if ( CurObject != ObjectDef( ObjectNum ).Name ) {
@@ -152,6 +152,7 @@ namespace InputProcessor {
 	extern std::string CurrentFieldName; // Current Field Name (IDD)
 	extern Array1D_string ObsoleteObjectsRepNames; // Array of Replacement names for Obsolete objects
 	extern std::string ReplacementName;
+	extern std::string PreloadedIddFileName; // Data dictionary already processed by PreloadDataDictionary (blank if none)
 
 	//Logical Variables for Module
 	extern bool OverallErrorFlag; // If errors found during parse of IDF, will fatal at end
@@ -347,6 +348,12 @@ namespace InputProcessor {
 	void
 	ProcessInput();
 
+	void
+	PreloadDataDictionary(
+		std::string const & IddFileName, // Data dictionary to process
+		bool & ErrorsFound // set to true if the file could not be read or any errors flagged during IDD processing
+	);
+
 	void
 	ProcessDataDicFile(
 		std::istream & idd_stream,
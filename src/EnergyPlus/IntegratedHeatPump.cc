@@ -98,9 +98,19 @@ namespace EnergyPlus {
 		// Object Data
 		Array1D< IntegratedHeatPumpData > IntegratedHeatPumps;
 
+		namespace {
+		// These were static variables within different functions. They were pulled out into the namespace
+		// to facilitate easier unit testing of those functions.
+		// These are purposefully not in the header file as an extern variable. No one outside of this module should
+		// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+		// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+			bool SizeIHPErrorsFound( false ); // If errors detected in input
+		}
+
 		void
 		clear_state() {
 			IntegratedHeatPumps.deallocate();
+			SizeIHPErrorsFound = false;
 		}
 
 
@@ -1118,7 +1128,6 @@ namespace EnergyPlus {
 			using DataSizing::AutoSize;
 			using General::TrimSigDigits;
 
-			static bool ErrorsFound( false ); // If errors detected in input
 			Real64 RatedCapacity( 0.0 ); //rated building cooling load
 
 			// Obtains and Allocates AS-IHP related parameters from input file
@@ -1136,30 +1145,30 @@ namespace EnergyPlus {
 			if ( IntegratedHeatPumps( DXCoilNum ).IHPCoilsSized ) { return; }
 
 			//associate SC coil with SH coil
-			SetVarSpeedCoilData( IntegratedHeatPumps( DXCoilNum ).SCCoilIndex, ErrorsFound, _,
+			SetVarSpeedCoilData( IntegratedHeatPumps( DXCoilNum ).SCCoilIndex, SizeIHPErrorsFound, _,
 			                     IntegratedHeatPumps( DXCoilNum ).SHCoilIndex );
-			if ( ErrorsFound ) {
+			if ( SizeIHPErrorsFound ) {
 				ShowSevereError(
 					"SizeIHP: Could not match cooling coil\"" + IntegratedHeatPumps( DXCoilNum ).SCCoilName +
 					"\" with heating coil=\"" + IntegratedHeatPumps( DXCoilNum ).SHCoilName + "\"" );
-				ErrorsFound = false;
+				SizeIHPErrorsFound = false;
 			};
 
 			SizeVarSpeedCoil( IntegratedHeatPumps( DXCoilNum ).SCCoilIndex );//size cooling coil
-			if ( ErrorsFound ) {
+			if ( SizeIHPErrorsFound ) {
 				ShowFatalError(
 					"SizeIHP: failed to size SC coil\"" + IntegratedHeatPumps( DXCoilNum ).SCCoilName + "\"" );
-				ErrorsFound = false;
+				SizeIHPErrorsFound = false;
 			}
 			else {
 				RatedCapacity = VarSpeedCoil( IntegratedHeatPumps( DXCoilNum ).SCCoilIndex ).RatedCapCoolTotal;
 			};
 
 			SizeVarSpeedCoil( IntegratedHeatPumps( DXCoilNum ).SHCoilIndex );//size heating coil
-			if ( ErrorsFound ) {
+			if ( SizeIHPErrorsFound ) {
 				ShowSevereError(
 					"SizeIHP: failed to size SH coil\"" + IntegratedHeatPumps( DXCoilNum ).SHCoilName + "\"" );
-				ErrorsFound = false;
+				SizeIHPErrorsFound = false;
 			};
 
 			//pass SC coil capacity to SCDWH cool coil
@@ -1168,27 +1177,27 @@ namespace EnergyPlus {
 			};
 
 			//associate SCDWH air coil to SHDWH air coil
-			SetVarSpeedCoilData( IntegratedHeatPumps( DXCoilNum ).SCDWHCoolCoilIndex, ErrorsFound, _,
+			SetVarSpeedCoilData( IntegratedHeatPumps( DXCoilNum ).SCDWHCoolCoilIndex, SizeIHPErrorsFound, _,
 			                     IntegratedHeatPumps( DXCoilNum ).SHDWHHeatCoilIndex );
 
 			//size SCDWH air coil
 			SizeVarSpeedCoil( IntegratedHeatPumps( DXCoilNum ).SCDWHCoolCoilIndex );
-			if ( ErrorsFound ) {
+			if ( SizeIHPErrorsFound ) {
 				ShowSevereError(
 					"SizeIHP: failed to size SCDWH cooling coil\"" +
 					IntegratedHeatPumps( DXCoilNum ).SCDWHCoolCoilName +
 					"\"" );
-				ErrorsFound = false;
+				SizeIHPErrorsFound = false;
 			};
 
 			//size SHDWH air coil
 			SizeVarSpeedCoil( IntegratedHeatPumps( DXCoilNum ).SHDWHHeatCoilIndex );
-			if ( ErrorsFound ) {
+			if ( SizeIHPErrorsFound ) {
 				ShowSevereError(
 					"SizeIHP: failed to size SHDWH heating coil\"" +
 					IntegratedHeatPumps( DXCoilNum ).SHDWHHeatCoilName +
 					"\"" );
-				ErrorsFound = false;
+				SizeIHPErrorsFound = false;
 			};
 
 
@@ -1201,10 +1210,10 @@ namespace EnergyPlus {
 			}
 
 			SizeVarSpeedCoil( IntegratedHeatPumps( DXCoilNum ).SCWHCoilIndex );
-			if ( ErrorsFound ) {
+			if ( SizeIHPErrorsFound ) {
 				ShowSevereError(
 					"SizeIHP: failed to size SCWH coil\"" + IntegratedHeatPumps( DXCoilNum ).SCWHCoilName + "\"" );
-				ErrorsFound = false;
+				SizeIHPErrorsFound = false;
 			};
 
 			//size DWH water coil
@@ -1213,10 +1222,10 @@ namespace EnergyPlus {
 			}
 
 			SizeVarSpeedCoil( IntegratedHeatPumps( DXCoilNum ).DWHCoilIndex );
-			if ( ErrorsFound ) {
+			if ( SizeIHPErrorsFound ) {
 				ShowSevereError(
 					"SizeIHP: failed to size DWH coil\"" + IntegratedHeatPumps( DXCoilNum ).DWHCoilName + "\"" );
-				ErrorsFound = false;
+				SizeIHPErrorsFound = false;
 			};
 
 			//size SCDWH water coil
@@ -1225,10 +1234,10 @@ namespace EnergyPlus {
 			}
 
 			SizeVarSpeedCoil( IntegratedHeatPumps( DXCoilNum ).SCDWHWHCoilIndex );
-			if ( ErrorsFound ) {
+			if ( SizeIHPErrorsFound ) {
 				ShowSevereError( "SizeIHP: failed to size SCDWH water heating coil\"" +
 				                 IntegratedHeatPumps( DXCoilNum ).SCDWHWHCoilName + "\"" );
-				ErrorsFound = false;
+				SizeIHPErrorsFound = false;
 			};
 
 
@@ -1239,10 +1248,10 @@ namespace EnergyPlus {
 
 			SizeVarSpeedCoil( IntegratedHeatPumps( DXCoilNum ).SHDWHWHCoilIndex );
 
-			if ( ErrorsFound ) {
+			if ( SizeIHPErrorsFound ) {
 				ShowSevereError( "SizeIHP: failed to size SHDWH water heating coil\"" +
 				                 IntegratedHeatPumps( DXCoilNum ).SHDWHWHCoilName + "\"" );
-				ErrorsFound = false;
+				SizeIHPErrorsFound = false;
 			};
 
 			IntegratedHeatPumps( DXCoilNum ).IHPCoilsSized = true;
@@ -242,6 +242,30 @@ namespace LowTempRadiantSystem {
 	Array1D< ElecRadSysNumericFieldData > ElecRadSysNumericFields;
 	Array1D< HydronicRadiantSysNumericFieldData > HydronicRadiantSysNumericFields;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // First time, input is "gotten"
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		Array1D_bool MyEnvrnFlagHydr;
+		Array1D_bool MyEnvrnFlagCFlo;
+		Array1D_bool MyEnvrnFlagElec;
+		bool MyEnvrnFlagGeneral( true );
+		bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
+		bool MyOneTimeFlag( true ); // Initialization flag
+		Array1D_bool MyPlantScanFlagHydr;
+		Array1D_bool MyPlantScanFlagCFlo;
+		Array1D< Real64 > Ckj; // Coefficients for individual surfaces within a radiant system
+		Array1D< Real64 > Cmj;
+		Array1D< Real64 > WaterTempOut; // Array of outlet water temperatures for
+		bool FirstTimeFlag( true ); // for setting size of Ckj, Cmj, WaterTempOut arrays
+		bool WarnTooLow( false );
+		bool WarnTooHigh( false );
+	}
+
 	// Functions
 
 	void
@@ -274,6 +298,22 @@ namespace LowTempRadiantSystem {
 		RadSysTypes.deallocate();
 		ElecRadSysNumericFields.deallocate();
 		HydronicRadiantSysNumericFields.deallocate();
+		GetInputFlag = true;
+		ErrorsFound = false;
+		MyEnvrnFlagHydr.deallocate();
+		MyEnvrnFlagCFlo.deallocate();
+		MyEnvrnFlagElec.deallocate();
+		MyEnvrnFlagGeneral = true;
+		ZoneEquipmentListChecked = false;
+		MyOneTimeFlag = true;
+		MyPlantScanFlagHydr.deallocate();
+		MyPlantScanFlagCFlo.deallocate();
+		Ckj.deallocate();
+		Cmj.deallocate();
+		WaterTempOut.deallocate();
+		FirstTimeFlag = true;
+		WarnTooLow = false;
+		WarnTooHigh = false;
 	}
 
 	void
@@ -317,7 +357,6 @@ namespace LowTempRadiantSystem {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInputFlag( true ); // First time, input is "gotten"
 		int RadSysNum; // Radiant system number/index in local derived types
 		int SystemType; // Type of radiant system: hydronic, constant flow, or electric
 		bool InitErrorFound( false );
@@ -481,7 +520,6 @@ namespace LowTempRadiantSystem {
 		Array1D_string cNumericFields; // Numeric field names
 		Array1D_bool AssignedAsRadiantSurface; // Set to true when a surface is part of a radiant system
 		int CheckSurfNum; // Surface number to check to see if it has already been used by a radiant system
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		int GlycolIndex; // Index of 'Water' in glycol data structure
 		int IOStatus; // Used in GetObjectItem
 		int Item; // Item to be "gotten"
@@ -1562,15 +1600,7 @@ namespace LowTempRadiantSystem {
 		int SurfNum; // Intermediate variable for keeping track of the surface number
 		Real64 TotalEffic; // Intermediate calculation variable for total pump efficiency
 		int ZoneNum; // Intermediate variable for keeping track of the zone number
-		static Array1D_bool MyEnvrnFlagHydr;
-		static Array1D_bool MyEnvrnFlagCFlo;
-		static Array1D_bool MyEnvrnFlagElec;
-		static bool MyEnvrnFlagGeneral( true );
-		static bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
 		int Loop;
-		static bool MyOneTimeFlag( true ); // Initialization flag
-		static Array1D_bool MyPlantScanFlagHydr;
-		static Array1D_bool MyPlantScanFlagCFlo;
 		Real64 mdot; // local fluid mass flow rate
 		Real64 rho; // local fluid density
 		bool errFlag;
@@ -3849,12 +3879,8 @@ namespace LowTempRadiantSystem {
 		Real64 Cl;
 		// For more info on Ca through Cl, see comments below
 
-		static Array1D< Real64 > Ckj; // Coefficients for individual surfaces within a radiant system
-		static Array1D< Real64 > Cmj;
-		static Array1D< Real64 > WaterTempOut; // Array of outlet water temperatures for
 		// each surface in the radiant system
 
-		static bool FirstTimeFlag( true ); // for setting size of Ckj, Cmj, WaterTempOut arrays
 
 		// FLOW:
 		// First, apply heat exchanger logic to find the heat source/sink to the system.
@@ -4645,8 +4671,6 @@ namespace LowTempRadiantSystem {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool WarnTooLow( false );
-		static bool WarnTooHigh( false );
 
 		WarnTooLow = false;
 		WarnTooHigh = false;
@@ -125,8 +125,29 @@ namespace MatrixDataManager {
 	// Object Data
 	Array1D< MatrixDataStruct > MatData;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool GetInputFlag( true ); // First time, input is "gotten"
+	}
+
 	// Functions
 
+	// Clears the global data in MatrixDataManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumMats = 0;
+		MatData.deallocate();
+		ErrorsFound = false;
+		GetInputFlag = true;
+	}
+
 	void
 	GetMatrixInput()
 	{
@@ -172,7 +193,6 @@ namespace MatrixDataManager {
 		int NumAlphas; // Number of Alphas for each GetObjectItem call
 		int NumNumbers; // Number of Numbers for each GetObjectItem call
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int NumRows;
@@ -270,7 +290,6 @@ namespace MatrixDataManager {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static bool GetInputFlag( true ); // First time, input is "gotten"
 
 		if ( GetInputFlag ) {
 			GetMatrixInput();
@@ -120,6 +120,11 @@ namespace MatrixDataManager {
 
 	// Functions
 
+	// Clears the global data in MatrixDataManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	GetMatrixInput();
 
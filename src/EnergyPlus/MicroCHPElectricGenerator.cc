@@ -152,8 +152,100 @@ namespace MicroCHPElectricGenerator {
 	// Beginning of Combustion Generator Module Driver Subroutines
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false ); // error flag
+		bool MyOneTimeFlag( true );
+		int DynaCntrlNum( 0 );
+		bool InitMicroCHPNoNormalizeGeneratorsMyOneTimeFlag( true ); // Initialization flag
+		Array1D_bool MyEnvrnFlag; // Used for initializations each begin environment flag
+		Array1D_bool MyPlantScanFlag;
+		Real64 AllowedLoad( 0.0 );
+		int CurrentOpMode( 0 );
+		Real64 PLRforSubtimestepStartUp( 1.0 );
+		Real64 PLRforSubtimestepShutDown( 0.0 );
+		bool CalcMicroCHPNoNormalizeGeneratorModelRunFlag( false );
+		int CalcMicroCHPNoNormalizeGeneratorModelDynaCntrlNum( 0 );
+		Real64 Pnetss( 0.0 );
+		Real64 Pstandby( 0.0 ); // power draw during standby, positive here means negative production
+		Real64 Pcooler( 0.0 ); // power draw during cool down, positive here means negative production
+		Real64 NdotFuel( 0.0 );
+		bool ConstrainedIncreasingNdot( false );
+		bool ConstrainedDecreasingNdot( false );
+		int i( 0 );
+		Real64 dt( 0.0 );
+		Real64 ElecEff( 0.0 );
+		Real64 MdotAir( 0.0 );
+		Real64 CalcMicroCHPNoNormalizeGeneratorModelQgenss( 0.0 );
+		Real64 MdotCW( 0.0 );
+		Real64 CalcMicroCHPNoNormalizeGeneratorModelTcwIn( 0.0 );
+		Real64 CalcMicroCHPNoNormalizeGeneratorModelTcwOut( 0.0 );
+		Real64 MdotFuel( 0.0 );
+		Real64 MdotFuelAllowed( 0.0 );
+		Real64 MdotFuelMax( 0.0 );
+		Real64 MdotFuelWarmup( 0.0 );
+		Real64 Pmax( 0.0 );
+		Real64 Qgross( 0.0 );
+		Real64 CalcMicroCHPNoNormalizeGeneratorModelTeng( 0.0 );
+		Real64 ThermEff( 0.0 );
+		Real64 Cp( 0.0 ); // local fluid specific heat
+		Real64 thisAmbientTemp( 0.0 );
+		bool FigureMicroCHPZoneGainsMyEnvrnFlag( true );
+	}
+
 	// Functions
 
+	// Clears the global data in MicroCHPElectricGenerator.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		GetMicroCHPInput = true;
+		CheckEquipName.deallocate();
+		MySizeFlag.deallocate();
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		DynaCntrlNum = 0;
+		InitMicroCHPNoNormalizeGeneratorsMyOneTimeFlag = true;
+		MyEnvrnFlag.deallocate();
+		MyPlantScanFlag.deallocate();
+		AllowedLoad = 0.0;
+		CurrentOpMode = 0;
+		PLRforSubtimestepStartUp = 1.0;
+		PLRforSubtimestepShutDown = 0.0;
+		CalcMicroCHPNoNormalizeGeneratorModelRunFlag = false;
+		CalcMicroCHPNoNormalizeGeneratorModelDynaCntrlNum = 0;
+		Pnetss = 0.0;
+		Pstandby = 0.0;
+		Pcooler = 0.0;
+		NdotFuel = 0.0;
+		ConstrainedIncreasingNdot = false;
+		ConstrainedDecreasingNdot = false;
+		i = 0;
+		dt = 0.0;
+		ElecEff = 0.0;
+		MdotAir = 0.0;
+		CalcMicroCHPNoNormalizeGeneratorModelQgenss = 0.0;
+		MdotCW = 0.0;
+		CalcMicroCHPNoNormalizeGeneratorModelTcwIn = 0.0;
+		CalcMicroCHPNoNormalizeGeneratorModelTcwOut = 0.0;
+		MdotFuel = 0.0;
+		MdotFuelAllowed = 0.0;
+		MdotFuelMax = 0.0;
+		MdotFuelWarmup = 0.0;
+		Pmax = 0.0;
+		Qgross = 0.0;
+		CalcMicroCHPNoNormalizeGeneratorModelTeng = 0.0;
+		ThermEff = 0.0;
+		Cp = 0.0;
+		thisAmbientTemp = 0.0;
+		FigureMicroCHPZoneGainsMyEnvrnFlag = true;
+	}
+
 	void
 	SimMicroCHPGenerator(
 		int const EP_UNUSED( GeneratorType ), // type of Generator
@@ -288,13 +380,11 @@ namespace MicroCHPElectricGenerator {
 		int IOStat; // IO Status when calling get input subroutine
 		Array1D_string AlphArray( 25 ); // character string data
 		Array1D< Real64 > NumArray( 200 ); // numeric data TODO deal with allocatable for extensible
-		static bool ErrorsFound( false ); // error flag
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		//  INTEGER       :: thisMicroCHP  !temporary index
 		//  INTEGER       :: otherMicroCHP !loop counter and temporary indexer
 		//  INTEGER       :: I   ! loop counter
-		static bool MyOneTimeFlag( true );
 		int CHPParamNum; // loop count and temporary index
 		std::string ObjMSGName; // string for error messages
 		int thisParamID;
@@ -612,24 +702,20 @@ namespace MicroCHPElectricGenerator {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int DynaCntrlNum( 0 );
 		Real64 TimeElapsed; // Fraction of the current hour that has elapsed (h)
-		static bool MyOneTimeFlag( true ); // Initialization flag
-		static Array1D_bool MyEnvrnFlag; // Used for initializations each begin environment flag
-		static Array1D_bool MyPlantScanFlag;
 
 		bool errFlag;
 		Real64 mdot; // local temporary for mass flow rate
 		Real64 rho; // local temporary for fluid density
 
-		if ( MyOneTimeFlag ) {
+		if ( InitMicroCHPNoNormalizeGeneratorsMyOneTimeFlag ) {
 			MyEnvrnFlag.allocate( NumMicroCHPs );
 			MyPlantScanFlag.allocate( NumMicroCHPs );
 			MySizeFlag.allocate( NumMicroCHPs );
 			MyEnvrnFlag = true;
 			MyPlantScanFlag = true;
 			MySizeFlag = true;
-			MyOneTimeFlag = false;
+			InitMicroCHPNoNormalizeGeneratorsMyOneTimeFlag = false;
 		}
 
 		if ( MyPlantScanFlag( GeneratorNum ) && allocated( PlantLoop ) ) {
@@ -806,49 +892,19 @@ namespace MicroCHPElectricGenerator {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 AllowedLoad( 0.0 );
-		static int CurrentOpMode( 0 );
-		static Real64 PLRforSubtimestepStartUp( 1.0 );
-		static Real64 PLRforSubtimestepShutDown( 0.0 );
-		static bool RunFlag( false );
-		static int DynaCntrlNum( 0 );
-		static Real64 Pnetss( 0.0 );
-		static Real64 Pstandby( 0.0 ); // power draw during standby, positive here means negative production
-		static Real64 Pcooler( 0.0 ); // power draw during cool down, positive here means negative production
 		//  REAL(r64)    :: Pnet   = 0.0d0
-		static Real64 NdotFuel( 0.0 );
-
-		static bool ConstrainedIncreasingNdot( false );
-		static bool ConstrainedDecreasingNdot( false );
-		static int i( 0 );
-		static Real64 dt( 0.0 );
-		static Real64 ElecEff( 0.0 );
-		static Real64 MdotAir( 0.0 );
-		static Real64 Qgenss( 0.0 );
-		static Real64 MdotCW( 0.0 );
-		static Real64 TcwIn( 0.0 );
-		static Real64 TcwOut( 0.0 );
-		static Real64 MdotFuel( 0.0 );
-		static Real64 MdotFuelAllowed( 0.0 );
-		static Real64 MdotFuelMax( 0.0 );
-		static Real64 MdotFuelWarmup( 0.0 );
-		static Real64 Pmax( 0.0 );
-		static Real64 Qgross( 0.0 );
-		static Real64 Teng( 0.0 );
-		static Real64 ThermEff( 0.0 );
-		static Real64 Cp( 0.0 ); // local fluid specific heat
-		static Real64 thisAmbientTemp( 0.0 );
+
 
 		bool EnergyBalOK; // check for balance to exit loop
 
-		DynaCntrlNum = MicroCHP( GeneratorNum ).DynamicsControlID;
+		CalcMicroCHPNoNormalizeGeneratorModelDynaCntrlNum = MicroCHP( GeneratorNum ).DynamicsControlID;
 
 		ManageGeneratorControlState( iGeneratorMicroCHP, MicroCHP( GeneratorNum ).Name, GeneratorNum, RunFlagElectCenter, RunFlagPlant, MyElectricLoad, MyThermalLoad, AllowedLoad, CurrentOpMode, PLRforSubtimestepStartUp, PLRforSubtimestepShutDown, FirstHVACIteration );
 
-		if ( RunFlagElectCenter || RunFlagPlant ) RunFlag = true;
+		if ( RunFlagElectCenter || RunFlagPlant ) CalcMicroCHPNoNormalizeGeneratorModelRunFlag = true;
 
-		Teng = MicroCHP( GeneratorNum ).A42Model.Teng;
-		TcwOut = MicroCHP( GeneratorNum ).A42Model.TcwOut;
+		CalcMicroCHPNoNormalizeGeneratorModelTeng = MicroCHP( GeneratorNum ).A42Model.Teng;
+		CalcMicroCHPNoNormalizeGeneratorModelTcwOut = MicroCHP( GeneratorNum ).A42Model.TcwOut;
 		dt = TimeStepSys * SecInHour;
 
 		if ( MicroCHP( GeneratorNum ).ZoneID > 0 ) {
@@ -861,9 +917,9 @@ namespace MicroCHPElectricGenerator {
 
 		if ( SELECT_CASE_var == OpModeOff ) { // same as standby in model spec but no Pnet standby electicity losses.
 
-			Qgenss = 0.0;
+			CalcMicroCHPNoNormalizeGeneratorModelQgenss = 0.0;
 			MdotCW = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).MassFlowRate; //kg/s
-			TcwIn = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).Temp; //C
+			CalcMicroCHPNoNormalizeGeneratorModelTcwIn = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).Temp; //C
 			Pnetss = 0.0;
 			Pstandby = 0.0;
 			Pcooler = MicroCHP( GeneratorNum ).A42Model.PcoolDown * PLRforSubtimestepShutDown;
@@ -879,9 +935,9 @@ namespace MicroCHPElectricGenerator {
 			MicroCHP( GeneratorNum ).PlantMassFlowRate = MdotCW;
 
 		} else if ( SELECT_CASE_var == OpModeStandby ) {
-			Qgenss = 0.0;
+			CalcMicroCHPNoNormalizeGeneratorModelQgenss = 0.0;
 			MdotCW = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).MassFlowRate; //kg/s
-			TcwIn = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).Temp; //C
+			CalcMicroCHPNoNormalizeGeneratorModelTcwIn = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).Temp; //C
 			Pnetss = 0.0;
 			Pstandby = MicroCHP( GeneratorNum ).A42Model.Pstandby * ( 1.0 - PLRforSubtimestepShutDown );
 			Pcooler = MicroCHP( GeneratorNum ).A42Model.PcoolDown * PLRforSubtimestepShutDown;
@@ -903,12 +959,12 @@ namespace MicroCHPElectricGenerator {
 				Pnetss = MyElectricLoad; // W
 				Pstandby = 0.0;
 				Pcooler = MicroCHP( GeneratorNum ).A42Model.PcoolDown * PLRforSubtimestepShutDown;
-				TcwIn = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).Temp; //C
+				CalcMicroCHPNoNormalizeGeneratorModelTcwIn = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).Temp; //C
 				MdotCW = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).MassFlowRate; //kg/s
 				if ( MicroCHP( GeneratorNum ).A42Model.InternalFlowControl ) {
-					MdotCW = FuncDetermineCWMdotForInternalFlowControl( GeneratorNum, Pnetss, TcwIn );
+					MdotCW = FuncDetermineCWMdotForInternalFlowControl( GeneratorNum, Pnetss, CalcMicroCHPNoNormalizeGeneratorModelTcwIn );
 				}
-				ElecEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ElecEffCurveID, Pnetss, MdotCW, TcwIn );
+				ElecEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ElecEffCurveID, Pnetss, MdotCW, CalcMicroCHPNoNormalizeGeneratorModelTcwIn );
 				ElecEff = max( 0.0, ElecEff ); //protect against bad curve result
 
 				if ( ElecEff > 0.0 ) { // trap divide by bad thing
@@ -916,15 +972,15 @@ namespace MicroCHPElectricGenerator {
 				} else {
 					Qgross = 0.0;
 				}
-				ThermEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ThermalEffCurveID, Pnetss, MdotCW, TcwIn );
+				ThermEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ThermalEffCurveID, Pnetss, MdotCW, CalcMicroCHPNoNormalizeGeneratorModelTcwIn );
 				ThermEff = max( 0.0, ThermEff ); //protect against bad curve result
 
-				Qgenss = ThermEff * Qgross; //W
+				CalcMicroCHPNoNormalizeGeneratorModelQgenss = ThermEff * Qgross; //W
 
 				MdotFuel = Qgross / ( FuelSupply( MicroCHP( GeneratorNum ).FuelSupplyID ).LHV * 1000.0 * 1000.0 ) * FuelSupply( MicroCHP( GeneratorNum ).FuelSupplyID ).KmolPerSecToKgPerSec;
 				//  kMol/s = (J/s) /(KJ/mol * 1000 J/KJ * 1000 mol/kmol)
 
-				ManageGeneratorFuelFlow( iGeneratorMicroCHP, MicroCHP( GeneratorNum ).Name, GeneratorNum, RunFlag, MdotFuel, MdotFuelAllowed, ConstrainedIncreasingNdot, ConstrainedDecreasingNdot );
+				ManageGeneratorFuelFlow( iGeneratorMicroCHP, MicroCHP( GeneratorNum ).Name, GeneratorNum, CalcMicroCHPNoNormalizeGeneratorModelRunFlag, MdotFuel, MdotFuelAllowed, ConstrainedIncreasingNdot, ConstrainedDecreasingNdot );
 
 				if ( ConstrainedIncreasingNdot || ConstrainedDecreasingNdot ) { // recalculate Pnetss with new NdotFuel with iteration
 					MdotFuel = MdotFuelAllowed;
@@ -934,15 +990,15 @@ namespace MicroCHPElectricGenerator {
 					for ( i = 1; i <= 20; ++i ) { // iterating here  could add use of seach method
 						Pnetss = Qgross * ElecEff;
 						if ( MicroCHP( GeneratorNum ).A42Model.InternalFlowControl ) {
-							MdotCW = FuncDetermineCWMdotForInternalFlowControl( GeneratorNum, Pnetss, TcwIn );
+							MdotCW = FuncDetermineCWMdotForInternalFlowControl( GeneratorNum, Pnetss, CalcMicroCHPNoNormalizeGeneratorModelTcwIn );
 						}
-						ElecEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ElecEffCurveID, Pnetss, MdotCW, TcwIn );
+						ElecEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ElecEffCurveID, Pnetss, MdotCW, CalcMicroCHPNoNormalizeGeneratorModelTcwIn );
 						ElecEff = max( 0.0, ElecEff ); //protect against bad curve result
 					}
 
-					ThermEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ThermalEffCurveID, Pnetss, MdotCW, TcwIn );
+					ThermEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ThermalEffCurveID, Pnetss, MdotCW, CalcMicroCHPNoNormalizeGeneratorModelTcwIn );
 					ThermEff = max( 0.0, ThermEff ); //protect against bad curve result
-					Qgenss = ThermEff * Qgross; //W
+					CalcMicroCHPNoNormalizeGeneratorModelQgenss = ThermEff * Qgross; //W
 
 				}
 				Pnetss = 0.0; // no actually power produced here.
@@ -957,9 +1013,9 @@ namespace MicroCHPElectricGenerator {
 				Pnetss = 0.0;
 				Pstandby = 0.0;
 				Pcooler = MicroCHP( GeneratorNum ).A42Model.PcoolDown * PLRforSubtimestepShutDown; // could be here with part load in cool down
-				TcwIn = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).Temp; //C
+				CalcMicroCHPNoNormalizeGeneratorModelTcwIn = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).Temp; //C
 				MdotCW = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).MassFlowRate; //kg/s
-				ElecEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ElecEffCurveID, Pmax, MdotCW, TcwIn );
+				ElecEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ElecEffCurveID, Pmax, MdotCW, CalcMicroCHPNoNormalizeGeneratorModelTcwIn );
 				ElecEff = max( 0.0, ElecEff ); //protect against bad curve result
 				if ( ElecEff > 0.0 ) { // trap divide by bad thing
 					Qgross = Pmax / ElecEff; //W
@@ -970,20 +1026,20 @@ namespace MicroCHPElectricGenerator {
 				//  kMol/s = (J/s) /(KJ/mol * 1000 J/KJ * 1000 mol/kmol)
 				MdotFuelMax = NdotFuel * FuelSupply( MicroCHP( GeneratorNum ).FuelSupplyID ).KmolPerSecToKgPerSec;
 
-				if ( Teng > thisAmbientTemp ) {
-					MdotFuelWarmup = MdotFuelMax + MicroCHP( GeneratorNum ).A42Model.kf * MdotFuelMax * ( ( MicroCHP( GeneratorNum ).A42Model.TnomEngOp - thisAmbientTemp ) / ( Teng - thisAmbientTemp ) );
+				if ( CalcMicroCHPNoNormalizeGeneratorModelTeng > thisAmbientTemp ) {
+					MdotFuelWarmup = MdotFuelMax + MicroCHP( GeneratorNum ).A42Model.kf * MdotFuelMax * ( ( MicroCHP( GeneratorNum ).A42Model.TnomEngOp - thisAmbientTemp ) / ( CalcMicroCHPNoNormalizeGeneratorModelTeng - thisAmbientTemp ) );
 					// check that numerical answer didn't blow up beyond limit, and reset if it did
 					if ( MdotFuelWarmup > MicroCHP( GeneratorNum ).A42Model.Rfuelwarmup * MdotFuelMax ) {
 						MdotFuelWarmup = MicroCHP( GeneratorNum ).A42Model.Rfuelwarmup * MdotFuelMax;
 					}
-				} else if ( Teng < thisAmbientTemp ) {
+				} else if ( CalcMicroCHPNoNormalizeGeneratorModelTeng < thisAmbientTemp ) {
 					MdotFuelWarmup = MicroCHP( GeneratorNum ).A42Model.Rfuelwarmup * MdotFuelMax;
 				} else { // equal would divide by zero
 					MdotFuelWarmup = MicroCHP( GeneratorNum ).A42Model.Rfuelwarmup * MdotFuelMax;
 				}
 
 				if ( MicroCHP( GeneratorNum ).A42Model.TnomEngOp > thisAmbientTemp ) {
-					Pnetss = Pmax * MicroCHP( GeneratorNum ).A42Model.kp * ( ( Teng - thisAmbientTemp ) / ( MicroCHP( GeneratorNum ).A42Model.TnomEngOp - thisAmbientTemp ) );
+					Pnetss = Pmax * MicroCHP( GeneratorNum ).A42Model.kp * ( ( CalcMicroCHPNoNormalizeGeneratorModelTeng - thisAmbientTemp ) / ( MicroCHP( GeneratorNum ).A42Model.TnomEngOp - thisAmbientTemp ) );
 				} else if ( MicroCHP( GeneratorNum ).A42Model.TnomEngOp < thisAmbientTemp ) {
 					Pnetss = Pmax;
 				} else { // equal would divide by zero
@@ -1000,8 +1056,8 @@ namespace MicroCHPElectricGenerator {
 				MdotAir = CurveValue( MicroCHP( GeneratorNum ).A42Model.AirFlowCurveID, MdotFuelWarmup );
 				MdotAir = max( 0.0, MdotAir ); //protect against bad curve result
 				Qgross = NdotFuel * ( FuelSupply( MicroCHP( GeneratorNum ).FuelSupplyID ).LHV * 1000.0 * 1000.0 );
-				ThermEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ThermalEffCurveID, Pmax, MdotCW, TcwIn );
-				Qgenss = ThermEff * Qgross; //W
+				ThermEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ThermalEffCurveID, Pmax, MdotCW, CalcMicroCHPNoNormalizeGeneratorModelTcwIn );
+				CalcMicroCHPNoNormalizeGeneratorModelQgenss = ThermEff * Qgross; //W
 
 			}
 			NdotFuel = MdotFuel / FuelSupply( MicroCHP( GeneratorNum ).FuelSupplyID ).KmolPerSecToKgPerSec;
@@ -1015,13 +1071,13 @@ namespace MicroCHPElectricGenerator {
 			}
 			Pstandby = 0.0;
 			Pcooler = 0.0;
-			TcwIn = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).Temp; //C
+			CalcMicroCHPNoNormalizeGeneratorModelTcwIn = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).Temp; //C
 			MdotCW = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).MassFlowRate; //kg/s
 			if ( MicroCHP( GeneratorNum ).A42Model.InternalFlowControl ) {
-				MdotCW = FuncDetermineCWMdotForInternalFlowControl( GeneratorNum, Pnetss, TcwIn );
+				MdotCW = FuncDetermineCWMdotForInternalFlowControl( GeneratorNum, Pnetss, CalcMicroCHPNoNormalizeGeneratorModelTcwIn );
 			}
 
-			ElecEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ElecEffCurveID, Pnetss, MdotCW, TcwIn );
+			ElecEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ElecEffCurveID, Pnetss, MdotCW, CalcMicroCHPNoNormalizeGeneratorModelTcwIn );
 			ElecEff = max( 0.0, ElecEff ); //protect against bad curve result
 
 			if ( ElecEff > 0.0 ) { // trap divide by bad thing
@@ -1030,12 +1086,12 @@ namespace MicroCHPElectricGenerator {
 				Qgross = 0.0;
 			}
 
-			ThermEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ThermalEffCurveID, Pnetss, MdotCW, TcwIn );
+			ThermEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ThermalEffCurveID, Pnetss, MdotCW, CalcMicroCHPNoNormalizeGeneratorModelTcwIn );
 			ThermEff = max( 0.0, ThermEff ); //protect against bad curve result
-			Qgenss = ThermEff * Qgross; //W
+			CalcMicroCHPNoNormalizeGeneratorModelQgenss = ThermEff * Qgross; //W
 			MdotFuel = Qgross / ( FuelSupply( MicroCHP( GeneratorNum ).FuelSupplyID ).LHV * 1000.0 * 1000.0 ) * FuelSupply( MicroCHP( GeneratorNum ).FuelSupplyID ).KmolPerSecToKgPerSec;
 			//  kMol/s = (J/s) /(KJ/mol * 1000 J/KJ * 1000 mol/kmol)
-			ManageGeneratorFuelFlow( iGeneratorMicroCHP, MicroCHP( GeneratorNum ).Name, GeneratorNum, RunFlag, MdotFuel, MdotFuelAllowed, ConstrainedIncreasingNdot, ConstrainedDecreasingNdot );
+			ManageGeneratorFuelFlow( iGeneratorMicroCHP, MicroCHP( GeneratorNum ).Name, GeneratorNum, CalcMicroCHPNoNormalizeGeneratorModelRunFlag, MdotFuel, MdotFuelAllowed, ConstrainedIncreasingNdot, ConstrainedDecreasingNdot );
 
 			if ( ConstrainedIncreasingNdot || ConstrainedDecreasingNdot ) { // recalculate Pnetss with new NdotFuel with iteration
 				MdotFuel = MdotFuelAllowed;
@@ -1045,15 +1101,15 @@ namespace MicroCHPElectricGenerator {
 				for ( i = 1; i <= 20; ++i ) { // iterating here,  could add use of seach method error signal
 					Pnetss = Qgross * ElecEff;
 					if ( MicroCHP( GeneratorNum ).A42Model.InternalFlowControl ) {
-						MdotCW = FuncDetermineCWMdotForInternalFlowControl( GeneratorNum, Pnetss, TcwIn );
+						MdotCW = FuncDetermineCWMdotForInternalFlowControl( GeneratorNum, Pnetss, CalcMicroCHPNoNormalizeGeneratorModelTcwIn );
 					}
-					ElecEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ElecEffCurveID, Pnetss, MdotCW, TcwIn );
+					ElecEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ElecEffCurveID, Pnetss, MdotCW, CalcMicroCHPNoNormalizeGeneratorModelTcwIn );
 					ElecEff = max( 0.0, ElecEff ); //protect against bad curve result
 				}
 
-				ThermEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ThermalEffCurveID, Pnetss, MdotCW, TcwIn );
+				ThermEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ThermalEffCurveID, Pnetss, MdotCW, CalcMicroCHPNoNormalizeGeneratorModelTcwIn );
 				ThermEff = max( 0.0, ThermEff ); //protect against bad curve result
-				Qgenss = ThermEff * Qgross; //W
+				CalcMicroCHPNoNormalizeGeneratorModelQgenss = ThermEff * Qgross; //W
 
 			}
 
@@ -1069,10 +1125,10 @@ namespace MicroCHPElectricGenerator {
 			Pnetss = 0.0;
 			Pstandby = 0.0;
 			Pcooler = MicroCHP( GeneratorNum ).A42Model.PcoolDown;
-			TcwIn = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).Temp; //C
+			CalcMicroCHPNoNormalizeGeneratorModelTcwIn = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).Temp; //C
 			MdotCW = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).MassFlowRate; //kg/s
 			if ( MicroCHP( GeneratorNum ).A42Model.InternalFlowControl ) {
-				MdotCW = FuncDetermineCWMdotForInternalFlowControl( GeneratorNum, Pnetss, TcwIn );
+				MdotCW = FuncDetermineCWMdotForInternalFlowControl( GeneratorNum, Pnetss, CalcMicroCHPNoNormalizeGeneratorModelTcwIn );
 			}
 			NdotFuel = 0.0;
 			MdotFuel = 0.0;
@@ -1080,7 +1136,7 @@ namespace MicroCHPElectricGenerator {
 			ElecEff = 0.0;
 			ThermEff = 0.0;
 			Qgross = 0.0;
-			Qgenss = 0.0;
+			CalcMicroCHPNoNormalizeGeneratorModelQgenss = 0.0;
 		}}
 
 		EnergyBalOK = false;
@@ -1090,9 +1146,9 @@ namespace MicroCHPElectricGenerator {
 			if ( ( MicroCHP( GeneratorNum ).A42Model.WarmUpByEngineTemp ) && ( CurrentOpMode == OpModeWarmUp ) ) {
 
 				Pmax = MicroCHP( GeneratorNum ).A42Model.MaxElecPower;
-				TcwIn = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).Temp; //C
+				CalcMicroCHPNoNormalizeGeneratorModelTcwIn = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).Temp; //C
 				MdotCW = Node( MicroCHP( GeneratorNum ).PlantInletNodeID ).MassFlowRate; //kg/s
-				ElecEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ElecEffCurveID, Pmax, MdotCW, TcwIn );
+				ElecEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ElecEffCurveID, Pmax, MdotCW, CalcMicroCHPNoNormalizeGeneratorModelTcwIn );
 				ElecEff = max( 0.0, ElecEff ); //protect against bad curve result
 				if ( ElecEff > 0.0 ) { // trap divide by bad thing
 					Qgross = Pmax / ElecEff; //W
@@ -1103,22 +1159,22 @@ namespace MicroCHPElectricGenerator {
 				//  kMol/s = (J/s) /(KJ/mol * 1000 J/KJ * 1000 mol/kmol)
 				MdotFuelMax = NdotFuel * FuelSupply( MicroCHP( GeneratorNum ).FuelSupplyID ).KmolPerSecToKgPerSec;
 
-				if ( Teng > thisAmbientTemp ) {
-					MdotFuelWarmup = MdotFuelMax + MicroCHP( GeneratorNum ).A42Model.kf * MdotFuelMax * ( ( MicroCHP( GeneratorNum ).A42Model.TnomEngOp - thisAmbientTemp ) / ( Teng - thisAmbientTemp ) );
+				if ( CalcMicroCHPNoNormalizeGeneratorModelTeng > thisAmbientTemp ) {
+					MdotFuelWarmup = MdotFuelMax + MicroCHP( GeneratorNum ).A42Model.kf * MdotFuelMax * ( ( MicroCHP( GeneratorNum ).A42Model.TnomEngOp - thisAmbientTemp ) / ( CalcMicroCHPNoNormalizeGeneratorModelTeng - thisAmbientTemp ) );
 
 					// check that numerical answer didn't blow up beyond limit, and reset if it did
 					if ( MdotFuelWarmup > MicroCHP( GeneratorNum ).A42Model.Rfuelwarmup * MdotFuelMax ) {
 						MdotFuelWarmup = MicroCHP( GeneratorNum ).A42Model.Rfuelwarmup * MdotFuelMax;
 					}
 					if ( MicroCHP( GeneratorNum ).A42Model.TnomEngOp > thisAmbientTemp ) {
-						Pnetss = Pmax * MicroCHP( GeneratorNum ).A42Model.kp * ( ( Teng - thisAmbientTemp ) / ( MicroCHP( GeneratorNum ).A42Model.TnomEngOp - thisAmbientTemp ) );
+						Pnetss = Pmax * MicroCHP( GeneratorNum ).A42Model.kp * ( ( CalcMicroCHPNoNormalizeGeneratorModelTeng - thisAmbientTemp ) / ( MicroCHP( GeneratorNum ).A42Model.TnomEngOp - thisAmbientTemp ) );
 					} else if ( MicroCHP( GeneratorNum ).A42Model.TnomEngOp < thisAmbientTemp ) {
 						Pnetss = Pmax;
 					} else { // equal would divide by zero
 						Pnetss = Pmax;
 					}
 
-				} else if ( Teng < thisAmbientTemp ) {
+				} else if ( CalcMicroCHPNoNormalizeGeneratorModelTeng < thisAmbientTemp ) {
 					MdotFuelWarmup = MicroCHP( GeneratorNum ).A42Model.Rfuelwarmup * MdotFuelMax;
 				} else { // equal would divide by zero
 					MdotFuelWarmup = MicroCHP( GeneratorNum ).A42Model.Rfuelwarmup * MdotFuelMax;
@@ -1128,19 +1184,19 @@ namespace MicroCHPElectricGenerator {
 				MdotAir = CurveValue( MicroCHP( GeneratorNum ).A42Model.AirFlowCurveID, MdotFuelWarmup );
 				MdotAir = max( 0.0, MdotAir ); //protect against bad curve result
 				Qgross = NdotFuel * ( FuelSupply( MicroCHP( GeneratorNum ).FuelSupplyID ).LHV * 1000.0 * 1000.0 );
-				ThermEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ThermalEffCurveID, Pmax, MdotCW, TcwIn );
+				ThermEff = CurveValue( MicroCHP( GeneratorNum ).A42Model.ThermalEffCurveID, Pmax, MdotCW, CalcMicroCHPNoNormalizeGeneratorModelTcwIn );
 				ThermEff = max( 0.0, ThermEff ); //protect against bad curve result
-				Qgenss = ThermEff * Qgross; //W
+				CalcMicroCHPNoNormalizeGeneratorModelQgenss = ThermEff * Qgross; //W
 			}
 
-			Teng = FuncDetermineEngineTemp( TcwOut, MicroCHP( GeneratorNum ).A42Model.MCeng, MicroCHP( GeneratorNum ).A42Model.UAhx, MicroCHP( GeneratorNum ).A42Model.UAskin, thisAmbientTemp, Qgenss, MicroCHP( GeneratorNum ).A42Model.TengLast, dt );
+			CalcMicroCHPNoNormalizeGeneratorModelTeng = FuncDetermineEngineTemp( CalcMicroCHPNoNormalizeGeneratorModelTcwOut, MicroCHP( GeneratorNum ).A42Model.MCeng, MicroCHP( GeneratorNum ).A42Model.UAhx, MicroCHP( GeneratorNum ).A42Model.UAskin, thisAmbientTemp, CalcMicroCHPNoNormalizeGeneratorModelQgenss, MicroCHP( GeneratorNum ).A42Model.TengLast, dt );
 
-			Cp = GetSpecificHeatGlycol( PlantLoop( MicroCHP( GeneratorNum ).CWLoopNum ).FluidName, TcwIn, PlantLoop( MicroCHP( GeneratorNum ).CWLoopNum ).FluidIndex, RoutineName );
+			Cp = GetSpecificHeatGlycol( PlantLoop( MicroCHP( GeneratorNum ).CWLoopNum ).FluidName, CalcMicroCHPNoNormalizeGeneratorModelTcwIn, PlantLoop( MicroCHP( GeneratorNum ).CWLoopNum ).FluidIndex, RoutineName );
 
-			TcwOut = FuncDetermineCoolantWaterExitTemp( TcwIn, MicroCHP( GeneratorNum ).A42Model.MCcw, MicroCHP( GeneratorNum ).A42Model.UAhx, MdotCW * Cp, Teng, MicroCHP( GeneratorNum ).A42Model.TempCWOutLast, dt );
+			CalcMicroCHPNoNormalizeGeneratorModelTcwOut = FuncDetermineCoolantWaterExitTemp( CalcMicroCHPNoNormalizeGeneratorModelTcwIn, MicroCHP( GeneratorNum ).A42Model.MCcw, MicroCHP( GeneratorNum ).A42Model.UAhx, MdotCW * Cp, CalcMicroCHPNoNormalizeGeneratorModelTeng, MicroCHP( GeneratorNum ).A42Model.TempCWOutLast, dt );
 
 			// form balance and exit once met.
-			EnergyBalOK = CheckMicroCHPThermalBalance( MicroCHP( GeneratorNum ).A42Model.MaxElecPower, TcwIn, TcwOut, Teng, thisAmbientTemp, MicroCHP( GeneratorNum ).A42Model.UAhx, MicroCHP( GeneratorNum ).A42Model.UAskin, Qgenss, MicroCHP( GeneratorNum ).A42Model.MCeng, MicroCHP( GeneratorNum ).A42Model.MCcw, MdotCW * Cp );
+			EnergyBalOK = CheckMicroCHPThermalBalance( MicroCHP( GeneratorNum ).A42Model.MaxElecPower, CalcMicroCHPNoNormalizeGeneratorModelTcwIn, CalcMicroCHPNoNormalizeGeneratorModelTcwOut, CalcMicroCHPNoNormalizeGeneratorModelTeng, thisAmbientTemp, MicroCHP( GeneratorNum ).A42Model.UAhx, MicroCHP( GeneratorNum ).A42Model.UAskin, CalcMicroCHPNoNormalizeGeneratorModelQgenss, MicroCHP( GeneratorNum ).A42Model.MCeng, MicroCHP( GeneratorNum ).A42Model.MCcw, MdotCW * Cp );
 
 			if ( EnergyBalOK && ( i > 4 ) ) break;
 
@@ -1151,14 +1207,14 @@ namespace MicroCHPElectricGenerator {
 		MicroCHP( GeneratorNum ).A42Model.ElecEff = ElecEff;
 		MicroCHP( GeneratorNum ).A42Model.Qgross = Qgross;
 		MicroCHP( GeneratorNum ).A42Model.ThermEff = ThermEff;
-		MicroCHP( GeneratorNum ).A42Model.Qgenss = Qgenss;
+		MicroCHP( GeneratorNum ).A42Model.Qgenss = CalcMicroCHPNoNormalizeGeneratorModelQgenss;
 		MicroCHP( GeneratorNum ).A42Model.NdotFuel = NdotFuel;
 		MicroCHP( GeneratorNum ).A42Model.MdotFuel = MdotFuel;
-		MicroCHP( GeneratorNum ).A42Model.Teng = Teng;
-		MicroCHP( GeneratorNum ).A42Model.TcwOut = TcwOut;
-		MicroCHP( GeneratorNum ).A42Model.TcwIn = TcwIn;
+		MicroCHP( GeneratorNum ).A42Model.Teng = CalcMicroCHPNoNormalizeGeneratorModelTeng;
+		MicroCHP( GeneratorNum ).A42Model.TcwOut = CalcMicroCHPNoNormalizeGeneratorModelTcwOut;
+		MicroCHP( GeneratorNum ).A42Model.TcwIn = CalcMicroCHPNoNormalizeGeneratorModelTcwIn;
 		MicroCHP( GeneratorNum ).A42Model.MdotAir = MdotAir;
-		MicroCHP( GeneratorNum ).A42Model.QdotSkin = MicroCHP( GeneratorNum ).A42Model.UAskin * ( Teng - thisAmbientTemp );
+		MicroCHP( GeneratorNum ).A42Model.QdotSkin = MicroCHP( GeneratorNum ).A42Model.UAskin * ( CalcMicroCHPNoNormalizeGeneratorModelTeng - thisAmbientTemp );
 
 		MicroCHP( GeneratorNum ).A42Model.OpMode = CurrentOpMode;
 
@@ -1412,21 +1468,20 @@ namespace MicroCHPElectricGenerator {
 		Real64 TotalZoneHeatGain;
 		int CHPnum;
 		//  INTEGER :: ZoneNum
-		static bool MyEnvrnFlag( true );
 
 		if ( NumMicroCHPs == 0 ) return;
 
-		if ( BeginEnvrnFlag && MyEnvrnFlag ) {
+		if ( BeginEnvrnFlag && FigureMicroCHPZoneGainsMyEnvrnFlag ) {
 			for ( auto & e : FuelSupply ) e.QskinLoss = 0.0;
 			for ( auto & e : MicroCHP ) {
 				e.A42Model.QdotSkin = 0.0;
 				e.Report.SkinLossConvect = 0.0;
 				e.Report.SkinLossRadiat = 0.0;
 			}
-			MyEnvrnFlag = false;
+			FigureMicroCHPZoneGainsMyEnvrnFlag = false;
 		}
 
-		if ( ! BeginEnvrnFlag ) MyEnvrnFlag = true;
+		if ( ! BeginEnvrnFlag ) FigureMicroCHPZoneGainsMyEnvrnFlag = true;
 
 		for ( CHPnum = 1; CHPnum <= NumMicroCHPs; ++CHPnum ) {
 			TotalZoneHeatGain = FuelSupply( MicroCHP( CHPnum ).FuelSupplyID ).QskinLoss + MicroCHP( CHPnum ).A42Model.QdotSkin;
@@ -81,6 +81,11 @@ namespace MicroCHPElectricGenerator {
 
 	// Functions
 
+	// Clears the global data in MicroCHPElectricGenerator.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimMicroCHPGenerator(
 		int const GeneratorType, // type of Generator
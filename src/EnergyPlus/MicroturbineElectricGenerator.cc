@@ -130,6 +130,42 @@ namespace MicroturbineElectricGenerator {
 	Array1D< MTGeneratorSpecs > MTGenerator; // dimension to number of generators
 	Array1D< ReportVars > MTGeneratorReport;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false ); // Error flag... trips fatal error message at end of get input
+		Real64 Var1Min( 0.0 ); // Minimum value for variable 1, value obtained from a curve object
+		Real64 Var1Max( 0.0 ); // Maximum value for variable 1, value obtained from a curve object
+		Array1D_bool MyEnvrnFlag; // Flag for init once at start of environment
+		Array1D_bool MyPlantScanFlag;
+		Array1D_bool MySizeAndNodeInitFlag;
+		bool MyOneTimeFlag( true ); // Initialization flag
+	}
+
+	// Functions
+
+	// Clears the global data in MicroturbineElectricGenerator.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumMTGenerators = 0;
+		GetMTInput = true;
+		CheckEquipName.deallocate();
+		MTGenerator.deallocate();
+		MTGeneratorReport.deallocate();
+		ErrorsFound = false;
+		Var1Min = 0.0;
+		Var1Max = 0.0;
+		MyEnvrnFlag.deallocate();
+		MyPlantScanFlag.deallocate();
+		MySizeAndNodeInitFlag.deallocate();
+		MyOneTimeFlag = true;
+	}
+
 	void
 	SimMTGenerator(
 		int const EP_UNUSED( GeneratorType ), // Type of generator !unused1208
@@ -328,7 +364,6 @@ namespace MicroturbineElectricGenerator {
 		int NumAlphas; // Number of elements in the alpha array
 		int NumNums; // Number of elements in the numeric array
 		int IOStat; // IO Status when calling get input subroutine
-		static bool ErrorsFound( false ); // Error flag... trips fatal error message at end of get input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		Real64 ElectOutFTempElevOutput; // Output of Electrical Power Output Modifier Curve (function of temp and elev)
@@ -345,8 +380,6 @@ namespace MicroturbineElectricGenerator {
 		Real64 ExhFlowFPLROutput; // Output of Exhaust Air Flow Modifier Curve (function of PLR)
 		Real64 ExhAirTempFTempOutput; // Output of Exhaust Air Temperature Modifier Curve (function of inlet air temp)
 		Real64 ExhOutAirTempFPLROutput; // Output of Exhaust Air Temperature Modifier Curve (function of PLR)
-		static Real64 Var1Min( 0.0 ); // Minimum value for variable 1, value obtained from a curve object
-		static Real64 Var1Max( 0.0 ); // Maximum value for variable 1, value obtained from a curve object
 
 		Array1D< Real64 > NumArray( 19 ); // Numeric data array
 
@@ -1164,10 +1197,6 @@ namespace MicroturbineElectricGenerator {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int HeatRecInletNode; // Inlet node number in heat recovery loop
 		int HeatRecOutletNode; // Outlet node number in heat recovery loop
-		static Array1D_bool MyEnvrnFlag; // Flag for init once at start of environment
-		static Array1D_bool MyPlantScanFlag;
-		static Array1D_bool MySizeAndNodeInitFlag;
-		static bool MyOneTimeFlag( true ); // Initialization flag
 		Real64 rho; // local temporary fluid density
 		Real64 DesiredMassFlowRate;
 		bool errFlag;
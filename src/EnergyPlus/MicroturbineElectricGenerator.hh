@@ -343,6 +343,11 @@ namespace MicroturbineElectricGenerator {
 
 	// Functions
 
+	// Clears the global data in MicroturbineElectricGenerator.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimMTGenerator(
 		int const GeneratorType, // Type of generator !unused1208
@@ -283,6 +283,32 @@ namespace MixedAir {
 		Array1D_string VentMechZoneOrListName; // Zone or Zone List to apply mechanical ventilation rate
 		Array1D_string DesignSpecZoneADObjName; // name of the design specification zone air distribution object
 		Array1D_int DesignSpecZoneADObjIndex; // index of the design specification zone air distribution object
+		std::string SimOutsideAirSysCompType; //Tuned Made static
+		std::string SimOutsideAirSysCompName; //Tuned Made static
+		std::string SimOutsideAirSysCtrlName; //Tuned Made static
+		bool GetOutsideAirSysInputsErrorsFound( false );
+		int MaxNums( 0 ); // Maximum number of numeric input fields
+		int MaxAlphas( 0 ); // Maximum number of alpha input fields
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		bool GetOAControllerInputsErrorsFound( false ); // Flag identifying errors found during get input
+		int ObjIndex( 0 );
+		int EquipListIndex( 0 );
+		int EquipNum( 0 );
+		int EquipListNum( 0 );
+		int ADUNum( 0 );
+		bool GetOAMixerInputsErrorsFound( false );
+		Array1D_bool OAControllerMyOneTimeFlag; // One-time initialization flag
+		Array1D_bool OAControllerMyEnvrnFlag; // One-time initialization flag
+		Array1D_bool OAControllerMySizeFlag; // One-time initialization flag
+		Array1D_bool MechVentCheckFlag; // One-time initialization flag
+		Real64 Ep( 1.0 ); // zone primary air fraction
+		Real64 Er( 0.0 ); // zone secondary recirculation fraction
+		Real64 Fa( 1.0 ); // temporary variable used in multi-path VRP calc
+		Real64 Fb( 1.0 );
+		Real64 Fc( 1.0 );
+		Real64 Xs( 1.0 ); // uncorrected system outdoor air fraction
+		Real64 Evz( 1.0 ); // zone ventilation efficiency
+		Array1D< Real64 > CalcOAEconomizerPar(4); // Par(1) = mixed air node number //Tuned Made static
 	}
 	//SUBROUTINE SPECIFICATIONS FOR MODULE MixedAir
 	// Driver/Manager Routines
@@ -379,6 +405,32 @@ namespace MixedAir {
 		DesignSpecOAObjIndex.deallocate();
 		DesignSpecZoneADObjName.deallocate();
 		DesignSpecZoneADObjIndex.deallocate();
+		SimOutsideAirSysCompType.clear();
+		SimOutsideAirSysCompName.clear();
+		SimOutsideAirSysCtrlName.clear();
+		GetOutsideAirSysInputsErrorsFound = false;
+		MaxNums = 0;
+		MaxAlphas = 0;
+		TotalArgs = 0;
+		GetOAControllerInputsErrorsFound = false;
+		ObjIndex = 0;
+		EquipListIndex = 0;
+		EquipNum = 0;
+		EquipListNum = 0;
+		ADUNum = 0;
+		GetOAMixerInputsErrorsFound = false;
+		OAControllerMyOneTimeFlag.deallocate();
+		OAControllerMyEnvrnFlag.deallocate();
+		OAControllerMySizeFlag.deallocate();
+		MechVentCheckFlag.deallocate();
+		Ep = 1.0;
+		Er = 0.0;
+		Fa = 1.0;
+		Fb = 1.0;
+		Fc = 1.0;
+		Xs = 1.0;
+		Evz = 1.0;
+		CalcOAEconomizerPar = Array1D< Real64 >(4);
 	}
 
 	void
@@ -478,9 +530,6 @@ namespace MixedAir {
 		//INTEGER :: CtrlNum
 		int OAMixerNum;
 		int OAControllerNum;
-		static std::string CompType; //Tuned Made static
-		static std::string CompName; //Tuned Made static
-		static std::string CtrlName; //Tuned Made static
 		bool FatalErrorFlag( false );
 		bool Sim( true );
 		bool OAHeatCoil( false );
@@ -495,14 +544,14 @@ namespace MixedAir {
 		//    CtrlName = OutsideAirSys(OASysNum)%ControllerName(CtrlNum)
 		//    CALL SimOAController(CtrlName,FirstHVACIteration)
 		//  END DO
-		CtrlName = OutsideAirSys( OASysNum ).ControllerName( 1 );
+		SimOutsideAirSysCtrlName = OutsideAirSys( OASysNum ).ControllerName( 1 );
 		CurOASysNum = OASysNum;
-		SimOAController( CtrlName, OutsideAirSys( OASysNum ).ControllerIndex( 1 ), FirstHVACIteration, AirLoopNum );
+		SimOAController( SimOutsideAirSysCtrlName, OutsideAirSys( OASysNum ).ControllerIndex( 1 ), FirstHVACIteration, AirLoopNum );
 
 		for ( CompNum = 1; CompNum <= OutsideAirSys( OASysNum ).NumComponents; ++CompNum ) {
-			CompType = OutsideAirSys( OASysNum ).ComponentType( CompNum );
-			CompName = OutsideAirSys( OASysNum ).ComponentName( CompNum );
-			SimOAComponent( CompType, CompName, OutsideAirSys( OASysNum ).ComponentType_Num( CompNum ), FirstHVACIteration, OutsideAirSys( OASysNum ).ComponentIndex( CompNum ), AirLoopNum, Sim, OASysNum, OAHeatCoil, OACoolCoil, OAHX );
+			SimOutsideAirSysCompType = OutsideAirSys( OASysNum ).ComponentType( CompNum );
+			SimOutsideAirSysCompName = OutsideAirSys( OASysNum ).ComponentName( CompNum );
+			SimOAComponent( SimOutsideAirSysCompType, SimOutsideAirSysCompName, OutsideAirSys( OASysNum ).ComponentType_Num( CompNum ), FirstHVACIteration, OutsideAirSys( OASysNum ).ComponentIndex( CompNum ), AirLoopNum, Sim, OASysNum, OAHeatCoil, OACoolCoil, OAHX );
 			if ( OAHX ) ReSim = true;
 		}
 		// if there were heat exchangers and/or desiccant wheel in the OA path, need to simulate again
@@ -510,15 +559,15 @@ namespace MixedAir {
 		// exit node
 		if ( ReSim ) {
 			for ( CompNum = OutsideAirSys( OASysNum ).NumComponents - 1; CompNum >= 1; --CompNum ) {
-				CompType = OutsideAirSys( OASysNum ).ComponentType( CompNum );
-				CompName = OutsideAirSys( OASysNum ).ComponentName( CompNum );
-				SimOAComponent( CompType, CompName, OutsideAirSys( OASysNum ).ComponentType_Num( CompNum ), FirstHVACIteration, OutsideAirSys( OASysNum ).ComponentIndex( CompNum ), AirLoopNum, Sim, OASysNum, OAHeatCoil, OACoolCoil, OAHX );
+				SimOutsideAirSysCompType = OutsideAirSys( OASysNum ).ComponentType( CompNum );
+				SimOutsideAirSysCompName = OutsideAirSys( OASysNum ).ComponentName( CompNum );
+				SimOAComponent( SimOutsideAirSysCompType, SimOutsideAirSysCompName, OutsideAirSys( OASysNum ).ComponentType_Num( CompNum ), FirstHVACIteration, OutsideAirSys( OASysNum ).ComponentIndex( CompNum ), AirLoopNum, Sim, OASysNum, OAHeatCoil, OACoolCoil, OAHX );
 			}
 			// now simulate again propogate current temps back through OA system
 			for( CompNum = 1; CompNum <= OutsideAirSys( OASysNum ).NumComponents; ++CompNum ) {
-				CompType = OutsideAirSys( OASysNum ).ComponentType( CompNum );
-				CompName = OutsideAirSys( OASysNum ).ComponentName( CompNum );
-				SimOAComponent( CompType, CompName, OutsideAirSys( OASysNum ).ComponentType_Num( CompNum ), FirstHVACIteration, OutsideAirSys( OASysNum ).ComponentIndex( CompNum ), AirLoopNum, Sim, OASysNum, OAHeatCoil, OACoolCoil, OAHX );
+				SimOutsideAirSysCompType = OutsideAirSys( OASysNum ).ComponentType( CompNum );
+				SimOutsideAirSysCompName = OutsideAirSys( OASysNum ).ComponentName( CompNum );
+				SimOAComponent( SimOutsideAirSysCompType, SimOutsideAirSysCompName, OutsideAirSys( OASysNum ).ComponentType_Num( CompNum ), FirstHVACIteration, OutsideAirSys( OASysNum ).ComponentIndex( CompNum ), AirLoopNum, Sim, OASysNum, OAHeatCoil, OACoolCoil, OAHX );
 			}
 		}
 
@@ -527,11 +576,11 @@ namespace MixedAir {
 				ShowWarningError( "AirLoopHVAC:OutdoorAirSystem " + OutsideAirSys( OASysNum ).Name + " has more than 1 outside air controller; only the 1st will be used" );
 			}
 			for ( CompNum = 1; CompNum <= OutsideAirSys( OASysNum ).NumComponents; ++CompNum ) {
-				CompType = OutsideAirSys( OASysNum ).ComponentType( CompNum );
-				CompName = OutsideAirSys( OASysNum ).ComponentName( CompNum );
-				if ( SameString( CompType, "OutdoorAir:Mixer" ) ) {
-					OAMixerNum = FindItemInList( CompName, OAMixer );
-					OAControllerNum = FindItemInList( CtrlName, OAController );
+				SimOutsideAirSysCompType = OutsideAirSys( OASysNum ).ComponentType( CompNum );
+				SimOutsideAirSysCompName = OutsideAirSys( OASysNum ).ComponentName( CompNum );
+				if ( SameString( SimOutsideAirSysCompType, "OutdoorAir:Mixer" ) ) {
+					OAMixerNum = FindItemInList( SimOutsideAirSysCompName, OAMixer );
+					OAControllerNum = FindItemInList( SimOutsideAirSysCtrlName, OAController );
 					if ( OAController( OAControllerNum ).MixNode != OAMixer( OAMixerNum ).MixNode ) {
 						ShowSevereError( "The mixed air node of Controller:OutdoorAir=\"" + OAController( OAControllerNum ).Name + "\"" );
 						ShowContinueError( "should be the same node as the mixed air node of OutdoorAir:Mixer=\"" + OAMixer( OAMixerNum ).Name + "\"." );
@@ -968,7 +1017,6 @@ namespace MixedAir {
 		int InListNum;
 		int ListNum;
 		int NumSimpControllers; // number of Controller:Simple objects in an OA System
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		std::string CurrentModuleObject; // Object type for getting and messages
@@ -976,9 +1024,6 @@ namespace MixedAir {
 		Array1D_string cNumericFields; // Numeric field names
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int MaxNums( 0 ); // Maximum number of numeric input fields
-		static int MaxAlphas( 0 ); // Maximum number of alpha input fields
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 		//  certain object in the input file
 
 		if ( ! GetOASysInputFlag ) return;
@@ -1014,7 +1059,7 @@ namespace MixedAir {
 			IsBlank = false;
 			VerifyName( AlphArray( 1 ), ControllerLists, Item - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetOutsideAirSysInputsErrorsFound = true;
 				if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 			}
 			thisControllerList.Name = AlphArray( 1 );
@@ -1037,14 +1082,14 @@ namespace MixedAir {
 								ShowSevereError( "Controller instance repeated in multiple " + CurrentModuleObject + " objects" );
 								ShowContinueError( "Found in " + CurrentModuleObject + " = " + thisControllerList.Name );
 								ShowContinueError( "Also found in " + CurrentModuleObject + " = " + previousList.Name );
-								ErrorsFound = true;
+								GetOutsideAirSysInputsErrorsFound = true;
 							}
 						}
 					}
 				} else {
 					ShowSevereError( "For " + CurrentModuleObject + "=\"" + AlphArray( 1 ) + "\" invalid " + cAlphaFields( AlphaNum ) );
 					ShowContinueError( "...entered=\"" + AlphArray( AlphaNum ) + "\", should be Controller:WaterCoil or Controller:OutdoorAir." );
-					ErrorsFound = true;
+					GetOutsideAirSysInputsErrorsFound = true;
 				}
 				AlphaNum += 2;
 			}
@@ -1067,7 +1112,7 @@ namespace MixedAir {
 			IsBlank = false;
 			VerifyName( AlphArray( 1 ), OutsideAirSys, OASysNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetOutsideAirSysInputsErrorsFound = true;
 				if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 			}
 			OutsideAirSys( OASysNum ).Name = AlphArray( 1 );
@@ -1076,7 +1121,7 @@ namespace MixedAir {
 			VerifyName( AlphArray( 2 ), OutsideAirSys, &OutsideAirSysProps::ControllerListName, OASysNum - 1, IsNotOK, IsBlank, CurrentModuleObject + ' ' + cAlphaFields( 2 ) + " Name" );
 			if ( IsNotOK && AlphArray( 1 ) != "xxxxx" ) {
 				ShowContinueError( "Occurs in " + CurrentModuleObject + " = \"" + AlphArray( 1 ) + "\"." );
-				ErrorsFound = true;
+				GetOutsideAirSysInputsErrorsFound = true;
 				if ( IsBlank ) AlphArray( 2 ) = "xxxxx";
 			}
 			ControllerListName = AlphArray( 2 );
@@ -1106,11 +1151,11 @@ namespace MixedAir {
 					}
 				} else {
 					ShowSevereError( CurrentModuleObject + " = \"" + AlphArray( 1 ) + "\" invalid " + cAlphaFields( 3 ) + "=\"" + AlphArray( 3 ) + "\" not found." );
-					ErrorsFound = true;
+					GetOutsideAirSysInputsErrorsFound = true;
 				}
 			} else {
 				ShowSevereError( CurrentModuleObject + " = \"" + AlphArray( 1 ) + "\" invalid " + cAlphaFields( 3 ) + " is blank and must be entered." );
-				ErrorsFound = true;
+				GetOutsideAirSysInputsErrorsFound = true;
 			}
 
 			ListNum = 0;
@@ -1133,11 +1178,11 @@ namespace MixedAir {
 					}
 				} else {
 					ShowSevereError( CurrentModuleObject + " = \"" + AlphArray( 1 ) + "\" invalid " + cAlphaFields( 2 ) + "=\"" + AlphArray( 2 ) + "\" not found." );
-					ErrorsFound = true;
+					GetOutsideAirSysInputsErrorsFound = true;
 				}
 			} else {
 				ShowSevereError( CurrentModuleObject + " = \"" + AlphArray( 1 ) + "\" invalid " + cAlphaFields( 2 ) + " is blank and must be entered." );
-				ErrorsFound = true;
+				GetOutsideAirSysInputsErrorsFound = true;
 			}
 			OutsideAirSys( OASysNum ).ControllerListNum = ListNum;
 			OutsideAirSys( OASysNum ).NumSimpleControllers = NumSimpControllers;
@@ -1146,7 +1191,7 @@ namespace MixedAir {
 				ListNum = GetObjectItemNum( CurrentModuleObjects( CMO_SysAvailMgrList ), AvailManagerListName );
 				if ( ListNum <= 0 ) {
 					ShowSevereError( CurrentModuleObject + " = \"" + AlphArray( 1 ) + "\" invalid " + cAlphaFields( 4 ) + "=\"" + AlphArray( 4 ) + "\" not found." );
-					ErrorsFound = true;
+					GetOutsideAirSysInputsErrorsFound = true;
 				}
 			}
 		}
@@ -1232,14 +1277,14 @@ namespace MixedAir {
 					OutsideAirSys( OASysNum ).ComponentType_Num( CompNum ) = EvapCooler;
 				} else {
 					ShowSevereError( CurrentModuleObject + " = \"" + AlphArray( 1 ) + "\" invalid Outside Air Component=\"" + OutsideAirSys( OASysNum ).ComponentType( CompNum ) + "\"." );
-					ErrorsFound = true;
+					GetOutsideAirSysInputsErrorsFound = true;
 
 				}}
 			}
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetOutsideAirSysInputsErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in getting " + CurrentModuleObject + '.' );
 		}
 
@@ -1321,7 +1366,6 @@ namespace MixedAir {
 		Array1D_string cNumericFields; // Numeric field names
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static bool ErrorsFound( false ); // Flag identifying errors found during get input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int ZoneListNum; // Index to Zone List
@@ -1332,11 +1376,6 @@ namespace MixedAir {
 		int MaxNums; // Maximum numbers in multiple objects
 
 		int NumGroups; // Number of extensible input groups of the VentilationMechanical object
-		static int ObjIndex( 0 );
-		static int EquipListIndex( 0 );
-		static int EquipNum( 0 );
-		static int EquipListNum( 0 );
-		static int ADUNum( 0 );
 		int jZone;
 		int i;
 
@@ -1387,11 +1426,11 @@ namespace MixedAir {
 				IsBlank = false;
 				VerifyName( AlphArray( 1 ), OAController, OutAirNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetOAControllerInputsErrorsFound = true;
 					if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 				}
 
-				ProcessOAControllerInputs( CurrentModuleObject, OutAirNum, AlphArray, NumAlphas, NumArray, NumNums, lNumericBlanks, lAlphaBlanks, cAlphaFields, cNumericFields, ErrorsFound );
+				ProcessOAControllerInputs( CurrentModuleObject, OutAirNum, AlphArray, NumAlphas, NumArray, NumNums, lNumericBlanks, lAlphaBlanks, cAlphaFields, cNumericFields, GetOAControllerInputsErrorsFound );
 
 				// add applicable faults identifier to avoid string comparison at each time step
 				//  loop through each fault for each OA controller
@@ -1404,7 +1443,7 @@ namespace MixedAir {
 
 			} // LOOP FOR OutAirNum
 
-			if ( ErrorsFound ) {
+			if ( GetOAControllerInputsErrorsFound ) {
 				AlphArray.deallocate();
 				NumArray.deallocate();
 				lNumericBlanks.deallocate();
@@ -1480,7 +1519,7 @@ namespace MixedAir {
 				IsBlank = false;
 				VerifyName( AlphArray( 1 ), VentilationMechanical, VentMechNum - 1, ErrorInName, IsBlank, CurrentModuleObject + " Name" );
 				if ( ErrorInName ) {
-					ErrorsFound = true;
+					GetOAControllerInputsErrorsFound = true;
 					if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 				}
 
@@ -1491,7 +1530,7 @@ namespace MixedAir {
 					thisVentilationMechanical.SchPtr = GetScheduleIndex( AlphArray( 2 ) ); // convert schedule name to pointer
 					if ( thisVentilationMechanical.SchPtr == 0 ) {
 						ShowSevereError( CurrentModuleObject + "=\"" + AlphArray( 1 ) + "\" invalid " + cAlphaFields( 2 ) + "=\"" + AlphArray( 2 ) + "\" not found." );
-						ErrorsFound = true;
+						GetOAControllerInputsErrorsFound = true;
 					}
 				}
 
@@ -1503,7 +1542,7 @@ namespace MixedAir {
 				} else {
 					ShowSevereError( CurrentModuleObject + "=\"" + AlphArray( 1 ) + "\" invalid value " + cAlphaFields( 3 ) + "=\"" + AlphArray( 3 ) + "\"." );
 					ShowContinueError( "...Valid values are \"Yes\" or \"No\"." );
-					ErrorsFound = true;
+					GetOAControllerInputsErrorsFound = true;
 				}
 
 				// System outdoor air method
@@ -1517,40 +1556,40 @@ namespace MixedAir {
 					if ( ! Contaminant.CO2Simulation ) {
 						ShowSevereError( CurrentModuleObject + "=\"" + AlphArray( 1 ) + "\" valid " + cAlphaFields( 2 ) + "=\"" + AlphArray( 2 ) + "\" requires CO2 simulation." );
 						ShowContinueError( "The choice must be Yes for the field Carbon Dioxide Concentration in ZoneAirContaminantBalance" );
-						ErrorsFound = true;
+						GetOAControllerInputsErrorsFound = true;
 					}
 				} else if ( SELECT_CASE_var == "PROPORTIONALCONTROLBASEDONOCCUPANCYSCHEDULE" ) { // Proportional Control based on ASHRAE Standard 62.1-2004
 					thisVentilationMechanical.SystemOAMethod = SOAM_ProportionalControlSchOcc;
 					if ( ! Contaminant.CO2Simulation ) {
 						ShowSevereError( CurrentModuleObject + "=\"" + AlphArray( 1 ) + "\" valid " + cAlphaFields( 2 ) + "=\"" + AlphArray( 2 ) + "\" requires CO2 simulation." );
 						ShowContinueError( "The choice must be Yes for the field Carbon Dioxide Concentration in ZoneAirContaminantBalance" );
-						ErrorsFound = true;
+						GetOAControllerInputsErrorsFound = true;
 					}
 				} else if ( SELECT_CASE_var == "PROPORTIONALCONTROLBASEDONDESIGNOCCUPANCY" ) { // Proportional Control based on ASHRAE Standard 62.1-2004
 					thisVentilationMechanical.SystemOAMethod = SOAM_ProportionalControlDesOcc;
 					if ( !Contaminant.CO2Simulation ) {
 						ShowSevereError( CurrentModuleObject + "=\"" + AlphArray( 1 ) + "\" valid " + cAlphaFields( 2 ) + "=\"" + AlphArray( 2 ) + "\" requires CO2 simulation." );
 						ShowContinueError( "The choice must be Yes for the field Carbon Dioxide Concentration in ZoneAirContaminantBalance" );
-						ErrorsFound = true;
+						GetOAControllerInputsErrorsFound = true;
 					}
 				} else if ( SELECT_CASE_var == "INDOORAIRQUALITYPROCEDUREGENERICCONTAMINANT" ) { // Indoor Air Quality Procedure based on generic contaminant setpoint
 					thisVentilationMechanical.SystemOAMethod = SOAM_IAQPGC;
 					if ( ! Contaminant.GenericContamSimulation ) {
 						ShowSevereError( CurrentModuleObject + "=\"" + AlphArray( 1 ) + "\" valid " + cAlphaFields( 2 ) + "=\"" + AlphArray( 2 ) + "\" requires generic contaminant simulation." );
 						ShowContinueError( "The choice must be Yes for the field Generic Contaminant Concentration in ZoneAirContaminantBalance" );
-						ErrorsFound = true;
+						GetOAControllerInputsErrorsFound = true;
 					}
 				} else if ( SELECT_CASE_var == "INDOORAIRQUALITYPROCEDURECOMBINED" ) { // Indoor Air Quality Procedure based on both generic contaminant and CO2 setpoint
 					thisVentilationMechanical.SystemOAMethod = SOAM_IAQPCOM;
 					if ( ! Contaminant.GenericContamSimulation ) {
 						ShowSevereError( CurrentModuleObject + "=\"" + AlphArray( 1 ) + "\" valid " + cAlphaFields( 2 ) + "=\"" + AlphArray( 2 ) + "\" requires generic contaminant simulation." );
 						ShowContinueError( "The choice must be Yes for the field Generic Contaminant Concentration in ZoneAirContaminantBalance" );
-						ErrorsFound = true;
+						GetOAControllerInputsErrorsFound = true;
 					}
 					if ( ! Contaminant.CO2Simulation ) {
 						ShowSevereError( CurrentModuleObject + "=\"" + AlphArray( 1 ) + "\" valid " + cAlphaFields( 2 ) + "=\"" + AlphArray( 2 ) + "\" requires CO2 simulation." );
 						ShowContinueError( "The choice must be Yes for the field Carbon Dioxide Concentration in ZoneAirContaminantBalance" );
-						ErrorsFound = true;
+						GetOAControllerInputsErrorsFound = true;
 					}
 				} else { // If specified incorrectly, show errors
 					thisVentilationMechanical.SystemOAMethod = SOAM_ZoneSum;
@@ -1581,7 +1620,7 @@ namespace MixedAir {
 						if ( ObjIndex == 0 ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + thisVentilationMechanical.Name + "\", invalid" );
 							ShowContinueError( "... not found " + cAlphaFields( ( groupNum - 1 ) * 3 + 6 ) + "=\"" + DesignSpecOAObjName( groupNum ) + "\"." );
-							ErrorsFound = true;
+							GetOAControllerInputsErrorsFound = true;
 						}
 					}
 
@@ -1595,7 +1634,7 @@ namespace MixedAir {
 							// Cannot find the design specification Zone Air Distribution object
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + thisVentilationMechanical.Name + "\", invalid" );
 							ShowContinueError( "... not found " + cAlphaFields( ( groupNum - 1 ) * 3 + 7 ) + "=\"" + DesignSpecZoneADObjName( groupNum ) + "\"." );
-							ErrorsFound = true;
+							GetOAControllerInputsErrorsFound = true;
 						}
 					}
 
@@ -1609,7 +1648,7 @@ namespace MixedAir {
 						} else {
 							ShowWarningError( CurrentModuleObject + "=\"" + AlphArray( 1 ) + "\" invalid " + cAlphaFields( ( groupNum - 1 ) * 3 + 5 ) + " not found." );
 							ShowContinueError( "Missing " + cAlphaFields( ( groupNum - 1 ) * 3 + 5 ) + " = " + VentMechZoneOrListName( groupNum ) );
-							ErrorsFound = true;
+							GetOAControllerInputsErrorsFound = true;
 						}
 					}
 				}
@@ -1852,13 +1891,13 @@ namespace MixedAir {
 						ShowSevereError( CurrentModuleObject + "=\"" + thisVentilationMechanical.Name + "\", invalid Outdoor Air flow per area" );
 						ShowContinueError( "For Zone=\"" + thisVentilationMechanical.VentMechZoneName( jZone ) + "\"." );
 						ShowContinueError( "invalid Outdoor Air flow per area specified in object=\"" + thisVentilationMechanical.ZoneDesignSpecOAObjName( jZone ) + "\". Value must be >= 0.0." );
-						ErrorsFound = true;
+						GetOAControllerInputsErrorsFound = true;
 					}
 					if ( thisVentilationMechanical.ZoneOAPeopleRate( jZone ) < 0.0 ) {
 						ShowSevereError( CurrentModuleObject + "=\"" + thisVentilationMechanical.Name + "\", invalid Outdoor Air flow per person" );
 						ShowContinueError( "For Zone=\"" + thisVentilationMechanical.VentMechZoneName( jZone ) + "\"." );
 						ShowContinueError( "invalid Outdoor Air flow per person specified in object \"" + thisVentilationMechanical.ZoneDesignSpecOAObjName( jZone ) + "\". Value must be >= 0.0." );
-						ErrorsFound = true;
+						GetOAControllerInputsErrorsFound = true;
 					}
 				}
 			}
@@ -1870,7 +1909,7 @@ namespace MixedAir {
 					ShowSevereError( CurrentModuleObject + "=\"" + OAController( OAControllerNum ).VentilationMechanicalName + "\", non-match to Controller:OutdoorAir" );
 					ShowContinueError( "Invalid specified in Controller:OutdoorAir object = " + OAController( OAControllerNum ).Name );
 					ShowContinueError( CurrentModuleObject + " object name must match the " + CurrentModuleObject + " object name specified in Controller:OutdoorAir." );
-					ErrorsFound = true;
+					GetOAControllerInputsErrorsFound = true;
 				}
 			}
 
@@ -1920,7 +1959,7 @@ namespace MixedAir {
 		cAlphaFields.deallocate();
 		cNumericFields.deallocate();
 
-		if ( ErrorsFound ) {
+		if ( GetOAControllerInputsErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found when getting " + CurrentModuleObject + " inputs." );
 		}
 
@@ -1993,7 +2032,6 @@ namespace MixedAir {
 		Array1D_string cNumericFields; // Numeric field names
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 
@@ -2022,39 +2060,39 @@ namespace MixedAir {
 				IsBlank = false;
 				VerifyName( AlphArray( 1 ), OAMixer, OutAirNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetOAMixerInputsErrorsFound = true;
 					if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 				}
 				OAMixer( OutAirNum ).Name = AlphArray( 1 );
-				OAMixer( OutAirNum ).MixNode = GetOnlySingleNode( AlphArray( 2 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+				OAMixer( OutAirNum ).MixNode = GetOnlySingleNode( AlphArray( 2 ), GetOAMixerInputsErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 				//  Set connection type to 'Inlet', because this is not necessarily directly from
 				//  outside air.  Outside Air Inlet Node List will set the connection to outside air
-				OAMixer( OutAirNum ).InletNode = GetOnlySingleNode( AlphArray( 3 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-				OAMixer( OutAirNum ).RelNode = GetOnlySingleNode( AlphArray( 4 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_ReliefAir, 1, ObjectIsNotParent );
-				OAMixer( OutAirNum ).RetNode = GetOnlySingleNode( AlphArray( 5 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+				OAMixer( OutAirNum ).InletNode = GetOnlySingleNode( AlphArray( 3 ), GetOAMixerInputsErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+				OAMixer( OutAirNum ).RelNode = GetOnlySingleNode( AlphArray( 4 ), GetOAMixerInputsErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_ReliefAir, 1, ObjectIsNotParent );
+				OAMixer( OutAirNum ).RetNode = GetOnlySingleNode( AlphArray( 5 ), GetOAMixerInputsErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
 				// Check for dupes in the four nodes.
 				if ( OAMixer( OutAirNum ).MixNode == OAMixer( OutAirNum ).InletNode ) {
 					ShowSevereError( CurrentModuleObject + " = " + OAMixer( OutAirNum ).Name + ' ' + cAlphaFields( 3 ) + " = " + NodeID( OAMixer( OutAirNum ).InletNode ) + " duplicates the " + cAlphaFields( 2 ) + '.' );
-					ErrorsFound = true;
+					GetOAMixerInputsErrorsFound = true;
 				} else if ( OAMixer( OutAirNum ).MixNode == OAMixer( OutAirNum ).RelNode ) {
 					ShowSevereError( CurrentModuleObject + " = " + OAMixer( OutAirNum ).Name + ' ' + cAlphaFields( 4 ) + " = " + NodeID( OAMixer( OutAirNum ).RelNode ) + " duplicates the " + cAlphaFields( 2 ) + '.' );
-					ErrorsFound = true;
+					GetOAMixerInputsErrorsFound = true;
 				} else if ( OAMixer( OutAirNum ).MixNode == OAMixer( OutAirNum ).RetNode ) {
 					ShowSevereError( CurrentModuleObject + " = " + OAMixer( OutAirNum ).Name + ' ' + cAlphaFields( 5 ) + " = " + NodeID( OAMixer( OutAirNum ).RetNode ) + " duplicates the " + cAlphaFields( 2 ) + '.' );
-					ErrorsFound = true;
+					GetOAMixerInputsErrorsFound = true;
 				}
 
 				if ( OAMixer( OutAirNum ).InletNode == OAMixer( OutAirNum ).RelNode ) {
 					ShowSevereError( CurrentModuleObject + " = " + OAMixer( OutAirNum ).Name + ' ' + cAlphaFields( 4 ) + " = " + NodeID( OAMixer( OutAirNum ).RelNode ) + " duplicates the " + cAlphaFields( 3 ) + '.' );
-					ErrorsFound = true;
+					GetOAMixerInputsErrorsFound = true;
 				} else if ( OAMixer( OutAirNum ).InletNode == OAMixer( OutAirNum ).RetNode ) {
 					ShowSevereError( CurrentModuleObject + " = " + OAMixer( OutAirNum ).Name + ' ' + cAlphaFields( 5 ) + " = " + NodeID( OAMixer( OutAirNum ).RetNode ) + " duplicates the " + cAlphaFields( 3 ) + '.' );
-					ErrorsFound = true;
+					GetOAMixerInputsErrorsFound = true;
 				}
 
 				if ( OAMixer( OutAirNum ).RelNode == OAMixer( OutAirNum ).RetNode ) {
 					ShowSevereError( CurrentModuleObject + " = " + OAMixer( OutAirNum ).Name + ' ' + cAlphaFields( 5 ) + " = " + NodeID( OAMixer( OutAirNum ).RetNode ) + " duplicates the " + cAlphaFields( 4 ) + '.' );
-					ErrorsFound = true;
+					GetOAMixerInputsErrorsFound = true;
 				}
 
 				TestCompSet( CurrentModuleObject, OAMixer( OutAirNum ).Name, AlphArray( 3 ), AlphArray( 2 ), "Air Nodes" );
@@ -2063,7 +2101,7 @@ namespace MixedAir {
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetOAMixerInputsErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in getting " + CurrentModuleObject );
 		}
 
@@ -2539,10 +2577,6 @@ namespace MixedAir {
 		using EMSManager::CheckIfNodeSetPointManagedByEMS;
 		using DataAirSystems::PrimaryAirSystem;
 
-		static Array1D_bool OAControllerMyOneTimeFlag; // One-time initialization flag
-		static Array1D_bool OAControllerMyEnvrnFlag; // One-time initialization flag
-		static Array1D_bool OAControllerMySizeFlag; // One-time initialization flag
-		static Array1D_bool MechVentCheckFlag; // One-time initialization flag
 		bool FoundZone; // Logical determines if ZONE object is accounted for in VENTILATION:MECHANICAL object
 		bool FoundAreaZone; // Logical determines if ZONE object is accounted for in VENTILATION:MECHANICAL object
 		bool FoundPeopleZone; // Logical determines if ZONE object is accounted for in VENTILATION:MECHANICAL object
@@ -3617,13 +3651,6 @@ namespace MixedAir {
 		Real64 ZoneContamControllerSched; // Schedule value for ZoneControl:ContaminantController
 		Real64 CO2PeopleGeneration; // CO2 generation from people at design level
 
-		static Real64 Ep( 1.0 ); // zone primary air fraction
-		static Real64 Er( 0.0 ); // zone secondary recirculation fraction
-		static Real64 Fa( 1.0 ); // temporary variable used in multi-path VRP calc
-		static Real64 Fb( 1.0 );
-		static Real64 Fc( 1.0 );
-		static Real64 Xs( 1.0 ); // uncorrected system outdoor air fraction
-		static Real64 Evz( 1.0 ); // zone ventilation efficiency
 
 		int PriNode; // primary node of zone terminal unit
 		int InletNode; // outlet node of zone terminal unit
@@ -4059,7 +4086,6 @@ namespace MixedAir {
 		Real64 EconomizerAirFlowScheduleValue; // value of economizer operation schedule (push-button type control schedule)
 		Real64 MaximumOAFracBySetPoint; // The maximum OA fraction due to freezing cooling coil check
 		Real64 OutAirSignal; // Used to set OA mass flow rate
-		static Array1D< Real64 > Par(4); // Par(1) = mixed air node number //Tuned Made static
 										 // Par(2) = return air node number
 										 // Par(3) = outside air node number
 										 // Par(4) = mixed air mass flow rate
@@ -4232,11 +4258,11 @@ namespace MixedAir {
 		// it was calculated using the approximate method of sensible energy balance. Now we have to get the
 		// accurate result using a full mass, enthalpy and moisture balance and iteration.
 		if ( OutAirSignal > OutAirMinFrac && OutAirSignal < 1.0 && this->MixMassFlow > VerySmallMassFlow && this->ControllerType_Num == ControllerOutsideAir && ! AirLoopNightVent ) {
-			Par( 1 ) = this->MixNode;
-			Par( 2 ) = this->RetNode;
-			Par( 3 ) = this->InletNode;
-			Par( 4 ) = this->MixMassFlow;
-			SolveRegulaFalsi( Acc, MaxIte, SolFla, OASignal, MixedAirControlTempResidual, OutAirMinFrac, 1.0, Par );
+			CalcOAEconomizerPar( 1 ) = this->MixNode;
+			CalcOAEconomizerPar( 2 ) = this->RetNode;
+			CalcOAEconomizerPar( 3 ) = this->InletNode;
+			CalcOAEconomizerPar( 4 ) = this->MixMassFlow;
+			SolveRegulaFalsi( Acc, MaxIte, SolFla, OASignal, MixedAirControlTempResidual, OutAirMinFrac, 1.0, CalcOAEconomizerPar, "CalcOAEconomizer" );
 			if ( SolFla < 0 ) {
 				OASignal = OutAirSignal;
 			}
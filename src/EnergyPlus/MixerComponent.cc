@@ -128,6 +128,7 @@ namespace MixerComponent {
 	namespace {
 		bool SimAirMixerInputFlag( true );
 		bool GetZoneMixerIndexInputFlag( true );
+		bool GetMixerInputErrorsFound( false );
 	}
 
 	// MODULE SUBROUTINES:
@@ -145,6 +146,7 @@ namespace MixerComponent {
 		SimAirMixerInputFlag = true;
 		CheckEquipName.deallocate();
 		MixerCond.deallocate();
+		GetMixerInputErrorsFound = false;
 	}
 
 	void
@@ -285,7 +287,6 @@ namespace MixerComponent {
 		int NumNums;
 		int NodeNum;
 		int IOStat;
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int NumParams;
@@ -321,12 +322,12 @@ namespace MixerComponent {
 			IsBlank = false;
 			VerifyName( AlphArray( 1 ), MixerCond, &MixerConditions::MixerName, MixerNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetMixerInputErrorsFound = true;
 				if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 			}
 			MixerCond( MixerNum ).MixerName = AlphArray( 1 );
 
-			MixerCond( MixerNum ).OutletNode = GetOnlySingleNode( AlphArray( 2 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			MixerCond( MixerNum ).OutletNode = GetOnlySingleNode( AlphArray( 2 ), GetMixerInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 			MixerCond( MixerNum ).NumInletNodes = NumAlphas - 2;
 
 			for ( auto & e : MixerCond ) e.InitFlag = true;
@@ -358,10 +359,10 @@ namespace MixerComponent {
 
 			for ( NodeNum = 1; NodeNum <= MixerCond( MixerNum ).NumInletNodes; ++NodeNum ) {
 
-				MixerCond( MixerNum ).InletNode( NodeNum ) = GetOnlySingleNode( AlphArray( 2 + NodeNum ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+				MixerCond( MixerNum ).InletNode( NodeNum ) = GetOnlySingleNode( AlphArray( 2 + NodeNum ), GetMixerInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
 				if ( lAlphaBlanks( 2 + NodeNum ) ) {
 					ShowSevereError( cAlphaFields( 2 + NodeNum ) + " is Blank, " + CurrentModuleObject + " = " + AlphArray( 1 ) );
-					ErrorsFound = true;
+					GetMixerInputErrorsFound = true;
 				}
 
 			}
@@ -376,7 +377,7 @@ namespace MixerComponent {
 				ShowSevereError( CurrentModuleObject + " = " + MixerCond( MixerNum ).MixerName + " specifies an inlet node name the same as the outlet node." );
 				ShowContinueError( ".." + cAlphaFields( 2 ) + " = " + NodeID( NodeNum ) );
 				ShowContinueError( "..Inlet Node #" + TrimSigDigits( InNodeNum1 ) + " is duplicate." );
-				ErrorsFound = true;
+				GetMixerInputErrorsFound = true;
 			}
 			for ( InNodeNum1 = 1; InNodeNum1 <= MixerCond( MixerNum ).NumInletNodes; ++InNodeNum1 ) {
 				for ( InNodeNum2 = InNodeNum1 + 1; InNodeNum2 <= MixerCond( MixerNum ).NumInletNodes; ++InNodeNum2 ) {
@@ -384,7 +385,7 @@ namespace MixerComponent {
 					ShowSevereError( CurrentModuleObject + " = " + MixerCond( MixerNum ).MixerName + " specifies duplicate inlet nodes in its inlet node list." );
 					ShowContinueError( "..Inlet Node #" + TrimSigDigits( InNodeNum1 ) + " Name=" + NodeID( InNodeNum1 ) );
 					ShowContinueError( "..Inlet Node #" + TrimSigDigits( InNodeNum2 ) + " is duplicate." );
-					ErrorsFound = true;
+					GetMixerInputErrorsFound = true;
 				}
 			}
 		}
@@ -396,7 +397,7 @@ namespace MixerComponent {
 		cNumericFields.deallocate();
 		lNumericBlanks.deallocate();
 
-		if ( ErrorsFound ) {
+		if ( GetMixerInputErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in getting input." );
 		}
 
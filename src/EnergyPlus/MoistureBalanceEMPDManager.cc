@@ -141,12 +141,28 @@ namespace MoistureBalanceEMPDManager {
 	// SUBROUTINE SPECIFICATION FOR MODULE MoistureBalanceEMPDManager
 	//******************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false ); // If errors detected in input
+		int ErrCount( 0 );
+		bool InitEnvrnFlag( true );
+		bool OneTimeFlag( true );
+	}
+
 	// Functions
 
 	void
 	clear_state()
 	{
 		EMPDReportVars.deallocate();
+		ErrorsFound = false;
+		ErrCount = 0;
+		InitEnvrnFlag = true;
+		OneTimeFlag = true;
 	}
 
 	Real64
@@ -227,7 +243,6 @@ namespace MoistureBalanceEMPDManager {
 		int MaterialNumAlpha; // Number of material alpha names being passed
 		int MaterialNumProp; // Number of material properties being passed
 		Array1D< Real64 > MaterialProps( 9 ); // Temporary array to transfer material properties
-		static bool ErrorsFound( false ); // If errors detected in input
 
 		int EMPDMat; // EMPD Moisture Material additional properties for each base material
 		int Loop;
@@ -236,7 +251,6 @@ namespace MoistureBalanceEMPDManager {
 		int MatNum; // Material number at interior layer
 		int ConstrNum; // Construction number
 		Array1D_bool EMPDzone; // EMPD property check for each zone
-		static int ErrCount( 0 );
 
 		// Load the additional EMPD Material properties
 		cCurrentModuleObject = "MaterialProperty:MoisturePenetrationDepth:Settings";
@@ -398,7 +412,6 @@ namespace MoistureBalanceEMPDManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ZoneNum;
 		int SurfNum;
-		static bool InitEnvrnFlag( true );
 
 		if ( InitEnvrnFlag ) {
 			RVSurfaceOld.allocate( TotSurfaces );
@@ -508,7 +521,6 @@ namespace MoistureBalanceEMPDManager {
 		Real64 RVaver; // Average zone vapor density
 		Real64 dU_dRH;
 		int Flag; // Convergence flag (0 - converged)
-		static bool OneTimeFlag( true );
 		Real64 PVsurf; // Surface vapor pressure
 		Real64 PV_surf_layer; // Vapor pressure of surface layer
 		Real64 PV_deep_layer;
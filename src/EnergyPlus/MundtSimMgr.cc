@@ -159,8 +159,49 @@ namespace MundtSimMgr {
 
 	// MODULE SUBROUTINES:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool FirstTimeFlag( true ); // Used for allocating arrays
+	}
+
 	// Functions
 
+	// Clears the global data in MundtSimMgr.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		FloorSurfSetIDs.deallocate();
+		TheseSurfIDs.deallocate();
+		MundtCeilAirID = 0;
+		MundtFootAirID = 0;
+		SupplyNodeID = 0;
+		TstatNodeID = 0;
+		ReturnNodeID = 0;
+		NumRoomNodes = 0;
+		NumFloorSurfs = 0;
+		RoomNodeIDs.deallocate();
+		ID1dSurf.deallocate();
+		MundtZoneNum = 0;
+		ZoneHeight = 0.0;
+		ZoneFloorArea = 0.0;
+		QventCool = 0.0;
+		ConvIntGain = 0.0;
+		SupplyAirTemp = 0.0;
+		SupplyAirVolumeRate = 0.0;
+		ZoneAirDensity = 0.0;
+		QsysCoolTot = 0.0;
+		ZoneData.deallocate();
+		LineNode.deallocate();
+		MundtAirSurf.deallocate();
+		FloorSurf.deallocate();
+		FirstTimeFlag = true;
+	}
+
 	void
 	ManageMundtModel( int const ZoneNum ) // index number for the specified zone
 	{
@@ -197,7 +238,6 @@ namespace MundtSimMgr {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		// na
-		static bool FirstTimeFlag( true ); // Used for allocating arrays
 		bool ErrorsFound;
 
 		// FLOW:
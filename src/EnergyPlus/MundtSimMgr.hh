@@ -176,6 +176,11 @@ namespace MundtSimMgr {
 
 	// Functions
 
+	// Clears the global data in MundtSimMgr.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	ManageMundtModel( int const ZoneNum ); // index number for the specified zone
 
@@ -145,6 +145,21 @@ namespace NodeInputManager {
 	Array1D< NodeListDef > NodeLists; // Node Lists
 	namespace {
 		bool CalcMoreNodeInfoMyOneTimeFlag( true ); // one time flag
+		int NumNode( 0 ); // Loop Variable
+		std::string cNodeFluidType;
+		Array1D_int NodeNums;
+		bool firstTime( true );
+		Real64 RhoAirStdInit;
+		Real64 RhoWaterStdInit;
+		Array1D_int NodeWetBulbSchedPtr;
+		Array1D_bool NodeRelHumidityRepReq;
+		Array1D_int NodeRelHumiditySchedPtr;
+		Array1D_bool NodeDewPointRepReq;
+		Array1D_int NodeDewPointSchedPtr;
+		Array1D_bool NodeSpecificHeatRepReq;
+		Array1D_int NodeSpecificHeatSchedPtr;
+		std::vector<std::string> nodeReportingStrings;
+		std::vector<std::string> nodeFluidNames;
 	}
 	// MODULE SUBROUTINES:
 	//*************************************************************************
@@ -168,6 +183,21 @@ namespace NodeInputManager {
 		MaxCheckNodes = 0;
 		NodeVarsSetup = false;
 		NodeLists.deallocate();
+		NumNode = 0;
+		cNodeFluidType.clear();
+		NodeNums.deallocate();
+		firstTime = true;
+		RhoAirStdInit = 0.0;
+		RhoWaterStdInit = 0.0;
+		NodeWetBulbSchedPtr.deallocate();
+		NodeRelHumidityRepReq.deallocate();
+		NodeRelHumiditySchedPtr.deallocate();
+		NodeDewPointRepReq.deallocate();
+		NodeDewPointSchedPtr.deallocate();
+		NodeSpecificHeatRepReq.deallocate();
+		NodeSpecificHeatSchedPtr.deallocate();
+		nodeReportingStrings.clear();
+		nodeFluidNames.clear();
 	}
 
 	void
@@ -713,8 +743,6 @@ namespace NodeInputManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int NumNode( 0 ); // Loop Variable
-		static std::string cNodeFluidType;
 
 		if ( NodeFluidType != NodeType_Air && NodeFluidType != NodeType_Water && NodeFluidType != NodeType_Electric && NodeFluidType != NodeType_Steam && NodeFluidType != NodeType_Unknown ) {
 			gio::write( cNodeFluidType, fmtLD ) << NodeFluidType;
@@ -825,10 +853,8 @@ namespace NodeInputManager {
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		int NumNodes;
-		static Array1D_int NodeNums;
 		int FluidType;
 		std::string ConnectionType;
-		static bool firstTime( true );
 		int NumParams;
 		int NumAlphas;
 		int NumNums;
@@ -1135,17 +1161,6 @@ namespace NodeInputManager {
 		int iNode; // node loop index
 		int iReq; // requested report variables loop index
 
-		static Real64 RhoAirStdInit;
-		static Real64 RhoWaterStdInit;
-		static Array1D_int NodeWetBulbSchedPtr;
-		static Array1D_bool NodeRelHumidityRepReq;
-		static Array1D_int NodeRelHumiditySchedPtr;
-		static Array1D_bool NodeDewPointRepReq;
-		static Array1D_int NodeDewPointSchedPtr;
-		static Array1D_bool NodeSpecificHeatRepReq;
-		static Array1D_int NodeSpecificHeatSchedPtr;
-		static std::vector<std::string> nodeReportingStrings;
-		static std::vector<std::string> nodeFluidNames;
 		bool ReportWetBulb;
 		bool ReportRelHumidity;
 		bool ReportDewPoint;
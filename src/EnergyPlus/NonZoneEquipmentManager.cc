@@ -89,8 +89,27 @@ namespace NonZoneEquipmentManager {
 
 	// MODULE SUBROUTINES:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int NumOfWaterHeater;
+		bool CountNonZoneEquip( true );
+	}
+
 	// Functions
 
+	// Clears the global data in NonZoneEquipmentManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumOfWaterHeater = 0;
+		CountNonZoneEquip = true;
+	}
+
 	void
 	ManageNonZoneEquipment(
 		bool const FirstHVACIteration,
@@ -130,8 +149,6 @@ namespace NonZoneEquipmentManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int WaterHeaterNum; // Water heater object number
-		static int NumOfWaterHeater;
-		static bool CountNonZoneEquip( true );
 
 		// FLOW:
 		if ( CountNonZoneEquip ) {
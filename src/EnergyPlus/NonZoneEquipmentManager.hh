@@ -74,6 +74,11 @@ namespace NonZoneEquipmentManager {
 
 	// Functions
 
+	// Clears the global data in NonZoneEquipmentManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	ManageNonZoneEquipment(
 		bool const FirstHVACIteration,
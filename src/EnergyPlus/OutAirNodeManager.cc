@@ -122,6 +122,18 @@ namespace OutAirNodeManager {
 
 	//SUBROUTINE SPECIFICATIONS FOR MODULE OutAirNodeManager
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int MaxNums( 0 ); // Maximum number of numeric input fields
+		int MaxAlphas( 0 ); // Maximum number of alpha input fields
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		bool errFlag( false );
+	}
+
 	// Functions
 
 	// Clears the global data in OutAirNodeManager.
@@ -132,6 +144,10 @@ namespace OutAirNodeManager {
 		OutsideAirNodeList.deallocate();
 		NumOutsideAirNodes = 0;
 		GetOutAirNodesInputFlag = true;
+		MaxNums = 0;
+		MaxAlphas = 0;
+		TotalArgs = 0;
+		errFlag = false;
 	}
 
 	void
@@ -235,9 +251,6 @@ namespace OutAirNodeManager {
 		Array1D< Real64 > Numbers; // Numeric input items for object
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int MaxNums( 0 ); // Maximum number of numeric input fields
-		static int MaxAlphas( 0 ); // Maximum number of alpha input fields
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 
 		NumOutAirInletNodeLists = GetNumObjectsFound( "OutdoorAir:NodeList" );
 		NumOutsideAirNodeSingles = GetNumObjectsFound( "OutdoorAir:Node" );
@@ -523,7 +536,6 @@ namespace OutAirNodeManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Array1D_int TmpNums;
 		int DummyNumber;
-		static bool errFlag( false );
 
 		if ( GetOutAirNodesInputFlag ) { // First time subroutine has been entered
 			GetOutAirNodesInput(); // Get Out Air Nodes data
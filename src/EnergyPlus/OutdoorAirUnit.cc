@@ -206,6 +206,19 @@ namespace OutdoorAirUnit {
 	namespace {
 		bool MyOneTimeFlag( true );
 		bool ZoneEquipmentListChecked( false );
+		bool ErrorsFound( false );
+		int MaxNums( 0 ); // Maximum number of numeric input fields
+		int MaxAlphas( 0 ); // Maximum number of alpha input fields
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		bool errFlag( false );
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool MyPlantScanFlag;
+		Array1D_bool MyZoneEqFlag; // used to set up zone equipment availability managers
+		int OperatingMode( 0 );
+		int UnitControlType( 0 );
+		int DXSystemIndex( 0 );
+		bool HeatActive( false );
+		bool CoolActive( false );
 	}
 
 	// Functions
@@ -222,6 +235,19 @@ namespace OutdoorAirUnit {
 		OutAirUnit.deallocate();
 		MyOneTimeFlag = true;
 		ZoneEquipmentListChecked = false;
+		ErrorsFound = false;
+		MaxNums = 0;
+		MaxAlphas = 0;
+		TotalArgs = 0;
+		errFlag = false;
+		MyEnvrnFlag.deallocate();
+		MyPlantScanFlag.deallocate();
+		MyZoneEqFlag.deallocate();
+		OperatingMode = 0;
+		UnitControlType = 0;
+		DXSystemIndex = 0;
+		HeatActive = false;
+		CoolActive = false;
 	}
 
 	void
@@ -400,12 +426,8 @@ namespace OutdoorAirUnit {
 		int NumInList;
 		int InListNum;
 		int ListNum;
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
-		static int MaxNums( 0 ); // Maximum number of numeric input fields
-		static int MaxAlphas( 0 ); // Maximum number of alpha input fields
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 		bool IsValid; // Set for outside air node check
 		Array1D_string cAlphaArgs; // Alpha input items for object
 		std::string CurrentModuleObject; // Object type for getting and messages
@@ -415,7 +437,6 @@ namespace OutdoorAirUnit {
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
 		Array1D< Real64 > NumArray;
 		Array1D_string AlphArray;
-		static bool errFlag( false );
 
 		// FLOW:
 		// Figure out how many outdoor air units there are in the input file
@@ -906,9 +927,6 @@ namespace OutdoorAirUnit {
 		// static bool MyOneTimeFlag( true );
 		// static bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
 		////////////////////////////////////////////////////////////////////////////////////
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool MyPlantScanFlag;
-		static Array1D_bool MyZoneEqFlag; // used to set up zone equipment availability managers
 		int InNode; // inlet node number in outdoor air unit
 		int OutNode; // outlet node number in outdoor air unit
 		int OutsideAirNode; // outside air node number outdoor air unit
@@ -1397,8 +1415,6 @@ namespace OutdoorAirUnit {
 		Real64 LoCtrlTemp; // Current low point in setpoint temperature range
 		Real64 AirInEnt; // RE-calcualte the Enthalpy of supply air
 		Real64 AirOutletTemp;
-		static int OperatingMode( 0 );
-		static int UnitControlType( 0 );
 		Real64 ZoneSupAirEnt; // Specific humidity ratio of inlet air (kg moisture / kg moist air)
 		// Latent output
 		Real64 LatentOutput; // Latent (moisture) add/removal rate, negative is dehumidification [kg/s]
@@ -1750,13 +1766,10 @@ namespace OutdoorAirUnit {
 		int WHCoilInletNode;
 		int WHCoilOutletNode;
 		Real64 QUnitOut;
-		static int DXSystemIndex( 0 );
 		Real64 CompAirOutTemp;
 		Real64 FanEffect;
 		bool DrawFan; // fan position If .True., the temperature increasing by fan operating is considered
 		Real64 Dxsystemouttemp;
-		static bool HeatActive( false );
-		static bool CoolActive( false );
 
 		// Flow!
 		UnitNum = OAUnitNum;
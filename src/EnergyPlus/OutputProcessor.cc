@@ -275,6 +275,38 @@ namespace OutputProcessor {
 		Real64 LEndMin( -1.0 ); // Helps set minutes for timestamp output
 		bool GetMeterIndexFirstCall( true ); //trigger setup in GetMeterIndex
 		bool InitFlag( true );
+		bool GetInputFlag( true );
+		bool GetReportVariableInputErrorsFound( false ); // If errors detected in input
+		Array1D_string ZoneIndexTypes( 3 );
+		Array1D_string SystemIndexTypes( 3 );
+		bool Initialized( false );
+		Array1D_string StateVariables( 3 );
+		Array1D_string NonStateVariables( 4 );
+		bool ValidateVariableTypeInitialized( false );
+		Real64 rDummy1( 0.0 );
+		Real64 rDummy2( 0.0 );
+		int iDummy1( 0 );
+		int iDummy2( 0 );
+		Real64 ReportHRMeters_rDummy1( 0.0 );
+		Real64 ReportHRMeters_rDummy2( 0.0 );
+		int ReportHRMeters_iDummy1( 0 );
+		int ReportHRMeters_iDummy2( 0 );
+		int DetermineIndexGroupKeyFromMeterName_indexGroupKey( -1 );
+		bool SetupOutputVariableErrorsFound( false ); // True if Errors Found
+		std::string SetupOutputVariableUnitsString; // Units for Variable (no brackets)
+		std::string SetupOutputVariableUnitsString2; // Units for Variable (no brackets)
+		bool EndTimeStepFlag( false ); // True when it's the end of the Zone Time Step
+		bool Rept( false );
+		bool OpaqSurfWarned( false );
+		bool UpdateMeterReportingErrorsFound( false ); // If errors detected in input
+		Array1D_string ValidMeterNames;
+		Array1D_int iValidMeterNames;
+		int NumValidMeters( 0 );
+		Array1D_int GetVariableKeyCountandType_keyVarIndexes; // Array index for specific key name
+		int curKeyVarIndexLimit; // current limit for keyVarIndexes
+		Array1D_string varNames; // stored variable names
+		Array1D_int ivarNames; // pointers for sorted information
+		int numVarNames; // number of variable names
 	}
 
 	// All routines should be listed here whether private or not
@@ -379,6 +411,7 @@ namespace OutputProcessor {
 		GetMeterIndexFirstCall = true ;
 		InitFlag = true;
 		TimeValue.deallocate();
+		TimeValue.allocate( 2 );
 		RVariableTypes.deallocate();
 		IVariableTypes.deallocate();
 		DDVariableTypes.deallocate();
@@ -390,6 +423,38 @@ namespace OutputProcessor {
 		VarMeterArrays.deallocate();
 		EnergyMeters.deallocate();
 		EndUseCategory.deallocate();
+		GetInputFlag = true;
+		GetReportVariableInputErrorsFound = false;
+		ZoneIndexTypes = Array1D_string( 3 );
+		SystemIndexTypes = Array1D_string( 3 );
+		Initialized = false;
+		StateVariables = Array1D_string( 3 );
+		NonStateVariables = Array1D_string( 4 );
+		ValidateVariableTypeInitialized = false;
+		rDummy1 = 0.0;
+		rDummy2 = 0.0;
+		iDummy1 = 0;
+		iDummy2 = 0;
+		ReportHRMeters_rDummy1 = 0.0;
+		ReportHRMeters_rDummy2 = 0.0;
+		ReportHRMeters_iDummy1 = 0;
+		ReportHRMeters_iDummy2 = 0;
+		DetermineIndexGroupKeyFromMeterName_indexGroupKey = -1;
+		SetupOutputVariableErrorsFound = false;
+		SetupOutputVariableUnitsString.clear();
+		SetupOutputVariableUnitsString2.clear();
+		EndTimeStepFlag = false;
+		Rept = false;
+		OpaqSurfWarned = false;
+		UpdateMeterReportingErrorsFound = false;
+		ValidMeterNames.deallocate();
+		iValidMeterNames.deallocate();
+		NumValidMeters = 0;
+		GetVariableKeyCountandType_keyVarIndexes.deallocate();
+		curKeyVarIndexLimit = 0;
+		varNames.deallocate();
+		ivarNames.deallocate();
+		numVarNames = 0;
 	}
 
 	void
@@ -610,7 +675,6 @@ namespace OutputProcessor {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInputFlag( true );
 		int Item;
 		int Loop;
 		int Pos;
@@ -877,7 +941,6 @@ namespace OutputProcessor {
 		int NumNumbers;
 		int IOStat;
 		int Item;
-		static bool ErrorsFound( false ); // If errors detected in input
 		std::string cCurrentModuleObject;
 		Array1D_string cAlphaArgs( 4 );
 		Array1D_string cAlphaFieldNames( 4 );
@@ -927,7 +990,7 @@ namespace OutputProcessor {
 				ReqRepVars( Loop ).SchedPtr = GetScheduleIndex( ReqRepVars( Loop ).SchedName );
 				if ( ReqRepVars( Loop ).SchedPtr == 0 ) {
 					ShowSevereError( "GetReportVariableInput: " + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + ':' + ReqRepVars( Loop ).VarName + "\" invalid " + cAlphaFieldNames( 4 ) + "=\"" + ReqRepVars( Loop ).SchedName + "\" - not found." );
-					ErrorsFound = true;
+					GetReportVariableInputErrorsFound = true;
 				}
 			} else {
 				ReqRepVars( Loop ).SchedPtr = 0;
@@ -937,7 +1000,7 @@ namespace OutputProcessor {
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetReportVariableInputErrorsFound ) {
 			ShowFatalError( "GetReportVariableInput:" + cCurrentModuleObject + ": errors in input." );
 		}
 
@@ -1208,9 +1271,6 @@ namespace OutputProcessor {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static Array1D_string ZoneIndexTypes( 3 );
-		static Array1D_string SystemIndexTypes( 3 );
-		static bool Initialized( false );
 		int Item;
 
 		if ( ! Initialized ) {
@@ -1334,12 +1394,9 @@ namespace OutputProcessor {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static Array1D_string StateVariables( 3 );
-		static Array1D_string NonStateVariables( 4 );
-		static bool Initialized( false );
 		int Item;
 
-		if ( ! Initialized ) {
+		if ( ! ValidateVariableTypeInitialized ) {
 			StateVariables( 1 ) = "STATE";
 			StateVariables( 2 ) = "AVERAGE";
 			StateVariables( 3 ) = "AVERAGED";
@@ -1347,7 +1404,7 @@ namespace OutputProcessor {
 			NonStateVariables( 2 ) = "NONSTATE";
 			NonStateVariables( 3 ) = "SUM";
 			NonStateVariables( 4 ) = "SUMMED";
-			Initialized = true;
+			ValidateVariableTypeInitialized = true;
 		}
 
 		ValidateVariableType = 1;
@@ -3252,10 +3309,6 @@ namespace OutputProcessor {
 		int Loop; // Loop Control
 		bool PrintTimeStamp;
 		int CurDayType;
-		static Real64 rDummy1( 0.0 );
-		static Real64 rDummy2( 0.0 );
-		static int iDummy1( 0 );
-		static int iDummy2( 0 );
 		std::string cReportID;
 
 		PrintTimeStamp = true;
@@ -3340,10 +3393,6 @@ namespace OutputProcessor {
 		int Loop; // Loop Control
 		bool PrintTimeStamp;
 		int CurDayType;
-		static Real64 rDummy1( 0.0 );
-		static Real64 rDummy2( 0.0 );
-		static int iDummy1( 0 );
-		static int iDummy2( 0 );
 		std::string cReportID;
 
 		PrintTimeStamp = true;
@@ -3360,7 +3409,7 @@ namespace OutputProcessor {
 			}
 
 			if ( EnergyMeters( Loop ).RptHR ) {
-				WriteReportMeterData( EnergyMeters( Loop ).HRRptNum, EnergyMeters( Loop ).HRRptNumChr, EnergyMeters( Loop ).HRValue, ReportHourly, rDummy1, iDummy1, rDummy2, iDummy2, EnergyMeters( Loop ).RptHRFO ); //EnergyMeters(Loop)%HRMinVal, EnergyMeters(Loop)%HRMinValDate, & | EnergyMeters(Loop)%HRMaxVal, EnergyMeters(Loop)%HRMaxValDate, &
+				WriteReportMeterData( EnergyMeters( Loop ).HRRptNum, EnergyMeters( Loop ).HRRptNumChr, EnergyMeters( Loop ).HRValue, ReportHourly, ReportHRMeters_rDummy1, ReportHRMeters_iDummy1, ReportHRMeters_rDummy2, ReportHRMeters_iDummy2, EnergyMeters( Loop ).RptHRFO ); //EnergyMeters(Loop)%HRMinVal, EnergyMeters(Loop)%HRMinValDate, & | EnergyMeters(Loop)%HRMaxVal, EnergyMeters(Loop)%HRMaxValDate, &
 				EnergyMeters( Loop ).HRValue = 0.0;
 				EnergyMeters( Loop ).HRMinVal = MinSetValue;
 				EnergyMeters( Loop ).HRMaxVal = MaxSetValue;
@@ -4884,44 +4933,43 @@ namespace OutputProcessor {
 		// FUNCTION ARGUMENT DEFINITIONS:
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static int indexGroupKey( -1 );
 
 		// Facility indices are in the 100s
 		if ( has( meterName, "Electricity:Facility" ) ) {
-			indexGroupKey = 100;
+			DetermineIndexGroupKeyFromMeterName_indexGroupKey = 100;
 		} else if ( has( meterName, "Gas:Facility" ) ) {
-			indexGroupKey = 101;
+			DetermineIndexGroupKeyFromMeterName_indexGroupKey = 101;
 		} else if ( has( meterName, "DistricHeating:Facility" ) ) {
-			indexGroupKey = 102;
+			DetermineIndexGroupKeyFromMeterName_indexGroupKey = 102;
 		} else if ( has( meterName, "DistricCooling:Facility" ) ) {
-			indexGroupKey = 103;
+			DetermineIndexGroupKeyFromMeterName_indexGroupKey = 103;
 		} else if ( has( meterName, "ElectricityNet:Facility" ) ) {
-			indexGroupKey = 104;
+			DetermineIndexGroupKeyFromMeterName_indexGroupKey = 104;
 
 			// Building indices are in the 200s
 		} else if ( has( meterName, "Electricity:Building" ) ) {
-			indexGroupKey = 201;
+			DetermineIndexGroupKeyFromMeterName_indexGroupKey = 201;
 		} else if ( has( meterName, "Gas:Building" ) ) {
-			indexGroupKey = 202;
+			DetermineIndexGroupKeyFromMeterName_indexGroupKey = 202;
 
 			// HVAC indices are in the 300s
 		} else if ( has( meterName, "Electricity:HVAC" ) ) {
-			indexGroupKey = 301;
+			DetermineIndexGroupKeyFromMeterName_indexGroupKey = 301;
 
 			// InteriorLights:Electricity:Zone indices are in the 500s
 		} else if ( has( meterName, "InteriorLights:Electricity:Zone" ) ) {
-			indexGroupKey = 501;
+			DetermineIndexGroupKeyFromMeterName_indexGroupKey = 501;
 
 			// InteriorLights:Electricity indices are in the 400s
 		} else if ( has( meterName, "InteriorLights:Electricity" ) ) {
-			indexGroupKey = 401;
+			DetermineIndexGroupKeyFromMeterName_indexGroupKey = 401;
 
 			// Unknown items have negative indices
 		} else {
-			indexGroupKey = -11;
+			DetermineIndexGroupKeyFromMeterName_indexGroupKey = -11;
 		}
 
-		DetermineIndexGroupKeyFromMeterName = indexGroupKey;
+		DetermineIndexGroupKeyFromMeterName = DetermineIndexGroupKeyFromMeterName_indexGroupKey;
 
 		return DetermineIndexGroupKeyFromMeterName;
 
@@ -5117,11 +5165,9 @@ SetupOutputVariable(
 	std::string EndUseSub; // Will hold value of EndUseSubKey
 	std::string Group; // Will hold value of GroupKey
 	std::string ZoneName; // Will hold value of ZoneKey
-	static bool ErrorsFound( false ); // True if Errors Found
 	std::string::size_type Item;
 	std::string MtrUnits; // Units for Meter
 	bool ThisOneOnTheList;
-	static std::string UnitsString; // Units for Variable (no brackets)
 	int localIndexGroupKey;
 	bool invalidUnits;
 
@@ -5130,25 +5176,25 @@ SetupOutputVariable(
 	//! Errors are severe and fatal because should only be encountered during development.
 	Item = index( VariableName, '[' );
 	if ( Item != std::string::npos ) {
-		UnitsString = GetVariableUnitsString( VariableName );
-		strip( UnitsString );
+		SetupOutputVariableUnitsString = GetVariableUnitsString( VariableName );
+		strip( SetupOutputVariableUnitsString );
 		VarName = stripped( VariableName.substr( 0, Item ) );
 		//    VariableNamewithUnits=TRIM(VarName)//' ['//TRIM(UnitsString)//']'
 		// Check name length for variable name
 		invalidUnits = false;
-		if ( UnitsString[ 0 ] == '-' ) invalidUnits = true;
-		if ( SameString( UnitsString, "dimensionless" ) ) invalidUnits = true;
+		if ( SetupOutputVariableUnitsString[ 0 ] == '-' ) invalidUnits = true;
+		if ( SameString( SetupOutputVariableUnitsString, "dimensionless" ) ) invalidUnits = true;
 		if ( len( stripped( VariableName ) ) > MaxNameLength ) {
 			ShowSevereError( "Variable Name length (including units) [" + TrimSigDigits( len( stripped( VariableName ) ) ) + "] exceeds maximum=" + VariableName );
-			if ( invalidUnits ) ShowSevereError( "Variable has invalid units in call Variable=" + VariableName + ", Units=" + UnitsString );
+			if ( invalidUnits ) ShowSevereError( "Variable has invalid units in call Variable=" + VariableName + ", Units=" + SetupOutputVariableUnitsString );
 			ShowFatalError( "Program terminates." );
 		}
 		if ( invalidUnits ) {
-			ShowSevereError( "Variable has invalid units in call Variable=" + VariableName + ", Units=" + UnitsString );
+			ShowSevereError( "Variable has invalid units in call Variable=" + VariableName + ", Units=" + SetupOutputVariableUnitsString );
 			ShowFatalError( "Program terminates." );
 		}
 	} else { // no units
-		UnitsString = BlankString;
+		SetupOutputVariableUnitsString = BlankString;
 		VarName = stripped( VariableName );
 		//    VariableNamewithUnits=TRIM(VarName)//' ['//TRIM(UnitsString)//']'
 		if ( len( stripped( VariableName ) ) > MaxNameLength ) {
@@ -5219,7 +5265,7 @@ SetupOutputVariable(
 		IndexType = ValidateIndexType( IndexTypeKey, "SetupOutputVariable" );
 		VariableType = ValidateVariableType( VariableTypeKey );
 
-		AddToOutputVariableList( VarName, IndexType, VariableType, VarType_Real, UnitsString );
+		AddToOutputVariableList( VarName, IndexType, VariableType, VarType_Real, SetupOutputVariableUnitsString );
 		++NumTotalRVariable;
 
 		if ( ! OnMeter && ! ThisOneOnTheList ) continue;
@@ -5242,7 +5288,7 @@ SetupOutputVariable(
 		RVariableTypes( CV ).VarNameOnlyUC = MakeUPPERCase( VarName );
 		RVariableTypes( CV ).VarNameUC = MakeUPPERCase( RVariableTypes( CV ).VarName );
 		RVariableTypes( CV ).KeyNameOnlyUC = MakeUPPERCase( KeyedValue );
-		RVariableTypes( CV ).UnitsString = UnitsString;
+		RVariableTypes( CV ).UnitsString = SetupOutputVariableUnitsString;
 		AssignReportNumber( CurrentReportNumber );
 		gio::write( IDOut, fmtLD ) << CurrentReportNumber;
 		strip( IDOut );
@@ -5280,12 +5326,12 @@ SetupOutputVariable(
 				if ( VariableType == AveragedVar ) {
 					ShowSevereError( "Meters can only be \"Summed\" variables" );
 					ShowContinueError( "..reference variable=" + KeyedValue + ':' + VariableName );
-					ErrorsFound = true;
+					SetupOutputVariableErrorsFound = true;
 				} else {
 					MtrUnits = RVariableTypes( CV ).UnitsString;
-					ErrorsFound = false;
-					AttachMeters( MtrUnits, ResourceType, EndUse, EndUseSub, Group, ZoneName, CV, RVariable().MeterArrayPtr, ErrorsFound );
-					if ( ErrorsFound ) {
+					SetupOutputVariableErrorsFound = false;
+					AttachMeters( MtrUnits, ResourceType, EndUse, EndUseSub, Group, ZoneName, CV, RVariable().MeterArrayPtr, SetupOutputVariableErrorsFound );
+					if ( SetupOutputVariableErrorsFound ) {
 						ShowContinueError( "Invalid Meter spec for variable=" + KeyedValue + ':' + VariableName );
 						ErrorsLogged = true;
 					}
@@ -5382,7 +5428,6 @@ SetupOutputVariable(
 	int localIndexGroupKey;
 	bool ThisOneOnTheList;
 	bool invalidUnits;
-	static std::string UnitsString; // Units for Variable (no brackets)
 	int Loop;
 	int RepFreq;
 
@@ -5391,25 +5436,25 @@ SetupOutputVariable(
 	//! Errors are severe and fatal because should only be encountered during development.
 	Item = index( VariableName, '[' );
 	if ( Item != std::string::npos ) {
-		UnitsString = GetVariableUnitsString( VariableName );
-		strip( UnitsString );
+		SetupOutputVariableUnitsString2 = GetVariableUnitsString( VariableName );
+		strip( SetupOutputVariableUnitsString2 );
 		invalidUnits = false;
-		if ( UnitsString[ 0 ] == '-' ) invalidUnits = true;
-		if ( SameString( UnitsString, "dimensionless" ) ) invalidUnits = true;
+		if ( SetupOutputVariableUnitsString2[ 0 ] == '-' ) invalidUnits = true;
+		if ( SameString( SetupOutputVariableUnitsString2, "dimensionless" ) ) invalidUnits = true;
 		VarName = stripped( VariableName.substr( 0, Item ) );
 		//    VariableNamewithUnits=TRIM(VarName)//' ['//TRIM(UnitsString)//']'
 		// Check name length for variable name
 		if ( len( stripped( VariableName ) ) > MaxNameLength ) {
 			ShowSevereError( "Variable Name length (including units) [" + TrimSigDigits( len( stripped( VariableName ) ) ) + "] exceeds maximum=" + VariableName );
-			if ( invalidUnits ) ShowSevereError( "Variable has invalid units in call Variable=" + VariableName + ", Units=" + UnitsString );
+			if ( invalidUnits ) ShowSevereError( "Variable has invalid units in call Variable=" + VariableName + ", Units=" + SetupOutputVariableUnitsString2 );
 			ShowFatalError( "Program terminates." );
 		}
 		if ( invalidUnits ) {
-			ShowSevereError( "Variable has invalid units in call Variable=" + VariableName + ", Units=" + UnitsString );
+			ShowSevereError( "Variable has invalid units in call Variable=" + VariableName + ", Units=" + SetupOutputVariableUnitsString2 );
 			ShowFatalError( "Program terminates." );
 		}
 	} else {
-		UnitsString = BlankString;
+		SetupOutputVariableUnitsString2 = BlankString;
 		VarName = stripped( VariableName );
 		//    VariableNamewithUnits=TRIM(VarName)//' ['//TRIM(UnitsString)//']'
 		if ( len( stripped( VariableName ) ) > MaxNameLength ) {
@@ -5447,7 +5492,7 @@ SetupOutputVariable(
 		IndexType = ValidateIndexType( IndexTypeKey, "SetupOutputVariable" );
 		VariableType = ValidateVariableType( VariableTypeKey );
 
-		AddToOutputVariableList( VarName, IndexType, VariableType, VarType_Integer, UnitsString );
+		AddToOutputVariableList( VarName, IndexType, VariableType, VarType_Integer, SetupOutputVariableUnitsString2 );
 		++NumTotalIVariable;
 
 		if ( ! ThisOneOnTheList ) continue;
@@ -5466,7 +5511,7 @@ SetupOutputVariable(
 		IVariableTypes( CV ).VarName = KeyedValue + ':' + VarName;
 		IVariableTypes( CV ).VarNameOnly = VarName;
 		IVariableTypes( CV ).VarNameUC = MakeUPPERCase( IVariableTypes( CV ).VarName );
-		IVariableTypes( CV ).UnitsString = UnitsString;
+		IVariableTypes( CV ).UnitsString = SetupOutputVariableUnitsString2;
 		AssignReportNumber( CurrentReportNumber );
 		gio::write( IDOut, fmtLD ) << CurrentReportNumber;
 		strip( IDOut );
@@ -5646,7 +5691,6 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 	// static Real64 LStartMin( -1.0 ); // Helps set minutes for timestamp output
 	// static Real64 LEndMin( -1.0 ); // Helps set minutes for timestamp output
 	////////////////////////////////////////////////////////////////////////////////////
-	static bool EndTimeStepFlag( false ); // True when it's the end of the Zone Time Step
 	Real64 rxTime; // (MinuteNow-StartMinute)/REAL(MinutesPerTimeStep,r64) - for execution time
 
 	IndexType = IndexTypeKey;
@@ -6159,9 +6203,7 @@ GenOutputVariablesAuditReport()
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	static bool Rept( false );
 	int Loop;
-	static bool OpaqSurfWarned( false );
 
 	for ( Loop = 1; Loop <= NumOfReqVariables; ++Loop ) {
 		if ( ReqRepVars( Loop ).Used ) continue;
@@ -6278,10 +6320,9 @@ UpdateMeterReporting()
 	int ReportFreq;
 	bool NeverFound;
 
-	static bool ErrorsFound( false ); // If errors detected in input
 
-	GetCustomMeterInput( ErrorsFound );
-	if ( ErrorsFound ) {
+	GetCustomMeterInput( UpdateMeterReportingErrorsFound );
+	if ( UpdateMeterReportingErrorsFound ) {
 		ErrorsLogged = true;
 	}
 
@@ -6704,9 +6745,6 @@ GetMeterIndex( std::string const & MeterName )
 
 	// FUNCTION LOCAL VARIABLE DECLARATIONS:
 	// Valid Meter names because matching case insensitive
-	static Array1D_string ValidMeterNames;
-	static Array1D_int iValidMeterNames;
-	static int NumValidMeters( 0 );
 	//////////// hoisted into namespace changed to GetMeterIndexFirstCall////////////
 	// static bool FirstCall( true );
 	////////////////////////////////////////////////
@@ -7438,8 +7476,6 @@ GetVariableKeyCountandType(
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	static Array1D_int keyVarIndexes; // Array index for specific key name
-	static int curKeyVarIndexLimit; // current limit for keyVarIndexes
 	//////////// hoisted into namespace ////////////////////////////////////////////////
 	// static bool InitFlag( true ); // for initting the keyVarIndexes array
 	////////////////////////////////////////////////////////////////////////////////////
@@ -7451,14 +7487,11 @@ GetVariableKeyCountandType(
 	bool Duplicate; // True if keyname is a duplicate
 	std::string VarKeyPlusName; // Full variable name including keyname and units
 	std::string varNameUpper; // varName pushed to all upper case
-	static Array1D_string varNames; // stored variable names
-	static Array1D_int ivarNames; // pointers for sorted information
-	static int numVarNames; // number of variable names
 
 	// INITIALIZATIONS
 	if ( InitFlag ) {
 		curKeyVarIndexLimit = 1000;
-		keyVarIndexes.allocate( curKeyVarIndexLimit );
+		GetVariableKeyCountandType_keyVarIndexes.allocate( curKeyVarIndexLimit );
 		numVarNames = NumVariablesForOutput;
 		varNames.allocate( numVarNames );
 		for ( Loop = 1; Loop <= NumVariablesForOutput; ++Loop ) {
@@ -7479,7 +7512,7 @@ GetVariableKeyCountandType(
 		SetupAndSort( varNames, ivarNames );
 	}
 
-	keyVarIndexes = 0;
+	GetVariableKeyCountandType_keyVarIndexes = 0;
 	varType = VarType_NotFound;
 	numKeys = 0;
 	varAvgSum = 0;
@@ -7509,14 +7542,14 @@ GetVariableKeyCountandType(
 					// combination is requested more than once in the idf at different reporting
 					// frequencies
 					for ( Loop2 = 1; Loop2 <= numKeys; ++Loop2 ) {
-						if ( VarKeyPlusName == IVariableTypes( keyVarIndexes( Loop2 ) ).VarNameUC ) Duplicate = true;
+						if ( VarKeyPlusName == IVariableTypes( GetVariableKeyCountandType_keyVarIndexes( Loop2 ) ).VarNameUC ) Duplicate = true;
 					}
 					if ( ! Duplicate ) {
 						++numKeys;
 						if ( numKeys > curKeyVarIndexLimit ) {
-							keyVarIndexes.redimension( curKeyVarIndexLimit += 500, 0 );
+							GetVariableKeyCountandType_keyVarIndexes.redimension( curKeyVarIndexLimit += 500, 0 );
 						}
-						keyVarIndexes( numKeys ) = Loop;
+						GetVariableKeyCountandType_keyVarIndexes( numKeys ) = Loop;
 						varAvgSum = DDVariableTypes( ivarNames( VFound ) ).StoreType;
 						varStepType = DDVariableTypes( ivarNames( VFound ) ).IndexType;
 						varUnits = DDVariableTypes( ivarNames( VFound ) ).UnitsString;
@@ -7536,14 +7569,14 @@ GetVariableKeyCountandType(
 				// frequencies
 				VarKeyPlusName = RVariableTypes( Loop ).VarNameUC;
 				for ( Loop2 = 1; Loop2 <= numKeys; ++Loop2 ) {
-					if ( VarKeyPlusName == RVariableTypes( keyVarIndexes( Loop2 ) ).VarNameUC ) Duplicate = true;
+					if ( VarKeyPlusName == RVariableTypes( GetVariableKeyCountandType_keyVarIndexes( Loop2 ) ).VarNameUC ) Duplicate = true;
 				}
 				if ( ! Duplicate ) {
 					++numKeys;
 					if ( numKeys > curKeyVarIndexLimit ) {
-						keyVarIndexes.redimension( curKeyVarIndexLimit += 500, 0 );
+						GetVariableKeyCountandType_keyVarIndexes.redimension( curKeyVarIndexLimit += 500, 0 );
 					}
-					keyVarIndexes( numKeys ) = Loop;
+					GetVariableKeyCountandType_keyVarIndexes( numKeys ) = Loop;
 					varAvgSum = DDVariableTypes( ivarNames( VFound ) ).StoreType;
 					varStepType = DDVariableTypes( ivarNames( VFound ) ).IndexType;
 					varUnits = DDVariableTypes( ivarNames( VFound ) ).UnitsString;
@@ -7556,12 +7589,12 @@ GetVariableKeyCountandType(
 	// Use the GetMeterIndex function
 	// Meters do not have keys, so only one will be found
 	if ( ! Found ) {
-		keyVarIndexes( 1 ) = GetMeterIndex( varName );
-		if ( keyVarIndexes( 1 ) > 0 ) {
+		GetVariableKeyCountandType_keyVarIndexes( 1 ) = GetMeterIndex( varName );
+		if ( GetVariableKeyCountandType_keyVarIndexes( 1 ) > 0 ) {
 			Found = true;
 			numKeys = 1;
 			varType = VarType_Meter;
-			varUnits = EnergyMeters( keyVarIndexes( 1 ) ).Units;
+			varUnits = EnergyMeters( GetVariableKeyCountandType_keyVarIndexes( 1 ) ).Units;
 			varAvgSum = SummedVar;
 			varStepType = ZoneVar;
 		}
@@ -7571,12 +7604,12 @@ GetVariableKeyCountandType(
 	// Use the GetScheduleIndex function
 	// Schedules do not have keys, so only one will be found
 	if ( ! Found ) {
-		keyVarIndexes( 1 ) = GetScheduleIndex( varName );
-		if ( keyVarIndexes( 1 ) > 0 ) {
+		GetVariableKeyCountandType_keyVarIndexes( 1 ) = GetScheduleIndex( varName );
+		if ( GetVariableKeyCountandType_keyVarIndexes( 1 ) > 0 ) {
 			Found = true;
 			numKeys = 1;
 			varType = VarType_Schedule;
-			varUnits = GetScheduleType( keyVarIndexes( 1 ) );
+			varUnits = GetScheduleType( GetVariableKeyCountandType_keyVarIndexes( 1 ) );
 			varAvgSum = AveragedVar;
 			varStepType = ZoneVar;
 		}
@@ -471,6 +471,14 @@ namespace OutputReportTabular {
 	Array1D< MonthlyInputType > MonthlyInput;
 	Array1D< MonthlyTablesType > MonthlyTables;
 	Array1D< MonthlyColumnsType > MonthlyColumns;
+	Array1D< MonthlyGatherType > MonthlyGatherZone; // monthly columns gathered each zone time step, in table order
+	Array1D< MonthlyGatherType > MonthlyGatherHVAC; // monthly columns gathered each HVAC time step, in table order
+	Array1D< BinGatherType > BinGatherZone; // binned variables gathered each zone time step
+	Array1D< BinGatherType > BinGatherHVAC; // binned variables gathered each HVAC time step
+	Array1D< MeterGatherType > BEPSGatherTotals; // meters added to gatherTotalsBEPS
+	Array1D< MeterGatherType > BEPSGatherEndUse; // meters added to gatherEndUseBEPS
+	Array1D< MeterGatherType > BEPSGatherEndUseSub; // meters added to gatherEndUseSubBEPS
+	Array1D< MeterGatherType > BEPSGatherSource; // meters added to gatherTotalsSource
 	Array1D< TOCEntriesType > TOCEntries;
 	Array1D< UnitConvType > UnitConv;
 
@@ -478,16 +486,117 @@ namespace OutputReportTabular {
 	static gio::Fmt fmtA( "(A)" );
 
 	namespace {
-		bool GatherMonthlyResultsForTimestepRunOnce( true );
 		bool UpdateTabularReportsGetInput( true );
 		bool GatherHeatGainReportfirstTime( true );
 		bool AllocateLoadComponentArraysDoAllocate( true );
+		bool ErrorsFound( false );
+		Real64 BigNum( 0.0 );
+		bool VarWarning( true );
+		int ErrCount1( 0 );
+		int ErrCount2( 0 );
+		int iZone( 0 );
+		int iRadiant( 0 );
+		int iunit( 0 );
+		int curZone( 0 );
+		Real64 eqpSens( 0.0 );
+		Real64 total( 0.0 );
+		Array1D< Real64 > radiantHeat;
+		Array1D< Real64 > radiantCool;
+		Array1D< Real64 > ATUHeat;
+		Array1D< Real64 > ATUCool;
+		int timestepTimeStamp( 0 );
+		Real64 bldgHtPk( 0.0 );
+		Real64 bldgClPk( 0.0 );
+		Real64 timeStepRatio( 0.0 );
+		int lineType( 0 );
+		int lineTypeinterim( 0 );
+		Real64 totalVolume( 0.0 );
+		int numUncondZones( 0 );
+		int numCondZones( 0 );
+		Real64 HrsPerWeek( 0.0 );
+		Real64 totalHvacHt( 0.0 );
+		Real64 totalHvacCl( 0.0 );
+		Real64 totalHvacATUHt( 0.0 );
+		Real64 totalHvacATUCl( 0.0 );
+		Real64 totalSurfHt( 0.0 );
+		Real64 totalSurfCl( 0.0 );
+		Real64 totalPeoplAdd( 0.0 );
+		Real64 totalLiteAdd( 0.0 );
+		Real64 totalEquipAdd( 0.0 );
+		Real64 totalWindAdd( 0.0 );
+		Real64 totalIzaAdd( 0.0 );
+		Real64 totalInfilAdd( 0.0 );
+		Real64 totalOtherAdd( 0.0 );
+		Real64 totalEquipRem( 0.0 );
+		Real64 totalWindRem( 0.0 );
+		Real64 totalIzaRem( 0.0 );
+		Real64 totalInfilRem( 0.0 );
+		Real64 totalOtherRem( 0.0 );
+		Real64 curConversionOffset( 0.0 );
+		Real64 leedSiteIntLite( 0.0 );
+		Real64 leedSiteSpHeat( 0.0 );
+		Real64 leedSiteSpCool( 0.0 );
+		Real64 leedSiteFanInt( 0.0 );
+		Real64 leedSiteSrvWatr( 0.0 );
+		Real64 leedSiteRecept( 0.0 );
+		Real64 leedSiteTotal( 0.0 );
+		std::string footnote;
+		std::string WriteCompCostTableSIunit;
+		std::string m2_unitName;
+		Real64 m2_unitConv( 0.0 );
+		int WriteCompCostTable_unitConvIndex( 0 );
+		std::string IPunitName;
+		int grandTotal( 1 );
+		int condTotal( 2 );
+		int uncondTotal( 3 );
+		int notpartTotal( 4 );
+		std::string WriteVeriSumTableSIunit;
+		int WriteVeriSumTable_unitConvIndex( 0 );
+		Real64 m_unitConv( 0.0 );
+		Real64 WriteVeriSumTable_m2_unitConv( 0.0 );
+		Real64 m3_unitConv( 0.0 );
+		Real64 Wm2_unitConv( 0.0 );
+		std::string m_unitName;
+		std::string WriteVeriSumTable_m2_unitName;
+		std::string m3_unitName;
+		std::string Wm2_unitName;
+		Array1D< Real64 > zstArea( 4 );
+		Array1D< Real64 > zstVolume( 4 );
+		Array1D< Real64 > zstWallArea( 4 );
+		Array1D< Real64 > zstUndWallArea( 4 );
+		Array1D< Real64 > zstWindowArea( 4 );
+		Array1D< Real64 > zstOpeningArea( 4 );
+		Array1D< Real64 > zstLight( 4 );
+		Array1D< Real64 > zstPeople( 4 );
+		Array1D< Real64 > zstPlug( 4 );
+		int numPeopleAdaptive( 0 );
+		std::string curColHeadWithSI;
+		std::string curColHead;
+		int indexUnitConv( 0 );
+		Real64 curValueSI( 0.0 );
+		Real64 curValue( 0.0 );
+		int ZoneNum( 0 );
+		int SurfNum( 0 );
+		int ComputeLoadComponentDecayCurveTimeStep( 0 );
+		int TimeOfPulse( 0 );
+		int CoolDesSelected( 0 ); // design day selected for cooling
+		int HeatDesSelected( 0 ); // design day selected for heating
+		int iSurf( 0 );
+		int GatherComponentLoadsSurfaceZoneNum( 0 );
+		int TimeStepInDay( 0 );
+		int GatherComponentLoadsHVAC_iZone( 0 );
+		int GatherComponentLoadsHVACTimeStepInDay( 0 );
+		Real64 ResetMonthlyGatheringBigNum( 0.0 );
+		Array1D< gio::Fmt > formDigits( {0,9}, { "(F12.0)", "(F12.1)", "(F12.2)", "(F12.3)", "(F12.4)", "(F12.5)", "(F12.6)", "(F12.7)", "(F12.8)", "(F12.9)" } ); // formDigits(0) | formDigits(1) | formDigits(2) | formDigits(3) | formDigits(4) | formDigits(5) | formDigits(6) | formDigits(7) | formDigits(8) | formDigits(9)
+		int found( 0 );
+		int iUnit( 0 );
+		int getSpecificUnitIndex_found( 0 );
+		int getSpecificUnitIndex_iUnit( 0 );
 	}
 
 	// Functions
 	void
 	clear_state(){
-		GatherMonthlyResultsForTimestepRunOnce =  true;
 		UpdateTabularReportsGetInput = true;
 		GatherHeatGainReportfirstTime = true;
 		AllocateLoadComponentArraysDoAllocate = true;
@@ -652,10 +761,121 @@ namespace OutputReportTabular {
 		MonthlyInput.deallocate();
 		MonthlyTables.deallocate();
 		MonthlyColumns.deallocate();
+		MonthlyGatherZone.deallocate();
+		MonthlyGatherHVAC.deallocate();
+		BinGatherZone.deallocate();
+		BinGatherHVAC.deallocate();
+		BEPSGatherTotals.deallocate();
+		BEPSGatherEndUse.deallocate();
+		BEPSGatherEndUseSub.deallocate();
+		BEPSGatherSource.deallocate();
 		TOCEntries.deallocate();
 		UnitConv.deallocate();
 
 		OutputReportTabular::ResetTabularReports();
+		ErrorsFound = false;
+		BigNum = 0.0;
+		VarWarning = true;
+		ErrCount1 = 0;
+		ErrCount2 = 0;
+		iZone = 0;
+		iRadiant = 0;
+		iunit = 0;
+		curZone = 0;
+		eqpSens = 0.0;
+		total = 0.0;
+		radiantHeat.deallocate();
+		radiantCool.deallocate();
+		ATUHeat.deallocate();
+		ATUCool.deallocate();
+		timestepTimeStamp = 0;
+		bldgHtPk = 0.0;
+		bldgClPk = 0.0;
+		timeStepRatio = 0.0;
+		lineType = 0;
+		lineTypeinterim = 0;
+		totalVolume = 0.0;
+		numUncondZones = 0;
+		numCondZones = 0;
+		HrsPerWeek = 0.0;
+		totalHvacHt = 0.0;
+		totalHvacCl = 0.0;
+		totalHvacATUHt = 0.0;
+		totalHvacATUCl = 0.0;
+		totalSurfHt = 0.0;
+		totalSurfCl = 0.0;
+		totalPeoplAdd = 0.0;
+		totalLiteAdd = 0.0;
+		totalEquipAdd = 0.0;
+		totalWindAdd = 0.0;
+		totalIzaAdd = 0.0;
+		totalInfilAdd = 0.0;
+		totalOtherAdd = 0.0;
+		totalEquipRem = 0.0;
+		totalWindRem = 0.0;
+		totalIzaRem = 0.0;
+		totalInfilRem = 0.0;
+		totalOtherRem = 0.0;
+		curConversionOffset = 0.0;
+		leedSiteIntLite = 0.0;
+		leedSiteSpHeat = 0.0;
+		leedSiteSpCool = 0.0;
+		leedSiteFanInt = 0.0;
+		leedSiteSrvWatr = 0.0;
+		leedSiteRecept = 0.0;
+		leedSiteTotal = 0.0;
+		footnote.clear();
+		WriteCompCostTableSIunit.clear();
+		m2_unitName.clear();
+		m2_unitConv = 0.0;
+		WriteCompCostTable_unitConvIndex = 0;
+		IPunitName.clear();
+		grandTotal = 1;
+		condTotal = 2;
+		uncondTotal = 3;
+		notpartTotal = 4;
+		WriteVeriSumTableSIunit.clear();
+		WriteVeriSumTable_unitConvIndex = 0;
+		m_unitConv = 0.0;
+		WriteVeriSumTable_m2_unitConv = 0.0;
+		m3_unitConv = 0.0;
+		Wm2_unitConv = 0.0;
+		m_unitName.clear();
+		WriteVeriSumTable_m2_unitName.clear();
+		m3_unitName.clear();
+		Wm2_unitName.clear();
+		zstArea = Array1D< Real64 >( 4 );
+		zstVolume = Array1D< Real64 >( 4 );
+		zstWallArea = Array1D< Real64 >( 4 );
+		zstUndWallArea = Array1D< Real64 >( 4 );
+		zstWindowArea = Array1D< Real64 >( 4 );
+		zstOpeningArea = Array1D< Real64 >( 4 );
+		zstLight = Array1D< Real64 >( 4 );
+		zstPeople = Array1D< Real64 >( 4 );
+		zstPlug = Array1D< Real64 >( 4 );
+		numPeopleAdaptive = 0;
+		curColHeadWithSI.clear();
+		curColHead.clear();
+		indexUnitConv = 0;
+		curValueSI = 0.0;
+		curValue = 0.0;
+		ZoneNum = 0;
+		SurfNum = 0;
+		ComputeLoadComponentDecayCurveTimeStep = 0;
+		TimeOfPulse = 0;
+		CoolDesSelected = 0;
+		HeatDesSelected = 0;
+		iSurf = 0;
+		GatherComponentLoadsSurfaceZoneNum = 0;
+		TimeStepInDay = 0;
+		GatherComponentLoadsHVAC_iZone = 0;
+		GatherComponentLoadsHVACTimeStepInDay = 0;
+		ResetMonthlyGatheringBigNum = 0.0;
+		formDigits = Array1D< gio::Fmt >( {0,9}, { "(F12.0)", "(F12.1)", "(F12.2)", "(F12.3)", "(F12.4)", "(F12.5)", "(F12.6)", "(F12.7)", "(F12.8)", "(F12.9)" } );
+		found = 0;
+		iUnit = 0;
+		getSpecificUnitIndex_found = 0;
+		getSpecificUnitIndex_iUnit = 0;
 	}
 
 	void
@@ -699,20 +919,7 @@ namespace OutputReportTabular {
 			ShowFatalError( "Invalid reporting requested -- UpdateTabularReports" );
 		}
 
-		if ( UpdateTabularReportsGetInput ) {
-			GetInputTabularMonthly();
-			OutputReportTabularAnnual::GetInputTabularAnnual();
-			GetInputTabularTimeBins();
-			GetInputTabularStyle();
-			GetInputOutputTableSummaryReports();
-			// noel -- noticed this was called once and very slow -- sped up a little by caching keys
-			InitializeTabularMonthly();
-			GetInputFuelAndPollutionFactors();
-			SetupUnitConversions();
-			AddTOCZoneLoadComponentTable();
-			UpdateTabularReportsGetInput = false;
-			date_and_time( _, _, _, td );
-		}
+		GetInputTabularReports();
 		if ( DoOutputReporting && WriteTabularFiles && ( KindOfSim == ksRunPeriodWeather ) ) {
 			if ( IndexTypeKey == stepTypeZone ) {
 				gatherElapsedTimeBEPS += TimeStepZone;
@@ -729,6 +936,35 @@ namespace OutputReportTabular {
 		}
 	}
 
+	void
+	GetInputTabularReports()
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Jason Glazer
+		//       DATE WRITTEN   July 2003
+		//       MODIFIED       October 2016, moved out of UpdateTabularReports
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Gets the input of the tabular reports and sets up their gathering the first time it is
+		// called.  A simulation resumed from a checkpoint calls it before restoring the gathered values.
+
+		if ( UpdateTabularReportsGetInput ) {
+			GetInputTabularMonthly();
+			OutputReportTabularAnnual::GetInputTabularAnnual();
+			GetInputTabularTimeBins();
+			GetInputTabularStyle();
+			GetInputOutputTableSummaryReports();
+			// noel -- noticed this was called once and very slow -- sped up a little by caching keys
+			InitializeTabularMonthly();
+			GetInputFuelAndPollutionFactors();
+			SetupUnitConversions();
+			AddTOCZoneLoadComponentTable();
+			UpdateTabularReportsGetInput = false;
+			date_and_time( _, _, _, td );
+		}
+	}
+
 	//======================================================================================================================
 	//======================================================================================================================
 
@@ -788,7 +1024,6 @@ namespace OutputReportTabular {
 		Array1D_string AlphArray; // character string data
 		Array1D< Real64 > NumArray; // numeric data
 		int IOStat; // IO Status when calling get input subroutine
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 
@@ -1052,11 +1287,7 @@ namespace OutputReportTabular {
 		int mColumn;
 		int ColumnsRecount;
 		int TablesRecount;
-		static Real64 BigNum( 0.0 );
 		bool environmentKeyFound;
-		static bool VarWarning( true );
-		static int ErrCount1( 0 );
-		static int ErrCount2( 0 );
 		//INTEGER       :: maxKeyCount
 
 		// if not a running a weather simulation do not create reports
@@ -1412,6 +1643,8 @@ namespace OutputReportTabular {
 		//DEALLOCATE(NamesOfKeys)
 		//DEALLOCATE(IndexesForKeyVar)
 		//#endif
+
+		SetupMonthlyGatherPlan();
 	}
 
 	void
@@ -1602,6 +1835,8 @@ namespace OutputReportTabular {
 			e.sum = 0.0;
 			e.sum2 = 0.0;
 		}
+
+		SetupBinGatherPlan();
 	}
 
 	bool
@@ -2210,6 +2445,7 @@ namespace OutputReportTabular {
 			gatherMains = 0.0;
 			gatherWaterEndUseTotal = 0.0;
 
+			SetupBEPSGatherPlan();
 		}
 	}
 
@@ -3675,6 +3911,275 @@ namespace OutputReportTabular {
 		}
 	}
 
+	void
+	SetupMonthlyGatherPlan()
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Lists the monthly columns gathered at each kind of time step so that
+		//   GatherMonthlyResultsForTimestep only visits the columns of that kind.
+
+		// METHODOLOGY EMPLOYED:
+		//   The columns keep their table order since the ValueWhenMaxMin and the
+		//   "during hours shown" columns are set from the columns ahead of them.
+		//   Real variables are read through their pointer each time step.
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int iTable; // loop variable for monthlyTables
+		int curCol;
+		int lastCol;
+		int numZone;
+		int numHVAC;
+
+		numZone = 0;
+		numHVAC = 0;
+		for ( iTable = 1; iTable <= MonthlyTablesCount; ++iTable ) {
+			lastCol = MonthlyTables( iTable ).firstColumn + MonthlyTables( iTable ).numColumns - 1;
+			for ( curCol = MonthlyTables( iTable ).firstColumn; curCol <= lastCol; ++curCol ) {
+				if ( MonthlyColumns( curCol ).stepType == stepTypeZone ) {
+					++numZone;
+				} else if ( MonthlyColumns( curCol ).stepType == stepTypeHVAC ) {
+					++numHVAC;
+				}
+			}
+		}
+		MonthlyGatherZone.allocate( numZone );
+		MonthlyGatherHVAC.allocate( numHVAC );
+
+		numZone = 0;
+		numHVAC = 0;
+		for ( iTable = 1; iTable <= MonthlyTablesCount; ++iTable ) {
+			lastCol = MonthlyTables( iTable ).firstColumn + MonthlyTables( iTable ).numColumns - 1;
+			for ( curCol = MonthlyTables( iTable ).firstColumn; curCol <= lastCol; ++curCol ) {
+				auto const & col( MonthlyColumns( curCol ) );
+				MonthlyGatherType * gather;
+				if ( col.stepType == stepTypeZone ) {
+					gather = &MonthlyGatherZone( ++numZone );
+				} else if ( col.stepType == stepTypeHVAC ) {
+					gather = &MonthlyGatherHVAC( ++numHVAC );
+				} else {
+					continue;
+				}
+				gather->table = iTable;
+				gather->column = curCol;
+				gather->lastColumn = lastCol;
+				gather->aggType = col.aggType;
+				gather->isSummed = ( col.avgSum == isSum );
+				gather->typeOfVar = col.typeOfVar;
+				gather->varNum = col.varNum;
+				gather->valuePtr = GetGatherValuePtr( col.typeOfVar, col.varNum );
+			}
+		}
+	}
+
+	void
+	SetupBinGatherPlan()
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Lists the binned variables gathered at each kind of time step together with
+		//   the interval limits and rounding of their bin object.
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int iInObj;
+		int jTable;
+		int repIndex;
+		int numZone;
+		int numHVAC;
+
+		numZone = 0;
+		numHVAC = 0;
+		for ( iInObj = 1; iInObj <= OutputTableBinnedCount; ++iInObj ) {
+			if ( OutputTableBinned( iInObj ).stepType == stepTypeZone ) {
+				numZone += OutputTableBinned( iInObj ).numTables;
+			} else if ( OutputTableBinned( iInObj ).stepType == stepTypeHVAC ) {
+				numHVAC += OutputTableBinned( iInObj ).numTables;
+			}
+		}
+		BinGatherZone.allocate( numZone );
+		BinGatherHVAC.allocate( numHVAC );
+
+		numZone = 0;
+		numHVAC = 0;
+		for ( iInObj = 1; iInObj <= OutputTableBinnedCount; ++iInObj ) {
+			auto const & binObj( OutputTableBinned( iInObj ) );
+			for ( jTable = 1; jTable <= binObj.numTables; ++jTable ) {
+				BinGatherType * gather;
+				if ( binObj.stepType == stepTypeZone ) {
+					gather = &BinGatherZone( ++numZone );
+				} else if ( binObj.stepType == stepTypeHVAC ) {
+					gather = &BinGatherHVAC( ++numHVAC );
+				} else {
+					break;
+				}
+				repIndex = binObj.resIndex + ( jTable - 1 );
+				gather->binObj = iInObj;
+				gather->repIndex = repIndex;
+				gather->intervalStart = binObj.intervalStart;
+				gather->intervalSize = binObj.intervalSize;
+				gather->topValue = binObj.intervalStart + binObj.intervalSize * binObj.intervalCount;
+				// the number of signficant digits used in the final output report
+				if ( binObj.intervalSize < 1 ) {
+					gather->roundFactor = 10000.0; // four significant digits
+				} else if ( binObj.intervalSize >= 10 ) {
+					gather->roundFactor = 1.0; // zero significant digits
+				} else {
+					gather->roundFactor = 100.0; // two significant digits
+				}
+				gather->isSummed = ( binObj.avgSum == isSum );
+				gather->typeOfVar = binObj.typeOfVar;
+				gather->varNum = BinObjVarID( repIndex ).varMeterNum;
+				gather->valuePtr = GetGatherValuePtr( binObj.typeOfVar, gather->varNum );
+			}
+		}
+	}
+
+	void
+	SetupBEPSGatherPlan()
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Lists the resource, end use, end use subcategory and source meters that exist
+		//   in the model with the gathering array entry each one is added to, so that
+		//   GatherBEPSResultsForTimestep does not scan the meter numbers that are zero.
+
+		// Using/Aliasing
+		using OutputProcessor::EndUseCategory;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int iResource;
+		int jEndUse;
+		int kEndUseSub;
+		int curMeterNumber;
+		int numTotals;
+		int numEndUse;
+		int numEndUseSub;
+		int numSource;
+
+		BEPSGatherTotals.allocate( numResourceTypes );
+		BEPSGatherEndUse.allocate( numResourceTypes * NumEndUses );
+		BEPSGatherEndUseSub.allocate( meterNumEndUseSubBEPS.isize() );
+		BEPSGatherSource.allocate( numSourceTypes );
+		numTotals = 0;
+		numEndUse = 0;
+		numEndUseSub = 0;
+		numSource = 0;
+
+		for ( iResource = 1; iResource <= numResourceTypes; ++iResource ) {
+			curMeterNumber = meterNumTotalsBEPS( iResource );
+			if ( curMeterNumber > 0 ) {
+				BEPSGatherTotals( ++numTotals ).meterNum = curMeterNumber;
+				BEPSGatherTotals( numTotals ).index = gatherTotalsBEPS.index( iResource );
+			}
+
+			for ( jEndUse = 1; jEndUse <= NumEndUses; ++jEndUse ) {
+				curMeterNumber = meterNumEndUseBEPS( iResource, jEndUse );
+				if ( curMeterNumber > 0 ) {
+					BEPSGatherEndUse( ++numEndUse ).meterNum = curMeterNumber;
+					BEPSGatherEndUse( numEndUse ).index = gatherEndUseBEPS.index( iResource, jEndUse );
+
+					for ( kEndUseSub = 1; kEndUseSub <= EndUseCategory( jEndUse ).NumSubcategories; ++kEndUseSub ) {
+						curMeterNumber = meterNumEndUseSubBEPS( kEndUseSub, jEndUse, iResource );
+						if ( curMeterNumber > 0 ) {
+							BEPSGatherEndUseSub( ++numEndUseSub ).meterNum = curMeterNumber;
+							BEPSGatherEndUseSub( numEndUseSub ).index = gatherEndUseSubBEPS.index( kEndUseSub, jEndUse, iResource );
+						}
+					}
+				}
+			}
+		}
+
+		for ( iResource = 1; iResource <= numSourceTypes; ++iResource ) {
+			curMeterNumber = meterNumTotalsSource( iResource );
+			if ( curMeterNumber > 0 ) {
+				BEPSGatherSource( ++numSource ).meterNum = curMeterNumber;
+				BEPSGatherSource( numSource ).index = gatherTotalsSource.index( iResource );
+			}
+		}
+
+		BEPSGatherTotals.redimension( numTotals );
+		BEPSGatherEndUse.redimension( numEndUse );
+		BEPSGatherEndUseSub.redimension( numEndUseSub );
+		BEPSGatherSource.redimension( numSource );
+	}
+
+	Real64 const *
+	GetGatherValuePtr(
+		int const typeOfVar, // 0=not found, 1=integer, 2=real, 3=meter
+		int const varNum // variable or meter number
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		//   Returns the location of a real report variable so the gathering routines can read
+		//   it directly. Other kinds of values and invalid indexes give null and are left to
+		//   GetInternalVariableValue.
+
+		// Using/Aliasing
+		using OutputProcessor::NumOfRVariable;
+		using OutputProcessor::RVariableTypes;
+
+		if ( typeOfVar != 2 || varNum < 1 || varNum > NumOfRVariable ) return nullptr;
+		// must use %Which, %Value is always zero if variable is not a requested report variable
+		return &RVariableTypes( varNum ).VarPtr().Which();
+	}
+
 	//======================================================================================================================
 	//======================================================================================================================
 
@@ -3714,101 +4219,79 @@ namespace OutputReportTabular {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int iInObj;
-		int jTable;
+		int jGather; // loop variable for the gathered variables
+		int curBinObj;
 		Real64 curValue;
-		// values of OutputTableBinned array for current index
-		Real64 curIntervalStart;
-		Real64 curIntervalSize;
-		int curIntervalCount;
-		int curResIndex;
-		int curNumTables;
-		int curTypeOfVar;
 		int curScheduleIndex;
 		Real64 elapsedTime;
 		bool gatherThisTime;
-		Real64 topValue;
 		int binNum;
 		int repIndex;
-		int curStepType;
 
 		//REAL(r64), external :: GetInternalVariableValue
 
 		if ( ! DoWeathSim ) return;
 		elapsedTime = TimeStepSys;
 		timeInYear += elapsedTime;
-		for ( iInObj = 1; iInObj <= OutputTableBinnedCount; ++iInObj ) {
-			// get values of array for current object being referenced
-			curIntervalStart = OutputTableBinned( iInObj ).intervalStart;
-			curIntervalSize = OutputTableBinned( iInObj ).intervalSize;
-			curIntervalCount = OutputTableBinned( iInObj ).intervalCount;
-			curResIndex = OutputTableBinned( iInObj ).resIndex;
-			curNumTables = OutputTableBinned( iInObj ).numTables;
-			topValue = curIntervalStart + curIntervalSize * curIntervalCount;
-			curTypeOfVar = OutputTableBinned( iInObj ).typeOfVar;
-			curStepType = OutputTableBinned( iInObj ).stepType;
-			curScheduleIndex = OutputTableBinned( iInObj ).scheduleIndex;
+		if ( ( IndexTypeKey != ZoneTSReporting ) && ( IndexTypeKey != HVACTSReporting ) ) return;
+		auto const & gatherPlan( ( IndexTypeKey == HVACTSReporting ) ? BinGatherHVAC : BinGatherZone );
+		// per MJW when a summed variable is used divide it by the length of the time step
+		if ( IndexTypeKey == HVACTSReporting ) {
+			elapsedTime = TimeStepSys;
+		} else {
+			elapsedTime = TimeStepZone;
+		}
+		curBinObj = 0;
+		gatherThisTime = false;
+		for ( jGather = 1; jGather <= gatherPlan.isize(); ++jGather ) {
+			auto const & gather( gatherPlan( jGather ) );
 			//if a schedule was used, check if it was non-zero value
-			if ( curScheduleIndex != 0 ) {
-				if ( GetCurrentScheduleValue( curScheduleIndex ) != 0.0 ) {
-					gatherThisTime = true;
+			if ( gather.binObj != curBinObj ) {
+				curBinObj = gather.binObj;
+				curScheduleIndex = OutputTableBinned( curBinObj ).scheduleIndex;
+				if ( curScheduleIndex != 0 ) {
+					gatherThisTime = ( GetCurrentScheduleValue( curScheduleIndex ) != 0.0 );
 				} else {
-					gatherThisTime = false;
+					gatherThisTime = true;
 				}
+			}
+			if ( ! gatherThisTime ) continue;
+			repIndex = gather.repIndex;
+			// put actual value from OutputProcesser arrays
+			if ( gather.valuePtr != nullptr ) {
+				curValue = *gather.valuePtr;
 			} else {
-				gatherThisTime = true;
-			}
-			if ( gatherThisTime ) {
-				for ( jTable = 1; jTable <= curNumTables; ++jTable ) {
-					repIndex = curResIndex + ( jTable - 1 );
-					if ( ( ( curStepType == stepTypeZone ) && ( IndexTypeKey == ZoneTSReporting ) ) || ( ( curStepType == stepTypeHVAC ) && ( IndexTypeKey == HVACTSReporting ) ) ) {
-						// put actual value from OutputProcesser arrays
-						curValue = GetInternalVariableValue( curTypeOfVar, BinObjVarID( repIndex ).varMeterNum );
-						// per MJW when a summed variable is used divide it by the length of the time step
-						if ( IndexTypeKey == HVACTSReporting ) {
-							elapsedTime = TimeStepSys;
-						} else {
-							elapsedTime = TimeStepZone;
-						}
-						if ( OutputTableBinned( iInObj ).avgSum == isSum ) { // if it is a summed variable
-							curValue /= ( elapsedTime * SecInHour );
-						}
-						// round the value to the number of signficant digits used in the final output report
-						if ( curIntervalSize < 1 ) {
-							curValue = round( curValue * 10000.0 ) / 10000.0; // four significant digits
-						}
-						else if ( curIntervalSize >= 10 ) {
-							curValue = round( curValue ); // zero significant digits
-						}
-						else {
-							curValue = round( curValue * 100.0 ) / 100.0; // two significant digits
-						}
-						// check if the value is above the maximum or below the minimum value
-						// first before binning the value within the range.
-						if ( curValue < curIntervalStart ) {
-							BinResultsBelow( repIndex ).mnth( Month ) += elapsedTime;
-							BinResultsBelow( repIndex ).hrly( HourOfDay ) += elapsedTime;
-						} else if ( curValue >= topValue ) {
-							BinResultsAbove( repIndex ).mnth( Month ) += elapsedTime;
-							BinResultsAbove( repIndex ).hrly( HourOfDay ) += elapsedTime;
-						} else {
-							// determine which bin the results are in
-							binNum = int( ( curValue - curIntervalStart ) / curIntervalSize ) + 1;
-							BinResults( binNum, repIndex ).mnth( Month ) += elapsedTime;
-							BinResults( binNum, repIndex ).hrly( HourOfDay ) += elapsedTime;
-						}
-						// add to statistics array
-						++BinStatistics( repIndex ).n;
-						BinStatistics( repIndex ).sum += curValue;
-						BinStatistics( repIndex ).sum2 += curValue * curValue;
-						if ( curValue < BinStatistics( repIndex ).minimum ) {
-							BinStatistics( repIndex ).minimum = curValue;
-						}
-						if ( curValue > BinStatistics( repIndex ).maximum ) {
-							BinStatistics( repIndex ).maximum = curValue;
-						}
-					}
-				}
+				curValue = GetInternalVariableValue( gather.typeOfVar, gather.varNum );
+			}
+			if ( gather.isSummed ) { // if it is a summed variable
+				curValue /= ( elapsedTime * SecInHour );
+			}
+			// round the value to the number of signficant digits used in the final output report
+			curValue = round( curValue * gather.roundFactor ) / gather.roundFactor;
+			// check if the value is above the maximum or below the minimum value
+			// first before binning the value within the range.
+			if ( curValue < gather.intervalStart ) {
+				BinResultsBelow( repIndex ).mnth( Month ) += elapsedTime;
+				BinResultsBelow( repIndex ).hrly( HourOfDay ) += elapsedTime;
+			} else if ( curValue >= gather.topValue ) {
+				BinResultsAbove( repIndex ).mnth( Month ) += elapsedTime;
+				BinResultsAbove( repIndex ).hrly( HourOfDay ) += elapsedTime;
+			} else {
+				// determine which bin the results are in
+				binNum = int( ( curValue - gather.intervalStart ) / gather.intervalSize ) + 1;
+				BinResults( binNum, repIndex ).mnth( Month ) += elapsedTime;
+				BinResults( binNum, repIndex ).hrly( HourOfDay ) += elapsedTime;
+			}
+			// add to statistics array
+			auto & binStat( BinStatistics( repIndex ) );
+			++binStat.n;
+			binStat.sum += curValue;
+			binStat.sum2 += curValue * curValue;
+			if ( curValue < binStat.minimum ) {
+				binStat.minimum = curValue;
+			}
+			if ( curValue > binStat.maximum ) {
+				binStat.maximum = curValue;
 			}
 		}
 	}
@@ -3846,300 +4329,197 @@ namespace OutputReportTabular {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int iTable; // loop variable for monthlyTables
-		int jColumn; // loop variable for monthlyColumns
+		int jGather; // loop variable for the gathered columns
+		int curTable;
 		int curCol;
 		Real64 curValue;
-		int curTypeOfVar;
-		int curVarNum;
 		Real64 elapsedTime;
-		Real64 oldResultValue;
-		int oldTimeStamp;
-		Real64 oldDuration;
-		Real64 newResultValue;
-		int newTimeStamp;
-		Real64 newDuration;
+		Real64 stepSeconds; // length of the time step in seconds, for summed variables
 		int timestepTimeStamp;
 		bool activeMinMax;
 		//LOGICAL,SAVE  :: activeHoursShown=.FALSE.  !fix by LKL addressing CR6482
 		bool activeHoursShown;
-		bool activeNewValue;
-		int curStepType;
+		bool countHours;
 		int minuteCalculated;
-		int kOtherColumn; // variable used in loop to scan through additional columns
 		int scanColumn;
 		Real64 scanValue;
 		int scanTypeOfVar;
 		int scanVarNum;
 		Real64 oldScanValue;
-		// local copies of some of the MonthlyColumns array references since
-		// profiling showed that they were slow.
-
-		static Array1D_int MonthlyColumnsTypeOfVar;
-		static Array1D_int MonthlyColumnsStepType;
-		static Array1D_int MonthlyColumnsAggType;
-		static Array1D_int MonthlyColumnsVarNum;
-		static Array1D_int MonthlyTablesNumColumns;
-		static int curFirstColumn( 0 );
 
 		if ( ! DoWeathSim ) return;
 
-		// create temporary arrays to speed processing of these arrays
-		if ( GatherMonthlyResultsForTimestepRunOnce ) {
-			// MonthlyColumns
-			MonthlyColumnsTypeOfVar.allocate( MonthlyColumns.I() );
-			MonthlyColumnsStepType.allocate( MonthlyColumns.I() );
-			MonthlyColumnsAggType.allocate( MonthlyColumns.I() );
-			MonthlyColumnsVarNum.allocate( MonthlyColumns.I() );
-			for ( int i = MonthlyColumns.l(), e = MonthlyColumns.u(); i <= e; ++i ) {
-				auto const & col( MonthlyColumns( i ) );
-				MonthlyColumnsTypeOfVar( i ) = col.typeOfVar;
-				MonthlyColumnsStepType( i ) = col.stepType;
-				MonthlyColumnsAggType( i ) = col.aggType;
-				MonthlyColumnsVarNum( i ) = col.varNum;
-			}
-
-			// MonthlyTables
-			MonthlyTablesNumColumns.allocate( MonthlyTables.I() );
-			for ( int i = MonthlyTables.l(), e = MonthlyTables.u(); i <= e; ++i ) {
-				MonthlyTablesNumColumns( i ) = MonthlyTables( i ).numColumns;
-			}
-
-			// set flag so this block is only executed once
-			GatherMonthlyResultsForTimestepRunOnce = false;
-		}
-
 		elapsedTime = TimeStepSys;
 		if ( IndexTypeKey == HVACTSReporting ) {
 			elapsedTime = TimeStepSys;
+			stepSeconds = TimeStepSys * SecInHour;
 		} else {
 			elapsedTime = TimeStepZone;
+			stepSeconds = TimeStepZoneSec;
 		}
 		IsMonthGathered( Month ) = true;
-		for ( iTable = 1; iTable <= MonthlyTablesCount; ++iTable ) {
-			activeMinMax = false; //at the beginning of the new timestep
-			activeHoursShown = false; //fix by JG addressing CR6482
-			curFirstColumn = MonthlyTables( iTable ).firstColumn;
-			for ( jColumn = 1; jColumn <= MonthlyTablesNumColumns( iTable ); ++jColumn ) {
-				curCol = jColumn + curFirstColumn - 1;
-				curTypeOfVar = MonthlyColumnsTypeOfVar( curCol );
-				curStepType = MonthlyColumnsStepType( curCol );
-				if ( ( ( curStepType == stepTypeZone ) && ( IndexTypeKey == ZoneTSReporting ) ) || ( ( curStepType == stepTypeHVAC ) && ( IndexTypeKey == HVACTSReporting ) ) ) {
-					//  the above condition used to include the following prior to new scan method
-					//  (MonthlyColumns(curCol)%aggType .EQ. aggTypeValueWhenMaxMin)
-					curVarNum = MonthlyColumnsVarNum( curCol );
-					curValue = GetInternalVariableValue( curTypeOfVar, curVarNum );
-					// Get the value from the result array
-					oldResultValue = MonthlyColumns( curCol ).reslt( Month );
-					oldTimeStamp = MonthlyColumns( curCol ).timeStamp( Month );
-					oldDuration = MonthlyColumns( curCol ).duration( Month );
-					// Zero the revised values (as default if not set later in SELECT)
-					newResultValue = 0.0;
-					newTimeStamp = 0;
-					newDuration = 0.0;
-					activeNewValue = false;
-					// the current timestamp
-					minuteCalculated = DetermineMinuteForReporting( IndexTypeKey );
-					//      minuteCalculated = (CurrentTime - INT(CurrentTime))*60
-					//      IF (IndexTypeKey .EQ. stepTypeHVAC) minuteCalculated = minuteCalculated + SysTimeElapsed * 60
-					//      minuteCalculated = INT((TimeStep-1) * TimeStepZone * 60) + INT((SysTimeElapsed + TimeStepSys) * 60)
-					EncodeMonDayHrMin( timestepTimeStamp, Month, DayOfMonth, HourOfDay, minuteCalculated );
-					// perform the selected aggregation type
-					// use next lines since it is faster was: SELECT CASE (MonthlyColumns(curCol)%aggType)
-					{ auto const SELECT_CASE_var( MonthlyColumnsAggType( curCol ) );
-					if ( SELECT_CASE_var == aggTypeSumOrAvg ) {
-						if ( MonthlyColumns( curCol ).avgSum == isSum ) { // if it is a summed variable
-							newResultValue = oldResultValue + curValue;
-						} else {
-							newResultValue = oldResultValue + curValue * elapsedTime; //for averaging - weight by elapsed time
-						}
-						newDuration = oldDuration + elapsedTime;
-						activeNewValue = true;
-					} else if ( SELECT_CASE_var == aggTypeMaximum ) {
-						// per MJW when a summed variable is used divide it by the length of the time step
-						if ( MonthlyColumns( curCol ).avgSum == isSum ) { // if it is a summed variable
-							if ( IndexTypeKey == HVACTSReporting ) {
-								curValue /= ( TimeStepSys * SecInHour );
-							} else {
-								curValue /= TimeStepZoneSec;
-							}
-						}
-						if ( curValue > oldResultValue ) {
-							newResultValue = curValue;
-							newTimeStamp = timestepTimeStamp;
-							activeMinMax = true;
-							activeNewValue = true;
-						} else {
-							activeMinMax = false; //reset this
-						}
-					} else if ( SELECT_CASE_var == aggTypeMinimum ) {
-						// per MJW when a summed variable is used divide it by the length of the time step
-						if ( MonthlyColumns( curCol ).avgSum == isSum ) { // if it is a summed variable
-							if ( IndexTypeKey == HVACTSReporting ) {
-								curValue /= ( TimeStepSys * SecInHour );
-							} else {
-								curValue /= TimeStepZoneSec;
-							}
+		if ( ( IndexTypeKey != ZoneTSReporting ) && ( IndexTypeKey != HVACTSReporting ) ) return;
+		auto const & gatherPlan( ( IndexTypeKey == HVACTSReporting ) ? MonthlyGatherHVAC : MonthlyGatherZone );
+
+		// the current timestamp
+		minuteCalculated = DetermineMinuteForReporting( IndexTypeKey );
+		//      minuteCalculated = (CurrentTime - INT(CurrentTime))*60
+		//      IF (IndexTypeKey .EQ. stepTypeHVAC) minuteCalculated = minuteCalculated + SysTimeElapsed * 60
+		//      minuteCalculated = INT((TimeStep-1) * TimeStepZone * 60) + INT((SysTimeElapsed + TimeStepSys) * 60)
+		EncodeMonDayHrMin( timestepTimeStamp, Month, DayOfMonth, HourOfDay, minuteCalculated );
+
+		curTable = 0;
+		activeMinMax = false;
+		activeHoursShown = false;
+		for ( jGather = 1; jGather <= gatherPlan.isize(); ++jGather ) {
+			auto const & gather( gatherPlan( jGather ) );
+			if ( gather.table != curTable ) {
+				curTable = gather.table;
+				activeMinMax = false; //at the beginning of the new timestep
+				activeHoursShown = false; //fix by JG addressing CR6482
+			}
+			curCol = gather.column;
+			auto & col( MonthlyColumns( curCol ) );
+			if ( gather.valuePtr != nullptr ) {
+				curValue = *gather.valuePtr;
+			} else {
+				curValue = GetInternalVariableValue( gather.typeOfVar, gather.varNum );
+			}
+			countHours = false;
+			// perform the selected aggregation type
+			switch ( gather.aggType ) {
+			case aggTypeSumOrAvg:
+				if ( gather.isSummed ) { // if it is a summed variable
+					col.reslt( Month ) += curValue;
+				} else {
+					col.reslt( Month ) += curValue * elapsedTime; //for averaging - weight by elapsed time
+				}
+				col.timeStamp( Month ) = 0;
+				col.duration( Month ) += elapsedTime;
+				break;
+			case aggTypeMaximum:
+				// per MJW when a summed variable is used divide it by the length of the time step
+				if ( gather.isSummed ) curValue /= stepSeconds;
+				activeMinMax = ( curValue > col.reslt( Month ) );
+				if ( activeMinMax ) {
+					col.reslt( Month ) = curValue;
+					col.timeStamp( Month ) = timestepTimeStamp;
+					col.duration( Month ) = 0.0;
+				}
+				break;
+			case aggTypeMinimum:
+				// per MJW when a summed variable is used divide it by the length of the time step
+				if ( gather.isSummed ) curValue /= stepSeconds;
+				activeMinMax = ( curValue < col.reslt( Month ) );
+				if ( activeMinMax ) {
+					col.reslt( Month ) = curValue;
+					col.timeStamp( Month ) = timestepTimeStamp;
+					col.duration( Month ) = 0.0;
+				}
+				break;
+			case aggTypeHoursZero:
+				countHours = ( curValue == 0 );
+				break;
+			case aggTypeHoursNonZero:
+				countHours = ( curValue != 0 );
+				break;
+			case aggTypeHoursPositive:
+				countHours = ( curValue > 0 );
+				break;
+			case aggTypeHoursNonPositive:
+				countHours = ( curValue <= 0 );
+				break;
+			case aggTypeHoursNegative:
+				countHours = ( curValue < 0 );
+				break;
+			case aggTypeHoursNonNegative:
+				countHours = ( curValue >= 0 );
+				break;
+			default:
+				// The valueWhenMaxMin and the agg*HoursShown columns are set by the scans below
+				break;
+			}
+			if ( ( gather.aggType >= aggTypeHoursZero ) && ( gather.aggType <= aggTypeHoursNonNegative ) ) {
+				activeHoursShown = countHours;
+				if ( countHours ) {
+					col.reslt( Month ) += elapsedTime;
+					col.timeStamp( Month ) = 0;
+					col.duration( Month ) = 0.0;
+				}
+			}
+			// if a minimum or maximum value was set this timeStep then
+			// scan the remaining columns of the table looking for values
+			// that are aggregation type "ValueWhenMaxMin" and set their values
+			// if another minimum or maximum column is found then end
+			// the scan (it will be taken care of when that column is done)
+			if ( activeMinMax ) {
+				for ( scanColumn = curCol + 1; scanColumn <= gather.lastColumn; ++scanColumn ) {
+					{ auto const SELECT_CASE_var( MonthlyColumns( scanColumn ).aggType );
+					if ( ( SELECT_CASE_var == aggTypeMaximum ) || ( SELECT_CASE_var == aggTypeMinimum ) ) {
+						// end scanning since these might reset
+						break; //do
+					} else if ( SELECT_CASE_var == aggTypeValueWhenMaxMin ) {
+						// this case is when the value should be set
+						scanTypeOfVar = MonthlyColumns( scanColumn ).typeOfVar;
+						scanVarNum = MonthlyColumns( scanColumn ).varNum;
+						scanValue = GetInternalVariableValue( scanTypeOfVar, scanVarNum );
+						// When a summed variable is used divide it by the length of the time step
+						if ( MonthlyColumns( scanColumn ).avgSum == isSum ) { // if it is a summed variable
+							scanValue /= stepSeconds;
 						}
-						if ( curValue < oldResultValue ) {
-							newResultValue = curValue;
-							newTimeStamp = timestepTimeStamp;
-							activeMinMax = true;
-							activeNewValue = true;
+						MonthlyColumns( scanColumn ).reslt( Month ) = scanValue;
+					} else {
+						// do nothing
+					}}
+				}
+			}
+			// If the hours variable is active then scan through the rest of the variables
+			// and accumulate
+			if ( activeHoursShown ) {
+				for ( scanColumn = curCol + 1; scanColumn <= gather.lastColumn; ++scanColumn ) {
+					scanTypeOfVar = MonthlyColumns( scanColumn ).typeOfVar;
+					scanVarNum = MonthlyColumns( scanColumn ).varNum;
+					scanValue = GetInternalVariableValue( scanTypeOfVar, scanVarNum );
+					oldScanValue = MonthlyColumns( scanColumn ).reslt( Month );
+					{ auto const SELECT_CASE_var( MonthlyColumns( scanColumn ).aggType );
+					if ( ( SELECT_CASE_var == aggTypeHoursZero ) || ( SELECT_CASE_var == aggTypeHoursNonZero ) ) {
+						// end scanning since these might reset
+						break; //do
+					} else if ( ( SELECT_CASE_var == aggTypeHoursPositive ) || ( SELECT_CASE_var == aggTypeHoursNonPositive ) ) {
+						// end scanning since these might reset
+						break; //do
+					} else if ( ( SELECT_CASE_var == aggTypeHoursNegative ) || ( SELECT_CASE_var == aggTypeHoursNonNegative ) ) {
+						// end scanning since these might reset
+						break; //do
+					} else if ( SELECT_CASE_var == aggTypeSumOrAverageHoursShown ) {
+						// this case is when the value should be set
+						if ( MonthlyColumns( scanColumn ).avgSum == isSum ) { // if it is a summed variable
+							MonthlyColumns( scanColumn ).reslt( Month ) = oldScanValue + scanValue;
 						} else {
-							activeMinMax = false; //reset this
+							//for averaging - weight by elapsed time
+							MonthlyColumns( scanColumn ).reslt( Month ) = oldScanValue + scanValue * elapsedTime;
 						}
-					} else if ( SELECT_CASE_var == aggTypeHoursZero ) {
-						if ( curValue == 0 ) {
-							newResultValue = oldResultValue + elapsedTime;
-							activeHoursShown = true;
-							activeNewValue = true;
-						} else {
-							activeHoursShown = false;
+						MonthlyColumns( scanColumn ).duration( Month ) += elapsedTime;
+					} else if ( SELECT_CASE_var == aggTypeMaximumDuringHoursShown ) {
+						if ( MonthlyColumns( scanColumn ).avgSum == isSum ) { // if it is a summed variable
+							scanValue /= stepSeconds;
 						}
-					} else if ( SELECT_CASE_var == aggTypeHoursNonZero ) {
-						if ( curValue != 0 ) {
-							newResultValue = oldResultValue + elapsedTime;
-							activeHoursShown = true;
-							activeNewValue = true;
-						} else {
-							activeHoursShown = false;
+						if ( scanValue > oldScanValue ) {
+							MonthlyColumns( scanColumn ).reslt( Month ) = scanValue;
+							MonthlyColumns( scanColumn ).timeStamp( Month ) = timestepTimeStamp;
 						}
-					} else if ( SELECT_CASE_var == aggTypeHoursPositive ) {
-						if ( curValue > 0 ) {
-							newResultValue = oldResultValue + elapsedTime;
-							activeHoursShown = true;
-							activeNewValue = true;
-						} else {
-							activeHoursShown = false;
+					} else if ( SELECT_CASE_var == aggTypeMinimumDuringHoursShown ) {
+						if ( MonthlyColumns( scanColumn ).avgSum == isSum ) { // if it is a summed variable
+							scanValue /= stepSeconds;
 						}
-					} else if ( SELECT_CASE_var == aggTypeHoursNonPositive ) {
-						if ( curValue <= 0 ) {
-							newResultValue = oldResultValue + elapsedTime;
-							activeHoursShown = true;
-							activeNewValue = true;
-						} else {
-							activeHoursShown = false;
+						if ( scanValue < oldScanValue ) {
+							MonthlyColumns( scanColumn ).reslt( Month ) = scanValue;
+							MonthlyColumns( scanColumn ).timeStamp( Month ) = timestepTimeStamp;
 						}
-					} else if ( SELECT_CASE_var == aggTypeHoursNegative ) {
-						if ( curValue < 0 ) {
-							newResultValue = oldResultValue + elapsedTime;
-							activeHoursShown = true;
-							activeNewValue = true;
-						} else {
-							activeHoursShown = false;
-						}
-					} else if ( SELECT_CASE_var == aggTypeHoursNonNegative ) {
-						if ( curValue >= 0 ) {
-							newResultValue = oldResultValue + elapsedTime;
-							activeHoursShown = true;
-							activeNewValue = true;
-						} else {
-							activeHoursShown = false;
-						}
-						// The valueWhenMaxMin is picked up now during the activeMinMax if block below.
-						//CASE (aggTypeValueWhenMaxMin)
-						//CASE (aggTypeSumOrAverageHoursShown)
-						//CASE (aggTypeMaximumDuringHoursShown)
-						//CASE (aggTypeMinimumDuringHoursShown)
+					} else {
+						// do nothing
 					}}
-					// if the new value has been set then set the monthly values to the
-					// new columns. This skips the aggregation types that don't even get
-					// triggered now such as valueWhenMinMax and all the agg*HoursShown
-					if ( activeNewValue ) {
-						MonthlyColumns( curCol ).reslt( Month ) = newResultValue;
-						MonthlyColumns( curCol ).timeStamp( Month ) = newTimeStamp;
-						MonthlyColumns( curCol ).duration( Month ) = newDuration;
-					}
-					// if a minimum or maximum value was set this timeStep then
-					// scan the remaining columns of the table looking for values
-					// that are aggregation type "ValueWhenMaxMin" and set their values
-					// if another minimum or maximum column is found then end
-					// the scan (it will be taken care of when that column is done)
-					if ( activeMinMax ) {
-						for ( kOtherColumn = jColumn + 1; kOtherColumn <= MonthlyTables( iTable ).numColumns; ++kOtherColumn ) {
-							scanColumn = kOtherColumn + MonthlyTables( iTable ).firstColumn - 1;
-							{ auto const SELECT_CASE_var( MonthlyColumns( scanColumn ).aggType );
-							if ( ( SELECT_CASE_var == aggTypeMaximum ) || ( SELECT_CASE_var == aggTypeMinimum ) ) {
-								// end scanning since these might reset
-								break; //do
-							} else if ( SELECT_CASE_var == aggTypeValueWhenMaxMin ) {
-								// this case is when the value should be set
-								scanTypeOfVar = MonthlyColumns( scanColumn ).typeOfVar;
-								scanVarNum = MonthlyColumns( scanColumn ).varNum;
-								scanValue = GetInternalVariableValue( scanTypeOfVar, scanVarNum );
-								// When a summed variable is used divide it by the length of the time step
-								if ( MonthlyColumns( scanColumn ).avgSum == isSum ) { // if it is a summed variable
-									if ( IndexTypeKey == HVACTSReporting ) {
-										scanValue /= ( TimeStepSys * SecInHour );
-									} else {
-										scanValue /= TimeStepZoneSec;
-									}
-								}
-								MonthlyColumns( scanColumn ).reslt( Month ) = scanValue;
-							} else {
-								// do nothing
-							}}
-						}
-					}
-					// If the hours variable is active then scan through the rest of the variables
-					// and accumulate
-					if ( activeHoursShown ) {
-						for ( kOtherColumn = jColumn + 1; kOtherColumn <= MonthlyTables( iTable ).numColumns; ++kOtherColumn ) {
-							scanColumn = kOtherColumn + MonthlyTables( iTable ).firstColumn - 1;
-							scanTypeOfVar = MonthlyColumns( scanColumn ).typeOfVar;
-							scanVarNum = MonthlyColumns( scanColumn ).varNum;
-							scanValue = GetInternalVariableValue( scanTypeOfVar, scanVarNum );
-							oldScanValue = MonthlyColumns( scanColumn ).reslt( Month );
-							{ auto const SELECT_CASE_var( MonthlyColumns( scanColumn ).aggType );
-							if ( ( SELECT_CASE_var == aggTypeHoursZero ) || ( SELECT_CASE_var == aggTypeHoursNonZero ) ) {
-								// end scanning since these might reset
-								break; //do
-							} else if ( ( SELECT_CASE_var == aggTypeHoursPositive ) || ( SELECT_CASE_var == aggTypeHoursNonPositive ) ) {
-								// end scanning since these might reset
-								break; //do
-							} else if ( ( SELECT_CASE_var == aggTypeHoursNegative ) || ( SELECT_CASE_var == aggTypeHoursNonNegative ) ) {
-								// end scanning since these might reset
-								break; //do
-							} else if ( SELECT_CASE_var == aggTypeSumOrAverageHoursShown ) {
-								// this case is when the value should be set
-								if ( MonthlyColumns( scanColumn ).avgSum == isSum ) { // if it is a summed variable
-									MonthlyColumns( scanColumn ).reslt( Month ) = oldScanValue + scanValue;
-								} else {
-									//for averaging - weight by elapsed time
-									MonthlyColumns( scanColumn ).reslt( Month ) = oldScanValue + scanValue * elapsedTime;
-								}
-								MonthlyColumns( scanColumn ).duration( Month ) += elapsedTime;
-							} else if ( SELECT_CASE_var == aggTypeMaximumDuringHoursShown ) {
-								if ( MonthlyColumns( scanColumn ).avgSum == isSum ) { // if it is a summed variable
-									if ( IndexTypeKey == HVACTSReporting ) {
-										scanValue /= ( TimeStepSys * SecInHour );
-									} else {
-										scanValue /= TimeStepZoneSec;
-									}
-								}
-								if ( scanValue > oldScanValue ) {
-									MonthlyColumns( scanColumn ).reslt( Month ) = scanValue;
-									MonthlyColumns( scanColumn ).timeStamp( Month ) = timestepTimeStamp;
-								}
-							} else if ( SELECT_CASE_var == aggTypeMinimumDuringHoursShown ) {
-								if ( MonthlyColumns( scanColumn ).avgSum == isSum ) { // if it is a summed variable
-									if ( IndexTypeKey == HVACTSReporting ) {
-										scanValue /= ( TimeStepSys * SecInHour );
-									} else {
-										scanValue /= TimeStepZoneSec;
-									}
-								}
-								if ( scanValue < oldScanValue ) {
-									MonthlyColumns( scanColumn ).reslt( Month ) = scanValue;
-									MonthlyColumns( scanColumn ).timeStamp( Month ) = timestepTimeStamp;
-								}
-							} else {
-								// do nothing
-							}}
-							activeHoursShown = false; //fixed CR8317
-						}
-					}
+					activeHoursShown = false; //fixed CR8317
 				}
 			}
 		}
@@ -4200,7 +4580,6 @@ namespace OutputReportTabular {
 		// na
 
 		// Using/Aliasing
-		using OutputProcessor::EndUseCategory;
 		using DataStringGlobals::CharComma;
 		using DataStringGlobals::CharTab;
 		using DataStringGlobals::CharSpace;
@@ -4218,11 +4597,7 @@ namespace OutputReportTabular {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int iResource;
-		int jEndUse;
-		int kEndUseSub;
-		Real64 curMeterValue;
-		int curMeterNumber;
+		int iGather;
 
 		// if no beps report is called then skip
 
@@ -4239,37 +4614,19 @@ namespace OutputReportTabular {
 			//    END IF
 			//  END DO
 
-			// loop through all of the resources and end uses for the entire facility
-			for ( iResource = 1; iResource <= numResourceTypes; ++iResource ) {
-				curMeterNumber = meterNumTotalsBEPS( iResource );
-				if ( curMeterNumber > 0 ) {
-					curMeterValue = GetCurrentMeterValue( curMeterNumber );
-					gatherTotalsBEPS( iResource ) += curMeterValue;
-				}
-
-				for ( jEndUse = 1; jEndUse <= NumEndUses; ++jEndUse ) {
-					curMeterNumber = meterNumEndUseBEPS( iResource, jEndUse );
-					if ( curMeterNumber > 0 ) {
-						curMeterValue = GetCurrentMeterValue( curMeterNumber );
-						gatherEndUseBEPS( iResource, jEndUse ) += curMeterValue;
-
-						for ( kEndUseSub = 1; kEndUseSub <= EndUseCategory( jEndUse ).NumSubcategories; ++kEndUseSub ) {
-							curMeterNumber = meterNumEndUseSubBEPS( kEndUseSub, jEndUse, iResource );
-							if ( curMeterNumber > 0 ) {
-								curMeterValue = GetCurrentMeterValue( curMeterNumber );
-								gatherEndUseSubBEPS( kEndUseSub, jEndUse, iResource ) += curMeterValue;
-							}
-						}
-					}
-				}
+			// loop through all of the resources and end uses for the entire facility (only the meters found
+			// in SetupBEPSGatherPlan are listed)
+			for ( iGather = 1; iGather <= BEPSGatherTotals.isize(); ++iGather ) {
+				gatherTotalsBEPS[ BEPSGatherTotals( iGather ).index ] += GetCurrentMeterValue( BEPSGatherTotals( iGather ).meterNum );
 			}
-
-			for ( iResource = 1; iResource <= numSourceTypes; ++iResource ) {
-				curMeterNumber = meterNumTotalsSource( iResource );
-				if ( curMeterNumber > 0 ) {
-					curMeterValue = GetCurrentMeterValue( curMeterNumber );
-					gatherTotalsSource( iResource ) += curMeterValue;
-				}
+			for ( iGather = 1; iGather <= BEPSGatherEndUse.isize(); ++iGather ) {
+				gatherEndUseBEPS[ BEPSGatherEndUse( iGather ).index ] += GetCurrentMeterValue( BEPSGatherEndUse( iGather ).meterNum );
+			}
+			for ( iGather = 1; iGather <= BEPSGatherEndUseSub.isize(); ++iGather ) {
+				gatherEndUseSubBEPS[ BEPSGatherEndUseSub( iGather ).index ] += GetCurrentMeterValue( BEPSGatherEndUseSub( iGather ).meterNum );
+			}
+			for ( iGather = 1; iGather <= BEPSGatherSource.isize(); ++iGather ) {
+				gatherTotalsSource[ BEPSGatherSource( iGather ).index ] += GetCurrentMeterValue( BEPSGatherSource( iGather ).meterNum );
 			}
 
 			// gather the electric load components
@@ -4654,21 +5011,7 @@ namespace OutputReportTabular {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int iZone( 0 );
-		static int iRadiant( 0 );
-		static int iunit( 0 );
-		static int curZone( 0 );
-		static Real64 eqpSens( 0.0 );
-		static Real64 total( 0.0 );
 		// the following arrays store the radiant total for each timestep
-		static Array1D< Real64 > radiantHeat;
-		static Array1D< Real64 > radiantCool;
-		static Array1D< Real64 > ATUHeat;
-		static Array1D< Real64 > ATUCool;
-		static int timestepTimeStamp( 0 );
-		static Real64 bldgHtPk( 0.0 );
-		static Real64 bldgClPk( 0.0 );
-		static Real64 timeStepRatio( 0.0 );
 
 		Real64 mult; // zone list and group multipliers
 
@@ -5279,8 +5622,6 @@ namespace OutputReportTabular {
 		std::string lineIn;
 		int statFile;
 		bool fileExists;
-		static int lineType( 0 );
-		static int lineTypeinterim( 0 );
 		int readStat;
 		bool isASHRAE;
 		bool iscalc;
@@ -5910,32 +6251,10 @@ namespace OutputReportTabular {
 		int zonePt;
 		int iZone;
 		Real64 mult; // zone list and group multipliers
-		static Real64 totalVolume( 0.0 );
-		static int numUncondZones( 0 );
-		static int numCondZones( 0 );
 		int StartOfWeek;
-		static Real64 HrsPerWeek( 0.0 );
 		Real64 consumptionTotal;
 		Real64 convertJtoGJ;
 		// sensible heat gain report totals
-		static Real64 totalHvacHt( 0.0 );
-		static Real64 totalHvacCl( 0.0 );
-		static Real64 totalHvacATUHt( 0.0 );
-		static Real64 totalHvacATUCl( 0.0 );
-		static Real64 totalSurfHt( 0.0 );
-		static Real64 totalSurfCl( 0.0 );
-		static Real64 totalPeoplAdd( 0.0 );
-		static Real64 totalLiteAdd( 0.0 );
-		static Real64 totalEquipAdd( 0.0 );
-		static Real64 totalWindAdd( 0.0 );
-		static Real64 totalIzaAdd( 0.0 );
-		static Real64 totalInfilAdd( 0.0 );
-		static Real64 totalOtherAdd( 0.0 );
-		static Real64 totalEquipRem( 0.0 );
-		static Real64 totalWindRem( 0.0 );
-		static Real64 totalIzaRem( 0.0 );
-		static Real64 totalInfilRem( 0.0 );
-		static Real64 totalOtherRem( 0.0 );
 
 		convertJtoGJ = 1.0 / 1000000000.0;
 		StartOfWeek = RunPeriodStartDayOfWeek;
@@ -6295,7 +6614,6 @@ namespace OutputReportTabular {
 		int curCol;
 		Real64 curVal;
 		Real64 curConversionFactor;
-		static Real64 curConversionOffset( 0.0 );
 		int columnUsedCount;
 		int columnRecount;
 		int digitsShown;
@@ -6991,13 +7309,6 @@ namespace OutputReportTabular {
 		Array1D< Real64 > leedElevEsc( 6 );
 		std::string subCatName;
 		Real64 nonMisc;
-		static Real64 leedSiteIntLite( 0.0 );
-		static Real64 leedSiteSpHeat( 0.0 );
-		static Real64 leedSiteSpCool( 0.0 );
-		static Real64 leedSiteFanInt( 0.0 );
-		static Real64 leedSiteSrvWatr( 0.0 );
-		static Real64 leedSiteRecept( 0.0 );
-		static Real64 leedSiteTotal( 0.0 );
 		Real64 unconvert;
 
 		if ( displayTabularBEPS || displayLEEDSummary ) {
@@ -8618,7 +8929,6 @@ namespace OutputReportTabular {
 		int kEndUseSub;
 		int i;
 		int numRows;
-		static std::string footnote;
 		Real64 additionalFuelMax;
 		int additionalFuelSelected;
 		int additionalFuelNonZeroCount;
@@ -9132,11 +9442,6 @@ namespace OutputReportTabular {
 		int item; // do-loop counter for line items
 		int NumRows; // number of rows in report table excluding table header
 		int NumCols; // number of columns in report table
-		static std::string SIunit;
-		static std::string m2_unitName;
-		static Real64 m2_unitConv( 0.0 );
-		static int unitConvIndex( 0 );
-		static std::string IPunitName;
 		Real64 IPqty;
 		Real64 IPsingleValue;
 		Real64 IPvaluePer;
@@ -9171,9 +9476,9 @@ namespace OutputReportTabular {
 		rowHead( 8 ) = "Commissioning (~~$~~)";
 		rowHead( 9 ) = "Cost Estimate Total (~~$~~)";
 		if ( unitsStyle == unitsStyleInchPound ) {
-			SIunit = "[m2]";
-			LookupSItoIP( SIunit, unitConvIndex, m2_unitName );
-			m2_unitConv = ConvertIP( unitConvIndex, 1.0 );
+			WriteCompCostTableSIunit = "[m2]";
+			LookupSItoIP( WriteCompCostTableSIunit, WriteCompCostTable_unitConvIndex, m2_unitName );
+			m2_unitConv = ConvertIP( WriteCompCostTable_unitConvIndex, 1.0 );
 			rowHead( 10 ) = "Cost Per Conditioned Building Area (~~$~~/ft2)";
 		} else {
 			rowHead( 10 ) = "Cost Per Conditioned Building Area (~~$~~/m2)";
@@ -9288,12 +9593,12 @@ namespace OutputReportTabular {
 			tableBody( 1, item ) = IntToStr( CostLineItem( item ).LineNumber );
 			tableBody( 2, item ) = CostLineItem( item ).LineName;
 			if ( unitsStyle == unitsStyleInchPound ) {
-				LookupSItoIP( CostLineItem( item ).Units, unitConvIndex, IPunitName );
-				if ( unitConvIndex != 0 ) {
-					IPqty = ConvertIP( unitConvIndex, CostLineItem( item ).Qty );
+				LookupSItoIP( CostLineItem( item ).Units, WriteCompCostTable_unitConvIndex, IPunitName );
+				if ( WriteCompCostTable_unitConvIndex != 0 ) {
+					IPqty = ConvertIP( WriteCompCostTable_unitConvIndex, CostLineItem( item ).Qty );
 					tableBody( 3, item ) = RealToStr( IPqty, 2 );
 					tableBody( 4, item ) = IPunitName;
-					IPsingleValue = ConvertIP( unitConvIndex, 1.0 );
+					IPsingleValue = ConvertIP( WriteCompCostTable_unitConvIndex, 1.0 );
 					if ( IPsingleValue != 0.0 ) {
 						IPvaluePer = CostLineItem( item ).ValuePer / IPsingleValue;
 						tableBody( 5, item ) = RealToStr( IPvaluePer, 2 );
@@ -9464,32 +9769,9 @@ namespace OutputReportTabular {
 		bool zoneIsCond;
 		bool usezoneFloorArea;
 
-		static int grandTotal( 1 );
-		static int condTotal( 2 );
-		static int uncondTotal( 3 );
-		static int notpartTotal( 4 );
 		int iTotal;
-		static std::string SIunit;
-		static int unitConvIndex( 0 );
-		static Real64 m_unitConv( 0.0 );
-		static Real64 m2_unitConv( 0.0 );
-		static Real64 m3_unitConv( 0.0 );
-		static Real64 Wm2_unitConv( 0.0 );
-		static std::string m_unitName;
-		static std::string m2_unitName;
-		static std::string m3_unitName;
-		static std::string Wm2_unitName;
 
 		//zone summary total
-		static Array1D< Real64 > zstArea( 4 );
-		static Array1D< Real64 > zstVolume( 4 );
-		static Array1D< Real64 > zstWallArea( 4 );
-		static Array1D< Real64 > zstUndWallArea( 4 );
-		static Array1D< Real64 > zstWindowArea( 4 );
-		static Array1D< Real64 > zstOpeningArea( 4 );
-		static Array1D< Real64 > zstLight( 4 );
-		static Array1D< Real64 > zstPeople( 4 );
-		static Array1D< Real64 > zstPlug( 4 );
 
 		zstArea = 0.0;
 		zstVolume = 0.0;
@@ -9523,23 +9805,23 @@ namespace OutputReportTabular {
 
 			// do unit conversions if necessary
 			if ( unitsStyle == unitsStyleInchPound ) {
-				SIunit = "[m]";
-				LookupSItoIP( SIunit, unitConvIndex, m_unitName );
-				m_unitConv = ConvertIP( unitConvIndex, 1.0 );
-				SIunit = "[m2]";
-				LookupSItoIP( SIunit, unitConvIndex, m2_unitName );
-				m2_unitConv = ConvertIP( unitConvIndex, 1.0 );
-				SIunit = "[m3]";
-				LookupSItoIP( SIunit, unitConvIndex, m3_unitName );
-				m3_unitConv = ConvertIP( unitConvIndex, 1.0 );
-				SIunit = "[W/m2]";
-				LookupSItoIP( SIunit, unitConvIndex, Wm2_unitName );
-				Wm2_unitConv = ConvertIP( unitConvIndex, 1.0 );
+				WriteVeriSumTableSIunit = "[m]";
+				LookupSItoIP( WriteVeriSumTableSIunit, WriteVeriSumTable_unitConvIndex, m_unitName );
+				m_unitConv = ConvertIP( WriteVeriSumTable_unitConvIndex, 1.0 );
+				WriteVeriSumTableSIunit = "[m2]";
+				LookupSItoIP( WriteVeriSumTableSIunit, WriteVeriSumTable_unitConvIndex, WriteVeriSumTable_m2_unitName );
+				WriteVeriSumTable_m2_unitConv = ConvertIP( WriteVeriSumTable_unitConvIndex, 1.0 );
+				WriteVeriSumTableSIunit = "[m3]";
+				LookupSItoIP( WriteVeriSumTableSIunit, WriteVeriSumTable_unitConvIndex, m3_unitName );
+				m3_unitConv = ConvertIP( WriteVeriSumTable_unitConvIndex, 1.0 );
+				WriteVeriSumTableSIunit = "[W/m2]";
+				LookupSItoIP( WriteVeriSumTableSIunit, WriteVeriSumTable_unitConvIndex, Wm2_unitName );
+				Wm2_unitConv = ConvertIP( WriteVeriSumTable_unitConvIndex, 1.0 );
 			} else {
 				m_unitName = "[m]";
 				m_unitConv = 1.0;
-				m2_unitName = "[m2]";
-				m2_unitConv = 1.0;
+				WriteVeriSumTable_m2_unitName = "[m2]";
+				WriteVeriSumTable_m2_unitConv = 1.0;
 				m3_unitName = "[m3]";
 				m3_unitConv = 1.0;
 				Wm2_unitName = "[W/m2]";
@@ -9603,9 +9885,9 @@ namespace OutputReportTabular {
 			columnHead( wwrcSouth ) = "South (135 to 225 deg)";
 			columnHead( wwrcWest ) = "West (225 to 315 deg)";
 
-			rowHead( wwrrWall ) = "Gross Wall Area " + m2_unitName;
-			rowHead( wwrrAbvGndWall ) = "Above Ground Wall Area " + m2_unitName;
-			rowHead( wwrrWindow ) = "Window Opening Area " + m2_unitName;
+			rowHead( wwrrWall ) = "Gross Wall Area " + WriteVeriSumTable_m2_unitName;
+			rowHead( wwrrAbvGndWall ) = "Above Ground Wall Area " + WriteVeriSumTable_m2_unitName;
+			rowHead( wwrrWindow ) = "Window Opening Area " + WriteVeriSumTable_m2_unitName;
 			rowHead( wwrrWWR ) = "Gross Window-Wall Ratio [%]";
 			rowHead( wwrrAbvGndWWR ) = "Above Ground Window-Wall Ratio [%]";
 
@@ -9758,23 +10040,23 @@ namespace OutputReportTabular {
 
 			tableBody = "";
 
-			tableBody( wwrcNorth, wwrrWall ) = RealToStr( wallAreaN * m2_unitConv, 2 );
-			tableBody( wwrcSouth, wwrrWall ) = RealToStr( wallAreaS * m2_unitConv, 2 );
-			tableBody( wwrcEast, wwrrWall ) = RealToStr( wallAreaE * m2_unitConv, 2 );
-			tableBody( wwrcWest, wwrrWall ) = RealToStr( wallAreaW * m2_unitConv, 2 );
-			tableBody( wwrcTotal, wwrrWall ) = RealToStr( TotalWallArea * m2_unitConv, 2 );
+			tableBody( wwrcNorth, wwrrWall ) = RealToStr( wallAreaN * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcSouth, wwrrWall ) = RealToStr( wallAreaS * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcEast, wwrrWall ) = RealToStr( wallAreaE * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcWest, wwrrWall ) = RealToStr( wallAreaW * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcTotal, wwrrWall ) = RealToStr( TotalWallArea * WriteVeriSumTable_m2_unitConv, 2 );
 
-			tableBody( wwrcNorth, wwrrAbvGndWall ) = RealToStr( aboveGroundWallAreaN * m2_unitConv, 2 );
-			tableBody( wwrcSouth, wwrrAbvGndWall ) = RealToStr( aboveGroundWallAreaS * m2_unitConv, 2 );
-			tableBody( wwrcEast, wwrrAbvGndWall ) = RealToStr( aboveGroundWallAreaE * m2_unitConv, 2 );
-			tableBody( wwrcWest, wwrrAbvGndWall ) = RealToStr( aboveGroundWallAreaW * m2_unitConv, 2 );
-			tableBody( wwrcTotal, wwrrAbvGndWall ) = RealToStr( TotalAboveGroundWallArea * m2_unitConv, 2 );
+			tableBody( wwrcNorth, wwrrAbvGndWall ) = RealToStr( aboveGroundWallAreaN * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcSouth, wwrrAbvGndWall ) = RealToStr( aboveGroundWallAreaS * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcEast, wwrrAbvGndWall ) = RealToStr( aboveGroundWallAreaE * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcWest, wwrrAbvGndWall ) = RealToStr( aboveGroundWallAreaW * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcTotal, wwrrAbvGndWall ) = RealToStr( TotalAboveGroundWallArea * WriteVeriSumTable_m2_unitConv, 2 );
 
-			tableBody( wwrcNorth, wwrrWindow ) = RealToStr( windowAreaN * m2_unitConv, 2 );
-			tableBody( wwrcSouth, wwrrWindow ) = RealToStr( windowAreaS * m2_unitConv, 2 );
-			tableBody( wwrcEast, wwrrWindow ) = RealToStr( windowAreaE * m2_unitConv, 2 );
-			tableBody( wwrcWest, wwrrWindow ) = RealToStr( windowAreaW * m2_unitConv, 2 );
-			tableBody( wwrcTotal, wwrrWindow ) = RealToStr( TotalWindowArea * m2_unitConv, 2 );
+			tableBody( wwrcNorth, wwrrWindow ) = RealToStr( windowAreaN * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcSouth, wwrrWindow ) = RealToStr( windowAreaS * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcEast, wwrrWindow ) = RealToStr( windowAreaE * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcWest, wwrrWindow ) = RealToStr( windowAreaW * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcTotal, wwrrWindow ) = RealToStr( TotalWindowArea * WriteVeriSumTable_m2_unitConv, 2 );
 
 			tableBody( wwrcNorth, wwrrWWR ) = RealToStr( 100.0 * SafeDivide( windowAreaN, wallAreaN ), 2 );
 			tableBody( wwrcSouth, wwrrWWR ) = RealToStr( 100.0 * SafeDivide( windowAreaS, wallAreaS ), 2 );
@@ -9807,9 +10089,9 @@ namespace OutputReportTabular {
 			columnHead( wwrcSouth ) = "South (135 to 225 deg)";
 			columnHead( wwrcWest ) = "West (225 to 315 deg)";
 
-			rowHead( wwrrWall ) = "Gross Wall Area " + m2_unitName;
-			rowHead( wwrrAbvGndWall ) = "Above Ground Wall Area " + m2_unitName;
-			rowHead( wwrrWindow ) = "Window Opening Area " + m2_unitName;
+			rowHead( wwrrWall ) = "Gross Wall Area " + WriteVeriSumTable_m2_unitName;
+			rowHead( wwrrAbvGndWall ) = "Above Ground Wall Area " + WriteVeriSumTable_m2_unitName;
+			rowHead( wwrrWindow ) = "Window Opening Area " + WriteVeriSumTable_m2_unitName;
 			rowHead( wwrrWWR ) = "Gross Window-Wall Ratio [%]";
 			rowHead( wwrrAbvGndWWR ) = "Above Ground Window-Wall Ratio [%]";
 
@@ -9821,23 +10103,23 @@ namespace OutputReportTabular {
 
 			tableBody = "";
 
-			tableBody( wwrcNorth, wwrrWall ) = RealToStr( wallAreaNcond * m2_unitConv, 2 );
-			tableBody( wwrcSouth, wwrrWall ) = RealToStr( wallAreaScond * m2_unitConv, 2 );
-			tableBody( wwrcEast, wwrrWall ) = RealToStr( wallAreaEcond * m2_unitConv, 2 );
-			tableBody( wwrcWest, wwrrWall ) = RealToStr( wallAreaWcond * m2_unitConv, 2 );
-			tableBody( wwrcTotal, wwrrWall ) = RealToStr( TotalWallArea * m2_unitConv, 2 );
+			tableBody( wwrcNorth, wwrrWall ) = RealToStr( wallAreaNcond * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcSouth, wwrrWall ) = RealToStr( wallAreaScond * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcEast, wwrrWall ) = RealToStr( wallAreaEcond * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcWest, wwrrWall ) = RealToStr( wallAreaWcond * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcTotal, wwrrWall ) = RealToStr( TotalWallArea * WriteVeriSumTable_m2_unitConv, 2 );
 
-			tableBody( wwrcNorth, wwrrAbvGndWall ) = RealToStr( aboveGroundWallAreaNcond * m2_unitConv, 2 );
-			tableBody( wwrcSouth, wwrrAbvGndWall ) = RealToStr( aboveGroundWallAreaScond * m2_unitConv, 2 );
-			tableBody( wwrcEast, wwrrAbvGndWall ) = RealToStr( aboveGroundWallAreaEcond * m2_unitConv, 2 );
-			tableBody( wwrcWest, wwrrAbvGndWall ) = RealToStr( aboveGroundWallAreaWcond * m2_unitConv, 2 );
-			tableBody( wwrcTotal, wwrrAbvGndWall ) = RealToStr( TotalAboveGroundWallArea * m2_unitConv, 2 );
+			tableBody( wwrcNorth, wwrrAbvGndWall ) = RealToStr( aboveGroundWallAreaNcond * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcSouth, wwrrAbvGndWall ) = RealToStr( aboveGroundWallAreaScond * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcEast, wwrrAbvGndWall ) = RealToStr( aboveGroundWallAreaEcond * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcWest, wwrrAbvGndWall ) = RealToStr( aboveGroundWallAreaWcond * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcTotal, wwrrAbvGndWall ) = RealToStr( TotalAboveGroundWallArea * WriteVeriSumTable_m2_unitConv, 2 );
 
-			tableBody( wwrcNorth, wwrrWindow ) = RealToStr( windowAreaNcond * m2_unitConv, 2 );
-			tableBody( wwrcSouth, wwrrWindow ) = RealToStr( windowAreaScond * m2_unitConv, 2 );
-			tableBody( wwrcEast, wwrrWindow ) = RealToStr( windowAreaEcond * m2_unitConv, 2 );
-			tableBody( wwrcWest, wwrrWindow ) = RealToStr( windowAreaWcond * m2_unitConv, 2 );
-			tableBody( wwrcTotal, wwrrWindow ) = RealToStr( TotalWindowArea * m2_unitConv, 2 );
+			tableBody( wwrcNorth, wwrrWindow ) = RealToStr( windowAreaNcond * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcSouth, wwrrWindow ) = RealToStr( windowAreaScond * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcEast, wwrrWindow ) = RealToStr( windowAreaEcond * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcWest, wwrrWindow ) = RealToStr( windowAreaWcond * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( wwrcTotal, wwrrWindow ) = RealToStr( TotalWindowArea * WriteVeriSumTable_m2_unitConv, 2 );
 
 			tableBody( wwrcNorth, wwrrWWR ) = RealToStr( 100.0 * SafeDivide( windowAreaNcond, wallAreaNcond ), 2 );
 			tableBody( wwrcSouth, wwrrWWR ) = RealToStr( 100.0 * SafeDivide( windowAreaScond, wallAreaScond ), 2 );
@@ -9866,8 +10148,8 @@ namespace OutputReportTabular {
 
 			columnHead( 1 ) = "Total";
 
-			rowHead( 1 ) = "Gross Roof Area " + m2_unitName;
-			rowHead( 2 ) = "Skylight Area " + m2_unitName;
+			rowHead( 1 ) = "Gross Roof Area " + WriteVeriSumTable_m2_unitName;
+			rowHead( 2 ) = "Skylight Area " + WriteVeriSumTable_m2_unitName;
 			rowHead( 3 ) = "Skylight-Roof Ratio [%]";
 
 			if ( DetailedWWR ) {
@@ -9876,8 +10158,8 @@ namespace OutputReportTabular {
 				gio::write( OutputFileDebug, fmtA ) << RoundSigDigits( roofArea, 2 ) + ',' + RoundSigDigits( skylightArea, 2 );
 			}
 
-			tableBody( 1, 1 ) = RealToStr( roofArea * m2_unitConv, 2 );
-			tableBody( 1, 2 ) = RealToStr( skylightArea * m2_unitConv, 2 );
+			tableBody( 1, 1 ) = RealToStr( roofArea * WriteVeriSumTable_m2_unitConv, 2 );
+			tableBody( 1, 2 ) = RealToStr( skylightArea * WriteVeriSumTable_m2_unitConv, 2 );
 			tableBody( 1, 3 ) = RealToStr( 100.0 * SafeDivide( skylightArea, roofArea ), 2 );
 
 			WriteSubtitle( "Skylight-Roof Ratio" );
@@ -9912,17 +10194,17 @@ namespace OutputReportTabular {
 			columnWidth = 14; //array assignment - same for all columns
 			tableBody.allocate( 12, NumOfZones + 4 );
 
-			columnHead( 1 ) = "Area " + m2_unitName;
+			columnHead( 1 ) = "Area " + WriteVeriSumTable_m2_unitName;
 			columnHead( 2 ) = "Conditioned (Y/N)";
 			columnHead( 3 ) = "Part of Total Floor Area (Y/N)";
 			columnHead( 4 ) = "Volume " + m3_unitName;
 			columnHead( 5 ) = "Multipliers";
-			columnHead( 6 ) = "Above Ground Gross Wall Area " + m2_unitName;
-			columnHead( 7 ) = "Underground Gross Wall Area " + m2_unitName;
-			columnHead( 8 ) = "Window Glass Area " + m2_unitName;
-			columnHead( 9 ) = "Opening Area " + m2_unitName;
+			columnHead( 6 ) = "Above Ground Gross Wall Area " + WriteVeriSumTable_m2_unitName;
+			columnHead( 7 ) = "Underground Gross Wall Area " + WriteVeriSumTable_m2_unitName;
+			columnHead( 8 ) = "Window Glass Area " + WriteVeriSumTable_m2_unitName;
+			columnHead( 9 ) = "Opening Area " + WriteVeriSumTable_m2_unitName;
 			columnHead( 10 ) = "Lighting " + Wm2_unitName;
-			columnHead( 11 ) = "People " + m2_unitName.substr( 0, len( m2_unitName ) - 1 ) + " per person" + m2_unitName[ len( m2_unitName ) - 1 ];
+			columnHead( 11 ) = "People " + WriteVeriSumTable_m2_unitName.substr( 0, len( WriteVeriSumTable_m2_unitName ) - 1 ) + " per person" + WriteVeriSumTable_m2_unitName[ len( WriteVeriSumTable_m2_unitName ) - 1 ];
 			columnHead( 12 ) = "Plug and Process " + Wm2_unitName;
 
 			rowHead = "";
@@ -9951,7 +10233,7 @@ namespace OutputReportTabular {
 					tableBody( 3, iZone ) = "No";
 					usezoneFloorArea = false;
 				}
-				tableBody( 1, iZone ) = RealToStr( Zone( iZone ).FloorArea * m2_unitConv, 2 );
+				tableBody( 1, iZone ) = RealToStr( Zone( iZone ).FloorArea * WriteVeriSumTable_m2_unitConv, 2 );
 				tableBody( 4, iZone ) = RealToStr( Zone( iZone ).Volume * m3_unitConv, 2 );
 				//no unit conversion necessary since done automatically
 				PreDefTableEntry( pdchLeedSutSpArea, Zone( iZone ).Name, Zone( iZone ).FloorArea, 2 );
@@ -9963,10 +10245,10 @@ namespace OutputReportTabular {
 					PreDefTableEntry( pdchLeedSutUnArea, Zone( iZone ).Name, Zone( iZone ).FloorArea, 2 );
 				}
 				tableBody( 5, iZone ) = RealToStr( mult, 2 );
-				tableBody( 6, iZone ) = RealToStr( Zone( iZone ).ExtGrossWallArea * m2_unitConv, 2 );
-				tableBody( 7, iZone) = RealToStr(Zone(iZone).ExtGrossGroundWallArea * m2_unitConv, 2);
-				tableBody( 8, iZone ) = RealToStr( zoneGlassArea(iZone) * m2_unitConv, 2 );
-				tableBody( 9, iZone ) = RealToStr( zoneOpeningArea(iZone) * m2_unitConv, 2 );
+				tableBody( 6, iZone ) = RealToStr( Zone( iZone ).ExtGrossWallArea * WriteVeriSumTable_m2_unitConv, 2 );
+				tableBody( 7, iZone) = RealToStr(Zone(iZone).ExtGrossGroundWallArea * WriteVeriSumTable_m2_unitConv, 2);
+				tableBody( 8, iZone ) = RealToStr( zoneGlassArea(iZone) * WriteVeriSumTable_m2_unitConv, 2 );
+				tableBody( 9, iZone ) = RealToStr( zoneOpeningArea(iZone) * WriteVeriSumTable_m2_unitConv, 2 );
 				// lighting density
 				totLightPower = 0.0;
 				for ( iLight = 1; iLight <= TotLights; ++iLight ) {
@@ -9985,7 +10267,7 @@ namespace OutputReportTabular {
 					}
 				}
 				if ( totNumPeople > 0 ) {
-					tableBody( 11, iZone ) = RealToStr( Zone( iZone ).FloorArea * m2_unitConv / totNumPeople, 2 );
+					tableBody( 11, iZone ) = RealToStr( Zone( iZone ).FloorArea * WriteVeriSumTable_m2_unitConv / totNumPeople, 2 );
 				}
 				// plug and process density
 				totPlugProcess = 0.0;
@@ -10067,18 +10349,18 @@ namespace OutputReportTabular {
 				}
 			}
 			for ( iTotal = 1; iTotal <= 4; ++iTotal ) {
-				tableBody( 1, NumOfZones + iTotal ) = RealToStr( zstArea( iTotal ) * m2_unitConv, 2 );
+				tableBody( 1, NumOfZones + iTotal ) = RealToStr( zstArea( iTotal ) * WriteVeriSumTable_m2_unitConv, 2 );
 				tableBody( 4, NumOfZones + iTotal ) = RealToStr( zstVolume( iTotal ) * m3_unitConv, 2 );
-				tableBody( 6, NumOfZones + iTotal ) = RealToStr( zstWallArea( iTotal ) * m2_unitConv, 2 );
-				tableBody( 7, NumOfZones + iTotal) = RealToStr( zstUndWallArea( iTotal ) * m2_unitConv, 2);
-				tableBody( 8, NumOfZones + iTotal) = RealToStr( zstWindowArea( iTotal ) * m2_unitConv, 2);
-				tableBody( 9, NumOfZones + iTotal ) = RealToStr( zstOpeningArea( iTotal ) * m2_unitConv, 2 );
+				tableBody( 6, NumOfZones + iTotal ) = RealToStr( zstWallArea( iTotal ) * WriteVeriSumTable_m2_unitConv, 2 );
+				tableBody( 7, NumOfZones + iTotal) = RealToStr( zstUndWallArea( iTotal ) * WriteVeriSumTable_m2_unitConv, 2);
+				tableBody( 8, NumOfZones + iTotal) = RealToStr( zstWindowArea( iTotal ) * WriteVeriSumTable_m2_unitConv, 2);
+				tableBody( 9, NumOfZones + iTotal ) = RealToStr( zstOpeningArea( iTotal ) * WriteVeriSumTable_m2_unitConv, 2 );
 				if ( zstArea( iTotal ) != 0 ) {
 					tableBody( 10, NumOfZones + iTotal ) = RealToStr( zstLight( iTotal ) * Wm2_unitConv / zstArea( iTotal ), 4 );
 					tableBody( 12, NumOfZones + iTotal ) = RealToStr( zstPlug( iTotal ) * Wm2_unitConv / zstArea( iTotal ), 4 );
 				}
 				if ( zstPeople( iTotal ) != 0 ) {
-					tableBody( 11, NumOfZones + iTotal ) = RealToStr( zstArea( iTotal ) * m2_unitConv / zstPeople( iTotal ), 2 );
+					tableBody( 11, NumOfZones + iTotal ) = RealToStr( zstArea( iTotal ) * WriteVeriSumTable_m2_unitConv / zstPeople( iTotal ), 2 );
 				}
 			}
 			PreDefTableEntry( pdchLeedSutSpArea, "Totals", zstArea( grandTotal ), 2 );
@@ -10135,7 +10417,6 @@ namespace OutputReportTabular {
 		Array1D_int columnWidth;
 		Array1D_string rowHead;
 		Array2D_string tableBody;
-		static int numPeopleAdaptive( 0 );
 		int i;
 		Array1D_int peopleInd; // Index the relevant people
 
@@ -10480,11 +10761,6 @@ namespace OutputReportTabular {
 		int loopLimit;
 		int iTableEntry;
 		int jUnique;
-		static std::string curColHeadWithSI;
-		static std::string curColHead;
-		static int indexUnitConv( 0 );
-		static Real64 curValueSI( 0.0 );
-		static Real64 curValue( 0.0 );
 
 		if ( displayComponentSizing ) {
 			WriteReportHeaders( "Component Sizing Summary", "Entire Facility", isAverage );
@@ -11052,12 +11328,6 @@ namespace OutputReportTabular {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int ZoneNum( 0 );
-		static int SurfNum( 0 );
-		static int TimeStep( 0 );
-		static int TimeOfPulse( 0 );
-		static int CoolDesSelected( 0 ); // design day selected for cooling
-		static int HeatDesSelected( 0 ); // design day selected for heating
 		int i;
 		Real64 diff;
 
@@ -11079,12 +11349,12 @@ namespace OutputReportTabular {
 					}
 				}
 				if ( TimeOfPulse == 0 ) TimeOfPulse = 1;
-				for ( TimeStep = TimeOfPulse; TimeStep <= NumOfTimeStepInHour * 24; ++TimeStep ) {
+				for ( ComputeLoadComponentDecayCurveTimeStep = TimeOfPulse; ComputeLoadComponentDecayCurveTimeStep <= NumOfTimeStepInHour * 24; ++ComputeLoadComponentDecayCurveTimeStep ) {
 					if ( radiantPulseReceived( CoolDesSelected, SurfNum ) != 0.0 ) {
-						diff = loadConvectedWithPulse( CoolDesSelected, TimeStep, SurfNum ) - loadConvectedNormal( CoolDesSelected, TimeStep, SurfNum );
-						decayCurveCool( TimeStep - TimeOfPulse + 1, SurfNum ) = -diff / radiantPulseReceived( CoolDesSelected, SurfNum );
+						diff = loadConvectedWithPulse( CoolDesSelected, ComputeLoadComponentDecayCurveTimeStep, SurfNum ) - loadConvectedNormal( CoolDesSelected, ComputeLoadComponentDecayCurveTimeStep, SurfNum );
+						decayCurveCool( ComputeLoadComponentDecayCurveTimeStep - TimeOfPulse + 1, SurfNum ) = -diff / radiantPulseReceived( CoolDesSelected, SurfNum );
 					} else {
-						decayCurveCool( TimeStep - TimeOfPulse + 1, SurfNum ) = 0.0;
+						decayCurveCool( ComputeLoadComponentDecayCurveTimeStep - TimeOfPulse + 1, SurfNum ) = 0.0;
 					}
 				}
 			}
@@ -11099,12 +11369,12 @@ namespace OutputReportTabular {
 					}
 				}
 				if ( TimeOfPulse == 0 ) TimeOfPulse = 1;
-				for ( TimeStep = TimeOfPulse; TimeStep <= NumOfTimeStepInHour * 24; ++TimeStep ) {
+				for ( ComputeLoadComponentDecayCurveTimeStep = TimeOfPulse; ComputeLoadComponentDecayCurveTimeStep <= NumOfTimeStepInHour * 24; ++ComputeLoadComponentDecayCurveTimeStep ) {
 					if ( radiantPulseReceived( HeatDesSelected, SurfNum ) != 0.0 ) {
-						diff = loadConvectedWithPulse( HeatDesSelected, TimeStep, SurfNum ) - loadConvectedNormal( HeatDesSelected, TimeStep, SurfNum );
-						decayCurveHeat( TimeStep - TimeOfPulse + 1, SurfNum ) = -diff / radiantPulseReceived( HeatDesSelected, SurfNum );
+						diff = loadConvectedWithPulse( HeatDesSelected, ComputeLoadComponentDecayCurveTimeStep, SurfNum ) - loadConvectedNormal( HeatDesSelected, ComputeLoadComponentDecayCurveTimeStep, SurfNum );
+						decayCurveHeat( ComputeLoadComponentDecayCurveTimeStep - TimeOfPulse + 1, SurfNum ) = -diff / radiantPulseReceived( HeatDesSelected, SurfNum );
 					} else {
-						decayCurveHeat( TimeStep - TimeOfPulse + 1, SurfNum ) = 0.0;
+						decayCurveHeat( ComputeLoadComponentDecayCurveTimeStep - TimeOfPulse + 1, SurfNum ) = 0.0;
 					}
 				}
 			}
@@ -11159,19 +11429,16 @@ namespace OutputReportTabular {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int iSurf( 0 );
-		static int ZoneNum( 0 );
-		static int TimeStepInDay( 0 );
 
 		if ( CompLoadReportIsReq && ! isPulseZoneSizing ) {
 			TimeStepInDay = ( HourOfDay - 1 ) * NumOfTimeStepInHour + TimeStep;
 			feneCondInstantSeq( CurOverallSimDay, TimeStepInDay, _ ) = 0.0;
 			for ( iSurf = 1; iSurf <= TotSurfaces; ++iSurf ) {
-				ZoneNum = Surface( iSurf ).Zone;
-				if ( ZoneNum == 0 ) continue;
+				GatherComponentLoadsSurfaceZoneNum = Surface( iSurf ).Zone;
+				if ( GatherComponentLoadsSurfaceZoneNum == 0 ) continue;
 				if ( Surface( iSurf ).Class != SurfaceClass_Window ) continue;
 				// IF (.not. ZoneEquipConfig(ZoneNum)%IsControlled) CYCLE
-				feneCondInstantSeq( CurOverallSimDay, TimeStepInDay, ZoneNum ) += WinGainConvGlazToZoneRep( iSurf ) + WinGainConvGlazShadGapToZoneRep( iSurf ) + WinGainConvShadeToZoneRep( iSurf ) + WinGainFrameDividerToZoneRep( iSurf );
+				feneCondInstantSeq( CurOverallSimDay, TimeStepInDay, GatherComponentLoadsSurfaceZoneNum ) += WinGainConvGlazToZoneRep( iSurf ) + WinGainConvGlazShadGapToZoneRep( iSurf ) + WinGainConvShadeToZoneRep( iSurf ) + WinGainFrameDividerToZoneRep( iSurf );
 				// for now assume zero instant solar - may change related
 				// to how blinds and shades absorb solar radiation and
 				// convect that heat that timestep.
@@ -11225,31 +11492,29 @@ namespace OutputReportTabular {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int iZone( 0 );
-		static int TimeStepInDay( 0 );
 
 		if ( CompLoadReportIsReq && ! isPulseZoneSizing ) {
-			TimeStepInDay = ( HourOfDay - 1 ) * NumOfTimeStepInHour + TimeStep;
-			for ( iZone = 1; iZone <= NumOfZones; ++iZone ) {
-				infilInstantSeq( CurOverallSimDay, TimeStepInDay, iZone ) = ( ( ZnAirRpt( iZone ).InfilHeatGain - ZnAirRpt( iZone ).InfilHeatLoss ) / ( TimeStepSys * SecInHour ) ); //zone infiltration
+			GatherComponentLoadsHVACTimeStepInDay = ( HourOfDay - 1 ) * NumOfTimeStepInHour + TimeStep;
+			for ( GatherComponentLoadsHVAC_iZone = 1; GatherComponentLoadsHVAC_iZone <= NumOfZones; ++GatherComponentLoadsHVAC_iZone ) {
+				infilInstantSeq( CurOverallSimDay, GatherComponentLoadsHVACTimeStepInDay, GatherComponentLoadsHVAC_iZone ) = ( ( ZnAirRpt( GatherComponentLoadsHVAC_iZone ).InfilHeatGain - ZnAirRpt( GatherComponentLoadsHVAC_iZone ).InfilHeatLoss ) / ( TimeStepSys * SecInHour ) ); //zone infiltration
 				if ( SimulateAirflowNetwork > AirflowNetworkControlSimple ) {
-					infilInstantSeq( CurOverallSimDay, TimeStepInDay, iZone ) += ( AirflowNetworkReportData( iZone ).MultiZoneInfiSenGainW - AirflowNetworkReportData( iZone ).MultiZoneInfiSenLossW ); //air flow network
+					infilInstantSeq( CurOverallSimDay, GatherComponentLoadsHVACTimeStepInDay, GatherComponentLoadsHVAC_iZone ) += ( AirflowNetworkReportData( GatherComponentLoadsHVAC_iZone ).MultiZoneInfiSenGainW - AirflowNetworkReportData( GatherComponentLoadsHVAC_iZone ).MultiZoneInfiSenLossW ); //air flow network
 				}
-				infilLatentSeq( CurOverallSimDay, TimeStepInDay, iZone ) = ( ( ZnAirRpt( iZone ).InfilLatentGain - ZnAirRpt( iZone ).InfilLatentLoss ) / ( TimeStepSys * SecInHour ) ); //zone infiltration
+				infilLatentSeq( CurOverallSimDay, GatherComponentLoadsHVACTimeStepInDay, GatherComponentLoadsHVAC_iZone ) = ( ( ZnAirRpt( GatherComponentLoadsHVAC_iZone ).InfilLatentGain - ZnAirRpt( GatherComponentLoadsHVAC_iZone ).InfilLatentLoss ) / ( TimeStepSys * SecInHour ) ); //zone infiltration
 				if ( SimulateAirflowNetwork > AirflowNetworkControlSimple ) {
-					infilLatentSeq( CurOverallSimDay, TimeStepInDay, iZone ) += ( AirflowNetworkReportData( iZone ).MultiZoneInfiLatGainW - AirflowNetworkReportData( iZone ).MultiZoneInfiLatLossW ); //air flow network
+					infilLatentSeq( CurOverallSimDay, GatherComponentLoadsHVACTimeStepInDay, GatherComponentLoadsHVAC_iZone ) += ( AirflowNetworkReportData( GatherComponentLoadsHVAC_iZone ).MultiZoneInfiLatGainW - AirflowNetworkReportData( GatherComponentLoadsHVAC_iZone ).MultiZoneInfiLatLossW ); //air flow network
 				}
 
-				zoneVentInstantSeq( CurOverallSimDay, TimeStepInDay, iZone ) = ( ( ZnAirRpt( iZone ).VentilHeatGain - ZnAirRpt( iZone ).VentilHeatLoss ) / ( TimeStepSys * SecInHour ) ); //zone ventilation
-				zoneVentLatentSeq( CurOverallSimDay, TimeStepInDay, iZone ) = ( ( ZnAirRpt( iZone ).VentilLatentGain - ZnAirRpt( iZone ).VentilLatentLoss ) / ( TimeStepSys * SecInHour ) ); //zone ventilation
+				zoneVentInstantSeq( CurOverallSimDay, GatherComponentLoadsHVACTimeStepInDay, GatherComponentLoadsHVAC_iZone ) = ( ( ZnAirRpt( GatherComponentLoadsHVAC_iZone ).VentilHeatGain - ZnAirRpt( GatherComponentLoadsHVAC_iZone ).VentilHeatLoss ) / ( TimeStepSys * SecInHour ) ); //zone ventilation
+				zoneVentLatentSeq( CurOverallSimDay, GatherComponentLoadsHVACTimeStepInDay, GatherComponentLoadsHVAC_iZone ) = ( ( ZnAirRpt( GatherComponentLoadsHVAC_iZone ).VentilLatentGain - ZnAirRpt( GatherComponentLoadsHVAC_iZone ).VentilLatentLoss ) / ( TimeStepSys * SecInHour ) ); //zone ventilation
 
-				interZoneMixInstantSeq( CurOverallSimDay, TimeStepInDay, iZone ) = ( ( ZnAirRpt( iZone ).MixHeatGain - ZnAirRpt( iZone ).MixHeatLoss ) / ( TimeStepSys * SecInHour ) ); //zone mixing
+				interZoneMixInstantSeq( CurOverallSimDay, GatherComponentLoadsHVACTimeStepInDay, GatherComponentLoadsHVAC_iZone ) = ( ( ZnAirRpt( GatherComponentLoadsHVAC_iZone ).MixHeatGain - ZnAirRpt( GatherComponentLoadsHVAC_iZone ).MixHeatLoss ) / ( TimeStepSys * SecInHour ) ); //zone mixing
 				if ( SimulateAirflowNetwork > AirflowNetworkControlSimple ) {
-					interZoneMixInstantSeq( CurOverallSimDay, TimeStepInDay, iZone ) += ( AirflowNetworkReportData( iZone ).MultiZoneMixSenGainW - AirflowNetworkReportData( iZone ).MultiZoneMixSenLossW ); //air flow network
+					interZoneMixInstantSeq( CurOverallSimDay, GatherComponentLoadsHVACTimeStepInDay, GatherComponentLoadsHVAC_iZone ) += ( AirflowNetworkReportData( GatherComponentLoadsHVAC_iZone ).MultiZoneMixSenGainW - AirflowNetworkReportData( GatherComponentLoadsHVAC_iZone ).MultiZoneMixSenLossW ); //air flow network
 				}
-				interZoneMixLatentSeq( CurOverallSimDay, TimeStepInDay, iZone ) = ( ( ZnAirRpt( iZone ).MixLatentGain - ZnAirRpt( iZone ).MixLatentLoss ) / ( TimeStepSys * SecInHour ) ); //zone mixing
+				interZoneMixLatentSeq( CurOverallSimDay, GatherComponentLoadsHVACTimeStepInDay, GatherComponentLoadsHVAC_iZone ) = ( ( ZnAirRpt( GatherComponentLoadsHVAC_iZone ).MixLatentGain - ZnAirRpt( GatherComponentLoadsHVAC_iZone ).MixLatentLoss ) / ( TimeStepSys * SecInHour ) ); //zone mixing
 				if ( SimulateAirflowNetwork > AirflowNetworkControlSimple ) {
-					interZoneMixLatentSeq( CurOverallSimDay, TimeStepInDay, iZone ) += ( AirflowNetworkReportData( iZone ).MultiZoneMixLatGainW - AirflowNetworkReportData( iZone ).MultiZoneMixLatLossW ); //air flow network
+					interZoneMixLatentSeq( CurOverallSimDay, GatherComponentLoadsHVACTimeStepInDay, GatherComponentLoadsHVAC_iZone ) += ( AirflowNetworkReportData( GatherComponentLoadsHVAC_iZone ).MultiZoneMixLatGainW - AirflowNetworkReportData( GatherComponentLoadsHVAC_iZone ).MultiZoneMixLatLossW ); //air flow network
 				}
 			}
 		}
@@ -13573,7 +13838,6 @@ namespace OutputReportTabular {
 		int kColumn;
 		int curTable;
 		int curCol;
-		static Real64 BigNum( 0.0 );
 
 		for ( iInput = 1; iInput <= MonthlyInputCount; ++iInput ) {
 			for ( jTable = 1; jTable <= MonthlyInput( iInput ).numTables; ++jTable ) {
@@ -13583,10 +13847,10 @@ namespace OutputReportTabular {
 					MonthlyColumns( curCol ).timeStamp = 0;
 					MonthlyColumns( curCol ).duration = 0.0;
 					if ( MonthlyColumns( curCol ).aggType == aggTypeMaximum || MonthlyColumns( curCol ).aggType == aggTypeMaximumDuringHoursShown ){
-						MonthlyColumns( curCol ).reslt = -huge( BigNum );
+						MonthlyColumns( curCol ).reslt = -huge( ResetMonthlyGatheringBigNum );
 					}
 					else if ( MonthlyColumns( curCol ).aggType == aggTypeMinimum || MonthlyColumns( curCol ).aggType == aggTypeMinimumDuringHoursShown ){
-						MonthlyColumns( curCol ).reslt = huge( BigNum );
+						MonthlyColumns( curCol ).reslt = huge( ResetMonthlyGatheringBigNum );
 					}
 					else {
 						MonthlyColumns( curCol ).reslt = 0.0;
@@ -14032,7 +14296,6 @@ namespace OutputReportTabular {
 		// FUNCTION ARGUMENT DEFINITIONS:
 
 		// FUNCTION PARAMETER DEFINITIONS:
-		static Array1D< gio::Fmt > formDigits( {0,9}, { "(F12.0)", "(F12.1)", "(F12.2)", "(F12.3)", "(F12.4)", "(F12.5)", "(F12.6)", "(F12.7)", "(F12.8)", "(F12.9)" } ); // formDigits(0) | formDigits(1) | formDigits(2) | formDigits(3) | formDigits(4) | formDigits(5) | formDigits(6) | formDigits(7) | formDigits(8) | formDigits(9)
 		static Array1D< Real64 > const maxvalDigits( {0,9}, { 9999999999.0, 999999999.0, 99999999.0, 9999999.0, 999999.0, 99999.0, 9999.0, 999.0, 99.0, 9.0 } ); // maxvalDigits(0) | maxvalDigits(1) | maxvalDigits(2) | maxvalDigits(3) | maxvalDigits(4) | maxvalDigits(5) | maxvalDigits(6) | maxvalDigits(7) | maxvalDigits(8) | maxvalDigits(9)
 		static gio::Fmt fmtd( "(E12.6)" );
 
@@ -15083,8 +15346,6 @@ Label900: ;
 		//    na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int found( 0 );
-		static int iUnit( 0 );
 
 		for ( iUnit = 1; iUnit <= UnitConvSize; ++iUnit ) {
 			if ( SameString( UnitConv( iUnit ).siName, SIunit ) ) {
@@ -15206,19 +15467,17 @@ Label900: ;
 		//    na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int found( 0 );
-		static int iUnit( 0 );
 
-		for ( iUnit = 1; iUnit <= UnitConvSize; ++iUnit ) {
-			if ( SameString( UnitConv( iUnit ).siName, SIunit ) ) {
-				if ( SameString( UnitConv( iUnit ).ipName, IPunit ) ) {
-					found = iUnit;
+		for ( getSpecificUnitIndex_iUnit = 1; getSpecificUnitIndex_iUnit <= UnitConvSize; ++getSpecificUnitIndex_iUnit ) {
+			if ( SameString( UnitConv( getSpecificUnitIndex_iUnit ).siName, SIunit ) ) {
+				if ( SameString( UnitConv( getSpecificUnitIndex_iUnit ).ipName, IPunit ) ) {
+					getSpecificUnitIndex_found = getSpecificUnitIndex_iUnit;
 					break;
 				}
 			}
 		}
-		if ( found != 0 ) {
-			getSpecificUnitIndex = found;
+		if ( getSpecificUnitIndex_found != 0 ) {
+			getSpecificUnitIndex = getSpecificUnitIndex_found;
 		} else {
 			getSpecificUnitIndex = 0.0;
 		}
@@ -555,6 +555,76 @@ namespace OutputReportTabular {
 
 	};
 
+	struct MonthlyGatherType
+	{
+		// Members
+		int table; // index to MonthlyTables
+		int column; // index to MonthlyColumns
+		int lastColumn; // last MonthlyColumns entry of the table, end of the scans for dependent columns
+		int aggType; // index to the type of aggregation (see list of parameters)
+		bool isSummed; // Variable is summed rather than averaged
+		int typeOfVar; // 0=not found, 1=integer, 2=real, 3=meter
+		int varNum; // variable or meter number
+		Real64 const * valuePtr; // the real variable itself, null if the value is found through GetInternalVariableValue
+
+		// Default Constructor
+		MonthlyGatherType() :
+			table( 0 ),
+			column( 0 ),
+			lastColumn( 0 ),
+			aggType( 0 ),
+			isSummed( false ),
+			typeOfVar( 0 ),
+			varNum( 0 ),
+			valuePtr( nullptr )
+		{}
+
+	};
+
+	struct BinGatherType
+	{
+		// Members
+		int binObj; // index to OutputTableBinned
+		int repIndex; // index to the bin results of the variable
+		Real64 intervalStart; // The lowest value for the intervals being binned into.
+		Real64 intervalSize; // The size of the bins starting with Interval start.
+		Real64 topValue; // upper end of the highest bin
+		Real64 roundFactor; // values are rounded to the nearest 1/roundFactor, as shown in the report
+		bool isSummed; // Variable is summed rather than averaged
+		int typeOfVar; // 0=not found, 1=integer, 2=real, 3=meter
+		int varNum; // variable or meter number
+		Real64 const * valuePtr; // the real variable itself, null if the value is found through GetInternalVariableValue
+
+		// Default Constructor
+		BinGatherType() :
+			binObj( 0 ),
+			repIndex( 0 ),
+			intervalStart( 0.0 ),
+			intervalSize( 0.0 ),
+			topValue( 0.0 ),
+			roundFactor( 1.0 ),
+			isSummed( false ),
+			typeOfVar( 0 ),
+			varNum( 0 ),
+			valuePtr( nullptr )
+		{}
+
+	};
+
+	struct MeterGatherType
+	{
+		// Members
+		int meterNum; // meter number
+		int index; // linear index of the gathering array element the meter is added to
+
+		// Default Constructor
+		MeterGatherType() :
+			meterNum( 0 ),
+			index( 0 )
+		{}
+
+	};
+
 	struct TOCEntriesType
 	{
 		// Members
@@ -602,6 +672,14 @@ namespace OutputReportTabular {
 	extern Array1D< MonthlyInputType > MonthlyInput;
 	extern Array1D< MonthlyTablesType > MonthlyTables;
 	extern Array1D< MonthlyColumnsType > MonthlyColumns;
+	extern Array1D< MonthlyGatherType > MonthlyGatherZone; // monthly columns gathered each zone time step, in table order
+	extern Array1D< MonthlyGatherType > MonthlyGatherHVAC; // monthly columns gathered each HVAC time step, in table order
+	extern Array1D< BinGatherType > BinGatherZone; // binned variables gathered each zone time step
+	extern Array1D< BinGatherType > BinGatherHVAC; // binned variables gathered each HVAC time step
+	extern Array1D< MeterGatherType > BEPSGatherTotals; // meters added to gatherTotalsBEPS
+	extern Array1D< MeterGatherType > BEPSGatherEndUse; // meters added to gatherEndUseBEPS
+	extern Array1D< MeterGatherType > BEPSGatherEndUseSub; // meters added to gatherEndUseSubBEPS
+	extern Array1D< MeterGatherType > BEPSGatherSource; // meters added to gatherTotalsSource
 	extern Array1D< TOCEntriesType > TOCEntries;
 	extern Array1D< UnitConvType > UnitConv;
 
@@ -612,6 +690,9 @@ namespace OutputReportTabular {
 	void
 	UpdateTabularReports( int const IndexTypeKey ); // What kind of data to update (Zone, HVAC)
 
+	void
+	GetInputTabularReports();
+
 	//======================================================================================================================
 	//======================================================================================================================
 
@@ -685,6 +766,21 @@ namespace OutputReportTabular {
 	void
 	WriteTableOfContents();
 
+	void
+	SetupMonthlyGatherPlan();
+
+	void
+	SetupBinGatherPlan();
+
+	void
+	SetupBEPSGatherPlan();
+
+	Real64 const *
+	GetGatherValuePtr(
+		int const typeOfVar, // 0=not found, 1=integer, 2=real, 3=meter
+		int const varNum // variable or meter number
+	);
+
 	//======================================================================================================================
 	//======================================================================================================================
 
@@ -1435,6 +1435,13 @@ namespace EnergyPlus {
 			return ret;
 		}
 
+		std::vector<AnnualFieldSet> &
+		AnnualTable::fieldSets(){
+			// the columns of the table with the values gathered for each row, so that the gathering of a
+			// segment of a split run period can be saved and merged into the gathering of another segment.
+			return m_annualFields;
+		}
+
 	} //OutputReportTabularAnnual
 
 } // EnergyPlus
@@ -160,6 +160,9 @@ public:
 	std::vector<std::string>
 	inspectTableFieldSets(int);
 
+	std::vector<AnnualFieldSet> &
+	fieldSets();
+
 	void
 	clearTable();
 
@@ -86,6 +86,29 @@ namespace EnergyPlus {
 
 static gio::Fmt fmtLD( "*" );
 
+namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+	bool optiondone( false );
+	std::string lastoption;
+}
+
+namespace OutputReports {
+
+	// Clears the global data in OutputReports.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		optiondone = false;
+		lastoption.clear();
+	}
+
+} // OutputReports
+
 void
 ReportSurfaces()
 {
@@ -266,8 +289,6 @@ LinesOut( std::string const & option )
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	static bool optiondone( false );
-	static std::string lastoption;
 	int unit; // Unit number on which to write file
 	int surf; // Loop variable for surfaces
 	int vert; // Loop counter
@@ -378,24 +399,24 @@ DXFOut(
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	static Array1D< Real64 > StemX( 4, -10.0 );
-	static Array1D< Real64 > StemY( 4, { 3.0, 3.0, 0.0, 0.0 } );
-	static Array1D< Real64 > StemZ( 4, { 0.1, 0.0, 0.0, 0.1 } );
-	static Array1D< Real64 > Head1X( 4, { -10.0, -10.0, -10.5, -10.5 } );
-	static Array1D< Real64 > Head1Y( 4, { 3.0, 3.0, 2.133975, 2.133975 } );
-	static Array1D< Real64 > Head1Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
-	static Array1D< Real64 > Head2X( 4, { -10.0, -10.0, -9.5, -9.5 } );
-	static Array1D< Real64 > Head2Y( 4, { 3.0, 3.0, 2.133975, 2.133975 } );
-	static Array1D< Real64 > Head2Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
-	static Array1D< Real64 > NSide1X( 4, -10.5 );
-	static Array1D< Real64 > NSide1Y( 4, { 4.5, 4.5, 3.5, 3.5 } );
-	static Array1D< Real64 > NSide1Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
-	static Array1D< Real64 > NSide2X( 4, { -10.5, -10.5, -9.5, -9.5 } );
-	static Array1D< Real64 > NSide2Y( 4, { 4.5, 4.5, 3.5, 3.5 } );
-	static Array1D< Real64 > NSide2Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
-	static Array1D< Real64 > NSide3X( 4, -9.5 );
-	static Array1D< Real64 > NSide3Y( 4, { 4.5, 4.5, 3.5, 3.5 } );
-	static Array1D< Real64 > NSide3Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
+	Array1D< Real64 > StemX( 4, -10.0 );
+	Array1D< Real64 > StemY( 4, { 3.0, 3.0, 0.0, 0.0 } );
+	Array1D< Real64 > StemZ( 4, { 0.1, 0.0, 0.0, 0.1 } );
+	Array1D< Real64 > Head1X( 4, { -10.0, -10.0, -10.5, -10.5 } );
+	Array1D< Real64 > Head1Y( 4, { 3.0, 3.0, 2.133975, 2.133975 } );
+	Array1D< Real64 > Head1Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
+	Array1D< Real64 > Head2X( 4, { -10.0, -10.0, -9.5, -9.5 } );
+	Array1D< Real64 > Head2Y( 4, { 3.0, 3.0, 2.133975, 2.133975 } );
+	Array1D< Real64 > Head2Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
+	Array1D< Real64 > NSide1X( 4, -10.5 );
+	Array1D< Real64 > NSide1Y( 4, { 4.5, 4.5, 3.5, 3.5 } );
+	Array1D< Real64 > NSide1Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
+	Array1D< Real64 > NSide2X( 4, { -10.5, -10.5, -9.5, -9.5 } );
+	Array1D< Real64 > NSide2Y( 4, { 4.5, 4.5, 3.5, 3.5 } );
+	Array1D< Real64 > NSide2Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
+	Array1D< Real64 > NSide3X( 4, -9.5 );
+	Array1D< Real64 > NSide3Y( 4, { 4.5, 4.5, 3.5, 3.5 } );
+	Array1D< Real64 > NSide3Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
 	//  integer, dimension(7) :: colorno=(/3,4,5,6,2,8,9/)
 	int unit; // Unit number on which to write file
 	int surf; // Loop variable for surfaces
@@ -409,10 +430,10 @@ DXFOut(
 	std::string TempZoneName;
 	std::string::size_type pos;
 	std::string ShadeType;
-	static bool ThickPolyline( false );
-	static bool RegularPolyline( false );
-	static std::string PolylineWidth( " 0.55" );
-	static bool TriangulateFace( false );
+	bool ThickPolyline( false );
+	bool RegularPolyline( false );
+	std::string PolylineWidth( " 0.55" );
+	bool TriangulateFace( false );
 	int ntri;
 	int svert;
 	int vv0;
@@ -906,24 +927,24 @@ DXFOutLines( std::string const & ColorScheme )
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	static Array1D< Real64 > StemX( 4, -10.0 );
-	static Array1D< Real64 > StemY( 4, { 3.0, 3.0, 0.0, 0.0 } );
-	static Array1D< Real64 > StemZ( 4, { 0.1, 0.0, 0.0, 0.1 } );
-	static Array1D< Real64 > Head1X( 4, { -10.0, -10.0, -10.5, -10.5 } );
-	static Array1D< Real64 > Head1Y( 4, { 3.0, 3.0, 2.133975, 2.133975 } );
-	static Array1D< Real64 > Head1Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
-	static Array1D< Real64 > Head2X( 4, { -10.0, -10.0, -9.5, -9.5 } );
-	static Array1D< Real64 > Head2Y( 4, { 3.0, 3.0, 2.133975, 2.133975 } );
-	static Array1D< Real64 > Head2Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
-	static Array1D< Real64 > NSide1X( 4, -10.5 );
-	static Array1D< Real64 > NSide1Y( 4, { 4.5, 4.5, 3.5, 3.5 } );
-	static Array1D< Real64 > NSide1Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
-	static Array1D< Real64 > NSide2X( 4, { -10.5, -10.5, -9.5, -9.5 } );
-	static Array1D< Real64 > NSide2Y( 4, { 4.5, 4.5, 3.5, 3.5 } );
-	static Array1D< Real64 > NSide2Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
-	static Array1D< Real64 > NSide3X( 4, -9.5 );
-	static Array1D< Real64 > NSide3Y( 4, { 4.5, 4.5, 3.5, 3.5 } );
-	static Array1D< Real64 > NSide3Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
+	Array1D< Real64 > StemX( 4, -10.0 );
+	Array1D< Real64 > StemY( 4, { 3.0, 3.0, 0.0, 0.0 } );
+	Array1D< Real64 > StemZ( 4, { 0.1, 0.0, 0.0, 0.1 } );
+	Array1D< Real64 > Head1X( 4, { -10.0, -10.0, -10.5, -10.5 } );
+	Array1D< Real64 > Head1Y( 4, { 3.0, 3.0, 2.133975, 2.133975 } );
+	Array1D< Real64 > Head1Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
+	Array1D< Real64 > Head2X( 4, { -10.0, -10.0, -9.5, -9.5 } );
+	Array1D< Real64 > Head2Y( 4, { 3.0, 3.0, 2.133975, 2.133975 } );
+	Array1D< Real64 > Head2Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
+	Array1D< Real64 > NSide1X( 4, -10.5 );
+	Array1D< Real64 > NSide1Y( 4, { 4.5, 4.5, 3.5, 3.5 } );
+	Array1D< Real64 > NSide1Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
+	Array1D< Real64 > NSide2X( 4, { -10.5, -10.5, -9.5, -9.5 } );
+	Array1D< Real64 > NSide2Y( 4, { 4.5, 4.5, 3.5, 3.5 } );
+	Array1D< Real64 > NSide2Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
+	Array1D< Real64 > NSide3X( 4, -9.5 );
+	Array1D< Real64 > NSide3Y( 4, { 4.5, 4.5, 3.5, 3.5 } );
+	Array1D< Real64 > NSide3Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
 	//  integer, dimension(7) :: colorno=(/3,4,5,6,2,8,9/)
 	int unit; // Unit number on which to write file
 	int surf; // Loop variable for surfaces
@@ -1331,24 +1352,24 @@ DXFOutWireFrame( std::string const & ColorScheme )
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	static Array1D< Real64 > StemX( 4, -10.0 );
-	static Array1D< Real64 > StemY( 4, { 3.0, 3.0, 0.0, 0.0 } );
-	static Array1D< Real64 > StemZ( 4, { 0.1, 0.0, 0.0, 0.1 } );
-	static Array1D< Real64 > Head1X( 4, { -10.0, -10.0, -10.5, -10.5 } );
-	static Array1D< Real64 > Head1Y( 4, { 3.0, 3.0, 2.133975, 2.133975 } );
-	static Array1D< Real64 > Head1Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
-	static Array1D< Real64 > Head2X( 4, { -10.0, -10.0, -9.5, -9.5 } );
-	static Array1D< Real64 > Head2Y( 4, { 3.0, 3.0, 2.133975, 2.133975 } );
-	static Array1D< Real64 > Head2Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
-	static Array1D< Real64 > NSide1X( 4, -10.5 );
-	static Array1D< Real64 > NSide1Y( 4, { 4.5, 4.5, 3.5, 3.5 } );
-	static Array1D< Real64 > NSide1Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
-	static Array1D< Real64 > NSide2X( 4, { -10.5, -10.5, -9.5, -9.5 } );
-	static Array1D< Real64 > NSide2Y( 4, { 4.5, 4.5, 3.5, 3.5 } );
-	static Array1D< Real64 > NSide2Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
-	static Array1D< Real64 > NSide3X( 4, -9.5 );
-	static Array1D< Real64 > NSide3Y( 4, { 4.5, 4.5, 3.5, 3.5 } );
-	static Array1D< Real64 > NSide3Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
+	Array1D< Real64 > StemX( 4, -10.0 );
+	Array1D< Real64 > StemY( 4, { 3.0, 3.0, 0.0, 0.0 } );
+	Array1D< Real64 > StemZ( 4, { 0.1, 0.0, 0.0, 0.1 } );
+	Array1D< Real64 > Head1X( 4, { -10.0, -10.0, -10.5, -10.5 } );
+	Array1D< Real64 > Head1Y( 4, { 3.0, 3.0, 2.133975, 2.133975 } );
+	Array1D< Real64 > Head1Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
+	Array1D< Real64 > Head2X( 4, { -10.0, -10.0, -9.5, -9.5 } );
+	Array1D< Real64 > Head2Y( 4, { 3.0, 3.0, 2.133975, 2.133975 } );
+	Array1D< Real64 > Head2Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
+	Array1D< Real64 > NSide1X( 4, -10.5 );
+	Array1D< Real64 > NSide1Y( 4, { 4.5, 4.5, 3.5, 3.5 } );
+	Array1D< Real64 > NSide1Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
+	Array1D< Real64 > NSide2X( 4, { -10.5, -10.5, -9.5, -9.5 } );
+	Array1D< Real64 > NSide2Y( 4, { 4.5, 4.5, 3.5, 3.5 } );
+	Array1D< Real64 > NSide2Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
+	Array1D< Real64 > NSide3X( 4, -9.5 );
+	Array1D< Real64 > NSide3Y( 4, { 4.5, 4.5, 3.5, 3.5 } );
+	Array1D< Real64 > NSide3Z( 4, { 0.1, 0.0, 0.0, 0.1 } );
 	//  integer, dimension(7) :: colorno=(/3,4,5,6,2,8,9/)
 	int unit; // Unit number on which to write file
 	int surf; // Loop variable for surfaces
@@ -1363,7 +1384,7 @@ DXFOutWireFrame( std::string const & ColorScheme )
 	std::string SaveZoneName;
 	std::string::size_type pos;
 	std::string ShadeType;
-	static std::string PolylineWidth( " 0.55" );
+	static std::string const PolylineWidth( " 0.55" );
 	std::string cSurfNum;
 	int surfcount;
 	int refpt;
@@ -2252,10 +2273,10 @@ VRMLOut(
 	std::string TempZoneName;
 	std::string::size_type pos;
 	std::string ShadeType;
-	static bool ThickPolyline( false );
-	static bool RegularPolyline( false );
-	static std::string PolylineWidth( " 0.55" );
-	static bool TriangulateFace( false );
+	bool ThickPolyline( false );
+	bool RegularPolyline( false );
+	std::string PolylineWidth( " 0.55" );
+	bool TriangulateFace( false );
 	int ntri;
 	int svert;
 	int vv0;
@@ -67,6 +67,15 @@
 
 namespace EnergyPlus {
 
+namespace OutputReports {
+
+	// Clears the global data in OutputReports.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
+} // OutputReports
+
 void
 ReportSurfaces();
 
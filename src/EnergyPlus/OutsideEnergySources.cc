@@ -127,6 +127,8 @@ namespace OutsideEnergySources {
 	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
 	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
 		bool SimOutsideEnergyGetInputFlag( true );
+		bool ErrorsFound( false ); // If errors detected in input
+		Real64 TempPlantMdot( 0.0 ); // local copy of plant flow
 	}
 	// Object Data
 	Array1D< OutsideEnergySourceSpecs > EnergySource;
@@ -140,6 +142,8 @@ namespace OutsideEnergySources {
 		SimOutsideEnergyGetInputFlag = true;
 		EnergySource.deallocate();
 		EnergySourceReport.deallocate();
+		ErrorsFound = false;
+		TempPlantMdot = 0.0;
 	}
 
 
@@ -297,7 +301,6 @@ namespace OutsideEnergySources {
 		int NumDistrictUnitsHeat;
 		int NumDistrictUnitsCool;
 		int IndexCounter;
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 
@@ -489,7 +492,6 @@ namespace OutsideEnergySources {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int TempTypeFlag( 0 );
-		static Real64 TempPlantMdot( 0.0 ); // local copy of plant flow
 		int LoopNum;
 		int LoopSideNum;
 		int BranchIndex;
@@ -157,6 +157,28 @@ namespace PackagedTerminalHeatPump {
 	namespace {
 		// clear_state variables
 		static bool MyOneTimeFlag( true ); // initialization flag
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool GetPTUnit_errFlag( false ); // Error flag returned during CALL to mining functions
+		bool ZoneEquipmentListNotChecked( true ); // False after the Zone Equipment List has been checked for items
+		Array1D_bool MyEnvrnFlag; // used for initializations each begin environment flag
+		Array1D_bool MySizeFlag; // used for sizing PTHP inputs one time
+		Array1D_bool MyFanFlag; // used for sizing PTHP fan inputs one time
+		Array1D_bool MyPlantScanFlag;
+		Array1D_bool MyZoneEqFlag; // used to set up zone equipment availability managers
+		Array1D< Real64 > ControlPTUnitOutputPar( 8 ); // Parameters passed to RegulaFalsi
+		Array1D< Real64 > CalcPTUnitPar( 3 );
+		int ATMixOutNode( 0 ); // outlet node of ATM Mixer
+		Real64 SimVariableSpeedHPPartLoadFrac( 0.0 ); // compressor part load fraction
+		Real64 SimVariableSpeedHPSpeedRatio( 0.0 ); // compressor speed ratio
+		int SimVariableSpeedHPSpeedNum( 1 ); // Speed number
+		Real64 TotalZoneLatentLoad; // Total ZONE heating load (not including outside air)
+		Array1D< Real64 > ControlVSHPOutputPar( 11 ); // Parameters passed to RegulaFalsi
+		int ErrCountCyc( 0 ); // Counter used to minimize the occurrence of output warnings
+		int ErrCountVar( 0 ); // Counter used to minimize the occurrence of output warnings
+		Array1D< Real64 > CalcVarSpeedHeatPumpPar( 3 );
+		int CalcVarSpeedHeatPumpATMixOutNode( 0 ); // outlet node of ATM Mixer
+		Real64 AverageUnitMassFlow( 0.0 ); // average supply air mass flow rate over time step
+		Real64 AverageOAMassFlow( 0.0 ); // average outdoor air mass flow rate over time step
 	}
 
 	// Data
@@ -219,6 +241,28 @@ namespace PackagedTerminalHeatPump {
 	clear_state()
 	{
 		MyOneTimeFlag = true;
+		ErrorsFound = false;
+		GetPTUnit_errFlag = false;
+		ZoneEquipmentListNotChecked = true;
+		MyEnvrnFlag.deallocate();
+		MySizeFlag.deallocate();
+		MyFanFlag.deallocate();
+		MyPlantScanFlag.deallocate();
+		MyZoneEqFlag.deallocate();
+		ControlPTUnitOutputPar = Array1D< Real64 >( 8 );
+		CalcPTUnitPar = Array1D< Real64 >( 3 );
+		ATMixOutNode = 0;
+		SimVariableSpeedHPPartLoadFrac = 0.0;
+		SimVariableSpeedHPSpeedRatio = 0.0;
+		SimVariableSpeedHPSpeedNum = 1;
+		TotalZoneLatentLoad = 0.0;
+		ControlVSHPOutputPar = Array1D< Real64 >( 11 );
+		ErrCountCyc = 0;
+		ErrCountVar = 0;
+		CalcVarSpeedHeatPumpPar = Array1D< Real64 >( 3 );
+		CalcVarSpeedHeatPumpATMixOutNode = 0;
+		AverageUnitMassFlow = 0.0;
+		AverageOAMassFlow = 0.0;
 	}
 
 
@@ -645,11 +689,9 @@ namespace PackagedTerminalHeatPump {
 		int MaxNumbers; // Maximum number of numeric fields in all objects
 		int NumFields; // Total number of fields in object
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		std::string CurrentModuleObject; // Object type for getting and error messages
-		static bool errFlag( false ); // Error flag returned during CALL to mining functions
 		Real64 FanVolFlow; // maximum supply air volumetric flow rate of fan
 		int TempNodeNum; // dummy variable to set up HW coil water inlet node
 		int SteamIndex; // dummy variable to set up steam coil steam inlet density
@@ -758,15 +800,15 @@ namespace PackagedTerminalHeatPump {
 
 			// check to see if local OA mixer specified
 			if ( !lAlphaBlanks( 6 ) ) {
-				errFlag = false;
-				ValidateComponent( PTUnit( PTUnitNum ).OAMixType, PTUnit( PTUnitNum ).OAMixName, errFlag, CurrentModuleObject );
-				if ( errFlag ) {
+				GetPTUnit_errFlag = false;
+				ValidateComponent( PTUnit( PTUnitNum ).OAMixType, PTUnit( PTUnitNum ).OAMixName, GetPTUnit_errFlag, CurrentModuleObject );
+				if ( GetPTUnit_errFlag ) {
 					ShowContinueError( "specified in " + CurrentModuleObject + " = \"" + PTUnit( PTUnitNum ).Name + "\"." );
 					ErrorsFound = true;
 				} else {
 					// OANodeNums = outside air mixer node numbers, OANodeNums(4) = outside air mixer mixed air node
-					OANodeNums = GetOAMixerNodeNumbers( PTUnit( PTUnitNum ).OAMixName, errFlag );
-					if ( errFlag ) {
+					OANodeNums = GetOAMixerNodeNumbers( PTUnit( PTUnitNum ).OAMixName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "that was specified in " + CurrentModuleObject + " = " + PTUnit( PTUnitNum ).Name );
 						ShowContinueError( "..OutdoorAir:Mixer is required. Enter an OutdoorAir:Mixer object with this name." );
 						ErrorsFound = true;
@@ -837,21 +879,21 @@ namespace PackagedTerminalHeatPump {
 
 			PTUnit( PTUnitNum ).FanType = Alphas( 7 );
 			PTUnit( PTUnitNum ).FanName = Alphas( 8 );
-			errFlag = false;
-			GetFanType( PTUnit( PTUnitNum ).FanName, PTUnit( PTUnitNum ).FanType_Num, errFlag, CurrentModuleObject, PTUnit( PTUnitNum ).Name );
+			GetPTUnit_errFlag = false;
+			GetFanType( PTUnit( PTUnitNum ).FanName, PTUnit( PTUnitNum ).FanType_Num, GetPTUnit_errFlag, CurrentModuleObject, PTUnit( PTUnitNum ).Name );
 			FanVolFlow = 0.0;
-			if ( errFlag ) {
+			if ( GetPTUnit_errFlag ) {
 				ShowContinueError( "specified in " + CurrentModuleObject + " = " + PTUnit( PTUnitNum ).Name );
 				ErrorsFound = true;
 			} else {
-				GetFanIndex( PTUnit( PTUnitNum ).FanName, PTUnit( PTUnitNum ).FanIndex, errFlag, CurrentModuleObject );
-				FanInletNodeNum = GetFanInletNode( PTUnit( PTUnitNum ).FanType, PTUnit( PTUnitNum ).FanName, errFlag );
-				FanOutletNodeNum = GetFanOutletNode( PTUnit( PTUnitNum ).FanType, PTUnit( PTUnitNum ).FanName, errFlag );
+				GetFanIndex( PTUnit( PTUnitNum ).FanName, PTUnit( PTUnitNum ).FanIndex, GetPTUnit_errFlag, CurrentModuleObject );
+				FanInletNodeNum = GetFanInletNode( PTUnit( PTUnitNum ).FanType, PTUnit( PTUnitNum ).FanName, GetPTUnit_errFlag );
+				FanOutletNodeNum = GetFanOutletNode( PTUnit( PTUnitNum ).FanType, PTUnit( PTUnitNum ).FanName, GetPTUnit_errFlag );
 				GetFanVolFlow( PTUnit( PTUnitNum ).FanIndex, FanVolFlow );
 				PTUnit( PTUnitNum ).ActualFanVolFlowRate = FanVolFlow;
 				// Get the fan's availability schedule
-				PTUnit( PTUnitNum ).FanAvailSchedPtr = GetFanAvailSchPtr( PTUnit( PTUnitNum ).FanType, PTUnit( PTUnitNum ).FanName, errFlag );
-				if ( errFlag ) {
+				PTUnit( PTUnitNum ).FanAvailSchedPtr = GetFanAvailSchPtr( PTUnit( PTUnitNum ).FanType, PTUnit( PTUnitNum ).FanName, GetPTUnit_errFlag );
+				if ( GetPTUnit_errFlag ) {
 					ShowContinueError( "...specified in " + CurrentModuleObject + " = " + PTUnit( PTUnitNum ).Name );
 					ErrorsFound = true;
 				}
@@ -870,11 +912,11 @@ namespace PackagedTerminalHeatPump {
 			if ( SameString( Alphas( 9 ), "Coil:Heating:DX:SingleSpeed" ) ) {
 				PTUnit( PTUnitNum ).DXHeatCoilType = Alphas( 9 );
 				//       PTUnit(PTUnitNum)%DXHeatCoilType_Num = CoilDX_HeatingEmpirical
-				errFlag = false;
-				GetDXCoilIndex( PTUnit( PTUnitNum ).DXHeatCoilName, PTUnit( PTUnitNum ).DXHeatCoilIndexNum, errFlag, PTUnit( PTUnitNum ).DXHeatCoilType );
-				HeatCoilInletNodeNum = GetDXCoilInletNode( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, errFlag );
-				HeatCoilOutletNodeNum = GetDXCoilOutletNode( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, errFlag );
-				if ( errFlag ) ShowContinueError( "...occurs in " + PTUnit( PTUnitNum ).UnitType + " \"" + PTUnit( PTUnitNum ).Name + "\"" );
+				GetPTUnit_errFlag = false;
+				GetDXCoilIndex( PTUnit( PTUnitNum ).DXHeatCoilName, PTUnit( PTUnitNum ).DXHeatCoilIndexNum, GetPTUnit_errFlag, PTUnit( PTUnitNum ).DXHeatCoilType );
+				HeatCoilInletNodeNum = GetDXCoilInletNode( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, GetPTUnit_errFlag );
+				HeatCoilOutletNodeNum = GetDXCoilOutletNode( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, GetPTUnit_errFlag );
+				if ( GetPTUnit_errFlag ) ShowContinueError( "...occurs in " + PTUnit( PTUnitNum ).UnitType + " \"" + PTUnit( PTUnitNum ).Name + "\"" );
 			} else if ( SameString( Alphas( 9 ), "COIL:HEATING:DX:VARIABLESPEED" ) ) {
 				PTUnit( PTUnitNum ).DXHeatCoilType = Alphas( 9 );
 				PTUnit( PTUnitNum ).DXHeatCoilType_Num = Coil_HeatingAirToAirVariableSpeed;
@@ -884,14 +926,14 @@ namespace PackagedTerminalHeatPump {
 					ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"." );
 					ErrorsFound = true;
 				} else {
-					errFlag = false;
-					PTUnit( PTUnitNum ).DXHeatCoilIndexNum = GetCoilIndexVariableSpeed( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, errFlag );
-					if ( errFlag ) {
+					GetPTUnit_errFlag = false;
+					PTUnit( PTUnitNum ).DXHeatCoilIndexNum = GetCoilIndexVariableSpeed( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"." );
 						ErrorsFound = true;
 					}
-					HeatCoilInletNodeNum = GetCoilInletNodeVariableSpeed( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, errFlag );
-					HeatCoilOutletNodeNum = GetCoilOutletNodeVariableSpeed( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, errFlag );
+					HeatCoilInletNodeNum = GetCoilInletNodeVariableSpeed( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, GetPTUnit_errFlag );
+					HeatCoilOutletNodeNum = GetCoilOutletNodeVariableSpeed( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, GetPTUnit_errFlag );
 				}
 			} else {
 				ShowSevereError( CurrentModuleObject + "=\"" + PTUnit( PTUnitNum ).Name + "\", invalid field" );
@@ -908,20 +950,20 @@ namespace PackagedTerminalHeatPump {
 				PTUnit( PTUnitNum ).DXCoolCoilType = Alphas( 11 );
 				if ( SameString( Alphas( 11 ), "Coil:Cooling:DX:SingleSpeed" ) ) {
 					PTUnit( PTUnitNum ).DXCoolCoilType_Num = CoilDX_CoolingSingleSpeed;
-					errFlag = false;
-					GetDXCoilIndex( PTUnit( PTUnitNum ).DXCoolCoilName, PTUnit( PTUnitNum ).DXCoolCoilIndexNum, errFlag, PTUnit( PTUnitNum ).DXCoolCoilType );
-					CoolCoilInletNodeNum = GetDXCoilInletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-					CoolCoilOutletNodeNum = GetDXCoilOutletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-					PTUnit( PTUnitNum ).CondenserNodeNum = GetCoilCondenserInletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-					if ( errFlag ) ShowContinueError( "...occurs in " + PTUnit( PTUnitNum ).UnitType + " \"" + PTUnit( PTUnitNum ).Name + "\"" );
+					GetPTUnit_errFlag = false;
+					GetDXCoilIndex( PTUnit( PTUnitNum ).DXCoolCoilName, PTUnit( PTUnitNum ).DXCoolCoilIndexNum, GetPTUnit_errFlag, PTUnit( PTUnitNum ).DXCoolCoilType );
+					CoolCoilInletNodeNum = GetDXCoilInletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+					CoolCoilOutletNodeNum = GetDXCoilOutletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+					PTUnit( PTUnitNum ).CondenserNodeNum = GetCoilCondenserInletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) ShowContinueError( "...occurs in " + PTUnit( PTUnitNum ).UnitType + " \"" + PTUnit( PTUnitNum ).Name + "\"" );
 				} else if ( SameString( Alphas( 11 ), "CoilSystem:Cooling:DX:HeatExchangerAssisted" ) ) {
 					PTUnit( PTUnitNum ).DXCoolCoilType_Num = CoilDX_CoolingHXAssisted;
-					errFlag = false;
-					GetDXCoilIndex( GetHXDXCoilName( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag ), PTUnit( PTUnitNum ).DXCoolCoilIndexNum, errFlag, "Coil:Cooling:DX:SingleSpeed" );
-					CoolCoilInletNodeNum = GetHXDXCoilInletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-					CoolCoilOutletNodeNum = GetHXDXCoilOutletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-					PTUnit( PTUnitNum ).CondenserNodeNum = GetCoilCondenserInletNode( "Coil:Cooling:DX:SingleSpeed", GetHXDXCoilName( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag ), errFlag );
-					if ( errFlag ) ShowContinueError( "...occurs in " + PTUnit( PTUnitNum ).UnitType + " \"" + PTUnit( PTUnitNum ).Name + "\"" );
+					GetPTUnit_errFlag = false;
+					GetDXCoilIndex( GetHXDXCoilName( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag ), PTUnit( PTUnitNum ).DXCoolCoilIndexNum, GetPTUnit_errFlag, "Coil:Cooling:DX:SingleSpeed" );
+					CoolCoilInletNodeNum = GetHXDXCoilInletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+					CoolCoilOutletNodeNum = GetHXDXCoilOutletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+					PTUnit( PTUnitNum ).CondenserNodeNum = GetCoilCondenserInletNode( "Coil:Cooling:DX:SingleSpeed", GetHXDXCoilName( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag ), GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) ShowContinueError( "...occurs in " + PTUnit( PTUnitNum ).UnitType + " \"" + PTUnit( PTUnitNum ).Name + "\"" );
 				}
 			} else if ( SameString( Alphas( 11 ), "COIL:COOLING:DX:VARIABLESPEED" ) ) {
 				PTUnit( PTUnitNum ).DXCoolCoilType = Alphas( 11 );
@@ -932,17 +974,17 @@ namespace PackagedTerminalHeatPump {
 					ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"." );
 					ErrorsFound = true;
 				} else {
-					errFlag = false;
-					PTUnit( PTUnitNum ).DXCoolCoilIndexNum = GetCoilIndexVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-					if ( errFlag ) {
+					GetPTUnit_errFlag = false;
+					PTUnit( PTUnitNum ).DXCoolCoilIndexNum = GetCoilIndexVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"." );
 						ErrorsFound = true;
 					}
-					CoolCoilInletNodeNum = GetCoilInletNodeVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-					CoolCoilOutletNodeNum = GetCoilOutletNodeVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-					PTUnit( PTUnitNum ).CondenserNodeNum = GetVSCoilCondenserInletNode( PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
+					CoolCoilInletNodeNum = GetCoilInletNodeVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+					CoolCoilOutletNodeNum = GetCoilOutletNodeVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+					PTUnit( PTUnitNum ).CondenserNodeNum = GetVSCoilCondenserInletNode( PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
 
-					if ( errFlag ) ShowContinueError( "...occurs in " + PTUnit( PTUnitNum ).UnitType + " \"" + PTUnit( PTUnitNum ).Name + "\"" );
+					if ( GetPTUnit_errFlag ) ShowContinueError( "...occurs in " + PTUnit( PTUnitNum ).UnitType + " \"" + PTUnit( PTUnitNum ).Name + "\"" );
 
 				}
 			} else {
@@ -969,71 +1011,71 @@ namespace PackagedTerminalHeatPump {
 					} else if ( SameString( Alphas( 13 ), "Coil:Heating:Electric" ) ) {
 						PTUnit( PTUnitNum ).SuppHeatCoilType_Num = Coil_HeatingElectric;
 					}
-					errFlag = false;
-					ValidateComponent( SuppHeatCoilType, SuppHeatCoilName, errFlag, CurrentModuleObject );
-					if ( errFlag ) {
+					GetPTUnit_errFlag = false;
+					ValidateComponent( SuppHeatCoilType, SuppHeatCoilName, GetPTUnit_errFlag, CurrentModuleObject );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + PTUnit( PTUnitNum ).Name + "\"." );
 						ErrorsFound = true;
 					} else {
-						GetHeatingCoilIndex( SuppHeatCoilName, PTUnit( PTUnitNum ).SuppHeatCoilIndex, errFlag );
+						GetHeatingCoilIndex( SuppHeatCoilName, PTUnit( PTUnitNum ).SuppHeatCoilIndex, GetPTUnit_errFlag );
 						// Get the Supplemental Heating Coil Node Numbers
-						SuppHeatInletNodeNum = GetHeatingCoilInletNode( SuppHeatCoilType, SuppHeatCoilName, errFlag );
-						SuppHeatOutletNodeNum = GetHeatingCoilOutletNode( SuppHeatCoilType, SuppHeatCoilName, errFlag );
-						if ( errFlag ) {
+						SuppHeatInletNodeNum = GetHeatingCoilInletNode( SuppHeatCoilType, SuppHeatCoilName, GetPTUnit_errFlag );
+						SuppHeatOutletNodeNum = GetHeatingCoilOutletNode( SuppHeatCoilType, SuppHeatCoilName, GetPTUnit_errFlag );
+						if ( GetPTUnit_errFlag ) {
 							ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + PTUnit( PTUnitNum ).Name + "\"." );
 							ErrorsFound = true;
 						}
 					}
 				} else if ( SameString( Alphas( 13 ), "Coil:Heating:Water" ) ) {
 					PTUnit( PTUnitNum ).SuppHeatCoilType_Num = Coil_HeatingWater;
-					errFlag = false;
-					SuppHeatHWInletNodeNum = GetCoilWaterInletNode( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, errFlag );
+					GetPTUnit_errFlag = false;
+					SuppHeatHWInletNodeNum = GetCoilWaterInletNode( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, GetPTUnit_errFlag );
 					PTUnit( PTUnitNum ).HotWaterControlNode = SuppHeatHWInletNodeNum;
-					if ( errFlag ) {
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "Occurs in " + CurrentModuleObject + " = " + PTUnit( PTUnitNum ).Name );
 						ErrorsFound = true;
 					}
-					PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow = GetCoilMaxWaterFlowRate( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, errFlag );
+					PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow = GetCoilMaxWaterFlowRate( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, GetPTUnit_errFlag );
 					if ( PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow > 0.0 ) {
-						PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow = GetCoilMaxWaterFlowRate( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, errFlag );
+						PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow = GetCoilMaxWaterFlowRate( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, GetPTUnit_errFlag );
 					}
-					errFlag = false;
-					SuppHeatInletNodeNum = GetWaterCoilInletNode( "Coil:Heating:Water", PTUnit( PTUnitNum ).SuppHeatCoilName, errFlag );
+					GetPTUnit_errFlag = false;
+					SuppHeatInletNodeNum = GetWaterCoilInletNode( "Coil:Heating:Water", PTUnit( PTUnitNum ).SuppHeatCoilName, GetPTUnit_errFlag );
 					PTUnit( PTUnitNum ).SupCoilAirInletNode = SuppHeatInletNodeNum;
-					SuppHeatOutletNodeNum = GetWaterCoilOutletNode( "Coil:Heating:Water", PTUnit( PTUnitNum ).SuppHeatCoilName, errFlag );
-					if ( errFlag ) {
+					SuppHeatOutletNodeNum = GetWaterCoilOutletNode( "Coil:Heating:Water", PTUnit( PTUnitNum ).SuppHeatCoilName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "Occurs in " + CurrentModuleObject + " = " + PTUnit( PTUnitNum ).Name );
 						ErrorsFound = true;
 					}
 
 				} else if ( SameString( Alphas( 13 ), "Coil:Heating:Steam" ) ) {
 					PTUnit( PTUnitNum ).SuppHeatCoilType_Num = Coil_HeatingSteam;
-					errFlag = false;
-					PTUnit( PTUnitNum ).SuppHeatCoilIndex = GetSteamCoilIndex( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, errFlag );
+					GetPTUnit_errFlag = false;
+					PTUnit( PTUnitNum ).SuppHeatCoilIndex = GetSteamCoilIndex( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, GetPTUnit_errFlag );
 					if ( PTUnit( PTUnitNum ).SuppHeatCoilIndex == 0 ) {
 						ShowSevereError( CurrentModuleObject + " illegal " + cAlphaFields( 14 ) + " = " + PTUnit( PTUnitNum ).SuppHeatCoilName );
 						ShowContinueError( "Occurs in " + CurrentModuleObject + " = " + PTUnit( PTUnitNum ).Name );
 						ErrorsFound = true;
 					}
 					//IF (ErrFlag) CALL ShowContinueError('Occurs in '//TRIM(CurrentModuleObject)//' = '//TRIM(PTUnit(PTUnitNum)%Name))
-					errFlag = false;
-					SuppHeatHWInletNodeNum = GetCoilSteamInletNode( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, errFlag );
+					GetPTUnit_errFlag = false;
+					SuppHeatHWInletNodeNum = GetCoilSteamInletNode( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, GetPTUnit_errFlag );
 					PTUnit( PTUnitNum ).HWCoilSteamInletNode = SuppHeatHWInletNodeNum;
-					if ( errFlag ) {
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "Occurs in " + CurrentModuleObject + " = " + PTUnit( PTUnitNum ).Name );
 						ErrorsFound = true;
 					}
-					PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow = GetCoilMaxSteamFlowRate( PTUnit( PTUnitNum ).SuppHeatCoilIndex, errFlag );
+					PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow = GetCoilMaxSteamFlowRate( PTUnit( PTUnitNum ).SuppHeatCoilIndex, GetPTUnit_errFlag );
 					if ( PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow > 0.0 ) {
 						SteamIndex = 0; // Function GetSatDensityRefrig will look up steam index if 0 is passed
 						SteamDensity = GetSatDensityRefrig( fluidNameSteam, TempSteamIn, 1.0, SteamIndex, RoutineNameFull );
-						PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow = GetCoilMaxSteamFlowRate( PTUnit( PTUnitNum ).SuppHeatCoilIndex, errFlag ) * SteamDensity;
+						PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow = GetCoilMaxSteamFlowRate( PTUnit( PTUnitNum ).SuppHeatCoilIndex, GetPTUnit_errFlag ) * SteamDensity;
 					}
-					errFlag = false;
-					SuppHeatInletNodeNum = GetSteamCoilAirInletNode( PTUnit( PTUnitNum ).SuppHeatCoilIndex, PTUnit( PTUnitNum ).SuppHeatCoilName, errFlag );
+					GetPTUnit_errFlag = false;
+					SuppHeatInletNodeNum = GetSteamCoilAirInletNode( PTUnit( PTUnitNum ).SuppHeatCoilIndex, PTUnit( PTUnitNum ).SuppHeatCoilName, GetPTUnit_errFlag );
 					PTUnit( PTUnitNum ).SupCoilAirInletNode = SuppHeatInletNodeNum;
-					SuppHeatOutletNodeNum = GetCoilAirOutletNode( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, errFlag );
-					if ( errFlag ) {
+					SuppHeatOutletNodeNum = GetCoilAirOutletNode( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "Occurs in " + CurrentModuleObject + " = " + PTUnit( PTUnitNum ).Name );
 						ErrorsFound = true;
 					}
@@ -1302,18 +1344,18 @@ namespace PackagedTerminalHeatPump {
 			}
 
 			if ( PTUnit( PTUnitNum ).DXHeatCoilType_Num == Coil_HeatingAirToAirVariableSpeed ) {
-				errFlag = false;
-				PTUnit( PTUnitNum ).DesignHeatingCapacity = GetCoilCapacityVariableSpeed( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, errFlag );
-				if ( errFlag ) {
+				GetPTUnit_errFlag = false;
+				PTUnit( PTUnitNum ).DesignHeatingCapacity = GetCoilCapacityVariableSpeed( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, GetPTUnit_errFlag );
+				if ( GetPTUnit_errFlag ) {
 					ShowContinueError( "...occurs in " + CurrentModuleObject + " = " + Alphas( 1 ) );
 					ErrorsFound = true;
 				}
 			}
 
 			if ( PTUnit( PTUnitNum ).DXCoolCoilType_Num == Coil_CoolingAirToAirVariableSpeed ) {
-				errFlag = false;
-				PTUnit( PTUnitNum ).DesignCoolingCapacity = GetCoilCapacityVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-				if ( errFlag ) {
+				GetPTUnit_errFlag = false;
+				PTUnit( PTUnitNum ).DesignCoolingCapacity = GetCoilCapacityVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+				if ( GetPTUnit_errFlag ) {
 					ShowContinueError( "...occurs in " + CurrentModuleObject + " = " + Alphas( 1 ) );
 					ErrorsFound = true;
 				}
@@ -1435,15 +1477,15 @@ namespace PackagedTerminalHeatPump {
 
 			// check to see if local OA mixer specified
 			if ( !lAlphaBlanks( 6 ) ) {
-				errFlag = false;
-				ValidateComponent( PTUnit( PTUnitNum ).OAMixType, PTUnit( PTUnitNum ).OAMixName, errFlag, CurrentModuleObject );
-				if ( errFlag ) {
+				GetPTUnit_errFlag = false;
+				ValidateComponent( PTUnit( PTUnitNum ).OAMixType, PTUnit( PTUnitNum ).OAMixName, GetPTUnit_errFlag, CurrentModuleObject );
+				if ( GetPTUnit_errFlag ) {
 					ShowContinueError( "specified in " + CurrentModuleObject + " = \"" + PTUnit( PTUnitNum ).Name + "\"." );
 					ErrorsFound = true;
 				} else {
 					// OANodeNums = outside air mixer node numbers, OANodeNums(4) = outside air mixer mixed air node
-					OANodeNums = GetOAMixerNodeNumbers( PTUnit( PTUnitNum ).OAMixName, errFlag );
-					if ( errFlag ) {
+					OANodeNums = GetOAMixerNodeNumbers( PTUnit( PTUnitNum ).OAMixName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "Occurs in " + CurrentModuleObject + " = " + PTUnit( PTUnitNum ).Name );
 						ShowContinueError( "..OutdoorAir:Mixer is required. Enter an OutdoorAir:Mixer object with this name." );
 						ErrorsFound = true;
@@ -1520,9 +1562,9 @@ namespace PackagedTerminalHeatPump {
 			PTUnit( PTUnitNum ).FanName = Alphas( 8 );
 
 			// Get the fan's availabitlity schedule
-			errFlag = false;
-			PTUnit( PTUnitNum ).FanAvailSchedPtr = GetFanAvailSchPtr( PTUnit( PTUnitNum ).FanType, PTUnit( PTUnitNum ).FanName, errFlag );
-			if ( errFlag ) {
+			GetPTUnit_errFlag = false;
+			PTUnit( PTUnitNum ).FanAvailSchedPtr = GetFanAvailSchPtr( PTUnit( PTUnitNum ).FanType, PTUnit( PTUnitNum ).FanName, GetPTUnit_errFlag );
+			if ( GetPTUnit_errFlag ) {
 				ShowContinueError( "...specified in " + CurrentModuleObject + " = " + PTUnit( PTUnitNum ).Name );
 				ErrorsFound = true;
 			}
@@ -1532,16 +1574,16 @@ namespace PackagedTerminalHeatPump {
 				ShowContinueError( "In " + CurrentModuleObject + " = " + PTUnit( PTUnitNum ).Name );
 				ErrorsFound = true;
 			}
-			errFlag = false;
-			GetFanType( PTUnit( PTUnitNum ).FanName, PTUnit( PTUnitNum ).FanType_Num, errFlag, CurrentModuleObject, PTUnit( PTUnitNum ).Name );
+			GetPTUnit_errFlag = false;
+			GetFanType( PTUnit( PTUnitNum ).FanName, PTUnit( PTUnitNum ).FanType_Num, GetPTUnit_errFlag, CurrentModuleObject, PTUnit( PTUnitNum ).Name );
 			FanVolFlow = 0.0;
-			if ( errFlag ) {
+			if ( GetPTUnit_errFlag ) {
 				ShowContinueError( "...specified in " + PTUnit( PTUnitNum ).UnitType + " \"" + PTUnit( PTUnitNum ).Name + "\"" );
 				ErrorsFound = true;
 			} else {
-				GetFanIndex( PTUnit( PTUnitNum ).FanName, PTUnit( PTUnitNum ).FanIndex, errFlag, CurrentModuleObject );
-				FanInletNodeNum = GetFanInletNode( PTUnit( PTUnitNum ).FanType, PTUnit( PTUnitNum ).FanName, errFlag );
-				FanOutletNodeNum = GetFanOutletNode( PTUnit( PTUnitNum ).FanType, PTUnit( PTUnitNum ).FanName, errFlag );
+				GetFanIndex( PTUnit( PTUnitNum ).FanName, PTUnit( PTUnitNum ).FanIndex, GetPTUnit_errFlag, CurrentModuleObject );
+				FanInletNodeNum = GetFanInletNode( PTUnit( PTUnitNum ).FanType, PTUnit( PTUnitNum ).FanName, GetPTUnit_errFlag );
+				FanOutletNodeNum = GetFanOutletNode( PTUnit( PTUnitNum ).FanType, PTUnit( PTUnitNum ).FanName, GetPTUnit_errFlag );
 				GetFanVolFlow( PTUnit( PTUnitNum ).FanIndex, FanVolFlow );
 				PTUnit( PTUnitNum ).ActualFanVolFlowRate = FanVolFlow;
 			}
@@ -1565,48 +1607,48 @@ namespace PackagedTerminalHeatPump {
 					if ( SameString( Alphas( 9 ), "Coil:Heating:Fuel" ) ) PTUnit( PTUnitNum ).ACHeatCoilType_Num = Coil_HeatingGasOrOtherFuel;
 					if ( SameString( Alphas( 9 ), "Coil:Heating:Electric" ) ) PTUnit( PTUnitNum ).ACHeatCoilType_Num = Coil_HeatingElectric;
 					PTUnit( PTUnitNum ).ACHeatCoilCap = GetHeatingCoilCapacity( PTUnit( PTUnitNum ).ACHeatCoilType, ACHeatCoilName, ErrorsFound );
-					errFlag = false;
-					HeatCoilInletNodeNum = GetHeatingCoilInletNode( PTUnit( PTUnitNum ).ACHeatCoilType, ACHeatCoilName, errFlag );
-					HeatCoilOutletNodeNum = GetHeatingCoilOutletNode( PTUnit( PTUnitNum ).ACHeatCoilType, ACHeatCoilName, errFlag );
-					if ( errFlag ) {
+					GetPTUnit_errFlag = false;
+					HeatCoilInletNodeNum = GetHeatingCoilInletNode( PTUnit( PTUnitNum ).ACHeatCoilType, ACHeatCoilName, GetPTUnit_errFlag );
+					HeatCoilOutletNodeNum = GetHeatingCoilOutletNode( PTUnit( PTUnitNum ).ACHeatCoilType, ACHeatCoilName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "...occurs in " + PTUnit( PTUnitNum ).UnitType + " \"" + PTUnit( PTUnitNum ).Name + "\"" );
 						ErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( 9 ), "Coil:Heating:Water" ) ) {
 					PTUnit( PTUnitNum ).ACHeatCoilType_Num = Coil_HeatingWater;
-					errFlag = false;
-					PTUnit( PTUnitNum ).HotWaterControlNode = GetCoilWaterInletNode( "Coil:Heating:Water", ACHeatCoilName, errFlag );
-					PTUnit( PTUnitNum ).MaxHeatCoilFluidFlow = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", ACHeatCoilName, errFlag );
+					GetPTUnit_errFlag = false;
+					PTUnit( PTUnitNum ).HotWaterControlNode = GetCoilWaterInletNode( "Coil:Heating:Water", ACHeatCoilName, GetPTUnit_errFlag );
+					PTUnit( PTUnitNum ).MaxHeatCoilFluidFlow = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", ACHeatCoilName, GetPTUnit_errFlag );
 					if ( PTUnit( PTUnitNum ).MaxHeatCoilFluidFlow > 0.0 ) {
-						PTUnit( PTUnitNum ).MaxHeatCoilFluidFlow = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", ACHeatCoilName, errFlag );
+						PTUnit( PTUnitNum ).MaxHeatCoilFluidFlow = GetCoilMaxWaterFlowRate( "Coil:Heating:Water", ACHeatCoilName, GetPTUnit_errFlag );
 					}
-					HeatCoilInletNodeNum = GetWaterCoilInletNode( "Coil:Heating:Water", ACHeatCoilName, errFlag );
+					HeatCoilInletNodeNum = GetWaterCoilInletNode( "Coil:Heating:Water", ACHeatCoilName, GetPTUnit_errFlag );
 					PTUnit( PTUnitNum ).HWCoilAirInletNode = HeatCoilInletNodeNum;
-					HeatCoilOutletNodeNum = GetWaterCoilOutletNode( "Coil:Heating:Water", PTUnit( PTUnitNum ).ACHeatCoilName, errFlag );
-					if ( errFlag ) {
+					HeatCoilOutletNodeNum = GetWaterCoilOutletNode( "Coil:Heating:Water", PTUnit( PTUnitNum ).ACHeatCoilName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "...occurs in " + PTUnit( PTUnitNum ).UnitType + " \"" + PTUnit( PTUnitNum ).Name + "\"" );
 						ErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( 9 ), "Coil:Heating:Steam" ) ) {
 					PTUnit( PTUnitNum ).ACHeatCoilType_Num = Coil_HeatingSteam;
-					errFlag = false;
-					PTUnit( PTUnitNum ).ACHeatCoilIndex = GetSteamCoilIndex( Alphas( 9 ), ACHeatCoilName, errFlag );
-					PTUnit( PTUnitNum ).HWCoilAirInletNode = GetSteamCoilAirInletNode( PTUnit( PTUnitNum ).ACHeatCoilIndex, ACHeatCoilName, errFlag );
-					PTUnit( PTUnitNum ).HWCoilSteamInletNode = GetCoilSteamInletNode( PTUnit( PTUnitNum ).ACHeatCoilIndex, ACHeatCoilName, errFlag );
-					PTUnit( PTUnitNum ).MaxHeatCoilFluidFlow = GetCoilMaxSteamFlowRate( PTUnit( PTUnitNum ).ACHeatCoilIndex, errFlag );
+					GetPTUnit_errFlag = false;
+					PTUnit( PTUnitNum ).ACHeatCoilIndex = GetSteamCoilIndex( Alphas( 9 ), ACHeatCoilName, GetPTUnit_errFlag );
+					PTUnit( PTUnitNum ).HWCoilAirInletNode = GetSteamCoilAirInletNode( PTUnit( PTUnitNum ).ACHeatCoilIndex, ACHeatCoilName, GetPTUnit_errFlag );
+					PTUnit( PTUnitNum ).HWCoilSteamInletNode = GetCoilSteamInletNode( PTUnit( PTUnitNum ).ACHeatCoilIndex, ACHeatCoilName, GetPTUnit_errFlag );
+					PTUnit( PTUnitNum ).MaxHeatCoilFluidFlow = GetCoilMaxSteamFlowRate( PTUnit( PTUnitNum ).ACHeatCoilIndex, GetPTUnit_errFlag );
 					SteamIndex = 0; // Function GetSatDensityRefrig will look up steam index if 0 is passed
 					SteamDensity = GetSatDensityRefrig( fluidNameSteam, TempSteamIn, 1.0, SteamIndex, RoutineNameFull );
 					if ( PTUnit( PTUnitNum ).MaxHeatCoilFluidFlow > 0.0 ) {
-						PTUnit( PTUnitNum ).MaxHeatCoilFluidFlow = GetCoilMaxSteamFlowRate( PTUnit( PTUnitNum ).ACHeatCoilIndex, errFlag ) * SteamDensity;
+						PTUnit( PTUnitNum ).MaxHeatCoilFluidFlow = GetCoilMaxSteamFlowRate( PTUnit( PTUnitNum ).ACHeatCoilIndex, GetPTUnit_errFlag ) * SteamDensity;
 					}
 					HeatCoilInletNodeNum = PTUnit( PTUnitNum ).HWCoilAirInletNode;
-					HeatCoilOutletNodeNum = GetCoilAirOutletNode( PTUnit( PTUnitNum ).ACHeatCoilIndex, ACHeatCoilName, errFlag );
-					if ( errFlag ) {
+					HeatCoilOutletNodeNum = GetCoilAirOutletNode( PTUnit( PTUnitNum ).ACHeatCoilIndex, ACHeatCoilName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "...occurs in " + PTUnit( PTUnitNum ).UnitType + " \"" + PTUnit( PTUnitNum ).Name + "\"" );
 						ErrorsFound = true;
 					}
-					if ( GetTypeOfCoil( PTUnit( PTUnitNum ).ACHeatCoilIndex, ACHeatCoilName, errFlag ) != ZoneLoadControl ) {
-						if ( errFlag ) {
+					if ( GetTypeOfCoil( PTUnit( PTUnitNum ).ACHeatCoilIndex, ACHeatCoilName, GetPTUnit_errFlag ) != ZoneLoadControl ) {
+						if ( GetPTUnit_errFlag ) {
 							ShowContinueError( "...occurs in " + PTUnit( PTUnitNum ).UnitType + " \"" + PTUnit( PTUnitNum ).Name + "\"" );
 							ErrorsFound = true;
 						}
@@ -1627,23 +1669,23 @@ namespace PackagedTerminalHeatPump {
 				PTUnit( PTUnitNum ).DXCoolCoilType = Alphas( 11 );
 				if ( SameString( Alphas( 11 ), "Coil:Cooling:DX:SingleSpeed" ) ) {
 					PTUnit( PTUnitNum ).DXCoolCoilType_Num = CoilDX_CoolingSingleSpeed;
-					errFlag = false;
-					GetDXCoilIndex( PTUnit( PTUnitNum ).DXCoolCoilName, PTUnit( PTUnitNum ).DXCoolCoilIndexNum, errFlag, PTUnit( PTUnitNum ).DXCoolCoilType );
-					CoolCoilInletNodeNum = GetDXCoilInletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-					CoolCoilOutletNodeNum = GetDXCoilOutletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-					PTUnit( PTUnitNum ).CondenserNodeNum = GetCoilCondenserInletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-					if ( errFlag ) {
+					GetPTUnit_errFlag = false;
+					GetDXCoilIndex( PTUnit( PTUnitNum ).DXCoolCoilName, PTUnit( PTUnitNum ).DXCoolCoilIndexNum, GetPTUnit_errFlag, PTUnit( PTUnitNum ).DXCoolCoilType );
+					CoolCoilInletNodeNum = GetDXCoilInletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+					CoolCoilOutletNodeNum = GetDXCoilOutletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+					PTUnit( PTUnitNum ).CondenserNodeNum = GetCoilCondenserInletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "...occurs in " + PTUnit( PTUnitNum ).UnitType + " \"" + PTUnit( PTUnitNum ).Name + "\"" );
 						ErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( 11 ), "CoilSystem:Cooling:DX:HeatExchangerAssisted" ) ) {
 					PTUnit( PTUnitNum ).DXCoolCoilType_Num = CoilDX_CoolingHXAssisted;
-					errFlag = false;
-					GetDXCoilIndex( GetHXDXCoilName( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag ), PTUnit( PTUnitNum ).DXCoolCoilIndexNum, errFlag, "Coil:Cooling:DX:SingleSpeed" );
-					CoolCoilInletNodeNum = GetHXDXCoilInletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-					CoolCoilOutletNodeNum = GetHXDXCoilOutletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-					PTUnit( PTUnitNum ).CondenserNodeNum = GetCoilCondenserInletNode( "Coil:Cooling:DX:SingleSpeed", GetHXDXCoilName( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag ), errFlag );
-					if ( errFlag ) {
+					GetPTUnit_errFlag = false;
+					GetDXCoilIndex( GetHXDXCoilName( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag ), PTUnit( PTUnitNum ).DXCoolCoilIndexNum, GetPTUnit_errFlag, "Coil:Cooling:DX:SingleSpeed" );
+					CoolCoilInletNodeNum = GetHXDXCoilInletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+					CoolCoilOutletNodeNum = GetHXDXCoilOutletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+					PTUnit( PTUnitNum ).CondenserNodeNum = GetCoilCondenserInletNode( "Coil:Cooling:DX:SingleSpeed", GetHXDXCoilName( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag ), GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "...occurs in " + PTUnit( PTUnitNum ).UnitType + " \"" + PTUnit( PTUnitNum ).Name + "\"" );
 						ErrorsFound = true;
 					}
@@ -1657,17 +1699,17 @@ namespace PackagedTerminalHeatPump {
 					ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"." );
 					ErrorsFound = true;
 				} else {
-					errFlag = false;
-					PTUnit( PTUnitNum ).DXCoolCoilIndexNum = GetCoilIndexVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-					if ( errFlag ) {
+					GetPTUnit_errFlag = false;
+					PTUnit( PTUnitNum ).DXCoolCoilIndexNum = GetCoilIndexVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"." );
 						ErrorsFound = true;
 					}
-					CoolCoilInletNodeNum = GetCoilInletNodeVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-					CoolCoilOutletNodeNum = GetCoilOutletNodeVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-					PTUnit( PTUnitNum ).CondenserNodeNum = GetVSCoilCondenserInletNode( PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
+					CoolCoilInletNodeNum = GetCoilInletNodeVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+					CoolCoilOutletNodeNum = GetCoilOutletNodeVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+					PTUnit( PTUnitNum ).CondenserNodeNum = GetVSCoilCondenserInletNode( PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
 
-					if ( errFlag ) ShowContinueError( "...occurs in " + PTUnit( PTUnitNum ).UnitType + " \"" + PTUnit( PTUnitNum ).Name + "\"" );
+					if ( GetPTUnit_errFlag ) ShowContinueError( "...occurs in " + PTUnit( PTUnitNum ).UnitType + " \"" + PTUnit( PTUnitNum ).Name + "\"" );
 				}
 			} else {
 				ShowWarningError( CurrentModuleObject + " illegal " + cAlphaFields( 11 ) + " = " + Alphas( 11 ) );
@@ -1928,10 +1970,10 @@ namespace PackagedTerminalHeatPump {
 			}
 
 			if ( PTUnit( PTUnitNum ).DXCoolCoilType_Num == Coil_CoolingAirToAirVariableSpeed ) {
-				errFlag = false;
-				PTUnit( PTUnitNum ).DesignCoolingCapacity = GetCoilCapacityVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
+				GetPTUnit_errFlag = false;
+				PTUnit( PTUnitNum ).DesignCoolingCapacity = GetCoilCapacityVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
 				PTUnit( PTUnitNum ).useVSCoilModel = true;
-				if ( errFlag ) {
+				if ( GetPTUnit_errFlag ) {
 					ShowContinueError( "...occurs in " + CurrentModuleObject + " = " + Alphas( 1 ) );
 					ErrorsFound = true;
 				}
@@ -2053,15 +2095,15 @@ namespace PackagedTerminalHeatPump {
 
 			// check to see if local OA mixer specified
 			if ( ! lAlphaBlanks( 6 ) ) {
-				errFlag = false;
-				ValidateComponent( PTUnit( PTUnitNum ).OAMixType, PTUnit( PTUnitNum ).OAMixName, errFlag, CurrentModuleObject );
-				if ( errFlag ) {
+				GetPTUnit_errFlag = false;
+				ValidateComponent( PTUnit( PTUnitNum ).OAMixType, PTUnit( PTUnitNum ).OAMixName, GetPTUnit_errFlag, CurrentModuleObject );
+				if ( GetPTUnit_errFlag ) {
 					ShowContinueError( "specified in " + CurrentModuleObject + " = \"" + PTUnit( PTUnitNum ).Name + "\"." );
 					ErrorsFound = true;
 				} else {
 					// OANodeNums = outside air mixer node numbers, OANodeNums(4) = outside air mixer mixed air node
-					OANodeNums = GetOAMixerNodeNumbers( PTUnit( PTUnitNum ).OAMixName, errFlag );
-					if ( errFlag ) {
+					OANodeNums = GetOAMixerNodeNumbers( PTUnit( PTUnitNum ).OAMixName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "that was specified in " + CurrentModuleObject + " = " + PTUnit( PTUnitNum ).Name );
 						ShowContinueError( "..OutdoorAir:Mixer is required. Enter an OutdoorAir:Mixer object with this name." );
 						ErrorsFound = true;
@@ -2077,10 +2119,10 @@ namespace PackagedTerminalHeatPump {
 			//Get fan data
 			PTUnit( PTUnitNum ).FanType = Alphas( 7 );
 			PTUnit( PTUnitNum ).FanName = Alphas( 8 );
-			errFlag = false;
-			GetFanType( PTUnit( PTUnitNum ).FanName, PTUnit( PTUnitNum ).FanType_Num, errFlag, CurrentModuleObject, Alphas( 1 ) );
+			GetPTUnit_errFlag = false;
+			GetFanType( PTUnit( PTUnitNum ).FanName, PTUnit( PTUnitNum ).FanType_Num, GetPTUnit_errFlag, CurrentModuleObject, Alphas( 1 ) );
 			FanVolFlow = 0.0;
-			if ( errFlag ) {
+			if ( GetPTUnit_errFlag ) {
 				ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + PTUnit( PTUnitNum ).Name + "\"." );
 				ErrorsFound = true;
 			}
@@ -2091,30 +2133,30 @@ namespace PackagedTerminalHeatPump {
 					ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"." );
 					ErrorsFound = true;
 				} else {
-					errFlag = false;
-					GetFanIndex( PTUnit( PTUnitNum ).FanName, PTUnit( PTUnitNum ).FanIndex, errFlag );
-					if ( errFlag ) {
+					GetPTUnit_errFlag = false;
+					GetFanIndex( PTUnit( PTUnitNum ).FanName, PTUnit( PTUnitNum ).FanIndex, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"." );
 						ErrorsFound = true;
 					}
-					errFlag = false;
-					FanInletNodeNum = GetFanInletNode( PTUnit( PTUnitNum ).FanType, PTUnit( PTUnitNum ).FanName, errFlag );
-					if ( errFlag ) {
+					GetPTUnit_errFlag = false;
+					FanInletNodeNum = GetFanInletNode( PTUnit( PTUnitNum ).FanType, PTUnit( PTUnitNum ).FanName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"." );
 						ErrorsFound = true;
 					}
-					errFlag = false;
-					FanOutletNodeNum = GetFanOutletNode( PTUnit( PTUnitNum ).FanType, PTUnit( PTUnitNum ).FanName, errFlag );
-					if ( errFlag ) {
+					GetPTUnit_errFlag = false;
+					FanOutletNodeNum = GetFanOutletNode( PTUnit( PTUnitNum ).FanType, PTUnit( PTUnitNum ).FanName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"." );
 						ErrorsFound = true;
 					} else {
 						GetFanVolFlow( PTUnit( PTUnitNum ).FanIndex, FanVolFlow );
 						PTUnit( PTUnitNum ).ActualFanVolFlowRate = FanVolFlow;
 					}
-					errFlag = false;
-					PTUnit( PTUnitNum ).FanAvailSchedPtr = GetFanAvailSchPtr( PTUnit( PTUnitNum ).FanType, PTUnit( PTUnitNum ).FanName, errFlag );
-					if ( errFlag ) {
+					GetPTUnit_errFlag = false;
+					PTUnit( PTUnitNum ).FanAvailSchedPtr = GetFanAvailSchPtr( PTUnit( PTUnitNum ).FanType, PTUnit( PTUnitNum ).FanName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"." );
 						ErrorsFound = true;
 					}
@@ -2135,14 +2177,14 @@ namespace PackagedTerminalHeatPump {
 					ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"." );
 					ErrorsFound = true;
 				} else {
-					errFlag = false;
-					PTUnit( PTUnitNum ).DXHeatCoilIndexNum = GetWtoAHPSimpleCoilIndex( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, errFlag );
-					if ( errFlag ) {
+					GetPTUnit_errFlag = false;
+					PTUnit( PTUnitNum ).DXHeatCoilIndexNum = GetWtoAHPSimpleCoilIndex( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"." );
 						ErrorsFound = true;
 					}
-					HeatCoilInletNodeNum = GetWtoAHPSimpleCoilInletNode( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, errFlag );
-					HeatCoilOutletNodeNum = GetWtoAHPSimpleCoilOutletNode( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, errFlag );
+					HeatCoilInletNodeNum = GetWtoAHPSimpleCoilInletNode( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, GetPTUnit_errFlag );
+					HeatCoilOutletNodeNum = GetWtoAHPSimpleCoilOutletNode( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, GetPTUnit_errFlag );
 				}
 			} else if ( Alphas( 9 ) == "COIL:HEATING:WATERTOAIRHEATPUMP:VARIABLESPEEDEQUATIONFIT" ) {
 				PTUnit( PTUnitNum ).DXHeatCoilType = Alphas( 9 );
@@ -2153,14 +2195,14 @@ namespace PackagedTerminalHeatPump {
 					ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"." );
 					ErrorsFound = true;
 				} else {
-					errFlag = false;
-					PTUnit( PTUnitNum ).DXHeatCoilIndexNum = GetCoilIndexVariableSpeed( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, errFlag );
-					if ( errFlag ) {
+					GetPTUnit_errFlag = false;
+					PTUnit( PTUnitNum ).DXHeatCoilIndexNum = GetCoilIndexVariableSpeed( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"." );
 						ErrorsFound = true;
 					}
-					HeatCoilInletNodeNum = GetCoilInletNodeVariableSpeed( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, errFlag );
-					HeatCoilOutletNodeNum = GetCoilOutletNodeVariableSpeed( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, errFlag );
+					HeatCoilInletNodeNum = GetCoilInletNodeVariableSpeed( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, GetPTUnit_errFlag );
+					HeatCoilOutletNodeNum = GetCoilOutletNodeVariableSpeed( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, GetPTUnit_errFlag );
 				}
 			} else {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"" );
@@ -2178,14 +2220,14 @@ namespace PackagedTerminalHeatPump {
 					ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"." );
 					ErrorsFound = true;
 				} else {
-					errFlag = false;
-					PTUnit( PTUnitNum ).DXCoolCoilIndexNum = GetWtoAHPSimpleCoilIndex( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-					if ( errFlag ) {
+					GetPTUnit_errFlag = false;
+					PTUnit( PTUnitNum ).DXCoolCoilIndexNum = GetWtoAHPSimpleCoilIndex( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"." );
 						ErrorsFound = true;
 					}
-					CoolCoilInletNodeNum = GetWtoAHPSimpleCoilInletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-					CoolCoilOutletNodeNum = GetWtoAHPSimpleCoilOutletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
+					CoolCoilInletNodeNum = GetWtoAHPSimpleCoilInletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+					CoolCoilOutletNodeNum = GetWtoAHPSimpleCoilOutletNode( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
 				}
 			} else if ( Alphas( 11 ) == "COIL:COOLING:WATERTOAIRHEATPUMP:VARIABLESPEEDEQUATIONFIT" ) {
 				PTUnit( PTUnitNum ).DXCoolCoilType = Alphas( 11 );
@@ -2196,14 +2238,14 @@ namespace PackagedTerminalHeatPump {
 					ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"." );
 					ErrorsFound = true;
 				} else {
-					errFlag = false;
-					PTUnit( PTUnitNum ).DXCoolCoilIndexNum = GetCoilIndexVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-					if ( errFlag ) {
+					GetPTUnit_errFlag = false;
+					PTUnit( PTUnitNum ).DXCoolCoilIndexNum = GetCoilIndexVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"." );
 						ErrorsFound = true;
 					}
-					CoolCoilInletNodeNum = GetCoilInletNodeVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-					CoolCoilOutletNodeNum = GetCoilOutletNodeVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
+					CoolCoilInletNodeNum = GetCoilInletNodeVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+					CoolCoilOutletNodeNum = GetCoilOutletNodeVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
 				}
 			} else {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"" );
@@ -2256,70 +2298,70 @@ namespace PackagedTerminalHeatPump {
 					} else if ( SameString( Alphas( 13 ), "Coil:Heating:Electric" ) ) {
 						PTUnit( PTUnitNum ).SuppHeatCoilType_Num = Coil_HeatingElectric;
 					}
-					errFlag = false;
-					ValidateComponent( SuppHeatCoilType, SuppHeatCoilName, errFlag, CurrentModuleObject );
-					if ( errFlag ) {
+					GetPTUnit_errFlag = false;
+					ValidateComponent( SuppHeatCoilType, SuppHeatCoilName, GetPTUnit_errFlag, CurrentModuleObject );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + PTUnit( PTUnitNum ).Name + "\"." );
 						ErrorsFound = true;
 					} else {
-						GetHeatingCoilIndex( SuppHeatCoilName, PTUnit( PTUnitNum ).SuppHeatCoilIndex, errFlag );
+						GetHeatingCoilIndex( SuppHeatCoilName, PTUnit( PTUnitNum ).SuppHeatCoilIndex, GetPTUnit_errFlag );
 						// Get the Supplemental Heating Coil Node Numbers
-						SuppHeatInletNodeNum = GetHeatingCoilInletNode( SuppHeatCoilType, SuppHeatCoilName, errFlag );
-						SuppHeatOutletNodeNum = GetHeatingCoilOutletNode( SuppHeatCoilType, SuppHeatCoilName, errFlag );
-						if ( errFlag ) {
+						SuppHeatInletNodeNum = GetHeatingCoilInletNode( SuppHeatCoilType, SuppHeatCoilName, GetPTUnit_errFlag );
+						SuppHeatOutletNodeNum = GetHeatingCoilOutletNode( SuppHeatCoilType, SuppHeatCoilName, GetPTUnit_errFlag );
+						if ( GetPTUnit_errFlag ) {
 							ShowContinueError( "...specified in " + CurrentModuleObject + "=\"" + PTUnit( PTUnitNum ).Name + "\"." );
 							ErrorsFound = true;
 						}
 					}
 				} else if ( SameString( Alphas( 13 ), "Coil:Heating:Water" ) ) {
 					PTUnit( PTUnitNum ).SuppHeatCoilType_Num = Coil_HeatingWater;
-					errFlag = false;
-					SuppHeatHWInletNodeNum = GetCoilWaterInletNode( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, errFlag );
+					GetPTUnit_errFlag = false;
+					SuppHeatHWInletNodeNum = GetCoilWaterInletNode( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, GetPTUnit_errFlag );
 					PTUnit( PTUnitNum ).HotWaterControlNode = SuppHeatHWInletNodeNum;
-					if ( errFlag ) {
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "Occurs in " + CurrentModuleObject + " = " + PTUnit( PTUnitNum ).Name );
 						ErrorsFound = true;
 					}
-					PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow = GetCoilMaxWaterFlowRate( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, errFlag );
+					PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow = GetCoilMaxWaterFlowRate( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, GetPTUnit_errFlag );
 					if ( PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow > 0.0 ) {
-						PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow = GetCoilMaxWaterFlowRate( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, errFlag );
+						PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow = GetCoilMaxWaterFlowRate( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, GetPTUnit_errFlag );
 					}
-					errFlag = false;
-					SuppHeatInletNodeNum = GetWaterCoilInletNode( "Coil:Heating:Water", PTUnit( PTUnitNum ).SuppHeatCoilName, errFlag );
+					GetPTUnit_errFlag = false;
+					SuppHeatInletNodeNum = GetWaterCoilInletNode( "Coil:Heating:Water", PTUnit( PTUnitNum ).SuppHeatCoilName, GetPTUnit_errFlag );
 					PTUnit( PTUnitNum ).SupCoilAirInletNode = SuppHeatInletNodeNum;
-					SuppHeatOutletNodeNum = GetWaterCoilOutletNode( "Coil:Heating:Water", PTUnit( PTUnitNum ).SuppHeatCoilName, errFlag );
-					if ( errFlag ) {
+					SuppHeatOutletNodeNum = GetWaterCoilOutletNode( "Coil:Heating:Water", PTUnit( PTUnitNum ).SuppHeatCoilName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "Occurs in " + CurrentModuleObject + " = " + PTUnit( PTUnitNum ).Name );
 						ErrorsFound = true;
 					}
 
 				} else if ( SameString( Alphas( 13 ), "Coil:Heating:Steam" ) ) {
 					PTUnit( PTUnitNum ).SuppHeatCoilType_Num = Coil_HeatingSteam;
-					errFlag = false;
-					PTUnit( PTUnitNum ).SuppHeatCoilIndex = GetSteamCoilIndex( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, errFlag );
+					GetPTUnit_errFlag = false;
+					PTUnit( PTUnitNum ).SuppHeatCoilIndex = GetSteamCoilIndex( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, GetPTUnit_errFlag );
 					if ( PTUnit( PTUnitNum ).SuppHeatCoilIndex == 0 ) {
 						ShowSevereError( CurrentModuleObject + " illegal " + cAlphaFields( 14 ) + " = " + PTUnit( PTUnitNum ).SuppHeatCoilName );
 						ShowContinueError( "Occurs in " + CurrentModuleObject + " = " + PTUnit( PTUnitNum ).Name );
 						ErrorsFound = true;
 					}
-					errFlag = false;
-					SuppHeatHWInletNodeNum = GetCoilSteamInletNode( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, errFlag );
+					GetPTUnit_errFlag = false;
+					SuppHeatHWInletNodeNum = GetCoilSteamInletNode( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, GetPTUnit_errFlag );
 					PTUnit( PTUnitNum ).HWCoilSteamInletNode = SuppHeatHWInletNodeNum;
-					if ( errFlag ) {
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "Occurs in " + CurrentModuleObject + " = " + PTUnit( PTUnitNum ).Name );
 						ErrorsFound = true;
 					}
-					PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow = GetCoilMaxSteamFlowRate( PTUnit( PTUnitNum ).SuppHeatCoilIndex, errFlag );
+					PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow = GetCoilMaxSteamFlowRate( PTUnit( PTUnitNum ).SuppHeatCoilIndex, GetPTUnit_errFlag );
 					if ( PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow > 0.0 ) {
 						SteamIndex = 0; // Function GetSatDensityRefrig will look up steam index if 0 is passed
 						SteamDensity = GetSatDensityRefrig( fluidNameSteam, TempSteamIn, 1.0, SteamIndex, RoutineNameFull );
-						PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow = GetCoilMaxSteamFlowRate( PTUnit( PTUnitNum ).SuppHeatCoilIndex, errFlag ) * SteamDensity;
+						PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow = GetCoilMaxSteamFlowRate( PTUnit( PTUnitNum ).SuppHeatCoilIndex, GetPTUnit_errFlag ) * SteamDensity;
 					}
-					errFlag = false;
-					SuppHeatInletNodeNum = GetSteamCoilAirInletNode( PTUnit( PTUnitNum ).SuppHeatCoilIndex, PTUnit( PTUnitNum ).SuppHeatCoilName, errFlag );
+					GetPTUnit_errFlag = false;
+					SuppHeatInletNodeNum = GetSteamCoilAirInletNode( PTUnit( PTUnitNum ).SuppHeatCoilIndex, PTUnit( PTUnitNum ).SuppHeatCoilName, GetPTUnit_errFlag );
 					PTUnit( PTUnitNum ).SupCoilAirInletNode = SuppHeatInletNodeNum;
-					SuppHeatOutletNodeNum = GetCoilAirOutletNode( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, errFlag );
-					if ( errFlag ) {
+					SuppHeatOutletNodeNum = GetCoilAirOutletNode( SuppHeatCoilType, PTUnit( PTUnitNum ).SuppHeatCoilName, GetPTUnit_errFlag );
+					if ( GetPTUnit_errFlag ) {
 						ShowContinueError( "Occurs in " + CurrentModuleObject + " = " + PTUnit( PTUnitNum ).Name );
 						ErrorsFound = true;
 					}
@@ -2622,10 +2664,10 @@ namespace PackagedTerminalHeatPump {
 			}
 
 			//Set the Design Fan Volume Flow Rate
-			errFlag = false;
+			GetPTUnit_errFlag = false;
 			GetFanVolFlow( PTUnit( PTUnitNum ).FanIndex, FanVolFlow );
 			PTUnit( PTUnitNum ).ActualFanVolFlowRate = FanVolFlow;
-			if ( errFlag ) {
+			if ( GetPTUnit_errFlag ) {
 				ShowContinueError( "...occurs in " + CurrentModuleObject + " = " + Alphas( 1 ) );
 				ErrorsFound = true;
 			}
@@ -2724,24 +2766,24 @@ namespace PackagedTerminalHeatPump {
 			//Set the heat pump heating coil capacity
 			//  Get from coil module.
 			if ( PTUnit( PTUnitNum ).DXHeatCoilType_Num == Coil_HeatingWaterToAirHP ) {
-				errFlag = false;
-				PTUnit( PTUnitNum ).DesignHeatingCapacity = GetWtoAHPCoilCapacity( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, errFlag );
+				GetPTUnit_errFlag = false;
+				PTUnit( PTUnitNum ).DesignHeatingCapacity = GetWtoAHPCoilCapacity( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, GetPTUnit_errFlag );
 
-				if ( errFlag ) {
+				if ( GetPTUnit_errFlag ) {
 					ShowContinueError( "...occurs in " + CurrentModuleObject + " = " + Alphas( 1 ) );
 					ErrorsFound = true;
 				}
 			} else if ( PTUnit( PTUnitNum ).DXHeatCoilType_Num == Coil_HeatingWaterToAirHPSimple ) {
-				errFlag = false;
-				PTUnit( PTUnitNum ).DesignHeatingCapacity = GetWtoAHPSimpleCoilCapacity( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, errFlag );
-				if ( errFlag ) {
+				GetPTUnit_errFlag = false;
+				PTUnit( PTUnitNum ).DesignHeatingCapacity = GetWtoAHPSimpleCoilCapacity( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, GetPTUnit_errFlag );
+				if ( GetPTUnit_errFlag ) {
 					ShowContinueError( "...occurs in " + CurrentModuleObject + " = " + Alphas( 1 ) );
 					ErrorsFound = true;
 				}
 			} else if ( PTUnit( PTUnitNum ).DXHeatCoilType_Num == Coil_HeatingWaterToAirHPVSEquationFit ) {
-				errFlag = false;
-				PTUnit( PTUnitNum ).DesignHeatingCapacity = GetCoilCapacityVariableSpeed( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, errFlag );
-				if ( errFlag ) {
+				GetPTUnit_errFlag = false;
+				PTUnit( PTUnitNum ).DesignHeatingCapacity = GetCoilCapacityVariableSpeed( PTUnit( PTUnitNum ).DXHeatCoilType, PTUnit( PTUnitNum ).DXHeatCoilName, GetPTUnit_errFlag );
+				if ( GetPTUnit_errFlag ) {
 					ShowContinueError( "...occurs in " + CurrentModuleObject + " = " + Alphas( 1 ) );
 					ErrorsFound = true;
 				}
@@ -2751,23 +2793,23 @@ namespace PackagedTerminalHeatPump {
 			//Set the heat pump cooling coil capacity (Total capacity)
 			//  Get from coil module.
 			if ( PTUnit( PTUnitNum ).DXCoolCoilType_Num == Coil_CoolingWaterToAirHP ) {
-				errFlag = false;
-				PTUnit( PTUnitNum ).DesignCoolingCapacity = GetWtoAHPCoilCapacity( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-				if ( errFlag ) {
+				GetPTUnit_errFlag = false;
+				PTUnit( PTUnitNum ).DesignCoolingCapacity = GetWtoAHPCoilCapacity( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+				if ( GetPTUnit_errFlag ) {
 					ShowContinueError( "...occurs in " + CurrentModuleObject + " = " + Alphas( 1 ) );
 					ErrorsFound = true;
 				}
 			} else if ( PTUnit( PTUnitNum ).DXCoolCoilType_Num == Coil_CoolingWaterToAirHPSimple ) {
-				errFlag = false;
-				PTUnit( PTUnitNum ).DesignCoolingCapacity = GetWtoAHPSimpleCoilCapacity( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-				if ( errFlag ) {
+				GetPTUnit_errFlag = false;
+				PTUnit( PTUnitNum ).DesignCoolingCapacity = GetWtoAHPSimpleCoilCapacity( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+				if ( GetPTUnit_errFlag ) {
 					ShowContinueError( "...occurs in " + CurrentModuleObject + " = " + Alphas( 1 ) );
 					ErrorsFound = true;
 				}
 			} else if ( PTUnit( PTUnitNum ).DXCoolCoilType_Num == Coil_CoolingWaterToAirHPVSEquationFit ) {
-				errFlag = false;
-				PTUnit( PTUnitNum ).DesignCoolingCapacity = GetCoilCapacityVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, errFlag );
-				if ( errFlag ) {
+				GetPTUnit_errFlag = false;
+				PTUnit( PTUnitNum ).DesignCoolingCapacity = GetCoilCapacityVariableSpeed( PTUnit( PTUnitNum ).DXCoolCoilType, PTUnit( PTUnitNum ).DXCoolCoilName, GetPTUnit_errFlag );
+				if ( GetPTUnit_errFlag ) {
 					ShowContinueError( "...occurs in " + CurrentModuleObject + " = " + Alphas( 1 ) );
 					ErrorsFound = true;
 				}
@@ -2789,9 +2831,9 @@ namespace PackagedTerminalHeatPump {
 			//Set the heatpump design supplemental heating capacity
 			//  Get from coil module.
 			if ( PTUnit( PTUnitNum ).SuppHeatCoilType_Num == Coil_HeatingGasOrOtherFuel || PTUnit( PTUnitNum ).SuppHeatCoilType_Num == Coil_HeatingElectric ) {
-				errFlag = false;
-				PTUnit( PTUnitNum ).DesignSuppHeatingCapacity = GetHeatingCoilCapacity( SuppHeatCoilType, SuppHeatCoilName, errFlag );
-				if ( errFlag ) {
+				GetPTUnit_errFlag = false;
+				PTUnit( PTUnitNum ).DesignSuppHeatingCapacity = GetHeatingCoilCapacity( SuppHeatCoilType, SuppHeatCoilName, GetPTUnit_errFlag );
+				if ( GetPTUnit_errFlag ) {
 					ShowContinueError( "...occurs in " + CurrentModuleObject + " = " + Alphas( 1 ) );
 					ErrorsFound = true;
 				}
@@ -2954,13 +2996,7 @@ namespace PackagedTerminalHeatPump {
 		Real64 RhoAir; // air density at InNode
 		Real64 PartLoadFrac; // compressor part load fraction
 		Real64 CoilMaxVolFlowRate; // water or steam max volumetric water flow rate
-		static bool ZoneEquipmentListNotChecked( true ); // False after the Zone Equipment List has been checked for items
 		int Loop;
-		static Array1D_bool MyEnvrnFlag; // used for initializations each begin environment flag
-		static Array1D_bool MySizeFlag; // used for sizing PTHP inputs one time
-		static Array1D_bool MyFanFlag; // used for sizing PTHP fan inputs one time
-		static Array1D_bool MyPlantScanFlag;
-		static Array1D_bool MyZoneEqFlag; // used to set up zone equipment availability managers
 		Real64 QActual; // actual PTAC steam heating coil load met (W)
 		bool ErrorsFound; // flag returned from mining call
 		Real64 QToCoolSetPt;
@@ -4214,7 +4250,6 @@ namespace PackagedTerminalHeatPump {
 		Real64 NoCompOutput; // output when no active compressor [W]
 		Real64 ErrorToler; // error tolerance
 		int SolFla; // Flag of RegulaFalsi solver
-		static Array1D< Real64 > Par( 8 ); // Parameters passed to RegulaFalsi
 		std::string IterNum; // Max number of iterations for warning message
 		Real64 CpAir; // air specific heat
 		Real64 OutsideDryBulbTemp; // Outside air temperature at external node height
@@ -4284,23 +4319,23 @@ namespace PackagedTerminalHeatPump {
 
 		if ( ( HeatingLoad && QZnReq < FullOutput ) || ( CoolingLoad && QZnReq > FullOutput ) ) {
 
-			Par( 1 ) = PTUnitNum;
-			Par( 2 ) = ZoneNum;
+			ControlPTUnitOutputPar( 1 ) = PTUnitNum;
+			ControlPTUnitOutputPar( 2 ) = ZoneNum;
 			if ( FirstHVACIteration ) {
-				Par( 3 ) = 1.0;
+				ControlPTUnitOutputPar( 3 ) = 1.0;
 			} else {
-				Par( 3 ) = 0.0;
+				ControlPTUnitOutputPar( 3 ) = 0.0;
 			}
-			Par( 4 ) = OpMode;
-			Par( 5 ) = QZnReq;
-			Par( 6 ) = OnOffAirFlowRatio;
-			Par( 7 ) = SupHeaterLoad;
+			ControlPTUnitOutputPar( 4 ) = OpMode;
+			ControlPTUnitOutputPar( 5 ) = QZnReq;
+			ControlPTUnitOutputPar( 6 ) = OnOffAirFlowRatio;
+			ControlPTUnitOutputPar( 7 ) = SupHeaterLoad;
 			if ( HXUnitOn ) {
-				Par( 8 ) = 1.0;
+				ControlPTUnitOutputPar( 8 ) = 1.0;
 			} else {
-				Par( 8 ) = 0.0;
+				ControlPTUnitOutputPar( 8 ) = 0.0;
 			}
-			SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, PartLoadFrac, PLRResidual, 0.0, 1.0, Par );
+			SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, PartLoadFrac, PLRResidual, 0.0, 1.0, ControlPTUnitOutputPar, "ControlPTUnitOutput" );
 			if ( SolFla == -1 ) {
 				//     Very low loads may not converge quickly. Tighten PLR boundary and try again.
 				TempMaxPLR = -0.1;
@@ -4319,7 +4354,7 @@ namespace PackagedTerminalHeatPump {
 					if ( HeatingLoad && TempOutput < QZnReq ) ContinueIter = false;
 					if ( CoolingLoad && TempOutput > QZnReq ) ContinueIter = false;
 				}
-				SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, PartLoadFrac, PLRResidual, TempMinPLR, TempMaxPLR, Par );
+				SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, PartLoadFrac, PLRResidual, TempMinPLR, TempMaxPLR, ControlPTUnitOutputPar, "ControlPTUnitOutput" );
 				if ( SolFla == -1 ) {
 					if ( ! FirstHVACIteration && ! WarmupFlag ) {
 						CalcPTUnit( PTUnitNum, FirstHVACIteration, PartLoadFrac, TempOutput, QZnReq, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
@@ -4484,9 +4519,7 @@ namespace PackagedTerminalHeatPump {
 		Real64 mdot; // local temporary for mass flow rate
 		Real64 MaxHotWaterFlow; // coil maximum hot water mass flow rate, kg/s
 		Real64 HotWaterMdot; // actual hot water mass flow rate
-		static Array1D< Real64 > Par( 3 );
 		int SolFlag;
-		static int ATMixOutNode( 0 ); // outlet node of ATM Mixer
 
 		//Tuned Named constants to avoid heap allocation when passed to Optional args
 		bool const True( true );
@@ -4667,15 +4700,15 @@ namespace PackagedTerminalHeatPump {
 						// control water flow to obtain output matching SupHeaterLoad
 						SolFlag = 0;
 						MinWaterFlow = 0.0;
-						Par( 1 ) = double( PTUnitNum );
+						CalcPTUnitPar( 1 ) = double( PTUnitNum );
 						if ( FirstHVACIteration ) {
-							Par( 2 ) = 1.0;
+							CalcPTUnitPar( 2 ) = 1.0;
 						} else {
-							Par( 2 ) = 0.0;
+							CalcPTUnitPar( 2 ) = 0.0;
 						}
-						Par( 3 ) = SupHeaterLoad;
+						CalcPTUnitPar( 3 ) = SupHeaterLoad;
 						MaxHotWaterFlow = PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow;
-						SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, HotWaterMdot, HotWaterCoilResidual, MinWaterFlow, MaxHotWaterFlow, Par );
+						SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, HotWaterMdot, HotWaterCoilResidual, MinWaterFlow, MaxHotWaterFlow, CalcPTUnitPar, "CalcPTUnit" );
 						if ( SolFlag == -1 ) {
 							if ( PTUnit( PTUnitNum ).HotWaterCoilMaxIterIndex == 0 ) {
 								ShowWarningMessage( "CalcPTUnit: Hot water coil control failed for " + PTUnit( PTUnitNum ).UnitType + "=\"" + PTUnit( PTUnitNum ).Name + "\"" );
@@ -5594,20 +5627,16 @@ namespace PackagedTerminalHeatPump {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 PartLoadFrac( 0.0 ); // compressor part load fraction
-		static Real64 SpeedRatio( 0.0 ); // compressor speed ratio
 		bool UnitOn; // TRUE if unit is on
 		int OutletNode; // MSHP air outlet node
 		int InletNode; // MSHP air inlet node
 		Real64 AirMassFlow; // air mass flow rate [kg/s]
 		Real64 QTotUnitOut; // capacity output
-		static int SpeedNum( 1 ); // Speed number
 		int AirLoopNumber; // Index to air loop
 		Real64 SaveMassFlowRate; // saved inlet air mass flow rate [kg/s]
 		Real64 QSensUnitOut; // sensible capacity output
 		Real64 QLatUnitOut; // latent capacity output
 		int CompOp; // compressor operation; 1=on, 0=off
-		static Real64 TotalZoneLatentLoad; // Total ZONE heating load (not including outside air)
 		int TotBranchNum; // total outlet branch number
 		int ZoneSideNodeNum; // zone equip supply node
 		bool EconoActive; // TRUE if Economizer is active
@@ -5671,33 +5700,33 @@ namespace PackagedTerminalHeatPump {
 		if ( ! FirstHVACIteration && PTUnit( PTUnitNum ).OpMode == CycFanCycCoil && ( QZnReq < ( -1.0 * SmallLoad ) || TotalZoneLatentLoad > SmallLoad ) && EconoActive ) {
 			// for cycling fan, cooling load, check whether furnace can meet load with compressor off
 			CompOp = Off;
-			ControlVSHPOutput( PTUnitNum, FirstHVACIteration, CompOp, OpMode, QZnReq, TotalZoneLatentLoad, ZoneNum, SpeedNum, SpeedRatio, PartLoadFrac, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
+			ControlVSHPOutput( PTUnitNum, FirstHVACIteration, CompOp, OpMode, QZnReq, TotalZoneLatentLoad, ZoneNum, SimVariableSpeedHPSpeedNum, SimVariableSpeedHPSpeedRatio, SimVariableSpeedHPPartLoadFrac, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
 
-			if ( SpeedNum == PTUnit( PTUnitNum ).NumOfSpeedCooling && SpeedRatio == 1.0 ) {
+			if ( SimVariableSpeedHPSpeedNum == PTUnit( PTUnitNum ).NumOfSpeedCooling && SimVariableSpeedHPSpeedRatio == 1.0 ) {
 				// compressor on (reset inlet air mass flow rate to starting value)
 				Node( InletNode ).MassFlowRate = SaveMassFlowRate;
 				CompOp = On;
-				ControlVSHPOutput( PTUnitNum, FirstHVACIteration, CompOp, OpMode, QZnReq, TotalZoneLatentLoad, ZoneNum, SpeedNum, SpeedRatio, PartLoadFrac, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
+				ControlVSHPOutput( PTUnitNum, FirstHVACIteration, CompOp, OpMode, QZnReq, TotalZoneLatentLoad, ZoneNum, SimVariableSpeedHPSpeedNum, SimVariableSpeedHPSpeedRatio, SimVariableSpeedHPPartLoadFrac, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
 			}
 		} else {
 			// compressor on
 			CompOp = On;
-			ControlVSHPOutput( PTUnitNum, FirstHVACIteration, CompOp, OpMode, QZnReq, TotalZoneLatentLoad, ZoneNum, SpeedNum, SpeedRatio, PartLoadFrac, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
+			ControlVSHPOutput( PTUnitNum, FirstHVACIteration, CompOp, OpMode, QZnReq, TotalZoneLatentLoad, ZoneNum, SimVariableSpeedHPSpeedNum, SimVariableSpeedHPSpeedRatio, SimVariableSpeedHPPartLoadFrac, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
 		}
 
 		if ( PTUnit( PTUnitNum ).UnitType_Num == PTACUnit ) {
-			SaveCompressorPLR = PartLoadFrac;
+			SaveCompressorPLR = SimVariableSpeedHPPartLoadFrac;
 		} else {
-			if ( SpeedNum > 1 ) {
+			if ( SimVariableSpeedHPSpeedNum > 1 ) {
 				SaveCompressorPLR = 1.0;
 			}
 
-			if ( PartLoadFrac == 1.0 && SaveCompressorPLR < 1.0 ) {
-				PartLoadFrac = SaveCompressorPLR;
+			if ( SimVariableSpeedHPPartLoadFrac == 1.0 && SaveCompressorPLR < 1.0 ) {
+				SimVariableSpeedHPPartLoadFrac = SaveCompressorPLR;
 			}
 		}
 
-		CalcVarSpeedHeatPump( PTUnitNum, ZoneNum, FirstHVACIteration, CompOp, SpeedNum, SpeedRatio, PartLoadFrac, QSensUnitOut, QLatUnitOut, QZnReq, TotalZoneLatentLoad, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
+		CalcVarSpeedHeatPump( PTUnitNum, ZoneNum, FirstHVACIteration, CompOp, SimVariableSpeedHPSpeedNum, SimVariableSpeedHPSpeedRatio, SimVariableSpeedHPPartLoadFrac, QSensUnitOut, QLatUnitOut, QZnReq, TotalZoneLatentLoad, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
 
 		// calculate delivered capacity
 		AirMassFlow = Node( InletNode ).MassFlowRate;
@@ -5730,8 +5759,8 @@ namespace PackagedTerminalHeatPump {
 			if ( SupHeaterLoad > 0.0 ) {
 				PTUnit( PTUnitNum ).FanPartLoadRatio = 1.0;
 			} else {
-				if ( SpeedNum < 2 ) {
-					PTUnit( PTUnitNum ).FanPartLoadRatio = PartLoadFrac;
+				if ( SimVariableSpeedHPSpeedNum < 2 ) {
+					PTUnit( PTUnitNum ).FanPartLoadRatio = SimVariableSpeedHPPartLoadFrac;
 				} else {
 					PTUnit( PTUnitNum ).FanPartLoadRatio = 1.0;
 				}
@@ -5740,8 +5769,8 @@ namespace PackagedTerminalHeatPump {
 			if ( UnitOn ) {
 				PTUnit( PTUnitNum ).FanPartLoadRatio = 1.0;
 			} else {
-				if ( SpeedNum < 2 ) {
-					PTUnit( PTUnitNum ).FanPartLoadRatio = PartLoadFrac;
+				if ( SimVariableSpeedHPSpeedNum < 2 ) {
+					PTUnit( PTUnitNum ).FanPartLoadRatio = SimVariableSpeedHPPartLoadFrac;
 				} else {
 					PTUnit( PTUnitNum ).FanPartLoadRatio = 1.0;
 				}
@@ -5819,11 +5848,8 @@ namespace PackagedTerminalHeatPump {
 		Real64 LatOutput; // latent capacity output
 		Real64 ErrorToler; // error tolerance
 		int SolFla; // Flag of RegulaFalsi solver
-		static Array1D< Real64 > Par( 11 ); // Parameters passed to RegulaFalsi
 		Real64 CpAir; // air specific heat
 		int i; // Speed index
-		static int ErrCountCyc( 0 ); // Counter used to minimize the occurrence of output warnings
-		static int ErrCountVar( 0 ); // Counter used to minimize the occurrence of output warnings
 		Real64 mdot; // coil fluid mass flow rate (kg/s)
 
 		// FLOW
@@ -5917,23 +5943,23 @@ namespace PackagedTerminalHeatPump {
 		// Calculate the part load fraction
 		if ( ( ( QZnReq > SmallLoad && QZnReq < FullOutput ) || ( QZnReq < ( -1.0 * SmallLoad ) && QZnReq > FullOutput ) || ( QLatReq < ( -1.0 * SmallLoad ) ) ) && ! CurDeadBandOrSetback( ZoneNum ) ) {
 
-			Par( 1 ) = PTUnitNum;
-			Par( 2 ) = ZoneNum;
+			ControlVSHPOutputPar( 1 ) = PTUnitNum;
+			ControlVSHPOutputPar( 2 ) = ZoneNum;
 			if ( FirstHVACIteration ) {
-				Par( 3 ) = 1.0;
+				ControlVSHPOutputPar( 3 ) = 1.0;
 			} else {
-				Par( 3 ) = 0.0;
-			}
-			Par( 4 ) = OpMode;
-			Par( 5 ) = QZnReq;
-			Par( 6 ) = OnOffAirFlowRatio;
-			Par( 7 ) = SupHeaterLoad;
-			Par( 9 ) = CompOp;
-			Par( 10 ) = 1.0;
+				ControlVSHPOutputPar( 3 ) = 0.0;
+			}
+			ControlVSHPOutputPar( 4 ) = OpMode;
+			ControlVSHPOutputPar( 5 ) = QZnReq;
+			ControlVSHPOutputPar( 6 ) = OnOffAirFlowRatio;
+			ControlVSHPOutputPar( 7 ) = SupHeaterLoad;
+			ControlVSHPOutputPar( 9 ) = CompOp;
+			ControlVSHPOutputPar( 10 ) = 1.0;
 			if ( HXUnitOn ) {
-				Par( 11 ) = 1.0;
+				ControlVSHPOutputPar( 11 ) = 1.0;
 			} else {
-				Par( 11 ) = 0.0;
+				ControlVSHPOutputPar( 11 ) = 0.0;
 			}
 			// Check whether the low speed coil can meet the load or not
 			CalcVarSpeedHeatPump( PTUnitNum, ZoneNum, FirstHVACIteration, CompOp, 1, 0.0, 1.0, LowOutput, LatOutput, QZnReq, QLatReq, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
@@ -5942,11 +5968,11 @@ namespace PackagedTerminalHeatPump {
 				SpeedNum = 1;
 
 				if ( QLatReq < 0.0 ) { //calculate latent heat residual
-					Par( 10 ) = 0.0;
-					Par( 5 ) = QLatReq;
+					ControlVSHPOutputPar( 10 ) = 0.0;
+					ControlVSHPOutputPar( 5 ) = QLatReq;
 				}
 
-				SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, PartLoadFrac, VSHPCyclingResidual, 0.0, 1.0, Par );
+				SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, PartLoadFrac, VSHPCyclingResidual, 0.0, 1.0, ControlVSHPOutputPar, "ControlVSHPOutput" );
 				if ( SolFla == -1 ) {
 					if ( ! WarmupFlag ) {
 						if ( ErrCountCyc == 0 ) {
@@ -5990,14 +6016,14 @@ namespace PackagedTerminalHeatPump {
 						}
 					}
 				}
-				Par( 8 ) = SpeedNum;
+				ControlVSHPOutputPar( 8 ) = SpeedNum;
 
 				if ( QLatReq < ( -1.0 * SmallLoad ) ) { //calculate latent heat residual
-					Par( 10 ) = 0.0;
-					Par( 5 ) = QLatReq;
+					ControlVSHPOutputPar( 10 ) = 0.0;
+					ControlVSHPOutputPar( 5 ) = QLatReq;
 				}
 
-				SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, SpeedRatio, VSHPSpeedResidual, 1.0e-10, 1.0, Par );
+				SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, SpeedRatio, VSHPSpeedResidual, 1.0e-10, 1.0, ControlVSHPOutputPar, "ControlVSHPOutput" );
 				if ( SolFla == -1 ) {
 					if ( ! WarmupFlag ) {
 						if ( ErrCountVar == 0 ) {
@@ -6378,9 +6404,7 @@ namespace PackagedTerminalHeatPump {
 		Real64 mdot; // local temporary for mass flow rate
 		Real64 MaxHotWaterFlow; // coil maximum hot water mass flow rate, kg/s
 		Real64 HotWaterMdot; // actual hot water mass flow rate
-		static Array1D< Real64 > Par( 3 );
 		int SolFlag;
-		static int ATMixOutNode( 0 ); // outlet node of ATM Mixer
 
 		// FLOW
 
@@ -6405,7 +6429,7 @@ namespace PackagedTerminalHeatPump {
 
 		if ( PTUnit( PTUnitNum ).ATMixerExists ) {
 			// There is an air terminal mixer
-			ATMixOutNode = PTUnit( PTUnitNum ).ATMixerOutNode;
+			CalcVarSpeedHeatPumpATMixOutNode = PTUnit( PTUnitNum ).ATMixerOutNode;
 			if ( PTUnit( PTUnitNum ).ATMixerType == ATMixer_InletSide ) { // if there is an inlet side air terminal mixer
 				// set the primary air inlet mass flow rate
 				Node( PTUnit( PTUnitNum ).ATMixerPriNode ).MassFlowRate = min( Node( PTUnit( PTUnitNum ).ATMixerPriNode ).MassFlowRateMaxAvail, Node( InletNode ).MassFlowRate );
@@ -6415,7 +6439,7 @@ namespace PackagedTerminalHeatPump {
 			}
 		} else {
 			// No air terminal mixer; simulate the outside air mixer
-			ATMixOutNode = 0;
+			CalcVarSpeedHeatPumpATMixOutNode = 0;
 			if ( PTUnit( PTUnitNum ).OutsideAirNode > 0 ) SimOAMixer( PTUnit( PTUnitNum ).OAMixName, FirstHVACIteration, PTUnit( PTUnitNum ).OAMixIndex );
 		}
 
@@ -6516,15 +6540,15 @@ namespace PackagedTerminalHeatPump {
 						// control water flow to obtain output matching SupHeaterLoad
 						SolFlag = 0;
 						MinWaterFlow = 0.0;
-						Par( 1 ) = double( PTUnitNum );
+						CalcVarSpeedHeatPumpPar( 1 ) = double( PTUnitNum );
 						if ( FirstHVACIteration ) {
-							Par( 2 ) = 1.0;
+							CalcVarSpeedHeatPumpPar( 2 ) = 1.0;
 						} else {
-							Par( 2 ) = 0.0;
+							CalcVarSpeedHeatPumpPar( 2 ) = 0.0;
 						}
-						Par( 3 ) = SupHeaterLoad;
+						CalcVarSpeedHeatPumpPar( 3 ) = SupHeaterLoad;
 						MaxHotWaterFlow = PTUnit( PTUnitNum ).MaxSuppCoilFluidFlow;
-						SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, HotWaterMdot, HotWaterCoilResidual, MinWaterFlow, MaxHotWaterFlow, Par );
+						SolveRegulaFalsi( ErrTolerance, SolveMaxIter, SolFlag, HotWaterMdot, HotWaterCoilResidual, MinWaterFlow, MaxHotWaterFlow, CalcVarSpeedHeatPumpPar, "CalcVarSpeedHeatPump" );
 						if ( SolFlag == -1 ) {
 							if ( PTUnit( PTUnitNum ).HotWaterCoilMaxIterIndex == 0 ) {
 								ShowWarningMessage( "RoutineName//Hot water coil control failed for " + PTUnit( PTUnitNum ).UnitType + "=\"" + PTUnit( PTUnitNum ).Name + "\"" ); //Autodesk:Bug? Meant RoutineName + "Hot water...
@@ -6567,7 +6591,7 @@ namespace PackagedTerminalHeatPump {
 		if ( PTUnit( PTUnitNum ).ATMixerExists ) {
 			if ( PTUnit( PTUnitNum ).ATMixerType == ATMixer_SupplySide ) {
 				// Air terminal supply side mixer
-				LoadMet = Node( ATMixOutNode ).MassFlowRate * ( PsyHFnTdbW( Node( ATMixOutNode ).Temp, Node( ZoneNode ).HumRat ) - PsyHFnTdbW( Node( ZoneNode ).Temp, Node( ZoneNode ).HumRat ) );
+				LoadMet = Node( CalcVarSpeedHeatPumpATMixOutNode ).MassFlowRate * ( PsyHFnTdbW( Node( CalcVarSpeedHeatPumpATMixOutNode ).Temp, Node( ZoneNode ).HumRat ) - PsyHFnTdbW( Node( ZoneNode ).Temp, Node( ZoneNode ).HumRat ) );
 			} else {
 				// Air terminal inlet side mixer
 				LoadMet = AirMassFlow * ( PsyHFnTdbW( Node( OutletNode ).Temp, Node( ZoneNode ).HumRat ) - PsyHFnTdbW( Node( ZoneNode ).Temp, Node( ZoneNode ).HumRat ) );
@@ -6626,8 +6650,6 @@ namespace PackagedTerminalHeatPump {
 		int InletNode; // inlet node number for PTUnitNum
 		int OutsideAirNode; // outside air node number in PTHP loop
 		int AirRelNode; // relief air node number in PTHP loop
-		static Real64 AverageUnitMassFlow( 0.0 ); // average supply air mass flow rate over time step
-		static Real64 AverageOAMassFlow( 0.0 ); // average outdoor air mass flow rate over time step
 
 		MSHPMassFlowRateLow = 0.0; // Mass flow rate at low speed
 		MSHPMassFlowRateHigh = 0.0; // Mass flow rate at high speed
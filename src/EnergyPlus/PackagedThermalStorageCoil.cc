@@ -177,8 +177,41 @@ namespace PackagedThermalStorageCoil {
 	// Object Data
 	Array1D< PackagedTESCoolingCoilStruct > TESCoil;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetTESCoilInputErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		Array1D_bool MyFlag; // One time environment flag
+		Array1D_bool MySizeFlag; // One time sizing flag
+		Array1D_bool MyEnvrnFlag; // flag for init once at start of environment
+		Array1D_bool MyWarmupFlag; // flag for init after warmup complete
+		bool MyOneTimeFlag( true ); // One time flag used to allocate MyEnvrnFlag and MySizeFlag
+		Real64 FreezingTemp( 0.0 ); // zero degrees C
+	}
+
 	// Functions
 
+	// Clears the global data in PackagedThermalStorageCoil.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumTESCoils = 0;
+		CheckEquipName.deallocate();
+		GetTESInputFlag = true;
+		TESCoil.deallocate();
+		GetTESCoilInputErrorsFound = false;
+		MyFlag.deallocate();
+		MySizeFlag.deallocate();
+		MyEnvrnFlag.deallocate();
+		MyWarmupFlag.deallocate();
+		MyOneTimeFlag = true;
+		FreezingTemp = 0.0;
+	}
+
 	void
 	SimTESCoil(
 		std::string const & CompName, // name of the fan coil unit
@@ -330,7 +363,6 @@ namespace PackagedThermalStorageCoil {
 		int IOStatus; // Input status returned from GetObjectItem
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		bool errFlag;
 		Real64 TminRho;
 		Real64 TmaxRho;
@@ -350,12 +382,12 @@ namespace PackagedThermalStorageCoil {
 			IsBlank = false;
 			VerifyName( cAlphaArgs( 1 ), TESCoil, item - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetTESCoilInputErrorsFound = true;
 				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( cCurrentModuleObject, cAlphaArgs( 1 ), errFlag, cCurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetTESCoilInputErrorsFound = true;
 			}
 			TESCoil( item ).Name = cAlphaArgs( 1 );
 			if ( lAlphaFieldBlanks( 2 ) ) {
@@ -365,7 +397,7 @@ namespace PackagedThermalStorageCoil {
 				if ( TESCoil( item ).AvailSchedNum == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 					ShowContinueError( "..." + cAlphaFieldNames( 2 ) + "=\"" + cAlphaArgs( 2 ) + "\"." );
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				}
 			}
 			{ auto const SELECT_CASE_var( cAlphaArgs( 3 ) );
@@ -377,20 +409,20 @@ namespace PackagedThermalStorageCoil {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 				ShowContinueError( "..." + cAlphaFieldNames( 3 ) + "=\"" + cAlphaArgs( 3 ) + "\"." );
 				ShowContinueError( "Available choices are ScheduledModes or EMSControlled" );
-				ErrorsFound = true;
+				GetTESCoilInputErrorsFound = true;
 			}}
 			if ( lAlphaFieldBlanks( 4 ) ) {
 				if ( TESCoil( item ).ModeControlType == ScheduledOpModes ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 					ShowContinueError( cAlphaFieldNames( 4 ) + " is blank but a schedule is needed" );
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				}
 			} else {
 				TESCoil( item ).ControlModeSchedNum = GetScheduleIndex( cAlphaArgs( 4 ) );
 				if ( TESCoil( item ).ControlModeSchedNum == 0 && TESCoil( item ).ModeControlType == ScheduledOpModes ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 					ShowContinueError( "..." + cAlphaFieldNames( 4 ) + "=\"" + cAlphaArgs( 4 ) + "\"." );
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				}
 			}
 			{ auto const SELECT_CASE_var( cAlphaArgs( 5 ) );
@@ -406,7 +438,7 @@ namespace PackagedThermalStorageCoil {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 				ShowContinueError( "..." + cAlphaFieldNames( 5 ) + "=\"" + cAlphaArgs( 5 ) + "\"." );
 				ShowContinueError( "Available choices are Ice, Water, or UserDefindedFluidType" );
-				ErrorsFound = true;
+				GetTESCoilInputErrorsFound = true;
 			}}
 
 			if ( SameString( cAlphaArgs( 5 ), "USERDEFINEDFLUIDTYPE" ) ) {
@@ -415,20 +447,20 @@ namespace PackagedThermalStorageCoil {
 					if ( CheckFluidPropertyName( cAlphaArgs( 6 ) ) == 0 ) {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", missing fluid data" );
 						ShowContinueError( "Check that fluid property data have been input for fluid name = " + cAlphaArgs( 6 ) );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					} else {
 						TESCoil( item ).StorageFluidIndex = FindGlycol( cAlphaArgs( 6 ) );
 						if ( TESCoil( item ).StorageFluidIndex == 0 ) {
 							ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid fluid data" );
 							ShowContinueError( "Check that correct fluid property data have been input for fluid name = " + cAlphaArgs( 6 ) );
-							ErrorsFound = true;
+							GetTESCoilInputErrorsFound = true;
 						}
 					}
 
 				} else {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 					ShowContinueError( "Storage Type is set to UserDefinedFluidType but no name of fluid was entered." );
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				}
 
 			}
@@ -439,7 +471,7 @@ namespace PackagedThermalStorageCoil {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 				ShowContinueError( cNumericFieldNames( 1 ) + " cannot be blank for Water storage type" );
 				ShowContinueError( "Enter fluid storage tank volume in m3/s." );
-				ErrorsFound = true;
+				GetTESCoilInputErrorsFound = true;
 			}
 
 			if ( ( TESCoil( item ).StorageMedia == IceBased ) && ( ! lNumericFieldBlanks( 2 ) ) ) {
@@ -452,12 +484,12 @@ namespace PackagedThermalStorageCoil {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 				ShowContinueError( cNumericFieldNames( 2 ) + " cannot be blank for Ice storage type" );
 				ShowContinueError( "Enter ice storage tank capacity in GJ." );
-				ErrorsFound = true;
+				GetTESCoilInputErrorsFound = true;
 			}
 
 			TESCoil( item ).StorageCapacitySizingFactor = rNumericArgs( 3 );
 
-			TESCoil( item ).StorageAmbientNodeNum = GetOnlySingleNode( cAlphaArgs( 7 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Sensor, 1, ObjectIsNotParent );
+			TESCoil( item ).StorageAmbientNodeNum = GetOnlySingleNode( cAlphaArgs( 7 ), GetTESCoilInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Sensor, 1, ObjectIsNotParent );
 
 			ZoneIndexTrial = FindControlledZoneIndexFromSystemNodeNumberForZone( TESCoil( item ).StorageAmbientNodeNum );
 			if ( ZoneIndexTrial > 0 ) { // tank is inside a zone so setup internal gains
@@ -468,8 +500,8 @@ namespace PackagedThermalStorageCoil {
 			TESCoil( item ).RatedFluidTankTemp = rNumericArgs( 5 );
 			TESCoil( item ).RatedEvapAirVolFlowRate = rNumericArgs( 6 );
 
-			TESCoil( item ).EvapAirInletNodeNum = GetOnlySingleNode( cAlphaArgs( 8 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			TESCoil( item ).EvapAirOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 9 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			TESCoil( item ).EvapAirInletNodeNum = GetOnlySingleNode( cAlphaArgs( 8 ), GetTESCoilInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			TESCoil( item ).EvapAirOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 9 ), GetTESCoilInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 			TestCompSet( cCurrentModuleObject, cAlphaArgs( 1 ), cAlphaArgs( 8 ), cAlphaArgs( 9 ), "Air Nodes" );
 
 			{ auto const SELECT_CASE_var( cAlphaArgs( 10 ) );
@@ -482,7 +514,7 @@ namespace PackagedThermalStorageCoil {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 				ShowContinueError( "..." + cAlphaFieldNames( 10 ) + "=\"" + cAlphaArgs( 10 ) + "\"." );
 				ShowContinueError( "Available choices are Yes or No." );
-				ErrorsFound = true;
+				GetTESCoilInputErrorsFound = true;
 			}}
 
 			TESCoil( item ).CoolingOnlyRatedTotCap = rNumericArgs( 7 );
@@ -500,7 +532,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 11 ) + "=\"" + cAlphaArgs( 11 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingOnlyCapFTempCurve ) );
@@ -510,7 +542,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 11 ) + "=\"" + cAlphaArgs( 11 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with two independent variables, x and y." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -523,7 +555,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 12 ) + "=\"" + cAlphaArgs( 12 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingOnlyCapFFlowCurve ) );
@@ -533,7 +565,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 12 ) + "=\"" + cAlphaArgs( 12 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -546,7 +578,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 13 ) + "=\"" + cAlphaArgs( 13 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingOnlyEIRFTempCurve ) );
@@ -556,7 +588,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 13 ) + "=\"" + cAlphaArgs( 13 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with two independent variables, x and y." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -569,7 +601,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 14 ) + "=\"" + cAlphaArgs( 14 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingOnlyEIRFFlowCurve ) );
@@ -579,7 +611,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 14 ) + "=\"" + cAlphaArgs( 14 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -592,7 +624,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 15 ) + "=\"" + cAlphaArgs( 15 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingOnlyPLFFPLRCurve ) );
@@ -602,7 +634,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 15 ) + "=\"" + cAlphaArgs( 15 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -615,7 +647,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 16 ) + "=\"" + cAlphaArgs( 16 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingOnlySHRFTempCurve ) );
@@ -625,7 +657,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 16 ) + "=\"" + cAlphaArgs( 16 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with two independent variables, x and y." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -638,7 +670,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 17 ) + "=\"" + cAlphaArgs( 17 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingOnlySHRFFlowCurve ) );
@@ -648,7 +680,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 17 ) + "=\"" + cAlphaArgs( 17 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -664,7 +696,7 @@ namespace PackagedThermalStorageCoil {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 				ShowContinueError( "..." + cAlphaFieldNames( 18 ) + "=\"" + cAlphaArgs( 18 ) + "\"." );
 				ShowContinueError( "Available choices are Yes or No." );
-				ErrorsFound = true;
+				GetTESCoilInputErrorsFound = true;
 			}}
 
 			if ( TESCoil( item ).CoolingAndChargeModeAvailable ) {
@@ -686,7 +718,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 19 ) + "=\"" + cAlphaArgs( 19 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndChargeCoolingCapFTempCurve ) );
@@ -696,7 +728,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 19 ) + "=\"" + cAlphaArgs( 19 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with three independent variables -- x, y, and z." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -709,7 +741,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 20 ) + "=\"" + cAlphaArgs( 20 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndChargeCoolingCapFFlowCurve ) );
@@ -719,7 +751,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 20 ) + "=\"" + cAlphaArgs( 20 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -732,7 +764,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 21 ) + "=\"" + cAlphaArgs( 21 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndChargeCoolingEIRFTempCurve ) );
@@ -742,7 +774,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 21 ) + "=\"" + cAlphaArgs( 21 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with three independent variables -- x, y, and z." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -755,7 +787,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 22 ) + "=\"" + cAlphaArgs( 22 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndChargeCoolingEIRFFlowCurve ) );
@@ -765,7 +797,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 22 ) + "=\"" + cAlphaArgs( 22 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -778,7 +810,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 23 ) + "=\"" + cAlphaArgs( 23 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndChargeCoolingPLFFPLRCurve ) );
@@ -788,7 +820,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 23 ) + "=\"" + cAlphaArgs( 23 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -801,7 +833,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 24 ) + "=\"" + cAlphaArgs( 24 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndChargeChargingCapFTempCurve ) );
@@ -811,7 +843,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 24 ) + "=\"" + cAlphaArgs( 24 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with three independent variables -- x, y, and z." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -824,7 +856,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 25 ) + "=\"" + cAlphaArgs( 25 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndChargeChargingCapFEvapPLRCurve ) );
@@ -834,7 +866,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 25 ) + "=\"" + cAlphaArgs( 25 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -847,7 +879,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 26 ) + "=\"" + cAlphaArgs( 26 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndChargeChargingEIRFTempCurve ) );
@@ -857,7 +889,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 26 ) + "=\"" + cAlphaArgs( 26 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with three independent variables -- x, y, and z." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -870,7 +902,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 27 ) + "=\"" + cAlphaArgs( 27 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndChargeChargingEIRFFLowCurve ) );
@@ -880,7 +912,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 27 ) + "=\"" + cAlphaArgs( 27 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -893,7 +925,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 28 ) + "=\"" + cAlphaArgs( 28 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndChargeChargingPLFFPLRCurve ) );
@@ -903,7 +935,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 28 ) + "=\"" + cAlphaArgs( 28 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -916,7 +948,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 29 ) + "=\"" + cAlphaArgs( 29 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndChargeSHRFTempCurve ) );
@@ -926,7 +958,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 29 ) + "=\"" + cAlphaArgs( 29 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with two or three independent variables." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -939,7 +971,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 30 ) + "=\"" + cAlphaArgs( 30 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndChargeSHRFFlowCurve ) );
@@ -949,7 +981,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 30 ) + "=\"" + cAlphaArgs( 30 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -965,7 +997,7 @@ namespace PackagedThermalStorageCoil {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 				ShowContinueError( "..." + cAlphaFieldNames( 31 ) + "=\"" + cAlphaArgs( 31 ) + "\"." );
 				ShowContinueError( "Available choices are Yes or No." );
-				ErrorsFound = true;
+				GetTESCoilInputErrorsFound = true;
 			}}
 
 			if ( TESCoil( item ).CoolingAndDischargeModeAvailable ) {
@@ -987,7 +1019,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 32 ) + "=\"" + cAlphaArgs( 32 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndDischargeCoolingCapFTempCurve ) );
@@ -997,7 +1029,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 32 ) + "=\"" + cAlphaArgs( 32 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with three independent variables -- x, y, and z." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1010,7 +1042,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 33 ) + "=\"" + cAlphaArgs( 33 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndDischargeCoolingCapFFlowCurve ) );
@@ -1020,7 +1052,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 33 ) + "=\"" + cAlphaArgs( 33 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1033,7 +1065,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 34 ) + "=\"" + cAlphaArgs( 34 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndDischargeCoolingEIRFTempCurve ) );
@@ -1043,7 +1075,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 34 ) + "=\"" + cAlphaArgs( 34 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with three independent variables -- x, y, and z." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1056,7 +1088,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 35 ) + "=\"" + cAlphaArgs( 35 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndDischargeCoolingEIRFFlowCurve ) );
@@ -1066,7 +1098,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 35 ) + "=\"" + cAlphaArgs( 35 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1079,7 +1111,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 36 ) + "=\"" + cAlphaArgs( 36 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndDischargeCoolingPLFFPLRCurve ) );
@@ -1089,7 +1121,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 36 ) + "=\"" + cAlphaArgs( 36 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1102,7 +1134,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 37 ) + "=\"" + cAlphaArgs( 37 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndDischargeDischargingCapFTempCurve ) );
@@ -1112,7 +1144,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 37 ) + "=\"" + cAlphaArgs( 37 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with three independent variables -- x, y, and z." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1125,7 +1157,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 38 ) + "=\"" + cAlphaArgs( 38 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndDischargeDischargingCapFFlowCurve ) );
@@ -1135,7 +1167,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 38 ) + "=\"" + cAlphaArgs( 38 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1148,7 +1180,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 39 ) + "=\"" + cAlphaArgs( 39 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndDischargeDischargingCapFEvapPLRCurve ) );
@@ -1158,7 +1190,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 39 ) + "=\"" + cAlphaArgs( 39 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1171,7 +1203,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 40 ) + "=\"" + cAlphaArgs( 40 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndDischargeDischargingEIRFTempCurve ) );
@@ -1181,7 +1213,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 40 ) + "=\"" + cAlphaArgs( 40 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with three independent variables -- x, y, and z." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1194,7 +1226,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 41 ) + "=\"" + cAlphaArgs( 41 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndDischargeDischargingEIRFFLowCurve ) );
@@ -1204,7 +1236,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 41 ) + "=\"" + cAlphaArgs( 41 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1217,7 +1249,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 42 ) + "=\"" + cAlphaArgs( 42 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndDischargeDischargingPLFFPLRCurve ) );
@@ -1227,7 +1259,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 42 ) + "=\"" + cAlphaArgs( 42 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1240,7 +1272,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 43 ) + "=\"" + cAlphaArgs( 43 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndDischargeSHRFTempCurve ) );
@@ -1250,7 +1282,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 43 ) + "=\"" + cAlphaArgs( 43 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with two or three independent variables." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1263,7 +1295,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 44 ) + "=\"" + cAlphaArgs( 44 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).CoolingAndDischargeSHRFFlowCurve ) );
@@ -1273,7 +1305,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 44 ) + "=\"" + cAlphaArgs( 44 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1289,7 +1321,7 @@ namespace PackagedThermalStorageCoil {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 				ShowContinueError( "..." + cAlphaFieldNames( 45 ) + "=\"" + cAlphaArgs( 45 ) + "\"." );
 				ShowContinueError( "Available choices are Yes or No." );
-				ErrorsFound = true;
+				GetTESCoilInputErrorsFound = true;
 			}}
 
 			if ( TESCoil( item ).ChargeOnlyModeAvailable ) {
@@ -1307,7 +1339,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 46 ) + "=\"" + cAlphaArgs( 46 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).ChargeOnlyChargingCapFTempCurve ) );
@@ -1317,7 +1349,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 46 ) + "=\"" + cAlphaArgs( 46 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with two independent variables, x and y." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1330,7 +1362,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 47 ) + "=\"" + cAlphaArgs( 47 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).ChargeOnlyChargingEIRFTempCurve ) );
@@ -1340,7 +1372,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 47 ) + "=\"" + cAlphaArgs( 47 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with two independent variables, x and y." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1356,7 +1388,7 @@ namespace PackagedThermalStorageCoil {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 				ShowContinueError( "..." + cAlphaFieldNames( 48 ) + "=\"" + cAlphaArgs( 48 ) + "\"." );
 				ShowContinueError( "Available choices are Yes or No." );
-				ErrorsFound = true;
+				GetTESCoilInputErrorsFound = true;
 			}}
 
 			if ( TESCoil( item ).DischargeOnlyModeAvailable ) {
@@ -1374,7 +1406,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 49 ) + "=\"" + cAlphaArgs( 49 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).DischargeOnlyCapFTempCurve ) );
@@ -1384,7 +1416,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 49 ) + "=\"" + cAlphaArgs( 49 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with two independent variables, x and y." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1397,7 +1429,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 50 ) + "=\"" + cAlphaArgs( 50 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).DischargeOnlyCapFFlowCurve ) );
@@ -1407,7 +1439,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 50 ) + "=\"" + cAlphaArgs( 50 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1420,7 +1452,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 51 ) + "=\"" + cAlphaArgs( 51 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).DischargeOnlyEIRFTempCurve ) );
@@ -1430,7 +1462,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 51 ) + "=\"" + cAlphaArgs( 51 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with two independent variables, x and y." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1443,7 +1475,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 52 ) + "=\"" + cAlphaArgs( 52 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).DischargeOnlyEIRFFlowCurve ) );
@@ -1453,7 +1485,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 52 ) + "=\"" + cAlphaArgs( 52 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1466,7 +1498,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 53 ) + "=\"" + cAlphaArgs( 53 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).DischargeOnlyPLFFPLRCurve ) );
@@ -1476,7 +1508,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 53 ) + "=\"" + cAlphaArgs( 53 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1489,7 +1521,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 54 ) + "=\"" + cAlphaArgs( 54 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).DischargeOnlySHRFTempCurve ) );
@@ -1499,7 +1531,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 54 ) + "=\"" + cAlphaArgs( 54 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with two or three independent variables" );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1512,7 +1544,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( "Not found " + cAlphaFieldNames( 55 ) + "=\"" + cAlphaArgs( 55 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, any curve with just x as single independent variable
 					{ auto const SELECT_CASE_var( GetCurveObjectTypeNum( TESCoil( item ).DischargeOnlySHRFFLowCurve ) );
@@ -1522,7 +1554,7 @@ namespace PackagedThermalStorageCoil {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 						ShowContinueError( cAlphaFieldNames( 55 ) + "=\"" + cAlphaArgs( 55 ) + "\"." );
 						ShowContinueError( "Choose a curve or table with one independent variable, x." );
-						ErrorsFound = true;
+						GetTESCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1531,8 +1563,8 @@ namespace PackagedThermalStorageCoil {
 			TESCoil( item ).AncillaryControlsPower = rNumericArgs( 31 );
 			TESCoil( item ).ColdWeatherMinimumTempLimit = rNumericArgs( 32 );
 			TESCoil( item ).ColdWeatherAncillaryPower = rNumericArgs( 33 );
-			TESCoil( item ).CondAirInletNodeNum = GetOnlySingleNode( cAlphaArgs( 56 ), ErrorsFound, cCurrentModuleObject, TESCoil( item ).Name, NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsNotParent );
-			TESCoil( item ).CondAirOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 57 ), ErrorsFound, cCurrentModuleObject, TESCoil( item ).Name, NodeType_Air, NodeConnectionType_ReliefAir, 1, ObjectIsNotParent );
+			TESCoil( item ).CondAirInletNodeNum = GetOnlySingleNode( cAlphaArgs( 56 ), GetTESCoilInputErrorsFound, cCurrentModuleObject, TESCoil( item ).Name, NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsNotParent );
+			TESCoil( item ).CondAirOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 57 ), GetTESCoilInputErrorsFound, cCurrentModuleObject, TESCoil( item ).Name, NodeType_Air, NodeConnectionType_ReliefAir, 1, ObjectIsNotParent );
 
 			TESCoil( item ).CondenserAirVolumeFlow = rNumericArgs( 34 );
 			TESCoil( item ).CondenserAirFlowSizingFactor = rNumericArgs( 35 );
@@ -1546,7 +1578,7 @@ namespace PackagedThermalStorageCoil {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 				ShowContinueError( cAlphaFieldNames( 58 ) + "=\"" + cAlphaArgs( 58 ) + "\"." );
 				ShowContinueError( "Available choices are AirCooled or EvaporativelyCooled." );
-				ErrorsFound = true;
+				GetTESCoilInputErrorsFound = true;
 			}}
 			TESCoil( item ).EvapCondEffect = rNumericArgs( 36 );
 			TESCoil( item ).EvapCondPumpElecNomPower = rNumericArgs( 37 );
@@ -1560,7 +1592,7 @@ namespace PackagedThermalStorageCoil {
 				if ( TESCoil( item ).BasinHeaterAvailSchedNum == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 					ShowContinueError( "..." + cAlphaFieldNames( 59 ) + "=\"" + cAlphaArgs( 59 ) + "\"." );
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				}
 			}
 
@@ -1569,7 +1601,7 @@ namespace PackagedThermalStorageCoil {
 			} else {
 				TESCoil( item ).EvapWaterSupplyName = cAlphaArgs( 60 );
 				TESCoil( item ).EvapWaterSupplyMode = WaterSupplyFromTank;
-				SetupTankDemandComponent( TESCoil( item ).Name, cCurrentModuleObject, TESCoil( item ).EvapWaterSupplyName, ErrorsFound, TESCoil( item ).EvapWaterSupTankID, TESCoil( item ).EvapWaterTankDemandARRID );
+				SetupTankDemandComponent( TESCoil( item ).Name, cCurrentModuleObject, TESCoil( item ).EvapWaterSupplyName, GetTESCoilInputErrorsFound, TESCoil( item ).EvapWaterSupTankID, TESCoil( item ).EvapWaterTankDemandARRID );
 			}
 
 			if ( lAlphaFieldBlanks( 61 ) ) {
@@ -1577,23 +1609,23 @@ namespace PackagedThermalStorageCoil {
 			} else {
 				TESCoil( item ).CondensateCollectName = cAlphaArgs( 61 );
 				TESCoil( item ).CondensateCollectMode = CondensateToTank;
-				SetupTankSupplyComponent( TESCoil( item ).Name, cCurrentModuleObject, TESCoil( item ).CondensateCollectName, ErrorsFound, TESCoil( item ).CondensateTankID, TESCoil( item ).CondensateTankSupplyARRID );
+				SetupTankSupplyComponent( TESCoil( item ).Name, cCurrentModuleObject, TESCoil( item ).CondensateCollectName, GetTESCoilInputErrorsFound, TESCoil( item ).CondensateTankID, TESCoil( item ).CondensateTankSupplyARRID );
 			}
 
 			if ( ! lAlphaFieldBlanks( 62 ) ) {
-				TESCoil( item ).TESPlantInletNodeNum = GetOnlySingleNode( cAlphaArgs( 62 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+				TESCoil( item ).TESPlantInletNodeNum = GetOnlySingleNode( cAlphaArgs( 62 ), GetTESCoilInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
 
 				TESCoil( item ).TESPlantConnectionAvailable = true;
 			} else {
 				TESCoil( item ).TESPlantConnectionAvailable = false;
 			}
 			if ( ! lAlphaFieldBlanks( 63 ) ) {
-				TESCoil( item ).TESPlantOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 63 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+				TESCoil( item ).TESPlantOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 63 ), GetTESCoilInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
 			} else {
 				if ( TESCoil( item ).TESPlantConnectionAvailable ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + TESCoil( item ).Name + "\", invalid" );
 					ShowContinueError( "..." + cAlphaFieldNames( 63 ) + " cannot be blank." );
-					ErrorsFound = true;
+					GetTESCoilInputErrorsFound = true;
 				}
 
 			}
@@ -1629,7 +1661,7 @@ namespace PackagedThermalStorageCoil {
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetTESCoilInputErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in getting " + cCurrentModuleObject + " input. Preceding condition(s) causes termination." );
 		}
 
@@ -1743,11 +1775,6 @@ namespace PackagedThermalStorageCoil {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array1D_bool MyFlag; // One time environment flag
-		static Array1D_bool MySizeFlag; // One time sizing flag
-		static Array1D_bool MyEnvrnFlag; // flag for init once at start of environment
-		static Array1D_bool MyWarmupFlag; // flag for init after warmup complete
-		static bool MyOneTimeFlag( true ); // One time flag used to allocate MyEnvrnFlag and MySizeFlag
 		bool errFlag;
 		int plloopnum;
 		int lsnum;
@@ -4024,7 +4051,7 @@ namespace PackagedThermalStorageCoil {
 					Par( 3 ) = TESOpMode;
 					Par( 4 ) = OutletNode;
 					Par( 5 ) = double( FanOpMode );
-					SolveRegulaFalsi( Acc, MaxIte, SolFlag, PartLoadFrac, TESCoilResidualFunction, 0.0, 1.0, Par );
+					SolveRegulaFalsi( Acc, MaxIte, SolFlag, PartLoadFrac, TESCoilResidualFunction, 0.0, 1.0, Par, "CalcTESCoilDischargeOnlyMode" );
 					if ( SolFlag == -1 ) {
 						if ( ! WarmupFlag ) {
 							if ( SensPLRIter < 1 ) {
@@ -4077,7 +4104,7 @@ namespace PackagedThermalStorageCoil {
 						Par( 3 ) = TESOpMode;
 						Par( 4 ) = OutletNode;
 						Par( 5 ) = double( FanOpMode );
-						SolveRegulaFalsi( HumRatAcc, MaxIte, SolFlag, PartLoadFrac, TESCoilHumRatResidualFunction, 0.0, 1.0, Par );
+						SolveRegulaFalsi( HumRatAcc, MaxIte, SolFlag, PartLoadFrac, TESCoilHumRatResidualFunction, 0.0, 1.0, Par, "CalcTESCoilDischargeOnlyMode" );
 						if ( SolFlag == -1 ) {
 							if ( ! WarmupFlag ) {
 								if ( LatPLRIter < 1 ) {
@@ -4470,7 +4497,6 @@ namespace PackagedThermalStorageCoil {
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		static Real64 FreezingTemp( 0.0 ); // zero degrees C
 		static std::string const RoutineName( "CalcTESIceStorageTank" );
 
 		// INTERFACE BLOCK SPECIFICATIONS:
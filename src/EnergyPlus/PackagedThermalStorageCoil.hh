@@ -570,6 +570,11 @@ namespace PackagedThermalStorageCoil {
 
 	// Functions
 
+	// Clears the global data in PackagedThermalStorageCoil.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimTESCoil(
 		std::string const & CompName, // name of the fan coil unit
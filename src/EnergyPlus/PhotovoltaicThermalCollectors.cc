@@ -169,8 +169,83 @@ namespace PhotovoltaicThermalCollectors {
 	// Object Data
 	Array1D< PVTCollectorStruct > PVT;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // First time, input is "gotten"
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool InitPVTcollectorsErrorsFound( false );
+		bool MySetPointCheckFlag( true );
+		bool MyOneTimeFlag( true ); // one time flag
+		Array1D_bool SetLoopIndexFlag; // get loop number flag
+		int SurfNum( 0 );
+		int InletNode( 0 );
+		int OutletNode( 0 );
+		Real64 Eff( 0.0 );
+		int CalcPVTcollectorsSurfNum( 0 );
+		int RoughSurf( 0 );
+		Real64 HcExt( 0.0 );
+		Real64 HrSky( 0.0 );
+		Real64 HrGround( 0.0 );
+		Real64 HrAir( 0.0 );
+		Real64 Tcollector( 0.0 );
+		Real64 mdot( 0.0 );
+		Real64 Tinlet( 0.0 );
+		Real64 Winlet( 0.0 );
+		Real64 CpInlet( 0.0 );
+		Real64 PotentialOutletTemp( 0.0 );
+		Real64 BypassFraction( 0.0 );
+		Real64 PotentialHeatGain( 0.0 );
+		Real64 WetBulbInlet( 0.0 );
+		Real64 DewPointInlet( 0.0 );
+		int GetPVTThermalPowerProductionPVTnum( 0 );
+		int loop( 0 );
+	}
+
 	// Functions
 
+	// Clears the global data in PhotovoltaicThermalCollectors.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		CheckEquipName.deallocate();
+		NumPVT = 0;
+		NumSimplePVTPerform = 0;
+		PVT.deallocate();
+		GetInputFlag = true;
+		ErrorsFound = false;
+		InitPVTcollectorsErrorsFound = false;
+		MySetPointCheckFlag = true;
+		MyOneTimeFlag = true;
+		SetLoopIndexFlag.deallocate();
+		SurfNum = 0;
+		InletNode = 0;
+		OutletNode = 0;
+		Eff = 0.0;
+		CalcPVTcollectorsSurfNum = 0;
+		RoughSurf = 0;
+		HcExt = 0.0;
+		HrSky = 0.0;
+		HrGround = 0.0;
+		HrAir = 0.0;
+		Tcollector = 0.0;
+		mdot = 0.0;
+		Tinlet = 0.0;
+		Winlet = 0.0;
+		CpInlet = 0.0;
+		PotentialOutletTemp = 0.0;
+		BypassFraction = 0.0;
+		PotentialHeatGain = 0.0;
+		WetBulbInlet = 0.0;
+		DewPointInlet = 0.0;
+		GetPVTThermalPowerProductionPVTnum = 0;
+		loop = 0;
+	}
+
 	void
 	SimPVTcollectors(
 		int & PVTnum, // index to PVT array.
@@ -213,7 +288,6 @@ namespace PhotovoltaicThermalCollectors {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInputFlag( true ); // First time, input is "gotten"
 
 		if ( GetInputFlag ) {
 			GetPVTcollectorsInput();
@@ -321,7 +395,6 @@ namespace PhotovoltaicThermalCollectors {
 		int NumAlphas; // Number of Alphas for each GetObjectItem call
 		int NumNumbers; // Number of Numbers for each GetObjectItem call
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		int SurfNum; // local use only
 		int ThisParamObj;
 		bool IsNotOK; // Flag to verify name
@@ -582,10 +655,6 @@ namespace PhotovoltaicThermalCollectors {
 		int OutletNode;
 		int PVTindex;
 		int SurfNum;
-		static bool ErrorsFound( false );
-		static bool MySetPointCheckFlag( true );
-		static bool MyOneTimeFlag( true ); // one time flag
-		static Array1D_bool SetLoopIndexFlag; // get loop number flag
 		bool errFlag;
 		Real64 rho; // local fluid density kg/s
 
@@ -613,7 +682,7 @@ namespace PhotovoltaicThermalCollectors {
 				if ( PVT( PVTnum ).PVnum == 0 ) {
 					ShowSevereError( "Invalid name for photovoltaic generator = " + PVT( PVTnum ).PVname );
 					ShowContinueError( "Entered in flat plate photovoltaic-thermal collector = " + PVT( PVTnum ).Name );
-					ErrorsFound = true;
+					InitPVTcollectorsErrorsFound = true;
 				} else {
 					PVT( PVTnum ).PVfound = true;
 				}
@@ -621,7 +690,7 @@ namespace PhotovoltaicThermalCollectors {
 				if ( ( ! BeginEnvrnFlag ) && ( ! FirstHVACIteration ) ) {
 					ShowSevereError( "Photovoltaic generators are missing for Photovoltaic Thermal modeling" );
 					ShowContinueError( "Needed for flat plate photovoltaic-thermal collector = " + PVT( PVTnum ).Name );
-					ErrorsFound = true;
+					InitPVTcollectorsErrorsFound = true;
 				}
 			}
 		}
@@ -969,7 +1038,6 @@ namespace PhotovoltaicThermalCollectors {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int SurfNum( 0 );
 		//  INTEGER   :: PlantLoopNum = 0
 		//  REAL(r64) :: mdot  = 0.0D0
 
@@ -1091,28 +1159,9 @@ namespace PhotovoltaicThermalCollectors {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static int InletNode( 0 );
-		static int OutletNode( 0 );
-		static Real64 Eff( 0.0 );
-		static int SurfNum( 0 );
-		static int RoughSurf( 0 );
-		static Real64 HcExt( 0.0 );
-		static Real64 HrSky( 0.0 );
-		static Real64 HrGround( 0.0 );
-		static Real64 HrAir( 0.0 );
-		static Real64 Tcollector( 0.0 );
-		static Real64 mdot( 0.0 );
-		static Real64 Tinlet( 0.0 );
-		static Real64 Winlet( 0.0 );
-		static Real64 CpInlet( 0.0 );
-		static Real64 PotentialOutletTemp( 0.0 );
-		static Real64 BypassFraction( 0.0 );
-		static Real64 PotentialHeatGain( 0.0 );
-		static Real64 WetBulbInlet( 0.0 );
-		static Real64 DewPointInlet( 0.0 );
 
 		// flow
-		SurfNum = PVT( PVTnum ).SurfNum;
+		CalcPVTcollectorsSurfNum = PVT( PVTnum ).SurfNum;
 		RoughSurf = VerySmooth;
 
 		{ auto const SELECT_CASE_var( PVT( PVTnum ).WorkingFluidType );
@@ -1141,7 +1190,7 @@ namespace PhotovoltaicThermalCollectors {
 
 				}}
 
-				PotentialHeatGain = QRadSWOutIncident( SurfNum ) * Eff * PVT( PVTnum ).AreaCol;
+				PotentialHeatGain = QRadSWOutIncident( CalcPVTcollectorsSurfNum ) * Eff * PVT( PVTnum ).AreaCol;
 
 				if ( PVT( PVTnum ).WorkingFluidType == AirWorkingFluid ) {
 					Winlet = Node( InletNode ).HumRat;
@@ -1189,7 +1238,7 @@ namespace PhotovoltaicThermalCollectors {
 			} else if ( PVT( PVTnum ).CoolingUseful && PVT( PVTnum ).BypassDamperOff && ( mdot > 0.0 ) ) {
 				//calculate cooling using energy balance
 
-				InitExteriorConvectionCoeff( SurfNum, 0.0, RoughSurf, PVT( PVTnum ).Simple.SurfEmissivity, PVT( PVTnum ).Simple.LastCollectorTemp, HcExt, HrSky, HrGround, HrAir );
+				InitExteriorConvectionCoeff( CalcPVTcollectorsSurfNum, 0.0, RoughSurf, PVT( PVTnum ).Simple.SurfEmissivity, PVT( PVTnum ).Simple.LastCollectorTemp, HcExt, HrSky, HrGround, HrAir );
 
 				if ( PVT( PVTnum ).WorkingFluidType == AirWorkingFluid ) {
 					Winlet = Node( InletNode ).HumRat;
@@ -1200,7 +1249,7 @@ namespace PhotovoltaicThermalCollectors {
 					CpInlet = CPHW( Tinlet );
 				}
 
-				Tcollector = ( 2.0 * mdot * CpInlet * Tinlet + PVT( PVTnum ).AreaCol * ( HrGround * OutDryBulbTemp + HrSky * SkyTemp + HrAir * Surface( SurfNum ).OutDryBulbTemp + HcExt * Surface( SurfNum ).OutDryBulbTemp ) ) / ( 2.0 * mdot * CpInlet + PVT( PVTnum ).AreaCol * ( HrGround + HrSky + HrAir + HcExt ) );
+				Tcollector = ( 2.0 * mdot * CpInlet * Tinlet + PVT( PVTnum ).AreaCol * ( HrGround * OutDryBulbTemp + HrSky * SkyTemp + HrAir * Surface( CalcPVTcollectorsSurfNum ).OutDryBulbTemp + HcExt * Surface( CalcPVTcollectorsSurfNum ).OutDryBulbTemp ) ) / ( 2.0 * mdot * CpInlet + PVT( PVTnum ).AreaCol * ( HrGround + HrSky + HrAir + HcExt ) );
 
 				PotentialOutletTemp = 2.0 * Tcollector - Tinlet;
 				PVT( PVTnum ).Report.ToutletWorkFluid = PotentialOutletTemp;
@@ -1364,20 +1413,18 @@ namespace PhotovoltaicThermalCollectors {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int PVTnum( 0 );
-		static int loop( 0 );
 
 		// first find PVT index that is associated with this PV generator
 		for ( loop = 1; loop <= NumPVT; ++loop ) {
 			if ( ! PVT( loop ).PVfound ) continue;
 			if ( PVT( loop ).PVnum == PVindex ) { // we found it
-				PVTnum = loop;
+				GetPVTThermalPowerProductionPVTnum = loop;
 			}
 		}
 
-		if ( PVTnum > 0 ) {
-			ThermalPower = PVT( PVTnum ).Report.ThermPower;
-			ThermalEnergy = PVT( PVTnum ).Report.ThermEnergy;
+		if ( GetPVTThermalPowerProductionPVTnum > 0 ) {
+			ThermalPower = PVT( GetPVTThermalPowerProductionPVTnum ).Report.ThermPower;
+			ThermalEnergy = PVT( GetPVTThermalPowerProductionPVTnum ).Report.ThermEnergy;
 		} else {
 			ThermalPower = 0.0;
 			ThermalEnergy = 0.0;
@@ -226,6 +226,11 @@ namespace PhotovoltaicThermalCollectors {
 
 	// Functions
 
+	// Clears the global data in PhotovoltaicThermalCollectors.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimPVTcollectors(
 		int & PVTnum, // index to PVT array.
@@ -155,8 +155,36 @@ namespace Photovoltaics {
 
 	// *************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // one time get input flag
+		bool ErrorsFound( false ); // if errors detected in input
+		bool MyOneTimeFlag( true );
+		Array1D_bool MyEnvrnFlag;
+		Real64 PVTimeStep; // internal timestep (in seconds) for cell temperature mode 3
+		bool firstTime( true );
+	}
+
 	// Functions
 
+	// Clears the global data in Photovoltaics.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		CheckEquipName.deallocate();
+		GetInputFlag = true;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		MyEnvrnFlag.deallocate();
+		PVTimeStep = 0.0;
+		firstTime = true;
+	}
+
 	void
 	SimPVGenerator(
 		int const EP_UNUSED( GeneratorType ), // type of Generator !unused1208
@@ -203,7 +231,6 @@ namespace Photovoltaics {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int PVnum; // index of unit in PV array for Equivalent one-diode model
-		static bool GetInputFlag( true ); // one time get input flag
 
 		//Get PV data from input file
 		if ( GetInputFlag ) {
@@ -373,7 +400,6 @@ namespace Photovoltaics {
 		int NumAlphas; // Number of PV Array parameter alpha names being passed
 		int NumNums; // Number of PV Array numeric parameters are being passed
 		int IOStat;
-		static bool ErrorsFound( false ); // if errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int ThisParamObj;
@@ -1169,8 +1195,6 @@ namespace Photovoltaics {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyEnvrnFlag;
 		Real64 TimeElapsed; // Fraction of the current hour that has elapsed (h)
 
 		// perform the one time initializations
@@ -1263,7 +1287,6 @@ namespace Photovoltaics {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 PVTimeStep; // internal timestep (in seconds) for cell temperature mode 3
 		Real64 DummyErr;
 		Real64 ETA;
 		Real64 Tambient;
@@ -1293,7 +1316,6 @@ namespace Photovoltaics {
 		int K;
 		Real64 CellTemp( 0.0 ); // cell temperature in Kelvin
 		Real64 CellTempC; // cell temperature in degrees C
-		static bool firstTime( true );
 		//unused1208  INTEGER :: thisZone
 
 		// if the cell temperature mode is 2, convert the timestep to seconds
@@ -93,6 +93,11 @@ namespace Photovoltaics {
 
 	// Functions
 
+	// Clears the global data in Photovoltaics.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimPVGenerator(
 		int const GeneratorType, // type of Generator !unused1208
@@ -174,8 +174,122 @@ namespace PipeHeatTransfer {
 
 	//==============================================================================
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false ); // Set to true if errors in input,
+		bool IsNotOK( false );
+		bool IsBlank( false );
+		Real64 A1( 0.0 ); // sum of the heat balance terms
+		Real64 A2( 0.0 ); // mass flow term
+		Real64 A3( 0.0 ); // inside pipe wall convection term
+		Real64 A4( 0.0 ); // fluid node heat capacity term
+		Real64 B1( 0.0 ); // sum of the heat balance terms
+		Real64 B2( 0.0 ); // inside pipe wall convection term
+		Real64 B3( 0.0 ); // outside pipe wall convection term
+		Real64 B4( 0.0 ); // fluid node heat capacity term
+		Real64 AirConvCoef( 0.0 ); // air-pipe convection coefficient
+		Real64 FluidConvCoef( 0.0 ); // fluid-pipe convection coefficient
+		Real64 EnvHeatTransCoef( 0.0 ); // external convection coefficient (outside pipe)
+		Real64 FluidNodeHeatCapacity( 0.0 ); // local var for MCp for single node of pipe
+		int PipeDepth( 0 );
+		int PipeWidth( 0 );
+		int IterationIndex( 0 ); // Index when stepping through equations
+		int LengthIndex( 0 ); // Index for nodes along length of pipe
+		int DepthIndex( 0 ); // Index for nodes in the depth direction
+		int WidthIndex( 0 ); // Index for nodes in the width direction
+		Real64 ConvCoef( 0.0 ); // Current convection coefficient = f(Wind Speed,Roughness)
+		Real64 RadCoef( 0.0 ); // Current radiation coefficient
+		Real64 QSolAbsorbed( 0.0 ); // Current total solar energy absorbed
+		Real64 CalcBuriedPipeSoilA1( 0.0 ); // Placeholder for CoefA1
+		Real64 CalcBuriedPipeSoilA2( 0.0 ); // Placeholder for CoefA2
+		Real64 NodeBelow( 0.0 ); // Placeholder for Node temp below current node
+		Real64 NodeAbove( 0.0 ); // Placeholder for Node temp above current node
+		Real64 NodeRight( 0.0 ); // Placeholder for Node temp to the right of current node
+		Real64 NodeLeft( 0.0 ); // Placeholder for Node temp to the left of current node
+		Real64 NodePast( 0.0 ); // Placeholder for Node temp at current node but previous time step
+		Real64 PastNodeTempAbs( 0.0 ); // Placeholder for absolute temperature (K) version of NodePast
+		Real64 Ttemp( 0.0 ); // Placeholder for a current temperature node in convergence check
+		Real64 SkyTempAbs( 0.0 ); // Placeholder for current sky temperature in Kelvin
+		int TopRoughness( 0 ); // Placeholder for soil surface roughness
+		Real64 TopThermAbs( 0.0 ); // Placeholder for soil thermal radiation absorptivity
+		Real64 TopSolarAbs( 0.0 ); // Placeholder for soil solar radiation absorptivity
+		Real64 kSoil( 0.0 ); // Placeholder for soil conductivity
+		Real64 dS( 0.0 ); // Placeholder for soil grid spacing
+		Real64 rho( 0.0 ); // Placeholder for soil density
+		Real64 Cp( 0.0 ); // Placeholder for soil specific heat
+		bool MyEnvrnFlag( true );
+	}
+
 	// Functions
 
+	// Clears the global data in PipeHeatTransfer.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		nsvNumOfPipeHT = 0;
+		nsvInletNodeNum = 0;
+		nsvOutletNodeNum = 0;
+		nsvPipeHTNum = 0;
+		nsvMassFlowRate = 0.0;
+		nsvVolumeFlowRate = 0.0;
+		nsvDeltaTime = 0.0;
+		nsvInletTemp = 0.0;
+		nsvOutletTemp = 0.0;
+		nsvEnvironmentTemp = 0.0;
+		nsvEnvHeatLossRate = 0.0;
+		nsvFluidHeatLossRate = 0.0;
+		nsvNumInnerTimeSteps = 0;
+		GetPipeInputFlag = true;
+		PipeHT.deallocate();
+		ErrorsFound = false;
+		IsNotOK = false;
+		IsBlank = false;
+		A1 = 0.0;
+		A2 = 0.0;
+		A3 = 0.0;
+		A4 = 0.0;
+		B1 = 0.0;
+		B2 = 0.0;
+		B3 = 0.0;
+		B4 = 0.0;
+		AirConvCoef = 0.0;
+		FluidConvCoef = 0.0;
+		EnvHeatTransCoef = 0.0;
+		FluidNodeHeatCapacity = 0.0;
+		PipeDepth = 0;
+		PipeWidth = 0;
+		IterationIndex = 0;
+		LengthIndex = 0;
+		DepthIndex = 0;
+		WidthIndex = 0;
+		ConvCoef = 0.0;
+		RadCoef = 0.0;
+		QSolAbsorbed = 0.0;
+		CalcBuriedPipeSoilA1 = 0.0;
+		CalcBuriedPipeSoilA2 = 0.0;
+		NodeBelow = 0.0;
+		NodeAbove = 0.0;
+		NodeRight = 0.0;
+		NodeLeft = 0.0;
+		NodePast = 0.0;
+		PastNodeTempAbs = 0.0;
+		Ttemp = 0.0;
+		SkyTempAbs = 0.0;
+		TopRoughness = 0;
+		TopThermAbs = 0.0;
+		TopSolarAbs = 0.0;
+		kSoil = 0.0;
+		dS = 0.0;
+		rho = 0.0;
+		Cp = 0.0;
+		MyEnvrnFlag = true;
+	}
+
 	PlantComponent * PipeHTData::factory( int objectType, std::string objectName ) {
 		// Process the input data for pipes if it hasn't been done already
 		if ( GetPipeInputFlag ) {
@@ -287,9 +401,6 @@ namespace PipeHeatTransfer {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false ); // Set to true if errors in input,
-		static bool IsNotOK( false );
-		static bool IsBlank( false );
 
 		// fatal at end of routine
 		int IOStatus; // Used in GetObjectItem
@@ -1097,23 +1208,9 @@ namespace PipeHeatTransfer {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		// fluid node heat balance (see engineering doc).
-		static Real64 A1( 0.0 ); // sum of the heat balance terms
-		static Real64 A2( 0.0 ); // mass flow term
-		static Real64 A3( 0.0 ); // inside pipe wall convection term
-		static Real64 A4( 0.0 ); // fluid node heat capacity term
 		// pipe wall node heat balance (see engineering doc).
-		static Real64 B1( 0.0 ); // sum of the heat balance terms
-		static Real64 B2( 0.0 ); // inside pipe wall convection term
-		static Real64 B3( 0.0 ); // outside pipe wall convection term
-		static Real64 B4( 0.0 ); // fluid node heat capacity term
-
-		static Real64 AirConvCoef( 0.0 ); // air-pipe convection coefficient
-		static Real64 FluidConvCoef( 0.0 ); // fluid-pipe convection coefficient
-		static Real64 EnvHeatTransCoef( 0.0 ); // external convection coefficient (outside pipe)
-		static Real64 FluidNodeHeatCapacity( 0.0 ); // local var for MCp for single node of pipe
-
-		static int PipeDepth( 0 );
-		static int PipeWidth( 0 );
+
+
 		int curnode;
 		Real64 TempBelow;
 		Real64 TempBeside;
@@ -1279,33 +1376,9 @@ namespace PipeHeatTransfer {
 		Real64 const StefBoltzmann( 5.6697e-08 ); // Stefan-Boltzmann constant
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int IterationIndex( 0 ); // Index when stepping through equations
-		static int LengthIndex( 0 ); // Index for nodes along length of pipe
-		static int DepthIndex( 0 ); // Index for nodes in the depth direction
-		static int WidthIndex( 0 ); // Index for nodes in the width direction
-		static Real64 ConvCoef( 0.0 ); // Current convection coefficient = f(Wind Speed,Roughness)
-		static Real64 RadCoef( 0.0 ); // Current radiation coefficient
-		static Real64 QSolAbsorbed( 0.0 ); // Current total solar energy absorbed
 		Array3D< Real64 > T_O( this->PipeNodeWidth, this->NumDepthNodes, NumSections );
 
 		//Local variable placeholders for code readability
-		static Real64 A1( 0.0 ); // Placeholder for CoefA1
-		static Real64 A2( 0.0 ); // Placeholder for CoefA2
-		static Real64 NodeBelow( 0.0 ); // Placeholder for Node temp below current node
-		static Real64 NodeAbove( 0.0 ); // Placeholder for Node temp above current node
-		static Real64 NodeRight( 0.0 ); // Placeholder for Node temp to the right of current node
-		static Real64 NodeLeft( 0.0 ); // Placeholder for Node temp to the left of current node
-		static Real64 NodePast( 0.0 ); // Placeholder for Node temp at current node but previous time step
-		static Real64 PastNodeTempAbs( 0.0 ); // Placeholder for absolute temperature (K) version of NodePast
-		static Real64 Ttemp( 0.0 ); // Placeholder for a current temperature node in convergence check
-		static Real64 SkyTempAbs( 0.0 ); // Placeholder for current sky temperature in Kelvin
-		static int TopRoughness( 0 ); // Placeholder for soil surface roughness
-		static Real64 TopThermAbs( 0.0 ); // Placeholder for soil thermal radiation absorptivity
-		static Real64 TopSolarAbs( 0.0 ); // Placeholder for soil solar radiation absorptivity
-		static Real64 kSoil( 0.0 ); // Placeholder for soil conductivity
-		static Real64 dS( 0.0 ); // Placeholder for soil grid spacing
-		static Real64 rho( 0.0 ); // Placeholder for soil density
-		static Real64 Cp( 0.0 ); // Placeholder for soil specific heat
 
 		// There are a number of coefficients which change through the simulation, and they are updated here
 		this->FourierDS = this->SoilDiffusivity * nsvDeltaTime / pow_2( this->dSregular ); //Eq. D4
@@ -1403,19 +1476,19 @@ namespace PipeHeatTransfer {
 								NodeAbove = this->T( WidthIndex, DepthIndex - 1, LengthIndex, CurrentTimeIndex );
 								NodeBelow = this->T( WidthIndex, DepthIndex + 1, LengthIndex, CurrentTimeIndex );
 								NodePast = this->T( WidthIndex, DepthIndex, LengthIndex, CurrentTimeIndex - 1 );
-								A1 = this->CoefA1;
-								A2 = this->CoefA2;
+								CalcBuriedPipeSoilA1 = this->CoefA1;
+								CalcBuriedPipeSoilA2 = this->CoefA2;
 
 								//-Update Equation
-								this->T( WidthIndex, DepthIndex, LengthIndex, TentativeTimeIndex ) = A1 * ( NodeBelow + NodeAbove + 2 * NodeLeft ) + A2 * NodePast;
+								this->T( WidthIndex, DepthIndex, LengthIndex, TentativeTimeIndex ) = CalcBuriedPipeSoilA1 * ( NodeBelow + NodeAbove + 2 * NodeLeft ) + CalcBuriedPipeSoilA2 * NodePast;
 
 							} //Symmetric centerline node structure
 
 						} else { //All Normal Interior Nodes
 
 							//-Coefficients and Temperatures
-							A1 = this->CoefA1;
-							A2 = this->CoefA2;
+							CalcBuriedPipeSoilA1 = this->CoefA1;
+							CalcBuriedPipeSoilA2 = this->CoefA2;
 							NodeBelow = this->T( WidthIndex, DepthIndex + 1, LengthIndex, CurrentTimeIndex );
 							NodeAbove = this->T( WidthIndex, DepthIndex - 1, LengthIndex, CurrentTimeIndex );
 							NodeRight = this->T( WidthIndex + 1, DepthIndex, LengthIndex, CurrentTimeIndex );
@@ -1423,7 +1496,7 @@ namespace PipeHeatTransfer {
 							NodePast = this->T( WidthIndex, DepthIndex, LengthIndex, CurrentTimeIndex - 1 );
 
 							//-Update Equation
-							this->T( WidthIndex, DepthIndex, LengthIndex, TentativeTimeIndex ) = A1 * ( NodeBelow + NodeAbove + NodeRight + NodeLeft ) + A2 * NodePast; //Eq. D1
+							this->T( WidthIndex, DepthIndex, LengthIndex, TentativeTimeIndex ) = CalcBuriedPipeSoilA1 * ( NodeBelow + NodeAbove + NodeRight + NodeLeft ) + CalcBuriedPipeSoilA2 * NodePast; //Eq. D1
 
 						}
 					}
@@ -1598,7 +1671,6 @@ namespace PipeHeatTransfer {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		//  INTEGER :: PipeNum
 		//  INTEGER :: ZoneNum
-		static bool MyEnvrnFlag( true );
 		//  REAL(r64) :: QLossToZone
 
 		// FLOW:
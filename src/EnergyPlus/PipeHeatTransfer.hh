@@ -381,6 +381,13 @@ namespace PipeHeatTransfer {
 	GetPipesHeatTransfer();
 
 
+	// Functions
+
+	// Clears the global data in PipeHeatTransfer.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 } // PipeHeatTransfer
 
 } // EnergyPlus
@@ -125,6 +125,15 @@ namespace Pipes {
 	// Object Data
 	Array1D< LocalPipeData > LocalPipe; // dimension to number of pipes
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false );
+	}
+
 	// Functions
 	void
 	clear_state()
@@ -132,6 +141,7 @@ namespace Pipes {
 		NumLocalPipes = 0;
 		GetPipeInputFlag = true;
 		LocalPipe.deallocate();
+		ErrorsFound = false;
 	}
 
 	PlantComponent * LocalPipeData::factory( int objectType, std::string objectName ) {
@@ -225,7 +235,6 @@ namespace Pipes {
 		int NumAlphas; // Number of elements in the alpha array
 		int NumNums; // Number of elements in the numeric array
 		int IOStat; // IO Status when calling get input subroutine
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 
@@ -165,8 +165,86 @@ namespace PlantCentralGSHP {
 	// Beginning of Chiller/Heater Module Driver Subroutine
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int GetWrapperInputNumChillerHeaters( 0 ); // total number of chiller heater (without identical multiplier)
+		std::string CompName; // component name
+		bool ErrorsFound( false ); // True when input errors are found
+		bool AllocatedFlag( false ); // True when arrays are allocated
+		bool CHAllocatedFlag( false ); // True when arrays are allocated
+		int GetWrapperInputWrapperNum( 0 ); // wrapper number
+		int NumberOfComp( 0 ); // number of components under each wrapper
+		int Comp( 0 ); // an index number for input all the components
+		int loop( 0 ); // an index number for read in all the parameters of a component
+		int GetWrapperInputCompIndex( 0 ); // component index in the sequence of internal input array
+		int ChillerHeaterNum( 1 ); // chiller heater index pointer for current wrapper object
+		int NumChHtrPerWrapper( 0 ); // total number of chiller heaters (including identical units) per wrapper
+		bool CHErrorsFound( false ); // True when input errors are found
+		bool FoundNegValue( false ); // Used to evaluate PLFFPLR curve objects
+		int CurveCheck( 0 ); // Used to evaluate PLFFPLR curve objects
+		bool MyWrapperOneTimeFlag( true ); // Flag used to execute code only once
+		Array1D_bool MyWrapperFlag; // TRUE in order to set component location
+		Array1D_bool MyWrapperEnvrnFlag; // TRUE when new environment is started
+		bool IsLoadCoolRemaining( true );
+		bool NextCompIndicator( false ); // Component indicator when identical chiller heaters exist
+		bool IsLoadHeatRemaining( true ); // Ture if heating load remains for this chiller heater
+		bool CalcChillerHeaterModelNextCompIndicator( false ); // Component indicator when identical chiller heaters exist
+	}
+
 	// Functions
 
+	// Clears the global data in PlantCentralGSHP.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		SimulClgDominant = false;
+		SimulHtgDominant = false;
+		GetInputWrapper = true;
+		NumWrappers = 0;
+		NumChillerHeaters = 0;
+		CondenserFanPower = 0.0;
+		ChillerCapFT = 0.0;
+		ChillerEIRFT = 0.0;
+		ChillerEIRFPLR = 0.0;
+		ChillerPartLoadRatio = 0.0;
+		ChillerCyclingRatio = 0.0;
+		ChillerFalseLoadRate = 0.0;
+		CheckEquipName.deallocate();
+		CHCheckEquipName.deallocate();
+		HPCheckEquipName.deallocate();
+		Wrapper.deallocate();
+		ChillerHeater.deallocate();
+		ChillerHeaterReport.deallocate();
+		WrapperReport.deallocate();
+		GetWrapperInputNumChillerHeaters = 0;
+		CompName.clear();
+		ErrorsFound = false;
+		AllocatedFlag = false;
+		CHAllocatedFlag = false;
+		GetWrapperInputWrapperNum = 0;
+		NumberOfComp = 0;
+		Comp = 0;
+		loop = 0;
+		GetWrapperInputCompIndex = 0;
+		ChillerHeaterNum = 1;
+		NumChHtrPerWrapper = 0;
+		CHErrorsFound = false;
+		FoundNegValue = false;
+		CurveCheck = 0;
+		MyWrapperOneTimeFlag = true;
+		MyWrapperFlag.deallocate();
+		MyWrapperEnvrnFlag.deallocate();
+		IsLoadCoolRemaining = true;
+		NextCompIndicator = false;
+		IsLoadHeatRemaining = true;
+		CalcChillerHeaterModelNextCompIndicator = false;
+	}
+
 	void
 	SimCentralGroundSourceHeatPump(
 		std::string const & WrapperName, // User specified name of wrapper
@@ -628,29 +706,17 @@ namespace PlantCentralGSHP {
 		using General::RoundSigDigits;
 
 		// Locals
-		static int NumChillerHeaters( 0 ); // total number of chiller heater (without identical multiplier)
 
 		// PARAMETERS
 		// na
 
 		// LOCAL VARIABLES
-		static std::string CompName; // component name
-		static bool ErrorsFound( false ); // True when input errors are found
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
-		static bool AllocatedFlag( false ); // True when arrays are allocated
-		static bool CHAllocatedFlag( false ); // True when arrays are allocated
 		int NumAlphas; // Number of elements in the alpha array
 		int NumNums; // Number of elements in the numeric array
 		int IOStat; // IO Status when calling get input subroutine
 		int i_CH; // chiller heater index pointer
-		static int WrapperNum( 0 ); // wrapper number
-		static int NumberOfComp( 0 ); // number of components under each wrapper
-		static int Comp( 0 ); // an index number for input all the components
-		static int loop( 0 ); // an index number for read in all the parameters of a component
-		static int CompIndex( 0 ); // component index in the sequence of internal input array
-		static int ChillerHeaterNum( 1 ); // chiller heater index pointer for current wrapper object
-		static int NumChHtrPerWrapper( 0 ); // total number of chiller heaters (including identical units) per wrapper
 
 		if ( AllocatedFlag ) return;
 		cCurrentModuleObject = "CentralHeatPumpSystem";
@@ -668,17 +734,17 @@ namespace PlantCentralGSHP {
 		AllocatedFlag = true;
 
 		// Load arrays with electric EIR chiller data
-		for ( WrapperNum = 1; WrapperNum <= NumWrappers; ++WrapperNum ) {
-			GetObjectItem( cCurrentModuleObject, WrapperNum, cAlphaArgs, NumAlphas, rNumericArgs, NumNums, IOStat, _, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
+		for ( GetWrapperInputWrapperNum = 1; GetWrapperInputWrapperNum <= NumWrappers; ++GetWrapperInputWrapperNum ) {
+			GetObjectItem( cCurrentModuleObject, GetWrapperInputWrapperNum, cAlphaArgs, NumAlphas, rNumericArgs, NumNums, IOStat, _, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
 
-			Wrapper( WrapperNum ).Name = cAlphaArgs( 1 );
+			Wrapper( GetWrapperInputWrapperNum ).Name = cAlphaArgs( 1 );
 
 			// intialize nth chiller heater index (including identical units) for current wrapper
 			NumChHtrPerWrapper = 0;
 
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( cAlphaArgs( 1 ), Wrapper, WrapperNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
+			VerifyName( cAlphaArgs( 1 ), Wrapper, GetWrapperInputWrapperNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 
 			if ( IsNotOK ) {
 				ErrorsFound = true;
@@ -687,65 +753,65 @@ namespace PlantCentralGSHP {
 			}
 
 			if ( cAlphaArgs( 2 ) == "SMARTMIXING" ) {
-				Wrapper( WrapperNum ).ControlMode = SmartMixing;
+				Wrapper( GetWrapperInputWrapperNum ).ControlMode = SmartMixing;
 			}
 
-			Wrapper( WrapperNum ).CHWInletNodeNum = GetOnlySingleNode( cAlphaArgs( 3 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 1, ObjectIsNotParent ); //node name : connection should be careful!
-			Wrapper( WrapperNum ).CHWOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			Wrapper( GetWrapperInputWrapperNum ).CHWInletNodeNum = GetOnlySingleNode( cAlphaArgs( 3 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 1, ObjectIsNotParent ); //node name : connection should be careful!
+			Wrapper( GetWrapperInputWrapperNum ).CHWOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 			TestCompSet( cCurrentModuleObject, cAlphaArgs( 1 ), cAlphaArgs( 3 ), cAlphaArgs( 4 ), "Chilled Water Nodes" );
 
-			Wrapper( WrapperNum ).GLHEInletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent ); //node name : connection should be careful!
-			Wrapper( WrapperNum ).GLHEOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 6 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+			Wrapper( GetWrapperInputWrapperNum ).GLHEInletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent ); //node name : connection should be careful!
+			Wrapper( GetWrapperInputWrapperNum ).GLHEOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 6 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
 			TestCompSet( cCurrentModuleObject, cAlphaArgs( 1 ), cAlphaArgs( 5 ), cAlphaArgs( 6 ), "GLHE Nodes" );
 
-			Wrapper( WrapperNum ).HWInletNodeNum = GetOnlySingleNode( cAlphaArgs( 7 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 3, ObjectIsNotParent ); //node name : connection should be careful!
-			Wrapper( WrapperNum ).HWOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 8 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 3, ObjectIsNotParent );
+			Wrapper( GetWrapperInputWrapperNum ).HWInletNodeNum = GetOnlySingleNode( cAlphaArgs( 7 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 3, ObjectIsNotParent ); //node name : connection should be careful!
+			Wrapper( GetWrapperInputWrapperNum ).HWOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 8 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 3, ObjectIsNotParent );
 			TestCompSet( cCurrentModuleObject, cAlphaArgs( 1 ), cAlphaArgs( 7 ), cAlphaArgs( 8 ), "Hot Water Nodes" );
 
-			Wrapper( WrapperNum ).AncilliaryPower = rNumericArgs( 1 );
-			Wrapper( WrapperNum ).AncilliaryPwSchedule = cAlphaArgs( 9 );
+			Wrapper( GetWrapperInputWrapperNum ).AncilliaryPower = rNumericArgs( 1 );
+			Wrapper( GetWrapperInputWrapperNum ).AncilliaryPwSchedule = cAlphaArgs( 9 );
 			if ( lAlphaFieldBlanks( 9 ) ) {
-				Wrapper( WrapperNum ).SchedPtr = 0;
+				Wrapper( GetWrapperInputWrapperNum ).SchedPtr = 0;
 			} else {
-				Wrapper( WrapperNum ).SchedPtr = GetScheduleIndex( cAlphaArgs( 9 ) );
+				Wrapper( GetWrapperInputWrapperNum ).SchedPtr = GetScheduleIndex( cAlphaArgs( 9 ) );
 			}
 
 			NumberOfComp = ( NumAlphas - 9 ) / 3;
-			Wrapper( WrapperNum ).NumOfComp = NumberOfComp;
-			Wrapper( WrapperNum ).WrapperComp.allocate( NumberOfComp );
+			Wrapper( GetWrapperInputWrapperNum ).NumOfComp = NumberOfComp;
+			Wrapper( GetWrapperInputWrapperNum ).WrapperComp.allocate( NumberOfComp );
 
-			if ( Wrapper( WrapperNum ).NumOfComp == 0 ) {
-				ShowSevereError( "GetWrapperInput: No component names on " + cCurrentModuleObject + '=' + Wrapper( WrapperNum ).Name );
+			if ( Wrapper( GetWrapperInputWrapperNum ).NumOfComp == 0 ) {
+				ShowSevereError( "GetWrapperInput: No component names on " + cCurrentModuleObject + '=' + Wrapper( GetWrapperInputWrapperNum ).Name );
 				ErrorsFound = true;
 			} else {
 				Comp = 0;
 				for ( loop = 10; loop <= NumAlphas; loop += 3 ) {
 					++Comp;
-					Wrapper( WrapperNum ).WrapperComp( Comp ).WrapperPerformanceObjectType = cAlphaArgs( loop );
-					Wrapper( WrapperNum ).WrapperComp( Comp ).WrapperComponentName = cAlphaArgs( loop + 1 );
-					Wrapper( WrapperNum ).WrapperComp( Comp ).WrapperPerformanceObjectSch = cAlphaArgs( loop + 2 );
+					Wrapper( GetWrapperInputWrapperNum ).WrapperComp( Comp ).WrapperPerformanceObjectType = cAlphaArgs( loop );
+					Wrapper( GetWrapperInputWrapperNum ).WrapperComp( Comp ).WrapperComponentName = cAlphaArgs( loop + 1 );
+					Wrapper( GetWrapperInputWrapperNum ).WrapperComp( Comp ).WrapperPerformanceObjectSch = cAlphaArgs( loop + 2 );
 					if ( lAlphaFieldBlanks( loop + 2 ) ) {
-						Wrapper( WrapperNum ).WrapperComp( Comp ).CHSchedPtr = ScheduleAlwaysOn;
+						Wrapper( GetWrapperInputWrapperNum ).WrapperComp( Comp ).CHSchedPtr = ScheduleAlwaysOn;
 					} else {
-						Wrapper( WrapperNum ).WrapperComp( Comp ).CHSchedPtr = GetScheduleIndex( cAlphaArgs( loop + 2 ) );
+						Wrapper( GetWrapperInputWrapperNum ).WrapperComp( Comp ).CHSchedPtr = GetScheduleIndex( cAlphaArgs( loop + 2 ) );
 					}
-					Wrapper( WrapperNum ).WrapperComp( Comp ).WrapperIdenticalObjectNum = rNumericArgs( 1 + Comp );
-					if ( Wrapper( WrapperNum ).WrapperComp( Comp ).WrapperPerformanceObjectType == "CHILLERHEATERPERFORMANCE:ELECTRIC:EIR" ) {
+					Wrapper( GetWrapperInputWrapperNum ).WrapperComp( Comp ).WrapperIdenticalObjectNum = rNumericArgs( 1 + Comp );
+					if ( Wrapper( GetWrapperInputWrapperNum ).WrapperComp( Comp ).WrapperPerformanceObjectType == "CHILLERHEATERPERFORMANCE:ELECTRIC:EIR" ) {
 
 						// count number of chiller heaters (including identical units) for current wrapper
-						if ( Wrapper( WrapperNum ).WrapperComp( Comp ).WrapperIdenticalObjectNum > 1 ) {
-							NumChHtrPerWrapper += Wrapper( WrapperNum ).WrapperComp( Comp ).WrapperIdenticalObjectNum;
+						if ( Wrapper( GetWrapperInputWrapperNum ).WrapperComp( Comp ).WrapperIdenticalObjectNum > 1 ) {
+							NumChHtrPerWrapper += Wrapper( GetWrapperInputWrapperNum ).WrapperComp( Comp ).WrapperIdenticalObjectNum;
 						} else {
 							++NumChHtrPerWrapper;
 						}
 
 						// count total number of chiller heaters (not including identical units) for ALL wrappers
-						++NumChillerHeaters;
+						++GetWrapperInputNumChillerHeaters;
 
 					}
 				}
 
-				Wrapper( WrapperNum ).ChillerHeaterNums = NumChHtrPerWrapper;
+				Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterNums = NumChHtrPerWrapper;
 			}
 
 			if ( ErrorsFound ) {
@@ -753,44 +819,44 @@ namespace PlantCentralGSHP {
 			}
 
 			// ALLOCATE ARRAYS
-			if ( ( NumChillerHeaters == 0 ) && ( Wrapper( WrapperNum ).ControlMode == SmartMixing ) ) {
-				ShowFatalError( "SmartMixing Control Mode in object " + cCurrentModuleObject + " : " + Wrapper( WrapperNum ).Name + " need to apply to ChillerHeaterPerformance:Electric:EIR object(s)." );
+			if ( ( GetWrapperInputNumChillerHeaters == 0 ) && ( Wrapper( GetWrapperInputWrapperNum ).ControlMode == SmartMixing ) ) {
+				ShowFatalError( "SmartMixing Control Mode in object " + cCurrentModuleObject + " : " + Wrapper( GetWrapperInputWrapperNum ).Name + " need to apply to ChillerHeaterPerformance:Electric:EIR object(s)." );
 			}
 
 		}
 
-		if ( NumChillerHeaters > 0 ) {
+		if ( GetWrapperInputNumChillerHeaters > 0 ) {
 			if ( CHAllocatedFlag ) return;
 
-			for ( WrapperNum = 1; WrapperNum <= NumWrappers; ++WrapperNum ) {
-				Wrapper( WrapperNum ).ChillerHeater.allocate( Wrapper( WrapperNum ).ChillerHeaterNums );
-				Wrapper( WrapperNum ).ChillerHeaterReport.allocate( Wrapper( WrapperNum ).ChillerHeaterNums );
+			for ( GetWrapperInputWrapperNum = 1; GetWrapperInputWrapperNum <= NumWrappers; ++GetWrapperInputWrapperNum ) {
+				Wrapper( GetWrapperInputWrapperNum ).ChillerHeater.allocate( Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterNums );
+				Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport.allocate( Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterNums );
 			}
 			GetChillerHeaterInput();
 			CHAllocatedFlag = true;
 		}
 
-		for ( WrapperNum = 1; WrapperNum <= NumWrappers; ++WrapperNum ) {
+		for ( GetWrapperInputWrapperNum = 1; GetWrapperInputWrapperNum <= NumWrappers; ++GetWrapperInputWrapperNum ) {
 			ChillerHeaterNum = 0; // intialize nth chiller heater index (including identical units) for current wrapper
-			for ( Comp = 1; Comp <= Wrapper( WrapperNum ).NumOfComp; ++Comp ) {
-				if ( Wrapper( WrapperNum ).WrapperComp( Comp ).WrapperPerformanceObjectType == "CHILLERHEATERPERFORMANCE:ELECTRIC:EIR" ) {
-					CompName = Wrapper( WrapperNum ).WrapperComp( Comp ).WrapperComponentName;
-					CompIndex = FindItemInList( CompName, ChillerHeater );
+			for ( Comp = 1; Comp <= Wrapper( GetWrapperInputWrapperNum ).NumOfComp; ++Comp ) {
+				if ( Wrapper( GetWrapperInputWrapperNum ).WrapperComp( Comp ).WrapperPerformanceObjectType == "CHILLERHEATERPERFORMANCE:ELECTRIC:EIR" ) {
+					CompName = Wrapper( GetWrapperInputWrapperNum ).WrapperComp( Comp ).WrapperComponentName;
+					GetWrapperInputCompIndex = FindItemInList( CompName, ChillerHeater );
 					// User may enter invalid name rather than selecting one from the object list
-					if ( CompIndex <= 0 ) {
+					if ( GetWrapperInputCompIndex <= 0 ) {
 						ShowSevereError( "GetWrapperInput: Invalid Chiller Heater Modules Performance Component Name =" + CompName );
 						ShowContinueError( "Select the name of ChillerHeaterPerformance:Electric:EIR object(s) from the object list." );
 						ShowFatalError( "Program terminates due to preceding condition." );
 					}
-					Wrapper( WrapperNum ).WrapperComp( Comp ).WrapperPerformanceObjectIndex = CompIndex;
-					if ( ChillerHeater( CompIndex ).VariableFlow ) {
-						Wrapper( WrapperNum ).VariableFlowCH = true;
+					Wrapper( GetWrapperInputWrapperNum ).WrapperComp( Comp ).WrapperPerformanceObjectIndex = GetWrapperInputCompIndex;
+					if ( ChillerHeater( GetWrapperInputCompIndex ).VariableFlow ) {
+						Wrapper( GetWrapperInputWrapperNum ).VariableFlowCH = true;
 					}
-					for ( i_CH = 1; i_CH <= Wrapper( WrapperNum ).WrapperComp( Comp ).WrapperIdenticalObjectNum; ++i_CH ) {
+					for ( i_CH = 1; i_CH <= Wrapper( GetWrapperInputWrapperNum ).WrapperComp( Comp ).WrapperIdenticalObjectNum; ++i_CH ) {
 						// increment nth chiller heater index (including identical units) for current wrapper
 						++ChillerHeaterNum;
-						Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ) = ChillerHeater( CompIndex );
-						Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ) = ChillerHeaterReport( CompIndex );
+						Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ) = ChillerHeater( GetWrapperInputCompIndex );
+						Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ) = ChillerHeaterReport( GetWrapperInputCompIndex );
 					}
 				}
 			}
@@ -801,94 +867,94 @@ namespace PlantCentralGSHP {
 		if ( allocated( ChillerHeaterReport ) ) ChillerHeaterReport.deallocate();
 
 		//Set up output variables
-		for ( WrapperNum = 1; WrapperNum <= NumWrappers; ++WrapperNum ) {
-			SetupOutputVariable( "Chiller Heater System Cooling Electric Energy [J]", WrapperReport( WrapperNum ).TotElecCooling, "System", "Sum", Wrapper( WrapperNum ).Name, _, "ELECTRICITY", "Cooling", _, "Plant" );
+		for ( GetWrapperInputWrapperNum = 1; GetWrapperInputWrapperNum <= NumWrappers; ++GetWrapperInputWrapperNum ) {
+			SetupOutputVariable( "Chiller Heater System Cooling Electric Energy [J]", WrapperReport( GetWrapperInputWrapperNum ).TotElecCooling, "System", "Sum", Wrapper( GetWrapperInputWrapperNum ).Name, _, "ELECTRICITY", "Cooling", _, "Plant" );
 
-			SetupOutputVariable( "Chiller Heater System Heating Electric Energy [J]", WrapperReport( WrapperNum ).TotElecHeating, "System", "Sum", Wrapper( WrapperNum ).Name, _, "ELECTRICITY", "Heating", _, "Plant" );
+			SetupOutputVariable( "Chiller Heater System Heating Electric Energy [J]", WrapperReport( GetWrapperInputWrapperNum ).TotElecHeating, "System", "Sum", Wrapper( GetWrapperInputWrapperNum ).Name, _, "ELECTRICITY", "Heating", _, "Plant" );
 
-			SetupOutputVariable( "Chiller Heater System Cooling Electric Power [W]", WrapperReport( WrapperNum ).TotElecCoolingPwr, "System", "Average", Wrapper( WrapperNum ).Name );
+			SetupOutputVariable( "Chiller Heater System Cooling Electric Power [W]", WrapperReport( GetWrapperInputWrapperNum ).TotElecCoolingPwr, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).Name );
 
-			SetupOutputVariable( "Chiller Heater System Heating Electric Power [W]", WrapperReport( WrapperNum ).TotElecHeatingPwr, "System", "Average", Wrapper( WrapperNum ).Name );
+			SetupOutputVariable( "Chiller Heater System Heating Electric Power [W]", WrapperReport( GetWrapperInputWrapperNum ).TotElecHeatingPwr, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).Name );
 
-			SetupOutputVariable( "Chiller Heater System Cooling Energy [J]", WrapperReport( WrapperNum ).CoolingEnergy, "System", "Sum", Wrapper( WrapperNum ).Name, _, "ENERGYTRANSFER", "CHILLERS", _, "Plant" );
+			SetupOutputVariable( "Chiller Heater System Cooling Energy [J]", WrapperReport( GetWrapperInputWrapperNum ).CoolingEnergy, "System", "Sum", Wrapper( GetWrapperInputWrapperNum ).Name, _, "ENERGYTRANSFER", "CHILLERS", _, "Plant" );
 
-			SetupOutputVariable( "Chiller Heater System Heating Energy [J]", WrapperReport( WrapperNum ).HeatingEnergy, "System", "Sum", Wrapper( WrapperNum ).Name, _, "ENERGYTRANSFER", "BOILER", _, "Plant" );
+			SetupOutputVariable( "Chiller Heater System Heating Energy [J]", WrapperReport( GetWrapperInputWrapperNum ).HeatingEnergy, "System", "Sum", Wrapper( GetWrapperInputWrapperNum ).Name, _, "ENERGYTRANSFER", "BOILER", _, "Plant" );
 
-			SetupOutputVariable( "Chiller Heater System Source Heat Transfer Energy [J]", WrapperReport( WrapperNum ).GLHEEnergy, "System", "Sum", Wrapper( WrapperNum ).Name, _, "ENERGYTRANSFER", "HEATREJECTION", _, "Plant" );
+			SetupOutputVariable( "Chiller Heater System Source Heat Transfer Energy [J]", WrapperReport( GetWrapperInputWrapperNum ).GLHEEnergy, "System", "Sum", Wrapper( GetWrapperInputWrapperNum ).Name, _, "ENERGYTRANSFER", "HEATREJECTION", _, "Plant" );
 
-			SetupOutputVariable( "Chiller Heater System Cooling Rate [W]", WrapperReport( WrapperNum ).CoolingRate, "System", "Average", Wrapper( WrapperNum ).Name );
+			SetupOutputVariable( "Chiller Heater System Cooling Rate [W]", WrapperReport( GetWrapperInputWrapperNum ).CoolingRate, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).Name );
 
-			SetupOutputVariable( "Chiller Heater System Heating Rate [W]", WrapperReport( WrapperNum ).HeatingRate, "System", "Average", Wrapper( WrapperNum ).Name );
+			SetupOutputVariable( "Chiller Heater System Heating Rate [W]", WrapperReport( GetWrapperInputWrapperNum ).HeatingRate, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).Name );
 
-			SetupOutputVariable( "Chiller Heater System Source Heat Transfer Rate [W]", WrapperReport( WrapperNum ).GLHERate, "System", "Average", Wrapper( WrapperNum ).Name );
+			SetupOutputVariable( "Chiller Heater System Source Heat Transfer Rate [W]", WrapperReport( GetWrapperInputWrapperNum ).GLHERate, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).Name );
 
-			SetupOutputVariable( "Chiller Heater System Cooling Mass Flow Rate [kg/s]", WrapperReport( WrapperNum ).CHWmdot, "System", "Average", Wrapper( WrapperNum ).Name );
+			SetupOutputVariable( "Chiller Heater System Cooling Mass Flow Rate [kg/s]", WrapperReport( GetWrapperInputWrapperNum ).CHWmdot, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).Name );
 
-			SetupOutputVariable( "Chiller Heater System Heating Mass Flow Rate [kg/s]", WrapperReport( WrapperNum ).HWmdot, "System", "Average", Wrapper( WrapperNum ).Name );
+			SetupOutputVariable( "Chiller Heater System Heating Mass Flow Rate [kg/s]", WrapperReport( GetWrapperInputWrapperNum ).HWmdot, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).Name );
 
-			SetupOutputVariable( "Chiller Heater System Source Mass Flow Rate [kg/s]", WrapperReport( WrapperNum ).GLHEmdot, "System", "Average", Wrapper( WrapperNum ).Name );
+			SetupOutputVariable( "Chiller Heater System Source Mass Flow Rate [kg/s]", WrapperReport( GetWrapperInputWrapperNum ).GLHEmdot, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).Name );
 
-			SetupOutputVariable( "Chiller Heater System Cooling Inlet Temperature [C]", WrapperReport( WrapperNum ).CHWInletTemp, "System", "Average", Wrapper( WrapperNum ).Name );
+			SetupOutputVariable( "Chiller Heater System Cooling Inlet Temperature [C]", WrapperReport( GetWrapperInputWrapperNum ).CHWInletTemp, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).Name );
 
-			SetupOutputVariable( "Chiller Heater System Heating Inlet Temperature [C]", WrapperReport( WrapperNum ).HWInletTemp, "System", "Average", Wrapper( WrapperNum ).Name );
+			SetupOutputVariable( "Chiller Heater System Heating Inlet Temperature [C]", WrapperReport( GetWrapperInputWrapperNum ).HWInletTemp, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).Name );
 
-			SetupOutputVariable( "Chiller Heater System Source Inlet Temperature [C]", WrapperReport( WrapperNum ).GLHEInletTemp, "System", "Average", Wrapper( WrapperNum ).Name );
+			SetupOutputVariable( "Chiller Heater System Source Inlet Temperature [C]", WrapperReport( GetWrapperInputWrapperNum ).GLHEInletTemp, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).Name );
 
-			SetupOutputVariable( "Chiller Heater System Cooling Outlet Temperature [C]", WrapperReport( WrapperNum ).CHWOutletTemp, "System", "Average", Wrapper( WrapperNum ).Name );
+			SetupOutputVariable( "Chiller Heater System Cooling Outlet Temperature [C]", WrapperReport( GetWrapperInputWrapperNum ).CHWOutletTemp, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).Name );
 
-			SetupOutputVariable( "Chiller Heater System Heating Outlet Temperature [C]", WrapperReport( WrapperNum ).HWOutletTemp, "System", "Average", Wrapper( WrapperNum ).Name );
+			SetupOutputVariable( "Chiller Heater System Heating Outlet Temperature [C]", WrapperReport( GetWrapperInputWrapperNum ).HWOutletTemp, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).Name );
 
-			SetupOutputVariable( "Chiller Heater System Source Outlet Temperature [C]", WrapperReport( WrapperNum ).GLHEOutletTemp, "System", "Average", Wrapper( WrapperNum ).Name );
+			SetupOutputVariable( "Chiller Heater System Source Outlet Temperature [C]", WrapperReport( GetWrapperInputWrapperNum ).GLHEOutletTemp, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).Name );
 
-			if ( Wrapper( WrapperNum ).ChillerHeaterNums > 0 ) {
+			if ( Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterNums > 0 ) {
 
-				for ( ChillerHeaterNum = 1; ChillerHeaterNum <= Wrapper( WrapperNum ).ChillerHeaterNums; ++ChillerHeaterNum ) {
+				for ( ChillerHeaterNum = 1; ChillerHeaterNum <= Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterNums; ++ChillerHeaterNum ) {
 
-					SetupOutputVariable( "Chiller Heater Operation Mode Unit " + TrimSigDigits( ChillerHeaterNum ) + " []", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).CurrentMode, "System", "Average", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater Operation Mode Unit " + TrimSigDigits( ChillerHeaterNum ) + " []", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).CurrentMode, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater Part Load Ratio Unit " + TrimSigDigits( ChillerHeaterNum ) + " []", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).ChillerPartLoadRatio, "System", "Average", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater Part Load Ratio Unit " + TrimSigDigits( ChillerHeaterNum ) + " []", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).ChillerPartLoadRatio, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater Cycling Ratio Unit " + TrimSigDigits( ChillerHeaterNum ) + " []", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).ChillerCyclingRatio, "System", "Average", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater Cycling Ratio Unit " + TrimSigDigits( ChillerHeaterNum ) + " []", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).ChillerCyclingRatio, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater Cooling Electric Power Unit " + TrimSigDigits( ChillerHeaterNum ) + " [W]", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).CoolingPower, "System", "Average", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater Cooling Electric Power Unit " + TrimSigDigits( ChillerHeaterNum ) + " [W]", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).CoolingPower, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater Heating Electric Power Unit " + TrimSigDigits( ChillerHeaterNum ) + " [W]", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).HeatingPower, "System", "Average", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater Heating Electric Power Unit " + TrimSigDigits( ChillerHeaterNum ) + " [W]", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).HeatingPower, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater Cooling Electric Energy Unit " + TrimSigDigits( ChillerHeaterNum ) + " [J]", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).CoolingEnergy, "System", "Sum", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater Cooling Electric Energy Unit " + TrimSigDigits( ChillerHeaterNum ) + " [J]", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).CoolingEnergy, "System", "Sum", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater Heating Electric Energy Unit " + TrimSigDigits( ChillerHeaterNum ) + " [J]", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).HeatingEnergy, "System", "Sum", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater Heating Electric Energy Unit " + TrimSigDigits( ChillerHeaterNum ) + " [J]", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).HeatingEnergy, "System", "Sum", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater Cooling Rate Unit " + TrimSigDigits( ChillerHeaterNum ) + " [W]", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).QEvap, "System", "Average", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater Cooling Rate Unit " + TrimSigDigits( ChillerHeaterNum ) + " [W]", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).QEvap, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater Cooling Energy Unit " + TrimSigDigits( ChillerHeaterNum ) + " [J]", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).EvapEnergy, "System", "Sum", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater Cooling Energy Unit " + TrimSigDigits( ChillerHeaterNum ) + " [J]", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).EvapEnergy, "System", "Sum", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater False Load Heat Transfer Rate Unit " + TrimSigDigits( ChillerHeaterNum ) + " [W]", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).ChillerFalseLoadRate, "System", "Average", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater False Load Heat Transfer Rate Unit " + TrimSigDigits( ChillerHeaterNum ) + " [W]", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).ChillerFalseLoadRate, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater False Load Heat Transfer Energy Unit " + TrimSigDigits( ChillerHeaterNum ) + " [J]", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).ChillerFalseLoad, "System", "Sum", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater False Load Heat Transfer Energy Unit " + TrimSigDigits( ChillerHeaterNum ) + " [J]", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).ChillerFalseLoad, "System", "Sum", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater Evaporator Inlet Temperature Unit " + TrimSigDigits( ChillerHeaterNum ) + " [C]", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).EvapInletTemp, "System", "Average", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater Evaporator Inlet Temperature Unit " + TrimSigDigits( ChillerHeaterNum ) + " [C]", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).EvapInletTemp, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater Evaporator Outlet Temperature Unit " + TrimSigDigits( ChillerHeaterNum ) + " [C]", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).EvapOutletTemp, "System", "Average", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater Evaporator Outlet Temperature Unit " + TrimSigDigits( ChillerHeaterNum ) + " [C]", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).EvapOutletTemp, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater Evaporator Mass Flow Rate Unit " + TrimSigDigits( ChillerHeaterNum ) + " [kg/s]", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).Evapmdot, "System", "Average", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater Evaporator Mass Flow Rate Unit " + TrimSigDigits( ChillerHeaterNum ) + " [kg/s]", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).Evapmdot, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater Condenser Heat Transfer Rate Unit " + TrimSigDigits( ChillerHeaterNum ) + " [W]", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).QCond, "System", "Average", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater Condenser Heat Transfer Rate Unit " + TrimSigDigits( ChillerHeaterNum ) + " [W]", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).QCond, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater Condenser Heat Transfer Energy Unit " + TrimSigDigits( ChillerHeaterNum ) + " [J]", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).CondEnergy, "System", "Sum", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater Condenser Heat Transfer Energy Unit " + TrimSigDigits( ChillerHeaterNum ) + " [J]", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).CondEnergy, "System", "Sum", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater COP Unit " + TrimSigDigits( ChillerHeaterNum ) + " [W/W]", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).ActualCOP, "System", "Average", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater COP Unit " + TrimSigDigits( ChillerHeaterNum ) + " [W/W]", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).ActualCOP, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater Capacity Temperature Modifier Multiplier Unit " + TrimSigDigits( ChillerHeaterNum ) + " []", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).ChillerCapFT, "System", "Average", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater Capacity Temperature Modifier Multiplier Unit " + TrimSigDigits( ChillerHeaterNum ) + " []", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).ChillerCapFT, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater EIR Temperature Modifier Multiplier Unit " + TrimSigDigits( ChillerHeaterNum ) + " []", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).ChillerEIRFT, "System", "Average", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater EIR Temperature Modifier Multiplier Unit " + TrimSigDigits( ChillerHeaterNum ) + " []", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).ChillerEIRFT, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater EIR Part Load Modifier Multiplier Unit " + TrimSigDigits( ChillerHeaterNum ) + " []", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).ChillerEIRFPLR, "System", "Average", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater EIR Part Load Modifier Multiplier Unit " + TrimSigDigits( ChillerHeaterNum ) + " []", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).ChillerEIRFPLR, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater Condenser Inlet Temperature Unit " + TrimSigDigits( ChillerHeaterNum ) + " [C]", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).CondInletTemp, "System", "Average", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater Condenser Inlet Temperature Unit " + TrimSigDigits( ChillerHeaterNum ) + " [C]", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).CondInletTemp, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater Condenser Outlet Temperature Unit " + TrimSigDigits( ChillerHeaterNum ) + " [C]", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).CondOutletTemp, "System", "Average", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater Condenser Outlet Temperature Unit " + TrimSigDigits( ChillerHeaterNum ) + " [C]", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).CondOutletTemp, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 
-					SetupOutputVariable( "Chiller Heater Condenser Mass Flow Rate Unit " + TrimSigDigits( ChillerHeaterNum ) + " [kg/s]", Wrapper( WrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).Condmdot, "System", "Average", Wrapper( WrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
+					SetupOutputVariable( "Chiller Heater Condenser Mass Flow Rate Unit " + TrimSigDigits( ChillerHeaterNum ) + " [kg/s]", Wrapper( GetWrapperInputWrapperNum ).ChillerHeaterReport( ChillerHeaterNum ).Condmdot, "System", "Average", Wrapper( GetWrapperInputWrapperNum ).ChillerHeater( ChillerHeaterNum ).Name );
 				} // End of individual chiller heater count for current wrapper
 
 			} // End of individual chiller heater output
@@ -934,12 +1000,9 @@ namespace PlantCentralGSHP {
 
 		// LOCAL VARIABLES
 		std::string StringVar; // Used for EIRFPLR warning messages
-		static bool CHErrorsFound( false ); // True when input errors are found
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
-		static bool FoundNegValue( false ); // Used to evaluate PLFFPLR curve objects
 		int CurveValPtr; // Index to EIRFPLR curve output
-		static int CurveCheck( 0 ); // Used to evaluate PLFFPLR curve objects
 		int ChillerHeaterNum; // Chiller counter
 		int NumAlphas; // Number of elements in the alpha array
 		int NumNums; // Number of elements in the numeric array
@@ -1285,9 +1348,6 @@ namespace PlantCentralGSHP {
 		static std::string const RoutineName( "InitCGSHPHeatPump" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyWrapperOneTimeFlag( true ); // Flag used to execute code only once
-		static Array1D_bool MyWrapperFlag; // TRUE in order to set component location
-		static Array1D_bool MyWrapperEnvrnFlag; // TRUE when new environment is started
 		int ChillerHeaterNum; // Chiller Heater index
 		bool errFlag; // Err flag
 		bool FatalError; // Fatal error indicator
@@ -1560,8 +1620,6 @@ namespace PlantCentralGSHP {
 		static std::string const RoutineNameElecEIRChiller( "CalcElectricEIRChillerModel" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool IsLoadCoolRemaining( true );
-		static bool NextCompIndicator( false ); // Component indicator when identical chiller heaters exist
 		int LoopSideNum; // Plant loop side which contains the current chiller (usually supply side)
 		int CompNum( 0 ); // Component number in the loop  REAL(r64) :: FRAC
 		int ChillerHeaterNum; // Chiller heater number
@@ -2021,8 +2079,6 @@ namespace PlantCentralGSHP {
 		static std::string const RoutineNameElecEIRChiller( "CalcElectricEIRChillerModel" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool IsLoadHeatRemaining( true ); // Ture if heating load remains for this chiller heater
-		static bool NextCompIndicator( false ); // Component indicator when identical chiller heaters exist
 		int LoopSideNum; // Plant loop side which contains the current chiller (usually supply side)
 		int CompNum( 0 ); // Component number
 		int ChillerHeaterNum; // Chiller heater number
@@ -2101,23 +2157,23 @@ namespace PlantCentralGSHP {
 				if ( ChillerHeaterNum == 1 ) {
 					IdenticalUnitCounter = 0;
 					IdenticalUnitRemaining = 0;
-					NextCompIndicator = false;
+					CalcChillerHeaterModelNextCompIndicator = false;
 					CompNum = ChillerHeaterNum;
 				}
-				if ( NextCompIndicator ) {
+				if ( CalcChillerHeaterModelNextCompIndicator ) {
 					++CompNum;
 				}
 				if ( CompNum == 1 ) {
 					if ( ChillerHeaterNum != Wrapper( WrapperNum ).WrapperComp( CompNum ).WrapperIdenticalObjectNum ) {
-						NextCompIndicator = false;
+						CalcChillerHeaterModelNextCompIndicator = false;
 					} else if ( ChillerHeaterNum == Wrapper( WrapperNum ).WrapperComp( CompNum ).WrapperIdenticalObjectNum ) {
-						NextCompIndicator = true;
+						CalcChillerHeaterModelNextCompIndicator = true;
 					}
 				} else if ( CompNum > 1 ) {
 					if ( ( ChillerHeaterNum - ( ( ChillerHeaterNum - 1 ) - IdenticalUnitCounter ) ) != Wrapper( WrapperNum ).WrapperComp( CompNum ).WrapperIdenticalObjectNum ) {
-						NextCompIndicator = false;
+						CalcChillerHeaterModelNextCompIndicator = false;
 					} else if ( ( ChillerHeaterNum - ( ( ChillerHeaterNum - 1 ) - IdenticalUnitCounter ) ) == Wrapper( WrapperNum ).WrapperComp( CompNum ).WrapperIdenticalObjectNum ) {
-						NextCompIndicator = true;
+						CalcChillerHeaterModelNextCompIndicator = true;
 					}
 				}
 				++IdenticalUnitCounter;
@@ -602,6 +602,11 @@ namespace PlantCentralGSHP {
 
 	// Functions
 
+	// Clears the global data in PlantCentralGSHP.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimCentralGroundSourceHeatPump(
 		std::string const & WrapperName, // User specified name of wrapper
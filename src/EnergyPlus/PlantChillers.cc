@@ -223,6 +223,43 @@ namespace PlantChillers {
 	// Beginning of Electric Chiller Module Driver Subroutines
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false );
+		bool GetEngineDrivenChillerInputErrorsFound( false );
+		bool GetGTChillerInputErrorsFound( false );
+		bool GetConstCOPChillerInputErrorsFound( false );
+		bool MyOneTimeFlag( true );
+		Array1D_bool MyFlag;
+		Array1D_bool MyEnvrnFlag;
+		bool InitEngineDrivenChillerMyOneTimeFlag( true );
+		Array1D_bool InitEngineDrivenChillerMyEnvrnFlag;
+		Array1D_bool InitEngineDrivenChillerMyFlag;
+		bool InitGTChillerMyOneTimeFlag( true );
+		Array1D_bool InitGTChillerMyEnvrnFlag;
+		Array1D_bool InitGTChillerMyFlag;
+		bool OneTimeFlag( true );
+		Array1D_bool InitConstCOPChillerMyFlag;
+		Array1D_bool MyEnvironFlag;
+		Real64 TimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
+		Real64 CurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
+		std::string OutputChar; // character string for warning messages
+		Real64 CalcEngineDrivenChillerModelTimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
+		Real64 CalcEngineDrivenChillerModelCurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
+		std::string CalcEngineDrivenChillerModelOutputChar; // character string for warning messages
+		Real64 EvapMassFlowRateMax( 0.0 ); // Max Design Evaporator Mass Flow Rate converted from Volume Flow Rate
+		Real64 CalcGTChillerModelTimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
+		Real64 CalcGTChillerModelCurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
+		std::string CalcGTChillerModelOutputChar; // character string for warning messages
+		Real64 CalcConstCOPChillerModelTimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
+		Real64 CalcConstCOPChillerModelCurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
+		std::string CalcConstCOPChillerModelOutputChar; // character string for warning messages
+	}
+
 	// Functions
 
 	void
@@ -277,6 +314,35 @@ namespace PlantChillers {
 		GTChillerReport.deallocate();
 		ConstCOPChiller.deallocate();
 		ConstCOPChillerReport.deallocate();
+		ErrorsFound = false;
+		GetEngineDrivenChillerInputErrorsFound = false;
+		GetGTChillerInputErrorsFound = false;
+		GetConstCOPChillerInputErrorsFound = false;
+		MyOneTimeFlag = true;
+		MyFlag.deallocate();
+		MyEnvrnFlag.deallocate();
+		InitEngineDrivenChillerMyOneTimeFlag = true;
+		InitEngineDrivenChillerMyEnvrnFlag.deallocate();
+		InitEngineDrivenChillerMyFlag.deallocate();
+		InitGTChillerMyOneTimeFlag = true;
+		InitGTChillerMyEnvrnFlag.deallocate();
+		InitGTChillerMyFlag.deallocate();
+		OneTimeFlag = true;
+		InitConstCOPChillerMyFlag.deallocate();
+		MyEnvironFlag.deallocate();
+		TimeStepSysLast = 0.0;
+		CurrentEndTimeLast = 0.0;
+		OutputChar.clear();
+		CalcEngineDrivenChillerModelTimeStepSysLast = 0.0;
+		CalcEngineDrivenChillerModelCurrentEndTimeLast = 0.0;
+		CalcEngineDrivenChillerModelOutputChar.clear();
+		EvapMassFlowRateMax = 0.0;
+		CalcGTChillerModelTimeStepSysLast = 0.0;
+		CalcGTChillerModelCurrentEndTimeLast = 0.0;
+		CalcGTChillerModelOutputChar.clear();
+		CalcConstCOPChillerModelTimeStepSysLast = 0.0;
+		CalcConstCOPChillerModelCurrentEndTimeLast = 0.0;
+		CalcConstCOPChillerModelOutputChar.clear();
 	}
 
 	void
@@ -624,7 +690,6 @@ namespace PlantChillers {
 		int IOStat; // IO Status when calling get input subroutine
 		//  CHARACTER(len=MaxNameLength),DIMENSION(9)   :: AlphArray !character string data
 		//  REAL(r64),                        DIMENSION(22)  :: NumArray  !numeric data
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool errFlag;
@@ -1008,7 +1073,6 @@ namespace PlantChillers {
 		int NumAlphas; // Number of elements in the alpha array
 		int NumNums; // Number of elements in the numeric array
 		int IOStat; // IO Status when calling get input subroutine
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool errFlag;
@@ -1020,7 +1084,7 @@ namespace PlantChillers {
 
 		if ( NumEngineDrivenChillers <= 0 ) {
 			ShowSevereError( "No " + cCurrentModuleObject + " equipment specified in input file" );
-			ErrorsFound = true;
+			GetEngineDrivenChillerInputErrorsFound = true;
 		}
 		//See if load distribution manager has already gotten the input
 		if ( allocated( EngineDrivenChiller ) ) return;
@@ -1037,12 +1101,12 @@ namespace PlantChillers {
 			IsBlank = false;
 			VerifyName( cAlphaArgs( 1 ), EngineDrivenChiller.ma( &EngineDrivenChillerSpecs::Base ), ChillerNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetEngineDrivenChillerInputErrorsFound = true;
 				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 			}
 			VerifyUniqueChillerName( cCurrentModuleObject, cAlphaArgs( 1 ), errFlag, cCurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetEngineDrivenChillerInputErrorsFound = true;
 			}
 			EngineDrivenChiller( ChillerNum ).Base.Name = cAlphaArgs( 1 );
 
@@ -1053,14 +1117,14 @@ namespace PlantChillers {
 			if ( rNumericArgs( 1 ) == 0.0 ) {
 				ShowSevereError( "Invalid " + cNumericFieldNames( 1 ) + '=' + RoundSigDigits( rNumericArgs( 1 ), 2 ) );
 				ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-				ErrorsFound = true;
+				GetEngineDrivenChillerInputErrorsFound = true;
 			}
 
 			EngineDrivenChiller( ChillerNum ).Base.COP = rNumericArgs( 2 );
 			if ( rNumericArgs( 2 ) == 0.0 ) {
 				ShowSevereError( "Invalid " + cNumericFieldNames( 2 ) + '=' + RoundSigDigits( rNumericArgs( 2 ), 2 ) );
 				ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-				ErrorsFound = true;
+				GetEngineDrivenChillerInputErrorsFound = true;
 			}
 
 			if ( cAlphaArgs( 2 ) == "AIRCOOLED" ) {
@@ -1072,11 +1136,11 @@ namespace PlantChillers {
 			} else {
 				ShowSevereError( "Invalid " + cAlphaFieldNames( 2 ) + '=' + cAlphaArgs( 2 ) );
 				ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-				ErrorsFound = true;
+				GetEngineDrivenChillerInputErrorsFound = true;
 			}
 
-			EngineDrivenChiller( ChillerNum ).Base.EvapInletNodeNum = GetOnlySingleNode( cAlphaArgs( 3 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			EngineDrivenChiller( ChillerNum ).Base.EvapOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			EngineDrivenChiller( ChillerNum ).Base.EvapInletNodeNum = GetOnlySingleNode( cAlphaArgs( 3 ), GetEngineDrivenChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			EngineDrivenChiller( ChillerNum ).Base.EvapOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), GetEngineDrivenChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 			TestCompSet( cCurrentModuleObject, cAlphaArgs( 1 ), cAlphaArgs( 3 ), cAlphaArgs( 4 ), "Chilled Water Nodes" );
 
 			if ( EngineDrivenChiller( ChillerNum ).Base.CondenserType == AirCooled || EngineDrivenChiller( ChillerNum ).Base.CondenserType == EvapCooled ) {
@@ -1098,41 +1162,41 @@ namespace PlantChillers {
 					}
 				}
 
-				EngineDrivenChiller( ChillerNum ).Base.CondInletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_OutsideAirReference, 2, ObjectIsNotParent );
+				EngineDrivenChiller( ChillerNum ).Base.CondInletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), GetEngineDrivenChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_OutsideAirReference, 2, ObjectIsNotParent );
 				CheckAndAddAirNodeNumber( EngineDrivenChiller( ChillerNum ).Base.CondInletNodeNum, Okay );
 				if ( ! Okay ) {
 					ShowWarningError( cCurrentModuleObject + ", Adding OutdoorAir:Node=" + cAlphaArgs( 5 ) );
 				}
 
-				EngineDrivenChiller( ChillerNum ).Base.CondOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 6 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+				EngineDrivenChiller( ChillerNum ).Base.CondOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 6 ), GetEngineDrivenChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
 				//CALL TestCompSet(TRIM(cCurrentModuleObject),cAlphaArgs(1),cAlphaArgs(5),cAlphaArgs(6),'Condenser (Air) Nodes')
 			} else if ( EngineDrivenChiller( ChillerNum ).Base.CondenserType == WaterCooled ) {
-				EngineDrivenChiller( ChillerNum ).Base.CondInletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
-				EngineDrivenChiller( ChillerNum ).Base.CondOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 6 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+				EngineDrivenChiller( ChillerNum ).Base.CondInletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), GetEngineDrivenChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+				EngineDrivenChiller( ChillerNum ).Base.CondOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 6 ), GetEngineDrivenChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
 				TestCompSet( cCurrentModuleObject, cAlphaArgs( 1 ), cAlphaArgs( 5 ), cAlphaArgs( 6 ), "Condenser Water Nodes" );
 				//Condenser Inlet node name is necessary for Water Cooled
 				if ( lAlphaFieldBlanks( 5 ) ) {
 					ShowSevereError( "Invalid, " + cAlphaFieldNames( 5 ) + " is blank " );
 					ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetEngineDrivenChillerInputErrorsFound = true;
 				} else if ( lAlphaFieldBlanks( 6 ) ) {
 					ShowSevereError( "Invalid, " + cAlphaFieldNames( 6 ) + " is blank " );
 					ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetEngineDrivenChillerInputErrorsFound = true;
 				}
 			} else {
-				EngineDrivenChiller( ChillerNum ).Base.CondInletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
-				EngineDrivenChiller( ChillerNum ).Base.CondOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 6 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+				EngineDrivenChiller( ChillerNum ).Base.CondInletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), GetEngineDrivenChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+				EngineDrivenChiller( ChillerNum ).Base.CondOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 6 ), GetEngineDrivenChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
 				TestCompSet( cCurrentModuleObject, cAlphaArgs( 1 ), cAlphaArgs( 5 ), cAlphaArgs( 6 ), "Condenser (unknown?) Nodes" );
 				//Condenser Inlet node name is necessary for Water Cooled
 				if ( lAlphaFieldBlanks( 5 ) ) {
 					ShowSevereError( "Invalid, " + cAlphaFieldNames( 5 ) + " is blank " );
 					ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetEngineDrivenChillerInputErrorsFound = true;
 				} else if ( lAlphaFieldBlanks( 6 ) ) {
 					ShowSevereError( "Invalid, " + cAlphaFieldNames( 6 ) + " is blank " );
 					ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetEngineDrivenChillerInputErrorsFound = true;
 				}
 			}
 
@@ -1155,7 +1219,7 @@ namespace PlantChillers {
 			EngineDrivenChiller( ChillerNum ).CapRatCoef( 3 ) = rNumericArgs( 13 );
 			if ( ( rNumericArgs( 11 ) + rNumericArgs( 12 ) + rNumericArgs( 13 ) ) == 0.0 ) {
 				ShowSevereError( cCurrentModuleObject + ": Sum of Capacity Ratio Coef = 0.0, chiller=" + cAlphaArgs( 1 ) );
-				ErrorsFound = true;
+				GetEngineDrivenChillerInputErrorsFound = true;
 			}
 			EngineDrivenChiller( ChillerNum ).PowerRatCoef( 1 ) = rNumericArgs( 14 );
 			EngineDrivenChiller( ChillerNum ).PowerRatCoef( 2 ) = rNumericArgs( 15 );
@@ -1170,35 +1234,35 @@ namespace PlantChillers {
 			if ( EngineDrivenChiller( ChillerNum ).ClngLoadtoFuelCurve == 0 ) {
 				ShowSevereError( "Invalid " + cAlphaFieldNames( 7 ) + '=' + cAlphaArgs( 7 ) );
 				ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-				ErrorsFound = true;
+				GetEngineDrivenChillerInputErrorsFound = true;
 			}
 
 			EngineDrivenChiller( ChillerNum ).RecJacHeattoFuelCurve = GetCurveIndex( cAlphaArgs( 8 ) ); // convert curve name to number
 			if ( EngineDrivenChiller( ChillerNum ).RecJacHeattoFuelCurve == 0 ) {
 				ShowSevereError( "Invalid " + cAlphaFieldNames( 8 ) + '=' + cAlphaArgs( 8 ) );
 				ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-				ErrorsFound = true;
+				GetEngineDrivenChillerInputErrorsFound = true;
 			}
 
 			EngineDrivenChiller( ChillerNum ).RecLubeHeattoFuelCurve = GetCurveIndex( cAlphaArgs( 9 ) ); // convert curve name to number
 			if ( EngineDrivenChiller( ChillerNum ).RecLubeHeattoFuelCurve == 0 ) {
 				ShowSevereError( "Invalid " + cAlphaFieldNames( 9 ) + '=' + cAlphaArgs( 9 ) );
 				ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-				ErrorsFound = true;
+				GetEngineDrivenChillerInputErrorsFound = true;
 			}
 
 			EngineDrivenChiller( ChillerNum ).TotExhausttoFuelCurve = GetCurveIndex( cAlphaArgs( 10 ) ); // convert curve name to number
 			if ( EngineDrivenChiller( ChillerNum ).TotExhausttoFuelCurve == 0 ) {
 				ShowSevereError( "Invalid " + cAlphaFieldNames( 10 ) + '=' + cAlphaArgs( 10 ) );
 				ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-				ErrorsFound = true;
+				GetEngineDrivenChillerInputErrorsFound = true;
 			}
 
 			EngineDrivenChiller( ChillerNum ).ExhaustTempCurve = GetCurveIndex( cAlphaArgs( 11 ) ); // convert curve name to number
 			if ( EngineDrivenChiller( ChillerNum ).ExhaustTempCurve == 0 ) {
 				ShowSevereError( "Invalid " + cAlphaFieldNames( 11 ) + '=' + cAlphaArgs( 11 ) );
 				ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-				ErrorsFound = true;
+				GetEngineDrivenChillerInputErrorsFound = true;
 			}
 
 			EngineDrivenChiller( ChillerNum ).UACoef( 1 ) = rNumericArgs( 21 );
@@ -1239,24 +1303,24 @@ namespace PlantChillers {
 				ShowSevereError( "Invalid " + cAlphaFieldNames( 12 ) + '=' + cAlphaArgs( 12 ) );
 				ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
 				ShowContinueError( "Valid choices are Electricity, NaturalGas, PropaneGas, Diesel, Gasoline, FuelOil#1, FuelOil#2,OtherFuel1 or OtherFuel2" );
-				ErrorsFound = true;
+				GetEngineDrivenChillerInputErrorsFound = true;
 			}}
 
 			EngineDrivenChiller( ChillerNum ).FuelHeatingValue = rNumericArgs( 25 );
 			EngineDrivenChiller( ChillerNum ).DesignHeatRecVolFlowRate = rNumericArgs( 26 );
 			if ( EngineDrivenChiller( ChillerNum ).DesignHeatRecVolFlowRate > 0.0 ) {
 				EngineDrivenChiller( ChillerNum ).HeatRecActive = true;
-				EngineDrivenChiller( ChillerNum ).HeatRecInletNodeNum = GetOnlySingleNode( cAlphaArgs( 13 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 3, ObjectIsNotParent );
+				EngineDrivenChiller( ChillerNum ).HeatRecInletNodeNum = GetOnlySingleNode( cAlphaArgs( 13 ), GetEngineDrivenChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 3, ObjectIsNotParent );
 				if ( EngineDrivenChiller( ChillerNum ).HeatRecInletNodeNum == 0 ) {
 					ShowSevereError( "Invalid " + cAlphaFieldNames( 13 ) + '=' + cAlphaArgs( 13 ) );
 					ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetEngineDrivenChillerInputErrorsFound = true;
 				}
-				EngineDrivenChiller( ChillerNum ).HeatRecOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 14 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 3, ObjectIsNotParent );
+				EngineDrivenChiller( ChillerNum ).HeatRecOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 14 ), GetEngineDrivenChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 3, ObjectIsNotParent );
 				if ( EngineDrivenChiller( ChillerNum ).HeatRecOutletNodeNum == 0 ) {
 					ShowSevereError( "Invalid " + cAlphaFieldNames( 14 ) + '=' + cAlphaArgs( 14 ) );
 					ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetEngineDrivenChillerInputErrorsFound = true;
 				}
 				TestCompSet( cCurrentModuleObject, cAlphaArgs( 1 ), cAlphaArgs( 13 ), cAlphaArgs( 14 ), "Heat Recovery Nodes" );
 				RegisterPlantCompDesignFlow( EngineDrivenChiller( ChillerNum ).HeatRecInletNodeNum, EngineDrivenChiller( ChillerNum ).DesignHeatRecVolFlowRate );
@@ -1266,7 +1330,7 @@ namespace PlantChillers {
 						ShowSevereError( "Invalid " + cNumericFieldNames( 10 ) + '=' + RoundSigDigits( rNumericArgs( 10 ), 6 ) );
 						ShowSevereError( "Condenser fluid flow rate must be specified for Heat Reclaim applications." );
 						ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-						ErrorsFound = true;
+						GetEngineDrivenChillerInputErrorsFound = true;
 					}
 				}
 
@@ -1314,7 +1378,7 @@ namespace PlantChillers {
 			EngineDrivenChiller( ChillerNum ).Base.BasinHeaterPowerFTempDiff = rNumericArgs( 29 );
 			if ( rNumericArgs( 29 ) < 0.0 ) {
 				ShowSevereError( cCurrentModuleObject + ", \"" + EngineDrivenChiller( ChillerNum ).Base.Name + "\" TRIM(cNumericFieldNames(29)) must be >= 0" );
-				ErrorsFound = true;
+				GetEngineDrivenChillerInputErrorsFound = true;
 			}
 
 			EngineDrivenChiller( ChillerNum ).Base.BasinHeaterSetPointTemp = rNumericArgs( 30 );
@@ -1337,7 +1401,7 @@ namespace PlantChillers {
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetEngineDrivenChillerInputErrorsFound ) {
 			ShowFatalError( "Errors found in processing input for " + cCurrentModuleObject );
 		}
 
@@ -1444,7 +1508,6 @@ namespace PlantChillers {
 		int NumAlphas; // Number of elements in the alpha array
 		int NumNums; // Number of elements in the numeric array
 		int IOStat; // IO Status when calling get input subroutine
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool errFlag;
@@ -1456,7 +1519,7 @@ namespace PlantChillers {
 
 		if ( NumGTChillers <= 0 ) {
 			ShowSevereError( "No " + cCurrentModuleObject + " equipment specified in input file" );
-			ErrorsFound = true;
+			GetGTChillerInputErrorsFound = true;
 		}
 		//See if load distribution manager has already gotten the input
 		if ( allocated( GTChiller ) ) return;
@@ -1472,12 +1535,12 @@ namespace PlantChillers {
 			IsBlank = false;
 			VerifyName( cAlphaArgs( 1 ), GTChiller.ma( &GTChillerSpecs::Base ), ChillerNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetGTChillerInputErrorsFound = true;
 				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 			}
 			VerifyUniqueChillerName( cCurrentModuleObject, cAlphaArgs( 1 ), errFlag, cCurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetGTChillerInputErrorsFound = true;
 			}
 			GTChiller( ChillerNum ).Base.Name = cAlphaArgs( 1 );
 
@@ -1485,14 +1548,14 @@ namespace PlantChillers {
 			if ( rNumericArgs( 1 ) == 0.0 ) {
 				ShowSevereError( "Invalid " + cNumericFieldNames( 1 ) + '=' + RoundSigDigits( rNumericArgs( 1 ), 2 ) );
 				ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-				ErrorsFound = true;
+				GetGTChillerInputErrorsFound = true;
 			}
 
 			GTChiller( ChillerNum ).Base.COP = rNumericArgs( 2 );
 			if ( rNumericArgs( 2 ) == 0.0 ) {
 				ShowSevereError( "Invalid " + cNumericFieldNames( 2 ) + '=' + RoundSigDigits( rNumericArgs( 2 ), 2 ) );
 				ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-				ErrorsFound = true;
+				GetGTChillerInputErrorsFound = true;
 			}
 
 			if ( cAlphaArgs( 2 ) == "AIRCOOLED" ) {
@@ -1504,11 +1567,11 @@ namespace PlantChillers {
 			} else {
 				ShowSevereError( "Invalid " + cAlphaFieldNames( 2 ) + '=' + cAlphaArgs( 2 ) );
 				ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-				ErrorsFound = true;
+				GetGTChillerInputErrorsFound = true;
 			}
 
-			GTChiller( ChillerNum ).Base.EvapInletNodeNum = GetOnlySingleNode( cAlphaArgs( 3 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			GTChiller( ChillerNum ).Base.EvapOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			GTChiller( ChillerNum ).Base.EvapInletNodeNum = GetOnlySingleNode( cAlphaArgs( 3 ), GetGTChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			GTChiller( ChillerNum ).Base.EvapOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), GetGTChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 			TestCompSet( cCurrentModuleObject, cAlphaArgs( 1 ), cAlphaArgs( 3 ), cAlphaArgs( 4 ), "Chilled Water Nodes" );
 
 			if ( GTChiller( ChillerNum ).Base.CondenserType == AirCooled || GTChiller( ChillerNum ).Base.CondenserType == EvapCooled ) {
@@ -1530,26 +1593,26 @@ namespace PlantChillers {
 					}
 				}
 
-				GTChiller( ChillerNum ).Base.CondInletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_OutsideAirReference, 2, ObjectIsNotParent );
+				GTChiller( ChillerNum ).Base.CondInletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), GetGTChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_OutsideAirReference, 2, ObjectIsNotParent );
 				CheckAndAddAirNodeNumber( GTChiller( ChillerNum ).Base.CondInletNodeNum, Okay );
 				if ( ! Okay ) {
 					ShowWarningError( cCurrentModuleObject + ", Adding OutdoorAir:Node=" + cAlphaArgs( 5 ) );
 				}
 
-				GTChiller( ChillerNum ).Base.CondOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 6 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+				GTChiller( ChillerNum ).Base.CondOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 6 ), GetGTChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
 			} else { // WaterCooled CondenserType
-				GTChiller( ChillerNum ).Base.CondInletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
-				GTChiller( ChillerNum ).Base.CondOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 6 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+				GTChiller( ChillerNum ).Base.CondInletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), GetGTChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+				GTChiller( ChillerNum ).Base.CondOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 6 ), GetGTChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
 				TestCompSet( cCurrentModuleObject, cAlphaArgs( 1 ), cAlphaArgs( 5 ), cAlphaArgs( 6 ), "Condenser (unknown?) Nodes" );
 				//Condenser Inlet node name is necessary for Water Cooled
 				if ( lAlphaFieldBlanks( 5 ) ) {
 					ShowSevereError( "Invalid, " + cAlphaFieldNames( 5 ) + " is blank " );
 					ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetGTChillerInputErrorsFound = true;
 				} else if ( lAlphaFieldBlanks( 6 ) ) {
 					ShowSevereError( "Invalid, " + cAlphaFieldNames( 6 ) + " is blank " );
 					ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetGTChillerInputErrorsFound = true;
 				}
 			}
 
@@ -1566,7 +1629,7 @@ namespace PlantChillers {
 			GTChiller( ChillerNum ).CapRatCoef( 3 ) = rNumericArgs( 13 );
 			if ( ( rNumericArgs( 11 ) + rNumericArgs( 12 ) + rNumericArgs( 13 ) ) == 0.0 ) {
 				ShowSevereError( cCurrentModuleObject + ": Sum of Capacity Ratio Coef = 0.0, chiller=" + cAlphaArgs( 1 ) );
-				ErrorsFound = true;
+				GetGTChillerInputErrorsFound = true;
 			}
 			GTChiller( ChillerNum ).PowerRatCoef( 1 ) = rNumericArgs( 14 );
 			GTChiller( ChillerNum ).PowerRatCoef( 2 ) = rNumericArgs( 15 );
@@ -1617,17 +1680,17 @@ namespace PlantChillers {
 			GTChiller( ChillerNum ).DesignHeatRecVolFlowRate = rNumericArgs( 45 );
 			if ( GTChiller( ChillerNum ).DesignHeatRecVolFlowRate > 0.0 ) {
 				GTChiller( ChillerNum ).HeatRecActive = true;
-				GTChiller( ChillerNum ).HeatRecInletNodeNum = GetOnlySingleNode( cAlphaArgs( 7 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 3, ObjectIsNotParent );
+				GTChiller( ChillerNum ).HeatRecInletNodeNum = GetOnlySingleNode( cAlphaArgs( 7 ), GetGTChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 3, ObjectIsNotParent );
 				if ( GTChiller( ChillerNum ).HeatRecInletNodeNum == 0 ) {
 					ShowSevereError( "Invalid " + cAlphaFieldNames( 7 ) + '=' + cAlphaArgs( 7 ) );
 					ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetGTChillerInputErrorsFound = true;
 				}
-				GTChiller( ChillerNum ).HeatRecOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 8 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 3, ObjectIsNotParent );
+				GTChiller( ChillerNum ).HeatRecOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 8 ), GetGTChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 3, ObjectIsNotParent );
 				if ( GTChiller( ChillerNum ).HeatRecOutletNodeNum == 0 ) {
 					ShowSevereError( "Invalid " + cAlphaFieldNames( 8 ) + '=' + cAlphaArgs( 8 ) );
 					ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetGTChillerInputErrorsFound = true;
 				}
 				TestCompSet( cCurrentModuleObject, cAlphaArgs( 1 ), cAlphaArgs( 7 ), cAlphaArgs( 8 ), "Heat Recovery Nodes" );
 
@@ -1638,7 +1701,7 @@ namespace PlantChillers {
 						ShowSevereError( "Invalid " + cNumericFieldNames( 10 ) + '=' + RoundSigDigits( rNumericArgs( 10 ), 6 ) );
 						ShowSevereError( "Condenser fluid flow rate must be specified for Heat Reclaim applications." );
 						ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-						ErrorsFound = true;
+						GetGTChillerInputErrorsFound = true;
 					}
 
 				}
@@ -1707,7 +1770,7 @@ namespace PlantChillers {
 				ShowSevereError( "Invalid " + cAlphaFieldNames( 10 ) + '=' + cAlphaArgs( 10 ) );
 				ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
 				ShowContinueError( "Valid choices are Electricity, NaturalGas, PropaneGas, Diesel, Gasoline, FuelOil#1, FuelOil#2,OtherFuel1 or OtherFuel2" );
-				ErrorsFound = true;
+				GetGTChillerInputErrorsFound = true;
 			}}
 
 			GTChiller( ChillerNum ).HeatRecMaxTemp = rNumericArgs( 46 );
@@ -1718,7 +1781,7 @@ namespace PlantChillers {
 			GTChiller( ChillerNum ).Base.BasinHeaterPowerFTempDiff = rNumericArgs( 48 );
 			if ( rNumericArgs( 48 ) < 0.0 ) {
 				ShowSevereError( cCurrentModuleObject + "=\"" + GTChiller( ChillerNum ).Base.Name + "\"" + cNumericFieldNames( 48 ) + " must be >= 0" );
-				ErrorsFound = true;
+				GetGTChillerInputErrorsFound = true;
 			}
 
 			GTChiller( ChillerNum ).Base.BasinHeaterSetPointTemp = rNumericArgs( 49 );
@@ -1741,7 +1804,7 @@ namespace PlantChillers {
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetGTChillerInputErrorsFound ) {
 			ShowFatalError( "Errors found in processing input for " + cCurrentModuleObject );
 		}
 
@@ -1848,7 +1911,6 @@ namespace PlantChillers {
 		int NumAlphas; // Number of elements in the alpha array
 		int NumNums; // Number of elements in the numeric array
 		int IOStat; // IO Status when calling get input subroutine
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool errFlag;
@@ -1860,7 +1922,7 @@ namespace PlantChillers {
 
 		if ( NumConstCOPChillers <= 0 ) {
 			ShowSevereError( "No " + cCurrentModuleObject + " equipment specified in input file" );
-			ErrorsFound = true;
+			GetConstCOPChillerInputErrorsFound = true;
 		}
 
 		//See if load distribution manager has already gotten the input
@@ -1877,25 +1939,25 @@ namespace PlantChillers {
 			IsBlank = false;
 			VerifyName( cAlphaArgs( 1 ), ConstCOPChiller.ma( &ConstCOPChillerSpecs::Base ), ChillerNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetConstCOPChillerInputErrorsFound = true;
 				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 			}
 			VerifyUniqueChillerName( cCurrentModuleObject, cAlphaArgs( 1 ), errFlag, cCurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetConstCOPChillerInputErrorsFound = true;
 			}
 			ConstCOPChiller( ChillerNum ).Base.Name = cAlphaArgs( 1 );
 			ConstCOPChiller( ChillerNum ).Base.NomCap = rNumericArgs( 1 );
 			if ( rNumericArgs( 1 ) == 0.0 ) {
 				ShowSevereError( "Invalid " + cNumericFieldNames( 1 ) + '=' + RoundSigDigits( rNumericArgs( 1 ), 2 ) );
 				ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-				ErrorsFound = true;
+				GetConstCOPChillerInputErrorsFound = true;
 			}
 			ConstCOPChiller( ChillerNum ).Base.COP = rNumericArgs( 2 );
 			if ( rNumericArgs( 2 ) == 0.0 ) {
 				ShowSevereError( "Invalid " + cNumericFieldNames( 2 ) + '=' + RoundSigDigits( rNumericArgs( 2 ), 2 ) );
 				ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-				ErrorsFound = true;
+				GetConstCOPChillerInputErrorsFound = true;
 			}
 
 			//Set the Condenser Type from input
@@ -1908,7 +1970,7 @@ namespace PlantChillers {
 			} else {
 				ShowSevereError( "Invalid " + cAlphaFieldNames( 6 ) + '=' + cAlphaArgs( 6 ) );
 				ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-				ErrorsFound = true;
+				GetConstCOPChillerInputErrorsFound = true;
 			}
 
 			ConstCOPChiller( ChillerNum ).Base.EvapVolFlowRate = rNumericArgs( 3 );
@@ -1919,8 +1981,8 @@ namespace PlantChillers {
 			}
 			ConstCOPChiller( ChillerNum ).Base.SizFac = rNumericArgs( 5 );
 
-			ConstCOPChiller( ChillerNum ).Base.EvapInletNodeNum = GetOnlySingleNode( cAlphaArgs( 2 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			ConstCOPChiller( ChillerNum ).Base.EvapOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 3 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			ConstCOPChiller( ChillerNum ).Base.EvapInletNodeNum = GetOnlySingleNode( cAlphaArgs( 2 ), GetConstCOPChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			ConstCOPChiller( ChillerNum ).Base.EvapOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 3 ), GetConstCOPChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 			TestCompSet( cCurrentModuleObject, cAlphaArgs( 1 ), cAlphaArgs( 2 ), cAlphaArgs( 3 ), "Chilled Water Nodes" );
 
 			if ( ConstCOPChiller( ChillerNum ).Base.CondenserType == AirCooled || ConstCOPChiller( ChillerNum ).Base.CondenserType == EvapCooled ) {
@@ -1942,40 +2004,40 @@ namespace PlantChillers {
 					}
 				}
 
-				ConstCOPChiller( ChillerNum ).Base.CondInletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_OutsideAirReference, 2, ObjectIsNotParent );
+				ConstCOPChiller( ChillerNum ).Base.CondInletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), GetConstCOPChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_OutsideAirReference, 2, ObjectIsNotParent );
 				CheckAndAddAirNodeNumber( ConstCOPChiller( ChillerNum ).Base.CondInletNodeNum, Okay );
 				if ( ! Okay ) {
 					ShowWarningError( cCurrentModuleObject + ", Adding OutdoorAir:Node=" + cAlphaArgs( 4 ) );
 				}
 
-				ConstCOPChiller( ChillerNum ).Base.CondOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+				ConstCOPChiller( ChillerNum ).Base.CondOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), GetConstCOPChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
 			} else if ( ConstCOPChiller( ChillerNum ).Base.CondenserType == WaterCooled ) {
-				ConstCOPChiller( ChillerNum ).Base.CondInletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
-				ConstCOPChiller( ChillerNum ).Base.CondOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+				ConstCOPChiller( ChillerNum ).Base.CondInletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), GetConstCOPChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+				ConstCOPChiller( ChillerNum ).Base.CondOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), GetConstCOPChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
 				TestCompSet( cCurrentModuleObject, cAlphaArgs( 1 ), cAlphaArgs( 4 ), cAlphaArgs( 5 ), "Condenser Water Nodes" );
 				//Condenser Inlet node name is necessary for Water Cooled
 				if ( lAlphaFieldBlanks( 4 ) ) {
 					ShowSevereError( "Invalid, " + cAlphaFieldNames( 4 ) + "is blank " );
 					ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetConstCOPChillerInputErrorsFound = true;
 				} else if ( lAlphaFieldBlanks( 5 ) ) {
 					ShowSevereError( "Invalid, " + cAlphaFieldNames( 5 ) + "is blank " );
 					ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetConstCOPChillerInputErrorsFound = true;
 				}
 			} else {
-				ConstCOPChiller( ChillerNum ).Base.CondInletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
-				ConstCOPChiller( ChillerNum ).Base.CondOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+				ConstCOPChiller( ChillerNum ).Base.CondInletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), GetConstCOPChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+				ConstCOPChiller( ChillerNum ).Base.CondOutletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), GetConstCOPChillerInputErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
 				TestCompSet( cCurrentModuleObject, cAlphaArgs( 1 ), cAlphaArgs( 4 ), cAlphaArgs( 5 ), "Condenser (unknown?) Nodes" );
 				//Condenser Inlet node name is necessary for Water Cooled
 				if ( lAlphaFieldBlanks( 4 ) ) {
 					ShowSevereError( "Invalid, " + cAlphaFieldNames( 4 ) + "is blank " );
 					ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetConstCOPChillerInputErrorsFound = true;
 				} else if ( lAlphaFieldBlanks( 5 ) ) {
 					ShowSevereError( "Invalid, " + cAlphaFieldNames( 5 ) + "is blank " );
 					ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-					ErrorsFound = true;
+					GetConstCOPChillerInputErrorsFound = true;
 				}
 			}
 
@@ -2003,7 +2065,7 @@ namespace PlantChillers {
 			ConstCOPChiller( ChillerNum ).Base.BasinHeaterPowerFTempDiff = rNumericArgs( 6 );
 			if ( rNumericArgs( 6 ) < 0.0 ) {
 				ShowSevereError( cCurrentModuleObject + ", \"" + ConstCOPChiller( ChillerNum ).Base.Name + "\" TRIM(cNumericFieldNames(6)) must be >= 0" );
-				ErrorsFound = true;
+				GetConstCOPChillerInputErrorsFound = true;
 			}
 
 			ConstCOPChiller( ChillerNum ).Base.BasinHeaterSetPointTemp = rNumericArgs( 7 );
@@ -2026,7 +2088,7 @@ namespace PlantChillers {
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetConstCOPChillerInputErrorsFound ) {
 			ShowFatalError( "Errors found in processing input for " + cCurrentModuleObject );
 		}
 
@@ -2108,9 +2170,6 @@ namespace PlantChillers {
 		static std::string const RoutineName( "InitElectricChiller" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyFlag;
-		static Array1D_bool MyEnvrnFlag;
 		int CondInletNode; // node number of water inlet node to the condenser
 		int CondOutletNode; // node number of water outlet node from the condenser
 		int EvapInletNode;
@@ -2393,9 +2452,6 @@ namespace PlantChillers {
 		static std::string const RoutineName( "InitEngineDrivenChiller" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool MyFlag;
 		int CondInletNode; // node number of water inlet node to the condenser
 		int CondOutletNode;
 		int EvapInletNode;
@@ -2415,12 +2471,12 @@ namespace PlantChillers {
 		bool FatalError;
 
 		// Do the one time initializations
-		if ( MyOneTimeFlag ) {
-			MyFlag.allocate( NumEngineDrivenChillers );
-			MyEnvrnFlag.allocate( NumEngineDrivenChillers );
-			MyFlag = true;
-			MyEnvrnFlag = true;
-			MyOneTimeFlag = false;
+		if ( InitEngineDrivenChillerMyOneTimeFlag ) {
+			InitEngineDrivenChillerMyFlag.allocate( NumEngineDrivenChillers );
+			InitEngineDrivenChillerMyEnvrnFlag.allocate( NumEngineDrivenChillers );
+			InitEngineDrivenChillerMyFlag = true;
+			InitEngineDrivenChillerMyEnvrnFlag = true;
+			InitEngineDrivenChillerMyOneTimeFlag = false;
 		}
 
 		//Load inputs to local structure
@@ -2435,7 +2491,7 @@ namespace PlantChillers {
 		}
 
 		// Init more variables
-		if ( MyFlag( ChillNum ) ) {
+		if ( InitEngineDrivenChillerMyFlag( ChillNum ) ) {
 			// Locate the chillers on the plant loops for later usage
 			errFlag = false;
 			ScanPlantLoopsForObject( EngineDrivenChiller( ChillNum ).Base.Name, TypeOf_Chiller_EngineDriven, EngineDrivenChiller( ChillNum ).Base.CWLoopNum, EngineDrivenChiller( ChillNum ).Base.CWLoopSideNum, EngineDrivenChiller( ChillNum ).Base.CWBranchNum, EngineDrivenChiller( ChillNum ).Base.CWCompNum, EngineDrivenChiller( ChillNum ).TempLowLimitEvapOut, _, _, EngineDrivenChiller( ChillNum ).Base.EvapInletNodeNum, _, errFlag );
@@ -2447,7 +2503,7 @@ namespace PlantChillers {
 				ScanPlantLoopsForObject( EngineDrivenChiller( ChillNum ).Base.Name, TypeOf_Chiller_EngineDriven, EngineDrivenChiller( ChillNum ).HRLoopNum, EngineDrivenChiller( ChillNum ).HRLoopSideNum, EngineDrivenChiller( ChillNum ).HRBranchNum, EngineDrivenChiller( ChillNum ).HRCompNum, _, _, _, EngineDrivenChiller( ChillNum ).HeatRecInletNodeNum, _, errFlag );
 				InterConnectTwoPlantLoopSides( EngineDrivenChiller( ChillNum ).Base.CWLoopNum, EngineDrivenChiller( ChillNum ).Base.CWLoopSideNum, EngineDrivenChiller( ChillNum ).HRLoopNum, EngineDrivenChiller( ChillNum ).HRLoopSideNum, TypeOf_Chiller_EngineDriven, true );
 			}
-			MyFlag( ChillNum ) = false;
+			InitEngineDrivenChillerMyFlag( ChillNum ) = false;
 			if ( EngineDrivenChiller( ChillNum ).Base.CondenserType != AirCooled && EngineDrivenChiller( ChillNum ).Base.CondenserType != EvapCooled && EngineDrivenChiller( ChillNum ).HeatRecActive ) {
 				InterConnectTwoPlantLoopSides( EngineDrivenChiller( ChillNum ).Base.CDLoopNum, EngineDrivenChiller( ChillNum ).Base.CDLoopSideNum, EngineDrivenChiller( ChillNum ).HRLoopNum, EngineDrivenChiller( ChillNum ).HRLoopSideNum, TypeOf_Chiller_EngineDriven, false );
 			}
@@ -2494,13 +2550,13 @@ namespace PlantChillers {
 				}
 			}
 
-			MyFlag( ChillNum ) = false;
+			InitEngineDrivenChillerMyFlag( ChillNum ) = false;
 		}
 
 		//Initialize critical Demand Side Variables
 		//  IF((MyEnvrnFlag(ChillNum) .and. BeginEnvrnFlag) &
 		//     .OR. (Node(CondInletNode)%MassFlowrate <= 0.0 .AND. RunFlag)) THEN
-		if ( MyEnvrnFlag( ChillNum ) && BeginEnvrnFlag && ( PlantFirstSizesOkayToFinalize ) ) {
+		if ( InitEngineDrivenChillerMyEnvrnFlag( ChillNum ) && BeginEnvrnFlag && ( PlantFirstSizesOkayToFinalize ) ) {
 
 			rho = GetDensityGlycol( PlantLoop( EngineDrivenChiller( ChillNum ).Base.CWLoopNum ).FluidName, DataGlobals::CWInitConvTemp, PlantLoop( EngineDrivenChiller( ChillNum ).Base.CWLoopNum ).FluidIndex, RoutineName );
 
@@ -2538,11 +2594,11 @@ namespace PlantChillers {
 				InitComponentNodes( 0.0, EngineDrivenChiller( ChillNum ).DesignHeatRecMassFlowRate, EngineDrivenChiller( ChillNum ).HeatRecInletNodeNum, EngineDrivenChiller( ChillNum ).HeatRecOutletNodeNum, EngineDrivenChiller( ChillNum ).HRLoopNum, EngineDrivenChiller( ChillNum ).HRLoopSideNum, EngineDrivenChiller( ChillNum ).HRBranchNum, EngineDrivenChiller( ChillNum ).HRCompNum );
 			}
 
-			MyEnvrnFlag( ChillNum ) = false;
+			InitEngineDrivenChillerMyEnvrnFlag( ChillNum ) = false;
 		}
 
 		if ( ! BeginEnvrnFlag ) {
-			MyEnvrnFlag( ChillNum ) = true;
+			InitEngineDrivenChillerMyEnvrnFlag( ChillNum ) = true;
 		}
 
 		if ( ( EngineDrivenChiller( ChillNum ).Base.FlowMode == LeavingSetPointModulated ) && ( EngineDrivenChiller( ChillNum ).Base.ModulatedFlowSetToLoop ) ) {
@@ -2633,9 +2689,6 @@ namespace PlantChillers {
 		static std::string const RoutineName( "InitGTChiller" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool MyFlag;
 		int CondInletNode; // node number of water inlet node to the condenser
 		int CondOutletNode; // node number of water outlet node from the condenser
 		int EvapInletNode;
@@ -2656,12 +2709,12 @@ namespace PlantChillers {
 		// FLOW:
 
 		// Do the one time initializations
-		if ( MyOneTimeFlag ) {
-			MyFlag.allocate( NumGTChillers );
-			MyEnvrnFlag.allocate( NumGTChillers );
-			MyFlag = true;
-			MyEnvrnFlag = true;
-			MyOneTimeFlag = false;
+		if ( InitGTChillerMyOneTimeFlag ) {
+			InitGTChillerMyFlag.allocate( NumGTChillers );
+			InitGTChillerMyEnvrnFlag.allocate( NumGTChillers );
+			InitGTChillerMyFlag = true;
+			InitGTChillerMyEnvrnFlag = true;
+			InitGTChillerMyOneTimeFlag = false;
 		}
 
 		CondInletNode = GTChiller( ChillNum ).Base.CondInletNodeNum;
@@ -2675,7 +2728,7 @@ namespace PlantChillers {
 		}
 
 		// Init more variables
-		if ( MyFlag( ChillNum ) ) {
+		if ( InitGTChillerMyFlag( ChillNum ) ) {
 			// Locate the chillers on the plant loops for later usage
 			errFlag = false;
 			ScanPlantLoopsForObject( GTChiller( ChillNum ).Base.Name, TypeOf_Chiller_CombTurbine, GTChiller( ChillNum ).Base.CWLoopNum, GTChiller( ChillNum ).Base.CWLoopSideNum, GTChiller( ChillNum ).Base.CWBranchNum, GTChiller( ChillNum ).Base.CWCompNum, GTChiller( ChillNum ).TempLowLimitEvapOut, _, _, GTChiller( ChillNum ).Base.EvapInletNodeNum, _, errFlag );
@@ -2734,10 +2787,10 @@ namespace PlantChillers {
 					Node( GTChiller( ChillNum ).Base.EvapOutletNodeNum ).TempSetPointHi = Node( PlantLoop( GTChiller( ChillNum ).Base.CWLoopNum ).TempSetPointNodeNum ).TempSetPointHi;
 				}
 			}
-			MyFlag( ChillNum ) = false;
+			InitGTChillerMyFlag( ChillNum ) = false;
 		}
 
-		if ( MyEnvrnFlag( ChillNum ) && BeginEnvrnFlag && ( PlantFirstSizesOkayToFinalize ) ) {
+		if ( InitGTChillerMyEnvrnFlag( ChillNum ) && BeginEnvrnFlag && ( PlantFirstSizesOkayToFinalize ) ) {
 
 			rho = GetDensityGlycol( PlantLoop( GTChiller( ChillNum ).Base.CWLoopNum ).FluidName, DataGlobals::CWInitConvTemp, PlantLoop( GTChiller( ChillNum ).Base.CWLoopNum ).FluidIndex, RoutineName );
 
@@ -2775,11 +2828,11 @@ namespace PlantChillers {
 
 			}
 
-			MyEnvrnFlag( ChillNum ) = false;
+			InitGTChillerMyEnvrnFlag( ChillNum ) = false;
 		}
 
 		if ( ! BeginEnvrnFlag ) {
-			MyEnvrnFlag( ChillNum ) = true;
+			InitGTChillerMyEnvrnFlag( ChillNum ) = true;
 		}
 
 		if ( ( GTChiller( ChillNum ).Base.FlowMode == LeavingSetPointModulated ) && ( GTChiller( ChillNum ).Base.ModulatedFlowSetToLoop ) ) {
@@ -2871,9 +2924,6 @@ namespace PlantChillers {
 		Real64 const TempDesCondIn( 25.0 ); // Design condenser inlet temp. C
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool OneTimeFlag( true );
-		static Array1D_bool MyFlag;
-		static Array1D_bool MyEnvironFlag;
 		int CondInletNode; // node number of water inlet node to the condenser
 		int CondOutletNode; // node number of water outlet node from the condenser
 		int EvapInletNode;
@@ -2887,9 +2937,9 @@ namespace PlantChillers {
 		// Do the one time initializations
 
 		if ( OneTimeFlag ) {
-			MyFlag.allocate( NumConstCOPChillers );
+			InitConstCOPChillerMyFlag.allocate( NumConstCOPChillers );
 			MyEnvironFlag.allocate( NumConstCOPChillers );
-			MyFlag = true;
+			InitConstCOPChillerMyFlag = true;
 			MyEnvironFlag = true;
 			OneTimeFlag = false;
 		}
@@ -2900,7 +2950,7 @@ namespace PlantChillers {
 		CondOutletNode = ConstCOPChiller( ChillNum ).Base.CondOutletNodeNum;
 
 		// Init more variables
-		if ( MyFlag( ChillNum ) ) {
+		if ( InitConstCOPChillerMyFlag( ChillNum ) ) {
 			// Locate the chillers on the plant loops for later usage
 			errFlag = false;
 			ScanPlantLoopsForObject( ConstCOPChiller( ChillNum ).Base.Name, TypeOf_Chiller_ConstCOP, ConstCOPChiller( ChillNum ).Base.CWLoopNum, ConstCOPChiller( ChillNum ).Base.CWLoopSideNum, ConstCOPChiller( ChillNum ).Base.CWBranchNum, ConstCOPChiller( ChillNum ).Base.CWCompNum, _, _, _, ConstCOPChiller( ChillNum ).Base.EvapInletNodeNum, _, errFlag );
@@ -2950,7 +3000,7 @@ namespace PlantChillers {
 					Node( ConstCOPChiller( ChillNum ).Base.EvapOutletNodeNum ).TempSetPointHi = Node( PlantLoop( ConstCOPChiller( ChillNum ).Base.CWLoopNum ).TempSetPointNodeNum ).TempSetPointHi;
 				}
 			}
-			MyFlag( ChillNum ) = false;
+			InitConstCOPChillerMyFlag( ChillNum ) = false;
 		}
 
 		//Initialize critical Demand Side Variables at the beginning of each environment
@@ -4182,10 +4232,7 @@ namespace PlantChillers {
 		int LoopSideNum;
 		int BranchNum;
 		int CompNum;
-		static Real64 TimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
 		Real64 CurrentEndTime; // end time of time step for current simulation time step
-		static Real64 CurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
-		static std::string OutputChar; // character string for warning messages
 		Real64 Cp; // local for fluid specif heat, for evaporator
 		Real64 CpCond; // local for fluid specif heat, for condenser
 
@@ -4728,10 +4775,7 @@ namespace PlantChillers {
 		Real64 FRAC;
 		int LoopNum;
 		int LoopSideNum;
-		static Real64 TimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
 		Real64 CurrentEndTime; // end time of time step for current simulation time step
-		static Real64 CurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
-		static std::string OutputChar; // character string for warning messages
 		Real64 Cp; // local for fluid specif heat, for evaporator
 		Real64 CpCond; // local for fluid specif heat, for condenser
 
@@ -4798,7 +4842,7 @@ namespace PlantChillers {
 		//   Wait for next time step to print warnings. If simulation iterates, print out
 		//   the warning for the last iteration only. Must wait for next time step to accomplish this.
 		//   If a warning occurs and the simulation down shifts, the warning is not valid.
-		if ( CurrentEndTime > CurrentEndTimeLast && TimeStepSys >= TimeStepSysLast ) {
+		if ( CurrentEndTime > CalcEngineDrivenChillerModelCurrentEndTimeLast && TimeStepSys >= CalcEngineDrivenChillerModelTimeStepSysLast ) {
 			if ( EngineDrivenChiller( ChillerNum ).Base.PrintMessage ) {
 				++EngineDrivenChiller( ChillerNum ).Base.MsgErrorCount;
 				//     Show single warning and pass additional info to ShowRecurringWarningErrorAtEnd
@@ -4812,8 +4856,8 @@ namespace PlantChillers {
 		}
 
 		// save last system time step and last end time of current time step (used to determine if warning is valid)
-		TimeStepSysLast = TimeStepSys;
-		CurrentEndTimeLast = CurrentEndTime;
+		CalcEngineDrivenChillerModelTimeStepSysLast = TimeStepSys;
+		CalcEngineDrivenChillerModelCurrentEndTimeLast = CurrentEndTime;
 
 		//If Chiller load is 0 or chiller is not running then leave the subroutine.
 		if ( MyLoad >= 0.0 || ! RunFlag ) {
@@ -4846,9 +4890,9 @@ namespace PlantChillers {
 			//  Warn user if entering condenser temperature falls below 0C
 			if ( Node( CondInletNode ).Temp < 0.0 && ! WarmupFlag ) {
 				EngineDrivenChiller( ChillerNum ).Base.PrintMessage = true;
-				gio::write( OutputChar, OutputFormat ) << Node( CondInletNode ).Temp;
+				gio::write( CalcEngineDrivenChillerModelOutputChar, OutputFormat ) << Node( CondInletNode ).Temp;
 				EngineDrivenChiller( ChillerNum ).Base.MsgBuffer1 = "CalcEngineDrivenChillerModel - Chiller:EngineDriven \"" + EngineDrivenChiller( ChillerNum ).Base.Name + "\" - Air Cooled Condenser Inlet Temperature below 0C";
-				EngineDrivenChiller( ChillerNum ).Base.MsgBuffer2 = "... Outdoor Dry-bulb Condition = " + OutputChar + " C. Occurrence info = " + EnvironmentName + ", " + CurMnDy + ' ' + CreateSysTimeIntervalString();
+				EngineDrivenChiller( ChillerNum ).Base.MsgBuffer2 = "... Outdoor Dry-bulb Condition = " + CalcEngineDrivenChillerModelOutputChar + " C. Occurrence info = " + EnvironmentName + ", " + CurMnDy + ' ' + CreateSysTimeIntervalString();
 				EngineDrivenChiller( ChillerNum ).Base.MsgDataLast = Node( CondInletNode ).Temp;
 			} else {
 				EngineDrivenChiller( ChillerNum ).Base.PrintMessage = false;
@@ -4858,9 +4902,9 @@ namespace PlantChillers {
 			//  Warn user if evap condenser wet bulb temperature falls below 10C
 			if ( Node( CondInletNode ).Temp < 10.0 && ! WarmupFlag ) {
 				EngineDrivenChiller( ChillerNum ).Base.PrintMessage = true;
-				gio::write( OutputChar, OutputFormat ) << Node( CondInletNode ).Temp;
+				gio::write( CalcEngineDrivenChillerModelOutputChar, OutputFormat ) << Node( CondInletNode ).Temp;
 				EngineDrivenChiller( ChillerNum ).Base.MsgBuffer1 = "CalcEngineDrivenChillerModel - Chiller:EngineDriven \"" + EngineDrivenChiller( ChillerNum ).Base.Name + "\" - Evap Cooled Condenser Inlet Temperature below 10C";
-				EngineDrivenChiller( ChillerNum ).Base.MsgBuffer2 = "... Outdoor Wet-bulb Condition = " + OutputChar + " C. Occurrence info = " + EnvironmentName + ", " + CurMnDy + ' ' + CreateSysTimeIntervalString();
+				EngineDrivenChiller( ChillerNum ).Base.MsgBuffer2 = "... Outdoor Wet-bulb Condition = " + CalcEngineDrivenChillerModelOutputChar + " C. Occurrence info = " + EnvironmentName + ", " + CurMnDy + ' ' + CreateSysTimeIntervalString();
 				EngineDrivenChiller( ChillerNum ).Base.MsgDataLast = Node( CondInletNode ).Temp;
 			} else {
 				EngineDrivenChiller( ChillerNum ).Base.PrintMessage = false;
@@ -5323,7 +5367,6 @@ namespace PlantChillers {
 		int EvapOutletNode; // evaporator outlet node number, water side
 		int CondInletNode; // condenser inlet node number, water side
 		int CondOutletNode; // condenser outlet node number, water side
-		static Real64 EvapMassFlowRateMax( 0.0 ); // Max Design Evaporator Mass Flow Rate converted from Volume Flow Rate
 		Real64 TempLowLimitEout; // C - Evaporator low temp. limit cut off
 		// Special variables for GT Chiller
 		Real64 RPLoad;
@@ -5340,10 +5383,7 @@ namespace PlantChillers {
 		Real64 UAtoCapRat; // (UACGC) Heat Exchanger UA to Capacity
 		Real64 AmbientDeltaT; // (ATAIR) Difference between ambient actual and ambient design temperatures
 		Real64 DesignSteamSatTemp; // Saturization Temperature of Steam in Stack
-		static Real64 TimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
 		Real64 CurrentEndTime; // end time of time step for current simulation time step
-		static Real64 CurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
-		static std::string OutputChar; // character string for warning messages
 
 		int HeatRecInNode; // Heat Recovery Fluid Inlet Node Num
 		int HeatRecOutNode; // Heat Recovery Fluid Outlet Node Num
@@ -5390,7 +5430,7 @@ namespace PlantChillers {
 		// Wait for next time step to print warnings. If simulation iterates, print out
 		// the warning for the last iteration only. Must wait for next time step to accomplish this.
 		// If a warning occurs and the simulation down shifts, the warning is not valid.
-		if ( CurrentEndTime > CurrentEndTimeLast && TimeStepSys >= TimeStepSysLast ) {
+		if ( CurrentEndTime > CalcGTChillerModelCurrentEndTimeLast && TimeStepSys >= CalcGTChillerModelTimeStepSysLast ) {
 			if ( GTChiller( ChillerNum ).Base.PrintMessage ) {
 				++GTChiller( ChillerNum ).Base.MsgErrorCount;
 				// Show single warning and pass additional info to ShowRecurringWarningErrorAtEnd
@@ -5404,8 +5444,8 @@ namespace PlantChillers {
 		}
 
 		// save last system time step and last end time of current time step (used to determine if warning is valid)
-		TimeStepSysLast = TimeStepSys;
-		CurrentEndTimeLast = CurrentEndTime;
+		CalcGTChillerModelTimeStepSysLast = TimeStepSys;
+		CalcGTChillerModelCurrentEndTimeLast = CurrentEndTime;
 
 		// If Chiller load is 0 or chiller is not running then leave the subroutine.Before leaving
 		// if the component control is SERIESACTIVE we set the component flow to inlet flow so that
@@ -5439,9 +5479,9 @@ namespace PlantChillers {
 			//  Warn user if entering condenser temperature falls below 0C
 			if ( Node( CondInletNode ).Temp < 0.0 && ! WarmupFlag ) {
 				GTChiller( ChillerNum ).Base.PrintMessage = true;
-				gio::write( OutputChar, OutputFormat ) << Node( CondInletNode ).Temp;
+				gio::write( CalcGTChillerModelOutputChar, OutputFormat ) << Node( CondInletNode ).Temp;
 				GTChiller( ChillerNum ).Base.MsgBuffer1 = "CalcGasTurbineChillerModel - Chiller:CombustionTurbine \"" + GTChiller( ChillerNum ).Base.Name + "\" - Air Cooled Condenser Inlet Temperature below 0C";
-				GTChiller( ChillerNum ).Base.MsgBuffer2 = "... Outdoor Dry-bulb Condition = " + OutputChar + " C. Occurrence info = " + EnvironmentName + ", " + CurMnDy + ' ' + CreateSysTimeIntervalString();
+				GTChiller( ChillerNum ).Base.MsgBuffer2 = "... Outdoor Dry-bulb Condition = " + CalcGTChillerModelOutputChar + " C. Occurrence info = " + EnvironmentName + ", " + CurMnDy + ' ' + CreateSysTimeIntervalString();
 				GTChiller( ChillerNum ).Base.MsgDataLast = Node( CondInletNode ).Temp;
 			} else {
 				GTChiller( ChillerNum ).Base.PrintMessage = false;
@@ -5451,9 +5491,9 @@ namespace PlantChillers {
 			//  Warn user if evap condenser wet bulb temperature falls below 10C
 			if ( Node( CondInletNode ).Temp < 10.0 && ! WarmupFlag ) {
 				GTChiller( ChillerNum ).Base.PrintMessage = true;
-				gio::write( OutputChar, OutputFormat ) << Node( CondInletNode ).Temp;
+				gio::write( CalcGTChillerModelOutputChar, OutputFormat ) << Node( CondInletNode ).Temp;
 				GTChiller( ChillerNum ).Base.MsgBuffer1 = "CalcGasTurbineChillerModel - Chiller:CombustionTurbine \"" + GTChiller( ChillerNum ).Base.Name + "\" - Evap Cooled Condenser Inlet Temperature below 10C";
-				GTChiller( ChillerNum ).Base.MsgBuffer2 = "... Outdoor Wet-bulb Condition = " + OutputChar + " C. Occurrence info = " + EnvironmentName + ", " + CurMnDy + ' ' + CreateSysTimeIntervalString();
+				GTChiller( ChillerNum ).Base.MsgBuffer2 = "... Outdoor Wet-bulb Condition = " + CalcGTChillerModelOutputChar + " C. Occurrence info = " + EnvironmentName + ", " + CurMnDy + ' ' + CreateSysTimeIntervalString();
 				GTChiller( ChillerNum ).Base.MsgDataLast = Node( CondInletNode ).Temp;
 			} else {
 				GTChiller( ChillerNum ).Base.PrintMessage = false;
@@ -5974,10 +6014,7 @@ namespace PlantChillers {
 		//  LOGICAL,SAVE           :: PossibleSubcooling=.FALSE.
 		int LoopNum;
 		int LoopSideNum;
-		static Real64 TimeStepSysLast( 0.0 ); // last system time step (used to check for downshifting)
 		Real64 CurrentEndTime; // end time of time step for current simulation time step
-		static Real64 CurrentEndTimeLast( 0.0 ); // end time of time step for last simulation time step
-		static std::string OutputChar; // character string for warning messages
 		Real64 Cp; // local for fluid specif heat, for evaporator
 		Real64 CpCond; // local for fluid specif heat, for condenser
 
@@ -6052,7 +6089,7 @@ namespace PlantChillers {
 		//   Wait for next time step to print warnings. If simulation iterates, print out
 		//   the warning for the last iteration only. Must wait for next time step to accomplish this.
 		//   If a warning occurs and the simulation down shifts, the warning is not valid.
-		if ( CurrentEndTime > CurrentEndTimeLast && TimeStepSys >= TimeStepSysLast ) {
+		if ( CurrentEndTime > CalcConstCOPChillerModelCurrentEndTimeLast && TimeStepSys >= CalcConstCOPChillerModelTimeStepSysLast ) {
 			if ( ConstCOPChiller( ChillNum ).Base.PrintMessage ) {
 				++ConstCOPChiller( ChillNum ).Base.MsgErrorCount;
 				//       Show single warning and pass additional info to ShowRecurringWarningErrorAtEnd
@@ -6066,8 +6103,8 @@ namespace PlantChillers {
 		}
 
 		//   save last system time step and last end time of current time step (used to determine if warning is valid)
-		TimeStepSysLast = TimeStepSys;
-		CurrentEndTimeLast = CurrentEndTime;
+		CalcConstCOPChillerModelTimeStepSysLast = TimeStepSys;
+		CalcConstCOPChillerModelCurrentEndTimeLast = CurrentEndTime;
 
 		//otherwise the chiller is running...
 
@@ -6076,9 +6113,9 @@ namespace PlantChillers {
 			//  Warn user if entering condenser temperature falls below 0C
 			if ( Node( CondInletNode ).Temp < 0.0 && ! WarmupFlag ) {
 				ConstCOPChiller( ChillNum ).Base.PrintMessage = true;
-				gio::write( OutputChar, OutputFormat ) << Node( CondInletNode ).Temp;
+				gio::write( CalcConstCOPChillerModelOutputChar, OutputFormat ) << Node( CondInletNode ).Temp;
 				ConstCOPChiller( ChillNum ).Base.MsgBuffer1 = "CalcConstCOPChillerModel - Chiller:ConstantCOP \"" + ConstCOPChiller( ChillNum ).Base.Name + "\" - Air Cooled Condenser Inlet Temperature below 0C";
-				ConstCOPChiller( ChillNum ).Base.MsgBuffer2 = "... Outdoor Dry-bulb Condition = " + OutputChar + " C. Occurrence info = " + EnvironmentName + ", " + CurMnDy + ' ' + CreateSysTimeIntervalString();
+				ConstCOPChiller( ChillNum ).Base.MsgBuffer2 = "... Outdoor Dry-bulb Condition = " + CalcConstCOPChillerModelOutputChar + " C. Occurrence info = " + EnvironmentName + ", " + CurMnDy + ' ' + CreateSysTimeIntervalString();
 				ConstCOPChiller( ChillNum ).Base.MsgDataLast = Node( CondInletNode ).Temp;
 			} else {
 				ConstCOPChiller( ChillNum ).Base.PrintMessage = false;
@@ -6088,9 +6125,9 @@ namespace PlantChillers {
 			//  Warn user if evap condenser wet bulb temperature falls below 10C
 			if ( Node( CondInletNode ).Temp < 10.0 && ! WarmupFlag ) {
 				ConstCOPChiller( ChillNum ).Base.PrintMessage = true;
-				gio::write( OutputChar, OutputFormat ) << Node( CondInletNode ).Temp;
+				gio::write( CalcConstCOPChillerModelOutputChar, OutputFormat ) << Node( CondInletNode ).Temp;
 				ConstCOPChiller( ChillNum ).Base.MsgBuffer1 = "CalcConstCOPChillerModel - Chiller:ConstantCOP \"" + ConstCOPChiller( ChillNum ).Base.Name + "\" - Evap Cooled Condenser Inlet Temperature below 10C";
-				ConstCOPChiller( ChillNum ).Base.MsgBuffer2 = "... Outdoor Wet-bulb Condition = " + OutputChar + " C. Occurrence info = " + EnvironmentName + ", " + CurMnDy + ' ' + CreateSysTimeIntervalString();
+				ConstCOPChiller( ChillNum ).Base.MsgBuffer2 = "... Outdoor Wet-bulb Condition = " + CalcConstCOPChillerModelOutputChar + " C. Occurrence info = " + EnvironmentName + ", " + CurMnDy + ' ' + CreateSysTimeIntervalString();
 				ConstCOPChiller( ChillNum ).Base.MsgDataLast = Node( CondInletNode ).Temp;
 			} else {
 				ConstCOPChiller( ChillNum ).Base.PrintMessage = false;
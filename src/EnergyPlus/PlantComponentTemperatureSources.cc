@@ -121,6 +121,28 @@ namespace PlantComponentTemperatureSources {
 	// Object Data
 	Array1D< WaterSourceSpecs > WaterSource; // dimension to number of machines
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false );
+	}
+
+	// Functions
+
+	// Clears the global data in PlantComponentTemperatureSources.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumSources = 0;
+		GetInput = true;
+		WaterSource.deallocate();
+		ErrorsFound = false;
+	}
+
 	void
 	SimWaterSource(
 		std::string const & SourceName, // user-specified name for this component
@@ -264,7 +286,6 @@ namespace PlantComponentTemperatureSources {
 		int NumAlphas; // Number of elements in the alpha array
 		int NumNums; // Number of elements in the numeric array
 		int IOStat; // IO Status when calling get input subroutine
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 
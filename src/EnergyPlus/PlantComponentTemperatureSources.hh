@@ -146,6 +146,11 @@ namespace PlantComponentTemperatureSources {
 
 	// Functions
 
+	// Clears the global data in PlantComponentTemperatureSources.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimWaterSource(
 		std::string const & SourceName, // user-specified name for this component
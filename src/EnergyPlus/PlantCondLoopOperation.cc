@@ -135,6 +135,23 @@ namespace PlantCondLoopOperation {
 		bool GetPlantOpInput( true ); // operation Get Input flag
 		bool InitLoadDistributionOneTimeFlag( true );
 		bool LoadEquipListOneTimeFlag( true );
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		int FindDeltaTempRangeInputTotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		int TotNumLists( 0 );
+		Array1D_string EquipListsNameList;
+		Array1D_int EquipListsTypeList;
+		Array1D_int EquipListsIndexList;
+		bool lDummy; //Fix Changed to static: Passed to SetupEMSActuator as source of persistent Reference
+		Real64 CurMassFlowRate( 0.0 );
+		Real64 ToutLowLimit( 0.0 );
+		Real64 ToutHiLimit( 0.0 );
+		Real64 TinLowLimit( 0.0 );
+		Real64 Tinlet( 0.0 );
+		Real64 Tsensor( 0.0 );
+		Real64 CurSpecHeat( 0.0 );
+		Real64 QdotTmp( 0.0 );
+		int ControlNodeNum( 0 );
+		std::string Units( "[on/off]" );
 	}
 	//MODULE VARIABLE DECLARATIONS:
 
@@ -159,6 +176,23 @@ namespace PlantCondLoopOperation {
 		GetPlantOpInput = true;
 		InitLoadDistributionOneTimeFlag = true;
 		LoadEquipListOneTimeFlag = true;
+		TotalArgs = 0;
+		FindDeltaTempRangeInputTotalArgs = 0;
+		TotNumLists = 0;
+		EquipListsNameList.deallocate();
+		EquipListsTypeList.deallocate();
+		EquipListsIndexList.deallocate();
+		lDummy = false;
+		CurMassFlowRate = 0.0;
+		ToutLowLimit = 0.0;
+		ToutHiLimit = 0.0;
+		TinLowLimit = 0.0;
+		Tinlet = 0.0;
+		Tsensor = 0.0;
+		CurSpecHeat = 0.0;
+		QdotTmp = 0.0;
+		ControlNodeNum = 0;
+		Units = "[on/off]";
 	}
 
 	void
@@ -890,7 +924,6 @@ namespace PlantCondLoopOperation {
 		Array1D< Real64 > NumArray; // Numeric input items for object
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 		//   certain object in the input file
 		int Num;
 		int NumEquipLists;
@@ -1075,7 +1108,6 @@ namespace PlantCondLoopOperation {
 		Array1D< Real64 > NumArray; // Numeric input items for object
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 		//   certain object in the input file
 		int Num;
 		int NumEquipLists;
@@ -1086,7 +1118,7 @@ namespace PlantCondLoopOperation {
 		SchemeNameFound = true;
 
 		// Determine max number of alpha and numeric arguments for all objects being read, in order to allocate local arrays
-		GetObjectDefMaxArgs( CurrentModuleObject, TotalArgs, NumAlphas, NumNums );
+		GetObjectDefMaxArgs( CurrentModuleObject, FindDeltaTempRangeInputTotalArgs, NumAlphas, NumNums );
 
 		AlphArray.allocate( NumAlphas );
 		cAlphaFields.allocate( NumAlphas );
@@ -1199,10 +1231,6 @@ namespace PlantCondLoopOperation {
 		int IOStat;
 		bool IsNotOK;
 		std::string CurrentModuleObject;
-		static int TotNumLists( 0 );
-		static Array1D_string EquipListsNameList;
-		static Array1D_int EquipListsTypeList;
-		static Array1D_int EquipListsIndexList;
 		int iIndex;
 		bool firstblank;
 
@@ -1687,7 +1715,6 @@ namespace PlantCondLoopOperation {
 		bool SchemeNameFound; // Set to FALSE if a match of OpScheme object and OpScheme name is not found
 		std::string LoopOpSchemeObj; // Used to identify the object name for loop equipment operation scheme
 		int StackMngrNum; // local temporary for Erl program calling manager index
-		static bool lDummy; //Fix Changed to static: Passed to SetupEMSActuator as source of persistent Reference
 
 		SchemeNameFound = true;
 
@@ -2681,15 +2708,6 @@ namespace PlantCondLoopOperation {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 CurMassFlowRate( 0.0 );
-		static Real64 ToutLowLimit( 0.0 );
-		static Real64 ToutHiLimit( 0.0 );
-		static Real64 TinLowLimit( 0.0 );
-		static Real64 Tinlet( 0.0 );
-		static Real64 Tsensor( 0.0 );
-		static Real64 CurSpecHeat( 0.0 );
-		static Real64 QdotTmp( 0.0 );
-		static int ControlNodeNum( 0 );
 
 		auto & this_component( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).Branch( BranchNum ).Comp( CompNum ) );
 
@@ -3276,7 +3294,6 @@ namespace PlantCondLoopOperation {
 		std::string ActuatorType;
 		std::string ActuatorName;
 		std::string UniqueIDName;
-		static std::string Units( "[on/off]" );
 		// INTEGER                      :: NumAct
 		int LoopNum;
 		int LoopSideNum;
@@ -157,8 +157,42 @@ namespace PlantHeatExchangerFluidToFluid {
 	// Object Data
 	Array1D< HeatExchangerStruct > FluidHX;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false );
+		int MaxNumAlphas( 0 ); // argument for call to GetObjectDefMaxArgs
+		int MaxNumNumbers( 0 ); // argument for call to GetObjectDefMaxArgs
+		int TotalArgs( 0 ); // argument for call to GetObjectDefMaxArgs
+		bool MyOneTimeFlag( true ); // one time flag
+		Array1D_bool MyEnvrnFlag; // environment flag
+		Array1D_bool MyFlag;
+	}
+
 	// Functions
 
+	// Clears the global data in PlantHeatExchangerFluidToFluid.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		ComponentClassName = "HeatExchanger:FluidToFluid";
+		NumberOfPlantFluidHXs = 0;
+		GetInput = true;
+		CheckFluidHXs.deallocate();
+		FluidHX.deallocate();
+		ErrorsFound = false;
+		MaxNumAlphas = 0;
+		MaxNumNumbers = 0;
+		TotalArgs = 0;
+		MyOneTimeFlag = true;
+		MyEnvrnFlag.deallocate();
+		MyFlag.deallocate();
+	}
+
 	void
 	SimFluidHeatExchanger(
 		int const LoopNum, // plant loop sim call originated from
@@ -320,15 +354,11 @@ namespace PlantHeatExchangerFluidToFluid {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false );
 		int NumAlphas; // Number of elements in the alpha array
 		int NumNums; // Number of elements in the numeric array
 		int IOStat; // IO Status when calling get input subroutine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
-		static int MaxNumAlphas( 0 ); // argument for call to GetObjectDefMaxArgs
-		static int MaxNumNumbers( 0 ); // argument for call to GetObjectDefMaxArgs
-		static int TotalArgs( 0 ); // argument for call to GetObjectDefMaxArgs
 		Array1D_string cAlphaFieldNames;
 		Array1D_string cNumericFieldNames;
 		Array1D_bool lNumericFieldBlanks;
@@ -628,9 +658,6 @@ namespace PlantHeatExchangerFluidToFluid {
 		static std::string const RoutineNameNoColon( "InitFluidHeatExchanger" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true ); // one time flag
-		static Array1D_bool MyEnvrnFlag; // environment flag
-		static Array1D_bool MyFlag;
 		bool errFlag;
 		static std::string const RoutineName( "InitFluidHeatExchanger: " );
 		Real64 rho;
@@ -1764,7 +1791,7 @@ namespace PlantHeatExchangerFluidToFluid {
 				Par( 1 ) = double( CompNum ); // HX index
 				Par( 2 ) = TargetSupplySideLoopLeavingTemp;
 
-				SolveRegulaFalsi( Acc, MaxIte, SolFla, DmdSideMdot, HXDemandSideLoopFlowResidual, FluidHX( CompNum ).DemandSideLoop.MassFlowRateMin, FluidHX( CompNum ).DemandSideLoop.MassFlowRateMax, Par );
+				SolveRegulaFalsi( Acc, MaxIte, SolFla, DmdSideMdot, HXDemandSideLoopFlowResidual, FluidHX( CompNum ).DemandSideLoop.MassFlowRateMin, FluidHX( CompNum ).DemandSideLoop.MassFlowRateMax, Par, "FindHXDemandSideLoopFlow" );
 
 				if ( SolFla == -1 ) { // no convergence
 					if ( ! WarmupFlag ) {
@@ -1805,7 +1832,7 @@ namespace PlantHeatExchangerFluidToFluid {
 				Par( 1 ) = double( CompNum ); // HX index
 				Par( 2 ) = TargetSupplySideLoopLeavingTemp;
 
-				SolveRegulaFalsi( Acc, MaxIte, SolFla, DmdSideMdot, HXDemandSideLoopFlowResidual, FluidHX( CompNum ).DemandSideLoop.MassFlowRateMin, FluidHX( CompNum ).DemandSideLoop.MassFlowRateMax, Par );
+				SolveRegulaFalsi( Acc, MaxIte, SolFla, DmdSideMdot, HXDemandSideLoopFlowResidual, FluidHX( CompNum ).DemandSideLoop.MassFlowRateMin, FluidHX( CompNum ).DemandSideLoop.MassFlowRateMax, Par, "FindHXDemandSideLoopFlow" );
 
 				if ( SolFla == -1 ) { // no convergence
 					if ( ! WarmupFlag ) {
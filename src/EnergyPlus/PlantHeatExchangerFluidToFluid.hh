@@ -241,6 +241,11 @@ namespace PlantHeatExchangerFluidToFluid {
 
 	// Functions
 
+	// Clears the global data in PlantHeatExchangerFluidToFluid.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimFluidHeatExchanger(
 		int const LoopNum, // plant loop sim call originated from
@@ -114,6 +114,15 @@ namespace PlantLoadProfile {
 	// Object Data
 	Array1D< PlantProfileData > PlantProfile;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+	}
+
 	PlantComponent *
 	PlantProfileData::factory( std::string objectName ) {
 		if ( GetPlantLoadProfileInputFlag ) {
@@ -387,7 +396,6 @@ namespace PlantLoadProfile {
 
 		// Locals
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		int IOStatus; // Used in GetObjectItem
 		bool IsBlank; // TRUE if the name is blank
 		bool IsNotOK; // TRUE if there was a problem with a list name
@@ -469,6 +477,7 @@ namespace PlantLoadProfile {
 		NumOfPlantProfile = 0;
 		GetPlantLoadProfileInputFlag = true;
 		PlantProfile.deallocate();
+		ErrorsFound = false;
 	}
 
 
@@ -270,7 +270,7 @@ namespace PlantLoopEquip {
 		// set up a reference for this component
 		auto & sim_component( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).Branch( BranchNum ).Comp( Num ) );
 
-		static std::vector< int > compsToSimAfterInitLoopEquip = { TypeOf_Pipe, TypeOf_PipeSteam };
+		static std::vector< int > const compsToSimAfterInitLoopEquip = { TypeOf_Pipe, TypeOf_PipeSteam };
 
 		//set local variables
 		EquipTypeNum = sim_component.TypeOf_Num;
@@ -125,6 +125,17 @@ namespace PlantLoopSolver {
 	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
 	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
 		bool EstablishedCompPumpIndeces( false );
+		Array2D< Real64 > NoLoadConstantSpeedBranchFlowRateSteps;
+		Array1D_bool ThisLoopHasConstantSpeedBranchPumps( 2 );
+		Array1D< Real64 > EachSideFlowRequestNeedAndTurnOn( 2 ); // 2 for SupplySide/DemandSide
+		Array1D< Real64 > EachSideFlowRequestNeedIfOn( 2 ); // 2 for SupplySide/DemandSide
+		Array1D< Real64 > EachSideFlowRequestFinal( 2 ); // 2 for SupplySide/DemandSide
+		bool AllocatedParallelArray( false );
+		int LastLoopNum( -1 );
+		int LastLoopSideNum( -1 );
+		int LastFirstBranchNum( -1 );
+		int LastLastBranchNum( -1 );
+		Array1D_int SimulateLoopSideBranchGroupLastComponentSimulated;
 	}
 	// SUBROUTINE SPECIFICATIONS:
 	//PRIVATE EvaluatePumpFlowConditions
@@ -144,6 +155,17 @@ namespace PlantLoopSolver {
 		InitialDemandToLoopSetPointSAVED = 0.0;
 		RefrigIndex = 0 ; // Index denoting refrigerant used (possibly steam)
 		EstablishedCompPumpIndeces = false;
+		NoLoadConstantSpeedBranchFlowRateSteps.deallocate();
+		ThisLoopHasConstantSpeedBranchPumps = Array1D_bool( 2 );
+		EachSideFlowRequestNeedAndTurnOn = Array1D< Real64 >( 2 );
+		EachSideFlowRequestNeedIfOn = Array1D< Real64 >( 2 );
+		EachSideFlowRequestFinal = Array1D< Real64 >( 2 );
+		AllocatedParallelArray = false;
+		LastLoopNum = -1;
+		LastLoopSideNum = -1;
+		LastFirstBranchNum = -1;
+		LastLastBranchNum = -1;
+		SimulateLoopSideBranchGroupLastComponentSimulated.deallocate();
 	}
 
 
@@ -666,7 +688,6 @@ namespace PlantLoopSolver {
 		Real64 InletBranchRequestNeedAndTurnOn;
 		Real64 InletBranchRequestNeedIfOn;
 //		static Array2D< Real64 > LoadedConstantSpeedBranchFlowRateSteps; // Values never used
-		static Array2D< Real64 > NoLoadConstantSpeedBranchFlowRateSteps;
 		int ParallelBranchIndex;
 		Real64 OutletBranchRequestNeedAndTurnOn;
 		Real64 OutletBranchRequestNeedIfOn;
@@ -675,12 +696,7 @@ namespace PlantLoopSolver {
 		bool ThisLoopHasCommonPipe( false );
 
 		//Tuned Made static: Set before use
-		static Array1D_bool ThisLoopHasConstantSpeedBranchPumps( 2 );
-		static Array1D< Real64 > EachSideFlowRequestNeedAndTurnOn( 2 ); // 2 for SupplySide/DemandSide
-		static Array1D< Real64 > EachSideFlowRequestNeedIfOn( 2 ); // 2 for SupplySide/DemandSide
-		static Array1D< Real64 > EachSideFlowRequestFinal( 2 ); // 2 for SupplySide/DemandSide
 
-		static bool AllocatedParallelArray( false );
 		int MaxParallelBranchCount;
 		int FlowPriorityStatus;
 		Real64 tmpLoopFlow;
@@ -1175,10 +1191,6 @@ namespace PlantLoopSolver {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		//~ History values
-		static int LastLoopNum( -1 );
-		static int LastLoopSideNum( -1 );
-		static int LastFirstBranchNum( -1 );
-		static int LastLastBranchNum( -1 );
 
 		//~ Indexing variables
 		int BranchCounter; // ~ This contains the index for the %Branch(:) structure
@@ -1196,7 +1208,6 @@ namespace PlantLoopSolver {
 		static Array1D_string const LoopSideNames( 2, { "Demand", "Supply" } );
 
 		//~ General variables
-		static Array1D_int LastComponentSimulated;
 		Real64 LoadToLoopSetPoint;
 
 		int curCompOpSchemePtr;
@@ -1213,16 +1224,16 @@ namespace PlantLoopSolver {
 		// We only need to reallocate the accessible array and reset the LastComponentSimulated if
 		//  either is currently NOT allocated, or if we are coming into this routine with a
 		//  new simulation region.  Otherwise leave it alone and save computation time
-		if ( ( ! allocated( LastComponentSimulated ) ) || ( LoopNum != LastLoopNum ) || ( LoopSideNum != LastLoopSideNum ) || ( FirstBranchNum != LastFirstBranchNum ) || ( LastBranchNum != LastLastBranchNum ) || StartingNewLoopSidePass ) { //we need to reallocate // ( ! allocated( AccessibleBranches ) ) ||
+		if ( ( ! allocated( SimulateLoopSideBranchGroupLastComponentSimulated ) ) || ( LoopNum != LastLoopNum ) || ( LoopSideNum != LastLoopSideNum ) || ( FirstBranchNum != LastFirstBranchNum ) || ( LastBranchNum != LastLastBranchNum ) || StartingNewLoopSidePass ) { //we need to reallocate // ( ! allocated( AccessibleBranches ) ) ||
 
 			// How many will we need?
 			NumBranchesInRegion = LastBranchNum - FirstBranchNum + 1;
 
 			// Reallocate for the number of locations we have available // No heap if size is unchanged
-			if ( NumBranchesInRegion > LastComponentSimulated.isize() ) { //Tuned Changed to grow-only strategy
-				LastComponentSimulated.allocate( NumBranchesInRegion );
+			if ( NumBranchesInRegion > SimulateLoopSideBranchGroupLastComponentSimulated.isize() ) { //Tuned Changed to grow-only strategy
+				SimulateLoopSideBranchGroupLastComponentSimulated.allocate( NumBranchesInRegion );
 			}
-			for ( int i = 1; i <= NumBranchesInRegion; ++i ) LastComponentSimulated( i ) = 0; // Only zero the active elements
+			for ( int i = 1; i <= NumBranchesInRegion; ++i ) SimulateLoopSideBranchGroupLastComponentSimulated( i ) = 0; // Only zero the active elements
 //			AccessibleBranches.allocate( NumBranchesInRegion );
 
 //			BranchIndex = 0;
@@ -1254,7 +1265,7 @@ namespace PlantLoopSolver {
 
 			//~ Always start from the last component we did the last time around + 1 and
 			//~  try to make it all the way to the end of the loop
-			StartingComponent = LastComponentSimulated( BranchIndex ) + 1;
+			StartingComponent = SimulateLoopSideBranchGroupLastComponentSimulated( BranchIndex ) + 1;
 			EndingComponent = branch.TotalComponents;
 			for ( CompCounter = StartingComponent; CompCounter <= EndingComponent; ++CompCounter ) {
 
@@ -1303,7 +1314,7 @@ namespace PlantLoopSolver {
 				UpdateAnyLoopDemandAlterations( LoopNum, LoopSideNum, BranchCounter, CompCounter );
 
 				//~ If we didn't EXIT early, we must have simulated, so update array
-				LastComponentSimulated( BranchIndex ) = CompCounter;
+				SimulateLoopSideBranchGroupLastComponentSimulated( BranchIndex ) = CompCounter;
 
 			} //~ CompCounter
 			components_end: ;
@@ -1334,7 +1345,7 @@ namespace PlantLoopSolver {
 
 			//~ Always start from the last component we did the last time around + 1 and
 			//~  try to make it all the way to the end of the loop
-			StartingComponent = LastComponentSimulated( BranchIndex ) + 1;
+			StartingComponent = SimulateLoopSideBranchGroupLastComponentSimulated( BranchIndex ) + 1;
 			EndingComponent = branch.TotalComponents;
 			for ( CompCounter = StartingComponent; CompCounter <= EndingComponent; ++CompCounter ) {
 
@@ -1370,7 +1381,7 @@ namespace PlantLoopSolver {
 				}
 
 				//~ If we didn't EXIT early, we must have simulated, so update array
-				LastComponentSimulated( BranchIndex ) = CompCounter;
+				SimulateLoopSideBranchGroupLastComponentSimulated( BranchIndex ) = CompCounter;
 
 			} //~ CompCounter
 			components2_end: ;
@@ -1394,7 +1405,7 @@ namespace PlantLoopSolver {
 
 			//~ Always start from the last component we did the last time around + 1 and
 			//~  try to make it all the way to the end of the loop
-			StartingComponent = LastComponentSimulated( BranchIndex ) + 1;
+			StartingComponent = SimulateLoopSideBranchGroupLastComponentSimulated( BranchIndex ) + 1;
 			EndingComponent = branch.TotalComponents;
 			for ( CompCounter = StartingComponent; CompCounter <= EndingComponent; ++CompCounter ) {
 
@@ -1424,7 +1435,7 @@ namespace PlantLoopSolver {
 				}
 
 				//~ If we didn't EXIT early, we must have simulated, so update array
-				LastComponentSimulated( BranchIndex ) = CompCounter;
+				SimulateLoopSideBranchGroupLastComponentSimulated( BranchIndex ) = CompCounter;
 
 			} //~ CompCounter
 
@@ -68,6 +68,7 @@
 // EnergyPlus Headers
 #include <PlantManager.hh>
 #include <BranchInputManager.hh>
+#include <Checkpoint.hh>
 #include <DataBranchAirLoopPlant.hh>
 #include <DataConvergParams.hh>
 #include <DataEnvironment.hh>
@@ -169,6 +170,35 @@ namespace PlantManager {
 
 	// MODULE SUBROUTINES
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false );
+		bool GetPlantInputErrorsFound( false );
+		Array1D_string BranchNames; // Branch names from GetBranchList call
+		Array1D_string CompTypes; // Branch names from GetBranchList call
+		Array1D_string CompNames; // Branch names from GetBranchList call
+		Array1D_int CompCtrls; // Branch names from GetBranchList call
+		Array1D_string InletNodeNames; // Node names from GetBranchData call
+		Array1D_string OutletNodeNames; // Node names from GetBranchData call
+		Array1D_int InletNodeNumbers; // Node numbers from GetBranchData call
+		Array1D_int OutletNodeNumbers; // Node numbers from GetBranchData call
+		Array1D_bool SplitOutBranch;
+		Array1D_bool MixerInBranch;
+		bool InitializeLoopsErrorsFound( false );
+		bool SupplyEnvrnFlag( true );
+		bool MySetPointCheckFlag( true );
+		Array1D_bool PlantLoopSetPointInitFlag;
+		bool MyEnvrnFlag( true );
+		int OtherLoopCallingIndex( 0 );
+		int OtherLoopDemandSideCallingIndex( 0 );
+		int NewOtherDemandSideCallingIndex( 0 );
+		int newCallingIndex( 0 );
+	}
+
 	// Functions
 
 	void
@@ -183,6 +213,27 @@ namespace PlantManager {
 		DemandSideInletNode.deallocate();
 		LoopPipe.deallocate();
 		TempLoop = TempLoopData();
+		ErrorsFound = false;
+		GetPlantInputErrorsFound = false;
+		BranchNames.deallocate();
+		CompTypes.deallocate();
+		CompNames.deallocate();
+		CompCtrls.deallocate();
+		InletNodeNames.deallocate();
+		OutletNodeNames.deallocate();
+		InletNodeNumbers.deallocate();
+		OutletNodeNumbers.deallocate();
+		SplitOutBranch.deallocate();
+		MixerInBranch.deallocate();
+		InitializeLoopsErrorsFound = false;
+		SupplyEnvrnFlag = true;
+		MySetPointCheckFlag = true;
+		PlantLoopSetPointInitFlag.deallocate();
+		MyEnvrnFlag = true;
+		OtherLoopCallingIndex = 0;
+		OtherLoopDemandSideCallingIndex = 0;
+		NewOtherDemandSideCallingIndex = 0;
+		newCallingIndex = 0;
 	}
 
 	void
@@ -383,7 +434,6 @@ namespace PlantManager {
 		int CondLoopNum;
 		Array1D_string Alpha( 18 ); // dimension to num of alpha fields in input
 		Array1D< Real64 > Num( 30 ); // dimension to num of numeric data fields in input
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		std::string LoadingScheme;
@@ -788,23 +838,12 @@ namespace PlantManager {
 
 		bool SplitInBranch;
 		bool MixerOutBranch;
-		static bool ErrorsFound( false );
 		bool DemandSideHasPump;
 		bool ASeriesBranchHasPump;
 		bool AParallelBranchHasPump;
 
 		std::string LoopIdentifier;
 
-		static Array1D_string BranchNames; // Branch names from GetBranchList call
-		static Array1D_string CompTypes; // Branch names from GetBranchList call
-		static Array1D_string CompNames; // Branch names from GetBranchList call
-		static Array1D_int CompCtrls; // Branch names from GetBranchList call
-		static Array1D_string InletNodeNames; // Node names from GetBranchData call
-		static Array1D_string OutletNodeNames; // Node names from GetBranchData call
-		static Array1D_int InletNodeNumbers; // Node numbers from GetBranchData call
-		static Array1D_int OutletNodeNumbers; // Node numbers from GetBranchData call
-		static Array1D_bool SplitOutBranch;
-		static Array1D_bool MixerInBranch;
 		bool errFlag;
 		int GeneralEquipType;
 		int TypeOfNum;
@@ -875,7 +914,7 @@ namespace PlantManager {
 					OutletNodeNames.allocate( TempLoop.Branch( BranchNum ).TotalComponents );
 					OutletNodeNumbers.dimension( TempLoop.Branch( BranchNum ).TotalComponents, 0 );
 
-					GetBranchData( TempLoop.Name, BranchNames( BranchNum ), TempLoop.Branch( BranchNum ).PressureCurveType, TempLoop.Branch( BranchNum ).PressureCurveIndex, TempLoop.Branch( BranchNum ).TotalComponents, CompTypes, CompNames, InletNodeNames, InletNodeNumbers, OutletNodeNames, OutletNodeNumbers, ErrorsFound );
+					GetBranchData( TempLoop.Name, BranchNames( BranchNum ), TempLoop.Branch( BranchNum ).PressureCurveType, TempLoop.Branch( BranchNum ).PressureCurveIndex, TempLoop.Branch( BranchNum ).TotalComponents, CompTypes, CompNames, InletNodeNames, InletNodeNumbers, OutletNodeNames, OutletNodeNumbers, GetPlantInputErrorsFound );
 
 					TempLoop.Branch( BranchNum ).Comp.allocate( TempLoop.Branch( BranchNum ).TotalComponents );
 
@@ -1396,7 +1435,7 @@ namespace PlantManager {
 				if ( ASeriesBranchHasPump && AParallelBranchHasPump ) {
 					ShowSevereError( "Current version does not support Loop pumps and branch pumps together" );
 					ShowContinueError( "Occurs in loop " + TempLoop.Name );
-					ErrorsFound = true;
+					GetPlantInputErrorsFound = true;
 				}
 
 				// Obtain the Splitter and Mixer information
@@ -1407,11 +1446,11 @@ namespace PlantManager {
 					errFlag = false;
 					GetNumSplitterMixerInConntrList( TempLoop.Name, TempLoop.ConnectList, NumofSplitters, NumofMixers, errFlag );
 					if ( errFlag ) {
-						ErrorsFound = true;
+						GetPlantInputErrorsFound = true;
 					}
 					if ( NumofSplitters != NumofMixers ) {
 						ShowSevereError( "GetPlantInput: Loop Name=" + TempLoop.Name + ", ConnectorList=" + TempLoop.ConnectList + ", unequal number of splitters and mixers" );
-						ErrorsFound = true;
+						GetPlantInputErrorsFound = true;
 					}
 				}
 
@@ -1427,7 +1466,7 @@ namespace PlantManager {
 					TempLoop.MixerExists = false;
 				}
 
-				if ( ErrorsFound ) {
+				if ( GetPlantInputErrorsFound ) {
 					ShowFatalError( "GetPlantInput: Previous Severe errors cause termination." );
 				}
 
@@ -1439,7 +1478,7 @@ namespace PlantManager {
 					if ( SplitNum > NumofSplitters ) break;
 					OutletNodeNames.allocate( MaxNumAlphas );
 					OutletNodeNumbers.allocate( MaxNumAlphas );
-					GetLoopSplitter( TempLoop.Name, TempLoop.ConnectList, TempLoop.Splitter( SplitNum ).Name, TempLoop.Splitter( SplitNum ).Exists, TempLoop.Splitter( SplitNum ).NodeNameIn, TempLoop.Splitter( SplitNum ).NodeNumIn, TempLoop.Splitter( SplitNum ).TotalOutletNodes, OutletNodeNames, OutletNodeNumbers, ErrorsFound, ConnNum, SplitNum );
+					GetLoopSplitter( TempLoop.Name, TempLoop.ConnectList, TempLoop.Splitter( SplitNum ).Name, TempLoop.Splitter( SplitNum ).Exists, TempLoop.Splitter( SplitNum ).NodeNameIn, TempLoop.Splitter( SplitNum ).NodeNumIn, TempLoop.Splitter( SplitNum ).TotalOutletNodes, OutletNodeNames, OutletNodeNumbers, GetPlantInputErrorsFound, ConnNum, SplitNum );
 
 					if ( SplitNum == 1 ) {
 						OutletNodeNames.deallocate();
@@ -1463,7 +1502,7 @@ namespace PlantManager {
 							ShowSevereError( "Splitter Inlet Branch not found, Splitter=" + TempLoop.Splitter( SplitNum - 1 ).Name );
 							ShowContinueError( "Splitter Branch Inlet name=" + TempLoop.Splitter( SplitNum - 1 ).NodeNameIn );
 							ShowContinueError( "In Loop=" + TempLoop.Name );
-							ErrorsFound = true;
+							GetPlantInputErrorsFound = true;
 						}
 
 						TempLoop.Splitter( SplitNum - 1 ).NodeNameOut.allocate( TempLoop.Splitter( SplitNum - 1 ).TotalOutletNodes );
@@ -1493,7 +1532,7 @@ namespace PlantManager {
 							ShowContinueError( "In Loop=" + TempLoop.Name );
 							ShowContinueError( "Loop BranchList=" + TempLoop.BranchList );
 							ShowContinueError( "Loop ConnectorList=" + TempLoop.ConnectList );
-							ErrorsFound = true;
+							GetPlantInputErrorsFound = true;
 						}
 
 						SplitOutBranch.deallocate();
@@ -1510,7 +1549,7 @@ namespace PlantManager {
 					if ( MixNum > NumofMixers ) break;
 					InletNodeNames.allocate( MaxNumAlphas );
 					InletNodeNumbers.allocate( MaxNumAlphas );
-					GetLoopMixer( TempLoop.Name, TempLoop.ConnectList, TempLoop.Mixer( MixNum ).Name, TempLoop.Mixer( MixNum ).Exists, TempLoop.Mixer( MixNum ).NodeNameOut, TempLoop.Mixer( MixNum ).NodeNumOut, TempLoop.Mixer( MixNum ).TotalInletNodes, InletNodeNames, InletNodeNumbers, ErrorsFound, ConnNum, MixNum );
+					GetLoopMixer( TempLoop.Name, TempLoop.ConnectList, TempLoop.Mixer( MixNum ).Name, TempLoop.Mixer( MixNum ).Exists, TempLoop.Mixer( MixNum ).NodeNameOut, TempLoop.Mixer( MixNum ).NodeNumOut, TempLoop.Mixer( MixNum ).TotalInletNodes, InletNodeNames, InletNodeNumbers, GetPlantInputErrorsFound, ConnNum, MixNum );
 
 					if ( MixNum == 1 ) {
 						InletNodeNames.deallocate();
@@ -1530,7 +1569,7 @@ namespace PlantManager {
 						}
 						if ( ! MixerOutBranch ) {
 							ShowSevereError( "Mixer Outlet Branch not found, Mixer=" + TempLoop.Mixer( MixNum - 1 ).Name );
-							ErrorsFound = true;
+							GetPlantInputErrorsFound = true;
 						}
 
 						TempLoop.Mixer( MixNum - 1 ).NodeNameIn.allocate( TempLoop.Mixer( MixNum - 1 ).TotalInletNodes );
@@ -1561,7 +1600,7 @@ namespace PlantManager {
 							ShowContinueError( "In Loop=" + TempLoop.Name );
 							ShowContinueError( "Loop BranchList=" + TempLoop.BranchList );
 							ShowContinueError( "Loop ConnectorList=" + TempLoop.ConnectList );
-							ErrorsFound = true;
+							GetPlantInputErrorsFound = true;
 						}
 
 						MixerInBranch.deallocate();
@@ -1642,7 +1681,7 @@ namespace PlantManager {
 				ShowSevereError( "Input Error: a common pipe arrangement was selected but there is no pump for the secondary loop." );
 				ShowContinueError( "Occurs in PlantLoop = " + TempLoop.Name );
 				ShowContinueError( "Add a pump to the demand side of this plant loop." );
-				ErrorsFound = true;
+				GetPlantInputErrorsFound = true;
 			}
 
 		} // ...end of demand side loops DO loop
@@ -1720,7 +1759,7 @@ namespace PlantManager {
 							ShowContinueError( "...on Branch=\"" + PlantLoop( LoopNum ).LoopSide( SupplySide ).Branch( BranchNum ).Name + "\"." );
 							ShowContinueError( "...Equipment type=\"" + this_comp.TypeOf + "\"." );
 							ShowContinueError( "...Equipment name=\"" + this_comp.Name + "\"." );
-							ErrorsFound = true;
+							GetPlantInputErrorsFound = true;
 						}
 					}
 
@@ -1740,7 +1779,7 @@ namespace PlantManager {
 								ShowContinueError( "...on Branch=\"" + PlantLoop( LoopNum ).LoopSide( SupplySide ).Branch( BranchNum ).Name + "\"." );
 								ShowContinueError( "...Equipment type=\"" + this_comp.TypeOf + "\"." );
 								ShowContinueError( "...Equipment name=\"" + this_comp.Name + "\"." );
-								ErrorsFound = true;
+								GetPlantInputErrorsFound = true;
 							}
 						}
 					} else {
@@ -1751,7 +1790,7 @@ namespace PlantManager {
 			}
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetPlantInputErrorsFound ) {
 			ShowFatalError( "GetPlantInput: Errors in getting PlantLoop Input" );
 		}
 
@@ -2144,14 +2183,10 @@ namespace PlantManager {
 
 		Real64 LoopSetPointTemp; // the loop control or setpoint temperature
 
-		static bool ErrorsFound( false );
 		bool FinishSizingFlag;
 
-		static bool SupplyEnvrnFlag( true );
 		//  LOGICAL,SAVE  :: MySizeFlag = .TRUE.
-		static bool MySetPointCheckFlag( true );
 
-		static Array1D_bool PlantLoopSetPointInitFlag;
 
 		int HalfLoopNum;
 		int passNum;
@@ -2416,7 +2451,7 @@ namespace PlantManager {
 		} //
 		if ( ! BeginEnvrnFlag ) SupplyEnvrnFlag = true;
 
-		if ( ErrorsFound ) ShowFatalError( "Preceding errors caused termination" );
+		if ( InitializeLoopsErrorsFound ) ShowFatalError( "Preceding errors caused termination" );
 
 	}
 
@@ -2478,7 +2513,6 @@ namespace PlantManager {
 		int BranchInlet; // branch inlet node number
 		int ComponentInlet; // component inlet node number
 		int ComponentOutlet; // component outlet node number
-		static bool MyEnvrnFlag( true );
 		Real64 LoopMinMassFlowRate; // minimum allowable loop mass flow rate
 		Real64 SteamDensity;
 		Real64 SteamTemp;
@@ -2634,6 +2668,8 @@ namespace PlantManager {
 				e.OutletNodeTemperature = 0.0;
 			}
 
+			Checkpoint::RestorePlantLoops();
+
 			MyEnvrnFlag = false;
 			//*****************************************************************
 			//END OF ENVIRONMENT INITS
@@ -3612,10 +3648,6 @@ namespace PlantManager {
 		int LoopSideNum;
 		int OtherLoopNum;
 		int OtherLoopSideNum;
-		static int OtherLoopCallingIndex( 0 );
-		static int OtherLoopDemandSideCallingIndex( 0 );
-		static int NewOtherDemandSideCallingIndex( 0 );
-		static int newCallingIndex( 0 );
 		bool thisLoopPutsDemandOnAnother;
 		int ConnctNum;
 
@@ -133,6 +133,7 @@ namespace PlantPipingSystemsManager {
 	std::string const ObjName_HorizTrench( "GroundHeatExchanger:HorizontalTrench" );
 	std::string const ObjName_ZoneCoupled_Slab( "Site:GroundDomain:Slab" );
 	std::string const ObjName_ZoneCoupled_Basement( "Site:GroundDomain:Basement" );
+	int const NumFieldCellDirections( 6 ); // Neighbors of a field cell: +X, -X, +Y, -Y, +Z, -Z
 
 	// MODULE INTERFACE DEFINITIONS:
 
@@ -179,8 +180,61 @@ namespace PlantPipingSystemsManager {
 
 	//*********************************************************************************************!
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // First time, input is "gotten"
+		bool SimulateGroundDomainsGetInputFlag( true ); // First time, input is "gotten"
+		bool WriteEIOFlag( true ); // Set to false once eio information is written
+		bool GetPipingSystemsAndGroundDomainsInputErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		Real64 BasementCellFraction( 0.001 ); // the fraction of domain extent to use for the basement cells
+		Real64 Theta_ice;
+		Real64 Theta_liq;
+		Real64 Theta_sat;
+		Real64 rho_ice;
+		Real64 rho_liq;
+		Real64 rhoCp_soil_liq_1;
+		Real64 CP_liq;
+		Real64 CP_ice;
+		Real64 Lat_fus;
+		Real64 Cp_transient;
+		Real64 rhoCP_soil_liq;
+		Real64 rhoCP_soil_transient;
+		Real64 rhoCP_soil_ice;
+	}
+
 	// Functions
 
+	// Clears the global data in PlantPipingSystemsManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NeighborFieldCells.deallocate();
+		NeighborBoundaryCells.deallocate();
+		GetInputFlag = true;
+		SimulateGroundDomainsGetInputFlag = true;
+		WriteEIOFlag = true;
+		GetPipingSystemsAndGroundDomainsInputErrorsFound = false;
+		BasementCellFraction = 0.001;
+		Theta_ice = 0.0;
+		Theta_liq = 0.0;
+		Theta_sat = 0.0;
+		rho_ice = 0.0;
+		rho_liq = 0.0;
+		rhoCp_soil_liq_1 = 0.0;
+		CP_liq = 0.0;
+		CP_ice = 0.0;
+		Lat_fus = 0.0;
+		Cp_transient = 0.0;
+		rhoCP_soil_liq = 0.0;
+		rhoCP_soil_transient = 0.0;
+		rhoCP_soil_ice = 0.0;
+	}
+
 	void
 	CheckIfAnySlabs()
 	{
@@ -295,7 +349,6 @@ namespace PlantPipingSystemsManager {
 		static std::string const RoutineName( "SimPipingSystems" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInputFlag( true ); // First time, input is "gotten"
 		int CircuitNum;
 		int DomainNum;
 
@@ -391,8 +444,6 @@ namespace PlantPipingSystemsManager {
 		static std::string const RoutineName( "InitAndSimGroundDomain" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInputFlag( true ); // First time, input is "gotten"
-		static bool WriteEIOFlag( true ); // Set to false once eio information is written
 
 		static gio::Fmt DomainCellsToEIOHeader( "('! <Domain Name>, Total Number of Domain Cells, Total Number of Ground Surface Cells, Total Number of Insulation Cells')" );
 		static gio::Fmt DomainCellsToEIO( "(A,',',I5',',I5',',I5)" );
@@ -400,9 +451,9 @@ namespace PlantPipingSystemsManager {
 		int DomainNum = 0;
 
 		// Read input if necessary
-		if ( GetInputFlag ) {
+		if ( SimulateGroundDomainsGetInputFlag ) {
 			GetPipingSystemsAndGroundDomainsInput();
-			GetInputFlag = false;
+			SimulateGroundDomainsGetInputFlag = false;
 		}
 
 		for ( DomainNum = 1; DomainNum <= isize( PipingSystemDomains ); ++DomainNum ) {
@@ -533,7 +584,6 @@ namespace PlantPipingSystemsManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		int NumGeneralizedDomains;
 		int NumZoneCoupledDomains;
 		int NumBasements;
@@ -573,19 +623,19 @@ namespace PlantPipingSystemsManager {
 		PipingSystemSegments.allocate( TotalNumSegments );
 
 		// Read in raw inputs, don't try to interpret dependencies yet
-		ReadGeneralDomainInputs( 1, NumGeneralizedDomains, ErrorsFound );
-		ReadPipeCircuitInputs( NumPipeCircuits, ErrorsFound );
-		ReadPipeSegmentInputs( NumPipeSegmentsInInput, ErrorsFound );
-		ReadHorizontalTrenchInputs( NumGeneralizedDomains + 1, NumPipeCircuits + 1, NumPipeSegmentsInInput + 1, NumHorizontalTrenches, ErrorsFound );
+		ReadGeneralDomainInputs( 1, NumGeneralizedDomains, GetPipingSystemsAndGroundDomainsInputErrorsFound );
+		ReadPipeCircuitInputs( NumPipeCircuits, GetPipingSystemsAndGroundDomainsInputErrorsFound );
+		ReadPipeSegmentInputs( NumPipeSegmentsInInput, GetPipingSystemsAndGroundDomainsInputErrorsFound );
+		ReadHorizontalTrenchInputs( NumGeneralizedDomains + 1, NumPipeCircuits + 1, NumPipeSegmentsInInput + 1, NumHorizontalTrenches, GetPipingSystemsAndGroundDomainsInputErrorsFound );
 
 		// This is heavily dependent on the order of the domains in the main array.
-		ReadZoneCoupledDomainInputs( NumGeneralizedDomains + NumHorizontalTrenches + 1, NumZoneCoupledDomains, ErrorsFound );
+		ReadZoneCoupledDomainInputs( NumGeneralizedDomains + NumHorizontalTrenches + 1, NumZoneCoupledDomains, GetPipingSystemsAndGroundDomainsInputErrorsFound );
 
 		// This is heavily dependent on the order of the domains in the main array.
-		ReadBasementInputs( NumGeneralizedDomains + NumHorizontalTrenches + NumZoneCoupledDomains + 1, NumBasements, ErrorsFound );
+		ReadBasementInputs( NumGeneralizedDomains + NumHorizontalTrenches + NumZoneCoupledDomains + 1, NumBasements, GetPipingSystemsAndGroundDomainsInputErrorsFound );
 
 		// Report errors that are purely input problems
-		if ( ErrorsFound ) ShowFatalError( RoutineName + ": Preceding input errors cause program termination." );
+		if ( GetPipingSystemsAndGroundDomainsInputErrorsFound ) ShowFatalError( RoutineName + ": Preceding input errors cause program termination." );
 
 		// Setup output variables
 		SetupPipingSystemOutputVariables( TotalNumSegments, TotalNumCircuits );
@@ -604,7 +654,7 @@ namespace PlantPipingSystemsManager {
 				} else {
 					ShowSevereError( RoutineName + ": Could not match a pipe segment for: " + ObjName_Circuit + '=' + PipingSystemCircuits( CircuitCtr ).Name );
 					ShowContinueError( RoutineName + ": Looking for: " + ObjName_Segment + '=' + ThisSegmentName );
-					ErrorsFound = true;
+					GetPipingSystemsAndGroundDomainsInputErrorsFound = true;
 				}
 
 			} // Segment loop
@@ -666,7 +716,7 @@ namespace PlantPipingSystemsManager {
 		} // domain loop
 
 		// If we encountered any other errors that we couldn't handle separately than stop now
-		if ( ErrorsFound ) {
+		if ( GetPipingSystemsAndGroundDomainsInputErrorsFound ) {
 			ShowFatalError( RoutineName + ':' + ObjName_ug_GeneralDomain + ": Errors found in input." );
 		}
 
@@ -4278,7 +4328,6 @@ namespace PlantPipingSystemsManager {
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		static Real64 BasementCellFraction( 0.001 ); // the fraction of domain extent to use for the basement cells
 		// actual dimension shouldn't matter for calculation purposes
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
@@ -6225,6 +6274,10 @@ namespace PlantPipingSystemsManager {
 			// Always do start of time step inits
 			DoStartOfTimeStepInitializations( DomainNum, CircuitNum );
 
+			// The field cell coefficients depend on the time step size and the cell heat capacities
+			if ( ! PipingSystemDomains( DomainNum ).FieldSolver.IsSetUp ) SetupFieldCellSolver( DomainNum );
+			UpdateFieldCellSolverCoefficients( DomainNum );
+
 			// Prepare the pipe circuit for calculations, but we'll actually do calcs at the iteration level
 			if ( PipingSystemDomains( DomainNum ).HasAPipeCircuit ) {
 				PreparePipeCircuitSimulation( DomainNum, CircuitNum );
@@ -6267,22 +6320,23 @@ namespace PlantPipingSystemsManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Edwin Lee
 		//       DATE WRITTEN   Summer 2011
-		//       MODIFIED       na
+		//       MODIFIED       Field cells updated from flat arrays in red-black order
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
-		// <description>
+		// Performs one update sweep of the temperature field of the domain.
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// Field, slab and insulation cells, which make up most of the domain, are updated from the
+		// FieldSolver arrays: cells with an even X+Y+Z index sum (red) only have black neighbors and
+		// vice versa, so all cells of one colour can be updated independently of each other.
+		// The remaining boundary and interface cells are then evaluated in place as before.
 
 		// REFERENCES:
 		// na
 
 		// USE STATEMENTS:
 		// na
-		using DataGlobals::TimeStep;
-		using DataEnvironment::CurMnDyHr;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -6290,6 +6344,25 @@ namespace PlantPipingSystemsManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		auto & cells( PipingSystemDomains( DomainNum ).Cells );
+		auto & solver( PipingSystemDomains( DomainNum ).FieldSolver );
+
+		if ( ! solver.IsSetUp ) {
+			SetupFieldCellSolver( DomainNum );
+			UpdateFieldCellSolverCoefficients( DomainNum );
+		}
+
+		for ( int CellNum = 0; CellNum < solver.NumCells; ++CellNum ) {
+			solver.Temperature[ CellNum ] = cells[ CellNum ].MyBase.Temperature;
+		}
+
+		SweepFieldCells( solver, 1, solver.NumRedCells );
+		SweepFieldCells( solver, solver.NumRedCells + 1, solver.NumFieldCells );
+
+		for ( int FieldCellNum = 1; FieldCellNum <= solver.NumFieldCells; ++FieldCellNum ) {
+			int const CellNum( solver.CellIndex( FieldCellNum ) );
+			cells[ CellNum ].MyBase.Temperature = solver.Temperature[ CellNum ];
+		}
+
 		for ( int X = cells.l1(), X_end = cells.u1(); X <= X_end; ++X ) {
 			for ( int Y = cells.l2(), Y_end = cells.u2(); Y <= Y_end; ++Y ) {
 				for ( int Z = cells.l3(), Z_end = cells.u3(); Z <= Z_end; ++Z ) {
@@ -6298,8 +6371,8 @@ namespace PlantPipingSystemsManager {
 					{ auto const SELECT_CASE_var( cell.CellType );
 					if ( SELECT_CASE_var == CellType_Pipe ) {
 						//'pipes are simulated separately
-					} else if ( ( SELECT_CASE_var == CellType_GeneralField ) || ( SELECT_CASE_var == CellType_Slab ) || ( SELECT_CASE_var == CellType_HorizInsulation ) || ( SELECT_CASE_var == CellType_VertInsulation ) ) {
-						cell.MyBase.Temperature = EvaluateFieldCellTemperature( DomainNum, cell );
+					} else if ( IsFieldCellType( SELECT_CASE_var ) ) {
+						//'field cells are updated by the sweeps above
 					} else if ( SELECT_CASE_var == CellType_GroundSurface ) {
 						cell.MyBase.Temperature = EvaluateGroundSurfaceTemperature( DomainNum, cell );
 					} else if ( SELECT_CASE_var == CellType_FarfieldBoundary ) {
@@ -6326,6 +6399,181 @@ namespace PlantPipingSystemsManager {
 
 	//*********************************************************************************************!
 
+	bool
+	IsFieldCellType( int const CellType )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true for the cell types evaluated by EvaluateFieldCellTemperature.
+
+		return ( CellType == CellType_GeneralField ) || ( CellType == CellType_Slab ) || ( CellType == CellType_HorizInsulation ) || ( CellType == CellType_VertInsulation );
+
+	}
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	void
+	SetupFieldCellSolver( int const DomainNum )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Builds the FieldSolver cell lists, neighbor indexes and conduction resistances of the
+		// field, slab and insulation cells of the domain.
+
+		// METHODOLOGY EMPLOYED:
+		// Red cells are listed first, then black cells. The neighbors are stored in the order used by
+		// EvaluateCellNeighborDirections and the resistances come from EvaluateNeighborCharacteristics,
+		// so a sweep reproduces EvaluateFieldCellTemperature term by term. On the domain edge the
+		// neighbor index points to the cell itself and the coefficient is kept at zero.
+		// Resistances only depend on the mesh and the cell conductivities, so this is redone only
+		// after DoOneTimeInitializations.
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int NumFieldCells( 0 );
+		int FieldCellNum( 0 );
+		int NX;
+		int NY;
+		int NZ;
+		Real64 NeighborTemp;
+		Real64 Resistance;
+		Array1D_int const Directions( NumFieldCellDirections, { Direction_PositiveX, Direction_NegativeX, Direction_PositiveY, Direction_NegativeY, Direction_PositiveZ, Direction_NegativeZ } );
+
+		auto const & cells( PipingSystemDomains( DomainNum ).Cells );
+		auto & solver( PipingSystemDomains( DomainNum ).FieldSolver );
+
+		for ( auto const & cell : cells ) {
+			if ( IsFieldCellType( cell.CellType ) ) ++NumFieldCells;
+		}
+
+		solver.NumCells = cells.size();
+		solver.NumFieldCells = NumFieldCells;
+		solver.CellIndex.dimension( NumFieldCells, 0 );
+		solver.NeighborIndex.dimension( NumFieldCellDirections, NumFieldCells, 0 );
+		solver.Resistance.dimension( NumFieldCellDirections, NumFieldCells, 0.0 );
+		solver.Coefficient.dimension( NumFieldCellDirections, NumFieldCells, 0.0 );
+		solver.Denominator.dimension( NumFieldCells, 1.0 );
+		solver.PrevTimeStepTemperature.dimension( NumFieldCells, 0.0 );
+		solver.Temperature.dimension( solver.NumCells, 0.0 );
+
+		for ( int Color = 0; Color <= 1; ++Color ) {
+			for ( int X = cells.l1(), X_end = cells.u1(); X <= X_end; ++X ) {
+				for ( int Y = cells.l2(), Y_end = cells.u2(); Y <= Y_end; ++Y ) {
+					for ( int Z = cells.l3(), Z_end = cells.u3(); Z <= Z_end; ++Z ) {
+						auto const & cell( cells( X, Y, Z ) );
+						if ( ! IsFieldCellType( cell.CellType ) || ( X + Y + Z ) % 2 != Color ) continue;
+
+						++FieldCellNum;
+						int const CellNum( cells.index( X, Y, Z ) );
+						solver.CellIndex( FieldCellNum ) = CellNum;
+
+						for ( int DirNum = 1; DirNum <= NumFieldCellDirections; ++DirNum ) {
+							int const CurDirection( Directions( DirNum ) );
+							bool HasNeighbor( false );
+							if ( CurDirection == Direction_PositiveX ) {
+								HasNeighbor = ( X < cells.u1() );
+							} else if ( CurDirection == Direction_NegativeX ) {
+								HasNeighbor = ( X > 0 );
+							} else if ( CurDirection == Direction_PositiveY ) {
+								HasNeighbor = ( Y < cells.u2() );
+							} else if ( CurDirection == Direction_NegativeY ) {
+								HasNeighbor = ( Y > 0 );
+							} else if ( CurDirection == Direction_PositiveZ ) {
+								HasNeighbor = ( Z < cells.u3() );
+							} else if ( CurDirection == Direction_NegativeZ ) {
+								HasNeighbor = ( Z > 0 );
+							}
+							if ( HasNeighbor ) {
+								EvaluateNeighborCharacteristics( DomainNum, cell, CurDirection, NeighborTemp, Resistance, NX, NY, NZ );
+								solver.NeighborIndex( DirNum, FieldCellNum ) = cells.index( NX, NY, NZ );
+								solver.Resistance( DirNum, FieldCellNum ) = Resistance;
+							} else {
+								solver.NeighborIndex( DirNum, FieldCellNum ) = CellNum;
+								solver.Resistance( DirNum, FieldCellNum ) = 0.0;
+							}
+						}
+					}
+				}
+			}
+			if ( Color == 0 ) solver.NumRedCells = FieldCellNum;
+		}
+
+		solver.IsSetUp = true;
+
+	}
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	void
+	UpdateFieldCellSolverCoefficients( int const DomainNum )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Refreshes the time step dependent FieldSolver data: the Beta / Resistance coefficients,
+		// their sum and the previous time step temperature of each field cell.
+
+		// METHODOLOGY EMPLOYED:
+		// Sums are accumulated in the same order as EvaluateFieldCellTemperature.
+
+		auto const & cells( PipingSystemDomains( DomainNum ).Cells );
+		auto & solver( PipingSystemDomains( DomainNum ).FieldSolver );
+
+		for ( int FieldCellNum = 1; FieldCellNum <= solver.NumFieldCells; ++FieldCellNum ) {
+			int const CellNum( solver.CellIndex( FieldCellNum ) );
+			auto const & cell( cells[ CellNum ] );
+			Real64 const Beta( cell.MyBase.Beta );
+			Real64 Denominator( 1.0 );
+			for ( int DirNum = 1; DirNum <= NumFieldCellDirections; ++DirNum ) {
+				if ( solver.NeighborIndex( DirNum, FieldCellNum ) == CellNum ) continue;
+				Real64 const Coefficient( Beta / solver.Resistance( DirNum, FieldCellNum ) );
+				solver.Coefficient( DirNum, FieldCellNum ) = Coefficient;
+				Denominator += Coefficient;
+			}
+			solver.Denominator( FieldCellNum ) = Denominator;
+			solver.PrevTimeStepTemperature( FieldCellNum ) = cell.MyBase.Temperature_PrevTimeStep;
+		}
+
+	}
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	void
+	SweepFieldCells(
+		FieldCellSolverInfo & Solver,
+		int const FirstFieldCell,
+		int const LastFieldCell
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Updates the temperature of the given range of field cells from the FieldSolver arrays.
+
+		// METHODOLOGY EMPLOYED:
+		// Same implicit cell balance as EvaluateFieldCellTemperature. Within one colour no cell reads
+		// the temperature of another cell of the range, so the loop iterations are independent.
+
+		for ( int FieldCellNum = FirstFieldCell; FieldCellNum <= LastFieldCell; ++FieldCellNum ) {
+			Real64 Numerator( Solver.PrevTimeStepTemperature( FieldCellNum ) );
+			for ( int DirNum = 1; DirNum <= NumFieldCellDirections; ++DirNum ) {
+				Numerator += Solver.Coefficient( DirNum, FieldCellNum ) * Solver.Temperature[ Solver.NeighborIndex( DirNum, FieldCellNum ) ];
+			}
+			Solver.Temperature[ Solver.CellIndex( FieldCellNum ) ] = Numerator / Solver.Denominator( FieldCellNum );
+		}
+
+	}
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
 	Real64
 	EvaluateFieldCellTemperature(
 		int const DomainNum,
@@ -8759,6 +9007,9 @@ namespace PlantPipingSystemsManager {
 				}
 			}
 		}
+
+		// Cell properties may have been reset, so rebuild the field cell arrays on the next iteration loop
+		PipingSystemDomains( DomainNum ).FieldSolver.IsSetUp = false;
 	}
 
 
@@ -9044,19 +9295,6 @@ namespace PlantPipingSystemsManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		//'static variables only calculated once per simulation run
-		static Real64 Theta_ice;
-		static Real64 Theta_liq;
-		static Real64 Theta_sat;
-		static Real64 rho_ice;
-		static Real64 rho_liq;
-		static Real64 rhoCp_soil_liq_1;
-		static Real64 CP_liq;
-		static Real64 CP_ice;
-		static Real64 Lat_fus;
-		static Real64 Cp_transient;
-		static Real64 rhoCP_soil_liq;
-		static Real64 rhoCP_soil_transient;
-		static Real64 rhoCP_soil_ice;
 		// other variables
 		Real64 frzAllIce;
 		Real64 frzIceTrans;
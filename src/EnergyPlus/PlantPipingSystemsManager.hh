@@ -77,6 +77,7 @@ namespace PlantPipingSystemsManager {
 	using DataPlantPipingSystems::CartesianPipeCellInformation;
 	using DataPlantPipingSystems::DirectionNeighbor_Dictionary;
 	using DataPlantPipingSystems::DomainRectangle;
+	using DataPlantPipingSystems::FieldCellSolverInfo;
 	using DataPlantPipingSystems::FluidCellInformation;
 	using DataPlantPipingSystems::GridRegion;
 	using DataPlantPipingSystems::MeshPartition;
@@ -98,6 +99,7 @@ namespace PlantPipingSystemsManager {
 	extern std::string const ObjName_HorizTrench;
 	extern std::string const ObjName_ZoneCoupled_Slab;
 	extern std::string const ObjName_ZoneCoupled_Basement;
+	extern int const NumFieldCellDirections; // Neighbors of a field cell: +X, -X, +Y, -Y, +Z, -Z
 
 	// MODULE INTERFACE DEFINITIONS:
 
@@ -142,6 +144,11 @@ namespace PlantPipingSystemsManager {
 
 	// Functions
 
+	// Clears the global data in PlantPipingSystemsManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	//*********************************************************************************************!
 
 	//*********************************************************************************************!
@@ -845,6 +852,38 @@ namespace PlantPipingSystemsManager {
 
 	//*********************************************************************************************!
 
+	bool
+	IsFieldCellType( int const CellType );
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	void
+	SetupFieldCellSolver( int const DomainNum );
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	void
+	UpdateFieldCellSolverCoefficients( int const DomainNum );
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	void
+	SweepFieldCells(
+		FieldCellSolverInfo & Solver,
+		int const FirstFieldCell,
+		int const LastFieldCell
+	);
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
 	Real64
 	EvaluateFieldCellTemperature(
 		int const DomainNum,
@@ -121,6 +121,12 @@ namespace PlantPressureSystem {
 	static std::string const BlankString;
 	namespace{
 		bool InitPressureDropOneTimeInit( true );
+		Array1D_bool LoopInit;
+		Array1D_bool FullParallelBranchSetFound( 2 );
+		bool CommonPipeErrorEncountered( false );
+		int ErrorCounter( 0 ); // For proper error handling
+		int ZeroKWarningCounter( 0 );
+		int MaxIterWarningCounter( 0 );
 	}
 	// DERIVED TYPE DEFINITIONS:
 	//TYPE, PUBLIC:: PlantPressureCurveData
@@ -159,6 +165,12 @@ namespace PlantPressureSystem {
 	clear_state()
 	{
 		InitPressureDropOneTimeInit = true;
+		LoopInit.deallocate();
+		FullParallelBranchSetFound = Array1D_bool( 2 );
+		CommonPipeErrorEncountered = false;
+		ErrorCounter = 0;
+		ZeroKWarningCounter = 0;
+		MaxIterWarningCounter = 0;
 	}
 
 	void
@@ -281,13 +293,10 @@ namespace PlantPressureSystem {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		//Initialization Variables
 
-		static Array1D_bool LoopInit;
 
 		//Simulation Variables
 		int NumBranches;
 		int BranchPressureTally;
-		static Array1D_bool FullParallelBranchSetFound( 2 );
-		static bool CommonPipeErrorEncountered( false );
 
 		if ( InitPressureDropOneTimeInit ) {
 			//First allocate the initialization array to each plant loop
@@ -519,7 +528,6 @@ namespace PlantPressureSystem {
 		Real64 NodeDensity; // Nodal density {kg/m3}
 		Real64 NodeViscosity; // Nodal viscosity, assuming mu here (dynamic viscosity)
 		Real64 BranchDeltaPress( 0.0 ); // Pressure drop for component, {Pa}
-		static int ErrorCounter( 0 ); // For proper error handling
 
 		//Exit early if need be
 		if ( ! PlantLoop( LoopNum ).LoopSide( LoopSideNum ).Branch( BranchNum ).HasPressureComponents ) {
@@ -1399,8 +1407,6 @@ namespace PlantPressureSystem {
 		Real64 LocalSystemMassFlow;
 		Real64 LoopEffectiveK;
 		bool Converged;
-		static int ZeroKWarningCounter( 0 );
-		static int MaxIterWarningCounter( 0 );
 		Array1D< Real64 > MassFlowIterativeHistory( 3 );
 		Real64 MdotDeltaLatest;
 		Real64 MdotDeltaPrevious;
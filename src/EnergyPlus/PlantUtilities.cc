@@ -129,6 +129,12 @@ namespace PlantUtilities {
 
 		// Object Data
 		Array1D< CriteriaData > CriteriaChecks; // stores criteria information
+		bool OneTimeDiagSetup( true );
+		Array1D_bool NodeErrorMsgIssued;
+		bool NullPlantErrorMsgIssued;
+		bool DidAnythingChange( false ); // set to true if conditions changed
+		bool UpdateComponentHeatRecoverySideDidAnythingChange( false ); // set to true if conditions changed
+		bool UpdateAbsorberChillerComponentGeneratorSideDidAnythingChange( false ); // set to true if conditions changed
 	}
 	// MODULE VARIABLE DECLARATIONS:
 	// na
@@ -140,6 +146,12 @@ namespace PlantUtilities {
 	clear_state()
 	{
 		CriteriaChecks.deallocate();
+		OneTimeDiagSetup = true;
+		NodeErrorMsgIssued.deallocate();
+		NullPlantErrorMsgIssued = false;
+		DidAnythingChange = false;
+		UpdateComponentHeatRecoverySideDidAnythingChange = false;
+		UpdateAbsorberChillerComponentGeneratorSideDidAnythingChange = false;
 	}
 
 	void
@@ -292,10 +304,7 @@ namespace PlantUtilities {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool OneTimeDiagSetup( true );
 		bool EMSLoadOverride;
-		static Array1D_bool NodeErrorMsgIssued;
-		static bool NullPlantErrorMsgIssued;
 		Real64 MdotOldRequest; // initial value of mass flow
 		int CompInletNodeNum;
 		int CompOutletNodeNum;
@@ -1595,7 +1604,6 @@ namespace PlantUtilities {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool DidAnythingChange( false ); // set to true if conditions changed
 		int OtherLoopNum; // local loop pointer for remote connected loop
 		int OtherLoopSide; // local loop side pointer for remote connected loop
 		int ConnectLoopNum; // local do loop counter
@@ -1702,34 +1710,33 @@ namespace PlantUtilities {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool DidAnythingChange( false ); // set to true if conditions changed
 		int OtherLoopNum; // local loop pointer for remote connected loop
 		int OtherLoopSide; // local loop side pointer for remote connected loop
 		//  INTEGER :: CountConnectedLoops ! local total number of connected loops
 		int ConnectLoopNum; // local do loop counter
 		Real64 Cp; // local fluid specific heat
 
-		DidAnythingChange = false;
+		UpdateComponentHeatRecoverySideDidAnythingChange = false;
 
 		//check if any conditions have changed
-		if ( Node( InletNodeNum ).MassFlowRate != ModelMassFlowRate ) DidAnythingChange = true;
+		if ( Node( InletNodeNum ).MassFlowRate != ModelMassFlowRate ) UpdateComponentHeatRecoverySideDidAnythingChange = true;
 
-		if ( Node( OutletNodeNum ).MassFlowRate != ModelMassFlowRate ) DidAnythingChange = true;
+		if ( Node( OutletNodeNum ).MassFlowRate != ModelMassFlowRate ) UpdateComponentHeatRecoverySideDidAnythingChange = true;
 
-		if ( Node( InletNodeNum ).Temp != ModelInletTemp ) DidAnythingChange = true;
+		if ( Node( InletNodeNum ).Temp != ModelInletTemp ) UpdateComponentHeatRecoverySideDidAnythingChange = true;
 
-		if ( Node( OutletNodeNum ).Temp != ModelOutletTemp ) DidAnythingChange = true;
+		if ( Node( OutletNodeNum ).Temp != ModelOutletTemp ) UpdateComponentHeatRecoverySideDidAnythingChange = true;
 
 		// could also check heat rate agains McDeltaT from node data
 
 		if ( ( Node( InletNodeNum ).MassFlowRate == 0.0 ) && ( ModelRecoveryHeatRate > 0.0 ) ) {
 			//no flow but trying to move heat to this loop problem!
 
-			DidAnythingChange = true;
+			UpdateComponentHeatRecoverySideDidAnythingChange = true;
 
 		}
 
-		if ( DidAnythingChange || FirstHVACIteration ) {
+		if ( UpdateComponentHeatRecoverySideDidAnythingChange || FirstHVACIteration ) {
 			// use current mass flow rate and inlet temp from Node and recalculate outlet temp
 			if ( Node( InletNodeNum ).MassFlowRate > MassFlowTolerance ) {
 				// update node outlet conditions
@@ -1807,13 +1814,12 @@ namespace PlantUtilities {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool DidAnythingChange( false ); // set to true if conditions changed
 		int OtherLoopNum; // local loop pointer for remote connected loop
 		int OtherLoopSide; // local loop side pointer for remote connected loop
 		//  INTEGER :: CountConnectedLoops ! local total number of connected loops
 		int ConnectLoopNum; // local do loop counter
 
-		DidAnythingChange = false;
+		UpdateAbsorberChillerComponentGeneratorSideDidAnythingChange = false;
 
 		// check if node heat rate compares well with generator heat rate
 		if ( HeatSourceType == NodeType_Water ) {
@@ -1826,17 +1832,17 @@ namespace PlantUtilities {
 		}
 
 		//check if any conditions have changed
-		if ( Node( InletNodeNum ).MassFlowRate != ModelMassFlowRate ) DidAnythingChange = true;
+		if ( Node( InletNodeNum ).MassFlowRate != ModelMassFlowRate ) UpdateAbsorberChillerComponentGeneratorSideDidAnythingChange = true;
 
 		if ( ( Node( InletNodeNum ).MassFlowRate == 0.0 ) && ( ModelGeneratorHeatRate > 0.0 ) ) {
 
 			// DSU3 TODO also send a request that generator loop be made available, interlock message infrastructure??
 
-			DidAnythingChange = true;
+			UpdateAbsorberChillerComponentGeneratorSideDidAnythingChange = true;
 
 		}
 
-		if ( DidAnythingChange || FirstHVACIteration ) {
+		if ( UpdateAbsorberChillerComponentGeneratorSideDidAnythingChange || FirstHVACIteration ) {
 
 			// set sim flag for this loop
 			PlantLoop( LoopNum ).LoopSide( LoopSide ).SimLoopSideNeeded = true;
@@ -125,8 +125,34 @@ namespace PlantValves {
 	// Object Data
 	Array1D< TemperValveData > TemperValve; // dimension to No. of TemperingValve objects
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // First time, input is "gotten"
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool MyOneTimeFlag( true ); // first pass log
+		Array1D_bool MyTwoTimeFlag; // second pass do input check
+	}
+
 	// Functions
 
+	// Clears the global data in PlantValves.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumTemperingValves = 0;
+		CheckEquipName.deallocate();
+		TemperValve.deallocate();
+		GetInputFlag = true;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		MyTwoTimeFlag.deallocate();
+	}
+
 	void
 	SimPlantValves(
 		int const CompTypeNum,
@@ -173,7 +199,6 @@ namespace PlantValves {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInputFlag( true ); // First time, input is "gotten"
 		int EqNum;
 
 		if ( GetInputFlag ) {
@@ -264,7 +289,6 @@ namespace PlantValves {
 		int NumAlphas; // Number of Alphas for each GetObjectItem call
 		int NumNumbers; // Number of Numbers for each GetObjectItem call
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		std::string CurrentModuleObject; // for ease in renaming.
 
 		CurrentModuleObject = "TemperingValve";
@@ -369,8 +393,6 @@ namespace PlantValves {
 
 		int numLoopSides; // set to SIZE(PlantLoop(i)%LoopSide)
 
-		static bool MyOneTimeFlag( true ); // first pass log
-		static Array1D_bool MyTwoTimeFlag; // second pass do input check
 		bool errFlag;
 
 		{ auto const SELECT_CASE_var( CompTypeNum );
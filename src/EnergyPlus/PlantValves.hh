@@ -137,6 +137,11 @@ namespace PlantValves {
 
 	// Functions
 
+	// Clears the global data in PlantValves.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimPlantValves(
 		int const CompTypeNum,
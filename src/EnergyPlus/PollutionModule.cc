@@ -161,6 +161,15 @@ namespace PollutionModule {
 	// MODULE SUBROUTINES:
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetPollutionFactorInputErrorsFound( false );
+	}
+
 	// Functions
 	// Clears the global data in Pollution module.
 	// Needed for unit tests, should not be normally called.
@@ -171,6 +180,7 @@ namespace PollutionModule {
 		GetInputFlagPollution = true;
 		NumEnvImpactFactors = 0;
 		NumFuelFactors = 0;
+		GetPollutionFactorInputErrorsFound = false;
 	}
 
 	void
@@ -334,7 +344,6 @@ namespace PollutionModule {
 		int NumNums;
 		int Loop;
 		int IOStat;
-		static bool ErrorsFound( false );
 
 		if ( ! GetInputFlagPollution ) return; // Input already gotten
 
@@ -398,71 +407,71 @@ namespace PollutionModule {
 				//Natural Gas Coeffs
 				Pollution.NatGasCoef.Source = rNumericArgs( 2 );
 				if ( ! lAlphaFieldBlanks( 3 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 3 ), cAlphaArgs( 3 ), Pollution.NatGasCoef.SourceSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 3 ), cAlphaArgs( 3 ), Pollution.NatGasCoef.SourceSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.NatGasCoef.CO2 = rNumericArgs( 3 );
 				if ( ! lAlphaFieldBlanks( 4 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 4 ), cAlphaArgs( 4 ), Pollution.NatGasCoef.CO2Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 4 ), cAlphaArgs( 4 ), Pollution.NatGasCoef.CO2Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.NatGasCoef.CO = rNumericArgs( 4 );
 				if ( ! lAlphaFieldBlanks( 5 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 5 ), cAlphaArgs( 5 ), Pollution.NatGasCoef.COSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 5 ), cAlphaArgs( 5 ), Pollution.NatGasCoef.COSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.NatGasCoef.CH4 = rNumericArgs( 5 );
 				if ( ! lAlphaFieldBlanks( 6 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 6 ), cAlphaArgs( 6 ), Pollution.NatGasCoef.CH4Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 6 ), cAlphaArgs( 6 ), Pollution.NatGasCoef.CH4Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.NatGasCoef.NOx = rNumericArgs( 6 );
 				if ( ! lAlphaFieldBlanks( 7 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 7 ), cAlphaArgs( 7 ), Pollution.NatGasCoef.NOxSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 7 ), cAlphaArgs( 7 ), Pollution.NatGasCoef.NOxSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.NatGasCoef.N2O = rNumericArgs( 7 );
 				if ( ! lAlphaFieldBlanks( 8 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 8 ), cAlphaArgs( 8 ), Pollution.NatGasCoef.N2OSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 8 ), cAlphaArgs( 8 ), Pollution.NatGasCoef.N2OSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.NatGasCoef.SO2 = rNumericArgs( 8 );
 				if ( ! lAlphaFieldBlanks( 9 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 9 ), cAlphaArgs( 9 ), Pollution.NatGasCoef.SO2Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 9 ), cAlphaArgs( 9 ), Pollution.NatGasCoef.SO2Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.NatGasCoef.PM = rNumericArgs( 9 );
 				if ( ! lAlphaFieldBlanks( 10 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 10 ), cAlphaArgs( 10 ), Pollution.NatGasCoef.PMSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 10 ), cAlphaArgs( 10 ), Pollution.NatGasCoef.PMSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.NatGasCoef.PM10 = rNumericArgs( 10 );
 				if ( ! lAlphaFieldBlanks( 11 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 11 ), cAlphaArgs( 11 ), Pollution.NatGasCoef.PM10Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 11 ), cAlphaArgs( 11 ), Pollution.NatGasCoef.PM10Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.NatGasCoef.PM25 = rNumericArgs( 11 );
 				if ( ! lAlphaFieldBlanks( 12 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 12 ), cAlphaArgs( 12 ), Pollution.NatGasCoef.PM25Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 12 ), cAlphaArgs( 12 ), Pollution.NatGasCoef.PM25Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.NatGasCoef.NH3 = rNumericArgs( 12 );
 				if ( ! lAlphaFieldBlanks( 13 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 13 ), cAlphaArgs( 13 ), Pollution.NatGasCoef.NH3Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 13 ), cAlphaArgs( 13 ), Pollution.NatGasCoef.NH3Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.NatGasCoef.NMVOC = rNumericArgs( 13 );
 				if ( ! lAlphaFieldBlanks( 14 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 14 ), cAlphaArgs( 14 ), Pollution.NatGasCoef.NMVOCSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 14 ), cAlphaArgs( 14 ), Pollution.NatGasCoef.NMVOCSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.NatGasCoef.Hg = rNumericArgs( 14 );
 				if ( ! lAlphaFieldBlanks( 15 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 15 ), cAlphaArgs( 15 ), Pollution.NatGasCoef.HgSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 15 ), cAlphaArgs( 15 ), Pollution.NatGasCoef.HgSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.NatGasCoef.Pb = rNumericArgs( 15 );
 				if ( ! lAlphaFieldBlanks( 16 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 16 ), cAlphaArgs( 16 ), Pollution.NatGasCoef.PbSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 16 ), cAlphaArgs( 16 ), Pollution.NatGasCoef.PbSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.NatGasCoef.Water = rNumericArgs( 16 );
 				if ( ! lAlphaFieldBlanks( 17 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 17 ), cAlphaArgs( 17 ), Pollution.NatGasCoef.WaterSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 17 ), cAlphaArgs( 17 ), Pollution.NatGasCoef.WaterSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.NatGasCoef.NucHi = rNumericArgs( 17 );
 				if ( ! lAlphaFieldBlanks( 18 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 18 ), cAlphaArgs( 18 ), Pollution.NatGasCoef.NucHiSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 18 ), cAlphaArgs( 18 ), Pollution.NatGasCoef.NucHiSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.NatGasCoef.NucLo = rNumericArgs( 18 );
 				if ( ! lAlphaFieldBlanks( 19 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 19 ), cAlphaArgs( 19 ), Pollution.NatGasCoef.NucLoSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Natural Gas", cAlphaFieldNames( 19 ), cAlphaArgs( 19 ), Pollution.NatGasCoef.NucLoSched, GetPollutionFactorInputErrorsFound );
 				}
 
 			} else if ( ( SELECT_CASE_var == "RESIDUALOIL" ) || ( SELECT_CASE_var == "RESIDUAL OIL" ) || ( SELECT_CASE_var == "FUEL OIL #2" ) || ( SELECT_CASE_var == "FUELOIL#2" ) ) {
@@ -474,71 +483,71 @@ namespace PollutionModule {
 				//FuelOil#2 Coeffs
 				Pollution.FuelOil2Coef.Source = rNumericArgs( 2 );
 				if ( ! lAlphaFieldBlanks( 3 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 3 ), cAlphaArgs( 3 ), Pollution.FuelOil2Coef.SourceSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 3 ), cAlphaArgs( 3 ), Pollution.FuelOil2Coef.SourceSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil2Coef.CO2 = rNumericArgs( 3 );
 				if ( ! lAlphaFieldBlanks( 4 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 4 ), cAlphaArgs( 4 ), Pollution.FuelOil2Coef.CO2Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 4 ), cAlphaArgs( 4 ), Pollution.FuelOil2Coef.CO2Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil2Coef.CO = rNumericArgs( 4 );
 				if ( ! lAlphaFieldBlanks( 5 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 5 ), cAlphaArgs( 5 ), Pollution.FuelOil2Coef.COSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 5 ), cAlphaArgs( 5 ), Pollution.FuelOil2Coef.COSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil2Coef.CH4 = rNumericArgs( 5 );
 				if ( ! lAlphaFieldBlanks( 6 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 6 ), cAlphaArgs( 6 ), Pollution.FuelOil2Coef.CH4Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 6 ), cAlphaArgs( 6 ), Pollution.FuelOil2Coef.CH4Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil2Coef.NOx = rNumericArgs( 6 );
 				if ( ! lAlphaFieldBlanks( 7 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 7 ), cAlphaArgs( 7 ), Pollution.FuelOil2Coef.NOxSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 7 ), cAlphaArgs( 7 ), Pollution.FuelOil2Coef.NOxSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil2Coef.N2O = rNumericArgs( 7 );
 				if ( ! lAlphaFieldBlanks( 8 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 8 ), cAlphaArgs( 8 ), Pollution.FuelOil2Coef.N2OSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 8 ), cAlphaArgs( 8 ), Pollution.FuelOil2Coef.N2OSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil2Coef.SO2 = rNumericArgs( 8 );
 				if ( ! lAlphaFieldBlanks( 9 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 9 ), cAlphaArgs( 9 ), Pollution.FuelOil2Coef.SO2Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 9 ), cAlphaArgs( 9 ), Pollution.FuelOil2Coef.SO2Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil2Coef.PM = rNumericArgs( 9 );
 				if ( ! lAlphaFieldBlanks( 10 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 10 ), cAlphaArgs( 10 ), Pollution.FuelOil2Coef.PMSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 10 ), cAlphaArgs( 10 ), Pollution.FuelOil2Coef.PMSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil2Coef.PM10 = rNumericArgs( 10 );
 				if ( ! lAlphaFieldBlanks( 11 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 11 ), cAlphaArgs( 11 ), Pollution.FuelOil2Coef.PM10Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 11 ), cAlphaArgs( 11 ), Pollution.FuelOil2Coef.PM10Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil2Coef.PM25 = rNumericArgs( 11 );
 				if ( ! lAlphaFieldBlanks( 12 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 12 ), cAlphaArgs( 12 ), Pollution.FuelOil2Coef.PM25Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 12 ), cAlphaArgs( 12 ), Pollution.FuelOil2Coef.PM25Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil2Coef.NH3 = rNumericArgs( 12 );
 				if ( ! lAlphaFieldBlanks( 13 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 13 ), cAlphaArgs( 13 ), Pollution.FuelOil2Coef.NH3Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 13 ), cAlphaArgs( 13 ), Pollution.FuelOil2Coef.NH3Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil2Coef.NMVOC = rNumericArgs( 13 );
 				if ( ! lAlphaFieldBlanks( 14 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 14 ), cAlphaArgs( 14 ), Pollution.FuelOil2Coef.NMVOCSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 14 ), cAlphaArgs( 14 ), Pollution.FuelOil2Coef.NMVOCSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil2Coef.Hg = rNumericArgs( 14 );
 				if ( ! lAlphaFieldBlanks( 15 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 15 ), cAlphaArgs( 15 ), Pollution.FuelOil2Coef.HgSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 15 ), cAlphaArgs( 15 ), Pollution.FuelOil2Coef.HgSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil2Coef.Pb = rNumericArgs( 15 );
 				if ( ! lAlphaFieldBlanks( 16 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 16 ), cAlphaArgs( 16 ), Pollution.FuelOil2Coef.PbSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 16 ), cAlphaArgs( 16 ), Pollution.FuelOil2Coef.PbSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil2Coef.Water = rNumericArgs( 16 );
 				if ( ! lAlphaFieldBlanks( 17 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 17 ), cAlphaArgs( 17 ), Pollution.FuelOil2Coef.WaterSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 17 ), cAlphaArgs( 17 ), Pollution.FuelOil2Coef.WaterSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil2Coef.NucHi = rNumericArgs( 17 );
 				if ( ! lAlphaFieldBlanks( 18 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 18 ), cAlphaArgs( 18 ), Pollution.FuelOil2Coef.NucHiSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 18 ), cAlphaArgs( 18 ), Pollution.FuelOil2Coef.NucHiSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil2Coef.NucLo = rNumericArgs( 18 );
 				if ( ! lAlphaFieldBlanks( 19 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 19 ), cAlphaArgs( 19 ), Pollution.FuelOil2Coef.NucLoSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#2", cAlphaFieldNames( 19 ), cAlphaArgs( 19 ), Pollution.FuelOil2Coef.NucLoSched, GetPollutionFactorInputErrorsFound );
 				}
 
 			} else if ( ( SELECT_CASE_var == "DISTILLATEOIL" ) || ( SELECT_CASE_var == "DISTILLATE OIL" ) || ( SELECT_CASE_var == "FUEL OIL #1" ) || ( SELECT_CASE_var == "FUELOIL#1" ) || ( SELECT_CASE_var == "FUEL OIL" ) ) {
@@ -550,71 +559,71 @@ namespace PollutionModule {
 				//FuelOil#1 Coeffs
 				Pollution.FuelOil1Coef.Source = rNumericArgs( 2 );
 				if ( ! lAlphaFieldBlanks( 3 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 3 ), cAlphaArgs( 3 ), Pollution.FuelOil1Coef.SourceSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 3 ), cAlphaArgs( 3 ), Pollution.FuelOil1Coef.SourceSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil1Coef.CO2 = rNumericArgs( 3 );
 				if ( ! lAlphaFieldBlanks( 4 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 4 ), cAlphaArgs( 4 ), Pollution.FuelOil1Coef.CO2Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 4 ), cAlphaArgs( 4 ), Pollution.FuelOil1Coef.CO2Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil1Coef.CO = rNumericArgs( 4 );
 				if ( ! lAlphaFieldBlanks( 5 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 5 ), cAlphaArgs( 5 ), Pollution.FuelOil1Coef.COSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 5 ), cAlphaArgs( 5 ), Pollution.FuelOil1Coef.COSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil1Coef.CH4 = rNumericArgs( 5 );
 				if ( ! lAlphaFieldBlanks( 6 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 6 ), cAlphaArgs( 6 ), Pollution.FuelOil1Coef.CH4Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 6 ), cAlphaArgs( 6 ), Pollution.FuelOil1Coef.CH4Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil1Coef.NOx = rNumericArgs( 6 );
 				if ( ! lAlphaFieldBlanks( 7 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 7 ), cAlphaArgs( 7 ), Pollution.FuelOil1Coef.NOxSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 7 ), cAlphaArgs( 7 ), Pollution.FuelOil1Coef.NOxSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil1Coef.N2O = rNumericArgs( 7 );
 				if ( ! lAlphaFieldBlanks( 8 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 8 ), cAlphaArgs( 8 ), Pollution.FuelOil1Coef.N2OSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 8 ), cAlphaArgs( 8 ), Pollution.FuelOil1Coef.N2OSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil1Coef.SO2 = rNumericArgs( 8 );
 				if ( ! lAlphaFieldBlanks( 9 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 9 ), cAlphaArgs( 9 ), Pollution.FuelOil1Coef.SO2Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 9 ), cAlphaArgs( 9 ), Pollution.FuelOil1Coef.SO2Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil1Coef.PM = rNumericArgs( 9 );
 				if ( ! lAlphaFieldBlanks( 10 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 10 ), cAlphaArgs( 10 ), Pollution.FuelOil1Coef.PMSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 10 ), cAlphaArgs( 10 ), Pollution.FuelOil1Coef.PMSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil1Coef.PM10 = rNumericArgs( 10 );
 				if ( ! lAlphaFieldBlanks( 11 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 11 ), cAlphaArgs( 11 ), Pollution.FuelOil1Coef.PM10Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 11 ), cAlphaArgs( 11 ), Pollution.FuelOil1Coef.PM10Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil1Coef.PM25 = rNumericArgs( 11 );
 				if ( ! lAlphaFieldBlanks( 12 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 12 ), cAlphaArgs( 12 ), Pollution.FuelOil1Coef.PM25Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 12 ), cAlphaArgs( 12 ), Pollution.FuelOil1Coef.PM25Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil1Coef.NH3 = rNumericArgs( 12 );
 				if ( ! lAlphaFieldBlanks( 13 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 13 ), cAlphaArgs( 13 ), Pollution.FuelOil1Coef.NH3Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 13 ), cAlphaArgs( 13 ), Pollution.FuelOil1Coef.NH3Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil1Coef.NMVOC = rNumericArgs( 13 );
 				if ( ! lAlphaFieldBlanks( 14 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 14 ), cAlphaArgs( 14 ), Pollution.FuelOil1Coef.NMVOCSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 14 ), cAlphaArgs( 14 ), Pollution.FuelOil1Coef.NMVOCSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil1Coef.Hg = rNumericArgs( 14 );
 				if ( ! lAlphaFieldBlanks( 15 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 15 ), cAlphaArgs( 15 ), Pollution.FuelOil1Coef.HgSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 15 ), cAlphaArgs( 15 ), Pollution.FuelOil1Coef.HgSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil1Coef.Pb = rNumericArgs( 15 );
 				if ( ! lAlphaFieldBlanks( 16 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 16 ), cAlphaArgs( 16 ), Pollution.FuelOil1Coef.PbSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 16 ), cAlphaArgs( 16 ), Pollution.FuelOil1Coef.PbSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil1Coef.Water = rNumericArgs( 16 );
 				if ( ! lAlphaFieldBlanks( 17 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 17 ), cAlphaArgs( 17 ), Pollution.FuelOil1Coef.WaterSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 17 ), cAlphaArgs( 17 ), Pollution.FuelOil1Coef.WaterSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil1Coef.NucHi = rNumericArgs( 17 );
 				if ( ! lAlphaFieldBlanks( 18 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 18 ), cAlphaArgs( 18 ), Pollution.FuelOil1Coef.NucHiSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 18 ), cAlphaArgs( 18 ), Pollution.FuelOil1Coef.NucHiSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.FuelOil1Coef.NucLo = rNumericArgs( 18 );
 				if ( ! lAlphaFieldBlanks( 19 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 19 ), cAlphaArgs( 19 ), Pollution.FuelOil1Coef.NucLoSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Fuel Oil#1", cAlphaFieldNames( 19 ), cAlphaArgs( 19 ), Pollution.FuelOil1Coef.NucLoSched, GetPollutionFactorInputErrorsFound );
 				}
 
 			} else if ( SELECT_CASE_var == "COAL" ) {
@@ -626,71 +635,71 @@ namespace PollutionModule {
 				// Coal
 				Pollution.CoalCoef.Source = rNumericArgs( 2 );
 				if ( ! lAlphaFieldBlanks( 3 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 3 ), cAlphaArgs( 3 ), Pollution.CoalCoef.SourceSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 3 ), cAlphaArgs( 3 ), Pollution.CoalCoef.SourceSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.CoalCoef.CO2 = rNumericArgs( 3 );
 				if ( ! lAlphaFieldBlanks( 4 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 4 ), cAlphaArgs( 4 ), Pollution.CoalCoef.CO2Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 4 ), cAlphaArgs( 4 ), Pollution.CoalCoef.CO2Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.CoalCoef.CO = rNumericArgs( 4 );
 				if ( ! lAlphaFieldBlanks( 5 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 5 ), cAlphaArgs( 5 ), Pollution.CoalCoef.COSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 5 ), cAlphaArgs( 5 ), Pollution.CoalCoef.COSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.CoalCoef.CH4 = rNumericArgs( 5 );
 				if ( ! lAlphaFieldBlanks( 6 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 6 ), cAlphaArgs( 6 ), Pollution.CoalCoef.CH4Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 6 ), cAlphaArgs( 6 ), Pollution.CoalCoef.CH4Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.CoalCoef.NOx = rNumericArgs( 6 );
 				if ( ! lAlphaFieldBlanks( 7 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 7 ), cAlphaArgs( 7 ), Pollution.CoalCoef.NOxSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 7 ), cAlphaArgs( 7 ), Pollution.CoalCoef.NOxSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.CoalCoef.N2O = rNumericArgs( 7 );
 				if ( ! lAlphaFieldBlanks( 8 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 8 ), cAlphaArgs( 8 ), Pollution.CoalCoef.N2OSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 8 ), cAlphaArgs( 8 ), Pollution.CoalCoef.N2OSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.CoalCoef.SO2 = rNumericArgs( 8 );
 				if ( ! lAlphaFieldBlanks( 9 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 9 ), cAlphaArgs( 9 ), Pollution.CoalCoef.SO2Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 9 ), cAlphaArgs( 9 ), Pollution.CoalCoef.SO2Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.CoalCoef.PM = rNumericArgs( 9 );
 				if ( ! lAlphaFieldBlanks( 10 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 10 ), cAlphaArgs( 10 ), Pollution.CoalCoef.PMSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 10 ), cAlphaArgs( 10 ), Pollution.CoalCoef.PMSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.CoalCoef.PM10 = rNumericArgs( 10 );
 				if ( ! lAlphaFieldBlanks( 11 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 11 ), cAlphaArgs( 11 ), Pollution.CoalCoef.PM10Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 11 ), cAlphaArgs( 11 ), Pollution.CoalCoef.PM10Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.CoalCoef.PM25 = rNumericArgs( 11 );
 				if ( ! lAlphaFieldBlanks( 12 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 12 ), cAlphaArgs( 12 ), Pollution.CoalCoef.PM25Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 12 ), cAlphaArgs( 12 ), Pollution.CoalCoef.PM25Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.CoalCoef.NH3 = rNumericArgs( 12 );
 				if ( ! lAlphaFieldBlanks( 13 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 13 ), cAlphaArgs( 13 ), Pollution.CoalCoef.NH3Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 13 ), cAlphaArgs( 13 ), Pollution.CoalCoef.NH3Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.CoalCoef.NMVOC = rNumericArgs( 13 );
 				if ( ! lAlphaFieldBlanks( 14 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 14 ), cAlphaArgs( 14 ), Pollution.CoalCoef.NMVOCSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 14 ), cAlphaArgs( 14 ), Pollution.CoalCoef.NMVOCSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.CoalCoef.Hg = rNumericArgs( 14 );
 				if ( ! lAlphaFieldBlanks( 15 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 15 ), cAlphaArgs( 15 ), Pollution.CoalCoef.HgSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 15 ), cAlphaArgs( 15 ), Pollution.CoalCoef.HgSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.CoalCoef.Pb = rNumericArgs( 15 );
 				if ( ! lAlphaFieldBlanks( 16 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 16 ), cAlphaArgs( 16 ), Pollution.CoalCoef.PbSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 16 ), cAlphaArgs( 16 ), Pollution.CoalCoef.PbSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.CoalCoef.Water = rNumericArgs( 16 );
 				if ( ! lAlphaFieldBlanks( 17 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 17 ), cAlphaArgs( 17 ), Pollution.CoalCoef.WaterSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 17 ), cAlphaArgs( 17 ), Pollution.CoalCoef.WaterSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.CoalCoef.NucHi = rNumericArgs( 17 );
 				if ( ! lAlphaFieldBlanks( 18 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 18 ), cAlphaArgs( 18 ), Pollution.CoalCoef.NucHiSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 18 ), cAlphaArgs( 18 ), Pollution.CoalCoef.NucHiSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.CoalCoef.NucLo = rNumericArgs( 18 );
 				if ( ! lAlphaFieldBlanks( 19 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 19 ), cAlphaArgs( 19 ), Pollution.CoalCoef.NucLoSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Coal", cAlphaFieldNames( 19 ), cAlphaArgs( 19 ), Pollution.CoalCoef.NucLoSched, GetPollutionFactorInputErrorsFound );
 				}
 
 			} else if ( ( SELECT_CASE_var == "ELECTRICITY" ) || ( SELECT_CASE_var == "ELECTRIC" ) || ( SELECT_CASE_var == "ELEC" ) ) {
@@ -702,71 +711,71 @@ namespace PollutionModule {
 				//Electric Coeffs
 				Pollution.ElecCoef.Source = rNumericArgs( 2 );
 				if ( ! lAlphaFieldBlanks( 3 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 3 ), cAlphaArgs( 3 ), Pollution.ElecCoef.SourceSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 3 ), cAlphaArgs( 3 ), Pollution.ElecCoef.SourceSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.ElecCoef.CO2 = rNumericArgs( 3 );
 				if ( ! lAlphaFieldBlanks( 4 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 4 ), cAlphaArgs( 4 ), Pollution.ElecCoef.CO2Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 4 ), cAlphaArgs( 4 ), Pollution.ElecCoef.CO2Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.ElecCoef.CO = rNumericArgs( 4 );
 				if ( ! lAlphaFieldBlanks( 5 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 5 ), cAlphaArgs( 5 ), Pollution.ElecCoef.COSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 5 ), cAlphaArgs( 5 ), Pollution.ElecCoef.COSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.ElecCoef.CH4 = rNumericArgs( 5 );
 				if ( ! lAlphaFieldBlanks( 6 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 6 ), cAlphaArgs( 6 ), Pollution.ElecCoef.CH4Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 6 ), cAlphaArgs( 6 ), Pollution.ElecCoef.CH4Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.ElecCoef.NOx = rNumericArgs( 6 );
 				if ( ! lAlphaFieldBlanks( 7 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 7 ), cAlphaArgs( 7 ), Pollution.ElecCoef.NOxSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 7 ), cAlphaArgs( 7 ), Pollution.ElecCoef.NOxSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.ElecCoef.N2O = rNumericArgs( 7 );
 				if ( ! lAlphaFieldBlanks( 8 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 8 ), cAlphaArgs( 8 ), Pollution.ElecCoef.N2OSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 8 ), cAlphaArgs( 8 ), Pollution.ElecCoef.N2OSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.ElecCoef.SO2 = rNumericArgs( 8 );
 				if ( ! lAlphaFieldBlanks( 9 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 9 ), cAlphaArgs( 9 ), Pollution.ElecCoef.SO2Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 9 ), cAlphaArgs( 9 ), Pollution.ElecCoef.SO2Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.ElecCoef.PM = rNumericArgs( 9 );
 				if ( ! lAlphaFieldBlanks( 10 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 10 ), cAlphaArgs( 10 ), Pollution.ElecCoef.PMSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 10 ), cAlphaArgs( 10 ), Pollution.ElecCoef.PMSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.ElecCoef.PM10 = rNumericArgs( 10 );
 				if ( ! lAlphaFieldBlanks( 11 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 11 ), cAlphaArgs( 11 ), Pollution.ElecCoef.PM10Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 11 ), cAlphaArgs( 11 ), Pollution.ElecCoef.PM10Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.ElecCoef.PM25 = rNumericArgs( 11 );
 				if ( ! lAlphaFieldBlanks( 12 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 12 ), cAlphaArgs( 12 ), Pollution.ElecCoef.PM25Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 12 ), cAlphaArgs( 12 ), Pollution.ElecCoef.PM25Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.ElecCoef.NH3 = rNumericArgs( 12 );
 				if ( ! lAlphaFieldBlanks( 13 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 13 ), cAlphaArgs( 13 ), Pollution.ElecCoef.NH3Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 13 ), cAlphaArgs( 13 ), Pollution.ElecCoef.NH3Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.ElecCoef.NMVOC = rNumericArgs( 13 );
 				if ( ! lAlphaFieldBlanks( 14 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 14 ), cAlphaArgs( 14 ), Pollution.ElecCoef.NMVOCSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 14 ), cAlphaArgs( 14 ), Pollution.ElecCoef.NMVOCSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.ElecCoef.Hg = rNumericArgs( 14 );
 				if ( ! lAlphaFieldBlanks( 15 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 15 ), cAlphaArgs( 15 ), Pollution.ElecCoef.HgSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 15 ), cAlphaArgs( 15 ), Pollution.ElecCoef.HgSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.ElecCoef.Pb = rNumericArgs( 15 );
 				if ( ! lAlphaFieldBlanks( 16 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 16 ), cAlphaArgs( 16 ), Pollution.ElecCoef.PbSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 16 ), cAlphaArgs( 16 ), Pollution.ElecCoef.PbSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.ElecCoef.Water = rNumericArgs( 16 );
 				if ( ! lAlphaFieldBlanks( 17 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 17 ), cAlphaArgs( 17 ), Pollution.ElecCoef.WaterSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 17 ), cAlphaArgs( 17 ), Pollution.ElecCoef.WaterSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.ElecCoef.NucHi = rNumericArgs( 17 );
 				if ( ! lAlphaFieldBlanks( 18 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 18 ), cAlphaArgs( 18 ), Pollution.ElecCoef.NucHiSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 18 ), cAlphaArgs( 18 ), Pollution.ElecCoef.NucHiSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.ElecCoef.NucLo = rNumericArgs( 18 );
 				if ( ! lAlphaFieldBlanks( 19 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 19 ), cAlphaArgs( 19 ), Pollution.ElecCoef.NucLoSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Electricity", cAlphaFieldNames( 19 ), cAlphaArgs( 19 ), Pollution.ElecCoef.NucLoSched, GetPollutionFactorInputErrorsFound );
 				}
 
 			} else if ( SELECT_CASE_var == "GASOLINE" ) {
@@ -778,71 +787,71 @@ namespace PollutionModule {
 				//Gasoline Coeffs
 				Pollution.GasolineCoef.Source = rNumericArgs( 2 );
 				if ( ! lAlphaFieldBlanks( 3 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 3 ), cAlphaArgs( 3 ), Pollution.GasolineCoef.SourceSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 3 ), cAlphaArgs( 3 ), Pollution.GasolineCoef.SourceSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.GasolineCoef.CO2 = rNumericArgs( 3 );
 				if ( ! lAlphaFieldBlanks( 4 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 4 ), cAlphaArgs( 4 ), Pollution.GasolineCoef.CO2Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 4 ), cAlphaArgs( 4 ), Pollution.GasolineCoef.CO2Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.GasolineCoef.CO = rNumericArgs( 4 );
 				if ( ! lAlphaFieldBlanks( 5 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 5 ), cAlphaArgs( 5 ), Pollution.GasolineCoef.COSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 5 ), cAlphaArgs( 5 ), Pollution.GasolineCoef.COSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.GasolineCoef.CH4 = rNumericArgs( 5 );
 				if ( ! lAlphaFieldBlanks( 6 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 6 ), cAlphaArgs( 6 ), Pollution.GasolineCoef.CH4Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 6 ), cAlphaArgs( 6 ), Pollution.GasolineCoef.CH4Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.GasolineCoef.NOx = rNumericArgs( 6 );
 				if ( ! lAlphaFieldBlanks( 7 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 7 ), cAlphaArgs( 7 ), Pollution.GasolineCoef.NOxSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 7 ), cAlphaArgs( 7 ), Pollution.GasolineCoef.NOxSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.GasolineCoef.N2O = rNumericArgs( 7 );
 				if ( ! lAlphaFieldBlanks( 8 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 8 ), cAlphaArgs( 8 ), Pollution.GasolineCoef.N2OSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 8 ), cAlphaArgs( 8 ), Pollution.GasolineCoef.N2OSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.GasolineCoef.SO2 = rNumericArgs( 8 );
 				if ( ! lAlphaFieldBlanks( 9 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 9 ), cAlphaArgs( 9 ), Pollution.GasolineCoef.SO2Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 9 ), cAlphaArgs( 9 ), Pollution.GasolineCoef.SO2Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.GasolineCoef.PM = rNumericArgs( 9 );
 				if ( ! lAlphaFieldBlanks( 10 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 10 ), cAlphaArgs( 10 ), Pollution.GasolineCoef.PMSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 10 ), cAlphaArgs( 10 ), Pollution.GasolineCoef.PMSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.GasolineCoef.PM10 = rNumericArgs( 10 );
 				if ( ! lAlphaFieldBlanks( 11 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 11 ), cAlphaArgs( 11 ), Pollution.GasolineCoef.PM10Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 11 ), cAlphaArgs( 11 ), Pollution.GasolineCoef.PM10Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.GasolineCoef.PM25 = rNumericArgs( 11 );
 				if ( ! lAlphaFieldBlanks( 12 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 12 ), cAlphaArgs( 12 ), Pollution.GasolineCoef.PM25Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 12 ), cAlphaArgs( 12 ), Pollution.GasolineCoef.PM25Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.GasolineCoef.NH3 = rNumericArgs( 12 );
 				if ( ! lAlphaFieldBlanks( 13 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 13 ), cAlphaArgs( 13 ), Pollution.GasolineCoef.NH3Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 13 ), cAlphaArgs( 13 ), Pollution.GasolineCoef.NH3Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.GasolineCoef.NMVOC = rNumericArgs( 13 );
 				if ( ! lAlphaFieldBlanks( 14 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 14 ), cAlphaArgs( 14 ), Pollution.GasolineCoef.NMVOCSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 14 ), cAlphaArgs( 14 ), Pollution.GasolineCoef.NMVOCSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.GasolineCoef.Hg = rNumericArgs( 14 );
 				if ( ! lAlphaFieldBlanks( 15 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 15 ), cAlphaArgs( 15 ), Pollution.GasolineCoef.HgSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 15 ), cAlphaArgs( 15 ), Pollution.GasolineCoef.HgSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.GasolineCoef.Pb = rNumericArgs( 15 );
 				if ( ! lAlphaFieldBlanks( 16 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 16 ), cAlphaArgs( 16 ), Pollution.GasolineCoef.PbSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 16 ), cAlphaArgs( 16 ), Pollution.GasolineCoef.PbSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.GasolineCoef.Water = rNumericArgs( 16 );
 				if ( ! lAlphaFieldBlanks( 17 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 17 ), cAlphaArgs( 17 ), Pollution.GasolineCoef.WaterSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 17 ), cAlphaArgs( 17 ), Pollution.GasolineCoef.WaterSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.GasolineCoef.NucHi = rNumericArgs( 17 );
 				if ( ! lAlphaFieldBlanks( 18 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 18 ), cAlphaArgs( 18 ), Pollution.GasolineCoef.NucHiSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 18 ), cAlphaArgs( 18 ), Pollution.GasolineCoef.NucHiSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.GasolineCoef.NucLo = rNumericArgs( 18 );
 				if ( ! lAlphaFieldBlanks( 19 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 19 ), cAlphaArgs( 19 ), Pollution.GasolineCoef.NucLoSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Gasoline", cAlphaFieldNames( 19 ), cAlphaArgs( 19 ), Pollution.GasolineCoef.NucLoSched, GetPollutionFactorInputErrorsFound );
 				}
 
 			} else if ( ( SELECT_CASE_var == "PROPANE" ) || ( SELECT_CASE_var == "LPG" ) || ( SELECT_CASE_var == "PROPANEGAS" ) || ( SELECT_CASE_var == "PROPANE GAS" ) ) {
@@ -854,71 +863,71 @@ namespace PollutionModule {
 				//Propane Coeffs
 				Pollution.PropaneCoef.Source = rNumericArgs( 2 );
 				if ( ! lAlphaFieldBlanks( 3 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 3 ), cAlphaArgs( 3 ), Pollution.PropaneCoef.SourceSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 3 ), cAlphaArgs( 3 ), Pollution.PropaneCoef.SourceSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.PropaneCoef.CO2 = rNumericArgs( 3 );
 				if ( ! lAlphaFieldBlanks( 4 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 4 ), cAlphaArgs( 4 ), Pollution.PropaneCoef.CO2Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 4 ), cAlphaArgs( 4 ), Pollution.PropaneCoef.CO2Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.PropaneCoef.CO = rNumericArgs( 4 );
 				if ( ! lAlphaFieldBlanks( 5 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 5 ), cAlphaArgs( 5 ), Pollution.PropaneCoef.COSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 5 ), cAlphaArgs( 5 ), Pollution.PropaneCoef.COSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.PropaneCoef.CH4 = rNumericArgs( 5 );
 				if ( ! lAlphaFieldBlanks( 6 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 6 ), cAlphaArgs( 6 ), Pollution.PropaneCoef.CH4Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 6 ), cAlphaArgs( 6 ), Pollution.PropaneCoef.CH4Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.PropaneCoef.NOx = rNumericArgs( 6 );
 				if ( ! lAlphaFieldBlanks( 7 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 7 ), cAlphaArgs( 7 ), Pollution.PropaneCoef.NOxSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 7 ), cAlphaArgs( 7 ), Pollution.PropaneCoef.NOxSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.PropaneCoef.N2O = rNumericArgs( 7 );
 				if ( ! lAlphaFieldBlanks( 8 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 8 ), cAlphaArgs( 8 ), Pollution.PropaneCoef.N2OSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 8 ), cAlphaArgs( 8 ), Pollution.PropaneCoef.N2OSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.PropaneCoef.SO2 = rNumericArgs( 8 );
 				if ( ! lAlphaFieldBlanks( 9 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 9 ), cAlphaArgs( 9 ), Pollution.PropaneCoef.SO2Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 9 ), cAlphaArgs( 9 ), Pollution.PropaneCoef.SO2Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.PropaneCoef.PM = rNumericArgs( 9 );
 				if ( ! lAlphaFieldBlanks( 10 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 10 ), cAlphaArgs( 10 ), Pollution.PropaneCoef.PMSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 10 ), cAlphaArgs( 10 ), Pollution.PropaneCoef.PMSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.PropaneCoef.PM10 = rNumericArgs( 10 );
 				if ( ! lAlphaFieldBlanks( 11 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 11 ), cAlphaArgs( 11 ), Pollution.PropaneCoef.PM10Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 11 ), cAlphaArgs( 11 ), Pollution.PropaneCoef.PM10Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.PropaneCoef.PM25 = rNumericArgs( 11 );
 				if ( ! lAlphaFieldBlanks( 12 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 12 ), cAlphaArgs( 12 ), Pollution.PropaneCoef.PM25Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 12 ), cAlphaArgs( 12 ), Pollution.PropaneCoef.PM25Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.PropaneCoef.NH3 = rNumericArgs( 12 );
 				if ( ! lAlphaFieldBlanks( 13 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 13 ), cAlphaArgs( 13 ), Pollution.PropaneCoef.NH3Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 13 ), cAlphaArgs( 13 ), Pollution.PropaneCoef.NH3Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.PropaneCoef.NMVOC = rNumericArgs( 13 );
 				if ( ! lAlphaFieldBlanks( 14 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 14 ), cAlphaArgs( 14 ), Pollution.PropaneCoef.NMVOCSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 14 ), cAlphaArgs( 14 ), Pollution.PropaneCoef.NMVOCSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.PropaneCoef.Hg = rNumericArgs( 14 );
 				if ( ! lAlphaFieldBlanks( 15 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 15 ), cAlphaArgs( 15 ), Pollution.PropaneCoef.HgSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 15 ), cAlphaArgs( 15 ), Pollution.PropaneCoef.HgSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.PropaneCoef.Pb = rNumericArgs( 15 );
 				if ( ! lAlphaFieldBlanks( 16 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 16 ), cAlphaArgs( 16 ), Pollution.PropaneCoef.PbSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 16 ), cAlphaArgs( 16 ), Pollution.PropaneCoef.PbSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.PropaneCoef.Water = rNumericArgs( 16 );
 				if ( ! lAlphaFieldBlanks( 17 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 17 ), cAlphaArgs( 17 ), Pollution.PropaneCoef.WaterSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 17 ), cAlphaArgs( 17 ), Pollution.PropaneCoef.WaterSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.PropaneCoef.NucHi = rNumericArgs( 17 );
 				if ( ! lAlphaFieldBlanks( 18 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 18 ), cAlphaArgs( 18 ), Pollution.PropaneCoef.NucHiSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 18 ), cAlphaArgs( 18 ), Pollution.PropaneCoef.NucHiSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.PropaneCoef.NucLo = rNumericArgs( 18 );
 				if ( ! lAlphaFieldBlanks( 19 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 19 ), cAlphaArgs( 19 ), Pollution.PropaneCoef.NucLoSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Propane", cAlphaFieldNames( 19 ), cAlphaArgs( 19 ), Pollution.PropaneCoef.NucLoSched, GetPollutionFactorInputErrorsFound );
 				}
 
 			} else if ( SELECT_CASE_var == "DIESEL" ) {
@@ -930,71 +939,71 @@ namespace PollutionModule {
 				//Diesel Coeffs
 				Pollution.DieselCoef.Source = rNumericArgs( 2 );
 				if ( ! lAlphaFieldBlanks( 3 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 3 ), cAlphaArgs( 3 ), Pollution.DieselCoef.SourceSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 3 ), cAlphaArgs( 3 ), Pollution.DieselCoef.SourceSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.DieselCoef.CO2 = rNumericArgs( 3 );
 				if ( ! lAlphaFieldBlanks( 4 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 4 ), cAlphaArgs( 4 ), Pollution.DieselCoef.CO2Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 4 ), cAlphaArgs( 4 ), Pollution.DieselCoef.CO2Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.DieselCoef.CO = rNumericArgs( 4 );
 				if ( ! lAlphaFieldBlanks( 5 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 5 ), cAlphaArgs( 5 ), Pollution.DieselCoef.COSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 5 ), cAlphaArgs( 5 ), Pollution.DieselCoef.COSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.DieselCoef.CH4 = rNumericArgs( 5 );
 				if ( ! lAlphaFieldBlanks( 6 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 6 ), cAlphaArgs( 6 ), Pollution.DieselCoef.CH4Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 6 ), cAlphaArgs( 6 ), Pollution.DieselCoef.CH4Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.DieselCoef.NOx = rNumericArgs( 6 );
 				if ( ! lAlphaFieldBlanks( 7 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 7 ), cAlphaArgs( 7 ), Pollution.DieselCoef.NOxSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 7 ), cAlphaArgs( 7 ), Pollution.DieselCoef.NOxSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.DieselCoef.N2O = rNumericArgs( 7 );
 				if ( ! lAlphaFieldBlanks( 8 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 8 ), cAlphaArgs( 8 ), Pollution.DieselCoef.N2OSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 8 ), cAlphaArgs( 8 ), Pollution.DieselCoef.N2OSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.DieselCoef.SO2 = rNumericArgs( 8 );
 				if ( ! lAlphaFieldBlanks( 9 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 9 ), cAlphaArgs( 9 ), Pollution.DieselCoef.SO2Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 9 ), cAlphaArgs( 9 ), Pollution.DieselCoef.SO2Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.DieselCoef.PM = rNumericArgs( 9 );
 				if ( ! lAlphaFieldBlanks( 10 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 10 ), cAlphaArgs( 10 ), Pollution.DieselCoef.PMSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 10 ), cAlphaArgs( 10 ), Pollution.DieselCoef.PMSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.DieselCoef.PM10 = rNumericArgs( 10 );
 				if ( ! lAlphaFieldBlanks( 11 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 11 ), cAlphaArgs( 11 ), Pollution.DieselCoef.PM10Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 11 ), cAlphaArgs( 11 ), Pollution.DieselCoef.PM10Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.DieselCoef.PM25 = rNumericArgs( 11 );
 				if ( ! lAlphaFieldBlanks( 12 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 12 ), cAlphaArgs( 12 ), Pollution.DieselCoef.PM25Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 12 ), cAlphaArgs( 12 ), Pollution.DieselCoef.PM25Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.DieselCoef.NH3 = rNumericArgs( 12 );
 				if ( ! lAlphaFieldBlanks( 13 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 13 ), cAlphaArgs( 13 ), Pollution.DieselCoef.NH3Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 13 ), cAlphaArgs( 13 ), Pollution.DieselCoef.NH3Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.DieselCoef.NMVOC = rNumericArgs( 13 );
 				if ( ! lAlphaFieldBlanks( 14 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 14 ), cAlphaArgs( 14 ), Pollution.DieselCoef.NMVOCSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 14 ), cAlphaArgs( 14 ), Pollution.DieselCoef.NMVOCSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.DieselCoef.Hg = rNumericArgs( 14 );
 				if ( ! lAlphaFieldBlanks( 15 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 15 ), cAlphaArgs( 15 ), Pollution.DieselCoef.HgSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 15 ), cAlphaArgs( 15 ), Pollution.DieselCoef.HgSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.DieselCoef.Pb = rNumericArgs( 15 );
 				if ( ! lAlphaFieldBlanks( 16 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 16 ), cAlphaArgs( 16 ), Pollution.DieselCoef.PbSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 16 ), cAlphaArgs( 16 ), Pollution.DieselCoef.PbSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.DieselCoef.Water = rNumericArgs( 16 );
 				if ( ! lAlphaFieldBlanks( 17 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 17 ), cAlphaArgs( 17 ), Pollution.DieselCoef.WaterSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 17 ), cAlphaArgs( 17 ), Pollution.DieselCoef.WaterSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.DieselCoef.NucHi = rNumericArgs( 17 );
 				if ( ! lAlphaFieldBlanks( 18 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 18 ), cAlphaArgs( 18 ), Pollution.DieselCoef.NucHiSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 18 ), cAlphaArgs( 18 ), Pollution.DieselCoef.NucHiSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.DieselCoef.NucLo = rNumericArgs( 18 );
 				if ( ! lAlphaFieldBlanks( 19 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 19 ), cAlphaArgs( 19 ), Pollution.DieselCoef.NucLoSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "Diesel", cAlphaFieldNames( 19 ), cAlphaArgs( 19 ), Pollution.DieselCoef.NucLoSched, GetPollutionFactorInputErrorsFound );
 				}
 
 			} else if ( SELECT_CASE_var == "OTHERFUEL1" ) {
@@ -1006,71 +1015,71 @@ namespace PollutionModule {
 				//OtherFuel1 Coeffs
 				Pollution.OtherFuel1Coef.Source = rNumericArgs( 2 );
 				if ( ! lAlphaFieldBlanks( 3 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 3 ), cAlphaArgs( 3 ), Pollution.OtherFuel1Coef.SourceSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 3 ), cAlphaArgs( 3 ), Pollution.OtherFuel1Coef.SourceSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel1Coef.CO2 = rNumericArgs( 3 );
 				if ( ! lAlphaFieldBlanks( 4 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 4 ), cAlphaArgs( 4 ), Pollution.OtherFuel1Coef.CO2Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 4 ), cAlphaArgs( 4 ), Pollution.OtherFuel1Coef.CO2Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel1Coef.CO = rNumericArgs( 4 );
 				if ( ! lAlphaFieldBlanks( 5 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 5 ), cAlphaArgs( 5 ), Pollution.OtherFuel1Coef.COSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 5 ), cAlphaArgs( 5 ), Pollution.OtherFuel1Coef.COSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel1Coef.CH4 = rNumericArgs( 5 );
 				if ( ! lAlphaFieldBlanks( 6 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 6 ), cAlphaArgs( 6 ), Pollution.OtherFuel1Coef.CH4Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 6 ), cAlphaArgs( 6 ), Pollution.OtherFuel1Coef.CH4Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel1Coef.NOx = rNumericArgs( 6 );
 				if ( ! lAlphaFieldBlanks( 7 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 7 ), cAlphaArgs( 7 ), Pollution.OtherFuel1Coef.NOxSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 7 ), cAlphaArgs( 7 ), Pollution.OtherFuel1Coef.NOxSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel1Coef.N2O = rNumericArgs( 7 );
 				if ( ! lAlphaFieldBlanks( 8 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 8 ), cAlphaArgs( 8 ), Pollution.OtherFuel1Coef.N2OSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 8 ), cAlphaArgs( 8 ), Pollution.OtherFuel1Coef.N2OSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel1Coef.SO2 = rNumericArgs( 8 );
 				if ( ! lAlphaFieldBlanks( 9 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 9 ), cAlphaArgs( 9 ), Pollution.OtherFuel1Coef.SO2Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 9 ), cAlphaArgs( 9 ), Pollution.OtherFuel1Coef.SO2Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel1Coef.PM = rNumericArgs( 9 );
 				if ( ! lAlphaFieldBlanks( 10 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 10 ), cAlphaArgs( 10 ), Pollution.OtherFuel1Coef.PMSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 10 ), cAlphaArgs( 10 ), Pollution.OtherFuel1Coef.PMSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel1Coef.PM10 = rNumericArgs( 10 );
 				if ( ! lAlphaFieldBlanks( 11 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 11 ), cAlphaArgs( 11 ), Pollution.OtherFuel1Coef.PM10Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 11 ), cAlphaArgs( 11 ), Pollution.OtherFuel1Coef.PM10Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel1Coef.PM25 = rNumericArgs( 11 );
 				if ( ! lAlphaFieldBlanks( 12 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 12 ), cAlphaArgs( 12 ), Pollution.OtherFuel1Coef.PM25Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 12 ), cAlphaArgs( 12 ), Pollution.OtherFuel1Coef.PM25Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel1Coef.NH3 = rNumericArgs( 12 );
 				if ( ! lAlphaFieldBlanks( 13 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 13 ), cAlphaArgs( 13 ), Pollution.OtherFuel1Coef.NH3Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 13 ), cAlphaArgs( 13 ), Pollution.OtherFuel1Coef.NH3Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel1Coef.NMVOC = rNumericArgs( 13 );
 				if ( ! lAlphaFieldBlanks( 14 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 14 ), cAlphaArgs( 14 ), Pollution.OtherFuel1Coef.NMVOCSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 14 ), cAlphaArgs( 14 ), Pollution.OtherFuel1Coef.NMVOCSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel1Coef.Hg = rNumericArgs( 14 );
 				if ( ! lAlphaFieldBlanks( 15 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 15 ), cAlphaArgs( 15 ), Pollution.OtherFuel1Coef.HgSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 15 ), cAlphaArgs( 15 ), Pollution.OtherFuel1Coef.HgSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel1Coef.Pb = rNumericArgs( 15 );
 				if ( ! lAlphaFieldBlanks( 16 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 16 ), cAlphaArgs( 16 ), Pollution.OtherFuel1Coef.PbSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 16 ), cAlphaArgs( 16 ), Pollution.OtherFuel1Coef.PbSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel1Coef.Water = rNumericArgs( 16 );
 				if ( ! lAlphaFieldBlanks( 17 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 17 ), cAlphaArgs( 17 ), Pollution.OtherFuel1Coef.WaterSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 17 ), cAlphaArgs( 17 ), Pollution.OtherFuel1Coef.WaterSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel1Coef.NucHi = rNumericArgs( 17 );
 				if ( ! lAlphaFieldBlanks( 18 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 18 ), cAlphaArgs( 18 ), Pollution.OtherFuel1Coef.NucHiSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 18 ), cAlphaArgs( 18 ), Pollution.OtherFuel1Coef.NucHiSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel1Coef.NucLo = rNumericArgs( 18 );
 				if ( ! lAlphaFieldBlanks( 19 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 19 ), cAlphaArgs( 19 ), Pollution.OtherFuel1Coef.NucLoSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel1", cAlphaFieldNames( 19 ), cAlphaArgs( 19 ), Pollution.OtherFuel1Coef.NucLoSched, GetPollutionFactorInputErrorsFound );
 				}
 
 			} else if ( SELECT_CASE_var == "OTHERFUEL2" ) {
@@ -1082,76 +1091,76 @@ namespace PollutionModule {
 				//OtherFuel2 Coeffs
 				Pollution.OtherFuel2Coef.Source = rNumericArgs( 2 );
 				if ( ! lAlphaFieldBlanks( 3 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 3 ), cAlphaArgs( 3 ), Pollution.OtherFuel2Coef.SourceSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 3 ), cAlphaArgs( 3 ), Pollution.OtherFuel2Coef.SourceSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel2Coef.CO2 = rNumericArgs( 3 );
 				if ( ! lAlphaFieldBlanks( 4 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 4 ), cAlphaArgs( 4 ), Pollution.OtherFuel2Coef.CO2Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 4 ), cAlphaArgs( 4 ), Pollution.OtherFuel2Coef.CO2Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel2Coef.CO = rNumericArgs( 4 );
 				if ( ! lAlphaFieldBlanks( 5 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 5 ), cAlphaArgs( 5 ), Pollution.OtherFuel2Coef.COSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 5 ), cAlphaArgs( 5 ), Pollution.OtherFuel2Coef.COSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel2Coef.CH4 = rNumericArgs( 5 );
 				if ( ! lAlphaFieldBlanks( 6 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 6 ), cAlphaArgs( 6 ), Pollution.OtherFuel2Coef.CH4Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 6 ), cAlphaArgs( 6 ), Pollution.OtherFuel2Coef.CH4Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel2Coef.NOx = rNumericArgs( 6 );
 				if ( ! lAlphaFieldBlanks( 7 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 7 ), cAlphaArgs( 7 ), Pollution.OtherFuel2Coef.NOxSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 7 ), cAlphaArgs( 7 ), Pollution.OtherFuel2Coef.NOxSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel2Coef.N2O = rNumericArgs( 7 );
 				if ( ! lAlphaFieldBlanks( 8 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 8 ), cAlphaArgs( 8 ), Pollution.OtherFuel2Coef.N2OSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 8 ), cAlphaArgs( 8 ), Pollution.OtherFuel2Coef.N2OSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel2Coef.SO2 = rNumericArgs( 8 );
 				if ( ! lAlphaFieldBlanks( 9 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 9 ), cAlphaArgs( 9 ), Pollution.OtherFuel2Coef.SO2Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 9 ), cAlphaArgs( 9 ), Pollution.OtherFuel2Coef.SO2Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel2Coef.PM = rNumericArgs( 9 );
 				if ( ! lAlphaFieldBlanks( 10 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 10 ), cAlphaArgs( 10 ), Pollution.OtherFuel2Coef.PMSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 10 ), cAlphaArgs( 10 ), Pollution.OtherFuel2Coef.PMSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel2Coef.PM10 = rNumericArgs( 10 );
 				if ( ! lAlphaFieldBlanks( 11 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 11 ), cAlphaArgs( 11 ), Pollution.OtherFuel2Coef.PM10Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 11 ), cAlphaArgs( 11 ), Pollution.OtherFuel2Coef.PM10Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel2Coef.PM25 = rNumericArgs( 11 );
 				if ( ! lAlphaFieldBlanks( 12 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 12 ), cAlphaArgs( 12 ), Pollution.OtherFuel2Coef.PM25Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 12 ), cAlphaArgs( 12 ), Pollution.OtherFuel2Coef.PM25Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel2Coef.NH3 = rNumericArgs( 12 );
 				if ( ! lAlphaFieldBlanks( 13 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 13 ), cAlphaArgs( 13 ), Pollution.OtherFuel2Coef.NH3Sched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 13 ), cAlphaArgs( 13 ), Pollution.OtherFuel2Coef.NH3Sched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel2Coef.NMVOC = rNumericArgs( 13 );
 				if ( ! lAlphaFieldBlanks( 14 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 14 ), cAlphaArgs( 14 ), Pollution.OtherFuel2Coef.NMVOCSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 14 ), cAlphaArgs( 14 ), Pollution.OtherFuel2Coef.NMVOCSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel2Coef.Hg = rNumericArgs( 14 );
 				if ( ! lAlphaFieldBlanks( 15 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 15 ), cAlphaArgs( 15 ), Pollution.OtherFuel2Coef.HgSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 15 ), cAlphaArgs( 15 ), Pollution.OtherFuel2Coef.HgSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel2Coef.Pb = rNumericArgs( 15 );
 				if ( ! lAlphaFieldBlanks( 16 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 16 ), cAlphaArgs( 16 ), Pollution.OtherFuel2Coef.PbSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 16 ), cAlphaArgs( 16 ), Pollution.OtherFuel2Coef.PbSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel2Coef.Water = rNumericArgs( 16 );
 				if ( ! lAlphaFieldBlanks( 17 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 17 ), cAlphaArgs( 17 ), Pollution.OtherFuel2Coef.WaterSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 17 ), cAlphaArgs( 17 ), Pollution.OtherFuel2Coef.WaterSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel2Coef.NucHi = rNumericArgs( 17 );
 				if ( ! lAlphaFieldBlanks( 18 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 18 ), cAlphaArgs( 18 ), Pollution.OtherFuel2Coef.NucHiSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 18 ), cAlphaArgs( 18 ), Pollution.OtherFuel2Coef.NucHiSched, GetPollutionFactorInputErrorsFound );
 				}
 				Pollution.OtherFuel2Coef.NucLo = rNumericArgs( 18 );
 				if ( ! lAlphaFieldBlanks( 19 ) ) {
-					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 19 ), cAlphaArgs( 19 ), Pollution.OtherFuel2Coef.NucLoSched, ErrorsFound );
+					CheckFFSchedule( cCurrentModuleObject, "OtherFuel2", cAlphaFieldNames( 19 ), cAlphaArgs( 19 ), Pollution.OtherFuel2Coef.NucLoSched, GetPollutionFactorInputErrorsFound );
 				}
 
 			} else {
 				ShowSevereError( "Illegal FuelType for Pollution Calc Entered=" + FuelType.FuelTypeNames( Loop ) );
-				ErrorsFound = true;
+				GetPollutionFactorInputErrorsFound = true;
 
 			}}
 
@@ -1179,56 +1188,56 @@ namespace PollutionModule {
 			// Check for Electricity
 			if ( ! Pollution.ElecCoef.FuelFactorUsed && ( ( FuelType.ElecFacilityIndex > 0 ) || ( FuelType.ElecProducedFacilityIndex > 0 ) || ( FuelType.PurchCoolFacilityIndex > 0 ) ) ) {
 				ShowSevereError( cCurrentModuleObject + " Not Found or Fuel not specified For Pollution Calculation for ELECTRICITY" );
-				ErrorsFound = true;
+				GetPollutionFactorInputErrorsFound = true;
 			}
 			// Check for Natural Gas
 			if ( ! Pollution.NatGasCoef.FuelFactorUsed && ( ( FuelType.NatGasFacilityIndex > 0 ) || ( FuelType.PurchHeatFacilityIndex > 0 ) || ( FuelType.SteamFacilityIndex > 0 ) ) ) {
 				ShowSevereError( cCurrentModuleObject + " Not Found or Fuel not specified For Pollution Calculation for NATURAL GAS" );
-				ErrorsFound = true;
+				GetPollutionFactorInputErrorsFound = true;
 			}
 			// Check for Residual Oil
 			if ( ! Pollution.FuelOil2Coef.FuelFactorUsed && ( FuelType.FuelOil2FacilityIndex > 0 ) ) {
 				ShowSevereError( cCurrentModuleObject + " Not Found or Fuel not specified For Pollution Calculation for RESIDUAL/FUEL OIL #2" );
-				ErrorsFound = true;
+				GetPollutionFactorInputErrorsFound = true;
 			}
 			// Check for Distillate Oil
 			if ( ! Pollution.FuelOil1Coef.FuelFactorUsed && ( FuelType.FuelOil1FacilityIndex > 0 ) ) {
 				ShowSevereError( cCurrentModuleObject + " Not Found or Fuel not specified For Pollution Calculation for DISTILLATE/FUEL OIL #1" );
-				ErrorsFound = true;
+				GetPollutionFactorInputErrorsFound = true;
 			}
 			// Check for Coal
 			if ( ! Pollution.CoalCoef.FuelFactorUsed && ( FuelType.CoalFacilityIndex > 0 ) ) {
 				ShowSevereError( cCurrentModuleObject + " Not Found or Fuel not specified For Pollution Calculation for COAL" );
-				ErrorsFound = true;
+				GetPollutionFactorInputErrorsFound = true;
 			}
 			// Check for Gasoline
 			if ( ! Pollution.GasolineCoef.FuelFactorUsed && ( FuelType.GasolineFacilityIndex > 0 ) ) {
 				ShowSevereError( cCurrentModuleObject + " Not Found or Fuel not specified For Pollution Calculation for GASOLINE" );
-				ErrorsFound = true;
+				GetPollutionFactorInputErrorsFound = true;
 			}
 			// Check for Propane
 			if ( ! Pollution.PropaneCoef.FuelFactorUsed && ( FuelType.PropaneFacilityIndex > 0 ) ) {
 				ShowSevereError( cCurrentModuleObject + " Not Found or Fuel not specified For Pollution Calculation for PROPANE" );
-				ErrorsFound = true;
+				GetPollutionFactorInputErrorsFound = true;
 			}
 			// Check for Diesel
 			if ( ! Pollution.DieselCoef.FuelFactorUsed && ( FuelType.DieselFacilityIndex > 0 ) ) {
 				ShowSevereError( cCurrentModuleObject + " Not Found or Fuel not specified For Pollution Calculation for DIESEL" );
-				ErrorsFound = true;
+				GetPollutionFactorInputErrorsFound = true;
 			}
 			// Check for OtherFuel1
 			if ( ! Pollution.OtherFuel1Coef.FuelFactorUsed && ( FuelType.OtherFuel1FacilityIndex > 0 ) ) {
 				ShowSevereError( cCurrentModuleObject + " Not Found or Fuel not specified For Pollution Calculation for OTHERFUEL1" );
-				ErrorsFound = true;
+				GetPollutionFactorInputErrorsFound = true;
 			}
 			// Check for OtherFuel2
 			if ( ! Pollution.OtherFuel2Coef.FuelFactorUsed && ( FuelType.OtherFuel2FacilityIndex > 0 ) ) {
 				ShowSevereError( cCurrentModuleObject + " Not Found or Fuel not specified For Pollution Calculation for OTHERFUEL2" );
-				ErrorsFound = true;
+				GetPollutionFactorInputErrorsFound = true;
 			}
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetPollutionFactorInputErrorsFound ) {
 			ShowFatalError( "Errors found in getting Pollution Calculation Reporting Input" );
 		}
 
@@ -170,6 +170,28 @@ namespace PondGroundHeatExchanger {
 	Array1D< PondGroundHeatExchangerData > PondGHE;
 
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false ); // Set to true if errors in input,
+	}
+
+	// Functions
+
+	// Clears the global data in PondGroundHeatExchanger.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumOfPondGHEs = 0;
+		GetInputFlag = true;
+		PondGHE.deallocate();
+		ErrorsFound = false;
+	}
+
 	void PondGroundHeatExchangerData::simulate( const PlantLocation & EP_UNUSED( calledFromLocation ), bool const FirstHVACIteration, Real64 & EP_UNUSED( CurLoad ), bool const EP_UNUSED( RunFlag )  ) {
 		this->InitPondGroundHeatExchanger( FirstHVACIteration );
 		this->CalcPondGroundHeatExchanger();
@@ -254,7 +276,6 @@ namespace PondGroundHeatExchanger {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false ); // Set to true if errors in input,
 		// fatal at end of routine
 		int IOStatus; // Used in GetObjectItem
 		int Item; // Item to be "gotten"
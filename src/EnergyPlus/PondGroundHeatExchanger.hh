@@ -227,6 +227,13 @@ namespace PondGroundHeatExchanger {
 	void
 	GetPondGroundHeatExchanger();
 
+	// Functions
+
+	// Clears the global data in PondGroundHeatExchanger.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 } // PondGroundHeatExchanger
 
 } // EnergyPlus
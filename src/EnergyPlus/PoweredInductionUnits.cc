@@ -169,6 +169,51 @@ namespace PoweredInductionUnits {
 	// Object Data
 	Array1D< PowIndUnitData > PIU;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool MyOneTimeFlag( true );
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool MySizeFlag;
+		Array1D_bool MyPlantScanFlag;
+		bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
+		int CoilWaterInletNode( 0 );
+		int CoilWaterOutletNode( 0 );
+		int CoilSteamInletNode( 0 );
+		int CoilSteamOutletNode( 0 );
+		int DummyWaterIndex( 1 );
+	}
+
+	// Functions
+
+	// Clears the global data in PoweredInductionUnits.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		CheckEquipName.deallocate();
+		GetPIUInputFlag = true;
+		NumPIUs = 0;
+		NumSeriesPIUs = 0;
+		NumParallelPIUs = 0;
+		PIU.deallocate();
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		MyEnvrnFlag.deallocate();
+		MySizeFlag.deallocate();
+		MyPlantScanFlag.deallocate();
+		ZoneEquipmentListChecked = false;
+		CoilWaterInletNode = 0;
+		CoilWaterOutletNode = 0;
+		CoilSteamInletNode = 0;
+		CoilSteamOutletNode = 0;
+		DummyWaterIndex = 1;
+	}
+
 	void
 	SimPIU(
 		std::string const & CompName, // name of the PIU
@@ -333,7 +378,6 @@ namespace PoweredInductionUnits {
 		int NumAlphas; // Number of Alpha input fields for each GetObjectItem call
 		int NumNumbers; // Number of Numeric input fields for each GetObjectItem call
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int CtrlZone; // controlled zome do loop index
@@ -672,11 +716,6 @@ namespace PoweredInductionUnits {
 		int HotConNode; // hot water control node number in PIU
 		int OutletNode; // unit air outlet node number
 		Real64 RhoAir; // air density at outside pressure and standard temperature and humidity
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool MySizeFlag;
-		static Array1D_bool MyPlantScanFlag;
-		static bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
 		int Loop; // Loop checking control variable
 		Real64 rho; // local plant fluid density
 		bool errFlag;
@@ -868,14 +907,9 @@ namespace PoweredInductionUnits {
 		Real64 EnthSteamOutWet;
 		Real64 LatentHeatSteam;
 		Real64 SteamDensity;
-		static int CoilWaterInletNode( 0 );
-		static int CoilWaterOutletNode( 0 );
-		static int CoilSteamInletNode( 0 );
-		static int CoilSteamOutletNode( 0 );
 		bool ErrorsFound;
 		Real64 rho;
 		Real64 Cp;
-		static int DummyWaterIndex( 1 );
 		bool IsAutoSize; // Indicator to autosize
 		Real64 MaxPriAirVolFlowDes; // Autosized maximum primary air flow for reporting
 		Real64 MaxPriAirVolFlowUser; // Hardsized maximum primary air flow for reporting
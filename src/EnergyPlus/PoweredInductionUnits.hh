@@ -214,6 +214,11 @@ namespace PoweredInductionUnits {
 
 	// Functions
 
+	// Clears the global data in PoweredInductionUnits.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimPIU(
 		std::string const & CompName, // name of the PIU
@@ -184,6 +184,19 @@ namespace Psychrometrics {
 	Array1D< cached_psat_t > cached_Psat; // DIMENSION(0:psatcache_size)
 #endif
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		Real64 convTol( 0.0001 );
+		Real64 last_Patm( -99999.0 ); // barometric pressure {Pascals}  (last)
+		Real64 last_tBoil( -99999.0 ); // Boiling temperature of water at given pressure (last)
+		Real64 Press_Save( -99999.0 );
+		Real64 tSat_Save( -99999.0 );
+	}
+
 	// Subroutine Specifications for the Module
 
 	// Functions
@@ -204,6 +217,11 @@ namespace Psychrometrics {
 #ifdef EP_cache_PsyPsatFnTemp
 		cached_Psat.deallocate();
 #endif
+		convTol = 0.0001;
+		last_Patm = -99999.0;
+		last_tBoil = -99999.0;
+		Press_Save = -99999.0;
+		tSat_Save = -99999.0;
 	}
 
 	void
@@ -520,7 +538,6 @@ namespace Psychrometrics {
 
 		// FUNCTION PARAMETER DEFINITIONS:
 		int const itmax( 100 ); // Maximum No of Iterations
-		static Real64 convTol( 0.0001 );
 		static std::string const RoutineName( "PsyTwbFnTdbWPb" );
 		static gio::Fmt fmtLD( "*" );
 
@@ -532,8 +549,6 @@ namespace Psychrometrics {
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		Real64 tBoil; // Boiling temperature of water at given pressure
-		static Real64 last_Patm( -99999.0 ); // barometric pressure {Pascals}  (last)
-		static Real64 last_tBoil( -99999.0 ); // Boiling temperature of water at given pressure (last)
 		Real64 newW; // Humidity ratio calculated with wet bulb guess
 		Real64 W; // Humidity ratio entered and corrected as necessary
 		Real64 ResultX; // ResultX is the final Iteration result passed back to the calling routine
@@ -1348,8 +1363,6 @@ Label170: ;
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		bool FlagError; // set when errors should be flagged
-		static Real64 Press_Save( -99999.0 );
-		static Real64 tSat_Save( -99999.0 );
 		Real64 tSat; // Water temperature guess
 		int iter; // Iteration counter
 
@@ -184,6 +184,23 @@ namespace Pumps {
 
 	//*************************************************************************!
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int DummyWaterIndex( 1 );
+		int InitializePumpsDummyWaterIndex( 1 );
+		int SizePumpDummyWaterIndex( 1 );
+		Real64 PumpMassFlowRateMaxPress( 0.0 ); // Maximum mass flow rate associated with maximum pressure limit
+		Real64 PumpMassFlowRateMinPress( 0.0 ); // Minimum mass flow rate associated with minimum pressure limit
+		Real64 RotSpeed_Max( 0.0 ); // Maximum rotaional speed in rps
+		Real64 RotSpeed_Min( 0.0 ); // Minimum rotaional speed in rps
+		Real64 MinPress( 0.0 ); // Minimum pressure
+		Real64 MaxPress( 0.0 ); // Maximum pressure
+	}
+
 	// Functions
 	void
 	clear_state()
@@ -198,6 +215,15 @@ namespace Pumps {
 		ShaftPower= 0.0 ;
 		PumpEquip.deallocate();
 		PumpEquipReport.deallocate();
+		DummyWaterIndex = 1;
+		InitializePumpsDummyWaterIndex = 1;
+		SizePumpDummyWaterIndex = 1;
+		PumpMassFlowRateMaxPress = 0.0;
+		PumpMassFlowRateMinPress = 0.0;
+		RotSpeed_Max = 0.0;
+		RotSpeed_Min = 0.0;
+		MinPress = 0.0;
+		MaxPress = 0.0;
 	}
 
 	void
@@ -379,7 +405,6 @@ namespace Pumps {
 		int NumConstPumpBankSimple;
 		Real64 SteamDensity;
 		Real64 TempWaterDensity;
-		static int DummyWaterIndex( 1 );
 
 		ErrorsFound = false;
 
@@ -1115,7 +1140,6 @@ namespace Pumps {
 		int OutletNode; // pump outlet node number
 		Real64 TotalEffic;
 		Real64 SteamDensity; // Density of working fluid
-		static int DummyWaterIndex( 1 );
 		Real64 TempWaterDensity;
 		bool errFlag;
 		Real64 mdotMax; // local fluid mass flow rate maximum
@@ -1208,7 +1232,7 @@ namespace Pumps {
 		if ( PumpEquip( PumpNum ).PumpInitFlag && BeginEnvrnFlag ) {
 			if ( PumpEquip( PumpNum ).PumpType == Pump_Cond ) {
 
-				TempWaterDensity = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, DummyWaterIndex, RoutineName );
+				TempWaterDensity = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, InitializePumpsDummyWaterIndex, RoutineName );
 				SteamDensity = GetSatDensityRefrig( fluidNameSteam, StartTemp, 1.0, PumpEquip( PumpNum ).FluidIndex, RoutineName );
 				PumpEquip( PumpNum ).NomVolFlowRate = ( PumpEquip( PumpNum ).NomSteamVolFlowRate * SteamDensity ) / TempWaterDensity;
 
@@ -1767,14 +1791,13 @@ namespace Pumps {
 		Real64 PumpSizFac; // pump sizing factor
 		Real64 SteamDensity;
 		Real64 TempWaterDensity;
-		static int DummyWaterIndex( 1 );
 		Real64 DesVolFlowRatePerBranch; // local temporary for split of branch pumps
 
 		// Calculate density at InitConvTemp once here, to remove RhoH2O calls littered throughout
 		if ( PumpEquip( PumpNum ).LoopNum > 0 ) {
 			TempWaterDensity = GetDensityGlycol( PlantLoop( PumpEquip( PumpNum ).LoopNum ).FluidName, DataGlobals::InitConvTemp, PlantLoop( PumpEquip( PumpNum ).LoopNum ).FluidIndex, RoutineName );
 		} else {
-			TempWaterDensity = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, DummyWaterIndex, RoutineName );
+			TempWaterDensity = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, SizePumpDummyWaterIndex, RoutineName );
 		}
 
 		// note: we assume pump impeller efficiency is 78% for autosizing
@@ -1820,7 +1843,7 @@ namespace Pumps {
 					if ( ! PlantLoop( PumpEquip( PumpNum ).LoopNum ).LoopSide( PumpEquip( PumpNum ).LoopSideNum ).BranchPumpsExist ) {
 						// size pump to full flow of plant loop
 						if ( PumpEquip( PumpNum ).PumpType == Pump_Cond ) {
-							TempWaterDensity = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, DummyWaterIndex, RoutineName );
+							TempWaterDensity = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, SizePumpDummyWaterIndex, RoutineName );
 							SteamDensity = GetSatDensityRefrig( fluidNameSteam, StartTemp, 1.0, PumpEquip( PumpNum ).FluidIndex, RoutineNameSizePumps );
 							PumpEquip( PumpNum ).NomSteamVolFlowRate = PlantSizData( PlantSizNum ).DesVolFlowRate * PumpSizFac;
 							PumpEquip( PumpNum ).NomVolFlowRate = PumpEquip( PumpNum ).NomSteamVolFlowRate * SteamDensity / TempWaterDensity;
@@ -1831,7 +1854,7 @@ namespace Pumps {
 						// Distribute sizes evenly across all branch pumps
 						DesVolFlowRatePerBranch = PlantSizData( PlantSizNum ).DesVolFlowRate / PlantLoop( PumpEquip( PumpNum ).LoopNum ).LoopSide( PumpEquip( PumpNum ).LoopSideNum ).TotalPumps;
 						if ( PumpEquip( PumpNum ).PumpType == Pump_Cond ) {
-							TempWaterDensity = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, DummyWaterIndex, RoutineName );
+							TempWaterDensity = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, SizePumpDummyWaterIndex, RoutineName );
 							SteamDensity = GetSatDensityRefrig( fluidNameSteam, StartTemp, 1.0, PumpEquip( PumpNum ).FluidIndex, RoutineNameSizePumps );
 							PumpEquip( PumpNum ).NomSteamVolFlowRate = DesVolFlowRatePerBranch * PumpSizFac;
 							PumpEquip( PumpNum ).NomVolFlowRate = PumpEquip( PumpNum ).NomSteamVolFlowRate * SteamDensity / TempWaterDensity;
@@ -2110,12 +2133,6 @@ namespace Pumps {
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
-		static Real64 PumpMassFlowRateMaxPress( 0.0 ); // Maximum mass flow rate associated with maximum pressure limit
-		static Real64 PumpMassFlowRateMinPress( 0.0 ); // Minimum mass flow rate associated with minimum pressure limit
-		static Real64 RotSpeed_Max( 0.0 ); // Maximum rotaional speed in rps
-		static Real64 RotSpeed_Min( 0.0 ); // Minimum rotaional speed in rps
-		static Real64 MinPress( 0.0 ); // Minimum pressure
-		static Real64 MaxPress( 0.0 ); // Maximum pressure
 
 		RotSpeed_Min = GetCurrentScheduleValue( PumpEquip( PumpNum ).VFD.MinRPMSchedIndex );
 		RotSpeed_Max = GetCurrentScheduleValue( PumpEquip( PumpNum ).VFD.MaxRPMSchedIndex );
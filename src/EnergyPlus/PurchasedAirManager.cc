@@ -210,6 +210,7 @@ namespace PurchasedAirManager {
 		Array1D_bool InitPurchasedAirMySizeFlag;
 		Array1D_bool InitPurchasedAirOneTimeUnitInitsDone; // True if one-time inits for PurchAirNum are completed
 
+		bool ErrorsFound( false ); // If errors detected in input
 	}
 
 
@@ -358,7 +359,6 @@ namespace PurchasedAirManager {
 		int CtrlZone; // zone index
 		int NodeNum; // node index
 		static std::string const RoutineName( "GetPurchasedAir: " ); // include trailing blank space
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool IsOANodeListed; // Flag for OA node name listed in OutdoorAir:Node or Nodelist
@@ -2925,6 +2925,7 @@ namespace PurchasedAirManager {
 		InitPurchasedAirMyEnvrnFlag.deallocate();
 		InitPurchasedAirMySizeFlag.deallocate();
 		InitPurchasedAirOneTimeUnitInitsDone.deallocate(); // True if one-time inits for PurchAirNum are completed
+		ErrorsFound = false;
 	}
 
 } // PurchasedAirManager
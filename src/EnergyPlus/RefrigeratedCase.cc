@@ -388,6 +388,7 @@ namespace RefrigeratedCase {
 	int NumSimulationCases( 0 ); // Number of refrigerated cases in simulation
 	int NumSimulationCaseAndWalkInLists( 0 ); // Total number of CaseAndWalkIn Lists in IDF
 	int NumSimulationWalkIns( 0 ); // Number of walk in coolers in simulation
+	int NumRefrigZoneAirs( 0 ); // Number of zones holding cases or walk-in doors
 	int NumSimulationCompressors( 0 ); // Number of refrigeration compressors in simulation
 	int NumSimulationSubcoolers( 0 ); // Number of refrigeration subcoolers in simulation
 	int NumSimulationMechSubcoolers( 0 ); // Number of mechanical subcoolers in simulation
@@ -496,9 +497,1031 @@ namespace RefrigeratedCase {
 	Array1D< AirChillerSetData > AirChillerSet;
 	Array1D< CoilCreditData > CoilSysCredit;
 	Array1D< CaseWIZoneReportData > CaseWIZoneReport;
+	Array1D< RefrigZoneAirData > RefrigZoneAir;
+	Array1D_int RefrigZoneAirList; // Zones in RefrigZoneAir that hold cases or walk-in doors
+
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool MyOneTimeFlag( true ); // flag to skip first pass on next begin environment flag
+		std::string CurrentModuleObject; // Object type for getting and error messages
+		bool CaseLoads( false ); // Flag to help verify load type with loads served by systems cooled by cascade condensers
+		bool GetRefrigerationInputErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool IsNotOK( false ); // Flag to verify name
+		bool IsBlank( false ); // Flag for blank name
+		bool StartCycle( false ); // Flag for counting defrost cycles
+		int AlphaListNum( 0 ); // Index of Names in Case, Compressor et al Lists
+		int AlphaNum( 0 ); // Used to cycle through input
+		int AlphaStartList( 0 );
+		int AStart( 0 ); // Used to cycle through zones on input for walk in coolers
+		int CascadeLoadNum( 0 ); // counters while associating cascade loads with systems
+		int CascadeLoadIndex( 0 ); // Counters while inputting cascade loads
+		int GetRefrigerationInputCaseID( 0 ); // ID of refrigerated case in rack
+		int CaseIndex( 0 ); // Index of refrigerated case attached to a system
+		int CaseNum( 0 ); // Index of refrigerated case
+		int CaseAndWalkInListNum( 0 ); // ID of refrigerated CaseAndWalkInList
+		int ChillerIndex( 0 );
+		int GetRefrigerationInputCoilID( 0 ); // Index of warehouse coil attached to a system
+		int CoilIndex( 0 ); // Index of warehouse coil attached to a system
+		int CoilNum( 0 ); // Index of warehouse coil
+		int GetRefrigerationInputCompIndex( 0 ); // Index  of refrigeration compressor attached to a system
+		int CompNum( 0 ); // Index of refrigeration compressor
+		int CondID( 0 ); // Condenser ID used when associating condenser as a cascade load
+		int CondIndex( 0 ); // Index  of refrigeration condenser attached to a system
+		int CondNum( 0 ); // Index of refrigeration condenser
+		int DefType( 0 ); // Local value for case defrost type
+		int GCNum( 0 ); // Index of refrigeration gas cooler
+		int HRNum( 0 ); // Counter for hours in day
+		int IOStatus( 0 ); // Used in GetObjectItem
+		int ListNum( 0 ); // Index of Lists of cases, compressors, and subcoolers
+		int LoadCascadeNum( 0 ); // Used to read transfer load list
+		int LoadCount( 0 ); // check for blank case and walkin names in caseand alkinlist
+		int LoadSecondaryNum( 0 ); // Used to read transfer load list
+		int LoadWalkInNum( 0 ); // Used to read CaseAndWalkInList
+		int LoadCaseNum( 0 ); // Used to read CaseAndWalkInList
+		int LoadCoilNum( 0 ); // Used to read CaseAndWalkInList
+		int MaxNumAlphasRack( 0 ); // Maximum number of alphas for rack object
+		int MaxNumAlphasAirChiller( 0 ); // Maximum number of alphas for air chiller
+		int MaxNumAlphasAll( 0 ); // Maximum number of alphas for all objects
+		int MaxNumAlphasSys( 0 ); // Maximum number of alphas for system object
+		int MaxNumAlphasTransSys( 0 ); // Maximum number of alphas for transcritical system object
+		int MaxNumAlphasChillerSet( 0 ); // Maximum number of alphas for chiller set
+		int MaxNumAlphasConda( 0 ); // Maximum number of alphas for air-cooled condenser object
+		int MaxNumAlphasConde( 0 ); // Maximum number of alphas for evap-cooled condenser object
+		int MaxNumAlphasCondw( 0 ); // Maximum number of alphas for water-cooled condenser object
+		int MaxNumAlphasGasCoolera( 0 ); // Maximum number of alphas for air-cooled gas cooler object
+		int MaxNumAlphasComp( 0 ); // Maximum number of alphas for compressor object
+		int MaxNumAlphasCompressorList( 0 ); // Maximum number of alphas for compressor list objects
+		int MaxNumAlphasCase( 0 ); // Maximum number of alphas for case object
+		int MaxNumAlphasCaseAndWalkInList( 0 ); // Maximum number of alphas in CaseAndWalkInList
+		int MaxNumAlphasWalkIn( 0 ); // Maximum number of alphas for walkin object
+		int MaxNumAlphasSecond( 0 ); // Maximum number of alphas for air chiller object
+		int MaxNumNumbersAirChiller( 0 ); // Maximum number of numbers for air chiller object
+		int MaxNumNumbersSecond( 0 ); // Maximum number of numbers for secondary system object
+		int MaxNumNumbersWalkIn( 0 ); // Maximum number of numbers for walkin object
+		int MaxNumNumbersCase( 0 ); // Maximum number of numbers for case object
+		int MaxNumNumbersCaseAndWalkInList( 0 ); // Maximum number of numbers in CaseAndWalkInList
+		int MaxNumNumbersRack( 0 ); // Maximum number of numbers for rack object
+		int MaxNumNumbersAll( 0 ); // Maximum number of numeric inputs for all objects
+		int MaxNumNumbersSys( 0 ); // Maximum number of numbers for system object
+		int MaxNumNumbersTransSys( 0 ); // Maximum number of numbers for transcritical system object
+		int MaxNumNumbersChillerSet( 0 ); // Maximum number of numbers for chiller set object
+		int MaxNumNumbersConda( 0 ); // Maximum number of numbers for air-cooled condenser object
+		int MaxNumNumbersConde( 0 ); // Maximum number of numbers for evap-cooled condenser object
+		int MaxNumNumbersCondw( 0 ); // Maximum number of numbers for water-cooled condenser object
+		int MaxNumNumbersGasCoolera( 0 ); // Maximum number of numbers for air-cooled gas cooler object
+		int MaxNumNumbersComp( 0 ); // Maximum number of numbers for compressor object
+		int MaxNumNumbersCompressorList( 0 ); // Maximum number of numbers
+		int MaxNumArgs( 0 ); // Max number of alphas and numbers (arguments) for rack object
+		int NStart( 0 ); // Used to cycle through zones on input for walk in coolers
+		int NumAlphas( 0 ); // Number of Alphas for each GetObjectItem call
+		int NumCascadeLoad( 0 ); // Number of Cascade Loads on current system
+		int NumCompressorsSys( 0 ); // Number of compressors on current system
+		int NumHiStageCompressorsSys( 0 ); // Number of high-stage compressors on current system
+		int NumCondensers( 0 ); // Counter for condensers in GETInput do loop
+		int NumGasCoolers( 0 ); // Counter for gas coolers in GetInput do loop
+		int NumDefCycles( 0 ); // Number of defrost cycles per day
+		int NumPumps( 0 ); // Number of pumps on a secondary loop
+		int NumCases( 0 ); // Number of refrigerated cases for single system
+		int NumCasesMT( 0 ); // Number of medium temperature cases on a single transcritical system
+		int NumCasesLT( 0 ); // Number of low temperature cases on a single transcritical system
+		int NumCoils( 0 ); // Number of warehouse coils for single system
+		int NumSubcooler( 0 ); // Number of subcoolers on current system
+		int NumNameMatches( 0 ); // Used to check for uniqueness of name for transfer loads
+		int NumNum( 0 ); // Used to cycle through input
+		int NumNumbers( 0 ); // Number of Numbers for each GetObjectItem call
+		int NumCompressorLists( 0 ); // Total number of Compressor Lists in IDF
+		int NumDisplayCases( 0 ); // Counter for refrigerated cases in GetInput do loop
+		int NumSecondary( 0 ); // Number of secondary loops
+		int NumWalkIns( 0 ); // Number of walk ins
+		int NumWalkInsMT( 0 ); // Number of medium temperature walk-ins on a single transcritical system
+		int NumWalkInsLT( 0 ); // Number of low temperature walk-ins on a single transcritical system
+		int NumWIFieldsPerZone( 0 ); // Used to calculate number of zones exposed to each walkin
+		int NumWIFieldsTotal( 0 ); // Used to calculate number of zones exposed to each walkin
+		int NumZones( 0 ); // Used to cycle through zones on input for walk in coolers
+		int NumTotalLoadsOnList( 0 ); // Used to read transfer load and caseandWalkIn lists
+		int NumSecondarysOnList( 0 ); // Used to read transfer load lists
+		int NumCascadeLoadsChecked( 0 ); // Used when checking for consistency of coil loads/time steps
+		int NumCascadeLoadsOnList( 0 ); // Used to read transfer load lists
+		int NumLoad( 0 ); // Used to read transfer loadand caseandWalkIn lists
+		int NumCasesOnList( 0 ); // Used to read caseandWalkIn lists
+		int NumChillersInSet( 0 );
+		int NumCoilsOnList( 0 ); // Used to read caseandWalkIn lists
+		int NumWalkInsOnList( 0 ); // Used to read caseandWalkIn lists
+		int GetRefrigerationInputRackNum( 0 ); // Index of refrigerated display case compressor rack
+		int RefrigIndex( 0 ); // Index used in fluid property routines
+		int RefrigSysNum( 0 ); // Index of refrigeration system
+		int TransRefrigSysNum( 0 ); // Index of transcritical CO2 refrigeration system
+		int SecondaryIndex( 0 ); // Index of secondary loops
+		int SecondaryID( 0 ); // Index of secondary loops
+		int SetID( 0 ); // Index of refrigerated chilller SETS
+		int GetRefrigerationInputSecondaryNum( 0 ); // Index of secondary loops
+		int TransferLoadListNum( 0 ); // Index of TransferLoad lists
+		int SubcoolerNum( 0 ); // Index of subcooler
+		int TSNum( 0 ); // Counter for time steps in hour
+		int WalkInIndex( 0 ); // Index of walk ins
+		int GetRefrigerationInputWalkInID( 0 ); // Index of walk ins
+		int WalkInNum( 0 ); // Index of walk ins
+		int TotFields( 0 ); // Used to calc number of zones on input for walk in coolers
+		int ZoneID( 0 ); // Index to zone
+		int ZoneIndex( 0 ); // Index to zone
+		int GetRefrigerationInputZoneNum( 0 ); // Index to zone
+		Real64 CalcCircRate( 0.0 ); // Calculted circ rate in secondary phase change loop, dimensionless
+		Real64 CalcTotFlowVol( 0.0 ); // Secondary loop flow in phase change liquid overfeed system (m3/s)
+		Real64 CaseHeatGain( 0.0 ); // Case sensible heat gain used for error messages
+		Real64 CapacityAtMaxVolFlow( 0.0 ); // Secondary loop capacity (W)
+		Real64 CpBrineRated( 0.0 ); // specific heat of circ fluid in secondary loop
+		Real64 Capmin( 0.0 ); // min heat rej for heat rej curve for air cooled condenser (W)
+		Real64 Capmax( 0.0 ); // max heat rej for heat rej curve for air cooled condenser (W)
+		Real64 DeltaCap1( 0.0 ); // fraction dif in capacity for input error check
+		Real64 DeltaCap2( 0.0 ); // fraction dif in capacity for input error check
+		Real64 DeltaHPhaseChange( 0.0 ); // Secondary loop enthalpy change in condenser w overfeed system (J/g)
+		Real64 DelTempMin( 0.0 ); // min temperature for heat rej curve for air cooled condenser (C)
+		Real64 DelTempMax( 0.0 ); // max temperature for heat rej curve for air cooled condenser (C)
+		Real64 DensityBrineRated( 0.0 ); // density of circ fluid in secondary loop
+		Real64 DensityPhaseChange( 0.0 ); // Secondary loop density at condensing temperature w overfeed system (g/m3)
+		Real64 DesignSensibleCap( 0.0 ); // Case sensible capacity used for error messages
+		Real64 DiffCircRates( 0.0 ); // Difference between calculated and specified circ rates, fraction
+		Real64 ErrSecondPumpPower( 0.0 ); // Used to check consistency when both head and power input
+		Real64 FlowMassRated( 0.0 ); // Design mass flow rate of circ fluid in secondary loop(kg/s)
+		Real64 GCOutletH( 0.0 ); // Gas cooler outlet enthalpy (J/kg)
+		Real64 NominalSecondaryCapacity( 0.0 ); // Rated Capacity from input data, W
+		Real64 NominalSecondaryRefLoad( 0.0 ); // Load from all connected cases and walkins, W
+		Real64 NominalTotalCascadeLoad( 0.0 ); // Load from all connected cascade condensers, W
+		Real64 NominalTotalCaseCap( 0.0 ); // Total of nominal case capacities, used for rough input check (W)
+		Real64 NominalTotalCoilCap( 0.0 ); // Total of nominal case capacities, used for rough input check (W)
+		Real64 NominalTotalWalkInCap( 0.0 ); // Total of nominal walk-in capacities, used for rough input check (W)
+		Real64 NominalTotalSecondaryCap( 0.0 ); // Total of nominal secondary capacities, used for rough input check (W)
+		Real64 NominalTotalCaseCapMT( 0.0 ); // Total of nominal medium temperature case capacities, used for rough input check (W) (Transcritical CO2)
+		Real64 NominalTotalCaseCapLT( 0.0 ); // Total of nominal low temperature case capacities, used for rough input check (W) (Transcritical CO2)
+		Real64 NominalTotalWalkInCapMT( 0.0 ); // Total of nominal medium temperature walk-in capacities, used for rough input check (W) (Transcritical CO2)
+		Real64 NominalTotalWalkInCapLT( 0.0 ); // Total of nominal low temperature walk-in capacities, used for rough input check (W) (Transcritical CO2)
+		Real64 NominalTotalCoolingCap( 0.0 ); // Total of nominal load capacities, used for rough input check (W)
+		Real64 NominalTotalCompCap( 0.0 ); // Total of nominal compressor capacities, used for rough input check (W)
+		Real64 NominalTotalHiStageCompCap( 0.0 ); // Total of nominal high-stage compressor capacities, used for rough input check (W)
+		Real64 NominalTotalCompCapHP( 0.0 ); // Total of nominal high pressure compressor capacities, used for rough input check (W) (Transcritical CO2)
+		Real64 NominalTotalCompCapLP( 0.0 ); // Total of nominal low pressure compressor capacities, used for rough input check (W) (Transcritical CO2)
+		Real64 NominalCondCap( 0.0 ); // Nominal Condenser capacity, used for rough input check (W)
+		Real64 PCond( 0.0 ); // Condensing Pressure (Pa)
+		Real64 PEvap( 0.0 ); // Evaporating Pressure (Pa)
+		Real64 PumpTotRatedHead( 0.0 ); // Total pump rated head on secondary loop (Pa)
+		Real64 PumpTotRatedFlowVol( 0.0 ); // Rated flow from input pump data, m3/s
+		Real64 Rcase( 0.0 ); // Case thermal resistance used with anti-sweat heater control
+		Real64 RcaseDenom( 0.0 ); // Denominator of case thermal resistance calculation for anti-sweat
+		Real64 SecondaryFlowVolRated( 0.0 ); // Rated flow of secondary fluid, used to calculate capacity (m3/s)
+		Real64 TBrineOutRated( 0.0 ); // Rated temperature of circ fluid LEAVING heat exchanger,C
+		Real64 TBrineInRated( 0.0 ); // Rated temperature of circ fluid going INTO heat exchanger, C
+		Real64 TBrineAverage( 0.0 ); // Rated average of inlet and outlet temps, used for property look up, C
+		Real64 TempRAFraction( 0.0 ); // Temporary sum of Return Air fraction per zone for reporting
+		Real64 TestDelta( 0.0 ); // Used to compare secondary loop rated capacity to calculated capacity, fraction
+		int SetupReportInputCaseNum( 0 );
+		int SetupReportInputCoilNum( 0 );
+		int SecondNum( 0 );
+		int SetupReportInputWalkInNum( 0 );
+		int SetupReportInputRackNum( 0 );
+		int SetupReportInputRefrigSysNum( 0 );
+		int SetupReportInputCompNum( 0 );
+		int SetupReportInputCompIndex( 0 );
+		int SetupReportInputCondNum( 0 );
+		int SetupReportInputGCNum( 0 );
+		int SubcoolNum( 0 );
+		int SetupReportInputZoneID( 0 );
+		std::string Walkin_and_zone_name; // concat name for walk-in/zone credit reporting
+		bool MyBeginEnvrnFlag( true );
+		int InitRefrigerationSystemID( 0 );
+		int InitRefrigerationCaseID( 0 );
+		int InitRefrigerationWalkInID( 0 );
+		int InitRefrigerationCoilID( 0 );
+		int ICond( 0 );
+		int IRack( 0 );
+		int SecondID( 0 );
+		Real64 MyCurrentTime( 0.0 ); // Used to determine whether the zone time step is a repetition
+		Real64 MyCurrentTimeSaved( 0.0 ); // Used to determine whether the zone time step is a repetition
+		Real64 MyStepStartTime( 0.0 ); // Used to determine whether the system time step is a repetition
+		Real64 MyStepStartTimeSaved( 0.0 ); // Used to determine whether the system time step is a repetition
+		Real64 TimeStepFraction( 0.0 ); // Used to calculate my current time
+		bool InitRefrigerationPlantConnectionsMyBeginEnvrnFlag( true );
+		bool errFlag( false );
+		int RefCondLoop( 0 ); // loop over Condenser
+		int RefCompRackLoop( 0 ); // loop over RefrigRack
+		Real64 LocalTimeStep( 0.0 ); // TimeStepZone for case/walkin systems, TimeStepSys for coil systems
+		int CoilSetIndex( 0 ); // Index to set of coils in a single zone
+		int CoilSetID( 0 ); // Index to set of coils in a single zone (shared inlet and outlet nodes)
+		int CalcRackSystemCoilIndex( 0 ); // Index to a single air chiller/coil
+		int CalcRackSystemCoilID( 0 ); // Index to a single air chiller/coil
+		Real64 ReportRackSystemLocalTimeStep( 0.0 ); // TimeStepZone for case/walkin systems, TimeStepSys for coil systems
+		int DemandARRID( 0 ); // Index to water tank Demand used for evap condenser on rack
+		int RackTankID( 0 ); // Index to water tank used for evap condenser on rack
+		Real64 CalculateCaseCaseRAFraction( 0.0 ); // Fraction of case credits applied to return air
+		int ActualZoneNum( 0 ); // Index to zone
+		int DefCapCurvePtr( 0 );
+		int DefrostEnergyCurveType( 0 );
+		int DefrostType( 0 );
+		int ZoneNodeNum( 0 ); // Zone node number
+		Real64 CapAvail( 0.0 ); // capacity available to meet current and stored load (W)
+		Real64 CaseCreditFraction( 0.0 ); // Reduction in case credits due to e.g., reduced door openings at night
+		Real64 CaseSenCreditToZone( 0.0 ); // Amount of sensible case credit applied to zone load (W)
+		Real64 CaseLatCreditToZone( 0.0 ); // Amount of latent case credit applied to zone load (W)
+		Real64 CaseSenCreditToHVAC( 0.0 ); // Amount of sensible case credit applied to HVAC RA duct (W)
+		Real64 CaseLatCreditToHVAC( 0.0 ); // Amount of latent case credit applied to HVAC RA duct (W)
+		Real64 CaseSchedule( 0.0 ); // Current value of case operating (availability) schedule
+		Real64 DefrostEnergy( 0.0 ); // Energy form of defrost capacity (J)
+		Real64 DefrostSchedule( 0.0 ); // Display case defrost schedule
+		Real64 DefrostDripDownSchedule( 0.0 ); // Display case drip-down schedule (allows coil to drain after defrost)
+		Real64 DefCapModFrac( 0.0 ); // Defrost capacity modifier curve based on case operating temperature
+		Real64 DefrostRatio( 0.0 ); // ratio of defrost energy at current zone temp/humrat to defrost
+		Real64 DefrostLoad_Actual( 0.0 ); // heat load on case due to defrost (W)
+		Real64 DefrostCap_Actual( 0.0 ); // power used to defrost (W)
+		Real64 DeltaFreezeKgFrost( 0.0 ); // change in frost on coils (kg)
+		Real64 DeltaStockingEnergy( 0.0 ); // Used to keep track of problems if sizing not consistent (J)
+		Real64 DeltaWarmEnvEnergy( 0.0 ); // Used to keep track of problems if sizing not consistent (J)
+		Real64 DesignRatedCap( 0.0 ); // Design rated capacity of display case (W)
+		Real64 DesignDefrostCap( 0.0 ); // Design defrost capacity of display case (W)
+		Real64 DesignLatentCap( 0.0 ); // Design latent capacity of display case (W)
+		Real64 DesignLighting( 0.0 ); // Total design display case lighting power (W)
+		Real64 FrostMeltedKg( 0.0 ); // Frost melted by defrost during a time step (kg)
+		Real64 LatentLoad( 0.0 ); // Latent load placed on case at actual zone conditions (W)
+		Real64 LatentRatio( 0.0 ); // ratio of latent capacity at current zone temp/humrat to
+		Real64 LatentCap_Actual( 0.0 ); // Refrigerated case latent capacity at specific operating conditions
+		Real64 LatentCaseCredit( 0.0 ); // Latent case credit delivered to zone (W)
+		Real64 LatCapModFrac( 0.0 ); // Latent capacity modifier curve based on case operating temperature
+		Real64 LightingSchedule( 0.0 ); // Display case lighting schedule
+		Real64 Length( 0.0 ); // Length of display case (m)
+		Real64 LoadRequested( 0.0 ); // TotalLoad_Actual  + StoredEnergyRate
+		Real64 RatedAmbientRH( 0.0 ); // Local variable for the RH corresponding to case rating conditions
+		Real64 SensibleCaseCredit( 0.0 ); // Sensible case credit delivered to zone (W)
+		Real64 SensibleCap_Actual( 0.0 ); // Refrigerated case sensible capacity at specific operating conditions
+		Real64 SensibleLoadPrime( 0.0 ); // Sensible load due to cond, conv, rad, infil (W)
+		Real64 SensibleLoadAux( 0.0 ); // Sensible load due to heaters, lighting (W)
+		Real64 SensibleLoadTotal( 0.0 ); // Total sensible load on case, may not = capacity applied (W)
+		Real64 StockingSchedule( 0.0 ); // Current value of product stocking schedule (W/m)
+		Real64 StockingLoad( 0.0 ); // Total load due to stocking case product (W)
+		Real64 StoredEnergyRate( 0.0 ); // Rate needed to serve all stored energy during single time step (W)
+		Real64 TotalLoad_Actual( 0.0 ); // total load on case at zone conditions (W)
+		Real64 StartFrostKg( 0.0 ); // frost load at start of time step (kg of ice)
+		Real64 TotalCap_Actual( 0.0 ); // Refrigerated case total capacity at specific operating conditions
+		Real64 TotalLightingLoad( 0.0 ); // Total lighting energy rate (W)
+		Real64 TotalFan( 0.0 ); // Total fan energy rate (W)
+		Real64 TotalAntiSweat( 0.0 ); // Total anti-sweat heater energy rate (W)
+		Real64 TotalLightToCase( 0.0 ); // Lighting energy to case
+		Real64 TotalASHeaterToCase( 0.0 ); // Anti-sweat heater energy to case
+		Real64 TotalLightToZone( 0.0 ); // Lighting energy to zone
+		Real64 TotalASHeaterToZone( 0.0 ); // Anti-sweat heater energy to zone
+		Real64 TCase( 0.0 ); // Display case operating temperature
+		Real64 ZoneRHPercent( 0.0 ); // Zone relative humidity (%)
+		Real64 ZoneDewPoint( 0.0 ); // Zone dew point (C)
+		Real64 ZoneTempFactor( 0.0 ); // used to look at extra sensible load due to excursions in zone T
+		Real64 DeltaT( 0.0 );
+		Real64 InletTemp( 0.0 );
+		Real64 DesVolFlowRate( 0.0 );
+		Real64 MassFlowRate( 0.0 );
+		Real64 MassFlowRateMax( 0.0 );
+		Real64 OutletTempMax( 0.0 );
+		Real64 VolFlowRate( 0.0 );
+		Real64 OutletTemp( 0.0 );
+		int FlowType( 0 );
+		int NoFlowWarnIndex( 0 );
+		int HighFlowWarnIndex( 0 );
+		int HighInletWarnIndex( 0 );
+		int HighTempWarnIndex( 0 );
+		std::string SimRefrigCondenserName;
+		std::string TypeName;
+		std::string ErrIntro;
+		bool SimulateDetailedRefrigerationSystemsDeRate( false ); // If true, need to derate aircoils because load can't be met by system
+		bool FirstSCLoop( true ); // Flag first time through multi-system loop used when mech subcoolers present
+		int StartMechSubcoolLoop( 3 ); // if no mechanical subcoolers transfer energy between system,
+		int LoopNum( 0 ); // Index to overall repeat necessary for mechanical subcoolers
+		int SubcoolID( 0 ); // Subcooler ID number
+		int SubcoolerIndex( 0 ); // Subcooler ID number
+		int SimulateDetailedRefrigerationSystemsCaseID( 0 ); // Absolute reference to case
+		int SimulateDetailedRefrigerationSystemsCaseIndex( 0 ); // Index to case
+		int SimulateDetailedRefrigerationSystemsCoilID( 0 ); // Index to a single air chiller/coil
+		int SimulateDetailedRefrigerationSystemsCoilIndex( 0 ); // Index to a single air chiller/coil
+		int SimulateDetailedRefrigerationSystemsCoilSetID( 0 ); // Index to set of coils in a single zone (shared inlet and outlet nodes)
+		int SimulateDetailedRefrigerationSystemsCoilSetIndex( 0 ); // Index to set of coils in a single zone
+		int CondInletAirZoneNum( 0 ); // Index used to assign zone credits
+		int SimulateDetailedRefrigerationSystemsSecondID( 0 ); // Absolute reference to Secondary Loop
+		int SecondIndex( 0 ); // Index to Secondary Loop
+		int SuctionPipeActualZoneNum( 0 ); // Index to zone exchanging heat with suction pipes
+		int SimulateDetailedRefrigerationSystemsWalkInID( 0 ); // Absolute reference to WalkIn
+		int SimulateDetailedRefrigerationSystemsWalkInIndex( 0 ); // Index to WalkIn
+		int SimulateDetailedRefrigerationSystemsZoneNum( 0 ); // counter when assigning zone case credits
+		int SimulateDetailedRefrigerationSystemsCascadeLoadIndex( 0 ); // Index to Cascade Condenser Load
+		int CascadeLoadID( 0 ); // Absolute reference to Cascade Condenser
+		Real64 LoadFrac( 1.0 ); // case load/design case load
+		Real64 SimulateDetailedRefrigerationSystemsLocalTimeStep( 0.0 ); // Set equal to either TimeStepSys or TimeStepZone
+		Real64 CurrentLoads( 0.0 ); // current loads on compressor, exclusive of unmet loads from prev time steps
+		Real64 CurrentHiStageLoads( 0.0 ); // Current loads on high-stage compressor, exclusive of unmet loads from
+		Real64 MaxTEvap( 0.0 ); // Maximum evaporating temperature that can still meet load
+		Real64 MaxDelTFloatFrac( 0.5 ); // max fraction allowed for difference between case and evaporator temperature
+		bool SimulateDetailedTransRefrigSystemsFirstSCLoop( true ); // Flag first time through multi-system loop used when mech subcoolers present
+		int SimulateDetailedTransRefrigSystemsStartMechSubcoolLoop( 3 ); // if no mechanical subcoolers transfer energy between system, don't loop
+		int SimulateDetailedTransRefrigSystemsLoopNum( 0 ); // Index to overall repeat necessary for mechanical subcoolers
+		int SimulateDetailedTransRefrigSystemsCaseID( 0 ); // Absolute reference to case
+		int SimulateDetailedTransRefrigSystemsCaseIndex( 0 ); // Index to case
+		int SimulateDetailedTransRefrigSystemsCondInletAirZoneNum( 0 ); // Index used to assign zone credits
+		int SimulateDetailedTransRefrigSystemsSuctionPipeActualZoneNum( 0 ); // Index to zone exchanging heat with suction pipes
+		int SimulateDetailedTransRefrigSystemsWalkInID( 0 ); // Absolute reference to WalkIn
+		int SimulateDetailedTransRefrigSystemsWalkInIndex( 0 ); // Index to WalkIn
+		Real64 SimulateDetailedTransRefrigSystemsLocalTimeStep( 0.0 ); // Set equal to either TimeStepSys or TimeStepZone
+		Real64 SimulateDetailedTransRefrigSystemsCurrentLoads( 0.0 ); // current loads on compressor, exclusive of unmet loads from prev time steps
+		Real64 MassFlowCompsStart( 0.0 ); // Mass flow through (low-stage) compressors (single- or two-stage systems)
+		Real64 MassFlowHiStageCompsStart( 0.0 ); // Mass flow through high-stage comrpessors (two-stage systems only)
+		Real64 ErrorMassFlowComps( 0.0 ); // Error in calculated (low stage) compressor mass flow (single- or two-stage systems)
+		Real64 ErrorMassFlowHiStageComps( 0.0 ); // Error in calculated high-stage compressor mass flow (two-stage systems only)
+		Real64 CalculateCompressorsLocalTimeStep( 0.0 ); // TimeStepZone for case/walkin systems, TimeStepSys for coil systems
+		Real64 AccumLoadMT( 0.0 ); // Load due to previously unmet medium temperature compressor loads (transcritical system)
+		Real64 AccumLoadLT( 0.0 ); // Load due to previously unmet low temperature compressor loads (transcritical system)
+		Real64 HCaseOutLTMT( 0.0 ); // Combined enthalpy from the outlets of the LP compressor and MT loads, J/kg
+		Real64 HReceiverBypass( 0.0 ); // Enthalpy at the receiver bypass, J/kg
+		Real64 CalculateTransCompressorsLocalTimeStep( 0.0 ); // TimeStepZone for case/walkin systems, TimeStepSys for coil systems
+		Real64 CalculateSubcoolersLocalTimeStep( 0.0 ); // TimeStepZone for case/walkin systems, TimeStepSys for coil systems
+		int CalculateWalkInZoneNodeNum( 0 ); // Zone node number
+		int CalculateWalkInZoneNum( 0 ); // Index to zone
+		int CalculateWalkInZoneID( 0 ); // Index to zone
+		Real64 CapApplied( 0.0 ); // Walk In total capacity at specific operating conditions
+		Real64 CircFanSchedule( 0.0 );
+		Real64 Conv( 0.0 ); // conversion factor in gravity equation
+		Real64 DefrostCap( 0.0 ); // Design defrost capacity of WalkIn (W)
+		Real64 CalculateWalkInDefrostEnergy( 0.0 ); // (J)
+		Real64 DefEnergyFraction( 0.0 ); // dimensionless
+		Real64 AvailDefrostEnergy( 0.0 ); // available to melt ice with temp term control (J)
+		Real64 DefrostLoad( 0.0 ); // (W)
+		Real64 CalculateWalkInDefrostSchedule( 0.0 ); // WalkIn defrost schedule, between 0 and 1
+		Real64 CalculateWalkInDefrostDripDownSchedule( 0.0 ); // WalkIn drip-down schedule (allows coil to drain after defrost)
+		Real64 DefrostEnergyNeeded( 0.0 ); // Energy needed to melt all ice, used with temperature termination (J)
+		Real64 DensityAirWalkIn( 0.0 ); // Density at Walk in temperature and 90% assumed RH
+		Real64 DensityZoneAir( 0.0 ); // Density of the air in a particular zone (kg/m3)
+		Real64 DensityFactorFm( 0.0 ); // called Fm in ASHRAE 2010 eq 13 page 24.5 for door infiltration
+		Real64 DensitySqRtFactor( 0.0 ); // from ASHRAE 2010 eq 12 page 24.4 for door infiltration
+		Real64 DelTemp( 0.0 ); // Difference between zone and walk in temperatures (C)
+		Real64 CalculateWalkInDesignLighting( 0.0 ); // Total design display WalkIn lighting power (W)
+		Real64 CalculateWalkInDesignRatedCap( 0.0 ); // Rated capacity of walk in cooler coil (W)
+		Real64 DoorFlowFactor( 0.0 ); // Derate compared to fully developed flow through 100% open door
+		Real64 DoorOpenFactor( 0.0 ); // Derate based upon fraction time door opened
+		Real64 DoorProtectEff( 0.0 ); // Door protection effectiveness
+		Real64 DrHeight( 0.0 ); // Door height (m)
+		Real64 DrArea( 0.0 ); // Door area (m2)
+		Real64 EnthalpyAirWalkIn( 0.0 ); // Enthalpy of air corresponding to walk in temperatuer and 90% assumed RH (J/kg)
+		Real64 EnthalpyZoneAir( 0.0 ); // Enthalpy of the air in a particular zone (J/kg)
+		Real64 FanLoad( 0.0 ); // Total fan energy rate (W)
+		Real64 FloorLoad( 0.0 ); // Total floor energy rate (W)
+		Real64 FrostChangekg( 0.0 ); // Amount of frost added or melted  (kg)
+		Real64 FullFlowInfLoad( 0.0 ); // Total load (lat + sens) due to 100% open doors w/ fully developed flow (W)
+		Real64 GlassDoorInfLoad( 0.0 ); // infiltration through glass reach-in doors in a particular zone (W)
+		Real64 GlassDoorSensHeat( 0.0 ); // sensible heat gain through glass reach-in doors (UA*delta T) (W)
+		Real64 GlassDoorArea( 0.0 ); // facing a particular zone (m2)
+		Real64 Gravity( 0.0 );
+		Real64 HeaterSchedule( 0.0 ); // zero to one
+		Real64 HeaterLoad( 0.0 ); // Total heater (except defrost) energy rate (W)
+		Real64 HumRatioAirWalkIn( 0.0 ); // corresponds to walk in temp and 90% assumed RH(kg water/kg dry air)
+		Real64 HumRatioZoneAir( 0.0 ); // Humidity Ratio of the air in a particular zone (kg water/kg dry air)
+		Real64 IceSensHeatNeeded( 0.0 ); // Energy to raise frost temperature to 0C, used w/ temp termination (J)
+		Real64 LatentCapApplied( 0.0 ); // Walk In latent capacity at specific operating conditions
+		Real64 LatentLoadTotal( 0.0 ); // total latent load on WalkIn over all zones (W)
+		Real64 LightLoad( 0.0 ); // Total lighting energy rate (W)
+		Real64 CalculateWalkInLightingSchedule( 0.0 ); // WalkIn lighting schedule
+		Real64 CalculateWalkInLoadRequested( 0.0 ); // Load necessary to meet current and all stored energy needs (W)
+		Real64 LoadTotal( 0.0 ); // total load in time step (W)
+		Real64 MassDryAirRate( 0.0 ); // Mass dry air infiltrating into/out-of walkin through doors (kg/s)
+		Real64 MaxCap( 0.0 ); // Design chilling capacity reduced according to drip-down schedule (W)
+		Real64 SensibleCapApplied( 0.0 ); // Walk In sensible capacity at specific operating conditions
+		Real64 CalculateWalkInSensibleLoadTotal( 0.0 ); // Total sensible load on WalkIn over all zones (W)
+		Real64 CalculateWalkInStoredEnergyRate( 0.0 ); // Rate needed to serve all stored energy during single time step (W)
+		Real64 StartIceTemp( 0.0 ); // Frost temperature at start of time step [C]
+		Real64 CalculateWalkInStartFrostKg( 0.0 ); // frost load at start of time step (kg of ice)
+		Real64 StockDoorInfLoad( 0.0 ); // infiltration through stock doors in a particular zone (W)
+		Real64 StockDoorSensHeat( 0.0 ); // sensible heat gain through stock doors (UA*delta T) (W)
+		Real64 StockDoorArea( 0.0 ); // (m2)
+		Real64 CalculateWalkInStockingLoad( 0.0 ); // Total load due to stocking WalkIn product (W)
+		Real64 TWalkIn( 0.0 ); // WalkIn operating temperature (C)
+		Real64 UAOtherSurfaces( 0.0 ); // UA for non-door surfaces facing a certain zone (W/C)
+		Real64 WalkInSchedule( 0.0 ); // Current value of WalkIn operating (availability) schedule
+		Real64 WalkInSensLoad( 0.0 ); // Walk in cooler sensible load facing particular zone (W)
+		Real64 WalkInLatLoad( 0.0 ); // Walk in cooler latent load facing particular zone (W)
+		Real64 WaterRemovRate( 0.0 ); // Walk in cooler removes water at this rate in this zone (kg/s)
+		Real64 ZoneDryBulb( 0.0 ); // Dry Bulb Temperature of adjacent zone
+		Real64 ZoneSensLoad( 0.0 ); // Sensible WalkIn credit delivered to a particular zone (W)
+		Real64 ZoneLatentLoad( 0.0 ); // Latent WalkIn credit delivered to zone (W)
+		Real64 ZoneRHFrac( 0.0 ); // Zone relative humidity fraction (decimal)
+		Real64 ZoneInfilLoad( 0.0 ); // Walk in cooler infiltration load (sens + latent) in certain zone (W)
+		Real64 ZInfilSensLoad( 0.0 ); // Sensible load due to infiltration in one zone
+		Real64 ZdoorSensLoad( 0.0 ); // Sensible load due to UA delta T through closed door in one zone
+		Real64 CalculateSecondaryLoadRequested( 0.0 ); // Load necessary to meet current and all stored energy needs (W)
+		Real64 CalculateSecondaryLocalTimeStep( 0.0 ); // TimeStepZone for case/walkin systems, TimeStepSys for coil systems
+		int SumZoneImpactsZoneNum( 0 ); // used calculating total refrigeration interactions for zone
+		int CalculateAirChillerSetsCoilID( 0 ); // Index to coil
+		int CalculateAirChillerSetsCoilIndex( 0 ); // rank of coils within system
+		Real64 AirChillerSetSchedule( 0.0 ); // Schedule value for air chiller SET
+		Real64 QZNReqSens( 0.0 ); // Amount of sensible heat needed by the zone, NEGATIVE when cooling needed [W]
+		Real64 RemainQZNReqSens( 0.0 ); // Remaiing amount of sensible heat needed by the zone [W]
+		int FinalRateCoilsNumCoils( 0 ); // Number of coils on this system or secondary loop
+		int FinalRateCoilsCoilID( 0 ); // Index to coil
+		int FinalRateCoilsCoilIndex( 0 ); // rank of coils within system
+		Real64 DeRateFactor( 0.0 ); // Ratio of energy available from system or secondary loop
+		Real64 InitLatCreditEnergy( 0.0 ); // Latent credit energy before derate [W]
+		Real64 InitKgFrost( 0.0 ); // Initial amount of frost on coils based on latent load before derate [kg]
+		Real64 FrostReduction( 0.0 ); // Change in frost on coils based on derated latent load [kg]
+		Real64 CalculateCoilUnitLoadFactorSens( 0.0 ); // Rated capacity divided by rated DT1 (T air in - Tevap) (W/delta C)
+		int FanSpeedControlType( 0 ); // from input
+		int SHRCorrectionCurvePtr( 0 ); // Points to curve entered by user to specify total/sensible capacity as a function of SHR
+		int SHRCorrectionType( 0 ); // SHR60, QuadraticSHR, European, or TabularRH_DT1_TRoom
+		int CalculateCoilZoneNodeNum( 0 ); // Zone node number
+		Real64 AirVolRatio( 0.0 ); // used when operating at part load
+		Real64 AirVolumeFlowMax( 0.0 ); // Coil air flow limited by drip down schedule (m3/s)
+		Real64 AirVolumeFlowRated( 0.0 ); // Coil rated air flow (m3/s)
+		Real64 CalculateCoilAvailDefrostEnergy( 0.0 ); // available to melt ice with temp term control (J)
+		Real64 CapFac( 0.0 ); // used to reduce fan power when don't need full coil capacity
+		Real64 CoilCapTotal( 0.0 ); // Sensible plus latent load (W)
+		Real64 CoilCapTotEstimate( 0.0 ); // Part of loop to solve for total coil capacity as a function of inlet air conditions (W)
+		Real64 CoilInletCp( 0.0 ); // Coil air inlet specific heat (J/kg-deltaC)
+		Real64 CoilInletDensity( 0.0 ); // Coil air inlet density (kg/m3)
+		Real64 CoilInletDryAirCp( 0.0 ); // Dry air specific heat at coil inlet temperature (J/kg-C)
+		Real64 CoilInletDryAirDensity( 0.0 ); // Dry Air density at coil inlet temperature (kg/m3)
+		Real64 CoilInletHumRatio( 0.0 ); // Coil air inlet humidity ratio (kg water/kg air)
+		Real64 CoilInletTemp( 0.0 ); // Inlet temperature of air to coil, not mixed zone temperature unless "middle" location selected (C)
+		Real64 CoilInletEnthalpy( 0.0 ); // Coil inlet air enthalpy (J/kg)
+		Real64 CoilInletRHFrac( 0.0 ); // Coil inlet air relative humidity expressed as a fraction (0 to 1)
+		Real64 CoilSchedule( 0.0 ); // Current value of Coil operating (availability) schedule
+		Real64 CoolingLoadNet( 0.0 ); // Cooling capacity of the coil minus fan, heater, and defrost loads (W)
+		Real64 CalculateCoilDefrostCap( 0.0 ); // Design defrost capacity of Coil (W)
+		Real64 CalculateCoilDefrostEnergy( 0.0 ); // (J)
+		Real64 CalculateCoilDefEnergyFraction( 0.0 ); // dimensionless
+		Real64 CalculateCoilDefrostLoad( 0.0 ); // Part of the defrost that is a heat load on the zone (W)
+		Real64 CalculateCoilDefrostSchedule( 0.0 ); // Coil defrost schedule, between 0 and 1
+		Real64 CalculateCoilDefrostDripDownSchedule( 0.0 ); // Coil drip-down schedule (allows coil to drain after defrost)
+		Real64 CalculateCoilDefrostEnergyNeeded( 0.0 ); // Energy needed to melt all ice, used with temperature termination (J)
+		Real64 DefrostRateNeeded( 0.0 ); // Defrost load that actually goes to melting ice (W)
+		Real64 DryAirMassFlowMax( 0.0 ); // Rated volume flow rate times dry air density adjusted for schedules (kg/s)
+		Real64 DryAirMassFlowRated( 0.0 ); // Rated volume flow rate times dry air density
+		Real64 ExitHumRatio( 0.0 ); // kg water/kg air
+		Real64 ExitTemperature( 0.0 ); // Air temperature leaving the coil (C)
+		Real64 ExitTemperatureEstimate( 0.0 ); // Estimated Air temperature leaving the coil (C)
+		Real64 ExitEnthalpy( 0.0 ); // Air enthalpy leaving the coil (J/kg)
+		Real64 ExitEnthalpyEstimate( 0.0 ); // Estimated Air enthalpy leaving the coil (J/kg)
+		Real64 FanMinAirFlowRatio( 0.0 ); // From input
+		Real64 FanPowerActual( 0.0 ); // (W)
+		Real64 FanPowerRated( 0.0 ); // (W)
+		Real64 FanPowerMax( 0.0 ); // Total fan energy rate, limited by dripdown period (W)
+		Real64 FanPowerRatio( 0.0 ); // Used for variable speed fans, dimensionless
+		Real64 CalculateCoilFrostChangekg( 0.0 ); // Amount of frost added or melted  (kg)
+		Real64 CalculateCoilHeaterSchedule( 0.0 ); // zero to one
+		Real64 CalculateCoilHeaterLoad( 0.0 ); // Total heater (except defrost) energy rate (W)
+		Real64 CalculateCoilIceSensHeatNeeded( 0.0 ); // Energy to raise frost temperature to 0C, used w/ temp termination (J)
+		Real64 LatLoadServed( 0.0 ); // Energy rate used to remove water from zone air (W)
+		Real64 MaxTemperatureDif( 0.0 ); // Used to limit capacity during initial pulldown (deltaC)
+		Real64 SensibleCapacityMax( 0.0 ); // Sensible capacity adjusted for any time in dripdown state (W)
+		Real64 SensLoadRequested( 0.0 ); // Sensible load requested by zone balance (W)
+		Real64 SensLoadFromZone( 0.0 ); // Net sensible load removed from zone after accounting for heaters, fans, defrost [W]
+		Real64 SensLoadRequestedGross( 0.0 ); // Gross sensible load removed by coil
+		Real64 SensLoadGross( 0.0 ); // Sensible load met by coil (W)
+		Real64 SHR( 0.0 ); // Sensible heat ratio, sensible load/total load
+		Real64 SHRCorrection( 0.0 ); // Actual total/sensible load, NOT = Inverse SHR (unless coil efficiency = 1.0),
+		Real64 SHRCorrection60( 0.0 ); // Total capacity as a fraction of sensible capacity at a SHR of 0.6, entered by user
+		Real64 Slope( 0.0 ); // Part of linear SHR60 correction factor, dimensionless
+		Real64 CalculateCoilStartIceTemp( 0.0 ); // Frost temperature at start of time step [C]
+		Real64 CalculateCoilStartFrostKg( 0.0 ); // frost load at start of time step (kg of ice)
+		Real64 TemperatureDif( 0.0 ); // difference between inlet air and evaporating temperature (deltaC)
+		Real64 TEvap( 0.0 ); // Evaporating temperature in the coil (C)
+		Real64 CalculateCoilWaterRemovRate( 0.0 ); // Walk in cooler removes water at this rate in this zone (kg/s)
+		Real64 Yint( 0.0 ); // Part of linear SHR60 correction factor, dimensionless
+		Real64 ZoneDryAirDensity( 0.0 ); // Dry air density at mixed zone conditions
+		Real64 ZoneMixedAirCp( 0.0 ); // J/kg-deltaC
+		Real64 ZoneMixedAirDensity( 0.0 ); // kg/m3
+		Real64 ZoneMixedAirDryBulb( 0.0 ); // (C)
+		Real64 ZoneMixedAirRHFrac( 0.0 ); // relative humidity of mixed air in the zone expressed as a fraction from 0 to 1
+		Real64 ZoneMixedAirEnthalpy( 0.0 ); // J/kg
+		Real64 ZoneMixedAirHumRatio( 0.0 ); // kg water/kg air in the zone mixed air
+		bool MyEnvrnFlag( true );
+		int ZeroHVACValuesDemandARRID( 0 ); // Index to water tank Demand used for evap condenser
+		int TankID( 0 ); // Index to water tank used for evap condenser
+		int ZeroHVACValuesRackNum( 0 ); // Index to refrigerated rack
+		int ZeroHVACValuesCondID( 0 ); // Index to condenser
+		int PlantInletNode( 0 ); // Used to zero request for cooling water for condenser
+		int PlantOutletNode( 0 ); // Used to zero request for cooling water for condenser
+		int PlantLoopIndex( 0 ); // Used to zero request for cooling water for condenser
+		int PlantLoopSideIndex( 0 ); // Used to zero request for cooling water for condenser
+		int PlantBranchIndex( 0 ); // Used to zero request for cooling water for condenser
+		int PlantCompIndex( 0 ); // Used to zero request for cooling water for condenser
+		Real64 ZeroHVACValuesMassFlowRate( 0.0 ); // Used to zero request for cooling water for condenser
+	}
 
 	// Functions
 
+	// Clears the global data in RefrigeratedCase.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumRefrigZoneAirs = 0;
+		RefrigZoneAir.deallocate();
+		RefrigZoneAirList.deallocate();
+		MyOneTimeFlag = true;
+		CurrentModuleObject.clear();
+		CaseLoads = false;
+		GetRefrigerationInputErrorsFound = false;
+		IsNotOK = false;
+		IsBlank = false;
+		StartCycle = false;
+		AlphaListNum = 0;
+		AlphaNum = 0;
+		AlphaStartList = 0;
+		AStart = 0;
+		CascadeLoadNum = 0;
+		CascadeLoadIndex = 0;
+		GetRefrigerationInputCaseID = 0;
+		CaseIndex = 0;
+		CaseNum = 0;
+		CaseAndWalkInListNum = 0;
+		ChillerIndex = 0;
+		GetRefrigerationInputCoilID = 0;
+		CoilIndex = 0;
+		CoilNum = 0;
+		GetRefrigerationInputCompIndex = 0;
+		CompNum = 0;
+		CondID = 0;
+		CondIndex = 0;
+		CondNum = 0;
+		DefType = 0;
+		GCNum = 0;
+		HRNum = 0;
+		IOStatus = 0;
+		ListNum = 0;
+		LoadCascadeNum = 0;
+		LoadCount = 0;
+		LoadSecondaryNum = 0;
+		LoadWalkInNum = 0;
+		LoadCaseNum = 0;
+		LoadCoilNum = 0;
+		MaxNumAlphasRack = 0;
+		MaxNumAlphasAirChiller = 0;
+		MaxNumAlphasAll = 0;
+		MaxNumAlphasSys = 0;
+		MaxNumAlphasTransSys = 0;
+		MaxNumAlphasChillerSet = 0;
+		MaxNumAlphasConda = 0;
+		MaxNumAlphasConde = 0;
+		MaxNumAlphasCondw = 0;
+		MaxNumAlphasGasCoolera = 0;
+		MaxNumAlphasComp = 0;
+		MaxNumAlphasCompressorList = 0;
+		MaxNumAlphasCase = 0;
+		MaxNumAlphasCaseAndWalkInList = 0;
+		MaxNumAlphasWalkIn = 0;
+		MaxNumAlphasSecond = 0;
+		MaxNumNumbersAirChiller = 0;
+		MaxNumNumbersSecond = 0;
+		MaxNumNumbersWalkIn = 0;
+		MaxNumNumbersCase = 0;
+		MaxNumNumbersCaseAndWalkInList = 0;
+		MaxNumNumbersRack = 0;
+		MaxNumNumbersAll = 0;
+		MaxNumNumbersSys = 0;
+		MaxNumNumbersTransSys = 0;
+		MaxNumNumbersChillerSet = 0;
+		MaxNumNumbersConda = 0;
+		MaxNumNumbersConde = 0;
+		MaxNumNumbersCondw = 0;
+		MaxNumNumbersGasCoolera = 0;
+		MaxNumNumbersComp = 0;
+		MaxNumNumbersCompressorList = 0;
+		MaxNumArgs = 0;
+		NStart = 0;
+		NumAlphas = 0;
+		NumCascadeLoad = 0;
+		NumCompressorsSys = 0;
+		NumHiStageCompressorsSys = 0;
+		NumCondensers = 0;
+		NumGasCoolers = 0;
+		NumDefCycles = 0;
+		NumPumps = 0;
+		NumCases = 0;
+		NumCasesMT = 0;
+		NumCasesLT = 0;
+		NumCoils = 0;
+		NumSubcooler = 0;
+		NumNameMatches = 0;
+		NumNum = 0;
+		NumNumbers = 0;
+		NumCompressorLists = 0;
+		NumDisplayCases = 0;
+		NumSecondary = 0;
+		NumWalkIns = 0;
+		NumWalkInsMT = 0;
+		NumWalkInsLT = 0;
+		NumWIFieldsPerZone = 0;
+		NumWIFieldsTotal = 0;
+		NumZones = 0;
+		NumTotalLoadsOnList = 0;
+		NumSecondarysOnList = 0;
+		NumCascadeLoadsChecked = 0;
+		NumCascadeLoadsOnList = 0;
+		NumLoad = 0;
+		NumCasesOnList = 0;
+		NumChillersInSet = 0;
+		NumCoilsOnList = 0;
+		NumWalkInsOnList = 0;
+		GetRefrigerationInputRackNum = 0;
+		RefrigIndex = 0;
+		RefrigSysNum = 0;
+		TransRefrigSysNum = 0;
+		SecondaryIndex = 0;
+		SecondaryID = 0;
+		SetID = 0;
+		GetRefrigerationInputSecondaryNum = 0;
+		TransferLoadListNum = 0;
+		SubcoolerNum = 0;
+		TSNum = 0;
+		WalkInIndex = 0;
+		GetRefrigerationInputWalkInID = 0;
+		WalkInNum = 0;
+		TotFields = 0;
+		ZoneID = 0;
+		ZoneIndex = 0;
+		GetRefrigerationInputZoneNum = 0;
+		CalcCircRate = 0.0;
+		CalcTotFlowVol = 0.0;
+		CaseHeatGain = 0.0;
+		CapacityAtMaxVolFlow = 0.0;
+		CpBrineRated = 0.0;
+		Capmin = 0.0;
+		Capmax = 0.0;
+		DeltaCap1 = 0.0;
+		DeltaCap2 = 0.0;
+		DeltaHPhaseChange = 0.0;
+		DelTempMin = 0.0;
+		DelTempMax = 0.0;
+		DensityBrineRated = 0.0;
+		DensityPhaseChange = 0.0;
+		DesignSensibleCap = 0.0;
+		DiffCircRates = 0.0;
+		ErrSecondPumpPower = 0.0;
+		FlowMassRated = 0.0;
+		GCOutletH = 0.0;
+		NominalSecondaryCapacity = 0.0;
+		NominalSecondaryRefLoad = 0.0;
+		NominalTotalCascadeLoad = 0.0;
+		NominalTotalCaseCap = 0.0;
+		NominalTotalCoilCap = 0.0;
+		NominalTotalWalkInCap = 0.0;
+		NominalTotalSecondaryCap = 0.0;
+		NominalTotalCaseCapMT = 0.0;
+		NominalTotalCaseCapLT = 0.0;
+		NominalTotalWalkInCapMT = 0.0;
+		NominalTotalWalkInCapLT = 0.0;
+		NominalTotalCoolingCap = 0.0;
+		NominalTotalCompCap = 0.0;
+		NominalTotalHiStageCompCap = 0.0;
+		NominalTotalCompCapHP = 0.0;
+		NominalTotalCompCapLP = 0.0;
+		NominalCondCap = 0.0;
+		PCond = 0.0;
+		PEvap = 0.0;
+		PumpTotRatedHead = 0.0;
+		PumpTotRatedFlowVol = 0.0;
+		Rcase = 0.0;
+		RcaseDenom = 0.0;
+		SecondaryFlowVolRated = 0.0;
+		TBrineOutRated = 0.0;
+		TBrineInRated = 0.0;
+		TBrineAverage = 0.0;
+		TempRAFraction = 0.0;
+		TestDelta = 0.0;
+		SetupReportInputCaseNum = 0;
+		SetupReportInputCoilNum = 0;
+		SecondNum = 0;
+		SetupReportInputWalkInNum = 0;
+		SetupReportInputRackNum = 0;
+		SetupReportInputRefrigSysNum = 0;
+		SetupReportInputCompNum = 0;
+		SetupReportInputCompIndex = 0;
+		SetupReportInputCondNum = 0;
+		SetupReportInputGCNum = 0;
+		SubcoolNum = 0;
+		SetupReportInputZoneID = 0;
+		Walkin_and_zone_name.clear();
+		MyBeginEnvrnFlag = true;
+		InitRefrigerationSystemID = 0;
+		InitRefrigerationCaseID = 0;
+		InitRefrigerationWalkInID = 0;
+		InitRefrigerationCoilID = 0;
+		ICond = 0;
+		IRack = 0;
+		SecondID = 0;
+		MyCurrentTime = 0.0;
+		MyCurrentTimeSaved = 0.0;
+		MyStepStartTime = 0.0;
+		MyStepStartTimeSaved = 0.0;
+		TimeStepFraction = 0.0;
+		InitRefrigerationPlantConnectionsMyBeginEnvrnFlag = true;
+		errFlag = false;
+		RefCondLoop = 0;
+		RefCompRackLoop = 0;
+		LocalTimeStep = 0.0;
+		CoilSetIndex = 0;
+		CoilSetID = 0;
+		CalcRackSystemCoilIndex = 0;
+		CalcRackSystemCoilID = 0;
+		ReportRackSystemLocalTimeStep = 0.0;
+		DemandARRID = 0;
+		RackTankID = 0;
+		CalculateCaseCaseRAFraction = 0.0;
+		ActualZoneNum = 0;
+		DefCapCurvePtr = 0;
+		DefrostEnergyCurveType = 0;
+		DefrostType = 0;
+		ZoneNodeNum = 0;
+		CapAvail = 0.0;
+		CaseCreditFraction = 0.0;
+		CaseSenCreditToZone = 0.0;
+		CaseLatCreditToZone = 0.0;
+		CaseSenCreditToHVAC = 0.0;
+		CaseLatCreditToHVAC = 0.0;
+		CaseSchedule = 0.0;
+		DefrostEnergy = 0.0;
+		DefrostSchedule = 0.0;
+		DefrostDripDownSchedule = 0.0;
+		DefCapModFrac = 0.0;
+		DefrostRatio = 0.0;
+		DefrostLoad_Actual = 0.0;
+		DefrostCap_Actual = 0.0;
+		DeltaFreezeKgFrost = 0.0;
+		DeltaStockingEnergy = 0.0;
+		DeltaWarmEnvEnergy = 0.0;
+		DesignRatedCap = 0.0;
+		DesignDefrostCap = 0.0;
+		DesignLatentCap = 0.0;
+		DesignLighting = 0.0;
+		FrostMeltedKg = 0.0;
+		LatentLoad = 0.0;
+		LatentRatio = 0.0;
+		LatentCap_Actual = 0.0;
+		LatentCaseCredit = 0.0;
+		LatCapModFrac = 0.0;
+		LightingSchedule = 0.0;
+		Length = 0.0;
+		LoadRequested = 0.0;
+		RatedAmbientRH = 0.0;
+		SensibleCaseCredit = 0.0;
+		SensibleCap_Actual = 0.0;
+		SensibleLoadPrime = 0.0;
+		SensibleLoadAux = 0.0;
+		SensibleLoadTotal = 0.0;
+		StockingSchedule = 0.0;
+		StockingLoad = 0.0;
+		StoredEnergyRate = 0.0;
+		TotalLoad_Actual = 0.0;
+		StartFrostKg = 0.0;
+		TotalCap_Actual = 0.0;
+		TotalLightingLoad = 0.0;
+		TotalFan = 0.0;
+		TotalAntiSweat = 0.0;
+		TotalLightToCase = 0.0;
+		TotalASHeaterToCase = 0.0;
+		TotalLightToZone = 0.0;
+		TotalASHeaterToZone = 0.0;
+		TCase = 0.0;
+		ZoneRHPercent = 0.0;
+		ZoneDewPoint = 0.0;
+		ZoneTempFactor = 0.0;
+		DeltaT = 0.0;
+		InletTemp = 0.0;
+		DesVolFlowRate = 0.0;
+		MassFlowRate = 0.0;
+		MassFlowRateMax = 0.0;
+		OutletTempMax = 0.0;
+		VolFlowRate = 0.0;
+		OutletTemp = 0.0;
+		FlowType = 0;
+		NoFlowWarnIndex = 0;
+		HighFlowWarnIndex = 0;
+		HighInletWarnIndex = 0;
+		HighTempWarnIndex = 0;
+		SimRefrigCondenserName.clear();
+		TypeName.clear();
+		ErrIntro.clear();
+		SimulateDetailedRefrigerationSystemsDeRate = false;
+		FirstSCLoop = true;
+		StartMechSubcoolLoop = 3;
+		LoopNum = 0;
+		SubcoolID = 0;
+		SubcoolerIndex = 0;
+		SimulateDetailedRefrigerationSystemsCaseID = 0;
+		SimulateDetailedRefrigerationSystemsCaseIndex = 0;
+		SimulateDetailedRefrigerationSystemsCoilID = 0;
+		SimulateDetailedRefrigerationSystemsCoilIndex = 0;
+		SimulateDetailedRefrigerationSystemsCoilSetID = 0;
+		SimulateDetailedRefrigerationSystemsCoilSetIndex = 0;
+		CondInletAirZoneNum = 0;
+		SimulateDetailedRefrigerationSystemsSecondID = 0;
+		SecondIndex = 0;
+		SuctionPipeActualZoneNum = 0;
+		SimulateDetailedRefrigerationSystemsWalkInID = 0;
+		SimulateDetailedRefrigerationSystemsWalkInIndex = 0;
+		SimulateDetailedRefrigerationSystemsZoneNum = 0;
+		SimulateDetailedRefrigerationSystemsCascadeLoadIndex = 0;
+		CascadeLoadID = 0;
+		LoadFrac = 1.0;
+		SimulateDetailedRefrigerationSystemsLocalTimeStep = 0.0;
+		CurrentLoads = 0.0;
+		CurrentHiStageLoads = 0.0;
+		MaxTEvap = 0.0;
+		MaxDelTFloatFrac = 0.5;
+		SimulateDetailedTransRefrigSystemsFirstSCLoop = true;
+		SimulateDetailedTransRefrigSystemsStartMechSubcoolLoop = 3;
+		SimulateDetailedTransRefrigSystemsLoopNum = 0;
+		SimulateDetailedTransRefrigSystemsCaseID = 0;
+		SimulateDetailedTransRefrigSystemsCaseIndex = 0;
+		SimulateDetailedTransRefrigSystemsCondInletAirZoneNum = 0;
+		SimulateDetailedTransRefrigSystemsSuctionPipeActualZoneNum = 0;
+		SimulateDetailedTransRefrigSystemsWalkInID = 0;
+		SimulateDetailedTransRefrigSystemsWalkInIndex = 0;
+		SimulateDetailedTransRefrigSystemsLocalTimeStep = 0.0;
+		SimulateDetailedTransRefrigSystemsCurrentLoads = 0.0;
+		MassFlowCompsStart = 0.0;
+		MassFlowHiStageCompsStart = 0.0;
+		ErrorMassFlowComps = 0.0;
+		ErrorMassFlowHiStageComps = 0.0;
+		CalculateCompressorsLocalTimeStep = 0.0;
+		AccumLoadMT = 0.0;
+		AccumLoadLT = 0.0;
+		HCaseOutLTMT = 0.0;
+		HReceiverBypass = 0.0;
+		CalculateTransCompressorsLocalTimeStep = 0.0;
+		CalculateSubcoolersLocalTimeStep = 0.0;
+		CalculateWalkInZoneNodeNum = 0;
+		CalculateWalkInZoneNum = 0;
+		CalculateWalkInZoneID = 0;
+		CapApplied = 0.0;
+		CircFanSchedule = 0.0;
+		Conv = 0.0;
+		DefrostCap = 0.0;
+		CalculateWalkInDefrostEnergy = 0.0;
+		DefEnergyFraction = 0.0;
+		AvailDefrostEnergy = 0.0;
+		DefrostLoad = 0.0;
+		CalculateWalkInDefrostSchedule = 0.0;
+		CalculateWalkInDefrostDripDownSchedule = 0.0;
+		DefrostEnergyNeeded = 0.0;
+		DensityAirWalkIn = 0.0;
+		DensityZoneAir = 0.0;
+		DensityFactorFm = 0.0;
+		DensitySqRtFactor = 0.0;
+		DelTemp = 0.0;
+		CalculateWalkInDesignLighting = 0.0;
+		CalculateWalkInDesignRatedCap = 0.0;
+		DoorFlowFactor = 0.0;
+		DoorOpenFactor = 0.0;
+		DoorProtectEff = 0.0;
+		DrHeight = 0.0;
+		DrArea = 0.0;
+		EnthalpyAirWalkIn = 0.0;
+		EnthalpyZoneAir = 0.0;
+		FanLoad = 0.0;
+		FloorLoad = 0.0;
+		FrostChangekg = 0.0;
+		FullFlowInfLoad = 0.0;
+		GlassDoorInfLoad = 0.0;
+		GlassDoorSensHeat = 0.0;
+		GlassDoorArea = 0.0;
+		Gravity = 0.0;
+		HeaterSchedule = 0.0;
+		HeaterLoad = 0.0;
+		HumRatioAirWalkIn = 0.0;
+		HumRatioZoneAir = 0.0;
+		IceSensHeatNeeded = 0.0;
+		LatentCapApplied = 0.0;
+		LatentLoadTotal = 0.0;
+		LightLoad = 0.0;
+		CalculateWalkInLightingSchedule = 0.0;
+		CalculateWalkInLoadRequested = 0.0;
+		LoadTotal = 0.0;
+		MassDryAirRate = 0.0;
+		MaxCap = 0.0;
+		SensibleCapApplied = 0.0;
+		CalculateWalkInSensibleLoadTotal = 0.0;
+		CalculateWalkInStoredEnergyRate = 0.0;
+		StartIceTemp = 0.0;
+		CalculateWalkInStartFrostKg = 0.0;
+		StockDoorInfLoad = 0.0;
+		StockDoorSensHeat = 0.0;
+		StockDoorArea = 0.0;
+		CalculateWalkInStockingLoad = 0.0;
+		TWalkIn = 0.0;
+		UAOtherSurfaces = 0.0;
+		WalkInSchedule = 0.0;
+		WalkInSensLoad = 0.0;
+		WalkInLatLoad = 0.0;
+		WaterRemovRate = 0.0;
+		ZoneDryBulb = 0.0;
+		ZoneSensLoad = 0.0;
+		ZoneLatentLoad = 0.0;
+		ZoneRHFrac = 0.0;
+		ZoneInfilLoad = 0.0;
+		ZInfilSensLoad = 0.0;
+		ZdoorSensLoad = 0.0;
+		CalculateSecondaryLoadRequested = 0.0;
+		CalculateSecondaryLocalTimeStep = 0.0;
+		SumZoneImpactsZoneNum = 0;
+		CalculateAirChillerSetsCoilID = 0;
+		CalculateAirChillerSetsCoilIndex = 0;
+		AirChillerSetSchedule = 0.0;
+		QZNReqSens = 0.0;
+		RemainQZNReqSens = 0.0;
+		FinalRateCoilsNumCoils = 0;
+		FinalRateCoilsCoilID = 0;
+		FinalRateCoilsCoilIndex = 0;
+		DeRateFactor = 0.0;
+		InitLatCreditEnergy = 0.0;
+		InitKgFrost = 0.0;
+		FrostReduction = 0.0;
+		CalculateCoilUnitLoadFactorSens = 0.0;
+		FanSpeedControlType = 0;
+		SHRCorrectionCurvePtr = 0;
+		SHRCorrectionType = 0;
+		CalculateCoilZoneNodeNum = 0;
+		AirVolRatio = 0.0;
+		AirVolumeFlowMax = 0.0;
+		AirVolumeFlowRated = 0.0;
+		CalculateCoilAvailDefrostEnergy = 0.0;
+		CapFac = 0.0;
+		CoilCapTotal = 0.0;
+		CoilCapTotEstimate = 0.0;
+		CoilInletCp = 0.0;
+		CoilInletDensity = 0.0;
+		CoilInletDryAirCp = 0.0;
+		CoilInletDryAirDensity = 0.0;
+		CoilInletHumRatio = 0.0;
+		CoilInletTemp = 0.0;
+		CoilInletEnthalpy = 0.0;
+		CoilInletRHFrac = 0.0;
+		CoilSchedule = 0.0;
+		CoolingLoadNet = 0.0;
+		CalculateCoilDefrostCap = 0.0;
+		CalculateCoilDefrostEnergy = 0.0;
+		CalculateCoilDefEnergyFraction = 0.0;
+		CalculateCoilDefrostLoad = 0.0;
+		CalculateCoilDefrostSchedule = 0.0;
+		CalculateCoilDefrostDripDownSchedule = 0.0;
+		CalculateCoilDefrostEnergyNeeded = 0.0;
+		DefrostRateNeeded = 0.0;
+		DryAirMassFlowMax = 0.0;
+		DryAirMassFlowRated = 0.0;
+		ExitHumRatio = 0.0;
+		ExitTemperature = 0.0;
+		ExitTemperatureEstimate = 0.0;
+		ExitEnthalpy = 0.0;
+		ExitEnthalpyEstimate = 0.0;
+		FanMinAirFlowRatio = 0.0;
+		FanPowerActual = 0.0;
+		FanPowerRated = 0.0;
+		FanPowerMax = 0.0;
+		FanPowerRatio = 0.0;
+		CalculateCoilFrostChangekg = 0.0;
+		CalculateCoilHeaterSchedule = 0.0;
+		CalculateCoilHeaterLoad = 0.0;
+		CalculateCoilIceSensHeatNeeded = 0.0;
+		LatLoadServed = 0.0;
+		MaxTemperatureDif = 0.0;
+		SensibleCapacityMax = 0.0;
+		SensLoadRequested = 0.0;
+		SensLoadFromZone = 0.0;
+		SensLoadRequestedGross = 0.0;
+		SensLoadGross = 0.0;
+		SHR = 0.0;
+		SHRCorrection = 0.0;
+		SHRCorrection60 = 0.0;
+		Slope = 0.0;
+		CalculateCoilStartIceTemp = 0.0;
+		CalculateCoilStartFrostKg = 0.0;
+		TemperatureDif = 0.0;
+		TEvap = 0.0;
+		CalculateCoilWaterRemovRate = 0.0;
+		Yint = 0.0;
+		ZoneDryAirDensity = 0.0;
+		ZoneMixedAirCp = 0.0;
+		ZoneMixedAirDensity = 0.0;
+		ZoneMixedAirDryBulb = 0.0;
+		ZoneMixedAirRHFrac = 0.0;
+		ZoneMixedAirEnthalpy = 0.0;
+		ZoneMixedAirHumRatio = 0.0;
+		MyEnvrnFlag = true;
+		ZeroHVACValuesDemandARRID = 0;
+		TankID = 0;
+		ZeroHVACValuesRackNum = 0;
+		ZeroHVACValuesCondID = 0;
+		PlantInletNode = 0;
+		PlantOutletNode = 0;
+		PlantLoopIndex = 0;
+		PlantLoopSideIndex = 0;
+		PlantBranchIndex = 0;
+		PlantCompIndex = 0;
+		ZeroHVACValuesMassFlowRate = 0.0;
+	}
+
 	void
 	ManageRefrigeratedCaseRacks()
 	{
@@ -546,7 +1569,6 @@ namespace RefrigeratedCase {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		int RackNum; // Index to the refrigerated compressor rack being modeled
-		static bool MyOneTimeFlag( true ); // flag to skip first pass on next begin environment flag
 
 		if ( ! ManageRefrigeration ) return;
 
@@ -573,6 +1595,10 @@ namespace RefrigeratedCase {
 		}
 		if ( ! BeginEnvrnFlag ) MyOneTimeFlag = true;
 
+		// Evaluate the zone air state once for all the cases and walk-ins located in each zone
+		//  (cases and walk-ins are only simulated on the zone time step, not on the air chiller calls)
+		if ( HaveCasesOrWalkins && ! UseSysTimeStep ) CalcRefrigZoneAirStates();
+
 		if ( HaveRefrigRacks ) {
 			for ( RackNum = 1; RackNum <= NumRefrigeratedRacks; ++RackNum ) {
 				CalcRackSystem( RackNum );
@@ -692,186 +1718,16 @@ namespace RefrigeratedCase {
 		Array1D_string Alphas; // Alpha items for object
 		Array1D_string cAlphaFieldNames; // Alpha field names (from input processor)
 		Array1D_string cNumericFieldNames; // Numeric field names (from input processor)
-		static std::string CurrentModuleObject; // Object type for getting and error messages
 
 		Array1D_bool lAlphaBlanks; // Logic array, alpha input blank = .TRUE.
 		Array1D_bool lNumericBlanks; // Logic array, numeric input blank = .TRUE.
-		static bool CaseLoads( false ); // Flag to help verify load type with loads served by systems cooled by cascade condensers
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
-		static bool IsNotOK( false ); // Flag to verify name
-		static bool IsBlank( false ); // Flag for blank name
-		static bool StartCycle( false ); // Flag for counting defrost cycles
-
-		static int AlphaListNum( 0 ); // Index of Names in Case, Compressor et al Lists
-		static int AlphaNum( 0 ); // Used to cycle through input
-		static int AlphaStartList( 0 );
-		static int AStart( 0 ); // Used to cycle through zones on input for walk in coolers
+
 		//INTEGER    :: CascadeCondenserID= 0       ! Used to match load on system to Condenser absolute index
-		static int CascadeLoadNum( 0 ); // counters while associating cascade loads with systems
-		static int CascadeLoadIndex( 0 ); // Counters while inputting cascade loads
-		static int CaseID( 0 ); // ID of refrigerated case in rack
-		static int CaseIndex( 0 ); // Index of refrigerated case attached to a system
-		static int CaseNum( 0 ); // Index of refrigerated case
-		static int CaseAndWalkInListNum( 0 ); // ID of refrigerated CaseAndWalkInList
-		static int ChillerIndex( 0 );
-		static int CoilID( 0 ); // Index of warehouse coil attached to a system
-		static int CoilIndex( 0 ); // Index of warehouse coil attached to a system
-		static int CoilNum( 0 ); // Index of warehouse coil
-		static int CompIndex( 0 ); // Index  of refrigeration compressor attached to a system
-		static int CompNum( 0 ); // Index of refrigeration compressor
-		static int CondID( 0 ); // Condenser ID used when associating condenser as a cascade load
-		static int CondIndex( 0 ); // Index  of refrigeration condenser attached to a system
-		static int CondNum( 0 ); // Index of refrigeration condenser
-		static int DefType( 0 ); // Local value for case defrost type
 		//INTEGER    :: FlowIndex         = 0       ! Index of pump flow numeric field
-		static int GCNum( 0 ); // Index of refrigeration gas cooler
-		static int HRNum( 0 ); // Counter for hours in day
-		static int IOStatus( 0 ); // Used in GetObjectItem
-		static int ListNum( 0 ); // Index of Lists of cases, compressors, and subcoolers
-		static int LoadCascadeNum( 0 ); // Used to read transfer load list
-		static int LoadCount( 0 ); // check for blank case and walkin names in caseand alkinlist
-		static int LoadSecondaryNum( 0 ); // Used to read transfer load list
-		static int LoadWalkInNum( 0 ); // Used to read CaseAndWalkInList
-		static int LoadCaseNum( 0 ); // Used to read CaseAndWalkInList
-		static int LoadCoilNum( 0 ); // Used to read CaseAndWalkInList
-		static int MaxNumAlphasRack( 0 ); // Maximum number of alphas for rack object
-		static int MaxNumAlphasAirChiller( 0 ); // Maximum number of alphas for air chiller
-		static int MaxNumAlphasAll( 0 ); // Maximum number of alphas for all objects
-		static int MaxNumAlphasSys( 0 ); // Maximum number of alphas for system object
-		static int MaxNumAlphasTransSys( 0 ); // Maximum number of alphas for transcritical system object
-		static int MaxNumAlphasChillerSet( 0 ); // Maximum number of alphas for chiller set
-		static int MaxNumAlphasConda( 0 ); // Maximum number of alphas for air-cooled condenser object
-		static int MaxNumAlphasConde( 0 ); // Maximum number of alphas for evap-cooled condenser object
-		static int MaxNumAlphasCondw( 0 ); // Maximum number of alphas for water-cooled condenser object
-		static int MaxNumAlphasGasCoolera( 0 ); // Maximum number of alphas for air-cooled gas cooler object
-		static int MaxNumAlphasComp( 0 ); // Maximum number of alphas for compressor object
-		static int MaxNumAlphasCompressorList( 0 ); // Maximum number of alphas for compressor list objects
-		static int MaxNumAlphasCase( 0 ); // Maximum number of alphas for case object
-		static int MaxNumAlphasCaseAndWalkInList( 0 ); // Maximum number of alphas in CaseAndWalkInList
-		static int MaxNumAlphasWalkIn( 0 ); // Maximum number of alphas for walkin object
 		//INTEGER    :: MaxNumAlphasWalkInList  = 0 ! Maximum number of alphas for walkin list object
-		static int MaxNumAlphasSecond( 0 ); // Maximum number of alphas for air chiller object
-		static int MaxNumNumbersAirChiller( 0 ); // Maximum number of numbers for air chiller object
-		static int MaxNumNumbersSecond( 0 ); // Maximum number of numbers for secondary system object
-		static int MaxNumNumbersWalkIn( 0 ); // Maximum number of numbers for walkin object
-		static int MaxNumNumbersCase( 0 ); // Maximum number of numbers for case object
-		static int MaxNumNumbersCaseAndWalkInList( 0 ); // Maximum number of numbers in CaseAndWalkInList
-		static int MaxNumNumbersRack( 0 ); // Maximum number of numbers for rack object
-		static int MaxNumNumbersAll( 0 ); // Maximum number of numeric inputs for all objects
-		static int MaxNumNumbersSys( 0 ); // Maximum number of numbers for system object
-		static int MaxNumNumbersTransSys( 0 ); // Maximum number of numbers for transcritical system object
-		static int MaxNumNumbersChillerSet( 0 ); // Maximum number of numbers for chiller set object
-		static int MaxNumNumbersConda( 0 ); // Maximum number of numbers for air-cooled condenser object
-		static int MaxNumNumbersConde( 0 ); // Maximum number of numbers for evap-cooled condenser object
-		static int MaxNumNumbersCondw( 0 ); // Maximum number of numbers for water-cooled condenser object
-		static int MaxNumNumbersGasCoolera( 0 ); // Maximum number of numbers for air-cooled gas cooler object
-		static int MaxNumNumbersComp( 0 ); // Maximum number of numbers for compressor object
-		static int MaxNumNumbersCompressorList( 0 ); // Maximum number of numbers
-		static int MaxNumArgs( 0 ); // Max number of alphas and numbers (arguments) for rack object
-		static int NStart( 0 ); // Used to cycle through zones on input for walk in coolers
-		static int NumAlphas( 0 ); // Number of Alphas for each GetObjectItem call
-		static int NumCascadeLoad( 0 ); // Number of Cascade Loads on current system
-		static int NumCompressorsSys( 0 ); // Number of compressors on current system
-		static int NumHiStageCompressorsSys( 0 ); // Number of high-stage compressors on current system
-		static int NumCondensers( 0 ); // Counter for condensers in GETInput do loop
-		static int NumGasCoolers( 0 ); // Counter for gas coolers in GetInput do loop
-		static int NumDefCycles( 0 ); // Number of defrost cycles per day
-		static int NumPumps( 0 ); // Number of pumps on a secondary loop
-		static int NumCases( 0 ); // Number of refrigerated cases for single system
-		static int NumCasesMT( 0 ); // Number of medium temperature cases on a single transcritical system
-		static int NumCasesLT( 0 ); // Number of low temperature cases on a single transcritical system
-		static int NumCoils( 0 ); // Number of warehouse coils for single system
-		static int NumSubcooler( 0 ); // Number of subcoolers on current system
-		static int NumNameMatches( 0 ); // Used to check for uniqueness of name for transfer loads
-		static int NumNum( 0 ); // Used to cycle through input
-		static int NumNumbers( 0 ); // Number of Numbers for each GetObjectItem call
-		static int NumCompressorLists( 0 ); // Total number of Compressor Lists in IDF
-		static int NumDisplayCases( 0 ); // Counter for refrigerated cases in GetInput do loop
-		static int NumSecondary( 0 ); // Number of secondary loops
-		static int NumWalkIns( 0 ); // Number of walk ins
-		static int NumWalkInsMT( 0 ); // Number of medium temperature walk-ins on a single transcritical system
-		static int NumWalkInsLT( 0 ); // Number of low temperature walk-ins on a single transcritical system
-		static int NumWIFieldsPerZone( 0 ); // Used to calculate number of zones exposed to each walkin
-		static int NumWIFieldsTotal( 0 ); // Used to calculate number of zones exposed to each walkin
-		static int NumZones( 0 ); // Used to cycle through zones on input for walk in coolers
-		static int NumTotalLoadsOnList( 0 ); // Used to read transfer load and caseandWalkIn lists
-		static int NumSecondarysOnList( 0 ); // Used to read transfer load lists
-		static int NumCascadeLoadsChecked( 0 ); // Used when checking for consistency of coil loads/time steps
-		static int NumCascadeLoadsOnList( 0 ); // Used to read transfer load lists
-		static int NumLoad( 0 ); // Used to read transfer loadand caseandWalkIn lists
-		static int NumCasesOnList( 0 ); // Used to read caseandWalkIn lists
-		static int NumChillersInSet( 0 );
-		static int NumCoilsOnList( 0 ); // Used to read caseandWalkIn lists
-		static int NumWalkInsOnList( 0 ); // Used to read caseandWalkIn lists
-		static int RackNum( 0 ); // Index of refrigerated display case compressor rack
-		static int RefrigIndex( 0 ); // Index used in fluid property routines
-		static int RefrigSysNum( 0 ); // Index of refrigeration system
-		static int TransRefrigSysNum( 0 ); // Index of transcritical CO2 refrigeration system
-		static int SecondaryIndex( 0 ); // Index of secondary loops
-		static int SecondaryID( 0 ); // Index of secondary loops
-		static int SetID( 0 ); // Index of refrigerated chilller SETS
-		static int SecondaryNum( 0 ); // Index of secondary loops
 		//INTEGER    :: TransferLoadListIndex = 0      ! Index of TransferLoad lists
 		//INTEGER    :: TransferLoadListID    = 0      ! Index of TransferLoad lists
-		static int TransferLoadListNum( 0 ); // Index of TransferLoad lists
 		//  INTEGER    :: InputType         = 0       ! Type of inlet, capcity in W or brine flow rate in m3/s
-		static int SubcoolerNum( 0 ); // Index of subcooler
-		static int TSNum( 0 ); // Counter for time steps in hour
-		static int WalkInIndex( 0 ); // Index of walk ins
-		static int WalkInID( 0 ); // Index of walk ins
-		static int WalkInNum( 0 ); // Index of walk ins
-		static int TotFields( 0 ); // Used to calc number of zones on input for walk in coolers
-		static int ZoneID( 0 ); // Index to zone
-		static int ZoneIndex( 0 ); // Index to zone
-		static int ZoneNum( 0 ); // Index to zone
-		static Real64 CalcCircRate( 0.0 ); // Calculted circ rate in secondary phase change loop, dimensionless
-		static Real64 CalcTotFlowVol( 0.0 ); // Secondary loop flow in phase change liquid overfeed system (m3/s)
-		static Real64 CaseHeatGain( 0.0 ); // Case sensible heat gain used for error messages
-		static Real64 CapacityAtMaxVolFlow( 0.0 ); // Secondary loop capacity (W)
-		static Real64 CpBrineRated( 0.0 ); // specific heat of circ fluid in secondary loop
-		static Real64 Capmin( 0.0 ); // min heat rej for heat rej curve for air cooled condenser (W)
-		static Real64 Capmax( 0.0 ); // max heat rej for heat rej curve for air cooled condenser (W)
-		static Real64 DeltaCap1( 0.0 ); // fraction dif in capacity for input error check
-		static Real64 DeltaCap2( 0.0 ); // fraction dif in capacity for input error check
-		static Real64 DeltaHPhaseChange( 0.0 ); // Secondary loop enthalpy change in condenser w overfeed system (J/g)
-		static Real64 DelTempMin( 0.0 ); // min temperature for heat rej curve for air cooled condenser (C)
-		static Real64 DelTempMax( 0.0 ); // max temperature for heat rej curve for air cooled condenser (C)
-		static Real64 DensityBrineRated( 0.0 ); // density of circ fluid in secondary loop
-		static Real64 DensityPhaseChange( 0.0 ); // Secondary loop density at condensing temperature w overfeed system (g/m3)
-		static Real64 DesignSensibleCap( 0.0 ); // Case sensible capacity used for error messages
-		static Real64 DiffCircRates( 0.0 ); // Difference between calculated and specified circ rates, fraction
-		static Real64 ErrSecondPumpPower( 0.0 ); // Used to check consistency when both head and power input
-		static Real64 FlowMassRated( 0.0 ); // Design mass flow rate of circ fluid in secondary loop(kg/s)
-		static Real64 GCOutletH( 0.0 ); // Gas cooler outlet enthalpy (J/kg)
-		static Real64 NominalSecondaryCapacity( 0.0 ); // Rated Capacity from input data, W
-		static Real64 NominalSecondaryRefLoad( 0.0 ); // Load from all connected cases and walkins, W
-		static Real64 NominalTotalCascadeLoad( 0.0 ); // Load from all connected cascade condensers, W
-		static Real64 NominalTotalCaseCap( 0.0 ); // Total of nominal case capacities, used for rough input check (W)
-		static Real64 NominalTotalCoilCap( 0.0 ); // Total of nominal case capacities, used for rough input check (W)
-		static Real64 NominalTotalWalkInCap( 0.0 ); // Total of nominal walk-in capacities, used for rough input check (W)
-		static Real64 NominalTotalSecondaryCap( 0.0 ); // Total of nominal secondary capacities, used for rough input check (W)
-		static Real64 NominalTotalCaseCapMT( 0.0 ); // Total of nominal medium temperature case capacities, used for rough input check (W) (Transcritical CO2)
-		static Real64 NominalTotalCaseCapLT( 0.0 ); // Total of nominal low temperature case capacities, used for rough input check (W) (Transcritical CO2)
-		static Real64 NominalTotalWalkInCapMT( 0.0 ); // Total of nominal medium temperature walk-in capacities, used for rough input check (W) (Transcritical CO2)
-		static Real64 NominalTotalWalkInCapLT( 0.0 ); // Total of nominal low temperature walk-in capacities, used for rough input check (W) (Transcritical CO2)
-		static Real64 NominalTotalCoolingCap( 0.0 ); // Total of nominal load capacities, used for rough input check (W)
-		static Real64 NominalTotalCompCap( 0.0 ); // Total of nominal compressor capacities, used for rough input check (W)
-		static Real64 NominalTotalHiStageCompCap( 0.0 ); // Total of nominal high-stage compressor capacities, used for rough input check (W)
-		static Real64 NominalTotalCompCapHP( 0.0 ); // Total of nominal high pressure compressor capacities, used for rough input check (W) (Transcritical CO2)
-		static Real64 NominalTotalCompCapLP( 0.0 ); // Total of nominal low pressure compressor capacities, used for rough input check (W) (Transcritical CO2)
-		static Real64 NominalCondCap( 0.0 ); // Nominal Condenser capacity, used for rough input check (W)
-		static Real64 PCond( 0.0 ); // Condensing Pressure (Pa)
-		static Real64 PEvap( 0.0 ); // Evaporating Pressure (Pa)
-		static Real64 PumpTotRatedHead( 0.0 ); // Total pump rated head on secondary loop (Pa)
-		static Real64 PumpTotRatedFlowVol( 0.0 ); // Rated flow from input pump data, m3/s
-		static Real64 Rcase( 0.0 ); // Case thermal resistance used with anti-sweat heater control
-		static Real64 RcaseDenom( 0.0 ); // Denominator of case thermal resistance calculation for anti-sweat
-		static Real64 SecondaryFlowVolRated( 0.0 ); // Rated flow of secondary fluid, used to calculate capacity (m3/s)
-		static Real64 TBrineOutRated( 0.0 ); // Rated temperature of circ fluid LEAVING heat exchanger,C
-		static Real64 TBrineInRated( 0.0 ); // Rated temperature of circ fluid going INTO heat exchanger, C
-		static Real64 TBrineAverage( 0.0 ); // Rated average of inlet and outlet temps, used for property look up, C
-		static Real64 TempRAFraction( 0.0 ); // Temporary sum of Return Air fraction per zone for reporting
-		static Real64 TestDelta( 0.0 ); // Used to compare secondary loop rated capacity to calculated capacity, fraction
 		Array1D< Real64 > Numbers; // Numeric items for object
 		Array2D< Real64 > DayValues; // Array of schedule values
 
@@ -1002,7 +1858,7 @@ namespace RefrigeratedCase {
 				if ( IsNotOK ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( AlphaNum ) + "\", invalid " + cAlphaFieldNames( AlphaNum ) + "+\"" + Alphas( AlphaNum ) );
 					if ( IsBlank ) Alphas( 1 ) = "xxxxx";
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 				RefrigCase( CaseNum ).Name = Alphas( AlphaNum );
 
@@ -1011,7 +1867,7 @@ namespace RefrigeratedCase {
 					RefrigCase( CaseNum ).SchedPtr = GetScheduleIndex( Alphas( AlphaNum ) ); // convert schedule name to pointer
 					if ( RefrigCase( CaseNum ).SchedPtr == 0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} // ptr == 0
 				} else { // no schedule specified
 					RefrigCase( CaseNum ).SchedPtr = AlwaysOn;
@@ -1023,7 +1879,7 @@ namespace RefrigeratedCase {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\"" );
 						ShowContinueError( "Error found in " + cAlphaFieldNames( AlphaNum ) + " = " + Alphas( AlphaNum ) );
 						ShowContinueError( "schedule values must be (>=0., <=1.)" );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 
@@ -1033,7 +1889,7 @@ namespace RefrigeratedCase {
 
 				if ( RefrigCase( CaseNum ).ActualZoneNum == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", invalid  " + cAlphaFieldNames( 3 ) + " not valid: " + Alphas( 3 ) );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				} else {
 					RefrigPresentInZone( RefrigCase( CaseNum ).ActualZoneNum ) = true;
 				}
@@ -1045,51 +1901,51 @@ namespace RefrigeratedCase {
 					if ( RefrigCase( CaseNum ).ZoneNodeNum == 0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", System Node Number not found for " + cAlphaFieldNames( 3 ) + " = " + Alphas( 3 ) );
 						ShowContinueError( "..Refrigerated cases must reference a controlled Zone (appear in a ZoneHVAC:EquipmentConnections object)." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 
 				RefrigCase( CaseNum ).RatedAmbientTemp = Numbers( 1 );
 				if ( Numbers( 1 ) <= 0.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( 1 ) + " must be greater than 0 C" );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				RefrigCase( CaseNum ).RatedAmbientRH = Numbers( 2 );
 				if ( Numbers( 2 ) <= 0.0 || Numbers( 2 ) >= 100.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( 2 ) + " must be greater than 0% and less than 100%" );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 				RefrigCase( CaseNum ).RatedAmbientDewPoint = PsyTdpFnWPb( PsyWFnTdbRhPb( RefrigCase( CaseNum ).RatedAmbientTemp, ( RefrigCase( CaseNum ).RatedAmbientRH / 100.0 ), StdBaroPress ), StdBaroPress );
 
 				RefrigCase( CaseNum ).RateTotCapPerLength = Numbers( 3 );
 				if ( Numbers( 3 ) <= 0.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( 3 ) + " must be greater than 0 W/m" );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				RefrigCase( CaseNum ).RatedLHR = Numbers( 4 );
 				if ( Numbers( 4 ) < 0.0 || Numbers( 4 ) > 1.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( 4 ) + " must be >= 0 and <= 1" );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				RefrigCase( CaseNum ).RatedRTF = Numbers( 5 );
 				if ( Numbers( 5 ) <= 0.0 || Numbers( 5 ) > 1.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( 5 ) + " must be > 0 and <= to 1" );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				RefrigCase( CaseNum ).Length = Numbers( 6 );
 				if ( Numbers( 6 ) <= 0.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( 6 ) + " must be greater than 0 m" );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				RefrigCase( CaseNum ).Temperature = Numbers( 7 );
 				if ( RefrigCase( CaseNum ).Temperature >= RefrigCase( CaseNum ).RatedAmbientTemp ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( 7 ) + " must be below " + cNumericFieldNames( 1 ) );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				if ( SameString( Alphas( 4 ), "CaseTemperatureMethod" ) ) {
@@ -1100,18 +1956,18 @@ namespace RefrigeratedCase {
 					RefrigCase( CaseNum ).LatentEnergyCurveType = DPCubic;
 				} else {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", invalid  " + cAlphaFieldNames( 4 ) + "=\"" + Alphas( 4 ) + "\"." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				RefrigCase( CaseNum ).LatCapCurvePtr = GetCurveIndex( Alphas( 5 ) ); // convert curve name to number
 				if ( RefrigCase( CaseNum ).LatCapCurvePtr == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", invalid  " + cAlphaFieldNames( 5 ) + " not found:" + Alphas( 5 ) );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				if ( ! SameString( GetCurveType( RefrigCase( CaseNum ).LatCapCurvePtr ), "CUBIC" ) ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", invalid  " + cAlphaFieldNames( 5 ) + " object must be of type Cubic." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				NumNum = 8;
@@ -1119,7 +1975,7 @@ namespace RefrigeratedCase {
 					RefrigCase( CaseNum ).STDFanPower = Numbers( NumNum );
 					if ( Numbers( NumNum ) < 0.0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be greater than or equal to 0 W/m" );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else { //blank use default of 75 W/m
 					RefrigCase( CaseNum ).STDFanPower = 75.0;
@@ -1130,7 +1986,7 @@ namespace RefrigeratedCase {
 					RefrigCase( CaseNum ).OperatingFanPower = Numbers( NumNum );
 					if ( Numbers( NumNum ) < 0.0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be greater than or equal to 0 W/m" );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else { // if blank set = to std fan power
 					RefrigCase( CaseNum ).OperatingFanPower = RefrigCase( CaseNum ).STDFanPower;
@@ -1141,7 +1997,7 @@ namespace RefrigeratedCase {
 					RefrigCase( CaseNum ).RatedLightingPower = Numbers( NumNum );
 					if ( Numbers( NumNum ) < 0.0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be greater than or equal to 0 W/m" );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else { //blank input - use default of 90 W/m
 					RefrigCase( CaseNum ).RatedLightingPower = 90.0;
@@ -1152,7 +2008,7 @@ namespace RefrigeratedCase {
 					RefrigCase( CaseNum ).LightingPower = Numbers( NumNum );
 					if ( Numbers( NumNum ) < 0.0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be greater than or equal to 0 W/m" );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else { // blank input so set lighting power equal to rated/std lighting power
 					RefrigCase( CaseNum ).LightingPower = RefrigCase( CaseNum ).RatedLightingPower;
@@ -1162,7 +2018,7 @@ namespace RefrigeratedCase {
 					RefrigCase( CaseNum ).LightingSchedPtr = GetScheduleIndex( Alphas( 6 ) ); // convert schedule name to pointer
 					if ( RefrigCase( CaseNum ).LightingSchedPtr == 0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", invalid  " + cAlphaFieldNames( 6 ) + " not found: " + Alphas( 6 ) );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} // ptr == 0
 				} else { // no schedule specified
 					RefrigCase( CaseNum ).LightingSchedPtr = AlwaysOn;
@@ -1174,7 +2030,7 @@ namespace RefrigeratedCase {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\"" );
 						ShowContinueError( "Error found in " + cAlphaFieldNames( 6 ) + " = " + Alphas( 6 ) );
 						ShowContinueError( "schedule values must be (>=0., <=1.)" );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 
@@ -1187,21 +2043,21 @@ namespace RefrigeratedCase {
 				if ( RefrigCase( CaseNum ).LightingFractionToCase < 0.0 || RefrigCase( CaseNum ).LightingFractionToCase > 1.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( NumNum ) + " has a value outside the valid range" );
 					ShowContinueError( "  Minimum should be >= 0.0 and Maximum should be <= 1.0" );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				NumNum = 13;
 				RefrigCase( CaseNum ).AntiSweatPower = Numbers( NumNum );
 				if ( Numbers( NumNum ) < 0.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be greater than or equal to 0 W/m" );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				NumNum = 14;
 				RefrigCase( CaseNum ).MinimumASPower = Numbers( NumNum );
 				if ( Numbers( NumNum ) < 0.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be greater than or equal to 0 W/m" );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				if ( SameString( Alphas( 7 ), "None" ) ) {
@@ -1217,13 +2073,13 @@ namespace RefrigeratedCase {
 					RefrigCase( CaseNum ).AntiSweatControlType = ASHeatBalance;
 				} else {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", invalid  " + cAlphaFieldNames( 7 ) + "=\"" + Alphas( 7 ) + "\"." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				//   Assure that case temperature is below the rated dew point when anti-sweat heater control type is dew point method
 				if ( RefrigCase( CaseNum ).Temperature >= RefrigCase( CaseNum ).RatedAmbientDewPoint && RefrigCase( CaseNum ).AntiSweatControlType == ASDewPoint ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( 7 ) + " must be below the Rated Ambient Dew Point when " + cAlphaFieldNames( 7 ) + " is Dew Point Method" );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				NumNum = 15;
@@ -1234,20 +2090,20 @@ namespace RefrigeratedCase {
 				if ( RefrigCase( CaseNum ).HumAtZeroAS >= RefrigCase( CaseNum ).RatedAmbientRH && RefrigCase( CaseNum ).AntiSweatControlType == ASLinear ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be less than " + cNumericFieldNames( 2 ) );
 					ShowContinueError( " for Linear " + cAlphaFieldNames( 7 ) + '.' );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				NumNum = 16;
 				RefrigCase( CaseNum ).Height = Numbers( NumNum );
 				if ( Numbers( NumNum ) < 0.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be greater than or equal to 0 m" );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				if ( RefrigCase( CaseNum ).Height <= 0.0 && RefrigCase( CaseNum ).AntiSweatControlType == ASHeatBalance ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be greater than 0 when " + cAlphaFieldNames( 7 ) + " is Heat Balance Method." );
 					ShowContinueError( "..given " + cNumericFieldNames( NumNum ) + " was: " + RoundSigDigits( RefrigCase( CaseNum ).Height, 3 ) );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				//   initialize case resistance for anti-sweat heater control type = Heat Balance Method
@@ -1270,7 +2126,7 @@ namespace RefrigeratedCase {
 				RefrigCase( CaseNum ).ASHeaterFractionToCase = Numbers( NumNum );
 				if ( Numbers( NumNum ) < 0.0 || Numbers( NumNum ) > 1.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be >= 0 and <= 1" );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				if ( SameString( Alphas( 8 ), "None" ) ) {
@@ -1301,7 +2157,7 @@ namespace RefrigeratedCase {
 					RefrigCase( CaseNum ).DefrostPower = Numbers( NumNum );
 					if ( Numbers( NumNum ) < 0.0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be greater than or equal to 0 W/m" );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 					//   disregard defrost power for Off-Cycle or None defrost types
 					if ( ( DefType == DefOffCycle || DefType == DefNone ) && ( RefrigCase( CaseNum ).DefrostPower > 0.0 ) ) {
@@ -1315,14 +2171,14 @@ namespace RefrigeratedCase {
 				//defrost power needed to calculate heat gain to case even if not needed for electric consumption
 				if ( ( DefType == DefHotFluid || DefType == DefHotFluidTerm || DefType == DefElectric || DefType == DefElectricTerm ) && RefrigCase( CaseNum ).DefrostPower <= 0.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be greater than 0 W/m for " + cAlphaFieldNames( 8 ) + ' ' + Alphas( 8 ) );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				RefrigCase( CaseNum ).DefrostSchedPtr = GetScheduleIndex( Alphas( 9 ) ); // convert schedule name to pointer
 				if ( RefrigCase( CaseNum ).DefrostSchedPtr == 0 && RefrigCase( CaseNum ).DefrostType != DefNone ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", invalid  " + cAlphaFieldNames( 9 ) + " not found: " + Alphas( 9 ) );
 					ShowContinueError( "required when " + cAlphaFieldNames( 8 ) + "=\"" + Alphas( 8 ) + "\"." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				//   check defrost schedule for values between 0 and 1
@@ -1331,7 +2187,7 @@ namespace RefrigeratedCase {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\"." );
 						ShowContinueError( "Error found in " + cAlphaFieldNames( 9 ) + " = " + Alphas( 9 ) );
 						ShowContinueError( "schedule values must be (>=0., <=1.)" );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 				//   Note that next section counting number cycles and setting maxkgfrost not used now, but may be in the future.
@@ -1365,7 +2221,7 @@ namespace RefrigeratedCase {
 					RefrigCase( CaseNum ).DefrostDripDownSchedPtr = GetScheduleIndex( Alphas( 10 ) ); // convert schedule name to pointer
 					if ( RefrigCase( CaseNum ).DefrostDripDownSchedPtr == 0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", invalid  " + cAlphaFieldNames( 10 ) + " not found: " + Alphas( 10 ) );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else {
 					RefrigCase( CaseNum ).DefrostDripDownSchedPtr = RefrigCase( CaseNum ).DefrostSchedPtr;
@@ -1377,7 +2233,7 @@ namespace RefrigeratedCase {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\"." );
 						ShowContinueError( "Error found in " + cAlphaFieldNames( 10 ) + " = " + Alphas( 10 ) );
 						ShowContinueError( "schedule values must be (>=0., <=1.)" );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 
@@ -1391,19 +2247,19 @@ namespace RefrigeratedCase {
 					RefrigCase( CaseNum ).DefrostEnergyCurveType = None;
 				} else {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", invalid  " + cAlphaFieldNames( 11 ) + "=\"" + Alphas( 11 ) + "\"." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				RefrigCase( CaseNum ).DefCapCurvePtr = GetCurveIndex( Alphas( 12 ) ); // convert curve name to number
 				if ( ( RefrigCase( CaseNum ).DefrostType == DefElectricTerm || RefrigCase( CaseNum ).DefrostType == DefHotFluidTerm ) && ( RefrigCase( CaseNum ).DefCapCurvePtr == 0 ) ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", invalid  " + cAlphaFieldNames( 12 ) + " not found:" + Alphas( 12 ) );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				if ( RefrigCase( CaseNum ).DefCapCurvePtr > 0 ) {
 					if ( ! SameString( GetCurveType( RefrigCase( CaseNum ).DefCapCurvePtr ), "CUBIC" ) ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", invalid  " + cAlphaFieldNames( 12 ) + " must be of type Cubic." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 
@@ -1419,7 +2275,7 @@ namespace RefrigeratedCase {
 				RefrigCase( CaseNum ).RAFrac = Numbers( NumNum );
 				if ( Numbers( NumNum ) < 0.0 || Numbers( NumNum ) > 1.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be >= 0 or <= 1 " );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				// set flag in Zone Data if RAFrac > 0
@@ -1430,7 +2286,7 @@ namespace RefrigeratedCase {
 				//   Make sure RA node exists for display cases with under case HVAC returns
 				if ( RefrigCase( CaseNum ).ZoneRANode == 0 && RefrigCase( CaseNum ).RAFrac > 0.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", " + cNumericFieldNames( 18 ) + " not applicable to zones without return air systems." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				if ( RefrigCase( CaseNum ).ActualZoneNum != 0 ) {
@@ -1442,7 +2298,7 @@ namespace RefrigeratedCase {
 				if ( ! lAlphaBlanks( 13 ) ) {
 					if ( RefrigCase( CaseNum ).StockingSchedPtr == 0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", invalid  " + cAlphaFieldNames( 13 ) + " not found: " + Alphas( 13 ) );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else {
 					RefrigCase( CaseNum ).StockingSchedPtr = 0;
@@ -1460,14 +2316,14 @@ namespace RefrigeratedCase {
 				//   compare case loads to design capacity
 				if ( DesignSensibleCap < CaseHeatGain ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", the sum of lighting, fan, and anti-sweat heater energy is greater than refrigerated case sensible capacity" );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				RefrigCase( CaseNum ).CaseCreditFracSchedPtr = GetScheduleIndex( Alphas( 14 ) ); // convert schedule name to pointer
 				if ( ! lAlphaBlanks( 14 ) ) {
 					if ( RefrigCase( CaseNum ).CaseCreditFracSchedPtr == 0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\", invalid  " + cAlphaFieldNames( 14 ) + " not found: " + Alphas( 14 ) );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else {
 					RefrigCase( CaseNum ).CaseCreditFracSchedPtr = 0;
@@ -1479,7 +2335,7 @@ namespace RefrigeratedCase {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\"." );
 						ShowContinueError( "Error found in " + cAlphaFieldNames( 14 ) + " = " + Alphas( 14 ) );
 						ShowContinueError( "schedule values must be (>=0., <=1.)" );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 
@@ -1496,7 +2352,7 @@ namespace RefrigeratedCase {
 					RefrigCase( CaseNum ).EvapTempDesign = Numbers( NumNum );
 					if ( RefrigCase( CaseNum ).EvapTempDesign >= RefrigCase( CaseNum ).Temperature ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\" " + cNumericFieldNames( NumNum ) + " must be below " + cNumericFieldNames( 7 ) );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else {
 					RefrigCase( CaseNum ).EvapTempDesign = RefrigCase( CaseNum ).Temperature - DelEvapTDefault;
@@ -1509,7 +2365,7 @@ namespace RefrigeratedCase {
 					RefrigCase( CaseNum ).DesignRefrigInventory = RefrigCase( CaseNum ).RefrigInventory * RefrigCase( CaseNum ).Length;
 					if ( RefrigCase( CaseNum ).RefrigInventory < 0.0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigCase( CaseNum ).Name + "\" " + cNumericFieldNames( NumNum ) + " must be a positive number." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else {
 					RefrigCase( CaseNum ).RefrigInventory = 0.0;
@@ -1522,175 +2378,175 @@ namespace RefrigeratedCase {
 
 		if ( NumSimulationWalkIns > 0 ) {
 			CurrentModuleObject = "Refrigeration:WalkIn";
-			for ( WalkInID = 1; WalkInID <= NumSimulationWalkIns; ++WalkInID ) {
-				GetObjectItem( CurrentModuleObject, WalkInID, Alphas, NumAlphas, Numbers, NumNumbers, IOStatus, lNumericBlanks, lAlphaBlanks, cAlphaFieldNames, cNumericFieldNames );
+			for ( GetRefrigerationInputWalkInID = 1; GetRefrigerationInputWalkInID <= NumSimulationWalkIns; ++GetRefrigerationInputWalkInID ) {
+				GetObjectItem( CurrentModuleObject, GetRefrigerationInputWalkInID, Alphas, NumAlphas, Numbers, NumNumbers, IOStatus, lNumericBlanks, lAlphaBlanks, cAlphaFieldNames, cNumericFieldNames );
 
 				IsNotOK = false;
 				IsBlank = false;
-				VerifyName( Alphas( 1 ), WalkIn, WalkInID - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+				VerifyName( Alphas( 1 ), WalkIn, GetRefrigerationInputWalkInID - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 
 				if ( IsNotOK ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + ", has an invalid or undefined name=\"" + Alphas( 1 ) + "\"." );
 					if ( IsBlank ) Alphas( 1 ) = "xxxxx";
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
-				WalkIn( WalkInID ).Name = Alphas( 1 );
+				WalkIn( GetRefrigerationInputWalkInID ).Name = Alphas( 1 );
 
 				if ( ! lAlphaBlanks( 2 ) ) {
-					WalkIn( WalkInID ).SchedPtr = GetScheduleIndex( Alphas( 2 ) ); // convert schedule name to pointer
-					if ( WalkIn( WalkInID ).SchedPtr == 0 ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", invalid  " + cAlphaFieldNames( 2 ) + " not found: " + Alphas( 2 ) );
-						ErrorsFound = true;
+					WalkIn( GetRefrigerationInputWalkInID ).SchedPtr = GetScheduleIndex( Alphas( 2 ) ); // convert schedule name to pointer
+					if ( WalkIn( GetRefrigerationInputWalkInID ).SchedPtr == 0 ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", invalid  " + cAlphaFieldNames( 2 ) + " not found: " + Alphas( 2 ) );
+						GetRefrigerationInputErrorsFound = true;
 					} // ptr == 0
 				} else { // no schedule specified
-					WalkIn( WalkInID ).SchedPtr = AlwaysOn;
+					WalkIn( GetRefrigerationInputWalkInID ).SchedPtr = AlwaysOn;
 				} // not blank
 
 				//   check availability schedule for values between 0 and 1
-				if ( WalkIn( WalkInID ).SchedPtr > 0 ) {
-					if ( ! CheckScheduleValueMinMax( WalkIn( WalkInID ).SchedPtr, ">=", 0.0, "<=", 1.0 ) ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\"" );
+				if ( WalkIn( GetRefrigerationInputWalkInID ).SchedPtr > 0 ) {
+					if ( ! CheckScheduleValueMinMax( WalkIn( GetRefrigerationInputWalkInID ).SchedPtr, ">=", 0.0, "<=", 1.0 ) ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\"" );
 						ShowContinueError( "Error found in " + cAlphaFieldNames( 2 ) + " = " + Alphas( 2 ) );
 						ShowContinueError( "schedule values must be (>=0., <=1.)" );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 
-				WalkIn( WalkInID ).DesignRatedCap = Numbers( 1 );
+				WalkIn( GetRefrigerationInputWalkInID ).DesignRatedCap = Numbers( 1 );
 				if ( Numbers( 1 ) <= 0.0 ) {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", " + cNumericFieldNames( 1 ) + " must be greater than 0 W" );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", " + cNumericFieldNames( 1 ) + " must be greater than 0 W" );
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				if ( ! lNumericBlanks( 2 ) ) {
-					WalkIn( WalkInID ).Temperature = Numbers( 2 );
+					WalkIn( GetRefrigerationInputWalkInID ).Temperature = Numbers( 2 );
 				} else {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", " + cNumericFieldNames( 2 ) + " must be input " );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", " + cNumericFieldNames( 2 ) + " must be input " );
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				if ( ! lNumericBlanks( 3 ) ) {
-					WalkIn( WalkInID ).TEvapDesign = Numbers( 3 );
+					WalkIn( GetRefrigerationInputWalkInID ).TEvapDesign = Numbers( 3 );
 				} else {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", " + cNumericFieldNames( 3 ) + " must be input" );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", " + cNumericFieldNames( 3 ) + " must be input" );
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				if ( ! lNumericBlanks( 4 ) ) {
-					WalkIn( WalkInID ).HeaterPower = Numbers( 4 );
+					WalkIn( GetRefrigerationInputWalkInID ).HeaterPower = Numbers( 4 );
 				} else {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", " + cNumericFieldNames( 4 ) + " must be input " );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", " + cNumericFieldNames( 4 ) + " must be input " );
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				AlphaNum = 3;
 				if ( ! lAlphaBlanks( AlphaNum ) ) {
-					WalkIn( WalkInID ).HeaterSchedPtr = GetScheduleIndex( Alphas( AlphaNum ) ); // convert heater schedule name to pointer
-					if ( WalkIn( WalkInID ).HeaterSchedPtr == 0 ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
-						ErrorsFound = true;
+					WalkIn( GetRefrigerationInputWalkInID ).HeaterSchedPtr = GetScheduleIndex( Alphas( AlphaNum ) ); // convert heater schedule name to pointer
+					if ( WalkIn( GetRefrigerationInputWalkInID ).HeaterSchedPtr == 0 ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
+						GetRefrigerationInputErrorsFound = true;
 					} // ptr == 0
 				} else { // no schedule specified
-					WalkIn( WalkInID ).HeaterSchedPtr = AlwaysOn;
+					WalkIn( GetRefrigerationInputWalkInID ).HeaterSchedPtr = AlwaysOn;
 				} // not blank
 
 				//   check heater schedule for values between 0 and 1
-				if ( WalkIn( WalkInID ).HeaterSchedPtr > 0 ) {
-					if ( ! CheckScheduleValueMinMax( WalkIn( WalkInID ).HeaterSchedPtr, ">=", 0.0, "<=", 1.0 ) ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\"" );
+				if ( WalkIn( GetRefrigerationInputWalkInID ).HeaterSchedPtr > 0 ) {
+					if ( ! CheckScheduleValueMinMax( WalkIn( GetRefrigerationInputWalkInID ).HeaterSchedPtr, ">=", 0.0, "<=", 1.0 ) ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\"" );
 						ShowContinueError( "Error found in " + cAlphaFieldNames( AlphaNum ) + " = " + Alphas( AlphaNum ) );
 						ShowContinueError( "schedule values must be (>=0., <=1.)" );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 
 				if ( ! lNumericBlanks( 5 ) && Numbers( 5 ) > 0.0 ) {
-					WalkIn( WalkInID ).CoilFanPower = Numbers( 5 );
+					WalkIn( GetRefrigerationInputWalkInID ).CoilFanPower = Numbers( 5 );
 				} else {
-					ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", " + cNumericFieldNames( 5 ) + " was not input or was less than 0 and default of 375.0 W will be used " );
-					WalkIn( WalkInID ).CoilFanPower = 375.0; //default value = 1/2 hp
+					ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", " + cNumericFieldNames( 5 ) + " was not input or was less than 0 and default of 375.0 W will be used " );
+					WalkIn( GetRefrigerationInputWalkInID ).CoilFanPower = 375.0; //default value = 1/2 hp
 				}
 
 				if ( lNumericBlanks( 6 ) ) {
-					WalkIn( WalkInID ).CircFanPower = 0.0;
+					WalkIn( GetRefrigerationInputWalkInID ).CircFanPower = 0.0;
 				} else {
-					WalkIn( WalkInID ).CircFanPower = Numbers( 6 );
+					WalkIn( GetRefrigerationInputWalkInID ).CircFanPower = Numbers( 6 );
 					if ( Numbers( 7 ) < 0.0 ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", " + cNumericFieldNames( 6 ) + " must be greater than >= 0 W" );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", " + cNumericFieldNames( 6 ) + " must be greater than >= 0 W" );
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 
 				if ( ! lNumericBlanks( 7 ) ) {
-					WalkIn( WalkInID ).DesignLighting = Numbers( 7 );
+					WalkIn( GetRefrigerationInputWalkInID ).DesignLighting = Numbers( 7 );
 				} else {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\" " + cNumericFieldNames( 7 ) + " must be input " );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\" " + cNumericFieldNames( 7 ) + " must be input " );
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				AlphaNum = 4;
 				if ( ! lAlphaBlanks( AlphaNum ) ) {
-					WalkIn( WalkInID ).LightingSchedPtr = GetScheduleIndex( Alphas( AlphaNum ) ); // convert lighting schedule name to pointer
-					if ( WalkIn( WalkInID ).LightingSchedPtr == 0 ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
-						ErrorsFound = true;
+					WalkIn( GetRefrigerationInputWalkInID ).LightingSchedPtr = GetScheduleIndex( Alphas( AlphaNum ) ); // convert lighting schedule name to pointer
+					if ( WalkIn( GetRefrigerationInputWalkInID ).LightingSchedPtr == 0 ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
+						GetRefrigerationInputErrorsFound = true;
 					} // ptr == 0
 				} else { // no schedule specified
-					WalkIn( WalkInID ).LightingSchedPtr = AlwaysOn;
+					WalkIn( GetRefrigerationInputWalkInID ).LightingSchedPtr = AlwaysOn;
 				} // schedule name not blank
 				//   check Lighting schedule for values between 0 and 1
-				if ( WalkIn( WalkInID ).LightingSchedPtr > 0 ) {
-					if ( ! CheckScheduleValueMinMax( WalkIn( WalkInID ).LightingSchedPtr, ">=", 0.0, "<=", 1.0 ) ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\"" );
+				if ( WalkIn( GetRefrigerationInputWalkInID ).LightingSchedPtr > 0 ) {
+					if ( ! CheckScheduleValueMinMax( WalkIn( GetRefrigerationInputWalkInID ).LightingSchedPtr, ">=", 0.0, "<=", 1.0 ) ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\"" );
 						ShowContinueError( "Error found in " + cAlphaFieldNames( AlphaNum ) + " = " + Alphas( AlphaNum ) );
 						ShowContinueError( "schedule values must be (>=0., <=1.)" );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 
 				//Input walk-in cooler defrost information
 				AlphaNum = 5;
 				if ( lAlphaBlanks( AlphaNum ) ) {
-					WalkIn( WalkInID ).DefrostType = WalkInDefrostElec;
+					WalkIn( GetRefrigerationInputWalkInID ).DefrostType = WalkInDefrostElec;
 				} else if ( SameString( Alphas( AlphaNum ), "Electric" ) ) {
-					WalkIn( WalkInID ).DefrostType = WalkInDefrostElec;
+					WalkIn( GetRefrigerationInputWalkInID ).DefrostType = WalkInDefrostElec;
 				} else if ( SameString( Alphas( AlphaNum ), "HotFluid" ) ) {
-					WalkIn( WalkInID ).DefrostType = WalkInDefrostFluid;
+					WalkIn( GetRefrigerationInputWalkInID ).DefrostType = WalkInDefrostFluid;
 				} else if ( SameString( Alphas( AlphaNum ), "None" ) ) {
-					WalkIn( WalkInID ).DefrostType = WalkInDefrostNone;
+					WalkIn( GetRefrigerationInputWalkInID ).DefrostType = WalkInDefrostNone;
 				} else if ( SameString( Alphas( AlphaNum ), "OffCycle" ) ) {
-					WalkIn( WalkInID ).DefrostType = WalkInDefrostOffCycle;
+					WalkIn( GetRefrigerationInputWalkInID ).DefrostType = WalkInDefrostOffCycle;
 				} else {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + "=\"" + Alphas( AlphaNum ) + "\"." );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + "=\"" + Alphas( AlphaNum ) + "\"." );
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				AlphaNum = 6;
 				if ( lAlphaBlanks( AlphaNum ) ) {
-					WalkIn( WalkInID ).DefrostControlType = DefrostControlSched;
+					WalkIn( GetRefrigerationInputWalkInID ).DefrostControlType = DefrostControlSched;
 				} else if ( SameString( Alphas( AlphaNum ), "TimeSchedule" ) ) {
-					WalkIn( WalkInID ).DefrostControlType = DefrostControlSched;
+					WalkIn( GetRefrigerationInputWalkInID ).DefrostControlType = DefrostControlSched;
 				} else if ( SameString( Alphas( AlphaNum ), "TemperatureTermination" ) ) {
-					WalkIn( WalkInID ).DefrostControlType = DefrostContTempTerm;
+					WalkIn( GetRefrigerationInputWalkInID ).DefrostControlType = DefrostContTempTerm;
 				} else {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
+					GetRefrigerationInputErrorsFound = true;
 				} // defrost control type
 
 				// convert defrost schedule name to pointer
 				AlphaNum = 7;
-				WalkIn( WalkInID ).DefrostSchedPtr = GetScheduleIndex( Alphas( AlphaNum ) );
-				if ( WalkIn( WalkInID ).DefrostSchedPtr == 0 ) {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
-					ErrorsFound = true;
+				WalkIn( GetRefrigerationInputWalkInID ).DefrostSchedPtr = GetScheduleIndex( Alphas( AlphaNum ) );
+				if ( WalkIn( GetRefrigerationInputWalkInID ).DefrostSchedPtr == 0 ) {
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
+					GetRefrigerationInputErrorsFound = true;
 				}
 				//   check defrost schedule for values between 0 and 1
-				if ( WalkIn( WalkInID ).DefrostSchedPtr > 0 ) {
-					if ( ! CheckScheduleValueMinMax( WalkIn( WalkInID ).DefrostSchedPtr, ">=", 0.0, "<=", 1.0 ) ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + " = \"" + WalkIn( WalkInID ).Name + "\"" );
+				if ( WalkIn( GetRefrigerationInputWalkInID ).DefrostSchedPtr > 0 ) {
+					if ( ! CheckScheduleValueMinMax( WalkIn( GetRefrigerationInputWalkInID ).DefrostSchedPtr, ">=", 0.0, "<=", 1.0 ) ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + " = \"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\"" );
 						ShowContinueError( "Error found in " + cAlphaFieldNames( AlphaNum ) + '=' + Alphas( AlphaNum ) );
 						ShowContinueError( "schedule values must be (>=0., <=1.)" );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 
@@ -1698,44 +2554,44 @@ namespace RefrigeratedCase {
 				// some defrost types do not use drip-down schedules, use same defrost schedule pointer in that case
 				AlphaNum = 8;
 				if ( ! lAlphaBlanks( AlphaNum ) ) {
-					WalkIn( WalkInID ).DefrostDripDownSchedPtr = GetScheduleIndex( Alphas( AlphaNum ) );
-					if ( WalkIn( WalkInID ).DefrostDripDownSchedPtr == 0 ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
-						ErrorsFound = true;
+					WalkIn( GetRefrigerationInputWalkInID ).DefrostDripDownSchedPtr = GetScheduleIndex( Alphas( AlphaNum ) );
+					if ( WalkIn( GetRefrigerationInputWalkInID ).DefrostDripDownSchedPtr == 0 ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
+						GetRefrigerationInputErrorsFound = true;
 					}
 					// check schedule for values between 0 and 1
-					if ( WalkIn( WalkInID ).DefrostDripDownSchedPtr > 0 ) {
-						if ( ! CheckScheduleValueMinMax( WalkIn( WalkInID ).DefrostDripDownSchedPtr, ">=", 0.0, "<=", 1.0 ) ) {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\"" );
+					if ( WalkIn( GetRefrigerationInputWalkInID ).DefrostDripDownSchedPtr > 0 ) {
+						if ( ! CheckScheduleValueMinMax( WalkIn( GetRefrigerationInputWalkInID ).DefrostDripDownSchedPtr, ">=", 0.0, "<=", 1.0 ) ) {
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\"" );
 							ShowContinueError( "Error found in " + cAlphaFieldNames( AlphaNum ) + " = " + Alphas( AlphaNum ) );
 							ShowContinueError( "schedule values must be (>=0., <=1.)" );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						}
 					}
 				} else { //blank input so use drip down schedule for defrost
-					WalkIn( WalkInID ).DefrostDripDownSchedPtr = WalkIn( WalkInID ).DefrostSchedPtr;
+					WalkIn( GetRefrigerationInputWalkInID ).DefrostDripDownSchedPtr = WalkIn( GetRefrigerationInputWalkInID ).DefrostSchedPtr;
 				}
 
-				if ( WalkIn( WalkInID ).DefrostType == WalkInDefrostOffCycle || WalkIn( WalkInID ).DefrostType == WalkInDefrostNone ) {
-					WalkIn( WalkInID ).DefrostCapacity = 0.0;
+				if ( WalkIn( GetRefrigerationInputWalkInID ).DefrostType == WalkInDefrostOffCycle || WalkIn( GetRefrigerationInputWalkInID ).DefrostType == WalkInDefrostNone ) {
+					WalkIn( GetRefrigerationInputWalkInID ).DefrostCapacity = 0.0;
 					//Don't even need to read N8 or N9 for those two defrost types.
 				} else { //have electric or hot gas/brine defrost
 					if ( ( lNumericBlanks( 8 ) ) || ( Numbers( 8 ) <= 0.0 ) ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", " + cNumericFieldNames( 8 ) + " must be input and greater than or equal to 0 W for " + cAlphaFieldNames( 5 ) + ' ' + Alphas( 5 ) );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", " + cNumericFieldNames( 8 ) + " must be input and greater than or equal to 0 W for " + cAlphaFieldNames( 5 ) + ' ' + Alphas( 5 ) );
+						GetRefrigerationInputErrorsFound = true;
 					} else {
-						WalkIn( WalkInID ).DefrostCapacity = Numbers( 8 );
+						WalkIn( GetRefrigerationInputWalkInID ).DefrostCapacity = Numbers( 8 );
 					} //Blank  or negative N8
 
 					//defaults for defrost energy fraction are 0.7 for elec defrost and 0.3 for warm fluid
 					//note this value is only used for temperature terminated defrost control type
-					if ( WalkIn( WalkInID ).DefrostType == WalkInDefrostElec ) WalkIn( WalkInID ).DefEnergyFraction = 0.7;
-					if ( WalkIn( WalkInID ).DefrostType == WalkInDefrostFluid ) WalkIn( WalkInID ).DefEnergyFraction = 0.3;
+					if ( WalkIn( GetRefrigerationInputWalkInID ).DefrostType == WalkInDefrostElec ) WalkIn( GetRefrigerationInputWalkInID ).DefEnergyFraction = 0.7;
+					if ( WalkIn( GetRefrigerationInputWalkInID ).DefrostType == WalkInDefrostFluid ) WalkIn( GetRefrigerationInputWalkInID ).DefEnergyFraction = 0.3;
 					if ( ! lNumericBlanks( 9 ) ) {
 						if ( ( Numbers( 9 ) > 1.0 ) || ( Numbers( 9 ) < 0.0 ) ) {
-							ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", " + cNumericFieldNames( 9 ) + " must be between 0 and 1, default values will be used." );
+							ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", " + cNumericFieldNames( 9 ) + " must be between 0 and 1, default values will be used." );
 						} else {
-							WalkIn( WalkInID ).DefEnergyFraction = Numbers( 9 );
+							WalkIn( GetRefrigerationInputWalkInID ).DefEnergyFraction = Numbers( 9 );
 						} // number out of range
 					} //lnumericblanks
 				} // defrost type
@@ -1743,32 +2599,32 @@ namespace RefrigeratedCase {
 				// convert restocking schedule name to pointer, default of 0.1 is assigned inside walkin subroutine if blank
 				AlphaNum = 9;
 				if ( lAlphaBlanks( AlphaNum ) ) {
-					WalkIn( WalkInID ).StockingSchedPtr = 0;
+					WalkIn( GetRefrigerationInputWalkInID ).StockingSchedPtr = 0;
 				} else {
-					WalkIn( WalkInID ).StockingSchedPtr = GetScheduleIndex( Alphas( AlphaNum ) );
-					if ( WalkIn( WalkInID ).StockingSchedPtr == 0 ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
-						ErrorsFound = true;
+					WalkIn( GetRefrigerationInputWalkInID ).StockingSchedPtr = GetScheduleIndex( Alphas( AlphaNum ) );
+					if ( WalkIn( GetRefrigerationInputWalkInID ).StockingSchedPtr == 0 ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} //blank
 
-				WalkIn( WalkInID ).DesignRefrigInventory = 0.0;
-				if ( ! lNumericBlanks( 10 ) ) WalkIn( WalkInID ).DesignRefrigInventory = Numbers( 10 );
+				WalkIn( GetRefrigerationInputWalkInID ).DesignRefrigInventory = 0.0;
+				if ( ! lNumericBlanks( 10 ) ) WalkIn( GetRefrigerationInputWalkInID ).DesignRefrigInventory = Numbers( 10 );
 
 				if ( ! lNumericBlanks( 11 ) ) {
-					WalkIn( WalkInID ).FloorArea = Numbers( 11 );
+					WalkIn( GetRefrigerationInputWalkInID ).FloorArea = Numbers( 11 );
 				} else {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", " + cNumericFieldNames( 11 ) + " must be input" );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", " + cNumericFieldNames( 11 ) + " must be input" );
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				if ( lNumericBlanks( 12 ) ) {
-					WalkIn( WalkInID ).FloorUValue = DefaultWISurfaceUValue;
+					WalkIn( GetRefrigerationInputWalkInID ).FloorUValue = DefaultWISurfaceUValue;
 				} else {
-					WalkIn( WalkInID ).FloorUValue = Numbers( 12 );
+					WalkIn( GetRefrigerationInputWalkInID ).FloorUValue = Numbers( 12 );
 					if ( Numbers( 12 ) <= 0.0 ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", " + cNumericFieldNames( 12 ) + " must be > 0." );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", " + cNumericFieldNames( 12 ) + " must be > 0." );
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 
@@ -1783,149 +2639,149 @@ namespace RefrigeratedCase {
 				if ( NumWIFieldsTotal > ( 3 * NumWIFieldsPerZone ) ) NumZones = 4;
 				if ( NumWIFieldsTotal > ( 4 * NumWIFieldsPerZone ) ) NumZones = 5;
 				if ( NumWIFieldsTotal > ( 5 * NumWIFieldsPerZone ) ) NumZones = 6;
-				WalkIn( WalkInID ).NumZones = NumZones;
+				WalkIn( GetRefrigerationInputWalkInID ).NumZones = NumZones;
 
 				// All variables for walk-in/zone interactions need to be allocated after know number of zones
 				//Autodesk Missing initialization added below: At least SensZoneCreditRate was used uninitialized
-				if ( ! allocated( WalkIn( WalkInID ).ZoneName ) ) WalkIn( WalkInID ).ZoneName.allocate( NumZones );
-				if ( ! allocated( WalkIn( WalkInID ).ZoneNum ) ) WalkIn( WalkInID ).ZoneNum.allocate( NumZones ) = 0;
-				if ( ! allocated( WalkIn( WalkInID ).ZoneNodeNum ) ) WalkIn( WalkInID ).ZoneNodeNum.allocate( NumZones ) = 0;
-				if ( ! allocated( WalkIn( WalkInID ).SurfaceArea ) ) WalkIn( WalkInID ).SurfaceArea.allocate( NumZones ) = 0.0;
-				if ( ! allocated( WalkIn( WalkInID ).UValue ) ) WalkIn( WalkInID ).UValue.allocate( NumZones ) = 0.0;
-				if ( ! allocated( WalkIn( WalkInID ).UValueGlassDr ) ) WalkIn( WalkInID ).UValueGlassDr.allocate( NumZones ) = 0.0;
-				if ( ! allocated( WalkIn( WalkInID ).GlassDoorOpenSchedPtr ) ) WalkIn( WalkInID ).GlassDoorOpenSchedPtr.allocate( NumZones ) = 0;
-				if ( ! allocated( WalkIn( WalkInID ).AreaGlassDr ) ) WalkIn( WalkInID ).AreaGlassDr.allocate( NumZones ) = 0.0;
-				if ( ! allocated( WalkIn( WalkInID ).HeightGlassDr ) ) WalkIn( WalkInID ).HeightGlassDr.allocate( NumZones ) = 0.0;
-				if ( ! allocated( WalkIn( WalkInID ).UValueStockDr ) ) WalkIn( WalkInID ).UValueStockDr.allocate( NumZones ) = 0.0;
-				if ( ! allocated( WalkIn( WalkInID ).StockDoorOpenSchedPtr ) ) WalkIn( WalkInID ).StockDoorOpenSchedPtr.allocate( NumZones ) = 0;
-				if ( ! allocated( WalkIn( WalkInID ).StockDoorProtectType ) ) WalkIn( WalkInID ).StockDoorProtectType.allocate( NumZones ) = 0;
-				if ( ! allocated( WalkIn( WalkInID ).AreaStockDr ) ) WalkIn( WalkInID ).AreaStockDr.allocate( NumZones ) = 0.0;
-				if ( ! allocated( WalkIn( WalkInID ).HeightStockDr ) ) WalkIn( WalkInID ).HeightStockDr.allocate( NumZones ) = 0.0;
-				if ( ! allocated( WalkIn( WalkInID ).SensZoneCreditRate ) ) WalkIn( WalkInID ).SensZoneCreditRate.allocate( NumZones ) = 0.0;
-				if ( ! allocated( WalkIn( WalkInID ).SensZoneCreditCoolRate ) ) WalkIn( WalkInID ).SensZoneCreditCoolRate.allocate( NumZones ) = 0.0;
-				if ( ! allocated( WalkIn( WalkInID ).SensZoneCreditCool ) ) WalkIn( WalkInID ).SensZoneCreditCool.allocate( NumZones ) = 0.0;
-				if ( ! allocated( WalkIn( WalkInID ).SensZoneCreditHeatRate ) ) WalkIn( WalkInID ).SensZoneCreditHeatRate.allocate( NumZones ) = 0.0;
-				if ( ! allocated( WalkIn( WalkInID ).SensZoneCreditHeat ) ) WalkIn( WalkInID ).SensZoneCreditHeat.allocate( NumZones ) = 0.0;
-				if ( ! allocated( WalkIn( WalkInID ).LatZoneCreditRate ) ) WalkIn( WalkInID ).LatZoneCreditRate.allocate( NumZones ) = 0.0;
-				if ( ! allocated( WalkIn( WalkInID ).LatZoneCredit ) ) WalkIn( WalkInID ).LatZoneCredit.allocate( NumZones ) = 0.0;
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).ZoneName ) ) WalkIn( GetRefrigerationInputWalkInID ).ZoneName.allocate( NumZones );
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).ZoneNum ) ) WalkIn( GetRefrigerationInputWalkInID ).ZoneNum.allocate( NumZones ) = 0;
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).ZoneNodeNum ) ) WalkIn( GetRefrigerationInputWalkInID ).ZoneNodeNum.allocate( NumZones ) = 0;
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).SurfaceArea ) ) WalkIn( GetRefrigerationInputWalkInID ).SurfaceArea.allocate( NumZones ) = 0.0;
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).UValue ) ) WalkIn( GetRefrigerationInputWalkInID ).UValue.allocate( NumZones ) = 0.0;
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).UValueGlassDr ) ) WalkIn( GetRefrigerationInputWalkInID ).UValueGlassDr.allocate( NumZones ) = 0.0;
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).GlassDoorOpenSchedPtr ) ) WalkIn( GetRefrigerationInputWalkInID ).GlassDoorOpenSchedPtr.allocate( NumZones ) = 0;
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).AreaGlassDr ) ) WalkIn( GetRefrigerationInputWalkInID ).AreaGlassDr.allocate( NumZones ) = 0.0;
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).HeightGlassDr ) ) WalkIn( GetRefrigerationInputWalkInID ).HeightGlassDr.allocate( NumZones ) = 0.0;
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).UValueStockDr ) ) WalkIn( GetRefrigerationInputWalkInID ).UValueStockDr.allocate( NumZones ) = 0.0;
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).StockDoorOpenSchedPtr ) ) WalkIn( GetRefrigerationInputWalkInID ).StockDoorOpenSchedPtr.allocate( NumZones ) = 0;
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).StockDoorProtectType ) ) WalkIn( GetRefrigerationInputWalkInID ).StockDoorProtectType.allocate( NumZones ) = 0;
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).AreaStockDr ) ) WalkIn( GetRefrigerationInputWalkInID ).AreaStockDr.allocate( NumZones ) = 0.0;
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).HeightStockDr ) ) WalkIn( GetRefrigerationInputWalkInID ).HeightStockDr.allocate( NumZones ) = 0.0;
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).SensZoneCreditRate ) ) WalkIn( GetRefrigerationInputWalkInID ).SensZoneCreditRate.allocate( NumZones ) = 0.0;
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).SensZoneCreditCoolRate ) ) WalkIn( GetRefrigerationInputWalkInID ).SensZoneCreditCoolRate.allocate( NumZones ) = 0.0;
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).SensZoneCreditCool ) ) WalkIn( GetRefrigerationInputWalkInID ).SensZoneCreditCool.allocate( NumZones ) = 0.0;
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).SensZoneCreditHeatRate ) ) WalkIn( GetRefrigerationInputWalkInID ).SensZoneCreditHeatRate.allocate( NumZones ) = 0.0;
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).SensZoneCreditHeat ) ) WalkIn( GetRefrigerationInputWalkInID ).SensZoneCreditHeat.allocate( NumZones ) = 0.0;
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).LatZoneCreditRate ) ) WalkIn( GetRefrigerationInputWalkInID ).LatZoneCreditRate.allocate( NumZones ) = 0.0;
+				if ( ! allocated( WalkIn( GetRefrigerationInputWalkInID ).LatZoneCredit ) ) WalkIn( GetRefrigerationInputWalkInID ).LatZoneCredit.allocate( NumZones ) = 0.0;
 
 				AStart = NumWIAlphaFieldsBeforeZoneInput + 1;
 				NStart = NumWINumberFieldsBeforeZoneInput + 1;
 				for ( ZoneID = 1; ZoneID <= NumZones; ++ZoneID ) {
 					//Get the Zone node number from the zone name
 					//The Zone Node is needed to get the zone's ambient conditions, NumOfZones from dataglobals
-					WalkIn( WalkInID ).ZoneName( ZoneID ) = Alphas( AStart );
-					WalkIn( WalkInID ).ZoneNum( ZoneID ) = FindItemInList( Alphas( AStart ), Zone );
+					WalkIn( GetRefrigerationInputWalkInID ).ZoneName( ZoneID ) = Alphas( AStart );
+					WalkIn( GetRefrigerationInputWalkInID ).ZoneNum( ZoneID ) = FindItemInList( Alphas( AStart ), Zone );
 
-					if ( WalkIn( WalkInID ).ZoneNum( ZoneID ) == 0 ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", invalid  " + cAlphaFieldNames( AStart ) + " not valid: " + Alphas( AStart ) );
-						ErrorsFound = true;
+					if ( WalkIn( GetRefrigerationInputWalkInID ).ZoneNum( ZoneID ) == 0 ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", invalid  " + cAlphaFieldNames( AStart ) + " not valid: " + Alphas( AStart ) );
+						GetRefrigerationInputErrorsFound = true;
 					} else {
-						RefrigPresentInZone( WalkIn( WalkInID ).ZoneNum( ZoneID ) ) = true;
+						RefrigPresentInZone( WalkIn( GetRefrigerationInputWalkInID ).ZoneNum( ZoneID ) ) = true;
 					}
-					WalkIn( WalkInID ).ZoneNodeNum( ZoneID ) = GetSystemNodeNumberForZone( WalkIn( WalkInID ).ZoneName( ZoneID ) );
-					if ( WalkIn( WalkInID ).ZoneNum( ZoneID ) >= 0 ) {
-						if ( WalkIn( WalkInID ).ZoneNodeNum( ZoneID ) == 0 ) {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\" System Node Number not found for " + cAlphaFieldNames( AStart ) + " = " + Alphas( AStart ) );
+					WalkIn( GetRefrigerationInputWalkInID ).ZoneNodeNum( ZoneID ) = GetSystemNodeNumberForZone( WalkIn( GetRefrigerationInputWalkInID ).ZoneName( ZoneID ) );
+					if ( WalkIn( GetRefrigerationInputWalkInID ).ZoneNum( ZoneID ) >= 0 ) {
+						if ( WalkIn( GetRefrigerationInputWalkInID ).ZoneNodeNum( ZoneID ) == 0 ) {
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\" System Node Number not found for " + cAlphaFieldNames( AStart ) + " = " + Alphas( AStart ) );
 							ShowContinueError( ".. Walk Ins must reference a controlled Zone (appear in a ZoneHVAC:EquipmentConnections object." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						}
 					}
 
 					if ( ! lNumericBlanks( NStart ) ) {
-						WalkIn( WalkInID ).SurfaceArea( ZoneID ) = Numbers( NStart );
+						WalkIn( GetRefrigerationInputWalkInID ).SurfaceArea( ZoneID ) = Numbers( NStart );
 					} else {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", " + cNumericFieldNames( NStart ) + " must be input for Zone: " + WalkIn( WalkInID ).ZoneName( ZoneID ) );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", " + cNumericFieldNames( NStart ) + " must be input for Zone: " + WalkIn( GetRefrigerationInputWalkInID ).ZoneName( ZoneID ) );
+						GetRefrigerationInputErrorsFound = true;
 					}
 
 					if ( lNumericBlanks( NStart + 1 ) ) {
-						WalkIn( WalkInID ).UValue( ZoneID ) = DefaultWISurfaceUValue;
+						WalkIn( GetRefrigerationInputWalkInID ).UValue( ZoneID ) = DefaultWISurfaceUValue;
 					} else {
-						WalkIn( WalkInID ).UValue( ZoneID ) = Numbers( NStart + 1 );
+						WalkIn( GetRefrigerationInputWalkInID ).UValue( ZoneID ) = Numbers( NStart + 1 );
 						if ( Numbers( NStart + 1 ) <= 0.0 ) {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", Zone=\"" + WalkIn( WalkInID ).ZoneName( ZoneID ) + "\", " + cNumericFieldNames( NStart + 1 ) + " must be > 0." );
-							ErrorsFound = true;
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", Zone=\"" + WalkIn( GetRefrigerationInputWalkInID ).ZoneName( ZoneID ) + "\", " + cNumericFieldNames( NStart + 1 ) + " must be > 0." );
+							GetRefrigerationInputErrorsFound = true;
 						}
 					}
 
 					//start IF set for glass doors in this zone
-					WalkIn( WalkInID ).AreaGlassDr( ZoneID ) = 0.0;
-					WalkIn( WalkInID ).HeightGlassDr( ZoneID ) = 0.0;
-					WalkIn( WalkInID ).UValueGlassDr( ZoneID ) = 0.0;
+					WalkIn( GetRefrigerationInputWalkInID ).AreaGlassDr( ZoneID ) = 0.0;
+					WalkIn( GetRefrigerationInputWalkInID ).HeightGlassDr( ZoneID ) = 0.0;
+					WalkIn( GetRefrigerationInputWalkInID ).UValueGlassDr( ZoneID ) = 0.0;
 					if ( ! lNumericBlanks( NStart + 2 ) ) {
-						WalkIn( WalkInID ).AreaGlassDr( ZoneID ) = Numbers( NStart + 2 );
+						WalkIn( GetRefrigerationInputWalkInID ).AreaGlassDr( ZoneID ) = Numbers( NStart + 2 );
 
-						WalkIn( WalkInID ).HeightGlassDr( ZoneID ) = DefaultWIHeightGlassDr;
-						if ( ! lNumericBlanks( NStart + 3 ) ) WalkIn( WalkInID ).HeightGlassDr( ZoneID ) = Numbers( NStart + 3 );
+						WalkIn( GetRefrigerationInputWalkInID ).HeightGlassDr( ZoneID ) = DefaultWIHeightGlassDr;
+						if ( ! lNumericBlanks( NStart + 3 ) ) WalkIn( GetRefrigerationInputWalkInID ).HeightGlassDr( ZoneID ) = Numbers( NStart + 3 );
 
-						WalkIn( WalkInID ).UValueGlassDr( ZoneID ) = DefaultWIUValueGlassDr;
-						if ( ! lNumericBlanks( NStart + 4 ) ) WalkIn( WalkInID ).UValueGlassDr( ZoneID ) = Numbers( NStart + 4 );
+						WalkIn( GetRefrigerationInputWalkInID ).UValueGlassDr( ZoneID ) = DefaultWIUValueGlassDr;
+						if ( ! lNumericBlanks( NStart + 4 ) ) WalkIn( GetRefrigerationInputWalkInID ).UValueGlassDr( ZoneID ) = Numbers( NStart + 4 );
 
 						// convert door opening schedule name to pointer, default of 0.1 is assigned inside walkin subroutine if blank
 						if ( lAlphaBlanks( AStart + 1 ) ) {
-							WalkIn( WalkInID ).GlassDoorOpenSchedPtr( ZoneID ) = 0;
+							WalkIn( GetRefrigerationInputWalkInID ).GlassDoorOpenSchedPtr( ZoneID ) = 0;
 						} else {
-							WalkIn( WalkInID ).GlassDoorOpenSchedPtr( ZoneID ) = GetScheduleIndex( Alphas( AStart + 1 ) );
-							if ( WalkIn( WalkInID ).GlassDoorOpenSchedPtr( ZoneID ) == 0 ) {
-								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", Zone=\"" + WalkIn( WalkInID ).ZoneName( ZoneID ) + "\", invalid  " + cAlphaFieldNames( AStart + 1 ) + " not found: " + Alphas( AStart + 1 ) );
-								ErrorsFound = true;
+							WalkIn( GetRefrigerationInputWalkInID ).GlassDoorOpenSchedPtr( ZoneID ) = GetScheduleIndex( Alphas( AStart + 1 ) );
+							if ( WalkIn( GetRefrigerationInputWalkInID ).GlassDoorOpenSchedPtr( ZoneID ) == 0 ) {
+								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", Zone=\"" + WalkIn( GetRefrigerationInputWalkInID ).ZoneName( ZoneID ) + "\", invalid  " + cAlphaFieldNames( AStart + 1 ) + " not found: " + Alphas( AStart + 1 ) );
+								GetRefrigerationInputErrorsFound = true;
 							} else {
 								//       check schedule for values between 0 and 1
-								if ( ! CheckScheduleValueMinMax( WalkIn( WalkInID ).GlassDoorOpenSchedPtr( ZoneID ), ">=", 0.0, "<=", 1.0 ) ) {
-									ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", Zone=\"" + WalkIn( WalkInID ).ZoneName( ZoneID ) + "\"" );
+								if ( ! CheckScheduleValueMinMax( WalkIn( GetRefrigerationInputWalkInID ).GlassDoorOpenSchedPtr( ZoneID ), ">=", 0.0, "<=", 1.0 ) ) {
+									ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", Zone=\"" + WalkIn( GetRefrigerationInputWalkInID ).ZoneName( ZoneID ) + "\"" );
 									ShowContinueError( "Error found in " + cAlphaFieldNames( AStart + 1 ) + " = " + Alphas( AStart + 1 ) );
 									ShowContinueError( "schedule values must be (>=0., <=1.)" );
-									ErrorsFound = true;
+									GetRefrigerationInputErrorsFound = true;
 								} //schedule values outside range
 							} // have schedule pointer
 						} //blank on door opening schedule (AStart + 1)
 					} // have glassdoor area facing zone (blank on lNumericBlanks(NStart+2))
 
 					//start IF set for stock doors in this zone
-					WalkIn( WalkInID ).AreaStockDr( ZoneID ) = 0.0;
-					WalkIn( WalkInID ).HeightStockDr( ZoneID ) = 0.0;
-					WalkIn( WalkInID ).UValueStockDr( ZoneID ) = 0.0;
+					WalkIn( GetRefrigerationInputWalkInID ).AreaStockDr( ZoneID ) = 0.0;
+					WalkIn( GetRefrigerationInputWalkInID ).HeightStockDr( ZoneID ) = 0.0;
+					WalkIn( GetRefrigerationInputWalkInID ).UValueStockDr( ZoneID ) = 0.0;
 					if ( ! lNumericBlanks( NStart + 5 ) ) {
-						WalkIn( WalkInID ).AreaStockDr( ZoneID ) = Numbers( NStart + 5 );
+						WalkIn( GetRefrigerationInputWalkInID ).AreaStockDr( ZoneID ) = Numbers( NStart + 5 );
 
-						WalkIn( WalkInID ).HeightStockDr( ZoneID ) = DefaultWIHeightStockDr;
-						if ( ! lNumericBlanks( NStart + 6 ) ) WalkIn( WalkInID ).HeightStockDr( ZoneID ) = Numbers( NStart + 6 );
+						WalkIn( GetRefrigerationInputWalkInID ).HeightStockDr( ZoneID ) = DefaultWIHeightStockDr;
+						if ( ! lNumericBlanks( NStart + 6 ) ) WalkIn( GetRefrigerationInputWalkInID ).HeightStockDr( ZoneID ) = Numbers( NStart + 6 );
 
-						WalkIn( WalkInID ).UValueStockDr( ZoneID ) = DefaultWIUValueStockDr;
-						if ( ! lNumericBlanks( NStart + 7 ) ) WalkIn( WalkInID ).UValueStockDr( ZoneID ) = Numbers( NStart + 7 );
+						WalkIn( GetRefrigerationInputWalkInID ).UValueStockDr( ZoneID ) = DefaultWIUValueStockDr;
+						if ( ! lNumericBlanks( NStart + 7 ) ) WalkIn( GetRefrigerationInputWalkInID ).UValueStockDr( ZoneID ) = Numbers( NStart + 7 );
 
 						// convert door opening schedule name to pointer, default of 0.1 is assigned inside walkin subroutine if blank
 						if ( lAlphaBlanks( AStart + 2 ) ) {
-							WalkIn( WalkInID ).StockDoorOpenSchedPtr( ZoneID ) = 0;
+							WalkIn( GetRefrigerationInputWalkInID ).StockDoorOpenSchedPtr( ZoneID ) = 0;
 						} else {
-							WalkIn( WalkInID ).StockDoorOpenSchedPtr( ZoneID ) = GetScheduleIndex( Alphas( AStart + 2 ) );
-							if ( WalkIn( WalkInID ).StockDoorOpenSchedPtr( ZoneID ) == 0 ) {
-								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", Zone=\"" + WalkIn( WalkInID ).ZoneName( ZoneID ) + "\", invalid  " + cAlphaFieldNames( AStart + 2 ) + " not found: " + Alphas( AStart + 2 ) );
-								ErrorsFound = true;
+							WalkIn( GetRefrigerationInputWalkInID ).StockDoorOpenSchedPtr( ZoneID ) = GetScheduleIndex( Alphas( AStart + 2 ) );
+							if ( WalkIn( GetRefrigerationInputWalkInID ).StockDoorOpenSchedPtr( ZoneID ) == 0 ) {
+								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", Zone=\"" + WalkIn( GetRefrigerationInputWalkInID ).ZoneName( ZoneID ) + "\", invalid  " + cAlphaFieldNames( AStart + 2 ) + " not found: " + Alphas( AStart + 2 ) );
+								GetRefrigerationInputErrorsFound = true;
 							} else {
 								//       check schedule for values between 0 and 1
-								if ( ! CheckScheduleValueMinMax( WalkIn( WalkInID ).StockDoorOpenSchedPtr( ZoneID ), ">=", 0.0, "<=", 1.0 ) ) {
-									ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", Zone=\"" + WalkIn( WalkInID ).ZoneName( ZoneID ) + "\"" );
+								if ( ! CheckScheduleValueMinMax( WalkIn( GetRefrigerationInputWalkInID ).StockDoorOpenSchedPtr( ZoneID ), ">=", 0.0, "<=", 1.0 ) ) {
+									ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", Zone=\"" + WalkIn( GetRefrigerationInputWalkInID ).ZoneName( ZoneID ) + "\"" );
 									ShowContinueError( "Error found in " + cAlphaFieldNames( AStart + 2 ) + " = " + Alphas( AStart + 2 ) );
 									ShowContinueError( "schedule values must be (>=0., <=1.)" );
-									ErrorsFound = true;
+									GetRefrigerationInputErrorsFound = true;
 								} //schedule values outside range
 							} // have schedule pointer
 						} //blank on door opening schedule (AStart + 2)
 
 						if ( lAlphaBlanks( AStart + 3 ) ) {
 							//default air curtain
-							WalkIn( WalkInID ).StockDoorProtectType( ZoneID ) = WIStockDoorAirCurtain;
+							WalkIn( GetRefrigerationInputWalkInID ).StockDoorProtectType( ZoneID ) = WIStockDoorAirCurtain;
 						} else if ( SameString( Alphas( AStart + 3 ), "None" ) ) {
-							WalkIn( WalkInID ).StockDoorProtectType( ZoneID ) = WIStockDoorNone;
+							WalkIn( GetRefrigerationInputWalkInID ).StockDoorProtectType( ZoneID ) = WIStockDoorNone;
 						} else if ( SameString( Alphas( AStart + 3 ), "AirCurtain" ) ) {
-							WalkIn( WalkInID ).StockDoorProtectType( ZoneID ) = WIStockDoorAirCurtain;
+							WalkIn( GetRefrigerationInputWalkInID ).StockDoorProtectType( ZoneID ) = WIStockDoorAirCurtain;
 						} else if ( SameString( Alphas( AStart + 3 ), "StripCurtain" ) ) {
-							WalkIn( WalkInID ).StockDoorProtectType( ZoneID ) = WIStockDoorStripCurtain;
+							WalkIn( GetRefrigerationInputWalkInID ).StockDoorProtectType( ZoneID ) = WIStockDoorStripCurtain;
 						} else {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( WalkInID ).Name + "\", invalid  " + cAlphaFieldNames( AStart + 3 ) + "=\"" + Alphas( AStart + 3 ) + "\"." );
-							ErrorsFound = true;
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", invalid  " + cAlphaFieldNames( AStart + 3 ) + "=\"" + Alphas( AStart + 3 ) + "\"." );
+							GetRefrigerationInputErrorsFound = true;
 						} //stock door protection (AStart + 3) blank
 					} // have Stockdoor area facing zone
 
@@ -1939,41 +2795,41 @@ namespace RefrigeratedCase {
 
 		if ( NumSimulationRefrigAirChillers > 0 ) {
 			CurrentModuleObject = "Refrigeration:AirChiller";
-			for ( CoilID = 1; CoilID <= NumSimulationRefrigAirChillers; ++CoilID ) {
+			for ( GetRefrigerationInputCoilID = 1; GetRefrigerationInputCoilID <= NumSimulationRefrigAirChillers; ++GetRefrigerationInputCoilID ) {
 				//A1
 				AlphaNum = 1;
-				GetObjectItem( CurrentModuleObject, CoilID, Alphas, NumAlphas, Numbers, NumNumbers, IOStatus, lNumericBlanks, lAlphaBlanks, cAlphaFieldNames, cNumericFieldNames );
+				GetObjectItem( CurrentModuleObject, GetRefrigerationInputCoilID, Alphas, NumAlphas, Numbers, NumNumbers, IOStatus, lNumericBlanks, lAlphaBlanks, cAlphaFieldNames, cNumericFieldNames );
 
 				IsNotOK = false;
 				IsBlank = false;
-				VerifyName( Alphas( AlphaNum ), WarehouseCoil, CoilID - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+				VerifyName( Alphas( AlphaNum ), WarehouseCoil, GetRefrigerationInputCoilID - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 
 				if ( IsNotOK ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + ", has an invalid or undefined name=\"" + Alphas( AlphaNum ) + "\"." );
 					if ( IsBlank ) Alphas( AlphaNum ) = "xxxxx";
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
-				WarehouseCoil( CoilID ).Name = Alphas( AlphaNum );
+				WarehouseCoil( GetRefrigerationInputCoilID ).Name = Alphas( AlphaNum );
 
 				//A2
 				++AlphaNum;
 				if ( ! lAlphaBlanks( AlphaNum ) ) {
-					WarehouseCoil( CoilID ).SchedPtr = GetScheduleIndex( Alphas( AlphaNum ) ); // convert schedule name to pointer
-					if ( WarehouseCoil( CoilID ).SchedPtr == 0 ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
-						ErrorsFound = true;
+					WarehouseCoil( GetRefrigerationInputCoilID ).SchedPtr = GetScheduleIndex( Alphas( AlphaNum ) ); // convert schedule name to pointer
+					if ( WarehouseCoil( GetRefrigerationInputCoilID ).SchedPtr == 0 ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
+						GetRefrigerationInputErrorsFound = true;
 					} // ptr == 0
 				} else { // no schedule specified
-					WarehouseCoil( CoilID ).SchedPtr = AlwaysOn;
+					WarehouseCoil( GetRefrigerationInputCoilID ).SchedPtr = AlwaysOn;
 				} // not blank
 
 				//   check availability schedule for values between 0 and 1
-				if ( WarehouseCoil( CoilID ).SchedPtr > 0 ) {
-					if ( ! CheckScheduleValueMinMax( WarehouseCoil( CoilID ).SchedPtr, ">=", 0.0, "<=", 1.0 ) ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\"" );
+				if ( WarehouseCoil( GetRefrigerationInputCoilID ).SchedPtr > 0 ) {
+					if ( ! CheckScheduleValueMinMax( WarehouseCoil( GetRefrigerationInputCoilID ).SchedPtr, ">=", 0.0, "<=", 1.0 ) ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\"" );
 						ShowContinueError( "Error found in " + cAlphaFieldNames( AlphaNum ) + " = " + Alphas( AlphaNum ) );
 						ShowContinueError( "schedule values must be (>=0., <=1.)" );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 
@@ -1988,292 +2844,292 @@ namespace RefrigeratedCase {
 				//A3
 				++AlphaNum;
 				if ( lAlphaBlanks( AlphaNum ) ) {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + cAlphaFieldNames( AlphaNum ) + " is required and not found." );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + cAlphaFieldNames( AlphaNum ) + " is required and not found." );
+					GetRefrigerationInputErrorsFound = true;
 				} else if ( SameString( Alphas( AlphaNum ), "UnitLoadFactorSensibleOnly" ) ) {
-					WarehouseCoil( CoilID ).RatingType = UnitLoadFactorSens;
+					WarehouseCoil( GetRefrigerationInputCoilID ).RatingType = UnitLoadFactorSens;
 				} else if ( SameString( Alphas( AlphaNum ), "CapacityTotalSpecificConditions" ) ) {
-					WarehouseCoil( CoilID ).RatingType = RatedCapacityTotal;
+					WarehouseCoil( GetRefrigerationInputCoilID ).RatingType = RatedCapacityTotal;
 				} else if ( SameString( Alphas( AlphaNum ), "EuropeanSC1Standard" ) ) {
-					WarehouseCoil( CoilID ).RatingType = EuropeanSC1Std;
+					WarehouseCoil( GetRefrigerationInputCoilID ).RatingType = EuropeanSC1Std;
 				} else if ( SameString( Alphas( AlphaNum ), "EuropeanSC1NominalWet" ) ) {
-					WarehouseCoil( CoilID ).RatingType = EuropeanSC1Nom;
+					WarehouseCoil( GetRefrigerationInputCoilID ).RatingType = EuropeanSC1Nom;
 				} else if ( SameString( Alphas( AlphaNum ), "EuropeanSC2Standard" ) ) {
-					WarehouseCoil( CoilID ).RatingType = EuropeanSC2Std;
+					WarehouseCoil( GetRefrigerationInputCoilID ).RatingType = EuropeanSC2Std;
 				} else if ( SameString( Alphas( AlphaNum ), "EuropeanSC2NominalWet" ) ) {
-					WarehouseCoil( CoilID ).RatingType = EuropeanSC2Nom;
+					WarehouseCoil( GetRefrigerationInputCoilID ).RatingType = EuropeanSC2Nom;
 				} else if ( SameString( Alphas( AlphaNum ), "EuropeanSC3Standard" ) ) {
-					WarehouseCoil( CoilID ).RatingType = EuropeanSC3Std;
+					WarehouseCoil( GetRefrigerationInputCoilID ).RatingType = EuropeanSC3Std;
 				} else if ( SameString( Alphas( AlphaNum ), "EuropeanSC3NominalWet" ) ) {
-					WarehouseCoil( CoilID ).RatingType = EuropeanSC3Nom;
+					WarehouseCoil( GetRefrigerationInputCoilID ).RatingType = EuropeanSC3Nom;
 				} else if ( SameString( Alphas( AlphaNum ), "EuropeanSC4Standard" ) ) {
-					WarehouseCoil( CoilID ).RatingType = EuropeanSC4Std;
+					WarehouseCoil( GetRefrigerationInputCoilID ).RatingType = EuropeanSC4Std;
 				} else if ( SameString( Alphas( AlphaNum ), "EuropeanSC4NominalWet" ) ) {
-					WarehouseCoil( CoilID ).RatingType = EuropeanSC4Nom;
+					WarehouseCoil( GetRefrigerationInputCoilID ).RatingType = EuropeanSC4Nom;
 				} else if ( SameString( Alphas( AlphaNum ), "EuropeanSC5Standard" ) ) {
-					WarehouseCoil( CoilID ).RatingType = EuropeanSC5Std;
+					WarehouseCoil( GetRefrigerationInputCoilID ).RatingType = EuropeanSC5Std;
 				} else if ( SameString( Alphas( AlphaNum ), "EuropeanSC5NominalWet" ) ) {
-					WarehouseCoil( CoilID ).RatingType = EuropeanSC5Nom;
+					WarehouseCoil( GetRefrigerationInputCoilID ).RatingType = EuropeanSC5Nom;
 				} else {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + "=\"" + Alphas( AlphaNum ) + "\"." );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + "=\"" + Alphas( AlphaNum ) + "\"." );
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				//Here have to do select case with one numeric field with units of W and the second with units of W/deltaC,
 				//  (RatedRH field only used for RatedCapacityTotal type)
-				{ auto const SELECT_CASE_var( WarehouseCoil( CoilID ).RatingType );
+				{ auto const SELECT_CASE_var( WarehouseCoil( GetRefrigerationInputCoilID ).RatingType );
 				if ( SELECT_CASE_var == UnitLoadFactorSens ) {
 					//N1
 					NumNum = 1;
 					if ( ! lNumericBlanks( NumNum ) && Numbers( NumNum ) > 0.0 ) {
-						WarehouseCoil( CoilID ).UnitLoadFactorSens = Numbers( NumNum );
+						WarehouseCoil( GetRefrigerationInputCoilID ).UnitLoadFactorSens = Numbers( NumNum );
 					} else {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W/C" );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W/C" );
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else if ( SELECT_CASE_var == RatedCapacityTotal ) {
 					//N2
 					NumNum = 2; //advance past rating in W/C to N2 with rating in W
 					if ( ! lNumericBlanks( NumNum ) && Numbers( NumNum ) > 0.0 ) {
-						WarehouseCoil( CoilID ).RatedCapTotal = Numbers( NumNum );
+						WarehouseCoil( GetRefrigerationInputCoilID ).RatedCapTotal = Numbers( NumNum );
 						//N3
 						NumNum = 3; //read rated RH only for this type of rating at N3
 						if ( lNumericBlanks( NumNum ) ) {
-							WarehouseCoil( CoilID ).RatedRH = 0.85;
+							WarehouseCoil( GetRefrigerationInputCoilID ).RatedRH = 0.85;
 						} else {
 							if ( Numbers( NumNum ) <= 0.0 || Numbers( NumNum ) >= 100.0 ) {
-								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be greater than 0% and less than 100%" );
-								ErrorsFound = true;
+								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be greater than 0% and less than 100%" );
+								GetRefrigerationInputErrorsFound = true;
 							}
-							WarehouseCoil( CoilID ).RatedRH = Numbers( NumNum ) / 100.0;
+							WarehouseCoil( GetRefrigerationInputCoilID ).RatedRH = Numbers( NumNum ) / 100.0;
 						}
 					} else {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else if ( SELECT_CASE_var == EuropeanSC1Std ) {
 					//N2
 					NumNum = 2; //advance past rating in W/C to rating in W at N2
 					if ( ! lNumericBlanks( NumNum ) && Numbers( NumNum ) > 0.0 ) {
-						WarehouseCoil( CoilID ).RatedSensibleCap = Numbers( NumNum );
-						WarehouseCoil( CoilID ).SCIndex = 1;
+						WarehouseCoil( GetRefrigerationInputCoilID ).RatedSensibleCap = Numbers( NumNum );
+						WarehouseCoil( GetRefrigerationInputCoilID ).SCIndex = 1;
 					} else {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else if ( SELECT_CASE_var == EuropeanSC1Nom ) {
 					//N2
 					NumNum = 2; //advance past rating in W/C to rating in W at N2
 					if ( ! lNumericBlanks( NumNum ) && Numbers( NumNum ) > 0.0 ) {
-						WarehouseCoil( CoilID ).RatedCapTotal = Numbers( NumNum );
-						WarehouseCoil( CoilID ).RatedSensibleCap = Numbers( NumNum ) / EuropeanWetCoilFactor( 1 );
-						WarehouseCoil( CoilID ).SCIndex = 1;
+						WarehouseCoil( GetRefrigerationInputCoilID ).RatedCapTotal = Numbers( NumNum );
+						WarehouseCoil( GetRefrigerationInputCoilID ).RatedSensibleCap = Numbers( NumNum ) / EuropeanWetCoilFactor( 1 );
+						WarehouseCoil( GetRefrigerationInputCoilID ).SCIndex = 1;
 					} else {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else if ( SELECT_CASE_var == EuropeanSC2Std ) {
 					//N2
 					NumNum = 2; //advance past rating in W/C to rating in W at N2
 					if ( ! lNumericBlanks( NumNum ) && Numbers( NumNum ) > 0.0 ) {
-						WarehouseCoil( CoilID ).RatedSensibleCap = Numbers( NumNum );
-						WarehouseCoil( CoilID ).SCIndex = 2;
+						WarehouseCoil( GetRefrigerationInputCoilID ).RatedSensibleCap = Numbers( NumNum );
+						WarehouseCoil( GetRefrigerationInputCoilID ).SCIndex = 2;
 					} else {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else if ( SELECT_CASE_var == EuropeanSC2Nom ) {
 					//N2
 					NumNum = 2; //advance past rating in W/C to rating in W at N2
 					if ( ! lNumericBlanks( NumNum ) && Numbers( NumNum ) > 0.0 ) {
-						WarehouseCoil( CoilID ).RatedCapTotal = Numbers( NumNum );
-						WarehouseCoil( CoilID ).RatedSensibleCap = Numbers( NumNum ) / EuropeanWetCoilFactor( 2 );
-						WarehouseCoil( CoilID ).SCIndex = 2;
+						WarehouseCoil( GetRefrigerationInputCoilID ).RatedCapTotal = Numbers( NumNum );
+						WarehouseCoil( GetRefrigerationInputCoilID ).RatedSensibleCap = Numbers( NumNum ) / EuropeanWetCoilFactor( 2 );
+						WarehouseCoil( GetRefrigerationInputCoilID ).SCIndex = 2;
 					} else {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else if ( SELECT_CASE_var == EuropeanSC3Std ) {
 					//N2
 					NumNum = 2; //advance past rating in W/C to rating in W at N2
 					if ( ! lNumericBlanks( NumNum ) && Numbers( NumNum ) > 0.0 ) {
-						WarehouseCoil( CoilID ).RatedSensibleCap = Numbers( NumNum );
-						WarehouseCoil( CoilID ).SCIndex = 3;
+						WarehouseCoil( GetRefrigerationInputCoilID ).RatedSensibleCap = Numbers( NumNum );
+						WarehouseCoil( GetRefrigerationInputCoilID ).SCIndex = 3;
 					} else {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else if ( SELECT_CASE_var == EuropeanSC3Nom ) {
 					//N2
 					NumNum = 2; //advance past rating in W/C to rating in W at N2
 					if ( ! lNumericBlanks( NumNum ) && Numbers( NumNum ) > 0.0 ) {
-						WarehouseCoil( CoilID ).RatedCapTotal = Numbers( NumNum );
-						WarehouseCoil( CoilID ).RatedSensibleCap = Numbers( NumNum ) / EuropeanWetCoilFactor( 3 );
-						WarehouseCoil( CoilID ).SCIndex = 3;
+						WarehouseCoil( GetRefrigerationInputCoilID ).RatedCapTotal = Numbers( NumNum );
+						WarehouseCoil( GetRefrigerationInputCoilID ).RatedSensibleCap = Numbers( NumNum ) / EuropeanWetCoilFactor( 3 );
+						WarehouseCoil( GetRefrigerationInputCoilID ).SCIndex = 3;
 					} else {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else if ( SELECT_CASE_var == EuropeanSC4Std ) {
 					//N2
 					NumNum = 2; //advance past rating in W/C to rating in W at N2
 					if ( ! lNumericBlanks( NumNum ) && Numbers( NumNum ) > 0.0 ) {
-						WarehouseCoil( CoilID ).RatedSensibleCap = Numbers( NumNum );
-						WarehouseCoil( CoilID ).SCIndex = 4;
+						WarehouseCoil( GetRefrigerationInputCoilID ).RatedSensibleCap = Numbers( NumNum );
+						WarehouseCoil( GetRefrigerationInputCoilID ).SCIndex = 4;
 					} else {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else if ( SELECT_CASE_var == EuropeanSC4Nom ) {
 					//N2
 					NumNum = 2; //advance past rating in W/C to rating in W at N2
 					if ( ! lNumericBlanks( NumNum ) && Numbers( NumNum ) > 0.0 ) {
-						WarehouseCoil( CoilID ).RatedCapTotal = Numbers( NumNum );
-						WarehouseCoil( CoilID ).RatedSensibleCap = Numbers( NumNum ) / EuropeanWetCoilFactor( 4 );
-						WarehouseCoil( CoilID ).SCIndex = 4;
+						WarehouseCoil( GetRefrigerationInputCoilID ).RatedCapTotal = Numbers( NumNum );
+						WarehouseCoil( GetRefrigerationInputCoilID ).RatedSensibleCap = Numbers( NumNum ) / EuropeanWetCoilFactor( 4 );
+						WarehouseCoil( GetRefrigerationInputCoilID ).SCIndex = 4;
 					} else {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else if ( SELECT_CASE_var == EuropeanSC5Std ) {
 					//N2
 					NumNum = 2; //advance past rating in W/C to rating in W at N2
 					if ( ! lNumericBlanks( NumNum ) && Numbers( NumNum ) > 0.0 ) {
-						WarehouseCoil( CoilID ).RatedSensibleCap = Numbers( NumNum );
-						WarehouseCoil( CoilID ).SCIndex = 5;
+						WarehouseCoil( GetRefrigerationInputCoilID ).RatedSensibleCap = Numbers( NumNum );
+						WarehouseCoil( GetRefrigerationInputCoilID ).SCIndex = 5;
 					} else {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else if ( SELECT_CASE_var == EuropeanSC5Nom ) {
 					//N2
 					NumNum = 2; //advance past rating in W/C to rating in W at N2
 					if ( ! lNumericBlanks( NumNum ) && Numbers( NumNum ) > 0.0 ) {
-						WarehouseCoil( CoilID ).RatedCapTotal = Numbers( NumNum );
-						WarehouseCoil( CoilID ).RatedSensibleCap = Numbers( NumNum ) / EuropeanWetCoilFactor( 5 );
-						WarehouseCoil( CoilID ).SCIndex = 5;
+						WarehouseCoil( GetRefrigerationInputCoilID ).RatedCapTotal = Numbers( NumNum );
+						WarehouseCoil( GetRefrigerationInputCoilID ).RatedSensibleCap = Numbers( NumNum ) / EuropeanWetCoilFactor( 5 );
+						WarehouseCoil( GetRefrigerationInputCoilID ).SCIndex = 5;
 					} else {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and be greater than 0 W" );
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}} //WarehouseCoil(CoilID)%RatingType
 
 				//N4
 				NumNum = 4;
 				if ( ! lNumericBlanks( NumNum ) ) {
-					WarehouseCoil( CoilID ).TEvapDesign = Numbers( NumNum ); //also used to rep inlet brine T later when add that option
+					WarehouseCoil( GetRefrigerationInputCoilID ).TEvapDesign = Numbers( NumNum ); //also used to rep inlet brine T later when add that option
 				} else {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input" );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input" );
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				++NumNum; //N5
 				if ( ! lNumericBlanks( NumNum ) ) {
-					WarehouseCoil( CoilID ).RatedTemperatureDif = Numbers( NumNum );
+					WarehouseCoil( GetRefrigerationInputCoilID ).RatedTemperatureDif = Numbers( NumNum );
 					// INLET temperature - evaporating temperature, NOT room temp - evap temp
 				} else {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input" );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input" );
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				++NumNum; //N6
 				if ( ! lNumericBlanks( NumNum ) ) {
-					WarehouseCoil( CoilID ).MaxTemperatureDif = Numbers( NumNum );
+					WarehouseCoil( GetRefrigerationInputCoilID ).MaxTemperatureDif = Numbers( NumNum );
 					// Maximum difference between INLET temperature - evaporating temperature, NOT room temp - evap temp
 					// Important when cooling down space at start of environment or if large stocking loads imposed.
 				} else {
-					WarehouseCoil( CoilID ).MaxTemperatureDif = 1.3 * WarehouseCoil( CoilID ).RatedTemperatureDif;
-					ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " not entered, default 1.3 times rated temperature difference will be used." );
+					WarehouseCoil( GetRefrigerationInputCoilID ).MaxTemperatureDif = 1.3 * WarehouseCoil( GetRefrigerationInputCoilID ).RatedTemperatureDif;
+					ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " not entered, default 1.3 times rated temperature difference will be used." );
 				}
 
 				// Correction factor from manufacturer's rating for coil material, default 1.0
 				++NumNum; //N7
-				WarehouseCoil( CoilID ).CorrMaterial = 1.0; //default value
-				if ( ! lNumericBlanks( NumNum ) ) WarehouseCoil( CoilID ).CorrMaterial = Numbers( NumNum );
+				WarehouseCoil( GetRefrigerationInputCoilID ).CorrMaterial = 1.0; //default value
+				if ( ! lNumericBlanks( NumNum ) ) WarehouseCoil( GetRefrigerationInputCoilID ).CorrMaterial = Numbers( NumNum );
 
 				// Correction factor from manufacturer's rating for refrigerant, default 1.0
 				++NumNum; //N8
-				WarehouseCoil( CoilID ).CorrRefrigerant = 1.0; //default value
-				if ( ! lNumericBlanks( NumNum ) ) WarehouseCoil( CoilID ).CorrRefrigerant = Numbers( NumNum );
+				WarehouseCoil( GetRefrigerationInputCoilID ).CorrRefrigerant = 1.0; //default value
+				if ( ! lNumericBlanks( NumNum ) ) WarehouseCoil( GetRefrigerationInputCoilID ).CorrRefrigerant = Numbers( NumNum );
 				//ONLY used if the Capacity Rating Type is CapacityTotalSpecificConditions
 
 				//Convert all European sensible capacities to sensible load factors
-				if ( ( WarehouseCoil( CoilID ).RatingType != UnitLoadFactorSens ) && ( WarehouseCoil( CoilID ).RatingType != RatedCapacityTotal ) ) WarehouseCoil( CoilID ).UnitLoadFactorSens = WarehouseCoil( CoilID ).RatedSensibleCap / WarehouseCoil( CoilID ).RatedTemperatureDif;
+				if ( ( WarehouseCoil( GetRefrigerationInputCoilID ).RatingType != UnitLoadFactorSens ) && ( WarehouseCoil( GetRefrigerationInputCoilID ).RatingType != RatedCapacityTotal ) ) WarehouseCoil( GetRefrigerationInputCoilID ).UnitLoadFactorSens = WarehouseCoil( GetRefrigerationInputCoilID ).RatedSensibleCap / WarehouseCoil( GetRefrigerationInputCoilID ).RatedTemperatureDif;
 				//Now have UnitLoadFactorSens for all except RatingType == RatedCapacityTotal
 
 				//Apply material and refrigerant correction factors to sensible load factors
-				if ( ( WarehouseCoil( CoilID ).RatingType != RatedCapacityTotal ) ) WarehouseCoil( CoilID ).UnitLoadFactorSens *= WarehouseCoil( CoilID ).CorrMaterial * WarehouseCoil( CoilID ).CorrRefrigerant;
+				if ( ( WarehouseCoil( GetRefrigerationInputCoilID ).RatingType != RatedCapacityTotal ) ) WarehouseCoil( GetRefrigerationInputCoilID ).UnitLoadFactorSens *= WarehouseCoil( GetRefrigerationInputCoilID ).CorrMaterial * WarehouseCoil( GetRefrigerationInputCoilID ).CorrRefrigerant;
 				//First calc of ratedsensiblecap for type type unitloadfactorsens
-				WarehouseCoil( CoilID ).RatedSensibleCap = WarehouseCoil( CoilID ).UnitLoadFactorSens * WarehouseCoil( CoilID ).RatedTemperatureDif;
+				WarehouseCoil( GetRefrigerationInputCoilID ).RatedSensibleCap = WarehouseCoil( GetRefrigerationInputCoilID ).UnitLoadFactorSens * WarehouseCoil( GetRefrigerationInputCoilID ).RatedTemperatureDif;
 				//A4    Enter capacity correction curve type
 				AlphaNum = 4;
-				if ( ( lAlphaBlanks( AlphaNum ) ) && ( WarehouseCoil( CoilID ).RatingType != RatedCapacityTotal ) ) {
+				if ( ( lAlphaBlanks( AlphaNum ) ) && ( WarehouseCoil( GetRefrigerationInputCoilID ).RatingType != RatedCapacityTotal ) ) {
 					// For all except RatedCapacityTotal - default to linear capacity factor approximating Nelson August 2010 ASHRAE journal
-					WarehouseCoil( CoilID ).SHRCorrectionType = SHR60;
-				} else if ( WarehouseCoil( CoilID ).RatingType == RatedCapacityTotal ) {
+					WarehouseCoil( GetRefrigerationInputCoilID ).SHRCorrectionType = SHR60;
+				} else if ( WarehouseCoil( GetRefrigerationInputCoilID ).RatingType == RatedCapacityTotal ) {
 					// For RatedCapacityTotal, the manufacturer's coil performance map is required
 					// Specify the performance map with TabularRHxDT1xTRoom
-					WarehouseCoil( CoilID ).SHRCorrectionType = TabularRH_DT1_TRoom;
+					WarehouseCoil( GetRefrigerationInputCoilID ).SHRCorrectionType = TabularRH_DT1_TRoom;
 					if ( ! ( SameString( Alphas( AlphaNum ), "TabularRHxDT1xTRoom" ) ) ) {
-						ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", invalid " + cAlphaFieldNames( AlphaNum ) + "=\"" + Alphas( AlphaNum ) + "\"." );
+						ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", invalid " + cAlphaFieldNames( AlphaNum ) + "=\"" + Alphas( AlphaNum ) + "\"." );
 						ShowContinueError( "The \"CapacityTotalSpecificConditions\" Capacity Rating Type has been specified for this air chiller.  This rating type requires " );
 						ShowContinueError( "the \"TabularRHxDT1xTRoom\" correction curve.  Verify that a valid \"TabularRHxDT1xTRoom\" curve is specified in \"" + cAlphaFieldNames( AlphaNum + 1 ) + "\"." );
 					}
 				} else if ( SameString( Alphas( AlphaNum ), "LinearSHR60" ) ) {
-					WarehouseCoil( CoilID ).SHRCorrectionType = SHR60;
+					WarehouseCoil( GetRefrigerationInputCoilID ).SHRCorrectionType = SHR60;
 				} else if ( SameString( Alphas( AlphaNum ), "QuadraticSHR" ) ) {
-					WarehouseCoil( CoilID ).SHRCorrectionType = QuadraticSHR;
+					WarehouseCoil( GetRefrigerationInputCoilID ).SHRCorrectionType = QuadraticSHR;
 				} else if ( SameString( Alphas( AlphaNum ), "European" ) ) {
-					WarehouseCoil( CoilID ).SHRCorrectionType = European;
+					WarehouseCoil( GetRefrigerationInputCoilID ).SHRCorrectionType = European;
 				} else if ( SameString( Alphas( AlphaNum ), "TabularRHxDT1xTRoom" ) ) {
-					WarehouseCoil( CoilID ).SHRCorrectionType = TabularRH_DT1_TRoom;
+					WarehouseCoil( GetRefrigerationInputCoilID ).SHRCorrectionType = TabularRH_DT1_TRoom;
 				} else {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + "=\"" + Alphas( AlphaNum ) + "\"." );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + "=\"" + Alphas( AlphaNum ) + "\"." );
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				++AlphaNum; //A5
 				++NumNum; //N9
-				{ auto const SELECT_CASE_var( WarehouseCoil( CoilID ).SHRCorrectionType );
+				{ auto const SELECT_CASE_var( WarehouseCoil( GetRefrigerationInputCoilID ).SHRCorrectionType );
 				if ( SELECT_CASE_var == SHR60 ) {
-					WarehouseCoil( CoilID ).SHRCorrection60 = 1.48; // reference Nelson, ASHRAE journal August 2010 Fig 2
-					if ( ! lNumericBlanks( NumNum ) ) WarehouseCoil( CoilID ).SHRCorrection60 = Numbers( NumNum );
+					WarehouseCoil( GetRefrigerationInputCoilID ).SHRCorrection60 = 1.48; // reference Nelson, ASHRAE journal August 2010 Fig 2
+					if ( ! lNumericBlanks( NumNum ) ) WarehouseCoil( GetRefrigerationInputCoilID ).SHRCorrection60 = Numbers( NumNum );
 					//(1.66667 would be a perfect effectiveness, 1.0 would be artificial coil that does only sensible)
-					if ( WarehouseCoil( CoilID ).SHRCorrection60 > 1.67 ) {
-						WarehouseCoil( CoilID ).SHRCorrection60 = 1.67;
-						ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be between 1 and 1.67, 1.67 will be used." );
+					if ( WarehouseCoil( GetRefrigerationInputCoilID ).SHRCorrection60 > 1.67 ) {
+						WarehouseCoil( GetRefrigerationInputCoilID ).SHRCorrection60 = 1.67;
+						ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be between 1 and 1.67, 1.67 will be used." );
 					}
-					if ( WarehouseCoil( CoilID ).SHRCorrection60 < 1.0 ) {
-						WarehouseCoil( CoilID ).SHRCorrection60 = 1.0;
-						ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be between 1 and 1.67, 1.00 will be used." );
+					if ( WarehouseCoil( GetRefrigerationInputCoilID ).SHRCorrection60 < 1.0 ) {
+						WarehouseCoil( GetRefrigerationInputCoilID ).SHRCorrection60 = 1.0;
+						ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be between 1 and 1.67, 1.00 will be used." );
 					}
 				} else if ( SELECT_CASE_var == European ) {
 					//WarehouseCoil(CoilID)%SHRCorrectionCurvePtr = GetCurveIndex('ChillerEuropeanWetCoilFactor')
 					// This is a place holder, currently use embedded constants for European ratings, future may want a curve
 				} else if ( SELECT_CASE_var == QuadraticSHR ) {
-					WarehouseCoil( CoilID ).SHRCorrectionCurvePtr = GetCurveIndex( Alphas( AlphaNum ) ); // convert curve name to number
+					WarehouseCoil( GetRefrigerationInputCoilID ).SHRCorrectionCurvePtr = GetCurveIndex( Alphas( AlphaNum ) ); // convert curve name to number
 					if ( lAlphaBlanks( AlphaNum ) ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " is blank, required." );
-						ErrorsFound = true;
-					} else if ( WarehouseCoil( CoilID ).SHRCorrectionCurvePtr == 0 ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", invalid  " );
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " is blank, required." );
+						GetRefrigerationInputErrorsFound = true;
+					} else if ( WarehouseCoil( GetRefrigerationInputCoilID ).SHRCorrectionCurvePtr == 0 ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", invalid  " );
 						ShowContinueError( "...invalid curve " + cAlphaFieldNames( AlphaNum ) + "=\"" + Alphas( AlphaNum ) + "\"." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 					//error checks for curve type entered and curve name
-					if ( ! SameString( GetCurveType( WarehouseCoil( CoilID ).SHRCorrectionCurvePtr ), "QUADRATIC" ) ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " must be of type Quadratic." );
-						ErrorsFound = true;
+					if ( ! SameString( GetCurveType( WarehouseCoil( GetRefrigerationInputCoilID ).SHRCorrectionCurvePtr ), "QUADRATIC" ) ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " must be of type Quadratic." );
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else if ( SELECT_CASE_var == TabularRH_DT1_TRoom ) {
-					WarehouseCoil( CoilID ).SHRCorrectionCurvePtr = GetCurveIndex( Alphas( AlphaNum ) ); // convert curve name to number
+					WarehouseCoil( GetRefrigerationInputCoilID ).SHRCorrectionCurvePtr = GetCurveIndex( Alphas( AlphaNum ) ); // convert curve name to number
 					if ( lAlphaBlanks( AlphaNum ) ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " is blank, required." );
-						ErrorsFound = true;
-					} else if ( WarehouseCoil( CoilID ).SHRCorrectionCurvePtr == 0 ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", invalid  " );
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " is blank, required." );
+						GetRefrigerationInputErrorsFound = true;
+					} else if ( WarehouseCoil( GetRefrigerationInputCoilID ).SHRCorrectionCurvePtr == 0 ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", invalid  " );
 						ShowContinueError( "...invalid curve " + cAlphaFieldNames( AlphaNum ) + "=\"" + Alphas( AlphaNum ) + "\"." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 					//        IF(WarehouseCoil(CoilID)%SHRCorrectionCurvePtr == 0) THEN
 					//          CALL ShowSevereError(RoutineName//TRIM(CurrentModuleObject)//'="'//TRIM(WarehouseCoil(CoilID)%Name)//&
@@ -2284,107 +3140,107 @@ namespace RefrigeratedCase {
 
 				++NumNum; //N10
 				if ( ! lNumericBlanks( NumNum ) ) {
-					WarehouseCoil( CoilID ).HeaterPower = Numbers( NumNum );
+					WarehouseCoil( GetRefrigerationInputCoilID ).HeaterPower = Numbers( NumNum );
 				} else {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input " );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input " );
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				++AlphaNum; //A6
 				if ( ! lAlphaBlanks( AlphaNum ) ) {
-					WarehouseCoil( CoilID ).HeaterSchedPtr = GetScheduleIndex( Alphas( AlphaNum ) ); // convert heater schedule name to pointer
-					if ( WarehouseCoil( CoilID ).HeaterSchedPtr == 0 ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
-						ErrorsFound = true;
+					WarehouseCoil( GetRefrigerationInputCoilID ).HeaterSchedPtr = GetScheduleIndex( Alphas( AlphaNum ) ); // convert heater schedule name to pointer
+					if ( WarehouseCoil( GetRefrigerationInputCoilID ).HeaterSchedPtr == 0 ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
+						GetRefrigerationInputErrorsFound = true;
 					} else { //   check heater schedule for values between 0 and 1
-						if ( ! CheckScheduleValueMinMax( WarehouseCoil( CoilID ).HeaterSchedPtr, ">=", 0.0, "<=", 1.0 ) ) {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\"" );
+						if ( ! CheckScheduleValueMinMax( WarehouseCoil( GetRefrigerationInputCoilID ).HeaterSchedPtr, ">=", 0.0, "<=", 1.0 ) ) {
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\"" );
 							ShowContinueError( "Error found in " + cAlphaFieldNames( AlphaNum ) + " = " + Alphas( AlphaNum ) );
 							ShowContinueError( "schedule values must be (>=0., <=1.)" );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						} //heater schedule ptr == 0
 					} //htr sched == 0
 				} else { // lalphaBlanks, no schedule specified
-					WarehouseCoil( CoilID ).HeaterSchedPtr = AlwaysOn;
+					WarehouseCoil( GetRefrigerationInputCoilID ).HeaterSchedPtr = AlwaysOn;
 				} // not blank
 
 				//Input fan control type
 				++AlphaNum; //A7
 				if ( lAlphaBlanks( AlphaNum ) ) {
-					WarehouseCoil( CoilID ).FanType = FanConstantSpeed;
+					WarehouseCoil( GetRefrigerationInputCoilID ).FanType = FanConstantSpeed;
 				} else if ( SameString( Alphas( AlphaNum ), "Fixed" ) ) {
-					WarehouseCoil( CoilID ).FanType = FanConstantSpeed;
+					WarehouseCoil( GetRefrigerationInputCoilID ).FanType = FanConstantSpeed;
 				} else if ( SameString( Alphas( AlphaNum ), "FixedLinear" ) ) {
-					WarehouseCoil( CoilID ).FanType = FanConstantSpeedLinear;
+					WarehouseCoil( GetRefrigerationInputCoilID ).FanType = FanConstantSpeedLinear;
 				} else if ( SameString( Alphas( AlphaNum ), "VariableSpeed" ) ) {
-					WarehouseCoil( CoilID ).FanType = FanVariableSpeed;
+					WarehouseCoil( GetRefrigerationInputCoilID ).FanType = FanVariableSpeed;
 				} else if ( SameString( Alphas( AlphaNum ), "TwoSpeed" ) ) {
-					WarehouseCoil( CoilID ).FanType = FanTwoSpeed;
+					WarehouseCoil( GetRefrigerationInputCoilID ).FanType = FanTwoSpeed;
 				} else {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + "=\"" + Alphas( AlphaNum ) + "\"." );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + "=\"" + Alphas( AlphaNum ) + "\"." );
+					GetRefrigerationInputErrorsFound = true;
 				} //fan control type
 
 				++NumNum; //N11
 				if ( ! lNumericBlanks( NumNum ) && Numbers( NumNum ) > 0.0 ) {
-					WarehouseCoil( CoilID ).RatedFanPower = Numbers( NumNum );
+					WarehouseCoil( GetRefrigerationInputCoilID ).RatedFanPower = Numbers( NumNum );
 				} else {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " was not input or was less than 0 " );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " was not input or was less than 0 " );
+					GetRefrigerationInputErrorsFound = true;
 				} //coil fan power
 
 				++NumNum; //N12
 				if ( ! lNumericBlanks( NumNum ) && Numbers( NumNum ) > 0.0 ) {
-					WarehouseCoil( CoilID ).RatedAirVolumeFlow = Numbers( NumNum );
+					WarehouseCoil( GetRefrigerationInputCoilID ).RatedAirVolumeFlow = Numbers( NumNum );
 				} else {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " is required and was not input or was less than 0  " );
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " is required and was not input or was less than 0  " );
 				} //air volume flow
 
 				++NumNum; //N13
-				WarehouseCoil( CoilID ).FanMinAirFlowRatio = 0.2; //default value
-				if ( ! lNumericBlanks( NumNum ) && Numbers( NumNum ) > 0.0 ) WarehouseCoil( CoilID ).FanMinAirFlowRatio = Numbers( NumNum );
+				WarehouseCoil( GetRefrigerationInputCoilID ).FanMinAirFlowRatio = 0.2; //default value
+				if ( ! lNumericBlanks( NumNum ) && Numbers( NumNum ) > 0.0 ) WarehouseCoil( GetRefrigerationInputCoilID ).FanMinAirFlowRatio = Numbers( NumNum );
 
 				//Input defrost type
 				++AlphaNum; //A8
 				if ( lAlphaBlanks( AlphaNum ) ) {
-					WarehouseCoil( CoilID ).DefrostType = DefrostElec;
+					WarehouseCoil( GetRefrigerationInputCoilID ).DefrostType = DefrostElec;
 				} else if ( SameString( Alphas( AlphaNum ), "Electric" ) ) {
-					WarehouseCoil( CoilID ).DefrostType = DefrostElec;
+					WarehouseCoil( GetRefrigerationInputCoilID ).DefrostType = DefrostElec;
 				} else if ( SameString( Alphas( AlphaNum ), "HotFluid" ) ) {
-					WarehouseCoil( CoilID ).DefrostType = DefrostFluid;
+					WarehouseCoil( GetRefrigerationInputCoilID ).DefrostType = DefrostFluid;
 				} else if ( SameString( Alphas( AlphaNum ), "None" ) ) {
-					WarehouseCoil( CoilID ).DefrostType = DefrostNone;
+					WarehouseCoil( GetRefrigerationInputCoilID ).DefrostType = DefrostNone;
 				} else if ( SameString( Alphas( AlphaNum ), "OffCycle" ) ) {
-					WarehouseCoil( CoilID ).DefrostType = DefrostOffCycle;
+					WarehouseCoil( GetRefrigerationInputCoilID ).DefrostType = DefrostOffCycle;
 				} else {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + "=\"" + Alphas( AlphaNum ) + "\"." );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + "=\"" + Alphas( AlphaNum ) + "\"." );
+					GetRefrigerationInputErrorsFound = true;
 				} //defrost type
 
 				++AlphaNum; //A9
 				if ( lAlphaBlanks( AlphaNum ) ) {
-					WarehouseCoil( CoilID ).DefrostControlType = DefrostControlSched;
+					WarehouseCoil( GetRefrigerationInputCoilID ).DefrostControlType = DefrostControlSched;
 				} else if ( SameString( Alphas( AlphaNum ), "TimeSchedule" ) ) {
-					WarehouseCoil( CoilID ).DefrostControlType = DefrostControlSched;
+					WarehouseCoil( GetRefrigerationInputCoilID ).DefrostControlType = DefrostControlSched;
 				} else if ( SameString( Alphas( AlphaNum ), "TemperatureTermination" ) ) {
-					WarehouseCoil( CoilID ).DefrostControlType = DefrostContTempTerm;
+					WarehouseCoil( GetRefrigerationInputCoilID ).DefrostControlType = DefrostContTempTerm;
 				} else {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
+					GetRefrigerationInputErrorsFound = true;
 				} // defrost control type
 
 				// convert defrost schedule name to pointer
 				++AlphaNum; //A10
-				WarehouseCoil( CoilID ).DefrostSchedPtr = GetScheduleIndex( Alphas( AlphaNum ) );
-				if ( WarehouseCoil( CoilID ).DefrostSchedPtr == 0 ) {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
-					ErrorsFound = true;
+				WarehouseCoil( GetRefrigerationInputCoilID ).DefrostSchedPtr = GetScheduleIndex( Alphas( AlphaNum ) );
+				if ( WarehouseCoil( GetRefrigerationInputCoilID ).DefrostSchedPtr == 0 ) {
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
+					GetRefrigerationInputErrorsFound = true;
 				} else { //   check defrost schedule for values between 0 and 1
-					if ( ! CheckScheduleValueMinMax( WarehouseCoil( CoilID ).DefrostSchedPtr, ">=", 0.0, "<=", 1.0 ) ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + " = \"" + WarehouseCoil( CoilID ).Name + "\"" );
+					if ( ! CheckScheduleValueMinMax( WarehouseCoil( GetRefrigerationInputCoilID ).DefrostSchedPtr, ">=", 0.0, "<=", 1.0 ) ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + " = \"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\"" );
 						ShowContinueError( "Error found in " + cAlphaFieldNames( AlphaNum ) + '=' + Alphas( AlphaNum ) );
 						ShowContinueError( "schedule values must be (>=0., <=1.)" );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} //checkschedulevalueMinMax
 				} //check for valid schedule name
 
@@ -2392,66 +3248,66 @@ namespace RefrigeratedCase {
 				// some defrost types do not use drip-down schedules, use same defrost schedule pointer in that case
 				++AlphaNum; //A11
 				if ( ! lAlphaBlanks( AlphaNum ) ) {
-					WarehouseCoil( CoilID ).DefrostDripDownSchedPtr = GetScheduleIndex( Alphas( AlphaNum ) );
-					if ( WarehouseCoil( CoilID ).DefrostDripDownSchedPtr == 0 ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
-						ErrorsFound = true;
+					WarehouseCoil( GetRefrigerationInputCoilID ).DefrostDripDownSchedPtr = GetScheduleIndex( Alphas( AlphaNum ) );
+					if ( WarehouseCoil( GetRefrigerationInputCoilID ).DefrostDripDownSchedPtr == 0 ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
+						GetRefrigerationInputErrorsFound = true;
 					} else { // check schedule for values between 0 and 1
-						if ( ! CheckScheduleValueMinMax( WarehouseCoil( CoilID ).DefrostDripDownSchedPtr, ">=", 0.0, "<=", 1.0 ) ) {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\"" );
+						if ( ! CheckScheduleValueMinMax( WarehouseCoil( GetRefrigerationInputCoilID ).DefrostDripDownSchedPtr, ">=", 0.0, "<=", 1.0 ) ) {
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\"" );
 							ShowContinueError( "Error found in " + cAlphaFieldNames( AlphaNum ) + " = " + Alphas( AlphaNum ) );
 							ShowContinueError( "schedule values must be (>=0., <=1.)" );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						} //Check schedule value between 0 and 1
 					} // Check if drip down schedule name is valid
 				} else { // .not. lAlphaBlanks  so use drip down schedule for defrost
-					WarehouseCoil( CoilID ).DefrostDripDownSchedPtr = WarehouseCoil( CoilID ).DefrostSchedPtr;
+					WarehouseCoil( GetRefrigerationInputCoilID ).DefrostDripDownSchedPtr = WarehouseCoil( GetRefrigerationInputCoilID ).DefrostSchedPtr;
 				} // .not. lAlphaBlanks
 
 				++NumNum; //N14
-				if ( WarehouseCoil( CoilID ).DefrostType == DefrostOffCycle || WarehouseCoil( CoilID ).DefrostType == DefrostNone ) {
-					WarehouseCoil( CoilID ).DefrostCapacity = 0.0;
+				if ( WarehouseCoil( GetRefrigerationInputCoilID ).DefrostType == DefrostOffCycle || WarehouseCoil( GetRefrigerationInputCoilID ).DefrostType == DefrostNone ) {
+					WarehouseCoil( GetRefrigerationInputCoilID ).DefrostCapacity = 0.0;
 					//Don't even need to read Defrost capacity for those two defrost types.
 				} else { //have electric or hot gas/brine defrost
 					if ( ( lNumericBlanks( NumNum ) ) || ( Numbers( NumNum ) <= 0.0 ) ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and greater than or equal to 0 W for " + cAlphaFieldNames( AlphaNum ) + ' ' + Alphas( AlphaNum ) );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be input and greater than or equal to 0 W for " + cAlphaFieldNames( AlphaNum ) + ' ' + Alphas( AlphaNum ) );
+						GetRefrigerationInputErrorsFound = true;
 					} else {
-						WarehouseCoil( CoilID ).DefrostCapacity = Numbers( NumNum );
+						WarehouseCoil( GetRefrigerationInputCoilID ).DefrostCapacity = Numbers( NumNum );
 					} //Blank  or negative Defrost Capacity
 
 					//defaults for defrost energy fraction are 0.7 for elec defrost and 0.3 for warm fluid
 					//note this value is only used for temperature terminated defrost control type
-					if ( WarehouseCoil( CoilID ).DefrostType == DefrostElec ) WarehouseCoil( CoilID ).DefEnergyFraction = 0.7;
-					if ( WarehouseCoil( CoilID ).DefrostType == DefrostFluid ) WarehouseCoil( CoilID ).DefEnergyFraction = 0.3;
+					if ( WarehouseCoil( GetRefrigerationInputCoilID ).DefrostType == DefrostElec ) WarehouseCoil( GetRefrigerationInputCoilID ).DefEnergyFraction = 0.7;
+					if ( WarehouseCoil( GetRefrigerationInputCoilID ).DefrostType == DefrostFluid ) WarehouseCoil( GetRefrigerationInputCoilID ).DefEnergyFraction = 0.3;
 
 					++NumNum; //N15
 					if ( ! lNumericBlanks( NumNum ) ) {
 						if ( ( Numbers( NumNum ) > 1.0 ) || ( Numbers( NumNum ) < 0.0 ) ) {
-							ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be between 0 and 1, default values will be used." );
+							ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be between 0 and 1, default values will be used." );
 						} else {
-							WarehouseCoil( CoilID ).DefEnergyFraction = Numbers( NumNum );
+							WarehouseCoil( GetRefrigerationInputCoilID ).DefEnergyFraction = Numbers( NumNum );
 						} // number out of range
 					} //lnumericblanks
 				} // defrost type
 
 				++AlphaNum; //A12
 				if ( lAlphaBlanks( AlphaNum ) ) {
-					WarehouseCoil( CoilID ).VerticalLocation = Middle; //default position
+					WarehouseCoil( GetRefrigerationInputCoilID ).VerticalLocation = Middle; //default position
 				} else if ( SameString( Alphas( AlphaNum ), "Ceiling" ) ) {
-					WarehouseCoil( CoilID ).VerticalLocation = Ceiling;
+					WarehouseCoil( GetRefrigerationInputCoilID ).VerticalLocation = Ceiling;
 				} else if ( SameString( Alphas( AlphaNum ), "Middle" ) ) {
-					WarehouseCoil( CoilID ).VerticalLocation = Middle;
+					WarehouseCoil( GetRefrigerationInputCoilID ).VerticalLocation = Middle;
 				} else if ( SameString( Alphas( AlphaNum ), "Floor" ) ) {
-					WarehouseCoil( CoilID ).VerticalLocation = Floor;
+					WarehouseCoil( GetRefrigerationInputCoilID ).VerticalLocation = Floor;
 				} else {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( CoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + WarehouseCoil( GetRefrigerationInputCoilID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
+					GetRefrigerationInputErrorsFound = true;
 				} // Vertical location class
 
 				++NumNum; //N16
-				WarehouseCoil( CoilID ).DesignRefrigInventory = 0.0;
-				if ( ! lNumericBlanks( NumNum ) ) WarehouseCoil( CoilID ).DesignRefrigInventory = Numbers( NumNum );
+				WarehouseCoil( GetRefrigerationInputCoilID ).DesignRefrigInventory = 0.0;
+				if ( ! lNumericBlanks( NumNum ) ) WarehouseCoil( GetRefrigerationInputCoilID ).DesignRefrigInventory = Numbers( NumNum );
 			} //NumRefrigAirChillers
 		} //NumRefrigerationAirChillers > 0
 
@@ -2474,7 +3330,7 @@ namespace RefrigeratedCase {
 				if ( IsNotOK ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + ", has an invalid or undefined name=\"" + Alphas( AlphaNum ) + "\"." );
 					if ( IsBlank ) Alphas( AlphaNum ) = "xxxxx";
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 				AirChillerSet( SetID ).Name = Alphas( AlphaNum );
 
@@ -2483,7 +3339,7 @@ namespace RefrigeratedCase {
 					AirChillerSet( SetID ).SchedPtr = GetScheduleIndex( Alphas( AlphaNum ) ); // convert schedule name to pointer
 					if ( AirChillerSet( SetID ).SchedPtr == 0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + AirChillerSet( SetID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found: " + Alphas( AlphaNum ) );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} // ptr == 0
 				} else { // no schedule specified
 					AirChillerSet( SetID ).SchedPtr = AlwaysOn;
@@ -2495,7 +3351,7 @@ namespace RefrigeratedCase {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + AirChillerSet( SetID ).Name + "\"" );
 						ShowContinueError( "Error found in " + cAlphaFieldNames( AlphaNum ) + " = " + Alphas( AlphaNum ) );
 						ShowContinueError( "schedule values must be (>=0., <=1.)" );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 
@@ -2505,13 +3361,13 @@ namespace RefrigeratedCase {
 
 				if ( AirChillerSet( SetID ).ZoneNum == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + AirChillerSet( SetID ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not valid: " + Alphas( AlphaNum ) );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 				AirChillerSet( SetID ).ZoneNodeNum = GetSystemNodeNumberForZone( AirChillerSet( SetID ).ZoneName );
 				if ( AirChillerSet( SetID ).ZoneNodeNum == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + AirChillerSet( SetID ).Name + "\" System Node Number not found for " + cAlphaFieldNames( AlphaNum ) + " = " + Alphas( AlphaNum ) );
 					ShowContinueError( ".. Refrigeration chillers must reference a controlled Zone (appear in a ZoneHVAC:EquipmentConnections object." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 				RefrigPresentInZone( AirChillerSet( SetID ).ZoneNum ) = true;
 
@@ -2545,7 +3401,7 @@ namespace RefrigeratedCase {
 						CoilNum = FindItemInList( Alphas( AlphaListNum ), WarehouseCoil );
 						if ( CoilNum == 0 ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + AirChillerSet( SetID ).Name + "\", has an invalid " + cAlphaFieldNames( AlphaListNum ) + " defined as " + Alphas( AlphaListNum ) );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						} // == 0
 						AirChillerSet( SetID ).CoilNum( ChillerIndex ) = CoilNum;
 						WarehouseCoil( CoilNum ).ZoneName = AirChillerSet( SetID ).ZoneName;
@@ -2567,7 +3423,7 @@ namespace RefrigeratedCase {
 				VerifyName( Alphas( 1 ), CaseAndWalkInList, ListNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
 					if ( IsBlank ) Alphas( 1 ) = "xxxxx";
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				CaseAndWalkInList( ListNum ).Name = Alphas( 1 );
@@ -2595,10 +3451,10 @@ namespace RefrigeratedCase {
 						if ( NumSimulationRefrigAirChillers > 0 ) LoadCoilNum = FindItemInList( Alphas( AlphaListNum ), WarehouseCoil );
 						if ( ( LoadWalkInNum == 0 ) && ( LoadCaseNum == 0 ) && ( LoadCoilNum == 0 ) ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + cAlphaFieldNames( AlphaListNum ) + "\", has an invalid value of " + Alphas( AlphaListNum ) );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						} else if ( ( LoadWalkInNum != 0 ) && ( LoadCaseNum != 0 ) && ( LoadCoilNum != 0 ) ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + cAlphaFieldNames( AlphaListNum ) + "\", " + Alphas( AlphaListNum ) + " Case and WalkIns and Refrigerated Coils cannot have the same name." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						} else if ( LoadWalkInNum != 0 ) {
 							++NumWalkInsOnList;
 							CaseAndWalkInList( ListNum ).WalkInItemNum( NumWalkInsOnList ) = LoadWalkInNum;
@@ -2613,7 +3469,7 @@ namespace RefrigeratedCase {
 				} //Num Total Loads on List
 				if ( LoadCount == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + ", \"" + CaseAndWalkInList( ListNum ).Name + "\" : degenerate list All entries were blank." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				} //loadcount == 0
 				CaseAndWalkInList( ListNum ).NumCases = NumCasesOnList;
 				CaseAndWalkInList( ListNum ).NumCoils = NumCoilsOnList;
@@ -2629,230 +3485,230 @@ namespace RefrigeratedCase {
 
 			CurrentModuleObject = "Refrigeration:CompressorRack";
 
-			for ( RackNum = 1; RackNum <= NumRefrigeratedRacks; ++RackNum ) {
+			for ( GetRefrigerationInputRackNum = 1; GetRefrigerationInputRackNum <= NumRefrigeratedRacks; ++GetRefrigerationInputRackNum ) {
 
-				GetObjectItem( CurrentModuleObject, RackNum, Alphas, NumAlphas, Numbers, NumNumbers, IOStatus, lNumericBlanks, lAlphaBlanks, cAlphaFieldNames, cNumericFieldNames );
+				GetObjectItem( CurrentModuleObject, GetRefrigerationInputRackNum, Alphas, NumAlphas, Numbers, NumNumbers, IOStatus, lNumericBlanks, lAlphaBlanks, cAlphaFieldNames, cNumericFieldNames );
 				IsNotOK = false;
 				IsBlank = false;
-				VerifyName( Alphas( 1 ), RefrigRack, RackNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+				VerifyName( Alphas( 1 ), RefrigRack, GetRefrigerationInputRackNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + ", has an invalid or undefined " + cAlphaFieldNames( 1 ) + "=\"" + Alphas( 1 ) + "\"." );
 					if ( IsBlank ) Alphas( 1 ) = "xxxxx";
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
-				RefrigRack( RackNum ).Name = Alphas( 1 );
-				HeatReclaimRefrigeratedRack( RackNum ).Name = Alphas( 1 );
-				HeatReclaimRefrigeratedRack( RackNum ).SourceType = CurrentModuleObject;
+				RefrigRack( GetRefrigerationInputRackNum ).Name = Alphas( 1 );
+				HeatReclaimRefrigeratedRack( GetRefrigerationInputRackNum ).Name = Alphas( 1 );
+				HeatReclaimRefrigeratedRack( GetRefrigerationInputRackNum ).SourceType = CurrentModuleObject;
 				if ( SameString( Alphas( 2 ), "Outdoors" ) ) {
-					RefrigRack( RackNum ).HeatRejectionLocation = LocationOutdoors;
+					RefrigRack( GetRefrigerationInputRackNum ).HeatRejectionLocation = LocationOutdoors;
 				} else if ( SameString( Alphas( 2 ), "Zone" ) ) {
-					RefrigRack( RackNum ).HeatRejectionLocation = LocationZone;
+					RefrigRack( GetRefrigerationInputRackNum ).HeatRejectionLocation = LocationZone;
 					// don't need to set RefrigPresentInZone to .TRUE. here because only allowed to reject heat to zone
 					// holding all served cases,  so already set when case read in
 				} else {
-					RefrigRack( RackNum ).HeatRejectionLocation = LocationOutdoors;
-					ShowWarningError( CurrentModuleObject + ", " + cAlphaFieldNames( 1 ) + " = \"" + RefrigRack( RackNum ).Name + "\": " + cAlphaFieldNames( 2 ) + " defined as " + Alphas( 2 ) + " not found. Will assume " + cAlphaFieldNames( 2 ) + " is OUTDOORS and simulation continues." );
+					RefrigRack( GetRefrigerationInputRackNum ).HeatRejectionLocation = LocationOutdoors;
+					ShowWarningError( CurrentModuleObject + ", " + cAlphaFieldNames( 1 ) + " = \"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\": " + cAlphaFieldNames( 2 ) + " defined as " + Alphas( 2 ) + " not found. Will assume " + cAlphaFieldNames( 2 ) + " is OUTDOORS and simulation continues." );
 				}
 
-				RefrigRack( RackNum ).RatedCOP = Numbers( 1 );
+				RefrigRack( GetRefrigerationInputRackNum ).RatedCOP = Numbers( 1 );
 
-				if ( RefrigRack( RackNum ).RatedCOP <= 0.0 ) {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\" " + cNumericFieldNames( 1 ) + " must be greater than 0.0" );
-					ErrorsFound = true;
+				if ( RefrigRack( GetRefrigerationInputRackNum ).RatedCOP <= 0.0 ) {
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\" " + cNumericFieldNames( 1 ) + " must be greater than 0.0" );
+					GetRefrigerationInputErrorsFound = true;
 				}
 
-				RefrigRack( RackNum ).COPFTempPtr = GetCurveIndex( Alphas( 3 ) ); // convert curve name to number
-				if ( RefrigRack( RackNum ).COPFTempPtr == 0 ) {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\", invalid  " + cAlphaFieldNames( 3 ) + " not found:" + Alphas( 3 ) );
-					ErrorsFound = true;
+				RefrigRack( GetRefrigerationInputRackNum ).COPFTempPtr = GetCurveIndex( Alphas( 3 ) ); // convert curve name to number
+				if ( RefrigRack( GetRefrigerationInputRackNum ).COPFTempPtr == 0 ) {
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\", invalid  " + cAlphaFieldNames( 3 ) + " not found:" + Alphas( 3 ) );
+					GetRefrigerationInputErrorsFound = true;
 				}
 
-				if ( ! SameString( GetCurveType( RefrigRack( RackNum ).COPFTempPtr ), "CUBIC" ) ) {
-					if ( ! SameString( GetCurveType( RefrigRack( RackNum ).COPFTempPtr ), "QUADRATIC" ) ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\", invalid  " + cAlphaFieldNames( 3 ) + " object must be of type cubic or quadratic." );
-						ErrorsFound = true;
+				if ( ! SameString( GetCurveType( RefrigRack( GetRefrigerationInputRackNum ).COPFTempPtr ), "CUBIC" ) ) {
+					if ( ! SameString( GetCurveType( RefrigRack( GetRefrigerationInputRackNum ).COPFTempPtr ), "QUADRATIC" ) ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\", invalid  " + cAlphaFieldNames( 3 ) + " object must be of type cubic or quadratic." );
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 
-				RefrigRack( RackNum ).CondenserFanPower = Numbers( 2 );
+				RefrigRack( GetRefrigerationInputRackNum ).CondenserFanPower = Numbers( 2 );
 				if ( Numbers( 2 ) < 0.0 ) {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\" " + cNumericFieldNames( 2 ) + " must be greater than or equal to 0 Watts." );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\" " + cNumericFieldNames( 2 ) + " must be greater than or equal to 0 Watts." );
+					GetRefrigerationInputErrorsFound = true;
 				}
 
-				RefrigRack( RackNum ).TotCondFTempPtr = GetCurveIndex( Alphas( 4 ) ); // convert curve name to number
-				if ( ( ! lAlphaBlanks( 4 ) ) && RefrigRack( RackNum ).TotCondFTempPtr == 0 ) {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\", invalid  " + cAlphaFieldNames( 4 ) + " not found:" + Alphas( 4 ) );
-					ErrorsFound = true;
+				RefrigRack( GetRefrigerationInputRackNum ).TotCondFTempPtr = GetCurveIndex( Alphas( 4 ) ); // convert curve name to number
+				if ( ( ! lAlphaBlanks( 4 ) ) && RefrigRack( GetRefrigerationInputRackNum ).TotCondFTempPtr == 0 ) {
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\", invalid  " + cAlphaFieldNames( 4 ) + " not found:" + Alphas( 4 ) );
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				if ( ! lAlphaBlanks( 4 ) ) {
-					if ( ! SameString( GetCurveType( RefrigRack( RackNum ).TotCondFTempPtr ), "CUBIC" ) ) {
-						if ( ! SameString( GetCurveType( RefrigRack( RackNum ).TotCondFTempPtr ), "QUADRATIC" ) ) {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\", invalid  " + cAlphaFieldNames( 4 ) + " object must be of type cubic or quadratic." );
-							ErrorsFound = true;
+					if ( ! SameString( GetCurveType( RefrigRack( GetRefrigerationInputRackNum ).TotCondFTempPtr ), "CUBIC" ) ) {
+						if ( ! SameString( GetCurveType( RefrigRack( GetRefrigerationInputRackNum ).TotCondFTempPtr ), "QUADRATIC" ) ) {
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\", invalid  " + cAlphaFieldNames( 4 ) + " object must be of type cubic or quadratic." );
+							GetRefrigerationInputErrorsFound = true;
 						}
 					}
 				}
 
 				if ( SameString( Alphas( 5 ), "EvaporativelyCooled" ) ) {
-					RefrigRack( RackNum ).CondenserType = RefrigCondenserTypeEvap;
-					if ( RefrigRack( RackNum ).HeatRejectionLocation == LocationZone ) {
-						ShowWarningError( CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\" Evap cooled " + cAlphaFieldNames( 5 ) + " not available with " + cAlphaFieldNames( 2 ) + " = Zone." );
+					RefrigRack( GetRefrigerationInputRackNum ).CondenserType = RefrigCondenserTypeEvap;
+					if ( RefrigRack( GetRefrigerationInputRackNum ).HeatRejectionLocation == LocationZone ) {
+						ShowWarningError( CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\" Evap cooled " + cAlphaFieldNames( 5 ) + " not available with " + cAlphaFieldNames( 2 ) + " = Zone." );
 						ShowContinueError( cAlphaFieldNames( 5 ) + " reset to Air Cooled and simulation continues." );
-						RefrigRack( RackNum ).CondenserType = RefrigCondenserTypeAir;
+						RefrigRack( GetRefrigerationInputRackNum ).CondenserType = RefrigCondenserTypeAir;
 					}
 				} else if ( SameString( Alphas( 5 ), "WaterCooled" ) ) {
-					RefrigRack( RackNum ).CondenserType = RefrigCondenserTypeWater;
-					if ( RefrigRack( RackNum ).HeatRejectionLocation == LocationZone ) {
-						ShowWarningError( CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\" Water cooled " + cAlphaFieldNames( 5 ) + " not available with " + cAlphaFieldNames( 2 ) + " = Zone." );
+					RefrigRack( GetRefrigerationInputRackNum ).CondenserType = RefrigCondenserTypeWater;
+					if ( RefrigRack( GetRefrigerationInputRackNum ).HeatRejectionLocation == LocationZone ) {
+						ShowWarningError( CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\" Water cooled " + cAlphaFieldNames( 5 ) + " not available with " + cAlphaFieldNames( 2 ) + " = Zone." );
 						ShowContinueError( cAlphaFieldNames( 5 ) + " reset to Air Cooled and simulation continues." );
-						RefrigRack( RackNum ).CondenserType = RefrigCondenserTypeAir;
+						RefrigRack( GetRefrigerationInputRackNum ).CondenserType = RefrigCondenserTypeAir;
 					}
 				} else {
-					RefrigRack( RackNum ).CondenserType = RefrigCondenserTypeAir;
+					RefrigRack( GetRefrigerationInputRackNum ).CondenserType = RefrigCondenserTypeAir;
 				}
 				// Get water-cooled condenser input, if applicable
-				if ( RefrigRack( RackNum ).CondenserType == RefrigCondenserTypeWater ) {
-					RefrigRack( RackNum ).InletNode = GetOnlySingleNode( Alphas( 6 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Water, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-					RefrigRack( RackNum ).OutletNode = GetOnlySingleNode( Alphas( 7 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Water, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+				if ( RefrigRack( GetRefrigerationInputRackNum ).CondenserType == RefrigCondenserTypeWater ) {
+					RefrigRack( GetRefrigerationInputRackNum ).InletNode = GetOnlySingleNode( Alphas( 6 ), GetRefrigerationInputErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Water, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+					RefrigRack( GetRefrigerationInputRackNum ).OutletNode = GetOnlySingleNode( Alphas( 7 ), GetRefrigerationInputErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Water, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 					// Check node connections
 					TestCompSet( CurrentModuleObject, Alphas( 1 ), Alphas( 6 ), Alphas( 7 ), "RefrigRack Nodes" );
 					// Get loop flow type
 					if ( SameString( Alphas( 8 ), "VariableFlow" ) ) {
-						RefrigRack( RackNum ).FlowType = VariableFlow;
+						RefrigRack( GetRefrigerationInputRackNum ).FlowType = VariableFlow;
 					} else if ( SameString( Alphas( 8 ), "ConstantFlow" ) ) {
-						RefrigRack( RackNum ).FlowType = ConstantFlow;
+						RefrigRack( GetRefrigerationInputRackNum ).FlowType = ConstantFlow;
 					} else {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\", invalid  " + cAlphaFieldNames( 8 ) + " not recognized: " + Alphas( 8 ) );
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\", invalid  " + cAlphaFieldNames( 8 ) + " not recognized: " + Alphas( 8 ) );
 						ShowContinueError( "Check input value choices." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 					// Get outlet temperature schedule for variable flow case
-					if ( RefrigRack( RackNum ).FlowType == VariableFlow ) {
+					if ( RefrigRack( GetRefrigerationInputRackNum ).FlowType == VariableFlow ) {
 						if ( lAlphaBlanks( 9 ) ) {
-							RefrigRack( RackNum ).OutletTempSchedPtr = 0;
+							RefrigRack( GetRefrigerationInputRackNum ).OutletTempSchedPtr = 0;
 						} else {
-							RefrigRack( RackNum ).OutletTempSchedPtr = GetScheduleIndex( Alphas( 9 ) ); // convert schedule name to pointer
+							RefrigRack( GetRefrigerationInputRackNum ).OutletTempSchedPtr = GetScheduleIndex( Alphas( 9 ) ); // convert schedule name to pointer
 						}
-						if ( RefrigRack( RackNum ).OutletTempSchedPtr == 0 ) {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\", invalid  " + cAlphaFieldNames( 9 ) + " : " + Alphas( 9 ) );
+						if ( RefrigRack( GetRefrigerationInputRackNum ).OutletTempSchedPtr == 0 ) {
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\", invalid  " + cAlphaFieldNames( 9 ) + " : " + Alphas( 9 ) );
 							ShowContinueError( "A schedule with this name is not defined in this input data file." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						}
 					}
 					// Get volumetric flow rate if applicable
-					if ( RefrigRack( RackNum ).FlowType == ConstantFlow ) {
-						RefrigRack( RackNum ).DesVolFlowRate = Numbers( 3 );
-						RefrigRack( RackNum ).VolFlowRate = Numbers( 3 );
+					if ( RefrigRack( GetRefrigerationInputRackNum ).FlowType == ConstantFlow ) {
+						RefrigRack( GetRefrigerationInputRackNum ).DesVolFlowRate = Numbers( 3 );
+						RefrigRack( GetRefrigerationInputRackNum ).VolFlowRate = Numbers( 3 );
 					}
 					// Get maximum flow rates
-					RefrigRack( RackNum ).VolFlowRateMax = Numbers( 4 );
+					RefrigRack( GetRefrigerationInputRackNum ).VolFlowRateMax = Numbers( 4 );
 
 					// Check constant flow for max violation, if applicable
-					if ( RefrigRack( RackNum ).FlowType == ConstantFlow && RefrigRack( RackNum ).VolFlowRate > Numbers( 4 ) ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\" " + cNumericFieldNames( 3 ) + " > " + cNumericFieldNames( 4 ) + '.' );
+					if ( RefrigRack( GetRefrigerationInputRackNum ).FlowType == ConstantFlow && RefrigRack( GetRefrigerationInputRackNum ).VolFlowRate > Numbers( 4 ) ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\" " + cNumericFieldNames( 3 ) + " > " + cNumericFieldNames( 4 ) + '.' );
 						ShowContinueError( "Revise flow rates." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 					// Get max/min allowed water temps
-					RefrigRack( RackNum ).OutletTempMax = Numbers( 5 );
-					RefrigRack( RackNum ).InletTempMin = Numbers( 6 );
+					RefrigRack( GetRefrigerationInputRackNum ).OutletTempMax = Numbers( 5 );
+					RefrigRack( GetRefrigerationInputRackNum ).InletTempMin = Numbers( 6 );
 					// set hardware limits on Node data structure for plant interactions
 					//Node(RefrigRack(RackNum)%InletNode)%MassFlowRateMax = RefrigRack(RackNum)%MassFlowRateMax      !CR7425
 					//Node(RefrigRack(RackNum)%InletNode)%MassFlowRateMin = 0.0D0                                    !CR7435
 					// set flow request for plant sizing.
-					RegisterPlantCompDesignFlow( RefrigRack( RackNum ).InletNode, RefrigRack( RackNum ).VolFlowRateMax );
+					RegisterPlantCompDesignFlow( RefrigRack( GetRefrigerationInputRackNum ).InletNode, RefrigRack( GetRefrigerationInputRackNum ).VolFlowRateMax );
 				} //Water cooled condenser data
 
 				// Get evaporative cooled condenser input
 				if ( lAlphaBlanks( 10 ) ) {
-					RefrigRack( RackNum ).EvapSchedPtr = 0;
+					RefrigRack( GetRefrigerationInputRackNum ).EvapSchedPtr = 0;
 				} else {
-					RefrigRack( RackNum ).EvapSchedPtr = GetScheduleIndex( Alphas( 10 ) ); // convert schedule name to pointer
+					RefrigRack( GetRefrigerationInputRackNum ).EvapSchedPtr = GetScheduleIndex( Alphas( 10 ) ); // convert schedule name to pointer
 					//   check availability schedule for values >= 0
-					if ( RefrigRack( RackNum ).EvapSchedPtr > 0 ) {
-						if ( ! CheckScheduleValueMinMax( RefrigRack( RackNum ).EvapSchedPtr, ">=", 0.0 ) ) {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\" ." );
+					if ( RefrigRack( GetRefrigerationInputRackNum ).EvapSchedPtr > 0 ) {
+						if ( ! CheckScheduleValueMinMax( RefrigRack( GetRefrigerationInputRackNum ).EvapSchedPtr, ">=", 0.0 ) ) {
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\" ." );
 							ShowContinueError( "Error found in " + cAlphaFieldNames( 10 ) + " = " + Alphas( 10 ) );
 							ShowContinueError( "schedule values must be (>=0.)." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						}
 					} else {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\", invalid  " + cAlphaFieldNames( 10 ) + " = " + Alphas( 10 ) );
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\", invalid  " + cAlphaFieldNames( 10 ) + " = " + Alphas( 10 ) );
 						ShowContinueError( "A schedule with this name is not defined in this input data file." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 
-				RefrigRack( RackNum ).EvapEffect = Numbers( 7 );
-				if ( RefrigRack( RackNum ).EvapEffect < 0.0 || RefrigRack( RackNum ).EvapEffect > 1.0 ) {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\" " + cNumericFieldNames( 7 ) + " cannot be less than zero or greater than 1.0." );
-					ErrorsFound = true;
+				RefrigRack( GetRefrigerationInputRackNum ).EvapEffect = Numbers( 7 );
+				if ( RefrigRack( GetRefrigerationInputRackNum ).EvapEffect < 0.0 || RefrigRack( GetRefrigerationInputRackNum ).EvapEffect > 1.0 ) {
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\" " + cNumericFieldNames( 7 ) + " cannot be less than zero or greater than 1.0." );
+					GetRefrigerationInputErrorsFound = true;
 				}
 
-				RefrigRack( RackNum ).CondenserAirFlowRate = Numbers( 8 );
-				if ( RefrigRack( RackNum ).CondenserType == RefrigCondenserTypeEvap && RefrigRack( RackNum ).CondenserAirFlowRate <= 0.0 && RefrigRack( RackNum ).CondenserAirFlowRate != AutoCalculate ) {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\", " + cNumericFieldNames( 8 ) + " cannot be less than or equal to zero." );
-					ErrorsFound = true;
+				RefrigRack( GetRefrigerationInputRackNum ).CondenserAirFlowRate = Numbers( 8 );
+				if ( RefrigRack( GetRefrigerationInputRackNum ).CondenserType == RefrigCondenserTypeEvap && RefrigRack( GetRefrigerationInputRackNum ).CondenserAirFlowRate <= 0.0 && RefrigRack( GetRefrigerationInputRackNum ).CondenserAirFlowRate != AutoCalculate ) {
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\", " + cNumericFieldNames( 8 ) + " cannot be less than or equal to zero." );
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				//   Basin heater power as a function of temperature must be greater than or equal to 0
-				RefrigRack( RackNum ).BasinHeaterPowerFTempDiff = Numbers( 9 );
-				if ( RefrigRack( RackNum ).CondenserType == RefrigCondenserTypeEvap && Numbers( 9 ) < 0.0 ) {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\", " + cNumericFieldNames( 9 ) + " must be >= 0" );
-					ErrorsFound = true;
+				RefrigRack( GetRefrigerationInputRackNum ).BasinHeaterPowerFTempDiff = Numbers( 9 );
+				if ( RefrigRack( GetRefrigerationInputRackNum ).CondenserType == RefrigCondenserTypeEvap && Numbers( 9 ) < 0.0 ) {
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\", " + cNumericFieldNames( 9 ) + " must be >= 0" );
+					GetRefrigerationInputErrorsFound = true;
 				}
 
-				RefrigRack( RackNum ).BasinHeaterSetPointTemp = Numbers( 10 );
-				if ( RefrigRack( RackNum ).CondenserType == RefrigCondenserTypeEvap && RefrigRack( RackNum ).BasinHeaterSetPointTemp < 2.0 ) {
-					ShowWarningError( CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\", " + cNumericFieldNames( 10 ) + " is less than 2 deg C. Freezing could occur." );
+				RefrigRack( GetRefrigerationInputRackNum ).BasinHeaterSetPointTemp = Numbers( 10 );
+				if ( RefrigRack( GetRefrigerationInputRackNum ).CondenserType == RefrigCondenserTypeEvap && RefrigRack( GetRefrigerationInputRackNum ).BasinHeaterSetPointTemp < 2.0 ) {
+					ShowWarningError( CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\", " + cNumericFieldNames( 10 ) + " is less than 2 deg C. Freezing could occur." );
 				}
 
-				RefrigRack( RackNum ).EvapPumpPower = Numbers( 11 );
-				if ( RefrigRack( RackNum ).CondenserType == RefrigCondenserTypeEvap && RefrigRack( RackNum ).EvapPumpPower < 0.0 && RefrigRack( RackNum ).EvapPumpPower != AutoCalculate ) {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\", " + cNumericFieldNames( 11 ) + " cannot be less than zero." );
-					ErrorsFound = true;
+				RefrigRack( GetRefrigerationInputRackNum ).EvapPumpPower = Numbers( 11 );
+				if ( RefrigRack( GetRefrigerationInputRackNum ).CondenserType == RefrigCondenserTypeEvap && RefrigRack( GetRefrigerationInputRackNum ).EvapPumpPower < 0.0 && RefrigRack( GetRefrigerationInputRackNum ).EvapPumpPower != AutoCalculate ) {
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\", " + cNumericFieldNames( 11 ) + " cannot be less than zero." );
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				// Get Water System tank connections
-				RefrigRack( RackNum ).SupplyTankName = Alphas( 11 );
+				RefrigRack( GetRefrigerationInputRackNum ).SupplyTankName = Alphas( 11 );
 				if ( lAlphaBlanks( 11 ) ) {
-					RefrigRack( RackNum ).EvapWaterSupplyMode = WaterSupplyFromMains;
+					RefrigRack( GetRefrigerationInputRackNum ).EvapWaterSupplyMode = WaterSupplyFromMains;
 				} else {
-					RefrigRack( RackNum ).EvapWaterSupplyMode = WaterSupplyFromTank;
-					SetupTankDemandComponent( RefrigRack( RackNum ).Name, CurrentModuleObject, RefrigRack( RackNum ).SupplyTankName, ErrorsFound, RefrigRack( RackNum ).EvapWaterSupTankID, RefrigRack( RackNum ).EvapWaterTankDemandARRID );
+					RefrigRack( GetRefrigerationInputRackNum ).EvapWaterSupplyMode = WaterSupplyFromTank;
+					SetupTankDemandComponent( RefrigRack( GetRefrigerationInputRackNum ).Name, CurrentModuleObject, RefrigRack( GetRefrigerationInputRackNum ).SupplyTankName, GetRefrigerationInputErrorsFound, RefrigRack( GetRefrigerationInputRackNum ).EvapWaterSupTankID, RefrigRack( GetRefrigerationInputRackNum ).EvapWaterTankDemandARRID );
 				}
 
 				// Check condenser air inlet node connection
 				if ( lAlphaBlanks( 12 ) ) {
-					RefrigRack( RackNum ).OutsideAirNodeNum = 0;
+					RefrigRack( GetRefrigerationInputRackNum ).OutsideAirNodeNum = 0;
 				} else {
-					RefrigRack( RackNum ).OutsideAirNodeNum = GetOnlySingleNode( Alphas( 12 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsParent );
-					if ( ! CheckOutAirNodeNumber( RefrigRack( RackNum ).OutsideAirNodeNum ) ) {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\", " + cAlphaFieldNames( 12 ) + " not found: " + Alphas( 12 ) );
+					RefrigRack( GetRefrigerationInputRackNum ).OutsideAirNodeNum = GetOnlySingleNode( Alphas( 12 ), GetRefrigerationInputErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsParent );
+					if ( ! CheckOutAirNodeNumber( RefrigRack( GetRefrigerationInputRackNum ).OutsideAirNodeNum ) ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\", " + cAlphaFieldNames( 12 ) + " not found: " + Alphas( 12 ) );
 						ShowContinueError( "...does not appear in an OutdoorAir:NodeList or as an OutdoorAir:Node." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 
-				if ( ! lAlphaBlanks( 13 ) ) RefrigRack( RackNum ).EndUseSubcategory = Alphas( 13 );
+				if ( ! lAlphaBlanks( 13 ) ) RefrigRack( GetRefrigerationInputRackNum ).EndUseSubcategory = Alphas( 13 );
 
 				//Read all loads on this rack: cases and walk-ins and coils
 				NumCases = 0;
 				NumCoils = 0;
 				NumWalkIns = 0;
-				RefrigRack( RackNum ).NumCases = 0;
-				RefrigRack( RackNum ).NumCoils = 0;
-				RefrigRack( RackNum ).NumWalkIns = 0;
-				RefrigRack( RackNum ).TotalRackLoad = 0.0;
+				RefrigRack( GetRefrigerationInputRackNum ).NumCases = 0;
+				RefrigRack( GetRefrigerationInputRackNum ).NumCoils = 0;
+				RefrigRack( GetRefrigerationInputRackNum ).NumWalkIns = 0;
+				RefrigRack( GetRefrigerationInputRackNum ).TotalRackLoad = 0.0;
 
 				//   Read display case and walkin assignments for this rack
 				AlphaNum = 14;
 				if ( lAlphaBlanks( AlphaNum ) ) {
 					//No cases or walkins or coils specified, ie, rack has no load
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\" : has no loads, must have at least one of: " + cAlphaFieldNames( 14 ) );
-					ErrorsFound = true;
+					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\" : has no loads, must have at least one of: " + cAlphaFieldNames( 14 ) );
+					GetRefrigerationInputErrorsFound = true;
 				} else { // (.NOT. lAlphaBlanks(AlphaNum))
 					// Entry for Alphas(AlphaNum) can be either a Case, WalkIn, Coil, or CaseAndWalkInList name
 					CaseAndWalkInListNum = 0;
@@ -2870,99 +3726,99 @@ namespace RefrigeratedCase {
 					if ( CoilNum != 0 ) ++NumNameMatches;
 
 					if ( NumNameMatches != 1 ) { //name must uniquely point to a list or a single case or walkin
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 						if ( NumNameMatches == 0 ) {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\" : has an invalid " + cAlphaFieldNames( AlphaNum ) + ": " + Alphas( AlphaNum ) );
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\" : has an invalid " + cAlphaFieldNames( AlphaNum ) + ": " + Alphas( AlphaNum ) );
 						} else if ( NumNameMatches > 1 ) {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\" : has a non-unique name that could be either a " + cAlphaFieldNames( AlphaNum ) + ": " + Alphas( AlphaNum ) );
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\" : has a non-unique name that could be either a " + cAlphaFieldNames( AlphaNum ) + ": " + Alphas( AlphaNum ) );
 						} //num matches = 0 or > 1
 					} else if ( CaseAndWalkInListNum != 0 ) { //Name points to a CaseAndWalkInList
 						NumCoils = CaseAndWalkInList( CaseAndWalkInListNum ).NumCoils;
 						NumCases = CaseAndWalkInList( CaseAndWalkInListNum ).NumCases;
 						NumWalkIns = CaseAndWalkInList( CaseAndWalkInListNum ).NumWalkIns;
-						RefrigRack( RackNum ).NumCoils = NumCoils;
-						RefrigRack( RackNum ).NumCases = NumCases;
-						RefrigRack( RackNum ).NumWalkIns = NumWalkIns;
-						if ( ! allocated( RefrigRack( RackNum ).CoilNum ) ) RefrigRack( RackNum ).CoilNum.allocate( NumCoils );
-						RefrigRack( RackNum ).CoilNum( {1,NumCoils} ) = CaseAndWalkInList( CaseAndWalkInListNum ).CoilItemNum( {1,NumCoils} );
-						if ( ! allocated( RefrigRack( RackNum ).CaseNum ) ) RefrigRack( RackNum ).CaseNum.allocate( NumCases );
-						RefrigRack( RackNum ).CaseNum( {1,NumCases} ) = CaseAndWalkInList( CaseAndWalkInListNum ).CaseItemNum( {1,NumCases} );
-						if ( ! allocated( RefrigRack( RackNum ).WalkInNum ) ) RefrigRack( RackNum ).WalkInNum.allocate( NumWalkIns );
-						RefrigRack( RackNum ).WalkInNum( {1,NumWalkIns} ) = CaseAndWalkInList( CaseAndWalkInListNum ).WalkInItemNum( {1,NumWalkIns} );
+						RefrigRack( GetRefrigerationInputRackNum ).NumCoils = NumCoils;
+						RefrigRack( GetRefrigerationInputRackNum ).NumCases = NumCases;
+						RefrigRack( GetRefrigerationInputRackNum ).NumWalkIns = NumWalkIns;
+						if ( ! allocated( RefrigRack( GetRefrigerationInputRackNum ).CoilNum ) ) RefrigRack( GetRefrigerationInputRackNum ).CoilNum.allocate( NumCoils );
+						RefrigRack( GetRefrigerationInputRackNum ).CoilNum( {1,NumCoils} ) = CaseAndWalkInList( CaseAndWalkInListNum ).CoilItemNum( {1,NumCoils} );
+						if ( ! allocated( RefrigRack( GetRefrigerationInputRackNum ).CaseNum ) ) RefrigRack( GetRefrigerationInputRackNum ).CaseNum.allocate( NumCases );
+						RefrigRack( GetRefrigerationInputRackNum ).CaseNum( {1,NumCases} ) = CaseAndWalkInList( CaseAndWalkInListNum ).CaseItemNum( {1,NumCases} );
+						if ( ! allocated( RefrigRack( GetRefrigerationInputRackNum ).WalkInNum ) ) RefrigRack( GetRefrigerationInputRackNum ).WalkInNum.allocate( NumWalkIns );
+						RefrigRack( GetRefrigerationInputRackNum ).WalkInNum( {1,NumWalkIns} ) = CaseAndWalkInList( CaseAndWalkInListNum ).WalkInItemNum( {1,NumWalkIns} );
 					} else if ( CoilNum != 0 ) { //Name points to a coil
 						NumCoils = 1;
-						RefrigRack( RackNum ).NumCoils = 1;
-						if ( ! allocated( RefrigRack( RackNum ).CoilNum ) ) RefrigRack( RackNum ).CoilNum.allocate( NumCoils );
-						RefrigRack( RackNum ).CoilNum( NumCoils ) = CoilNum;
+						RefrigRack( GetRefrigerationInputRackNum ).NumCoils = 1;
+						if ( ! allocated( RefrigRack( GetRefrigerationInputRackNum ).CoilNum ) ) RefrigRack( GetRefrigerationInputRackNum ).CoilNum.allocate( NumCoils );
+						RefrigRack( GetRefrigerationInputRackNum ).CoilNum( NumCoils ) = CoilNum;
 					} else if ( CaseNum != 0 ) { //Name points to a case
 						NumCases = 1;
-						RefrigRack( RackNum ).NumCases = 1;
-						if ( ! allocated( RefrigRack( RackNum ).CaseNum ) ) RefrigRack( RackNum ).CaseNum.allocate( NumCases );
-						RefrigRack( RackNum ).CaseNum( NumCases ) = CaseNum;
+						RefrigRack( GetRefrigerationInputRackNum ).NumCases = 1;
+						if ( ! allocated( RefrigRack( GetRefrigerationInputRackNum ).CaseNum ) ) RefrigRack( GetRefrigerationInputRackNum ).CaseNum.allocate( NumCases );
+						RefrigRack( GetRefrigerationInputRackNum ).CaseNum( NumCases ) = CaseNum;
 					} else if ( WalkInNum != 0 ) { //Name points to a walkin
 						NumWalkIns = 1;
-						RefrigRack( RackNum ).NumWalkIns = 1;
-						if ( ! allocated( RefrigRack( RackNum ).WalkInNum ) ) RefrigRack( RackNum ).WalkInNum.allocate( NumWalkIns );
-						RefrigRack( RackNum ).WalkInNum( NumWalkIns ) = WalkInNum;
+						RefrigRack( GetRefrigerationInputRackNum ).NumWalkIns = 1;
+						if ( ! allocated( RefrigRack( GetRefrigerationInputRackNum ).WalkInNum ) ) RefrigRack( GetRefrigerationInputRackNum ).WalkInNum.allocate( NumWalkIns );
+						RefrigRack( GetRefrigerationInputRackNum ).WalkInNum( NumWalkIns ) = WalkInNum;
 					} //NumNameMatches /= 1
 				} //blank input for loads on rack
 
 				if ( NumCases > 0 ) {
 					for ( CaseIndex = 1; CaseIndex <= NumCases; ++CaseIndex ) {
-						CaseID = RefrigRack( RackNum ).CaseNum( CaseIndex );
+						GetRefrigerationInputCaseID = RefrigRack( GetRefrigerationInputRackNum ).CaseNum( CaseIndex );
 						//mark all cases on rack as used by this system (checking for unused or non-unique cases)
-						++RefrigCase( CaseID ).NumSysAttach;
+						++RefrigCase( GetRefrigerationInputCaseID ).NumSysAttach;
 						//determine total capacity on rack
-						RefrigRack( RackNum ).TotalRackLoad += RefrigCase( CaseID ).DesignRatedCap;
+						RefrigRack( GetRefrigerationInputRackNum ).TotalRackLoad += RefrigCase( GetRefrigerationInputCaseID ).DesignRatedCap;
 					} //CaseIndex=1,NumCases
 					//     check that all refrigerated cases attached to a rack are to the same zone if heat rejection location is "Zone"
 					//     however, won't matter if walk-in specified
-					if ( RefrigRack( RackNum ).HeatRejectionLocation == LocationZone && RefrigRack( RackNum ).NumCases > 1 && RefrigCase( RefrigRack( RackNum ).CaseNum( 1 ) ).ActualZoneNum != 0 && NumWalkIns < 1 && NumCoils < 1 ) {
-						ZoneNum = RefrigCase( RefrigRack( RackNum ).CaseNum( 1 ) ).ActualZoneNum;
-						for ( CaseIndex = 2; CaseIndex <= RefrigRack( RackNum ).NumCases; ++CaseIndex ) {
-							if ( RefrigCase( RefrigRack( RackNum ).CaseNum( CaseIndex ) ).ActualZoneNum == ZoneNum ) continue;
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\" : All cases attached to a rack must be in the same zone when " + cAlphaFieldNames( 2 ) + " equals \"Zone\"." );
-							ErrorsFound = true;
+					if ( RefrigRack( GetRefrigerationInputRackNum ).HeatRejectionLocation == LocationZone && RefrigRack( GetRefrigerationInputRackNum ).NumCases > 1 && RefrigCase( RefrigRack( GetRefrigerationInputRackNum ).CaseNum( 1 ) ).ActualZoneNum != 0 && NumWalkIns < 1 && NumCoils < 1 ) {
+						GetRefrigerationInputZoneNum = RefrigCase( RefrigRack( GetRefrigerationInputRackNum ).CaseNum( 1 ) ).ActualZoneNum;
+						for ( CaseIndex = 2; CaseIndex <= RefrigRack( GetRefrigerationInputRackNum ).NumCases; ++CaseIndex ) {
+							if ( RefrigCase( RefrigRack( GetRefrigerationInputRackNum ).CaseNum( CaseIndex ) ).ActualZoneNum == GetRefrigerationInputZoneNum ) continue;
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\" : All cases attached to a rack must be in the same zone when " + cAlphaFieldNames( 2 ) + " equals \"Zone\"." );
+							GetRefrigerationInputErrorsFound = true;
 							break;
 						}
 					} // heat rejection location is zone
 				} // numcases > 0
 
 				if ( NumCoils > 0 ) {
-					RefrigRack( RackNum ).CoilFlag = true;
+					RefrigRack( GetRefrigerationInputRackNum ).CoilFlag = true;
 					for ( CoilIndex = 1; CoilIndex <= NumCoils; ++CoilIndex ) {
-						CoilNum = RefrigRack( RackNum ).CoilNum( CoilIndex );
+						CoilNum = RefrigRack( GetRefrigerationInputRackNum ).CoilNum( CoilIndex );
 						//mark all Coils on rack as used by this system (checking for unused or non-unique Coils)
 						++WarehouseCoil( CoilNum ).NumSysAttach;
 						//determine total capacity on rack
-						RefrigRack( RackNum ).TotalRackLoad += WarehouseCoil( CoilNum ).RatedSensibleCap;
+						RefrigRack( GetRefrigerationInputRackNum ).TotalRackLoad += WarehouseCoil( CoilNum ).RatedSensibleCap;
 					} //CoilIndex=1,NumCoils
 				} //numcoils > 0
 
 				if ( NumWalkIns > 0 ) {
 					for ( WalkInIndex = 1; WalkInIndex <= NumWalkIns; ++WalkInIndex ) {
-						WalkInID = RefrigRack( RackNum ).WalkInNum( WalkInIndex );
+						GetRefrigerationInputWalkInID = RefrigRack( GetRefrigerationInputRackNum ).WalkInNum( WalkInIndex );
 						//mark all WalkIns on rack as used by this system (checking for unused or non-unique WalkIns)
-						++WalkIn( WalkInID ).NumSysAttach;
+						++WalkIn( GetRefrigerationInputWalkInID ).NumSysAttach;
 						//determine total capacity on rack
-						RefrigRack( RackNum ).TotalRackLoad += WalkIn( WalkInID ).DesignRatedCap;
+						RefrigRack( GetRefrigerationInputRackNum ).TotalRackLoad += WalkIn( GetRefrigerationInputWalkInID ).DesignRatedCap;
 					} //WalkInIndex=1,NumWalkIns
 				} //NumWalkins
 
 				if ( NumWalkIns > 0 || NumCoils > 0 ) {
 					//Get the heat rejection Zone node number from the zone name entered by the user (if heatrej location = zone)
-					if ( RefrigRack( RackNum ).HeatRejectionLocation == LocationZone ) {
+					if ( RefrigRack( GetRefrigerationInputRackNum ).HeatRejectionLocation == LocationZone ) {
 						if ( lAlphaBlanks( 15 ) ) {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + cAlphaFieldNames( 15 ) + " must be input if walkins or AirChillers connected to rack and heat rejection location = zone." );
-							ErrorsFound = true;
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + cAlphaFieldNames( 15 ) + " must be input if walkins or AirChillers connected to rack and heat rejection location = zone." );
+							GetRefrigerationInputErrorsFound = true;
 						} else { // alpha (15) not blank
-							RefrigRack( RackNum ).HeatRejectionZoneNum = FindItemInList( Alphas( 15 ), Zone );
-							RefrigRack( RackNum ).HeatRejectionZoneNodeNum = GetSystemNodeNumberForZone( Alphas( 15 ) );
-							if ( RefrigRack( RackNum ).HeatRejectionZoneNum == 0 ) {
-								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( RackNum ).Name + "\", invalid  " + cAlphaFieldNames( 15 ) + " not valid: " + Alphas( 15 ) );
-								ErrorsFound = true;
+							RefrigRack( GetRefrigerationInputRackNum ).HeatRejectionZoneNum = FindItemInList( Alphas( 15 ), Zone );
+							RefrigRack( GetRefrigerationInputRackNum ).HeatRejectionZoneNodeNum = GetSystemNodeNumberForZone( Alphas( 15 ) );
+							if ( RefrigRack( GetRefrigerationInputRackNum ).HeatRejectionZoneNum == 0 ) {
+								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + RefrigRack( GetRefrigerationInputRackNum ).Name + "\", invalid  " + cAlphaFieldNames( 15 ) + " not valid: " + Alphas( 15 ) );
+								GetRefrigerationInputErrorsFound = true;
 							} else {
-								RefrigPresentInZone( RefrigRack( RackNum ).HeatRejectionZoneNum ) = true;
+								RefrigPresentInZone( RefrigRack( GetRefrigerationInputRackNum ).HeatRejectionZoneNum ) = true;
 							} //zonenum == 0
 						} // alpha 15 blank
 					} // zone heat rej and walk-ins or coils present, must input heat rejection zone
@@ -2970,12 +3826,12 @@ namespace RefrigeratedCase {
 
 				// set condenser air flow and evap water pump power if autocalculated
 				// autocalculate condenser evap water pump if needed
-				if ( RefrigRack( RackNum ).CondenserType == RefrigCondenserTypeEvap && RefrigRack( RackNum ).EvapPumpPower == AutoCalculate ) {
-					RefrigRack( RackNum ).EvapPumpPower = CondPumpRatePower * RefrigRack( RackNum ).TotalRackLoad;
+				if ( RefrigRack( GetRefrigerationInputRackNum ).CondenserType == RefrigCondenserTypeEvap && RefrigRack( GetRefrigerationInputRackNum ).EvapPumpPower == AutoCalculate ) {
+					RefrigRack( GetRefrigerationInputRackNum ).EvapPumpPower = CondPumpRatePower * RefrigRack( GetRefrigerationInputRackNum ).TotalRackLoad;
 				}
 				// autocalculate evap condenser air volume flow rate if needed
-				if ( RefrigRack( RackNum ).CondenserType == RefrigCondenserTypeEvap && RefrigRack( RackNum ).CondenserAirFlowRate == AutoCalculate ) {
-					RefrigRack( RackNum ).CondenserAirFlowRate = AirVolRateEvapCond * RefrigRack( RackNum ).TotalRackLoad;
+				if ( RefrigRack( GetRefrigerationInputRackNum ).CondenserType == RefrigCondenserTypeEvap && RefrigRack( GetRefrigerationInputRackNum ).CondenserAirFlowRate == AutoCalculate ) {
+					RefrigRack( GetRefrigerationInputRackNum ).CondenserAirFlowRate = AirVolRateEvapCond * RefrigRack( GetRefrigerationInputRackNum ).TotalRackLoad;
 				}
 
 			} //RackNum=1,NumRefrigeratedRacks
@@ -2988,15 +3844,15 @@ namespace RefrigeratedCase {
 			if ( NumRefrigSystems > 0 && NumRefrigCondensers == 0 ) {
 				ShowSevereError( "Refrigeration:System objects were found during input processing, however no Rrefrigeration condenser objects (which may be either: " );
 				ShowContinueError( " Refrigeration:Condenser:AirCooled, Refrigeration:Condenser:WaterCooled, Refrigeration:Condenser:EvaporativeCooled,or Refrigeration:Condenser:CascadeCooled) were found." );
-				ErrorsFound = true;
+				GetRefrigerationInputErrorsFound = true;
 			}
 			if ( NumTransRefrigSystems > 0 && NumSimulationGasCooler == 0 ) {
 				ShowSevereError( "Refrigeration:TranscriticalSystem objects were found during input processing, however no Refrigeration gas cooler objects (Refrigeration:GasCooler:AirCooled) were found." );
-				ErrorsFound = true;
+				GetRefrigerationInputErrorsFound = true;
 			}
 			if ( NumSimulationCompressors == 0 ) {
 				ShowSevereError( "Refrigeration:System objects were found during input processing, however no Refrigeration:Compressor objects were found." );
-				ErrorsFound = true;
+				GetRefrigerationInputErrorsFound = true;
 			}
 
 			//************ START CONDENSER INPUT  **************
@@ -3011,14 +3867,14 @@ namespace RefrigeratedCase {
 					if ( IsNotOK ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + ", has an invalid or undefined " + cAlphaFieldNames( 1 ) + " = " + Alphas( 1 ) );
 						if ( IsBlank ) Alphas( 1 ) = "xxxxx";
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} //IsNotOK on Verify Name
 					Condenser( CondNum ).Name = Alphas( 1 );
 					HeatReclaimRefrigCondenser( CondNum ).Name = Alphas( 1 );
 					Condenser( CondNum ).CapCurvePtr = GetCurveIndex( Alphas( 2 ) ); // convert curve name to number
 					if ( Condenser( CondNum ).CapCurvePtr == 0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\", invalid  " + cAlphaFieldNames( 2 ) + " not found:" + Alphas( 2 ) );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 
 					//set start of count for number of systems attached to this condenser
@@ -3043,7 +3899,7 @@ namespace RefrigeratedCase {
 						Condenser( CondNum ).MinCondLoad = Capmax - DelTempMax / Condenser( CondNum ).TempSlope;
 					} else {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\" Condenser capacity curve per ARI 460 must be input and must be greater than 0 Watts at 16.7C temperature difference." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 
 					Condenser( CondNum ).RatedSubcool = 0.0; //default value
@@ -3065,7 +3921,7 @@ namespace RefrigeratedCase {
 					if ( ! lNumericBlanks( 2 ) ) Condenser( CondNum ).RatedFanPower = Numbers( 2 );
 					if ( ( lNumericBlanks( 2 ) ) || ( Numbers( 2 ) < 0.0 ) ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\" " + cNumericFieldNames( 2 ) + " must be input greater than or equal to 0 Watts." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 
 					Condenser( CondNum ).FanMinAirFlowRatio = 0.2; //default value
@@ -3086,12 +3942,12 @@ namespace RefrigeratedCase {
 							Condenser( CondNum ).CondenserRejectHeatToZone = true;
 							RefrigPresentInZone( Condenser( CondNum ).InletAirZoneNum ) = true;
 						} else { // not in a conditioned zone, so see if it's outside
-							Condenser( CondNum ).InletAirNodeNum = GetOnlySingleNode( Alphas( 4 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsParent );
+							Condenser( CondNum ).InletAirNodeNum = GetOnlySingleNode( Alphas( 4 ), GetRefrigerationInputErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsParent );
 							if ( ! CheckOutAirNodeNumber( Condenser( CondNum ).InletAirNodeNum ) ) {
 								// not outside and not a zone
 								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\", " + cAlphaFieldNames( 4 ) + " not found: " + Alphas( 4 ) );
 								ShowContinueError( "...does not appear in an OutdoorAir:NodeList or as an OutdoorAir:Node or as a Zone." );
-								ErrorsFound = true;
+								GetRefrigerationInputErrorsFound = true;
 							} //checkoutairnodenumber
 						} //InletAirZoneNum \=0
 					} // Condenser air inlet node connection
@@ -3121,7 +3977,7 @@ namespace RefrigeratedCase {
 					if ( IsNotOK ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + ", has an invalid or undefined " + cAlphaFieldNames( 1 ) + "=\"" + Alphas( 1 ) + "\"." );
 						if ( IsBlank ) Alphas( 1 ) = "xxxxx";
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} //IsNotOK on Verify Name
 					Condenser( CondNum ).Name = Alphas( 1 );
 					HeatReclaimRefrigCondenser( CondNum ).Name = Alphas( 1 );
@@ -3140,7 +3996,7 @@ namespace RefrigeratedCase {
 						Condenser( CondNum ).RatedCapacity = Numbers( 1 );
 					} else {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\" " + cNumericFieldNames( 1 ) + " per ARI 490 must be input and must be greater than 0 Watts." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 					//Calculate capacity elevation derate factor per ARI 490 barometric pressure correction factor
 					Condenser( CondNum ).EvapElevFact = 1.0 - 3.074e-5 * Elevation;
@@ -3164,7 +4020,7 @@ namespace RefrigeratedCase {
 					Condenser( CondNum ).RatedFanPower = Numbers( 3 );
 					if ( Numbers( 3 ) < 0.0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\" " + cNumericFieldNames( 3 ) + " must be greater than or equal to 0 Watts." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 
 					Condenser( CondNum ).FanMinAirFlowRatio = 0.2; //default value
@@ -3232,11 +4088,11 @@ namespace RefrigeratedCase {
 					if ( lAlphaBlanks( 3 ) ) {
 						Condenser( CondNum ).InletAirNodeNum = 0;
 					} else {
-						Condenser( CondNum ).InletAirNodeNum = GetOnlySingleNode( Alphas( 3 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsParent );
+						Condenser( CondNum ).InletAirNodeNum = GetOnlySingleNode( Alphas( 3 ), GetRefrigerationInputErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsParent );
 						if ( ! CheckOutAirNodeNumber( Condenser( CondNum ).InletAirNodeNum ) ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\", " + cAlphaFieldNames( 3 ) + " not found: " + Alphas( 3 ) );
 							ShowContinueError( "...does not appear in an OutdoorAir:NodeList or as an OutdoorAir:Node." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						}
 					} // Condenser air inlet node connection
 
@@ -3250,7 +4106,7 @@ namespace RefrigeratedCase {
 					Condenser( CondNum ).BasinHeaterPowerFTempDiff = Numbers( NumNum );
 					if ( Numbers( NumNum ) < 0.0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\", " + cNumericFieldNames( NumNum ) + " must be >= 0" );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 
 					NumNum = 13;
@@ -3272,7 +4128,7 @@ namespace RefrigeratedCase {
 						Condenser( CondNum ).EvapWaterSupplyMode = WaterSupplyFromMains;
 					} else {
 						Condenser( CondNum ).EvapWaterSupplyMode = WaterSupplyFromTank;
-						SetupTankDemandComponent( Condenser( CondNum ).Name, CurrentModuleObject, Condenser( CondNum ).SupplyTankName, ErrorsFound, Condenser( CondNum ).EvapWaterSupTankID, Condenser( CondNum ).EvapWaterTankDemandARRID );
+						SetupTankDemandComponent( Condenser( CondNum ).Name, CurrentModuleObject, Condenser( CondNum ).SupplyTankName, GetRefrigerationInputErrorsFound, Condenser( CondNum ).EvapWaterSupTankID, Condenser( CondNum ).EvapWaterTankDemandARRID );
 					}
 
 					if ( lAlphaBlanks( 5 ) ) {
@@ -3285,12 +4141,12 @@ namespace RefrigeratedCase {
 								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\" ." );
 								ShowContinueError( "Error found in " + cAlphaFieldNames( 5 ) + " = " + Alphas( 5 ) );
 								ShowContinueError( "schedule values must be (>=0.)." );
-								ErrorsFound = true;
+								GetRefrigerationInputErrorsFound = true;
 							}
 						} else {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\", invalid  " + cAlphaFieldNames( 5 ) + " = " + Alphas( 5 ) );
 							ShowContinueError( "A schedule with this name is not defined in this input data file." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						}
 					} // Set Evap Schedule Pointer
 
@@ -3321,7 +4177,7 @@ namespace RefrigeratedCase {
 					if ( IsNotOK ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + ", has an invalid or undefined " + cAlphaFieldNames( 1 ) + "=\"" + Alphas( 1 ) + "\"." );
 						if ( IsBlank ) Alphas( 1 ) = "xxxxx";
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} //IsNotOK on Verify Name
 					Condenser( CondNum ).Name = Alphas( 1 );
 					HeatReclaimRefrigCondenser( CondNum ).Name = Alphas( 1 );
@@ -3337,14 +4193,14 @@ namespace RefrigeratedCase {
 						Condenser( CondNum ).RatedCapacity = Numbers( 1 );
 					} else {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\" " + cNumericFieldNames( 1 ) + " per ARI 450 must be input and must be greater than 0 Watts." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 
 					if ( ( ! lNumericBlanks( 2 ) ) && ( Numbers( 2 ) > 0.0 ) ) {
 						Condenser( CondNum ).RatedTCondense = Numbers( 2 );
 					} else {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\" " + cNumericFieldNames( 2 ) + " per ARI 450 must be input and must be greater than 0 C." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 
 					if ( ! lNumericBlanks( 3 ) ) {
@@ -3352,7 +4208,7 @@ namespace RefrigeratedCase {
 							Condenser( CondNum ).RatedSubcool = Numbers( 3 );
 						} else {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\" " + cNumericFieldNames( 3 ) + " must be greater than or equal to zero." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						}
 					} else {
 						Condenser( CondNum ).RatedSubcool = 0.0; //default value
@@ -3363,11 +4219,11 @@ namespace RefrigeratedCase {
 						Condenser( CondNum ).RatedApproachT = Condenser( CondNum ).RatedTCondense - Numbers( 4 );
 					} else {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\" " + cNumericFieldNames( 4 ) + " must be input and greater than zero." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 
-					Condenser( CondNum ).InletNode = GetOnlySingleNode( Alphas( 2 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Water, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-					Condenser( CondNum ).OutletNode = GetOnlySingleNode( Alphas( 3 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Water, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+					Condenser( CondNum ).InletNode = GetOnlySingleNode( Alphas( 2 ), GetRefrigerationInputErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Water, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+					Condenser( CondNum ).OutletNode = GetOnlySingleNode( Alphas( 3 ), GetRefrigerationInputErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Water, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 					// Check node connections
 					TestCompSet( CurrentModuleObject, Alphas( 1 ), Alphas( 2 ), Alphas( 3 ), "Water Cooled Condenser Nodes" );
 					// Get loop flow type
@@ -3378,7 +4234,7 @@ namespace RefrigeratedCase {
 					} else {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\", invalid  " + cAlphaFieldNames( 4 ) + " not recognized: " + Alphas( 4 ) );
 						ShowContinueError( "Check input value choices." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} //Set FlowType
 
 					// Get outlet temperature schedule for variable flow case
@@ -3391,7 +4247,7 @@ namespace RefrigeratedCase {
 						if ( Condenser( CondNum ).OutletTempSchedPtr == 0 ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\", invalid  " + cAlphaFieldNames( 5 ) + " = " + Alphas( 5 ) );
 							ShowContinueError( "A schedule with this name is not defined in this input data file." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						}
 					} // Outlet temperature schedule
 
@@ -3404,7 +4260,7 @@ namespace RefrigeratedCase {
 						else {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\" " + cNumericFieldNames( 5 ) + " must be greater than zero." );
 							ShowContinueError( "Revise flow rates." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						}
 						RegisterPlantCompDesignFlow( Condenser( CondNum ).InletNode, Condenser( CondNum ).DesVolFlowRate );
 					}
@@ -3417,11 +4273,11 @@ namespace RefrigeratedCase {
 						if ( Condenser( CondNum ).FlowType == ConstantFlow && Condenser( CondNum ).VolFlowRate > Numbers( 6 ) ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\" " + cNumericFieldNames( 5 ) + " > " + cNumericFieldNames( 6 ) + " ." );
 							ShowContinueError( "Revise flow rates." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						} //Error check on max flow rate
 					} else {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\" " + cNumericFieldNames( 6 ) + " must be greater than zero." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 
 					// Get max/min allowed water temps
@@ -3456,7 +4312,7 @@ namespace RefrigeratedCase {
 					if ( IsNotOK ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + ", has an invalid or undefined " + cAlphaFieldNames( 1 ) + "=\"" + Alphas( 1 ) + "\"." );
 						if ( IsBlank ) Alphas( 1 ) = "xxxxx";
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} //IsNotOK on Verify Name
 					Condenser( CondNum ).Name = Alphas( 1 );
 					HeatReclaimRefrigCondenser( CondNum ).Name = Alphas( 1 );
@@ -3472,7 +4328,7 @@ namespace RefrigeratedCase {
 						Condenser( CondNum ).RatedTCondense = Numbers( 1 );
 					} else {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\" " + cNumericFieldNames( 1 ) + " must be input." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 
 					if ( ! lNumericBlanks( 2 ) ) {
@@ -3480,7 +4336,7 @@ namespace RefrigeratedCase {
 							Condenser( CondNum ).RatedApproachT = Numbers( 2 );
 						} else {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\" " + cNumericFieldNames( 2 ) + " must be greater than or equal to zero." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						}
 					} else {
 						Condenser( CondNum ).RatedApproachT = DefaultCascadeCondApproach;
@@ -3490,7 +4346,7 @@ namespace RefrigeratedCase {
 						Condenser( CondNum ).RatedCapacity = Numbers( 3 );
 					} else {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\" " + cNumericFieldNames( 3 ) + " must be in put and must be greater than or equal to zero." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 
 					// Get condensing temperature type, either fixed by design or allowed to float to match other loads on supply system
@@ -3502,7 +4358,7 @@ namespace RefrigeratedCase {
 						} else {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\", invalid  " + cAlphaFieldNames( 2 ) + " not recognized: " + Alphas( 2 ) );
 							ShowContinueError( "Check input value choices." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						} //string comparison to key choices
 					} else { // default is fixed/cascadetempset
 						Condenser( CondNum ).CascadeTempControl = CascadeTempSet;
@@ -3535,14 +4391,14 @@ namespace RefrigeratedCase {
 					if ( IsNotOK ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + ", has an invalid or undefined " + cAlphaFieldNames( 1 ) + " = " + Alphas( 1 ) );
 						if ( IsBlank ) Alphas( 1 ) = "xxxxx";
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} //IsNotOK on Verify Name
 					GasCooler( GCNum ).Name = Alphas( 1 );
 
 					GasCooler( GCNum ).CapCurvePtr = GetCurveIndex( Alphas( 2 ) ); // convert curve name to number
 					if ( GasCooler( GCNum ).CapCurvePtr == 0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + GasCooler( GCNum ).Name + "\", invalid " + cAlphaFieldNames( 2 ) + " not found:" + Alphas( 2 ) );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 
 					//set start of count for number of systems attached to this gas cooler
@@ -3563,7 +4419,7 @@ namespace RefrigeratedCase {
 						GasCooler( GCNum ).MinCondLoad = Capmax - DelTempMax / GasCooler( GCNum ).TempSlope;
 					} else {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + GasCooler( GCNum ).Name + "\" Gas Cooler capacity curve must be input and must be greater than 0 Watts at 3C temperature difference." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 
 					// Get fan control type
@@ -3584,7 +4440,7 @@ namespace RefrigeratedCase {
 					if ( ! lNumericBlanks( 1 ) ) GasCooler( GCNum ).RatedFanPower = Numbers( 1 );
 					if ( Numbers( 1 ) < 0.0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + GasCooler( GCNum ).Name + "\" " + cNumericFieldNames( 1 ) + " must be input greater than or equal to 0 Watts." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 
 					// Gas cooler minimum fan air flow ratio
@@ -3611,7 +4467,7 @@ namespace RefrigeratedCase {
 					if ( ! lNumericBlanks( 4 ) ) GasCooler( GCNum ).GasCoolerApproachT = Numbers( 4 );
 					if ( GasCooler( GCNum ).GasCoolerApproachT < 0.0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + GasCooler( GCNum ).Name + "\" " + cNumericFieldNames( 4 ) + " must be greater than 0C." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 
 					// Gas cooler temperature difference for subcritical operation
@@ -3619,7 +4475,7 @@ namespace RefrigeratedCase {
 					if ( ! lNumericBlanks( 5 ) ) GasCooler( GCNum ).SubcriticalTempDiff = Numbers( 5 );
 					if ( GasCooler( GCNum ).SubcriticalTempDiff < 0.0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + GasCooler( GCNum ).Name + "\" " + cNumericFieldNames( 5 ) + " must be greater than 0C." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 
 					// Gas cooler minimum condensing temperature for subcritical operation
@@ -3627,7 +4483,7 @@ namespace RefrigeratedCase {
 					if ( ! lNumericBlanks( 6 ) ) GasCooler( GCNum ).MinCondTemp = Numbers( 6 );
 					if ( GasCooler( GCNum ).MinCondTemp > 30.9 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + GasCooler( GCNum ).Name + "\" " + cNumericFieldNames( 6 ) + " must be less than the critical temperature of carbon dioxide (31C)." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 
 					// Check GasCooler air inlet node connection
@@ -3644,12 +4500,12 @@ namespace RefrigeratedCase {
 							GasCooler( GCNum ).GasCoolerRejectHeatToZone = true;
 							RefrigPresentInZone( GasCooler( GCNum ).InletAirZoneNum ) = true;
 						} else { // not in a conditioned zone, so see if it's outside
-							GasCooler( GCNum ).InletAirNodeNum = GetOnlySingleNode( Alphas( 4 ), ErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsParent );
+							GasCooler( GCNum ).InletAirNodeNum = GetOnlySingleNode( Alphas( 4 ), GetRefrigerationInputErrorsFound, CurrentModuleObject, Alphas( 1 ), NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsParent );
 							if ( ! CheckOutAirNodeNumber( GasCooler( GCNum ).InletAirNodeNum ) ) {
 								// not outside and not a zone
 								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + GasCooler( GCNum ).Name + "\", " + cAlphaFieldNames( 4 ) + " not found: " + Alphas( 4 ) );
 								ShowContinueError( "...does not appear in an OutdoorAir:NodeList or as an OutdoorAir:Node or as a Zone." );
-								ErrorsFound = true;
+								GetRefrigerationInputErrorsFound = true;
 							} //checkoutairnodenumber
 						} //InletAirZoneNum \=0
 					} // Gas cooler air inlet node connection
@@ -3672,17 +4528,17 @@ namespace RefrigeratedCase {
 			//************ START SECONDARY LOOP INPUT (before system input) **************
 			if ( NumSimulationSecondarySystems > 0 ) {
 				CurrentModuleObject = "Refrigeration:SecondarySystem";
-				for ( SecondaryNum = 1; SecondaryNum <= NumSimulationSecondarySystems; ++SecondaryNum ) {
-					GetObjectItem( CurrentModuleObject, SecondaryNum, Alphas, NumAlphas, Numbers, NumNumbers, IOStatus, lNumericBlanks, lAlphaBlanks, cAlphaFieldNames, cNumericFieldNames );
+				for ( GetRefrigerationInputSecondaryNum = 1; GetRefrigerationInputSecondaryNum <= NumSimulationSecondarySystems; ++GetRefrigerationInputSecondaryNum ) {
+					GetObjectItem( CurrentModuleObject, GetRefrigerationInputSecondaryNum, Alphas, NumAlphas, Numbers, NumNumbers, IOStatus, lNumericBlanks, lAlphaBlanks, cAlphaFieldNames, cNumericFieldNames );
 					IsNotOK = false;
 					IsBlank = false;
-					VerifyName( Alphas( 1 ), Secondary, SecondaryNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+					VerifyName( Alphas( 1 ), Secondary, GetRefrigerationInputSecondaryNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 					if ( IsNotOK ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + ", has an invalid or undefined " + cAlphaFieldNames( 1 ) + "=\"" + Alphas( 1 ) + "\"." );
 						if ( IsBlank ) Alphas( 1 ) = "xxxxx";
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
-					Secondary( SecondaryNum ).Name = Alphas( 1 );
+					Secondary( GetRefrigerationInputSecondaryNum ).Name = Alphas( 1 );
 
 					//   Find the loads on the secondary loop: can be input in form of case or walkin or CaseAndWalkInList names
 					NominalTotalCaseCap = 0.0;
@@ -3691,14 +4547,14 @@ namespace RefrigeratedCase {
 					NumCoils = 0;
 					NumWalkIns = 0;
 					NominalTotalWalkInCap = 0.0;
-					Secondary( SecondaryNum ).RefInventory = 0.0;
+					Secondary( GetRefrigerationInputSecondaryNum ).RefInventory = 0.0;
 
 					//   Read display case and walkin assignments for this secondary
 					AlphaNum = 2;
 					if ( lAlphaBlanks( AlphaNum ) ) {
 						//No cases or walkins specified, ie, secondary has no load
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\", has no loads, must have at least one of: " + cAlphaFieldNames( AlphaNum ) );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\", has no loads, must have at least one of: " + cAlphaFieldNames( AlphaNum ) );
+						GetRefrigerationInputErrorsFound = true;
 					} else { // (.NOT. lAlphaBlanks(AlphaNum))
 
 						// Entry for Alphas(AlphaNum) can be either a Case, WalkIn Coil, or CaseAndWalkInList name
@@ -3717,40 +4573,40 @@ namespace RefrigeratedCase {
 						if ( CoilNum != 0 ) ++NumNameMatches;
 
 						if ( NumNameMatches != 1 ) { //name must uniquely point to a list or a single case or walkin or coil
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 							if ( NumNameMatches == 0 ) {
-								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\", has an invalid " + cAlphaFieldNames( AlphaNum ) + ": " + Alphas( AlphaNum ) );
+								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\", has an invalid " + cAlphaFieldNames( AlphaNum ) + ": " + Alphas( AlphaNum ) );
 							} else if ( NumNameMatches > 1 ) {
-								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\", has a non-unique name that could be either a " + cAlphaFieldNames( AlphaNum ) + ": " + Alphas( AlphaNum ) );
+								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\", has a non-unique name that could be either a " + cAlphaFieldNames( AlphaNum ) + ": " + Alphas( AlphaNum ) );
 							} //num matches = 0 or > 1
 						} else if ( CaseAndWalkInListNum != 0 ) { //Name points to a CaseAndWalkInList
 							NumCoils = CaseAndWalkInList( CaseAndWalkInListNum ).NumCoils;
 							NumCases = CaseAndWalkInList( CaseAndWalkInListNum ).NumCases;
 							NumWalkIns = CaseAndWalkInList( CaseAndWalkInListNum ).NumWalkIns;
-							Secondary( SecondaryNum ).NumCases = NumCases;
-							Secondary( SecondaryNum ).NumCoils = NumCoils;
-							Secondary( SecondaryNum ).NumWalkIns = NumWalkIns;
-							if ( ! allocated( Secondary( SecondaryNum ).CaseNum ) ) Secondary( SecondaryNum ).CaseNum.allocate( NumCases );
-							Secondary( SecondaryNum ).CaseNum( {1,NumCases} ) = CaseAndWalkInList( CaseAndWalkInListNum ).CaseItemNum( {1,NumCases} );
-							if ( ! allocated( Secondary( SecondaryNum ).CoilNum ) ) Secondary( SecondaryNum ).CoilNum.allocate( NumCoils );
-							Secondary( SecondaryNum ).CoilNum( {1,NumCoils} ) = CaseAndWalkInList( CaseAndWalkInListNum ).CoilItemNum( {1,NumCoils} );
-							if ( ! allocated( Secondary( SecondaryNum ).WalkInNum ) ) Secondary( SecondaryNum ).WalkInNum.allocate( NumWalkIns );
-							Secondary( SecondaryNum ).WalkInNum( {1,NumWalkIns} ) = CaseAndWalkInList( CaseAndWalkInListNum ).WalkInItemNum( {1,NumWalkIns} );
+							Secondary( GetRefrigerationInputSecondaryNum ).NumCases = NumCases;
+							Secondary( GetRefrigerationInputSecondaryNum ).NumCoils = NumCoils;
+							Secondary( GetRefrigerationInputSecondaryNum ).NumWalkIns = NumWalkIns;
+							if ( ! allocated( Secondary( GetRefrigerationInputSecondaryNum ).CaseNum ) ) Secondary( GetRefrigerationInputSecondaryNum ).CaseNum.allocate( NumCases );
+							Secondary( GetRefrigerationInputSecondaryNum ).CaseNum( {1,NumCases} ) = CaseAndWalkInList( CaseAndWalkInListNum ).CaseItemNum( {1,NumCases} );
+							if ( ! allocated( Secondary( GetRefrigerationInputSecondaryNum ).CoilNum ) ) Secondary( GetRefrigerationInputSecondaryNum ).CoilNum.allocate( NumCoils );
+							Secondary( GetRefrigerationInputSecondaryNum ).CoilNum( {1,NumCoils} ) = CaseAndWalkInList( CaseAndWalkInListNum ).CoilItemNum( {1,NumCoils} );
+							if ( ! allocated( Secondary( GetRefrigerationInputSecondaryNum ).WalkInNum ) ) Secondary( GetRefrigerationInputSecondaryNum ).WalkInNum.allocate( NumWalkIns );
+							Secondary( GetRefrigerationInputSecondaryNum ).WalkInNum( {1,NumWalkIns} ) = CaseAndWalkInList( CaseAndWalkInListNum ).WalkInItemNum( {1,NumWalkIns} );
 						} else if ( CaseNum != 0 ) { //Name points to a case
 							NumCases = 1;
-							Secondary( SecondaryNum ).NumCases = 1;
-							if ( ! allocated( Secondary( SecondaryNum ).CaseNum ) ) Secondary( SecondaryNum ).CaseNum.allocate( NumCases );
-							Secondary( SecondaryNum ).CaseNum( NumCases ) = CaseNum;
+							Secondary( GetRefrigerationInputSecondaryNum ).NumCases = 1;
+							if ( ! allocated( Secondary( GetRefrigerationInputSecondaryNum ).CaseNum ) ) Secondary( GetRefrigerationInputSecondaryNum ).CaseNum.allocate( NumCases );
+							Secondary( GetRefrigerationInputSecondaryNum ).CaseNum( NumCases ) = CaseNum;
 						} else if ( CoilNum != 0 ) { //Name points to a coil
 							NumCoils = 1;
-							Secondary( SecondaryNum ).NumCoils = 1;
-							if ( ! allocated( Secondary( SecondaryNum ).CoilNum ) ) Secondary( SecondaryNum ).CoilNum.allocate( NumCoils );
-							Secondary( SecondaryNum ).CoilNum( NumCoils ) = CoilNum;
+							Secondary( GetRefrigerationInputSecondaryNum ).NumCoils = 1;
+							if ( ! allocated( Secondary( GetRefrigerationInputSecondaryNum ).CoilNum ) ) Secondary( GetRefrigerationInputSecondaryNum ).CoilNum.allocate( NumCoils );
+							Secondary( GetRefrigerationInputSecondaryNum ).CoilNum( NumCoils ) = CoilNum;
 						} else if ( WalkInNum != 0 ) { //Name points to a walkin
 							NumWalkIns = 1;
-							Secondary( SecondaryNum ).NumWalkIns = 1;
-							if ( ! allocated( Secondary( SecondaryNum ).WalkInNum ) ) Secondary( SecondaryNum ).WalkInNum.allocate( NumWalkIns );
-							Secondary( SecondaryNum ).WalkInNum( NumWalkIns ) = WalkInNum;
+							Secondary( GetRefrigerationInputSecondaryNum ).NumWalkIns = 1;
+							if ( ! allocated( Secondary( GetRefrigerationInputSecondaryNum ).WalkInNum ) ) Secondary( GetRefrigerationInputSecondaryNum ).WalkInNum.allocate( NumWalkIns );
+							Secondary( GetRefrigerationInputSecondaryNum ).WalkInNum( NumWalkIns ) = WalkInNum;
 						} //NumNameMatches /= 1
 					} //blank input for loads on secondary
 
@@ -3759,14 +4615,14 @@ namespace RefrigeratedCase {
 						// Sum rated capacity of all cases on Secondary
 						for ( CaseIndex = 1; CaseIndex <= NumCases; ++CaseIndex ) {
 							//mark all cases on Secondary as used by this Secondary - checking for unused or non-unique cases
-							CaseNum = Secondary( SecondaryNum ).CaseNum( CaseIndex );
+							CaseNum = Secondary( GetRefrigerationInputSecondaryNum ).CaseNum( CaseIndex );
 							++RefrigCase( CaseNum ).NumSysAttach;
 							NominalTotalCaseCap += RefrigCase( CaseNum ).DesignRatedCap * RefrigCase( CaseNum ).RatedRTF;
-							Secondary( SecondaryNum ).RefInventory += RefrigCase( CaseNum ).DesignRefrigInventory;
+							Secondary( GetRefrigerationInputSecondaryNum ).RefInventory += RefrigCase( CaseNum ).DesignRefrigInventory;
 							if ( CaseIndex == 1 ) { //look for lowest case design evap T for Secondary
-								Secondary( SecondaryNum ).TMinNeeded = RefrigCase( CaseNum ).EvapTempDesign;
+								Secondary( GetRefrigerationInputSecondaryNum ).TMinNeeded = RefrigCase( CaseNum ).EvapTempDesign;
 							} else {
-								Secondary( SecondaryNum ).TMinNeeded = min( RefrigCase( CaseNum ).EvapTempDesign, Secondary( SecondaryNum ).TMinNeeded );
+								Secondary( GetRefrigerationInputSecondaryNum ).TMinNeeded = min( RefrigCase( CaseNum ).EvapTempDesign, Secondary( GetRefrigerationInputSecondaryNum ).TMinNeeded );
 							}
 						} //CaseIndex=1,NumCases
 					} //Numcases > 0
@@ -3776,14 +4632,14 @@ namespace RefrigeratedCase {
 						// Sum rated capacity of all Coils on Secondary
 						for ( CoilIndex = 1; CoilIndex <= NumCoils; ++CoilIndex ) {
 							//mark all Coils on Secondary as used by this Secondary - checking for unused or non-unique Coils
-							CoilNum = Secondary( SecondaryNum ).CoilNum( CoilIndex );
+							CoilNum = Secondary( GetRefrigerationInputSecondaryNum ).CoilNum( CoilIndex );
 							++WarehouseCoil( CoilNum ).NumSysAttach;
 							NominalTotalCoilCap += WarehouseCoil( CoilNum ).RatedSensibleCap;
-							Secondary( SecondaryNum ).RefInventory += WarehouseCoil( CoilNum ).DesignRefrigInventory;
+							Secondary( GetRefrigerationInputSecondaryNum ).RefInventory += WarehouseCoil( CoilNum ).DesignRefrigInventory;
 							if ( ( CoilIndex == 1 ) && ( NumCases == 0 ) ) { //look for lowest Coil design evap T for Secondary
-								Secondary( SecondaryNum ).TMinNeeded = WarehouseCoil( CoilNum ).TEvapDesign;
+								Secondary( GetRefrigerationInputSecondaryNum ).TMinNeeded = WarehouseCoil( CoilNum ).TEvapDesign;
 							} else {
-								Secondary( SecondaryNum ).TMinNeeded = min( WarehouseCoil( CoilNum ).TEvapDesign, Secondary( SecondaryNum ).TMinNeeded );
+								Secondary( GetRefrigerationInputSecondaryNum ).TMinNeeded = min( WarehouseCoil( CoilNum ).TEvapDesign, Secondary( GetRefrigerationInputSecondaryNum ).TMinNeeded );
 							}
 						} //CoilIndex=1,NumCoils
 					} //NumCoils > 0
@@ -3793,14 +4649,14 @@ namespace RefrigeratedCase {
 						// Sum rated capacity of all WalkIns on Secondary
 						for ( WalkInIndex = 1; WalkInIndex <= NumWalkIns; ++WalkInIndex ) {
 							//mark all WalkIns on Secondary as used by this Secondary - checking for unused or non-unique WalkIns
-							WalkInID = Secondary( SecondaryNum ).WalkInNum( WalkInIndex );
-							++WalkIn( WalkInID ).NumSysAttach;
-							NominalTotalWalkInCap += WalkIn( WalkInID ).DesignRatedCap;
-							Secondary( SecondaryNum ).RefInventory += WalkIn( WalkInID ).DesignRefrigInventory;
+							GetRefrigerationInputWalkInID = Secondary( GetRefrigerationInputSecondaryNum ).WalkInNum( WalkInIndex );
+							++WalkIn( GetRefrigerationInputWalkInID ).NumSysAttach;
+							NominalTotalWalkInCap += WalkIn( GetRefrigerationInputWalkInID ).DesignRatedCap;
+							Secondary( GetRefrigerationInputSecondaryNum ).RefInventory += WalkIn( GetRefrigerationInputWalkInID ).DesignRefrigInventory;
 							if ( ( WalkInIndex == 1 ) && ( NumCases == 0 ) && ( NumCoils == 0 ) ) { //look for lowest load design evap T for Secondary
-								Secondary( SecondaryNum ).TMinNeeded = WalkIn( WalkInID ).TEvapDesign;
+								Secondary( GetRefrigerationInputSecondaryNum ).TMinNeeded = WalkIn( GetRefrigerationInputWalkInID ).TEvapDesign;
 							} else {
-								Secondary( SecondaryNum ).TMinNeeded = min( Secondary( SecondaryNum ).TMinNeeded, WalkIn( WalkInID ).TEvapDesign );
+								Secondary( GetRefrigerationInputSecondaryNum ).TMinNeeded = min( Secondary( GetRefrigerationInputSecondaryNum ).TMinNeeded, WalkIn( GetRefrigerationInputWalkInID ).TEvapDesign );
 							}
 						} //WalkInIndex=1,NumWalkIns
 					} // Numwalkins > 0
@@ -3809,100 +4665,100 @@ namespace RefrigeratedCase {
 					AlphaNum = 3;
 					if ( ! lAlphaBlanks( AlphaNum ) ) {
 						if ( SameString( Alphas( AlphaNum ), "FluidAlwaysLiquid" ) ) {
-							Secondary( SecondaryNum ).FluidType = SecFluidTypeAlwaysLiquid;
+							Secondary( GetRefrigerationInputSecondaryNum ).FluidType = SecFluidTypeAlwaysLiquid;
 						} else if ( SameString( Alphas( AlphaNum ), "FluidPhaseChange" ) ) {
-							Secondary( SecondaryNum ).FluidType = SecFluidTypePhaseChange;
+							Secondary( GetRefrigerationInputSecondaryNum ).FluidType = SecFluidTypePhaseChange;
 						} else {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\"  " + cAlphaFieldNames( AlphaNum ) + " not recognized = " + Alphas( AlphaNum ) );
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\"  " + cAlphaFieldNames( AlphaNum ) + " not recognized = " + Alphas( AlphaNum ) );
 							ShowContinueError( "Input value choices should be FluidAlwaysLiquid or FluidPhaseChange." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						} //Set FluidType
 					} else {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\" " + cAlphaFieldNames( AlphaNum ) + " must be specified." );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\" " + cAlphaFieldNames( AlphaNum ) + " must be specified." );
+						GetRefrigerationInputErrorsFound = true;
 					} // blank on cir fluid type
 
 					AlphaNum = 4;
-					Secondary( SecondaryNum ).FluidName = Alphas( AlphaNum );
+					Secondary( GetRefrigerationInputSecondaryNum ).FluidName = Alphas( AlphaNum );
 					// Error messages for refrigerants and glycols already found in fluidproperties
 
 					// Note remainder of inputs for secondary don't follow IDD input order because of different interpretations
 					//   and intermediate calculations used to assign default values for brine type vs. liquid overfeed/phase change loops
 
 					if ( ! lNumericBlanks( 3 ) ) {
-						Secondary( SecondaryNum ).TEvapDesign = Numbers( 3 );
+						Secondary( GetRefrigerationInputSecondaryNum ).TEvapDesign = Numbers( 3 );
 					} else {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\" " + cNumericFieldNames( 3 ) + " must be specified." );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\" " + cNumericFieldNames( 3 ) + " must be specified." );
+						GetRefrigerationInputErrorsFound = true;
 					} // blank on N3
 
 					if ( ! lNumericBlanks( 4 ) ) {
-						Secondary( SecondaryNum ).TApproachDifRated = Numbers( 4 );
+						Secondary( GetRefrigerationInputSecondaryNum ).TApproachDifRated = Numbers( 4 );
 					} else {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\" " + cNumericFieldNames( 4 ) + " must be specified." );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\" " + cNumericFieldNames( 4 ) + " must be specified." );
+						GetRefrigerationInputErrorsFound = true;
 					} // blank on N4
 
 					//^^^^^^^Now look at input and once-only calculations required only for liquid/brine secondary loops^^^^^^^^^^^^^^^^^^^^^^
 					//   Ensure that required input data is not missing prior to performing the following once-only calculations
-					if ( ErrorsFound ) {
-						ShowFatalError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\", Program terminated due to previous condition(s)." );
+					if ( GetRefrigerationInputErrorsFound ) {
+						ShowFatalError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\", Program terminated due to previous condition(s)." );
 					} // ErrorsFound
 
-					if ( Secondary( SecondaryNum ).FluidType == SecFluidTypeAlwaysLiquid ) {
+					if ( Secondary( GetRefrigerationInputSecondaryNum ).FluidType == SecFluidTypeAlwaysLiquid ) {
 						if ( ! lNumericBlanks( 5 ) ) {
-							Secondary( SecondaryNum ).TRangeDifRated = Numbers( 5 );
+							Secondary( GetRefrigerationInputSecondaryNum ).TRangeDifRated = Numbers( 5 );
 						} else {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\", " + cNumericFieldNames( 5 ) + " must be specified." );
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\", " + cNumericFieldNames( 5 ) + " must be specified." );
 							ShowContinueError( "...when " + cAlphaFieldNames( 3 ) + "=\"FluidAlwaysLiquid\"." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						} // blank on N5
 
 						// Get fluid properties at rated conditions, will be used to calculate ht exchgr effectiveness
-						TBrineOutRated = Secondary( SecondaryNum ).TEvapDesign + Secondary( SecondaryNum ).TApproachDifRated;
-						TBrineInRated = TBrineOutRated + Secondary( SecondaryNum ).TRangeDifRated;
+						TBrineOutRated = Secondary( GetRefrigerationInputSecondaryNum ).TEvapDesign + Secondary( GetRefrigerationInputSecondaryNum ).TApproachDifRated;
+						TBrineInRated = TBrineOutRated + Secondary( GetRefrigerationInputSecondaryNum ).TRangeDifRated;
 						TBrineAverage = ( TBrineOutRated + TBrineInRated ) / 2.0;
-						Secondary( SecondaryNum ).TBrineAverage = TBrineAverage;
-						DensityBrineRated = GetDensityGlycol( Secondary( SecondaryNum ).FluidName, TBrineAverage, Secondary( SecondaryNum ).FluidID, TrackMessage );
-						Secondary( SecondaryNum ).DensityBrineRated = DensityBrineRated;
-						CpBrineRated = GetSpecificHeatGlycol( Secondary( SecondaryNum ).FluidName, TBrineAverage, Secondary( SecondaryNum ).FluidID, TrackMessage );
-						Secondary( SecondaryNum ).CpBrineRated = CpBrineRated;
+						Secondary( GetRefrigerationInputSecondaryNum ).TBrineAverage = TBrineAverage;
+						DensityBrineRated = GetDensityGlycol( Secondary( GetRefrigerationInputSecondaryNum ).FluidName, TBrineAverage, Secondary( GetRefrigerationInputSecondaryNum ).FluidID, TrackMessage );
+						Secondary( GetRefrigerationInputSecondaryNum ).DensityBrineRated = DensityBrineRated;
+						CpBrineRated = GetSpecificHeatGlycol( Secondary( GetRefrigerationInputSecondaryNum ).FluidName, TBrineAverage, Secondary( GetRefrigerationInputSecondaryNum ).FluidID, TrackMessage );
+						Secondary( GetRefrigerationInputSecondaryNum ).CpBrineRated = CpBrineRated;
 
 						//Users can input either design brine flow (m3/s), or capacity in W, or both.  Now have
 						//  temperatures needed to calculate either the loop cooling capacity or fluid flow rate, if one was not input
 						//  Don't need to save as a flow vol as a permanent var because calc whichever is missing here
 						if ( ( ! lNumericBlanks( 1 ) ) && ( ! lNumericBlanks( 2 ) ) ) {
 							//Both values input, check for approximate agreement
-							Secondary( SecondaryNum ).CoolingLoadRated = Numbers( 1 );
+							Secondary( GetRefrigerationInputSecondaryNum ).CoolingLoadRated = Numbers( 1 );
 							SecondaryFlowVolRated = Numbers( 2 );
 							FlowMassRated = SecondaryFlowVolRated * DensityBrineRated;
-							NominalSecondaryCapacity = FlowMassRated * CpBrineRated * Secondary( SecondaryNum ).TRangeDifRated;
-							TestDelta = ( NominalSecondaryCapacity - Secondary( SecondaryNum ).CoolingLoadRated ) / NominalSecondaryCapacity;
+							NominalSecondaryCapacity = FlowMassRated * CpBrineRated * Secondary( GetRefrigerationInputSecondaryNum ).TRangeDifRated;
+							TestDelta = ( NominalSecondaryCapacity - Secondary( GetRefrigerationInputSecondaryNum ).CoolingLoadRated ) / NominalSecondaryCapacity;
 							if ( std::abs( TestDelta ) > 0.2 ) {
-								ShowWarningError( CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + " You may wish to check the system definition. Based upon the design flow rate and range temperature difference,  The nominal secondary loop heat exchanger capacity is, " + RoundSigDigits( NominalSecondaryCapacity, 0 ) + " but the specified design capacity is,  " + RoundSigDigits( Secondary( SecondaryNum ).CoolingLoadRated, 0 ) );
+								ShowWarningError( CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + " You may wish to check the system definition. Based upon the design flow rate and range temperature difference,  The nominal secondary loop heat exchanger capacity is, " + RoundSigDigits( NominalSecondaryCapacity, 0 ) + " but the specified design capacity is,  " + RoundSigDigits( Secondary( GetRefrigerationInputSecondaryNum ).CoolingLoadRated, 0 ) );
 							}
 						} else if ( ! lNumericBlanks( 1 ) ) {
-							Secondary( SecondaryNum ).CoolingLoadRated = Numbers( 1 );
+							Secondary( GetRefrigerationInputSecondaryNum ).CoolingLoadRated = Numbers( 1 );
 							//Calc flow vol rated
-							FlowMassRated = Secondary( SecondaryNum ).CoolingLoadRated / ( CpBrineRated * Secondary( SecondaryNum ).TRangeDifRated );
+							FlowMassRated = Secondary( GetRefrigerationInputSecondaryNum ).CoolingLoadRated / ( CpBrineRated * Secondary( GetRefrigerationInputSecondaryNum ).TRangeDifRated );
 							SecondaryFlowVolRated = FlowMassRated / DensityBrineRated;
 						} else if ( ! lNumericBlanks( 2 ) ) {
 							SecondaryFlowVolRated = Numbers( 2 );
 							//Calc rated load
 							FlowMassRated = SecondaryFlowVolRated * DensityBrineRated;
-							Secondary( SecondaryNum ).CoolingLoadRated = FlowMassRated * CpBrineRated * Secondary( SecondaryNum ).TRangeDifRated;
+							Secondary( GetRefrigerationInputSecondaryNum ).CoolingLoadRated = FlowMassRated * CpBrineRated * Secondary( GetRefrigerationInputSecondaryNum ).TRangeDifRated;
 						} else {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\", Either \"" + cNumericFieldNames( 1 ) + "\" OR \"" + cNumericFieldNames( 2 ) + "\" must be input." );
-							ErrorsFound = true;
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\", Either \"" + cNumericFieldNames( 1 ) + "\" OR \"" + cNumericFieldNames( 2 ) + "\" must be input." );
+							GetRefrigerationInputErrorsFound = true;
 						} // Capacity Input via either or both options
 
-						if ( ! ErrorsFound ) {
+						if ( ! GetRefrigerationInputErrorsFound ) {
 							//Calculate heat exchanger effectiveness based on rated flow and temperature differences
-							Secondary( SecondaryNum ).HeatExchangeEta = Secondary( SecondaryNum ).CoolingLoadRated / ( FlowMassRated * CpBrineRated * ( TBrineInRated - Secondary( SecondaryNum ).TEvapDesign ) );
-							Secondary( SecondaryNum ).TBrineInRated = TBrineInRated;
-							if ( Secondary( SecondaryNum ).HeatExchangeEta > 0.99 ) {
-								ShowWarningError( CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + " You may wish to check the system definition.  The heat exchanger effectiveness is, " + RoundSigDigits( Secondary( SecondaryNum ).HeatExchangeEta, 2 ) );
-								Secondary( SecondaryNum ).HeatExchangeEta = 0.99;
+							Secondary( GetRefrigerationInputSecondaryNum ).HeatExchangeEta = Secondary( GetRefrigerationInputSecondaryNum ).CoolingLoadRated / ( FlowMassRated * CpBrineRated * ( TBrineInRated - Secondary( GetRefrigerationInputSecondaryNum ).TEvapDesign ) );
+							Secondary( GetRefrigerationInputSecondaryNum ).TBrineInRated = TBrineInRated;
+							if ( Secondary( GetRefrigerationInputSecondaryNum ).HeatExchangeEta > 0.99 ) {
+								ShowWarningError( CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + " You may wish to check the system definition.  The heat exchanger effectiveness is, " + RoundSigDigits( Secondary( GetRefrigerationInputSecondaryNum ).HeatExchangeEta, 2 ) );
+								Secondary( GetRefrigerationInputSecondaryNum ).HeatExchangeEta = 0.99;
 							}
 						} else {
 							ShowContinueError( "...remainder of this object input skipped due to previous errors" );
@@ -3914,28 +4770,28 @@ namespace RefrigeratedCase {
 
 					} else { //FluidType = FluidTypePhaseChange     ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
 						if ( ! lNumericBlanks( 1 ) ) {
-							Secondary( SecondaryNum ).CoolingLoadRated = Numbers( 1 );
+							Secondary( GetRefrigerationInputSecondaryNum ).CoolingLoadRated = Numbers( 1 );
 						} else {
-							Secondary( SecondaryNum ).CoolingLoadRated = NominalTotalCaseCap + NominalTotalWalkInCap;
+							Secondary( GetRefrigerationInputSecondaryNum ).CoolingLoadRated = NominalTotalCaseCap + NominalTotalWalkInCap;
 							// first estimate, will later be adjusted to include pump power
 						} //input capacity
 
-						Secondary( SecondaryNum ).TCondense = Secondary( SecondaryNum ).TEvapDesign + Secondary( SecondaryNum ).TApproachDifRated;
-						Secondary( SecondaryNum ).CircRate = DefaultCircRate;
-						if ( ! lNumericBlanks( 10 ) ) Secondary( SecondaryNum ).CircRate = Numbers( 10 );
+						Secondary( GetRefrigerationInputSecondaryNum ).TCondense = Secondary( GetRefrigerationInputSecondaryNum ).TEvapDesign + Secondary( GetRefrigerationInputSecondaryNum ).TApproachDifRated;
+						Secondary( GetRefrigerationInputSecondaryNum ).CircRate = DefaultCircRate;
+						if ( ! lNumericBlanks( 10 ) ) Secondary( GetRefrigerationInputSecondaryNum ).CircRate = Numbers( 10 );
 
-						DensityPhaseChange = GetSatDensityRefrig( Secondary( SecondaryNum ).FluidName, Secondary( SecondaryNum ).TCondense, 0.0, Secondary( SecondaryNum ).FluidID, TrackMessageAlt );
-						DeltaHPhaseChange = GetSatEnthalpyRefrig( Secondary( SecondaryNum ).FluidName, Secondary( SecondaryNum ).TCondense, 1.0, Secondary( SecondaryNum ).FluidID, TrackMessageAlt ) - GetSatEnthalpyRefrig( Secondary( SecondaryNum ).FluidName, Secondary( SecondaryNum ).TCondense, 0.0, Secondary( SecondaryNum ).FluidID, TrackMessageAlt );
+						DensityPhaseChange = GetSatDensityRefrig( Secondary( GetRefrigerationInputSecondaryNum ).FluidName, Secondary( GetRefrigerationInputSecondaryNum ).TCondense, 0.0, Secondary( GetRefrigerationInputSecondaryNum ).FluidID, TrackMessageAlt );
+						DeltaHPhaseChange = GetSatEnthalpyRefrig( Secondary( GetRefrigerationInputSecondaryNum ).FluidName, Secondary( GetRefrigerationInputSecondaryNum ).TCondense, 1.0, Secondary( GetRefrigerationInputSecondaryNum ).FluidID, TrackMessageAlt ) - GetSatEnthalpyRefrig( Secondary( GetRefrigerationInputSecondaryNum ).FluidName, Secondary( GetRefrigerationInputSecondaryNum ).TCondense, 0.0, Secondary( GetRefrigerationInputSecondaryNum ).FluidID, TrackMessageAlt );
 
 						//TotRatedFlowVol= capacity*circrate/deltahphasechange/density
-						CalcTotFlowVol = Secondary( SecondaryNum ).CoolingLoadRated * Secondary( SecondaryNum ).CircRate / ( DensityPhaseChange * DeltaHPhaseChange );
+						CalcTotFlowVol = Secondary( GetRefrigerationInputSecondaryNum ).CoolingLoadRated * Secondary( GetRefrigerationInputSecondaryNum ).CircRate / ( DensityPhaseChange * DeltaHPhaseChange );
 						PumpTotRatedFlowVol = CalcTotFlowVol;
 						if ( ! lNumericBlanks( 7 ) ) {
 							PumpTotRatedFlowVol = Numbers( 7 );
-							CalcCircRate = DensityPhaseChange * DeltaHPhaseChange * PumpTotRatedFlowVol / Secondary( SecondaryNum ).CoolingLoadRated;
-							DiffCircRates = ( CalcCircRate - Secondary( SecondaryNum ).CircRate ) / Secondary( SecondaryNum ).CircRate;
+							CalcCircRate = DensityPhaseChange * DeltaHPhaseChange * PumpTotRatedFlowVol / Secondary( GetRefrigerationInputSecondaryNum ).CoolingLoadRated;
+							DiffCircRates = ( CalcCircRate - Secondary( GetRefrigerationInputSecondaryNum ).CircRate ) / Secondary( GetRefrigerationInputSecondaryNum ).CircRate;
 							if ( std::abs( DiffCircRates ) > 0.3 ) {
-								ShowWarningError( CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + ' ' + cNumericFieldNames( 7 ) + " Produces a circulating rate of " + RoundSigDigits( CalcCircRate, 2 ) + " ;  A circulating rate of " + RoundSigDigits( Secondary( SecondaryNum ).CircRate, 2 ) + " would need a " + cNumericFieldNames( 7 ) + " of " + RoundSigDigits( CalcTotFlowVol, 2 ) + " m3/s" );
+								ShowWarningError( CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + ' ' + cNumericFieldNames( 7 ) + " Produces a circulating rate of " + RoundSigDigits( CalcCircRate, 2 ) + " ;  A circulating rate of " + RoundSigDigits( Secondary( GetRefrigerationInputSecondaryNum ).CircRate, 2 ) + " would need a " + cNumericFieldNames( 7 ) + " of " + RoundSigDigits( CalcTotFlowVol, 2 ) + " m3/s" );
 							} // warning check on pump flow rate vs circ rate input
 						} //blank pump flow rate
 						SecondaryFlowVolRated = PumpTotRatedFlowVol;
@@ -3945,73 +4801,73 @@ namespace RefrigeratedCase {
 					//Read number of pumps (or pump stages) in secondary loop
 					NumPumps = 1; //default value
 					if ( ( ! lNumericBlanks( 6 ) ) && ( Numbers( 6 ) >= 1 ) ) NumPumps = Numbers( 6 );
-					Secondary( SecondaryNum ).NumPumps = NumPumps;
+					Secondary( GetRefrigerationInputSecondaryNum ).NumPumps = NumPumps;
 					// Get pump power (users can input either power in W or head in Pa or both)
 					// Assume pump impeller efficiency is 0.78 (consistent with E+ Pump auto sizing assumption)
 					// Assume pump motor efficiency is 0.85 (Goulds Pumps motor data sheet)
 					// It is important that tot rated head must be for specific fluid
 					if ( ( ! lNumericBlanks( 8 ) ) && ( ! lNumericBlanks( 9 ) ) ) {
-						Secondary( SecondaryNum ).PumpTotRatedPower = Numbers( 8 );
+						Secondary( GetRefrigerationInputSecondaryNum ).PumpTotRatedPower = Numbers( 8 );
 						PumpTotRatedHead = Numbers( 9 );
-						ErrSecondPumpPower = ( Secondary( SecondaryNum ).PumpTotRatedPower - PumpTotRatedFlowVol * PumpTotRatedHead / ( PumpImpellerEfficiency * PumpMotorEfficiency ) ) / Secondary( SecondaryNum ).PumpTotRatedPower;
-						if ( std::abs( ErrSecondPumpPower ) > 0.35 ) ShowWarningError( CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + " Input value for " + cNumericFieldNames( 9 ) + " not consistent with input value for " + cNumericFieldNames( 8 ) + ". " + cNumericFieldNames( 8 ) + " will be used" ); //generous diff allowed because comparing to my assumed impeller and motor effs
+						ErrSecondPumpPower = ( Secondary( GetRefrigerationInputSecondaryNum ).PumpTotRatedPower - PumpTotRatedFlowVol * PumpTotRatedHead / ( PumpImpellerEfficiency * PumpMotorEfficiency ) ) / Secondary( GetRefrigerationInputSecondaryNum ).PumpTotRatedPower;
+						if ( std::abs( ErrSecondPumpPower ) > 0.35 ) ShowWarningError( CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + " Input value for " + cNumericFieldNames( 9 ) + " not consistent with input value for " + cNumericFieldNames( 8 ) + ". " + cNumericFieldNames( 8 ) + " will be used" ); //generous diff allowed because comparing to my assumed impeller and motor effs
 					} else if ( ! lNumericBlanks( 8 ) ) {
-						Secondary( SecondaryNum ).PumpTotRatedPower = Numbers( 8 );
+						Secondary( GetRefrigerationInputSecondaryNum ).PumpTotRatedPower = Numbers( 8 );
 					} else if ( ! lNumericBlanks( 9 ) ) {
 						PumpTotRatedHead = Numbers( 9 );
-						Secondary( SecondaryNum ).PumpTotRatedPower = PumpTotRatedFlowVol * PumpTotRatedHead / ( PumpImpellerEfficiency * PumpMotorEfficiency );
+						Secondary( GetRefrigerationInputSecondaryNum ).PumpTotRatedPower = PumpTotRatedFlowVol * PumpTotRatedHead / ( PumpImpellerEfficiency * PumpMotorEfficiency );
 					} else {
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\", Either \"" + cNumericFieldNames( 8 ) + "\" OR \"" + cNumericFieldNames( 9 ) + "\" must be input." );
-						ErrorsFound = true;
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\", Either \"" + cNumericFieldNames( 8 ) + "\" OR \"" + cNumericFieldNames( 9 ) + "\" must be input." );
+						GetRefrigerationInputErrorsFound = true;
 					} //Either or pump power Input variations (head or power)
 
 					// Get pump drive type
 					AlphaNum = 5;
-					Secondary( SecondaryNum ).PumpControlType = SecPumpControlConstant; //default
+					Secondary( GetRefrigerationInputSecondaryNum ).PumpControlType = SecPumpControlConstant; //default
 					if ( ! lAlphaBlanks( AlphaNum ) ) {
 						if ( SameString( Alphas( AlphaNum ), "Constant" ) ) {
-							Secondary( SecondaryNum ).PumpControlType = SecPumpControlConstant;
+							Secondary( GetRefrigerationInputSecondaryNum ).PumpControlType = SecPumpControlConstant;
 						} else if ( SameString( Alphas( AlphaNum ), "Variable" ) ) {
-							Secondary( SecondaryNum ).PumpControlType = SecPumpControlVariable;
+							Secondary( GetRefrigerationInputSecondaryNum ).PumpControlType = SecPumpControlVariable;
 						} else {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\"  " + cAlphaFieldNames( AlphaNum ) + " not recognized = " + Alphas( AlphaNum ) );
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\"  " + cAlphaFieldNames( AlphaNum ) + " not recognized = " + Alphas( AlphaNum ) );
 							ShowContinueError( "Check input value choices." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						} //Set PumpControlType
 					} // blank on pump drive control type
 
 					//  Print warning if Pump Control = Constant and Variable Speed Curve is specified.
-					if ( ( Secondary( SecondaryNum ).PumpControlType == SecPumpControlConstant ) && ( ! lAlphaBlanks( AlphaNum + 1 ) ) ) {
-						ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\", A " + cAlphaFieldNames( AlphaNum + 1 ) + " is specified even though " + cAlphaFieldNames( AlphaNum ) + " is \"CONSTANT\"." );
+					if ( ( Secondary( GetRefrigerationInputSecondaryNum ).PumpControlType == SecPumpControlConstant ) && ( ! lAlphaBlanks( AlphaNum + 1 ) ) ) {
+						ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\", A " + cAlphaFieldNames( AlphaNum + 1 ) + " is specified even though " + cAlphaFieldNames( AlphaNum ) + " is \"CONSTANT\"." );
 						ShowContinueError( "The secondary loop pump(s) will be modeled as constant speed and the " + cAlphaFieldNames( AlphaNum + 1 ) + " will be ignored." );
 					}
 
-					if ( Secondary( SecondaryNum ).PumpControlType == SecPumpControlConstant ) {
+					if ( Secondary( GetRefrigerationInputSecondaryNum ).PumpControlType == SecPumpControlConstant ) {
 						//Set incremental flow and power amounts for pump dispatch
-						Secondary( SecondaryNum ).PumpIncrementFlowVol = PumpTotRatedFlowVol / NumPumps;
-						Secondary( SecondaryNum ).PumpIncrementPower = Secondary( SecondaryNum ).PumpTotRatedPower / NumPumps;
+						Secondary( GetRefrigerationInputSecondaryNum ).PumpIncrementFlowVol = PumpTotRatedFlowVol / NumPumps;
+						Secondary( GetRefrigerationInputSecondaryNum ).PumpIncrementPower = Secondary( GetRefrigerationInputSecondaryNum ).PumpTotRatedPower / NumPumps;
 					} else { //Variable speed drive need to read in power curve
 						AlphaNum = 6;
-						Secondary( SecondaryNum ).VarSpeedCurvePtr = GetCurveIndex( Alphas( AlphaNum ) ); // convert curve name to number
-						if ( Secondary( SecondaryNum ).VarSpeedCurvePtr == 0 ) {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found:" + Alphas( AlphaNum ) );
-							ErrorsFound = true;
+						Secondary( GetRefrigerationInputSecondaryNum ).VarSpeedCurvePtr = GetCurveIndex( Alphas( AlphaNum ) ); // convert curve name to number
+						if ( Secondary( GetRefrigerationInputSecondaryNum ).VarSpeedCurvePtr == 0 ) {
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found:" + Alphas( AlphaNum ) );
+							GetRefrigerationInputErrorsFound = true;
 						}
-						if ( ! SameString( GetCurveType( Secondary( SecondaryNum ).VarSpeedCurvePtr ), "CUBIC" ) ) {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " object must be of type cubic." );
-							ErrorsFound = true;
+						if ( ! SameString( GetCurveType( Secondary( GetRefrigerationInputSecondaryNum ).VarSpeedCurvePtr ), "CUBIC" ) ) {
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " object must be of type cubic." );
+							GetRefrigerationInputErrorsFound = true;
 						}
 					} // input power conditions/levels for constant or variable speed pump drives
 
 					//Default non-hermetic motor eff at 85% and all shaft power goes to heat in fluid
 					// In a semi-hermetic motor, assume all power to motor goes to heat in fluid
-					Secondary( SecondaryNum ).PumpPowerToHeat = PumpMotorEfficiency;
+					Secondary( GetRefrigerationInputSecondaryNum ).PumpPowerToHeat = PumpMotorEfficiency;
 					NumNum = 11;
 					if ( ! lNumericBlanks( NumNum ) ) {
 						if ( ( 0.5 <= Numbers( NumNum ) ) && ( 1.0 >= Numbers( NumNum ) ) ) {
-							Secondary( SecondaryNum ).PumpPowerToHeat = Numbers( NumNum );
+							Secondary( GetRefrigerationInputSecondaryNum ).PumpPowerToHeat = Numbers( NumNum );
 						} else {
-							ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\" " + cNumericFieldNames( NumNum ) + " must be between 0.5 and 1.0. Default value of : " + RoundSigDigits( PumpMotorEfficiency, 3 ) + " will be used" );
+							ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\" " + cNumericFieldNames( NumNum ) + " must be between 0.5 and 1.0. Default value of : " + RoundSigDigits( PumpMotorEfficiency, 3 ) + " will be used" );
 						} //range of pump moter heat to fluid
 					} //blank input for pumppowertoheat
 
@@ -4020,29 +4876,29 @@ namespace RefrigeratedCase {
 					//  This Zone ID will be used to determine the temperature used for distribution piping heat gain.
 					//  Zone Id is only required if Sum UA Distribution Piping >0.0
 					//  Get the Zone node number from the zone name entered by the user
-					Secondary( SecondaryNum ).SumUADistPiping = 0.0;
+					Secondary( GetRefrigerationInputSecondaryNum ).SumUADistPiping = 0.0;
 					AlphaNum = 7;
 					NumNum = 12;
 					if ( ! lNumericBlanks( NumNum ) && ! lAlphaBlanks( AlphaNum ) ) {
-						Secondary( SecondaryNum ).SumUADistPiping = Numbers( NumNum );
-						Secondary( SecondaryNum ).DistPipeZoneNum = FindItemInList( Alphas( AlphaNum ), Zone );
-						Secondary( SecondaryNum ).DistPipeZoneNodeNum = GetSystemNodeNumberForZone( Alphas( AlphaNum ) );
+						Secondary( GetRefrigerationInputSecondaryNum ).SumUADistPiping = Numbers( NumNum );
+						Secondary( GetRefrigerationInputSecondaryNum ).DistPipeZoneNum = FindItemInList( Alphas( AlphaNum ), Zone );
+						Secondary( GetRefrigerationInputSecondaryNum ).DistPipeZoneNodeNum = GetSystemNodeNumberForZone( Alphas( AlphaNum ) );
 
-						if ( Secondary( SecondaryNum ).DistPipeZoneNum == 0 ) {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not valid: " + Alphas( AlphaNum ) );
-							ErrorsFound = true;
+						if ( Secondary( GetRefrigerationInputSecondaryNum ).DistPipeZoneNum == 0 ) {
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not valid: " + Alphas( AlphaNum ) );
+							GetRefrigerationInputErrorsFound = true;
 						} else {
-							RefrigPresentInZone( Secondary( SecondaryNum ).DistPipeZoneNum ) = true;
+							RefrigPresentInZone( Secondary( GetRefrigerationInputSecondaryNum ).DistPipeZoneNum ) = true;
 						}
 
-						if ( Secondary( SecondaryNum ).DistPipeZoneNodeNum == 0 ) {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\" System Node Number not found for " + cAlphaFieldNames( AlphaNum ) + " = " + Alphas( AlphaNum ) + " even though " + cNumericFieldNames( NumNum ) + " is greater than zero. Distribution piping heat gain cannot be calculated unless a controlled Zone (appear in a ZoneHVAC:EquipmentConnections object.) is defined to determine the environmental temperature surrounding the piping." );
-							ErrorsFound = true;
+						if ( Secondary( GetRefrigerationInputSecondaryNum ).DistPipeZoneNodeNum == 0 ) {
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\" System Node Number not found for " + cAlphaFieldNames( AlphaNum ) + " = " + Alphas( AlphaNum ) + " even though " + cNumericFieldNames( NumNum ) + " is greater than zero. Distribution piping heat gain cannot be calculated unless a controlled Zone (appear in a ZoneHVAC:EquipmentConnections object.) is defined to determine the environmental temperature surrounding the piping." );
+							GetRefrigerationInputErrorsFound = true;
 						}
 					} else if ( ! lNumericBlanks( NumNum ) && lAlphaBlanks( AlphaNum ) ) {
-						ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\", " + cAlphaFieldNames( AlphaNum ) + " not found even though " + cNumericFieldNames( NumNum ) + " is greater than zero. Distribution piping heat gain will not be calculated unless a Zone is defined to deterimine the environmental temperature surrounding the piping." );
+						ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\", " + cAlphaFieldNames( AlphaNum ) + " not found even though " + cNumericFieldNames( NumNum ) + " is greater than zero. Distribution piping heat gain will not be calculated unless a Zone is defined to deterimine the environmental temperature surrounding the piping." );
 					} else if ( lNumericBlanks( NumNum ) && ! lAlphaBlanks( AlphaNum ) ) {
-						ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\", " + cAlphaFieldNames( AlphaNum ) + " will not be used and distribution piping heat gain will not be calculated because " + cNumericFieldNames( NumNum ) + " was blank." );
+						ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\", " + cAlphaFieldNames( AlphaNum ) + " will not be used and distribution piping heat gain will not be calculated because " + cNumericFieldNames( NumNum ) + " was blank." );
 					} //distribution piping
 
 					//Separator/receiver heat gain - optional
@@ -4050,88 +4906,88 @@ namespace RefrigeratedCase {
 					//  This Zone ID will be used to determine the temperature used for Separator/receiver heat gain.
 					//  Zone Id is only required if Sum UA Separator/receiver >0.0
 					//  Get the Zone node number from the zone name entered by the user
-					Secondary( SecondaryNum ).SumUAReceiver = 0.0;
+					Secondary( GetRefrigerationInputSecondaryNum ).SumUAReceiver = 0.0;
 					AlphaNum = 8;
 					NumNum = 13;
 					if ( ! lNumericBlanks( NumNum ) && ! lAlphaBlanks( AlphaNum ) ) {
-						Secondary( SecondaryNum ).SumUAReceiver = Numbers( NumNum );
-						Secondary( SecondaryNum ).ReceiverZoneNum = FindItemInList( Alphas( AlphaNum ), Zone );
-						Secondary( SecondaryNum ).ReceiverZoneNodeNum = GetSystemNodeNumberForZone( Alphas( AlphaNum ) );
+						Secondary( GetRefrigerationInputSecondaryNum ).SumUAReceiver = Numbers( NumNum );
+						Secondary( GetRefrigerationInputSecondaryNum ).ReceiverZoneNum = FindItemInList( Alphas( AlphaNum ), Zone );
+						Secondary( GetRefrigerationInputSecondaryNum ).ReceiverZoneNodeNum = GetSystemNodeNumberForZone( Alphas( AlphaNum ) );
 
-						if ( Secondary( SecondaryNum ).ReceiverZoneNum == 0 ) {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not valid: " + Alphas( AlphaNum ) );
-							ErrorsFound = true;
+						if ( Secondary( GetRefrigerationInputSecondaryNum ).ReceiverZoneNum == 0 ) {
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not valid: " + Alphas( AlphaNum ) );
+							GetRefrigerationInputErrorsFound = true;
 						} else {
-							RefrigPresentInZone( Secondary( SecondaryNum ).ReceiverZoneNum ) = true;
+							RefrigPresentInZone( Secondary( GetRefrigerationInputSecondaryNum ).ReceiverZoneNum ) = true;
 						}
-						if ( Secondary( SecondaryNum ).ReceiverZoneNodeNum == 0 ) {
-							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\" System Node Number not found for " + cAlphaFieldNames( AlphaNum ) + " = " + Alphas( AlphaNum ) + " even though " + cNumericFieldNames( NumNum ) + " is greater than zero. Receiver heat gain cannot be calculated unless a controlled Zone (appear in a ZoneHVAC:EquipmentConnections object.) is defined to determine the environmental temperature surrounding the Receiver." );
-							ErrorsFound = true;
+						if ( Secondary( GetRefrigerationInputSecondaryNum ).ReceiverZoneNodeNum == 0 ) {
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\" System Node Number not found for " + cAlphaFieldNames( AlphaNum ) + " = " + Alphas( AlphaNum ) + " even though " + cNumericFieldNames( NumNum ) + " is greater than zero. Receiver heat gain cannot be calculated unless a controlled Zone (appear in a ZoneHVAC:EquipmentConnections object.) is defined to determine the environmental temperature surrounding the Receiver." );
+							GetRefrigerationInputErrorsFound = true;
 						}
 					} else if ( ! lNumericBlanks( NumNum ) && lAlphaBlanks( AlphaNum ) ) {
-						ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\", " + cAlphaFieldNames( AlphaNum ) + " not found even though " + cNumericFieldNames( NumNum ) + " is greater than zero. Receiver heat gain will not be calculated unless a Zone is defined to deterimine the environmental temperature surrounding the Receiver." );
+						ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\", " + cAlphaFieldNames( AlphaNum ) + " not found even though " + cNumericFieldNames( NumNum ) + " is greater than zero. Receiver heat gain will not be calculated unless a Zone is defined to deterimine the environmental temperature surrounding the Receiver." );
 					} else if ( lNumericBlanks( NumNum ) && ! lAlphaBlanks( AlphaNum ) ) {
-						ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\", " + cAlphaFieldNames( AlphaNum ) + " will not be used and Receiver heat gain will not be calculated because " + cNumericFieldNames( NumNum ) + " was blank." );
+						ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\", " + cAlphaFieldNames( AlphaNum ) + " will not be used and Receiver heat gain will not be calculated because " + cNumericFieldNames( NumNum ) + " was blank." );
 					} //Receiver
 
 					NumNum = 14;
-					Secondary( SecondaryNum ).ChillerRefInventory = 0.0;
-					if ( ! lNumericBlanks( NumNum ) ) Secondary( SecondaryNum ).ChillerRefInventory = Numbers( NumNum );
-					if ( Secondary( SecondaryNum ).ChillerRefInventory < 0.0 ) {
-						Secondary( SecondaryNum ).ChillerRefInventory = 0.0;
-						ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\", The value specified for " + cNumericFieldNames( NumNum ) + " is less than zero. The default value of zero will be used." );
+					Secondary( GetRefrigerationInputSecondaryNum ).ChillerRefInventory = 0.0;
+					if ( ! lNumericBlanks( NumNum ) ) Secondary( GetRefrigerationInputSecondaryNum ).ChillerRefInventory = Numbers( NumNum );
+					if ( Secondary( GetRefrigerationInputSecondaryNum ).ChillerRefInventory < 0.0 ) {
+						Secondary( GetRefrigerationInputSecondaryNum ).ChillerRefInventory = 0.0;
+						ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\", The value specified for " + cNumericFieldNames( NumNum ) + " is less than zero. The default value of zero will be used." );
 					}
 
 					AlphaNum = 9;
-					if ( ! lAlphaBlanks( AlphaNum ) ) Secondary( SecondaryNum ).EndUseSubcategory = Alphas( AlphaNum );
+					if ( ! lAlphaBlanks( AlphaNum ) ) Secondary( GetRefrigerationInputSecondaryNum ).EndUseSubcategory = Alphas( AlphaNum );
 
 					//Error checks on secondary loop:
 					// Note, rated capacities can be far off from operating capacities, but rough checks here
 					//       (don't include dist piping or receiver heat gains).
 					// Load limit logic here (maxvolflow and maxload used in calcs later)
-					Secondary( SecondaryNum ).MaxVolFlow = min( SecondaryFlowVolRated, PumpTotRatedFlowVol );
-					NominalSecondaryRefLoad = NominalTotalCaseCap + NominalTotalWalkInCap + Secondary( SecondaryNum ).PumpTotRatedPower;
+					Secondary( GetRefrigerationInputSecondaryNum ).MaxVolFlow = min( SecondaryFlowVolRated, PumpTotRatedFlowVol );
+					NominalSecondaryRefLoad = NominalTotalCaseCap + NominalTotalWalkInCap + Secondary( GetRefrigerationInputSecondaryNum ).PumpTotRatedPower;
 
-					if ( Secondary( SecondaryNum ).FluidType == SecFluidTypeAlwaysLiquid ) {
-						if ( TBrineOutRated > ( Secondary( SecondaryNum ).TMinNeeded + 0.5 ) ) {
-							ShowWarningError( CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + " The design brine temperature to the refrigeration loads: " + RoundSigDigits( TBrineOutRated, 1 ) + " ;" );
-							ShowContinueError( " is greater than the design inlet temperature for at least one of the cases or walkins: " + RoundSigDigits( Secondary( SecondaryNum ).TMinNeeded, 1 ) );
+					if ( Secondary( GetRefrigerationInputSecondaryNum ).FluidType == SecFluidTypeAlwaysLiquid ) {
+						if ( TBrineOutRated > ( Secondary( GetRefrigerationInputSecondaryNum ).TMinNeeded + 0.5 ) ) {
+							ShowWarningError( CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + " The design brine temperature to the refrigeration loads: " + RoundSigDigits( TBrineOutRated, 1 ) + " ;" );
+							ShowContinueError( " is greater than the design inlet temperature for at least one of the cases or walkins: " + RoundSigDigits( Secondary( GetRefrigerationInputSecondaryNum ).TMinNeeded, 1 ) );
 							ShowContinueError( " Compare your Approach and Evaporating Temperature to the design inlet temperatures needed for the loads." );
 							//ErrorsFound = .TRUE.
 						} //Tbrine out warning
-						CapacityAtMaxVolFlow = Secondary( SecondaryNum ).MaxVolFlow * Secondary( SecondaryNum ).HeatExchangeEta * ( CpBrineRated * DensityBrineRated ) * ( TBrineInRated - Secondary( SecondaryNum ).TEvapDesign );
-						Secondary( SecondaryNum ).MaxLoad = min( Secondary( SecondaryNum ).CoolingLoadRated, CapacityAtMaxVolFlow );
-						DeltaCap1 = std::abs( ( Secondary( SecondaryNum ).CoolingLoadRated - CapacityAtMaxVolFlow ) / Secondary( SecondaryNum ).CoolingLoadRated );
+						CapacityAtMaxVolFlow = Secondary( GetRefrigerationInputSecondaryNum ).MaxVolFlow * Secondary( GetRefrigerationInputSecondaryNum ).HeatExchangeEta * ( CpBrineRated * DensityBrineRated ) * ( TBrineInRated - Secondary( GetRefrigerationInputSecondaryNum ).TEvapDesign );
+						Secondary( GetRefrigerationInputSecondaryNum ).MaxLoad = min( Secondary( GetRefrigerationInputSecondaryNum ).CoolingLoadRated, CapacityAtMaxVolFlow );
+						DeltaCap1 = std::abs( ( Secondary( GetRefrigerationInputSecondaryNum ).CoolingLoadRated - CapacityAtMaxVolFlow ) / Secondary( GetRefrigerationInputSecondaryNum ).CoolingLoadRated );
 						if ( DeltaCap1 > ( 0.3 ) ) { //diff between chiller rating and capacity at max flow > 30%
-							ShowWarningError( CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\" You may wish to check the system sizing.  The nominal secondary loop heat exchanger capacity is " + RoundSigDigits( Secondary( SecondaryNum ).CoolingLoadRated, 0 ) + " But the capacity based upon the maximum flow rate is " + RoundSigDigits( CapacityAtMaxVolFlow, 0 ) );
+							ShowWarningError( CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\" You may wish to check the system sizing.  The nominal secondary loop heat exchanger capacity is " + RoundSigDigits( Secondary( GetRefrigerationInputSecondaryNum ).CoolingLoadRated, 0 ) + " But the capacity based upon the maximum flow rate is " + RoundSigDigits( CapacityAtMaxVolFlow, 0 ) );
 						} // DeltaCap1 > .3
 					} else { // Fluid type phase change                !^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
 						if ( lNumericBlanks( 1 ) ) { // Chiller/evaporator capacity was not specified
 							if ( lNumericBlanks( 7 ) ) { // Pump power was not input, calc based on flow and head
 								//need to refine because capacity calculated, but needs to include pump power (which was prev
 								//   estimated based upon capacity which had been estimated as sum of case and walk-in capacities)
-								PumpTotRatedFlowVol = NominalSecondaryRefLoad * Secondary( SecondaryNum ).CircRate / ( DensityPhaseChange * DeltaHPhaseChange );
-								Secondary( SecondaryNum ).PumpTotRatedPower = PumpTotRatedFlowVol * PumpTotRatedHead / ( PumpImpellerEfficiency * PumpMotorEfficiency );
+								PumpTotRatedFlowVol = NominalSecondaryRefLoad * Secondary( GetRefrigerationInputSecondaryNum ).CircRate / ( DensityPhaseChange * DeltaHPhaseChange );
+								Secondary( GetRefrigerationInputSecondaryNum ).PumpTotRatedPower = PumpTotRatedFlowVol * PumpTotRatedHead / ( PumpImpellerEfficiency * PumpMotorEfficiency );
 								//need to recalc nominal load with new pump power value
-								NominalSecondaryRefLoad = NominalTotalCaseCap + NominalTotalWalkInCap + Secondary( SecondaryNum ).PumpTotRatedPower;
-								if ( Secondary( SecondaryNum ).PumpControlType == SecPumpControlConstant ) {
+								NominalSecondaryRefLoad = NominalTotalCaseCap + NominalTotalWalkInCap + Secondary( GetRefrigerationInputSecondaryNum ).PumpTotRatedPower;
+								if ( Secondary( GetRefrigerationInputSecondaryNum ).PumpControlType == SecPumpControlConstant ) {
 									//Set incremental flow and power amounts for pump dispatch
-									Secondary( SecondaryNum ).PumpIncrementFlowVol = PumpTotRatedFlowVol / NumPumps;
-									Secondary( SecondaryNum ).PumpIncrementPower = Secondary( SecondaryNum ).PumpTotRatedPower / NumPumps;
+									Secondary( GetRefrigerationInputSecondaryNum ).PumpIncrementFlowVol = PumpTotRatedFlowVol / NumPumps;
+									Secondary( GetRefrigerationInputSecondaryNum ).PumpIncrementPower = Secondary( GetRefrigerationInputSecondaryNum ).PumpTotRatedPower / NumPumps;
 								} // constant speed pump
 							} // Pump power was not specified
-							Secondary( SecondaryNum ).CoolingLoadRated = NominalSecondaryRefLoad;
+							Secondary( GetRefrigerationInputSecondaryNum ).CoolingLoadRated = NominalSecondaryRefLoad;
 						} // Chiller/evap capacity was not specified
-						Secondary( SecondaryNum ).MaxLoad = Secondary( SecondaryNum ).CoolingLoadRated;
+						Secondary( GetRefrigerationInputSecondaryNum ).MaxLoad = Secondary( GetRefrigerationInputSecondaryNum ).CoolingLoadRated;
 					} // SecFluidType
 
-					DeltaCap2 = std::abs( ( Secondary( SecondaryNum ).CoolingLoadRated - NominalSecondaryRefLoad ) / Secondary( SecondaryNum ).CoolingLoadRated );
+					DeltaCap2 = std::abs( ( Secondary( GetRefrigerationInputSecondaryNum ).CoolingLoadRated - NominalSecondaryRefLoad ) / Secondary( GetRefrigerationInputSecondaryNum ).CoolingLoadRated );
 					if ( DeltaCap2 > ( 0.3 ) ) { //diff between chiller rating and sum of nominal loads > 30%
-						ShowWarningError( CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\" You may wish to check the system sizing. Total nominal refrigerating load is " + RoundSigDigits( NominalSecondaryRefLoad, 0 ) + " (Including cases, walk-ins, and pump heat).  The nominal secondary loop heat exchanger capacity is " + RoundSigDigits( Secondary( SecondaryNum ).CoolingLoadRated, 0 ) );
+						ShowWarningError( CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\" You may wish to check the system sizing. Total nominal refrigerating load is " + RoundSigDigits( NominalSecondaryRefLoad, 0 ) + " (Including cases, walk-ins, and pump heat).  The nominal secondary loop heat exchanger capacity is " + RoundSigDigits( Secondary( GetRefrigerationInputSecondaryNum ).CoolingLoadRated, 0 ) );
 					}
 					//compare rated xt xchanger brine flow to the total rated pump flow
 					if ( SecondaryFlowVolRated > ( 1.1 * PumpTotRatedFlowVol ) ) {
-						ShowWarningError( CurrentModuleObject + "=\"" + Secondary( SecondaryNum ).Name + "\" You may wish to check the pump sizing. Total nominal brine flow is " + RoundSigDigits( SecondaryFlowVolRated, 0 ) + " m3/s, but the total nominal pump flow rate is:  " + RoundSigDigits( PumpTotRatedFlowVol, 0 ) + " m3/s. " );
+						ShowWarningError( CurrentModuleObject + "=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\" You may wish to check the pump sizing. Total nominal brine flow is " + RoundSigDigits( SecondaryFlowVolRated, 0 ) + " m3/s, but the total nominal pump flow rate is:  " + RoundSigDigits( PumpTotRatedFlowVol, 0 ) + " m3/s. " );
 					}
 
 				} // Secondary Loops
@@ -4151,27 +5007,27 @@ namespace RefrigeratedCase {
 				if ( IsNotOK ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + ", has an invalid or undefined " + cAlphaFieldNames( 1 ) + "=\"" + Alphas( 1 ) + "\"." );
 					if ( IsBlank ) Alphas( 1 ) = "xxxxx";
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 				Compressor( CompNum ).Name = Alphas( 1 );
 
 				Compressor( CompNum ).ElecPowerCurvePtr = GetCurveIndex( Alphas( 2 ) ); // convert curve name to number
 				if ( ( ! lAlphaBlanks( 2 ) ) && Compressor( CompNum ).ElecPowerCurvePtr == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Compressor( CompNum ).Name + "\", invalid  " + cAlphaFieldNames( 2 ) + " not found = " + Alphas( 2 ) );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				Compressor( CompNum ).CapacityCurvePtr = GetCurveIndex( Alphas( 3 ) ); // convert curve name to number
 				if ( ( ! lAlphaBlanks( 3 ) ) && Compressor( CompNum ).CapacityCurvePtr == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Compressor( CompNum ).Name + "\", invalid  " + cAlphaFieldNames( 3 ) + " not found = " + Alphas( 3 ) );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				// Get superheat rating type (Either N1 or N2 Must be input)
 				if ( ( ( ! lNumericBlanks( 1 ) ) && ( ! lNumericBlanks( 2 ) ) ) || ( lNumericBlanks( 1 ) && lNumericBlanks( 2 ) ) ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Compressor( CompNum ).Name + "\"One, and Only One of " + cNumericFieldNames( 1 ) + " or " + cNumericFieldNames( 2 ) );
 					ShowContinueError( "Must Be Entered. Check input value choices." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				} else if ( ! lNumericBlanks( 1 ) ) {
 					Compressor( CompNum ).SuperheatRatingType = RatedSuperheat;
 					Compressor( CompNum ).RatedSuperheat = Numbers( 1 );
@@ -4184,7 +5040,7 @@ namespace RefrigeratedCase {
 				if ( ( ( ! lNumericBlanks( 3 ) ) && ( ! lNumericBlanks( 4 ) ) ) || ( lNumericBlanks( 3 ) && lNumericBlanks( 4 ) ) ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Compressor( CompNum ).Name + "\" One, and Only One of " + cNumericFieldNames( 3 ) + " or " + cNumericFieldNames( 4 ) );
 					ShowContinueError( "Must Be Entered. Check input value choices." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				} else if ( ! lNumericBlanks( 3 ) ) {
 					Compressor( CompNum ).SubcoolRatingType = RatedLiquidTemperature;
 					Compressor( CompNum ).RatedSubcool = Numbers( 3 );
@@ -4202,12 +5058,12 @@ namespace RefrigeratedCase {
 					Compressor( CompNum ).TransElecPowerCurvePtr = GetCurveIndex( Alphas( 6 ) ); // convert curve name to number
 					if ( lAlphaBlanks( 6 ) && Compressor( CompNum ).TransElecPowerCurvePtr == 0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + '=' + Compressor( CompNum ).Name + ": " + cAlphaFieldNames( 6 ) + " not found." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 					Compressor( CompNum ).TransCapacityCurvePtr = GetCurveIndex( Alphas( 7 ) ); // convert curve name to number
 					if ( lAlphaBlanks( 7 ) && Compressor( CompNum ).TransCapacityCurvePtr == 0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + '=' + Compressor( CompNum ).Name + ": " + cAlphaFieldNames( 7 ) + " not found." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else if ( ( SameString( Alphas( 5 ), "Subcritical" ) ) || ( lAlphaBlanks( 5 ) ) ) { // Mode of Operation = Subcritical
 					Compressor( CompNum ).TransFlag = false;
@@ -4217,7 +5073,7 @@ namespace RefrigeratedCase {
 					}
 				} else { // Invalid Mode of Operation
 					ShowSevereError( RoutineName + CurrentModuleObject + ": " + cAlphaFieldNames( 5 ) + " for " + Compressor( CompNum ).Name + '=' + Alphas( 5 ) + " is invalid. Valid choices are \"Subcritical\" or \"Transcritical\"." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 			} // RefrigCompressor
@@ -4237,7 +5093,7 @@ namespace RefrigeratedCase {
 					if ( IsNotOK ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + ", has an invalid or undefined " + cAlphaFieldNames( 1 ) + "=\"" + Alphas( 1 ) + "\"." );
 						if ( IsBlank ) Alphas( 1 ) = "xxxxx";
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 					Subcooler( SubcoolerNum ).Name = Alphas( 1 );
 
@@ -4251,7 +5107,7 @@ namespace RefrigeratedCase {
 					} else {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Subcooler( SubcoolerNum ).Name + "\", " + cAlphaFieldNames( 2 ) + " not recognized = " + Alphas( 2 ) );
 						ShowContinueError( "Check input value choices." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} //Set Subcooler Type
 
 					{ auto const SELECT_CASE_var( Subcooler( SubcoolerNum ).SubcoolerType );
@@ -4261,25 +5117,25 @@ namespace RefrigeratedCase {
 						if ( ! lNumericBlanks( 1 ) ) Subcooler( SubcoolerNum ).LiqSuctDesignDelT = Numbers( 1 );
 						if ( Subcooler( SubcoolerNum ).LiqSuctDesignDelT < 0.0 ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Subcooler( SubcoolerNum ).Name + "\" " + cNumericFieldNames( 1 ) + " cannot be less than zero." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						}
 
 						if ( ! lNumericBlanks( 2 ) ) {
 							Subcooler( SubcoolerNum ).LiqSuctDesignTliqIn = Numbers( 2 );
 						} else {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Subcooler( SubcoolerNum ).Name + "\" " + cNumericFieldNames( 2 ) + " must be specified." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						}
 
 						if ( ! lNumericBlanks( 3 ) ) {
 							Subcooler( SubcoolerNum ).LiqSuctDesignTvapIn = Numbers( 3 );
 						} else {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Subcooler( SubcoolerNum ).Name + "\" " + cNumericFieldNames( 3 ) + " must be specified." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						}
 						if ( Subcooler( SubcoolerNum ).LiqSuctDesignTvapIn > Subcooler( SubcoolerNum ).LiqSuctDesignTliqIn ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Subcooler( SubcoolerNum ).Name + "\" " + cNumericFieldNames( 3 ) + " cannot be greater than " + cNumericFieldNames( 2 ) + '.' );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						} //error check
 
 					} else if ( SELECT_CASE_var == Mechanical ) {
@@ -4290,7 +5146,7 @@ namespace RefrigeratedCase {
 							Subcooler( SubcoolerNum ).MechControlTliqOut = Numbers( 4 );
 						} else {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Subcooler( SubcoolerNum ).Name + "\" " + cNumericFieldNames( 4 ) + " must be specified." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						} //error check
 
 					}}
@@ -4311,7 +5167,7 @@ namespace RefrigeratedCase {
 					if ( IsNotOK ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + ", has an invalid or undefined " + cAlphaFieldNames( 1 ) + "=\"" + Alphas( 1 ) + "\"." );
 						if ( IsBlank ) Alphas( 1 ) = "xxxxx";
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 
 					TransferLoadList( ListNum ).Name = Alphas( 1 );
@@ -4332,14 +5188,14 @@ namespace RefrigeratedCase {
 						if ( NumSimulationSecondarySystems > 0 ) LoadSecondaryNum = FindItemInList( Alphas( AlphaListNum ), Secondary );
 						if ( ( LoadCascadeNum == 0 ) && ( LoadSecondaryNum == 0 ) ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + cAlphaFieldNames( AlphaListNum ) + "\" : has an invalid value of " + Alphas( AlphaListNum ) );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						} else if ( ( LoadCascadeNum != 0 ) && ( LoadSecondaryNum != 0 ) ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + cAlphaFieldNames( AlphaListNum ) + "\" : has a non-unique name : " + Alphas( AlphaListNum ) );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						} else if ( LoadCascadeNum != 0 ) {
 							if ( Condenser( LoadCascadeNum ).CondenserType != RefrigCondenserTypeCascade ) {
 								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\" : has a condenser listed as a transfer load that is not a cascade condenser: " + Alphas( AlphaListNum ) );
-								ErrorsFound = true;
+								GetRefrigerationInputErrorsFound = true;
 							} else {
 								++NumCascadeLoadsOnList;
 								TransferLoadList( ListNum ).CascadeLoadItemNum( NumCascadeLoadsOnList ) = LoadCascadeNum;
@@ -4368,18 +5224,18 @@ namespace RefrigeratedCase {
 				if ( IsNotOK ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + ", has an invalid or undefined " + cAlphaFieldNames( 1 ) + "=\"" + Alphas( 1 ) + "\"." );
 					if ( IsBlank ) Alphas( 1 ) = "xxxxx";
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 				CompressorLists( ListNum ).Name = Alphas( 1 );
 				if ( ! allocated( CompressorLists( ListNum ).CompItemNum ) ) CompressorLists( ListNum ).CompItemNum.allocate( CompressorLists( ListNum ).NumCompressors );
 
-				for ( CompIndex = 1; CompIndex <= CompressorLists( ListNum ).NumCompressors; ++CompIndex ) {
-					AlphaListNum = CompIndex + 1; //same as do loop from 2 to end of list
+				for ( GetRefrigerationInputCompIndex = 1; GetRefrigerationInputCompIndex <= CompressorLists( ListNum ).NumCompressors; ++GetRefrigerationInputCompIndex ) {
+					AlphaListNum = GetRefrigerationInputCompIndex + 1; //same as do loop from 2 to end of list
 					if ( ! lAlphaBlanks( AlphaListNum ) ) {
-						CompressorLists( ListNum ).CompItemNum( CompIndex ) = FindItemInList( Alphas( AlphaListNum ), Compressor );
-						if ( CompressorLists( ListNum ).CompItemNum( CompIndex ) == 0 ) {
+						CompressorLists( ListNum ).CompItemNum( GetRefrigerationInputCompIndex ) = FindItemInList( Alphas( AlphaListNum ), Compressor );
+						if ( CompressorLists( ListNum ).CompItemNum( GetRefrigerationInputCompIndex ) == 0 ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + CompressorLists( ListNum ).Name + "\", has an invalid " + cAlphaFieldNames( AlphaListNum ) + " defined as " + Alphas( AlphaListNum ) );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						}
 					}
 				} //NumCompressors in CompressorList
@@ -4400,7 +5256,7 @@ namespace RefrigeratedCase {
 				if ( IsNotOK ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + ", has an invalid or undefined " + cAlphaFieldNames( 1 ) + "=\"" + Alphas( 1 ) + "\"." );
 					if ( IsBlank ) Alphas( 1 ) = "xxxxx";
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 				System( RefrigSysNum ).Name = Alphas( 1 );
 
@@ -4408,7 +5264,7 @@ namespace RefrigeratedCase {
 				if ( lAlphaBlanks( 2 ) && lAlphaBlanks( 3 ) ) {
 					//No cases, walkins, cascade loads, or secondary loops specified, ie, System has no load
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", has no loads, must have at least one of: " + cAlphaFieldNames( 2 ) + " or " + cAlphaFieldNames( 3 ) + " objects attached." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 				NumCases = 0;
 				System( RefrigSysNum ).NumCases = 0;
@@ -4449,7 +5305,7 @@ namespace RefrigeratedCase {
 					if ( CoilNum != 0 ) ++NumNameMatches;
 
 					if ( NumNameMatches != 1 ) { //name must uniquely point to a list or a single case or walkin or coil
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 						if ( NumNameMatches == 0 ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", has an invalid " + cAlphaFieldNames( AlphaNum ) + ": " + Alphas( AlphaNum ) );
 						} else if ( NumNameMatches > 1 ) {
@@ -4530,27 +5386,27 @@ namespace RefrigeratedCase {
 
 				if ( NumWalkIns > 0 ) {
 					for ( WalkInIndex = 1; WalkInIndex <= NumWalkIns; ++WalkInIndex ) {
-						WalkInID = System( RefrigSysNum ).WalkInNum( WalkInIndex );
+						GetRefrigerationInputWalkInID = System( RefrigSysNum ).WalkInNum( WalkInIndex );
 						//mark all WalkIns on rack as used by this system (checking for unused or non-unique WalkIns)
-						++WalkIn( WalkInID ).NumSysAttach;
-						NominalTotalWalkInCap += WalkIn( WalkInID ).DesignRatedCap;
-						System( RefrigSysNum ).RefInventory += WalkIn( WalkInID ).DesignRefrigInventory;
+						++WalkIn( GetRefrigerationInputWalkInID ).NumSysAttach;
+						NominalTotalWalkInCap += WalkIn( GetRefrigerationInputWalkInID ).DesignRatedCap;
+						System( RefrigSysNum ).RefInventory += WalkIn( GetRefrigerationInputWalkInID ).DesignRefrigInventory;
 						//Defrost capacity is treated differently by compressor racks and detailed systems,
 						//  so this value may be adjusted (or warnings issued) after the walkin is assigned
 						//  to either the rack or system.
 						//for walkins served by detailed system, need capacity for both fluid and electric types.
-						if ( WalkIn( WalkInID ).DefrostCapacity <= -98.0 ) {
+						if ( WalkIn( GetRefrigerationInputWalkInID ).DefrostCapacity <= -98.0 ) {
 							// - 99 used as a flag for blank input error message for detailed systems
-							ShowSevereError( RoutineName + "Refrigeration:WalkIn=\"" + WalkIn( WalkInID ).Name + "\", Defrost capacity must be greater than or equal to 0 W for electric and hotfluid defrost types" );
-							ErrorsFound = true;
+							ShowSevereError( RoutineName + "Refrigeration:WalkIn=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", Defrost capacity must be greater than or equal to 0 W for electric and hotfluid defrost types" );
+							GetRefrigerationInputErrorsFound = true;
 						}
 						// Find design evaporating temperature for system by getting min design evap for ALL loads
 						if ( ( WalkInIndex == 1 ) && ( System( RefrigSysNum ).NumCases == 0 ) && ( System( RefrigSysNum ).NumCoils == 0 ) ) {
 							//note use walk in index, not walkinid here to get
 							//first walkin on this suction group/system
-							System( RefrigSysNum ).TEvapDesign = WalkIn( WalkInID ).TEvapDesign;
+							System( RefrigSysNum ).TEvapDesign = WalkIn( GetRefrigerationInputWalkInID ).TEvapDesign;
 						} else {
-							System( RefrigSysNum ).TEvapDesign = min( WalkIn( WalkInID ).TEvapDesign, System( RefrigSysNum ).TEvapDesign );
+							System( RefrigSysNum ).TEvapDesign = min( WalkIn( GetRefrigerationInputWalkInID ).TEvapDesign, System( RefrigSysNum ).TEvapDesign );
 						}
 					} //WalkInIndex=1,NumWalkIns
 					System( RefrigSysNum ).NumNonCascadeLoads += System( RefrigSysNum ).NumWalkIns;
@@ -4563,18 +5419,18 @@ namespace RefrigeratedCase {
 
 					// Entry for Alphas(AlphaNum) can be either a Secondary, CascadeLoad name or a TransferLoadList name
 					TransferLoadListNum = 0;
-					SecondaryNum = 0;
+					GetRefrigerationInputSecondaryNum = 0;
 					CascadeLoadNum = 0;
 					if ( NumSimulationTransferLoadLists > 0 ) TransferLoadListNum = FindItemInList( Alphas( AlphaNum ), TransferLoadList );
-					if ( NumSimulationSecondarySystems > 0 ) SecondaryNum = FindItemInList( Alphas( AlphaNum ), Secondary );
+					if ( NumSimulationSecondarySystems > 0 ) GetRefrigerationInputSecondaryNum = FindItemInList( Alphas( AlphaNum ), Secondary );
 					if ( NumRefrigCondensers > 0 ) CascadeLoadNum = FindItemInList( Alphas( AlphaNum ), Condenser );
 					NumNameMatches = 0;
 					if ( TransferLoadListNum != 0 ) ++NumNameMatches;
-					if ( SecondaryNum != 0 ) ++NumNameMatches;
+					if ( GetRefrigerationInputSecondaryNum != 0 ) ++NumNameMatches;
 					if ( CascadeLoadNum != 0 ) ++NumNameMatches;
 
 					if ( NumNameMatches != 1 ) { //name must uniquely point to a list or a single transfer load
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 						if ( NumNameMatches == 0 ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", has an invalid " + cAlphaFieldNames( AlphaNum ) + ": " + Alphas( AlphaNum ) );
 						} else if ( NumNameMatches > 1 ) {
@@ -4589,11 +5445,11 @@ namespace RefrigeratedCase {
 						System( RefrigSysNum ).SecondaryNum( {1,NumSecondary} ) = TransferLoadList( TransferLoadListNum ).SecondaryItemNum( {1,NumSecondary} );
 						if ( ! allocated( System( RefrigSysNum ).CascadeLoadNum ) ) System( RefrigSysNum ).CascadeLoadNum.allocate( NumCascadeLoad );
 						System( RefrigSysNum ).CascadeLoadNum( {1,NumCascadeLoad} ) = TransferLoadList( TransferLoadListNum ).CascadeLoadItemNum( {1,NumCascadeLoad} );
-					} else if ( SecondaryNum != 0 ) { //Name points to a secondary loop load
+					} else if ( GetRefrigerationInputSecondaryNum != 0 ) { //Name points to a secondary loop load
 						NumSecondary = 1;
 						System( RefrigSysNum ).NumSecondarys = 1;
 						if ( ! allocated( System( RefrigSysNum ).SecondaryNum ) ) System( RefrigSysNum ).SecondaryNum.allocate( NumSecondary );
-						System( RefrigSysNum ).SecondaryNum( NumSecondary ) = SecondaryNum;
+						System( RefrigSysNum ).SecondaryNum( NumSecondary ) = GetRefrigerationInputSecondaryNum;
 					} else if ( CascadeLoadNum != 0 ) { //Name points to a cascade condenser load
 						NumCascadeLoad = 1;
 						System( RefrigSysNum ).NumCascadeLoads = 1;
@@ -4610,7 +5466,7 @@ namespace RefrigeratedCase {
 								if ( Secondary( SecondaryID ).CoilFlag ) System( RefrigSysNum ).CoilFlag = true;
 							} else if ( Secondary( SecondaryID ).CoilFlag != System( RefrigSysNum ).CoilFlag ) {
 								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", Serves an inconsistent mixture of loads. Coil-type loads are served on a different time step than case or walkin loads. Compare loads on system served by secondary loop \"" + Secondary( SecondaryID ).Name );
-								ErrorsFound = true;
+								GetRefrigerationInputErrorsFound = true;
 							} // check for consistency of loads (coils calc on sys time step, all others on zone time step)
 							//mark all Secondarys on system as used by this system (checking for unused or non-unique Secondarys)
 							++Secondary( SecondaryID ).NumSysAttach;
@@ -4636,7 +5492,7 @@ namespace RefrigeratedCase {
 							CondID = System( RefrigSysNum ).CascadeLoadNum( CascadeLoadIndex );
 							if ( Condenser( CondID ).CondenserType != RefrigCondenserTypeCascade ) {
 								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", has a  " + cAlphaFieldNames( AlphaNum ) + ": " + Alphas( AlphaNum ) + " cascade load that is not a cascade condenser." );
-								ErrorsFound = true;
+								GetRefrigerationInputErrorsFound = true;
 							}
 							// For a cascade condenser, need to identify the system absorbing the heat
 							Condenser( CondID ).CascadeSinkSystemID = RefrigSysNum;
@@ -4661,14 +5517,14 @@ namespace RefrigeratedCase {
 				if ( System( RefrigSysNum ).CoilFlag ) { //could already be true if serving secondary that serves coils
 					if ( ( System( RefrigSysNum ).NumCases > 0 ) || ( System( RefrigSysNum ).NumWalkIns > 0 ) ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", Serves an inconsistent mixture of loads. Coil-type loads are served on a different time step than case or walkin loads." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else { //no coils on secondary or no secondary
 					if ( System( RefrigSysNum ).NumCoils > 0 ) { //(note, coilflag set to .FALSE. for all systems as default above
 						System( RefrigSysNum ).CoilFlag = true;
 						if ( ( System( RefrigSysNum ).NumCases > 0 ) || ( System( RefrigSysNum ).NumWalkIns > 0 ) ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", Serves an inconsistent mixture of loads. Coil-type loads are served on a different time step than case or walkin loads." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						}
 					} // NumCoils > 0
 				} //Coil flag already true due to secondary coil loads
@@ -4685,7 +5541,7 @@ namespace RefrigeratedCase {
 				CondNum = FindItemInList( Alphas( AlphaNum ), Condenser );
 				if ( CondNum == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", has an invalid " + cAlphaFieldNames( AlphaNum ) + " defined as " + Alphas( AlphaNum ) );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				} else {
 					System( RefrigSysNum ).CondenserNum( NumCondensers ) = CondNum;
 					//Now take care of case where multiple systems share a condenser
@@ -4704,14 +5560,14 @@ namespace RefrigeratedCase {
 					}
 					if ( Condenser( CondNum ).RatedAirFlowRate <= 0.0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\", Evaporative Condenser Air Volume Flow Rate cannot be less than or equal to zero." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 					if ( Condenser( CondNum ).EvapPumpPower == AutoCalculate ) {
 						Condenser( CondNum ).EvapPumpPower = CondPumpRatePower * Condenser( CondNum ).RatedCapacity;
 					}
 					if ( Condenser( CondNum ).EvapPumpPower < 0.0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Condenser( CondNum ).Name + "\", Design Evaporative Condenser Water Pump Power cannot be less than zero." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 
@@ -4722,7 +5578,7 @@ namespace RefrigeratedCase {
 				if ( lAlphaBlanks( AlphaNum ) ) {
 					//blank input where must have compressor or compressor list input.
 					ShowSevereError( RoutineName + CurrentModuleObject + ' ' + cAlphaFieldNames( AlphaNum ) + "\" : must be input." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				} else { //     Entry for Alphas(AlphaNum) can be either a compressor name or a compressorlist name
 					if ( NumCompressorLists > 0 ) {
 						ListNum = FindItemInList( Alphas( AlphaNum ), CompressorLists );
@@ -4736,10 +5592,10 @@ namespace RefrigeratedCase {
 					}
 					if ( ( ListNum == 0 ) && ( CompNum == 0 ) ) { // name doesn't match either a compressor or a compressor list
 						ShowSevereError( RoutineName + CurrentModuleObject + ' ' + cAlphaFieldNames( AlphaNum ) + ", has an invalid or undefined value=\"" + Alphas( AlphaNum ) + "\"." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} else if ( ( ListNum != 0 ) && ( CompNum != 0 ) ) { //have compressor list and compressor with same name
 						ShowSevereError( RoutineName + CurrentModuleObject + ' ' + cAlphaFieldNames( AlphaNum ) + ", has a non-unique name used for both Compressor and CompressorList name: \"" + Alphas( AlphaNum ) + "\"." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} else if ( ListNum != 0 ) {
 						NumCompressorsSys = CompressorLists( ListNum ).NumCompressors;
 						System( RefrigSysNum ).NumCompressors = NumCompressorsSys;
@@ -4761,7 +5617,7 @@ namespace RefrigeratedCase {
 					}
 				} else {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", " + cNumericFieldNames( 1 ) + " must be defined." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 				if ( ( Condenser( CondNum ).CondenserType == RefrigCondenserTypeCascade ) && ( System( RefrigSysNum ).TCondenseMin > Condenser( CondNum ).RatedTCondense ) ) ShowWarningError( CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", The system specified minimum condensing temperature is greater than the rated condensing temperature for the cascade condenser. " );
 
@@ -4780,7 +5636,7 @@ namespace RefrigeratedCase {
 						} //coilflag
 					} else {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", invalid  " + cAlphaFieldNames( AlphaNum ) + " not found = " + Alphas( AlphaNum ) );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else {
 					System( RefrigSysNum ).CompSuctControl = ConstantSuctionTemperature; //Default for blank
@@ -4803,7 +5659,7 @@ namespace RefrigeratedCase {
 						System( RefrigSysNum ).SubcoolerNum( NumSubcooler ) = GetObjectItemNum( "Refrigeration:Subcooler", Alphas( AlphaNum ) );
 						if ( System( RefrigSysNum ).SubcoolerNum( NumSubcooler ) <= 0 ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", has an invalid " + cAlphaFieldNames( AlphaNum ) + " defined as \"" + Alphas( AlphaNum ) + "\"." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						} else {
 							Subcooler( System( RefrigSysNum ).SubcoolerNum( NumSubcooler ) ).CoilFlag = System( RefrigSysNum ).CoilFlag;
 						}
@@ -4813,7 +5669,7 @@ namespace RefrigeratedCase {
 						System( RefrigSysNum ).SubcoolerNum( NumSubcooler ) = GetObjectItemNum( "Refrigeration:Subcooler", Alphas( AlphaNum + 1 ) );
 						if ( System( RefrigSysNum ).SubcoolerNum( NumSubcooler ) <= 0 ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", has an invalid " + cAlphaFieldNames( AlphaNum + 1 ) + " defined as \"" + Alphas( AlphaNum + 1 ) + "\"." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						} else {
 							Subcooler( System( RefrigSysNum ).SubcoolerNum( NumSubcooler ) ).CoilFlag = System( RefrigSysNum ).CoilFlag;
 						}
@@ -4834,7 +5690,7 @@ namespace RefrigeratedCase {
 					System( RefrigSysNum ).SuctionPipeZoneNodeNum = GetSystemNodeNumberForZone( Alphas( AlphaNum ) );
 					if ( System( RefrigSysNum ).SuctionPipeZoneNodeNum == 0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", System Node Number not found for " + cAlphaFieldNames( AlphaNum ) + " = " + Alphas( AlphaNum ) + " even though " + cNumericFieldNames( 2 ) + " is greater than zero. Suction piping heat gain cannot be calculated unless a Zone is defined to deterimine the environmental temperature surrounding the piping." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} else {
 						RefrigPresentInZone( System( RefrigSysNum ).SuctionPipeActualZoneNum ) = true;
 					}
@@ -4852,7 +5708,7 @@ namespace RefrigeratedCase {
 					System( RefrigSysNum ).NumStages = Numbers( 3 );
 					if ( System( RefrigSysNum ).NumStages < 1 || System( RefrigSysNum ).NumStages > 2 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", " + cNumericFieldNames( 3 ) + " has an invalid value.  Only \"1\" or \"2\" compressor stages are allowed." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else {
 					System( RefrigSysNum ).NumStages = 1; //Default for blank
@@ -4872,7 +5728,7 @@ namespace RefrigeratedCase {
 					} else {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", Invalid " + cAlphaFieldNames( AlphaNum ) + " specified." );
 						ShowContinueError( "\"" + Alphas( AlphaNum ) + "\" is not a recognized intercooler type." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} else {
 					System( RefrigSysNum ).IntercoolerType = 0; //Default for blank
@@ -4882,12 +5738,12 @@ namespace RefrigeratedCase {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", A single-stage compression system" );
 					ShowContinueError( "has been specified with an intercooler.  Verify that the number of compressor stages" );
 					ShowContinueError( "and the intercooler type are consistent." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				} else if ( System( RefrigSysNum ).NumStages == 2 && System( RefrigSysNum ).IntercoolerType == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", A two-stage compression system" );
 					ShowContinueError( "has been specified without an intercooler.  Verify that the number of compressor stages" );
 					ShowContinueError( "and the intercooler type are consistent." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				// Shell-and-coil intercooler effectiveness
@@ -4910,16 +5766,16 @@ namespace RefrigeratedCase {
 					if ( lAlphaBlanks( AlphaNum ) ) {
 						//blank input where must have high-stage compressor or compressor list input.
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", " + cAlphaFieldNames( AlphaNum ) + " must be input for two-stage compression systems." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} else { //     Entry for Alphas(AlphaNum) can be either a compressor name or a compressorlist name
 						ListNum = FindItemInList( Alphas( AlphaNum ), CompressorLists );
 						CompNum = FindItemInList( Alphas( AlphaNum ), Compressor );
 						if ( ( ListNum == 0 ) && ( CompNum == 0 ) ) { // name doesn't match either a compressor or a compressor list
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", " + cAlphaFieldNames( AlphaNum ) + " has an invalid or undefined value=\"" + Alphas( AlphaNum ) + "\"." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						} else if ( ( ListNum != 0 ) && ( CompNum != 0 ) ) { //have compressor list and compressor with same name
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", " + cAlphaFieldNames( AlphaNum ) + " has a non-unique name used for both Compressor and CompressorList name: \"" + Alphas( AlphaNum ) + "\"." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						} else if ( ListNum != 0 ) {
 							NumHiStageCompressorsSys = CompressorLists( ListNum ).NumCompressors;
 							System( RefrigSysNum ).NumHiStageCompressors = NumHiStageCompressorsSys;
@@ -4944,8 +5800,8 @@ namespace RefrigeratedCase {
 
 				// Sum capacity of single-stage compressors or low-stage compressors if two-stage system
 				NominalTotalCompCap = 0.0;
-				for ( CompIndex = 1; CompIndex <= NumCompressorsSys; ++CompIndex ) {
-					CompNum = System( RefrigSysNum ).CompressorNum( CompIndex );
+				for ( GetRefrigerationInputCompIndex = 1; GetRefrigerationInputCompIndex <= NumCompressorsSys; ++GetRefrigerationInputCompIndex ) {
+					CompNum = System( RefrigSysNum ).CompressorNum( GetRefrigerationInputCompIndex );
 					if ( ! Compressor( CompNum ).TransFlag ) { //  Subcritical Compressor
 						if ( System( RefrigSysNum ).NumStages == 1 ) { //  Single-stage compression
 							Compressor( CompNum ).NomCap = CurveValue( Compressor( CompNum ).CapacityCurvePtr, System( RefrigSysNum ).TEvapDesign, Condenser( System( RefrigSysNum ).CondenserNum( 1 ) ).RatedTCondense );
@@ -4959,14 +5815,14 @@ namespace RefrigeratedCase {
 					} else { //  Transcritical compressor attached to subcritical refigeration cycle
 						ShowSevereError( RoutineName + CurrentModuleObject + ". A transcritical compressor is attached to a subcritical refrigeration system." );
 						ShowContinueError( "Check input to ensure that subcritical compressors are connected only to subcritical systems and transcritical compressors are connected only to transcritical systems." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} // .NOT. Compressor(CompNum)%TransFlag
 				}
 
 				// Sum capacity of high-stage compressors if two stage system
 				if ( System( RefrigSysNum ).NumStages == 2 ) {
-					for ( CompIndex = 1; CompIndex <= NumHiStageCompressorsSys; ++CompIndex ) {
-						CompNum = System( RefrigSysNum ).HiStageCompressorNum( CompIndex );
+					for ( GetRefrigerationInputCompIndex = 1; GetRefrigerationInputCompIndex <= NumHiStageCompressorsSys; ++GetRefrigerationInputCompIndex ) {
+						CompNum = System( RefrigSysNum ).HiStageCompressorNum( GetRefrigerationInputCompIndex );
 						if ( ! Compressor( CompNum ).TransFlag ) { //  Subcritical Compressor
 							Compressor( CompNum ).NomCap = CurveValue( Compressor( CompNum ).CapacityCurvePtr, System( RefrigSysNum ).TIntercooler, Condenser( System( RefrigSysNum ).CondenserNum( 1 ) ).RatedTCondense );
 							NominalTotalHiStageCompCap += Compressor( CompNum ).NomCap;
@@ -4974,7 +5830,7 @@ namespace RefrigeratedCase {
 						} else { //  Transcritical compressor attached to subcritical refigeration cycle
 							ShowSevereError( RoutineName + CurrentModuleObject + ". A transcritical compressor is attached to a subcritical refrigeration system." );
 							ShowContinueError( "Check input to ensure that subcritical compressors are connected only to subcritical systems and transcritical compressors are connected only to transcritical systems." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						}
 					}
 				} // NumStages
@@ -5001,8 +5857,8 @@ namespace RefrigeratedCase {
 				//assign flags to all condensers to match system below condenser (system rejecting heat to cascade condenser)
 				CondNum = System( RefrigSysNum ).CondenserNum( 1 ); // right now only have one condenser per system
 				Condenser( CondNum ).CoilFlag = System( RefrigSysNum ).CoilFlag;
-				for ( CompIndex = 1; CompIndex <= System( RefrigSysNum ).NumCompressors; ++CompIndex ) {
-					CompNum = System( RefrigSysNum ).CompressorNum( CompIndex );
+				for ( GetRefrigerationInputCompIndex = 1; GetRefrigerationInputCompIndex <= System( RefrigSysNum ).NumCompressors; ++GetRefrigerationInputCompIndex ) {
+					CompNum = System( RefrigSysNum ).CompressorNum( GetRefrigerationInputCompIndex );
 					Compressor( CompNum ).CoilFlag = System( RefrigSysNum ).CoilFlag;
 				}
 
@@ -5021,7 +5877,7 @@ namespace RefrigeratedCase {
 						if ( ! Condenser( CondID ).CoilFlag ) {
 							//would mean system already serving coil loads and this condenser cooling system with case-type loads
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", Serves an inconsistent mixture of loads. Coil-type loads are served on a different time step than case or walkin loads. Compare loads on system served by cascade condenser \"" + Condenser( CondID ).Name );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						}
 					} //CondID
 				} else { // %coilflag == false, so no coil loads prev identified directly or through secondary loop
@@ -5045,7 +5901,7 @@ namespace RefrigeratedCase {
 						} else { //numcascadeloadschecked > 1
 							if ( System( RefrigSysNum ).CoilFlag != Condenser( CondID ).CoilFlag ) {
 								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", Serves an inconsistent mixture of loads. Coil-type loads are served on a different time step than case or walkin loads. Compare loads on system served by cascade condenser \"" + Condenser( CondID ).Name );
-								ErrorsFound = true;
+								GetRefrigerationInputErrorsFound = true;
 							}
 						} //numcascadeloadschecked > 1
 					} // CondID
@@ -5062,11 +5918,11 @@ namespace RefrigeratedCase {
 				Subcooler( SubcoolerNum ).MechSourceSysID = GetObjectItemNum( "Refrigeration:System", Subcooler( SubcoolerNum ).MechSourceSys );
 				if ( Subcooler( SubcoolerNum ).MechSourceSysID == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Subcooler( SubcoolerNum ).Name + "\", Mechanical Subcooler has an invalid Source Refrigeration:System=\"" + Subcooler( SubcoolerNum ).MechSourceSys + "\"." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				} else {
 					if ( System( Subcooler( SubcoolerNum ).MechSourceSysID ).CoilFlag != Subcooler( SubcoolerNum ).CoilFlag ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + System( RefrigSysNum ).Name + "\", Serves an inconsistent mixture of loads. Coil-type loads are served on a different time step than case or walkin loads. Compare loads on system served by mechanical subcooler \"" + Subcooler( SubcoolerNum ).Name );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				} //error check
 			} // numsubcoolers
@@ -5096,7 +5952,7 @@ namespace RefrigeratedCase {
 				if ( IsNotOK ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + ", has an invalid or undefined " + cAlphaFieldNames( 1 ) + "=\"" + Alphas( 1 ) + "\"." );
 					if ( IsBlank ) Alphas( 1 ) = "xxxxx";
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 				TransSystem( TransRefrigSysNum ).Name = Alphas( 1 );
 
@@ -5110,7 +5966,7 @@ namespace RefrigeratedCase {
 					// No system type specified
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + TransSystem( TransRefrigSysNum ).Name + "\", has no system type specified." );
 					ShowContinueError( "  System type must be specified as \"SingleStage\" or \"TwoStage\"." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 				if ( SameString( Alphas( 2 ), "SingleStage" ) ) {
 					TransSystem( TransRefrigSysNum ).TransSysType = 1;
@@ -5119,7 +5975,7 @@ namespace RefrigeratedCase {
 				} else {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + TransSystem( TransRefrigSysNum ).Name + "\", has an incorrect System Type specified as \"" + Alphas( 2 ) + "\"." );
 					ShowContinueError( "  System type must be specified as \"SingleStage\" or \"TwoStage\"." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				// Read all loads (display cases and walk-ins) on this Transcritical System
@@ -5127,17 +5983,17 @@ namespace RefrigeratedCase {
 					// No loads specified - display error
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + TransSystem( TransRefrigSysNum ).Name + "\", has no loads." );
 					ShowContinueError( "  The system must have at least one of: " + cAlphaFieldNames( 3 ) + " or " + cAlphaFieldNames( 4 ) + " objects attached." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				} else if ( lAlphaBlanks( 3 ) && TransSystem( TransRefrigSysNum ).TransSysType == 1 ) {
 					// No medium temperature loads specified for a SingleStage system - display error
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + TransSystem( TransRefrigSysNum ).Name + "\", is a \"SingleStage\" system but no medium temperature loads are specified." );
 					ShowContinueError( "  The system must have at least one " + cAlphaFieldNames( 3 ) + " object attached." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				} else if ( lAlphaBlanks( 4 ) && TransSystem( TransRefrigSysNum ).TransSysType == 2 ) {
 					// No low temperature loads specified for a TwoStage system - display error
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + TransSystem( TransRefrigSysNum ).Name + "\", is a \"TwoStage\" system but no low temperature loads are specified." );
 					ShowContinueError( "  The system must have at least one " + cAlphaFieldNames( 4 ) + " object attached." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				NumCasesMT = 0;
@@ -5173,7 +6029,7 @@ namespace RefrigeratedCase {
 					if ( WalkInNum != 0 ) ++NumNameMatches;
 
 					if ( NumNameMatches != 1 ) { //name must uniquely point to a list or a single case or walkin or coil
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 						if ( NumNameMatches == 0 ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + TransSystem( TransRefrigSysNum ).Name + "\", has an invalid " + cAlphaFieldNames( AlphaNum ) + ": " + Alphas( AlphaNum ) );
 						} else if ( NumNameMatches > 1 ) {
@@ -5224,27 +6080,27 @@ namespace RefrigeratedCase {
 
 				if ( NumWalkInsMT > 0 ) {
 					for ( WalkInIndex = 1; WalkInIndex <= NumWalkInsMT; ++WalkInIndex ) {
-						WalkInID = TransSystem( TransRefrigSysNum ).WalkInNumMT( WalkInIndex );
+						GetRefrigerationInputWalkInID = TransSystem( TransRefrigSysNum ).WalkInNumMT( WalkInIndex );
 						//mark all WalkIns on rack as used by this system (checking for unused or non-unique WalkIns)
-						++WalkIn( WalkInID ).NumSysAttach;
-						NominalTotalWalkInCapMT += WalkIn( WalkInID ).DesignRatedCap;
-						TransSystem( TransRefrigSysNum ).RefInventory += WalkIn( WalkInID ).DesignRefrigInventory;
+						++WalkIn( GetRefrigerationInputWalkInID ).NumSysAttach;
+						NominalTotalWalkInCapMT += WalkIn( GetRefrigerationInputWalkInID ).DesignRatedCap;
+						TransSystem( TransRefrigSysNum ).RefInventory += WalkIn( GetRefrigerationInputWalkInID ).DesignRefrigInventory;
 						//Defrost capacity is treated differently by compressor racks and detailed systems,
 						//  so this value may be adjusted (or warnings issued) after the walkin is assigned
 						//  to either the rack or system.
 						//for walkins served by detailed system, need capacity for both fluid and electric types.
-						if ( WalkIn( WalkInID ).DefrostCapacity <= -98.0 ) {
+						if ( WalkIn( GetRefrigerationInputWalkInID ).DefrostCapacity <= -98.0 ) {
 							// - 99 used as a flag for blank input error message for detailed systems
-							ShowSevereError( RoutineName + "Refrigeration:WalkIn=\"" + WalkIn( WalkInID ).Name + "\", Defrost capacity must be greater than or equal to 0 W for electric and hotfluid defrost types" );
-							ErrorsFound = true;
+							ShowSevereError( RoutineName + "Refrigeration:WalkIn=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", Defrost capacity must be greater than or equal to 0 W for electric and hotfluid defrost types" );
+							GetRefrigerationInputErrorsFound = true;
 						}
 						// Find design evaporating temperature for system by getting min design evap for ALL loads
 						if ( ( WalkInIndex == 1 ) && ( TransSystem( TransRefrigSysNum ).NumCasesMT == 0 ) ) {
 							//note use walk in index, not walkinid here to get
 							//first walkin on this suction group/system
-							TransSystem( TransRefrigSysNum ).TEvapDesignMT = WalkIn( WalkInID ).TEvapDesign;
+							TransSystem( TransRefrigSysNum ).TEvapDesignMT = WalkIn( GetRefrigerationInputWalkInID ).TEvapDesign;
 						} else {
-							TransSystem( TransRefrigSysNum ).TEvapDesignMT = min( WalkIn( WalkInID ).TEvapDesign, TransSystem( TransRefrigSysNum ).TEvapDesignMT );
+							TransSystem( TransRefrigSysNum ).TEvapDesignMT = min( WalkIn( GetRefrigerationInputWalkInID ).TEvapDesign, TransSystem( TransRefrigSysNum ).TEvapDesignMT );
 						}
 					} //WalkInIndex=1,NumWalkIns
 				} //NumWalkInsMT > 0
@@ -5266,7 +6122,7 @@ namespace RefrigeratedCase {
 					if ( WalkInNum != 0 ) ++NumNameMatches;
 
 					if ( NumNameMatches != 1 ) { //name must uniquely point to a list or a single case or walkin or coil
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 						if ( NumNameMatches == 0 ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + TransSystem( TransRefrigSysNum ).Name + "\", has an invalid " + cAlphaFieldNames( AlphaNum ) + ": " + Alphas( AlphaNum ) );
 						} else if ( NumNameMatches > 1 ) {
@@ -5317,27 +6173,27 @@ namespace RefrigeratedCase {
 
 				if ( NumWalkInsLT > 0 ) {
 					for ( WalkInIndex = 1; WalkInIndex <= NumWalkInsLT; ++WalkInIndex ) {
-						WalkInID = TransSystem( TransRefrigSysNum ).WalkInNumLT( WalkInIndex );
+						GetRefrigerationInputWalkInID = TransSystem( TransRefrigSysNum ).WalkInNumLT( WalkInIndex );
 						//mark all WalkIns on rack as used by this system (checking for unused or non-unique WalkIns)
-						++WalkIn( WalkInID ).NumSysAttach;
-						NominalTotalWalkInCapLT += WalkIn( WalkInID ).DesignRatedCap;
-						TransSystem( TransRefrigSysNum ).RefInventory += WalkIn( WalkInID ).DesignRefrigInventory;
+						++WalkIn( GetRefrigerationInputWalkInID ).NumSysAttach;
+						NominalTotalWalkInCapLT += WalkIn( GetRefrigerationInputWalkInID ).DesignRatedCap;
+						TransSystem( TransRefrigSysNum ).RefInventory += WalkIn( GetRefrigerationInputWalkInID ).DesignRefrigInventory;
 						//Defrost capacity is treated differently by compressor racks and detailed systems,
 						//  so this value may be adjusted (or warnings issued) after the walkin is assigned
 						//  to either the rack or system.
 						//for walkins served by detailed system, need capacity for both fluid and electric types.
-						if ( WalkIn( WalkInID ).DefrostCapacity <= -98.0 ) {
+						if ( WalkIn( GetRefrigerationInputWalkInID ).DefrostCapacity <= -98.0 ) {
 							// - 99 used as a flag for blank input error message for detailed systems
-							ShowSevereError( RoutineName + "Refrigeration:WalkIn=\"" + WalkIn( WalkInID ).Name + "\", Defrost capacity must be greater than or equal to 0 W for electric and hotfluid defrost types" );
-							ErrorsFound = true;
+							ShowSevereError( RoutineName + "Refrigeration:WalkIn=\"" + WalkIn( GetRefrigerationInputWalkInID ).Name + "\", Defrost capacity must be greater than or equal to 0 W for electric and hotfluid defrost types" );
+							GetRefrigerationInputErrorsFound = true;
 						}
 						// Find design evaporating temperature for system by getting min design evap for ALL loads
 						if ( ( WalkInIndex == 1 ) && ( TransSystem( TransRefrigSysNum ).NumCasesLT == 0 ) ) {
 							//note use walk in index, not walkinid here to get
 							//first walkin on this suction group/system
-							TransSystem( TransRefrigSysNum ).TEvapDesignLT = WalkIn( WalkInID ).TEvapDesign;
+							TransSystem( TransRefrigSysNum ).TEvapDesignLT = WalkIn( GetRefrigerationInputWalkInID ).TEvapDesign;
 						} else {
-							TransSystem( TransRefrigSysNum ).TEvapDesignLT = min( WalkIn( WalkInID ).TEvapDesign, TransSystem( TransRefrigSysNum ).TEvapDesignLT );
+							TransSystem( TransRefrigSysNum ).TEvapDesignLT = min( WalkIn( GetRefrigerationInputWalkInID ).TEvapDesign, TransSystem( TransRefrigSysNum ).TEvapDesignLT );
 						}
 					} //WalkInIndex=1,NumWalkIns
 				} //NumWalkInsMT > 0
@@ -5355,7 +6211,7 @@ namespace RefrigeratedCase {
 
 				if ( GCNum == 0 ) { //  Invalid Gas Cooler attached to Transcritical Refrigeration System
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + TransSystem( TransRefrigSysNum ).Name + "\", has an invalid " + cAlphaFieldNames( AlphaNum ) + " defined as \"" + Alphas( AlphaNum ) + "\"." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				} else if ( GCNum != 0 ) { //  Gas Cooler attached to Transcritical Refrigeration System
 					TransSystem( TransRefrigSysNum ).GasCoolerNum( NumGasCoolers ) = GCNum;
 					TransSystem( TransRefrigSysNum ).NumGasCoolers = 1;
@@ -5372,16 +6228,16 @@ namespace RefrigeratedCase {
 				if ( lAlphaBlanks( AlphaNum ) ) {
 					//blank input where must have compressor or compressor list input.
 					ShowSevereError( RoutineName + CurrentModuleObject + ' ' + cAlphaFieldNames( AlphaNum ) + "\" : must be input." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				} else { //     Entry for Alphas(AlphaNum) can be either a compressor name or a compressorlist name
 					ListNum = FindItemInList( Alphas( AlphaNum ), CompressorLists );
 					CompNum = FindItemInList( Alphas( AlphaNum ), Compressor );
 					if ( ( ListNum == 0 ) && ( CompNum == 0 ) ) { // name doesn't match either a compressor or a compressor list
 						ShowSevereError( RoutineName + CurrentModuleObject + ", \"" + cAlphaFieldNames( AlphaNum ) + "\", has an invalid or undefined value=\"" + Alphas( AlphaNum ) + "\"." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} else if ( ( ListNum != 0 ) && ( CompNum != 0 ) ) { //have compressor list and compressor with same name
 						ShowSevereError( RoutineName + CurrentModuleObject + ' ' + cAlphaFieldNames( AlphaNum ) + ", has a non-unique name used for both Compressor and CompressorList name: \"" + Alphas( AlphaNum ) + "\"." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} else if ( ListNum != 0 ) {
 						NumCompressorsSys = CompressorLists( ListNum ).NumCompressors;
 						TransSystem( TransRefrigSysNum ).NumCompressorsHP = NumCompressorsSys;
@@ -5395,8 +6251,8 @@ namespace RefrigeratedCase {
 					}
 					// Sum rated capacity of all HP compressors on system
 					NominalTotalCompCapHP = 0.0;
-					for ( CompIndex = 1; CompIndex <= NumCompressorsSys; ++CompIndex ) {
-						CompNum = TransSystem( TransRefrigSysNum ).CompressorNumHP( CompIndex );
+					for ( GetRefrigerationInputCompIndex = 1; GetRefrigerationInputCompIndex <= NumCompressorsSys; ++GetRefrigerationInputCompIndex ) {
+						CompNum = TransSystem( TransRefrigSysNum ).CompressorNumHP( GetRefrigerationInputCompIndex );
 
 						if ( Compressor( CompNum ).TransFlag ) { //  Calculate nominal capacity of transcritical Compressor
 							GCOutletH = GetSupHeatEnthalpyRefrig( TransSystem( TransRefrigSysNum ).RefrigerantName, GasCooler( TransSystem( TransRefrigSysNum ).GasCoolerNum( 1 ) ).RatedOutletT, GasCooler( TransSystem( TransRefrigSysNum ).GasCoolerNum( 1 ) ).RatedOutletP, RefrigIndex, RoutineNameNoColon );
@@ -5405,7 +6261,7 @@ namespace RefrigeratedCase {
 							++Compressor( CompNum ).NumSysAttach;
 						} else { //  Subcritical compressor attached to transcritical system - show error
 							ShowSevereError( RoutineName + CurrentModuleObject + ", No transcritical CO2 compressors are attached to the transcritical refrigeration system, \"" + TransSystem( TransRefrigSysNum ).Name + "\"." );
-							ErrorsFound = true;
+							GetRefrigerationInputErrorsFound = true;
 						}
 					}
 				}
@@ -5416,7 +6272,7 @@ namespace RefrigeratedCase {
 				if ( ( lAlphaBlanks( AlphaNum ) ) && ( TransSystem( TransRefrigSysNum ).TransSysType == 2 ) ) {
 					// TwoStage system type is specified but low pressure compressor input is blank
 					ShowSevereError( RoutineName + CurrentModuleObject + ", The transcritical refrigeration system, \"" + TransSystem( TransRefrigSysNum ).Name + "\", is specified to be \"TwoStage\", however, the \"" + cAlphaFieldNames( AlphaNum ) + "\" is not given." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				} else if ( ( ! ( lAlphaBlanks( AlphaNum ) ) ) && ( TransSystem( TransRefrigSysNum ).TransSysType == 1 ) ) {
 					// SingleStage system type with low pressure compressors specified. Ignore low pressure compressors
 					ShowWarningError( RoutineName + CurrentModuleObject + ", The transcritical refrigeration system, \"" + TransSystem( TransRefrigSysNum ).Name + "\", is specified to be \"SingleStage\", however, a\"" + cAlphaFieldNames( AlphaNum ) + "\" was found.  The low pressure compressors will be ignored and will not simulated." );
@@ -5426,10 +6282,10 @@ namespace RefrigeratedCase {
 					CompNum = FindItemInList( Alphas( AlphaNum ), Compressor );
 					if ( ( ListNum == 0 ) && ( CompNum == 0 ) ) { // name doesn't match either a compressor or a compressor list
 						ShowSevereError( RoutineName + CurrentModuleObject + ", \"" + cAlphaFieldNames( AlphaNum ) + "\", has an invalid or undefined value=\"" + Alphas( AlphaNum ) + "\"." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} else if ( ( ListNum != 0 ) && ( CompNum != 0 ) ) { //have compressor list and compressor with same name
 						ShowSevereError( RoutineName + CurrentModuleObject + ' ' + cAlphaFieldNames( AlphaNum ) + ", has a non-unique name used for both Compressor and CompressorList name: \"" + Alphas( AlphaNum ) + "\"." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} else if ( ListNum != 0 ) {
 						NumCompressorsSys = CompressorLists( ListNum ).NumCompressors;
 						TransSystem( TransRefrigSysNum ).NumCompressorsLP = NumCompressorsSys;
@@ -5443,8 +6299,8 @@ namespace RefrigeratedCase {
 					}
 					// Sum rated capacity of all LP compressors on system
 					NominalTotalCompCapLP = 0.0;
-					for ( CompIndex = 1; CompIndex <= NumCompressorsSys; ++CompIndex ) {
-						CompNum = TransSystem( TransRefrigSysNum ).CompressorNumLP( CompIndex );
+					for ( GetRefrigerationInputCompIndex = 1; GetRefrigerationInputCompIndex <= NumCompressorsSys; ++GetRefrigerationInputCompIndex ) {
+						CompNum = TransSystem( TransRefrigSysNum ).CompressorNumLP( GetRefrigerationInputCompIndex );
 						if ( TransSystem( TransRefrigSysNum ).TransSysType == 2 ) { //  Calculate capacity of LP compressors
 							Compressor( CompNum ).NomCap = CurveValue( Compressor( CompNum ).CapacityCurvePtr, TransSystem( TransRefrigSysNum ).TEvapDesignLT, TransSystem( TransRefrigSysNum ).TEvapDesignMT );
 							NominalTotalCompCapLP += Compressor( CompNum ).NomCap;
@@ -5472,7 +6328,7 @@ namespace RefrigeratedCase {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + TransSystem( TransRefrigSysNum ).Name + ": The receiver temperature (" + RoundSigDigits( TransSystem( TransRefrigSysNum ).TReceiver, 2 ) + "C) is less than the design evaporator temperature for the low temperature loads (" + RoundSigDigits( TransSystem( TransRefrigSysNum ).TEvapDesignLT, 2 ) + "C)." );
 						ShowContinueError( "  Ensure that the receiver temperature is sufficiently greater than the design evaporator temperature for the low temperature loads." );
 						ShowContinueError( "  A receiver pressure between 3.0 MPa to 4.0 MPa will typically result in an adequate receiver temperature." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 				if ( NominalTotalCompCapHP > 0.0 ) {
@@ -5480,7 +6336,7 @@ namespace RefrigeratedCase {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + TransSystem( TransRefrigSysNum ).Name + ": The receiver temperature (" + RoundSigDigits( TransSystem( TransRefrigSysNum ).TReceiver, 2 ) + "C) is less than the design evaporator temperature for the medium temperature loads (" + RoundSigDigits( TransSystem( TransRefrigSysNum ).TEvapDesignMT, 2 ) + "C)." );
 						ShowContinueError( "  Ensure that the receiver temperature is sufficiently greater than the design evaporator temperature for the medium temperature loads." );
 						ShowContinueError( "  A receiver pressure between 3.0 MPa to 4.0 MPa will typically result in an adequate receiver temperature." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					}
 				}
 
@@ -5493,7 +6349,7 @@ namespace RefrigeratedCase {
 				// Check subcooler effectiveness value, must be value between 0 and 1
 				if ( ( TransSystem( TransRefrigSysNum ).SCEffectiveness < 0 ) || ( TransSystem( TransRefrigSysNum ).SCEffectiveness > 1 ) ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + TransSystem( TransRefrigSysNum ).Name + ": The value for subcooler effectivness is invalid.  The subcooler effectivenss must be a value greater than or equal to zero and less than or equal to one." );
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 
 				//Suction piping heat gain - optional
@@ -5511,7 +6367,7 @@ namespace RefrigeratedCase {
 					if ( TransSystem( TransRefrigSysNum ).SuctionPipeZoneNodeNumMT == 0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + TransSystem( TransRefrigSysNum ).Name + "\", System Node Number not found for " + cAlphaFieldNames( AlphaNum ) + " = \"" + Alphas( AlphaNum ) + "\" even though " + cNumericFieldNames( 3 ) + " is greater than zero." );
 						ShowContinueError( "  The medium temperature suction piping heat gain cannot be calculated unless a Zone is defined to deterimine the environmental temperature surrounding the piping." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} else {
 						RefrigPresentInZone( TransSystem( TransRefrigSysNum ).SuctionPipeActualZoneNumMT ) = true;
 					}
@@ -5531,7 +6387,7 @@ namespace RefrigeratedCase {
 					if ( TransSystem( TransRefrigSysNum ).SuctionPipeZoneNodeNumLT == 0 ) {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + TransSystem( TransRefrigSysNum ).Name + "\", System Node Number not found for " + cAlphaFieldNames( AlphaNum ) + " = \"" + Alphas( AlphaNum ) + "\" even though " + cNumericFieldNames( 4 ) + " is greater than zero." );
 						ShowContinueError( "  The low temperature suction piping heat gain cannot be calculated unless a Zone is defined to deterimine the environmental temperature surrounding the piping." );
-						ErrorsFound = true;
+						GetRefrigerationInputErrorsFound = true;
 					} else {
 						RefrigPresentInZone( TransSystem( TransRefrigSysNum ).SuctionPipeActualZoneNumLT ) = true;
 					}
@@ -5581,7 +6437,7 @@ namespace RefrigeratedCase {
 				if ( TempRAFraction > 1.0 ) {
 					ShowSevereError( RoutineName + ": Refrigeration:Case, Refrigerated case return air fraction for all cases in zone=\"" + CaseRAFraction( ZoneIndex ).ZoneName + "\" is greater than 1.0." );
 					//check in comment, can't use "currentModuleObject" because not in get input subroutine where that is known
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 				}
 			} //ZoneIndex=1,NumOfZones
 
@@ -5600,7 +6456,7 @@ namespace RefrigeratedCase {
 					} //display extra warnings - give a list of unused cases
 				} //unused case
 				if ( RefrigCase( CaseNum ).NumSysAttach > 1 ) {
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 					ShowSevereError( RoutineName + ": Refrigeration:Case=\"" + RefrigCase( CaseNum ).Name + "\", Same refrigerated case name referenced " );
 					ShowContinueError( " by more than one refrigeration system and/or compressor rack." );
 				} // if looking for same case attached to multiple systems/racks
@@ -5631,7 +6487,7 @@ namespace RefrigeratedCase {
 					} //display extra warnings - give a list of unused compressors
 				} //unused compressor
 				if ( Compressor( CompNum ).NumSysAttach > 1 ) {
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 					ShowSevereError( RoutineName + ": Refrigeration:Compressor=\"" + Compressor( CompNum ).Name + "\", Same refrigeration compressor name referenced" );
 					ShowContinueError( " by more than one refrigeration system." );
 				} // looking for same compressor attached to multiple systems/racks
@@ -5661,7 +6517,7 @@ namespace RefrigeratedCase {
 					} //display extra warnings - give a list of unused WalkIns
 				} //unused walkin
 				if ( WalkIn( WalkInNum ).NumSysAttach > 1 ) {
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 					ShowSevereError( RoutineName + ": Refrigeration:WalkIn=\"" + WalkIn( WalkInNum ).Name + "\", Same Refrigeration WalkIn name referenced" );
 					ShowContinueError( " by more than one refrigeration system and/or compressor rack." );
 				} // if looking for same walk in attached to multiple systems/racks
@@ -5692,7 +6548,7 @@ namespace RefrigeratedCase {
 					} //display extra warnings - give a list of unused chillers
 				} //unused chiller
 				if ( WarehouseCoil( CoilNum ).NumSysAttach > 1 ) {
-					ErrorsFound = true;
+					GetRefrigerationInputErrorsFound = true;
 					ShowSevereError( RoutineName + ": Refrigeration:AirChiller=\"" + WarehouseCoil( CoilNum ).Name + "\", Same Refrigeration Air Chiller name referenced" );
 					ShowContinueError( " by more than one refrigeration system and/or compressor rack." );
 				} // if looking for same walk in attached to multiple systems/racks
@@ -5713,18 +6569,18 @@ namespace RefrigeratedCase {
 			//check for refrigeration Secondarys not connected to detailed systems and
 			//  refrigeration Secondarys connected more than once
 			NumUnusedSecondarys = 0;
-			for ( SecondaryNum = 1; SecondaryNum <= NumSimulationSecondarySystems; ++SecondaryNum ) {
-				if ( Secondary( SecondaryNum ).NumSysAttach == 1 ) continue;
-				if ( Secondary( SecondaryNum ).NumSysAttach < 1 ) {
+			for ( GetRefrigerationInputSecondaryNum = 1; GetRefrigerationInputSecondaryNum <= NumSimulationSecondarySystems; ++GetRefrigerationInputSecondaryNum ) {
+				if ( Secondary( GetRefrigerationInputSecondaryNum ).NumSysAttach == 1 ) continue;
+				if ( Secondary( GetRefrigerationInputSecondaryNum ).NumSysAttach < 1 ) {
 					++NumUnusedSecondarys;
 					if ( DisplayExtraWarnings ) {
 						//  individual secondary names listed if DisplayExtraWarnings option selected
-						ShowWarningError( RoutineName + ": Refrigeration:Secondary=\"" + Secondary( SecondaryNum ).Name + "\" unused. " );
+						ShowWarningError( RoutineName + ": Refrigeration:Secondary=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\" unused. " );
 					} //display extra warnings - give a list of unused Secondaries
 				} //unused secondary
-				if ( Secondary( SecondaryNum ).NumSysAttach > 1 ) {
-					ErrorsFound = true;
-					ShowSevereError( RoutineName + ": Refrigeration:Secondary=\"" + Secondary( SecondaryNum ).Name + "\", Same Refrigeration Secondary name referenced" );
+				if ( Secondary( GetRefrigerationInputSecondaryNum ).NumSysAttach > 1 ) {
+					GetRefrigerationInputErrorsFound = true;
+					ShowSevereError( RoutineName + ": Refrigeration:Secondary=\"" + Secondary( GetRefrigerationInputSecondaryNum ).Name + "\", Same Refrigeration Secondary name referenced" );
 					ShowContinueError( "   by more than one refrigeration system" );
 				} // looking for same secondary loop attached to multiple systems/racks
 			} //NumSimulationSecondarys
@@ -5797,10 +6653,38 @@ namespace RefrigeratedCase {
 			} //NumUnusedGasCoolers and displayextra warnings
 		} //NumSimulationGasCooler > 0
 
+		// List the zones whose air state is shared by the cases and walk-in doors located in them
+		if ( HaveCasesOrWalkins ) {
+			RefrigZoneAir.allocate( NumOfZones );
+			for ( CaseNum = 1; CaseNum <= NumSimulationCases; ++CaseNum ) {
+				GetRefrigerationInputZoneNum = RefrigCase( CaseNum ).ActualZoneNum;
+				if ( GetRefrigerationInputZoneNum <= 0 ) continue;
+				RefrigZoneAir( GetRefrigerationInputZoneNum ).ZoneNodeNum = RefrigCase( CaseNum ).ZoneNodeNum;
+				RefrigZoneAir( GetRefrigerationInputZoneNum ).HasCases = true;
+			}
+			for ( GetRefrigerationInputWalkInID = 1; GetRefrigerationInputWalkInID <= NumSimulationWalkIns; ++GetRefrigerationInputWalkInID ) {
+				for ( ZoneID = 1; ZoneID <= WalkIn( GetRefrigerationInputWalkInID ).NumZones; ++ZoneID ) {
+					GetRefrigerationInputZoneNum = WalkIn( GetRefrigerationInputWalkInID ).ZoneNum( ZoneID );
+					if ( GetRefrigerationInputZoneNum <= 0 ) continue;
+					if ( WalkIn( GetRefrigerationInputWalkInID ).AreaStockDr( ZoneID ) <= 0.0 && WalkIn( GetRefrigerationInputWalkInID ).AreaGlassDr( ZoneID ) <= 0.0 ) continue;
+					RefrigZoneAir( GetRefrigerationInputZoneNum ).ZoneNodeNum = WalkIn( GetRefrigerationInputWalkInID ).ZoneNodeNum( ZoneID );
+					RefrigZoneAir( GetRefrigerationInputZoneNum ).HasWalkInDoors = true;
+				}
+			}
+			RefrigZoneAirList.allocate( NumOfZones );
+			NumRefrigZoneAirs = 0;
+			for ( GetRefrigerationInputZoneNum = 1; GetRefrigerationInputZoneNum <= NumOfZones; ++GetRefrigerationInputZoneNum ) {
+				if ( RefrigZoneAir( GetRefrigerationInputZoneNum ).HasCases || RefrigZoneAir( GetRefrigerationInputZoneNum ).HasWalkInDoors ) {
+					++NumRefrigZoneAirs;
+					RefrigZoneAirList( NumRefrigZoneAirs ) = GetRefrigerationInputZoneNum;
+				}
+			}
+		}
+
 		//echo input to eio file.
 		ReportRefrigerationComponents();
 
-		if ( ErrorsFound ) {
+		if ( GetRefrigerationInputErrorsFound ) {
 			ShowFatalError( RoutineName + " Previous errors cause program termination" );
 		}
 
@@ -5855,76 +6739,63 @@ namespace RefrigeratedCase {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		// LOGICAL, SAVE :: MyBeginEnvrnFlag = .TRUE.
 		// INTEGER       :: SystemID
-		static int CaseNum( 0 );
-		static int CoilNum( 0 );
-		static int SecondNum( 0 );
-		static int WalkInNum( 0 );
-		static int RackNum( 0 );
-		static int RefrigSysNum( 0 );
-		static int CompNum( 0 );
-		static int CompIndex( 0 );
-		static int CondNum( 0 );
-		static int GCNum( 0 );
-		static int SubcoolNum( 0 );
-		static int ZoneID( 0 );
-		static std::string Walkin_and_zone_name; // concat name for walk-in/zone credit reporting
 
 		if ( NumSimulationCases > 0 ) {
 			// Setup Report Variables for simulated Refrigerated Case (do not report unused cases)
 			// CurrentModuleObject='Refrigeration:Case'
-			for ( CaseNum = 1; CaseNum <= NumSimulationCases; ++CaseNum ) {
-				if ( RefrigCase( CaseNum ).NumSysAttach == 1 ) {
-					SetupOutputVariable( "Refrigeration Case Evaporator Total Cooling Rate [W]", RefrigCase( CaseNum ).TotalCoolingLoad, "Zone", "Average", RefrigCase( CaseNum ).Name );
-					SetupOutputVariable( "Refrigeration Case Evaporator Total Cooling Energy [J]", RefrigCase( CaseNum ).TotalCoolingEnergy, "Zone", "Sum", RefrigCase( CaseNum ).Name, _, "ENERGYTRANSFER", "REFRIGERATION", _, "Building", RefrigCase( CaseNum ).ZoneName );
-					SetupOutputVariable( "Refrigeration Case Evaporator Sensible Cooling Rate [W]", RefrigCase( CaseNum ).SensCoolingEnergyRate, "Zone", "Average", RefrigCase( CaseNum ).Name );
-					SetupOutputVariable( "Refrigeration Case Evaporator Sensible Cooling Energy [J]", RefrigCase( CaseNum ).SensCoolingEnergy, "Zone", "Sum", RefrigCase( CaseNum ).Name );
-					SetupOutputVariable( "Refrigeration Case Evaporator Latent Cooling Rate [W]", RefrigCase( CaseNum ).LatCoolingEnergyRate, "Zone", "Average", RefrigCase( CaseNum ).Name );
-					SetupOutputVariable( "Refrigeration Case Evaporator Latent Cooling Energy [J]", RefrigCase( CaseNum ).LatCoolingEnergy, "Zone", "Sum", RefrigCase( CaseNum ).Name );
-
-					SetupOutputVariable( "Refrigeration Case Zone Sensible Cooling Rate [W]", RefrigCase( CaseNum ).SensZoneCreditCoolRate, "Zone", "Average", RefrigCase( CaseNum ).Name );
-					SetupOutputVariable( "Refrigeration Case Zone Sensible Cooling Energy [J]", RefrigCase( CaseNum ).SensZoneCreditCool, "Zone", "Sum", RefrigCase( CaseNum ).Name );
-					SetupOutputVariable( "Refrigeration Case Zone Sensible Heating Rate [W]", RefrigCase( CaseNum ).SensZoneCreditHeatRate, "Zone", "Average", RefrigCase( CaseNum ).Name );
-					SetupOutputVariable( "Refrigeration Case Zone Sensible Heating Energy [J]", RefrigCase( CaseNum ).SensZoneCreditHeat, "Zone", "Sum", RefrigCase( CaseNum ).Name );
-
-					SetupOutputVariable( "Refrigeration Case Zone Latent Rate [W]", RefrigCase( CaseNum ).LatZoneCreditRate, "Zone", "Average", RefrigCase( CaseNum ).Name );
-					SetupOutputVariable( "Refrigeration Case Zone Latent Energy [J]", RefrigCase( CaseNum ).LatZoneCredit, "Zone", "Sum", RefrigCase( CaseNum ).Name );
-
-					SetupOutputVariable( "Refrigeration Case Return Air Sensible Cooling Rate [W]", RefrigCase( CaseNum ).SensHVACCreditCoolRate, "Zone", "Average", RefrigCase( CaseNum ).Name );
-					SetupOutputVariable( "Refrigeration Case Return Air Sensible Cooling Energy [J]", RefrigCase( CaseNum ).SensHVACCreditCool, "Zone", "Sum", RefrigCase( CaseNum ).Name );
-					SetupOutputVariable( "Refrigeration Case Return Air Sensible Heating Rate [W]", RefrigCase( CaseNum ).SensHVACCreditHeatRate, "Zone", "Average", RefrigCase( CaseNum ).Name );
-					SetupOutputVariable( "Refrigeration Case Return Air Sensible Heating Energy [J]", RefrigCase( CaseNum ).SensHVACCreditHeat, "Zone", "Sum", RefrigCase( CaseNum ).Name );
-
-					SetupOutputVariable( "Refrigeration Case Return Air Latent Rate [W]", RefrigCase( CaseNum ).LatHVACCreditRate, "Zone", "Average", RefrigCase( CaseNum ).Name );
-					SetupOutputVariable( "Refrigeration Case Return Air Latent Energy [J]", RefrigCase( CaseNum ).LatHVACCredit, "Zone", "Sum", RefrigCase( CaseNum ).Name );
-
-					SetupOutputVariable( "Refrigeration Case Evaporator Fan Electric Power [W]", RefrigCase( CaseNum ).ElecFanPower, "Zone", "Average", RefrigCase( CaseNum ).Name );
-					SetupOutputVariable( "Refrigeration Case Evaporator Fan Electric Energy [J]", RefrigCase( CaseNum ).ElecFanConsumption, "Zone", "Sum", RefrigCase( CaseNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building", RefrigCase( CaseNum ).ZoneName );
-					SetupOutputVariable( "Refrigeration Case Lighting Electric Power [W]", RefrigCase( CaseNum ).ElecLightingPower, "Zone", "Average", RefrigCase( CaseNum ).Name );
-					SetupOutputVariable( "Refrigeration Case Lighting Electric Energy [J]", RefrigCase( CaseNum ).ElecLightingConsumption, "Zone", "Sum", RefrigCase( CaseNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building", RefrigCase( CaseNum ).ZoneName );
+			for ( SetupReportInputCaseNum = 1; SetupReportInputCaseNum <= NumSimulationCases; ++SetupReportInputCaseNum ) {
+				if ( RefrigCase( SetupReportInputCaseNum ).NumSysAttach == 1 ) {
+					SetupOutputVariable( "Refrigeration Case Evaporator Total Cooling Rate [W]", RefrigCase( SetupReportInputCaseNum ).TotalCoolingLoad, "Zone", "Average", RefrigCase( SetupReportInputCaseNum ).Name );
+					SetupOutputVariable( "Refrigeration Case Evaporator Total Cooling Energy [J]", RefrigCase( SetupReportInputCaseNum ).TotalCoolingEnergy, "Zone", "Sum", RefrigCase( SetupReportInputCaseNum ).Name, _, "ENERGYTRANSFER", "REFRIGERATION", _, "Building", RefrigCase( SetupReportInputCaseNum ).ZoneName );
+					SetupOutputVariable( "Refrigeration Case Evaporator Sensible Cooling Rate [W]", RefrigCase( SetupReportInputCaseNum ).SensCoolingEnergyRate, "Zone", "Average", RefrigCase( SetupReportInputCaseNum ).Name );
+					SetupOutputVariable( "Refrigeration Case Evaporator Sensible Cooling Energy [J]", RefrigCase( SetupReportInputCaseNum ).SensCoolingEnergy, "Zone", "Sum", RefrigCase( SetupReportInputCaseNum ).Name );
+					SetupOutputVariable( "Refrigeration Case Evaporator Latent Cooling Rate [W]", RefrigCase( SetupReportInputCaseNum ).LatCoolingEnergyRate, "Zone", "Average", RefrigCase( SetupReportInputCaseNum ).Name );
+					SetupOutputVariable( "Refrigeration Case Evaporator Latent Cooling Energy [J]", RefrigCase( SetupReportInputCaseNum ).LatCoolingEnergy, "Zone", "Sum", RefrigCase( SetupReportInputCaseNum ).Name );
+
+					SetupOutputVariable( "Refrigeration Case Zone Sensible Cooling Rate [W]", RefrigCase( SetupReportInputCaseNum ).SensZoneCreditCoolRate, "Zone", "Average", RefrigCase( SetupReportInputCaseNum ).Name );
+					SetupOutputVariable( "Refrigeration Case Zone Sensible Cooling Energy [J]", RefrigCase( SetupReportInputCaseNum ).SensZoneCreditCool, "Zone", "Sum", RefrigCase( SetupReportInputCaseNum ).Name );
+					SetupOutputVariable( "Refrigeration Case Zone Sensible Heating Rate [W]", RefrigCase( SetupReportInputCaseNum ).SensZoneCreditHeatRate, "Zone", "Average", RefrigCase( SetupReportInputCaseNum ).Name );
+					SetupOutputVariable( "Refrigeration Case Zone Sensible Heating Energy [J]", RefrigCase( SetupReportInputCaseNum ).SensZoneCreditHeat, "Zone", "Sum", RefrigCase( SetupReportInputCaseNum ).Name );
+
+					SetupOutputVariable( "Refrigeration Case Zone Latent Rate [W]", RefrigCase( SetupReportInputCaseNum ).LatZoneCreditRate, "Zone", "Average", RefrigCase( SetupReportInputCaseNum ).Name );
+					SetupOutputVariable( "Refrigeration Case Zone Latent Energy [J]", RefrigCase( SetupReportInputCaseNum ).LatZoneCredit, "Zone", "Sum", RefrigCase( SetupReportInputCaseNum ).Name );
+
+					SetupOutputVariable( "Refrigeration Case Return Air Sensible Cooling Rate [W]", RefrigCase( SetupReportInputCaseNum ).SensHVACCreditCoolRate, "Zone", "Average", RefrigCase( SetupReportInputCaseNum ).Name );
+					SetupOutputVariable( "Refrigeration Case Return Air Sensible Cooling Energy [J]", RefrigCase( SetupReportInputCaseNum ).SensHVACCreditCool, "Zone", "Sum", RefrigCase( SetupReportInputCaseNum ).Name );
+					SetupOutputVariable( "Refrigeration Case Return Air Sensible Heating Rate [W]", RefrigCase( SetupReportInputCaseNum ).SensHVACCreditHeatRate, "Zone", "Average", RefrigCase( SetupReportInputCaseNum ).Name );
+					SetupOutputVariable( "Refrigeration Case Return Air Sensible Heating Energy [J]", RefrigCase( SetupReportInputCaseNum ).SensHVACCreditHeat, "Zone", "Sum", RefrigCase( SetupReportInputCaseNum ).Name );
+
+					SetupOutputVariable( "Refrigeration Case Return Air Latent Rate [W]", RefrigCase( SetupReportInputCaseNum ).LatHVACCreditRate, "Zone", "Average", RefrigCase( SetupReportInputCaseNum ).Name );
+					SetupOutputVariable( "Refrigeration Case Return Air Latent Energy [J]", RefrigCase( SetupReportInputCaseNum ).LatHVACCredit, "Zone", "Sum", RefrigCase( SetupReportInputCaseNum ).Name );
+
+					SetupOutputVariable( "Refrigeration Case Evaporator Fan Electric Power [W]", RefrigCase( SetupReportInputCaseNum ).ElecFanPower, "Zone", "Average", RefrigCase( SetupReportInputCaseNum ).Name );
+					SetupOutputVariable( "Refrigeration Case Evaporator Fan Electric Energy [J]", RefrigCase( SetupReportInputCaseNum ).ElecFanConsumption, "Zone", "Sum", RefrigCase( SetupReportInputCaseNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building", RefrigCase( SetupReportInputCaseNum ).ZoneName );
+					SetupOutputVariable( "Refrigeration Case Lighting Electric Power [W]", RefrigCase( SetupReportInputCaseNum ).ElecLightingPower, "Zone", "Average", RefrigCase( SetupReportInputCaseNum ).Name );
+					SetupOutputVariable( "Refrigeration Case Lighting Electric Energy [J]", RefrigCase( SetupReportInputCaseNum ).ElecLightingConsumption, "Zone", "Sum", RefrigCase( SetupReportInputCaseNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building", RefrigCase( SetupReportInputCaseNum ).ZoneName );
 
 					// Report defrost energy curve value only for cases having electric or hot-gas defrost with temperature termination
-					if ( RefrigCase( CaseNum ).DefrostType == DefElectricTerm || RefrigCase( CaseNum ).DefrostType == DefHotFluidTerm ) {
-						SetupOutputVariable( "Refrigeration Case Defrost Energy Correction Curve Value []", RefrigCase( CaseNum ).DefEnergyCurveValue, "Zone", "Average", RefrigCase( CaseNum ).Name );
+					if ( RefrigCase( SetupReportInputCaseNum ).DefrostType == DefElectricTerm || RefrigCase( SetupReportInputCaseNum ).DefrostType == DefHotFluidTerm ) {
+						SetupOutputVariable( "Refrigeration Case Defrost Energy Correction Curve Value []", RefrigCase( SetupReportInputCaseNum ).DefEnergyCurveValue, "Zone", "Average", RefrigCase( SetupReportInputCaseNum ).Name );
 					}
 
-					SetupOutputVariable( "Refrigeration Case Latent Credit Curve Value []", RefrigCase( CaseNum ).LatEnergyCurveValue, "Zone", "Average", RefrigCase( CaseNum ).Name );
+					SetupOutputVariable( "Refrigeration Case Latent Credit Curve Value []", RefrigCase( SetupReportInputCaseNum ).LatEnergyCurveValue, "Zone", "Average", RefrigCase( SetupReportInputCaseNum ).Name );
 
 					// Report only for cases having anti-sweat heaters
-					if ( RefrigCase( CaseNum ).AntiSweatControlType > ASNone ) {
-						SetupOutputVariable( "Refrigeration Case Anti Sweat Electric Power [W]", RefrigCase( CaseNum ).ElecAntiSweatPower, "Zone", "Average", RefrigCase( CaseNum ).Name );
-						SetupOutputVariable( "Refrigeration Case Anti Sweat Electric Energy [J]", RefrigCase( CaseNum ).ElecAntiSweatConsumption, "Zone", "Sum", RefrigCase( CaseNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building", RefrigCase( CaseNum ).ZoneName );
+					if ( RefrigCase( SetupReportInputCaseNum ).AntiSweatControlType > ASNone ) {
+						SetupOutputVariable( "Refrigeration Case Anti Sweat Electric Power [W]", RefrigCase( SetupReportInputCaseNum ).ElecAntiSweatPower, "Zone", "Average", RefrigCase( SetupReportInputCaseNum ).Name );
+						SetupOutputVariable( "Refrigeration Case Anti Sweat Electric Energy [J]", RefrigCase( SetupReportInputCaseNum ).ElecAntiSweatConsumption, "Zone", "Sum", RefrigCase( SetupReportInputCaseNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building", RefrigCase( SetupReportInputCaseNum ).ZoneName );
 					}
 
 					// Report only for cases using electric defrost
 
-					if ( RefrigCase( CaseNum ).DefrostType == DefElectric || RefrigCase( CaseNum ).DefrostType == DefElectricOnDemand || RefrigCase( CaseNum ).DefrostType == DefElectricTerm ) {
-						SetupOutputVariable( "Refrigeration Case Defrost Electric Power [W]", RefrigCase( CaseNum ).ElecDefrostPower, "Zone", "Average", RefrigCase( CaseNum ).Name );
-						SetupOutputVariable( "Refrigeration Case Defrost Electric Energy [J]", RefrigCase( CaseNum ).ElecDefrostConsumption, "Zone", "Sum", RefrigCase( CaseNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building", RefrigCase( CaseNum ).ZoneName );
+					if ( RefrigCase( SetupReportInputCaseNum ).DefrostType == DefElectric || RefrigCase( SetupReportInputCaseNum ).DefrostType == DefElectricOnDemand || RefrigCase( SetupReportInputCaseNum ).DefrostType == DefElectricTerm ) {
+						SetupOutputVariable( "Refrigeration Case Defrost Electric Power [W]", RefrigCase( SetupReportInputCaseNum ).ElecDefrostPower, "Zone", "Average", RefrigCase( SetupReportInputCaseNum ).Name );
+						SetupOutputVariable( "Refrigeration Case Defrost Electric Energy [J]", RefrigCase( SetupReportInputCaseNum ).ElecDefrostConsumption, "Zone", "Sum", RefrigCase( SetupReportInputCaseNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building", RefrigCase( SetupReportInputCaseNum ).ZoneName );
 					}
 
 					//register refrigeration case credits as internal gains
-					if ( RefrigCase( CaseNum ).ActualZoneNum > 0 ) {
-						SetupZoneInternalGain( RefrigCase( CaseNum ).ActualZoneNum, "Refrigeration:Case", RefrigCase( CaseNum ).Name, IntGainTypeOf_RefrigerationCase, RefrigCase( CaseNum ).SensZoneCreditRate, RefrigCase( CaseNum ).SensHVACCreditRate, _, RefrigCase( CaseNum ).LatZoneCreditRate, RefrigCase( CaseNum ).LatHVACCreditRate );
+					if ( RefrigCase( SetupReportInputCaseNum ).ActualZoneNum > 0 ) {
+						SetupZoneInternalGain( RefrigCase( SetupReportInputCaseNum ).ActualZoneNum, "Refrigeration:Case", RefrigCase( SetupReportInputCaseNum ).Name, IntGainTypeOf_RefrigerationCase, RefrigCase( SetupReportInputCaseNum ).SensZoneCreditRate, RefrigCase( SetupReportInputCaseNum ).SensHVACCreditRate, _, RefrigCase( SetupReportInputCaseNum ).LatZoneCreditRate, RefrigCase( SetupReportInputCaseNum ).LatHVACCreditRate );
 					}
 				} //END IF (.NOT. RefrigCase(CaseNum)%unusedCase)
 			}
@@ -5933,45 +6804,45 @@ namespace RefrigeratedCase {
 		if ( NumSimulationWalkIns > 0 ) {
 			// Setup Report Variables for simulated  Walk In (do not report unused WalkIns)
 			// CurrentModuleObject='Refrigeration:WalkIn'
-			for ( WalkInNum = 1; WalkInNum <= NumSimulationWalkIns; ++WalkInNum ) {
-				if ( WalkIn( WalkInNum ).NumSysAttach == 1 ) { //ensure no unuseds reported
-					SetupOutputVariable( "Refrigeration Walk In Evaporator Total Cooling Rate [W]", WalkIn( WalkInNum ).TotalCoolingLoad, "Zone", "Average", WalkIn( WalkInNum ).Name );
-					SetupOutputVariable( "Refrigeration Walk In Evaporator Total Cooling Energy [J]", WalkIn( WalkInNum ).TotalCoolingEnergy, "Zone", "Sum", WalkIn( WalkInNum ).Name );
-					SetupOutputVariable( "Refrigeration Walk In Evaporator Sensible Cooling Rate [W]", WalkIn( WalkInNum ).TotSensCoolingEnergyRate, "Zone", "Average", WalkIn( WalkInNum ).Name );
-					SetupOutputVariable( "Refrigeration Walk In Evaporator Sensible Cooling Energy [J]", WalkIn( WalkInNum ).TotSensCoolingEnergy, "Zone", "Sum", WalkIn( WalkInNum ).Name );
-					SetupOutputVariable( "Refrigeration Walk In Evaporator Latent Cooling Rate [W]", WalkIn( WalkInNum ).TotLatCoolingEnergyRate, "Zone", "Average", WalkIn( WalkInNum ).Name );
-					SetupOutputVariable( "Refrigeration Walk In Evaporator Latent Cooling Energy [J]", WalkIn( WalkInNum ).TotLatCoolingEnergy, "Zone", "Sum", WalkIn( WalkInNum ).Name );
-					SetupOutputVariable( "Refrigeration Walk In Ancillary Electric Power [W]", WalkIn( WalkInNum ).TotalElecPower, "Zone", "Average", WalkIn( WalkInNum ).Name );
-					SetupOutputVariable( "Refrigeration Walk In Ancillary Electric Energy [J]", WalkIn( WalkInNum ).TotalElecConsumption, "Zone", "Sum", WalkIn( WalkInNum ).Name );
-					SetupOutputVariable( "Refrigeration Walk In Fan Electric Power [W]", WalkIn( WalkInNum ).ElecFanPower, "Zone", "Average", WalkIn( WalkInNum ).Name );
-					SetupOutputVariable( "Refrigeration Walk In Fan Electric Energy [J]", WalkIn( WalkInNum ).ElecFanConsumption, "Zone", "Sum", WalkIn( WalkInNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building" );
-					SetupOutputVariable( "Refrigeration Walk In Lighting Electric Power [W]", WalkIn( WalkInNum ).ElecLightingPower, "Zone", "Average", WalkIn( WalkInNum ).Name );
-					SetupOutputVariable( "Refrigeration Walk In Lighting Electric Energy [J]", WalkIn( WalkInNum ).ElecLightingConsumption, "Zone", "Sum", WalkIn( WalkInNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building" );
-					SetupOutputVariable( "Refrigeration Walk In Heater Electric Power [W]", WalkIn( WalkInNum ).ElecHeaterPower, "Zone", "Average", WalkIn( WalkInNum ).Name );
-					SetupOutputVariable( "Refrigeration Walk In Heater Electric Energy [J]", WalkIn( WalkInNum ).ElecHeaterConsumption, "Zone", "Sum", WalkIn( WalkInNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building" );
+			for ( SetupReportInputWalkInNum = 1; SetupReportInputWalkInNum <= NumSimulationWalkIns; ++SetupReportInputWalkInNum ) {
+				if ( WalkIn( SetupReportInputWalkInNum ).NumSysAttach == 1 ) { //ensure no unuseds reported
+					SetupOutputVariable( "Refrigeration Walk In Evaporator Total Cooling Rate [W]", WalkIn( SetupReportInputWalkInNum ).TotalCoolingLoad, "Zone", "Average", WalkIn( SetupReportInputWalkInNum ).Name );
+					SetupOutputVariable( "Refrigeration Walk In Evaporator Total Cooling Energy [J]", WalkIn( SetupReportInputWalkInNum ).TotalCoolingEnergy, "Zone", "Sum", WalkIn( SetupReportInputWalkInNum ).Name );
+					SetupOutputVariable( "Refrigeration Walk In Evaporator Sensible Cooling Rate [W]", WalkIn( SetupReportInputWalkInNum ).TotSensCoolingEnergyRate, "Zone", "Average", WalkIn( SetupReportInputWalkInNum ).Name );
+					SetupOutputVariable( "Refrigeration Walk In Evaporator Sensible Cooling Energy [J]", WalkIn( SetupReportInputWalkInNum ).TotSensCoolingEnergy, "Zone", "Sum", WalkIn( SetupReportInputWalkInNum ).Name );
+					SetupOutputVariable( "Refrigeration Walk In Evaporator Latent Cooling Rate [W]", WalkIn( SetupReportInputWalkInNum ).TotLatCoolingEnergyRate, "Zone", "Average", WalkIn( SetupReportInputWalkInNum ).Name );
+					SetupOutputVariable( "Refrigeration Walk In Evaporator Latent Cooling Energy [J]", WalkIn( SetupReportInputWalkInNum ).TotLatCoolingEnergy, "Zone", "Sum", WalkIn( SetupReportInputWalkInNum ).Name );
+					SetupOutputVariable( "Refrigeration Walk In Ancillary Electric Power [W]", WalkIn( SetupReportInputWalkInNum ).TotalElecPower, "Zone", "Average", WalkIn( SetupReportInputWalkInNum ).Name );
+					SetupOutputVariable( "Refrigeration Walk In Ancillary Electric Energy [J]", WalkIn( SetupReportInputWalkInNum ).TotalElecConsumption, "Zone", "Sum", WalkIn( SetupReportInputWalkInNum ).Name );
+					SetupOutputVariable( "Refrigeration Walk In Fan Electric Power [W]", WalkIn( SetupReportInputWalkInNum ).ElecFanPower, "Zone", "Average", WalkIn( SetupReportInputWalkInNum ).Name );
+					SetupOutputVariable( "Refrigeration Walk In Fan Electric Energy [J]", WalkIn( SetupReportInputWalkInNum ).ElecFanConsumption, "Zone", "Sum", WalkIn( SetupReportInputWalkInNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building" );
+					SetupOutputVariable( "Refrigeration Walk In Lighting Electric Power [W]", WalkIn( SetupReportInputWalkInNum ).ElecLightingPower, "Zone", "Average", WalkIn( SetupReportInputWalkInNum ).Name );
+					SetupOutputVariable( "Refrigeration Walk In Lighting Electric Energy [J]", WalkIn( SetupReportInputWalkInNum ).ElecLightingConsumption, "Zone", "Sum", WalkIn( SetupReportInputWalkInNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building" );
+					SetupOutputVariable( "Refrigeration Walk In Heater Electric Power [W]", WalkIn( SetupReportInputWalkInNum ).ElecHeaterPower, "Zone", "Average", WalkIn( SetupReportInputWalkInNum ).Name );
+					SetupOutputVariable( "Refrigeration Walk In Heater Electric Energy [J]", WalkIn( SetupReportInputWalkInNum ).ElecHeaterConsumption, "Zone", "Sum", WalkIn( SetupReportInputWalkInNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building" );
 
 					// Report only for WalkIns using electric defrost
-					if ( WalkIn( WalkInNum ).DefrostType == WalkInDefrostElec ) {
-						SetupOutputVariable( "Refrigeration Walk In Defrost Electric Power [W]", WalkIn( WalkInNum ).ElecDefrostPower, "Zone", "Average", WalkIn( WalkInNum ).Name );
-						SetupOutputVariable( "Refrigeration Walk In Defrost Electric Energy [J]", WalkIn( WalkInNum ).ElecDefrostConsumption, "Zone", "Sum", WalkIn( WalkInNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building" );
+					if ( WalkIn( SetupReportInputWalkInNum ).DefrostType == WalkInDefrostElec ) {
+						SetupOutputVariable( "Refrigeration Walk In Defrost Electric Power [W]", WalkIn( SetupReportInputWalkInNum ).ElecDefrostPower, "Zone", "Average", WalkIn( SetupReportInputWalkInNum ).Name );
+						SetupOutputVariable( "Refrigeration Walk In Defrost Electric Energy [J]", WalkIn( SetupReportInputWalkInNum ).ElecDefrostConsumption, "Zone", "Sum", WalkIn( SetupReportInputWalkInNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building" );
 					}
 
 					// Report walkin variables that are specified for each zone exposed to the walkin
 					// For "IDOut" variable in SetupOutputVariable, need to create a single name that includes
 					//    both the walk-in name and the zone name - see "Walkin_and_zone_name" concatination
 					//    This new variable name is important if using an rvi file!
-					for ( ZoneID = 1; ZoneID <= WalkIn( WalkInNum ).NumZones; ++ZoneID ) {
+					for ( SetupReportInputZoneID = 1; SetupReportInputZoneID <= WalkIn( SetupReportInputWalkInNum ).NumZones; ++SetupReportInputZoneID ) {
 
-						Walkin_and_zone_name = WalkIn( WalkInNum ).Name + "InZone" + WalkIn( WalkInNum ).ZoneName( ZoneID );
+						Walkin_and_zone_name = WalkIn( SetupReportInputWalkInNum ).Name + "InZone" + WalkIn( SetupReportInputWalkInNum ).ZoneName( SetupReportInputZoneID );
 
-						SetupOutputVariable( "Refrigeration Walk In Zone Sensible Cooling Rate [W]", WalkIn( WalkInNum ).SensZoneCreditCoolRate( ZoneID ), "Zone", "Average", Walkin_and_zone_name );
-						SetupOutputVariable( "Refrigeration Walk In Zone Sensible Cooling Energy [J]", WalkIn( WalkInNum ).SensZoneCreditCool( ZoneID ), "Zone", "Sum", Walkin_and_zone_name );
-						SetupOutputVariable( "Refrigeration Walk In Zone Sensible Heating Rate [W]", WalkIn( WalkInNum ).SensZoneCreditHeatRate( ZoneID ), "Zone", "Average", Walkin_and_zone_name );
-						SetupOutputVariable( "Refrigeration Walk In Zone Sensible Heating Energy [J]", WalkIn( WalkInNum ).SensZoneCreditHeat( ZoneID ), "Zone", "Sum", Walkin_and_zone_name );
-						SetupOutputVariable( "Refrigeration Walk In Zone Latent Rate [W]", WalkIn( WalkInNum ).LatZoneCreditRate( ZoneID ), "Zone", "Average", Walkin_and_zone_name );
-						SetupOutputVariable( "Refrigeration Walk In Zone Latent Energy [J]", WalkIn( WalkInNum ).LatZoneCredit( ZoneID ), "Zone", "Sum", Walkin_and_zone_name );
+						SetupOutputVariable( "Refrigeration Walk In Zone Sensible Cooling Rate [W]", WalkIn( SetupReportInputWalkInNum ).SensZoneCreditCoolRate( SetupReportInputZoneID ), "Zone", "Average", Walkin_and_zone_name );
+						SetupOutputVariable( "Refrigeration Walk In Zone Sensible Cooling Energy [J]", WalkIn( SetupReportInputWalkInNum ).SensZoneCreditCool( SetupReportInputZoneID ), "Zone", "Sum", Walkin_and_zone_name );
+						SetupOutputVariable( "Refrigeration Walk In Zone Sensible Heating Rate [W]", WalkIn( SetupReportInputWalkInNum ).SensZoneCreditHeatRate( SetupReportInputZoneID ), "Zone", "Average", Walkin_and_zone_name );
+						SetupOutputVariable( "Refrigeration Walk In Zone Sensible Heating Energy [J]", WalkIn( SetupReportInputWalkInNum ).SensZoneCreditHeat( SetupReportInputZoneID ), "Zone", "Sum", Walkin_and_zone_name );
+						SetupOutputVariable( "Refrigeration Walk In Zone Latent Rate [W]", WalkIn( SetupReportInputWalkInNum ).LatZoneCreditRate( SetupReportInputZoneID ), "Zone", "Average", Walkin_and_zone_name );
+						SetupOutputVariable( "Refrigeration Walk In Zone Latent Energy [J]", WalkIn( SetupReportInputWalkInNum ).LatZoneCredit( SetupReportInputZoneID ), "Zone", "Sum", Walkin_and_zone_name );
 
-						if ( WalkIn( WalkInNum ).ZoneNum( ZoneID ) > 0 ) SetupZoneInternalGain( WalkIn( WalkInNum ).ZoneNum( ZoneID ), "Refrigeration:WalkIn", Walkin_and_zone_name, IntGainTypeOf_RefrigerationWalkIn, WalkIn( WalkInNum ).SensZoneCreditRate( ZoneID ), _, _, WalkIn( WalkInNum ).LatZoneCreditRate( ZoneID ) );
+						if ( WalkIn( SetupReportInputWalkInNum ).ZoneNum( SetupReportInputZoneID ) > 0 ) SetupZoneInternalGain( WalkIn( SetupReportInputWalkInNum ).ZoneNum( SetupReportInputZoneID ), "Refrigeration:WalkIn", Walkin_and_zone_name, IntGainTypeOf_RefrigerationWalkIn, WalkIn( SetupReportInputWalkInNum ).SensZoneCreditRate( SetupReportInputZoneID ), _, _, WalkIn( SetupReportInputWalkInNum ).LatZoneCreditRate( SetupReportInputZoneID ) );
 
 					} // ZoneID
 				} //(.NOT.  WalkIn( WalkInNum)%unusedWalkIn)
@@ -5981,34 +6852,34 @@ namespace RefrigeratedCase {
 		if ( NumSimulationRefrigAirChillers > 0 ) {
 			// Setup Report Variables for simulated Warehouse coils (do not report unused warehouse coils)
 			// CurrentModuleObject='Refrigeration:AirChiller'
-			for ( CoilNum = 1; CoilNum <= NumSimulationRefrigAirChillers; ++CoilNum ) {
-				if ( WarehouseCoil( CoilNum ).NumSysAttach == 1 ) { //ensure no unuseds reported
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Total Cooling Rate [W]", WarehouseCoil( CoilNum ).TotalCoolingLoad, "HVAC", "Average", WarehouseCoil( CoilNum ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Total Cooling Energy [J]", WarehouseCoil( CoilNum ).TotalCoolingEnergy, "HVAC", "Sum", WarehouseCoil( CoilNum ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Sensible Cooling Rate [W]", WarehouseCoil( CoilNum ).SensCoolingEnergyRate, "HVAC", "Average", WarehouseCoil( CoilNum ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Sensible Cooling Energy [J]", WarehouseCoil( CoilNum ).SensCoolingEnergy, "HVAC", "Sum", WarehouseCoil( CoilNum ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Latent Cooling Rate [W]", WarehouseCoil( CoilNum ).LatCreditRate, "HVAC", "Average", WarehouseCoil( CoilNum ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Latent Cooling Energy [J]", WarehouseCoil( CoilNum ).LatCreditEnergy, "HVAC", "Sum", WarehouseCoil( CoilNum ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Water Removed Mass Flow Rate [kg/s]", WarehouseCoil( CoilNum ).LatKgPerS_ToZone, "HVAC", "Average", WarehouseCoil( CoilNum ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Total Electric Power [W]", WarehouseCoil( CoilNum ).TotalElecPower, "HVAC", "Average", WarehouseCoil( CoilNum ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Total Electric Energy [J]", WarehouseCoil( CoilNum ).TotalElecConsumption, "HVAC", "Sum", WarehouseCoil( CoilNum ).Name ); //components are metered seperately
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Fan Electric Power [W]", WarehouseCoil( CoilNum ).ElecFanPower, "HVAC", "Average", WarehouseCoil( CoilNum ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Fan Electric Energy [J]", WarehouseCoil( CoilNum ).ElecFanConsumption, "HVAC", "Sum", WarehouseCoil( CoilNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building" );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Heater Electric Power [W]", WarehouseCoil( CoilNum ).ElecHeaterPower, "HVAC", "Average", WarehouseCoil( CoilNum ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Heater Electric Energy [J]", WarehouseCoil( CoilNum ).ElecHeaterConsumption, "HVAC", "Sum", WarehouseCoil( CoilNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building" );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Sensible Heat Ratio []", WarehouseCoil( CoilNum ).SensHeatRatio, "HVAC", "Average", WarehouseCoil( CoilNum ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Frost Accumulation Mass [Kg]", WarehouseCoil( CoilNum ).KgFrost, "HVAC", "Average", WarehouseCoil( CoilNum ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Zone Total Cooling Rate [W]", WarehouseCoil( CoilNum ).ReportTotalCoolCreditRate, "HVAC", "Average", WarehouseCoil( CoilNum ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Zone Total Cooling Energy [J]", WarehouseCoil( CoilNum ).ReportTotalCoolCreditEnergy, "HVAC", "Sum", WarehouseCoil( CoilNum ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Zone Sensible Cooling Rate [W]", WarehouseCoil( CoilNum ).ReportSensCoolCreditRate, "HVAC", "Average", WarehouseCoil( CoilNum ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Zone Sensible Cooling Energy [J]", WarehouseCoil( CoilNum ).ReportSensCoolCreditEnergy, "HVAC", "Sum", WarehouseCoil( CoilNum ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Zone Heating Rate [W]", WarehouseCoil( CoilNum ).ReportHeatingCreditRate, "HVAC", "Average", WarehouseCoil( CoilNum ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Zone Heating Energy [J]", WarehouseCoil( CoilNum ).ReportHeatingCreditEnergy, "HVAC", "Sum", WarehouseCoil( CoilNum ).Name );
+			for ( SetupReportInputCoilNum = 1; SetupReportInputCoilNum <= NumSimulationRefrigAirChillers; ++SetupReportInputCoilNum ) {
+				if ( WarehouseCoil( SetupReportInputCoilNum ).NumSysAttach == 1 ) { //ensure no unuseds reported
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Total Cooling Rate [W]", WarehouseCoil( SetupReportInputCoilNum ).TotalCoolingLoad, "HVAC", "Average", WarehouseCoil( SetupReportInputCoilNum ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Total Cooling Energy [J]", WarehouseCoil( SetupReportInputCoilNum ).TotalCoolingEnergy, "HVAC", "Sum", WarehouseCoil( SetupReportInputCoilNum ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Sensible Cooling Rate [W]", WarehouseCoil( SetupReportInputCoilNum ).SensCoolingEnergyRate, "HVAC", "Average", WarehouseCoil( SetupReportInputCoilNum ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Sensible Cooling Energy [J]", WarehouseCoil( SetupReportInputCoilNum ).SensCoolingEnergy, "HVAC", "Sum", WarehouseCoil( SetupReportInputCoilNum ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Latent Cooling Rate [W]", WarehouseCoil( SetupReportInputCoilNum ).LatCreditRate, "HVAC", "Average", WarehouseCoil( SetupReportInputCoilNum ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Latent Cooling Energy [J]", WarehouseCoil( SetupReportInputCoilNum ).LatCreditEnergy, "HVAC", "Sum", WarehouseCoil( SetupReportInputCoilNum ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Water Removed Mass Flow Rate [kg/s]", WarehouseCoil( SetupReportInputCoilNum ).LatKgPerS_ToZone, "HVAC", "Average", WarehouseCoil( SetupReportInputCoilNum ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Total Electric Power [W]", WarehouseCoil( SetupReportInputCoilNum ).TotalElecPower, "HVAC", "Average", WarehouseCoil( SetupReportInputCoilNum ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Total Electric Energy [J]", WarehouseCoil( SetupReportInputCoilNum ).TotalElecConsumption, "HVAC", "Sum", WarehouseCoil( SetupReportInputCoilNum ).Name ); //components are metered seperately
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Fan Electric Power [W]", WarehouseCoil( SetupReportInputCoilNum ).ElecFanPower, "HVAC", "Average", WarehouseCoil( SetupReportInputCoilNum ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Fan Electric Energy [J]", WarehouseCoil( SetupReportInputCoilNum ).ElecFanConsumption, "HVAC", "Sum", WarehouseCoil( SetupReportInputCoilNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building" );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Heater Electric Power [W]", WarehouseCoil( SetupReportInputCoilNum ).ElecHeaterPower, "HVAC", "Average", WarehouseCoil( SetupReportInputCoilNum ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Heater Electric Energy [J]", WarehouseCoil( SetupReportInputCoilNum ).ElecHeaterConsumption, "HVAC", "Sum", WarehouseCoil( SetupReportInputCoilNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building" );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Sensible Heat Ratio []", WarehouseCoil( SetupReportInputCoilNum ).SensHeatRatio, "HVAC", "Average", WarehouseCoil( SetupReportInputCoilNum ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Frost Accumulation Mass [Kg]", WarehouseCoil( SetupReportInputCoilNum ).KgFrost, "HVAC", "Average", WarehouseCoil( SetupReportInputCoilNum ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Zone Total Cooling Rate [W]", WarehouseCoil( SetupReportInputCoilNum ).ReportTotalCoolCreditRate, "HVAC", "Average", WarehouseCoil( SetupReportInputCoilNum ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Zone Total Cooling Energy [J]", WarehouseCoil( SetupReportInputCoilNum ).ReportTotalCoolCreditEnergy, "HVAC", "Sum", WarehouseCoil( SetupReportInputCoilNum ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Zone Sensible Cooling Rate [W]", WarehouseCoil( SetupReportInputCoilNum ).ReportSensCoolCreditRate, "HVAC", "Average", WarehouseCoil( SetupReportInputCoilNum ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Zone Sensible Cooling Energy [J]", WarehouseCoil( SetupReportInputCoilNum ).ReportSensCoolCreditEnergy, "HVAC", "Sum", WarehouseCoil( SetupReportInputCoilNum ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Zone Heating Rate [W]", WarehouseCoil( SetupReportInputCoilNum ).ReportHeatingCreditRate, "HVAC", "Average", WarehouseCoil( SetupReportInputCoilNum ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Zone Heating Energy [J]", WarehouseCoil( SetupReportInputCoilNum ).ReportHeatingCreditEnergy, "HVAC", "Sum", WarehouseCoil( SetupReportInputCoilNum ).Name );
 
 					// Report only for Warehouse coils using electric defrost
-					if ( WarehouseCoil( CoilNum ).DefrostType == DefrostElec ) {
-						SetupOutputVariable( "Refrigeration Zone Air Chiller Defrost Electric Power [W]", WarehouseCoil( CoilNum ).ElecDefrostPower, "HVAC", "Average", WarehouseCoil( CoilNum ).Name );
-						SetupOutputVariable( "Refrigeration Zone Air Chiller Defrost Electric Energy [J]", WarehouseCoil( CoilNum ).ElecDefrostConsumption, "HVAC", "Sum", WarehouseCoil( CoilNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building" );
+					if ( WarehouseCoil( SetupReportInputCoilNum ).DefrostType == DefrostElec ) {
+						SetupOutputVariable( "Refrigeration Zone Air Chiller Defrost Electric Power [W]", WarehouseCoil( SetupReportInputCoilNum ).ElecDefrostPower, "HVAC", "Average", WarehouseCoil( SetupReportInputCoilNum ).Name );
+						SetupOutputVariable( "Refrigeration Zone Air Chiller Defrost Electric Energy [J]", WarehouseCoil( SetupReportInputCoilNum ).ElecDefrostConsumption, "HVAC", "Sum", WarehouseCoil( SetupReportInputCoilNum ).Name, _, "ELECTRICITY", "REFRIGERATION", "General", "Building" );
 					} // electric defrost coil
 				} //(.NOT.  WarehouseCoil(CoilNum)%unusedWarehouseCoil)
 			} // NumSimulationWarehouseCoils
@@ -6020,35 +6891,35 @@ namespace RefrigeratedCase {
 
 		// Report sum of all refrigeration interactions with each zone
 
-		for ( ZoneID = 1; ZoneID <= NumOfZones; ++ZoneID ) {
-			if ( RefrigPresentInZone( ZoneID ) ) {
+		for ( SetupReportInputZoneID = 1; SetupReportInputZoneID <= NumOfZones; ++SetupReportInputZoneID ) {
+			if ( RefrigPresentInZone( SetupReportInputZoneID ) ) {
 				if ( HaveCasesOrWalkins ) {
-					SetupOutputVariable( "Refrigeration Zone Case and Walk In Total Sensible Cooling Rate [W]", RefrigCaseCredit( ZoneID ).SenCaseCreditToZone, "Zone", "Average", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Case and Walk In Total Sensible Cooling Energy [J]", CaseWIZoneReport( ZoneID ).SenCaseCreditToZoneEnergy, "Zone", "Sum", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Case and Walk In Heating Rate [W]", CaseWIZoneReport( ZoneID ).HeatingToZoneRate, "Zone", "Average", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Case and Walk In Heating Energy [J]", CaseWIZoneReport( ZoneID ).HeatingToZoneEnergy, "Zone", "Sum", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Case and Walk In Sensible Cooling Rate [W]", CaseWIZoneReport( ZoneID ).SenCoolingToZoneRate, "Zone", "Average", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Case and Walk In Sensible Cooling Energy [J]", CaseWIZoneReport( ZoneID ).SenCoolingToZoneEnergy, "Zone", "Sum", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Case and Walk In Total Latent Cooling Rate [W]", CaseWIZoneReport( ZoneID ).LatCoolingToZoneRate, "Zone", "Average", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Case and Walk In Total Latent Cooling Energy [J]", CaseWIZoneReport( ZoneID ).LatCoolingToZoneEnergy, "Zone", "Sum", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Case and Walk In Total Cooling Rate [W]", CaseWIZoneReport( ZoneID ).TotCoolingToZoneRate, "Zone", "Average", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Case and Walk In Total Cooling Energy [J]", CaseWIZoneReport( ZoneID ).TotCoolingToZoneEnergy, "Zone", "Sum", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Case and Walk In Total Heat Transfer Rate [W]", CaseWIZoneReport( ZoneID ).TotHtXferToZoneRate, "Zone", "Average", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Case and Walk In Total Heat Transfer Energy [J]", CaseWIZoneReport( ZoneID ).TotHtXferToZoneEnergy, "Zone", "Sum", Zone( ZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Case and Walk In Total Sensible Cooling Rate [W]", RefrigCaseCredit( SetupReportInputZoneID ).SenCaseCreditToZone, "Zone", "Average", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Case and Walk In Total Sensible Cooling Energy [J]", CaseWIZoneReport( SetupReportInputZoneID ).SenCaseCreditToZoneEnergy, "Zone", "Sum", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Case and Walk In Heating Rate [W]", CaseWIZoneReport( SetupReportInputZoneID ).HeatingToZoneRate, "Zone", "Average", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Case and Walk In Heating Energy [J]", CaseWIZoneReport( SetupReportInputZoneID ).HeatingToZoneEnergy, "Zone", "Sum", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Case and Walk In Sensible Cooling Rate [W]", CaseWIZoneReport( SetupReportInputZoneID ).SenCoolingToZoneRate, "Zone", "Average", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Case and Walk In Sensible Cooling Energy [J]", CaseWIZoneReport( SetupReportInputZoneID ).SenCoolingToZoneEnergy, "Zone", "Sum", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Case and Walk In Total Latent Cooling Rate [W]", CaseWIZoneReport( SetupReportInputZoneID ).LatCoolingToZoneRate, "Zone", "Average", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Case and Walk In Total Latent Cooling Energy [J]", CaseWIZoneReport( SetupReportInputZoneID ).LatCoolingToZoneEnergy, "Zone", "Sum", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Case and Walk In Total Cooling Rate [W]", CaseWIZoneReport( SetupReportInputZoneID ).TotCoolingToZoneRate, "Zone", "Average", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Case and Walk In Total Cooling Energy [J]", CaseWIZoneReport( SetupReportInputZoneID ).TotCoolingToZoneEnergy, "Zone", "Sum", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Case and Walk In Total Heat Transfer Rate [W]", CaseWIZoneReport( SetupReportInputZoneID ).TotHtXferToZoneRate, "Zone", "Average", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Case and Walk In Total Heat Transfer Energy [J]", CaseWIZoneReport( SetupReportInputZoneID ).TotHtXferToZoneEnergy, "Zone", "Sum", Zone( SetupReportInputZoneID ).Name );
 				} //HaveCasesOrWalkIns
 
 				if ( HaveChillers ) {
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Sensible Heat Transfer Rate [W]", CoilSysCredit( ZoneID ).SenCreditToZoneRate, "HVAC", "Average", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Sensible Heat Transfer Energy [J]", CoilSysCredit( ZoneID ).SenCreditToZoneEnergy, "HVAC", "Sum", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Sensible Cooling Rate [W]", CoilSysCredit( ZoneID ).ReportSenCoolingToZoneRate, "HVAC", "Average", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Sensible Cooling Energy [J]", CoilSysCredit( ZoneID ).ReportSenCoolingToZoneEnergy, "HVAC", "Sum", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Latent Cooling Rate [W]", CoilSysCredit( ZoneID ).ReportLatCreditToZoneRate, "HVAC", "Average", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Latent Cooling Energy [J]", CoilSysCredit( ZoneID ).ReportLatCreditToZoneEnergy, "HVAC", "Sum", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Water Removed Mass Flow Rate [Kg/s]", CoilSysCredit( ZoneID ).ReportH20RemovedKgPerS_FromZoneRate, "HVAC", "Average", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Total Cooling Rate [W]", CoilSysCredit( ZoneID ).ReportTotCoolingToZoneRate, "HVAC", "Average", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Total Cooling Energy [J]", CoilSysCredit( ZoneID ).ReportTotCoolingToZoneEnergy, "HVAC", "Sum", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Heating Rate [W]", CoilSysCredit( ZoneID ).ReportHeatingToZoneRate, "HVAC", "Average", Zone( ZoneID ).Name );
-					SetupOutputVariable( "Refrigeration Zone Air Chiller Heating Energy [J]", CoilSysCredit( ZoneID ).ReportHeatingToZoneEnergy, "HVAC", "Sum", Zone( ZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Sensible Heat Transfer Rate [W]", CoilSysCredit( SetupReportInputZoneID ).SenCreditToZoneRate, "HVAC", "Average", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Sensible Heat Transfer Energy [J]", CoilSysCredit( SetupReportInputZoneID ).SenCreditToZoneEnergy, "HVAC", "Sum", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Sensible Cooling Rate [W]", CoilSysCredit( SetupReportInputZoneID ).ReportSenCoolingToZoneRate, "HVAC", "Average", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Sensible Cooling Energy [J]", CoilSysCredit( SetupReportInputZoneID ).ReportSenCoolingToZoneEnergy, "HVAC", "Sum", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Latent Cooling Rate [W]", CoilSysCredit( SetupReportInputZoneID ).ReportLatCreditToZoneRate, "HVAC", "Average", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Latent Cooling Energy [J]", CoilSysCredit( SetupReportInputZoneID ).ReportLatCreditToZoneEnergy, "HVAC", "Sum", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Water Removed Mass Flow Rate [Kg/s]", CoilSysCredit( SetupReportInputZoneID ).ReportH20RemovedKgPerS_FromZoneRate, "HVAC", "Average", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Total Cooling Rate [W]", CoilSysCredit( SetupReportInputZoneID ).ReportTotCoolingToZoneRate, "HVAC", "Average", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Total Cooling Energy [J]", CoilSysCredit( SetupReportInputZoneID ).ReportTotCoolingToZoneEnergy, "HVAC", "Sum", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Heating Rate [W]", CoilSysCredit( SetupReportInputZoneID ).ReportHeatingToZoneRate, "HVAC", "Average", Zone( SetupReportInputZoneID ).Name );
+					SetupOutputVariable( "Refrigeration Zone Air Chiller Heating Energy [J]", CoilSysCredit( SetupReportInputZoneID ).ReportHeatingToZoneEnergy, "HVAC", "Sum", Zone( SetupReportInputZoneID ).Name );
 				} //HaveChillers
 			} //RefrigPresentInZone(ZoneID)
 		} // ZoneID
@@ -6097,72 +6968,72 @@ namespace RefrigeratedCase {
 		// Setup Report Variables for Refrigeration Compressor Rack
 		if ( NumRefrigeratedRacks > 0 ) {
 			// CurrentModuleObject='Refrigeration:CompressorRack'
-			for ( RackNum = 1; RackNum <= NumRefrigeratedRacks; ++RackNum ) {
-				if ( RefrigRack( RackNum ).CoilFlag ) { //rack serves chillers and is solved on HVAC time step
-					SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Electric Power [W]", RefrigRack( RackNum ).RackCompressorPower, "HVAC", "Average", RefrigRack( RackNum ).Name );
-					SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Electric Energy [J]", RefrigRack( RackNum ).RackElecConsumption, "HVAC", "Sum", RefrigRack( RackNum ).Name, _, "ELECTRICITY", "REFRIGERATION", RefrigRack( RackNum ).EndUseSubcategory, "Plant" );
-					SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Condenser Fan Electric Power [W]", RefrigRack( RackNum ).ActualCondenserFanPower, "HVAC", "Average", RefrigRack( RackNum ).Name );
-					SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Condenser Fan Electric Energy [J]", RefrigRack( RackNum ).CondenserFanConsumption, "HVAC", "Sum", RefrigRack( RackNum ).Name, _, "ELECTRICITY", "REFRIGERATION", RefrigRack( RackNum ).EndUseSubcategory, "Plant" );
-					SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Total Heat Transfer Rate [W]", RefrigRack( RackNum ).RackCapacity, "HVAC", "Average", RefrigRack( RackNum ).Name );
-					SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Total Heat Transfer Energy [J]", RefrigRack( RackNum ).RackCoolingEnergy, "HVAC", "Sum", RefrigRack( RackNum ).Name, _, "ENERGYTRANSFER", "REFRIGERATION", RefrigRack( RackNum ).EndUseSubcategory, "Plant" );
-					SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack COP [W/W]", RefrigRack( RackNum ).RackCompressorCOP, "HVAC", "Average", RefrigRack( RackNum ).Name );
-
-					if ( RefrigRack( RackNum ).CondenserType == RefrigCondenserTypeEvap ) {
-						SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Evaporative Condenser Pump Electric Power [W]", RefrigRack( RackNum ).ActualEvapPumpPower, "HVAC", "Average", RefrigRack( RackNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Evaporative Condenser Pump Electric Energy [J]", RefrigRack( RackNum ).EvapPumpConsumption, "HVAC", "Sum", RefrigRack( RackNum ).Name, _, "ELECTRICITY", "REFRIGERATION", RefrigRack( RackNum ).EndUseSubcategory, "Plant" );
-						SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Evaporative Condenser Basin Heater Electric Power [W]", RefrigRack( RackNum ).BasinHeaterPower, "HVAC", "Average", RefrigRack( RackNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Evaporative Condenser Basin Heater Electric Energy [J]", RefrigRack( RackNum ).BasinHeaterConsumption, "HVAC", "Sum", RefrigRack( RackNum ).Name, _, "ELECTRICITY", "REFRIGERATION", RefrigRack( RackNum ).EndUseSubcategory, "Plant" );
-						SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Evaporative Condenser Water Volume Flow Rate [m3/s]", RefrigRack( RackNum ).EvapWaterConsumpRate, "HVAC", "Average", RefrigRack( RackNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Evaporative Condenser Water Volume [m3]", RefrigRack( RackNum ).EvapWaterConsumption, "HVAC", "Sum", RefrigRack( RackNum ).Name, _, "Water", "REFRIGERATION", RefrigRack( RackNum ).EndUseSubcategory, "Plant" );
+			for ( SetupReportInputRackNum = 1; SetupReportInputRackNum <= NumRefrigeratedRacks; ++SetupReportInputRackNum ) {
+				if ( RefrigRack( SetupReportInputRackNum ).CoilFlag ) { //rack serves chillers and is solved on HVAC time step
+					SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Electric Power [W]", RefrigRack( SetupReportInputRackNum ).RackCompressorPower, "HVAC", "Average", RefrigRack( SetupReportInputRackNum ).Name );
+					SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Electric Energy [J]", RefrigRack( SetupReportInputRackNum ).RackElecConsumption, "HVAC", "Sum", RefrigRack( SetupReportInputRackNum ).Name, _, "ELECTRICITY", "REFRIGERATION", RefrigRack( SetupReportInputRackNum ).EndUseSubcategory, "Plant" );
+					SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Condenser Fan Electric Power [W]", RefrigRack( SetupReportInputRackNum ).ActualCondenserFanPower, "HVAC", "Average", RefrigRack( SetupReportInputRackNum ).Name );
+					SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Condenser Fan Electric Energy [J]", RefrigRack( SetupReportInputRackNum ).CondenserFanConsumption, "HVAC", "Sum", RefrigRack( SetupReportInputRackNum ).Name, _, "ELECTRICITY", "REFRIGERATION", RefrigRack( SetupReportInputRackNum ).EndUseSubcategory, "Plant" );
+					SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Total Heat Transfer Rate [W]", RefrigRack( SetupReportInputRackNum ).RackCapacity, "HVAC", "Average", RefrigRack( SetupReportInputRackNum ).Name );
+					SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Total Heat Transfer Energy [J]", RefrigRack( SetupReportInputRackNum ).RackCoolingEnergy, "HVAC", "Sum", RefrigRack( SetupReportInputRackNum ).Name, _, "ENERGYTRANSFER", "REFRIGERATION", RefrigRack( SetupReportInputRackNum ).EndUseSubcategory, "Plant" );
+					SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack COP [W/W]", RefrigRack( SetupReportInputRackNum ).RackCompressorCOP, "HVAC", "Average", RefrigRack( SetupReportInputRackNum ).Name );
+
+					if ( RefrigRack( SetupReportInputRackNum ).CondenserType == RefrigCondenserTypeEvap ) {
+						SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Evaporative Condenser Pump Electric Power [W]", RefrigRack( SetupReportInputRackNum ).ActualEvapPumpPower, "HVAC", "Average", RefrigRack( SetupReportInputRackNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Evaporative Condenser Pump Electric Energy [J]", RefrigRack( SetupReportInputRackNum ).EvapPumpConsumption, "HVAC", "Sum", RefrigRack( SetupReportInputRackNum ).Name, _, "ELECTRICITY", "REFRIGERATION", RefrigRack( SetupReportInputRackNum ).EndUseSubcategory, "Plant" );
+						SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Evaporative Condenser Basin Heater Electric Power [W]", RefrigRack( SetupReportInputRackNum ).BasinHeaterPower, "HVAC", "Average", RefrigRack( SetupReportInputRackNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Evaporative Condenser Basin Heater Electric Energy [J]", RefrigRack( SetupReportInputRackNum ).BasinHeaterConsumption, "HVAC", "Sum", RefrigRack( SetupReportInputRackNum ).Name, _, "ELECTRICITY", "REFRIGERATION", RefrigRack( SetupReportInputRackNum ).EndUseSubcategory, "Plant" );
+						SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Evaporative Condenser Water Volume Flow Rate [m3/s]", RefrigRack( SetupReportInputRackNum ).EvapWaterConsumpRate, "HVAC", "Average", RefrigRack( SetupReportInputRackNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Evaporative Condenser Water Volume [m3]", RefrigRack( SetupReportInputRackNum ).EvapWaterConsumption, "HVAC", "Sum", RefrigRack( SetupReportInputRackNum ).Name, _, "Water", "REFRIGERATION", RefrigRack( SetupReportInputRackNum ).EndUseSubcategory, "Plant" );
 					} //Evap condenser
 
-					if ( RefrigRack( RackNum ).HeatRejectionLocation == LocationZone ) {
-						SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Zone Sensible Heating Rate [W]", RefrigRack( RackNum ).SensZoneCreditHeatRate, "HVAC", "Average", RefrigRack( RackNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Zone Sensible Heating Energy [J]", RefrigRack( RackNum ).SensZoneCreditHeat, "HVAC", "Sum", RefrigRack( RackNum ).Name );
+					if ( RefrigRack( SetupReportInputRackNum ).HeatRejectionLocation == LocationZone ) {
+						SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Zone Sensible Heating Rate [W]", RefrigRack( SetupReportInputRackNum ).SensZoneCreditHeatRate, "HVAC", "Average", RefrigRack( SetupReportInputRackNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Zone Sensible Heating Energy [J]", RefrigRack( SetupReportInputRackNum ).SensZoneCreditHeat, "HVAC", "Sum", RefrigRack( SetupReportInputRackNum ).Name );
 
-						SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Return Air Sensible Heating Rate [W]", RefrigRack( RackNum ).SensHVACCreditHeatRate, "HVAC", "Average", RefrigRack( RackNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Return Air Sensible Heating Energy [J]", RefrigRack( RackNum ).SensHVACCreditHeat, "HVAC", "Sum", RefrigRack( RackNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Return Air Sensible Heating Rate [W]", RefrigRack( SetupReportInputRackNum ).SensHVACCreditHeatRate, "HVAC", "Average", RefrigRack( SetupReportInputRackNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller Compressor Rack Return Air Sensible Heating Energy [J]", RefrigRack( SetupReportInputRackNum ).SensHVACCreditHeat, "HVAC", "Sum", RefrigRack( SetupReportInputRackNum ).Name );
 
-						SetupZoneInternalGain( RefrigCase( RefrigRack( RackNum ).CaseNum( 1 ) ).ActualZoneNum, "Refrigeration:CompressorRack", RefrigRack( RackNum ).Name, IntGainTypeOf_RefrigerationCompressorRack, RefrigRack( RackNum ).SensZoneCreditHeatRate, RefrigRack( RackNum ).SensHVACCreditHeatRate );
+						SetupZoneInternalGain( RefrigCase( RefrigRack( SetupReportInputRackNum ).CaseNum( 1 ) ).ActualZoneNum, "Refrigeration:CompressorRack", RefrigRack( SetupReportInputRackNum ).Name, IntGainTypeOf_RefrigerationCompressorRack, RefrigRack( SetupReportInputRackNum ).SensZoneCreditHeatRate, RefrigRack( SetupReportInputRackNum ).SensHVACCreditHeatRate );
 
 					} //LocationZone
 
 				} else { // Rack serves cases and walkins on zone (load) time step
 
-					SetupOutputVariable( "Refrigeration Compressor Rack Electric Power [W]", RefrigRack( RackNum ).RackCompressorPower, "Zone", "Average", RefrigRack( RackNum ).Name );
-					SetupOutputVariable( "Refrigeration Compressor Rack Electric Energy [J]", RefrigRack( RackNum ).RackElecConsumption, "Zone", "Sum", RefrigRack( RackNum ).Name, _, "ELECTRICITY", "REFRIGERATION", RefrigRack( RackNum ).EndUseSubcategory, "Plant" );
-					SetupOutputVariable( "Refrigeration Compressor Rack Condenser Fan Electric Power [W]", RefrigRack( RackNum ).ActualCondenserFanPower, "Zone", "Average", RefrigRack( RackNum ).Name );
-					SetupOutputVariable( "Refrigeration Compressor Rack Condenser Fan Electric Energy [J]", RefrigRack( RackNum ).CondenserFanConsumption, "Zone", "Sum", RefrigRack( RackNum ).Name, _, "ELECTRICITY", "REFRIGERATION", RefrigRack( RackNum ).EndUseSubcategory, "Plant" );
-					SetupOutputVariable( "Refrigeration Compressor Rack Total Heat Transfer Rate [W]", RefrigRack( RackNum ).RackCapacity, "Zone", "Average", RefrigRack( RackNum ).Name );
-					SetupOutputVariable( "Refrigeration Compressor Rack Total Heat Transfer Energy [J]", RefrigRack( RackNum ).RackCoolingEnergy, "Zone", "Sum", RefrigRack( RackNum ).Name, _, "ENERGYTRANSFER", "REFRIGERATION", RefrigRack( RackNum ).EndUseSubcategory, "Plant" );
-					SetupOutputVariable( "Refrigeration Compressor Rack COP [W/W]", RefrigRack( RackNum ).RackCompressorCOP, "Zone", "Average", RefrigRack( RackNum ).Name );
-
-					if ( RefrigRack( RackNum ).CondenserType == RefrigCondenserTypeEvap ) {
-						SetupOutputVariable( "Refrigeration Compressor Rack Evaporative Condenser Pump Electric Power [W]", RefrigRack( RackNum ).ActualEvapPumpPower, "Zone", "Average", RefrigRack( RackNum ).Name );
-						SetupOutputVariable( "Refrigeration Compressor Rack Evaporative Condenser Pump Electric Energy [J]", RefrigRack( RackNum ).EvapPumpConsumption, "Zone", "Sum", RefrigRack( RackNum ).Name, _, "ELECTRICITY", "REFRIGERATION", RefrigRack( RackNum ).EndUseSubcategory, "Plant" );
-						SetupOutputVariable( "Refrigeration Compressor Rack Evaporative Condenser Basin Heater Electric Power [W]", RefrigRack( RackNum ).BasinHeaterPower, "Zone", "Average", RefrigRack( RackNum ).Name );
-						SetupOutputVariable( "Refrigeration Compressor Rack Evaporative Condenser Basin Heater Electric Energy [J]", RefrigRack( RackNum ).BasinHeaterConsumption, "Zone", "Sum", RefrigRack( RackNum ).Name, _, "ELECTRICITY", "REFRIGERATION", RefrigRack( RackNum ).EndUseSubcategory, "Plant" );
-						SetupOutputVariable( "Refrigeration Compressor Rack Evaporative Condenser Water Volume Flow Rate [m3/s]", RefrigRack( RackNum ).EvapWaterConsumpRate, "Zone", "Average", RefrigRack( RackNum ).Name );
-						SetupOutputVariable( "Refrigeration Compressor Rack Evaporative Condenser Water Volume [m3]", RefrigRack( RackNum ).EvapWaterConsumption, "Zone", "Sum", RefrigRack( RackNum ).Name, _, "Water", "REFRIGERATION", RefrigRack( RackNum ).EndUseSubcategory, "Plant" );
+					SetupOutputVariable( "Refrigeration Compressor Rack Electric Power [W]", RefrigRack( SetupReportInputRackNum ).RackCompressorPower, "Zone", "Average", RefrigRack( SetupReportInputRackNum ).Name );
+					SetupOutputVariable( "Refrigeration Compressor Rack Electric Energy [J]", RefrigRack( SetupReportInputRackNum ).RackElecConsumption, "Zone", "Sum", RefrigRack( SetupReportInputRackNum ).Name, _, "ELECTRICITY", "REFRIGERATION", RefrigRack( SetupReportInputRackNum ).EndUseSubcategory, "Plant" );
+					SetupOutputVariable( "Refrigeration Compressor Rack Condenser Fan Electric Power [W]", RefrigRack( SetupReportInputRackNum ).ActualCondenserFanPower, "Zone", "Average", RefrigRack( SetupReportInputRackNum ).Name );
+					SetupOutputVariable( "Refrigeration Compressor Rack Condenser Fan Electric Energy [J]", RefrigRack( SetupReportInputRackNum ).CondenserFanConsumption, "Zone", "Sum", RefrigRack( SetupReportInputRackNum ).Name, _, "ELECTRICITY", "REFRIGERATION", RefrigRack( SetupReportInputRackNum ).EndUseSubcategory, "Plant" );
+					SetupOutputVariable( "Refrigeration Compressor Rack Total Heat Transfer Rate [W]", RefrigRack( SetupReportInputRackNum ).RackCapacity, "Zone", "Average", RefrigRack( SetupReportInputRackNum ).Name );
+					SetupOutputVariable( "Refrigeration Compressor Rack Total Heat Transfer Energy [J]", RefrigRack( SetupReportInputRackNum ).RackCoolingEnergy, "Zone", "Sum", RefrigRack( SetupReportInputRackNum ).Name, _, "ENERGYTRANSFER", "REFRIGERATION", RefrigRack( SetupReportInputRackNum ).EndUseSubcategory, "Plant" );
+					SetupOutputVariable( "Refrigeration Compressor Rack COP [W/W]", RefrigRack( SetupReportInputRackNum ).RackCompressorCOP, "Zone", "Average", RefrigRack( SetupReportInputRackNum ).Name );
+
+					if ( RefrigRack( SetupReportInputRackNum ).CondenserType == RefrigCondenserTypeEvap ) {
+						SetupOutputVariable( "Refrigeration Compressor Rack Evaporative Condenser Pump Electric Power [W]", RefrigRack( SetupReportInputRackNum ).ActualEvapPumpPower, "Zone", "Average", RefrigRack( SetupReportInputRackNum ).Name );
+						SetupOutputVariable( "Refrigeration Compressor Rack Evaporative Condenser Pump Electric Energy [J]", RefrigRack( SetupReportInputRackNum ).EvapPumpConsumption, "Zone", "Sum", RefrigRack( SetupReportInputRackNum ).Name, _, "ELECTRICITY", "REFRIGERATION", RefrigRack( SetupReportInputRackNum ).EndUseSubcategory, "Plant" );
+						SetupOutputVariable( "Refrigeration Compressor Rack Evaporative Condenser Basin Heater Electric Power [W]", RefrigRack( SetupReportInputRackNum ).BasinHeaterPower, "Zone", "Average", RefrigRack( SetupReportInputRackNum ).Name );
+						SetupOutputVariable( "Refrigeration Compressor Rack Evaporative Condenser Basin Heater Electric Energy [J]", RefrigRack( SetupReportInputRackNum ).BasinHeaterConsumption, "Zone", "Sum", RefrigRack( SetupReportInputRackNum ).Name, _, "ELECTRICITY", "REFRIGERATION", RefrigRack( SetupReportInputRackNum ).EndUseSubcategory, "Plant" );
+						SetupOutputVariable( "Refrigeration Compressor Rack Evaporative Condenser Water Volume Flow Rate [m3/s]", RefrigRack( SetupReportInputRackNum ).EvapWaterConsumpRate, "Zone", "Average", RefrigRack( SetupReportInputRackNum ).Name );
+						SetupOutputVariable( "Refrigeration Compressor Rack Evaporative Condenser Water Volume [m3]", RefrigRack( SetupReportInputRackNum ).EvapWaterConsumption, "Zone", "Sum", RefrigRack( SetupReportInputRackNum ).Name, _, "Water", "REFRIGERATION", RefrigRack( SetupReportInputRackNum ).EndUseSubcategory, "Plant" );
 					} //condenser evap
 
-					if ( RefrigRack( RackNum ).HeatRejectionLocation == LocationZone ) {
-						SetupOutputVariable( "Refrigeration Compressor Rack Zone Sensible Heating Rate [W]", RefrigRack( RackNum ).SensZoneCreditHeatRate, "Zone", "Average", RefrigRack( RackNum ).Name );
-						SetupOutputVariable( "Refrigeration Compressor Rack Zone Sensible Heating Energy [J]", RefrigRack( RackNum ).SensZoneCreditHeat, "Zone", "Sum", RefrigRack( RackNum ).Name );
+					if ( RefrigRack( SetupReportInputRackNum ).HeatRejectionLocation == LocationZone ) {
+						SetupOutputVariable( "Refrigeration Compressor Rack Zone Sensible Heating Rate [W]", RefrigRack( SetupReportInputRackNum ).SensZoneCreditHeatRate, "Zone", "Average", RefrigRack( SetupReportInputRackNum ).Name );
+						SetupOutputVariable( "Refrigeration Compressor Rack Zone Sensible Heating Energy [J]", RefrigRack( SetupReportInputRackNum ).SensZoneCreditHeat, "Zone", "Sum", RefrigRack( SetupReportInputRackNum ).Name );
 
-						SetupOutputVariable( "Refrigeration Compressor Rack Return Air Sensible Heating Rate [W]", RefrigRack( RackNum ).SensHVACCreditHeatRate, "Zone", "Average", RefrigRack( RackNum ).Name );
-						SetupOutputVariable( "Refrigeration Compressor Rack Return Air Sensible Heating Energy [J]", RefrigRack( RackNum ).SensHVACCreditHeat, "Zone", "Sum", RefrigRack( RackNum ).Name );
-						SetupZoneInternalGain( RefrigCase( RefrigRack( RackNum ).CaseNum( 1 ) ).ActualZoneNum, "Refrigeration:CompressorRack", RefrigRack( RackNum ).Name, IntGainTypeOf_RefrigerationCompressorRack, RefrigRack( RackNum ).SensZoneCreditHeatRate, RefrigRack( RackNum ).SensHVACCreditHeatRate );
+						SetupOutputVariable( "Refrigeration Compressor Rack Return Air Sensible Heating Rate [W]", RefrigRack( SetupReportInputRackNum ).SensHVACCreditHeatRate, "Zone", "Average", RefrigRack( SetupReportInputRackNum ).Name );
+						SetupOutputVariable( "Refrigeration Compressor Rack Return Air Sensible Heating Energy [J]", RefrigRack( SetupReportInputRackNum ).SensHVACCreditHeat, "Zone", "Sum", RefrigRack( SetupReportInputRackNum ).Name );
+						SetupZoneInternalGain( RefrigCase( RefrigRack( SetupReportInputRackNum ).CaseNum( 1 ) ).ActualZoneNum, "Refrigeration:CompressorRack", RefrigRack( SetupReportInputRackNum ).Name, IntGainTypeOf_RefrigerationCompressorRack, RefrigRack( SetupReportInputRackNum ).SensZoneCreditHeatRate, RefrigRack( SetupReportInputRackNum ).SensHVACCreditHeatRate );
 
 					} //location zone
 				} // Serves coils or case/walkin loads
 
-				if ( RefrigRack( RackNum ).CondenserType == RefrigCondenserTypeWater ) { //on HVAC time step no matter what
-					SetupOutputVariable( "Refrigeration Compressor Rack Condenser Mass Flow Rate [kg/s]", RefrigRack( RackNum ).MassFlowRate, "HVAC", "Average", RefrigRack( RackNum ).Name );
+				if ( RefrigRack( SetupReportInputRackNum ).CondenserType == RefrigCondenserTypeWater ) { //on HVAC time step no matter what
+					SetupOutputVariable( "Refrigeration Compressor Rack Condenser Mass Flow Rate [kg/s]", RefrigRack( SetupReportInputRackNum ).MassFlowRate, "HVAC", "Average", RefrigRack( SetupReportInputRackNum ).Name );
 
-					SetupOutputVariable( "Refrigeration Compressor Rack Condenser Heat Transfer Rate [W]", RefrigRack( RackNum ).CondLoad, "HVAC", "Average", RefrigRack( RackNum ).Name );
+					SetupOutputVariable( "Refrigeration Compressor Rack Condenser Heat Transfer Rate [W]", RefrigRack( SetupReportInputRackNum ).CondLoad, "HVAC", "Average", RefrigRack( SetupReportInputRackNum ).Name );
 
-					SetupOutputVariable( "Refrigeration Compressor Rack Condenser Heat Transfer Energy [J]", RefrigRack( RackNum ).CondEnergy, "HVAC", "Sum", RefrigRack( RackNum ).Name, _, "ENERGYTRANSFER", "Heating", _, "Plant" );
+					SetupOutputVariable( "Refrigeration Compressor Rack Condenser Heat Transfer Energy [J]", RefrigRack( SetupReportInputRackNum ).CondEnergy, "HVAC", "Sum", RefrigRack( SetupReportInputRackNum ).Name, _, "ENERGYTRANSFER", "Heating", _, "Plant" );
 
 				} //Condenser cooling water
 			} //Refrigerated Racks
@@ -6170,198 +7041,198 @@ namespace RefrigeratedCase {
 
 		if ( NumRefrigSystems > 0 ) {
 			// CurrentModuleObject='Refrigeration:System'
-			for ( RefrigSysNum = 1; RefrigSysNum <= NumRefrigSystems; ++RefrigSysNum ) {
-				if ( System( RefrigSysNum ).CoilFlag ) { //system serves chillers and is solved on HVAC time step
-					if ( System( RefrigSysNum ).NumStages == 1 ) {
-						SetupOutputVariable( "Refrigeration Air Chiller System Total Compressor Electric Power [W]", System( RefrigSysNum ).TotCompPower, "HVAC", "Average", System( RefrigSysNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Total Compressor Electric Energy [J]", System( RefrigSysNum ).TotCompElecConsump, "HVAC", "Sum", System( RefrigSysNum ).Name );
-					} else if ( System( RefrigSysNum ).NumStages == 2 ) {
-						SetupOutputVariable( "Refrigeration Air Chiller System Total Low Stage Compressor Electric Power [W]", System( RefrigSysNum ).TotCompPower, "HVAC", "Average", System( RefrigSysNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Total Low Stage Compressor Electric Energy [J]", System( RefrigSysNum ).TotCompElecConsump, "HVAC", "Sum", System( RefrigSysNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Total High Stage Compressor Electric Power [W]", System( RefrigSysNum ).TotHiStageCompPower, "HVAC", "Average", System( RefrigSysNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Total High Stage Compressor Electric Energy [J]", System( RefrigSysNum ).TotHiStageCompElecConsump, "HVAC", "Sum", System( RefrigSysNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Total Low and High Stage Compressor Electric Energy [J]", System( RefrigSysNum ).TotCompElecConsumpTwoStage, "HVAC", "Sum", System( RefrigSysNum ).Name );
+			for ( SetupReportInputRefrigSysNum = 1; SetupReportInputRefrigSysNum <= NumRefrigSystems; ++SetupReportInputRefrigSysNum ) {
+				if ( System( SetupReportInputRefrigSysNum ).CoilFlag ) { //system serves chillers and is solved on HVAC time step
+					if ( System( SetupReportInputRefrigSysNum ).NumStages == 1 ) {
+						SetupOutputVariable( "Refrigeration Air Chiller System Total Compressor Electric Power [W]", System( SetupReportInputRefrigSysNum ).TotCompPower, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Total Compressor Electric Energy [J]", System( SetupReportInputRefrigSysNum ).TotCompElecConsump, "HVAC", "Sum", System( SetupReportInputRefrigSysNum ).Name );
+					} else if ( System( SetupReportInputRefrigSysNum ).NumStages == 2 ) {
+						SetupOutputVariable( "Refrigeration Air Chiller System Total Low Stage Compressor Electric Power [W]", System( SetupReportInputRefrigSysNum ).TotCompPower, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Total Low Stage Compressor Electric Energy [J]", System( SetupReportInputRefrigSysNum ).TotCompElecConsump, "HVAC", "Sum", System( SetupReportInputRefrigSysNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Total High Stage Compressor Electric Power [W]", System( SetupReportInputRefrigSysNum ).TotHiStageCompPower, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Total High Stage Compressor Electric Energy [J]", System( SetupReportInputRefrigSysNum ).TotHiStageCompElecConsump, "HVAC", "Sum", System( SetupReportInputRefrigSysNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Total Low and High Stage Compressor Electric Energy [J]", System( SetupReportInputRefrigSysNum ).TotCompElecConsumpTwoStage, "HVAC", "Sum", System( SetupReportInputRefrigSysNum ).Name );
 					} // NumStages
-					SetupOutputVariable( "Refrigeration Air Chiller System Average Compressor COP [W/W]", System( RefrigSysNum ).AverageCompressorCOP, "HVAC", "Average", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Air Chiller System Total Air Chiller Heat Transfer Rate [W]", System( RefrigSysNum ).TotalCoolingLoad, "HVAC", "Average", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Air Chiller System Total Case and Walk In Heat Transfer Energy [J]", System( RefrigSysNum ).TotalCoolingEnergy, "HVAC", "Sum", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Air Chiller System Total Transferred Load Heat Transfer Rate [W]", System( RefrigSysNum ).TotTransferLoad, "HVAC", "Average", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Air Chiller System Total Transferred Load Heat Transfer Energy [J]", System( RefrigSysNum ).TotTransferEnergy, "HVAC", "Sum", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Air Chiller System Total Suction Pipe Heat Gain Rate [W]", System( RefrigSysNum ).PipeHeatLoad, "HVAC", "Average", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Air Chiller System Total Suction Pipe Heat Gain Energy [J]", System( RefrigSysNum ).PipeHeatEnergy, "HVAC", "Sum", System( RefrigSysNum ).Name );
-					if ( System( RefrigSysNum ).NumStages == 1 ) {
-						SetupOutputVariable( "Refrigeration Air Chiller System Total Compressor Heat Transfer Rate [W]", System( RefrigSysNum ).TotCompCapacity, "HVAC", "Average", System( RefrigSysNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Total Compressor Heat Transfer Energy [J]", System( RefrigSysNum ).TotCompCoolingEnergy, "HVAC", "Sum", System( RefrigSysNum ).Name ); //indiv compressors go to meter, not system sum
-					} else if ( System( RefrigSysNum ).NumStages == 2 ) {
-						SetupOutputVariable( "Refrigeration Air Chiller System Total Low Stage Compressor Heat Transfer Rate [W]", System( RefrigSysNum ).TotCompCapacity, "HVAC", "Average", System( RefrigSysNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Total Low Stage Compressor Heat Transfer Energy [J]", System( RefrigSysNum ).TotCompCoolingEnergy, "HVAC", "Sum", System( RefrigSysNum ).Name ); //indiv compressors go to meter, not system sum
-						SetupOutputVariable( "Refrigeration Air Chiller System Total High Stage Compressor Heat Transfer Rate [W]", System( RefrigSysNum ).TotHiStageCompCapacity, "HVAC", "Average", System( RefrigSysNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Total High Stage Compressor Heat Transfer Energy [J]", System( RefrigSysNum ).TotHiStageCompCoolingEnergy, "HVAC", "Sum", System( RefrigSysNum ).Name ); //indiv compressors go to meter, not system sum
+					SetupOutputVariable( "Refrigeration Air Chiller System Average Compressor COP [W/W]", System( SetupReportInputRefrigSysNum ).AverageCompressorCOP, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Air Chiller System Total Air Chiller Heat Transfer Rate [W]", System( SetupReportInputRefrigSysNum ).TotalCoolingLoad, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Air Chiller System Total Case and Walk In Heat Transfer Energy [J]", System( SetupReportInputRefrigSysNum ).TotalCoolingEnergy, "HVAC", "Sum", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Air Chiller System Total Transferred Load Heat Transfer Rate [W]", System( SetupReportInputRefrigSysNum ).TotTransferLoad, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Air Chiller System Total Transferred Load Heat Transfer Energy [J]", System( SetupReportInputRefrigSysNum ).TotTransferEnergy, "HVAC", "Sum", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Air Chiller System Total Suction Pipe Heat Gain Rate [W]", System( SetupReportInputRefrigSysNum ).PipeHeatLoad, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Air Chiller System Total Suction Pipe Heat Gain Energy [J]", System( SetupReportInputRefrigSysNum ).PipeHeatEnergy, "HVAC", "Sum", System( SetupReportInputRefrigSysNum ).Name );
+					if ( System( SetupReportInputRefrigSysNum ).NumStages == 1 ) {
+						SetupOutputVariable( "Refrigeration Air Chiller System Total Compressor Heat Transfer Rate [W]", System( SetupReportInputRefrigSysNum ).TotCompCapacity, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Total Compressor Heat Transfer Energy [J]", System( SetupReportInputRefrigSysNum ).TotCompCoolingEnergy, "HVAC", "Sum", System( SetupReportInputRefrigSysNum ).Name ); //indiv compressors go to meter, not system sum
+					} else if ( System( SetupReportInputRefrigSysNum ).NumStages == 2 ) {
+						SetupOutputVariable( "Refrigeration Air Chiller System Total Low Stage Compressor Heat Transfer Rate [W]", System( SetupReportInputRefrigSysNum ).TotCompCapacity, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Total Low Stage Compressor Heat Transfer Energy [J]", System( SetupReportInputRefrigSysNum ).TotCompCoolingEnergy, "HVAC", "Sum", System( SetupReportInputRefrigSysNum ).Name ); //indiv compressors go to meter, not system sum
+						SetupOutputVariable( "Refrigeration Air Chiller System Total High Stage Compressor Heat Transfer Rate [W]", System( SetupReportInputRefrigSysNum ).TotHiStageCompCapacity, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Total High Stage Compressor Heat Transfer Energy [J]", System( SetupReportInputRefrigSysNum ).TotHiStageCompCoolingEnergy, "HVAC", "Sum", System( SetupReportInputRefrigSysNum ).Name ); //indiv compressors go to meter, not system sum
 					} // NumStages
-					SetupOutputVariable( "Refrigeration Air Chiller System Net Rejected Heat Transfer Rate [W]", System( RefrigSysNum ).NetHeatRejectLoad, "HVAC", "Average", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Air Chiller System Net Rejected Heat Transfer Energy [J]", System( RefrigSysNum ).NetHeatRejectEnergy, "HVAC", "Sum", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Air Chiller System Estimated Refrigerant Inventory Mass [kg]", System( RefrigSysNum ).RefInventory, "HVAC", "Average", System( RefrigSysNum ).Name );
-					if ( System( RefrigSysNum ).NumStages == 1 ) {
-						SetupOutputVariable( "Refrigeration Air Chiller System Estimated Refrigerant Mass Flow Rate [kg/s]", System( RefrigSysNum ).RefMassFlowComps, "HVAC", "Average", System( RefrigSysNum ).Name );
-					} else if ( System( RefrigSysNum ).NumStages == 2 ) {
-						SetupOutputVariable( "Refrigeration Air Chiller System Estimated Low Stage Refrigerant Mass Flow Rate [kg/s]", System( RefrigSysNum ).RefMassFlowComps, "HVAC", "Average", System( RefrigSysNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Estimated High Stage Refrigerant Mass Flow Rate [kg/s]", System( RefrigSysNum ).RefMassFlowHiStageComps, "HVAC", "Average", System( RefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Air Chiller System Net Rejected Heat Transfer Rate [W]", System( SetupReportInputRefrigSysNum ).NetHeatRejectLoad, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Air Chiller System Net Rejected Heat Transfer Energy [J]", System( SetupReportInputRefrigSysNum ).NetHeatRejectEnergy, "HVAC", "Sum", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Air Chiller System Estimated Refrigerant Inventory Mass [kg]", System( SetupReportInputRefrigSysNum ).RefInventory, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					if ( System( SetupReportInputRefrigSysNum ).NumStages == 1 ) {
+						SetupOutputVariable( "Refrigeration Air Chiller System Estimated Refrigerant Mass Flow Rate [kg/s]", System( SetupReportInputRefrigSysNum ).RefMassFlowComps, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					} else if ( System( SetupReportInputRefrigSysNum ).NumStages == 2 ) {
+						SetupOutputVariable( "Refrigeration Air Chiller System Estimated Low Stage Refrigerant Mass Flow Rate [kg/s]", System( SetupReportInputRefrigSysNum ).RefMassFlowComps, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Estimated High Stage Refrigerant Mass Flow Rate [kg/s]", System( SetupReportInputRefrigSysNum ).RefMassFlowHiStageComps, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
 					} // NumStages
-					if ( System( RefrigSysNum ).NumStages == 2 ) {
-						SetupOutputVariable( "Refrigeration Air Chiller System Intercooler Temperature [C]", System( RefrigSysNum ).TIntercooler, "HVAC", "Average", System( RefrigSysNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Intercooler Pressure [Pa]", System( RefrigSysNum ).PIntercooler, "HVAC", "Average", System( RefrigSysNum ).Name );
-					}
-					SetupOutputVariable( "Refrigeration Air Chiller System Condensing Temperature [C]", System( RefrigSysNum ).TCondense, "HVAC", "Average", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Air Chiller System Evaporating Temperature [C]", System( RefrigSysNum ).TEvapNeeded, "HVAC", "Average", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Air Chiller System Suction Temperature [C]", System( RefrigSysNum ).TCompIn, "HVAC", "Average", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Air Chiller System TXV Liquid Temperature [C]", System( RefrigSysNum ).TLiqInActual, "HVAC", "Average", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Air Chiller System Liquid Suction Subcooler Heat Transfer Rate [W]", System( RefrigSysNum ).LSHXTrans, "HVAC", "Average", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Air Chiller System Liquid Suction Subcooler Heat Transfer Energy [J]", System( RefrigSysNum ).LSHXTransEnergy, "HVAC", "Sum", System( RefrigSysNum ).Name );
+					if ( System( SetupReportInputRefrigSysNum ).NumStages == 2 ) {
+						SetupOutputVariable( "Refrigeration Air Chiller System Intercooler Temperature [C]", System( SetupReportInputRefrigSysNum ).TIntercooler, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Intercooler Pressure [Pa]", System( SetupReportInputRefrigSysNum ).PIntercooler, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					}
+					SetupOutputVariable( "Refrigeration Air Chiller System Condensing Temperature [C]", System( SetupReportInputRefrigSysNum ).TCondense, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Air Chiller System Evaporating Temperature [C]", System( SetupReportInputRefrigSysNum ).TEvapNeeded, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Air Chiller System Suction Temperature [C]", System( SetupReportInputRefrigSysNum ).TCompIn, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Air Chiller System TXV Liquid Temperature [C]", System( SetupReportInputRefrigSysNum ).TLiqInActual, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Air Chiller System Liquid Suction Subcooler Heat Transfer Rate [W]", System( SetupReportInputRefrigSysNum ).LSHXTrans, "HVAC", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Air Chiller System Liquid Suction Subcooler Heat Transfer Energy [J]", System( SetupReportInputRefrigSysNum ).LSHXTransEnergy, "HVAC", "Sum", System( SetupReportInputRefrigSysNum ).Name );
 				} else { // NOT System(SysNum)%CoilFlag, so serving loads on zone timestep
-					if ( System( RefrigSysNum ).NumStages == 1 ) {
-						SetupOutputVariable( "Refrigeration System Total Compressor Electric Power [W]", System( RefrigSysNum ).TotCompPower, "Zone", "Average", System( RefrigSysNum ).Name );
-						SetupOutputVariable( "Refrigeration System Total Compressor Electric Energy [J]", System( RefrigSysNum ).TotCompElecConsump, "Zone", "Sum", System( RefrigSysNum ).Name );
-					} else if ( System( RefrigSysNum ).NumStages == 2 ) {
-						SetupOutputVariable( "Refrigeration System Total Low Stage Compressor Electric Power [W]", System( RefrigSysNum ).TotCompPower, "Zone", "Average", System( RefrigSysNum ).Name );
-						SetupOutputVariable( "Refrigeration System Total Low Stage Compressor Electric Energy [J]", System( RefrigSysNum ).TotCompElecConsump, "Zone", "Sum", System( RefrigSysNum ).Name );
-						SetupOutputVariable( "Refrigeration System Total High Stage Compressor Electric Power [W]", System( RefrigSysNum ).TotHiStageCompPower, "Zone", "Average", System( RefrigSysNum ).Name );
-						SetupOutputVariable( "Refrigeration System Total High Stage Compressor Electric Energy [J]", System( RefrigSysNum ).TotHiStageCompElecConsump, "Zone", "Sum", System( RefrigSysNum ).Name );
-						SetupOutputVariable( "Refrigeration System Total Low and High Stage Compressor Electric Energy [J]", System( RefrigSysNum ).TotCompElecConsumpTwoStage, "Zone", "Sum", System( RefrigSysNum ).Name );
+					if ( System( SetupReportInputRefrigSysNum ).NumStages == 1 ) {
+						SetupOutputVariable( "Refrigeration System Total Compressor Electric Power [W]", System( SetupReportInputRefrigSysNum ).TotCompPower, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+						SetupOutputVariable( "Refrigeration System Total Compressor Electric Energy [J]", System( SetupReportInputRefrigSysNum ).TotCompElecConsump, "Zone", "Sum", System( SetupReportInputRefrigSysNum ).Name );
+					} else if ( System( SetupReportInputRefrigSysNum ).NumStages == 2 ) {
+						SetupOutputVariable( "Refrigeration System Total Low Stage Compressor Electric Power [W]", System( SetupReportInputRefrigSysNum ).TotCompPower, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+						SetupOutputVariable( "Refrigeration System Total Low Stage Compressor Electric Energy [J]", System( SetupReportInputRefrigSysNum ).TotCompElecConsump, "Zone", "Sum", System( SetupReportInputRefrigSysNum ).Name );
+						SetupOutputVariable( "Refrigeration System Total High Stage Compressor Electric Power [W]", System( SetupReportInputRefrigSysNum ).TotHiStageCompPower, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+						SetupOutputVariable( "Refrigeration System Total High Stage Compressor Electric Energy [J]", System( SetupReportInputRefrigSysNum ).TotHiStageCompElecConsump, "Zone", "Sum", System( SetupReportInputRefrigSysNum ).Name );
+						SetupOutputVariable( "Refrigeration System Total Low and High Stage Compressor Electric Energy [J]", System( SetupReportInputRefrigSysNum ).TotCompElecConsumpTwoStage, "Zone", "Sum", System( SetupReportInputRefrigSysNum ).Name );
 					} // NumStages
-					SetupOutputVariable( "Refrigeration System Average Compressor COP [W/W]", System( RefrigSysNum ).AverageCompressorCOP, "Zone", "Average", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration System Total Cases and Walk Ins Heat Transfer Rate [W]", System( RefrigSysNum ).TotalCoolingLoad, "Zone", "Average", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration System Total Cases and Walk Ins Heat Transfer Energy [J]", System( RefrigSysNum ).TotalCoolingEnergy, "Zone", "Sum", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration System Total Transferred Load Heat Transfer Rate [W]", System( RefrigSysNum ).TotTransferLoad, "Zone", "Average", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration System Total Transferred Load Heat Transfer Energy [J]", System( RefrigSysNum ).TotTransferEnergy, "Zone", "Sum", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration System Total Suction Pipe Heat Gain Rate [W]", System( RefrigSysNum ).PipeHeatLoad, "Zone", "Average", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration System Total Suction Pipe Heat Gain Energy [J]", System( RefrigSysNum ).PipeHeatEnergy, "Zone", "Sum", System( RefrigSysNum ).Name );
-					if ( System( RefrigSysNum ).NumStages == 1 ) {
-						SetupOutputVariable( "Refrigeration System Total Compressor Heat Transfer Rate [W]", System( RefrigSysNum ).TotCompCapacity, "Zone", "Average", System( RefrigSysNum ).Name );
-						SetupOutputVariable( "Refrigeration System Total Compressor Heat Transfer Energy [J]", System( RefrigSysNum ).TotCompCoolingEnergy, "Zone", "Sum", System( RefrigSysNum ).Name ); //indiv compressors go to meter, not system sum
-					} else if ( System( RefrigSysNum ).NumStages == 2 ) {
-						SetupOutputVariable( "Refrigeration System Total Low Stage Compressor Heat Transfer Rate [W]", System( RefrigSysNum ).TotCompCapacity, "Zone", "Average", System( RefrigSysNum ).Name );
-						SetupOutputVariable( "Refrigeration System Total Low Stage Compressor Heat Transfer Energy [J]", System( RefrigSysNum ).TotCompCoolingEnergy, "Zone", "Sum", System( RefrigSysNum ).Name ); //indiv compressors go to meter, not system sum
-						SetupOutputVariable( "Refrigeration System Total High Stage Compressor Heat Transfer Rate [W]", System( RefrigSysNum ).TotHiStageCompCapacity, "Zone", "Average", System( RefrigSysNum ).Name );
-						SetupOutputVariable( "Refrigeration System Total High Stage Compressor Heat Transfer Energy [J]", System( RefrigSysNum ).TotHiStageCompCoolingEnergy, "Zone", "Sum", System( RefrigSysNum ).Name ); //indiv compressors go to meter, not system sum
+					SetupOutputVariable( "Refrigeration System Average Compressor COP [W/W]", System( SetupReportInputRefrigSysNum ).AverageCompressorCOP, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration System Total Cases and Walk Ins Heat Transfer Rate [W]", System( SetupReportInputRefrigSysNum ).TotalCoolingLoad, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration System Total Cases and Walk Ins Heat Transfer Energy [J]", System( SetupReportInputRefrigSysNum ).TotalCoolingEnergy, "Zone", "Sum", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration System Total Transferred Load Heat Transfer Rate [W]", System( SetupReportInputRefrigSysNum ).TotTransferLoad, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration System Total Transferred Load Heat Transfer Energy [J]", System( SetupReportInputRefrigSysNum ).TotTransferEnergy, "Zone", "Sum", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration System Total Suction Pipe Heat Gain Rate [W]", System( SetupReportInputRefrigSysNum ).PipeHeatLoad, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration System Total Suction Pipe Heat Gain Energy [J]", System( SetupReportInputRefrigSysNum ).PipeHeatEnergy, "Zone", "Sum", System( SetupReportInputRefrigSysNum ).Name );
+					if ( System( SetupReportInputRefrigSysNum ).NumStages == 1 ) {
+						SetupOutputVariable( "Refrigeration System Total Compressor Heat Transfer Rate [W]", System( SetupReportInputRefrigSysNum ).TotCompCapacity, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+						SetupOutputVariable( "Refrigeration System Total Compressor Heat Transfer Energy [J]", System( SetupReportInputRefrigSysNum ).TotCompCoolingEnergy, "Zone", "Sum", System( SetupReportInputRefrigSysNum ).Name ); //indiv compressors go to meter, not system sum
+					} else if ( System( SetupReportInputRefrigSysNum ).NumStages == 2 ) {
+						SetupOutputVariable( "Refrigeration System Total Low Stage Compressor Heat Transfer Rate [W]", System( SetupReportInputRefrigSysNum ).TotCompCapacity, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+						SetupOutputVariable( "Refrigeration System Total Low Stage Compressor Heat Transfer Energy [J]", System( SetupReportInputRefrigSysNum ).TotCompCoolingEnergy, "Zone", "Sum", System( SetupReportInputRefrigSysNum ).Name ); //indiv compressors go to meter, not system sum
+						SetupOutputVariable( "Refrigeration System Total High Stage Compressor Heat Transfer Rate [W]", System( SetupReportInputRefrigSysNum ).TotHiStageCompCapacity, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+						SetupOutputVariable( "Refrigeration System Total High Stage Compressor Heat Transfer Energy [J]", System( SetupReportInputRefrigSysNum ).TotHiStageCompCoolingEnergy, "Zone", "Sum", System( SetupReportInputRefrigSysNum ).Name ); //indiv compressors go to meter, not system sum
 					} // NumStages
-					SetupOutputVariable( "Refrigeration System Net Rejected Heat Transfer Rate [W]", System( RefrigSysNum ).NetHeatRejectLoad, "Zone", "Average", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration System Net Rejected Heat Transfer Energy [J]", System( RefrigSysNum ).NetHeatRejectEnergy, "Zone", "Sum", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration System Estimated Refrigerant Inventory Mass [kg]", System( RefrigSysNum ).RefInventory, "Zone", "Average", System( RefrigSysNum ).Name );
-					if ( System( RefrigSysNum ).NumStages == 1 ) {
-						SetupOutputVariable( "Refrigeration System Estimated Refrigerant Mass Flow Rate [kg/s]", System( RefrigSysNum ).RefMassFlowComps, "Zone", "Average", System( RefrigSysNum ).Name );
-					} else if ( System( RefrigSysNum ).NumStages == 2 ) {
-						SetupOutputVariable( "Refrigeration System Estimated Low Stage Refrigerant Mass Flow Rate [kg/s]", System( RefrigSysNum ).RefMassFlowComps, "Zone", "Average", System( RefrigSysNum ).Name );
-						SetupOutputVariable( "Refrigeration System Estimated High Stage Refrigerant Mass Flow Rate [kg/s]", System( RefrigSysNum ).RefMassFlowHiStageComps, "Zone", "Average", System( RefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration System Net Rejected Heat Transfer Rate [W]", System( SetupReportInputRefrigSysNum ).NetHeatRejectLoad, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration System Net Rejected Heat Transfer Energy [J]", System( SetupReportInputRefrigSysNum ).NetHeatRejectEnergy, "Zone", "Sum", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration System Estimated Refrigerant Inventory Mass [kg]", System( SetupReportInputRefrigSysNum ).RefInventory, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					if ( System( SetupReportInputRefrigSysNum ).NumStages == 1 ) {
+						SetupOutputVariable( "Refrigeration System Estimated Refrigerant Mass Flow Rate [kg/s]", System( SetupReportInputRefrigSysNum ).RefMassFlowComps, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					} else if ( System( SetupReportInputRefrigSysNum ).NumStages == 2 ) {
+						SetupOutputVariable( "Refrigeration System Estimated Low Stage Refrigerant Mass Flow Rate [kg/s]", System( SetupReportInputRefrigSysNum ).RefMassFlowComps, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+						SetupOutputVariable( "Refrigeration System Estimated High Stage Refrigerant Mass Flow Rate [kg/s]", System( SetupReportInputRefrigSysNum ).RefMassFlowHiStageComps, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
 					} // NumStages
-					if ( System( RefrigSysNum ).NumStages == 2 ) {
-						SetupOutputVariable( "Refrigeration System Intercooler Temperature [C]", System( RefrigSysNum ).TIntercooler, "Zone", "Average", System( RefrigSysNum ).Name );
-						SetupOutputVariable( "Refrigeration System Intercooler Pressure [Pa]", System( RefrigSysNum ).PIntercooler, "Zone", "Average", System( RefrigSysNum ).Name );
-					}
-					SetupOutputVariable( "Refrigeration System Condensing Temperature [C]", System( RefrigSysNum ).TCondense, "Zone", "Average", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration System Evaporating Temperature [C]", System( RefrigSysNum ).TEvapNeeded, "Zone", "Average", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration System Suction Pipe Suction Temperature [C]", System( RefrigSysNum ).TCompIn, "Zone", "Average", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration System Thermostatic Expansion Valve Liquid Temperature [C]", System( RefrigSysNum ).TLiqInActual, "Zone", "Average", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration System Liquid Suction Subcooler Heat Transfer Rate [W]", System( RefrigSysNum ).LSHXTrans, "Zone", "Average", System( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration System Liquid Suction Subcooler Heat Transfer Energy [J]", System( RefrigSysNum ).LSHXTransEnergy, "Zone", "Sum", System( RefrigSysNum ).Name );
+					if ( System( SetupReportInputRefrigSysNum ).NumStages == 2 ) {
+						SetupOutputVariable( "Refrigeration System Intercooler Temperature [C]", System( SetupReportInputRefrigSysNum ).TIntercooler, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+						SetupOutputVariable( "Refrigeration System Intercooler Pressure [Pa]", System( SetupReportInputRefrigSysNum ).PIntercooler, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					}
+					SetupOutputVariable( "Refrigeration System Condensing Temperature [C]", System( SetupReportInputRefrigSysNum ).TCondense, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration System Evaporating Temperature [C]", System( SetupReportInputRefrigSysNum ).TEvapNeeded, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration System Suction Pipe Suction Temperature [C]", System( SetupReportInputRefrigSysNum ).TCompIn, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration System Thermostatic Expansion Valve Liquid Temperature [C]", System( SetupReportInputRefrigSysNum ).TLiqInActual, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration System Liquid Suction Subcooler Heat Transfer Rate [W]", System( SetupReportInputRefrigSysNum ).LSHXTrans, "Zone", "Average", System( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration System Liquid Suction Subcooler Heat Transfer Energy [J]", System( SetupReportInputRefrigSysNum ).LSHXTransEnergy, "Zone", "Sum", System( SetupReportInputRefrigSysNum ).Name );
 				} //System(coilflag)
 
-				if ( System( RefrigSysNum ).SystemRejectHeatToZone ) {
-					if ( Condenser( System( RefrigSysNum ).CondenserNum( 1 ) ).InletAirZoneNum > 0 ) SetupZoneInternalGain( Condenser( System( RefrigSysNum ).CondenserNum( 1 ) ).InletAirZoneNum, "Refrigeration:System:Condenser:AirCooled", System( RefrigSysNum ).Name, IntGainTypeOf_RefrigerationSystemAirCooledCondenser, System( RefrigSysNum ).NetHeatRejectLoad );
+				if ( System( SetupReportInputRefrigSysNum ).SystemRejectHeatToZone ) {
+					if ( Condenser( System( SetupReportInputRefrigSysNum ).CondenserNum( 1 ) ).InletAirZoneNum > 0 ) SetupZoneInternalGain( Condenser( System( SetupReportInputRefrigSysNum ).CondenserNum( 1 ) ).InletAirZoneNum, "Refrigeration:System:Condenser:AirCooled", System( SetupReportInputRefrigSysNum ).Name, IntGainTypeOf_RefrigerationSystemAirCooledCondenser, System( SetupReportInputRefrigSysNum ).NetHeatRejectLoad );
 
-					if ( System( RefrigSysNum ).SuctionPipeActualZoneNum > 0 ) SetupZoneInternalGain( System( RefrigSysNum ).SuctionPipeActualZoneNum, "Refrigeration:System:SuctionPipe", System( RefrigSysNum ).Name, IntGainTypeOf_RefrigerationSystemSuctionPipe, System( RefrigSysNum ).PipeHeatLoad );
+					if ( System( SetupReportInputRefrigSysNum ).SuctionPipeActualZoneNum > 0 ) SetupZoneInternalGain( System( SetupReportInputRefrigSysNum ).SuctionPipeActualZoneNum, "Refrigeration:System:SuctionPipe", System( SetupReportInputRefrigSysNum ).Name, IntGainTypeOf_RefrigerationSystemSuctionPipe, System( SetupReportInputRefrigSysNum ).PipeHeatLoad );
 
 				}
 			} // numrefrigsystems
 
 			//Report Compressor ENERGY here, not on system level for meters.
-			for ( CompNum = 1; CompNum <= NumSimulationCompressors; ++CompNum ) {
+			for ( SetupReportInputCompNum = 1; SetupReportInputCompNum <= NumSimulationCompressors; ++SetupReportInputCompNum ) {
 				// CurrentModuleObject='Refrigeration:Compressor'
-				if ( Compressor( CompNum ).NumSysAttach == 1 ) { //only set up reports for compressors that are used once and only once
-					if ( Compressor( CompNum ).CoilFlag ) { //Compressor serving system with chillers on HVAC time step
-						SetupOutputVariable( "Refrigeration Air Chiller System Compressor Electric Power [W]", Compressor( CompNum ).Power, "HVAC", "Average", Compressor( CompNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Compressor Electric Energy [J]", Compressor( CompNum ).ElecConsumption, "HVAC", "Sum", Compressor( CompNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Compressor( CompNum ).EndUseSubcategory, "Plant" );
-						SetupOutputVariable( "Refrigeration Air Chiller System Compressor Heat Transfer Rate [W]", Compressor( CompNum ).Capacity, "HVAC", "Average", Compressor( CompNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Compressor Heat Transfer Energy [J]", Compressor( CompNum ).CoolingEnergy, "HVAC", "Sum", Compressor( CompNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Compressor Runtime Fraction []", Compressor( CompNum ).LoadFactor, "HVAC", "Average", Compressor( CompNum ).Name );
+				if ( Compressor( SetupReportInputCompNum ).NumSysAttach == 1 ) { //only set up reports for compressors that are used once and only once
+					if ( Compressor( SetupReportInputCompNum ).CoilFlag ) { //Compressor serving system with chillers on HVAC time step
+						SetupOutputVariable( "Refrigeration Air Chiller System Compressor Electric Power [W]", Compressor( SetupReportInputCompNum ).Power, "HVAC", "Average", Compressor( SetupReportInputCompNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Compressor Electric Energy [J]", Compressor( SetupReportInputCompNum ).ElecConsumption, "HVAC", "Sum", Compressor( SetupReportInputCompNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Compressor( SetupReportInputCompNum ).EndUseSubcategory, "Plant" );
+						SetupOutputVariable( "Refrigeration Air Chiller System Compressor Heat Transfer Rate [W]", Compressor( SetupReportInputCompNum ).Capacity, "HVAC", "Average", Compressor( SetupReportInputCompNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Compressor Heat Transfer Energy [J]", Compressor( SetupReportInputCompNum ).CoolingEnergy, "HVAC", "Sum", Compressor( SetupReportInputCompNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Compressor Runtime Fraction []", Compressor( SetupReportInputCompNum ).LoadFactor, "HVAC", "Average", Compressor( SetupReportInputCompNum ).Name );
 					} else { // serve cases/walkins on zone time step
-						SetupOutputVariable( "Refrigeration Compressor Electric Power [W]", Compressor( CompNum ).Power, "Zone", "Average", Compressor( CompNum ).Name );
-						SetupOutputVariable( "Refrigeration Compressor Electric Energy [J]", Compressor( CompNum ).ElecConsumption, "Zone", "Sum", Compressor( CompNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Compressor( CompNum ).EndUseSubcategory, "Plant" );
-						SetupOutputVariable( "Refrigeration Compressor Heat Transfer Rate [W]", Compressor( CompNum ).Capacity, "Zone", "Average", Compressor( CompNum ).Name );
-						SetupOutputVariable( "Refrigeration Compressor Heat Transfer Energy [J]", Compressor( CompNum ).CoolingEnergy, "Zone", "Sum", Compressor( CompNum ).Name );
-						SetupOutputVariable( "Refrigeration Compressor Runtime Fraction []", Compressor( CompNum ).LoadFactor, "Zone", "Average", Compressor( CompNum ).Name );
+						SetupOutputVariable( "Refrigeration Compressor Electric Power [W]", Compressor( SetupReportInputCompNum ).Power, "Zone", "Average", Compressor( SetupReportInputCompNum ).Name );
+						SetupOutputVariable( "Refrigeration Compressor Electric Energy [J]", Compressor( SetupReportInputCompNum ).ElecConsumption, "Zone", "Sum", Compressor( SetupReportInputCompNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Compressor( SetupReportInputCompNum ).EndUseSubcategory, "Plant" );
+						SetupOutputVariable( "Refrigeration Compressor Heat Transfer Rate [W]", Compressor( SetupReportInputCompNum ).Capacity, "Zone", "Average", Compressor( SetupReportInputCompNum ).Name );
+						SetupOutputVariable( "Refrigeration Compressor Heat Transfer Energy [J]", Compressor( SetupReportInputCompNum ).CoolingEnergy, "Zone", "Sum", Compressor( SetupReportInputCompNum ).Name );
+						SetupOutputVariable( "Refrigeration Compressor Runtime Fraction []", Compressor( SetupReportInputCompNum ).LoadFactor, "Zone", "Average", Compressor( SetupReportInputCompNum ).Name );
 					} // Serve coils on HVAC time step or cases/walkins on Zone time step
 				} // NumSysAttach
 			} //CompNum on NumSimulationCompressors
 
 			// Report Variables for Refrigeration Condensers
-			for ( CondNum = 1; CondNum <= NumRefrigCondensers; ++CondNum ) {
+			for ( SetupReportInputCondNum = 1; SetupReportInputCondNum <= NumRefrigCondensers; ++SetupReportInputCondNum ) {
 				// CurrentModuleObject='Refrigeration:Condenser:*'
-				if ( Condenser( CondNum ).CoilFlag ) { //Condenser serving system with chillers on HVAC time step
-					SetupOutputVariable( "Refrigeration Air Chiller System Condenser Heat Transfer Rate [W]", Condenser( CondNum ).CondLoad, "HVAC", "Average", Condenser( CondNum ).Name );
-					SetupOutputVariable( "Refrigeration Air Chiller System Condenser Heat Transfer Energy [J]", Condenser( CondNum ).CondEnergy, "HVAC", "Sum", Condenser( CondNum ).Name );
-
-					if ( Condenser( CondNum ).CondenserType != RefrigCondenserTypeCascade ) {
-						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Total Recovered Heat Transfer Rate [W]", Condenser( CondNum ).TotalHeatRecoveredLoad, "HVAC", "Average", Condenser( CondNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Total Recovered Heat Transfer Energy [J]", Condenser( CondNum ).TotalHeatRecoveredEnergy, "HVAC", "Sum", Condenser( CondNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Non Refrigeration Recovered Heat Transfer Rate [W]", Condenser( CondNum ).ExternalHeatRecoveredLoad, "HVAC", "Average", Condenser( CondNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Non Refrigeration Recovered Heat Transfer Energy [J]", Condenser( CondNum ).ExternalEnergyRecovered, "HVAC", "Sum", Condenser( CondNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Defrost Recovered Heat Transfer Rate [W]", Condenser( CondNum ).InternalHeatRecoveredLoad, "HVAC", "Average", Condenser( CondNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Defrost Recovered Heat Transfer Energy [J]", Condenser( CondNum ).InternalEnergyRecovered, "HVAC", "Sum", Condenser( CondNum ).Name );
+				if ( Condenser( SetupReportInputCondNum ).CoilFlag ) { //Condenser serving system with chillers on HVAC time step
+					SetupOutputVariable( "Refrigeration Air Chiller System Condenser Heat Transfer Rate [W]", Condenser( SetupReportInputCondNum ).CondLoad, "HVAC", "Average", Condenser( SetupReportInputCondNum ).Name );
+					SetupOutputVariable( "Refrigeration Air Chiller System Condenser Heat Transfer Energy [J]", Condenser( SetupReportInputCondNum ).CondEnergy, "HVAC", "Sum", Condenser( SetupReportInputCondNum ).Name );
+
+					if ( Condenser( SetupReportInputCondNum ).CondenserType != RefrigCondenserTypeCascade ) {
+						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Total Recovered Heat Transfer Rate [W]", Condenser( SetupReportInputCondNum ).TotalHeatRecoveredLoad, "HVAC", "Average", Condenser( SetupReportInputCondNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Total Recovered Heat Transfer Energy [J]", Condenser( SetupReportInputCondNum ).TotalHeatRecoveredEnergy, "HVAC", "Sum", Condenser( SetupReportInputCondNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Non Refrigeration Recovered Heat Transfer Rate [W]", Condenser( SetupReportInputCondNum ).ExternalHeatRecoveredLoad, "HVAC", "Average", Condenser( SetupReportInputCondNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Non Refrigeration Recovered Heat Transfer Energy [J]", Condenser( SetupReportInputCondNum ).ExternalEnergyRecovered, "HVAC", "Sum", Condenser( SetupReportInputCondNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Defrost Recovered Heat Transfer Rate [W]", Condenser( SetupReportInputCondNum ).InternalHeatRecoveredLoad, "HVAC", "Average", Condenser( SetupReportInputCondNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Defrost Recovered Heat Transfer Energy [J]", Condenser( SetupReportInputCondNum ).InternalEnergyRecovered, "HVAC", "Sum", Condenser( SetupReportInputCondNum ).Name );
 					} //not cascade because recovered energy on cascade systems passed up to higher temperature system
 
-					if ( Condenser( CondNum ).CondenserType == RefrigCondenserTypeAir ) {
-						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Fan Electric Power [W]", Condenser( CondNum ).ActualFanPower, "HVAC", "Average", Condenser( CondNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Fan Electric Energy [J]", Condenser( CondNum ).FanElecEnergy, "HVAC", "Sum", Condenser( CondNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Condenser( CondNum ).EndUseSubcategory, "Plant" );
+					if ( Condenser( SetupReportInputCondNum ).CondenserType == RefrigCondenserTypeAir ) {
+						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Fan Electric Power [W]", Condenser( SetupReportInputCondNum ).ActualFanPower, "HVAC", "Average", Condenser( SetupReportInputCondNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Fan Electric Energy [J]", Condenser( SetupReportInputCondNum ).FanElecEnergy, "HVAC", "Sum", Condenser( SetupReportInputCondNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Condenser( SetupReportInputCondNum ).EndUseSubcategory, "Plant" );
 					} //Air cooled
 
-					if ( Condenser( CondNum ).CondenserType == RefrigCondenserTypeEvap ) {
-						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Fan Electric Power [W]", Condenser( CondNum ).ActualFanPower, "HVAC", "Average", Condenser( CondNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Fan Electric Energy [J]", Condenser( CondNum ).FanElecEnergy, "HVAC", "Sum", Condenser( CondNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Condenser( CondNum ).EndUseSubcategory, "Plant" );
-						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Pump Electric Power [W]", Condenser( CondNum ).ActualEvapPumpPower, "HVAC", "Average", Condenser( CondNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Pump Electric Energy [J]", Condenser( CondNum ).EvapPumpConsumption, "HVAC", "Sum", Condenser( CondNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Condenser( CondNum ).EndUseSubcategory, "Plant" );
-						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Basin Heater Electric Power [W]", Condenser( CondNum ).BasinHeaterPower, "HVAC", "Average", Condenser( CondNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Basin Heater Electric Energy [J]", Condenser( CondNum ).BasinHeaterConsumption, "HVAC", "Sum", Condenser( CondNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Condenser( CondNum ).EndUseSubcategory, "Plant" );
-						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Evaporated Water Volume Flow Rate [m3/s]", Condenser( CondNum ).EvapWaterConsumpRate, "HVAC", "Average", Condenser( CondNum ).Name );
-						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Evaporated Water Volume [m3]", Condenser( CondNum ).EvapWaterConsumption, "HVAC", "Sum", Condenser( CondNum ).Name, _, "Water", "REFRIGERATION", Condenser( CondNum ).EndUseSubcategory, "Plant" );
+					if ( Condenser( SetupReportInputCondNum ).CondenserType == RefrigCondenserTypeEvap ) {
+						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Fan Electric Power [W]", Condenser( SetupReportInputCondNum ).ActualFanPower, "HVAC", "Average", Condenser( SetupReportInputCondNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Fan Electric Energy [J]", Condenser( SetupReportInputCondNum ).FanElecEnergy, "HVAC", "Sum", Condenser( SetupReportInputCondNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Condenser( SetupReportInputCondNum ).EndUseSubcategory, "Plant" );
+						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Pump Electric Power [W]", Condenser( SetupReportInputCondNum ).ActualEvapPumpPower, "HVAC", "Average", Condenser( SetupReportInputCondNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Pump Electric Energy [J]", Condenser( SetupReportInputCondNum ).EvapPumpConsumption, "HVAC", "Sum", Condenser( SetupReportInputCondNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Condenser( SetupReportInputCondNum ).EndUseSubcategory, "Plant" );
+						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Basin Heater Electric Power [W]", Condenser( SetupReportInputCondNum ).BasinHeaterPower, "HVAC", "Average", Condenser( SetupReportInputCondNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Basin Heater Electric Energy [J]", Condenser( SetupReportInputCondNum ).BasinHeaterConsumption, "HVAC", "Sum", Condenser( SetupReportInputCondNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Condenser( SetupReportInputCondNum ).EndUseSubcategory, "Plant" );
+						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Evaporated Water Volume Flow Rate [m3/s]", Condenser( SetupReportInputCondNum ).EvapWaterConsumpRate, "HVAC", "Average", Condenser( SetupReportInputCondNum ).Name );
+						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Evaporated Water Volume [m3]", Condenser( SetupReportInputCondNum ).EvapWaterConsumption, "HVAC", "Sum", Condenser( SetupReportInputCondNum ).Name, _, "Water", "REFRIGERATION", Condenser( SetupReportInputCondNum ).EndUseSubcategory, "Plant" );
 					} //Evaporative Condenser Variables
 
-					if ( Condenser( CondNum ).CondenserType == RefrigCondenserTypeWater ) {
-						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Fluid Mass Flow Rate [kg/s]", Condenser( CondNum ).MassFlowRate, "HVAC", "Average", Condenser( CondNum ).Name );
+					if ( Condenser( SetupReportInputCondNum ).CondenserType == RefrigCondenserTypeWater ) {
+						SetupOutputVariable( "Refrigeration Air Chiller System Condenser Fluid Mass Flow Rate [kg/s]", Condenser( SetupReportInputCondNum ).MassFlowRate, "HVAC", "Average", Condenser( SetupReportInputCondNum ).Name );
 
 					} //Water-cooled Condenser variables
 
 				} else { //Serving loads/systems with cases and walkins on zone time step
 
-					SetupOutputVariable( "Refrigeration System Condenser Heat Transfer Rate [W]", Condenser( CondNum ).CondLoad, "Zone", "Average", Condenser( CondNum ).Name );
-					SetupOutputVariable( "Refrigeration System Condenser Heat Transfer Energy [J]", Condenser( CondNum ).CondEnergy, "Zone", "Sum", Condenser( CondNum ).Name );
+					SetupOutputVariable( "Refrigeration System Condenser Heat Transfer Rate [W]", Condenser( SetupReportInputCondNum ).CondLoad, "Zone", "Average", Condenser( SetupReportInputCondNum ).Name );
+					SetupOutputVariable( "Refrigeration System Condenser Heat Transfer Energy [J]", Condenser( SetupReportInputCondNum ).CondEnergy, "Zone", "Sum", Condenser( SetupReportInputCondNum ).Name );
 
-					if ( Condenser( CondNum ).CondenserType != RefrigCondenserTypeCascade ) {
-						SetupOutputVariable( "Refrigeration System Condenser Total Recovered Heat Transfer Rate [W]", Condenser( CondNum ).TotalHeatRecoveredLoad, "Zone", "Average", Condenser( CondNum ).Name );
-						SetupOutputVariable( "Refrigeration System Condenser Total Recovered Heat Transfer Energy [J]", Condenser( CondNum ).TotalHeatRecoveredEnergy, "Zone", "Sum", Condenser( CondNum ).Name );
-						SetupOutputVariable( "Refrigeration System Condenser Non Refrigeration Recovered Heat Transfer Rate [W]", Condenser( CondNum ).ExternalHeatRecoveredLoad, "Zone", "Average", Condenser( CondNum ).Name );
-						SetupOutputVariable( "Refrigeration System Condenser Non Refrigeration Recovered Heat Transfer Energy [J]", Condenser( CondNum ).ExternalEnergyRecovered, "Zone", "Sum", Condenser( CondNum ).Name );
-						SetupOutputVariable( "Refrigeration System Condenser Defrost Recovered Heat Transfer Rate [W]", Condenser( CondNum ).InternalHeatRecoveredLoad, "Zone", "Average", Condenser( CondNum ).Name );
-						SetupOutputVariable( "Refrigeration System Condenser Defrost Recovered Heat Transfer Energy [J]", Condenser( CondNum ).InternalEnergyRecovered, "Zone", "Sum", Condenser( CondNum ).Name );
+					if ( Condenser( SetupReportInputCondNum ).CondenserType != RefrigCondenserTypeCascade ) {
+						SetupOutputVariable( "Refrigeration System Condenser Total Recovered Heat Transfer Rate [W]", Condenser( SetupReportInputCondNum ).TotalHeatRecoveredLoad, "Zone", "Average", Condenser( SetupReportInputCondNum ).Name );
+						SetupOutputVariable( "Refrigeration System Condenser Total Recovered Heat Transfer Energy [J]", Condenser( SetupReportInputCondNum ).TotalHeatRecoveredEnergy, "Zone", "Sum", Condenser( SetupReportInputCondNum ).Name );
+						SetupOutputVariable( "Refrigeration System Condenser Non Refrigeration Recovered Heat Transfer Rate [W]", Condenser( SetupReportInputCondNum ).ExternalHeatRecoveredLoad, "Zone", "Average", Condenser( SetupReportInputCondNum ).Name );
+						SetupOutputVariable( "Refrigeration System Condenser Non Refrigeration Recovered Heat Transfer Energy [J]", Condenser( SetupReportInputCondNum ).ExternalEnergyRecovered, "Zone", "Sum", Condenser( SetupReportInputCondNum ).Name );
+						SetupOutputVariable( "Refrigeration System Condenser Defrost Recovered Heat Transfer Rate [W]", Condenser( SetupReportInputCondNum ).InternalHeatRecoveredLoad, "Zone", "Average", Condenser( SetupReportInputCondNum ).Name );
+						SetupOutputVariable( "Refrigeration System Condenser Defrost Recovered Heat Transfer Energy [J]", Condenser( SetupReportInputCondNum ).InternalEnergyRecovered, "Zone", "Sum", Condenser( SetupReportInputCondNum ).Name );
 					} //not cascade because recovered energy on cascade systems passed up to higher temperature system
 
-					if ( Condenser( CondNum ).CondenserType == RefrigCondenserTypeAir ) {
-						SetupOutputVariable( "Refrigeration System Condenser Fan Electric Power [W]", Condenser( CondNum ).ActualFanPower, "Zone", "Average", Condenser( CondNum ).Name );
-						SetupOutputVariable( "Refrigeration System Condenser Fan Electric Energy [J]", Condenser( CondNum ).FanElecEnergy, "Zone", "Sum", Condenser( CondNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Condenser( CondNum ).EndUseSubcategory, "Plant" );
+					if ( Condenser( SetupReportInputCondNum ).CondenserType == RefrigCondenserTypeAir ) {
+						SetupOutputVariable( "Refrigeration System Condenser Fan Electric Power [W]", Condenser( SetupReportInputCondNum ).ActualFanPower, "Zone", "Average", Condenser( SetupReportInputCondNum ).Name );
+						SetupOutputVariable( "Refrigeration System Condenser Fan Electric Energy [J]", Condenser( SetupReportInputCondNum ).FanElecEnergy, "Zone", "Sum", Condenser( SetupReportInputCondNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Condenser( SetupReportInputCondNum ).EndUseSubcategory, "Plant" );
 					} //Air cooled
 
-					if ( Condenser( CondNum ).CondenserType == RefrigCondenserTypeEvap ) {
-						SetupOutputVariable( "Refrigeration System Condenser Fan Electric Power [W]", Condenser( CondNum ).ActualFanPower, "Zone", "Average", Condenser( CondNum ).Name );
-						SetupOutputVariable( "Refrigeration System Condenser Fan Electric Energy [J]", Condenser( CondNum ).FanElecEnergy, "Zone", "Sum", Condenser( CondNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Condenser( CondNum ).EndUseSubcategory, "Plant" );
-						SetupOutputVariable( "Refrigeration System Condenser Pump Electric Power [W]", Condenser( CondNum ).ActualEvapPumpPower, "Zone", "Average", Condenser( CondNum ).Name );
-						SetupOutputVariable( "Refrigeration System Condenser Pump Electric Energy [J]", Condenser( CondNum ).EvapPumpConsumption, "Zone", "Sum", Condenser( CondNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Condenser( CondNum ).EndUseSubcategory, "Plant" );
-						SetupOutputVariable( "Refrigeration System Condenser Basin Heater Electric Power [W]", Condenser( CondNum ).BasinHeaterPower, "Zone", "Average", Condenser( CondNum ).Name );
-						SetupOutputVariable( "Refrigeration System Condenser Basin Heater Electric Energy [J]", Condenser( CondNum ).BasinHeaterConsumption, "Zone", "Sum", Condenser( CondNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Condenser( CondNum ).EndUseSubcategory, "Plant" );
-						SetupOutputVariable( "Refrigeration System Condenser Evaporated Water Volume Flow Rate [m3/s]", Condenser( CondNum ).EvapWaterConsumpRate, "Zone", "Average", Condenser( CondNum ).Name );
-						SetupOutputVariable( "Refrigeration System Condenser Evaporated Water Volume [m3]", Condenser( CondNum ).EvapWaterConsumption, "Zone", "Sum", Condenser( CondNum ).Name, _, "Water", "REFRIGERATION", Condenser( CondNum ).EndUseSubcategory, "Plant" );
+					if ( Condenser( SetupReportInputCondNum ).CondenserType == RefrigCondenserTypeEvap ) {
+						SetupOutputVariable( "Refrigeration System Condenser Fan Electric Power [W]", Condenser( SetupReportInputCondNum ).ActualFanPower, "Zone", "Average", Condenser( SetupReportInputCondNum ).Name );
+						SetupOutputVariable( "Refrigeration System Condenser Fan Electric Energy [J]", Condenser( SetupReportInputCondNum ).FanElecEnergy, "Zone", "Sum", Condenser( SetupReportInputCondNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Condenser( SetupReportInputCondNum ).EndUseSubcategory, "Plant" );
+						SetupOutputVariable( "Refrigeration System Condenser Pump Electric Power [W]", Condenser( SetupReportInputCondNum ).ActualEvapPumpPower, "Zone", "Average", Condenser( SetupReportInputCondNum ).Name );
+						SetupOutputVariable( "Refrigeration System Condenser Pump Electric Energy [J]", Condenser( SetupReportInputCondNum ).EvapPumpConsumption, "Zone", "Sum", Condenser( SetupReportInputCondNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Condenser( SetupReportInputCondNum ).EndUseSubcategory, "Plant" );
+						SetupOutputVariable( "Refrigeration System Condenser Basin Heater Electric Power [W]", Condenser( SetupReportInputCondNum ).BasinHeaterPower, "Zone", "Average", Condenser( SetupReportInputCondNum ).Name );
+						SetupOutputVariable( "Refrigeration System Condenser Basin Heater Electric Energy [J]", Condenser( SetupReportInputCondNum ).BasinHeaterConsumption, "Zone", "Sum", Condenser( SetupReportInputCondNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Condenser( SetupReportInputCondNum ).EndUseSubcategory, "Plant" );
+						SetupOutputVariable( "Refrigeration System Condenser Evaporated Water Volume Flow Rate [m3/s]", Condenser( SetupReportInputCondNum ).EvapWaterConsumpRate, "Zone", "Average", Condenser( SetupReportInputCondNum ).Name );
+						SetupOutputVariable( "Refrigeration System Condenser Evaporated Water Volume [m3]", Condenser( SetupReportInputCondNum ).EvapWaterConsumption, "Zone", "Sum", Condenser( SetupReportInputCondNum ).Name, _, "Water", "REFRIGERATION", Condenser( SetupReportInputCondNum ).EndUseSubcategory, "Plant" );
 					} //Evaporative Condenser Variables
 
-					if ( Condenser( CondNum ).CondenserType == RefrigCondenserTypeWater ) {
-						SetupOutputVariable( "Refrigeration System Condenser Water Mass Flow Rate [kg/s]", Condenser( CondNum ).MassFlowRate, "HVAC", "Average", Condenser( CondNum ).Name );
+					if ( Condenser( SetupReportInputCondNum ).CondenserType == RefrigCondenserTypeWater ) {
+						SetupOutputVariable( "Refrigeration System Condenser Water Mass Flow Rate [kg/s]", Condenser( SetupReportInputCondNum ).MassFlowRate, "HVAC", "Average", Condenser( SetupReportInputCondNum ).Name );
 
 					} //Water-cooled Condenser variables
 				} // Condenser%CoilFlag to distinguish HVAC vs Zone time steps
@@ -6388,72 +7259,72 @@ namespace RefrigeratedCase {
 
 		if ( NumTransRefrigSystems > 0 ) {
 			// CurrentModuleObject='Refrigeration:TranscriticalSystem'
-			for ( RefrigSysNum = 1; RefrigSysNum <= NumTransRefrigSystems; ++RefrigSysNum ) {
+			for ( SetupReportInputRefrigSysNum = 1; SetupReportInputRefrigSysNum <= NumTransRefrigSystems; ++SetupReportInputRefrigSysNum ) {
 				// for both SingleStage and TwoStage systems (medium temperature loads present)
-				SetupOutputVariable( "Refrigeration Transcritical System Total High Pressure Compressor Electric Power [W]", TransSystem( RefrigSysNum ).TotCompPowerHP, "Zone", "Average", TransSystem( RefrigSysNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System Total High Pressure Compressor Electric Energy [J]", TransSystem( RefrigSysNum ).TotCompElecConsumpHP, "Zone", "Sum", TransSystem( RefrigSysNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System Total Compressor Electric Energy [J]", TransSystem( RefrigSysNum ).TotCompElecConsump, "Zone", "Sum", TransSystem( RefrigSysNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System Average COP [W/W]", TransSystem( RefrigSysNum ).AverageCompressorCOP, "Zone", "Average", TransSystem( RefrigSysNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System Medium Temperature Cases and Walk Ins Heat Transfer Rate [W]", TransSystem( RefrigSysNum ).TotalCoolingLoadMT, "Zone", "Average", TransSystem( RefrigSysNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System Medium Temperature Cases and Walk Ins Heat Transfer Energy [J]", TransSystem( RefrigSysNum ).TotalCoolingEnergyMT, "Zone", "Sum", TransSystem( RefrigSysNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System Total Cases and Walk Ins Heat Transfer Energy [J]", TransSystem( RefrigSysNum ).TotalCoolingEnergy, "Zone", "Sum", TransSystem( RefrigSysNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System Medium Temperature Suction Pipe Heat Transfer Rate [W]", TransSystem( RefrigSysNum ).PipeHeatLoadMT, "Zone", "Average", TransSystem( RefrigSysNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System Medium Temperature Suction Pipe Heat Transfer Energy [J]", TransSystem( RefrigSysNum ).PipeHeatEnergyMT, "Zone", "Sum", TransSystem( RefrigSysNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System High Pressure Compressor Heat Transfer Rate [W]", TransSystem( RefrigSysNum ).TotCompCapacityHP, "Zone", "Average", TransSystem( RefrigSysNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System High Pressure Compressor Heat Transfer Energy [J]", TransSystem( RefrigSysNum ).TotCompCoolingEnergyHP, "Zone", "Sum", TransSystem( RefrigSysNum ).Name ); //indiv compressors go to meter, not system sum
-				SetupOutputVariable( "Refrigeration Transcritical System Net Rejected Heat Transfer Rate [W]", TransSystem( RefrigSysNum ).NetHeatRejectLoad, "Zone", "Average", TransSystem( RefrigSysNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System Net Rejected Heat Transfer Energy [J]", TransSystem( RefrigSysNum ).NetHeatRejectEnergy, "Zone", "Sum", TransSystem( RefrigSysNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System Estimated Refrigerant Inventory Mass [kg]", TransSystem( RefrigSysNum ).RefInventory, "Zone", "Average", TransSystem( RefrigSysNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System Refrigerant Mass Flow Rate [kg/s]", TransSystem( RefrigSysNum ).RefMassFlowComps, "Zone", "Average", TransSystem( RefrigSysNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System Medium Temperature Evaporating Temperature [C]", TransSystem( RefrigSysNum ).TEvapNeededMT, "Zone", "Average", TransSystem( RefrigSysNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System Medium Temperature Suction Temperature [C]", TransSystem( RefrigSysNum ).TCompInHP, "Zone", "Average", TransSystem( RefrigSysNum ).Name );
-				if ( TransSystem( RefrigSysNum ).TransSysType == 2 ) { // for TwoStage system only (low temperature loads present)
-					SetupOutputVariable( "Refrigeration Transcritical System Low Pressure Compressor Electric Power [W]", TransSystem( RefrigSysNum ).TotCompPowerLP, "Zone", "Average", TransSystem( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Transcritical System Low Pressure Compressor Electric Energy [J]", TransSystem( RefrigSysNum ).TotCompElecConsumpLP, "Zone", "Sum", TransSystem( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Transcritical System Low Temperature Cases and Walk Ins Heat Transfer Rate [W]", TransSystem( RefrigSysNum ).TotalCoolingLoadLT, "Zone", "Average", TransSystem( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Transcritical System Low Temperature Cases and Walk Ins Heat Transfer Energy [J]", TransSystem( RefrigSysNum ).TotalCoolingEnergyLT, "Zone", "Sum", TransSystem( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Transcritical System Low Temperature Suction Pipe Heat Transfer Rate [W]", TransSystem( RefrigSysNum ).PipeHeatLoadLT, "Zone", "Average", TransSystem( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Transcritical System Low Temperature Suction Pipe Heat Transfer Energy [J]", TransSystem( RefrigSysNum ).PipeHeatEnergyLT, "Zone", "Sum", TransSystem( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Transcritical System Low Pressure Compressor Heat Transfer Rate [W]", TransSystem( RefrigSysNum ).TotCompCapacityLP, "Zone", "Average", TransSystem( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Transcritical System Low Pressure Compressor Heat Transfer Energy [J]", TransSystem( RefrigSysNum ).TotCompCoolingEnergyLP, "Zone", "Sum", TransSystem( RefrigSysNum ).Name ); //indiv compressors go to meter, not system sum
-					SetupOutputVariable( "Refrigeration Transcritical System Low Temperature Evaporating Temperature [C]", TransSystem( RefrigSysNum ).TEvapNeededLT, "Zone", "Average", TransSystem( RefrigSysNum ).Name );
-					SetupOutputVariable( "Refrigeration Transcritical System Low Temperature Suction Temperature [C]", TransSystem( RefrigSysNum ).TCompInLP, "Zone", "Average", TransSystem( RefrigSysNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Total High Pressure Compressor Electric Power [W]", TransSystem( SetupReportInputRefrigSysNum ).TotCompPowerHP, "Zone", "Average", TransSystem( SetupReportInputRefrigSysNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Total High Pressure Compressor Electric Energy [J]", TransSystem( SetupReportInputRefrigSysNum ).TotCompElecConsumpHP, "Zone", "Sum", TransSystem( SetupReportInputRefrigSysNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Total Compressor Electric Energy [J]", TransSystem( SetupReportInputRefrigSysNum ).TotCompElecConsump, "Zone", "Sum", TransSystem( SetupReportInputRefrigSysNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Average COP [W/W]", TransSystem( SetupReportInputRefrigSysNum ).AverageCompressorCOP, "Zone", "Average", TransSystem( SetupReportInputRefrigSysNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Medium Temperature Cases and Walk Ins Heat Transfer Rate [W]", TransSystem( SetupReportInputRefrigSysNum ).TotalCoolingLoadMT, "Zone", "Average", TransSystem( SetupReportInputRefrigSysNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Medium Temperature Cases and Walk Ins Heat Transfer Energy [J]", TransSystem( SetupReportInputRefrigSysNum ).TotalCoolingEnergyMT, "Zone", "Sum", TransSystem( SetupReportInputRefrigSysNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Total Cases and Walk Ins Heat Transfer Energy [J]", TransSystem( SetupReportInputRefrigSysNum ).TotalCoolingEnergy, "Zone", "Sum", TransSystem( SetupReportInputRefrigSysNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Medium Temperature Suction Pipe Heat Transfer Rate [W]", TransSystem( SetupReportInputRefrigSysNum ).PipeHeatLoadMT, "Zone", "Average", TransSystem( SetupReportInputRefrigSysNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Medium Temperature Suction Pipe Heat Transfer Energy [J]", TransSystem( SetupReportInputRefrigSysNum ).PipeHeatEnergyMT, "Zone", "Sum", TransSystem( SetupReportInputRefrigSysNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System High Pressure Compressor Heat Transfer Rate [W]", TransSystem( SetupReportInputRefrigSysNum ).TotCompCapacityHP, "Zone", "Average", TransSystem( SetupReportInputRefrigSysNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System High Pressure Compressor Heat Transfer Energy [J]", TransSystem( SetupReportInputRefrigSysNum ).TotCompCoolingEnergyHP, "Zone", "Sum", TransSystem( SetupReportInputRefrigSysNum ).Name ); //indiv compressors go to meter, not system sum
+				SetupOutputVariable( "Refrigeration Transcritical System Net Rejected Heat Transfer Rate [W]", TransSystem( SetupReportInputRefrigSysNum ).NetHeatRejectLoad, "Zone", "Average", TransSystem( SetupReportInputRefrigSysNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Net Rejected Heat Transfer Energy [J]", TransSystem( SetupReportInputRefrigSysNum ).NetHeatRejectEnergy, "Zone", "Sum", TransSystem( SetupReportInputRefrigSysNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Estimated Refrigerant Inventory Mass [kg]", TransSystem( SetupReportInputRefrigSysNum ).RefInventory, "Zone", "Average", TransSystem( SetupReportInputRefrigSysNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Refrigerant Mass Flow Rate [kg/s]", TransSystem( SetupReportInputRefrigSysNum ).RefMassFlowComps, "Zone", "Average", TransSystem( SetupReportInputRefrigSysNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Medium Temperature Evaporating Temperature [C]", TransSystem( SetupReportInputRefrigSysNum ).TEvapNeededMT, "Zone", "Average", TransSystem( SetupReportInputRefrigSysNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Medium Temperature Suction Temperature [C]", TransSystem( SetupReportInputRefrigSysNum ).TCompInHP, "Zone", "Average", TransSystem( SetupReportInputRefrigSysNum ).Name );
+				if ( TransSystem( SetupReportInputRefrigSysNum ).TransSysType == 2 ) { // for TwoStage system only (low temperature loads present)
+					SetupOutputVariable( "Refrigeration Transcritical System Low Pressure Compressor Electric Power [W]", TransSystem( SetupReportInputRefrigSysNum ).TotCompPowerLP, "Zone", "Average", TransSystem( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Transcritical System Low Pressure Compressor Electric Energy [J]", TransSystem( SetupReportInputRefrigSysNum ).TotCompElecConsumpLP, "Zone", "Sum", TransSystem( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Transcritical System Low Temperature Cases and Walk Ins Heat Transfer Rate [W]", TransSystem( SetupReportInputRefrigSysNum ).TotalCoolingLoadLT, "Zone", "Average", TransSystem( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Transcritical System Low Temperature Cases and Walk Ins Heat Transfer Energy [J]", TransSystem( SetupReportInputRefrigSysNum ).TotalCoolingEnergyLT, "Zone", "Sum", TransSystem( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Transcritical System Low Temperature Suction Pipe Heat Transfer Rate [W]", TransSystem( SetupReportInputRefrigSysNum ).PipeHeatLoadLT, "Zone", "Average", TransSystem( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Transcritical System Low Temperature Suction Pipe Heat Transfer Energy [J]", TransSystem( SetupReportInputRefrigSysNum ).PipeHeatEnergyLT, "Zone", "Sum", TransSystem( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Transcritical System Low Pressure Compressor Heat Transfer Rate [W]", TransSystem( SetupReportInputRefrigSysNum ).TotCompCapacityLP, "Zone", "Average", TransSystem( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Transcritical System Low Pressure Compressor Heat Transfer Energy [J]", TransSystem( SetupReportInputRefrigSysNum ).TotCompCoolingEnergyLP, "Zone", "Sum", TransSystem( SetupReportInputRefrigSysNum ).Name ); //indiv compressors go to meter, not system sum
+					SetupOutputVariable( "Refrigeration Transcritical System Low Temperature Evaporating Temperature [C]", TransSystem( SetupReportInputRefrigSysNum ).TEvapNeededLT, "Zone", "Average", TransSystem( SetupReportInputRefrigSysNum ).Name );
+					SetupOutputVariable( "Refrigeration Transcritical System Low Temperature Suction Temperature [C]", TransSystem( SetupReportInputRefrigSysNum ).TCompInLP, "Zone", "Average", TransSystem( SetupReportInputRefrigSysNum ).Name );
 				} // (TransSystem(RefrigSysNum)%TransSysType == 2)
 
-				if ( TransSystem( RefrigSysNum ).SystemRejectHeatToZone ) {
-					if ( GasCooler( TransSystem( RefrigSysNum ).GasCoolerNum( 1 ) ).InletAirZoneNum > 0 ) SetupZoneInternalGain( GasCooler( TransSystem( RefrigSysNum ).GasCoolerNum( 1 ) ).InletAirZoneNum, "Refrigeration:TranscriticalSystem:GasCooler:AirCooled", TransSystem( RefrigSysNum ).Name, IntGainTypeOf_RefrigerationTransSysAirCooledGasCooler, TransSystem( RefrigSysNum ).NetHeatRejectLoad );
+				if ( TransSystem( SetupReportInputRefrigSysNum ).SystemRejectHeatToZone ) {
+					if ( GasCooler( TransSystem( SetupReportInputRefrigSysNum ).GasCoolerNum( 1 ) ).InletAirZoneNum > 0 ) SetupZoneInternalGain( GasCooler( TransSystem( SetupReportInputRefrigSysNum ).GasCoolerNum( 1 ) ).InletAirZoneNum, "Refrigeration:TranscriticalSystem:GasCooler:AirCooled", TransSystem( SetupReportInputRefrigSysNum ).Name, IntGainTypeOf_RefrigerationTransSysAirCooledGasCooler, TransSystem( SetupReportInputRefrigSysNum ).NetHeatRejectLoad );
 				} // (TransSystem(RefrigSysNum)%SystemRejectHeatToZone)
-				if ( TransSystem( RefrigSysNum ).SuctionPipeActualZoneNumMT > 0 ) {
-					SetupZoneInternalGain( TransSystem( RefrigSysNum ).SuctionPipeActualZoneNumMT, "Refrigeration:TranscriticalSystem:SuctionPipeMT", TransSystem( RefrigSysNum ).Name, IntGainTypeOf_RefrigerationTransSysSuctionPipeMT, TransSystem( RefrigSysNum ).PipeHeatLoadMT );
+				if ( TransSystem( SetupReportInputRefrigSysNum ).SuctionPipeActualZoneNumMT > 0 ) {
+					SetupZoneInternalGain( TransSystem( SetupReportInputRefrigSysNum ).SuctionPipeActualZoneNumMT, "Refrigeration:TranscriticalSystem:SuctionPipeMT", TransSystem( SetupReportInputRefrigSysNum ).Name, IntGainTypeOf_RefrigerationTransSysSuctionPipeMT, TransSystem( SetupReportInputRefrigSysNum ).PipeHeatLoadMT );
 				} // TransSystem(RefrigSysNum)%SuctionPipeActualZoneNumMT > 0
-				if ( TransSystem( RefrigSysNum ).SuctionPipeActualZoneNumLT > 0 ) {
-					SetupZoneInternalGain( TransSystem( RefrigSysNum ).SuctionPipeActualZoneNumLT, "Refrigeration:TranscriticalSystem:SuctionPipeLT", TransSystem( RefrigSysNum ).Name, IntGainTypeOf_RefrigerationTransSysSuctionPipeLT, TransSystem( RefrigSysNum ).PipeHeatLoadLT );
+				if ( TransSystem( SetupReportInputRefrigSysNum ).SuctionPipeActualZoneNumLT > 0 ) {
+					SetupZoneInternalGain( TransSystem( SetupReportInputRefrigSysNum ).SuctionPipeActualZoneNumLT, "Refrigeration:TranscriticalSystem:SuctionPipeLT", TransSystem( SetupReportInputRefrigSysNum ).Name, IntGainTypeOf_RefrigerationTransSysSuctionPipeLT, TransSystem( SetupReportInputRefrigSysNum ).PipeHeatLoadLT );
 				} // TransSystem(RefrigSysNum)%SuctionPipeActualZoneNumLT > 0
 
 				//Report Compressor ENERGY here, not on system level for meters.
 				// LP compressors
-				for ( CompIndex = 1; CompIndex <= TransSystem( RefrigSysNum ).NumCompressorsLP; ++CompIndex ) {
-					CompNum = TransSystem( RefrigSysNum ).CompressorNumLP( CompIndex );
+				for ( SetupReportInputCompIndex = 1; SetupReportInputCompIndex <= TransSystem( SetupReportInputRefrigSysNum ).NumCompressorsLP; ++SetupReportInputCompIndex ) {
+					SetupReportInputCompNum = TransSystem( SetupReportInputRefrigSysNum ).CompressorNumLP( SetupReportInputCompIndex );
 					// CurrentModuleObject='Refrigeration:Compressor'
-					if ( Compressor( CompNum ).NumSysAttach == 1 ) { //only set up reports for compressors that are used once and only once
-						SetupOutputVariable( "Refrigeration Compressor Electric Power [W]", Compressor( CompNum ).Power, "Zone", "Average", Compressor( CompNum ).Name );
-						SetupOutputVariable( "Refrigeration Compressor Electric Energy [J]", Compressor( CompNum ).ElecConsumption, "Zone", "Sum", Compressor( CompNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Compressor( CompNum ).EndUseSubcategory, "Plant" );
-						SetupOutputVariable( "Refrigeration Compressor Heat Transfer Rate [W]", Compressor( CompNum ).Capacity, "Zone", "Average", Compressor( CompNum ).Name );
-						SetupOutputVariable( "Refrigeration Compressor Heat Transfer Energy [J]", Compressor( CompNum ).CoolingEnergy, "Zone", "Sum", Compressor( CompNum ).Name );
-						SetupOutputVariable( "Refrigeration Compressor Runtime Fraction []", Compressor( CompNum ).LoadFactor, "Zone", "Average", Compressor( CompNum ).Name );
+					if ( Compressor( SetupReportInputCompNum ).NumSysAttach == 1 ) { //only set up reports for compressors that are used once and only once
+						SetupOutputVariable( "Refrigeration Compressor Electric Power [W]", Compressor( SetupReportInputCompNum ).Power, "Zone", "Average", Compressor( SetupReportInputCompNum ).Name );
+						SetupOutputVariable( "Refrigeration Compressor Electric Energy [J]", Compressor( SetupReportInputCompNum ).ElecConsumption, "Zone", "Sum", Compressor( SetupReportInputCompNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Compressor( SetupReportInputCompNum ).EndUseSubcategory, "Plant" );
+						SetupOutputVariable( "Refrigeration Compressor Heat Transfer Rate [W]", Compressor( SetupReportInputCompNum ).Capacity, "Zone", "Average", Compressor( SetupReportInputCompNum ).Name );
+						SetupOutputVariable( "Refrigeration Compressor Heat Transfer Energy [J]", Compressor( SetupReportInputCompNum ).CoolingEnergy, "Zone", "Sum", Compressor( SetupReportInputCompNum ).Name );
+						SetupOutputVariable( "Refrigeration Compressor Runtime Fraction []", Compressor( SetupReportInputCompNum ).LoadFactor, "Zone", "Average", Compressor( SetupReportInputCompNum ).Name );
 					} // NumSysAttach
 				} //TransSystem(RefrigSysNum)%NumCompressorsLP
 
 				// HP compressors
-				for ( CompIndex = 1; CompIndex <= TransSystem( RefrigSysNum ).NumCompressorsHP; ++CompIndex ) {
-					CompNum = TransSystem( RefrigSysNum ).CompressorNumHP( CompIndex );
+				for ( SetupReportInputCompIndex = 1; SetupReportInputCompIndex <= TransSystem( SetupReportInputRefrigSysNum ).NumCompressorsHP; ++SetupReportInputCompIndex ) {
+					SetupReportInputCompNum = TransSystem( SetupReportInputRefrigSysNum ).CompressorNumHP( SetupReportInputCompIndex );
 					// CurrentModuleObject='Refrigeration:Compressor'
-					if ( Compressor( CompNum ).NumSysAttach == 1 ) { //only set up reports for compressors that are used once and only once
-						SetupOutputVariable( "Refrigeration Compressor Electric Power [W]", Compressor( CompNum ).Power, "Zone", "Average", Compressor( CompNum ).Name );
-						SetupOutputVariable( "Refrigeration Compressor Electric Energy [J]", Compressor( CompNum ).ElecConsumption, "Zone", "Sum", Compressor( CompNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Compressor( CompNum ).EndUseSubcategory, "Plant" );
-						SetupOutputVariable( "Refrigeration Compressor Heat Transfer Rate [W]", Compressor( CompNum ).Capacity, "Zone", "Average", Compressor( CompNum ).Name );
-						SetupOutputVariable( "Refrigeration Compressor Heat Transfer Energy [J]", Compressor( CompNum ).CoolingEnergy, "Zone", "Sum", Compressor( CompNum ).Name );
-						SetupOutputVariable( "Refrigeration Compressor Runtime Fraction []", Compressor( CompNum ).LoadFactor, "Zone", "Average", Compressor( CompNum ).Name );
+					if ( Compressor( SetupReportInputCompNum ).NumSysAttach == 1 ) { //only set up reports for compressors that are used once and only once
+						SetupOutputVariable( "Refrigeration Compressor Electric Power [W]", Compressor( SetupReportInputCompNum ).Power, "Zone", "Average", Compressor( SetupReportInputCompNum ).Name );
+						SetupOutputVariable( "Refrigeration Compressor Electric Energy [J]", Compressor( SetupReportInputCompNum ).ElecConsumption, "Zone", "Sum", Compressor( SetupReportInputCompNum ).Name, _, "ELECTRICITY", "REFRIGERATION", Compressor( SetupReportInputCompNum ).EndUseSubcategory, "Plant" );
+						SetupOutputVariable( "Refrigeration Compressor Heat Transfer Rate [W]", Compressor( SetupReportInputCompNum ).Capacity, "Zone", "Average", Compressor( SetupReportInputCompNum ).Name );
+						SetupOutputVariable( "Refrigeration Compressor Heat Transfer Energy [J]", Compressor( SetupReportInputCompNum ).CoolingEnergy, "Zone", "Sum", Compressor( SetupReportInputCompNum ).Name );
+						SetupOutputVariable( "Refrigeration Compressor Runtime Fraction []", Compressor( SetupReportInputCompNum ).LoadFactor, "Zone", "Average", Compressor( SetupReportInputCompNum ).Name );
 					} // NumSysAttach
 				} //TransSystem(RefrigSysNum)%NumCompressorsHP
 
@@ -6461,16 +7332,16 @@ namespace RefrigeratedCase {
 		} // (NumTransRefrigSystems > 0)
 
 		if ( NumSimulationGasCooler > 0 ) {
-			for ( GCNum = 1; GCNum <= NumSimulationGasCooler; ++GCNum ) {
+			for ( SetupReportInputGCNum = 1; SetupReportInputGCNum <= NumSimulationGasCooler; ++SetupReportInputGCNum ) {
 				// CurrentModuleObject='Refrigeration:GasCooler:AirCooled'
-				SetupOutputVariable( "Refrigeration Transcritical System Gas Cooler Heat Transfer Rate [W]", GasCooler( GCNum ).GasCoolerLoad, "Zone", "Average", GasCooler( GCNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System Gas Cooler Heat Transfer Energy [J]", GasCooler( GCNum ).GasCoolerEnergy, "Zone", "Sum", GasCooler( GCNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System Gas Cooler Fan Electric Power [W]", GasCooler( GCNum ).ActualFanPower, "Zone", "Average", GasCooler( GCNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System Gas Cooler Fan Electric Energy [J]", GasCooler( GCNum ).FanElecEnergy, "Zone", "Sum", GasCooler( GCNum ).Name, _, "ELECTRICITY", "REFRIGERATION", GasCooler( GCNum ).EndUseSubcategory, "Plant" );
-				SetupOutputVariable( "Refrigeration Transcritical System Gas Cooler Outlet Temperature [C]", GasCooler( GCNum ).TGasCoolerOut, "Zone", "Average", GasCooler( GCNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System Gas Cooler Outlet Pressure [Pa]", GasCooler( GCNum ).PGasCoolerOut, "Zone", "Average", GasCooler( GCNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System Gas Cooler Defrost Recovered Heat Transfer Rate [W]", GasCooler( GCNum ).InternalHeatRecoveredLoad, "Zone", "Average", GasCooler( GCNum ).Name );
-				SetupOutputVariable( "Refrigeration Transcritical System Gas Cooler Defrost Recovered Heat Transfer Energy [J]", GasCooler( GCNum ).InternalEnergyRecovered, "Zone", "Sum", GasCooler( GCNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Gas Cooler Heat Transfer Rate [W]", GasCooler( SetupReportInputGCNum ).GasCoolerLoad, "Zone", "Average", GasCooler( SetupReportInputGCNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Gas Cooler Heat Transfer Energy [J]", GasCooler( SetupReportInputGCNum ).GasCoolerEnergy, "Zone", "Sum", GasCooler( SetupReportInputGCNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Gas Cooler Fan Electric Power [W]", GasCooler( SetupReportInputGCNum ).ActualFanPower, "Zone", "Average", GasCooler( SetupReportInputGCNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Gas Cooler Fan Electric Energy [J]", GasCooler( SetupReportInputGCNum ).FanElecEnergy, "Zone", "Sum", GasCooler( SetupReportInputGCNum ).Name, _, "ELECTRICITY", "REFRIGERATION", GasCooler( SetupReportInputGCNum ).EndUseSubcategory, "Plant" );
+				SetupOutputVariable( "Refrigeration Transcritical System Gas Cooler Outlet Temperature [C]", GasCooler( SetupReportInputGCNum ).TGasCoolerOut, "Zone", "Average", GasCooler( SetupReportInputGCNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Gas Cooler Outlet Pressure [Pa]", GasCooler( SetupReportInputGCNum ).PGasCoolerOut, "Zone", "Average", GasCooler( SetupReportInputGCNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Gas Cooler Defrost Recovered Heat Transfer Rate [W]", GasCooler( SetupReportInputGCNum ).InternalHeatRecoveredLoad, "Zone", "Average", GasCooler( SetupReportInputGCNum ).Name );
+				SetupOutputVariable( "Refrigeration Transcritical System Gas Cooler Defrost Recovered Heat Transfer Energy [J]", GasCooler( SetupReportInputGCNum ).InternalEnergyRecovered, "Zone", "Sum", GasCooler( SetupReportInputGCNum ).Name );
 			} // GCNum on NumSimulationGasCooler
 		} // (NumSimulationGasCooler >0)
 
@@ -6534,20 +7405,7 @@ namespace RefrigeratedCase {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyBeginEnvrnFlag( true );
-		static int SystemID( 0 );
-		static int CaseID( 0 );
-		static int WalkInID( 0 );
-		static int CoilID( 0 );
-		static int ICond( 0 );
-		static int IRack( 0 );
-		static int SecondID( 0 );
 		//Used to adjust accumulative variables when time step is repeated
-		static Real64 MyCurrentTime( 0.0 ); // Used to determine whether the zone time step is a repetition
-		static Real64 MyCurrentTimeSaved( 0.0 ); // Used to determine whether the zone time step is a repetition
-		static Real64 MyStepStartTime( 0.0 ); // Used to determine whether the system time step is a repetition
-		static Real64 MyStepStartTimeSaved( 0.0 ); // Used to determine whether the system time step is a repetition
-		static Real64 TimeStepFraction( 0.0 ); // Used to calculate my current time
 
 		// Zero display case, air-coil, and walk-in cooler credits (summed by zone)
 		// to 0 each zone or sys time step
@@ -6670,8 +7528,8 @@ namespace RefrigeratedCase {
 					e.KgFrost = 0.0;
 					e.StoredEnergy = 0.0;
 				}
-				for ( WalkInID = 1; WalkInID <= NumSimulationWalkIns; ++WalkInID ) {
-					WalkIn( WalkInID ).IceTemp = WalkIn( WalkInID ).TEvapDesign;
+				for ( InitRefrigerationWalkInID = 1; InitRefrigerationWalkInID <= NumSimulationWalkIns; ++InitRefrigerationWalkInID ) {
+					WalkIn( InitRefrigerationWalkInID ).IceTemp = WalkIn( InitRefrigerationWalkInID ).TEvapDesign;
 				}
 			}
 			if ( NumSimulationRefrigAirChillers > 0 ) {
@@ -6679,9 +7537,9 @@ namespace RefrigeratedCase {
 					e.KgFrost = 0.0;
 					e.KgFrostSaved = 0.0;
 				}
-				for ( CoilID = 1; CoilID <= NumSimulationRefrigAirChillers; ++CoilID ) {
-					WarehouseCoil( CoilID ).IceTemp = WarehouseCoil( CoilID ).TEvapDesign;
-					WarehouseCoil( CoilID ).IceTempSaved = WarehouseCoil( CoilID ).TEvapDesign;
+				for ( InitRefrigerationCoilID = 1; InitRefrigerationCoilID <= NumSimulationRefrigAirChillers; ++InitRefrigerationCoilID ) {
+					WarehouseCoil( InitRefrigerationCoilID ).IceTemp = WarehouseCoil( InitRefrigerationCoilID ).TEvapDesign;
+					WarehouseCoil( InitRefrigerationCoilID ).IceTempSaved = WarehouseCoil( InitRefrigerationCoilID ).TEvapDesign;
 				}
 			}
 			if ( NumSimulationSecondarySystems > 0 ) {
@@ -6707,10 +7565,10 @@ namespace RefrigeratedCase {
 					e.LaggedUsedHVACCoil = 0.0;
 				}
 			}
-			for ( SystemID = 1; SystemID <= NumRefrigSystems; ++SystemID ) {
-				if ( allocated( System( SystemID ).MechSCLoad ) ) System( SystemID ).MechSCLoad = 0.0;
-				System( SystemID ).LSHXTrans = 0.0;
-				System( SystemID ).LSHXTransEnergy = 0.0;
+			for ( InitRefrigerationSystemID = 1; InitRefrigerationSystemID <= NumRefrigSystems; ++InitRefrigerationSystemID ) {
+				if ( allocated( System( InitRefrigerationSystemID ).MechSCLoad ) ) System( InitRefrigerationSystemID ).MechSCLoad = 0.0;
+				System( InitRefrigerationSystemID ).LSHXTrans = 0.0;
+				System( InitRefrigerationSystemID ).LSHXTransEnergy = 0.0;
 			}
 
 			if ( NumOfTimeStepInHour > 0.0 ) TimeStepFraction = 1.0 / double( NumOfTimeStepInHour );
@@ -6728,31 +7586,31 @@ namespace RefrigeratedCase {
 				if ( std::abs( MyCurrentTime - MyCurrentTimeSaved ) < MySmallNumber ) {
 					// If the time step is repeated, need to return to correct values at start of time step
 					if ( NumSimulationCases > 0 ) {
-						for ( CaseID = 1; CaseID <= NumSimulationCases; ++CaseID ) {
-							RefrigCase( CaseID ).DefrostEnergy = RefrigCase( CaseID ).DefrostEnergySaved;
-							RefrigCase( CaseID ).StockingEnergy = RefrigCase( CaseID ).StockingEnergySaved;
-							RefrigCase( CaseID ).WarmEnvEnergy = RefrigCase( CaseID ).WarmEnvEnergySaved;
-							RefrigCase( CaseID ).KgFrost = RefrigCase( CaseID ).KgFrostSaved;
-							RefrigCase( CaseID ).StoredEnergy = RefrigCase( CaseID ).StoredEnergySaved;
+						for ( InitRefrigerationCaseID = 1; InitRefrigerationCaseID <= NumSimulationCases; ++InitRefrigerationCaseID ) {
+							RefrigCase( InitRefrigerationCaseID ).DefrostEnergy = RefrigCase( InitRefrigerationCaseID ).DefrostEnergySaved;
+							RefrigCase( InitRefrigerationCaseID ).StockingEnergy = RefrigCase( InitRefrigerationCaseID ).StockingEnergySaved;
+							RefrigCase( InitRefrigerationCaseID ).WarmEnvEnergy = RefrigCase( InitRefrigerationCaseID ).WarmEnvEnergySaved;
+							RefrigCase( InitRefrigerationCaseID ).KgFrost = RefrigCase( InitRefrigerationCaseID ).KgFrostSaved;
+							RefrigCase( InitRefrigerationCaseID ).StoredEnergy = RefrigCase( InitRefrigerationCaseID ).StoredEnergySaved;
 						} // CaseID
 					} // NumSimulationCases
 					if ( NumSimulationWalkIns > 0 ) {
-						for ( WalkInID = 1; WalkInID <= NumSimulationWalkIns; ++WalkInID ) {
-							WalkIn( WalkInID ).KgFrost = WalkIn( WalkInID ).KgFrostSaved;
-							WalkIn( WalkInID ).StoredEnergy = WalkIn( WalkInID ).StoredEnergySaved;
-							WalkIn( WalkInID ).IceTemp = WalkIn( WalkInID ).IceTempSaved;
+						for ( InitRefrigerationWalkInID = 1; InitRefrigerationWalkInID <= NumSimulationWalkIns; ++InitRefrigerationWalkInID ) {
+							WalkIn( InitRefrigerationWalkInID ).KgFrost = WalkIn( InitRefrigerationWalkInID ).KgFrostSaved;
+							WalkIn( InitRefrigerationWalkInID ).StoredEnergy = WalkIn( InitRefrigerationWalkInID ).StoredEnergySaved;
+							WalkIn( InitRefrigerationWalkInID ).IceTemp = WalkIn( InitRefrigerationWalkInID ).IceTempSaved;
 						}
 					}
 					if ( NumRefrigSystems > 0 ) {
-						for ( SystemID = 1; SystemID <= NumRefrigSystems; ++SystemID ) {
-							if ( System( SystemID ).CoilFlag ) continue;
-							System( SystemID ).UnmetEnergy = System( SystemID ).UnmetEnergySaved;
+						for ( InitRefrigerationSystemID = 1; InitRefrigerationSystemID <= NumRefrigSystems; ++InitRefrigerationSystemID ) {
+							if ( System( InitRefrigerationSystemID ).CoilFlag ) continue;
+							System( InitRefrigerationSystemID ).UnmetEnergy = System( InitRefrigerationSystemID ).UnmetEnergySaved;
 						}
 					}
 					if ( NumTransRefrigSystems > 0 ) {
-						for ( SystemID = 1; SystemID <= NumTransRefrigSystems; ++SystemID ) {
-							TransSystem( SystemID ).UnmetEnergyMT = TransSystem( SystemID ).UnmetEnergySavedMT;
-							TransSystem( SystemID ).UnmetEnergyLT = TransSystem( SystemID ).UnmetEnergySavedLT;
+						for ( InitRefrigerationSystemID = 1; InitRefrigerationSystemID <= NumTransRefrigSystems; ++InitRefrigerationSystemID ) {
+							TransSystem( InitRefrigerationSystemID ).UnmetEnergyMT = TransSystem( InitRefrigerationSystemID ).UnmetEnergySavedMT;
+							TransSystem( InitRefrigerationSystemID ).UnmetEnergyLT = TransSystem( InitRefrigerationSystemID ).UnmetEnergySavedLT;
 						}
 					}
 					if ( NumSimulationSecondarySystems > 0 ) {
@@ -6766,31 +7624,31 @@ namespace RefrigeratedCase {
 					// First time through this Zone time step, so set saved values to those in place at start of this time step
 					MyCurrentTimeSaved = MyCurrentTime;
 					if ( NumSimulationCases > 0 ) {
-						for ( CaseID = 1; CaseID <= NumSimulationCases; ++CaseID ) {
-							RefrigCase( CaseID ).DefrostEnergySaved = RefrigCase( CaseID ).DefrostEnergy;
-							RefrigCase( CaseID ).StockingEnergySaved = RefrigCase( CaseID ).StockingEnergy;
-							RefrigCase( CaseID ).WarmEnvEnergySaved = RefrigCase( CaseID ).WarmEnvEnergy;
-							RefrigCase( CaseID ).KgFrostSaved = RefrigCase( CaseID ).KgFrost;
-							RefrigCase( CaseID ).StoredEnergySaved = RefrigCase( CaseID ).StoredEnergy;
+						for ( InitRefrigerationCaseID = 1; InitRefrigerationCaseID <= NumSimulationCases; ++InitRefrigerationCaseID ) {
+							RefrigCase( InitRefrigerationCaseID ).DefrostEnergySaved = RefrigCase( InitRefrigerationCaseID ).DefrostEnergy;
+							RefrigCase( InitRefrigerationCaseID ).StockingEnergySaved = RefrigCase( InitRefrigerationCaseID ).StockingEnergy;
+							RefrigCase( InitRefrigerationCaseID ).WarmEnvEnergySaved = RefrigCase( InitRefrigerationCaseID ).WarmEnvEnergy;
+							RefrigCase( InitRefrigerationCaseID ).KgFrostSaved = RefrigCase( InitRefrigerationCaseID ).KgFrost;
+							RefrigCase( InitRefrigerationCaseID ).StoredEnergySaved = RefrigCase( InitRefrigerationCaseID ).StoredEnergy;
 						} //caseid
 					} //numsimulationcases
 					if ( NumSimulationWalkIns > 0 ) {
-						for ( WalkInID = 1; WalkInID <= NumSimulationWalkIns; ++WalkInID ) {
-							WalkIn( WalkInID ).KgFrostSaved = WalkIn( WalkInID ).KgFrost;
-							WalkIn( WalkInID ).StoredEnergySaved = WalkIn( WalkInID ).StoredEnergy;
-							WalkIn( WalkInID ).IceTempSaved = WalkIn( WalkInID ).IceTemp;
+						for ( InitRefrigerationWalkInID = 1; InitRefrigerationWalkInID <= NumSimulationWalkIns; ++InitRefrigerationWalkInID ) {
+							WalkIn( InitRefrigerationWalkInID ).KgFrostSaved = WalkIn( InitRefrigerationWalkInID ).KgFrost;
+							WalkIn( InitRefrigerationWalkInID ).StoredEnergySaved = WalkIn( InitRefrigerationWalkInID ).StoredEnergy;
+							WalkIn( InitRefrigerationWalkInID ).IceTempSaved = WalkIn( InitRefrigerationWalkInID ).IceTemp;
 						}
 					}
 					if ( NumRefrigSystems > 0 ) {
-						for ( SystemID = 1; SystemID <= NumRefrigSystems; ++SystemID ) {
-							if ( System( SystemID ).CoilFlag ) continue;
-							System( SystemID ).UnmetEnergySaved = System( SystemID ).UnmetEnergy;
+						for ( InitRefrigerationSystemID = 1; InitRefrigerationSystemID <= NumRefrigSystems; ++InitRefrigerationSystemID ) {
+							if ( System( InitRefrigerationSystemID ).CoilFlag ) continue;
+							System( InitRefrigerationSystemID ).UnmetEnergySaved = System( InitRefrigerationSystemID ).UnmetEnergy;
 						}
 					}
 					if ( NumTransRefrigSystems > 0 ) {
-						for ( SystemID = 1; SystemID <= NumTransRefrigSystems; ++SystemID ) {
-							TransSystem( SystemID ).UnmetEnergySavedMT = TransSystem( SystemID ).UnmetEnergyMT;
-							TransSystem( SystemID ).UnmetEnergySavedLT = TransSystem( SystemID ).UnmetEnergyLT;
+						for ( InitRefrigerationSystemID = 1; InitRefrigerationSystemID <= NumTransRefrigSystems; ++InitRefrigerationSystemID ) {
+							TransSystem( InitRefrigerationSystemID ).UnmetEnergySavedMT = TransSystem( InitRefrigerationSystemID ).UnmetEnergyMT;
+							TransSystem( InitRefrigerationSystemID ).UnmetEnergySavedLT = TransSystem( InitRefrigerationSystemID ).UnmetEnergyLT;
 						}
 					}
 					if ( NumSimulationSecondarySystems > 0 ) {
@@ -6820,18 +7678,18 @@ namespace RefrigeratedCase {
 				if ( std::abs( MyStepStartTime - MyStepStartTimeSaved ) < MySmallNumber ) {
 					// If the time step is repeated, need to return to correct values at start of time step
 					if ( NumSimulationRefrigAirChillers > 0 ) {
-						for ( CoilID = 1; CoilID <= NumSimulationRefrigAirChillers; ++CoilID ) {
-							WarehouseCoil( CoilID ).KgFrost = WarehouseCoil( CoilID ).KgFrostSaved;
-							WarehouseCoil( CoilID ).IceTemp = WarehouseCoil( CoilID ).IceTempSaved;
+						for ( InitRefrigerationCoilID = 1; InitRefrigerationCoilID <= NumSimulationRefrigAirChillers; ++InitRefrigerationCoilID ) {
+							WarehouseCoil( InitRefrigerationCoilID ).KgFrost = WarehouseCoil( InitRefrigerationCoilID ).KgFrostSaved;
+							WarehouseCoil( InitRefrigerationCoilID ).IceTemp = WarehouseCoil( InitRefrigerationCoilID ).IceTempSaved;
 						}
 					}
 				} else { // First time through this system time step or hvac loop,
 					// so set saved values to those in place at start of this time step
 					MyStepStartTimeSaved = MyStepStartTime;
 					if ( NumSimulationRefrigAirChillers > 0 ) {
-						for ( CoilID = 1; CoilID <= NumSimulationRefrigAirChillers; ++CoilID ) {
-							WarehouseCoil( CoilID ).KgFrostSaved = WarehouseCoil( CoilID ).KgFrost;
-							WarehouseCoil( CoilID ).IceTempSaved = WarehouseCoil( CoilID ).IceTemp;
+						for ( InitRefrigerationCoilID = 1; InitRefrigerationCoilID <= NumSimulationRefrigAirChillers; ++InitRefrigerationCoilID ) {
+							WarehouseCoil( InitRefrigerationCoilID ).KgFrostSaved = WarehouseCoil( InitRefrigerationCoilID ).KgFrost;
+							WarehouseCoil( InitRefrigerationCoilID ).IceTempSaved = WarehouseCoil( InitRefrigerationCoilID ).IceTemp;
 						}
 					}
 					//Following lagged variables set for consistency to value calculated prev time through HVAC time step loops
@@ -6854,11 +7712,11 @@ namespace RefrigeratedCase {
 
 		if ( AnyEnergyManagementSystemInModel ) {
 			if ( NumRefrigSystems > 0 ) {
-				for ( SystemID = 1; SystemID <= NumRefrigSystems; ++SystemID ) {
-					if ( System( SystemID ).EMSOverrideOnTCondenseMin ) {
-						System( SystemID ).TCondenseMin = System( SystemID ).EMSOverrideValueTCondenseMin;
+				for ( InitRefrigerationSystemID = 1; InitRefrigerationSystemID <= NumRefrigSystems; ++InitRefrigerationSystemID ) {
+					if ( System( InitRefrigerationSystemID ).EMSOverrideOnTCondenseMin ) {
+						System( InitRefrigerationSystemID ).TCondenseMin = System( InitRefrigerationSystemID ).EMSOverrideValueTCondenseMin;
 					} else {
-						System( SystemID ).TCondenseMin = System( SystemID ).TCondenseMinInput;
+						System( InitRefrigerationSystemID ).TCondenseMin = System( InitRefrigerationSystemID ).TCondenseMinInput;
 					}
 				}
 			}
@@ -6908,10 +7766,6 @@ namespace RefrigeratedCase {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static std::string const RoutineName( "InitRefrigerationPlantConnections" );
-		static bool MyBeginEnvrnFlag( true );
-		static bool errFlag( false );
-		static int RefCondLoop( 0 ); // loop over Condenser
-		static int RefCompRackLoop( 0 ); // loop over RefrigRack
 		Real64 rho; // local fluid property for cooling water
 
 		//initialize plant topology information, if applicable
@@ -6959,7 +7813,7 @@ namespace RefrigeratedCase {
 			MyReferPlantScanFlag = false;
 		}
 
-		if ( BeginEnvrnFlag && MyBeginEnvrnFlag ) {
+		if ( BeginEnvrnFlag && InitRefrigerationPlantConnectionsMyBeginEnvrnFlag ) {
 
 			// do plant inits, if applicable
 			if ( ! MyReferPlantScanFlag ) {
@@ -6991,11 +7845,11 @@ namespace RefrigeratedCase {
 				}
 
 			}
-			MyBeginEnvrnFlag = false;
+			InitRefrigerationPlantConnectionsMyBeginEnvrnFlag = false;
 
 		} //(BeginEnvrnFlag .AND. MyBeginEnvrnFlag)
 
-		if ( ! BeginEnvrnFlag ) MyBeginEnvrnFlag = true;
+		if ( ! BeginEnvrnFlag ) InitRefrigerationPlantConnectionsMyBeginEnvrnFlag = true;
 
 	}
 
@@ -7065,11 +7919,6 @@ namespace RefrigeratedCase {
 		Real64 HumRatOut; // Humidity ratio of outlet air from condenser (assumed saturated) [kg/kg]
 		Real64 BPress; // Barometric pressure at condenser air inlet node [Pa]
 		bool EvapAvail; // Control for evap condenser availability
-		static Real64 LocalTimeStep( 0.0 ); // TimeStepZone for case/walkin systems, TimeStepSys for coil systems
-		static int CoilSetIndex( 0 ); // Index to set of coils in a single zone
-		static int CoilSetID( 0 ); // Index to set of coils in a single zone (shared inlet and outlet nodes)
-		static int CoilIndex( 0 ); // Index to a single air chiller/coil
-		static int CoilID( 0 ); // Index to a single air chiller/coil
 
 		NumCases = RefrigRack( RackNum ).NumCases;
 		TotalRackDeliveredCapacity = 0.0;
@@ -7109,11 +7958,11 @@ namespace RefrigeratedCase {
 		}
 
 		if ( RefrigRack( RackNum ).NumCoils > 0 ) {
-			for ( CoilIndex = 1; CoilIndex <= RefrigRack( RackNum ).NumCoils; ++CoilIndex ) {
-				CoilID = RefrigRack( RackNum ).CoilNum( CoilIndex );
+			for ( CalcRackSystemCoilIndex = 1; CalcRackSystemCoilIndex <= RefrigRack( RackNum ).NumCoils; ++CalcRackSystemCoilIndex ) {
+				CalcRackSystemCoilID = RefrigRack( RackNum ).CoilNum( CalcRackSystemCoilIndex );
 				// already CALLed CalculateCoil(CoilID) in CoilSet specified order
 				// increment TotalCoolingLoad for Compressors/condenser on each system
-				TotalRackDeliveredCapacity += WarehouseCoil( CoilID ).TotalCoolingLoad;
+				TotalRackDeliveredCapacity += WarehouseCoil( CalcRackSystemCoilID ).TotalCoolingLoad;
 				//      System(SysNum)%TotalCondDefrostCredit=System(SysNum)%TotalCondDefrostCredit + WarehouseCoil(CoilID)%HotDefrostCondCredit
 			} //NumCoils systems
 		} //System(SysNum)%NumCoils > 0
@@ -7334,32 +8183,29 @@ namespace RefrigeratedCase {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 LocalTimeStep( 0.0 ); // TimeStepZone for case/walkin systems, TimeStepSys for coil systems
-		static int DemandARRID( 0 ); // Index to water tank Demand used for evap condenser on rack
-		static int RackTankID( 0 ); // Index to water tank used for evap condenser on rack
 
-		LocalTimeStep = TimeStepZone;
-		if ( UseSysTimeStep ) LocalTimeStep = TimeStepSys;
+		ReportRackSystemLocalTimeStep = TimeStepZone;
+		if ( UseSysTimeStep ) ReportRackSystemLocalTimeStep = TimeStepSys;
 
 		RefrigRack( RackNum ).RackCompressorPower = TotalCompressorPower;
-		RefrigRack( RackNum ).RackElecConsumption = TotalCompressorPower * LocalTimeStep * SecInHour;
+		RefrigRack( RackNum ).RackElecConsumption = TotalCompressorPower * ReportRackSystemLocalTimeStep * SecInHour;
 		RefrigRack( RackNum ).ActualCondenserFanPower = TotalCondenserFanPower;
-		RefrigRack( RackNum ).CondenserFanConsumption = TotalCondenserFanPower * LocalTimeStep * SecInHour;
+		RefrigRack( RackNum ).CondenserFanConsumption = TotalCondenserFanPower * ReportRackSystemLocalTimeStep * SecInHour;
 		RefrigRack( RackNum ).RackCapacity = TotalRackDeliveredCapacity;
-		RefrigRack( RackNum ).RackCoolingEnergy = TotalRackDeliveredCapacity * LocalTimeStep * SecInHour;
+		RefrigRack( RackNum ).RackCoolingEnergy = TotalRackDeliveredCapacity * ReportRackSystemLocalTimeStep * SecInHour;
 		RefrigRack( RackNum ).RackCompressorCOP = CompressorCOPactual;
 		RefrigRack( RackNum ).SensHVACCreditHeatRate = RackSenCreditToHVAC;
-		RefrigRack( RackNum ).SensHVACCreditHeat = RackSenCreditToHVAC * LocalTimeStep * SecInHour;
+		RefrigRack( RackNum ).SensHVACCreditHeat = RackSenCreditToHVAC * ReportRackSystemLocalTimeStep * SecInHour;
 		RefrigRack( RackNum ).SensZoneCreditHeatRate = RackSenCreditToZone;
-		RefrigRack( RackNum ).SensZoneCreditHeat = RackSenCreditToZone * LocalTimeStep * SecInHour;
+		RefrigRack( RackNum ).SensZoneCreditHeat = RackSenCreditToZone * ReportRackSystemLocalTimeStep * SecInHour;
 		RefrigRack( RackNum ).EvapWaterConsumpRate = TotalEvapWaterUseRate;
-		RefrigRack( RackNum ).EvapWaterConsumption = TotalEvapWaterUseRate * LocalTimeStep * SecInHour;
+		RefrigRack( RackNum ).EvapWaterConsumption = TotalEvapWaterUseRate * ReportRackSystemLocalTimeStep * SecInHour;
 		RefrigRack( RackNum ).ActualEvapPumpPower = TotalCondenserPumpPower;
-		RefrigRack( RackNum ).EvapPumpConsumption = TotalCondenserPumpPower * LocalTimeStep * SecInHour;
+		RefrigRack( RackNum ).EvapPumpConsumption = TotalCondenserPumpPower * ReportRackSystemLocalTimeStep * SecInHour;
 		RefrigRack( RackNum ).BasinHeaterPower = TotalBasinHeatPower;
-		RefrigRack( RackNum ).BasinHeaterConsumption = TotalBasinHeatPower * LocalTimeStep * SecInHour;
+		RefrigRack( RackNum ).BasinHeaterConsumption = TotalBasinHeatPower * ReportRackSystemLocalTimeStep * SecInHour;
 		RefrigRack( RackNum ).CondLoad = TotalCondenserHeat;
-		RefrigRack( RackNum ).CondEnergy = TotalCondenserHeat * LocalTimeStep * SecInHour;
+		RefrigRack( RackNum ).CondEnergy = TotalCondenserHeat * ReportRackSystemLocalTimeStep * SecInHour;
 		// Set total rack heat rejection used for heat reclaim. Do not allow heat reclaim on stand alone (indoor) display cases.
 		if ( RefrigRack( RackNum ).HeatRejectionLocation == LocationZone ) {
 			HeatReclaimRefrigeratedRack( RackNum ).AvailCapacity = 0.0;
@@ -7426,7 +8272,6 @@ namespace RefrigeratedCase {
 		using Psychrometrics::PsyTdpFnWPb;
 
 		// Locals
-		static Real64 CaseRAFraction( 0.0 ); // Fraction of case credits applied to return air
 
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
@@ -7439,67 +8284,9 @@ namespace RefrigeratedCase {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int ActualZoneNum( 0 ); // Index to zone
-		static int DefCapCurvePtr( 0 );
-		static int DefrostEnergyCurveType( 0 );
-		static int DefrostType( 0 );
-		static int ZoneNodeNum( 0 ); // Zone node number
-		static Real64 CapAvail( 0.0 ); // capacity available to meet current and stored load (W)
-		static Real64 CaseCreditFraction( 0.0 ); // Reduction in case credits due to e.g., reduced door openings at night
-		static Real64 CaseSenCreditToZone( 0.0 ); // Amount of sensible case credit applied to zone load (W)
-		static Real64 CaseLatCreditToZone( 0.0 ); // Amount of latent case credit applied to zone load (W)
-		static Real64 CaseSenCreditToHVAC( 0.0 ); // Amount of sensible case credit applied to HVAC RA duct (W)
-		static Real64 CaseLatCreditToHVAC( 0.0 ); // Amount of latent case credit applied to HVAC RA duct (W)
-		static Real64 CaseSchedule( 0.0 ); // Current value of case operating (availability) schedule
-		static Real64 DefrostEnergy( 0.0 ); // Energy form of defrost capacity (J)
-		static Real64 DefrostSchedule( 0.0 ); // Display case defrost schedule
-		static Real64 DefrostDripDownSchedule( 0.0 ); // Display case drip-down schedule (allows coil to drain after defrost)
-		static Real64 DefCapModFrac( 0.0 ); // Defrost capacity modifier curve based on case operating temperature
-		static Real64 DefrostRatio( 0.0 ); // ratio of defrost energy at current zone temp/humrat to defrost
 		//    capacity at design condition
-		static Real64 DefrostLoad_Actual( 0.0 ); // heat load on case due to defrost (W)
-		static Real64 DefrostCap_Actual( 0.0 ); // power used to defrost (W)
-		static Real64 DeltaFreezeKgFrost( 0.0 ); // change in frost on coils (kg)
-		static Real64 DeltaStockingEnergy( 0.0 ); // Used to keep track of problems if sizing not consistent (J)
-		static Real64 DeltaWarmEnvEnergy( 0.0 ); // Used to keep track of problems if sizing not consistent (J)
-		static Real64 DesignRatedCap( 0.0 ); // Design rated capacity of display case (W)
-		static Real64 DesignDefrostCap( 0.0 ); // Design defrost capacity of display case (W)
-		static Real64 DesignLatentCap( 0.0 ); // Design latent capacity of display case (W)
-		static Real64 DesignLighting( 0.0 ); // Total design display case lighting power (W)
-		static Real64 FrostMeltedKg( 0.0 ); // Frost melted by defrost during a time step (kg)
-		static Real64 LatentLoad( 0.0 ); // Latent load placed on case at actual zone conditions (W)
-		static Real64 LatentRatio( 0.0 ); // ratio of latent capacity at current zone temp/humrat to
 		//    latent capacity at design condition
-		static Real64 LatentCap_Actual( 0.0 ); // Refrigerated case latent capacity at specific operating conditions
-		static Real64 LatentCaseCredit( 0.0 ); // Latent case credit delivered to zone (W)
-		static Real64 LatCapModFrac( 0.0 ); // Latent capacity modifier curve based on case operating temperature
-		static Real64 LightingSchedule( 0.0 ); // Display case lighting schedule
-		static Real64 Length( 0.0 ); // Length of display case (m)
-		static Real64 LoadRequested( 0.0 ); // TotalLoad_Actual  + StoredEnergyRate
-		static Real64 RatedAmbientRH( 0.0 ); // Local variable for the RH corresponding to case rating conditions
-		static Real64 SensibleCaseCredit( 0.0 ); // Sensible case credit delivered to zone (W)
-		static Real64 SensibleCap_Actual( 0.0 ); // Refrigerated case sensible capacity at specific operating conditions
 		//REAL(r64)    :: SensibleFraction        =0.0d0 ! Portion of total load due to sensible load
-		static Real64 SensibleLoadPrime( 0.0 ); // Sensible load due to cond, conv, rad, infil (W)
-		static Real64 SensibleLoadAux( 0.0 ); // Sensible load due to heaters, lighting (W)
-		static Real64 SensibleLoadTotal( 0.0 ); // Total sensible load on case, may not = capacity applied (W)
-		static Real64 StockingSchedule( 0.0 ); // Current value of product stocking schedule (W/m)
-		static Real64 StockingLoad( 0.0 ); // Total load due to stocking case product (W)
-		static Real64 StoredEnergyRate( 0.0 ); // Rate needed to serve all stored energy during single time step (W)
-		static Real64 TotalLoad_Actual( 0.0 ); // total load on case at zone conditions (W)
-		static Real64 StartFrostKg( 0.0 ); // frost load at start of time step (kg of ice)
-		static Real64 TotalCap_Actual( 0.0 ); // Refrigerated case total capacity at specific operating conditions
-		static Real64 TotalLightingLoad( 0.0 ); // Total lighting energy rate (W)
-		static Real64 TotalFan( 0.0 ); // Total fan energy rate (W)
-		static Real64 TotalAntiSweat( 0.0 ); // Total anti-sweat heater energy rate (W)
-		static Real64 TotalLightToCase( 0.0 ); // Lighting energy to case
-		static Real64 TotalASHeaterToCase( 0.0 ); // Anti-sweat heater energy to case
-		static Real64 TotalLightToZone( 0.0 ); // Lighting energy to zone
-		static Real64 TotalASHeaterToZone( 0.0 ); // Anti-sweat heater energy to zone
-		static Real64 TCase( 0.0 ); // Display case operating temperature
-		static Real64 ZoneRHPercent( 0.0 ); // Zone relative humidity (%)
-		static Real64 ZoneDewPoint( 0.0 ); // Zone dew point (C)
-		static Real64 ZoneTempFactor( 0.0 ); // used to look at extra sensible load due to excursions in zone T
 
 		// Refrigerated display case defrost type (parameters)
 		// DefNone             = 0
@@ -7542,8 +8329,9 @@ namespace RefrigeratedCase {
 		//Set local subroutine variables for convenience
 		ActualZoneNum = RefrigCase( CaseID ).ActualZoneNum;
 		ZoneNodeNum = RefrigCase( CaseID ).ZoneNodeNum;
-		ZoneRHPercent = PsyRhFnTdbWPb( Node( ZoneNodeNum ).Temp, Node( ZoneNodeNum ).HumRat, OutBaroPress ) * 100.0;
-		ZoneDewPoint = PsyTdpFnWPb( Node( ZoneNodeNum ).HumRat, OutBaroPress );
+		// zone air state evaluated once for all cases in the zone in CalcRefrigZoneAirStates
+		ZoneRHPercent = RefrigZoneAir( ActualZoneNum ).RHFrac * 100.0;
+		ZoneDewPoint = RefrigZoneAir( ActualZoneNum ).DewPoint;
 		Length = RefrigCase( CaseID ).Length;
 		TCase = RefrigCase( CaseID ).Temperature;
 		DesignRatedCap = RefrigCase( CaseID ).DesignRatedCap;
@@ -7743,8 +8531,8 @@ namespace RefrigeratedCase {
 		// Reset DefrostLoad_Actual to zero for non-electric defrost types, for reporting purposes
 		if ( DefrostType != DefElectric && DefrostType != DefElectricOnDemand && DefrostType != DefElectricTerm ) DefrostCap_Actual = 0.0;
 
-		CaseRAFraction = min( 0.8, RefrigCase( CaseID ).RAFrac );
-		CaseRAFactor = ( 1.0 - ( ( 0.8 - CaseRAFraction ) / 0.8 ) ) * 0.5;
+		CalculateCaseCaseRAFraction = min( 0.8, RefrigCase( CaseID ).RAFrac );
+		CaseRAFactor = ( 1.0 - ( ( 0.8 - CalculateCaseCaseRAFraction ) / 0.8 ) ) * 0.5;
 
 		// Update globals for use in ZoneTemperaturePredictorCorrector (Air Heat Balance) and
 		//   Zone Equipment Manager. Sum case credits to zone and case credits to HVAC
@@ -7922,24 +8710,8 @@ namespace RefrigeratedCase {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static std::string const RoutineName( "SimRefrigCondenser" );
-		static Real64 DeltaT( 0.0 );
-		static Real64 InletTemp( 0.0 );
-		static Real64 DesVolFlowRate( 0.0 );
-		static Real64 MassFlowRate( 0.0 );
-		static Real64 MassFlowRateMax( 0.0 );
-		static Real64 OutletTempMax( 0.0 );
-		static Real64 VolFlowRate( 0.0 );
-		static Real64 OutletTemp( 0.0 );
-		static int FlowType( 0 );
 		// INTEGER   :: HighFlowWarn = 0
 		// INTEGER   :: HighTempWarn = 0
-		static int NoFlowWarnIndex( 0 );
-		static int HighFlowWarnIndex( 0 );
-		static int HighInletWarnIndex( 0 );
-		static int HighTempWarnIndex( 0 );
-		static std::string Name;
-		static std::string TypeName;
-		static std::string ErrIntro;
 		int PlantInletNode( 0 ); //Autodesk:Init
 		int PlantOutletNode( 0 );
 		int PlantLoopIndex( 0 ); //Autodesk:Init
@@ -8032,7 +8804,7 @@ namespace RefrigeratedCase {
 			//     MassFlowRate = RefrigRack(Num)%MassFlowRate
 			MassFlowRateMax = RefrigRack( Num ).MassFlowRateMax;
 			OutletTempMax = RefrigRack( Num ).OutletTempMax;
-			Name = RefrigRack( Num ).Name;
+			SimRefrigCondenserName = RefrigRack( Num ).Name;
 			TypeName = "Refrigeration:CompressorRack:";
 			ErrIntro = "Condenser for refrigeration rack ";
 			NoFlowWarnIndex = RefrigRack( Num ).NoFlowWarnIndex;
@@ -8057,7 +8829,7 @@ namespace RefrigeratedCase {
 			//     MassFlowRate = Condenser(Num)%MassFlowRate
 			MassFlowRateMax = Condenser( Num ).MassFlowRateMax;
 			OutletTempMax = Condenser( Num ).OutletTempMax;
-			Name = Condenser( Num ).Name;
+			SimRefrigCondenserName = Condenser( Num ).Name;
 			TypeName = "Refrigeration:Condenser:WaterCooled";
 			ErrIntro = "Condenser for refrigeration system ";
 			NoFlowWarnIndex = Condenser( Num ).NoFlowWarnIndex;
@@ -8085,11 +8857,11 @@ namespace RefrigeratedCase {
 			if ( OutletTemp == InletTemp ) {
 
 				if ( HighInletWarnIndex == 0 ) {
-					ShowSevereError( ErrIntro + ", \"" + Name + "\" : has inlet water temp equal to desired outlet temp. Excessive flow resulting. " );
+					ShowSevereError( ErrIntro + ", \"" + SimRefrigCondenserName + "\" : has inlet water temp equal to desired outlet temp. Excessive flow resulting. " );
 					ShowContinueError( "cooling water is not cold enough to reach desired outlet temperature" );
 
 				}
-				ShowRecurringWarningErrorAtEnd( ErrIntro + ", \"" + Name + "\" : has inlet water temp equal to desired outlet temp.... continues. ", HighInletWarnIndex );
+				ShowRecurringWarningErrorAtEnd( ErrIntro + ", \"" + SimRefrigCondenserName + "\" : has inlet water temp equal to desired outlet temp.... continues. ", HighInletWarnIndex );
 				VolFlowRate = 9999.0;
 				MassFlowRate = VolFlowRate * rho;
 			} else {
@@ -8099,11 +8871,11 @@ namespace RefrigeratedCase {
 				if ( MassFlowRate > MassFlowRateMax ) {
 					//HighFlowWarn = HighFlowWarn +1
 					if ( HighFlowWarnIndex == 0 ) {
-						ShowWarningMessage( TypeName + Name );
+						ShowWarningMessage( TypeName + SimRefrigCondenserName );
 						ShowContinueError( "Requested condenser water mass flow rate greater than maximum allowed value. " );
 						ShowContinueError( "Flow reset to maximum value." );
 					} //HighFlowWarnIndex
-					ShowRecurringWarningErrorAtEnd( ErrIntro + Name + " - Flow rate higher than maximum allowed ... continues", HighFlowWarnIndex );
+					ShowRecurringWarningErrorAtEnd( ErrIntro + SimRefrigCondenserName + " - Flow rate higher than maximum allowed ... continues", HighFlowWarnIndex );
 					//END IF
 					MassFlowRate = MassFlowRateMax;
 				}
@@ -8129,17 +8901,17 @@ namespace RefrigeratedCase {
 			OutletTemp = InletTemp;
 			if ( ( TotalCondenserHeat > 0.0 ) && ( ! FirstHVACIteration ) ) {
 
-				ShowRecurringWarningErrorAtEnd( TypeName + Name + "Water-cooled condenser has no cooling water flow. Heat is not being rejected from compressor rack condenser.", NoFlowWarnIndex );
+				ShowRecurringWarningErrorAtEnd( TypeName + SimRefrigCondenserName + "Water-cooled condenser has no cooling water flow. Heat is not being rejected from compressor rack condenser.", NoFlowWarnIndex );
 			}
 		}
 		// Check outlet water temp for max value
 		if ( OutletTemp > OutletTempMax ) {
 			// HighTempWarn = HighTempWarn +1
 			if ( HighTempWarnIndex == 0 ) {
-				ShowWarningMessage( TypeName + Name );
+				ShowWarningMessage( TypeName + SimRefrigCondenserName );
 				ShowContinueError( "Water-cooled condenser outlet temp higher than maximum allowed temp. Check flow rates and/or temperature setpoints." );
 			}
-			ShowRecurringWarningErrorAtEnd( ErrIntro + Name + " - Condenser outlet temp higher than maximum allowed ... continues", HighTempWarnIndex );
+			ShowRecurringWarningErrorAtEnd( ErrIntro + SimRefrigCondenserName + " - Condenser outlet temp higher than maximum allowed ... continues", HighTempWarnIndex );
 		}
 
 		//set up output variables
@@ -8229,6 +9001,55 @@ namespace RefrigeratedCase {
 	//***************************************************************************************************
 	//***************************************************************************************************
 
+	void
+	CalcRefrigZoneAirStates()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Evaluates the air state of the zones holding refrigerated cases or walk-in doors.
+
+		// METHODOLOGY EMPLOYED:
+		// Supermarket models hold hundreds of cases in a few zones. The psychrometric functions of the
+		// zone air (including the saturation iteration of the dew point) used to be evaluated for each
+		// case and walk-in; they are now evaluated in one pass over the zones before the cases and
+		// walk-ins are simulated, in the same sequence as before so that results are unchanged.
+
+		// Using/Aliasing
+		using DataEnvironment::OutBaroPress;
+		using Psychrometrics::PsyRhFnTdbWPb;
+		using Psychrometrics::PsyTdpFnWPb;
+		using Psychrometrics::PsyHFnTdbRhPb;
+		using Psychrometrics::PsyWFnTdbH;
+		using Psychrometrics::PsyRhoAirFnPbTdbW;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const RoutineName( "CalcRefrigZoneAirStates" );
+
+		for ( int ListNum = 1; ListNum <= NumRefrigZoneAirs; ++ListNum ) {
+			auto & ZoneAir( RefrigZoneAir( RefrigZoneAirList( ListNum ) ) );
+			Real64 const ZoneDryBulb( Node( ZoneAir.ZoneNodeNum ).Temp );
+			Real64 const ZoneHumRat( Node( ZoneAir.ZoneNodeNum ).HumRat );
+			ZoneAir.RHFrac = PsyRhFnTdbWPb( ZoneDryBulb, ZoneHumRat, OutBaroPress, RoutineName );
+			if ( ZoneAir.HasCases ) {
+				ZoneAir.DewPoint = PsyTdpFnWPb( ZoneHumRat, OutBaroPress );
+			}
+			if ( ZoneAir.HasWalkInDoors ) {
+				ZoneAir.Enthalpy = PsyHFnTdbRhPb( ZoneDryBulb, ZoneAir.RHFrac, OutBaroPress, RoutineName );
+				ZoneAir.HumRat = PsyWFnTdbH( ZoneDryBulb, ZoneAir.Enthalpy, RoutineName );
+				ZoneAir.Density = PsyRhoAirFnPbTdbW( OutBaroPress, ZoneDryBulb, ZoneAir.HumRat, RoutineName );
+			}
+		}
+
+	}
+
+	//***************************************************************************************************
+
 	void
 	SimulateDetailedRefrigerationSystems()
 	{
@@ -8271,41 +9092,14 @@ namespace RefrigeratedCase {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static std::string const RoutineName( "SimulateDetailedRefrigerationSystems" );
 		int SysNum; // Index to the detailed refrigerated system being modeled
-		static bool DeRate( false ); // If true, need to derate aircoils because load can't be met by system
-		static bool FirstSCLoop( true ); // Flag first time through multi-system loop used when mech subcoolers present
 
-		static int StartMechSubcoolLoop( 3 ); // if no mechanical subcoolers transfer energy between system,
 		//    don't loop
-		static int LoopNum( 0 ); // Index to overall repeat necessary for mechanical subcoolers
-		static int SubcoolID( 0 ); // Subcooler ID number
-		static int SubcoolerIndex( 0 ); // Subcooler ID number
-		static int CaseID( 0 ); // Absolute reference to case
-		static int CaseIndex( 0 ); // Index to case
-		static int CoilID( 0 ); // Index to a single air chiller/coil
-		static int CoilIndex( 0 ); // Index to a single air chiller/coil
-		static int CoilSetID( 0 ); // Index to set of coils in a single zone (shared inlet and outlet nodes)
-		static int CoilSetIndex( 0 ); // Index to set of coils in a single zone
-		static int CondInletAirZoneNum( 0 ); // Index used to assign zone credits
-		static int SecondID( 0 ); // Absolute reference to Secondary Loop
-		static int SecondIndex( 0 ); // Index to Secondary Loop
-		static int SuctionPipeActualZoneNum( 0 ); // Index to zone exchanging heat with suction pipes
-		static int WalkInID( 0 ); // Absolute reference to WalkIn
-		static int WalkInIndex( 0 ); // Index to WalkIn
-		static int ZoneNum( 0 ); // counter when assigning zone case credits
-		static int CascadeLoadIndex( 0 ); // Index to Cascade Condenser Load
-		static int CascadeLoadID( 0 ); // Absolute reference to Cascade Condenser
-		static Real64 LoadFrac( 1.0 ); // case load/design case load
-		static Real64 LocalTimeStep( 0.0 ); // Set equal to either TimeStepSys or TimeStepZone
-		static Real64 CurrentLoads( 0.0 ); // current loads on compressor, exclusive of unmet loads from prev time steps
-		static Real64 CurrentHiStageLoads( 0.0 ); // Current loads on high-stage compressor, exclusive of unmet loads from
 		// prev time steps (two-stage systems only)
-		static Real64 MaxTEvap( 0.0 ); // Maximum evaporating temperature that can still meet load
-		static Real64 MaxDelTFloatFrac( 0.5 ); // max fraction allowed for difference between case and evaporator temperature
 		//    relative to design temperature difference
 		Real64 SuctionPipeZoneTemp; // Temperature for zone identified as environment for suction pipe heat gains, C
 
-		LocalTimeStep = TimeStepZone;
-		if ( UseSysTimeStep ) LocalTimeStep = TimeStepSys;
+		SimulateDetailedRefrigerationSystemsLocalTimeStep = TimeStepZone;
+		if ( UseSysTimeStep ) SimulateDetailedRefrigerationSystemsLocalTimeStep = TimeStepSys;
 
 		//Cascade condenser assumes a constant approach delta T (Tcond - Tevap), not f(load)
 
@@ -8320,9 +9114,9 @@ namespace RefrigeratedCase {
 		// however, be repeated when the last chiller set is called from ZoneEquipmentManager
 		// that's why important where init goes, don't want to zero out data should keep
 		if ( UseSysTimeStep ) {
-			for ( CoilSetIndex = 1; CoilSetIndex <= NumRefrigChillerSets; ++CoilSetIndex ) {
-				CoilSetID = CoilSetIndex;
-				CalculateAirChillerSets( CoilSetID );
+			for ( SimulateDetailedRefrigerationSystemsCoilSetIndex = 1; SimulateDetailedRefrigerationSystemsCoilSetIndex <= NumRefrigChillerSets; ++SimulateDetailedRefrigerationSystemsCoilSetIndex ) {
+				SimulateDetailedRefrigerationSystemsCoilSetID = SimulateDetailedRefrigerationSystemsCoilSetIndex;
+				CalculateAirChillerSets( SimulateDetailedRefrigerationSystemsCoilSetID );
 			}
 		}
 
@@ -8333,9 +9127,9 @@ namespace RefrigeratedCase {
 			//Only do those systems appropriate for this analysis, supermarket type on load time step or coil type on sys time step
 			if ( ( ( ! UseSysTimeStep ) && ( ! System( SysNum ).CoilFlag ) ) || ( ( UseSysTimeStep ) && ( System( SysNum ).CoilFlag ) ) ) {
 				if ( System( SysNum ).NumCases > 0 ) {
-					for ( CaseIndex = 1; CaseIndex <= System( SysNum ).NumCases; ++CaseIndex ) {
-						CaseID = System( SysNum ).CaseNum( CaseIndex );
-						CalculateCase( CaseID );
+					for ( SimulateDetailedRefrigerationSystemsCaseIndex = 1; SimulateDetailedRefrigerationSystemsCaseIndex <= System( SysNum ).NumCases; ++SimulateDetailedRefrigerationSystemsCaseIndex ) {
+						SimulateDetailedRefrigerationSystemsCaseID = System( SysNum ).CaseNum( SimulateDetailedRefrigerationSystemsCaseIndex );
+						CalculateCase( SimulateDetailedRefrigerationSystemsCaseID );
 						//  TevapDesign calc in Get Input to meet lowest evap temp of any load on the system.
 						//  Tevap needed is either fixed at this design value,
 						//  or allowed to float to meet lowest T needed among all loads served by the system
@@ -8343,47 +9137,47 @@ namespace RefrigeratedCase {
 						if ( System( SysNum ).CompSuctControl == ConstantSuctionTemperature ) {
 							System( SysNum ).TEvapNeeded = System( SysNum ).TEvapDesign;
 						} else { // calculate floating T evap
-							LoadFrac = min( 1.0, ( RefrigCase( CaseID ).TotalCoolingLoad / RefrigCase( CaseID ).DesignRatedCap ) );
-							MaxTEvap = RefrigCase( CaseID ).Temperature - ( RefrigCase( CaseID ).Temperature - RefrigCase( CaseID ).EvapTempDesign ) * max( LoadFrac, MaxDelTFloatFrac );
+							LoadFrac = min( 1.0, ( RefrigCase( SimulateDetailedRefrigerationSystemsCaseID ).TotalCoolingLoad / RefrigCase( SimulateDetailedRefrigerationSystemsCaseID ).DesignRatedCap ) );
+							MaxTEvap = RefrigCase( SimulateDetailedRefrigerationSystemsCaseID ).Temperature - ( RefrigCase( SimulateDetailedRefrigerationSystemsCaseID ).Temperature - RefrigCase( SimulateDetailedRefrigerationSystemsCaseID ).EvapTempDesign ) * max( LoadFrac, MaxDelTFloatFrac );
 							//Compare Tevap for this case to max allowed for all previous cases on this suction group and set at the MINIMUM of the two
-							if ( CaseIndex == 1 ) { //note use case index, not caseid here to get first case on this suction group/system
+							if ( SimulateDetailedRefrigerationSystemsCaseIndex == 1 ) { //note use case index, not caseid here to get first case on this suction group/system
 								System( SysNum ).TEvapNeeded = MaxTEvap;
 							} else {
 								System( SysNum ).TEvapNeeded = min( MaxTEvap, System( SysNum ).TEvapNeeded );
 							}
 						} //floating or constant evap temperature
 						// increment TotalCoolingLoad for Compressors/condenser on each system and defrost condenser credits for heat recovery
-						System( SysNum ).TotalCoolingLoad += RefrigCase( CaseID ).TotalCoolingLoad;
-						System( SysNum ).TotalCondDefrostCredit += RefrigCase( CaseID ).HotDefrostCondCredit;
+						System( SysNum ).TotalCoolingLoad += RefrigCase( SimulateDetailedRefrigerationSystemsCaseID ).TotalCoolingLoad;
+						System( SysNum ).TotalCondDefrostCredit += RefrigCase( SimulateDetailedRefrigerationSystemsCaseID ).HotDefrostCondCredit;
 					} //NumCases
 				} //Num of cases > 0
 
 				if ( System( SysNum ).NumWalkIns > 0 ) {
-					for ( WalkInIndex = 1; WalkInIndex <= System( SysNum ).NumWalkIns; ++WalkInIndex ) {
-						WalkInID = System( SysNum ).WalkInNum( WalkInIndex );
-						CalculateWalkIn( WalkInID );
+					for ( SimulateDetailedRefrigerationSystemsWalkInIndex = 1; SimulateDetailedRefrigerationSystemsWalkInIndex <= System( SysNum ).NumWalkIns; ++SimulateDetailedRefrigerationSystemsWalkInIndex ) {
+						SimulateDetailedRefrigerationSystemsWalkInID = System( SysNum ).WalkInNum( SimulateDetailedRefrigerationSystemsWalkInIndex );
+						CalculateWalkIn( SimulateDetailedRefrigerationSystemsWalkInID );
 						if ( System( SysNum ).CompSuctControl == ConstantSuctionTemperature ) {
 							System( SysNum ).TEvapNeeded = System( SysNum ).TEvapDesign;
 						} else { // calculate floating T evap
-							LoadFrac = min( 1.0, ( WalkIn( WalkInID ).TotalCoolingLoad / WalkIn( WalkInID ).DesignRatedCap ) );
-							MaxTEvap = WalkIn( WalkInID ).Temperature - ( WalkIn( WalkInID ).Temperature - WalkIn( WalkInID ).TEvapDesign ) * max( LoadFrac, MaxDelTFloatFrac );
+							LoadFrac = min( 1.0, ( WalkIn( SimulateDetailedRefrigerationSystemsWalkInID ).TotalCoolingLoad / WalkIn( SimulateDetailedRefrigerationSystemsWalkInID ).DesignRatedCap ) );
+							MaxTEvap = WalkIn( SimulateDetailedRefrigerationSystemsWalkInID ).Temperature - ( WalkIn( SimulateDetailedRefrigerationSystemsWalkInID ).Temperature - WalkIn( SimulateDetailedRefrigerationSystemsWalkInID ).TEvapDesign ) * max( LoadFrac, MaxDelTFloatFrac );
 							//  Compare maxTevap for this walk in to max allowed for cases and for all
 							//  previous walk ins on this suction group and set at the MINIMUM of the two
-							if ( WalkInIndex == 1 && System( SysNum ).NumCases == 0 ) {
+							if ( SimulateDetailedRefrigerationSystemsWalkInIndex == 1 && System( SysNum ).NumCases == 0 ) {
 								System( SysNum ).TEvapNeeded = MaxTEvap;
 							} else {
 								System( SysNum ).TEvapNeeded = min( MaxTEvap, System( SysNum ).TEvapNeeded );
 							}
 						} //floating or constant evap temperature
 						// increment TotalCoolingLoad for Compressors/condenser on each system
-						System( SysNum ).TotalCoolingLoad += WalkIn( WalkInID ).TotalCoolingLoad;
-						System( SysNum ).TotalCondDefrostCredit += WalkIn( WalkInID ).HotDefrostCondCredit;
+						System( SysNum ).TotalCoolingLoad += WalkIn( SimulateDetailedRefrigerationSystemsWalkInID ).TotalCoolingLoad;
+						System( SysNum ).TotalCondDefrostCredit += WalkIn( SimulateDetailedRefrigerationSystemsWalkInID ).HotDefrostCondCredit;
 					} //NumWalkIns systems
 				} //System(SysNum)%NumWalkIns > 0
 
 				if ( System( SysNum ).NumCoils > 0 ) {
-					for ( CoilIndex = 1; CoilIndex <= System( SysNum ).NumCoils; ++CoilIndex ) {
-						CoilID = System( SysNum ).CoilNum( CoilIndex );
+					for ( SimulateDetailedRefrigerationSystemsCoilIndex = 1; SimulateDetailedRefrigerationSystemsCoilIndex <= System( SysNum ).NumCoils; ++SimulateDetailedRefrigerationSystemsCoilIndex ) {
+						SimulateDetailedRefrigerationSystemsCoilID = System( SysNum ).CoilNum( SimulateDetailedRefrigerationSystemsCoilIndex );
 						// already CALLed CalculateCoil(CoilID) in CoilSet specified order
 						if ( System( SysNum ).CompSuctControl == ConstantSuctionTemperature ) {
 							System( SysNum ).TEvapNeeded = System( SysNum ).TEvapDesign;
@@ -8392,15 +9186,15 @@ namespace RefrigeratedCase {
 							System( SysNum ).TEvapNeeded = System( SysNum ).TEvapDesign;
 						} //floating or constant evap temperature
 						// increment TotalCoolingLoad for Compressors/condenser on each system
-						System( SysNum ).TotalCoolingLoad += WarehouseCoil( CoilID ).TotalCoolingLoad;
-						System( SysNum ).TotalCondDefrostCredit += WarehouseCoil( CoilID ).HotDefrostCondCredit;
+						System( SysNum ).TotalCoolingLoad += WarehouseCoil( SimulateDetailedRefrigerationSystemsCoilID ).TotalCoolingLoad;
+						System( SysNum ).TotalCondDefrostCredit += WarehouseCoil( SimulateDetailedRefrigerationSystemsCoilID ).HotDefrostCondCredit;
 					} //NumCoils systems
 				} //System(SysNum)%NumCoils > 0
 
 				if ( System( SysNum ).NumSecondarys > 0 ) {
 					for ( SecondIndex = 1; SecondIndex <= System( SysNum ).NumSecondarys; ++SecondIndex ) {
-						SecondID = System( SysNum ).SecondaryNum( SecondIndex );
-						CalculateSecondary( SecondID );
+						SimulateDetailedRefrigerationSystemsSecondID = System( SysNum ).SecondaryNum( SecondIndex );
+						CalculateSecondary( SimulateDetailedRefrigerationSystemsSecondID );
 						if ( System( SysNum ).CompSuctControl == ConstantSuctionTemperature ) {
 							System( SysNum ).TEvapNeeded = System( SysNum ).TEvapDesign;
 						} else { // check for lowest T evap design among the secondary systems and
@@ -8409,14 +9203,14 @@ namespace RefrigeratedCase {
 							//  at the MINIMUM (note secondary loops control capacity with
 							//  brine flow rate, so don't float above their design evap temperature)
 							if ( SecondIndex == 1 && System( SysNum ).NumNonCascadeLoads == 0 ) {
-								System( SysNum ).TEvapNeeded = Secondary( SecondID ).TEvapDesign;
+								System( SysNum ).TEvapNeeded = Secondary( SimulateDetailedRefrigerationSystemsSecondID ).TEvapDesign;
 							} else {
-								System( SysNum ).TEvapNeeded = min( Secondary( SecondID ).TEvapDesign, System( SysNum ).TEvapNeeded );
+								System( SysNum ).TEvapNeeded = min( Secondary( SimulateDetailedRefrigerationSystemsSecondID ).TEvapDesign, System( SysNum ).TEvapNeeded );
 							}
 						} //floating or constant evap temperature
 						// increment TotalCoolingLoad for Compressors/condenser on each system
-						System( SysNum ).SumSecondaryLoopLoad += Secondary( SecondID ).TotalCoolingLoad;
-						System( SysNum ).TotalCondDefrostCredit += Secondary( SecondID ).HotDefrostCondCredit;
+						System( SysNum ).SumSecondaryLoopLoad += Secondary( SimulateDetailedRefrigerationSystemsSecondID ).TotalCoolingLoad;
+						System( SysNum ).TotalCondDefrostCredit += Secondary( SimulateDetailedRefrigerationSystemsSecondID ).HotDefrostCondCredit;
 					} //NumSecondarys systems
 				} //System(SysNum)%NumSecondarys > 0
 
@@ -8489,8 +9283,8 @@ namespace RefrigeratedCase {
 					//This loop places load on system absorbing heat from cascade condenser and &
 					//     condenser heat reclaim credits from hot gas/brine defrosts
 					if ( ( System( SysNum ).NumCascadeLoads > 0 ) && ( ! FirstSCLoop ) ) {
-						for ( CascadeLoadIndex = 1; CascadeLoadIndex <= System( SysNum ).NumCascadeLoads; ++CascadeLoadIndex ) {
-							CascadeLoadID = System( SysNum ).CascadeLoadNum( CascadeLoadIndex );
+						for ( SimulateDetailedRefrigerationSystemsCascadeLoadIndex = 1; SimulateDetailedRefrigerationSystemsCascadeLoadIndex <= System( SysNum ).NumCascadeLoads; ++SimulateDetailedRefrigerationSystemsCascadeLoadIndex ) {
+							CascadeLoadID = System( SysNum ).CascadeLoadNum( SimulateDetailedRefrigerationSystemsCascadeLoadIndex );
 							if ( System( SysNum ).CompSuctControl == ConstantSuctionTemperature ) {
 								System( SysNum ).TEvapNeeded = System( SysNum ).TEvapDesign;
 							} else { // check for lowest T evap design among the CascadeLoad systems and
@@ -8499,7 +9293,7 @@ namespace RefrigeratedCase {
 								//  at the MINIMUM
 								if ( Condenser( CascadeLoadID ).CascadeTempControl == CascadeTempSet ) {
 									//if float then set tevap based upon other loads
-									if ( CascadeLoadIndex == 1 && System( SysNum ).NumNonCascadeLoads == 0 ) {
+									if ( SimulateDetailedRefrigerationSystemsCascadeLoadIndex == 1 && System( SysNum ).NumNonCascadeLoads == 0 ) {
 										System( SysNum ).TEvapNeeded = Condenser( CascadeLoadID ).CascadeRatedEvapTemp;
 									} else {
 										System( SysNum ).TEvapNeeded = min( Condenser( CascadeLoadID ).CascadeRatedEvapTemp, System( SysNum ).TEvapNeeded );
@@ -8548,17 +9342,17 @@ namespace RefrigeratedCase {
 						}
 
 						CalcDetailedSystem( SysNum );
-						DeRate = false;
+						SimulateDetailedRefrigerationSystemsDeRate = false;
 
 						//With air chiller coils, don't use unmet energy, instead reduce capacity on coils to match avail compressor/cond capacity
 						CurrentLoads = System( SysNum ).TotalSystemLoad + System( SysNum ).LSHXTrans; //because compressor capacity rated from txv to comp inlet
 						if ( ( System( SysNum ).CoilFlag ) && ( CurrentLoads > ( System( SysNum ).TotCompCapacity * 1.001 ) ) ) {
-							DeRate = true;
-							FinalRateCoils( DeRate, DetailedSystem, SysNum, CurrentLoads, System( SysNum ).TotCompCapacity );
+							SimulateDetailedRefrigerationSystemsDeRate = true;
+							FinalRateCoils( SimulateDetailedRefrigerationSystemsDeRate, DetailedSystem, SysNum, CurrentLoads, System( SysNum ).TotCompCapacity );
 							System( SysNum ).TotalCoolingLoad = 0.0;
 							System( SysNum ).TotalCondDefrostCredit = 0.0;
-							for ( CoilIndex = 1; CoilIndex <= System( SysNum ).NumCoils; ++CoilIndex ) {
-								CoilID = System( SysNum ).CoilNum( CoilIndex );
+							for ( SimulateDetailedRefrigerationSystemsCoilIndex = 1; SimulateDetailedRefrigerationSystemsCoilIndex <= System( SysNum ).NumCoils; ++SimulateDetailedRefrigerationSystemsCoilIndex ) {
+								SimulateDetailedRefrigerationSystemsCoilID = System( SysNum ).CoilNum( SimulateDetailedRefrigerationSystemsCoilIndex );
 								// already CALLed CalculateCoil(CoilID) in CoilSet specified order
 								if ( System( SysNum ).CompSuctControl == ConstantSuctionTemperature ) {
 									System( SysNum ).TEvapNeeded = System( SysNum ).TEvapDesign;
@@ -8568,8 +9362,8 @@ namespace RefrigeratedCase {
 									ShowContinueError( " Floating evaporator temperature model not yet available for warehouse coil systems. " );
 								} //floating or constant evap temperature
 								// increment TotalCoolingLoad for Compressors/condenser on each system
-								System( SysNum ).TotalCoolingLoad += WarehouseCoil( CoilID ).TotalCoolingLoad;
-								System( SysNum ).TotalCondDefrostCredit += WarehouseCoil( CoilID ).HotDefrostCondCredit;
+								System( SysNum ).TotalCoolingLoad += WarehouseCoil( SimulateDetailedRefrigerationSystemsCoilID ).TotalCoolingLoad;
+								System( SysNum ).TotalCondDefrostCredit += WarehouseCoil( SimulateDetailedRefrigerationSystemsCoilID ).HotDefrostCondCredit;
 							} //NumCoils systems
 							if ( System( SysNum ).NumStages == 2 && System( SysNum ).TotHiStageCompCapacity < ( System( SysNum ).TotalCoolingLoad + System( SysNum ).LSHXTrans + System( SysNum ).TotCompPower ) ) {
 								ShowRecurringWarningErrorAtEnd( "Refrigeration:System: " + System( SysNum ).Name + ":The specified high-stage compressors for this system are unable to meet the sum of the refrigeration loads, ", System( SysNum ).HiStageWarnIndex1 );
@@ -8641,9 +9435,9 @@ namespace RefrigeratedCase {
 
 				// Report variables
 				System( SysNum ).TotTransferLoad = System( SysNum ).SumMechSCLoad - System( SysNum ).SumMechSCBenefit + System( SysNum ).SumSecondaryLoopLoad + System( SysNum ).SumCascadeLoad;
-				System( SysNum ).TotTransferEnergy = System( SysNum ).TotTransferLoad * LocalTimeStep * SecInHour;
-				System( SysNum ).PipeHeatEnergy = System( SysNum ).PipeHeatLoad * LocalTimeStep * SecInHour;
-				System( SysNum ).TotalCoolingEnergy = System( SysNum ).TotalCoolingLoad * LocalTimeStep * SecInHour;
+				System( SysNum ).TotTransferEnergy = System( SysNum ).TotTransferLoad * SimulateDetailedRefrigerationSystemsLocalTimeStep * SecInHour;
+				System( SysNum ).PipeHeatEnergy = System( SysNum ).PipeHeatLoad * SimulateDetailedRefrigerationSystemsLocalTimeStep * SecInHour;
+				System( SysNum ).TotalCoolingEnergy = System( SysNum ).TotalCoolingLoad * SimulateDetailedRefrigerationSystemsLocalTimeStep * SecInHour;
 			} //(((.NOT. UseSysTimeStep).AND.(.NOT. System(SysNum)%CoilFlag)).OR.((UseSysTimeStep).AND.(System(SysNum)%CoilFlag))).and.not WarmupFlag
 		} // SysNum = 1,NumRefrigSystems
 
@@ -8653,14 +9447,14 @@ namespace RefrigeratedCase {
 		// Note that case credit is negative for cooling, thus subtract positive value calculated for coil
 		//   Note this is done whether or not the coils are derated.
 		if ( UseSysTimeStep ) {
-			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
-				for ( CoilID = 1; CoilID <= NumSimulationRefrigAirChillers; ++CoilID ) {
-					if ( WarehouseCoil( CoilID ).ZoneNum != ZoneNum ) continue;
-					CoilSysCredit( ZoneNum ).SenCreditToZoneRate -= WarehouseCoil( CoilID ).SensCreditRate;
-					CoilSysCredit( ZoneNum ).SenCreditToZoneEnergy = CoilSysCredit( ZoneNum ).SenCreditToZoneRate * LocalTimeStep * SecInHour;
-					CoilSysCredit( ZoneNum ).LatKgPerS_ToZoneRate -= WarehouseCoil( CoilID ).LatKgPerS_ToZone;
-					CoilSysCredit( ZoneNum ).LatCreditToZoneRate -= WarehouseCoil( CoilID ).LatCreditRate;
-					CoilSysCredit( ZoneNum ).LatCreditToZoneEnergy -= WarehouseCoil( CoilID ).LatCreditEnergy;
+			for ( SimulateDetailedRefrigerationSystemsZoneNum = 1; SimulateDetailedRefrigerationSystemsZoneNum <= NumOfZones; ++SimulateDetailedRefrigerationSystemsZoneNum ) {
+				for ( SimulateDetailedRefrigerationSystemsCoilID = 1; SimulateDetailedRefrigerationSystemsCoilID <= NumSimulationRefrigAirChillers; ++SimulateDetailedRefrigerationSystemsCoilID ) {
+					if ( WarehouseCoil( SimulateDetailedRefrigerationSystemsCoilID ).ZoneNum != SimulateDetailedRefrigerationSystemsZoneNum ) continue;
+					CoilSysCredit( SimulateDetailedRefrigerationSystemsZoneNum ).SenCreditToZoneRate -= WarehouseCoil( SimulateDetailedRefrigerationSystemsCoilID ).SensCreditRate;
+					CoilSysCredit( SimulateDetailedRefrigerationSystemsZoneNum ).SenCreditToZoneEnergy = CoilSysCredit( SimulateDetailedRefrigerationSystemsZoneNum ).SenCreditToZoneRate * SimulateDetailedRefrigerationSystemsLocalTimeStep * SecInHour;
+					CoilSysCredit( SimulateDetailedRefrigerationSystemsZoneNum ).LatKgPerS_ToZoneRate -= WarehouseCoil( SimulateDetailedRefrigerationSystemsCoilID ).LatKgPerS_ToZone;
+					CoilSysCredit( SimulateDetailedRefrigerationSystemsZoneNum ).LatCreditToZoneRate -= WarehouseCoil( SimulateDetailedRefrigerationSystemsCoilID ).LatCreditRate;
+					CoilSysCredit( SimulateDetailedRefrigerationSystemsZoneNum ).LatCreditToZoneEnergy -= WarehouseCoil( SimulateDetailedRefrigerationSystemsCoilID ).LatCreditEnergy;
 				}
 			}
 		}
@@ -8711,21 +9505,10 @@ namespace RefrigeratedCase {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static std::string const RoutineName( "SimulateDetailedTransRefrigSystems" );
 		int SysNum; // Index to the detailed transcritical refrigeration system being modeled
-		static bool FirstSCLoop( true ); // Flag first time through multi-system loop used when mech subcoolers present
-		static int StartMechSubcoolLoop( 3 ); // if no mechanical subcoolers transfer energy between system, don't loop
-		static int LoopNum( 0 ); // Index to overall repeat necessary for mechanical subcoolers
-		static int CaseID( 0 ); // Absolute reference to case
-		static int CaseIndex( 0 ); // Index to case
-		static int CondInletAirZoneNum( 0 ); // Index used to assign zone credits
-		static int SuctionPipeActualZoneNum( 0 ); // Index to zone exchanging heat with suction pipes
-		static int WalkInID( 0 ); // Absolute reference to WalkIn
-		static int WalkInIndex( 0 ); // Index to WalkIn
-		static Real64 LocalTimeStep( 0.0 ); // Set equal to either TimeStepSys or TimeStepZone
-		static Real64 CurrentLoads( 0.0 ); // current loads on compressor, exclusive of unmet loads from prev time steps
 		Real64 SuctionPipeZoneTemp; // Temperature for zone identified as environment for suction pipe heat gains, C
 
-		LocalTimeStep = TimeStepZone;
-		if ( UseSysTimeStep ) LocalTimeStep = TimeStepSys;
+		SimulateDetailedTransRefrigSystemsLocalTimeStep = TimeStepZone;
+		if ( UseSysTimeStep ) SimulateDetailedTransRefrigSystemsLocalTimeStep = TimeStepSys;
 
 		//  Do transcritical CO2 refrigeration system loop outside of iterative solution to initialize time step and
 		//  calculate case and and walk-ins (that won't change during balance of refrigeration system iterations)
@@ -8735,54 +9518,54 @@ namespace RefrigeratedCase {
 		for ( SysNum = 1; SysNum <= NumTransRefrigSystems; ++SysNum ) {
 			//Only do those systems appropriate for this analysis, supermarket type on load time step
 			if ( TransSystem( SysNum ).NumCasesMT > 0 ) {
-				for ( CaseIndex = 1; CaseIndex <= TransSystem( SysNum ).NumCasesMT; ++CaseIndex ) {
-					CaseID = TransSystem( SysNum ).CaseNumMT( CaseIndex );
-					CalculateCase( CaseID );
+				for ( SimulateDetailedTransRefrigSystemsCaseIndex = 1; SimulateDetailedTransRefrigSystemsCaseIndex <= TransSystem( SysNum ).NumCasesMT; ++SimulateDetailedTransRefrigSystemsCaseIndex ) {
+					SimulateDetailedTransRefrigSystemsCaseID = TransSystem( SysNum ).CaseNumMT( SimulateDetailedTransRefrigSystemsCaseIndex );
+					CalculateCase( SimulateDetailedTransRefrigSystemsCaseID );
 					//  TEvapDesignMT calc in Get Input to meet lowest evap temp of any MT load on the system.
 					//  TEvapNeededMT is fixed at this design value.
 					TransSystem( SysNum ).TEvapNeededMT = TransSystem( SysNum ).TEvapDesignMT;
 					// increment TotalCoolingLoad for Compressors/gas cooler on each system and defrost gas cooler credits for heat recovery
-					TransSystem( SysNum ).TotalCoolingLoadMT += RefrigCase( CaseID ).TotalCoolingLoad;
-					TransSystem( SysNum ).TotalCondDefrostCredit += RefrigCase( CaseID ).HotDefrostCondCredit;
+					TransSystem( SysNum ).TotalCoolingLoadMT += RefrigCase( SimulateDetailedTransRefrigSystemsCaseID ).TotalCoolingLoad;
+					TransSystem( SysNum ).TotalCondDefrostCredit += RefrigCase( SimulateDetailedTransRefrigSystemsCaseID ).HotDefrostCondCredit;
 				} //NumCasesMT
 			} //Num of MT cases > 0
 
 			if ( TransSystem( SysNum ).NumCasesLT > 0 ) {
-				for ( CaseIndex = 1; CaseIndex <= TransSystem( SysNum ).NumCasesLT; ++CaseIndex ) {
-					CaseID = TransSystem( SysNum ).CaseNumLT( CaseIndex );
-					CalculateCase( CaseID );
+				for ( SimulateDetailedTransRefrigSystemsCaseIndex = 1; SimulateDetailedTransRefrigSystemsCaseIndex <= TransSystem( SysNum ).NumCasesLT; ++SimulateDetailedTransRefrigSystemsCaseIndex ) {
+					SimulateDetailedTransRefrigSystemsCaseID = TransSystem( SysNum ).CaseNumLT( SimulateDetailedTransRefrigSystemsCaseIndex );
+					CalculateCase( SimulateDetailedTransRefrigSystemsCaseID );
 					//  TEvapDesignLT calc in Get Input to meet lowest evap temp of any LT load on the system.
 					//  TEvapNeededLT is fixed at this design value.
 					TransSystem( SysNum ).TEvapNeededLT = TransSystem( SysNum ).TEvapDesignLT;
 					// increment TotalCoolingLoad for Compressors/gas cooler on each system and defrost gas cooler credits for heat recovery
-					TransSystem( SysNum ).TotalCoolingLoadLT += RefrigCase( CaseID ).TotalCoolingLoad;
-					TransSystem( SysNum ).TotalCondDefrostCredit += RefrigCase( CaseID ).HotDefrostCondCredit;
+					TransSystem( SysNum ).TotalCoolingLoadLT += RefrigCase( SimulateDetailedTransRefrigSystemsCaseID ).TotalCoolingLoad;
+					TransSystem( SysNum ).TotalCondDefrostCredit += RefrigCase( SimulateDetailedTransRefrigSystemsCaseID ).HotDefrostCondCredit;
 				} //NumCasesLT
 			} //Num of LT cases > 0
 
 			if ( TransSystem( SysNum ).NumWalkInsMT > 0 ) {
-				for ( WalkInIndex = 1; WalkInIndex <= TransSystem( SysNum ).NumWalkInsMT; ++WalkInIndex ) {
-					WalkInID = TransSystem( SysNum ).WalkInNumMT( WalkInIndex );
-					CalculateWalkIn( WalkInID );
+				for ( SimulateDetailedTransRefrigSystemsWalkInIndex = 1; SimulateDetailedTransRefrigSystemsWalkInIndex <= TransSystem( SysNum ).NumWalkInsMT; ++SimulateDetailedTransRefrigSystemsWalkInIndex ) {
+					SimulateDetailedTransRefrigSystemsWalkInID = TransSystem( SysNum ).WalkInNumMT( SimulateDetailedTransRefrigSystemsWalkInIndex );
+					CalculateWalkIn( SimulateDetailedTransRefrigSystemsWalkInID );
 					//  TEvapDesignMT calc in Get Input to meet lowest evap temp of any MT load on the system.
 					//  TEvapNeededMT is fixed at this design value.
 					TransSystem( SysNum ).TEvapNeededMT = TransSystem( SysNum ).TEvapDesignMT;
 					// increment TotalCoolingLoad for Compressors/gas cooler on each system
-					TransSystem( SysNum ).TotalCoolingLoadMT += WalkIn( WalkInID ).TotalCoolingLoad;
-					TransSystem( SysNum ).TotalCondDefrostCredit += WalkIn( WalkInID ).HotDefrostCondCredit;
+					TransSystem( SysNum ).TotalCoolingLoadMT += WalkIn( SimulateDetailedTransRefrigSystemsWalkInID ).TotalCoolingLoad;
+					TransSystem( SysNum ).TotalCondDefrostCredit += WalkIn( SimulateDetailedTransRefrigSystemsWalkInID ).HotDefrostCondCredit;
 				} //NumWalkInsMT systems
 			} //TransSystem(SysNum)%NumWalkInsMT > 0
 
 			if ( TransSystem( SysNum ).NumWalkInsLT > 0 ) {
-				for ( WalkInIndex = 1; WalkInIndex <= TransSystem( SysNum ).NumWalkInsLT; ++WalkInIndex ) {
-					WalkInID = TransSystem( SysNum ).WalkInNumLT( WalkInIndex );
-					CalculateWalkIn( WalkInID );
+				for ( SimulateDetailedTransRefrigSystemsWalkInIndex = 1; SimulateDetailedTransRefrigSystemsWalkInIndex <= TransSystem( SysNum ).NumWalkInsLT; ++SimulateDetailedTransRefrigSystemsWalkInIndex ) {
+					SimulateDetailedTransRefrigSystemsWalkInID = TransSystem( SysNum ).WalkInNumLT( SimulateDetailedTransRefrigSystemsWalkInIndex );
+					CalculateWalkIn( SimulateDetailedTransRefrigSystemsWalkInID );
 					//  TEvapDesignLT calc in Get Input to meet lowest evap temp of any LT load on the system.
 					//  TEvapNeeded is fixed at this design value.
 					TransSystem( SysNum ).TEvapNeededLT = TransSystem( SysNum ).TEvapDesignLT;
 					// increment TotalCoolingLoad for Compressors/gas cooler on each system
-					TransSystem( SysNum ).TotalCoolingLoadLT += WalkIn( WalkInID ).TotalCoolingLoad;
-					TransSystem( SysNum ).TotalCondDefrostCredit += WalkIn( WalkInID ).HotDefrostCondCredit;
+					TransSystem( SysNum ).TotalCoolingLoadLT += WalkIn( SimulateDetailedTransRefrigSystemsWalkInID ).TotalCoolingLoad;
+					TransSystem( SysNum ).TotalCondDefrostCredit += WalkIn( SimulateDetailedTransRefrigSystemsWalkInID ).HotDefrostCondCredit;
 				} //NumWalkInsLT systems
 			} //TransSystem(SysNum)%NumWalkInsLT > 0
 
@@ -8795,10 +9578,10 @@ namespace RefrigeratedCase {
 				TransSystem( SysNum ).PipeHeatLoadMT = TransSystem( SysNum ).SumUASuctionPipingMT * ( SuctionPipeZoneTemp - TransSystem( SysNum ).TEvapNeededMT );
 				// pipe heat load is a positive number (ie. heat absorbed by pipe, so needs to be subtracted
 				//   from refrigcasecredit (- for cooling zone, + for heating zone)
-				SuctionPipeActualZoneNum = TransSystem( SysNum ).SuctionPipeActualZoneNumMT;
+				SimulateDetailedTransRefrigSystemsSuctionPipeActualZoneNum = TransSystem( SysNum ).SuctionPipeActualZoneNumMT;
 				//Can arrive here when load call to refrigeration looks for cases/walkin systems and usetimestep is .FALSE.
 				if ( ( ! UseSysTimeStep ) && ( ( NumSimulationCases > 0 ) || ( NumSimulationWalkIns > 0 ) ) ) {
-					RefrigCaseCredit( SuctionPipeActualZoneNum ).SenCaseCreditToZone -= TransSystem( SysNum ).PipeHeatLoadMT;
+					RefrigCaseCredit( SimulateDetailedTransRefrigSystemsSuctionPipeActualZoneNum ).SenCaseCreditToZone -= TransSystem( SysNum ).PipeHeatLoadMT;
 				} //UseSysTimeStep
 			}
 
@@ -8808,10 +9591,10 @@ namespace RefrigeratedCase {
 				TransSystem( SysNum ).PipeHeatLoadLT = TransSystem( SysNum ).SumUASuctionPipingLT * ( SuctionPipeZoneTemp - TransSystem( SysNum ).TEvapNeededLT );
 				// pipe heat load is a positive number (ie. heat absorbed by pipe, so needs to be subtracted
 				//   from refrigcasecredit (- for cooling zone, + for heating zone)
-				SuctionPipeActualZoneNum = TransSystem( SysNum ).SuctionPipeActualZoneNumLT;
+				SimulateDetailedTransRefrigSystemsSuctionPipeActualZoneNum = TransSystem( SysNum ).SuctionPipeActualZoneNumLT;
 				//Can arrive here when load call to refrigeration looks for cases/walkin systems and usetimestep is .FALSE.
 				if ( ( ! UseSysTimeStep ) && ( ( NumSimulationCases > 0 ) || ( NumSimulationWalkIns > 0 ) ) ) {
-					RefrigCaseCredit( SuctionPipeActualZoneNum ).SenCaseCreditToZone -= TransSystem( SysNum ).PipeHeatLoadLT;
+					RefrigCaseCredit( SimulateDetailedTransRefrigSystemsSuctionPipeActualZoneNum ).SenCaseCreditToZone -= TransSystem( SysNum ).PipeHeatLoadLT;
 				} //UseSysTimeStep
 			}
 
@@ -8821,11 +9604,11 @@ namespace RefrigeratedCase {
 		// transfer between detailed transcritical refrigeration systems
 		// requires additional iteration at this level.
 
-		StartMechSubcoolLoop = 3;
-		if ( NumSimulationSharedGasCoolers > 0 ) StartMechSubcoolLoop = 1;
+		SimulateDetailedTransRefrigSystemsStartMechSubcoolLoop = 3;
+		if ( NumSimulationSharedGasCoolers > 0 ) SimulateDetailedTransRefrigSystemsStartMechSubcoolLoop = 1;
 
-		FirstSCLoop = true;
-		for ( LoopNum = StartMechSubcoolLoop; LoopNum <= 3; ++LoopNum ) {
+		SimulateDetailedTransRefrigSystemsFirstSCLoop = true;
+		for ( SimulateDetailedTransRefrigSystemsLoopNum = SimulateDetailedTransRefrigSystemsStartMechSubcoolLoop; SimulateDetailedTransRefrigSystemsLoopNum <= 3; ++SimulateDetailedTransRefrigSystemsLoopNum ) {
 
 			for ( SysNum = 1; SysNum <= NumTransRefrigSystems; ++SysNum ) {
 				//Only do those systems appropriate for this analysis, supermarket type on load time step or coil type on sys time step
@@ -8866,19 +9649,19 @@ namespace RefrigeratedCase {
 
 				} //TransSystem(SysNum)%TotalSystemLoad > 0
 			} //SysNum over NumRefrigSystems
-			FirstSCLoop = false;
+			SimulateDetailedTransRefrigSystemsFirstSCLoop = false;
 		} // LoopNum, three times for buildings with multiple detailed systems connected with shared gas coolers
 
 		// Unmet load is done outside iterative loop
 		for ( SysNum = 1; SysNum <= NumTransRefrigSystems; ++SysNum ) {
 			//Only do those systems appropriate for this analysis, supermarket type on load time step or coil type on sys time step
 			if ( ( ! UseSysTimeStep ) && ( ! WarmupFlag ) ) {
-				CurrentLoads = TransSystem( SysNum ).TotalSystemLoad;
+				SimulateDetailedTransRefrigSystemsCurrentLoads = TransSystem( SysNum ).TotalSystemLoad;
 				// Meeting current and possibly some portion of the previously unmet energy
 				// perhaps future interest in reporting percent of installed capacity used(or number of compressors) ?
 				// If the system compressors were unable to meet the current loads, save energy to be met in succeeding time step
 				// Note the unmet energy is turned into a rate and applied to the system load at the start of calccompressor
-				TransSystem( SysNum ).UnmetEnergy += ( CurrentLoads - TransSystem( SysNum ).TotCompCapacity ) * TimeStepZoneSec;
+				TransSystem( SysNum ).UnmetEnergy += ( SimulateDetailedTransRefrigSystemsCurrentLoads - TransSystem( SysNum ).TotCompCapacity ) * TimeStepZoneSec;
 
 				if ( TransSystem( SysNum ).UnmetEnergy > MyLargeNumber ) {
 					TransSystem( SysNum ).UnmetEnergy = MyLargeNumber;
@@ -8892,16 +9675,16 @@ namespace RefrigeratedCase {
 
 				//Zone-located air-cooled gas cooler reject heat also has to be outside iterative loop
 				if ( TransSystem( SysNum ).SystemRejectHeatToZone ) {
-					CondInletAirZoneNum = GasCooler( TransSystem( SysNum ).GasCoolerNum( 1 ) ).InletAirZoneNum;
+					SimulateDetailedTransRefrigSystemsCondInletAirZoneNum = GasCooler( TransSystem( SysNum ).GasCoolerNum( 1 ) ).InletAirZoneNum;
 					//Can arrive here when load call to refrigeration looks for cases/walkin systems and usetimestep is .FALSE.
 					if ( ( ! UseSysTimeStep ) && ( ( NumSimulationCases > 0 ) || ( NumSimulationWalkIns > 0 ) ) ) {
-						RefrigCaseCredit( CondInletAirZoneNum ).SenCaseCreditToZone += TransSystem( SysNum ).NetHeatRejectLoad; //Adding heat is positive
+						RefrigCaseCredit( SimulateDetailedTransRefrigSystemsCondInletAirZoneNum ).SenCaseCreditToZone += TransSystem( SysNum ).NetHeatRejectLoad; //Adding heat is positive
 					} //UseSystimestep
 				} //Reject heat to zone
 
 				// Report variables
-				TransSystem( SysNum ).PipeHeatEnergy = ( TransSystem( SysNum ).PipeHeatLoadMT + TransSystem( SysNum ).PipeHeatLoadLT ) * LocalTimeStep * SecInHour;
-				TransSystem( SysNum ).TotalCoolingEnergy = ( TransSystem( SysNum ).TotalCoolingLoadMT + TransSystem( SysNum ).TotalCoolingLoadMT ) * LocalTimeStep * SecInHour;
+				TransSystem( SysNum ).PipeHeatEnergy = ( TransSystem( SysNum ).PipeHeatLoadMT + TransSystem( SysNum ).PipeHeatLoadLT ) * SimulateDetailedTransRefrigSystemsLocalTimeStep * SecInHour;
+				TransSystem( SysNum ).TotalCoolingEnergy = ( TransSystem( SysNum ).TotalCoolingLoadMT + TransSystem( SysNum ).TotalCoolingLoadMT ) * SimulateDetailedTransRefrigSystemsLocalTimeStep * SecInHour;
 			} //(.NOT. UseSysTimeStep).AND. (.not. WarmupFlag)
 		} // SysNum = 1,NumTransRefrigSystems
 
@@ -8967,10 +9750,6 @@ namespace RefrigeratedCase {
 		int NumIter;
 		bool NotBalanced;
 		Real64 TCondStart;
-		static Real64 MassFlowCompsStart( 0.0 ); // Mass flow through (low-stage) compressors (single- or two-stage systems)
-		static Real64 MassFlowHiStageCompsStart( 0.0 ); // Mass flow through high-stage comrpessors (two-stage systems only)
-		static Real64 ErrorMassFlowComps( 0.0 ); // Error in calculated (low stage) compressor mass flow (single- or two-stage systems)
-		static Real64 ErrorMassFlowHiStageComps( 0.0 ); // Error in calculated high-stage compressor mass flow (two-stage systems only)
 
 		//Balance This Refrigeration System using calculated refrigerant flow
 		NotBalanced = true;
@@ -9744,7 +10523,6 @@ namespace RefrigeratedCase {
 		Real64 HSatVapCondense; // Enthalpy of saturated vapor at T condense, J/kg
 		Real64 HsatVaporforTevapneeded; // Enthalpy saturated vapor at temperature needed at evaporator
 		Real64 LFLastComp; // Load factor for last compressor dispatched
-		static Real64 LocalTimeStep( 0.0 ); // TimeStepZone for case/walkin systems, TimeStepSys for coil systems
 		Real64 MassCorrection; // Mass flow at existing subcool/superheat over cap at rated conditions
 		Real64 NeededCapacity; // Sum of case loads and mech subcooler loads on suction group
 		Real64 PSuction; // Suction Pressure
@@ -9760,9 +10538,9 @@ namespace RefrigeratedCase {
 		Real64 HHiStageCompIn; // Enthalpy at inlet of high-stage compressor (J/kg)
 		Real64 HCaseInRated_base( 0.0 ), HCompInRated_base( 0.0 );  //Autodesk:Tuned Intermediate values for performance tuning
 
-		LocalTimeStep = TimeStepZone;
-		if ( UseSysTimeStep ) LocalTimeStep = TimeStepSys;
-		Real64 const LocalTimeStepSec( LocalTimeStep * SecInHour );
+		CalculateCompressorsLocalTimeStep = TimeStepZone;
+		if ( UseSysTimeStep ) CalculateCompressorsLocalTimeStep = TimeStepSys;
+		Real64 const LocalTimeStepSec( CalculateCompressorsLocalTimeStep * SecInHour );
 
 		auto & System_SysNum( System( SysNum ) );
 		auto const NumStages( System_SysNum.NumStages );
@@ -10101,8 +10879,6 @@ namespace RefrigeratedCase {
 		int CompID; // Compressor index within all compressors
 		int GasCoolerID; // Gas cooler index for this refrigeration system
 		int Iter; // Iteration counter
-		static Real64 AccumLoadMT( 0.0 ); // Load due to previously unmet medium temperature compressor loads (transcritical system)
-		static Real64 AccumLoadLT( 0.0 ); // Load due to previously unmet low temperature compressor loads (transcritical system)
 		Real64 CapacityCorrectionLT; // Capacity at existing subcool/superheat over cap at rated conditions for LT loads
 		Real64 CapacityCorrectionMT; // Capacity at existing subcool/superheat over cap at rated conditions for MT loads
 		Real64 CaseEnthalpyChangeRatedMT; // Enthalpy change in medium temperature cases at compressor rated cond, J/kg
@@ -10113,18 +10889,15 @@ namespace RefrigeratedCase {
 		Real64 DensityRatedLP; // Density of low pressure compressor inlet gas at rated superheat, m3/kg
 		Real64 HCaseInRatedLT; // Enthalpy entering low temperature cases at rated subcooling, J/kg
 		Real64 HCaseInRatedMT; // Enthalpy entering medium temperature cases at rated subcooling, J/kg
-		static Real64 HCaseOutLTMT( 0.0 ); // Combined enthalpy from the outlets of the LP compressor and MT loads, J/kg
 		Real64 HCompInRatedHP; // Enthalpy entering high pressure compressor at rated superheat, J/kg
 		Real64 HCompInRatedLP; // Enthalpy entering low pressure compressor at rated superheat, J/kg
 		Real64 HGCOutlet; // Enthalpy at gas cooler outlet, J/kg
 		Real64 HIdeal; // Ideal enthalpy at subcooler (for 100% effectiveness)
 		Real64 Hnew; // Calucalted enthalpy, J/kg
-		static Real64 HReceiverBypass( 0.0 ); // Enthalpy at the receiver bypass, J/kg
 		Real64 HsatLiqforTevapNeededMT; // Enthalpy of saturated liquid at MT evaporator, J/kg
 		Real64 HsatVaporforTevapneededMT; // Enthlapy of saturated vapor at MT evaporator (transcritical cycle), J/kg
 		Real64 HsatVaporforTevapneededLT; // Enthlapy of saturated vapor at LT evaporator (transcritical cycle), J/kg
 		Real64 LFLastComp; // Load factor for last compressor dispatched
-		static Real64 LocalTimeStep( 0.0 ); // TimeStepZone for case/walkin systems, TimeStepSys for coil systems
 		Real64 MassCorrectionLT; // Mass flow at existing subcool/superheat over cap at rated conditions for LT loads
 		Real64 MassCorrectionMT; // Mass flow at existing subcool/superheat over cap at rated conditions for MT loads
 		Real64 NeededCapacityLT; // Sum of LT case loads and mech subcooler loads (transcritical cycle), W
@@ -10148,8 +10921,8 @@ namespace RefrigeratedCase {
 		Real64 Xl; // Initial lower guess for iterative search
 		Real64 Xnew; // New guess for iterative search
 
-		LocalTimeStep = TimeStepZone;
-		if ( UseSysTimeStep ) LocalTimeStep = TimeStepSys;
+		CalculateTransCompressorsLocalTimeStep = TimeStepZone;
+		if ( UseSysTimeStep ) CalculateTransCompressorsLocalTimeStep = TimeStepSys;
 
 		GasCoolerID = TransSystem( SysNum ).GasCoolerNum( 1 );
 
@@ -10157,10 +10930,10 @@ namespace RefrigeratedCase {
 		AccumLoadLT = 0.0;
 		NeededCapacityLT = 0.0;
 		if ( TransSystem( SysNum ).TransSysType == 2 ) {
-			AccumLoadLT = max( 0.0, ( TransSystem( SysNum ).UnmetEnergyLT / LocalTimeStep / SecInHour ) );
+			AccumLoadLT = max( 0.0, ( TransSystem( SysNum ).UnmetEnergyLT / CalculateTransCompressorsLocalTimeStep / SecInHour ) );
 			NeededCapacityLT = TransSystem( SysNum ).TotalSystemLoadLT + AccumLoadLT + TransSystem( SysNum ).PipeHeatLoadLT;
 		} // (TransSystem(SysNum)%TransSysType == 2)
-		AccumLoadMT = max( 0.0, ( TransSystem( SysNum ).UnmetEnergyMT / LocalTimeStep / SecInHour ) );
+		AccumLoadMT = max( 0.0, ( TransSystem( SysNum ).UnmetEnergyMT / CalculateTransCompressorsLocalTimeStep / SecInHour ) );
 		NeededCapacityMT = TransSystem( SysNum ).TotalSystemLoadMT + AccumLoadMT + TransSystem( SysNum ).PipeHeatLoadMT;
 
 		// Determine refrigerant properties at receiver
@@ -10226,8 +10999,8 @@ namespace RefrigeratedCase {
 				Compressor( CompID ).Power = CurveValue( Compressor( CompID ).ElecPowerCurvePtr, TsatforPsucLT, TsatforPdisLT );
 				Compressor( CompID ).Capacity = CapacityCorrectionLT * CurveValue( Compressor( CompID ).CapacityCurvePtr, TsatforPsucLT, TsatforPdisLT );
 				Compressor( CompID ).MassFlow = Compressor( CompID ).Capacity / TotalEnthalpyChangeActualLT;
-				Compressor( CompID ).ElecConsumption = Compressor( CompID ).Power * LocalTimeStep * SecInHour;
-				Compressor( CompID ).CoolingEnergy = Compressor( CompID ).Capacity * LocalTimeStep * SecInHour;
+				Compressor( CompID ).ElecConsumption = Compressor( CompID ).Power * CalculateTransCompressorsLocalTimeStep * SecInHour;
+				Compressor( CompID ).CoolingEnergy = Compressor( CompID ).Capacity * CalculateTransCompressorsLocalTimeStep * SecInHour;
 				Compressor( CompID ).LoadFactor = 1.0;
 				if ( ( TransSystem( SysNum ).TotCompCapacityLP + Compressor( CompID ).Capacity ) >= NeededCapacityLT ) {
 					LFLastComp = ( NeededCapacityLT - TransSystem( SysNum ).TotCompCapacityLP ) / Compressor( CompID ).Capacity;
@@ -10237,8 +11010,8 @@ namespace RefrigeratedCase {
 					TransSystem( SysNum ).TotCompCapacityLP += Compressor( CompID ).Capacity;
 					TransSystem( SysNum ).RefMassFlowCompsLP += Compressor( CompID ).MassFlow;
 					TransSystem( SysNum ).TotCompPowerLP += Compressor( CompID ).Power;
-					Compressor( CompID ).ElecConsumption = Compressor( CompID ).Power * LocalTimeStep * SecInHour;
-					Compressor( CompID ).CoolingEnergy = Compressor( CompID ).Capacity * LocalTimeStep * SecInHour;
+					Compressor( CompID ).ElecConsumption = Compressor( CompID ).Power * CalculateTransCompressorsLocalTimeStep * SecInHour;
+					Compressor( CompID ).CoolingEnergy = Compressor( CompID ).Capacity * CalculateTransCompressorsLocalTimeStep * SecInHour;
 					Compressor( CompID ).LoadFactor = LFLastComp;
 					break;
 				} else {
@@ -10402,8 +11175,8 @@ namespace RefrigeratedCase {
 			} // (GasCooler(SysNum)%TransOpFlag)
 			//  Mass flow through HP compressors is HP compressor refrigerating capacity divided by MT load, LT load and LP compressor power
 			Compressor( CompID ).MassFlow = TotalRefMassFlow * Compressor( CompID ).Capacity / ( NeededCapacityMT + NeededCapacityLT + TransSystem( SysNum ).TotCompPowerLP );
-			Compressor( CompID ).ElecConsumption = Compressor( CompID ).Power * LocalTimeStep * SecInHour;
-			Compressor( CompID ).CoolingEnergy = Compressor( CompID ).Capacity * LocalTimeStep * SecInHour;
+			Compressor( CompID ).ElecConsumption = Compressor( CompID ).Power * CalculateTransCompressorsLocalTimeStep * SecInHour;
+			Compressor( CompID ).CoolingEnergy = Compressor( CompID ).Capacity * CalculateTransCompressorsLocalTimeStep * SecInHour;
 			Compressor( CompID ).LoadFactor = 1.0;
 			// calculate load factor for last compressor addded
 			// assumes either cycling or part load eff = full load eff for last compressor
@@ -10415,8 +11188,8 @@ namespace RefrigeratedCase {
 				TransSystem( SysNum ).TotCompCapacityHP += Compressor( CompID ).Capacity;
 				TransSystem( SysNum ).RefMassFlowCompsHP += Compressor( CompID ).MassFlow;
 				TransSystem( SysNum ).TotCompPowerHP += Compressor( CompID ).Power;
-				Compressor( CompID ).ElecConsumption = Compressor( CompID ).Power * LocalTimeStep * SecInHour;
-				Compressor( CompID ).CoolingEnergy = Compressor( CompID ).Capacity * LocalTimeStep * SecInHour;
+				Compressor( CompID ).ElecConsumption = Compressor( CompID ).Power * CalculateTransCompressorsLocalTimeStep * SecInHour;
+				Compressor( CompID ).CoolingEnergy = Compressor( CompID ).Capacity * CalculateTransCompressorsLocalTimeStep * SecInHour;
 				Compressor( CompID ).LoadFactor = LFLastComp;
 				break;
 			} else {
@@ -10431,8 +11204,8 @@ namespace RefrigeratedCase {
 		TransSystem( SysNum ).RefMassFlowComps = TransSystem( SysNum ).RefMassFlowCompsLP + TransSystem( SysNum ).RefMassFlowCompsHP;
 		TransSystem( SysNum ).TotCompCapacity = TransSystem( SysNum ).TotCompCapacityHP + TransSystem( SysNum ).TotCompCapacityLP;
 		TransSystem( SysNum ).AverageCompressorCOP = ( TransSystem( SysNum ).TotCompCapacityHP - TransSystem( SysNum ).TotCompPowerLP ) / ( TransSystem( SysNum ).TotCompPowerLP + TransSystem( SysNum ).TotCompPowerHP );
-		TransSystem( SysNum ).TotCompElecConsump = ( TransSystem( SysNum ).TotCompPowerLP + TransSystem( SysNum ).TotCompPowerHP ) * LocalTimeStep * SecInHour;
-		TransSystem( SysNum ).TotCompCoolingEnergy = ( TransSystem( SysNum ).TotCompCapacityLP + TransSystem( SysNum ).TotCompCapacityHP ) * LocalTimeStep * SecInHour;
+		TransSystem( SysNum ).TotCompElecConsump = ( TransSystem( SysNum ).TotCompPowerLP + TransSystem( SysNum ).TotCompPowerHP ) * CalculateTransCompressorsLocalTimeStep * SecInHour;
+		TransSystem( SysNum ).TotCompCoolingEnergy = ( TransSystem( SysNum ).TotCompCapacityLP + TransSystem( SysNum ).TotCompCapacityHP ) * CalculateTransCompressorsLocalTimeStep * SecInHour;
 
 	}
 
@@ -10485,7 +11258,6 @@ namespace RefrigeratedCase {
 		Real64 ControlTLiqOut; // Controlled temperature of liquid leaving Mechanical subcooler
 		Real64 DelTempActual; // Actual subcooling, T liquid in - T liquid out
 		Real64 DelTLiqDes; // Design Temperature Change on liquid side of LSHX
-		static Real64 LocalTimeStep( 0.0 ); // TimeStepZone for case/walkin systems, TimeStepSys for coil systems
 		Real64 LSHXeffectiveness; // EFfectiveness of liquid suction heat exchanger (LSHX)
 		Real64 MechSCLoad; // Mechanical subcooler load
 		Real64 SubcoolLoad; // energy transferred from warmer liquid to cool vapor
@@ -10495,8 +11267,8 @@ namespace RefrigeratedCase {
 		Real64 TLiqInActual; // Liquid T in, after condenser, before any mechanical subcooler
 		Real64 TVapInActual; // Vapor T in, after any superheat added by case control
 
-		LocalTimeStep = TimeStepZone;
-		if ( UseSysTimeStep ) LocalTimeStep = TimeStepSys;
+		CalculateSubcoolersLocalTimeStep = TimeStepZone;
+		if ( UseSysTimeStep ) CalculateSubcoolersLocalTimeStep = TimeStepSys;
 
 		//HCaseIn has to be recalculated as the starting point for the subcoolers here because
 		//  of the multiple number of iterations through this subroutine and because Tcondense is evolving.
@@ -10552,7 +11324,7 @@ namespace RefrigeratedCase {
 				SysProvideID = Subcooler( SubcoolerID ).MechSourceSysID;
 				System( SysProvideID ).MechSCLoad( SubcoolerID ) = MechSCLoad;
 				Subcooler( SubcoolerID ).MechSCTransLoad = MechSCLoad;
-				Subcooler( SubcoolerID ).MechSCTransEnergy = MechSCLoad * LocalTimeStep * SecInHour;
+				Subcooler( SubcoolerID ).MechSCTransEnergy = MechSCLoad * CalculateSubcoolersLocalTimeStep * SecInHour;
 				// Reset inlet temperature for any LSHX that follows this mech subcooler
 				TLiqInActual = ControlTLiqOut;
 				System( SysNum ).TCompIn = System( SysNum ).TEvapNeeded + CaseSuperheat;
@@ -10567,7 +11339,7 @@ namespace RefrigeratedCase {
 				System( SysNum ).TCompIn = TVapInActual + SubcoolerSupHeat;
 				System( SysNum ).HCaseIn -= SubcoolLoad / System( SysNum ).RefMassFlowtoLoads;
 				System( SysNum ).LSHXTrans = SubcoolLoad;
-				System( SysNum ).LSHXTransEnergy = SubcoolLoad * LocalTimeStep * SecInHour;
+				System( SysNum ).LSHXTransEnergy = SubcoolLoad * CalculateSubcoolersLocalTimeStep * SecInHour;
 			}}
 
 			System( SysNum ).TLiqInActual = TLiqInActual;
@@ -11137,102 +11909,31 @@ namespace RefrigeratedCase {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static std::string const RoutineName( "CalculateWalkIn" );
-		static int ZoneNodeNum( 0 ); // Zone node number
-		static int ZoneNum( 0 ); // Index to zone
-		static int ZoneID( 0 ); // Index to zone
-		static Real64 CapApplied( 0.0 ); // Walk In total capacity at specific operating conditions
-		static Real64 CircFanSchedule( 0.0 );
-		static Real64 Conv( 0.0 ); // conversion factor in gravity equation
-		static Real64 DefrostCap( 0.0 ); // Design defrost capacity of WalkIn (W)
-		static Real64 DefrostEnergy( 0.0 ); // (J)
-		static Real64 DefEnergyFraction( 0.0 ); // dimensionless
-		static Real64 AvailDefrostEnergy( 0.0 ); // available to melt ice with temp term control (J)
-		static Real64 DefrostLoad( 0.0 ); // (W)
-		static Real64 DefrostSchedule( 0.0 ); // WalkIn defrost schedule, between 0 and 1
-		static Real64 DefrostDripDownSchedule( 0.0 ); // WalkIn drip-down schedule (allows coil to drain after defrost)
-		static Real64 DefrostEnergyNeeded( 0.0 ); // Energy needed to melt all ice, used with temperature termination (J)
-		static Real64 DensityAirWalkIn( 0.0 ); // Density at Walk in temperature and 90% assumed RH
-		static Real64 DensityZoneAir( 0.0 ); // Density of the air in a particular zone (kg/m3)
-		static Real64 DensityFactorFm( 0.0 ); // called Fm in ASHRAE 2010 eq 13 page 24.5 for door infiltration
-		static Real64 DensitySqRtFactor( 0.0 ); // from ASHRAE 2010 eq 12 page 24.4 for door infiltration
-		static Real64 DelTemp( 0.0 ); // Difference between zone and walk in temperatures (C)
-		static Real64 DesignLighting( 0.0 ); // Total design display WalkIn lighting power (W)
-		static Real64 DesignRatedCap( 0.0 ); // Rated capacity of walk in cooler coil (W)
-		static Real64 DoorFlowFactor( 0.0 ); // Derate compared to fully developed flow through 100% open door
-		static Real64 DoorOpenFactor( 0.0 ); // Derate based upon fraction time door opened
-		static Real64 DoorProtectEff( 0.0 ); // Door protection effectiveness
-		static Real64 DrHeight( 0.0 ); // Door height (m)
-		static Real64 DrArea( 0.0 ); // Door area (m2)
-		static Real64 EnthalpyAirWalkIn( 0.0 ); // Enthalpy of air corresponding to walk in temperatuer and 90% assumed RH (J/kg)
-		static Real64 EnthalpyZoneAir( 0.0 ); // Enthalpy of the air in a particular zone (J/kg)
-		static Real64 FanLoad( 0.0 ); // Total fan energy rate (W)
-		static Real64 FloorLoad( 0.0 ); // Total floor energy rate (W)
-		static Real64 FrostChangekg( 0.0 ); // Amount of frost added or melted  (kg)
-		static Real64 FullFlowInfLoad( 0.0 ); // Total load (lat + sens) due to 100% open doors w/ fully developed flow (W)
-		static Real64 GlassDoorInfLoad( 0.0 ); // infiltration through glass reach-in doors in a particular zone (W)
-		static Real64 GlassDoorSensHeat( 0.0 ); // sensible heat gain through glass reach-in doors (UA*delta T) (W)
-		static Real64 GlassDoorArea( 0.0 ); // facing a particular zone (m2)
-		static Real64 Gravity( 0.0 );
-		static Real64 HeaterSchedule( 0.0 ); // zero to one
-		static Real64 HeaterLoad( 0.0 ); // Total heater (except defrost) energy rate (W)
-		static Real64 HumRatioAirWalkIn( 0.0 ); // corresponds to walk in temp and 90% assumed RH(kg water/kg dry air)
-		static Real64 HumRatioZoneAir( 0.0 ); // Humidity Ratio of the air in a particular zone (kg water/kg dry air)
-		static Real64 IceSensHeatNeeded( 0.0 ); // Energy to raise frost temperature to 0C, used w/ temp termination (J)
-		static Real64 LatentCapApplied( 0.0 ); // Walk In latent capacity at specific operating conditions
-		static Real64 LatentLoadTotal( 0.0 ); // total latent load on WalkIn over all zones (W)
-		static Real64 LightLoad( 0.0 ); // Total lighting energy rate (W)
-		static Real64 LightingSchedule( 0.0 ); // WalkIn lighting schedule
-		static Real64 LoadRequested( 0.0 ); // Load necessary to meet current and all stored energy needs (W)
-		static Real64 LoadTotal( 0.0 ); // total load in time step (W)
-		static Real64 MassDryAirRate( 0.0 ); // Mass dry air infiltrating into/out-of walkin through doors (kg/s)
-		static Real64 MaxCap( 0.0 ); // Design chilling capacity reduced according to drip-down schedule (W)
-		static Real64 SensibleCapApplied( 0.0 ); // Walk In sensible capacity at specific operating conditions
-		static Real64 SensibleLoadTotal( 0.0 ); // Total sensible load on WalkIn over all zones (W)
-		static Real64 StoredEnergyRate( 0.0 ); // Rate needed to serve all stored energy during single time step (W)
-		static Real64 StartIceTemp( 0.0 ); // Frost temperature at start of time step [C]
-		static Real64 StartFrostKg( 0.0 ); // frost load at start of time step (kg of ice)
-		static Real64 StockDoorInfLoad( 0.0 ); // infiltration through stock doors in a particular zone (W)
-		static Real64 StockDoorSensHeat( 0.0 ); // sensible heat gain through stock doors (UA*delta T) (W)
-		static Real64 StockDoorArea( 0.0 ); // (m2)
-		static Real64 StockingLoad( 0.0 ); // Total load due to stocking WalkIn product (W)
-		static Real64 TWalkIn( 0.0 ); // WalkIn operating temperature (C)
-		static Real64 UAOtherSurfaces( 0.0 ); // UA for non-door surfaces facing a certain zone (W/C)
-		static Real64 WalkInSchedule( 0.0 ); // Current value of WalkIn operating (availability) schedule
-		static Real64 WalkInSensLoad( 0.0 ); // Walk in cooler sensible load facing particular zone (W)
-		static Real64 WalkInLatLoad( 0.0 ); // Walk in cooler latent load facing particular zone (W)
-		static Real64 WaterRemovRate( 0.0 ); // Walk in cooler removes water at this rate in this zone (kg/s)
-		static Real64 ZoneDryBulb( 0.0 ); // Dry Bulb Temperature of adjacent zone
-		static Real64 ZoneSensLoad( 0.0 ); // Sensible WalkIn credit delivered to a particular zone (W)
-		static Real64 ZoneLatentLoad( 0.0 ); // Latent WalkIn credit delivered to zone (W)
-		static Real64 ZoneRHFrac( 0.0 ); // Zone relative humidity fraction (decimal)
-		static Real64 ZoneInfilLoad( 0.0 ); // Walk in cooler infiltration load (sens + latent) in certain zone (W)
-		static Real64 ZInfilSensLoad( 0.0 ); // Sensible load due to infiltration in one zone
-		static Real64 ZdoorSensLoad( 0.0 ); // Sensible load due to UA delta T through closed door in one zone
 
 		WalkInSchedule = GetCurrentScheduleValue( WalkIn( WalkInID ).SchedPtr );
 		if ( WalkInSchedule <= 0 ) return;
 		// GET OTHER SCHEDULES
-		DefrostSchedule = GetCurrentScheduleValue( WalkIn( WalkInID ).DefrostSchedPtr );
-		DefrostDripDownSchedule = GetCurrentScheduleValue( WalkIn( WalkInID ).DefrostDripDownSchedPtr );
+		CalculateWalkInDefrostSchedule = GetCurrentScheduleValue( WalkIn( WalkInID ).DefrostSchedPtr );
+		CalculateWalkInDefrostDripDownSchedule = GetCurrentScheduleValue( WalkIn( WalkInID ).DefrostDripDownSchedPtr );
 		//next statement In case user doesn't understand concept of drip down schedule
-		DefrostDripDownSchedule = max( DefrostDripDownSchedule, DefrostSchedule );
+		CalculateWalkInDefrostDripDownSchedule = max( CalculateWalkInDefrostDripDownSchedule, CalculateWalkInDefrostSchedule );
 
 		//next four values optional, so set to default before checking for schedule
-		StockingLoad = 0.0;
-		LightingSchedule = 1.0;
+		CalculateWalkInStockingLoad = 0.0;
+		CalculateWalkInLightingSchedule = 1.0;
 		HeaterSchedule = 1.0;
 		CircFanSchedule = 1.0;
-		if ( WalkIn( WalkInID ).StockingSchedPtr > 0 ) StockingLoad = GetCurrentScheduleValue( WalkIn( WalkInID ).StockingSchedPtr );
-		if ( WalkIn( WalkInID ).LightingSchedPtr > 0 ) LightingSchedule = GetCurrentScheduleValue( WalkIn( WalkInID ).LightingSchedPtr );
+		if ( WalkIn( WalkInID ).StockingSchedPtr > 0 ) CalculateWalkInStockingLoad = GetCurrentScheduleValue( WalkIn( WalkInID ).StockingSchedPtr );
+		if ( WalkIn( WalkInID ).LightingSchedPtr > 0 ) CalculateWalkInLightingSchedule = GetCurrentScheduleValue( WalkIn( WalkInID ).LightingSchedPtr );
 		if ( WalkIn( WalkInID ).HeaterSchedPtr > 0 ) HeaterSchedule = GetCurrentScheduleValue( WalkIn( WalkInID ).HeaterSchedPtr );
 		if ( WalkIn( WalkInID ).CircFanSchedPtr > 0 ) CircFanSchedule = GetCurrentScheduleValue( WalkIn( WalkInID ).CircFanSchedPtr );
 
 		//Set local subroutine variables for convenience
 		TWalkIn = WalkIn( WalkInID ).Temperature;
-		DesignRatedCap = WalkIn( WalkInID ).DesignRatedCap;
+		CalculateWalkInDesignRatedCap = WalkIn( WalkInID ).DesignRatedCap;
 		DefrostCap = WalkIn( WalkInID ).DefrostCapacity;
 		// %DefrostCapacity already set to zero for WalkInDefrostNone , WalkInDefrostOffCycle
-		DesignLighting = WalkIn( WalkInID ).DesignLighting;
+		CalculateWalkInDesignLighting = WalkIn( WalkInID ).DesignLighting;
 		EnthalpyAirWalkIn = PsyHFnTdbRhPb( TWalkIn, 0.9, OutBaroPress ); //assume 90%RH in cooler
 		HumRatioAirWalkIn = PsyWFnTdbH( TWalkIn, EnthalpyAirWalkIn );
 		DensityAirWalkIn = PsyRhoAirFnPbTdbW( OutBaroPress, TWalkIn, HumRatioAirWalkIn );
@@ -11241,7 +11942,7 @@ namespace RefrigeratedCase {
 
 		// CALCULATE ALL LOADS INFLUENCED BY ZONE TEMPERATURE AND RH
 		//set to zero before summing over zones
-		SensibleLoadTotal = 0.0;
+		CalculateWalkInSensibleLoadTotal = 0.0;
 		LatentLoadTotal = 0.0;
 		WalkIn( WalkInID ).SensZoneCreditRate = 0.0;
 		WalkIn( WalkInID ).SensZoneCreditCoolRate = 0.0;
@@ -11251,26 +11952,27 @@ namespace RefrigeratedCase {
 		WalkIn( WalkInID ).LatZoneCreditRate = 0.0;
 
 		//Start zone loop:
-		for ( ZoneID = 1; ZoneID <= WalkIn( WalkInID ).NumZones; ++ZoneID ) {
+		for ( CalculateWalkInZoneID = 1; CalculateWalkInZoneID <= WalkIn( WalkInID ).NumZones; ++CalculateWalkInZoneID ) {
 			ZoneSensLoad = 0.0;
 			GlassDoorSensHeat = 0.0;
 			StockDoorSensHeat = 0.0;
-			ZoneNum = WalkIn( WalkInID ).ZoneNum( ZoneID );
-			ZoneNodeNum = WalkIn( WalkInID ).ZoneNodeNum( ZoneID );
-			ZoneDryBulb = Node( ZoneNodeNum ).Temp;
+			CalculateWalkInZoneNum = WalkIn( WalkInID ).ZoneNum( CalculateWalkInZoneID );
+			CalculateWalkInZoneNodeNum = WalkIn( WalkInID ).ZoneNodeNum( CalculateWalkInZoneID );
+			ZoneDryBulb = Node( CalculateWalkInZoneNodeNum ).Temp;
 			DelTemp = ZoneDryBulb - TWalkIn;
-			StockDoorArea = WalkIn( WalkInID ).AreaStockDr( ZoneID );
-			GlassDoorArea = WalkIn( WalkInID ).AreaGlassDr( ZoneID );
-			UAOtherSurfaces = WalkIn( WalkInID ).SurfaceArea( ZoneID ) * WalkIn( WalkInID ).UValue( ZoneID );
+			StockDoorArea = WalkIn( WalkInID ).AreaStockDr( CalculateWalkInZoneID );
+			GlassDoorArea = WalkIn( WalkInID ).AreaGlassDr( CalculateWalkInZoneID );
+			UAOtherSurfaces = WalkIn( WalkInID ).SurfaceArea( CalculateWalkInZoneID ) * WalkIn( WalkInID ).UValue( CalculateWalkInZoneID );
 			DoorFlowFactor = 0.8; //see ASHRAE Refrigeration, p13.5, 2006
 			if ( DelTemp <= 11.0 ) DoorFlowFactor = 1.1; // from ASHRAE Refrigeration Loads
 
 			//Get infiltration loads if either type of door is present in this zone
 			if ( StockDoorArea > 0.0 || GlassDoorArea > 0.0 ) {
-				ZoneRHFrac = PsyRhFnTdbWPb( Node( ZoneNodeNum ).Temp, Node( ZoneNodeNum ).HumRat, OutBaroPress, RoutineName );
-				EnthalpyZoneAir = PsyHFnTdbRhPb( ZoneDryBulb, ZoneRHFrac, OutBaroPress, RoutineName );
-				HumRatioZoneAir = PsyWFnTdbH( ZoneDryBulb, EnthalpyZoneAir, RoutineName );
-				DensityZoneAir = PsyRhoAirFnPbTdbW( OutBaroPress, ZoneDryBulb, HumRatioZoneAir, RoutineName );
+				// zone air state evaluated once for all walk-ins in the zone in CalcRefrigZoneAirStates
+				ZoneRHFrac = RefrigZoneAir( CalculateWalkInZoneNum ).RHFrac;
+				EnthalpyZoneAir = RefrigZoneAir( CalculateWalkInZoneNum ).Enthalpy;
+				HumRatioZoneAir = RefrigZoneAir( CalculateWalkInZoneNum ).HumRat;
+				DensityZoneAir = RefrigZoneAir( CalculateWalkInZoneNum ).Density;
 				if ( DensityZoneAir < DensityAirWalkIn ) { //usual case when walk in is colder than zone
 					DensitySqRtFactor = std::sqrt( 1.0 - DensityZoneAir / DensityAirWalkIn );
 					DensityFactorFm = std::pow( 2.0 / ( 1.0 + std::pow( DensityAirWalkIn / DensityZoneAir, 0.333 ) ), 1.5 );
@@ -11286,7 +11988,7 @@ namespace RefrigeratedCase {
 				StockDoorSensHeat = 0.0;
 				GlassDoorSensHeat = 0.0;
 				if ( StockDoorArea > 0.0 ) {
-					{ auto const SELECT_CASE_var( WalkIn( WalkInID ).StockDoorProtectType( ZoneID ) );
+					{ auto const SELECT_CASE_var( WalkIn( WalkInID ).StockDoorProtectType( CalculateWalkInZoneID ) );
 					//Values from ASHRAE Ref p 13.6
 					if ( SELECT_CASE_var == WIStockDoorNone ) {
 						DoorProtectEff = 0.0;
@@ -11295,28 +11997,28 @@ namespace RefrigeratedCase {
 					} else if ( SELECT_CASE_var == WIStockDoorStripCurtain ) {
 						DoorProtectEff = 0.9;
 					}}
-					DrHeight = WalkIn( WalkInID ).HeightStockDr( ZoneID );
+					DrHeight = WalkIn( WalkInID ).HeightStockDr( CalculateWalkInZoneID );
 					DrArea = StockDoorArea;
 					// if exists, get Stock Door Zone schedule
 					DoorOpenFactor = DefaultWalkInDoorOpenFactor;
-					if ( WalkIn( WalkInID ).StockDoorOpenSchedPtr( ZoneID ) > 0 ) DoorOpenFactor = GetCurrentScheduleValue( WalkIn( WalkInID ).StockDoorOpenSchedPtr( ZoneID ) );
+					if ( WalkIn( WalkInID ).StockDoorOpenSchedPtr( CalculateWalkInZoneID ) > 0 ) DoorOpenFactor = GetCurrentScheduleValue( WalkIn( WalkInID ).StockDoorOpenSchedPtr( CalculateWalkInZoneID ) );
 
 					FullFlowInfLoad = 0.221 * DrArea * ( EnthalpyZoneAir - EnthalpyAirWalkIn ) * DensityAirWalkIn * DensitySqRtFactor * std::sqrt( Gravity * DrHeight ) * DensityFactorFm;
 					StockDoorInfLoad = FullFlowInfLoad * DoorOpenFactor * DoorFlowFactor * ( 1.0 - DoorProtectEff );
-					StockDoorSensHeat = DrArea * WalkIn( WalkInID ).UValueStockDr( ZoneID ) * DelTemp;
+					StockDoorSensHeat = DrArea * WalkIn( WalkInID ).UValueStockDr( CalculateWalkInZoneID ) * DelTemp;
 				} //have stock doors
 
 				if ( GlassDoorArea > 0.0 ) {
 					DoorProtectEff = 0.5; // Assume glass doors have air curtain
-					DrHeight = WalkIn( WalkInID ).HeightGlassDr( ZoneID );
+					DrHeight = WalkIn( WalkInID ).HeightGlassDr( CalculateWalkInZoneID );
 					DrArea = GlassDoorArea;
 					// get Glass Door Zone schedule
 					DoorOpenFactor = DefaultWalkInDoorOpenFactor; //default value
-					if ( WalkIn( WalkInID ).GlassDoorOpenSchedPtr( ZoneID ) > 0 ) DoorOpenFactor = GetCurrentScheduleValue( WalkIn( WalkInID ).GlassDoorOpenSchedPtr( ZoneID ) );
+					if ( WalkIn( WalkInID ).GlassDoorOpenSchedPtr( CalculateWalkInZoneID ) > 0 ) DoorOpenFactor = GetCurrentScheduleValue( WalkIn( WalkInID ).GlassDoorOpenSchedPtr( CalculateWalkInZoneID ) );
 
 					FullFlowInfLoad = 0.221 * DrArea * ( EnthalpyZoneAir - EnthalpyAirWalkIn ) * DensityAirWalkIn * DensitySqRtFactor * std::sqrt( Gravity * DrHeight ) * DensityFactorFm;
 					GlassDoorInfLoad = FullFlowInfLoad * DoorOpenFactor * DoorFlowFactor * ( 1.0 - DoorProtectEff );
-					GlassDoorSensHeat = DrArea * WalkIn( WalkInID ).UValueGlassDr( ZoneID ) * DelTemp;
+					GlassDoorSensHeat = DrArea * WalkIn( WalkInID ).UValueGlassDr( CalculateWalkInZoneID ) * DelTemp;
 				} //have Glass doors
 
 				//assume mass dry air infiltrating into walk-in == mass out into zone,
@@ -11329,16 +12031,16 @@ namespace RefrigeratedCase {
 				//  and latent credit are bothbased on reducing the infiltrating vapor to ice.  (This is
 				//  slightly greater than if the latent credit were based upon condensing out the water as liquid.)
 				//  then it would be: ZoneLatentLoad = -WaterRemovRate * WaterToVaporEnthalpy * (1.0d0-DefrostDripDownSchedule)
-				ZoneLatentLoad = -WaterRemovRate * IcetoVaporEnthalpy * ( 1.0 - DefrostDripDownSchedule );
+				ZoneLatentLoad = -WaterRemovRate * IcetoVaporEnthalpy * ( 1.0 - CalculateWalkInDefrostDripDownSchedule );
 				ZInfilSensLoad = ZoneInfilLoad - ( -WaterRemovRate * IcetoVaporEnthalpy ); //done to avoid moving latent to sens during dripdown
 				ZdoorSensLoad = -GlassDoorSensHeat - StockDoorSensHeat;
 				WalkInLatLoad = -ZoneLatentLoad;
 				if ( WalkIn( WalkInID ).TEvapDesign <= 0.0 ) { // water turned to ice on coil
-					WalkInLatLoad = WaterRemovRate * IcetoVaporEnthalpy * ( 1.0 - DefrostDripDownSchedule );
+					WalkInLatLoad = WaterRemovRate * IcetoVaporEnthalpy * ( 1.0 - CalculateWalkInDefrostDripDownSchedule );
 					// FROST:  keep track of frost build up on evaporator coil
 					//         avoid accumulation during warm-up to avoid reverse dd test problem
 					if ( ! WarmupFlag ) {
-						FrostChangekg = ( WaterRemovRate * TimeStepZoneSec ) * ( 1.0 - DefrostDripDownSchedule );
+						FrostChangekg = ( WaterRemovRate * TimeStepZoneSec ) * ( 1.0 - CalculateWalkInDefrostDripDownSchedule );
 						WalkIn( WalkInID ).KgFrost += FrostChangekg;
 					}
 				} //water to ice
@@ -11351,29 +12053,29 @@ namespace RefrigeratedCase {
 			//   Zone Equipment Manager. Sum walk-in credits to zone using existing 'casecredit' variable
 			//   No return air fractions are applied to walk-ins, and no latent in stocking -
 
-			RefrigCaseCredit( ZoneNum ).SenCaseCreditToZone += ZoneSensLoad;
-			RefrigCaseCredit( ZoneNum ).LatCaseCreditToZone += ZoneLatentLoad;
+			RefrigCaseCredit( CalculateWalkInZoneNum ).SenCaseCreditToZone += ZoneSensLoad;
+			RefrigCaseCredit( CalculateWalkInZoneNum ).LatCaseCreditToZone += ZoneLatentLoad;
 
 			// Set up report variables for each zone for this walk-in
 			// Sensible heat exchange can be positive or negative, split into separate output variables and always report positive value
-			WalkIn( WalkInID ).SensZoneCreditRate( ZoneID ) = ZoneSensLoad;
+			WalkIn( WalkInID ).SensZoneCreditRate( CalculateWalkInZoneID ) = ZoneSensLoad;
 			if ( ZoneSensLoad <= 0.0 ) {
-				WalkIn( WalkInID ).SensZoneCreditCoolRate( ZoneID ) = -ZoneSensLoad;
-				WalkIn( WalkInID ).SensZoneCreditCool( ZoneID ) = -ZoneSensLoad * TimeStepZoneSec;
-				WalkIn( WalkInID ).SensZoneCreditHeatRate( ZoneID ) = 0.0;
-				WalkIn( WalkInID ).SensZoneCreditHeat( ZoneID ) = 0.0;
+				WalkIn( WalkInID ).SensZoneCreditCoolRate( CalculateWalkInZoneID ) = -ZoneSensLoad;
+				WalkIn( WalkInID ).SensZoneCreditCool( CalculateWalkInZoneID ) = -ZoneSensLoad * TimeStepZoneSec;
+				WalkIn( WalkInID ).SensZoneCreditHeatRate( CalculateWalkInZoneID ) = 0.0;
+				WalkIn( WalkInID ).SensZoneCreditHeat( CalculateWalkInZoneID ) = 0.0;
 			} else {
-				WalkIn( WalkInID ).SensZoneCreditHeatRate( ZoneID ) = ZoneSensLoad;
-				WalkIn( WalkInID ).SensZoneCreditHeat( ZoneID ) = ZoneSensLoad * TimeStepZoneSec;
-				WalkIn( WalkInID ).SensZoneCreditCoolRate( ZoneID ) = 0.0;
-				WalkIn( WalkInID ).SensZoneCreditCool( ZoneID ) = 0.0;
+				WalkIn( WalkInID ).SensZoneCreditHeatRate( CalculateWalkInZoneID ) = ZoneSensLoad;
+				WalkIn( WalkInID ).SensZoneCreditHeat( CalculateWalkInZoneID ) = ZoneSensLoad * TimeStepZoneSec;
+				WalkIn( WalkInID ).SensZoneCreditCoolRate( CalculateWalkInZoneID ) = 0.0;
+				WalkIn( WalkInID ).SensZoneCreditCool( CalculateWalkInZoneID ) = 0.0;
 			}
 			// This rate should always be negative
-			WalkIn( WalkInID ).LatZoneCreditRate( ZoneID ) = ZoneLatentLoad;
-			WalkIn( WalkInID ).LatZoneCredit( ZoneID ) = ZoneLatentLoad * TimeStepZoneSec;
+			WalkIn( WalkInID ).LatZoneCreditRate( CalculateWalkInZoneID ) = ZoneLatentLoad;
+			WalkIn( WalkInID ).LatZoneCredit( CalculateWalkInZoneID ) = ZoneLatentLoad * TimeStepZoneSec;
 
 			//Running total over all zones, use later to dispatch capacity
-			SensibleLoadTotal += WalkInSensLoad;
+			CalculateWalkInSensibleLoadTotal += WalkInSensLoad;
 			LatentLoadTotal += WalkInLatLoad;
 
 		} //Do loop over zones for zone-condition-related sensible and latent loads
@@ -11381,19 +12083,19 @@ namespace RefrigeratedCase {
 		//cooling coil fan power default is 375W, = 1/2 HP (Tyler showed 1/3 to 3/4 hp)
 
 		// CALCULATE AUX LOADS DUE TO LIGHTS, FANS AND HEATERS
-		LightLoad = DesignLighting * LightingSchedule;
+		LightLoad = CalculateWalkInDesignLighting * CalculateWalkInLightingSchedule;
 		// turn coil fan off during defrost/drip - down period
-		FanLoad = WalkIn( WalkInID ).CircFanPower * CircFanSchedule + WalkIn( WalkInID ).CoilFanPower * ( 1.0 - DefrostDripDownSchedule );
+		FanLoad = WalkIn( WalkInID ).CircFanPower * CircFanSchedule + WalkIn( WalkInID ).CoilFanPower * ( 1.0 - CalculateWalkInDefrostDripDownSchedule );
 		HeaterLoad = WalkIn( WalkInID ).HeaterPower * HeaterSchedule;
 		// Calculate floor load - using 'GroundTemp' assigned in weather manager (can be entered by user if desired)
 		//    Default value is 18C.
 		FloorLoad = WalkIn( WalkInID ).FloorArea * WalkIn( WalkInID ).FloorUValue * ( GroundTemp - TWalkIn );
 
 		//DEFROST CALCULATIONS
-		if ( ( DefrostSchedule > 0.0 ) && ( WalkIn( WalkInID ).DefrostType != WalkInDefrostNone ) && ( WalkIn( WalkInID ).DefrostType != WalkInDefrostOffCycle ) ) {
-			DefrostLoad = DefrostCap * DefrostSchedule; //W
-			StartFrostKg = WalkIn( WalkInID ).KgFrost;
-			DefrostEnergy = DefrostLoad * TimeStepZoneSec; //Joules
+		if ( ( CalculateWalkInDefrostSchedule > 0.0 ) && ( WalkIn( WalkInID ).DefrostType != WalkInDefrostNone ) && ( WalkIn( WalkInID ).DefrostType != WalkInDefrostOffCycle ) ) {
+			DefrostLoad = DefrostCap * CalculateWalkInDefrostSchedule; //W
+			CalculateWalkInStartFrostKg = WalkIn( WalkInID ).KgFrost;
+			CalculateWalkInDefrostEnergy = DefrostLoad * TimeStepZoneSec; //Joules
 			if ( WalkIn( WalkInID ).DefrostControlType == DefrostContTempTerm ) {
 				//  Need to turn defrost system off early if controlled by temperature and all ice melted
 				//  For temperature termination, need to recognize not all defrost heat goes to melt ice
@@ -11402,47 +12104,47 @@ namespace RefrigeratedCase {
 				//  Assume full ice melting satisfies temperature control.
 				//      (defaults for DefEnergyFraction are :=0.7 for elec, =0.3 for fluids)
 				DefEnergyFraction = WalkIn( WalkInID ).DefEnergyFraction;
-				AvailDefrostEnergy = DefEnergyFraction * DefrostEnergy; //Joules avail to melt ice
+				AvailDefrostEnergy = DefEnergyFraction * CalculateWalkInDefrostEnergy; //Joules avail to melt ice
 				IceSensHeatNeeded = 0.0;
-				if ( StartFrostKg > 0.0 ) {
+				if ( CalculateWalkInStartFrostKg > 0.0 ) {
 					if ( WalkIn( WalkInID ).IceTemp < 0.0 ) {
 						StartIceTemp = WalkIn( WalkInID ).IceTemp;
-						IceSensHeatNeeded = StartFrostKg * SpecificHeatIce * ( 0.0 - StartIceTemp ); //Joules
+						IceSensHeatNeeded = CalculateWalkInStartFrostKg * SpecificHeatIce * ( 0.0 - StartIceTemp ); //Joules
 						if ( AvailDefrostEnergy >= IceSensHeatNeeded ) {
 							WalkIn( WalkInID ).IceTemp = 0.0;
 							AvailDefrostEnergy -= IceSensHeatNeeded; //Joules
 						} else { //DefrostEnergy < IceSensHeatNeeded
-							WalkIn( WalkInID ).IceTemp = StartIceTemp + AvailDefrostEnergy / ( SpecificHeatIce * StartFrostKg );
+							WalkIn( WalkInID ).IceTemp = StartIceTemp + AvailDefrostEnergy / ( SpecificHeatIce * CalculateWalkInStartFrostKg );
 							AvailDefrostEnergy = 0.0;
 						} // AvailDefrostEnergy >= IceSensHeatNeeded
 					} // IceTemp < 0,  need to raise temperature of ice
 					//Reduce defrost heat load on walkin by amount of ice melted during time step
-					FrostChangekg = min( AvailDefrostEnergy / IceMeltEnthalpy, StartFrostKg );
-					if ( FrostChangekg < StartFrostKg ) {
+					FrostChangekg = min( AvailDefrostEnergy / IceMeltEnthalpy, CalculateWalkInStartFrostKg );
+					if ( FrostChangekg < CalculateWalkInStartFrostKg ) {
 						DefrostLoad -= FrostChangekg * IceMeltEnthalpy / TimeStepZone / SecInHour;
-						if ( ! WarmupFlag ) WalkIn( WalkInID ).KgFrost = StartFrostKg - FrostChangekg;
+						if ( ! WarmupFlag ) WalkIn( WalkInID ).KgFrost = CalculateWalkInStartFrostKg - FrostChangekg;
 						//DefrostSchedule not changed
 					} else { // all frost melted during time step, so need to terminate defrost
 						//  see Aug 8 page 3 notes
 						WalkIn( WalkInID ).KgFrost = 0.0;
 						DefrostEnergyNeeded = ( IceSensHeatNeeded + ( FrostChangekg * IceMeltEnthalpy ) ) / DefEnergyFraction; //Joules - energy needed including E unavail to melt ice
-						DefrostSchedule = min( DefrostSchedule, ( DefrostEnergyNeeded / ( DefrostCap * TimeStepZoneSec ) ) );
+						CalculateWalkInDefrostSchedule = min( CalculateWalkInDefrostSchedule, ( DefrostEnergyNeeded / ( DefrostCap * TimeStepZoneSec ) ) );
 						// reduce load on walkin by energy put into ice melting
-						DefrostLoad = max( 0.0, ( DefrostSchedule * DefrostCap - ( IceSensHeatNeeded + ( FrostChangekg * IceMeltEnthalpy ) ) / TimeStepZoneSec ) );
+						DefrostLoad = max( 0.0, ( CalculateWalkInDefrostSchedule * DefrostCap - ( IceSensHeatNeeded + ( FrostChangekg * IceMeltEnthalpy ) ) / TimeStepZoneSec ) );
 						WalkIn( WalkInID ).IceTemp = WalkIn( WalkInID ).TEvapDesign;
 
 					} // frost melted during time step less than amount of ice at start
 				} else { // no frost present so terminate defrost and reset ice temperature for start of next defrost
 					DefrostLoad = 0.0;
-					DefrostSchedule = 0.0;
+					CalculateWalkInDefrostSchedule = 0.0;
 					WalkIn( WalkInID ).IceTemp = WalkIn( WalkInID ).TEvapDesign;
 				} // have frost present
 
 			} else { //Not temperature control type
-				FrostChangekg = min( DefrostEnergy / IceMeltEnthalpy, StartFrostKg );
+				FrostChangekg = min( CalculateWalkInDefrostEnergy / IceMeltEnthalpy, CalculateWalkInStartFrostKg );
 				//Reduce defrost heat load on walkin by amount of ice melted during time step
 				DefrostLoad -= FrostChangekg * IceMeltEnthalpy / TimeStepZone / SecInHour;
-				if ( ! WarmupFlag ) WalkIn( WalkInID ).KgFrost = StartFrostKg - FrostChangekg;
+				if ( ! WarmupFlag ) WalkIn( WalkInID ).KgFrost = CalculateWalkInStartFrostKg - FrostChangekg;
 				//DefrostSchedule not changed
 			} //Temperature termination control type
 
@@ -11451,22 +12153,22 @@ namespace RefrigeratedCase {
 		} //Defrost calculations
 
 		if ( WalkIn( WalkInID ).DefrostType == WalkInDefrostElec ) {
-			WalkIn( WalkInID ).ElecDefrostConsumption = DefrostCap * DefrostSchedule * TimeStepZoneSec;
-			WalkIn( WalkInID ).ElecDefrostPower = DefrostCap * DefrostSchedule;
+			WalkIn( WalkInID ).ElecDefrostConsumption = DefrostCap * CalculateWalkInDefrostSchedule * TimeStepZoneSec;
+			WalkIn( WalkInID ).ElecDefrostPower = DefrostCap * CalculateWalkInDefrostSchedule;
 		} else {
 			WalkIn( WalkInID ).ElecDefrostConsumption = 0.0;
 			WalkIn( WalkInID ).ElecDefrostPower = 0.0;
 		}
 
 		// If hot brine or hot gas is used for defrost, need to reduce condenser load by heat reclaimed for defrost
-		if ( WalkIn( WalkInID ).DefrostType == WalkInDefrostFluid ) WalkIn( WalkInID ).HotDefrostCondCredit = DefrostCap * DefrostSchedule;
+		if ( WalkIn( WalkInID ).DefrostType == WalkInDefrostFluid ) WalkIn( WalkInID ).HotDefrostCondCredit = DefrostCap * CalculateWalkInDefrostSchedule;
 
 		// loads reflects that walk ins continue to accumulate loads, even during defrost
 		// but cap is used to report portion met by active system while operating
 
 		//*** See if capacity meets load and manage accumulated stored energy ***********************************
-		SensibleLoadTotal += LightLoad + HeaterLoad + FanLoad + StockingLoad + DefrostLoad + FloorLoad;
-		LoadTotal = SensibleLoadTotal + LatentLoadTotal;
+		CalculateWalkInSensibleLoadTotal += LightLoad + HeaterLoad + FanLoad + CalculateWalkInStockingLoad + DefrostLoad + FloorLoad;
+		LoadTotal = CalculateWalkInSensibleLoadTotal + LatentLoadTotal;
 
 		//Account for difference between load and capacity. Assume rack or system able to provide
 		// rated capacity.  If it can't, that unmet energy will be stored and discharged at the system level.
@@ -11478,15 +12180,15 @@ namespace RefrigeratedCase {
 		//  temperature will increase by a small amount during defrost and the system will have to
 		//  run full out until the temperature is brought back down.
 
-		StoredEnergyRate = WalkIn( WalkInID ).StoredEnergy / TimeStepZone / SecInHour;
-		LoadRequested = LoadTotal + StoredEnergyRate;
+		CalculateWalkInStoredEnergyRate = WalkIn( WalkInID ).StoredEnergy / TimeStepZone / SecInHour;
+		CalculateWalkInLoadRequested = LoadTotal + CalculateWalkInStoredEnergyRate;
 
 		// prorate available cooling capacity for portion of time off due to drip down.
-		MaxCap = DesignRatedCap * ( 1.0 - DefrostDripDownSchedule );
-		if ( MaxCap >= LoadRequested ) {
+		MaxCap = CalculateWalkInDesignRatedCap * ( 1.0 - CalculateWalkInDefrostDripDownSchedule );
+		if ( MaxCap >= CalculateWalkInLoadRequested ) {
 			//Have more at least as much capacity available as needed, even counting stored energy
-			CapApplied = LoadRequested;
-			SensibleCapApplied = SensibleLoadTotal + StoredEnergyRate;
+			CapApplied = CalculateWalkInLoadRequested;
+			SensibleCapApplied = CalculateWalkInSensibleLoadTotal + CalculateWalkInStoredEnergyRate;
 			LatentCapApplied = LatentLoadTotal;
 			WalkIn( WalkInID ).StoredEnergy = 0.0;
 		} else {
@@ -11617,8 +12319,6 @@ namespace RefrigeratedCase {
 		Real64 Error; // Used in iterative soln for pumps needed to meet load (that has to include pump energy)
 		Real64 Eta; // Secondary loop heat exchanger eta, dimensionless
 		Real64 FlowVolNeeded; // Flow rate needed to meet load (m3/s)
-		static Real64 LoadRequested( 0.0 ); // Load necessary to meet current and all stored energy needs (W)
-		static Real64 LocalTimeStep( 0.0 ); // TimeStepZone for case/walkin systems, TimeStepSys for coil systems
 		Real64 MaxLoad; // Secondary loop capacity can be limited by heat exchanger or pumps (W)
 		Real64 MaxVolFlow; // Flow can be limited by either total pump capacity or heat exchanger design (m3/s)
 		Real64 PartLdFrac; // Used to ratio pump power
@@ -11642,8 +12342,8 @@ namespace RefrigeratedCase {
 		Real64 VolFlowRate; // Used in dispatching pumps to meet load (m3/s)
 		Real64 UnmetEnergy; // Cumulative, grows and shrinks with defrost cycles on loads served by loop (J)
 
-		LocalTimeStep = TimeStepZone;
-		if ( UseSysTimeStep ) LocalTimeStep = TimeStepSys;
+		CalculateSecondaryLocalTimeStep = TimeStepZone;
+		if ( UseSysTimeStep ) CalculateSecondaryLocalTimeStep = TimeStepSys;
 
 		NumPumps = Secondary( SecondaryNum ).NumPumps;
 		TEvap = Secondary( SecondaryNum ).TEvapDesign;
@@ -11820,10 +12520,10 @@ namespace RefrigeratedCase {
 		//  save the unmet/stored load to be met in succeeding time steps.
 		if ( Secondary( SecondaryNum ).NumCoils == 0 ) {
 			StoredEnergyRate = max( 0.0, ( UnmetEnergy / TimeStepZone / SecInHour ) );
-			LoadRequested = TotalLoad + StoredEnergyRate;
-			if ( MaxLoad > LoadRequested ) {
+			CalculateSecondaryLoadRequested = TotalLoad + StoredEnergyRate;
+			if ( MaxLoad > CalculateSecondaryLoadRequested ) {
 				// Have at least as much capacity avail as needed, even counting stored energy
-				TotalCoolingLoad = LoadRequested;
+				TotalCoolingLoad = CalculateSecondaryLoadRequested;
 				RefrigerationLoad += StoredEnergyRate;
 				UnmetEnergy = 0.0;
 			} else {
@@ -11851,17 +12551,17 @@ namespace RefrigeratedCase {
 			//Bug TotalCoolingLoad not set but used below
 		} // no air coils on secondary loop
 		Secondary( SecondaryNum ).PumpPowerTotal = TotalPumpPower;
-		Secondary( SecondaryNum ).PumpElecEnergyTotal = TotalPumpPower * LocalTimeStep * SecInHour;
+		Secondary( SecondaryNum ).PumpElecEnergyTotal = TotalPumpPower * CalculateSecondaryLocalTimeStep * SecInHour;
 		Secondary( SecondaryNum ).TotalRefrigLoad = RefrigerationLoad;
-		Secondary( SecondaryNum ).TotalRefrigEnergy = RefrigerationLoad * LocalTimeStep * SecInHour;
+		Secondary( SecondaryNum ).TotalRefrigEnergy = RefrigerationLoad * CalculateSecondaryLocalTimeStep * SecInHour;
 		Secondary( SecondaryNum ).TotalCoolingLoad = TotalCoolingLoad;
-		Secondary( SecondaryNum ).TotalCoolingEnergy = TotalCoolingLoad * LocalTimeStep * SecInHour;
+		Secondary( SecondaryNum ).TotalCoolingEnergy = TotalCoolingLoad * CalculateSecondaryLocalTimeStep * SecInHour;
 		Secondary( SecondaryNum ).FlowVolActual = VolFlowRate;
 		Secondary( SecondaryNum ).HotDefrostCondCredit = TotalHotDefrostCondCredit;
 		Secondary( SecondaryNum ).DistPipeHeatGain = DistPipeHeatGain;
-		Secondary( SecondaryNum ).DistPipeHeatGainEnergy = DistPipeHeatGain * LocalTimeStep * SecInHour;
+		Secondary( SecondaryNum ).DistPipeHeatGainEnergy = DistPipeHeatGain * CalculateSecondaryLocalTimeStep * SecInHour;
 		Secondary( SecondaryNum ).ReceiverHeatGain = ReceiverHeatGain;
-		Secondary( SecondaryNum ).ReceiverHeatGainEnergy = ReceiverHeatGain * LocalTimeStep * SecInHour;
+		Secondary( SecondaryNum ).ReceiverHeatGainEnergy = ReceiverHeatGain * CalculateSecondaryLocalTimeStep * SecInHour;
 
 	}
 
@@ -11900,55 +12600,54 @@ namespace RefrigeratedCase {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int ZoneNum( 0 ); // used calculating total refrigeration interactions for zone
 
 		if ( UseSysTimeStep ) { // air chillers
-			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
-				CoilSysCredit( ZoneNum ).ReportH20RemovedKgPerS_FromZoneRate = -CoilSysCredit( ZoneNum ).LatKgPerS_ToZoneRate;
-				CoilSysCredit( ZoneNum ).ReportLatCreditToZoneRate = -CoilSysCredit( ZoneNum ).LatCreditToZoneRate;
-				CoilSysCredit( ZoneNum ).ReportLatCreditToZoneEnergy = -CoilSysCredit( ZoneNum ).LatCreditToZoneEnergy;
+			for ( SumZoneImpactsZoneNum = 1; SumZoneImpactsZoneNum <= NumOfZones; ++SumZoneImpactsZoneNum ) {
+				CoilSysCredit( SumZoneImpactsZoneNum ).ReportH20RemovedKgPerS_FromZoneRate = -CoilSysCredit( SumZoneImpactsZoneNum ).LatKgPerS_ToZoneRate;
+				CoilSysCredit( SumZoneImpactsZoneNum ).ReportLatCreditToZoneRate = -CoilSysCredit( SumZoneImpactsZoneNum ).LatCreditToZoneRate;
+				CoilSysCredit( SumZoneImpactsZoneNum ).ReportLatCreditToZoneEnergy = -CoilSysCredit( SumZoneImpactsZoneNum ).LatCreditToZoneEnergy;
 				// Sensible rate can be positive or negative, split into separate output variables and
 				//   always report positive value
-				if ( CoilSysCredit( ZoneNum ).SenCreditToZoneRate <= 0.0 ) {
-					CoilSysCredit( ZoneNum ).ReportSenCoolingToZoneRate = -CoilSysCredit( ZoneNum ).SenCreditToZoneRate;
-					CoilSysCredit( ZoneNum ).ReportSenCoolingToZoneEnergy = -CoilSysCredit( ZoneNum ).SenCreditToZoneEnergy;
-					CoilSysCredit( ZoneNum ).ReportHeatingToZoneRate = 0.0;
-					CoilSysCredit( ZoneNum ).ReportHeatingToZoneEnergy = 0.0;
+				if ( CoilSysCredit( SumZoneImpactsZoneNum ).SenCreditToZoneRate <= 0.0 ) {
+					CoilSysCredit( SumZoneImpactsZoneNum ).ReportSenCoolingToZoneRate = -CoilSysCredit( SumZoneImpactsZoneNum ).SenCreditToZoneRate;
+					CoilSysCredit( SumZoneImpactsZoneNum ).ReportSenCoolingToZoneEnergy = -CoilSysCredit( SumZoneImpactsZoneNum ).SenCreditToZoneEnergy;
+					CoilSysCredit( SumZoneImpactsZoneNum ).ReportHeatingToZoneRate = 0.0;
+					CoilSysCredit( SumZoneImpactsZoneNum ).ReportHeatingToZoneEnergy = 0.0;
 				} else {
-					CoilSysCredit( ZoneNum ).ReportSenCoolingToZoneRate = 0.0;
-					CoilSysCredit( ZoneNum ).ReportSenCoolingToZoneEnergy = 0.0;
-					CoilSysCredit( ZoneNum ).ReportHeatingToZoneRate = CoilSysCredit( ZoneNum ).SenCreditToZoneRate;
-					CoilSysCredit( ZoneNum ).ReportHeatingToZoneEnergy = -CoilSysCredit( ZoneNum ).SenCreditToZoneEnergy;
+					CoilSysCredit( SumZoneImpactsZoneNum ).ReportSenCoolingToZoneRate = 0.0;
+					CoilSysCredit( SumZoneImpactsZoneNum ).ReportSenCoolingToZoneEnergy = 0.0;
+					CoilSysCredit( SumZoneImpactsZoneNum ).ReportHeatingToZoneRate = CoilSysCredit( SumZoneImpactsZoneNum ).SenCreditToZoneRate;
+					CoilSysCredit( SumZoneImpactsZoneNum ).ReportHeatingToZoneEnergy = -CoilSysCredit( SumZoneImpactsZoneNum ).SenCreditToZoneEnergy;
 				}
-				CoilSysCredit( ZoneNum ).ReportTotCoolingToZoneRate = CoilSysCredit( ZoneNum ).ReportLatCreditToZoneRate + CoilSysCredit( ZoneNum ).ReportSenCoolingToZoneRate;
-				CoilSysCredit( ZoneNum ).ReportTotCoolingToZoneEnergy = CoilSysCredit( ZoneNum ).ReportLatCreditToZoneEnergy + CoilSysCredit( ZoneNum ).ReportSenCoolingToZoneEnergy;
+				CoilSysCredit( SumZoneImpactsZoneNum ).ReportTotCoolingToZoneRate = CoilSysCredit( SumZoneImpactsZoneNum ).ReportLatCreditToZoneRate + CoilSysCredit( SumZoneImpactsZoneNum ).ReportSenCoolingToZoneRate;
+				CoilSysCredit( SumZoneImpactsZoneNum ).ReportTotCoolingToZoneEnergy = CoilSysCredit( SumZoneImpactsZoneNum ).ReportLatCreditToZoneEnergy + CoilSysCredit( SumZoneImpactsZoneNum ).ReportSenCoolingToZoneEnergy;
 			}
 		} //UseSysTimeStep signals run for air chillers
 
 		//Can arrive here when load call to refrigeration looks for cases/walkin systems and usetimestep is .FALSE.
 		if ( ( ! UseSysTimeStep ) && ( ( NumSimulationCases > 0 ) || ( NumSimulationWalkIns > 0 ) ) ) {
-			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
-				CaseWIZoneReport( ZoneNum ).SenCaseCreditToZoneEnergy = RefrigCaseCredit( ZoneNum ).SenCaseCreditToZone * TimeStepZoneSec;
+			for ( SumZoneImpactsZoneNum = 1; SumZoneImpactsZoneNum <= NumOfZones; ++SumZoneImpactsZoneNum ) {
+				CaseWIZoneReport( SumZoneImpactsZoneNum ).SenCaseCreditToZoneEnergy = RefrigCaseCredit( SumZoneImpactsZoneNum ).SenCaseCreditToZone * TimeStepZoneSec;
 				// Latent always negative
-				CaseWIZoneReport( ZoneNum ).LatCoolingToZoneRate = -RefrigCaseCredit( ZoneNum ).LatCaseCreditToZone;
-				CaseWIZoneReport( ZoneNum ).LatCoolingToZoneEnergy = CaseWIZoneReport( ZoneNum ).LatCoolingToZoneRate * TimeStepZoneSec;
+				CaseWIZoneReport( SumZoneImpactsZoneNum ).LatCoolingToZoneRate = -RefrigCaseCredit( SumZoneImpactsZoneNum ).LatCaseCreditToZone;
+				CaseWIZoneReport( SumZoneImpactsZoneNum ).LatCoolingToZoneEnergy = CaseWIZoneReport( SumZoneImpactsZoneNum ).LatCoolingToZoneRate * TimeStepZoneSec;
 				// Sensible rate can be positive or negative, split into separate output variables and
 				//   always report positive value
-				if ( RefrigCaseCredit( ZoneNum ).SenCaseCreditToZone <= 0.0 ) {
-					CaseWIZoneReport( ZoneNum ).SenCoolingToZoneRate = -RefrigCaseCredit( ZoneNum ).SenCaseCreditToZone;
-					CaseWIZoneReport( ZoneNum ).SenCoolingToZoneEnergy = -RefrigCaseCredit( ZoneNum ).SenCaseCreditToZone * TimeStepZoneSec;
-					CaseWIZoneReport( ZoneNum ).HeatingToZoneRate = 0.0;
-					CaseWIZoneReport( ZoneNum ).HeatingToZoneEnergy = 0.0;
+				if ( RefrigCaseCredit( SumZoneImpactsZoneNum ).SenCaseCreditToZone <= 0.0 ) {
+					CaseWIZoneReport( SumZoneImpactsZoneNum ).SenCoolingToZoneRate = -RefrigCaseCredit( SumZoneImpactsZoneNum ).SenCaseCreditToZone;
+					CaseWIZoneReport( SumZoneImpactsZoneNum ).SenCoolingToZoneEnergy = -RefrigCaseCredit( SumZoneImpactsZoneNum ).SenCaseCreditToZone * TimeStepZoneSec;
+					CaseWIZoneReport( SumZoneImpactsZoneNum ).HeatingToZoneRate = 0.0;
+					CaseWIZoneReport( SumZoneImpactsZoneNum ).HeatingToZoneEnergy = 0.0;
 				} else {
-					CaseWIZoneReport( ZoneNum ).SenCoolingToZoneRate = 0.0;
-					CaseWIZoneReport( ZoneNum ).SenCoolingToZoneEnergy = 0.0;
-					CaseWIZoneReport( ZoneNum ).HeatingToZoneRate = RefrigCaseCredit( ZoneNum ).SenCaseCreditToZone;
-					CaseWIZoneReport( ZoneNum ).HeatingToZoneEnergy = RefrigCaseCredit( ZoneNum ).SenCaseCreditToZone * TimeStepZoneSec;
-				}
-				CaseWIZoneReport( ZoneNum ).TotCoolingToZoneRate = CaseWIZoneReport( ZoneNum ).SenCoolingToZoneRate + CaseWIZoneReport( ZoneNum ).LatCoolingToZoneRate;
-				CaseWIZoneReport( ZoneNum ).TotCoolingToZoneEnergy = CaseWIZoneReport( ZoneNum ).SenCoolingToZoneEnergy + CaseWIZoneReport( ZoneNum ).LatCoolingToZoneEnergy;
-				CaseWIZoneReport( ZoneNum ).TotHtXferToZoneRate = RefrigCaseCredit( ZoneNum ).SenCaseCreditToZone + RefrigCaseCredit( ZoneNum ).LatCaseCreditToZone;
-				CaseWIZoneReport( ZoneNum ).TotHtXferToZoneEnergy = CaseWIZoneReport( ZoneNum ).TotHtXferToZoneRate * TimeStepZoneSec;
+					CaseWIZoneReport( SumZoneImpactsZoneNum ).SenCoolingToZoneRate = 0.0;
+					CaseWIZoneReport( SumZoneImpactsZoneNum ).SenCoolingToZoneEnergy = 0.0;
+					CaseWIZoneReport( SumZoneImpactsZoneNum ).HeatingToZoneRate = RefrigCaseCredit( SumZoneImpactsZoneNum ).SenCaseCreditToZone;
+					CaseWIZoneReport( SumZoneImpactsZoneNum ).HeatingToZoneEnergy = RefrigCaseCredit( SumZoneImpactsZoneNum ).SenCaseCreditToZone * TimeStepZoneSec;
+				}
+				CaseWIZoneReport( SumZoneImpactsZoneNum ).TotCoolingToZoneRate = CaseWIZoneReport( SumZoneImpactsZoneNum ).SenCoolingToZoneRate + CaseWIZoneReport( SumZoneImpactsZoneNum ).LatCoolingToZoneRate;
+				CaseWIZoneReport( SumZoneImpactsZoneNum ).TotCoolingToZoneEnergy = CaseWIZoneReport( SumZoneImpactsZoneNum ).SenCoolingToZoneEnergy + CaseWIZoneReport( SumZoneImpactsZoneNum ).LatCoolingToZoneEnergy;
+				CaseWIZoneReport( SumZoneImpactsZoneNum ).TotHtXferToZoneRate = RefrigCaseCredit( SumZoneImpactsZoneNum ).SenCaseCreditToZone + RefrigCaseCredit( SumZoneImpactsZoneNum ).LatCaseCreditToZone;
+				CaseWIZoneReport( SumZoneImpactsZoneNum ).TotHtXferToZoneEnergy = CaseWIZoneReport( SumZoneImpactsZoneNum ).TotHtXferToZoneRate * TimeStepZoneSec;
 			} // over zones for cases and walkins
 		}
 
@@ -12128,11 +12827,6 @@ namespace RefrigeratedCase {
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int CoilID( 0 ); // Index to coil
-		static int CoilIndex( 0 ); // rank of coils within system
-		static Real64 AirChillerSetSchedule( 0.0 ); // Schedule value for air chiller SET
-		static Real64 QZNReqSens( 0.0 ); // Amount of sensible heat needed by the zone, NEGATIVE when cooling needed [W]
-		static Real64 RemainQZNReqSens( 0.0 ); // Remaiing amount of sensible heat needed by the zone [W]
 
 		//Note, all coils in a coil set are in the same zone
 		// the coils may be served by different detailed systems
@@ -12143,11 +12837,11 @@ namespace RefrigeratedCase {
 		QZNReqSens = AirChillerSet( AirChillerSetID ).QZnReqSens;
 		RemainQZNReqSens = QZNReqSens;
 
-		for ( CoilIndex = 1; CoilIndex <= AirChillerSet( AirChillerSetID ).NumCoils; ++CoilIndex ) {
-			CoilID = AirChillerSet( AirChillerSetID ).CoilNum( CoilIndex );
+		for ( CalculateAirChillerSetsCoilIndex = 1; CalculateAirChillerSetsCoilIndex <= AirChillerSet( AirChillerSetID ).NumCoils; ++CalculateAirChillerSetsCoilIndex ) {
+			CalculateAirChillerSetsCoilID = AirChillerSet( AirChillerSetID ).CoilNum( CalculateAirChillerSetsCoilIndex );
 
-			CalculateCoil( CoilID, RemainQZNReqSens );
-			RemainQZNReqSens += WarehouseCoil( CoilID ).SensCreditRate;
+			CalculateCoil( CalculateAirChillerSetsCoilID, RemainQZNReqSens );
+			RemainQZNReqSens += WarehouseCoil( CalculateAirChillerSetsCoilID ).SensCreditRate;
 			//should be a negative minus a negative, so a smaller negative, that is, going toward zero, but senscoolingenergyrate expressed as positive
 			//Need to go over all the coils so that the defrosts occur on schedule, even when the chiller isn't called for at that particular time step
 			//IF(RemainQZNReqSens >=0.0d0)EXIT  !shouldn't be > 0 because limited by request in calculatecoil
@@ -12199,19 +12893,12 @@ namespace RefrigeratedCase {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int NumCoils( 0 ); // Number of coils on this system or secondary loop
-		static int CoilID( 0 ); // Index to coil
-		static int CoilIndex( 0 ); // rank of coils within system
-		static Real64 DeRateFactor( 0.0 ); // Ratio of energy available from system or secondary loop
-		static Real64 InitLatCreditEnergy( 0.0 ); // Latent credit energy before derate [W]
-		static Real64 InitKgFrost( 0.0 ); // Initial amount of frost on coils based on latent load before derate [kg]
-		static Real64 FrostReduction( 0.0 ); // Change in frost on coils based on derated latent load [kg]
 
 		{ auto const SELECT_CASE_var( SystemSourceType );
 		if ( SELECT_CASE_var == DetailedSystem ) {
-			NumCoils = System( SystemID ).NumCoils;
+			FinalRateCoilsNumCoils = System( SystemID ).NumCoils;
 		} else if ( SELECT_CASE_var == SecondarySystem ) {
-			NumCoils = Secondary( SystemID ).NumCoils;
+			FinalRateCoilsNumCoils = Secondary( SystemID ).NumCoils;
 		}} // DeRateCoils
 
 		if ( DeRate ) {
@@ -12219,9 +12906,9 @@ namespace RefrigeratedCase {
 
 			DeRateFactor = AvailableTotalLoad / InitialTotalLoad;
 			Real64 const time_step_sec( TimeStepSys * SecInHour );
-			for ( CoilIndex = 1; CoilIndex <= NumCoils; ++CoilIndex ) {
-				CoilID = System( SystemID ).CoilNum( CoilIndex );
-				auto & warehouse_coil( WarehouseCoil( CoilID ) );
+			for ( FinalRateCoilsCoilIndex = 1; FinalRateCoilsCoilIndex <= FinalRateCoilsNumCoils; ++FinalRateCoilsCoilIndex ) {
+				FinalRateCoilsCoilID = System( SystemID ).CoilNum( FinalRateCoilsCoilIndex );
+				auto & warehouse_coil( WarehouseCoil( FinalRateCoilsCoilID ) );
 
 				// need to adjust ice on coil due to reduction in latent load met by coil
 				InitLatCreditEnergy = warehouse_coil.LatCreditEnergy;
@@ -12315,7 +13002,6 @@ namespace RefrigeratedCase {
 		using General::CreateSysTimeIntervalString;
 
 		// Locals
-		static Real64 UnitLoadFactorSens( 0.0 ); // Rated capacity divided by rated DT1 (T air in - Tevap) (W/delta C)
 
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
@@ -12331,78 +13017,9 @@ namespace RefrigeratedCase {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		//INTEGER      :: Iter                    =0   ! counter for loop to solve for total coil capacity as a function of inlet air conditions
-		static int FanSpeedControlType( 0 ); // from input
-		static int SHRCorrectionCurvePtr( 0 ); // Points to curve entered by user to specify total/sensible capacity as a function of SHR
-		static int SHRCorrectionType( 0 ); // SHR60, QuadraticSHR, European, or TabularRH_DT1_TRoom
-		static int ZoneNodeNum( 0 ); // Zone node number
-		static Real64 AirVolRatio( 0.0 ); // used when operating at part load
-		static Real64 AirVolumeFlowMax( 0.0 ); // Coil air flow limited by drip down schedule (m3/s)
-		static Real64 AirVolumeFlowRated( 0.0 ); // Coil rated air flow (m3/s)
-		static Real64 AvailDefrostEnergy( 0.0 ); // available to melt ice with temp term control (J)
-		static Real64 CapFac( 0.0 ); // used to reduce fan power when don't need full coil capacity
-		static Real64 CoilCapTotal( 0.0 ); // Sensible plus latent load (W)
-		static Real64 CoilCapTotEstimate( 0.0 ); // Part of loop to solve for total coil capacity as a function of inlet air conditions (W)
-		static Real64 CoilInletCp( 0.0 ); // Coil air inlet specific heat (J/kg-deltaC)
-		static Real64 CoilInletDensity( 0.0 ); // Coil air inlet density (kg/m3)
-		static Real64 CoilInletDryAirCp( 0.0 ); // Dry air specific heat at coil inlet temperature (J/kg-C)
-		static Real64 CoilInletDryAirDensity( 0.0 ); // Dry Air density at coil inlet temperature (kg/m3)
-		static Real64 CoilInletHumRatio( 0.0 ); // Coil air inlet humidity ratio (kg water/kg air)
-		static Real64 CoilInletTemp( 0.0 ); // Inlet temperature of air to coil, not mixed zone temperature unless "middle" location selected (C)
-		static Real64 CoilInletEnthalpy( 0.0 ); // Coil inlet air enthalpy (J/kg)
-		static Real64 CoilInletRHFrac( 0.0 ); // Coil inlet air relative humidity expressed as a fraction (0 to 1)
-		static Real64 CoilSchedule( 0.0 ); // Current value of Coil operating (availability) schedule
-		static Real64 CoolingLoadNet( 0.0 ); // Cooling capacity of the coil minus fan, heater, and defrost loads (W)
-		static Real64 DefrostCap( 0.0 ); // Design defrost capacity of Coil (W)
-		static Real64 DefrostEnergy( 0.0 ); // (J)
-		static Real64 DefEnergyFraction( 0.0 ); // dimensionless
-		static Real64 DefrostLoad( 0.0 ); // Part of the defrost that is a heat load on the zone (W)
-		static Real64 DefrostSchedule( 0.0 ); // Coil defrost schedule, between 0 and 1
-		static Real64 DefrostDripDownSchedule( 0.0 ); // Coil drip-down schedule (allows coil to drain after defrost)
-		static Real64 DefrostEnergyNeeded( 0.0 ); // Energy needed to melt all ice, used with temperature termination (J)
-		static Real64 DefrostRateNeeded( 0.0 ); // Defrost load that actually goes to melting ice (W)
-		static Real64 DryAirMassFlowMax( 0.0 ); // Rated volume flow rate times dry air density adjusted for schedules (kg/s)
-		static Real64 DryAirMassFlowRated( 0.0 ); // Rated volume flow rate times dry air density
 		//REAL(r64)    :: Error                   =0.0d0 ! Used in iterative solution for sensible heat ratio
-		static Real64 ExitHumRatio( 0.0 ); // kg water/kg air
-		static Real64 ExitTemperature( 0.0 ); // Air temperature leaving the coil (C)
-		static Real64 ExitTemperatureEstimate( 0.0 ); // Estimated Air temperature leaving the coil (C)
-		static Real64 ExitEnthalpy( 0.0 ); // Air enthalpy leaving the coil (J/kg)
-		static Real64 ExitEnthalpyEstimate( 0.0 ); // Estimated Air enthalpy leaving the coil (J/kg)
-		static Real64 FanMinAirFlowRatio( 0.0 ); // From input
-		static Real64 FanPowerActual( 0.0 ); // (W)
-		static Real64 FanPowerRated( 0.0 ); // (W)
-		static Real64 FanPowerMax( 0.0 ); // Total fan energy rate, limited by dripdown period (W)
-		static Real64 FanPowerRatio( 0.0 ); // Used for variable speed fans, dimensionless
-		static Real64 FrostChangekg( 0.0 ); // Amount of frost added or melted  (kg)
-		static Real64 HeaterSchedule( 0.0 ); // zero to one
-		static Real64 HeaterLoad( 0.0 ); // Total heater (except defrost) energy rate (W)
-		static Real64 IceSensHeatNeeded( 0.0 ); // Energy to raise frost temperature to 0C, used w/ temp termination (J)
-		static Real64 LatLoadServed( 0.0 ); // Energy rate used to remove water from zone air (W)
-		static Real64 MaxTemperatureDif( 0.0 ); // Used to limit capacity during initial pulldown (deltaC)
-		static Real64 SensibleCapacityMax( 0.0 ); // Sensible capacity adjusted for any time in dripdown state (W)
 		//REAL(r64)    :: SensibleLoad            =0.0d0 ! Sensible load provided by coil (W)
-		static Real64 SensLoadRequested( 0.0 ); // Sensible load requested by zone balance (W)
-		static Real64 SensLoadFromZone( 0.0 ); // Net sensible load removed from zone after accounting for heaters, fans, defrost [W]
-		static Real64 SensLoadRequestedGross( 0.0 ); // Gross sensible load removed by coil
-		static Real64 SensLoadGross( 0.0 ); // Sensible load met by coil (W)
-		static Real64 SHR( 0.0 ); // Sensible heat ratio, sensible load/total load
-		static Real64 SHRCorrection( 0.0 ); // Actual total/sensible load, NOT = Inverse SHR (unless coil efficiency = 1.0),
 		// but function of SHR, which is why iteration needed
-		static Real64 SHRCorrection60( 0.0 ); // Total capacity as a fraction of sensible capacity at a SHR of 0.6, entered by user
-		static Real64 Slope( 0.0 ); // Part of linear SHR60 correction factor, dimensionless
-		static Real64 StartIceTemp( 0.0 ); // Frost temperature at start of time step [C]
-		static Real64 StartFrostKg( 0.0 ); // frost load at start of time step (kg of ice)
-		static Real64 TemperatureDif( 0.0 ); // difference between inlet air and evaporating temperature (deltaC)
-		static Real64 TEvap( 0.0 ); // Evaporating temperature in the coil (C)
-		static Real64 WaterRemovRate( 0.0 ); // Walk in cooler removes water at this rate in this zone (kg/s)
-		static Real64 Yint( 0.0 ); // Part of linear SHR60 correction factor, dimensionless
-		static Real64 ZoneDryAirDensity( 0.0 ); // Dry air density at mixed zone conditions
-		static Real64 ZoneMixedAirCp( 0.0 ); // J/kg-deltaC
-		static Real64 ZoneMixedAirDensity( 0.0 ); // kg/m3
-		static Real64 ZoneMixedAirDryBulb( 0.0 ); // (C)
-		static Real64 ZoneMixedAirRHFrac( 0.0 ); // relative humidity of mixed air in the zone expressed as a fraction from 0 to 1
-		static Real64 ZoneMixedAirEnthalpy( 0.0 ); // J/kg
-		static Real64 ZoneMixedAirHumRatio( 0.0 ); // kg water/kg air in the zone mixed air
 
 		// GET SCHEDULES
 		auto & warehouse_coil( WarehouseCoil( CoilID ) );
@@ -12410,13 +13027,13 @@ namespace RefrigeratedCase {
 
 		if ( CoilSchedule <= 0.0 ) return;
 
-		DefrostSchedule = GetCurrentScheduleValue( warehouse_coil.DefrostSchedPtr );
-		DefrostDripDownSchedule = GetCurrentScheduleValue( warehouse_coil.DefrostDripDownSchedPtr );
+		CalculateCoilDefrostSchedule = GetCurrentScheduleValue( warehouse_coil.DefrostSchedPtr );
+		CalculateCoilDefrostDripDownSchedule = GetCurrentScheduleValue( warehouse_coil.DefrostDripDownSchedPtr );
 		//next statement In case user doesn't understand concept of drip down schedule
-		DefrostDripDownSchedule = max( DefrostDripDownSchedule, DefrostSchedule );
+		CalculateCoilDefrostDripDownSchedule = max( CalculateCoilDefrostDripDownSchedule, CalculateCoilDefrostSchedule );
 		//next value optional, so set to default before checking for schedule
-		HeaterSchedule = 1.0;
-		if ( warehouse_coil.HeaterSchedPtr > 0 ) HeaterSchedule = GetCurrentScheduleValue( warehouse_coil.HeaterSchedPtr );
+		CalculateCoilHeaterSchedule = 1.0;
+		if ( warehouse_coil.HeaterSchedPtr > 0 ) CalculateCoilHeaterSchedule = GetCurrentScheduleValue( warehouse_coil.HeaterSchedPtr );
 
 		AirVolRatio = 0.0;
 		AirVolumeFlowMax = 0.0;
@@ -12424,30 +13041,30 @@ namespace RefrigeratedCase {
 		CoilCapTotal = 0.0;
 		CoilCapTotEstimate = 0.0;
 		CoolingLoadNet = 0.0;
-		DefrostLoad = 0.0;
+		CalculateCoilDefrostLoad = 0.0;
 		DryAirMassFlowMax = 0.0;
 		ExitEnthalpyEstimate = 0.0;
 		ExitEnthalpy = 0.0;
 		ExitTemperature = 0.0;
 		ExitHumRatio = 0.0;
 		FanPowerActual = 0.0;
-		HeaterLoad = 0.0;
+		CalculateCoilHeaterLoad = 0.0;
 		LatLoadServed = 0.0;
 		FanPowerRatio = 0.0;
-		FrostChangekg = 0.0;
+		CalculateCoilFrostChangekg = 0.0;
 		SensLoadFromZone = 0.0;
 		SensLoadGross = 0.0;
 		SensibleCapacityMax = 0.0;
 		SHR = 0.0;
-		WaterRemovRate = 0.0;
+		CalculateCoilWaterRemovRate = 0.0;
 
 		//Set local subroutine variables for convenience
-		ZoneNodeNum = warehouse_coil.ZoneNodeNum;
+		CalculateCoilZoneNodeNum = warehouse_coil.ZoneNodeNum;
 		AirVolumeFlowRated = warehouse_coil.RatedAirVolumeFlow;
 		FanPowerRated = warehouse_coil.RatedFanPower;
-		HeaterLoad = warehouse_coil.HeaterPower * HeaterSchedule;
-		UnitLoadFactorSens = warehouse_coil.UnitLoadFactorSens;
-		DefrostCap = warehouse_coil.DefrostCapacity;
+		CalculateCoilHeaterLoad = warehouse_coil.HeaterPower * CalculateCoilHeaterSchedule;
+		CalculateCoilUnitLoadFactorSens = warehouse_coil.UnitLoadFactorSens;
+		CalculateCoilDefrostCap = warehouse_coil.DefrostCapacity;
 		TEvap = warehouse_coil.TEvapDesign;
 		SHRCorrectionType = warehouse_coil.SHRCorrectionType;
 		SHRCorrection60 = warehouse_coil.SHRCorrection60;
@@ -12456,7 +13073,7 @@ namespace RefrigeratedCase {
 		FanSpeedControlType = warehouse_coil.FanType;
 		MaxTemperatureDif = warehouse_coil.MaxTemperatureDif;
 
-		if ( DefrostDripDownSchedule == 1.0 ) {
+		if ( CalculateCoilDefrostDripDownSchedule == 1.0 ) {
 			AirVolumeFlowMax = 0.0;
 			DryAirMassFlowMax = 0.0;
 		} else { // DefrostDripDownSchedule < 1.0d0, cooling will occur at least part of the time step
@@ -12465,9 +13082,9 @@ namespace RefrigeratedCase {
 				AirVolumeFlowMax = 0.0;
 				DryAirMassFlowMax = 0.0;
 			} else {
-				SensLoadRequestedGross = SensLoadRequested + HeaterLoad + FanPowerRated;
-				ZoneMixedAirDryBulb = Node( ZoneNodeNum ).Temp;
-				ZoneMixedAirHumRatio = Node( ZoneNodeNum ).HumRat;
+				SensLoadRequestedGross = SensLoadRequested + CalculateCoilHeaterLoad + FanPowerRated;
+				ZoneMixedAirDryBulb = Node( CalculateCoilZoneNodeNum ).Temp;
+				ZoneMixedAirHumRatio = Node( CalculateCoilZoneNodeNum ).HumRat;
 				ZoneMixedAirRHFrac = PsyRhFnTdbWPb( ZoneMixedAirDryBulb, ZoneMixedAirHumRatio, OutBaroPress, TrackMessage );
 				ZoneMixedAirEnthalpy = PsyHFnTdbRhPb( ZoneMixedAirDryBulb, ZoneMixedAirRHFrac, OutBaroPress, TrackMessage );
 				ZoneMixedAirDensity = PsyRhoAirFnPbTdbW( OutBaroPress, ZoneMixedAirDryBulb, ZoneMixedAirHumRatio, TrackMessage );
@@ -12494,8 +13111,8 @@ namespace RefrigeratedCase {
 						CoilInletDryAirCp = PsyCpAirFnWTdb( 0.0, CoilInletTemp );
 						break;
 				}
-				AirVolumeFlowMax = AirVolumeFlowRated * ( 1.0 - DefrostDripDownSchedule ) * CoilSchedule;
-				DryAirMassFlowMax = DryAirMassFlowRated * ( 1.0 - DefrostDripDownSchedule ) * CoilSchedule;
+				AirVolumeFlowMax = AirVolumeFlowRated * ( 1.0 - CalculateCoilDefrostDripDownSchedule ) * CoilSchedule;
+				DryAirMassFlowMax = DryAirMassFlowRated * ( 1.0 - CalculateCoilDefrostDripDownSchedule ) * CoilSchedule;
 
 			} //Sens load requested is non-zero
 		} // DefrostDripDownSchedule == 1.0d0
@@ -12510,10 +13127,10 @@ namespace RefrigeratedCase {
 				//    In the table, X1== inlet air dry bulb temperature
 				//                  X2== Difference between inlet T and evap T
 				//                  X3== RH expressed as decimal
-				CoilCapTotEstimate = CurveValue( SHRCorrectionCurvePtr, CoilInletTemp, TemperatureDif, CoilInletRHFrac ) * warehouse_coil.RatedCapTotal * ( 1.0 - DefrostDripDownSchedule ) * CoilSchedule;
+				CoilCapTotEstimate = CurveValue( SHRCorrectionCurvePtr, CoilInletTemp, TemperatureDif, CoilInletRHFrac ) * warehouse_coil.RatedCapTotal * ( 1.0 - CalculateCoilDefrostDripDownSchedule ) * CoilSchedule;
 
 			} else { //work with unit load factor (sensible only), function of DT1 (Tair in drybulb-Tevap)
-				SensibleCapacityMax = warehouse_coil.UnitLoadFactorSens * TemperatureDif * ( 1.0 - DefrostDripDownSchedule ) * CoilSchedule;
+				SensibleCapacityMax = warehouse_coil.UnitLoadFactorSens * TemperatureDif * ( 1.0 - CalculateCoilDefrostDripDownSchedule ) * CoilSchedule;
 
 				if ( SensibleCapacityMax > 0.0 ) {
 					ExitTemperatureEstimate = CoilInletTemp - ( SensibleCapacityMax / ( DryAirMassFlowMax * CoilInletDryAirCp ) );
@@ -12580,24 +13197,24 @@ namespace RefrigeratedCase {
 				ExitTemperature = PsyTsatFnHPb( ExitEnthalpy, OutBaroPress, TrackMessage ); //RH =1.0 at Tsat
 				ExitHumRatio = PsyWFnTdbH( ExitTemperature, ExitEnthalpy, TrackMessage );
 				if ( ExitHumRatio > CoilInletHumRatio ) ExitHumRatio = CoilInletHumRatio;
-				WaterRemovRate = DryAirMassFlowMax * ( CoilInletHumRatio - ExitHumRatio );
-				LatLoadServed = WaterRemovRate * IcetoVaporEnthalpy;
+				CalculateCoilWaterRemovRate = DryAirMassFlowMax * ( CoilInletHumRatio - ExitHumRatio );
+				LatLoadServed = CalculateCoilWaterRemovRate * IcetoVaporEnthalpy;
 				SensLoadGross = CoilCapTotEstimate - LatLoadServed;
 				FanPowerActual = FanPowerRated;
 				if ( SensLoadGross < 0.0 ) {
 					// Could rarely happen during initial cooldown of a warm environment
 					SensLoadGross = 0.0;
 					LatLoadServed = CoilCapTotEstimate;
-					WaterRemovRate = LatLoadServed / IcetoVaporEnthalpy;
+					CalculateCoilWaterRemovRate = LatLoadServed / IcetoVaporEnthalpy;
 				} //SensLoadGross < 0
 			} else { // NOT (SensibleCapacityMax > 0.0d0)
-				WaterRemovRate = 0.0;
+				CalculateCoilWaterRemovRate = 0.0;
 				LatLoadServed = 0.0;
 				SensLoadGross = 0.0;
 				FanPowerActual = 0.0;
 			} //(CoilCapTotEstimate > 0.0d0)
 
-			FanPowerMax = FanPowerRated * ( 1.0 - DefrostDripDownSchedule );
+			FanPowerMax = FanPowerRated * ( 1.0 - CalculateCoilDefrostDripDownSchedule );
 			if ( SensLoadGross > SensLoadRequestedGross ) { //part load operation
 				//don't need full chiller power, reduce fan speed to reduce air flow
 				// move fan to part power if need to
@@ -12626,8 +13243,8 @@ namespace RefrigeratedCase {
 
 				//reduce latent capacity according to value called for for sensible  - recalc latent.
 				//   recalc coilcaptotal
-				WaterRemovRate *= AirVolRatio;
-				LatLoadServed = WaterRemovRate * IcetoVaporEnthalpy;
+				CalculateCoilWaterRemovRate *= AirVolRatio;
+				LatLoadServed = CalculateCoilWaterRemovRate * IcetoVaporEnthalpy;
 				SensLoadGross = SensLoadRequestedGross;
 			} else { // at full load
 				FanPowerActual = FanPowerMax;
@@ -12644,15 +13261,15 @@ namespace RefrigeratedCase {
 			// FROST:  keep track of frost build up on evaporator coil
 			//         avoid accumulation during warm-up to avoid reverse dd test problem
 			if ( ! WarmupFlag ) {
-				FrostChangekg = ( WaterRemovRate * TimeStepSys * SecInHour );
-				warehouse_coil.KgFrost += FrostChangekg;
+				CalculateCoilFrostChangekg = ( CalculateCoilWaterRemovRate * TimeStepSys * SecInHour );
+				warehouse_coil.KgFrost += CalculateCoilFrostChangekg;
 			}
 
 		} else { // NOT (AirVolumeFlowMax > 0.0d0)
 			CoilCapTotEstimate = 0.0;
-			WaterRemovRate = 0.0;
+			CalculateCoilWaterRemovRate = 0.0;
 			LatLoadServed = 0.0;
-			FrostChangekg = 0.0;
+			CalculateCoilFrostChangekg = 0.0;
 			SensLoadGross = 0.0;
 			FanPowerActual = 0.0;
 		} //(AirVolumeFlowMax > 0.0d0)
@@ -12662,10 +13279,10 @@ namespace RefrigeratedCase {
 		//                     in starting IF are there to mimic temperature override
 		//                     on the coils that stops defrost if the coils get above
 		//                     a certain temperature (such as when there's no load and no ice)
-		if ( ( DefrostSchedule > 0.0 ) && ( warehouse_coil.DefrostType != DefrostNone ) && ( warehouse_coil.DefrostType != DefrostOffCycle ) ) {
-			DefrostLoad = DefrostCap * DefrostSchedule; //W
-			DefrostEnergy = DefrostLoad * TimeStepSys * SecInHour; //Joules
-			StartFrostKg = warehouse_coil.KgFrost;
+		if ( ( CalculateCoilDefrostSchedule > 0.0 ) && ( warehouse_coil.DefrostType != DefrostNone ) && ( warehouse_coil.DefrostType != DefrostOffCycle ) ) {
+			CalculateCoilDefrostLoad = CalculateCoilDefrostCap * CalculateCoilDefrostSchedule; //W
+			CalculateCoilDefrostEnergy = CalculateCoilDefrostLoad * TimeStepSys * SecInHour; //Joules
+			CalculateCoilStartFrostKg = warehouse_coil.KgFrost;
 
 			if ( warehouse_coil.DefrostControlType == DefrostContTempTerm ) {
 				//  Need to turn defrost system off early if controlled by temperature and all ice melted
@@ -12674,42 +13291,42 @@ namespace RefrigeratedCase {
 				//  others and xfer heat to environment)
 				//  Assume full ice melting satisfies temperature control.
 				//      (defaults for DefEnergyFraction are :=0.7 for elec, =0.3 for fluids)
-				DefEnergyFraction = warehouse_coil.DefEnergyFraction;
-				AvailDefrostEnergy = DefEnergyFraction * DefrostEnergy; //Joules avail to melt ice
-				IceSensHeatNeeded = 0.0;
-				if ( StartFrostKg > 0.0 ) {
+				CalculateCoilDefEnergyFraction = warehouse_coil.DefEnergyFraction;
+				CalculateCoilAvailDefrostEnergy = CalculateCoilDefEnergyFraction * CalculateCoilDefrostEnergy; //Joules avail to melt ice
+				CalculateCoilIceSensHeatNeeded = 0.0;
+				if ( CalculateCoilStartFrostKg > 0.0 ) {
 					if ( warehouse_coil.IceTemp < 0.0 ) {
-						StartIceTemp = warehouse_coil.IceTemp;
-						IceSensHeatNeeded = StartFrostKg * SpecificHeatIce * ( 0.0 - StartIceTemp ); //Joules
-						if ( AvailDefrostEnergy >= IceSensHeatNeeded ) {
+						CalculateCoilStartIceTemp = warehouse_coil.IceTemp;
+						CalculateCoilIceSensHeatNeeded = CalculateCoilStartFrostKg * SpecificHeatIce * ( 0.0 - CalculateCoilStartIceTemp ); //Joules
+						if ( CalculateCoilAvailDefrostEnergy >= CalculateCoilIceSensHeatNeeded ) {
 							warehouse_coil.IceTemp = 0.0;
-							AvailDefrostEnergy -= IceSensHeatNeeded; //Joules
+							CalculateCoilAvailDefrostEnergy -= CalculateCoilIceSensHeatNeeded; //Joules
 						} else { //DefrostEnergy < IceSensHeatNeeded
-							warehouse_coil.IceTemp = StartIceTemp + AvailDefrostEnergy / ( SpecificHeatIce * StartFrostKg );
-							AvailDefrostEnergy = 0.0;
+							warehouse_coil.IceTemp = CalculateCoilStartIceTemp + CalculateCoilAvailDefrostEnergy / ( SpecificHeatIce * CalculateCoilStartFrostKg );
+							CalculateCoilAvailDefrostEnergy = 0.0;
 						} // AvailDefrostEnergy >= IceSensHeatNeeded
 					} // IceTemp < 0,  need to raise temperature of ice
 					//Reduce defrost heat load on walkin by amount of ice melted during time step
-					FrostChangekg = min( AvailDefrostEnergy / IceMeltEnthalpy, StartFrostKg );
-					if ( FrostChangekg < StartFrostKg ) {
-						DefrostLoad -= FrostChangekg * IceMeltEnthalpy / TimeStepSys / SecInHour;
-						if ( ! WarmupFlag ) warehouse_coil.KgFrost = StartFrostKg - FrostChangekg;
+					CalculateCoilFrostChangekg = min( CalculateCoilAvailDefrostEnergy / IceMeltEnthalpy, CalculateCoilStartFrostKg );
+					if ( CalculateCoilFrostChangekg < CalculateCoilStartFrostKg ) {
+						CalculateCoilDefrostLoad -= CalculateCoilFrostChangekg * IceMeltEnthalpy / TimeStepSys / SecInHour;
+						if ( ! WarmupFlag ) warehouse_coil.KgFrost = CalculateCoilStartFrostKg - CalculateCoilFrostChangekg;
 						//DefrostSchedule not changed because ice not all melted, temp term not triggered
 					} else { // all frost melted during time step, so need to terminate defrost
 						//  see Aug 8 2010 page 3 notes
 						warehouse_coil.KgFrost = 0.0;
-						DefrostEnergyNeeded = ( IceSensHeatNeeded + ( FrostChangekg * IceMeltEnthalpy ) ) / DefEnergyFraction; //Joules - energy needed including E unavail to melt ice
-						DefrostSchedule = min( DefrostSchedule, ( DefrostEnergyNeeded / ( DefrostCap * TimeStepSys * SecInHour ) ) );
+						CalculateCoilDefrostEnergyNeeded = ( CalculateCoilIceSensHeatNeeded + ( CalculateCoilFrostChangekg * IceMeltEnthalpy ) ) / CalculateCoilDefEnergyFraction; //Joules - energy needed including E unavail to melt ice
+						CalculateCoilDefrostSchedule = min( CalculateCoilDefrostSchedule, ( CalculateCoilDefrostEnergyNeeded / ( CalculateCoilDefrostCap * TimeStepSys * SecInHour ) ) );
 						// reduce heat load on warehouse by energy put into ice melting
-						DefrostRateNeeded = ( IceSensHeatNeeded + ( FrostChangekg * IceMeltEnthalpy ) ) / ( TimeStepSys * SecInHour );
-						DefrostLoad = max( 0.0, ( DefrostSchedule * DefrostCap - DefrostRateNeeded ) );
+						DefrostRateNeeded = ( CalculateCoilIceSensHeatNeeded + ( CalculateCoilFrostChangekg * IceMeltEnthalpy ) ) / ( TimeStepSys * SecInHour );
+						CalculateCoilDefrostLoad = max( 0.0, ( CalculateCoilDefrostSchedule * CalculateCoilDefrostCap - DefrostRateNeeded ) );
 						warehouse_coil.IceTemp = warehouse_coil.TEvapDesign;
 					} // frost melted during time step less than amount of ice at start
 				} else {
 					// no frost present so terminate defrost and reset ice temperature for start of next defrost
 					// However, dripdown schedule still prevents/limits cooling capacity during time step
-					DefrostLoad = 0.0;
-					DefrostSchedule = 0.0;
+					CalculateCoilDefrostLoad = 0.0;
+					CalculateCoilDefrostSchedule = 0.0;
 					warehouse_coil.IceTemp = warehouse_coil.TEvapDesign;
 				} // have frost present
 
@@ -12717,37 +13334,37 @@ namespace RefrigeratedCase {
 				//Not temperature control type, controlled only by schedule
 				//Reduce defrost heat load on the zone by amount of ice melted during time step
 				//But DefrostSchedule not changed
-				FrostChangekg = max( 0.0, min( ( DefrostEnergy / IceMeltEnthalpy ), StartFrostKg ) );
-				DefrostLoad -= FrostChangekg * IceMeltEnthalpy / TimeStepSys / SecInHour;
-				if ( ! WarmupFlag ) warehouse_coil.KgFrost = StartFrostKg - FrostChangekg;
+				CalculateCoilFrostChangekg = max( 0.0, min( ( CalculateCoilDefrostEnergy / IceMeltEnthalpy ), CalculateCoilStartFrostKg ) );
+				CalculateCoilDefrostLoad -= CalculateCoilFrostChangekg * IceMeltEnthalpy / TimeStepSys / SecInHour;
+				if ( ! WarmupFlag ) warehouse_coil.KgFrost = CalculateCoilStartFrostKg - CalculateCoilFrostChangekg;
 			} //Temperature termination vs. time-clock control type
 
 		} else { //DefrostSchedule <= 0 or have None or OffCycle
-			DefrostLoad = 0.0;
+			CalculateCoilDefrostLoad = 0.0;
 		} //Defrost calculations
 
-		SensLoadFromZone = SensLoadGross - HeaterLoad - DefrostLoad - FanPowerActual;
+		SensLoadFromZone = SensLoadGross - CalculateCoilHeaterLoad - CalculateCoilDefrostLoad - FanPowerActual;
 		CoolingLoadNet = SensLoadFromZone + LatLoadServed;
 
 		// ReportWarehouseCoil(CoilID)
-		warehouse_coil.ThermalDefrostPower = DefrostLoad;
+		warehouse_coil.ThermalDefrostPower = CalculateCoilDefrostLoad;
 		if ( warehouse_coil.DefrostType == DefrostElec ) {
-			warehouse_coil.ElecDefrostConsumption = DefrostCap * DefrostSchedule * TimeStepSys * SecInHour;
-			warehouse_coil.ElecDefrostPower = DefrostCap * DefrostSchedule;
+			warehouse_coil.ElecDefrostConsumption = CalculateCoilDefrostCap * CalculateCoilDefrostSchedule * TimeStepSys * SecInHour;
+			warehouse_coil.ElecDefrostPower = CalculateCoilDefrostCap * CalculateCoilDefrostSchedule;
 		} else {
 			warehouse_coil.ElecDefrostConsumption = 0.0;
 			warehouse_coil.ElecDefrostPower = 0.0;
 		}
 
 		// If hot brine or hot gas is used for defrost, need to reduce condenser load by heat reclaimed for defrost
-		if ( warehouse_coil.DefrostType == DefrostFluid ) warehouse_coil.HotDefrostCondCredit = DefrostCap * DefrostSchedule;
+		if ( warehouse_coil.DefrostType == DefrostFluid ) warehouse_coil.HotDefrostCondCredit = CalculateCoilDefrostCap * CalculateCoilDefrostSchedule;
 		// LatentLoadServed is positive for latent heat removed from zone
 		// SensLoadFromZone positive for heat REMOVED from zone, switch when do credit to zone
 		warehouse_coil.SensCreditRate = SensLoadFromZone;
 		warehouse_coil.SensCreditEnergy = SensLoadFromZone * TimeStepSys * SecInHour;
 		warehouse_coil.LatCreditRate = LatLoadServed;
 		warehouse_coil.LatCreditEnergy = LatLoadServed * TimeStepSys * SecInHour;
-		warehouse_coil.LatKgPerS_ToZone = WaterRemovRate;
+		warehouse_coil.LatKgPerS_ToZone = CalculateCoilWaterRemovRate;
 		warehouse_coil.TotalCoolingLoad = CoilCapTotal;
 		warehouse_coil.TotalCoolingEnergy = CoilCapTotal * TimeStepSys * SecInHour;
 		warehouse_coil.SensCoolingEnergyRate = SensLoadGross;
@@ -12755,10 +13372,10 @@ namespace RefrigeratedCase {
 		warehouse_coil.SensHeatRatio = SHR;
 		warehouse_coil.ElecFanPower = FanPowerActual;
 		warehouse_coil.ElecFanConsumption = FanPowerActual * TimeStepSys * SecInHour;
-		warehouse_coil.ElecHeaterPower = HeaterLoad;
-		warehouse_coil.ElecHeaterConsumption = HeaterLoad * TimeStepSys * SecInHour;
+		warehouse_coil.ElecHeaterPower = CalculateCoilHeaterLoad;
+		warehouse_coil.ElecHeaterConsumption = CalculateCoilHeaterLoad * TimeStepSys * SecInHour;
 
-		warehouse_coil.TotalElecPower = FanPowerActual + HeaterLoad + warehouse_coil.ElecDefrostPower;
+		warehouse_coil.TotalElecPower = FanPowerActual + CalculateCoilHeaterLoad + warehouse_coil.ElecDefrostPower;
 		warehouse_coil.TotalElecConsumption = warehouse_coil.TotalElecPower * TimeStepSys * SecInHour;
 
 		if ( warehouse_coil.SensCreditRate >= 0.0 ) {
@@ -12828,7 +13445,6 @@ namespace RefrigeratedCase {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyEnvrnFlag( true );
 		int loop;
 
 		CheckRefrigerationInput();
@@ -12933,37 +13549,26 @@ namespace RefrigeratedCase {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static int DemandARRID( 0 ); // Index to water tank Demand used for evap condenser
-		static int TankID( 0 ); // Index to water tank used for evap condenser
-		static int RackNum( 0 ); // Index to refrigerated rack
-		static int CondID( 0 ); // Index to condenser
-		static int PlantInletNode( 0 ); // Used to zero request for cooling water for condenser
-		static int PlantOutletNode( 0 ); // Used to zero request for cooling water for condenser
-		static int PlantLoopIndex( 0 ); // Used to zero request for cooling water for condenser
-		static int PlantLoopSideIndex( 0 ); // Used to zero request for cooling water for condenser
-		static int PlantBranchIndex( 0 ); // Used to zero request for cooling water for condenser
-		static int PlantCompIndex( 0 ); // Used to zero request for cooling water for condenser
-		static Real64 MassFlowRate( 0.0 ); // Used to zero request for cooling water for condenser
 
 		if ( HaveRefrigRacks ) {
 			//HaveRefrigRacks is TRUE when NumRefrigeratedRAcks > 0
 			//RefrigRack ALLOCATED to NumRefrigeratedRacks
-			for ( RackNum = 1; RackNum <= NumRefrigeratedRacks; ++RackNum ) {
-				if ( RefrigRack( RackNum ).CondenserType == RefrigCondenserTypeWater ) {
-					PlantInletNode = RefrigRack( RackNum ).InletNode;
-					PlantOutletNode = RefrigRack( RackNum ).OutletNode;
-					PlantLoopIndex = RefrigRack( RackNum ).PlantLoopNum;
-					PlantLoopSideIndex = RefrigRack( RackNum ).PlantLoopSideNum;
-					PlantBranchIndex = RefrigRack( RackNum ).PlantBranchNum;
-					PlantCompIndex = RefrigRack( RackNum ).PlantCompNum;
-					MassFlowRate = 0.0;
-					SetComponentFlowRate( MassFlowRate, PlantInletNode, PlantOutletNode, PlantLoopIndex, PlantLoopSideIndex, PlantBranchIndex, PlantCompIndex );
-				}
-				if ( RefrigRack( RackNum ).CondenserType == RefrigCondenserTypeEvap ) {
-					if ( RefrigRack( RackNum ).EvapWaterSupplyMode == WaterSupplyFromTank ) {
-						DemandARRID = RefrigRack( RackNum ).EvapWaterTankDemandARRID;
-						TankID = RefrigRack( RackNum ).EvapWaterSupTankID;
-						WaterStorage( TankID ).VdotRequestDemand( DemandARRID ) = 0.0;
+			for ( ZeroHVACValuesRackNum = 1; ZeroHVACValuesRackNum <= NumRefrigeratedRacks; ++ZeroHVACValuesRackNum ) {
+				if ( RefrigRack( ZeroHVACValuesRackNum ).CondenserType == RefrigCondenserTypeWater ) {
+					PlantInletNode = RefrigRack( ZeroHVACValuesRackNum ).InletNode;
+					PlantOutletNode = RefrigRack( ZeroHVACValuesRackNum ).OutletNode;
+					PlantLoopIndex = RefrigRack( ZeroHVACValuesRackNum ).PlantLoopNum;
+					PlantLoopSideIndex = RefrigRack( ZeroHVACValuesRackNum ).PlantLoopSideNum;
+					PlantBranchIndex = RefrigRack( ZeroHVACValuesRackNum ).PlantBranchNum;
+					PlantCompIndex = RefrigRack( ZeroHVACValuesRackNum ).PlantCompNum;
+					ZeroHVACValuesMassFlowRate = 0.0;
+					SetComponentFlowRate( ZeroHVACValuesMassFlowRate, PlantInletNode, PlantOutletNode, PlantLoopIndex, PlantLoopSideIndex, PlantBranchIndex, PlantCompIndex );
+				}
+				if ( RefrigRack( ZeroHVACValuesRackNum ).CondenserType == RefrigCondenserTypeEvap ) {
+					if ( RefrigRack( ZeroHVACValuesRackNum ).EvapWaterSupplyMode == WaterSupplyFromTank ) {
+						ZeroHVACValuesDemandARRID = RefrigRack( ZeroHVACValuesRackNum ).EvapWaterTankDemandARRID;
+						TankID = RefrigRack( ZeroHVACValuesRackNum ).EvapWaterSupTankID;
+						WaterStorage( TankID ).VdotRequestDemand( ZeroHVACValuesDemandARRID ) = 0.0;
 					}
 				}
 			} // RackNum
@@ -12971,22 +13576,22 @@ namespace RefrigeratedCase {
 
 		if ( NumRefrigCondensers > 0 ) {
 			//Condenser ALLOCATED to NumRefrigCondensers
-			for ( CondID = 1; CondID <= NumRefrigCondensers; ++CondID ) {
-				if ( Condenser( CondID ).CondenserType == RefrigCondenserTypeWater ) {
-					PlantInletNode = Condenser( CondID ).InletNode;
-					PlantOutletNode = Condenser( CondID ).OutletNode;
-					PlantLoopIndex = Condenser( CondID ).PlantLoopNum;
-					PlantLoopSideIndex = Condenser( CondID ).PlantLoopSideNum;
-					PlantBranchIndex = Condenser( CondID ).PlantBranchNum;
-					PlantCompIndex = Condenser( CondID ).PlantCompNum;
-					MassFlowRate = 0.0;
-					SetComponentFlowRate( MassFlowRate, PlantInletNode, PlantOutletNode, PlantLoopIndex, PlantLoopSideIndex, PlantBranchIndex, PlantCompIndex );
-				}
-				if ( Condenser( CondID ).CondenserType == RefrigCondenserTypeEvap ) {
-					if ( Condenser( CondID ).EvapWaterSupplyMode == WaterSupplyFromTank ) {
-						DemandARRID = Condenser( CondID ).EvapWaterTankDemandARRID;
-						TankID = Condenser( CondID ).EvapWaterSupTankID;
-						WaterStorage( TankID ).VdotRequestDemand( DemandARRID ) = 0.0;
+			for ( ZeroHVACValuesCondID = 1; ZeroHVACValuesCondID <= NumRefrigCondensers; ++ZeroHVACValuesCondID ) {
+				if ( Condenser( ZeroHVACValuesCondID ).CondenserType == RefrigCondenserTypeWater ) {
+					PlantInletNode = Condenser( ZeroHVACValuesCondID ).InletNode;
+					PlantOutletNode = Condenser( ZeroHVACValuesCondID ).OutletNode;
+					PlantLoopIndex = Condenser( ZeroHVACValuesCondID ).PlantLoopNum;
+					PlantLoopSideIndex = Condenser( ZeroHVACValuesCondID ).PlantLoopSideNum;
+					PlantBranchIndex = Condenser( ZeroHVACValuesCondID ).PlantBranchNum;
+					PlantCompIndex = Condenser( ZeroHVACValuesCondID ).PlantCompNum;
+					ZeroHVACValuesMassFlowRate = 0.0;
+					SetComponentFlowRate( ZeroHVACValuesMassFlowRate, PlantInletNode, PlantOutletNode, PlantLoopIndex, PlantLoopSideIndex, PlantBranchIndex, PlantCompIndex );
+				}
+				if ( Condenser( ZeroHVACValuesCondID ).CondenserType == RefrigCondenserTypeEvap ) {
+					if ( Condenser( ZeroHVACValuesCondID ).EvapWaterSupplyMode == WaterSupplyFromTank ) {
+						ZeroHVACValuesDemandARRID = Condenser( ZeroHVACValuesCondID ).EvapWaterTankDemandARRID;
+						TankID = Condenser( ZeroHVACValuesCondID ).EvapWaterSupTankID;
+						WaterStorage( TankID ).VdotRequestDemand( ZeroHVACValuesDemandARRID ) = 0.0;
 					}
 				}
 			} // ICond
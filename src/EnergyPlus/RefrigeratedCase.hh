@@ -224,6 +224,7 @@ namespace RefrigeratedCase {
 	extern int NumSimulationCases; // Number of refrigerated cases in simulation
 	extern int NumSimulationCaseAndWalkInLists; // Total number of CaseAndWalkIn Lists in IDF
 	extern int NumSimulationWalkIns; // Number of walk in coolers in simulation
+	extern int NumRefrigZoneAirs; // Number of zones holding cases or walk-in doors
 	extern int NumSimulationCompressors; // Number of refrigeration compressors in simulation
 	extern int NumSimulationSubcoolers; // Number of refrigeration subcoolers in simulation
 	extern int NumSimulationMechSubcoolers; // Number of mechanical subcoolers in simulation
@@ -1611,6 +1612,32 @@ namespace RefrigeratedCase {
 
 	};
 
+	struct RefrigZoneAirData // Air state of a zone holding cases or walk-ins, evaluated once per call
+	{
+		// Members
+		int ZoneNodeNum; // Zone node number
+		bool HasCases; // True if cases are located in the zone
+		bool HasWalkInDoors; // True if walk-in doors open to the zone
+		Real64 RHFrac; // Zone relative humidity (fraction)
+		Real64 DewPoint; // Zone dew point (C), only evaluated for zones with cases
+		Real64 Enthalpy; // Zone air enthalpy (J/kg), only evaluated for zones with walk-in doors
+		Real64 HumRat; // Zone air humidity ratio (kg/kg), only evaluated for zones with walk-in doors
+		Real64 Density; // Zone air density (kg/m3), only evaluated for zones with walk-in doors
+
+		// Default Constructor
+		RefrigZoneAirData() :
+			ZoneNodeNum( 0 ),
+			HasCases( false ),
+			HasWalkInDoors( false ),
+			RHFrac( 0.0 ),
+			DewPoint( 0.0 ),
+			Enthalpy( 0.0 ),
+			HumRat( 0.0 ),
+			Density( 0.0 )
+		{}
+
+	};
+
 	struct SubcoolerData
 	{
 		// Members
@@ -2311,9 +2338,14 @@ namespace RefrigeratedCase {
 	extern Array1D< AirChillerSetData > AirChillerSet;
 	extern Array1D< CoilCreditData > CoilSysCredit;
 	extern Array1D< CaseWIZoneReportData > CaseWIZoneReport;
+	extern Array1D< RefrigZoneAirData > RefrigZoneAir;
+	extern Array1D_int RefrigZoneAirList; // Zones in RefrigZoneAir that hold cases or walk-in doors
 
 	// Functions
 
+	void
+	clear_state();
+
 	void
 	ManageRefrigeratedCaseRacks();
 
@@ -2377,6 +2409,9 @@ namespace RefrigeratedCase {
 	//***************************************************************************************************
 	//***************************************************************************************************
 
+	void
+	CalcRefrigZoneAirStates();
+
 	void
 	SimulateDetailedRefrigerationSystems();
 
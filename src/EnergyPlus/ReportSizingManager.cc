@@ -125,8 +125,25 @@ namespace ReportSizingManager {
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE <module_name>:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool MyOneTimeFlag( true );
+	}
+
 	// Functions
 
+	// Clears the global data in ReportSizingManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		MyOneTimeFlag = true;
+	}
+
 	void
 	ReportSizingOutput(
 		std::string const & CompType, // the type of the component
@@ -172,7 +189,6 @@ namespace ReportSizingManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true );
 
 		// Formats
 		static gio::Fmt Format_990( "('! <Component Sizing Information>, Component Type, Component Name, ','Input Field Description, Value')" );
@@ -1170,7 +1186,7 @@ namespace ReportSizingManager {
 						UA1 = DataCapacityUsedForSizing;
 						// Invert the simple heating coil model: given the design inlet conditions and the design load,
 						// find the design UA.
-						SolveRegulaFalsi( Acc, MaxIte, SolFla, AutosizeDes, SimpleHeatingCoilUAResidual, UA0, UA1, Par );
+						SolveRegulaFalsi( Acc, MaxIte, SolFla, AutosizeDes, SimpleHeatingCoilUAResidual, UA0, UA1, Par, "RequestSizing" );
 						if ( SolFla == -1 ) {
 							ShowSevereError( "Autosizing of heating coil UA failed for Coil:Heating:Water \"" + CompName + "\"" );
 							ShowContinueError( "  Iteration limit exceeded in calculating coil UA" );
@@ -1926,7 +1942,7 @@ namespace ReportSizingManager {
 						UA1 = DataCapacityUsedForSizing;
 						// Invert the simple heating coil model: given the design inlet conditions and the design load,
 						// find the design UA.
-						SolveRegulaFalsi( Acc, MaxIte, SolFla, AutosizeDes, SimpleHeatingCoilUAResidual, UA0, UA1, Par );
+						SolveRegulaFalsi( Acc, MaxIte, SolFla, AutosizeDes, SimpleHeatingCoilUAResidual, UA0, UA1, Par, "RequestSizing" );
 						if ( SolFla == -1 ) {
 							ShowSevereError( "Autosizing of heating coil UA failed for Coil:Heating:Water \"" + CompName + "\"" );
 							ShowContinueError( "  Iteration limit exceeded in calculating coil UA" );
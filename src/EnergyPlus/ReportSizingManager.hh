@@ -71,6 +71,11 @@ namespace ReportSizingManager {
 
 	// Functions
 
+	// Clears the global data in ReportSizingManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	ReportSizingOutput(
 		std::string const & CompType, // the type of the component
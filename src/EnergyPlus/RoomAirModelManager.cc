@@ -141,6 +141,52 @@ namespace RoomAirModelManager {
 
 	// MODULE SUBROUTINES:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int CompNum( 0 );
+		int GetCrossVentDataTypeNum( 0 );
+		int NodeNum1( 0 );
+		int NodeNum2( 0 );
+		int contFloorBegin( 0 ); // counter
+		int contFloorLast( 0 ); // counter
+		int contFloor( 0 ); // counter
+		int contCeilingBegin( 0 ); // counter
+		int contCeilingLast( 0 ); // counter
+		int contCeiling( 0 ); // counter
+		int contWallBegin( 0 ); // counter
+		int contWallLast( 0 ); // counter
+		int contWall( 0 ); // counter
+		int contWindowBegin( 0 ); // counter
+		int contWindowLast( 0 ); // counter
+		int contWindow( 0 ); // counter
+		int contInternalBegin( 0 ); // counter
+		int contInternalLast( 0 ); // counter
+		int contInternal( 0 ); // counter
+		int contDoorBegin( 0 ); // counter
+		int contDoorLast( 0 ); // counter
+		int contDoor( 0 ); // counter
+		int Loop( 0 ); // counter
+		int Loop2( 0 ); // counter
+		int i( 0 ); // counter
+		int N( 0 ); // counter
+		Real64 Z1ZoneAux( 0.0 ); // Auxiliary variables
+		Real64 Z2ZoneAux( 0.0 ); // Auxiliary variables
+		Real64 Z1Zone( 0.0 ); // Auxiliary variables
+		Real64 Z2Zone( 0.0 ); // Auxiliary variables
+		Real64 CeilingHeightDiffMax( 0.1 ); // Maximum difference between wall height and ceiling height
+		int Loop3( 0 ); // counter
+		bool MyOneTimeFlag( true );
+		Array1D_bool MyEnvrnFlag;
+		int SharedDVCVUFDataInitCompNum( 0 ); // AirflowNetwork Component number
+		int SharedDVCVUFDataInitTypeNum( 0 ); // Airflownetwork Type Number within a component
+		int SharedDVCVUFDataInitNodeNum1( 0 ); // The first node number in an AirflowNetwork linkage data
+		int SharedDVCVUFDataInitNodeNum2( 0 ); // The Second node number in an AirflowNetwork linkage data
+	}
+
 	// Functions
 
 	void
@@ -148,6 +194,44 @@ namespace RoomAirModelManager {
 	{
 		GetUCSDDVDataFlag = true;
 		GetAirModelData = true;
+		CompNum = 0;
+		GetCrossVentDataTypeNum = 0;
+		NodeNum1 = 0;
+		NodeNum2 = 0;
+		contFloorBegin = 0;
+		contFloorLast = 0;
+		contFloor = 0;
+		contCeilingBegin = 0;
+		contCeilingLast = 0;
+		contCeiling = 0;
+		contWallBegin = 0;
+		contWallLast = 0;
+		contWall = 0;
+		contWindowBegin = 0;
+		contWindowLast = 0;
+		contWindow = 0;
+		contInternalBegin = 0;
+		contInternalLast = 0;
+		contInternal = 0;
+		contDoorBegin = 0;
+		contDoorLast = 0;
+		contDoor = 0;
+		Loop = 0;
+		Loop2 = 0;
+		i = 0;
+		N = 0;
+		Z1ZoneAux = 0.0;
+		Z2ZoneAux = 0.0;
+		Z1Zone = 0.0;
+		Z2Zone = 0.0;
+		CeilingHeightDiffMax = 0.1;
+		Loop3 = 0;
+		MyOneTimeFlag = true;
+		MyEnvrnFlag.deallocate();
+		SharedDVCVUFDataInitCompNum = 0;
+		SharedDVCVUFDataInitTypeNum = 0;
+		SharedDVCVUFDataInitNodeNum1 = 0;
+		SharedDVCVUFDataInitNodeNum2 = 0;
 	}
 
 	void
@@ -1140,10 +1224,6 @@ namespace RoomAirModelManager {
 		int Loop;
 		int Loop2;
 		int ThisZone;
-		static int CompNum( 0 );
-		static int TypeNum( 0 );
-		static int NodeNum1( 0 );
-		static int NodeNum2( 0 );
 
 		if ( ! UCSDModelUsed ) return;
 		cCurrentModuleObject = "RoomAirSettings:CrossVentilation";
@@ -1232,13 +1312,13 @@ namespace RoomAirModelManager {
 				NodeNum2 = MultizoneSurfaceData( Loop2 ).NodeNums( 2 );
 				if ( Surface( MultizoneSurfaceData( Loop2 ).SurfNum ).Zone == ThisZone || ( AirflowNetworkNodeData( NodeNum2 ).EPlusZoneNum == ThisZone && AirflowNetworkNodeData( NodeNum1 ).EPlusZoneNum > 0 ) || ( AirflowNetworkNodeData( NodeNum2 ).EPlusZoneNum > 0 && AirflowNetworkNodeData( NodeNum1 ).EPlusZoneNum == ThisZone ) ) {
 					CompNum = AirflowNetworkLinkageData( Loop2 ).CompNum;
-					TypeNum = AirflowNetworkCompData( CompNum ).TypeNum;
+					GetCrossVentDataTypeNum = AirflowNetworkCompData( CompNum ).TypeNum;
 					if ( AirflowNetworkCompData( CompNum ).CompTypeNum == CompTypeNum_SCR ) {
-						if ( MultizoneSurfaceCrackData( TypeNum ).FlowExpo != 0.50 ) {
+						if ( MultizoneSurfaceCrackData( GetCrossVentDataTypeNum ).FlowExpo != 0.50 ) {
 							AirModel( ThisZone ).AirModelType = RoomAirModel_Mixing;
 							ShowWarningError( "Problem with " + cCurrentModuleObject + " = " + cAlphaArgs( 1 ) );
 							ShowWarningError( "Roomair model will not be applied for Zone=" + cAlphaArgs( 1 ) + '.' );
-							ShowContinueError( "AirflowNetwrok:Multizone:Surface crack object must have an air flow coefficient = 0.5, value was=" + RoundSigDigits( MultizoneSurfaceCrackData( TypeNum ).FlowExpo, 2 ) );
+							ShowContinueError( "AirflowNetwrok:Multizone:Surface crack object must have an air flow coefficient = 0.5, value was=" + RoundSigDigits( MultizoneSurfaceCrackData( GetCrossVentDataTypeNum ).FlowExpo, 2 ) );
 						}
 					}
 				}
@@ -1924,33 +2004,6 @@ namespace RoomAirModelManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int SurfNum; // DO loop counter for surfaces
 		int ZNum; // DO loop counter for zones
-		static int contFloorBegin( 0 ); // counter
-		static int contFloorLast( 0 ); // counter
-		static int contFloor( 0 ); // counter
-		static int contCeilingBegin( 0 ); // counter
-		static int contCeilingLast( 0 ); // counter
-		static int contCeiling( 0 ); // counter
-		static int contWallBegin( 0 ); // counter
-		static int contWallLast( 0 ); // counter
-		static int contWall( 0 ); // counter
-		static int contWindowBegin( 0 ); // counter
-		static int contWindowLast( 0 ); // counter
-		static int contWindow( 0 ); // counter
-		static int contInternalBegin( 0 ); // counter
-		static int contInternalLast( 0 ); // counter
-		static int contInternal( 0 ); // counter
-		static int contDoorBegin( 0 ); // counter
-		static int contDoorLast( 0 ); // counter
-		static int contDoor( 0 ); // counter
-		static int Loop( 0 ); // counter
-		static int Loop2( 0 ); // counter
-		static int i( 0 ); // counter
-		static int N( 0 ); // counter
-		static Real64 Z1ZoneAux( 0.0 ); // Auxiliary variables
-		static Real64 Z2ZoneAux( 0.0 ); // Auxiliary variables
-		static Real64 Z1Zone( 0.0 ); // Auxiliary variables
-		static Real64 Z2Zone( 0.0 ); // Auxiliary variables
-		static Real64 CeilingHeightDiffMax( 0.1 ); // Maximum difference between wall height and ceiling height
 		bool SetZoneAux;
 		Array1D_int AuxSurf;
 		int MaxSurf;
@@ -1959,18 +2012,11 @@ namespace RoomAirModelManager {
 		Real64 HeightFactMax;
 		Real64 WidthFact;
 		Real64 HeightFact;
-		static int Loop3( 0 ); // counter
 		int ZoneEquipConfigNum; // counter
 		Real64 AinCV;
 		int AirflowNetworkSurfPtr;
 		int NSides;
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyEnvrnFlag;
 
-		static int CompNum( 0 ); // AirflowNetwork Component number
-		static int TypeNum( 0 ); // Airflownetwork Type Number within a component
-		static int NodeNum1( 0 ); // The first node number in an AirflowNetwork linkage data
-		static int NodeNum2( 0 ); // The Second node number in an AirflowNetwork linkage data
 
 		// Do the one time initializations
 		if ( MyOneTimeFlag ) {
@@ -2160,27 +2206,27 @@ namespace RoomAirModelManager {
 							// SurfNum has the reference surface number relative to AirflowNetworkSurfaceData
 							AirflowNetworkSurfaceUCSDCV( SurfNum, Loop ) = Loop2;
 							// calculate the surface width and height
-							CompNum = AirflowNetworkLinkageData( Loop2 ).CompNum;
-							TypeNum = AirflowNetworkCompData( CompNum ).TypeNum;
-							if ( AirflowNetworkCompData( CompNum ).CompTypeNum == CompTypeNum_DOP ) {
+							SharedDVCVUFDataInitCompNum = AirflowNetworkLinkageData( Loop2 ).CompNum;
+							SharedDVCVUFDataInitTypeNum = AirflowNetworkCompData( SharedDVCVUFDataInitCompNum ).TypeNum;
+							if ( AirflowNetworkCompData( SharedDVCVUFDataInitCompNum ).CompTypeNum == CompTypeNum_DOP ) {
 								WidthFactMax = 0.0;
 								HeightFactMax = 0.0;
-								for ( Loop3 = 1; Loop3 <= MultizoneCompDetOpeningData( TypeNum ).NumFac; ++Loop3 ) {
+								for ( Loop3 = 1; Loop3 <= MultizoneCompDetOpeningData( SharedDVCVUFDataInitTypeNum ).NumFac; ++Loop3 ) {
 									if ( Loop3 == 1 ) {
-										WidthFact = MultizoneCompDetOpeningData( TypeNum ).WidthFac1;
-										HeightFact = MultizoneCompDetOpeningData( TypeNum ).HeightFac1;
+										WidthFact = MultizoneCompDetOpeningData( SharedDVCVUFDataInitTypeNum ).WidthFac1;
+										HeightFact = MultizoneCompDetOpeningData( SharedDVCVUFDataInitTypeNum ).HeightFac1;
 									}
 									if ( Loop3 == 2 ) {
-										WidthFact = MultizoneCompDetOpeningData( TypeNum ).WidthFac2;
-										HeightFact = MultizoneCompDetOpeningData( TypeNum ).HeightFac2;
+										WidthFact = MultizoneCompDetOpeningData( SharedDVCVUFDataInitTypeNum ).WidthFac2;
+										HeightFact = MultizoneCompDetOpeningData( SharedDVCVUFDataInitTypeNum ).HeightFac2;
 									}
 									if ( Loop3 == 3 ) {
-										WidthFact = MultizoneCompDetOpeningData( TypeNum ).WidthFac3;
-										HeightFact = MultizoneCompDetOpeningData( TypeNum ).HeightFac3;
+										WidthFact = MultizoneCompDetOpeningData( SharedDVCVUFDataInitTypeNum ).WidthFac3;
+										HeightFact = MultizoneCompDetOpeningData( SharedDVCVUFDataInitTypeNum ).HeightFac3;
 									}
 									if ( Loop3 == 4 ) {
-										WidthFact = MultizoneCompDetOpeningData( TypeNum ).WidthFac4;
-										HeightFact = MultizoneCompDetOpeningData( TypeNum ).HeightFac4;
+										WidthFact = MultizoneCompDetOpeningData( SharedDVCVUFDataInitTypeNum ).WidthFac4;
+										HeightFact = MultizoneCompDetOpeningData( SharedDVCVUFDataInitTypeNum ).HeightFac4;
 									}
 									if ( WidthFact > WidthFactMax ) {
 										WidthFactMax = WidthFact;
@@ -2191,13 +2237,13 @@ namespace RoomAirModelManager {
 								}
 								SurfParametersCVDV( Loop2 ).Width = WidthFactMax * Surface( MultizoneSurfaceData( Loop2 ).SurfNum ).Width;
 								SurfParametersCVDV( Loop2 ).Height = HeightFactMax * Surface( MultizoneSurfaceData( Loop2 ).SurfNum ).Height;
-							} else if ( AirflowNetworkCompData( CompNum ).CompTypeNum == CompTypeNum_SCR ) { // surface type = CRACK
+							} else if ( AirflowNetworkCompData( SharedDVCVUFDataInitCompNum ).CompTypeNum == CompTypeNum_SCR ) { // surface type = CRACK
 								SurfParametersCVDV( Loop2 ).Width = Surface( MultizoneSurfaceData( Loop2 ).SurfNum ).Width / 2;
-								AinCV = MultizoneSurfaceCrackData( TypeNum ).FlowCoef / ( BaseDischargeCoef * std::sqrt( 2.0 / PsyRhoAirFnPbTdbW( OutBaroPress, MAT( Loop ), ZoneAirHumRat( Loop ) ) ) );
+								AinCV = MultizoneSurfaceCrackData( SharedDVCVUFDataInitTypeNum ).FlowCoef / ( BaseDischargeCoef * std::sqrt( 2.0 / PsyRhoAirFnPbTdbW( OutBaroPress, MAT( Loop ), ZoneAirHumRat( Loop ) ) ) );
 								SurfParametersCVDV( Loop2 ).Height = AinCV / SurfParametersCVDV( Loop2 ).Width;
 							}
 							// calculate the surface Zmin and Zmax
-							if ( AirflowNetworkCompData( CompNum ).CompTypeNum == CompTypeNum_DOP ) {
+							if ( AirflowNetworkCompData( SharedDVCVUFDataInitCompNum ).CompTypeNum == CompTypeNum_DOP ) {
 								AirflowNetworkSurfPtr = MultizoneSurfaceData( Loop2 ).SurfNum;
 								NSides = Surface( MultizoneSurfaceData( Loop2 ).SurfNum ).Sides;
 								Real64 z_min( std::numeric_limits< Real64 >::max() ), z_max( std::numeric_limits< Real64 >::lowest() );
@@ -2208,7 +2254,7 @@ namespace RoomAirModelManager {
 								}
 								SurfParametersCVDV( Loop2 ).Zmin = z_min - ceilingHeight;
 								SurfParametersCVDV( Loop2 ).Zmax = z_max - ceilingHeight;
-							} else if ( AirflowNetworkCompData( CompNum ).CompTypeNum == CompTypeNum_SCR ) { // surface type = CRACK
+							} else if ( AirflowNetworkCompData( SharedDVCVUFDataInitCompNum ).CompTypeNum == CompTypeNum_SCR ) { // surface type = CRACK
 								AirflowNetworkSurfPtr = MultizoneSurfaceData( Loop2 ).SurfNum;
 								NSides = Surface( MultizoneSurfaceData( Loop2 ).SurfNum ).Sides;
 								Real64 z_min( std::numeric_limits< Real64 >::max() ), z_max( std::numeric_limits< Real64 >::lowest() );
@@ -2224,9 +2270,9 @@ namespace RoomAirModelManager {
 							++SurfNum;
 							// Check if airflow network Surface is an interzone surface:
 						} else {
-							NodeNum1 = MultizoneSurfaceData( Loop2 ).NodeNums( 1 );
-							NodeNum2 = MultizoneSurfaceData( Loop2 ).NodeNums( 2 );
-							if ( ( AirflowNetworkNodeData( NodeNum2 ).EPlusZoneNum == Loop && AirflowNetworkNodeData( NodeNum1 ).EPlusZoneNum > 0 ) || ( AirflowNetworkNodeData( NodeNum2 ).EPlusZoneNum > 0 && AirflowNetworkNodeData( NodeNum1 ).EPlusZoneNum == Loop ) ) {
+							SharedDVCVUFDataInitNodeNum1 = MultizoneSurfaceData( Loop2 ).NodeNums( 1 );
+							SharedDVCVUFDataInitNodeNum2 = MultizoneSurfaceData( Loop2 ).NodeNums( 2 );
+							if ( ( AirflowNetworkNodeData( SharedDVCVUFDataInitNodeNum2 ).EPlusZoneNum == Loop && AirflowNetworkNodeData( SharedDVCVUFDataInitNodeNum1 ).EPlusZoneNum > 0 ) || ( AirflowNetworkNodeData( SharedDVCVUFDataInitNodeNum2 ).EPlusZoneNum > 0 && AirflowNetworkNodeData( SharedDVCVUFDataInitNodeNum1 ).EPlusZoneNum == Loop ) ) {
 								AirflowNetworkSurfaceUCSDCV( SurfNum, Loop ) = Loop2;
 								++SurfNum;
 							}
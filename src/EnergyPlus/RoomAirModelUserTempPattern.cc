@@ -143,8 +143,31 @@ namespace RoomAirModelUserTempPattern {
 
 	// MODULE SUBROUTINES:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		Array1D_bool MyEnvrnFlag; // flag for init once at start of environment
+		bool MyOneTimeFlag( true ); // one time setup flag
+		Array1D_bool SetupOutputFlag; // flag to set up output variable one-time if 2-grad model used
+		bool FigureTwoGradInterpPatternMyOneTimeFlag( true );
+	}
+
 	// Functions
 
+	// Clears the global data in RoomAirModelUserTempPattern.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		MyEnvrnFlag.deallocate();
+		MyOneTimeFlag = true;
+		SetupOutputFlag.deallocate();
+		FigureTwoGradInterpPatternMyOneTimeFlag = true;
+	}
+
 	void
 	ManageUserDefinedPatterns( int const ZoneNum ) // index number for the specified zone
 	{
@@ -235,8 +258,6 @@ namespace RoomAirModelUserTempPattern {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array1D_bool MyEnvrnFlag; // flag for init once at start of environment
-		static bool MyOneTimeFlag( true ); // one time setup flag
 		int SurfNum; // do loop counter
 
 		if ( MyOneTimeFlag ) {
@@ -627,12 +648,10 @@ namespace RoomAirModelUserTempPattern {
 		Real64 thisZeta; // non-dimensional height
 		Real64 DeltaHeight; // height difference in m
 		Real64 tempDeltaTai; // temporary temperature difference
-		static Array1D_bool SetupOutputFlag; // flag to set up output variable one-time if 2-grad model used
-		static bool MyOneTimeFlag( true );
 
-		if ( MyOneTimeFlag ) {
+		if ( FigureTwoGradInterpPatternMyOneTimeFlag ) {
 			SetupOutputFlag.dimension( NumOfZones, true ); // init
-			MyOneTimeFlag = false;
+			FigureTwoGradInterpPatternMyOneTimeFlag = false;
 		}
 
 		if ( SetupOutputFlag( ZoneNum ) ) {
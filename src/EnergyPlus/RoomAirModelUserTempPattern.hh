@@ -89,6 +89,11 @@ namespace RoomAirModelUserTempPattern {
 
 	// Functions
 
+	// Clears the global data in RoomAirModelUserTempPattern.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	ManageUserDefinedPatterns( int const ZoneNum ); // index number for the specified zone
 
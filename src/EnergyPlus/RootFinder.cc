@@ -57,7 +57,9 @@
 // in binary and source code form.
 
 // C++ Headers
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Fmath.hh>
@@ -67,6 +69,7 @@
 #include <RootFinder.hh>
 #include <DataGlobals.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <General.hh>
 #include <UtilityRoutines.hh>
 
@@ -208,8 +211,27 @@ namespace RootFinder {
 	// MODULE SUBROUTINES:
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		Real64 AdvanceRootFinderXNext( 0.0 );
+		std::string NoValue; // String used whenever the value is not available
+	}
+
 	// Functions
 
+	// Clears the global data in RootFinder.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		AdvanceRootFinderXNext = 0.0;
+		NoValue.clear();
+	}
+
 	void
 	SetupRootFinder(
 		RootFinderDataType & RootFinderData, // Data used by root finding algorithm
@@ -2032,7 +2054,6 @@ namespace RootFinder {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 XNext( 0.0 );
 
 		// FLOW:
 
@@ -2044,8 +2065,8 @@ namespace RootFinder {
 		if ( ! RootFinderData.LowerPoint.DefinedFlag ) {
 			RootFinderData.CurrentMethodType = iMethodBracket;
 			// If we have 2 points already, try to detect lower point using the Secant formula
-			if ( BracketRoot( RootFinderData, XNext ) ) {
-				RootFinderData.XCandidate = XNext;
+			if ( BracketRoot( RootFinderData, AdvanceRootFinderXNext ) ) {
+				RootFinderData.XCandidate = AdvanceRootFinderXNext;
 			} else {
 				if ( ! RootFinderData.MinPoint.DefinedFlag ) {
 					RootFinderData.XCandidate = RootFinderData.MinPoint.X;
@@ -2059,8 +2080,8 @@ namespace RootFinder {
 		} else if ( ! RootFinderData.UpperPoint.DefinedFlag ) {
 			RootFinderData.CurrentMethodType = iMethodBracket;
 			// If we have 2 points already, try to detect upper point using the Secant formula
-			if ( BracketRoot( RootFinderData, XNext ) ) {
-				RootFinderData.XCandidate = XNext;
+			if ( BracketRoot( RootFinderData, AdvanceRootFinderXNext ) ) {
+				RootFinderData.XCandidate = AdvanceRootFinderXNext;
 			} else {
 				if ( ! RootFinderData.MaxPoint.DefinedFlag ) {
 					RootFinderData.XCandidate = RootFinderData.MaxPoint.X;
@@ -2729,7 +2750,6 @@ namespace RootFinder {
 		// If set to TRUE, ten always show the X value even if not defined
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		static std::string NoValue; // String used whenever the value is not available
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -2891,6 +2911,117 @@ namespace RootFinder {
 
 	}
 
+	void
+	UpdateRootSolverStats(
+		char const * CallerName, // Name of the caller of the root solver (nullptr: not tracked)
+		int const MethodType, // Any of the iMethod<name> codes
+		int const Flag // Exit status of the root solver (> 0: iterations, -1: no convergence, -2: not bracketed)
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Accumulates the convergence statistics of one call to the General::SolveRoot
+		// family of root solvers for the named caller.
+
+		// METHODOLOGY EMPLOYED:
+		// Statistics are only gathered when the TRACK_ROOTSOLVER environment variable is set
+		// and the caller supplied a name. Callers are registered on first use. The solvers pass
+		// the name as a C string so that the key is only built here, when tracking is on.
+
+		// Using/Aliasing
+		using DataSystemVariables::TrackRootSolverEnvFlag;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int StatsNum;
+
+		if ( ! TrackRootSolverEnvFlag || CallerName == nullptr || CallerName[ 0 ] == '\0' ) return;
+
+		std::string const Name( CallerName );
+		auto const found( RootSolverStatsIndex.find( Name ) );
+		if ( found == RootSolverStatsIndex.end() ) {
+			if ( NumRootSolverStats == int( RootSolverStats.size() ) ) {
+				RootSolverStats.redimension( max( 2 * NumRootSolverStats, 16 ) );
+			}
+			StatsNum = ++NumRootSolverStats;
+			RootSolverStats( StatsNum ).Name = Name;
+			RootSolverStatsIndex.emplace( Name, StatsNum );
+		} else {
+			StatsNum = found->second;
+		}
+
+		auto & ThisStats( RootSolverStats( StatsNum ) );
+		ThisStats.MethodType = MethodType;
+		++ThisStats.NumCalls;
+		if ( Flag > 0 ) {
+			++ThisStats.NumConverged;
+			ThisStats.TotIterations += Flag;
+			ThisStats.MaxIterations = max( ThisStats.MaxIterations, Flag );
+		} else if ( Flag == -2 ) {
+			++ThisStats.NumNotBracketed;
+		} else {
+			++ThisStats.NumIterationLimit;
+		}
+
+	}
+
+	void
+	DumpRootSolverStatistics()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the convergence statistics of all root solver callers
+		// to a CSV file named "statistics.RootSolvers.csv".
+
+		// METHODOLOGY EMPLOYED:
+		// One row per caller, sorted by decreasing average number of iterations
+		// so that the slowest converging components are listed first.
+
+		// Using/Aliasing
+		using DataSystemVariables::TrackRootSolverEnvFlag;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt fmtA( "(A)" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int FileUnit;
+		std::vector< int > Order; // Caller indexes sorted by average iterations
+
+		if ( ! TrackRootSolverEnvFlag ) return;
+
+		std::string StatisticsFileName = "statistics.RootSolvers.csv";
+
+		FileUnit = GetNewUnitNumber();
+
+		if ( FileUnit <= 0 ) {
+			ShowWarningError( "DumpRootSolverStatistics: Invalid unit for root solver statistics file=\"" + StatisticsFileName + "\"" );
+			return;
+		}
+
+		{ IOFlags flags; flags.ACTION( "write" ); gio::open( FileUnit, StatisticsFileName, flags ); if ( flags.err() ) ShowFatalError( "DumpRootSolverStatistics: Failed to open statistics file \"" + StatisticsFileName + "\" for output (write)." ); }
+
+		auto const AvgIterations = []( RootSolverStatsType const & Stats ) -> Real64 {
+			if ( Stats.NumConverged == 0 ) return 0.0;
+			return double( Stats.TotIterations ) / double( Stats.NumConverged );
+		};
+
+		Order.reserve( NumRootSolverStats );
+		for ( int StatsNum = 1; StatsNum <= NumRootSolverStats; ++StatsNum ) {
+			Order.push_back( StatsNum );
+		}
+		std::stable_sort( Order.begin(), Order.end(), [&]( int const A, int const B ) {
+			return AvgIterations( RootSolverStats( A ) ) > AvgIterations( RootSolverStats( B ) );
+		} );
+
+		gio::write( FileUnit, fmtA ) << "Caller,Method,NumCalls,NumConverged,NumIterationLimit,NumNotBracketed,TotIterations,MaxIterations,AvgIterations";
+		for ( int const StatsNum : Order ) {
+			auto const & ThisStats( RootSolverStats( StatsNum ) );
+			gio::write( FileUnit, fmtA ) << ThisStats.Name + ',' + SolutionMethodTypes( ThisStats.MethodType ) + ',' + TrimSigDigits( ThisStats.NumCalls ) + ',' + TrimSigDigits( ThisStats.NumConverged ) + ',' + TrimSigDigits( ThisStats.NumIterationLimit ) + ',' + TrimSigDigits( ThisStats.NumNotBracketed ) + ',' + TrimSigDigits( ThisStats.TotIterations ) + ',' + TrimSigDigits( ThisStats.MaxIterations ) + ',' + TrimSigDigits( AvgIterations( ThisStats ), 4 );
+		}
+
+		gio::close( FileUnit );
+
+	}
+
 } // RootFinder
 
 } // EnergyPlus
@@ -59,6 +59,9 @@
 #ifndef RootFinder_hh_INCLUDED
 #define RootFinder_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1S.hh>
 #include <ObjexxFCL/Optional.hh>
@@ -91,6 +94,11 @@ namespace RootFinder {
 
 	// Functions
 
+	// Clears the global data in RootFinder.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SetupRootFinder(
 		RootFinderDataType & RootFinderData, // Data used by root finding algorithm
@@ -260,6 +268,16 @@ namespace RootFinder {
 		RootFinderDataType const & RootFinderData // Data used by root finding algorithm
 	);
 
+	void
+	UpdateRootSolverStats(
+		char const * CallerName, // Name of the caller of the root solver (nullptr: not tracked)
+		int const MethodType, // Any of the iMethod<name> codes
+		int const Flag // Exit status of the root solver (> 0: iterations, -1: no convergence, -2: not bracketed)
+	);
+
+	void
+	DumpRootSolverStatistics();
+
 } // RootFinder
 
 } // EnergyPlus
@@ -73,6 +73,7 @@
 
 // EnergyPlus Headers
 #include <RuntimeLanguageProcessor.hh>
+#include <Checkpoint.hh>
 #include <EMSManager.hh>
 #include <CurveManager.hh>
 #include <DataEnvironment.hh>
@@ -186,6 +187,31 @@ namespace RuntimeLanguageProcessor {
 
 	// MODULE SUBROUTINES:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		Real64 tmpCurrentTime( 0.0 );
+		Real64 tmpMinutes( 0.0 );
+		Real64 tmpHours( 0.0 );
+		Real64 tmpCurEnvirNum( 0.0 );
+		int VariableNum;
+		bool MyOneTimeFlag( false );
+		Array1D< TokenType > Token;
+		bool ErrorsFound( false );
+		std::string FreqString; // temporary
+		std::string VarTypeString; // temporary
+		std::string ResourceTypeString;
+		std::string GroupTypeString;
+		std::string EndUseTypeString;
+		std::string EndUseSubCatString;
+		int MaxNumAlphas( 0 ); // argument for call to GetObjectDefMaxArgs
+		int MaxNumNumbers( 0 ); // argument for call to GetObjectDefMaxArgs
+		int TotalArgs( 0 ); // argument for call to GetObjectDefMaxArgs
+	}
+
 	// Functions
 	void
 	clear_state(){
@@ -221,6 +247,23 @@ namespace RuntimeLanguageProcessor {
 		ActualTimeNum = 0;
 		WarmUpFlagNum = 0;
 	
+		tmpCurrentTime = 0.0;
+		tmpMinutes = 0.0;
+		tmpHours = 0.0;
+		tmpCurEnvirNum = 0.0;
+		VariableNum = 0;
+		MyOneTimeFlag = false;
+		Token.deallocate();
+		ErrorsFound = false;
+		FreqString.clear();
+		VarTypeString.clear();
+		ResourceTypeString.clear();
+		GroupTypeString.clear();
+		EndUseTypeString.clear();
+		EndUseSubCatString.clear();
+		MaxNumAlphas = 0;
+		MaxNumNumbers = 0;
+		TotalArgs = 0;
 	}
 
 	void
@@ -260,10 +303,6 @@ namespace RuntimeLanguageProcessor {
 		// Locals
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static Real64 tmpCurrentTime( 0.0 );
-		static Real64 tmpMinutes( 0.0 );
-		static Real64 tmpHours( 0.0 );
-		static Real64 tmpCurEnvirNum( 0.0 );
 		Array1D_int datevalues( 8 );
 		//value(1)   Current year
 		//value(2)   Current month
@@ -469,6 +508,7 @@ namespace RuntimeLanguageProcessor {
 			TrendDepth = TrendVariable( TrendVarNum ).LogDepth;
 			TrendVariable( TrendVarNum ).TrendValARR( {1,TrendDepth} ) = 0.0;
 		}
+		Checkpoint::RestoreTrendVariables(); // logged values of a resumed environment
 
 		// reinitilize sensors
 		for ( SensorNum = 1; SensorNum <= NumSensors; ++SensorNum ) {
@@ -923,7 +963,6 @@ namespace RuntimeLanguageProcessor {
 		int InstructionNum;
 		int InstructionNum2;
 		int ExpressionNum;
-		static int VariableNum;
 		int WhileLoopExitCounter; // to avoid infinite loop in While loop
 		bool seriousErrorFound( false ); // once it gets set true (inside EvaluateExpresssion) it will trigger a fatal (in WriteTrace)
 
@@ -1080,7 +1119,6 @@ namespace RuntimeLanguageProcessor {
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( false );
 		int LineNum;
 		std::string NameString;
 		std::string LineNumString;
@@ -1198,7 +1236,6 @@ namespace RuntimeLanguageProcessor {
 		bool LastED; // last character in a numeric was an E or D
 
 		// Object Data
-		static Array1D< TokenType > Token;
 
 		// FLOW:
 		CountDoLooping = 0;
@@ -2693,27 +2730,17 @@ namespace RuntimeLanguageProcessor {
 		int IOStat; // IO Status when calling get input subroutine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
-		static bool ErrorsFound( false );
 		int VariableNum( 0 ); // temporary
 		int RuntimeReportVarNum;
 		//unused0909  INTEGER    :: Pos
 		//unused0909  CHARACTER(len=MaxNameLength) :: VariableName
 		bool Found;
-		static std::string FreqString; // temporary
-		static std::string VarTypeString; // temporary
-		static std::string ResourceTypeString;
-		static std::string GroupTypeString;
-		static std::string EndUseTypeString;
-		static std::string EndUseSubCatString;
 
 		int TrendNum;
 		int NumTrendSteps;
 		int loop;
 		int ErlVarLoop;
 		int CurveIndexNum;
-		static int MaxNumAlphas( 0 ); // argument for call to GetObjectDefMaxArgs
-		static int MaxNumNumbers( 0 ); // argument for call to GetObjectDefMaxArgs
-		static int TotalArgs( 0 ); // argument for call to GetObjectDefMaxArgs
 		Array1D_string cAlphaFieldNames;
 		Array1D_string cNumericFieldNames;
 		Array1D_bool lNumericFieldBlanks;
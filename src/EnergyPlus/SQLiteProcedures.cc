@@ -73,6 +73,7 @@
 #include "ScheduleManager.hh"
 #include "DataSystemVariables.hh"
 
+#include <algorithm>
 #include <sstream>
 #include <stdexcept>
 
@@ -2125,6 +2126,121 @@ void SQLite::createSQLiteEnvironmentPeriodRecord( const int curEnvirNum, const s
 	}
 }
 
+void SQLite::getReportDataIndices( int & timeIndex, int & dataIndex, int & extendedDataIndex, int & hourlyReportIndex, int & hourlyDataIndex ) const
+{
+	timeIndex = m_sqlDBTimeIndex;
+	dataIndex = m_dataIndex;
+	extendedDataIndex = m_extendedDataIndex;
+	hourlyReportIndex = m_hourlyReportIndex;
+	hourlyDataIndex = m_hourlyDataIndex;
+}
+
+bool SQLite::restoreReportData( std::string const & fileName, int const resumedEnvironmentPeriodIndex, int const timeIndex, int const dataIndex, int const extendedDataIndex, int const hourlyReportIndex, int const hourlyDataIndex )
+{
+	if ( ! m_writeOutputToSQLite ) return false;
+
+	sqlite3_stmt * attachStmt;
+	sqlitePrepareStatement(attachStmt, "ATTACH DATABASE ? AS restart;");
+	sqliteBindText(attachStmt, 1, fileName);
+	bool const attached = sqliteStepValidity( sqliteStepCommand(attachStmt) );
+	sqlite3_finalize(attachStmt);
+	if ( ! attached ) return false;
+
+	// The records up to the current indices were written by this run, as they were by the earlier one
+	bool ok = true;
+	auto const copyRecords = [&]( std::string const & table, std::string const & indexColumn, int const currentIndex, int const lastIndex ) {
+		if ( lastIndex <= currentIndex ) return;
+		ok = ( sqliteExecuteCommand("INSERT INTO " + table + " SELECT * FROM restart." + table + " WHERE " + indexColumn + " > " + std::to_string(currentIndex) + " AND " + indexColumn + " <= " + std::to_string(lastIndex) + ";") == SQLITE_OK ) && ok;
+	};
+
+	sqliteBegin();
+	ok = ( sqliteExecuteCommand("INSERT OR IGNORE INTO EnvironmentPeriods SELECT * FROM restart.EnvironmentPeriods WHERE EnvironmentPeriodIndex < " + std::to_string(resumedEnvironmentPeriodIndex) + ";") == SQLITE_OK );
+	copyRecords("Time", "TimeIndex", m_sqlDBTimeIndex, timeIndex);
+	copyRecords("ReportData", "ReportDataIndex", m_dataIndex, dataIndex);
+	copyRecords("ReportExtendedData", "ReportExtendedDataIndex", m_extendedDataIndex, extendedDataIndex);
+	copyRecords("DaylightMapHourlyReports", "HourlyReportIndex", m_hourlyReportIndex, hourlyReportIndex);
+	copyRecords("DaylightMapHourlyData", "HourlyDataIndex", m_hourlyDataIndex, hourlyDataIndex);
+	if ( ok ) {
+		sqliteCommit();
+	} else {
+		sqliteExecuteCommand("ROLLBACK;");
+	}
+	sqliteExecuteCommand("DETACH DATABASE restart;");
+	if ( ! ok ) return false;
+
+	m_sqlDBTimeIndex = std::max( m_sqlDBTimeIndex, timeIndex );
+	m_dataIndex = std::max( m_dataIndex, dataIndex );
+	m_extendedDataIndex = std::max( m_extendedDataIndex, extendedDataIndex );
+	m_hourlyReportIndex = std::max( m_hourlyReportIndex, hourlyReportIndex );
+	m_hourlyDataIndex = std::max( m_hourlyDataIndex, hourlyDataIndex );
+	return true;
+}
+
+bool SQLite::appendReportData( std::string const & fileName )
+{
+	if ( ! m_writeOutputToSQLite ) return false;
+
+	sqlite3_stmt * attachStmt;
+	sqlitePrepareStatement(attachStmt, "ATTACH DATABASE ? AS segment;");
+	sqliteBindText(attachStmt, 1, fileName);
+	bool const attached = sqliteStepValidity( sqliteStepCommand(attachStmt) );
+	sqlite3_finalize(attachStmt);
+	if ( ! attached ) return false;
+
+	auto const selectInteger = [&]( std::string const & query ) {
+		sqlite3_stmt * selectStmt;
+		sqlitePrepareStatement(selectStmt, query);
+		int value = -1;
+		if ( sqliteStepCommand(selectStmt) == SQLITE_ROW ) value = sqlite3_column_int(selectStmt, 0);
+		sqlite3_finalize(selectStmt);
+		return value;
+	};
+
+	// The segments share the data dictionary of the model.  Their records are renumbered after the
+	// ones written so far, and the run period records, which cover one segment only, are left out.
+	bool ok = ( selectInteger("SELECT COUNT(*) FROM ReportDataDictionary;") == selectInteger("SELECT COUNT(*) FROM segment.ReportDataDictionary;") );
+	std::string const runPeriodData( "(SELECT ReportDataIndex FROM segment.ReportData WHERE ReportDataDictionaryIndex IN (SELECT ReportDataDictionaryIndex FROM ReportDataDictionary WHERE ReportingFrequency = 'Run Period'))" );
+	std::string const splitRunPeriodData( "(SELECT ReportDataIndex FROM ReportData WHERE ReportDataDictionaryIndex IN (SELECT ReportDataDictionaryIndex FROM ReportDataDictionary WHERE ReportingFrequency = 'Run Period') AND TimeIndex IN (SELECT TimeIndex FROM Time WHERE EnvironmentPeriodIndex IN (SELECT EnvironmentPeriodIndex FROM segment.Time)))" );
+	std::string const timeOffset( std::to_string(m_sqlDBTimeIndex) );
+	std::string const dataOffset( std::to_string(m_dataIndex) );
+	std::string const extendedDataOffset( std::to_string(m_extendedDataIndex) );
+	std::string const hourlyReportOffset( std::to_string(m_hourlyReportIndex) );
+	std::string const hourlyDataOffset( std::to_string(m_hourlyDataIndex) );
+	int const lastTimeIndex = selectInteger("SELECT IFNULL(MAX(TimeIndex), 0) FROM segment.Time;");
+	int const lastDataIndex = selectInteger("SELECT IFNULL(MAX(ReportDataIndex), 0) FROM segment.ReportData;");
+	int const lastExtendedDataIndex = selectInteger("SELECT IFNULL(MAX(ReportExtendedDataIndex), 0) FROM segment.ReportExtendedData;");
+	int const lastHourlyReportIndex = selectInteger("SELECT IFNULL(MAX(HourlyReportIndex), 0) FROM segment.DaylightMapHourlyReports;");
+	int const lastHourlyDataIndex = selectInteger("SELECT IFNULL(MAX(HourlyDataIndex), 0) FROM segment.DaylightMapHourlyData;");
+	ok = ok && ( std::min( { lastTimeIndex, lastDataIndex, lastExtendedDataIndex, lastHourlyReportIndex, lastHourlyDataIndex } ) >= 0 );
+
+	auto const execute = [&]( std::string const & command ) {
+		ok = ok && ( sqliteExecuteCommand(command) == SQLITE_OK );
+	};
+
+	sqliteBegin();
+	execute("DELETE FROM ReportExtendedData WHERE ReportDataIndex IN " + splitRunPeriodData + ";");
+	execute("DELETE FROM ReportData WHERE ReportDataIndex IN " + splitRunPeriodData + ";");
+	execute("INSERT INTO Time SELECT TimeIndex + " + timeOffset + ", Month, Day, Hour, Minute, Dst, Interval, IntervalType, SimulationDays, DayType, EnvironmentPeriodIndex, WarmupFlag FROM segment.Time;");
+	execute("INSERT INTO ReportData SELECT ReportDataIndex + " + dataOffset + ", TimeIndex + " + timeOffset + ", ReportDataDictionaryIndex, Value FROM segment.ReportData WHERE ReportDataIndex NOT IN " + runPeriodData + ";");
+	execute("INSERT INTO ReportExtendedData SELECT ReportExtendedDataIndex + " + extendedDataOffset + ", ReportDataIndex + " + dataOffset + ", MaxValue, MaxMonth, MaxDay, MaxHour, MaxStartMinute, MaxMinute, MinValue, MinMonth, MinDay, MinHour, MinStartMinute, MinMinute FROM segment.ReportExtendedData WHERE ReportDataIndex NOT IN " + runPeriodData + ";");
+	execute("INSERT INTO DaylightMapHourlyReports SELECT HourlyReportIndex + " + hourlyReportOffset + ", MapNumber, Month, DayOfMonth, Hour FROM segment.DaylightMapHourlyReports;");
+	execute("INSERT INTO DaylightMapHourlyData SELECT HourlyDataIndex + " + hourlyDataOffset + ", HourlyReportIndex + " + hourlyReportOffset + ", X, Y, Illuminance FROM segment.DaylightMapHourlyData;");
+	if ( ok ) {
+		sqliteCommit();
+	} else {
+		sqliteExecuteCommand("ROLLBACK;");
+	}
+	sqliteExecuteCommand("DETACH DATABASE segment;");
+	if ( ! ok ) return false;
+
+	m_sqlDBTimeIndex += lastTimeIndex;
+	m_dataIndex += lastDataIndex;
+	m_extendedDataIndex += lastExtendedDataIndex;
+	m_hourlyReportIndex += lastHourlyReportIndex;
+	m_hourlyDataIndex += lastHourlyDataIndex;
+	return true;
+}
+
 void SQLite::addScheduleData( int const number, std::string const & name, std::string const & type, double const minValue, double const maxValue )
 {
 	schedules.push_back(
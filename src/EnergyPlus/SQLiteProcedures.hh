@@ -265,6 +265,17 @@ public:
 
 	void createSQLiteEnvironmentPeriodRecord( const int curEnvirNum, const std::string& environmentName, const int kindOfSim, const int simulationIndex = 1 );
 
+	// Last indices of the report records written so far
+	void getReportDataIndices( int & timeIndex, int & dataIndex, int & extendedDataIndex, int & hourlyReportIndex, int & hourlyDataIndex ) const;
+
+	// Copy the report records after the ones written so far, up to the given indices, from the database
+	// of an earlier run of the same model.  Used to resume a simulation from a checkpoint.
+	bool restoreReportData( std::string const & fileName, int const resumedEnvironmentPeriodIndex, int const timeIndex, int const dataIndex, int const extendedDataIndex, int const hourlyReportIndex, int const hourlyDataIndex );
+
+	// Append the report records of the database of a later segment of a split run period, which
+	// simulated the same model.  Used by the first segment to merge the output of the segments.
+	bool appendReportData( std::string const & fileName );
+
 	void sqliteWriteMessage(const std::string & message);
 
 	void createZoneExtendedOutput();
@@ -56,10 +56,18 @@
 // computer software, distribute, and sublicense such enhancements or derivative works thereof,
 // in binary and source code form.
 
+// C++ Headers
+#include <fstream>
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
 #include <ObjexxFCL/Fmath.hh>
 #include <ObjexxFCL/gio.hh>
+#include <ObjexxFCL/stream.functions.hh>
 #include <ObjexxFCL/string.functions.hh>
 
 // EnergyPlus Headers
@@ -160,6 +168,21 @@ namespace ScheduleManager {
 	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
 	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
 		bool CheckScheduleValueMinMaxRunOnceOnly (true );
+
+		// Day and week schedules generated from Schedule:Compact, Schedule:File and Schedule:Constant input, keyed
+		// by a hash of their contents.  Identical generated profiles share one DaySchedule/WeekSchedule slot.
+		std::unordered_map< std::size_t, std::vector< int > > GeneratedDaySchedules;
+		std::unordered_map< std::size_t, std::vector< int > > GeneratedWeekSchedules;
+
+		// Lines of each Schedule:File file, keyed by full path, so that a file referenced by several
+		// Schedule:File objects (one per column) is only read from disk once.
+		std::map< std::string, std::vector< std::string > > ScheduleFileLines;
+		bool ProcessScheduleInputErrorsFound( false );
+		bool FullYearSet( false );
+		std::string CurrentThrough;
+		std::string LastFor;
+		std::string errmsg;
+		bool DoScheduleReportingSetup( true );
 	}
 
 	//Derived Types Variables
@@ -190,10 +213,19 @@ namespace ScheduleManager {
 		ScheduleInputProcessed = false;
 		ScheduleDSTSFileWarningIssued = false;
 		CheckScheduleValueMinMaxRunOnceOnly = true;
+		GeneratedDaySchedules.clear();
+		GeneratedWeekSchedules.clear();
+		ScheduleFileLines.clear();
 		ScheduleType.deallocate();
 		DaySchedule.deallocate();
 		WeekSchedule.deallocate();
 		Schedule.deallocate();
+		ProcessScheduleInputErrorsFound = false;
+		FullYearSet = false;
+		CurrentThrough.clear();
+		LastFor.clear();
+		errmsg.clear();
+		DoScheduleReportingSetup = true;
 	}
 
 	void
@@ -274,7 +306,6 @@ namespace ScheduleManager {
 		int NumPointer;
 		int Count;
 		int CheckIndex;
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool NumErrorFlag;
@@ -311,6 +342,8 @@ namespace ScheduleManager {
 		int MaxAlps;
 		int AddWeekSch;
 		int AddDaySch;
+		int SharedDaySch; // Day schedule holding an identical generated profile (AddDaySch if none)
+		int SharedWeekSch; // Week schedule holding an identical generated profile (AddWeekSch if none)
 		Array1D_bool AllDays( MaxDayTypes );
 		Array1D_bool TheseDays( MaxDayTypes );
 		bool ErrorHere;
@@ -325,15 +358,11 @@ namespace ScheduleManager {
 		int UntilFld;
 		int xxcount;
 		//  REAL(r64) tempval
-		static bool FullYearSet( false );
-		static std::string CurrentThrough;
-		static std::string LastFor;
-		static std::string errmsg;
 		int kdy;
 		bool FileExists;
 		// for SCHEDULE:FILE
 		Array1D< Real64 > hourlyFileValues;
-		int SchdFile;
+		std::size_t nextLine; // next line of the cached Schedule:File lines to be read
 		int colCnt;
 		int rowCnt;
 		int wordStart;
@@ -560,7 +589,7 @@ namespace ScheduleManager {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), ScheduleType( {1,NumScheduleTypes} ), LoopIndex - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			ScheduleType( LoopIndex ).Name = Alphas( 1 );
@@ -581,7 +610,7 @@ namespace ScheduleManager {
 				} else {
 					if ( Alphas( 2 ) != "CONTINUOUS" && Alphas( 2 ) != "REAL" ) {
 						ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + ScheduleType( LoopIndex ).Name + "\", invalid " + cAlphaFields( 2 ) + '=' + Alphas( 2 ) );
-						ErrorsFound = true;
+						ProcessScheduleInputErrorsFound = true;
 					}
 					ScheduleType( LoopIndex ).IsReal = true;
 				}
@@ -619,7 +648,7 @@ namespace ScheduleManager {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), DaySchedule, Count, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			++Count;
@@ -675,7 +704,7 @@ namespace ScheduleManager {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), DaySchedule, Count, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			++Count;
@@ -698,14 +727,14 @@ namespace ScheduleManager {
 			if ( NumFields == 0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", Insufficient data entered for a full schedule day." );
 				ShowContinueError( "...Number of interval fields = = [" + RoundSigDigits( NumFields ) + "]." );
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 			}
 
-			ProcessIntervalFields( Alphas( { 4, _ } ), Numbers, NumFields, NumNumbers, MinuteValue, SetMinuteValue, ErrorsFound, Alphas( 1 ), CurrentModuleObject, (Alphas( 3 ) == "YES") );
+			ProcessIntervalFields( Alphas( { 4, _ } ), Numbers, NumFields, NumNumbers, MinuteValue, SetMinuteValue, ProcessScheduleInputErrorsFound, Alphas( 1 ), CurrentModuleObject, (Alphas( 3 ) == "YES") );
 			// Depending on value of "Interpolate" field, the value for each time step in each hour gets processed:
 			if ( Alphas( 3 ) != "NO" && Alphas( 3 ) != "YES" ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "Invalid value for \"" + cAlphaFields( 3 ) + "\" field=\"" + Alphas( 3 ) + "\"" );
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 			} else if ( Alphas( 3 ) != "YES" ) { // No validation done on the value of the interpolation field
 				DaySchedule( Count ).IntervalInterpolated = false;
 				for ( Hr = 1; Hr <= 24; ++Hr ) {
@@ -759,7 +788,7 @@ namespace ScheduleManager {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), DaySchedule, Count, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			++Count;
@@ -781,7 +810,7 @@ namespace ScheduleManager {
 			// Depending on value of "Interpolate" field, the value for each time step in each hour gets processed:
 			if ( Alphas( 3 ) != "NO" && Alphas( 3 ) != "YES" ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "Invalid value for \"" + cAlphaFields( 3 ) + "\" field=\"" + Alphas( 3 ) + "\"" );
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 			} else if ( Alphas( 3 ) != "YES" ) { // No validation done on the value of the interpolation field
 				DaySchedule( Count ).IntervalInterpolated = false;
 			} else {
@@ -792,13 +821,13 @@ namespace ScheduleManager {
 			if ( Numbers( 1 ) <= 0.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", Insufficient data entered for a full schedule day." );
 				ShowContinueError( "...Minutes per Item field = [" + RoundSigDigits( int( Numbers( 1 ) ) ) + "]." );
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 				continue;
 			}
 			if ( NumNumbers < 25 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", Insufficient data entered for a full schedule day." );
 				ShowContinueError( "...Minutes per Item field = [" + RoundSigDigits( int( Numbers( 1 ) ) ) + "] and only [" + RoundSigDigits( NumNumbers - 1 ) + "] to apply to list fields." );
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 				continue;
 			}
 			MinutesPerItem = int( Numbers( 1 ) );
@@ -806,14 +835,14 @@ namespace ScheduleManager {
 			if ( ( NumNumbers - 1 ) != NumExpectedItems ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + ", Number of Entered Items=" + RoundSigDigits( NumNumbers - 1 ) + " not equal number of expected items=" + RoundSigDigits( NumExpectedItems ) );
 				ShowContinueError( "based on " + cNumericFields( 1 ) + " field value=" + RoundSigDigits( MinutesPerItem ) );
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 				continue;
 			}
 
 			if ( mod( 60, MinutesPerItem ) != 0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) );
 				ShowContinueError( "Requested " + cNumericFields( 1 ) + " field value (" + RoundSigDigits( MinutesPerItem ) + ") not evenly divisible into 60" );
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 				continue;
 			}
 
@@ -885,7 +914,7 @@ namespace ScheduleManager {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), WeekSchedule( {1,NumRegWeekSchedules} ), LoopIndex - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			WeekSchedule( LoopIndex ).Name = Alphas( 1 );
@@ -894,7 +923,7 @@ namespace ScheduleManager {
 				DayIndex = FindItemInList( Alphas( InLoopIndex + 1 ), DaySchedule( {1,NumRegDaySchedules} ) );
 				if ( DayIndex == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( InLoopIndex + 1 ) + " \"" + Alphas( InLoopIndex + 1 ) + "\" not Found", UnitNumber );
-					ErrorsFound = true;
+					ProcessScheduleInputErrorsFound = true;
 				} else {
 					WeekSchedule( LoopIndex ).DaySchedulePointer( InLoopIndex ) = DayIndex;
 				}
@@ -911,7 +940,7 @@ namespace ScheduleManager {
 			if ( Count > 0 ) {
 				VerifyName( Alphas( 1 ), WeekSchedule( {1,Count} ), Count, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					ProcessScheduleInputErrorsFound = true;
 					if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 				}
 			}
@@ -924,14 +953,14 @@ namespace ScheduleManager {
 				if ( DayIndex == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( InLoopIndex + 1 ) + " \"" + Alphas( InLoopIndex + 1 ) + "\" not Found", UnitNumber );
 					ShowContinueError( "ref: " + cAlphaFields( InLoopIndex ) + " \"" + Alphas( InLoopIndex ) + "\"" );
-					ErrorsFound = true;
+					ProcessScheduleInputErrorsFound = true;
 				} else {
 					TheseDays = false;
 					ErrorHere = false;
 					ProcessForDayTypes( Alphas( InLoopIndex ), TheseDays, AllDays, ErrorHere );
 					if ( ErrorHere ) {
 						ShowContinueError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) );
-						ErrorsFound = true;
+						ProcessScheduleInputErrorsFound = true;
 					} else {
 						for ( Hr = 1; Hr <= MaxDayTypes; ++Hr ) {
 							if ( TheseDays( Hr ) ) {
@@ -944,7 +973,7 @@ namespace ScheduleManager {
 			//  Have processed all named days, check to make sure all given
 			if ( ! all( AllDays ) ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", Missing some day assignments" );
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 			}
 		}
 		NumRegWeekSchedules = Count;
@@ -960,7 +989,7 @@ namespace ScheduleManager {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), Schedule( {1,NumSchedules} ), LoopIndex - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			Schedule( LoopIndex ).Name = Alphas( 1 );
@@ -985,7 +1014,7 @@ namespace ScheduleManager {
 				WeekIndex = FindItemInList( Alphas( InLoopIndex ), WeekSchedule( {1,NumRegWeekSchedules} ) );
 				if ( WeekIndex == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( InLoopIndex ) + "=\"" + Alphas( InLoopIndex ) + "\" not found.", UnitNumber );
-					ErrorsFound = true;
+					ProcessScheduleInputErrorsFound = true;
 				} else {
 					// Process for month, day
 					StartMonth = int( Numbers( NumPointer + 1 ) );
@@ -1020,11 +1049,11 @@ namespace ScheduleManager {
 			}
 			if ( any_eq( DaysInYear, 0 ) ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Schedule( LoopIndex ).Name + "\" has missing days in its schedule pointers", UnitNumber );
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 			}
 			if ( any_gt( DaysInYear, 1 ) ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Schedule( LoopIndex ).Name + "\" has overlapping days in its schedule pointers", UnitNumber );
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 			}
 
 			if ( AnyEnergyManagementSystemInModel ) { // setup constant schedules as actuators
@@ -1063,7 +1092,7 @@ namespace ScheduleManager {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), Schedule( {1,NumSchedules} ), SchNum, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			++SchNum;
@@ -1094,7 +1123,7 @@ namespace ScheduleManager {
 				if ( ! has_prefix( Alphas( NumField ), "THROUGH:" ) && ! has_prefix( Alphas( NumField ), "THROUGH" ) ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Schedule( SchNum ).Name + "\", Expecting \"Through:\" date" );
 					ShowContinueError( "Instead, found entry=" + Alphas( NumField ) );
-					ErrorsFound = true;
+					ProcessScheduleInputErrorsFound = true;
 					goto Through_exit;
 				} else {
 					if ( Alphas( NumField )[ 7 ] == ':' ) {
@@ -1111,12 +1140,12 @@ namespace ScheduleManager {
 				if ( PDateType > 1 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Schedule( SchNum ).Name + "\", Invalid \"Through:\" date" );
 					ShowContinueError( "Found entry=" + Alphas( NumField ) );
-					ErrorsFound = true;
+					ProcessScheduleInputErrorsFound = true;
 					goto Through_exit;
 				} else if ( ErrorHere ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Schedule( SchNum ).Name + "\", Invalid \"Through:\" date" );
 					ShowContinueError( "Found entry=" + Alphas( NumField ) );
-					ErrorsFound = true;
+					ProcessScheduleInputErrorsFound = true;
 					goto Through_exit;
 				} else {
 					EndPointer = JulianDay( EndMonth, EndDay, 1 );
@@ -1124,7 +1153,7 @@ namespace ScheduleManager {
 						if ( FullYearSet ) {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Schedule( SchNum ).Name + "\", New \"Through\" entry when \"full year\" already set" );
 							ShowContinueError( "\"Through\" field=" + CurrentThrough );
-							ErrorsFound = true;
+							ProcessScheduleInputErrorsFound = true;
 						}
 						FullYearSet = true;
 					}
@@ -1161,7 +1190,7 @@ namespace ScheduleManager {
 						if ( ErrorHere ) {
 							ShowContinueError( "ref " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"" );
 							ShowContinueError( "ref Through field=" + Alphas( ThruField ) );
-							ErrorsFound = true;
+							ProcessScheduleInputErrorsFound = true;
 						} else {
 							for ( Hr = 1; Hr <= MaxDayTypes; ++Hr ) {
 								if ( TheseDays( Hr ) ) {
@@ -1171,7 +1200,7 @@ namespace ScheduleManager {
 						}
 					} else {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", Looking for \"For\" field, found=" + Alphas( NumField ) );
-						ErrorsFound = true;
+						ProcessScheduleInputErrorsFound = true;
 						//          CALL ShowSevereError(RoutineName//TRIM(CurrentModuleObject)//'="'//TRIM(Schedule(SchNum)%Name)//  &
 						//               '", Expecting "For:" day types')
 						//          CALL ShowContinueError('Instead, found entry='//TRIM(Alphas(NumField)))
@@ -1194,7 +1223,7 @@ namespace ScheduleManager {
 								DaySchedule( AddDaySch ).IntervalInterpolated = false;
 							} else {
 								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", Illegal Field entered =" + Alphas( NumField ) );
-								ErrorsFound = true;
+								ProcessScheduleInputErrorsFound = true;
 							}
 							++NumField;
 						}
@@ -1214,13 +1243,13 @@ namespace ScheduleManager {
 							if ( ErrorHere ) {
 								ShowSevereError( CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"" );
 								ShowContinueError( "Until field=[" + Alphas( NumField - 1 ) + "] has illegal value field=[" + Alphas( NumField ) + "]." );
-								ErrorsFound = true;
+								ProcessScheduleInputErrorsFound = true;
 							}
 							++NumField;
 							Alphas( UntilFld + xxcount ) = Alphas( NumField ); // Incase next is "until"
 						} else {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", Looking for \"Until\" field, found=" + Alphas( NumField ) );
-							ErrorsFound = true;
+							ProcessScheduleInputErrorsFound = true;
 							goto Through_exit;
 						}
 						if ( Alphas( NumField ).empty() ) break;
@@ -1233,7 +1262,7 @@ namespace ScheduleManager {
 						// Depending on value of "Interpolate" field, the value for each time step in each hour gets processed:
 						if ( ErrorHere ) {
 							ShowContinueError( "ref " + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\"" );
-							ErrorsFound = true;
+							ProcessScheduleInputErrorsFound = true;
 						}
 						if ( ! DaySchedule( AddDaySch ).IntervalInterpolated ) { // No validation done on the value of the interpolation field
 							for ( Hr = 1; Hr <= 24; ++Hr ) {
@@ -1256,6 +1285,16 @@ namespace ScheduleManager {
 							}
 						}
 					}
+					// share the day profile with an identical one generated earlier and give back its slot
+					SharedDaySch = ShareDaySchedule( AddDaySch );
+					if ( SharedDaySch != AddDaySch ) {
+						for ( Hr = 1; Hr <= MaxDayTypes; ++Hr ) {
+							if ( WeekSchedule( AddWeekSch ).DaySchedulePointer( Hr ) == AddDaySch ) {
+								WeekSchedule( AddWeekSch ).DaySchedulePointer( Hr ) = SharedDaySch;
+							}
+						}
+						--AddDaySch;
+					}
 				}
 				For_exit: ;
 				if ( ! all( AllDays ) ) {
@@ -1271,6 +1310,15 @@ namespace ScheduleManager {
 					ShowContinueError( errmsg );
 					ShowContinueError( "Missing day types will have 0.0 as Schedule Values" );
 				}
+				SharedWeekSch = ShareWeekSchedule( AddWeekSch );
+				if ( SharedWeekSch != AddWeekSch ) {
+					for ( Hr = 1; Hr <= 366; ++Hr ) {
+						if ( Schedule( SchNum ).WeekSchedulePointer( Hr ) == AddWeekSch ) {
+							Schedule( SchNum ).WeekSchedulePointer( Hr ) = SharedWeekSch;
+						}
+					}
+					--AddWeekSch;
+				}
 			}
 			Through_exit: ;
 			if ( DaysInYear( 60 ) == 0 ) {
@@ -1279,11 +1327,11 @@ namespace ScheduleManager {
 			}
 			if ( any_eq( DaysInYear, 0 ) ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Schedule( SchNum ).Name + "\" has missing days in its schedule pointers", UnitNumber );
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 			}
 			if ( any_gt( DaysInYear, 1 ) ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Schedule( SchNum ).Name + "\" has overlapping days in its schedule pointers", UnitNumber );
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 			}
 
 			if ( AnyEnergyManagementSystemInModel ) { // setup constant schedules as actuators
@@ -1351,7 +1399,7 @@ namespace ScheduleManager {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), Schedule( {1,NumSchedules} ), SchNum, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			++SchNum;
@@ -1381,7 +1429,7 @@ namespace ScheduleManager {
 			if ( Numbers( 3 ) != 8760 && Numbers( 3 ) != 8784 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cNumericFields( 3 ) + " must = 8760 or 8784 (for a leap year)" );
 				ShowContinueError( "..Value for field = " + TrimSigDigits( Numbers( 3 ), 0 ) + ", Schedule not processed." );
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 				continue;
 			}
 
@@ -1397,7 +1445,7 @@ namespace ScheduleManager {
 			} else {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( 4 ) + " illegal value=\"" + Alphas( 4 ) + "\"." );
 				ShowContinueError( "..must be Comma, Semicolon, Tab, or Space." );
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 				continue;
 			}
 
@@ -1406,7 +1454,7 @@ namespace ScheduleManager {
 			if ( lAlphaBlanks( 5 ) ) Alphas( 5 ) = "NO";
 			if ( Alphas( 5 ) != "NO" && Alphas( 5 ) != "YES" ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "Invalid value for \"" + cAlphaFields( 5 ) + "\" field=\"" + Alphas( 5 ) + "\"" );
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 			} else if ( Alphas( 5 ) != "YES" ) { // No validation done on the value of the interpolation field
 				FileIntervalInterpolated = false;
 			} else {
@@ -1421,7 +1469,7 @@ namespace ScheduleManager {
 				if ( mod( 60, MinutesPerItem ) != 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) );
 					ShowContinueError( "Requested " + cNumericFields( 4 ) + " field value (" + RoundSigDigits( MinutesPerItem ) + ") not evenly divisible into 60" );
-					ErrorsFound = true;
+					ProcessScheduleInputErrorsFound = true;
 					continue;
 				}
 			}
@@ -1474,35 +1522,48 @@ namespace ScheduleManager {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( 3 ) + "=\"" + Alphas( 3 ) + "\" not found." );
 				ShowContinueError( "Certain run environments require a full path to be included with the file name in the input field." );
 				ShowContinueError( "Try again with putting full path and file name in the field." );
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 			} else {
-				SchdFile = GetNewUnitNumber();
-				{ IOFlags flags; flags.ACTION( "read" ); gio::open( SchdFile, TempFullFileName, flags ); read_stat = flags.ios(); }
-				if ( read_stat != 0 ) {
-					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( 3 ) + "=\"" + Alphas( 3 ) + "\" cannot be opened." );
-					ShowContinueError( "... It may be open in another program (such as Excel).  Please close and try again." );
-					ShowFatalError( "Program terminates due to previous condition." );
+				// read the file once; Schedule:File objects for other columns of the same file reuse its lines
+				auto fileLines( ScheduleFileLines.find( TempFullFileName ) );
+				if ( fileLines == ScheduleFileLines.end() ) {
+					std::ifstream schdFile( TempFullFileName, std::ios_base::in | std::ios_base::binary );
+					if ( ! schdFile ) {
+						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( 3 ) + "=\"" + Alphas( 3 ) + "\" cannot be opened." );
+						ShowContinueError( "... It may be open in another program (such as Excel).  Please close and try again." );
+						ShowFatalError( "Program terminates due to previous condition." );
+					}
+					std::vector< std::string > lines;
+					while ( cross_platform_get_line( schdFile, LineIn ) ) {
+						lines.push_back( LineIn );
+					}
+					fileLines = ScheduleFileLines.emplace( TempFullFileName, std::move( lines ) ).first;
 				}
+				std::vector< std::string > const & schdFileLines( fileLines->second );
 				// check for stripping
-				{ IOFlags flags; gio::read( SchdFile, fmtA, flags ) >> LineIn; read_stat = flags.ios(); }
-				endLine = len( LineIn );
-				if ( endLine > 0 ) {
-					if ( int( LineIn[ endLine - 1 ] ) == iUnicode_end ) {
-						gio::close( SchdFile );
-						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( 3 ) + "=\"" + Alphas( 3 ) + " appears to be a Unicode or binary file." );
-						ShowContinueError( "...This file cannot be read by this program. Please save as PC or Unix file and try again" );
-						ShowFatalError( "Program terminates due to previous condition." );
+				if ( ! schdFileLines.empty() ) {
+					endLine = len( schdFileLines.front() );
+					if ( endLine > 0 ) {
+						if ( int( schdFileLines.front()[ endLine - 1 ] ) == iUnicode_end ) {
+							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( 3 ) + "=\"" + Alphas( 3 ) + " appears to be a Unicode or binary file." );
+							ShowContinueError( "...This file cannot be read by this program. Please save as PC or Unix file and try again" );
+							ShowFatalError( "Program terminates due to previous condition." );
+						}
 					}
 				}
-				gio::backspace( SchdFile );
 
 				// skip lines if any need to be skipped.
 				numerrors = 0;
 				rowCnt = 0;
 				read_stat = 0;
+				nextLine = 0;
 				if ( skiprowCount > 0 ) { // Numbers(2) has number of rows to skip
 					while ( read_stat == 0 ) { //end of file
-						{ IOFlags flags; gio::read( SchdFile, fmtA, flags ) >> LineIn; read_stat = flags.ios(); }
+						if ( nextLine < schdFileLines.size() ) {
+							++nextLine;
+						} else {
+							read_stat = -1;
+						}
 						++rowCnt;
 						if ( rowCnt == skiprowCount ) {
 							break;
@@ -1515,7 +1576,12 @@ namespace ScheduleManager {
 				rowCnt = 0;
 				firstLine = true;
 				while ( read_stat == 0 ) { //end of file
-					{ IOFlags flags; gio::read( SchdFile, fmtA, flags ) >> LineIn; read_stat = flags.ios(); }
+					if ( nextLine < schdFileLines.size() ) {
+						LineIn = schdFileLines[ nextLine++ ];
+					} else {
+						LineIn.clear();
+						read_stat = -1;
+					}
 					++rowCnt;
 					colCnt = 0;
 					wordStart = 0;
@@ -1561,7 +1627,6 @@ namespace ScheduleManager {
 					hourlyFileValues( rowCnt ) = columnValue;
 					if ( rowCnt == rowLimitCount ) break;
 				}
-				gio::close( SchdFile );
 
 				// schedule values have been filled into the hourlyFileValues array.
 
@@ -1588,21 +1653,12 @@ namespace ScheduleManager {
 					++hDay;
 					if ( iDay > 366 ) break;
 					ExtraField = RoundSigDigits( iDay );
-					// increment both since a week schedule is being defined for each day so that a day is valid
+					// a week schedule is defined for each day so that a day is valid
 					// no matter what the day type that is used in a design day.
-					++AddWeekSch;
 					++AddDaySch;
-					// define week schedule
-					WeekSchedule( AddWeekSch ).Name = Alphas( 1 ) + "_wk_" + ExtraField;
-					// for all day types point the week schedule to the newly defined day schedule
-					for ( kDayType = 1; kDayType <= MaxDayTypes; ++kDayType ) {
-						WeekSchedule( AddWeekSch ).DaySchedulePointer( kDayType ) = AddDaySch;
-					}
 					// day schedule
 					DaySchedule( AddDaySch ).Name = Alphas( 1 ) + "_dy_" + ExtraField;
 					DaySchedule( AddDaySch ).ScheduleTypePtr = Schedule( SchNum ).ScheduleTypePtr;
-					// schedule is pointing to the week schedule
-					Schedule( SchNum ).WeekSchedulePointer( iDay ) = AddWeekSch;
 					if ( MinutesPerItem == 60 ) {
 						for ( jHour = 1; jHour <= 24; ++jHour ) {
 							++ifld;
@@ -1642,6 +1698,20 @@ namespace ScheduleManager {
 							}
 						}
 					}
+					// files commonly repeat the same day profile, share it and give back the slot
+					SharedDaySch = ShareDaySchedule( AddDaySch );
+					if ( SharedDaySch != AddDaySch ) --AddDaySch;
+					++AddWeekSch;
+					// define week schedule
+					WeekSchedule( AddWeekSch ).Name = Alphas( 1 ) + "_wk_" + ExtraField;
+					// for all day types point the week schedule to the newly defined day schedule
+					for ( kDayType = 1; kDayType <= MaxDayTypes; ++kDayType ) {
+						WeekSchedule( AddWeekSch ).DaySchedulePointer( kDayType ) = SharedDaySch;
+					}
+					SharedWeekSch = ShareWeekSchedule( AddWeekSch );
+					if ( SharedWeekSch != AddWeekSch ) --AddWeekSch;
+					// schedule is pointing to the week schedule
+					Schedule( SchNum ).WeekSchedulePointer( iDay ) = SharedWeekSch;
 					if ( iDay == 59 && rowCnt < 8784 * hrLimitCount ) { // 28 Feb
 						// Dup 28 Feb to 29 Feb (60)
 						++iDay;
@@ -1669,7 +1739,7 @@ namespace ScheduleManager {
 			IsBlank = false;
 			VerifyName( Alphas( 1 ), Schedule( {1,NumSchedules} ), SchNum, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			++SchNum;
@@ -1688,21 +1758,25 @@ namespace ScheduleManager {
 					Schedule( SchNum ).ScheduleTypePtr = CheckIndex;
 				}
 			}
-			++AddWeekSch;
 			++AddDaySch;
+			// day schedule
+			DaySchedule( AddDaySch ).Name = Alphas( 1 ) + "_dy_";
+			DaySchedule( AddDaySch ).ScheduleTypePtr = Schedule( SchNum ).ScheduleTypePtr;
+			curHrVal = Numbers( 1 );
+			DaySchedule( AddDaySch ).TSValue = Numbers( 1 );
+			SharedDaySch = ShareDaySchedule( AddDaySch );
+			if ( SharedDaySch != AddDaySch ) --AddDaySch;
+			++AddWeekSch;
 			// define week schedule
 			WeekSchedule( AddWeekSch ).Name = Alphas( 1 ) + "_wk_";
 			// for all day types point the week schedule to the newly defined day schedule
 			for ( kDayType = 1; kDayType <= MaxDayTypes; ++kDayType ) {
-				WeekSchedule( AddWeekSch ).DaySchedulePointer( kDayType ) = AddDaySch;
+				WeekSchedule( AddWeekSch ).DaySchedulePointer( kDayType ) = SharedDaySch;
 			}
-			// day schedule
-			DaySchedule( AddDaySch ).Name = Alphas( 1 ) + "_dy_";
-			DaySchedule( AddDaySch ).ScheduleTypePtr = Schedule( SchNum ).ScheduleTypePtr;
+			SharedWeekSch = ShareWeekSchedule( AddWeekSch );
+			if ( SharedWeekSch != AddWeekSch ) --AddWeekSch;
 			// schedule is pointing to the week schedule
-			Schedule( SchNum ).WeekSchedulePointer = AddWeekSch;
-			curHrVal = Numbers( 1 );
-			DaySchedule( AddDaySch ).TSValue = Numbers( 1 );
+			Schedule( SchNum ).WeekSchedulePointer = SharedWeekSch;
 
 			if ( AnyEnergyManagementSystemInModel ) { // setup constant schedules as actuators
 				SetupEMSActuator( "Schedule:Constant", Schedule( SchNum ).Name, "Schedule Value", "[ ]", Schedule( SchNum ).EMSActuatedOn, Schedule( SchNum ).EMSValue );
@@ -1718,7 +1792,7 @@ namespace ScheduleManager {
 
 			VerifyName( Alphas( 1 ), Schedule( {1,NumSchedules} ), SchNum, IsNotOK, IsBlank, CurrentModuleObject + " Name" ); // Bug fix
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			++SchNum;
@@ -1772,7 +1846,7 @@ namespace ScheduleManager {
 				VerifyName( Alphas( 1 ), Schedule( {1,NumSchedules} ), SchNum, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			}
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 			// END IF
@@ -1828,7 +1902,7 @@ namespace ScheduleManager {
 				VerifyName( Alphas( 1 ), Schedule( {1,NumSchedules} ), SchNum, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			}
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				ProcessScheduleInputErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
 
@@ -1870,6 +1944,29 @@ namespace ScheduleManager {
 
 		}
 
+		// Generated day and week schedules that were shared with identical profiles left their slots unused.
+		// The used schedules are moved to new arrays: shrinking in place would keep the unused slots as
+		// spare capacity that a later allocate (schedule input processed again) reuses without constructing.
+		if ( AddDaySch < NumDaySchedules ) {
+			NumDaySchedules = AddDaySch;
+			Array1D< DayScheduleData > UsedDaySchedules( {0,NumDaySchedules} );
+			for ( LoopIndex = 0; LoopIndex <= NumDaySchedules; ++LoopIndex ) {
+				UsedDaySchedules( LoopIndex ) = std::move( DaySchedule( LoopIndex ) );
+			}
+			DaySchedule.swap( UsedDaySchedules );
+		}
+		if ( AddWeekSch < NumWeekSchedules ) {
+			NumWeekSchedules = AddWeekSch;
+			Array1D< WeekScheduleData > UsedWeekSchedules( {0,NumWeekSchedules} );
+			for ( LoopIndex = 0; LoopIndex <= NumWeekSchedules; ++LoopIndex ) {
+				UsedWeekSchedules( LoopIndex ) = std::move( WeekSchedule( LoopIndex ) );
+			}
+			WeekSchedule.swap( UsedWeekSchedules );
+		}
+		GeneratedDaySchedules.clear();
+		GeneratedWeekSchedules.clear();
+		ScheduleFileLines.clear();
+
 		// Validate by ScheduleLimitsType
 		for ( SchNum = 1; SchNum <= NumSchedules; ++SchNum ) {
 			NumPointer = Schedule( SchNum ).ScheduleTypePtr;
@@ -1877,10 +1974,10 @@ namespace ScheduleManager {
 			if ( CheckScheduleValueMinMax( SchNum, ">=", ScheduleType( NumPointer ).Minimum, "<=", ScheduleType( NumPointer ).Maximum ) ) continue;
 			ShowSevereError( RoutineName + "Schedule=\"" + Schedule( SchNum ).Name + "\" has values outside its Schedule Type (" + ScheduleType( NumPointer ).Name + ") range" );
 			ShowContinueError( "  Minimum should be >=" + RoundSigDigits( ScheduleType( NumPointer ).Minimum, 3 ) + " and Maximum should be <=" + RoundSigDigits( ScheduleType( NumPointer ).Maximum, 3 ) );
-			ErrorsFound = true;
+			ProcessScheduleInputErrorsFound = true;
 		}
 
-		if ( ErrorsFound ) {
+		if ( ProcessScheduleInputErrorsFound ) {
 			ShowFatalError( RoutineName + "Preceding Errors cause termination." );
 		}
 
@@ -1929,6 +2026,77 @@ namespace ScheduleManager {
 
 	}
 
+	int
+	ShareDaySchedule( int const DayScheduleIndex ) // Day schedule generated from compact, file or constant input
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Large generated models carry thousands of Schedule:Compact and Schedule:File day profiles that are
+		// identical.  This function returns the index of a previously generated day schedule with the same
+		// schedule type, interpolation and timestep values, so that the caller can point to it instead.
+
+		// METHODOLOGY EMPLOYED:
+		// Generated day schedules are hash-consed on their contents.  When a match is found, the slot of
+		// DayScheduleIndex is reset so the caller can reuse it for the next generated day schedule.
+		// Otherwise DayScheduleIndex is entered in the pool and returned.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		auto & thisDay( DaySchedule( DayScheduleIndex ) );
+		std::size_t hash( std::hash< int >()( thisDay.ScheduleTypePtr ) );
+		for ( std::size_t l = 0, e = thisDay.TSValue.size(); l < e; ++l ) {
+			hash ^= std::hash< Real64 >()( thisDay.TSValue[ l ] ) + 0x9e3779b9 + ( hash << 6 ) + ( hash >> 2 );
+		}
+
+		auto & sameHash( GeneratedDaySchedules[ hash ] );
+		for ( int const otherDayIndex : sameHash ) {
+			auto & otherDay( DaySchedule( otherDayIndex ) );
+			if ( otherDay.ScheduleTypePtr != thisDay.ScheduleTypePtr ) continue;
+			if ( otherDay.IntervalInterpolated != thisDay.IntervalInterpolated ) continue;
+			if ( any_ne( otherDay.TSValue, thisDay.TSValue ) ) continue;
+			otherDay.Used = otherDay.Used || thisDay.Used;
+			thisDay.Name.clear();
+			thisDay.ScheduleTypePtr = 0;
+			thisDay.IntervalInterpolated = false;
+			thisDay.Used = false;
+			thisDay.TSValue = 0.0;
+			return otherDayIndex;
+		}
+		sameHash.push_back( DayScheduleIndex );
+		return DayScheduleIndex;
+
+	}
+
+	int
+	ShareWeekSchedule( int const WeekScheduleIndex ) // Week schedule generated from compact, file or constant input
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Counterpart of ShareDaySchedule for the week schedules generated from Schedule:Compact "Through"
+		// fields and from each day of a Schedule:File.  Returns the index of a previously generated week
+		// schedule pointing to the same day schedules, or WeekScheduleIndex if there is none.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		auto & thisWeek( WeekSchedule( WeekScheduleIndex ) );
+		std::size_t hash( 0 );
+		for ( int DayT = 1; DayT <= MaxDayTypes; ++DayT ) {
+			hash ^= std::hash< int >()( thisWeek.DaySchedulePointer( DayT ) ) + 0x9e3779b9 + ( hash << 6 ) + ( hash >> 2 );
+		}
+
+		auto & sameHash( GeneratedWeekSchedules[ hash ] );
+		for ( int const otherWeekIndex : sameHash ) {
+			auto & otherWeek( WeekSchedule( otherWeekIndex ) );
+			if ( any_ne( otherWeek.DaySchedulePointer, thisWeek.DaySchedulePointer ) ) continue;
+			otherWeek.Used = otherWeek.Used || thisWeek.Used;
+			thisWeek.Name.clear();
+			thisWeek.Used = false;
+			thisWeek.DaySchedulePointer = 0;
+			return otherWeekIndex;
+		}
+		sameHash.push_back( WeekScheduleIndex );
+		return WeekScheduleIndex;
+
+	}
+
 	void
 	ReportScheduleDetails( int const LevelOfDetail ) // =1: hourly; =2: timestep; = 3: make IDF excerpt
 	{
@@ -4540,7 +4708,6 @@ namespace ScheduleManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ScheduleIndex;
 		int WhichHour;
-		static bool DoScheduleReportingSetup( true );
 		int WeekSchedulePointer;
 		int DaySchedulePointer;
 
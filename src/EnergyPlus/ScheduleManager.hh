@@ -217,6 +217,12 @@ namespace ScheduleManager {
 	void
 	ProcessScheduleInput();
 
+	int
+	ShareDaySchedule( int const DayScheduleIndex ); // Day schedule generated from compact, file or constant input
+
+	int
+	ShareWeekSchedule( int const WeekScheduleIndex ); // Week schedule generated from compact, file or constant input
+
 	void
 	ReportScheduleDetails( int const LevelOfDetail ); // =1: hourly; =2: timestep; = 3: make IDF excerpt
 
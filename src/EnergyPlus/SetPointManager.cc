@@ -330,6 +330,31 @@ namespace SetPointManager {
 		Real64 DCESPMCurrentLoad_Watts( 0.0 );
 		Real64 DCESPMCondInletTemp( 0.0 );
 		Real64 DCESPMEvapOutletTemp( 0.0 );
+		bool GetSetPointManagerInputsErrorsFound( false );
+		int MaxNumAlphas( 0 ); // argument for call to GetObjectDefMaxArgs
+		int MaxNumNumbers( 0 ); // argument for call to GetObjectDefMaxArgs
+		bool NodeListError( false );
+		bool NoSurfaceGroundTempObjWarning( true ); // This will cause a warning to be issued if no "surface" ground
+		bool NoShallowGroundTempObjWarning( true ); // This will cause a warning to be issued if no "shallow" ground
+		bool NoDeepGroundTempObjWarning( true ); // This will cause a warning to be issued if no "deep" ground
+		bool NoFCGroundTempObjWarning( true ); // This will cause a warning to be issued if no ground
+		bool MyEnvrnFlag( true ); // flag for init once at start of environment
+		bool InitSetPointManagersErrorsFound( false );
+		bool LookForFan( false );
+		int TypeNum( 0 );
+		int NumChiller( 0 );
+		int TypeOf_Num( 0 );
+		Real64 TSupNoHC( 0.0 ); // supply temperature with no heating or cooling
+		Real64 ExtrRateNoHC( 0.0 ); // the heating (>0) or cooling (<0) that can be done by supply air at TSupNoHC [W]
+		bool LocalSetPointCheckFailed( false );
+		Real64 CondWaterSetPoint( 0.0 ); // Condenser entering water temperature setpoint this timestep, C
+		Real64 EvapOutletTemp( 0.0 ); // Evaporator water outlet temperature (C)
+		Real64 CondTempLimit( 0.0 ); // Condenser entering water temperature setpoint lower limit
+		Real64 CurLoad( 0.0 ); // Current cooling load, W
+		Real64 TotEnergy( 0.0 ); // Totoal energy consumptions at this time step
+		Real64 TotEnergyPre( 0.0 ); // Totoal energy consumptions at the previous time step
+		bool RunSubOptCondEntTemp( false );
+		bool RunFinalOptCondEntTemp( false );
 	}
 	// temperature-based flow control manager
 	// Average Cooling Set Pt Mgr
@@ -465,6 +490,31 @@ namespace SetPointManager {
 		ReturnWaterResetChWSetPtMgr.deallocate(); // return water reset
 		ReturnWaterResetHWSetPtMgr.deallocate(); // hot-water return water reset
 
+		GetSetPointManagerInputsErrorsFound = false;
+		MaxNumAlphas = 0;
+		MaxNumNumbers = 0;
+		NodeListError = false;
+		NoSurfaceGroundTempObjWarning = true;
+		NoShallowGroundTempObjWarning = true;
+		NoDeepGroundTempObjWarning = true;
+		NoFCGroundTempObjWarning = true;
+		MyEnvrnFlag = true;
+		InitSetPointManagersErrorsFound = false;
+		LookForFan = false;
+		TypeNum = 0;
+		NumChiller = 0;
+		TypeOf_Num = 0;
+		TSupNoHC = 0.0;
+		ExtrRateNoHC = 0.0;
+		LocalSetPointCheckFailed = false;
+		CondWaterSetPoint = 0.0;
+		EvapOutletTemp = 0.0;
+		CondTempLimit = 0.0;
+		CurLoad = 0.0;
+		TotEnergy = 0.0;
+		TotEnergyPre = 0.0;
+		RunSubOptCondEntTemp = false;
+		RunFinalOptCondEntTemp = false;
 	}
 
 	void
@@ -530,12 +580,11 @@ namespace SetPointManager {
 	GetSetPointManagerInputs()
 	{
 		// wrapper for GetInput to allow unit testing when fatal inputs are detected
-		static bool ErrorsFound( false );
 		static std::string const RoutineName( "GetSetPointManagerInputs: " ); // include trailing blank space
 
-		GetSetPointManagerInputData( ErrorsFound );
+		GetSetPointManagerInputData( GetSetPointManagerInputsErrorsFound );
 
-		if ( ErrorsFound ) {
+		if ( GetSetPointManagerInputsErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in input.  Program terminates." );
 		}
 
@@ -618,8 +667,6 @@ namespace SetPointManager {
 		Array1D_string cAlphaArgs;
 		Array1D< Real64 > rNumericArgs;
 		std::string cCurrentModuleObject;
-		static int MaxNumAlphas( 0 ); // argument for call to GetObjectDefMaxArgs
-		static int MaxNumNumbers( 0 ); // argument for call to GetObjectDefMaxArgs
 
 		int NumNums; // Number of real numbers returned by GetObjectItem
 		int NumAlphas; // Number of alphanumerics returned by GetObjectItem
@@ -635,16 +682,11 @@ namespace SetPointManager {
 		Array1D_int NodeNums;
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
-		static bool NodeListError( false );
 		bool ErrInList;
 		int Found;
-		static bool NoSurfaceGroundTempObjWarning( true ); // This will cause a warning to be issued if no "surface" ground
 		// temperature object was input.
-		static bool NoShallowGroundTempObjWarning( true ); // This will cause a warning to be issued if no "shallow" ground
 		// temperature object was input.
-		static bool NoDeepGroundTempObjWarning( true ); // This will cause a warning to be issued if no "deep" ground
 		// temperature object was input.
-		static bool NoFCGroundTempObjWarning( true ); // This will cause a warning to be issued if no ground
 		// temperature object was input for FC Factor method
 
 		NumNodesCtrld = 0;
@@ -3263,7 +3305,6 @@ namespace SetPointManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static bool MyEnvrnFlag( true ); // flag for init once at start of environment
 
 
 		int SetZoneNum;
@@ -3277,7 +3318,6 @@ namespace SetPointManager {
 		int AirLoopNum;
 		int LoopNum;
 		int LoopNum2;
-		static bool ErrorsFound( false );
 		int ConZoneNum;
 		int MixedAirNode;
 		int BranchNum;
@@ -3285,7 +3325,6 @@ namespace SetPointManager {
 		int InletBranchNum;
 		int CompNum;
 		int CompNum2;
-		static bool LookForFan( false );
 		std::string CompType;
 		std::string cSetPointManagerType;
 		int FanNodeIn;
@@ -3296,9 +3335,6 @@ namespace SetPointManager {
 		int ZonesCooledIndex; // Cooled zones index in an air loop
 		int BranchNumPlantSide;
 		int CompNumPlantSide;
-		static int TypeNum( 0 );
-		static int NumChiller( 0 );
-		static int TypeOf_Num( 0 );
 
 		ManagerOn = true;
 
@@ -3324,7 +3360,7 @@ namespace SetPointManager {
 						if ( SZMinHumSetPtMgr( SetPtMgrNum ).CtrlZoneNum( SetZoneNum ) == 0 ) { // didn't find
 							ShowSevereError( cSetPointManagerType + "=\"" + SZMinHumSetPtMgr( SetPtMgrNum ).Name + "\", invalid zone" );
 							ShowContinueError( "could not find Controlled Zone=" + Zone( SZMinHumSetPtMgr( SetPtMgrNum ).ZoneNum( SetZoneNum ) ).Name );
-							ErrorsFound = true;
+							InitSetPointManagersErrorsFound = true;
 						} else {
 							// make sure humidity controlled zone
 							HstatZoneFound = false;
@@ -3336,7 +3372,7 @@ namespace SetPointManager {
 							if ( ! HstatZoneFound ) {
 								ShowSevereError( cSetPointManagerType + "=\"" + SZMinHumSetPtMgr( SetPtMgrNum ).Name + "\", invalid humidistat specification" );
 								ShowContinueError( "could not locate Humidistat in Zone=" + Zone( SZMinHumSetPtMgr( SetPtMgrNum ).ZoneNum( SetZoneNum ) ).Name );
-								ErrorsFound = true;
+								InitSetPointManagersErrorsFound = true;
 							}
 						}
 					}
@@ -3358,7 +3394,7 @@ namespace SetPointManager {
 						if ( SZMaxHumSetPtMgr( SetPtMgrNum ).CtrlZoneNum( SetZoneNum ) == 0 ) { // didn't find
 							ShowSevereError( cSetPointManagerType + "=\"" + SZMaxHumSetPtMgr( SetPtMgrNum ).Name + "\", invalid zone" );
 							ShowContinueError( "could not find Controlled Zone=" + Zone( SZMaxHumSetPtMgr( SetPtMgrNum ).ZoneNum( SetZoneNum ) ).Name );
-							ErrorsFound = true;
+							InitSetPointManagersErrorsFound = true;
 						} else {
 							// make sure humidity controlled zone
 							HstatZoneFound = false;
@@ -3370,7 +3406,7 @@ namespace SetPointManager {
 							if ( ! HstatZoneFound ) {
 								ShowSevereError( cSetPointManagerType + "=\"" + SZMaxHumSetPtMgr( SetPtMgrNum ).Name + "\", invalid humidistat specification" );
 								ShowContinueError( "could not locate Humidistat in Zone=" + Zone( SZMaxHumSetPtMgr( SetPtMgrNum ).ZoneNum( SetZoneNum ) ).Name );
-								ErrorsFound = true;
+								InitSetPointManagersErrorsFound = true;
 							}
 						}
 					}
@@ -3398,13 +3434,13 @@ namespace SetPointManager {
 					if ( ConZoneNum == 0 ) {
 						ShowSevereError( cSetPointManagerType + "=\"" + SingZoneRhSetPtMgr( SetPtMgrNum ).Name + "\", Zone Node not found:" );
 						ShowContinueError( "Node=\"" + NodeID( SingZoneRhSetPtMgr( SetPtMgrNum ).ZoneNodeNum ) + "\", not found in any controlled Zone" );
-						ErrorsFound = true;
+						InitSetPointManagersErrorsFound = true;
 					} else {
 						AirLoopNum = ZoneEquipConfig( ConZoneNum ).AirLoopNum;
 						if ( AirLoopNum == 0 ) {
 							ShowSevereError( cSetPointManagerType + "=\"" + SingZoneRhSetPtMgr( SetPtMgrNum ).Name + "\", Zone not on air loop:" );
 							ShowContinueError( "Controlled Zone not on air loop, Zone=" + ZoneEquipConfig( ConZoneNum ).ZoneName );
-							ErrorsFound = true;
+							InitSetPointManagersErrorsFound = true;
 							continue;
 						}
 						MixedAirNode = PrimaryAirSystem( AirLoopNum ).OASysOutletNodeNum;
@@ -3460,19 +3496,19 @@ namespace SetPointManager {
 						if ( AirLoopNum == 0 ) {
 							ShowSevereError( cSetPointManagerType + "=\"" + WarmestSetPtMgr( SetPtMgrNum ).Name + "\", invalid Air Loop specified:" );
 							ShowContinueError( "Air Loop not found =\"" + WarmestSetPtMgr( SetPtMgrNum ).AirLoopName + "\"." );
-							ErrorsFound = true;
+							InitSetPointManagersErrorsFound = true;
 						} else {
 							WarmestSetPtMgr( SetPtMgrNum ).AirLoopNum = AirLoopNum;
 						}
 						if ( AirToZoneNodeInfo( AirLoopNum ).NumZonesCooled == 0 ) {
 							ShowSevereError( cSetPointManagerType + "=\"" + WarmestSetPtMgr( SetPtMgrNum ).Name + "\", no zones with cooling found:" );
 							ShowContinueError( "Air Loop provides no cooling, Air Loop=\"" + WarmestSetPtMgr( SetPtMgrNum ).AirLoopName + "\"." );
-							ErrorsFound = true;
+							InitSetPointManagersErrorsFound = true;
 						}
 					} else {
 						ShowSevereError( cSetPointManagerType + "=\"" + WarmestSetPtMgr( SetPtMgrNum ).Name + "\", no AirLoopHVAC objects found:" );
 						ShowContinueError( "Setpoint Manager needs an AirLoopHVAC to operate." );
-						ErrorsFound = true;
+						InitSetPointManagersErrorsFound = true;
 					}
 				}
 
@@ -3484,19 +3520,19 @@ namespace SetPointManager {
 						if ( AirLoopNum == 0 ) {
 							ShowSevereError( cSetPointManagerType + "=\"" + ColdestSetPtMgr( SetPtMgrNum ).Name + "\", invalid Air Loop specified:" );
 							ShowContinueError( "Air Loop not found =\"" + ColdestSetPtMgr( SetPtMgrNum ).AirLoopName + "\"." );
-							ErrorsFound = true;
+							InitSetPointManagersErrorsFound = true;
 						} else {
 							ColdestSetPtMgr( SetPtMgrNum ).AirLoopNum = AirLoopNum;
 						}
 						if ( AirToZoneNodeInfo( AirLoopNum ).NumZonesHeated == 0 ) {
 							ShowSevereError( cSetPointManagerType + "=\"" + ColdestSetPtMgr( SetPtMgrNum ).Name + "\", no zones with heating found:" );
 							ShowContinueError( "Air Loop provides no heating, Air Loop=\"" + ColdestSetPtMgr( SetPtMgrNum ).AirLoopName + "\"." );
-							ErrorsFound = true;
+							InitSetPointManagersErrorsFound = true;
 						}
 					} else {
 						ShowSevereError( cSetPointManagerType + "=\"" + ColdestSetPtMgr( SetPtMgrNum ).Name + "\", no AirLoopHVAC objects found:" );
 						ShowContinueError( "Setpoint Manager needs an AirLoopHVAC to operate." );
-						ErrorsFound = true;
+						InitSetPointManagersErrorsFound = true;
 					}
 				}
 
@@ -3508,7 +3544,7 @@ namespace SetPointManager {
 						if ( AirLoopNum == 0 ) {
 							ShowSevereError( cSetPointManagerType + "=\"" + WarmestSetPtMgrTempFlow( SetPtMgrNum ).Name + "\", invalid Air Loop specified:" );
 							ShowContinueError( "Air Loop not found =\"" + WarmestSetPtMgrTempFlow( SetPtMgrNum ).AirLoopName + "\"." );
-							ErrorsFound = true;
+							InitSetPointManagersErrorsFound = true;
 						} else {
 							WarmestSetPtMgrTempFlow( SetPtMgrNum ).AirLoopNum = AirLoopNum;
 							WarmestSetPtMgrTempFlow( SetPtMgrNum ).SimReady = true;
@@ -3516,12 +3552,12 @@ namespace SetPointManager {
 						if ( AirToZoneNodeInfo( AirLoopNum ).NumZonesCooled == 0 ) {
 							ShowSevereError( cSetPointManagerType + "=\"" + WarmestSetPtMgrTempFlow( SetPtMgrNum ).Name + "\", no zones with cooling found:" );
 							ShowContinueError( "Air Loop provides no cooling, Air Loop=\"" + WarmestSetPtMgrTempFlow( SetPtMgrNum ).AirLoopName + "\"." );
-							ErrorsFound = true;
+							InitSetPointManagersErrorsFound = true;
 						}
 					} else {
 						ShowSevereError( cSetPointManagerType + "=\"" + WarmestSetPtMgrTempFlow( SetPtMgrNum ).Name + "\", no AirLoopHVAC objects found:" );
 						ShowContinueError( "Setpoint Manager needs an AirLoopHVAC to operate." );
-						ErrorsFound = true;
+						InitSetPointManagersErrorsFound = true;
 					}
 				}
 
@@ -3535,7 +3571,7 @@ namespace SetPointManager {
 						if ( AirLoopNum == 0 ) {
 							ShowSevereError( cSetPointManagerType + "=\"" + RABFlowSetPtMgr( SetPtMgrNum ).Name + "\", invalid Air Loop specified:" );
 							ShowContinueError( "Air Loop not found =\"" + RABFlowSetPtMgr( SetPtMgrNum ).AirLoopName + "\"." );
-							ErrorsFound = true;
+							InitSetPointManagersErrorsFound = true;
 						} else {
 							RABFlowSetPtMgr( SetPtMgrNum ).AirLoopNum = AirLoopNum;
 							if ( PrimaryAirSystem( AirLoopNum ).RABExists ) {
@@ -3549,13 +3585,13 @@ namespace SetPointManager {
 							} else {
 								ShowSevereError( cSetPointManagerType + "=\"" + RABFlowSetPtMgr( SetPtMgrNum ).Name + "\", no RAB in air loop found:" );
 								ShowContinueError( "Air Loop=\"" + RABFlowSetPtMgr( SetPtMgrNum ).AirLoopName + "\"." );
-								ErrorsFound = true;
+								InitSetPointManagersErrorsFound = true;
 							}
 						}
 					} else {
 						ShowSevereError( cSetPointManagerType + "=\"" + RABFlowSetPtMgr( SetPtMgrNum ).Name + "\", no AirLoopHVAC objects found:" );
 						ShowContinueError( "Setpoint Manager needs an AirLoopHVAC to operate." );
-						ErrorsFound = true;
+						InitSetPointManagersErrorsFound = true;
 					}
 				}
 
@@ -3567,19 +3603,19 @@ namespace SetPointManager {
 						if ( AirLoopNum == 0 ) {
 							ShowSevereError( cSetPointManagerType + "=\"" + MZAverageCoolingSetPtMgr( SetPtMgrNum ).Name + "\", invalid Air Loop specified:" );
 							ShowContinueError( "Air Loop not found =\"" + MZAverageCoolingSetPtMgr( SetPtMgrNum ).AirLoopName + "\"." );
-							ErrorsFound = true;
+							InitSetPointManagersErrorsFound = true;
 						} else {
 							MZAverageCoolingSetPtMgr( SetPtMgrNum ).AirLoopNum = AirLoopNum;
 						}
 						if ( AirToZoneNodeInfo( AirLoopNum ).NumZonesCooled == 0 ) {
 							ShowSevereError( cSetPointManagerType + "=\"" + MZAverageCoolingSetPtMgr( SetPtMgrNum ).Name + "\", no zones with cooling found:" );
 							ShowContinueError( "Air Loop provides no cooling, Air Loop=\"" + MZAverageCoolingSetPtMgr( SetPtMgrNum ).AirLoopName + "\"." );
-							ErrorsFound = true;
+							InitSetPointManagersErrorsFound = true;
 						}
 					} else {
 						ShowSevereError( cSetPointManagerType + "=\"" + MZAverageCoolingSetPtMgr( SetPtMgrNum ).Name + "\", no AirLoopHVAC objects found:" );
 						ShowContinueError( "Setpoint Manager needs an AirLoopHVAC to operate." );
-						ErrorsFound = true;
+						InitSetPointManagersErrorsFound = true;
 					}
 				}
 
@@ -3591,7 +3627,7 @@ namespace SetPointManager {
 						if ( AirLoopNum == 0 ) {
 							ShowSevereError( cSetPointManagerType + "=\"" + MZAverageHeatingSetPtMgr( SetPtMgrNum ).Name + "\", invalid Air Loop specified:" );
 							ShowContinueError( "Air Loop not found =\"" + MZAverageHeatingSetPtMgr( SetPtMgrNum ).AirLoopName + "\"." );
-							ErrorsFound = true;
+							InitSetPointManagersErrorsFound = true;
 						} else {
 							MZAverageHeatingSetPtMgr( SetPtMgrNum ).AirLoopNum = AirLoopNum;
 						}
@@ -3605,7 +3641,7 @@ namespace SetPointManager {
 					} else {
 						ShowSevereError( cSetPointManagerType + "=\"" + MZAverageHeatingSetPtMgr( SetPtMgrNum ).Name + "\", no AirLoopHVAC objects found:" );
 						ShowContinueError( "Setpoint Manager needs an AirLoopHVAC to operate." );
-						ErrorsFound = true;
+						InitSetPointManagersErrorsFound = true;
 					}
 				}
 
@@ -3617,7 +3653,7 @@ namespace SetPointManager {
 						if ( AirLoopNum == 0 ) {
 							ShowSevereError( cSetPointManagerType + "=\"" + MZAverageMinHumSetPtMgr( SetPtMgrNum ).Name + "\", invalid Air Loop specified:" );
 							ShowContinueError( "Air Loop not found =\"" + MZAverageMinHumSetPtMgr( SetPtMgrNum ).AirLoopName + "\"." );
-							ErrorsFound = true;
+							InitSetPointManagersErrorsFound = true;
 						} else {
 							MZAverageMinHumSetPtMgr( SetPtMgrNum ).AirLoopNum = AirLoopNum;
 							// make sure humidity controlled zone
@@ -3632,13 +3668,13 @@ namespace SetPointManager {
 							if ( ! HstatZoneFound ) {
 								ShowSevereError( cSetPointManagerType + "=\"" + MZAverageMinHumSetPtMgr( SetPtMgrNum ).Name + "\", invalid humidistat specification" );
 								ShowContinueError( "could not locate Humidistat in any of the zones served by the Air loop=" + PrimaryAirSystem( AirLoopNum ).Name );
-								ErrorsFound = true;
+								InitSetPointManagersErrorsFound = true;
 							}
 						}
 					} else {
 						ShowSevereError( cSetPointManagerType + "=\"" + MZAverageMinHumSetPtMgr( SetPtMgrNum ).Name + "\", no AirLoopHVAC objects found:" );
 						ShowContinueError( "Setpoint Manager needs an AirLoopHVAC to operate." );
-						ErrorsFound = true;
+						InitSetPointManagersErrorsFound = true;
 					}
 				}
 
@@ -3650,7 +3686,7 @@ namespace SetPointManager {
 						if ( AirLoopNum == 0 ) {
 							ShowSevereError( cSetPointManagerType + "=\"" + MZAverageMaxHumSetPtMgr( SetPtMgrNum ).Name + "\", invalid Air Loop specified:" );
 							ShowContinueError( "Air Loop not found =\"" + MZAverageMaxHumSetPtMgr( SetPtMgrNum ).AirLoopName + "\"." );
-							ErrorsFound = true;
+							InitSetPointManagersErrorsFound = true;
 						} else {
 							MZAverageMaxHumSetPtMgr( SetPtMgrNum ).AirLoopNum = AirLoopNum;
 							// make sure humidity controlled zone
@@ -3665,13 +3701,13 @@ namespace SetPointManager {
 							if ( ! HstatZoneFound ) {
 								ShowSevereError( cSetPointManagerType + "=\"" + MZAverageMaxHumSetPtMgr( SetPtMgrNum ).Name + "\", invalid humidistat specification" );
 								ShowContinueError( "could not locate Humidistat in any of the zones served by the Air loop=" + PrimaryAirSystem( AirLoopNum ).Name );
-								ErrorsFound = true;
+								InitSetPointManagersErrorsFound = true;
 							}
 						}
 					} else {
 						ShowSevereError( cSetPointManagerType + "=\"" + MZAverageMaxHumSetPtMgr( SetPtMgrNum ).Name + "\", no AirLoopHVAC objects found:" );
 						ShowContinueError( "Setpoint Manager needs an AirLoopHVAC to operate." );
-						ErrorsFound = true;
+						InitSetPointManagersErrorsFound = true;
 					}
 				}
 
@@ -3683,7 +3719,7 @@ namespace SetPointManager {
 						if ( AirLoopNum == 0 ) {
 							ShowSevereError( cSetPointManagerType + "=\"" + MZMinHumSetPtMgr( SetPtMgrNum ).Name + "\", invalid Air Loop specified:" );
 							ShowContinueError( "Air Loop not found =\"" + MZMinHumSetPtMgr( SetPtMgrNum ).AirLoopName + "\"." );
-							ErrorsFound = true;
+							InitSetPointManagersErrorsFound = true;
 						} else {
 							MZMinHumSetPtMgr( SetPtMgrNum ).AirLoopNum = AirLoopNum;
 							// make sure humidity controlled zone
@@ -3698,13 +3734,13 @@ namespace SetPointManager {
 							if ( ! HstatZoneFound ) {
 								ShowSevereError( cSetPointManagerType + "=\"" + MZMinHumSetPtMgr( SetPtMgrNum ).Name + "\", invalid humidistat specification" );
 								ShowContinueError( "could not locate Humidistat in any of the zones served by the Air loop=" + PrimaryAirSystem( AirLoopNum ).Name );
-								ErrorsFound = true;
+								InitSetPointManagersErrorsFound = true;
 							}
 						}
 					} else {
 						ShowSevereError( cSetPointManagerType + "=\"" + MZMinHumSetPtMgr( SetPtMgrNum ).Name + "\", no AirLoopHVAC objects found:" );
 						ShowContinueError( "Setpoint Manager needs an AirLoopHVAC to operate." );
-						ErrorsFound = true;
+						InitSetPointManagersErrorsFound = true;
 					}
 				}
 
@@ -3716,7 +3752,7 @@ namespace SetPointManager {
 						if ( AirLoopNum == 0 ) {
 							ShowSevereError( cSetPointManagerType + "=\"" + MZMaxHumSetPtMgr( SetPtMgrNum ).Name + "\", invalid Air Loop specified:" );
 							ShowContinueError( "Air Loop not found =\"" + MZMaxHumSetPtMgr( SetPtMgrNum ).AirLoopName + "\"." );
-							ErrorsFound = true;
+							InitSetPointManagersErrorsFound = true;
 						} else {
 							MZMaxHumSetPtMgr( SetPtMgrNum ).AirLoopNum = AirLoopNum;
 							// make sure humidity controlled zone
@@ -3731,13 +3767,13 @@ namespace SetPointManager {
 							if ( ! HstatZoneFound ) {
 								ShowSevereError( cSetPointManagerType + "=\"" + MZMaxHumSetPtMgr( SetPtMgrNum ).Name + "\", invalid humidistat specification" );
 								ShowContinueError( "could not locate Humidistat in any of the zones served by the Air loop=" + PrimaryAirSystem( AirLoopNum ).Name );
-								ErrorsFound = true;
+								InitSetPointManagersErrorsFound = true;
 							}
 						}
 					} else {
 						ShowSevereError( cSetPointManagerType + "=\"" + MZMaxHumSetPtMgr( SetPtMgrNum ).Name + "\", no AirLoopHVAC objects found:" );
 						ShowContinueError( "Setpoint Manager needs an AirLoopHVAC to operate." );
-						ErrorsFound = true;
+						InitSetPointManagersErrorsFound = true;
 					}
 				}
 
@@ -3756,7 +3792,7 @@ namespace SetPointManager {
 											ShowSevereError( cSetPointManagerType + "=\"" + CondEntSetPtMgr( SetPtMgrNum ).Name + "\", invalid tower found" );
 											ShowContinueError( "Found SingleSpeed Cooling Tower, Cooling Tower=" + PlantLoop( LoopNum ).LoopSide( SupplySide ).Branch( BranchNum ).Comp( CompNum ).Name );
 											ShowContinueError( "SingleSpeed cooling towers cannot be used with this setpoint manager." );
-											ErrorsFound = true;
+											InitSetPointManagersErrorsFound = true;
 										}
 									}
 								}
@@ -3806,7 +3842,7 @@ namespace SetPointManager {
 											ShowSevereError( cSetPointManagerType + "=\"" + IdealCondEntSetPtMgr( SetPtMgrNum ).Name + "\", invalid cooling tower found" );
 											ShowContinueError( "Found Single Speed Cooling Tower, Cooling Tower=" + PlantLoop( LoopNum ).LoopSide( SupplySide ).Branch( BranchNum ).Comp( CompNum ).Name );
 											ShowContinueError( "SingleSpeed cooling towers cannot be used with this setpoint manager on each loop" );
-											ErrorsFound = true;
+											InitSetPointManagersErrorsFound = true;
 										} else if ( TypeOf_Num == TypeOf_CoolingTower_TwoSpd || TypeOf_Num == TypeOf_CoolingTower_VarSpd ) {
 											IdealCondEntSetPtMgr( SetPtMgrNum ).CondTowerBranchNum.push_back( BranchNum );
 											IdealCondEntSetPtMgr( SetPtMgrNum ).TowerNum.push_back( CompNum );
@@ -3853,7 +3889,7 @@ namespace SetPointManager {
 												ShowSevereError( cSetPointManagerType + "=\"" + IdealCondEntSetPtMgr( SetPtMgrNum ).Name + "\", too many chillers found" );
 												ShowContinueError( "only one chiller can be used with this setpoint manager on each loop" );
 												ShowContinueError( "Found more than one chiller, chiller =" + PlantLoop( LoopNum ).LoopSide( DemandSide ).Branch( BranchNum ).Comp( CompNum ).Name );
-												ErrorsFound = true;
+												InitSetPointManagersErrorsFound = true;
 											}
 											IdealCondEntSetPtMgr( SetPtMgrNum ).TypeNum = TypeNum;
 											IdealCondEntSetPtMgr( SetPtMgrNum ).CondLoopNum = LoopNum;
@@ -3866,13 +3902,13 @@ namespace SetPointManager {
 					}
 				}
 
-				VerifySetPointManagers( ErrorsFound );
+				VerifySetPointManagers( InitSetPointManagersErrorsFound );
 
 			}
 
 			InitSetPointManagersOneTimeFlag = false;
 
-			if ( ErrorsFound ) {
+			if ( InitSetPointManagersErrorsFound ) {
 				ShowFatalError( "InitSetPointManagers: Errors found in getting SetPointManager input." );
 			}
 
@@ -4300,7 +4336,7 @@ namespace SetPointManager {
 			MyEnvrnFlag = false;
 			if ( ! InitSetPointManagersOneTimeFlag ) InitSetPointManagersOneTimeFlag2 = false;
 
-			if ( ErrorsFound ) {
+			if ( InitSetPointManagersErrorsFound ) {
 				ShowFatalError( "InitSetPointManagers: Errors found. Program Terminates." );
 			}
 
@@ -4807,14 +4843,12 @@ namespace SetPointManager {
 		int RetNode;
 		int OAMixOAInNode;
 		Real64 FanDeltaT;
-		static Real64 TSupNoHC( 0.0 ); // supply temperature with no heating or cooling
 		Real64 TMixAtMinOA;
 		Real64 EnthMixAtMinOA;
 		Real64 HumRatMixAtMinOA;
 		int AirLoopNum;
 		Real64 OAFrac;
 		int LoopInNode;
-		static Real64 ExtrRateNoHC( 0.0 ); // the heating (>0) or cooling (<0) that can be done by supply air at TSupNoHC [W]
 
 		ZoneInletNode = this->ZoneInletNodeNum;
 		ZoneNum = this->ControlZoneNum;
@@ -5413,7 +5447,6 @@ namespace SetPointManager {
 		Real64 MinSetPoint; // minimum allowed setpoint
 		Real64 MaxSetPoint; // maximum allowed setpoint
 		bool HumiditySetPoint; // logical to indicate if this is a humidity setpoint
-		static bool LocalSetPointCheckFailed( false );
 
 		RefNode = this->RefNode;
 		MixedOutNode = this->MixedOutNode;
@@ -6812,14 +6845,6 @@ namespace SetPointManager {
 		using DataLoopNode::Node;
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 CondWaterSetPoint( 0.0 ); // Condenser entering water temperature setpoint this timestep, C
-		static Real64 EvapOutletTemp( 0.0 ); // Evaporator water outlet temperature (C)
-		static Real64 CondTempLimit( 0.0 ); // Condenser entering water temperature setpoint lower limit
-		static Real64 CurLoad( 0.0 ); // Current cooling load, W
-		static Real64 TotEnergy( 0.0 ); // Totoal energy consumptions at this time step
-		static Real64 TotEnergyPre( 0.0 ); // Totoal energy consumptions at the previous time step
-		static bool RunSubOptCondEntTemp( false );
-		static bool RunFinalOptCondEntTemp( false );
 
 		if ( MetersHaveBeenInitialized ) {
 			// Setup meter vars
@@ -220,6 +220,85 @@ namespace SimAirServingZones {
 		bool InitAirLoopsBranchSizingFlag( true );
 		Array1D< Real64 > FaByZoneCool; // triggers allocation in UpdateSysSizing
 		Array1D< Real64 > SensCoolCapTemp; // triggers allocation in UpdateSysSizing
+		Array1D_string BranchNames; // Branch names from GetBranchList call
+		Array1D_string CompTypes; // Component types from GetBranchList call
+		Array1D_string CompNames; // Component names from GetBranchList call
+		Array1D_string InletNodeNames; // Component inlet node names from GetBranchData call
+		Array1D_string OutletNodeNames; // Component outlet node names from GetBranchData call
+		Array1D_string NodeNames; // Outlet node names from GetLoopSplitter call
+		Array1D_int NodeNumbers; // Outlet node numbers from GetLoopSplitter call
+		Array1D_int InletNodeNumbers; // Component inlet node numbers from GetBranchData call
+		Array1D_int OutletNodeNumbers; // Component outlet node numbers from GetBranchData call
+		bool ErrorsFound( false ); // TRUE if errors detected in input
+		Array1D_bool PackagedUnit;
+		int ConListNum( 0 ); // index of a Connector List object in the input
+		bool SplitterExists( false ); // TRUE if there is a slitter in a primary air system
+		bool MixerExists( false ); // TRUE if there is a mixer in a primary air system
+		Real64 SumZoneDesFlow( 0.0 ); // sum of the zone design air mass flow rates for zones served by a system
+		int TUInNode( 0 ); // inlet node number of a terminal unit
+		Real64 MassFlowSetToler;
+		Array1D_int CtrlZoneNumsCool;
+		Array1D_int CtrlZoneNumsHeat;
+		Array1D_int ZoneInletNodesCool;
+		Array1D_int ZoneInletNodesHeat;
+		Array1D_int TermInletNodesCool;
+		Array1D_int TermInletNodesHeat;
+		Array1D_int SupNode;
+		Array1D_int SupNodeType;
+		bool MyEnvrnFlag( true );
+		Real64 OAReliefDiff( 0.0 ); // local for massflow change across OA system, kg/s
+		Real64 SavedPreviousHVACTime( 0.0 );
+		int SimAirLoopsIterMax( 0 );
+		int SimAirLoopsIterTot( 0 );
+		int NumCallsTot( 0 );
+		int NumSkippedTot( 0 );
+		bool OutputSetupFlag( false );
+		int SimAirLoopIterMax( 0 );
+		int SimAirLoopIterTot( 0 );
+		int SimAirLoopNumCalls( 0 );
+		bool SimAirLoopAirLoopConvergedFlag( false );
+		bool DoWarmRestartFlag( false );
+		int WarmRestartStatus( DataHVACControllers::iControllerWarmRestartNone );
+		int Iter( 0 );
+		int ErrCount( 0 );
+		int MaxErrCount( 0 );
+		std::string ErrEnvironmentName;
+		bool SetUpSysSizingArraysErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		Real64 Ep( 1.0 ); // zone primary air fraction
+		Array1D< Real64 > EvBySysCool; // saved value of SysCoolingEv used in 62.1 tabular report
+		Array1D< Real64 > EvBySysHeat; // saved value of SysHeatingEv used in 62.1 tabular report
+		Real64 UpdateSysSizingEp( 1.0 ); // zone primary air fraction
+		Real64 Er( 0.0 ); // zone secondary recirculation fraction
+		Real64 Fa( 1.0 ); // temporary variable used in multi-path VRP calc
+		Array1D< Real64 > FaByZoneHeat; // saved value of Fa used in 62.1 tabular report
+		Real64 Fb( 1.0 ); // temporary variable used in multi-path VRP calc
+		Array1D< Real64 > FbByZoneCool; // saved value of Fb used in 62.1 tabular report
+		Array1D< Real64 > FbByZoneHeat; // saved value of Fb used in 62.1 tabular report
+		Real64 Fc( 1.0 ); // temporary variable used in multi-path VRP calc
+		Array1D< Real64 > FcByZoneCool; // saved value of Fc used in 62.1 tabular report
+		Array1D< Real64 > FcByZoneHeat; // saved value of Fc used in 62.1 tabular report
+		Real64 UpdateSysSizingXs( 1.0 ); // uncorrected system outdoor air fraction
+		Array1D< Real64 > XsBySysCool; // saved value of Xs used in 62.1 tabular report
+		Array1D< Real64 > XsBySysHeat; // saved value of Xs used in 62.1 tabular report
+		Array1D< Real64 > EvzByZoneCool; // saved value of Evz (zone vent effy) used in 62.1 tabular report
+		Array1D< Real64 > EvzByZoneHeat; // saved value of Evz (zone vent effy) used in 62.1 tabular report
+		Array1D< Real64 > EvzByZoneCoolPrev; // saved value of Evz (zone vent effy) used in 62.1 tabular report
+		Array1D< Real64 > EvzByZoneHeatPrev; // saved value of Evz (zone vent effy) used in 62.1 tabular report
+		Array1D< Real64 > VotClgBySys; // saved value of cooling ventilation required at primary AHU, used in 62.1 tabular report
+		Array1D< Real64 > VotHtgBySys; // saved value of heating ventilation required at primary AHU, used in 62.1 tabular report
+		Array1D< Real64 > VozSumClgBySys; // saved value of cooling ventilation required at clg zones
+		Array1D< Real64 > VozSumHtgBySys; // saved value of cooling ventilation required at htg zones
+		Array1D< Real64 > TotCoolCapTemp; // scratch variable used for calulating peak load [W]
+		Real64 MinHeatingEvz( 1.0 ); // minimum zone ventilation efficiency for heating (to be used as system efficiency)
+		Array1D< Real64 > EvzMinBySysHeat; // saved value of EvzMin used in 62.1 tabular report
+		Real64 MinCoolingEvz( 1.0 ); // minimum zone ventilation efficiency for cooling (to be used as system efficiency)
+		Array1D< Real64 > EvzMinBySysCool; // saved value of EvzMin used in 62.1 tabular report
+		Real64 ZoneOAFrac( 0.0 ); // zone OA fraction
+		Real64 ZoneEz( 1.0 ); // zone air distribution effectiveness
+		Real64 Vou( 0.0 ); // Uncorrected outdoor air intake for all zones per ASHRAE std 62.1
+		Real64 Vot( 0.0 ); // Required outdoor air intake at primary AHU per ASHRAE std 62.1
+		Real64 VotMax( 0.0 ); // Max of required cooling/heating outdoor air intake at primary AHU per ASHRAE std 62.1
+		Real64 Ratio( 1 ); // Ratio of VozBySys / VotMax
 	}
 	// Subroutine Specifications for the Module
 	// Driver/Manager Routines
@@ -247,6 +326,85 @@ namespace SimAirServingZones {
 		TestUniqueNodesNum = 0;
 		FaByZoneCool.deallocate(); // triggers allocation in UpdateSysSizing
 		SensCoolCapTemp.deallocate(); // triggers allocation in UpdateSysSizing
+		BranchNames.deallocate();
+		CompTypes.deallocate();
+		CompNames.deallocate();
+		InletNodeNames.deallocate();
+		OutletNodeNames.deallocate();
+		NodeNames.deallocate();
+		NodeNumbers.deallocate();
+		InletNodeNumbers.deallocate();
+		OutletNodeNumbers.deallocate();
+		ErrorsFound = false;
+		PackagedUnit.deallocate();
+		ConListNum = 0;
+		SplitterExists = false;
+		MixerExists = false;
+		SumZoneDesFlow = 0.0;
+		TUInNode = 0;
+		MassFlowSetToler = 0.0;
+		CtrlZoneNumsCool.deallocate();
+		CtrlZoneNumsHeat.deallocate();
+		ZoneInletNodesCool.deallocate();
+		ZoneInletNodesHeat.deallocate();
+		TermInletNodesCool.deallocate();
+		TermInletNodesHeat.deallocate();
+		SupNode.deallocate();
+		SupNodeType.deallocate();
+		MyEnvrnFlag = true;
+		OAReliefDiff = 0.0;
+		SavedPreviousHVACTime = 0.0;
+		SimAirLoopsIterMax = 0;
+		SimAirLoopsIterTot = 0;
+		NumCallsTot = 0;
+		NumSkippedTot = 0;
+		OutputSetupFlag = false;
+		SimAirLoopIterMax = 0;
+		SimAirLoopIterTot = 0;
+		SimAirLoopNumCalls = 0;
+		SimAirLoopAirLoopConvergedFlag = false;
+		DoWarmRestartFlag = false;
+		WarmRestartStatus = DataHVACControllers::iControllerWarmRestartNone;
+		Iter = 0;
+		ErrCount = 0;
+		MaxErrCount = 0;
+		ErrEnvironmentName.clear();
+		SetUpSysSizingArraysErrorsFound = false;
+		Ep = 1.0;
+		EvBySysCool.deallocate();
+		EvBySysHeat.deallocate();
+		UpdateSysSizingEp = 1.0;
+		Er = 0.0;
+		Fa = 1.0;
+		FaByZoneHeat.deallocate();
+		Fb = 1.0;
+		FbByZoneCool.deallocate();
+		FbByZoneHeat.deallocate();
+		Fc = 1.0;
+		FcByZoneCool.deallocate();
+		FcByZoneHeat.deallocate();
+		UpdateSysSizingXs = 1.0;
+		XsBySysCool.deallocate();
+		XsBySysHeat.deallocate();
+		EvzByZoneCool.deallocate();
+		EvzByZoneHeat.deallocate();
+		EvzByZoneCoolPrev.deallocate();
+		EvzByZoneHeatPrev.deallocate();
+		VotClgBySys.deallocate();
+		VotHtgBySys.deallocate();
+		VozSumClgBySys.deallocate();
+		VozSumHtgBySys.deallocate();
+		TotCoolCapTemp.deallocate();
+		MinHeatingEvz = 1.0;
+		EvzMinBySysHeat.deallocate();
+		MinCoolingEvz = 1.0;
+		EvzMinBySysCool.deallocate();
+		ZoneOAFrac = 0.0;
+		ZoneEz = 1.0;
+		Vou = 0.0;
+		Vot = 0.0;
+		VotMax = 0.0;
+		Ratio = 1;
 	}
 
 	void
@@ -277,6 +435,7 @@ namespace SimAirServingZones {
 
 		// Using/Aliasing
 		using MixedAir::ManageOutsideAirSystem;
+		using DataConvergParams::ResimChangedAirLoopsOnly;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -304,12 +463,16 @@ namespace SimAirServingZones {
 		if ( SysSizingCalc ) {
 			SizeAirLoops();
 		} else {
+			// SimAir requests all air loops. Otherwise only the air loops flagged by RequestAirLoopSim() are simulated.
+			if ( FirstHVACIteration || SimAir || ! ResimChangedAirLoopsOnly ) SetAllAirLoopSimFlags( true );
 			SimAirLoops( FirstHVACIteration, SimZoneEquipment );
 		}
 
-		// This flag could be used to resimulate only the air loops that needed additional iterations.
-		// This flag would have to be moved inside SimAirLoops to gain this flexibility.
-		SimAir = std::any_of( AirLoopControlInfo.begin(), AirLoopControlInfo.end(), []( DataAirLoop::AirLoopControlData const & e ){ return e.ResimAirLoopFlag; } );
+		// Resimulate the air loops that needed additional iterations, or all air loops by default.
+		SimAir = false;
+		for ( int AirLoopNum = 1; AirLoopNum <= NumPrimaryAirSys; ++AirLoopNum ) {
+			if ( AirLoopControlInfo( AirLoopNum ).ResimAirLoopFlag ) RequestAirLoopSim( AirLoopNum, SimAir );
+		}
 
 	}
 
@@ -464,26 +627,12 @@ namespace SimAirServingZones {
 		std::string ControllerListName; // Name of a controller list object
 		std::string AvailManagerListName; // Name of an availability manager list object
 		std::string ConnectorListName; // Name of a connector list object
-		static Array1D_string BranchNames; // Branch names from GetBranchList call
-		static Array1D_string CompTypes; // Component types from GetBranchList call
-		static Array1D_string CompNames; // Component names from GetBranchList call
-		static Array1D_string InletNodeNames; // Component inlet node names from GetBranchData call
-		static Array1D_string OutletNodeNames; // Component outlet node names from GetBranchData call
-		static Array1D_string NodeNames; // Outlet node names from GetLoopSplitter call
-		static Array1D_int NodeNumbers; // Outlet node numbers from GetLoopSplitter call
-		static Array1D_int InletNodeNumbers; // Component inlet node numbers from GetBranchData call
-		static Array1D_int OutletNodeNumbers; // Component outlet node numbers from GetBranchData call
 		Array1D_int DummyInteger( 2 ); // Placeholder for corresponding plant loop branch pressure drop info
-		static bool ErrorsFound( false ); // TRUE if errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
-		static Array1D_bool PackagedUnit;
 		int test;
 		int count;
 		bool ErrInList;
-		static int ConListNum( 0 ); // index of a Connector List object in the input
-		static bool SplitterExists( false ); // TRUE if there is a slitter in a primary air system
-		static bool MixerExists( false ); // TRUE if there is a mixer in a primary air system
 		bool errFlag;
 		/////////// hoisted into namespace
 		//static int TestUniqueNodesNum( 0 );
@@ -1414,7 +1563,6 @@ namespace SimAirServingZones {
 		int PlenumOutNum; // DO loop index of supply plenum outlets
 		Real64 MassFlowSaved; // mass flow rate for a node saved from previous call
 		Real64 MassFlowSet; // desired mass flow rate for a node
-		static Real64 SumZoneDesFlow( 0.0 ); // sum of the zone design air mass flow rates for zones served by a system
 		int SupAirPath; // supply air path do loop index
 		int SupAirPathNum; // specific supply air path index
 		int SplitterNum; // Zone equip splitter index
@@ -1432,28 +1580,16 @@ namespace SimAirServingZones {
 		int RetFanIndex;
 		bool FoundOASys;
 		bool FoundCentralHeatCoil;
-		static int TUInNode( 0 ); // inlet node number of a terminal unit
-		static Real64 MassFlowSetToler;
-		static Array1D_int CtrlZoneNumsCool;
-		static Array1D_int CtrlZoneNumsHeat;
-		static Array1D_int ZoneInletNodesCool;
-		static Array1D_int ZoneInletNodesHeat;
-		static Array1D_int TermInletNodesCool;
-		static Array1D_int TermInletNodesHeat;
-		static Array1D_int SupNode;
-		static Array1D_int SupNodeType;
 
 		//Dimension the local subcomponent arrays
 
 		//Simulation Flags
-		static bool MyEnvrnFlag( true );
 		/////////// hoisted into namespace InitAirLoopsOneTimeFlag////////////
 		//static bool MyOneTimeFlag( true );
 		//static bool MyBranchSizingFlag( true ); //InitAirLoopsBranchSizingFlag
 		///////////////////////////
 
 		bool ErrorsFound;
-		static Real64 OAReliefDiff( 0.0 ); // local for massflow change across OA system, kg/s
 
 		Array1D_int tmpNodeARR;
 		int nodeLoop;
@@ -2143,6 +2279,7 @@ namespace SimAirServingZones {
 		using General::GetPreviousHVACTime;
 		using DataConvergParams::CalledFromAirSystemSupplySideDeck1;
 		using DataConvergParams::CalledFromAirSystemSupplySideDeck2;
+		using DataConvergParams::ResimChangedAirLoopsOnly;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -2158,14 +2295,11 @@ namespace SimAirServingZones {
 		// SUBROUTINE LOCAL VARIABLE DEFINITIONS
 		// Last saved HVAC time stamp at beginning of step in seconds.
 		// Used to control when to reset the statistic counters for each new HVAC step.
-		static Real64 SavedPreviousHVACTime( 0.0 );
 		Real64 rxTime;
 		// Maximum of iteration counters across all air loops
-		static int IterMax( 0 );
 		// Aggregated number of iterations across all air loops
-		static int IterTot( 0 );
 		// Aggregated number fo times SimAirLoopComponents() has been invoked across all air loops
-		static int NumCallsTot( 0 );
+		// Number of air loop simulations skipped because the air loop inputs did not change
 		// Primary Air Sys DO loop index
 		int AirLoopNum;
 		// Max number of iterations performed by controllers on each air loop
@@ -2179,7 +2313,6 @@ namespace SimAirServingZones {
 		// DO loop index; there are 2 passes - the 2nd is done only if mass balance fails
 		int AirLoopPass;
 		// Output variable setup flag
-		static bool OutputSetupFlag( false );
 		// Flag set by ResolveSysFlow; if TRUE, mass balance failed and there must be a second pass
 		bool SysReSim;
 		int CalledFrom;
@@ -2188,16 +2321,19 @@ namespace SimAirServingZones {
 
 		// Set up output variables
 		if ( ! OutputSetupFlag ) {
-			SetupOutputVariable( "Air System Simulation Maximum Iteration Count []", IterMax, "HVAC", "Sum", "SimAir" );
-			SetupOutputVariable( "Air System Simulation Iteration Count []", IterTot, "HVAC", "Sum", "SimAir" );
+			SetupOutputVariable( "Air System Simulation Maximum Iteration Count []", SimAirLoopsIterMax, "HVAC", "Sum", "SimAir" );
+			SetupOutputVariable( "Air System Simulation Iteration Count []", SimAirLoopsIterTot, "HVAC", "Sum", "SimAir" );
 			SetupOutputVariable( "Air System Component Model Simulation Calls []", NumCallsTot, "HVAC", "Sum", "SimAir" );
+			if ( ResimChangedAirLoopsOnly ) {
+				SetupOutputVariable( "Air System Skipped Simulation Count []", NumSkippedTot, "HVAC", "Sum", "SimAir" );
+			}
 			OutputSetupFlag = true;
 		}
 
 		// BUG: IterMax should not be aggregated as a Sum output variable
 		//      We need a new aggregation scheme to track the max value across HVAC steps
 		//      instead of suming it up.
-		IterMax = 0;
+		SimAirLoopsIterMax = 0;
 
 		// Reset counters to capture statistics for the current zone time step
 		// Aggregate statistics over all HVAC time steps, even the rejected ones, to properly
@@ -2207,8 +2343,9 @@ namespace SimAirServingZones {
 			rxTime = GetPreviousHVACTime();
 			if ( SavedPreviousHVACTime != rxTime ) {
 				SavedPreviousHVACTime = rxTime;
-				IterTot = 0;
+				SimAirLoopsIterTot = 0;
 				NumCallsTot = 0;
+				NumSkippedTot = 0;
 			}
 		}
 
@@ -2216,6 +2353,13 @@ namespace SimAirServingZones {
 		// and controllers
 		for ( AirLoopNum = 1; AirLoopNum <= NumPrimaryAirSys; ++AirLoopNum ) { // NumPrimaryAirSys is the number of primary air loops
 
+			// Skip the air loops whose inputs did not change since they were last simulated
+			if ( ! AirLoopControlInfo( AirLoopNum ).SimLoopNeeded ) {
+				++NumSkippedTot;
+				continue;
+			}
+			AirLoopControlInfo( AirLoopNum ).SimLoopNeeded = false;
+
 			// Check to see if System Availability Managers are asking for fans to cycle on or shut off
 			// and set fan on/off flags accordingly.
 			TurnFansOn = false;
@@ -2243,9 +2387,9 @@ namespace SimAirServingZones {
 				SimAirLoop( FirstHVACIteration, AirLoopNum, AirLoopPass, AirLoopIterMax, AirLoopIterTot, AirLoopNumCalls );
 
 				// Update tracker for maximum number of iterations needed by any controller on all air loops
-				IterMax = max( IterMax, AirLoopIterMax );
+				SimAirLoopsIterMax = max( SimAirLoopsIterMax, AirLoopIterMax );
 				// Update tracker for aggregated number of iterations needed by all controllers on all air loops
-				IterTot += AirLoopIterTot;
+				SimAirLoopsIterTot += AirLoopIterTot;
 				// Update tracker for total number of times SimAirLoopComponents() has been invoked across all air loops
 				NumCallsTot += AirLoopNumCalls;
 
@@ -2333,19 +2477,13 @@ namespace SimAirServingZones {
 
 		// SUBROUTINE LOCAL VARIABLE DEFINITIONS
 		// Maximum number of iterations performed by each controller on this air loop
-		static int IterMax( 0 );
 		// Aggregated number of iterations performed by each controller on this air loop
-		static int IterTot( 0 );
 		// Number of times SimAirLoopComponents() has been invoked per air loop for either Solve or ReSolve operations
-		static int NumCalls( 0 );
 		// TRUE when primary air system & controllers simulation has converged;
-		static bool AirLoopConvergedFlag( false );
 		// TRUE when speculative warm restart is allowed; FALSE otherwise.
-		static bool DoWarmRestartFlag( false );
 		// If Status<0, no speculative warm restart attempted.
 		// If Status==0, warm restart failed.
 		// If Status>0, warm restart succeeded.
-		static int WarmRestartStatus( iControllerWarmRestartNone );
 
 		// FLOW:
 
@@ -2371,32 +2509,32 @@ namespace SimAirServingZones {
 
 		if ( ! DoWarmRestartFlag ) {
 			// Solve controllers with cold start using default initial values
-			SolveAirLoopControllers( FirstHVACIteration, AirLoopPass, AirLoopNum, AirLoopConvergedFlag, IterMax, IterTot, NumCalls );
+			SolveAirLoopControllers( FirstHVACIteration, AirLoopPass, AirLoopNum, SimAirLoopAirLoopConvergedFlag, SimAirLoopIterMax, SimAirLoopIterTot, SimAirLoopNumCalls );
 
 			// Update air loop trackers
 			WarmRestartStatus = iControllerWarmRestartNone;
-			AirLoopNumCalls += NumCalls;
-			AirLoopIterMax = max( AirLoopIterMax, IterMax );
-			AirLoopIterTot += IterTot;
+			AirLoopNumCalls += SimAirLoopNumCalls;
+			AirLoopIterMax = max( AirLoopIterMax, SimAirLoopIterMax );
+			AirLoopIterTot += SimAirLoopIterTot;
 		} else {
 			// First try with speculative warm restart using previous solution
-			ReSolveAirLoopControllers( FirstHVACIteration, AirLoopPass, AirLoopNum, AirLoopConvergedFlag, IterMax, IterTot, NumCalls );
+			ReSolveAirLoopControllers( FirstHVACIteration, AirLoopPass, AirLoopNum, SimAirLoopAirLoopConvergedFlag, SimAirLoopIterMax, SimAirLoopIterTot, SimAirLoopNumCalls );
 
 			// Update air loop trackers
 			WarmRestartStatus = iControllerWarmRestartSuccess;
-			AirLoopNumCalls += NumCalls;
-			AirLoopIterMax = max( AirLoopIterMax, IterMax );
-			AirLoopIterTot += IterTot;
+			AirLoopNumCalls += SimAirLoopNumCalls;
+			AirLoopIterMax = max( AirLoopIterMax, SimAirLoopIterMax );
+			AirLoopIterTot += SimAirLoopIterTot;
 
 			// Retry with cold start using default initial values if speculative warm restart did not work
-			if ( ! AirLoopConvergedFlag ) {
-				SolveAirLoopControllers( FirstHVACIteration, AirLoopPass, AirLoopNum, AirLoopConvergedFlag, IterMax, IterTot, NumCalls );
+			if ( ! SimAirLoopAirLoopConvergedFlag ) {
+				SolveAirLoopControllers( FirstHVACIteration, AirLoopPass, AirLoopNum, SimAirLoopAirLoopConvergedFlag, SimAirLoopIterMax, SimAirLoopIterTot, SimAirLoopNumCalls );
 
 				// Update air loop trackers
 				WarmRestartStatus = iControllerWarmRestartFail;
-				AirLoopNumCalls += NumCalls;
-				AirLoopIterMax = max( AirLoopIterMax, IterMax );
-				AirLoopIterTot += IterTot;
+				AirLoopNumCalls += SimAirLoopNumCalls;
+				AirLoopIterMax = max( AirLoopIterMax, SimAirLoopIterMax );
+				AirLoopIterTot += SimAirLoopIterTot;
 			}
 		}
 
@@ -2411,7 +2549,7 @@ namespace SimAirServingZones {
 		// To enable generating a trace file with the converged solution for all controllers on each air loop,
 		// define the environment variable TRACE_AIRLOOP=YES or TRACE_AIRLOOP=Y.
 		if ( TraceAirLoopEnvFlag ) {
-			TraceAirLoopControllers( FirstHVACIteration, AirLoopNum, AirLoopPass, AirLoopConvergedFlag, AirLoopNumCalls );
+			TraceAirLoopControllers( FirstHVACIteration, AirLoopNum, AirLoopPass, SimAirLoopAirLoopConvergedFlag, AirLoopNumCalls );
 		}
 
 		// When there is more than 1 controller on an air loop, each controller sensing
@@ -2421,7 +2559,7 @@ namespace SimAirServingZones {
 		// happen if
 		// If this is the case then we do not want to try a warm restart as it is very
 		// unlikely to succeed.
-		AirLoopControlInfo( AirLoopNum ).ConvergedFlag = AirLoopConvergedFlag;
+		AirLoopControlInfo( AirLoopNum ).ConvergedFlag = SimAirLoopAirLoopConvergedFlag;
 
 	}
 
@@ -2488,15 +2626,11 @@ namespace SimAirServingZones {
 		// TRUE when air loop has been evaluated with latest actuated variables
 		bool IsUpToDateFlag;
 		// Iteration counter
-		static int Iter( 0 );
 		// Controller DO loop index
 		int AirLoopControlNum;
 		// Number of times that the maximum iterations was exceeded
-		static int ErrCount( 0 );
 		// Number of times that the maximum iterations was exceeded
-		static int MaxErrCount( 0 );
 		// Placeholder for environment name used in error reporting
-		static std::string ErrEnvironmentName;
 		// A character string equivalent of ErrCount
 		std::string CharErrOut;
 
@@ -3511,10 +3645,8 @@ namespace SimAirServingZones {
 		int MatchingCooledZoneNum; // the cooled zone index matching a heated zone in a system
 		int PrimAirIndex; // index of System Sizing primary air system name in primary air system array
 		int SysSizIndex; // system sizing do loop index
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		Real64 ZoneOAFracCooling; // zone OA fraction for cooling design air flow
 		Real64 ZoneOAFracHeating; // zone OA fraction for heating design air flow
-		static Real64 Ep( 1.0 ); // zone primary air fraction
 		Real64 ZoneSA; // Zone supply air flow rate
 		Array1D< Real64 > VdzClgByZone; // saved value of cooling based ZoneSA which is Vdz used in 62.1 tabular report (also used for zone level Vps)
 		Array1D< Real64 > VdzHtgByZone; // saved value of heating based ZoneSA which is Vdz used in 62.1 tabular report (also used for zone level Vps)
@@ -3574,12 +3706,12 @@ namespace SimAirServingZones {
 			PrimAirIndex = FindItemInList( SysSizInput( SysSizIndex ).AirPriLoopName, PrimaryAirSystem );
 			if ( PrimAirIndex == 0 ) {
 				ShowSevereError( "Sizing:System: " + SysSizInput( SysSizIndex ).AirPriLoopName + " references unknown AirLoopHVAC" );
-				ErrorsFound = true;
+				SetUpSysSizingArraysErrorsFound = true;
 			} else {
 				SysSizInput( SysSizIndex ).AirLoopNum = PrimAirIndex;
 			}
 		}
-		if ( ErrorsFound ) {
+		if ( SetUpSysSizingArraysErrorsFound ) {
 			ShowFatalError( "Errors found in Sizing:System input" );
 		}
 
@@ -4567,42 +4699,8 @@ namespace SimAirServingZones {
 		Real64 SysCoolingEv; // System level ventilation effectiveness for cooling mode
 		Real64 SysHeatingEv; // System level ventilation effectiveness for heating mode
 		// moved to anonymous namespace for unit testing
-		static Array1D< Real64 > EvBySysCool; // saved value of SysCoolingEv used in 62.1 tabular report
-		static Array1D< Real64 > EvBySysHeat; // saved value of SysHeatingEv used in 62.1 tabular report
-		static Real64 Ep( 1.0 ); // zone primary air fraction
-		static Real64 Er( 0.0 ); // zone secondary recirculation fraction
-		static Real64 Fa( 1.0 ); // temporary variable used in multi-path VRP calc
 //		static Array1D< Real64 > FaByZoneCool; // saved value of Fa used in 62.1 tabular report // MOVED TO ANONYMOUS NAMESAPCE TO ENABLE UNIT TESTING
-		static Array1D< Real64 > FaByZoneHeat; // saved value of Fa used in 62.1 tabular report
-		static Real64 Fb( 1.0 ); // temporary variable used in multi-path VRP calc
-		static Array1D< Real64 > FbByZoneCool; // saved value of Fb used in 62.1 tabular report
-		static Array1D< Real64 > FbByZoneHeat; // saved value of Fb used in 62.1 tabular report
-		static Real64 Fc( 1.0 ); // temporary variable used in multi-path VRP calc
-		static Array1D< Real64 > FcByZoneCool; // saved value of Fc used in 62.1 tabular report
-		static Array1D< Real64 > FcByZoneHeat; // saved value of Fc used in 62.1 tabular report
-		static Real64 Xs( 1.0 ); // uncorrected system outdoor air fraction
-		static Array1D< Real64 > XsBySysCool; // saved value of Xs used in 62.1 tabular report
-		static Array1D< Real64 > XsBySysHeat; // saved value of Xs used in 62.1 tabular report
-		static Array1D< Real64 > EvzByZoneCool; // saved value of Evz (zone vent effy) used in 62.1 tabular report
-		static Array1D< Real64 > EvzByZoneHeat; // saved value of Evz (zone vent effy) used in 62.1 tabular report
-		static Array1D< Real64 > EvzByZoneCoolPrev; // saved value of Evz (zone vent effy) used in 62.1 tabular report
-		static Array1D< Real64 > EvzByZoneHeatPrev; // saved value of Evz (zone vent effy) used in 62.1 tabular report
-		static Array1D< Real64 > VotClgBySys; // saved value of cooling ventilation required at primary AHU, used in 62.1 tabular report
-		static Array1D< Real64 > VotHtgBySys; // saved value of heating ventilation required at primary AHU, used in 62.1 tabular report
-		static Array1D< Real64 > VozSumClgBySys; // saved value of cooling ventilation required at clg zones
-		static Array1D< Real64 > VozSumHtgBySys; // saved value of cooling ventilation required at htg zones
-		static Array1D< Real64 > TotCoolCapTemp; // scratch variable used for calulating peak load [W]
 //		static Array1D< Real64 > SensCoolCapTemp; // scratch variable used for calulating peak load [W] // MOVED TO ANONYMOUS NAMESAPCE TO ENABLE UNIT TESTING
-		static Real64 MinHeatingEvz( 1.0 ); // minimum zone ventilation efficiency for heating (to be used as system efficiency)
-		static Array1D< Real64 > EvzMinBySysHeat; // saved value of EvzMin used in 62.1 tabular report
-		static Real64 MinCoolingEvz( 1.0 ); // minimum zone ventilation efficiency for cooling (to be used as system efficiency)
-		static Array1D< Real64 > EvzMinBySysCool; // saved value of EvzMin used in 62.1 tabular report
-		static Real64 ZoneOAFrac( 0.0 ); // zone OA fraction
-		static Real64 ZoneEz( 1.0 ); // zone air distribution effectiveness
-		static Real64 Vou( 0.0 ); // Uncorrected outdoor air intake for all zones per ASHRAE std 62.1
-		static Real64 Vot( 0.0 ); // Required outdoor air intake at primary AHU per ASHRAE std 62.1
-		static Real64 VotMax( 0.0 ); // Max of required cooling/heating outdoor air intake at primary AHU per ASHRAE std 62.1
-		static Real64 Ratio( 1 ); // Ratio of VozBySys / VotMax
 		// not changing this for the unitary system check in
 		//  REAL(r64) :: Ratio   = 1.0d0           ! Ratio of VozBySys / VotMax
 		Real64 SysHtgPeakAirflow; // Peak heating airflow
@@ -4979,9 +5077,9 @@ namespace SimAirServingZones {
 						}
 						OutAirFrac = min( 1.0, max( 0.0, OutAirFrac ) );
 						if ( SysSizing( CurOverallSimDay, AirLoopNum ).DesCoolVolFlow > 0 ) {
-							Xs = min( 1.0, FinalSysSizing( AirLoopNum ).SysUncOA / SysSizing( CurOverallSimDay, AirLoopNum ).DesCoolVolFlow );
+							UpdateSysSizingXs = min( 1.0, FinalSysSizing( AirLoopNum ).SysUncOA / SysSizing( CurOverallSimDay, AirLoopNum ).DesCoolVolFlow );
 						} else {
-							Xs = 0.0;
+							UpdateSysSizingXs = 0.0;
 						}
 						if ( FinalSysSizing( AirLoopNum ).OAAutoSized && SysSizing( CurOverallSimDay, AirLoopNum ).DesCoolVolFlow > 0 ) {
 							NumZonesCooled = AirToZoneNodeInfo( AirLoopNum ).NumZonesCooled;
@@ -4992,15 +5090,15 @@ namespace SimAirServingZones {
 
 								// Zone air secondary recirculation fraction
 								Er = FinalZoneSizing( CtrlZoneNum ).ZoneSecondaryRecirculation;
-								Ep = FinalZoneSizing( CtrlZoneNum ).ZonePrimaryAirFraction;
+								UpdateSysSizingEp = FinalZoneSizing( CtrlZoneNum ).ZonePrimaryAirFraction;
 								ZoneOAFrac = FinalZoneSizing( CtrlZoneNum ).ZpzClgByZone;
 								ZoneEz = FinalZoneSizing( CtrlZoneNum ).ZoneADEffCooling;
 								VozClg = FinalZoneSizing( CtrlZoneNum ).VozClgByZone;
 								if ( Er > 0.0 ) {
 									// multi-path ventilation system using VRP
-									Fa = Ep + ( 1.0 - Ep ) * Er;
-									Fb = Ep;
-									Fc = 1.0 - ( 1.0 - ZoneEz ) * ( 1.0 - Er ) * ( 1.0 - Ep );
+									Fa = UpdateSysSizingEp + ( 1.0 - UpdateSysSizingEp ) * Er;
+									Fb = UpdateSysSizingEp;
+									Fc = 1.0 - ( 1.0 - ZoneEz ) * ( 1.0 - Er ) * ( 1.0 - UpdateSysSizingEp );
 									//save Fa Fb and Fc for standard 62.1 report
 									FaByZoneCool( CtrlZoneNum ) = Fa;
 									FbByZoneCool( CtrlZoneNum ) = Fb;
@@ -5008,16 +5106,16 @@ namespace SimAirServingZones {
 
 									// Calc zone ventilation efficiency
 									if ( Fa > 0.0 ) {
-										SysCoolingEv = 1.0 + Xs * Fb / Fa - ZoneOAFrac * Ep * Fc / Fa;
+										SysCoolingEv = 1.0 + UpdateSysSizingXs * Fb / Fa - ZoneOAFrac * UpdateSysSizingEp * Fc / Fa;
 									} else {
 										SysCoolingEv = 1.0;
 									}
 
 								} else {
 									// single-path ventilation system
-									SysCoolingEv = 1.0 + Xs - ZoneOAFrac;
+									SysCoolingEv = 1.0 + UpdateSysSizingXs - ZoneOAFrac;
 									// Apply ventilation efficiency limit; reset SysCoolingEv if necessary
-									LimitZoneVentEff( Xs, VozClg, CtrlZoneNum, SysCoolingEv );
+									LimitZoneVentEff( UpdateSysSizingXs, VozClg, CtrlZoneNum, SysCoolingEv );
 								}
 								if ( SysCoolingEv < MinCoolingEvz ) MinCoolingEvz = SysCoolingEv;
 								EvzByZoneCoolPrev( CtrlZoneNum ) = EvzByZoneCool( CtrlZoneNum ); // Save previous EvzByZoneCool
@@ -5033,7 +5131,7 @@ namespace SimAirServingZones {
 								if ( Vot > VotClgBySys( AirLoopNum ) ) {
 									//This might be the cooling design day so only update if Vot is larger than the previous
 									VotClgBySys( AirLoopNum ) = Vot;
-									XsBySysCool( AirLoopNum ) = Xs;
+									XsBySysCool( AirLoopNum ) = UpdateSysSizingXs;
 									EvzMinBySysCool( AirLoopNum ) = MinCoolingEvz;
 								} else {
 									//Restore EvzByZoneCool() since it was reset by the current (but not highest Vot) design day
@@ -5076,9 +5174,9 @@ namespace SimAirServingZones {
 
 						if ( SysSizing( CurOverallSimDay, AirLoopNum ).DesHeatVolFlow > 0 ) {
 							// SysSizing(AirLoopNum,CurOverallSimDay)%DesHeatVolFlow may be out of sync with FinalZoneSizing(CtrlZoneNum)%DesHeatVolFlow
-							Xs = min( 1.0, FinalSysSizing( AirLoopNum ).SysUncOA / max( SysSizing( CurOverallSimDay, AirLoopNum ).DesHeatVolFlow, SysHtgPeakAirflow ) );
+							UpdateSysSizingXs = min( 1.0, FinalSysSizing( AirLoopNum ).SysUncOA / max( SysSizing( CurOverallSimDay, AirLoopNum ).DesHeatVolFlow, SysHtgPeakAirflow ) );
 						} else {
-							Xs = 0.0;
+							UpdateSysSizingXs = 0.0;
 						}
 
 						if ( FinalSysSizing( AirLoopNum ).OAAutoSized && SysSizing( CurOverallSimDay, AirLoopNum ).DesHeatVolFlow > 0 ) {
@@ -5092,14 +5190,14 @@ namespace SimAirServingZones {
 									if ( MatchingCooledZoneNum == 0 ) {
 										// Zone air secondary recirculation fraction
 										Er = FinalZoneSizing( CtrlZoneNum ).ZoneSecondaryRecirculation;
-										Ep = FinalZoneSizing( CtrlZoneNum ).ZonePrimaryAirFractionHtg;
+										UpdateSysSizingEp = FinalZoneSizing( CtrlZoneNum ).ZonePrimaryAirFractionHtg;
 										ZoneOAFrac = FinalZoneSizing( CtrlZoneNum ).ZpzHtgByZone;
 										ZoneEz = FinalZoneSizing( CtrlZoneNum ).ZoneADEffHeating;
 										if ( Er > 0.0 ) {
 											// multi-path ventilation system using VRP
-											Fa = Ep + ( 1.0 - Ep ) * Er;
-											Fb = Ep;
-											Fc = 1.0 - ( 1.0 - ZoneEz ) * ( 1.0 - Er ) * ( 1.0 - Ep );
+											Fa = UpdateSysSizingEp + ( 1.0 - UpdateSysSizingEp ) * Er;
+											Fb = UpdateSysSizingEp;
+											Fc = 1.0 - ( 1.0 - ZoneEz ) * ( 1.0 - Er ) * ( 1.0 - UpdateSysSizingEp );
 											//save Fa Fb and Fc for standard 62.1 report
 											FaByZoneHeat( CtrlZoneNum ) = Fa;
 											FbByZoneHeat( CtrlZoneNum ) = Fb;
@@ -5107,13 +5205,13 @@ namespace SimAirServingZones {
 
 											// Calc zone ventilation efficiency
 											if ( Fa > 0.0 ) {
-												SysHeatingEv = 1.0 + Xs * Fb / Fa - ZoneOAFrac * Ep * Fc / Fa;
+												SysHeatingEv = 1.0 + UpdateSysSizingXs * Fb / Fa - ZoneOAFrac * UpdateSysSizingEp * Fc / Fa;
 											} else {
 												SysHeatingEv = 1.0;
 											}
 										} else {
 											// single-path ventilation system
-											SysHeatingEv = 1.0 + Xs - ZoneOAFrac;
+											SysHeatingEv = 1.0 + UpdateSysSizingXs - ZoneOAFrac;
 										}
 										if ( SysHeatingEv < MinHeatingEvz ) MinHeatingEvz = SysHeatingEv;
 										EvzByZoneHeatPrev( CtrlZoneNum ) = EvzByZoneHeat( CtrlZoneNum ); // Save previous EvzByZoneHeat
@@ -5126,14 +5224,14 @@ namespace SimAirServingZones {
 									CtrlZoneNum = AirToZoneNodeInfo( AirLoopNum ).CoolCtrlZoneNums( ZonesHeatedNum );
 									// Zone air secondary recirculation fraction
 									Er = FinalZoneSizing( CtrlZoneNum ).ZoneSecondaryRecirculation;
-									Ep = FinalZoneSizing( CtrlZoneNum ).ZonePrimaryAirFractionHtg;
+									UpdateSysSizingEp = FinalZoneSizing( CtrlZoneNum ).ZonePrimaryAirFractionHtg;
 									ZoneOAFrac = FinalZoneSizing( CtrlZoneNum ).ZpzHtgByZone;
 									ZoneEz = FinalZoneSizing( CtrlZoneNum ).ZoneADEffHeating;
 									if ( Er > 0.0 ) {
 										// multi-path ventilation system using VRP
-										Fa = Ep + ( 1.0 - Ep ) * Er;
-										Fb = Ep;
-										Fc = 1.0 - ( 1.0 - ZoneEz ) * ( 1.0 - Er ) * ( 1.0 - Ep );
+										Fa = UpdateSysSizingEp + ( 1.0 - UpdateSysSizingEp ) * Er;
+										Fb = UpdateSysSizingEp;
+										Fc = 1.0 - ( 1.0 - ZoneEz ) * ( 1.0 - Er ) * ( 1.0 - UpdateSysSizingEp );
 										//save Fa Fb and Fc for standard 62.1 report
 										FaByZoneHeat( CtrlZoneNum ) = Fa;
 										FbByZoneHeat( CtrlZoneNum ) = Fb;
@@ -5141,13 +5239,13 @@ namespace SimAirServingZones {
 
 										// Calc zone ventilation efficiency
 										if ( Fa > 0.0 ) {
-											SysHeatingEv = 1.0 + Xs * Fb / Fa - ZoneOAFrac * Ep * Fc / Fa;
+											SysHeatingEv = 1.0 + UpdateSysSizingXs * Fb / Fa - ZoneOAFrac * UpdateSysSizingEp * Fc / Fa;
 										} else {
 											SysHeatingEv = 1.0;
 										}
 									} else {
 										// single-path ventilation system
-										SysHeatingEv = 1.0 + Xs - ZoneOAFrac;
+										SysHeatingEv = 1.0 + UpdateSysSizingXs - ZoneOAFrac;
 									}
 									if ( SysHeatingEv < MinHeatingEvz ) MinHeatingEvz = SysHeatingEv;
 									EvzByZoneHeatPrev( CtrlZoneNum ) = EvzByZoneHeat( CtrlZoneNum ); // Save previous EvzByZoneHeat
@@ -5165,7 +5263,7 @@ namespace SimAirServingZones {
 								if ( Vot > VotHtgBySys( AirLoopNum ) ) {
 									//This might be the cooling design day so only update if Vot is larger than the previous
 									VotHtgBySys( AirLoopNum ) = Vot;
-									XsBySysHeat( AirLoopNum ) = Xs;
+									XsBySysHeat( AirLoopNum ) = UpdateSysSizingXs;
 									EvzMinBySysHeat( AirLoopNum ) = MinHeatingEvz;
 								} else {
 									//Restore EvzByZoneHeat() since it was reset by the current (but not highest Vot) design day
@@ -5221,9 +5319,9 @@ namespace SimAirServingZones {
 						OutAirFrac = min( 1.0, max( 0.0, OutAirFrac ) );
 
 						if ( SysSizing( CurOverallSimDay, AirLoopNum ).DesCoolVolFlow > 0 ) {
-							Xs = min( 1.0, FinalSysSizing( AirLoopNum ).SysUncOA / SysSizing( CurOverallSimDay, AirLoopNum ).DesCoolVolFlow );
+							UpdateSysSizingXs = min( 1.0, FinalSysSizing( AirLoopNum ).SysUncOA / SysSizing( CurOverallSimDay, AirLoopNum ).DesCoolVolFlow );
 						} else {
-							Xs = 0.0;
+							UpdateSysSizingXs = 0.0;
 						}
 						if ( FinalSysSizing( AirLoopNum ).OAAutoSized && SysSizing( CurOverallSimDay, AirLoopNum ).DesCoolVolFlow > 0 ) {
 							NumZonesCooled = AirToZoneNodeInfo( AirLoopNum ).NumZonesCooled;
@@ -5234,15 +5332,15 @@ namespace SimAirServingZones {
 
 								// Zone air secondary recirculation fraction
 								Er = FinalZoneSizing( CtrlZoneNum ).ZoneSecondaryRecirculation;
-								Ep = FinalZoneSizing( CtrlZoneNum ).ZonePrimaryAirFraction;
+								UpdateSysSizingEp = FinalZoneSizing( CtrlZoneNum ).ZonePrimaryAirFraction;
 								ZoneOAFrac = FinalZoneSizing( CtrlZoneNum ).ZpzClgByZone;
 								ZoneEz = FinalZoneSizing( CtrlZoneNum ).ZoneADEffCooling;
 								VozClg = FinalZoneSizing( CtrlZoneNum ).VozClgByZone;
 								if ( Er > 0.0 ) {
 									// multi-path ventilation system using VRP
-									Fa = Ep + ( 1.0 - Ep ) * Er;
-									Fb = Ep;
-									Fc = 1.0 - ( 1.0 - ZoneEz ) * ( 1.0 - Er ) * ( 1.0 - Ep );
+									Fa = UpdateSysSizingEp + ( 1.0 - UpdateSysSizingEp ) * Er;
+									Fb = UpdateSysSizingEp;
+									Fc = 1.0 - ( 1.0 - ZoneEz ) * ( 1.0 - Er ) * ( 1.0 - UpdateSysSizingEp );
 									//save Fa Fb and Fc for standard 62.1 report
 									FaByZoneCool( CtrlZoneNum ) = Fa;
 									FbByZoneCool( CtrlZoneNum ) = Fb;
@@ -5250,15 +5348,15 @@ namespace SimAirServingZones {
 
 									// Calc zone ventilation efficiency
 									if ( Fa > 0.0 ) {
-										SysCoolingEv = 1.0 + Xs * Fb / Fa - ZoneOAFrac * Ep * Fc / Fa;
+										SysCoolingEv = 1.0 + UpdateSysSizingXs * Fb / Fa - ZoneOAFrac * UpdateSysSizingEp * Fc / Fa;
 									} else {
 										SysCoolingEv = 1.0;
 									}
 								} else {
 									// single-path ventilation system
-									SysCoolingEv = 1.0 + Xs - ZoneOAFrac;
+									SysCoolingEv = 1.0 + UpdateSysSizingXs - ZoneOAFrac;
 									// Apply ventilation efficiency limit; reset SysCoolingEv if necessary
-									LimitZoneVentEff( Xs, VozClg, CtrlZoneNum, SysCoolingEv );
+									LimitZoneVentEff( UpdateSysSizingXs, VozClg, CtrlZoneNum, SysCoolingEv );
 								}
 								if ( SysCoolingEv < MinCoolingEvz ) MinCoolingEvz = SysCoolingEv;
 								EvzByZoneCoolPrev( CtrlZoneNum ) = EvzByZoneCool( CtrlZoneNum );
@@ -5275,7 +5373,7 @@ namespace SimAirServingZones {
 								if ( Vot > VotClgBySys( AirLoopNum ) ) {
 									//This might be the cooling design day so only update if Vot is larger than the previous
 									VotClgBySys( AirLoopNum ) = Vot;
-									XsBySysCool( AirLoopNum ) = Xs;
+									XsBySysCool( AirLoopNum ) = UpdateSysSizingXs;
 									EvzMinBySysCool( AirLoopNum ) = MinCoolingEvz;
 								} else {
 									//Restore EvzByZoneCool() since it was reset by the current (but not highest Vot) design day
@@ -5297,9 +5395,9 @@ namespace SimAirServingZones {
 						OutAirFrac = min( 1.0, max( 0.0, OutAirFrac ) );
 
 						if ( SysSizing( CurOverallSimDay, AirLoopNum ).DesHeatVolFlow > 0 ) {
-							Xs = min( 1.0, FinalSysSizing( AirLoopNum ).SysUncOA / SysSizing( CurOverallSimDay, AirLoopNum ).DesHeatVolFlow );
+							UpdateSysSizingXs = min( 1.0, FinalSysSizing( AirLoopNum ).SysUncOA / SysSizing( CurOverallSimDay, AirLoopNum ).DesHeatVolFlow );
 						} else {
-							Xs = 0.0;
+							UpdateSysSizingXs = 0.0;
 						}
 						if ( FinalSysSizing( AirLoopNum ).OAAutoSized && SysSizing( CurOverallSimDay, AirLoopNum ).DesHeatVolFlow > 0 ) {
 							NumZonesHeated = AirToZoneNodeInfo( AirLoopNum ).NumZonesHeated;
@@ -5312,24 +5410,24 @@ namespace SimAirServingZones {
 									if ( MatchingCooledZoneNum == 0 ) {
 										// Zone air secondary recirculation fraction
 										Er = FinalZoneSizing( CtrlZoneNum ).ZoneSecondaryRecirculation;
-										Ep = FinalZoneSizing( CtrlZoneNum ).ZonePrimaryAirFractionHtg;
+										UpdateSysSizingEp = FinalZoneSizing( CtrlZoneNum ).ZonePrimaryAirFractionHtg;
 										ZoneOAFrac = FinalZoneSizing( CtrlZoneNum ).ZpzHtgByZone;
 										ZoneEz = FinalZoneSizing( CtrlZoneNum ).ZoneADEffHeating;
 										if ( Er > 0.0 ) {
 											// multi-path ventilation system using VRP
-											Fa = Ep + ( 1.0 - Ep ) * Er;
-											Fb = Ep;
-											Fc = 1.0 - ( 1.0 - ZoneEz ) * ( 1.0 - Er ) * ( 1.0 - Ep );
+											Fa = UpdateSysSizingEp + ( 1.0 - UpdateSysSizingEp ) * Er;
+											Fb = UpdateSysSizingEp;
+											Fc = 1.0 - ( 1.0 - ZoneEz ) * ( 1.0 - Er ) * ( 1.0 - UpdateSysSizingEp );
 
 											// Calc zone ventilation efficiency
 											if ( Fa > 0.0 ) {
-												SysHeatingEv = 1.0 + Xs * Fb / Fa - ZoneOAFrac * Ep * Fc / Fa;
+												SysHeatingEv = 1.0 + UpdateSysSizingXs * Fb / Fa - ZoneOAFrac * UpdateSysSizingEp * Fc / Fa;
 											} else {
 												SysHeatingEv = 1.0;
 											}
 										} else {
 											// single-path ventilation system
-											SysHeatingEv = 1.0 + Xs - ZoneOAFrac;
+											SysHeatingEv = 1.0 + UpdateSysSizingXs - ZoneOAFrac;
 										}
 									}
 									if ( SysHeatingEv < MinHeatingEvz ) MinHeatingEvz = SysHeatingEv;
@@ -5343,24 +5441,24 @@ namespace SimAirServingZones {
 									CtrlZoneNum = AirToZoneNodeInfo( AirLoopNum ).CoolCtrlZoneNums( ZonesHeatedNum );
 									// Zone air secondary recirculation fraction
 									Er = FinalZoneSizing( CtrlZoneNum ).ZoneSecondaryRecirculation;
-									Ep = FinalZoneSizing( CtrlZoneNum ).ZonePrimaryAirFractionHtg;
+									UpdateSysSizingEp = FinalZoneSizing( CtrlZoneNum ).ZonePrimaryAirFractionHtg;
 									ZoneOAFrac = FinalZoneSizing( CtrlZoneNum ).ZpzHtgByZone;
 									ZoneEz = FinalZoneSizing( CtrlZoneNum ).ZoneADEffHeating;
 									if ( Er > 0.0 ) {
 										// multi-path ventilation system using VRP
-										Fa = Ep + ( 1.0 - Ep ) * Er;
-										Fb = Ep;
-										Fc = 1.0 - ( 1.0 - ZoneEz ) * ( 1.0 - Er ) * ( 1.0 - Ep );
+										Fa = UpdateSysSizingEp + ( 1.0 - UpdateSysSizingEp ) * Er;
+										Fb = UpdateSysSizingEp;
+										Fc = 1.0 - ( 1.0 - ZoneEz ) * ( 1.0 - Er ) * ( 1.0 - UpdateSysSizingEp );
 
 										// Calc zone ventilation efficiency
 										if ( Fa > 0.0 ) {
-											SysHeatingEv = 1.0 + Xs * Fb / Fa - ZoneOAFrac * Ep * Fc / Fa;
+											SysHeatingEv = 1.0 + UpdateSysSizingXs * Fb / Fa - ZoneOAFrac * UpdateSysSizingEp * Fc / Fa;
 										} else {
 											SysHeatingEv = 1.0;
 										}
 									} else {
 										// single-path ventilation system
-										SysHeatingEv = 1.0 + Xs - ZoneOAFrac;
+										SysHeatingEv = 1.0 + UpdateSysSizingXs - ZoneOAFrac;
 									}
 									if ( SysHeatingEv < MinHeatingEvz ) MinHeatingEvz = SysHeatingEv;
 									EvzByZoneHeatPrev( CtrlZoneNum ) = EvzByZoneHeat( CtrlZoneNum ); // Save previous EvzByZoneHeat
@@ -5378,7 +5476,7 @@ namespace SimAirServingZones {
 								if ( Vot > VotHtgBySys( AirLoopNum ) ) {
 									//This might be the cooling design day so only update if Vot is larger than the previous
 									VotHtgBySys( AirLoopNum ) = Vot;
-									XsBySysHeat( AirLoopNum ) = Xs;
+									XsBySysHeat( AirLoopNum ) = UpdateSysSizingXs;
 									EvzMinBySysHeat( AirLoopNum ) = MinHeatingEvz;
 								} else {
 									//Restore EvzByZoneHeat() since it was just reset by the current (but not highest Vot) design day
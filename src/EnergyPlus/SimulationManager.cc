@@ -62,8 +62,12 @@ extern "C" {
 }
 
 // C++ Headers
+#include <algorithm>
 #include <cmath>
+#include <fstream>
+#include <iomanip>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/environment.hh>
@@ -78,6 +82,7 @@ extern "C" {
 #include <SimulationManager.hh>
 #include <BranchInputManager.hh>
 #include <BranchNodeConnections.hh>
+#include <Checkpoint.hh>
 #include <CostEstimateManager.hh>
 #include <CurveManager.hh>
 #include <DataAirLoop.hh>
@@ -90,6 +95,7 @@ extern "C" {
 #include <DataGlobals.hh>
 #include <DataHeatBalance.hh>
 #include <DataHeatBalFanSys.hh>
+#include <DataHeatBalSurface.hh>
 #include <DataHVACGlobals.hh>
 #include <DataIPShortCuts.hh>
 #include <DataLoopNode.hh>
@@ -107,6 +113,7 @@ extern "C" {
 #include <DemandManager.hh>
 #include <DisplayRoutines.hh>
 #include <DualDuct.hh>
+#include <DXCoils.hh>
 #include <EconomicLifeCycleCost.hh>
 #include <EconomicTariff.hh>
 #include <ElectricPowerServiceManager.hh>
@@ -136,11 +143,13 @@ extern "C" {
 #include <PlantPipingSystemsManager.hh>
 #include <Psychrometrics.hh>
 #include <RefrigeratedCase.hh>
+#include <RootFinder.hh>
 #include <SetPointManager.hh>
 #include <SizingManager.hh>
 #include <SolarShading.hh>
 #include <SQLiteProcedures.hh>
 #include <SystemReports.hh>
+#include <ThermalComfort.hh>
 #include <UtilityRoutines.hh>
 #include <WeatherManager.hh>
 #include <ZoneContaminantPredictorCorrector.hh>
@@ -205,6 +214,25 @@ namespace SimulationManager {
 		// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
 		// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
 		bool PreP_Fatal( false );
+		bool WeatherAdvanced( false ); // The weather was advanced ahead of the models at the start of the environment
+		bool ReportingAfterOverlap( false ); // DoOutputReporting to restore at the end of the segment overlap days
+
+		struct SegmentBoundaryStateData
+		{
+			std::string Boundary; // Start (end of the overlap days) or End (last day) of the segment, or Serial
+			std::string EnvironmentName;
+			int DayOfSim = 0; // Day at the end of which the state was saved
+			Array1D< Real64 > ZoneAirTemp; // Zone mean air temperatures
+			Array1D< Real64 > SurfaceInsideTemp; // Surface inside face temperatures
+		};
+
+		std::vector< SegmentBoundaryStateData > SegmentBoundaryStates; // Saved for the comparison with the neighbouring segments
+		bool Available; // an environment is available to process
+		bool ManageSimulationErrorsFound( false );
+		bool TerminalError( false );
+		std::string VersionID;
+		bool SetupSimulationAvailable( false ); // an environment is available to process
+		bool WarningOut( true );
 	}
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SimulationManager
@@ -218,6 +246,15 @@ namespace SimulationManager {
 		RunPeriodsInInput = false;
 		RunControlInInput = false;
 		PreP_Fatal = false;
+		WeatherAdvanced = false;
+		ReportingAfterOverlap = false;
+		SegmentBoundaryStates.clear();
+		Available = false;
+		ManageSimulationErrorsFound = false;
+		TerminalError = false;
+		VersionID.clear();
+		SetupSimulationAvailable = false;
+		WarningOut = true;
 	}
 
 
@@ -270,6 +307,8 @@ namespace SimulationManager {
 		using General::TrimSigDigits;
 		using OutputReportPredefined::SetPredefinedTables;
 		using HVACControllers::DumpAirLoopStatistics;
+		using RootFinder::DumpRootSolverStatistics;
+		using DXCoils::DumpCoilPerfMemoStatistics;
 		using NodeInputManager::SetupNodeVarsForReporting;
 		using NodeInputManager::CheckMarkedNodes;
 		using BranchNodeConnections::CheckNodeConnections;
@@ -312,9 +351,6 @@ namespace SimulationManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool Available; // an environment is available to process
-		static bool ErrorsFound( false );
-		static bool TerminalError( false );
 		bool SimsDone;
 		bool ErrFound;
 		//  REAL(r64) :: t0,t1,st0,st1
@@ -328,6 +364,7 @@ namespace SimulationManager {
 		static gio::Fmt Format_700( "('Environment:WarmupDays,',I3)" );
 
 		//CreateSQLiteDatabase();
+		if ( RestartSimulation ) Checkpoint::KeepOutputBeforeRestart(); // output up to the checkpoint
 		sqlite = EnergyPlus::CreateSQLiteDatabase();
 
 		if ( sqlite ) {
@@ -393,7 +430,7 @@ namespace SimulationManager {
 		KickOffSimulation = true;
 
 		ResetEnvironmentCounter();
-		SetupSimulation( ErrorsFound );
+		SetupSimulation( ManageSimulationErrorsFound );
 		InitCurveReporting();
 
 		AskForConnectionsReport = true; // set to true now that input processing and sizing is done.
@@ -460,7 +497,7 @@ namespace SimulationManager {
 
 		// if user requested HVAC Sizing Simulation, call HVAC sizing simulation manager
 		if ( DoHVACSizingSimulation ) {
-			ManageHVACSizingSimulation( ErrorsFound );
+			ManageHVACSizingSimulation( ManageSimulationErrorsFound );
 		}
 
 		ShowMessage( "Beginning Simulation" );
@@ -468,20 +505,29 @@ namespace SimulationManager {
 
 		ResetEnvironmentCounter();
 
+		if ( RestartSimulation ) {
+			Checkpoint::ReadCheckpoint();
+			Checkpoint::RestoreSQLiteOutput();
+		}
+
 		EnvCount = 0;
 		WarmupFlag = true;
+		int SplitEnvrnNum = 0; // Environment split into the segments
+		int SplitEnvrnDays = 0; // Days of the split environment
 
 		while ( Available ) {
 
-			GetNextEnvironment( Available, ErrorsFound );
+			GetNextEnvironment( Available, ManageSimulationErrorsFound );
 
 			if ( ! Available ) break;
-			if ( ErrorsFound ) break;
+			if ( ManageSimulationErrorsFound ) break;
 			if ( ( ! DoDesDaySim ) && ( KindOfSim != ksRunPeriodWeather ) ) continue;
 			if ( ( ! DoWeathSim ) && ( KindOfSim == ksRunPeriodWeather ) ) continue;
 			if (KindOfSim == ksHVACSizeDesignDay) continue; // don't run these here, only for sizing simulations
 
 			if (KindOfSim == ksHVACSizeRunPeriodDesign) continue; // don't run these here, only for sizing simulations
+			if ( Checkpoint::RestartPending && DataEnvironment::CurEnvirNum < Checkpoint::RestartEnvrnNum ) continue; // completed before the checkpoint
+			if ( SegmentNum > 1 && KindOfSim != ksRunPeriodWeather ) continue; // simulated by the first segment
 
 			++EnvCount;
 
@@ -502,6 +548,26 @@ namespace SimulationManager {
 			DayOfSim = 0;
 			DayOfSimChr = "0";
 			NumOfWarmupDays = 0;
+			int SegmentStartDay = 1; // First reported day of the environment
+			std::vector< int > SerialBoundaryDays; // Last days of the segments, for the serial reference run
+			if ( NumSegments > 0 && KindOfSim == ksRunPeriodWeather ) {
+				if ( NumOfDayInEnvrn < NumSegments ) {
+					ShowFatalError( "ManageSimulation: Environment=\"" + DataEnvironment::EnvironmentName + "\" has fewer days than the " + TrimSigDigits( NumSegments ) + " requested segments." );
+				}
+				int SegmentEndDay;
+				SplitEnvrnNum = Envrn;
+				SplitEnvrnDays = NumOfDayInEnvrn;
+				if ( SegmentNum > 0 ) {
+					SegmentDayRange( NumOfDayInEnvrn, Environment( Envrn ).StartJDay, Environment( Envrn ).IsLeapYear, NumSegments, SegmentNum, SegmentStartDay, SegmentEndDay );
+					NumOfDayInEnvrn = SegmentEndDay;
+				} else {
+					for ( int SegNum = 1; SegNum < NumSegments; ++SegNum ) {
+						int SegmentFirstDay;
+						SegmentDayRange( NumOfDayInEnvrn, Environment( Envrn ).StartJDay, Environment( Envrn ).IsLeapYear, NumSegments, SegNum, SegmentFirstDay, SegmentEndDay );
+						SerialBoundaryDays.push_back( SegmentEndDay );
+					}
+				}
+			}
 			if ( NumOfDayInEnvrn <= 365 ){
 				isFinalYear = true;
 			}
@@ -509,10 +575,15 @@ namespace SimulationManager {
 			bool anyEMSRan;
 			ManageEMS( emsCallFromBeginNewEvironment, anyEMSRan ); // calling point
 
+			if ( Checkpoint::RestartPending ) ResumeFromCheckpoint();
+			int FirstSimDay = 1; // First day simulated after warmup
+			if ( SegmentStartDay > 1 ) FirstSimDay = StartSegment( SegmentStartDay );
+
 			while ( ( DayOfSim < NumOfDayInEnvrn ) || ( WarmupFlag ) ) { // Begin day loop ...
 
 				if ( sqlite ) sqlite->sqliteBegin(); // setup for one transaction per day
 
+				if ( ! WarmupFlag && DayOfSim == 0 ) DayOfSim = FirstSimDay - 1; // a segment warms up on its first day
 				++DayOfSim;
 				gio::write( DayOfSimChr, fmtLD ) << DayOfSim;
 				strip( DayOfSimChr );
@@ -530,7 +601,7 @@ namespace SimulationManager {
 					++NumOfWarmupDays;
 					cWarmupDay = TrimSigDigits( NumOfWarmupDays );
 					DisplayString( "Warming up {" + cWarmupDay + '}' );
-				} else if ( DayOfSim == 1 ) {
+				} else if ( DayOfSim == FirstSimDay ) {
 					DisplayString( "Starting Simulation at " + CurMnDy + " for " + EnvironmentName );
 					gio::write( OutputFileInits, Format_700 ) << NumOfWarmupDays;
 					ResetAccumulationWhenWarmupComplete();
@@ -574,7 +645,14 @@ namespace SimulationManager {
 							}
 						}
 
-						ManageWeather();
+						if ( WeatherAdvanced ) {
+							// The weather is already at this day, only the models still start the environment
+							BeginEnvrnFlag = false;
+							ManageWeather();
+							BeginEnvrnFlag = true;
+						} else {
+							ManageWeather();
+						}
 
 						ManageExteriorEnergyUse();
 
@@ -592,6 +670,8 @@ namespace SimulationManager {
 						BeginEnvrnFlag = false;
 						BeginSimFlag = false;
 						BeginFullSimFlag = false;
+						WeatherAdvanced = false;
+						if ( Checkpoint::RestartPending ) Checkpoint::FinishRestart();
 
 					} // TimeStep loop
 
@@ -601,6 +681,25 @@ namespace SimulationManager {
 
 				if ( sqlite ) sqlite->sqliteCommit(); // one transaction per day
 
+				if ( ! CheckpointFileName.empty() && NumSegments == 0 && ! WarmupFlag && KindOfSim == ksRunPeriodWeather && DayOfSim < NumOfDayInEnvrn ) {
+					Checkpoint::WriteCheckpoint();
+				}
+
+				if ( SegmentNum > 0 && ! WarmupFlag && KindOfSim == ksRunPeriodWeather ) {
+					if ( DayOfSim == SegmentStartDay - 1 ) { // end of the overlap days
+						SaveSegmentBoundaryState( "Start" );
+						DoOutputReporting = ReportingAfterOverlap;
+						// the reports of the segment start with its own days
+						ResetAccumulationWhenWarmupComplete();
+						ResetTabularReports();
+						ThermalComfort::ZoneOccHrs = 0.0;
+					}
+					if ( DayOfSim == NumOfDayInEnvrn && SegmentNum < NumSegments ) SaveSegmentBoundaryState( "End" );
+				}
+				if ( ! WarmupFlag && std::find( SerialBoundaryDays.begin(), SerialBoundaryDays.end(), DayOfSim ) != SerialBoundaryDays.end() ) {
+					SaveSegmentBoundaryState( "Serial" );
+				}
+
 			} // ... End day loop.
 
 			// Need one last call to send latest states to middleware
@@ -609,6 +708,10 @@ namespace SimulationManager {
 		} // ... End environment loop.
 
 		WarmupFlag = false;
+		if ( NumSegments > 0 ) WriteSegmentBoundaryStates();
+		if ( Checkpoint::RestartPending ) {
+			ShowFatalError( "ManageSimulation: Environment=\"" + Checkpoint::RestartEnvironmentName + "\" of the checkpoint in " + CheckpointFileName + " was not simulated." );
+		}
 		if ( ! SimsDone && DoDesDaySim ) {
 			if ( ( TotDesDays + TotRunDesPersDays ) == 0 ) { // if sum is 0, then there was no sizing done.
 				ShowWarningError( "ManageSimulation: SizingPeriod:* were requested in SimulationControl but no SizingPeriod:* objects in input." );
@@ -623,6 +726,8 @@ namespace SimulationManager {
 
 		PlantManager::CheckOngoingPlantWarnings();
 
+		if ( SegmentNum > 0 && SplitEnvrnNum > 0 ) FinishSegment( SplitEnvrnNum, SplitEnvrnDays );
+
 		if ( sqlite ) sqlite->sqliteBegin(); // for final data to write
 
 #ifdef EP_Detailed_Timings
@@ -648,10 +753,15 @@ namespace SimulationManager {
 
 		DumpAirLoopStatistics(); // Dump runtime statistics for air loop controller simulation to csv file
 
+		DumpRootSolverStatistics(); // Dump convergence statistics for root solver callers to csv file
+
+		DumpCoilPerfMemoStatistics(); // Dump hit/miss statistics of the memoized DX coil calculations to csv file
+
 #ifdef EP_Detailed_Timings
 		epStopTime( "Closeout Reporting=" );
 #endif
 		CloseOutputFiles();
+		if ( RestartSimulation ) Checkpoint::MergeOutputAfterRestart();
 
 		// sqlite->createZoneExtendedOutput();
 		CreateSQLiteZoneExtendedOutput();
@@ -662,12 +772,320 @@ namespace SimulationManager {
 			sqlite->initializeIndexes(); // do not create indexes (SQL) until all is done.
 		}
 
-		if ( ErrorsFound ) {
+		if ( ManageSimulationErrorsFound ) {
 			ShowFatalError( "Error condition occurred.  Previous Severe Errors cause termination." );
 		}
 
 	}
 
+	void
+	ResumeFromCheckpoint()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Starts the environment of the checkpoint on the day after the checkpoint.
+
+		// METHODOLOGY EMPLOYED:
+		// Warmup is skipped and only the weather is advanced through the days simulated before the
+		// checkpoint.  BeginEnvrnFlag is set again for the first time step that is simulated, so
+		// that the models do their begin environment initializations and then restore their saved
+		// state from the checkpoint.
+
+		// Using/Aliasing
+		using DataEnvironment::CurrentOverallSimDay;
+		using DataEnvironment::EnvironmentName;
+		using General::TrimSigDigits;
+		using OutputProcessor::ResetAccumulationWhenWarmupComplete;
+
+		// Formats
+		static gio::Fmt Format_700( "('Environment:WarmupDays,',I3)" );
+
+		if ( EnvironmentName != Checkpoint::RestartEnvironmentName ) {
+			ShowFatalError( "ResumeFromCheckpoint: The checkpoint in " + CheckpointFileName + " was saved for Environment=\"" + Checkpoint::RestartEnvironmentName + "\", not for Environment=\"" + EnvironmentName + "\"." );
+		}
+		if ( Checkpoint::RestartDayOfSim >= NumOfDayInEnvrn ) {
+			ShowFatalError( "ResumeFromCheckpoint: The checkpoint in " + CheckpointFileName + " is past the end of Environment=\"" + EnvironmentName + "\"." );
+		}
+		DisplayString( "Resuming Simulation after day " + TrimSigDigits( Checkpoint::RestartDayOfSim ) + " of " + EnvironmentName );
+
+		WarmupFlag = false;
+		NumOfWarmupDays = Checkpoint::RestartWarmupDays;
+		gio::write( OutputFileInits, Format_700 ) << NumOfWarmupDays;
+		ResetAccumulationWhenWarmupComplete();
+
+		AdvanceWeather( Checkpoint::RestartDayOfSim );
+
+		CurrentOverallSimDay = Checkpoint::RestartOverallSimDay;
+		OutputReportTabular::GetInputTabularReports();
+		EconomicTariff::GetInputEconomics();
+		Checkpoint::RestoreReportingState();
+
+	}
+
+	void
+	AdvanceWeather( int const LastDay ) // Last day of the environment the weather is advanced through
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Advances the weather of the current environment through LastDay without simulating
+		// the models.
+
+		// METHODOLOGY EMPLOYED:
+		// The time step loops of ManageSimulation are run with only ManageWeather called.
+		// BeginEnvrnFlag is set again at the end so that the models still do their begin
+		// environment initializations in the first time step that is simulated; the weather
+		// manager is kept from starting the environment over in that time step.
+
+		// Using/Aliasing
+		using OutputReportTabular::ResetTabularReports;
+
+		for ( DayOfSim = 1; DayOfSim <= LastDay; ++DayOfSim ) {
+			if ( ( DayOfSim > 365 ) && ( ( NumOfDayInEnvrn - DayOfSim ) == 364 ) ) ResetTabularReports();
+			BeginDayFlag = true;
+			EndDayFlag = false;
+			for ( HourOfDay = 1; HourOfDay <= 24; ++HourOfDay ) {
+				BeginHourFlag = true;
+				EndHourFlag = false;
+				for ( TimeStep = 1; TimeStep <= NumOfTimeStepInHour; ++TimeStep ) {
+					if ( TimeStep == NumOfTimeStepInHour ) {
+						EndHourFlag = true;
+						if ( HourOfDay == 24 ) EndDayFlag = true;
+					}
+					ManageWeather();
+					BeginHourFlag = false;
+					BeginDayFlag = false;
+					BeginEnvrnFlag = false;
+				}
+				PreviousHour = HourOfDay;
+			}
+		}
+
+		DayOfSim = LastDay;
+		BeginEnvrnFlag = true;
+		WeatherAdvanced = ( LastDay > 0 ); // otherwise the weather manager still has to start the environment
+
+	}
+
+	void
+	SegmentDayRange(
+		int const TotalDays, // Number of days in the environment
+		int const StartJDay, // Day of year of the first day of the environment
+		bool const LeapYear, // True if the first year of the environment is a leap year
+		int const NumSegs, // Number of segments the environment is split into
+		int const SegNum, // Segment of interest
+		int & FirstDay, // First day of the segment (day of the environment)
+		int & LastDay // Last day of the segment (day of the environment)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Finds the days of the environment covered by one segment of a run period that is
+		// split into segments simulated separately.
+
+		// METHODOLOGY EMPLOYED:
+		// The environment is split into segments of equal length, and each boundary is then
+		// moved to the nearest end of a month so that the monthly reports of the segments
+		// are complete.  A boundary stays where it is if no end of a month lies between the
+		// neighbouring boundaries.
+
+		// Using/Aliasing
+		using General::InvJulianDay;
+
+		int const LeapYr( LeapYear ? 1 : 0 );
+		int const DaysInYear( 365 + LeapYr );
+
+		int PrevLastDay = 0; // Last day of the previous segment
+		for ( int Seg = 1; Seg <= SegNum; ++Seg ) {
+			FirstDay = PrevLastDay + 1;
+			if ( Seg == NumSegs ) {
+				LastDay = TotalDays;
+				break;
+			}
+			int const EqualLastDay = nint( Real64( Seg ) * TotalDays / NumSegs );
+			int const MaxLastDay = TotalDays - ( NumSegs - Seg ); // leaves a day for each later segment
+			LastDay = max( min( EqualLastDay, MaxLastDay ), FirstDay );
+			int BestDistance = TotalDays;
+			for ( int Day = FirstDay; Day <= MaxLastDay; ++Day ) {
+				int Month;
+				int DayOfMonth;
+				InvJulianDay( ( StartJDay + Day - 1 ) % DaysInYear + 1, Month, DayOfMonth, LeapYr ); // day after Day
+				if ( DayOfMonth != 1 ) continue;
+				if ( std::abs( Day - EqualLastDay ) < BestDistance ) {
+					BestDistance = std::abs( Day - EqualLastDay );
+					LastDay = Day;
+				}
+			}
+			PrevLastDay = LastDay;
+		}
+
+	}
+
+	int
+	StartSegment( int const SegmentStartDay ) // First reported day of the environment
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Starts the environment of a segment of a split run period that does not begin on the
+		// first day of the environment.
+
+		// METHODOLOGY EMPLOYED:
+		// The weather alone is advanced through the days before the first simulated day, which
+		// is then repeated for the warmup like the first day of an environment.  The overlap
+		// days ahead of the segment follow the warmup and are simulated with the reporting
+		// turned off.  Returns the first simulated day.
+
+		// Using/Aliasing
+		using DataEnvironment::CurrentOverallSimDay;
+		using DataEnvironment::EnvironmentName;
+		using General::TrimSigDigits;
+
+		int const FirstDay = max( SegmentStartDay - SegmentOverlapDays, 1 ); // First simulated day
+
+		DisplayString( "Starting Segment " + TrimSigDigits( SegmentNum ) + " of " + TrimSigDigits( NumSegments ) + " at day " + TrimSigDigits( SegmentStartDay ) + " of " + EnvironmentName + " with " + TrimSigDigits( SegmentStartDay - FirstDay ) + " overlap days" );
+
+		if ( FirstDay > 1 ) {
+			WarmupFlag = false; // tomorrow's weather is only read after warmup
+			AdvanceWeather( FirstDay - 1 );
+			WarmupFlag = true;
+			DayOfSim = 0;
+			CurrentOverallSimDay += FirstDay - 1;
+		}
+		if ( FirstDay < SegmentStartDay ) {
+			ReportingAfterOverlap = DoOutputReporting;
+			DoOutputReporting = false;
+		}
+
+		return FirstDay;
+
+	}
+
+	void
+	FinishSegment(
+		int const SplitEnvrn, // Environment split into the segments
+		int const SplitEnvrnDays // Days of the split environment
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Completes the gathering for the tabular reports and the SQLite output of a segment of a
+		// split run period before they are written.
+
+		// METHODOLOGY EMPLOYED:
+		// The later segments save their gathering for the tabular reports and write no tabular
+		// reports.  The first segment, which also simulated the design days, waits for the later
+		// segments, adds their gathering and SQLite records to its own and then writes the
+		// reports of the whole run period that it held back.
+
+		// Using/Aliasing
+		using CommandLineInterface::SegmentFileName;
+		using CommandLineInterface::WaitForLaterSegments;
+		using General::TrimSigDigits;
+
+		NumOfDayInEnvrn = SplitEnvrnDays;
+		if ( SegmentNum > 1 ) {
+			Checkpoint::WriteSegmentReports();
+			OutputReportTabular::WriteTabularFiles = false;
+			return;
+		}
+
+		if ( ! WaitForLaterSegments() ) {
+			ShowFatalError( "FinishSegment: A later segment of Environment=\"" + Environment( SplitEnvrn ).Title + "\" failed, the output of the segments cannot be merged." );
+		}
+		for ( int SegNum = 2; SegNum <= NumSegments; ++SegNum ) {
+			std::string const SegmentReportsFileName( SegmentFileName( DataStringGlobals::outputSegReportsFileName, SegNum ) );
+			if ( ! Checkpoint::MergeSegmentReports( SegmentReportsFileName ) ) {
+				ShowFatalError( "FinishSegment: The tabular report gathering of segment " + TrimSigDigits( SegNum ) + " in " + SegmentReportsFileName + " could not be merged." );
+			}
+			if ( sqlite && ! sqlite->appendReportData( SegmentFileName( DataStringGlobals::outputSqlFileName, SegNum ) ) ) {
+				ShowFatalError( "FinishSegment: The SQLite output of segment " + TrimSigDigits( SegNum ) + " could not be merged." );
+			}
+		}
+		// held back at the end of the first segment
+		ThermalComfort::ReportThermalComfortSimpleASH55();
+		ThermalComfort::ReportSetPointMet();
+
+	}
+
+	void
+	SaveSegmentBoundaryState( std::string const & Boundary ) // Start or End of the segment
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Saves the zone air and inside surface temperatures at a segment boundary, so the state
+		// at the end of a segment can be compared with the state the next segment reached at the
+		// end of its overlap days, and both with the state of the serial reference run.
+
+		SegmentBoundaryStates.emplace_back();
+		SegmentBoundaryStateData & State( SegmentBoundaryStates.back() );
+		State.Boundary = Boundary;
+		State.EnvironmentName = DataEnvironment::EnvironmentName;
+		State.DayOfSim = DayOfSim;
+		State.ZoneAirTemp = DataHeatBalFanSys::MAT;
+		State.SurfaceInsideTemp = DataHeatBalSurface::TempSurfIn;
+
+	}
+
+	void
+	WriteSegmentBoundaryStates()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the saved segment boundary states for the comparison done when the outputs of
+		// the segments are merged.
+
+		std::ofstream SegmentFile( DataStringGlobals::outputSegFileName );
+		SegmentFile << "Segment," << SegmentNum << ',' << NumSegments << ',' << SegmentOverlapDays << '\n';
+		SegmentFile << std::setprecision( 10 );
+		for ( auto const & State : SegmentBoundaryStates ) {
+			SegmentFile << "Boundary," << State.Boundary << ',' << State.EnvironmentName << ',' << State.DayOfSim << ',' << State.ZoneAirTemp.size() << ',' << State.SurfaceInsideTemp.size() << '\n';
+			for ( auto const Temp : State.ZoneAirTemp ) SegmentFile << Temp << '\n';
+			for ( auto const Temp : State.SurfaceInsideTemp ) SegmentFile << Temp << '\n';
+		}
+
+	}
+
 	void
 	GetProjectData()
 	{
@@ -717,7 +1135,7 @@ namespace SimulationManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Array1D_string Alphas( 6 );
-		Array1D< Real64 > Number( 4 );
+		Array1D< Real64 > Number( 6 );
 		int NumAlpha;
 		int NumNumber;
 		int IOStat;
@@ -729,7 +1147,6 @@ namespace SimulationManager {
 		int Num1;
 		int NumA;
 		int NumRunControl;
-		static std::string VersionID;
 		std::string CurrentModuleObject;
 		bool CondFDAlgo;
 		int Item;
@@ -902,6 +1319,27 @@ namespace SimulationManager {
 			if ( MaxPlantSubIterations < 3 ) MaxPlantSubIterations = 3;
 			if ( MinPlantSubIterations > MaxPlantSubIterations ) MaxPlantSubIterations = MinPlantSubIterations + 1;
 
+			if ( lAlphaFieldBlanks( 1 ) || SameString( Alphas( 1 ), "ZoneTemperatureChange" ) ) {
+				SysTimeStepControl = SysTimeStepZoneTempChange;
+			} else if ( SameString( Alphas( 1 ), "TruncationError" ) ) {
+				SysTimeStepControl = SysTimeStepTruncationError;
+			} else {
+				ShowSevereError( CurrentModuleObject + ": Invalid " + cAlphaFieldNames( 1 ) + "=\"" + Alphas( 1 ) + "\"." );
+				ErrorsFound = true;
+			}
+			if ( ! lNumericFieldBlanks( 5 ) ) MaxZoneTempTruncError = Number( 5 );
+			if ( ! lNumericFieldBlanks( 6 ) && Number( 6 ) > 0.0 ) { // not shorter than the minimum system timestep
+				ControlEventTimeStep = min( max( double( int( Number( 6 ) ) ) / 60.0, MinTimeStepSys ), TimeStepZone );
+			}
+			if ( lAlphaFieldBlanks( 2 ) || SameString( Alphas( 2 ), "AllAirLoops" ) ) {
+				ResimChangedAirLoopsOnly = false;
+			} else if ( SameString( Alphas( 2 ), "ChangedAirLoops" ) ) {
+				ResimChangedAirLoopsOnly = true;
+			} else {
+				ShowSevereError( CurrentModuleObject + ": Invalid " + cAlphaFieldNames( 2 ) + "=\"" + Alphas( 2 ) + "\"." );
+				ErrorsFound = true;
+			}
+
 		} else if ( Num == 0 ) {
 			MinTimeStepSys = 1.0 / 60.0;
 			MaxIter = 20;
@@ -1605,19 +2043,18 @@ namespace SimulationManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool Available( false ); // an environment is available to process
 		//  integer :: env_iteration=0
 		//  CHARACTER(len=32) :: cEnvChar
 
 		//  return  ! remove comment to do 'old way'
 
-		Available = true;
+		SetupSimulationAvailable = true;
 
-		while ( Available ) { // do for each environment
+		while ( SetupSimulationAvailable ) { // do for each environment
 
-			GetNextEnvironment( Available, ErrorsFound );
+			GetNextEnvironment( SetupSimulationAvailable, ErrorsFound );
 
-			if ( ! Available ) break;
+			if ( ! SetupSimulationAvailable ) break;
 			if ( ErrorsFound ) break;
 
 			BeginEnvrnFlag = true;
@@ -1899,7 +2336,6 @@ namespace SimulationManager {
 		int Count1;
 		int LoopSideNum;
 		int Num;
-		static bool WarningOut( true );
 		int NumOfControlledZones;
 
 		// Formats
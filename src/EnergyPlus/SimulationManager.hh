@@ -59,6 +59,9 @@
 #ifndef SimulationManager_hh_INCLUDED
 #define SimulationManager_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
 
@@ -88,6 +91,38 @@ namespace SimulationManager {
 	void
 	ManageSimulation();
 
+	void
+	ResumeFromCheckpoint();
+
+	void
+	AdvanceWeather( int const LastDay ); // Last day of the environment the weather is advanced through
+
+	void
+	SegmentDayRange(
+		int const TotalDays, // Number of days in the environment
+		int const StartJDay, // Day of year of the first day of the environment
+		bool const LeapYear, // True if the first year of the environment is a leap year
+		int const NumSegs, // Number of segments the environment is split into
+		int const SegNum, // Segment of interest
+		int & FirstDay, // First day of the segment (day of the environment)
+		int & LastDay // Last day of the segment (day of the environment)
+	);
+
+	int
+	StartSegment( int const SegmentStartDay ); // First reported day of the environment
+
+	void
+	FinishSegment(
+		int const SplitEnvrn, // Environment split into the segments
+		int const SplitEnvrnDays // Days of the split environment
+	);
+
+	void
+	SaveSegmentBoundaryState( std::string const & Boundary ); // Start or End of the segment
+
+	void
+	WriteSegmentBoundaryStates();
+
 	void
 	GetProjectData();
 
@@ -220,6 +220,70 @@ namespace SingleDuct {
 		// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
 		// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
 		bool InitSysFlag( true ); // Flag set to make sure you do begin simulation initializaztions once
+		int GetSysInputSysNum( 0 ); // The Sys that you are currently loading input into
+		int GetSysInputSysIndex( 0 ); // The Sys that you are currently loading input into
+		int NumVAVSys( 0 );
+		int NumNoRHVAVSys( 0 );
+		int NumVAVVS( 0 );
+		int NumCBVAVSys( 0 );
+		int NumNoRHCBVAVSys( 0 );
+		int NumAlphas( 0 );
+		int NumNums( 0 );
+		bool GetSysInputErrorsFound( false ); // If errors detected in input
+		int MaxNums( 0 ); // Maximum number of numeric input fields
+		int MaxAlphas( 0 ); // Maximum number of alpha input fields
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool MySizeFlag;
+		Array1D_bool GetGasElecHeatCoilCap; // Gets autosized value of coil capacity
+		Array1D_bool PlantLoopScanFlag;
+		Real64 CoilInTemp( 0.0 );
+		Real64 DesCoilLoad( 0.0 );
+		Real64 DesZoneHeatLoad( 0.0 );
+		Real64 ZoneDesTemp( 0.0 );
+		Real64 ZoneDesHumRat( 0.0 );
+		int CoilWaterInletNode( 0 );
+		int CoilWaterOutletNode( 0 );
+		int CoilSteamInletNode( 0 );
+		int CoilSteamOutletNode( 0 );
+		int DummyWaterIndex( 1 );
+		Real64 UserInputMaxHeatAirVolFlowRate( 0.0 ); // user input for MaxHeatAirVolFlowRate
+		Real64 MinAirMassFlowRevAct( 0.0 ); // minimum air mass flow rate used in "reverse action" air mass flow rate calculation
+		Real64 MaxAirMassFlowRevAct( 0.0 ); // maximum air mass flow rate used in "reverse action" air mass flow rate calculation
+		Real64 ZoneTemp( 0.0 ); // zone air temperature [C]
+		Real64 MaxHeatTemp( 0.0 ); // maximum supply air temperature [C]
+		Real64 MaxDeviceAirMassFlowReheat( 0.0 ); // air mass flow rate required to meet the coil heating load [W]
+		Real64 MassFlowReqToLimitLeavingTemp( 0.0 ); // air mass flow rate actually used [W]
+		Real64 QZoneMaxRHTempLimit( 0.0 ); // maximum zone heat addition rate given constraints of MaxHeatTemp and max
+		Real64 MinMassAirFlow( 0.0 ); // the air flow rate during heating for normal acting damper
+		Real64 QZoneMax2( 0.0 ); // temporary variable
+		Real64 SimCBVAVZoneTemp( 0.0 ); // zone air temperature [C]
+		Real64 SimCBVAVMaxHeatTemp( 0.0 ); // maximum supply air temperature [C]
+		Real64 MassFlowReq( 0.0 ); // air mass flow rate required to meet the coil heating load [W]
+		Real64 MassFlowActual( 0.0 ); // air mass flow rate actually used [W]
+		Real64 QZoneMax( 0.0 ); // maximum zone heat addition rate given constraints of MaxHeatTemp and max
+		Real64 SimCBVAVMinMassAirFlow( 0.0 ); // the air flow rate during heating for normal acting damper
+		Real64 SimCBVAVQZoneMax2( 0.0 ); // temporary variable
+		Real64 QZoneMax3( 0.0 ); // temporary variable
+		Real64 TAirMax( 0.0 ); // Maximum zone supply air temperature [C]
+		Real64 QMax( 0.0 ); // Maximum heat addition rate imposed by the max zone supply air temperature [W]
+		Real64 SimConstVolZoneTemp( 0.0 ); // Zone temperature [C]
+		Real64 QMax2( 0.0 );
+		int SimATMixerSysNum( 0 );
+		bool GetATMixersErrorsFound( false ); // Error flag
+		Real64 PriMassFlowRate( 0.0 );
+		Real64 PriEnthalpy( 0.0 );
+		Real64 PriHumRat( 0.0 );
+		Real64 PriTemp( 0.0 );
+		Real64 SecAirMassFlowRate( 0.0 );
+		Real64 SecAirEnthalpy( 0.0 );
+		Real64 SecAirHumRat( 0.0 );
+		Real64 SecAirTemp( 0.0 );
+		Real64 MixedAirMassFlowRate( 0.0 );
+		Real64 MixedAirEnthalpy( 0.0 );
+		Real64 MixedAirHumRat( 0.0 );
+		Real64 MixedAirTemp( 0.0 );
 	}
 
 	// MODULE SUBROUTINES:
@@ -230,9 +294,85 @@ namespace SingleDuct {
 	void
 	clear_state()
 	{
+		NumATMixers = 0;
+		MassFlow1.deallocate();
+		MassFlow2.deallocate();
+		MassFlow3.deallocate();
+		MassFlowDiff.deallocate();
 		GetInputFlag = true;
 		GetATMixerFlag = true;
+		NumConstVolSys = 0;
+		CheckEquipName.deallocate();
+		NumSys = 0;
+		Sys.deallocate();
+		SysInlet.deallocate();
+		SysOutlet.deallocate();
+		SysATMixer.deallocate();
 		InitSysFlag = true;
+		GetSysInputSysNum = 0;
+		GetSysInputSysIndex = 0;
+		NumVAVSys = 0;
+		NumNoRHVAVSys = 0;
+		NumVAVVS = 0;
+		NumCBVAVSys = 0;
+		NumNoRHCBVAVSys = 0;
+		NumAlphas = 0;
+		NumNums = 0;
+		GetSysInputErrorsFound = false;
+		MaxNums = 0;
+		MaxAlphas = 0;
+		TotalArgs = 0;
+		ZoneEquipmentListChecked = false;
+		MyEnvrnFlag.deallocate();
+		MySizeFlag.deallocate();
+		GetGasElecHeatCoilCap.deallocate();
+		PlantLoopScanFlag.deallocate();
+		CoilInTemp = 0.0;
+		DesCoilLoad = 0.0;
+		DesZoneHeatLoad = 0.0;
+		ZoneDesTemp = 0.0;
+		ZoneDesHumRat = 0.0;
+		CoilWaterInletNode = 0;
+		CoilWaterOutletNode = 0;
+		CoilSteamInletNode = 0;
+		CoilSteamOutletNode = 0;
+		DummyWaterIndex = 1;
+		UserInputMaxHeatAirVolFlowRate = 0.0;
+		MinAirMassFlowRevAct = 0.0;
+		MaxAirMassFlowRevAct = 0.0;
+		ZoneTemp = 0.0;
+		MaxHeatTemp = 0.0;
+		MaxDeviceAirMassFlowReheat = 0.0;
+		MassFlowReqToLimitLeavingTemp = 0.0;
+		QZoneMaxRHTempLimit = 0.0;
+		MinMassAirFlow = 0.0;
+		QZoneMax2 = 0.0;
+		SimCBVAVZoneTemp = 0.0;
+		SimCBVAVMaxHeatTemp = 0.0;
+		MassFlowReq = 0.0;
+		MassFlowActual = 0.0;
+		QZoneMax = 0.0;
+		SimCBVAVMinMassAirFlow = 0.0;
+		SimCBVAVQZoneMax2 = 0.0;
+		QZoneMax3 = 0.0;
+		TAirMax = 0.0;
+		QMax = 0.0;
+		SimConstVolZoneTemp = 0.0;
+		QMax2 = 0.0;
+		SimATMixerSysNum = 0;
+		GetATMixersErrorsFound = false;
+		PriMassFlowRate = 0.0;
+		PriEnthalpy = 0.0;
+		PriHumRat = 0.0;
+		PriTemp = 0.0;
+		SecAirMassFlowRate = 0.0;
+		SecAirEnthalpy = 0.0;
+		SecAirHumRat = 0.0;
+		SecAirTemp = 0.0;
+		MixedAirMassFlowRate = 0.0;
+		MixedAirEnthalpy = 0.0;
+		MixedAirHumRat = 0.0;
+		MixedAirTemp = 0.0;
 	}
 
 	void
@@ -404,19 +544,9 @@ namespace SingleDuct {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static int SysNum( 0 ); // The Sys that you are currently loading input into
-		static int SysIndex( 0 ); // The Sys that you are currently loading input into
-		static int NumVAVSys( 0 );
-		static int NumNoRHVAVSys( 0 );
-		static int NumVAVVS( 0 );
-		static int NumCBVAVSys( 0 );
-		static int NumNoRHCBVAVSys( 0 );
-		static int NumAlphas( 0 );
-		static int NumNums( 0 );
 		int NumZoneSiz;
 		int ZoneSizIndex;
 		int IOStat;
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int CtrlZone; // controlled zone do loop index
@@ -429,9 +559,6 @@ namespace SingleDuct {
 		Array1D< Real64 > Numbers; // Numeric input items for object
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int MaxNums( 0 ); // Maximum number of numeric input fields
-		static int MaxAlphas( 0 ); // Maximum number of alpha input fields
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 		//  certain object in the input file
 		std::string AirTermSysInletNodeName; // air terminal single duct system inlet node name
 		std::string AirTermSysOutletNodeName; // air terminal single duct system outlet node name
@@ -487,114 +614,114 @@ namespace SingleDuct {
 		lNumericBlanks.dimension( MaxNums, true );
 
 		//Start Loading the System Input
-		for ( SysIndex = 1; SysIndex <= NumVAVSys; ++SysIndex ) {
+		for ( GetSysInputSysIndex = 1; GetSysInputSysIndex <= NumVAVSys; ++GetSysInputSysIndex ) {
 
 			CurrentModuleObject = "AirTerminal:SingleDuct:VAV:Reheat";
 
-			GetObjectItem( CurrentModuleObject, SysIndex, Alphas, NumAlphas, Numbers, NumNums, IOStat, lNumericBlanks, lAlphaBlanks, cAlphaFields, cNumericFields );
+			GetObjectItem( CurrentModuleObject, GetSysInputSysIndex, Alphas, NumAlphas, Numbers, NumNums, IOStat, lNumericBlanks, lAlphaBlanks, cAlphaFields, cNumericFields );
 
-			SysNum = SysIndex;
+			GetSysInputSysNum = GetSysInputSysIndex;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), Sys, &SysDesignParams::SysName, SysNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), Sys, &SysDesignParams::SysName, GetSysInputSysNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetSysInputErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
-			Sys( SysNum ).SysName = Alphas( 1 );
-			Sys( SysNum ).SysType = CurrentModuleObject;
-			Sys( SysNum ).SysType_Num = SingleDuctVAVReheat;
-			Sys( SysNum ).ReheatComp = Alphas( 7 );
-			if ( SameString( Sys( SysNum ).ReheatComp, "Coil:Heating:Fuel" ) ) {
-				Sys( SysNum ).ReheatComp_Num = HCoilType_Gas;
-			} else if ( SameString( Sys( SysNum ).ReheatComp, "Coil:Heating:Electric" ) ) {
-				Sys( SysNum ).ReheatComp_Num = HCoilType_Electric;
-			} else if ( SameString( Sys( SysNum ).ReheatComp, "Coil:Heating:Water" ) ) {
-				Sys( SysNum ).ReheatComp_Num = HCoilType_SimpleHeating;
-				Sys( SysNum ).ReheatComp_PlantType = TypeOf_CoilWaterSimpleHeating;
-			} else if ( SameString( Sys( SysNum ).ReheatComp, "Coil:Heating:Steam" ) ) {
-				Sys( SysNum ).ReheatComp_Num = HCoilType_SteamAirHeating;
-				Sys( SysNum ).ReheatComp_PlantType = TypeOf_CoilSteamAirHeating;
-			} else if ( Sys( SysNum ).ReheatComp != "" ) {
-				ShowSevereError( "Illegal " + cAlphaFields( 8 ) + " = " + Sys( SysNum ).ReheatComp + '.' );
-				ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-				ErrorsFound = true;
-			}
-			Sys( SysNum ).ReheatName = Alphas( 8 );
-			ValidateComponent( Sys( SysNum ).ReheatComp, Sys( SysNum ).ReheatName, IsNotOK, Sys( SysNum ).SysType );
+			Sys( GetSysInputSysNum ).SysName = Alphas( 1 );
+			Sys( GetSysInputSysNum ).SysType = CurrentModuleObject;
+			Sys( GetSysInputSysNum ).SysType_Num = SingleDuctVAVReheat;
+			Sys( GetSysInputSysNum ).ReheatComp = Alphas( 7 );
+			if ( SameString( Sys( GetSysInputSysNum ).ReheatComp, "Coil:Heating:Fuel" ) ) {
+				Sys( GetSysInputSysNum ).ReheatComp_Num = HCoilType_Gas;
+			} else if ( SameString( Sys( GetSysInputSysNum ).ReheatComp, "Coil:Heating:Electric" ) ) {
+				Sys( GetSysInputSysNum ).ReheatComp_Num = HCoilType_Electric;
+			} else if ( SameString( Sys( GetSysInputSysNum ).ReheatComp, "Coil:Heating:Water" ) ) {
+				Sys( GetSysInputSysNum ).ReheatComp_Num = HCoilType_SimpleHeating;
+				Sys( GetSysInputSysNum ).ReheatComp_PlantType = TypeOf_CoilWaterSimpleHeating;
+			} else if ( SameString( Sys( GetSysInputSysNum ).ReheatComp, "Coil:Heating:Steam" ) ) {
+				Sys( GetSysInputSysNum ).ReheatComp_Num = HCoilType_SteamAirHeating;
+				Sys( GetSysInputSysNum ).ReheatComp_PlantType = TypeOf_CoilSteamAirHeating;
+			} else if ( Sys( GetSysInputSysNum ).ReheatComp != "" ) {
+				ShowSevereError( "Illegal " + cAlphaFields( 8 ) + " = " + Sys( GetSysInputSysNum ).ReheatComp + '.' );
+				ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+				GetSysInputErrorsFound = true;
+			}
+			Sys( GetSysInputSysNum ).ReheatName = Alphas( 8 );
+			ValidateComponent( Sys( GetSysInputSysNum ).ReheatComp, Sys( GetSysInputSysNum ).ReheatName, IsNotOK, Sys( GetSysInputSysNum ).SysType );
 			if ( IsNotOK ) {
-				ShowContinueError( "In " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-				ErrorsFound = true;
+				ShowContinueError( "In " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+				GetSysInputErrorsFound = true;
 			}
-			Sys( SysNum ).Schedule = Alphas( 2 );
+			Sys( GetSysInputSysNum ).Schedule = Alphas( 2 );
 			if ( lAlphaBlanks( 2 ) ) {
-				Sys( SysNum ).SchedPtr = ScheduleAlwaysOn;
+				Sys( GetSysInputSysNum ).SchedPtr = ScheduleAlwaysOn;
 			} else {
-				Sys( SysNum ).SchedPtr = GetScheduleIndex( Alphas( 2 ) );
-				if ( Sys( SysNum ).SchedPtr == 0 ) {
+				Sys( GetSysInputSysNum ).SchedPtr = GetScheduleIndex( Alphas( 2 ) );
+				if ( Sys( GetSysInputSysNum ).SchedPtr == 0 ) {
 					ShowSevereError( cAlphaFields( 2 ) + " = " + Alphas( 2 ) + " not found." );
-					ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-					ErrorsFound = true;
+					ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+					GetSysInputErrorsFound = true;
 				}
 			}
 			// For node connections, this object is both a parent and a non-parent, because the
 			// VAV damper is not called out as a separate component, its nodes must be connected
 			// as ObjectIsNotParent.  But for the reheat coil, the nodes are connected as ObjectIsParent
-			Sys( SysNum ).OutletNodeNum = GetOnlySingleNode( Alphas( 3 ), ErrorsFound, Sys( SysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent, cAlphaFields( 3 ) );
-			Sys( SysNum ).InletNodeNum = GetOnlySingleNode( Alphas( 4 ), ErrorsFound, Sys( SysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent, cAlphaFields( 4 ) );
-			Sys( SysNum ).MaxAirVolFlowRate = Numbers( 1 );
+			Sys( GetSysInputSysNum ).OutletNodeNum = GetOnlySingleNode( Alphas( 3 ), GetSysInputErrorsFound, Sys( GetSysInputSysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent, cAlphaFields( 3 ) );
+			Sys( GetSysInputSysNum ).InletNodeNum = GetOnlySingleNode( Alphas( 4 ), GetSysInputErrorsFound, Sys( GetSysInputSysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent, cAlphaFields( 4 ) );
+			Sys( GetSysInputSysNum ).MaxAirVolFlowRate = Numbers( 1 );
 
 			if ( SameString( Alphas( 5 ), "Constant" ) ) {
-				Sys( SysNum ).ZoneMinAirFracMethod = ConstantMinFrac;
+				Sys( GetSysInputSysNum ).ZoneMinAirFracMethod = ConstantMinFrac;
 			} else if ( SameString( Alphas( 5 ), "FixedFlowRate" ) ) {
-				Sys( SysNum ).ZoneMinAirFracMethod = FixedMin;
+				Sys( GetSysInputSysNum ).ZoneMinAirFracMethod = FixedMin;
 			} else if ( SameString( Alphas( 5 ), "Scheduled" ) ) {
-				Sys( SysNum ).ZoneMinAirFracMethod = ScheduledMinFrac;
+				Sys( GetSysInputSysNum ).ZoneMinAirFracMethod = ScheduledMinFrac;
 			} else {
 				ShowSevereError( cAlphaFields( 5 ) + " = " + Alphas( 5 ) + " not found." );
-				ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-				ErrorsFound = true;
+				ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+				GetSysInputErrorsFound = true;
 			}
 
-			Sys( SysNum ).ZoneMinAirFrac = Numbers( 2 );
+			Sys( GetSysInputSysNum ).ZoneMinAirFrac = Numbers( 2 );
 			if ( lNumericBlanks( 2 ) ) {
-				Sys( SysNum ).ConstantMinAirFracSetByUser = false;
-				Sys( SysNum ).DesignMinAirFrac = 0.0;
+				Sys( GetSysInputSysNum ).ConstantMinAirFracSetByUser = false;
+				Sys( GetSysInputSysNum ).DesignMinAirFrac = 0.0;
 			} else {
-				Sys( SysNum ).ConstantMinAirFracSetByUser = true;
-				Sys( SysNum ).DesignMinAirFrac = Numbers( 2 );
-				if ( Sys( SysNum ).ZoneMinAirFracMethod == FixedMin ) {
+				Sys( GetSysInputSysNum ).ConstantMinAirFracSetByUser = true;
+				Sys( GetSysInputSysNum ).DesignMinAirFrac = Numbers( 2 );
+				if ( Sys( GetSysInputSysNum ).ZoneMinAirFracMethod == FixedMin ) {
 					ShowWarningError( "Since " + cAlphaFields( 5 ) + " = " + Alphas( 5 ) + ", input for " + cNumericFields( 2 ) + " will be ignored." );
-					ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-					Sys( SysNum ).ZoneMinAirFrac = 0.0;
+					ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+					Sys( GetSysInputSysNum ).ZoneMinAirFrac = 0.0;
 				}
 			}
 
-			Sys( SysNum ).ZoneFixedMinAir = Numbers( 3 );
+			Sys( GetSysInputSysNum ).ZoneFixedMinAir = Numbers( 3 );
 			if ( lNumericBlanks( 3 ) ) {
-				Sys( SysNum ).FixedMinAirSetByUser = false;
-				Sys( SysNum ).DesignMinAirFrac = 0.0;
+				Sys( GetSysInputSysNum ).FixedMinAirSetByUser = false;
+				Sys( GetSysInputSysNum ).DesignMinAirFrac = 0.0;
 			} else {
-				Sys( SysNum ).FixedMinAirSetByUser = true;
-				Sys( SysNum ).DesignMinAirFrac = Numbers( 3 );
-				if ( Sys( SysNum ).ZoneMinAirFracMethod == ConstantMinFrac ) {
+				Sys( GetSysInputSysNum ).FixedMinAirSetByUser = true;
+				Sys( GetSysInputSysNum ).DesignMinAirFrac = Numbers( 3 );
+				if ( Sys( GetSysInputSysNum ).ZoneMinAirFracMethod == ConstantMinFrac ) {
 					ShowWarningError( "Since " + cAlphaFields( 5 ) + " = " + Alphas( 5 ) + ", input for " + cNumericFields( 3 ) + " will be ignored." );
-					ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-					Sys( SysNum ).ZoneFixedMinAir = 0.0;
+					ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+					Sys( GetSysInputSysNum ).ZoneFixedMinAir = 0.0;
 				}
 			}
 
-			Sys( SysNum ).ZoneMinAirFracSchPtr = GetScheduleIndex( Alphas( 6 ) );
-			if ( ( Sys( SysNum ).ZoneMinAirFracSchPtr == 0 ) && ( Sys( SysNum ).ZoneMinAirFracMethod == ScheduledMinFrac ) ) {
+			Sys( GetSysInputSysNum ).ZoneMinAirFracSchPtr = GetScheduleIndex( Alphas( 6 ) );
+			if ( ( Sys( GetSysInputSysNum ).ZoneMinAirFracSchPtr == 0 ) && ( Sys( GetSysInputSysNum ).ZoneMinAirFracMethod == ScheduledMinFrac ) ) {
 				ShowSevereError( cAlphaFields( 6 ) + " = " + Alphas( 6 ) + " not found." );
-				ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
+				ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
 				ShowContinueError( "A valid schedule is required" );
-				ErrorsFound = true;
-			} else if ( ( Sys( SysNum ).ZoneMinAirFracSchPtr > 0 ) && ( Sys( SysNum ).ZoneMinAirFracMethod == ScheduledMinFrac ) ) {
+				GetSysInputErrorsFound = true;
+			} else if ( ( Sys( GetSysInputSysNum ).ZoneMinAirFracSchPtr > 0 ) && ( Sys( GetSysInputSysNum ).ZoneMinAirFracMethod == ScheduledMinFrac ) ) {
 				// check range of values in schedule
-				if ( ! CheckScheduleValueMinMax( Sys( SysNum ).ZoneMinAirFracSchPtr, ">=", 0.0, "<=", 1.0 ) ) {
+				if ( ! CheckScheduleValueMinMax( Sys( GetSysInputSysNum ).ZoneMinAirFracSchPtr, ">=", 0.0, "<=", 1.0 ) ) {
 					ShowSevereError( "Error found in " + cAlphaFields( 6 ) + " = " + Alphas( 6 ) );
-					ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
+					ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
 					ShowContinueError( "Schedule values must be (>=0., <=1.)" );
 				}
 
@@ -602,203 +729,203 @@ namespace SingleDuct {
 
 			// The reheat coil control node is necessary for hot water and steam reheat, but not necessary for
 			// electric or gas reheat.
-			if ( Sys( SysNum ).ReheatComp_Num != HCoilType_Gas && Sys( SysNum ).ReheatComp_Num != HCoilType_Electric ) {
-				if ( Sys( SysNum ).ReheatComp_Num == HCoilType_SteamAirHeating ) {
+			if ( Sys( GetSysInputSysNum ).ReheatComp_Num != HCoilType_Gas && Sys( GetSysInputSysNum ).ReheatComp_Num != HCoilType_Electric ) {
+				if ( Sys( GetSysInputSysNum ).ReheatComp_Num == HCoilType_SteamAirHeating ) {
 					IsNotOK = false;
-					Sys( SysNum ).ReheatControlNode = GetCoilSteamInletNode( Sys( SysNum ).ReheatComp, Sys( SysNum ).ReheatName, IsNotOK );
+					Sys( GetSysInputSysNum ).ReheatControlNode = GetCoilSteamInletNode( Sys( GetSysInputSysNum ).ReheatComp, Sys( GetSysInputSysNum ).ReheatName, IsNotOK );
 					if ( IsNotOK ) {
-						ShowContinueError( "..Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-						ErrorsFound = true;
+						ShowContinueError( "..Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+						GetSysInputErrorsFound = true;
 					}
 				} else {
 					IsNotOK = false;
-					Sys( SysNum ).ReheatControlNode = GetCoilWaterInletNode( Sys( SysNum ).ReheatComp, Sys( SysNum ).ReheatName, IsNotOK );
+					Sys( GetSysInputSysNum ).ReheatControlNode = GetCoilWaterInletNode( Sys( GetSysInputSysNum ).ReheatComp, Sys( GetSysInputSysNum ).ReheatName, IsNotOK );
 					if ( IsNotOK ) {
-						ShowContinueError( "..Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-						ErrorsFound = true;
+						ShowContinueError( "..Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+						GetSysInputErrorsFound = true;
 					}
 				}
 			}
-			Sys( SysNum ).ReheatAirOutletNode = GetOnlySingleNode( Alphas( 9 ), ErrorsFound, Sys( SysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsParent, cAlphaFields( 9 ) );
-			if ( Sys( SysNum ).ReheatComp_Num == HCoilType_SteamAirHeating ) {
-				Sys( SysNum ).MaxReheatSteamVolFlow = Numbers( 4 );
-				Sys( SysNum ).MinReheatSteamVolFlow = Numbers( 5 );
+			Sys( GetSysInputSysNum ).ReheatAirOutletNode = GetOnlySingleNode( Alphas( 9 ), GetSysInputErrorsFound, Sys( GetSysInputSysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsParent, cAlphaFields( 9 ) );
+			if ( Sys( GetSysInputSysNum ).ReheatComp_Num == HCoilType_SteamAirHeating ) {
+				Sys( GetSysInputSysNum ).MaxReheatSteamVolFlow = Numbers( 4 );
+				Sys( GetSysInputSysNum ).MinReheatSteamVolFlow = Numbers( 5 );
 			} else {
-				Sys( SysNum ).MaxReheatWaterVolFlow = Numbers( 4 );
-				Sys( SysNum ).MinReheatWaterVolFlow = Numbers( 5 );
+				Sys( GetSysInputSysNum ).MaxReheatWaterVolFlow = Numbers( 4 );
+				Sys( GetSysInputSysNum ).MinReheatWaterVolFlow = Numbers( 5 );
 			}
-			Sys( SysNum ).ControllerOffset = Numbers( 6 );
+			Sys( GetSysInputSysNum ).ControllerOffset = Numbers( 6 );
 			// Set default convergence tolerance
-			if ( Sys( SysNum ).ControllerOffset <= 0.0 ) {
-				Sys( SysNum ).ControllerOffset = 0.001;
+			if ( Sys( GetSysInputSysNum ).ControllerOffset <= 0.0 ) {
+				Sys( GetSysInputSysNum ).ControllerOffset = 0.001;
 			}
 
 			if ( SameString( Alphas( 10 ), "Reverse" ) ) {
-				Sys( SysNum ).DamperHeatingAction = ReverseAction;
+				Sys( GetSysInputSysNum ).DamperHeatingAction = ReverseAction;
 			} else if ( SameString( Alphas( 10 ), "Normal" ) ) {
-				Sys( SysNum ).DamperHeatingAction = Normal;
+				Sys( GetSysInputSysNum ).DamperHeatingAction = Normal;
 			} else if ( SameString( Alphas( 10 ), "ReverseWithLimits" ) ) {
-				Sys( SysNum ).DamperHeatingAction = ReverseActionWithLimits;
+				Sys( GetSysInputSysNum ).DamperHeatingAction = ReverseActionWithLimits;
 			}
 			else {
 				ShowSevereError( cAlphaFields( 10 ) + " = " + Alphas( 10 ) + " not found." );
-				ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-				ErrorsFound = true;
+				ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+				GetSysInputErrorsFound = true;
 			}
 
 			// Register component set data
-			TestCompSet( Sys( SysNum ).SysType, Sys( SysNum ).SysName, NodeID( Sys( SysNum ).InletNodeNum ), NodeID( Sys( SysNum ).ReheatAirOutletNode ), "Air Nodes" );
+			TestCompSet( Sys( GetSysInputSysNum ).SysType, Sys( GetSysInputSysNum ).SysName, NodeID( Sys( GetSysInputSysNum ).InletNodeNum ), NodeID( Sys( GetSysInputSysNum ).ReheatAirOutletNode ), "Air Nodes" );
 
 			// Fill the Zone Equipment data with the inlet node number of this unit.
 			for ( CtrlZone = 1; CtrlZone <= NumOfZones; ++CtrlZone ) {
 				if ( ! ZoneEquipConfig( CtrlZone ).IsControlled ) continue;
 				for ( SupAirIn = 1; SupAirIn <= ZoneEquipConfig( CtrlZone ).NumInletNodes; ++SupAirIn ) {
-					if ( Sys( SysNum ).ReheatAirOutletNode == ZoneEquipConfig( CtrlZone ).InletNode( SupAirIn ) ) {
+					if ( Sys( GetSysInputSysNum ).ReheatAirOutletNode == ZoneEquipConfig( CtrlZone ).InletNode( SupAirIn ) ) {
 						if ( ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).OutNode > 0 ) {
 							ShowSevereError( "Error in connecting a terminal unit to a zone" );
-							ShowContinueError( NodeID( Sys( SysNum ).ReheatAirOutletNode ) + " already connects to another zone" );
-							ShowContinueError( "Occurs for terminal unit " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
+							ShowContinueError( NodeID( Sys( GetSysInputSysNum ).ReheatAirOutletNode ) + " already connects to another zone" );
+							ShowContinueError( "Occurs for terminal unit " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
 							ShowContinueError( "Check terminal unit node names for errors" );
-							ErrorsFound = true;
+							GetSysInputErrorsFound = true;
 						} else {
-							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).InNode = Sys( SysNum ).InletNodeNum;
-							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).OutNode = Sys( SysNum ).ReheatAirOutletNode;
+							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).InNode = Sys( GetSysInputSysNum ).InletNodeNum;
+							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).OutNode = Sys( GetSysInputSysNum ).ReheatAirOutletNode;
 						}
 
-						Sys( SysNum ).CtrlZoneNum = CtrlZone;
-						Sys( SysNum ).ActualZoneNum = ZoneEquipConfig( CtrlZone ).ActualZoneNum;
-						Sys( SysNum ).ZoneFloorArea = Zone( Sys( SysNum ).ActualZoneNum ).FloorArea * Zone( Sys( SysNum ).ActualZoneNum ).Multiplier * Zone( Sys( SysNum ).ActualZoneNum ).ListMultiplier;
+						Sys( GetSysInputSysNum ).CtrlZoneNum = CtrlZone;
+						Sys( GetSysInputSysNum ).ActualZoneNum = ZoneEquipConfig( CtrlZone ).ActualZoneNum;
+						Sys( GetSysInputSysNum ).ZoneFloorArea = Zone( Sys( GetSysInputSysNum ).ActualZoneNum ).FloorArea * Zone( Sys( GetSysInputSysNum ).ActualZoneNum ).Multiplier * Zone( Sys( GetSysInputSysNum ).ActualZoneNum ).ListMultiplier;
 
 					}
 				}
 			}
 
 			if ( Numbers( 7 ) == AutoCalculate ) {
-				Sys( SysNum ).MaxAirVolFlowRateDuringReheat = Numbers( 7 );
+				Sys( GetSysInputSysNum ).MaxAirVolFlowRateDuringReheat = Numbers( 7 );
 			} else {
-					Sys( SysNum ).MaxAirVolFlowRateDuringReheat = Numbers( 7 ) * Sys( SysNum ).ZoneFloorArea;
+					Sys( GetSysInputSysNum ).MaxAirVolFlowRateDuringReheat = Numbers( 7 ) * Sys( GetSysInputSysNum ).ZoneFloorArea;
 			}
 
-			Sys( SysNum ).MaxAirVolFractionDuringReheat = Numbers( 8 );
+			Sys( GetSysInputSysNum ).MaxAirVolFractionDuringReheat = Numbers( 8 );
 
-			if ( Sys( SysNum ).DamperHeatingAction != ReverseActionWithLimits ) {
-				if ( Sys( SysNum ).MaxAirVolFlowRateDuringReheat > 0.0 ) {
+			if ( Sys( GetSysInputSysNum ).DamperHeatingAction != ReverseActionWithLimits ) {
+				if ( Sys( GetSysInputSysNum ).MaxAirVolFlowRateDuringReheat > 0.0 ) {
 					ShowWarningError( "Since " + cAlphaFields( 10 ) + " = " + Alphas( 10 ) + ", input for " + cNumericFields( 7 ) + " will be ignored." );
-					ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
+					ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
 				}
-				if ( Sys( SysNum ).MaxAirVolFractionDuringReheat > 0.0 ) {
+				if ( Sys( GetSysInputSysNum ).MaxAirVolFractionDuringReheat > 0.0 ) {
 					ShowWarningError( "Since " + cAlphaFields( 10 ) + " = " + Alphas( 10 ) + ", input for " + cNumericFields( 8 ) + " will be ignored." );
-					ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
+					ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
 				}
 			}
 
 			// Maximum reheat air temperature, i.e. the maximum supply air temperature leaving the reheat coil
 			if ( ! lNumericBlanks( 9 ) ) {
-				Sys( SysNum ).MaxReheatTemp = Numbers( 9 );
-				Sys( SysNum ).MaxReheatTempSetByUser = true;
+				Sys( GetSysInputSysNum ).MaxReheatTemp = Numbers( 9 );
+				Sys( GetSysInputSysNum ).MaxReheatTempSetByUser = true;
 			} else {
 				// user does not specify maximum supply air temperature
 				// Sys(SysNum)%MaxReheatTemp = 35.0D0 !C
-				Sys( SysNum ).MaxReheatTempSetByUser = false;
+				Sys( GetSysInputSysNum ).MaxReheatTempSetByUser = false;
 			}
 
 			if ( ! lAlphaBlanks( 11 ) ) {
-				Sys( SysNum ).OARequirementsPtr = FindItemInList( Alphas( 11 ), OARequirements );
-				if ( Sys( SysNum ).OARequirementsPtr == 0 ) {
+				Sys( GetSysInputSysNum ).OARequirementsPtr = FindItemInList( Alphas( 11 ), OARequirements );
+				if ( Sys( GetSysInputSysNum ).OARequirementsPtr == 0 ) {
 					ShowSevereError( cAlphaFields( 11 ) + " = " + Alphas( 11 ) + " not found." );
-					ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-					ErrorsFound = true;
+					ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+					GetSysInputErrorsFound = true;
 				} else {
-					Sys( SysNum ).NoOAFlowInputFromUser = false;
+					Sys( GetSysInputSysNum ).NoOAFlowInputFromUser = false;
 				}
 			}
 
-			ValidateComponent( Alphas( 7 ), Alphas( 8 ), IsNotOK, Sys( SysNum ).SysType );
+			ValidateComponent( Alphas( 7 ), Alphas( 8 ), IsNotOK, Sys( GetSysInputSysNum ).SysType );
 			if ( IsNotOK ) {
-				ShowContinueError( "In " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-				ErrorsFound = true;
+				ShowContinueError( "In " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+				GetSysInputErrorsFound = true;
 			}
 
 			// Add reheat coil to component sets array
-			SetUpCompSets( Sys( SysNum ).SysType, Sys( SysNum ).SysName, Alphas( 7 ), Alphas( 8 ), Alphas( 3 ), Alphas( 9 ) );
+			SetUpCompSets( Sys( GetSysInputSysNum ).SysType, Sys( GetSysInputSysNum ).SysName, Alphas( 7 ), Alphas( 8 ), Alphas( 3 ), Alphas( 9 ) );
 
 			//Setup the Average damper Position output variable
-			SetupOutputVariable( "Zone Air Terminal VAV Damper Position []", Sys( SysNum ).DamperPosition, "System", "Average", Sys( SysNum ).SysName );
-			SetupOutputVariable( "Zone Air Terminal Minimum Air Flow Fraction []", Sys( SysNum ).ZoneMinAirFracReport, "System", "Average", Sys( SysNum ).SysName );
-			SetupOutputVariable( "Zone Air Terminal Outdoor Air Volume Flow Rate [m3/s]", Sys( SysNum ).OutdoorAirFlowRate, "System", "Average", Sys( SysNum ).SysName );
+			SetupOutputVariable( "Zone Air Terminal VAV Damper Position []", Sys( GetSysInputSysNum ).DamperPosition, "System", "Average", Sys( GetSysInputSysNum ).SysName );
+			SetupOutputVariable( "Zone Air Terminal Minimum Air Flow Fraction []", Sys( GetSysInputSysNum ).ZoneMinAirFracReport, "System", "Average", Sys( GetSysInputSysNum ).SysName );
+			SetupOutputVariable( "Zone Air Terminal Outdoor Air Volume Flow Rate [m3/s]", Sys( GetSysInputSysNum ).OutdoorAirFlowRate, "System", "Average", Sys( GetSysInputSysNum ).SysName );
 
 		} // end Number of Sys Loop
 
-		for ( SysIndex = 1; SysIndex <= NumCBVAVSys; ++SysIndex ) {
+		for ( GetSysInputSysIndex = 1; GetSysInputSysIndex <= NumCBVAVSys; ++GetSysInputSysIndex ) {
 
 			CurrentModuleObject = "AirTerminal:SingleDuct:VAV:HeatAndCool:Reheat";
 
-			GetObjectItem( CurrentModuleObject, SysIndex, Alphas, NumAlphas, Numbers, NumNums, IOStat, lNumericBlanks, lAlphaBlanks, cAlphaFields, cNumericFields );
+			GetObjectItem( CurrentModuleObject, GetSysInputSysIndex, Alphas, NumAlphas, Numbers, NumNums, IOStat, lNumericBlanks, lAlphaBlanks, cAlphaFields, cNumericFields );
 
-			SysNum = SysIndex + NumVAVSys;
+			GetSysInputSysNum = GetSysInputSysIndex + NumVAVSys;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), Sys, &SysDesignParams::SysName, SysNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), Sys, &SysDesignParams::SysName, GetSysInputSysNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetSysInputErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
-			Sys( SysNum ).SysName = Alphas( 1 );
-			Sys( SysNum ).SysType = CurrentModuleObject;
-			Sys( SysNum ).SysType_Num = SingleDuctCBVAVReheat;
-			Sys( SysNum ).ReheatComp = Alphas( 5 );
-			if ( SameString( Sys( SysNum ).ReheatComp, "Coil:Heating:Fuel" ) ) {
-				Sys( SysNum ).ReheatComp_Num = HCoilType_Gas;
-			} else if ( SameString( Sys( SysNum ).ReheatComp, "Coil:Heating:Electric" ) ) {
-				Sys( SysNum ).ReheatComp_Num = HCoilType_Electric;
-			} else if ( SameString( Sys( SysNum ).ReheatComp, "Coil:Heating:Water" ) ) {
-				Sys( SysNum ).ReheatComp_Num = HCoilType_SimpleHeating;
-				Sys( SysNum ).ReheatComp_PlantType = TypeOf_CoilWaterSimpleHeating;
-			} else if ( SameString( Sys( SysNum ).ReheatComp, "Coil:Heating:Steam" ) ) {
-				Sys( SysNum ).ReheatComp_Num = HCoilType_SteamAirHeating;
-				Sys( SysNum ).ReheatComp_PlantType = TypeOf_CoilSteamAirHeating;
-			} else if ( Sys( SysNum ).ReheatComp != "" ) {
-				ShowSevereError( "Illegal " + cAlphaFields( 5 ) + " = " + Sys( SysNum ).ReheatComp + '.' );
-				ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-				ErrorsFound = true;
-			}
-			Sys( SysNum ).ReheatName = Alphas( 6 );
-			ValidateComponent( Sys( SysNum ).ReheatComp, Sys( SysNum ).ReheatName, IsNotOK, Sys( SysNum ).SysType );
+			Sys( GetSysInputSysNum ).SysName = Alphas( 1 );
+			Sys( GetSysInputSysNum ).SysType = CurrentModuleObject;
+			Sys( GetSysInputSysNum ).SysType_Num = SingleDuctCBVAVReheat;
+			Sys( GetSysInputSysNum ).ReheatComp = Alphas( 5 );
+			if ( SameString( Sys( GetSysInputSysNum ).ReheatComp, "Coil:Heating:Fuel" ) ) {
+				Sys( GetSysInputSysNum ).ReheatComp_Num = HCoilType_Gas;
+			} else if ( SameString( Sys( GetSysInputSysNum ).ReheatComp, "Coil:Heating:Electric" ) ) {
+				Sys( GetSysInputSysNum ).ReheatComp_Num = HCoilType_Electric;
+			} else if ( SameString( Sys( GetSysInputSysNum ).ReheatComp, "Coil:Heating:Water" ) ) {
+				Sys( GetSysInputSysNum ).ReheatComp_Num = HCoilType_SimpleHeating;
+				Sys( GetSysInputSysNum ).ReheatComp_PlantType = TypeOf_CoilWaterSimpleHeating;
+			} else if ( SameString( Sys( GetSysInputSysNum ).ReheatComp, "Coil:Heating:Steam" ) ) {
+				Sys( GetSysInputSysNum ).ReheatComp_Num = HCoilType_SteamAirHeating;
+				Sys( GetSysInputSysNum ).ReheatComp_PlantType = TypeOf_CoilSteamAirHeating;
+			} else if ( Sys( GetSysInputSysNum ).ReheatComp != "" ) {
+				ShowSevereError( "Illegal " + cAlphaFields( 5 ) + " = " + Sys( GetSysInputSysNum ).ReheatComp + '.' );
+				ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+				GetSysInputErrorsFound = true;
+			}
+			Sys( GetSysInputSysNum ).ReheatName = Alphas( 6 );
+			ValidateComponent( Sys( GetSysInputSysNum ).ReheatComp, Sys( GetSysInputSysNum ).ReheatName, IsNotOK, Sys( GetSysInputSysNum ).SysType );
 			if ( IsNotOK ) {
-				ShowContinueError( "In " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-				ErrorsFound = true;
+				ShowContinueError( "In " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+				GetSysInputErrorsFound = true;
 			}
-			Sys( SysNum ).Schedule = Alphas( 2 );
+			Sys( GetSysInputSysNum ).Schedule = Alphas( 2 );
 			if ( lAlphaBlanks( 2 ) ) {
-				Sys( SysNum ).SchedPtr = ScheduleAlwaysOn;
+				Sys( GetSysInputSysNum ).SchedPtr = ScheduleAlwaysOn;
 			} else {
-				Sys( SysNum ).SchedPtr = GetScheduleIndex( Alphas( 2 ) );
-				if ( Sys( SysNum ).SchedPtr == 0 ) {
+				Sys( GetSysInputSysNum ).SchedPtr = GetScheduleIndex( Alphas( 2 ) );
+				if ( Sys( GetSysInputSysNum ).SchedPtr == 0 ) {
 					ShowSevereError( cAlphaFields( 2 ) + " = " + Alphas( 2 ) + " not found." );
-					ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-					ErrorsFound = true;
+					ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+					GetSysInputErrorsFound = true;
 				}
 			}
 			// For node connections, this object is both a parent and a non-parent, because the
 			// VAV damper is not called out as a separate component, its nodes must be connected
 			// as ObjectIsNotParent.  But for the reheat coil, the nodes are connected as ObjectIsParent
-			Sys( SysNum ).OutletNodeNum = GetOnlySingleNode( Alphas( 3 ), ErrorsFound, Sys( SysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent, cAlphaFields( 3 ) );
-			Sys( SysNum ).InletNodeNum = GetOnlySingleNode( Alphas( 4 ), ErrorsFound, Sys( SysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent, cAlphaFields( 4 ) );
-			Sys( SysNum ).MaxAirVolFlowRate = Numbers( 1 );
-			Sys( SysNum ).ZoneMinAirFrac = Numbers( 2 );
-			if ( Sys( SysNum ).ZoneMinAirFrac < 0.0 ) {
-				ShowWarningError( Sys( SysNum ).SysType + " \"" + Sys( SysNum ).SysName + "\"" );
+			Sys( GetSysInputSysNum ).OutletNodeNum = GetOnlySingleNode( Alphas( 3 ), GetSysInputErrorsFound, Sys( GetSysInputSysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent, cAlphaFields( 3 ) );
+			Sys( GetSysInputSysNum ).InletNodeNum = GetOnlySingleNode( Alphas( 4 ), GetSysInputErrorsFound, Sys( GetSysInputSysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent, cAlphaFields( 4 ) );
+			Sys( GetSysInputSysNum ).MaxAirVolFlowRate = Numbers( 1 );
+			Sys( GetSysInputSysNum ).ZoneMinAirFrac = Numbers( 2 );
+			if ( Sys( GetSysInputSysNum ).ZoneMinAirFrac < 0.0 ) {
+				ShowWarningError( Sys( GetSysInputSysNum ).SysType + " \"" + Sys( GetSysInputSysNum ).SysName + "\"" );
 				ShowContinueError( cNumericFields( 2 ) + " must be greater than or equal to 0. Resetting to 0 and the simulation continues." );
-				Sys( SysNum ).ZoneMinAirFrac = 0.0;
+				Sys( GetSysInputSysNum ).ZoneMinAirFrac = 0.0;
 			}
-			if ( Sys( SysNum ).ZoneMinAirFrac > 1.0 ) {
-				ShowWarningError( Sys( SysNum ).SysType + " \"" + Sys( SysNum ).SysName + "\"" );
+			if ( Sys( GetSysInputSysNum ).ZoneMinAirFrac > 1.0 ) {
+				ShowWarningError( Sys( GetSysInputSysNum ).SysType + " \"" + Sys( GetSysInputSysNum ).SysName + "\"" );
 				ShowContinueError( cNumericFields( 2 ) + " must be less than or equal to 1. Resetting to 1 and the simulation continues." );
-				Sys( SysNum ).ZoneMinAirFrac = 1.0;
+				Sys( GetSysInputSysNum ).ZoneMinAirFrac = 1.0;
 			}
 			// The reheat coil control node is necessary for hot water and steam reheat, but not necessary for
 			// electric or gas reheat.
-			if ( Sys( SysNum ).ReheatComp_Num == HCoilType_Gas || Sys( SysNum ).ReheatComp_Num == HCoilType_Electric ) {
+			if ( Sys( GetSysInputSysNum ).ReheatComp_Num == HCoilType_Gas || Sys( GetSysInputSysNum ).ReheatComp_Num == HCoilType_Electric ) {
 				//          IF(.NOT. lAlphaBlanks(5)) THEN
 				//            CALL ShowWarningError('In '//TRIM(Sys(SysNum)%SysType)//' = ' //TRIM(Sys(SysNum)%SysName) &
 				//                                 // ' the '//TRIM(cAlphaFields(5))//' is not needed and will be ignored.')
@@ -810,143 +937,143 @@ namespace SingleDuct {
 				//                                 // ' the '//TRIM(cAlphaFields(5))//' is undefined.')
 				//            ErrorsFound=.TRUE.
 				//          ELSE
-				if ( Sys( SysNum ).ReheatComp_Num == HCoilType_SteamAirHeating ) {
+				if ( Sys( GetSysInputSysNum ).ReheatComp_Num == HCoilType_SteamAirHeating ) {
 					IsNotOK = false;
-					Sys( SysNum ).ReheatControlNode = GetCoilSteamInletNode( Sys( SysNum ).ReheatComp, Sys( SysNum ).ReheatName, IsNotOK );
+					Sys( GetSysInputSysNum ).ReheatControlNode = GetCoilSteamInletNode( Sys( GetSysInputSysNum ).ReheatComp, Sys( GetSysInputSysNum ).ReheatName, IsNotOK );
 					if ( IsNotOK ) {
-						ShowContinueError( "..Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-						ErrorsFound = true;
+						ShowContinueError( "..Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+						GetSysInputErrorsFound = true;
 					}
 					//                GetOnlySingleNode(Alphas(5),ErrorsFound,Sys(SysNum)%SysType,Alphas(1), &
 					//                              NodeType_Steam,NodeConnectionType_Actuator,1,ObjectIsParent)
 				} else {
 					IsNotOK = false;
-					Sys( SysNum ).ReheatControlNode = GetCoilWaterInletNode( Sys( SysNum ).ReheatComp, Sys( SysNum ).ReheatName, IsNotOK );
+					Sys( GetSysInputSysNum ).ReheatControlNode = GetCoilWaterInletNode( Sys( GetSysInputSysNum ).ReheatComp, Sys( GetSysInputSysNum ).ReheatName, IsNotOK );
 					if ( IsNotOK ) {
-						ShowContinueError( "..Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-						ErrorsFound = true;
+						ShowContinueError( "..Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+						GetSysInputErrorsFound = true;
 					}
 					//                GetOnlySingleNode(Alphas(5),ErrorsFound,Sys(SysNum)%SysType,Alphas(1), &
 					//                              NodeType_Water,NodeConnectionType_Actuator,1,ObjectIsParent)
 				}
 				//  END IF
 			}
-			Sys( SysNum ).ReheatAirOutletNode = GetOnlySingleNode( Alphas( 7 ), ErrorsFound, Sys( SysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsParent, cAlphaFields( 7 ) );
-			if ( Sys( SysNum ).ReheatComp_Num == HCoilType_SteamAirHeating ) {
-				Sys( SysNum ).MaxReheatSteamVolFlow = Numbers( 3 );
-				Sys( SysNum ).MinReheatSteamVolFlow = Numbers( 4 );
+			Sys( GetSysInputSysNum ).ReheatAirOutletNode = GetOnlySingleNode( Alphas( 7 ), GetSysInputErrorsFound, Sys( GetSysInputSysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsParent, cAlphaFields( 7 ) );
+			if ( Sys( GetSysInputSysNum ).ReheatComp_Num == HCoilType_SteamAirHeating ) {
+				Sys( GetSysInputSysNum ).MaxReheatSteamVolFlow = Numbers( 3 );
+				Sys( GetSysInputSysNum ).MinReheatSteamVolFlow = Numbers( 4 );
 			} else {
-				Sys( SysNum ).MaxReheatWaterVolFlow = Numbers( 3 );
-				Sys( SysNum ).MinReheatWaterVolFlow = Numbers( 4 );
+				Sys( GetSysInputSysNum ).MaxReheatWaterVolFlow = Numbers( 3 );
+				Sys( GetSysInputSysNum ).MinReheatWaterVolFlow = Numbers( 4 );
 			}
-			Sys( SysNum ).ControllerOffset = Numbers( 5 );
+			Sys( GetSysInputSysNum ).ControllerOffset = Numbers( 5 );
 			// Set default convergence tolerance
-			if ( Sys( SysNum ).ControllerOffset <= 0.0 ) {
-				Sys( SysNum ).ControllerOffset = 0.001;
+			if ( Sys( GetSysInputSysNum ).ControllerOffset <= 0.0 ) {
+				Sys( GetSysInputSysNum ).ControllerOffset = 0.001;
 			}
 
-			Sys( SysNum ).DamperHeatingAction = ReverseAction;
+			Sys( GetSysInputSysNum ).DamperHeatingAction = ReverseAction;
 
 			// Register component set data
-			TestCompSet( Sys( SysNum ).SysType, Sys( SysNum ).SysName, NodeID( Sys( SysNum ).InletNodeNum ), NodeID( Sys( SysNum ).ReheatAirOutletNode ), "Air Nodes" );
+			TestCompSet( Sys( GetSysInputSysNum ).SysType, Sys( GetSysInputSysNum ).SysName, NodeID( Sys( GetSysInputSysNum ).InletNodeNum ), NodeID( Sys( GetSysInputSysNum ).ReheatAirOutletNode ), "Air Nodes" );
 
 			// Fill the Zone Equipment data with the inlet node number of this unit
 			for ( CtrlZone = 1; CtrlZone <= NumOfZones; ++CtrlZone ) {
 				if ( ! ZoneEquipConfig( CtrlZone ).IsControlled ) continue;
 				for ( SupAirIn = 1; SupAirIn <= ZoneEquipConfig( CtrlZone ).NumInletNodes; ++SupAirIn ) {
-					if ( Sys( SysNum ).ReheatAirOutletNode == ZoneEquipConfig( CtrlZone ).InletNode( SupAirIn ) ) {
+					if ( Sys( GetSysInputSysNum ).ReheatAirOutletNode == ZoneEquipConfig( CtrlZone ).InletNode( SupAirIn ) ) {
 						if ( ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).OutNode > 0 ) {
 							ShowSevereError( "Error in connecting a terminal unit to a zone" );
-							ShowContinueError( NodeID( Sys( SysNum ).ReheatAirOutletNode ) + " already connects to another zone" );
-							ShowContinueError( "Occurs for terminal unit " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
+							ShowContinueError( NodeID( Sys( GetSysInputSysNum ).ReheatAirOutletNode ) + " already connects to another zone" );
+							ShowContinueError( "Occurs for terminal unit " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
 							ShowContinueError( "Check terminal unit node names for errors" );
-							ErrorsFound = true;
+							GetSysInputErrorsFound = true;
 						} else {
-							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).InNode = Sys( SysNum ).InletNodeNum;
-							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).OutNode = Sys( SysNum ).ReheatAirOutletNode;
+							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).InNode = Sys( GetSysInputSysNum ).InletNodeNum;
+							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).OutNode = Sys( GetSysInputSysNum ).ReheatAirOutletNode;
 						}
 					}
 				}
 			}
 
 			if ( ! lNumericBlanks( 6 ) ) {
-				Sys( SysNum ).MaxReheatTemp = Numbers( 6 );
-				Sys( SysNum ).MaxReheatTempSetByUser = true;
+				Sys( GetSysInputSysNum ).MaxReheatTemp = Numbers( 6 );
+				Sys( GetSysInputSysNum ).MaxReheatTempSetByUser = true;
 			} else {
 				// user does not specify maximum supply air temperature
 				// Sys(SysNum)%MaxReheatTemp = 35.0D0 !C
-				Sys( SysNum ).MaxReheatTempSetByUser = false;
+				Sys( GetSysInputSysNum ).MaxReheatTempSetByUser = false;
 			}
 
-			ValidateComponent( Alphas( 5 ), Alphas( 6 ), IsNotOK, Sys( SysNum ).SysType );
+			ValidateComponent( Alphas( 5 ), Alphas( 6 ), IsNotOK, Sys( GetSysInputSysNum ).SysType );
 			if ( IsNotOK ) {
-				ShowContinueError( "In " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-				ErrorsFound = true;
+				ShowContinueError( "In " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+				GetSysInputErrorsFound = true;
 			}
 
 			// Add reheat coil to component sets array
-			SetUpCompSets( Sys( SysNum ).SysType, Sys( SysNum ).SysName, Alphas( 5 ), Alphas( 6 ), Alphas( 3 ), Alphas( 7 ) );
+			SetUpCompSets( Sys( GetSysInputSysNum ).SysType, Sys( GetSysInputSysNum ).SysName, Alphas( 5 ), Alphas( 6 ), Alphas( 3 ), Alphas( 7 ) );
 
 			//Setup the Average damper Position output variable
-			SetupOutputVariable( "Zone Air Terminal VAV Damper Position []", Sys( SysNum ).DamperPosition, "System", "Average", Sys( SysNum ).SysName );
+			SetupOutputVariable( "Zone Air Terminal VAV Damper Position []", Sys( GetSysInputSysNum ).DamperPosition, "System", "Average", Sys( GetSysInputSysNum ).SysName );
 
 		} // end Number of VAVHeatandCool Sys Loop
 
 		CurrentModuleObject = "AirTerminal:SingleDuct:ConstantVolume:Reheat";
 
-		for ( SysIndex = 1; SysIndex <= NumConstVolSys; ++SysIndex ) {
+		for ( GetSysInputSysIndex = 1; GetSysInputSysIndex <= NumConstVolSys; ++GetSysInputSysIndex ) {
 
-			GetObjectItem( CurrentModuleObject, SysIndex, Alphas, NumAlphas, Numbers, NumNums, IOStat, lNumericBlanks, lAlphaBlanks, cAlphaFields, cNumericFields );
+			GetObjectItem( CurrentModuleObject, GetSysInputSysIndex, Alphas, NumAlphas, Numbers, NumNums, IOStat, lNumericBlanks, lAlphaBlanks, cAlphaFields, cNumericFields );
 
-			SysNum = SysIndex + NumVAVSys + NumCBVAVSys;
+			GetSysInputSysNum = GetSysInputSysIndex + NumVAVSys + NumCBVAVSys;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), Sys, &SysDesignParams::SysName, SysNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), Sys, &SysDesignParams::SysName, GetSysInputSysNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetSysInputErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
-			Sys( SysNum ).SysName = Alphas( 1 );
-			Sys( SysNum ).SysType = CurrentModuleObject;
-			Sys( SysNum ).SysType_Num = SingleDuctConstVolReheat;
-			Sys( SysNum ).ReheatComp = Alphas( 5 );
-			if ( SameString( Sys( SysNum ).ReheatComp, "Coil:Heating:Fuel" ) ) {
-				Sys( SysNum ).ReheatComp_Num = HCoilType_Gas;
-			} else if ( SameString( Sys( SysNum ).ReheatComp, "Coil:Heating:Electric" ) ) {
-				Sys( SysNum ).ReheatComp_Num = HCoilType_Electric;
-			} else if ( SameString( Sys( SysNum ).ReheatComp, "Coil:Heating:Water" ) ) {
-				Sys( SysNum ).ReheatComp_Num = HCoilType_SimpleHeating;
-				Sys( SysNum ).ReheatComp_PlantType = TypeOf_CoilWaterSimpleHeating;
-			} else if ( SameString( Sys( SysNum ).ReheatComp, "Coil:Heating:Steam" ) ) {
-				Sys( SysNum ).ReheatComp_Num = HCoilType_SteamAirHeating;
-				Sys( SysNum ).ReheatComp_PlantType = TypeOf_CoilSteamAirHeating;
+			Sys( GetSysInputSysNum ).SysName = Alphas( 1 );
+			Sys( GetSysInputSysNum ).SysType = CurrentModuleObject;
+			Sys( GetSysInputSysNum ).SysType_Num = SingleDuctConstVolReheat;
+			Sys( GetSysInputSysNum ).ReheatComp = Alphas( 5 );
+			if ( SameString( Sys( GetSysInputSysNum ).ReheatComp, "Coil:Heating:Fuel" ) ) {
+				Sys( GetSysInputSysNum ).ReheatComp_Num = HCoilType_Gas;
+			} else if ( SameString( Sys( GetSysInputSysNum ).ReheatComp, "Coil:Heating:Electric" ) ) {
+				Sys( GetSysInputSysNum ).ReheatComp_Num = HCoilType_Electric;
+			} else if ( SameString( Sys( GetSysInputSysNum ).ReheatComp, "Coil:Heating:Water" ) ) {
+				Sys( GetSysInputSysNum ).ReheatComp_Num = HCoilType_SimpleHeating;
+				Sys( GetSysInputSysNum ).ReheatComp_PlantType = TypeOf_CoilWaterSimpleHeating;
+			} else if ( SameString( Sys( GetSysInputSysNum ).ReheatComp, "Coil:Heating:Steam" ) ) {
+				Sys( GetSysInputSysNum ).ReheatComp_Num = HCoilType_SteamAirHeating;
+				Sys( GetSysInputSysNum ).ReheatComp_PlantType = TypeOf_CoilSteamAirHeating;
 			} else {
-				ShowSevereError( "Illegal " + cAlphaFields( 5 ) + " = " + Sys( SysNum ).ReheatComp + '.' );
-				ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-				ErrorsFound = true;
+				ShowSevereError( "Illegal " + cAlphaFields( 5 ) + " = " + Sys( GetSysInputSysNum ).ReheatComp + '.' );
+				ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+				GetSysInputErrorsFound = true;
 			}
-			Sys( SysNum ).ReheatName = Alphas( 6 );
-			ValidateComponent( Sys( SysNum ).ReheatComp, Sys( SysNum ).ReheatName, IsNotOK, Sys( SysNum ).SysType );
+			Sys( GetSysInputSysNum ).ReheatName = Alphas( 6 );
+			ValidateComponent( Sys( GetSysInputSysNum ).ReheatComp, Sys( GetSysInputSysNum ).ReheatName, IsNotOK, Sys( GetSysInputSysNum ).SysType );
 			if ( IsNotOK ) {
-				ShowContinueError( "In " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-				ErrorsFound = true;
+				ShowContinueError( "In " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+				GetSysInputErrorsFound = true;
 			}
-			Sys( SysNum ).Schedule = Alphas( 2 );
+			Sys( GetSysInputSysNum ).Schedule = Alphas( 2 );
 			if ( lAlphaBlanks( 2 ) ) {
-				Sys( SysNum ).SchedPtr = ScheduleAlwaysOn;
+				Sys( GetSysInputSysNum ).SchedPtr = ScheduleAlwaysOn;
 			} else {
-				Sys( SysNum ).SchedPtr = GetScheduleIndex( Alphas( 2 ) );
-				if ( Sys( SysNum ).SchedPtr == 0 ) {
+				Sys( GetSysInputSysNum ).SchedPtr = GetScheduleIndex( Alphas( 2 ) );
+				if ( Sys( GetSysInputSysNum ).SchedPtr == 0 ) {
 					ShowSevereError( cAlphaFields( 2 ) + " = " + Alphas( 2 ) + " not found." );
-					ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-					ErrorsFound = true;
+					ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+					GetSysInputErrorsFound = true;
 				}
 			}
-			Sys( SysNum ).OutletNodeNum = GetOnlySingleNode( Alphas( 3 ), ErrorsFound, Sys( SysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsParent, cAlphaFields( 3 ) );
-			Sys( SysNum ).InletNodeNum = GetOnlySingleNode( Alphas( 4 ), ErrorsFound, Sys( SysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsParent, cAlphaFields( 4 ) );
+			Sys( GetSysInputSysNum ).OutletNodeNum = GetOnlySingleNode( Alphas( 3 ), GetSysInputErrorsFound, Sys( GetSysInputSysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsParent, cAlphaFields( 3 ) );
+			Sys( GetSysInputSysNum ).InletNodeNum = GetOnlySingleNode( Alphas( 4 ), GetSysInputErrorsFound, Sys( GetSysInputSysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsParent, cAlphaFields( 4 ) );
 			// The reheat coil control node is necessary for hot water reheat, but not necessary for
 			// electric or gas reheat.
-			if ( Sys( SysNum ).ReheatComp_Num == HCoilType_Gas || Sys( SysNum ).ReheatComp_Num == HCoilType_Electric ) {
+			if ( Sys( GetSysInputSysNum ).ReheatComp_Num == HCoilType_Gas || Sys( GetSysInputSysNum ).ReheatComp_Num == HCoilType_Electric ) {
 				//          IF(.NOT. lAlphaBlanks(5)) THEN
 				//            CALL ShowWarningError('In '//TRIM(Sys(SysNum)%SysType)//' = ' // TRIM(Sys(SysNum)%SysName) &
 				//                                 // ' the '//TRIM(cAlphaFields(5))//' is not needed and will be ignored.')
@@ -958,83 +1085,83 @@ namespace SingleDuct {
 				//                                 // ' the '//TRIM(cAlphaFields(5))//' is undefined.')
 				//            ErrorsFound=.TRUE.
 				//          END IF
-				if ( Sys( SysNum ).ReheatComp_Num == HCoilType_SteamAirHeating ) {
+				if ( Sys( GetSysInputSysNum ).ReheatComp_Num == HCoilType_SteamAirHeating ) {
 					IsNotOK = false;
-					Sys( SysNum ).ReheatControlNode = GetCoilSteamInletNode( Sys( SysNum ).ReheatComp, Sys( SysNum ).ReheatName, IsNotOK );
+					Sys( GetSysInputSysNum ).ReheatControlNode = GetCoilSteamInletNode( Sys( GetSysInputSysNum ).ReheatComp, Sys( GetSysInputSysNum ).ReheatName, IsNotOK );
 					if ( IsNotOK ) {
-						ShowContinueError( "..Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-						ErrorsFound = true;
+						ShowContinueError( "..Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+						GetSysInputErrorsFound = true;
 					}
 					//                 GetOnlySingleNode(Alphas(5),ErrorsFound,Sys(SysNum)%SysType,Alphas(1), &
 					//                               NodeType_Steam,NodeConnectionType_Actuator,1,ObjectIsParent)
 				} else {
 					IsNotOK = false;
-					Sys( SysNum ).ReheatControlNode = GetCoilWaterInletNode( Sys( SysNum ).ReheatComp, Sys( SysNum ).ReheatName, IsNotOK );
+					Sys( GetSysInputSysNum ).ReheatControlNode = GetCoilWaterInletNode( Sys( GetSysInputSysNum ).ReheatComp, Sys( GetSysInputSysNum ).ReheatName, IsNotOK );
 					if ( IsNotOK ) {
-						ShowContinueError( "..Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-						ErrorsFound = true;
+						ShowContinueError( "..Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+						GetSysInputErrorsFound = true;
 					}
 					//                 GetOnlySingleNode(Alphas(5),ErrorsFound,Sys(SysNum)%SysType,Alphas(1), &
 					//                               NodeType_Water,NodeConnectionType_Actuator,1,ObjectIsParent)
 				}
 			}
-			Sys( SysNum ).ReheatAirOutletNode = Sys( SysNum ).OutletNodeNum;
-			Sys( SysNum ).MaxAirVolFlowRate = Numbers( 1 );
-			Sys( SysNum ).ZoneMinAirFrac = 0.0;
-			Sys( SysNum ).ZoneMinAirFracMethod = MinFracNotUsed;
-			Sys( SysNum ).DamperHeatingAction = HeatingActionNotUsed;
-			if ( Sys( SysNum ).ReheatComp_Num == HCoilType_SteamAirHeating ) {
-				Sys( SysNum ).MaxReheatSteamVolFlow = Numbers( 2 );
-				Sys( SysNum ).MinReheatSteamVolFlow = Numbers( 3 );
+			Sys( GetSysInputSysNum ).ReheatAirOutletNode = Sys( GetSysInputSysNum ).OutletNodeNum;
+			Sys( GetSysInputSysNum ).MaxAirVolFlowRate = Numbers( 1 );
+			Sys( GetSysInputSysNum ).ZoneMinAirFrac = 0.0;
+			Sys( GetSysInputSysNum ).ZoneMinAirFracMethod = MinFracNotUsed;
+			Sys( GetSysInputSysNum ).DamperHeatingAction = HeatingActionNotUsed;
+			if ( Sys( GetSysInputSysNum ).ReheatComp_Num == HCoilType_SteamAirHeating ) {
+				Sys( GetSysInputSysNum ).MaxReheatSteamVolFlow = Numbers( 2 );
+				Sys( GetSysInputSysNum ).MinReheatSteamVolFlow = Numbers( 3 );
 			} else {
-				Sys( SysNum ).MaxReheatWaterVolFlow = Numbers( 2 );
-				Sys( SysNum ).MinReheatWaterVolFlow = Numbers( 3 );
+				Sys( GetSysInputSysNum ).MaxReheatWaterVolFlow = Numbers( 2 );
+				Sys( GetSysInputSysNum ).MinReheatWaterVolFlow = Numbers( 3 );
 			}
-			Sys( SysNum ).ControllerOffset = Numbers( 4 );
+			Sys( GetSysInputSysNum ).ControllerOffset = Numbers( 4 );
 			// Set default convergence tolerance
-			if ( Sys( SysNum ).ControllerOffset <= 0.0 ) {
-				Sys( SysNum ).ControllerOffset = 0.001;
+			if ( Sys( GetSysInputSysNum ).ControllerOffset <= 0.0 ) {
+				Sys( GetSysInputSysNum ).ControllerOffset = 0.001;
 			}
 
 			// Maximum reheat air temperature, i.e. the maximum supply air temperature leaving the reheat coil
 			if ( ! lNumericBlanks( 5 ) ) {
-				Sys( SysNum ).MaxReheatTemp = Numbers( 5 );
-				Sys( SysNum ).MaxReheatTempSetByUser = true;
+				Sys( GetSysInputSysNum ).MaxReheatTemp = Numbers( 5 );
+				Sys( GetSysInputSysNum ).MaxReheatTempSetByUser = true;
 			} else {
 				// user does not specify maximum supply air temperature
 				// Sys(SysNum)%MaxReheatTemp = 35.0D0 !C
-				Sys( SysNum ).MaxReheatTempSetByUser = false;
+				Sys( GetSysInputSysNum ).MaxReheatTempSetByUser = false;
 			}
 			// Register component set data
-			TestCompSet( Sys( SysNum ).SysType, Sys( SysNum ).SysName, NodeID( Sys( SysNum ).InletNodeNum ), NodeID( Sys( SysNum ).OutletNodeNum ), "Air Nodes" );
+			TestCompSet( Sys( GetSysInputSysNum ).SysType, Sys( GetSysInputSysNum ).SysName, NodeID( Sys( GetSysInputSysNum ).InletNodeNum ), NodeID( Sys( GetSysInputSysNum ).OutletNodeNum ), "Air Nodes" );
 
 			// Fill the Zone Equipment data with the inlet node number of this unit.
 			for ( CtrlZone = 1; CtrlZone <= NumOfZones; ++CtrlZone ) {
 				if ( ! ZoneEquipConfig( CtrlZone ).IsControlled ) continue;
 				for ( SupAirIn = 1; SupAirIn <= ZoneEquipConfig( CtrlZone ).NumInletNodes; ++SupAirIn ) {
-					if ( Sys( SysNum ).OutletNodeNum == ZoneEquipConfig( CtrlZone ).InletNode( SupAirIn ) ) {
+					if ( Sys( GetSysInputSysNum ).OutletNodeNum == ZoneEquipConfig( CtrlZone ).InletNode( SupAirIn ) ) {
 						if ( ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).OutNode > 0 ) {
 							ShowSevereError( "Error in connecting a terminal unit to a zone" );
-							ShowContinueError( NodeID( Sys( SysNum ).OutletNodeNum ) + " already connects to another zone" );
-							ShowContinueError( "Occurs for terminal unit " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
+							ShowContinueError( NodeID( Sys( GetSysInputSysNum ).OutletNodeNum ) + " already connects to another zone" );
+							ShowContinueError( "Occurs for terminal unit " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
 							ShowContinueError( "Check terminal unit node names for errors" );
-							ErrorsFound = true;
+							GetSysInputErrorsFound = true;
 						} else {
-							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).InNode = Sys( SysNum ).InletNodeNum;
-							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).OutNode = Sys( SysNum ).OutletNodeNum;
+							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).InNode = Sys( GetSysInputSysNum ).InletNodeNum;
+							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).OutNode = Sys( GetSysInputSysNum ).OutletNodeNum;
 						}
 					}
 				}
 			}
 
-			ValidateComponent( Alphas( 5 ), Alphas( 6 ), IsNotOK, Sys( SysNum ).SysType );
+			ValidateComponent( Alphas( 5 ), Alphas( 6 ), IsNotOK, Sys( GetSysInputSysNum ).SysType );
 			if ( IsNotOK ) {
-				ShowContinueError( "In " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-				ErrorsFound = true;
+				ShowContinueError( "In " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+				GetSysInputErrorsFound = true;
 			}
 
 			// Add reheat coil to component sets array
-			SetUpCompSets( Sys( SysNum ).SysType, Sys( SysNum ).SysName, Alphas( 5 ), Alphas( 6 ), Alphas( 4 ), Alphas( 3 ) );
+			SetUpCompSets( Sys( GetSysInputSysNum ).SysType, Sys( GetSysInputSysNum ).SysName, Alphas( 5 ), Alphas( 6 ), Alphas( 4 ), Alphas( 3 ) );
 
 			//Setup the Average damper Position output variable
 			// BG removed 9-10-2009 during work on CR 7770, constant volume has no damper
@@ -1043,301 +1170,301 @@ namespace SingleDuct {
 
 		} // End Number of Sys Loop
 
-		for ( SysIndex = 1; SysIndex <= NumNoRHVAVSys; ++SysIndex ) {
+		for ( GetSysInputSysIndex = 1; GetSysInputSysIndex <= NumNoRHVAVSys; ++GetSysInputSysIndex ) {
 
 			CurrentModuleObject = "AirTerminal:SingleDuct:VAV:NoReheat";
 
-			GetObjectItem( CurrentModuleObject, SysIndex, Alphas, NumAlphas, Numbers, NumNums, IOStat, lNumericBlanks, lAlphaBlanks, cAlphaFields, cNumericFields );
+			GetObjectItem( CurrentModuleObject, GetSysInputSysIndex, Alphas, NumAlphas, Numbers, NumNums, IOStat, lNumericBlanks, lAlphaBlanks, cAlphaFields, cNumericFields );
 
-			SysNum = SysIndex + NumVAVSys + NumCBVAVSys + NumConstVolSys;
+			GetSysInputSysNum = GetSysInputSysIndex + NumVAVSys + NumCBVAVSys + NumConstVolSys;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), Sys, &SysDesignParams::SysName, SysNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), Sys, &SysDesignParams::SysName, GetSysInputSysNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetSysInputErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
-			Sys( SysNum ).SysName = Alphas( 1 );
-			Sys( SysNum ).SysType = CurrentModuleObject;
-			Sys( SysNum ).SysType_Num = SingleDuctVAVNoReheat;
-			Sys( SysNum ).ReheatComp = "";
-			Sys( SysNum ).ReheatName = "";
-			Sys( SysNum ).Schedule = Alphas( 2 );
+			Sys( GetSysInputSysNum ).SysName = Alphas( 1 );
+			Sys( GetSysInputSysNum ).SysType = CurrentModuleObject;
+			Sys( GetSysInputSysNum ).SysType_Num = SingleDuctVAVNoReheat;
+			Sys( GetSysInputSysNum ).ReheatComp = "";
+			Sys( GetSysInputSysNum ).ReheatName = "";
+			Sys( GetSysInputSysNum ).Schedule = Alphas( 2 );
 			if ( lAlphaBlanks( 2 ) ) {
-				Sys( SysNum ).SchedPtr = ScheduleAlwaysOn;
+				Sys( GetSysInputSysNum ).SchedPtr = ScheduleAlwaysOn;
 			} else {
-				Sys( SysNum ).SchedPtr = GetScheduleIndex( Alphas( 2 ) );
-				if ( Sys( SysNum ).SchedPtr == 0 ) {
+				Sys( GetSysInputSysNum ).SchedPtr = GetScheduleIndex( Alphas( 2 ) );
+				if ( Sys( GetSysInputSysNum ).SchedPtr == 0 ) {
 					ShowSevereError( cAlphaFields( 2 ) + " = " + Alphas( 2 ) + " not found." );
-					ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-					ErrorsFound = true;
+					ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+					GetSysInputErrorsFound = true;
 				}
 			}
-			Sys( SysNum ).OutletNodeNum = GetOnlySingleNode( Alphas( 3 ), ErrorsFound, Sys( SysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent, cAlphaFields( 3 ) );
-			Sys( SysNum ).InletNodeNum = GetOnlySingleNode( Alphas( 4 ), ErrorsFound, Sys( SysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent, cAlphaFields( 4 ) );
-			Sys( SysNum ).MaxAirVolFlowRate = Numbers( 1 );
+			Sys( GetSysInputSysNum ).OutletNodeNum = GetOnlySingleNode( Alphas( 3 ), GetSysInputErrorsFound, Sys( GetSysInputSysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent, cAlphaFields( 3 ) );
+			Sys( GetSysInputSysNum ).InletNodeNum = GetOnlySingleNode( Alphas( 4 ), GetSysInputErrorsFound, Sys( GetSysInputSysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent, cAlphaFields( 4 ) );
+			Sys( GetSysInputSysNum ).MaxAirVolFlowRate = Numbers( 1 );
 
 			if ( SameString( Alphas( 5 ), "Constant" ) ) {
-				Sys( SysNum ).ZoneMinAirFracMethod = ConstantMinFrac;
+				Sys( GetSysInputSysNum ).ZoneMinAirFracMethod = ConstantMinFrac;
 			} else if ( SameString( Alphas( 5 ), "FixedFlowRate" ) ) {
-				Sys( SysNum ).ZoneMinAirFracMethod = FixedMin;
+				Sys( GetSysInputSysNum ).ZoneMinAirFracMethod = FixedMin;
 			} else if ( SameString( Alphas( 5 ), "Scheduled" ) ) {
-				Sys( SysNum ).ZoneMinAirFracMethod = ScheduledMinFrac;
+				Sys( GetSysInputSysNum ).ZoneMinAirFracMethod = ScheduledMinFrac;
 			} else {
 				ShowSevereError( cAlphaFields( 5 ) + " = " + Alphas( 5 ) + " not found." );
-				ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-				ErrorsFound = true;
+				ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+				GetSysInputErrorsFound = true;
 			}
 
-			Sys( SysNum ).ZoneMinAirFrac = Numbers( 2 );
+			Sys( GetSysInputSysNum ).ZoneMinAirFrac = Numbers( 2 );
 			if ( lNumericBlanks( 2 ) ) {
-				Sys( SysNum ).ConstantMinAirFracSetByUser = false;
-				Sys( SysNum ).DesignMinAirFrac = 0.0;
+				Sys( GetSysInputSysNum ).ConstantMinAirFracSetByUser = false;
+				Sys( GetSysInputSysNum ).DesignMinAirFrac = 0.0;
 			} else {
-				Sys( SysNum ).ConstantMinAirFracSetByUser = true;
-				Sys( SysNum ).DesignMinAirFrac = Numbers( 2 );
-				if ( Sys( SysNum ).ZoneMinAirFracMethod == FixedMin ) {
+				Sys( GetSysInputSysNum ).ConstantMinAirFracSetByUser = true;
+				Sys( GetSysInputSysNum ).DesignMinAirFrac = Numbers( 2 );
+				if ( Sys( GetSysInputSysNum ).ZoneMinAirFracMethod == FixedMin ) {
 					ShowWarningError( "Since " + cAlphaFields( 5 ) + " = " + Alphas( 5 ) + ", input for " + cNumericFields( 2 ) + " will be ignored." );
-					ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-					Sys( SysNum ).ZoneMinAirFrac = 0.0;
+					ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+					Sys( GetSysInputSysNum ).ZoneMinAirFrac = 0.0;
 				}
 			}
 
-			Sys( SysNum ).ZoneFixedMinAir = Numbers( 3 );
+			Sys( GetSysInputSysNum ).ZoneFixedMinAir = Numbers( 3 );
 			if ( lNumericBlanks( 3 ) ) {
-				Sys( SysNum ).FixedMinAirSetByUser = false;
-				Sys( SysNum ).DesignFixedMinAir = 0.0;
+				Sys( GetSysInputSysNum ).FixedMinAirSetByUser = false;
+				Sys( GetSysInputSysNum ).DesignFixedMinAir = 0.0;
 			} else {
-				Sys( SysNum ).FixedMinAirSetByUser = true;
-				Sys( SysNum ).DesignFixedMinAir = Numbers( 3 );
-				if ( Sys( SysNum ).ZoneMinAirFracMethod == ConstantMinFrac ) {
+				Sys( GetSysInputSysNum ).FixedMinAirSetByUser = true;
+				Sys( GetSysInputSysNum ).DesignFixedMinAir = Numbers( 3 );
+				if ( Sys( GetSysInputSysNum ).ZoneMinAirFracMethod == ConstantMinFrac ) {
 					ShowWarningError( "Since " + cAlphaFields( 5 ) + " = " + Alphas( 5 ) + ", input for " + cNumericFields( 3 ) + " will be ignored." );
-					ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-					Sys( SysNum ).ZoneFixedMinAir = 0.0;
+					ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+					Sys( GetSysInputSysNum ).ZoneFixedMinAir = 0.0;
 				}
 			}
-			Sys( SysNum ).ZoneMinAirFracSchPtr = GetScheduleIndex( Alphas( 6 ) );
-			if ( ( Sys( SysNum ).ZoneMinAirFracSchPtr == 0 ) && ( Sys( SysNum ).ZoneMinAirFracMethod == ScheduledMinFrac ) ) {
+			Sys( GetSysInputSysNum ).ZoneMinAirFracSchPtr = GetScheduleIndex( Alphas( 6 ) );
+			if ( ( Sys( GetSysInputSysNum ).ZoneMinAirFracSchPtr == 0 ) && ( Sys( GetSysInputSysNum ).ZoneMinAirFracMethod == ScheduledMinFrac ) ) {
 				ShowSevereError( cAlphaFields( 6 ) + " = " + Alphas( 6 ) + " not found." );
-				ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
+				ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
 				ShowContinueError( "A valid schedule is required" );
-				ErrorsFound = true;
-			} else if ( ( Sys( SysNum ).ZoneMinAirFracSchPtr > 0 ) && ( Sys( SysNum ).ZoneMinAirFracMethod == ScheduledMinFrac ) ) {
+				GetSysInputErrorsFound = true;
+			} else if ( ( Sys( GetSysInputSysNum ).ZoneMinAirFracSchPtr > 0 ) && ( Sys( GetSysInputSysNum ).ZoneMinAirFracMethod == ScheduledMinFrac ) ) {
 				// check range of values in schedule
-				if ( ! CheckScheduleValueMinMax( Sys( SysNum ).ZoneMinAirFracSchPtr, ">=", 0.0, "<=", 1.0 ) ) {
+				if ( ! CheckScheduleValueMinMax( Sys( GetSysInputSysNum ).ZoneMinAirFracSchPtr, ">=", 0.0, "<=", 1.0 ) ) {
 					ShowSevereError( "Error found in " + cAlphaFields( 6 ) + " = " + Alphas( 6 ) );
-					ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
+					ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
 					ShowContinueError( "Schedule values must be (>=0., <=1.)" );
 				}
 
 			}
 
-			Sys( SysNum ).ReheatControlNode = 0;
-			Sys( SysNum ).ReheatAirOutletNode = Sys( SysNum ).OutletNodeNum;
-			Sys( SysNum ).MaxReheatWaterVolFlow = 0.0;
-			Sys( SysNum ).MaxReheatSteamVolFlow = 0.0;
-			Sys( SysNum ).MinReheatWaterVolFlow = 0.0;
-			Sys( SysNum ).MinReheatSteamVolFlow = 0.0;
-			Sys( SysNum ).ControllerOffset = 0.000001;
-			Sys( SysNum ).DamperHeatingAction = HeatingActionNotUsed;
+			Sys( GetSysInputSysNum ).ReheatControlNode = 0;
+			Sys( GetSysInputSysNum ).ReheatAirOutletNode = Sys( GetSysInputSysNum ).OutletNodeNum;
+			Sys( GetSysInputSysNum ).MaxReheatWaterVolFlow = 0.0;
+			Sys( GetSysInputSysNum ).MaxReheatSteamVolFlow = 0.0;
+			Sys( GetSysInputSysNum ).MinReheatWaterVolFlow = 0.0;
+			Sys( GetSysInputSysNum ).MinReheatSteamVolFlow = 0.0;
+			Sys( GetSysInputSysNum ).ControllerOffset = 0.000001;
+			Sys( GetSysInputSysNum ).DamperHeatingAction = HeatingActionNotUsed;
 
 			// Register component set data
-			TestCompSet( Sys( SysNum ).SysType, Sys( SysNum ).SysName, NodeID( Sys( SysNum ).InletNodeNum ), NodeID( Sys( SysNum ).OutletNodeNum ), "Air Nodes" );
+			TestCompSet( Sys( GetSysInputSysNum ).SysType, Sys( GetSysInputSysNum ).SysName, NodeID( Sys( GetSysInputSysNum ).InletNodeNum ), NodeID( Sys( GetSysInputSysNum ).OutletNodeNum ), "Air Nodes" );
 
 			// Fill the Zone Equipment data with the inlet node number of this unit.
 			for ( CtrlZone = 1; CtrlZone <= NumOfZones; ++CtrlZone ) {
 				if ( ! ZoneEquipConfig( CtrlZone ).IsControlled ) continue;
 				for ( SupAirIn = 1; SupAirIn <= ZoneEquipConfig( CtrlZone ).NumInletNodes; ++SupAirIn ) {
-					if ( Sys( SysNum ).ReheatAirOutletNode == ZoneEquipConfig( CtrlZone ).InletNode( SupAirIn ) ) {
+					if ( Sys( GetSysInputSysNum ).ReheatAirOutletNode == ZoneEquipConfig( CtrlZone ).InletNode( SupAirIn ) ) {
 						if ( ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).OutNode > 0 ) {
 							ShowSevereError( "Error in connecting a terminal unit to a zone" );
-							ShowContinueError( NodeID( Sys( SysNum ).ReheatAirOutletNode ) + " already connects to another zone" );
-							ShowContinueError( "Occurs for terminal unit " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
+							ShowContinueError( NodeID( Sys( GetSysInputSysNum ).ReheatAirOutletNode ) + " already connects to another zone" );
+							ShowContinueError( "Occurs for terminal unit " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
 							ShowContinueError( "Check terminal unit node names for errors" );
-							ErrorsFound = true;
+							GetSysInputErrorsFound = true;
 						} else {
-							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).InNode = Sys( SysNum ).InletNodeNum;
-							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).OutNode = Sys( SysNum ).ReheatAirOutletNode;
+							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).InNode = Sys( GetSysInputSysNum ).InletNodeNum;
+							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).OutNode = Sys( GetSysInputSysNum ).ReheatAirOutletNode;
 						}
 
-						Sys( SysNum ).CtrlZoneNum = CtrlZone;
-						Sys( SysNum ).ActualZoneNum = ZoneEquipConfig( CtrlZone ).ActualZoneNum;
-						Sys( SysNum ).ZoneFloorArea = Zone( Sys( SysNum ).ActualZoneNum ).FloorArea * Zone( Sys( SysNum ).ActualZoneNum ).Multiplier * Zone( Sys( SysNum ).ActualZoneNum ).ListMultiplier;
+						Sys( GetSysInputSysNum ).CtrlZoneNum = CtrlZone;
+						Sys( GetSysInputSysNum ).ActualZoneNum = ZoneEquipConfig( CtrlZone ).ActualZoneNum;
+						Sys( GetSysInputSysNum ).ZoneFloorArea = Zone( Sys( GetSysInputSysNum ).ActualZoneNum ).FloorArea * Zone( Sys( GetSysInputSysNum ).ActualZoneNum ).Multiplier * Zone( Sys( GetSysInputSysNum ).ActualZoneNum ).ListMultiplier;
 
 					}
 				}
 			}
 
 			if ( ! lAlphaBlanks( 7 ) ) {
-				Sys( SysNum ).OARequirementsPtr = FindItemInList( Alphas( 7 ), OARequirements );
-				if ( Sys( SysNum ).OARequirementsPtr == 0 ) {
+				Sys( GetSysInputSysNum ).OARequirementsPtr = FindItemInList( Alphas( 7 ), OARequirements );
+				if ( Sys( GetSysInputSysNum ).OARequirementsPtr == 0 ) {
 					ShowSevereError( cAlphaFields( 7 ) + " = " + Alphas( 7 ) + " not found." );
-					ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-					ErrorsFound = true;
+					ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+					GetSysInputErrorsFound = true;
 				} else {
-					Sys( SysNum ).NoOAFlowInputFromUser = false;
+					Sys( GetSysInputSysNum ).NoOAFlowInputFromUser = false;
 				}
 			}
 
 			//Setup the Average damper Position output variable
-			SetupOutputVariable( "Zone Air Terminal VAV Damper Position []", Sys( SysNum ).DamperPosition, "System", "Average", Sys( SysNum ).SysName );
-			SetupOutputVariable( "Zone Air Terminal Minimum Air Flow Fraction []", Sys( SysNum ).ZoneMinAirFracReport, "System", "Average", Sys( SysNum ).SysName );
-			SetupOutputVariable( "Zone Air Terminal Outdoor Air Volume Flow Rate [m3/s]", Sys( SysNum ).OutdoorAirFlowRate, "System", "Average", Sys( SysNum ).SysName );
+			SetupOutputVariable( "Zone Air Terminal VAV Damper Position []", Sys( GetSysInputSysNum ).DamperPosition, "System", "Average", Sys( GetSysInputSysNum ).SysName );
+			SetupOutputVariable( "Zone Air Terminal Minimum Air Flow Fraction []", Sys( GetSysInputSysNum ).ZoneMinAirFracReport, "System", "Average", Sys( GetSysInputSysNum ).SysName );
+			SetupOutputVariable( "Zone Air Terminal Outdoor Air Volume Flow Rate [m3/s]", Sys( GetSysInputSysNum ).OutdoorAirFlowRate, "System", "Average", Sys( GetSysInputSysNum ).SysName );
 
 		} // end Number of Sys Loop
 
-		for ( SysIndex = 1; SysIndex <= NumNoRHCBVAVSys; ++SysIndex ) {
+		for ( GetSysInputSysIndex = 1; GetSysInputSysIndex <= NumNoRHCBVAVSys; ++GetSysInputSysIndex ) {
 
 			CurrentModuleObject = "AirTerminal:SingleDuct:VAV:HeatAndCool:NoReheat";
 
-			GetObjectItem( CurrentModuleObject, SysIndex, Alphas, NumAlphas, Numbers, NumNums, IOStat, lNumericBlanks, lAlphaBlanks, cAlphaFields, cNumericFields );
+			GetObjectItem( CurrentModuleObject, GetSysInputSysIndex, Alphas, NumAlphas, Numbers, NumNums, IOStat, lNumericBlanks, lAlphaBlanks, cAlphaFields, cNumericFields );
 
-			SysNum = SysIndex + NumVAVSys + NumCBVAVSys + NumConstVolSys + NumNoRHVAVSys;
+			GetSysInputSysNum = GetSysInputSysIndex + NumVAVSys + NumCBVAVSys + NumConstVolSys + NumNoRHVAVSys;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), Sys, &SysDesignParams::SysName, SysNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), Sys, &SysDesignParams::SysName, GetSysInputSysNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetSysInputErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
-			Sys( SysNum ).SysName = Alphas( 1 );
-			Sys( SysNum ).SysType = CurrentModuleObject;
-			Sys( SysNum ).SysType_Num = SingleDuctCBVAVNoReheat;
-			Sys( SysNum ).ReheatComp = "";
-			Sys( SysNum ).ReheatName = "";
-			Sys( SysNum ).Schedule = Alphas( 2 );
+			Sys( GetSysInputSysNum ).SysName = Alphas( 1 );
+			Sys( GetSysInputSysNum ).SysType = CurrentModuleObject;
+			Sys( GetSysInputSysNum ).SysType_Num = SingleDuctCBVAVNoReheat;
+			Sys( GetSysInputSysNum ).ReheatComp = "";
+			Sys( GetSysInputSysNum ).ReheatName = "";
+			Sys( GetSysInputSysNum ).Schedule = Alphas( 2 );
 			if ( lAlphaBlanks( 2 ) ) {
-				Sys( SysNum ).SchedPtr = ScheduleAlwaysOn;
+				Sys( GetSysInputSysNum ).SchedPtr = ScheduleAlwaysOn;
 			} else {
-				Sys( SysNum ).SchedPtr = GetScheduleIndex( Alphas( 2 ) );
-				if ( Sys( SysNum ).SchedPtr == 0 ) {
+				Sys( GetSysInputSysNum ).SchedPtr = GetScheduleIndex( Alphas( 2 ) );
+				if ( Sys( GetSysInputSysNum ).SchedPtr == 0 ) {
 					ShowSevereError( cAlphaFields( 2 ) + " = " + Alphas( 2 ) + " not found." );
-					ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-					ErrorsFound = true;
+					ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+					GetSysInputErrorsFound = true;
 				}
 			}
-			Sys( SysNum ).OutletNodeNum = GetOnlySingleNode( Alphas( 3 ), ErrorsFound, Sys( SysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent, cAlphaFields( 3 ) );
-			Sys( SysNum ).InletNodeNum = GetOnlySingleNode( Alphas( 4 ), ErrorsFound, Sys( SysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent, cAlphaFields( 4 ) );
-			Sys( SysNum ).MaxAirVolFlowRate = Numbers( 1 );
-			Sys( SysNum ).ZoneMinAirFrac = Numbers( 2 );
-			if ( Sys( SysNum ).ZoneMinAirFrac < 0.0 ) {
-				ShowWarningError( Sys( SysNum ).SysType + " = \"" + Sys( SysNum ).SysName );
+			Sys( GetSysInputSysNum ).OutletNodeNum = GetOnlySingleNode( Alphas( 3 ), GetSysInputErrorsFound, Sys( GetSysInputSysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent, cAlphaFields( 3 ) );
+			Sys( GetSysInputSysNum ).InletNodeNum = GetOnlySingleNode( Alphas( 4 ), GetSysInputErrorsFound, Sys( GetSysInputSysNum ).SysType, Alphas( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent, cAlphaFields( 4 ) );
+			Sys( GetSysInputSysNum ).MaxAirVolFlowRate = Numbers( 1 );
+			Sys( GetSysInputSysNum ).ZoneMinAirFrac = Numbers( 2 );
+			if ( Sys( GetSysInputSysNum ).ZoneMinAirFrac < 0.0 ) {
+				ShowWarningError( Sys( GetSysInputSysNum ).SysType + " = \"" + Sys( GetSysInputSysNum ).SysName );
 				ShowContinueError( cNumericFields( 2 ) + " must be greater than or equal to 0. Resetting to 0 and the simulation continues." );
-				Sys( SysNum ).ZoneMinAirFrac = 0.0;
+				Sys( GetSysInputSysNum ).ZoneMinAirFrac = 0.0;
 			}
-			if ( Sys( SysNum ).ZoneMinAirFrac > 1.0 ) {
-				ShowWarningError( Sys( SysNum ).SysType + " = \"" + Sys( SysNum ).SysName );
+			if ( Sys( GetSysInputSysNum ).ZoneMinAirFrac > 1.0 ) {
+				ShowWarningError( Sys( GetSysInputSysNum ).SysType + " = \"" + Sys( GetSysInputSysNum ).SysName );
 				ShowContinueError( cNumericFields( 2 ) + " must be less than or equal to 1. Resetting to 1 and the simulation continues." );
-				Sys( SysNum ).ZoneMinAirFrac = 1.0;
+				Sys( GetSysInputSysNum ).ZoneMinAirFrac = 1.0;
 			}
 
-			Sys( SysNum ).ReheatControlNode = 0;
-			Sys( SysNum ).ReheatAirOutletNode = Sys( SysNum ).OutletNodeNum;
-			Sys( SysNum ).MaxReheatWaterVolFlow = 0.0;
-			Sys( SysNum ).MaxReheatSteamVolFlow = 0.0;
-			Sys( SysNum ).MinReheatWaterVolFlow = 0.0;
-			Sys( SysNum ).MinReheatSteamVolFlow = 0.0;
-			Sys( SysNum ).ControllerOffset = 0.000001;
-			Sys( SysNum ).DamperHeatingAction = HeatingActionNotUsed;
+			Sys( GetSysInputSysNum ).ReheatControlNode = 0;
+			Sys( GetSysInputSysNum ).ReheatAirOutletNode = Sys( GetSysInputSysNum ).OutletNodeNum;
+			Sys( GetSysInputSysNum ).MaxReheatWaterVolFlow = 0.0;
+			Sys( GetSysInputSysNum ).MaxReheatSteamVolFlow = 0.0;
+			Sys( GetSysInputSysNum ).MinReheatWaterVolFlow = 0.0;
+			Sys( GetSysInputSysNum ).MinReheatSteamVolFlow = 0.0;
+			Sys( GetSysInputSysNum ).ControllerOffset = 0.000001;
+			Sys( GetSysInputSysNum ).DamperHeatingAction = HeatingActionNotUsed;
 
 			// Register component set data
-			TestCompSet( Sys( SysNum ).SysType, Sys( SysNum ).SysName, NodeID( Sys( SysNum ).InletNodeNum ), NodeID( Sys( SysNum ).OutletNodeNum ), "Air Nodes" );
+			TestCompSet( Sys( GetSysInputSysNum ).SysType, Sys( GetSysInputSysNum ).SysName, NodeID( Sys( GetSysInputSysNum ).InletNodeNum ), NodeID( Sys( GetSysInputSysNum ).OutletNodeNum ), "Air Nodes" );
 
 			// Fill the Zone Equipment data with the inlet node number of this unit.
 			for ( CtrlZone = 1; CtrlZone <= NumOfZones; ++CtrlZone ) {
 				if ( ! ZoneEquipConfig( CtrlZone ).IsControlled ) continue;
 				for ( SupAirIn = 1; SupAirIn <= ZoneEquipConfig( CtrlZone ).NumInletNodes; ++SupAirIn ) {
-					if ( Sys( SysNum ).ReheatAirOutletNode == ZoneEquipConfig( CtrlZone ).InletNode( SupAirIn ) ) {
+					if ( Sys( GetSysInputSysNum ).ReheatAirOutletNode == ZoneEquipConfig( CtrlZone ).InletNode( SupAirIn ) ) {
 						if ( ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).OutNode > 0 ) {
 							ShowSevereError( "Error in connecting a terminal unit to a zone" );
-							ShowContinueError( NodeID( Sys( SysNum ).ReheatAirOutletNode ) + " already connects to another zone" );
-							ShowContinueError( "Occurs for terminal unit " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
+							ShowContinueError( NodeID( Sys( GetSysInputSysNum ).ReheatAirOutletNode ) + " already connects to another zone" );
+							ShowContinueError( "Occurs for terminal unit " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
 							ShowContinueError( "Check terminal unit node names for errors" );
-							ErrorsFound = true;
+							GetSysInputErrorsFound = true;
 						} else {
-							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).InNode = Sys( SysNum ).InletNodeNum;
-							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).OutNode = Sys( SysNum ).ReheatAirOutletNode;
+							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).InNode = Sys( GetSysInputSysNum ).InletNodeNum;
+							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).OutNode = Sys( GetSysInputSysNum ).ReheatAirOutletNode;
 						}
 					}
 				}
 			}
 
 			//Setup the Average damper Position output variable
-			SetupOutputVariable( "Zone Air Terminal VAV Damper Position []", Sys( SysNum ).DamperPosition, "System", "Average", Sys( SysNum ).SysName );
+			SetupOutputVariable( "Zone Air Terminal VAV Damper Position []", Sys( GetSysInputSysNum ).DamperPosition, "System", "Average", Sys( GetSysInputSysNum ).SysName );
 
 		} // end Number of VAVHeatandCool:NoReheat Sys Loop
 
 		// read in the SINGLE DUCT:VAV:REHEAT:VS FAN data
-		for ( SysIndex = 1; SysIndex <= NumVAVVS; ++SysIndex ) {
+		for ( GetSysInputSysIndex = 1; GetSysInputSysIndex <= NumVAVVS; ++GetSysInputSysIndex ) {
 
 			CurrentModuleObject = "AirTerminal:SingleDuct:VAV:Reheat:VariableSpeedFan";
 
-			GetObjectItem( CurrentModuleObject, SysIndex, Alphas, NumAlphas, Numbers, NumNums, IOStat, lNumericBlanks, lAlphaBlanks, cAlphaFields, cNumericFields );
+			GetObjectItem( CurrentModuleObject, GetSysInputSysIndex, Alphas, NumAlphas, Numbers, NumNums, IOStat, lNumericBlanks, lAlphaBlanks, cAlphaFields, cNumericFields );
 
-			SysNum = SysIndex + NumVAVSys + NumCBVAVSys + NumConstVolSys + NumNoRHVAVSys + NumNoRHCBVAVSys;
+			GetSysInputSysNum = GetSysInputSysIndex + NumVAVSys + NumCBVAVSys + NumConstVolSys + NumNoRHVAVSys + NumNoRHCBVAVSys;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), Sys, &SysDesignParams::SysName, SysNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), Sys, &SysDesignParams::SysName, GetSysInputSysNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetSysInputErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 			}
-			Sys( SysNum ).SysName = Alphas( 1 );
-			Sys( SysNum ).SysType = CurrentModuleObject;
-			Sys( SysNum ).SysType_Num = SingleDuctVAVReheatVSFan;
-			Sys( SysNum ).ReheatComp = Alphas( 7 );
-			Sys( SysNum ).ReheatName = Alphas( 8 );
+			Sys( GetSysInputSysNum ).SysName = Alphas( 1 );
+			Sys( GetSysInputSysNum ).SysType = CurrentModuleObject;
+			Sys( GetSysInputSysNum ).SysType_Num = SingleDuctVAVReheatVSFan;
+			Sys( GetSysInputSysNum ).ReheatComp = Alphas( 7 );
+			Sys( GetSysInputSysNum ).ReheatName = Alphas( 8 );
 			IsNotOK = false;
-			if ( SameString( Sys( SysNum ).ReheatComp, "Coil:Heating:Fuel" ) ) {
-				Sys( SysNum ).ReheatComp_Num = HCoilType_Gas;
-				Sys( SysNum ).ReheatAirOutletNode = GetHeatingCoilOutletNode( Sys( SysNum ).ReheatComp, Sys( SysNum ).ReheatName, IsNotOK );
-				Sys( SysNum ).ReheatCoilMaxCapacity = GetHeatingCoilCapacity( Sys( SysNum ).ReheatComp, Sys( SysNum ).ReheatName, IsNotOK );
-				if ( IsNotOK ) ShowContinueError( "Occurs for terminal unit " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-			} else if ( SameString( Sys( SysNum ).ReheatComp, "Coil:Heating:Electric" ) ) {
-				Sys( SysNum ).ReheatComp_Num = HCoilType_Electric;
-				Sys( SysNum ).ReheatAirOutletNode = GetHeatingCoilOutletNode( Sys( SysNum ).ReheatComp, Sys( SysNum ).ReheatName, IsNotOK );
-				Sys( SysNum ).ReheatCoilMaxCapacity = GetHeatingCoilCapacity( Sys( SysNum ).ReheatComp, Sys( SysNum ).ReheatName, IsNotOK );
-				if ( IsNotOK ) ShowContinueError( "Occurs for terminal unit " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-			} else if ( SameString( Sys( SysNum ).ReheatComp, "Coil:Heating:Water" ) ) {
-				Sys( SysNum ).ReheatComp_Num = HCoilType_SimpleHeating;
-				Sys( SysNum ).ReheatComp_PlantType = TypeOf_CoilWaterSimpleHeating;
-			} else if ( SameString( Sys( SysNum ).ReheatComp, "Coil:Heating:Steam" ) ) {
-				Sys( SysNum ).ReheatComp_Num = HCoilType_SteamAirHeating;
-				Sys( SysNum ).ReheatComp_PlantType = TypeOf_CoilSteamAirHeating;
-			} else if ( Sys( SysNum ).ReheatComp != "" ) {
-				ShowSevereError( "Illegal " + cAlphaFields( 7 ) + " = " + Sys( SysNum ).ReheatComp + '.' );
-				ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-				ErrorsFound = true;
-			}
-			ValidateComponent( Sys( SysNum ).ReheatComp, Sys( SysNum ).ReheatName, IsNotOK, Sys( SysNum ).SysType );
+			if ( SameString( Sys( GetSysInputSysNum ).ReheatComp, "Coil:Heating:Fuel" ) ) {
+				Sys( GetSysInputSysNum ).ReheatComp_Num = HCoilType_Gas;
+				Sys( GetSysInputSysNum ).ReheatAirOutletNode = GetHeatingCoilOutletNode( Sys( GetSysInputSysNum ).ReheatComp, Sys( GetSysInputSysNum ).ReheatName, IsNotOK );
+				Sys( GetSysInputSysNum ).ReheatCoilMaxCapacity = GetHeatingCoilCapacity( Sys( GetSysInputSysNum ).ReheatComp, Sys( GetSysInputSysNum ).ReheatName, IsNotOK );
+				if ( IsNotOK ) ShowContinueError( "Occurs for terminal unit " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+			} else if ( SameString( Sys( GetSysInputSysNum ).ReheatComp, "Coil:Heating:Electric" ) ) {
+				Sys( GetSysInputSysNum ).ReheatComp_Num = HCoilType_Electric;
+				Sys( GetSysInputSysNum ).ReheatAirOutletNode = GetHeatingCoilOutletNode( Sys( GetSysInputSysNum ).ReheatComp, Sys( GetSysInputSysNum ).ReheatName, IsNotOK );
+				Sys( GetSysInputSysNum ).ReheatCoilMaxCapacity = GetHeatingCoilCapacity( Sys( GetSysInputSysNum ).ReheatComp, Sys( GetSysInputSysNum ).ReheatName, IsNotOK );
+				if ( IsNotOK ) ShowContinueError( "Occurs for terminal unit " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+			} else if ( SameString( Sys( GetSysInputSysNum ).ReheatComp, "Coil:Heating:Water" ) ) {
+				Sys( GetSysInputSysNum ).ReheatComp_Num = HCoilType_SimpleHeating;
+				Sys( GetSysInputSysNum ).ReheatComp_PlantType = TypeOf_CoilWaterSimpleHeating;
+			} else if ( SameString( Sys( GetSysInputSysNum ).ReheatComp, "Coil:Heating:Steam" ) ) {
+				Sys( GetSysInputSysNum ).ReheatComp_Num = HCoilType_SteamAirHeating;
+				Sys( GetSysInputSysNum ).ReheatComp_PlantType = TypeOf_CoilSteamAirHeating;
+			} else if ( Sys( GetSysInputSysNum ).ReheatComp != "" ) {
+				ShowSevereError( "Illegal " + cAlphaFields( 7 ) + " = " + Sys( GetSysInputSysNum ).ReheatComp + '.' );
+				ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+				GetSysInputErrorsFound = true;
+			}
+			ValidateComponent( Sys( GetSysInputSysNum ).ReheatComp, Sys( GetSysInputSysNum ).ReheatName, IsNotOK, Sys( GetSysInputSysNum ).SysType );
 			if ( IsNotOK ) {
-				ShowContinueError( "In " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-				ErrorsFound = true;
-			}
-			Sys( SysNum ).FanType = Alphas( 5 );
-			if ( SameString( Sys( SysNum ).FanType, "Fan:VariableVolume" ) ) {
-				Sys( SysNum ).Fan_Num = FanType_VS;
-			} else if ( Sys( SysNum ).FanType != "" ) {
-				ShowSevereError( "Illegal " + cAlphaFields( 5 ) + " = " + Sys( SysNum ).FanType + '.' );
-				ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-				ErrorsFound = true;
-			}
-			Sys( SysNum ).FanName = Alphas( 6 );
-			ValidateComponent( Sys( SysNum ).FanType, Sys( SysNum ).FanName, IsNotOK, Sys( SysNum ).SysType );
+				ShowContinueError( "In " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+				GetSysInputErrorsFound = true;
+			}
+			Sys( GetSysInputSysNum ).FanType = Alphas( 5 );
+			if ( SameString( Sys( GetSysInputSysNum ).FanType, "Fan:VariableVolume" ) ) {
+				Sys( GetSysInputSysNum ).Fan_Num = FanType_VS;
+			} else if ( Sys( GetSysInputSysNum ).FanType != "" ) {
+				ShowSevereError( "Illegal " + cAlphaFields( 5 ) + " = " + Sys( GetSysInputSysNum ).FanType + '.' );
+				ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+				GetSysInputErrorsFound = true;
+			}
+			Sys( GetSysInputSysNum ).FanName = Alphas( 6 );
+			ValidateComponent( Sys( GetSysInputSysNum ).FanType, Sys( GetSysInputSysNum ).FanName, IsNotOK, Sys( GetSysInputSysNum ).SysType );
 			if ( IsNotOK ) {
-				ShowContinueError( "In " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-				ErrorsFound = true;
+				ShowContinueError( "In " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+				GetSysInputErrorsFound = true;
 			}
 
-			Sys( SysNum ).Schedule = Alphas( 2 );
+			Sys( GetSysInputSysNum ).Schedule = Alphas( 2 );
 			if ( lAlphaBlanks( 2 ) ) {
-				Sys( SysNum ).SchedPtr = ScheduleAlwaysOn;
+				Sys( GetSysInputSysNum ).SchedPtr = ScheduleAlwaysOn;
 			} else {
-				Sys( SysNum ).SchedPtr = GetScheduleIndex( Alphas( 2 ) );
-				if ( Sys( SysNum ).SchedPtr == 0 ) {
+				Sys( GetSysInputSysNum ).SchedPtr = GetScheduleIndex( Alphas( 2 ) );
+				if ( Sys( GetSysInputSysNum ).SchedPtr == 0 ) {
 					ShowSevereError( cAlphaFields( 2 ) + " = " + Alphas( 2 ) + " not found." );
-					ShowContinueError( "Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-					ErrorsFound = true;
+					ShowContinueError( "Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+					GetSysInputErrorsFound = true;
 				}
 			}
 
@@ -1347,10 +1474,10 @@ namespace SingleDuct {
 			//          \required-field
 			IsNotOK = false;
 
-			Sys( SysNum ).OutletNodeNum = GetFanOutletNode( Sys( SysNum ).FanType, Sys( SysNum ).FanName, IsNotOK );
+			Sys( GetSysInputSysNum ).OutletNodeNum = GetFanOutletNode( Sys( GetSysInputSysNum ).FanType, Sys( GetSysInputSysNum ).FanName, IsNotOK );
 			if ( IsNotOK ) {
-				ShowContinueError( "..Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-				ErrorsFound = true;
+				ShowContinueError( "..Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+				GetSysInputErrorsFound = true;
 			}
 			//               GetOnlySingleNode(Alphas(5),ErrorsFound,Sys(SysNum)%SysType,Alphas(1), &
 			//                            NodeType_Air,NodeConnectionType_Outlet,1,ObjectIsParent)
@@ -1358,27 +1485,27 @@ namespace SingleDuct {
 			//          \note same as fan inlet node
 			//          \type alpha
 			IsNotOK = false;
-			Sys( SysNum ).InletNodeNum = GetFanInletNode( Sys( SysNum ).FanType, Sys( SysNum ).FanName, IsNotOK );
+			Sys( GetSysInputSysNum ).InletNodeNum = GetFanInletNode( Sys( GetSysInputSysNum ).FanType, Sys( GetSysInputSysNum ).FanName, IsNotOK );
 			if ( IsNotOK ) {
-				ShowContinueError( "..Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-				ErrorsFound = true;
+				ShowContinueError( "..Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+				GetSysInputErrorsFound = true;
 			}
 			//               GetOnlySingleNode(Alphas(3),ErrorsFound,Sys(SysNum)%SysType,Alphas(1), &
 			//                           NodeType_Air,NodeConnectionType_Inlet,1,ObjectIsParent)
-			AirTermSysInletNodeName = NodeID( Sys( SysNum ).InletNodeNum );
+			AirTermSysInletNodeName = NodeID( Sys( GetSysInputSysNum ).InletNodeNum );
 			if ( ! SameString( Alphas( 3 ), AirTermSysInletNodeName ) ) {
-				ShowWarningError( RoutineName + "Invalid air terminal object air inlet node name in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
+				ShowWarningError( RoutineName + "Invalid air terminal object air inlet node name in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
 				ShowContinueError( " Specified air inlet node name is = " + Alphas( 3 ) + "." );
 				ShowContinueError( " Expected air inlet node name is = " + AirTermSysInletNodeName + "." );
 				//ErrorsFound = true;
 			}
 
-			Sys( SysNum ).MaxAirVolFlowRate = Numbers( 1 );
-			Sys( SysNum ).MaxHeatAirVolFlowRate = Numbers( 2 );
-			Sys( SysNum ).ZoneMinAirFrac = Numbers( 3 );
+			Sys( GetSysInputSysNum ).MaxAirVolFlowRate = Numbers( 1 );
+			Sys( GetSysInputSysNum ).MaxHeatAirVolFlowRate = Numbers( 2 );
+			Sys( GetSysInputSysNum ).ZoneMinAirFrac = Numbers( 3 );
 			// The reheat coil control node is necessary for hot water reheat, but not necessary for
 			// electric or gas reheat.
-			if ( Sys( SysNum ).ReheatComp_Num == HCoilType_Gas || Sys( SysNum ).ReheatComp_Num == HCoilType_Electric ) {
+			if ( Sys( GetSysInputSysNum ).ReheatComp_Num == HCoilType_Gas || Sys( GetSysInputSysNum ).ReheatComp_Num == HCoilType_Electric ) {
 				//          IF(.NOT. lAlphaBlanks(6)) THEN
 				//            CALL ShowWarningError('In '//TRIM(Sys(SysNum)%SysType)//' = ' // TRIM(Sys(SysNum)%SysName) &
 				//                                 // ' the '//TRIM(cAlphaFields(6))//' is not needed and will be ignored.')
@@ -1390,42 +1517,42 @@ namespace SingleDuct {
 				//                                 // ' the '//TRIM(cAlphaFields(6))//' is undefined')
 				//            ErrorsFound=.TRUE.
 				//          END IF
-				if ( Sys( SysNum ).ReheatComp_Num == HCoilType_SteamAirHeating ) {
+				if ( Sys( GetSysInputSysNum ).ReheatComp_Num == HCoilType_SteamAirHeating ) {
 					IsNotOK = false;
-					Sys( SysNum ).ReheatControlNode = GetCoilSteamInletNode( Sys( SysNum ).ReheatComp, Sys( SysNum ).ReheatName, IsNotOK );
+					Sys( GetSysInputSysNum ).ReheatControlNode = GetCoilSteamInletNode( Sys( GetSysInputSysNum ).ReheatComp, Sys( GetSysInputSysNum ).ReheatName, IsNotOK );
 					if ( IsNotOK ) {
-						ShowContinueError( "..Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-						ErrorsFound = true;
+						ShowContinueError( "..Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+						GetSysInputErrorsFound = true;
 					} else {
 						//  A4,     \field Unit supply air outlet node
 						//          \note same as heating coil air outlet node
 						//          \note same as zone inlet node
 						//          \type alpha
 						IsNotOK = false;
-						Sys( SysNum ).ReheatAirOutletNode = GetCoilAirOutletNode( Sys( SysNum ).ReheatComp, Sys( SysNum ).ReheatName, IsNotOK );
+						Sys( GetSysInputSysNum ).ReheatAirOutletNode = GetCoilAirOutletNode( Sys( GetSysInputSysNum ).ReheatComp, Sys( GetSysInputSysNum ).ReheatName, IsNotOK );
 						if ( IsNotOK ) {
-							ShowContinueError( "..Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-							ErrorsFound = true;
+							ShowContinueError( "..Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+							GetSysInputErrorsFound = true;
 						}
 					}
 					//               GetOnlySingleNode(Alphas(6),ErrorsFound,Sys(SysNum)%SysType,Alphas(1), &
 					//                                NodeType_Steam,NodeConnectionType_Actuator,1,ObjectIsParent)
 				} else {
 					IsNotOK = false;
-					Sys( SysNum ).ReheatControlNode = GetCoilWaterInletNode( Sys( SysNum ).ReheatComp, Sys( SysNum ).ReheatName, IsNotOK );
+					Sys( GetSysInputSysNum ).ReheatControlNode = GetCoilWaterInletNode( Sys( GetSysInputSysNum ).ReheatComp, Sys( GetSysInputSysNum ).ReheatName, IsNotOK );
 					if ( IsNotOK ) {
-						ShowContinueError( "..Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-						ErrorsFound = true;
+						ShowContinueError( "..Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+						GetSysInputErrorsFound = true;
 					} else {
 						//  A4,     \field Unit supply air outlet node
 						//          \note same as heating coil air outlet node
 						//          \note same as zone inlet node
 						//          \type alpha
 						IsNotOK = false;
-						Sys( SysNum ).ReheatAirOutletNode = GetCoilOutletNode( Sys( SysNum ).ReheatComp, Sys( SysNum ).ReheatName, IsNotOK );
+						Sys( GetSysInputSysNum ).ReheatAirOutletNode = GetCoilOutletNode( Sys( GetSysInputSysNum ).ReheatComp, Sys( GetSysInputSysNum ).ReheatName, IsNotOK );
 						if ( IsNotOK ) {
-							ShowContinueError( "..Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
-							ErrorsFound = true;
+							ShowContinueError( "..Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
+							GetSysInputErrorsFound = true;
 						}
 					}
 					//               GetOnlySingleNode(Alphas(6),ErrorsFound,Sys(SysNum)%SysType,Alphas(1), &
@@ -1439,30 +1566,30 @@ namespace SingleDuct {
 			//        Sys(SysNum)%ReheatAirOutletNode  = &
 			//               GetOnlySingleNode(Alphas(4),ErrorsFound,Sys(SysNum)%SysType,Alphas(1), &
 			//                            NodeType_Air,NodeConnectionType_Outlet,1,ObjectIsParent)
-			AirTermSysOutletNodeName = NodeID( Sys( SysNum ).ReheatAirOutletNode );
+			AirTermSysOutletNodeName = NodeID( Sys( GetSysInputSysNum ).ReheatAirOutletNode );
 			if ( ! SameString( Alphas( 4 ), AirTermSysOutletNodeName ) ) {
-				ShowWarningError( RoutineName + "Invalid air terminal object air outlet node name in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
+				ShowWarningError( RoutineName + "Invalid air terminal object air outlet node name in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
 				ShowContinueError( " Specified air outlet node name is = " + Alphas( 4 ) + "." );
 				ShowContinueError( " Expected air outlet node name is = " + AirTermSysOutletNodeName + "." );
 				//ErrorsFound = true;
 			}
 
-			if ( Sys( SysNum ).ReheatComp_Num == HCoilType_SteamAirHeating ) {
-				Sys( SysNum ).MaxReheatSteamVolFlow = Numbers( 4 );
-				Sys( SysNum ).MinReheatSteamVolFlow = Numbers( 5 );
+			if ( Sys( GetSysInputSysNum ).ReheatComp_Num == HCoilType_SteamAirHeating ) {
+				Sys( GetSysInputSysNum ).MaxReheatSteamVolFlow = Numbers( 4 );
+				Sys( GetSysInputSysNum ).MinReheatSteamVolFlow = Numbers( 5 );
 			} else {
-				Sys( SysNum ).MaxReheatWaterVolFlow = Numbers( 4 );
-				Sys( SysNum ).MinReheatWaterVolFlow = Numbers( 5 );
+				Sys( GetSysInputSysNum ).MaxReheatWaterVolFlow = Numbers( 4 );
+				Sys( GetSysInputSysNum ).MinReheatWaterVolFlow = Numbers( 5 );
 			}
-			Sys( SysNum ).ControllerOffset = Numbers( 6 );
+			Sys( GetSysInputSysNum ).ControllerOffset = Numbers( 6 );
 			// Set default convergence tolerance
-			if ( Sys( SysNum ).ControllerOffset <= 0.0 ) {
-				Sys( SysNum ).ControllerOffset = 0.001;
+			if ( Sys( GetSysInputSysNum ).ControllerOffset <= 0.0 ) {
+				Sys( GetSysInputSysNum ).ControllerOffset = 0.001;
 			}
-			Sys( SysNum ).DamperHeatingAction = HeatingActionNotUsed;
+			Sys( GetSysInputSysNum ).DamperHeatingAction = HeatingActionNotUsed;
 
 			// Register component set data
-			TestCompSet( Sys( SysNum ).SysType, Sys( SysNum ).SysName, NodeID( Sys( SysNum ).InletNodeNum ), NodeID( Sys( SysNum ).ReheatAirOutletNode ), "Air Nodes" );
+			TestCompSet( Sys( GetSysInputSysNum ).SysType, Sys( GetSysInputSysNum ).SysName, NodeID( Sys( GetSysInputSysNum ).InletNodeNum ), NodeID( Sys( GetSysInputSysNum ).ReheatAirOutletNode ), "Air Nodes" );
 
 			// Fill the Zone Equipment data with the inlet node number of this unit.
 			// what if not found?  error?
@@ -1470,47 +1597,47 @@ namespace SingleDuct {
 			for ( CtrlZone = 1; CtrlZone <= NumOfZones; ++CtrlZone ) {
 				if ( ! ZoneEquipConfig( CtrlZone ).IsControlled ) continue;
 				for ( SupAirIn = 1; SupAirIn <= ZoneEquipConfig( CtrlZone ).NumInletNodes; ++SupAirIn ) {
-					if ( Sys( SysNum ).ReheatAirOutletNode == ZoneEquipConfig( CtrlZone ).InletNode( SupAirIn ) ) {
+					if ( Sys( GetSysInputSysNum ).ReheatAirOutletNode == ZoneEquipConfig( CtrlZone ).InletNode( SupAirIn ) ) {
 						IsNotOK = false;
 						if ( ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).OutNode > 0 ) {
 							ShowSevereError( "Error in connecting a terminal unit to a zone" );
-							ShowContinueError( NodeID( Sys( SysNum ).ReheatAirOutletNode ) + " already connects to another zone" );
-							ShowContinueError( "Occurs for terminal unit " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
+							ShowContinueError( NodeID( Sys( GetSysInputSysNum ).ReheatAirOutletNode ) + " already connects to another zone" );
+							ShowContinueError( "Occurs for terminal unit " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
 							ShowContinueError( "Check terminal unit node names for errors" );
-							ErrorsFound = true;
+							GetSysInputErrorsFound = true;
 						} else {
-							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).InNode = Sys( SysNum ).InletNodeNum;
-							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).OutNode = Sys( SysNum ).ReheatAirOutletNode;
+							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).InNode = Sys( GetSysInputSysNum ).InletNodeNum;
+							ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).OutNode = Sys( GetSysInputSysNum ).ReheatAirOutletNode;
 						}
 					}
 				}
 			}
 			if ( IsNotOK ) {
 				ShowWarningError( "Did not Match Supply Air Outlet Node to any Zone Node" );
-				ShowContinueError( "..Occurs in " + Sys( SysNum ).SysType + " = " + Sys( SysNum ).SysName );
+				ShowContinueError( "..Occurs in " + Sys( GetSysInputSysNum ).SysType + " = " + Sys( GetSysInputSysNum ).SysName );
 			}
 
 			// Add reheat coil to component sets array
-			SetUpCompSets( Sys( SysNum ).SysType, Sys( SysNum ).SysName, Alphas( 7 ), Alphas( 8 ), NodeID( Sys( SysNum ).OutletNodeNum ), NodeID( Sys( SysNum ).ReheatAirOutletNode ) );
+			SetUpCompSets( Sys( GetSysInputSysNum ).SysType, Sys( GetSysInputSysNum ).SysName, Alphas( 7 ), Alphas( 8 ), NodeID( Sys( GetSysInputSysNum ).OutletNodeNum ), NodeID( Sys( GetSysInputSysNum ).ReheatAirOutletNode ) );
 			// Add fan to component sets array
-			SetUpCompSets( Sys( SysNum ).SysType, Sys( SysNum ).SysName, Alphas( 5 ), Alphas( 6 ), NodeID( Sys( SysNum ).InletNodeNum ), NodeID( Sys( SysNum ).OutletNodeNum ) );
+			SetUpCompSets( Sys( GetSysInputSysNum ).SysType, Sys( GetSysInputSysNum ).SysName, Alphas( 5 ), Alphas( 6 ), NodeID( Sys( GetSysInputSysNum ).InletNodeNum ), NodeID( Sys( GetSysInputSysNum ).OutletNodeNum ) );
 
 			//Setup the Average damper Position output variable
-			SetupOutputVariable( "Zone Air Terminal VAV Damper Position []", Sys( SysNum ).DamperPosition, "System", "Average", Sys( SysNum ).SysName );
+			SetupOutputVariable( "Zone Air Terminal VAV Damper Position []", Sys( GetSysInputSysNum ).DamperPosition, "System", "Average", Sys( GetSysInputSysNum ).SysName );
 
 		}
 
-		for ( SysIndex = 1; SysIndex <= NumSys; ++SysIndex ) {
+		for ( GetSysInputSysIndex = 1; GetSysInputSysIndex <= NumSys; ++GetSysInputSysIndex ) {
 			for ( ADUNum = 1; ADUNum <= NumAirDistUnits; ++ADUNum ) {
-				if ( Sys( SysIndex ).ReheatAirOutletNode == AirDistUnit( ADUNum ).OutletNodeNum ) {
-					AirDistUnit( ADUNum ).InletNodeNum = Sys( SysIndex ).InletNodeNum;
-					Sys( SysIndex ).ADUNum = ADUNum;
+				if ( Sys( GetSysInputSysIndex ).ReheatAirOutletNode == AirDistUnit( ADUNum ).OutletNodeNum ) {
+					AirDistUnit( ADUNum ).InletNodeNum = Sys( GetSysInputSysIndex ).InletNodeNum;
+					Sys( GetSysInputSysIndex ).ADUNum = ADUNum;
 				}
 			}
 			// one assumes if there isn't one assigned, it's an error?
-			if ( Sys( SysIndex ).ADUNum == 0 ) {
-				ShowSevereError( RoutineName + "No matching Air Distribution Unit, for System = [" + Sys( SysIndex ).SysType + ',' + Sys( SysIndex ).SysName + "]." );
-				ShowContinueError( "...should have outlet node = " + NodeID( Sys( SysIndex ).ReheatAirOutletNode ) );
+			if ( Sys( GetSysInputSysIndex ).ADUNum == 0 ) {
+				ShowSevereError( RoutineName + "No matching Air Distribution Unit, for System = [" + Sys( GetSysInputSysIndex ).SysType + ',' + Sys( GetSysInputSysIndex ).SysName + "]." );
+				ShowContinueError( "...should have outlet node = " + NodeID( Sys( GetSysInputSysIndex ).ReheatAirOutletNode ) );
 				//          ErrorsFound=.TRUE.
 			}
 		}
@@ -1520,13 +1647,13 @@ namespace SingleDuct {
 
 		NumZoneSiz = GetNumObjectsFound( "Sizing:Zone" );
 		if ( NumZoneSiz > 0 ) {
-			for ( SysIndex = 1; SysIndex <= NumSys; ++SysIndex ) {
+			for ( GetSysInputSysIndex = 1; GetSysInputSysIndex <= NumSys; ++GetSysInputSysIndex ) {
 				for ( ZoneSizIndex = 1; ZoneSizIndex <= NumZoneSiz; ++ZoneSizIndex ) {
 					if ( DoZoneSizing ) {
-						if ( FinalZoneSizing( ZoneSizIndex ).ActualZoneNum == Sys( SysIndex ).ActualZoneNum ) {
+						if ( FinalZoneSizing( ZoneSizIndex ).ActualZoneNum == Sys( GetSysInputSysIndex ).ActualZoneNum ) {
 							if ( FinalZoneSizing( ZoneSizIndex ).ZoneSecondaryRecirculation > 0.0 ) {
 								ShowWarningError( RoutineName + "A zone secondary recirculation fraction is specified for zone served by " );
-								ShowContinueError( "...terminal unit \"" + Sys( SysIndex ).SysName + "\" , that indicates a single path system" );
+								ShowContinueError( "...terminal unit \"" + Sys( GetSysInputSysIndex ).SysName + "\" , that indicates a single path system" );
 								ShowContinueError( "...The zone secondary recirculation for that zone was set to 0.0" );
 								FinalZoneSizing( ZoneSizIndex ).ZoneSecondaryRecirculation = 0.0;
 								goto SizLoop_exit;
@@ -1545,7 +1672,7 @@ namespace SingleDuct {
 		lAlphaBlanks.deallocate();
 		lNumericBlanks.deallocate();
 
-		if ( ErrorsFound ) {
+		if ( GetSysInputErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in input.  Preceding condition(s) cause termination." );
 		}
 
@@ -1605,16 +1732,11 @@ namespace SingleDuct {
 		int OutletNode;
 		int ADUNum;
 		int SysIndex;
-		static bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool MySizeFlag;
-		static Array1D_bool GetGasElecHeatCoilCap; // Gets autosized value of coil capacity
 		Real64 SteamTemp;
 		Real64 SteamDensity;
 		Real64 rho;
 		bool errFlag;
 
-		static Array1D_bool PlantLoopScanFlag;
 
 		// FLOW:
 
@@ -1855,28 +1977,17 @@ namespace SingleDuct {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int PltSizHeatNum; // index of plant sizing object for 1st heating loop
-		static Real64 CoilInTemp( 0.0 );
-		static Real64 DesCoilLoad( 0.0 );
-		static Real64 DesZoneHeatLoad( 0.0 );
-		static Real64 ZoneDesTemp( 0.0 );
-		static Real64 ZoneDesHumRat( 0.0 );
 		Real64 DesMassFlow;
 		Real64 TempSteamIn;
 		Real64 EnthSteamOutWet;
 		Real64 EnthSteamInDry;
 		Real64 LatentHeatSteam;
 		Real64 SteamDensity;
-		static int CoilWaterInletNode( 0 );
-		static int CoilWaterOutletNode( 0 );
-		static int CoilSteamInletNode( 0 );
-		static int CoilSteamOutletNode( 0 );
 
 		bool ErrorsFound;
 		bool PlantSizingErrorsFound;
 		Real64 rho; // local fluid density
 		Real64 Cp; // local fluid specific heat
-		static int DummyWaterIndex( 1 );
-		static Real64 UserInputMaxHeatAirVolFlowRate( 0.0 ); // user input for MaxHeatAirVolFlowRate
 		bool IsAutoSize;
 		int ZoneNum( 0 );
 		Real64 MinMinFlowRatio( 0.0 ); // the minimum minimum flow ratio
@@ -2601,20 +2712,11 @@ namespace SingleDuct {
 		Real64 QHeatingDelivered; // the actual output from heating coil
 		Real64 LeakLoadMult; // load multiplier to adjust for downstream leaks
 		Real64 MinFlowFrac; // minimum flow fraction (and minimum damper position)
-		static Real64 MinAirMassFlowRevAct( 0.0 ); // minimum air mass flow rate used in "reverse action" air mass flow rate calculation
-		static Real64 MaxAirMassFlowRevAct( 0.0 ); // maximum air mass flow rate used in "reverse action" air mass flow rate calculation
 		Real64 MassFlowBasedOnOA; // supply air mass flow rate based on zone OA requirements
 		Real64 AirLoopOAFrac; // fraction of outside air entering air loop
 		Real64 DummyMdot; // temporary mass flow rate argument
 
-		static Real64 ZoneTemp( 0.0 ); // zone air temperature [C]
-		static Real64 MaxHeatTemp( 0.0 ); // maximum supply air temperature [C]
-		static Real64 MaxDeviceAirMassFlowReheat( 0.0 ); // air mass flow rate required to meet the coil heating load [W]
-		static Real64 MassFlowReqToLimitLeavingTemp( 0.0 ); // air mass flow rate actually used [W]
-		static Real64 QZoneMaxRHTempLimit( 0.0 ); // maximum zone heat addition rate given constraints of MaxHeatTemp and max
 		// available air mass flow rate [W]
-		static Real64 MinMassAirFlow( 0.0 ); // the air flow rate during heating for normal acting damper
-		static Real64 QZoneMax2( 0.0 ); // temporary variable
 
 		// Note to the perplexed
 		// The SINGLE DUCT:VAV:REHEAT terminal unit originally contained 2 components: a damper
@@ -3117,15 +3219,7 @@ namespace SingleDuct {
 		Real64 DummyMdot;
 		Real64 QActualHeating;
 		Real64 MinFlowFrac; // minimum flow fraction (and minimum damper position)
-		static Real64 ZoneTemp( 0.0 ); // zone air temperature [C]
-		static Real64 MaxHeatTemp( 0.0 ); // maximum supply air temperature [C]
-		static Real64 MassFlowReq( 0.0 ); // air mass flow rate required to meet the coil heating load [W]
-		static Real64 MassFlowActual( 0.0 ); // air mass flow rate actually used [W]
-		static Real64 QZoneMax( 0.0 ); // maximum zone heat addition rate given constraints of MaxHeatTemp and max
 		// available air mass flow rate [W]
-		static Real64 MinMassAirFlow( 0.0 ); // the air flow rate during heating for normal acting damper
-		static Real64 QZoneMax2( 0.0 ); // temporary variable
-		static Real64 QZoneMax3( 0.0 ); // temporary variable
 
 		// Sys(SysNum)%InletNodeNum is the inlet node to the terminal unit and the damper
 		// Sys(SysNum)%OutletNodeNum is the outlet node of the damper and the inlet node of the heating coil
@@ -3140,8 +3234,8 @@ namespace SingleDuct {
 		SysInletNode = Sys( SysNum ).InletNodeNum;
 		CpAirZn = PsyCpAirFnWTdb( Node( ZoneNodeNum ).HumRat, Node( ZoneNodeNum ).Temp );
 		MinFlowFrac = Sys( SysNum ).ZoneMinAirFrac;
-		MinMassAirFlow = MinFlowFrac * StdRhoAir * Sys( SysNum ).MaxAirVolFlowRate;
-		ZoneTemp = Node( ZoneNodeNum ).Temp;
+		SimCBVAVMinMassAirFlow = MinFlowFrac * StdRhoAir * Sys( SysNum ).MaxAirVolFlowRate;
+		SimCBVAVZoneTemp = Node( ZoneNodeNum ).Temp;
 
 		//Then depending on if the Load is for heating or cooling it is handled differently.  First
 		// the massflow rate for cooling is determined to meet the entire load.  Then
@@ -3150,7 +3244,7 @@ namespace SingleDuct {
 		if ( SysInlet( SysNum ).AirMassFlowRateMaxAvail > 0.0 ) {
 			// Calculate the flow required for cooling
 			CpAirSysIn = PsyCpAirFnWTdb( SysInlet( SysNum ).AirHumRat, SysInlet( SysNum ).AirTemp );
-			DeltaTemp = CpAirSysIn * SysInlet( SysNum ).AirTemp - CpAirZn * ZoneTemp;
+			DeltaTemp = CpAirSysIn * SysInlet( SysNum ).AirTemp - CpAirZn * SimCBVAVZoneTemp;
 
 			//Need to check DeltaTemp and ensure that it is not zero
 			if ( DeltaTemp != 0.0 ) {
@@ -3190,7 +3284,7 @@ namespace SingleDuct {
 		//Need to make sure that the damper outlets are passed to the coil inlet
 		UpdateSys( SysNum );
 
-		QActualHeating = QToHeatSetPt - MassFlow * CpAirZn * ( SysInlet( SysNum ).AirTemp - ZoneTemp );
+		QActualHeating = QToHeatSetPt - MassFlow * CpAirZn * ( SysInlet( SysNum ).AirTemp - SimCBVAVZoneTemp );
 
 		if ( ( MassFlow > SmallMassFlow ) && ( QActualHeating > 0.0 ) && ( TempControlType( ZoneNum ) != SingleCoolingSetPoint ) ) {
 			//   VAVHeatandCool boxes operate at varying mass flow rates when reheating, VAV boxes operate at min flow
@@ -3207,18 +3301,18 @@ namespace SingleDuct {
 			// and solving for the air mass flow rate that will meet the load. If the flow rate is between the min and
 			// max we are in condition 2.
 
-			QZoneMax2 = QToHeatSetPt;
+			SimCBVAVQZoneMax2 = QToHeatSetPt;
 
 			if ( Sys( SysNum ).MaxReheatTempSetByUser ) {
 
-				MaxHeatTemp = Sys( SysNum ).MaxReheatTemp;
+				SimCBVAVMaxHeatTemp = Sys( SysNum ).MaxReheatTemp;
 				if ( QToHeatSetPt > SmallLoad ) { // zone has a postive load to heating setpoint
-					MassFlowReq = QToHeatSetPt / ( CpAirZn * ( MaxHeatTemp - ZoneTemp ) );
+					MassFlowReq = QToHeatSetPt / ( CpAirZn * ( SimCBVAVMaxHeatTemp - SimCBVAVZoneTemp ) );
 				} else {
 					MassFlowReq = MassFlow;
 				}
 
-				QZoneMax3 = CpAirZn * ( MaxHeatTemp - ZoneTemp ) * MassFlow;
+				QZoneMax3 = CpAirZn * ( SimCBVAVMaxHeatTemp - SimCBVAVZoneTemp ) * MassFlow;
 
 				MassFlowActual = MassFlow;
 
@@ -3227,16 +3321,16 @@ namespace SingleDuct {
 					// QZoneMax3 = CpAirZn * (MaxHeatTemp - ZoneTemp) * MassFlowActual
 				}
 
-				if ( MassFlowActual <= MinMassAirFlow ) {
-					MassFlowActual = MinMassAirFlow;
+				if ( MassFlowActual <= SimCBVAVMinMassAirFlow ) {
+					MassFlowActual = SimCBVAVMinMassAirFlow;
 				} else if ( MassFlowActual >= Sys( SysNum ).AirMassFlowRateMax ) {
 					MassFlowActual = Sys( SysNum ).AirMassFlowRateMax;
 				}
 
-				QZoneMax = CpAirZn * MassFlowActual * ( MaxHeatTemp - ZoneTemp );
+				QZoneMax = CpAirZn * MassFlowActual * ( SimCBVAVMaxHeatTemp - SimCBVAVZoneTemp );
 
 				// temporary variable
-				QZoneMax2 = min( QZoneMax, QToHeatSetPt );
+				SimCBVAVQZoneMax2 = min( QZoneMax, QToHeatSetPt );
 
 				MassFlow = MassFlowActual;
 
@@ -3253,7 +3347,7 @@ namespace SingleDuct {
 				// Determine the load required to pass to the Component controller
 				// Although this equation looks strange (using temp instead of deltaT), it is corrected later in ControlCompOutput
 				// and is working as-is, temperature setpoints are maintained as expected.
-				QZnReq = QZoneMax2 + MassFlow * CpAirZn * Node( ZoneNodeNum ).Temp;
+				QZnReq = SimCBVAVQZoneMax2 + MassFlow * CpAirZn * Node( ZoneNodeNum ).Temp;
 				if ( QZnReq < SmallLoad ) QZnReq = 0.0;
 
 				// Initialize hot water flow rate to zero.
@@ -3280,7 +3374,7 @@ namespace SingleDuct {
 				// vary up to the maximum (air damper opens to try to meet zone load).
 				if ( Sys( SysNum ).DamperHeatingAction == ReverseAction ) {
 					if ( Node( Sys( SysNum ).ReheatControlNode ).MassFlowRate == Sys( SysNum ).MaxReheatWaterFlow ) {
-						ControlCompOutput( Sys( SysNum ).ReheatName, Sys( SysNum ).ReheatComp, Sys( SysNum ).ReheatComp_Index, FirstHVACIteration, QZoneMax2, Sys( SysNum ).OutletNodeNum, SysInlet( SysNum ).AirMassFlowRateMaxAvail, SysInlet( SysNum ).AirMassFlowRateMinAvail, Sys( SysNum ).ControllerOffset, Sys( SysNum ).ControlCompTypeNum, Sys( SysNum ).CompErrIndex, ZoneNodeNum, SysOutletNode );
+						ControlCompOutput( Sys( SysNum ).ReheatName, Sys( SysNum ).ReheatComp, Sys( SysNum ).ReheatComp_Index, FirstHVACIteration, SimCBVAVQZoneMax2, Sys( SysNum ).OutletNodeNum, SysInlet( SysNum ).AirMassFlowRateMaxAvail, SysInlet( SysNum ).AirMassFlowRateMinAvail, Sys( SysNum ).ControllerOffset, Sys( SysNum ).ControlCompTypeNum, Sys( SysNum ).CompErrIndex, ZoneNodeNum, SysOutletNode );
 						//                                   ! air flow controller, not on plant, don't pass plant topology info
 
 						// reset terminal unit inlet air mass flow to new value.
@@ -3306,7 +3400,7 @@ namespace SingleDuct {
 				}
 			} else if ( SELECT_CASE_var == HCoilType_SteamAirHeating ) { // ! COIL:STEAM:AIRHEATING
 				// Determine the load required to pass to the Component controller
-				QZnReq = QZoneMax2 - MassFlow * CpAirZn * ( SysInlet( SysNum ).AirTemp - ZoneTemp );
+				QZnReq = SimCBVAVQZoneMax2 - MassFlow * CpAirZn * ( SysInlet( SysNum ).AirTemp - SimCBVAVZoneTemp );
 				if ( QZnReq < SmallLoad ) QZnReq = 0.0;
 
 				// Simulate reheat coil for the VAV system
@@ -3314,8 +3408,8 @@ namespace SingleDuct {
 
 			} else if ( SELECT_CASE_var == HCoilType_Electric ) { // COIL:ELECTRIC:HEATING
 				// Determine the load required to pass to the Component controller
-				QSupplyAir = MassFlow * CpAirZn * ( SysInlet( SysNum ).AirTemp - ZoneTemp );
-				QZnReq = QZoneMax2 - QSupplyAir;
+				QSupplyAir = MassFlow * CpAirZn * ( SysInlet( SysNum ).AirTemp - SimCBVAVZoneTemp );
+				QZnReq = SimCBVAVQZoneMax2 - QSupplyAir;
 				if ( QZnReq < SmallLoad ) QZnReq = 0.0;
 
 				// Simulate reheat coil for the VAV system
@@ -3323,7 +3417,7 @@ namespace SingleDuct {
 
 			} else if ( SELECT_CASE_var == HCoilType_Gas ) { // COIL:GAS:HEATING
 				// Determine the load required to pass to the Component controller
-				QZnReq = QZoneMax2 - MassFlow * CpAirZn * ( SysInlet( SysNum ).AirTemp - ZoneTemp );
+				QZnReq = SimCBVAVQZoneMax2 - MassFlow * CpAirZn * ( SysInlet( SysNum ).AirTemp - SimCBVAVZoneTemp );
 				if ( QZnReq < SmallLoad ) QZnReq = 0.0;
 
 				// Simulate reheat coil for the VAV system
@@ -3563,7 +3657,7 @@ namespace SingleDuct {
 				Par( 6 ) = double( FanType );
 				Par( 7 ) = double( FanOp );
 				Par( 8 ) = QTotLoad;
-				SolveRegulaFalsi( UnitFlowToler, 50, SolFlag, MassFlow, VAVVSCoolingResidual, MinMassFlow, MaxCoolMassFlow, Par );
+				SolveRegulaFalsi( UnitFlowToler, 50, SolFlag, MassFlow, VAVVSCoolingResidual, MinMassFlow, MaxCoolMassFlow, Par, "SimVAVVS" );
 				if ( SolFlag == -1 ) {
 					if ( Sys( SysNum ).IterationLimit == 0 ) {
 						ShowWarningError( "Supply air flow control failed in VS VAV terminal unit " + Sys( SysNum ).SysName );
@@ -3621,7 +3715,7 @@ namespace SingleDuct {
 					Par( 7 ) = double( FanOp );
 					Par( 8 ) = QTotLoad;
 					ErrTolerance = Sys( SysNum ).ControllerOffset;
-					SolveRegulaFalsi( ErrTolerance, 500, SolFlag, HWFlow, VAVVSHWNoFanResidual, MinFlowWater, MaxFlowWater, Par );
+					SolveRegulaFalsi( ErrTolerance, 500, SolFlag, HWFlow, VAVVSHWNoFanResidual, MinFlowWater, MaxFlowWater, Par, "SimVAVVS" );
 					if ( SolFlag == -1 ) {
 						ShowRecurringWarningErrorAtEnd( "Hot Water flow control failed in VS VAV terminal unit " + Sys( SysNum ).SysName, Sys( SysNum ).ErrCount1 );
 						ShowRecurringContinueErrorAtEnd( "...Iteration limit (500) exceeded in calculating the hot water flow rate", Sys( SysNum ).ErrCount1c );
@@ -3648,7 +3742,7 @@ namespace SingleDuct {
 					Par( 6 ) = double( FanType );
 					Par( 7 ) = double( FanOp );
 					Par( 8 ) = QTotLoad;
-					SolveRegulaFalsi( UnitFlowToler, 50, SolFlag, MassFlow, VAVVSHWFanOnResidual, MinMassFlow, MaxHeatMassFlow, Par );
+					SolveRegulaFalsi( UnitFlowToler, 50, SolFlag, MassFlow, VAVVSHWFanOnResidual, MinMassFlow, MaxHeatMassFlow, Par, "SimVAVVS" );
 					if ( SolFlag == -1 ) {
 						if ( Sys( SysNum ).IterationLimit == 0 ) {
 							ShowWarningError( "Supply air flow control failed in VS VAV terminal unit " + Sys( SysNum ).SysName );
@@ -3689,7 +3783,7 @@ namespace SingleDuct {
 					Par( 10 ) = MaxFlowSteam;
 					Par( 11 ) = MaxSteamCap;
 					ErrTolerance = Sys( SysNum ).ControllerOffset;
-					SolveRegulaFalsi( ErrTolerance, 500, SolFlag, HWFlow, VAVVSHWNoFanResidual, MinFlowSteam, MaxFlowSteam, Par );
+					SolveRegulaFalsi( ErrTolerance, 500, SolFlag, HWFlow, VAVVSHWNoFanResidual, MinFlowSteam, MaxFlowSteam, Par, "SimVAVVS" );
 					if ( SolFlag == -1 ) {
 						ShowRecurringWarningErrorAtEnd( "Steam flow control failed in VS VAV terminal unit " + Sys( SysNum ).SysName, Sys( SysNum ).ErrCount1 );
 						ShowRecurringContinueErrorAtEnd( "...Iteration limit (500) exceeded in calculating the hot water flow rate", Sys( SysNum ).ErrCount1c );
@@ -3715,7 +3809,7 @@ namespace SingleDuct {
 					Par( 6 ) = double( FanType );
 					Par( 7 ) = double( FanOp );
 					Par( 8 ) = QTotLoad;
-					SolveRegulaFalsi( UnitFlowToler, 50, SolFlag, MassFlow, VAVVSHWFanOnResidual, MinMassFlow, MaxHeatMassFlow, Par );
+					SolveRegulaFalsi( UnitFlowToler, 50, SolFlag, MassFlow, VAVVSHWFanOnResidual, MinMassFlow, MaxHeatMassFlow, Par, "SimVAVVS" );
 					if ( SolFlag == -1 ) {
 						if ( Sys( SysNum ).IterationLimit == 0 ) {
 							ShowWarningError( "Steam heating coil control failed in VS VAV terminal unit " + Sys( SysNum ).SysName );
@@ -3754,7 +3848,7 @@ namespace SingleDuct {
 					Par( 6 ) = double( FanType );
 					Par( 7 ) = double( FanOp );
 					Par( 8 ) = QTotLoad;
-					SolveRegulaFalsi( UnitFlowToler, 50, SolFlag, FracDelivered, VAVVSHCFanOnResidual, 0.0, 1.0, Par );
+					SolveRegulaFalsi( UnitFlowToler, 50, SolFlag, FracDelivered, VAVVSHCFanOnResidual, 0.0, 1.0, Par, "SimVAVVS" );
 					if ( SolFlag == -1 ) {
 						if ( Sys( SysNum ).IterationLimit == 0 ) {
 							ShowWarningError( "Heating coil control failed in VS VAV terminal unit " + Sys( SysNum ).SysName );
@@ -3839,20 +3933,16 @@ namespace SingleDuct {
 		Real64 MaxFlowWater; // This is the value passed to the Controller depending if FirstHVACIteration or not
 		Real64 MinFlowWater; // This is the value passed to the Controller depending if FirstHVACIteration or not
 		Real64 QActualHeating; // the heating load seen by the reheat coil
-		static Real64 TAirMax( 0.0 ); // Maximum zone supply air temperature [C]
-		static Real64 QMax( 0.0 ); // Maximum heat addition rate imposed by the max zone supply air temperature [W]
-		static Real64 ZoneTemp( 0.0 ); // Zone temperature [C]
-		static Real64 QMax2( 0.0 );
 		Real64 DummyMdot; // local fluid mass flow rate
 
 		QToHeatSetPt = ZoneSysEnergyDemand( ZoneNum ).RemainingOutputReqToHeatSP; // The calculated load from the Heat Balance
 		MassFlow = SysInlet( SysNum ).AirMassFlowRateMaxAvail; // System massflow is set to the Available
 		QMax2 = QToHeatSetPt;
-		ZoneTemp = Node( ZoneNodeNum ).Temp;
-		CpAir = PsyCpAirFnWTdb( Node( ZoneNodeNum ).HumRat, ZoneTemp ); // zone air specific heat
+		SimConstVolZoneTemp = Node( ZoneNodeNum ).Temp;
+		CpAir = PsyCpAirFnWTdb( Node( ZoneNodeNum ).HumRat, SimConstVolZoneTemp ); // zone air specific heat
 		if ( Sys( SysNum ).MaxReheatTempSetByUser ) {
 			TAirMax = Sys( SysNum ).MaxReheatTemp;
-			QMax = CpAir * MassFlow * ( TAirMax - ZoneTemp );
+			QMax = CpAir * MassFlow * ( TAirMax - SimConstVolZoneTemp );
 			QMax2 = min( QToHeatSetPt, QMax );
 		} // IF (Sys(SysNum)%MaxReheatTempSetByUser) THEN
 
@@ -3874,7 +3964,7 @@ namespace SingleDuct {
 		SysOutlet( SysNum ).AirMassFlowRateMinAvail = SysInlet( SysNum ).AirMassFlowRateMinAvail;
 		UpdateSys( SysNum );
 
-		QActualHeating = QToHeatSetPt - MassFlow * CpAir * ( SysInlet( SysNum ).AirTemp - ZoneTemp ); // reheat needed
+		QActualHeating = QToHeatSetPt - MassFlow * CpAir * ( SysInlet( SysNum ).AirTemp - SimConstVolZoneTemp ); // reheat needed
 		//Now the massflow for reheating has been determined. If it is zero, or in SetBack, or the
 		// system scheduled OFF then not operational and shut the system down.
 		if ( ( MassFlow > SmallMassFlow ) && ( QActualHeating > 0.0 ) && ( TempControlType( ZoneNum ) != SingleCoolingSetPoint ) ) {
@@ -3883,7 +3973,7 @@ namespace SingleDuct {
 
 			if ( SELECT_CASE_var == HCoilType_SimpleHeating ) { // COIL:WATER:SIMPLEHEATING
 				// Determine the load required to pass to the Component controller
-				QZnReq = QMax2 + MassFlow * CpAir * ZoneTemp;
+				QZnReq = QMax2 + MassFlow * CpAir * SimConstVolZoneTemp;
 
 				//Before Iterating through the Reheat Coil and Controller set the flags for the
 				// Do Loop to initialized conditions.
@@ -3909,20 +3999,20 @@ namespace SingleDuct {
 
 			} else if ( SELECT_CASE_var == HCoilType_SteamAirHeating ) { // COIL:STEAM:STEAMAIRHEATING
 				// Determine the load required to pass to the Component controller
-				QZnReq = QMax2 - MassFlow * CpAir * ( SysInlet( SysNum ).AirTemp - ZoneTemp );
+				QZnReq = QMax2 - MassFlow * CpAir * ( SysInlet( SysNum ).AirTemp - SimConstVolZoneTemp );
 
 				// Simulate reheat coil for the VAV system
 				SimulateSteamCoilComponents( Sys( SysNum ).ReheatName, FirstHVACIteration, Sys( SysNum ).ReheatComp_Index, QZnReq );
 			} else if ( SELECT_CASE_var == HCoilType_Electric ) { // COIL:ELECTRIC:HEATING
 				// Determine the load required to pass to the Component controller
-				QZnReq = QMax2 - MassFlow * CpAir * ( SysInlet( SysNum ).AirTemp - ZoneTemp );
+				QZnReq = QMax2 - MassFlow * CpAir * ( SysInlet( SysNum ).AirTemp - SimConstVolZoneTemp );
 
 				// Simulate reheat coil for the VAV system
 				SimulateHeatingCoilComponents( Sys( SysNum ).ReheatName, FirstHVACIteration, QZnReq, Sys( SysNum ).ReheatComp_Index );
 
 			} else if ( SELECT_CASE_var == HCoilType_Gas ) { // COIL:GAS:HEATING
 				// Determine the load required to pass to the Component controller
-				QZnReq = QMax2 - MassFlow * CpAir * ( SysInlet( SysNum ).AirTemp - ZoneTemp );
+				QZnReq = QMax2 - MassFlow * CpAir * ( SysInlet( SysNum ).AirTemp - SimConstVolZoneTemp );
 
 				// Simulate reheat coil for the VAV system
 				SimulateHeatingCoilComponents( Sys( SysNum ).ReheatName, FirstHVACIteration, QZnReq, Sys( SysNum ).ReheatComp_Index );
@@ -4629,7 +4719,6 @@ namespace SingleDuct {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int SysNum( 0 );
 
 		if ( GetATMixerFlag ) {
 			GetATMixers();
@@ -4637,20 +4726,20 @@ namespace SingleDuct {
 		}
 
 		if ( SysIndex == 0 ) {
-			SysNum = FindItemInList( SysName, SysATMixer );
-			SysIndex = SysNum;
-			if ( SysNum == 0 ) {
+			SimATMixerSysNum = FindItemInList( SysName, SysATMixer );
+			SysIndex = SimATMixerSysNum;
+			if ( SimATMixerSysNum == 0 ) {
 				ShowFatalError( "Object " + SysName + " not found" );
 			}
 		} else {
-			SysNum = SysIndex;
+			SimATMixerSysNum = SysIndex;
 		}
 
-		InitATMixer( SysNum, FirstHVACIteration ); // Not being used, is placeholder
+		InitATMixer( SimATMixerSysNum, FirstHVACIteration ); // Not being used, is placeholder
 
-		CalcATMixer( SysNum );
+		CalcATMixer( SimATMixerSysNum );
 
-		UpdateATMixer( SysNum );
+		UpdateATMixer( SimATMixerSysNum );
 
 	}
 
@@ -4705,7 +4794,6 @@ namespace SingleDuct {
 		int ATMixerNum; // Index of inlet side mixer air terminal unit
 		int IOStat;
 		static std::string const RoutineName( "GetATMixers: " ); // include trailing blank space
-		static bool ErrorsFound( false ); // Error flag
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int NodeNum; // Index to node number
@@ -4724,7 +4812,7 @@ namespace SingleDuct {
 			IsBlank = false;
 			VerifyName( cAlphaArgs( 1 ), SysATMixer, ATMixerNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetATMixersErrorsFound = true;
 				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxxxxx";
 			}
 			SysATMixer( ATMixerNum ).Name = cAlphaArgs( 1 );
@@ -4751,22 +4839,22 @@ namespace SingleDuct {
 
 			ValidateComponent( cAlphaArgs( 2 ), SysATMixer( ATMixerNum ).ZoneHVACUnitName, errFlag, cCurrentModuleObject );
 
-			SysATMixer( ATMixerNum ).MixedAirOutNode = GetOnlySingleNode( cAlphaArgs( 4 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent, cAlphaFieldNames( 4 ) );
+			SysATMixer( ATMixerNum ).MixedAirOutNode = GetOnlySingleNode( cAlphaArgs( 4 ), GetATMixersErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent, cAlphaFieldNames( 4 ) );
 
-			SysATMixer( ATMixerNum ).PriInNode = GetOnlySingleNode( cAlphaArgs( 5 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent, cAlphaFieldNames( 5 ) );
-			SysATMixer( ATMixerNum ).SecInNode = GetOnlySingleNode( cAlphaArgs( 6 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent, cAlphaFieldNames( 6 ) );
+			SysATMixer( ATMixerNum ).PriInNode = GetOnlySingleNode( cAlphaArgs( 5 ), GetATMixersErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent, cAlphaFieldNames( 5 ) );
+			SysATMixer( ATMixerNum ).SecInNode = GetOnlySingleNode( cAlphaArgs( 6 ), GetATMixersErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent, cAlphaFieldNames( 6 ) );
 			// Check for dupes in the three nodes.
 			if ( SysATMixer( ATMixerNum ).SecInNode == SysATMixer( ATMixerNum ).PriInNode ) {
 				ShowSevereError( cCurrentModuleObject + " = " + SysATMixer( ATMixerNum ).Name + ' ' + cAlphaArgs( 5 ) + " = " + NodeID( SysATMixer( ATMixerNum ).PriInNode ) + " duplicates the " + cAlphaArgs( 4 ) + '.' );
-				ErrorsFound = true;
+				GetATMixersErrorsFound = true;
 			} else if ( SysATMixer( ATMixerNum ).SecInNode == SysATMixer( ATMixerNum ).MixedAirOutNode ) {
 				ShowSevereError( cCurrentModuleObject + " = " + SysATMixer( ATMixerNum ).Name + ' ' + cAlphaArgs( 6 ) + " = " + NodeID( SysATMixer( ATMixerNum ).MixedAirOutNode ) + " duplicates the " + cAlphaArgs( 4 ) + '.' );
-				ErrorsFound = true;
+				GetATMixersErrorsFound = true;
 			}
 
 			if ( SysATMixer( ATMixerNum ).PriInNode == SysATMixer( ATMixerNum ).MixedAirOutNode ) {
 				ShowSevereError( cCurrentModuleObject + " = " + SysATMixer( ATMixerNum ).Name + ' ' + cAlphaArgs( 6 ) + " = " + NodeID( SysATMixer( ATMixerNum ).MixedAirOutNode ) + " duplicates the " + cAlphaArgs( 5 ) + '.' );
-				ErrorsFound = true;
+				GetATMixersErrorsFound = true;
 			}
 
 			if ( SysATMixer( ATMixerNum ).MixerType == ATMixer_InletSide ) {
@@ -4794,7 +4882,7 @@ namespace SingleDuct {
 					ShowSevereError( cCurrentModuleObject + " = \"" + SysATMixer( ATMixerNum ).Name + "\". Inlet Side Air Terminal Mixer air inlet node name must be the same as a zone exhaust node name." );
 					ShowContinueError( "..Zone exhaust node name is specified in ZoneHVAC:EquipmentConnections object." );
 					ShowContinueError( "..Inlet Side CONNECTED Air Terminal Mixer inlet node name = " + NodeID( SysATMixer( ATMixerNum ).SecInNode ) );
-					ErrorsFound = true;
+					GetATMixersErrorsFound = true;
 				}				
 			}
 
@@ -4822,7 +4910,7 @@ namespace SingleDuct {
 					ShowSevereError( cCurrentModuleObject + " = \"" + SysATMixer( ATMixerNum ).Name + "\". Supply Side Air Terminal Mixer air outlet node name must be the same as a zone inlet node name." );
 					ShowContinueError( "..Zone inlet node name is specified in ZoneHVAC:EquipmentConnections object." );
 					ShowContinueError( "..Supply Side connected Air Terminal Mixer outlet node name = " + NodeID( SysATMixer( ATMixerNum ).MixedAirOutNode ) );
-					ErrorsFound = true;
+					GetATMixersErrorsFound = true;
 				}
 
 			}
@@ -4830,7 +4918,7 @@ namespace SingleDuct {
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetATMixersErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in input.  Program terminates." );
 		}
 
@@ -4925,20 +5013,8 @@ namespace SingleDuct {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static Real64 PriMassFlowRate( 0.0 );
-		static Real64 PriEnthalpy( 0.0 );
-		static Real64 PriHumRat( 0.0 );
-		static Real64 PriTemp( 0.0 );
 
-		static Real64 SecAirMassFlowRate( 0.0 );
-		static Real64 SecAirEnthalpy( 0.0 );
-		static Real64 SecAirHumRat( 0.0 );
-		static Real64 SecAirTemp( 0.0 );
 
-		static Real64 MixedAirMassFlowRate( 0.0 );
-		static Real64 MixedAirEnthalpy( 0.0 );
-		static Real64 MixedAirHumRat( 0.0 );
-		static Real64 MixedAirTemp( 0.0 );
 
 		PriEnthalpy = Node( SysATMixer( SysNum ).PriInNode ).Enthalpy;
 		PriHumRat = Node( SysATMixer( SysNum ).PriInNode ).HumRat;
@@ -77,6 +77,28 @@
 #include <WeatherManager.hh>
 
 namespace EnergyPlus {
+
+namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+	bool eioHeaderDoneOnce( false );
+}
+
+namespace SizingAnalysisObjects {
+
+	// Clears the global data in SizingAnalysisObjects.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		eioHeaderDoneOnce = false;
+	}
+
+} // SizingAnalysisObjects
+
 	ZoneTimestepObject::ZoneTimestepObject()
 	{
 		kindOfSim = 0;
@@ -537,7 +559,6 @@ namespace EnergyPlus {
 		std::string chDemandTrapUsed;
 		static gio::Fmt fmtA( "(A)" );
 		bool changedByDemand( false );
-		static bool eioHeaderDoneOnce( false );
 		bool nullStampProblem;
 
 		// first make sure we have valid time stamps to work with
@@ -69,6 +69,14 @@
 
 namespace EnergyPlus {
 
+namespace SizingAnalysisObjects {
+
+	// Clears the global data in SizingAnalysisObjects.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
+} // SizingAnalysisObjects
 
 class SystemTimestepObject
 {
@@ -137,11 +137,67 @@ namespace SizingManager {
 
 	// MODULE SUBROUTINES:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool Available( false ); // an environment is available to process
+		bool ManageSizingErrorsFound( false );
+		bool SimAir( false );
+		bool SimZoneEquip( false );
+		int TimeStepInDay( 0 ); // time step number
+		int LastMonth( 0 );
+		int LastDayOfMonth( 0 );
+		int CtrlZoneNum( 0 ); // controlled zone index
+		int ZoneNum( 0 ); // index into the Zone data array for the controlled zone
+		Real64 TempAtPeak( 0.0 ); // Outside temperature at peak cooling/heating for reporting
+		Real64 HumRatAtPeak( 0.0 ); // Outside humidity ratio at peak cooling/heating for reporting
+		int TimeStepAtPeak( 0 ); // time step number at heat or cool peak
+		int DDNum( 0 ); // Design Day index
+		int AirLoopNum( 0 ); // air loop index
+		bool runZeroingOnce( true );
+		bool GetOARequirementsErrorsFound( false ); // If errors detected in input
+		bool GetZoneAirDistributionErrorsFound( false ); // If errors detected in input
+		bool GetZoneSizingInputErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool GetSystemSizingInputErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool GetPlantSizingInputErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool SetupZoneSizingAvailable( false ); // an environment is available to process
+		bool MyOneTimeFlag( true );
+		bool ReportSysSizingMyOneTimeFlag( true );
+		bool GetZoneHVACSizingErrorsFound( false ); // If errors detected in input
+	}
+
 	// Functions
 	void
 	clear_state()
 	{
 	 NumAirLoops = 0;
+		Available = false;
+		ManageSizingErrorsFound = false;
+		SimAir = false;
+		SimZoneEquip = false;
+		TimeStepInDay = 0;
+		LastMonth = 0;
+		LastDayOfMonth = 0;
+		CtrlZoneNum = 0;
+		ZoneNum = 0;
+		TempAtPeak = 0.0;
+		HumRatAtPeak = 0.0;
+		TimeStepAtPeak = 0;
+		DDNum = 0;
+		AirLoopNum = 0;
+		runZeroingOnce = true;
+		GetOARequirementsErrorsFound = false;
+		GetZoneAirDistributionErrorsFound = false;
+		GetZoneSizingInputErrorsFound = false;
+		GetSystemSizingInputErrorsFound = false;
+		GetPlantSizingInputErrorsFound = false;
+		SetupZoneSizingAvailable = false;
+		MyOneTimeFlag = true;
+		ReportSysSizingMyOneTimeFlag = true;
+		GetZoneHVACSizingErrorsFound = false;
 	}
 
 
@@ -204,20 +260,6 @@ namespace SizingManager {
 		// DERIVED TYPE DEFINITIONS: none
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool Available( false ); // an environment is available to process
-		static bool ErrorsFound( false );
-		static bool SimAir( false );
-		static bool SimZoneEquip( false );
-		static int TimeStepInDay( 0 ); // time step number
-		static int LastMonth( 0 );
-		static int LastDayOfMonth( 0 );
-		static int CtrlZoneNum( 0 ); // controlled zone index
-		static int ZoneNum( 0 ); // index into the Zone data array for the controlled zone
-		static Real64 TempAtPeak( 0.0 ); // Outside temperature at peak cooling/heating for reporting
-		static Real64 HumRatAtPeak( 0.0 ); // Outside humidity ratio at peak cooling/heating for reporting
-		static int TimeStepAtPeak( 0 ); // time step number at heat or cool peak
-		static int DDNum( 0 ); // Design Day index
-		static int AirLoopNum( 0 ); // air loop index
 		//  EXTERNAL            ReportZoneSizing
 		//  EXTERNAL            ReportSysSizing
 		std::string curName;
@@ -225,7 +267,6 @@ namespace SizingManager {
 		int write_stat;
 		int numZoneSizeIter; // number of times to repeat zone sizing calcs. 1 normal, 2 load component reporting
 		int iZoneCalcIter; // index for repeating the zone sizing calcs
-		static bool runZeroingOnce( true );
 		bool isUserReqCompLoadReport;
 		Real64 DOASHeatGainRateAtHtPk( 0.0 ); // zone heat gain rate from the DOAS at the heating peak [W]
 		Real64 DOASHeatGainRateAtClPk( 0.0 ); // zone heat gain rate from the DOAS at the cooling peak [W]
@@ -306,7 +347,7 @@ namespace SizingManager {
 
 			ResetEnvironmentCounter();
 			KickOffSizing = true;
-			SetupZoneSizing( ErrorsFound ); // Should only be done ONCE
+			SetupZoneSizing( ManageSizingErrorsFound ); // Should only be done ONCE
 			KickOffSizing = false;
 
 			for ( iZoneCalcIter = 1; iZoneCalcIter <= numZoneSizeIter; ++iZoneCalcIter ) { //normally this is performed once but if load component
@@ -326,10 +367,10 @@ namespace SizingManager {
 				NumSizingPeriodsPerformed = 0;
 				while ( Available ) { // loop over environments
 
-					GetNextEnvironment( Available, ErrorsFound ); // get an environment
+					GetNextEnvironment( Available, ManageSizingErrorsFound ); // get an environment
 
 					if ( ! Available ) break;
-					if ( ErrorsFound ) break;
+					if ( ManageSizingErrorsFound ) break;
 
 					// check that environment is one of the design days
 					if ( KindOfSim == ksRunPeriodWeather ) {
@@ -463,7 +504,7 @@ namespace SizingManager {
 					ZoneSizingRunDone = true;
 				} else {
 					ShowSevereError( RoutineName + "No Sizing periods were performed for Zone Sizing. No Zone Sizing calculations saved." );
-					ErrorsFound = true;
+					ManageSizingErrorsFound = true;
 				}
 
 				if ( isPulseZoneSizing && runZeroingOnce ) {
@@ -490,7 +531,7 @@ namespace SizingManager {
 			ShowWarningError( RoutineName + "For a system sizing run, there must be at least 1 Sizing:System object input. SimulationControl System Sizing option ignored." );
 		}
 
-		if ( ( NumSysSizInput > 0 ) && ( DoSystemSizing || DoPlantSizing ) && ! ErrorsFound ) {
+		if ( ( NumSysSizInput > 0 ) && ( DoSystemSizing || DoPlantSizing ) && ! ManageSizingErrorsFound ) {
 
 			ShowMessage( "Beginning System Sizing Calculations" );
 
@@ -528,7 +569,7 @@ namespace SizingManager {
 			NumSizingPeriodsPerformed = 0;
 			while ( Available ) { // loop over environments
 
-				GetNextEnvironment( Available, ErrorsFound ); // get an environment
+				GetNextEnvironment( Available, ManageSizingErrorsFound ); // get an environment
 
 				// check that environment is one of the design days
 				if ( KindOfSim == ksRunPeriodWeather ) {
@@ -536,7 +577,7 @@ namespace SizingManager {
 				}
 
 				if ( ! Available ) break;
-				if ( ErrorsFound ) break;
+				if ( ManageSizingErrorsFound ) break;
 
 				++NumSizingPeriodsPerformed;
 
@@ -622,7 +663,7 @@ namespace SizingManager {
 				SysSizingRunDone = true;
 			} else {
 				ShowSevereError( RoutineName + "No Sizing periods were performed for System Sizing. No System Sizing calculations saved." );
-				ErrorsFound = true;
+				ManageSizingErrorsFound = true;
 			}
 		}
 		SysSizingCalc = false;
@@ -739,13 +780,13 @@ namespace SizingManager {
 			ShowWarningError( RoutineName + "For a plant sizing run, there must be at least 1 Sizing:Plant object input. SimulationControl Plant Sizing option ignored." );
 		}
 
-		if ( ( NumPltSizInput > 0 ) && ( DoPlantSizing ) && ! ErrorsFound ) {
+		if ( ( NumPltSizInput > 0 ) && ( DoPlantSizing ) && ! ManageSizingErrorsFound ) {
 
 			ShowMessage( "Beginning Plant Sizing Calculations" );
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( ManageSizingErrorsFound ) {
 			ShowFatalError( "Program terminates due to preceding conditions." );
 		}
 
@@ -804,7 +845,6 @@ namespace SizingManager {
 		int TotalArgs; // Total number of alpha and numeric arguments (max) for a
 		int IOStatus; // Used in GetObjectItem
 		int OAIndex;
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		//  REAL(r64) :: CalcAmt
@@ -838,12 +878,12 @@ namespace SizingManager {
 
 				VerifyName( Alphas( 1 ), OARequirements, OAIndex - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetOARequirementsErrorsFound = true;
 					if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 				}
 				OARequirements( OAIndex ).Name = Alphas( 1 );
 
-				ProcessInputOARequirements( CurrentModuleObject, OAIndex, Alphas, NumAlphas, Numbers, NumNumbers, lNumericBlanks, lAlphaBlanks, cAlphaFields, cNumericFields, ErrorsFound );
+				ProcessInputOARequirements( CurrentModuleObject, OAIndex, Alphas, NumAlphas, Numbers, NumNumbers, lNumericBlanks, lAlphaBlanks, cAlphaFields, cNumericFields, GetOARequirementsErrorsFound );
 
 			}
 
@@ -854,7 +894,7 @@ namespace SizingManager {
 			lAlphaBlanks.deallocate();
 			lNumericBlanks.deallocate();
 
-			if ( ErrorsFound ) {
+			if ( GetOARequirementsErrorsFound ) {
 				ShowFatalError( RoutineName + "Errors found in input.  Preceding condition(s) cause termination." );
 			}
 
@@ -1050,7 +1090,6 @@ namespace SizingManager {
 		int TotalArgs; // Total number of alpha and numeric arguments (max) for a
 		int IOStatus; // Used in GetObjectItem
 		int ZADIndex;
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 
@@ -1083,7 +1122,7 @@ namespace SizingManager {
 
 				VerifyName( Alphas( 1 ), ZoneAirDistribution, ZADIndex - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetZoneAirDistributionErrorsFound = true;
 					if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 				}
 
@@ -1131,12 +1170,12 @@ namespace SizingManager {
 								ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + ZoneAirDistribution( ZADIndex ).Name + "\"," );
 								ShowContinueError( "Error found in " + cAlphaFields( 2 ) + " = " + Alphas( 2 ) );
 								ShowContinueError( "Schedule values must be >0.0)" );
-								ErrorsFound = true;
+								GetZoneAirDistributionErrorsFound = true;
 							}
 						} else {
 							ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + ZoneAirDistribution( ZADIndex ).Name + "\"," );
 							ShowContinueError( "...Not Found " + cAlphaFields( 2 ) + "=\"" + Alphas( 2 ) + "\"." );
-							ErrorsFound = true;
+							GetZoneAirDistributionErrorsFound = true;
 						}
 					}
 				}
@@ -1150,7 +1189,7 @@ namespace SizingManager {
 			lAlphaBlanks.deallocate();
 			lNumericBlanks.deallocate();
 
-			if ( ErrorsFound ) {
+			if ( GetZoneAirDistributionErrorsFound ) {
 				ShowFatalError( RoutineName + "Errors found in input.  Preceding condition(s) cause termination." );
 			}
 
@@ -1311,7 +1350,6 @@ namespace SizingManager {
 		int NumAlphas; // Number of Alphas for each GetObjectItem call
 		int NumNumbers; // Number of Numbers for each GetObjectItem call
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int NumDesDays; // Number of design days in input
@@ -1370,7 +1408,7 @@ namespace SizingManager {
 			IsBlank = false;
 			VerifyName( cAlphaArgs( 1 ), SizingZoneObjects, Item - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetZoneSizingInputErrorsFound = true;
 				errFlag = true;
 				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 			}
@@ -1393,7 +1431,7 @@ namespace SizingManager {
 				SizingZoneObjects( Item ).ZoneOrZoneListPtr = ZLItem;
 			} else {
 				ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid " + cAlphaFieldNames( 1 ) + " not found." );
-				ErrorsFound = true;
+				GetZoneSizingInputErrorsFound = true;
 				errFlag = true;
 			}
 		}
@@ -1408,7 +1446,7 @@ namespace SizingManager {
 			NumDesDays = GetNumObjectsFound( "SizingPeriod:DesignDay" ) + GetNumObjectsFound( "SizingPeriod:WeatherFileDays" ) + GetNumObjectsFound( "SizingPeriod:WeatherFileConditionType" );
 			if ( NumDesDays == 0 && ( DoZoneSizing || DoSystemSizing || DoPlantSizing ) ) {
 				ShowSevereError( "Zone Sizing calculations need SizingPeriod:* input. None found." );
-				ErrorsFound = true;
+				GetZoneSizingInputErrorsFound = true;
 			}
 			ZoneSizingInput.allocate( NumZoneSizingInput );
 
@@ -1438,7 +1476,7 @@ namespace SizingManager {
 					IsBlank = false;
 					VerifyName( ZoneSizingInput( ZoneSizIndex ).ZoneName, ZoneSizingInput, &ZoneSizingInputData::ZoneName, ZoneSizIndex - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 					if ( IsNotOK ) {
-						ErrorsFound = true;
+						GetZoneSizingInputErrorsFound = true;
 						if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 					}
 					if ( IsNotOK && ! SizingZoneObjects( Item ).ZoneListActive ) {
@@ -1460,7 +1498,7 @@ namespace SizingManager {
 						ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 						ShowContinueError( "... incorrect " + cAlphaFieldNames( 2 ) + "=\"" + cAlphaArgs( 2 ) + "\"" );
 						ShowContinueError( "... valid values are SupplyAirTemperature or TemperatureDifference." );
-						ErrorsFound = true;
+						GetZoneSizingInputErrorsFound = true;
 					}}
 					//  N1, \field Zone Cooling Design Supply Air Temperature
 					//      \type real
@@ -1472,7 +1510,7 @@ namespace SizingManager {
 					} else if ( rNumericArgs( 1 ) < 0.0 && ZoneSizingInput( ZoneSizIndex ).ZnCoolDgnSAMethod == SupplyAirTemperature ) {
 						ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 						ShowContinueError( "... incorrect " + cNumericFieldNames( 1 ) + "=[" + RoundSigDigits( rNumericArgs( 1 ), 2 ) + "],  value should not be negative." );
-						ErrorsFound = true;
+						GetZoneSizingInputErrorsFound = true;
 					} else if ( rNumericArgs( 1 ) >= 0.0 && ZoneSizingInput( ZoneSizIndex ).ZnCoolDgnSAMethod == SupplyAirTemperature ) {
 						ZoneSizingInput( ZoneSizIndex ).CoolDesTemp = rNumericArgs( 1 );
 					} else {
@@ -1507,7 +1545,7 @@ namespace SizingManager {
 						ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 						ShowContinueError( "... incorrect " + cAlphaFieldNames( 3 ) + "=\"" + cAlphaArgs( 3 ) + "\"" );
 						ShowContinueError( "... valid values are SupplyAirTemperature or TemperatureDifference." );
-						ErrorsFound = true;
+						GetZoneSizingInputErrorsFound = true;
 					}}
 					//  N3, \field Zone Heating Design Supply Air Temperature
 					//      \type real
@@ -1519,7 +1557,7 @@ namespace SizingManager {
 					} else if ( rNumericArgs( 3 ) < 0.0 && ZoneSizingInput( ZoneSizIndex ).ZnHeatDgnSAMethod == SupplyAirTemperature ) {
 						ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 						ShowContinueError( "... incorrect " + cNumericFieldNames( 3 ) + "=[" + RoundSigDigits( rNumericArgs( 3 ), 2 ) + "],  value should not be negative." );
-						ErrorsFound = true;
+						GetZoneSizingInputErrorsFound = true;
 					} else if ( rNumericArgs( 3 ) >= 0.0 && ZoneSizingInput( ZoneSizIndex ).ZnHeatDgnSAMethod == SupplyAirTemperature ) {
 						ZoneSizingInput( ZoneSizIndex ).HeatDesTemp = rNumericArgs( 3 );
 					} else {
@@ -1549,7 +1587,7 @@ namespace SizingManager {
 					} else if ( rNumericArgs( 5 ) < 0.0 ) {
 						ShowSevereError( cCurrentModuleObject + ": incorrect " + cNumericFieldNames( 5 ) + ": " + RoundSigDigits( rNumericArgs( 5 ), 2 ) );
 						ShowContinueError( ".. value should not be negative. Occurs in Sizing Object=" + cAlphaArgs( 1 ) );
-						ErrorsFound = true;
+						GetZoneSizingInputErrorsFound = true;
 					} else {
 						ZoneSizingInput( ZoneSizIndex ).CoolDesHumRat = rNumericArgs( 5 );
 					}
@@ -1563,7 +1601,7 @@ namespace SizingManager {
 					} else if ( rNumericArgs( 6 ) < 0.0 ) {
 						ShowSevereError( cCurrentModuleObject + ": incorrect " + cNumericFieldNames( 6 ) + ": " + RoundSigDigits( rNumericArgs( 6 ), 2 ) );
 						ShowContinueError( ".. value should not be negative. Occurs in Sizing Object=" + cAlphaArgs( 1 ) );
-						ErrorsFound = true;
+						GetZoneSizingInputErrorsFound = true;
 					} else {
 						ZoneSizingInput( ZoneSizIndex ).HeatDesHumRat = rNumericArgs( 6 );
 					}
@@ -1584,7 +1622,7 @@ namespace SizingManager {
 						} else {
 							ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 							ShowContinueError( "... incorrect " + cAlphaFieldNames( 4 ) + "=\"" + cAlphaArgs( 4 ) + "\"." );
-							ErrorsFound = true;
+							GetZoneSizingInputErrorsFound = true;
 						}
 					} else { // If no design spec object specified, i.e. no OA, then set OA method to None as default but flows to 0
 						ZoneSizingInput( ZoneSizIndex ).OADesMethod = 0;
@@ -1601,7 +1639,7 @@ namespace SizingManager {
 					} else if ( rNumericArgs( 7 ) < 0.0 ) {
 						ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 						ShowContinueError( "... incorrect " + cNumericFieldNames( 7 ) + "=[" + RoundSigDigits( rNumericArgs( 7 ), 2 ) + "],  value should not be negative." );
-						ErrorsFound = true;
+						GetZoneSizingInputErrorsFound = true;
 					} else {
 						ZoneSizingInput( ZoneSizIndex ).HeatSizingFactor = rNumericArgs( 7 );
 					}
@@ -1613,7 +1651,7 @@ namespace SizingManager {
 					} else if ( rNumericArgs( 8 ) < 0.0 ) {
 						ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 						ShowContinueError( "... incorrect " + cNumericFieldNames( 8 ) + "=[" + RoundSigDigits( rNumericArgs( 8 ), 2 ) + "],  value should not be negative." );
-						ErrorsFound = true;
+						GetZoneSizingInputErrorsFound = true;
 					} else {
 						ZoneSizingInput( ZoneSizIndex ).CoolSizingFactor = rNumericArgs( 8 );
 					}
@@ -1630,7 +1668,7 @@ namespace SizingManager {
 					} else if ( rNumericArgs( 9 ) < 0.0 ) {
 						ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 						ShowContinueError( "... incorrect " + cNumericFieldNames( 9 ) + "=[" + RoundSigDigits( rNumericArgs( 9 ), 2 ) + "],  value should not be negative." );
-						ErrorsFound = true;
+						GetZoneSizingInputErrorsFound = true;
 					} else {
 						ZoneSizingInput( ZoneSizIndex ).DesCoolAirFlow = rNumericArgs( 9 );
 					}
@@ -1650,7 +1688,7 @@ namespace SizingManager {
 					} else if ( rNumericArgs( 10 ) < 0.0 ) {
 						ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 						ShowContinueError( "... incorrect " + cNumericFieldNames( 108 ) + "=[" + RoundSigDigits( rNumericArgs( 10 ), 2 ) + "],  value should not be negative." );
-						ErrorsFound = true;
+						GetZoneSizingInputErrorsFound = true;
 					} else {
 						ZoneSizingInput( ZoneSizIndex ).DesCoolMinAirFlowPerArea = rNumericArgs( 10 );
 					}
@@ -1665,7 +1703,7 @@ namespace SizingManager {
 					} else if ( rNumericArgs( 11 ) < 0.0 ) {
 						ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 						ShowContinueError( "... incorrect " + cNumericFieldNames( 11 ) + "=[" + RoundSigDigits( rNumericArgs( 11 ), 2 ) + "],  value should not be negative." );
-						ErrorsFound = true;
+						GetZoneSizingInputErrorsFound = true;
 					} else {
 						ZoneSizingInput( ZoneSizIndex ).DesCoolMinAirFlow = rNumericArgs( 11 );
 					}
@@ -1684,7 +1722,7 @@ namespace SizingManager {
 					if ( rNumericArgs( 12 ) < 0.0 ) {
 						ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 						ShowContinueError( "... incorrect " + cNumericFieldNames( 12 ) + "=[" + RoundSigDigits( rNumericArgs( 12 ), 2 ) + "],  value should not be negative." );
-						ErrorsFound = true;
+						GetZoneSizingInputErrorsFound = true;
 					} else {
 						ZoneSizingInput( ZoneSizIndex ).DesCoolMinAirFlowFrac = rNumericArgs( 12 );
 					}
@@ -1702,7 +1740,7 @@ namespace SizingManager {
 					} else if ( rNumericArgs( 13 ) < 0.0 ) {
 						ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 						ShowContinueError( "... incorrect " + cNumericFieldNames( 13 ) + "=[" + RoundSigDigits( rNumericArgs( 13 ), 2 ) + "],  value should not be negative." );
-						ErrorsFound = true;
+						GetZoneSizingInputErrorsFound = true;
 					} else {
 						ZoneSizingInput( ZoneSizIndex ).DesHeatAirFlow = rNumericArgs( 13 );
 					}
@@ -1723,7 +1761,7 @@ namespace SizingManager {
 					} else if ( rNumericArgs( 14 ) < 0.0 ) {
 						ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 						ShowContinueError( "... incorrect " + cNumericFieldNames( 14 ) + "=[" + RoundSigDigits( rNumericArgs( 14 ), 2 ) + "],  value should not be negative." );
-						ErrorsFound = true;
+						GetZoneSizingInputErrorsFound = true;
 					} else {
 						ZoneSizingInput( ZoneSizIndex ).DesHeatMaxAirFlowPerArea = rNumericArgs( 14 );
 						DesHeatMaxAirFlowPerAreaUsrInp = true;
@@ -1745,7 +1783,7 @@ namespace SizingManager {
 					} else if ( rNumericArgs( 15 ) < 0.0 ) {
 						ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 						ShowContinueError( "... incorrect " + cNumericFieldNames( 15 ) + "=[" + RoundSigDigits( rNumericArgs( 15 ), 2 ) + "],  value should not be negative." );
-						ErrorsFound = true;
+						GetZoneSizingInputErrorsFound = true;
 					} else {
 						ZoneSizingInput( ZoneSizIndex ).DesHeatMaxAirFlow = rNumericArgs( 15 );
 						DesHeatMaxAirFlowUsrInp = true;
@@ -1766,7 +1804,7 @@ namespace SizingManager {
 					} else if ( rNumericArgs( 16 ) < 0.0 ) {
 						ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 						ShowContinueError( "... incorrect " + cNumericFieldNames( 16 ) + "=[" + RoundSigDigits( rNumericArgs( 16 ), 2 ) + "],  value should not be negative." );
-						ErrorsFound = true;
+						GetZoneSizingInputErrorsFound = true;
 					} else {
 						ZoneSizingInput( ZoneSizIndex ).DesHeatMaxAirFlowFrac = rNumericArgs( 16 );
 						DesHeatMaxAirFlowFracUsrInp = true;
@@ -1798,7 +1836,7 @@ namespace SizingManager {
 							// generate a warning message
 							ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 							ShowContinueError( "... not found " + cAlphaFieldNames( 7 ) + "=\"" + cAlphaArgs( 7 ) + "\"." );
-							ErrorsFound = true;
+							GetZoneSizingInputErrorsFound = true;
 						}
 					} else {
 						// assume defaults
@@ -1818,7 +1856,7 @@ namespace SizingManager {
 						ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 						ShowContinueError( "... incorrect " + cAlphaFieldNames( 5 ) + "=\"" + cAlphaArgs( 5 ) + "\"." );
 						ShowContinueError( "... valid values are DesignDay, Flow/Zone or DesignDayWithLimit." );
-						ErrorsFound = true;
+						GetZoneSizingInputErrorsFound = true;
 					}}
 					{ auto const heatAirDesMethod( cAlphaArgs( 6 ) );
 					if ( heatAirDesMethod == "DESIGNDAY" ) {
@@ -1831,7 +1869,7 @@ namespace SizingManager {
 						ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 						ShowContinueError( "... incorrect " + cAlphaFieldNames( 6 ) + "=\"" + cAlphaArgs( 6 ) + "\"." );
 						ShowContinueError( "... valid values are DesignDay, Flow/Zone or DesignDayWithLimit." );
-						ErrorsFound = true;
+						GetZoneSizingInputErrorsFound = true;
 					}}
 					if ( cAlphaArgs( 8 ) == "YES" ) {
 						ZoneSizingInput( ZoneSizIndex ).AccountForDOAS = true;
@@ -1854,7 +1892,7 @@ namespace SizingManager {
 								ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 								ShowContinueError( "... incorrect " + cAlphaFieldNames( 9 ) + "=\"" + cAlphaArgs( 9 ) + "\"." );
 								ShowContinueError( "... valid values are NeutralSupplyAir, NeutralDehumidifiedSupplyAir or ColdSupplyAir." );
-								ErrorsFound = true;
+								GetZoneSizingInputErrorsFound = true;
 							}
 						}
 						ZoneSizingInput( ZoneSizIndex ).DOASLowSetpoint = rNumericArgs( 17 );
@@ -1862,14 +1900,14 @@ namespace SizingManager {
 						if ( rNumericArgs( 17 ) > 0.0 && rNumericArgs( 18 ) > 0.0 && rNumericArgs( 17 ) >= rNumericArgs( 18 ) ) {
 							ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 							ShowContinueError( "... Dedicated Outside Air Low Setpoint for Design must be less than the High Setpoint" );
-							ErrorsFound = true;
+							GetZoneSizingInputErrorsFound = true;
 						}
 					}
 				}
 			}
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetZoneSizingInputErrorsFound ) {
 			ShowFatalError( cCurrentModuleObject + ": Errors found in getting input. Program terminates." );
 		}
 
@@ -2059,7 +2097,6 @@ namespace SizingManager {
 		int NumAlphas; // Number of Alphas for each GetObjectItem call
 		int NumNumbers; // Number of Numbers for each GetObjectItem call
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int NumDesDays; // Number of design days in input
@@ -2072,7 +2109,7 @@ namespace SizingManager {
 			NumDesDays = GetNumObjectsFound( "SizingPeriod:DesignDay" ) + GetNumObjectsFound( "SizingPeriod:WeatherFileDays" ) + GetNumObjectsFound( "SizingPeriod:WeatherFileConditionType" );
 			if ( NumDesDays == 0 && ( DoSystemSizing || DoPlantSizing ) ) {
 				ShowSevereError( "System Sizing calculations need SizingPeriod:* input. None found." );
-				ErrorsFound = true;
+				GetSystemSizingInputErrorsFound = true;
 			}
 			SysSizInput.allocate( NumSysSizInput );
 		}
@@ -2083,7 +2120,7 @@ namespace SizingManager {
 			IsBlank = false;
 			VerifyName( cAlphaArgs( iNameAlphaNum ), SysSizInput, &SystemSizingInputData::AirPriLoopName, SysSizIndex - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetSystemSizingInputErrorsFound = true;
 				if (IsBlank) cAlphaArgs( iNameAlphaNum ) = "xxxxx";
 			}
 
@@ -2101,7 +2138,7 @@ namespace SizingManager {
 				ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( iNameAlphaNum ) + "\", invalid data." );
 				ShowContinueError( "... incorrect " + cAlphaFieldNames( iLoadTypeSizeAlphaNum ) + "=\"" + cAlphaArgs( iLoadTypeSizeAlphaNum ) + "\".");
 				ShowContinueError( "... valid values are Sensible, Total, or VentilationRequirement." );
-				ErrorsFound = true;
+				GetSystemSizingInputErrorsFound = true;
 			}}
 			// assign CoolingPeakLoadType based on LoadSizeType for now
 			if ( SysSizInput( SysSizIndex ).LoadSizeType == Sensible ) {
@@ -2126,7 +2163,7 @@ namespace SizingManager {
 				ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( iNameAlphaNum ) + "\", invalid data." );
 				ShowContinueError( "... incorrect " + cAlphaFieldNames( iCoolCapControlAlphaNum ) + "=\"" + cAlphaArgs( iCoolCapControlAlphaNum ) + "\"." );
 				ShowContinueError( "... valid values are VAV, Bypass, VT, or OnOff." );
-				ErrorsFound = true;
+				GetSystemSizingInputErrorsFound = true;
 			}}
  			{ auto const sizingOption( cAlphaArgs( iSizingOptionAlphaNum ) );
 			if ( sizingOption == "COINCIDENT" ) {
@@ -2137,7 +2174,7 @@ namespace SizingManager {
 				ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( iNameAlphaNum ) + "\", invalid data." );
 				ShowContinueError( "... incorrect " + cAlphaFieldNames( iSizingOptionAlphaNum ) + "=\"" + cAlphaArgs( iSizingOptionAlphaNum ) + "\".");
 				ShowContinueError( "... valid values are Coincident or NonCoincident." );
-				ErrorsFound = true;
+				GetSystemSizingInputErrorsFound = true;
 			}}
 			{ auto const coolOAOption( cAlphaArgs( i100PercentOACoolingAlphaNum ) );
 			if ( coolOAOption == "YES" ) {
@@ -2148,7 +2185,7 @@ namespace SizingManager {
 				ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( iNameAlphaNum ) + "\", invalid data." );
 				ShowContinueError("... incorrect " + cAlphaFieldNames( i100PercentOACoolingAlphaNum ) + "=\"" + cAlphaArgs( i100PercentOACoolingAlphaNum ) + "\".");
 				ShowContinueError( "... valid values are Yes or No." );
-				ErrorsFound = true;
+				GetSystemSizingInputErrorsFound = true;
 			}}
 			{ auto const heatOAOption( cAlphaArgs( i100PercentOAHeatingAlphaNum ) );
 			if ( heatOAOption == "YES" ) {
@@ -2159,7 +2196,7 @@ namespace SizingManager {
 				ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( iNameAlphaNum ) + "\", invalid data." );
 				ShowContinueError( "... incorrect " + cAlphaFieldNames( i100PercentOAHeatingAlphaNum ) + "=\"" + cAlphaArgs( i100PercentOAHeatingAlphaNum ) + "\".");
 				ShowContinueError( "... valid values are Yes or No." );
-				ErrorsFound = true;
+				GetSystemSizingInputErrorsFound = true;
 			}}
 
 			//  N1, \field Design Outdoor Air Flow Rate
@@ -2172,7 +2209,7 @@ namespace SizingManager {
 			} else if ( rNumericArgs( iDesignOAVolFlowNumericNum ) < 0.0 && rNumericArgs( iDesignOAVolFlowNumericNum ) != AutoSize) {
 				ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( iNameAlphaNum ) + "\", invalid data." );
 				ShowContinueError("... incorrect " + cNumericFieldNames( iDesignOAVolFlowNumericNum ) + "=[" + RoundSigDigits( rNumericArgs( iDesignOAVolFlowNumericNum ), 2) + "],  value should not be negative.");
-				ErrorsFound = true;
+				GetSystemSizingInputErrorsFound = true;
 			} else {
 				SysSizInput(SysSizIndex).DesOutAirVolFlow = rNumericArgs( iDesignOAVolFlowNumericNum );
 			}
@@ -2191,7 +2228,7 @@ namespace SizingManager {
 			} else if (rNumericArgs( iMinSysAirFlowRatioNumericNum ) < 0.0) {
 				ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( iMinSysAirFlowRatioNumericNum ) + "\", invalid data.");
 				ShowContinueError( "... incorrect " + cNumericFieldNames( iMinSysAirFlowRatioNumericNum ) + "=[" + RoundSigDigits( rNumericArgs( iMinSysAirFlowRatioNumericNum ), 2) + "],  value should not be negative.");
-				ErrorsFound = true;
+				GetSystemSizingInputErrorsFound = true;
 			} else {
 				SysSizInput( SysSizIndex ).SysAirMinFlowRat = rNumericArgs( iMinSysAirFlowRatioNumericNum );
 			}
@@ -2231,7 +2268,7 @@ namespace SizingManager {
 			} else if ( rNumericArgs( iMaxCoolAirVolFlowNumericNum ) < 0.0 ) {
 				ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( iNameAlphaNum ) + "\", invalid data." );
 				ShowContinueError( "... incorrect " + cNumericFieldNames( iMaxCoolAirVolFlowNumericNum ) + "=[" + RoundSigDigits( rNumericArgs( iMaxCoolAirVolFlowNumericNum ), 2 ) + "],  value should not be negative." );
-				ErrorsFound = true;
+				GetSystemSizingInputErrorsFound = true;
 			} else {
 				SysSizInput( SysSizIndex ).DesCoolAirFlow = rNumericArgs( iMaxCoolAirVolFlowNumericNum );
 			}
@@ -2255,7 +2292,7 @@ namespace SizingManager {
 			} else if ( rNumericArgs( iMaxHeatAirVolFlowNumericNum ) < 0.0 ) {
 				ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( iNameAlphaNum ) + "\", invalid data." );
 				ShowContinueError( "... incorrect " + cNumericFieldNames( iMaxHeatAirVolFlowNumericNum ) + "=[" + RoundSigDigits( rNumericArgs( iMaxHeatAirVolFlowNumericNum ), 2 ) + "],  value should not be negative." );
-				ErrorsFound = true;
+				GetSystemSizingInputErrorsFound = true;
 			} else {
 				SysSizInput( SysSizIndex ).DesHeatAirFlow = rNumericArgs( iMaxHeatAirVolFlowNumericNum );
 			}
@@ -2273,7 +2310,7 @@ namespace SizingManager {
 			} else if ( rNumericArgs( iZoneMaxOAFractionNumericNum ) < 0.0 ) {
 				ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( iNameAlphaNum ) + "\", invalid data." );
 				ShowContinueError( "... incorrect " + cNumericFieldNames( iZoneMaxOAFractionNumericNum ) + "=[" + RoundSigDigits( rNumericArgs( iZoneMaxOAFractionNumericNum ), 2 ) + "],  value should not be negative.");
-				ErrorsFound = true;
+				GetSystemSizingInputErrorsFound = true;
 			} else {
 				SysSizInput(SysSizIndex).MaxZoneOAFraction = rNumericArgs( iZoneMaxOAFractionNumericNum );
 			}
@@ -2298,7 +2335,7 @@ namespace SizingManager {
 				ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( iNameAlphaNum ) + "\", invalid data." );
 				ShowContinueError( "... incorrect " + cAlphaFieldNames( iCoolSAFMAlphaNum ) + "=\"" + cAlphaArgs( iCoolSAFMAlphaNum ) + "\"." );
 				ShowContinueError( "... valid values are DesignDay, Flow/System, FlowPerFloorArea, FractionOfAutosizedCoolingAirflow, or FlowPerCoolingCapacity." );
-				ErrorsFound = true;
+				GetSystemSizingInputErrorsFound = true;
 			}}
 			{ auto const heatAirDesMethod( cAlphaArgs( iHeatSAFMAlphaNum ) );
 			if ( heatAirDesMethod == "DESIGNDAY" ) {
@@ -2325,7 +2362,7 @@ namespace SizingManager {
 				ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( iNameAlphaNum ) + "\", invalid data." );
 				ShowContinueError("... incorrect " + cAlphaFieldNames( iHeatSAFMAlphaNum ) + "=\"" + cAlphaArgs( iHeatSAFMAlphaNum ) + "\"." );
 				ShowContinueError( "... valid values are DesignDay, Flow/System, FlowPerFloorArea, FractionOfAutosizedHeatingAirflow, or FlowPerHeatingCapacity." );
-				ErrorsFound = true;
+				GetSystemSizingInputErrorsFound = true;
 			}}
 			{ auto const systemOAMethod(cAlphaArgs( iSystemOASMethodAlphaNum ));
 			if ( systemOAMethod == "ZONESUM" ) {
@@ -2347,7 +2384,7 @@ namespace SizingManager {
 				ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( iNameAlphaNum ) + "\", invalid data." );
 				ShowContinueError( "... incorrect " + cAlphaFieldNames( iSystemOASMethodAlphaNum ) + "=\"" + cAlphaArgs( iSystemOASMethodAlphaNum ) + "\".");
 				ShowContinueError( "... valid values are ZoneSum or VentilationRateProcedure." );
-				ErrorsFound = true;
+				GetSystemSizingInputErrorsFound = true;
 			}}
 
 			// Determine SysSizInput electric Cooling design capacity sizing method
@@ -2357,7 +2394,7 @@ namespace SizingManager {
 				if ( SysSizInput( SysSizIndex ).ScaledCoolingCapacity < 0.0 && SysSizInput( SysSizIndex ).ScaledCoolingCapacity != AutoSize ) {
 					ShowSevereError( cCurrentModuleObject + " = " + SysSizInput( SysSizIndex ).AirPriLoopName );
 					ShowContinueError( "Illegal " + cNumericFieldNames( iCoolDesignCapacityNumericNum ) + " = " + TrimSigDigits( rNumericArgs( iCoolDesignCapacityNumericNum ), 7 ) );
-					ErrorsFound = true;
+					GetSystemSizingInputErrorsFound = true;
 				}
 			} else if ( SameString( cAlphaArgs( iCoolCAPMAlphaNum ), "CAPACITYPERFLOORAREA" ) ) {
 				SysSizInput( SysSizIndex ).CoolingCapMethod = CapacityPerFloorArea;
@@ -2367,18 +2404,18 @@ namespace SizingManager {
 						ShowSevereError( cCurrentModuleObject + " = " + SysSizInput( SysSizIndex ).AirPriLoopName );
 						ShowContinueError( "Input for " + cAlphaFieldNames( iCoolCAPMAlphaNum ) + " = " + cAlphaArgs( iCoolCAPMAlphaNum ) );
 						ShowContinueError( "Illegal " + cNumericFieldNames( iCoolCapacityPerFloorAreaNumericNum ) + " = " + TrimSigDigits( rNumericArgs( iCoolCapacityPerFloorAreaNumericNum ), 7 ) );
-						ErrorsFound = true;
+						GetSystemSizingInputErrorsFound = true;
 					} else if ( SysSizInput( SysSizIndex ).ScaledCoolingCapacity == AutoSize ) {
 						ShowSevereError( cCurrentModuleObject + " = " + SysSizInput( SysSizIndex ).AirPriLoopName );
 						ShowContinueError( "Input for " + cAlphaFieldNames( iCoolCAPMAlphaNum ) + " = " + cAlphaArgs( iCoolCAPMAlphaNum ) );
 						ShowContinueError( "Illegal " + cNumericFieldNames( iCoolCapacityPerFloorAreaNumericNum ) + " = Autosize" );
-						ErrorsFound = true;
+						GetSystemSizingInputErrorsFound = true;
 					}
 				} else {
 					ShowSevereError( cCurrentModuleObject + " = " + SysSizInput( SysSizIndex ).AirPriLoopName );
 					ShowContinueError( "Input for " + cAlphaFieldNames( iCoolCAPMAlphaNum ) + " = " + cAlphaArgs( iCoolCAPMAlphaNum ) );
 					ShowContinueError( "Blank field not allowed for " + cNumericFieldNames( iCoolCapacityPerFloorAreaNumericNum ) );
-					ErrorsFound = true;
+					GetSystemSizingInputErrorsFound = true;
 				}
 			} else if ( SameString( cAlphaArgs( iCoolCAPMAlphaNum ), "FRACTIONOFAUTOSIZEDCOOLINGCAPACITY" ) ) {
 				SysSizInput( SysSizIndex ).CoolingCapMethod = FractionOfAutosizedCoolingCapacity;
@@ -2387,13 +2424,13 @@ namespace SizingManager {
 					if ( SysSizInput( SysSizIndex ).ScaledCoolingCapacity < 0.0 ) {
 						ShowSevereError( cCurrentModuleObject + " = " + SysSizInput( SysSizIndex ).AirPriLoopName );
 						ShowContinueError( "Illegal " + cNumericFieldNames( iCoolFracOfAutosizedCapacityNumericNum ) + " = " + TrimSigDigits( rNumericArgs( iCoolFracOfAutosizedCapacityNumericNum ), 7 ) );
-						ErrorsFound = true;
+						GetSystemSizingInputErrorsFound = true;
 					}
 				} else {
 					ShowSevereError( cCurrentModuleObject + " = " + SysSizInput( SysSizIndex ).AirPriLoopName );
 					ShowContinueError( "Input for " + cAlphaFieldNames( iCoolCAPMAlphaNum ) + " = " + cAlphaArgs( iCoolCAPMAlphaNum ) );
 					ShowContinueError( "Blank field not allowed for " + cNumericFieldNames( iCoolFracOfAutosizedCapacityNumericNum ) );
-					ErrorsFound = true;
+					GetSystemSizingInputErrorsFound = true;
 				}
 			} else if ( SameString( cAlphaArgs( iCoolCAPMAlphaNum ), "NONE" ) ) {
 				SysSizInput( SysSizIndex ).CoolingCapMethod = None;
@@ -2402,7 +2439,7 @@ namespace SizingManager {
 				ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( iNameAlphaNum ) + "\", invalid data." );
 				ShowContinueError( "... incorrect " + cAlphaFieldNames( iCoolCAPMAlphaNum ) + "=\"" + cAlphaArgs( iCoolCAPMAlphaNum ) + "\"." );
 				ShowContinueError( "... valid values are CoolingDesignCapacity, CapacityPerFloorArea, FractionOfAutosizedCoolingCapacity, or None." );
-				ErrorsFound = true;
+				GetSystemSizingInputErrorsFound = true;
 			}
 
 			// Determine SysSizInput electric heating design capacity sizing method
@@ -2413,7 +2450,7 @@ namespace SizingManager {
 				if ( SysSizInput( SysSizIndex ).ScaledHeatingCapacity < 0.0 && SysSizInput( SysSizIndex ).ScaledHeatingCapacity != AutoSize ) {
 					ShowSevereError( cCurrentModuleObject + " = " + SysSizInput( SysSizIndex ).AirPriLoopName );
 					ShowContinueError( "Illegal " + cNumericFieldNames( iHeatDesignCapacityNumericNum ) + " = " + TrimSigDigits( rNumericArgs( iHeatDesignCapacityNumericNum ), 7 ) );
-					ErrorsFound = true;
+					GetSystemSizingInputErrorsFound = true;
 				}
 			} else if ( SameString( cAlphaArgs( iHeatCAPMAlphaNum ), "CAPACITYPERFLOORAREA" ) ) {
 				SysSizInput( SysSizIndex ).HeatingCapMethod = CapacityPerFloorArea;
@@ -2423,18 +2460,18 @@ namespace SizingManager {
 						ShowSevereError( cCurrentModuleObject + " = " + SysSizInput( SysSizIndex ).AirPriLoopName );
 						ShowContinueError( "Input for " + cAlphaFieldNames( iHeatCAPMAlphaNum ) + " = " + cAlphaArgs( iHeatCAPMAlphaNum ) );
 						ShowContinueError( "Illegal " + cNumericFieldNames( iHeatCapacityPerFloorAreaNumericNum ) + " = " + TrimSigDigits( rNumericArgs( iHeatCapacityPerFloorAreaNumericNum ), 7 ) );
-						ErrorsFound = true;
+						GetSystemSizingInputErrorsFound = true;
 					} else if ( SysSizInput( SysSizIndex ).ScaledHeatingCapacity == AutoSize ) {
 						ShowSevereError( cCurrentModuleObject + " = " + SysSizInput( SysSizIndex ).AirPriLoopName );
 						ShowContinueError( "Input for " + cAlphaFieldNames( iHeatCAPMAlphaNum ) + " = " + cAlphaArgs( iHeatCAPMAlphaNum ) );
 						ShowContinueError( "Illegal " + cNumericFieldNames( iHeatCapacityPerFloorAreaNumericNum ) + " = Autosize" );
-						ErrorsFound = true;
+						GetSystemSizingInputErrorsFound = true;
 					}
 				} else {
 					ShowSevereError( cCurrentModuleObject + " = " + SysSizInput( SysSizIndex ).AirPriLoopName );
 					ShowContinueError( "Input for " + cAlphaFieldNames( iHeatCAPMAlphaNum ) + " = " + cAlphaArgs( iHeatCAPMAlphaNum ) );
 					ShowContinueError( "Blank field not allowed for " + cNumericFieldNames( iHeatCapacityPerFloorAreaNumericNum ) );
-					ErrorsFound = true;
+					GetSystemSizingInputErrorsFound = true;
 				}
 			} else if ( SameString( cAlphaArgs( iHeatCAPMAlphaNum ), "FRACTIONOFAUTOSIZEDHEATINGCAPACITY" ) ) {
 				SysSizInput( SysSizIndex ).HeatingCapMethod = FractionOfAutosizedHeatingCapacity;
@@ -2443,13 +2480,13 @@ namespace SizingManager {
 					if ( SysSizInput( SysSizIndex ).ScaledHeatingCapacity < 0.0 ) {
 						ShowSevereError( cCurrentModuleObject + " = " + SysSizInput( SysSizIndex ).AirPriLoopName );
 						ShowContinueError( "Illegal " + cNumericFieldNames( iHeatFracOfAutosizedCapacityNumericNum ) + " = " + TrimSigDigits( rNumericArgs( iHeatFracOfAutosizedCapacityNumericNum ), 7 ) );
-						ErrorsFound = true;
+						GetSystemSizingInputErrorsFound = true;
 					}
 				} else {
 					ShowSevereError( cCurrentModuleObject + " = " + SysSizInput( SysSizIndex ).AirPriLoopName );
 					ShowContinueError( "Input for " + cAlphaFieldNames( iHeatCAPMAlphaNum ) + " = " + cAlphaArgs( iHeatCAPMAlphaNum ) );
 					ShowContinueError( "Blank field not allowed for " + cNumericFieldNames( iHeatFracOfAutosizedCapacityNumericNum ) );
-					ErrorsFound = true;
+					GetSystemSizingInputErrorsFound = true;
 				}
 			} else if ( SameString( cAlphaArgs( iHeatCAPMAlphaNum ), "NONE" ) ) {
 				SysSizInput( SysSizIndex ).HeatingCapMethod = None;
@@ -2458,12 +2495,12 @@ namespace SizingManager {
 				ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( iNameAlphaNum ) + "\", invalid data." );
 				ShowContinueError( "... incorrect " + cAlphaFieldNames( iHeatCAPMAlphaNum ) + "=\"" + cAlphaArgs( iHeatCAPMAlphaNum ) + "\"." );
 				ShowContinueError( "... valid values are HeatingDesignCapacity, CapacityPerFloorArea, FractionOfAutosizedHeatingCapacity, or None." );
-				ErrorsFound = true;
+				GetSystemSizingInputErrorsFound = true;
 			}
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetSystemSizingInputErrorsFound ) {
 			ShowFatalError( cCurrentModuleObject + ": Errors found in getting input. Program terminates." );
 		}
 
@@ -2514,7 +2551,6 @@ namespace SizingManager {
 		int NumAlphas; // Number of Alphas for each GetObjectItem call
 		int NumNumbers; // Number of Numbers for each GetObjectItem call
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int NumDesDays; // Number of design days in input
@@ -2526,7 +2562,7 @@ namespace SizingManager {
 			NumDesDays = GetNumObjectsFound( "SizingPeriod:DesignDay" ) + GetNumObjectsFound( "SizingPeriod:WeatherFileDays" ) + GetNumObjectsFound( "SizingPeriod:WeatherFileConditionType" );
 			if ( NumDesDays == 0 && DoPlantSizing ) {
 				ShowSevereError( "Plant Sizing calculations need SizingPeriod:* input" );
-				ErrorsFound = true;
+				GetPlantSizingInputErrorsFound = true;
 			}
 			PlantSizData.allocate( NumPltSizInput );
 			for ( auto & e : PlantSizData ) {
@@ -2548,7 +2584,7 @@ namespace SizingManager {
 			IsBlank = false;
 			VerifyName( cAlphaArgs( 1 ), PlantSizData, &PlantSizingData::PlantLoopName, PltSizIndex - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetPlantSizingInputErrorsFound = true;
 				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 			}
 			PlantSizData( PltSizIndex ).PlantLoopName = cAlphaArgs( 1 );
@@ -2574,7 +2610,7 @@ namespace SizingManager {
 				ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 				ShowContinueError( "...incorrect " + cAlphaFieldNames( 2 ) + "=\"" + cAlphaArgs( 2 ) + "\"." );
 				ShowContinueError( "...Valid values are \"Heating\", \"Cooling\", \"Condenser\" or \"Steam\"." );
-				ErrorsFound = true;
+				GetPlantSizingInputErrorsFound = true;
 			}}
 
 			if ( NumAlphas > 2 ) {
@@ -2587,7 +2623,7 @@ namespace SizingManager {
 					ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid data." );
 					ShowContinueError( "...incorrect " + cAlphaFieldNames( 3 ) + "=\"" + cAlphaArgs( 3 ) + "\"." );
 					ShowContinueError( "...Valid values are \"NonCoincident\" or \"Coincident\"." );
-					ErrorsFound = true;
+					GetPlantSizingInputErrorsFound = true;
 
 				}}
 			}
@@ -2609,7 +2645,7 @@ namespace SizingManager {
 			SetupEMSInternalVariable( "Plant Design Volume Flow Rate", PlantSizData( PltSizIndex ).PlantLoopName, "[m3/s]", PlantSizData( PltSizIndex ).DesVolFlowRate );
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetPlantSizingInputErrorsFound ) {
 			ShowFatalError( cCurrentModuleObject + ": Errors found in getting input. Program terminates." );
 		}
 
@@ -2655,18 +2691,17 @@ namespace SizingManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool Available( false ); // an environment is available to process
 
 		//  return  ! remove comment to do "old way"
 
-		Available = true;
+		SetupZoneSizingAvailable = true;
 
 		CurOverallSimDay = 0;
-		while ( Available ) { // do for each environment
+		while ( SetupZoneSizingAvailable ) { // do for each environment
 
-			GetNextEnvironment( Available, ErrorsFound );
+			GetNextEnvironment( SetupZoneSizingAvailable, ErrorsFound );
 
-			if ( ! Available ) break;
+			if ( ! SetupZoneSizingAvailable ) break;
 			if ( ErrorsFound ) break;
 
 			// check that environment is one of the design days
@@ -2777,7 +2812,6 @@ namespace SizingManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true );
 
 		// Formats
 		static gio::Fmt Format_990( "('! <Zone Sizing Information>, Zone Name, Load Type, Calc Des Load {W}, User Des Load {W}, ','Calc Des Air Flow Rate {m3/s}, ','User Des Air Flow Rate {m3/s}, Design Day Name, Date/Time of Peak, Temperature at Peak {C}, ','Humidity Ratio at Peak {kgWater/kgDryAir}, Floor Area {m2}, # Occupants, Calc Outdoor Air Flow Rate {m3/s}, Calc DOAS Heat Addition Rate {W}')" );
@@ -2839,15 +2873,14 @@ namespace SizingManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true );
 
 		// Formats
 		static gio::Fmt Format_990( "('! <System Sizing Information>, System Name, ','Field Description, Value')" );
 		static gio::Fmt Format_991( "(' System Sizing Information',3(', ',A))" );
 
-		if ( MyOneTimeFlag ) {
+		if ( ReportSysSizingMyOneTimeFlag ) {
 			gio::write( OutputFileInits, Format_990 );
-			MyOneTimeFlag = false;
+			ReportSysSizingMyOneTimeFlag = false;
 		}
 
 		gio::write( OutputFileInits, Format_991 ) << SysName << VarDesc << RoundSigDigits( VarValue, 5 );
@@ -2969,7 +3002,6 @@ namespace SizingManager {
 		int TotalArgs; // Total number of alpha and numeric arguments (max) for a
 		int IOStatus; // Used in GetObjectItem
 		int zSIndex;  // index of "DesignSpecification:ZoneHVAC:Sizing" objects
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		//  REAL(r64) :: CalcAmt
@@ -3010,7 +3042,7 @@ namespace SizingManager {
 
 				VerifyName( Alphas( 1 ), ZoneHVACSizing, zSIndex - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetZoneHVACSizingErrorsFound = true;
 					if ( IsBlank ) Alphas( 1 ) = "xxxxx";
 				}
 
@@ -3026,13 +3058,13 @@ namespace SizingManager {
 						if ( ZoneHVACSizing( zSIndex ).MaxCoolAirVolFlow <= 0.0 && ZoneHVACSizing( zSIndex ).MaxCoolAirVolFlow != AutoSize ) {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Illegal " + cNumericFields( iMaxCoolAirVolFlowNumericNum ) + " = " + TrimSigDigits( Numbers( iMaxCoolAirVolFlowNumericNum ), 7 ) );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 						}
 					} else {
 						ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 						ShowContinueError( "Input for " + cAlphaFields( iCoolSAFMAlphaNum ) + " = " + Alphas( iCoolSAFMAlphaNum ) );
 						ShowContinueError( "Blank field not allowed for " + cNumericFields( iMaxCoolAirVolFlowNumericNum ) );
-						ErrorsFound = true;
+						GetZoneHVACSizingErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( iCoolSAFMAlphaNum ), "FlowPerFloorArea" ) ) {
 					ZoneHVACSizing( zSIndex ).CoolingSAFMethod = FlowPerFloorArea;
@@ -3042,13 +3074,13 @@ namespace SizingManager {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iCoolSAFMAlphaNum ) + " = " + Alphas( iCoolSAFMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iCoolFlowPerFloorAreaNumericNum ) + " = " + TrimSigDigits( Numbers( iCoolFlowPerFloorAreaNumericNum ), 7 ) );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 							// Autosized input is not allowed
 						} else if ( ZoneHVACSizing( zSIndex ).MaxCoolAirVolFlow == AutoSize ) {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iCoolSAFMAlphaNum ) + " = " + Alphas( iCoolSAFMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iCoolFlowPerFloorAreaNumericNum ) + " = Autosize" );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 						} else {
 							// user input cooling supply air flow per unit conditioned area is saved in ZoneHVACSizing(zSIndex).MaxCoolAirVolFlow
 							ZoneHVACSizing( zSIndex ).RequestAutoSize = true;
@@ -3057,7 +3089,7 @@ namespace SizingManager {
 						ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 						ShowContinueError( "Input for " + cAlphaFields( iCoolSAFMAlphaNum ) + " = " + Alphas( iCoolSAFMAlphaNum ) );
 						ShowContinueError( "Blank field not allowed for " + cNumericFields( iCoolFlowPerFloorAreaNumericNum ) );
-						ErrorsFound = true;
+						GetZoneHVACSizingErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( iCoolSAFMAlphaNum ), "FractionOfAutosizedCoolingAirflow" ) ) {
 					ZoneHVACSizing( zSIndex ).CoolingSAFMethod = FractionOfAutosizedCoolingAirflow;
@@ -3067,13 +3099,13 @@ namespace SizingManager {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iCoolSAFMAlphaNum ) + " = " + Alphas( iCoolSAFMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iCoolFlowPerFracCoolNumericNum ) + " = " + TrimSigDigits( Numbers( iCoolFlowPerFracCoolNumericNum ), 7 ) );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 							// Autosized input is not allowed
 						} else if ( ZoneHVACSizing( zSIndex ).MaxCoolAirVolFlow == AutoSize ) {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iCoolSAFMAlphaNum ) + " = " + Alphas( iCoolSAFMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iCoolFlowPerFracCoolNumericNum ) + " = Autosize" );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 						} else {
 							// user input fraction of cooling supply air flow rate is saved in ZoneHVACSizing(zSIndex).MaxCoolAirVolFlow
 							ZoneHVACSizing( zSIndex ).RequestAutoSize = true;
@@ -3082,7 +3114,7 @@ namespace SizingManager {
 						ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 						ShowContinueError( "Input for " + cAlphaFields( iCoolSAFMAlphaNum ) + " = " + Alphas( iCoolSAFMAlphaNum ) );
 						ShowContinueError( "Blank field not allowed for " + cNumericFields( iCoolFlowPerFracCoolNumericNum ) );
-						ErrorsFound = true;
+						GetZoneHVACSizingErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( iCoolSAFMAlphaNum ), "FlowPerCoolingCapacity" ) ) {
 
@@ -3093,13 +3125,13 @@ namespace SizingManager {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iCoolSAFMAlphaNum ) + " = " + Alphas( iCoolSAFMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iCoolFlowPerCoolCapNumericNum ) + " = " + TrimSigDigits( Numbers( iCoolFlowPerCoolCapNumericNum ), 7 ) );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 							// Autosized input is not allowed
 						} else if ( ZoneHVACSizing( zSIndex ).MaxCoolAirVolFlow == AutoSize ) {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iCoolSAFMAlphaNum ) + " = " + Alphas( iCoolSAFMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iCoolFlowPerCoolCapNumericNum ) + " = Autosize" );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 						} else {
 							// user input cooling supply air flow per unit cooling capacity is saved in ZoneHVACSizing(zSIndex).MaxCoolAirVolFlow
 							ZoneHVACSizing( zSIndex ).RequestAutoSize = true;
@@ -3108,7 +3140,7 @@ namespace SizingManager {
 						ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 						ShowContinueError( "Input for " + cAlphaFields( iCoolSAFMAlphaNum ) + " = " + Alphas( iCoolSAFMAlphaNum ) );
 						ShowContinueError( "Blank field not allowed for " + cNumericFields( iCoolFlowPerCoolCapNumericNum ) );
-						ErrorsFound = true;
+						GetZoneHVACSizingErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( iCoolSAFMAlphaNum ), "None" ) || lAlphaBlanks( iCoolSAFMAlphaNum ) ) {
 					ZoneHVACSizing( zSIndex ).CoolingSAFMethod = None;
@@ -3117,7 +3149,7 @@ namespace SizingManager {
 				} else {
 					ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 					ShowContinueError( "Illegal " + cAlphaFields( iCoolSAFMAlphaNum ) + " = " + Alphas( iCoolSAFMAlphaNum ) );
-					ErrorsFound = true;
+					GetZoneHVACSizingErrorsFound = true;
 				}
 				// Determine supply air flow rate sizing method for heating mode
 				if ( SameString( Alphas( iHeatSAFMAlphaNum ), "SupplyAirFlowRate" ) ) {
@@ -3129,13 +3161,13 @@ namespace SizingManager {
 						if ( ZoneHVACSizing( zSIndex ).MaxHeatAirVolFlow <= 0.0 && ZoneHVACSizing( zSIndex ).MaxHeatAirVolFlow != AutoSize ) {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Illegal " + cNumericFields( iMaxHeatAirVolFlowNumericNum ) + " = " + TrimSigDigits( Numbers( iMaxHeatAirVolFlowNumericNum ), 7 ) );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 						}
 					} else {
 						ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 						ShowContinueError( "Input for " + cAlphaFields( iHeatSAFMAlphaNum ) + " = " + Alphas( iHeatSAFMAlphaNum ) );
 						ShowContinueError( "Blank field not allowed for " + cNumericFields( iMaxHeatAirVolFlowNumericNum ) );
-						ErrorsFound = true;
+						GetZoneHVACSizingErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( iHeatSAFMAlphaNum ), "FlowPerFloorArea" ) ) {
 					ZoneHVACSizing( zSIndex ).HeatingSAFMethod = FlowPerFloorArea;
@@ -3145,13 +3177,13 @@ namespace SizingManager {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iHeatSAFMAlphaNum ) + " = " + Alphas( iHeatSAFMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iHeatFlowPerFloorAreaNumericNum ) + " = " + TrimSigDigits( Numbers( iHeatFlowPerFloorAreaNumericNum ), 7 ) );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 							// Autosized input is not allowed
 						} else if ( ZoneHVACSizing( zSIndex ).MaxHeatAirVolFlow == AutoSize ) {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iHeatSAFMAlphaNum ) + " = " + Alphas( iHeatSAFMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iHeatFlowPerFloorAreaNumericNum ) + " = Autosize" );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 						} else {
 							// user input heating supply air flow per unit conditioned area is saved in ZoneHVACSizing(zSIndex).MaxHeatAirVolFlow
 							ZoneHVACSizing( zSIndex ).RequestAutoSize = true;
@@ -3160,7 +3192,7 @@ namespace SizingManager {
 						ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 						ShowContinueError( "Input for " + cAlphaFields( iHeatSAFMAlphaNum ) + " = " + Alphas( iHeatSAFMAlphaNum ) );
 						ShowContinueError( "Blank field not allowed for " + cNumericFields( iHeatFlowPerFloorAreaNumericNum ) );
-						ErrorsFound = true;
+						GetZoneHVACSizingErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( iHeatSAFMAlphaNum ), "FractionOfAutosizedHeatingAirflow" ) ) {
 					ZoneHVACSizing( zSIndex ).HeatingSAFMethod = FractionOfAutosizedHeatingAirflow;
@@ -3170,13 +3202,13 @@ namespace SizingManager {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iHeatSAFMAlphaNum ) + " = " + Alphas( iHeatSAFMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iHeatFlowPerFracCoolNumericNum ) + " = " + TrimSigDigits( Numbers( iHeatFlowPerFracCoolNumericNum ), 7 ) );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 							// Autosized input is not allowed
 						} else if ( ZoneHVACSizing( zSIndex ).MaxHeatAirVolFlow == AutoSize ) {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iHeatSAFMAlphaNum ) + " = " + Alphas( iHeatSAFMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iHeatFlowPerFracCoolNumericNum ) + " = Autosize" );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 						} else {
 							// user input fraction of heating supply air flow rate is saved in ZoneHVACSizing(zSIndex).MaxHeatAirVolFlow
 							ZoneHVACSizing( zSIndex ).RequestAutoSize = true;
@@ -3185,7 +3217,7 @@ namespace SizingManager {
 						ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 						ShowContinueError( "Input for " + cAlphaFields( iHeatSAFMAlphaNum ) + " = " + Alphas( iHeatSAFMAlphaNum ) );
 						ShowContinueError( "Blank field not allowed for " + cNumericFields( iHeatFlowPerFracCoolNumericNum ) );
-						ErrorsFound = true;
+						GetZoneHVACSizingErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( iHeatSAFMAlphaNum ), "FlowPerHeatingCapacity" ) ) {
 					ZoneHVACSizing( zSIndex ).HeatingSAFMethod = FlowPerHeatingCapacity;
@@ -3195,13 +3227,13 @@ namespace SizingManager {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iHeatSAFMAlphaNum ) + " = " + Alphas( iHeatSAFMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iHeatFlowPerHeatCapNumericNum ) + " = " + TrimSigDigits( Numbers( iHeatFlowPerHeatCapNumericNum ), 7 ) );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 							// Autosized input is not allowed
 						} else if ( ZoneHVACSizing( zSIndex ).MaxHeatAirVolFlow == AutoSize ) {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iHeatSAFMAlphaNum ) + " = " + Alphas( iHeatSAFMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iHeatFlowPerHeatCapNumericNum ) + " = Autosize" );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 						} else {
 							// user input heating supply air flow per unit heating capacity is saved in ZoneHVACSizing(zSIndex).MaxHeatAirVolFlow
 							ZoneHVACSizing( zSIndex ).RequestAutoSize = true;
@@ -3210,7 +3242,7 @@ namespace SizingManager {
 						ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 						ShowContinueError( "Input for " + cAlphaFields( iHeatSAFMAlphaNum ) + " = " + Alphas( iHeatSAFMAlphaNum ) );
 						ShowContinueError( "Blank field not allowed for " + cNumericFields( iHeatFlowPerHeatCapNumericNum ) );
-						ErrorsFound = true;
+						GetZoneHVACSizingErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( iHeatSAFMAlphaNum ), "None" ) || lAlphaBlanks( iHeatSAFMAlphaNum ) ) {
 					ZoneHVACSizing( zSIndex ).HeatingSAFMethod = None;
@@ -3218,7 +3250,7 @@ namespace SizingManager {
 				} else {
 					ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 					ShowContinueError( "Illegal " + cAlphaFields( iHeatSAFMAlphaNum ) + " = " + Alphas( iHeatSAFMAlphaNum ) );
-					ErrorsFound = true;
+					GetZoneHVACSizingErrorsFound = true;
 				}
 
 				// Determine supply air flow rate sizing method when cooling or heating is not needed
@@ -3230,13 +3262,13 @@ namespace SizingManager {
 						if ( ZoneHVACSizing( zSIndex ).MaxNoCoolHeatAirVolFlow < 0.0 && ZoneHVACSizing( zSIndex ).MaxNoCoolHeatAirVolFlow != AutoSize ) {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Illegal " + cNumericFields( iMaxNoCoolHeatAirVolFlowNumericNum ) + " = " + TrimSigDigits( Numbers( iMaxNoCoolHeatAirVolFlowNumericNum ), 7 ) );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 						}
 					} else {
 						ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 						ShowContinueError( "Input for " + cAlphaFields( iNoCoolHeatSAFMAlphaNum ) + " = " + Alphas( iNoCoolHeatSAFMAlphaNum ) );
 						ShowContinueError( "Blank field not allowed for " + cNumericFields( iMaxNoCoolHeatAirVolFlowNumericNum ) );
-						ErrorsFound = true;
+						GetZoneHVACSizingErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( iNoCoolHeatSAFMAlphaNum ), "FlowPerFloorArea" ) ) {
 					ZoneHVACSizing( zSIndex ).NoCoolHeatSAFMethod = FlowPerFloorArea;
@@ -3246,13 +3278,13 @@ namespace SizingManager {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iNoCoolHeatSAFMAlphaNum ) + " = " + Alphas( iNoCoolHeatSAFMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iNoCoolHeatFlowPerFloorAreaNumericNum ) + " = " + TrimSigDigits( Numbers( iNoCoolHeatFlowPerFloorAreaNumericNum ), 7 ) );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 							// Autosized input is not allowed
 						} else if ( ZoneHVACSizing( zSIndex ).MaxNoCoolHeatAirVolFlow == AutoSize ) {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iNoCoolHeatSAFMAlphaNum ) + " = " + Alphas( iNoCoolHeatSAFMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iNoCoolHeatFlowPerFloorAreaNumericNum ) + " = Autosize" );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 						} else {
 							// user input supply air flow per unit floor area during no cooling or heating area is saved in ZoneHVACSizing(zSIndex).MaxNoCoolHeatAirVolFlow
 							ZoneHVACSizing( zSIndex ).RequestAutoSize = true;
@@ -3261,7 +3293,7 @@ namespace SizingManager {
 						ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 						ShowContinueError( "Input for " + cAlphaFields( iNoCoolHeatSAFMAlphaNum ) + " = " + Alphas( iNoCoolHeatSAFMAlphaNum ) );
 						ShowContinueError( "Blank field not allowed for " + cNumericFields( iNoCoolHeatFlowPerFloorAreaNumericNum ) );
-						ErrorsFound = true;
+						GetZoneHVACSizingErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( iNoCoolHeatSAFMAlphaNum ), "FractionOfAutosizedCoolingAirflow" ) ) {
 					ZoneHVACSizing( zSIndex ).NoCoolHeatSAFMethod = FractionOfAutosizedCoolingAirflow;
@@ -3271,13 +3303,13 @@ namespace SizingManager {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iNoCoolHeatSAFMAlphaNum ) + " = " + Alphas( iNoCoolHeatSAFMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iNoCoolHeatFlowPerFracCoolNumericNum ) + " = " + TrimSigDigits( Numbers( iNoCoolHeatFlowPerFracCoolNumericNum ), 7 ) );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 							// Autosized input is not allowed
 						} else if ( ZoneHVACSizing( zSIndex ).MaxNoCoolHeatAirVolFlow == AutoSize ) {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iNoCoolHeatSAFMAlphaNum ) + " = " + Alphas( iNoCoolHeatSAFMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iNoCoolHeatFlowPerFracCoolNumericNum ) + " = Autosize" );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 						} else {
 							// user input frcation of cooling supply air flow rate during no cooling or heating area is saved in ZoneHVACSizing(zSIndex).MaxNoCoolHeatAirVolFlow
 							ZoneHVACSizing( zSIndex ).RequestAutoSize = true;
@@ -3286,7 +3318,7 @@ namespace SizingManager {
 						ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 						ShowContinueError( "Input for " + cAlphaFields( iNoCoolHeatSAFMAlphaNum ) + " = " + Alphas( iNoCoolHeatSAFMAlphaNum ) );
 						ShowContinueError( "Blank field not allowed for " + cNumericFields( iNoCoolHeatFlowPerFracCoolNumericNum ) );
-						ErrorsFound = true;
+						GetZoneHVACSizingErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( iNoCoolHeatSAFMAlphaNum ), "FractionOfAutosizedHeatingAirflow" ) ) {
 					ZoneHVACSizing( zSIndex ).NoCoolHeatSAFMethod = FractionOfAutosizedHeatingAirflow;
@@ -3296,13 +3328,13 @@ namespace SizingManager {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iNoCoolHeatSAFMAlphaNum ) + " = " + Alphas( iNoCoolHeatSAFMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iNoCoolHeatFlowPerFracHeatNumericNum ) + " = " + TrimSigDigits( Numbers( iNoCoolHeatFlowPerFracHeatNumericNum ), 7 ) );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 							// Autosized input is not allowed
 						} else if ( ZoneHVACSizing( zSIndex ).MaxNoCoolHeatAirVolFlow == AutoSize ) {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iNoCoolHeatSAFMAlphaNum ) + " = " + Alphas( iNoCoolHeatSAFMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iNoCoolHeatFlowPerFracHeatNumericNum ) + " = Autosize" );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 						} else {
 							// user input frcation of heating supply air flow rate during no cooling or heating area is saved in ZoneHVACSizing(zSIndex).MaxNoCoolHeatAirVolFlow
 							ZoneHVACSizing( zSIndex ).RequestAutoSize = true;
@@ -3311,7 +3343,7 @@ namespace SizingManager {
 						ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 						ShowContinueError( "Input for " + cAlphaFields( iNoCoolHeatSAFMAlphaNum ) + " = " + Alphas( iNoCoolHeatSAFMAlphaNum ) );
 						ShowContinueError( "Blank field not allowed for " + cNumericFields( iNoCoolHeatFlowPerFracHeatNumericNum ) );
-						ErrorsFound = true;
+						GetZoneHVACSizingErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( iNoCoolHeatSAFMAlphaNum ), "None" ) || lAlphaBlanks( iNoCoolHeatSAFMAlphaNum ) ) {
 					ZoneHVACSizing( zSIndex ).NoCoolHeatSAFMethod = None;
@@ -3319,7 +3351,7 @@ namespace SizingManager {
 				} else {
 					ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 					ShowContinueError( "Illegal " + cAlphaFields( iNoCoolHeatSAFMAlphaNum ) + " = " + Alphas( iNoCoolHeatSAFMAlphaNum ) );
-					ErrorsFound = true;
+					GetZoneHVACSizingErrorsFound = true;
 				}
 
 				// Determine cooling design capacity of zoneHVAC equipment
@@ -3331,13 +3363,13 @@ namespace SizingManager {
 						if ( ZoneHVACSizing( zSIndex ).ScaledCoolingCapacity < 0.0 && ZoneHVACSizing( zSIndex ).ScaledCoolingCapacity != AutoSize ) {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Illegal " + cNumericFields( iCoolDesignCapacityNumericNum ) + " = " + TrimSigDigits( Numbers( iCoolDesignCapacityNumericNum ), 7 ) );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 						}
 					} else {
 						ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 						ShowContinueError( "Input for " + cAlphaFields( iCoolCAPMAlphaNum ) + " = " + Alphas( iCoolCAPMAlphaNum ) );
 						ShowContinueError( "Blank field not allowed for " + cNumericFields( iCoolDesignCapacityNumericNum ) );
-						ErrorsFound = true;
+						GetZoneHVACSizingErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( iCoolCAPMAlphaNum ), "CapacityPerFloorArea" ) ) {
 					ZoneHVACSizing( zSIndex ).CoolingCapMethod = CapacityPerFloorArea;
@@ -3347,19 +3379,19 @@ namespace SizingManager {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iCoolCAPMAlphaNum ) + " = " + Alphas( iCoolCAPMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iCoolCapacityPerFloorAreaNumericNum ) + " = " + TrimSigDigits( Numbers( iCoolCapacityPerFloorAreaNumericNum ), 7 ) );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 							// Autosized input is not allowed
 						} else if ( ZoneHVACSizing( zSIndex ).ScaledCoolingCapacity == AutoSize ) {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iCoolCAPMAlphaNum ) + " = " + Alphas( iCoolCAPMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iCoolCapacityPerFloorAreaNumericNum ) + " = Autosize" );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 						}
 					} else {
 						ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 						ShowContinueError( "Input for " + cAlphaFields( iCoolCAPMAlphaNum ) + " = " + Alphas( iCoolCAPMAlphaNum ) );
 						ShowContinueError( "Blank field not allowed for " + cNumericFields( iCoolCapacityPerFloorAreaNumericNum ) );
-						ErrorsFound = true;
+						GetZoneHVACSizingErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( iCoolCAPMAlphaNum ), "FractionOfAutosizedCoolingCapacity" ) ) {
 					ZoneHVACSizing( zSIndex ).CoolingCapMethod = FractionOfAutosizedCoolingCapacity;
@@ -3369,20 +3401,20 @@ namespace SizingManager {
 						if ( ZoneHVACSizing( zSIndex ).ScaledCoolingCapacity < 0.0 && ZoneHVACSizing( zSIndex ).ScaledCoolingCapacity != AutoSize ) {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Illegal " + cNumericFields( iCoolFracOfAutosizedCapacityNumericNum ) + " = " + TrimSigDigits( Numbers( iCoolFracOfAutosizedCapacityNumericNum ), 7 ) );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 						}
 					} else {
 						ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 						ShowContinueError( "Input for " + cAlphaFields( iCoolCAPMAlphaNum ) + " = " + Alphas( iCoolCAPMAlphaNum ) );
 						ShowContinueError( "Blank field not allowed for " + cNumericFields( iCoolFracOfAutosizedCapacityNumericNum ) );
-						ErrorsFound = true;
+						GetZoneHVACSizingErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( iCoolCAPMAlphaNum ), "None" ) || lAlphaBlanks( iCoolCAPMAlphaNum ) ) {
 					ZoneHVACSizing( zSIndex ).CoolingCapMethod = None;
 				} else {
 					ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 					ShowContinueError( "Illegal " + cAlphaFields( iCoolCAPMAlphaNum ) + " = " + Alphas( iCoolCAPMAlphaNum ) );
-					ErrorsFound = true;
+					GetZoneHVACSizingErrorsFound = true;
 				}
 
 				// Determine heating design capacity of zone HVAC equipment
@@ -3394,13 +3426,13 @@ namespace SizingManager {
 						if ( ZoneHVACSizing( zSIndex ).ScaledHeatingCapacity < 0.0 && ZoneHVACSizing( zSIndex ).ScaledHeatingCapacity != AutoSize ) {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Illegal " + cNumericFields( iHeatDesignCapacityNumericNum ) + " = " + TrimSigDigits( Numbers( iHeatDesignCapacityNumericNum ), 7 ) );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 						}
 					} else {
 						ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 						ShowContinueError( "Input for " + cAlphaFields( iHeatCAPMAlphaNum ) + " = " + Alphas( iHeatCAPMAlphaNum ) );
 						ShowContinueError( "Blank field not allowed for " + cNumericFields( iHeatDesignCapacityNumericNum ) );
-						ErrorsFound = true;
+						GetZoneHVACSizingErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( iHeatCAPMAlphaNum ), "CapacityPerFloorArea" ) ) {
 					ZoneHVACSizing( zSIndex ).HeatingCapMethod = CapacityPerFloorArea;
@@ -3410,19 +3442,19 @@ namespace SizingManager {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iHeatCAPMAlphaNum ) + " = " + Alphas( iHeatCAPMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iHeatCapacityPerFloorAreaNumericNum ) + " = " + TrimSigDigits( Numbers( iHeatCapacityPerFloorAreaNumericNum ), 7 ) );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 							// Autosized input is not allowed
 						} else if ( ZoneHVACSizing( zSIndex ).ScaledHeatingCapacity == AutoSize ) {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Input for " + cAlphaFields( iHeatCAPMAlphaNum ) + " = " + Alphas( iHeatCAPMAlphaNum ) );
 							ShowContinueError( "Illegal " + cNumericFields( iHeatCapacityPerFloorAreaNumericNum ) + " = Autosize" );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 						}
 					} else {
 						ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 						ShowContinueError( "Input for " + cAlphaFields( iHeatCAPMAlphaNum ) + " = " + Alphas( iHeatCAPMAlphaNum ) );
 						ShowContinueError( "Blank field not allowed for " + cNumericFields( iHeatCapacityPerFloorAreaNumericNum ) );
-						ErrorsFound = true;
+						GetZoneHVACSizingErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( iHeatCAPMAlphaNum ), "FractionOfAutosizedHeatingCapacity" ) ) {
 					ZoneHVACSizing( zSIndex ).HeatingCapMethod = FractionOfAutosizedHeatingCapacity;
@@ -3432,20 +3464,20 @@ namespace SizingManager {
 						if ( ZoneHVACSizing( zSIndex ).ScaledHeatingCapacity < 0.0 && ZoneHVACSizing( zSIndex ).ScaledCoolingCapacity != AutoSize ) {
 							ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 							ShowContinueError( "Illegal " + cNumericFields( iHeatFracOfAutosizedCapacityNumericNum ) + " = " + TrimSigDigits( Numbers( iHeatFracOfAutosizedCapacityNumericNum ), 7 ) );
-							ErrorsFound = true;
+							GetZoneHVACSizingErrorsFound = true;
 						}
 					} else {
 						ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 						ShowContinueError( "Input for " + cAlphaFields( iHeatCAPMAlphaNum ) + " = " + Alphas( iHeatCAPMAlphaNum ) );
 						ShowContinueError( "Blank field not allowed for " + cNumericFields( iHeatFracOfAutosizedCapacityNumericNum ) );
-						ErrorsFound = true;
+						GetZoneHVACSizingErrorsFound = true;
 					}
 				} else if ( SameString( Alphas( iHeatCAPMAlphaNum ), "None" ) || lAlphaBlanks( iHeatCAPMAlphaNum ) ) {
 					ZoneHVACSizing( zSIndex ).HeatingCapMethod = None;
 				} else {
 					ShowSevereError( CurrentModuleObject + " = " + ZoneHVACSizing( zSIndex ).Name );
 					ShowContinueError( "Illegal " + cAlphaFields( iHeatCAPMAlphaNum ) + " = " + Alphas( iHeatCAPMAlphaNum ) );
-					ErrorsFound = true;
+					GetZoneHVACSizingErrorsFound = true;
 				}
 
 			}
@@ -3458,7 +3490,7 @@ namespace SizingManager {
 		lAlphaBlanks.deallocate();
 		lNumericBlanks.deallocate();
 
-		if ( ErrorsFound ) {
+		if ( GetZoneHVACSizingErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in input.  Preceding condition(s) cause termination." );
 		}
 
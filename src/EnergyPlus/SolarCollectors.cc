@@ -154,8 +154,50 @@ namespace SolarCollectors {
 
 	// MODULE SUBROUTINES:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true );
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		int NumOfICSParam( 0 ); // number of parameter objects for ICS colectors
+		int NumOfICSUnits( 0 ); // number of ICS colector units
+		int NumOfFlatPlateParam( 0 ); // number of parameter objects for flat plate colectors
+		int NumFlatPlateUnits( 0 ); // number of plat plate solar colector units
+		bool MyOneTimeFlag( true ); // one time flag
+		Array1D_bool SetLoopIndexFlag; // get loop number flag
+		Array1D_bool SetDiffRadFlag; // get diffuse radiation flag
+	}
+
 	// Functions
 
+	// Clears the global data in SolarCollectors.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		CheckEquipName.deallocate();
+		NumOfParameters = 0;
+		NumOfCollectors = 0;
+		TransSysSkyDiff.deallocate();
+		TransSysGrnDiff.deallocate();
+		RefSysSkyDiff.deallocate();
+		RefSysGrnDiff.deallocate();
+		Parameters.deallocate();
+		Collector.deallocate();
+		GetInputFlag = true;
+		ErrorsFound = false;
+		NumOfICSParam = 0;
+		NumOfICSUnits = 0;
+		NumOfFlatPlateParam = 0;
+		NumFlatPlateUnits = 0;
+		MyOneTimeFlag = true;
+		SetLoopIndexFlag.deallocate();
+		SetDiffRadFlag.deallocate();
+	}
+
 	void
 	SimSolarCollector(
 		int const EP_UNUSED( EquipTypeNum ),
@@ -189,7 +231,6 @@ namespace SolarCollectors {
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInputFlag( true );
 		int CollectorNum;
 
 		// FLOW:
@@ -277,7 +318,6 @@ namespace SolarCollectors {
 
 		// Locals
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		int IOStatus; // Used in GetObjectItem
 		bool IsBlank; // TRUE if the name is blank
 		bool IsNotOK; // TRUE if there was a problem with a list name
@@ -293,10 +333,6 @@ namespace SolarCollectors {
 		int NumFields; // Total number of fields in object
 		int MaxAlphas; // Maximum number of alpha fields in all objects
 		int MaxNumbers; // Maximum number of numeric fields in all objects
-		static int NumOfICSParam( 0 ); // number of parameter objects for ICS colectors
-		static int NumOfICSUnits( 0 ); // number of ICS colector units
-		static int NumOfFlatPlateParam( 0 ); // number of parameter objects for flat plate colectors
-		static int NumFlatPlateUnits( 0 ); // number of plat plate solar colector units
 
 		int FlatPlateParamNum; // plat plate solar colector parameters counter
 		int ICSParamNum; // ICS collector parameters counter
@@ -808,13 +844,10 @@ namespace SolarCollectors {
 
 		Real64 const BigNumber( 9999.9 ); // Component desired mass flow rate
 
-		static bool MyOneTimeFlag( true ); // one time flag
-		static Array1D_bool SetLoopIndexFlag; // get loop number flag
 		Real64 rho;
 		//LOGICAL     :: errFlag
 		//  REAL(r64)                                :: Density                ! density of fluid
 		bool errFlag; // local error flag
-		static Array1D_bool SetDiffRadFlag; // get diffuse radiation flag
 
 		int SurfNum; // Surface object number for collector
 		int ParamNum; // Collector parameters object number
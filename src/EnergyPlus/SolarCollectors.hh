@@ -324,6 +324,11 @@ namespace SolarCollectors {
 
 	// Functions
 
+	// Clears the global data in SolarCollectors.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimSolarCollector(
 		int const EquipTypeNum,
@@ -124,8 +124,137 @@ namespace SolarReflectionManager {
 
 	// MODULE SUBROUTINES:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int IHr( 0 ); // Hour number
+		Vector3< Real64 > SunVec( 0.0 ); // Unit vector to sun
+		int RecSurfNum( 0 ); // Receiving surface number
+		int SurfNum( 0 ); // Heat transfer surface number corresponding to RecSurfNum
+		int RecPtNum( 0 ); // Receiving point number
+		int NumRecPts( 0 ); // Number of receiving points on a receiving surface
+		int HitPtSurfNum( 0 ); // Surface number of hit point: -1 = ground,
+		int RayNum( 0 ); // Ray number
+		Vector3< Real64 > OriginThisRay( 0.0 ); // Origin point of a ray (m)
+		Vector3< Real64 > ObsHitPt( 0.0 ); // Hit point on obstruction (m)
+		int ObsSurfNum( 0 ); // Obstruction surface number
+		Real64 CosIncBmAtHitPt( 0.0 ); // Cosine of incidence angle of beam solar at hit point
+		Real64 CosIncBmAtHitPt2( 0.0 ); // Cosine of incidence angle of beam solar at hit point,
+		Real64 BmReflSolRadiance( 0.0 ); // Solar radiance at hit point due to incident beam, divided
+		Real64 dReflBeamToDiffSol( 0.0 ); // Contribution to reflection factor at a receiving point
+		Real64 SunLitFract( 0.0 ); // Sunlit fraction
+		int CalcBeamSolSpecularReflFactorsIHr( 0 ); // Hour number
+		Vector3< Real64 > FigureBeamSolSpecularReflFactorsSunVec( 0.0 ); // Unit vector to sun
+		Vector3< Real64 > SunVecMir( 0.0 ); // Unit vector to sun mirrored by a reflecting surface
+		Vector3< Real64 > RecPt( 0.0 ); // Receiving point (m)
+		Vector3< Real64 > HitPtRefl( 0.0 ); // Hit point on a reflecting surface (m)
+		Vector3< Real64 > HitPtObs( 0.0 ); // Hit point on obstruction (m)
+		Vector3< Real64 > ReflNorm( 0.0 ); // Unit normal to reflecting surface
+		Real64 SpecReflectance( 0.0 ); // Specular reflectance of a reflecting surface
+		int ConstrNumRefl( 0 ); // Construction number of a reflecting surface
+		Real64 CosIncAngRefl( 0.0 ); // Cosine of incidence angle of beam on reflecting surface
+		Real64 CosIncAngRec( 0.0 ); // Angle of incidence of reflected beam on receiving surface
+		Real64 ReflFac( 0.0 ); // Contribution to specular reflection factor
+		Real64 CosIncWeighted( 0.0 ); // Cosine of incidence angle on receiving surf weighted by reflection factor
+		int CalcSkySolDiffuseReflFactorsRecSurfNum( 0 ); // Receiving surface number
+		int CalcSkySolDiffuseReflFactorsSurfNum( 0 ); // Heat transfer surface number corresponding to RecSurfNum
+		int CalcSkySolDiffuseReflFactorsObsSurfNum( 0 ); // Obstruction surface number
+		int CalcSkySolDiffuseReflFactorsRecPtNum( 0 ); // Receiving point number
+		int CalcSkySolDiffuseReflFactorsNumRecPts( 0 ); // Number of receiving points on a receiving surface
+		int CalcSkySolDiffuseReflFactorsHitPtSurfNum( 0 ); // Surface number of hit point: -1 = ground,
+		int HitPtSurfNumX( 0 ); // For a shading surface, HitPtSurfNum for original surface,
+		int CalcSkySolDiffuseReflFactorsRayNum( 0 ); // Ray number
+		Vector3< Real64 > CalcSkySolDiffuseReflFactorsHitPtRefl( 0.0 ); // Coordinates of hit point on obstruction or ground (m)
+		Vector3< Real64 > CalcSkySolDiffuseReflFactorsHitPtObs( 0.0 ); // Hit point on an obstruction (m)
+		Real64 dOmega( 0.0 ); // Solid angle increment (steradians)
+		Real64 CosIncAngRayToSky( 0.0 ); // Cosine of incidence angle on ground of ray to sky
+		Real64 SkyReflSolRadiance( 0.0 ); // Reflected radiance at hit point divided by unobstructed
+		Real64 dReflSkySol( 0.0 ); // Contribution to reflection factor at a receiving point
+		Real64 Phi( 0.0 ); // Altitude angle and increment (radians)
+		Real64 DPhi( 0.0 ); // Altitude angle and increment (radians)
+		Real64 SPhi( 0.0 ); // Sine of Phi
+		Real64 CPhi( 0.0 ); // Cosine of Phi
+		Real64 Theta( 0.0 ); // Azimuth angle (radians)
+		Real64 DTheta( 0.0 ); // Azimuth increment (radians)
+		int IPhi( 0 ); // Altitude angle index
+		int ITheta( 0 ); // Azimuth angle index
+		Vector3< Real64 > URay( 0.0 ); // Unit vector along ray from ground hit point
+		Vector3< Real64 > SurfVertToGndPt( 0.0 ); // Vector from a vertex of possible obstructing surface to ground
+		Vector3< Real64 > SurfVert( 0.0 ); // Surface vertex (m)
+		Real64 dReflSkyGnd( 0.0 ); // Factor for ground radiance due to direct sky diffuse reflection
+	}
+
 	// Functions
 
+	// Clears the global data in SolarReflectionManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		TotSolReflRecSurf = 0;
+		TotPhiReflRays = 0;
+		TotThetaReflRays = 0;
+		SolReflRecSurf.deallocate();
+		IHr = 0;
+		SunVec = Vector3< Real64 >( 0.0 );
+		RecSurfNum = 0;
+		SurfNum = 0;
+		RecPtNum = 0;
+		NumRecPts = 0;
+		HitPtSurfNum = 0;
+		RayNum = 0;
+		OriginThisRay = Vector3< Real64 >( 0.0 );
+		ObsHitPt = Vector3< Real64 >( 0.0 );
+		ObsSurfNum = 0;
+		CosIncBmAtHitPt = 0.0;
+		CosIncBmAtHitPt2 = 0.0;
+		BmReflSolRadiance = 0.0;
+		dReflBeamToDiffSol = 0.0;
+		SunLitFract = 0.0;
+		CalcBeamSolSpecularReflFactorsIHr = 0;
+		FigureBeamSolSpecularReflFactorsSunVec = Vector3< Real64 >( 0.0 );
+		SunVecMir = Vector3< Real64 >( 0.0 );
+		RecPt = Vector3< Real64 >( 0.0 );
+		HitPtRefl = Vector3< Real64 >( 0.0 );
+		HitPtObs = Vector3< Real64 >( 0.0 );
+		ReflNorm = Vector3< Real64 >( 0.0 );
+		SpecReflectance = 0.0;
+		ConstrNumRefl = 0;
+		CosIncAngRefl = 0.0;
+		CosIncAngRec = 0.0;
+		ReflFac = 0.0;
+		CosIncWeighted = 0.0;
+		CalcSkySolDiffuseReflFactorsRecSurfNum = 0;
+		CalcSkySolDiffuseReflFactorsSurfNum = 0;
+		CalcSkySolDiffuseReflFactorsObsSurfNum = 0;
+		CalcSkySolDiffuseReflFactorsRecPtNum = 0;
+		CalcSkySolDiffuseReflFactorsNumRecPts = 0;
+		CalcSkySolDiffuseReflFactorsHitPtSurfNum = 0;
+		HitPtSurfNumX = 0;
+		CalcSkySolDiffuseReflFactorsRayNum = 0;
+		CalcSkySolDiffuseReflFactorsHitPtRefl = Vector3< Real64 >( 0.0 );
+		CalcSkySolDiffuseReflFactorsHitPtObs = Vector3< Real64 >( 0.0 );
+		dOmega = 0.0;
+		CosIncAngRayToSky = 0.0;
+		SkyReflSolRadiance = 0.0;
+		dReflSkySol = 0.0;
+		Phi = 0.0;
+		DPhi = 0.0;
+		SPhi = 0.0;
+		CPhi = 0.0;
+		Theta = 0.0;
+		DTheta = 0.0;
+		IPhi = 0;
+		ITheta = 0;
+		URay = Vector3< Real64 >( 0.0 );
+		SurfVertToGndPt = Vector3< Real64 >( 0.0 );
+		SurfVert = Vector3< Real64 >( 0.0 );
+		dReflSkyGnd = 0.0;
+	}
+
 	void
 	InitSolReflRecSurf()
 	{
@@ -612,7 +741,6 @@ namespace SolarReflectionManager {
 		// DERIVED TYPE DEFINITIONS: na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int IHr( 0 ); // Hour number
 
 		// FLOW:
 
@@ -671,12 +799,6 @@ namespace SolarReflectionManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Vector3< Real64 > SunVec( 0.0 ); // Unit vector to sun
-		static int RecSurfNum( 0 ); // Receiving surface number
-		static int SurfNum( 0 ); // Heat transfer surface number corresponding to RecSurfNum
-		static int RecPtNum( 0 ); // Receiving point number
-		static int NumRecPts( 0 ); // Number of receiving points on a receiving surface
-		static int HitPtSurfNum( 0 ); // Surface number of hit point: -1 = ground,
 		// 0 = sky or obstruction with receiving point below ground level,
 		// >0 = obstruction with receiving point above ground level
 		Array1D< Real64 > ReflBmToDiffSolObs( MaxRecPts ); // Irradiance at a receiving point for
@@ -685,19 +807,10 @@ namespace SolarReflectionManager {
 		Array1D< Real64 > ReflBmToDiffSolGnd( MaxRecPts ); // Irradiance at a receiving point for
 		// beam solar diffusely reflected from the ground, divided by
 		// beam normal irradiance
-		static int RayNum( 0 ); // Ray number
 		bool hit; // True iff obstruction is hit
-		static Vector3< Real64 > OriginThisRay( 0.0 ); // Origin point of a ray (m)
-		static Vector3< Real64 > ObsHitPt( 0.0 ); // Hit point on obstruction (m)
-		static int ObsSurfNum( 0 ); // Obstruction surface number
-		static Real64 CosIncBmAtHitPt( 0.0 ); // Cosine of incidence angle of beam solar at hit point
-		static Real64 CosIncBmAtHitPt2( 0.0 ); // Cosine of incidence angle of beam solar at hit point,
 		//  the mirrored shading surface
-		static Real64 BmReflSolRadiance( 0.0 ); // Solar radiance at hit point due to incident beam, divided
 		//  by beam normal irradiance
-		static Real64 dReflBeamToDiffSol( 0.0 ); // Contribution to reflection factor at a receiving point
 		//  from beam solar reflected from a hit point
-		static Real64 SunLitFract( 0.0 ); // Sunlit fraction
 
 		ReflBmToDiffSolObs = 0.0;
 		ReflBmToDiffSolGnd = 0.0;
@@ -894,7 +1007,6 @@ namespace SolarReflectionManager {
 		// DERIVED TYPE DEFINITIONS: na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int IHr( 0 ); // Hour number
 
 		// FLOW:
 		if ( ! DetailedSolarTimestepIntegration ) {
@@ -905,8 +1017,8 @@ namespace SolarReflectionManager {
 			}
 			ReflFacBmToBmSolObs = 0.0;
 			CosIncAveBmToBmSolObs = 0.0;
-			for ( IHr = 1; IHr <= 24; ++IHr ) {
-				FigureBeamSolSpecularReflFactors( IHr );
+			for ( CalcBeamSolSpecularReflFactorsIHr = 1; CalcBeamSolSpecularReflFactorsIHr <= 24; ++CalcBeamSolSpecularReflFactorsIHr ) {
+				FigureBeamSolSpecularReflFactors( CalcBeamSolSpecularReflFactorsIHr );
 			} // End of IHr loop
 		} else { // timestep integrated solar, use current hour of day
 			ReflFacBmToBmSolObs( HourOfDay, {1,TotSurfaces} ) = 0.0;
@@ -957,31 +1069,19 @@ namespace SolarReflectionManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Vector3< Real64 > SunVec( 0.0 ); // Unit vector to sun
-		static Vector3< Real64 > SunVecMir( 0.0 ); // Unit vector to sun mirrored by a reflecting surface
-		static Vector3< Real64 > RecPt( 0.0 ); // Receiving point (m)
-		static Vector3< Real64 > HitPtRefl( 0.0 ); // Hit point on a reflecting surface (m)
 		Array1D< Real64 > ReflBmToDiffSolObs( MaxRecPts ); // Irradiance at a receiving point for
 		// beam solar diffusely reflected from obstructions, divided by
 		// beam normal irradiance
 		//unused  INTEGER           :: RayNum               =0   ! Ray number
 		bool hitRefl; // True iff reflecting surface is hit
 		bool hitObs; // True iff obstruction is hit
-		static Vector3< Real64 > HitPtObs( 0.0 ); // Hit point on obstruction (m)
 		bool hitObsRefl; // True iff obstruction hit between rec. pt. and reflection point
-		static Vector3< Real64 > ReflNorm( 0.0 ); // Unit normal to reflecting surface
 		Array1D< Real64 > ReflBmToBmSolObs( MaxRecPts ); // Irradiance at a receiving point for
 		// beam solar specularly reflected from obstructions, divided by
 		// beam normal irradiance
 		Real64 ReflDistanceSq; // Distance squared from receiving point to hit point on a reflecting surface (m)
 		Real64 ReflDistance; // Distance from receiving point to hit point on a reflecting surface (m)
-		static Real64 SpecReflectance( 0.0 ); // Specular reflectance of a reflecting surface
-		static int ConstrNumRefl( 0 ); // Construction number of a reflecting surface
-		static Real64 CosIncAngRefl( 0.0 ); // Cosine of incidence angle of beam on reflecting surface
-		static Real64 CosIncAngRec( 0.0 ); // Angle of incidence of reflected beam on receiving surface
-		static Real64 ReflFac( 0.0 ); // Contribution to specular reflection factor
 		Array1D< Real64 > ReflFacTimesCosIncSum( MaxRecPts ); // Sum of ReflFac times CosIncAngRefl
-		static Real64 CosIncWeighted( 0.0 ); // Cosine of incidence angle on receiving surf weighted by reflection factor
 
 		ReflBmToDiffSolObs = 0.0;
 		ReflFacTimesCosIncSum = 0.0;
@@ -989,7 +1089,7 @@ namespace SolarReflectionManager {
 		if ( SUNCOSHR( iHour, 3 ) < SunIsUpValue ) return; // Skip if sun is below horizon
 
 		// Unit vector to sun
-		SunVec = SUNCOSHR( iHour, {1,3} );
+		FigureBeamSolSpecularReflFactorsSunVec = SUNCOSHR( iHour, {1,3} );
 
 		for ( int RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum ) {
 			int const SurfNum = SolReflRecSurf( RecSurfNum ).SurfNum; // Heat transfer surface number corresponding to RecSurfNum
@@ -1006,11 +1106,11 @@ namespace SolarReflectionManager {
 						if ( Surface( ReflSurfNum ).Class == SurfaceClass_Window && SunlitFrac( 1, iHour, ReflSurfNum ) < 0.01 ) continue;
 						// Check if sun is in front of this reflecting surface.
 						ReflNorm = Surface( ReflSurfNum ).OutNormVec;
-						CosIncAngRefl = dot( SunVec, ReflNorm );
+						CosIncAngRefl = dot( FigureBeamSolSpecularReflFactorsSunVec, ReflNorm );
 						if ( CosIncAngRefl < 0.0 ) continue;
 
 						// Get sun position unit vector for mirror image of sun in reflecting surface
-						SunVecMir = SunVec - 2.0 * dot( SunVec, ReflNorm ) * ReflNorm;
+						SunVecMir = FigureBeamSolSpecularReflFactorsSunVec - 2.0 * dot( FigureBeamSolSpecularReflFactorsSunVec, ReflNorm ) * ReflNorm;
 						// Angle of incidence of reflected beam on receiving surface
 						CosIncAngRec = dot( SolReflRecSurf( RecSurfNum ).NormVec, SunVecMir );
 						if ( CosIncAngRec <= 0.0 ) continue;
@@ -1045,7 +1145,7 @@ namespace SolarReflectionManager {
 										// Loop over possible obstructions for this window
 										for ( int loop2 = 1, loop2_end = SolReflRecSurf( ReflSurfRecNum ).NumPossibleObs; loop2 <= loop2_end; ++loop2 ) {
 											int const ObsSurfNum = SolReflRecSurf( ReflSurfRecNum ).PossibleObsSurfNums( loop2 );
-											PierceSurface( ObsSurfNum, HitPtRefl, SunVec, HitPtObs, hitObs );
+											PierceSurface( ObsSurfNum, HitPtRefl, FigureBeamSolSpecularReflFactorsSunVec, HitPtObs, hitObs );
 											if ( hitObs ) break;
 										}
 									}
@@ -1061,7 +1161,7 @@ namespace SolarReflectionManager {
 											if ( ObsSurfNum == ReflSurfNum - 1 ) continue;
 										}
 
-										PierceSurface( ObsSurfNum, HitPtRefl, SunVec, HitPtObs, hitObs );
+										PierceSurface( ObsSurfNum, HitPtRefl, FigureBeamSolSpecularReflFactorsSunVec, HitPtObs, hitObs );
 										if ( hitObs ) break;
 									}
 								}
@@ -1136,15 +1236,8 @@ namespace SolarReflectionManager {
 		// DERIVED TYPE DEFINITIONS: na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int RecSurfNum( 0 ); // Receiving surface number
-		static int SurfNum( 0 ); // Heat transfer surface number corresponding to RecSurfNum
-		static int ObsSurfNum( 0 ); // Obstruction surface number
-		static int RecPtNum( 0 ); // Receiving point number
-		static int NumRecPts( 0 ); // Number of receiving points on a receiving surface
-		static int HitPtSurfNum( 0 ); // Surface number of hit point: -1 = ground,
 		// 0 = sky or obstruction with receiving point below ground level,
 		// >0 = obstruction with receiving point above ground level
-		static int HitPtSurfNumX( 0 ); // For a shading surface, HitPtSurfNum for original surface,
 		// HitPitSurfNum + 1 for mirror surface
 		Array1D< Real64 > ReflSkySolObs( MaxRecPts ); // Irradiance at a receiving point for sky diffuse solar
 		// reflected from obstructions, divided by unobstructed
@@ -1152,43 +1245,24 @@ namespace SolarReflectionManager {
 		Array1D< Real64 > ReflSkySolGnd( MaxRecPts ); // Irradiance at a receiving point for sky diffuse solar
 		// reflected from ground, divided by unobstructed
 		// sky diffuse horizontal irradiance
-		static int RayNum( 0 ); // Ray number
-		static Vector3< Real64 > HitPtRefl( 0.0 ); // Coordinates of hit point on obstruction or ground (m)
 		bool hitObs; // True iff obstruction is hit
-		static Vector3< Real64 > HitPtObs( 0.0 ); // Hit point on an obstruction (m)
 		//unused  REAL(r64)         :: ObsHitPt(3)          =0.0 ! Hit point on obstruction (m)
-		static Real64 dOmega( 0.0 ); // Solid angle increment (steradians)
-		static Real64 CosIncAngRayToSky( 0.0 ); // Cosine of incidence angle on ground of ray to sky
-		static Real64 SkyReflSolRadiance( 0.0 ); // Reflected radiance at hit point divided by unobstructed
 		//  sky diffuse horizontal irradiance
-		static Real64 dReflSkySol( 0.0 ); // Contribution to reflection factor at a receiving point
 		//  from sky solar reflected from a hit point
-		static Real64 Phi( 0.0 ); // Altitude angle and increment (radians)
-		static Real64 DPhi( 0.0 ); // Altitude angle and increment (radians)
-		static Real64 SPhi( 0.0 ); // Sine of Phi
-		static Real64 CPhi( 0.0 ); // Cosine of Phi
-		static Real64 Theta( 0.0 ); // Azimuth angle (radians)
-		static Real64 DTheta( 0.0 ); // Azimuth increment (radians)
-		static int IPhi( 0 ); // Altitude angle index
-		static int ITheta( 0 ); // Azimuth angle index
-		static Vector3< Real64 > URay( 0.0 ); // Unit vector along ray from ground hit point
-		static Vector3< Real64 > SurfVertToGndPt( 0.0 ); // Vector from a vertex of possible obstructing surface to ground
 		//  hit point (m)
-		static Vector3< Real64 > SurfVert( 0.0 ); // Surface vertex (m)
-		static Real64 dReflSkyGnd( 0.0 ); // Factor for ground radiance due to direct sky diffuse reflection
 		// FLOW:
 
 		DisplayString( "Calculating Sky Diffuse Exterior Solar Reflection Factors" );
 		ReflSkySolObs = 0.0;
 		ReflSkySolGnd = 0.0;
 
-		for ( RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum ) {
-			SurfNum = SolReflRecSurf( RecSurfNum ).SurfNum;
-			for ( RecPtNum = 1; RecPtNum <= SolReflRecSurf( RecSurfNum ).NumRecPts; ++RecPtNum ) {
-				ReflSkySolObs( RecPtNum ) = 0.0;
-				ReflSkySolGnd( RecPtNum ) = 0.0;
-				for ( RayNum = 1; RayNum <= SolReflRecSurf( RecSurfNum ).NumReflRays; ++RayNum ) {
-					HitPtSurfNum = SolReflRecSurf( RecSurfNum ).HitPtSurfNum( RayNum, RecPtNum );
+		for ( CalcSkySolDiffuseReflFactorsRecSurfNum = 1; CalcSkySolDiffuseReflFactorsRecSurfNum <= TotSolReflRecSurf; ++CalcSkySolDiffuseReflFactorsRecSurfNum ) {
+			CalcSkySolDiffuseReflFactorsSurfNum = SolReflRecSurf( CalcSkySolDiffuseReflFactorsRecSurfNum ).SurfNum;
+			for ( CalcSkySolDiffuseReflFactorsRecPtNum = 1; CalcSkySolDiffuseReflFactorsRecPtNum <= SolReflRecSurf( CalcSkySolDiffuseReflFactorsRecSurfNum ).NumRecPts; ++CalcSkySolDiffuseReflFactorsRecPtNum ) {
+				ReflSkySolObs( CalcSkySolDiffuseReflFactorsRecPtNum ) = 0.0;
+				ReflSkySolGnd( CalcSkySolDiffuseReflFactorsRecPtNum ) = 0.0;
+				for ( CalcSkySolDiffuseReflFactorsRayNum = 1; CalcSkySolDiffuseReflFactorsRayNum <= SolReflRecSurf( CalcSkySolDiffuseReflFactorsRecSurfNum ).NumReflRays; ++CalcSkySolDiffuseReflFactorsRayNum ) {
+					CalcSkySolDiffuseReflFactorsHitPtSurfNum = SolReflRecSurf( CalcSkySolDiffuseReflFactorsRecSurfNum ).HitPtSurfNum( CalcSkySolDiffuseReflFactorsRayNum, CalcSkySolDiffuseReflFactorsRecPtNum );
 					// Skip rays that do not hit an obstruction or ground.
 					// (Note that if a downgoing ray does not hit an obstruction it will have HitPtSurfNum = 0
 					// if the receiving point is below ground level (see subr. InitSolReflRecSurf); this means
@@ -1197,31 +1271,31 @@ namespace SolarReflectionManager {
 					// beam and sky solar radiation. As far as reflected solar is concerned, the program does
 					// not handle a sloped ground plane or a horizontal ground plane whose level is different
 					// from one side of the building to another.)
-					if ( HitPtSurfNum == 0 ) continue; // Ray hits sky or obstruction with receiving pt. below ground level
-					HitPtRefl = SolReflRecSurf( RecSurfNum ).HitPt( RayNum, RecPtNum );
-					if ( HitPtSurfNum > 0 ) {
+					if ( CalcSkySolDiffuseReflFactorsHitPtSurfNum == 0 ) continue; // Ray hits sky or obstruction with receiving pt. below ground level
+					CalcSkySolDiffuseReflFactorsHitPtRefl = SolReflRecSurf( CalcSkySolDiffuseReflFactorsRecSurfNum ).HitPt( CalcSkySolDiffuseReflFactorsRayNum, CalcSkySolDiffuseReflFactorsRecPtNum );
+					if ( CalcSkySolDiffuseReflFactorsHitPtSurfNum > 0 ) {
 						// Ray hits an obstruction
 						// Skip hit points on daylighting shelves, from which solar reflection is separately calculated
-						if ( Surface( HitPtSurfNum ).Shelf > 0 ) continue;
+						if ( Surface( CalcSkySolDiffuseReflFactorsHitPtSurfNum ).Shelf > 0 ) continue;
 						// Reflected radiance at hit point divided by unobstructed sky diffuse horizontal irradiance
-						HitPtSurfNumX = HitPtSurfNum;
+						HitPtSurfNumX = CalcSkySolDiffuseReflFactorsHitPtSurfNum;
 						// Each shading surface has a "mirror" duplicate surface facing in the opposite direction.
 						// The following gets the correct side of a shading surface in order to get the right value
 						// of DifShdgRatioIsoSky (the two sides can have different sky shadowing).
-						if ( Surface( HitPtSurfNum ).ShadowingSurf ) {
-							if ( dot( SolReflRecSurf( RecSurfNum ).RayVec( RayNum ), Surface( HitPtSurfNum ).OutNormVec ) > 0.0 ) {
-								if ( HitPtSurfNum + 1 < TotSurfaces ) HitPtSurfNumX = HitPtSurfNum + 1;
+						if ( Surface( CalcSkySolDiffuseReflFactorsHitPtSurfNum ).ShadowingSurf ) {
+							if ( dot( SolReflRecSurf( CalcSkySolDiffuseReflFactorsRecSurfNum ).RayVec( CalcSkySolDiffuseReflFactorsRayNum ), Surface( CalcSkySolDiffuseReflFactorsHitPtSurfNum ).OutNormVec ) > 0.0 ) {
+								if ( CalcSkySolDiffuseReflFactorsHitPtSurfNum + 1 < TotSurfaces ) HitPtSurfNumX = CalcSkySolDiffuseReflFactorsHitPtSurfNum + 1;
 								if ( Surface( HitPtSurfNumX ).Shelf > 0 ) continue;
 							}
 						}
 
 						if ( ! DetailedSkyDiffuseAlgorithm || ! ShadingTransmittanceVaries || SolarDistribution == MinimalShadowing ) {
-							SkyReflSolRadiance = Surface( HitPtSurfNumX ).ViewFactorSky * DifShdgRatioIsoSky( HitPtSurfNumX ) * SolReflRecSurf( RecSurfNum ).HitPtSolRefl( RayNum, RecPtNum );
+							SkyReflSolRadiance = Surface( HitPtSurfNumX ).ViewFactorSky * DifShdgRatioIsoSky( HitPtSurfNumX ) * SolReflRecSurf( CalcSkySolDiffuseReflFactorsRecSurfNum ).HitPtSolRefl( CalcSkySolDiffuseReflFactorsRayNum, CalcSkySolDiffuseReflFactorsRecPtNum );
 						} else {
-							SkyReflSolRadiance = Surface( HitPtSurfNumX ).ViewFactorSky * DifShdgRatioIsoSkyHRTS( 1, 1, HitPtSurfNumX ) * SolReflRecSurf( RecSurfNum ).HitPtSolRefl( RayNum, RecPtNum );
+							SkyReflSolRadiance = Surface( HitPtSurfNumX ).ViewFactorSky * DifShdgRatioIsoSkyHRTS( 1, 1, HitPtSurfNumX ) * SolReflRecSurf( CalcSkySolDiffuseReflFactorsRecSurfNum ).HitPtSolRefl( CalcSkySolDiffuseReflFactorsRayNum, CalcSkySolDiffuseReflFactorsRecPtNum );
 						}
-						dReflSkySol = SkyReflSolRadiance * SolReflRecSurf( RecSurfNum ).dOmegaRay( RayNum ) * SolReflRecSurf( RecSurfNum ).CosIncAngRay( RayNum ) / Pi;
-						ReflSkySolObs( RecPtNum ) += dReflSkySol;
+						dReflSkySol = SkyReflSolRadiance * SolReflRecSurf( CalcSkySolDiffuseReflFactorsRecSurfNum ).dOmegaRay( CalcSkySolDiffuseReflFactorsRayNum ) * SolReflRecSurf( CalcSkySolDiffuseReflFactorsRecSurfNum ).CosIncAngRay( CalcSkySolDiffuseReflFactorsRayNum ) / Pi;
+						ReflSkySolObs( CalcSkySolDiffuseReflFactorsRecPtNum ) += dReflSkySol;
 					} else {
 						// Ray hits ground;
 						// Find radiance at hit point due to reflection of sky diffuse reaching
@@ -1250,21 +1324,21 @@ namespace SolarReflectionManager {
 								URay.y = CPhi * std::sin( Theta );
 								// Does this ray hit an obstruction?
 								hitObs = false;
-								for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
-									if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
+								for ( CalcSkySolDiffuseReflFactorsObsSurfNum = 1; CalcSkySolDiffuseReflFactorsObsSurfNum <= TotSurfaces; ++CalcSkySolDiffuseReflFactorsObsSurfNum ) {
+									if ( ! Surface( CalcSkySolDiffuseReflFactorsObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
 									// Horizontal roof surfaces cannot be obstructions for rays from ground
-									if ( Surface( ObsSurfNum ).Tilt < 5.0 ) continue;
-									if ( ! Surface( ObsSurfNum ).ShadowingSurf ) {
-										if ( dot( URay, Surface( ObsSurfNum ).OutNormVec ) >= 0.0 ) continue;
+									if ( Surface( CalcSkySolDiffuseReflFactorsObsSurfNum ).Tilt < 5.0 ) continue;
+									if ( ! Surface( CalcSkySolDiffuseReflFactorsObsSurfNum ).ShadowingSurf ) {
+										if ( dot( URay, Surface( CalcSkySolDiffuseReflFactorsObsSurfNum ).OutNormVec ) >= 0.0 ) continue;
 										// Special test for vertical surfaces with URay dot OutNormVec < 0; excludes
 										// case where ground hit point is in back of ObsSurfNum
-										if ( Surface( ObsSurfNum ).Tilt > 89.0 && Surface( ObsSurfNum ).Tilt < 91.0 ) {
-											SurfVert = Surface( ObsSurfNum ).Vertex( 2 );
-											SurfVertToGndPt = HitPtRefl - SurfVert;
-											if ( dot( SurfVertToGndPt, Surface( ObsSurfNum ).OutNormVec ) < 0.0 ) continue;
+										if ( Surface( CalcSkySolDiffuseReflFactorsObsSurfNum ).Tilt > 89.0 && Surface( CalcSkySolDiffuseReflFactorsObsSurfNum ).Tilt < 91.0 ) {
+											SurfVert = Surface( CalcSkySolDiffuseReflFactorsObsSurfNum ).Vertex( 2 );
+											SurfVertToGndPt = CalcSkySolDiffuseReflFactorsHitPtRefl - SurfVert;
+											if ( dot( SurfVertToGndPt, Surface( CalcSkySolDiffuseReflFactorsObsSurfNum ).OutNormVec ) < 0.0 ) continue;
 										}
 									}
-									PierceSurface( ObsSurfNum, HitPtRefl, URay, HitPtObs, hitObs );
+									PierceSurface( CalcSkySolDiffuseReflFactorsObsSurfNum, CalcSkySolDiffuseReflFactorsHitPtRefl, URay, CalcSkySolDiffuseReflFactorsHitPtObs, hitObs );
 									if ( hitObs ) break;
 								}
 								if ( hitObs ) continue; // Obstruction hit
@@ -1272,23 +1346,23 @@ namespace SolarReflectionManager {
 								dReflSkyGnd += CosIncAngRayToSky * dOmega / Pi;
 							} // End of azimuth loop
 						} // End of altitude loop
-						ReflSkySolGnd( RecPtNum ) += dReflSkyGnd * SolReflRecSurf( RecSurfNum ).dOmegaRay( RayNum ) * SolReflRecSurf( RecSurfNum ).CosIncAngRay( RayNum ) / Pi;
+						ReflSkySolGnd( CalcSkySolDiffuseReflFactorsRecPtNum ) += dReflSkyGnd * SolReflRecSurf( CalcSkySolDiffuseReflFactorsRecSurfNum ).dOmegaRay( CalcSkySolDiffuseReflFactorsRayNum ) * SolReflRecSurf( CalcSkySolDiffuseReflFactorsRecSurfNum ).CosIncAngRay( CalcSkySolDiffuseReflFactorsRayNum ) / Pi;
 					} // End of check if ray from receiving point hits obstruction or ground
 				} // End of loop over rays from receiving point
 			} // End of loop over receiving points
 
 			// Average over receiving points
-			ReflFacSkySolObs( SurfNum ) = 0.0;
-			ReflFacSkySolGnd( SurfNum ) = 0.0;
-			NumRecPts = SolReflRecSurf( RecSurfNum ).NumRecPts;
-			for ( RecPtNum = 1; RecPtNum <= NumRecPts; ++RecPtNum ) {
-				ReflFacSkySolObs( SurfNum ) += ReflSkySolObs( RecPtNum );
-				ReflFacSkySolGnd( SurfNum ) += ReflSkySolGnd( RecPtNum );
+			ReflFacSkySolObs( CalcSkySolDiffuseReflFactorsSurfNum ) = 0.0;
+			ReflFacSkySolGnd( CalcSkySolDiffuseReflFactorsSurfNum ) = 0.0;
+			CalcSkySolDiffuseReflFactorsNumRecPts = SolReflRecSurf( CalcSkySolDiffuseReflFactorsRecSurfNum ).NumRecPts;
+			for ( CalcSkySolDiffuseReflFactorsRecPtNum = 1; CalcSkySolDiffuseReflFactorsRecPtNum <= CalcSkySolDiffuseReflFactorsNumRecPts; ++CalcSkySolDiffuseReflFactorsRecPtNum ) {
+				ReflFacSkySolObs( CalcSkySolDiffuseReflFactorsSurfNum ) += ReflSkySolObs( CalcSkySolDiffuseReflFactorsRecPtNum );
+				ReflFacSkySolGnd( CalcSkySolDiffuseReflFactorsSurfNum ) += ReflSkySolGnd( CalcSkySolDiffuseReflFactorsRecPtNum );
 			}
-			ReflFacSkySolObs( SurfNum ) /= NumRecPts;
-			ReflFacSkySolGnd( SurfNum ) /= NumRecPts;
+			ReflFacSkySolObs( CalcSkySolDiffuseReflFactorsSurfNum ) /= CalcSkySolDiffuseReflFactorsNumRecPts;
+			ReflFacSkySolGnd( CalcSkySolDiffuseReflFactorsSurfNum ) /= CalcSkySolDiffuseReflFactorsNumRecPts;
 			// Do not allow ReflFacBmToDiffSolGnd to exceed the surface's unobstructed ground view factor
-			ReflFacSkySolGnd( SurfNum ) = min( 0.5 * ( 1.0 - Surface( SurfNum ).CosTilt ), ReflFacSkySolGnd( SurfNum ) );
+			ReflFacSkySolGnd( CalcSkySolDiffuseReflFactorsSurfNum ) = min( 0.5 * ( 1.0 - Surface( CalcSkySolDiffuseReflFactorsSurfNum ).CosTilt ), ReflFacSkySolGnd( CalcSkySolDiffuseReflFactorsSurfNum ) );
 			// Note: the above factors are dimensionless; they are equal to
 			// (W/m2 reflected solar incident on SurfNum)/(W/m2 unobstructed horizontal sky diffuse irradiance)
 		} // End of loop over receiving surfaces
@@ -133,6 +133,11 @@ namespace SolarReflectionManager {
 
 	// Functions
 
+	// Clears the global data in SolarReflectionManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	InitSolReflRecSurf();
 
@@ -221,6 +221,51 @@ namespace SolarShading {
 		bool MustAllocSolarShading( true );
 		bool GetInputFlag( true );
 		bool firstTime( true );
+		Real64 TolValue( 0.0003 );
+		Array1D< Real64 > CHKSBSXVT; // X Vertices of
+		Array1D< Real64 > CHKSBSYVT; // Y vertices of
+		Array1D< Real64 > CHKSBSZVT; // Z vertices of
+		bool OneTimeFlag( true );
+		Array1D< Real64 > SLOPE; // Slopes from left-most vertex to others
+		bool FirstTimeFlag( true );
+		bool TooManyFiguresMessage( false );
+		bool TooManyVerticesMessage( false );
+		bool Once( true );
+		Array1D< Real64 > SchedValue; // Hourly and time step transmittance of each scheduled shadowing surface
+		int MaxGSS( 50 ); // Current Max for GSS array
+		int MaxBKS( 50 ); // Current Max for BKS array
+		int MaxSBS( 50 ); // Current Max for SBS array
+		int MaxDim( 0 );
+		Array1D< Real64 > SHADOWXVT; // X Vertices of Shadows
+		Array1D< Real64 > SHADOWYVT; // Y vertices of Shadows
+		Array1D< Real64 > SHADOWZVT; // Z vertices of Shadows
+		bool SHADOWOneTimeFlag( true );
+		Array1D< Real64 > SHDBKSXVT; // X,Y,Z coordinates of vertices of
+		Array1D< Real64 > SHDBKSYVT; // back surfaces projected into system
+		Array1D< Real64 > SHDBKSZVT; // relative to receiving surface
+		bool SHDBKSOneTimeFlag( true );
+		Array1D< Real64 > SHDGSSXVT;
+		Array1D< Real64 > SHDGSSYVT;
+		Array1D< Real64 > SHDGSSZVT;
+		bool SHDGSSOneTimeFlag( true );
+		Array1D< Real64 > AbsBeamWin; // Glass layer beam solar absorptance of a window
+		Array1D< Real64 > AbsBeamWinEQL( CFSMAXNL+1 ); // layers beam solar absorptance of a window
+		Array1D< Real64 > ExtBeamAbsByShadFac; // Factor for exterior beam radiation absorbed by shade
+		Array1D< Real64 > IntBeamAbsByShadFac; // Like ExtBeamAbsByShadFac, but for interior beam radiation.
+		Array1D< Real64 > WinTransBmSolar; // Factor for exterior beam solar transmitted through window,
+		Array1D< Real64 > WinTransDifSolar; // Factor for exterior diffuse solar transmitted through window,
+		Array1D< Real64 > WinTransDifSolarGnd; // Factor for exterior ground diffuse solar transmitted through
+		Array1D< Real64 > WinTransDifSolarSky; // Factor for exterior sky diffuse solar transmitted through
+		Array2D< Real64 > AbsSolBeamEQL( 2, CFSMAXNL+1 ); // absorbed exterior beam radiation by layers fraction
+		Array2D< Real64 > AbsSolDiffEQL( 2, CFSMAXNL+1 ); // absorbed exterior diffuse radiation by layers fraction
+		Array2D< Real64 > AbsSolBeamBackEQL( 2, CFSMAXNL+1 ); // absorbed interior beam radiation by layers fraction from back
+		Real64 ThetaBig( 0.0 ); // Larger of ThetaBlock1 and ThetaBlock2 	//Autodesk Used uninitialized in some runs
+		Real64 ThetaSmall( 0.0 ); // Smaller of ThetaBlock1 and ThetaBlock2 //Autodesk Used uninitialized in some runs
+		Real64 ThetaMin( 0.0 ); // Minimum allowed slat angle, resp. (rad)  //Autodesk Used uninitialized in some runs
+		Real64 ThetaMax( 0.0 ); // Maximum allowed slat angle, resp. (rad)  //Autodesk Used uninitialized in some runs
+		Array1D< Real64 > CalcComplexWindowOverlapXVT; // X,Y,Z coordinates of vertices of
+		Array1D< Real64 > CalcComplexWindowOverlapYVT; // back surfaces projected into system
+		Array1D< Real64 > CalcComplexWindowOverlapZVT; // relative to receiving surface
 	}
 
 	std::ofstream shd_stream; // Shading file stream
@@ -262,6 +307,14 @@ namespace SolarShading {
 	Array1D< Real64 > XTEMP1; // Temporary 'X' values for HC vertices of the overlap
 	Array1D< Real64 > YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
 	int maxNumberOfFigures( 0 );
+	int const MaxSkyDifShdgRatioSets( 32 ); // Maximum number of transmittance states whose sky diffuse shading ratios are kept
+	int NumSkyDifShdgRatioSets( 0 ); // Number of transmittance states whose sky diffuse shading ratios are kept
+	Array1D_int SkyDifShdgSchedSurfs; // Shadowing surfaces with a transmittance schedule
+	Array1D_int AnisoSkySurfs; // Surfaces receiving exterior solar, in the order of the arrays below
+	Array1D< Real64 > AnisoSkyNormX; // X component of the outward normal of each AnisoSkySurfs surface
+	Array1D< Real64 > AnisoSkyNormY; // Y component of the outward normal of each AnisoSkySurfs surface
+	Array1D< Real64 > AnisoSkyNormZ; // Z component of the outward normal of each AnisoSkySurfs surface
+	Array1D< Real64 > AnisoSkyCosInc; // Cosine of incidence angle of beam solar on each AnisoSkySurfs surface
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SolarShading
 
@@ -269,6 +322,7 @@ namespace SolarShading {
 	Array1D< SurfaceErrorTracking > TrackTooManyFigures;
 	Array1D< SurfaceErrorTracking > TrackTooManyVertices;
 	Array1D< SurfaceErrorTracking > TrackBaseSubSurround;
+	Array1D< SkyDifShdgRatioSet > SkyDifShdgRatioSets;
 
 	static gio::Fmt fmtLD( "*" );
 
@@ -336,11 +390,64 @@ namespace SolarShading {
 		XTEMP1.deallocate();
 		YTEMP1.deallocate();
 		maxNumberOfFigures = 0;
+		NumSkyDifShdgRatioSets = 0;
+		SkyDifShdgSchedSurfs.deallocate();
+		AnisoSkySurfs.deallocate();
+		AnisoSkyNormX.deallocate();
+		AnisoSkyNormY.deallocate();
+		AnisoSkyNormZ.deallocate();
+		AnisoSkyCosInc.deallocate();
 		TrackTooManyFigures.deallocate();
 		TrackTooManyVertices.deallocate();
 		TrackBaseSubSurround.deallocate();
+		SkyDifShdgRatioSets.deallocate();
 		DBZoneIntWin.deallocate();
 		ISABSF.deallocate();
+		TolValue = 0.0003;
+		CHKSBSXVT.deallocate();
+		CHKSBSYVT.deallocate();
+		CHKSBSZVT.deallocate();
+		OneTimeFlag = true;
+		SLOPE.deallocate();
+		FirstTimeFlag = true;
+		TooManyFiguresMessage = false;
+		TooManyVerticesMessage = false;
+		Once = true;
+		SchedValue.deallocate();
+		MaxGSS = 50;
+		MaxBKS = 50;
+		MaxSBS = 50;
+		MaxDim = 0;
+		SHADOWXVT.deallocate();
+		SHADOWYVT.deallocate();
+		SHADOWZVT.deallocate();
+		SHADOWOneTimeFlag = true;
+		SHDBKSXVT.deallocate();
+		SHDBKSYVT.deallocate();
+		SHDBKSZVT.deallocate();
+		SHDBKSOneTimeFlag = true;
+		SHDGSSXVT.deallocate();
+		SHDGSSYVT.deallocate();
+		SHDGSSZVT.deallocate();
+		SHDGSSOneTimeFlag = true;
+		AbsBeamWin.deallocate();
+		AbsBeamWinEQL = Array1D< Real64 >( CFSMAXNL+1 );
+		ExtBeamAbsByShadFac.deallocate();
+		IntBeamAbsByShadFac.deallocate();
+		WinTransBmSolar.deallocate();
+		WinTransDifSolar.deallocate();
+		WinTransDifSolarGnd.deallocate();
+		WinTransDifSolarSky.deallocate();
+		AbsSolBeamEQL = Array2D< Real64 >( 2, CFSMAXNL+1 );
+		AbsSolDiffEQL = Array2D< Real64 >( 2, CFSMAXNL+1 );
+		AbsSolBeamBackEQL = Array2D< Real64 >( 2, CFSMAXNL+1 );
+		ThetaBig = 0.0;
+		ThetaSmall = 0.0;
+		ThetaMin = 0.0;
+		ThetaMax = 0.0;
+		CalcComplexWindowOverlapXVT.deallocate();
+		CalcComplexWindowOverlapYVT.deallocate();
+		CalcComplexWindowOverlapZVT.deallocate();
 	}
 
 	void
@@ -1319,8 +1426,9 @@ namespace SolarShading {
 		Real64 Epsilon; // Sky clearness parameter
 		Real64 Delta; // Sky brightness parameter
 		Real64 CosIncAngBeamOnSurface; // Cosine of incidence angle of beam solar on surface
-		Real64 IncAng; // Incidence angle of beam solar on surface (radians)
 		int SurfNum; // Surface number
+		int Loop; // Exterior solar surface counter
+		int NumAnisoSkySurfs; // Number of surfaces receiving exterior solar
 		int EpsilonBin; // Sky clearness (Epsilon) bin index
 		Real64 AirMass; // Relative air mass
 		Real64 AirMassH; // Intermediate variable for relative air mass calculation
@@ -1358,10 +1466,40 @@ namespace SolarShading {
 		F1 = max( 0.0, F11R( EpsilonBin ) + F12R( EpsilonBin ) * Delta + F13R( EpsilonBin ) * ZenithAng );
 		F2 = F21R( EpsilonBin ) + F22R( EpsilonBin ) * Delta + F23R( EpsilonBin ) * ZenithAng;
 
-		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
-			if ( ! Surface( SurfNum ).ExtSolar ) continue;
+		//           Gather the surfaces receiving exterior solar and their outward normals once
+		if ( ! AnisoSkySurfs.allocated() ) {
+			NumAnisoSkySurfs = 0;
+			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				if ( Surface( SurfNum ).ExtSolar ) ++NumAnisoSkySurfs;
+			}
+			AnisoSkySurfs.allocate( NumAnisoSkySurfs );
+			AnisoSkyNormX.allocate( NumAnisoSkySurfs );
+			AnisoSkyNormY.allocate( NumAnisoSkySurfs );
+			AnisoSkyNormZ.allocate( NumAnisoSkySurfs );
+			AnisoSkyCosInc.allocate( NumAnisoSkySurfs );
+			Loop = 0;
+			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				if ( ! Surface( SurfNum ).ExtSolar ) continue;
+				++Loop;
+				AnisoSkySurfs( Loop ) = SurfNum;
+				AnisoSkyNormX( Loop ) = Surface( SurfNum ).OutNormVec( 1 );
+				AnisoSkyNormY( Loop ) = Surface( SurfNum ).OutNormVec( 2 );
+				AnisoSkyNormZ( Loop ) = Surface( SurfNum ).OutNormVec( 3 );
+			}
+		}
+		NumAnisoSkySurfs = AnisoSkySurfs.isize();
+
+		//           Cosine of incidence angle of beam solar on all of these surfaces in one pass
+		Real64 const SolCosX( SOLCOS( 1 ) );
+		Real64 const SolCosY( SOLCOS( 2 ) );
+		Real64 const SolCosZ( SOLCOS( 3 ) );
+		for ( Loop = 1; Loop <= NumAnisoSkySurfs; ++Loop ) {
+			AnisoSkyCosInc( Loop ) = SolCosX * AnisoSkyNormX( Loop ) + SolCosY * AnisoSkyNormY( Loop ) + SolCosZ * AnisoSkyNormZ( Loop );
+		}
 
-			CosIncAngBeamOnSurface = SOLCOS( 1 ) * Surface( SurfNum ).OutNormVec( 1 ) + SOLCOS( 2 ) * Surface( SurfNum ).OutNormVec( 2 ) + SOLCOS( 3 ) * Surface( SurfNum ).OutNormVec( 3 );
+		for ( Loop = 1; Loop <= NumAnisoSkySurfs; ++Loop ) {
+			SurfNum = AnisoSkySurfs( Loop );
+			CosIncAngBeamOnSurface = AnisoSkyCosInc( Loop );
 
 			// So I believe this should only be a diagnostic error...the calcs should always be within -1,+1; it's just round-off that we need to trap for
 			if ( CosIncAngBeamOnSurface > 1.0 ) {
@@ -1384,8 +1522,6 @@ namespace SolarShading {
 				CosIncAngBeamOnSurface = -1.0;
 			}
 
-			IncAng = std::acos( CosIncAngBeamOnSurface );
-
 			ViewFactorSkyGeom = Surface( SurfNum ).ViewFactorSky;
 			MultIsoSky( SurfNum ) = ViewFactorSkyGeom * ( 1.0 - F1 );
 			//           0.0871557 below corresponds to a zenith angle of 85 deg
@@ -1529,7 +1665,6 @@ namespace SolarShading {
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		static Real64 TolValue( 0.0003 );
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -1651,15 +1786,11 @@ namespace SolarShading {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int N; // Loop Control
 		int NVT; // Number of vertices
-		static Array1D< Real64 > XVT; // X Vertices of
-		static Array1D< Real64 > YVT; // Y vertices of
-		static Array1D< Real64 > ZVT; // Z vertices of
 
 		int NS1; // Number of the figure being overlapped
 		int NS2; // Number of the figure doing overlapping
 		int NS3; // Location to place results of overlap
 
-		static bool OneTimeFlag( true );
 		bool inside;
 
 		bool Out;
@@ -1676,12 +1807,12 @@ namespace SolarShading {
 		//  INTEGER M
 
 		if ( OneTimeFlag ) {
-			XVT.allocate( MaxVerticesPerSurface + 1 );
-			YVT.allocate( MaxVerticesPerSurface + 1 );
-			ZVT.allocate( MaxVerticesPerSurface + 1 );
-			XVT = 0.0;
-			YVT = 0.0;
-			ZVT = 0.0;
+			CHKSBSXVT.allocate( MaxVerticesPerSurface + 1 );
+			CHKSBSYVT.allocate( MaxVerticesPerSurface + 1 );
+			CHKSBSZVT.allocate( MaxVerticesPerSurface + 1 );
+			CHKSBSXVT = 0.0;
+			CHKSBSYVT = 0.0;
+			CHKSBSZVT = 0.0;
 			OneTimeFlag = false;
 		}
 
@@ -1693,15 +1824,15 @@ namespace SolarShading {
 
 		// Put coordinates of base surface into clockwise sequence on the x'-y' plane.
 
-		XVT = 0.0;
-		YVT = 0.0;
-		ZVT = 0.0;
+		CHKSBSXVT = 0.0;
+		CHKSBSYVT = 0.0;
+		CHKSBSZVT = 0.0;
 		XVS = 0.0;
 		YVS = 0.0;
-		CTRANS( GRSNR, HTS, NVT, XVT, YVT, ZVT );
+		CTRANS( GRSNR, HTS, NVT, CHKSBSXVT, CHKSBSYVT, CHKSBSZVT );
 		for ( N = 1; N <= NVT; ++N ) {
-			XVS( N ) = XVT( NVT + 1 - N );
-			YVS( N ) = YVT( NVT + 1 - N );
+			XVS( N ) = CHKSBSXVT( NVT + 1 - N );
+			YVS( N ) = CHKSBSYVT( NVT + 1 - N );
 		}
 
 		HTRANS1( NS2, NVT );
@@ -3125,7 +3256,6 @@ namespace SolarShading {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array1D< Real64 > SLOPE; // Slopes from left-most vertex to others
 		Real64 DELTAX; // Difference between X coordinates of two vertices
 		Real64 DELTAY; // Difference between Y coordinates of two vertices
 		Real64 SAVES; // Temporary location for exchange of variables
@@ -3139,7 +3269,6 @@ namespace SolarShading {
 		int M; // Number of slopes to be sorted
 		int N; // Vertex number
 		int P; // Location of first slope to be sorted
-		static bool FirstTimeFlag( true );
 
 		if ( FirstTimeFlag ) {
 			SLOPE.allocate( max( 10, MaxVerticesPerSurface + 1 ) );
@@ -3286,8 +3415,6 @@ namespace SolarShading {
 		int NV3; // Number of vertices of figure NS3 (the overlap of NS1 and NS2)
 		int NIN1; // Number of vertices of NS1 within NS2
 		int NIN2; // Number of vertices of NS2 within NS1
-		static bool TooManyFiguresMessage( false );
-		static bool TooManyVerticesMessage( false );
 
 		// Check for exceeding array limits.
 #ifdef EP_Count_Calls
@@ -3462,7 +3589,6 @@ namespace SolarShading {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int iHour; // Hour index number
 		int TS; // TimeStep Loop Counter
-		static bool Once( true );
 
 		if ( Once ) InitComplexWindows();
 		Once = false;
@@ -3607,7 +3733,9 @@ namespace SolarShading {
 		// This subroutine computes solar gain multipliers for beam solar
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The sky patches are shadowed ahead of the sun so that the sun direction, the back
+		// surface overlaps and the window reveal results of this time step are not left set
+		// to those of the last sky patch.
 
 		// REFERENCES:
 		// na
@@ -3620,9 +3748,7 @@ namespace SolarShading {
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		int const NPhi( 6 ); // Number of altitude angle steps for sky integration
-		int const NTheta( 24 ); // Number of azimuth angle steps for sky integration
-		Real64 const Eps( 1.e-10 ); // Small number
+		// na
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -3632,19 +3758,7 @@ namespace SolarShading {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS
 		Real64 SurfArea; // Surface area. For walls, includes all window frame areas.
-		Real64 CosPhi; // Cosine of Phi
 		int SurfNum; // Surface Loop index
-		Real64 Fac1WoShdg; // Intermediate calculation factor, without shading
-		Real64 Fac1WithShdg; // Intermediate calculation factor, with shading
-		int IPhi; // Altitude step counter
-		int ITheta; // Azimuth step counter
-		Real64 DPhi; // Altitude step size
-		Real64 DTheta; // Azimuth step size
-		Real64 DThetaDPhi; // Product of DTheta and DPhi
-		Real64 PhiMin; // Minimum altitude
-		Real64 Phi; // Altitude angle
-		Real64 Theta; // Azimuth angle
-		Real64 FracIlluminated; // Fraction of surface area illuminated by a sky patch
 
 		// Recover the sun direction from the array stored in previous loop
 		SUNCOS = SUNCOSTS( iTimeStep, iHour, { 1, 3 } );
@@ -3653,6 +3767,18 @@ namespace SolarShading {
 
 		if ( SUNCOS( 3 ) < SunIsUpValue ) return;
 
+		//   Note -- if not the below, values are set in SkyDifSolarShading routine (constant for simulation)
+		if ( DetailedSkyDiffuseAlgorithm && ShadingTransmittanceVaries && SolarDistribution != MinimalShadowing ) {
+			FigureSkyDifShdgRatiosAtTimestep( iHour, iTimeStep );
+
+			// Clear what the sky patches may have left for this time step and restore the sun direction
+			SunlitFracWithoutReveal( iTimeStep, iHour, {1,TotSurfaces} ) = 0.0;
+			WindowRevealStatus( iTimeStep, iHour, {1,TotSurfaces} ) = 0;
+			BackSurfaces( iTimeStep, iHour, {1,MaxBkSurf}, {1,TotSurfaces} ) = 0;
+			OverlapAreas( iTimeStep, iHour, {1,MaxBkSurf}, {1,TotSurfaces} ) = 0.0;
+			SUNCOS = SUNCOSTS( iTimeStep, iHour, { 1, 3 } );
+		}
+
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 			CTHETA( SurfNum ) = SUNCOS( 1 ) * Surface( SurfNum ).OutNormVec( 1 ) + SUNCOS( 2 ) * Surface( SurfNum ).OutNormVec( 2 ) + SUNCOS( 3 ) * Surface( SurfNum ).OutNormVec( 3 );
 			if ( !DetailedSolarTimestepIntegration ) {
@@ -3683,99 +3809,198 @@ namespace SolarShading {
 			}
 		}
 
-		//   Note -- if not the below, values are set in SkyDifSolarShading routine (constant for simulation)
-		if ( DetailedSkyDiffuseAlgorithm && ShadingTransmittanceVaries && SolarDistribution != MinimalShadowing ) {
-			WithShdgIsoSky = 0.;
-			WoShdgIsoSky = 0.;
-			WithShdgHoriz = 0.;
-			WoShdgHoriz = 0.;
-
-			DPhi = PiOvr2 / NPhi; // 15 deg for NPhi = 6
-			DTheta = 2.0 * Pi / NTheta; // 15 deg for NTheta = 24
-			DThetaDPhi = DTheta * DPhi;
-			PhiMin = 0.5 * DPhi; // 7.5 deg for DPhi = 15 deg
-
-			for ( IPhi = 1; IPhi <= NPhi; ++IPhi ) { // Loop over patch altitude values
-				Phi = PhiMin + ( IPhi - 1 ) * DPhi; // 7.5,22.5,37.5,52.5,67.5,82.5 for NPhi = 6
-				SUNCOS( 3 ) = std::sin( Phi );
-				CosPhi = std::cos(Phi);
-
-				for ( ITheta = 1; ITheta <= NTheta; ++ITheta ) { // Loop over patch azimuth values
-					Theta = ( ITheta - 1 ) * DTheta; // 0,15,30,....,330,345 for NTheta = 24
-					SUNCOS( 1 ) = CosPhi * std::cos( Theta );
-					SUNCOS( 2 ) = CosPhi * std::sin( Theta );
-
-					for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
-						if ( !Surface( SurfNum ).ShadowingSurf && !Surface( SurfNum ).HeatTransSurf ) continue;
-						CTHETA( SurfNum ) = SUNCOS( 1 ) * Surface( SurfNum ).OutNormVec( 1 ) + SUNCOS( 2 ) * Surface( SurfNum ).OutNormVec( 2 ) + SUNCOS( 3 ) * Surface( SurfNum ).OutNormVec( 3 );
-					}
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			// For exterior windows with frame/divider that are partially or fully sunlit,
+			// correct SunlitFrac due to shadowing of frame and divider projections onto window glass.
+			// Note: if SunlitFrac = 0.0 the window is either completely shaded or the sun is in back
+			// of the window; in either case, frame/divider shadowing doesn't have to be done.
+
+			if ( Surface( SurfNum ).Class == SurfaceClass_Window && Surface( SurfNum ).ExtBoundCond == ExternalEnvironment && SunlitFrac( iTimeStep, iHour, SurfNum ) > 0.0 && Surface( SurfNum ).FrameDivider > 0 ) CalcFrameDividerShadow( SurfNum, Surface( SurfNum ).FrameDivider, iHour );
+		}
+
+	}
+
+	void
+	FigureSkyDifShdgRatiosAtTimestep(
+		int const iHour,
+		int const iTimeStep
+	)
+	{
 
-					SHADOW( iHour, iTimeStep ); // Determine sunlit areas and solar multipliers for all surfaces.
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
 
-					for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine computes the sky and horizon diffuse shading ratios of a time step
+		// when the transmittance of shadowing surfaces varies (detailed sky diffuse modeling).
 
-						if ( !Surface( SurfNum ).ShadowingSurf && ( !Surface( SurfNum ).HeatTransSurf || !Surface( SurfNum ).ExtSolar || ( Surface( SurfNum ).ExtBoundCond != ExternalEnvironment && Surface( SurfNum ).ExtBoundCond != OtherSideCondModeledExt ) ) ) continue;
+		// METHODOLOGY EMPLOYED:
+		// The sky is divided into patches and each patch is shadowed as if it were the sun.
+		// The results only depend on the geometry and on the scheduled transmittance of the
+		// shadowing surfaces, so the ratios found for a set of transmittance values are kept
+		// and reused whenever the same set comes back (e.g., every daylit time step of an
+		// on/off or seasonal shading schedule).
 
-						if ( CTHETA( SurfNum ) < 0.0 ) continue;
+		// REFERENCES:
+		// na
 
-						Fac1WoShdg = CosPhi * DThetaDPhi * CTHETA( SurfNum );
-						SurfArea = Surface( SurfNum ).NetAreaShadowCalc;
-						if ( SurfArea > Eps ) {
-							FracIlluminated = SAREA( SurfNum ) / SurfArea;
-						} else {
-							FracIlluminated = SAREA( SurfNum ) / ( SurfArea + Eps );
-						}
-						Fac1WithShdg = Fac1WoShdg * FracIlluminated;
-						WithShdgIsoSky( SurfNum ) += Fac1WithShdg;
-						WoShdgIsoSky( SurfNum ) += Fac1WoShdg;
-
-						// Horizon region
-						if ( IPhi == 1 ) {
-							WithShdgHoriz( SurfNum ) += Fac1WithShdg;
-							WoShdgHoriz( SurfNum ) += Fac1WoShdg;
-						}
-					} // End of surface loop
-				} // End of Theta loop
-			} // End of Phi loop
+		// Using/Aliasing
+		using ScheduleManager::LookUpScheduleValue;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
 
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const NPhi( 6 ); // Number of altitude angle steps for sky integration
+		int const NTheta( 24 ); // Number of azimuth angle steps for sky integration
+		Real64 const Eps( 1.e-10 ); // Small number
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS
+		Real64 SurfArea; // Surface area. For walls, includes all window frame areas.
+		Real64 CosPhi; // Cosine of Phi
+		int SurfNum; // Surface Loop index
+		Real64 Fac1WoShdg; // Intermediate calculation factor, without shading
+		Real64 Fac1WithShdg; // Intermediate calculation factor, with shading
+		int IPhi; // Altitude step counter
+		int ITheta; // Azimuth step counter
+		Real64 DPhi; // Altitude step size
+		Real64 DTheta; // Azimuth step size
+		Real64 DThetaDPhi; // Product of DTheta and DPhi
+		Real64 PhiMin; // Minimum altitude
+		Real64 Phi; // Altitude angle
+		Real64 Theta; // Azimuth angle
+		Real64 FracIlluminated; // Fraction of surface area illuminated by a sky patch
+		int SchedSurfNum; // Scheduled shadowing surface counter
+		int SchedIndex; // Transmittance schedule of a shadowing surface
+		int SetNum; // Saved shading ratio set counter
+
+		// Find the shadowing surfaces whose transmittance is scheduled (these are the only inputs that vary)
+		if ( ! SkyDifShdgSchedSurfs.allocated() ) {
+			int NumSchedSurfs = 0;
+			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				if ( ! Surface( SurfNum ).HeatTransSurf && Surface( SurfNum ).SchedShadowSurfIndex > 0 ) ++NumSchedSurfs;
+			}
+			SkyDifShdgSchedSurfs.allocate( NumSchedSurfs );
+			NumSchedSurfs = 0;
 			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				if ( ! Surface( SurfNum ).HeatTransSurf && Surface( SurfNum ).SchedShadowSurfIndex > 0 ) SkyDifShdgSchedSurfs( ++NumSchedSurfs ) = SurfNum;
+			}
+		}
 
-				if ( ! Surface( SurfNum ).ShadowingSurf && ( ! Surface( SurfNum ).HeatTransSurf || ! Surface( SurfNum ).ExtSolar || ( Surface( SurfNum ).ExtBoundCond != ExternalEnvironment && Surface( SurfNum ).ExtBoundCond != OtherSideCondModeledExt ) ) ) continue;
+		SchedValue.dimension( 2 * SkyDifShdgSchedSurfs.isize(), 0.0 );
+		for ( SchedSurfNum = 1; SchedSurfNum <= SkyDifShdgSchedSurfs.isize(); ++SchedSurfNum ) {
+			SchedIndex = Surface( SkyDifShdgSchedSurfs( SchedSurfNum ) ).SchedShadowSurfIndex;
+			SchedValue( 2 * SchedSurfNum - 1 ) = LookUpScheduleValue( SchedIndex, iHour );
+			SchedValue( 2 * SchedSurfNum ) = LookUpScheduleValue( SchedIndex, iHour, iTimeStep );
+		}
 
-				if ( std::abs( WoShdgIsoSky( SurfNum ) ) > Eps ) {
-					DifShdgRatioIsoSkyHRTS( iTimeStep, iHour, SurfNum ) = ( WithShdgIsoSky( SurfNum ) ) / ( WoShdgIsoSky( SurfNum ) );
-				} else {
-					DifShdgRatioIsoSkyHRTS( iTimeStep, iHour, SurfNum ) = ( WithShdgIsoSky( SurfNum ) ) / ( WoShdgIsoSky( SurfNum ) + Eps );
-				}
-				if ( std::abs( WoShdgHoriz( SurfNum ) ) > Eps ) {
-					DifShdgRatioHorizHRTS( iTimeStep, iHour, SurfNum ) = ( WithShdgHoriz( SurfNum ) ) / ( WoShdgHoriz( SurfNum ) );
-				} else {
-					DifShdgRatioHorizHRTS( iTimeStep, iHour, SurfNum ) = ( WithShdgHoriz( SurfNum ) ) / ( WoShdgHoriz( SurfNum ) + Eps );
+		// Reuse the ratios of an earlier time step with the same transmittances
+		for ( SetNum = 1; SetNum <= NumSkyDifShdgRatioSets; ++SetNum ) {
+			auto const & ratioSet( SkyDifShdgRatioSets( SetNum ) );
+			if ( ! eq( ratioSet.SchedValue, SchedValue ) ) continue;
+			DifShdgRatioIsoSkyHRTS( iTimeStep, iHour, {1,TotSurfaces} ) = ratioSet.IsoSky;
+			DifShdgRatioHorizHRTS( iTimeStep, iHour, {1,TotSurfaces} ) = ratioSet.Horiz;
+			return;
+		}
+
+		WithShdgIsoSky = 0.;
+		WoShdgIsoSky = 0.;
+		WithShdgHoriz = 0.;
+		WoShdgHoriz = 0.;
+
+		DPhi = PiOvr2 / NPhi; // 15 deg for NPhi = 6
+		DTheta = 2.0 * Pi / NTheta; // 15 deg for NTheta = 24
+		DThetaDPhi = DTheta * DPhi;
+		PhiMin = 0.5 * DPhi; // 7.5 deg for DPhi = 15 deg
+
+		for ( IPhi = 1; IPhi <= NPhi; ++IPhi ) { // Loop over patch altitude values
+			Phi = PhiMin + ( IPhi - 1 ) * DPhi; // 7.5,22.5,37.5,52.5,67.5,82.5 for NPhi = 6
+			SUNCOS( 3 ) = std::sin( Phi );
+			CosPhi = std::cos(Phi);
+
+			for ( ITheta = 1; ITheta <= NTheta; ++ITheta ) { // Loop over patch azimuth values
+				Theta = ( ITheta - 1 ) * DTheta; // 0,15,30,....,330,345 for NTheta = 24
+				SUNCOS( 1 ) = CosPhi * std::cos( Theta );
+				SUNCOS( 2 ) = CosPhi * std::sin( Theta );
+
+				for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+					if ( !Surface( SurfNum ).ShadowingSurf && !Surface( SurfNum ).HeatTransSurf ) continue;
+					CTHETA( SurfNum ) = SUNCOS( 1 ) * Surface( SurfNum ).OutNormVec( 1 ) + SUNCOS( 2 ) * Surface( SurfNum ).OutNormVec( 2 ) + SUNCOS( 3 ) * Surface( SurfNum ).OutNormVec( 3 );
 				}
-			}
 
-			//  ! Get IR view factors. An exterior surface can receive IR radiation from
-			//  ! sky, ground or shadowing surfaces. Assume shadowing surfaces have same
-			//  ! temperature as outside air (and therefore same temperature as ground),
-			//  ! so that the view factor to these shadowing surfaces can be included in
-			//  ! the ground view factor. Sky IR is assumed to be isotropic and shadowing
-			//  ! surfaces are assumed to be opaque to IR so they totally "shade" IR from
-			//  ! sky or ground.
+				SHADOW( iHour, iTimeStep ); // Determine sunlit areas and solar multipliers for all surfaces.
+
+				for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 
-			//  DO SurfNum = 1,TotSurfaces
-			//    Surface(SurfNum)%ViewFactorSkyIR = Surface(SurfNum)%ViewFactorSkyIR * DifShdgRatioIsoSky(SurfNum,IHOUR,TS)
-			//    Surface(SurfNum)%ViewFactorGroundIR = 1.0 - Surface(SurfNum)%ViewFactorSkyIR
-			//  END DO
+					if ( !Surface( SurfNum ).ShadowingSurf && ( !Surface( SurfNum ).HeatTransSurf || !Surface( SurfNum ).ExtSolar || ( Surface( SurfNum ).ExtBoundCond != ExternalEnvironment && Surface( SurfNum ).ExtBoundCond != OtherSideCondModeledExt ) ) ) continue;
 
-		} // test for shading surfaces
+					if ( CTHETA( SurfNum ) < 0.0 ) continue;
+
+					Fac1WoShdg = CosPhi * DThetaDPhi * CTHETA( SurfNum );
+					SurfArea = Surface( SurfNum ).NetAreaShadowCalc;
+					if ( SurfArea > Eps ) {
+						FracIlluminated = SAREA( SurfNum ) / SurfArea;
+					} else {
+						FracIlluminated = SAREA( SurfNum ) / ( SurfArea + Eps );
+					}
+					Fac1WithShdg = Fac1WoShdg * FracIlluminated;
+					WithShdgIsoSky( SurfNum ) += Fac1WithShdg;
+					WoShdgIsoSky( SurfNum ) += Fac1WoShdg;
+
+					// Horizon region
+					if ( IPhi == 1 ) {
+						WithShdgHoriz( SurfNum ) += Fac1WithShdg;
+						WoShdgHoriz( SurfNum ) += Fac1WoShdg;
+					}
+				} // End of surface loop
+			} // End of Theta loop
+		} // End of Phi loop
 
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
-			// For exterior windows with frame/divider that are partially or fully sunlit,
-			// correct SunlitFrac due to shadowing of frame and divider projections onto window glass.
-			// Note: if SunlitFrac = 0.0 the window is either completely shaded or the sun is in back
-			// of the window; in either case, frame/divider shadowing doesn't have to be done.
 
-			if ( Surface( SurfNum ).Class == SurfaceClass_Window && Surface( SurfNum ).ExtBoundCond == ExternalEnvironment && SunlitFrac( iTimeStep, iHour, SurfNum ) > 0.0 && Surface( SurfNum ).FrameDivider > 0 ) CalcFrameDividerShadow( SurfNum, Surface( SurfNum ).FrameDivider, iHour );
+			if ( ! Surface( SurfNum ).ShadowingSurf && ( ! Surface( SurfNum ).HeatTransSurf || ! Surface( SurfNum ).ExtSolar || ( Surface( SurfNum ).ExtBoundCond != ExternalEnvironment && Surface( SurfNum ).ExtBoundCond != OtherSideCondModeledExt ) ) ) continue;
+
+			if ( std::abs( WoShdgIsoSky( SurfNum ) ) > Eps ) {
+				DifShdgRatioIsoSkyHRTS( iTimeStep, iHour, SurfNum ) = ( WithShdgIsoSky( SurfNum ) ) / ( WoShdgIsoSky( SurfNum ) );
+			} else {
+				DifShdgRatioIsoSkyHRTS( iTimeStep, iHour, SurfNum ) = ( WithShdgIsoSky( SurfNum ) ) / ( WoShdgIsoSky( SurfNum ) + Eps );
+			}
+			if ( std::abs( WoShdgHoriz( SurfNum ) ) > Eps ) {
+				DifShdgRatioHorizHRTS( iTimeStep, iHour, SurfNum ) = ( WithShdgHoriz( SurfNum ) ) / ( WoShdgHoriz( SurfNum ) );
+			} else {
+				DifShdgRatioHorizHRTS( iTimeStep, iHour, SurfNum ) = ( WithShdgHoriz( SurfNum ) ) / ( WoShdgHoriz( SurfNum ) + Eps );
+			}
+		}
+
+		//  ! Get IR view factors. An exterior surface can receive IR radiation from
+		//  ! sky, ground or shadowing surfaces. Assume shadowing surfaces have same
+		//  ! temperature as outside air (and therefore same temperature as ground),
+		//  ! so that the view factor to these shadowing surfaces can be included in
+		//  ! the ground view factor. Sky IR is assumed to be isotropic and shadowing
+		//  ! surfaces are assumed to be opaque to IR so they totally "shade" IR from
+		//  ! sky or ground.
+
+		//  DO SurfNum = 1,TotSurfaces
+		//    Surface(SurfNum)%ViewFactorSkyIR = Surface(SurfNum)%ViewFactorSkyIR * DifShdgRatioIsoSky(SurfNum,IHOUR,TS)
+		//    Surface(SurfNum)%ViewFactorGroundIR = 1.0 - Surface(SurfNum)%ViewFactorSkyIR
+		//  END DO
+
+		// Keep the ratios for later time steps with the same transmittances
+		if ( NumSkyDifShdgRatioSets < MaxSkyDifShdgRatioSets ) {
+			SkyDifShdgRatioSets.redimension( ++NumSkyDifShdgRatioSets );
+			auto & ratioSet( SkyDifShdgRatioSets( NumSkyDifShdgRatioSets ) );
+			ratioSet.SchedValue = SchedValue;
+			ratioSet.IsoSky = DifShdgRatioIsoSkyHRTS( iTimeStep, iHour, {1,TotSurfaces} );
+			ratioSet.Horiz = DifShdgRatioHorizHRTS( iTimeStep, iHour, {1,TotSurfaces} );
 		}
 
 	}
@@ -3826,9 +4051,6 @@ namespace SolarShading {
 		Array1D_int GSS; // List of shadowing surfaces numbers for a receiving surface
 		Array1D_int BKS; // List of back surface numbers for a receiving surface
 		Array1D_int SBS; // List of subsurfaces for a receiving surface
-		static int MaxGSS( 50 ); // Current Max for GSS array
-		static int MaxBKS( 50 ); // Current Max for BKS array
-		static int MaxSBS( 50 ); // Current Max for SBS array
 		bool CannotShade; // TRUE if subsurface cannot shade receiving surface
 		bool HasWindow; // TRUE if a window is present on receiving surface
 		Real64 ZMIN; // Lowest point on the receiving surface
@@ -3843,7 +4065,6 @@ namespace SolarShading {
 		bool ShadowingSurf; // True if a receiving surface is a shadowing surface
 		Array1D_bool CastingSurface; // tracking during setup of ShadowComb
 
-		static int MaxDim( 0 );
 
 #ifdef EP_Count_Calls
 		++NumDetShadowCombs_Calls;
@@ -4157,10 +4378,6 @@ namespace SolarShading {
 		int NGRS; // Coordinate transformation index
 		int NZ; // Zone Number of surface
 		int NVT;
-		static Array1D< Real64 > XVT; // X Vertices of Shadows
-		static Array1D< Real64 > YVT; // Y vertices of Shadows
-		static Array1D< Real64 > ZVT; // Z vertices of Shadows
-		static bool OneTimeFlag( true );
 		int HTS; // Heat transfer surface number of the general receiving surface
 		int GRSNR; // Surface number of general receiving surface
 		int NBKS; // Number of back surfaces
@@ -4169,14 +4386,14 @@ namespace SolarShading {
 		Real64 SurfArea; // Surface area. For walls, includes all window frame areas.
 		// For windows, includes divider area
 
-		if ( OneTimeFlag ) {
-			XVT.allocate( MaxVerticesPerSurface + 1 );
-			YVT.allocate( MaxVerticesPerSurface + 1 );
-			ZVT.allocate( MaxVerticesPerSurface + 1 );
-			XVT = 0.0;
-			YVT = 0.0;
-			ZVT = 0.0;
-			OneTimeFlag = false;
+		if ( SHADOWOneTimeFlag ) {
+			SHADOWXVT.allocate( MaxVerticesPerSurface + 1 );
+			SHADOWYVT.allocate( MaxVerticesPerSurface + 1 );
+			SHADOWZVT.allocate( MaxVerticesPerSurface + 1 );
+			SHADOWXVT = 0.0;
+			SHADOWYVT = 0.0;
+			SHADOWZVT = 0.0;
+			SHADOWOneTimeFlag = false;
 		}
 
 #ifdef EP_Count_Calls
@@ -4235,12 +4452,12 @@ namespace SolarShading {
 					YShadowProjection = 0.0;
 				}
 
-				CTRANS( GRSNR, NGRS, NVT, XVT, YVT, ZVT ); // Transform coordinates of the receiving surface to 2-D form
+				CTRANS( GRSNR, NGRS, NVT, SHADOWXVT, SHADOWYVT, SHADOWZVT ); // Transform coordinates of the receiving surface to 2-D form
 
 				// Re-order its vertices to clockwise sequential.
 				for ( N = 1; N <= NVT; ++N ) {
-					XVS( N ) = XVT( NVT + 1 - N );
-					YVS( N ) = YVT( NVT + 1 - N );
+					XVS( N ) = SHADOWXVT( NVT + 1 - N );
+					YVS( N ) = SHADOWYVT( NVT + 1 - N );
 				}
 
 				HTRANS1( 1, NVT ); // Transform to homogeneous coordinates.
@@ -4318,10 +4535,6 @@ namespace SolarShading {
 		int N;
 		int NVR;
 		int NVT; // Number of vertices of back surface
-		static Array1D< Real64 > XVT; // X,Y,Z coordinates of vertices of
-		static Array1D< Real64 > YVT; // back surfaces projected into system
-		static Array1D< Real64 > ZVT; // relative to receiving surface
-		static bool OneTimeFlag( true );
 		int BackSurfaceNumber;
 		int NS1; // Number of the figure being overlapped
 		int NS2; // Number of the figure doing overlapping
@@ -4332,14 +4545,14 @@ namespace SolarShading {
 		assert( equal_dimensions( HCX, HCY ) );
 		assert( equal_dimensions( HCX, HCA ) );
 
-		if ( OneTimeFlag ) {
-			XVT.allocate( MaxVerticesPerSurface + 1 );
-			YVT.allocate( MaxVerticesPerSurface + 1 );
-			ZVT.allocate( MaxVerticesPerSurface + 1 );
-			XVT = 0.0;
-			YVT = 0.0;
-			ZVT = 0.0;
-			OneTimeFlag = false;
+		if ( SHDBKSOneTimeFlag ) {
+			SHDBKSXVT.allocate( MaxVerticesPerSurface + 1 );
+			SHDBKSYVT.allocate( MaxVerticesPerSurface + 1 );
+			SHDBKSZVT.allocate( MaxVerticesPerSurface + 1 );
+			SHDBKSXVT = 0.0;
+			SHDBKSYVT = 0.0;
+			SHDBKSZVT = 0.0;
+			SHDBKSOneTimeFlag = false;
 		}
 
 		if ( ( NBKS <= 0 ) || ( SAREA( HTS ) <= 0.0 ) || ( OverlapStatus == TooManyVertices ) || ( OverlapStatus == TooManyFigures ) ) return;
@@ -4356,14 +4569,14 @@ namespace SolarShading {
 			// Transform coordinates of back surface from general system to the
 			// plane of the receiving surface
 
-			CTRANS( BackSurfaceNumber, NGRS, NVT, XVT, YVT, ZVT );
+			CTRANS( BackSurfaceNumber, NGRS, NVT, SHDBKSXVT, SHDBKSYVT, SHDBKSZVT );
 
 			// Project "shadow" from back surface along sun's rays to receiving surface.  Back surface vertices
 			// become clockwise sequential.
 
 			for ( N = 1; N <= NVT; ++N ) {
-				XVS( N ) = XVT( N ) - XShadowProjection * ZVT( N );
-				YVS( N ) = YVT( N ) - YShadowProjection * ZVT( N );
+				XVS( N ) = SHDBKSXVT( N ) - XShadowProjection * SHDBKSZVT( N );
+				YVS( N ) = SHDBKSYVT( N ) - YShadowProjection * SHDBKSZVT( N );
 			}
 
 			// Transform to the homogeneous coordinate system.
@@ -4461,20 +4674,16 @@ namespace SolarShading {
 		int GSSNR; // General shadowing surface number
 		int MainOverlapStatus; // Overlap status of the main overlap calculation not the check for
 		// multiple overlaps (unless there was an error)
-		static Array1D< Real64 > XVT;
-		static Array1D< Real64 > YVT;
-		static Array1D< Real64 > ZVT;
-		static bool OneTimeFlag( true );
 		int NS1; // Number of the figure being overlapped
 		int NS2; // Number of the figure doing overlapping
 		int NS3; // Location to place results of overlap
 		Real64 SchValue; // Value for Schedule of shading transmittence
 
-		if ( OneTimeFlag ) {
-			XVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
-			YVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
-			ZVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
-			OneTimeFlag = false;
+		if ( SHDGSSOneTimeFlag ) {
+			SHDGSSXVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
+			SHDGSSYVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
+			SHDGSSZVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
+			SHDGSSOneTimeFlag = false;
 		}
 
 		FGSSHC = LOCHCA + 1;
@@ -4538,8 +4747,8 @@ namespace SolarShading {
 				} else {
 					// Transform coordinates of shadow casting surface from general system to the system relative to the receiving surface
 					int NVT;
-					CTRANS( GSSNR, NGRS, NVT, XVT, YVT, ZVT );
-					CLIP( NVT, XVT, YVT, ZVT ); // Clip portions of the shadow casting surface which are behind the receiving surface
+					CTRANS( GSSNR, NGRS, NVT, SHDGSSXVT, SHDGSSYVT, SHDGSSZVT );
+					CLIP( NVT, SHDGSSXVT, SHDGSSYVT, SHDGSSZVT ); // Clip portions of the shadow casting surface which are behind the receiving surface
 
 					if ( NumVertInShadowOrClippedSurface <= 2 ) continue;
 
@@ -4920,9 +5129,7 @@ namespace SolarShading {
 		Real64 SwitchFacBack; // Switching factor for a window that is a back surface
 		Real64 TransBeamWin; // Beam solar transmittance of a window
 		Real64 TransBeamWinSh; // Beam solar transmittance of a shaded window
-		static Array1D< Real64 > AbsBeamWin; // Glass layer beam solar absorptance of a window
 		Real64 AbsBeamWinSh; // Glass layer beam solar absorptance of a shaded window
-		static Array1D< Real64 > AbsBeamWinEQL( CFSMAXNL+1 ); // layers beam solar absorptance of a window
 		Real64 AbsBeamTotWin; // Sum of window glass layer beam solar absorptances
 		Real64 ProfAng; // Window solar profile angle (radians)
 		Real64 ProfAngBack; // Back window solar profile angle (radians)
@@ -5123,17 +5330,11 @@ namespace SolarShading {
 		//   reflected from obstruction (W/m2)
 		Real64 GndSolarInc; // Incident solar radiation on a window from the ground (W/m2)
 
-		static Array1D< Real64 > ExtBeamAbsByShadFac; // Factor for exterior beam radiation absorbed by shade
 		// (1/m2) (absorbed radation = beam incident * ExtBeamAbsByShad
-		static Array1D< Real64 > IntBeamAbsByShadFac; // Like ExtBeamAbsByShadFac, but for interior beam radiation.
-		static Array1D< Real64 > WinTransBmSolar; // Factor for exterior beam solar transmitted through window,
 		// or window plus shade, into zone at current time (m2)
-		static Array1D< Real64 > WinTransDifSolar; // Factor for exterior diffuse solar transmitted through window,
 		// or window plus shade, into zone at current time (m2)
 
-		static Array1D< Real64 > WinTransDifSolarGnd; // Factor for exterior ground diffuse solar transmitted through
 		// window with horizontally-slatted blind into zone at current time (m2)
-		static Array1D< Real64 > WinTransDifSolarSky; // Factor for exterior sky diffuse solar transmitted through
 		// window with horizontally-slatted blind into zone at current time (m2)
 		/////////// hoisted into namespace renamed to ////////////
 		//static bool MustAlloc( true ); // True when local arrays must be allocated
@@ -5162,22 +5363,15 @@ namespace SolarShading {
 		int BackSurfaceNumber; // Back surface number
 		Array1D< Real64 > CFBoverlap; // Sum of boverlap for each back surface
 		Array2D< Real64 > CFDirBoverlap; // Directional boverlap (Direction, IBack)
-		Real64 CurLambda; // Current lambda value in BSDF outgoing directions
-		Real64 DirTrans; // Current BSDF directional transmittance
-		// (for incoming I and outgoing J directions)
 		Real64 bestDot; // complex fenestration hits other complex fenestration, it is important to find
 		// matching beam directions.  Beam leving one window will have certaing number for it's basis
 		// while same beam reaching back surface will have different beam number.  This value is used
 		// to keep best matching dot product for those directions
 		Real64 curDot; // temporary variable for current dot product
-		int bestTrn; // Direction corresponding best dot product for master window
 		int bestBackTrn; // Direction corresponding best dot product for back surface window
 		int TotSolidLay; // Number of window solid layers
 
-		static Array2D< Real64 > AbsSolBeamEQL( 2, CFSMAXNL+1 ); // absorbed exterior beam radiation by layers fraction
-		static Array2D< Real64 > AbsSolDiffEQL( 2, CFSMAXNL+1 ); // absorbed exterior diffuse radiation by layers fraction
 		int EQLNum; // equivalent layer fenestration index
-		static Array2D< Real64 > AbsSolBeamBackEQL( 2, CFSMAXNL+1 ); // absorbed interior beam radiation by layers fraction from back
 		//Array2D< Real64 > AbsSolDiffBackEQL( CFSMAXNL+1, 2 ); // absorbed exterior diffuse radiation by layers fraction from back //Unused
 
 		// scheduled surface gains local variables
@@ -6571,28 +6765,24 @@ namespace SolarShading {
 								// Note that it is organized by base surface
 								NBkSurf = ShadowComb( BaseSurf ).NumBackSurf;
 
+								auto & complexGeom( ComplexWind( SurfNum ).Geom( CurCplxFenState ) );
+								int const NTrn( complexGeom.Trn.NBasis );
+
 								if ( ! allocated( CFBoverlap ) ) {
 									CFBoverlap.allocate( NBkSurf );
 								}
 
 								if ( ! allocated( CFDirBoverlap ) ) {
-									CFDirBoverlap.allocate( NBkSurf, ComplexWind( SurfNum ).Geom( CurCplxFenState ).Trn.NBasis );
+									CFDirBoverlap.allocate( NBkSurf, NTrn );
 								}
 
-								CFBoverlap = 0.0;
 								// delete values from previous timestep
 								AWinCFOverlap = 0.0;
 
-								// Calculate effects on all back surfaces for each of basis directions.  Each of basis directions from the back of the
-								// window has to be considered as beam and therefore calcualte CFBoverlap for each of them
-								for ( CurTrnDir = 1; CurTrnDir <= ComplexWind( SurfNum ).Geom( CurCplxFenState ).Trn.NBasis; ++CurTrnDir ) {
-									CurLambda = ComplexWind( SurfNum ).Geom( CurCplxFenState ).Trn.Lamda( CurTrnDir );
-									DirTrans = Construct( IConst ).BSDFInput.SolFrtTrans( IBm, CurTrnDir );
-									// Now calculate effect of this direction on all back surfaces
-									for ( IBack = 1; IBack <= NBkSurf; ++IBack ) {
-										CFDirBoverlap( IBack, CurTrnDir ) = ComplexWind( SurfNum ).Geom( CurCplxFenState ).AOverlap( IBack, CurTrnDir ) * DirTrans * CurLambda * CosInc;
-										CFBoverlap( IBack ) += CFDirBoverlap( IBack, CurTrnDir );
-									} // DO IBack = 1,MaxBkSurf
+								// Effects on all back surfaces summed over the basis directions from the back of the window, each of them
+								// considered as beam; the sums for each sun direction were made by CalcComplexWindowOverlapProducts
+								for ( IBack = 1; IBack <= NBkSurf; ++IBack ) {
+									CFBoverlap( IBack ) = complexGeom.SolBmBkSurfOverlap( IBm, IBack ) * CosInc;
 								}
 
 								// Summarizing results
@@ -6612,24 +6802,41 @@ namespace SolarShading {
 											FenSolAbsPtr = WindowScheduledSolarAbs( BackSurfaceNumber, ConstrNumBack );
 
 											if ( FenSolAbsPtr == 0 ) {
-												// Calculate energy loss per each outgoing orientation
-												for ( CurTrnDir = 1; CurTrnDir <= ComplexWind( SurfNum ).Geom( CurCplxFenState ).Trn.NBasis; ++CurTrnDir ) {
-													for ( CurBackDir = 1; CurBackDir <= ComplexWind( BackSurfaceNumber ).Geom( CurBackState ).Trn.NBasis; ++CurBackDir ) {
-														// Purpose of this part is to find best match for outgoing beam number of window back surface and incoming beam
-														// number of complex fenestration which this beam will hit on (back surface again)
-														curDot = dot( ComplexWind( SurfNum ).Geom( CurCplxFenState ).sTrn( CurTrnDir ), ComplexWind( BackSurfaceNumber ).Geom( CurBackState ).sTrn( CurBackDir ) );
-														if ( CurBackDir == 1 ) {
-															bestDot = curDot;
-															bestTrn = CurTrnDir;
-															bestBackTrn = CurBackDir;
-														} else {
-															if ( curDot < bestDot ) {
+												// Beam in each outgoing direction that reaches this back surface; rows of AOverlapLamda and of the
+												// transmittance matrix are contiguous in the outgoing direction
+												auto const & SolFrtTrans( Construct( IConst ).BSDFInput.SolFrtTrans );
+												std::size_t const lOverlap( complexGeom.AOverlapLamda.index( IBack, 1 ) ); // Linear index for ( IBack, 1 )
+												std::size_t const lTrans( SolFrtTrans.index( IBm, 1 ) ); // Linear index for ( IBm, 1 )
+												std::size_t const lDir( CFDirBoverlap.index( IBack, 1 ) ); // Linear index for ( IBack, 1 )
+												for ( int IRay = 0; IRay < NTrn; ++IRay ) {
+													CFDirBoverlap[ lDir + IRay ] = complexGeom.AOverlapLamda[ lOverlap + IRay ] * SolFrtTrans[ lTrans + IRay ] * CosInc;
+												}
+
+												// Purpose of this part is to find best match for outgoing beam number of window back surface and incoming beam
+												// number of complex fenestration which this beam will hit on (back surface again).  It depends only on the
+												// states of the two windows, so it is searched again only if the state of the back window has changed
+												if ( complexGeom.BkSurfBestTrnState( IBack ) != CurBackState ) {
+													for ( CurTrnDir = 1; CurTrnDir <= NTrn; ++CurTrnDir ) {
+														for ( CurBackDir = 1; CurBackDir <= ComplexWind( BackSurfaceNumber ).Geom( CurBackState ).Trn.NBasis; ++CurBackDir ) {
+															curDot = dot( complexGeom.sTrn( CurTrnDir ), ComplexWind( BackSurfaceNumber ).Geom( CurBackState ).sTrn( CurBackDir ) );
+															if ( CurBackDir == 1 ) {
 																bestDot = curDot;
-																bestTrn = CurTrnDir;
 																bestBackTrn = CurBackDir;
+															} else {
+																if ( curDot < bestDot ) {
+																	bestDot = curDot;
+																	bestBackTrn = CurBackDir;
+																}
 															}
 														}
+														complexGeom.BkSurfBestTrn( IBack, CurTrnDir ) = bestBackTrn;
 													}
+													complexGeom.BkSurfBestTrnState( IBack ) = CurBackState;
+												}
+
+												// Calculate energy loss per each outgoing orientation
+												for ( CurTrnDir = 1; CurTrnDir <= NTrn; ++CurTrnDir ) {
+													bestBackTrn = complexGeom.BkSurfBestTrn( IBack, CurTrnDir );
 													// CurLambda = ComplexWind(BackSurfaceNumber)%Geom(CurBackState)%Trn%Lamda(CurTrnDir)
 													// Add influence of this exact direction to what stays in the zone.  It is important to note that
 													// this needs to be done for each outgoing direction
@@ -7882,10 +8089,6 @@ namespace SolarShading {
 		Real64 ThetaBase; // Intermediate slat angle variable (rad)
 		Real64 ThetaBlock1; // Slat angles that just block beam solar (rad)
 		Real64 ThetaBlock2;
-		static Real64 ThetaBig( 0.0 ); // Larger of ThetaBlock1 and ThetaBlock2 	//Autodesk Used uninitialized in some runs
-		static Real64 ThetaSmall( 0.0 ); // Smaller of ThetaBlock1 and ThetaBlock2 //Autodesk Used uninitialized in some runs
-		static Real64 ThetaMin( 0.0 ); // Minimum allowed slat angle, resp. (rad)  //Autodesk Used uninitialized in some runs
-		static Real64 ThetaMax( 0.0 ); // Maximum allowed slat angle, resp. (rad)  //Autodesk Used uninitialized in some runs
 
 		int IConst; // Construction
 
@@ -10735,9 +10938,6 @@ namespace SolarShading {
 		Real64 SdotZ; // temporary variable for manipulating .dot. product
 		int BackSurfaceNumber; // current back surface number
 		int NVT; // Number of vertices of back surface
-		static Array1D< Real64 > XVT; // X,Y,Z coordinates of vertices of
-		static Array1D< Real64 > YVT; // back surfaces projected into system
-		static Array1D< Real64 > ZVT; // relative to receiving surface
 		int NS1; // Number of the figure being overlapped
 		int NS2; // Number of the figure doing overlapping
 		int NS3; // Location to place results of overlap
@@ -10755,9 +10955,9 @@ namespace SolarShading {
 		Real64 TotAOverlap; // Total overlap area for given outgoing direction
 		Real64 TotARhoVisOverlap; // Total overlap area time reflectance for given outgoing direction
 
-		XVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
-		YVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
-		ZVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
+		CalcComplexWindowOverlapXVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
+		CalcComplexWindowOverlapYVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
+		CalcComplexWindowOverlapZVT.dimension( MaxVerticesPerSurface + 1, 0.0 );
 
 		Geom.AOverlap.dimension( Window.NBkSurf, Geom.Trn.NBasis, 0.0 );
 		Geom.ARhoVisOverlap.dimension( Window.NBkSurf, Geom.Trn.NBasis, 0.0 );
@@ -10770,14 +10970,14 @@ namespace SolarShading {
 		// Base surface contains current window surface (ISurf).
 		// Since that is case, below transformation should always return ZVT = 0.0
 		// for every possible transformation
-		CTRANS( ISurf, BaseSurf, NVT, XVT, YVT, ZVT );
+		CTRANS( ISurf, BaseSurf, NVT, CalcComplexWindowOverlapXVT, CalcComplexWindowOverlapYVT, CalcComplexWindowOverlapZVT );
 
 		// HTRANS routine is using coordinates stored in XVS and YVS in order to calculate
 		// surface area.  Since both projections are equal to zero, then simply
 		// compy these values into XVS and YVS arrays
 		for ( N = 1; N <= NVT; ++N ) {
-			XVS( N ) = XVT( N );
-			YVS( N ) = YVT( N );
+			XVS( N ) = CalcComplexWindowOverlapXVT( N );
+			YVS( N ) = CalcComplexWindowOverlapYVT( N );
 		}
 
 		// This calculates the area stored in XVS and YVS
@@ -10814,14 +11014,14 @@ namespace SolarShading {
 
 				// Transform coordinates of back surface from general system to the
 				// plane of the receiving surface
-				CTRANS( BackSurfaceNumber, BaseSurf, NVT, XVT, YVT, ZVT );
+				CTRANS( BackSurfaceNumber, BaseSurf, NVT, CalcComplexWindowOverlapXVT, CalcComplexWindowOverlapYVT, CalcComplexWindowOverlapZVT );
 
 				// Project "shadow" from back surface along sun's rays to receiving surface.  Back surface vertices
 				// become clockwise sequential.
 
 				for ( N = 1; N <= NVT; ++N ) {
-					XVS( N ) = XVT( N ) - XShadowProjection * ZVT( N );
-					YVS( N ) = YVT( N ) - YShadowProjection * ZVT( N );
+					XVS( N ) = CalcComplexWindowOverlapXVT( N ) - XShadowProjection * CalcComplexWindowOverlapZVT( N );
+					YVS( N ) = CalcComplexWindowOverlapYVT( N ) - YShadowProjection * CalcComplexWindowOverlapZVT( N );
 				}
 
 				// Transform to the homogeneous coordinate system.
@@ -10899,6 +11099,61 @@ namespace SolarShading {
 
 	}
 
+	void
+	CalcComplexWindowOverlapProducts(
+		BSDFGeomDescr & Geom, // State Geometry
+		int const IConst // Construction of the complex fenestration state
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Combines the overlap areas of the back surfaces with the basis lambda values and the solar
+		// transmittance matrix, so that the beam reaching each back surface is a table lookup per
+		// incident direction in CalcInteriorSolarDistribution instead of a sum over outgoing directions.
+
+		// METHODOLOGY EMPLOYED:
+		// Rows of AOverlapLamda and of the transmittance matrix are contiguous in the outgoing
+		// direction, so the products are accumulated over linear indices.
+
+		// REFERENCES:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int const NBkSurf( Geom.AOverlap.isize1() ); // Number of back surfaces
+		int const NTrn( Geom.Trn.NBasis ); // Number of outgoing directions
+		auto const & SolFrtTrans( Construct( IConst ).BSDFInput.SolFrtTrans );
+
+		Geom.AOverlapLamda.dimension( NBkSurf, NTrn );
+		for ( int IBack = 1; IBack <= NBkSurf; ++IBack ) {
+			for ( int IRay = 1; IRay <= NTrn; ++IRay ) {
+				Geom.AOverlapLamda( IBack, IRay ) = Geom.AOverlap( IBack, IRay ) * Geom.Trn.Lamda( IRay );
+			}
+		}
+
+		Geom.SolBmBkSurfOverlap.dimension( Geom.Inc.NBasis, NBkSurf, 0.0 );
+		for ( int IBm = 1; IBm <= Geom.Inc.NBasis; ++IBm ) {
+			std::size_t const lTrans( SolFrtTrans.index( IBm, 1 ) ); // Linear index for ( IBm, 1 )
+			for ( int IBack = 1; IBack <= NBkSurf; ++IBack ) {
+				std::size_t const lOverlap( Geom.AOverlapLamda.index( IBack, 1 ) ); // Linear index for ( IBack, 1 )
+				Real64 Sum( 0.0 );
+				for ( int IRay = 0; IRay < NTrn; ++IRay ) {
+					Sum += Geom.AOverlapLamda[ lOverlap + IRay ] * SolFrtTrans[ lTrans + IRay ];
+				}
+				Geom.SolBmBkSurfOverlap( IBm, IBack ) = Sum;
+			}
+		}
+
+		// Best matching outgoing directions of back complex fenestrations are found on first use
+		Geom.BkSurfBestTrn.dimension( NBkSurf, NTrn, 0 );
+		Geom.BkSurfBestTrnState.dimension( NBkSurf, 0 );
+
+	}
+
 	void
 	TimestepInitComplexFenestration()
 	{
@@ -10939,6 +11194,7 @@ namespace SolarShading {
 					// do initialization only once
 					if ( ComplexWind( iSurf ).Geom( iState ).InitState ) {
 						CalcComplexWindowOverlap( ComplexWind( iSurf ).Geom( iState ), ComplexWind( iSurf ), iSurf );
+						CalcComplexWindowOverlapProducts( ComplexWind( iSurf ).Geom( iState ), SurfaceWindow( iSurf ).ComplexFen.State( iState ).Konst );
 						ComplexWind( iSurf ).Geom( iState ).InitState = false;
 					}
 				}
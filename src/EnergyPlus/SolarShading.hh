@@ -176,6 +176,14 @@ namespace SolarShading {
 	extern Array1D< Real64 > XTEMP1; // Temporary 'X' values for HC vertices of the overlap
 	extern Array1D< Real64 > YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
 	extern int maxNumberOfFigures;
+	extern int const MaxSkyDifShdgRatioSets; // Maximum number of transmittance states whose sky diffuse shading ratios are kept
+	extern int NumSkyDifShdgRatioSets; // Number of transmittance states whose sky diffuse shading ratios are kept
+	extern Array1D_int SkyDifShdgSchedSurfs; // Shadowing surfaces with a transmittance schedule
+	extern Array1D_int AnisoSkySurfs; // Surfaces receiving exterior solar, in the order of the arrays below
+	extern Array1D< Real64 > AnisoSkyNormX; // X component of the outward normal of each AnisoSkySurfs surface
+	extern Array1D< Real64 > AnisoSkyNormY; // Y component of the outward normal of each AnisoSkySurfs surface
+	extern Array1D< Real64 > AnisoSkyNormZ; // Z component of the outward normal of each AnisoSkySurfs surface
+	extern Array1D< Real64 > AnisoSkyCosInc; // Cosine of incidence angle of beam solar on each AnisoSkySurfs surface
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SolarShading
 
@@ -197,10 +205,19 @@ namespace SolarShading {
 
 	};
 
+	struct SkyDifShdgRatioSet
+	{
+		// Members
+		Array1D< Real64 > SchedValue; // Hourly and time step transmittance of each scheduled shadowing surface
+		Array1D< Real64 > IsoSky; // Sky diffuse shading ratio of each surface for these transmittances
+		Array1D< Real64 > Horiz; // Horizon shading ratio of each surface for these transmittances
+	};
+
 	// Object Data
 	extern Array1D< SurfaceErrorTracking > TrackTooManyFigures;
 	extern Array1D< SurfaceErrorTracking > TrackTooManyVertices;
 	extern Array1D< SurfaceErrorTracking > TrackBaseSubSurround;
+	extern Array1D< SkyDifShdgRatioSet > SkyDifShdgRatioSets;
 
 	// Functions
 	void
@@ -359,6 +376,12 @@ namespace SolarShading {
 		int const iTimeStep
 	);
 
+	void
+	FigureSkyDifShdgRatiosAtTimestep(
+		int const iHour,
+		int const iTimeStep
+	);
+
 	void
 	DetermineShadowingCombinations();
 
@@ -494,6 +517,12 @@ namespace SolarShading {
 		int const ISurf // Surface number of the complex fenestration
 	);
 
+	void
+	CalcComplexWindowOverlapProducts(
+		BSDFGeomDescr & Geom, // State Geometry
+		int const IConst // Construction of the complex fenestration state
+	);
+
 	void
 	TimestepInitComplexFenestration();
 
@@ -132,6 +132,16 @@ namespace SplitterComponent {
 	// MODULE SUBROUTINES:
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetSplitterInputErrorsFound( false );
+		bool MyEnvrnFlag( true );
+	}
+
 	// Functions
 	void
 	clear_state()
@@ -140,6 +150,8 @@ namespace SplitterComponent {
 		NumSplitters = 0;
 		CheckEquipName.deallocate();
 		SplitterCond.deallocate();
+		GetSplitterInputErrorsFound = false;
+		MyEnvrnFlag = true;
 	}
 
 	void
@@ -280,7 +292,6 @@ namespace SplitterComponent {
 		int NumNums;
 		int NodeNum;
 		int IOStat;
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int NumParams;
@@ -319,11 +330,11 @@ namespace SplitterComponent {
 			IsBlank = false;
 			VerifyName( AlphArray( 1 ), SplitterCond, &SplitterConditions::SplitterName, SplitterNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetSplitterInputErrorsFound = true;
 				if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 			}
 			SplitterCond( SplitterNum ).SplitterName = AlphArray( 1 );
-			SplitterCond( SplitterNum ).InletNode = GetOnlySingleNode( AlphArray( 2 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			SplitterCond( SplitterNum ).InletNode = GetOnlySingleNode( AlphArray( 2 ), GetSplitterInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
 			SplitterCond( SplitterNum ).NumOutletNodes = NumAlphas - 2;
 
 			SplitterCond( SplitterNum ).OutletNode.allocate( SplitterCond( SplitterNum ).NumOutletNodes );
@@ -341,10 +352,10 @@ namespace SplitterComponent {
 
 			for ( NodeNum = 1; NodeNum <= SplitterCond( SplitterNum ).NumOutletNodes; ++NodeNum ) {
 
-				SplitterCond( SplitterNum ).OutletNode( NodeNum ) = GetOnlySingleNode( AlphArray( 2 + NodeNum ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+				SplitterCond( SplitterNum ).OutletNode( NodeNum ) = GetOnlySingleNode( AlphArray( 2 + NodeNum ), GetSplitterInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 				if ( lAlphaBlanks( 2 + NodeNum ) ) {
 					ShowSevereError( cAlphaFields( 2 + NodeNum ) + " is Blank, " + CurrentModuleObject + " = " + AlphArray( 1 ) );
-					ErrorsFound = true;
+					GetSplitterInputErrorsFound = true;
 				}
 			}
 
@@ -358,7 +369,7 @@ namespace SplitterComponent {
 				ShowSevereError( CurrentModuleObject + " = " + SplitterCond( SplitterNum ).SplitterName + " specifies an outlet node name the same as the inlet node." );
 				ShowContinueError( ".." + cAlphaFields( 2 ) + '=' + NodeID( NodeNum ) );
 				ShowContinueError( "..Outlet Node #" + TrimSigDigits( OutNodeNum1 ) + " is duplicate." );
-				ErrorsFound = true;
+				GetSplitterInputErrorsFound = true;
 			}
 			for ( OutNodeNum1 = 1; OutNodeNum1 <= SplitterCond( SplitterNum ).NumOutletNodes; ++OutNodeNum1 ) {
 				for ( OutNodeNum2 = OutNodeNum1 + 1; OutNodeNum2 <= SplitterCond( SplitterNum ).NumOutletNodes; ++OutNodeNum2 ) {
@@ -366,7 +377,7 @@ namespace SplitterComponent {
 					ShowSevereError( CurrentModuleObject + " = " + SplitterCond( SplitterNum ).SplitterName + " specifies duplicate outlet nodes in its outlet node list." );
 					ShowContinueError( "..Outlet Node #" + TrimSigDigits( OutNodeNum1 ) + " Name=" + NodeID( OutNodeNum1 ) );
 					ShowContinueError( "..Outlet Node #" + TrimSigDigits( OutNodeNum2 ) + " is duplicate." );
-					ErrorsFound = true;
+					GetSplitterInputErrorsFound = true;
 				}
 			}
 		}
@@ -378,7 +389,7 @@ namespace SplitterComponent {
 		cNumericFields.deallocate();
 		lNumericBlanks.deallocate();
 
-		if ( ErrorsFound ) {
+		if ( GetSplitterInputErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in getting input." );
 		}
 
@@ -438,7 +449,6 @@ namespace SplitterComponent {
 		int OutletNode;
 		int NodeNum;
 		Real64 AirEnthalpy; // [J/kg]
-		static bool MyEnvrnFlag( true );
 
 		// FLOW:
 
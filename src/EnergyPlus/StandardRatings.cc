@@ -203,8 +203,381 @@ namespace StandardRatings {
 	//35.0C( 95.0F ) 26.7C( 80.0F ) 18.3C( 65.0F ) 4.4C( 40.0F )
 	Array1D < Real64 > const OutdoorDBTempAllClassA2D( 4, { 35.0, 26.7, 18.3, 4.4 } );
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		Real64 AvailChillerCap( 0.0 ); // Chiller available capacity at current operating conditions [W]
+		Real64 EnteringWaterTempReduced( 0.0 ); // Entering Condenser Water Temperature at reduced conditions [C]
+		Real64 EnteringAirDryBulbTempReduced( 0.0 ); // Outdoor unit entering air dry-bulb temperature
+		Real64 EnteringAirWetBulbTempReduced( 0.0 ); // Outdoor unit entering air wet-bulb temperature
+		Real64 CondenserInletTemp( 0.0 ); // Entering Condenser Temperature at reduced conditions [C]
+		Real64 CondenserOutletTemp0( 0.0 ); // Lower bound for condenser outlet temperature [C]
+		Real64 CondenserOutletTemp1( 0.0 ); // Upper bound for condenser outlet temperature [C]
+		Real64 CalcChillerIPLVCondenserOutletTemp( 0.0 ); // Calculated condenser outlet temperature which corresponds
+		Real64 Cp( 0.0 ); // Water specific heat [J/(kg*C)]
+		Real64 Rho( 0.0 ); // Water density [kg/m3]
+		Real64 IPLV( 0.0 ); // Integerated Part Load Value in SI [W/W]
+		Real64 EIR( 0.0 ); // Inverse of COP at reduced capacity test conditions (100%, 75%, 50%, and 25%)
+		Real64 Power( 0.0 ); // Power at reduced capacity test conditions (100%, 75%, 50%, and 25%)
+		Real64 COPReduced( 0.0 ); // COP at reduced capacity test conditions (100%, 75%, 50%, and 25%)
+		Real64 LoadFactor( 0.0 ); // Fractional "on" time for last stage at the desired reduced capacity,
+		Real64 DegradationCoeff( 0.0 ); // Degradation coeficient, (dimenssionless)
+		Real64 ChillerCapFT( 0.0 ); // Chiller capacity fraction (evaluated as a function of temperature)
+		Real64 ChillerEIRFT( 0.0 ); // Chiller electric input ratio (EIR = 1 / COP) as a function of temperature
+		Real64 ChillerEIRFPLR( 0.0 ); // Chiller EIR as a function of part-load ratio (PLR)
+		Real64 PartLoadRatio( 0.0 ); // Part load ratio (PLR) at which chiller is operatign at reduced capacity
+		Real64 ReformEIRChillerCondInletTempResidualAvailChillerCap( 0.0 ); // Chiller available capacity at current operating conditions [W]
+		Real64 ReformEIRChillerCondInletTempResidualCondenserInletTemp( 0.0 ); // Calculated condenser inlet temperature [C]
+		Real64 EvapOutletTemp( 0.0 ); // Evaporator outlet temperature temperature [C]
+		Real64 QEvap( 0.0 ); // Rate of heat transfer to the evaporator coil [W]
+		Real64 QCond( 0.0 ); // Rate of heat transfer to the condenser coil [W]
+		Real64 ReformEIRChillerCondInletTempResidualPower( 0.0 ); // Power at reduced capacity test conditions (100%, 75%, 50%, and 25%)
+		Real64 ReformEIRChillerCapFT( 0.0 ); // Chiller capacity fraction (evaluated as a function of temperature)
+		Real64 ReformEIRChillerEIRFT( 0.0 ); // Chiller electric input ratio (EIR = 1 / COP) as a function of temperature
+		Real64 ReformEIRChillerEIRFPLR( 0.0 ); // Chiller EIR as a function of part-load ratio (PLR)
+		bool MyOneTimeFlag( true );
+		Real64 CapacityLWTempMin( 0.0 ); // Capacity modifier Min value (leaving water temp), from the Curve:BiQuadratic object
+		Real64 CapacityLWTempMax( 0.0 ); // Capacity modifier Max value (leaving water temp), from the Curve:BiQuadratic object
+		Real64 CapacityEnteringCondTempMin( 0.0 ); // Capacity modifier Min value (entering cond temp),
+		Real64 CapacityEnteringCondTempMax( 0.0 ); // Capacity modifier Max value (entering cond temp),
+		Real64 EIRLWTempMin( 0.0 ); // EIR modifier Min value (leaving water temp), from the Curve:BiQuadratic object
+		Real64 EIRLWTempMax( 0.0 ); // EIR modifier Max value (leaving water temp), from the Curve:BiQuadratic object
+		Real64 EIREnteringCondTempMin( 0.0 ); // EIR modifier Min value (entering cond temp),
+		Real64 EIREnteringCondTempMax( 0.0 ); // EIR modifier Max value (entering cond temp),
+		Real64 HighCondenserEnteringTempLimit( 0.0 ); // High limit of entering condenser temperature
+		Real64 LowCondenserEnteringTempLimit( 0.0 ); // Low limit of entering condenser temperature
+		bool CapCurveIPLVLimitsExceeded( false ); // Logical for capacity curve temperature limits being exceeded (IPLV calcs)
+		bool EIRCurveIPLVLimitsExceeded( false ); // Logical for EIR temperature limits being exceeded (IPLV calcs)
+		Real64 CalcDXCoilStandardRatingSEER( 0.0 ); // Seasonal Energy Efficiency Ratio in SI [W/W]
+		Real64 CalcDXCoilStandardRatingEER( 0.0 ); // Energy Efficiency Ratio in SI [W/W]
+		Real64 CalcDXCoilStandardRatingIEER( 0.0 ); // Integerated Energy Efficiency Ratio in SI [W/W]
+		Real64 CalcDXCoilStandardRatingHSPF( 0.0 ); // Heating Seasonal Performance Factor in SI [W/W]
+		Real64 CalcDXCoilStandardRatingNetHeatingCapRatedHighTemp( 0.0 ); // Net Rated heating capacity at high temp [W]
+		Real64 CalcDXCoilStandardRatingNetHeatingCapRatedLowTemp( 0.0 ); // Net Rated heating capacity at low temp [W]
+		Real64 TotalHeatingCapRated( 0.0 ); // Heating Coil capacity at Rated conditions, without accounting supply fan heat [W]
+		Real64 EIRRated( 0.0 ); // EIR at Rated conditions [-]
+		Real64 TotCapTempModFacRated( 0.0 ); // Total capacity as a function of temerature modifier at rated conditions [-]
+		Real64 EIRTempModFacRated( 0.0 ); // EIR as a function of temerature modifier at rated conditions [-]
+		Real64 TotalHeatingCapH2Test( 0.0 ); // Heating Coil capacity at H2 test conditions, without accounting supply fan heat [W]
+		Real64 TotalHeatingCapH3Test( 0.0 ); // Heating Coil capacity at H3 test conditions, without accounting supply fan heat [W]
+		Real64 CapTempModFacH2Test( 0.0 ); // Total capacity as a function of temerature modifier at H2 test conditions [-]
+		Real64 EIRTempModFacH2Test( 0.0 ); // EIR as a function of temerature modifier at H2 test conditions [-]
+		Real64 EIRH2Test( 0.0 ); // EIR at H2 test conditions [-]
+		Real64 CapTempModFacH3Test( 0.0 ); // Total capacity as a function of temerature modifier at H3 test conditions [-]
+		Real64 EIRTempModFacH3Test( 0.0 ); // EIR as a function of temerature modifier at H3 test conditions [-]
+		Real64 EIRH3Test( 0.0 ); // EIR at H3 test conditions [-]
+		Real64 TotCapFlowModFac( 0.0 ); // Total capacity modifier (function of actual supply air flow vs rated flow)
+		Real64 EIRFlowModFac( 0.0 ); // EIR modifier (function of actual supply air flow vs rated flow)
+		Real64 FanPowerPerEvapAirFlowRate( 0.0 ); // Fan power per air volume flow rate [W/(m3/s)]
+		Real64 LowTempCutOutFactor( 0.0 ); // Factor which corresponds to compressor operation depending on outdoor temperature
+		Real64 OATempCompressorOff( 0.0 ); // Minimum outdoor air temperature to turn the commpressor off, [C]
+		Real64 FractionalBinHours( 0.0 ); // Fractional bin hours for the heating season  [-]
+		Real64 BuildingLoad( 0.0 ); // Building space conditioning load corresponding to an outdoor bin temperature [W]
+		Real64 HeatingModeLoadFactor( 0.0 ); // Heating mode load factor corresponding to an outdoor bin temperature  [-]
+		Real64 NetHeatingCapReduced( 0.0 ); // Net Heating Coil capacity corresponding to an outdoor bin temperature [W]
+		Real64 TotalBuildingLoad( 0.0 ); // Sum of building load over the entire heating season [W]
+		Real64 TotalElectricalEnergy( 0.0 ); // Sum of electrical energy consumed by the heatpump over the heating season [W]
+		Real64 DemandDeforstCredit( 1.0 ); // A factor to adjust HSPF if coil has demand defrost control  [-]
+		Real64 CheckCOP( 0.0 ); // Checking COP at an outdoor bin temperature against unity [-]
+		Real64 DesignHeatingRequirement( 0.0 ); // The amount of heating required to maintain a given indoor temperature
+		Real64 DesignHeatingRequirementMin( 0.0 ); // minimum design heating requirement [W]
+		Real64 ElectricalPowerConsumption( 0.0 ); // Electrical power corresponding to an outdoor bin temperature [W]
+		Real64 HeatPumpElectricalEnergy( 0.0 ); // Heatpump electrical energy corresponding to an outdoor bin temperature [W]
+		Real64 TotalHeatPumpElectricalEnergy( 0.0 ); // Sum of Heatpump electrical energy over the entire heating season [W]
+		Real64 ResistiveSpaceHeatingElectricalEnergy( 0.0 ); // resistance heating electrical energy corresponding to an
+		Real64 TotalResistiveSpaceHeatingElectricalEnergy( 0.0 ); // Sum of resistance heating electrical energy over the
+		Real64 SingelSpeedDXCoolingCoilStandardRatingsTotCapFlowModFac( 0.0 ); // Total capacity modifier f(actual flow vs rated flow) for each speed [-]
+		Real64 SingelSpeedDXCoolingCoilStandardRatingsEIRFlowModFac( 0.0 ); // EIR modifier f(actual supply air flow vs rated flow) for each speed [-]
+		Real64 TotCapTempModFac( 0.0 ); // Total capacity modifier (function of entering wetbulb, outside drybulb) [-]
+		Real64 EIRTempModFac( 0.0 ); // EIR modifier (function of entering wetbulb, outside drybulb) [-]
+		Real64 TotCoolingCapAHRI( 0.0 ); // Total Cooling Coil capacity (gross) at AHRI test conditions [W]
+		Real64 NetCoolingCapAHRI( 0.0 ); // Net Cooling Coil capacity at AHRI TestB conditions, accounting for fan heat [W]
+		Real64 TotalElecPower( 0.0 ); // Net power consumption (Cond Fan+Compressor+Indoor Fan) at AHRI test conditions [W]
+		Real64 TotalElecPowerRated( 0.0 ); // Net power consumption (Cond Fan+Compressor+Indoor Fan) at Rated test conditions [W]
+		Real64 SingelSpeedDXCoolingCoilStandardRatingsEIR( 0.0 ); // Energy Efficiency Ratio at AHRI test conditions for SEER [-]
+		Real64 PartLoadFactor( 0.0 ); // Part load factor, accounts for thermal lag at compressor startup [-]
+		Real64 EERReduced( 0.0 ); // EER at reduced capacity test conditions (100%, 75%, 50%, and 25%)
+		Real64 ElecPowerReducedCap( 0.0 ); // Net power consumption (Cond Fan+Compressor) at reduced test condition [W]
+		Real64 NetCoolingCapReduced( 0.0 ); // Net Cooling Coil capacity at reduced conditions, accounting for supply fan heat [W]
+		Real64 SingelSpeedDXCoolingCoilStandardRatingsLoadFactor( 0.0 ); // Fractional "on" time for last stage at the desired reduced capacity, (dimensionless)
+		Real64 SingelSpeedDXCoolingCoilStandardRatingsDegradationCoeff( 0.0 ); // Degradation coeficient, (dimenssionless)
+		Real64 DXCoolingCoilDataCenterStandardRatingsTotCapFlowModFac( 0.0 ); // Total capacity modifier f(actual flow vs rated flow) for each speed [-]
+		Real64 DXCoolingCoilDataCenterStandardRatingsEIRFlowModFac( 0.0 ); // EIR modifier f(actual supply air flow vs rated flow) for each speed [-]
+		Real64 DXCoolingCoilDataCenterStandardRatingsTotCapTempModFac( 0.0 ); // Total capacity modifier (function of entering wetbulb, outside drybulb) [-]
+		Real64 DXCoolingCoilDataCenterStandardRatingsEIRTempModFac( 0.0 ); // EIR modifier (function of entering wetbulb, outside drybulb) [-]
+		Real64 TotCoolingCapRated( 0.0 ); // Total Cooling Coil capacity (gross) at one of the rated test conditions [W]
+		Real64 DXCoolingCoilDataCenterStandardRatingsEIR( 0.0 ); // Energy Efficiency Ratio at AHRI test conditions for SEER [-]
+		Real64 CoolingCapacityLS( 0.0 ); // cooling capacity of Mult-speed DX coil at lower speed, [W]
+		Real64 CoolingCapacityHS( 0.0 ); // cooling capacity of Mult-speed DX coil at higher speed, [W]
+		Real64 CoolingElecPowerLS( 0.0 ); // outdoor unit electric power input at low speed, [W]
+		Real64 CoolingElecPowerHS( 0.0 ); // outdoor unit electric power input at high speed, [W]
+		Real64 CoolingCapacityMax( 0.0 ); // cooling capacity of Mult-speed DX coil at max speed, [W]
+		Real64 CoolingElecPowerMax( 0.0 ); // outdoor unit electric power input at Max speed, [W]
+		Real64 MultiSpeedDXCoolingCoilStandardRatingsPartLoadRatio( 0.0 ); // compressor cycling ratio between successive speeds, [-]
+		Real64 PartLoadFraction( 0.0 ); // part-load fraction that account for the cyclic degradation, [-]
+		Real64 NetCoolingCapWeighted( 0.0 ); // net tot cooling cap weighted by the fraction of the binned cooling hours [W]
+		Real64 TotCoolingElecPowerWeighted( 0.0 ); // net total cooling electric power input weighted by the fraction of the
+		Real64 BuildingCoolingLoad( 0.0 ); // Building space cooling load corresponding to an outdoor bin temperature [W]
+		Real64 NetTotCoolCapBinned( 0.0 ); // Net tot cooling cap corresponding to an outdoor bin temperature [W]
+		Real64 TotCoolElecPowerBinned( 0.0 ); // Total cooling electric power corresponding to an outdoor bin temperature [W]
+		Real64 MultiSpeedDXCoolingCoilStandardRatingsLoadFactor( 0.0 ); // "on" time for last stage at the desired reduced capacity, (dimensionless)
+		Real64 TotCapTempModFacH0( 0.0 ); // Tot capacity modifier (function of entering wetbulb, outside drybulb) at H0 Test [-]
+		Real64 EIRTempModFacH0( 0.0 ); // EIR modifier (function of entering wetbulb, outside drybulb)  at H0 Test[-]
+		Real64 TotCapTempModFacH1( 0.0 ); // Tot capacity modifier (function of entering wetbulb, outside drybulb) at H1 Test [-]
+		Real64 EIRTempModFacH1( 0.0 ); // EIR modifier (function of entering wetbulb, outside drybulb)  at H1 Test[-]
+		Real64 TotCapTempModFacH2( 0.0 ); // Tot capacity modifier (function of entering wetbulb, outside drybulb) at H2 Test [-]
+		Real64 EIRTempModFacH2( 0.0 ); // EIR modifier (function of entering wetbulb, outside drybulb)  at H2 Test[-]
+		Real64 TotCapTempModFacH3( 0.0 ); // Tot capacity modifier (function of entering wetbulb, outside drybulb) at H3 Test [-]
+		Real64 EIRTempModFacH3( 0.0 ); // EIR modifier (function of entering wetbulb, outside drybulb)  at H3 Test[-]
+		Real64 MultiSpeedDXHeatingCoilStandardRatingsOATempCompressorOff( 0.0 ); // Minimum outdoor air temperature to turn the commpressor off
+		Real64 MultiSpeedDXHeatingCoilStandardRatingsPartLoadRatio( 0.0 ); // compressor cycling ratio between successive speeds, [-]
+		Real64 MultiSpeedDXHeatingCoilStandardRatingsPartLoadFraction( 0.0 ); // part-load fraction that account for the cyclic degradation, [-]
+		Real64 NetHeatingCapWeighted( 0.0 ); // net total heating cap weighted by the fraction of the binned cooling hours [W]
+		Real64 TotHeatingElecPowerWeighted( 0.0 ); // net total heat pump and resistance heating electric Energy input weighted by
+		Real64 BuildingHeatingLoad( 0.0 ); // Building space heating load corresponding to an outdoor bin temperature [W]
+		Real64 NetTotHeatCapBinned( 0.0 ); // Net tot heatinging cap corresponding to an outdoor bin temperature [W]
+		Real64 TotHeatElecPowerBinnedHP( 0.0 ); // Total Heat Pump heating electric power consumption at outdoor bin temp [W]
+		Real64 TotHeatElecPowerBinnedRH( 0.0 ); // Total Resistance heating electric power consumption at outdoor bin temp [W]
+		Real64 MultiSpeedDXHeatingCoilStandardRatingsLowTempCutOutFactor( 0.0 ); // Factor which corresponds to compressor operation depending on outdoor temperature
+		Real64 MultiSpeedDXHeatingCoilStandardRatingsFractionalBinHours( 0.0 ); // Fractional bin hours for the heating season  [-]
+		Real64 MultiSpeedDXHeatingCoilStandardRatingsDemandDeforstCredit( 1.0 ); // A factor to adjust HSPF if coil has demand defrost control  [-]
+		Real64 MultiSpeedDXHeatingCoilStandardRatingsDesignHeatingRequirement( 0.0 ); // The amount of heating required to maintain a given indoor temperature
+		Real64 MultiSpeedDXHeatingCoilStandardRatingsDesignHeatingRequirementMin( 0.0 ); // minimum design heating requirement [W]
+		Real64 DesignHeatingRequirementMax( 0.0 ); // maximum design heating requirement [W]
+		bool MyCoolOneTimeFlag( true );
+		bool MyHeatOneTimeFlag( true );
+		bool ReportDXCoolCoilDataCenterApplicationMyCoolOneTimeFlag( true );
+		std::string ClassName;
+		std::string CompNameNew;
+		Real64 CapacityWBTempMin( 0.0 ); // Capacity modifier Min value (wet bulb temperature), from the Curve:BiQuadratic object
+		Real64 CapacityWBTempMax( 0.0 ); // Capacity modifier Max value (wet bulb temperature), from the Curve:BiQuadratic object
+		Real64 CapacityDBTempMin( 0.0 ); // Capacity modifier Min value (dry bulb temperature), from the Curve:BiQuadratic object
+		Real64 CapacityDBTempMax( 0.0 ); // Capacity modifier Max value (dry bulb temperature), from the Curve:BiQuadratic object
+		Real64 EIRWBTempMin( 0.0 ); // EIR modifier Min value (wet bulb temperature), from the Curve:BiQuadratic object
+		Real64 EIRWBTempMax( 0.0 ); // EIR modifier Max value (wet bulb temperature), from the Curve:BiQuadratic object
+		Real64 EIRDBTempMin( 0.0 ); // EIR modifier Min value (dry bulb temperature), from the Curve:BiQuadratic object
+		Real64 EIRDBTempMax( 0.0 ); // EIR modifier Max value (dry bulb temperature), from the Curve:BiQuadratic object
+		Real64 PLFFPLRMin( 0.0 ); // Maximum value for Part Load Ratio, from the corresponding curve object
+		Real64 PLFFPLRMax( 0.0 ); // Minimum value for Part Load Ratio, from the corresponding curve object
+		Real64 CapacityFlowRatioMin( 0.0 ); // Minimum value for flow fraction, from the corresponding curve object
+		Real64 CapacityFlowRatioMax( 0.0 ); // Maximum value for flow fraction, from the corresponding curve object
+		Real64 EIRFlowRatioMin( 0.0 ); // Minimum value for flow fraction, from the corresponding curve object
+		Real64 EIRFlowRatioMax( 0.0 ); // Maximum value for flow fraction, from the corresponding curve object
+		Real64 HeatingCapODBTempMin( 0.0 ); // Capacity modifier Min value (outdoor dry bulb temperature)
+		Real64 HeatingCapODBTempMax( 0.0 ); // Capacity modifier Max value (outdoor dry bulb temperature)
+		Real64 HeatingCapIDBTempMin( 0.0 ); // Capacity modifier Min value (indoor dry bulb temperature)
+		Real64 HeatingCapIDBTempMax( 0.0 ); // Capacity modifier Max value (indoor dry bulb temperature)
+		Real64 HeatingEIRODBTempMin( 0.0 ); // EIR modifier Min value (outdoor dry bulb temperature)
+		Real64 HeatingEIRODBTempMax( 0.0 ); // EIR modifier Max value (outdoor dry bulb temperature)
+		Real64 HeatingEIRIDBTempMin( 0.0 ); // EIR modifier Min value (indoor dry bulb temperature)
+		Real64 HeatingEIRIDBTempMax( 0.0 ); // EIR modifier Max value (indoor dry bulb temperature)
+		bool CapCurveOATLimitsExceeded( false ); // Logical for capacity curve OD temp. limits being exceeded (low and High)
+		bool CapCurveHighOATLimitsExceeded( false ); // Logical for capacity curve temperature limits being exceeded (high temp)
+		bool CapCurveFlowLimitsExceeded( false ); // Logical for capacity curve flow fraction limits being exceeded
+		bool EIRCurveHighOATLimitsExceeded( false ); // Logical for EIR curve temperature limits being exceeded (high temp)
+		bool EIRCurveFlowLimitsExceeded( false ); // Logical for EIR curve flow fraction limits being exceeded
+		bool CapCurveMidOATLimitsExceeded( false ); // Logical for capacity curve temperature limits being exceeded (mid temp)
+		bool EIRCurveMidOATLimitsExceeded( false ); // Logical for EIR curve temperature limits being exceeded (mid temp)
+		bool CapCurveLowOATLimitsExceeded( false ); // Logical for capacity curve temperature limits being exceeded (low temp)
+		bool EIRCurveLowOATLimitsExceeded( false ); // Logical for EIR curve temperature limits being exceeded (Low temp)
+		bool PLFfPLRforSEERLimitsExceeded( false ); // Logical for PLF function of PLR limits being exceeded
+		bool CapCurveIEERLimitsExceeded( false ); // Logical for capacity curve temperature limits being exceeded (IEER calcs)
+		bool EIRCurveIEERLimitsExceeded( false ); // Logical for EIR temperature limits being exceeded (IEER calcs)
+		bool HeatingCapCurveHSPFLimitsExceeded( false ); // Logical for capacity curve temperature limits being exceeded
+		bool HeatingEIRCurveHSPFLimitsExceeded( false ); // Logical for EIR curve temperature limits being exceeded
+	}
+
 	// Functions
 
+	// Clears the global data in StandardRatings.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		AvailChillerCap = 0.0;
+		EnteringWaterTempReduced = 0.0;
+		EnteringAirDryBulbTempReduced = 0.0;
+		EnteringAirWetBulbTempReduced = 0.0;
+		CondenserInletTemp = 0.0;
+		CondenserOutletTemp0 = 0.0;
+		CondenserOutletTemp1 = 0.0;
+		CalcChillerIPLVCondenserOutletTemp = 0.0;
+		Cp = 0.0;
+		Rho = 0.0;
+		IPLV = 0.0;
+		EIR = 0.0;
+		Power = 0.0;
+		COPReduced = 0.0;
+		LoadFactor = 0.0;
+		DegradationCoeff = 0.0;
+		ChillerCapFT = 0.0;
+		ChillerEIRFT = 0.0;
+		ChillerEIRFPLR = 0.0;
+		PartLoadRatio = 0.0;
+		ReformEIRChillerCondInletTempResidualAvailChillerCap = 0.0;
+		ReformEIRChillerCondInletTempResidualCondenserInletTemp = 0.0;
+		EvapOutletTemp = 0.0;
+		QEvap = 0.0;
+		QCond = 0.0;
+		ReformEIRChillerCondInletTempResidualPower = 0.0;
+		ReformEIRChillerCapFT = 0.0;
+		ReformEIRChillerEIRFT = 0.0;
+		ReformEIRChillerEIRFPLR = 0.0;
+		MyOneTimeFlag = true;
+		CapacityLWTempMin = 0.0;
+		CapacityLWTempMax = 0.0;
+		CapacityEnteringCondTempMin = 0.0;
+		CapacityEnteringCondTempMax = 0.0;
+		EIRLWTempMin = 0.0;
+		EIRLWTempMax = 0.0;
+		EIREnteringCondTempMin = 0.0;
+		EIREnteringCondTempMax = 0.0;
+		HighCondenserEnteringTempLimit = 0.0;
+		LowCondenserEnteringTempLimit = 0.0;
+		CapCurveIPLVLimitsExceeded = false;
+		EIRCurveIPLVLimitsExceeded = false;
+		CalcDXCoilStandardRatingSEER = 0.0;
+		CalcDXCoilStandardRatingEER = 0.0;
+		CalcDXCoilStandardRatingIEER = 0.0;
+		CalcDXCoilStandardRatingHSPF = 0.0;
+		CalcDXCoilStandardRatingNetHeatingCapRatedHighTemp = 0.0;
+		CalcDXCoilStandardRatingNetHeatingCapRatedLowTemp = 0.0;
+		TotalHeatingCapRated = 0.0;
+		EIRRated = 0.0;
+		TotCapTempModFacRated = 0.0;
+		EIRTempModFacRated = 0.0;
+		TotalHeatingCapH2Test = 0.0;
+		TotalHeatingCapH3Test = 0.0;
+		CapTempModFacH2Test = 0.0;
+		EIRTempModFacH2Test = 0.0;
+		EIRH2Test = 0.0;
+		CapTempModFacH3Test = 0.0;
+		EIRTempModFacH3Test = 0.0;
+		EIRH3Test = 0.0;
+		TotCapFlowModFac = 0.0;
+		EIRFlowModFac = 0.0;
+		FanPowerPerEvapAirFlowRate = 0.0;
+		LowTempCutOutFactor = 0.0;
+		OATempCompressorOff = 0.0;
+		FractionalBinHours = 0.0;
+		BuildingLoad = 0.0;
+		HeatingModeLoadFactor = 0.0;
+		NetHeatingCapReduced = 0.0;
+		TotalBuildingLoad = 0.0;
+		TotalElectricalEnergy = 0.0;
+		DemandDeforstCredit = 1.0;
+		CheckCOP = 0.0;
+		DesignHeatingRequirement = 0.0;
+		DesignHeatingRequirementMin = 0.0;
+		ElectricalPowerConsumption = 0.0;
+		HeatPumpElectricalEnergy = 0.0;
+		TotalHeatPumpElectricalEnergy = 0.0;
+		ResistiveSpaceHeatingElectricalEnergy = 0.0;
+		TotalResistiveSpaceHeatingElectricalEnergy = 0.0;
+		SingelSpeedDXCoolingCoilStandardRatingsTotCapFlowModFac = 0.0;
+		SingelSpeedDXCoolingCoilStandardRatingsEIRFlowModFac = 0.0;
+		TotCapTempModFac = 0.0;
+		EIRTempModFac = 0.0;
+		TotCoolingCapAHRI = 0.0;
+		NetCoolingCapAHRI = 0.0;
+		TotalElecPower = 0.0;
+		TotalElecPowerRated = 0.0;
+		SingelSpeedDXCoolingCoilStandardRatingsEIR = 0.0;
+		PartLoadFactor = 0.0;
+		EERReduced = 0.0;
+		ElecPowerReducedCap = 0.0;
+		NetCoolingCapReduced = 0.0;
+		SingelSpeedDXCoolingCoilStandardRatingsLoadFactor = 0.0;
+		SingelSpeedDXCoolingCoilStandardRatingsDegradationCoeff = 0.0;
+		DXCoolingCoilDataCenterStandardRatingsTotCapFlowModFac = 0.0;
+		DXCoolingCoilDataCenterStandardRatingsEIRFlowModFac = 0.0;
+		DXCoolingCoilDataCenterStandardRatingsTotCapTempModFac = 0.0;
+		DXCoolingCoilDataCenterStandardRatingsEIRTempModFac = 0.0;
+		TotCoolingCapRated = 0.0;
+		DXCoolingCoilDataCenterStandardRatingsEIR = 0.0;
+		CoolingCapacityLS = 0.0;
+		CoolingCapacityHS = 0.0;
+		CoolingElecPowerLS = 0.0;
+		CoolingElecPowerHS = 0.0;
+		CoolingCapacityMax = 0.0;
+		CoolingElecPowerMax = 0.0;
+		MultiSpeedDXCoolingCoilStandardRatingsPartLoadRatio = 0.0;
+		PartLoadFraction = 0.0;
+		NetCoolingCapWeighted = 0.0;
+		TotCoolingElecPowerWeighted = 0.0;
+		BuildingCoolingLoad = 0.0;
+		NetTotCoolCapBinned = 0.0;
+		TotCoolElecPowerBinned = 0.0;
+		MultiSpeedDXCoolingCoilStandardRatingsLoadFactor = 0.0;
+		TotCapTempModFacH0 = 0.0;
+		EIRTempModFacH0 = 0.0;
+		TotCapTempModFacH1 = 0.0;
+		EIRTempModFacH1 = 0.0;
+		TotCapTempModFacH2 = 0.0;
+		EIRTempModFacH2 = 0.0;
+		TotCapTempModFacH3 = 0.0;
+		EIRTempModFacH3 = 0.0;
+		MultiSpeedDXHeatingCoilStandardRatingsOATempCompressorOff = 0.0;
+		MultiSpeedDXHeatingCoilStandardRatingsPartLoadRatio = 0.0;
+		MultiSpeedDXHeatingCoilStandardRatingsPartLoadFraction = 0.0;
+		NetHeatingCapWeighted = 0.0;
+		TotHeatingElecPowerWeighted = 0.0;
+		BuildingHeatingLoad = 0.0;
+		NetTotHeatCapBinned = 0.0;
+		TotHeatElecPowerBinnedHP = 0.0;
+		TotHeatElecPowerBinnedRH = 0.0;
+		MultiSpeedDXHeatingCoilStandardRatingsLowTempCutOutFactor = 0.0;
+		MultiSpeedDXHeatingCoilStandardRatingsFractionalBinHours = 0.0;
+		MultiSpeedDXHeatingCoilStandardRatingsDemandDeforstCredit = 1.0;
+		MultiSpeedDXHeatingCoilStandardRatingsDesignHeatingRequirement = 0.0;
+		MultiSpeedDXHeatingCoilStandardRatingsDesignHeatingRequirementMin = 0.0;
+		DesignHeatingRequirementMax = 0.0;
+		MyCoolOneTimeFlag = true;
+		MyHeatOneTimeFlag = true;
+		ReportDXCoolCoilDataCenterApplicationMyCoolOneTimeFlag = true;
+		ClassName.clear();
+		CompNameNew.clear();
+		CapacityWBTempMin = 0.0;
+		CapacityWBTempMax = 0.0;
+		CapacityDBTempMin = 0.0;
+		CapacityDBTempMax = 0.0;
+		EIRWBTempMin = 0.0;
+		EIRWBTempMax = 0.0;
+		EIRDBTempMin = 0.0;
+		EIRDBTempMax = 0.0;
+		PLFFPLRMin = 0.0;
+		PLFFPLRMax = 0.0;
+		CapacityFlowRatioMin = 0.0;
+		CapacityFlowRatioMax = 0.0;
+		EIRFlowRatioMin = 0.0;
+		EIRFlowRatioMax = 0.0;
+		HeatingCapODBTempMin = 0.0;
+		HeatingCapODBTempMax = 0.0;
+		HeatingCapIDBTempMin = 0.0;
+		HeatingCapIDBTempMax = 0.0;
+		HeatingEIRODBTempMin = 0.0;
+		HeatingEIRODBTempMax = 0.0;
+		HeatingEIRIDBTempMin = 0.0;
+		HeatingEIRIDBTempMax = 0.0;
+		CapCurveOATLimitsExceeded = false;
+		CapCurveHighOATLimitsExceeded = false;
+		CapCurveFlowLimitsExceeded = false;
+		EIRCurveHighOATLimitsExceeded = false;
+		EIRCurveFlowLimitsExceeded = false;
+		CapCurveMidOATLimitsExceeded = false;
+		EIRCurveMidOATLimitsExceeded = false;
+		CapCurveLowOATLimitsExceeded = false;
+		EIRCurveLowOATLimitsExceeded = false;
+		PLFfPLRforSEERLimitsExceeded = false;
+		CapCurveIEERLimitsExceeded = false;
+		EIRCurveIEERLimitsExceeded = false;
+		HeatingCapCurveHSPFLimitsExceeded = false;
+		HeatingEIRCurveHSPFLimitsExceeded = false;
+	}
+
 	void
 	CalcChillerIPLV(
 		std::string const & ChillerName, // Name of Chiller for which IPLV is calculated
@@ -286,30 +659,10 @@ namespace StandardRatings {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 AvailChillerCap( 0.0 ); // Chiller available capacity at current operating conditions [W]
-		static Real64 EnteringWaterTempReduced( 0.0 ); // Entering Condenser Water Temperature at reduced conditions [C]
-		static Real64 EnteringAirDryBulbTempReduced( 0.0 ); // Outdoor unit entering air dry-bulb temperature
 		// at reduced capacity [C]
-		static Real64 EnteringAirWetBulbTempReduced( 0.0 ); // Outdoor unit entering air wet-bulb temperature
 		// at reduced capacity [C]
-		static Real64 CondenserInletTemp( 0.0 ); // Entering Condenser Temperature at reduced conditions [C]
-		static Real64 CondenserOutletTemp0( 0.0 ); // Lower bound for condenser outlet temperature [C]
-		static Real64 CondenserOutletTemp1( 0.0 ); // Upper bound for condenser outlet temperature [C]
-		static Real64 CondenserOutletTemp( 0.0 ); // Calculated condenser outlet temperature which corresponds
 		// to EnteringWaterTempReduced above [C]
-		static Real64 Cp( 0.0 ); // Water specific heat [J/(kg*C)]
-		static Real64 Rho( 0.0 ); // Water density [kg/m3]
-		static Real64 IPLV( 0.0 ); // Integerated Part Load Value in SI [W/W]
-		static Real64 EIR( 0.0 ); // Inverse of COP at reduced capacity test conditions (100%, 75%, 50%, and 25%)
-		static Real64 Power( 0.0 ); // Power at reduced capacity test conditions (100%, 75%, 50%, and 25%)
-		static Real64 COPReduced( 0.0 ); // COP at reduced capacity test conditions (100%, 75%, 50%, and 25%)
-		static Real64 LoadFactor( 0.0 ); // Fractional "on" time for last stage at the desired reduced capacity,
 		// (dimensionless)
-		static Real64 DegradationCoeff( 0.0 ); // Degradation coeficient, (dimenssionless)
-		static Real64 ChillerCapFT( 0.0 ); // Chiller capacity fraction (evaluated as a function of temperature)
-		static Real64 ChillerEIRFT( 0.0 ); // Chiller electric input ratio (EIR = 1 / COP) as a function of temperature
-		static Real64 ChillerEIRFPLR( 0.0 ); // Chiller EIR as a function of part-load ratio (PLR)
-		static Real64 PartLoadRatio( 0.0 ); // Part load ratio (PLR) at which chiller is operatign at reduced capacity
 		int RedCapNum; // Integer counter for reduced capacity
 		int SolFla; // Flag of solver
 		Array1D< Real64 > Par( 11 ); // Parameter array need for RegulaFalsi routine
@@ -322,7 +675,7 @@ namespace StandardRatings {
 		CondenserInletTemp = 0.0;
 		CondenserOutletTemp0 = 0.0;
 		CondenserOutletTemp1 = 0.0;
-		CondenserOutletTemp = 0.0;
+		CalcChillerIPLVCondenserOutletTemp = 0.0;
 		Cp = 0.0;
 		Rho = 0.0;
 		IPLV = 0.0;
@@ -396,7 +749,7 @@ namespace StandardRatings {
 				Par( 11 ) = OpenMotorEff;
 				CondenserOutletTemp0 = EnteringWaterTempReduced + 0.1;
 				CondenserOutletTemp1 = EnteringWaterTempReduced + 10.0;
-				SolveRegulaFalsi( Acc, IterMax, SolFla, CondenserOutletTemp, ReformEIRChillerCondInletTempResidual, CondenserOutletTemp0, CondenserOutletTemp1, Par );
+				SolveRegulaFalsi( Acc, IterMax, SolFla, CalcChillerIPLVCondenserOutletTemp, ReformEIRChillerCondInletTempResidual, CondenserOutletTemp0, CondenserOutletTemp1, Par, "CalcChillerIPLV" );
 				if ( SolFla == -1 ) {
 					ShowWarningError( "Iteration limit exceeded in calculating Reform Chiller IPLV" );
 					ShowContinueError( "Reformulated Chiller IPLV calculation failed for " + ChillerName );
@@ -405,15 +758,15 @@ namespace StandardRatings {
 					ShowContinueError( "Reformulated Chiller IPLV calculation failed for " + ChillerName );
 				}
 
-				ChillerCapFT = CurveValue( CapFTempCurveIndex, EvapOutletTemp, CondenserOutletTemp );
+				ChillerCapFT = CurveValue( CapFTempCurveIndex, EvapOutletTemp, CalcChillerIPLVCondenserOutletTemp );
 
-				ChillerEIRFT = CurveValue( EIRFTempCurveIndex, EvapOutletTemp, CondenserOutletTemp );
+				ChillerEIRFT = CurveValue( EIRFTempCurveIndex, EvapOutletTemp, CalcChillerIPLVCondenserOutletTemp );
 
 				if ( ReducedPLR( RedCapNum ) >= MinUnloadRat ) {
-					ChillerEIRFPLR = CurveValue( EIRFPLRCurveIndex, CondenserOutletTemp, ReducedPLR( RedCapNum ) );
+					ChillerEIRFPLR = CurveValue( EIRFPLRCurveIndex, CalcChillerIPLVCondenserOutletTemp, ReducedPLR( RedCapNum ) );
 					PartLoadRatio = ReducedPLR( RedCapNum );
 				} else {
-					ChillerEIRFPLR = CurveValue( EIRFPLRCurveIndex, CondenserOutletTemp, MinUnloadRat );
+					ChillerEIRFPLR = CurveValue( EIRFPLRCurveIndex, CalcChillerIPLVCondenserOutletTemp, MinUnloadRat );
 					PartLoadRatio = MinUnloadRat;
 				}
 			} else {
@@ -522,15 +875,6 @@ namespace StandardRatings {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static Real64 AvailChillerCap( 0.0 ); // Chiller available capacity at current operating conditions [W]
-		static Real64 CondenserInletTemp( 0.0 ); // Calculated condenser inlet temperature [C]
-		static Real64 EvapOutletTemp( 0.0 ); // Evaporator outlet temperature temperature [C]
-		static Real64 QEvap( 0.0 ); // Rate of heat transfer to the evaporator coil [W]
-		static Real64 QCond( 0.0 ); // Rate of heat transfer to the condenser coil [W]
-		static Real64 Power( 0.0 ); // Power at reduced capacity test conditions (100%, 75%, 50%, and 25%)
-		static Real64 ReformEIRChillerCapFT( 0.0 ); // Chiller capacity fraction (evaluated as a function of temperature)
-		static Real64 ReformEIRChillerEIRFT( 0.0 ); // Chiller electric input ratio (EIR = 1 / COP) as a function of temperature
-		static Real64 ReformEIRChillerEIRFPLR( 0.0 ); // Chiller EIR as a function of part-load ratio (PLR)
 
 		EvapOutletTemp = Par( 2 );
 
@@ -539,21 +883,21 @@ namespace StandardRatings {
 		ReformEIRChillerEIRFT = CurveValue( int( Par( 7 ) ), EvapOutletTemp, CondenserOutletTemp );
 
 		// Available chiller capacity as a function of temperature
-		AvailChillerCap = Par( 9 ) * ReformEIRChillerCapFT;
+		ReformEIRChillerCondInletTempResidualAvailChillerCap = Par( 9 ) * ReformEIRChillerCapFT;
 
 		ReformEIRChillerEIRFPLR = CurveValue( int( Par( 8 ) ), CondenserOutletTemp, Par( 4 ) );
 
-		Power = ( AvailChillerCap / Par( 10 ) ) * ReformEIRChillerEIRFPLR * ReformEIRChillerEIRFT;
+		ReformEIRChillerCondInletTempResidualPower = ( ReformEIRChillerCondInletTempResidualAvailChillerCap / Par( 10 ) ) * ReformEIRChillerEIRFPLR * ReformEIRChillerEIRFT;
 
-		QEvap = AvailChillerCap * Par( 4 );
+		QEvap = ReformEIRChillerCondInletTempResidualAvailChillerCap * Par( 4 );
 
-		QCond = Power * Par( 11 ) + QEvap;
+		QCond = ReformEIRChillerCondInletTempResidualPower * Par( 11 ) + QEvap;
 
 		if ( Par( 6 ) > MassFlowTolerance ) {
-			CondenserInletTemp = CondenserOutletTemp - QCond / Par( 5 ) / Par( 3 );
+			ReformEIRChillerCondInletTempResidualCondenserInletTemp = CondenserOutletTemp - QCond / Par( 5 ) / Par( 3 );
 		}
 
-		Residuum = ( Par( 1 ) - CondenserInletTemp ) / Par( 1 );
+		Residuum = ( Par( 1 ) - ReformEIRChillerCondInletTempResidualCondenserInletTemp ) / Par( 1 );
 
 		return Residuum;
 	}
@@ -602,7 +946,6 @@ namespace StandardRatings {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true );
 
 		// Formats
 		static gio::Fmt Format_990( "('! <Chiller Standard Rating Information>, Component Type, Component Name, ','IPLV in SI Units {W/W}, ','IPLV in IP Units {Btu/W-h}')" );
@@ -695,26 +1038,14 @@ namespace StandardRatings {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		//  Minimum and Maximum independent variable limits from Total Cooling Capacity Function of Temperature Curve
-		static Real64 CapacityLWTempMin( 0.0 ); // Capacity modifier Min value (leaving water temp), from the Curve:BiQuadratic object
-		static Real64 CapacityLWTempMax( 0.0 ); // Capacity modifier Max value (leaving water temp), from the Curve:BiQuadratic object
-		static Real64 CapacityEnteringCondTempMin( 0.0 ); // Capacity modifier Min value (entering cond temp),
 		// from the Curve:BiQuadratic object
-		static Real64 CapacityEnteringCondTempMax( 0.0 ); // Capacity modifier Max value (entering cond temp),
 		// from the Curve:BiQuadratic object
 
 		//  Minimum and Maximum independent variable limits from Energy Input Ratio (EIR) Function of Temperature Curve
-		static Real64 EIRLWTempMin( 0.0 ); // EIR modifier Min value (leaving water temp), from the Curve:BiQuadratic object
-		static Real64 EIRLWTempMax( 0.0 ); // EIR modifier Max value (leaving water temp), from the Curve:BiQuadratic object
-		static Real64 EIREnteringCondTempMin( 0.0 ); // EIR modifier Min value (entering cond temp),
 		// from the Curve:BiQuadratic object
-		static Real64 EIREnteringCondTempMax( 0.0 ); // EIR modifier Max value (entering cond temp),
 		// from the Curve:BiQuadratic object
 
-		static Real64 HighCondenserEnteringTempLimit( 0.0 ); // High limit of entering condenser temperature
-		static Real64 LowCondenserEnteringTempLimit( 0.0 ); // Low limit of entering condenser temperature
 
-		static bool CapCurveIPLVLimitsExceeded( false ); // Logical for capacity curve temperature limits being exceeded (IPLV calcs)
-		static bool EIRCurveIPLVLimitsExceeded( false ); // Logical for EIR temperature limits being exceeded (IPLV calcs)
 
 		GetCurveMinMaxValues( CapFTempCurveIndex, CapacityLWTempMin, CapacityLWTempMax, CapacityEnteringCondTempMin, CapacityEnteringCondTempMax );
 		GetCurveMinMaxValues( EIRFTempCurveIndex, EIRLWTempMin, EIRLWTempMax, EIREnteringCondTempMin, EIREnteringCondTempMax );
@@ -931,12 +1262,6 @@ namespace StandardRatings {
 		int spnum; // compressor speed number
 
 		// Calculated and reported to the EIO file
-		static Real64 SEER( 0.0 ); // Seasonal Energy Efficiency Ratio in SI [W/W]
-		static Real64 EER( 0.0 ); // Energy Efficiency Ratio in SI [W/W]
-		static Real64 IEER( 0.0 ); // Integerated Energy Efficiency Ratio in SI [W/W]
-		static Real64 HSPF( 0.0 ); // Heating Seasonal Performance Factor in SI [W/W]
-		static Real64 NetHeatingCapRatedHighTemp( 0.0 ); // Net Rated heating capacity at high temp [W]
-		static Real64 NetHeatingCapRatedLowTemp( 0.0 ); // Net Rated heating capacity at low temp [W]
 		Array1D< Real64 > NetCoolingCapRated( ns ); // Net Cooling Coil capacity at Rated conditions, accounting for supply fan heat [W]
 		Array1D< Real64 > NetTotCoolingCapRated( 16 ); // net total cooling capacity of DX Coils for the sixteen ASHRAE Std 127 Test conditions
 		Array1D< Real64 > TotElectricPowerRated( 16 ); // total electric power of DX Coils for the sixteen ASHRAE Std 127 Test conditions
@@ -950,10 +1275,10 @@ namespace StandardRatings {
 			CheckCurveLimitsForStandardRatings( DXCoilName, DXCoilType, DXCoilType_Num, CapFTempCurveIndex( 1 ), CapFFlowCurveIndex( 1 ), EIRFTempCurveIndex( 1 ), EIRFFlowCurveIndex( 1 ), PLFFPLRCurveIndex( 1 ) );
 
 			// Calculated Net Cooling Capacity, SEER, EER, and IEER of single speed DX cooling coils
-			SingelSpeedDXCoolingCoilStandardRatings( DXCoilName, DXCoilType, CapFTempCurveIndex( 1 ), CapFFlowCurveIndex( 1 ), EIRFTempCurveIndex( 1 ), EIRFFlowCurveIndex( 1 ), PLFFPLRCurveIndex( 1 ), RatedTotalCapacity( 1 ), RatedCOP( 1 ), RatedAirVolFlowRate( 1 ), FanPowerPerEvapAirFlowRateFromInput( 1 ), NetCoolingCapRated( 1 ), SEER, EER, IEER );
+			SingelSpeedDXCoolingCoilStandardRatings( DXCoilName, DXCoilType, CapFTempCurveIndex( 1 ), CapFFlowCurveIndex( 1 ), EIRFTempCurveIndex( 1 ), EIRFFlowCurveIndex( 1 ), PLFFPLRCurveIndex( 1 ), RatedTotalCapacity( 1 ), RatedCOP( 1 ), RatedAirVolFlowRate( 1 ), FanPowerPerEvapAirFlowRateFromInput( 1 ), NetCoolingCapRated( 1 ), CalcDXCoilStandardRatingSEER, CalcDXCoilStandardRatingEER, CalcDXCoilStandardRatingIEER );
 
 			// Writes the net rated cooling capacity, SEER, EER and IEER values to the EIO file and standard tabular output tables
-			ReportDXCoilRating( DXCoilType, DXCoilName, DXCoilType_Num, NetCoolingCapRated( 1 ), SEER * ConvFromSIToIP, EER, EER * ConvFromSIToIP, IEER * ConvFromSIToIP, NetHeatingCapRatedHighTemp, NetHeatingCapRatedLowTemp, HSPF * ConvFromSIToIP, RegionNum );
+			ReportDXCoilRating( DXCoilType, DXCoilName, DXCoilType_Num, NetCoolingCapRated( 1 ), CalcDXCoilStandardRatingSEER * ConvFromSIToIP, CalcDXCoilStandardRatingEER, CalcDXCoilStandardRatingEER * ConvFromSIToIP, CalcDXCoilStandardRatingIEER * ConvFromSIToIP, CalcDXCoilStandardRatingNetHeatingCapRatedHighTemp, CalcDXCoilStandardRatingNetHeatingCapRatedLowTemp, CalcDXCoilStandardRatingHSPF * ConvFromSIToIP, RegionNum );
 
 			if ( ASHRAE127StdRprt ) {
 				DXCoolingCoilDataCenterStandardRatings( DXCoilName, DXCoilType, CapFTempCurveIndex( 1 ), CapFFlowCurveIndex( 1 ), EIRFTempCurveIndex( 1 ), EIRFFlowCurveIndex( 1 ), PLFFPLRCurveIndex( 1 ), RatedTotalCapacity( 1 ), RatedCOP( 1 ), RatedAirVolFlowRate( 1 ), FanPowerPerEvapAirFlowRateFromInput( 1 ), NetTotCoolingCapRated, TotElectricPowerRated );
@@ -963,10 +1288,10 @@ namespace StandardRatings {
 
 			CheckCurveLimitsForStandardRatings( DXCoilName, DXCoilType, DXCoilType_Num, CapFTempCurveIndex( 1 ), CapFFlowCurveIndex( 1 ), EIRFTempCurveIndex( 1 ), EIRFFlowCurveIndex( 1 ), PLFFPLRCurveIndex( 1 ) );
 			// Calculate the standard ratings for single speed DX heating coil
-			SingleSpeedDXHeatingCoilStandardRatings( RatedTotalCapacity( 1 ), RatedCOP( 1 ), CapFFlowCurveIndex( 1 ), CapFTempCurveIndex( 1 ), EIRFFlowCurveIndex( 1 ), EIRFTempCurveIndex( 1 ), RatedAirVolFlowRate( 1 ), FanPowerPerEvapAirFlowRateFromInput( 1 ), NetHeatingCapRatedHighTemp, NetHeatingCapRatedLowTemp, HSPF, RegionNum, MinOATCompressor, OATempCompressorOn, OATempCompressorOnOffBlank, DefrostControl );
+			SingleSpeedDXHeatingCoilStandardRatings( RatedTotalCapacity( 1 ), RatedCOP( 1 ), CapFFlowCurveIndex( 1 ), CapFTempCurveIndex( 1 ), EIRFFlowCurveIndex( 1 ), EIRFTempCurveIndex( 1 ), RatedAirVolFlowRate( 1 ), FanPowerPerEvapAirFlowRateFromInput( 1 ), CalcDXCoilStandardRatingNetHeatingCapRatedHighTemp, CalcDXCoilStandardRatingNetHeatingCapRatedLowTemp, CalcDXCoilStandardRatingHSPF, RegionNum, MinOATCompressor, OATempCompressorOn, OATempCompressorOnOffBlank, DefrostControl );
 
 			// Writes the HSPF value to the EIO file and standard tabular output tables
-			ReportDXCoilRating( DXCoilType, DXCoilName, DXCoilType_Num, NetCoolingCapRated( 1 ), SEER * ConvFromSIToIP, EER, EER * ConvFromSIToIP, IEER * ConvFromSIToIP, NetHeatingCapRatedHighTemp, NetHeatingCapRatedLowTemp, HSPF * ConvFromSIToIP, RegionNum );
+			ReportDXCoilRating( DXCoilType, DXCoilName, DXCoilType_Num, NetCoolingCapRated( 1 ), CalcDXCoilStandardRatingSEER * ConvFromSIToIP, CalcDXCoilStandardRatingEER, CalcDXCoilStandardRatingEER * ConvFromSIToIP, CalcDXCoilStandardRatingIEER * ConvFromSIToIP, CalcDXCoilStandardRatingNetHeatingCapRatedHighTemp, CalcDXCoilStandardRatingNetHeatingCapRatedLowTemp, CalcDXCoilStandardRatingHSPF * ConvFromSIToIP, RegionNum );
 
 		} else if ( SELECT_CASE_var == CoilDX_MultiSpeedCooling ) { // Coil:Cooling:DX:MultiSpeed,
 
@@ -974,9 +1299,9 @@ namespace StandardRatings {
 				CheckCurveLimitsForStandardRatings( DXCoilName, DXCoilType, DXCoilType_Num, CapFTempCurveIndex( spnum ), CapFFlowCurveIndex( spnum ), EIRFTempCurveIndex( spnum ), EIRFFlowCurveIndex( spnum ), PLFFPLRCurveIndex( spnum ) );
 			}
 			// Calculate the standard ratings for multispeed DX cooling coil
-			MultiSpeedDXCoolingCoilStandardRatings( DXCoilName, DXCoilType, CapFTempCurveIndex, CapFFlowCurveIndex, EIRFTempCurveIndex, EIRFFlowCurveIndex, PLFFPLRCurveIndex, RatedTotalCapacity, RatedCOP, RatedAirVolFlowRate, FanPowerPerEvapAirFlowRateFromInput, ns, NetCoolingCapRated( ns ), SEER );
+			MultiSpeedDXCoolingCoilStandardRatings( DXCoilName, DXCoilType, CapFTempCurveIndex, CapFFlowCurveIndex, EIRFTempCurveIndex, EIRFFlowCurveIndex, PLFFPLRCurveIndex, RatedTotalCapacity, RatedCOP, RatedAirVolFlowRate, FanPowerPerEvapAirFlowRateFromInput, ns, NetCoolingCapRated( ns ), CalcDXCoilStandardRatingSEER );
 			// Writes the SEER value to the EIO file and standard tabular output tables
-			ReportDXCoilRating( DXCoilType, DXCoilName, DXCoilType_Num, NetCoolingCapRated( ns ), SEER * ConvFromSIToIP, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0 );
+			ReportDXCoilRating( DXCoilType, DXCoilName, DXCoilType_Num, NetCoolingCapRated( ns ), CalcDXCoilStandardRatingSEER * ConvFromSIToIP, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0 );
 
 		} else if ( SELECT_CASE_var == CoilDX_MultiSpeedHeating ) { // Coil:Heating:DX:MultiSpeed
 
@@ -984,9 +1309,9 @@ namespace StandardRatings {
 				CheckCurveLimitsForStandardRatings( DXCoilName, DXCoilType, DXCoilType_Num, CapFTempCurveIndex( spnum ), CapFFlowCurveIndex( spnum ), EIRFTempCurveIndex( spnum ), EIRFFlowCurveIndex( spnum ), PLFFPLRCurveIndex( spnum ) );
 			}
 			// Calculate Net heatig capacity and HSPF of multispeed DX heating coils
-			MultiSpeedDXHeatingCoilStandardRatings( DXCoilName, DXCoilType, CapFTempCurveIndex, CapFFlowCurveIndex, EIRFTempCurveIndex, EIRFFlowCurveIndex, PLFFPLRCurveIndex, RatedTotalCapacity, RatedCOP, RatedAirVolFlowRate, FanPowerPerEvapAirFlowRateFromInput, ns, NetHeatingCapRatedHighTemp, NetHeatingCapRatedLowTemp, HSPF, RegionNum, MinOATCompressor, OATempCompressorOn, OATempCompressorOnOffBlank, DefrostControl );
+			MultiSpeedDXHeatingCoilStandardRatings( DXCoilName, DXCoilType, CapFTempCurveIndex, CapFFlowCurveIndex, EIRFTempCurveIndex, EIRFFlowCurveIndex, PLFFPLRCurveIndex, RatedTotalCapacity, RatedCOP, RatedAirVolFlowRate, FanPowerPerEvapAirFlowRateFromInput, ns, CalcDXCoilStandardRatingNetHeatingCapRatedHighTemp, CalcDXCoilStandardRatingNetHeatingCapRatedLowTemp, CalcDXCoilStandardRatingHSPF, RegionNum, MinOATCompressor, OATempCompressorOn, OATempCompressorOnOffBlank, DefrostControl );
 			// Writes the HSPF value to the EIO file and standard tabular output tables
-			ReportDXCoilRating( DXCoilType, DXCoilName, DXCoilType_Num, NetCoolingCapRated( ns ), SEER * ConvFromSIToIP, EER, EER * ConvFromSIToIP, IEER * ConvFromSIToIP, NetHeatingCapRatedHighTemp, NetHeatingCapRatedLowTemp, HSPF * ConvFromSIToIP, RegionNum );
+			ReportDXCoilRating( DXCoilType, DXCoilName, DXCoilType_Num, NetCoolingCapRated( ns ), CalcDXCoilStandardRatingSEER * ConvFromSIToIP, CalcDXCoilStandardRatingEER, CalcDXCoilStandardRatingEER * ConvFromSIToIP, CalcDXCoilStandardRatingIEER * ConvFromSIToIP, CalcDXCoilStandardRatingNetHeatingCapRatedHighTemp, CalcDXCoilStandardRatingNetHeatingCapRatedLowTemp, CalcDXCoilStandardRatingHSPF * ConvFromSIToIP, RegionNum );
 
 		} else {
 			//... other DX Coil types will follow here
@@ -1053,21 +1378,6 @@ namespace StandardRatings {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 TotalHeatingCapRated( 0.0 ); // Heating Coil capacity at Rated conditions, without accounting supply fan heat [W]
-		static Real64 EIRRated( 0.0 ); // EIR at Rated conditions [-]
-		static Real64 TotCapTempModFacRated( 0.0 ); // Total capacity as a function of temerature modifier at rated conditions [-]
-		static Real64 EIRTempModFacRated( 0.0 ); // EIR as a function of temerature modifier at rated conditions [-]
-		static Real64 TotalHeatingCapH2Test( 0.0 ); // Heating Coil capacity at H2 test conditions, without accounting supply fan heat [W]
-		static Real64 TotalHeatingCapH3Test( 0.0 ); // Heating Coil capacity at H3 test conditions, without accounting supply fan heat [W]
-		static Real64 CapTempModFacH2Test( 0.0 ); // Total capacity as a function of temerature modifier at H2 test conditions [-]
-		static Real64 EIRTempModFacH2Test( 0.0 ); // EIR as a function of temerature modifier at H2 test conditions [-]
-		static Real64 EIRH2Test( 0.0 ); // EIR at H2 test conditions [-]
-		static Real64 CapTempModFacH3Test( 0.0 ); // Total capacity as a function of temerature modifier at H3 test conditions [-]
-		static Real64 EIRTempModFacH3Test( 0.0 ); // EIR as a function of temerature modifier at H3 test conditions [-]
-		static Real64 EIRH3Test( 0.0 ); // EIR at H3 test conditions [-]
-		static Real64 TotCapFlowModFac( 0.0 ); // Total capacity modifier (function of actual supply air flow vs rated flow)
-		static Real64 EIRFlowModFac( 0.0 ); // EIR modifier (function of actual supply air flow vs rated flow)
-		static Real64 FanPowerPerEvapAirFlowRate( 0.0 ); // Fan power per air volume flow rate [W/(m3/s)]
 
 		Real64 ElecPowerRated; // Total system power at Rated conditions accounting for supply fan heat [W]
 		Real64 ElecPowerH2Test; // Total system power at H2 test conditions accounting for supply fan heat [W]
@@ -1075,26 +1385,9 @@ namespace StandardRatings {
 		Real64 NetHeatingCapH2Test; // Net Heating Coil capacity at H2 test conditions accounting for supply fan heat [W]
 
 		Real64 PartLoadFactor;
-		static Real64 LowTempCutOutFactor( 0.0 ); // Factor which corresponds to compressor operation depending on outdoor temperature
-		static Real64 OATempCompressorOff( 0.0 ); // Minimum outdoor air temperature to turn the commpressor off, [C]
-
-		static Real64 FractionalBinHours( 0.0 ); // Fractional bin hours for the heating season  [-]
-		static Real64 BuildingLoad( 0.0 ); // Building space conditioning load corresponding to an outdoor bin temperature [W]
-		static Real64 HeatingModeLoadFactor( 0.0 ); // Heating mode load factor corresponding to an outdoor bin temperature  [-]
-		static Real64 NetHeatingCapReduced( 0.0 ); // Net Heating Coil capacity corresponding to an outdoor bin temperature [W]
-		static Real64 TotalBuildingLoad( 0.0 ); // Sum of building load over the entire heating season [W]
-		static Real64 TotalElectricalEnergy( 0.0 ); // Sum of electrical energy consumed by the heatpump over the heating season [W]
-		static Real64 DemandDeforstCredit( 1.0 ); // A factor to adjust HSPF if coil has demand defrost control  [-]
-		static Real64 CheckCOP( 0.0 ); // Checking COP at an outdoor bin temperature against unity [-]
-		static Real64 DesignHeatingRequirement( 0.0 ); // The amount of heating required to maintain a given indoor temperature
+
 		// at a particular outdoor design temperature.  [W]
-		static Real64 DesignHeatingRequirementMin( 0.0 ); // minimum design heating requirement [W]
-		static Real64 ElectricalPowerConsumption( 0.0 ); // Electrical power corresponding to an outdoor bin temperature [W]
-		static Real64 HeatPumpElectricalEnergy( 0.0 ); // Heatpump electrical energy corresponding to an outdoor bin temperature [W]
-		static Real64 TotalHeatPumpElectricalEnergy( 0.0 ); // Sum of Heatpump electrical energy over the entire heating season [W]
-		static Real64 ResistiveSpaceHeatingElectricalEnergy( 0.0 ); // resistance heating electrical energy corresponding to an
 		// outdoor bin temperature [W]
-		static Real64 TotalResistiveSpaceHeatingElectricalEnergy( 0.0 ); // Sum of resistance heating electrical energy over the
 		// entire heating season [W]
 
 		int BinNum; // bin number counter
@@ -1329,21 +1622,6 @@ namespace StandardRatings {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 TotCapFlowModFac( 0.0 ); // Total capacity modifier f(actual flow vs rated flow) for each speed [-]
-		static Real64 EIRFlowModFac( 0.0 ); // EIR modifier f(actual supply air flow vs rated flow) for each speed [-]
-		static Real64 TotCapTempModFac( 0.0 ); // Total capacity modifier (function of entering wetbulb, outside drybulb) [-]
-		static Real64 EIRTempModFac( 0.0 ); // EIR modifier (function of entering wetbulb, outside drybulb) [-]
-		static Real64 TotCoolingCapAHRI( 0.0 ); // Total Cooling Coil capacity (gross) at AHRI test conditions [W]
-		static Real64 NetCoolingCapAHRI( 0.0 ); // Net Cooling Coil capacity at AHRI TestB conditions, accounting for fan heat [W]
-		static Real64 TotalElecPower( 0.0 ); // Net power consumption (Cond Fan+Compressor+Indoor Fan) at AHRI test conditions [W]
-		static Real64 TotalElecPowerRated( 0.0 ); // Net power consumption (Cond Fan+Compressor+Indoor Fan) at Rated test conditions [W]
-		static Real64 EIR( 0.0 ); // Energy Efficiency Ratio at AHRI test conditions for SEER [-]
-		static Real64 PartLoadFactor( 0.0 ); // Part load factor, accounts for thermal lag at compressor startup [-]
-		static Real64 EERReduced( 0.0 ); // EER at reduced capacity test conditions (100%, 75%, 50%, and 25%)
-		static Real64 ElecPowerReducedCap( 0.0 ); // Net power consumption (Cond Fan+Compressor) at reduced test condition [W]
-		static Real64 NetCoolingCapReduced( 0.0 ); // Net Cooling Coil capacity at reduced conditions, accounting for supply fan heat [W]
-		static Real64 LoadFactor( 0.0 ); // Fractional "on" time for last stage at the desired reduced capacity, (dimensionless)
-		static Real64 DegradationCoeff( 0.0 ); // Degradation coeficient, (dimenssionless)
 		Real64 FanPowerPerEvapAirFlowRate; // Fan power per air volume flow rate through the evaporator coil [W/(m3/s)]
 		Real64 OutdoorUnitInletAirDryBulbTempReduced; // Outdoor unit entering air dry-bulb temperature at reduced capacity [C]
 		int RedCapNum; // Integer counter for reduced capacity
@@ -1356,23 +1634,23 @@ namespace StandardRatings {
 		if ( RatedTotalCapacity > 0.0 ) {
 
 			// Standard Rating Cooling (net) Capacity calculations:
-			TotCapFlowModFac = CurveValue( CapFFlowCurveIndex, AirMassFlowRatioRated );
+			SingelSpeedDXCoolingCoilStandardRatingsTotCapFlowModFac = CurveValue( CapFFlowCurveIndex, AirMassFlowRatioRated );
 			TotCapTempModFac = CurveValue( CapFTempCurveIndex, CoolingCoilInletAirWetBulbTempRated, OutdoorUnitInletAirDryBulbTempRated );
-			NetCoolingCapRated = RatedTotalCapacity * TotCapTempModFac * TotCapFlowModFac - FanPowerPerEvapAirFlowRate * RatedAirVolFlowRate;
+			NetCoolingCapRated = RatedTotalCapacity * TotCapTempModFac * SingelSpeedDXCoolingCoilStandardRatingsTotCapFlowModFac - FanPowerPerEvapAirFlowRate * RatedAirVolFlowRate;
 
 			// SEER calculations:
 			TotCapTempModFac = CurveValue( CapFTempCurveIndex, CoolingCoilInletAirWetBulbTempRated, OutdoorUnitInletAirDryBulbTemp );
-			TotCoolingCapAHRI = RatedTotalCapacity * TotCapTempModFac * TotCapFlowModFac;
+			TotCoolingCapAHRI = RatedTotalCapacity * TotCapTempModFac * SingelSpeedDXCoolingCoilStandardRatingsTotCapFlowModFac;
 			EIRTempModFac = CurveValue( EIRFTempCurveIndex, CoolingCoilInletAirWetBulbTempRated, OutdoorUnitInletAirDryBulbTemp );
-			EIRFlowModFac = CurveValue( EIRFFlowCurveIndex, AirMassFlowRatioRated );
+			SingelSpeedDXCoolingCoilStandardRatingsEIRFlowModFac = CurveValue( EIRFFlowCurveIndex, AirMassFlowRatioRated );
 			if ( RatedCOP > 0.0 ) { // RatedCOP <= 0.0 is trapped in GetInput, but keep this as "safety"
-				EIR = EIRTempModFac * EIRFlowModFac / RatedCOP;
+				SingelSpeedDXCoolingCoilStandardRatingsEIR = EIRTempModFac * SingelSpeedDXCoolingCoilStandardRatingsEIRFlowModFac / RatedCOP;
 			} else {
-				EIR = 0.0;
+				SingelSpeedDXCoolingCoilStandardRatingsEIR = 0.0;
 			}
 			// Calculate net cooling capacity
 			NetCoolingCapAHRI = TotCoolingCapAHRI - FanPowerPerEvapAirFlowRate * RatedAirVolFlowRate;
-			TotalElecPower = EIR * TotCoolingCapAHRI + FanPowerPerEvapAirFlowRate * RatedAirVolFlowRate;
+			TotalElecPower = SingelSpeedDXCoolingCoilStandardRatingsEIR * TotCoolingCapAHRI + FanPowerPerEvapAirFlowRate * RatedAirVolFlowRate;
 			// Calculate SEER value from the Energy Efficiency Ratio (EER) at the AHRI test conditions and the part load factor.
 			// First evaluate the Part Load Factor curve at PLR = 0.5 (AHRI Standard 210/240)
 			PartLoadFactor = CurveValue( PLFFPLRCurveIndex, PLRforSEER );
@@ -1385,16 +1663,16 @@ namespace StandardRatings {
 			// EER calculations:
 			// Calculate the net cooling capacity at the rated conditions (19.44C WB and 35.0C DB )
 			TotCapTempModFac = CurveValue( CapFTempCurveIndex, CoolingCoilInletAirWetBulbTempRated, OutdoorUnitInletAirDryBulbTempRated );
-			NetCoolingCapRated = RatedTotalCapacity * TotCapTempModFac * TotCapFlowModFac - FanPowerPerEvapAirFlowRate * RatedAirVolFlowRate;
+			NetCoolingCapRated = RatedTotalCapacity * TotCapTempModFac * SingelSpeedDXCoolingCoilStandardRatingsTotCapFlowModFac - FanPowerPerEvapAirFlowRate * RatedAirVolFlowRate;
 			// Calculate Energy Efficiency Ratio (EER) at (19.44C WB and 35.0C DB ), ANSI/AHRI Std. 340/360
 			EIRTempModFac = CurveValue( EIRFTempCurveIndex, CoolingCoilInletAirWetBulbTempRated, OutdoorUnitInletAirDryBulbTempRated );
 			if ( RatedCOP > 0.0 ) {
 				// RatedCOP <= 0.0 is trapped in GetInput, but keep this as "safety"
-				EIR = EIRTempModFac * EIRFlowModFac / RatedCOP;
+				SingelSpeedDXCoolingCoilStandardRatingsEIR = EIRTempModFac * SingelSpeedDXCoolingCoilStandardRatingsEIRFlowModFac / RatedCOP;
 			} else {
-				EIR = 0.0;
+				SingelSpeedDXCoolingCoilStandardRatingsEIR = 0.0;
 			}
-			TotalElecPowerRated = EIR * ( RatedTotalCapacity * TotCapTempModFac * TotCapFlowModFac ) + FanPowerPerEvapAirFlowRate * RatedAirVolFlowRate;
+			TotalElecPowerRated = SingelSpeedDXCoolingCoilStandardRatingsEIR * ( RatedTotalCapacity * TotCapTempModFac * SingelSpeedDXCoolingCoilStandardRatingsTotCapFlowModFac ) + FanPowerPerEvapAirFlowRate * RatedAirVolFlowRate;
 			if ( TotalElecPowerRated > 0.0 ) {
 				EER = NetCoolingCapRated / TotalElecPowerRated;
 			} else {
@@ -1405,7 +1683,7 @@ namespace StandardRatings {
 			IEER = 0.0;
 			// Calculate the net cooling capacity at the rated conditions (19.44C WB and 35.0C DB )
 			TotCapTempModFac = CurveValue( CapFTempCurveIndex, CoolingCoilInletAirWetBulbTempRated, OutdoorUnitInletAirDryBulbTempRated );
-			NetCoolingCapRated = RatedTotalCapacity * TotCapTempModFac * TotCapFlowModFac - FanPowerPerEvapAirFlowRate * RatedAirVolFlowRate;
+			NetCoolingCapRated = RatedTotalCapacity * TotCapTempModFac * SingelSpeedDXCoolingCoilStandardRatingsTotCapFlowModFac - FanPowerPerEvapAirFlowRate * RatedAirVolFlowRate;
 			for ( RedCapNum = 1; RedCapNum <= NumOfReducedCap; ++RedCapNum ) {
 				// get the outdoor air dry bulb temperature for the reduced capacity test conditions
 				if ( ReducedPLR( RedCapNum ) > 0.444 ) {
@@ -1414,21 +1692,21 @@ namespace StandardRatings {
 					OutdoorUnitInletAirDryBulbTempReduced = OADBTempLowReducedCapacityTest;
 				}
 				TotCapTempModFac = CurveValue( CapFTempCurveIndex, CoolingCoilInletAirWetBulbTempRated, OutdoorUnitInletAirDryBulbTempReduced );
-				NetCoolingCapReduced = RatedTotalCapacity * TotCapTempModFac * TotCapFlowModFac - FanPowerPerEvapAirFlowRate * RatedAirVolFlowRate;
+				NetCoolingCapReduced = RatedTotalCapacity * TotCapTempModFac * SingelSpeedDXCoolingCoilStandardRatingsTotCapFlowModFac - FanPowerPerEvapAirFlowRate * RatedAirVolFlowRate;
 				EIRTempModFac = CurveValue( EIRFTempCurveIndex, CoolingCoilInletAirWetBulbTempRated, OutdoorUnitInletAirDryBulbTempReduced );
 				if ( RatedCOP > 0.0 ) {
-					EIR = EIRTempModFac * EIRFlowModFac / RatedCOP;
+					SingelSpeedDXCoolingCoilStandardRatingsEIR = EIRTempModFac * SingelSpeedDXCoolingCoilStandardRatingsEIRFlowModFac / RatedCOP;
 				} else {
-					EIR = 0.0;
+					SingelSpeedDXCoolingCoilStandardRatingsEIR = 0.0;
 				}
 				if ( NetCoolingCapReduced > 0.0 ) {
-					LoadFactor = ReducedPLR( RedCapNum ) * NetCoolingCapRated / NetCoolingCapReduced;
+					SingelSpeedDXCoolingCoilStandardRatingsLoadFactor = ReducedPLR( RedCapNum ) * NetCoolingCapRated / NetCoolingCapReduced;
 				} else {
-					LoadFactor = 1.0;
+					SingelSpeedDXCoolingCoilStandardRatingsLoadFactor = 1.0;
 				}
-				DegradationCoeff = 1.130 - 0.130 * LoadFactor;
-				ElecPowerReducedCap = DegradationCoeff * EIR * ( RatedTotalCapacity * TotCapTempModFac * TotCapFlowModFac );
-				EERReduced = ( LoadFactor * NetCoolingCapReduced ) / ( LoadFactor * ElecPowerReducedCap + FanPowerPerEvapAirFlowRate * RatedAirVolFlowRate );
+				SingelSpeedDXCoolingCoilStandardRatingsDegradationCoeff = 1.130 - 0.130 * SingelSpeedDXCoolingCoilStandardRatingsLoadFactor;
+				ElecPowerReducedCap = SingelSpeedDXCoolingCoilStandardRatingsDegradationCoeff * SingelSpeedDXCoolingCoilStandardRatingsEIR * ( RatedTotalCapacity * TotCapTempModFac * SingelSpeedDXCoolingCoilStandardRatingsTotCapFlowModFac );
+				EERReduced = ( SingelSpeedDXCoolingCoilStandardRatingsLoadFactor * NetCoolingCapReduced ) / ( SingelSpeedDXCoolingCoilStandardRatingsLoadFactor * ElecPowerReducedCap + FanPowerPerEvapAirFlowRate * RatedAirVolFlowRate );
 				IEER += IEERWeightingFactor( RedCapNum ) * EERReduced;
 			}
 
@@ -1492,12 +1770,6 @@ namespace StandardRatings {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 TotCapFlowModFac( 0.0 ); // Total capacity modifier f(actual flow vs rated flow) for each speed [-]
-		static Real64 EIRFlowModFac( 0.0 ); // EIR modifier f(actual supply air flow vs rated flow) for each speed [-]
-		static Real64 TotCapTempModFac( 0.0 ); // Total capacity modifier (function of entering wetbulb, outside drybulb) [-]
-		static Real64 EIRTempModFac( 0.0 ); // EIR modifier (function of entering wetbulb, outside drybulb) [-]
-		static Real64 TotCoolingCapRated( 0.0 ); // Total Cooling Coil capacity (gross) at one of the rated test conditions [W]
-		static Real64 EIR( 0.0 ); // Energy Efficiency Ratio at AHRI test conditions for SEER [-]
 		Real64 FanPowerPerEvapAirFlowRate; // Fan power per air volume flow rate through the evaporator coil [W/(m3/s)]
 
 		Real64 TWBIndoor; // indoor air dry bulb temperature
@@ -1519,19 +1791,19 @@ namespace StandardRatings {
 					TDBOutdoor = OutdoorDBTempAllClassA2D( TestNum );
 					Num = ( ClassNum - 1 ) * 4 + TestNum;
 					// Standard Rating Net Cooling Capacity at Test A:
-					TotCapFlowModFac = CurveValue( CapFFlowCurveIndex, AirMassFlowRatioRated );
-					TotCapTempModFac = CurveValue( CapFTempCurveIndex, TWBIndoor, TDBOutdoor );
-					TotCoolingCapRated = RatedTotalCapacity * TotCapTempModFac * TotCapFlowModFac;
+					DXCoolingCoilDataCenterStandardRatingsTotCapFlowModFac = CurveValue( CapFFlowCurveIndex, AirMassFlowRatioRated );
+					DXCoolingCoilDataCenterStandardRatingsTotCapTempModFac = CurveValue( CapFTempCurveIndex, TWBIndoor, TDBOutdoor );
+					TotCoolingCapRated = RatedTotalCapacity * DXCoolingCoilDataCenterStandardRatingsTotCapTempModFac * DXCoolingCoilDataCenterStandardRatingsTotCapFlowModFac;
 					NetCoolingCapRated( Num ) = TotCoolingCapRated - FanPowerPerEvapAirFlowRate * RatedAirVolFlowRate;
 					// Standard Rating total electric power at Test A:
-					EIRTempModFac = CurveValue( EIRFTempCurveIndex, TWBIndoor, TDBOutdoor );
-					EIRFlowModFac = CurveValue( EIRFFlowCurveIndex, AirMassFlowRatioRated );
-					EIR = 0.0;
+					DXCoolingCoilDataCenterStandardRatingsEIRTempModFac = CurveValue( EIRFTempCurveIndex, TWBIndoor, TDBOutdoor );
+					DXCoolingCoilDataCenterStandardRatingsEIRFlowModFac = CurveValue( EIRFFlowCurveIndex, AirMassFlowRatioRated );
+					DXCoolingCoilDataCenterStandardRatingsEIR = 0.0;
 					if ( RatedCOP > 0.0 ) {
-						EIR = EIRTempModFac * EIRFlowModFac / RatedCOP;
+						DXCoolingCoilDataCenterStandardRatingsEIR = DXCoolingCoilDataCenterStandardRatingsEIRTempModFac * DXCoolingCoilDataCenterStandardRatingsEIRFlowModFac / RatedCOP;
 					}
 					// Calculate net cooling capacity at Test A:
-					TotElectricPowerRated( Num ) = EIR * TotCoolingCapRated + FanPowerPerEvapAirFlowRate * RatedAirVolFlowRate;
+					TotElectricPowerRated( Num ) = DXCoolingCoilDataCenterStandardRatingsEIR * TotCoolingCapRated + FanPowerPerEvapAirFlowRate * RatedAirVolFlowRate;
 				}
 			}
 		} else {
@@ -1616,21 +1888,7 @@ namespace StandardRatings {
 		Array1D< Real64 > NetCoolingCapRated( nsp ); // net cooling capacity at each speed
 		Array1D< Real64 > TotCapFlowModFac( nsp ); // Total capacity modifier f(actual flow vs rated flow) for each speed [-]
 		Array1D< Real64 > EIRFlowModFac( nsp ); // EIR modifier f(actual supply air flow vs rated flow) for each speed [-]
-		static Real64 CoolingCapacityLS( 0.0 ); // cooling capacity of Mult-speed DX coil at lower speed, [W]
-		static Real64 CoolingCapacityHS( 0.0 ); // cooling capacity of Mult-speed DX coil at higher speed, [W]
-		static Real64 CoolingElecPowerLS( 0.0 ); // outdoor unit electric power input at low speed, [W]
-		static Real64 CoolingElecPowerHS( 0.0 ); // outdoor unit electric power input at high speed, [W]
-		static Real64 CoolingCapacityMax( 0.0 ); // cooling capacity of Mult-speed DX coil at max speed, [W]
-		static Real64 CoolingElecPowerMax( 0.0 ); // outdoor unit electric power input at Max speed, [W]
-		static Real64 PartLoadRatio( 0.0 ); // compressor cycling ratio between successive speeds, [-]
-		static Real64 PartLoadFraction( 0.0 ); // part-load fraction that account for the cyclic degradation, [-]
-		static Real64 NetCoolingCapWeighted( 0.0 ); // net tot cooling cap weighted by the fraction of the binned cooling hours [W]
-		static Real64 TotCoolingElecPowerWeighted( 0.0 ); // net total cooling electric power input weighted by the fraction of the
 		// binned cooling hours
-		static Real64 BuildingCoolingLoad( 0.0 ); // Building space cooling load corresponding to an outdoor bin temperature [W]
-		static Real64 NetTotCoolCapBinned( 0.0 ); // Net tot cooling cap corresponding to an outdoor bin temperature [W]
-		static Real64 TotCoolElecPowerBinned( 0.0 ); // Total cooling electric power corresponding to an outdoor bin temperature [W]
-		static Real64 LoadFactor( 0.0 ); // "on" time for last stage at the desired reduced capacity, (dimensionless)
 		int BinNum; // bin number counter
 		int spnum; // compressor speed number
 
@@ -1680,17 +1938,17 @@ namespace StandardRatings {
 				CoolingElecPowerHS = OutdoorUnitPowerTestB2( spnum + 1 ) + ( ( OutdoorUnitPowerTestA2( spnum + 1 ) - OutdoorUnitPowerTestB2( spnum + 1 ) ) / ( OutdoorCoilInletAirDryBulbTempTestA2 - OutdoorCoilInletAirDryBulbTempTestB2 ) ) * ( OutdoorBinTemperatureSEER( BinNum ) - OutdoorCoilInletAirDryBulbTempTestB2 );
 
 				if ( BuildingCoolingLoad <= CoolingCapacityLS ) {
-					PartLoadRatio = min( 1.0, BuildingCoolingLoad / CoolingCapacityLS );
-					NetTotCoolCapBinned = PartLoadRatio * CoolingCapacityLS;
-					PartLoadFraction = 1.0 - CyclicDegradationCoeff * ( 1.0 - PartLoadRatio );
-					TotCoolElecPowerBinned = ( PartLoadRatio / PartLoadFraction ) * CoolingElecPowerLS;
+					MultiSpeedDXCoolingCoilStandardRatingsPartLoadRatio = min( 1.0, BuildingCoolingLoad / CoolingCapacityLS );
+					NetTotCoolCapBinned = MultiSpeedDXCoolingCoilStandardRatingsPartLoadRatio * CoolingCapacityLS;
+					PartLoadFraction = 1.0 - CyclicDegradationCoeff * ( 1.0 - MultiSpeedDXCoolingCoilStandardRatingsPartLoadRatio );
+					TotCoolElecPowerBinned = ( MultiSpeedDXCoolingCoilStandardRatingsPartLoadRatio / PartLoadFraction ) * CoolingElecPowerLS;
 					goto SpeedLoop_exit;
 				} else if ( ( BuildingCoolingLoad > CoolingCapacityLS ) && ( BuildingCoolingLoad < CoolingCapacityHS ) ) {
 					// cycle between speed "spnum" and "spnum + 1"
-					LoadFactor = min( 1.0, ( CoolingCapacityHS - BuildingCoolingLoad ) / ( CoolingCapacityHS - CoolingCapacityLS ) );
-					LoadFactor = max( 0.0, LoadFactor );
-					NetTotCoolCapBinned = LoadFactor * CoolingCapacityLS + ( 1.0 - LoadFactor ) * CoolingCapacityHS;
-					TotCoolElecPowerBinned = LoadFactor * CoolingElecPowerLS + ( 1.0 - LoadFactor ) * CoolingElecPowerHS;
+					MultiSpeedDXCoolingCoilStandardRatingsLoadFactor = min( 1.0, ( CoolingCapacityHS - BuildingCoolingLoad ) / ( CoolingCapacityHS - CoolingCapacityLS ) );
+					MultiSpeedDXCoolingCoilStandardRatingsLoadFactor = max( 0.0, MultiSpeedDXCoolingCoilStandardRatingsLoadFactor );
+					NetTotCoolCapBinned = MultiSpeedDXCoolingCoilStandardRatingsLoadFactor * CoolingCapacityLS + ( 1.0 - MultiSpeedDXCoolingCoilStandardRatingsLoadFactor ) * CoolingCapacityHS;
+					TotCoolElecPowerBinned = MultiSpeedDXCoolingCoilStandardRatingsLoadFactor * CoolingElecPowerLS + ( 1.0 - MultiSpeedDXCoolingCoilStandardRatingsLoadFactor ) * CoolingElecPowerHS;
 					goto SpeedLoop_exit;
 				} else if ( BuildingCoolingLoad >= CoolingCapacityMax ) {
 					NetTotCoolCapBinned = CoolingCapacityMax;
@@ -1806,36 +2064,13 @@ namespace StandardRatings {
 		Array1D< Real64 > TotCapFlowModFac( nsp ); // Total capacity modifier f(actual flow vs rated flow) for each speed [-]
 		Array1D< Real64 > EIRFlowModFac( nsp ); // EIR modifier f(actual supply air flow vs rated flow) for each speed [-]
 
-		static Real64 TotCapTempModFacH0( 0.0 ); // Tot capacity modifier (function of entering wetbulb, outside drybulb) at H0 Test [-]
-		static Real64 EIRTempModFacH0( 0.0 ); // EIR modifier (function of entering wetbulb, outside drybulb)  at H0 Test[-]
-		static Real64 TotCapTempModFacH1( 0.0 ); // Tot capacity modifier (function of entering wetbulb, outside drybulb) at H1 Test [-]
-		static Real64 EIRTempModFacH1( 0.0 ); // EIR modifier (function of entering wetbulb, outside drybulb)  at H1 Test[-]
-		static Real64 TotCapTempModFacH2( 0.0 ); // Tot capacity modifier (function of entering wetbulb, outside drybulb) at H2 Test [-]
-		static Real64 EIRTempModFacH2( 0.0 ); // EIR modifier (function of entering wetbulb, outside drybulb)  at H2 Test[-]
-		static Real64 TotCapTempModFacH3( 0.0 ); // Tot capacity modifier (function of entering wetbulb, outside drybulb) at H3 Test [-]
-		static Real64 EIRTempModFacH3( 0.0 ); // EIR modifier (function of entering wetbulb, outside drybulb)  at H3 Test[-]
-
-		static Real64 OATempCompressorOff( 0.0 ); // Minimum outdoor air temperature to turn the commpressor off
-		static Real64 PartLoadRatio( 0.0 ); // compressor cycling ratio between successive speeds, [-]
-		static Real64 PartLoadFraction( 0.0 ); // part-load fraction that account for the cyclic degradation, [-]
-
-		static Real64 NetHeatingCapWeighted( 0.0 ); // net total heating cap weighted by the fraction of the binned cooling hours [W]
-		static Real64 TotHeatingElecPowerWeighted( 0.0 ); // net total heat pump and resistance heating electric Energy input weighted by
+
+
 		// the fraction of the binned cooling hours
-		static Real64 BuildingHeatingLoad( 0.0 ); // Building space heating load corresponding to an outdoor bin temperature [W]
-		static Real64 NetTotHeatCapBinned( 0.0 ); // Net tot heatinging cap corresponding to an outdoor bin temperature [W]
-		static Real64 TotHeatElecPowerBinnedHP( 0.0 ); // Total Heat Pump heating electric power consumption at outdoor bin temp [W]
-		static Real64 TotHeatElecPowerBinnedRH( 0.0 ); // Total Resistance heating electric power consumption at outdoor bin temp [W]
 
 		Real64 LoadFactor; // Fractional "on" time for last stage at the desired reduced capacity, (dimensionless)
-		static Real64 LowTempCutOutFactor( 0.0 ); // Factor which corresponds to compressor operation depending on outdoor temperature
 
-		static Real64 FractionalBinHours( 0.0 ); // Fractional bin hours for the heating season  [-]
-		static Real64 DemandDeforstCredit( 1.0 ); // A factor to adjust HSPF if coil has demand defrost control  [-]
-		static Real64 DesignHeatingRequirement( 0.0 ); // The amount of heating required to maintain a given indoor temperature
 		// at a particular outdoor design temperature.  [W]
-		static Real64 DesignHeatingRequirementMin( 0.0 ); // minimum design heating requirement [W]
-		static Real64 DesignHeatingRequirementMax( 0.0 ); // maximum design heating requirement [W]
 		int BinNum; // bin number counter
 		int spnum; // compressor speed number
 		int StandardDHRNum; // Integer counter for standardized DHRs
@@ -1901,53 +2136,53 @@ namespace StandardRatings {
 		NetHeatingCapRatedLowTemp = TotHeatCapTestH3( nsp );
 
 		if ( RegionNum == 5 ) {
-			DesignHeatingRequirementMin = NetHeatingCapRatedHighTemp;
+			MultiSpeedDXHeatingCoilStandardRatingsDesignHeatingRequirementMin = NetHeatingCapRatedHighTemp;
 			DesignHeatingRequirementMax = 2.20 * NetHeatingCapRatedHighTemp;
 		} else {
-			DesignHeatingRequirementMin = NetHeatingCapRatedHighTemp * ( 18.33 - OutdoorDesignTemperature( RegionNum ) ) / ( 60.0 / 1.80 );
-			DesignHeatingRequirementMax = 2.20 * DesignHeatingRequirementMin;
+			MultiSpeedDXHeatingCoilStandardRatingsDesignHeatingRequirementMin = NetHeatingCapRatedHighTemp * ( 18.33 - OutdoorDesignTemperature( RegionNum ) ) / ( 60.0 / 1.80 );
+			DesignHeatingRequirementMax = 2.20 * MultiSpeedDXHeatingCoilStandardRatingsDesignHeatingRequirementMin;
 		}
 		// Set the Design Heating Requirement to nearest standard value (From Table 18, AHRI/ANSI Std 210/240)
 		for ( StandardDHRNum = 1; StandardDHRNum <= TotalNumOfStandardDHRs - 1; ++StandardDHRNum ) {
-			if ( DesignHeatingRequirementMin < StandardDesignHeatingRequirement( 1 ) ) {
+			if ( MultiSpeedDXHeatingCoilStandardRatingsDesignHeatingRequirementMin < StandardDesignHeatingRequirement( 1 ) ) {
 
-				DesignHeatingRequirement = min( StandardDesignHeatingRequirement( 1 ), DesignHeatingRequirementMax );
+				MultiSpeedDXHeatingCoilStandardRatingsDesignHeatingRequirement = min( StandardDesignHeatingRequirement( 1 ), DesignHeatingRequirementMax );
 
-			} else if ( DesignHeatingRequirementMin >= StandardDesignHeatingRequirement( StandardDHRNum ) && DesignHeatingRequirementMin < StandardDesignHeatingRequirement( StandardDHRNum + 1 ) ) {
-				if ( ( DesignHeatingRequirementMin - StandardDesignHeatingRequirement( StandardDHRNum ) ) > ( StandardDesignHeatingRequirement( StandardDHRNum + 1 ) - DesignHeatingRequirementMin ) ) {
+			} else if ( MultiSpeedDXHeatingCoilStandardRatingsDesignHeatingRequirementMin >= StandardDesignHeatingRequirement( StandardDHRNum ) && MultiSpeedDXHeatingCoilStandardRatingsDesignHeatingRequirementMin < StandardDesignHeatingRequirement( StandardDHRNum + 1 ) ) {
+				if ( ( MultiSpeedDXHeatingCoilStandardRatingsDesignHeatingRequirementMin - StandardDesignHeatingRequirement( StandardDHRNum ) ) > ( StandardDesignHeatingRequirement( StandardDHRNum + 1 ) - MultiSpeedDXHeatingCoilStandardRatingsDesignHeatingRequirementMin ) ) {
 
-					DesignHeatingRequirement = min( StandardDesignHeatingRequirement( StandardDHRNum + 1 ), DesignHeatingRequirementMax );
+					MultiSpeedDXHeatingCoilStandardRatingsDesignHeatingRequirement = min( StandardDesignHeatingRequirement( StandardDHRNum + 1 ), DesignHeatingRequirementMax );
 				} else {
-					DesignHeatingRequirement = min( StandardDesignHeatingRequirement( StandardDHRNum ), DesignHeatingRequirementMax );
+					MultiSpeedDXHeatingCoilStandardRatingsDesignHeatingRequirement = min( StandardDesignHeatingRequirement( StandardDHRNum ), DesignHeatingRequirementMax );
 				}
-			} else if ( DesignHeatingRequirementMin >= StandardDesignHeatingRequirement( TotalNumOfStandardDHRs ) ) {
-				DesignHeatingRequirement = min( StandardDesignHeatingRequirement( StandardDHRNum ), DesignHeatingRequirementMax );
+			} else if ( MultiSpeedDXHeatingCoilStandardRatingsDesignHeatingRequirementMin >= StandardDesignHeatingRequirement( TotalNumOfStandardDHRs ) ) {
+				MultiSpeedDXHeatingCoilStandardRatingsDesignHeatingRequirement = min( StandardDesignHeatingRequirement( StandardDHRNum ), DesignHeatingRequirementMax );
 			}
 		}
 		// The minimum temperature below which the compressor is turned off
-		OATempCompressorOff = MinOATCompressor;
+		MultiSpeedDXHeatingCoilStandardRatingsOATempCompressorOff = MinOATCompressor;
 
 		for ( BinNum = 1; BinNum <= TotalNumOfTemperatureBins( RegionNum ); ++BinNum ) { //NumOfOATempBins
 
 			{ auto const SELECT_CASE_var( RegionNum );
 			if ( SELECT_CASE_var == 1 ) {
-				FractionalBinHours = RegionOneFracBinHoursAtOutdoorBinTemp( BinNum );
+				MultiSpeedDXHeatingCoilStandardRatingsFractionalBinHours = RegionOneFracBinHoursAtOutdoorBinTemp( BinNum );
 			} else if ( SELECT_CASE_var == 2 ) {
-				FractionalBinHours = RegionTwoFracBinHoursAtOutdoorBinTemp( BinNum );
+				MultiSpeedDXHeatingCoilStandardRatingsFractionalBinHours = RegionTwoFracBinHoursAtOutdoorBinTemp( BinNum );
 			} else if ( SELECT_CASE_var == 3 ) {
-				FractionalBinHours = RegionThreeFracBinHoursAtOutdoorBinTemp( BinNum );
+				MultiSpeedDXHeatingCoilStandardRatingsFractionalBinHours = RegionThreeFracBinHoursAtOutdoorBinTemp( BinNum );
 			} else if ( SELECT_CASE_var == 4 ) {
-				FractionalBinHours = RegionFourFracBinHoursAtOutdoorBinTemp( BinNum );
+				MultiSpeedDXHeatingCoilStandardRatingsFractionalBinHours = RegionFourFracBinHoursAtOutdoorBinTemp( BinNum );
 			} else if ( SELECT_CASE_var == 5 ) {
-				FractionalBinHours = RegionFiveFracBinHoursAtOutdoorBinTemp( BinNum );
+				MultiSpeedDXHeatingCoilStandardRatingsFractionalBinHours = RegionFiveFracBinHoursAtOutdoorBinTemp( BinNum );
 			} else if ( SELECT_CASE_var == 6 ) {
-				FractionalBinHours = RegionSixFracBinHoursAtOutdoorBinTemp( BinNum );
+				MultiSpeedDXHeatingCoilStandardRatingsFractionalBinHours = RegionSixFracBinHoursAtOutdoorBinTemp( BinNum );
 			} else {
-				FractionalBinHours = RegionFourFracBinHoursAtOutdoorBinTemp( BinNum );
+				MultiSpeedDXHeatingCoilStandardRatingsFractionalBinHours = RegionFourFracBinHoursAtOutdoorBinTemp( BinNum );
 			}}
 
 			// Calculate the building heating load
-			BuildingHeatingLoad = ( 18.33 - OutdoorBinTemperature( BinNum ) ) / ( 18.33 - OutdoorDesignTemperature( RegionNum ) ) * CorrectionFactor * DesignHeatingRequirement;
+			BuildingHeatingLoad = ( 18.33 - OutdoorBinTemperature( BinNum ) ) / ( 18.33 - OutdoorDesignTemperature( RegionNum ) ) * CorrectionFactor * MultiSpeedDXHeatingCoilStandardRatingsDesignHeatingRequirement;
 
 			if ( ( OutdoorBinTemperature( BinNum ) <= -8.33 ) || ( OutdoorBinTemperature( BinNum ) >= 7.20 ) ) {
 				HeatingCapacityMax = TotHeatCapTestH3( nsp ) + ( ( TotHeatCapTestH1( nsp ) - TotHeatCapTestH3( nsp ) ) * ( OutdoorBinTemperature( BinNum ) - HeatingOutdoorCoilInletAirDBTempH3Test ) / ( HeatingOutdoorCoilInletAirDBTempRated - HeatingOutdoorCoilInletAirDBTempH3Test ) );
@@ -1979,25 +2214,25 @@ namespace StandardRatings {
 					HeatingCapacityHS = TotHeatCapTestH3( spnum + 1 ) + ( ( TotHeatCapTestH2( spnum + 1 ) - TotHeatCapTestH3( spnum + 1 ) ) * ( OutdoorBinTemperature( BinNum ) - HeatingOutdoorCoilInletAirDBTempH3Test ) / ( HeatingOutdoorCoilInletAirDBTempH2Test - HeatingOutdoorCoilInletAirDBTempH3Test ) );
 					HeatingElecPowerHS = OutdoorUnitPowerTestH3( spnum + 1 ) + ( ( OutdoorUnitPowerTestH2( spnum + 1 ) - OutdoorUnitPowerTestH3( spnum + 1 ) ) * ( OutdoorBinTemperature( BinNum ) - HeatingOutdoorCoilInletAirDBTempH3Test ) / ( HeatingOutdoorCoilInletAirDBTempH2Test - HeatingOutdoorCoilInletAirDBTempH3Test ) );
 				}
-				LowTempCutOutFactor = 0.0;
+				MultiSpeedDXHeatingCoilStandardRatingsLowTempCutOutFactor = 0.0;
 				if ( ! OATempCompressorOnOffBlank ) {
-					if ( OutdoorBinTemperature( BinNum ) <= OATempCompressorOff ) {
-						LowTempCutOutFactor = 0.0;
-					} else if ( OutdoorBinTemperature( BinNum ) > OATempCompressorOff && OutdoorBinTemperature( BinNum ) <= OATempCompressorOn ) {
-						LowTempCutOutFactor = 0.5;
+					if ( OutdoorBinTemperature( BinNum ) <= MultiSpeedDXHeatingCoilStandardRatingsOATempCompressorOff ) {
+						MultiSpeedDXHeatingCoilStandardRatingsLowTempCutOutFactor = 0.0;
+					} else if ( OutdoorBinTemperature( BinNum ) > MultiSpeedDXHeatingCoilStandardRatingsOATempCompressorOff && OutdoorBinTemperature( BinNum ) <= OATempCompressorOn ) {
+						MultiSpeedDXHeatingCoilStandardRatingsLowTempCutOutFactor = 0.5;
 					} else {
-						LowTempCutOutFactor = 1.0;
+						MultiSpeedDXHeatingCoilStandardRatingsLowTempCutOutFactor = 1.0;
 					}
 				} else {
-					LowTempCutOutFactor = 1.0;
+					MultiSpeedDXHeatingCoilStandardRatingsLowTempCutOutFactor = 1.0;
 				}
 
 				if ( BuildingHeatingLoad <= HeatingCapacityLS ) {
-					if ( HeatingCapacityLS > 0.0 ) PartLoadRatio = min( 1.0, BuildingHeatingLoad / HeatingCapacityLS );
+					if ( HeatingCapacityLS > 0.0 ) MultiSpeedDXHeatingCoilStandardRatingsPartLoadRatio = min( 1.0, BuildingHeatingLoad / HeatingCapacityLS );
 					NetTotHeatCapBinned = BuildingHeatingLoad;
-					PartLoadFraction = 1.0 - CyclicDegradationCoeff * ( 1.0 - PartLoadRatio );
-					TotHeatElecPowerBinnedHP = ( PartLoadRatio / PartLoadFraction ) * HeatingElecPowerLS * LowTempCutOutFactor;
-					TotHeatElecPowerBinnedRH = BuildingHeatingLoad * ( 1.0 - LowTempCutOutFactor );
+					MultiSpeedDXHeatingCoilStandardRatingsPartLoadFraction = 1.0 - CyclicDegradationCoeff * ( 1.0 - MultiSpeedDXHeatingCoilStandardRatingsPartLoadRatio );
+					TotHeatElecPowerBinnedHP = ( MultiSpeedDXHeatingCoilStandardRatingsPartLoadRatio / MultiSpeedDXHeatingCoilStandardRatingsPartLoadFraction ) * HeatingElecPowerLS * MultiSpeedDXHeatingCoilStandardRatingsLowTempCutOutFactor;
+					TotHeatElecPowerBinnedRH = BuildingHeatingLoad * ( 1.0 - MultiSpeedDXHeatingCoilStandardRatingsLowTempCutOutFactor );
 
 					goto HeatSpeedLoop_exit;
 
@@ -2008,45 +2243,45 @@ namespace StandardRatings {
 
 					NetTotHeatCapBinned = BuildingHeatingLoad;
 					TotHeatElecPowerBinnedHP = LoadFactor * HeatingElecPowerLS + ( 1.0 - LoadFactor ) * HeatingElecPowerHS;
-					TotHeatElecPowerBinnedHP *= LowTempCutOutFactor;
-					TotHeatElecPowerBinnedRH = BuildingHeatingLoad * ( 1.0 - LowTempCutOutFactor );
+					TotHeatElecPowerBinnedHP *= MultiSpeedDXHeatingCoilStandardRatingsLowTempCutOutFactor;
+					TotHeatElecPowerBinnedRH = BuildingHeatingLoad * ( 1.0 - MultiSpeedDXHeatingCoilStandardRatingsLowTempCutOutFactor );
 
 					goto HeatSpeedLoop_exit;
 
 				} else if ( BuildingHeatingLoad >= HeatingCapacityMax ) {
 					NetTotHeatCapBinned = BuildingHeatingLoad;
 					if ( ! OATempCompressorOnOffBlank && HeatingElecPowerMax > 0.0 ) {
-						if ( ( OutdoorBinTemperature( BinNum ) <= OATempCompressorOff ) || ( HeatingCapacityMax / HeatingElecPowerMax < 1.0 ) ) {
-							LowTempCutOutFactor = 0.0;
-						} else if ( ( OutdoorBinTemperature( BinNum ) > OATempCompressorOff && OutdoorBinTemperature( BinNum ) <= OATempCompressorOn ) && ( HeatingCapacityMax / HeatingElecPowerMax > 1.0 ) ) {
-							LowTempCutOutFactor = 0.5;
+						if ( ( OutdoorBinTemperature( BinNum ) <= MultiSpeedDXHeatingCoilStandardRatingsOATempCompressorOff ) || ( HeatingCapacityMax / HeatingElecPowerMax < 1.0 ) ) {
+							MultiSpeedDXHeatingCoilStandardRatingsLowTempCutOutFactor = 0.0;
+						} else if ( ( OutdoorBinTemperature( BinNum ) > MultiSpeedDXHeatingCoilStandardRatingsOATempCompressorOff && OutdoorBinTemperature( BinNum ) <= OATempCompressorOn ) && ( HeatingCapacityMax / HeatingElecPowerMax > 1.0 ) ) {
+							MultiSpeedDXHeatingCoilStandardRatingsLowTempCutOutFactor = 0.5;
 						} else if ( ( OutdoorBinTemperature( BinNum ) > OATempCompressorOn ) && ( HeatingCapacityMax / HeatingElecPowerMax > 1.0 ) ) {
-							LowTempCutOutFactor = 1.0;
+							MultiSpeedDXHeatingCoilStandardRatingsLowTempCutOutFactor = 1.0;
 						}
 					} else {
-						LowTempCutOutFactor = 1.0;
+						MultiSpeedDXHeatingCoilStandardRatingsLowTempCutOutFactor = 1.0;
 					}
 
-					TotHeatElecPowerBinnedHP = HeatingElecPowerMax * LowTempCutOutFactor;
-					TotHeatElecPowerBinnedRH = BuildingHeatingLoad - HeatingCapacityMax * LowTempCutOutFactor;
+					TotHeatElecPowerBinnedHP = HeatingElecPowerMax * MultiSpeedDXHeatingCoilStandardRatingsLowTempCutOutFactor;
+					TotHeatElecPowerBinnedRH = BuildingHeatingLoad - HeatingCapacityMax * MultiSpeedDXHeatingCoilStandardRatingsLowTempCutOutFactor;
 
 					goto HeatSpeedLoop_exit;
 				}
 			}
 			HeatSpeedLoop_exit: ;
 
-			NetHeatingCapWeighted += NetTotHeatCapBinned * FractionalBinHours;
-			TotHeatingElecPowerWeighted += ( TotHeatElecPowerBinnedHP + TotHeatElecPowerBinnedRH ) * FractionalBinHours;
+			NetHeatingCapWeighted += NetTotHeatCapBinned * MultiSpeedDXHeatingCoilStandardRatingsFractionalBinHours;
+			TotHeatingElecPowerWeighted += ( TotHeatElecPowerBinnedHP + TotHeatElecPowerBinnedRH ) * MultiSpeedDXHeatingCoilStandardRatingsFractionalBinHours;
 		}
 
 		if ( DefrostControl == Timed ) {
-			DemandDeforstCredit = 1.0; // Timed defrost control
+			MultiSpeedDXHeatingCoilStandardRatingsDemandDeforstCredit = 1.0; // Timed defrost control
 		} else {
-			DemandDeforstCredit = 1.03; // Demand defrost control
+			MultiSpeedDXHeatingCoilStandardRatingsDemandDeforstCredit = 1.03; // Demand defrost control
 		}
 
 		if ( TotHeatingElecPowerWeighted > 0.0 ) {
-			HSPF = NetHeatingCapWeighted * DemandDeforstCredit / TotHeatingElecPowerWeighted;
+			HSPF = NetHeatingCapWeighted * MultiSpeedDXHeatingCoilStandardRatingsDemandDeforstCredit / TotHeatingElecPowerWeighted;
 		} else {
 			HSPF = 0.0;
 		}
@@ -2113,8 +2348,6 @@ namespace StandardRatings {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyCoolOneTimeFlag( true );
-		static bool MyHeatOneTimeFlag( true );
 
 		// Formats
 		static gio::Fmt Format_990( "('! <DX Cooling Coil Standard Rating Information>, Component Type, Component Name, ','Standard Rating (Net) Cooling Capacity {W}, ','Standard Rated Net COP {W/W}, ','EER {Btu/W-h}, ','SEER {Btu/W-h}, ','IEER {Btu/W-h}')" );
@@ -2223,11 +2456,8 @@ namespace StandardRatings {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyCoolOneTimeFlag( true );
 		int ClassNum; // class number (Class I, II, II, IV)
 		int Num; // text number counter
-		static std::string ClassName;
-		static std::string CompNameNew;
 
 		// Formats
 		static gio::Fmt Format_101( "('! <DX Cooling Coil ASHRAE 127 Standard Ratings Information>, Component Type, Component Name, Standard 127 Classification, ','Rated Net Cooling Capacity Test A {W}, ','Rated Total Electric Power Test A {W}, ','Rated Net Cooling Capacity Test B {W}, ','Rated Total Electric Power Test B {W}, ','Rated Net Cooling Capacity Test C {W}, ','Rated Total Electric Power Test C {W}, ','Rated Net Cooling Capacity Test D {W}, ','Rated Total Electric Power Test D {W} ')" );
@@ -2237,9 +2467,9 @@ namespace StandardRatings {
 		{ auto const SELECT_CASE_var( CompTypeNum );
 
 		if ( SELECT_CASE_var == CoilDX_CoolingSingleSpeed ) {
-			if ( MyCoolOneTimeFlag ) {
+			if ( ReportDXCoolCoilDataCenterApplicationMyCoolOneTimeFlag ) {
 				gio::write( OutputFileInits, Format_101 );
-				MyCoolOneTimeFlag = false;
+				ReportDXCoolCoilDataCenterApplicationMyCoolOneTimeFlag = false;
 			}
 			for ( ClassNum = 1; ClassNum <= 4; ++ClassNum ) {
 				Num = ( ClassNum - 1 ) * 4;
@@ -2320,59 +2550,23 @@ namespace StandardRatings {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		//  Minimum and Maximum independent variable limits from Total Cooling Capacity Function of Temperature Curve
-		static Real64 CapacityWBTempMin( 0.0 ); // Capacity modifier Min value (wet bulb temperature), from the Curve:BiQuadratic object
-		static Real64 CapacityWBTempMax( 0.0 ); // Capacity modifier Max value (wet bulb temperature), from the Curve:BiQuadratic object
-		static Real64 CapacityDBTempMin( 0.0 ); // Capacity modifier Min value (dry bulb temperature), from the Curve:BiQuadratic object
-		static Real64 CapacityDBTempMax( 0.0 ); // Capacity modifier Max value (dry bulb temperature), from the Curve:BiQuadratic object
 
 		//  Minimum and Maximum independent variable limits from Energy Input Ratio (EIR) Function of Temperature Curve
-		static Real64 EIRWBTempMin( 0.0 ); // EIR modifier Min value (wet bulb temperature), from the Curve:BiQuadratic object
-		static Real64 EIRWBTempMax( 0.0 ); // EIR modifier Max value (wet bulb temperature), from the Curve:BiQuadratic object
-		static Real64 EIRDBTempMin( 0.0 ); // EIR modifier Min value (dry bulb temperature), from the Curve:BiQuadratic object
-		static Real64 EIRDBTempMax( 0.0 ); // EIR modifier Max value (dry bulb temperature), from the Curve:BiQuadratic object
 
 		//  Minimum and Maximum independent variable limits from Part Load Fraction Correlation Curve
-		static Real64 PLFFPLRMin( 0.0 ); // Maximum value for Part Load Ratio, from the corresponding curve object
-		static Real64 PLFFPLRMax( 0.0 ); // Minimum value for Part Load Ratio, from the corresponding curve object
 
 		//  Minimum and Maximum independent variable limits from Total Cooling Capacity Function of Flow Fraction Curve
-		static Real64 CapacityFlowRatioMin( 0.0 ); // Minimum value for flow fraction, from the corresponding curve object
-		static Real64 CapacityFlowRatioMax( 0.0 ); // Maximum value for flow fraction, from the corresponding curve object
 
 		//  Minimum and Maximum independent variable limits from Energy Input Ratio Function of Flow Fraction Curve
-		static Real64 EIRFlowRatioMin( 0.0 ); // Minimum value for flow fraction, from the corresponding curve object
-		static Real64 EIRFlowRatioMax( 0.0 ); // Maximum value for flow fraction, from the corresponding curve object
 
 		//  Minimum and Maximum independent variable limits from Total Cooling Capacity Function of Temperature Curve
-		static Real64 HeatingCapODBTempMin( 0.0 ); // Capacity modifier Min value (outdoor dry bulb temperature)
-		static Real64 HeatingCapODBTempMax( 0.0 ); // Capacity modifier Max value (outdoor dry bulb temperature)
-		static Real64 HeatingCapIDBTempMin( 0.0 ); // Capacity modifier Min value (indoor dry bulb temperature)
-		static Real64 HeatingCapIDBTempMax( 0.0 ); // Capacity modifier Max value (indoor dry bulb temperature)
 
 		//  Minimum and Maximum independent variable limits from Energy Input Ratio (EIR) Function of Temperature Curve
-		static Real64 HeatingEIRODBTempMin( 0.0 ); // EIR modifier Min value (outdoor dry bulb temperature)
-		static Real64 HeatingEIRODBTempMax( 0.0 ); // EIR modifier Max value (outdoor dry bulb temperature)
-		static Real64 HeatingEIRIDBTempMin( 0.0 ); // EIR modifier Min value (indoor dry bulb temperature)
-		static Real64 HeatingEIRIDBTempMax( 0.0 ); // EIR modifier Max value (indoor dry bulb temperature)
-
-		static bool CapCurveOATLimitsExceeded( false ); // Logical for capacity curve OD temp. limits being exceeded (low and High)
-		static bool CapCurveHighOATLimitsExceeded( false ); // Logical for capacity curve temperature limits being exceeded (high temp)
-		static bool CapCurveFlowLimitsExceeded( false ); // Logical for capacity curve flow fraction limits being exceeded
-		static bool EIRCurveHighOATLimitsExceeded( false ); // Logical for EIR curve temperature limits being exceeded (high temp)
-		static bool EIRCurveFlowLimitsExceeded( false ); // Logical for EIR curve flow fraction limits being exceeded
-
-		static bool CapCurveMidOATLimitsExceeded( false ); // Logical for capacity curve temperature limits being exceeded (mid temp)
-		static bool EIRCurveMidOATLimitsExceeded( false ); // Logical for EIR curve temperature limits being exceeded (mid temp)
-		static bool CapCurveLowOATLimitsExceeded( false ); // Logical for capacity curve temperature limits being exceeded (low temp)
-		static bool EIRCurveLowOATLimitsExceeded( false ); // Logical for EIR curve temperature limits being exceeded (Low temp)
-		static bool PLFfPLRforSEERLimitsExceeded( false ); // Logical for PLF function of PLR limits being exceeded
-
-		static bool CapCurveIEERLimitsExceeded( false ); // Logical for capacity curve temperature limits being exceeded (IEER calcs)
-		static bool EIRCurveIEERLimitsExceeded( false ); // Logical for EIR temperature limits being exceeded (IEER calcs)
-
-		static bool HeatingCapCurveHSPFLimitsExceeded( false ); // Logical for capacity curve temperature limits being exceeded
+
+
+
+
 		// (HSPF calcs)
-		static bool HeatingEIRCurveHSPFLimitsExceeded( false ); // Logical for EIR curve temperature limits being exceeded
 		// (HSPF calcs)
 
 		{ auto const SELECT_CASE_var( DXCoilTypeNum );
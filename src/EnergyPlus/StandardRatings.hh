@@ -151,6 +151,11 @@ namespace StandardRatings {
 
 	// Functions
 
+	// Clears the global data in StandardRatings.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	CalcChillerIPLV(
 		std::string const & ChillerName, // Name of Chiller for which IPLV is calculated
@@ -0,0 +1,573 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// EnergyPlus Headers
+#include <StateManagement.hh>
+#include <AirflowNetworkBalanceManager.hh>
+#include <AirflowNetworkSolver.hh>
+#include <BaseboardElectric.hh>
+#include <BaseboardRadiator.hh>
+#include <Boilers.hh>
+#include <BoilerSteam.hh>
+#include <BranchInputManager.hh>
+#include <BranchNodeConnections.hh>
+#include <ChilledCeilingPanelSimple.hh>
+#include <Checkpoint.hh>
+#include <ChillerAbsorption.hh>
+#include <ChillerElectricEIR.hh>
+#include <ChillerExhaustAbsorption.hh>
+#include <ChillerGasAbsorption.hh>
+#include <ChillerIndirectAbsorption.hh>
+#include <ChillerReformulatedEIR.hh>
+#include <CondenserLoopTowers.hh>
+#include <ConductionTransferFunctionCalc.hh>
+#include <ConvectionCoefficients.hh>
+#include <CoolTower.hh>
+#include <CostEstimateManager.hh>
+#include <CrossVentMgr.hh>
+#include <CTElectricGenerator.hh>
+#include <CurveManager.hh>
+#include <DataAirflowNetwork.hh>
+#include <DataAirLoop.hh>
+#include <DataBranchAirLoopPlant.hh>
+#include <DataAirSystems.hh>
+#include <DataBranchNodeConnections.hh>
+#include <DataBSDFWindow.hh>
+#include <DataContaminantBalance.hh>
+#include <DataConvergParams.hh>
+#include <DataCostEstimate.hh>
+#include <DataDaylighting.hh>
+#include <DataDaylightingDevices.hh>
+#include <DataDefineEquip.hh>
+#include <DataEnvironment.hh>
+#include <DataErrorTracking.hh>
+#include <DataGenerators.hh>
+#include <DataGlobals.hh>
+#include <DataHeatBalance.hh>
+#include <DataHeatBalFanSys.hh>
+#include <DataHeatBalSurface.hh>
+#include <DataHVACGlobals.hh>
+#include <DataIPShortCuts.hh>
+#include <DataLoopNode.hh>
+#include <DataMoistureBalance.hh>
+#include <DataMoistureBalanceEMPD.hh>
+#include <DataOutputs.hh>
+#include <DataPhotovoltaics.hh>
+#include <DataPlant.hh>
+#include <DataPlantPipingSystems.hh>
+#include <DataReportingFlags.hh>
+#include <DataRoomAirModel.hh>
+#include <DataRootFinder.hh>
+#include <DataRuntimeLanguage.hh>
+#include <DataShadowingCombinations.hh>
+#include <DataSizing.hh>
+#include <DataSurfaceColors.hh>
+#include <DataSurfaceLists.hh>
+#include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
+#include <DataTimings.hh>
+#include <DataUCSDSharedData.hh>
+#include <DataViewFactorInformation.hh>
+#include <DataWater.hh>
+#include <DataWindowEquivalentLayer.hh>
+#include <DataZoneControls.hh>
+#include <DataZoneEnergyDemands.hh>
+#include <DataZoneEquipment.hh>
+#include <DaylightingDevices.hh>
+#include <DaylightingManager.hh>
+#include <DemandManager.hh>
+#include <DElightManagerF.hh>
+#include <DesiccantDehumidifiers.hh>
+#include <DirectAirManager.hh>
+#include <DisplacementVentMgr.hh>
+#include <DualDuct.hh>
+#include <DXCoils.hh>
+#include <DXFEarClipping.hh>
+#include <EarthTube.hh>
+#include <EconomicLifeCycleCost.hh>
+#include <EconomicTariff.hh>
+#include <EcoRoofManager.hh>
+#include <ElectricBaseboardRadiator.hh>
+#include <ElectricPowerServiceManager.hh>
+#include <EMSManager.hh>
+#include <EvaporativeCoolers.hh>
+#include <EvaporativeFluidCoolers.hh>
+#include <ExteriorEnergyUse.hh>
+#include <ExternalInterface.hh>
+#include <FanCoilUnits.hh>
+#include <Fans.hh>
+#include <FaultsManager.hh>
+#include <FluidCoolers.hh>
+#include <FuelCellElectricGenerator.hh>
+#include <Furnaces.hh>
+#include <FileSystem.hh>
+#include <FluidProperties.hh>
+#include <General.hh>
+#include <GeneralRoutines.hh>
+#include <GeneratorDynamicsManager.hh>
+#include <GeneratorFuelSupply.hh>
+#include <GlobalNames.hh>
+#include <GroundHeatExchangers.hh>
+#include <GroundTemperatureModeling/GroundTemperatureModelManager.hh>
+#include <HeatBalanceAirManager.hh>
+#include <HeatBalanceHAMTManager.hh>
+#include <HeatBalanceIntRadExchange.hh>
+#include <HeatBalanceManager.hh>
+#include <HeatBalanceSurfaceManager.hh>
+#include <HeatBalFiniteDiffManager.hh>
+#include <HeatPumpWaterToWaterCOOLING.hh>
+#include <HeatPumpWaterToWaterHEATING.hh>
+#include <HeatPumpWaterToWaterSimple.hh>
+#include <HeatRecovery.hh>
+#include <HeatingCoils.hh>
+#include <HighTempRadiantSystem.hh>
+#include <Humidifiers.hh>
+#include <HVACControllers.hh>
+#include <HVACCooledBeam.hh>
+#include <HVACDuct.hh>
+#include <HVACDXHeatPumpSystem.hh>
+#include <HVACDXSystem.hh>
+#include <HVACFourPipeBeam.hh>
+#include <HVACHXAssistedCoolingCoil.hh>
+#include <HVACInterfaceManager.hh>
+#include <HVACManager.hh>
+#include <HVACMultiSpeedHeatPump.hh>
+#include <HVACSingleDuctInduc.hh>
+#include <HVACUnitaryBypassVAV.hh>
+#include <HVACUnitarySystem.hh>
+#include <HVACVariableRefrigerantFlow.hh>
+#include <HWBaseboardRadiator.hh>
+#include <ICEngineElectricGenerator.hh>
+#include <IceThermalStorage.hh>
+#include <InputProcessor.hh>
+#include <IntegratedHeatPump.hh>
+#include <InternalHeatGains.hh>
+#include <LowTempRadiantSystem.hh>
+#include <MatrixDataManager.hh>
+#include <MicroCHPElectricGenerator.hh>
+#include <MicroturbineElectricGenerator.hh>
+#include <MixedAir.hh>
+#include <MixerComponent.hh>
+#include <MundtSimMgr.hh>
+#include <NodeInputManager.hh>
+#include <NonZoneEquipmentManager.hh>
+#include <OutAirNodeManager.hh>
+#include <OutdoorAirUnit.hh>
+#include <OutputProcessor.hh>
+#include <OutputReportPredefined.hh>
+#include <OutputReports.hh>
+#include <OutputReportTabular.hh>
+#include <OutputReportTabularAnnual.hh>
+#include <OutsideEnergySources.hh>
+#include <PackagedTerminalHeatPump.hh>
+#include <PackagedThermalStorageCoil.hh>
+#include <Photovoltaics.hh>
+#include <PhotovoltaicThermalCollectors.hh>
+#include <PipeHeatTransfer.hh>
+#include <Pipes.hh>
+#include <PlantCentralGSHP.hh>
+#include <PlantComponentTemperatureSources.hh>
+#include <PlantCondLoopOperation.hh>
+#include <PlantChillers.hh>
+#include <PlantHeatExchangerFluidToFluid.hh>
+#include <PlantLoadProfile.hh>
+#include <PlantLoopSolver.hh>
+#include <PlantManager.hh>
+#include <PlantPipingSystemsManager.hh>
+#include <PlantPressureSystem.hh>
+#include <PlantUtilities.hh>
+#include <PlantValves.hh>
+#include <PollutionModule.hh>
+#include <PondGroundHeatExchanger.hh>
+#include <PoweredInductionUnits.hh>
+#include <Psychrometrics.hh>
+#include <Pumps.hh>
+#include <PurchasedAirManager.hh>
+#include <RefrigeratedCase.hh>
+#include <ReportSizingManager.hh>
+#include <ReturnAirPathManager.hh>
+#include <RoomAirModelAirflowNetwork.hh>
+#include <RoomAirModelManager.hh>
+#include <RoomAirModelUserTempPattern.hh>
+#include <RuntimeLanguageProcessor.hh>
+#include <ScheduleManager.hh>
+#include <SetPointManager.hh>
+#include <SimAirServingZones.hh>
+#include <SimulationManager.hh>
+#include <SingleDuct.hh>
+#include <SizingAnalysisObjects.hh>
+#include <SizingManager.hh>
+#include <SolarCollectors.hh>
+#include <SolarReflectionManager.hh>
+#include <SolarShading.hh>
+#include <SortAndStringUtilities.hh>
+#include <SplitterComponent.hh>
+#include <HVACStandAloneERV.hh>
+#include <StandardRatings.hh>
+#include <SteamBaseboardRadiator.hh>
+#include <SteamCoils.hh>
+#include <SurfaceGeometry.hh>
+#include <SurfaceGroundHeatExchanger.hh>
+#include <SystemAvailabilityManager.hh>
+#include <SwimmingPool.hh>
+#include <SystemReports.hh>
+#include <TARCOGCommon.hh>
+#include <TARCOGGasses90.hh>
+#include <TARCOGMain.hh>
+#include <TARCOGOutput.hh>
+#include <TarcogShading.hh>
+#include <ThermalChimney.hh>
+#include <ThermalComfort.hh>
+#include <ThermalISO15099Calc.hh>
+#include <TranspiredCollector.hh>
+#include <UFADManager.hh>
+#include <UnitHeater.hh>
+#include <UnitVentilator.hh>
+#include <UserDefinedComponents.hh>
+#include <UtilityRoutines.hh>
+#include <VariableSpeedCoils.hh>
+#include <Vectors.hh>
+#include <VentilatedSlab.hh>
+#include <WaterCoils.hh>
+#include <WaterManager.hh>
+#include <WaterThermalTanks.hh>
+#include <WaterToAirHeatPump.hh>
+#include <WaterToAirHeatPumpSimple.hh>
+#include <WaterUse.hh>
+#include <WeatherManager.hh>
+#include <WindowAC.hh>
+#include <WindowComplexManager.hh>
+#include <WindowEquivalentLayer.hh>
+#include <WindowManager.hh>
+#include <WindTurbine.hh>
+#include <ZoneAirLoopEquipmentManager.hh>
+#include <ZoneContaminantPredictorCorrector.hh>
+#include <ZoneDehumidifier.hh>
+#include <ZoneEquipmentManager.hh>
+#include <ZonePlenum.hh>
+#include <ZoneTempPredictorCorrector.hh>
+#include <MoistureBalanceEMPDManager.hh>
+
+namespace EnergyPlus {
+
+namespace StateManagement {
+
+	// MODULE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   October 2016
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS MODULE:
+	// Return the program to the state it was in before the first input was processed, so that
+	// several simulations can be run one after another in the same process.
+
+	// METHODOLOGY EMPLOYED:
+	// Each module owns its own state and provides a clear_state function for it; this module
+	// calls all of them.  Function-local statics that carry state between calls are kept in the
+	// module namespaces so that the clear_state functions can reset them.  Output files are not touched here, they are closed by EndEnergyPlus.
+
+	void
+	clear_all_states()
+	{
+		// A to Z order
+		AirflowNetworkBalanceManager::clear_state();
+		AirflowNetworkSolver::clear_state();
+		BaseboardElectric::clear_state();
+		BaseboardRadiator::clear_state();
+		Boilers::clear_state();
+		BoilerSteam::clear_state();
+		BranchInputManager::clear_state();
+		Checkpoint::clear_state();
+		ChillerAbsorption::clear_state();
+		ChillerElectricEIR::clear_state();
+		ChillerReformulatedEIR::clear_state();
+		ConductionTransferFunctionCalc::clear_state();
+		ConvectionCoefficients::clear_state();
+		CoolingPanelSimple::clear_state();
+		ChillerExhaustAbsorption::clear_state();
+		ChillerGasAbsorption::clear_state();
+		ChillerIndirectAbsorption::clear_state();
+		CondenserLoopTowers::clear_state();
+		CoolTower::clear_state();
+		CostEstimateManager::clear_state();
+		CrossVentMgr::clear_state();
+		CTElectricGenerator::clear_state();
+		CurveManager::clear_state();
+		DataAirflowNetwork::clear_state();
+		DataAirLoop::clear_state();
+		DataBranchAirLoopPlant::clear_state();
+		DataAirSystems::clear_state();
+		DataBranchNodeConnections::clear_state();
+		DataBSDFWindow::clear_state();
+		DataContaminantBalance::clear_state();
+		DataConvergParams::clear_state();
+		DataCostEstimate::clear_state();
+		DataDaylighting::clear_state();
+		DataDaylightingDevices::clear_state();
+		DataDefineEquip::clear_state();
+		DataEnvironment::clear_state();
+		DataErrorTracking::clear_state();
+		DataGenerators::clear_state();
+		DataGlobals::clear_state();
+		DataHeatBalance::clear_state();
+		DataHeatBalFanSys::clear_state();
+		DataHeatBalSurface::clear_state();
+		DataHVACGlobals::clear_state();
+		DataIPShortCuts::clear_state();
+		DataLoopNode::clear_state();
+		DataMoistureBalance::clear_state();
+		DataMoistureBalanceEMPD::clear_state();
+		DataOutputs::clear_state();
+		DataPhotovoltaics::clear_state();
+		DataPlant::clear_state();
+		DataPlantPipingSystems::clear_state();
+		DataReportingFlags::clear_state();
+		DataRoomAirModel::clear_state();
+		DataRootFinder::clear_state();
+		DataRuntimeLanguage::clear_state();
+		DataShadowingCombinations::clear_state();
+		DataSizing::clear_state();
+		DataSurfaceColors::clear_state();
+		DataSurfaceLists::clear_state();
+		DataSurfaces::clear_state();
+		DataSystemVariables::clear_state();
+		DataTimings::clear_state();
+		DataUCSDSharedData::clear_state();
+		DataViewFactorInformation::clear_state();
+		DataWater::clear_state();
+		DataWindowEquivalentLayer::clear_state();
+		DataZoneControls::clear_state();
+		DataZoneEnergyDemands::clear_state();
+		DataZoneEquipment::clear_state();
+		DaylightingDevices::clear_state();
+		DaylightingManager::clear_state();
+		DemandManager::clear_state();
+		DesiccantDehumidifiers::clear_state();
+		DirectAirManager::clear_state();
+		DisplacementVentMgr::clear_state();
+		DualDuct::clear_state();
+		DXCoils::clear_state();
+		clearFacilityElectricPowerServiceObject();
+		DXFEarClipping::clear_state();
+		EarthTube::clear_state();
+		EconomicLifeCycleCost::clear_state();
+		EconomicTariff::clear_state();
+		EcoRoofManager::clear_state();
+		ElectricBaseboardRadiator::clear_state();
+		EMSManager::clear_state();
+		EvaporativeCoolers::clear_state();
+		EvaporativeFluidCoolers::clear_state();
+		ExteriorEnergyUse::clear_state();
+		ExternalInterface::clear_state();
+		FanCoilUnits::clear_state();
+		Fans::clear_state();
+		FaultsManager::clear_state();
+		FluidCoolers::clear_state();
+		FluidProperties::clear_state();
+		FourPipeBeam::clear_state();
+		FuelCellElectricGenerator::clear_state();
+		Furnaces::clear_state();
+		General::clear_state();
+		GeneralRoutines::clear_state();
+		GeneratorDynamicsManager::clear_state();
+		GeneratorFuelSupply::clear_state();
+		GlobalNames::clear_state();
+		GroundHeatExchangers::clear_state();
+		GroundTemperatureManager::clear_state();
+		HeatBalanceAirManager::clear_state();
+		HeatBalanceHAMTManager::clear_state();
+		HeatBalanceIntRadExchange::clear_state();
+		HeatBalanceManager::clear_state();
+		HeatBalanceSurfaceManager::clear_state();
+		HeatBalFiniteDiffManager::clear_state();
+		HeatPumpWaterToWaterCOOLING::clear_state();
+		HeatPumpWaterToWaterHEATING::clear_state();
+		HeatPumpWaterToWaterSimple::clear_state();
+		HeatRecovery::clear_state();
+		HeatingCoils::clear_state();
+		HighTempRadiantSystem::clear_state();
+		Humidifiers::clear_state();
+		HVACControllers::clear_state();
+		HVACCooledBeam::clear_state();
+		HVACDuct::clear_state();
+		HVACDXHeatPumpSystem::clear_state();
+		HVACDXSystem::clear_state();
+		HVACHXAssistedCoolingCoil::clear_state();
+		HVACInterfaceManager::clear_state();
+		HVACManager::clear_state();
+		HVACMultiSpeedHeatPump::clear_state();
+		HVACSingleDuctInduc::clear_state();
+		HVACStandAloneERV::clear_state();
+		HVACUnitaryBypassVAV::clear_state();
+		HVACUnitarySystem::clear_state();
+		HVACVariableRefrigerantFlow::clear_state();
+		HWBaseboardRadiator::clear_state();
+		ICEngineElectricGenerator::clear_state();
+		IceThermalStorage::clear_state();
+		InputProcessor::clear_state();
+		IntegratedHeatPump::clear_state();
+		InternalHeatGains::clear_state();
+		LowTempRadiantSystem::clear_state();
+		MatrixDataManager::clear_state();
+		MicroCHPElectricGenerator::clear_state();
+		MicroturbineElectricGenerator::clear_state();
+		MixedAir::clear_state();
+		MixerComponent::clear_state();
+		MoistureBalanceEMPDManager::clear_state();
+		MundtSimMgr::clear_state();
+		NodeInputManager::clear_state();
+		NonZoneEquipmentManager::clear_state();
+		OutAirNodeManager::clear_state();
+		OutdoorAirUnit::clear_state();
+		OutputProcessor::clear_state();
+		OutputReportPredefined::clear_state();
+		OutputReports::clear_state();
+		OutputReportTabular::clear_state();
+		OutputReportTabularAnnual::clear_state();
+		OutsideEnergySources::clear_state();
+		PackagedTerminalHeatPump::clear_state();
+		PackagedThermalStorageCoil::clear_state();
+		Photovoltaics::clear_state();
+		PhotovoltaicThermalCollectors::clear_state();
+		PipeHeatTransfer::clear_state();
+		PlantCentralGSHP::clear_state();
+		PlantComponentTemperatureSources::clear_state();
+		PlantCondLoopOperation::clear_state();
+		PlantChillers::clear_state();
+		PlantHeatExchangerFluidToFluid::clear_state();
+		PlantLoadProfile::clear_state();
+		PlantLoopSolver::clear_state();
+		PlantManager::clear_state();
+		PlantPipingSystemsManager::clear_state();
+		PlantPressureSystem::clear_state();
+		PlantUtilities::clear_state();
+		Pipes::clear_state();
+		PlantValves::clear_state();
+		PollutionModule::clear_state();
+		PondGroundHeatExchanger::clear_state();
+		PoweredInductionUnits::clear_state();
+		Psychrometrics::clear_state();
+		Pumps::clear_state();
+		PurchasedAirManager::clear_state();
+		RefrigeratedCase::clear_state();
+		ReportSizingManager::clear_state();
+		ReturnAirPathManager::clear_state();
+		RoomAirModelAirflowNetwork::clear_state();
+		RoomAirModelManager::clear_state();
+		RoomAirModelUserTempPattern::clear_state();
+		RuntimeLanguageProcessor::clear_state();
+		ScheduleManager::clear_state();
+		SetPointManager::clear_state();
+		SimAirServingZones::clear_state();
+		SimulationManager::clear_state();
+		SingleDuct::clear_state();
+		SizingAnalysisObjects::clear_state();
+		SizingManager::clear_state();
+		SolarCollectors::clear_state();
+		SolarReflectionManager::clear_state();
+		SolarShading::clear_state();
+		SplitterComponent::clear_state();
+		StandardRatings::clear_state();
+		SteamBaseboardRadiator::clear_state();
+		SteamCoils::clear_state();
+		SurfaceGeometry::clear_state();
+		SurfaceGroundHeatExchanger::clear_state();
+		SystemAvailabilityManager::clear_state();
+		SwimmingPool::clear_state();
+		SystemReports::clear_state();
+		TARCOGCommon::clear_state();
+		TARCOGGasses90::clear_state();
+		TARCOGMain::clear_state();
+		TARCOGOutput::clear_state();
+		TarcogShading::clear_state();
+		ThermalChimney::clear_state();
+		ThermalComfort::clear_state();
+		ThermalISO15099Calc::clear_state();
+		TranspiredCollector::clear_state();
+		UFADManager::clear_state();
+		UnitHeater::clear_state();
+		UnitVentilator::clear_state();
+		UserDefinedComponents::clear_state();
+		UtilityRoutines::clear_state();
+		VariableSpeedCoils::clear_state();
+		Vectors::clear_state();
+		VentilatedSlab::clear_state();
+		WaterCoils::clear_state();
+		WaterManager::clear_state();
+		WaterThermalTanks::clear_state();
+		WaterToAirHeatPump::clear_state();
+		WaterToAirHeatPumpSimple::clear_state();
+		WaterUse::clear_state();
+		WeatherManager::clear_state();
+		WindowAC::clear_state();
+		WindowComplexManager::clear_state();
+		WindowEquivalentLayer::clear_state();
+		WindowManager::clear_state();
+		WindTurbine::clear_state();
+		ZoneAirLoopEquipmentManager::clear_state();
+		ZoneContaminantPredictorCorrector::clear_state();
+		ZoneDehumidifier::clear_state();
+		ZoneEquipmentManager::clear_state();
+		ZonePlenum::clear_state();
+		ZoneTempPredictorCorrector::clear_state();
+	}
+
+} // StateManagement
+
+} // EnergyPlus
@@ -172,8 +172,52 @@ namespace SteamBaseboardRadiator {
 	Array1D< SteamBaseboardParams > SteamBaseboard;
 	Array1D< SteamBaseboardNumericFieldData > SteamBaseboardNumericFields;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // one time get input flag
+		Real64 mdot( 0.0 );
+		bool ErrorsFound( false ); // If errors detected in input
+		bool MyOneTimeFlag( true );
+		bool ZoneEquipmentListChecked( false );
+		Array1D_bool MyEnvrnFlag;
+		int Iter( 0 );
+		bool UpdateSteamBaseboardMyEnvrnFlag( true );
+	}
+
 	// Functions
 
+	// Clears the global data in SteamBaseboardRadiator.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumSteamBaseboards = 0;
+		SteamIndex = 0;
+		QBBSteamRadSource.deallocate();
+		QBBSteamRadSrcAvg.deallocate();
+		ZeroSourceSumHATsurf.deallocate();
+		LastQBBSteamRadSrc.deallocate();
+		LastSysTimeElapsed.deallocate();
+		LastTimeStepSys.deallocate();
+		MySizeFlag.deallocate();
+		CheckEquipName.deallocate();
+		SetLoopIndexFlag.deallocate();
+		SteamBaseboard.deallocate();
+		SteamBaseboardNumericFields.deallocate();
+		GetInputFlag = true;
+		mdot = 0.0;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		ZoneEquipmentListChecked = false;
+		MyEnvrnFlag.deallocate();
+		Iter = 0;
+		UpdateSteamBaseboardMyEnvrnFlag = true;
+	}
+
 	void
 	SimSteamBaseboard(
 		std::string const & EquipName,
@@ -220,11 +264,9 @@ namespace SteamBaseboardRadiator {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int BaseboardNum; // index of unit in baseboard array
-		static bool GetInputFlag( true ); // one time get input flag
 		Real64 QZnReq; // zone load not yet satisfied
 		Real64 MaxSteamFlow;
 		Real64 MinSteamFlow;
-		static Real64 mdot( 0.0 );
 
 		if ( GetInputFlag ) {
 			GetSteamBaseboardInput();
@@ -367,7 +409,6 @@ namespace SteamBaseboardRadiator {
 		int NumNumbers; // Number of Numbers for each GetobjectItem call
 		int SurfNum; // Surface number Do loop counter
 		int IOStat;
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool errFlag;
@@ -687,9 +728,6 @@ namespace SteamBaseboardRadiator {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true );
-		static bool ZoneEquipmentListChecked( false );
-		static Array1D_bool MyEnvrnFlag;
 		int Loop;
 		int SteamInletNode;
 		int ZoneNode;
@@ -1144,15 +1182,13 @@ namespace SteamBaseboardRadiator {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int SteamInletNode;
 		int SteamOutletNode;
-		static int Iter( 0 );
-		static bool MyEnvrnFlag( true );
 
-		if ( BeginEnvrnFlag && MyEnvrnFlag ) {
+		if ( BeginEnvrnFlag && UpdateSteamBaseboardMyEnvrnFlag ) {
 			Iter = 0;
-			MyEnvrnFlag = false;
+			UpdateSteamBaseboardMyEnvrnFlag = false;
 		}
 		if ( ! BeginEnvrnFlag ) {
-			MyEnvrnFlag = true;
+			UpdateSteamBaseboardMyEnvrnFlag = true;
 		}
 
 		// First, update the running average if necessary...
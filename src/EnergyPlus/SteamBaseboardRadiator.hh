@@ -215,6 +215,11 @@ namespace SteamBaseboardRadiator {
 
 	// Functions
 
+	// Clears the global data in SteamBaseboardRadiator.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimSteamBaseboard(
 		std::string const & EquipName,
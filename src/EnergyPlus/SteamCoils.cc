@@ -168,8 +168,92 @@ namespace SteamCoils {
 
 	// MODULE SUBROUTINES:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetSteamCoilInputErrorsFound( false ); // If errors detected in input
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		bool MyOneTimeFlag( true );
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool MyPlantScanFlag;
+		Real64 SteamMassFlowRate( 0.0 );
+		Real64 AirMassFlow( 0.0 ); // [kg/sec]
+		Real64 TempAirIn( 0.0 ); // [C]
+		Real64 TempAirOut( 0.0 ); // [C]
+		Real64 Win( 0.0 );
+		Real64 TempSteamIn( 0.0 );
+		Real64 TempWaterOut( 0.0 );
+		Real64 CapacitanceAir( 0.0 );
+		Real64 HeatingCoilLoad( 0.0 );
+		Real64 CoilPress( 0.0 );
+		Real64 EnthSteamInDry( 0.0 );
+		Real64 EnthSteamOutWet( 0.0 );
+		Real64 LatentHeatSteam( 0.0 );
+		Real64 SubcoolDeltaTemp( 0.0 );
+		Real64 TempSetPoint( 0.0 );
+		Real64 CalcSteamAirCoilQCoilReq( 0.0 );
+		Real64 QCoilCap( 0.0 );
+		Real64 QSteamCoilMaxHT( 0.0 );
+		Real64 TempWaterAtmPress( 0.0 );
+		Real64 TempLoopOutToPump( 0.0 );
+		Real64 EnergyLossToEnvironment( 0.0 );
+		Real64 EnthCoilOutlet( 0.0 );
+		Real64 EnthPumpInlet( 0.0 );
+		Real64 EnthAtAtmPress( 0.0 );
+		Real64 CpWater( 0.0 );
+		int ErrCount( 0 );
+	}
+
 	// Functions
 
+	// Clears the global data in SteamCoils.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		SteamIndex = 0;
+		NumSteamCoils = 0;
+		MySizeFlag.deallocate();
+		CoilWarningOnceFlag.deallocate();
+		CheckEquipName.deallocate();
+		GetSteamCoilsInputFlag = true;
+		SteamCoil.deallocate();
+		GetSteamCoilInputErrorsFound = false;
+		TotalArgs = 0;
+		MyOneTimeFlag = true;
+		MyEnvrnFlag.deallocate();
+		MyPlantScanFlag.deallocate();
+		SteamMassFlowRate = 0.0;
+		AirMassFlow = 0.0;
+		TempAirIn = 0.0;
+		TempAirOut = 0.0;
+		Win = 0.0;
+		TempSteamIn = 0.0;
+		TempWaterOut = 0.0;
+		CapacitanceAir = 0.0;
+		HeatingCoilLoad = 0.0;
+		CoilPress = 0.0;
+		EnthSteamInDry = 0.0;
+		EnthSteamOutWet = 0.0;
+		LatentHeatSteam = 0.0;
+		SubcoolDeltaTemp = 0.0;
+		TempSetPoint = 0.0;
+		CalcSteamAirCoilQCoilReq = 0.0;
+		QCoilCap = 0.0;
+		QSteamCoilMaxHT = 0.0;
+		TempWaterAtmPress = 0.0;
+		TempLoopOutToPump = 0.0;
+		EnergyLossToEnvironment = 0.0;
+		EnthCoilOutlet = 0.0;
+		EnthPumpInlet = 0.0;
+		EnthAtAtmPress = 0.0;
+		CpWater = 0.0;
+		ErrCount = 0;
+	}
+
 	void
 	SimulateSteamCoilComponents(
 		std::string const & CompName,
@@ -319,7 +403,6 @@ namespace SteamCoils {
 		int NumAlphas;
 		int NumNums;
 		int IOStat;
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		std::string CurrentModuleObject; // for ease in getting objects
@@ -329,7 +412,6 @@ namespace SteamCoils {
 		Array1D< Real64 > NumArray; // Numeric input items for object
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 		//  certain object in the input file
 		bool errFlag;
 
@@ -359,12 +441,12 @@ namespace SteamCoils {
 			IsBlank = false;
 			VerifyName( AlphArray( 1 ), SteamCoil, CoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetSteamCoilInputErrorsFound = true;
 				if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, AlphArray( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetSteamCoilInputErrorsFound = true;
 			}
 			SteamCoil( CoilNum ).Name = AlphArray( 1 );
 			SteamCoil( CoilNum ).Schedule = AlphArray( 2 );
@@ -375,7 +457,7 @@ namespace SteamCoils {
 				if ( SteamCoil( CoilNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + AlphArray( 1 ) + "\", invalid data." );
 					ShowContinueError( cAlphaFields( 2 ) + " not found=" + AlphArray( 2 ) );
-					ErrorsFound = true;
+					GetSteamCoilInputErrorsFound = true;
 				}
 			}
 
@@ -386,20 +468,20 @@ namespace SteamCoils {
 			SteamCoil( CoilNum ).DegOfSubcooling = NumArray( 2 );
 			SteamCoil( CoilNum ).LoopSubcoolReturn = NumArray( 3 );
 
-			SteamCoil( CoilNum ).SteamInletNodeNum = GetOnlySingleNode( AlphArray( 3 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Steam, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
-			SteamCoil( CoilNum ).SteamOutletNodeNum = GetOnlySingleNode( AlphArray( 4 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Steam, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
-			SteamCoil( CoilNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 5 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			SteamCoil( CoilNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 6 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			SteamCoil( CoilNum ).SteamInletNodeNum = GetOnlySingleNode( AlphArray( 3 ), GetSteamCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Steam, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+			SteamCoil( CoilNum ).SteamOutletNodeNum = GetOnlySingleNode( AlphArray( 4 ), GetSteamCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Steam, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+			SteamCoil( CoilNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 5 ), GetSteamCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			SteamCoil( CoilNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 6 ), GetSteamCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			{ auto const SELECT_CASE_var( MakeUPPERCase( AlphArray( 7 ) ) );
 			//TEMPERATURE SETPOINT CONTROL or ZONE LOAD CONTROLLED Coils
 			if ( SELECT_CASE_var == "TEMPERATURESETPOINTCONTROL" ) {
 				SteamCoil( CoilNum ).TypeOfCoil = TemperatureSetPointControl;
-				SteamCoil( CoilNum ).TempSetPointNodeNum = GetOnlySingleNode( AlphArray( 8 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Sensor, 1, ObjectIsNotParent );
+				SteamCoil( CoilNum ).TempSetPointNodeNum = GetOnlySingleNode( AlphArray( 8 ), GetSteamCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Sensor, 1, ObjectIsNotParent );
 				if ( SteamCoil( CoilNum ).TempSetPointNodeNum == 0 ) {
 					ShowSevereError( RoutineName + cAlphaFields( 8 ) + " not found for " + CurrentModuleObject + " = " + AlphArray( 1 ) );
 					ShowContinueError( "..required for Temperature Setpoint Controlled Coils." );
-					ErrorsFound = true;
+					GetSteamCoilInputErrorsFound = true;
 				}
 
 			} else if ( SELECT_CASE_var == "ZONELOADCONTROL" ) {
@@ -413,7 +495,7 @@ namespace SteamCoils {
 
 			} else {
 				ShowSevereError( RoutineName + "Invalid " + cAlphaFields( 7 ) + " [" + AlphArray( 7 ) + "] specified for " + CurrentModuleObject + " = " + AlphArray( 1 ) );
-				ErrorsFound = true;
+				GetSteamCoilInputErrorsFound = true;
 			}}
 
 			TestCompSet( CurrentModuleObject, AlphArray( 1 ), AlphArray( 3 ), AlphArray( 4 ), "Steam Nodes" );
@@ -424,7 +506,7 @@ namespace SteamCoils {
 				if ( SteamIndex == 0 ) {
 					ShowSevereError( RoutineName + "Steam Properties for " + AlphArray( 1 ) + " not found." );
 					ShowContinueError( "Steam Fluid Properties should have been included in the input file." );
-					ErrorsFound = true;
+					GetSteamCoilInputErrorsFound = true;
 				}
 			}
 
@@ -444,7 +526,7 @@ namespace SteamCoils {
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetSteamCoilInputErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in getting input." );
 		}
 
@@ -506,9 +588,6 @@ namespace SteamCoils {
 		int AirOutletNode;
 		Real64 SteamDensity;
 		Real64 StartEnthSteam;
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool MyPlantScanFlag;
 		bool errFlag;
 
 		if ( MyOneTimeFlag ) {
@@ -942,33 +1021,8 @@ namespace SteamCoils {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 SteamMassFlowRate( 0.0 );
-		static Real64 AirMassFlow( 0.0 ); // [kg/sec]
-		static Real64 TempAirIn( 0.0 ); // [C]
-		static Real64 TempAirOut( 0.0 ); // [C]
-		static Real64 Win( 0.0 );
-		static Real64 TempSteamIn( 0.0 );
-		static Real64 TempWaterOut( 0.0 );
-		static Real64 CapacitanceAir( 0.0 );
-		static Real64 HeatingCoilLoad( 0.0 );
-		static Real64 CoilPress( 0.0 );
-		static Real64 EnthSteamInDry( 0.0 );
-		static Real64 EnthSteamOutWet( 0.0 );
-		static Real64 LatentHeatSteam( 0.0 );
-		static Real64 SubcoolDeltaTemp( 0.0 );
-		static Real64 TempSetPoint( 0.0 );
-		static Real64 QCoilReq( 0.0 );
-		static Real64 QCoilCap( 0.0 );
-		static Real64 QSteamCoilMaxHT( 0.0 );
-		static Real64 TempWaterAtmPress( 0.0 );
-		static Real64 TempLoopOutToPump( 0.0 );
-		static Real64 EnergyLossToEnvironment( 0.0 );
-		static Real64 EnthCoilOutlet( 0.0 );
-		static Real64 EnthPumpInlet( 0.0 );
-		static Real64 EnthAtAtmPress( 0.0 );
-		static Real64 CpWater( 0.0 );
-
-		QCoilReq = QCoilRequested;
+
+		CalcSteamAirCoilQCoilReq = QCoilRequested;
 		TempAirIn = SteamCoil( CoilNum ).InletAirTemp;
 		Win = SteamCoil( CoilNum ).InletAirHumRat;
 		TempSteamIn = SteamCoil( CoilNum ).InletSteamTemp;
@@ -981,7 +1035,7 @@ namespace SteamCoils {
 			if ( PartLoadRatio > 0.0 ) {
 				AirMassFlow = SteamCoil( CoilNum ).InletAirMassFlowRate / PartLoadRatio;
 				SteamMassFlowRate = min( SteamCoil( CoilNum ).InletSteamMassFlowRate / PartLoadRatio, SteamCoil( CoilNum ).MaxSteamMassFlowRate );
-				QCoilReq /= PartLoadRatio;
+				CalcSteamAirCoilQCoilReq /= PartLoadRatio;
 			} else {
 				AirMassFlow = 0.0;
 				SteamMassFlowRate = 0.0;
@@ -1004,7 +1058,7 @@ namespace SteamCoils {
 		{ auto const SELECT_CASE_var( SteamCoil( CoilNum ).TypeOfCoil );
 
 		if ( SELECT_CASE_var == ZoneLoadControl ) {
-			if ( ( CapacitanceAir > 0.0 ) && ( ( SteamCoil( CoilNum ).InletSteamMassFlowRate ) > 0.0 ) && ( GetCurrentScheduleValue( SteamCoil( CoilNum ).SchedPtr ) > 0.0 || MySizeFlag( CoilNum ) ) && ( QCoilReq > 0.0 ) ) {
+			if ( ( CapacitanceAir > 0.0 ) && ( ( SteamCoil( CoilNum ).InletSteamMassFlowRate ) > 0.0 ) && ( GetCurrentScheduleValue( SteamCoil( CoilNum ).SchedPtr ) > 0.0 || MySizeFlag( CoilNum ) ) && ( CalcSteamAirCoilQCoilReq > 0.0 ) ) {
 
 				// Steam heat exchangers would not have effectivness, since all of the steam is
 				// converted to water and only then the steam trap allows it to leave the heat
@@ -1026,10 +1080,10 @@ namespace SteamCoils {
 				SteamCoil( CoilNum ).OperatingCapacity = QSteamCoilMaxHT;
 
 				// Determine the Max coil capacity and check for the same.
-				if ( QCoilReq > QSteamCoilMaxHT ) {
+				if ( CalcSteamAirCoilQCoilReq > QSteamCoilMaxHT ) {
 					QCoilCap = QSteamCoilMaxHT;
 				} else {
-					QCoilCap = QCoilReq;
+					QCoilCap = CalcSteamAirCoilQCoilReq;
 				}
 
 				// Steam Mass Flow Rate Required
@@ -1601,7 +1655,6 @@ namespace SteamCoils {
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		int WhichCoil;
-		static int ErrCount( 0 );
 
 		// Obtains and Allocates SteamCoil related parameters from input file
 		if ( GetSteamCoilsInputFlag ) { //First time subroutine has been entered
@@ -229,6 +229,11 @@ namespace SteamCoils {
 
 	// Functions
 
+	// Clears the global data in SteamCoils.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimulateSteamCoilComponents(
 		std::string const & CompName,
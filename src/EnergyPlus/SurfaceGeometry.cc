@@ -158,6 +158,48 @@ namespace SurfaceGeometry {
 		Array1D< Real64 > Xpsv;
 		Array1D< Real64 > Ypsv;
 		Array1D< Real64 > Zpsv;
+		int ErrCount( 0 );
+		bool NonMatch( false ); // Error for non-matching interzone surfaces
+		bool SurfError( false ); // General Surface Error, causes fatal error at end of routine
+		bool RelWarning( false );
+		bool WarningDisplayed( false );
+		int ErrCount2( 0 );
+		int ErrCount3( 0 );
+		int ErrCount4( 0 ); // counts of interzone area mismatches.
+		bool ErrorsFoundSingleSurf( false );
+		bool ErrorsFoundMultiSurf( false );
+		bool ErrorsFoundSurfList( false );
+		bool ErrorsFoundByConstruct( false );
+		bool ShowZoneSurfaces( false );
+		bool ShowZoneSurfaceHeaders( true );
+		int CalculateZoneVolumeErrCount( 0 );
+		Real64 XSHIFT; // Shift of X to Lower Left Corner
+		Real64 YSHIFT; // Shift of Y to Lower Left Corner
+		Real64 BaseCosAzimuth;
+		Real64 BaseCosTilt;
+		Real64 BaseSinAzimuth;
+		Real64 BaseSinTilt;
+		Real64 BaseXLLC;
+		Real64 BaseYLLC;
+		Real64 BaseZLLC;
+		std::string ErrLineOut; // Character string for producing error messages
+		Real64 OldAspectRatio;
+		Real64 NewAspectRatio;
+		bool firstTime( true );
+		bool noTransform( true );
+		std::string transformPlane;
+		Array1D< Vector > Triangle1( 3 ); // working struct for a 3-sided surface
+		Array1D< Vector > Triangle2( 3 ); // working struct for a 3-sided surface
+		Array1D< Real64 > X; // containers for x,y,z vertices of the surface
+		Array1D< Real64 > Y;
+		Array1D< Real64 > Z;
+		Array1D< Real64 > A; // containers for convexity test
+		Array1D< Real64 > B;
+		Array1D_int SurfCollinearVerts; // Array containing indices of collinear vertices
+		int VertSize; // size of X,Y,Z,A,B arrays
+		bool CheckConvexity_firstTime( true );
+		Real64 ACosZero; // set on firstTime
+		std::string CheckConvexityErrLineOut; // Character string for producing error messages
 	}
 
 
@@ -209,6 +251,48 @@ namespace SurfaceGeometry {
 		Warning2Count = 0;
 		Warning3Count = 0;
 		SurfaceTmp.deallocate();
+		ErrCount = 0;
+		NonMatch = false;
+		SurfError = false;
+		RelWarning = false;
+		WarningDisplayed = false;
+		ErrCount2 = 0;
+		ErrCount3 = 0;
+		ErrCount4 = 0;
+		ErrorsFoundSingleSurf = false;
+		ErrorsFoundMultiSurf = false;
+		ErrorsFoundSurfList = false;
+		ErrorsFoundByConstruct = false;
+		ShowZoneSurfaces = false;
+		ShowZoneSurfaceHeaders = true;
+		CalculateZoneVolumeErrCount = 0;
+		XSHIFT = 0.0;
+		YSHIFT = 0.0;
+		BaseCosAzimuth = 0.0;
+		BaseCosTilt = 0.0;
+		BaseSinAzimuth = 0.0;
+		BaseSinTilt = 0.0;
+		BaseXLLC = 0.0;
+		BaseYLLC = 0.0;
+		BaseZLLC = 0.0;
+		ErrLineOut.clear();
+		OldAspectRatio = 0.0;
+		NewAspectRatio = 0.0;
+		firstTime = true;
+		noTransform = true;
+		transformPlane.clear();
+		Triangle1 = Array1D< Vector >( 3 );
+		Triangle2 = Array1D< Vector >( 3 );
+		X.deallocate();
+		Y.deallocate();
+		Z.deallocate();
+		A.deallocate();
+		B.deallocate();
+		SurfCollinearVerts.deallocate();
+		VertSize = 0;
+		CheckConvexity_firstTime = true;
+		ACosZero = 0.0;
+		CheckConvexityErrLineOut.clear();
 	}
 
 	void
@@ -274,7 +358,6 @@ namespace SurfaceGeometry {
 		int Count; // To count wall surfaces for ceiling height calculation
 		Array1D_bool ZoneCeilingHeightEntered;
 		Array1D< Real64 > ZoneCeilingArea;
-		static int ErrCount( 0 );
 		Real64 NominalUwithConvCoeffs;
 		std::string cNominalU;
 		std::string cNominalUwithConvCoeffs;
@@ -862,10 +945,8 @@ namespace SurfaceGeometry {
 		int ZoneNum; // DO loop counter (zones)
 		int Found; // For matching interzone surfaces
 		int ConstrNumFound; // Construction number of matching interzone surface
-		static bool NonMatch( false ); // Error for non-matching interzone surfaces
 		int Lay; // Layer number
 		int MovedSurfs; // Number of Moved Surfaces (when sorting into hierarchical structure)
-		static bool SurfError( false ); // General Surface Error, causes fatal error at end of routine
 		int Loop;
 		int BaseSurfNum;
 		int TotLay; // Total layers in a construction
@@ -907,7 +988,6 @@ namespace SurfaceGeometry {
 		int OpaqueHTSurfs; // Number of floors, walls and roofs in a zone
 		int OpaqueHTSurfsWithWin; // Number of floors, walls and roofs with windows in a zone
 		int InternalMassSurfs; // Number of internal mass surfaces in a zone
-		static bool RelWarning( false );
 		int ConstrNumSh; // Shaded construction number for a window
 		int LayNumOutside; // Outside material numbers for a shaded construction
 		int BlNum; // Blind number
@@ -928,10 +1008,6 @@ namespace SurfaceGeometry {
 		int MultFound;
 		int MultSurfNum;
 		std::string MultString;
-		static bool WarningDisplayed( false );
-		static int ErrCount2( 0 );
-		static int ErrCount3( 0 );
-		static int ErrCount4( 0 ); // counts of interzone area mismatches.
 		bool SubSurfaceSevereDisplayed;
 		bool subSurfaceError( false );
 		// INTEGER :: Warning4Count=0  ! counts of nonmatched flat surface subsurface orientations
@@ -5866,10 +5942,6 @@ namespace SurfaceGeometry {
 		int CountHTAlgoObjectsMultiSurf;
 		int CountHTAlgoObjectsSurfList;
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFoundSingleSurf( false );
-		static bool ErrorsFoundMultiSurf( false );
-		static bool ErrorsFoundSurfList( false );
-		static bool ErrorsFoundByConstruct( false );
 		int tmpAlgoInput;
 		int Item;
 		int Item1;
@@ -8056,9 +8128,6 @@ namespace SurfaceGeometry {
 		Real64 CalcVolume;
 		bool initmsg;
 		int iside;
-		static bool ShowZoneSurfaces( false );
-		static bool ShowZoneSurfaceHeaders( true );
-		static int ErrCount( 0 );
 
 		// Object Data
 		Polyhedron ZoneStruct;
@@ -8124,8 +8193,8 @@ namespace SurfaceGeometry {
 			if ( Zone( ZoneNum ).Volume > 0.0 ) { // User entered zone volume, produce message if not near calculated
 				if ( TempVolume > 0.0 ) {
 					if ( std::abs( TempVolume - Zone( ZoneNum ).Volume ) / Zone( ZoneNum ).Volume > 0.05 ) {
-						++ErrCount;
-						if ( ErrCount == 1 && ! DisplayExtraWarnings ) {
+						++CalculateZoneVolumeErrCount;
+						if ( CalculateZoneVolumeErrCount == 1 && ! DisplayExtraWarnings ) {
 							if ( initmsg ) {
 								ShowMessage( "Note that the following warning(s) may/will occur if you have not enclosed your zone completely." );
 								initmsg = false;
@@ -8277,8 +8346,6 @@ namespace SurfaceGeometry {
 		Real64 X1; // Intermediate Result
 		Real64 Y1; // Intermediate Result
 		Real64 Z1; // Intermediate Result
-		static Real64 XSHIFT; // Shift of X to Lower Left Corner
-		static Real64 YSHIFT; // Shift of Y to Lower Left Corner
 		Real64 XLLC; // X-coordinate of lower left corner
 		Real64 YLLC; // Y-coordinate of lower left corner
 		Real64 ZLLC; // Z-coordinate of lower left corner
@@ -8289,13 +8356,6 @@ namespace SurfaceGeometry {
 		Real64 Xp;
 		Real64 Yp;
 		Real64 Zp;
-		static Real64 BaseCosAzimuth;
-		static Real64 BaseCosTilt;
-		static Real64 BaseSinAzimuth;
-		static Real64 BaseSinTilt;
-		static Real64 BaseXLLC;
-		static Real64 BaseYLLC;
-		static Real64 BaseZLLC;
 		Real64 SurfWorldAz; // Surface Azimuth (facing)
 		Real64 SurfTilt; // Surface Tilt
 		//  TYPE(PlaneEq) PlanarEQ
@@ -8793,7 +8853,6 @@ namespace SurfaceGeometry {
 		int I; // Loop Control
 		Real64 Gamma; // Intermediate Result
 		Real64 DotSelfX23;
-		static std::string ErrLineOut; // Character string for producing error messages
 
 		// Object Data
 		Vector x21;
@@ -9909,11 +9968,6 @@ namespace SurfaceGeometry {
 		int NAlphas;
 		int NNum;
 		int IOStat;
-		static Real64 OldAspectRatio;
-		static Real64 NewAspectRatio;
-		static bool firstTime( true );
-		static bool noTransform( true );
-		static std::string transformPlane;
 		int n;
 		Real64 Xo;
 		Real64 XnoRot;
@@ -10020,8 +10074,6 @@ namespace SurfaceGeometry {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		// Object Data
-		static Array1D< Vector > Triangle1( 3 ); // working struct for a 3-sided surface
-		static Array1D< Vector > Triangle2( 3 ); // working struct for a 3-sided surface
 		static Vector const zero_vector( 0.0 );
 		Vector centroid;
 
@@ -10355,24 +10407,14 @@ namespace SurfaceGeometry {
 		Real64 V2len; // Edge vector length
 		bool SignFlag; // Direction of edge turn : true is right, false is left
 		bool PrevSignFlag( false ); // Container for the sign of the previous iteration's edge turn
-		static Array1D< Real64 > X; // containers for x,y,z vertices of the surface
-		static Array1D< Real64 > Y;
-		static Array1D< Real64 > Z;
-		static Array1D< Real64 > A; // containers for convexity test
-		static Array1D< Real64 > B;
-		static Array1D_int SurfCollinearVerts; // Array containing indices of collinear vertices
-		static int VertSize; // size of X,Y,Z,A,B arrays
 		Real64 cosarg;
 		int M; // Array index for SurfCollinearVerts container
 		int J; // Loop index
 		int K; // Loop index
 		int Ind; // Location of surface vertex to be removed
-		static bool firstTime( true );
-		static Real64 ACosZero; // set on firstTime
 		bool SurfCollinearWarning;
-		static std::string ErrLineOut; // Character string for producing error messages
 
-		if ( firstTime ) {
+		if ( CheckConvexity_firstTime ) {
 			ACosZero = std::acos( 0.0 );
 			X.allocate( MaxVerticesPerSurface + 2 );
 			Y.allocate( MaxVerticesPerSurface + 2 );
@@ -10381,7 +10423,7 @@ namespace SurfaceGeometry {
 			B.allocate( MaxVerticesPerSurface + 2 );
 			SurfCollinearVerts.allocate( MaxVerticesPerSurface );
 			VertSize = MaxVerticesPerSurface;
-			firstTime = false;
+			CheckConvexity_firstTime = false;
 		}
 
 		if ( NSides > VertSize ) {
@@ -10442,8 +10484,8 @@ namespace SurfaceGeometry {
 					ShowContinueError( "Coincident Vertices will be removed as possible." );
 					for ( n = 1; n <= SurfaceTmp( SurfNum ).Sides; ++n ) {
 						auto const & point( SurfaceTmp( SurfNum ).Vertex( n ) );
-						gio::write( ErrLineOut, ErrFmt ) << point.x << point.y << point.z;
-						ShowContinueError( ErrLineOut );
+						gio::write( CheckConvexityErrLineOut, ErrFmt ) << point.x << point.y << point.z;
+						ShowContinueError( CheckConvexityErrLineOut );
 					}
 				}
 			}
@@ -202,6 +202,70 @@ namespace loc {
 	// Object Data
 	Array1D< SurfaceGroundHeatExchangerData > SurfaceGHE;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false ); // Set to true if errors in input,
+		Real64 FluxTop; // top surface flux
+		Real64 FluxBtm; // bottom surface flux
+		Real64 TempBtm; // bottom surface temp
+		Real64 TempTop; // top surface temp
+		bool InitializeTempTop( false );
+	}
+
+	// Functions
+
+	// Clears the global data in SurfaceGroundHeatExchanger.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NoSurfaceGroundTempObjWarning = true;
+		nsvInletTemp = 0.0;
+		nsvOutletTemp = 0.0;
+		FlowRate = 0.0;
+		TopSurfTemp = 0.0;
+		BtmSurfTemp = 0.0;
+		TopSurfFlux = 0.0;
+		BtmSurfFlux = 0.0;
+		SourceFlux = 0.0;
+		SourceTemp = 0.0;
+		nsvSurfaceArea = 0.0;
+		TopThermAbs = 0.0;
+		BtmThermAbs = 0.0;
+		TopSolarAbs = 0.0;
+		CheckEquipName.deallocate();
+		PastBeamSolarRad = 0.0;
+		PastSolarDirCosVert = 0.0;
+		PastDifSolarRad = 0.0;
+		PastGroundTemp = 0.0;
+		PastIsRain = false;
+		PastIsSnow = false;
+		PastOutBaroPress = 0.0;
+		PastOutDryBulbTemp = 0.0;
+		PastOutHumRat = 0.0;
+		PastOutAirDensity = 0.0;
+		PastOutWetBulbTemp = 0.0;
+		PastOutDewPointTemp = 0.0;
+		PastSkyTemp = 0.0;
+		PastWindSpeed = 0.0;
+		PastCloudFraction = 0.0;
+		GetInputFlag = true;
+		QRadSysSrcAvg.deallocate();
+		LastSysTimeElapsed.deallocate();
+		LastTimeStepSys.deallocate();
+		SurfaceGHE.deallocate();
+		ErrorsFound = false;
+		FluxTop = 0.0;
+		FluxBtm = 0.0;
+		TempBtm = 0.0;
+		TempTop = 0.0;
+		InitializeTempTop = false;
+	}
+
 	PlantComponent * SurfaceGroundHeatExchangerData::factory( int const EP_UNUSED(objectType), std::string const objectName ) {
 		if ( GetInputFlag ) {
 			GetSurfaceGroundHeatExchanger();
@@ -278,7 +342,6 @@ namespace loc {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static bool ErrorsFound( false ); // Set to true if errors in input,
 		// fatal at end of routine
 		int IOStatus; // Used in GetObjectItem
 		int Item; // Item to be "gotten"
@@ -667,10 +730,6 @@ namespace loc {
 		Real64 OldPastFluxTop; // top surface flux - past value used during iteration
 		Real64 OldPastFluxBtm; // bottom surface flux - past value used during iteration
 		// variables used with current environmental conditions
-		static Real64 FluxTop; // top surface flux
-		static Real64 FluxBtm; // bottom surface flux
-		static Real64 TempBtm; // bottom surface temp
-		static Real64 TempTop; // top surface temp
 		Real64 TempT; // top surface temp - used in underrelaxation
 		Real64 TempB; // bottom surface temp - used in underrelaxation
 		Real64 OldFluxTop; // top surface flux - value used during iteration
@@ -681,7 +740,6 @@ namespace loc {
 		//  INTEGER, SAVE ::ErrCount1=0
 		//  INTEGER, SAVE ::ErrCount2=0
 		//  INTEGER, SAVE ::ErrCount3=0
-		static bool InitializeTempTop( false );
 		int LoopNum;
 		int LoopSideNum;
 
@@ -418,6 +418,13 @@ namespace loc {
 
 	//==============================================================================
 
+	// Functions
+
+	// Clears the global data in SurfaceGroundHeatExchanger.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 } // SurfaceGroundHeatExchanger
 
 } // EnergyPlus
@@ -159,6 +159,19 @@ namespace SwimmingPool {
 	// Object Data
 	Array1D< SwimmingPoolData > Pool;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // First time, input is "gotten"
+		bool ErrorsFound( false ); // Set to true if something goes wrong
+		bool MyOneTimeFlag( true ); // Flag for one-time initializations
+		bool MyEnvrnFlagGeneral( true );
+		Array1D_bool MyPlantScanFlagPool;
+	}
+
 	// Functions
 
 	void
@@ -175,6 +188,11 @@ namespace SwimmingPool {
 		LastSysTimeElapsed.deallocate();
 		LastTimeStepSys.deallocate();
 		Pool.deallocate();
+		GetInputFlag = true;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		MyEnvrnFlagGeneral = true;
+		MyPlantScanFlagPool.deallocate();
 	}
 
 	void
@@ -217,7 +235,6 @@ namespace SwimmingPool {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInputFlag( true ); // First time, input is "gotten"
 		int PoolNum; // Pool number index
 
 		// FLOW:
@@ -306,7 +323,6 @@ namespace SwimmingPool {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false ); // Set to true if something goes wrong
 		std::string CurrentModuleObject; // for ease in getting objects
 		Array1D_string Alphas; // Alpha items for object
 		Array1D_string cAlphaFields; // Alpha field names
@@ -637,9 +653,6 @@ namespace SwimmingPool {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true ); // Flag for one-time initializations
-		static bool MyEnvrnFlagGeneral( true );
-		static Array1D_bool MyPlantScanFlagPool;
 		bool errFlag;
 		Real64 mdot;
 		Real64 HeatGainPerPerson;
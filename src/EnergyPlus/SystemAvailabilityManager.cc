@@ -210,6 +210,12 @@ namespace SystemAvailabilityManager {
 		bool CalcNCycSysAvailMgr_OneTimeFlag( true );
 		Array1D< Real64 > OptStart_AdaTempGradTrdHeat; // Heating temp gradient for previous days - used in CalcOptStartSysAvailMgr
 		Array1D< Real64 > OptStart_AdaTempGradTrdCool; // Cooling temp gradient for previous days - used in CalcOptStartSysAvailMgr
+		int DummyArgument( 1 ); // This variable is used when SimSysAvailManager is called for a ZoneHVAC:* component
+		bool GetSysAvailManagerInputsErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		Array1D_bool ZoneCompNCControlType;
+		bool GetHybridVentilationInputsErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool MyOneTimeFlag( true ); // One time flag
+		bool InitHybridVentSysAvailMgrErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 	}
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE
@@ -270,6 +276,12 @@ namespace SystemAvailabilityManager {
 		BeginOfDayResetFlag = true;
 		OptStart_AdaTempGradTrdHeat.deallocate();
 		OptStart_AdaTempGradTrdCool.deallocate();
+		DummyArgument = 1;
+		GetSysAvailManagerInputsErrorsFound = false;
+		ZoneCompNCControlType.deallocate();
+		GetHybridVentilationInputsErrorsFound = false;
+		MyOneTimeFlag = true;
+		InitHybridVentSysAvailMgrErrorsFound = false;
 	}
 
 	void
@@ -325,7 +337,6 @@ namespace SystemAvailabilityManager {
 		int ZoneEquipType; // Type of ZoneHVAC:* component
 		int CompNum; // Index of ZoneHVAC:* component
 		int ZoneCompAvailMgrNum; // Index of availability manager associated with the ZoneHVAC:* component
-		static int DummyArgument( 1 ); // This variable is used when SimSysAvailManager is called for a ZoneHVAC:* component
 
 		if ( GetAvailMgrInputFlag ) {
 			GetSysAvailManagerInputs();
@@ -501,7 +512,6 @@ namespace SystemAvailabilityManager {
 		int maxNumbers; // maximum number of numbers for this set of objects
 		int numArgs; // maximum number of arguments for this set of objects
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int SysAvailNum; // DO loop index for all System Availability Managers
@@ -593,7 +603,7 @@ namespace SystemAvailabilityManager {
 				IsBlank = false;
 				VerifyName( cAlphaArgs( 1 ), SchedSysAvailMgrData, SysAvailNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 					if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 				}
 				SchedSysAvailMgrData( SysAvailNum ).Name = cAlphaArgs( 1 );
@@ -603,7 +613,7 @@ namespace SystemAvailabilityManager {
 				if ( SchedSysAvailMgrData( SysAvailNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid" );
 					ShowContinueError( "not found: " + cAlphaFieldNames( 2 ) + "=\"" + cAlphaArgs( 2 ) + "\"." );
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 				}
 
 				SetupOutputVariable( "Availability Manager Scheduled Control Status []", SchedSysAvailMgrData( SysAvailNum ).AvailStatus, "System", "Average", SchedSysAvailMgrData( SysAvailNum ).Name );
@@ -627,7 +637,7 @@ namespace SystemAvailabilityManager {
 				IsBlank = false;
 				VerifyName( cAlphaArgs( 1 ), SchedOnSysAvailMgrData, SysAvailNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 					if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 				}
 				SchedOnSysAvailMgrData( SysAvailNum ).Name = cAlphaArgs( 1 );
@@ -637,7 +647,7 @@ namespace SystemAvailabilityManager {
 				if ( SchedOnSysAvailMgrData( SysAvailNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + " = \"" + cAlphaArgs( 1 ) + "\", invalid" );
 					ShowContinueError( "not found: " + cAlphaFieldNames( 2 ) + "=\"" + cAlphaArgs( 2 ) + "\"." );
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 				}
 
 				SetupOutputVariable( "Availability Manager Scheduled On Control Status []", SchedOnSysAvailMgrData( SysAvailNum ).AvailStatus, "System", "Average", SchedOnSysAvailMgrData( SysAvailNum ).Name );
@@ -661,7 +671,7 @@ namespace SystemAvailabilityManager {
 				IsBlank = false;
 				VerifyName( cAlphaArgs( 1 ), SchedOffSysAvailMgrData, SysAvailNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 					if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 				}
 				SchedOffSysAvailMgrData( SysAvailNum ).Name = cAlphaArgs( 1 );
@@ -671,7 +681,7 @@ namespace SystemAvailabilityManager {
 				if ( SchedOffSysAvailMgrData( SysAvailNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + " = \"" + cAlphaArgs( 1 ) + "\", invalid" );
 					ShowContinueError( "not found: " + cAlphaFieldNames( 2 ) + "=\"" + cAlphaArgs( 2 ) + "\"." );
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 				}
 
 				SetupOutputVariable( "Availability Manager Scheduled Off Control Status []", SchedOffSysAvailMgrData( SysAvailNum ).AvailStatus, "System", "Average", SchedOffSysAvailMgrData( SysAvailNum ).Name );
@@ -696,7 +706,7 @@ namespace SystemAvailabilityManager {
 				IsBlank = false;
 				VerifyName( cAlphaArgs( 1 ), NCycSysAvailMgrData, SysAvailNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 					if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 				}
 				NCycSysAvailMgrData( SysAvailNum ).Name = cAlphaArgs( 1 );
@@ -710,14 +720,14 @@ namespace SystemAvailabilityManager {
 				if ( NCycSysAvailMgrData( SysAvailNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + " = \"" + cAlphaArgs( 1 ) + "\", invalid" );
 					ShowContinueError( "not found: " + cAlphaFieldNames( 2 ) + "=\"" + cAlphaArgs( 2 ) + "\"." );
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 				}
 				NCycSysAvailMgrData( SysAvailNum ).FanSched = cAlphaArgs( 3 );
 				NCycSysAvailMgrData( SysAvailNum ).FanSchedPtr = GetScheduleIndex( cAlphaArgs( 3 ) );
 				if ( NCycSysAvailMgrData( SysAvailNum ).FanSchedPtr == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + " = \"" + cAlphaArgs( 1 ) + "\", invalid" );
 					ShowContinueError( "not found: " + cAlphaFieldNames( 3 ) + "=\"" + cAlphaArgs( 3 ) + "\"." );
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 				}
 
 				{ auto const SELECT_CASE_var( MakeUPPERCase( cAlphaArgs( 4 ) ) );
@@ -740,7 +750,7 @@ namespace SystemAvailabilityManager {
 				} else {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid" );
 					ShowSevereError( RoutineName + "incorrect value: " + cAlphaFieldNames( 4 ) + "=\"" + cAlphaArgs( 4 ) + "\"." );
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 				}}
 
 				// Control zone or zonelist
@@ -763,7 +773,7 @@ namespace SystemAvailabilityManager {
 							}
 						} else {
 							ShowSevereError(RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid " + cAlphaFieldNames( 5 ) + "=\"" + cAlphaArgs( 5 ) + "\" not found." );
-							ErrorsFound = true;
+							GetSysAvailManagerInputsErrorsFound = true;
 						}
 					}
 				}
@@ -788,7 +798,7 @@ namespace SystemAvailabilityManager {
 							}
 						} else {
 							ShowSevereError(RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid " + cAlphaFieldNames( 6 ) + "=\"" + cAlphaArgs( 6 ) + "\" not found." );
-							ErrorsFound = true;
+							GetSysAvailManagerInputsErrorsFound = true;
 						}
 					}
 				}
@@ -813,7 +823,7 @@ namespace SystemAvailabilityManager {
 							}
 						} else {
 							ShowSevereError(RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid " + cAlphaFieldNames( 7 ) + "=\"" + cAlphaArgs( 7 ) + "\" not found." );
-							ErrorsFound = true;
+							GetSysAvailManagerInputsErrorsFound = true;
 						}
 					}
 				}
@@ -838,7 +848,7 @@ namespace SystemAvailabilityManager {
 							}
 						} else {
 							ShowSevereError(RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid " + cAlphaFieldNames( 8 ) + "=\"" + cAlphaArgs( 8 ) + "\" not found." );
-							ErrorsFound = true;
+							GetSysAvailManagerInputsErrorsFound = true;
 						}
 					}
 				}
@@ -864,7 +874,7 @@ namespace SystemAvailabilityManager {
 				IsBlank = false;
 				VerifyName( cAlphaArgs( 1 ), OptStartSysAvailMgrData, SysAvailNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 					if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 				}
 				OptStartSysAvailMgrData( SysAvailNum ).Name = cAlphaArgs( 1 );
@@ -873,14 +883,14 @@ namespace SystemAvailabilityManager {
 				if ( OptStartSysAvailMgrData( SysAvailNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + " = \"" + cAlphaArgs( 1 ) + "\", invalid" );
 					ShowContinueError( "not found: " + cAlphaFieldNames( 2 ) + "=\"" + cAlphaArgs( 2 ) + "\"." );
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 				}
 				OptStartSysAvailMgrData( SysAvailNum ).FanSched = cAlphaArgs( 3 );
 				OptStartSysAvailMgrData( SysAvailNum ).FanSchedPtr = GetScheduleIndex( cAlphaArgs( 3 ) );
 				if ( OptStartSysAvailMgrData( SysAvailNum ).FanSchedPtr == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + " = \"" + cAlphaArgs( 1 ) + "\", invalid" );
 					ShowContinueError( "not found: " + cAlphaFieldNames( 3 ) + "=\"" + cAlphaArgs( 3 ) + "\"." );
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 				}
 
 				OptStartSysAvailMgrData( SysAvailNum ).MaxOptStartTime = rNumericArgs( 1 );
@@ -896,7 +906,7 @@ namespace SystemAvailabilityManager {
 					OptStartSysAvailMgrData( SysAvailNum ).CtrlType = ControlZone;
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid" );
 					ShowSevereError( RoutineName + "incorrect value: " + cAlphaFieldNames( 4 ) + "=\"" + cAlphaArgs( 4 ) + "\"." );
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 				}}
 
 				if ( OptStartSysAvailMgrData( SysAvailNum ).CtrlType == ControlZone ) {
@@ -905,7 +915,7 @@ namespace SystemAvailabilityManager {
 					if ( OptStartSysAvailMgrData( SysAvailNum ).ZoneNum == 0 ) {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid" );
 						ShowSevereError( "not found: " + cAlphaFieldNames( 5 ) + "=\"" + cAlphaArgs( 5 ) + "\"." );
-						ErrorsFound = true;
+						GetSysAvailManagerInputsErrorsFound = true;
 					}
 				}
 
@@ -924,7 +934,7 @@ namespace SystemAvailabilityManager {
 					if ( OptStartSysAvailMgrData( SysAvailNum ).NumOfZones == 0 ) {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid" );
 						ShowSevereError( "not found: " + cAlphaFieldNames( 6 ) + "=\"" + cAlphaArgs( 6 ) + "\"." );
-						ErrorsFound = true;
+						GetSysAvailManagerInputsErrorsFound = true;
 					}
 				}
 
@@ -941,7 +951,7 @@ namespace SystemAvailabilityManager {
 					OptStartSysAvailMgrData( SysAvailNum ).CtrlAlgType = AdaptiveASHRAE;
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid" );
 					ShowSevereError( RoutineName + "incorrect value: " + cAlphaFieldNames( 7 ) + "=\"" + cAlphaArgs( 7 ) + "\"." );
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 				}}
 
 				if ( OptStartSysAvailMgrData( SysAvailNum ).CtrlAlgType == ConstantTemperatureGradient ) {
@@ -992,15 +1002,15 @@ namespace SystemAvailabilityManager {
 				IsBlank = false;
 				VerifyName( cAlphaArgs( 1 ), DiffTSysAvailMgrData, SysAvailNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 					if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 				}
 				DiffTSysAvailMgrData( SysAvailNum ).Name = cAlphaArgs( 1 );
 				DiffTSysAvailMgrData( SysAvailNum ).MgrType = SysAvailMgr_DiffThermo;
 
-				DiffTSysAvailMgrData( SysAvailNum ).HotNode = GetOnlySingleNode( cAlphaArgs( 2 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Sensor, 1, ObjectIsNotParent );
+				DiffTSysAvailMgrData( SysAvailNum ).HotNode = GetOnlySingleNode( cAlphaArgs( 2 ), GetSysAvailManagerInputsErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Sensor, 1, ObjectIsNotParent );
 				MarkNode( DiffTSysAvailMgrData( SysAvailNum ).HotNode, cCurrentModuleObject, cAlphaArgs( 1 ), "Hot Node" );
-				DiffTSysAvailMgrData( SysAvailNum ).ColdNode = GetOnlySingleNode( cAlphaArgs( 3 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Sensor, 1, ObjectIsNotParent );
+				DiffTSysAvailMgrData( SysAvailNum ).ColdNode = GetOnlySingleNode( cAlphaArgs( 3 ), GetSysAvailManagerInputsErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Sensor, 1, ObjectIsNotParent );
 				MarkNode( DiffTSysAvailMgrData( SysAvailNum ).ColdNode, cCurrentModuleObject, cAlphaArgs( 1 ), "Cold Node" );
 
 				DiffTSysAvailMgrData( SysAvailNum ).TempDiffOn = rNumericArgs( 1 );
@@ -1014,7 +1024,7 @@ namespace SystemAvailabilityManager {
 				if ( DiffTSysAvailMgrData( SysAvailNum ).TempDiffOff > DiffTSysAvailMgrData( SysAvailNum ).TempDiffOn ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + " = \"" + cAlphaArgs( 1 ) + "\", invalid" );
 					ShowContinueError( "The " + cNumericFieldNames( 2 ) + " is greater than the " + cNumericFieldNames( 1 ) + '.' );
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 				}
 
 				SetupOutputVariable( "Availability Manager Differential Thermostat Control Status []", DiffTSysAvailMgrData( SysAvailNum ).AvailStatus, "System", "Average", DiffTSysAvailMgrData( SysAvailNum ).Name );
@@ -1037,13 +1047,13 @@ namespace SystemAvailabilityManager {
 				IsBlank = false;
 				VerifyName( cAlphaArgs( 1 ), HiTurnOffSysAvailMgrData, SysAvailNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 					if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 				}
 				HiTurnOffSysAvailMgrData( SysAvailNum ).Name = cAlphaArgs( 1 );
 				HiTurnOffSysAvailMgrData( SysAvailNum ).MgrType = SysAvailMgr_HiTempTOff;
 
-				HiTurnOffSysAvailMgrData( SysAvailNum ).Node = GetOnlySingleNode( cAlphaArgs( 2 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Sensor, 1, ObjectIsNotParent );
+				HiTurnOffSysAvailMgrData( SysAvailNum ).Node = GetOnlySingleNode( cAlphaArgs( 2 ), GetSysAvailManagerInputsErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Sensor, 1, ObjectIsNotParent );
 				MarkNode( HiTurnOffSysAvailMgrData( SysAvailNum ).Node, cCurrentModuleObject, cAlphaArgs( 1 ), "Sensor Node" );
 
 				HiTurnOffSysAvailMgrData( SysAvailNum ).Temp = rNumericArgs( 1 );
@@ -1069,13 +1079,13 @@ namespace SystemAvailabilityManager {
 				IsBlank = false;
 				VerifyName( cAlphaArgs( 1 ), HiTurnOnSysAvailMgrData, SysAvailNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 					if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 				}
 				HiTurnOnSysAvailMgrData( SysAvailNum ).Name = cAlphaArgs( 1 );
 				HiTurnOnSysAvailMgrData( SysAvailNum ).MgrType = SysAvailMgr_HiTempTOn;
 
-				HiTurnOnSysAvailMgrData( SysAvailNum ).Node = GetOnlySingleNode( cAlphaArgs( 2 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Sensor, 1, ObjectIsNotParent );
+				HiTurnOnSysAvailMgrData( SysAvailNum ).Node = GetOnlySingleNode( cAlphaArgs( 2 ), GetSysAvailManagerInputsErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Sensor, 1, ObjectIsNotParent );
 				MarkNode( HiTurnOnSysAvailMgrData( SysAvailNum ).Node, cCurrentModuleObject, cAlphaArgs( 1 ), "Sensor Node" );
 
 				HiTurnOnSysAvailMgrData( SysAvailNum ).Temp = rNumericArgs( 1 );
@@ -1101,13 +1111,13 @@ namespace SystemAvailabilityManager {
 				IsBlank = false;
 				VerifyName( cAlphaArgs( 1 ), LoTurnOffSysAvailMgrData, SysAvailNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 					if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 				}
 				LoTurnOffSysAvailMgrData( SysAvailNum ).Name = cAlphaArgs( 1 );
 				LoTurnOffSysAvailMgrData( SysAvailNum ).MgrType = SysAvailMgr_LoTempTOff;
 
-				LoTurnOffSysAvailMgrData( SysAvailNum ).Node = GetOnlySingleNode( cAlphaArgs( 2 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Sensor, 1, ObjectIsNotParent );
+				LoTurnOffSysAvailMgrData( SysAvailNum ).Node = GetOnlySingleNode( cAlphaArgs( 2 ), GetSysAvailManagerInputsErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Sensor, 1, ObjectIsNotParent );
 				MarkNode( LoTurnOffSysAvailMgrData( SysAvailNum ).Node, cCurrentModuleObject, cAlphaArgs( 1 ), "Sensor Node" );
 
 				LoTurnOffSysAvailMgrData( SysAvailNum ).Temp = rNumericArgs( 1 );
@@ -1117,7 +1127,7 @@ namespace SystemAvailabilityManager {
 					if ( LoTurnOffSysAvailMgrData( SysAvailNum ).SchedPtr == 0 ) {
 						ShowSevereError( RoutineName + cAlphaFieldNames( 3 ) + "=\"" + cAlphaArgs( 3 ) + "\" not found." );
 						ShowContinueError( "Occurs in " + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\"." );
-						ErrorsFound = true;
+						GetSysAvailManagerInputsErrorsFound = true;
 					}
 				} else {
 					LoTurnOffSysAvailMgrData( SysAvailNum ).SchedPtr = 0;
@@ -1144,13 +1154,13 @@ namespace SystemAvailabilityManager {
 				IsBlank = false;
 				VerifyName( cAlphaArgs( 1 ), LoTurnOnSysAvailMgrData, SysAvailNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 					if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 				}
 				LoTurnOnSysAvailMgrData( SysAvailNum ).Name = cAlphaArgs( 1 );
 				LoTurnOnSysAvailMgrData( SysAvailNum ).MgrType = SysAvailMgr_LoTempTOn;
 
-				LoTurnOnSysAvailMgrData( SysAvailNum ).Node = GetOnlySingleNode( cAlphaArgs( 2 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Sensor, 1, ObjectIsNotParent );
+				LoTurnOnSysAvailMgrData( SysAvailNum ).Node = GetOnlySingleNode( cAlphaArgs( 2 ), GetSysAvailManagerInputsErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Unknown, NodeConnectionType_Sensor, 1, ObjectIsNotParent );
 				MarkNode( LoTurnOnSysAvailMgrData( SysAvailNum ).Node, cCurrentModuleObject, cAlphaArgs( 1 ), "Sensor Node" );
 
 				LoTurnOnSysAvailMgrData( SysAvailNum ).Temp = rNumericArgs( 1 );
@@ -1176,7 +1186,7 @@ namespace SystemAvailabilityManager {
 				IsBlank = false;
 				VerifyName( cAlphaArgs( 1 ), NVentSysAvailMgrData, SysAvailNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 					if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 				}
 				NVentSysAvailMgrData( SysAvailNum ).Name = cAlphaArgs( 1 );
@@ -1186,21 +1196,21 @@ namespace SystemAvailabilityManager {
 				if ( NVentSysAvailMgrData( SysAvailNum ).SchedPtr == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid" );
 					ShowContinueError( "not found: " + cAlphaFieldNames( 2 ) + "=\"" + cAlphaArgs( 2 ) + "\"." );
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 				}
 				NVentSysAvailMgrData( SysAvailNum ).FanSched = cAlphaArgs( 3 );
 				NVentSysAvailMgrData( SysAvailNum ).FanSchedPtr = GetScheduleIndex( cAlphaArgs( 3 ) );
 				if ( NVentSysAvailMgrData( SysAvailNum ).FanSchedPtr == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid" );
 					ShowContinueError( "not found: " + cAlphaFieldNames( 3 ) + "=\"" + cAlphaArgs( 3 ) + "\"." );
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 				}
 				NVentSysAvailMgrData( SysAvailNum ).VentTempSched = cAlphaArgs( 4 );
 				NVentSysAvailMgrData( SysAvailNum ).VentTempSchedPtr = GetScheduleIndex( cAlphaArgs( 4 ) );
 				if ( NVentSysAvailMgrData( SysAvailNum ).VentTempSchedPtr == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid" );
 					ShowContinueError( "not found: " + cAlphaFieldNames( 4 ) + "=\"" + cAlphaArgs( 4 ) + "\"." );
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 				}
 				NVentSysAvailMgrData( SysAvailNum ).VentDelT = rNumericArgs( 1 );
 				NVentSysAvailMgrData( SysAvailNum ).VentTempLowLim = rNumericArgs( 2 );
@@ -1210,7 +1220,7 @@ namespace SystemAvailabilityManager {
 				if ( NVentSysAvailMgrData( SysAvailNum ).ZoneNum == 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid" );
 					ShowContinueError( "not found: " + cAlphaFieldNames( 5 ) + "=\"" + cAlphaArgs( 5 ) + "\"." );
-					ErrorsFound = true;
+					GetSysAvailManagerInputsErrorsFound = true;
 				}
 
 				SetupOutputVariable( "Availability Manager Night Ventilation Control Status []", NVentSysAvailMgrData( SysAvailNum ).AvailStatus, "System", "Average", NVentSysAvailMgrData( SysAvailNum ).Name );
@@ -1226,7 +1236,7 @@ namespace SystemAvailabilityManager {
 		rNumericArgs.deallocate();
 		lNumericFieldBlanks.deallocate();
 
-		if ( ErrorsFound ) {
+		if ( GetSysAvailManagerInputsErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in input.  Preceding condition(s) cause termination." );
 		}
 
@@ -2147,7 +2157,6 @@ namespace SystemAvailabilityManager {
 		int CtrldZoneNum;
 		int ZoneNum;
 		Real64 TempTol;
-		static Array1D_bool ZoneCompNCControlType;
 
 		TempTol = 0.5 * NCycSysAvailMgrData( SysAvailNum ).TempTolRange;
 		if ( present( ZoneEquipType ) ) {
@@ -4142,7 +4151,6 @@ namespace SystemAvailabilityManager {
 		int NumAlphas; // Number of Alphas for each GetObjectItem call
 		int NumNumbers; // Number of Numbers for each GetObjectItem call
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int SysAvailNum; // DO loop index for all System Availability Managers
@@ -4177,7 +4185,7 @@ namespace SystemAvailabilityManager {
 			IsBlank = false;
 			VerifyName( cAlphaArgs( 1 ), HybridVentSysAvailMgrData, &DefineHybridVentSysAvailManager::AirLoopName, SysAvailNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetHybridVentilationInputsErrorsFound = true;
 				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 			}
 			HybridVentSysAvailMgrData( SysAvailNum ).Name = cAlphaArgs( 1 );
@@ -4194,14 +4202,14 @@ namespace SystemAvailabilityManager {
 			if ( HybridVentSysAvailMgrData( SysAvailNum ).ActualZoneNum == 0 ) {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid" );
 				ShowContinueError( "not found: " + cAlphaFieldNames( 3 ) + "=\"" + cAlphaArgs( 3 ) + "\"." );
-				ErrorsFound = true;
+				GetHybridVentilationInputsErrorsFound = true;
 			}
 
 			HybridVentSysAvailMgrData( SysAvailNum ).ControlModeSchedPtr = GetScheduleIndex( cAlphaArgs( 4 ) );
 			if ( HybridVentSysAvailMgrData( SysAvailNum ).ControlModeSchedPtr == 0 ) {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid" );
 				ShowContinueError( "not found: " + cAlphaFieldNames( 4 ) + "=\"" + cAlphaArgs( 4 ) + "\"." );
-				ErrorsFound = true;
+				GetHybridVentilationInputsErrorsFound = true;
 			}
 
 			// Check schedule values
@@ -4216,13 +4224,13 @@ namespace SystemAvailabilityManager {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\"" );
 				ShowContinueError( cAlphaFieldNames( 4 ) + "=\"" + cAlphaArgs( 4 ) + "\", the maximum schedule value should be 4. However, " );
 				ShowContinueError( "the maximum entered value in the schedule is " + TrimSigDigits( SchedMax, 1 ) );
-				ErrorsFound = true;
+				GetHybridVentilationInputsErrorsFound = true;
 			}
 			if ( SchedMin < 0.0 ) {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\"" );
 				ShowContinueError( cAlphaFieldNames( 4 ) + "=\"" + cAlphaArgs( 4 ) + "the minimum schedule value should be 0. However, " );
 				ShowContinueError( "the minimum entered value in the schedule is " + TrimSigDigits( SchedMin, 1 ) );
-				ErrorsFound = true;
+				GetHybridVentilationInputsErrorsFound = true;
 			}
 
 			// Read use weather rain indicator
@@ -4234,7 +4242,7 @@ namespace SystemAvailabilityManager {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\"" );
 				ShowContinueError( "..invalid value: " + cAlphaFieldNames( 5 ) + "=\"" + cAlphaArgs( 5 ) + "\"." );
 				ShowContinueError( "Valid choices are Yes or No." );
-				ErrorsFound = true;
+				GetHybridVentilationInputsErrorsFound = true;
 			}
 
 			// Check max wind speed
@@ -4244,7 +4252,7 @@ namespace SystemAvailabilityManager {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\"" );
 					ShowContinueError( cNumericFieldNames( 1 ) + " is beyond the range." );
 					ShowContinueError( "The input value is " + TrimSigDigits( rNumericArgs( 1 ), 0 ) + ". The allowed value must be >= 0 and <= 40 m/s" );
-					ErrorsFound = true;
+					GetHybridVentilationInputsErrorsFound = true;
 				}
 			}
 
@@ -4255,7 +4263,7 @@ namespace SystemAvailabilityManager {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\"" );
 					ShowContinueError( cNumericFieldNames( 2 ) + " is beyond the range." );
 					ShowContinueError( "The input value is " + TrimSigDigits( rNumericArgs( 2 ), 0 ) + ". The allowed value must be between -100 C and +100 C" );
-					ErrorsFound = true;
+					GetHybridVentilationInputsErrorsFound = true;
 				}
 			}
 			if ( NumNumbers > 2 ) {
@@ -4264,14 +4272,14 @@ namespace SystemAvailabilityManager {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\"" );
 					ShowContinueError( cNumericFieldNames( 3 ) + " is beyond the range." );
 					ShowContinueError( "The input value is " + TrimSigDigits( rNumericArgs( 3 ), 0 ) + ". The allowed value must be between -100 C and +100 C" );
-					ErrorsFound = true;
+					GetHybridVentilationInputsErrorsFound = true;
 				}
 			}
 			// Ensure MaxTemp >= MinTemp
 			if ( rNumericArgs( 2 ) >= rNumericArgs( 3 ) ) {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" The " + cNumericFieldNames( 2 ) + " must be less than the " + cNumericFieldNames( 3 ) );
 				ShowContinueError( "The " + cNumericFieldNames( 2 ) + " is " + TrimSigDigits( rNumericArgs( 2 ), 0 ) + ". The " + cNumericFieldNames( 3 ) + " is " + TrimSigDigits( rNumericArgs( 3 ), 0 ) + '.' );
-				ErrorsFound = true;
+				GetHybridVentilationInputsErrorsFound = true;
 			}
 
 			// Read Max and Min outdoor enthalpy
@@ -4281,7 +4289,7 @@ namespace SystemAvailabilityManager {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\"" );
 					ShowContinueError( cNumericFieldNames( 4 ) + " is beyond the range." );
 					ShowContinueError( "The input value is " + TrimSigDigits( rNumericArgs( 4 ), 0 ) + ". The allowed value must be between 0 and 300000 J/kg" );
-					ErrorsFound = true;
+					GetHybridVentilationInputsErrorsFound = true;
 				}
 			}
 			if ( NumNumbers > 4 ) {
@@ -4290,14 +4298,14 @@ namespace SystemAvailabilityManager {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\"" );
 					ShowContinueError( cNumericFieldNames( 5 ) + " is beyond the range." );
 					ShowContinueError( "The input value is " + TrimSigDigits( rNumericArgs( 5 ), 0 ) + ". The allowed value must be between 0 and 300000 J/kg" );
-					ErrorsFound = true;
+					GetHybridVentilationInputsErrorsFound = true;
 				}
 			}
 			// Ensure MaxEnth >= MiniEnth
 			if ( rNumericArgs( 4 ) >= rNumericArgs( 5 ) ) {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" The " + cNumericFieldNames( 4 ) + " must be less than the " + cNumericFieldNames( 5 ) );
 				ShowContinueError( "The " + cNumericFieldNames( 4 ) + " is " + TrimSigDigits( rNumericArgs( 4 ), 0 ) + ". The " + cNumericFieldNames( 5 ) + " is " + TrimSigDigits( rNumericArgs( 5 ), 0 ) + '.' );
-				ErrorsFound = true;
+				GetHybridVentilationInputsErrorsFound = true;
 			}
 
 			// Read Max and Min outdoor dew point
@@ -4307,7 +4315,7 @@ namespace SystemAvailabilityManager {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\"" );
 					ShowContinueError( cNumericFieldNames( 6 ) + " is beyond the range." );
 					ShowContinueError( "The input value is " + TrimSigDigits( rNumericArgs( 6 ), 0 ) + ". The allowed value must be between -100 C and +100 C" );
-					ErrorsFound = true;
+					GetHybridVentilationInputsErrorsFound = true;
 				}
 			}
 			if ( NumNumbers > 6 ) {
@@ -4316,14 +4324,14 @@ namespace SystemAvailabilityManager {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\"" );
 					ShowContinueError( cNumericFieldNames( 7 ) + " is beyond the range." );
 					ShowContinueError( "The input value is " + TrimSigDigits( rNumericArgs( 7 ), 0 ) + ". The allowed value must be between -100 C and +100 C" );
-					ErrorsFound = true;
+					GetHybridVentilationInputsErrorsFound = true;
 				}
 			}
 			// Ensure MaxTemp >= MinTemp
 			if ( rNumericArgs( 6 ) >= rNumericArgs( 7 ) ) {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" The " + cNumericFieldNames( 6 ) + " must be less than the " + cNumericFieldNames( 7 ) );
 				ShowContinueError( "The " + cNumericFieldNames( 6 ) + " is " + TrimSigDigits( rNumericArgs( 6 ), 0 ) + ". The " + cNumericFieldNames( 7 ) + " is " + TrimSigDigits( rNumericArgs( 7 ), 0 ) + '.' );
-				ErrorsFound = true;
+				GetHybridVentilationInputsErrorsFound = true;
 			}
 
 			HybridVentSysAvailMgrData( SysAvailNum ).MinOASched = cAlphaArgs( 6 );
@@ -4331,13 +4339,13 @@ namespace SystemAvailabilityManager {
 			if ( HybridVentSysAvailMgrData( SysAvailNum ).MinOASchedPtr == 0 ) {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", invalid" );
 				ShowContinueError( "..not found: " + cAlphaFieldNames( 6 ) + "=\"" + cAlphaArgs( 6 ) + "\"." );
-				ErrorsFound = true;
+				GetHybridVentilationInputsErrorsFound = true;
 			}
 			SchedMin = GetScheduleMinValue( HybridVentSysAvailMgrData( SysAvailNum ).MinOASchedPtr );
 			if ( SchedMin < 0.0 ) {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\", Schedule value must be >= 0 in " + cAlphaFieldNames( 6 ) + "=\"" + cAlphaArgs( 6 ) + "\"." );
 				ShowContinueError( "The minimum schedule value is " + TrimSigDigits( SchedMin, 1 ) );
-				ErrorsFound = true;
+				GetHybridVentilationInputsErrorsFound = true;
 			}
 
 			if ( ! lAlphaFieldBlanks( 7 ) ) {
@@ -4345,14 +4353,14 @@ namespace SystemAvailabilityManager {
 				if ( HybridVentSysAvailMgrData( SysAvailNum ).OpeningFactorFWS <= 0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\"" );
 					ShowContinueError( " not found: " + cAlphaFieldNames( 7 ) + "=\"" + cAlphaArgs( 7 ) + "\"." );
-					ErrorsFound = true;
+					GetHybridVentilationInputsErrorsFound = true;
 				} else {
 					GetCurveMinMaxValues( HybridVentSysAvailMgrData( SysAvailNum ).OpeningFactorFWS, CurveMin, CurveMax );
 					if ( CurveMin < 0.0 ) {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\"" );
 						ShowContinueError( "The minimum wind speed used in " + cAlphaFieldNames( 7 ) + "=\"" + cAlphaArgs( 7 ) + "should be greater than or equal to 0.0 (m/s)" );
 						ShowContinueError( "Curve minimum value appears to be less than 0." );
-						ErrorsFound = true;
+						GetHybridVentilationInputsErrorsFound = true;
 					}
 					CurveVal = CurveValue( HybridVentSysAvailMgrData( SysAvailNum ).OpeningFactorFWS, CurveMin );
 					if ( CurveVal < 0.0 ) {
@@ -4360,7 +4368,7 @@ namespace SystemAvailabilityManager {
 						ShowContinueError( "The minimum value of " + cAlphaFieldNames( 7 ) + " must be greater than or equal to 0.0 at the minimum value of wind speed." );
 						ShowContinueError( cAlphaFieldNames( 7 ) + "=\"" + cAlphaArgs( 7 ) + "\"." );
 						ShowContinueError( "Curve output at the minimum wind speed = " + TrimSigDigits( CurveVal, 3 ) );
-						ErrorsFound = true;
+						GetHybridVentilationInputsErrorsFound = true;
 					}
 					CurveVal = CurveValue( HybridVentSysAvailMgrData( SysAvailNum ).OpeningFactorFWS, CurveMax );
 					if ( CurveVal > 1.0 ) {
@@ -4368,7 +4376,7 @@ namespace SystemAvailabilityManager {
 						ShowContinueError( "The maximum value of " + cAlphaFieldNames( 7 ) + " must be less than or equal to 1.0 at the maximum value of wind speed." );
 						ShowContinueError( cAlphaFieldNames( 7 ) + "=\"" + cAlphaArgs( 7 ) + "\"." );
 						ShowContinueError( "Curve output at the maximum wind speed = " + TrimSigDigits( CurveVal, 3 ) );
-						ErrorsFound = true;
+						GetHybridVentilationInputsErrorsFound = true;
 					}
 					// Check curve type
 					{ auto const SELECT_CASE_var( GetCurveType( HybridVentSysAvailMgrData( SysAvailNum ).OpeningFactorFWS ) );
@@ -4379,7 +4387,7 @@ namespace SystemAvailabilityManager {
 					} else {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\"" );
 						ShowContinueError( "Illegal curve type for " + cAlphaFieldNames( 7 ) + "=\"" + cAlphaArgs( 7 ) + "\"." );
-						ErrorsFound = true;
+						GetHybridVentilationInputsErrorsFound = true;
 					}}
 				}
 			}
@@ -4396,14 +4404,14 @@ namespace SystemAvailabilityManager {
 					ShowContinueError( " For " + cAlphaFieldNames( 8 ) + "=\"" + cAlphaArgs( 8 ) + "\"," );
 					ShowContinueError( "the maximum schedule value should be 1. However, " );
 					ShowContinueError( "the maximum entered value in the schedule is " + TrimSigDigits( SchedMax, 1 ) );
-					ErrorsFound = true;
+					GetHybridVentilationInputsErrorsFound = true;
 				}
 				if ( SchedMin < 0.0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\"" );
 					ShowContinueError( "For " + cAlphaFieldNames( 8 ) + "=\"" + cAlphaArgs( 8 ) + "\"," );
 					ShowContinueError( "the minimum schedule value should be 0. However, " );
 					ShowContinueError( "the minimum entered value in the schedule is " + TrimSigDigits( SchedMin, 1 ) );
-					ErrorsFound = true;
+					GetHybridVentilationInputsErrorsFound = true;
 				}
 			}
 
@@ -4422,14 +4430,14 @@ namespace SystemAvailabilityManager {
 					ShowContinueError( "For " + cAlphaFieldNames( 9 ) + "=\"" + cAlphaArgs( 9 ) + "\"," );
 					ShowContinueError( "the maximum schedule value should be 1. However, " );
 					ShowContinueError( "the maximum entered value in the schedule is " + TrimSigDigits( SchedMax, 1 ) );
-					ErrorsFound = true;
+					GetHybridVentilationInputsErrorsFound = true;
 				}
 				if ( SchedMin < 0.0 ) {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\"" );
 					ShowContinueError( "For " + cAlphaFieldNames( 9 ) + "=\"" + cAlphaArgs( 9 ) + "\"," );
 					ShowContinueError( "the minimum schedule value should be 0. However, " );
 					ShowContinueError( "the minimum entered value in the schedule is " + TrimSigDigits( SchedMin, 1 ) );
-					ErrorsFound = true;
+					GetHybridVentilationInputsErrorsFound = true;
 				}
 			}
 
@@ -4442,7 +4450,7 @@ namespace SystemAvailabilityManager {
 					if ( HybridVentSysAvailMgrData( SysAvailNum ).VentilationPtr <= 0 && int( SchedMax ) == 1 ) {
 						ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\"" );
 						ShowContinueError( cAlphaFieldNames( 10 ) + "=\"" + cAlphaArgs( 10 ) + "\" is required and not found." );
-						ErrorsFound = true;
+						GetHybridVentilationInputsErrorsFound = true;
 					} // Otherwise check later
 				}
 			}
@@ -4453,7 +4461,7 @@ namespace SystemAvailabilityManager {
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\"" );
 					ShowContinueError( "The Zone name specified in the Ventilation object " + Zone( Ventilation( HybridVentSysAvailMgrData( SysAvailNum ).VentilationPtr ).ZonePtr ).Name );
 					ShowContinueError( "is not equal to the " + cAlphaFieldNames( 3 ) + "=\"" + cAlphaArgs( 3 ) + "\"." );
-					ErrorsFound = true;
+					GetHybridVentilationInputsErrorsFound = true;
 				}
 			}
 
@@ -4461,7 +4469,7 @@ namespace SystemAvailabilityManager {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + HybridVentSysAvailMgrData( SysAvailNum ).Name + "\"" );
 				ShowContinueError( "The simple airflow objects are used for natural ventilation calculation." );
 				ShowContinueError( "The Airflow Network model is not allowed to perform. Please set the control type = NoMultizoneOrDistribution" );
-				ErrorsFound = true;
+				GetHybridVentilationInputsErrorsFound = true;
 			}
 
 			if ( HybridVentSysAvailMgrData( SysAvailNum ).SimpleControlTypeSchedPtr == 0 ) {
@@ -4480,7 +4488,7 @@ namespace SystemAvailabilityManager {
 			if ( HybridVentSysAvailMgrData( SysAvailNum ).SimpleControlTypeSchedPtr > 0 && SchedMax == 4.0 ) {
 				ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\"" );
 				ShowContinueError( "The outdoor ventilation air control type defined in " + cAlphaArgs( 4 ) + " cannot work together with " + cAlphaFieldNames( 9 ) );
-				ErrorsFound = true;
+				GetHybridVentilationInputsErrorsFound = true;
 			}
 
 		} // SysAvailNum
@@ -4492,7 +4500,7 @@ namespace SystemAvailabilityManager {
 						ShowSevereError( "The AirflowNetwork model is used for natural ventilation calculation in " + cCurrentModuleObject + "=\"" + HybridVentSysAvailMgrData( SysAvailNum - 1 ).Name + "\"" );
 						ShowContinueError( "The simple airflow objects are used for natural ventilation calculation in " + cCurrentModuleObject + "=\"" + HybridVentSysAvailMgrData( SysAvailNum ).Name + "\"" );
 						ShowContinueError( "The hybrid ventilation control requires the same models to calculate natural ventilation" );
-						ErrorsFound = true;
+						GetHybridVentilationInputsErrorsFound = true;
 					}
 				}
 				if ( HybridVentSysAvailMgrData( SysAvailNum - 1 ).SimpleControlTypeSchedPtr > 0 ) {
@@ -4500,13 +4508,13 @@ namespace SystemAvailabilityManager {
 						ShowSevereError( "The Airflow Network model is used for natural ventilation calculation in " + cCurrentModuleObject + "=\"" + HybridVentSysAvailMgrData( SysAvailNum ).Name + "\"" );
 						ShowContinueError( "The simple airflow objects are used for natural ventilation calculation in " + cCurrentModuleObject + "=\"" + HybridVentSysAvailMgrData( SysAvailNum - 1 ).Name + "\"" );
 						ShowContinueError( "The hybrid ventilation control requires the same models to calculate natural ventilation" );
-						ErrorsFound = true;
+						GetHybridVentilationInputsErrorsFound = true;
 					}
 				}
 			} // SysAvailNum
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetHybridVentilationInputsErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in input.  Preceding condition(s) cause termination." );
 		}
 
@@ -4564,10 +4572,8 @@ namespace SystemAvailabilityManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true ); // One time flag
 		int SysAvailNum; // DO loop index for Sys Avail Manager objects
 		int ControlledZoneNum; // Index into the ZoneEquipConfig array
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		int AirLoopNum; // Air loop number
 		int ControlMode; // Hybrid control mode
 		int AirLoopCount; // Air loop name count
@@ -4588,7 +4594,7 @@ namespace SystemAvailabilityManager {
 					if ( HybridVentSysAvailMgrData( SysAvailNum ).VentilationPtr <= 0 && int( SchedMax ) == 1 ) {
 						ShowSevereError( "ZoneVentilation Object Name=\"" + HybridVentSysAvailMgrData( SysAvailNum ).VentilationName + "\" is required and not found." );
 						ShowContinueError( "Occurs in AvailabilityManager:HybridVentilation=\"" + HybridVentSysAvailMgrData( SysAvailNum ).Name + "\"." );
-						ErrorsFound = true;
+						InitHybridVentSysAvailMgrErrorsFound = true;
 					}
 				}
 				// Check air loop number
@@ -4608,7 +4614,7 @@ namespace SystemAvailabilityManager {
 							if ( HybridVentSysAvailMgrData( SysAvailNum ).ControlledZoneNum > 0 ) {
 								if ( ZoneEquipConfig( ControlledZoneNum ).AirLoopNum != HybridVentSysAvailMgrData( SysAvailNum ).AirLoopNum ) {
 									ShowSevereError( cValidSysAvailManagerTypes( HybridVentSysAvailMgrData( SysAvailNum ).MgrType ) + ", The controlled zone =" + HybridVentSysAvailMgrData( SysAvailNum ).ControlZoneName + " is not served by this Air Loop=" + HybridVentSysAvailMgrData( SysAvailNum ).AirLoopName );
-									ErrorsFound = true;
+									InitHybridVentSysAvailMgrErrorsFound = true;
 								}
 							}
 							break;
@@ -4635,7 +4641,7 @@ namespace SystemAvailabilityManager {
 
 				if ( HybridVentSysAvailMgrData( SysAvailNum ).ControlledZoneNum == 0 ) {
 					ShowSevereError( cValidSysAvailManagerTypes( HybridVentSysAvailMgrData( SysAvailNum ).MgrType ) + ", The controlled zone is not defined correctly =" + HybridVentSysAvailMgrData( SysAvailNum ).ControlZoneName );
-					ErrorsFound = true;
+					InitHybridVentSysAvailMgrErrorsFound = true;
 				}
 			}
 
@@ -4651,11 +4657,11 @@ namespace SystemAvailabilityManager {
 				if ( AirLoopCount > 1 ) {
 					ShowSevereError( cValidSysAvailManagerTypes( HybridVentSysAvailMgrData( SysAvailIndex ).MgrType ) + ", The AirLoopHVAC name found more than once=" + PrimaryAirSystem( AirLoopNum ).Name );
 					ShowContinueError( "Each AirLoopHVAC allows one hybrid ventilation control object." );
-					ErrorsFound = true;
+					InitHybridVentSysAvailMgrErrorsFound = true;
 				}
 			}
 
-			if ( ErrorsFound ) {
+			if ( InitHybridVentSysAvailMgrErrorsFound ) {
 				ShowFatalError( "Errors found in getting AvailabilityManager:* inputs" );
 			}
 
@@ -260,8 +260,181 @@ namespace SystemReports {
 	// MODULE SUBROUTINES:
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool OneTimeFlag( true ); // Flag set to make sure you initialize reports one time
+		bool FindFirstLastPtrOneTimeFlag( true ); // Flag set to make sure you initialize reports one time
+		struct IdentifyLoop
+		{
+			// Members
+			int LoopNum;
+			int LoopType;
+
+			// Default Constructor
+			IdentifyLoop() :
+				LoopNum( 0 ),
+				LoopType( 0 )
+			{}
+
+		};
+
+		Array1D< IdentifyLoop > LoopStack;
+		bool UpdateZoneCompPtrArrayOneTimeFlag( true );
+		int ArrayLimit( 100 );
+		int ArrayCounter( 1 );
+		bool UpdateZoneSubCompPtrArrayOneTimeFlag( true );
+		int UpdateZoneSubCompPtrArrayArrayLimit( 100 );
+		int UpdateZoneSubCompPtrArrayArrayCounter( 1 );
+		bool UpdateZoneSubSubCompPtrArrayOneTimeFlag( true );
+		int UpdateZoneSubSubCompPtrArrayArrayLimit( 100 );
+		int UpdateZoneSubSubCompPtrArrayArrayCounter( 1 );
+		bool UpdateAirSysCompPtrArrayOneTimeFlag( true );
+		int UpdateAirSysCompPtrArrayArrayLimit( 100 );
+		int UpdateAirSysCompPtrArrayArrayCounter( 1 );
+		bool UpdateAirSysSubCompPtrArrayOneTimeFlag( true );
+		int UpdateAirSysSubCompPtrArrayArrayLimit( 100 );
+		int UpdateAirSysSubCompPtrArrayArrayCounter( 1 );
+		bool UpdateAirSysSubSubCompPtrArrayOneTimeFlag( true );
+		int UpdateAirSysSubSubCompPtrArrayArrayLimit( 100 );
+		int UpdateAirSysSubSubCompPtrArrayArrayCounter( 1 );
+		int NumCompTypes( 0 );
+		struct CompTypeError
+		{
+			// Members
+			std::string CompType;
+			int CompErrIndex;
+
+			// Default Constructor
+			CompTypeError() :
+				CompErrIndex( 0 )
+			{}
+
+		};
+
+		Array1D< CompTypeError > CompTypeErrors( 100 );
+	}
+
 	// Functions
 
+	// Clears the global data in SystemReports.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		MaxCoolingLoadMetByVent.deallocate();
+		MaxCoolingLoadAddedByVent.deallocate();
+		MaxOvercoolingByVent.deallocate();
+		MaxHeatingLoadMetByVent.deallocate();
+		MaxHeatingLoadAddedByVent.deallocate();
+		MaxOverheatingByVent.deallocate();
+		MaxNoLoadHeatingByVent.deallocate();
+		MaxNoLoadCoolingByVent.deallocate();
+		RemMaxCoolingLoadMetByVent.deallocate();
+		RemMaxCoolingLoadAddedByVent.deallocate();
+		RemMaxOvercoolingByVent.deallocate();
+		RemMaxHeatingLoadMetByVent.deallocate();
+		RemMaxHeatingLoadAddedByVent.deallocate();
+		RemMaxOverheatingByVent.deallocate();
+		RemMaxNoLoadHeatingByVent.deallocate();
+		RemMaxNoLoadCoolingByVent.deallocate();
+		LastMaxCoolingLoadMetByVent.deallocate();
+		LastMaxCoolingLoadAddedByVent.deallocate();
+		LastMaxOvercoolingByVent.deallocate();
+		LastMaxHeatingLoadMetByVent.deallocate();
+		LastMaxHeatingLoadAddedByVent.deallocate();
+		LastMaxOverheatingByVent.deallocate();
+		LastMaxNoLoadHeatingByVent.deallocate();
+		LastMaxNoLoadCoolingByVent.deallocate();
+		SysTotZoneLoadHTNG.deallocate();
+		SysTotZoneLoadCLNG.deallocate();
+		SysOALoadHTNG.deallocate();
+		SysOALoadCLNG.deallocate();
+		SysTotHTNG.deallocate();
+		SysTotCLNG.deallocate();
+		SysTotH2OHOT.deallocate();
+		SysTotH2OCOLD.deallocate();
+		SysTotElec.deallocate();
+		SysTotGas.deallocate();
+		SysTotSteam.deallocate();
+		SysHumidHTNG.deallocate();
+		SysHumidElec.deallocate();
+		SysHumidGas.deallocate();
+		SysEvapCLNG.deallocate();
+		SysEvapElec.deallocate();
+		SysHeatExHTNG.deallocate();
+		SysHeatExCLNG.deallocate();
+		DesDehumidCLNG.deallocate();
+		DesDehumidElec.deallocate();
+		SysSolarCollectHeating.deallocate();
+		SysSolarCollectCooling.deallocate();
+		SysUserDefinedTerminalHeating.deallocate();
+		SysUserDefinedTerminalCooling.deallocate();
+		SysFANCompHTNG.deallocate();
+		SysFANCompElec.deallocate();
+		SysCCCompCLNG.deallocate();
+		SysCCCompH2OCOLD.deallocate();
+		SysCCCompElec.deallocate();
+		SysHCCompH2OHOT.deallocate();
+		SysHCCompElec.deallocate();
+		SysHCCompElecRes.deallocate();
+		SysHCCompHTNG.deallocate();
+		SysHCCompGas.deallocate();
+		SysHCCompSteam.deallocate();
+		SysDomesticH20.deallocate();
+		ZoneOAMassFlow.deallocate();
+		ZoneOAMass.deallocate();
+		ZoneOAVolFlowStdRho.deallocate();
+		ZoneOAVolStdRho.deallocate();
+		ZoneOAVolFlowCrntRho.deallocate();
+		ZoneOAVolCrntRho.deallocate();
+		ZoneMechACH.deallocate();
+		AirLoopLoadsReportEnabled = true;
+		VentLoadsReportEnabled = true;
+		VentEnergyReportEnabled = false;
+		VentReportStructureCreated = false;
+		TotalLoopConnects = 0;
+		MaxLoopArraySize = 100;
+		MaxCompArraySize = 500;
+		DBFlag = 0;
+		SetBackCounter.deallocate();
+		HeatCoolFlag.deallocate();
+		FirstHeatCoolFlag.deallocate();
+		FirstHeatCoolHour.deallocate();
+		LastHeatCoolFlag.deallocate();
+		LastHeatCoolHour.deallocate();
+		AirLoopCalcDone.deallocate();
+		NoLoadFlag.deallocate();
+		UnmetLoadFlag.deallocate();
+		Vent.deallocate();
+		OneTimeFlag = true;
+		FindFirstLastPtrOneTimeFlag = true;
+		LoopStack.deallocate();
+		UpdateZoneCompPtrArrayOneTimeFlag = true;
+		ArrayLimit = 100;
+		ArrayCounter = 1;
+		UpdateZoneSubCompPtrArrayOneTimeFlag = true;
+		UpdateZoneSubCompPtrArrayArrayLimit = 100;
+		UpdateZoneSubCompPtrArrayArrayCounter = 1;
+		UpdateZoneSubSubCompPtrArrayOneTimeFlag = true;
+		UpdateZoneSubSubCompPtrArrayArrayLimit = 100;
+		UpdateZoneSubSubCompPtrArrayArrayCounter = 1;
+		UpdateAirSysCompPtrArrayOneTimeFlag = true;
+		UpdateAirSysCompPtrArrayArrayLimit = 100;
+		UpdateAirSysCompPtrArrayArrayCounter = 1;
+		UpdateAirSysSubCompPtrArrayOneTimeFlag = true;
+		UpdateAirSysSubCompPtrArrayArrayLimit = 100;
+		UpdateAirSysSubCompPtrArrayArrayCounter = 1;
+		UpdateAirSysSubSubCompPtrArrayOneTimeFlag = true;
+		UpdateAirSysSubSubCompPtrArrayArrayLimit = 100;
+		UpdateAirSysSubSubCompPtrArrayArrayCounter = 1;
+		NumCompTypes = 0;
+		CompTypeErrors = Array1D< CompTypeError >( 100 );
+	}
+
 	void
 	InitEnergyReports()
 	{
@@ -341,7 +514,6 @@ namespace SystemReports {
 		std::string CompType;
 		std::string CompName;
 		bool MatchFound;
-		static bool OneTimeFlag( true ); // Flag set to make sure you initialize reports one time
 		bool ConnectionFlag( false );
 
 		if ( ! VentReportStructureCreated ) return;
@@ -1194,34 +1366,18 @@ namespace SystemReports {
 		int DemandSideCompNum;
 		int SupplySideCompNum;
 		int DemandSideLoopType;
-		static bool OneTimeFlag( true ); // Flag set to make sure you initialize reports one time
 		bool found;
 //		int countloop;
 
-		struct IdentifyLoop
-		{
-			// Members
-			int LoopNum;
-			int LoopType;
-
-			// Default Constructor
-			IdentifyLoop() :
-				LoopNum( 0 ),
-				LoopType( 0 )
-			{}
-
-		};
-
 		// Object Data
-		static Array1D< IdentifyLoop > LoopStack;
 
 		return; //Autodesk:? Is this routine now an intentional NOOP?
 
-		if ( OneTimeFlag ) {
+		if ( FindFirstLastPtrOneTimeFlag ) {
 			LoopStack.allocate( MaxLoopArraySize );
 			DemandSideConnect.allocate( MaxCompArraySize );
 
-			OneTimeFlag = false;
+			FindFirstLastPtrOneTimeFlag = false;
 		}
 		for ( auto & e : LoopStack ) {
 			e.LoopNum = 0;
@@ -1374,11 +1530,8 @@ namespace SystemReports {
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
 
-		static bool OneTimeFlag( true );
-		static int ArrayLimit( 100 );
-		static int ArrayCounter( 1 );
 
-		if ( OneTimeFlag ) {
+		if ( UpdateZoneCompPtrArrayOneTimeFlag ) {
 			ZoneCompToPlant.allocate( ArrayLimit );
 			for ( auto & e : ZoneCompToPlant ) {
 				e.ZoneEqListNum = 0;
@@ -1391,7 +1544,7 @@ namespace SystemReports {
 				e.LastDemandSidePtr = 0;
 			}
 
-			OneTimeFlag = false;
+			UpdateZoneCompPtrArrayOneTimeFlag = false;
 		}
 
 		if ( ArrayCounter >= ArrayLimit ) { // Redimension larger
@@ -1459,12 +1612,9 @@ namespace SystemReports {
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
 
-		static bool OneTimeFlag( true );
-		static int ArrayLimit( 100 );
-		static int ArrayCounter( 1 );
 
-		if ( OneTimeFlag ) {
-			ZoneSubCompToPlant.allocate( ArrayLimit );
+		if ( UpdateZoneSubCompPtrArrayOneTimeFlag ) {
+			ZoneSubCompToPlant.allocate( UpdateZoneSubCompPtrArrayArrayLimit );
 			for ( auto & e : ZoneSubCompToPlant ) {
 				e.ZoneEqListNum = 0;
 				e.ZoneEqCompNum = 0;
@@ -1477,13 +1627,13 @@ namespace SystemReports {
 				e.LastDemandSidePtr = 0;
 			}
 
-			OneTimeFlag = false;
+			UpdateZoneSubCompPtrArrayOneTimeFlag = false;
 		}
 
-		if ( ArrayCounter >= ArrayLimit ) { // Redimension larger
-			int const OldArrayLimit( ArrayLimit );
-			ZoneSubCompToPlant.redimension( ArrayLimit *= 2 );
-			for ( int i = OldArrayLimit + 1; i <= ArrayLimit; ++i ) {
+		if ( UpdateZoneSubCompPtrArrayArrayCounter >= UpdateZoneSubCompPtrArrayArrayLimit ) { // Redimension larger
+			int const OldArrayLimit( UpdateZoneSubCompPtrArrayArrayLimit );
+			ZoneSubCompToPlant.redimension( UpdateZoneSubCompPtrArrayArrayLimit *= 2 );
+			for ( int i = OldArrayLimit + 1; i <= UpdateZoneSubCompPtrArrayArrayLimit; ++i ) {
 				auto & zctp( ZoneSubCompToPlant( i ) );
 				zctp.ZoneEqListNum = 0;
 				zctp.ZoneEqCompNum = 0;
@@ -1497,7 +1647,7 @@ namespace SystemReports {
 			}
 		}
 
-		Idx = ArrayCounter;
+		Idx = UpdateZoneSubCompPtrArrayArrayCounter;
 		auto & zctp( ZoneSubCompToPlant( Idx ) );
 		zctp.ZoneEqListNum = ListNum;
 		zctp.ZoneEqCompNum = AirDistUnitNum;
@@ -1506,7 +1656,7 @@ namespace SystemReports {
 		zctp.PlantLoopNum = PlantLoop;
 		zctp.PlantLoopBranch = PlantBranch;
 		zctp.PlantLoopComp = PlantComp;
-		++ArrayCounter;
+		++UpdateZoneSubCompPtrArrayArrayCounter;
 	}
 
 	void
@@ -1548,12 +1698,9 @@ namespace SystemReports {
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
 
-		static bool OneTimeFlag( true );
-		static int ArrayLimit( 100 );
-		static int ArrayCounter( 1 );
 
-		if ( OneTimeFlag ) {
-			ZoneSubSubCompToPlant.allocate( ArrayLimit );
+		if ( UpdateZoneSubSubCompPtrArrayOneTimeFlag ) {
+			ZoneSubSubCompToPlant.allocate( UpdateZoneSubSubCompPtrArrayArrayLimit );
 			for ( auto & e : ZoneSubSubCompToPlant ) {
 				e.ZoneEqListNum = 0;
 				e.ZoneEqCompNum = 0;
@@ -1567,13 +1714,13 @@ namespace SystemReports {
 				e.LastDemandSidePtr = 0;
 			}
 
-			OneTimeFlag = false;
+			UpdateZoneSubSubCompPtrArrayOneTimeFlag = false;
 		}
 
-		if ( ArrayCounter >= ArrayLimit ) { // Redimension larger
-			int const OldArrayLimit( ArrayLimit );
-			ZoneSubSubCompToPlant.redimension( ArrayLimit *= 2 );
-			for ( int i = OldArrayLimit + 1; i <= ArrayLimit; ++i ) {
+		if ( UpdateZoneSubSubCompPtrArrayArrayCounter >= UpdateZoneSubSubCompPtrArrayArrayLimit ) { // Redimension larger
+			int const OldArrayLimit( UpdateZoneSubSubCompPtrArrayArrayLimit );
+			ZoneSubSubCompToPlant.redimension( UpdateZoneSubSubCompPtrArrayArrayLimit *= 2 );
+			for ( int i = OldArrayLimit + 1; i <= UpdateZoneSubSubCompPtrArrayArrayLimit; ++i ) {
 				auto & zctp( ZoneSubSubCompToPlant( i ) );
 				zctp.ZoneEqListNum = 0;
 				zctp.ZoneEqCompNum = 0;
@@ -1588,7 +1735,7 @@ namespace SystemReports {
 			}
 		}
 
-		Idx = ArrayCounter;
+		Idx = UpdateZoneSubSubCompPtrArrayArrayCounter;
 		auto & zctp( ZoneSubSubCompToPlant( Idx ) );
 		zctp.ZoneEqListNum = ListNum;
 		zctp.ZoneEqCompNum = AirDistUnitNum;
@@ -1598,7 +1745,7 @@ namespace SystemReports {
 		zctp.PlantLoopNum = PlantLoop;
 		zctp.PlantLoopBranch = PlantBranch;
 		zctp.PlantLoopComp = PlantComp;
-		++ArrayCounter;
+		++UpdateZoneSubSubCompPtrArrayArrayCounter;
 	}
 
 	void
@@ -1639,12 +1786,9 @@ namespace SystemReports {
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
 
-		static bool OneTimeFlag( true );
-		static int ArrayLimit( 100 );
-		static int ArrayCounter( 1 );
 
-		if ( OneTimeFlag ) {
-			AirSysCompToPlant.allocate( ArrayLimit );
+		if ( UpdateAirSysCompPtrArrayOneTimeFlag ) {
+			AirSysCompToPlant.allocate( UpdateAirSysCompPtrArrayArrayLimit );
 			for ( auto & e : AirSysCompToPlant ) {
 				e.AirLoopNum = 0;
 				e.AirLoopBranch = 0;
@@ -1657,13 +1801,13 @@ namespace SystemReports {
 				e.LastDemandSidePtr = 0;
 			}
 
-			OneTimeFlag = false;
+			UpdateAirSysCompPtrArrayOneTimeFlag = false;
 		}
 
-		if ( ArrayCounter >= ArrayLimit ) { // Redimension larger
-			int const OldArrayLimit( ArrayLimit );
-			AirSysCompToPlant.redimension( ArrayLimit *= 2 );
-			for ( int i = OldArrayLimit + 1; i <= ArrayLimit; ++i ) {
+		if ( UpdateAirSysCompPtrArrayArrayCounter >= UpdateAirSysCompPtrArrayArrayLimit ) { // Redimension larger
+			int const OldArrayLimit( UpdateAirSysCompPtrArrayArrayLimit );
+			AirSysCompToPlant.redimension( UpdateAirSysCompPtrArrayArrayLimit *= 2 );
+			for ( int i = OldArrayLimit + 1; i <= UpdateAirSysCompPtrArrayArrayLimit; ++i ) {
 				auto & actp( AirSysCompToPlant( i ) );
 				actp.AirLoopNum = 0;
 				actp.AirLoopBranch = 0;
@@ -1677,7 +1821,7 @@ namespace SystemReports {
 			}
 		}
 
-		Idx = ArrayCounter;
+		Idx = UpdateAirSysCompPtrArrayArrayCounter;
 		auto & actp( AirSysCompToPlant( Idx ) );
 		actp.AirLoopNum = AirLoopNum;
 		actp.AirLoopBranch = BranchNum;
@@ -1686,7 +1830,7 @@ namespace SystemReports {
 		actp.PlantLoopNum = PlantLoop;
 		actp.PlantLoopBranch = PlantBranch;
 		actp.PlantLoopComp = PlantComp;
-		++ArrayCounter;
+		++UpdateAirSysCompPtrArrayArrayCounter;
 	}
 
 	void
@@ -1728,12 +1872,9 @@ namespace SystemReports {
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
 
-		static bool OneTimeFlag( true );
-		static int ArrayLimit( 100 );
-		static int ArrayCounter( 1 );
 
-		if ( OneTimeFlag ) {
-			AirSysSubCompToPlant.allocate( ArrayLimit );
+		if ( UpdateAirSysSubCompPtrArrayOneTimeFlag ) {
+			AirSysSubCompToPlant.allocate( UpdateAirSysSubCompPtrArrayArrayLimit );
 			for ( auto & e : AirSysSubCompToPlant ) {
 				e.AirLoopNum = 0;
 				e.AirLoopBranch = 0;
@@ -1747,13 +1888,13 @@ namespace SystemReports {
 				e.LastDemandSidePtr = 0;
 			}
 
-			OneTimeFlag = false;
+			UpdateAirSysSubCompPtrArrayOneTimeFlag = false;
 		}
 
-		if ( ArrayCounter >= ArrayLimit ) { // Redimension larger
-			int const OldArrayLimit( ArrayLimit );
-			AirSysSubCompToPlant.redimension( ArrayLimit *= 2 );
-			for ( int i = OldArrayLimit + 1; i <= ArrayLimit; ++i ) {
+		if ( UpdateAirSysSubCompPtrArrayArrayCounter >= UpdateAirSysSubCompPtrArrayArrayLimit ) { // Redimension larger
+			int const OldArrayLimit( UpdateAirSysSubCompPtrArrayArrayLimit );
+			AirSysSubCompToPlant.redimension( UpdateAirSysSubCompPtrArrayArrayLimit *= 2 );
+			for ( int i = OldArrayLimit + 1; i <= UpdateAirSysSubCompPtrArrayArrayLimit; ++i ) {
 				auto & actp( AirSysSubCompToPlant( i ) );
 				actp.AirLoopNum = 0;
 				actp.AirLoopBranch = 0;
@@ -1768,7 +1909,7 @@ namespace SystemReports {
 			}
 		}
 
-		Idx = ArrayCounter;
+		Idx = UpdateAirSysSubCompPtrArrayArrayCounter;
 		auto & actp( AirSysSubCompToPlant( Idx ) );
 		actp.AirLoopNum = AirLoopNum;
 		actp.AirLoopBranch = BranchNum;
@@ -1778,7 +1919,7 @@ namespace SystemReports {
 		actp.PlantLoopNum = PlantLoop;
 		actp.PlantLoopBranch = PlantBranch;
 		actp.PlantLoopComp = PlantComp;
-		++ArrayCounter;
+		++UpdateAirSysSubCompPtrArrayArrayCounter;
 	}
 
 	void
@@ -1821,12 +1962,9 @@ namespace SystemReports {
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
 
-		static bool OneTimeFlag( true );
-		static int ArrayLimit( 100 );
-		static int ArrayCounter( 1 );
 
-		if ( OneTimeFlag ) {
-			AirSysSubSubCompToPlant.allocate( ArrayLimit );
+		if ( UpdateAirSysSubSubCompPtrArrayOneTimeFlag ) {
+			AirSysSubSubCompToPlant.allocate( UpdateAirSysSubSubCompPtrArrayArrayLimit );
 			for ( auto & e : AirSysSubSubCompToPlant ) {
 				e.AirLoopNum = 0;
 				e.AirLoopBranch = 0;
@@ -1841,13 +1979,13 @@ namespace SystemReports {
 				e.LastDemandSidePtr = 0;
 			}
 
-			OneTimeFlag = false;
+			UpdateAirSysSubSubCompPtrArrayOneTimeFlag = false;
 		}
 
-		if ( ArrayCounter >= ArrayLimit ) { // Redimension larger
-			int const OldArrayLimit( ArrayLimit );
-			AirSysSubSubCompToPlant.redimension( ArrayLimit *= 2 );
-			for ( int i = OldArrayLimit + 1; i <= ArrayLimit; ++i ) {
+		if ( UpdateAirSysSubSubCompPtrArrayArrayCounter >= UpdateAirSysSubSubCompPtrArrayArrayLimit ) { // Redimension larger
+			int const OldArrayLimit( UpdateAirSysSubSubCompPtrArrayArrayLimit );
+			AirSysSubSubCompToPlant.redimension( UpdateAirSysSubSubCompPtrArrayArrayLimit *= 2 );
+			for ( int i = OldArrayLimit + 1; i <= UpdateAirSysSubSubCompPtrArrayArrayLimit; ++i ) {
 				auto & actp( AirSysSubSubCompToPlant( i ) );
 				actp.AirLoopNum = 0;
 				actp.AirLoopBranch = 0;
@@ -1863,7 +2001,7 @@ namespace SystemReports {
 			}
 		}
 
-		Idx = ArrayCounter;
+		Idx = UpdateAirSysSubSubCompPtrArrayArrayCounter;
 		auto & actp( AirSysSubSubCompToPlant( Idx ) );
 		actp.AirLoopNum = AirLoopNum;
 		actp.AirLoopBranch = BranchNum;
@@ -1874,7 +2012,7 @@ namespace SystemReports {
 		actp.PlantLoopNum = PlantLoop;
 		actp.PlantLoopBranch = PlantBranch;
 		actp.PlantLoopComp = PlantComp;
-		++ArrayCounter;
+		++UpdateAirSysSubSubCompPtrArrayArrayCounter;
 	}
 
 	void
@@ -3593,24 +3731,9 @@ namespace SystemReports {
 		// DERIVED TYPE DEFINITIONS
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int NumCompTypes( 0 );
 		int found;
 
-		struct CompTypeError
-		{
-			// Members
-			std::string CompType;
-			int CompErrIndex;
-
-			// Default Constructor
-			CompTypeError() :
-				CompErrIndex( 0 )
-			{}
-
-		};
-
 		// Object Data
-		static Array1D< CompTypeError > CompTypeErrors( 100 );
 
 		if ( ! AirLoopLoadsReportEnabled ) return;
 
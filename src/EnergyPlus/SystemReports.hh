@@ -239,6 +239,11 @@ namespace SystemReports {
 
 	// Functions
 
+	// Clears the global data in SystemReports.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	InitEnergyReports();
 
@@ -98,8 +98,26 @@ namespace TARCOGCommon {
 	// Using/Aliasing
 	using namespace DataPrecisionGlobals;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int const NMAX( 500 );
+		Array1D< Real64 > vv( NMAX );
+	}
+
 	// Functions
 
+	// Clears the global data in TARCOGCommon.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		vv = Array1D< Real64 >( NMAX );
+	}
+
 	bool
 	IsShadingLayer( int const layertype )
 	{
@@ -341,8 +359,6 @@ namespace TARCOGCommon {
 	{
 
 		// Locals
-		static int const NMAX( 500 );
-		static Array1D< Real64 > vv( NMAX );
 
 		Real64 const TINY( 1.0e-20 );
 
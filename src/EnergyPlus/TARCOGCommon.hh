@@ -72,6 +72,11 @@ namespace TARCOGCommon {
 
 	// Functions
 
+	// Clears the global data in TARCOGCommon.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	bool
 	IsShadingLayer( int const layertype );
 
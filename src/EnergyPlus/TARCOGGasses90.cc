@@ -108,8 +108,45 @@ namespace TARCOGGasses90 {
 	// Data
 	//private doe2gas90
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		Array1D< Real64 > fvis( maxgas );
+		Array1D< Real64 > fcon( maxgas );
+		Array1D< Real64 > fdens( maxgas );
+		Array1D< Real64 > fcp( maxgas );
+		Array1D< Real64 > kprime( maxgas );
+		Array1D< Real64 > kdblprm( maxgas );
+		Array1D< Real64 > mukpdwn( maxgas );
+		Array1D< Real64 > kpdown( maxgas );
+		Array1D< Real64 > kdpdown( maxgas );
+		Real64 alpha( 0.0 );
+		Real64 B( 0.0 );
+	}
+
 	// Functions
 
+	// Clears the global data in TARCOGGasses90.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		fvis = Array1D< Real64 >( maxgas );
+		fcon = Array1D< Real64 >( maxgas );
+		fdens = Array1D< Real64 >( maxgas );
+		fcp = Array1D< Real64 >( maxgas );
+		kprime = Array1D< Real64 >( maxgas );
+		kdblprm = Array1D< Real64 >( maxgas );
+		mukpdwn = Array1D< Real64 >( maxgas );
+		kpdown = Array1D< Real64 >( maxgas );
+		kdpdown = Array1D< Real64 >( maxgas );
+		alpha = 0.0;
+		B = 0.0;
+	}
+
 	void
 	GASSES90(
 		Real64 const tmean,
@@ -137,15 +174,6 @@ namespace TARCOGGasses90 {
 		// Locals
 
 		static Real64 const two_sqrt_2( 2.0 * std::sqrt( 2.0 ) );
-		static Array1D< Real64 > fvis( maxgas );
-		static Array1D< Real64 > fcon( maxgas );
-		static Array1D< Real64 > fdens( maxgas );
-		static Array1D< Real64 > fcp( maxgas );
-		static Array1D< Real64 > kprime( maxgas );
-		static Array1D< Real64 > kdblprm( maxgas );
-		static Array1D< Real64 > mukpdwn( maxgas );
-		static Array1D< Real64 > kpdown( maxgas );
-		static Array1D< Real64 > kdpdown( maxgas );
 		Real64 molmix;
 		Real64 cpmixm;
 		Real64 phimup;
@@ -312,8 +340,6 @@ namespace TARCOGGasses90 {
 	{
 
 		// Locals
-		static Real64 alpha( 0.0 );
-		static Real64 B( 0.0 );
 
 		alpha = alpha1 * alpha2 / ( alpha2 + alpha1 * ( 1 - alpha2 ) );
 
@@ -75,6 +75,11 @@ namespace TARCOGGasses90 {
 
 	// Functions
 
+	// Clears the global data in TARCOGGasses90.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	GASSES90(
 		Real64 const tmean,
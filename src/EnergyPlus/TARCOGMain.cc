@@ -363,8 +363,35 @@ namespace TARCOGMain {
 	using namespace ThermalEN673Calc;
 	using namespace TARCOGDeflection;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		Array1D< Real64 > sconTemp( maxlay );
+		Array1D< Real64 > thickTemp( maxlay );
+		bool converged( false ); // used for convergence check in case of deflection calculations
+		Array1D< Real64 > told( maxlay2 );
+		Array1D< Real64 > CurGap( MaxGap );
+		Array1D< Real64 > GapDefMean( MaxGap );
+	}
+
 	// Functions
 
+	// Clears the global data in TARCOGMain.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		sconTemp = Array1D< Real64 >( maxlay );
+		thickTemp = Array1D< Real64 >( maxlay );
+		converged = false;
+		told = Array1D< Real64 >( maxlay2 );
+		CurGap = Array1D< Real64 >( MaxGap );
+		GapDefMean = Array1D< Real64 >( MaxGap );
+	}
+
 	void
 	TARCOG90(
 		int const nlayer, // Number of layers (glass + SD)
@@ -645,16 +672,10 @@ namespace TARCOGMain {
 		Real64 trminTemp;
 		Real64 hinTemp;
 		Real64 houtTemp;
-		static Array1D< Real64 > sconTemp( maxlay );
-		static Array1D< Real64 > thickTemp( maxlay );
 
 		//REAL(r64), dimension(maxlay) ::  sol ! Vector of Absorbed solar energy for each layer [W/m2] = dir*asol
 
 		//Internaly used
-		static bool converged( false ); // used for convergence check in case of deflection calculations
-		static Array1D< Real64 > told( maxlay2 );
-		static Array1D< Real64 > CurGap( MaxGap );
-		static Array1D< Real64 > GapDefMean( MaxGap );
 		Real64 dtmax;
 		int i;
 		int counter;
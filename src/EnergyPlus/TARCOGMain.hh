@@ -72,6 +72,11 @@ namespace TARCOGMain {
 
 	// Functions
 
+	// Clears the global data in TARCOGMain.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	TARCOG90(
 		int const nlayer, // Number of layers (glass + SD)
@@ -142,8 +142,40 @@ namespace TARCOGOutput {
 
 	static gio::Fmt fmtLD( "*" );
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		std::string dynFormat;
+	}
+
 	// Functions
 
+	// Clears the global data in TARCOGOutput.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		DBGD.clear();
+		FileMode.clear();
+		FilePosition.clear();
+		WriteDebugOutput = false;
+		DebugMode = 0;
+		winID = 0;
+		iguID = 0;
+		InArgumentsFile = statusClosed;
+		OutArgumentsFile = statusClosed;
+		WINCogFile = statusClosed;
+		IterationCSVFileNumber = statusClosed;
+		TarcogIterationsFileNumber = statusClosed;
+		IterationCSVName = "IterationResults.csv";
+		WinCogFileName = "test.w7";
+		DebugOutputFileName = "Tarcog.dbg";
+		dynFormat.clear();
+	}
+
 	void
 	WriteInputArguments(
 		Real64 const tout,
@@ -1197,7 +1229,6 @@ namespace TARCOGOutput {
 		Array1D_string real_CLOCK( 3 );
 
 
-		static std::string dynFormat;
 
 		// Formats
 		static gio::Fmt Format_111( "('*')" );
@@ -104,6 +104,11 @@ namespace TARCOGOutput {
 
 	// Functions
 
+	// Clears the global data in TARCOGOutput.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	WriteInputArguments(
 		Real64 const tout,
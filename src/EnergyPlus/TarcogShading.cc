@@ -104,8 +104,31 @@ namespace TarcogShading {
 	using namespace TARCOGGasses90;
 	using namespace TARCOGParams;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		Array1D< Real64 > shading_frct1( maxgas );
+		Array1D< Real64 > shading_frct2( maxgas );
+		Array1D_int shading_iprop1( maxgas );
+		Array1D_int shading_iprop2( maxgas );
+	}
+
 	// Functions
 
+	// Clears the global data in TarcogShading.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		shading_frct1 = Array1D< Real64 >( maxgas );
+		shading_frct2 = Array1D< Real64 >( maxgas );
+		shading_iprop1 = Array1D_int( maxgas );
+		shading_iprop2 = Array1D_int( maxgas );
+	}
+
 	void
 	shading(
 		Array1< Real64 > const & theta,
@@ -196,8 +219,6 @@ namespace TarcogShading {
 		Real64 hc;
 		Real64 hc1;
 		Real64 hc2;
-		static Array1D< Real64 > frct1( maxgas );
-		static Array1D< Real64 > frct2( maxgas );
 		Real64 speed;
 		Real64 Tav;
 		Real64 Tgap;
@@ -218,8 +239,6 @@ namespace TarcogShading {
 		int k;
 		int nmix1;
 		int nmix2;
-		static Array1D_int iprop1( maxgas );
-		static Array1D_int iprop2( maxgas );
 
 		// init vectors:
 		qv = 0.0;
@@ -245,10 +264,10 @@ namespace TarcogShading {
 				press1 = pressure( i );
 				press2 = pressure( i + 1 );
 				for ( j = 1; j <= maxgas; ++j ) {
-					iprop1( j ) = iprop( j, i );
-					iprop2( j ) = iprop( j, i + 1 );
-					frct1( j ) = frct( j, i );
-					frct2( j ) = frct( j, i + 1 );
+					shading_iprop1( j ) = iprop( j, i );
+					shading_iprop2( j ) = iprop( j, i + 1 );
+					shading_frct1( j ) = frct( j, i );
+					shading_frct2( j ) = frct( j, i + 1 );
 				} // j
 
 				//dr.......shading on outdoor side
@@ -260,7 +279,7 @@ namespace TarcogShading {
 					Tgap = Tgaps( 2 );
 
 					//bi......use Tout as temp of the air at inlet
-					shadingedge( iprop1, frct1, press1, nmix1, iprop2, frct2, press2, nmix2, xwght, xgcon, xgvis, xgcp, Atops, Abots, Als, Ars, Ahs, s, height, width, angle, vvent( 2 ), hc, Tout, Tav, Tgap, hcvs, qvs, nperr, ErrorMessage, speed );
+					shadingedge( shading_iprop1, shading_frct1, press1, nmix1, shading_iprop2, shading_frct2, press2, nmix2, xwght, xgcon, xgvis, xgcp, Atops, Abots, Als, Ars, Ahs, s, height, width, angle, vvent( 2 ), hc, Tout, Tav, Tgap, hcvs, qvs, nperr, ErrorMessage, speed );
 
 					// exit on error
 					if ( ( nperr > 0 ) && ( nperr < 1000 ) ) return;
@@ -291,7 +310,7 @@ namespace TarcogShading {
 					Tgap = Tgaps( nlayer );
 
 					//bi.........use Tin as temp of the air at inlet
-					shadingedge( iprop2, frct2, press2, nmix2, iprop1, frct1, press1, nmix1, xwght, xgcon, xgvis, xgcp, Atops, Abots, Als, Ars, Ahs, s, height, width, angle, vvent( nlayer ), hc, Tin, Tav, Tgap, hcvs, qvs, nperr, ErrorMessage, speed );
+					shadingedge( shading_iprop2, shading_frct2, press2, nmix2, shading_iprop1, shading_frct1, press1, nmix1, xwght, xgcon, xgvis, xgcp, Atops, Abots, Als, Ars, Ahs, s, height, width, angle, vvent( nlayer ), hc, Tin, Tav, Tgap, hcvs, qvs, nperr, ErrorMessage, speed );
 
 					// exit on error
 					if ( ( nperr > 0 ) && ( nperr < 1000 ) ) return;
@@ -322,10 +341,10 @@ namespace TarcogShading {
 					//speed2 = vvent(i+1)
 
 					if ( ( CalcForcedVentilation != 0 ) && ( ( vvent( i ) != 0 ) || ( vvent( i + 1 ) != 0 ) ) ) {
-						forcedventilation( iprop1, frct1, press1, nmix1, xwght, xgcon, xgvis, xgcp, s1, height, hc1, vvent( i ), tvent( i ), Temp, Tav1, hcv1, qv1, nperr, ErrorMessage );
-						forcedventilation( iprop2, frct2, press2, nmix1, xwght, xgcon, xgvis, xgcp, s2, height, hc1, vvent( i + 1 ), tvent( i + 1 ), Temp, Tav2, hcv2, qv2, nperr, ErrorMessage );
+						forcedventilation( shading_iprop1, shading_frct1, press1, nmix1, xwght, xgcon, xgvis, xgcp, s1, height, hc1, vvent( i ), tvent( i ), Temp, Tav1, hcv1, qv1, nperr, ErrorMessage );
+						forcedventilation( shading_iprop2, shading_frct2, press2, nmix1, xwght, xgcon, xgvis, xgcp, s2, height, hc1, vvent( i + 1 ), tvent( i + 1 ), Temp, Tav2, hcv2, qv2, nperr, ErrorMessage );
 					} else {
-						shadingin( iprop1, frct1, press1, nmix1, iprop2, frct2, press2, nmix2, xwght, xgcon, xgvis, xgcp, Atops, Abots, Als, Ars, Ahs, s1, s2, height, width, angle, hc1, hc2, speed1, speed2, Tgap1, Tgap2, Tav1, Tav2, hcv1, hcv2, qv1, qv2, nperr, ErrorMessage );
+						shadingin( shading_iprop1, shading_frct1, press1, nmix1, shading_iprop2, shading_frct2, press2, nmix2, xwght, xgcon, xgvis, xgcp, Atops, Abots, Als, Ars, Ahs, s1, s2, height, width, angle, hc1, hc2, speed1, speed2, Tgap1, Tgap2, Tav1, Tav2, hcv1, hcv2, qv1, qv2, nperr, ErrorMessage );
 					}
 
 					// exit on error
@@ -72,6 +72,11 @@ namespace TarcogShading {
 
 	// Functions
 
+	// Clears the global data in TarcogShading.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	shading(
 		Array1< Real64 > const & theta,
@@ -137,8 +137,31 @@ namespace ThermalChimney {
 	// MODULE SUBROUTINES:
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true );
+		bool ManageThermalChimneyErrorsFound( false );
+	}
+
 	// Functions
 
+	// Clears the global data in ThermalChimney.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		TotThermalChimney = 0;
+		ThermalChimneySys.deallocate();
+		ZnRptThermChim.deallocate();
+		ThermalChimneyReport.deallocate();
+		GetInputFlag = true;
+		ManageThermalChimneyErrorsFound = false;
+	}
+
 	void
 	ManageThermalChimney()
 	{
@@ -177,12 +200,10 @@ namespace ThermalChimney {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInputFlag( true );
-		static bool ErrorsFound( false );
 
 		// Obtains and Allocates heat balance related parameters from input file
 		if ( GetInputFlag ) {
-			GetThermalChimney( ErrorsFound );
+			GetThermalChimney( ManageThermalChimneyErrorsFound );
 			GetInputFlag = false;
 		}
 
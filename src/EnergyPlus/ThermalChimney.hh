@@ -161,6 +161,11 @@ namespace ThermalChimney {
 
 	// Functions
 
+	// Clears the global data in ThermalChimney.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	ManageThermalChimney();
 
@@ -69,6 +69,7 @@
 // EnergyPlus Headers
 #include <CommandLineInterface.hh>
 #include <ThermalComfort.hh>
+#include <Checkpoint.hh>
 #include <DataEnvironment.hh>
 #include <DataHeatBalance.hh>
 #include <DataHeatBalFanSys.hh>
@@ -79,6 +80,7 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataRoomAirModel.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneEnergyDemands.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
@@ -155,6 +157,21 @@ namespace ThermalComfort {
 	namespace {
 		// clear_state variables
 		bool FirstTimeFlag( true ); // Flag set to make sure you get input once
+		bool ASH55Flag( false );
+		bool CEN15251Flag( false );
+		Array1D< Real64 > Coeff( 2 ); // Coefficients used in Range-Kutta's Method
+		Array1D< Real64 > CalcThermalComfortKSUTemp( 2 ); // Temperature
+		Array1D< Real64 > CalcThermalComfortKSUTempChange( 2 ); // Change of temperature
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		Real64 avgDryBulbASH( 0.0 );
+		Real64 runningAverageASH( 0.0 );
+		Array1D< Real64 > monthlyTemp( 12, 0.0 );
+		bool useStatData( false );
+		bool useEpwData( false );
+		Real64 avgDryBulbCEN( 0.0 );
+		Real64 runningAverageCEN( 0.0 );
+		bool CalcThermalComfortAdaptiveCEN15251_useEpwData( false );
+		bool firstDaySet( false ); // first day is set with initiate -- so do not update
 	}
 
 	// Data
@@ -364,6 +381,21 @@ namespace ThermalComfort {
 		ThermalComfortSetPoint.deallocate();
 		ThermalComfortData.deallocate();
 		AngleFactorList.deallocate();
+		ASH55Flag = false;
+		CEN15251Flag = false;
+		Coeff = Array1D< Real64 >( 2 );
+		CalcThermalComfortKSUTemp = Array1D< Real64 >( 2 );
+		CalcThermalComfortKSUTempChange = Array1D< Real64 >( 2 );
+		ErrorsFound = false;
+		avgDryBulbASH = 0.0;
+		runningAverageASH = 0.0;
+		monthlyTemp = Array1D< Real64 >( 12, 0.0 );
+		useStatData = false;
+		useEpwData = false;
+		avgDryBulbCEN = 0.0;
+		runningAverageCEN = 0.0;
+		CalcThermalComfortAdaptiveCEN15251_useEpwData = false;
+		firstDaySet = false;
 	}
 
 	void
@@ -401,8 +433,6 @@ namespace ThermalComfort {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ASH55Flag( false );
-		static bool CEN15251Flag( false );
 
 		// FLOW:
 		// No input to get because this is already done by other heat balance routines
@@ -436,6 +466,7 @@ namespace ThermalComfort {
 
 		if ( BeginEnvrnFlag ) {
 			ZoneOccHrs = 0.0;
+			Checkpoint::RestoreZoneOccupiedHours();
 		}
 
 		if ( ! DoingSizing && ! WarmupFlag ) {
@@ -1350,9 +1381,6 @@ namespace ThermalComfort {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static Array1D< Real64 > Coeff( 2 ); // Coefficients used in Range-Kutta's Method
-		static Array1D< Real64 > Temp( 2 ); // Temperature
-		static Array1D< Real64 > TempChange( 2 ); // Change of temperature
 
 		Real64 BodyWt; // Weight of body, kg
 		Real64 DayNum; // Number of days of acclimation
@@ -1472,8 +1500,8 @@ namespace ThermalComfort {
 				Time = 0.0;
 				TimeChange = 0.01;
 				SweatSuppFac = 1.0;
-				Temp( 1 ) = CoreTemp;
-				Temp( 2 ) = SkinTemp;
+				CalcThermalComfortKSUTemp( 1 ) = CoreTemp;
+				CalcThermalComfortKSUTemp( 2 ) = SkinTemp;
 				Coeff( 1 ) = Coeff( 2 ) = 0.0;
 				//  PHYSIOLOGICAL ADJUSTMENTS IN HEAT ACCLIMATION.
 				AcclPattern = 1.0 - std::exp( -0.12 * ( DayNum - 1.0 ) );
@@ -1482,7 +1510,7 @@ namespace ThermalComfort {
 				ActLevel -= 0.07 * ActLevel * AcclPattern;
 				Real64 const SkinTempNeut_fac( 1.0 / ( 1.0 - SkinWetNeut ) );
 				//  CALCULATION OF CoreTempChange/TempChange & SkinTempChange/TempChange
-				DERIV( TempIndiceNum, Temp, TempChange );
+				DERIV( TempIndiceNum, CalcThermalComfortKSUTemp, CalcThermalComfortKSUTempChange );
 				while ( true ) {
 					//  CALCULATION OF THERMAL SENSATION VOTE (TSV).
 					//  THE TSV MODEL CAN BE APPLIED TO UNACCLIMATED MAN ONLY.
@@ -1502,11 +1530,11 @@ namespace ThermalComfort {
 					ThermalComfortData( PeopleNum ).ThermalComfortMRT = RadTemp;
 					ThermalComfortData( PeopleNum ).ThermalComfortOpTemp = ( RadTemp + AirTemp ) / 2.0;
 
-					CoreTemp = Temp( 1 );
-					SkinTemp = Temp( 2 );
+					CoreTemp = CalcThermalComfortKSUTemp( 1 );
+					SkinTemp = CalcThermalComfortKSUTemp( 2 );
 					EvapHeatLossSweatPrev = EvapHeatLossSweat;
 
-					RKG( TempIndiceNum, TimeChange, Time, Temp, TempChange, Coeff );
+					RKG( TempIndiceNum, TimeChange, Time, CalcThermalComfortKSUTemp, CalcThermalComfortKSUTempChange, Coeff );
 
 					if ( Time > TimeExpos ) break;
 
@@ -1867,7 +1895,6 @@ namespace ThermalComfort {
 		//unused1208  CHARACTER(len=MaxNameLength),  &
 		//        DIMENSION(22)       :: Alphas                  ! Alpha strings from Input Processor
 		Real64 AllAngleFacSummed; // Sum of angle factors in each zone
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		int IOStatus;
 		int Item; // Item to be "gotten"
 		int NumAlphas; // Number of Alphas from InputProcessor
@@ -2183,11 +2210,6 @@ namespace ThermalComfort {
 
 		// Using/Aliasing
 		using OutputReportTabular::isInQuadrilateral;
-		using General::RoundSigDigits;
-		using DataEnvironment::EnvironmentName;
-		using DataEnvironment::RunPeriodEnvironment;
-		using DataEnvironment::EnvironmentStartEnd;
-		using namespace OutputReportPredefined;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -2211,8 +2233,6 @@ namespace ThermalComfort {
 		bool isComfortableWithWinterClothes;
 		int iPeople;
 		int iZone;
-		Real64 allowedHours;
-		bool showWarning;
 
 		AnyZoneTimeNotSimpleASH55Summer = 0.0;
 		AnyZoneTimeNotSimpleASH55Winter = 0.0;
@@ -2305,67 +2325,89 @@ namespace ThermalComfort {
 		TotalAnyZoneTimeNotSimpleASH55Winter += AnyZoneTimeNotSimpleASH55Winter;
 		TotalAnyZoneTimeNotSimpleASH55Either += AnyZoneTimeNotSimpleASH55Either;
 		//was EndEnvrnsFlag prior to CR7562
-		if ( EndDesignDayEnvrnsFlag ) {
-			allowedHours = double( NumOfDayInEnvrn ) * 24.0 * 0.04;
-			//first check if warning should be printed
-			showWarning = false;
+		// a segment of a split run period reports once the gathering of the later segments is merged
+		if ( EndDesignDayEnvrnsFlag && ! ( DataSystemVariables::SegmentNum > 0 && KindOfSim == ksRunPeriodWeather ) ) {
+			ReportThermalComfortSimpleASH55();
+		}
+	}
+
+	void
+	ReportThermalComfortSimpleASH55()
+	{
+		// Reports the time not comfortable in the simple ASHRAE 55-2004 comfort regions and the
+		// occupied hours at the end of the environments of a kind, and resets the accumulations.
+
+		// Using/Aliasing
+		using General::RoundSigDigits;
+		using DataEnvironment::EnvironmentName;
+		using DataEnvironment::RunPeriodEnvironment;
+		using DataEnvironment::EnvironmentStartEnd;
+		using namespace OutputReportPredefined;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int iZone;
+		Real64 allowedHours;
+		bool showWarning;
+
+		allowedHours = double( NumOfDayInEnvrn ) * 24.0 * 0.04;
+		//first check if warning should be printed
+		showWarning = false;
+		for ( iZone = 1; iZone <= NumOfZones; ++iZone ) {
+			if ( ThermalComfortInASH55( iZone ).Enable55Warning ) {
+				if ( ThermalComfortInASH55( iZone ).totalTimeNotEither > allowedHours ) {
+					showWarning = true;
+				}
+			}
+		}
+		//if any zones should be warning print it out
+		if ( showWarning ) {
+			ShowWarningError( "More than 4% of time (" + RoundSigDigits( allowedHours, 1 ) + " hours) uncomfortable in one or more zones " );
+			ShowContinueError( "Based on ASHRAE 55-2004 graph (Section 5.2.1.1)" );
+			if ( RunPeriodEnvironment ) {
+				ShowContinueError( "During Environment [" + EnvironmentStartEnd + "]: " + EnvironmentName );
+			} else {
+				ShowContinueError( "During SizingPeriod Environment [" + EnvironmentStartEnd + "]: " + EnvironmentName );
+			}
 			for ( iZone = 1; iZone <= NumOfZones; ++iZone ) {
 				if ( ThermalComfortInASH55( iZone ).Enable55Warning ) {
 					if ( ThermalComfortInASH55( iZone ).totalTimeNotEither > allowedHours ) {
-						showWarning = true;
-					}
-				}
-			}
-			//if any zones should be warning print it out
-			if ( showWarning ) {
-				ShowWarningError( "More than 4% of time (" + RoundSigDigits( allowedHours, 1 ) + " hours) uncomfortable in one or more zones " );
-				ShowContinueError( "Based on ASHRAE 55-2004 graph (Section 5.2.1.1)" );
-				if ( RunPeriodEnvironment ) {
-					ShowContinueError( "During Environment [" + EnvironmentStartEnd + "]: " + EnvironmentName );
-				} else {
-					ShowContinueError( "During SizingPeriod Environment [" + EnvironmentStartEnd + "]: " + EnvironmentName );
-				}
-				for ( iZone = 1; iZone <= NumOfZones; ++iZone ) {
-					if ( ThermalComfortInASH55( iZone ).Enable55Warning ) {
-						if ( ThermalComfortInASH55( iZone ).totalTimeNotEither > allowedHours ) {
-							ShowContinueError( RoundSigDigits( ThermalComfortInASH55( iZone ).totalTimeNotEither, 1 ) + " hours were uncomfortable in zone: " + Zone( iZone ).Name );
-						}
+						ShowContinueError( RoundSigDigits( ThermalComfortInASH55( iZone ).totalTimeNotEither, 1 ) + " hours were uncomfortable in zone: " + Zone( iZone ).Name );
 					}
 				}
 			}
-			// put in predefined reports
-			for ( iZone = 1; iZone <= NumOfZones; ++iZone ) {
-				PreDefTableEntry( pdchSCwinterClothes, Zone( iZone ).Name, ThermalComfortInASH55( iZone ).totalTimeNotWinter );
-				PreDefTableEntry( pdchSCsummerClothes, Zone( iZone ).Name, ThermalComfortInASH55( iZone ).totalTimeNotSummer );
-				PreDefTableEntry( pdchSCeitherClothes, Zone( iZone ).Name, ThermalComfortInASH55( iZone ).totalTimeNotEither );
-			}
-			PreDefTableEntry( pdchSCwinterClothes, "Facility", TotalAnyZoneTimeNotSimpleASH55Winter );
-			PreDefTableEntry( pdchSCsummerClothes, "Facility", TotalAnyZoneTimeNotSimpleASH55Summer );
-			PreDefTableEntry( pdchSCeitherClothes, "Facility", TotalAnyZoneTimeNotSimpleASH55Either );
-			//set value for ABUPS report
-			TotalTimeNotSimpleASH55EitherForABUPS = TotalAnyZoneTimeNotSimpleASH55Either;
-			//reset accumulation for new environment
-			for ( iZone = 1; iZone <= NumOfZones; ++iZone ) {
-				ThermalComfortInASH55( iZone ).totalTimeNotWinter = 0.0;
-				ThermalComfortInASH55( iZone ).totalTimeNotSummer = 0.0;
-				ThermalComfortInASH55( iZone ).totalTimeNotEither = 0.0;
-			}
-			TotalAnyZoneTimeNotSimpleASH55Winter = 0.0;
-			TotalAnyZoneTimeNotSimpleASH55Summer = 0.0;
-			TotalAnyZoneTimeNotSimpleASH55Either = 0.0;
-			// report how the aggregation is conducted
-			{ auto const SELECT_CASE_var( KindOfSim );
-			if ( SELECT_CASE_var == ksDesignDay ) {
-				addFootNoteSubTable( pdstSimpleComfort, "Aggregated over the Design Days" );
-			} else if ( SELECT_CASE_var == ksRunPeriodDesign ) {
-				addFootNoteSubTable( pdstSimpleComfort, "Aggregated over the RunPeriods for Design" );
-			} else if ( SELECT_CASE_var == ksRunPeriodWeather ) {
-				addFootNoteSubTable( pdstSimpleComfort, "Aggregated over the RunPeriods for Weather" );
-			}}
-			//report number of occupied hours per week for LEED report
-			for ( iZone = 1; iZone <= NumOfZones; ++iZone ) {
-				PreDefTableEntry( pdchLeedSutHrsWeek, Zone( iZone ).Name, 7 * 24 * ( ZoneOccHrs( iZone ) / ( NumOfDayInEnvrn * 24 ) ) );
-			}
+		}
+		// put in predefined reports
+		for ( iZone = 1; iZone <= NumOfZones; ++iZone ) {
+			PreDefTableEntry( pdchSCwinterClothes, Zone( iZone ).Name, ThermalComfortInASH55( iZone ).totalTimeNotWinter );
+			PreDefTableEntry( pdchSCsummerClothes, Zone( iZone ).Name, ThermalComfortInASH55( iZone ).totalTimeNotSummer );
+			PreDefTableEntry( pdchSCeitherClothes, Zone( iZone ).Name, ThermalComfortInASH55( iZone ).totalTimeNotEither );
+		}
+		PreDefTableEntry( pdchSCwinterClothes, "Facility", TotalAnyZoneTimeNotSimpleASH55Winter );
+		PreDefTableEntry( pdchSCsummerClothes, "Facility", TotalAnyZoneTimeNotSimpleASH55Summer );
+		PreDefTableEntry( pdchSCeitherClothes, "Facility", TotalAnyZoneTimeNotSimpleASH55Either );
+		//set value for ABUPS report
+		TotalTimeNotSimpleASH55EitherForABUPS = TotalAnyZoneTimeNotSimpleASH55Either;
+		//reset accumulation for new environment
+		for ( iZone = 1; iZone <= NumOfZones; ++iZone ) {
+			ThermalComfortInASH55( iZone ).totalTimeNotWinter = 0.0;
+			ThermalComfortInASH55( iZone ).totalTimeNotSummer = 0.0;
+			ThermalComfortInASH55( iZone ).totalTimeNotEither = 0.0;
+		}
+		TotalAnyZoneTimeNotSimpleASH55Winter = 0.0;
+		TotalAnyZoneTimeNotSimpleASH55Summer = 0.0;
+		TotalAnyZoneTimeNotSimpleASH55Either = 0.0;
+		// report how the aggregation is conducted
+		{ auto const SELECT_CASE_var( KindOfSim );
+		if ( SELECT_CASE_var == ksDesignDay ) {
+			addFootNoteSubTable( pdstSimpleComfort, "Aggregated over the Design Days" );
+		} else if ( SELECT_CASE_var == ksRunPeriodDesign ) {
+			addFootNoteSubTable( pdstSimpleComfort, "Aggregated over the RunPeriods for Design" );
+		} else if ( SELECT_CASE_var == ksRunPeriodWeather ) {
+			addFootNoteSubTable( pdstSimpleComfort, "Aggregated over the RunPeriods for Weather" );
+		}}
+		//report number of occupied hours per week for LEED report
+		for ( iZone = 1; iZone <= NumOfZones; ++iZone ) {
+			PreDefTableEntry( pdchLeedSutHrsWeek, Zone( iZone ).Name, 7 * 24 * ( ZoneOccHrs( iZone ) / ( NumOfDayInEnvrn * 24 ) ) );
 		}
 	}
 
@@ -2514,43 +2556,59 @@ namespace ThermalComfort {
 		TotalAnyZoneNotMetOccupied += AnyZoneNotMetOccupied;
 
 		//was EndEnvrnsFlag prior to CR7562
-		if ( EndDesignDayEnvrnsFlag ) {
-			for ( iZone = 1; iZone <= NumOfZones; ++iZone ) {
-				PreDefTableEntry( pdchULnotMetHeat, Zone( iZone ).Name, ThermalComfortSetPoint( iZone ).totalNotMetHeating );
-				PreDefTableEntry( pdchULnotMetCool, Zone( iZone ).Name, ThermalComfortSetPoint( iZone ).totalNotMetCooling );
-				PreDefTableEntry( pdchULnotMetHeatOcc, Zone( iZone ).Name, ThermalComfortSetPoint( iZone ).totalNotMetHeatingOccupied );
-				PreDefTableEntry( pdchULnotMetCoolOcc, Zone( iZone ).Name, ThermalComfortSetPoint( iZone ).totalNotMetCoolingOccupied );
-			}
-			PreDefTableEntry( pdchULnotMetHeat, "Facility", TotalAnyZoneNotMetHeating );
-			PreDefTableEntry( pdchULnotMetCool, "Facility", TotalAnyZoneNotMetCooling );
-			PreDefTableEntry( pdchULnotMetHeatOcc, "Facility", TotalAnyZoneNotMetHeatingOccupied );
-			PreDefTableEntry( pdchULnotMetCoolOcc, "Facility", TotalAnyZoneNotMetCoolingOccupied );
-			//set value for ABUPS report
-			TotalNotMetHeatingOccupiedForABUPS = TotalAnyZoneNotMetHeatingOccupied;
-			TotalNotMetCoolingOccupiedForABUPS = TotalAnyZoneNotMetCoolingOccupied;
-			TotalNotMetOccupiedForABUPS = TotalAnyZoneNotMetOccupied;
-			//reset counters
-			for ( iZone = 1; iZone <= NumOfZones; ++iZone ) {
-				ThermalComfortSetPoint( iZone ).totalNotMetHeating = 0.0;
-				ThermalComfortSetPoint( iZone ).totalNotMetCooling = 0.0;
-				ThermalComfortSetPoint( iZone ).totalNotMetHeatingOccupied = 0.0;
-				ThermalComfortSetPoint( iZone ).totalNotMetCoolingOccupied = 0.0;
-			}
-			TotalAnyZoneNotMetHeating = 0.0;
-			TotalAnyZoneNotMetCooling = 0.0;
-			TotalAnyZoneNotMetHeatingOccupied = 0.0;
-			TotalAnyZoneNotMetCoolingOccupied = 0.0;
-			TotalAnyZoneNotMetOccupied = 0.0;
-			// report how the aggregation is conducted
-			{ auto const SELECT_CASE_var( KindOfSim );
-			if ( SELECT_CASE_var == ksDesignDay ) {
-				addFootNoteSubTable( pdstUnmetLoads, "Aggregated over the Design Days" );
-			} else if ( SELECT_CASE_var == ksRunPeriodDesign ) {
-				addFootNoteSubTable( pdstUnmetLoads, "Aggregated over the RunPeriods for Design" );
-			} else if ( SELECT_CASE_var == ksRunPeriodWeather ) {
-				addFootNoteSubTable( pdstUnmetLoads, "Aggregated over the RunPeriods for Weather" );
-			}}
+		// a segment of a split run period reports once the gathering of the later segments is merged
+		if ( EndDesignDayEnvrnsFlag && ! ( DataSystemVariables::SegmentNum > 0 && KindOfSim == ksRunPeriodWeather ) ) {
+			ReportSetPointMet();
+		}
+	}
+
+	void
+	ReportSetPointMet()
+	{
+		// Reports the time the set points were not met at the end of the environments of a kind,
+		// and resets the accumulations.
+
+		// Using/Aliasing
+		using namespace OutputReportPredefined;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int iZone;
+
+		for ( iZone = 1; iZone <= NumOfZones; ++iZone ) {
+			PreDefTableEntry( pdchULnotMetHeat, Zone( iZone ).Name, ThermalComfortSetPoint( iZone ).totalNotMetHeating );
+			PreDefTableEntry( pdchULnotMetCool, Zone( iZone ).Name, ThermalComfortSetPoint( iZone ).totalNotMetCooling );
+			PreDefTableEntry( pdchULnotMetHeatOcc, Zone( iZone ).Name, ThermalComfortSetPoint( iZone ).totalNotMetHeatingOccupied );
+			PreDefTableEntry( pdchULnotMetCoolOcc, Zone( iZone ).Name, ThermalComfortSetPoint( iZone ).totalNotMetCoolingOccupied );
+		}
+		PreDefTableEntry( pdchULnotMetHeat, "Facility", TotalAnyZoneNotMetHeating );
+		PreDefTableEntry( pdchULnotMetCool, "Facility", TotalAnyZoneNotMetCooling );
+		PreDefTableEntry( pdchULnotMetHeatOcc, "Facility", TotalAnyZoneNotMetHeatingOccupied );
+		PreDefTableEntry( pdchULnotMetCoolOcc, "Facility", TotalAnyZoneNotMetCoolingOccupied );
+		//set value for ABUPS report
+		TotalNotMetHeatingOccupiedForABUPS = TotalAnyZoneNotMetHeatingOccupied;
+		TotalNotMetCoolingOccupiedForABUPS = TotalAnyZoneNotMetCoolingOccupied;
+		TotalNotMetOccupiedForABUPS = TotalAnyZoneNotMetOccupied;
+		//reset counters
+		for ( iZone = 1; iZone <= NumOfZones; ++iZone ) {
+			ThermalComfortSetPoint( iZone ).totalNotMetHeating = 0.0;
+			ThermalComfortSetPoint( iZone ).totalNotMetCooling = 0.0;
+			ThermalComfortSetPoint( iZone ).totalNotMetHeatingOccupied = 0.0;
+			ThermalComfortSetPoint( iZone ).totalNotMetCoolingOccupied = 0.0;
 		}
+		TotalAnyZoneNotMetHeating = 0.0;
+		TotalAnyZoneNotMetCooling = 0.0;
+		TotalAnyZoneNotMetHeatingOccupied = 0.0;
+		TotalAnyZoneNotMetCoolingOccupied = 0.0;
+		TotalAnyZoneNotMetOccupied = 0.0;
+		// report how the aggregation is conducted
+		{ auto const SELECT_CASE_var( KindOfSim );
+		if ( SELECT_CASE_var == ksDesignDay ) {
+			addFootNoteSubTable( pdstUnmetLoads, "Aggregated over the Design Days" );
+		} else if ( SELECT_CASE_var == ksRunPeriodDesign ) {
+			addFootNoteSubTable( pdstUnmetLoads, "Aggregated over the RunPeriods for Design" );
+		} else if ( SELECT_CASE_var == ksRunPeriodWeather ) {
+			addFootNoteSubTable( pdstUnmetLoads, "Aggregated over the RunPeriods for Weather" );
+		}}
 	}
 
 	void
@@ -2625,18 +2683,13 @@ namespace ThermalComfort {
 		std::string lineIn;
 		std::string lineAvg;
 		std::string epwLine;
-		static Real64 avgDryBulbASH( 0.0 );
 		Real64 dryBulb;
-		static Real64 runningAverageASH( 0.0 );
-		static Array1D< Real64 > monthlyTemp( 12, 0.0 );
 		Real64 tComf;
 		Real64 numOccupants;
 		int statFile;
 		int epwFile;
 		bool statFileExists;
 		bool epwFileExists;
-		static bool useStatData( false );
-		static bool useEpwData( false );
 		int readStat;
 		int jStartDay;
 		int calcStartDay;
@@ -2880,16 +2933,12 @@ namespace ThermalComfort {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		std::string epwLine;
-		static Real64 avgDryBulbCEN( 0.0 );
 		Real64 dryBulb;
 		Real64 tComf;
 		Real64 tComfLow;
-		static Real64 runningAverageCEN( 0.0 );
 		Real64 numOccupants;
 		int epwFile;
 		bool epwFileExists;
-		static bool useEpwData( false );
-		static bool firstDaySet( false ); // first day is set with initiate -- so do not update
 		int readStat;
 		int jStartDay;
 		int calcStartDay;
@@ -2987,7 +3036,7 @@ namespace ThermalComfort {
 				runningAverageCEN *= ( 1.0 - alpha );
 				avgDryBulbCEN = 0.0;
 				gio::close( epwFile );
-				useEpwData = true;
+				CalcThermalComfortAdaptiveCEN15251_useEpwData = true;
 				firstDaySet = true;
 			}
 		} else if ( initiate && ! weathersimulation ) {
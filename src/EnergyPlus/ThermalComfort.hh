@@ -373,12 +373,18 @@ namespace ThermalComfort {
 	void
 	CalcThermalComfortSimpleASH55();
 
+	void
+	ReportThermalComfortSimpleASH55();
+
 	void
 	ResetThermalComfortSimpleASH55();
 
 	void
 	CalcIfSetPointMet();
 
+	void
+	ReportSetPointMet();
+
 	void
 	ResetSetPointMet();
 
@@ -127,8 +127,203 @@ namespace ThermalISO15099Calc {
 	// Data
 	//private picard
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		Array1D< Real64 > thetas( maxlay2 );
+		Array1D< Real64 > Calc_ISO15099_rir( maxlay2 );
+		Array1D< Real64 > hcgass( maxlay1 );
+		Array1D< Real64 > hrgass( maxlay1 );
+		Array1D< Real64 > Calc_ISO15099_rs( maxlay3, 0.0 );
+		Array1D< Real64 > qs( maxlay3 );
+		Array1D< Real64 > qvs( maxlay1 );
+		Array1D< Real64 > LaminateAU( maxlay );
+		Array1D< Real64 > sumsolU( maxlay );
+		Array1D< Real64 > sol0( maxlay );
+		Array1D< Real64 > Calc_ISO15099_qcgas( maxlay1 );
+		Array1D< Real64 > qcgaps( maxlay1 );
+		Array1D< Real64 > Calc_ISO15099_qrgas( maxlay1 );
+		Array1D< Real64 > qrgaps( maxlay1 );
+		Array1D< Real64 > Atop_NOSD( maxlay );
+		Array1D< Real64 > Abot_NOSD( maxlay );
+		Array1D< Real64 > Al_NOSD( maxlay );
+		Array1D< Real64 > Ar_NOSD( maxlay );
+		Array1D< Real64 > Ah_NOSD( maxlay );
+		Array1D< Real64 > SlatThick_NOSD( maxlay );
+		Array1D< Real64 > SlatWidth_NOSD( maxlay );
+		Array1D< Real64 > SlatAngle_NOSD( maxlay );
+		Array1D< Real64 > SlatCond_NOSD( maxlay );
+		Array1D< Real64 > SlatSpacing_NOSD( maxlay );
+		Array1D< Real64 > SlatCurve_NOSD( maxlay );
+		Array1D< Real64 > vvent_NOSD( maxlay1 );
+		Array1D< Real64 > tvent_NOSD( maxlay1 );
+		Array1D< Real64 > qv_NOSD( maxlay1 );
+		Array1D< Real64 > q_NOSD( maxlay3 );
+		Array1D_int LayerType_NOSD( maxlay );
+		Array1D< Real64 > gap_NOSD( maxlay );
+		Array1D< Real64 > thick_NOSD( maxlay );
+		Array1D< Real64 > scon_NOSD( maxlay );
+		Array1D< Real64 > emis_NOSD( maxlay2 );
+		Array1D< Real64 > rir_NOSD( maxlay2 );
+		Array1D< Real64 > tir_NOSD( maxlay2 );
+		Array1D< Real64 > theta_NOSD( maxlay2 );
+		Array2D< Real64 > frct_NOSD( maxgas, maxlay1 );
+		Array2D_int iprop_NOSD( maxgas, maxlay1 );
+		Array1D_int nmix_NOSD( maxlay1 );
+		Array1D< Real64 > presure_NOSD( maxlay1 );
+		Array1D< Real64 > hcgas_NOSD( maxlay1 );
+		Array1D< Real64 > hrgas_NOSD( maxlay1 );
+		Array1D< Real64 > LaminateA_NOSD( maxlay );
+		Array1D< Real64 > LaminateB_NOSD( maxlay );
+		Array1D< Real64 > sumsol_NOSD( maxlay );
+		Array1D< Real64 > Ra_NOSD( maxlay );
+		Array1D< Real64 > Nu_NOSD( maxlay );
+		Array1D< Real64 > Calc_ISO15099Ebb( maxlay );
+		Array1D< Real64 > Calc_ISO15099Ebf( maxlay );
+		Array1D< Real64 > Calc_ISO15099Rb( maxlay );
+		Array1D< Real64 > Calc_ISO15099Rf( maxlay );
+		Array1D< Real64 > Ebbs( maxlay );
+		Array1D< Real64 > Ebfs( maxlay );
+		Array1D< Real64 > Rbs( maxlay );
+		Array1D< Real64 > Rfs( maxlay );
+		Array1D< Real64 > Ebb_NOSD( maxlay );
+		Array1D< Real64 > Ebf_NOSD( maxlay );
+		Array1D< Real64 > Rb_NOSD( maxlay );
+		Array1D< Real64 > Rf_NOSD( maxlay );
+		Array1D< Real64 > ShadeGapKeffConv_NOSD( MaxGap );
+		Array1D< Real64 > qcgas_NOSD( maxlay1 );
+		Array1D< Real64 > Keff_NOSD( maxlay1 );
+		Array1D< Real64 > qrgas_NOSD( maxlay1 );
+		Array1D_int nslice_NOSD( maxlay );
+		Array1D< Real64 > vfreevent_NOSD( maxlay1 );
+		Array1D< Real64 > Calc_ISO15099_vfreevent( maxlay1 );
+		Real64 Calc_ISO15099_rtot( 0.0 );
+		Real64 sft( 0.0 );
+		Real64 hcins( 0.0 );
+		Real64 hrins( 0.0 );
+		Real64 hins( 0.0 );
+		Real64 hcouts( 0.0 );
+		Real64 hrouts( 0.0 );
+		Real64 houts( 0.0 );
+		Real64 ufactors( 0.0 );
+		Real64 fluxs( 0.0 );
+		Real64 qeff( 0.0 );
+		Real64 flux_nonsolar( 0.0 );
+		Array1D< Real64 > therm1d_hgas( maxlay1 );
+		Array1D< Real64 > therm1dTgap( maxlay1 );
+		Array1D< Real64 > frcti( maxgas );
+		Array1D_int ipropi( maxgas );
+		Array1D< Real64 > frctg( maxgas );
+		Array1D_int ipropg( maxgas );
+		Real64 cpa( 0.0 );
+		Real64 aveGlassConductivity( 0.0 );
+		int i( 0 );
+		int k( 0 );
+		std::string dynFormat;
+	}
+
 	// Functions
 
+	// Clears the global data in ThermalISO15099Calc.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		thetas = Array1D< Real64 >( maxlay2 );
+		Calc_ISO15099_rir = Array1D< Real64 >( maxlay2 );
+		hcgass = Array1D< Real64 >( maxlay1 );
+		hrgass = Array1D< Real64 >( maxlay1 );
+		Calc_ISO15099_rs = Array1D< Real64 >( maxlay3, 0.0 );
+		qs = Array1D< Real64 >( maxlay3 );
+		qvs = Array1D< Real64 >( maxlay1 );
+		LaminateAU = Array1D< Real64 >( maxlay );
+		sumsolU = Array1D< Real64 >( maxlay );
+		sol0 = Array1D< Real64 >( maxlay );
+		Calc_ISO15099_qcgas = Array1D< Real64 >( maxlay1 );
+		qcgaps = Array1D< Real64 >( maxlay1 );
+		Calc_ISO15099_qrgas = Array1D< Real64 >( maxlay1 );
+		qrgaps = Array1D< Real64 >( maxlay1 );
+		Atop_NOSD = Array1D< Real64 >( maxlay );
+		Abot_NOSD = Array1D< Real64 >( maxlay );
+		Al_NOSD = Array1D< Real64 >( maxlay );
+		Ar_NOSD = Array1D< Real64 >( maxlay );
+		Ah_NOSD = Array1D< Real64 >( maxlay );
+		SlatThick_NOSD = Array1D< Real64 >( maxlay );
+		SlatWidth_NOSD = Array1D< Real64 >( maxlay );
+		SlatAngle_NOSD = Array1D< Real64 >( maxlay );
+		SlatCond_NOSD = Array1D< Real64 >( maxlay );
+		SlatSpacing_NOSD = Array1D< Real64 >( maxlay );
+		SlatCurve_NOSD = Array1D< Real64 >( maxlay );
+		vvent_NOSD = Array1D< Real64 >( maxlay1 );
+		tvent_NOSD = Array1D< Real64 >( maxlay1 );
+		qv_NOSD = Array1D< Real64 >( maxlay1 );
+		q_NOSD = Array1D< Real64 >( maxlay3 );
+		LayerType_NOSD = Array1D_int( maxlay );
+		gap_NOSD = Array1D< Real64 >( maxlay );
+		thick_NOSD = Array1D< Real64 >( maxlay );
+		scon_NOSD = Array1D< Real64 >( maxlay );
+		emis_NOSD = Array1D< Real64 >( maxlay2 );
+		rir_NOSD = Array1D< Real64 >( maxlay2 );
+		tir_NOSD = Array1D< Real64 >( maxlay2 );
+		theta_NOSD = Array1D< Real64 >( maxlay2 );
+		frct_NOSD = Array2D< Real64 >( maxgas, maxlay1 );
+		iprop_NOSD = Array2D_int( maxgas, maxlay1 );
+		nmix_NOSD = Array1D_int( maxlay1 );
+		presure_NOSD = Array1D< Real64 >( maxlay1 );
+		hcgas_NOSD = Array1D< Real64 >( maxlay1 );
+		hrgas_NOSD = Array1D< Real64 >( maxlay1 );
+		LaminateA_NOSD = Array1D< Real64 >( maxlay );
+		LaminateB_NOSD = Array1D< Real64 >( maxlay );
+		sumsol_NOSD = Array1D< Real64 >( maxlay );
+		Ra_NOSD = Array1D< Real64 >( maxlay );
+		Nu_NOSD = Array1D< Real64 >( maxlay );
+		Calc_ISO15099Ebb = Array1D< Real64 >( maxlay );
+		Calc_ISO15099Ebf = Array1D< Real64 >( maxlay );
+		Calc_ISO15099Rb = Array1D< Real64 >( maxlay );
+		Calc_ISO15099Rf = Array1D< Real64 >( maxlay );
+		Ebbs = Array1D< Real64 >( maxlay );
+		Ebfs = Array1D< Real64 >( maxlay );
+		Rbs = Array1D< Real64 >( maxlay );
+		Rfs = Array1D< Real64 >( maxlay );
+		Ebb_NOSD = Array1D< Real64 >( maxlay );
+		Ebf_NOSD = Array1D< Real64 >( maxlay );
+		Rb_NOSD = Array1D< Real64 >( maxlay );
+		Rf_NOSD = Array1D< Real64 >( maxlay );
+		ShadeGapKeffConv_NOSD = Array1D< Real64 >( MaxGap );
+		qcgas_NOSD = Array1D< Real64 >( maxlay1 );
+		Keff_NOSD = Array1D< Real64 >( maxlay1 );
+		qrgas_NOSD = Array1D< Real64 >( maxlay1 );
+		nslice_NOSD = Array1D_int( maxlay );
+		vfreevent_NOSD = Array1D< Real64 >( maxlay1 );
+		Calc_ISO15099_vfreevent = Array1D< Real64 >( maxlay1 );
+		Calc_ISO15099_rtot = 0.0;
+		sft = 0.0;
+		hcins = 0.0;
+		hrins = 0.0;
+		hins = 0.0;
+		hcouts = 0.0;
+		hrouts = 0.0;
+		houts = 0.0;
+		ufactors = 0.0;
+		fluxs = 0.0;
+		qeff = 0.0;
+		flux_nonsolar = 0.0;
+		therm1d_hgas = Array1D< Real64 >( maxlay1 );
+		therm1dTgap = Array1D< Real64 >( maxlay1 );
+		frcti = Array1D< Real64 >( maxgas );
+		ipropi = Array1D_int( maxgas );
+		frctg = Array1D< Real64 >( maxgas );
+		ipropg = Array1D_int( maxgas );
+		cpa = 0.0;
+		aveGlassConductivity = 0.0;
+		i = 0;
+		k = 0;
+		dynFormat.clear();
+	}
+
 	void
 	film(
 		Real64 const tex,
@@ -382,18 +577,8 @@ namespace ThermalISO15099Calc {
 
 		// Variables
 
-		static Array1D< Real64 > thetas( maxlay2 );
-		static Array1D< Real64 > rir( maxlay2 );
-		static Array1D< Real64 > hcgass( maxlay1 );
-		static Array1D< Real64 > hrgass( maxlay1 );
-		static Array1D< Real64 > rs( maxlay3, 0.0 );
 
 		//  REAL(r64) :: grho(maxgas,3)
-		static Array1D< Real64 > qs( maxlay3 );
-		static Array1D< Real64 > qvs( maxlay1 );
-		static Array1D< Real64 > LaminateAU( maxlay );
-		static Array1D< Real64 > sumsolU( maxlay );
-		static Array1D< Real64 > sol0( maxlay );
 		Real64 shgct_NOSD;
 		Real64 trmout;
 
@@ -408,10 +593,6 @@ namespace ThermalISO15099Calc {
 		Real64 qc1;
 		Real64 qc2;
 		Real64 qcgg;
-		static Array1D< Real64 > qcgas( maxlay1 );
-		static Array1D< Real64 > qcgaps( maxlay1 );
-		static Array1D< Real64 > qrgas( maxlay1 );
-		static Array1D< Real64 > qrgaps( maxlay1 );
 
 		Real64 ShadeHcModifiedOut;
 		Real64 ShadeHcModifiedIn;
@@ -424,21 +605,6 @@ namespace ThermalISO15099Calc {
 		int nlayer_NOSD;
 		Real64 AchievedErrorTolerance_NOSD;
 		int NumOfIter_NOSD;
-		static Array1D< Real64 > Atop_NOSD( maxlay );
-		static Array1D< Real64 > Abot_NOSD( maxlay );
-		static Array1D< Real64 > Al_NOSD( maxlay );
-		static Array1D< Real64 > Ar_NOSD( maxlay );
-		static Array1D< Real64 > Ah_NOSD( maxlay );
-		static Array1D< Real64 > SlatThick_NOSD( maxlay );
-		static Array1D< Real64 > SlatWidth_NOSD( maxlay );
-		static Array1D< Real64 > SlatAngle_NOSD( maxlay );
-		static Array1D< Real64 > SlatCond_NOSD( maxlay );
-		static Array1D< Real64 > SlatSpacing_NOSD( maxlay );
-		static Array1D< Real64 > SlatCurve_NOSD( maxlay );
-		static Array1D< Real64 > vvent_NOSD( maxlay1 );
-		static Array1D< Real64 > tvent_NOSD( maxlay1 );
-		static Array1D< Real64 > qv_NOSD( maxlay1 );
-		static Array1D< Real64 > q_NOSD( maxlay3 );
 		Real64 hin_NOSD;
 		Real64 flux_NOSD;
 		Real64 hcin_NOSD;
@@ -447,61 +613,23 @@ namespace ThermalISO15099Calc {
 		Real64 hrout_NOSD;
 		Real64 tamb_NOSD;
 		Real64 troom_NOSD;
-		static Array1D_int LayerType_NOSD( maxlay );
 		Real64 ufactor_NOSD;
 		Real64 sc_NOSD;
 		Real64 hflux_NOSD;
 		Real64 shgc_NOSD;
 		Real64 hout_NOSD;
-		static Array1D< Real64 > gap_NOSD( maxlay );
-		static Array1D< Real64 > thick_NOSD( maxlay );
-		static Array1D< Real64 > scon_NOSD( maxlay );
-		static Array1D< Real64 > emis_NOSD( maxlay2 );
-		static Array1D< Real64 > rir_NOSD( maxlay2 );
-		static Array1D< Real64 > tir_NOSD( maxlay2 );
-		static Array1D< Real64 > theta_NOSD( maxlay2 );
-		static Array2D< Real64 > frct_NOSD( maxgas, maxlay1 );
-		static Array2D_int iprop_NOSD( maxgas, maxlay1 );
-		static Array1D_int nmix_NOSD( maxlay1 );
-		static Array1D< Real64 > presure_NOSD( maxlay1 );
-		static Array1D< Real64 > hcgas_NOSD( maxlay1 );
-		static Array1D< Real64 > hrgas_NOSD( maxlay1 );
 		//REAL(r64) ::  rs_NOSD(maxlay3)!,sol(maxlay)
-		static Array1D< Real64 > LaminateA_NOSD( maxlay );
-		static Array1D< Real64 > LaminateB_NOSD( maxlay );
-		static Array1D< Real64 > sumsol_NOSD( maxlay );
-		static Array1D< Real64 > Ra_NOSD( maxlay );
-		static Array1D< Real64 > Nu_NOSD( maxlay );
 		Real64 ShadeEmisRatioOut_NOSD;
 		Real64 ShadeEmisRatioIn_NOSD;
 		Real64 ShadeHcRatioOut_NOSD;
 		Real64 ShadeHcRatioIn_NOSD;
 		Real64 ShadeHcModifiedOut_NOSD;
 		Real64 ShadeHcModifiedIn_NOSD;
-		static Array1D< Real64 > Ebb( maxlay );
-		static Array1D< Real64 > Ebf( maxlay );
-		static Array1D< Real64 > Rb( maxlay );
-		static Array1D< Real64 > Rf( maxlay );
-		static Array1D< Real64 > Ebbs( maxlay );
-		static Array1D< Real64 > Ebfs( maxlay );
-		static Array1D< Real64 > Rbs( maxlay );
-		static Array1D< Real64 > Rfs( maxlay );
-		static Array1D< Real64 > Ebb_NOSD( maxlay );
-		static Array1D< Real64 > Ebf_NOSD( maxlay );
-		static Array1D< Real64 > Rb_NOSD( maxlay );
-		static Array1D< Real64 > Rf_NOSD( maxlay );
-
-		static Array1D< Real64 > ShadeGapKeffConv_NOSD( MaxGap );
-		static Array1D< Real64 > qcgas_NOSD( maxlay1 );
-		static Array1D< Real64 > Keff_NOSD( maxlay1 );
-		static Array1D< Real64 > qrgas_NOSD( maxlay1 );
-		static Array1D_int nslice_NOSD( maxlay );
-		static Array1D< Real64 > vfreevent_NOSD( maxlay1 );
+
 
 		int FirstSpecularLayer;
 		int LastSpecularLayer;
 
-		static Array1D< Real64 > vfreevent( maxlay1 );
 
 		//cbi...Other variables:
 		Real64 flux;
@@ -513,18 +641,6 @@ namespace ThermalISO15099Calc {
 		int j;
 		int OriginalIndex;
 		int UnshadedDebug;
-		static Real64 rtot( 0.0 );
-		static Real64 sft( 0.0 );
-		static Real64 hcins( 0.0 );
-		static Real64 hrins( 0.0 );
-		static Real64 hins( 0.0 );
-		static Real64 hcouts( 0.0 );
-		static Real64 hrouts( 0.0 );
-		static Real64 houts( 0.0 );
-		static Real64 ufactors( 0.0 );
-		static Real64 fluxs( 0.0 );
-		static Real64 qeff( 0.0 );
-		static Real64 flux_nonsolar( 0.0 );
 		static gio::Fmt fmtLD( "*" );
 
 		//Autodesk:Uninit Initialize variables used uninitialized
@@ -538,7 +654,7 @@ namespace ThermalISO15099Calc {
 		AchievedErrorToleranceSolar = 0.0;
 		AchievedErrorTolerance_NOSD = 0.0;
 
-		PrepVariablesISO15099( nlayer, tout, tind, trmin, isky, outir, tsky, esky, fclr, gap, thick, scon, tir, emis, tilt, hin, hout, ibc, SlatThick, SlatWidth, SlatAngle, SlatCond, LayerType, ThermalMod, SDScalar, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcRatioOut, ShadeHcRatioIn, Keff, ShadeGapKeffConv, sc, shgc, ufactor, flux, LaminateAU, sumsolU, sol0, hint, houtt, trmout, ebsky, ebroom, Gout, Gin, rir, vfreevent, nperr, ErrorMessage );
+		PrepVariablesISO15099( nlayer, tout, tind, trmin, isky, outir, tsky, esky, fclr, gap, thick, scon, tir, emis, tilt, hin, hout, ibc, SlatThick, SlatWidth, SlatAngle, SlatCond, LayerType, ThermalMod, SDScalar, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcRatioOut, ShadeHcRatioIn, Keff, ShadeGapKeffConv, sc, shgc, ufactor, flux, LaminateAU, sumsolU, sol0, hint, houtt, trmout, ebsky, ebroom, Gout, Gin, Calc_ISO15099_rir, Calc_ISO15099_vfreevent, nperr, ErrorMessage );
 
 		//No option to take hardcoded variables.  All gas coefficients are now passed from outside.
 		//if (GoAhead(nperr)) call propcon90(ISO15099,mgas,xgcon,xgvis,xgcp,xgrho,xwght,nperr)
@@ -559,7 +675,7 @@ namespace ThermalISO15099Calc {
 		if ( ( dir > 0.0 ) || ( SHGCCalc == 0 ) ) {
 			// call therm1d to calculate heat flux with solar radiation
 
-			therm1d( nlayer, iwd, tout, tind, wso, wsi, VacuumPressure, VacuumMaxGapThickness, dir, ebsky, Gout, trmout, trmin, ebroom, Gin, tir, rir, emis, gap, thick, scon, tilt, asol, height, heightt, width, iprop, frct, presure, nmix, xwght, xgcon, xgvis, xgcp, gama, SupportPillar, PillarSpacing, PillarRadius, theta, q, qv, flux, hcin, hrin, hcout, hrout, hin, hout, hcgas, hrgas, ufactor, nperr, ErrorMessage, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, vvent, tvent, LayerType, Ra, Nu, vfreevent, qcgas, qrgas, Ebf, Ebb, Rf, Rb, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcModifiedOut, ShadeHcModifiedIn, ThermalMod, Debug_mode, AchievedErrorToleranceSolar, NumOfIterSolar );
+			therm1d( nlayer, iwd, tout, tind, wso, wsi, VacuumPressure, VacuumMaxGapThickness, dir, ebsky, Gout, trmout, trmin, ebroom, Gin, tir, Calc_ISO15099_rir, emis, gap, thick, scon, tilt, asol, height, heightt, width, iprop, frct, presure, nmix, xwght, xgcon, xgvis, xgcp, gama, SupportPillar, PillarSpacing, PillarRadius, theta, q, qv, flux, hcin, hrin, hcout, hrout, hin, hout, hcgas, hrgas, ufactor, nperr, ErrorMessage, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, vvent, tvent, LayerType, Ra, Nu, Calc_ISO15099_vfreevent, Calc_ISO15099_qcgas, Calc_ISO15099_qrgas, Calc_ISO15099Ebf, Calc_ISO15099Ebb, Calc_ISO15099Rf, Calc_ISO15099Rb, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcModifiedOut, ShadeHcModifiedIn, ThermalMod, Debug_mode, AchievedErrorToleranceSolar, NumOfIterSolar );
 
 			NumOfIterations = NumOfIterSolar;
 			//exit on error:
@@ -580,7 +696,7 @@ namespace ThermalISO15099Calc {
 
 			//No need to store results in case of non-ufactor run
 			if ( ( SHGCCalc > 0 ) && ( dir > 0.0 ) ) {
-				solarISO15099( totsol, rtot, rs, nlayer, asol, sft );
+				solarISO15099( totsol, Calc_ISO15099_rtot, Calc_ISO15099_rs, nlayer, asol, sft );
 				shgct = sft;
 				shgct_NOSD = 0.0;
 				hcins = hcin;
@@ -594,10 +710,10 @@ namespace ThermalISO15099Calc {
 				for ( i = 1; i <= nlayer; ++i ) {
 					thetas( 2 * i - 1 ) = theta( 2 * i - 1 );
 					thetas( 2 * i ) = theta( 2 * i );
-					Ebbs( i ) = Ebb( i );
-					Ebfs( i ) = Ebf( i );
-					Rbs( i ) = Rb( i );
-					Rfs( i ) = Rf( i );
+					Ebbs( i ) = Calc_ISO15099Ebb( i );
+					Ebfs( i ) = Calc_ISO15099Ebf( i );
+					Rbs( i ) = Calc_ISO15099Rb( i );
+					Rfs( i ) = Calc_ISO15099Rf( i );
 					qs( 2 * i - 1 ) = q( 2 * i - 1 );
 					qs( 2 * i ) = q( 2 * i );
 					//qprims(2*i - 1) = qprim(2*i - 1)
@@ -606,8 +722,8 @@ namespace ThermalISO15099Calc {
 					qvs( 2 * i ) = qv( 2 * i );
 					hcgass( i ) = hcgas( i );
 					hrgass( i ) = hrgas( i );
-					qrgaps( i ) = qrgas( i );
-					qcgaps( i ) = qcgas( i );
+					qrgaps( i ) = Calc_ISO15099_qrgas( i );
+					qcgaps( i ) = Calc_ISO15099_qcgas( i );
 				}
 				//    CHECK THIS!
 				qs( 2 * nlayer + 1 ) = q( 2 * nlayer + 1 );
@@ -627,7 +743,7 @@ namespace ThermalISO15099Calc {
 			hout = houtt;
 
 			// call therm1d to calculate heat flux without solar radiation
-			therm1d( nlayer, iwd, tout, tind, wso, wsi, VacuumPressure, VacuumMaxGapThickness, 0.0, ebsky, Gout, trmout, trmin, ebroom, Gin, tir, rir, emis, gap, thick, scon, tilt, sol0, height, heightt, width, iprop, frct, presure, nmix, xwght, xgcon, xgvis, xgcp, gama, SupportPillar, PillarSpacing, PillarRadius, theta, q, qv, flux, hcin, hrin, hcout, hrout, hin, hout, hcgas, hrgas, ufactor, nperr, ErrorMessage, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, vvent, tvent, LayerType, Ra, Nu, vfreevent, qcgas, qrgas, Ebf, Ebb, Rf, Rb, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcModifiedOut, ShadeHcModifiedIn, ThermalMod, Debug_mode, AchievedErrorTolerance, NumOfIter );
+			therm1d( nlayer, iwd, tout, tind, wso, wsi, VacuumPressure, VacuumMaxGapThickness, 0.0, ebsky, Gout, trmout, trmin, ebroom, Gin, tir, Calc_ISO15099_rir, emis, gap, thick, scon, tilt, sol0, height, heightt, width, iprop, frct, presure, nmix, xwght, xgcon, xgvis, xgcp, gama, SupportPillar, PillarSpacing, PillarRadius, theta, q, qv, flux, hcin, hrin, hcout, hrout, hin, hout, hcgas, hrgas, ufactor, nperr, ErrorMessage, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, vvent, tvent, LayerType, Ra, Nu, Calc_ISO15099_vfreevent, Calc_ISO15099_qcgas, Calc_ISO15099_qrgas, Calc_ISO15099Ebf, Calc_ISO15099Ebb, Calc_ISO15099Rf, Calc_ISO15099Rb, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcModifiedOut, ShadeHcModifiedIn, ThermalMod, Debug_mode, AchievedErrorTolerance, NumOfIter );
 
 			NumOfIterations = NumOfIter;
 
@@ -700,8 +816,8 @@ namespace ThermalISO15099Calc {
 					tir_NOSD( 2 * i - 1 ) = tir( 2 * OriginalIndex - 1 );
 					emis_NOSD( 2 * i - 1 ) = emis( 2 * OriginalIndex - 1 );
 					emis_NOSD( 2 * i ) = emis( 2 * OriginalIndex );
-					rir_NOSD( 2 * i - 1 ) = rir( 2 * OriginalIndex - 1 );
-					rir_NOSD( 2 * i ) = rir( 2 * OriginalIndex );
+					rir_NOSD( 2 * i - 1 ) = Calc_ISO15099_rir( 2 * OriginalIndex - 1 );
+					rir_NOSD( 2 * i ) = Calc_ISO15099_rir( 2 * OriginalIndex );
 
 					gap_NOSD( i ) = gap( OriginalIndex );
 
@@ -782,8 +898,8 @@ namespace ThermalISO15099Calc {
 						//Keff(i)   = gap(i)   * qprim(2*i+1) / (theta(2*i+1) - theta(2*i))
 						if ( ( i > 1 ) && ( i < nlayer ) ) {
 							tgg = gap( i - 1 ) + gap( i ) + thick( i );
-							qc1 = qcgas( i - 1 );
-							qc2 = qcgas( i );
+							qc1 = Calc_ISO15099_qcgas( i - 1 );
+							qc2 = Calc_ISO15099_qcgas( i );
 							qcgg = ( qc1 + qc2 ) / 2.0;
 							ShadeGapKeffConv( i ) = tgg * qcgg / ( theta( 2 * i + 1 ) - theta( 2 * i - 2 ) );
 						}
@@ -810,10 +926,10 @@ namespace ThermalISO15099Calc {
 			for ( i = 1; i <= nlayer; ++i ) {
 				theta( 2 * i - 1 ) = thetas( 2 * i - 1 );
 				theta( 2 * i ) = thetas( 2 * i );
-				Ebb( i ) = Ebbs( i );
-				Ebf( i ) = Ebfs( i );
-				Rb( i ) = Rbs( i );
-				Rf( i ) = Rfs( i );
+				Calc_ISO15099Ebb( i ) = Ebbs( i );
+				Calc_ISO15099Ebf( i ) = Ebfs( i );
+				Calc_ISO15099Rb( i ) = Rbs( i );
+				Calc_ISO15099Rf( i ) = Rfs( i );
 				q( 2 * i - 1 ) = qs( 2 * i - 1 );
 				q( 2 * i ) = qs( 2 * i );
 				//qprim(2*i - 1) = qprims(2*i - 1)
@@ -822,8 +938,8 @@ namespace ThermalISO15099Calc {
 				qv( 2 * i ) = qvs( 2 * i );
 				hcgas( i ) = hcgass( i );
 				hrgas( i ) = hrgass( i );
-				qcgas( i ) = qcgaps( i );
-				qrgas( i ) = qrgaps( i );
+				Calc_ISO15099_qcgas( i ) = qcgaps( i );
+				Calc_ISO15099_qrgas( i ) = qrgaps( i );
 				AchievedErrorTolerance = AchievedErrorToleranceSolar;
 				NumOfIter = NumOfIterSolar;
 			}
@@ -836,7 +952,7 @@ namespace ThermalISO15099Calc {
 
 		//bi...  Write results to debug output file:
 		if ( WriteDebugOutput ) {
-			WriteOutputArguments( OutArgumentsFile, DBGD, nlayer, tamb, q, qv, qcgas, qrgas, theta, vfreevent, vvent, Keff, ShadeGapKeffConv, troom, ufactor, shgc, sc, hflux, shgct, hcin, hrin, hcout, hrout, Ra, Nu, LayerType, Ebf, Ebb, Rf, Rb, ebsky, Gout, ebroom, Gin, ShadeEmisRatioIn, ShadeEmisRatioOut, ShadeHcRatioIn, ShadeHcRatioOut, HcUnshadedIn, HcUnshadedOut, hcgas, hrgas, AchievedErrorTolerance, NumOfIter );
+			WriteOutputArguments( OutArgumentsFile, DBGD, nlayer, tamb, q, qv, Calc_ISO15099_qcgas, Calc_ISO15099_qrgas, theta, Calc_ISO15099_vfreevent, vvent, Keff, ShadeGapKeffConv, troom, ufactor, shgc, sc, hflux, shgct, hcin, hrin, hcout, hrout, Ra, Nu, LayerType, Calc_ISO15099Ebf, Calc_ISO15099Ebb, Calc_ISO15099Rf, Calc_ISO15099Rb, ebsky, Gout, ebroom, Gin, ShadeEmisRatioIn, ShadeEmisRatioOut, ShadeHcRatioIn, ShadeHcRatioOut, HcUnshadedIn, HcUnshadedOut, hcgas, hrgas, AchievedErrorTolerance, NumOfIter );
 		} // if WriteDebugOutput.eq.true - writing output file
 
 	}
@@ -1000,9 +1116,7 @@ namespace ThermalISO15099Calc {
 
 		Array2D< Real64 > a( 4*nlayer, 4*nlayer );
 		Array1D< Real64 > b( 4*nlayer );
-		static Array1D< Real64 > hgas( maxlay1 );
 		//REAL(r64) :: hhatv(maxlay3),hcv(maxlay3), Ebgap(maxlay3), Tgap(maxlay1)
-		static Array1D< Real64 > Tgap( maxlay1 );
 
 		//REAL(r64) ::  alpha
 		int maxiter;
@@ -1130,10 +1244,10 @@ namespace ThermalISO15099Calc {
 			storeIterationResults( nlayer, index, theta, trmout, tamb, trmin, troom, ebsky, ebroom, hcin, hcout, hrin, hrout, hin, hout, Ebb, Ebf, Rb, Rf, nperr );
 		}
 
-		Tgap( 1 ) = tout;
-		Tgap( nlayer + 1 ) = tind;
+		therm1dTgap( 1 ) = tout;
+		therm1dTgap( nlayer + 1 ) = tind;
 		for ( i = 2; i <= nlayer; ++i ) {
-			Tgap( i ) = ( theta( 2 * i - 1 ) + theta( 2 * i - 2 ) ) / 2;
+			therm1dTgap( i ) = ( theta( 2 * i - 1 ) + theta( 2 * i - 2 ) ) / 2;
 		}
 		//!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 		//!!! MAIN ITERATION LOOP
@@ -1164,12 +1278,12 @@ namespace ThermalISO15099Calc {
 					updateGapTemperature = true;
 				}
 				if ( updateGapTemperature ) {
-					Tgap( i ) = ( theta( 2 * i - 1 ) + theta( 2 * i - 2 ) ) / 2;
+					therm1dTgap( i ) = ( theta( 2 * i - 1 ) + theta( 2 * i - 2 ) ) / 2;
 				}
 			}
 
 			// evaluate convective/conductive components of gap
-			hatter( nlayer, iwd, tout, tind, wso, wsi, VacuumPressure, VacuumMaxGapThickness, ebsky, tamb, ebroom, troom, gap, height, heightt, scon, tilt, theta, Tgap, Radiation, trmout, trmin, iprop, frct, presure, nmix, wght, gcon, gvis, gcp, gama, SupportPillar, PillarSpacing, PillarRadius, hgas, hcgas, hrgas, hcin, hcout, hin, hout, index, ibc, nperr, ErrorMessage, hrin, hrout, Ra, Nu );
+			hatter( nlayer, iwd, tout, tind, wso, wsi, VacuumPressure, VacuumMaxGapThickness, ebsky, tamb, ebroom, troom, gap, height, heightt, scon, tilt, theta, therm1dTgap, Radiation, trmout, trmin, iprop, frct, presure, nmix, wght, gcon, gvis, gcp, gama, SupportPillar, PillarSpacing, PillarRadius, therm1d_hgas, hcgas, hrgas, hcin, hcout, hin, hout, index, ibc, nperr, ErrorMessage, hrin, hrout, Ra, Nu );
 
 			// exit on error
 			if ( ! ( GoAhead( nperr ) ) ) return;
@@ -1189,7 +1303,7 @@ namespace ThermalISO15099Calc {
 				matrixQBalance( nlayer, a, b, scon, thick, hcgas, hcout, hcin, asol, qv, tind, tout, Gin, Gout, theta, tir, rir, emis );
 			} else {
 				//bi...There are no Venetian layers, or ThermalMod is not CSM, so carry on as usual:
-				shading( theta, gap, hgas, hcgas, hrgas, frct, iprop, presure, nmix, wght, gcon, gvis, gcp, nlayer, width, height, tilt, tout, tind, Atop, Abot, Al, Ar, Ah, vvent, tvent, LayerType, Tgap, qv, nperr, ErrorMessage, vfreevent );
+				shading( theta, gap, therm1d_hgas, hcgas, hrgas, frct, iprop, presure, nmix, wght, gcon, gvis, gcp, nlayer, width, height, tilt, tout, tind, Atop, Abot, Al, Ar, Ah, vvent, tvent, LayerType, therm1dTgap, qv, nperr, ErrorMessage, vfreevent );
 
 				// exit on error
 				if ( ! ( GoAhead( nperr ) ) ) return;
@@ -1300,11 +1414,11 @@ namespace ThermalISO15099Calc {
 				j = 2 * ( i - 1 );
 				if ( updateGapTemperature ) {
 					if ( i == 1 ) {
-						Tgap( 1 ) = tout;
+						therm1dTgap( 1 ) = tout;
 					} else if ( i == ( nlayer + 1 ) ) {
-						Tgap( i ) = tind;
+						therm1dTgap( i ) = tind;
 					} else {
-						Tgap( i ) = ( theta( j ) + theta( j + 1 ) ) / 2;
+						therm1dTgap( i ) = ( theta( j ) + theta( j + 1 ) ) / 2;
 					}
 				}
 			}
@@ -1389,14 +1503,14 @@ namespace ThermalISO15099Calc {
 				}
 
 				if ( updateGapTemperature ) {
-					Tgap( i ) = ( theta( 2 * i - 1 ) + theta( 2 * i - 2 ) ) / 2;
+					therm1dTgap( i ) = ( theta( 2 * i - 1 ) + theta( 2 * i - 2 ) ) / 2;
 				}
 			}
 
 			// Simon: It is important to recalculate coefficients from most accurate run
-			hatter( nlayer, iwd, tout, tind, wso, wsi, VacuumPressure, VacuumMaxGapThickness, ebsky, tamb, ebroom, troom, gap, height, heightt, scon, tilt, theta, Tgap, Radiation, trmout, trmin, iprop, frct, presure, nmix, wght, gcon, gvis, gcp, gama, SupportPillar, PillarSpacing, PillarRadius, hgas, hcgas, hrgas, hcin, hcout, hin, hout, index, ibc, nperr, ErrorMessage, hrin, hrout, Ra, Nu );
+			hatter( nlayer, iwd, tout, tind, wso, wsi, VacuumPressure, VacuumMaxGapThickness, ebsky, tamb, ebroom, troom, gap, height, heightt, scon, tilt, theta, therm1dTgap, Radiation, trmout, trmin, iprop, frct, presure, nmix, wght, gcon, gvis, gcp, gama, SupportPillar, PillarSpacing, PillarRadius, therm1d_hgas, hcgas, hrgas, hcin, hcout, hin, hout, index, ibc, nperr, ErrorMessage, hrin, hrout, Ra, Nu );
 
-			shading( theta, gap, hgas, hcgas, hrgas, frct, iprop, presure, nmix, wght, gcon, gvis, gcp, nlayer, width, height, tilt, tout, tind, Atop, Abot, Al, Ar, Ah, vvent, tvent, LayerType, Tgap, qv, nperr, ErrorMessage, vfreevent );
+			shading( theta, gap, therm1d_hgas, hcgas, hrgas, frct, iprop, presure, nmix, wght, gcon, gvis, gcp, nlayer, width, height, tilt, tout, tind, Atop, Abot, Al, Ar, Ah, vvent, tvent, LayerType, therm1dTgap, qv, nperr, ErrorMessage, vfreevent );
 		}
 
 		if ( CalcOutcome == CALC_UNKNOWN ) {
@@ -2013,9 +2127,7 @@ namespace ThermalISO15099Calc {
 		gcp.dim( 3, maxgas );
 
 		// Locals
-		static Array1D< Real64 > frcti( maxgas );
 		int j;
-		static Array1D_int ipropi( maxgas );
 		Real64 tiltr;
 		Real64 tmean;
 		Real64 delt;
@@ -2168,8 +2280,6 @@ namespace ThermalISO15099Calc {
 		Real64 ra;
 		Real64 asp;
 		Real64 gnu;
-		static Array1D< Real64 > frctg( maxgas );
-		static Array1D_int ipropg( maxgas );
 		int i;
 		int j;
 		int k;
@@ -2253,10 +2363,6 @@ namespace ThermalISO15099Calc {
 		//   0 - does not have support pillar
 		//   1 - have support pillar
 
-		static Real64 cpa( 0.0 );
-		static Real64 aveGlassConductivity( 0.0 );
-		static int i( 0 );
-		static int k( 0 );
 
 		for ( i = 1; i <= nlayer - 1; ++i ) {
 			k = 2 * i + 1;
@@ -2665,7 +2771,6 @@ namespace ThermalISO15099Calc {
 		//character(len=*), intent(inout) :: ErrorMessage
 
 		//localy used
-		static std::string dynFormat;
 		std::string a;
 		int i;
 
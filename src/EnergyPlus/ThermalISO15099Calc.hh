@@ -75,6 +75,11 @@ namespace ThermalISO15099Calc {
 
 	// Functions
 
+	// Clears the global data in ThermalISO15099Calc.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	film(
 		Real64 const tex,
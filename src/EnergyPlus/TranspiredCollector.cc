@@ -151,8 +151,37 @@ namespace TranspiredCollector {
 	// Object Data
 	Array1D< UTSCDataStruct > UTSC;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int SimTranspiredCollectorUTSCNum( 0 ); // local number index for UTSC
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool MyOneTimeFlag( true );
+		bool MySetPointCheckFlag( true );
+		Array1D_bool MyEnvrnFlag;
+	}
+
 	// Functions
 
+	// Clears the global data in TranspiredCollector.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumUTSC = 0;
+		CheckEquipName.deallocate();
+		GetInputFlag = true;
+		UTSC.deallocate();
+		SimTranspiredCollectorUTSCNum = 0;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		MySetPointCheckFlag = true;
+		MyEnvrnFlag.deallocate();
+	}
+
 	void
 	SimTranspiredCollector(
 		std::string const & CompName, // component name
@@ -196,7 +225,6 @@ namespace TranspiredCollector {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static int UTSCNum( 0 ); // local number index for UTSC
 
 		if ( GetInputFlag ) {
 			GetTranspiredCollectorInput();
@@ -205,21 +233,21 @@ namespace TranspiredCollector {
 
 		// Find the correct transpired collector with the Component name and/or index
 		if ( CompIndex == 0 ) {
-			UTSCNum = FindItemInList( CompName, UTSC );
-			if ( UTSCNum == 0 ) {
+			SimTranspiredCollectorUTSCNum = FindItemInList( CompName, UTSC );
+			if ( SimTranspiredCollectorUTSCNum == 0 ) {
 				ShowFatalError( "Transpired Collector not found=" + CompName );
 			}
-			CompIndex = UTSCNum;
+			CompIndex = SimTranspiredCollectorUTSCNum;
 		} else {
-			UTSCNum = CompIndex;
-			if ( UTSCNum > NumUTSC || UTSCNum < 1 ) {
-				ShowFatalError( "SimTranspiredCollector: Invalid CompIndex passed=" + TrimSigDigits( UTSCNum ) + ", Number of Transpired Collectors=" + TrimSigDigits( NumUTSC ) + ", UTSC name=" + CompName );
+			SimTranspiredCollectorUTSCNum = CompIndex;
+			if ( SimTranspiredCollectorUTSCNum > NumUTSC || SimTranspiredCollectorUTSCNum < 1 ) {
+				ShowFatalError( "SimTranspiredCollector: Invalid CompIndex passed=" + TrimSigDigits( SimTranspiredCollectorUTSCNum ) + ", Number of Transpired Collectors=" + TrimSigDigits( NumUTSC ) + ", UTSC name=" + CompName );
 			}
-			if ( CheckEquipName( UTSCNum ) ) {
-				if ( CompName != UTSC( UTSCNum ).Name ) {
-					ShowFatalError( "SimTranspiredCollector: Invalid CompIndex passed=" + TrimSigDigits( UTSCNum ) + ", Transpired Collector name=" + CompName + ", stored Transpired Collector Name for that index=" + UTSC( UTSCNum ).Name );
+			if ( CheckEquipName( SimTranspiredCollectorUTSCNum ) ) {
+				if ( CompName != UTSC( SimTranspiredCollectorUTSCNum ).Name ) {
+					ShowFatalError( "SimTranspiredCollector: Invalid CompIndex passed=" + TrimSigDigits( SimTranspiredCollectorUTSCNum ) + ", Transpired Collector name=" + CompName + ", stored Transpired Collector Name for that index=" + UTSC( SimTranspiredCollectorUTSCNum ).Name );
 				}
-				CheckEquipName( UTSCNum ) = false;
+				CheckEquipName( SimTranspiredCollectorUTSCNum ) = false;
 			}
 		}
 
@@ -244,13 +272,13 @@ namespace TranspiredCollector {
 			if ( ControlLTSet || ( ControlLTSchedule && ZoneLTSchedule ) ) UTSC_CI.IsOn = true; // heating required | free heating helpful | free heating helpful
 		}
 
-		if ( UTSC( UTSCNum ).IsOn ) {
-			CalcActiveTranspiredCollector( UTSCNum );
+		if ( UTSC( SimTranspiredCollectorUTSCNum ).IsOn ) {
+			CalcActiveTranspiredCollector( SimTranspiredCollectorUTSCNum );
 		} else {
-			CalcPassiveTranspiredCollector( UTSCNum );
+			CalcPassiveTranspiredCollector( SimTranspiredCollectorUTSCNum );
 		}
 
-		UpdateTranspiredCollector( UTSCNum );
+		UpdateTranspiredCollector( SimTranspiredCollectorUTSCNum );
 
 	}
 
@@ -328,7 +356,6 @@ namespace TranspiredCollector {
 		int MaxNumNumbers; // argumenet for call to GetObjectDefMaxArgs
 		int Dummy; // argumenet for call to GetObjectDefMaxArgs
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		int Found;
 		int AlphaOffset; // local temp var
 		std::string Roughness;
@@ -698,10 +725,7 @@ namespace TranspiredCollector {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true );
 		int UTSCUnitNum;
-		static bool MySetPointCheckFlag( true );
-		static Array1D_bool MyEnvrnFlag;
 		int ControlNode;
 		//unused  INTEGER             :: InletNode
 		int SplitBranch;
@@ -231,6 +231,11 @@ namespace TranspiredCollector {
 
 	// Functions
 
+	// Clears the global data in TranspiredCollector.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimTranspiredCollector(
 		std::string const & CompName, // component name
@@ -152,8 +152,91 @@ namespace UFADManager {
 
 	// SUBROUTINE SPECIFICATIONS:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool MyOneTimeFlag( true );
+		Array1D_bool MySizeFlag;
+		Real64 NumShadesDown( 0.0 );
+		int Ctd( 0 ); // DO loop index
+		int SurfNum( 0 ); // surface data structure index
+		int SizeUCSDUFCtd( 0 ); // DO loop index
+		int SizeUCSDUFSurfNum( 0 ); // surface data structure index
+		Real64 NumberOfOccupants( 0.0 ); // design number of occupants in the zone
+		Real64 NumberOfPlumes( 0.0 ); // design number of plumes in the zone
+		Real64 ZoneElecConv( 0.0 ); // zone elec equip design convective gain [W]
+		Real64 ZoneGasConv( 0.0 ); // zone gas equip design convective gain [W]
+		Real64 ZoneOthEqConv( 0.0 ); // zone other equip design convective gain [W]
+		Real64 ZoneHWEqConv( 0.0 ); // zone hot water equip design convective gain [W]
+		Real64 ZoneSteamEqConv( 0.0 ); // zone steam equip design convective gain [W]
+		bool MIXFLAG( false ); // if true treat as a mixed zone
+		Real64 PowerPerPlume( 0.0 ); // power generating each plume [W]
+		Real64 TempDepCoef( 0.0 ); // Formerly CoefSumha, coef in zone temp equation with dimensions of h*A
+		Real64 TempIndCoef( 0.0 ); // Formerly CoefSumhat, coef in zone temp equation with dimensions of h*A(T1
+		Array1D_int IntGainTypesOccupied( 28, { IntGainTypeOf_People, IntGainTypeOf_WaterHeaterMixed, IntGainTypeOf_WaterHeaterStratified, IntGainTypeOf_ThermalStorageChilledWaterMixed, IntGainTypeOf_ThermalStorageChilledWaterStratified, IntGainTypeOf_ElectricEquipment, IntGainTypeOf_GasEquipment, IntGainTypeOf_HotWaterEquipment, IntGainTypeOf_SteamEquipment, IntGainTypeOf_OtherEquipment, IntGainTypeOf_ZoneBaseboardOutdoorTemperatureControlled, IntGainTypeOf_GeneratorFuelCell, IntGainTypeOf_WaterUseEquipment, IntGainTypeOf_GeneratorMicroCHP, IntGainTypeOf_ElectricLoadCenterTransformer, IntGainTypeOf_ElectricLoadCenterInverterSimple, IntGainTypeOf_ElectricLoadCenterInverterFunctionOfPower, IntGainTypeOf_ElectricLoadCenterInverterLookUpTable, IntGainTypeOf_ElectricLoadCenterStorageBattery, IntGainTypeOf_ElectricLoadCenterStorageSimple, IntGainTypeOf_PipeIndoor, IntGainTypeOf_RefrigerationCase, IntGainTypeOf_RefrigerationCompressorRack, IntGainTypeOf_RefrigerationSystemAirCooledCondenser, IntGainTypeOf_RefrigerationSystemSuctionPipe, IntGainTypeOf_RefrigerationSecondaryReceiver, IntGainTypeOf_RefrigerationSecondaryPipe, IntGainTypeOf_RefrigerationWalkIn } );
+		Array1D_int IntGainTypesUpSubzone( 2, { IntGainTypeOf_DaylightingDeviceTubular, IntGainTypeOf_Lights } );
+		bool CalcUCSDUEMIXFLAG( false ); // if true treat as a mixed zone
+		Real64 CalcUCSDUEPowerPerPlume( 0.0 ); // power carried by each plume [W]
+		Real64 NumDiffusersPerPlume( 0.0 );
+		Real64 CalcUCSDUETempDepCoef( 0.0 ); // Formerly CoefSumha, coef in zone temp equation with dimensions of h*A
+		Real64 CalcUCSDUETempIndCoef( 0.0 ); // Formerly CoefSumhat, coef in zone temp equation with dimensions of h*A(T1
+		Array1D_int CalcUCSDUEIntGainTypesOccupied( 28, { IntGainTypeOf_People, IntGainTypeOf_WaterHeaterMixed, IntGainTypeOf_WaterHeaterStratified, IntGainTypeOf_ThermalStorageChilledWaterMixed, IntGainTypeOf_ThermalStorageChilledWaterStratified, IntGainTypeOf_ElectricEquipment, IntGainTypeOf_GasEquipment, IntGainTypeOf_HotWaterEquipment, IntGainTypeOf_SteamEquipment, IntGainTypeOf_OtherEquipment, IntGainTypeOf_ZoneBaseboardOutdoorTemperatureControlled, IntGainTypeOf_GeneratorFuelCell, IntGainTypeOf_WaterUseEquipment, IntGainTypeOf_GeneratorMicroCHP, IntGainTypeOf_ElectricLoadCenterTransformer, IntGainTypeOf_ElectricLoadCenterInverterSimple, IntGainTypeOf_ElectricLoadCenterInverterFunctionOfPower, IntGainTypeOf_ElectricLoadCenterInverterLookUpTable, IntGainTypeOf_ElectricLoadCenterStorageBattery, IntGainTypeOf_ElectricLoadCenterStorageSimple, IntGainTypeOf_PipeIndoor, IntGainTypeOf_RefrigerationCase, IntGainTypeOf_RefrigerationCompressorRack, IntGainTypeOf_RefrigerationSystemAirCooledCondenser, IntGainTypeOf_RefrigerationSystemSuctionPipe, IntGainTypeOf_RefrigerationSecondaryReceiver, IntGainTypeOf_RefrigerationSecondaryPipe, IntGainTypeOf_RefrigerationWalkIn } );
+		Array1D_int CalcUCSDUEIntGainTypesUpSubzone( 2, { IntGainTypeOf_DaylightingDeviceTubular, IntGainTypeOf_Lights } );
+	}
+
 	// Functions
 
+	// Clears the global data in UFADManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		HAT_MX = 0.0;
+		HAT_MXWin = 0.0;
+		HA_MX = 0.0;
+		HA_MXWin = 0.0;
+		HAT_OC = 0.0;
+		HAT_OCWin = 0.0;
+		HA_OC = 0.0;
+		HA_OCWin = 0.0;
+		HAT_FLOOR = 0.0;
+		HA_FLOOR = 0.0;
+		HeightFloorSubzoneTop = 0.2;
+		ThickOccupiedSubzoneMin = 0.2;
+		HeightIntMass = 0.0;
+		HeightIntMassDefault = 2.0;
+		MyOneTimeFlag = true;
+		MySizeFlag.deallocate();
+		NumShadesDown = 0.0;
+		Ctd = 0;
+		SurfNum = 0;
+		SizeUCSDUFCtd = 0;
+		SizeUCSDUFSurfNum = 0;
+		NumberOfOccupants = 0.0;
+		NumberOfPlumes = 0.0;
+		ZoneElecConv = 0.0;
+		ZoneGasConv = 0.0;
+		ZoneOthEqConv = 0.0;
+		ZoneHWEqConv = 0.0;
+		ZoneSteamEqConv = 0.0;
+		MIXFLAG = false;
+		PowerPerPlume = 0.0;
+		TempDepCoef = 0.0;
+		TempIndCoef = 0.0;
+		IntGainTypesOccupied = Array1D_int( 28, { IntGainTypeOf_People, IntGainTypeOf_WaterHeaterMixed, IntGainTypeOf_WaterHeaterStratified, IntGainTypeOf_ThermalStorageChilledWaterMixed, IntGainTypeOf_ThermalStorageChilledWaterStratified, IntGainTypeOf_ElectricEquipment, IntGainTypeOf_GasEquipment, IntGainTypeOf_HotWaterEquipment, IntGainTypeOf_SteamEquipment, IntGainTypeOf_OtherEquipment, IntGainTypeOf_ZoneBaseboardOutdoorTemperatureControlled, IntGainTypeOf_GeneratorFuelCell, IntGainTypeOf_WaterUseEquipment, IntGainTypeOf_GeneratorMicroCHP, IntGainTypeOf_ElectricLoadCenterTransformer, IntGainTypeOf_ElectricLoadCenterInverterSimple, IntGainTypeOf_ElectricLoadCenterInverterFunctionOfPower, IntGainTypeOf_ElectricLoadCenterInverterLookUpTable, IntGainTypeOf_ElectricLoadCenterStorageBattery, IntGainTypeOf_ElectricLoadCenterStorageSimple, IntGainTypeOf_PipeIndoor, IntGainTypeOf_RefrigerationCase, IntGainTypeOf_RefrigerationCompressorRack, IntGainTypeOf_RefrigerationSystemAirCooledCondenser, IntGainTypeOf_RefrigerationSystemSuctionPipe, IntGainTypeOf_RefrigerationSecondaryReceiver, IntGainTypeOf_RefrigerationSecondaryPipe, IntGainTypeOf_RefrigerationWalkIn } );
+		IntGainTypesUpSubzone = Array1D_int( 2, { IntGainTypeOf_DaylightingDeviceTubular, IntGainTypeOf_Lights } );
+		CalcUCSDUEMIXFLAG = false;
+		CalcUCSDUEPowerPerPlume = 0.0;
+		NumDiffusersPerPlume = 0.0;
+		CalcUCSDUETempDepCoef = 0.0;
+		CalcUCSDUETempIndCoef = 0.0;
+		CalcUCSDUEIntGainTypesOccupied = Array1D_int( 28, { IntGainTypeOf_People, IntGainTypeOf_WaterHeaterMixed, IntGainTypeOf_WaterHeaterStratified, IntGainTypeOf_ThermalStorageChilledWaterMixed, IntGainTypeOf_ThermalStorageChilledWaterStratified, IntGainTypeOf_ElectricEquipment, IntGainTypeOf_GasEquipment, IntGainTypeOf_HotWaterEquipment, IntGainTypeOf_SteamEquipment, IntGainTypeOf_OtherEquipment, IntGainTypeOf_ZoneBaseboardOutdoorTemperatureControlled, IntGainTypeOf_GeneratorFuelCell, IntGainTypeOf_WaterUseEquipment, IntGainTypeOf_GeneratorMicroCHP, IntGainTypeOf_ElectricLoadCenterTransformer, IntGainTypeOf_ElectricLoadCenterInverterSimple, IntGainTypeOf_ElectricLoadCenterInverterFunctionOfPower, IntGainTypeOf_ElectricLoadCenterInverterLookUpTable, IntGainTypeOf_ElectricLoadCenterStorageBattery, IntGainTypeOf_ElectricLoadCenterStorageSimple, IntGainTypeOf_PipeIndoor, IntGainTypeOf_RefrigerationCase, IntGainTypeOf_RefrigerationCompressorRack, IntGainTypeOf_RefrigerationSystemAirCooledCondenser, IntGainTypeOf_RefrigerationSystemSuctionPipe, IntGainTypeOf_RefrigerationSecondaryReceiver, IntGainTypeOf_RefrigerationSecondaryPipe, IntGainTypeOf_RefrigerationWalkIn } );
+		CalcUCSDUEIntGainTypesUpSubzone = Array1D_int( 2, { IntGainTypeOf_DaylightingDeviceTubular, IntGainTypeOf_Lights } );
+	}
+
 	void
 	ManageUCSDUFModels(
 		int const ZoneNum, // index number for the specified zone
@@ -261,12 +344,7 @@ namespace UFADManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		// na
 
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MySizeFlag;
-		static Real64 NumShadesDown( 0.0 );
 		int UINum; // index to underfloor interior zone model data
-		static int Ctd( 0 ); // DO loop index
-		static int SurfNum( 0 ); // surface data structure index
 
 		// Do the one time initializations
 		if ( MyOneTimeFlag ) {
@@ -352,22 +430,13 @@ namespace UFADManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int UINum; // index to underfloor interior zone model data
-		static int Ctd( 0 ); // DO loop index
-		static int SurfNum( 0 ); // surface data structure index
-		static Real64 NumberOfOccupants( 0.0 ); // design number of occupants in the zone
-		static Real64 NumberOfPlumes( 0.0 ); // design number of plumes in the zone
-		static Real64 ZoneElecConv( 0.0 ); // zone elec equip design convective gain [W]
-		static Real64 ZoneGasConv( 0.0 ); // zone gas equip design convective gain [W]
-		static Real64 ZoneOthEqConv( 0.0 ); // zone other equip design convective gain [W]
-		static Real64 ZoneHWEqConv( 0.0 ); // zone hot water equip design convective gain [W]
-		static Real64 ZoneSteamEqConv( 0.0 ); // zone steam equip design convective gain [W]
 
 		if ( ZoneModelType == RoomAirModel_UCSDUFI ) {
 			UINum = ZoneUFPtr( ZoneNum );
 			NumberOfOccupants = 0.0;
-			for ( Ctd = 1; Ctd <= TotPeople; ++Ctd ) {
-				if ( People( Ctd ).ZonePtr == ZoneNum ) {
-					NumberOfOccupants += People( Ctd ).NumberOfPeople;
+			for ( SizeUCSDUFCtd = 1; SizeUCSDUFCtd <= TotPeople; ++SizeUCSDUFCtd ) {
+				if ( People( SizeUCSDUFCtd ).ZonePtr == ZoneNum ) {
+					NumberOfOccupants += People( SizeUCSDUFCtd ).NumberOfPeople;
 				}
 			}
 			if ( ZoneUCSDUI( UINum ).DiffArea == AutoSize ) {
@@ -458,33 +527,33 @@ namespace UFADManager {
 					NumberOfPlumes = 1.0;
 				}
 				ZoneElecConv = 0.0;
-				for ( Ctd = 1; Ctd <= TotElecEquip; ++Ctd ) {
-					if ( ZoneElectric( Ctd ).ZonePtr == ZoneNum ) {
-						ZoneElecConv += ZoneElectric( Ctd ).DesignLevel * ZoneElectric( Ctd ).FractionConvected;
+				for ( SizeUCSDUFCtd = 1; SizeUCSDUFCtd <= TotElecEquip; ++SizeUCSDUFCtd ) {
+					if ( ZoneElectric( SizeUCSDUFCtd ).ZonePtr == ZoneNum ) {
+						ZoneElecConv += ZoneElectric( SizeUCSDUFCtd ).DesignLevel * ZoneElectric( SizeUCSDUFCtd ).FractionConvected;
 					}
 				}
 				ZoneGasConv = 0.0;
-				for ( Ctd = 1; Ctd <= TotGasEquip; ++Ctd ) {
-					if ( ZoneGas( Ctd ).ZonePtr == ZoneNum ) {
-						ZoneGasConv += ZoneGas( Ctd ).DesignLevel * ZoneGas( Ctd ).FractionConvected;
+				for ( SizeUCSDUFCtd = 1; SizeUCSDUFCtd <= TotGasEquip; ++SizeUCSDUFCtd ) {
+					if ( ZoneGas( SizeUCSDUFCtd ).ZonePtr == ZoneNum ) {
+						ZoneGasConv += ZoneGas( SizeUCSDUFCtd ).DesignLevel * ZoneGas( SizeUCSDUFCtd ).FractionConvected;
 					}
 				}
 				ZoneOthEqConv = 0.0;
-				for ( Ctd = 1; Ctd <= TotOthEquip; ++Ctd ) {
-					if ( ZoneOtherEq( Ctd ).ZonePtr == ZoneNum ) {
-						ZoneOthEqConv += ZoneOtherEq( Ctd ).DesignLevel * ZoneOtherEq( Ctd ).FractionConvected;
+				for ( SizeUCSDUFCtd = 1; SizeUCSDUFCtd <= TotOthEquip; ++SizeUCSDUFCtd ) {
+					if ( ZoneOtherEq( SizeUCSDUFCtd ).ZonePtr == ZoneNum ) {
+						ZoneOthEqConv += ZoneOtherEq( SizeUCSDUFCtd ).DesignLevel * ZoneOtherEq( SizeUCSDUFCtd ).FractionConvected;
 					}
 				}
 				ZoneHWEqConv = 0.0;
-				for ( Ctd = 1; Ctd <= TotHWEquip; ++Ctd ) {
-					if ( ZoneHWEq( Ctd ).ZonePtr == ZoneNum ) {
-						ZoneHWEqConv += ZoneHWEq( Ctd ).DesignLevel * ZoneHWEq( Ctd ).FractionConvected;
+				for ( SizeUCSDUFCtd = 1; SizeUCSDUFCtd <= TotHWEquip; ++SizeUCSDUFCtd ) {
+					if ( ZoneHWEq( SizeUCSDUFCtd ).ZonePtr == ZoneNum ) {
+						ZoneHWEqConv += ZoneHWEq( SizeUCSDUFCtd ).DesignLevel * ZoneHWEq( SizeUCSDUFCtd ).FractionConvected;
 					}
 				}
-				for ( Ctd = 1; Ctd <= TotStmEquip; ++Ctd ) {
+				for ( SizeUCSDUFCtd = 1; SizeUCSDUFCtd <= TotStmEquip; ++SizeUCSDUFCtd ) {
 					ZoneSteamEqConv = 0.0;
-					if ( ZoneSteamEq( Ctd ).ZonePtr == ZoneNum ) {
-						ZoneSteamEqConv += ZoneSteamEq( Ctd ).DesignLevel * ZoneSteamEq( Ctd ).FractionConvected;
+					if ( ZoneSteamEq( SizeUCSDUFCtd ).ZonePtr == ZoneNum ) {
+						ZoneSteamEqConv += ZoneSteamEq( SizeUCSDUFCtd ).DesignLevel * ZoneSteamEq( SizeUCSDUFCtd ).FractionConvected;
 					}
 				}
 				ZoneUCSDUI( UINum ).PowerPerPlume = ( NumberOfOccupants * 73.0 + ZoneElecConv + ZoneGasConv + ZoneOthEqConv + ZoneHWEqConv + ZoneSteamEqConv ) / NumberOfPlumes;
@@ -504,11 +573,11 @@ namespace UFADManager {
 		if ( ZoneModelType == RoomAirModel_UCSDUFE ) {
 			UINum = ZoneUFPtr( ZoneNum );
 			// calculate total window width in zone
-			for ( Ctd = PosZ_Window( ( ZoneNum - 1 ) * 2 + 1 ); Ctd <= PosZ_Window( ( ZoneNum - 1 ) * 2 + 2 ); ++Ctd ) {
-				SurfNum = APos_Window( Ctd );
-				if ( SurfNum == 0 ) continue;
-				if ( Surface( SurfNum ).ExtBoundCond == ExternalEnvironment || Surface( SurfNum ).ExtBoundCond == OtherSideCoefNoCalcExt || Surface( SurfNum ).ExtBoundCond == OtherSideCoefCalcExt || Surface( SurfNum ).ExtBoundCond == OtherSideCondModeledExt ) {
-					ZoneUCSDUE( UINum ).WinWidth += Surface( SurfNum ).Width;
+			for ( SizeUCSDUFCtd = PosZ_Window( ( ZoneNum - 1 ) * 2 + 1 ); SizeUCSDUFCtd <= PosZ_Window( ( ZoneNum - 1 ) * 2 + 2 ); ++SizeUCSDUFCtd ) {
+				SizeUCSDUFSurfNum = APos_Window( SizeUCSDUFCtd );
+				if ( SizeUCSDUFSurfNum == 0 ) continue;
+				if ( Surface( SizeUCSDUFSurfNum ).ExtBoundCond == ExternalEnvironment || Surface( SizeUCSDUFSurfNum ).ExtBoundCond == OtherSideCoefNoCalcExt || Surface( SizeUCSDUFSurfNum ).ExtBoundCond == OtherSideCoefCalcExt || Surface( SizeUCSDUFSurfNum ).ExtBoundCond == OtherSideCondModeledExt ) {
+					ZoneUCSDUE( UINum ).WinWidth += Surface( SizeUCSDUFSurfNum ).Width;
 					++ZoneUCSDUE( UINum ).NumExtWin;
 				}
 			}
@@ -517,9 +586,9 @@ namespace UFADManager {
 				ShowContinueError( "  The zone will be treated as a UFAD interior zone" );
 			}
 			NumberOfOccupants = 0.0;
-			for ( Ctd = 1; Ctd <= TotPeople; ++Ctd ) {
-				if ( People( Ctd ).ZonePtr == ZoneNum ) {
-					NumberOfOccupants += People( Ctd ).NumberOfPeople;
+			for ( SizeUCSDUFCtd = 1; SizeUCSDUFCtd <= TotPeople; ++SizeUCSDUFCtd ) {
+				if ( People( SizeUCSDUFCtd ).ZonePtr == ZoneNum ) {
+					NumberOfOccupants += People( SizeUCSDUFCtd ).NumberOfPeople;
 				}
 			}
 			if ( ZoneUCSDUE( UINum ).DiffArea == AutoSize ) {
@@ -609,33 +678,33 @@ namespace UFADManager {
 					NumberOfPlumes = 1.0;
 				}
 				ZoneElecConv = 0.0;
-				for ( Ctd = 1; Ctd <= TotElecEquip; ++Ctd ) {
-					if ( ZoneElectric( Ctd ).ZonePtr == ZoneNum ) {
-						ZoneElecConv += ZoneElectric( Ctd ).DesignLevel;
+				for ( SizeUCSDUFCtd = 1; SizeUCSDUFCtd <= TotElecEquip; ++SizeUCSDUFCtd ) {
+					if ( ZoneElectric( SizeUCSDUFCtd ).ZonePtr == ZoneNum ) {
+						ZoneElecConv += ZoneElectric( SizeUCSDUFCtd ).DesignLevel;
 					}
 				}
 				ZoneGasConv = 0.0;
-				for ( Ctd = 1; Ctd <= TotGasEquip; ++Ctd ) {
-					if ( ZoneGas( Ctd ).ZonePtr == ZoneNum ) {
-						ZoneGasConv += ZoneGas( Ctd ).DesignLevel;
+				for ( SizeUCSDUFCtd = 1; SizeUCSDUFCtd <= TotGasEquip; ++SizeUCSDUFCtd ) {
+					if ( ZoneGas( SizeUCSDUFCtd ).ZonePtr == ZoneNum ) {
+						ZoneGasConv += ZoneGas( SizeUCSDUFCtd ).DesignLevel;
 					}
 				}
 				ZoneOthEqConv = 0.0;
-				for ( Ctd = 1; Ctd <= TotOthEquip; ++Ctd ) {
-					if ( ZoneOtherEq( Ctd ).ZonePtr == ZoneNum ) {
-						ZoneOthEqConv += ZoneOtherEq( Ctd ).DesignLevel;
+				for ( SizeUCSDUFCtd = 1; SizeUCSDUFCtd <= TotOthEquip; ++SizeUCSDUFCtd ) {
+					if ( ZoneOtherEq( SizeUCSDUFCtd ).ZonePtr == ZoneNum ) {
+						ZoneOthEqConv += ZoneOtherEq( SizeUCSDUFCtd ).DesignLevel;
 					}
 				}
 				ZoneHWEqConv = 0.0;
-				for ( Ctd = 1; Ctd <= TotHWEquip; ++Ctd ) {
-					if ( ZoneHWEq( Ctd ).ZonePtr == ZoneNum ) {
-						ZoneHWEqConv += ZoneHWEq( Ctd ).DesignLevel;
+				for ( SizeUCSDUFCtd = 1; SizeUCSDUFCtd <= TotHWEquip; ++SizeUCSDUFCtd ) {
+					if ( ZoneHWEq( SizeUCSDUFCtd ).ZonePtr == ZoneNum ) {
+						ZoneHWEqConv += ZoneHWEq( SizeUCSDUFCtd ).DesignLevel;
 					}
 				}
-				for ( Ctd = 1; Ctd <= TotStmEquip; ++Ctd ) {
+				for ( SizeUCSDUFCtd = 1; SizeUCSDUFCtd <= TotStmEquip; ++SizeUCSDUFCtd ) {
 					ZoneSteamEqConv = 0.0;
-					if ( ZoneSteamEq( Ctd ).ZonePtr == ZoneNum ) {
-						ZoneSteamEqConv += ZoneSteamEq( Ctd ).DesignLevel;
+					if ( ZoneSteamEq( SizeUCSDUFCtd ).ZonePtr == ZoneNum ) {
+						ZoneSteamEqConv += ZoneSteamEq( SizeUCSDUFCtd ).DesignLevel;
 					}
 				}
 				ZoneUCSDUE( UINum ).PowerPerPlume = ( NumberOfOccupants * 73.0 + ZoneElecConv + ZoneGasConv + ZoneOthEqConv + ZoneHWEqConv + ZoneSteamEqConv ) / NumberOfPlumes;
@@ -1018,7 +1087,6 @@ namespace UFADManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MIXFLAG( false ); // if true treat as a mixed zone
 		Real64 CeilingHeight; // zone ceiling height above floor [m]
 		int UINum; // index to underfloor interior zone model data
 		Real64 GainsFrac; // fraction of occupied subzone heat gains that remain in the subzone;
@@ -1044,7 +1112,6 @@ namespace UFADManager {
 		Real64 MCpT_Total; // total mass flow rate * specific heat* temp for this zone [W]
 		Real64 NumberOfPlumes;
 		Real64 PowerInPlumes; // [W]
-		static Real64 PowerPerPlume( 0.0 ); // power generating each plume [W]
 		Real64 HeightFrac; // Fractional height of transition between occupied and upper subzones
 		Real64 TotSysFlow; // [m3/s]
 		Real64 NumDiffusersPerPlume;
@@ -1063,11 +1130,7 @@ namespace UFADManager {
 		Real64 HeightOccupiedSubzoneAve; // Height of center of occupied air subzone
 		Real64 ZoneMult; // total zone multiplier
 		int ZoneNodeNum; // node number of the HVAC zone node
-		static Real64 TempDepCoef( 0.0 ); // Formerly CoefSumha, coef in zone temp equation with dimensions of h*A
-		static Real64 TempIndCoef( 0.0 ); // Formerly CoefSumhat, coef in zone temp equation with dimensions of h*A(T1
-		static Array1D_int IntGainTypesOccupied( 28, { IntGainTypeOf_People, IntGainTypeOf_WaterHeaterMixed, IntGainTypeOf_WaterHeaterStratified, IntGainTypeOf_ThermalStorageChilledWaterMixed, IntGainTypeOf_ThermalStorageChilledWaterStratified, IntGainTypeOf_ElectricEquipment, IntGainTypeOf_GasEquipment, IntGainTypeOf_HotWaterEquipment, IntGainTypeOf_SteamEquipment, IntGainTypeOf_OtherEquipment, IntGainTypeOf_ZoneBaseboardOutdoorTemperatureControlled, IntGainTypeOf_GeneratorFuelCell, IntGainTypeOf_WaterUseEquipment, IntGainTypeOf_GeneratorMicroCHP, IntGainTypeOf_ElectricLoadCenterTransformer, IntGainTypeOf_ElectricLoadCenterInverterSimple, IntGainTypeOf_ElectricLoadCenterInverterFunctionOfPower, IntGainTypeOf_ElectricLoadCenterInverterLookUpTable, IntGainTypeOf_ElectricLoadCenterStorageBattery, IntGainTypeOf_ElectricLoadCenterStorageSimple, IntGainTypeOf_PipeIndoor, IntGainTypeOf_RefrigerationCase, IntGainTypeOf_RefrigerationCompressorRack, IntGainTypeOf_RefrigerationSystemAirCooledCondenser, IntGainTypeOf_RefrigerationSystemSuctionPipe, IntGainTypeOf_RefrigerationSecondaryReceiver, IntGainTypeOf_RefrigerationSecondaryPipe, IntGainTypeOf_RefrigerationWalkIn } );
 
-		static Array1D_int IntGainTypesUpSubzone( 2, { IntGainTypeOf_DaylightingDeviceTubular, IntGainTypeOf_Lights } );
 		Real64 RetAirGains;
 
 		// Exact solution or Euler method
@@ -1437,7 +1500,6 @@ namespace UFADManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MIXFLAG( false ); // if true treat as a mixed zone
 		Real64 CeilingHeight; // zone ceiling height above floor [m]
 		int UINum; // index to underfloor interior zone model data
 		Real64 GainsFrac; // fraction of occupied subzone heat gains that remain in the subzone;
@@ -1463,9 +1525,7 @@ namespace UFADManager {
 		Real64 MCpT_Total; // total mass flow rate * specific heat* temp for this zone [W]
 		Real64 NumberOfPlumes;
 		Real64 PowerInPlumes; // [W]
-		static Real64 PowerPerPlume( 0.0 ); // power carried by each plume [W]
 		Real64 PowerInPlumesPerMeter; // Power in Plumes per meter of window length [W/m]
-		static Real64 NumDiffusersPerPlume( 0.0 );
 		Real64 HeightFrac; // Fractional height of transition between occupied and upper subzones
 		Real64 TotSysFlow; // [m3/s]
 		Real64 NumDiffusers;
@@ -1483,11 +1543,7 @@ namespace UFADManager {
 		Real64 HeightOccupiedSubzoneAve; // Height of center of occupied air subzone
 		Real64 ZoneMult; // total zone multiplier
 		int ZoneNodeNum; // node number of the HVAC zone node
-		static Real64 TempDepCoef( 0.0 ); // Formerly CoefSumha, coef in zone temp equation with dimensions of h*A
-		static Real64 TempIndCoef( 0.0 ); // Formerly CoefSumhat, coef in zone temp equation with dimensions of h*A(T1
-		static Array1D_int IntGainTypesOccupied( 28, { IntGainTypeOf_People, IntGainTypeOf_WaterHeaterMixed, IntGainTypeOf_WaterHeaterStratified, IntGainTypeOf_ThermalStorageChilledWaterMixed, IntGainTypeOf_ThermalStorageChilledWaterStratified, IntGainTypeOf_ElectricEquipment, IntGainTypeOf_GasEquipment, IntGainTypeOf_HotWaterEquipment, IntGainTypeOf_SteamEquipment, IntGainTypeOf_OtherEquipment, IntGainTypeOf_ZoneBaseboardOutdoorTemperatureControlled, IntGainTypeOf_GeneratorFuelCell, IntGainTypeOf_WaterUseEquipment, IntGainTypeOf_GeneratorMicroCHP, IntGainTypeOf_ElectricLoadCenterTransformer, IntGainTypeOf_ElectricLoadCenterInverterSimple, IntGainTypeOf_ElectricLoadCenterInverterFunctionOfPower, IntGainTypeOf_ElectricLoadCenterInverterLookUpTable, IntGainTypeOf_ElectricLoadCenterStorageBattery, IntGainTypeOf_ElectricLoadCenterStorageSimple, IntGainTypeOf_PipeIndoor, IntGainTypeOf_RefrigerationCase, IntGainTypeOf_RefrigerationCompressorRack, IntGainTypeOf_RefrigerationSystemAirCooledCondenser, IntGainTypeOf_RefrigerationSystemSuctionPipe, IntGainTypeOf_RefrigerationSecondaryReceiver, IntGainTypeOf_RefrigerationSecondaryPipe, IntGainTypeOf_RefrigerationWalkIn } );
 
-		static Array1D_int IntGainTypesUpSubzone( 2, { IntGainTypeOf_DaylightingDeviceTubular, IntGainTypeOf_Lights } );
 		Real64 RetAirGains;
 
 		// Exact solution or Euler method
@@ -1507,7 +1563,7 @@ namespace UFADManager {
 		}
 
 		HeightFrac = 0.0;
-		MIXFLAG = false;
+		CalcUCSDUEMIXFLAG = false;
 		UFHcIn = HConvIn;
 		SumSysMCp = 0.0;
 		SumSysMCpT = 0.0;
@@ -1527,15 +1583,15 @@ namespace UFADManager {
 		ThrowAngle = DegToRadians * ZoneUCSDUE( UINum ).DiffAngle;
 		SourceHeight = ZoneUCSDUE( UINum ).HeatSrcHeight;
 		NumDiffusers = ZoneUCSDUE( UINum ).DiffusersPerZone;
-		PowerPerPlume = ZoneUCSDUE( UINum ).PowerPerPlume;
+		CalcUCSDUEPowerPerPlume = ZoneUCSDUE( UINum ).PowerPerPlume;
 		// gains from occupants, task lighting, elec equip, gas equip, other equip, hot water equip, steam equip,
 		// baseboards (nonthermostatic), water heater skin loss
-		SumInternalConvectionGainsByTypes( ZoneNum, IntGainTypesOccupied, ConvGainsOccSubzone );
+		SumInternalConvectionGainsByTypes( ZoneNum, CalcUCSDUEIntGainTypesOccupied, ConvGainsOccSubzone );
 
 		// Add heat to return air if zonal system (no return air) or cycling system (return air frequently very
 		// low or zero)
 		if ( Zone( ZoneNum ).NoHeatToReturnAir ) {
-			SumReturnAirConvectionGainsByTypes( ZoneNum, IntGainTypesOccupied, RetAirGains );
+			SumReturnAirConvectionGainsByTypes( ZoneNum, CalcUCSDUEIntGainTypesOccupied, RetAirGains );
 			ConvGainsOccSubzone += RetAirGains;
 		}
 
@@ -1543,10 +1599,10 @@ namespace UFADManager {
 		ConvGainsOccSubzone += SumConvPool( ZoneNum );
 
 		// gains from lights (ceiling), tubular daylighting devices, high temp radiant heaters
-		SumInternalConvectionGainsByTypes( ZoneNum, IntGainTypesUpSubzone, ConvGainsUpSubzone );
+		SumInternalConvectionGainsByTypes( ZoneNum, CalcUCSDUEIntGainTypesUpSubzone, ConvGainsUpSubzone );
 		ConvGainsUpSubzone += SumConvHTRadSys( ZoneNum );
 		if ( Zone( ZoneNum ).NoHeatToReturnAir ) {
-			SumReturnAirConvectionGainsByTypes( ZoneNum, IntGainTypesUpSubzone, RetAirGains );
+			SumReturnAirConvectionGainsByTypes( ZoneNum, CalcUCSDUEIntGainTypesUpSubzone, RetAirGains );
 			ConvGainsUpSubzone += RetAirGains;
 		}
 		ConvGains = ConvGainsOccSubzone + ConvGainsUpSubzone + SysDepZoneLoadsLagged( ZoneNum );
@@ -1588,8 +1644,8 @@ namespace UFADManager {
 		ConvGainsWindows = HAT_MXWin + HAT_OCWin - HA_MXWin * ZTMX( ZoneNum ) - HA_OCWin * ZTOC( ZoneNum );
 		PowerInPlumes = ConvGains + HAT_OC - HA_OC * ZTOC( ZoneNum ) + HAT_MX - HA_MX * ZTMX( ZoneNum );
 		// NumberOfPlumes = PowerInPlumes / PowerPerPlume
-		if ( PowerPerPlume > 0.0 && PowerInPlumes > 0.0 ) {
-			NumberOfPlumes = PowerInPlumes / PowerPerPlume;
+		if ( CalcUCSDUEPowerPerPlume > 0.0 && PowerInPlumes > 0.0 ) {
+			NumberOfPlumes = PowerInPlumes / CalcUCSDUEPowerPerPlume;
 			NumDiffusersPerPlume = NumDiffusers / NumberOfPlumes;
 		} else {
 			NumberOfPlumes = 1.0;
@@ -1679,35 +1735,35 @@ namespace UFADManager {
 
 				AirCap = AIRRATOC( ZoneNum );
 				TempHistTerm = AirCap * ( 3.0 * ZTM1OC( ZoneNum ) - ( 3.0 / 2.0 ) * ZTM2OC( ZoneNum ) + ( 1.0 / 3.0 ) * ZTM3OC( ZoneNum ) );
-				TempDepCoef = GainsFrac * HA_OC + MCp_Total;
-				TempIndCoef = GainsFrac * ( ConvGains + HAT_OC + HAT_MX - HA_MX * ZTMX( ZoneNum ) ) + MCpT_Total + NonAirSystemResponse( ZoneNum ) / ZoneMult;
+				CalcUCSDUETempDepCoef = GainsFrac * HA_OC + MCp_Total;
+				CalcUCSDUETempIndCoef = GainsFrac * ( ConvGains + HAT_OC + HAT_MX - HA_MX * ZTMX( ZoneNum ) ) + MCpT_Total + NonAirSystemResponse( ZoneNum ) / ZoneMult;
 				{ auto const SELECT_CASE_var( ZoneAirSolutionAlgo );
 				if ( SELECT_CASE_var == Use3rdOrder ) {
 					ZTOC( ZoneNum ) = ( TempHistTerm + GainsFrac * ( ConvGains + HAT_OC + HAT_MX - HA_MX * ZTMX( ZoneNum ) ) + MCpT_Total + NonAirSystemResponse( ZoneNum ) / ZoneMult ) / ( ( 11.0 / 6.0 ) * AirCap + GainsFrac * HA_OC + MCp_Total );
 				} else if ( SELECT_CASE_var == UseAnalyticalSolution ) {
-					if ( TempDepCoef == 0.0 ) { // B=0
-						ZTOC( ZoneNum ) = Zone1OC( ZoneNum ) + TempIndCoef / AirCap;
+					if ( CalcUCSDUETempDepCoef == 0.0 ) { // B=0
+						ZTOC( ZoneNum ) = Zone1OC( ZoneNum ) + CalcUCSDUETempIndCoef / AirCap;
 					} else {
-						ZTOC( ZoneNum ) = ( Zone1OC( ZoneNum ) - TempIndCoef / TempDepCoef ) * std::exp( min( 700.0, - TempDepCoef / AirCap ) ) + TempIndCoef / TempDepCoef;
+						ZTOC( ZoneNum ) = ( Zone1OC( ZoneNum ) - CalcUCSDUETempIndCoef / CalcUCSDUETempDepCoef ) * std::exp( min( 700.0, - CalcUCSDUETempDepCoef / AirCap ) ) + CalcUCSDUETempIndCoef / CalcUCSDUETempDepCoef;
 					}
 				} else if ( SELECT_CASE_var == UseEulerMethod ) {
-					ZTOC( ZoneNum ) = ( AirCap * Zone1OC( ZoneNum ) + TempIndCoef ) / ( AirCap + TempDepCoef );
+					ZTOC( ZoneNum ) = ( AirCap * Zone1OC( ZoneNum ) + CalcUCSDUETempIndCoef ) / ( AirCap + CalcUCSDUETempDepCoef );
 				}}
 				AirCap = AIRRATMX( ZoneNum );
 				TempHistTerm = AirCap * ( 3.0 * ZTM1MX( ZoneNum ) - ( 3.0 / 2.0 ) * ZTM2MX( ZoneNum ) + ( 1.0 / 3.0 ) * ZTM3MX( ZoneNum ) );
-				TempDepCoef = ( 1.0 - GainsFrac ) * HA_MX + MCp_Total;
-				TempIndCoef = ( 1.0 - GainsFrac ) * ( ConvGains + HAT_OC + HAT_MX - HA_OC * ZTOC( ZoneNum ) ) + ZTOC( ZoneNum ) * MCp_Total;
+				CalcUCSDUETempDepCoef = ( 1.0 - GainsFrac ) * HA_MX + MCp_Total;
+				CalcUCSDUETempIndCoef = ( 1.0 - GainsFrac ) * ( ConvGains + HAT_OC + HAT_MX - HA_OC * ZTOC( ZoneNum ) ) + ZTOC( ZoneNum ) * MCp_Total;
 				{ auto const SELECT_CASE_var( ZoneAirSolutionAlgo );
 				if ( SELECT_CASE_var == Use3rdOrder ) {
 					ZTMX( ZoneNum ) = ( TempHistTerm + ( 1.0 - GainsFrac ) * ( ConvGains + HAT_OC + HAT_MX - HA_OC * ZTOC( ZoneNum ) ) + ZTOC( ZoneNum ) * MCp_Total ) / ( ( 11.0 / 6.0 ) * AirCap + ( 1.0 - GainsFrac ) * HA_MX + MCp_Total );
 				} else if ( SELECT_CASE_var == UseAnalyticalSolution ) {
-					if ( TempDepCoef == 0.0 ) { // B=0
-						ZTMX( ZoneNum ) = Zone1MX( ZoneNum ) + TempIndCoef / AirCap;
+					if ( CalcUCSDUETempDepCoef == 0.0 ) { // B=0
+						ZTMX( ZoneNum ) = Zone1MX( ZoneNum ) + CalcUCSDUETempIndCoef / AirCap;
 					} else {
-						ZTMX( ZoneNum ) = ( Zone1MX( ZoneNum ) - TempIndCoef / TempDepCoef ) * std::exp( min( 700.0, - TempDepCoef / AirCap ) ) + TempIndCoef / TempDepCoef;
+						ZTMX( ZoneNum ) = ( Zone1MX( ZoneNum ) - CalcUCSDUETempIndCoef / CalcUCSDUETempDepCoef ) * std::exp( min( 700.0, - CalcUCSDUETempDepCoef / AirCap ) ) + CalcUCSDUETempIndCoef / CalcUCSDUETempDepCoef;
 					}
 				} else if ( SELECT_CASE_var == UseEulerMethod ) {
-					ZTMX( ZoneNum ) = ( AirCap * Zone1MX( ZoneNum ) + TempIndCoef ) / ( AirCap + TempDepCoef );
+					ZTMX( ZoneNum ) = ( AirCap * Zone1MX( ZoneNum ) + CalcUCSDUETempIndCoef ) / ( AirCap + CalcUCSDUETempDepCoef );
 				}}
 				ZTFloor( ZoneNum ) = ZTOC( ZoneNum );
 			}
@@ -1727,7 +1783,7 @@ namespace UFADManager {
 
 		//=============================== M I X E D  Calculation ==============================================
 		if ( ZTMX( ZoneNum ) < ZTOC( ZoneNum ) || MCp_Total <= 0.0 || HeightFrac * CeilingHeight < ThickOccupiedSubzoneMin ) {
-			MIXFLAG = true;
+			CalcUCSDUEMIXFLAG = true;
 			HeightFrac = 0.0;
 
 			AvgTempGrad( ZoneNum ) = 0.0;
@@ -1737,37 +1793,37 @@ namespace UFADManager {
 			TempHistTerm = AirCap * ( 3.0 * ZTM1( ZoneNum ) - ( 3.0 / 2.0 ) * ZTM2( ZoneNum ) + ( 1.0 / 3.0 ) * ZTM3( ZoneNum ) );
 
 			for ( Ctd = 1; Ctd <= 3; ++Ctd ) {
-				TempDepCoef = HA_MX + HA_OC + MCp_Total;
-				TempIndCoef = ConvGains + HAT_MX + HAT_OC + MCpT_Total;
+				CalcUCSDUETempDepCoef = HA_MX + HA_OC + MCp_Total;
+				CalcUCSDUETempIndCoef = ConvGains + HAT_MX + HAT_OC + MCpT_Total;
 				{ auto const SELECT_CASE_var( ZoneAirSolutionAlgo );
 				if ( SELECT_CASE_var == Use3rdOrder ) {
 					ZTAveraged = ( TempHistTerm + ConvGains + HAT_MX + HAT_OC + MCpT_Total ) / ( ( 11.0 / 6.0 ) * AirCap + HA_MX + HA_OC + MCp_Total );
 				} else if ( SELECT_CASE_var == UseAnalyticalSolution ) {
-					if ( TempDepCoef == 0.0 ) { // B=0
-						ZTAveraged = ZoneT1( ZoneNum ) + TempIndCoef / AirCap;
+					if ( CalcUCSDUETempDepCoef == 0.0 ) { // B=0
+						ZTAveraged = ZoneT1( ZoneNum ) + CalcUCSDUETempIndCoef / AirCap;
 					} else {
-						ZTAveraged = ( ZoneT1( ZoneNum ) - TempIndCoef / TempDepCoef ) * std::exp( min( 700.0, - TempDepCoef / AirCap ) ) + TempIndCoef / TempDepCoef;
+						ZTAveraged = ( ZoneT1( ZoneNum ) - CalcUCSDUETempIndCoef / CalcUCSDUETempDepCoef ) * std::exp( min( 700.0, - CalcUCSDUETempDepCoef / AirCap ) ) + CalcUCSDUETempIndCoef / CalcUCSDUETempDepCoef;
 					}
 				} else if ( SELECT_CASE_var == UseEulerMethod ) {
-					ZTAveraged = ( AirCap * ZoneT1( ZoneNum ) + TempIndCoef ) / ( AirCap + TempDepCoef );
+					ZTAveraged = ( AirCap * ZoneT1( ZoneNum ) + CalcUCSDUETempIndCoef ) / ( AirCap + CalcUCSDUETempDepCoef );
 				}}
 				ZTOC( ZoneNum ) = ZTAveraged;
 				ZTMX( ZoneNum ) = ZTAveraged;
 				ZTFloor( ZoneNum ) = ZTAveraged;
 				HcUCSDUF( ZoneNum, HeightFrac );
-				TempDepCoef = HA_MX + HA_OC + MCp_Total;
-				TempIndCoef = ConvGains + HAT_MX + HAT_OC + MCpT_Total;
+				CalcUCSDUETempDepCoef = HA_MX + HA_OC + MCp_Total;
+				CalcUCSDUETempIndCoef = ConvGains + HAT_MX + HAT_OC + MCpT_Total;
 				{ auto const SELECT_CASE_var( ZoneAirSolutionAlgo );
 				if ( SELECT_CASE_var == Use3rdOrder ) {
 					ZTAveraged = ( TempHistTerm + ConvGains + HAT_MX + HAT_OC + MCpT_Total ) / ( ( 11.0 / 6.0 ) * AirCap + HA_MX + HA_OC + MCp_Total );
 				} else if ( SELECT_CASE_var == UseAnalyticalSolution ) {
-					if ( TempDepCoef == 0.0 ) { // B=0
-						ZTAveraged = ZoneT1( ZoneNum ) + TempIndCoef / AirCap;
+					if ( CalcUCSDUETempDepCoef == 0.0 ) { // B=0
+						ZTAveraged = ZoneT1( ZoneNum ) + CalcUCSDUETempIndCoef / AirCap;
 					} else {
-						ZTAveraged = ( ZoneT1( ZoneNum ) - TempIndCoef / TempDepCoef ) * std::exp( min( 700.0, - TempDepCoef / AirCap ) ) + TempIndCoef / TempDepCoef;
+						ZTAveraged = ( ZoneT1( ZoneNum ) - CalcUCSDUETempIndCoef / CalcUCSDUETempDepCoef ) * std::exp( min( 700.0, - CalcUCSDUETempDepCoef / AirCap ) ) + CalcUCSDUETempIndCoef / CalcUCSDUETempDepCoef;
 					}
 				} else if ( SELECT_CASE_var == UseEulerMethod ) {
-					ZTAveraged = ( AirCap * ZoneT1( ZoneNum ) + TempIndCoef ) / ( AirCap + TempDepCoef );
+					ZTAveraged = ( AirCap * ZoneT1( ZoneNum ) + CalcUCSDUETempIndCoef ) / ( AirCap + CalcUCSDUETempDepCoef );
 				}}
 				ZTOC( ZoneNum ) = ZTAveraged;
 				ZTMX( ZoneNum ) = ZTAveraged;
@@ -1783,7 +1839,7 @@ namespace UFADManager {
 		HeightOccupiedSubzoneAve = HeightTransition( ZoneNum ) / 2.0;
 		// Comfort temperature
 
-		if ( MIXFLAG ) {
+		if ( CalcUCSDUEMIXFLAG ) {
 			TCMF( ZoneNum ) = ZTAveraged;
 		} else {
 			if ( HeightComfort < HeightOccupiedSubzoneAve ) {
@@ -1799,7 +1855,7 @@ namespace UFADManager {
 
 		// Temperature at the thermostat/temperature control sensor
 
-		if ( MIXFLAG ) {
+		if ( CalcUCSDUEMIXFLAG ) {
 			TempTstatAir( ZoneNum ) = ZTAveraged;
 		} else {
 			if ( HeightThermostat < HeightOccupiedSubzoneAve ) {
@@ -1820,7 +1876,7 @@ namespace UFADManager {
 			AvgTempGrad( ZoneNum ) = 0.0;
 		}
 
-		if ( MIXFLAG ) {
+		if ( CalcUCSDUEMIXFLAG ) {
 			ZoneUFMixedFlag( ZoneNum ) = 1;
 			AirModel( ZoneNum ).SimAirModel = false;
 		} else {
@@ -1833,14 +1889,14 @@ namespace UFADManager {
 			Node( ZoneNodeNum ).Temp = ZTMX( ZoneNum );
 		}
 
-		if ( MIXFLAG ) {
+		if ( CalcUCSDUEMIXFLAG ) {
 			Phi( ZoneNum ) = 1.0;
 		} else {
 			Phi( ZoneNum ) = ( ZTOC( ZoneNum ) - ( TSupK - KelvinConv ) ) / ( ZTMX( ZoneNum ) - ( TSupK - KelvinConv ) );
 		}
 
 		// Mixed for reporting purposes
-		if ( ( MIXFLAG ) || ( ( ZTMX( ZoneNum ) - ZTOC( ZoneNum ) ) < TempDiffCritRep ) ) {
+		if ( ( CalcUCSDUEMIXFLAG ) || ( ( ZTMX( ZoneNum ) - ZTOC( ZoneNum ) ) < TempDiffCritRep ) ) {
 			ZoneUFMixedFlagRep( ZoneNum ) = 1.0;
 			HeightTransition( ZoneNum ) = 0.0;
 			AvgTempGrad( ZoneNum ) = 0.0;
@@ -87,6 +87,11 @@ namespace UFADManager {
 
 	// Functions
 
+	// Clears the global data in UFADManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	ManageUCSDUFModels(
 		int const ZoneNum, // index number for the specified zone
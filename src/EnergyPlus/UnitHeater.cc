@@ -163,6 +163,18 @@ namespace UnitHeater {
 		// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
 		bool InitUnitHeaterOneTimeFlag( true );
 		bool GetUnitHeaterInputFlag( true );
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool errFlag( false ); // interim error flag
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool MyPlantScanFlag;
+		Array1D_bool MyZoneEqFlag; // used to set up zone equipment availability managers
+		bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
+		bool SetMassFlowRateToZero( false ); // TRUE when mass flow rates need to be set to zero
+		int RefrigIndex( 0 );
+		int CoilWaterInletNode( 0 );
+		int CoilWaterOutletNode( 0 );
+		int CoilSteamInletNode( 0 );
+		int CoilSteamOutletNode( 0 );
 	}
 
 	bool HCoilOn; // TRUE if the heating coil (gas or electric especially) should be running
@@ -191,6 +203,18 @@ namespace UnitHeater {
 		UnitHeatNumericFields.deallocate();
 		InitUnitHeaterOneTimeFlag = true;
 		GetUnitHeaterInputFlag = true;
+		ErrorsFound = false;
+		errFlag = false;
+		MyEnvrnFlag.deallocate();
+		MyPlantScanFlag.deallocate();
+		MyZoneEqFlag.deallocate();
+		ZoneEquipmentListChecked = false;
+		SetMassFlowRateToZero = false;
+		RefrigIndex = 0;
+		CoilWaterInletNode = 0;
+		CoilWaterOutletNode = 0;
+		CoilSteamInletNode = 0;
+		CoilSteamOutletNode = 0;
 	}
 
 	void
@@ -346,11 +370,9 @@ namespace UnitHeater {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		int IOStatus; // Used in GetObjectItem
 		bool IsBlank; // TRUE if the name is blank
 		bool IsNotOK; // TRUE if there was a problem with a list name
-		static bool errFlag( false ); // interim error flag
 		int NumAlphas; // Number of Alphas for each GetObjectItem call
 		int NumNumbers; // Number of Numbers for each GetObjectItem call
 		int NumFields; // Total number of fields in object
@@ -691,10 +713,6 @@ namespace UnitHeater {
 		static std::string const RoutineName( "InitUnitHeater" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool MyPlantScanFlag;
-		static Array1D_bool MyZoneEqFlag; // used to set up zone equipment availability managers
-		static bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
 		int Loop;
 		int HotConNode; // hot water control node number in unit heater loop
 		int InNode; // inlet node number in unit heater loop
@@ -704,7 +722,6 @@ namespace UnitHeater {
 		Real64 SteamDensity;
 		Real64 rho; // local fluid density
 		bool errFlag;
-		static bool SetMassFlowRateToZero( false ); // TRUE when mass flow rates need to be set to zero
 		// FLOW:
 
 		// Do the one time initializations
@@ -905,11 +922,6 @@ namespace UnitHeater {
 		Real64 EnthSteamOutWet;
 		Real64 LatentHeatSteam;
 		Real64 SteamDensity;
-		static int RefrigIndex( 0 );
-		static int CoilWaterInletNode( 0 );
-		static int CoilWaterOutletNode( 0 );
-		static int CoilSteamInletNode( 0 );
-		static int CoilSteamOutletNode( 0 );
 		Real64 Cp; // local temporary for fluid specific heat
 		Real64 rho; // local temporary for fluid density
 		bool IsAutoSize; // Indicator to autosize
@@ -1434,7 +1446,7 @@ namespace UnitHeater {
 						if ( FirstHVACIteration ) Par( 2 ) = 1.0;
 						Par( 3 ) = double( UnitHeat( UnitHeatNum ).OpMode );
 						// Tolerance is in fraction of load, MaxIter = 30, SolFalg = # of iterations or error as appropriate
-						SolveRegulaFalsi( 0.001, MaxIter, SolFlag, PartLoadFrac, CalcUnitHeaterResidual, 0.0, 1.0, Par );
+						SolveRegulaFalsi( 0.001, MaxIter, SolFlag, PartLoadFrac, CalcUnitHeaterResidual, 0.0, 1.0, Par, "CalcUnitHeater" );
 					}
 				}
 
@@ -185,6 +185,27 @@ namespace UnitVentilator {
 	Array1D< UnitVentilatorData > UnitVent;
 	Array1D< UnitVentNumericFieldData > UnitVentNumericFields;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool errFlag( false ); // interim error flag
+		bool MyOneTimeFlag( true );
+		bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool MyPlantScanFlag;
+		Array1D_bool MyZoneEqFlag; // used to set up zone equipment availability managers
+		int RefrigIndex( 0 );
+		int CoilWaterInletNode( 0 );
+		int CoilWaterOutletNode( 0 );
+		int CoilSteamInletNode( 0 );
+		int CoilSteamOutletNode( 0 );
+		int DummyWaterIndex( 1 );
+	}
+
 	// Functions
 
 	void
@@ -199,6 +220,19 @@ namespace UnitVentilator {
 		CheckEquipName.deallocate();
 		UnitVent.deallocate();
 		UnitVentNumericFields.deallocate();
+		ErrorsFound = false;
+		errFlag = false;
+		MyOneTimeFlag = true;
+		ZoneEquipmentListChecked = false;
+		MyEnvrnFlag.deallocate();
+		MyPlantScanFlag.deallocate();
+		MyZoneEqFlag.deallocate();
+		RefrigIndex = 0;
+		CoilWaterInletNode = 0;
+		CoilWaterOutletNode = 0;
+		CoilSteamInletNode = 0;
+		CoilSteamOutletNode = 0;
+		DummyWaterIndex = 1;
 	}
 
 	void
@@ -360,7 +394,6 @@ namespace UnitVentilator {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		int IOStatus; // Used in GetObjectItem
 		bool IsBlank; // TRUE if the name is blank
 		bool IsNotOK; // TRUE if there was a problem with a list name
@@ -369,7 +402,6 @@ namespace UnitVentilator {
 		int NumNumbers; // Number of Numbers for each GetObjectItem call
 		int UnitVentNum; // Item to be "gotten"
 		bool IsValid; // Set for outside air node check
-		static bool errFlag( false ); // interim error flag
 		std::string cCoolingCoilType; // Cooling coil object type
 		std::string cHeatingCoilType; // Heating coil object type
 		int FanIndex; // index to fan used for flow checks
@@ -990,12 +1022,7 @@ namespace UnitVentilator {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int AirRelNode; // relief air node number in unit ventilator loop
 		int ColdConNode; // cold water control node number in unit ventilator loop
-		static bool MyOneTimeFlag( true );
-		static bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
 		int Loop;
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool MyPlantScanFlag;
-		static Array1D_bool MyZoneEqFlag; // used to set up zone equipment availability managers
 		int HotConNode; // hot water control node number in unit ventilator loop
 		int InNode; // inlet node number in unit ventilator loop
 		int OutNode; // outlet node number in unit ventilator loop
@@ -1291,16 +1318,10 @@ namespace UnitVentilator {
 		Real64 EnthSteamOutWet;
 		Real64 LatentHeatSteam;
 		Real64 SteamDensity;
-		static int RefrigIndex( 0 );
-		static int CoilWaterInletNode( 0 );
-		static int CoilWaterOutletNode( 0 );
-		static int CoilSteamInletNode( 0 );
-		static int CoilSteamOutletNode( 0 );
 		std::string CoolingCoilName;
 		std::string CoolingCoilType;
 		Real64 rho;
 		Real64 Cp;
-		static int DummyWaterIndex( 1 );
 		bool IsAutoSize; // Index to autosize
 		Real64 MaxAirVolFlowDes; // Autosized maximum air flow for reporting
 		Real64 MaxAirVolFlowUser; // Hardsized maximum air flow for reporting
@@ -2404,7 +2425,7 @@ namespace UnitVentilator {
 								if ( FirstHVACIteration ) Par( 2 ) = 1.0;
 								Par( 3 ) = double( OpMode );
 								// Tolerance is in fraction of load, MaxIter = 30, SolFalg = # of iterations or error as appropriate
-								SolveRegulaFalsi( 0.001, MaxIter, SolFlag, PartLoadFrac, CalcUnitVentilatorResidual, 0.0, 1.0, Par );
+								SolveRegulaFalsi( 0.001, MaxIter, SolFlag, PartLoadFrac, CalcUnitVentilatorResidual, 0.0, 1.0, Par, "CalcUnitVentilator" );
 							}
 						}
 
@@ -2608,7 +2629,7 @@ namespace UnitVentilator {
 								if ( FirstHVACIteration ) Par( 2 ) = 1.0;
 								Par( 3 ) = double( OpMode );
 								// Tolerance is in fraction of load, MaxIter = 30, SolFalg = # of iterations or error as appropriate
-								SolveRegulaFalsi( 0.001, MaxIter, SolFlag, PartLoadFrac, CalcUnitVentilatorResidual, 0.0, 1.0, Par );
+								SolveRegulaFalsi( 0.001, MaxIter, SolFlag, PartLoadFrac, CalcUnitVentilatorResidual, 0.0, 1.0, Par, "CalcUnitVentilator" );
 							}
 						}
 						CalcUnitVentilatorComponents( UnitVentNum, FirstHVACIteration, QUnitOut, OpMode, PartLoadFrac );
@@ -148,8 +148,64 @@ namespace UserDefinedComponents {
 	Array1D< UserZoneHVACForcedAirComponentStruct > UserZoneAirHVAC;
 	Array1D< UserAirTerminalComponentStruct > UserAirTerminal;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetUserDefinedComponentsErrorsFound( false );
+		int MaxNumAlphas( 0 ); // argument for call to GetObjectDefMaxArgs
+		int MaxNumNumbers( 0 ); // argument for call to GetObjectDefMaxArgs
+		int TotalArgs( 0 ); // argument for call to GetObjectDefMaxArgs
+		bool lDummy; //Fix Changed to static: Passed to SetupEMSActuator as source of persistent Reference
+		bool MyOneTimeFlag( true ); // one time flag
+		Array1D_bool MyEnvrnFlag; // environment flag
+		Array1D_bool MyFlag;
+		bool InitCoilUserDefinedMyOneTimeFlag( true ); // one time flag
+		Array1D_bool InitCoilUserDefinedMyFlag;
+		bool InitZoneAirUserDefinedMyOneTimeFlag( true ); // one time flag
+		Array1D_bool InitZoneAirUserDefinedMyFlag;
+		bool InitAirTerminalUserDefinedMyOneTimeFlag( true ); // one time flag
+		Array1D_bool InitAirTerminalUserDefinedMyFlag;
+	}
+
 	// Functions
 
+	// Clears the global data in UserDefinedComponents.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumUserPlantComps = 0;
+		NumUserCoils = 0;
+		NumUserZoneAir = 0;
+		NumUserAirTerminals = 0;
+		CheckUserPlantCompName.deallocate();
+		CheckUserCoilName.deallocate();
+		CheckUserZoneAirName.deallocate();
+		CheckUserAirTerminal.deallocate();
+		GetInput = true;
+		UserPlantComp.deallocate();
+		UserCoil.deallocate();
+		UserZoneAirHVAC.deallocate();
+		UserAirTerminal.deallocate();
+		GetUserDefinedComponentsErrorsFound = false;
+		MaxNumAlphas = 0;
+		MaxNumNumbers = 0;
+		TotalArgs = 0;
+		lDummy = false;
+		MyOneTimeFlag = true;
+		MyEnvrnFlag.deallocate();
+		MyFlag.deallocate();
+		InitCoilUserDefinedMyOneTimeFlag = true;
+		InitCoilUserDefinedMyFlag.deallocate();
+		InitZoneAirUserDefinedMyOneTimeFlag = true;
+		InitZoneAirUserDefinedMyFlag.deallocate();
+		InitAirTerminalUserDefinedMyOneTimeFlag = true;
+		InitAirTerminalUserDefinedMyFlag.deallocate();
+	}
+
 	void
 	SimUserDefinedPlantComponent(
 		int const LoopNum, // plant loop sim call originated from
@@ -672,15 +728,11 @@ namespace UserDefinedComponents {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false );
 		int NumAlphas; // Number of elements in the alpha array
 		int NumNums; // Number of elements in the numeric array
 		int IOStat; // IO Status when calling get input subroutine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
-		static int MaxNumAlphas( 0 ); // argument for call to GetObjectDefMaxArgs
-		static int MaxNumNumbers( 0 ); // argument for call to GetObjectDefMaxArgs
-		static int TotalArgs( 0 ); // argument for call to GetObjectDefMaxArgs
 		Array1D_string cAlphaFieldNames;
 		Array1D_string cNumericFieldNames;
 		Array1D_bool lNumericFieldBlanks;
@@ -695,7 +747,6 @@ namespace UserDefinedComponents {
 		std::string LoopStr;
 		int aArgCount;
 		int StackMngrNum;
-		static bool lDummy; //Fix Changed to static: Passed to SetupEMSActuator as source of persistent Reference
 		//  INTEGER  :: alphaNum
 		//  INTEGER  :: Loop
 		int MgrCountTest;
@@ -728,7 +779,7 @@ namespace UserDefinedComponents {
 				IsBlank = false;
 				VerifyName( cAlphaArgs( 1 ), UserPlantComp, CompLoop - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetUserDefinedComponentsErrorsFound = true;
 					if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 				}
 				UserPlantComp( CompLoop ).Name = cAlphaArgs( 1 );
@@ -742,7 +793,7 @@ namespace UserDefinedComponents {
 						ShowSevereError( "Invalid " + cAlphaFieldNames( 2 ) + '=' + cAlphaArgs( 2 ) );
 						ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
 						ShowContinueError( "Program Manager Name not found." );
-						ErrorsFound = true;
+						GetUserDefinedComponentsErrorsFound = true;
 					}
 				}
 
@@ -754,8 +805,8 @@ namespace UserDefinedComponents {
 					for ( ConnectionLoop = 1; ConnectionLoop <= NumPlantConnections; ++ConnectionLoop ) {
 						LoopStr = RoundSigDigits( ConnectionLoop );
 						aArgCount = ( ConnectionLoop - 1 ) * 6 + 3;
-						UserPlantComp( CompLoop ).Loop( ConnectionLoop ).InletNodeNum = GetOnlySingleNode( cAlphaArgs( aArgCount ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, ConnectionLoop, ObjectIsNotParent );
-						UserPlantComp( CompLoop ).Loop( ConnectionLoop ).OutletNodeNum = GetOnlySingleNode( cAlphaArgs( aArgCount + 1 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, ConnectionLoop, ObjectIsNotParent );
+						UserPlantComp( CompLoop ).Loop( ConnectionLoop ).InletNodeNum = GetOnlySingleNode( cAlphaArgs( aArgCount ), GetUserDefinedComponentsErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, ConnectionLoop, ObjectIsNotParent );
+						UserPlantComp( CompLoop ).Loop( ConnectionLoop ).OutletNodeNum = GetOnlySingleNode( cAlphaArgs( aArgCount + 1 ), GetUserDefinedComponentsErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, ConnectionLoop, ObjectIsNotParent );
 
 						TestCompSet( cCurrentModuleObject, cAlphaArgs( 1 ), cAlphaArgs( aArgCount ), cAlphaArgs( aArgCount + 1 ), "Plant Nodes " + LoopStr );
 
@@ -794,7 +845,7 @@ namespace UserDefinedComponents {
 								ShowSevereError( "Invalid " + cAlphaFieldNames( aArgCount + 4 ) + '=' + cAlphaArgs( aArgCount + 4 ) );
 								ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
 								ShowContinueError( "Program Manager Name not found." );
-								ErrorsFound = true;
+								GetUserDefinedComponentsErrorsFound = true;
 							}
 						}
 
@@ -807,7 +858,7 @@ namespace UserDefinedComponents {
 								ShowSevereError( "Invalid " + cAlphaFieldNames( aArgCount + 4 ) + '=' + cAlphaArgs( aArgCount + 4 ) );
 								ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
 								ShowContinueError( "Program Manager Name not found." );
-								ErrorsFound = true;
+								GetUserDefinedComponentsErrorsFound = true;
 							}
 						}
 						//Setup Internal Variables
@@ -833,7 +884,7 @@ namespace UserDefinedComponents {
 				}
 
 				if ( ! lAlphaFieldBlanks( 27 ) ) {
-					UserPlantComp( CompLoop ).Air.InletNodeNum = GetOnlySingleNode( cAlphaArgs( 27 ), ErrorsFound, cCurrentModuleObject, UserPlantComp( CompLoop ).Name, NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsNotParent );
+					UserPlantComp( CompLoop ).Air.InletNodeNum = GetOnlySingleNode( cAlphaArgs( 27 ), GetUserDefinedComponentsErrorsFound, cCurrentModuleObject, UserPlantComp( CompLoop ).Name, NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsNotParent );
 					//model input related internal variables
 					SetupEMSInternalVariable( "Inlet Temperature for Air Connection", UserPlantComp( CompLoop ).Name, "[C]", UserPlantComp( CompLoop ).Air.InletTemp );
 					SetupEMSInternalVariable( "Inlet Mass Flow Rate for Air Connection", UserPlantComp( CompLoop ).Name, "[kg/s]", UserPlantComp( CompLoop ).Air.InletMassFlowRate );
@@ -843,7 +894,7 @@ namespace UserDefinedComponents {
 				}
 
 				if ( ! lAlphaFieldBlanks( 28 ) ) {
-					UserPlantComp( CompLoop ).Air.OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 28 ), ErrorsFound, cCurrentModuleObject, UserPlantComp( CompLoop ).Name, NodeType_Air, NodeConnectionType_ReliefAir, 1, ObjectIsNotParent );
+					UserPlantComp( CompLoop ).Air.OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 28 ), GetUserDefinedComponentsErrorsFound, cCurrentModuleObject, UserPlantComp( CompLoop ).Name, NodeType_Air, NodeConnectionType_ReliefAir, 1, ObjectIsNotParent );
 					//outlet air node results
 					SetupEMSActuator( "Air Connection", UserPlantComp( CompLoop ).Name, "Outlet Temperature", "[C]", lDummy, UserPlantComp( CompLoop ).Air.OutletTemp );
 					SetupEMSActuator( "Air Connection", UserPlantComp( CompLoop ).Name, "Outlet Humidity Ratio", "[kgWater/kgDryAir]", lDummy, UserPlantComp( CompLoop ).Air.OutletHumRat );
@@ -851,14 +902,14 @@ namespace UserDefinedComponents {
 				}
 
 				if ( ! lAlphaFieldBlanks( 29 ) ) {
-					SetupTankDemandComponent( cAlphaArgs( 1 ), cCurrentModuleObject, cAlphaArgs( 29 ), ErrorsFound, UserPlantComp( CompLoop ).Water.SupplyTankID, UserPlantComp( CompLoop ).Water.SupplyTankDemandARRID );
+					SetupTankDemandComponent( cAlphaArgs( 1 ), cCurrentModuleObject, cAlphaArgs( 29 ), GetUserDefinedComponentsErrorsFound, UserPlantComp( CompLoop ).Water.SupplyTankID, UserPlantComp( CompLoop ).Water.SupplyTankDemandARRID );
 
 					UserPlantComp( CompLoop ).Water.SuppliedByWaterSystem = true;
 					SetupEMSActuator( "Water System", UserPlantComp( CompLoop ).Name, "Supplied Volume Flow Rate", "[m3/s]", lDummy, UserPlantComp( CompLoop ).Water.SupplyVdotRequest );
 				}
 
 				if ( ! lAlphaFieldBlanks( 30 ) ) {
-					SetupTankSupplyComponent( cAlphaArgs( 1 ), cCurrentModuleObject, cAlphaArgs( 30 ), ErrorsFound, UserPlantComp( CompLoop ).Water.CollectionTankID, UserPlantComp( CompLoop ).Water.CollectionTankSupplyARRID );
+					SetupTankSupplyComponent( cAlphaArgs( 1 ), cCurrentModuleObject, cAlphaArgs( 30 ), GetUserDefinedComponentsErrorsFound, UserPlantComp( CompLoop ).Water.CollectionTankID, UserPlantComp( CompLoop ).Water.CollectionTankSupplyARRID );
 					UserPlantComp( CompLoop ).Water.CollectsToWaterSystem = true;
 					SetupEMSActuator( "Water System", UserPlantComp( CompLoop ).Name, "Collected Volume Flow Rate", "[m3/s]", lDummy, UserPlantComp( CompLoop ).Water.CollectedVdot );
 				}
@@ -868,7 +919,7 @@ namespace UserDefinedComponents {
 					UserPlantComp( CompLoop ).Zone.ZoneNum = FindItemInList( cAlphaArgs( 31 ), Zone );
 					if ( UserPlantComp( CompLoop ).Zone.ZoneNum == 0 ) {
 						ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Ambient Zone Name not found = " + cAlphaArgs( 31 ) );
-						ErrorsFound = true;
+						GetUserDefinedComponentsErrorsFound = true;
 					} else {
 						UserPlantComp( CompLoop ).Zone.DeviceHasInternalGains = true;
 						SetupZoneInternalGain( UserPlantComp( CompLoop ).Zone.ZoneNum, cCurrentModuleObject, cAlphaArgs( 1 ), IntGainTypeOf_PlantComponentUserDefined, UserPlantComp( CompLoop ).Zone.ConvectionGainRate, UserPlantComp( CompLoop ).Zone.ReturnAirConvectionGainRate, UserPlantComp( CompLoop ).Zone.ThermalRadiationGainRate, UserPlantComp( CompLoop ).Zone.LatentGainRate, UserPlantComp( CompLoop ).Zone.ReturnAirLatentGainRate, UserPlantComp( CompLoop ).Zone.CarbonDioxideGainRate, UserPlantComp( CompLoop ).Zone.GenericContamGainRate );
@@ -893,13 +944,13 @@ namespace UserDefinedComponents {
 				if ( MgrCountTest == 0 ) {
 					ShowSevereError( "Invalid " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
 					ShowContinueError( "At least one program calling manager is needed." );
-					ErrorsFound = true;
+					GetUserDefinedComponentsErrorsFound = true;
 				}
 
 			}
 		} //NumUserPlantComps > 0
 
-		if ( ErrorsFound ) {
+		if ( GetUserDefinedComponentsErrorsFound ) {
 			ShowFatalError( "GetUserDefinedComponents: Errors found in processing " + cCurrentModuleObject + " input." );
 		}
 
@@ -914,12 +965,12 @@ namespace UserDefinedComponents {
 				IsBlank = false;
 				VerifyName( cAlphaArgs( 1 ), UserCoil, CompLoop - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetUserDefinedComponentsErrorsFound = true;
 					if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 				}
 				VerifyUniqueCoilName( cCurrentModuleObject, cAlphaArgs( 1 ), errFlag, cCurrentModuleObject + " Name" );
 				if ( errFlag ) {
-					ErrorsFound = true;
+					GetUserDefinedComponentsErrorsFound = true;
 				}
 				UserCoil( CompLoop ).Name = cAlphaArgs( 1 );
 
@@ -932,7 +983,7 @@ namespace UserDefinedComponents {
 						ShowSevereError( "Invalid " + cAlphaFieldNames( 2 ) + '=' + cAlphaArgs( 2 ) );
 						ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
 						ShowContinueError( "Program Manager Name not found." );
-						ErrorsFound = true;
+						GetUserDefinedComponentsErrorsFound = true;
 					}
 				}
 
@@ -945,7 +996,7 @@ namespace UserDefinedComponents {
 						ShowSevereError( "Invalid " + cAlphaFieldNames( 3 ) + '=' + cAlphaArgs( 3 ) );
 						ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
 						ShowContinueError( "Program Manager Name not found." );
-						ErrorsFound = true;
+						GetUserDefinedComponentsErrorsFound = true;
 					}
 				}
 
@@ -955,7 +1006,7 @@ namespace UserDefinedComponents {
 					UserCoil( CompLoop ).NumAirConnections = NumAirConnections;
 					for ( ConnectionLoop = 1; ConnectionLoop <= NumAirConnections; ++ConnectionLoop ) {
 						aArgCount = ( ConnectionLoop - 1 ) * 2 + 4;
-						UserCoil( CompLoop ).Air( ConnectionLoop ).InletNodeNum = GetOnlySingleNode( cAlphaArgs( aArgCount ), ErrorsFound, cCurrentModuleObject, UserCoil( CompLoop ).Name, NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+						UserCoil( CompLoop ).Air( ConnectionLoop ).InletNodeNum = GetOnlySingleNode( cAlphaArgs( aArgCount ), GetUserDefinedComponentsErrorsFound, cCurrentModuleObject, UserCoil( CompLoop ).Name, NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
 
 						LoopStr = RoundSigDigits( ConnectionLoop );
 						//model input related internal variables
@@ -965,7 +1016,7 @@ namespace UserDefinedComponents {
 						SetupEMSInternalVariable( "Inlet Density for Air Connection " + LoopStr, UserCoil( CompLoop ).Name, "[kg/m3]", UserCoil( CompLoop ).Air( ConnectionLoop ).InletRho );
 						SetupEMSInternalVariable( "Inlet Specific Heat for Air Connection " + LoopStr, UserCoil( CompLoop ).Name, "[J/kg-C]", UserCoil( CompLoop ).Air( ConnectionLoop ).InletCp );
 
-						UserCoil( CompLoop ).Air( ConnectionLoop ).OutletNodeNum = GetOnlySingleNode( cAlphaArgs( aArgCount + 1 ), ErrorsFound, cCurrentModuleObject, UserCoil( CompLoop ).Name, NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+						UserCoil( CompLoop ).Air( ConnectionLoop ).OutletNodeNum = GetOnlySingleNode( cAlphaArgs( aArgCount + 1 ), GetUserDefinedComponentsErrorsFound, cCurrentModuleObject, UserCoil( CompLoop ).Name, NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 						SetupEMSActuator( "Air Connection " + LoopStr, UserCoil( CompLoop ).Name, "Outlet Temperature", "[C]", lDummy, UserCoil( CompLoop ).Air( ConnectionLoop ).OutletTemp );
 						SetupEMSActuator( "Air Connection " + LoopStr, UserCoil( CompLoop ).Name, "Outlet Humidity Ratio", "[kgWater/kgDryAir]", lDummy, UserCoil( CompLoop ).Air( ConnectionLoop ).OutletHumRat );
 						SetupEMSActuator( "Air Connection " + LoopStr, UserCoil( CompLoop ).Name, "Mass Flow Rate", "[kg/s]", lDummy, UserCoil( CompLoop ).Air( ConnectionLoop ).OutletMassFlowRate );
@@ -988,8 +1039,8 @@ namespace UserDefinedComponents {
 					}
 
 					if ( UserCoil( CompLoop ).PlantIsConnected ) { // get input
-						UserCoil( CompLoop ).Loop.InletNodeNum = GetOnlySingleNode( cAlphaArgs( 9 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
-						UserCoil( CompLoop ).Loop.OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 10 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+						UserCoil( CompLoop ).Loop.InletNodeNum = GetOnlySingleNode( cAlphaArgs( 9 ), GetUserDefinedComponentsErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+						UserCoil( CompLoop ).Loop.OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 10 ), GetUserDefinedComponentsErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
 
 						TestCompSet( cCurrentModuleObject, cAlphaArgs( 1 ), cAlphaArgs( 9 ), cAlphaArgs( 10 ), "Plant Nodes" );
 
@@ -1015,14 +1066,14 @@ namespace UserDefinedComponents {
 					}
 
 					if ( ! lAlphaFieldBlanks( 11 ) ) {
-						SetupTankDemandComponent( cAlphaArgs( 1 ), cCurrentModuleObject, cAlphaArgs( 11 ), ErrorsFound, UserCoil( CompLoop ).Water.SupplyTankID, UserCoil( CompLoop ).Water.SupplyTankDemandARRID );
+						SetupTankDemandComponent( cAlphaArgs( 1 ), cCurrentModuleObject, cAlphaArgs( 11 ), GetUserDefinedComponentsErrorsFound, UserCoil( CompLoop ).Water.SupplyTankID, UserCoil( CompLoop ).Water.SupplyTankDemandARRID );
 
 						UserCoil( CompLoop ).Water.SuppliedByWaterSystem = true;
 						SetupEMSActuator( "Water System", UserCoil( CompLoop ).Name, "Supplied Volume Flow Rate", "[m3/s]", lDummy, UserCoil( CompLoop ).Water.SupplyVdotRequest );
 					}
 
 					if ( ! lAlphaFieldBlanks( 12 ) ) {
-						SetupTankSupplyComponent( cAlphaArgs( 1 ), cCurrentModuleObject, cAlphaArgs( 12 ), ErrorsFound, UserCoil( CompLoop ).Water.CollectionTankID, UserCoil( CompLoop ).Water.CollectionTankSupplyARRID );
+						SetupTankSupplyComponent( cAlphaArgs( 1 ), cCurrentModuleObject, cAlphaArgs( 12 ), GetUserDefinedComponentsErrorsFound, UserCoil( CompLoop ).Water.CollectionTankID, UserCoil( CompLoop ).Water.CollectionTankSupplyARRID );
 						UserCoil( CompLoop ).Water.CollectsToWaterSystem = true;
 						SetupEMSActuator( "Water System", UserCoil( CompLoop ).Name, "Collected Volume Flow Rate", "[m3/s]", lDummy, UserCoil( CompLoop ).Water.CollectedVdot );
 					}
@@ -1032,7 +1083,7 @@ namespace UserDefinedComponents {
 						UserCoil( CompLoop ).Zone.ZoneNum = FindItemInList( cAlphaArgs( 13 ), Zone );
 						if ( UserCoil( CompLoop ).Zone.ZoneNum == 0 ) {
 							ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Ambient Zone Name not found = " + cAlphaArgs( 13 ) );
-							ErrorsFound = true;
+							GetUserDefinedComponentsErrorsFound = true;
 						} else {
 							UserCoil( CompLoop ).Zone.DeviceHasInternalGains = true;
 							SetupZoneInternalGain( UserCoil( CompLoop ).Zone.ZoneNum, cCurrentModuleObject, cAlphaArgs( 1 ), IntGainTypeOf_CoilUserDefined, UserCoil( CompLoop ).Zone.ConvectionGainRate, UserCoil( CompLoop ).Zone.ReturnAirConvectionGainRate, UserCoil( CompLoop ).Zone.ThermalRadiationGainRate, UserCoil( CompLoop ).Zone.LatentGainRate, UserCoil( CompLoop ).Zone.ReturnAirLatentGainRate, UserCoil( CompLoop ).Zone.CarbonDioxideGainRate, UserCoil( CompLoop ).Zone.GenericContamGainRate );
@@ -1052,7 +1103,7 @@ namespace UserDefinedComponents {
 
 		} //NumUserCoils > 0
 
-		if ( ErrorsFound ) {
+		if ( GetUserDefinedComponentsErrorsFound ) {
 			ShowFatalError( "GetUserDefinedComponents: Errors found in processing " + cCurrentModuleObject + " input." );
 		}
 
@@ -1067,7 +1118,7 @@ namespace UserDefinedComponents {
 				IsBlank = false;
 				VerifyName( cAlphaArgs( 1 ), UserZoneAirHVAC, CompLoop - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetUserDefinedComponentsErrorsFound = true;
 					if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 				}
 				UserZoneAirHVAC( CompLoop ).Name = cAlphaArgs( 1 );
@@ -1081,7 +1132,7 @@ namespace UserDefinedComponents {
 						ShowSevereError( "Invalid " + cAlphaFieldNames( 2 ) + '=' + cAlphaArgs( 2 ) );
 						ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
 						ShowContinueError( "Program Manager Name not found." );
-						ErrorsFound = true;
+						GetUserDefinedComponentsErrorsFound = true;
 					}
 				}
 
@@ -1094,11 +1145,11 @@ namespace UserDefinedComponents {
 						ShowSevereError( "Invalid " + cAlphaFieldNames( 3 ) + '=' + cAlphaArgs( 3 ) );
 						ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
 						ShowContinueError( "Program Manager Name not found." );
-						ErrorsFound = true;
+						GetUserDefinedComponentsErrorsFound = true;
 					}
 				}
 
-				UserZoneAirHVAC( CompLoop ).ZoneAir.InletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), ErrorsFound, cCurrentModuleObject, UserZoneAirHVAC( CompLoop ).Name, NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+				UserZoneAirHVAC( CompLoop ).ZoneAir.InletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), GetUserDefinedComponentsErrorsFound, cCurrentModuleObject, UserZoneAirHVAC( CompLoop ).Name, NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
 				//model input related internal variables
 				SetupEMSInternalVariable( "Inlet Temperature for Primary Air Connection", UserZoneAirHVAC( CompLoop ).Name, "[C]", UserZoneAirHVAC( CompLoop ).ZoneAir.InletTemp );
 				SetupEMSInternalVariable( "Inlet Humidity Ratio for Primary Air Connection", UserZoneAirHVAC( CompLoop ).Name, "[kgWater/kgDryAir]", UserZoneAirHVAC( CompLoop ).ZoneAir.InletHumRat );
@@ -1111,13 +1162,13 @@ namespace UserDefinedComponents {
 				SetupEMSInternalVariable( "Remaining Latent Load to Dehumidifying Setpoint", UserZoneAirHVAC( CompLoop ).Name, "[kg/s]", UserZoneAirHVAC( CompLoop ).RemainingOutputReqToDehumidSP );
 
 				SetupEMSActuator( "Primary Air Connection", UserZoneAirHVAC( CompLoop ).Name, "Inlet Mass Flow Rate", "[kg/s]", lDummy, UserZoneAirHVAC( CompLoop ).ZoneAir.InletMassFlowRate );
-				UserZoneAirHVAC( CompLoop ).ZoneAir.OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), ErrorsFound, cCurrentModuleObject, UserZoneAirHVAC( CompLoop ).Name, NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+				UserZoneAirHVAC( CompLoop ).ZoneAir.OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), GetUserDefinedComponentsErrorsFound, cCurrentModuleObject, UserZoneAirHVAC( CompLoop ).Name, NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 				SetupEMSActuator( "Primary Air Connection", UserZoneAirHVAC( CompLoop ).Name, "Outlet Temperature", "[C]", lDummy, UserZoneAirHVAC( CompLoop ).ZoneAir.OutletTemp );
 				SetupEMSActuator( "Primary Air Connection", UserZoneAirHVAC( CompLoop ).Name, "Outlet Humidity Ratio", "[kgWater/kgDryAir]", lDummy, UserZoneAirHVAC( CompLoop ).ZoneAir.OutletHumRat );
 				SetupEMSActuator( "Primary Air Connection", UserZoneAirHVAC( CompLoop ).Name, "Outlet Mass Flow Rate", "[kg/s]", lDummy, UserZoneAirHVAC( CompLoop ).ZoneAir.OutletMassFlowRate );
 
 				if ( ! lAlphaFieldBlanks( 6 ) ) {
-					UserZoneAirHVAC( CompLoop ).SourceAir.InletNodeNum = GetOnlySingleNode( cAlphaArgs( 6 ), ErrorsFound, cCurrentModuleObject, UserZoneAirHVAC( CompLoop ).Name, NodeType_Air, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+					UserZoneAirHVAC( CompLoop ).SourceAir.InletNodeNum = GetOnlySingleNode( cAlphaArgs( 6 ), GetUserDefinedComponentsErrorsFound, cCurrentModuleObject, UserZoneAirHVAC( CompLoop ).Name, NodeType_Air, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
 					//model input related internal variables
 					SetupEMSInternalVariable( "Inlet Temperature for Secondary Air Connection", UserZoneAirHVAC( CompLoop ).Name, "[C]", UserZoneAirHVAC( CompLoop ).SourceAir.InletTemp );
 
@@ -1128,7 +1179,7 @@ namespace UserDefinedComponents {
 				}
 
 				if ( ! lAlphaFieldBlanks( 7 ) ) {
-					UserZoneAirHVAC( CompLoop ).SourceAir.OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 7 ), ErrorsFound, cCurrentModuleObject, UserZoneAirHVAC( CompLoop ).Name, NodeType_Air, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+					UserZoneAirHVAC( CompLoop ).SourceAir.OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 7 ), GetUserDefinedComponentsErrorsFound, cCurrentModuleObject, UserZoneAirHVAC( CompLoop ).Name, NodeType_Air, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
 					SetupEMSActuator( "Secondary Air Connection", UserZoneAirHVAC( CompLoop ).Name, "Outlet Temperature", "[C]", lDummy, UserZoneAirHVAC( CompLoop ).SourceAir.OutletTemp );
 					SetupEMSActuator( "Secondary Air Connection", UserZoneAirHVAC( CompLoop ).Name, "Outlet Humidity Ratio", "[kgWater/kgDryAir]", lDummy, UserZoneAirHVAC( CompLoop ).SourceAir.OutletHumRat );
 					SetupEMSActuator( "Secondary Air Connection", UserZoneAirHVAC( CompLoop ).Name, "Mass Flow Rate", "[kg/s]", lDummy, UserZoneAirHVAC( CompLoop ).SourceAir.OutletMassFlowRate );
@@ -1144,8 +1195,8 @@ namespace UserDefinedComponents {
 					UserZoneAirHVAC( CompLoop ).Loop.allocate( NumPlantConnections );
 					for ( ConnectionLoop = 1; ConnectionLoop <= NumPlantConnections; ++ConnectionLoop ) {
 						aArgCount = ( ConnectionLoop - 1 ) * 2 + 8;
-						UserZoneAirHVAC( CompLoop ).Loop( ConnectionLoop ).InletNodeNum = GetOnlySingleNode( cAlphaArgs( aArgCount ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, ( ConnectionLoop + 2 ), ObjectIsNotParent );
-						UserZoneAirHVAC( CompLoop ).Loop( ConnectionLoop ).OutletNodeNum = GetOnlySingleNode( cAlphaArgs( aArgCount + 1 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, ( ConnectionLoop + 2 ), ObjectIsNotParent );
+						UserZoneAirHVAC( CompLoop ).Loop( ConnectionLoop ).InletNodeNum = GetOnlySingleNode( cAlphaArgs( aArgCount ), GetUserDefinedComponentsErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, ( ConnectionLoop + 2 ), ObjectIsNotParent );
+						UserZoneAirHVAC( CompLoop ).Loop( ConnectionLoop ).OutletNodeNum = GetOnlySingleNode( cAlphaArgs( aArgCount + 1 ), GetUserDefinedComponentsErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, ( ConnectionLoop + 2 ), ObjectIsNotParent );
 						TestCompSet( cCurrentModuleObject, cAlphaArgs( 1 ), cAlphaArgs( aArgCount ), cAlphaArgs( aArgCount + 1 ), "Plant Nodes" );
 						UserZoneAirHVAC( CompLoop ).Loop( ConnectionLoop ).HowLoadServed = HowMet_NoneDemand;
 						UserZoneAirHVAC( CompLoop ).Loop( ConnectionLoop ).FlowPriority = LoopFlowStatus_NeedyAndTurnsLoopOn;
@@ -1169,14 +1220,14 @@ namespace UserDefinedComponents {
 				}
 
 				if ( ! lAlphaFieldBlanks( 14 ) ) {
-					SetupTankDemandComponent( cAlphaArgs( 1 ), cCurrentModuleObject, cAlphaArgs( 14 ), ErrorsFound, UserZoneAirHVAC( CompLoop ).Water.SupplyTankID, UserZoneAirHVAC( CompLoop ).Water.SupplyTankDemandARRID );
+					SetupTankDemandComponent( cAlphaArgs( 1 ), cCurrentModuleObject, cAlphaArgs( 14 ), GetUserDefinedComponentsErrorsFound, UserZoneAirHVAC( CompLoop ).Water.SupplyTankID, UserZoneAirHVAC( CompLoop ).Water.SupplyTankDemandARRID );
 
 					UserZoneAirHVAC( CompLoop ).Water.SuppliedByWaterSystem = true;
 					SetupEMSActuator( "Water System", UserZoneAirHVAC( CompLoop ).Name, "Supplied Volume Flow Rate", "[m3/s]", lDummy, UserZoneAirHVAC( CompLoop ).Water.SupplyVdotRequest );
 				}
 
 				if ( ! lAlphaFieldBlanks( 15 ) ) {
-					SetupTankSupplyComponent( cAlphaArgs( 1 ), cCurrentModuleObject, cAlphaArgs( 15 ), ErrorsFound, UserZoneAirHVAC( CompLoop ).Water.CollectionTankID, UserZoneAirHVAC( CompLoop ).Water.CollectionTankSupplyARRID );
+					SetupTankSupplyComponent( cAlphaArgs( 1 ), cCurrentModuleObject, cAlphaArgs( 15 ), GetUserDefinedComponentsErrorsFound, UserZoneAirHVAC( CompLoop ).Water.CollectionTankID, UserZoneAirHVAC( CompLoop ).Water.CollectionTankSupplyARRID );
 					UserZoneAirHVAC( CompLoop ).Water.CollectsToWaterSystem = true;
 					SetupEMSActuator( "Water System", UserZoneAirHVAC( CompLoop ).Name, "Collected Volume Flow Rate", "[m3/s]", lDummy, UserZoneAirHVAC( CompLoop ).Water.CollectedVdot );
 				}
@@ -1186,7 +1237,7 @@ namespace UserDefinedComponents {
 					UserZoneAirHVAC( CompLoop ).Zone.ZoneNum = FindItemInList( cAlphaArgs( 16 ), Zone );
 					if ( UserZoneAirHVAC( CompLoop ).Zone.ZoneNum == 0 ) {
 						ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Ambient Zone Name not found = " + cAlphaArgs( 16 ) );
-						ErrorsFound = true;
+						GetUserDefinedComponentsErrorsFound = true;
 					} else {
 						UserZoneAirHVAC( CompLoop ).Zone.DeviceHasInternalGains = true;
 						SetupZoneInternalGain( UserZoneAirHVAC( CompLoop ).Zone.ZoneNum, cCurrentModuleObject, cAlphaArgs( 1 ), IntGainTypeOf_ZoneHVACForcedAirUserDefined, UserZoneAirHVAC( CompLoop ).Zone.ConvectionGainRate, UserZoneAirHVAC( CompLoop ).Zone.ReturnAirConvectionGainRate, UserZoneAirHVAC( CompLoop ).Zone.ThermalRadiationGainRate, UserZoneAirHVAC( CompLoop ).Zone.LatentGainRate, UserZoneAirHVAC( CompLoop ).Zone.ReturnAirLatentGainRate, UserZoneAirHVAC( CompLoop ).Zone.CarbonDioxideGainRate, UserZoneAirHVAC( CompLoop ).Zone.GenericContamGainRate );
@@ -1204,7 +1255,7 @@ namespace UserDefinedComponents {
 			}
 		} //NumUserZoneAir > 0
 
-		if ( ErrorsFound ) {
+		if ( GetUserDefinedComponentsErrorsFound ) {
 			ShowFatalError( "GetUserDefinedComponents: Errors found in processing " + cCurrentModuleObject + " input." );
 		}
 
@@ -1219,7 +1270,7 @@ namespace UserDefinedComponents {
 				IsBlank = false;
 				VerifyName( cAlphaArgs( 1 ), UserAirTerminal, CompLoop - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 				if ( IsNotOK ) {
-					ErrorsFound = true;
+					GetUserDefinedComponentsErrorsFound = true;
 					if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 				}
 				UserAirTerminal( CompLoop ).Name = cAlphaArgs( 1 );
@@ -1233,7 +1284,7 @@ namespace UserDefinedComponents {
 						ShowSevereError( "Invalid " + cAlphaFieldNames( 2 ) + '=' + cAlphaArgs( 2 ) );
 						ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
 						ShowContinueError( "Program Manager Name not found." );
-						ErrorsFound = true;
+						GetUserDefinedComponentsErrorsFound = true;
 					}
 				}
 
@@ -1246,11 +1297,11 @@ namespace UserDefinedComponents {
 						ShowSevereError( "Invalid " + cAlphaFieldNames( 3 ) + '=' + cAlphaArgs( 3 ) );
 						ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
 						ShowContinueError( "Program Manager Name not found." );
-						ErrorsFound = true;
+						GetUserDefinedComponentsErrorsFound = true;
 					}
 				}
 
-				UserAirTerminal( CompLoop ).AirLoop.InletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), ErrorsFound, cCurrentModuleObject, UserAirTerminal( CompLoop ).Name, NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent, cAlphaFieldNames( 4 ) );
+				UserAirTerminal( CompLoop ).AirLoop.InletNodeNum = GetOnlySingleNode( cAlphaArgs( 4 ), GetUserDefinedComponentsErrorsFound, cCurrentModuleObject, UserAirTerminal( CompLoop ).Name, NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent, cAlphaFieldNames( 4 ) );
 				//model input related internal variables
 				SetupEMSInternalVariable( "Inlet Temperature for Primary Air Connection", UserAirTerminal( CompLoop ).Name, "[C]", UserAirTerminal( CompLoop ).AirLoop.InletTemp );
 				SetupEMSInternalVariable( "Inlet Humidity Ratio for Primary Air Connection", UserAirTerminal( CompLoop ).Name, "[kgWater/kgDryAir]", UserAirTerminal( CompLoop ).AirLoop.InletHumRat );
@@ -1263,7 +1314,7 @@ namespace UserDefinedComponents {
 				SetupEMSInternalVariable( "Remaining Latent Load to Dehumidifying Setpoint", UserAirTerminal( CompLoop ).Name, "[kg/s]", UserAirTerminal( CompLoop ).RemainingOutputReqToDehumidSP );
 
 				SetupEMSActuator( "Primary Air Connection", UserAirTerminal( CompLoop ).Name, "Inlet Mass Flow Rate", "[kg/s]", lDummy, UserAirTerminal( CompLoop ).AirLoop.InletMassFlowRate );
-				UserAirTerminal( CompLoop ).AirLoop.OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), ErrorsFound, cCurrentModuleObject, UserAirTerminal( CompLoop ).Name, NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent, cAlphaFieldNames( 5 ) );
+				UserAirTerminal( CompLoop ).AirLoop.OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 5 ), GetUserDefinedComponentsErrorsFound, cCurrentModuleObject, UserAirTerminal( CompLoop ).Name, NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent, cAlphaFieldNames( 5 ) );
 				SetupEMSActuator( "Primary Air Connection", UserAirTerminal( CompLoop ).Name, "Outlet Temperature", "[C]", lDummy, UserAirTerminal( CompLoop ).AirLoop.OutletTemp );
 				SetupEMSActuator( "Primary Air Connection", UserAirTerminal( CompLoop ).Name, "Outlet Humidity Ratio", "[kgWater/kgDryAir]", lDummy, UserAirTerminal( CompLoop ).AirLoop.OutletHumRat );
 				SetupEMSActuator( "Primary Air Connection", UserAirTerminal( CompLoop ).Name, "Outlet Mass Flow Rate", "[kg/s]", lDummy, UserAirTerminal( CompLoop ).AirLoop.OutletMassFlowRate );
@@ -1279,7 +1330,7 @@ namespace UserDefinedComponents {
 								ShowContinueError( NodeID( UserAirTerminal( CompLoop ).AirLoop.OutletNodeNum ) + " already connects to another zone" );
 								ShowContinueError( "Occurs for terminal unit " + cCurrentModuleObject + " = " + UserAirTerminal( CompLoop ).Name );
 								ShowContinueError( "Check terminal unit node names for errors" );
-								ErrorsFound = true;
+								GetUserDefinedComponentsErrorsFound = true;
 							} else {
 								ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).InNode = UserAirTerminal( CompLoop ).AirLoop.InletNodeNum;
 								ZoneEquipConfig( CtrlZone ).AirDistUnitCool( SupAirIn ).OutNode = UserAirTerminal( CompLoop ).AirLoop.OutletNodeNum;
@@ -1292,7 +1343,7 @@ namespace UserDefinedComponents {
 				}
 
 				if ( ! lAlphaFieldBlanks( 6 ) ) {
-					UserAirTerminal( CompLoop ).SourceAir.InletNodeNum = GetOnlySingleNode( cAlphaArgs( 6 ), ErrorsFound, cCurrentModuleObject, UserAirTerminal( CompLoop ).Name, NodeType_Air, NodeConnectionType_Inlet, 2, ObjectIsNotParent, cAlphaFieldNames( 6 ) );
+					UserAirTerminal( CompLoop ).SourceAir.InletNodeNum = GetOnlySingleNode( cAlphaArgs( 6 ), GetUserDefinedComponentsErrorsFound, cCurrentModuleObject, UserAirTerminal( CompLoop ).Name, NodeType_Air, NodeConnectionType_Inlet, 2, ObjectIsNotParent, cAlphaFieldNames( 6 ) );
 					//model input related internal variables
 					SetupEMSInternalVariable( "Inlet Temperature for Secondary Air Connection", UserAirTerminal( CompLoop ).Name, "[C]", UserAirTerminal( CompLoop ).SourceAir.InletTemp );
 
@@ -1303,7 +1354,7 @@ namespace UserDefinedComponents {
 				}
 
 				if ( ! lAlphaFieldBlanks( 7 ) ) {
-					UserAirTerminal( CompLoop ).SourceAir.OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 7 ), ErrorsFound, cCurrentModuleObject, UserAirTerminal( CompLoop ).Name, NodeType_Air, NodeConnectionType_Outlet, 2, ObjectIsNotParent, cAlphaFieldNames( 7 ) );
+					UserAirTerminal( CompLoop ).SourceAir.OutletNodeNum = GetOnlySingleNode( cAlphaArgs( 7 ), GetUserDefinedComponentsErrorsFound, cCurrentModuleObject, UserAirTerminal( CompLoop ).Name, NodeType_Air, NodeConnectionType_Outlet, 2, ObjectIsNotParent, cAlphaFieldNames( 7 ) );
 					SetupEMSActuator( "Secondary Air Connection", UserAirTerminal( CompLoop ).Name, "Outlet Temperature", "[C]", lDummy, UserAirTerminal( CompLoop ).SourceAir.OutletTemp );
 					SetupEMSActuator( "Secondary Air Connection", UserAirTerminal( CompLoop ).Name, "Outlet Humidity Ratio", "[kgWater/kgDryAir]", lDummy, UserAirTerminal( CompLoop ).SourceAir.OutletHumRat );
 					SetupEMSActuator( "Secondary Air Connection", UserAirTerminal( CompLoop ).Name, "Mass Flow Rate", "[kg/s]", lDummy, UserAirTerminal( CompLoop ).SourceAir.OutletMassFlowRate );
@@ -1319,8 +1370,8 @@ namespace UserDefinedComponents {
 					UserAirTerminal( CompLoop ).Loop.allocate( NumPlantConnections );
 					for ( ConnectionLoop = 1; ConnectionLoop <= NumPlantConnections; ++ConnectionLoop ) {
 						aArgCount = ( ConnectionLoop - 1 ) * 2 + 8;
-						UserAirTerminal( CompLoop ).Loop( ConnectionLoop ).InletNodeNum = GetOnlySingleNode( cAlphaArgs( aArgCount ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, ( ConnectionLoop + 2 ), ObjectIsNotParent, cAlphaFieldNames( aArgCount ) );
-						UserAirTerminal( CompLoop ).Loop( ConnectionLoop ).OutletNodeNum = GetOnlySingleNode( cAlphaArgs( aArgCount + 1 ), ErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, ( ConnectionLoop + 2 ), ObjectIsNotParent, cAlphaFieldNames( aArgCount + 1 ) );
+						UserAirTerminal( CompLoop ).Loop( ConnectionLoop ).InletNodeNum = GetOnlySingleNode( cAlphaArgs( aArgCount ), GetUserDefinedComponentsErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Inlet, ( ConnectionLoop + 2 ), ObjectIsNotParent, cAlphaFieldNames( aArgCount ) );
+						UserAirTerminal( CompLoop ).Loop( ConnectionLoop ).OutletNodeNum = GetOnlySingleNode( cAlphaArgs( aArgCount + 1 ), GetUserDefinedComponentsErrorsFound, cCurrentModuleObject, cAlphaArgs( 1 ), NodeType_Water, NodeConnectionType_Outlet, ( ConnectionLoop + 2 ), ObjectIsNotParent, cAlphaFieldNames( aArgCount + 1 ) );
 						TestCompSet( cCurrentModuleObject, cAlphaArgs( 1 ), cAlphaArgs( aArgCount ), cAlphaArgs( aArgCount + 1 ), "Plant Nodes" );
 						UserAirTerminal( CompLoop ).Loop( ConnectionLoop ).HowLoadServed = HowMet_NoneDemand;
 						UserAirTerminal( CompLoop ).Loop( ConnectionLoop ).FlowPriority = LoopFlowStatus_NeedyAndTurnsLoopOn;
@@ -1343,14 +1394,14 @@ namespace UserDefinedComponents {
 				}
 
 				if ( ! lAlphaFieldBlanks( 12 ) ) {
-					SetupTankDemandComponent( cAlphaArgs( 1 ), cCurrentModuleObject, cAlphaArgs( 12 ), ErrorsFound, UserAirTerminal( CompLoop ).Water.SupplyTankID, UserAirTerminal( CompLoop ).Water.SupplyTankDemandARRID );
+					SetupTankDemandComponent( cAlphaArgs( 1 ), cCurrentModuleObject, cAlphaArgs( 12 ), GetUserDefinedComponentsErrorsFound, UserAirTerminal( CompLoop ).Water.SupplyTankID, UserAirTerminal( CompLoop ).Water.SupplyTankDemandARRID );
 
 					UserAirTerminal( CompLoop ).Water.SuppliedByWaterSystem = true;
 					SetupEMSActuator( "Water System", UserAirTerminal( CompLoop ).Name, "Supplied Volume Flow Rate", "[m3/s]", lDummy, UserAirTerminal( CompLoop ).Water.SupplyVdotRequest );
 				}
 
 				if ( ! lAlphaFieldBlanks( 13 ) ) {
-					SetupTankSupplyComponent( cAlphaArgs( 1 ), cCurrentModuleObject, cAlphaArgs( 13 ), ErrorsFound, UserAirTerminal( CompLoop ).Water.CollectionTankID, UserAirTerminal( CompLoop ).Water.CollectionTankSupplyARRID );
+					SetupTankSupplyComponent( cAlphaArgs( 1 ), cCurrentModuleObject, cAlphaArgs( 13 ), GetUserDefinedComponentsErrorsFound, UserAirTerminal( CompLoop ).Water.CollectionTankID, UserAirTerminal( CompLoop ).Water.CollectionTankSupplyARRID );
 					UserAirTerminal( CompLoop ).Water.CollectsToWaterSystem = true;
 					SetupEMSActuator( "Water System", UserAirTerminal( CompLoop ).Name, "Collected Volume Flow Rate", "[m3/s]", lDummy, UserAirTerminal( CompLoop ).Water.CollectedVdot );
 				}
@@ -1360,7 +1411,7 @@ namespace UserDefinedComponents {
 					UserAirTerminal( CompLoop ).Zone.ZoneNum = FindItemInList( cAlphaArgs( 14 ), Zone );
 					if ( UserAirTerminal( CompLoop ).Zone.ZoneNum == 0 ) {
 						ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Ambient Zone Name not found = " + cAlphaArgs( 14 ) );
-						ErrorsFound = true;
+						GetUserDefinedComponentsErrorsFound = true;
 					} else {
 						UserAirTerminal( CompLoop ).Zone.DeviceHasInternalGains = true;
 						SetupZoneInternalGain( UserAirTerminal( CompLoop ).Zone.ZoneNum, cCurrentModuleObject, cAlphaArgs( 1 ), IntGainTypeOf_AirTerminalUserDefined, UserAirTerminal( CompLoop ).Zone.ConvectionGainRate, UserAirTerminal( CompLoop ).Zone.ReturnAirConvectionGainRate, UserAirTerminal( CompLoop ).Zone.ThermalRadiationGainRate, UserAirTerminal( CompLoop ).Zone.LatentGainRate, UserAirTerminal( CompLoop ).Zone.ReturnAirLatentGainRate, UserAirTerminal( CompLoop ).Zone.CarbonDioxideGainRate, UserAirTerminal( CompLoop ).Zone.GenericContamGainRate );
@@ -1378,7 +1429,7 @@ namespace UserDefinedComponents {
 			}
 		} //NumUserZoneAir > 0
 
-		if ( ErrorsFound ) {
+		if ( GetUserDefinedComponentsErrorsFound ) {
 			ShowFatalError( "GetUserDefinedComponents: Errors found in processing " + cCurrentModuleObject + " input." );
 		}
 
@@ -1427,9 +1478,6 @@ namespace UserDefinedComponents {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true ); // one time flag
-		static Array1D_bool MyEnvrnFlag; // environment flag
-		static Array1D_bool MyFlag;
 		int ConnectionNum;
 		bool errFlag;
 		//  REAL(r64) :: rho
@@ -1520,17 +1568,15 @@ namespace UserDefinedComponents {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true ); // one time flag
-		static Array1D_bool MyFlag;
 		bool errFlag;
 		int Loop;
 
-		if ( MyOneTimeFlag ) {
-			MyFlag.dimension( NumUserCoils, true );
-			MyOneTimeFlag = false;
+		if ( InitCoilUserDefinedMyOneTimeFlag ) {
+			InitCoilUserDefinedMyFlag.dimension( NumUserCoils, true );
+			InitCoilUserDefinedMyOneTimeFlag = false;
 		}
 
-		if ( MyFlag( CompNum ) ) {
+		if ( InitCoilUserDefinedMyFlag( CompNum ) ) {
 			if ( UserCoil( CompNum ).PlantIsConnected ) {
 				errFlag = false;
 				ScanPlantLoopsForObject( UserCoil( CompNum ).Name, TypeOf_CoilUserDefined, UserCoil( CompNum ).Loop.LoopNum, UserCoil( CompNum ).Loop.LoopSideNum, UserCoil( CompNum ).Loop.BranchNum, UserCoil( CompNum ).Loop.CompNum );
@@ -1544,7 +1590,7 @@ namespace UserDefinedComponents {
 				PlantLoop( UserCoil( CompNum ).Loop.LoopNum ).LoopSide( UserCoil( CompNum ).Loop.LoopSideNum ).Branch( UserCoil( CompNum ).Loop.BranchNum ).Comp( UserCoil( CompNum ).Loop.CompNum ).HowLoadServed = UserCoil( CompNum ).Loop.HowLoadServed;
 
 			}
-			MyFlag( CompNum ) = false;
+			InitCoilUserDefinedMyFlag( CompNum ) = false;
 		}
 
 		// fill internal variable targets
@@ -1610,17 +1656,15 @@ namespace UserDefinedComponents {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true ); // one time flag
-		static Array1D_bool MyFlag;
 		bool errFlag;
 		int Loop;
 
-		if ( MyOneTimeFlag ) {
-			MyFlag.dimension( NumUserZoneAir, true );
-			MyOneTimeFlag = false;
+		if ( InitZoneAirUserDefinedMyOneTimeFlag ) {
+			InitZoneAirUserDefinedMyFlag.dimension( NumUserZoneAir, true );
+			InitZoneAirUserDefinedMyOneTimeFlag = false;
 		}
 
-		if ( MyFlag( CompNum ) ) {
+		if ( InitZoneAirUserDefinedMyFlag( CompNum ) ) {
 			if ( UserZoneAirHVAC( CompNum ).NumPlantConnections > 0 ) {
 				for ( Loop = 1; Loop <= UserZoneAirHVAC( CompNum ).NumPlantConnections; ++Loop ) {
 					errFlag = false;
@@ -1710,17 +1754,15 @@ namespace UserDefinedComponents {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true ); // one time flag
-		static Array1D_bool MyFlag;
 		bool errFlag;
 		int Loop;
 
-		if ( MyOneTimeFlag ) {
-			MyFlag.dimension( NumUserAirTerminals, true );
-			MyOneTimeFlag = false;
+		if ( InitAirTerminalUserDefinedMyOneTimeFlag ) {
+			InitAirTerminalUserDefinedMyFlag.dimension( NumUserAirTerminals, true );
+			InitAirTerminalUserDefinedMyOneTimeFlag = false;
 		}
 
-		if ( MyFlag( CompNum ) ) {
+		if ( InitAirTerminalUserDefinedMyFlag( CompNum ) ) {
 			if ( UserAirTerminal( CompNum ).NumPlantConnections > 0 ) {
 				for ( Loop = 1; Loop <= UserAirTerminal( CompNum ).NumPlantConnections; ++Loop ) {
 					errFlag = false;
@@ -354,6 +354,11 @@ namespace UserDefinedComponents {
 
 	// Functions
 
+	// Clears the global data in UserDefinedComponents.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimUserDefinedPlantComponent(
 		int const LoopNum, // plant loop sim call originated from
@@ -105,6 +105,16 @@ namespace EnergyPlus {
 
 namespace UtilityRoutines {
 	bool outputErrorHeader( true );
+	// Functions
+
+	// Clears the global data in UtilityRoutines.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		outputErrorHeader = true;
+	}
+
 }
 
 void
@@ -385,7 +395,7 @@ CloseOutOpenFiles()
 
 }
 
-void
+int
 EndEnergyPlus()
 {
 
@@ -396,7 +406,8 @@ EndEnergyPlus()
 	//       RE-ENGINEERED  na
 
 	// PURPOSE OF THIS SUBROUTINE:
-	// This subroutine causes the program to terminate when complete (no errors).
+	// This subroutine wraps up the run when complete (no errors) and returns the exit
+	// status; the caller is responsible for ending the program.
 
 	// METHODOLOGY EMPLOYED:
 	// Puts a message on output files.
@@ -497,7 +508,8 @@ EndEnergyPlus()
 	// Close the ExternalInterface socket. This call also sends the flag "1" to the ExternalInterface,
 	// indicating that E+ finished its simulation
 	if ( ( NumExternalInterfaces > 0 ) && haveExternalInterfaceBCVTB ) CloseSocket( 1 );
-	std::cerr << "EnergyPlus Completed Successfully." << std::endl; std::exit( EXIT_SUCCESS );
+	std::cerr << "EnergyPlus Completed Successfully." << std::endl;
+	return EXIT_SUCCESS;
 
 }
 
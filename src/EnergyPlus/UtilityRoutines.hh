@@ -69,6 +69,13 @@ namespace EnergyPlus {
 
 namespace UtilityRoutines {
 	extern bool outputErrorHeader;
+	// Functions
+
+	// Clears the global data in UtilityRoutines.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 }
 
 void
@@ -80,7 +87,7 @@ CloseMiscOpenFiles();
 void
 CloseOutOpenFiles();
 
-void
+int
 EndEnergyPlus();
 
 int
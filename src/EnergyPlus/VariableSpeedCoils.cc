@@ -73,7 +73,9 @@
 #include <DataHVACGlobals.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
+#include <DataSystemVariables.hh>
 #include <DataWater.hh>
+#include <DXCoils.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
 #include <GeneralRoutines.hh>
@@ -214,6 +216,50 @@ namespace VariableSpeedCoils {
 	// MODULE SUBROUTINES:
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int MaxNums( 0 ); // Maximum number of numeric input fields
+		int MaxAlphas( 0 ); // Maximum number of alpha input fields
+		bool GetVarSpeedCoilInputErrorsFound( false ); // If errors detected in input
+		Array1D_bool MyEnvrnFlag; // used for initializations each begin environment flag
+		Array1D_bool MySizeFlag; // used for sizing PTHP inputs one time
+		Array1D_bool MyPlantScanFlag;
+		bool InitVarSpeedCoilErrorsFound( false ); // TRUE when errors found, air loop initialization error
+		int Count( 0 ); // No idea what this is for.
+		bool firstTime( true );
+		Real64 LoadSideInletDBTemp_Init; // rated conditions
+		Real64 LoadSideInletWBTemp_Init; // rated conditions
+		Real64 LoadSideInletHumRat_Init; // rated conditions
+		Real64 LoadSideInletEnth_Init; // rated conditions
+		Real64 CpAir_Init; // rated conditions
+		Real64 OutdoorDryBulb( 0.0 ); // Outdoor dry-bulb temperature at condenser (C)
+		Real64 OutdoorWetBulb( 0.0 ); // Outdoor wet-bulb temperature at condenser (C)
+		Real64 OutdoorHumRat( 0.0 ); // Outdoor humidity ratio at condenser (kg/kg)
+		Real64 OutdoorPressure( 0.0 ); // Outdoor barometric pressure at condenser (Pa)
+		Real64 CrankcaseHeatingPower( 0.0 ); // power due to crankcase heater
+		Real64 CompAmbTemp( 0.0 ); // Ambient temperature at compressor
+		Real64 OutdoorCoilT( 0.0 ); // Outdoor coil temperature (C)
+		Real64 OutdoorCoildw( 0.0 ); // Outdoor coil delta w assuming coil temp of OutdoorCoilT (kg/kg)
+		Real64 CalcVarSpeedCoilHeatingOutdoorDryBulb( 0.0 ); // Outdoor dry-bulb temperature at condenser (C)
+		Real64 CalcVarSpeedCoilHeatingOutdoorWetBulb( 0.0 ); // Outdoor wet-bulb temperature at condenser (C)
+		Real64 CalcVarSpeedCoilHeatingOutdoorHumRat( 0.0 ); // Outdoor humidity ratio at condenser (kg/kg)
+		Real64 CalcVarSpeedCoilHeatingOutdoorPressure( 0.0 ); // Outdoor barometric pressure at condenser (Pa)
+		Real64 FractionalDefrostTime( 0.0 ); // Fraction of time step system is in defrost
+		Real64 HeatingCapacityMultiplier( 0.0 ); // Multiplier for heating capacity when system is in defrost
+		Real64 InputPowerMultiplier( 0.0 ); // Multiplier for power when system is in defrost
+		Real64 LoadDueToDefrost( 0.0 ); // Additional load due to defrost
+		Real64 CalcVarSpeedCoilHeatingCrankcaseHeatingPower( 0.0 ); // power due to crankcase heater
+		Real64 DefrostEIRTempModFac( 0.0 ); // EIR modifier for defrost (function of entering wetbulb, outside drybulb)
+		Real64 TotRatedCapacity( 0.0 ); // total rated capacity at the given speed and speed ratio for defrosting
+		bool LoopOn( true ); // flag to control the loop iteration
+		Real64 SmallDifferenceTest( 0.00000001 );
+		bool CBFErrors( false ); // Set to true if errors in CBF calculation, fatal at end of routine
+	}
+
 	// Functions
 	void
 	clear_state() {
@@ -241,6 +287,42 @@ namespace VariableSpeedCoils {
 		VSHPWHHeatingCapacity = 0.0;
 		VSHPWHHeatingCOP = 0.0;
 		VarSpeedCoil.deallocate();
+		MaxNums = 0;
+		MaxAlphas = 0;
+		GetVarSpeedCoilInputErrorsFound = false;
+		MyEnvrnFlag.deallocate();
+		MySizeFlag.deallocate();
+		MyPlantScanFlag.deallocate();
+		InitVarSpeedCoilErrorsFound = false;
+		Count = 0;
+		firstTime = true;
+		LoadSideInletDBTemp_Init = 0.0;
+		LoadSideInletWBTemp_Init = 0.0;
+		LoadSideInletHumRat_Init = 0.0;
+		LoadSideInletEnth_Init = 0.0;
+		CpAir_Init = 0.0;
+		OutdoorDryBulb = 0.0;
+		OutdoorWetBulb = 0.0;
+		OutdoorHumRat = 0.0;
+		OutdoorPressure = 0.0;
+		CrankcaseHeatingPower = 0.0;
+		CompAmbTemp = 0.0;
+		OutdoorCoilT = 0.0;
+		OutdoorCoildw = 0.0;
+		CalcVarSpeedCoilHeatingOutdoorDryBulb = 0.0;
+		CalcVarSpeedCoilHeatingOutdoorWetBulb = 0.0;
+		CalcVarSpeedCoilHeatingOutdoorHumRat = 0.0;
+		CalcVarSpeedCoilHeatingOutdoorPressure = 0.0;
+		FractionalDefrostTime = 0.0;
+		HeatingCapacityMultiplier = 0.0;
+		InputPowerMultiplier = 0.0;
+		LoadDueToDefrost = 0.0;
+		CalcVarSpeedCoilHeatingCrankcaseHeatingPower = 0.0;
+		DefrostEIRTempModFac = 0.0;
+		TotRatedCapacity = 0.0;
+		LoopOn = true;
+		SmallDifferenceTest = 0.00000001;
+		CBFErrors = false;
 	}
 
 	// Default Constructor
@@ -562,11 +644,8 @@ namespace VariableSpeedCoils {
 		int NumAlphas; // Number of variables in String format
 		int NumNums; // Number of variables in Numeric format
 		int NumParams; // Total number of input fields
-		static int MaxNums( 0 ); // Maximum number of numeric input fields
-		static int MaxAlphas( 0 ); // Maximum number of alpha input fields
 		int IOStat;
 		int AlfaFieldIncre; // increment number of Alfa field
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool errFlag;
@@ -591,7 +670,7 @@ namespace VariableSpeedCoils {
 
 		if ( NumWatertoAirHPs <= 0 ) {
 			ShowSevereError( "No Equipment found in GetVarSpeedCoilInput" );
-			ErrorsFound = true;
+			GetVarSpeedCoilInputErrorsFound = true;
 		}
 
 		// Allocate Arrays
@@ -640,12 +719,12 @@ namespace VariableSpeedCoils {
 
 			VerifyName( AlphArray( 1 ), VarSpeedCoil, DXCoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 				if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, AlphArray( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			VarSpeedCoil( DXCoilNum ).bIsDesuperheater = false;
@@ -662,10 +741,10 @@ namespace VariableSpeedCoils {
 			VarSpeedCoil( DXCoilNum ).HOTGASREHEATFLG = int( NumArray( 8 ) );
 			VarSpeedCoil( DXCoilNum ).CondenserType = WaterCooled;
 
-			VarSpeedCoil( DXCoilNum ).WaterInletNodeNum = GetOnlySingleNode( AlphArray( 2 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
-			VarSpeedCoil( DXCoilNum ).WaterOutletNodeNum = GetOnlySingleNode( AlphArray( 3 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
-			VarSpeedCoil( DXCoilNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 4 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			VarSpeedCoil( DXCoilNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 5 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			VarSpeedCoil( DXCoilNum ).WaterInletNodeNum = GetOnlySingleNode( AlphArray( 2 ), GetVarSpeedCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+			VarSpeedCoil( DXCoilNum ).WaterOutletNodeNum = GetOnlySingleNode( AlphArray( 3 ), GetVarSpeedCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+			VarSpeedCoil( DXCoilNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 4 ), GetVarSpeedCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			VarSpeedCoil( DXCoilNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 5 ), GetVarSpeedCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			TestCompSet( CurrentModuleObject, AlphArray( 1 ), AlphArray( 2 ), AlphArray( 3 ), "Water Nodes" );
 			TestCompSet( CurrentModuleObject, AlphArray( 1 ), AlphArray( 4 ), AlphArray( 5 ), "Air Nodes" );
@@ -674,7 +753,7 @@ namespace VariableSpeedCoils {
 			if ( VarSpeedCoil( DXCoilNum ).NumOfSpeeds < 1 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 1 ) + " must be >= 1. entered number is " + TrimSigDigits( NumArray( 1 ), 0 ) );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			if ( VarSpeedCoil( DXCoilNum ).NormSpedLevel > VarSpeedCoil( DXCoilNum ).NumOfSpeeds ) {
@@ -684,7 +763,7 @@ namespace VariableSpeedCoils {
 			if ( ( VarSpeedCoil( DXCoilNum ).NormSpedLevel > VarSpeedCoil( DXCoilNum ).NumOfSpeeds ) || ( VarSpeedCoil( DXCoilNum ).NormSpedLevel <= 0 ) ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 2 ) + " must be valid speed level entered number is " + TrimSigDigits( NumArray( 2 ), 0 ) );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			//part load curve
@@ -697,7 +776,7 @@ namespace VariableSpeedCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 6 ) + "=\"" + AlphArray( 6 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			} else {
 				CurveVal = CurveValue( VarSpeedCoil( DXCoilNum ).PLFFPLR, 1.0 );
 				if ( CurveVal > 1.10 || CurveVal < 0.90 ) {
@@ -725,7 +804,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is BiQuadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapFTemp( I ) ) );
@@ -742,7 +821,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapFTemp( I ) ) );
 						ShowContinueError( "Curve type must be BiQuadratic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -756,7 +835,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is Quadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapAirFFlow( I ) ) );
@@ -781,7 +860,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapAirFFlow( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -795,7 +874,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is Quadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapWaterFFlow( I ) ) );
@@ -820,7 +899,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapWaterFFlow( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -834,7 +913,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is BiQuadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRFTemp( I ) ) );
@@ -851,7 +930,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRFTemp( 1 ) ) );
 						ShowContinueError( "Curve type must be BiQuadratic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -865,7 +944,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is Quadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRAirFFlow( I ) ) );
@@ -890,7 +969,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRAirFFlow( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -904,7 +983,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is Quadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRWaterFFlow( I ) ) );
@@ -929,7 +1008,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRWaterFFlow( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -944,7 +1023,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal types are BiQuadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSWasteHeat( I ) ) );
@@ -961,7 +1040,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSWasteHeat( I ) ) );
 						ShowContinueError( "Curve type must be BiQuadratic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1016,12 +1095,12 @@ namespace VariableSpeedCoils {
 
 			VerifyName( AlphArray( 1 ), VarSpeedCoil, DXCoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 				if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, AlphArray( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			VarSpeedCoil( DXCoilNum ).bIsDesuperheater = false;
@@ -1035,15 +1114,15 @@ namespace VariableSpeedCoils {
 			VarSpeedCoil( DXCoilNum ).Twet_Rated = NumArray( 5 );
 			VarSpeedCoil( DXCoilNum ).Gamma_Rated = NumArray( 6 );
 
-			VarSpeedCoil( DXCoilNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 2 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			VarSpeedCoil( DXCoilNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 3 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			VarSpeedCoil( DXCoilNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 2 ), GetVarSpeedCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			VarSpeedCoil( DXCoilNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 3 ), GetVarSpeedCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			TestCompSet( CurrentModuleObject, AlphArray( 1 ), AlphArray( 2 ), AlphArray( 3 ), "Air Nodes" );
 
 			if ( VarSpeedCoil( DXCoilNum ).NumOfSpeeds < 1 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 1 ) + " must be >= 1. entered number is " + TrimSigDigits( NumArray( 1 ), 0 ) );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			if ( VarSpeedCoil( DXCoilNum ).NormSpedLevel > VarSpeedCoil( DXCoilNum ).NumOfSpeeds ) {
@@ -1053,7 +1132,7 @@ namespace VariableSpeedCoils {
 			if ( ( VarSpeedCoil( DXCoilNum ).NormSpedLevel > VarSpeedCoil( DXCoilNum ).NumOfSpeeds ) || ( VarSpeedCoil( DXCoilNum ).NormSpedLevel <= 0 ) ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 2 ) + " must be valid speed level entered number is " + TrimSigDigits( NumArray( 2 ), 0 ) );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			//part load curve
@@ -1066,7 +1145,7 @@ namespace VariableSpeedCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 4 ) + "=\"" + AlphArray( 4 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			} else {
 				CurveVal = CurveValue( VarSpeedCoil( DXCoilNum ).PLFFPLR, 1.0 );
 				if ( CurveVal > 1.10 || CurveVal < 0.90 ) {
@@ -1080,7 +1159,7 @@ namespace VariableSpeedCoils {
 			if ( lAlphaBlanks( 5 ) ) {
 				VarSpeedCoil( DXCoilNum ).CondenserInletNodeNum = 0;
 			} else {
-				VarSpeedCoil( DXCoilNum ).CondenserInletNodeNum = GetOnlySingleNode( AlphArray( 5 ), ErrorsFound, CurrentModuleObject, VarSpeedCoil( DXCoilNum ).Name, NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsNotParent );
+				VarSpeedCoil( DXCoilNum ).CondenserInletNodeNum = GetOnlySingleNode( AlphArray( 5 ), GetVarSpeedCoilInputErrorsFound, CurrentModuleObject, VarSpeedCoil( DXCoilNum ).Name, NodeType_Air, NodeConnectionType_OutsideAirReference, 1, ObjectIsNotParent );
 
 				if ( !CheckOutAirNodeNumber( VarSpeedCoil( DXCoilNum ).CondenserInletNodeNum ) ) {
 					ShowWarningError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", may be invalid" );
@@ -1098,7 +1177,7 @@ namespace VariableSpeedCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cAlphaFields( 6 ) + "=\"" + AlphArray( 6 ) + "\":" );
 				ShowContinueError( "...must be AirCooled or EvaporativelyCooled." );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			VarSpeedCoil( DXCoilNum ).EvapCondPumpElecNomPower = NumArray( 7 );
@@ -1107,7 +1186,7 @@ namespace VariableSpeedCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 7 ) + " cannot be < 0.0." );
 				ShowContinueError( "...entered value=[" + TrimSigDigits( NumArray( 7 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			//Set crankcase heater capacity
@@ -1116,7 +1195,7 @@ namespace VariableSpeedCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 8 ) + " cannot be < 0.0." );
 				ShowContinueError( "...entered value=[" + TrimSigDigits( NumArray( 8 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			//Set crankcase heater cutout temperature
@@ -1129,7 +1208,7 @@ namespace VariableSpeedCoils {
 				VarSpeedCoil( DXCoilNum ).EvapWaterSupplyMode = WaterSupplyFromMains;
 			} else {
 				VarSpeedCoil( DXCoilNum ).EvapWaterSupplyMode = WaterSupplyFromTank;
-				SetupTankDemandComponent( VarSpeedCoil( DXCoilNum ).Name, CurrentModuleObject, VarSpeedCoil( DXCoilNum ).EvapWaterSupplyName, ErrorsFound, VarSpeedCoil( DXCoilNum ).EvapWaterSupTankID, VarSpeedCoil( DXCoilNum ).EvapWaterTankDemandARRID );
+				SetupTankDemandComponent( VarSpeedCoil( DXCoilNum ).Name, CurrentModuleObject, VarSpeedCoil( DXCoilNum ).EvapWaterSupplyName, GetVarSpeedCoilInputErrorsFound, VarSpeedCoil( DXCoilNum ).EvapWaterSupTankID, VarSpeedCoil( DXCoilNum ).EvapWaterTankDemandARRID );
 			}
 
 			//A8; \field Name of Water Storage Tank for Condensate Collection
@@ -1138,7 +1217,7 @@ namespace VariableSpeedCoils {
 				VarSpeedCoil( DXCoilNum ).CondensateCollectMode = CondensateDiscarded;
 			} else {
 				VarSpeedCoil( DXCoilNum ).CondensateCollectMode = CondensateToTank;
-				SetupTankSupplyComponent( VarSpeedCoil( DXCoilNum ).Name, CurrentModuleObject, VarSpeedCoil( DXCoilNum ).CondensateCollectName, ErrorsFound, VarSpeedCoil( DXCoilNum ).CondensateTankID, VarSpeedCoil( DXCoilNum ).CondensateTankSupplyARRID );
+				SetupTankSupplyComponent( VarSpeedCoil( DXCoilNum ).Name, CurrentModuleObject, VarSpeedCoil( DXCoilNum ).CondensateCollectName, GetVarSpeedCoilInputErrorsFound, VarSpeedCoil( DXCoilNum ).CondensateTankID, VarSpeedCoil( DXCoilNum ).CondensateTankSupplyARRID );
 			}
 
 			//   Basin heater power as a function of temperature must be greater than or equal to 0
@@ -1147,7 +1226,7 @@ namespace VariableSpeedCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 10 ) + " must be >= 0.0." );
 				ShowContinueError( "...entered value=[" + TrimSigDigits( NumArray( 10 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			VarSpeedCoil( DXCoilNum ).BasinHeaterSetPointTemp = NumArray( 11 );
@@ -1180,7 +1259,7 @@ namespace VariableSpeedCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cNumericFields( 17 + ( I - 1 ) * 6 ) + " cannot be < 0.0 or > 1.0." );
 					ShowContinueError( "...entered value=[" + TrimSigDigits( NumArray( 17 + ( I - 1 ) * 6 ), 2 ) + "]." );
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				}
 
 				AlfaFieldIncre = 10 + ( I - 1 ) * 4;
@@ -1193,7 +1272,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is BiQuadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapFTemp( I ) ) );
@@ -1210,7 +1289,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapFTemp( I ) ) );
 						ShowContinueError( "Curve type must be BiQuadratic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1224,7 +1303,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is Quadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapAirFFlow( I ) ) );
@@ -1249,7 +1328,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapAirFFlow( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1263,7 +1342,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is BiQuadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRFTemp( I ) ) );
@@ -1280,7 +1359,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRFTemp( 1 ) ) );
 						ShowContinueError( "Curve type must be BiQuadratic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1294,7 +1373,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is Quadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRAirFFlow( I ) ) );
@@ -1319,7 +1398,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRAirFFlow( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 			}
@@ -1366,12 +1445,12 @@ namespace VariableSpeedCoils {
 
 			VerifyName( AlphArray( 1 ), VarSpeedCoil, DXCoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 				if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, AlphArray( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			VarSpeedCoil( DXCoilNum ).bIsDesuperheater = false;
@@ -1385,10 +1464,10 @@ namespace VariableSpeedCoils {
 			VarSpeedCoil( DXCoilNum ).RatedWaterVolFlowRate = NumArray( 5 );
 			VarSpeedCoil( DXCoilNum ).CondenserType = WaterCooled;
 
-			VarSpeedCoil( DXCoilNum ).WaterInletNodeNum = GetOnlySingleNode( AlphArray( 2 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
-			VarSpeedCoil( DXCoilNum ).WaterOutletNodeNum = GetOnlySingleNode( AlphArray( 3 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
-			VarSpeedCoil( DXCoilNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 4 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			VarSpeedCoil( DXCoilNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 5 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			VarSpeedCoil( DXCoilNum ).WaterInletNodeNum = GetOnlySingleNode( AlphArray( 2 ), GetVarSpeedCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+			VarSpeedCoil( DXCoilNum ).WaterOutletNodeNum = GetOnlySingleNode( AlphArray( 3 ), GetVarSpeedCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+			VarSpeedCoil( DXCoilNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 4 ), GetVarSpeedCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			VarSpeedCoil( DXCoilNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 5 ), GetVarSpeedCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			TestCompSet( CurrentModuleObject, AlphArray( 1 ), AlphArray( 2 ), AlphArray( 3 ), "Water Nodes" );
 			TestCompSet( CurrentModuleObject, AlphArray( 1 ), AlphArray( 4 ), AlphArray( 5 ), "Air Nodes" );
@@ -1397,7 +1476,7 @@ namespace VariableSpeedCoils {
 			if ( VarSpeedCoil( DXCoilNum ).NumOfSpeeds < 1 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 1 ) + " must be >= 1. entered number is " + TrimSigDigits( NumArray( 1 ), 0 ) );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			if ( VarSpeedCoil( DXCoilNum ).NormSpedLevel > VarSpeedCoil( DXCoilNum ).NumOfSpeeds ) {
@@ -1407,7 +1486,7 @@ namespace VariableSpeedCoils {
 			if ( ( VarSpeedCoil( DXCoilNum ).NormSpedLevel > VarSpeedCoil( DXCoilNum ).NumOfSpeeds ) || ( VarSpeedCoil( DXCoilNum ).NormSpedLevel <= 0 ) ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 2 ) + " must be valid speed level entered number is " + TrimSigDigits( NumArray( 2 ), 0 ) );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			//part load curve
@@ -1420,7 +1499,7 @@ namespace VariableSpeedCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 6 ) + "=\"" + AlphArray( 6 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			} else {
 				CurveVal = CurveValue( VarSpeedCoil( DXCoilNum ).PLFFPLR, 1.0 );
 				if ( CurveVal > 1.10 || CurveVal < 0.90 ) {
@@ -1447,7 +1526,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is BiQuadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapFTemp( I ) ) );
@@ -1464,7 +1543,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapFTemp( I ) ) );
 						ShowContinueError( "Curve type must be BiQuadratic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1478,7 +1557,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is Quadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapAirFFlow( I ) ) );
@@ -1503,7 +1582,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapAirFFlow( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1517,7 +1596,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( 14 + ( I - 1 ) * 6 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is Quadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapWaterFFlow( I ) ) );
@@ -1542,7 +1621,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapWaterFFlow( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1556,7 +1635,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is BiQuadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRFTemp( I ) ) );
@@ -1573,7 +1652,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRFTemp( 1 ) ) );
 						ShowContinueError( "Curve type must be BiQuadratic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1587,7 +1666,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( 16 + ( I - 1 ) * 6 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is Quadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRAirFFlow( I ) ) );
@@ -1612,7 +1691,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRAirFFlow( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1626,7 +1705,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is Quadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRWaterFFlow( I ) ) );
@@ -1651,7 +1730,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRWaterFFlow( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1666,7 +1745,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal types are BiQuadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSWasteHeat( I ) ) );
@@ -1683,7 +1762,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSWasteHeat( I ) ) );
 						ShowContinueError( "Curve type must be BiQuadratic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1722,12 +1801,12 @@ namespace VariableSpeedCoils {
 
 			VerifyName( AlphArray( 1 ), VarSpeedCoil, DXCoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 				if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, AlphArray( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			VarSpeedCoil( DXCoilNum ).bIsDesuperheater = false;
@@ -1739,15 +1818,15 @@ namespace VariableSpeedCoils {
 			VarSpeedCoil( DXCoilNum ).RatedCapHeat = NumArray( 3 );
 			VarSpeedCoil( DXCoilNum ).RatedAirVolFlowRate = NumArray( 4 );
 
-			VarSpeedCoil( DXCoilNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 2 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			VarSpeedCoil( DXCoilNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 3 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			VarSpeedCoil( DXCoilNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 2 ), GetVarSpeedCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			VarSpeedCoil( DXCoilNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 3 ), GetVarSpeedCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			TestCompSet( CurrentModuleObject, AlphArray( 1 ), AlphArray( 2 ), AlphArray( 3 ), "Air Nodes" );
 
 			if ( VarSpeedCoil( DXCoilNum ).NumOfSpeeds < 1 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 1 ) + " must be >= 1. entered number is " + TrimSigDigits( NumArray( 1 ), 0 ) );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			if ( VarSpeedCoil( DXCoilNum ).NormSpedLevel > VarSpeedCoil( DXCoilNum ).NumOfSpeeds ) {
@@ -1757,7 +1836,7 @@ namespace VariableSpeedCoils {
 			if ( ( VarSpeedCoil( DXCoilNum ).NormSpedLevel > VarSpeedCoil( DXCoilNum ).NumOfSpeeds ) || ( VarSpeedCoil( DXCoilNum ).NormSpedLevel <= 0 ) ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 2 ) + " must be valid speed level entered number is " + TrimSigDigits( NumArray( 2 ), 0 ) );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			//part load curve
@@ -1770,7 +1849,7 @@ namespace VariableSpeedCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 4 ) + "=\"" + AlphArray( 4 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			} else {
 				CurveVal = CurveValue( VarSpeedCoil( DXCoilNum ).PLFFPLR, 1.0 );
 				if ( CurveVal > 1.10 || CurveVal < 0.90 ) {
@@ -1792,7 +1871,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( 5 ) + "=\"" + AlphArray( 5 ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is BiQuadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).DefrostEIRFT ) );
@@ -1803,7 +1882,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( 5 ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).DefrostEIRFT ) );
 						ShowContinueError( "Curve type must be BiQuadratic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 			}
@@ -1814,7 +1893,7 @@ namespace VariableSpeedCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "...illegal " + cAlphaFields( 6 ) + "=\"" + AlphArray( 6 ) + "\"." );
 				ShowContinueError( "...valid values for this field are ReverseCycle or Resistive." );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			if ( SameString( AlphArray( 7 ), "Timed" ) ) VarSpeedCoil( DXCoilNum ).DefrostControl = Timed;
@@ -1823,7 +1902,7 @@ namespace VariableSpeedCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "...illegal " + cAlphaFields( 7 ) + "=\"" + AlphArray( 7 ) + "\"." );
 				ShowContinueError( "...valid values for this field are Timed or OnDemand." );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			//Set minimum OAT for heat pump compressor operation
@@ -1841,7 +1920,7 @@ namespace VariableSpeedCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 9 ) + " cannot be < 0.0." );
 				ShowContinueError( "...entered value=[" + TrimSigDigits( NumArray( 9 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			//Set crankcase heater cutout temperature
@@ -1869,7 +1948,7 @@ namespace VariableSpeedCoils {
 				if ( VarSpeedCoil( DXCoilNum ).MSRatedTotCap( I ) < 1.e-10 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid value" );
 					ShowContinueError( "...too small " + cNumericFields( 12 + ( I - 1 ) * 3 ) + "=[" + RoundSigDigits( VarSpeedCoil( DXCoilNum ).MSRatedTotCap( I ), 2 ) + "]." );
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				}
 
 				AlfaFieldIncre = 8 + ( I - 1 ) * 4;
@@ -1882,7 +1961,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is BiQuadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapFTemp( I ) ) );
@@ -1899,7 +1978,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapFTemp( I ) ) );
 						ShowContinueError( "Curve type must be BiQuadratic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1913,7 +1992,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is Quadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapAirFFlow( I ) ) );
@@ -1938,7 +2017,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapAirFFlow( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1952,7 +2031,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is BiQuadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRFTemp( I ) ) );
@@ -1969,7 +2048,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRFTemp( 1 ) ) );
 						ShowContinueError( "Curve type must be BiQuadratic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -1983,7 +2062,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is Quadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRAirFFlow( I ) ) );
@@ -2008,12 +2087,12 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRAirFFlow( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 			}
 
-			if ( ErrorsFound ) continue;
+			if ( GetVarSpeedCoilInputErrorsFound ) continue;
 
 			for ( I = 1; I <= VarSpeedCoil( DXCoilNum ).NumOfSpeeds; ++I ) {
 				VarSpeedCoil( DXCoilNum ).MSRatedPercentTotCap( I ) = VarSpeedCoil( DXCoilNum ).MSRatedTotCap( I ) / VarSpeedCoil( DXCoilNum ).MSRatedTotCap( VarSpeedCoil( DXCoilNum ).NumOfSpeeds );
@@ -2050,12 +2129,12 @@ namespace VariableSpeedCoils {
 
 			VerifyName( AlphArray( 1 ), VarSpeedCoil, &VariableSpeedCoilData::Name, DXCoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 				if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, AlphArray( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			VarSpeedCoil( DXCoilNum ).bIsDesuperheater = false;
@@ -2071,7 +2150,7 @@ namespace VariableSpeedCoils {
 			if ( VarSpeedCoil( DXCoilNum ).NumOfSpeeds < 1 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 1 ) + " must be >= 1." " entered number is " + TrimSigDigits( NumArray( 1 ), 0 ) );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			if ( VarSpeedCoil( DXCoilNum ).NormSpedLevel > VarSpeedCoil( DXCoilNum ).NumOfSpeeds ) {
@@ -2081,14 +2160,14 @@ namespace VariableSpeedCoils {
 			if ( ( VarSpeedCoil( DXCoilNum ).NormSpedLevel > VarSpeedCoil( DXCoilNum ).NumOfSpeeds ) || ( VarSpeedCoil( DXCoilNum ).NormSpedLevel <= 0 ) ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 2 ) + " must be valid speed level" " entered number is " + TrimSigDigits( NumArray( 2 ), 0 ) );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			VarSpeedCoil( DXCoilNum ).RatedCapWH = NumArray( 3 );
 			if ( VarSpeedCoil( DXCoilNum ).RatedCapWH <= 0.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 3 ) + " must be > 0.0, entered value=[" + TrimSigDigits( NumArray( 3 ), 2 ) + "]." );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			VarSpeedCoil( DXCoilNum ).WHRatedInletDBTemp = NumArray( 4 );
@@ -2102,7 +2181,7 @@ namespace VariableSpeedCoils {
 				if ( VarSpeedCoil( DXCoilNum ).RatedAirVolFlowRate <= 0.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cNumericFields( 7 ) + " must be > 0.0.  entered value=[" + TrimSigDigits( NumArray( 7 ), 3 ) + "]." );
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				}
 			}
 
@@ -2110,7 +2189,7 @@ namespace VariableSpeedCoils {
 				if ( VarSpeedCoil( DXCoilNum ).RatedWaterVolFlowRate <= 0.0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "..." + cNumericFields( 8 ) + " must be > 0.0  entered value=[" + TrimSigDigits( NumArray( 8 ), 3 ) + "]." );
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				}
 			}
 
@@ -2122,7 +2201,7 @@ namespace VariableSpeedCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( ",,,invalid choice for " + cAlphaFields( 2 ) + ".  Entered choice = " + AlphArray( 2 ) );
 				ShowContinueError( "Valid choices are Yes or No." );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			if ( SameString( AlphArray( 3 ), "Yes" ) || SameString( AlphArray( 3 ), "No" ) ) {
@@ -2133,7 +2212,7 @@ namespace VariableSpeedCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( ",,,invalid choice for " + cAlphaFields( 3 ) + ".  Entered choice = " + AlphArray( 3 ) );
 				ShowContinueError( "Valid choices are Yes or No." );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			if ( SameString( AlphArray( 4 ), "Yes" ) || SameString( AlphArray( 4 ), "No" ) ) {
@@ -2144,14 +2223,14 @@ namespace VariableSpeedCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( ",,,invalid choice for " + cAlphaFields( 4 ) + ".  Entered choice = " + AlphArray( 4 ) );
 				ShowContinueError( "Valid choices are Yes or No." );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			VarSpeedCoil( DXCoilNum ).HPWHCondPumpFracToWater = NumArray( 9 );
 			if ( VarSpeedCoil( DXCoilNum ).HPWHCondPumpFracToWater <= 0.0 || VarSpeedCoil( DXCoilNum ).HPWHCondPumpFracToWater > 1.0 ) {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 10 ) + " must be >= 0 and <= 1.  entered value=[" + TrimSigDigits( NumArray( 9 ), 3 ) + "]." );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			if ( !VarSpeedCoil( DXCoilNum ).CondPumpHeatInCapacity ) {
@@ -2159,9 +2238,9 @@ namespace VariableSpeedCoils {
 			}
 
 			//Air nodes
-			VarSpeedCoil( DXCoilNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 5 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			VarSpeedCoil( DXCoilNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 5 ), GetVarSpeedCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
 
-			VarSpeedCoil( DXCoilNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 6 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			VarSpeedCoil( DXCoilNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 6 ), GetVarSpeedCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			TestCompSet( CurrentModuleObject, AlphArray( 1 ), AlphArray( 5 ), AlphArray( 6 ), "Air Nodes" );
 
@@ -2169,9 +2248,9 @@ namespace VariableSpeedCoils {
 			VarSpeedCoil( DXCoilNum ).IsDXCoilInZone = !CheckOutAirNodeNumber( VarSpeedCoil( DXCoilNum ).AirInletNodeNum );
 
 			//Water nodes
-			VarSpeedCoil( DXCoilNum ).WaterInletNodeNum = GetOnlySingleNode( AlphArray( 7 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+			VarSpeedCoil( DXCoilNum ).WaterInletNodeNum = GetOnlySingleNode( AlphArray( 7 ), GetVarSpeedCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
 
-			VarSpeedCoil( DXCoilNum ).WaterOutletNodeNum = GetOnlySingleNode( AlphArray( 8 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+			VarSpeedCoil( DXCoilNum ).WaterOutletNodeNum = GetOnlySingleNode( AlphArray( 8 ), GetVarSpeedCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
 
 			TestCompSet( CurrentModuleObject, AlphArray( 1 ), AlphArray( 7 ), AlphArray( 8 ), "Water Nodes" );
 
@@ -2181,7 +2260,7 @@ namespace VariableSpeedCoils {
 								 VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 10 ) +
 								   " must be >= 0.0  entered value=[" + TrimSigDigits( NumArray( 10 ), 1 ) + "]." );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			VarSpeedCoil( DXCoilNum ).MaxOATCrankcaseHeater = NumArray( 11 );
@@ -2190,7 +2269,7 @@ namespace VariableSpeedCoils {
 								 VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cNumericFields( 11 ) +
 								   " must be >= 0 {C}.  entered value=[" + TrimSigDigits( NumArray( 11 ), 1 ) + "]." );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			if ( SameString( AlphArray( 9 ), "DryBulbTemperature" ) ) {
@@ -2202,7 +2281,7 @@ namespace VariableSpeedCoils {
 				ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 				ShowContinueError( "..." + cAlphaFields( 9 ) + " must be DryBulbTemperature or WetBulbTemperature." );
 				ShowContinueError( "...entered value=\"" + AlphArray( 9 ) + "\"." );
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			}
 
 			// set rated inlet air temperature for curve object verification
@@ -2224,7 +2303,7 @@ namespace VariableSpeedCoils {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 					ShowContinueError( "...not found " + cAlphaFields( 10 ) + "=\"" + AlphArray( 10 ) + "\"." );
 				}
-				ErrorsFound = true;
+				GetVarSpeedCoilInputErrorsFound = true;
 			} else {
 				CurveVal = CurveValue( VarSpeedCoil( DXCoilNum ).PLFFPLR, 1.0 );
 				if ( CurveVal > 1.10 || CurveVal < 0.90 ) {
@@ -2252,7 +2331,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is BiQuadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapFTemp( I ) ) );
@@ -2269,7 +2348,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapFTemp( I ) ) );
 						ShowContinueError( "Curve type must be BiQuadratic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -2283,7 +2362,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is Quadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapAirFFlow( I ) ) );
@@ -2308,7 +2387,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapAirFFlow( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -2322,7 +2401,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is Quadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapWaterFFlow( I ) ) );
@@ -2347,7 +2426,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSCCapWaterFFlow( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -2361,7 +2440,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is BiQuadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRFTemp( I ) ) );
@@ -2378,7 +2457,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRFTemp( 1 ) ) );
 						ShowContinueError( "Curve type must be BiQuadratic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -2392,7 +2471,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is Quadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRAirFFlow( I ) ) );
@@ -2417,7 +2496,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRAirFFlow( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 
@@ -2431,7 +2510,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...not found " + cAlphaFields( AlfaFieldIncre ) + "=\"" + AlphArray( AlfaFieldIncre ) + "\"." );
 					}
-					ErrorsFound = true;
+					GetVarSpeedCoilInputErrorsFound = true;
 				} else {
 					// Verify Curve Object, only legal type is Quadratic
 					{auto const SELECT_CASE_var( GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRWaterFFlow( I ) ) );
@@ -2456,7 +2535,7 @@ namespace VariableSpeedCoils {
 						ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + VarSpeedCoil( DXCoilNum ).Name + "\", invalid" );
 						ShowContinueError( "...illegal " + cAlphaFields( AlfaFieldIncre ) + " type for this object = " + GetCurveType( VarSpeedCoil( DXCoilNum ).MSEIRWaterFFlow( I ) ) );
 						ShowContinueError( "Curve type must be Quadratic or Cubic." );
-						ErrorsFound = true;
+						GetVarSpeedCoilInputErrorsFound = true;
 					}}
 				}
 			}
@@ -2495,7 +2574,7 @@ namespace VariableSpeedCoils {
 		lNumericBlanks.deallocate();
 		NumArray.deallocate();
 
-		if ( ErrorsFound ) {
+		if ( GetVarSpeedCoilInputErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found getting input. Program terminates." );
 		}
 
@@ -2643,7 +2722,7 @@ namespace VariableSpeedCoils {
 			}
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetVarSpeedCoilInputErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in getting " + CurrentModuleObject + " input.  Preceding condition(s) causes termination." );
 		}
 
@@ -2706,14 +2785,10 @@ namespace VariableSpeedCoils {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int AirInletNode; // Node Number of the air inlet
 		int WaterInletNode; // Node Number of the Water inlet
-		static Array1D_bool MyEnvrnFlag; // used for initializations each begin environment flag
-		static Array1D_bool MySizeFlag; // used for sizing PTHP inputs one time
-		static Array1D_bool MyPlantScanFlag;
 		Real64 rho; // local fluid density
 		Real64 Cp; // local fluid specific heat
 		int SpeedCal; // calculated speed level
 		bool errFlag;
-		static bool ErrorsFound( false ); // TRUE when errors found, air loop initialization error
 		Real64 RatedVolFlowPerRatedTotCap; // Rated Air Volume Flow Rate divided by Rated Total Capacity [m3/s-W)
 		int Mode; // Performance mode for MultiMode DX coil; Always 1 for other coil types
 		Real64 RatedHeatPumpIndoorAirTemp;
@@ -2775,13 +2850,13 @@ namespace VariableSpeedCoils {
 					// Check for zero capacity or zero max flow rate
 					if ( VarSpeedCoil( DXCoilNum ).MSRatedTotCap( Mode ) <= 0.0 ) {
 						ShowSevereError( "Sizing: " + VarSpeedCoil( DXCoilNum ).VarSpeedCoilType + ' ' + VarSpeedCoil( DXCoilNum ).Name + " has zero rated total capacity at speed " + TrimSigDigits( Mode ) );
-						ErrorsFound = true;
+						InitVarSpeedCoilErrorsFound = true;
 					}
 					if ( VarSpeedCoil( DXCoilNum ).MSRatedAirVolFlowRate( Mode ) <= 0.0 ) {
 						ShowSevereError( "Sizing: " + VarSpeedCoil( DXCoilNum ).VarSpeedCoilType + ' ' + VarSpeedCoil( DXCoilNum ).Name + " has zero rated air flow rate at speed " + TrimSigDigits( Mode ) );
-						ErrorsFound = true;
+						InitVarSpeedCoilErrorsFound = true;
 					}
-					if ( ErrorsFound ) {
+					if ( InitVarSpeedCoilErrorsFound ) {
 						ShowFatalError( "Preceding condition causes termination." );
 					}
 					// Check for valid range of (Rated Air Volume Flow Rate / Rated Total Capacity)
@@ -4033,13 +4108,6 @@ namespace VariableSpeedCoils {
 
 		bool LatDegradModelSimFlag; // Latent degradation model simulation flag
 		int NumIteration; // Iteration Counter
-		static int Count( 0 ); // No idea what this is for.
-		static bool firstTime( true );
-		static Real64 LoadSideInletDBTemp_Init; // rated conditions
-		static Real64 LoadSideInletWBTemp_Init; // rated conditions
-		static Real64 LoadSideInletHumRat_Init; // rated conditions
-		static Real64 LoadSideInletEnth_Init; // rated conditions
-		static Real64 CpAir_Init; // rated conditions
 		Real64 LoadSideInletDBTemp_Unit; // calc conditions for unit
 		Real64 LoadSideInletWBTemp_Unit; // calc conditions for unit
 		Real64 LoadSideInletHumRat_Unit; // calc conditions for unit
@@ -4068,12 +4136,6 @@ namespace VariableSpeedCoils {
 		Real64 MaxOutletEnth; // max possible outlet enthalpy
 
 		// ADDED VARIABLES FOR air source coil
-		static Real64 OutdoorDryBulb( 0.0 ); // Outdoor dry-bulb temperature at condenser (C)
-		static Real64 OutdoorWetBulb( 0.0 ); // Outdoor wet-bulb temperature at condenser (C)
-		static Real64 OutdoorHumRat( 0.0 ); // Outdoor humidity ratio at condenser (kg/kg)
-		static Real64 OutdoorPressure( 0.0 ); // Outdoor barometric pressure at condenser (Pa)
-		static Real64 CrankcaseHeatingPower( 0.0 ); // power due to crankcase heater
-		static Real64 CompAmbTemp( 0.0 ); // Ambient temperature at compressor
 		Real64 CondInletTemp; // Condenser inlet temperature (C). Outdoor dry-bulb temp for air-cooled condenser.
 		// Outdoor Wetbulb +(1 - effectiveness)*(outdoor drybulb - outdoor wetbulb) for evap condenser.
 		Real64 CondInletHumRat; // Condenser inlet humidity ratio (kg/kg). Zero for air-cooled condenser.
@@ -5165,19 +5227,6 @@ namespace VariableSpeedCoils {
 		Real64 rhoair( 0.0 );//entering air density
 
 		// ADDED VARIABLES FOR air source coil
-		static Real64 OutdoorCoilT( 0.0 ); // Outdoor coil temperature (C)
-		static Real64 OutdoorCoildw( 0.0 ); // Outdoor coil delta w assuming coil temp of OutdoorCoilT (kg/kg)
-		static Real64 OutdoorDryBulb( 0.0 ); // Outdoor dry-bulb temperature at condenser (C)
-		static Real64 OutdoorWetBulb( 0.0 ); // Outdoor wet-bulb temperature at condenser (C)
-		static Real64 OutdoorHumRat( 0.0 ); // Outdoor humidity ratio at condenser (kg/kg)
-		static Real64 OutdoorPressure( 0.0 ); // Outdoor barometric pressure at condenser (Pa)
-		static Real64 FractionalDefrostTime( 0.0 ); // Fraction of time step system is in defrost
-		static Real64 HeatingCapacityMultiplier( 0.0 ); // Multiplier for heating capacity when system is in defrost
-		static Real64 InputPowerMultiplier( 0.0 ); // Multiplier for power when system is in defrost
-		static Real64 LoadDueToDefrost( 0.0 ); // Additional load due to defrost
-		static Real64 CrankcaseHeatingPower( 0.0 ); // power due to crankcase heater
-		static Real64 DefrostEIRTempModFac( 0.0 ); // EIR modifier for defrost (function of entering wetbulb, outside drybulb)
-		static Real64 TotRatedCapacity( 0.0 ); // total rated capacity at the given speed and speed ratio for defrosting
 
 		MaxSpeed = VarSpeedCoil( DXCoilNum ).NumOfSpeeds;
 
@@ -5197,26 +5246,26 @@ namespace VariableSpeedCoils {
 		if ( VarSpeedCoil( DXCoilNum ).VSCoilTypeOfNum == Coil_HeatingAirToAirVariableSpeed ) {
 			// Get condenser outdoor node info from DX Heating Coil
 			if ( VarSpeedCoil( DXCoilNum ).CondenserInletNodeNum != 0 ) {
-				OutdoorDryBulb = Node( VarSpeedCoil( DXCoilNum ).CondenserInletNodeNum ).Temp;
-				OutdoorHumRat = Node( VarSpeedCoil( DXCoilNum ).CondenserInletNodeNum ).HumRat;
-				OutdoorPressure = Node( VarSpeedCoil( DXCoilNum ).CondenserInletNodeNum ).Press;
-				OutdoorWetBulb = Node( VarSpeedCoil( DXCoilNum ).CondenserInletNodeNum ).OutAirWetBulb;
+				CalcVarSpeedCoilHeatingOutdoorDryBulb = Node( VarSpeedCoil( DXCoilNum ).CondenserInletNodeNum ).Temp;
+				CalcVarSpeedCoilHeatingOutdoorHumRat = Node( VarSpeedCoil( DXCoilNum ).CondenserInletNodeNum ).HumRat;
+				CalcVarSpeedCoilHeatingOutdoorPressure = Node( VarSpeedCoil( DXCoilNum ).CondenserInletNodeNum ).Press;
+				CalcVarSpeedCoilHeatingOutdoorWetBulb = Node( VarSpeedCoil( DXCoilNum ).CondenserInletNodeNum ).OutAirWetBulb;
 			} else {
-				OutdoorDryBulb = OutDryBulbTemp;
-				OutdoorHumRat = OutHumRat;
-				OutdoorPressure = OutBaroPress;
-				OutdoorWetBulb = OutWetBulbTemp;
+				CalcVarSpeedCoilHeatingOutdoorDryBulb = OutDryBulbTemp;
+				CalcVarSpeedCoilHeatingOutdoorHumRat = OutHumRat;
+				CalcVarSpeedCoilHeatingOutdoorPressure = OutBaroPress;
+				CalcVarSpeedCoilHeatingOutdoorWetBulb = OutWetBulbTemp;
 			}
 			SourceSideMassFlowRate = 1.0; // not used and avoid divided by zero
-			SourceSideInletTemp = OutdoorDryBulb;
-			SourceSideInletEnth = PsyHFnTdbW( OutdoorDryBulb, OutdoorHumRat );
-			CpSource = PsyCpAirFnWTdb( OutHumRat, OutdoorDryBulb );
+			SourceSideInletTemp = CalcVarSpeedCoilHeatingOutdoorDryBulb;
+			SourceSideInletEnth = PsyHFnTdbW( CalcVarSpeedCoilHeatingOutdoorDryBulb, CalcVarSpeedCoilHeatingOutdoorHumRat );
+			CpSource = PsyCpAirFnWTdb( OutHumRat, CalcVarSpeedCoilHeatingOutdoorDryBulb );
 
 			// Initialize crankcase heater, operates below OAT defined in input deck for HP DX heating coil
-			if ( OutdoorDryBulb < VarSpeedCoil( DXCoilNum ).MaxOATCrankcaseHeater ) {
-				CrankcaseHeatingPower = VarSpeedCoil( DXCoilNum ).CrankcaseHeaterCapacity;
+			if ( CalcVarSpeedCoilHeatingOutdoorDryBulb < VarSpeedCoil( DXCoilNum ).MaxOATCrankcaseHeater ) {
+				CalcVarSpeedCoilHeatingCrankcaseHeatingPower = VarSpeedCoil( DXCoilNum ).CrankcaseHeaterCapacity;
 			} else {
-				CrankcaseHeatingPower = 0.0;
+				CalcVarSpeedCoilHeatingCrankcaseHeatingPower = 0.0;
 			}
 		} else {
 			SourceSideMassFlowRate = VarSpeedCoil( DXCoilNum ).WaterMassFlowRate;
@@ -5233,7 +5282,7 @@ namespace VariableSpeedCoils {
 			VarSpeedCoil( DXCoilNum ).SimFlag = true;
 		}
 
-		if ( ( VarSpeedCoil( DXCoilNum ).VSCoilTypeOfNum == Coil_HeatingAirToAirVariableSpeed ) && ( OutdoorDryBulb < VarSpeedCoil( DXCoilNum ).MinOATCompressor ) ) {
+		if ( ( VarSpeedCoil( DXCoilNum ).VSCoilTypeOfNum == Coil_HeatingAirToAirVariableSpeed ) && ( CalcVarSpeedCoilHeatingOutdoorDryBulb < VarSpeedCoil( DXCoilNum ).MinOATCompressor ) ) {
 			VarSpeedCoil( DXCoilNum ).SimFlag = false;
 			return;
 		}
@@ -5391,8 +5440,8 @@ namespace VariableSpeedCoils {
 		if ( VarSpeedCoil( DXCoilNum ).VSCoilTypeOfNum == Coil_HeatingAirToAirVariableSpeed ) {
 			// Calculating adjustment factors for defrost
 			// Calculate delta w through outdoor coil by assuming a coil temp of 0.82*DBT-9.7(F) per DOE2.1E
-			OutdoorCoilT = 0.82 * OutdoorDryBulb - 8.589;
-			OutdoorCoildw = max( 1.0e-6, ( OutdoorHumRat - PsyWFnTdpPb( OutdoorCoilT, OutdoorPressure ) ) );
+			OutdoorCoilT = 0.82 * CalcVarSpeedCoilHeatingOutdoorDryBulb - 8.589;
+			OutdoorCoildw = max( 1.0e-6, ( CalcVarSpeedCoilHeatingOutdoorHumRat - PsyWFnTdpPb( OutdoorCoilT, CalcVarSpeedCoilHeatingOutdoorPressure ) ) );
 
 			// Initializing defrost adjustment factors
 			LoadDueToDefrost = 0.0;
@@ -5400,7 +5449,7 @@ namespace VariableSpeedCoils {
 			FractionalDefrostTime = 0.0;
 			InputPowerMultiplier = 1.0;
 			// Check outdoor temperature to determine of defrost is active
-			if ( OutdoorDryBulb <= VarSpeedCoil( DXCoilNum ).MaxOATDefrost ) {
+			if ( CalcVarSpeedCoilHeatingOutdoorDryBulb <= VarSpeedCoil( DXCoilNum ).MaxOATDefrost ) {
 				// Calculate defrost adjustment factors depending on defrost control type
 				if ( VarSpeedCoil( DXCoilNum ).DefrostControl == Timed ) {
 					FractionalDefrostTime = VarSpeedCoil( DXCoilNum ).DefrostTime;
@@ -5417,8 +5466,8 @@ namespace VariableSpeedCoils {
 				if ( FractionalDefrostTime > 0.0 ) {
 					// Calculate defrost adjustment factors depending on defrost control strategy
 					if ( VarSpeedCoil( DXCoilNum ).DefrostStrategy == ReverseCycle ) {
-						LoadDueToDefrost = ( 0.01 * FractionalDefrostTime ) * ( 7.222 - OutdoorDryBulb ) * ( TotRatedCapacity / 1.01667 );
-						DefrostEIRTempModFac = CurveValue( VarSpeedCoil( DXCoilNum ).DefrostEIRFT, max( 15.555, LoadSideInletWBTemp ), max( 15.555, OutdoorDryBulb ) );
+						LoadDueToDefrost = ( 0.01 * FractionalDefrostTime ) * ( 7.222 - CalcVarSpeedCoilHeatingOutdoorDryBulb ) * ( TotRatedCapacity / 1.01667 );
+						DefrostEIRTempModFac = CurveValue( VarSpeedCoil( DXCoilNum ).DefrostEIRFT, max( 15.555, LoadSideInletWBTemp ), max( 15.555, CalcVarSpeedCoilHeatingOutdoorDryBulb ) );
 						VarSpeedCoil( DXCoilNum ).DefrostPower = DefrostEIRTempModFac * ( TotRatedCapacity / 1.01667 ) * FractionalDefrostTime;
 					} else { // Defrost strategy is resistive
 						VarSpeedCoil( DXCoilNum ).DefrostPower = VarSpeedCoil( DXCoilNum ).DefrostCapacity * FractionalDefrostTime;
@@ -5428,7 +5477,7 @@ namespace VariableSpeedCoils {
 				}
 			}
 
-			VarSpeedCoil( DXCoilNum ).CrankcaseHeaterPower = CrankcaseHeatingPower * ( 1.0 - RuntimeFrac );
+			VarSpeedCoil( DXCoilNum ).CrankcaseHeaterPower = CalcVarSpeedCoilHeatingCrankcaseHeatingPower * ( 1.0 - RuntimeFrac );
 			//! Modify total heating capacity based on defrost heating capacity multiplier
 			//! MaxHeatCap passed from parent object VRF Condenser and is used to limit capacity of TU's to that available from condenser
 			//  IF(PRESENT(MaxHeatCap))THEN
@@ -6305,6 +6354,20 @@ namespace VariableSpeedCoils {
 
 		// Using/Aliasing
 		using CurveManager::CurveValue;
+		using DataSystemVariables::MemoizeDXCoilEnvFlag;
+		using DXCoils::CoilPerfMemoKey;
+		using DXCoils::CoilPerfMemoValues;
+		using DXCoils::QuantizeCoilPerfMemo;
+		using DXCoils::FindCoilPerfMemo;
+		using DXCoils::StoreCoilPerfMemo;
+		using DXCoils::VarSpeedTotCapSHRMemo;
+		using DXCoils::MemoTempQuantum;
+		using DXCoils::MemoHumRatQuantum;
+		using DXCoils::MemoEnthalpyQuantum;
+		using DXCoils::MemoPressureQuantum;
+		using DXCoils::MemoMassFlowQuantum;
+		using DXCoils::MemoRatioQuantum;
+		using DXCoils::MemoCapacityQuantum;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -6341,7 +6404,19 @@ namespace VariableSpeedCoils {
 		Real64 RF; // Relaxation factor for dry evaporator iterations
 		Real64 Tolerance; // Error tolerance for dry evaporator iterations
 		Real64 werror; // Deviation of humidity ratio in dry evaporator iteration loop
-		static bool LoopOn( true ); // flag to control the loop iteration
+		CoilPerfMemoKey MemoKey; // quantized inputs of the calculation
+		CoilPerfMemoValues MemoValues; // memoized total capacities and SHR
+
+		if ( MemoizeDXCoilEnvFlag ) {
+			MemoKey = { { QuantizeCoilPerfMemo( InletDryBulb, MemoTempQuantum ), QuantizeCoilPerfMemo( InletHumRat, MemoHumRatQuantum ), QuantizeCoilPerfMemo( InletEnthalpy, MemoEnthalpyQuantum ), QuantizeCoilPerfMemo( InletWetBulb, MemoTempQuantum ), QuantizeCoilPerfMemo( AirMassFlowRatio, MemoRatioQuantum ), QuantizeCoilPerfMemo( WaterMassFlowRatio, MemoRatioQuantum ), QuantizeCoilPerfMemo( AirMassFlow, MemoMassFlowQuantum ), QuantizeCoilPerfMemo( CBF, MemoRatioQuantum ), QuantizeCoilPerfMemo( TotCapNom1, MemoCapacityQuantum ), CCapFTemp1, CCapAirFFlow1, CCapWaterFFlow1, QuantizeCoilPerfMemo( TotCapNom2, MemoCapacityQuantum ), CCapFTemp2, CCapAirFFlow2, CCapWaterFFlow2, QuantizeCoilPerfMemo( CondInletTemp, MemoTempQuantum ), QuantizeCoilPerfMemo( Pressure, MemoPressureQuantum ), QuantizeCoilPerfMemo( SpeedRatio, MemoRatioQuantum ), NumSpeeds } };
+			if ( FindCoilPerfMemo( VarSpeedTotCapSHRMemo, MemoKey, MemoValues ) ) {
+				TotCap1 = MemoValues[ 0 ];
+				TotCap2 = MemoValues[ 1 ];
+				TotCapSpeed = MemoValues[ 2 ];
+				SHR = MemoValues[ 3 ];
+				return;
+			}
+		}
 
 		MaxIter = 30;
 		RF = 0.4;
@@ -6433,6 +6508,8 @@ namespace VariableSpeedCoils {
 		TotCap2 = TotCapCalc2;
 		TotCapSpeed = TotCapCalc;
 
+		if ( MemoizeDXCoilEnvFlag ) StoreCoilPerfMemo( VarSpeedTotCapSHRMemo, MemoKey, { { TotCap1, TotCap2, TotCapSpeed, SHR } } );
+
 		// IF(SHR < 0.3d0) SHR = 0.3d0
 
 	}
@@ -6523,7 +6600,6 @@ namespace VariableSpeedCoils {
 
 		// FUNCTION PARAMETER DEFINITIONS:
 		static std::string const RoutineName( "CalcCBF" );
-		static Real64 SmallDifferenceTest( 0.00000001 );
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		Real64 InletAirEnthalpy; // Enthalpy of inlet air to evaporator at given conditions [J/kg]
@@ -6546,7 +6622,6 @@ namespace VariableSpeedCoils {
 		Real64 Slope( 0.0 ); // Calculated Slope used while hunting for Tadp
 		Real64 Tolerance; // Convergence tolerance for CBF calculations
 		Real64 HTinHumRatOut; // Air enthalpy at inlet air temp and outlet air humidity ratio [J/kg]
-		static bool CBFErrors( false ); // Set to true if errors in CBF calculation, fatal at end of routine
 
 		OutletAirTemp = InletAirTemp;
 		OutletAirHumRat = InletAirHumRat;
@@ -131,8 +131,25 @@ namespace Vectors {
 
 	//SUBROUTINE SPECIFICATIONS FOR MODULE <module_name>
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		Vector p0( 0.0, 0.0, 0.0 );
+	}
+
 	// Functions
 
+	// Clears the global data in Vectors.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		p0 = Vector( 0.0, 0.0, 0.0 );
+	}
+
 	Real64
 	AreaPolygon(
 		int const n,
@@ -869,7 +886,6 @@ namespace Vectors {
 		Real64 PyramidVolume;
 
 		// Object Data
-		static Vector p0( 0.0, 0.0, 0.0 );
 		Vector p3FaceOrigin;
 
 		Volume = 0.0;
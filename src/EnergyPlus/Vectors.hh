@@ -87,6 +87,11 @@ namespace Vectors {
 
 	// Functions
 
+	// Clears the global data in Vectors.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	Real64
 	AreaPolygon(
 		int const n,
@@ -215,6 +215,34 @@ namespace VentilatedSlab {
 	Array1D< VentilatedSlabData > VentSlab;
 	Array1D< VentSlabNumericFieldData > VentSlabNumericFields;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // First time, input is "gotten"
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool MyOneTimeFlag( true );
+		bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool MyPlantScanFlag;
+		Array1D_bool MyZoneEqFlag; // used to set up zone equipment availability managers
+		int CoilWaterInletNode( 0 );
+		int CoilWaterOutletNode( 0 );
+		int CoilSteamInletNode( 0 );
+		int CoilSteamOutletNode( 0 );
+		int DummyWaterIndex( 1 );
+		bool CalcVentilatedSlabErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		Real64 Ckj; // Coefficients for individual surfaces within a radiant system
+		Real64 Cmj;
+		Array1D< Real64 > AirTempOut; // Array of outlet air temperatures for each surface in the radiant system
+		bool CalcVentilatedSlabRadCompsErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		int CondensationErrorCount( 0 ); // Counts for # times the radiant systems are shutdown due to condensation
+		int EnergyImbalanceErrorCount( 0 ); // Counts for # times a temperature mismatch is found in the energy balance check
+		bool FirstTimeFlag( true ); // for setting size of Ckj, Cmj, AirTempOut arrays
+	}
+
 	// Functions
 
 	void
@@ -234,6 +262,26 @@ namespace VentilatedSlab {
 		MySizeFlag.deallocate();
 		VentSlab.deallocate();
 		VentSlabNumericFields.deallocate();
+		GetInputFlag = true;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		ZoneEquipmentListChecked = false;
+		MyEnvrnFlag.deallocate();
+		MyPlantScanFlag.deallocate();
+		MyZoneEqFlag.deallocate();
+		CoilWaterInletNode = 0;
+		CoilWaterOutletNode = 0;
+		CoilSteamInletNode = 0;
+		CoilSteamOutletNode = 0;
+		DummyWaterIndex = 1;
+		CalcVentilatedSlabErrorsFound = false;
+		Ckj = 0.0;
+		Cmj = 0.0;
+		AirTempOut.deallocate();
+		CalcVentilatedSlabRadCompsErrorsFound = false;
+		CondensationErrorCount = 0;
+		EnergyImbalanceErrorCount = 0;
+		FirstTimeFlag = true;
 	}
 
 	void
@@ -282,7 +330,6 @@ namespace VentilatedSlab {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int Item; // index of ventilated slab being simulated
-		static bool GetInputFlag( true ); // First time, input is "gotten"
 
 		// FLOW:
 		if ( GetInputFlag ) {
@@ -393,7 +440,6 @@ namespace VentilatedSlab {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		int IOStatus; // Used in GetObjectItem
 		bool IsBlank; // TRUE if the name is blank
 		bool IsNotOK; // TRUE if there was a problem with a list name
@@ -1186,11 +1232,6 @@ namespace VentilatedSlab {
 
 		int AirRelNode; // relief air node number in Ventilated Slab loop
 		int ColdConNode; // cold water control node number in Ventilated Slab loop
-		static bool MyOneTimeFlag( true );
-		static bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool MyPlantScanFlag;
-		static Array1D_bool MyZoneEqFlag; // used to set up zone equipment availability managers
 		int HotConNode; // hot water control node number in Ventilated Slab loop
 		int InNode; // inlet node number in Ventilated Slab loop
 		int OutNode; // outlet node number in Ventilated Slab loop
@@ -1500,15 +1541,10 @@ namespace VentilatedSlab {
 		Real64 EnthSteamOutWet;
 		Real64 LatentHeatSteam;
 		Real64 SteamDensity;
-		static int CoilWaterInletNode( 0 );
-		static int CoilWaterOutletNode( 0 );
-		static int CoilSteamInletNode( 0 );
-		static int CoilSteamOutletNode( 0 );
 		std::string CoolingCoilName;
 		std::string CoolingCoilType;
 		Real64 rho;
 		Real64 Cp;
-		static int DummyWaterIndex( 1 );
 		bool IsAutoSize; // Indicator to autosize
 		Real64 MaxAirVolFlowDes; // Autosized maximum air flow for reporting
 		Real64 MaxAirVolFlowUser; // Hardsized maximum air flow for reporting
@@ -2174,7 +2210,6 @@ namespace VentilatedSlab {
 		std::string SlabName;
 		int MSlabInletNode;
 		int MSlabOutletNode;
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		static std::string const CurrentModuleObject( "ZoneHVAC:VentilatedSlab" );
 
 		{ auto const SELECT_CASE_var( VentSlab( Item ).CoilOption );
@@ -2326,8 +2361,8 @@ namespace VentilatedSlab {
 					SlabName = VentSlab( Item ).SurfaceName( RadSurfNum );
 					MSlabIn = VentSlab( Item ).SlabIn( RadSurfNum );
 					MSlabOut = VentSlab( Item ).SlabOut( RadSurfNum );
-					VentSlab( Item ).MSlabInNode = GetOnlySingleNode( MSlabIn, ErrorsFound, CurrentModuleObject, SlabName, NodeType_Air, NodeConnectionType_Internal, 1, ObjectIsNotParent );
-					VentSlab( Item ).MSlabOutNode = GetOnlySingleNode( MSlabOut, ErrorsFound, CurrentModuleObject, SlabName, NodeType_Air, NodeConnectionType_Internal, 1, ObjectIsNotParent );
+					VentSlab( Item ).MSlabInNode = GetOnlySingleNode( MSlabIn, CalcVentilatedSlabErrorsFound, CurrentModuleObject, SlabName, NodeType_Air, NodeConnectionType_Internal, 1, ObjectIsNotParent );
+					VentSlab( Item ).MSlabOutNode = GetOnlySingleNode( MSlabOut, CalcVentilatedSlabErrorsFound, CurrentModuleObject, SlabName, NodeType_Air, NodeConnectionType_Internal, 1, ObjectIsNotParent );
 					MSlabInletNode = VentSlab( Item ).MSlabInNode;
 					MSlabOutletNode = VentSlab( Item ).MSlabOutNode;
 
@@ -3104,9 +3139,6 @@ namespace VentilatedSlab {
 		Real64 Cl;
 		// For more info on Ca through Cl, refer Constant Flow Radiant System
 		//unused0309  REAL(r64):: CoreNumber
-		static Real64 Ckj; // Coefficients for individual surfaces within a radiant system
-		static Real64 Cmj;
-		static Array1D< Real64 > AirTempOut; // Array of outlet air temperatures for each surface in the radiant system
 		int FanOutletNode; // unit air outlet node
 		int OAInletNode; // unit air outlet node
 		int MixoutNode; // unit air outlet node
@@ -3119,16 +3151,12 @@ namespace VentilatedSlab {
 		Real64 FlowFrac;
 		//unused0309  REAL(r64)  :: SlabAirOutTemp
 		Real64 MSlabAirInTemp;
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 
 		std::string MSlabIn;
 		std::string MSlabOut;
 		std::string SlabName;
 		int MSlabInletNode;
 		int MSlabOutletNode;
-		static int CondensationErrorCount( 0 ); // Counts for # times the radiant systems are shutdown due to condensation
-		static int EnergyImbalanceErrorCount( 0 ); // Counts for # times a temperature mismatch is found in the energy balance check
-		static bool FirstTimeFlag( true ); // for setting size of Ckj, Cmj, AirTempOut arrays
 
 		// FLOW:
 
@@ -3586,8 +3614,8 @@ namespace VentilatedSlab {
 					SlabName = VentSlab( Item ).SurfaceName( RadSurfNum );
 					MSlabIn = VentSlab( Item ).SlabIn( RadSurfNum );
 					MSlabOut = VentSlab( Item ).SlabOut( RadSurfNum );
-					VentSlab( Item ).MSlabInNode = GetOnlySingleNode( MSlabIn, ErrorsFound, CurrentModuleObject, SlabName, NodeType_Air, NodeConnectionType_Internal, 1, ObjectIsNotParent );
-					VentSlab( Item ).MSlabOutNode = GetOnlySingleNode( MSlabOut, ErrorsFound, CurrentModuleObject, SlabName, NodeType_Air, NodeConnectionType_Internal, 1, ObjectIsNotParent );
+					VentSlab( Item ).MSlabInNode = GetOnlySingleNode( MSlabIn, CalcVentilatedSlabRadCompsErrorsFound, CurrentModuleObject, SlabName, NodeType_Air, NodeConnectionType_Internal, 1, ObjectIsNotParent );
+					VentSlab( Item ).MSlabOutNode = GetOnlySingleNode( MSlabOut, CalcVentilatedSlabRadCompsErrorsFound, CurrentModuleObject, SlabName, NodeType_Air, NodeConnectionType_Internal, 1, ObjectIsNotParent );
 					MSlabInletNode = VentSlab( Item ).MSlabInNode;
 					MSlabOutletNode = VentSlab( Item ).MSlabOutNode;
 					SurfNum = VentSlab( Item ).SurfacePtr( RadSurfNum );
@@ -212,6 +212,44 @@ namespace WaterCoils {
 	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
 	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
 		bool InitWaterCoilOneTimeFlag( true );
+		int NumSimpHeat( 0 );
+		int NumFlatFin( 0 );
+		int NumCooling( 0 );
+		int MaxNums( 0 ); // Maximum number of numeric input fields
+		int MaxAlphas( 0 ); // Maximum number of alpha input fields
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		bool GetWaterCoilInputErrorsFound( false ); // If errors detected in input
+		int j1( 0 );
+		Real64 TOutNew( 0.0 ); // reset outlet air temperature for Coil:Cooling:Water
+		Real64 WOutNew( 0.0 ); // reset outlet air humidity ratio for Coil:Cooling:Water
+		Array1D< Real64 > DesCpAir; // CpAir at Design Inlet Air Temp
+		Array1D< Real64 > DesUARangeCheck; // Value for range check based on Design Inlet Air Humidity Ratio
+		Array1D_bool MyEnvrnFlag;
+		Array1D_bool MyCoilReportFlag;
+		Array1D_bool PlantLoopScanFlag;
+		Array1D< Real64 > CoefSeries( 5 ); //Tuned Changed to static: High call count: Set before use
+		Array1D< Real64 > InitWaterCoilPar( 4 ); //Tuned Changed to static: High call count: Set before use
+		bool NoSatCurveIntersect( false ); // TRUE if failed to find appatatus dew-point
+		bool BelowInletWaterTemp( false ); // TRUE if apparatus dew-point below design inlet water temperature
+		bool CBFTooLarge( false ); // TRUE if the coil bypass factor is unrealistically large
+		bool NoExitCondReset( false ); // TRUE if exit condition reset is not to be done
+		Real64 RatedLatentCapacity( 0.0 ); // latent cooling capacity at the rating point [W]
+		Real64 RatedSHR( 0.0 ); // sensible heat ratio at the rating point
+		Real64 CapacitanceWater( 0.0 ); // capacitance of the water stream [W/K]
+		Real64 CMin( 0.0 ); // minimum capacitance of 2 streams [W/K]
+		Real64 CoilEffectiveness( 0.0 ); // effectiveness of the coil (rated)
+		Real64 SurfaceArea( 0.0 ); // heat exchanger surface area, [m2]
+		Real64 UATotal( 0.0 ); // heat exchanger UA total, [W/C]
+		Array1D_bool RptCoilHeaderFlag( 2, true );
+		Real64 EnthCorrFrac( 0.0 ); // enthalpy correction factor
+		Real64 TempCorrFrac( 0.0 ); // temperature correction factor
+		Real64 rSchVal( 0.0 );
+		Real64 effectiveness( 0.0 ); // Heat exchanger effectiveness
+		Array2D< Real64 > CalcDryFinEffCoefOrderedPair( MaxOrderedPairs, 2 ); //Tuned Changed to static: Set before use
+		Array2D< Real64 > OrdPairSum( 10, 2 ); //Tuned Changed to static and whole array zero-initialized
+		Array2D< Real64 > OrdPairSumMatrix( 10, 10 ); //Tuned Changed to static
+		Real64 TdbFnHRhPbTprov( 0.0 ); // provisional value of drybulb temperature [C]
+		bool DidAnythingChange( false ); // set to true if conditions changed
 	}
 	// Subroutine Specifications for the Module
 	// Driver/Manager Routines
@@ -251,6 +289,44 @@ namespace WaterCoils {
 		CheckEquipName.deallocate();
 		WaterCoil.deallocate();
 		WaterCoilNumericFields.deallocate();
+		NumSimpHeat = 0;
+		NumFlatFin = 0;
+		NumCooling = 0;
+		MaxNums = 0;
+		MaxAlphas = 0;
+		TotalArgs = 0;
+		GetWaterCoilInputErrorsFound = false;
+		j1 = 0;
+		TOutNew = 0.0;
+		WOutNew = 0.0;
+		DesCpAir.deallocate();
+		DesUARangeCheck.deallocate();
+		MyEnvrnFlag.deallocate();
+		MyCoilReportFlag.deallocate();
+		PlantLoopScanFlag.deallocate();
+		CoefSeries = Array1D< Real64 >( 5 );
+		InitWaterCoilPar = Array1D< Real64 >( 4 );
+		NoSatCurveIntersect = false;
+		BelowInletWaterTemp = false;
+		CBFTooLarge = false;
+		NoExitCondReset = false;
+		RatedLatentCapacity = 0.0;
+		RatedSHR = 0.0;
+		CapacitanceWater = 0.0;
+		CMin = 0.0;
+		CoilEffectiveness = 0.0;
+		SurfaceArea = 0.0;
+		UATotal = 0.0;
+		RptCoilHeaderFlag = Array1D_bool( 2, true );
+		EnthCorrFrac = 0.0;
+		TempCorrFrac = 0.0;
+		rSchVal = 0.0;
+		effectiveness = 0.0;
+		CalcDryFinEffCoefOrderedPair = Array2D< Real64 >( MaxOrderedPairs, 2 );
+		OrdPairSum = Array2D< Real64 >( 10, 2 );
+		OrdPairSumMatrix = Array2D< Real64 >( 10, 10 );
+		TdbFnHRhPbTprov = 0.0;
+		DidAnythingChange = false;
 	}
 
 	void
@@ -413,9 +489,6 @@ namespace WaterCoils {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int CoilNum; // The WaterCoil that you are currently loading input into
-		static int NumSimpHeat( 0 );
-		static int NumFlatFin( 0 );
-		static int NumCooling( 0 );
 		int SimpHeatNum;
 		int FlatFinNum;
 		int CoolingNum;
@@ -429,15 +502,10 @@ namespace WaterCoils {
 		Array1D< Real64 > NumArray; // Numeric input items for object
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int MaxNums( 0 ); // Maximum number of numeric input fields
-		static int MaxAlphas( 0 ); // Maximum number of alpha input fields
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 		//  certain object in the input file
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool errFlag;
-		static int j1( 0 );
 
 		// Flow
 		NumSimpHeat = GetNumObjectsFound( "Coil:Heating:Water" );
@@ -486,12 +554,12 @@ namespace WaterCoils {
 			IsBlank = false;
 			VerifyName( AlphArray( 1 ), WaterCoil, CoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetWaterCoilInputErrorsFound = true;
 				if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, AlphArray( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetWaterCoilInputErrorsFound = true;
 			}
 			WaterCoil( CoilNum ).Name = AlphArray( 1 );
 			WaterCoil( CoilNum ).Schedule = AlphArray( 2 );
@@ -501,7 +569,7 @@ namespace WaterCoils {
 				WaterCoil( CoilNum ).SchedPtr = GetScheduleIndex( AlphArray( 2 ) );
 				if ( WaterCoil( CoilNum ).SchedPtr == 0 ) {
 					ShowSevereError( CurrentModuleObject + ": invalid " + cAlphaFields( 2 ) + " entered =" + AlphArray( 2 ) + " for " + cAlphaFields( 1 ) + '=' + AlphArray( 1 ) );
-					ErrorsFound = true;
+					GetWaterCoilInputErrorsFound = true;
 				}
 			}
 
@@ -514,10 +582,10 @@ namespace WaterCoils {
 			WaterCoil( CoilNum ).UACoil = NumArray( 1 );
 			WaterCoil( CoilNum ).UACoilVariable = WaterCoil( CoilNum ).UACoil;
 			WaterCoil( CoilNum ).MaxWaterVolFlowRate = NumArray( 2 );
-			WaterCoil( CoilNum ).WaterInletNodeNum = GetOnlySingleNode( AlphArray( 3 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
-			WaterCoil( CoilNum ).WaterOutletNodeNum = GetOnlySingleNode( AlphArray( 4 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
-			WaterCoil( CoilNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 5 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			WaterCoil( CoilNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 6 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			WaterCoil( CoilNum ).WaterInletNodeNum = GetOnlySingleNode( AlphArray( 3 ), GetWaterCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+			WaterCoil( CoilNum ).WaterOutletNodeNum = GetOnlySingleNode( AlphArray( 4 ), GetWaterCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+			WaterCoil( CoilNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 5 ), GetWaterCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			WaterCoil( CoilNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 6 ), GetWaterCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			{ auto const SELECT_CASE_var( AlphArray( 7 ) );
 			if ( SELECT_CASE_var == "UFACTORTIMESAREAANDDESIGNWATERFLOWRATE" ) {
@@ -546,17 +614,17 @@ namespace WaterCoils {
 			if ( WaterCoil( CoilNum ).DesInletWaterTemp <= WaterCoil( CoilNum ).DesOutletWaterTemp ) {
 				ShowSevereError( "For " + CurrentModuleObject + ", " + AlphArray( 1 ) );
 				ShowContinueError( "  the " + cNumericFields( 4 ) + " must be greater than the " + cNumericFields( 6 ) + '.' );
-				ErrorsFound = true;
+				GetWaterCoilInputErrorsFound = true;
 			}
 			if ( WaterCoil( CoilNum ).DesInletAirTemp >= WaterCoil( CoilNum ).DesOutletAirTemp ) {
 				ShowSevereError( "For " + CurrentModuleObject + ", " + AlphArray( 1 ) );
 				ShowContinueError( "  the " + cNumericFields( 5 ) + " must be less than the " + cNumericFields( 7 ) + '.' );
-				ErrorsFound = true;
+				GetWaterCoilInputErrorsFound = true;
 			}
 			if ( WaterCoil( CoilNum ).DesInletAirTemp >= WaterCoil( CoilNum ).DesInletWaterTemp ) {
 				ShowSevereError( "For " + CurrentModuleObject + ", " + AlphArray( 1 ) );
 				ShowContinueError( "  the " + cNumericFields( 5 ) + " must be less than the " + cNumericFields( 4 ) + '.' );
-				ErrorsFound = true;
+				GetWaterCoilInputErrorsFound = true;
 			}
 
 			TestCompSet( CurrentModuleObject, AlphArray( 1 ), AlphArray( 3 ), AlphArray( 4 ), "Water Nodes" );
@@ -587,12 +655,12 @@ namespace WaterCoils {
 			IsBlank = false;
 			VerifyName( AlphArray( 1 ), WaterCoil, CoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetWaterCoilInputErrorsFound = true;
 				if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, AlphArray( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetWaterCoilInputErrorsFound = true;
 			}
 			WaterCoil( CoilNum ).Name = AlphArray( 1 );
 			WaterCoil( CoilNum ).Schedule = AlphArray( 2 );
@@ -602,7 +670,7 @@ namespace WaterCoils {
 				WaterCoil( CoilNum ).SchedPtr = GetScheduleIndex( AlphArray( 2 ) );
 				if ( WaterCoil( CoilNum ).SchedPtr == 0 ) {
 					ShowSevereError( CurrentModuleObject + ": invalid " + cAlphaFields( 2 ) + " entered =" + AlphArray( 2 ) + " for " + cAlphaFields( 1 ) + '=' + AlphArray( 1 ) );
-					ErrorsFound = true;
+					GetWaterCoilInputErrorsFound = true;
 				}
 			}
 
@@ -629,29 +697,29 @@ namespace WaterCoils {
 			WaterCoil( CoilNum ).FinThickness = NumArray( 8 );
 			if ( WaterCoil( CoilNum ).FinThickness <= 0.0 ) {
 				ShowSevereError( CurrentModuleObject + ": " + cNumericFields( 8 ) + " must be > 0.0, for " + cAlphaFields( 1 ) + " = " + WaterCoil( CoilNum ).Name );
-				ErrorsFound = true;
+				GetWaterCoilInputErrorsFound = true;
 			}
 			WaterCoil( CoilNum ).TubeInsideDiam = NumArray( 9 );
 			WaterCoil( CoilNum ).TubeOutsideDiam = NumArray( 10 );
 			WaterCoil( CoilNum ).TubeThermConductivity = NumArray( 11 );
 			if ( WaterCoil( CoilNum ).TubeThermConductivity <= 0.0 ) {
 				ShowSevereError( CurrentModuleObject + ": " + cNumericFields( 11 ) + " must be > 0.0, for " + cAlphaFields( 1 ) + " = " + WaterCoil( CoilNum ).Name );
-				ErrorsFound = true;
+				GetWaterCoilInputErrorsFound = true;
 			}
 			WaterCoil( CoilNum ).FinThermConductivity = NumArray( 12 );
 			if ( WaterCoil( CoilNum ).FinThermConductivity <= 0.0 ) {
 				ShowSevereError( CurrentModuleObject + ": " + cNumericFields( 12 ) + " must be > 0.0, for " + cAlphaFields( 1 ) + " = " + WaterCoil( CoilNum ).Name );
-				ErrorsFound = true;
+				GetWaterCoilInputErrorsFound = true;
 			}
 			WaterCoil( CoilNum ).FinSpacing = NumArray( 13 );
 			WaterCoil( CoilNum ).TubeDepthSpacing = NumArray( 14 );
 			WaterCoil( CoilNum ).NumOfTubeRows = NumArray( 15 );
 			WaterCoil( CoilNum ).NumOfTubesPerRow = NumArray( 16 );
 			if ( WaterCoil( CoilNum ).NumOfTubesPerRow == AutoSize ) WaterCoil( CoilNum ).RequestingAutoSize = true;
-			WaterCoil( CoilNum ).WaterInletNodeNum = GetOnlySingleNode( AlphArray( 3 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
-			WaterCoil( CoilNum ).WaterOutletNodeNum = GetOnlySingleNode( AlphArray( 4 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
-			WaterCoil( CoilNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 5 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			WaterCoil( CoilNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 6 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			WaterCoil( CoilNum ).WaterInletNodeNum = GetOnlySingleNode( AlphArray( 3 ), GetWaterCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+			WaterCoil( CoilNum ).WaterOutletNodeNum = GetOnlySingleNode( AlphArray( 4 ), GetWaterCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+			WaterCoil( CoilNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 5 ), GetWaterCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			WaterCoil( CoilNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 6 ), GetWaterCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			// A7 ; \field Name of Water Storage Tank for Condensate Collection
 			WaterCoil( CoilNum ).CondensateCollectName = AlphArray( 7 );
@@ -659,7 +727,7 @@ namespace WaterCoils {
 				WaterCoil( CoilNum ).CondensateCollectMode = CondensateDiscarded;
 			} else {
 				WaterCoil( CoilNum ).CondensateCollectMode = CondensateToTank;
-				SetupTankSupplyComponent( WaterCoil( CoilNum ).Name, CurrentModuleObject, WaterCoil( CoilNum ).CondensateCollectName, ErrorsFound, WaterCoil( CoilNum ).CondensateTankID, WaterCoil( CoilNum ).CondensateTankSupplyARRID );
+				SetupTankSupplyComponent( WaterCoil( CoilNum ).Name, CurrentModuleObject, WaterCoil( CoilNum ).CondensateCollectName, GetWaterCoilInputErrorsFound, WaterCoil( CoilNum ).CondensateTankID, WaterCoil( CoilNum ).CondensateTankSupplyARRID );
 			}
 
 			TestCompSet( CurrentModuleObject, AlphArray( 1 ), AlphArray( 3 ), AlphArray( 4 ), "Water Nodes" );
@@ -697,12 +765,12 @@ namespace WaterCoils {
 			IsBlank = false;
 			VerifyName( AlphArray( 1 ), WaterCoil, CoilNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetWaterCoilInputErrorsFound = true;
 				if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, AlphArray( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetWaterCoilInputErrorsFound = true;
 			}
 			WaterCoil( CoilNum ).Name = AlphArray( 1 );
 			WaterCoil( CoilNum ).Schedule = AlphArray( 2 );
@@ -712,7 +780,7 @@ namespace WaterCoils {
 				WaterCoil( CoilNum ).SchedPtr = GetScheduleIndex( AlphArray( 2 ) );
 				if ( WaterCoil( CoilNum ).SchedPtr == 0 ) {
 					ShowSevereError( CurrentModuleObject + ": invalid " + cAlphaFields( 2 ) + " entered =" + AlphArray( 2 ) + " for " + cAlphaFields( 1 ) + '=' + AlphArray( 1 ) );
-					ErrorsFound = true;
+					GetWaterCoilInputErrorsFound = true;
 				}
 			}
 
@@ -737,10 +805,10 @@ namespace WaterCoils {
 			WaterCoil( CoilNum ).DesOutletAirHumRat = NumArray( 7 ); //Leaving air humidity ratio  at Design
 			if ( WaterCoil( CoilNum ).DesOutletAirHumRat == AutoSize ) WaterCoil( CoilNum ).RequestingAutoSize = true;
 
-			WaterCoil( CoilNum ).WaterInletNodeNum = GetOnlySingleNode( AlphArray( 3 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
-			WaterCoil( CoilNum ).WaterOutletNodeNum = GetOnlySingleNode( AlphArray( 4 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
-			WaterCoil( CoilNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 5 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			WaterCoil( CoilNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 6 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			WaterCoil( CoilNum ).WaterInletNodeNum = GetOnlySingleNode( AlphArray( 3 ), GetWaterCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+			WaterCoil( CoilNum ).WaterOutletNodeNum = GetOnlySingleNode( AlphArray( 4 ), GetWaterCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+			WaterCoil( CoilNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 5 ), GetWaterCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			WaterCoil( CoilNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 6 ), GetWaterCoilInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			{ auto const SELECT_CASE_var( AlphArray( 7 ) );
 			//The default is SimpleAnalysis = 2.  and DetailedAnalysis   =1
@@ -772,7 +840,7 @@ namespace WaterCoils {
 				WaterCoil( CoilNum ).CondensateCollectMode = CondensateDiscarded;
 			} else {
 				WaterCoil( CoilNum ).CondensateCollectMode = CondensateToTank;
-				SetupTankSupplyComponent( WaterCoil( CoilNum ).Name, CurrentModuleObject, WaterCoil( CoilNum ).CondensateCollectName, ErrorsFound, WaterCoil( CoilNum ).CondensateTankID, WaterCoil( CoilNum ).CondensateTankSupplyARRID );
+				SetupTankSupplyComponent( WaterCoil( CoilNum ).Name, CurrentModuleObject, WaterCoil( CoilNum ).CondensateCollectName, GetWaterCoilInputErrorsFound, WaterCoil( CoilNum ).CondensateTankID, WaterCoil( CoilNum ).CondensateTankSupplyARRID );
 			}
 
 			TestCompSet( CurrentModuleObject, AlphArray( 1 ), AlphArray( 3 ), AlphArray( 4 ), "Water Nodes" );
@@ -807,7 +875,7 @@ namespace WaterCoils {
 			}
 		}
 
-		if ( ErrorsFound ) {
+		if ( GetWaterCoilInputErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found in getting input." );
 		}
 
@@ -890,23 +958,15 @@ namespace WaterCoils {
 		int icvg; // Iteration convergence flag
 		Real64 ResultX; // Output variable from ITERATE function.
 		int Ipass; // loop index for App_Dewpoint_Loop
-		static Real64 TOutNew( 0.0 ); // reset outlet air temperature for Coil:Cooling:Water
-		static Real64 WOutNew( 0.0 ); // reset outlet air humidity ratio for Coil:Cooling:Water
 
 		int AirInletNode;
 		int WaterInletNode;
 		int WaterOutletNode;
 
-		static Array1D< Real64 > DesCpAir; // CpAir at Design Inlet Air Temp
-		static Array1D< Real64 > DesUARangeCheck; // Value for range check based on Design Inlet Air Humidity Ratio
 		/////////// hoisted into namespace InitWaterCoilOneTimeFlag
 		//static bool MyOneTimeFlag( true );
 		/////////////////////////
-		static Array1D_bool MyEnvrnFlag;
-		static Array1D_bool MyCoilReportFlag;
-		static Array1D_bool PlantLoopScanFlag;
 
-		static Array1D< Real64 > CoefSeries( 5 ); //Tuned Changed to static: High call count: Set before use
 		Real64 FinDiamVar;
 		Real64 TubeToFinDiamRatio;
 
@@ -916,21 +976,8 @@ namespace WaterCoils {
 		Real64 UA0; // lower bound for UA
 		Real64 UA1; // upper bound for UA
 		Real64 UA;
-		static Array1D< Real64 > Par( 4 ); //Tuned Changed to static: High call count: Set before use
-
-		static bool NoSatCurveIntersect( false ); // TRUE if failed to find appatatus dew-point
-		static bool BelowInletWaterTemp( false ); // TRUE if apparatus dew-point below design inlet water temperature
-		static bool CBFTooLarge( false ); // TRUE if the coil bypass factor is unrealistically large
-		static bool NoExitCondReset( false ); // TRUE if exit condition reset is not to be done
-
-		static Real64 RatedLatentCapacity( 0.0 ); // latent cooling capacity at the rating point [W]
-		static Real64 RatedSHR( 0.0 ); // sensible heat ratio at the rating point
-		static Real64 CapacitanceWater( 0.0 ); // capacitance of the water stream [W/K]
-		static Real64 CMin( 0.0 ); // minimum capacitance of 2 streams [W/K]
-		static Real64 CoilEffectiveness( 0.0 ); // effectiveness of the coil (rated)
-		static Real64 SurfaceArea( 0.0 ); // heat exchanger surface area, [m2]
-		static Real64 UATotal( 0.0 ); // heat exchanger UA total, [W/C]
-		static Array1D_bool RptCoilHeaderFlag( 2, true );
+
+
 		Real64 x_a; // result of Eq.70 in Wetter 1999
 		Real64 x_w; // result of Eq.72 in Wetter 1999
 		Real64 AirConvectTerm; // result of Eq.71 in Wetter 1999
@@ -948,10 +995,7 @@ namespace WaterCoils {
 		Real64 Cp; // local fluid specific heat
 		Real64 rho; // local fluid density
 		bool errFlag;
-		static Real64 EnthCorrFrac( 0.0 ); // enthalpy correction factor
-		static Real64 TempCorrFrac( 0.0 ); // temperature correction factor
 		int i;
-		static Real64 rSchVal( 0.0 );
 
 		// FLOW:
 
@@ -1052,10 +1096,10 @@ namespace WaterCoils {
 						if ( WaterCoil( CoilNum ).DesTotWaterCoilLoad > SmallLoad ) {
 							RhoAirStd = StdRhoAir;
 							CpAirStd = PsyCpAirFnWTdb( 0.0, 20.0 );
-							Par( 1 ) = WaterCoil( CoilNum ).DesTotWaterCoilLoad;
-							Par( 2 ) = double( CoilNum );
-							Par( 3 ) = double( ContFanCycCoil ); //fan operating mode
-							Par( 4 ) = 1.0; // part-load ratio
+							InitWaterCoilPar( 1 ) = WaterCoil( CoilNum ).DesTotWaterCoilLoad;
+							InitWaterCoilPar( 2 ) = double( CoilNum );
+							InitWaterCoilPar( 3 ) = double( ContFanCycCoil ); //fan operating mode
+							InitWaterCoilPar( 4 ) = 1.0; // part-load ratio
 							WaterCoil( CoilNum ).InletAirTemp = WaterCoil( CoilNum ).DesInletAirTemp;
 							WaterCoil( CoilNum ).InletAirHumRat = 0.008;
 							WaterCoil( CoilNum ).InletWaterTemp = WaterCoil( CoilNum ).DesInletWaterTemp;
@@ -1066,7 +1110,7 @@ namespace WaterCoils {
 							UA0 = 0.001 * WaterCoil( CoilNum ).DesTotWaterCoilLoad;
 							UA1 = WaterCoil( CoilNum ).DesTotWaterCoilLoad;
 							// Invert the simple heating coil model: given the design inlet conditions and the design load, fins the design UA
-							SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleHeatingCoilUAResidual, UA0, UA1, Par );
+							SolveRegulaFalsi( Acc, MaxIte, SolFla, UA, SimpleHeatingCoilUAResidual, UA0, UA1, InitWaterCoilPar, "InitWaterCoil" );
 							// if the numerical inversion failed, issue error messages.
 							if ( SolFla == -1 ) {
 								ShowSevereError( "Calculation of heating coil UA failed for coil " + WaterCoil( CoilNum ).Name );
@@ -1383,10 +1427,10 @@ namespace WaterCoils {
 				// Now use SolveRegulaFalsi to "invert" the cooling coil model to obtain the UA given the specified design inlet and outlet conditions
 				// Note that the UAs we have obtained so far are rough estimates that are the starting points for the the following iterative
 				//   calulation of the actual UAs.
-				Par( 1 ) = WaterCoil( CoilNum ).DesTotWaterCoilLoad;
-				Par( 2 ) = double( CoilNum );
-				Par( 3 ) = double( ContFanCycCoil ); //fan operating mode
-				Par( 4 ) = 1.0; // part-load ratio
+				InitWaterCoilPar( 1 ) = WaterCoil( CoilNum ).DesTotWaterCoilLoad;
+				InitWaterCoilPar( 2 ) = double( CoilNum );
+				InitWaterCoilPar( 3 ) = double( ContFanCycCoil ); //fan operating mode
+				InitWaterCoilPar( 4 ) = 1.0; // part-load ratio
 				WaterCoil( CoilNum ).InletAirTemp = WaterCoil( CoilNum ).DesInletAirTemp;
 				WaterCoil( CoilNum ).InletAirHumRat = WaterCoil( CoilNum ).DesInletAirHumRat;
 				WaterCoil( CoilNum ).InletWaterTemp = WaterCoil( CoilNum ).DesInletWaterTemp;
@@ -1396,7 +1440,7 @@ namespace WaterCoils {
 				UA0 = 0.1 * WaterCoil( CoilNum ).UACoilExternal;
 				UA1 = 10.0 * WaterCoil( CoilNum ).UACoilExternal;
 				// Invert the simple cooling coil model: given the design inlet conditions and the design load, find the design UA
-				SolveRegulaFalsi( 0.001, MaxIte, SolFla, UA, SimpleCoolingCoilUAResidual, UA0, UA1, Par );
+				SolveRegulaFalsi( 0.001, MaxIte, SolFla, UA, SimpleCoolingCoilUAResidual, UA0, UA1, InitWaterCoilPar, "InitWaterCoil" );
 				// if the numerical inversion failed, issue error messages.
 				if ( SolFla == -1 ) {
 					ShowSevereError( "Calculation of cooling coil design UA failed for coil " + WaterCoil( CoilNum ).Name );
@@ -3721,7 +3765,6 @@ namespace WaterCoils {
 		Real64 MaximumCapacityStream; // Maximum capacity rate of the streams(W/C)
 		Real64 RatioStreamCapacity; // Ratio of minimum to maximum capacity rate
 		Real64 NTU; // Number of transfer units
-		static Real64 effectiveness( 0.0 ); // Heat exchanger effectiveness
 		Real64 MaxHeatTransfer; // Maximum heat transfer possible(W)
 		Real64 e; // Intermediate variables in effectivness equation
 		Real64 eta;
@@ -4103,7 +4146,6 @@ namespace WaterCoils {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array2D< Real64 > OrderedPair( MaxOrderedPairs, 2 ); //Tuned Changed to static: Set before use
 		Real64 FAI;
 		Real64 FED;
 		Real64 FEDnumerator;
@@ -4143,10 +4185,10 @@ namespace WaterCoils {
 				FED = 0.0;
 			}
 			//      FED = RO * (R1I1 * R2K1 - R2I1 * R1K1) / (R2I0 * R1K1 + R1I1 * R2K0)
-			OrderedPair( I, 1 ) = FAI;
-			OrderedPair( I, 2 ) = FED;
+			CalcDryFinEffCoefOrderedPair( I, 1 ) = FAI;
+			CalcDryFinEffCoefOrderedPair( I, 2 ) = FED;
 		}
-		CalcPolynomCoef( OrderedPair, PolynomCoef );
+		CalcPolynomCoef( CalcDryFinEffCoefOrderedPair, PolynomCoef );
 	}
 
 	void
@@ -4457,8 +4499,6 @@ namespace WaterCoils {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		bool Converged;
-		static Array2D< Real64 > OrdPairSum( 10, 2 ); //Tuned Changed to static and whole array zero-initialized
-		static Array2D< Real64 > OrdPairSumMatrix( 10, 10 ); //Tuned Changed to static
 		Real64 B;
 		int I;
 		int II;
@@ -5677,7 +5717,6 @@ Label10: ;
 		int SolFla; // Flag of solver
 		Real64 T0; // lower bound for Tprov [C]
 		Real64 T1; // upper bound for Tprov [C]
-		static Real64 Tprov( 0.0 ); // provisional value of drybulb temperature [C]
 		Array1D< Real64 > Par( 3 ); // Par(1) = desired enthaply H [J/kg]
 		// Par(2) = desired relative humidity (0.0 - 1.0)
 		// Par(3) = barometric pressure [N/m2 (Pascals)]
@@ -5687,7 +5726,7 @@ Label10: ;
 		Par( 1 ) = H;
 		Par( 2 ) = RH;
 		Par( 3 ) = PB;
-		SolveRegulaFalsi( Acc, MaxIte, SolFla, Tprov, EnthalpyResidual, T0, T1, Par );
+		SolveRegulaFalsi( Acc, MaxIte, SolFla, TdbFnHRhPbTprov, EnthalpyResidual, T0, T1, Par, "TdbFnHRhPb" );
 		// if the numerical inversion failed, issue error messages.
 		if ( SolFla == -1 ) {
 			ShowSevereError( "Calculation of drybulb temperature failed in TdbFnHRhPb(H,RH,PB)" );
@@ -5701,7 +5740,7 @@ Label10: ;
 		if ( SolFla < 0 ) {
 			T = 0.0;
 		} else {
-			T = Tprov;
+			T = TdbFnHRhPbTprov;
 		}
 
 		return T;
@@ -6027,7 +6066,6 @@ Label10: ;
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		int CoilNum;
-		static bool DidAnythingChange( false ); // set to true if conditions changed
 		int InletNodeNum;
 		int OutletNodeNum;
 
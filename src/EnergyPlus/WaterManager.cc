@@ -125,8 +125,111 @@ namespace WaterManager {
 	// pointers for water storage tanks and their supply arrays
 	// pointers for water storage tanks and their demand arrays
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true ); // First time, input is "gotten"
+		int ManageWaterRainColNum( 0 );
+		int ManageWaterTankNum( 0 );
+		int ManageWaterWellNum( 0 );
+		int NumAlphas( 0 ); // Number of Alphas for each GetObjectItem call
+		int NumNumbers( 0 ); // Number of Numbers for each GetObjectItem call
+		int IOStatus( 0 ); // Used in GetObjectItem
+		bool GetWaterManagerInputErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool MyOneTimeFlag( true );
+		int MaxNumAlphas( 0 ); // argument for call to GetObjectDefMaxArgs
+		int MaxNumNumbers( 0 ); // argument for call to GetObjectDefMaxArgs
+		int TotalArgs( 0 ); // argument for call to GetObjectDefMaxArgs
+		bool IsNotOK( false );
+		bool IsBlank( false );
+		int alphaOffset( 0 );
+		int SurfNum( 0 );
+		std::string objNameMsg;
+		Real64 tmpMax( 0.0 );
+		Real64 tmpMin( 0.0 );
+		Real64 tmpNumerator( 0.0 );
+		Real64 tmpArea( 0.0 );
+		Real64 tmpDenominator( 0.0 );
+		int ThisSurf( 0 );
+		Real64 OrigVdotDemandRequest( 0.0 );
+		Real64 TotVdotDemandAvail( 0.0 );
+		Real64 OrigVolDemandRequest( 0.0 );
+		Real64 TotVolDemandAvail( 0.0 );
+		Real64 OrigVdotSupplyAvail( 0.0 );
+		Real64 TotVdotSupplyAvail( 0.0 );
+		Real64 TotVolSupplyAvail( 0.0 );
+		Real64 overflowVdot( 0.0 );
+		Real64 overflowVol( 0.0 );
+		Real64 overflowTwater( 0.0 );
+		Real64 NetVdotAdd( 0.0 );
+		Real64 NetVolAdd( 0.0 );
+		Real64 FillVolRequest( 0.0 );
+		Real64 TotVolAllowed( 0.0 );
+		Real64 AvailVolume( 0.0 );
+		Real64 underflowVdot( 0.0 );
+		Real64 VolumePredict( 0.0 );
+		Real64 OverFillVolume( 0.0 );
+		bool MyEnvrnFlag( true ); // flag for init once at start of environment
+		bool MyWarmupFlag( false ); // flag for init after warmup complete
+		bool MyTankDemandCheckFlag( true );
+	}
+
 	// Functions
 
+	// Clears the global data in WaterManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		GetInputFlag = true;
+		ManageWaterRainColNum = 0;
+		ManageWaterTankNum = 0;
+		ManageWaterWellNum = 0;
+		NumAlphas = 0;
+		NumNumbers = 0;
+		IOStatus = 0;
+		GetWaterManagerInputErrorsFound = false;
+		MyOneTimeFlag = true;
+		MaxNumAlphas = 0;
+		MaxNumNumbers = 0;
+		TotalArgs = 0;
+		IsNotOK = false;
+		IsBlank = false;
+		alphaOffset = 0;
+		SurfNum = 0;
+		objNameMsg.clear();
+		tmpMax = 0.0;
+		tmpMin = 0.0;
+		tmpNumerator = 0.0;
+		tmpArea = 0.0;
+		tmpDenominator = 0.0;
+		ThisSurf = 0;
+		OrigVdotDemandRequest = 0.0;
+		TotVdotDemandAvail = 0.0;
+		OrigVolDemandRequest = 0.0;
+		TotVolDemandAvail = 0.0;
+		OrigVdotSupplyAvail = 0.0;
+		TotVdotSupplyAvail = 0.0;
+		TotVolSupplyAvail = 0.0;
+		overflowVdot = 0.0;
+		overflowVol = 0.0;
+		overflowTwater = 0.0;
+		NetVdotAdd = 0.0;
+		NetVolAdd = 0.0;
+		FillVolRequest = 0.0;
+		TotVolAllowed = 0.0;
+		AvailVolume = 0.0;
+		underflowVdot = 0.0;
+		VolumePredict = 0.0;
+		OverFillVolume = 0.0;
+		MyEnvrnFlag = true;
+		MyWarmupFlag = false;
+		MyTankDemandCheckFlag = true;
+	}
+
 	void
 	ManageWater()
 	{
@@ -174,10 +277,6 @@ namespace WaterManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInputFlag( true ); // First time, input is "gotten"
-		static int RainColNum( 0 );
-		static int TankNum( 0 );
-		static int WellNum( 0 );
 
 		if ( GetInputFlag ) {
 			GetWaterManagerInput();
@@ -189,21 +288,21 @@ namespace WaterManager {
 		// this is the main water manager
 		// first call all the water storage tanks
 		//    (these called first to make control decisions)
-		for ( TankNum = 1; TankNum <= NumWaterStorageTanks; ++TankNum ) {
-			CalcWaterStorageTank( TankNum );
+		for ( ManageWaterTankNum = 1; ManageWaterTankNum <= NumWaterStorageTanks; ++ManageWaterTankNum ) {
+			CalcWaterStorageTank( ManageWaterTankNum );
 		} //tank loop
 
-		for ( RainColNum = 1; RainColNum <= NumRainCollectors; ++RainColNum ) {
-			CalcRainCollector( RainColNum );
+		for ( ManageWaterRainColNum = 1; ManageWaterRainColNum <= NumRainCollectors; ++ManageWaterRainColNum ) {
+			CalcRainCollector( ManageWaterRainColNum );
 		}
 
-		for ( WellNum = 1; WellNum <= NumGroundWaterWells; ++WellNum ) {
-			CalcGroundwaterWell( WellNum );
+		for ( ManageWaterWellNum = 1; ManageWaterWellNum <= NumGroundWaterWells; ++ManageWaterWellNum ) {
+			CalcGroundwaterWell( ManageWaterWellNum );
 		}
 
 		//call the tanks again to get updated rain and well activity
-		for ( TankNum = 1; TankNum <= NumWaterStorageTanks; ++TankNum ) {
-			CalcWaterStorageTank( TankNum );
+		for ( ManageWaterTankNum = 1; ManageWaterTankNum <= NumWaterStorageTanks; ++ManageWaterTankNum ) {
+			CalcWaterStorageTank( ManageWaterTankNum );
 		} //tank loop
 
 		ReportWaterManager();
@@ -306,19 +405,6 @@ namespace WaterManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int Item; // Item to be "gotten"
-		static int NumAlphas( 0 ); // Number of Alphas for each GetObjectItem call
-		static int NumNumbers( 0 ); // Number of Numbers for each GetObjectItem call
-		static int IOStatus( 0 ); // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
-		static bool MyOneTimeFlag( true );
-		static int MaxNumAlphas( 0 ); // argument for call to GetObjectDefMaxArgs
-		static int MaxNumNumbers( 0 ); // argument for call to GetObjectDefMaxArgs
-		static int TotalArgs( 0 ); // argument for call to GetObjectDefMaxArgs
-		static bool IsNotOK( false );
-		static bool IsBlank( false );
-		static int alphaOffset( 0 );
-		static int SurfNum( 0 );
-		static std::string objNameMsg;
 		Array1D_string cAlphaFieldNames;
 		Array1D_string cNumericFieldNames;
 		Array1D_bool lNumericFieldBlanks;
@@ -326,12 +412,6 @@ namespace WaterManager {
 		Array1D_string cAlphaArgs;
 		Array1D< Real64 > rNumericArgs;
 		std::string cCurrentModuleObject;
-		static Real64 tmpMax( 0.0 );
-		static Real64 tmpMin( 0.0 );
-		static Real64 tmpNumerator( 0.0 );
-		static Real64 tmpArea( 0.0 );
-		static Real64 tmpDenominator( 0.0 );
-		static int ThisSurf( 0 );
 		int NumIrrigation;
 		int Dummy;
 
@@ -378,7 +458,7 @@ namespace WaterManager {
 					WaterStorage( Item ).Name = cAlphaArgs( 1 );
 					VerifyName( cAlphaArgs( 1 ), WaterStorage, Item - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 					if ( IsNotOK ) {
-						ErrorsFound = true;
+						GetWaterManagerInputErrorsFound = true;
 						if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 					}
 					objNameMsg = cCurrentModuleObject + " = " + cAlphaArgs( 1 );
@@ -430,7 +510,7 @@ namespace WaterManager {
 					} else {
 						ShowSevereError( "Invalid " + cAlphaFieldNames( 4 ) + '=' + cAlphaArgs( 4 ) );
 						ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-						ErrorsFound = true;
+						GetWaterManagerInputErrorsFound = true;
 					}
 					WaterStorage( Item ).ValveOnCapacity = rNumericArgs( 5 );
 					WaterStorage( Item ).ValveOffCapacity = rNumericArgs( 6 );
@@ -441,7 +521,7 @@ namespace WaterManager {
 							ShowContinueError( cNumericFieldNames( 6 ) + " must be greater than " + cNumericFieldNames( 5 ) );
 							ShowContinueError( "Check value for " + cNumericFieldNames( 5 ) + " = " + RoundSigDigits( WaterStorage( Item ).ValveOnCapacity, 5 ) );
 							ShowContinueError( "which must be lower than " + cNumericFieldNames( 6 ) + " = " + RoundSigDigits( WaterStorage( Item ).ValveOffCapacity, 5 ) );
-							ErrorsFound = true;
+							GetWaterManagerInputErrorsFound = true;
 						}
 					}
 
@@ -471,21 +551,21 @@ namespace WaterManager {
 						if ( WaterStorage( Item ).TempSchedID == 0 ) {
 							ShowSevereError( "Invalid " + cAlphaFieldNames( 7 ) + '=' + cAlphaArgs( 7 ) );
 							ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-							ErrorsFound = true;
+							GetWaterManagerInputErrorsFound = true;
 						}
 						tmpMin = GetScheduleMinValue( WaterStorage( Item ).TempSchedID );
 						if ( tmpMin < 0.0 ) {
 							ShowSevereError( "Invalid " + cAlphaFieldNames( 7 ) + '=' + cAlphaArgs( 7 ) );
 							ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
 							ShowContinueError( "Found storage tank temperature schedule value less than 0.0 in " + objNameMsg );
-							ErrorsFound = true;
+							GetWaterManagerInputErrorsFound = true;
 						}
 						tmpMax = GetScheduleMaxValue( WaterStorage( Item ).TempSchedID );
 						if ( tmpMax > 100.0 ) {
 							ShowSevereError( "Invalid " + cAlphaFieldNames( 7 ) + '=' + cAlphaArgs( 7 ) );
 							ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
 							ShowContinueError( "found storage tank temperature schedule value greater than 100.0 in " + objNameMsg );
-							ErrorsFound = true;
+							GetWaterManagerInputErrorsFound = true;
 						}
 
 					}
@@ -500,19 +580,19 @@ namespace WaterManager {
 						} else {
 							ShowSevereError( "Invalid " + cAlphaFieldNames( 8 ) + '=' + cAlphaArgs( 8 ) );
 							ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-							ErrorsFound = true;
+							GetWaterManagerInputErrorsFound = true;
 						}
 						WaterStorage( Item ).AmbientTempSchedule = GetScheduleIndex( cAlphaArgs( 9 ) );
 						if ( ( WaterStorage( Item ).AmbientTempSchedule == 0 ) && ( WaterStorage( Item ).AmbientTempIndicator == AmbientTempSchedule ) ) {
 							ShowSevereError( "Invalid " + cAlphaFieldNames( 9 ) + '=' + cAlphaArgs( 9 ) );
 							ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-							ErrorsFound = true;
+							GetWaterManagerInputErrorsFound = true;
 						}
 						WaterStorage( Item ).ZoneID = FindItemInList( cAlphaArgs( 10 ), Zone );
 						if ( ( WaterStorage( Item ).ZoneID == 0 ) && ( WaterStorage( Item ).AmbientTempIndicator == AmbientTempZone ) ) {
 							ShowSevereError( "Invalid " + cAlphaFieldNames( 10 ) + '=' + cAlphaArgs( 10 ) );
 							ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-							ErrorsFound = true;
+							GetWaterManagerInputErrorsFound = true;
 						}
 						WaterStorage( Item ).SurfArea = rNumericArgs( 8 );
 						WaterStorage( Item ).UValue = rNumericArgs( 9 );
@@ -534,7 +614,7 @@ namespace WaterManager {
 					RainCollector( Item ).Name = cAlphaArgs( 1 );
 					VerifyName( cAlphaArgs( 1 ), RainCollector, Item - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Named " );
 					if ( IsNotOK ) {
-						ErrorsFound = true;
+						GetWaterManagerInputErrorsFound = true;
 						if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 					}
 					objNameMsg = cCurrentModuleObject + " Named " + cAlphaArgs( 1 );
@@ -544,7 +624,7 @@ namespace WaterManager {
 					if ( RainCollector( Item ).StorageTankID == 0 ) {
 						ShowSevereError( "Invalid " + cAlphaFieldNames( 2 ) + '=' + cAlphaArgs( 2 ) );
 						ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-						ErrorsFound = true;
+						GetWaterManagerInputErrorsFound = true;
 					}
 
 					if ( SameString( cAlphaArgs( 3 ), "Constant" ) ) {
@@ -554,7 +634,7 @@ namespace WaterManager {
 					} else {
 						ShowSevereError( "Invalid " + cAlphaFieldNames( 3 ) + '=' + cAlphaArgs( 3 ) );
 						ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-						ErrorsFound = true;
+						GetWaterManagerInputErrorsFound = true;
 					}
 					RainCollector( Item ).LossFactor = rNumericArgs( 1 );
 					if ( RainCollector( Item ).LossFactor > 1.0 ) {
@@ -566,7 +646,7 @@ namespace WaterManager {
 						ShowSevereError( "Invalid " + cNumericFieldNames( 1 ) + '=' + RoundSigDigits( rNumericArgs( 1 ), 2 ) );
 						ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
 						ShowContinueError( "found rain water collection loss factor less than 0.0" );
-						ErrorsFound = true;
+						GetWaterManagerInputErrorsFound = true;
 					}
 
 					if ( RainCollector( Item ).LossFactorMode == ScheduledRainLossFactor ) {
@@ -574,13 +654,13 @@ namespace WaterManager {
 						if ( RainCollector( Item ).LossFactorSchedID == 0 ) {
 							ShowSevereError( "Invalid " + cAlphaFieldNames( 4 ) + '=' + cAlphaArgs( 4 ) );
 							ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-							ErrorsFound = true;
+							GetWaterManagerInputErrorsFound = true;
 						}
 						if ( GetScheduleMinValue( RainCollector( Item ).LossFactorSchedID ) < 0.0 ) {
 							ShowSevereError( "Invalid " + cAlphaFieldNames( 4 ) + '=' + cAlphaArgs( 4 ) );
 							ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
 							ShowContinueError( "found rain water collection loss factor schedule value less than 0.0 in " + objNameMsg );
-							ErrorsFound = true;
+							GetWaterManagerInputErrorsFound = true;
 						}
 						if ( GetScheduleMaxValue( RainCollector( Item ).LossFactorSchedID ) > 1.0 ) {
 							ShowWarningError( "Potentially invalid " + cAlphaFieldNames( 4 ) + '=' + cAlphaArgs( 4 ) );
@@ -603,7 +683,7 @@ namespace WaterManager {
 						if ( RainCollector( Item ).SurfID( SurfNum ) == 0 ) {
 							ShowSevereError( "Invalid " + cAlphaFieldNames( SurfNum + alphaOffset ) + '=' + cAlphaArgs( SurfNum + alphaOffset ) );
 							ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-							ErrorsFound = true;
+							GetWaterManagerInputErrorsFound = true;
 						}
 					}
 
@@ -622,7 +702,7 @@ namespace WaterManager {
 					RainCollector( Item ).MeanHeight = tmpNumerator / tmpDenominator;
 
 					// now set up tank supply connection
-					InternalSetupTankSupplyComponent( RainCollector( Item ).Name, cCurrentModuleObject, RainCollector( Item ).StorageTankName, ErrorsFound, RainCollector( Item ).StorageTankID, RainCollector( Item ).StorageTankSupplyARRID );
+					InternalSetupTankSupplyComponent( RainCollector( Item ).Name, cCurrentModuleObject, RainCollector( Item ).StorageTankName, GetWaterManagerInputErrorsFound, RainCollector( Item ).StorageTankID, RainCollector( Item ).StorageTankSupplyARRID );
 				}
 			} // (NumRainCollectors > 0)
 
@@ -636,13 +716,13 @@ namespace WaterManager {
 					GroundwaterWell( Item ).Name = cAlphaArgs( 1 );
 					VerifyName( cAlphaArgs( 1 ), GroundwaterWell, Item - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 					if ( IsNotOK ) {
-						ErrorsFound = true;
+						GetWaterManagerInputErrorsFound = true;
 						if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 					}
 					objNameMsg = cCurrentModuleObject + " Named " + cAlphaArgs( 1 );
 					GroundwaterWell( Item ).StorageTankName = cAlphaArgs( 2 );
 
-					InternalSetupTankSupplyComponent( GroundwaterWell( Item ).Name, cCurrentModuleObject, GroundwaterWell( Item ).StorageTankName, ErrorsFound, GroundwaterWell( Item ).StorageTankID, GroundwaterWell( Item ).StorageTankSupplyARRID );
+					InternalSetupTankSupplyComponent( GroundwaterWell( Item ).Name, cCurrentModuleObject, GroundwaterWell( Item ).StorageTankName, GetWaterManagerInputErrorsFound, GroundwaterWell( Item ).StorageTankID, GroundwaterWell( Item ).StorageTankSupplyARRID );
 
 					if ( allocated( WaterStorage ) ) WaterStorage( GroundwaterWell( Item ).StorageTankID ).GroundWellID = Item;
 
@@ -662,7 +742,7 @@ namespace WaterManager {
 					} else {
 						ShowSevereError( "Invalid " + cAlphaFieldNames( 3 ) + '=' + cAlphaArgs( 3 ) );
 						ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-						ErrorsFound = true;
+						GetWaterManagerInputErrorsFound = true;
 					}
 
 					//  N8, \field water table depth
@@ -672,7 +752,7 @@ namespace WaterManager {
 					if ( ( GroundwaterWell( Item ).GroundwaterTableMode == ScheduledWaterTable ) && ( GroundwaterWell( Item ).WaterTableDepthSchedID == 0 ) ) {
 						ShowSevereError( "Invalid " + cAlphaFieldNames( 4 ) + '=' + cAlphaArgs( 4 ) );
 						ShowContinueError( "Entered in " + cCurrentModuleObject + '=' + cAlphaArgs( 1 ) );
-						ErrorsFound = true;
+						GetWaterManagerInputErrorsFound = true;
 					}
 
 				}
@@ -686,7 +766,7 @@ namespace WaterManager {
 					if ( ( WaterStorage( Item ).ControlSupplyType == WellFloatValve ) || ( WaterStorage( Item ).ControlSupplyType == WellFloatMainsBackup ) ) {
 						if ( WaterStorage( Item ).GroundWellID == 0 ) {
 							ShowSevereError( cCurrentModuleObject + "= \"" + WaterStorage( Item ).Name + "\" does not have a WaterUse:Well (groundwater well) that names it." );
-							ErrorsFound = true;
+							GetWaterManagerInputErrorsFound = true;
 						}
 					}
 
@@ -695,11 +775,11 @@ namespace WaterManager {
 						WaterStorage( Item ).SupplyTankID = FindItemInList( WaterStorage( Item ).SupplyTankName, WaterStorage );
 						if ( WaterStorage( Item ).SupplyTankID == 0 ) {
 							ShowSevereError( "Other tank called " + WaterStorage( Item ).SupplyTankName + " not found for " + cCurrentModuleObject + " Named " + WaterStorage( Item ).Name ); // TODO rename point
-							ErrorsFound = true;
+							GetWaterManagerInputErrorsFound = true;
 						}
-						InternalSetupTankDemandComponent( WaterStorage( Item ).Name, cCurrentModuleObject, WaterStorage( Item ).SupplyTankName, ErrorsFound, WaterStorage( Item ).SupplyTankID, WaterStorage( Item ).SupplyTankDemandARRID );
+						InternalSetupTankDemandComponent( WaterStorage( Item ).Name, cCurrentModuleObject, WaterStorage( Item ).SupplyTankName, GetWaterManagerInputErrorsFound, WaterStorage( Item ).SupplyTankID, WaterStorage( Item ).SupplyTankDemandARRID );
 						//call to setup tank supply as well
-						InternalSetupTankSupplyComponent( WaterStorage( Item ).SupplyTankName, cCurrentModuleObject, WaterStorage( Item ).Name, ErrorsFound, Dummy, Dummy );
+						InternalSetupTankSupplyComponent( WaterStorage( Item ).SupplyTankName, cCurrentModuleObject, WaterStorage( Item ).Name, GetWaterManagerInputErrorsFound, Dummy, Dummy );
 					}
 					// setup overflow inputs
 					WaterStorage( Item ).OverflowTankID = FindItemInList( WaterStorage( Item ).OverflowTankName, WaterStorage );
@@ -709,13 +789,13 @@ namespace WaterManager {
 							WaterStorage( Item ).OverflowMode = OverflowDiscarded;
 						} else {
 							ShowSevereError( "Overflow tank name of " + WaterStorage( Item ).OverflowTankName + " not found for " + cCurrentModuleObject + " Named " + WaterStorage( Item ).Name );
-							ErrorsFound = true;
+							GetWaterManagerInputErrorsFound = true;
 						}
 					} else {
 						WaterStorage( Item ).OverflowMode = OverflowToTank;
 					}
 					if ( WaterStorage( Item ).OverflowMode == OverflowToTank ) {
-						InternalSetupTankSupplyComponent( WaterStorage( Item ).Name, cCurrentModuleObject, WaterStorage( Item ).OverflowTankName, ErrorsFound, WaterStorage( Item ).OverflowTankID, WaterStorage( Item ).OverflowTankSupplyARRID );
+						InternalSetupTankSupplyComponent( WaterStorage( Item ).Name, cCurrentModuleObject, WaterStorage( Item ).OverflowTankName, GetWaterManagerInputErrorsFound, WaterStorage( Item ).OverflowTankID, WaterStorage( Item ).OverflowTankSupplyARRID );
 					}
 
 				}
@@ -725,7 +805,7 @@ namespace WaterManager {
 			NumSiteRainFall = GetNumObjectsFound( cCurrentModuleObject );
 			if ( NumSiteRainFall > 1 ) { // throw error
 				ShowSevereError( "Only one " + cCurrentModuleObject + " object is allowed" );
-				ErrorsFound = true;
+				GetWaterManagerInputErrorsFound = true;
 			}
 
 			if ( NumSiteRainFall == 1 ) {
@@ -737,16 +817,16 @@ namespace WaterManager {
 				} else {
 					ShowSevereError( "Precipitation Model Type of " + cCurrentModuleObject + " is incorrect." );
 					ShowContinueError( "Only available option is ScheduleAndDesignLevel." );
-					ErrorsFound = true;
+					GetWaterManagerInputErrorsFound = true;
 				}
 				RainFall.RainSchedID = GetScheduleIndex( cAlphaArgs( 2 ) );
 				if ( ( RainFall.RainSchedID == 0 ) && ( RainFall.ModeID == RainSchedDesign ) ) {
 					ShowSevereError( "Schedule not found for " + cCurrentModuleObject + " object" );
-					ErrorsFound = true;
+					GetWaterManagerInputErrorsFound = true;
 				} else if ( ( RainFall.RainSchedID != 0 ) && ( RainFall.ModeID == RainSchedDesign ) ) {
 					if ( ! CheckScheduleValueMinMax( RainFall.RainSchedID, ">=", 0.0 ) ) {
 						ShowSevereError( "Schedule=" + cAlphaArgs( 2 ) + " for " + cCurrentModuleObject + " object has values < 0." );
-						ErrorsFound = true;
+						GetWaterManagerInputErrorsFound = true;
 					}
 				}
 
@@ -759,7 +839,7 @@ namespace WaterManager {
 			NumIrrigation = GetNumObjectsFound( cCurrentModuleObject );
 			if ( NumIrrigation > 1 ) {
 				ShowSevereError( "Only one " + cCurrentModuleObject + " object is allowed" );
-				ErrorsFound = true;
+				GetWaterManagerInputErrorsFound = true;
 			}
 
 			if ( NumIrrigation == 1 ) {
@@ -771,16 +851,16 @@ namespace WaterManager {
 					Irrigation.ModeID = IrrSmartSched;
 				} else {
 					ShowSevereError( "Type of " + cCurrentModuleObject + " is incorrect. Options are Schedule or SmartSchedule" );
-					ErrorsFound = true;
+					GetWaterManagerInputErrorsFound = true;
 				}
 				Irrigation.IrrSchedID = GetScheduleIndex( cAlphaArgs( 2 ) );
 				if ( ( Irrigation.IrrSchedID == 0 ) && ( ( Irrigation.ModeID == IrrSchedDesign ) || Irrigation.ModeID == IrrSmartSched ) ) {
 					ShowSevereError( "Schedule not found for " + cCurrentModuleObject + " object" );
-					ErrorsFound = true;
+					GetWaterManagerInputErrorsFound = true;
 				} else if ( ( Irrigation.IrrSchedID == 0 ) && ( Irrigation.ModeID == IrrSchedDesign ) ) {
 					if ( ! CheckScheduleValueMinMax( Irrigation.IrrSchedID, ">=", 0.0 ) ) {
 						ShowSevereError( "Schedule=" + cAlphaArgs( 2 ) + " for " + cCurrentModuleObject + " object has values < 0." );
-						ErrorsFound = true;
+						GetWaterManagerInputErrorsFound = true;
 					}
 				}
 
@@ -790,7 +870,7 @@ namespace WaterManager {
 				if ( Irrigation.ModeID == IrrSmartSched && NumNumbers > 0 ) {
 					if ( rNumericArgs( 1 ) > 100.0 || rNumericArgs( 1 ) < 0.0 ) {
 						ShowSevereError( "Irrigation threshold for " + cCurrentModuleObject + " object has values > 100 or < 0." );
-						ErrorsFound = true;
+						GetWaterManagerInputErrorsFound = true;
 					} else {
 						Irrigation.IrrigationThreshold = rNumericArgs( 1 ) / 100.0;
 					}
@@ -809,7 +889,7 @@ namespace WaterManager {
 			rNumericArgs.deallocate();
 			lNumericFieldBlanks.deallocate();
 
-			if ( ErrorsFound ) {
+			if ( GetWaterManagerInputErrorsFound ) {
 				ShowFatalError( "Errors found in processing input for water manager objects" );
 			}
 			// <SetupOutputVariables here...>, CurrentModuleObject='WaterUse:Storage'
@@ -1052,25 +1132,7 @@ namespace WaterManager {
 		// see DataWater.cc
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 OrigVdotDemandRequest( 0.0 );
-		static Real64 TotVdotDemandAvail( 0.0 );
-		static Real64 OrigVolDemandRequest( 0.0 );
-		static Real64 TotVolDemandAvail( 0.0 );
-		static Real64 OrigVdotSupplyAvail( 0.0 );
-		static Real64 TotVdotSupplyAvail( 0.0 );
-		static Real64 TotVolSupplyAvail( 0.0 );
 		//  REAL(r64)    :: TotVolSupplyAllow = 0.0d0
-		static Real64 overflowVdot( 0.0 );
-		static Real64 overflowVol( 0.0 );
-		static Real64 overflowTwater( 0.0 );
-		static Real64 NetVdotAdd( 0.0 );
-		static Real64 NetVolAdd( 0.0 );
-		static Real64 FillVolRequest( 0.0 );
-		static Real64 TotVolAllowed( 0.0 );
-		static Real64 AvailVolume( 0.0 );
-		static Real64 underflowVdot( 0.0 );
-		static Real64 VolumePredict( 0.0 );
-		static Real64 OverFillVolume( 0.0 );
 
 		if ( BeginTimeStepFlag ) {
 			// initializations are done in UpdateWaterManager
@@ -1733,9 +1795,6 @@ namespace WaterManager {
 		int TankNum;
 		int RainColNum;
 		int WellNum;
-		static bool MyEnvrnFlag( true ); // flag for init once at start of environment
-		static bool MyWarmupFlag( false ); // flag for init after warmup complete
-		static bool MyTankDemandCheckFlag( true );
 
 		if ( BeginEnvrnFlag && MyEnvrnFlag ) {
 			for ( TankNum = 1; TankNum <= NumWaterStorageTanks; ++TankNum ) {
@@ -85,6 +85,11 @@ namespace WaterManager {
 
 	// Functions
 
+	// Clears the global data in WaterManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	ManageWater();
 
@@ -70,6 +70,7 @@
 // EnergyPlus Headers
 #include <WaterThermalTanks.hh>
 #include <BranchNodeConnections.hh>
+#include <Checkpoint.hh>
 #include <CurveManager.hh>
 #include <DataBranchAirLoopPlant.hh>
 #include <DataEnvironment.hh>
@@ -190,6 +191,9 @@ namespace WaterThermalTanks {
 	int const InletModeFixed( 1 ); // water heater only, inlet water always enters at the user-specified height
 	int const InletModeSeeking( 2 ); // water heater only, inlet water seeks out the node with the closest temperature
 
+	int const StratifiedSolverExplicit( 1 ); // stratified tank nodes are integrated explicitly with one second sub time steps
+	int const StratifiedSolverImplicit( 2 ); // stratified tank nodes are solved together implicitly between heater control events
+
 	// integer parameter for water heater
 	int const MixedWaterHeater( TypeOf_WtrHeaterMixed ); // WaterHeater:Mixed
 	int const StratifiedWaterHeater( TypeOf_WtrHeaterStratified ); // WaterHeater:Stratified
@@ -264,6 +268,61 @@ namespace WaterThermalTanks {
 		bool InitWaterThermalTanksOnce( true ); // flag for 1 time initialization
 		bool SimWaterThermalTank_OneTimeSetupFlag( true );
 		bool CalcWaterThermalTankZoneGains_MyEnvrnFlag( true );
+		Array1D_bool MyOneTimeFlagWH; // first pass log
+		Array1D_bool MyTwoTimeFlagWH; // second pass do input check
+		Array1D_bool MyOneTimeFlagHP; // first pass log
+		Array1D_bool MyTwoTimeFlagHP; // second pass do input check
+		bool ErrorsFound( false ); // true if errors detected in GetUnitarySystemInputData
+		std::string FanInletNode; // Used to set up comp set
+		std::string GetWaterThermalTankInputDataFanOutletNode; // Used to set up comp set
+		std::string CoilInletNode; // Used to set up comp set
+		std::string CoilOutletNode; // Used to set up comp set
+		int SupAirIn( 0 ); // Used for error checking HPWHs
+		int ExhAirOut( 0 ); // Used for error checking HPWHs
+		bool FoundInletNode( false ); // Used for error checking HPWHs
+		bool FoundOutletNode( false ); // Used for error checking HPWHs
+		int ZoneNum( 0 ); // Used for error checking HPWHs
+		bool ValidScheduleValue( false ); // Used for error checking HPWH's inlet air mixer schedule
+		int ZoneEquipConfigNum( 0 ); // Used to determine if HPWH tank is in a Zone Equipment List (ZEL)
+		int ZoneEquipListNum( 0 ); // Used to determine if HPWH tank is in a Zone Equipment List
+		int EquipmentTypeNum( 0 ); // Used to determine if HPWH tank is in a Zone Equipment List
+		bool FoundTankInList( false ); // Used to determine if HPWH tank is listed in a Zone Equipment List
+		bool TankNotLowestPriority( false ); // Used to determine if HPWH tank is prioritized correctly in ZEL
+		int TankCoolingPriority( 0 ); // Used to determine if a HPWH tank is prioritized correctly in ZEL
+		int TankHeatingPriority( 0 ); // Used to determine if a HPWH tank is prioritized correctly in ZEL
+		bool DXCoilErrFlag( false ); // Used for error checking DX coils used with HPWHs
+		Real64 FanVolFlow( 0.0 ); // Used for error checking fans used with HPWHs
+		bool errFlag( false ); // Used for error checking used with HPWHs
+		Real64 HEffFTemp( 0.0 ); // Used for error checking desuperheater heating coils
+		int DummyWaterIndex( 1 );
+		Real64 Tolerance( 1.0e-8 ); // Tolerance for Newton-Raphson solution
+		Real64 FluidCond( 0.6 ); // Conductivity of water (W/m-K)
+		int SetupStratifiedNodesDummyWaterIndex( 1 );
+		Array1D_bool MyEnvrnFlag; // flag for init once at start of environment
+		Array1D_bool MyWarmupFlag; // flag for init after warmup complete
+		Array1D_bool SetLoopIndexFlag; // get loop number flag
+		int InitWaterThermalTankDummyWaterIndex( 1 );
+		Real64 TankChangeRateScale( 0.0 ); // local temporary for nominal tank change rate
+		Real64 MaxSideVolFlow( 0.0 ); // local temporary for largest connection design flow
+		int CalcWaterThermalTankMixedDummyWaterIndex( 1 );
+		int CalcWaterThermalTankStratifiedDummyWaterIndex( 1 );
+		Array1D< Real64 > Lower; // Coefficients of the upper node temperatures (W/K)
+		Array1D< Real64 > Diag; // Coefficients of the node temperatures (W/K)
+		Array1D< Real64 > Upper; // Coefficients of the lower node temperatures (W/K)
+		Array1D< Real64 > RHS; // Right hand sides of the node heat balances (W)
+		Array1D_int LayerTopNode; // Top node of each mixed layer
+		Array1D< Real64 > LayerMass; // Mass of each mixed layer (kg)
+		Array1D< Real64 > LayerTemp; // Temperature of each mixed layer (C)
+		Real64 MinTemp( 0.0 ); // used for error messages, C
+		int SizeSupplySidePlantConnectionsDummyWaterIndex( 1 );
+		int SizeTankForDemandSideDummyWaterIndex( 1 );
+		bool FuelTypeIsLikeGas( false );
+		int SizeTankForSupplySideDummyWaterIndex( 1 );
+		int SizeDemandSidePlantConnectionsDummyWaterIndex( 1 );
+		bool SizeStandAloneWaterHeaterFuelTypeIsLikeGas( false );
+		int SizeStandAloneWaterHeaterDummyWaterIndex( 1 );
+		bool MyOneTimeSetupFlag( true ); // one time setup flag
+		Array1D_bool AlreadyReported; // control so we don't repeat again
 	}
 
 	// SUBROUTINE SPECIFICATIONS:
@@ -432,10 +491,6 @@ namespace WaterThermalTanks {
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array1D_bool MyOneTimeFlagWH; // first pass log
-		static Array1D_bool MyTwoTimeFlagWH; // second pass do input check
-		static Array1D_bool MyOneTimeFlagHP; // first pass log
-		static Array1D_bool MyTwoTimeFlagHP; // second pass do input check
 		int tmpLoopNum;
 		int tmpLoopSideNum;
 		int CompNum;
@@ -981,7 +1036,6 @@ namespace WaterThermalTanks {
 		// Manages GetInput processing and program termination
 
 		static std::string const RoutineName( "GetWaterThermalTankInput: " ); // include trailing blank space
-		static bool ErrorsFound( false ); // true if errors detected in GetUnitarySystemInputData
 
 		GetWaterThermalTankInputData( ErrorsFound );
 
@@ -1108,27 +1162,6 @@ namespace WaterThermalTanks {
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool IsValid; // Flag for validating PLF curve, OutsideAirNode
-		static std::string FanInletNode; // Used to set up comp set
-		static std::string FanOutletNode; // Used to set up comp set
-		static std::string CoilInletNode; // Used to set up comp set
-		static std::string CoilOutletNode; // Used to set up comp set
-		static int SupAirIn( 0 ); // Used for error checking HPWHs
-		static int ExhAirOut( 0 ); // Used for error checking HPWHs
-		static bool FoundInletNode( false ); // Used for error checking HPWHs
-		static bool FoundOutletNode( false ); // Used for error checking HPWHs
-		static int ZoneNum( 0 ); // Used for error checking HPWHs
-		static bool ValidScheduleValue( false ); // Used for error checking HPWH's inlet air mixer schedule
-		static int ZoneEquipConfigNum( 0 ); // Used to determine if HPWH tank is in a Zone Equipment List (ZEL)
-		static int ZoneEquipListNum( 0 ); // Used to determine if HPWH tank is in a Zone Equipment List
-		static int EquipmentTypeNum( 0 ); // Used to determine if HPWH tank is in a Zone Equipment List
-		static bool FoundTankInList( false ); // Used to determine if HPWH tank is listed in a Zone Equipment List
-		static bool TankNotLowestPriority( false ); // Used to determine if HPWH tank is prioritized correctly in ZEL
-		static int TankCoolingPriority( 0 ); // Used to determine if a HPWH tank is prioritized correctly in ZEL
-		static int TankHeatingPriority( 0 ); // Used to determine if a HPWH tank is prioritized correctly in ZEL
-		static bool DXCoilErrFlag( false ); // Used for error checking DX coils used with HPWHs
-		static Real64 FanVolFlow( 0.0 ); // Used for error checking fans used with HPWHs
-		static bool errFlag( false ); // Used for error checking used with HPWHs
-		static Real64 HEffFTemp( 0.0 ); // Used for error checking desuperheater heating coils
 		bool Okay;
 		bool bIsVScoil( false ); // indicate if the heat pump WH coil is a variable-speed coil
 		int IHPIndex( 0 );// coil No for integrated heat pump
@@ -1136,7 +1169,6 @@ namespace WaterThermalTanks {
 
 		// Following allow for temporary storage of character strings but not saved in main structure
 		Real64 rho; // local fluid density
-		static int DummyWaterIndex( 1 );
 
 		struct WaterHeaterSaveNodes {
 			// Members
@@ -2281,16 +2313,16 @@ namespace WaterThermalTanks {
 						if ( HPWH.InletAirMixerNode > 0 ) {
 							//           hpwhAlpha[ 26 + nAlphaOffset ] = Inlet Air Mixer Node
 							FanInletNode = hpwhAlpha[ 26 + nAlphaOffset ];
-							FanOutletNode = "UNDEFINED";
+							GetWaterThermalTankInputDataFanOutletNode = "UNDEFINED";
 						} else {
 							if ( HPWH.OutsideAirNode == 0 ) {
 								//             hpwhAlpha[ 7 + nAlphaOffset ] = Heat Pump Air Inlet Node
 								FanInletNode = hpwhAlpha[ 7 + nAlphaOffset ];
-								FanOutletNode = "UNDEFINED";
+								GetWaterThermalTankInputDataFanOutletNode = "UNDEFINED";
 							} else {
 								//             hpwhAlpha[ 9 + nAlphaOffset ] = Outside Air Node
 								FanInletNode = hpwhAlpha[ 9 + nAlphaOffset ];
-								FanOutletNode = "UNDEFINED";
+								GetWaterThermalTankInputDataFanOutletNode = "UNDEFINED";
 							}
 						}
 						if ( HPWH.OutletAirSplitterNode > 0 ) {
@@ -2323,14 +2355,14 @@ namespace WaterThermalTanks {
 						}
 						if ( HPWH.OutletAirSplitterNode > 0 ) {
 							FanInletNode = "UNDEFINED";
-							FanOutletNode = hpwhAlpha[ 27 + nAlphaOffset ];
+							GetWaterThermalTankInputDataFanOutletNode = hpwhAlpha[ 27 + nAlphaOffset ];
 						} else {
 							if ( HPWH.OutsideAirNode == 0 ) {
 								FanInletNode = "UNDEFINED";
-								FanOutletNode = hpwhAlpha[ 8 + nAlphaOffset ];
+								GetWaterThermalTankInputDataFanOutletNode = hpwhAlpha[ 8 + nAlphaOffset ];
 							} else {
 								FanInletNode = "UNDEFINED";
-								FanOutletNode = hpwhAlpha[ 10 + nAlphaOffset ];
+								GetWaterThermalTankInputDataFanOutletNode = hpwhAlpha[ 10 + nAlphaOffset ];
 							}
 						}
 					}
@@ -2342,7 +2374,7 @@ namespace WaterThermalTanks {
 						SetUpCompSets( HPWH.Type, HPWH.Name, HPWH.DXCoilType, HPWH.DXCoilName, CoilInletNode, CoilOutletNode );
 					}
 
-					SetUpCompSets( HPWH.Type, HPWH.Name, HPWH.FanType, HPWH.FanName, FanInletNode, FanOutletNode );
+					SetUpCompSets( HPWH.Type, HPWH.Name, HPWH.FanType, HPWH.FanName, FanInletNode, GetWaterThermalTankInputDataFanOutletNode );
 
 					// Control Logic Flag
 					std::string CtrlLogicFlag = hpwhAlphaBlank[ 29 + nAlphaOffset ] ? "SIMULTANEOUS" : hpwhAlpha[ 29 + nAlphaOffset ];
@@ -3371,6 +3403,20 @@ namespace WaterThermalTanks {
 						}
 					}
 
+					if ( !lAlphaFieldBlanks( 23 ) ) {
+						{auto const SELECT_CASE_var( cAlphaArgs( 23 ) );
+						if ( SELECT_CASE_var == "EXPLICIT" ) {
+							WaterThermalTank( WaterThermalTankNum ).SolutionAlgorithm = StratifiedSolverExplicit;
+						} else if ( SELECT_CASE_var == "IMPLICIT" ) {
+							WaterThermalTank( WaterThermalTankNum ).SolutionAlgorithm = StratifiedSolverImplicit;
+						} else {
+							ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Invalid " + cAlphaFieldNames( 23 ) + " entered=" + cAlphaArgs( 23 ) );
+							ErrorsFound = true;
+						}}
+					} else {
+						WaterThermalTank( WaterThermalTankNum ).SolutionAlgorithm = StratifiedSolverExplicit;
+					}
+
 				} // WaterThermalTankNum
 
 			}
@@ -4715,8 +4761,6 @@ namespace WaterThermalTanks {
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		static Real64 Tolerance( 1.0e-8 ); // Tolerance for Newton-Raphson solution
-		static Real64 FluidCond( 0.6 ); // Conductivity of water (W/m-K)
 		static std::string const RoutineName( "GetWaterThermalTankInput" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
@@ -4746,7 +4790,6 @@ namespace WaterThermalTanks {
 		Real64 c0;
 		Real64 G; // Function that should converge to zero for the Newton-Raphson solution
 		Real64 rho; // local fluid density (kg/m3)
-		static int DummyWaterIndex( 1 );
 
 		WaterThermalTankData & Tank = WaterThermalTank( WaterThermalTankNum );
 
@@ -4757,7 +4800,7 @@ namespace WaterThermalTanks {
 		if ( ( Tank.UseSidePlantLoopNum > 0 ) && allocated( PlantLoop ) ) {
 			rho = GetDensityGlycol( PlantLoop( Tank.UseSidePlantLoopNum ).FluidName, DataGlobals::InitConvTemp, PlantLoop( Tank.UseSidePlantLoopNum ).FluidIndex, RoutineName );
 		} else {
-			rho = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, DummyWaterIndex, RoutineName );
+			rho = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, SetupStratifiedNodesDummyWaterIndex, RoutineName );
 		}
 
 		NodeMass = Tank.Volume * rho / NumNodes;
@@ -5034,9 +5077,6 @@ namespace WaterThermalTanks {
 		Real64 FanVolFlow( 0.0 ); // Used for error checking fans used with HPWHs
 		//  LOGICAL,SAVE        :: ZoneEquipmentListChecked = .FALSE.  ! True after the Zone Equipment List has been checked for items
 		//  Integer             :: Loop
-		static Array1D_bool MyEnvrnFlag; // flag for init once at start of environment
-		static Array1D_bool MyWarmupFlag; // flag for init after warmup complete
-		static Array1D_bool SetLoopIndexFlag; // get loop number flag
 //		static Array1D_bool MySizingDoneFlag; // true if sizing is finished
 
 		static std::string const RoutineName( "InitWaterThermalTank" );
@@ -5049,9 +5089,6 @@ namespace WaterThermalTanks {
 		Real64 mdotSource; // local temporary for source side mass flow
 		bool errFlag;
 		Real64 rho; // local fluid density
-		static int DummyWaterIndex( 1 );
-		static Real64 TankChangeRateScale( 0.0 ); // local temporary for nominal tank change rate
-		static Real64 MaxSideVolFlow( 0.0 ); // local temporary for largest connection design flow
 		int VSCoilID( 0 );// id of varaible-speed HPWH coil
 
 		// FLOW:
@@ -5209,7 +5246,7 @@ namespace WaterThermalTanks {
 				WaterThermalTank( WaterThermalTankNum ).SourceOutletTemp = 0.0;
 				WaterThermalTank( WaterThermalTankNum ).SourceMassFlowRate = 0.0;
 				WaterThermalTank( WaterThermalTankNum ).SavedSourceOutletTemp = 0.0;
-				rho = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, DummyWaterIndex, SizeTankForDemand );
+				rho = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, InitWaterThermalTankDummyWaterIndex, SizeTankForDemand );
 				WaterThermalTank( WaterThermalTankNum ).PlantSourceMassFlowRateMax = WaterThermalTank( WaterThermalTankNum ).SourceDesignVolFlowRate * rho;
 			}
 
@@ -5327,6 +5364,8 @@ namespace WaterThermalTanks {
 		}
 		if ( WarmupFlag ) MyWarmupFlag( WaterThermalTankNum ) = true;
 
+		if ( BeginEnvrnFlag ) Checkpoint::RestoreWaterThermalTank( WaterThermalTankNum );
+
 		if ( FirstHVACIteration ) {
 			// Get all scheduled values
 			SchIndex = WaterThermalTank( WaterThermalTankNum ).SetPointTempSchedule;
@@ -5786,7 +5825,6 @@ namespace WaterThermalTanks {
 		bool SetPointRecovered; // Flag to indicate when setpoint is recovered for the first time
 		Real64 rho;
 		Real64 HPWHCondenserDeltaT( 0.0 ); // Temperature difference across the condenser for a heat pump water heater
-		static int DummyWaterIndex( 1 );
 
 		// Reference to objects
 		WaterThermalTankData & Tank = WaterThermalTank( WaterThermalTankNum ); // Reference to the tank object to save typing
@@ -5831,7 +5869,7 @@ namespace WaterThermalTanks {
 		if ( Tank.UseSidePlantLoopNum > 0 ) {
 			rho = GetDensityGlycol( PlantLoop( Tank.UseSidePlantLoopNum ).FluidName, TankTemp, PlantLoop( Tank.UseSidePlantLoopNum ).FluidIndex, RoutineName );
 		} else {
-			rho = GetDensityGlycol( fluidNameWater, TankTemp, DummyWaterIndex, RoutineName );
+			rho = GetDensityGlycol( fluidNameWater, TankTemp, CalcWaterThermalTankMixedDummyWaterIndex, RoutineName );
 		}
 
 		TankMass = rho * Tank.Volume;
@@ -5839,7 +5877,7 @@ namespace WaterThermalTanks {
 		if ( Tank.UseSidePlantLoopNum > 0 ) {
 			Cp = GetSpecificHeatGlycol( PlantLoop( Tank.UseSidePlantLoopNum ).FluidName, TankTemp, PlantLoop( Tank.UseSidePlantLoopNum ).FluidIndex, RoutineName );
 		} else {
-			Cp = GetSpecificHeatGlycol( fluidNameWater, TankTemp, DummyWaterIndex, RoutineName );
+			Cp = GetSpecificHeatGlycol( fluidNameWater, TankTemp, CalcWaterThermalTankMixedDummyWaterIndex, RoutineName );
 		}
 
 		SecInTimeStep = TimeStepSys * SecInHour;
@@ -6562,6 +6600,9 @@ namespace WaterThermalTanks {
 		// node at a sub time step interval of one second.  Temperatures and energies change dynamically over the system
 		// time step.  Final node temperatures are reported as final instantaneous values as well as averages over the
 		// time step.  Heat transfer rates are averages over the time step.
+		// With the implicit solution algorithm the node heat balances are solved together with the backward Euler method
+		// (see SolveStratifiedTankImplicit).  The sub time step then runs from one heater control event to the next, so
+		// the system time step is covered by a few solves.  Inversions left by the solution are mixed out afterwards.
 
 		// Using/Aliasing
 		using DataGlobals::TimeStep;
@@ -6576,13 +6617,16 @@ namespace WaterThermalTanks {
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		Real64 const dt( 1.0 ); // Sub time step interval (s)
+		Real64 const ExplicitTimeStep( 1.0 ); // Sub time step interval of the explicit solution (s)
+		Real64 const MinImplicitTimeStep( 1.0 ); // Smallest sub time step taken to reach a heater control event (s)
 		static std::string const RoutineName( "CalcWaterThermalTankStratified" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Real64 TimeElapsed; // Fraction of the current hour that has elapsed (h)
 		Real64 SecInTimeStep; // Seconds in one timestep (s)
 		Real64 TimeRemaining; // Time remaining in the current timestep (s)
+		Real64 dt( ExplicitTimeStep ); // Sub time step interval (s)
+		Real64 EventFrac; // Fraction of the sub time step before a heater control event
 		int NodeNum; // Node number index
 		Real64 NodeMass; // Mass of water in a node (kg)
 		Real64 NodeTemp; // Instantaneous node temperature (C)
@@ -6645,7 +6689,6 @@ namespace WaterThermalTanks {
 		Real64 Efuel; // Energy change for fuel consumed over the timestep (J)
 		int HPWHCondenserConfig( 0 ); // Condenser configuration of HPWH
 		bool SetPointRecovered; // Flag to indicate when set point is recovered for the first time
-		static int DummyWaterIndex( 1 );
 
 		// References
 		WaterThermalTankData & Tank = WaterThermalTank( WaterThermalTankNum ); // Tank object
@@ -6703,9 +6746,9 @@ namespace WaterThermalTanks {
 		if ( Tank.UseSidePlantLoopNum > 0 ) {
 			Cp = GetSpecificHeatGlycol( PlantLoop( Tank.UseSidePlantLoopNum ).FluidName, Tank.TankTemp, PlantLoop( Tank.UseSidePlantLoopNum ).FluidIndex, RoutineName );
 		} else {
-			Cp = GetSpecificHeatGlycol( fluidNameWater, Tank.TankTemp, DummyWaterIndex, RoutineName );
+			Cp = GetSpecificHeatGlycol( fluidNameWater, Tank.TankTemp, CalcWaterThermalTankStratifiedDummyWaterIndex, RoutineName );
 		}
-		Real64 const dt_Cp( dt / Cp );
+		Real64 const dt_Cp( ExplicitTimeStep / Cp );
 
 		TempUp = 0.0;
 		TempDn = 0.0;
@@ -6758,7 +6801,6 @@ namespace WaterThermalTanks {
 
 				if ( Tank.HeaterOn1 ) {
 					Qheater1 = Tank.MaxCapacity;
-					Runtime1 += dt;
 				} else {
 					Qheater1 = 0.0;
 				}
@@ -6787,7 +6829,6 @@ namespace WaterThermalTanks {
 
 				if ( Tank.HeaterOn2 ) {
 					Qheater2 = Tank.MaxCapacity2;
-					Runtime2 += dt;
 				} else {
 					Qheater2 = 0.0;
 				}
@@ -6800,8 +6841,6 @@ namespace WaterThermalTanks {
 			Real64 const Qheaters( Qheater1 + Qheater2 );
 
 			if ( Tank.HeaterOn1 || Tank.HeaterOn2 ) {
-				Runtime += dt;
-
 				Qfuel = Qheaters / Tank.Efficiency;
 				Qoncycfuel = Tank.OnCycParaLoad;
 				Qoffcycfuel = 0.0;
@@ -6811,100 +6850,192 @@ namespace WaterThermalTanks {
 				Qoffcycfuel = Tank.OffCycParaLoad;
 			}
 
-			// Loop through all nodes and simulate heat balance
-			for ( int NodeNum = 1, nTankNodes = Tank.Nodes; NodeNum <= nTankNodes; ++NodeNum ) {
-				auto & tank_node( Tank.Node( NodeNum ) );
-				NodeMass = tank_node.Mass;
-				NodeTemp = tank_node.Temp;
+			if ( Tank.SolutionAlgorithm == StratifiedSolverImplicit ) {
+
+				// Solve over the rest of the time step, then cut the sub time step back to the first heater control event
+				dt = TimeRemaining;
+				SolveStratifiedTankImplicit( WaterThermalTankNum, dt, Cp, Qheater1, Qheater2, Qheatpump, HPWHCondenserConfig );
 
-				UseMassFlowRate = tank_node.UseMassFlowRate * Tank.UseEffectiveness;
-				SourceMassFlowRate = tank_node.SourceMassFlowRate * Tank.SourceEffectiveness;
+				if ( !Tank.IsChilledWaterTank ) {
+					EventFrac = 1.0;
+					if ( Tank.MaxCapacity > 0.0 ) {
+						auto const & heater_node( Tank.Node( Tank.HeaterNode1 ) );
+						if ( Tank.HeaterOn1 ) {
+							if ( heater_node.NewTemp >= SetPointTemp1 ) EventFrac = min( EventFrac, ( SetPointTemp1 - heater_node.Temp ) / ( heater_node.NewTemp - heater_node.Temp ) );
+						} else if ( heater_node.NewTemp < MinTemp1 ) {
+							EventFrac = min( EventFrac, ( heater_node.Temp - MinTemp1 ) / ( heater_node.Temp - heater_node.NewTemp ) );
+						}
+					}
+					if ( ( Tank.MaxCapacity2 > 0.0 ) && !( ( Tank.ControlType == PriorityMasterSlave ) && Tank.HeaterOn1 ) ) {
+						auto const & heater_node( Tank.Node( Tank.HeaterNode2 ) );
+						if ( Tank.HeaterOn2 ) {
+							if ( heater_node.NewTemp >= SetPointTemp2 ) EventFrac = min( EventFrac, ( SetPointTemp2 - heater_node.Temp ) / ( heater_node.NewTemp - heater_node.Temp ) );
+						} else if ( heater_node.NewTemp < MinTemp2 ) {
+							EventFrac = min( EventFrac, ( heater_node.Temp - MinTemp2 ) / ( heater_node.Temp - heater_node.NewTemp ) );
+						}
+					}
 
-				// Heat transfer due to fluid flow entering an inlet node
-				Quse = UseMassFlowRate * Cp * ( UseInletTemp - NodeTemp );
-				if ( Tank.HeatPumpNum > 0 ) {
-					// Heat Pump Water Heater
-					if ( HPWHCondenserConfig == TypeOf_HeatPumpWtrHeaterPumped ) {
-						if ( SourceMassFlowRate > 0.0 ) {
-							Qsource = Qheatpump;
+					// The heaters are switched at the start of the next sub time step, on whole seconds as in the explicit solution
+					Real64 const EventTime( min( max( std::ceil( EventFrac * dt ), MinImplicitTimeStep ), TimeRemaining ) );
+					if ( EventTime < dt ) {
+						dt = EventTime;
+						SolveStratifiedTankImplicit( WaterThermalTankNum, dt, Cp, Qheater1, Qheater2, Qheatpump, HPWHCondenserConfig );
+					}
+				}
+
+				// Energies are evaluated at the end of the sub time step, consistent with the backward Euler solution
+				for ( int NodeNum = 1, nTankNodes = Tank.Nodes; NodeNum <= nTankNodes; ++NodeNum ) {
+					auto const & tank_node( Tank.Node( NodeNum ) );
+					NodeTemp = tank_node.NewTemp;
+
+					UseMassFlowRate = tank_node.UseMassFlowRate * Tank.UseEffectiveness;
+					SourceMassFlowRate = tank_node.SourceMassFlowRate * Tank.SourceEffectiveness;
+
+					Quse = UseMassFlowRate * Cp * ( UseInletTemp - NodeTemp );
+					if ( Tank.HeatPumpNum > 0 ) {
+						if ( HPWHCondenserConfig == TypeOf_HeatPumpWtrHeaterPumped ) {
+							if ( SourceMassFlowRate > 0.0 ) {
+								Qsource = Qheatpump;
+							} else {
+								Qsource = 0.0;
+							}
 						} else {
-							Qsource = 0.0;
+							Qsource = Qheatpump * tank_node.HPWHWrappedCondenserHeatingFrac;
 						}
 					} else {
-						assert( HPWHCondenserConfig == TypeOf_HeatPumpWtrHeaterWrapped );
-						Qsource = Qheatpump * tank_node.HPWHWrappedCondenserHeatingFrac;
+						Qsource = SourceMassFlowRate * Cp * ( SourceInletTemp - NodeTemp );
 					}
-				} else {
-					// Constant temperature source side flow
-					Qsource = SourceMassFlowRate * Cp * ( SourceInletTemp - NodeTemp );
+
+					if ( Tank.HeaterOn1 || Tank.HeaterOn2 ) {
+						Qloss = tank_node.OnCycLossCoeff * ( AmbientTemp - NodeTemp );
+						Qneeded = max( -( Quse + Qsource + Qloss ) - tank_node.OnCycParaLoad * Tank.OnCycParaFracToTank, 0.0 );
+					} else {
+						Qloss = tank_node.OffCycLossCoeff * ( AmbientTemp - NodeTemp );
+						Qneeded = max( -( Quse + Qsource + Qloss ) - tank_node.OffCycParaLoad * Tank.OffCycParaFracToTank, 0.0 );
+					}
+					Qunmet = max( Qneeded - Qheaters, 0.0 );
+
+					Esource += Qsource * dt;
+					Eloss += Qloss * dt;
+					Eneeded += Qneeded * dt;
+					Eunmet += Qunmet * dt;
 				}
 
-				InvMixUp = 0.0;
-				if ( NodeNum > 1 ) {
-					TempUp = Tank.Node( NodeNum - 1 ).Temp;
-					if ( TempUp < NodeTemp ) InvMixUp = Tank.InversionMixingRate;
+				Euse += Tank.UseMassFlowRate * ( UseInletTemp - Tank.Node( Tank.UseOutletStratNode ).NewTemp ) * dt;
+
+				MixStratifiedTankInversions( WaterThermalTankNum );
+
+				if ( !Tank.IsChilledWaterTank ) {
+					if ( tank_node1_newTemp > MaxTemp ) {
+						Event += Tank.Node( 1 ).Mass * ( MaxTemp - tank_node1_newTemp );
+						tank_node1_newTemp = MaxTemp;
+					}
 				}
+
+			} else {
+
+				// Loop through all nodes and simulate heat balance
+				for ( int NodeNum = 1, nTankNodes = Tank.Nodes; NodeNum <= nTankNodes; ++NodeNum ) {
+					auto & tank_node( Tank.Node( NodeNum ) );
+					NodeMass = tank_node.Mass;
+					NodeTemp = tank_node.Temp;
+
+					UseMassFlowRate = tank_node.UseMassFlowRate * Tank.UseEffectiveness;
+					SourceMassFlowRate = tank_node.SourceMassFlowRate * Tank.SourceEffectiveness;
+
+					// Heat transfer due to fluid flow entering an inlet node
+					Quse = UseMassFlowRate * Cp * ( UseInletTemp - NodeTemp );
+					if ( Tank.HeatPumpNum > 0 ) {
+						// Heat Pump Water Heater
+						if ( HPWHCondenserConfig == TypeOf_HeatPumpWtrHeaterPumped ) {
+							if ( SourceMassFlowRate > 0.0 ) {
+								Qsource = Qheatpump;
+							} else {
+								Qsource = 0.0;
+							}
+						} else {
+							assert( HPWHCondenserConfig == TypeOf_HeatPumpWtrHeaterWrapped );
+							Qsource = Qheatpump * tank_node.HPWHWrappedCondenserHeatingFrac;
+						}
+					} else {
+						// Constant temperature source side flow
+						Qsource = SourceMassFlowRate * Cp * ( SourceInletTemp - NodeTemp );
+					}
+
+					InvMixUp = 0.0;
+					if ( NodeNum > 1 ) {
+						TempUp = Tank.Node( NodeNum - 1 ).Temp;
+						if ( TempUp < NodeTemp ) InvMixUp = Tank.InversionMixingRate;
+					}
 //BUG? When NodeNum==1 TempUp is 0.0   Shouldn't it be NodeTemp to void the vertical conduction? !!!!!!!!!!!!!!!!!
-				Real64 const delTempUp( TempUp - NodeTemp );
+					Real64 const delTempUp( TempUp - NodeTemp );
 
-				InvMixDn = 0.0;
-				if ( NodeNum < nTankNodes ) {
-					TempDn = Tank.Node( NodeNum + 1 ).Temp;
-					if ( TempDn > NodeTemp ) InvMixDn = Tank.InversionMixingRate;
-				}
-				Real64 const delTempDn( TempDn - NodeTemp );
+					InvMixDn = 0.0;
+					if ( NodeNum < nTankNodes ) {
+						TempDn = Tank.Node( NodeNum + 1 ).Temp;
+						if ( TempDn > NodeTemp ) InvMixDn = Tank.InversionMixingRate;
+					}
+					Real64 const delTempDn( TempDn - NodeTemp );
 
-				// Heat transfer due to vertical conduction between nodes
-				Qcond = tank_node.CondCoeffUp * delTempUp + tank_node.CondCoeffDn * delTempDn;
+					// Heat transfer due to vertical conduction between nodes
+					Qcond = tank_node.CondCoeffUp * delTempUp + tank_node.CondCoeffDn * delTempDn;
 
-				// Heat transfer due to fluid flow between inlet and outlet nodes
-				Qflow = Cp * ( tank_node.MassFlowFromUpper * delTempUp + tank_node.MassFlowFromLower * delTempDn );
+					// Heat transfer due to fluid flow between inlet and outlet nodes
+					Qflow = Cp * ( tank_node.MassFlowFromUpper * delTempUp + tank_node.MassFlowFromLower * delTempDn );
 
-				// Heat transfer due to temperature inversion mixing between nodes
-				Qmix = Cp * ( InvMixUp * delTempUp + InvMixDn * delTempDn );
+					// Heat transfer due to temperature inversion mixing between nodes
+					Qmix = Cp * ( InvMixUp * delTempUp + InvMixDn * delTempDn );
 
-				if ( Tank.HeaterOn1 || Tank.HeaterOn2 ) {
-					LossCoeff = tank_node.OnCycLossCoeff;
-					Qloss = LossCoeff * ( AmbientTemp - NodeTemp );
-					Qheat = Qoncycheat = tank_node.OnCycParaLoad * Tank.OnCycParaFracToTank;
-					Qusl = Quse + Qsource + Qloss;
+					if ( Tank.HeaterOn1 || Tank.HeaterOn2 ) {
+						LossCoeff = tank_node.OnCycLossCoeff;
+						Qloss = LossCoeff * ( AmbientTemp - NodeTemp );
+						Qheat = Qoncycheat = tank_node.OnCycParaLoad * Tank.OnCycParaFracToTank;
+						Qusl = Quse + Qsource + Qloss;
 
-					Qneeded = max( -Qusl - Qoncycheat, 0.0 );
+						Qneeded = max( -Qusl - Qoncycheat, 0.0 );
 
-					if ( NodeNum == Tank.HeaterNode1 ) {
-						Qheat += Qheater1;
-					} else if ( NodeNum == Tank.HeaterNode2 ) {
-						Qheat += Qheater2;
-					}
-				} else {
-					LossCoeff = tank_node.OffCycLossCoeff;
-					Qloss = LossCoeff * ( AmbientTemp - NodeTemp );
-					Qheat = Qoffcycheat = tank_node.OffCycParaLoad * Tank.OffCycParaFracToTank;
-					Qusl = Quse + Qsource + Qloss;
+						if ( NodeNum == Tank.HeaterNode1 ) {
+							Qheat += Qheater1;
+						} else if ( NodeNum == Tank.HeaterNode2 ) {
+							Qheat += Qheater2;
+						}
+					} else {
+						LossCoeff = tank_node.OffCycLossCoeff;
+						Qloss = LossCoeff * ( AmbientTemp - NodeTemp );
+						Qheat = Qoffcycheat = tank_node.OffCycParaLoad * Tank.OffCycParaFracToTank;
+						Qusl = Quse + Qsource + Qloss;
 
-					Qneeded = max( -Qusl - Qoffcycheat, 0.0 );
-				}
+						Qneeded = max( -Qusl - Qoffcycheat, 0.0 );
+					}
 
-				Qunmet = max( Qneeded - Qheaters, 0.0 );
+					Qunmet = max( Qneeded - Qheaters, 0.0 );
 
-				// Calculate node heat balance
-				tank_node.NewTemp = NodeTemp + ( Qusl + Qcond + Qflow + Qmix + Qheat ) * dt_Cp / NodeMass;
+					// Calculate node heat balance
+					tank_node.NewTemp = NodeTemp + ( Qusl + Qcond + Qflow + Qmix + Qheat ) * dt_Cp / NodeMass;
 
-				if ( !Tank.IsChilledWaterTank ) {
-					if ( ( NodeNum == 1 ) && ( tank_node1_newTemp > MaxTemp ) ) {
-						Event += NodeMass * ( MaxTemp - tank_node1_newTemp );
-						tank_node1_newTemp = MaxTemp;
+					if ( !Tank.IsChilledWaterTank ) {
+						if ( ( NodeNum == 1 ) && ( tank_node1_newTemp > MaxTemp ) ) {
+							Event += NodeMass * ( MaxTemp - tank_node1_newTemp );
+							tank_node1_newTemp = MaxTemp;
+						}
 					}
-				}
 
-				Esource += Qsource;
-				Eloss += Qloss;
-				Eneeded += Qneeded;
-				Eunmet += Qunmet;
+					Esource += Qsource * dt;
+					Eloss += Qloss * dt;
+					Eneeded += Qneeded * dt;
+					Eunmet += Qunmet * dt;
 
-			} // NodeNum
+				} // NodeNum
+
+				Euse += Tank.UseMassFlowRate * ( UseInletTemp - tank_useOutletStratNode_temp ) * dt;
+
+			}
 
-			Euse += Tank.UseMassFlowRate * ( UseInletTemp - tank_useOutletStratNode_temp );
+			if ( !Tank.IsChilledWaterTank ) {
+				if ( Tank.HeaterOn1 ) Runtime1 += dt;
+				if ( Tank.HeaterOn2 ) Runtime2 += dt;
+			}
+			if ( Tank.HeaterOn1 || Tank.HeaterOn2 ) Runtime += dt;
 
 			// Calculation for standard ratings
 			if ( !Tank.FirstRecoveryDone ) {
@@ -6924,12 +7055,8 @@ namespace WaterThermalTanks {
 
 		// Finalize accumulated values
 		Event *= Cp;
-		Esource *= dt;
-		Eloss *= dt;
 		Elosszone = Eloss * Tank.SkinLossFracToZone;
-		Eneeded *= dt;
-		Eunmet *= dt;
-		Euse *= Cp * dt;
+		Euse *= Cp;
 
 		Eheater1 = Tank.MaxCapacity * Runtime1;
 		Eheater2 = Tank.MaxCapacity2 * Runtime2;
@@ -6972,6 +7099,8 @@ namespace WaterThermalTanks {
 		// Revised use outlet temperature to ensure energy balance. Assumes a constant CP. CR8341/CR8570
 		if ( NodeNum > 0 ) {
 			if ( Tank.UseMassFlowRate > 0.0 ) {
+				// The implicit solution draws from the outlet node before the inversions are mixed out
+				if ( Tank.SolutionAlgorithm == StratifiedSolverImplicit ) Tank.UseOutletTemp = UseInletTemp - Quse / ( Tank.UseMassFlowRate * Cp );
 				Tank.UseOutletTemp = Tank.UseInletTemp * ( 1.0 - Tank.UseEffectiveness ) + Tank.UseOutletTemp * Tank.UseEffectiveness;
 			}
 		}
@@ -7036,6 +7165,168 @@ namespace WaterThermalTanks {
 
 	}
 
+	void
+	SolveStratifiedTankImplicit(
+		int const WaterThermalTankNum, // Water Heater being simulated
+		Real64 const dt, // Sub time step interval (s)
+		Real64 const Cp, // Specific heat of water (J/kg K)
+		Real64 const Qheater1, // Heating rate of heater 1 over the sub time step (W)
+		Real64 const Qheater2, // Heating rate of heater 2 over the sub time step (W)
+		Real64 const Qheatpump, // Heating rate from the heat pump (W)
+		int const HPWHCondenserConfig // Condenser configuration of HPWH
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solves the node heat balances of a stratified tank over one sub time step with the backward Euler method.
+
+		// METHODOLOGY EMPLOYED:
+		// The heat balance terms of CalcWaterThermalTankStratified are written at the end of the sub time step.  Vertical
+		// conduction, flow between nodes and inversion mixing couple each node only to the nodes above and below it, so the
+		// balances form a tridiagonal system that is solved directly with the Thomas algorithm.  Inversion mixing is applied
+		// between the nodes that are inverted at the start of the sub time step.  Heater, parasitic and heat pump heating
+		// rates are constant over the sub time step.  The new temperatures are returned in Node%NewTemp; Node%Temp is
+		// not changed.
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+
+		WaterThermalTankData & Tank = WaterThermalTank( WaterThermalTankNum ); // Tank object
+		int const nTankNodes( Tank.Nodes );
+		bool const HeaterOn( Tank.HeaterOn1 || Tank.HeaterOn2 );
+
+		if ( Diag.size() < static_cast< std::size_t >( nTankNodes ) ) {
+			Lower.dimension( nTankNodes, 0.0 );
+			Diag.dimension( nTankNodes, 0.0 );
+			Upper.dimension( nTankNodes, 0.0 );
+			RHS.dimension( nTankNodes, 0.0 );
+		}
+
+		for ( int NodeNum = 1; NodeNum <= nTankNodes; ++NodeNum ) {
+			auto const & tank_node( Tank.Node( NodeNum ) );
+			Real64 const NodeTemp( tank_node.Temp );
+			Real64 const UseMassFlowRate( tank_node.UseMassFlowRate * Tank.UseEffectiveness );
+			Real64 const SourceMassFlowRate( tank_node.SourceMassFlowRate * Tank.SourceEffectiveness );
+
+			// Conduction, flow and inversion mixing conductances to the nodes above and below (W/K)
+			Real64 CoeffUp( 0.0 );
+			if ( NodeNum > 1 ) {
+				CoeffUp = tank_node.CondCoeffUp + Cp * tank_node.MassFlowFromUpper;
+				if ( Tank.Node( NodeNum - 1 ).Temp < NodeTemp ) CoeffUp += Cp * Tank.InversionMixingRate;
+			}
+			Real64 CoeffDn( 0.0 );
+			if ( NodeNum < nTankNodes ) {
+				CoeffDn = tank_node.CondCoeffDn + Cp * tank_node.MassFlowFromLower;
+				if ( Tank.Node( NodeNum + 1 ).Temp > NodeTemp ) CoeffDn += Cp * Tank.InversionMixingRate;
+			}
+
+			Real64 LossCoeff;
+			Real64 Qheat;
+			if ( HeaterOn ) {
+				LossCoeff = tank_node.OnCycLossCoeff;
+				Qheat = tank_node.OnCycParaLoad * Tank.OnCycParaFracToTank;
+				if ( NodeNum == Tank.HeaterNode1 ) {
+					Qheat += Qheater1;
+				} else if ( NodeNum == Tank.HeaterNode2 ) {
+					Qheat += Qheater2;
+				}
+			} else {
+				LossCoeff = tank_node.OffCycLossCoeff;
+				Qheat = tank_node.OffCycParaLoad * Tank.OffCycParaFracToTank;
+			}
+
+			Real64 const Capacitance( tank_node.Mass * Cp / dt );
+			Lower( NodeNum ) = -CoeffUp;
+			Upper( NodeNum ) = -CoeffDn;
+			Diag( NodeNum ) = Capacitance + UseMassFlowRate * Cp + LossCoeff + CoeffUp + CoeffDn;
+			RHS( NodeNum ) = Capacitance * NodeTemp + UseMassFlowRate * Cp * Tank.UseInletTemp + LossCoeff * Tank.AmbientTemp + Qheat;
+
+			if ( Tank.HeatPumpNum > 0 ) {
+				if ( HPWHCondenserConfig == TypeOf_HeatPumpWtrHeaterPumped ) {
+					if ( SourceMassFlowRate > 0.0 ) RHS( NodeNum ) += Qheatpump;
+				} else {
+					RHS( NodeNum ) += Qheatpump * tank_node.HPWHWrappedCondenserHeatingFrac;
+				}
+			} else {
+				Diag( NodeNum ) += SourceMassFlowRate * Cp;
+				RHS( NodeNum ) += SourceMassFlowRate * Cp * Tank.SourceInletTemp;
+			}
+		}
+
+		// Forward elimination and back substitution
+		for ( int NodeNum = 2; NodeNum <= nTankNodes; ++NodeNum ) {
+			Real64 const Factor( Lower( NodeNum ) / Diag( NodeNum - 1 ) );
+			Diag( NodeNum ) -= Factor * Upper( NodeNum - 1 );
+			RHS( NodeNum ) -= Factor * RHS( NodeNum - 1 );
+		}
+		Tank.Node( nTankNodes ).NewTemp = RHS( nTankNodes ) / Diag( nTankNodes );
+		for ( int NodeNum = nTankNodes - 1; NodeNum >= 1; --NodeNum ) {
+			Tank.Node( NodeNum ).NewTemp = ( RHS( NodeNum ) - Upper( NodeNum ) * Tank.Node( NodeNum + 1 ).NewTemp ) / Diag( NodeNum );
+		}
+
+	}
+
+	void
+	MixStratifiedTankInversions( int const WaterThermalTankNum ) // Water Heater being simulated
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Mixes out the temperature inversions left in the new node temperatures of a stratified tank.
+
+		// METHODOLOGY EMPLOYED:
+		// Working down from the top of the tank, each node starts a new layer.  While the layer above it is cooler the two
+		// layers are mixed into one at their mass weighted average temperature, which conserves the stored energy.  The
+		// layer temperatures are then copied back to Node%NewTemp.
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+
+		WaterThermalTankData & Tank = WaterThermalTank( WaterThermalTankNum ); // Tank object
+		int const nTankNodes( Tank.Nodes );
+		int NumLayers( 0 );
+
+		if ( LayerMass.size() < static_cast< std::size_t >( nTankNodes ) ) {
+			LayerTopNode.dimension( nTankNodes, 0 );
+			LayerMass.dimension( nTankNodes, 0.0 );
+			LayerTemp.dimension( nTankNodes, 0.0 );
+		}
+
+		for ( int NodeNum = 1; NodeNum <= nTankNodes; ++NodeNum ) {
+			++NumLayers;
+			LayerTopNode( NumLayers ) = NodeNum;
+			LayerMass( NumLayers ) = Tank.Node( NodeNum ).Mass;
+			LayerTemp( NumLayers ) = Tank.Node( NodeNum ).NewTemp;
+			while ( ( NumLayers > 1 ) && ( LayerTemp( NumLayers - 1 ) < LayerTemp( NumLayers ) ) ) {
+				Real64 const MixedMass( LayerMass( NumLayers - 1 ) + LayerMass( NumLayers ) );
+				LayerTemp( NumLayers - 1 ) = ( LayerMass( NumLayers - 1 ) * LayerTemp( NumLayers - 1 ) + LayerMass( NumLayers ) * LayerTemp( NumLayers ) ) / MixedMass;
+				LayerMass( NumLayers - 1 ) = MixedMass;
+				--NumLayers;
+			}
+		}
+
+		if ( NumLayers == nTankNodes ) return; // No inversions
+
+		for ( int Layer = 1; Layer <= NumLayers; ++Layer ) {
+			int const BottomNode( ( Layer < NumLayers ) ? LayerTopNode( Layer + 1 ) - 1 : nTankNodes );
+			for ( int NodeNum = LayerTopNode( Layer ); NodeNum <= BottomNode; ++NodeNum ) {
+				Tank.Node( NodeNum ).NewTemp = LayerTemp( Layer );
+			}
+		}
+
+	}
+
 	void
 	CalcNodeMassFlows(
 		int const WaterThermalTankNum, // Water Heater being simulated
@@ -7268,7 +7559,6 @@ namespace WaterThermalTanks {
 		int SolFla; // Flag of RegulaFalsi solver
 		int SourceID; // Waste Heat Source ID number
 		Array1D< Real64 > Par( 5 ); // Parameters passed to RegulaFalsi
-		static Real64 MinTemp( 0.0 ); // used for error messages, C
 		std::string IterNum; // Max number of iterations for warning message
 
 		// FLOW:
@@ -7456,7 +7746,7 @@ namespace WaterThermalTanks {
 							Par( 4 ) = 0.0;
 						}
 						Par( 5 ) = MdotWater;
-						SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadRatio, PLRResidualMixedTank, 0.0, WaterHeaterDesuperheater( DesuperheaterNum ).DXSysPLR, Par );
+						SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadRatio, PLRResidualMixedTank, 0.0, WaterHeaterDesuperheater( DesuperheaterNum ).DXSysPLR, Par, "CalcDesuperheaterWaterHeater" );
 						if ( SolFla == -1 ) {
 							gio::write( IterNum, fmtLD ) << MaxIte;
 							strip( IterNum );
@@ -7536,7 +7826,7 @@ namespace WaterThermalTanks {
 								Par( 4 ) = 0.0;
 							}
 							Par( 5 ) = MdotWater;
-							SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadRatio, PLRResidualMixedTank, 0.0, WaterHeaterDesuperheater( DesuperheaterNum ).DXSysPLR, Par );
+							SolveRegulaFalsi( Acc, MaxIte, SolFla, PartLoadRatio, PLRResidualMixedTank, 0.0, WaterHeaterDesuperheater( DesuperheaterNum ).DXSysPLR, Par, "CalcDesuperheaterWaterHeater" );
 							if ( SolFla == -1 ) {
 								gio::write( IterNum, fmtLD ) << MaxIte;
 								strip( IterNum );
@@ -8123,7 +8413,7 @@ namespace WaterThermalTanks {
 				}
 
 				if ( zeroResidual > 0.0 ) { // then iteration
-					SolveRegulaFalsi( Acc, MaxIte, SolFla, HPPartLoadRatio, PLRResidualHPWH, 0.0, 1.0, Par );
+					SolveRegulaFalsi( Acc, MaxIte, SolFla, HPPartLoadRatio, PLRResidualHPWH, 0.0, 1.0, Par, "CalcHeatPumpWaterHeater" );
 					if ( SolFla == -1 ) {
 						gio::write( IterNum, fmtLD ) << MaxIte;
 						strip( IterNum );
@@ -8248,7 +8538,7 @@ namespace WaterThermalTanks {
 							ParVS( 9 ) = 0.0;
 						}
 
-						SolveRegulaFalsi( Acc, MaxIte, SolFla, SpeedRatio, PLRResidualIterSpeed, 1.0e-10, 1.0, ParVS );
+						SolveRegulaFalsi( Acc, MaxIte, SolFla, SpeedRatio, PLRResidualIterSpeed, 1.0e-10, 1.0, ParVS, "CalcHeatPumpWaterHeater" );
 
 						if ( SolFla == -1 ) {
 							gio::write( IterNum, fmtLD ) << MaxIte;
@@ -9344,7 +9634,6 @@ namespace WaterThermalTanks {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int PltSizNum; // Plant Sizing index corresponding to CurLoopNum
 		bool ErrorsFound; // If errors detected in input
-		static int DummyWaterIndex( 1 );
 		Real64 rho; // temporary fluid density
 		int tmpLoopNum;
 		int tmpLoopSideNum;
@@ -9414,7 +9703,7 @@ namespace WaterThermalTanks {
 				if ( WaterThermalTank( WaterThermalTankNum ).UseSidePlantLoopNum > 0 ) {
 					rho = GetDensityGlycol( PlantLoop( WaterThermalTank( WaterThermalTankNum ).UseSidePlantLoopNum ).FluidName, DataGlobals::InitConvTemp, PlantLoop( WaterThermalTank( WaterThermalTankNum ).UseSidePlantLoopNum ).FluidIndex, RoutineName );
 				} else {
-					rho = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, DummyWaterIndex, RoutineName );
+					rho = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, SizeSupplySidePlantConnectionsDummyWaterIndex, RoutineName );
 				}
 
 				WaterThermalTank( WaterThermalTankNum ).PlantUseMassFlowRateMax = WaterThermalTank( WaterThermalTankNum ).UseDesignVolFlowRate * rho;
@@ -9469,7 +9758,7 @@ namespace WaterThermalTanks {
 					if ( WaterThermalTank( WaterThermalTankNum ).SourceSidePlantLoopNum > 0 ) {
 						rho = GetDensityGlycol( PlantLoop( WaterThermalTank( WaterThermalTankNum ).SourceSidePlantLoopNum ).FluidName, DataGlobals::InitConvTemp, PlantLoop( WaterThermalTank( WaterThermalTankNum ).SourceSidePlantLoopNum ).FluidIndex, RoutineName );
 					} else {
-						rho = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, DummyWaterIndex, RoutineName );
+						rho = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, SizeSupplySidePlantConnectionsDummyWaterIndex, RoutineName );
 					}
 					WaterThermalTank( WaterThermalTankNum ).PlantSourceMassFlowRateMax = WaterThermalTank( WaterThermalTankNum ).SourceDesignVolFlowRate * rho;
 				}
@@ -9539,10 +9828,8 @@ namespace WaterThermalTanks {
 //		static bool SizeMaxCapacity( false );
 		Real64 rho;
 		Real64 Cp;
-		static int DummyWaterIndex( 1 );
 		Real64 tmpTankVolume; // local temporary for tank volume m3
 		Real64 tmpMaxCapacity; // local temporary for heating capacity W
-		static bool FuelTypeIsLikeGas( false );
 
 		// local inits
 		Tstart = 14.44;
@@ -9721,8 +10008,8 @@ namespace WaterThermalTanks {
 				rho = GetDensityGlycol( PlantLoop( WaterThermalTank( WaterThermalTankNum ).UseSidePlantLoopNum ).FluidName, ( ( Tfinish + Tstart ) / 2.0 ), PlantLoop( WaterThermalTank( WaterThermalTankNum ).UseSidePlantLoopNum ).FluidIndex, RoutineName );
 				Cp = GetSpecificHeatGlycol( PlantLoop( WaterThermalTank( WaterThermalTankNum ).UseSidePlantLoopNum ).FluidName, ( ( Tfinish + Tstart ) / 2.0 ), PlantLoop( WaterThermalTank( WaterThermalTankNum ).UseSidePlantLoopNum ).FluidIndex, RoutineName );
 			} else {
-				rho = GetDensityGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), DummyWaterIndex, RoutineName );
-				Cp = GetSpecificHeatGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), DummyWaterIndex, RoutineName );
+				rho = GetDensityGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), SizeTankForDemandSideDummyWaterIndex, RoutineName );
+				Cp = GetSpecificHeatGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), SizeTankForDemandSideDummyWaterIndex, RoutineName );
 			}
 
 			if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = SumPeopleAllZones * WaterThermalTank( WaterThermalTankNum ).Sizing.RecoveryCapacityPerPerson * ( Tfinish - Tstart ) * ( 1.0 / SecInHour ) * rho * Cp; //m3/hr/person | delta T  in K | 1 hr/ 3600 s | kg/m3 | J/Kg/k
@@ -9756,8 +10043,8 @@ namespace WaterThermalTanks {
 				rho = GetDensityGlycol( PlantLoop( WaterThermalTank( WaterThermalTankNum ).UseSidePlantLoopNum ).FluidName, ( ( Tfinish + Tstart ) / 2.0 ), PlantLoop( WaterThermalTank( WaterThermalTankNum ).UseSidePlantLoopNum ).FluidIndex, RoutineName );
 				Cp = GetSpecificHeatGlycol( PlantLoop( WaterThermalTank( WaterThermalTankNum ).UseSidePlantLoopNum ).FluidName, ( ( Tfinish + Tstart ) / 2.0 ), PlantLoop( WaterThermalTank( WaterThermalTankNum ).UseSidePlantLoopNum ).FluidIndex, RoutineName );
 			} else {
-				rho = GetDensityGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), DummyWaterIndex, RoutineName );
-				Cp = GetSpecificHeatGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), DummyWaterIndex, RoutineName );
+				rho = GetDensityGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), SizeTankForDemandSideDummyWaterIndex, RoutineName );
+				Cp = GetSpecificHeatGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), SizeTankForDemandSideDummyWaterIndex, RoutineName );
 			}
 
 			if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = SumFloorAreaAllZones * WaterThermalTank( WaterThermalTankNum ).Sizing.RecoveryCapacityPerArea * ( Tfinish - Tstart ) * ( 1.0 / SecInHour ) * rho * Cp; // m2 | m3/hr/m2 | delta T  in K | 1 hr/ 3600 s | kg/m3 | J/Kg/k
@@ -9790,8 +10077,8 @@ namespace WaterThermalTanks {
 				rho = GetDensityGlycol( PlantLoop( WaterThermalTank( WaterThermalTankNum ).UseSidePlantLoopNum ).FluidName, ( ( Tfinish + Tstart ) / 2.0 ), PlantLoop( WaterThermalTank( WaterThermalTankNum ).UseSidePlantLoopNum ).FluidIndex, RoutineName );
 				Cp = GetSpecificHeatGlycol( PlantLoop( WaterThermalTank( WaterThermalTankNum ).UseSidePlantLoopNum ).FluidName, ( ( Tfinish + Tstart ) / 2.0 ), PlantLoop( WaterThermalTank( WaterThermalTankNum ).UseSidePlantLoopNum ).FluidIndex, RoutineName );
 			} else {
-				rho = GetDensityGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), DummyWaterIndex, RoutineName );
-				Cp = GetSpecificHeatGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), DummyWaterIndex, RoutineName );
+				rho = GetDensityGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), SizeTankForDemandSideDummyWaterIndex, RoutineName );
+				Cp = GetSpecificHeatGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), SizeTankForDemandSideDummyWaterIndex, RoutineName );
 			}
 			if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = WaterThermalTank( WaterThermalTankNum ).Sizing.NumberOfUnits * WaterThermalTank( WaterThermalTankNum ).Sizing.RecoveryCapacityPerUnit * ( Tfinish - Tstart ) * ( 1.0 / SecInHour ) * rho * Cp; //m3/hr/ea | delta T  in K | 1 hr/ 3600 s | kg/m3 | J/Kg/k
 			if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized && PlantFirstSizesOkayToFinalize ) {
@@ -9893,7 +10180,6 @@ namespace WaterThermalTanks {
 		int CollectorNum;
 		Real64 rho;
 		Real64 Cp;
-		static int DummyWaterIndex( 1 );
 		Real64 tmpTankVolume; // local temporary for tank volume m3
 		Real64 tmpMaxCapacity; // local temporary for heating capacity W
 
@@ -9925,8 +10211,8 @@ namespace WaterThermalTanks {
 						rho = GetDensityGlycol( PlantLoop( WaterThermalTank( WaterThermalTankNum ).SourceSidePlantLoopNum ).FluidName, ( ( Tfinish + Tstart ) / 2.0 ), PlantLoop( WaterThermalTank( WaterThermalTankNum ).SourceSidePlantLoopNum ).FluidIndex, RoutineName );
 						Cp = GetSpecificHeatGlycol( PlantLoop( WaterThermalTank( WaterThermalTankNum ).SourceSidePlantLoopNum ).FluidName, ( ( Tfinish + Tstart ) / 2.0 ), PlantLoop( WaterThermalTank( WaterThermalTankNum ).SourceSidePlantLoopNum ).FluidIndex, RoutineName );
 					} else {
-						rho = GetDensityGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), DummyWaterIndex, RoutineName );
-						Cp = GetSpecificHeatGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), DummyWaterIndex, RoutineName );
+						rho = GetDensityGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), SizeTankForSupplySideDummyWaterIndex, RoutineName );
+						Cp = GetSpecificHeatGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), SizeTankForSupplySideDummyWaterIndex, RoutineName );
 					}
 					tmpMaxCapacity = ( WaterThermalTank( WaterThermalTankNum ).Volume * rho * Cp * ( Tfinish - Tstart ) ) / ( WaterThermalTank( WaterThermalTankNum ).Sizing.RecoveryTime * SecInHour ); // m3 | kg/m3 | J/Kg/K | K | seconds
 				} else {
@@ -10054,7 +10340,6 @@ namespace WaterThermalTanks {
 
 		Real64 eff; // temporary effectiveness value for heat exchanger inside tank
 
-		static int DummyWaterIndex( 1 );
 		Real64 rho;
 		Real64 tmpUseDesignVolFlowRate; // local use side design flow rate
 		Real64 tmpSourceDesignVolFlowRate; // local use side design flow rate
@@ -10146,7 +10431,7 @@ namespace WaterThermalTanks {
 				if ( WaterThermalTank( WaterThermalTankNum ).UseSidePlantLoopNum > 0 ) {
 					rho = GetDensityGlycol( PlantLoop( WaterThermalTank( WaterThermalTankNum ).UseSidePlantLoopNum ).FluidName, DataGlobals::InitConvTemp, PlantLoop( WaterThermalTank( WaterThermalTankNum ).UseSidePlantLoopNum ).FluidIndex, RoutineName );
 				} else {
-					rho = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, DummyWaterIndex, RoutineName );
+					rho = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, SizeDemandSidePlantConnectionsDummyWaterIndex, RoutineName );
 				}
 				WaterThermalTank( WaterThermalTankNum ).PlantUseMassFlowRateMax = WaterThermalTank( WaterThermalTankNum ).UseDesignVolFlowRate * rho;
 			} //autosizing needed.
@@ -10217,7 +10502,7 @@ namespace WaterThermalTanks {
 				if ( WaterThermalTank( WaterThermalTankNum ).SourceSidePlantLoopNum > 0 ) {
 					rho = GetDensityGlycol( PlantLoop( WaterThermalTank( WaterThermalTankNum ).SourceSidePlantLoopNum ).FluidName, DataGlobals::InitConvTemp, PlantLoop( WaterThermalTank( WaterThermalTankNum ).SourceSidePlantLoopNum ).FluidIndex, RoutineName );
 				} else {
-					rho = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, DummyWaterIndex, RoutineName );
+					rho = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, SizeDemandSidePlantConnectionsDummyWaterIndex, RoutineName );
 				}
 				WaterThermalTank( WaterThermalTankNum ).PlantSourceMassFlowRateMax = WaterThermalTank( WaterThermalTankNum ).SourceDesignVolFlowRate * rho;
 			} //autosizing needed.
@@ -10277,8 +10562,6 @@ namespace WaterThermalTanks {
 		Real64 tmpMaxCapacity; // local temporary for heating capacity W
 		Real64 Tstart; // initial tank temp for sizing.
 		Real64 Tfinish; // final target temp for sizing
-		static bool FuelTypeIsLikeGas( false );
-		static int DummyWaterIndex( 1 );
 		Real64 rho;
 		Real64 Cp;
 		Real64 DrawDesignVolFlowRate;
@@ -10299,7 +10582,7 @@ namespace WaterThermalTanks {
 
 			if ( SELECT_CASE_var == SizePeakDraw ) {
 				// get draw rate from maximum in schedule
-				rho = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, DummyWaterIndex, RoutineName );
+				rho = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, SizeStandAloneWaterHeaterDummyWaterIndex, RoutineName );
 				DrawDesignVolFlowRate = GetScheduleMaxValue( WaterThermalTank( WaterThermalTankNum ).FlowRateSchedule ) * WaterThermalTank( WaterThermalTankNum ).MassFlowRateMax / rho;
 
 				if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) {
@@ -10309,8 +10592,8 @@ namespace WaterThermalTanks {
 				}
 				if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) {
 					if ( WaterThermalTank( WaterThermalTankNum ).Sizing.RecoveryTime > 0.0 ) {
-						rho = GetDensityGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), DummyWaterIndex, RoutineName );
-						Cp = GetSpecificHeatGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), DummyWaterIndex, RoutineName );
+						rho = GetDensityGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), SizeStandAloneWaterHeaterDummyWaterIndex, RoutineName );
+						Cp = GetSpecificHeatGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), SizeStandAloneWaterHeaterDummyWaterIndex, RoutineName );
 
 						tmpMaxCapacity = ( WaterThermalTank( WaterThermalTankNum ).Volume * rho * Cp * ( Tfinish - Tstart ) ) / ( WaterThermalTank( WaterThermalTankNum ).Sizing.RecoveryTime * SecInHour ); // m3 | kg/m3 | J/Kg/K | K | seconds
 					} else {
@@ -10322,36 +10605,36 @@ namespace WaterThermalTanks {
 
 			} else if ( SELECT_CASE_var == SizeResidentialMin ) {
 				// assume can propagate rules for gas to other fuels.
-				FuelTypeIsLikeGas = false;
+				SizeStandAloneWaterHeaterFuelTypeIsLikeGas = false;
 				if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "Gas" ) ) {
-					FuelTypeIsLikeGas = true;
+					SizeStandAloneWaterHeaterFuelTypeIsLikeGas = true;
 				} else if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "Diesel" ) ) {
-					FuelTypeIsLikeGas = true;
+					SizeStandAloneWaterHeaterFuelTypeIsLikeGas = true;
 				} else if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "Gasoline" ) ) {
-					FuelTypeIsLikeGas = true;
+					SizeStandAloneWaterHeaterFuelTypeIsLikeGas = true;
 				} else if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "Coal" ) ) {
-					FuelTypeIsLikeGas = true;
+					SizeStandAloneWaterHeaterFuelTypeIsLikeGas = true;
 				} else if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "FuelOil#1" ) ) {
-					FuelTypeIsLikeGas = true;
+					SizeStandAloneWaterHeaterFuelTypeIsLikeGas = true;
 				} else if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "FuelOil#2" ) ) {
-					FuelTypeIsLikeGas = true;
+					SizeStandAloneWaterHeaterFuelTypeIsLikeGas = true;
 				} else if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "Propane" ) ) {
-					FuelTypeIsLikeGas = true;
+					SizeStandAloneWaterHeaterFuelTypeIsLikeGas = true;
 				} else if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "Steam" ) ) {
-					FuelTypeIsLikeGas = true;
+					SizeStandAloneWaterHeaterFuelTypeIsLikeGas = true;
 				} else if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "OtherFuel1" ) ) {
-					FuelTypeIsLikeGas = true;
+					SizeStandAloneWaterHeaterFuelTypeIsLikeGas = true;
 				} else if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "OtherFuel2" ) ) {
-					FuelTypeIsLikeGas = true;
+					SizeStandAloneWaterHeaterFuelTypeIsLikeGas = true;
 				} else if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "DistrictHeating" ) ) {
-					FuelTypeIsLikeGas = true;
+					SizeStandAloneWaterHeaterFuelTypeIsLikeGas = true;
 				}
 
 				if ( WaterThermalTank( WaterThermalTankNum ).Sizing.NumberOfBedrooms == 1 ) {
 					if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "Electric" ) ) {
 						if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 20.0 * GalTocubicMeters;
 						if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 2.5 * 1000.0; //2.5 kW
-					} else if ( FuelTypeIsLikeGas ) {
+					} else if ( SizeStandAloneWaterHeaterFuelTypeIsLikeGas ) {
 						if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 20.0 * GalTocubicMeters;
 						if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 27.0 * kBtuPerHrToWatts; //27kBtu/hr
 					}
@@ -10361,7 +10644,7 @@ namespace WaterThermalTanks {
 						if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "Electric" ) ) {
 							if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 30.0 * GalTocubicMeters;
 							if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 3.5 * 1000.0; //3.5 kW
-						} else if ( FuelTypeIsLikeGas ) {
+						} else if ( SizeStandAloneWaterHeaterFuelTypeIsLikeGas ) {
 							if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 30.0 * GalTocubicMeters;
 							if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 36.0 * kBtuPerHrToWatts; //36 kBtu/hr
 						}
@@ -10369,7 +10652,7 @@ namespace WaterThermalTanks {
 						if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "Electric" ) ) {
 							if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 40.0 * GalTocubicMeters;
 							if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 4.5 * 1000.0; //4.5 kW
-						} else if ( FuelTypeIsLikeGas ) {
+						} else if ( SizeStandAloneWaterHeaterFuelTypeIsLikeGas ) {
 							if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 30.0 * GalTocubicMeters;
 							if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 36.0 * kBtuPerHrToWatts; //36 kBtu/hr
 						}
@@ -10377,7 +10660,7 @@ namespace WaterThermalTanks {
 						if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "Electric" ) ) {
 							if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 50.0 * GalTocubicMeters;
 							if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 5.5 * 1000.0; //5.5 kW
-						} else if ( FuelTypeIsLikeGas ) {
+						} else if ( SizeStandAloneWaterHeaterFuelTypeIsLikeGas ) {
 							if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 40.0 * GalTocubicMeters;
 							if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 36.0 * kBtuPerHrToWatts; //36 kBtu/hr
 						}
@@ -10387,7 +10670,7 @@ namespace WaterThermalTanks {
 						if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "Electric" ) ) {
 							if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 40.0 * GalTocubicMeters;
 							if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 4.5 * 1000.0; //4.5 kW
-						} else if ( FuelTypeIsLikeGas ) {
+						} else if ( SizeStandAloneWaterHeaterFuelTypeIsLikeGas ) {
 							if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 30.0 * GalTocubicMeters;
 							if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 36.0 * kBtuPerHrToWatts; //36 kBtu/hr
 						}
@@ -10395,7 +10678,7 @@ namespace WaterThermalTanks {
 						if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "Electric" ) ) {
 							if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 50.0 * GalTocubicMeters;
 							if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 5.5 * 1000.0; //5.5 kW
-						} else if ( FuelTypeIsLikeGas ) {
+						} else if ( SizeStandAloneWaterHeaterFuelTypeIsLikeGas ) {
 							if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 40.0 * GalTocubicMeters;
 							if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 36.0 * kBtuPerHrToWatts; //36 kBtu/hr
 						}
@@ -10403,7 +10686,7 @@ namespace WaterThermalTanks {
 						if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "Electric" ) ) {
 							if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 50.0 * GalTocubicMeters;
 							if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 5.5 * 1000.0; //5.5 kW
-						} else if ( FuelTypeIsLikeGas ) {
+						} else if ( SizeStandAloneWaterHeaterFuelTypeIsLikeGas ) {
 							if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 40.0 * GalTocubicMeters;
 							if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 38.0 * kBtuPerHrToWatts; //38 kBtu/hr
 						}
@@ -10413,7 +10696,7 @@ namespace WaterThermalTanks {
 						if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "Electric" ) ) {
 							if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 50.0 * GalTocubicMeters;
 							if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 5.5 * 1000.0; //5.5 kW
-						} else if ( FuelTypeIsLikeGas ) {
+						} else if ( SizeStandAloneWaterHeaterFuelTypeIsLikeGas ) {
 							if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 40.0 * GalTocubicMeters;
 							if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 36.0 * kBtuPerHrToWatts; //36 kBtu/hr
 						}
@@ -10421,7 +10704,7 @@ namespace WaterThermalTanks {
 						if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "Electric" ) ) {
 							if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 50.0 * GalTocubicMeters;
 							if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 5.5 * 1000.0; //5.5 kW
-						} else if ( FuelTypeIsLikeGas ) {
+						} else if ( SizeStandAloneWaterHeaterFuelTypeIsLikeGas ) {
 							if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 40.0 * GalTocubicMeters;
 							if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 38.0 * kBtuPerHrToWatts; //38 kBtu/hr
 						}
@@ -10429,7 +10712,7 @@ namespace WaterThermalTanks {
 						if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "Electric" ) ) {
 							if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 66.0 * GalTocubicMeters;
 							if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 5.5 * 1000.0; //5.5 kW
-						} else if ( FuelTypeIsLikeGas ) {
+						} else if ( SizeStandAloneWaterHeaterFuelTypeIsLikeGas ) {
 							if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 50.0 * GalTocubicMeters;
 							if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 38.0 * kBtuPerHrToWatts; //38 kBtu/hr
 						}
@@ -10438,7 +10721,7 @@ namespace WaterThermalTanks {
 					if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "Electric" ) ) {
 						if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 66.0 * GalTocubicMeters;
 						if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 5.5 * 1000.0; //5.5 kW
-					} else if ( FuelTypeIsLikeGas ) {
+					} else if ( SizeStandAloneWaterHeaterFuelTypeIsLikeGas ) {
 						if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 50.0 * GalTocubicMeters;
 						if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 47.0 * kBtuPerHrToWatts; //47 kBtu/hr
 					}
@@ -10446,7 +10729,7 @@ namespace WaterThermalTanks {
 					if ( SameString( WaterThermalTank( WaterThermalTankNum ).FuelType, "Electric" ) ) {
 						if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 66.0 * GalTocubicMeters;
 						if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 5.5 * 1000.0; //5.5 kW
-					} else if ( FuelTypeIsLikeGas ) {
+					} else if ( SizeStandAloneWaterHeaterFuelTypeIsLikeGas ) {
 						if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = 50.0 * GalTocubicMeters;
 						if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) tmpMaxCapacity = 50.0 * kBtuPerHrToWatts; //50 kBtu/hr
 					}
@@ -10468,8 +10751,8 @@ namespace WaterThermalTanks {
 					tmpTankVolume = WaterThermalTank( WaterThermalTankNum ).Sizing.TankCapacityPerPerson * SumPeopleAllZones;
 				}
 				if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) {
-					rho = GetDensityGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), DummyWaterIndex, RoutineName );
-					Cp = GetSpecificHeatGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), DummyWaterIndex, RoutineName );
+					rho = GetDensityGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), SizeStandAloneWaterHeaterDummyWaterIndex, RoutineName );
+					Cp = GetSpecificHeatGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), SizeStandAloneWaterHeaterDummyWaterIndex, RoutineName );
 					tmpMaxCapacity = SumPeopleAllZones * WaterThermalTank( WaterThermalTankNum ).Sizing.RecoveryCapacityPerPerson * ( Tfinish - Tstart ) * ( 1.0 / SecInHour ) * rho * Cp; //m3/hr/person | delta T  in K | 1 hr/ 3600 s | kg/m3 | J/Kg/k
 				}
 
@@ -10490,8 +10773,8 @@ namespace WaterThermalTanks {
 				}
 
 				if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) {
-					rho = GetDensityGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), DummyWaterIndex, RoutineName );
-					Cp = GetSpecificHeatGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), DummyWaterIndex, RoutineName );
+					rho = GetDensityGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), SizeStandAloneWaterHeaterDummyWaterIndex, RoutineName );
+					Cp = GetSpecificHeatGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), SizeStandAloneWaterHeaterDummyWaterIndex, RoutineName );
 					tmpMaxCapacity = SumFloorAreaAllZones * WaterThermalTank( WaterThermalTankNum ).Sizing.RecoveryCapacityPerArea * ( Tfinish - Tstart ) * ( 1.0 / SecInHour ) * rho * Cp; // m2 | m3/hr/m2 | delta T  in K | 1 hr/ 3600 s | kg/m3 | J/Kg/k
 				}
 				if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) {
@@ -10507,8 +10790,8 @@ namespace WaterThermalTanks {
 				if ( WaterThermalTank( WaterThermalTankNum ).VolumeWasAutoSized ) tmpTankVolume = WaterThermalTank( WaterThermalTankNum ).Sizing.TankCapacityPerUnit * WaterThermalTank( WaterThermalTankNum ).Sizing.NumberOfUnits;
 
 				if ( WaterThermalTank( WaterThermalTankNum ).MaxCapacityWasAutoSized ) {
-					rho = GetDensityGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), DummyWaterIndex, RoutineName );
-					Cp = GetSpecificHeatGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), DummyWaterIndex, RoutineName );
+					rho = GetDensityGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), SizeStandAloneWaterHeaterDummyWaterIndex, RoutineName );
+					Cp = GetSpecificHeatGlycol( fluidNameWater, ( ( Tfinish + Tstart ) / 2.0 ), SizeStandAloneWaterHeaterDummyWaterIndex, RoutineName );
 					tmpMaxCapacity = WaterThermalTank( WaterThermalTankNum ).Sizing.NumberOfUnits * WaterThermalTank( WaterThermalTankNum ).Sizing.RecoveryCapacityPerUnit * ( Tfinish - Tstart ) * ( 1.0 / SecInHour ) * rho * Cp; //m3/hr/ea | delta T  in K | 1 hr/ 3600 s | kg/m3 | J/Kg/k
 				}
 
@@ -11051,8 +11334,6 @@ namespace WaterThermalTanks {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeSetupFlag( true ); // one time setup flag
-		static Array1D_bool AlreadyReported; // control so we don't repeat again
 
 		// Formats
 		static gio::Fmt Format_728( "('Chilled Water Tank Information',5(',',A))" );
@@ -11164,6 +11445,61 @@ namespace WaterThermalTanks {
 		WaterThermalTank.deallocate();
 		HPWaterHeater.deallocate();
 		WaterHeaterDesuperheater.deallocate();
+		MyOneTimeFlagWH.deallocate();
+		MyTwoTimeFlagWH.deallocate();
+		MyOneTimeFlagHP.deallocate();
+		MyTwoTimeFlagHP.deallocate();
+		ErrorsFound = false;
+		FanInletNode.clear();
+		GetWaterThermalTankInputDataFanOutletNode.clear();
+		CoilInletNode.clear();
+		CoilOutletNode.clear();
+		SupAirIn = 0;
+		ExhAirOut = 0;
+		FoundInletNode = false;
+		FoundOutletNode = false;
+		ZoneNum = 0;
+		ValidScheduleValue = false;
+		ZoneEquipConfigNum = 0;
+		ZoneEquipListNum = 0;
+		EquipmentTypeNum = 0;
+		FoundTankInList = false;
+		TankNotLowestPriority = false;
+		TankCoolingPriority = 0;
+		TankHeatingPriority = 0;
+		DXCoilErrFlag = false;
+		FanVolFlow = 0.0;
+		errFlag = false;
+		HEffFTemp = 0.0;
+		DummyWaterIndex = 1;
+		Tolerance = 1.0e-8;
+		FluidCond = 0.6;
+		SetupStratifiedNodesDummyWaterIndex = 1;
+		MyEnvrnFlag.deallocate();
+		MyWarmupFlag.deallocate();
+		SetLoopIndexFlag.deallocate();
+		InitWaterThermalTankDummyWaterIndex = 1;
+		TankChangeRateScale = 0.0;
+		MaxSideVolFlow = 0.0;
+		CalcWaterThermalTankMixedDummyWaterIndex = 1;
+		CalcWaterThermalTankStratifiedDummyWaterIndex = 1;
+		Lower.deallocate();
+		Diag.deallocate();
+		Upper.deallocate();
+		RHS.deallocate();
+		LayerTopNode.deallocate();
+		LayerMass.deallocate();
+		LayerTemp.deallocate();
+		MinTemp = 0.0;
+		SizeSupplySidePlantConnectionsDummyWaterIndex = 1;
+		SizeTankForDemandSideDummyWaterIndex = 1;
+		FuelTypeIsLikeGas = false;
+		SizeTankForSupplySideDummyWaterIndex = 1;
+		SizeDemandSidePlantConnectionsDummyWaterIndex = 1;
+		SizeStandAloneWaterHeaterFuelTypeIsLikeGas = false;
+		SizeStandAloneWaterHeaterDummyWaterIndex = 1;
+		MyOneTimeSetupFlag = true;
+		AlreadyReported.deallocate();
 	}
 
 
@@ -107,6 +107,9 @@ namespace WaterThermalTanks {
 	extern int const InletModeFixed; // water heater only, inlet water always enters at the user-specified height
 	extern int const InletModeSeeking; // water heater only, inlet water seeks out the node with the closest temperature
 
+	extern int const StratifiedSolverExplicit; // stratified tank nodes are integrated explicitly with one second sub time steps
+	extern int const StratifiedSolverImplicit; // stratified tank nodes are solved together implicitly between heater control events
+
 	// integer parameter for water heater
 	extern int const MixedWaterHeater; // WaterHeater:Mixed
 	extern int const StratifiedWaterHeater; // WaterHeater:Stratified
@@ -412,6 +415,7 @@ namespace WaterThermalTanks {
 		int SourceOutletStratNode; // Source-side outlet node number
 		int InletMode; // Inlet position mode:  1 = FIXED; 2 = SEEKING
 		Real64 InversionMixingRate;
+		int SolutionAlgorithm; // StratifiedSolverExplicit or StratifiedSolverImplicit
 		Array1D< Real64 > AdditionalLossCoeff; // Loss coefficient added to the skin loss coefficient (W/m2-K)
 		int Nodes; // Number of nodes
 		Array1D< StratifiedNodeData > Node; // Array of node data
@@ -592,6 +596,7 @@ namespace WaterThermalTanks {
 			SourceOutletStratNode( 0 ),
 			InletMode( 1 ),
 			InversionMixingRate( 0.0 ),
+			SolutionAlgorithm( 1 ),
 			Nodes( 0 ),
 			VolFlowRate( 0.0 ),
 			VolumeConsumed( 0.0 ),
@@ -1022,6 +1027,20 @@ namespace WaterThermalTanks {
 		int const WaterThermalTankNum // Water Heater being simulated
 	);
 
+	void
+	SolveStratifiedTankImplicit(
+		int const WaterThermalTankNum, // Water Heater being simulated
+		Real64 const dt, // Sub time step interval (s)
+		Real64 const Cp, // Specific heat of water (J/kg K)
+		Real64 const Qheater1, // Heating rate of heater 1 over the sub time step (W)
+		Real64 const Qheater2, // Heating rate of heater 2 over the sub time step (W)
+		Real64 const Qheatpump, // Heating rate from the heat pump (W)
+		int const HPWHCondenserConfig // Condenser configuration of HPWH
+	);
+
+	void
+	MixStratifiedTankInversions( int const WaterThermalTankNum ); // Water Heater being simulated
+
 	void
 	CalcNodeMassFlows(
 		int const WaterThermalTankNum, // Water Heater being simulated
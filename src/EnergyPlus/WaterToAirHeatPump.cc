@@ -161,8 +161,63 @@ namespace WaterToAirHeatPump {
 	// MODULE SUBROUTINES:
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int MaxNums( 0 ); // Maximum number of numeric input fields
+		int MaxAlphas( 0 ); // Maximum number of alpha input fields
+		bool GetWatertoAirHPInputErrorsFound( false ); // If errors detected in input
+		bool MyOneTimeFlag( true );
+		Array1D_bool MyPlantScanFlag;
+		Array1D_bool MyEnvrnFlag;
+		Real64 EffectiveSurfaceTemp; // Effective Surface Temperature [C]
+		Real64 EvapTemp; // Evaporating Temperature [C]
+		Real64 initialQSource; // Guess Source Side Heat Transfer Rate [W]
+		Real64 initialQLoadTotal; // Guess Load Side Heat Transfer rate [W]
+		Real64 CalcWatertoAirHPCoolingCompSuctionTemp; // Temperature of the Refrigerant Entering the Compressor [C]
+		bool firstTime( true );
+		Real64 LoadSideInletDBTemp_Init; // rated conditions
+		Real64 LoadSideInletHumRat_Init; // rated conditions
+		Real64 LoadSideAirInletEnth_Init; // rated conditions
+		Real64 CalcWatertoAirHPHeating_initialQSource; // Guess Source Side Heat Transfer Rate [W]
+		Real64 initialQLoad; // Guess Load Side Heat Transfer rate [W]
+	}
+
 	// Functions
 
+	// Clears the global data in WaterToAirHeatPump.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumWatertoAirHPs = 0;
+		CheckEquipName.deallocate();
+		RefrigIndex = 0;
+		WaterIndex = 0;
+		GetCoilsInputFlag = true;
+		WatertoAirHP.deallocate();
+		MaxNums = 0;
+		MaxAlphas = 0;
+		GetWatertoAirHPInputErrorsFound = false;
+		MyOneTimeFlag = true;
+		MyPlantScanFlag.deallocate();
+		MyEnvrnFlag.deallocate();
+		EffectiveSurfaceTemp = 0.0;
+		EvapTemp = 0.0;
+		initialQSource = 0.0;
+		initialQLoadTotal = 0.0;
+		CalcWatertoAirHPCoolingCompSuctionTemp = 0.0;
+		firstTime = true;
+		LoadSideInletDBTemp_Init = 0.0;
+		LoadSideInletHumRat_Init = 0.0;
+		LoadSideAirInletEnth_Init = 0.0;
+		CalcWatertoAirHPHeating_initialQSource = 0.0;
+		initialQLoad = 0.0;
+	}
+
 	void
 	SimWatertoAirHP(
 		std::string const & CompName, // component name
@@ -320,10 +375,7 @@ namespace WaterToAirHeatPump {
 		int NumAlphas;
 		int NumParams;
 		int NumNums;
-		static int MaxNums( 0 ); // Maximum number of numeric input fields
-		static int MaxAlphas( 0 ); // Maximum number of alpha input fields
 		int IOStat;
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool errFlag;
@@ -344,7 +396,7 @@ namespace WaterToAirHeatPump {
 
 		if ( NumWatertoAirHPs <= 0 ) {
 			ShowSevereError( "No Equipment found in SimWatertoAirHP" );
-			ErrorsFound = true;
+			GetWatertoAirHPInputErrorsFound = true;
 		}
 
 		// Allocate Arrays
@@ -380,12 +432,12 @@ namespace WaterToAirHeatPump {
 
 			VerifyName( AlphArray( 1 ), WatertoAirHP, HPNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetWatertoAirHPInputErrorsFound = true;
 				if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, AlphArray( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetWatertoAirHPInputErrorsFound = true;
 			}
 
 			WatertoAirHP( HPNum ).Name = AlphArray( 1 );
@@ -400,10 +452,10 @@ namespace WaterToAirHeatPump {
 			WatertoAirHP( HPNum ).HighPressCutoff = NumArray( 5 );
 			WatertoAirHP( HPNum ).LowPressCutoff = NumArray( 6 );
 
-			WatertoAirHP( HPNum ).WaterInletNodeNum = GetOnlySingleNode( AlphArray( 4 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
-			WatertoAirHP( HPNum ).WaterOutletNodeNum = GetOnlySingleNode( AlphArray( 5 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
-			WatertoAirHP( HPNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 6 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			WatertoAirHP( HPNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 7 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			WatertoAirHP( HPNum ).WaterInletNodeNum = GetOnlySingleNode( AlphArray( 4 ), GetWatertoAirHPInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+			WatertoAirHP( HPNum ).WaterOutletNodeNum = GetOnlySingleNode( AlphArray( 5 ), GetWatertoAirHPInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+			WatertoAirHP( HPNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 6 ), GetWatertoAirHPInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			WatertoAirHP( HPNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 7 ), GetWatertoAirHPInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			//2010-01-13 ESL: Jason Glazer noted that these were out of order previously, but they are good now
 			WatertoAirHP( HPNum ).LoadSideTotalUACoeff = NumArray( 7 );
@@ -414,7 +466,7 @@ namespace WaterToAirHeatPump {
 				ShowContinueError( " One or both load side UA values entered are below tolerance, likely zero or blank." );
 				ShowContinueError( " Verify inputs, as the parameter syntax for this object went through a change with" );
 				ShowContinueError( "  the release of EnergyPlus version 5." );
-				ErrorsFound = true;
+				GetWatertoAirHPInputErrorsFound = true;
 			}
 
 			WatertoAirHP( HPNum ).SuperheatTemp = NumArray( 9 );
@@ -442,7 +494,7 @@ namespace WaterToAirHeatPump {
 
 			} else {
 				ShowSevereError( RoutineName + "Invalid " + cAlphaFields( 2 ) + " (" + AlphArray( 2 ) + ") entered." + CurrentModuleObject + '=' + WatertoAirHP( HPNum ).Name );
-				ErrorsFound = true;
+				GetWatertoAirHPInputErrorsFound = true;
 
 			}}
 
@@ -487,12 +539,12 @@ namespace WaterToAirHeatPump {
 
 			VerifyName( AlphArray( 1 ), WatertoAirHP, HPNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetWatertoAirHPInputErrorsFound = true;
 				if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, AlphArray( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetWatertoAirHPInputErrorsFound = true;
 			}
 
 			WatertoAirHP( HPNum ).Name = AlphArray( 1 );
@@ -505,10 +557,10 @@ namespace WaterToAirHeatPump {
 			WatertoAirHP( HPNum ).HighPressCutoff = NumArray( 3 );
 			WatertoAirHP( HPNum ).LowPressCutoff = NumArray( 4 );
 
-			WatertoAirHP( HPNum ).WaterInletNodeNum = GetOnlySingleNode( AlphArray( 4 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
-			WatertoAirHP( HPNum ).WaterOutletNodeNum = GetOnlySingleNode( AlphArray( 5 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
-			WatertoAirHP( HPNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 6 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			WatertoAirHP( HPNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 7 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			WatertoAirHP( HPNum ).WaterInletNodeNum = GetOnlySingleNode( AlphArray( 4 ), GetWatertoAirHPInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+			WatertoAirHP( HPNum ).WaterOutletNodeNum = GetOnlySingleNode( AlphArray( 5 ), GetWatertoAirHPInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+			WatertoAirHP( HPNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 6 ), GetWatertoAirHPInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			WatertoAirHP( HPNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 7 ), GetWatertoAirHPInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			WatertoAirHP( HPNum ).LoadSideTotalUACoeff = NumArray( 5 );
 			if ( WatertoAirHP( HPNum ).LoadSideTotalUACoeff < rTinyValue ) {
@@ -516,7 +568,7 @@ namespace WaterToAirHeatPump {
 				ShowContinueError( " Load side UA value is less than tolerance, likely zero or blank." );
 				ShowContinueError( " Verify inputs, as the parameter syntax for this object went through a change with" );
 				ShowContinueError( "  the release of EnergyPlus version 5." );
-				ErrorsFound = true;
+				GetWatertoAirHPInputErrorsFound = true;
 			}
 
 			WatertoAirHP( HPNum ).SuperheatTemp = NumArray( 6 );
@@ -544,7 +596,7 @@ namespace WaterToAirHeatPump {
 
 			} else {
 				ShowSevereError( RoutineName + "Invalid " + cAlphaFields( 2 ) + " (" + AlphArray( 2 ) + ") entered." + CurrentModuleObject + '=' + WatertoAirHP( HPNum ).Name );
-				ErrorsFound = true;
+				GetWatertoAirHPInputErrorsFound = true;
 
 			}}
 
@@ -577,7 +629,7 @@ namespace WaterToAirHeatPump {
 		lNumericBlanks.deallocate();
 		NumArray.deallocate();
 
-		if ( ErrorsFound ) {
+		if ( GetWatertoAirHPInputErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found getting input. Program terminates." );
 		}
 
@@ -700,9 +752,6 @@ namespace WaterToAirHeatPump {
 		int AirInletNode; // air inlet node number
 		int WaterInletNode; // water inlet node number
 		int PlantOutletNode;
-		static bool MyOneTimeFlag( true );
-		static Array1D_bool MyPlantScanFlag;
-		static Array1D_bool MyEnvrnFlag;
 		Real64 rho; // local fluid density
 		Real64 Cp; // local fluid specific heat
 		bool errFlag;
@@ -1006,7 +1055,6 @@ namespace WaterToAirHeatPump {
 		Real64 LoadSideAirOutletEnth; // Load Side Outlet Enthalpy [J/kg]
 		//      REAL(r64)        :: EffectiveSurfaceTemp1    ! Effective Surface Temperature Guess #1 [C]
 		//      REAL(r64)        :: EffectiveSurfaceTemp2    ! Effective Surface Temperature Guess #2 [C]
-		static Real64 EffectiveSurfaceTemp; // Effective Surface Temperature [C]
 		Real64 EffectiveSatEnth; // Saturated Enthalpy of Air Corresponding to the Effective Surface
 		// Temperature [J/kg]
 		//      REAL(r64)        :: EffectiveSatEnth1        ! Guess of the Saturated Enthalpy of Air Corresponding to the
@@ -1017,7 +1065,6 @@ namespace WaterToAirHeatPump {
 		Real64 Power; // Power Consumption [W]
 		//      REAL(r64)        :: EvapTemp1                ! Evaporating Temperature Guess #1 [C]
 		//      REAL(r64)        :: EvapTemp2                ! Evaporating Temperature Guess #2 [C]
-		static Real64 EvapTemp; // Evaporating Temperature [C]
 		Real64 ANTUWET; // Number of Transfer Unit for Wet Condition
 		Real64 EffectWET; // Load Side Heat Exchanger Effectiveness
 		Real64 EvapSatEnth; // Saturated Enthalpy of Air Corresponding to the Evaporating
@@ -1036,14 +1083,11 @@ namespace WaterToAirHeatPump {
 		Real64 SourceSideOutletEnth; // Enthalpy of Refrigerant leaving the Source Side Heat Exchanger [J/kg]
 		Real64 LoadSideOutletEnth; // Enthalpy of Refrigerant leaving the Load Side Heat Exchanger [J/kg]
 		Real64 CpAir; // Specific Heat of Air [J/kg_C]
-		static Real64 initialQSource; // Guess Source Side Heat Transfer Rate [W]
-		static Real64 initialQLoadTotal; // Guess Load Side Heat Transfer rate [W]
 		Real64 SuperHeatEnth; // Enthalpy of the Superheated Refrigerant [J/kg]
 		Real64 CompSuctionTemp1; // Guess of the Temperature of the Refrigerant Entering the
 		// Compressor #1 [C]
 		Real64 CompSuctionTemp2; // Guess of the Temperature of the Refrigerant Entering the
 		// Compressor #2 [C]
-		static Real64 CompSuctionTemp; // Temperature of the Refrigerant Entering the Compressor [C]
 		Real64 CompSuctionEnth; // Enthalpy of the Refrigerant Entering the Compressor [J/kg]
 		Real64 CompSuctionDensity; // Density of the Refrigerant Entering the Compressorkg/m3
 		Real64 CompSuctionSatTemp; // Temperature of Saturated Refrigerant at Compressor Suction Pressure [C]
@@ -1059,10 +1103,6 @@ namespace WaterToAirHeatPump {
 		Real64 SHReff; // Effective sensible heat ratio at part-load condition
 		Array1D< Real64 > Par( 4 ); // Parameter array passed to RegulaFalsi function
 		int SolFlag; // Solution flag returned from RegulaFalsi function
-		static bool firstTime( true );
-		static Real64 LoadSideInletDBTemp_Init; // rated conditions
-		static Real64 LoadSideInletHumRat_Init; // rated conditions
-		static Real64 LoadSideAirInletEnth_Init; // rated conditions
 		Real64 LoadSideInletDBTemp_Unit; // calc conditions for unit
 		Real64 LoadSideInletHumRat_Unit; // calc conditions for unit
 		Real64 LoadSideAirInletEnth_Unit; // calc conditions for unit
@@ -1365,13 +1405,13 @@ namespace WaterToAirHeatPump {
 					Par( 2 ) = double( RefrigIndex );
 					Par( 3 ) = SuperHeatEnth;
 
-					SolveRegulaFalsi( ERR, STOP1, SolFlag, CompSuctionTemp, CalcCompSuctionTempResidual, CompSuctionTemp1, CompSuctionTemp2, Par );
+					SolveRegulaFalsi( ERR, STOP1, SolFlag, CalcWatertoAirHPCoolingCompSuctionTemp, CalcCompSuctionTempResidual, CompSuctionTemp1, CompSuctionTemp2, Par, "CalcWatertoAirHPCooling" );
 					if ( SolFlag == -1 ) {
 						WatertoAirHP( HPNum ).SimFlag = false;
 						return;
 					}
-					CompSuctionEnth = GetSupHeatEnthalpyRefrig( Refrigerant, CompSuctionTemp, SuctionPr, RefrigIndex, RoutineNameCompSuctionTemp );
-					CompSuctionDensity = GetSupHeatDensityRefrig( Refrigerant, CompSuctionTemp, SuctionPr, RefrigIndex, RoutineNameCompSuctionTemp );
+					CompSuctionEnth = GetSupHeatEnthalpyRefrig( Refrigerant, CalcWatertoAirHPCoolingCompSuctionTemp, SuctionPr, RefrigIndex, RoutineNameCompSuctionTemp );
+					CompSuctionDensity = GetSupHeatDensityRefrig( Refrigerant, CalcWatertoAirHPCoolingCompSuctionTemp, SuctionPr, RefrigIndex, RoutineNameCompSuctionTemp );
 
 					// Find Refrigerant Flow Rate
 					{ auto const SELECT_CASE_var( CompressorType );
@@ -1674,8 +1714,6 @@ namespace WaterToAirHeatPump {
 		Real64 MassRef; // Mass Flow Rate of Refrigerant [kg/s]
 		Real64 SourceSideOutletEnth; // Enthalpy of Refrigerant leaving the Source Side Heat Exchanger [J/kg]
 		Real64 LoadSideOutletEnth; // Enthalpy of Refrigerant leaving the Load Side Heat Exchanger [J/kg]
-		static Real64 initialQSource; // Guess Source Side Heat Transfer Rate [W]
-		static Real64 initialQLoad; // Guess Load Side Heat Transfer rate [W]
 		Real64 SuperHeatEnth; // Enthalpy of the Superheated Refrigerant [J/kg]
 		Real64 CompSuctionTemp1; // Guess of the Temperature of the Refrigerant Entering the
 		// Compressor #1 [C]
@@ -1744,11 +1782,11 @@ namespace WaterToAirHeatPump {
 
 		if ( FirstHVACIteration ) {
 			initialQLoad = NominalHeatingCapacity;
-			initialQSource = NominalHeatingCapacity;
+			CalcWatertoAirHPHeating_initialQSource = NominalHeatingCapacity;
 		}
 
 		if ( initialQLoad == 0.0 ) initialQLoad = NominalHeatingCapacity;
-		if ( initialQSource == 0.0 ) initialQSource = NominalHeatingCapacity;
+		if ( CalcWatertoAirHPHeating_initialQSource == 0.0 ) CalcWatertoAirHPHeating_initialQSource = NominalHeatingCapacity;
 
 		//Tuned Hoisted quantities out of nested loop that don't change
 		Real64 const LoadSideMassFlowRate_CpAir_inv( 1.0 / ( LoadSideMassFlowRate * CpAir ) );
@@ -1795,7 +1833,7 @@ namespace WaterToAirHeatPump {
 				}
 
 				// Determine Source Side Tempertaure (Evap. Temp for this mode)
-				SourceSideTemp = SourceSideInletTemp - initialQSource / ( SourceSideEffect * CpFluid * SourceSideMassFlowRate );
+				SourceSideTemp = SourceSideInletTemp - CalcWatertoAirHPHeating_initialQSource / ( SourceSideEffect * CpFluid * SourceSideMassFlowRate );
 
 				// Determine Load Side Tempertaure (Condensing Temp for this mode)
 				LoadSideTemp = LoadSideInletDBTemp + initialQLoad * LoadSideEffect_CpAir_MassFlowRate_inv;
@@ -1892,7 +1930,7 @@ namespace WaterToAirHeatPump {
 				Par( 2 ) = double( RefrigIndex );
 				Par( 3 ) = SuperHeatEnth;
 
-				SolveRegulaFalsi( ERR, STOP1, SolFlag, CompSuctionTemp, CalcCompSuctionTempResidual, CompSuctionTemp1, CompSuctionTemp2, Par );
+				SolveRegulaFalsi( ERR, STOP1, SolFlag, CompSuctionTemp, CalcCompSuctionTempResidual, CompSuctionTemp1, CompSuctionTemp2, Par, "CalcWatertoAirHPHeating" );
 				if ( SolFlag == -1 ) {
 					WatertoAirHP( HPNum ).SimFlag = false;
 					return;
@@ -1913,8 +1951,8 @@ namespace WaterToAirHeatPump {
 
 				// Find the Source Side Heat Transfer
 				QSource = MassRef * ( SourceSideOutletEnth - LoadSideOutletEnth );
-				SourceResidual = std::abs( QSource - initialQSource ) / initialQSource;
-				initialQSource += RelaxParam * ( QSource - initialQSource );
+				SourceResidual = std::abs( QSource - CalcWatertoAirHPHeating_initialQSource ) / CalcWatertoAirHPHeating_initialQSource;
+				CalcWatertoAirHPHeating_initialQSource += RelaxParam * ( QSource - CalcWatertoAirHPHeating_initialQSource );
 				if ( NumIteration2 > 8 ) RelaxParam = 0.3;
 
 			}
@@ -257,6 +257,11 @@ namespace WaterToAirHeatPump {
 
 	// Functions
 
+	// Clears the global data in WaterToAirHeatPump.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimWatertoAirHP(
 		std::string const & CompName, // component name
@@ -192,10 +192,44 @@ namespace WaterToAirHeatPumpSimple {
 	// MODULE SUBROUTINES:
 	//*************************************************************************
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int MaxNums( 0 ); // Maximum number of numeric input fields
+		int MaxAlphas( 0 ); // Maximum number of alpha input fields
+		bool GetSimpleWatertoAirHPInputErrorsFound( false ); // If errors detected in input
+		Array1D_bool InitSimpleWatertoAirHPMySizeFlag; // used for sizing PTHP inputs one time
+		Array1D_bool MyEnvrnFlag; // used for initializations each begin environment flag
+		Array1D_bool MyPlantScanFlag;
+		int Count( 0 ); // No idea what this is for.
+		bool firstTime( true );
+		Real64 LoadSideInletDBTemp_Init; // rated conditions
+		Real64 LoadSideInletWBTemp_Init; // rated conditions
+		Real64 LoadSideInletHumRat_Init; // rated conditions
+		Real64 LoadSideInletEnth_Init; // rated conditions
+		Real64 CpAir_Init; // rated conditions
+	}
+
 	// Functions
 	void
 	clear_state() {
 		MyOneTimeFlag = true;
+		MaxNums = 0;
+		MaxAlphas = 0;
+		GetSimpleWatertoAirHPInputErrorsFound = false;
+		InitSimpleWatertoAirHPMySizeFlag.deallocate();
+		MyEnvrnFlag.deallocate();
+		MyPlantScanFlag.deallocate();
+		Count = 0;
+		firstTime = true;
+		LoadSideInletDBTemp_Init = 0.0;
+		LoadSideInletWBTemp_Init = 0.0;
+		LoadSideInletHumRat_Init = 0.0;
+		LoadSideInletEnth_Init = 0.0;
+		CpAir_Init = 0.0;
 	}
 
 	void
@@ -364,10 +398,7 @@ namespace WaterToAirHeatPumpSimple {
 		int NumAlphas; // Number of variables in String format
 		int NumNums; // Number of variables in Numeric format
 		int NumParams; // Total number of input fields
-		static int MaxNums( 0 ); // Maximum number of numeric input fields
-		static int MaxAlphas( 0 ); // Maximum number of alpha input fields
 		int IOStat;
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool errFlag;
@@ -386,7 +417,7 @@ namespace WaterToAirHeatPumpSimple {
 
 		if ( NumWatertoAirHPs <= 0 ) {
 			ShowSevereError( "No Equipment found in SimWatertoAirHPSimple" );
-			ErrorsFound = true;
+			GetSimpleWatertoAirHPInputErrorsFound = true;
 		}
 
 		// Allocate Arrays
@@ -422,12 +453,12 @@ namespace WaterToAirHeatPumpSimple {
 
 			VerifyName( AlphArray( 1 ), SimpleWatertoAirHP, HPNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetSimpleWatertoAirHPInputErrorsFound = true;
 				if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, AlphArray( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetSimpleWatertoAirHPInputErrorsFound = true;
 			}
 
 			SimpleWatertoAirHP( HPNum ).Name = AlphArray( 1 );
@@ -457,10 +488,10 @@ namespace WaterToAirHeatPumpSimple {
 			SimpleWatertoAirHP( HPNum ).Twet_Rated = NumArray( 22 );
 			SimpleWatertoAirHP( HPNum ).Gamma_Rated = NumArray( 23 );
 
-			SimpleWatertoAirHP( HPNum ).WaterInletNodeNum = GetOnlySingleNode( AlphArray( 2 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
-			SimpleWatertoAirHP( HPNum ).WaterOutletNodeNum = GetOnlySingleNode( AlphArray( 3 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
-			SimpleWatertoAirHP( HPNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 4 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			SimpleWatertoAirHP( HPNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 5 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			SimpleWatertoAirHP( HPNum ).WaterInletNodeNum = GetOnlySingleNode( AlphArray( 2 ), GetSimpleWatertoAirHPInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+			SimpleWatertoAirHP( HPNum ).WaterOutletNodeNum = GetOnlySingleNode( AlphArray( 3 ), GetSimpleWatertoAirHPInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+			SimpleWatertoAirHP( HPNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 4 ), GetSimpleWatertoAirHPInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			SimpleWatertoAirHP( HPNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 5 ), GetSimpleWatertoAirHPInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			TestCompSet( CurrentModuleObject, AlphArray( 1 ), AlphArray( 2 ), AlphArray( 3 ), "Water Nodes" );
 			TestCompSet( CurrentModuleObject, AlphArray( 1 ), AlphArray( 4 ), AlphArray( 5 ), "Air Nodes" );
@@ -497,12 +528,12 @@ namespace WaterToAirHeatPumpSimple {
 
 			VerifyName( AlphArray( 1 ), SimpleWatertoAirHP, HPNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetSimpleWatertoAirHPInputErrorsFound = true;
 				if ( IsBlank ) AlphArray( 1 ) = "xxxxx";
 			}
 			VerifyUniqueCoilName( CurrentModuleObject, AlphArray( 1 ), errFlag, CurrentModuleObject + " Name" );
 			if ( errFlag ) {
-				ErrorsFound = true;
+				GetSimpleWatertoAirHPInputErrorsFound = true;
 			}
 
 			SimpleWatertoAirHP( HPNum ).Name = AlphArray( 1 );
@@ -523,10 +554,10 @@ namespace WaterToAirHeatPumpSimple {
 			SimpleWatertoAirHP( HPNum ).HeatPower4 = NumArray( 13 );
 			SimpleWatertoAirHP( HPNum ).HeatPower5 = NumArray( 14 );
 
-			SimpleWatertoAirHP( HPNum ).WaterInletNodeNum = GetOnlySingleNode( AlphArray( 2 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
-			SimpleWatertoAirHP( HPNum ).WaterOutletNodeNum = GetOnlySingleNode( AlphArray( 3 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
-			SimpleWatertoAirHP( HPNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 4 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
-			SimpleWatertoAirHP( HPNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 5 ), ErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
+			SimpleWatertoAirHP( HPNum ).WaterInletNodeNum = GetOnlySingleNode( AlphArray( 2 ), GetSimpleWatertoAirHPInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Inlet, 2, ObjectIsNotParent );
+			SimpleWatertoAirHP( HPNum ).WaterOutletNodeNum = GetOnlySingleNode( AlphArray( 3 ), GetSimpleWatertoAirHPInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Water, NodeConnectionType_Outlet, 2, ObjectIsNotParent );
+			SimpleWatertoAirHP( HPNum ).AirInletNodeNum = GetOnlySingleNode( AlphArray( 4 ), GetSimpleWatertoAirHPInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Inlet, 1, ObjectIsNotParent );
+			SimpleWatertoAirHP( HPNum ).AirOutletNodeNum = GetOnlySingleNode( AlphArray( 5 ), GetSimpleWatertoAirHPInputErrorsFound, CurrentModuleObject, AlphArray( 1 ), NodeType_Air, NodeConnectionType_Outlet, 1, ObjectIsNotParent );
 
 			TestCompSet( CurrentModuleObject, AlphArray( 1 ), AlphArray( 2 ), AlphArray( 3 ), "Water Nodes" );
 			TestCompSet( CurrentModuleObject, AlphArray( 1 ), AlphArray( 4 ), AlphArray( 5 ), "Air Nodes" );
@@ -550,7 +581,7 @@ namespace WaterToAirHeatPumpSimple {
 		lNumericBlanks.deallocate();
 		NumArray.deallocate();
 
-		if ( ErrorsFound ) {
+		if ( GetSimpleWatertoAirHPInputErrorsFound ) {
 			ShowFatalError( RoutineName + "Errors found getting input. Program terminates." );
 		}
 
@@ -642,7 +673,6 @@ namespace WaterToAirHeatPumpSimple {
 		using PlantUtilities::SetComponentFlowRate;
 
 		// Locals
-		static Array1D_bool MySizeFlag; // used for sizing PTHP inputs one time
 
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
@@ -660,18 +690,16 @@ namespace WaterToAirHeatPumpSimple {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int AirInletNode; // Node Number of the air inlet
 		int WaterInletNode; // Node Number of the Water inlet
-		static Array1D_bool MyEnvrnFlag; // used for initializations each begin environment flag
-		static Array1D_bool MyPlantScanFlag;
 		Real64 rho; // local fluid density
 		Real64 Cp; // local fluid specific heat
 		bool errFlag;
 
 		if ( MyOneTimeFlag ) {
 			// initialize the environment and sizing flags
-			MySizeFlag.allocate( NumWatertoAirHPs );
+			InitSimpleWatertoAirHPMySizeFlag.allocate( NumWatertoAirHPs );
 			MyEnvrnFlag.allocate( NumWatertoAirHPs );
 			MyPlantScanFlag.allocate( NumWatertoAirHPs );
-			MySizeFlag = true;
+			InitSimpleWatertoAirHPMySizeFlag = true;
 			MyEnvrnFlag = true;
 			MyPlantScanFlag = true;
 			MyOneTimeFlag = false;
@@ -687,11 +715,11 @@ namespace WaterToAirHeatPumpSimple {
 			MyPlantScanFlag( HPNum ) = false;
 		}
 
-		if ( ! SysSizingCalc && MySizeFlag( HPNum ) && ! MyPlantScanFlag( HPNum ) ) {
+		if ( ! SysSizingCalc && InitSimpleWatertoAirHPMySizeFlag( HPNum ) && ! MyPlantScanFlag( HPNum ) ) {
 			// for each furnace, do the sizing once.
 			SizeHVACWaterToAir( HPNum );
 
-			MySizeFlag( HPNum ) = false;
+			InitSimpleWatertoAirHPMySizeFlag( HPNum ) = false;
 
 		}
 
@@ -1729,13 +1757,6 @@ namespace WaterToAirHeatPumpSimple {
 
 		bool LatDegradModelSimFlag; // Latent degradation model simulation flag
 		int NumIteration; // Iteration Counter
-		static int Count( 0 ); // No idea what this is for.
-		static bool firstTime( true );
-		static Real64 LoadSideInletDBTemp_Init; // rated conditions
-		static Real64 LoadSideInletWBTemp_Init; // rated conditions
-		static Real64 LoadSideInletHumRat_Init; // rated conditions
-		static Real64 LoadSideInletEnth_Init; // rated conditions
-		static Real64 CpAir_Init; // rated conditions
 		Real64 LoadSideInletDBTemp_Unit; // calc conditions for unit
 		Real64 LoadSideInletWBTemp_Unit; // calc conditions for unit
 		Real64 LoadSideInletHumRat_Unit; // calc conditions for unit
@@ -125,6 +125,22 @@ namespace WaterUse {
 	Array1D< WaterEquipmentType > WaterEquipment;
 	Array1D< WaterConnectionsType > WaterConnections;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int MaxIterationsErrorCount;
+		bool MyEnvrnFlag( true );
+		int SimulateWaterUseConnectionMaxIterationsErrorCount;
+		bool SimulateWaterUseConnectionMyEnvrnFlag( true );
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool MyOneTimeFlag( true ); // one time flag                    !DSU
+		Array1D_bool SetLoopIndexFlag; // get loop number flag             !DSU
+		bool CalcWaterUseZoneGainsMyEnvrnFlag( true );
+	}
+
 	void
 	clear_state()
 	{
@@ -135,6 +151,14 @@ namespace WaterUse {
 		CheckPlantLoop.deallocate();
 		WaterEquipment.deallocate();
 		WaterConnections.deallocate();
+		MaxIterationsErrorCount = 0;
+		MyEnvrnFlag = true;
+		SimulateWaterUseConnectionMaxIterationsErrorCount = 0;
+		SimulateWaterUseConnectionMyEnvrnFlag = true;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		SetLoopIndexFlag.deallocate();
+		CalcWaterUseZoneGainsMyEnvrnFlag = true;
 	}
 
 	void
@@ -167,8 +191,6 @@ namespace WaterUse {
 		int WaterEquipNum;
 		int WaterConnNum;
 		int NumIteration;
-		static int MaxIterationsErrorCount;
-		static bool MyEnvrnFlag( true );
 
 		// FLOW:
 		if ( GetWaterUseInputFlag ) {
@@ -286,8 +308,6 @@ namespace WaterUse {
 		//  INTEGER :: WaterEquipNum
 		int WaterConnNum;
 		int NumIteration;
-		static int MaxIterationsErrorCount;
-		static bool MyEnvrnFlag( true );
 
 		// FLOW:
 		if ( GetWaterUseInputFlag ) {
@@ -318,8 +338,8 @@ namespace WaterUse {
 			return;
 		}
 
-		if ( BeginEnvrnFlag && MyEnvrnFlag ) {
-			MaxIterationsErrorCount = 0;
+		if ( BeginEnvrnFlag && SimulateWaterUseConnectionMyEnvrnFlag ) {
+			SimulateWaterUseConnectionMaxIterationsErrorCount = 0;
 			if ( NumWaterEquipment > 0 ) {
 				for ( int i = WaterEquipment.l(), e = WaterEquipment.u(); i <= e; ++i ) {
 					WaterEquipment( i ).reset();
@@ -330,10 +350,10 @@ namespace WaterUse {
 				for ( auto & e : WaterConnections ) e.TotalMassFlowRate = 0.0;
 			}
 
-			MyEnvrnFlag = false;
+			SimulateWaterUseConnectionMyEnvrnFlag = false;
 		}
 
-		if ( ! BeginEnvrnFlag ) MyEnvrnFlag = true;
+		if ( ! BeginEnvrnFlag ) SimulateWaterUseConnectionMyEnvrnFlag = true;
 
 		InitConnections( WaterConnNum );
 
@@ -404,7 +424,6 @@ namespace WaterUse {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		int IOStatus; // Used in GetObjectItem
 		bool IsBlank; // TRUE if the name is blank
 		bool IsNotOK; // TRUE if there was a problem with a list name
@@ -1018,8 +1037,6 @@ namespace WaterUse {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int InletNode;
 		int OutletNode;
-		static bool MyOneTimeFlag( true ); // one time flag                    !DSU
-		static Array1D_bool SetLoopIndexFlag; // get loop number flag             !DSU
 		bool errFlag;
 
 		if ( MyOneTimeFlag ) { //DSU
@@ -1546,12 +1563,11 @@ namespace WaterUse {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int WaterEquipNum;
 		int ZoneNum;
-		static bool MyEnvrnFlag( true );
 
 		// FLOW:
 		if ( NumWaterEquipment == 0 ) return;
 
-		if ( BeginEnvrnFlag && MyEnvrnFlag ) {
+		if ( BeginEnvrnFlag && CalcWaterUseZoneGainsMyEnvrnFlag ) {
 			for ( auto & e : WaterEquipment ) {
 				e.SensibleRate = 0.0;
 				e.SensibleEnergy = 0.0;
@@ -1568,10 +1584,10 @@ namespace WaterUse {
 				e.ColdMassFlowRate = 0.0;
 				e.HotMassFlowRate = 0.0;
 			}
-			MyEnvrnFlag = false;
+			CalcWaterUseZoneGainsMyEnvrnFlag = false;
 		}
 
-		if ( ! BeginEnvrnFlag ) MyEnvrnFlag = true;
+		if ( ! BeginEnvrnFlag ) CalcWaterUseZoneGainsMyEnvrnFlag = true;
 
 		for ( WaterEquipNum = 1; WaterEquipNum <= NumWaterEquipment; ++WaterEquipNum ) {
 			if ( WaterEquipment( WaterEquipNum ).Zone == 0 ) continue;
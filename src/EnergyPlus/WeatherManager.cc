@@ -209,6 +209,34 @@ namespace WeatherManager {
 		bool GetBranchInputOneTimeFlag( true );
 		bool GetEnvironmentFirstCall( true );
 		bool PrntEnvHeaders( true );
+		bool ManageWeatherPrintEnvrnStamp( false ); // Set to true when the environment header should be printed
+		bool FirstCall( true ); // Some things should only be done once
+		int NextHour;
+		int ReadEPlusWeatherForDayCurDayOfWeek;
+		bool ReadEPlusWeatherForDayUseDayOfWeek;
+		Real64 CurTime;
+		bool LastHourSet; // for Interpolation
+		Real64 LastHrOutDryBulbTemp;
+		Real64 LastHrOutDewPointTemp;
+		Real64 LastHrOutBaroPress;
+		Real64 LastHrOutRelHum;
+		Real64 LastHrWindSpeed;
+		Real64 LastHrWindDir;
+		Real64 LastHrSkyTemp;
+		Real64 LastHrHorizIRSky;
+		Real64 LastHrBeamSolarRad;
+		Real64 LastHrDifSolarRad;
+		Real64 LastHrAlbedo;
+		Real64 LastHrLiquidPrecip;
+		Real64 NextHrBeamSolarRad;
+		Real64 NextHrDifSolarRad;
+		Real64 NextHrLiquidPrecip;
+		int LCount( 0 );
+		bool PrintDDHeader;
+		bool ReadUserWeatherInputErrorsFound( false );
+		bool IsNotOK( false ); // Flag to verify name
+		bool IsBlank( false ); // Flag for blank name
+		std::string Title;
 	}
 	Real64 WeatherFileLatitude( 0.0 );
 	Real64 WeatherFileLongitude( 0.0 );
@@ -530,6 +558,34 @@ namespace WeatherManager {
 		SpecialDays.deallocate();
 		DataPeriods.deallocate();
 
+		ManageWeatherPrintEnvrnStamp = false;
+		FirstCall = true;
+		NextHour = 0;
+		ReadEPlusWeatherForDayCurDayOfWeek = 0;
+		ReadEPlusWeatherForDayUseDayOfWeek = false;
+		CurTime = 0.0;
+		LastHourSet = false;
+		LastHrOutDryBulbTemp = 0.0;
+		LastHrOutDewPointTemp = 0.0;
+		LastHrOutBaroPress = 0.0;
+		LastHrOutRelHum = 0.0;
+		LastHrWindSpeed = 0.0;
+		LastHrWindDir = 0.0;
+		LastHrSkyTemp = 0.0;
+		LastHrHorizIRSky = 0.0;
+		LastHrBeamSolarRad = 0.0;
+		LastHrDifSolarRad = 0.0;
+		LastHrAlbedo = 0.0;
+		LastHrLiquidPrecip = 0.0;
+		NextHrBeamSolarRad = 0.0;
+		NextHrDifSolarRad = 0.0;
+		NextHrLiquidPrecip = 0.0;
+		LCount = 0;
+		PrintDDHeader = false;
+		ReadUserWeatherInputErrorsFound = false;
+		IsNotOK = false;
+		IsBlank = false;
+		Title.clear();
 	} //clear_state, for unit tests
 
 	void
@@ -571,15 +627,14 @@ namespace WeatherManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static bool PrintEnvrnStamp( false ); // Set to true when the environment header should be printed
 
 		// FLOW:
 
-		InitializeWeather( PrintEnvrnStamp );
+		InitializeWeather( ManageWeatherPrintEnvrnStamp );
 
 		SetCurrentWeather();
 
-		ReportWeatherAndTimeInformation( PrintEnvrnStamp );
+		ReportWeatherAndTimeInformation( ManageWeatherPrintEnvrnStamp );
 
 	}
 
@@ -1878,7 +1933,6 @@ namespace WeatherManager {
 		int Loop;
 		int FirstSimDayofYear; // Variable which tells when to skip the day in a multi year simulation.
 
-		static bool FirstCall( true ); // Some things should only be done once
 		//  LOGICAL, SAVE :: SetYear=.TRUE.
 		int JDay5Start;
 		int JDay5End;
@@ -2261,7 +2315,6 @@ namespace WeatherManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int NextHour;
 		Real64 TempVal;
 		Real64 TempDPVal;
 
@@ -2564,43 +2617,24 @@ namespace WeatherManager {
 		Real64 C;
 		Real64 AVSC;
 		Real64 SkyTemp;
-		static int CurDayOfWeek;
-		static bool UseDayOfWeek;
 		bool SkipThisDay; // Used when LeapYear is/is not in effect
 		bool TryAgain;
 		int ReadStatus;
 		int NumRewinds;
 		std::string BadRecord;
 		bool ErrorsFound;
-		static Real64 CurTime;
 		Real64 HourRep;
 		int OSky;
 		Real64 TDewK;
 		Real64 ESky;
 		bool ErrorFound;
 		std::string ErrOut;
-		static bool LastHourSet; // for Interpolation
 		int NxtHour;
 		Real64 WtNow;
 		Real64 WtPrevHour;
 		Real64 WgtHourNow;
 		Real64 WgtPrevHour;
 		Real64 WgtNextHour;
-		static Real64 LastHrOutDryBulbTemp;
-		static Real64 LastHrOutDewPointTemp;
-		static Real64 LastHrOutBaroPress;
-		static Real64 LastHrOutRelHum;
-		static Real64 LastHrWindSpeed;
-		static Real64 LastHrWindDir;
-		static Real64 LastHrSkyTemp;
-		static Real64 LastHrHorizIRSky;
-		static Real64 LastHrBeamSolarRad;
-		static Real64 LastHrDifSolarRad;
-		static Real64 LastHrAlbedo;
-		static Real64 LastHrLiquidPrecip;
-		static Real64 NextHrBeamSolarRad;
-		static Real64 NextHrDifSolarRad;
-		static Real64 NextHrLiquidPrecip;
 		bool RecordDateMatch;
 
 		struct HourlyWeatherData
@@ -2655,7 +2689,7 @@ namespace WeatherManager {
 			//     File already position to first data record
 			//          Set Current Day of Week to "start of Data Period"
 			CurTime = 1.0 / double( NumIntervalsPerHour );
-			CurDayOfWeek = DataPeriods( 1 ).WeekDay - 1;
+			ReadEPlusWeatherForDayCurDayOfWeek = DataPeriods( 1 ).WeekDay - 1;
 			WYear = 0;
 			WMonth = 0;
 			WDay = 0;
@@ -2685,8 +2719,8 @@ namespace WeatherManager {
 					strip( ErrOut );
 					ShowFatalError( "Error occured on EPW while searching for first day, stopped at " + BadRecord + " IO Error=" + RoundSigDigits( ReadStatus ), OutputFileStandard );
 				}
-				if ( CurDayOfWeek <= 7 ) {
-					CurDayOfWeek = mod( CurDayOfWeek, 7 ) + 1;
+				if ( ReadEPlusWeatherForDayCurDayOfWeek <= 7 ) {
+					ReadEPlusWeatherForDayCurDayOfWeek = mod( ReadEPlusWeatherForDayCurDayOfWeek, 7 ) + 1;
 				}
 				if ( WMonth == Environment( Environ ).StartMonth && WDay == Environment( Environ ).StartDay && ! Environment( Environ ).MatchYear ) {
 					RecordDateMatch = true;
@@ -2698,8 +2732,8 @@ namespace WeatherManager {
 				if ( RecordDateMatch ) {
 					gio::backspace( WeatherFileUnitNumber );
 					Ready = true;
-					if ( CurDayOfWeek <= 7 ) {
-						--CurDayOfWeek;
+					if ( ReadEPlusWeatherForDayCurDayOfWeek <= 7 ) {
+						--ReadEPlusWeatherForDayCurDayOfWeek;
 					}
 					// Do the range checks on the first set of fields -- no others.
 					ErrorsFound = false;
@@ -2739,23 +2773,23 @@ namespace WeatherManager {
 			if ( ! KickOffSimulation && ! DoingSizing && Environment( Environ ).KindOfEnvrn == ksRunPeriodWeather ) {
 				++Environment( Environ ).CurrentCycle;
 				if ( ! Environment( Environ ).RollDayTypeOnRepeat ) {
-					SetDayOfWeekInitialValues( Environment( Environ ).DayOfWeek, CurDayOfWeek, UseDayOfWeek );
+					SetDayOfWeekInitialValues( Environment( Environ ).DayOfWeek, ReadEPlusWeatherForDayCurDayOfWeek, ReadEPlusWeatherForDayUseDayOfWeek );
 					if ( DaylightSavingIsActive ) {
 						SetDSTDateRanges( Environment( Envrn ).MonWeekDay, DSTIndex );
 					}
 					SetSpecialDayDates( Environment( Envrn ).MonWeekDay );
 				} else if ( Environment( Environ ).CurrentCycle == 1 ) {
-					SetDayOfWeekInitialValues( Environment( Environ ).DayOfWeek, CurDayOfWeek, UseDayOfWeek );
+					SetDayOfWeekInitialValues( Environment( Environ ).DayOfWeek, ReadEPlusWeatherForDayCurDayOfWeek, ReadEPlusWeatherForDayUseDayOfWeek );
 					Environment( Environ ).SetWeekDays = true;
 					if ( DaylightSavingIsActive ) {
 						SetDSTDateRanges( Environment( Envrn ).MonWeekDay, DSTIndex );
 					}
 					SetSpecialDayDates( Environment( Envrn ).MonWeekDay );
 				} else {
-					CurDayOfWeek = DayOfWeekTomorrow;
+					ReadEPlusWeatherForDayCurDayOfWeek = DayOfWeekTomorrow;
 				}
 			} else {
-				SetDayOfWeekInitialValues( Environment( Environ ).DayOfWeek, CurDayOfWeek, UseDayOfWeek );
+				SetDayOfWeekInitialValues( Environment( Environ ).DayOfWeek, ReadEPlusWeatherForDayCurDayOfWeek, ReadEPlusWeatherForDayUseDayOfWeek );
 			}
 		}
 
@@ -2883,10 +2917,10 @@ namespace WeatherManager {
 						TomorrowVariables.DayOfYear = JulianDay( WMonth, WDay, LeapYearAdd );
 						TomorrowVariables.DayOfYear_Schedule = JulianDay(WMonth, WDay, 1);
 						CalculateDailySolarCoeffs( TomorrowVariables.DayOfYear, A, B, C, AVSC, TomorrowVariables.EquationOfTime, TomorrowVariables.SinSolarDeclinAngle, TomorrowVariables.CosSolarDeclinAngle );
-						if ( CurDayOfWeek <= 7 ) {
-							CurDayOfWeek = mod( CurDayOfWeek, 7 ) + 1;
+						if ( ReadEPlusWeatherForDayCurDayOfWeek <= 7 ) {
+							ReadEPlusWeatherForDayCurDayOfWeek = mod( ReadEPlusWeatherForDayCurDayOfWeek, 7 ) + 1;
 						}
-						TomorrowVariables.DayOfWeek = CurDayOfWeek;
+						TomorrowVariables.DayOfWeek = ReadEPlusWeatherForDayCurDayOfWeek;
 						TomorrowVariables.DaylightSavingIndex = DSTIndex( TomorrowVariables.DayOfYear );
 						TomorrowVariables.HolidayIndex = SpecialDayTypes( TomorrowVariables.DayOfYear );
 					}
@@ -3199,9 +3233,9 @@ namespace WeatherManager {
 			{ auto const SELECT_CASE_var( WPSkyTemperature( Environment( Environ ).WP_Type1 ).CalculationType );
 
 			if ( SELECT_CASE_var == WP_ScheduleValue ) {
-				GetScheduleValuesForDay( WPSkyTemperature( Environment( Environ ).WP_Type1 ).SchedulePtr, TomorrowSkyTemp, TomorrowVariables.DayOfYear_Schedule, CurDayOfWeek );
+				GetScheduleValuesForDay( WPSkyTemperature( Environment( Environ ).WP_Type1 ).SchedulePtr, TomorrowSkyTemp, TomorrowVariables.DayOfYear_Schedule, ReadEPlusWeatherForDayCurDayOfWeek );
 			} else if ( SELECT_CASE_var == WP_DryBulbDelta ) {
-				GetScheduleValuesForDay( WPSkyTemperature( Environment( Environ ).WP_Type1 ).SchedulePtr, TomorrowSkyTemp, TomorrowVariables.DayOfYear_Schedule, CurDayOfWeek );
+				GetScheduleValuesForDay( WPSkyTemperature( Environment( Environ ).WP_Type1 ).SchedulePtr, TomorrowSkyTemp, TomorrowVariables.DayOfYear_Schedule, ReadEPlusWeatherForDayCurDayOfWeek );
 				for ( Hour = 1; Hour <= 24; ++Hour ) {
 					for ( TS = 1; TS <= NumOfTimeStepInHour; ++TS ) {
 						TomorrowSkyTemp( TS, Hour ) = TomorrowOutDryBulbTemp( TS, Hour ) - TomorrowSkyTemp( TS, Hour );
@@ -3209,7 +3243,7 @@ namespace WeatherManager {
 				}
 
 			} else if ( SELECT_CASE_var == WP_DewPointDelta ) {
-				GetScheduleValuesForDay( WPSkyTemperature( Environment( Environ ).WP_Type1 ).SchedulePtr, TomorrowSkyTemp, TomorrowVariables.DayOfYear_Schedule, CurDayOfWeek );
+				GetScheduleValuesForDay( WPSkyTemperature( Environment( Environ ).WP_Type1 ).SchedulePtr, TomorrowSkyTemp, TomorrowVariables.DayOfYear_Schedule, ReadEPlusWeatherForDayCurDayOfWeek );
 				for ( Hour = 1; Hour <= 24; ++Hour ) {
 					for ( TS = 1; TS <= NumOfTimeStepInHour; ++TS ) {
 						TomorrowSkyTemp( TS, Hour ) = TomorrowOutDewPointTemp( TS, Hour ) - TomorrowSkyTemp( TS, Hour );
@@ -3398,7 +3432,6 @@ namespace WeatherManager {
 		std::string DateError;
 		Real64 RField21;
 		int Count;
-		static int LCount( 0 );
 		bool DateInError;
 
 		++LCount;
@@ -3686,7 +3719,6 @@ Label902: ;
 		Real64 WBRange; // working copy of wet-bulb daily range. C (or 1 if input is difference)
 
 		Array1D_int Date0( 8 );
-		static bool PrintDDHeader;
 		std::string AlpUseRain;
 		std::string AlpUseSnow;
 		bool ConstantHumidityRatio;
@@ -5261,7 +5293,6 @@ Label9999: ;
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int Env; // Environment Loop Counter
-		static bool ErrorsFound( false );
 		int RPD1;
 		int RPD2;
 		int RP; // number of run periods
@@ -5311,49 +5342,49 @@ Label9999: ;
 		}
 
 		if ( TotDesDays >= 1 ) {
-			GetDesignDayData( TotDesDays, ErrorsFound );
+			GetDesignDayData( TotDesDays, ReadUserWeatherInputErrorsFound );
 		}
 
 		if ( RPD1 >= 1 || RPD2 >= 1 ) {
-			GetRunPeriodDesignData( ErrorsFound );
+			GetRunPeriodDesignData( ReadUserWeatherInputErrorsFound );
 		}
 
 		//the last environment(s) is designated the weather environment if an annual run
 		// is selected.  All of the design systems is done from the design day info
 		// which will have to be completed to run the annual run.
 		if ( TotRunPers >= 1 || FullAnnualRun ) {
-			GetRunPeriodData( TotRunPers, ErrorsFound );
+			GetRunPeriodData( TotRunPers, ReadUserWeatherInputErrorsFound );
 		}
 
 		if ( RPD1 >= 1 || RPD2 >= 1 || TotRunPers >= 1 || FullAnnualRun ) {
-			GetSpecialDayPeriodData( ErrorsFound );
-			GetDSTData( ErrorsFound );
+			GetSpecialDayPeriodData( ReadUserWeatherInputErrorsFound );
+			GetDSTData( ReadUserWeatherInputErrorsFound );
 			if ( IDFDaylightSaving ) {
 				DST = IDFDST;
 			}
 		}
 
-		GetLocationInfo( ErrorsFound );
+		GetLocationInfo( ReadUserWeatherInputErrorsFound );
 
-		GetGroundTemps( ErrorsFound );
+		GetGroundTemps( ReadUserWeatherInputErrorsFound );
 
-		GetGroundReflectances( ErrorsFound );
+		GetGroundReflectances( ReadUserWeatherInputErrorsFound );
 
-		GetSnowGroundRefModifiers( ErrorsFound );
+		GetSnowGroundRefModifiers( ReadUserWeatherInputErrorsFound );
 
-		GetWaterMainsTemperatures( ErrorsFound );
+		GetWaterMainsTemperatures( ReadUserWeatherInputErrorsFound );
 
-		GetWeatherStation( ErrorsFound );
+		GetWeatherStation( ReadUserWeatherInputErrorsFound );
 
 		SetupEnvironmentTypes();
 
-		GetWeatherProperties( ErrorsFound );
+		GetWeatherProperties( ReadUserWeatherInputErrorsFound );
 
 		// Deallocate ones used for schedule pointers
 		SPSiteScheduleNamePtr.deallocate();
 		SPSiteScheduleUnits.deallocate();
 
-		if ( ErrorsFound ) {
+		if ( ReadUserWeatherInputErrorsFound ) {
 			ShowFatalError( "GetWeatherInput: Above errors cause termination" );
 		}
 
@@ -6118,8 +6149,6 @@ Label9999: ;
 		int DateType;
 		int IOStat;
 		int DayType;
-		static bool IsNotOK( false ); // Flag to verify name
-		static bool IsBlank( false ); // Flag for blank name
 
 		cCurrentModuleObject = "RunPeriodControl:SpecialDays";
 		NumSpecDays = GetNumObjectsFound( cCurrentModuleObject );
@@ -8081,7 +8110,6 @@ Label9999: ;
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static std::string Title;
 		int Count;
 		std::string WMO;
 		std::string::size_type Pos;
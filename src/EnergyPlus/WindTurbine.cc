@@ -141,8 +141,33 @@ namespace WindTurbine {
 	// Object Data
 	Array1D< WindTurbineParams > WindTurbineSys;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool GetInputFlag( true );
+		bool ErrorsFound( false ); // If errors detected in input
+		bool MyOneTimeFlag( true );
+		Real64 AnnualTMYWS( 0.0 ); // Annual average wind speed in stat file
+	}
+
 	// Functions
 
+	// Clears the global data in WindTurbine.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NumWindTurbines = 0;
+		WindTurbineSys.deallocate();
+		GetInputFlag = true;
+		ErrorsFound = false;
+		MyOneTimeFlag = true;
+		AnnualTMYWS = 0.0;
+	}
+
 	void
 	SimWindTurbine(
 		int const EP_UNUSED( GeneratorType ), // Type of Generator
@@ -187,7 +212,6 @@ namespace WindTurbine {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInputFlag( true );
 		int WindTurbineNum;
 		// Obtains and allocates heat balance related parameters from input
 
@@ -318,7 +342,6 @@ namespace WindTurbine {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		int WindTurbineNum; // Wind turbine number
@@ -664,7 +687,6 @@ namespace WindTurbine {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool MyOneTimeFlag( true );
 		int ReadStatus; // Reading status of stat file
 		int statFile; // Weather Stat File
 		std::string::size_type lnPtr; // scan pointer for Line input
@@ -674,7 +696,6 @@ namespace WindTurbine {
 		bool warningShown; // true if the <365 warning has already been shown
 		std::string lineIn;
 		Array1D< Real64 > MonthWS( 12 );
-		static Real64 AnnualTMYWS( 0.0 ); // Annual average wind speed in stat file
 		Real64 LocalTMYWS; // Annual average wind speed at the rotor height
 
 		// Estimate average annual wind speed once
@@ -198,6 +198,11 @@ namespace WindTurbine {
 
 	// Functions
 
+	// Clears the global data in WindTurbine.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	SimWindTurbine(
 		int const GeneratorType, // Type of Generator
@@ -171,6 +171,12 @@ namespace WindowAC {
 	namespace {
 		bool MyOneTimeFlag( true );
 		bool ZoneEquipmentListChecked( false );
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		bool errFlag( false ); // Local error flag for GetOAMixerNodeNums
+		bool FanErrFlag( false ); // Error flag used in GetFanIndex call
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
+		Array1D_bool MyEnvrnFlag; // one time initialization flag
+		Array1D_bool MyZoneEqFlag; // used to set up zone equipment availability managers
 	}
 
 	int NumWindAC( 0 );
@@ -201,6 +207,12 @@ namespace WindowAC {
 		CheckEquipName.deallocate();
 		WindAC.deallocate();
 		WindACNumericFields.deallocate();
+		ErrorsFound = false;
+		errFlag = false;
+		FanErrFlag = false;
+		TotalArgs = 0;
+		MyEnvrnFlag.deallocate();
+		MyZoneEqFlag.deallocate();
 	}
 
 	void
@@ -377,11 +389,8 @@ namespace WindowAC {
 		int NumNumbers; // Number of Numbers for each GetObjectItem call
 		Array1D_int OANodeNums( 4 ); // Node numbers of Outdoor air mixer (OA, EA, RA, MA)
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
-		static bool errFlag( false ); // Local error flag for GetOAMixerNodeNums
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
-		static bool FanErrFlag( false ); // Error flag used in GetFanIndex call
 		Real64 FanVolFlow; // Fan volumetric flow rate
 		bool CoilNodeErrFlag; // Used in error messages for mining coil outlet node number
 		std::string CurrentModuleObject; // Object type for getting and error messages
@@ -391,7 +400,6 @@ namespace WindowAC {
 		Array1D< Real64 > Numbers; // Numeric input items for object
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max) for a
 		//  INTEGER                              :: FanType           ! Integer index for Fan type
 		int CtrlZone; // index to loop counter
 		int NodeNum; // index to loop counter
@@ -757,8 +765,6 @@ namespace WindowAC {
 		// static bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
 		////////////////////////////////////////////////////////////////////////////////////
 		int Loop; // loop counter
-		static Array1D_bool MyEnvrnFlag; // one time initialization flag
-		static Array1D_bool MyZoneEqFlag; // used to set up zone equipment availability managers
 		Real64 QToCoolSetPt; // sensible load to cooling setpoint (W)
 		Real64 NoCompOutput; // sensible load delivered with compressor off (W)
 
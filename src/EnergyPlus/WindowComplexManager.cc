@@ -139,6 +139,9 @@ namespace WindowComplexManager {
 	using namespace DataShadowingCombinations;
 	using namespace Vectors;
 	using namespace DataHeatBalFanSys;
+	using TARCOGGassesParams::maxgas;
+	using TARCOGParams::maxlay;
+	using TARCOGParams::maxlay1;
 
 	// Data
 	// MODULE PARAMETER DEFINITIONS:
@@ -171,6 +174,171 @@ namespace WindowComplexManager {
 	Array1D< WindowIndex > WindowList;
 	Array2D< WindowStateIndex > WindowStateList;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool Once( true ); // Flag for insuring things happen once
+		int IBasis( 0 ); // Index for identifying basis in BasisList
+		int InitBSDFWindowsISurf( 0 ); // Index for sorting thru Surface array
+		int InitBSDFWindowsIConst( 0 ); // Index for accessing Construct array
+		int InitBSDFWindowsIState( 0 ); // Index identifying the window state for a particular window
+		int IWind( 0 ); // Index identifying a window in the WindowList
+		int I( 0 ); // general purpose index
+		int J( 0 ); // general purpose index
+		int JSurf( 0 ); // back surface number
+		int K( 0 ); // general purpose index
+		int KBkSurf( 0 ); // back surface index
+		int KBasis( 0 ); // secondary reference to a basis index
+		int NumBasis( 0 ); // Number of unique bases (No. in BasisList)
+		int NBkSurf( 0 ); // Local variable for the number of back surfaces
+		int MatrixNo( 0 ); // Index of Basis matrix
+		bool InitComplexWindowsOnce( true ); // Flag for insuring things happen once
+		Vector SunDir( 0.0, 0.0, 1.0 ); // unit vector pointing toward sun (world CS)
+		Vector Posit( 0.0, 0.0, 1.0 ); // vector location of current ground point
+		Vector HitPt( 0.0, 0.0, 1.0 ); // vector location of ray intersection with a surface
+		int NRegWin( 0 ); // no reg windows found as back surfaces
+		int KRegWin( 0 ); // index of reg window as back surface
+		int CalcStaticPropertiesISurf( 0 ); // Index for sorting thru Surface array
+		int CalcStaticPropertiesIState( 0 ); // Index identifying the window state for a particular window
+		int CalcStaticPropertiesIWind( 0 ); // Index identifying a window in the WindowList
+		int NumStates( 0 ); // local copy of no of states
+		int NumSurfInZone( 0 ); // Number of zone surfaces
+		bool ComplexFenInZone( false );
+		int ConstructBasisI( 0 ); // general purpose index
+		int ConstructBasisJ( 0 ); // general purpose index
+		int NThetas( 0 ); // Current number of theta values
+		int NumElem( 0 ); // Number of elements in current basis
+		int ElemNo( 0 ); // Current basis element number
+		Real64 ConstructBasisTheta( 0.0 ); // Current theta value
+		Real64 ConstructBasisPhi( 0.0 ); // Current phi value
+		Real64 DTheta( 0.0 ); // Increment for theta value (Window6 type input)
+		Real64 ConstructBasisDPhi( 0.0 ); // Increment for phi value (Window6 type input)
+		Real64 HalfDTheta( 0.0 ); // Half-width of all theta bins except first and last (W6 input)
+		Real64 Lamda( 0.0 ); // Current 'Lamda' value (element weight)
+		Real64 SolAng( 0.0 ); // Current element solid angle
+		Real64 NextTheta( 0.0 ); // Next theta in the W6 basis after current
+		Real64 LastTheta( 0.0 ); // Previous theta in the W6 basis before current
+		Real64 ConstructBasisLowerTheta( 0.0 ); // Lower theta boundary of the element
+		Real64 ConstructBasisUpperTheta( 0.0 ); // Upper theta boundary of the element
+		int CalcWindowStaticPropertiesI( 0 ); // general purpose index
+		int CalcWindowStaticPropertiesJ( 0 ); // general purpose index
+		int JJ( 0 ); // general purpose index--ray
+		int L( 0 ); // general purpose index--layer
+		int M( 0 ); // general purpose index--ray
+		int nlayer( 0 ); // Number of glazing layers
+		int iwd( 0 ); // Wind direction:  0 - windward, 1 - leeward
+		Real64 tout( 0.0 ); // Outdoor temperature [K]
+		Real64 tind( 0.0 ); // Indoor temperature [K]
+		Real64 trmin( 0.0 ); // Indoor mean radiant temperature [K]
+		Real64 wso( 0.0 ); // Outdoor wind speed [m/s]
+		Real64 wsi( 0.0 ); // Inside forced air speed [m/s]
+		Real64 dir( 0.0 ); // Direct solar radiation [W/m^2]
+		int isky( 0 ); // Flag for sky temperature (Tsky) and sky emittance (esky)
+		Real64 tsky( 0.0 ); // Night sky temperature [K]
+		Real64 esky( 0.0 ); // Effective night sky emittance
+		Real64 fclr( 0.0 ); // Fraction of sky that is clear
+		Array1D< Real64 > gap( maxlay, 0.0 ); // Vector of gap widths [m] {maxlay}
+		Array1D< Real64 > thick( maxlay, 0.0 ); // Vector of glass thicknesses [m] {maxlay}
+		Array1D< Real64 > scon( maxlay, 0.0 ); // Vector of conductivities of each glazing layer  [W/m.K] {maxlay}
+		Array1D< Real64 > tir( maxlay*2, 0.0 ); // Vector of IR transmittances of each layer {2*maxlay - 2 surfaces per layer}
+		Array1D< Real64 > emis( maxlay*2, 0.0 ); // Vector of IR emittances of each surface {2*maxlay - 2 surfaces per layer}
+		Array1D_int SupportPlr( maxlay, 0 ); // Shows whether or not gap have support pillar
+		Array1D< Real64 > PillarSpacing( maxlay, 0.0 ); // Pillar spacing for each gap (used in case there is support pillar)
+		Array1D< Real64 > PillarRadius( maxlay, 0.0 ); // Pillar radius for each gap (used in case there is support pillar)
+		Real64 totsol( 0.0 ); // Total solar transmittance of the IGU
+		Real64 tilt( 0.0 ); // Window tilt [degrees]
+		Array1D< Real64 > asol( maxlay, 0.0 ); // Vector of Absorbed solar energy fractions for each layer {maxlay}
+		Real64 height( 0.0 ); // IGU cavity height [m]
+		Real64 heightt( 0.0 ); // Total window height [m]
+		Real64 width( 0.0 ); // Window width [m]
+		Array1D< Real64 > presure( maxlay+1, 0.0 ); // Vector of gas pressures in gaps [N/m^2] {maxlay+1}
+		Array1D< Real64 > GapDefMax( maxlay-1, 0.0 ); // Vector of gap widths in deflected state.  It will be used as input
+		Array1D< Real64 > YoungsMod( maxlay, 0.0 ); // Vector of Young's modulus. [m]
+		Array1D< Real64 > PoissonsRat( maxlay, 0.0 ); // Vector of Poisson's Ratios. [m]
+		Array1D< Real64 > LayerDef( maxlay, 0.0 ); // Vector of layers deflection. [m]
+		Array2D_int iprop( maxgas, maxlay+1, 1 ); // Matrix of gas codes - see above {maxgap x maxgas}
+		Array2D< Real64 > frct( maxgas, maxlay+1, 0.0 ); // Matrix of mass percentages in gap mixtures  {maxgap x maxgas}
+		Array2D< Real64 > gcon( 3, maxgas, 0.0 ); // Matrix of constants for gas conductivity calc
+		Array2D< Real64 > gvis( 3, maxgas, 0.0 ); // Matrix of constants for gas dynamic viscosity calc
+		Array2D< Real64 > gcp( 3, maxgas, 0.0 ); // Matrix of constants for gas specific heat calc at constant pressure
+		Array1D< Real64 > CalcComplexWindowThermal_wght( maxgas, 0.0 ); // Vector of Molecular weights for gasses {maxgas}
+		Array1D< Real64 > gama( maxgas, 0.0 ); // Vector of spefic heat ration for low pressure calc {maxgas}
+		bool CalcComplexWindowThermal_feedData( false ); // flag to notify if data needs to be feed into gas arrays
+		Array1D_int nmix( maxlay+1, 0 ); // Vector of number of gasses in gas mixture of each gap {maxlay+1}
+		Real64 hin( 0.0 ); // Indoor combined film coefficient (if non-zero) [W/m^2.K]
+		Real64 hout( 0.0 ); // Outdoor combined film coefficient (if non-zero) [W/m^2.K]
+		Array1D_int ibc( 2, 0 ); // Vector of boundary condition flags (ibc(1) - outdoor, ibc(2) - indoor)
+		Array1D< Real64 > Atop( maxlay, 0.0 ); // Vector with areas of top openings - between SD layers and top of
+		Array1D< Real64 > Abot( maxlay, 0.0 ); // Vector with areas of bottom openings - between SD layers
+		Array1D< Real64 > Al( maxlay, 0.0 ); // Vector with areas of left-hand side openings - between SD layers
+		Array1D< Real64 > Ar( maxlay, 0.0 ); // Vector of areas of right-hand side openings - between SD layers
+		Array1D< Real64 > Ah( maxlay, 0.0 ); // Vector of total areas of holes for each SD [m^2] {maxlay}
+		Array1D< Real64 > SlatThick( maxlay, 0.0 ); // Thickness of the slat material [m] {maxlay} **
+		Array1D< Real64 > SlatWidth( maxlay, 0.0 ); // Slat width [m] {maxlay}
+		Array1D< Real64 > SlatAngle( maxlay, 0.0 ); // Slat tilt angle [deg] {maxlay}
+		Array1D< Real64 > SlatCond( maxlay, 0.0 ); // Conductivity of the slat material [W/m.K] {maxlay}
+		Array1D< Real64 > SlatSpacing( maxlay, 0.0 ); // Distance between slats [m] {maxlay}
+		Array1D< Real64 > SlatCurve( maxlay, 0.0 ); // Curvature radius of the slat [m] {maxlay}
+		Array1D< Real64 > vvent( maxlay+1, 0.0 ); // Vector of velocities for forced ventilation, for each gap, and for
+		Array1D< Real64 > tvent( maxlay+1, 0.0 ); // Vector of temperatures of ventilation gas for forced ventilation, for each
+		Array1D_int LayerType( maxlay, 0 ); // Glazing layer type flag {maxlay}:
+		Array1D_int nslice( maxlay, 0 ); // Vector of numbers of slices in a laminated glazing layers
+		Array1D< Real64 > LaminateA( maxlay, 0.0 ); // Left-hand side array for creating slice equations {maxlay}
+		Array1D< Real64 > LaminateB( maxlay, 0.0 ); // Right-hand side array for creating slice equations {maxlay}
+		Array1D< Real64 > sumsol( maxlay, 0.0 ); // Array of absorbed solar energy fractions for each laminated
+		int standard( 1 ); // Calculation standard switch:
+		int ThermalMod( 0 ); // Thermal model:
+		int Debug_mode( 0 ); // Switch for debug output files:
+		std::string Debug_dir; // Target directory for debug files (pointer to a character array)
+		std::string Debug_file( "Test" ); // Template file name used to create debug output files
+		std::int32_t Window_ID( -1 ); // ID of the window (long integer value, passed by W6)
+		std::int32_t IGU_ID( -1 ); // ID of the IGU (long integer value, passed by W6)
+		Real64 SDScalar( 0.0 ); // SD convection factor (value between 0 and 1)
+		Array1D< Real64 > theta( maxlay*2, 0.0 ); // Vector of average temperatures of glazing surfaces [K] {2*maxlay}
+		Array1D< Real64 > q( maxlay*2+1, 0.0 ); // Vector of various heat fluxes [W/m^2] {2*maxlay+1},
+		Array1D< Real64 > qprim( maxlay1, 0.0 ); // Vector of heat fluxes from the outdoor-faced surfaces of glazing layers
+		Array1D< Real64 > qv( maxlay1, 0.0 ); // Vector of heat fluxes to each gap by ventillation [W/m^2]
+		Real64 ufactor( 0.0 ); // Center of glass U-value [W/m^2.K]
+		Real64 sc( 0.0 ); // Shading Coefficient
+		Real64 hflux( 0.0 ); // Net heat flux between room and window [W/m^2]
+		Real64 hcin( 0.0 ); // Indoor convective surface heat transfer coefficient  [W/m^2.K]
+		Real64 hcout( 0.0 ); // Outdoor convective surface heat transfer coefficient [W/m^2.K]
+		Real64 hrin( 0.0 ); // Indoor radiative surface heat transfer coefficient [W/m^2.K]
+		Real64 hrout( 0.0 ); // Outdoor radiative surface heat transfer coefficient [W/m^2.K]
+		Array1D< Real64 > hcgap( maxlay1, 0.0 ); // Convective part of gap effective conductivity {maxlay}
+		Array1D< Real64 > hrgap( maxlay1, 0.0 ); // Radiative part of gap effective conductivity (including in and out)
+		Real64 shgc( 0.0 ); // Solar heat gain coefficient - per ISO 15099
+		Real64 shgct( 0.0 ); // Solar heat gain coefficient - per old procedure
+		Real64 tamb( 0.0 ); // Outdoor environmental temperature [K]
+		Real64 troom( 0.0 ); // Indoor environmental temperature [K]
+		Array1D< Real64 > hg( maxlay, 0.0 ); // Gas conductance of the glazing cavity
+		Array1D< Real64 > hr( maxlay, 0.0 ); // Radiation conductance of the glazing cavity
+		Array1D< Real64 > hs( maxlay, 0.0 ); // Thermal conductance of the glazing cavity
+		Real64 he( 0.0 ); // External heat transfer coefficient [W/m^2.K] - EN673 and ISO 10292 procedure
+		Real64 hi( 0.0 ); // Internal heat transfer coefficient [W/m^2.K] - EN673 and ISO 10292 procedure
+		Array1D< Real64 > Ra( maxlay+1, 0.0 ); // Vector of Rayleigh numbers, for each gap {maxlay}
+		Array1D< Real64 > Nu( maxlay+1, 0.0 ); // Vector of Nusselt numbers, for each gap {maxlay}
+		int nperr( 0 ); // Error code
+		Real64 ShadeEmisRatioOut( 0.0 ); // Ratio of modified to glass emissivity at the outermost glazing surface
+		Real64 ShadeEmisRatioIn( 0.0 ); // Ratio of modified to glass emissivity at the innermost glazing surface
+		Real64 ShadeHcRatioOut( 0.0 ); // Ratio of modified to unshaded Hc at the outermost glazing surface
+		Real64 ShadeHcRatioIn( 0.0 ); // Ratio of modified to unshaded Hc at the innermost glazing surface
+		Real64 HcUnshadedOut( 0.0 ); // Hc value at outdoor surface of an unshaded subsystem [W/m^2.K]
+		Real64 HcUnshadedIn( 0.0 ); // Hc value at indoor surface of an unshaded subsystem [W/m^2.K]
+		Array1D< Real64 > Keff( maxlay, 0.0 ); // Vector of keff values for gaps [W/m.K] {maxlay}
+		Array1D< Real64 > ShadeGapKeffConv( maxlay-1, 0.0 ); // Vector of convective keff values for areas above/below
+		Array1D< Real64 > deltaTemp( 100, 0.0 );
+		Array1D_int iMinDT( 1, 0 );
+		Array1D_int IDConst( 100, 0 );
+		int CalcSHGC( 0 ); // SHGC calculations are not necessary for E+ run
+		int NumOfIterations( 0 );
+		int counter( 1 );
+		bool coeffFound( false );
+	}
+
 	// Functions
 
 	void
@@ -180,6 +348,163 @@ namespace WindowComplexManager {
 		BasisList.deallocate();
 		WindowList.deallocate();
 		WindowStateList.deallocate();
+		Once = true;
+		IBasis = 0;
+		InitBSDFWindowsISurf = 0;
+		InitBSDFWindowsIConst = 0;
+		InitBSDFWindowsIState = 0;
+		IWind = 0;
+		I = 0;
+		J = 0;
+		JSurf = 0;
+		K = 0;
+		KBkSurf = 0;
+		KBasis = 0;
+		NumBasis = 0;
+		NBkSurf = 0;
+		MatrixNo = 0;
+		InitComplexWindowsOnce = true;
+		SunDir = Vector( 0.0, 0.0, 1.0 );
+		Posit = Vector( 0.0, 0.0, 1.0 );
+		HitPt = Vector( 0.0, 0.0, 1.0 );
+		NRegWin = 0;
+		KRegWin = 0;
+		CalcStaticPropertiesISurf = 0;
+		CalcStaticPropertiesIState = 0;
+		CalcStaticPropertiesIWind = 0;
+		NumStates = 0;
+		NumSurfInZone = 0;
+		ComplexFenInZone = false;
+		ConstructBasisI = 0;
+		ConstructBasisJ = 0;
+		NThetas = 0;
+		NumElem = 0;
+		ElemNo = 0;
+		ConstructBasisTheta = 0.0;
+		ConstructBasisPhi = 0.0;
+		DTheta = 0.0;
+		ConstructBasisDPhi = 0.0;
+		HalfDTheta = 0.0;
+		Lamda = 0.0;
+		SolAng = 0.0;
+		NextTheta = 0.0;
+		LastTheta = 0.0;
+		ConstructBasisLowerTheta = 0.0;
+		ConstructBasisUpperTheta = 0.0;
+		CalcWindowStaticPropertiesI = 0;
+		CalcWindowStaticPropertiesJ = 0;
+		JJ = 0;
+		L = 0;
+		M = 0;
+		nlayer = 0;
+		iwd = 0;
+		tout = 0.0;
+		tind = 0.0;
+		trmin = 0.0;
+		wso = 0.0;
+		wsi = 0.0;
+		dir = 0.0;
+		isky = 0;
+		tsky = 0.0;
+		esky = 0.0;
+		fclr = 0.0;
+		gap = Array1D< Real64 >( maxlay, 0.0 );
+		thick = Array1D< Real64 >( maxlay, 0.0 );
+		scon = Array1D< Real64 >( maxlay, 0.0 );
+		tir = Array1D< Real64 >( maxlay*2, 0.0 );
+		emis = Array1D< Real64 >( maxlay*2, 0.0 );
+		SupportPlr = Array1D_int( maxlay, 0 );
+		PillarSpacing = Array1D< Real64 >( maxlay, 0.0 );
+		PillarRadius = Array1D< Real64 >( maxlay, 0.0 );
+		totsol = 0.0;
+		tilt = 0.0;
+		asol = Array1D< Real64 >( maxlay, 0.0 );
+		height = 0.0;
+		heightt = 0.0;
+		width = 0.0;
+		presure = Array1D< Real64 >( maxlay+1, 0.0 );
+		GapDefMax = Array1D< Real64 >( maxlay-1, 0.0 );
+		YoungsMod = Array1D< Real64 >( maxlay, 0.0 );
+		PoissonsRat = Array1D< Real64 >( maxlay, 0.0 );
+		LayerDef = Array1D< Real64 >( maxlay, 0.0 );
+		iprop = Array2D_int( maxgas, maxlay+1, 1 );
+		frct = Array2D< Real64 >( maxgas, maxlay+1, 0.0 );
+		gcon = Array2D< Real64 >( 3, maxgas, 0.0 );
+		gvis = Array2D< Real64 >( 3, maxgas, 0.0 );
+		gcp = Array2D< Real64 >( 3, maxgas, 0.0 );
+		CalcComplexWindowThermal_wght = Array1D< Real64 >( maxgas, 0.0 );
+		gama = Array1D< Real64 >( maxgas, 0.0 );
+		CalcComplexWindowThermal_feedData = false;
+		nmix = Array1D_int( maxlay+1, 0 );
+		hin = 0.0;
+		hout = 0.0;
+		ibc = Array1D_int( 2, 0 );
+		Atop = Array1D< Real64 >( maxlay, 0.0 );
+		Abot = Array1D< Real64 >( maxlay, 0.0 );
+		Al = Array1D< Real64 >( maxlay, 0.0 );
+		Ar = Array1D< Real64 >( maxlay, 0.0 );
+		Ah = Array1D< Real64 >( maxlay, 0.0 );
+		SlatThick = Array1D< Real64 >( maxlay, 0.0 );
+		SlatWidth = Array1D< Real64 >( maxlay, 0.0 );
+		SlatAngle = Array1D< Real64 >( maxlay, 0.0 );
+		SlatCond = Array1D< Real64 >( maxlay, 0.0 );
+		SlatSpacing = Array1D< Real64 >( maxlay, 0.0 );
+		SlatCurve = Array1D< Real64 >( maxlay, 0.0 );
+		vvent = Array1D< Real64 >( maxlay+1, 0.0 );
+		tvent = Array1D< Real64 >( maxlay+1, 0.0 );
+		LayerType = Array1D_int( maxlay, 0 );
+		nslice = Array1D_int( maxlay, 0 );
+		LaminateA = Array1D< Real64 >( maxlay, 0.0 );
+		LaminateB = Array1D< Real64 >( maxlay, 0.0 );
+		sumsol = Array1D< Real64 >( maxlay, 0.0 );
+		standard = 1;
+		ThermalMod = 0;
+		Debug_mode = 0;
+		Debug_dir.clear();
+		Debug_file = "Test";
+		Window_ID = -1;
+		IGU_ID = -1;
+		SDScalar = 0.0;
+		theta = Array1D< Real64 >( maxlay*2, 0.0 );
+		q = Array1D< Real64 >( maxlay*2+1, 0.0 );
+		qprim = Array1D< Real64 >( maxlay1, 0.0 );
+		qv = Array1D< Real64 >( maxlay1, 0.0 );
+		ufactor = 0.0;
+		sc = 0.0;
+		hflux = 0.0;
+		hcin = 0.0;
+		hcout = 0.0;
+		hrin = 0.0;
+		hrout = 0.0;
+		hcgap = Array1D< Real64 >( maxlay1, 0.0 );
+		hrgap = Array1D< Real64 >( maxlay1, 0.0 );
+		shgc = 0.0;
+		shgct = 0.0;
+		tamb = 0.0;
+		troom = 0.0;
+		hg = Array1D< Real64 >( maxlay, 0.0 );
+		hr = Array1D< Real64 >( maxlay, 0.0 );
+		hs = Array1D< Real64 >( maxlay, 0.0 );
+		he = 0.0;
+		hi = 0.0;
+		Ra = Array1D< Real64 >( maxlay+1, 0.0 );
+		Nu = Array1D< Real64 >( maxlay+1, 0.0 );
+		nperr = 0;
+		ShadeEmisRatioOut = 0.0;
+		ShadeEmisRatioIn = 0.0;
+		ShadeHcRatioOut = 0.0;
+		ShadeHcRatioIn = 0.0;
+		HcUnshadedOut = 0.0;
+		HcUnshadedIn = 0.0;
+		Keff = Array1D< Real64 >( maxlay, 0.0 );
+		ShadeGapKeffConv = Array1D< Real64 >( maxlay-1, 0.0 );
+		deltaTemp = Array1D< Real64 >( 100, 0.0 );
+		iMinDT = Array1D_int( 1, 0 );
+		IDConst = Array1D_int( 100, 0 );
+		CalcSHGC = 0;
+		NumOfIterations = 0;
+		counter = 1;
+		coeffFound = false;
 	}
 
 	void
@@ -217,23 +542,8 @@ namespace WindowComplexManager {
 		// DERIVED TYPE DEFINITIONS:
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool Once( true ); // Flag for insuring things happen once
-		static int IBasis( 0 ); // Index for identifying basis in BasisList
-		static int ISurf( 0 ); // Index for sorting thru Surface array
-		static int IConst( 0 ); // Index for accessing Construct array
-		static int IState( 0 ); // Index identifying the window state for a particular window
-		static int IWind( 0 ); // Index identifying a window in the WindowList
-		static int I( 0 ); // general purpose index
-		static int J( 0 ); // general purpose index
-		static int JSurf( 0 ); // back surface number
 		int BaseSurf; // base surface number (used in finding back surface)
-		static int K( 0 ); // general purpose index
-		static int KBkSurf( 0 ); // back surface index
-		static int KBasis( 0 ); // secondary reference to a basis index
-		static int NumBasis( 0 ); // Number of unique bases (No. in BasisList)
-		static int NBkSurf( 0 ); // Local variable for the number of back surfaces
 		int NumStates; // Local variable for the number of states
-		static int MatrixNo( 0 ); // Index of Basis matrix
 		Array1D< Real64 > Thetas; // temp array holding theta values
 		Array1D_int NPhis; // temp array holding number of phis for a given theta
 		Array1D< Real64 > V( 3 ); // vector array
@@ -267,17 +577,17 @@ namespace WindowComplexManager {
 		//            definition or additional definition of a state type with non-square matrices, then the loop
 		//            below should be modified to enter both of the bases into the basis list.
 
-		for ( IConst = FirstBSDF; IConst <= FirstBSDF + TotComplexFenStates - 1; ++IConst ) {
-			MatrixNo = Construct( IConst ).BSDFInput.BasisMatIndex;
+		for ( InitBSDFWindowsIConst = FirstBSDF; InitBSDFWindowsIConst <= FirstBSDF + TotComplexFenStates - 1; ++InitBSDFWindowsIConst ) {
+			MatrixNo = Construct( InitBSDFWindowsIConst ).BSDFInput.BasisMatIndex;
 			if ( NumBasis == 0 ) {
 				NumBasis = 1;
-				ConstructBasis( IConst, BasisList( 1 ) );
+				ConstructBasis( InitBSDFWindowsIConst, BasisList( 1 ) );
 			} else {
 				for ( IBasis = 1; IBasis <= NumBasis; ++IBasis ) {
 					if ( MatrixNo == BasisList( IBasis ).BasisMatIndex ) goto BsLoop_loop;
 				}
 				++NumBasis;
-				ConstructBasis( IConst, BasisList( NumBasis ) );
+				ConstructBasis( InitBSDFWindowsIConst, BasisList( NumBasis ) );
 			}
 			BsLoop_loop: ;
 		}
@@ -292,29 +602,29 @@ namespace WindowComplexManager {
 		//     control specifications
 		WindowList.allocate( TotSurfaces ); //Temporary allocation
 		WindowStateList.allocate( TotComplexFenStates, TotSurfaces ); //Temporary allocation
-		for ( ISurf = 1; ISurf <= TotSurfaces; ++ISurf ) {
-			IConst = Surface( ISurf ).Construction;
-			if ( IConst == 0 ) continue; // This is true for overhangs (Shading:Zone:Detailed)
-			if ( ! ( Construct( IConst ).TypeIsWindow && ( Construct( IConst ).WindowTypeBSDF ) ) ) continue; //Only BSDF windows
+		for ( InitBSDFWindowsISurf = 1; InitBSDFWindowsISurf <= TotSurfaces; ++InitBSDFWindowsISurf ) {
+			InitBSDFWindowsIConst = Surface( InitBSDFWindowsISurf ).Construction;
+			if ( InitBSDFWindowsIConst == 0 ) continue; // This is true for overhangs (Shading:Zone:Detailed)
+			if ( ! ( Construct( InitBSDFWindowsIConst ).TypeIsWindow && ( Construct( InitBSDFWindowsIConst ).WindowTypeBSDF ) ) ) continue; //Only BSDF windows
 			//Simon Check: Thermal construction removed
 			//ThConst = Construct(IConst)%BSDFInput%ThermalConstruction
-			SurfaceWindow( ISurf ).WindowModelType = WindowBSDFModel;
+			SurfaceWindow( InitBSDFWindowsISurf ).WindowModelType = WindowBSDFModel;
 			++NumComplexWind;
 			NumStates = 1;
 			WindowList( NumComplexWind ).NumStates = 1; //Having found the construction reference in
 			// the Surface array defines the first state for this window
-			WindowList( NumComplexWind ).SurfNo = ISurf;
+			WindowList( NumComplexWind ).SurfNo = InitBSDFWindowsISurf;
 			//WindowList( NumComplexWind ).Azimuth = DegToRadians * Surface( ISurf ).Azimuth;
 			//WindowList( NumComplexWind ).Tilt = DegToRadians * Surface( ISurf ).Tilt;
 			WindowStateList( NumStates, NumComplexWind ).InitInc = Calculate_Geometry;
 			WindowStateList( NumStates, NumComplexWind ).InitTrn = Calculate_Geometry;
 			WindowStateList( NumStates, NumComplexWind ).CopyIncState = 0;
 			WindowStateList( NumStates, NumComplexWind ).CopyTrnState = 0;
-			WindowStateList( NumStates, NumComplexWind ).Konst = IConst;
+			WindowStateList( NumStates, NumComplexWind ).Konst = InitBSDFWindowsIConst;
 			//Simon Check: ThermalConstruction assigned to current construction
 			//WindowStateList(NumComplexWind, NumStates)%ThermConst = ThConst
 			for ( I = 1; I <= NumBasis; ++I ) { //Find basis in Basis List
-				if ( Construct( IConst ).BSDFInput.BasisMatIndex == BasisList( I ).BasisMatIndex ) {
+				if ( Construct( InitBSDFWindowsIConst ).BSDFInput.BasisMatIndex == BasisList( I ).BasisMatIndex ) {
 					WindowStateList( NumStates, NumComplexWind ).IncBasisIndx = I; //Note: square property matrices
 					WindowStateList( NumStates, NumComplexWind ).TrnBasisIndx = I; //   assumption
 				}
@@ -380,64 +690,64 @@ namespace WindowComplexManager {
 		//  Now go through window list and window state list and calculate or copy the
 		//   geometry information for each window, state
 		for ( IWind = 1; IWind <= NumComplexWind; ++IWind ) {
-			ISurf = WindowList( IWind ).SurfNo;
+			InitBSDFWindowsISurf = WindowList( IWind ).SurfNo;
 			NumStates = WindowList( IWind ).NumStates;
 			//ALLOCATE(SurfaceWindow( ISurf )%ComplexFen)    !activate the BSDF window description
 			//  for this surface
-			SurfaceWindow( ISurf ).ComplexFen.NumStates = NumStates;
-			SurfaceWindow( ISurf ).ComplexFen.State.allocate( NumStates ); //Allocate space for the states
-			ComplexWind( ISurf ).NumStates = NumStates;
-			ComplexWind( ISurf ).Geom.allocate( NumStates ); //Allocate space for the geometries
+			SurfaceWindow( InitBSDFWindowsISurf ).ComplexFen.NumStates = NumStates;
+			SurfaceWindow( InitBSDFWindowsISurf ).ComplexFen.State.allocate( NumStates ); //Allocate space for the states
+			ComplexWind( InitBSDFWindowsISurf ).NumStates = NumStates;
+			ComplexWind( InitBSDFWindowsISurf ).Geom.allocate( NumStates ); //Allocate space for the geometries
 			//Azimuth = WindowList( IWind ).Azimuth;
 			//Tilt = WindowList( IWind ).Tilt;
 			// Get the number of back surfaces for this window
-			BaseSurf = Surface( ISurf ).BaseSurf; //ShadowComb is organized by base surface
+			BaseSurf = Surface( InitBSDFWindowsISurf ).BaseSurf; //ShadowComb is organized by base surface
 			NBkSurf = ShadowComb( BaseSurf ).NumBackSurf;
-			ComplexWind( ISurf ).NBkSurf = NBkSurf;
+			ComplexWind( InitBSDFWindowsISurf ).NBkSurf = NBkSurf;
 			// Define the back surface directions
-			ComplexWind( ISurf ).sWinSurf.allocate( NBkSurf );
-			ComplexWind( ISurf ).sdotN.allocate( NBkSurf );
+			ComplexWind( InitBSDFWindowsISurf ).sWinSurf.allocate( NBkSurf );
+			ComplexWind( InitBSDFWindowsISurf ).sdotN.allocate( NBkSurf );
 			//Define the unit vectors pointing from the window center to the back surface centers
 			for ( KBkSurf = 1; KBkSurf <= NBkSurf; ++KBkSurf ) {
-				BaseSurf = Surface( ISurf ).BaseSurf; //ShadowComb is organized by base surface
+				BaseSurf = Surface( InitBSDFWindowsISurf ).BaseSurf; //ShadowComb is organized by base surface
 				JSurf = ShadowComb( BaseSurf ).BackSurf( KBkSurf ); //these are all proper back surfaces
-				V = Surface( JSurf ).Centroid - Surface( ISurf ).Centroid;
+				V = Surface( JSurf ).Centroid - Surface( InitBSDFWindowsISurf ).Centroid;
 				VLen = magnitude( V );
 				//Define the unit vector from the window center to the back
-				ComplexWind( ISurf ).sWinSurf( KBkSurf ) = V / VLen;
+				ComplexWind( InitBSDFWindowsISurf ).sWinSurf( KBkSurf ) = V / VLen;
 				//surface center
 				//Define the back surface cosine(incident angle)
-				ComplexWind( ISurf ).sdotN( KBkSurf ) = dot( V, Surface( JSurf ).OutNormVec ) / VLen;
+				ComplexWind( InitBSDFWindowsISurf ).sdotN( KBkSurf ) = dot( V, Surface( JSurf ).OutNormVec ) / VLen;
 			}
-			for ( IState = 1; IState <= NumStates; ++IState ) {
+			for ( InitBSDFWindowsIState = 1; InitBSDFWindowsIState <= NumStates; ++InitBSDFWindowsIState ) {
 				//The following assumes identical incoming and outgoing bases.  The logic will need to be
 				//  redesigned if this assumption is relaxed
-				IConst = WindowStateList( IState, IWind ).Konst;
+				InitBSDFWindowsIConst = WindowStateList( InitBSDFWindowsIState, IWind ).Konst;
 				//ThConst = WindowStateList ( IWind , IState )%ThermConst
-				SurfaceWindow( ISurf ).ComplexFen.State( IState ).Konst = IConst;
+				SurfaceWindow( InitBSDFWindowsISurf ).ComplexFen.State( InitBSDFWindowsIState ).Konst = InitBSDFWindowsIConst;
 				//SurfaceWindow(ISurf)%ComplexFen%State(IState)%ThermConst = ThConst
-				if ( WindowStateList( IState, IWind ).InitInc == Calculate_Geometry ) {
-					ComplexWind( ISurf ).Geom( IState ).Inc = BasisList( WindowStateList( IState, IWind ).IncBasisIndx ); //Put in the basis structure from the BasisList
-					ComplexWind( ISurf ).Geom( IState ).Trn = BasisList( WindowStateList( IState, IWind ).TrnBasisIndx );
+				if ( WindowStateList( InitBSDFWindowsIState, IWind ).InitInc == Calculate_Geometry ) {
+					ComplexWind( InitBSDFWindowsISurf ).Geom( InitBSDFWindowsIState ).Inc = BasisList( WindowStateList( InitBSDFWindowsIState, IWind ).IncBasisIndx ); //Put in the basis structure from the BasisList
+					ComplexWind( InitBSDFWindowsISurf ).Geom( InitBSDFWindowsIState ).Trn = BasisList( WindowStateList( InitBSDFWindowsIState, IWind ).TrnBasisIndx );
 
-					SetupComplexWindowStateGeometry( ISurf, IState, IConst, ComplexWind( ISurf ), ComplexWind( ISurf ).Geom( IState ), SurfaceWindow( ISurf ).ComplexFen.State( IState ) );
+					SetupComplexWindowStateGeometry( InitBSDFWindowsISurf, InitBSDFWindowsIState, InitBSDFWindowsIConst, ComplexWind( InitBSDFWindowsISurf ), ComplexWind( InitBSDFWindowsISurf ).Geom( InitBSDFWindowsIState ), SurfaceWindow( InitBSDFWindowsISurf ).ComplexFen.State( InitBSDFWindowsIState ) );
 					//Note--setting up the state geometry will include constructing outgoing basis/surface
 					//  maps and those incoming maps that will not depend on shading.
 				} else {
-					SurfaceWindow( ISurf ).ComplexFen.State( IState ) = SurfaceWindow( ISurf ).ComplexFen.State( WindowStateList( IState, IWind ).CopyIncState ); //Note this overwrites Konst
-					SurfaceWindow( ISurf ).ComplexFen.State( IState ).Konst = IConst; //  so it has to be put back
+					SurfaceWindow( InitBSDFWindowsISurf ).ComplexFen.State( InitBSDFWindowsIState ) = SurfaceWindow( InitBSDFWindowsISurf ).ComplexFen.State( WindowStateList( InitBSDFWindowsIState, IWind ).CopyIncState ); //Note this overwrites Konst
+					SurfaceWindow( InitBSDFWindowsISurf ).ComplexFen.State( InitBSDFWindowsIState ).Konst = InitBSDFWindowsIConst; //  so it has to be put back
 					//SurfaceWindow (ISurf )%ComplexFen%State(IState)%ThermConst = ThConst  !same for ThermConst
-					ComplexWind( ISurf ).Geom( IState ) = ComplexWind( ISurf ).Geom( WindowStateList( IState, IWind ).CopyIncState );
+					ComplexWind( InitBSDFWindowsISurf ).Geom( InitBSDFWindowsIState ) = ComplexWind( InitBSDFWindowsISurf ).Geom( WindowStateList( InitBSDFWindowsIState, IWind ).CopyIncState );
 				}
 
 			} //State loop
 		} //Complex Window loop
 		//  Allocate all beam-dependent complex fenestration quantities
 		for ( IWind = 1; IWind <= NumComplexWind; ++IWind ) {
-			ISurf = WindowList( IWind ).SurfNo;
+			InitBSDFWindowsISurf = WindowList( IWind ).SurfNo;
 			NumStates = WindowList( IWind ).NumStates;
-			for ( IState = 1; IState <= NumStates; ++IState ) {
-				AllocateCFSStateHourlyData( ISurf, IState );
+			for ( InitBSDFWindowsIState = 1; InitBSDFWindowsIState <= NumStates; ++InitBSDFWindowsIState ) {
+				AllocateCFSStateHourlyData( InitBSDFWindowsISurf, InitBSDFWindowsIState );
 			} //State loop
 		} //Complex Window loop
 
@@ -690,11 +1000,10 @@ namespace WindowComplexManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool Once( true ); // Flag for insuring things happen once
 
 		//One-time initialization
-		if ( Once ) {
-			Once = false;
+		if ( InitComplexWindowsOnce ) {
+			InitComplexWindowsOnce = false;
 			InitBSDFWindows();
 			CalcStaticProperties();
 		}
@@ -816,9 +1125,6 @@ namespace WindowComplexManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		// Object Data
-		static Vector SunDir( 0.0, 0.0, 1.0 ); // unit vector pointing toward sun (world CS)
-		static Vector Posit( 0.0, 0.0, 1.0 ); // vector location of current ground point
-		static Vector HitPt( 0.0, 0.0, 1.0 ); // vector location of ray intersection with a surface
 
 		if ( KickOffSizing || KickOffSimulation ) return;
 
@@ -989,7 +1295,6 @@ namespace WindowComplexManager {
 		Real64 Phi;
 		int JSurf; // gen purpose surface no
 		int BaseSurf; // base surface no
-		int M; // general purpose index--ray
 		int L; // general purpose index--layer
 		int KBkSurf; // general purpose index--back surface
 		Real64 Sum1; // general purpose sum
@@ -998,8 +1303,6 @@ namespace WindowComplexManager {
 		int BkIncRay; // index of sun dir in back incidence basis
 		bool RegWindFnd; // flag for regular exterior back surf window
 		Array1D_int RegWinIndex; // bk surf nos of reg windows
-		static int NRegWin( 0 ); // no reg windows found as back surfaces
-		static int KRegWin( 0 ); // index of reg window as back surface
 		Real64 Refl; // temporary reflectance
 		Array1D< Real64 > Absorb; // temporary layer absorptance
 
@@ -1018,19 +1321,12 @@ namespace WindowComplexManager {
 			State.WinDirSpecTrans( Hour, TS ) = 0.0;
 			State.WinBmFtAbs( Hour, TS, {1,State.NLayers} ) = 0.0;
 		} else {
+			// The sums over the rays for the beam direction were made by CalcWindowStaticProperties
 			for ( I = 1; I <= Window.NBkSurf; ++I ) { //Back surface loop
-				Sum1 = 0.0;
-				for ( J = 1; J <= Geom.NSurfInt( I ); ++J ) { //Ray loop
-					Sum1 += Geom.Trn.Lamda( Geom.SurfInt( J, I ) ) * Construct( IConst ).BSDFInput.SolFrtTrans( IBm, Geom.SurfInt( J, I ) );
-				} //Ray loop
-				State.WinToSurfBmTrans( Hour, TS, I ) = Sum1;
+				State.WinToSurfBmTrans( Hour, TS, I ) = State.IncBkSurfTrans( IBm, I );
 			} //Back surface loop
 			//Calculate the directional-hemispherical transmittance
-			Sum1 = 0.0;
-			for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-				Sum1 += Geom.Trn.Lamda( J ) * Construct( IConst ).BSDFInput.SolFrtTrans( IBm, J );
-			}
-			State.WinDirHemiTrans( Hour, TS ) = Sum1;
+			State.WinDirHemiTrans( Hour, TS ) = State.IncDirHemiTrans( IBm );
 			//Calculate the directional specular transmittance
 			//Note:  again using assumption that Inc and Trn basis have same structure
 			State.WinDirSpecTrans( Hour, TS ) = Geom.Trn.Lamda( IBm ) * Construct( IConst ).BSDFInput.SolFrtTrans( IBm, IBm );
@@ -1048,9 +1344,7 @@ namespace WindowComplexManager {
 			JRay = Geom.GndIndex( J );
 			if ( Geom.SolBmGndWt( Hour, TS, J ) > 0.0 ) {
 				Sum2 += Geom.SolBmGndWt( Hour, TS, J ) * Geom.Inc.Lamda( JRay );
-				for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { //Outgoing ray loop
-					Sum1 += Geom.SolBmGndWt( Hour, TS, J ) * Geom.Inc.Lamda( JRay ) * Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.SolFrtTrans( JRay, M );
-				} //Outgoing ray loop
+				Sum1 += Geom.SolBmGndWt( Hour, TS, J ) * Geom.Inc.Lamda( JRay ) * State.IncDirHemiTrans( JRay );
 			}
 		} //Indcident ray loop
 		if ( Sum2 > 0.0 ) {
@@ -1102,11 +1396,7 @@ namespace WindowComplexManager {
 				//Here calculate the back incidence properties for the solar ray
 				//this does not say whether or not the ray can pass through the
 				//back surface window and hit this one!
-				Sum1 = 0.0;
-				for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-					Sum1 += Geom.Trn.Lamda( J ) * Construct( IConst ).BSDFInput.SolBkRefl( BkIncRay, J );
-				}
-				Refl = Sum1;
+				Refl = State.BkIncDirHemiRefl( BkIncRay );
 				for ( L = 1; L <= State.NLayers; ++L ) {
 					Absorb( L ) = Construct( IConst ).BSDFInput.Layer( L ).BkAbs( BkIncRay, 1 );
 				}
@@ -1167,19 +1457,15 @@ namespace WindowComplexManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static int ISurf( 0 ); // Index for sorting thru Surface array
 //		static int IConst( 0 ); // Index for accessing Construct array
-		static int IState( 0 ); // Index identifying the window state for a particular window
-		static int IWind( 0 ); // Index identifying a window in the WindowList
-		static int NumStates( 0 ); // local copy of no of states
 
-		for ( IWind = 1; IWind <= NumComplexWind; ++IWind ) {
-			ISurf = WindowList( IWind ).SurfNo;
-			NumStates = WindowList( IWind ).NumStates;
-			for ( IState = 1; IState <= NumStates; ++IState ) {
+		for ( CalcStaticPropertiesIWind = 1; CalcStaticPropertiesIWind <= NumComplexWind; ++CalcStaticPropertiesIWind ) {
+			CalcStaticPropertiesISurf = WindowList( CalcStaticPropertiesIWind ).SurfNo;
+			NumStates = WindowList( CalcStaticPropertiesIWind ).NumStates;
+			for ( CalcStaticPropertiesIState = 1; CalcStaticPropertiesIState <= NumStates; ++CalcStaticPropertiesIState ) {
 				// IConst = WindowStateList ( IWind , IState )%Konst
-				SurfaceWindow( ISurf ).ComplexFen.State( IState ).Konst = WindowStateList( IState, IWind ).Konst;
-				CalcWindowStaticProperties( ISurf, IState, ComplexWind( ISurf ), ComplexWind( ISurf ).Geom( IState ), SurfaceWindow( ISurf ).ComplexFen.State( IState ) );
+				SurfaceWindow( CalcStaticPropertiesISurf ).ComplexFen.State( CalcStaticPropertiesIState ).Konst = WindowStateList( CalcStaticPropertiesIState, CalcStaticPropertiesIWind ).Konst;
+				CalcWindowStaticProperties( CalcStaticPropertiesISurf, CalcStaticPropertiesIState, ComplexWind( CalcStaticPropertiesISurf ), ComplexWind( CalcStaticPropertiesISurf ).Geom( CalcStaticPropertiesIState ), SurfaceWindow( CalcStaticPropertiesISurf ).ComplexFen.State( CalcStaticPropertiesIState ) );
 			}
 		}
 
@@ -1277,8 +1563,6 @@ namespace WindowComplexManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ZoneNum; // Zone Number
 		int SurfNum; // Surface Number
-		static int NumSurfInZone( 0 ); // Number of zone surfaces
-		static bool ComplexFenInZone( false );
 
 		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 			ComplexFenInZone = false;
@@ -1331,23 +1615,7 @@ namespace WindowComplexManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static int I( 0 ); // general purpose index
-		static int J( 0 ); // general purpose index
-		static int NThetas( 0 ); // Current number of theta values
-		static int NumElem( 0 ); // Number of elements in current basis
-		static int ElemNo( 0 ); // Current basis element number
 		int MaxNPhis; // Max no of NPhis for any theta
-		static Real64 Theta( 0.0 ); // Current theta value
-		static Real64 Phi( 0.0 ); // Current phi value
-		static Real64 DTheta( 0.0 ); // Increment for theta value (Window6 type input)
-		static Real64 DPhi( 0.0 ); // Increment for phi value (Window6 type input)
-		static Real64 HalfDTheta( 0.0 ); // Half-width of all theta bins except first and last (W6 input)
-		static Real64 Lamda( 0.0 ); // Current 'Lamda' value (element weight)
-		static Real64 SolAng( 0.0 ); // Current element solid angle
-		static Real64 NextTheta( 0.0 ); // Next theta in the W6 basis after current
-		static Real64 LastTheta( 0.0 ); // Previous theta in the W6 basis before current
-		static Real64 LowerTheta( 0.0 ); // Lower theta boundary of the element
-		static Real64 UpperTheta( 0.0 ); // Upper theta boundary of the element
 		Array1D< Real64 > Thetas; // temp array holding theta values
 		Array1D_int NPhis; // temp array holding number of phis for a given theta
 
@@ -1374,11 +1642,11 @@ namespace WindowComplexManager {
 				Thetas( NThetas + 1 ) = 0.5 * Pi; //and there is an N+1st point (not a basis element) at Pi/2
 				NPhis( 1 ) = 1;
 				NumElem = 1;
-				for ( I = 2; I <= NThetas; ++I ) {
-					Thetas( I ) = Construct( IConst ).BSDFInput.BasisMat( 1, I ) * DegToRadians;
-					NPhis( I ) = std::floor( Construct( IConst ).BSDFInput.BasisMat( 2, I ) + 0.001 );
-					if ( NPhis( I ) <= 0 ) ShowFatalError( "WindowComplexManager: incorrect input, no. phis must be positive." );
-					NumElem += NPhis( I );
+				for ( ConstructBasisI = 2; ConstructBasisI <= NThetas; ++ConstructBasisI ) {
+					Thetas( ConstructBasisI ) = Construct( IConst ).BSDFInput.BasisMat( 1, ConstructBasisI ) * DegToRadians;
+					NPhis( ConstructBasisI ) = std::floor( Construct( IConst ).BSDFInput.BasisMat( 2, ConstructBasisI ) + 0.001 );
+					if ( NPhis( ConstructBasisI ) <= 0 ) ShowFatalError( "WindowComplexManager: incorrect input, no. phis must be positive." );
+					NumElem += NPhis( ConstructBasisI );
 				}
 				MaxNPhis = maxval( NPhis( {1,NThetas} ) );
 				Basis.Phis.allocate( NThetas + 1, MaxNPhis + 1 ); //N+1st Phi point (not basis element) at 2Pi
@@ -1391,45 +1659,45 @@ namespace WindowComplexManager {
 				Basis.Thetas = Thetas;
 				Basis.NPhis = NPhis;
 				ElemNo = 0;
-				for ( I = 1; I <= NThetas; ++I ) {
-					Theta = Thetas( I );
-					if ( I == 1 ) { //First theta value must always be zero
-						HalfDTheta = 0.5 * Thetas( I + 1 );
+				for ( ConstructBasisI = 1; ConstructBasisI <= NThetas; ++ConstructBasisI ) {
+					ConstructBasisTheta = Thetas( ConstructBasisI );
+					if ( ConstructBasisI == 1 ) { //First theta value must always be zero
+						HalfDTheta = 0.5 * Thetas( ConstructBasisI + 1 );
 						LastTheta = 0.0;
-						NextTheta = Thetas( I + 1 );
-						LowerTheta = 0.0;
-						UpperTheta = HalfDTheta;
-					} else if ( I > 1 && I < NThetas ) {
-						LastTheta = Thetas( I - 1 );
-						NextTheta = Thetas( I + 1 );
-						LowerTheta = UpperTheta;
-						HalfDTheta = Theta - LowerTheta;
-						UpperTheta = Theta + HalfDTheta;
-					} else if ( I == NThetas ) {
-						LastTheta = Thetas( I - 1 );
+						NextTheta = Thetas( ConstructBasisI + 1 );
+						ConstructBasisLowerTheta = 0.0;
+						ConstructBasisUpperTheta = HalfDTheta;
+					} else if ( ConstructBasisI > 1 && ConstructBasisI < NThetas ) {
+						LastTheta = Thetas( ConstructBasisI - 1 );
+						NextTheta = Thetas( ConstructBasisI + 1 );
+						ConstructBasisLowerTheta = ConstructBasisUpperTheta;
+						HalfDTheta = ConstructBasisTheta - ConstructBasisLowerTheta;
+						ConstructBasisUpperTheta = ConstructBasisTheta + HalfDTheta;
+					} else if ( ConstructBasisI == NThetas ) {
+						LastTheta = Thetas( ConstructBasisI - 1 );
 						NextTheta = 0.5 * Pi;
-						LowerTheta = UpperTheta; //It is assumed that Thetas(N) is the mean between the previous
+						ConstructBasisLowerTheta = ConstructBasisUpperTheta; //It is assumed that Thetas(N) is the mean between the previous
 						//UpperTheta and pi/2.
-						UpperTheta = 0.5 * Pi;
+						ConstructBasisUpperTheta = 0.5 * Pi;
 					}
-					DPhi = 2.0 * Pi / NPhis( I );
-					if ( I == 1 ) {
-						Lamda = Pi * pow_2( std::sin( UpperTheta ) );
-						SolAng = 2.0 * Pi * ( 1.0 - std::cos( UpperTheta ) );
+					ConstructBasisDPhi = 2.0 * Pi / NPhis( ConstructBasisI );
+					if ( ConstructBasisI == 1 ) {
+						Lamda = Pi * pow_2( std::sin( ConstructBasisUpperTheta ) );
+						SolAng = 2.0 * Pi * ( 1.0 - std::cos( ConstructBasisUpperTheta ) );
 					} else {
-						Lamda = 0.5 * DPhi * ( pow_2( std::sin( UpperTheta ) ) - pow_2( std::sin( LowerTheta ) ) ); //For W6 basis, lamda is funct of Theta and
+						Lamda = 0.5 * ConstructBasisDPhi * ( pow_2( std::sin( ConstructBasisUpperTheta ) ) - pow_2( std::sin( ConstructBasisLowerTheta ) ) ); //For W6 basis, lamda is funct of Theta and
 						// NPhis, not individual Phi
-						SolAng = DPhi * ( std::cos( LowerTheta ) - std::cos( UpperTheta ) );
+						SolAng = ConstructBasisDPhi * ( std::cos( ConstructBasisLowerTheta ) - std::cos( ConstructBasisUpperTheta ) );
 					}
-					DTheta = UpperTheta - LowerTheta;
-					Basis.Phis( I, NPhis( I ) + 1 ) = 2.0 * Pi; //Non-basis-element Phi point for table searching in Phi
-					for ( J = 1; J <= NPhis( I ); ++J ) {
+					DTheta = ConstructBasisUpperTheta - ConstructBasisLowerTheta;
+					Basis.Phis( ConstructBasisI, NPhis( ConstructBasisI ) + 1 ) = 2.0 * Pi; //Non-basis-element Phi point for table searching in Phi
+					for ( ConstructBasisJ = 1; ConstructBasisJ <= NPhis( ConstructBasisI ); ++ConstructBasisJ ) {
 						++ElemNo;
-						Basis.BasisIndex( J, I ) = ElemNo;
-						Phi = ( J - 1 ) * DPhi;
-						Basis.Phis( I, J ) = Phi; //Note: this ordering of I & J are necessary to allow Phis(Theta) to
+						Basis.BasisIndex( ConstructBasisJ, ConstructBasisI ) = ElemNo;
+						ConstructBasisPhi = ( ConstructBasisJ - 1 ) * ConstructBasisDPhi;
+						Basis.Phis( ConstructBasisI, ConstructBasisJ ) = ConstructBasisPhi; //Note: this ordering of I & J are necessary to allow Phis(Theta) to
 						//  be searched as a one-dimensional table
-						FillBasisElement( Theta, Phi, ElemNo, Basis.Grid( ElemNo ), LowerTheta, UpperTheta, DPhi, BasisType_WINDOW ); //This gets all the simple grid characteristics
+						FillBasisElement( ConstructBasisTheta, ConstructBasisPhi, ElemNo, Basis.Grid( ElemNo ), ConstructBasisLowerTheta, ConstructBasisUpperTheta, ConstructBasisDPhi, BasisType_WINDOW ); //This gets all the simple grid characteristics
 						Basis.Lamda( ElemNo ) = Lamda;
 						Basis.SolAng( ElemNo ) = SolAng;
 					}
@@ -1441,8 +1709,8 @@ namespace WindowComplexManager {
 				Thetas( NThetas + 1 ) = 0.5 * Pi; //and there is an N+1st point (not a basis element) at Pi/2
 				NPhis = 1; //As insurance, define one phi for each theta
 				NumElem = 1;
-				for ( I = 2; I <= NThetas; ++I ) {
-					Thetas( I ) = Construct( IConst ).BSDFInput.BasisMat( 1, I ) * DegToRadians;
+				for ( ConstructBasisI = 2; ConstructBasisI <= NThetas; ++ConstructBasisI ) {
+					Thetas( ConstructBasisI ) = Construct( IConst ).BSDFInput.BasisMat( 1, ConstructBasisI ) * DegToRadians;
 					++NumElem;
 				}
 				Basis.Phis.allocate( 1, NThetas );
@@ -1455,43 +1723,43 @@ namespace WindowComplexManager {
 				Basis.Thetas = Thetas;
 				Basis.NPhis = NPhis;
 				ElemNo = 0;
-				DPhi = 2.0 * Pi;
-				for ( I = 1; I <= NThetas; ++I ) {
-					Theta = Thetas( I );
-					if ( I == 1 ) { //First theta value must always be zero
-						HalfDTheta = 0.5 * Thetas( I + 1 );
+				ConstructBasisDPhi = 2.0 * Pi;
+				for ( ConstructBasisI = 1; ConstructBasisI <= NThetas; ++ConstructBasisI ) {
+					ConstructBasisTheta = Thetas( ConstructBasisI );
+					if ( ConstructBasisI == 1 ) { //First theta value must always be zero
+						HalfDTheta = 0.5 * Thetas( ConstructBasisI + 1 );
 						LastTheta = 0.0;
-						NextTheta = Thetas( I + 1 );
-						LowerTheta = 0.0;
-						UpperTheta = HalfDTheta;
-					} else if ( I > 1 && I < NThetas ) {
-						LastTheta = Thetas( I - 1 );
-						NextTheta = Thetas( I + 1 );
-						LowerTheta = UpperTheta;
-						HalfDTheta = Theta - LowerTheta;
-						UpperTheta = Theta + HalfDTheta;
-					} else if ( I == NThetas ) {
-						LastTheta = Thetas( I - 1 );
+						NextTheta = Thetas( ConstructBasisI + 1 );
+						ConstructBasisLowerTheta = 0.0;
+						ConstructBasisUpperTheta = HalfDTheta;
+					} else if ( ConstructBasisI > 1 && ConstructBasisI < NThetas ) {
+						LastTheta = Thetas( ConstructBasisI - 1 );
+						NextTheta = Thetas( ConstructBasisI + 1 );
+						ConstructBasisLowerTheta = ConstructBasisUpperTheta;
+						HalfDTheta = ConstructBasisTheta - ConstructBasisLowerTheta;
+						ConstructBasisUpperTheta = ConstructBasisTheta + HalfDTheta;
+					} else if ( ConstructBasisI == NThetas ) {
+						LastTheta = Thetas( ConstructBasisI - 1 );
 						NextTheta = 0.5 * Pi;
-						LowerTheta = UpperTheta; //It is assumed that Thetas(N) is the mean between the previous
+						ConstructBasisLowerTheta = ConstructBasisUpperTheta; //It is assumed that Thetas(N) is the mean between the previous
 						//UpperTheta and pi/2.
-						UpperTheta = 0.5 * Pi;
+						ConstructBasisUpperTheta = 0.5 * Pi;
 					}
-					if ( I == 1 ) {
-						Lamda = Pi * pow_2( std::sin( UpperTheta ) );
-						SolAng = 2.0 * Pi * ( 1.0 - std::cos( UpperTheta ) );
+					if ( ConstructBasisI == 1 ) {
+						Lamda = Pi * pow_2( std::sin( ConstructBasisUpperTheta ) );
+						SolAng = 2.0 * Pi * ( 1.0 - std::cos( ConstructBasisUpperTheta ) );
 					} else {
-						Lamda = 0.5 * DPhi * ( pow_2( std::sin( UpperTheta ) ) - pow_2( std::sin( LowerTheta ) ) ); //For W6 basis, lamda is funct of Theta and
+						Lamda = 0.5 * ConstructBasisDPhi * ( pow_2( std::sin( ConstructBasisUpperTheta ) ) - pow_2( std::sin( ConstructBasisLowerTheta ) ) ); //For W6 basis, lamda is funct of Theta and
 						// NPhis, not individual Phi
-						SolAng = DPhi * ( std::cos( LowerTheta ) - std::cos( UpperTheta ) );
+						SolAng = ConstructBasisDPhi * ( std::cos( ConstructBasisLowerTheta ) - std::cos( ConstructBasisUpperTheta ) );
 					}
-					DTheta = UpperTheta - LowerTheta;
+					DTheta = ConstructBasisUpperTheta - ConstructBasisLowerTheta;
 					++ElemNo;
-					Basis.BasisIndex( 1, I ) = ElemNo;
-					Phi = 0.0;
-					Basis.Phis( I, 1 ) = Phi; //Note: this ordering of I & J are necessary to allow Phis(Theta) to
+					Basis.BasisIndex( 1, ConstructBasisI ) = ElemNo;
+					ConstructBasisPhi = 0.0;
+					Basis.Phis( ConstructBasisI, 1 ) = ConstructBasisPhi; //Note: this ordering of I & J are necessary to allow Phis(Theta) to
 					//  be searched as a one-dimensional table
-					FillBasisElement( Theta, Phi, ElemNo, Basis.Grid( ElemNo ), LowerTheta, UpperTheta, DPhi, BasisType_WINDOW ); //This gets all the simple grid characteristics
+					FillBasisElement( ConstructBasisTheta, ConstructBasisPhi, ElemNo, Basis.Grid( ElemNo ), ConstructBasisLowerTheta, ConstructBasisUpperTheta, ConstructBasisDPhi, BasisType_WINDOW ); //This gets all the simple grid characteristics
 					Basis.Lamda( ElemNo ) = Lamda;
 					Basis.SolAng( ElemNo ) = SolAng;
 				}
@@ -2040,11 +2308,6 @@ namespace WindowComplexManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int IConst; // Pointer to construction for this fenestration
-		static int I( 0 ); // general purpose index
-		static int J( 0 ); // general purpose index
-		static int JJ( 0 ); // general purpose index--ray
-		static int L( 0 ); // general purpose index--layer
-		static int M( 0 ); // general purpose index--ray
 		int KBkSurf; // back surface index
 		int JSurf; // surface number (used for back surface)
 		int BaseSurf; // base surface number (used for finding back surface)
@@ -2059,10 +2322,10 @@ namespace WindowComplexManager {
 
 		Sum1 = 0.0;
 		Sum2 = 0.0;
-		for ( J = 1; J <= Geom.Inc.NBasis; ++J ) { //Incident ray loop
-			Sum2 += Geom.Inc.Lamda( J );
+		for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= Geom.Inc.NBasis; ++CalcWindowStaticPropertiesJ ) { //Incident ray loop
+			Sum2 += Geom.Inc.Lamda( CalcWindowStaticPropertiesJ );
 			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { //Outgoing ray loop
-				Sum1 += Geom.Inc.Lamda( J ) * Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.SolFrtTrans( M, J );
+				Sum1 += Geom.Inc.Lamda( CalcWindowStaticPropertiesJ ) * Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.SolFrtTrans( M, CalcWindowStaticPropertiesJ );
 			} //Outgoing ray loop
 		} //Incident ray loop
 		if ( Sum2 > 0 ) {
@@ -2076,10 +2339,10 @@ namespace WindowComplexManager {
 
 		Sum1 = 0.0;
 		Sum2 = 0.0;
-		for ( J = 1; J <= Geom.Inc.NBasis; ++J ) { //Incident ray loop
-			Sum2 += Geom.Inc.Lamda( J );
+		for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= Geom.Inc.NBasis; ++CalcWindowStaticPropertiesJ ) { //Incident ray loop
+			Sum2 += Geom.Inc.Lamda( CalcWindowStaticPropertiesJ );
 			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { //Outgoing ray loop
-				Sum1 += Geom.Inc.Lamda( J ) * Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.VisFrtTrans( M, J );
+				Sum1 += Geom.Inc.Lamda( CalcWindowStaticPropertiesJ ) * Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.VisFrtTrans( M, CalcWindowStaticPropertiesJ );
 			} //Outgoing ray loop
 		} //Incident ray loop
 		if ( Sum2 > 0.0 ) {
@@ -2098,13 +2361,13 @@ namespace WindowComplexManager {
 		Sum3 = 0.0;
 		for ( JJ = 1; JJ <= Geom.NSky; ++JJ ) {
 			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) {
-				J = Geom.SkyIndex( JJ );
-				Sum1 += Geom.SolSkyWt( JJ ) * Construct( IConst ).BSDFInput.SolFrtTrans( M, J ) * Geom.Inc.Lamda( J ) * Geom.Trn.Lamda( M );
+				CalcWindowStaticPropertiesJ = Geom.SkyIndex( JJ );
+				Sum1 += Geom.SolSkyWt( JJ ) * Construct( IConst ).BSDFInput.SolFrtTrans( M, CalcWindowStaticPropertiesJ ) * Geom.Inc.Lamda( CalcWindowStaticPropertiesJ ) * Geom.Trn.Lamda( M );
 			}
 		}
 		for ( JJ = 1; JJ <= Geom.NSky; ++JJ ) {
-			J = Geom.SkyIndex( JJ );
-			Sum2 += Geom.SolSkyWt( JJ ) * Geom.Inc.Lamda( J );
+			CalcWindowStaticPropertiesJ = Geom.SkyIndex( JJ );
+			Sum2 += Geom.SolSkyWt( JJ ) * Geom.Inc.Lamda( CalcWindowStaticPropertiesJ );
 		}
 
 		if ( Sum2 != 0.0 ) {
@@ -2118,8 +2381,8 @@ namespace WindowComplexManager {
 		for ( L = 1; L <= State.NLayers; ++L ) {
 			Sum3 = 0.0;
 			for ( JJ = 1; JJ <= Geom.NSky; ++JJ ) {
-				J = Geom.SkyIndex( JJ );
-				Sum3 += Geom.SolSkyWt( JJ ) * Geom.Inc.Lamda( J ) * Construct( IConst ).BSDFInput.Layer( L ).FrtAbs( J, 1 );
+				CalcWindowStaticPropertiesJ = Geom.SkyIndex( JJ );
+				Sum3 += Geom.SolSkyWt( JJ ) * Geom.Inc.Lamda( CalcWindowStaticPropertiesJ ) * Construct( IConst ).BSDFInput.Layer( L ).FrtAbs( CalcWindowStaticPropertiesJ, 1 );
 			}
 
 			if ( Sum2 != 0.0 ) {
@@ -2141,14 +2404,14 @@ namespace WindowComplexManager {
 
 		for ( JJ = 1; JJ <= Geom.NGnd; ++JJ ) {
 			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) {
-				J = Geom.GndIndex( JJ );
-				Sum1 += Geom.SolSkyGndWt( JJ ) * Construct( IConst ).BSDFInput.SolFrtTrans( M, J ) * Geom.Inc.Lamda( J ) * Geom.Trn.Lamda( M );
+				CalcWindowStaticPropertiesJ = Geom.GndIndex( JJ );
+				Sum1 += Geom.SolSkyGndWt( JJ ) * Construct( IConst ).BSDFInput.SolFrtTrans( M, CalcWindowStaticPropertiesJ ) * Geom.Inc.Lamda( CalcWindowStaticPropertiesJ ) * Geom.Trn.Lamda( M );
 			}
 		}
 
 		for ( JJ = 1; JJ <= Geom.NGnd; ++JJ ) {
-			J = Geom.GndIndex( JJ );
-			Sum2 += Geom.SolSkyGndWt( JJ ) * Geom.Inc.Lamda( J );
+			CalcWindowStaticPropertiesJ = Geom.GndIndex( JJ );
+			Sum2 += Geom.SolSkyGndWt( JJ ) * Geom.Inc.Lamda( CalcWindowStaticPropertiesJ );
 		}
 
 		if ( Sum2 != 0.0 ) {
@@ -2161,8 +2424,8 @@ namespace WindowComplexManager {
 		for ( L = 1; L <= State.NLayers; ++L ) {
 			Sum3 = 0.0;
 			for ( JJ = 1; JJ <= Geom.NGnd; ++JJ ) {
-				J = Geom.GndIndex( JJ );
-				Sum3 += Geom.SolSkyGndWt( JJ ) * Geom.Inc.Lamda( J ) * Construct( IConst ).BSDFInput.Layer( L ).FrtAbs( J, 1 );
+				CalcWindowStaticPropertiesJ = Geom.GndIndex( JJ );
+				Sum3 += Geom.SolSkyGndWt( JJ ) * Geom.Inc.Lamda( CalcWindowStaticPropertiesJ ) * Construct( IConst ).BSDFInput.Layer( L ).FrtAbs( CalcWindowStaticPropertiesJ, 1 );
 			}
 
 			if ( Sum2 != 0.0 ) {
@@ -2178,13 +2441,13 @@ namespace WindowComplexManager {
 		Sum3 = 0.0;
 		//Note this again assumes the equivalence Inc basis = transmission basis for back incidence and
 		// Trn basis = incident basis for back incidence
-		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
+		for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= Geom.Trn.NBasis; ++CalcWindowStaticPropertiesJ ) {
 			for ( M = 1; M <= Geom.Inc.NBasis; ++M ) {
-				Sum1 += Construct( IConst ).BSDFInput.SolBkRefl( M, J ) * Geom.Trn.Lamda( J ) * Geom.Inc.Lamda( M );
+				Sum1 += Construct( IConst ).BSDFInput.SolBkRefl( M, CalcWindowStaticPropertiesJ ) * Geom.Trn.Lamda( CalcWindowStaticPropertiesJ ) * Geom.Inc.Lamda( M );
 			}
 		}
-		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-			Sum2 += Geom.Trn.Lamda( J );
+		for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= Geom.Trn.NBasis; ++CalcWindowStaticPropertiesJ ) {
+			Sum2 += Geom.Trn.Lamda( CalcWindowStaticPropertiesJ );
 		}
 
 		if ( Sum2 != 0.0 ) {
@@ -2197,8 +2460,8 @@ namespace WindowComplexManager {
 
 		State.WinBkHemAbs.allocate( State.NLayers );
 		for ( L = 1; L <= State.NLayers; ++L ) {
-			for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-				Sum3 += Geom.Trn.Lamda( J ) * Construct( IConst ).BSDFInput.Layer( L ).BkAbs( J, 1 );
+			for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= Geom.Trn.NBasis; ++CalcWindowStaticPropertiesJ ) {
+				Sum3 += Geom.Trn.Lamda( CalcWindowStaticPropertiesJ ) * Construct( IConst ).BSDFInput.Layer( L ).BkAbs( CalcWindowStaticPropertiesJ, 1 );
 			}
 
 			if ( Sum2 != 0.0 ) {
@@ -2214,14 +2477,14 @@ namespace WindowComplexManager {
 		//Calculate Window Layer Front Hemispherical Absorptance
 		Sum1 = 0.0;
 		Sum2 = 0.0;
-		for ( J = 1; J <= Geom.Inc.NBasis; ++J ) {
-			Sum2 += Geom.Inc.Lamda( J );
+		for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= Geom.Inc.NBasis; ++CalcWindowStaticPropertiesJ ) {
+			Sum2 += Geom.Inc.Lamda( CalcWindowStaticPropertiesJ );
 		}
 		State.WinFtHemAbs.allocate( State.NLayers );
 		for ( L = 1; L <= State.NLayers; ++L ) {
 			Sum1 = 0.0;
-			for ( J = 1; J <= Geom.Inc.NBasis; ++J ) {
-				Sum1 += Geom.Inc.Lamda( J ) * Construct( IConst ).BSDFInput.Layer( L ).FrtAbs( J, 1 );
+			for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= Geom.Inc.NBasis; ++CalcWindowStaticPropertiesJ ) {
+				Sum1 += Geom.Inc.Lamda( CalcWindowStaticPropertiesJ ) * Construct( IConst ).BSDFInput.Layer( L ).FrtAbs( CalcWindowStaticPropertiesJ, 1 );
 			}
 
 			if ( Sum2 != 0.0 ) {
@@ -2239,13 +2502,13 @@ namespace WindowComplexManager {
 		Sum2 = 0.0;
 		//Note this again assumes the equivalence Inc basis = transmission basis for back incidence and
 		// Trn basis = incident basis for back incidence
-		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
+		for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= Geom.Trn.NBasis; ++CalcWindowStaticPropertiesJ ) {
 			for ( M = 1; M <= Geom.Inc.NBasis; ++M ) {
-				Sum1 += Construct( IConst ).BSDFInput.VisBkRefl( M, J ) * Geom.Trn.Lamda( J ) * Geom.Inc.Lamda( M );
+				Sum1 += Construct( IConst ).BSDFInput.VisBkRefl( M, CalcWindowStaticPropertiesJ ) * Geom.Trn.Lamda( CalcWindowStaticPropertiesJ ) * Geom.Inc.Lamda( M );
 			}
 		}
-		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-			Sum2 += Geom.Trn.Lamda( J );
+		for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= Geom.Trn.NBasis; ++CalcWindowStaticPropertiesJ ) {
+			Sum2 += Geom.Trn.Lamda( CalcWindowStaticPropertiesJ );
 		}
 
 		if ( Sum2 != 0.0 ) {
@@ -2287,23 +2550,23 @@ namespace WindowComplexManager {
 			//  Directional-hemispherical back reflectance
 			Sum1 = 0.0;
 			Sum2 = 0.0;
-			for ( J = 1; J <= Geom.NSurfInt( KBkSurf ); ++J ) { //Inc Ray loop
-				Sum2 += Geom.Trn.Lamda( Geom.SurfInt( J, KBkSurf ) );
+			for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= Geom.NSurfInt( KBkSurf ); ++CalcWindowStaticPropertiesJ ) { //Inc Ray loop
+				Sum2 += Geom.Trn.Lamda( Geom.SurfInt( CalcWindowStaticPropertiesJ, KBkSurf ) );
 				for ( M = 1; M <= Geom.Inc.NBasis; ++M ) { //Outgoing Ray loop
-					Sum1 += Geom.Trn.Lamda( Geom.SurfInt( J, KBkSurf ) ) * Geom.Inc.Lamda( M ) * Construct( IConst ).BSDFInput.SolBkRefl( Geom.SurfInt( J, KBkSurf ), M );
+					Sum1 += Geom.Trn.Lamda( Geom.SurfInt( CalcWindowStaticPropertiesJ, KBkSurf ) ) * Geom.Inc.Lamda( M ) * Construct( IConst ).BSDFInput.SolBkRefl( Geom.SurfInt( CalcWindowStaticPropertiesJ, KBkSurf ), M );
 				} //Outgoing Ray loop
 			} //Inc Ray loop
 			if ( Sum2 > 0.0 ) {
 				Hold = Sum1 / Sum2;
-				for ( I = 1; I <= 24; ++I ) {
-					for ( J = 1; J <= NumOfTimeStepInHour; ++J ) {
-						State.BkSurf( KBkSurf ).WinDHBkRefl( I, J ) = Hold;
+				for ( CalcWindowStaticPropertiesI = 1; CalcWindowStaticPropertiesI <= 24; ++CalcWindowStaticPropertiesI ) {
+					for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= NumOfTimeStepInHour; ++CalcWindowStaticPropertiesJ ) {
+						State.BkSurf( KBkSurf ).WinDHBkRefl( CalcWindowStaticPropertiesI, CalcWindowStaticPropertiesJ ) = Hold;
 					}
 				}
 			} else {
-				for ( I = 1; I <= 24; ++I ) {
-					for ( J = 1; J <= NumOfTimeStepInHour; ++J ) {
-						State.BkSurf( KBkSurf ).WinDHBkRefl( I, J ) = 0.0;
+				for ( CalcWindowStaticPropertiesI = 1; CalcWindowStaticPropertiesI <= 24; ++CalcWindowStaticPropertiesI ) {
+					for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= NumOfTimeStepInHour; ++CalcWindowStaticPropertiesJ ) {
+						State.BkSurf( KBkSurf ).WinDHBkRefl( CalcWindowStaticPropertiesI, CalcWindowStaticPropertiesJ ) = 0.0;
 					}
 				}
 			}
@@ -2312,21 +2575,21 @@ namespace WindowComplexManager {
 			for ( L = 1; L <= State.NLayers; ++L ) { //layer loop
 				Sum1 = 0.0;
 				Sum2 = 0.0;
-				for ( J = 1; J <= Geom.NSurfInt( KBkSurf ); ++J ) { //Inc Ray loop
-					Sum2 += Geom.Trn.Lamda( Geom.SurfInt( J, KBkSurf ) );
-					Sum1 += Geom.Trn.Lamda( Geom.SurfInt( J, KBkSurf ) ) * Construct( IConst ).BSDFInput.Layer( L ).BkAbs( Geom.SurfInt( J, KBkSurf ), 1 );
+				for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= Geom.NSurfInt( KBkSurf ); ++CalcWindowStaticPropertiesJ ) { //Inc Ray loop
+					Sum2 += Geom.Trn.Lamda( Geom.SurfInt( CalcWindowStaticPropertiesJ, KBkSurf ) );
+					Sum1 += Geom.Trn.Lamda( Geom.SurfInt( CalcWindowStaticPropertiesJ, KBkSurf ) ) * Construct( IConst ).BSDFInput.Layer( L ).BkAbs( Geom.SurfInt( CalcWindowStaticPropertiesJ, KBkSurf ), 1 );
 				} //Inc Ray loop
 				if ( Sum2 > 0.0 ) {
 					Hold = Sum1 / Sum2;
-					for ( I = 1; I <= 24; ++I ) {
-						for ( J = 1; J <= NumOfTimeStepInHour; ++J ) {
-							State.BkSurf( KBkSurf ).WinDirBkAbs( I, J, L ) = Hold;
+					for ( CalcWindowStaticPropertiesI = 1; CalcWindowStaticPropertiesI <= 24; ++CalcWindowStaticPropertiesI ) {
+						for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= NumOfTimeStepInHour; ++CalcWindowStaticPropertiesJ ) {
+							State.BkSurf( KBkSurf ).WinDirBkAbs( CalcWindowStaticPropertiesI, CalcWindowStaticPropertiesJ, L ) = Hold;
 						}
 					}
 				} else {
-					for ( I = 1; I <= 24; ++I ) {
-						for ( J = 1; J <= NumOfTimeStepInHour; ++J ) {
-							State.BkSurf( KBkSurf ).WinDirBkAbs( I, J, L ) = 0.0;
+					for ( CalcWindowStaticPropertiesI = 1; CalcWindowStaticPropertiesI <= 24; ++CalcWindowStaticPropertiesI ) {
+						for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= NumOfTimeStepInHour; ++CalcWindowStaticPropertiesJ ) {
+							State.BkSurf( KBkSurf ).WinDirBkAbs( CalcWindowStaticPropertiesI, CalcWindowStaticPropertiesJ, L ) = 0.0;
 						}
 					}
 				}
@@ -2340,28 +2603,28 @@ namespace WindowComplexManager {
 
 		// Sum of front absorptances for each incident direction (integration of absorptances)
 		if ( ! allocated( State.IntegratedFtAbs ) ) State.IntegratedFtAbs.allocate( Geom.Inc.NBasis );
-		for ( J = 1; J <= Geom.Inc.NBasis; ++J ) {
+		for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= Geom.Inc.NBasis; ++CalcWindowStaticPropertiesJ ) {
 			Sum1 = 0.0;
 			for ( L = 1; L <= State.NLayers; ++L ) { //layer loop
-				Sum1 += Construct( IConst ).BSDFInput.Layer( L ).FrtAbs( J, 1 );
+				Sum1 += Construct( IConst ).BSDFInput.Layer( L ).FrtAbs( CalcWindowStaticPropertiesJ, 1 );
 			}
-			State.IntegratedFtAbs( J ) = Sum1;
+			State.IntegratedFtAbs( CalcWindowStaticPropertiesJ ) = Sum1;
 		}
 
 		// Integrating front transmittance
 		if ( ! allocated( State.IntegratedFtTrans ) ) State.IntegratedFtTrans.allocate( Geom.Inc.NBasis );
-		for ( J = 1; J <= Geom.Inc.NBasis; ++J ) { // Incident ray loop
+		for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= Geom.Inc.NBasis; ++CalcWindowStaticPropertiesJ ) { // Incident ray loop
 			Sum1 = 0.0;
 			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { // Outgoing ray loop
-				Sum1 += Geom.Trn.Lamda( J ) * Construct( IConst ).BSDFInput.SolFrtTrans( J, M );
+				Sum1 += Geom.Trn.Lamda( CalcWindowStaticPropertiesJ ) * Construct( IConst ).BSDFInput.SolFrtTrans( CalcWindowStaticPropertiesJ, M );
 			} // Outgoing ray loop
-			State.IntegratedFtTrans( J ) = Sum1;
+			State.IntegratedFtTrans( CalcWindowStaticPropertiesJ ) = Sum1;
 		} // Incident ray loop
 
 		if ( ! allocated( State.IntegratedFtRefl ) ) State.IntegratedFtRefl.allocate( Geom.Inc.NBasis );
 		// Integrating front reflectance
-		for ( J = 1; J <= Geom.Inc.NBasis; ++J ) { // Incoming ray loop
-			State.IntegratedFtRefl( J ) = 1 - State.IntegratedFtTrans( J ) - State.IntegratedFtAbs( J );
+		for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= Geom.Inc.NBasis; ++CalcWindowStaticPropertiesJ ) { // Incoming ray loop
+			State.IntegratedFtRefl( CalcWindowStaticPropertiesJ ) = 1 - State.IntegratedFtTrans( CalcWindowStaticPropertiesJ ) - State.IntegratedFtAbs( CalcWindowStaticPropertiesJ );
 		} //Incoming ray loop
 
 		// ********************************************************************************
@@ -2370,30 +2633,67 @@ namespace WindowComplexManager {
 
 		// Sum of back absorptances for each incident direction (integration of absorptances)
 		if ( ! allocated( State.IntegratedBkAbs ) ) State.IntegratedBkAbs.allocate( Geom.Trn.NBasis );
-		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
+		for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= Geom.Trn.NBasis; ++CalcWindowStaticPropertiesJ ) {
 			Sum1 = 0.0;
 			for ( L = 1; L <= State.NLayers; ++L ) { //layer loop
-				Sum1 += Construct( IConst ).BSDFInput.Layer( L ).BkAbs( J, 1 );
+				Sum1 += Construct( IConst ).BSDFInput.Layer( L ).BkAbs( CalcWindowStaticPropertiesJ, 1 );
 			}
-			State.IntegratedBkAbs( J ) = Sum1;
+			State.IntegratedBkAbs( CalcWindowStaticPropertiesJ ) = Sum1;
 		}
 
 		// Integrating back reflectance
 		if ( ! allocated( State.IntegratedBkRefl ) ) State.IntegratedBkRefl.allocate( Geom.Trn.NBasis );
-		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) { // Outgoing ray loop
+		for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= Geom.Trn.NBasis; ++CalcWindowStaticPropertiesJ ) { // Outgoing ray loop
 			Sum1 = 0.0;
 			for ( M = 1; M <= Geom.Inc.NBasis; ++M ) { // Incident ray loop
-				Sum1 += Geom.Inc.Lamda( J ) * Construct( IConst ).BSDFInput.SolBkRefl( J, M );
+				Sum1 += Geom.Inc.Lamda( CalcWindowStaticPropertiesJ ) * Construct( IConst ).BSDFInput.SolBkRefl( CalcWindowStaticPropertiesJ, M );
 			} //Incident ray loop
-			State.IntegratedBkRefl( J ) = Sum1;
+			State.IntegratedBkRefl( CalcWindowStaticPropertiesJ ) = Sum1;
 		} //Outgoing ray loop
 
 		if ( ! allocated( State.IntegratedBkTrans ) ) State.IntegratedBkTrans.allocate( Geom.Trn.NBasis );
 		// Integrating back transmittance
-		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) { // Outgoing ray loop
-			State.IntegratedBkTrans( J ) = 1 - State.IntegratedBkRefl( J ) - State.IntegratedBkAbs( J );
+		for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= Geom.Trn.NBasis; ++CalcWindowStaticPropertiesJ ) { // Outgoing ray loop
+			State.IntegratedBkTrans( CalcWindowStaticPropertiesJ ) = 1 - State.IntegratedBkRefl( CalcWindowStaticPropertiesJ ) - State.IntegratedBkAbs( CalcWindowStaticPropertiesJ );
 		} //Outgoing ray loop
 
+		// ********************************************************************************
+		// Products of the property matrices with the basis lambda values for each incident direction,
+		// used by CalculateWindowBeamProperties for every hour and time step
+		// ********************************************************************************
+
+		// Beam transmittance to each back surface and directional-hemispherical transmittance
+		auto const & SolFrtTrans( Construct( IConst ).BSDFInput.SolFrtTrans );
+		State.IncBkSurfTrans.dimension( Geom.Inc.NBasis, Window.NBkSurf, 0.0 );
+		State.IncDirHemiTrans.dimension( Geom.Inc.NBasis, 0.0 );
+		for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= Geom.Inc.NBasis; ++CalcWindowStaticPropertiesJ ) { // Incident ray loop
+			for ( CalcWindowStaticPropertiesI = 1; CalcWindowStaticPropertiesI <= Window.NBkSurf; ++CalcWindowStaticPropertiesI ) { // Back surface loop
+				Sum1 = 0.0;
+				for ( M = 1; M <= Geom.NSurfInt( CalcWindowStaticPropertiesI ); ++M ) { // Ray loop
+					Sum1 += Geom.Trn.Lamda( Geom.SurfInt( M, CalcWindowStaticPropertiesI ) ) * SolFrtTrans( CalcWindowStaticPropertiesJ, Geom.SurfInt( M, CalcWindowStaticPropertiesI ) );
+				} // Ray loop
+				State.IncBkSurfTrans( CalcWindowStaticPropertiesJ, CalcWindowStaticPropertiesI ) = Sum1;
+			} // Back surface loop
+			Sum1 = 0.0;
+			std::size_t l( SolFrtTrans.index( CalcWindowStaticPropertiesJ, 1 ) ); // Linear index for ( J, M )
+			for ( M = 1; M <= Geom.Trn.NBasis; ++M, ++l ) { // Outgoing ray loop
+				Sum1 += Geom.Trn.Lamda[ M - 1 ] * SolFrtTrans[ l ];
+			} // Outgoing ray loop
+			State.IncDirHemiTrans( CalcWindowStaticPropertiesJ ) = Sum1;
+		} // Incident ray loop
+
+		// Directional-hemispherical back reflectance
+		auto const & SolBkRefl( Construct( IConst ).BSDFInput.SolBkRefl );
+		State.BkIncDirHemiRefl.dimension( Geom.Trn.NBasis, 0.0 );
+		for ( CalcWindowStaticPropertiesJ = 1; CalcWindowStaticPropertiesJ <= Geom.Trn.NBasis; ++CalcWindowStaticPropertiesJ ) { // Back incident ray loop
+			Sum1 = 0.0;
+			std::size_t l( SolBkRefl.index( CalcWindowStaticPropertiesJ, 1 ) ); // Linear index for ( J, M )
+			for ( M = 1; M <= Geom.Trn.NBasis; ++M, ++l ) { // Outgoing ray loop
+				Sum1 += Geom.Trn.Lamda[ M - 1 ] * SolBkRefl[ l ];
+			} // Outgoing ray loop
+			State.BkIncDirHemiRefl( CalcWindowStaticPropertiesJ ) = Sum1;
+		} // Back incident ray loop
+
 	}
 
 	Real64
@@ -3018,42 +3318,15 @@ namespace WindowComplexManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		// TARCOG Inputs:
-		static int nlayer( 0 ); // Number of glazing layers
-		static int iwd( 0 ); // Wind direction:  0 - windward, 1 - leeward
-		static Real64 tout( 0.0 ); // Outdoor temperature [K]
-		static Real64 tind( 0.0 ); // Indoor temperature [K]
-		static Real64 trmin( 0.0 ); // Indoor mean radiant temperature [K]
-		static Real64 wso( 0.0 ); // Outdoor wind speed [m/s]
-		static Real64 wsi( 0.0 ); // Inside forced air speed [m/s]
-		static Real64 dir( 0.0 ); // Direct solar radiation [W/m^2]
-		static int isky( 0 ); // Flag for sky temperature (Tsky) and sky emittance (esky)
 		//                      0 - both tsky and esky are specified
 		//                      1 - tsky specified, esky = 1
 		//                      2 - Swinbank model for effective sky emittance
-		static Real64 tsky( 0.0 ); // Night sky temperature [K]
-		static Real64 esky( 0.0 ); // Effective night sky emittance
-		static Real64 fclr( 0.0 ); // Fraction of sky that is clear
 		Real64 VacuumPressure; // maximal pressure for gas to be considered as vacuum [Pa]
 		Real64 VacuumMaxGapThickness; // maximal gap thickness for which vacuum calculation will work without issuing
 		// warning message
-		static Array1D< Real64 > gap( maxlay, 0.0 ); // Vector of gap widths [m] {maxlay}
-		static Array1D< Real64 > thick( maxlay, 0.0 ); // Vector of glass thicknesses [m] {maxlay}
-		static Array1D< Real64 > scon( maxlay, 0.0 ); // Vector of conductivities of each glazing layer  [W/m.K] {maxlay}
-		static Array1D< Real64 > tir( maxlay*2, 0.0 ); // Vector of IR transmittances of each layer {2*maxlay - 2 surfaces per layer}
-		static Array1D< Real64 > emis( maxlay*2, 0.0 ); // Vector of IR emittances of each surface {2*maxlay - 2 surfaces per layer}
-		static Array1D_int SupportPlr( maxlay, 0 ); // Shows whether or not gap have support pillar
 		// 0 - does not have support pillar
 		// 1 - have support pillar
-		static Array1D< Real64 > PillarSpacing( maxlay, 0.0 ); // Pillar spacing for each gap (used in case there is support pillar)
-		static Array1D< Real64 > PillarRadius( maxlay, 0.0 ); // Pillar radius for each gap (used in case there is support pillar)
 
-		static Real64 totsol( 0.0 ); // Total solar transmittance of the IGU
-		static Real64 tilt( 0.0 ); // Window tilt [degrees]
-		static Array1D< Real64 > asol( maxlay, 0.0 ); // Vector of Absorbed solar energy fractions for each layer {maxlay}
-		static Real64 height( 0.0 ); // IGU cavity height [m]
-		static Real64 heightt( 0.0 ); // Total window height [m]
-		static Real64 width( 0.0 ); // Window width [m]
-		static Array1D< Real64 > presure( maxlay+1, 0.0 ); // Vector of gas pressures in gaps [N/m^2] {maxlay+1}
 
 		//Deflection
 		//Tarcog requires deflection as input parameters.  Deflection is NOT used in EnergyPlus simulations
@@ -3064,28 +3337,12 @@ namespace WindowComplexManager {
 		Real64 Pa; // Atmospheric (outside/inside) pressure (used onlu if CalcDeflection = 1)
 		Real64 Pini; // Initial presssure at time of fabrication (used only if CalcDeflection = 1)
 		Real64 Tini; // Initial temperature at time of fabrication (used only if CalcDeflection = 1)
-		static Array1D< Real64 > GapDefMax( maxlay-1, 0.0 ); // Vector of gap widths in deflected state.  It will be used as input
 		// if CalcDeflection = 2. In case CalcDeflection = 1 it will return recalculated
 		// gap widths. [m]
-		static Array1D< Real64 > YoungsMod( maxlay, 0.0 ); // Vector of Young's modulus. [m]
-		static Array1D< Real64 > PoissonsRat( maxlay, 0.0 ); // Vector of Poisson's Ratios. [m]
-		static Array1D< Real64 > LayerDef( maxlay, 0.0 ); // Vector of layers deflection. [m]
 
-		static Array2D_int iprop( maxgas, maxlay+1, 1 ); // Matrix of gas codes - see above {maxgap x maxgas}
-		static Array2D< Real64 > frct( maxgas, maxlay+1, 0.0 ); // Matrix of mass percentages in gap mixtures  {maxgap x maxgas}
-		static Array2D< Real64 > gcon( 3, maxgas, 0.0 ); // Matrix of constants for gas conductivity calc
 		//     (A, B, C for max of 10 gasses) {maxgas x 3}
-		static Array2D< Real64 > gvis( 3, maxgas, 0.0 ); // Matrix of constants for gas dynamic viscosity calc
 		//     (A, B, C for max of 10 gasses) {maxgas x 3}
-		static Array2D< Real64 > gcp( 3, maxgas, 0.0 ); // Matrix of constants for gas specific heat calc at constant pressure
 		//     (A, B, C for max of 10 gasses) {maxgas x 3}
-		static Array1D< Real64 > wght( maxgas, 0.0 ); // Vector of Molecular weights for gasses {maxgas}
-		static Array1D< Real64 > gama( maxgas, 0.0 ); // Vector of spefic heat ration for low pressure calc {maxgas}
-		static bool feedData( false ); // flag to notify if data needs to be feed into gas arrays
-		static Array1D_int nmix( maxlay+1, 0 ); // Vector of number of gasses in gas mixture of each gap {maxlay+1}
-		static Real64 hin( 0.0 ); // Indoor combined film coefficient (if non-zero) [W/m^2.K]
-		static Real64 hout( 0.0 ); // Outdoor combined film coefficient (if non-zero) [W/m^2.K]
-		static Array1D_int ibc( 2, 0 ); // Vector of boundary condition flags (ibc(1) - outdoor, ibc(2) - indoor)
 		//             0 - h to be calculated;
 		//             1 - combined film coefficient (h) prescribed;
 		//             2 - convective film coefficient (hc) prescribed.
@@ -3094,53 +3351,27 @@ namespace WindowComplexManager {
 		//             -1  - old SPC142 correlation
 		//             -2  - Klems-Yazdanian correlation (applicable to outdoor only)
 		//             -3  - Kimura correlation (applicable to outdoor only)
-		static Array1D< Real64 > Atop( maxlay, 0.0 ); // Vector with areas of top openings - between SD layers and top of
 		//               glazing cavity, for each layer [m^2] {maxlay} *
-		static Array1D< Real64 > Abot( maxlay, 0.0 ); // Vector with areas of bottom openings - between SD layers
 		//               and bottom of glazing cavity [m^2] {maxlay}
-		static Array1D< Real64 > Al( maxlay, 0.0 ); // Vector with areas of left-hand side openings - between SD layers
 		//               and left end of glazing cavity [m^2] {maxlay}
-		static Array1D< Real64 > Ar( maxlay, 0.0 ); // Vector of areas of right-hand side openings - between SD layers
 		//               and right end of glazing cavity [m^2] {maxlay}
-		static Array1D< Real64 > Ah( maxlay, 0.0 ); // Vector of total areas of holes for each SD [m^2] {maxlay}
-		static Array1D< Real64 > SlatThick( maxlay, 0.0 ); // Thickness of the slat material [m] {maxlay} **
-		static Array1D< Real64 > SlatWidth( maxlay, 0.0 ); // Slat width [m] {maxlay}
-		static Array1D< Real64 > SlatAngle( maxlay, 0.0 ); // Slat tilt angle [deg] {maxlay}
-		static Array1D< Real64 > SlatCond( maxlay, 0.0 ); // Conductivity of the slat material [W/m.K] {maxlay}
-		static Array1D< Real64 > SlatSpacing( maxlay, 0.0 ); // Distance between slats [m] {maxlay}
-		static Array1D< Real64 > SlatCurve( maxlay, 0.0 ); // Curvature radius of the slat [m] {maxlay}
-		static Array1D< Real64 > vvent( maxlay+1, 0.0 ); // Vector of velocities for forced ventilation, for each gap, and for
 		//               outdoor and indoor environment [m/s] {maxlay+1} ***
-		static Array1D< Real64 > tvent( maxlay+1, 0.0 ); // Vector of temperatures of ventilation gas for forced ventilation, for each
 		//  gap, and for outdoor and indoor environment [K] {maxlay+1}
-		static Array1D_int LayerType( maxlay, 0 ); // Glazing layer type flag {maxlay}:
 		//                 0 - Specular layer,
 		//                 1 - Venetian blind (SD)
 		//                 2 - Woven shade (SD) (not implemented)
 		//                 3 - Diffuse shade (not implemented)
-		static Array1D_int nslice( maxlay, 0 ); // Vector of numbers of slices in a laminated glazing layers
 		//   (0 - monolithic layer) {maxlay}
-		static Array1D< Real64 > LaminateA( maxlay, 0.0 ); // Left-hand side array for creating slice equations {maxlay}
-		static Array1D< Real64 > LaminateB( maxlay, 0.0 ); // Right-hand side array for creating slice equations {maxlay}
-		static Array1D< Real64 > sumsol( maxlay, 0.0 ); // Array of absorbed solar energy fractions for each laminated
 		//               glazing layer [W/m^2] {maxlay}
-		static int standard( 1 ); // Calculation standard switch:
 		//                 1 - ISO 15099,
 		//                 2 - EN673 / ISO 10292 Declared,
 		//                 3 - EN673 / ISO 10292 Design.
-		static int ThermalMod( 0 ); // Thermal model:
 		//                 0 - ISO15099
 		//                 1 - Scaled Cavity Width (SCW)
 		//                 2 - Convective Scalar Model (CSM)
-		static int Debug_mode( 0 ); // Switch for debug output files:
 		//                 0 - don't create debug output files
 		//                 1 - append results to existing debug output file (where applicable)
 		//                 2 - store results in a new debug output file
-		static std::string Debug_dir; // Target directory for debug files (pointer to a character array)
-		static std::string Debug_file( "Test" ); // Template file name used to create debug output files
-		static std::int32_t Window_ID( -1 ); // ID of the window (long integer value, passed by W6)
-		static std::int32_t IGU_ID( -1 ); // ID of the IGU (long integer value, passed by W6)
-		static Real64 SDScalar( 0.0 ); // SD convection factor (value between 0 and 1)
 		//                 0.0 - No SD layer
 		//                 1.0 - Closed SD
 		//               Notes:   * vvent, tvent, Atop, Abot, Al, Ar and Ah are considered for SD layers only.
@@ -3150,8 +3381,6 @@ namespace WindowComplexManager {
 		//                     **** Forced ventilation calculation is not active at this time.
 		// TARCOG Output:
 
-		static Array1D< Real64 > theta( maxlay*2, 0.0 ); // Vector of average temperatures of glazing surfaces [K] {2*maxlay}
-		static Array1D< Real64 > q( maxlay*2+1, 0.0 ); // Vector of various heat fluxes [W/m^2] {2*maxlay+1},
 		//    depending on element index:
 		//    1  = qout (heat flux from outer-most glazing surface to outdoor space)
 		//   2*i = qpane(i) (heat flux through i-th glazing layer)
@@ -3159,49 +3388,15 @@ namespace WindowComplexManager {
 		//          surface of the adjacent glazing layer)
 		// 2*nlayer+1 = qin (heat flux from indoor space to inner-most glazing
 		//              surface)
-		static Array1D< Real64 > qprim( maxlay1, 0.0 ); // Vector of heat fluxes from the outdoor-faced surfaces of glazing layers
 		//    towards the adjacent glazing cavity [W/m2]
-		static Array1D< Real64 > qv( maxlay1, 0.0 ); // Vector of heat fluxes to each gap by ventillation [W/m^2]
-		static Real64 ufactor( 0.0 ); // Center of glass U-value [W/m^2.K]
-		static Real64 sc( 0.0 ); // Shading Coefficient
-		static Real64 hflux( 0.0 ); // Net heat flux between room and window [W/m^2]
-		static Real64 hcin( 0.0 ); // Indoor convective surface heat transfer coefficient  [W/m^2.K]
-		static Real64 hcout( 0.0 ); // Outdoor convective surface heat transfer coefficient [W/m^2.K]
-		static Real64 hrin( 0.0 ); // Indoor radiative surface heat transfer coefficient [W/m^2.K]
-		static Real64 hrout( 0.0 ); // Outdoor radiative surface heat transfer coefficient [W/m^2.K]
-		static Array1D< Real64 > hcgap( maxlay1, 0.0 ); // Convective part of gap effective conductivity {maxlay}
-		static Array1D< Real64 > hrgap( maxlay1, 0.0 ); // Radiative part of gap effective conductivity (including in and out)
-		static Real64 shgc( 0.0 ); // Solar heat gain coefficient - per ISO 15099
-		static Real64 shgct( 0.0 ); // Solar heat gain coefficient - per old procedure
-		static Real64 tamb( 0.0 ); // Outdoor environmental temperature [K]
-		static Real64 troom( 0.0 ); // Indoor environmental temperature [K]
-		static Array1D< Real64 > hg( maxlay, 0.0 ); // Gas conductance of the glazing cavity
 		//         [W/m^2.K] - EN673 and ISO 10292 procedure
-		static Array1D< Real64 > hr( maxlay, 0.0 ); // Radiation conductance of the glazing cavity
 		//         [W/m^2.K] - EN673 and ISO 10292 procedure
-		static Array1D< Real64 > hs( maxlay, 0.0 ); // Thermal conductance of the glazing cavity
 		//         [W/m^2.K] - EN673 and ISO 10292 procedure
-		static Real64 he( 0.0 ); // External heat transfer coefficient [W/m^2.K] - EN673 and ISO 10292 procedure
-		static Real64 hi( 0.0 ); // Internal heat transfer coefficient [W/m^2.K] - EN673 and ISO 10292 procedure
-		static Array1D< Real64 > Ra( maxlay+1, 0.0 ); // Vector of Rayleigh numbers, for each gap {maxlay}
-		static Array1D< Real64 > Nu( maxlay+1, 0.0 ); // Vector of Nusselt numbers, for each gap {maxlay}
-		static int nperr( 0 ); // Error code
-		static Real64 ShadeEmisRatioOut( 0.0 ); // Ratio of modified to glass emissivity at the outermost glazing surface
-		static Real64 ShadeEmisRatioIn( 0.0 ); // Ratio of modified to glass emissivity at the innermost glazing surface
-		static Real64 ShadeHcRatioOut( 0.0 ); // Ratio of modified to unshaded Hc at the outermost glazing surface
-		static Real64 ShadeHcRatioIn( 0.0 ); // Ratio of modified to unshaded Hc at the innermost glazing surface
-		static Real64 HcUnshadedOut( 0.0 ); // Hc value at outdoor surface of an unshaded subsystem [W/m^2.K]
-		static Real64 HcUnshadedIn( 0.0 ); // Hc value at indoor surface of an unshaded subsystem [W/m^2.K]
-		static Array1D< Real64 > Keff( maxlay, 0.0 ); // Vector of keff values for gaps [W/m.K] {maxlay}
-		static Array1D< Real64 > ShadeGapKeffConv( maxlay-1, 0.0 ); // Vector of convective keff values for areas above/below
 		// SD layers [W/m.K] {maxlay-1}
 
 		int ZoneNum; // Zone number corresponding to SurfNum
 
-		static Array1D< Real64 > deltaTemp( 100, 0.0 );
 		int i;
-		static Array1D_int iMinDT( 1, 0 );
-		static Array1D_int IDConst( 100, 0 );
 
 		int TotLay; // Total number of layers in a construction
 		//   (sum of solid layers and gap layers)
@@ -3268,8 +3463,6 @@ namespace WindowComplexManager {
 		Real64 ConvHeatGainToZoneAir; // Convective heat gain to zone air from window gap airflow (W)
 //		int ConstrNumSh; // Construction number with shading device
 		Real64 TransDiff; // Diffuse shortwave transmittance
-		static int CalcSHGC( 0 ); // SHGC calculations are not necessary for E+ run
-		static int NumOfIterations( 0 );
 
 		int GasType; // locally used coefficent to point at correct gas type
 		int ICoeff;
@@ -3486,7 +3679,7 @@ namespace WindowComplexManager {
 
 		//Simon: feed gas coefficients with air.  This is necessary for tarcog because it is used on indoor and outdoor sides
 		GasType = GasCoeffsAir;
-		wght( iprop( 1, 1 ) ) = GasWght( GasType );
+		CalcComplexWindowThermal_wght( iprop( 1, 1 ) ) = GasWght( GasType );
 		gama( iprop( 1, 1 ) ) = GasSpecificHeatRatio( GasType );
 		for ( ICoeff = 1; ICoeff <= 3; ++ICoeff ) {
 			gcon( ICoeff, iprop( 1, 1 ) ) = GasCoeffsCon( ICoeff, GasType );
@@ -3572,9 +3765,9 @@ namespace WindowComplexManager {
 					//to be correctly referenced by gap arrays
 
 					//First check if gas coefficients are already part of array.  Duplicates are not necessary
-					CheckGasCoefs( Material( GasPointer ).GasWght( IMix ), iprop( IMix, IGap + 1 ), wght, feedData );
-					if ( feedData ) {
-						wght( iprop( IMix, IGap + 1 ) ) = Material( GasPointer ).GasWght( IMix );
+					CheckGasCoefs( Material( GasPointer ).GasWght( IMix ), iprop( IMix, IGap + 1 ), CalcComplexWindowThermal_wght, CalcComplexWindowThermal_feedData );
+					if ( CalcComplexWindowThermal_feedData ) {
+						CalcComplexWindowThermal_wght( iprop( IMix, IGap + 1 ) ) = Material( GasPointer ).GasWght( IMix );
 						gama( iprop( IMix, IGap + 1 ) ) = Material( GasPointer ).GasSpecHeatRatio( IMix );
 						for ( i = 1; i <= 3; ++i ) {
 							gcon( i, iprop( IMix, IGap + 1 ) ) = Material( GasPointer ).GasCon( i, IMix );
@@ -3690,7 +3883,7 @@ namespace WindowComplexManager {
 		}
 
 		//  call TARCOG
-		TARCOG90( nlayer, iwd, tout, tind, trmin, wso, wsi, dir, outir, isky, tsky, esky, fclr, VacuumPressure, VacuumMaxGapThickness, CalcDeflection, Pa, Pini, Tini, gap, GapDefMax, thick, scon, YoungsMod, PoissonsRat, tir, emis, totsol, tilt, asol, height, heightt, width, presure, iprop, frct, gcon, gvis, gcp, wght, gama, nmix, SupportPlr, PillarSpacing, PillarRadius, theta, LayerDef, q, qv, ufactor, sc, hflux, hcin, hcout, hrin, hrout, hin, hout, hcgap, hrgap, shgc, nperr, tarcogErrorMessage, shgct, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, SlatThick, SlatWidth, SlatAngle, SlatCond, SlatSpacing, SlatCurve, vvent, tvent, LayerType, nslice, LaminateA, LaminateB, sumsol, hg, hr, hs, he, hi, Ra, Nu, standard, ThermalMod, Debug_mode, Debug_dir, Debug_file, Window_ID, IGU_ID, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcRatioOut, ShadeHcRatioIn, HcUnshadedOut, HcUnshadedIn, Keff, ShadeGapKeffConv, SDScalar, CalcSHGC, NumOfIterations );
+		TARCOG90( nlayer, iwd, tout, tind, trmin, wso, wsi, dir, outir, isky, tsky, esky, fclr, VacuumPressure, VacuumMaxGapThickness, CalcDeflection, Pa, Pini, Tini, gap, GapDefMax, thick, scon, YoungsMod, PoissonsRat, tir, emis, totsol, tilt, asol, height, heightt, width, presure, iprop, frct, gcon, gvis, gcp, CalcComplexWindowThermal_wght, gama, nmix, SupportPlr, PillarSpacing, PillarRadius, theta, LayerDef, q, qv, ufactor, sc, hflux, hcin, hcout, hrin, hrout, hin, hout, hcgap, hrgap, shgc, nperr, tarcogErrorMessage, shgct, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, SlatThick, SlatWidth, SlatAngle, SlatCond, SlatSpacing, SlatCurve, vvent, tvent, LayerType, nslice, LaminateA, LaminateB, sumsol, hg, hr, hs, he, hi, Ra, Nu, standard, ThermalMod, Debug_mode, Debug_dir, Debug_file, Window_ID, IGU_ID, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcRatioOut, ShadeHcRatioIn, HcUnshadedOut, HcUnshadedIn, Keff, ShadeGapKeffConv, SDScalar, CalcSHGC, NumOfIterations );
 
 		// process results from TARCOG
 		if ( ( nperr > 0 ) && ( nperr < 1000 ) ) { // process error signal from tarcog
@@ -3942,8 +4135,6 @@ namespace WindowComplexManager {
 
 		// Locals
 		//Local variables
-		static int counter( 1 );
-		static bool coeffFound( false );
 
 		feedData = false;
 		coeffFound = false;
@@ -178,6 +178,20 @@ namespace WindowEquivalentLayer {
 
 	// MODULE SUBROUTINES:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool Specular_OffNormalReturn( true );
+		Real64 X1MRDiff( -1.0 );
+		Real64 XTAUDiff( -1.0 );
+		bool Specular_FSpecular_OffNormalReturn( true );
+		Real64 GapThickMin( 0.0001 ); // Minimum gap thickness allowed, m
+		Array2D< Real64 > CalcEQLOpticalPropertyAbs1( 2, CFSMAXNL+1 );
+	}
+
 	// Functions
 
 	void
@@ -185,6 +199,12 @@ namespace WindowEquivalentLayer {
 	{
 		CFSDiffAbsTrans.deallocate();
 		EQLDiffPropFlag.deallocate();
+		Specular_OffNormalReturn = true;
+		X1MRDiff = -1.0;
+		XTAUDiff = -1.0;
+		Specular_FSpecular_OffNormalReturn = true;
+		GapThickMin = 0.0001;
+		CalcEQLOpticalPropertyAbs1 = Array2D< Real64 >( 2, CFSMAXNL+1 );
 	}
 
 	void
@@ -7383,7 +7403,6 @@ namespace WindowEquivalentLayer {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Real64 RAT_1MR; // adjustment factors, see Specular_OffNormal()
 		Real64 RAT_TAU; // adjustment factors, see Specular_OffNormal()
-		static bool Specular_OffNormalReturn( true );
 		// Flow
 
 		Specular_OffNormalReturn = Specular_OffNormal( OMEGA, RAT_1MR, RAT_TAU );
@@ -7469,8 +7488,6 @@ namespace WindowEquivalentLayer {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 X1MRDiff( -1.0 );
-		static Real64 XTAUDiff( -1.0 );
 		Array1D< Real64 > P( hipDIM );
 		// Flow
 
@@ -7528,11 +7545,10 @@ namespace WindowEquivalentLayer {
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		Real64 RAT_TAU;
 		Real64 RAT_1MR;
-		static bool Specular_OffNormalReturn( true );
 		// Flow
 
 		// Modified by BAN April 19, 2013
-		Specular_OffNormalReturn = Specular_OffNormal( THETA, RAT_1MR, RAT_TAU );
+		Specular_FSpecular_OffNormalReturn = Specular_OffNormal( THETA, RAT_1MR, RAT_TAU );
 
 		if ( OPT == hipRHO ) {
 			Specular_F = RAT_1MR;
@@ -8601,7 +8617,6 @@ namespace WindowEquivalentLayer {
 		// at time of manufacture, default = 21 C / 1 ATM
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		static Real64 GapThickMin( 0.0001 ); // Minimum gap thickness allowed, m
 		static std::string const RoutineName( "BuildGap: " );
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -9251,7 +9266,6 @@ namespace WindowEquivalentLayer {
 		Real64 ProfAngHor; // Solar profile angle (radians) for horizontal blind
 		Real64 ProfAngVer; // Solar profile angle (radians) for vertical blind
 		Real64 IncAng; // incident angle degree
-		static Array2D< Real64 > Abs1( 2, CFSMAXNL+1 );
 		int Lay; // window layer index
 		int EQLNum; // equivalent layer window construction index
 		int ConstrNum; // construction index
@@ -9278,9 +9292,9 @@ namespace WindowEquivalentLayer {
 			}
 			// Incident angle
 			IncAng = std::acos( CosIncAng( TimeStep, HourOfDay, SurfNum ) );
-			CalcEQLWindowOpticalProperty( CFS( EQLNum ), BeamDIffFlag, Abs1, IncAng, ProfAngVer, ProfAngHor );
-			CFSAbs( 1, {1,CFSMAXNL + 1} ) = Abs1( 1, {1,CFSMAXNL + 1} );
-			CFSAbs( 2, {1,CFSMAXNL + 1} ) = Abs1( 2, {1,CFSMAXNL + 1} );
+			CalcEQLWindowOpticalProperty( CFS( EQLNum ), BeamDIffFlag, CalcEQLOpticalPropertyAbs1, IncAng, ProfAngVer, ProfAngHor );
+			CFSAbs( 1, {1,CFSMAXNL + 1} ) = CalcEQLOpticalPropertyAbs1( 1, {1,CFSMAXNL + 1} );
+			CFSAbs( 2, {1,CFSMAXNL + 1} ) = CalcEQLOpticalPropertyAbs1( 2, {1,CFSMAXNL + 1} );
 		} else {
 			if ( EQLDiffPropFlag( EQLNum ) ) {
 				for ( Lay = 1; Lay <= CFS( EQLNum ).NL; ++Lay ) {
@@ -9292,12 +9306,12 @@ namespace WindowEquivalentLayer {
 						}
 					}
 				}
-				CalcEQLWindowOpticalProperty( CFS( EQLNum ), BeamDIffFlag, Abs1, IncAng, ProfAngVer, ProfAngHor );
-				CFSAbs( _, {1,CFSMAXNL + 1} ) = Abs1( _, {1,CFSMAXNL + 1} );
-				CFSDiffAbsTrans( _, {1,CFSMAXNL + 1}, EQLNum ) = Abs1( _, {1,CFSMAXNL + 1} );
-				Construct( ConstrNum ).TransDiff = Abs1( 1, CFS( EQLNum ).NL + 1 );
-				Construct( ConstrNum ).AbsDiffFrontEQL( {1,CFSMAXNL} ) = Abs1( 1, {1,CFSMAXNL} );
-				Construct( ConstrNum ).AbsDiffBackEQL( {1,CFSMAXNL} ) = Abs1( 2, {1,CFSMAXNL} );
+				CalcEQLWindowOpticalProperty( CFS( EQLNum ), BeamDIffFlag, CalcEQLOpticalPropertyAbs1, IncAng, ProfAngVer, ProfAngHor );
+				CFSAbs( _, {1,CFSMAXNL + 1} ) = CalcEQLOpticalPropertyAbs1( _, {1,CFSMAXNL + 1} );
+				CFSDiffAbsTrans( _, {1,CFSMAXNL + 1}, EQLNum ) = CalcEQLOpticalPropertyAbs1( _, {1,CFSMAXNL + 1} );
+				Construct( ConstrNum ).TransDiff = CalcEQLOpticalPropertyAbs1( 1, CFS( EQLNum ).NL + 1 );
+				Construct( ConstrNum ).AbsDiffFrontEQL( {1,CFSMAXNL} ) = CalcEQLOpticalPropertyAbs1( 1, {1,CFSMAXNL} );
+				Construct( ConstrNum ).AbsDiffBackEQL( {1,CFSMAXNL} ) = CalcEQLOpticalPropertyAbs1( 2, {1,CFSMAXNL} );
 				Construct( ConstrNum ).ReflectSolDiffFront = CFS( EQLNum ).L( 1 ).SWP_EL.RHOSFDD;
 				Construct( ConstrNum ).ReflectSolDiffBack = CFS( EQLNum ).L( CFS( EQLNum ).NL ).SWP_EL.RHOSBDD;
 				if ( ! CFS( EQLNum ).ISControlled ) EQLDiffPropFlag( EQLNum ) = false;
@@ -81,6 +81,7 @@
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneEquipment.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
@@ -262,12 +263,97 @@ namespace WindowManager {
 	Array1D< Real64 > rbvisPhi( 10, 0.0 ); // Glazing system visible back reflectance for each angle of incidence
 	Array1D< Real64 > CosPhiIndepVar( 10, 0.0 ); // Cos of incidence angles at 10-deg increments for curve fits
 
+	// Grid of the bare window response tables (used if WindowTablesEnvFlag is set)
+	int const NumRespTout( 19 ); // Number of outside air temperatures in a response table (-40C to 50C)
+	int const NumRespTin( 7 ); // Number of inside air temperatures in a response table (10C to 40C)
+	Real64 const RespToutMin( 233.15 ); // Lowest outside air temperature in a response table (K)
+	Real64 const RespTinMin( 283.15 ); // Lowest inside air temperature in a response table (K)
+	Real64 const RespTempStep( 5.0 ); // Air temperature increment in a response table (K)
+	Real64 const RespHcOut( 15.0 ); // Outside film conductance of the tabulated conditions (W/m2-K)
+	Real64 const RespHcIn( 3.0 ); // Inside film conductance of the tabulated conditions (W/m2-K)
+
+	// Object Data
+	Array1D< WindowResponseTableData > WindowResponseTable; // Response tables shared by similar bare windows
+	Array1D_int WindowResponseTableNum; // Response table used by each window surface (0 if none yet)
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE WindowManager:
 	//   Optical Calculation Routines
 	//   Heat Balance Routines
 
 	// MODULE SUBROUTINES:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool lSimpleGlazingSystem( false ); // true if using simple glazing system block model
+		Real64 InitGlassOpticalCalculationsSimpleGlazingSHGC( 0.0 ); // value of SHGC for simple glazing system block model
+		Real64 InitGlassOpticalCalculationsSimpleGlazingU( 0.0 ); // value of U-factor for simple glazing system block model
+		bool BGFlag( false ); // True if between-glass shade or blind
+		Real64 tmpTrans( 0.0 ); // solar transmittance calculated from spectral data
+		Real64 tmpTransVis( 0.0 ); // visible transmittance calculated from spectral data
+		Real64 tmpReflectSolBeamFront( 0.0 );
+		Real64 tmpReflectSolBeamBack( 0.0 );
+		Real64 tmpReflectVisBeamFront( 0.0 );
+		Real64 tmpReflectVisBeamBack( 0.0 );
+		Array1D< Real64 > DbgTheta( 11, { 0.0, 10.0, 20.0, 30.0, 40.0, 50.0, 60.0, 70.0, 80.0, 82.5, 89.5 } );
+		Array1D< Real64 > DbgTSol( 11, 0.0 );
+		Array1D< Real64 > DbgRbSol( 11, 0.0 );
+		Array1D< Real64 > DbgTVis( 11, 0.0 );
+		Array2D< Real64 > DbgFtAbs( 5, 11, 0.0 );
+		Array2D< Real64 > DbgBkAbs( 5, 11, 0.0 );
+		Array1D< Real64 > DbgFTAbsDiff( 5, 0.0 );
+		Array1D< Real64 > DbgBkAbsDiff( 5, 0.0 );
+		bool locTCFlag( false ); // True if this surface is a TC window
+		Array1D< Real64 > deltaTemp( 100, 0.0 );
+		Array1D_int iMinDT( 1, 0 );
+		Array1D_int IDConst( 100, 0 );
+		Real64 dT0( 0.0 );
+		Real64 dT1( 0.0 );
+		Array1D< Real64 > SolveForWindowTemperatures_hgap( 5 ); // Gap gas conductance (W/m2-K) //Tuned Made static
+		Array1D< Real64 > hr( 10 ); // Radiative conductance (W/m2-K) //Tuned Made static
+		Array1D_int SolveForWindowTemperatures_indx( 10 ); // Vector of row permutations in LU decomposition //Tuned Made static
+		Array2D< Real64 > Aface( 10, 10 ); // Coefficient in equation Aface*thetas = Bface //Tuned Made static
+		Array1D< Real64 > Bface( 10 ); // Coefficient in equation Aface*thetas = Bface //Tuned Made static
+		Array1D< Real64 > hrprev( 10 ); // Value of hr from previous iteration //Tuned Made static
+		Array1D< Real64 > TGapNewBG( 2 ); // For between-glass shade/blind, average gas temp in gaps on either //Tuned Made static
+		Array1D< Real64 > hcvBG( 2 ); // For between-glass shade/blind, convection coefficient from gap glass or //Tuned Made static
+		Array1D< Real64 > AbsRadShadeFace( 2 ); // Solar radiation, short-wave radiation from lights, and long-wave //Tuned Made static
+		Array1D< Real64 > RhoIR( 10 ); // Face IR reflectance //Tuned Made static
+		Array1D< Real64 > FaceTemp0( 10 ); // Tabulated face temperatures at the current air temperatures (K)
+		Array1D< Real64 > FaceFlux( 10 ); // Face fluxes not covered by the tabulated conditions (W/m2)
+		Array2D< Real64 > Aresp( 10, 10 ); // Face temperature equations with the film conductance departures
+		Array1D_int InterpolateWindowResponse_indx( 10 ); // Vector of row permutations in LU decomposition
+		Array2D< Real64 > SolveBareGlazingTempsAface( 10, 10 ); // Coefficient in equation Aface*thetas = Bface
+		Array1D< Real64 > SolveBareGlazingTempsBface( 10 ); // Coefficient in equation Aface*thetas = Bface
+		Array1D< Real64 > SolveBareGlazingTemps_hr( 10 ); // Radiative conductance (W/m2-K)
+		Array1D_int SolveBareGlazingTemps_indx( 10 ); // Vector of row permutations in LU decomposition
+		Array1D< Real64 > vv( 10 ); // Stores the implicit scaling of each row //Tuned Made static
+		Array1D< Real64 > kprime( 10 ); // Monotonic thermal conductivity
+		Array1D< Real64 > kdblprm( 10 ); // Conductivity term accounting for additional energy moved by
+		Array1D< Real64 > mukpdwn( 10 ); // Denominator term
+		Array1D< Real64 > kpdown( 10 ); // Denominator terms
+		Array1D< Real64 > kdpdown( 10 );
+		Array1D< Real64 > frct( 10 ); // Fraction of each gas in a mixture
+		Array1D< Real64 > fvis( 10 ); // Viscosity of each gas in a mixture (g/m-s)
+		Array1D< Real64 > fcon( 10 ); // Conductance of each gas in a mixture (W/m2-K)
+		Array1D< Real64 > fdens( 10 ); // Density of each gas in a mixture (kg/m3)
+		Array1D< Real64 > fcp( 10 ); // Specific heat of each gas in a mixture (J/m3-K)
+		Array1D< Real64 > rguess( 11 ); // Combined radiative/convective resistance (m2-K/W) of //Tuned Made static
+		bool DoReport( false );
+		bool HasWindows( false );
+		bool HasComplexWindows( false );
+		bool HasEQLWindows( false ); // equivalent layer window defined
+		Real64 TempVar( 0.0 ); // just temporary usage for complex fenestration
+		bool ErrorsFound( false ); // If errors detected in input
+		bool RunMeOnceFlag( false ); // This subroutine only needs to be run once
+		int iSolarSpectrum( 0 );
+		int iVisibleSpectrum( 0 );
+		int NumSiteSpectrum( 0 );
+	}
+
 	// Functions
 
 	void
@@ -363,6 +449,72 @@ namespace WindowManager {
 		rfvisPhi = Array1D< Real64 >( 10, 0.0 );
 		rbvisPhi = Array1D< Real64 >( 10, 0.0 );
 		CosPhiIndepVar = Array1D< Real64 >( 10, 0.0 );
+		WindowResponseTable.deallocate();
+		WindowResponseTableNum.deallocate();
+		lSimpleGlazingSystem = false;
+		InitGlassOpticalCalculationsSimpleGlazingSHGC = 0.0;
+		InitGlassOpticalCalculationsSimpleGlazingU = 0.0;
+		BGFlag = false;
+		tmpTrans = 0.0;
+		tmpTransVis = 0.0;
+		tmpReflectSolBeamFront = 0.0;
+		tmpReflectSolBeamBack = 0.0;
+		tmpReflectVisBeamFront = 0.0;
+		tmpReflectVisBeamBack = 0.0;
+		DbgTheta = Array1D< Real64 >( 11, { 0.0, 10.0, 20.0, 30.0, 40.0, 50.0, 60.0, 70.0, 80.0, 82.5, 89.5 } );
+		DbgTSol = Array1D< Real64 >( 11, 0.0 );
+		DbgRbSol = Array1D< Real64 >( 11, 0.0 );
+		DbgTVis = Array1D< Real64 >( 11, 0.0 );
+		DbgFtAbs = Array2D< Real64 >( 5, 11, 0.0 );
+		DbgBkAbs = Array2D< Real64 >( 5, 11, 0.0 );
+		DbgFTAbsDiff = Array1D< Real64 >( 5, 0.0 );
+		DbgBkAbsDiff = Array1D< Real64 >( 5, 0.0 );
+		locTCFlag = false;
+		deltaTemp = Array1D< Real64 >( 100, 0.0 );
+		iMinDT = Array1D_int( 1, 0 );
+		IDConst = Array1D_int( 100, 0 );
+		dT0 = 0.0;
+		dT1 = 0.0;
+		SolveForWindowTemperatures_hgap = Array1D< Real64 >( 5 );
+		hr = Array1D< Real64 >( 10 );
+		SolveForWindowTemperatures_indx = Array1D_int( 10 );
+		Aface = Array2D< Real64 >( 10, 10 );
+		Bface = Array1D< Real64 >( 10 );
+		hrprev = Array1D< Real64 >( 10 );
+		TGapNewBG = Array1D< Real64 >( 2 );
+		hcvBG = Array1D< Real64 >( 2 );
+		AbsRadShadeFace = Array1D< Real64 >( 2 );
+		RhoIR = Array1D< Real64 >( 10 );
+		FaceTemp0 = Array1D< Real64 >( 10 );
+		FaceFlux = Array1D< Real64 >( 10 );
+		Aresp = Array2D< Real64 >( 10, 10 );
+		InterpolateWindowResponse_indx = Array1D_int( 10 );
+		SolveBareGlazingTempsAface = Array2D< Real64 >( 10, 10 );
+		SolveBareGlazingTempsBface = Array1D< Real64 >( 10 );
+		SolveBareGlazingTemps_hr = Array1D< Real64 >( 10 );
+		SolveBareGlazingTemps_indx = Array1D_int( 10 );
+		vv = Array1D< Real64 >( 10 );
+		kprime = Array1D< Real64 >( 10 );
+		kdblprm = Array1D< Real64 >( 10 );
+		mukpdwn = Array1D< Real64 >( 10 );
+		kpdown = Array1D< Real64 >( 10 );
+		kdpdown = Array1D< Real64 >( 10 );
+		frct = Array1D< Real64 >( 10 );
+		fvis = Array1D< Real64 >( 10 );
+		fcon = Array1D< Real64 >( 10 );
+		fdens = Array1D< Real64 >( 10 );
+		fcp = Array1D< Real64 >( 10 );
+		rguess = Array1D< Real64 >( 11 );
+		DoReport = false;
+		HasWindows = false;
+		HasComplexWindows = false;
+		HasEQLWindows = false;
+		TempVar = 0.0;
+		ErrorsFound = false;
+		RunMeOnceFlag = false;
+		iSolarSpectrum = 0;
+		iVisibleSpectrum = 0;
+		NumSiteSpectrum = 0;
 	}
 
 	void
@@ -538,26 +690,8 @@ namespace WindowManager {
 		Array1D< Real64 > W3( 3 );
 		Array1D< Real64 > W21( 3 ); // W1-W2, W3-W2, resp. (m)
 		Array1D< Real64 > W23( 3 );
-		static bool lSimpleGlazingSystem( false ); // true if using simple glazing system block model
-		static Real64 SimpleGlazingSHGC( 0.0 ); // value of SHGC for simple glazing system block model
-		static Real64 SimpleGlazingU( 0.0 ); // value of U-factor for simple glazing system block model
-		static bool BGFlag( false ); // True if between-glass shade or blind
-		static Real64 tmpTrans( 0.0 ); // solar transmittance calculated from spectral data
-		static Real64 tmpTransVis( 0.0 ); // visible transmittance calculated from spectral data
-		static Real64 tmpReflectSolBeamFront( 0.0 );
-		static Real64 tmpReflectSolBeamBack( 0.0 );
-		static Real64 tmpReflectVisBeamFront( 0.0 );
-		static Real64 tmpReflectVisBeamBack( 0.0 );
 
 		//Debug
-		static Array1D< Real64 > DbgTheta( 11, { 0.0, 10.0, 20.0, 30.0, 40.0, 50.0, 60.0, 70.0, 80.0, 82.5, 89.5 } );
-		static Array1D< Real64 > DbgTSol( 11, 0.0 );
-		static Array1D< Real64 > DbgRbSol( 11, 0.0 );
-		static Array1D< Real64 > DbgTVis( 11, 0.0 );
-		static Array2D< Real64 > DbgFtAbs( 5, 11, 0.0 );
-		static Array2D< Real64 > DbgBkAbs( 5, 11, 0.0 );
-		static Array1D< Real64 > DbgFTAbsDiff( 5, 0.0 );
-		static Array1D< Real64 > DbgBkAbsDiff( 5, 0.0 );
 
 		//EndDebug
 
@@ -600,8 +734,8 @@ namespace WindowManager {
 			if ( Material( Construct( ConstrNum ).LayerPoint( 1 ) ).Group == WindowSimpleGlazing ) {
 				// what if outside layer is shade, blind, or screen?
 				lSimpleGlazingSystem = true;
-				SimpleGlazingSHGC = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).SimpleWindowSHGC;
-				SimpleGlazingU = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).SimpleWindowUfactor;
+				InitGlassOpticalCalculationsSimpleGlazingSHGC = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).SimpleWindowSHGC;
+				InitGlassOpticalCalculationsSimpleGlazingU = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).SimpleWindowUfactor;
 			}
 
 			if ( has_prefix( Construct( ConstrNum ).Name, "BARECONSTRUCTIONWITHSTORMWIN" ) || has_prefix( Construct( ConstrNum ).Name, "SHADEDCONSTRUCTIONWITHSTORMWIN" ) ) StormWinConst = true;
@@ -796,7 +930,7 @@ namespace WindowManager {
 				for ( IGlass = 1; IGlass <= NGlass; ++IGlass ) {
 					for ( ILam = 1; ILam <= numpt( IGlass ); ++ILam ) {
 
-						TransAndReflAtPhi( CosPhi, t( IGlass, ILam ), rff( IGlass, ILam ), rbb( IGlass, ILam ), tPhi( IGlass, ILam ), rfPhi( IGlass, ILam ), rbPhi( IGlass, ILam ), lSimpleGlazingSystem, SimpleGlazingSHGC, SimpleGlazingU );
+						TransAndReflAtPhi( CosPhi, t( IGlass, ILam ), rff( IGlass, ILam ), rbb( IGlass, ILam ), tPhi( IGlass, ILam ), rfPhi( IGlass, ILam ), rbPhi( IGlass, ILam ), lSimpleGlazingSystem, InitGlassOpticalCalculationsSimpleGlazingSHGC, InitGlassOpticalCalculationsSimpleGlazingU );
 					}
 
 					// For use with between-glass shade/blind, save angular properties of isolated glass
@@ -959,7 +1093,7 @@ namespace WindowManager {
 				for ( IGlass = 1; IGlass <= NGlass; ++IGlass ) {
 					for ( ILam = 1; ILam <= numpt( IGlass ); ++ILam ) {
 
-						TransAndReflAtPhi( CosPhi, t( IGlass, ILam ), rff( IGlass, ILam ), rbb( IGlass, ILam ), tPhi( IGlass, ILam ), rfPhi( IGlass, ILam ), rbPhi( IGlass, ILam ), lSimpleGlazingSystem, SimpleGlazingSHGC, SimpleGlazingU );
+						TransAndReflAtPhi( CosPhi, t( IGlass, ILam ), rff( IGlass, ILam ), rbb( IGlass, ILam ), tPhi( IGlass, ILam ), rfPhi( IGlass, ILam ), rbPhi( IGlass, ILam ), lSimpleGlazingSystem, InitGlassOpticalCalculationsSimpleGlazingSHGC, InitGlassOpticalCalculationsSimpleGlazingU );
 					}
 				}
 
@@ -2232,13 +2366,7 @@ namespace WindowManager {
 		// New variables for thermochromic windows calc
 		Real64 locTCSpecTemp; // The temperature corresponding to the specified optical properties of the TC layer
 		Real64 locTCLayerTemp; // TC layer temperature at each time step. C
-		static bool locTCFlag( false ); // True if this surface is a TC window
-		static Array1D< Real64 > deltaTemp( 100, 0.0 );
 		int i;
-		static Array1D_int iMinDT( 1, 0 );
-		static Array1D_int IDConst( 100, 0 );
-		static Real64 dT0( 0.0 );
-		static Real64 dT1( 0.0 );
 		Real64 SurfOutsideEmiss; // temporary for result of outside surface emissivity
 		Real64 Tsout; // temporary for result of outside surface temp in Kelvin
 		//integer :: CurrentThermalAlgorithm
@@ -2941,20 +3069,14 @@ namespace WindowManager {
 
 		int ZoneNum; // Zone number corresponding to SurfNum
 		int i; // Counter
-		static Array1D< Real64 > hgap( 5 ); // Gap gas conductance (W/m2-K) //Tuned Made static
 		Real64 gr; // Grashof number of gas in a gap
 		Real64 con; // Gap gas conductivity
 		Real64 pr; // Gap gas Prandtl number
 		Real64 nu; // Gap gas Nusselt number
-		static Array1D< Real64 > hr( 10 ); // Radiative conductance (W/m2-K) //Tuned Made static
 		Real64 d; // +1 if number of row interchanges is even,
 		// -1 if odd (in LU decomposition)
-		static Array1D_int indx( 10 ); // Vector of row permutations in LU decomposition //Tuned Made static
-		static Array2D< Real64 > Aface( 10, 10 ); // Coefficient in equation Aface*thetas = Bface //Tuned Made static
-		static Array1D< Real64 > Bface( 10 ); // Coefficient in equation Aface*thetas = Bface //Tuned Made static
 
 		int iter; // Iteration number
-		static Array1D< Real64 > hrprev( 10 ); // Value of hr from previous iteration //Tuned Made static
 		Real64 errtemp; // Absolute value of sum of face temperature differences
 		//   between iterations, divided by number of faces
 		Real64 VGap; // Air velocity in gap between glass and shade/blind (m/s)
@@ -2965,12 +3087,10 @@ namespace WindowManager {
 		Real64 TGapOutlet; // Temperature of air leaving gap between glass and shade/blind (K)
 		Real64 TAirflowGapOutlet; // Temperature of air leaving airflow gap between glass panes (K)
 		Real64 TAirflowGapOutletC; // Temperature of air leaving airflow gap between glass panes (C)
-		static Array1D< Real64 > TGapNewBG( 2 ); // For between-glass shade/blind, average gas temp in gaps on either //Tuned Made static
 		//  side of shade/blind (K)
 		Real64 hcv; // Convection coefficient from gap glass or shade/blind to gap air (W/m2-K)
 		Real64 hcvAirflowGap; // Convection coefficient from airflow gap glass to airflow gap air (W/m2-K)
 		Real64 hcvPrev; // Value of hcv from previous iteration
-		static Array1D< Real64 > hcvBG( 2 ); // For between-glass shade/blind, convection coefficient from gap glass or //Tuned Made static
 		//  shade/blind to gap gas on either side of shade/blind (W/m2-K)
 		Real64 ConvHeatFlowNatural; // Convective heat flow from gap between glass and interior shade or blind (W)
 		Real64 ConvHeatFlowForced; // Convective heat flow from forced airflow gap (W)
@@ -2989,7 +3109,6 @@ namespace WindowManager {
 		int ShadeFlag; // Shading flag
 		Real64 ShadeAbsFac1; // Fractions for apportioning absorbed radiation to shade/blind faces
 		Real64 ShadeAbsFac2;
-		static Array1D< Real64 > AbsRadShadeFace( 2 ); // Solar radiation, short-wave radiation from lights, and long-wave //Tuned Made static
 		//  radiation from lights and zone equipment absorbed by faces of shade/blind (W/m2)
 		Real64 ShadeArea; // shade/blind area (m2)
 		Real64 CondHeatGainGlass; // Conduction through inner glass layer, outside to inside (W)
@@ -3004,7 +3123,6 @@ namespace WindowManager {
 		int ConstrNum; // Construction number, bare and with shading device
 		int ConstrNumSh;
 		Real64 TransDiff; // Diffuse shortwave transmittance
-		static Array1D< Real64 > RhoIR( 10 ); // Face IR reflectance //Tuned Made static
 		Real64 FacRhoIR25; // Intermediate variable
 		Real64 FacRhoIR63; // Intermediate variable
 		Real64 RhoIRfp; // Intermediate variable
@@ -3028,6 +3146,7 @@ namespace WindowManager {
 		//unused REAL(r64)         :: MassFlow              ! Mass flow of air from window gap entering fan (kg/s)
 		Real64 ZoneTemp; // Zone air temperature (C)
 		int InsideFaceIndex; // intermediate variable for index of inside face in thetas
+		bool UseResponseTable; // True if the face temperatures start from the window response table
 
 		iter = 0;
 		ConvHeatFlowNatural = 0.0;
@@ -3064,6 +3183,11 @@ namespace WindowManager {
 
 		StartingWindowTemps( SurfNum, AbsRadShadeFace );
 
+		// Bare windows without gap airflow can instead start from their tabulated response; the iterations
+		// then usually meet the convergence tolerance after a single corrective iteration.
+		UseResponseTable = ( DataSystemVariables::WindowTablesEnvFlag && nglfacep == nglface && SurfaceWindow( SurfNum ).AirflowThisTS == 0.0 );
+		if ( UseResponseTable ) InterpolateWindowResponse( SurfNum );
+
 		hcvPrev = 0.0;
 		VGapPrev = 0.0;
 
@@ -3180,10 +3304,10 @@ namespace WindowManager {
 			} else if ( SELECT_CASE_var == 2 ) {
 				WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr );
 				NusseltNumber( SurfNum, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu );
-				hgap( 1 ) = con / gap( 1 ) * nu;
+				SolveForWindowTemperatures_hgap( 1 ) = con / gap( 1 ) * nu;
 				if ( SurfaceWindow( SurfNum ).EdgeGlCorrFac > 1.0 ) { // Edge of glass correction
 					hrgap( 1 ) = 0.5 * std::abs( A23 ) * pow_3( thetas( 2 ) + thetas( 3 ) );
-					hgap( 1 ) = hgap( 1 ) * SurfaceWindow( SurfNum ).EdgeGlCorrFac + hrgap( 1 ) * ( SurfaceWindow( SurfNum ).EdgeGlCorrFac - 1.0 );
+					SolveForWindowTemperatures_hgap( 1 ) = SolveForWindowTemperatures_hgap( 1 ) * SurfaceWindow( SurfNum ).EdgeGlCorrFac + hrgap( 1 ) * ( SurfaceWindow( SurfNum ).EdgeGlCorrFac - 1.0 );
 				}
 
 				Bface( 1 ) = Outir * emis( 1 ) + hcout * tout + AbsRadGlassFace( 1 );
@@ -3195,11 +3319,11 @@ namespace WindowManager {
 				Aface( 2, 1 ) = -scon( 1 );
 
 				Aface( 1, 2 ) = -scon( 1 );
-				Aface( 2, 2 ) = scon( 1 ) + hgap( 1 ) - A23P * hr( 2 );
-				Aface( 3, 2 ) = -hgap( 1 ) - A32P * hr( 3 );
+				Aface( 2, 2 ) = scon( 1 ) + SolveForWindowTemperatures_hgap( 1 ) - A23P * hr( 2 );
+				Aface( 3, 2 ) = -SolveForWindowTemperatures_hgap( 1 ) - A32P * hr( 3 );
 
-				Aface( 2, 3 ) = -hgap( 1 ) + A23P * hr( 2 );
-				Aface( 3, 3 ) = hgap( 1 ) + scon( 2 ) + A32P * hr( 3 );
+				Aface( 2, 3 ) = -SolveForWindowTemperatures_hgap( 1 ) + A23P * hr( 2 );
+				Aface( 3, 3 ) = SolveForWindowTemperatures_hgap( 1 ) + scon( 2 ) + A32P * hr( 3 );
 				Aface( 4, 3 ) = -scon( 2 );
 
 				Aface( 3, 4 ) = -scon( 2 );
@@ -3280,18 +3404,18 @@ namespace WindowManager {
 			} else if ( SELECT_CASE_var == 3 ) {
 				WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr );
 				NusseltNumber( SurfNum, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu );
-				hgap( 1 ) = con / gap( 1 ) * nu;
+				SolveForWindowTemperatures_hgap( 1 ) = con / gap( 1 ) * nu;
 				if ( SurfaceWindow( SurfNum ).EdgeGlCorrFac > 1.0 ) { // Edge of glass correction
 					hrgap( 1 ) = 0.5 * std::abs( A23 ) * pow_3( thetas( 2 ) + thetas( 3 ) );
-					hgap( 1 ) = hgap( 1 ) * SurfaceWindow( SurfNum ).EdgeGlCorrFac + hrgap( 1 ) * ( SurfaceWindow( SurfNum ).EdgeGlCorrFac - 1.0 );
+					SolveForWindowTemperatures_hgap( 1 ) = SolveForWindowTemperatures_hgap( 1 ) * SurfaceWindow( SurfNum ).EdgeGlCorrFac + hrgap( 1 ) * ( SurfaceWindow( SurfNum ).EdgeGlCorrFac - 1.0 );
 				}
 
 				WindowGasConductance( thetas( 4 ), thetas( 5 ), 2, con, pr, gr );
 				NusseltNumber( SurfNum, thetas( 4 ), thetas( 5 ), 2, gr, pr, nu );
-				hgap( 2 ) = con / gap( 2 ) * nu;
+				SolveForWindowTemperatures_hgap( 2 ) = con / gap( 2 ) * nu;
 				if ( SurfaceWindow( SurfNum ).EdgeGlCorrFac > 1.0 ) { // Edge of glass correction
 					hrgap( 2 ) = 0.5 * std::abs( A45 ) * pow_3( thetas( 4 ) + thetas( 5 ) );
-					hgap( 2 ) = hgap( 2 ) * SurfaceWindow( SurfNum ).EdgeGlCorrFac + hrgap( 2 ) * ( SurfaceWindow( SurfNum ).EdgeGlCorrFac - 1.0 );
+					SolveForWindowTemperatures_hgap( 2 ) = SolveForWindowTemperatures_hgap( 2 ) * SurfaceWindow( SurfNum ).EdgeGlCorrFac + hrgap( 2 ) * ( SurfaceWindow( SurfNum ).EdgeGlCorrFac - 1.0 );
 				}
 
 				Bface( 1 ) = Outir * emis( 1 ) + hcout * tout + AbsRadGlassFace( 1 );
@@ -3305,19 +3429,19 @@ namespace WindowManager {
 				Aface( 2, 1 ) = -scon( 1 );
 
 				Aface( 1, 2 ) = -scon( 1 );
-				Aface( 2, 2 ) = scon( 1 ) + hgap( 1 ) - A23P * hr( 2 );
-				Aface( 3, 2 ) = -hgap( 1 ) - A32P * hr( 3 );
+				Aface( 2, 2 ) = scon( 1 ) + SolveForWindowTemperatures_hgap( 1 ) - A23P * hr( 2 );
+				Aface( 3, 2 ) = -SolveForWindowTemperatures_hgap( 1 ) - A32P * hr( 3 );
 
-				Aface( 2, 3 ) = -hgap( 1 ) + A23P * hr( 2 );
-				Aface( 3, 3 ) = hgap( 1 ) + scon( 2 ) + A32P * hr( 3 );
+				Aface( 2, 3 ) = -SolveForWindowTemperatures_hgap( 1 ) + A23P * hr( 2 );
+				Aface( 3, 3 ) = SolveForWindowTemperatures_hgap( 1 ) + scon( 2 ) + A32P * hr( 3 );
 				Aface( 4, 3 ) = -scon( 2 );
 
 				Aface( 3, 4 ) = -scon( 2 );
-				Aface( 4, 4 ) = scon( 2 ) + hgap( 2 ) - A45P * hr( 4 );
-				Aface( 5, 4 ) = -hgap( 2 ) - A54P * hr( 5 );
+				Aface( 4, 4 ) = scon( 2 ) + SolveForWindowTemperatures_hgap( 2 ) - A45P * hr( 4 );
+				Aface( 5, 4 ) = -SolveForWindowTemperatures_hgap( 2 ) - A54P * hr( 5 );
 
-				Aface( 4, 5 ) = -hgap( 2 ) + A45P * hr( 4 );
-				Aface( 5, 5 ) = hgap( 2 ) + scon( 3 ) + A54P * hr( 5 );
+				Aface( 4, 5 ) = -SolveForWindowTemperatures_hgap( 2 ) + A45P * hr( 4 );
+				Aface( 5, 5 ) = SolveForWindowTemperatures_hgap( 2 ) + scon( 3 ) + A54P * hr( 5 );
 				Aface( 6, 5 ) = -scon( 3 );
 
 				Aface( 5, 6 ) = -scon( 3 );
@@ -3398,26 +3522,26 @@ namespace WindowManager {
 			} else if ( SELECT_CASE_var == 4 ) {
 				WindowGasConductance( thetas( 2 ), thetas( 3 ), 1, con, pr, gr );
 				NusseltNumber( SurfNum, thetas( 2 ), thetas( 3 ), 1, gr, pr, nu );
-				hgap( 1 ) = con / gap( 1 ) * nu;
+				SolveForWindowTemperatures_hgap( 1 ) = con / gap( 1 ) * nu;
 				if ( SurfaceWindow( SurfNum ).EdgeGlCorrFac > 1.0 ) { // Edge of glass correction
 					hrgap( 1 ) = 0.5 * std::abs( A23 ) * pow_3( thetas( 2 ) + thetas( 3 ) );
-					hgap( 1 ) = hgap( 1 ) * SurfaceWindow( SurfNum ).EdgeGlCorrFac + hrgap( 1 ) * ( SurfaceWindow( SurfNum ).EdgeGlCorrFac - 1.0 );
+					SolveForWindowTemperatures_hgap( 1 ) = SolveForWindowTemperatures_hgap( 1 ) * SurfaceWindow( SurfNum ).EdgeGlCorrFac + hrgap( 1 ) * ( SurfaceWindow( SurfNum ).EdgeGlCorrFac - 1.0 );
 				}
 
 				WindowGasConductance( thetas( 4 ), thetas( 5 ), 2, con, pr, gr );
 				NusseltNumber( SurfNum, thetas( 4 ), thetas( 5 ), 2, gr, pr, nu );
-				hgap( 2 ) = con / gap( 2 ) * nu;
+				SolveForWindowTemperatures_hgap( 2 ) = con / gap( 2 ) * nu;
 				if ( SurfaceWindow( SurfNum ).EdgeGlCorrFac > 1.0 ) { // Edge of glass correction
 					hrgap( 2 ) = 0.5 * std::abs( A45 ) * pow_3( thetas( 4 ) + thetas( 5 ) );
-					hgap( 2 ) = hgap( 2 ) * SurfaceWindow( SurfNum ).EdgeGlCorrFac + hrgap( 2 ) * ( SurfaceWindow( SurfNum ).EdgeGlCorrFac - 1.0 );
+					SolveForWindowTemperatures_hgap( 2 ) = SolveForWindowTemperatures_hgap( 2 ) * SurfaceWindow( SurfNum ).EdgeGlCorrFac + hrgap( 2 ) * ( SurfaceWindow( SurfNum ).EdgeGlCorrFac - 1.0 );
 				}
 
 				WindowGasConductance( thetas( 6 ), thetas( 7 ), 3, con, pr, gr );
 				NusseltNumber( SurfNum, thetas( 6 ), thetas( 7 ), 3, gr, pr, nu );
-				hgap( 3 ) = con / gap( 3 ) * nu;
+				SolveForWindowTemperatures_hgap( 3 ) = con / gap( 3 ) * nu;
 				if ( SurfaceWindow( SurfNum ).EdgeGlCorrFac > 1.0 ) { // Edge of glass correction
 					hrgap( 3 ) = 0.5 * std::abs( A67 ) * pow_3( thetas( 6 ) + thetas( 7 ) );
-					hgap( 3 ) = hgap( 3 ) * SurfaceWindow( SurfNum ).EdgeGlCorrFac + hrgap( 3 ) * ( SurfaceWindow( SurfNum ).EdgeGlCorrFac - 1.0 );
+					SolveForWindowTemperatures_hgap( 3 ) = SolveForWindowTemperatures_hgap( 3 ) * SurfaceWindow( SurfNum ).EdgeGlCorrFac + hrgap( 3 ) * ( SurfaceWindow( SurfNum ).EdgeGlCorrFac - 1.0 );
 				}
 				Bface( 1 ) = Outir * emis( 1 ) + hcout * tout + AbsRadGlassFace( 1 );
 				Bface( 2 ) = AbsRadGlassFace( 2 );
@@ -3432,27 +3556,27 @@ namespace WindowManager {
 				Aface( 2, 1 ) = -scon( 1 );
 
 				Aface( 1, 2 ) = -scon( 1 );
-				Aface( 2, 2 ) = scon( 1 ) + hgap( 1 ) - A23P * hr( 2 );
-				Aface( 3, 2 ) = -hgap( 1 ) - A32P * hr( 3 );
+				Aface( 2, 2 ) = scon( 1 ) + SolveForWindowTemperatures_hgap( 1 ) - A23P * hr( 2 );
+				Aface( 3, 2 ) = -SolveForWindowTemperatures_hgap( 1 ) - A32P * hr( 3 );
 
-				Aface( 2, 3 ) = -hgap( 1 ) + A23P * hr( 2 );
-				Aface( 3, 3 ) = hgap( 1 ) + scon( 2 ) + A32P * hr( 3 );
+				Aface( 2, 3 ) = -SolveForWindowTemperatures_hgap( 1 ) + A23P * hr( 2 );
+				Aface( 3, 3 ) = SolveForWindowTemperatures_hgap( 1 ) + scon( 2 ) + A32P * hr( 3 );
 				Aface( 4, 3 ) = -scon( 2 );
 
 				Aface( 3, 4 ) = -scon( 2 );
-				Aface( 4, 4 ) = scon( 2 ) + hgap( 2 ) - A45P * hr( 4 );
-				Aface( 5, 4 ) = -hgap( 2 ) - A54P * hr( 5 );
+				Aface( 4, 4 ) = scon( 2 ) + SolveForWindowTemperatures_hgap( 2 ) - A45P * hr( 4 );
+				Aface( 5, 4 ) = -SolveForWindowTemperatures_hgap( 2 ) - A54P * hr( 5 );
 
-				Aface( 4, 5 ) = -hgap( 2 ) + A45P * hr( 4 );
-				Aface( 5, 5 ) = hgap( 2 ) + scon( 3 ) + A54P * hr( 5 );
+				Aface( 4, 5 ) = -SolveForWindowTemperatures_hgap( 2 ) + A45P * hr( 4 );
+				Aface( 5, 5 ) = SolveForWindowTemperatures_hgap( 2 ) + scon( 3 ) + A54P * hr( 5 );
 				Aface( 6, 5 ) = -scon( 3 );
 
 				Aface( 5, 6 ) = -scon( 3 );
-				Aface( 6, 6 ) = scon( 3 ) + hgap( 3 ) - A67P * hr( 6 );
-				Aface( 7, 6 ) = -hgap( 3 ) - A76P * hr( 7 );
+				Aface( 6, 6 ) = scon( 3 ) + SolveForWindowTemperatures_hgap( 3 ) - A67P * hr( 6 );
+				Aface( 7, 6 ) = -SolveForWindowTemperatures_hgap( 3 ) - A76P * hr( 7 );
 
-				Aface( 6, 7 ) = -hgap( 3 ) + A67P * hr( 6 );
-				Aface( 7, 7 ) = hgap( 3 ) + scon( 4 ) + A76P * hr( 7 );
+				Aface( 6, 7 ) = -SolveForWindowTemperatures_hgap( 3 ) + A67P * hr( 6 );
+				Aface( 7, 7 ) = SolveForWindowTemperatures_hgap( 3 ) + scon( 4 ) + A76P * hr( 7 );
 				Aface( 8, 7 ) = -scon( 4 );
 
 				Aface( 7, 8 ) = -scon( 4 );
@@ -3490,8 +3614,8 @@ namespace WindowManager {
 				ShowFatalError( "SolveForWindowTemperatures: Invalid number of Glass Layers=" + TrimSigDigits( ngllayer ) + ", up to 4 allowed." );
 			}}
 
-			LUdecomposition( Aface, nglfacep, indx, d ); // Note that these routines change Aface;
-			LUsolution( Aface, nglfacep, indx, Bface ); // face temperatures are returned in Bface
+			LUdecomposition( Aface, nglfacep, SolveForWindowTemperatures_indx, d ); // Note that these routines change Aface;
+			LUsolution( Aface, nglfacep, SolveForWindowTemperatures_indx, Bface ); // face temperatures are returned in Bface
 
 			for ( i = 1; i <= nglfacep; ++i ) {
 				thetasPrev( i ) = thetas( i );
@@ -3651,6 +3775,308 @@ namespace WindowManager {
 
 	//****************************************************************************
 
+	void
+	InterpolateWindowResponse( int const SurfNum ) // Surface number
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets the face temperatures of a bare window (no shade, blind, screen or gap airflow)
+		// from the response table of its construction, so that SolveForWindowTemperatures
+		// only has to confirm them with a single heat balance iteration.
+
+		// METHODOLOGY EMPLOYED:
+		// The table holds the converged face temperatures on a grid of outside and inside air
+		// temperatures for fixed film conductances, black-body surrounds and no absorbed radiation,
+		// together with the response of each face temperature to radiation absorbed at each face.
+		// Both are interpolated bilinearly in the air temperatures. The current absorbed radiation and
+		// the departure of the surround IR from black-body are applied as extra face fluxes through the
+		// interpolated response. The departure of the film conductances from the tabulated ones gives
+		// an extra flux that depends on the outer face temperatures themselves, so the face temperatures
+		// are found from the small linear system of the response with that flux. Tables are built on
+		// first use and shared by windows with the same construction, height, tilt and edge-of-glass
+		// correction, since these fix the gap convection.
+
+		// REFERENCES:
+		// na
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int ConstrNum; // Bare window construction number
+		int TableNum; // Response table number
+		int Loop; // Table counter
+		int i; // Face counter
+		int j; // Absorbing face counter
+		int IOut; // Lower outside air temperature grid index
+		int IIn; // Lower inside air temperature grid index
+		Real64 FracOut; // Interpolation fraction between outside air temperature grid points
+		Real64 FracIn; // Interpolation fraction between inside air temperature grid points
+		Real64 Wgt11; // Bilinear interpolation weights
+		Real64 Wgt21;
+		Real64 Wgt12;
+		Real64 Wgt22;
+		Real64 Sens; // Interpolated face temperature response (m2-K/W)
+		Real64 DHcOut; // Departure of the outside film conductance from the tabulated one (W/m2-K)
+		Real64 DHcIn; // Departure of the inside film conductance from the tabulated one (W/m2-K)
+		Real64 d; // +1 if number of row interchanges is even, -1 if odd (in LU decomposition)
+
+		ConstrNum = Surface( SurfNum ).Construction;
+		if ( SurfaceWindow( SurfNum ).StormWinFlag > 0 ) ConstrNum = Surface( SurfNum ).StormWinConstruction;
+
+		if ( ! allocated( WindowResponseTableNum ) ) WindowResponseTableNum.dimension( TotSurfaces, 0 );
+		TableNum = WindowResponseTableNum( SurfNum );
+		if ( TableNum == 0 || WindowResponseTable( TableNum ).ConstrNum != ConstrNum ) {
+			TableNum = 0;
+			for ( Loop = 1; Loop <= isize( WindowResponseTable ); ++Loop ) {
+				auto const & table( WindowResponseTable( Loop ) );
+				if ( table.ConstrNum == ConstrNum && table.Height == Surface( SurfNum ).Height && table.Tilt == Surface( SurfNum ).Tilt && table.EdgeGlCorrFac == SurfaceWindow( SurfNum ).EdgeGlCorrFac ) {
+					TableNum = Loop;
+					break;
+				}
+			}
+			if ( TableNum == 0 ) {
+				TableNum = isize( WindowResponseTable ) + 1;
+				WindowResponseTable.redimension( TableNum );
+				WindowResponseTable( TableNum ).ConstrNum = ConstrNum;
+				WindowResponseTable( TableNum ).Height = Surface( SurfNum ).Height;
+				WindowResponseTable( TableNum ).Tilt = Surface( SurfNum ).Tilt;
+				WindowResponseTable( TableNum ).EdgeGlCorrFac = SurfaceWindow( SurfNum ).EdgeGlCorrFac;
+				SetupWindowResponseTable( SurfNum, TableNum );
+			}
+			WindowResponseTableNum( SurfNum ) = TableNum;
+		}
+		auto const & table( WindowResponseTable( TableNum ) );
+
+		// Grid cell and interpolation fractions; conditions off the grid are extrapolated from the edge cell
+		FracOut = ( tout - RespToutMin ) / RespTempStep;
+		IOut = min( max( int( std::floor( FracOut ) ) + 1, 1 ), NumRespTout - 1 );
+		FracOut -= IOut - 1;
+		FracIn = ( tin - RespTinMin ) / RespTempStep;
+		IIn = min( max( int( std::floor( FracIn ) ) + 1, 1 ), NumRespTin - 1 );
+		FracIn -= IIn - 1;
+		Wgt11 = ( 1.0 - FracOut ) * ( 1.0 - FracIn );
+		Wgt21 = FracOut * ( 1.0 - FracIn );
+		Wgt12 = ( 1.0 - FracOut ) * FracIn;
+		Wgt22 = FracOut * FracIn;
+
+		for ( i = 1; i <= nglface; ++i ) {
+			FaceTemp0( i ) = Wgt11 * table.FaceTemp( IOut, IIn, i ) + Wgt21 * table.FaceTemp( IOut + 1, IIn, i ) + Wgt12 * table.FaceTemp( IOut, IIn + 1, i ) + Wgt22 * table.FaceTemp( IOut + 1, IIn + 1, i );
+			FaceFlux( i ) = AbsRadGlassFace( i );
+		}
+		DHcOut = hcout - RespHcOut;
+		DHcIn = hcin - RespHcIn;
+		FaceFlux( 1 ) += emis( 1 ) * ( Outir - sigma * pow_4( tout ) ) + DHcOut * tout;
+		FaceFlux( nglface ) += emis( nglface ) * ( Rmir - sigma * pow_4( tin ) ) + DHcIn * tin;
+
+		// thetas = FaceTemp0 + Sens*( FaceFlux - DHc*thetas ), with DHc nonzero on the outer faces only
+		Aresp = 0.0;
+		for ( i = 1; i <= nglface; ++i ) {
+			thetas( i ) = FaceTemp0( i );
+			Aresp( i, i ) = 1.0;
+			for ( j = 1; j <= nglface; ++j ) {
+				Sens = Wgt11 * table.FaceSens( IOut, IIn, i, j ) + Wgt21 * table.FaceSens( IOut + 1, IIn, i, j ) + Wgt12 * table.FaceSens( IOut, IIn + 1, i, j ) + Wgt22 * table.FaceSens( IOut + 1, IIn + 1, i, j );
+				thetas( i ) += Sens * FaceFlux( j );
+				if ( j == 1 ) Aresp( 1, i ) += Sens * DHcOut;
+				if ( j == nglface ) Aresp( nglface, i ) += Sens * DHcIn;
+			}
+		}
+		LUdecomposition( Aresp, nglface, InterpolateWindowResponse_indx, d );
+		LUsolution( Aresp, nglface, InterpolateWindowResponse_indx, thetas );
+
+	}
+
+	//****************************************************************************
+
+	void
+	SetupWindowResponseTable(
+		int const SurfNum, // Surface number
+		int const TableNum // Response table number
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Fills the response table used by InterpolateWindowResponse for the bare glazing
+		// whose layer and gas properties are currently loaded in the module arrays.
+
+		// METHODOLOGY EMPLOYED:
+		// At each grid point the glazing heat balance is solved to tight tolerance for the tabulated
+		// film conductances, black-body surrounds at the air temperatures and no absorbed radiation.
+		// The response to absorbed radiation is found by solving again with a flux step on each
+		// face in turn (one-sided finite differences).
+
+		// REFERENCES:
+		// na
+
+		// Locals
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const FluxStep( 10.0 ); // Absorbed flux step for the face temperature response (W/m2)
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Array1D< Real64 > AbsFace( nglface, 0.0 ); // Radiation absorbed by each face (W/m2)
+		Array1D< Real64 > FaceTemp( nglface ); // Face temperatures without absorbed radiation (K)
+		Array1D< Real64 > FaceTempPert( nglface ); // Face temperatures with a flux step on one face (K)
+		int IOut; // Outside air temperature grid index
+		int IIn; // Inside air temperature grid index
+		int i; // Face counter
+		int j; // Absorbing face counter
+		Real64 ToutK; // Outside air temperature at the grid point (K)
+		Real64 TinK; // Inside air temperature at the grid point (K)
+
+		auto & table( WindowResponseTable( TableNum ) );
+		table.FaceTemp.allocate( NumRespTout, NumRespTin, nglface );
+		table.FaceSens.allocate( NumRespTout, NumRespTin, nglface, nglface );
+
+		for ( IOut = 1; IOut <= NumRespTout; ++IOut ) {
+			ToutK = RespToutMin + ( IOut - 1 ) * RespTempStep;
+			for ( IIn = 1; IIn <= NumRespTin; ++IIn ) {
+				TinK = RespTinMin + ( IIn - 1 ) * RespTempStep;
+				AbsFace = 0.0;
+				SolveBareGlazingTemps( SurfNum, ToutK, TinK, AbsFace, FaceTemp );
+				for ( i = 1; i <= nglface; ++i ) {
+					table.FaceTemp( IOut, IIn, i ) = FaceTemp( i );
+				}
+				for ( j = 1; j <= nglface; ++j ) {
+					AbsFace = 0.0;
+					AbsFace( j ) = FluxStep;
+					SolveBareGlazingTemps( SurfNum, ToutK, TinK, AbsFace, FaceTempPert );
+					for ( i = 1; i <= nglface; ++i ) {
+						table.FaceSens( IOut, IIn, i, j ) = ( FaceTempPert( i ) - FaceTemp( i ) ) / FluxStep;
+					}
+				}
+			}
+		}
+
+	}
+
+	//****************************************************************************
+
+	void
+	SolveBareGlazingTemps(
+		int const SurfNum, // Surface number
+		Real64 const ToutK, // Outside air and surround temperature (K)
+		Real64 const TinK, // Inside air and surround temperature (K)
+		Array1< Real64 > const & AbsFace, // Radiation absorbed by each glass face (W/m2)
+		Array1< Real64 > & FaceTemp // Converged glass face temperatures (K)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solves the face heat balance of bare glazing (1 to 4 glass layers, no gap airflow)
+		// for the film conductances and black-body surrounds of the window response tables.
+
+		// METHODOLOGY EMPLOYED:
+		// Same equations, relaxation and linear solver as the bare glazing cases of
+		// SolveForWindowTemperatures, assembled layer by layer and gap by gap, iterated to a
+		// tighter tolerance so that finite differences of the result are meaningful.
+
+		// REFERENCES:
+		// na
+
+		// Locals
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const MaxIterations( 200 ); // Maximum allowed number of iterations
+		Real64 const errtemptol( 1.0e-6 ); // Tolerance on the mean face temperature change (K)
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Array1D< Real64 > const GapAP( 3, { A23P, A45P, A67P } ); // Gap radiation factors of the outer face
+		Array1D< Real64 > const GapAQ( 3, { A32P, A54P, A76P } ); // Gap radiation factors of the inner face
+		Array1D< Real64 > const GapA( 3, { A23, A45, A67 } ); // Gap radiation factors for the edge-of-glass correction
+		Real64 const EdgeGlCorrFac( SurfaceWindow( SurfNum ).EdgeGlCorrFac );
+		int iter; // Iteration number
+		int i; // Face counter
+		int k; // Glass layer or gap counter
+		int l; // Face on the outside of a gap
+		int r; // Face on the inside of a gap
+		Real64 d; // +1 if number of row interchanges is even, -1 if odd (in LU decomposition)
+		Real64 con; // Gap gas conductivity
+		Real64 pr; // Gap gas Prandtl number
+		Real64 gr; // Grashof number of gas in a gap
+		Real64 nu; // Gap gas Nusselt number
+		Real64 hgap; // Gap gas conductance (W/m2-K)
+		Real64 TempPrev; // Face temperature of the previous iteration (K)
+		Real64 errtemp; // Mean face temperature change over the iteration (K)
+
+		for ( i = 1; i <= nglface; ++i ) {
+			FaceTemp( i ) = ToutK + ( TinK - ToutK ) * i / ( nglface + 1 );
+		}
+
+		errtemp = errtemptol * 2.0;
+		iter = 0;
+		while ( iter < MaxIterations && errtemp > errtemptol ) {
+			++iter;
+			SolveBareGlazingTempsAface = 0.0;
+			for ( i = 1; i <= nglface; ++i ) {
+				SolveBareGlazingTemps_hr( i ) = emis( i ) * sigma * pow_3( FaceTemp( i ) );
+				SolveBareGlazingTempsBface( i ) = AbsFace( i );
+			}
+
+			SolveBareGlazingTempsBface( 1 ) += emis( 1 ) * sigma * pow_4( ToutK ) + RespHcOut * ToutK;
+			SolveBareGlazingTempsBface( nglface ) += emis( nglface ) * sigma * pow_4( TinK ) + RespHcIn * TinK;
+			SolveBareGlazingTempsAface( 1, 1 ) += SolveBareGlazingTemps_hr( 1 ) + RespHcOut;
+			SolveBareGlazingTempsAface( nglface, nglface ) += SolveBareGlazingTemps_hr( nglface ) + RespHcIn;
+
+			for ( k = 1; k <= ngllayer; ++k ) {
+				l = 2 * k - 1;
+				r = 2 * k;
+				SolveBareGlazingTempsAface( l, l ) += scon( k );
+				SolveBareGlazingTempsAface( r, l ) -= scon( k );
+				SolveBareGlazingTempsAface( l, r ) -= scon( k );
+				SolveBareGlazingTempsAface( r, r ) += scon( k );
+			}
+
+			for ( k = 1; k < ngllayer; ++k ) {
+				l = 2 * k;
+				r = 2 * k + 1;
+				WindowGasConductance( FaceTemp( l ), FaceTemp( r ), k, con, pr, gr );
+				NusseltNumber( SurfNum, FaceTemp( l ), FaceTemp( r ), k, gr, pr, nu );
+				hgap = con / gap( k ) * nu;
+				if ( EdgeGlCorrFac > 1.0 ) { // Edge of glass correction
+					hrgap( k ) = 0.5 * std::abs( GapA( k ) ) * pow_3( FaceTemp( l ) + FaceTemp( r ) );
+					hgap = hgap * EdgeGlCorrFac + hrgap( k ) * ( EdgeGlCorrFac - 1.0 );
+				}
+				SolveBareGlazingTempsAface( l, l ) += hgap - GapAP( k ) * SolveBareGlazingTemps_hr( l );
+				SolveBareGlazingTempsAface( r, l ) += -hgap - GapAQ( k ) * SolveBareGlazingTemps_hr( r );
+				SolveBareGlazingTempsAface( l, r ) += -hgap + GapAP( k ) * SolveBareGlazingTemps_hr( l );
+				SolveBareGlazingTempsAface( r, r ) += hgap + GapAQ( k ) * SolveBareGlazingTemps_hr( r );
+			}
+
+			LUdecomposition( SolveBareGlazingTempsAface, nglface, SolveBareGlazingTemps_indx, d );
+			LUsolution( SolveBareGlazingTempsAface, nglface, SolveBareGlazingTemps_indx, SolveBareGlazingTempsBface );
+
+			errtemp = 0.0;
+			for ( i = 1; i <= nglface; ++i ) {
+				TempPrev = FaceTemp( i );
+				if ( iter < MaxIterations / 4 ) {
+					FaceTemp( i ) = 0.5 * FaceTemp( i ) + 0.5 * SolveBareGlazingTempsBface( i );
+				} else {
+					FaceTemp( i ) = 0.75 * FaceTemp( i ) + 0.25 * SolveBareGlazingTempsBface( i );
+				}
+				errtemp += std::abs( FaceTemp( i ) - TempPrev );
+			}
+			errtemp /= nglface;
+		}
+
+	}
+
+	//****************************************************************************
+
 	void
 	ExtOrIntShadeNaturalFlow(
 		int const SurfNum, // Surface number
@@ -4401,7 +4827,6 @@ namespace WindowManager {
 		int k;
 		int imax; // Temporary variable
 		//   as output: decomposed matrix
-		static Array1D< Real64 > vv( 10 ); // Stores the implicit scaling of each row //Tuned Made static
 		Real64 aamax; // Absolute value of largest element of matrix
 		Real64 dum; // Temporary variable
 		Real64 sum; // Sum of products of matrix elements
@@ -4587,14 +5012,9 @@ namespace WindowManager {
 		int j;
 		int NMix; // Number of gases in a mixture
 		Real64 molmix; // Molecular weight of mixture
-		static Array1D< Real64 > kprime( 10 ); // Monotonic thermal conductivity
-		static Array1D< Real64 > kdblprm( 10 ); // Conductivity term accounting for additional energy moved by
 		//  the diffusional transport of internal energy in polyatomic gases.
 		Real64 kpmix; // Monotonic thermal conductivity of mixture
 		Real64 kdpmix;
-		static Array1D< Real64 > mukpdwn( 10 ); // Denominator term
-		static Array1D< Real64 > kpdown( 10 ); // Denominator terms
-		static Array1D< Real64 > kdpdown( 10 );
 		Real64 kmix; // For accumulating conductance of gas mixture
 		Real64 mumix; // For accumulating viscosity of gas mixture
 		Real64 visc( 0.0 ); // Dynamic viscosity of mixture at tmean (g/m-s)
@@ -4607,11 +5027,6 @@ namespace WindowManager {
 		Real64 psiterm; // Factor
 		Real64 phikup; // Numerator factor
 		Real64 rhomix; // Density of gas mixture (kg/m3)
-		static Array1D< Real64 > frct( 10 ); // Fraction of each gas in a mixture
-		static Array1D< Real64 > fvis( 10 ); // Viscosity of each gas in a mixture (g/m-s)
-		static Array1D< Real64 > fcon( 10 ); // Conductance of each gas in a mixture (W/m2-K)
-		static Array1D< Real64 > fdens( 10 ); // Density of each gas in a mixture (kg/m3)
-		static Array1D< Real64 > fcp( 10 ); // Specific heat of each gas in a mixture (J/m3-K)
 
 		NMix = gnmix( IGap ); //Autodesk:Logic Either assert NMix>0 or handle NMix<=0 in logic so that con and locals guar. initialized before use
 
@@ -4863,7 +5278,6 @@ namespace WindowManager {
 
 		int i; // Face counter
 		int ShadeFlag; // Shading flag
-		static Array1D< Real64 > rguess( 11 ); // Combined radiative/convective resistance (m2-K/W) of //Tuned Made static
 		// inside or outside air film, or gap
 		Real64 restot; // Total window resistance including outside
 		//   and inside air films (m2-K/W)
@@ -7252,11 +7666,6 @@ namespace WindowManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool DoReport( false );
-		static bool HasWindows( false );
-		static bool HasComplexWindows( false );
-		static bool HasEQLWindows( false ); // equivalent layer window defined
-		static Real64 TempVar( 0.0 ); // just temporary usage for complex fenestration
 
 		int ThisNum;
 		int Layer;
@@ -8892,7 +9301,6 @@ Label99999: ;
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool ErrorsFound( false ); // If errors detected in input
 		int NumAlphas; // Number of Alphas for each GetobjectItem call
 		int NumNumbers; // Number of Numbers for each GetobjectItem call
 		int NumArgs;
@@ -8900,13 +9308,9 @@ Label99999: ;
 		Array1D_string cAlphaArgs; // Alpha input items for object
 		Array1D< Real64 > rNumericArgs; // Numeric input items for object
 
-		static bool RunMeOnceFlag( false ); // This subroutine only needs to be run once
 		std::string cCurrentModuleObject;
 		std::string cSolarSpectrum;
 		std::string cVisibleSpectrum;
-		static int iSolarSpectrum( 0 );
-		static int iVisibleSpectrum( 0 );
-		static int NumSiteSpectrum( 0 );
 		int Loop;
 		int iTmp;
 
@@ -63,6 +63,7 @@
 #include <ObjexxFCL/Array1A.hh>
 #include <ObjexxFCL/Array2A.hh>
 #include <ObjexxFCL/Array3D.hh>
+#include <ObjexxFCL/Array4D.hh>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
@@ -195,6 +196,43 @@ namespace WindowManager {
 	extern Array1D< Real64 > rbvisPhi; // Glazing system visible back reflectance for each angle of incidence
 	extern Array1D< Real64 > CosPhiIndepVar; // Cos of incidence angles at 10-deg increments for curve fits
 
+	// Grid of the bare window response tables (used if WindowTablesEnvFlag is set)
+	extern int const NumRespTout; // Number of outside air temperatures in a response table
+	extern int const NumRespTin; // Number of inside air temperatures in a response table
+	extern Real64 const RespToutMin; // Lowest outside air temperature in a response table (K)
+	extern Real64 const RespTinMin; // Lowest inside air temperature in a response table (K)
+	extern Real64 const RespTempStep; // Air temperature increment in a response table (K)
+	extern Real64 const RespHcOut; // Outside film conductance of the tabulated conditions (W/m2-K)
+	extern Real64 const RespHcIn; // Inside film conductance of the tabulated conditions (W/m2-K)
+
+	// Types
+
+	struct WindowResponseTableData
+	{
+		// Members
+		int ConstrNum; // Bare window construction the table was built for
+		Real64 Height; // Window height (m); sets the gap aspect ratio
+		Real64 Tilt; // Window tilt (deg)
+		Real64 EdgeGlCorrFac; // Edge-of-glass correction factor of the windows sharing the table
+		Array3D< Real64 > FaceTemp; // Converged face temperatures (K) at each (outside air temp, inside air temp)
+		//  for the tabulated film conductances, black-body surrounds and no absorbed radiation
+		Array4D< Real64 > FaceSens; // Face temperature response to radiation absorbed at each face (m2-K/W),
+		//  (outside air temp, inside air temp, face, absorbing face)
+
+		// Default Constructor
+		WindowResponseTableData() :
+			ConstrNum( 0 ),
+			Height( 0.0 ),
+			Tilt( 0.0 ),
+			EdgeGlCorrFac( 1.0 )
+		{}
+
+	};
+
+	// Object Data
+	extern Array1D< WindowResponseTableData > WindowResponseTable; // Response tables shared by similar bare windows
+	extern Array1D_int WindowResponseTableNum; // Response table used by each window surface (0 if none yet)
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE WindowManager:
 	//   Optical Calculation Routines
 	//   Heat Balance Routines
@@ -286,6 +324,30 @@ namespace WindowManager {
 
 	//****************************************************************************
 
+	void
+	InterpolateWindowResponse( int const SurfNum ); // Surface number
+
+	//****************************************************************************
+
+	void
+	SetupWindowResponseTable(
+		int const SurfNum, // Surface number
+		int const TableNum // Response table number
+	);
+
+	//****************************************************************************
+
+	void
+	SolveBareGlazingTemps(
+		int const SurfNum, // Surface number
+		Real64 const ToutK, // Outside air and surround temperature (K)
+		Real64 const TinK, // Inside air and surround temperature (K)
+		Array1< Real64 > const & AbsFace, // Radiation absorbed by each glass face (W/m2)
+		Array1< Real64 > & FaceTemp // Converged glass face temperatures (K)
+	);
+
+	//****************************************************************************
+
 	void
 	ExtOrIntShadeNaturalFlow(
 		int const SurfNum, // Surface number
@@ -130,6 +130,19 @@ namespace ZoneAirLoopEquipmentManager {
 
 		Array1D_bool EachOnceFlag;
 
+		Array1D_string AlphArray( 4 ); //Tuned Made static
+		Array1D< Real64 > NumArray( 2 ); //Tuned Made static
+		bool ErrorsFound( false ); // If errors detected in input
+		Array1D_string cAlphaFields( 4 ); // Alpha field names //Tuned Made static
+		Array1D_string cNumericFields( 2 ); // Numeric field names //Tuned Made static
+		Array1D_bool lAlphaBlanks( 4 ); // Logical array, alpha field input BLANK = .TRUE. //Tuned Made static
+		Array1D_bool lNumericBlanks( 2 ); // Logical array, numeric field input BLANK = .TRUE. //Tuned Made static
+		int ATMixerPriNode( 0 ); // primary air inlet node for air terminal mixers
+		int ATMixerTypeNum( 0 ); // terminal mixer type number
+		int AirLoopNum( 0 ); // index of air loop
+		Real64 DesFlowRatio( 0.0 ); // ratio of system to sum of zones design flow rate
+		Real64 SpecHumOut( 0.0 ); // Specific humidity ratio of outlet air (kg moisture / kg moist air)
+		Real64 SpecHumIn( 0.0 ); // Specific humidity ratio of inlet air (kg moisture / kg moist air)
 	}
 
 	// DERIVED TYPE DEFINITIONS:
@@ -160,6 +173,19 @@ namespace ZoneAirLoopEquipmentManager {
 		MyOneTimeFlag = true;
 
 		InitAirDistUnitsFlag = true;
+		AlphArray = Array1D_string( 4 );
+		NumArray = Array1D< Real64 >( 2 );
+		ErrorsFound = false;
+		cAlphaFields = Array1D_string( 4 );
+		cNumericFields = Array1D_string( 2 );
+		lAlphaBlanks = Array1D_bool( 4 );
+		lNumericBlanks = Array1D_bool( 2 );
+		ATMixerPriNode = 0;
+		ATMixerTypeNum = 0;
+		AirLoopNum = 0;
+		DesFlowRatio = 0.0;
+		SpecHumOut = 0.0;
+		SpecHumIn = 0.0;
 	}
 
 	void
@@ -302,18 +328,9 @@ namespace ZoneAirLoopEquipmentManager {
 		int NumAlphas;
 		int NumNums;
 		int IOStat;
-		static Array1D_string AlphArray( 4 ); //Tuned Made static
-		static Array1D< Real64 > NumArray( 2 ); //Tuned Made static
-		static bool ErrorsFound( false ); // If errors detected in input
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
-		static Array1D_string cAlphaFields( 4 ); // Alpha field names //Tuned Made static
-		static Array1D_string cNumericFields( 2 ); // Numeric field names //Tuned Made static
-		static Array1D_bool lAlphaBlanks( 4 ); // Logical array, alpha field input BLANK = .TRUE. //Tuned Made static
-		static Array1D_bool lNumericBlanks( 2 ); // Logical array, numeric field input BLANK = .TRUE. //Tuned Made static
 		bool DualDuctRecircIsUsed; // local temporary for deciding if recirc side used by dual duct terminal
-		static int ATMixerPriNode( 0 ); // primary air inlet node for air terminal mixers
-		static int ATMixerTypeNum( 0 ); // terminal mixer type number
 		// make sure the input data is read in only once
 		if ( ! GetAirDistUnitsFlag ) {
 			return;
@@ -654,15 +671,11 @@ namespace ZoneAirLoopEquipmentManager {
 		int AirDistCompNum;
 		int InNodeNum; // air distribution unit inlet node
 		int OutNodeNum; // air distribution unit outlet node
-		static int AirLoopNum( 0 ); // index of air loop
 		Real64 CpAirZn;
 		Real64 CpAirSys;
 		Real64 MassFlowRateMaxAvail; // max avail mass flow rate excluding leaks [kg/s]
 		Real64 MassFlowRateMinAvail; // min avail mass flow rate excluding leaks [kg/s]
 		Real64 MassFlowRateUpStreamLeakMax; // max upstream leak flow rate [kg/s]
-		static Real64 DesFlowRatio( 0.0 ); // ratio of system to sum of zones design flow rate
-		static Real64 SpecHumOut( 0.0 ); // Specific humidity ratio of outlet air (kg moisture / kg moist air)
-		static Real64 SpecHumIn( 0.0 ); // Specific humidity ratio of inlet air (kg moisture / kg moist air)
 
 		ProvideSysOutput = true;
 		for ( AirDistCompNum = 1; AirDistCompNum <= AirDistUnit( AirDistUnitNum ).NumComponents; ++AirDistCompNum ) {
@@ -155,6 +155,21 @@ namespace ZoneContaminantPredictorCorrector {
 
 	// SUBROUTINE SPECIFICATIONS:
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		bool ErrorsFound( false );
+		bool GetZoneContaminanSetPointsErrorsFound( false );
+		bool MyOneTimeFlag( true );
+		bool MyEnvrnFlag( true );
+		bool MyDayFlag( true );
+		bool MyConfigOneTimeFlag( true );
+		bool InitZoneContSetPointsErrorsFound( false );
+	}
+
 	// Functions
 
 	void
@@ -168,6 +183,13 @@ namespace ZoneContaminantPredictorCorrector {
 		TotGCBLDiff = 0;
 		TotGCDVS = 0;
 		TotGCDRS = 0;
+		ErrorsFound = false;
+		GetZoneContaminanSetPointsErrorsFound = false;
+		MyOneTimeFlag = true;
+		MyEnvrnFlag = true;
+		MyDayFlag = true;
+		MyConfigOneTimeFlag = true;
+		InitZoneContSetPointsErrorsFound = false;
 	}
 
 	void
@@ -306,7 +328,6 @@ namespace ZoneContaminantPredictorCorrector {
 		int MaxNumber;
 		int Loop;
 		int ZonePtr;
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		//  LOGICAL :: ValidScheduleType
@@ -961,7 +982,6 @@ namespace ZoneContaminantPredictorCorrector {
 		int IOStat;
 		//unused1208  REAL(r64), DIMENSION(2) :: NumArray
 		//unused1208  CHARACTER(len=MaxNameLength), DIMENSION(29) :: AlphArray
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool ValidScheduleType;
@@ -1008,7 +1028,7 @@ namespace ZoneContaminantPredictorCorrector {
 			IsBlank = false;
 			VerifyName( cAlphaArgs( 1 ), ContaminantControlledZone, ContControlledZoneNum - 1, IsNotOK, IsBlank, cCurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
-				ErrorsFound = true;
+				GetZoneContaminanSetPointsErrorsFound = true;
 				if ( IsBlank ) cAlphaArgs( 1 ) = "xxxxx";
 			}
 			ContaminantControlledZone( ContControlledZoneNum ).Name = cAlphaArgs( 1 );
@@ -1016,7 +1036,7 @@ namespace ZoneContaminantPredictorCorrector {
 			ContaminantControlledZone( ContControlledZoneNum ).ActualZoneNum = FindItemInList( cAlphaArgs( 2 ), Zone );
 			if ( ContaminantControlledZone( ContControlledZoneNum ).ActualZoneNum == 0 ) {
 				ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid " + cAlphaFieldNames( 2 ) + "=\"" + cAlphaArgs( 2 ) + "\" not found." );
-				ErrorsFound = true;
+				GetZoneContaminanSetPointsErrorsFound = true;
 			} else {
 				//      Zone(ContaminantControlledZone(ContControlledZoneNum)%ActualZoneNum)%TempControlledZoneIndex = ContControlledZoneNum
 			}
@@ -1028,14 +1048,14 @@ namespace ZoneContaminantPredictorCorrector {
 				ContaminantControlledZone( ContControlledZoneNum ).AvaiSchedPtr = GetScheduleIndex( cAlphaArgs( 3 ) );
 				if ( ContaminantControlledZone( ContControlledZoneNum ).AvaiSchedPtr == 0 ) {
 					ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid " + cAlphaFieldNames( 3 ) + "=\"" + cAlphaArgs( 3 ) + "\" not found." );
-					ErrorsFound = true;
+					GetZoneContaminanSetPointsErrorsFound = true;
 				} else {
 					// Check validity of control types.
 					ValidScheduleType = CheckScheduleValueMinMax( ContaminantControlledZone( ContControlledZoneNum ).AvaiSchedPtr, ">=", 0.0, "<=", 1.0 );
 					if ( ! ValidScheduleType ) {
 						ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid range " + cAlphaFieldNames( 3 ) + "=\"" + cAlphaArgs( 3 ) + "\"" );
 						ShowContinueError( "..contains values outside of range [0,1]." );
-						ErrorsFound = true;
+						GetZoneContaminanSetPointsErrorsFound = true;
 					} else {
 						Zone( ContaminantControlledZone( ContControlledZoneNum ).ActualZoneNum ).ZoneContamControllerSchedIndex = ContaminantControlledZone( ContControlledZoneNum ).AvaiSchedPtr;
 					}
@@ -1046,14 +1066,14 @@ namespace ZoneContaminantPredictorCorrector {
 			ContaminantControlledZone( ContControlledZoneNum ).SPSchedIndex = GetScheduleIndex( cAlphaArgs( 4 ) );
 			if ( ContaminantControlledZone( ContControlledZoneNum ).SPSchedIndex == 0 ) {
 				ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid " + cAlphaFieldNames( 4 ) + "=\"" + cAlphaArgs( 4 ) + "\" not found." );
-				ErrorsFound = true;
+				GetZoneContaminanSetPointsErrorsFound = true;
 			} else {
 				// Check validity of control types.
 				ValidScheduleType = CheckScheduleValueMinMax( ContaminantControlledZone( ContControlledZoneNum ).SPSchedIndex, ">=", 0.0, "<=", 2000.0 );
 				if ( ! ValidScheduleType ) {
 					ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid range " + cAlphaFieldNames( 4 ) + "=\"" + cAlphaArgs( 4 ) + "\"" );
 					ShowContinueError( "..contains values outside of range [0,2000 ppm]." );
-					ErrorsFound = true;
+					GetZoneContaminanSetPointsErrorsFound = true;
 				}
 			}
 
@@ -1065,7 +1085,7 @@ namespace ZoneContaminantPredictorCorrector {
 				if ( ! ValidScheduleType ) {
 					ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid range " + cAlphaFieldNames( 5 ) + "=\"" + cAlphaArgs( 5 ) + "\"" );
 					ShowContinueError( "..contains values outside of range [0,2000 ppm]." );
-					ErrorsFound = true;
+					GetZoneContaminanSetPointsErrorsFound = true;
 				} else {
 					Zone( ContaminantControlledZone( ContControlledZoneNum ).ActualZoneNum ).ZoneMinCO2SchedIndex = ContaminantControlledZone( ContControlledZoneNum ).ZoneMinCO2SchedIndex;
 				}
@@ -1079,33 +1099,33 @@ namespace ZoneContaminantPredictorCorrector {
 					ContaminantControlledZone( ContControlledZoneNum ).GCAvaiSchedPtr = GetScheduleIndex( cAlphaArgs( 6 ) );
 					if ( ContaminantControlledZone( ContControlledZoneNum ).AvaiSchedPtr == 0 ) {
 						ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid " + cAlphaFieldNames( 3 ) + "=\"" + cAlphaArgs( 6 ) + "\" not found." );
-						ErrorsFound = true;
+						GetZoneContaminanSetPointsErrorsFound = true;
 					} else {
 						// Check validity of control types.
 						ValidScheduleType = CheckScheduleValueMinMax( ContaminantControlledZone( ContControlledZoneNum ).GCAvaiSchedPtr, ">=", 0.0, "<=", 1.0 );
 						if ( ! ValidScheduleType ) {
 							ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid range " + cAlphaFieldNames( 3 ) + "=\"" + cAlphaArgs( 6 ) + "\"" );
 							ShowContinueError( "..contains values outside of range [0,1]." );
-							ErrorsFound = true;
+							GetZoneContaminanSetPointsErrorsFound = true;
 						}
 					}
 				}
 				if ( lAlphaFieldBlanks( 7 ) ) {
 					ShowSevereError( cCurrentModuleObject + " \"" + cAlphaArgs( 7 ) + "\" is required, but blank." );
-					ErrorsFound = true;
+					GetZoneContaminanSetPointsErrorsFound = true;
 				} else {
 					ContaminantControlledZone( ContControlledZoneNum ).GCSetPointSchedName = cAlphaArgs( 7 );
 					ContaminantControlledZone( ContControlledZoneNum ).GCSPSchedIndex = GetScheduleIndex( cAlphaArgs( 7 ) );
 					if ( ContaminantControlledZone( ContControlledZoneNum ).GCSPSchedIndex == 0 ) {
 						ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" invalid " + cAlphaFieldNames( 7 ) + "=\"" + cAlphaArgs( 7 ) + "\" not found." );
-						ErrorsFound = true;
+						GetZoneContaminanSetPointsErrorsFound = true;
 					}
 				}
 			}
 
 		} // ContControlledZoneNum
 
-		if ( ErrorsFound ) {
+		if ( GetZoneContaminanSetPointsErrorsFound ) {
 			ShowFatalError( "Errors getting Zone Contaminant Control input data.  Preceding condition(s) cause termination." );
 		}
 
@@ -1159,20 +1179,15 @@ namespace ZoneContaminantPredictorCorrector {
 		int Loop;
 		int ZoneNum;
 		int SurfNum;
-		static bool MyOneTimeFlag( true );
-		static bool MyEnvrnFlag( true );
-		static bool MyDayFlag( true );
 		//  REAL(r64)      :: CO2Gain                  ! Zone CO2 gain
 		Real64 GCGain; // Zone generic contaminant gain
 		Real64 Pi; // Pressue at zone i
 		Real64 Pj; // Pressue at zone j
 		Real64 Sch; // Schedule value
 		Real64 Cs; // Surface concentration level for the Boundary Layer Diffusion Controlled Model
-		static bool MyConfigOneTimeFlag( true );
 		int AirLoopNum;
 		int ContZoneNum;
 		int I;
-		static bool ErrorsFound( false );
 
 		// FLOW:
 
@@ -1360,11 +1375,11 @@ namespace ZoneContaminantPredictorCorrector {
 					}
 				} else {
 					ShowSevereError( "ZoneControl:ContaminantController: a corresponding AirLoopHVAC is not found for the controlled zone =" + Zone( ZoneNum ).Name );
-					ErrorsFound = true;
+					InitZoneContSetPointsErrorsFound = true;
 				}
 			}
 			MyConfigOneTimeFlag = false;
-			if ( ErrorsFound ) {
+			if ( InitZoneContSetPointsErrorsFound ) {
 				ShowFatalError( "ZoneControl:ContaminantController: Program terminates for preceding reason(s)." );
 			}
 		}
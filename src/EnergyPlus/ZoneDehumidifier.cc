@@ -169,6 +169,23 @@ namespace ZoneDehumidifier {
 	// Object Data
 	Array1D< ZoneDehumidifierData > ZoneDehumid;
 
+	namespace {
+	// These were static variables within different functions. They were pulled out into the namespace
+	// to facilitate easier unit testing of those functions.
+	// These are purposefully not in the header file as an extern variable. No one outside of this module should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		int NumAlphas( 0 ); // Number of Alphas to allocate arrays, then used for each GetObjectItem call
+		int NumNumbers( 0 ); // Number of Numbers to allocate arrays, then used for each GetObjectItem call
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max)
+		Array1D_bool MyEnvrnFlag; // Used for initializations each begin environment flag
+		bool MyOneTimeFlag( true ); // initialization flag
+		bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
+		int AirInletNodeNum( 0 ); // Node number for the inlet air to the dehumidifier
+		int AirOutletNodeNum( 0 ); // Node number for the outlet air from the dehumidifier
+	}
+
 	// Functions
 
 	void
@@ -178,6 +195,15 @@ namespace ZoneDehumidifier {
 		GetInputFlag = true;
 		CheckEquipName.deallocate();
 		ZoneDehumid.deallocate();
+		NumAlphas = 0;
+		NumNumbers = 0;
+		ErrorsFound = false;
+		TotalArgs = 0;
+		MyEnvrnFlag.deallocate();
+		MyOneTimeFlag = true;
+		ZoneEquipmentListChecked = false;
+		AirInletNodeNum = 0;
+		AirOutletNodeNum = 0;
 	}
 
 	void
@@ -316,10 +342,7 @@ namespace ZoneDehumidifier {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ZoneDehumidIndex; // Loop index
-		static int NumAlphas( 0 ); // Number of Alphas to allocate arrays, then used for each GetObjectItem call
-		static int NumNumbers( 0 ); // Number of Numbers to allocate arrays, then used for each GetObjectItem call
 		int IOStatus; // Used in GetObjectItem
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		Array1D_string Alphas; // Alpha input items for object
@@ -328,7 +351,6 @@ namespace ZoneDehumidifier {
 		Array1D< Real64 > Numbers; // Numeric input items for object
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static int TotalArgs( 0 ); // Total number of alpha and numeric arguments (max)
 		Real64 CurveVal; // Output from curve object (water removal or energy factor curves)
 
 		NumDehumidifiers = GetNumObjectsFound( CurrentModuleObject );
@@ -597,10 +619,7 @@ namespace ZoneDehumidifier {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array1D_bool MyEnvrnFlag; // Used for initializations each begin environment flag
 		//  LOGICAL, ALLOCATABLE, SAVE, DIMENSION(:) :: MySizeFlag  ! Used for sizing zone dehumidifier inputs one time
-		static bool MyOneTimeFlag( true ); // initialization flag
-		static bool ZoneEquipmentListChecked( false ); // True after the Zone Equipment List has been checked for items
 		int LoopIndex; // DO loop index
 		int AirInletNode; // Inlet air node number
 		Real64 RatedAirHumrat; // Humidity ratio (kg/kg) at rated inlet air conditions of 26.6667C, 60% RH
@@ -774,8 +793,6 @@ namespace ZoneDehumidifier {
 		Real64 hfg; // Enthalpy of evaporation of inlet air (J/kg)
 		Real64 AirMassFlowRate; // Air mass flow rate through this dehumidifier (kg/s)
 		Real64 Cp; // Heat capacity of inlet air (J/kg-C)
-		static int AirInletNodeNum( 0 ); // Node number for the inlet air to the dehumidifier
-		static int AirOutletNodeNum( 0 ); // Node number for the outlet air from the dehumidifier
 
 		SensibleOutput = 0.0;
 		LatentOutput = 0.0;
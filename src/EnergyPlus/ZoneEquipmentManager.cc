@@ -199,6 +199,18 @@ namespace ZoneEquipmentManager {
 		bool InitZoneEquipmentOneTimeFlag( true );
 		bool InitZoneEquipmentEnvrnFlag( true );
 		bool FirstPassZoneEquipFlag( true ); // indicates first pass through zone equipment, used to reset selected ZoneEqSizing variables
+		Real64 OAFromPeople( 0.0 ); // min OA calculated from zone occupancy [m3/s]
+		Real64 OAFromArea( 0.0 ); // min OA calculated from zone area and OA flow per area [m3/s]
+		bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
+		Real64 SchMax( 0.0 ); // maximum people multiplier value
+		bool SupPathInletChanged( false );
+		bool FirstCall; // indicates first call to supply air path components
+		bool MyOneTimeFlag( true );
+		bool ValidSAMComp( false );
+		bool ZoneHasAirLoopHVACTerminal( false ); // true if zone has an air loop terminal
+		bool ZoneHasAirLoopHVACDirectAir( false ); // true if zone has an uncontrolled air loop terminal
+		Array1D_bool DirectAirAndAirTerminalWarningIssued; // only warn once for each zone with problems
+		int GetStandAloneERVNodesZoneNum(0); // zone index
 	}
 
 	Array1D< Real64 > AvgData; // scratch array for storing averaged data
@@ -226,6 +238,18 @@ namespace ZoneEquipmentManager {
 		PrioritySimOrder.deallocate();
 		FirstPassZoneEquipFlag = true;
 		reportDOASZoneSizingHeader = true;
+		OAFromPeople = 0.0;
+		OAFromArea = 0.0;
+		ErrorsFound = false;
+		SchMax = 0.0;
+		SupPathInletChanged = false;
+		FirstCall = false;
+		MyOneTimeFlag = true;
+		ValidSAMComp = false;
+		ZoneHasAirLoopHVACTerminal = false;
+		ZoneHasAirLoopHVACDirectAir = false;
+		DirectAirAndAirTerminalWarningIssued.deallocate();
+		GetStandAloneERVNodesZoneNum = 0;
 	}
 
 	void
@@ -987,12 +1011,8 @@ namespace ZoneEquipmentManager {
 		int TimeStepIndex; // zone time step index
 		Real64 TotPeopleInZone; // total (maximum) number of people in a zone
 		int PeopleNum; // index of People structure
-		static Real64 OAFromPeople( 0.0 ); // min OA calculated from zone occupancy [m3/s]
-		static Real64 OAFromArea( 0.0 ); // min OA calculated from zone area and OA flow per area [m3/s]
 		int ZoneIndex; // index of Zone Sizing zone name in zone array
 		int ZoneSizIndex; // zone sizing do loop index
-		static bool ErrorsFound( false ); // Set to true if errors in input, fatal at end of routine
-		static Real64 SchMax( 0.0 ); // maximum people multiplier value
 		Real64 OAVolumeFlowRate; // outside air flow rate (m3/s)
 		bool UseOccSchFlag; // flag to use occupancy schedule when calculating OA
 		bool UseMinOASchFlag; // flag to use min OA schedule when calculating OA
@@ -3050,19 +3070,12 @@ namespace ZoneEquipmentManager {
 		int ZoneEquipTypeNum;
 		int ZoneCompNum;
 
-		static bool SupPathInletChanged( false );
-		static bool FirstCall; // indicates first call to supply air path components
-		static bool MyOneTimeFlag( true );
 		bool ErrorFlag;
-		static bool ValidSAMComp( false );
 
 		Real64 SysOutputProvided; // sensible output delivered by zone equipment (W)
 		Real64 LatOutputProvided; // latent output delivered by zone equipment (kg/s)
 		Real64 AirSysOutput;
 		Real64 NonAirSysOutput;
-		static bool ZoneHasAirLoopHVACTerminal( false ); // true if zone has an air loop terminal
-		static bool ZoneHasAirLoopHVACDirectAir( false ); // true if zone has an uncontrolled air loop terminal
-		static Array1D_bool DirectAirAndAirTerminalWarningIssued; // only warn once for each zone with problems
 
 		// Determine flow rate and temperature of supply air based on type of damper
 
@@ -4290,7 +4303,7 @@ namespace ZoneEquipmentManager {
 		// to the air loop side, allowing for multiple return air nodes
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// Only the air loops whose return air conditions changed are requested for resimulation.
 
 		// REFERENCES:
 		// na
@@ -4298,6 +4311,7 @@ namespace ZoneEquipmentManager {
 		// Using/Aliasing
 		using HVACInterfaceManager::UpdateHVACInterface;
 		using DataAirLoop::AirToZoneNodeInfo;
+		using DataAirLoop::RequestAirLoopSim;
 		using DataHVACGlobals::NumPrimaryAirSys;
 		using DataConvergParams::CalledFromAirSystemDemandSide;
 
@@ -4316,13 +4330,16 @@ namespace ZoneEquipmentManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ZoneGroupNum;
 		int RetAirPathNum;
+		bool ReturnAirChanged; // TRUE if the return air conditions of the current air loop changed
 
 		// Transfer the conditions from the zone equipment return air nodes across
 		// to the air loop side, allowing for multiple return air nodes
 		for ( ZoneGroupNum = 1; ZoneGroupNum <= NumPrimaryAirSys; ++ZoneGroupNum ) {
+			ReturnAirChanged = false;
 			for ( RetAirPathNum = 1; RetAirPathNum <= AirToZoneNodeInfo( ZoneGroupNum ).NumReturnNodes; ++RetAirPathNum ) {
-				UpdateHVACInterface( ZoneGroupNum, CalledFromAirSystemDemandSide, AirToZoneNodeInfo( ZoneGroupNum ).ZoneEquipReturnNodeNum( RetAirPathNum ), AirToZoneNodeInfo( ZoneGroupNum ).AirLoopReturnNodeNum( RetAirPathNum ), SimAir );
+				UpdateHVACInterface( ZoneGroupNum, CalledFromAirSystemDemandSide, AirToZoneNodeInfo( ZoneGroupNum ).ZoneEquipReturnNodeNum( RetAirPathNum ), AirToZoneNodeInfo( ZoneGroupNum ).AirLoopReturnNodeNum( RetAirPathNum ), ReturnAirChanged );
 			}
+			if ( ReturnAirChanged ) RequestAirLoopSim( ZoneGroupNum, SimAir );
 		}
 
 	}
@@ -5327,16 +5344,15 @@ namespace ZoneEquipmentManager {
 
 			// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 			//  INTEGER      :: ERVNum=0                   ! the stand alone ERV index
-			static int ZoneNum(0); // zone index
 			int j; // index
 			int I; // index
 
 			if (allocated(ZoneEquipList)) {
-				ZoneNum = ZoneAirBalance(OutdoorNum).ZonePtr;
+				GetStandAloneERVNodesZoneNum = ZoneAirBalance(OutdoorNum).ZonePtr;
 				ZoneAirBalance(OutdoorNum).OneTimeFlag = true;
-				if (ZoneEquipList(ZoneNum).NumOfEquipTypes > 0) {
-					for (I = 1; I <= ZoneEquipList(ZoneNum).NumOfEquipTypes; ++I) {
-						if (ZoneEquipList(ZoneNum).EquipType_Num(I) == ERVStandAlone_Num) {
+				if (ZoneEquipList(GetStandAloneERVNodesZoneNum).NumOfEquipTypes > 0) {
+					for (I = 1; I <= ZoneEquipList(GetStandAloneERVNodesZoneNum).NumOfEquipTypes; ++I) {
+						if (ZoneEquipList(GetStandAloneERVNodesZoneNum).EquipType_Num(I) == ERVStandAlone_Num) {
 							++ZoneAirBalance(OutdoorNum).NumOfERVs;
 						}
 					}
@@ -5344,10 +5360,10 @@ namespace ZoneEquipmentManager {
 						ZoneAirBalance(OutdoorNum).ERVInletNode.allocate(ZoneAirBalance(OutdoorNum).NumOfERVs);
 						ZoneAirBalance(OutdoorNum).ERVExhaustNode.allocate(ZoneAirBalance(OutdoorNum).NumOfERVs);
 						j = 1;
-						for (I = 1; I <= ZoneEquipList(ZoneNum).NumOfEquipTypes; ++I) {
-							if (ZoneEquipList(ZoneNum).EquipType_Num(I) == ERVStandAlone_Num) {
-								ZoneAirBalance(OutdoorNum).ERVInletNode(j) = GetStandAloneERVOutAirNode(ZoneEquipList(ZoneNum).EquipIndex(I));
-								ZoneAirBalance(OutdoorNum).ERVExhaustNode(j) = GetStandAloneERVReturnAirNode(ZoneEquipList(ZoneNum).EquipIndex(I));
+						for (I = 1; I <= ZoneEquipList(GetStandAloneERVNodesZoneNum).NumOfEquipTypes; ++I) {
+							if (ZoneEquipList(GetStandAloneERVNodesZoneNum).EquipType_Num(I) == ERVStandAlone_Num) {
+								ZoneAirBalance(OutdoorNum).ERVInletNode(j) = GetStandAloneERVOutAirNode(ZoneEquipList(GetStandAloneERVNodesZoneNum).EquipIndex(I));
+								ZoneAirBalance(OutdoorNum).ERVExhaustNode(j) = GetStandAloneERVReturnAirNode(ZoneEquipList(GetStandAloneERVNodesZoneNum).EquipIndex(I));
 								++j;
 							}
 						}
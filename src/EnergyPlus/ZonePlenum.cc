@@ -132,6 +132,8 @@ namespace ZonePlenum {
 		bool GetInputFlag( true ); // Flag set to make sure you get input once
 		bool InitAirZoneReturnPlenumEnvrnFlag( true );
 		bool InitAirZoneReturnPlenumOneTimeFlag( true );
+		bool ErrorsFound( false );
+		bool MyEnvrnFlag( true );
 	}
 	// SUBROUTINE SPECIFICATIONS FOR MODULE ZONEPLENUM
 
@@ -155,6 +157,8 @@ namespace ZonePlenum {
 		NumZoneSupplyPlenums = 0;
 		ZoneRetPlenCond.deallocate();
 		ZoneSupPlenCond.deallocate();
+		ErrorsFound = false;
+		MyEnvrnFlag = true;
 	}
 
 	void
@@ -358,7 +362,6 @@ namespace ZonePlenum {
 		Array1D_string cNumericFields; // Numeric field names
 		Array1D_bool lAlphaBlanks; // Logical array, alpha field input BLANK = .TRUE.
 		Array1D_bool lNumericBlanks; // Logical array, numeric field input BLANK = .TRUE.
-		static bool ErrorsFound( false );
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
 		bool NodeListError; // Flag for node list error
@@ -873,7 +876,6 @@ namespace ZonePlenum {
 		int PlenumZoneNum;
 		int NodeIndex;
 
-		static bool MyEnvrnFlag( true );
 		// FLOW:
 
 		// Do the Begin Environment initializations
@@ -67,6 +67,7 @@
 
 // EnergyPlus Headers
 #include <ZoneTempPredictorCorrector.hh>
+#include <Checkpoint.hh>
 #include <DataAirflowNetwork.hh>
 #include <DataDefineEquip.hh>
 #include <DataEnvironment.hh>
@@ -79,12 +80,14 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataRoomAirModel.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneControls.hh>
 #include <DataZoneEnergyDemands.hh>
 #include <DataZoneEquipment.hh>
 #include <EMSManager.hh>
 #include <FaultsManager.hh>
 #include <General.hh>
+#include <HeatBalanceSurfaceManager.hh>
 #include <InputProcessor.hh>
 #include <InternalHeatGains.hh>
 #include <OutputProcessor.hh>
@@ -228,6 +231,31 @@ namespace ZoneTempPredictorCorrector {
 	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
 		bool InitZoneAirSetPointsOneTimeFlag( true );
 		bool SetupOscillationOutputFlag( true );
+		bool ErrorsFound( false );
+		bool MyEnvrnFlag( true );
+		bool MyDayFlag( true );
+		bool InitZoneAirSetPointsErrorsFound( false );
+		bool ControlledZonesChecked( false );
+		Real64 CorrectZoneAirTempSumIntGain( 0.0 ); // Zone sum of convective internal gains
+		Real64 CorrectZoneAirTempSumHA( 0.0 ); // Zone sum of Hc*Area
+		Real64 CorrectZoneAirTempSumHATsurf( 0.0 ); // Zone sum of Hc*Area*Tsurf
+		Real64 CorrectZoneAirTempSumHATref( 0.0 ); // Zone sum of Hc*Area*Tref, for ceiling diffuser convection correlation
+		Real64 CorrectZoneAirTempSumMCp( 0.0 ); // Zone sum of MassFlowRate*Cp
+		Real64 CorrectZoneAirTempSumMCpT( 0.0 ); // Zone sum of MassFlowRate*Cp*T
+		Real64 CorrectZoneAirTempSumSysMCp( 0.0 ); // Zone sum of air system MassFlowRate*Cp
+		Real64 CorrectZoneAirTempSumSysMCpT( 0.0 ); // Zone sum of air system MassFlowRate*Cp*T
+		Real64 ZoneEnthalpyIn( 0.0 ); // Zone inlet air enthalpy
+		Real64 CorrectZoneAirTempTempDepCoef( 0.0 ); // Formerly CoefSumha, coef in zone temp equation with dimensions of h*A
+		Real64 CorrectZoneAirTempTempIndCoef( 0.0 ); // Formerly CoefSumhat, coef in zone temp equation with dimensions of h*A(T1
+		Real64 AirCap( 0.0 ); // Formerly CoefAirrat, coef in zone temp eqn with dim of "air power capacity"
+		Real64 SNLoad( 0.0 ); // Sensible load calculated for zone in watts and then loaded in report variables
+		int CorrectZoneAirTempZoneNum( 0 );
+		int ZoneNodeNum( 0 ); // System node number for air flow through zone either by system or as a plenum
+		bool FirstTimeFlag( true ); // Flag set to make sure you get input once
+		int IterLimitExceededNum1( 0 );
+		int IterLimitErrIndex1( 0 );
+		int IterLimitExceededNum2( 0 );
+		int IterLimitErrIndex2( 0 );
 	}
 	Array1D< Real64 > ZoneSetPointLast;
 	Array1D< Real64 > TempIndZnLd;
@@ -239,6 +267,15 @@ namespace ZoneTempPredictorCorrector {
 	Array1D< Real64 > ZoneTempOscillate;
 	Real64 AnyZoneTempOscillate;
 
+	// Largest third difference of a zone air temperature over its history terms, estimate of the
+	// truncation error of the third order backward difference
+	Real64 ZoneTempTruncationError( 0.0 );
+
+	// Thermostat states at the previous zone time step - used only for control event detection
+	Array1D< Real64 > ZoneSetPointLoLast;
+	Array1D< Real64 > ZoneSetPointHiLast;
+	Array1D_bool DeadBandOrSetbackLast;
+
 	// SUBROUTINE SPECIFICATIONS:
 
 	// Object Data
@@ -274,6 +311,10 @@ namespace ZoneTempPredictorCorrector {
 		ZoneTempHist.deallocate();
 		ZoneTempOscillate.deallocate();
 		AnyZoneTempOscillate= 0.0;
+		ZoneTempTruncationError = 0.0;
+		ZoneSetPointLoLast.deallocate();
+		ZoneSetPointHiLast.deallocate();
+		DeadBandOrSetbackLast.deallocate();
 		SetPointSingleHeating.deallocate();
 		SetPointSingleCooling.deallocate();
 		SetPointSingleHeatCool.deallocate();
@@ -282,6 +323,31 @@ namespace ZoneTempPredictorCorrector {
 		SetPointSingleCoolingFanger.deallocate();
 		SetPointSingleHeatCoolFanger.deallocate();
 		SetPointDualHeatCoolFanger.deallocate();
+		ErrorsFound = false;
+		MyEnvrnFlag = true;
+		MyDayFlag = true;
+		InitZoneAirSetPointsErrorsFound = false;
+		ControlledZonesChecked = false;
+		CorrectZoneAirTempSumIntGain = 0.0;
+		CorrectZoneAirTempSumHA = 0.0;
+		CorrectZoneAirTempSumHATsurf = 0.0;
+		CorrectZoneAirTempSumHATref = 0.0;
+		CorrectZoneAirTempSumMCp = 0.0;
+		CorrectZoneAirTempSumMCpT = 0.0;
+		CorrectZoneAirTempSumSysMCp = 0.0;
+		CorrectZoneAirTempSumSysMCpT = 0.0;
+		ZoneEnthalpyIn = 0.0;
+		CorrectZoneAirTempTempDepCoef = 0.0;
+		CorrectZoneAirTempTempIndCoef = 0.0;
+		AirCap = 0.0;
+		SNLoad = 0.0;
+		CorrectZoneAirTempZoneNum = 0;
+		ZoneNodeNum = 0;
+		FirstTimeFlag = true;
+		IterLimitExceededNum1 = 0;
+		IterLimitErrIndex1 = 0;
+		IterLimitExceededNum2 = 0;
+		IterLimitErrIndex2 = 0;
 	}
 
 	void
@@ -416,7 +482,6 @@ namespace ZoneTempPredictorCorrector {
 		int IOStat;
 		//unused1208  REAL(r64), DIMENSION(2) :: NumArray
 		//unused1208  CHARACTER(len=MaxNameLength), DIMENSION(29) :: AlphArray
-		static bool ErrorsFound( false );
 		bool errFlag;
 		bool IsNotOK; // Flag to verify name
 		bool IsBlank; // Flag for blank name
@@ -2043,10 +2108,6 @@ namespace ZoneTempPredictorCorrector {
 		//////////// hoisted into namespace changed to InitZoneAirSetPointsOneTimeFlag////////////
 		//static bool MyOneTimeFlag( true );
 		//////////////////////////////////////
-		static bool MyEnvrnFlag( true );
-		static bool MyDayFlag( true );
-		static bool ErrorsFound( false );
-		static bool ControlledZonesChecked( false );
 		bool FirstSurfFlag;
 		int TRefFlag; // Flag for Reference Temperature process in Zones
 		int SurfNum;
@@ -2261,6 +2322,8 @@ namespace ZoneTempPredictorCorrector {
 			ZoneW1 = OutHumRat;
 			ZoneWMX = OutHumRat;
 			ZoneWM2 = OutHumRat;
+			Checkpoint::RestoreZoneAirHistories();
+			if ( ! DataSystemVariables::WarmStartFileName.empty() ) HeatBalanceSurfaceManager::RestoreWarmStartZoneAirHistories();
 
 			MyEnvrnFlag = false;
 		}
@@ -2283,7 +2346,7 @@ namespace ZoneTempPredictorCorrector {
 				if ( ! VerifyControlledZoneForThermostat( TempControlledZone( Loop ).ZoneName ) ) {
 					ShowSevereError( RoutineName + "Zone=\"" + TempControlledZone( Loop ).ZoneName + "\" has specified a Thermostatic control but is not a controlled zone." );
 					ShowContinueError( "...must have a ZoneHVAC:EquipmentConnections specification for this zone." );
-					ErrorsFound = true;
+					InitZoneAirSetPointsErrorsFound = true;
 				}
 			}
 
@@ -2334,7 +2397,7 @@ namespace ZoneTempPredictorCorrector {
 				if ( ! VerifyControlledZoneForThermostat( ComfortControlledZone( Loop ).ZoneName ) ) {
 					ShowSevereError( RoutineName + "Zone=\"" + ComfortControlledZone( Loop ).ZoneName + "\" has specified a Comfort control but is not a controlled zone." );
 					ShowContinueError( "...must have a ZoneHVAC:EquipmentConnections specification for this zone." );
-					ErrorsFound = true;
+					InitZoneAirSetPointsErrorsFound = true;
 				}
 			}
 			if ( ComfortControlledZone( Loop ).ManageDemand ) {
@@ -2470,7 +2533,7 @@ namespace ZoneTempPredictorCorrector {
 
 		}
 
-		if ( ErrorsFound ) {
+		if ( InitZoneAirSetPointsErrorsFound ) {
 			ShowFatalError( "InitZoneAirSetpoints - program terminates due to previous condition." );
 		}
 
@@ -3779,21 +3842,6 @@ namespace ZoneTempPredictorCorrector {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Real64 CpAir; // specific heat of air
-		static Real64 SumIntGain( 0.0 ); // Zone sum of convective internal gains
-		static Real64 SumHA( 0.0 ); // Zone sum of Hc*Area
-		static Real64 SumHATsurf( 0.0 ); // Zone sum of Hc*Area*Tsurf
-		static Real64 SumHATref( 0.0 ); // Zone sum of Hc*Area*Tref, for ceiling diffuser convection correlation
-		static Real64 SumMCp( 0.0 ); // Zone sum of MassFlowRate*Cp
-		static Real64 SumMCpT( 0.0 ); // Zone sum of MassFlowRate*Cp*T
-		static Real64 SumSysMCp( 0.0 ); // Zone sum of air system MassFlowRate*Cp
-		static Real64 SumSysMCpT( 0.0 ); // Zone sum of air system MassFlowRate*Cp*T
-		static Real64 ZoneEnthalpyIn( 0.0 ); // Zone inlet air enthalpy
-		static Real64 TempDepCoef( 0.0 ); // Formerly CoefSumha, coef in zone temp equation with dimensions of h*A
-		static Real64 TempIndCoef( 0.0 ); // Formerly CoefSumhat, coef in zone temp equation with dimensions of h*A(T1
-		static Real64 AirCap( 0.0 ); // Formerly CoefAirrat, coef in zone temp eqn with dim of "air power capacity"
-		static Real64 SNLoad( 0.0 ); // Sensible load calculated for zone in watts and then loaded in report variables
-		static int ZoneNum( 0 );
-		static int ZoneNodeNum( 0 ); // System node number for air flow through zone either by system or as a plenum
 		//  LOGICAL,SAVE   :: OneTimeFlag = .TRUE.
 		//unusd1208  LOGICAL,SAVE   :: MyEnvrnFlag = .TRUE.
 		Real64 TempSupplyAir;
@@ -3804,6 +3852,7 @@ namespace ZoneTempPredictorCorrector {
 		// FLOW:
 		// Initializations
 		ZoneTempChange = constant_zero;
+		ZoneTempTruncationError = constant_zero;
 
 		//Tuned Precompute controlled equip zone numbers for performance
 		std::vector< int > controlledZoneEquipConfigNums;
@@ -3814,23 +3863,23 @@ namespace ZoneTempPredictorCorrector {
 		}
 
 		// Update zone temperatures
-		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+		for ( CorrectZoneAirTempZoneNum = 1; CorrectZoneAirTempZoneNum <= NumOfZones; ++CorrectZoneAirTempZoneNum ) {
 
-			ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
+			ZoneMult = Zone( CorrectZoneAirTempZoneNum ).Multiplier * Zone( CorrectZoneAirTempZoneNum ).ListMultiplier;
 
 			if ( ShortenTimeStepSys ) {
 				// time step has gotten smaller, use zone timestep history to interpolate new set of "DS" history terms.
 				if ( NumOfSysTimeSteps != NumOfSysTimeStepsLastZoneTimeStep ) { // cannot reuse existing DS data, interpolate from zone time
-					DownInterpolate4HistoryValues( PriorTimeStep, TimeStepSys, MAT( ZoneNum ), XMAT( ZoneNum ), XM2T( ZoneNum ), XM3T( ZoneNum ), XM4T( ZoneNum ), MAT( ZoneNum ), DSXMAT( ZoneNum ), DSXM2T( ZoneNum ), DSXM3T( ZoneNum ), DSXM4T( ZoneNum ) );
-					DownInterpolate4HistoryValues( PriorTimeStep, TimeStepSys, ZoneAirHumRat( ZoneNum ), WZoneTimeMinus1( ZoneNum ), WZoneTimeMinus2( ZoneNum ), WZoneTimeMinus3( ZoneNum ), WZoneTimeMinus4( ZoneNum ), ZoneAirHumRat( ZoneNum ), DSWZoneTimeMinus1( ZoneNum ), DSWZoneTimeMinus2( ZoneNum ), DSWZoneTimeMinus3( ZoneNum ), DSWZoneTimeMinus4( ZoneNum ) );
-					if ( IsZoneDV( ZoneNum ) || IsZoneUI( ZoneNum ) ) {
-						DownInterpolate4HistoryValues( PriorTimeStep, TimeStepSys, MATFloor( ZoneNum ), XMATFloor( ZoneNum ), XM2TFloor( ZoneNum ), XM3TFloor( ZoneNum ), XM4TFloor( ZoneNum ), MATFloor( ZoneNum ), DSXMATFloor( ZoneNum ), DSXM2TFloor( ZoneNum ), DSXM3TFloor( ZoneNum ), DSXM4TFloor( ZoneNum ) );
-						DownInterpolate4HistoryValues( PriorTimeStep, TimeStepSys, MATOC( ZoneNum ), XMATOC( ZoneNum ), XM2TOC( ZoneNum ), XM3TOC( ZoneNum ), XM4TOC( ZoneNum ), MATOC( ZoneNum ), DSXMATOC( ZoneNum ), DSXM2TOC( ZoneNum ), DSXM3TOC( ZoneNum ), DSXM4TOC( ZoneNum ) );
-						DownInterpolate4HistoryValues( PriorTimeStep, TimeStepSys, MATMX( ZoneNum ), XMATMX( ZoneNum ), XM2TMX( ZoneNum ), XM3TMX( ZoneNum ), XM4TMX( ZoneNum ), MATMX( ZoneNum ), DSXMATMX( ZoneNum ), DSXM2TMX( ZoneNum ), DSXM3TMX( ZoneNum ), DSXM4TMX( ZoneNum ) );
+					DownInterpolate4HistoryValues( PriorTimeStep, TimeStepSys, MAT( CorrectZoneAirTempZoneNum ), XMAT( CorrectZoneAirTempZoneNum ), XM2T( CorrectZoneAirTempZoneNum ), XM3T( CorrectZoneAirTempZoneNum ), XM4T( CorrectZoneAirTempZoneNum ), MAT( CorrectZoneAirTempZoneNum ), DSXMAT( CorrectZoneAirTempZoneNum ), DSXM2T( CorrectZoneAirTempZoneNum ), DSXM3T( CorrectZoneAirTempZoneNum ), DSXM4T( CorrectZoneAirTempZoneNum ) );
+					DownInterpolate4HistoryValues( PriorTimeStep, TimeStepSys, ZoneAirHumRat( CorrectZoneAirTempZoneNum ), WZoneTimeMinus1( CorrectZoneAirTempZoneNum ), WZoneTimeMinus2( CorrectZoneAirTempZoneNum ), WZoneTimeMinus3( CorrectZoneAirTempZoneNum ), WZoneTimeMinus4( CorrectZoneAirTempZoneNum ), ZoneAirHumRat( CorrectZoneAirTempZoneNum ), DSWZoneTimeMinus1( CorrectZoneAirTempZoneNum ), DSWZoneTimeMinus2( CorrectZoneAirTempZoneNum ), DSWZoneTimeMinus3( CorrectZoneAirTempZoneNum ), DSWZoneTimeMinus4( CorrectZoneAirTempZoneNum ) );
+					if ( IsZoneDV( CorrectZoneAirTempZoneNum ) || IsZoneUI( CorrectZoneAirTempZoneNum ) ) {
+						DownInterpolate4HistoryValues( PriorTimeStep, TimeStepSys, MATFloor( CorrectZoneAirTempZoneNum ), XMATFloor( CorrectZoneAirTempZoneNum ), XM2TFloor( CorrectZoneAirTempZoneNum ), XM3TFloor( CorrectZoneAirTempZoneNum ), XM4TFloor( CorrectZoneAirTempZoneNum ), MATFloor( CorrectZoneAirTempZoneNum ), DSXMATFloor( CorrectZoneAirTempZoneNum ), DSXM2TFloor( CorrectZoneAirTempZoneNum ), DSXM3TFloor( CorrectZoneAirTempZoneNum ), DSXM4TFloor( CorrectZoneAirTempZoneNum ) );
+						DownInterpolate4HistoryValues( PriorTimeStep, TimeStepSys, MATOC( CorrectZoneAirTempZoneNum ), XMATOC( CorrectZoneAirTempZoneNum ), XM2TOC( CorrectZoneAirTempZoneNum ), XM3TOC( CorrectZoneAirTempZoneNum ), XM4TOC( CorrectZoneAirTempZoneNum ), MATOC( CorrectZoneAirTempZoneNum ), DSXMATOC( CorrectZoneAirTempZoneNum ), DSXM2TOC( CorrectZoneAirTempZoneNum ), DSXM3TOC( CorrectZoneAirTempZoneNum ), DSXM4TOC( CorrectZoneAirTempZoneNum ) );
+						DownInterpolate4HistoryValues( PriorTimeStep, TimeStepSys, MATMX( CorrectZoneAirTempZoneNum ), XMATMX( CorrectZoneAirTempZoneNum ), XM2TMX( CorrectZoneAirTempZoneNum ), XM3TMX( CorrectZoneAirTempZoneNum ), XM4TMX( CorrectZoneAirTempZoneNum ), MATMX( CorrectZoneAirTempZoneNum ), DSXMATMX( CorrectZoneAirTempZoneNum ), DSXM2TMX( CorrectZoneAirTempZoneNum ), DSXM3TMX( CorrectZoneAirTempZoneNum ), DSXM4TMX( CorrectZoneAirTempZoneNum ) );
 					}
-					if ( AirModel( ZoneNum ).AirModelType == RoomAirModel_AirflowNetwork ) {
-						for ( LoopNode = 1; LoopNode <= RoomAirflowNetworkZoneInfo( ZoneNum ).NumOfAirNodes; ++LoopNode ) {
-							auto & ThisRAFNNode( RoomAirflowNetworkZoneInfo( ZoneNum ).Node( LoopNode ) );
+					if ( AirModel( CorrectZoneAirTempZoneNum ).AirModelType == RoomAirModel_AirflowNetwork ) {
+						for ( LoopNode = 1; LoopNode <= RoomAirflowNetworkZoneInfo( CorrectZoneAirTempZoneNum ).NumOfAirNodes; ++LoopNode ) {
+							auto & ThisRAFNNode( RoomAirflowNetworkZoneInfo( CorrectZoneAirTempZoneNum ).Node( LoopNode ) );
 							DownInterpolate4HistoryValues( PriorTimeStep, TimeStepSys, ThisRAFNNode.AirTemp, ThisRAFNNode.AirTempX1, ThisRAFNNode.AirTempX2, ThisRAFNNode.AirTempX3, ThisRAFNNode.AirTempX4,
 								ThisRAFNNode.AirTemp, ThisRAFNNode.AirTempDSX1, ThisRAFNNode.AirTempDSX2, ThisRAFNNode.AirTempDSX3, ThisRAFNNode.AirTempDSX4 );
 							DownInterpolate4HistoryValues( PriorTimeStep, TimeStepSys, ThisRAFNNode.HumRat, ThisRAFNNode.HumRatX1, ThisRAFNNode.HumRatX2, ThisRAFNNode.HumRatX3, ThisRAFNNode.HumRatX4,
@@ -3845,131 +3894,131 @@ namespace ZoneTempPredictorCorrector {
 
 			// now update the variables actually used in the balance equations.
 			if ( ! UseZoneTimeStepHistory ) {
-				ZTM1( ZoneNum ) = DSXMAT( ZoneNum );
-				ZTM2( ZoneNum ) = DSXM2T( ZoneNum );
-				ZTM3( ZoneNum ) = DSXM3T( ZoneNum );
+				ZTM1( CorrectZoneAirTempZoneNum ) = DSXMAT( CorrectZoneAirTempZoneNum );
+				ZTM2( CorrectZoneAirTempZoneNum ) = DSXM2T( CorrectZoneAirTempZoneNum );
+				ZTM3( CorrectZoneAirTempZoneNum ) = DSXM3T( CorrectZoneAirTempZoneNum );
 
-				WZoneTimeMinus1Temp( ZoneNum ) = DSWZoneTimeMinus1( ZoneNum );
-				WZoneTimeMinus2Temp( ZoneNum ) = DSWZoneTimeMinus2( ZoneNum );
-				WZoneTimeMinus3Temp( ZoneNum ) = DSWZoneTimeMinus3( ZoneNum );
+				WZoneTimeMinus1Temp( CorrectZoneAirTempZoneNum ) = DSWZoneTimeMinus1( CorrectZoneAirTempZoneNum );
+				WZoneTimeMinus2Temp( CorrectZoneAirTempZoneNum ) = DSWZoneTimeMinus2( CorrectZoneAirTempZoneNum );
+				WZoneTimeMinus3Temp( CorrectZoneAirTempZoneNum ) = DSWZoneTimeMinus3( CorrectZoneAirTempZoneNum );
 			} else {
-				ZTM1( ZoneNum ) = XMAT( ZoneNum );
-				ZTM2( ZoneNum ) = XM2T( ZoneNum );
-				ZTM3( ZoneNum ) = XM3T( ZoneNum );
+				ZTM1( CorrectZoneAirTempZoneNum ) = XMAT( CorrectZoneAirTempZoneNum );
+				ZTM2( CorrectZoneAirTempZoneNum ) = XM2T( CorrectZoneAirTempZoneNum );
+				ZTM3( CorrectZoneAirTempZoneNum ) = XM3T( CorrectZoneAirTempZoneNum );
 
-				WZoneTimeMinus1Temp( ZoneNum ) = WZoneTimeMinus1( ZoneNum );
-				WZoneTimeMinus2Temp( ZoneNum ) = WZoneTimeMinus2( ZoneNum );
-				WZoneTimeMinus3Temp( ZoneNum ) = WZoneTimeMinus3( ZoneNum );
+				WZoneTimeMinus1Temp( CorrectZoneAirTempZoneNum ) = WZoneTimeMinus1( CorrectZoneAirTempZoneNum );
+				WZoneTimeMinus2Temp( CorrectZoneAirTempZoneNum ) = WZoneTimeMinus2( CorrectZoneAirTempZoneNum );
+				WZoneTimeMinus3Temp( CorrectZoneAirTempZoneNum ) = WZoneTimeMinus3( CorrectZoneAirTempZoneNum );
 			}
 
-			AIRRAT( ZoneNum ) = Zone( ZoneNum ).Volume * ZoneVolCapMultpSens * PsyRhoAirFnPbTdbW( OutBaroPress, MAT( ZoneNum ), ZoneAirHumRat( ZoneNum ), RoutineName ) * PsyCpAirFnWTdb( ZoneAirHumRat( ZoneNum ), MAT( ZoneNum ) ) / ( TimeStepSys * SecInHour );
+			AIRRAT( CorrectZoneAirTempZoneNum ) = Zone( CorrectZoneAirTempZoneNum ).Volume * ZoneVolCapMultpSens * PsyRhoAirFnPbTdbW( OutBaroPress, MAT( CorrectZoneAirTempZoneNum ), ZoneAirHumRat( CorrectZoneAirTempZoneNum ), RoutineName ) * PsyCpAirFnWTdb( ZoneAirHumRat( CorrectZoneAirTempZoneNum ), MAT( CorrectZoneAirTempZoneNum ) ) / ( TimeStepSys * SecInHour );
 
-			AirCap = AIRRAT( ZoneNum );
+			AirCap = AIRRAT( CorrectZoneAirTempZoneNum );
 
-			ManageAirModel( ZoneNum );
+			ManageAirModel( CorrectZoneAirTempZoneNum );
 
 			// Calculate the various heat balance sums
-			CalcZoneSums( ZoneNum, SumIntGain, SumHA, SumHATsurf, SumHATref, SumMCp, SumMCpT, SumSysMCp, SumSysMCpT, controlledZoneEquipConfigNums );
+			CalcZoneSums( CorrectZoneAirTempZoneNum, CorrectZoneAirTempSumIntGain, CorrectZoneAirTempSumHA, CorrectZoneAirTempSumHATsurf, CorrectZoneAirTempSumHATref, CorrectZoneAirTempSumMCp, CorrectZoneAirTempSumMCpT, CorrectZoneAirTempSumSysMCp, CorrectZoneAirTempSumSysMCpT, controlledZoneEquipConfigNums );
 			//    ZoneTempHistoryTerm = (3.0D0 * ZTM1(ZoneNum) - (3.0D0/2.0D0) * ZTM2(ZoneNum) + (1.0D0/3.0D0) * ZTM3(ZoneNum))
-			ZoneNodeNum = Zone( ZoneNum ).SystemZoneNodeNumber;
+			ZoneNodeNum = Zone( CorrectZoneAirTempZoneNum ).SystemZoneNodeNumber;
 
 			SNLoad = 0.0;
 
 			if ( ZoneNodeNum > 0 ) { // This zone is controlled by a zone equipment configuration or zone plenum
 
 				// Heat balance coefficients for controlled zone, i.e. with system air flow
-				TempDepCoef = SumHA + SumMCp + SumSysMCp;
-				TempIndCoef = SumIntGain + SumHATsurf - SumHATref + SumMCpT + SumSysMCpT + ( NonAirSystemResponse( ZoneNum ) / ZoneMult + SysDepZoneLoadsLagged( ZoneNum ) );
+				CorrectZoneAirTempTempDepCoef = CorrectZoneAirTempSumHA + CorrectZoneAirTempSumMCp + CorrectZoneAirTempSumSysMCp;
+				CorrectZoneAirTempTempIndCoef = CorrectZoneAirTempSumIntGain + CorrectZoneAirTempSumHATsurf - CorrectZoneAirTempSumHATref + CorrectZoneAirTempSumMCpT + CorrectZoneAirTempSumSysMCpT + ( NonAirSystemResponse( CorrectZoneAirTempZoneNum ) / ZoneMult + SysDepZoneLoadsLagged( CorrectZoneAirTempZoneNum ) );
 				//    TempHistoryTerm = AirCap * (3.0 * ZTM1(ZoneNum) - (3.0/2.0) * ZTM2(ZoneNum) + (1.0/3.0) * ZTM3(ZoneNum)) !debug only
 
 				if ( SimulateAirflowNetwork > AirflowNetworkControlMultizone ) {
-					TempIndCoef += AirflowNetworkExchangeData( ZoneNum ).TotalSen;
+					CorrectZoneAirTempTempIndCoef += AirflowNetworkExchangeData( CorrectZoneAirTempZoneNum ).TotalSen;
 				}
 				//    TempDepZnLd(ZoneNum) = (11.0/6.0) * AirCap + TempDepCoef
 				//    TempIndZnLd(ZoneNum) = TempHistoryTerm + TempIndCoef
 				// Solve for zone air temperature
 				{ auto const SELECT_CASE_var( ZoneAirSolutionAlgo );
 				if ( SELECT_CASE_var == Use3rdOrder ) {
-					ZT( ZoneNum ) = ( TempIndCoef + AirCap * ( 3.0 * ZTM1( ZoneNum ) - ( 3.0 / 2.0 ) * ZTM2( ZoneNum ) + ( 1.0 / 3.0 ) * ZTM3( ZoneNum ) ) ) / ( ( 11.0 / 6.0 ) * AirCap + TempDepCoef );
+					ZT( CorrectZoneAirTempZoneNum ) = ( CorrectZoneAirTempTempIndCoef + AirCap * ( 3.0 * ZTM1( CorrectZoneAirTempZoneNum ) - ( 3.0 / 2.0 ) * ZTM2( CorrectZoneAirTempZoneNum ) + ( 1.0 / 3.0 ) * ZTM3( CorrectZoneAirTempZoneNum ) ) ) / ( ( 11.0 / 6.0 ) * AirCap + CorrectZoneAirTempTempDepCoef );
 					// Exact solution
 				} else if ( SELECT_CASE_var == UseAnalyticalSolution ) {
-					if ( TempDepCoef == 0.0 ) { // B=0
-						ZT( ZoneNum ) = ZoneT1( ZoneNum ) + TempIndCoef / AirCap;
+					if ( CorrectZoneAirTempTempDepCoef == 0.0 ) { // B=0
+						ZT( CorrectZoneAirTempZoneNum ) = ZoneT1( CorrectZoneAirTempZoneNum ) + CorrectZoneAirTempTempIndCoef / AirCap;
 					} else {
-						ZT( ZoneNum ) = ( ZoneT1( ZoneNum ) - TempIndCoef / TempDepCoef ) * std::exp( min( 700.0, -TempDepCoef / AirCap ) ) + TempIndCoef / TempDepCoef;
+						ZT( CorrectZoneAirTempZoneNum ) = ( ZoneT1( CorrectZoneAirTempZoneNum ) - CorrectZoneAirTempTempIndCoef / CorrectZoneAirTempTempDepCoef ) * std::exp( min( 700.0, -CorrectZoneAirTempTempDepCoef / AirCap ) ) + CorrectZoneAirTempTempIndCoef / CorrectZoneAirTempTempDepCoef;
 					}
 				} else if ( SELECT_CASE_var == UseEulerMethod ) {
-					ZT( ZoneNum ) = ( AirCap * ZoneT1( ZoneNum ) + TempIndCoef ) / ( AirCap + TempDepCoef );
+					ZT( CorrectZoneAirTempZoneNum ) = ( AirCap * ZoneT1( CorrectZoneAirTempZoneNum ) + CorrectZoneAirTempTempIndCoef ) / ( AirCap + CorrectZoneAirTempTempDepCoef );
 				}}
 				// Update zone node temperature and thermostat temperature unless already updated in Room Air Model,
 				// calculate load correction factor
-				if ( ( AirModel( ZoneNum ).AirModelType == RoomAirModel_Mixing ) || ( ! AirModel( ZoneNum ).SimAirModel ) ) {
+				if ( ( AirModel( CorrectZoneAirTempZoneNum ).AirModelType == RoomAirModel_Mixing ) || ( ! AirModel( CorrectZoneAirTempZoneNum ).SimAirModel ) ) {
 					// Fully mixed
-					Node( ZoneNodeNum ).Temp = ZT( ZoneNum );
-					TempTstatAir( ZoneNum ) = ZT( ZoneNum );
-					LoadCorrectionFactor( ZoneNum ) = 1.0;
-				} else if ( IsZoneDV( ZoneNum ) || IsZoneUI( ZoneNum ) ) {
+					Node( ZoneNodeNum ).Temp = ZT( CorrectZoneAirTempZoneNum );
+					TempTstatAir( CorrectZoneAirTempZoneNum ) = ZT( CorrectZoneAirTempZoneNum );
+					LoadCorrectionFactor( CorrectZoneAirTempZoneNum ) = 1.0;
+				} else if ( IsZoneDV( CorrectZoneAirTempZoneNum ) || IsZoneUI( CorrectZoneAirTempZoneNum ) ) {
 					// UCSDDV: Not fully mixed - calculate factor to correct load for fully mixed assumption
-					if ( SumSysMCp > SmallMassFlow ) {
-						TempSupplyAir = SumSysMCpT / SumSysMCp; // Non-negligible flow, calculate supply air temperature
-						if ( std::abs( TempSupplyAir - ZT( ZoneNum ) ) > TempConvergTol ) {
-							LoadCorrectionFactor( ZoneNum ) = ( TempSupplyAir - Node( ZoneNodeNum ).Temp ) / ( TempSupplyAir - ZT( ZoneNum ) );
+					if ( CorrectZoneAirTempSumSysMCp > SmallMassFlow ) {
+						TempSupplyAir = CorrectZoneAirTempSumSysMCpT / CorrectZoneAirTempSumSysMCp; // Non-negligible flow, calculate supply air temperature
+						if ( std::abs( TempSupplyAir - ZT( CorrectZoneAirTempZoneNum ) ) > TempConvergTol ) {
+							LoadCorrectionFactor( CorrectZoneAirTempZoneNum ) = ( TempSupplyAir - Node( ZoneNodeNum ).Temp ) / ( TempSupplyAir - ZT( CorrectZoneAirTempZoneNum ) );
 							// constrain value to something reasonable
-							LoadCorrectionFactor( ZoneNum ) = max( -3.0, LoadCorrectionFactor( ZoneNum ) );
-							LoadCorrectionFactor( ZoneNum ) = min( 3.0, LoadCorrectionFactor( ZoneNum ) );
+							LoadCorrectionFactor( CorrectZoneAirTempZoneNum ) = max( -3.0, LoadCorrectionFactor( CorrectZoneAirTempZoneNum ) );
+							LoadCorrectionFactor( CorrectZoneAirTempZoneNum ) = min( 3.0, LoadCorrectionFactor( CorrectZoneAirTempZoneNum ) );
 
 						} else {
-							LoadCorrectionFactor( ZoneNum ) = 1.0; // Indeterminate
+							LoadCorrectionFactor( CorrectZoneAirTempZoneNum ) = 1.0; // Indeterminate
 						}
 					} else {
 						// Negligible flow, assume mixed - reasonable lagged starting value for first step time with significant flow
-						LoadCorrectionFactor( ZoneNum ) = 1.0;
+						LoadCorrectionFactor( CorrectZoneAirTempZoneNum ) = 1.0;
 					}
-				} else if ( AirModel( ZoneNum ).SimAirModel && ( ( AirModel( ZoneNum ).AirModelType == RoomAirModel_UserDefined ) || ( AirModel( ZoneNum ).AirModelType == RoomAirModel_Mundt ) ) ) {
-					if ( SumSysMCp > SmallMassFlow ) {
-						TempSupplyAir = SumSysMCpT / SumSysMCp; // Non-negligible flow, calculate supply air temperature
-						if ( std::abs( TempSupplyAir - ZT( ZoneNum ) ) > TempConvergTol ) {
-							LoadCorrectionFactor( ZoneNum ) = ( TempSupplyAir - Node( ZoneNodeNum ).Temp ) / ( TempSupplyAir - ZT( ZoneNum ) );
+				} else if ( AirModel( CorrectZoneAirTempZoneNum ).SimAirModel && ( ( AirModel( CorrectZoneAirTempZoneNum ).AirModelType == RoomAirModel_UserDefined ) || ( AirModel( CorrectZoneAirTempZoneNum ).AirModelType == RoomAirModel_Mundt ) ) ) {
+					if ( CorrectZoneAirTempSumSysMCp > SmallMassFlow ) {
+						TempSupplyAir = CorrectZoneAirTempSumSysMCpT / CorrectZoneAirTempSumSysMCp; // Non-negligible flow, calculate supply air temperature
+						if ( std::abs( TempSupplyAir - ZT( CorrectZoneAirTempZoneNum ) ) > TempConvergTol ) {
+							LoadCorrectionFactor( CorrectZoneAirTempZoneNum ) = ( TempSupplyAir - Node( ZoneNodeNum ).Temp ) / ( TempSupplyAir - ZT( CorrectZoneAirTempZoneNum ) );
 							// constrain value
-							LoadCorrectionFactor( ZoneNum ) = max( -3.0, LoadCorrectionFactor( ZoneNum ) );
-							LoadCorrectionFactor( ZoneNum ) = min( 3.0, LoadCorrectionFactor( ZoneNum ) );
+							LoadCorrectionFactor( CorrectZoneAirTempZoneNum ) = max( -3.0, LoadCorrectionFactor( CorrectZoneAirTempZoneNum ) );
+							LoadCorrectionFactor( CorrectZoneAirTempZoneNum ) = min( 3.0, LoadCorrectionFactor( CorrectZoneAirTempZoneNum ) );
 
 						} else {
-							LoadCorrectionFactor( ZoneNum ) = 1.0; // Indeterminate
+							LoadCorrectionFactor( CorrectZoneAirTempZoneNum ) = 1.0; // Indeterminate
 						}
 					} else {
 						// Negligible flow, assume mixed - reasonable lagged starting value for first step time with significant flow
-						LoadCorrectionFactor( ZoneNum ) = 1.0;
+						LoadCorrectionFactor( CorrectZoneAirTempZoneNum ) = 1.0;
 					}
-				} else if ( AirModel( ZoneNum ).AirModelType == RoomAirModel_AirflowNetwork ) {
+				} else if ( AirModel( CorrectZoneAirTempZoneNum ).AirModelType == RoomAirModel_AirflowNetwork ) {
 					//Zone node used in the RoomAirflowNetwork model
-					ZT( ZoneNum ) = RoomAirflowNetworkZoneInfo( ZoneNum ).Node( RoomAirflowNetworkZoneInfo( ZoneNum ).ControlAirNodeID ).AirTemp;
-					Node( ZoneNodeNum ).Temp = ZT( ZoneNum );
-					TempTstatAir( ZoneNum ) = ZT( ZoneNum );
-					LoadCorrectionFactor( ZoneNum ) = 1.0;
+					ZT( CorrectZoneAirTempZoneNum ) = RoomAirflowNetworkZoneInfo( CorrectZoneAirTempZoneNum ).Node( RoomAirflowNetworkZoneInfo( CorrectZoneAirTempZoneNum ).ControlAirNodeID ).AirTemp;
+					Node( ZoneNodeNum ).Temp = ZT( CorrectZoneAirTempZoneNum );
+					TempTstatAir( CorrectZoneAirTempZoneNum ) = ZT( CorrectZoneAirTempZoneNum );
+					LoadCorrectionFactor( CorrectZoneAirTempZoneNum ) = 1.0;
 				} else {
-					Node( ZoneNodeNum ).Temp = ZT( ZoneNum );
-					TempTstatAir( ZoneNum ) = ZT( ZoneNum );
-					LoadCorrectionFactor( ZoneNum ) = 1.0;
+					Node( ZoneNodeNum ).Temp = ZT( CorrectZoneAirTempZoneNum );
+					TempTstatAir( CorrectZoneAirTempZoneNum ) = ZT( CorrectZoneAirTempZoneNum );
+					LoadCorrectionFactor( CorrectZoneAirTempZoneNum ) = 1.0;
 				}
 
 				// Sensible load is the enthalpy into the zone minus the enthalpy that leaves the zone.
-				CpAir = PsyCpAirFnWTdb( ZoneAirHumRat( ZoneNum ), Node( ZoneNodeNum ).Temp );
-				ZoneEnthalpyIn = SumSysMCpT;
+				CpAir = PsyCpAirFnWTdb( ZoneAirHumRat( CorrectZoneAirTempZoneNum ), Node( ZoneNodeNum ).Temp );
+				ZoneEnthalpyIn = CorrectZoneAirTempSumSysMCpT;
 
 				// SNLOAD is the single zone load, without Zone Multiplier or Zone List Multiplier
-				SNLoad = ZoneEnthalpyIn - ( Node( ZoneNodeNum ).MassFlowRate / ZoneMult ) * CpAir * Node( ZoneNodeNum ).Temp + NonAirSystemResponse( ZoneNum ) / ZoneMult + SysDepZoneLoadsLagged( ZoneNum );
+				SNLoad = ZoneEnthalpyIn - ( Node( ZoneNodeNum ).MassFlowRate / ZoneMult ) * CpAir * Node( ZoneNodeNum ).Temp + NonAirSystemResponse( CorrectZoneAirTempZoneNum ) / ZoneMult + SysDepZoneLoadsLagged( CorrectZoneAirTempZoneNum );
 
 			} else {
 
 				// Heat balance coefficients for uncontrolled zone, i.e. without system air flow
-				TempDepCoef = SumHA + SumMCp;
-				TempIndCoef = SumIntGain + SumHATsurf - SumHATref + SumMCpT;
+				CorrectZoneAirTempTempDepCoef = CorrectZoneAirTempSumHA + CorrectZoneAirTempSumMCp;
+				CorrectZoneAirTempTempIndCoef = CorrectZoneAirTempSumIntGain + CorrectZoneAirTempSumHATsurf - CorrectZoneAirTempSumHATref + CorrectZoneAirTempSumMCpT;
 
 				//      TempHistoryTerm = AirCap * (3.0 * ZTM1(ZoneNum) - (3.0/2.0) * ZTM2(ZoneNum) + (1.0/3.0) * ZTM3(ZoneNum)) !debug only
 
 				if ( SimulateAirflowNetwork > AirflowNetworkControlMultizone ) {
-					TempIndCoef += AirflowNetworkExchangeData( ZoneNum ).TotalSen;
+					CorrectZoneAirTempTempIndCoef += AirflowNetworkExchangeData( CorrectZoneAirTempZoneNum ).TotalSen;
 				}
 				//      TempDepZnLd(ZoneNum) = (11.0/6.0) * AirCap + TempDepCoef
 				//      TempIndZnLd(ZoneNum) = TempHistoryTerm + TempIndCoef
@@ -3977,77 +4026,79 @@ namespace ZoneTempPredictorCorrector {
 				// Solve for zone air temperature
 				{ auto const SELECT_CASE_var( ZoneAirSolutionAlgo );
 				if ( SELECT_CASE_var == Use3rdOrder ) {
-					ZT( ZoneNum ) = ( TempIndCoef + AirCap * ( 3.0 * ZTM1( ZoneNum ) - ( 3.0 / 2.0 ) * ZTM2( ZoneNum ) + ( 1.0 / 3.0 ) * ZTM3( ZoneNum ) ) ) / ( ( 11.0 / 6.0 ) * AirCap + TempDepCoef );
+					ZT( CorrectZoneAirTempZoneNum ) = ( CorrectZoneAirTempTempIndCoef + AirCap * ( 3.0 * ZTM1( CorrectZoneAirTempZoneNum ) - ( 3.0 / 2.0 ) * ZTM2( CorrectZoneAirTempZoneNum ) + ( 1.0 / 3.0 ) * ZTM3( CorrectZoneAirTempZoneNum ) ) ) / ( ( 11.0 / 6.0 ) * AirCap + CorrectZoneAirTempTempDepCoef );
 					// Exact solution
 				} else if ( SELECT_CASE_var == UseAnalyticalSolution ) {
-					if ( TempDepCoef == 0.0 ) { // B=0
-						ZT( ZoneNum ) = ZoneT1( ZoneNum ) + TempIndCoef / AirCap;
+					if ( CorrectZoneAirTempTempDepCoef == 0.0 ) { // B=0
+						ZT( CorrectZoneAirTempZoneNum ) = ZoneT1( CorrectZoneAirTempZoneNum ) + CorrectZoneAirTempTempIndCoef / AirCap;
 					} else {
-						ZT( ZoneNum ) = ( ZoneT1( ZoneNum ) - TempIndCoef / TempDepCoef ) * std::exp( min( 700.0, -TempDepCoef / AirCap ) ) + TempIndCoef / TempDepCoef;
+						ZT( CorrectZoneAirTempZoneNum ) = ( ZoneT1( CorrectZoneAirTempZoneNum ) - CorrectZoneAirTempTempIndCoef / CorrectZoneAirTempTempDepCoef ) * std::exp( min( 700.0, -CorrectZoneAirTempTempDepCoef / AirCap ) ) + CorrectZoneAirTempTempIndCoef / CorrectZoneAirTempTempDepCoef;
 					}
 				} else if ( SELECT_CASE_var == UseEulerMethod ) {
-					ZT( ZoneNum ) = ( AirCap * ZoneT1( ZoneNum ) + TempIndCoef ) / ( AirCap + TempDepCoef );
+					ZT( CorrectZoneAirTempZoneNum ) = ( AirCap * ZoneT1( CorrectZoneAirTempZoneNum ) + CorrectZoneAirTempTempIndCoef ) / ( AirCap + CorrectZoneAirTempTempDepCoef );
 				}}
 
-				if ( AirModel( ZoneNum ).AirModelType == RoomAirModel_AirflowNetwork ) {
-					ZT( ZoneNum ) = RoomAirflowNetworkZoneInfo( ZoneNum ).Node( RoomAirflowNetworkZoneInfo( ZoneNum ).ControlAirNodeID ).AirTemp;
+				if ( AirModel( CorrectZoneAirTempZoneNum ).AirModelType == RoomAirModel_AirflowNetwork ) {
+					ZT( CorrectZoneAirTempZoneNum ) = RoomAirflowNetworkZoneInfo( CorrectZoneAirTempZoneNum ).Node( RoomAirflowNetworkZoneInfo( CorrectZoneAirTempZoneNum ).ControlAirNodeID ).AirTemp;
 				}
 
 				// No sensible load
 				SNLoad = 0.0;
 			}
 
-			MAT( ZoneNum ) = ZT( ZoneNum );
+			MAT( CorrectZoneAirTempZoneNum ) = ZT( CorrectZoneAirTempZoneNum );
 
 			// Determine sensible load heating/cooling rate and energy
-			SNLoadHeatRate( ZoneNum ) = max( SNLoad, 0.0 );
-			SNLoadCoolRate( ZoneNum ) = std::abs( min( SNLoad, 0.0 ) );
-			SNLoadHeatEnergy( ZoneNum ) = max( SNLoad, 0.0 ) * TimeStepSys * SecInHour;
-			SNLoadCoolEnergy( ZoneNum ) = std::abs( min( SNLoad, 0.0 ) * TimeStepSys * SecInHour );
+			SNLoadHeatRate( CorrectZoneAirTempZoneNum ) = max( SNLoad, 0.0 );
+			SNLoadCoolRate( CorrectZoneAirTempZoneNum ) = std::abs( min( SNLoad, 0.0 ) );
+			SNLoadHeatEnergy( CorrectZoneAirTempZoneNum ) = max( SNLoad, 0.0 ) * TimeStepSys * SecInHour;
+			SNLoadCoolEnergy( CorrectZoneAirTempZoneNum ) = std::abs( min( SNLoad, 0.0 ) * TimeStepSys * SecInHour );
 
 			// Final humidity calcs
-			CorrectZoneHumRat( ZoneNum, controlledZoneEquipConfigNums );
+			CorrectZoneHumRat( CorrectZoneAirTempZoneNum, controlledZoneEquipConfigNums );
 
-			ZoneAirHumRat( ZoneNum ) = ZoneAirHumRatTemp( ZoneNum );
-			ZoneAirRelHum( ZoneNum ) = 100.0 * PsyRhFnTdbWPb( ZT( ZoneNum ), ZoneAirHumRat( ZoneNum ), OutBaroPress, RoutineName );
+			ZoneAirHumRat( CorrectZoneAirTempZoneNum ) = ZoneAirHumRatTemp( CorrectZoneAirTempZoneNum );
+			ZoneAirRelHum( CorrectZoneAirTempZoneNum ) = 100.0 * PsyRhFnTdbWPb( ZT( CorrectZoneAirTempZoneNum ), ZoneAirHumRat( CorrectZoneAirTempZoneNum ), OutBaroPress, RoutineName );
 
 			// ZoneTempChange is used by HVACManager to determine if the timestep needs to be shortened.
 			{ auto const SELECT_CASE_var( ZoneAirSolutionAlgo );
 			if ( SELECT_CASE_var == Use3rdOrder ) {
-				if ( IsZoneDV( ZoneNum ) ) {
-					if ( ZoneDVMixedFlag( ZoneNum ) == 0 ) {
-						ZoneTempChange = max( ZoneTempChange, max( std::abs( ZTOC( ZoneNum ) - ZTM1OC( ZoneNum ) ), std::abs( ZTMX( ZoneNum ) - ZTM1MX( ZoneNum ) ) ) );
+				if ( IsZoneDV( CorrectZoneAirTempZoneNum ) ) {
+					if ( ZoneDVMixedFlag( CorrectZoneAirTempZoneNum ) == 0 ) {
+						ZoneTempChange = max( ZoneTempChange, max( std::abs( ZTOC( CorrectZoneAirTempZoneNum ) - ZTM1OC( CorrectZoneAirTempZoneNum ) ), std::abs( ZTMX( CorrectZoneAirTempZoneNum ) - ZTM1MX( CorrectZoneAirTempZoneNum ) ) ) );
 					} else {
-						ZoneTempChange = max( ZoneTempChange, std::abs( ZT( ZoneNum ) - ZTM1( ZoneNum ) ) );
+						ZoneTempChange = max( ZoneTempChange, std::abs( ZT( CorrectZoneAirTempZoneNum ) - ZTM1( CorrectZoneAirTempZoneNum ) ) );
 					}
-				} else if ( IsZoneUI( ZoneNum ) ) {
-					if ( ZoneUFMixedFlag( ZoneNum ) == 0 ) {
-						ZoneTempChange = max( ZoneTempChange, max( std::abs( ZTOC( ZoneNum ) - ZTM1OC( ZoneNum ) ), std::abs( ZTMX( ZoneNum ) - ZTM1MX( ZoneNum ) ) ) );
+				} else if ( IsZoneUI( CorrectZoneAirTempZoneNum ) ) {
+					if ( ZoneUFMixedFlag( CorrectZoneAirTempZoneNum ) == 0 ) {
+						ZoneTempChange = max( ZoneTempChange, max( std::abs( ZTOC( CorrectZoneAirTempZoneNum ) - ZTM1OC( CorrectZoneAirTempZoneNum ) ), std::abs( ZTMX( CorrectZoneAirTempZoneNum ) - ZTM1MX( CorrectZoneAirTempZoneNum ) ) ) );
 					} else {
-						ZoneTempChange = max( ZoneTempChange, std::abs( ZT( ZoneNum ) - ZTM1( ZoneNum ) ) );
+						ZoneTempChange = max( ZoneTempChange, std::abs( ZT( CorrectZoneAirTempZoneNum ) - ZTM1( CorrectZoneAirTempZoneNum ) ) );
 					}
 				} else {
-					ZoneTempChange = max( ZoneTempChange, std::abs( ZT( ZoneNum ) - ZTM1( ZoneNum ) ) );
+					ZoneTempChange = max( ZoneTempChange, std::abs( ZT( CorrectZoneAirTempZoneNum ) - ZTM1( CorrectZoneAirTempZoneNum ) ) );
 				}
+				// Third difference over the history terms, zero while the temperature follows a quadratic
+				ZoneTempTruncationError = max( ZoneTempTruncationError, std::abs( ZT( CorrectZoneAirTempZoneNum ) - 3.0 * ZTM1( CorrectZoneAirTempZoneNum ) + 3.0 * ZTM2( CorrectZoneAirTempZoneNum ) - ZTM3( CorrectZoneAirTempZoneNum ) ) );
 			} else if ( ( SELECT_CASE_var == UseAnalyticalSolution ) || ( SELECT_CASE_var == UseEulerMethod ) ) {
-				if ( IsZoneDV( ZoneNum ) ) {
-					if ( ZoneDVMixedFlag( ZoneNum ) == 0 ) {
-						ZoneTempChange = max( ZoneTempChange, max( std::abs( ZTOC( ZoneNum ) - Zone1OC( ZoneNum ) ), std::abs( ZTMX( ZoneNum ) - Zone1MX( ZoneNum ) ) ) );
+				if ( IsZoneDV( CorrectZoneAirTempZoneNum ) ) {
+					if ( ZoneDVMixedFlag( CorrectZoneAirTempZoneNum ) == 0 ) {
+						ZoneTempChange = max( ZoneTempChange, max( std::abs( ZTOC( CorrectZoneAirTempZoneNum ) - Zone1OC( CorrectZoneAirTempZoneNum ) ), std::abs( ZTMX( CorrectZoneAirTempZoneNum ) - Zone1MX( CorrectZoneAirTempZoneNum ) ) ) );
 					} else {
-						ZoneTempChange = max( ZoneTempChange, std::abs( ZT( ZoneNum ) - ZoneT1( ZoneNum ) ) );
+						ZoneTempChange = max( ZoneTempChange, std::abs( ZT( CorrectZoneAirTempZoneNum ) - ZoneT1( CorrectZoneAirTempZoneNum ) ) );
 					}
-				} else if ( IsZoneUI( ZoneNum ) ) {
-					if ( ZoneUFMixedFlag( ZoneNum ) == 0 ) {
-						ZoneTempChange = max( ZoneTempChange, max( std::abs( ZTOC( ZoneNum ) - Zone1OC( ZoneNum ) ), std::abs( ZTMX( ZoneNum ) - Zone1MX( ZoneNum ) ) ) );
+				} else if ( IsZoneUI( CorrectZoneAirTempZoneNum ) ) {
+					if ( ZoneUFMixedFlag( CorrectZoneAirTempZoneNum ) == 0 ) {
+						ZoneTempChange = max( ZoneTempChange, max( std::abs( ZTOC( CorrectZoneAirTempZoneNum ) - Zone1OC( CorrectZoneAirTempZoneNum ) ), std::abs( ZTMX( CorrectZoneAirTempZoneNum ) - Zone1MX( CorrectZoneAirTempZoneNum ) ) ) );
 					} else {
-						ZoneTempChange = max( ZoneTempChange, std::abs( ZT( ZoneNum ) - ZoneT1( ZoneNum ) ) );
+						ZoneTempChange = max( ZoneTempChange, std::abs( ZT( CorrectZoneAirTempZoneNum ) - ZoneT1( CorrectZoneAirTempZoneNum ) ) );
 					}
 				} else {
-					ZoneTempChange = max( ZoneTempChange, std::abs( ZT( ZoneNum ) - ZoneT1( ZoneNum ) ) );
+					ZoneTempChange = max( ZoneTempChange, std::abs( ZT( CorrectZoneAirTempZoneNum ) - ZoneT1( CorrectZoneAirTempZoneNum ) ) );
 				}
 			}}
 
-			CalcZoneComponentLoadSums( ZoneNum, TempDepCoef, TempIndCoef, ZnAirRpt( ZoneNum ).SumIntGains, ZnAirRpt( ZoneNum ).SumHADTsurfs, ZnAirRpt( ZoneNum ).SumMCpDTzones, ZnAirRpt( ZoneNum ).SumMCpDtInfil, ZnAirRpt( ZoneNum ).SumMCpDTsystem, ZnAirRpt( ZoneNum ).SumNonAirSystem, ZnAirRpt( ZoneNum ).CzdTdt, ZnAirRpt( ZoneNum ).imBalance, controlledZoneEquipConfigNums ); // convection part of internal gains | surface convection heat transfer | interzone mixing | OA of various kinds except via system | air system | non air system | air mass energy storage term | measure of imbalance in zone air heat balance
+			CalcZoneComponentLoadSums( CorrectZoneAirTempZoneNum, CorrectZoneAirTempTempDepCoef, CorrectZoneAirTempTempIndCoef, ZnAirRpt( CorrectZoneAirTempZoneNum ).SumIntGains, ZnAirRpt( CorrectZoneAirTempZoneNum ).SumHADTsurfs, ZnAirRpt( CorrectZoneAirTempZoneNum ).SumMCpDTzones, ZnAirRpt( CorrectZoneAirTempZoneNum ).SumMCpDtInfil, ZnAirRpt( CorrectZoneAirTempZoneNum ).SumMCpDTsystem, ZnAirRpt( CorrectZoneAirTempZoneNum ).SumNonAirSystem, ZnAirRpt( CorrectZoneAirTempZoneNum ).CzdTdt, ZnAirRpt( CorrectZoneAirTempZoneNum ).imBalance, controlledZoneEquipConfigNums ); // convection part of internal gains | surface convection heat transfer | interzone mixing | OA of various kinds except via system | air system | non air system | air mass energy storage term | measure of imbalance in zone air heat balance
 
 		} // ZoneNum
 
@@ -5612,6 +5663,52 @@ namespace ZoneTempPredictorCorrector {
 		}
 	}
 
+	bool
+	DetectZoneControlEvents()
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2016
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true if a control event happens in any zone at this zone time step: a thermostat
+		// setpoint changes, or the zone enters or leaves the thermostat deadband or setback.  The
+		// system time step can then be shortened where the zone air temperature history no longer
+		// predicts the response.
+
+		// METHODOLOGY EMPLOYED:
+		// Called once per zone time step after the predictor step.  The thermostat states are
+		// compared with, and then replace, those of the previous zone time step.
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		Real64 const SetPointChangeTol( 0.1 ); // Smallest setpoint change taken as an event (C)
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		bool ControlEvent( false );
+
+		if ( ! allocated( ZoneSetPointLoLast ) ) {
+			ZoneSetPointLoLast = ZoneThermostatSetPointLo;
+			ZoneSetPointHiLast = ZoneThermostatSetPointHi;
+			DeadBandOrSetbackLast = DeadBandOrSetback;
+			return false;
+		}
+
+		for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			if ( TempControlType( ZoneNum ) == 0 ) continue; // uncontrolled zone
+			if ( std::abs( ZoneThermostatSetPointLo( ZoneNum ) - ZoneSetPointLoLast( ZoneNum ) ) > SetPointChangeTol || std::abs( ZoneThermostatSetPointHi( ZoneNum ) - ZoneSetPointHiLast( ZoneNum ) ) > SetPointChangeTol || DeadBandOrSetback( ZoneNum ) != DeadBandOrSetbackLast( ZoneNum ) ) {
+				ControlEvent = true;
+			}
+			ZoneSetPointLoLast( ZoneNum ) = ZoneThermostatSetPointLo( ZoneNum );
+			ZoneSetPointHiLast( ZoneNum ) = ZoneThermostatSetPointHi( ZoneNum );
+			DeadBandOrSetbackLast( ZoneNum ) = DeadBandOrSetback( ZoneNum );
+		}
+
+		return ControlEvent;
+	}
+
 	void
 	AdjustAirSetPointsforOpTempCntrl(
 		int const TempControlledZoneID,
@@ -5730,7 +5827,6 @@ namespace ZoneTempPredictorCorrector {
 		Real64 NumberOccupants;
 		Real64 Tset;
 
-		static bool FirstTimeFlag( true ); // Flag set to make sure you get input once
 
 		// FLOW:
 		// Call thermal comfort module to read zone control comfort object
@@ -6042,10 +6138,6 @@ namespace ZoneTempPredictorCorrector {
 		Real64 PMVMax; // Calculated PMV value
 		Array1D< Real64 > Par( 2 ); // Passed parameter for RegularFalsi function
 		int SolFla; // feed back flag from SolveRegulaFalsi
-		static int IterLimitExceededNum1( 0 );
-		static int IterLimitErrIndex1( 0 );
-		static int IterLimitExceededNum2( 0 );
-		static int IterLimitErrIndex2( 0 );
 
 		Tmin = ComfortControlledZone( ComfortControlNum ).TdbMinSetPoint;
 		Tmax = ComfortControlledZone( ComfortControlNum ).TdbMaxSetPoint;
@@ -6057,7 +6149,7 @@ namespace ZoneTempPredictorCorrector {
 		if ( PMVSet > PMVMin && PMVSet < PMVMax ) {
 			Par( 1 ) = PMVSet;
 			Par( 2 ) = double( PeopleNum );
-			SolveRegulaFalsi( Acc, MaxIter, SolFla, Tset, PMVResidual, Tmin, Tmax, Par );
+			SolveRegulaFalsi( Acc, MaxIter, SolFla, Tset, PMVResidual, Tmin, Tmax, Par, "GetComfortSetPoints" );
 			if ( SolFla == -1 ) {
 				if ( ! WarmupFlag ) {
 					++IterLimitExceededNum1;
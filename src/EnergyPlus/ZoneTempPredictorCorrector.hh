@@ -154,6 +154,15 @@ namespace ZoneTempPredictorCorrector {
 	extern Array1D< Real64 > ZoneTempOscillate;
 	extern Real64 AnyZoneTempOscillate;
 
+	// Largest third difference of a zone air temperature over its history terms, estimate of the
+	// truncation error of the third order backward difference
+	extern Real64 ZoneTempTruncationError;
+
+	// Thermostat states at the previous zone time step - used only for control event detection
+	extern Array1D< Real64 > ZoneSetPointLoLast;
+	extern Array1D< Real64 > ZoneSetPointHiLast;
+	extern Array1D_bool DeadBandOrSetbackLast;
+
 	// SUBROUTINE SPECIFICATIONS:
 
 	// Types
@@ -321,6 +330,9 @@ namespace ZoneTempPredictorCorrector {
 	void
 	DetectOscillatingZoneTemp();
 
+	bool
+	DetectZoneControlEvents();
+
 	void
 	AdjustAirSetPointsforOpTempCntrl(
 		int const TempControlledZoneID,
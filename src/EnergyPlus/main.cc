@@ -66,5 +66,5 @@ main( int argc, const char * argv[] )
 	// the following line is only needed when debugging issues related to NaN in Visual Studio. See https://github.com/NREL/EnergyPlus/wiki/Debugging-Tips
 	// unsigned int fp_control_state = _controlfp( _EM_INEXACT, _MCW_EM );
 	ProcessArgs( argc, argv );
-	EnergyPlusPgm();
+	return EnergyPlusPgm();
 }
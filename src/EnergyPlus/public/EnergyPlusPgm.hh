@@ -69,7 +69,7 @@
 	void
 	CreateCurrentDateTimeString( std::string & CurrentDateTimeString );
 
-	void ENERGYPLUSLIB_API
+	int ENERGYPLUSLIB_API
 	EnergyPlusPgm( std::string const & filepath = std::string() );
 
 	void ENERGYPLUSLIB_API
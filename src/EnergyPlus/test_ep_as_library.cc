@@ -79,6 +79,6 @@ int main( int argc, char* argv[] )
 		std::cout << "Call this with a path to run EnergyPlus as the only argument" << std::endl;
 		return 1;
 	} else {
-		EnergyPlusPgm( argv[1] );
+		return EnergyPlusPgm( argv[1] );
 	}
 }
@@ -0,0 +1,298 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// EnergyPlus::Checkpoint Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// C++ Headers
+#include <cstdio>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/Checkpoint.hh>
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataHeatBalFanSys.hh>
+#include <EnergyPlus/DataHeatBalSurface.hh>
+#include <EnergyPlus/DataLoopNode.hh>
+#include <EnergyPlus/DataPlant.hh>
+#include <EnergyPlus/DataReportingFlags.hh>
+#include <EnergyPlus/DataRuntimeLanguage.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/EconomicTariff.hh>
+#include <EnergyPlus/GroundHeatExchangers.hh>
+#include <EnergyPlus/OutputReportTabular.hh>
+#include <EnergyPlus/WaterThermalTanks.hh>
+
+using namespace EnergyPlus;
+
+TEST_F( EnergyPlusFixture, Checkpoint_WriteReadRestore )
+{
+	DataSurfaces::TotSurfaces = 1;
+	DataSurfaces::Surface.allocate( 1 );
+	DataSurfaces::Surface( 1 ).HeatTransSurf = true;
+	DataSurfaces::Surface( 1 ).HeatTransferAlgorithm = DataSurfaces::HeatTransferModel_CTF;
+	DataHeatBalSurface::TH.dimension( 2, DataHeatBalance::MaxCTFTerms, 1, 0.0 );
+	DataHeatBalSurface::QH.dimension( 2, DataHeatBalance::MaxCTFTerms, 1, 0.0 );
+	DataHeatBalSurface::THM.dimension( 2, DataHeatBalance::MaxCTFTerms, 1, 0.0 );
+	DataHeatBalSurface::QHM.dimension( 2, DataHeatBalance::MaxCTFTerms, 1, 0.0 );
+	DataHeatBalSurface::TempSurfIn.dimension( 1, 0.0 );
+	DataHeatBalSurface::TempSurfInTmp.dimension( 1, 0.0 );
+	DataHeatBalSurface::TempSurfOut.dimension( 1, 0.0 );
+	DataHeatBalFanSys::MAT.dimension( 1, 0.0 );
+	DataHeatBalFanSys::ZTM2.dimension( 1, 0.0 );
+	DataHeatBalFanSys::WZoneTimeMinus1.dimension( 1, 0.0 );
+
+	WaterThermalTanks::NumWaterThermalTank = 1;
+	WaterThermalTanks::WaterThermalTank.allocate( 1 );
+	WaterThermalTanks::WaterThermalTank( 1 ).Name = "HOT WATER TANK";
+	WaterThermalTanks::WaterThermalTank( 1 ).Node.allocate( 2 );
+
+	DataRuntimeLanguage::NumErlVariables = 2;
+	DataRuntimeLanguage::ErlVariable.allocate( 2 );
+	DataRuntimeLanguage::ErlVariable( 1 ).StackNum = 0;
+	DataRuntimeLanguage::ErlVariable( 2 ).StackNum = 1;
+
+	// State at the end of day 40 of the third environment
+	DataSystemVariables::CheckpointFileName = "Checkpoint_WriteReadRestore.ckpt";
+	DataEnvironment::CurEnvirNum = 3;
+	DataEnvironment::EnvironmentName = "ANNUAL, HOSPITAL";
+	DataEnvironment::CurrentOverallSimDay = 42;
+	DataGlobals::DayOfSim = 40;
+	DataReportingFlags::NumOfWarmupDays = 7;
+	DataHeatBalSurface::TH( 2, 4, 1 ) = 1.0 / 3.0;
+	DataHeatBalSurface::TempSurfOut( 1 ) = -7.25;
+	DataHeatBalFanSys::MAT( 1 ) = 21.5;
+	DataHeatBalFanSys::ZTM2( 1 ) = 22.0;
+	DataHeatBalFanSys::WZoneTimeMinus1( 1 ) = 0.0081;
+	WaterThermalTanks::WaterThermalTank( 1 ).SavedTankTemp = 57.5;
+	WaterThermalTanks::WaterThermalTank( 1 ).SavedHeaterOn1 = true;
+	WaterThermalTanks::WaterThermalTank( 1 ).SavedMode = -1;
+	WaterThermalTanks::WaterThermalTank( 1 ).Node( 2 ).SavedTemp = 49.0;
+	DataRuntimeLanguage::ErlVariable( 1 ).Value.Type = DataRuntimeLanguage::ValueNumber;
+	DataRuntimeLanguage::ErlVariable( 1 ).Value.Number = 12.0;
+	DataRuntimeLanguage::ErlVariable( 2 ).Value.Number = 5.0;
+	Checkpoint::WriteCheckpoint();
+
+	// The restarted run initializes the environment before the state is restored
+	DataHeatBalSurface::TH = 23.0;
+	DataHeatBalSurface::TempSurfOut = 23.0;
+	DataHeatBalFanSys::MAT = 23.0;
+	DataHeatBalFanSys::ZTM2 = 0.0;
+	DataHeatBalFanSys::WZoneTimeMinus1 = 0.0;
+	WaterThermalTanks::WaterThermalTank( 1 ).SavedTankTemp = 60.0;
+	WaterThermalTanks::WaterThermalTank( 1 ).SavedHeaterOn1 = false;
+	WaterThermalTanks::WaterThermalTank( 1 ).SavedMode = 0;
+	WaterThermalTanks::WaterThermalTank( 1 ).Node( 2 ).SavedTemp = 60.0;
+	DataRuntimeLanguage::ErlVariable( 1 ).Value.Type = 0;
+	DataRuntimeLanguage::ErlVariable( 1 ).Value.Number = 0.0;
+	DataRuntimeLanguage::ErlVariable( 2 ).Value.Number = 0.0;
+
+	Checkpoint::ReadCheckpoint();
+	EXPECT_TRUE( Checkpoint::RestartPending );
+	EXPECT_EQ( 3, Checkpoint::RestartEnvrnNum );
+	EXPECT_EQ( "ANNUAL, HOSPITAL", Checkpoint::RestartEnvironmentName );
+	EXPECT_EQ( 40, Checkpoint::RestartDayOfSim );
+	EXPECT_EQ( 42, Checkpoint::RestartOverallSimDay );
+	EXPECT_EQ( 7, Checkpoint::RestartWarmupDays );
+
+	Checkpoint::RestoreHeatBalanceState();
+	Checkpoint::RestoreZoneAirHistories();
+	Checkpoint::RestoreWaterThermalTank( 1 );
+	Checkpoint::RestoreReportingState();
+	Checkpoint::FinishRestart();
+	EXPECT_FALSE( Checkpoint::RestartPending );
+
+	EXPECT_DOUBLE_EQ( 1.0 / 3.0, DataHeatBalSurface::TH( 2, 4, 1 ) );
+	EXPECT_DOUBLE_EQ( 0.0, DataHeatBalSurface::TH( 1, 1, 1 ) );
+	EXPECT_DOUBLE_EQ( -7.25, DataHeatBalSurface::TempSurfOut( 1 ) );
+	EXPECT_DOUBLE_EQ( 21.5, DataHeatBalFanSys::MAT( 1 ) );
+	EXPECT_DOUBLE_EQ( 22.0, DataHeatBalFanSys::ZTM2( 1 ) );
+	EXPECT_DOUBLE_EQ( 0.0081, DataHeatBalFanSys::WZoneTimeMinus1( 1 ) );
+	EXPECT_DOUBLE_EQ( 57.5, WaterThermalTanks::WaterThermalTank( 1 ).SavedTankTemp );
+	EXPECT_TRUE( WaterThermalTanks::WaterThermalTank( 1 ).SavedHeaterOn1 );
+	EXPECT_EQ( -1, WaterThermalTanks::WaterThermalTank( 1 ).SavedMode );
+	EXPECT_DOUBLE_EQ( 49.0, WaterThermalTanks::WaterThermalTank( 1 ).Node( 2 ).SavedTemp );
+	EXPECT_EQ( DataRuntimeLanguage::ValueNumber, DataRuntimeLanguage::ErlVariable( 1 ).Value.Type );
+	EXPECT_DOUBLE_EQ( 12.0, DataRuntimeLanguage::ErlVariable( 1 ).Value.Number );
+	EXPECT_DOUBLE_EQ( 0.0, DataRuntimeLanguage::ErlVariable( 2 ).Value.Number ); // local to a program
+
+	// A checkpoint of a different model is not used
+	DataHeatBalFanSys::MAT.dimension( 2, 23.0 );
+	Checkpoint::ReadCheckpoint();
+	EXPECT_ANY_THROW( Checkpoint::RestoreHeatBalanceState() );
+
+	std::remove( DataSystemVariables::CheckpointFileName.c_str() );
+	DataSystemVariables::CheckpointFileName.clear();
+}
+
+TEST_F( EnergyPlusFixture, Checkpoint_PlantLoopsAndTabularReports )
+{
+	DataLoopNode::Node.allocate( 4 );
+	DataPlant::TotNumLoops = 1;
+	DataPlant::PlantLoop.allocate( 1 );
+	DataPlant::PlantLoop( 1 ).LoopSide.allocate( 2 );
+	for ( auto & LoopSide : DataPlant::PlantLoop( 1 ).LoopSide ) {
+		LoopSide.Branch.allocate( 1 );
+		LoopSide.Branch( 1 ).Comp.allocate( 1 );
+	}
+	DataPlant::PlantLoop( 1 ).LoopSide( 1 ).Branch( 1 ).Comp( 1 ).NodeNumIn = 1;
+	DataPlant::PlantLoop( 1 ).LoopSide( 1 ).Branch( 1 ).Comp( 1 ).NodeNumOut = 2;
+	DataPlant::PlantLoop( 1 ).LoopSide( 2 ).Branch( 1 ).Comp( 1 ).NodeNumIn = 3;
+	DataPlant::PlantLoop( 1 ).LoopSide( 2 ).Branch( 1 ).Comp( 1 ).NodeNumOut = 4;
+
+	GroundHeatExchangers::verticalGLHE.allocate( 1 );
+	auto & GLHE( GroundHeatExchangers::verticalGLHE( 1 ) );
+	GLHE.Name = "VERTICAL GLHE";
+	GLHE.inletNodeNum = 3;
+	GLHE.outletNodeNum = 4;
+	GLHE.QnMonthlyAgg.dimension( 12, 0.0 );
+	GLHE.QnHr.dimension( 730, 0.0 );
+	GLHE.QnSubHr.dimension( 6, 0.0 );
+	GLHE.LastHourN.dimension( 730, 0 );
+	GroundHeatExchangers::prevTimeSteps.dimension( 6, 0.0 );
+
+	OutputReportTabular::IsMonthGathered.dimension( 12, false );
+	OutputReportTabular::MonthlyColumns.allocate( 1 );
+	OutputReportTabular::gatherTotalsBEPS.dimension( 4, 0.0 );
+	DataHeatBalance::ZonePreDefRep.allocate( 1 );
+	EconomicTariff::numTariff = 1;
+	EconomicTariff::tariff.allocate( 1 );
+
+	// State at the end of day 200 of the weather file run period
+	DataSystemVariables::CheckpointFileName = "Checkpoint_PlantLoopsAndTabularReports.ckpt";
+	DataEnvironment::CurEnvirNum = 1;
+	DataEnvironment::EnvironmentName = "RUN PERIOD 1";
+	DataEnvironment::CurrentOverallSimDay = 200;
+	DataGlobals::DayOfSim = 200;
+	DataReportingFlags::NumOfWarmupDays = 6;
+	DataPlant::PlantLoop( 1 ).LoopSide( 1 ).TempInterfaceTankOutlet = 7.5;
+	DataPlant::PlantLoop( 1 ).LoopSide( 2 ).InletNode.TemperatureHistory( 2 ) = 12.0;
+	DataLoopNode::Node( 2 ).Temp = 6.7;
+	DataLoopNode::Node( 3 ).TempLastTimestep = 29.0;
+	GroundHeatExchangers::N = 4801;
+	GroundHeatExchangers::currentSimTime = 4800.0;
+	GroundHeatExchangers::prevTimeSteps( 1 ) = 4799.75;
+	GLHE.QnHr( 200 ) = -31.5;
+	GLHE.LastHourN( 200 ) = 4797;
+	GLHE.aveFluidTemp = 18.2;
+	OutputReportTabular::IsMonthGathered( 7 ) = true;
+	OutputReportTabular::MonthlyColumns( 1 ).reslt( 7 ) = 1250.0;
+	OutputReportTabular::MonthlyColumns( 1 ).timeStamp( 7 ) = 7180960;
+	OutputReportTabular::gatherTotalsBEPS( 1 ) = 3.6e10;
+	DataHeatBalance::ZonePreDefRep( 1 ).SHGSAnPeoplAdd = 8.4e8;
+	DataHeatBalance::BuildingPreDefRep.clPeak = 52000.0;
+	EconomicTariff::tariff( 1 ).gatherEnergy( 7, 1 ) = 1.1e9;
+	EconomicTariff::tariff( 1 ).collectTime = 3.5;
+	Checkpoint::WriteCheckpoint();
+
+	// The restarted run initializes the loops, the ground heat exchanger and the reports first
+	DataPlant::PlantLoop( 1 ).LoopSide( 1 ).TempInterfaceTankOutlet = 0.0;
+	DataPlant::PlantLoop( 1 ).LoopSide( 2 ).InletNode.TemperatureHistory = 0.0;
+	DataLoopNode::Node( 2 ).Temp = 20.0;
+	DataLoopNode::Node( 3 ).TempLastTimestep = 20.0;
+	GroundHeatExchangers::N = 1;
+	GroundHeatExchangers::currentSimTime = 0.0;
+	GroundHeatExchangers::prevTimeSteps = 0.0;
+	GLHE.QnHr = 0.0;
+	GLHE.LastHourN = 0;
+	GLHE.aveFluidTemp = 0.0;
+	OutputReportTabular::IsMonthGathered = false;
+	OutputReportTabular::MonthlyColumns( 1 ).reslt = 0.0;
+	OutputReportTabular::MonthlyColumns( 1 ).timeStamp = 0;
+	OutputReportTabular::gatherTotalsBEPS = 0.0;
+	DataHeatBalance::ZonePreDefRep( 1 ).SHGSAnPeoplAdd = 0.0;
+	DataHeatBalance::BuildingPreDefRep.clPeak = 0.0;
+	EconomicTariff::tariff( 1 ).gatherEnergy = 0.0;
+	EconomicTariff::tariff( 1 ).collectTime = 0.0;
+
+	Checkpoint::ReadCheckpoint();
+	Checkpoint::RestorePlantLoops();
+	Checkpoint::RestoreGroundHeatExchanger( "GroundHeatExchanger:Vertical", GLHE );
+	Checkpoint::RestoreHeatBalanceState();
+	Checkpoint::RestoreZoneAirHistories();
+	Checkpoint::RestoreReportingState();
+	Checkpoint::FinishRestart();
+
+	EXPECT_DOUBLE_EQ( 7.5, DataPlant::PlantLoop( 1 ).LoopSide( 1 ).TempInterfaceTankOutlet );
+	EXPECT_DOUBLE_EQ( 12.0, DataPlant::PlantLoop( 1 ).LoopSide( 2 ).InletNode.TemperatureHistory( 2 ) );
+	EXPECT_DOUBLE_EQ( 6.7, DataLoopNode::Node( 2 ).Temp );
+	EXPECT_DOUBLE_EQ( 29.0, DataLoopNode::Node( 3 ).TempLastTimestep );
+	EXPECT_EQ( 4801, GroundHeatExchangers::N );
+	EXPECT_DOUBLE_EQ( 4800.0, GroundHeatExchangers::currentSimTime );
+	EXPECT_DOUBLE_EQ( 4799.75, GroundHeatExchangers::prevTimeSteps( 1 ) );
+	EXPECT_DOUBLE_EQ( -31.5, GLHE.QnHr( 200 ) );
+	EXPECT_EQ( 4797, GLHE.LastHourN( 200 ) );
+	EXPECT_DOUBLE_EQ( 18.2, GLHE.aveFluidTemp );
+	EXPECT_TRUE( OutputReportTabular::IsMonthGathered( 7 ) );
+	EXPECT_FALSE( OutputReportTabular::IsMonthGathered( 8 ) );
+	EXPECT_DOUBLE_EQ( 1250.0, OutputReportTabular::MonthlyColumns( 1 ).reslt( 7 ) );
+	EXPECT_EQ( 7180960, OutputReportTabular::MonthlyColumns( 1 ).timeStamp( 7 ) );
+	EXPECT_DOUBLE_EQ( 3.6e10, OutputReportTabular::gatherTotalsBEPS( 1 ) );
+	EXPECT_DOUBLE_EQ( 8.4e8, DataHeatBalance::ZonePreDefRep( 1 ).SHGSAnPeoplAdd );
+	EXPECT_DOUBLE_EQ( 52000.0, DataHeatBalance::BuildingPreDefRep.clPeak );
+	EXPECT_DOUBLE_EQ( 1.1e9, EconomicTariff::tariff( 1 ).gatherEnergy( 7, 1 ) );
+	EXPECT_DOUBLE_EQ( 3.5, EconomicTariff::tariff( 1 ).collectTime );
+
+	std::remove( DataSystemVariables::CheckpointFileName.c_str() );
+	DataSystemVariables::CheckpointFileName.clear();
+}
@@ -66,7 +66,7 @@
 #include <DataGlobals.hh>
 #include <CurveManager.hh>
 
-#include "Fixtures/EnergyPlusFixture.hh"
+#include "Fixtures/CurveManagerFixture.hh"
 
 using namespace EnergyPlus;
 using namespace EnergyPlus::CurveManager;
@@ -1001,3 +1001,210 @@ TEST_F( EnergyPlusFixture, Tables_OneIndependentVariable_Linear_EvaluateCurveTyp
 
 		EXPECT_FALSE( has_err_output() );
 }
+
+TEST_F( CurveManagerFixture, CurveManager_EquationCurveValues ) {
+	Array1D_int CurveTypes;
+	SetUpEquationCurves( CurveTypes );
+
+	// hand calculations at in-range points
+	EXPECT_DOUBLE_EQ( 0.9 + 0.5 * 1.5, CurveValue( 1, 1.5 ) ); // Linear
+	EXPECT_DOUBLE_EQ( 0.9 + 0.5 * 1.5 + 0.25 * 1.5 * 1.5, CurveValue( 2, 1.5 ) ); // Quadratic
+	EXPECT_DOUBLE_EQ( 0.9 + 0.5 * std::pow( 1.5, 0.25 ), CurveValue( 5, 1.5 ) ); // Exponent
+	EXPECT_DOUBLE_EQ( 0.9 + 0.5 * std::exp( 0.25 * 1.5 ), CurveValue( 10, 1.5 ) ); // ExponentialDecay
+	EXPECT_DOUBLE_EQ( 0.9 + 0.5 * 1.5 + 0.25 * 1.5 * 1.5 + 0.125 * 0.5 - 0.1 * 0.5 * 0.5 + 0.05 * 1.5 * 0.5, CurveValue( 12, 1.5, 0.5 ) ); // BiQuadratic
+	EXPECT_DOUBLE_EQ( 1.5 * ( 0.9 * 1.5 + 0.5 + 0.25 * std::sqrt( 0.5 ) ) + 0.125 * 0.5, CurveValue( 16, 1.5, 0.5 ) ); // FanPressureRise
+
+	// independent variables are limited to the curve minimum and maximum
+	EXPECT_DOUBLE_EQ( CurveValue( 1, 2.0 ), CurveValue( 1, 5.0 ) );
+	EXPECT_DOUBLE_EQ( CurveValue( 12, 0.1, 2.0 ), CurveValue( 12, -1.0, 3.0 ) );
+
+	// and so is the output
+	PerfCurve( 2 ).CurveMaxPresent = true;
+	PerfCurve( 2 ).CurveMax = 1.5;
+	PerfCurve( 2 ).CurveMinPresent = true;
+	PerfCurve( 2 ).CurveMin = 1.0;
+	EXPECT_DOUBLE_EQ( 1.5, CurveValue( 2, 2.0 ) );
+	EXPECT_DOUBLE_EQ( 1.0, CurveValue( 2, 0.1 ) );
+}
+
+TEST_F( CurveManagerFixture, CurveManager_EquationCurvesMatchReference ) {
+	// The curve equations are dispatched through a table of functions by curve type; every equation curve type
+	// is compared with the equation written out in full, at points inside and outside the variable limits.
+	Array1D_int CurveTypes;
+	SetUpEquationCurves( CurveTypes );
+	PerfCurve( 3 ).CurveMaxPresent = true;
+	PerfCurve( 3 ).CurveMax = 1.8;
+	PerfCurve( 13 ).CurveMinPresent = true;
+	PerfCurve( 13 ).CurveMin = 1.2;
+
+	auto const ReferenceValue = []( PerfomanceCurveData const & Curve, Real64 const Var1, Real64 const Var2, Real64 const Var3 ) {
+		Real64 const V1( std::max( std::min( Var1, Curve.Var1Max ), Curve.Var1Min ) );
+		Real64 const V2( std::max( std::min( Var2, Curve.Var2Max ), Curve.Var2Min ) );
+		Real64 const V3( std::max( std::min( Var3, Curve.Var3Max ), Curve.Var3Min ) );
+		Real64 Value( 0.0 );
+		auto const Type( Curve.CurveType );
+		if ( Type == Linear ) {
+			Value = Curve.Coeff1 + V1 * Curve.Coeff2;
+		} else if ( Type == Quadratic ) {
+			Value = Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * Curve.Coeff3 );
+		} else if ( Type == QuadLinear ) {
+			Value = Curve.Coeff1 + V1 * Curve.Coeff2 + V2 * Curve.Coeff3 + V3 * Curve.Coeff4;
+		} else if ( Type == Cubic ) {
+			Value = Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * ( Curve.Coeff3 + V1 * Curve.Coeff4 ) );
+		} else if ( Type == Quartic ) {
+			Value = Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * ( Curve.Coeff3 + V1 * ( Curve.Coeff4 + V1 * Curve.Coeff5 ) ) );
+		} else if ( Type == BiQuadratic ) {
+			Value = Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * Curve.Coeff3 ) + V2 * ( Curve.Coeff4 + V2 * Curve.Coeff5 ) + V1 * V2 * Curve.Coeff6;
+		} else if ( Type == QuadraticLinear ) {
+			Value = ( Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * Curve.Coeff3 ) ) + ( Curve.Coeff4 + V1 * ( Curve.Coeff5 + V1 * Curve.Coeff6 ) ) * V2;
+		} else if ( Type == CubicLinear ) {
+			Value = ( Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * ( Curve.Coeff3 + V1 * Curve.Coeff4 ) ) ) + ( Curve.Coeff5 + V1 * Curve.Coeff6 ) * V2;
+		} else if ( Type == BiCubic ) {
+			Value = Curve.Coeff1 + V1 * Curve.Coeff2 + V1 * V1 * Curve.Coeff3 + V2 * Curve.Coeff4 + V2 * V2 * Curve.Coeff5 + V1 * V2 * Curve.Coeff6 + V1 * V1 * V1 * Curve.Coeff7 + V2 * V2 * V2 * Curve.Coeff8 + V1 * V1 * V2 * Curve.Coeff9 + V1 * V2 * V2 * Curve.Coeff10;
+		} else if ( Type == ChillerPartLoadWithLift ) {
+			Value = Curve.Coeff1 + Curve.Coeff2 * V1 + Curve.Coeff3 * V1 * V1 + Curve.Coeff4 * V2 + Curve.Coeff5 * V2 * V2 + Curve.Coeff6 * V1 * V2 + Curve.Coeff7 * V1 * V1 * V1 + Curve.Coeff8 * V2 * V2 * V2 + Curve.Coeff9 * V1 * V1 * V2 + Curve.Coeff10 * V1 * V2 * V2 + Curve.Coeff11 * V1 * V1 * V2 * V2 + Curve.Coeff12 * V3 * V2 * V2 * V2;
+		} else if ( Type == TriQuadratic ) {
+			// only the coefficients set by SetUpEquationCurves
+			Value = Curve.Tri2ndOrder( 1 ).CoeffA0 + Curve.Tri2ndOrder( 1 ).CoeffA2 * V1 + Curve.Tri2ndOrder( 1 ).CoeffA4 * V2 + Curve.Tri2ndOrder( 1 ).CoeffA8 * V1 * V2;
+		} else if ( Type == Exponent ) {
+			Value = Curve.Coeff1 + Curve.Coeff2 * std::pow( V1, Curve.Coeff3 );
+		} else if ( Type == FanPressureRise ) {
+			Value = V1 * ( Curve.Coeff1 * V1 + Curve.Coeff2 + Curve.Coeff3 * std::sqrt( V2 ) ) + Curve.Coeff4 * V2;
+		} else if ( Type == ExponentialSkewNormal ) {
+			Real64 const Z1( ( V1 - Curve.Coeff1 ) / Curve.Coeff2 );
+			Real64 const Z2( ( Curve.Coeff4 * V1 * std::exp( Curve.Coeff3 * V1 ) - Curve.Coeff1 ) / Curve.Coeff2 );
+			Real64 const Z3( -Curve.Coeff1 / Curve.Coeff2 );
+			Value = std::exp( -0.5 * Z1 * Z1 ) * ( 1.0 + ( Z2 >= 0.0 ? 1.0 : -1.0 ) * std::erf( std::abs( Z2 ) / std::sqrt( 2.0 ) ) ) / ( std::exp( -0.5 * Z3 * Z3 ) * ( 1.0 + ( Z3 >= 0.0 ? 1.0 : -1.0 ) * std::erf( std::abs( Z3 ) / std::sqrt( 2.0 ) ) ) );
+		} else if ( Type == Sigmoid ) {
+			Value = Curve.Coeff1 + Curve.Coeff2 / std::pow( 1.0 + std::exp( ( Curve.Coeff3 - V1 ) / Curve.Coeff4 ), Curve.Coeff5 );
+		} else if ( Type == RectangularHyperbola1 ) {
+			Value = Curve.Coeff1 * V1 / ( Curve.Coeff2 + V1 ) + Curve.Coeff3;
+		} else if ( Type == RectangularHyperbola2 ) {
+			Value = Curve.Coeff1 * V1 / ( Curve.Coeff2 + V1 ) + Curve.Coeff3 * V1;
+		} else if ( Type == ExponentialDecay ) {
+			Value = Curve.Coeff1 + Curve.Coeff2 * std::exp( Curve.Coeff3 * V1 );
+		} else if ( Type == DoubleExponentialDecay ) {
+			Value = Curve.Coeff1 + Curve.Coeff2 * std::exp( Curve.Coeff3 * V1 ) + Curve.Coeff4 * std::exp( Curve.Coeff5 * V1 );
+		}
+		if ( Curve.CurveMinPresent ) Value = std::max( Value, Curve.CurveMin );
+		if ( Curve.CurveMaxPresent ) Value = std::min( Value, Curve.CurveMax );
+		return Value;
+	};
+
+	for ( int CurveNum = 1; CurveNum <= NumCurves; ++CurveNum ) {
+		for ( int i = 0; i <= 25; ++i ) {
+			Real64 const Var1( 0.1 * i );
+			Real64 const Var2( 2.5 - 0.1 * i );
+			Real64 const Var3( 0.05 + 0.07 * i );
+			EXPECT_NEAR( ReferenceValue( PerfCurve( CurveNum ), Var1, Var2, Var3 ), CurveValue( CurveNum, Var1, Var2, Var3 ), 1.0e-12 ) << "curve type " << CurveTypes( CurveNum ) << " at point " << i;
+		}
+	}
+
+	// types without an equation evaluate to zero
+	PerfCurve( 1 ).CurveType = FuncPressDrop;
+	EXPECT_DOUBLE_EQ( 0.0, CurveValue( 1, 1.0 ) );
+}
+
+TEST_F( EnergyPlusFixture, Tables_DirectLookupMatchesDLAG ) {
+	// five independent variable lookup table with evenly and unevenly spaced independent variables
+	NumCurves = 1;
+	PerfCurve.allocate( NumCurves );
+	PerfCurve( 1 ).Name = "TEST TABLE";
+	PerfCurve( 1 ).ObjectType = CurveType_TableMultiIV;
+	PerfCurve( 1 ).InterpolationType = LagrangeInterpolationLinearExtrapolation;
+	PerfCurve( 1 ).TableIndex = 1;
+	// limits extend past the table so that extrapolation is covered as well
+	PerfCurve( 1 ).Var1Min = 5.0;
+	PerfCurve( 1 ).Var1Max = 35.0;
+	PerfCurve( 1 ).Var2Min = 0.0;
+	PerfCurve( 1 ).Var2Max = 1.0;
+	PerfCurve( 1 ).Var3Min = 0.0;
+	PerfCurve( 1 ).Var3Max = 4.0;
+	PerfCurve( 1 ).Var4Min = 0.0;
+	PerfCurve( 1 ).Var4Max = 2.0;
+	PerfCurve( 1 ).Var5Min = -10.0;
+	PerfCurve( 1 ).Var5Max = 15.0;
+	GetCurvesInputFlag = false;
+
+	TableLookup.allocate( 1 );
+	auto & Table( TableLookup( 1 ) );
+	Table.NumIndependentVars = 5;
+	Table.X1Var.allocate( 5 );
+	Table.X1Var = { 10.0, 15.0, 20.0, 25.0, 30.0 };
+	Table.X2Var.allocate( 4 );
+	Table.X2Var = { 0.1, 0.3, 0.4, 0.8 };
+	Table.X3Var.allocate( 3 );
+	Table.X3Var = { 1.0, 2.0, 3.0 };
+	Table.X4Var.allocate( 2 );
+	Table.X4Var = { 0.5, 1.5 };
+	Table.X5Var.allocate( 4 );
+	Table.X5Var = { -5.0, 0.0, 5.0, 12.0 };
+	Table.NumX1Vars = Table.X1Var.isize();
+	Table.NumX2Vars = Table.X2Var.isize();
+	Table.NumX3Vars = Table.X3Var.isize();
+	Table.NumX4Vars = Table.X4Var.isize();
+	Table.NumX5Vars = Table.X5Var.isize();
+	Table.TableLookupZData.allocate( Table.NumX5Vars, Table.NumX4Vars, Table.NumX3Vars, Table.NumX2Vars, Table.NumX1Vars );
+	for ( int I5 = 1; I5 <= Table.NumX5Vars; ++I5 ) {
+		for ( int I4 = 1; I4 <= Table.NumX4Vars; ++I4 ) {
+			for ( int I3 = 1; I3 <= Table.NumX3Vars; ++I3 ) {
+				for ( int I2 = 1; I2 <= Table.NumX2Vars; ++I2 ) {
+					for ( int I1 = 1; I1 <= Table.NumX1Vars; ++I1 ) {
+						Real64 const X1( Table.X1Var( I1 ) );
+						Real64 const X2( Table.X2Var( I2 ) );
+						Table.TableLookupZData( I5, I4, I3, I2, I1 ) = 1.0 + 0.02 * X1 - 0.0004 * X1 * X1 + std::sin( 3.0 * X2 ) + 0.1 * Table.X3Var( I3 ) * X2 - 0.05 * Table.X4Var( I4 ) + 0.001 * Table.X5Var( I5 ) * X1;
+					}
+				}
+			}
+		}
+	}
+
+	Array1D< Real64 > const V1s( { 5.0, 10.0, 12.5, 17.0, 30.0, 33.0 } );
+	Array1D< Real64 > const V2s( { 0.05, 0.1, 0.35, 0.8, 0.9 } );
+	Array1D< Real64 > const V3s( { 1.0, 1.7, 3.2 } );
+	Array1D< Real64 > const V4s( { 0.2, 1.0, 1.5 } );
+	Array1D< Real64 > const V5s( { -7.0, 0.0, 3.0, 12.0, 14.0 } );
+
+	for ( int InterpolationOrder = 2; InterpolationOrder <= 4; ++InterpolationOrder ) {
+		Table.InterpolationOrder = InterpolationOrder;
+		SetUpTableLookupGrid( 1 );
+		ASSERT_TRUE( Table.DirectLookup );
+		EXPECT_DOUBLE_EQ( 0.2, Table.XVarStepInv( 1 ) ); // evenly spaced
+		EXPECT_DOUBLE_EQ( 0.0, Table.XVarStepInv( 2 ) ); // unevenly spaced
+
+		for ( auto const V1 : V1s ) {
+			for ( auto const V2 : V2s ) {
+				for ( auto const V3 : V3s ) {
+					for ( auto const V4 : V4s ) {
+						for ( auto const V5 : V5s ) {
+							Table.DirectLookup = true;
+							Real64 const DirectValue( TableLookupObject( 1, V1, V2, V3, V4, V5 ) );
+							Table.DirectLookup = false;
+							Real64 const DLAGValue( TableLookupObject( 1, V1, V2, V3, V4, V5 ) );
+							EXPECT_DOUBLE_EQ( DLAGValue, DirectValue );
+						}
+					}
+				}
+			}
+		}
+	}
+
+	// on the grid the table values are returned
+	Table.DirectLookup = true;
+	EXPECT_DOUBLE_EQ( Table.TableLookupZData( 2, 1, 3, 2, 4 ), TableLookupObject( 1, 25.0, 0.3, 3.0, 0.5, 0.0 ) );
+}
+
+TEST_F( EnergyPlusFixture, Tables_DirectLookupNotUsedForUnsortedData ) {
+	TableLookup.allocate( 1 );
+	auto & Table( TableLookup( 1 ) );
+	Table.NumIndependentVars = 1;
+	Table.InterpolationOrder = 2;
+	Table.X1Var.allocate( 3 );
+	Table.X1Var = { 1.0, 3.0, 2.0 };
+	Table.NumX1Vars = 3;
+	Table.TableLookupZData.allocate( 1, 1, 1, 1, 3 );
+	Table.TableLookupZData = 1.0;
+	SetUpTableLookupGrid( 1 );
+	EXPECT_TRUE( Table.GridSetUp );
+	EXPECT_FALSE( Table.DirectLookup );
+}
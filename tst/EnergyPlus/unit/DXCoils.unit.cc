@@ -71,6 +71,7 @@
 #include <DataSizing.hh>
 #include <DataEnvironment.hh>
 #include <DataHeatBalance.hh>
+#include <DataSystemVariables.hh>
 #include <OutputReportPredefined.hh>
 #include <ScheduleManager.hh>
 #include <Psychrometrics.hh>
@@ -1715,4 +1716,189 @@ namespace EnergyPlus {
 
 	}
 
+	TEST_F( EnergyPlusFixture, DXCoils_CalcTotCapSHRMemo ) {
+
+		DataSystemVariables::MemoizeDXCoilEnvFlag = true;
+		DataGlobals::CurrentTime = 12.0;
+		DataHVACGlobals::SysTimeElapsed = 0.0;
+
+		CurveManager::NumCurves = 2;
+		PerfCurve.allocate( CurveManager::NumCurves );
+		PerfCurve( 1 ).CurveType = CurveManager::BiQuadratic;
+		PerfCurve( 1 ).ObjectType = CurveType_BiQuadratic;
+		PerfCurve( 1 ).InterpolationType = EvaluateCurveToLimits;
+		PerfCurve( 1 ).Coeff1 = 0.9;
+		PerfCurve( 1 ).Coeff2 = 0.01;
+		PerfCurve( 1 ).Var1Min = -100.0;
+		PerfCurve( 1 ).Var1Max = 100.0;
+		PerfCurve( 1 ).Var2Min = -100.0;
+		PerfCurve( 1 ).Var2Max = 100.0;
+		PerfCurve( 2 ).CurveType = CurveManager::Quadratic;
+		PerfCurve( 2 ).ObjectType = CurveType_Quadratic;
+		PerfCurve( 2 ).InterpolationType = EvaluateCurveToLimits;
+		PerfCurve( 2 ).Coeff1 = 1.0;
+		PerfCurve( 2 ).Var1Min = 0.0;
+		PerfCurve( 2 ).Var1Max = 2.0;
+
+		Real64 const InletDryBulb( 26.7 );
+		Real64 const InletHumRat( 0.0111 );
+		Real64 const InletEnthalpy( Psychrometrics::PsyHFnTdbW( InletDryBulb, InletHumRat ) );
+		Real64 const InletWetBulb( Psychrometrics::PsyTwbFnTdbWPb( InletDryBulb, InletHumRat, 101325.0 ) );
+		Real64 TotCap1( 0.0 );
+		Real64 SHR1( 0.0 );
+		CalcTotCapSHR( InletDryBulb, InletHumRat, InletEnthalpy, InletWetBulb, 1.0, 0.5, 10000.0, 0.1, 1, 2, TotCap1, SHR1, 35.0, 101325.0 );
+		EXPECT_EQ( 0, CoilPerfMemo( TotCapSHRMemo ).NumHits );
+		EXPECT_EQ( 1, CoilPerfMemo( TotCapSHRMemo ).NumMisses );
+
+		// a PLR search repeats the call with inlet conditions differing only by round-off
+		Real64 TotCap2( 0.0 );
+		Real64 SHR2( 0.0 );
+		CalcTotCapSHR( InletDryBulb * ( 1.0 + 1.0e-12 ), InletHumRat, InletEnthalpy, InletWetBulb, 1.0, 0.5, 10000.0, 0.1, 1, 2, TotCap2, SHR2, 35.0, 101325.0 );
+		EXPECT_EQ( 1, CoilPerfMemo( TotCapSHRMemo ).NumHits );
+		EXPECT_EQ( 1, CoilPerfMemo( TotCapSHRMemo ).NumMisses );
+		EXPECT_DOUBLE_EQ( TotCap1, TotCap2 );
+		EXPECT_DOUBLE_EQ( SHR1, SHR2 );
+
+		// the results are only valid within the system time step
+		PerfCurve( 1 ).Coeff1 = 1.0;
+		DataHVACGlobals::SysTimeElapsed = 0.25;
+		CalcTotCapSHR( InletDryBulb, InletHumRat, InletEnthalpy, InletWetBulb, 1.0, 0.5, 10000.0, 0.1, 1, 2, TotCap2, SHR2, 35.0, 101325.0 );
+		EXPECT_EQ( 1, CoilPerfMemo( TotCapSHRMemo ).NumHits );
+		EXPECT_EQ( 2, CoilPerfMemo( TotCapSHRMemo ).NumMisses );
+		EXPECT_GT( TotCap2, TotCap1 );
+
+		DataSystemVariables::MemoizeDXCoilEnvFlag = false;
+
+	}
+
+	TEST_F( EnergyPlusFixture, DXCoils_CalcDoe2DXCoilMemo ) {
+
+		std::string const idf_objects = delimited_string( {
+			"Curve:Biquadratic,",
+			"	WindACCoolCapFT, !- Name",
+			"	0.942587793,     !- Coefficient1 Constant",
+			"	0.009543347,     !- Coefficient2 x",
+			"	0.000683770,     !- Coefficient3 x**2",
+			"	-0.011042676,    !- Coefficient4 y",
+			"	0.000005249,     !- Coefficient5 y**2",
+			"	-0.000009720,    !- Coefficient6 x*y",
+			"	12.77778,        !- Minimum Value of x",
+			"	23.88889,        !- Maximum Value of x",
+			"	18.0,            !- Minimum Value of y",
+			"	46.11111;        !- Maximum Value of y",
+			"Curve:Biquadratic,",
+			"	WindACEIRFT,   !- Name",
+			"	0.342414409,   !- Coefficient1 Constant",
+			"	0.034885008,   !- Coefficient2 x",
+			"	-0.000623700,  !- Coefficient3 x**2",
+			"	0.004977216,   !- Coefficient4 y",
+			"	0.000437951,   !- Coefficient5 y**2",
+			"	-0.000728028,  !- Coefficient6 x*y",
+			"	12.77778,      !- Minimum Value of x",
+			"	23.88889,      !- Maximum Value of x",
+			"	18.0,          !- Minimum Value of y",
+			"	46.11111;      !- Maximum Value of y",
+			"Curve:Quadratic,",
+			"	WindACCoolCapFFF, !- Name",
+			"	0.8,              !- Coefficient1 Constant",
+			"	0.2,              !- Coefficient2 x",
+			"	0.0,              !- Coefficient3 x**2",
+			"	0.5,              !- Minimum Value of x",
+			"	1.5;              !- Maximum Value of x",
+			"Curve:Quadratic,",
+			"	WindACEIRFFF, !- Name",
+			"	1.1552,       !- Coefficient1 Constant",
+			"  -0.1808,       !- Coefficient2 x",
+			"	0.0256,       !- Coefficient3 x**2",
+			"	0.5,          !- Minimum Value of x",
+			"	1.5;          !- Maximum Value of x",
+			"Curve:Quadratic,",
+			"	WindACPLFFPLR, !- Name",
+			"	0.85,          !- Coefficient1 Constant",
+			"	0.15,          !- Coefficient2 x",
+			"	0.0,           !- Coefficient3 x**2",
+			"	0.0,           !- Minimum Value of x",
+			"	1.0;           !- Maximum Value of x",
+			"Coil:Cooling:DX:SingleSpeed,",
+			"	Furnace ACDXCoil 1,   !- Name",
+			"	,                     !- Availability Schedule Name",
+			"	25000.0,              !- Gross Rated Total Cooling Capacity { W }",
+			"	0.75,                 !- Gross Rated Sensible Heat Ratio",
+			"	4.40,                 !- Gross Rated Cooling COP { W / W }",
+			"	1.30,                 !- Rated Air Flow Rate { m3 / s }",
+			"	,                     !- Rated Evaporator Fan Power Per Volume Flow Rate { W / ( m3 / s ) }",
+			"	DX Cooling Coil Air Inlet Node, !- Air Inlet Node Name",
+			"	Heating Coil Air Inlet Node,    !- Air Outlet Node Name",
+			"	WindACCoolCapFT,      !- Total Cooling Capacity Function of Temperature Curve Name",
+			"	WindACCoolCapFFF,     !- Total Cooling Capacity Function of Flow Fraction Curve Name",
+			"	WindACEIRFT,          !- Energy Input Ratio Function of Temperature Curve Name",
+			"	WindACEIRFFF,         !- Energy Input Ratio Function of Flow Fraction Curve Name",
+			"	WindACPLFFPLR;        !- Part Load Fraction Correlation Curve Name",
+		} );
+
+		ASSERT_FALSE( process_idf( idf_objects ) );
+
+		GetCurveInput();
+		GetDXCoils();
+		ASSERT_EQ( 1, NumDXCoils );
+
+		// rated conditions as set by the coil sizing
+		Real64 const RatedInletAirTemp( 26.6667 );
+		Real64 const RatedInletAirHumRat( 0.01125 );
+		StdBaroPress = 101325.0;
+		DXCoil( 1 ).RatedAirMassFlowRate( 1 ) = DXCoil( 1 ).RatedAirVolFlowRate( 1 ) * Psychrometrics::PsyRhoAirFnPbTdbW( StdBaroPress, RatedInletAirTemp, RatedInletAirHumRat );
+		DXCoil( 1 ).RatedCBF( 1 ) = CalcCBF( DXCoil( 1 ).DXCoilType, DXCoil( 1 ).Name, RatedInletAirTemp, RatedInletAirHumRat, DXCoil( 1 ).RatedTotCap( 1 ), DXCoil( 1 ).RatedAirMassFlowRate( 1 ), DXCoil( 1 ).RatedSHR( 1 ) );
+
+		OutBaroPress = 101325.0;
+		OutDryBulbTemp = 35.0;
+		OutHumRat = 0.0120;
+		OutWetBulbTemp = Psychrometrics::PsyTwbFnTdbWPb( OutDryBulbTemp, OutHumRat, OutBaroPress );
+		DXCoil( 1 ).InletAirMassFlowRate = DXCoil( 1 ).RatedAirMassFlowRate( 1 );
+		DXCoil( 1 ).InletAirTemp = 25.0;
+		DXCoil( 1 ).InletAirHumRat = 0.0100;
+		DXCoil( 1 ).InletAirEnthalpy = Psychrometrics::PsyHFnTdbW( DXCoil( 1 ).InletAirTemp, DXCoil( 1 ).InletAirHumRat );
+
+		DataSystemVariables::MemoizeDXCoilEnvFlag = true;
+		DataGlobals::CurrentTime = 12.0;
+		DataHVACGlobals::SysTimeElapsed = 0.0;
+		DataHVACGlobals::TimeStepSys = 0.25;
+
+		CalcDoe2DXCoil( 1, On, false, 0.5, ContFanCycCoil );
+		Real64 const TotCoolRate1( DXCoil( 1 ).TotalCoolingEnergyRate );
+		EXPECT_GT( TotCoolRate1, 0.0 );
+		EXPECT_EQ( 0, CoilPerfMemo( Doe2FullLoadMemo ).NumHits );
+		EXPECT_EQ( 1, CoilPerfMemo( Doe2FullLoadMemo ).NumMisses );
+
+		// a part load ratio search repeats the full load calculation for the same inlet conditions
+		CalcDoe2DXCoil( 1, On, false, 0.6, ContFanCycCoil );
+		EXPECT_EQ( 1, CoilPerfMemo( Doe2FullLoadMemo ).NumHits );
+		EXPECT_EQ( 1, CoilPerfMemo( Doe2FullLoadMemo ).NumMisses );
+		EXPECT_NEAR( TotCoolRate1 * 0.6 / 0.5, DXCoil( 1 ).TotalCoolingEnergyRate, 1.0e-6 * TotCoolRate1 );
+
+		// heat pump water heaters reset the rated capacity within the time step
+		CalcDoe2DXCoil( 1, On, false, 0.5, ContFanCycCoil );
+		DXCoil( 1 ).RatedTotCap( 1 ) = 20000.0;
+		CalcDoe2DXCoil( 1, On, false, 0.5, ContFanCycCoil );
+		EXPECT_EQ( 2, CoilPerfMemo( Doe2FullLoadMemo ).NumHits );
+		EXPECT_EQ( 2, CoilPerfMemo( Doe2FullLoadMemo ).NumMisses );
+		EXPECT_LT( DXCoil( 1 ).TotalCoolingEnergyRate, 0.9 * TotCoolRate1 );
+		Real64 const SensCoolRate2( DXCoil( 1 ).SensCoolingEnergyRate );
+
+		// the same capacity with another bypass factor is not taken from the memo either
+		DXCoil( 1 ).RatedCBF( 1 ) *= 2.0;
+		CalcDoe2DXCoil( 1, On, false, 0.5, ContFanCycCoil );
+		EXPECT_EQ( 2, CoilPerfMemo( Doe2FullLoadMemo ).NumHits );
+		EXPECT_EQ( 3, CoilPerfMemo( Doe2FullLoadMemo ).NumMisses );
+		EXPECT_NE( SensCoolRate2, DXCoil( 1 ).SensCoolingEnergyRate );
+
+		// the results of the last calculation match those without the memo
+		Real64 const TotCoolRate3( DXCoil( 1 ).TotalCoolingEnergyRate );
+		Real64 const SensCoolRate3( DXCoil( 1 ).SensCoolingEnergyRate );
+		DataSystemVariables::MemoizeDXCoilEnvFlag = false;
+		CalcDoe2DXCoil( 1, On, false, 0.5, ContFanCycCoil );
+		EXPECT_DOUBLE_EQ( TotCoolRate3, DXCoil( 1 ).TotalCoolingEnergyRate );
+		EXPECT_DOUBLE_EQ( SensCoolRate3, DXCoil( 1 ).SensCoolingEnergyRate );
+
+	}
+
 }
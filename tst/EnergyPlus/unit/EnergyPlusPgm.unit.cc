@@ -0,0 +1,153 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// EnergyPlus::EnergyPlusPgm Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// C++ Headers
+#include <cfenv>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <unistd.h>
+#endif
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <ConfiguredFunctions.hh>
+#include <EnergyPlus/DataStringGlobals.hh>
+#include <EnergyPlus/FileSystem.hh>
+#include <EnergyPlusPgm.hh>
+
+using namespace EnergyPlus;
+using DataStringGlobals::pathChar;
+using namespace FileSystem;
+
+namespace {
+
+	// Output file contents without the first line, which holds the run date and time
+	std::string
+	ReadOutputFile( std::string const & fileName )
+	{
+		std::ifstream file( fileName );
+		std::string header;
+		std::getline( file, header );
+		std::stringstream contents;
+		contents << file.rdbuf();
+		return contents.str();
+	}
+
+}
+
+TEST_F( EnergyPlusFixture, EnergyPlusPgm_RunTwiceSameResults )
+{
+	// The same input run twice in one process must give the same results
+	std::string const startDirectory( getAbsolutePath( "." ) );
+	std::string const runDirectory( startDirectory + pathChar + "EnergyPlusPgm_RunTwice" );
+	makeDirectory( runDirectory );
+
+	// The library looks for the data dictionary in the run directory
+	{
+		std::ifstream source( configured_build_directory() + "/Products/Energy+.idd", std::ios::binary );
+		std::ofstream idd( runDirectory + pathChar + "Energy+.idd", std::ios::binary );
+		idd << source.rdbuf();
+	}
+
+	// Design days only, so no weather file is needed
+	{
+		std::ifstream source( configured_source_directory() + "/testfiles/5ZoneAirCooled.idf" );
+		std::ofstream idf( runDirectory + pathChar + "in.idf" );
+		std::string line;
+		while ( std::getline( source, line ) ) {
+			if ( line.find( "!- Run Simulation for Sizing Periods" ) != std::string::npos ) line = "    Yes,";
+			if ( line.find( "!- Run Simulation for Weather File Run Periods" ) != std::string::npos ) line = "    No;";
+			idf << line << '\n';
+		}
+	}
+
+	// EnergyPlusPgm enables floating point exceptions in debug builds
+	std::fenv_t fpEnvironment;
+	std::fegetenv( &fpEnvironment );
+
+	EXPECT_EQ( EXIT_SUCCESS, EnergyPlusPgm( runDirectory ) );
+	std::string const firstEso( ReadOutputFile( runDirectory + pathChar + "eplusout.eso" ) );
+	std::string const firstMtr( ReadOutputFile( runDirectory + pathChar + "eplusout.mtr" ) );
+
+	EXPECT_EQ( EXIT_SUCCESS, EnergyPlusPgm( runDirectory ) );
+	std::string const secondEso( ReadOutputFile( runDirectory + pathChar + "eplusout.eso" ) );
+	std::string const secondMtr( ReadOutputFile( runDirectory + pathChar + "eplusout.mtr" ) );
+
+	std::fesetenv( &fpEnvironment );
+
+	// EnergyPlusPgm changes into the run directory
+#ifdef _WIN32
+	_chdir( startDirectory.c_str() );
+#else
+	chdir( startDirectory.c_str() );
+#endif
+
+	EXPECT_FALSE( firstEso.empty() );
+	EXPECT_TRUE( firstEso == secondEso );
+	EXPECT_TRUE( firstMtr == secondMtr );
+}
@@ -0,0 +1,173 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+
+// EnergyPlus Headers
+#include "HeatBalanceHAMTManagerFixture.hh"
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataHeatBalFanSys.hh>
+#include <EnergyPlus/DataHeatBalSurface.hh>
+#include <EnergyPlus/DataMoistureBalance.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/Psychrometrics.hh>
+
+namespace EnergyPlus {
+
+	std::vector< std::string > const HeatBalanceHAMTManagerFixture::HAMTWallMaterials( {
+		"MaterialProperty:HeatAndMoistureTransfer:Settings, Concrete, 0.76, 0.01;",
+		"MaterialProperty:HeatAndMoistureTransfer:Settings, Spruce, 0.73, 0.05;",
+		"MaterialProperty:HeatAndMoistureTransfer:SorptionIsotherm, Concrete, 10,",
+		"  0.202, 19.665, 0.2205, 22.31, 0.449, 38.4675, 0.454, 38.4675, 0.6506, 54.165,",
+		"  0.655, 54.165, 0.824, 72.565, 0.8725, 85.1, 0.924, 91.08, 0.964, 100.28;",
+		"MaterialProperty:HeatAndMoistureTransfer:SorptionIsotherm, Spruce, 7,",
+		"  0.205, 25.935, 0.4465, 44.3625, 0.6515, 61.99375, 0.6545, 61.99375, 0.83, 87.1325,",
+		"  0.9525, 119.665, 0.956, 120.12;",
+		"MaterialProperty:HeatAndMoistureTransfer:Suction, Concrete, 5,",
+		"  0, 0, 72, 7.41e-11, 85, 2.53e-10, 100, 1.01e-9, 118, 1.28e-9;",
+		"MaterialProperty:HeatAndMoistureTransfer:Suction, Spruce, 3, 0, 0, 20, 3.2e-13, 600, 9.2e-12;",
+		"MaterialProperty:HeatAndMoistureTransfer:Redistribution, Concrete, 5,",
+		"  0, 0, 72, 7.41e-12, 85, 2.53e-11, 100, 1.01e-10, 118, 1.28e-10;",
+		"MaterialProperty:HeatAndMoistureTransfer:Redistribution, Spruce, 3, 0, 0, 20, 3.2e-13, 600, 9.2e-12;",
+		"MaterialProperty:HeatAndMoistureTransfer:Diffusion, Concrete, 1, 0, 180;",
+		"MaterialProperty:HeatAndMoistureTransfer:Diffusion, Spruce, 3, 0, 700, 0.5, 200, 1, 20;",
+		"MaterialProperty:HeatAndMoistureTransfer:ThermalConductivity, Concrete, 2, 0, 1.6, 180, 2.602;",
+		"MaterialProperty:HeatAndMoistureTransfer:ThermalConductivity, Spruce, 2, 0, 0.09, 730, 0.278;",
+	} );
+
+	void
+	HeatBalanceHAMTManagerFixture::SetupHAMTTestWall()
+	{
+		DataGlobals::TimeStepZone = 0.25;
+		DataEnvironment::OutBaroPress = 101325.0;
+
+		DataHeatBalance::TotMaterials = 2;
+		DataHeatBalance::Material.allocate( 2 );
+		auto & concrete( DataHeatBalance::Material( 1 ) );
+		concrete.Name = "CONCRETE";
+		concrete.Thickness = 0.1;
+		concrete.Conductivity = 1.6;
+		concrete.Density = 2300.0;
+		concrete.SpecHeat = 850.0;
+		auto & spruce( DataHeatBalance::Material( 2 ) );
+		spruce.Name = "SPRUCE";
+		spruce.Thickness = 0.012;
+		spruce.Conductivity = 0.09;
+		spruce.Density = 455.0;
+		spruce.SpecHeat = 1500.0;
+
+		DataHeatBalance::TotConstructs = 1;
+		DataHeatBalance::Construct.allocate( 1 );
+		DataHeatBalance::Construct( 1 ).Name = "WALL";
+		DataHeatBalance::Construct( 1 ).TotLayers = 2;
+		DataHeatBalance::Construct( 1 ).LayerPoint( 1 ) = 1;
+		DataHeatBalance::Construct( 1 ).LayerPoint( 2 ) = 2;
+
+		DataSurfaces::TotSurfaces = 1;
+		DataSurfaces::Surface.allocate( 1 );
+		auto & wall( DataSurfaces::Surface( 1 ) );
+		wall.Name = "WALL";
+		wall.HeatTransSurf = true;
+		wall.Class = DataSurfaces::SurfaceClass_Wall;
+		wall.HeatTransferAlgorithm = DataSurfaces::HeatTransferModel_HAMT;
+		wall.Construction = 1;
+		wall.Area = 10.0;
+		wall.Zone = 1;
+		wall.ExtBoundCond = DataSurfaces::ExternalEnvironment;
+
+		DataMoistureBalance::TempOutsideAirFD.dimension( 1, 0.0 );
+		DataMoistureBalance::RhoVaporAirOut.dimension( 1, 0.0 );
+		DataMoistureBalance::RhoVaporAirIn.dimension( 1, 0.0 );
+		DataMoistureBalance::HConvExtFD.dimension( 1, 20.0 );
+		DataMoistureBalance::HMassConvExtFD.dimension( 1, 0.02 );
+		DataMoistureBalance::HConvInFD.dimension( 1, 3.0 );
+		DataMoistureBalance::HMassConvInFD.dimension( 1, 0.003 );
+		DataMoistureBalance::RhoVaporSurfIn.dimension( 1, 0.0 );
+		DataMoistureBalance::HSkyFD.dimension( 1, 5.0 );
+		DataMoistureBalance::HGrndFD.dimension( 1, 0.0 );
+		DataMoistureBalance::HAirFD.dimension( 1, 0.0 );
+		DataHeatBalSurface::QRadSWOutAbs.dimension( 1, 0.0 );
+		DataHeatBalSurface::QRadSWInAbs.dimension( 1, 0.0 );
+		DataHeatBalSurface::NetLWRadToSurf.dimension( 1, 0.0 );
+		DataHeatBalance::QRadThermInAbs.dimension( 1, 0.0 );
+		DataHeatBalFanSys::MAT.dimension( 1, 21.0 );
+		DataHeatBalFanSys::QHTRadSysSurf.dimension( 1, 0.0 );
+		DataHeatBalFanSys::QHWBaseboardSurf.dimension( 1, 0.0 );
+		DataHeatBalFanSys::QSteamBaseboardSurf.dimension( 1, 0.0 );
+		DataHeatBalFanSys::QElecBaseboardSurf.dimension( 1, 0.0 );
+		DataHeatBalFanSys::QCoolingPanelSurf.dimension( 1, 0.0 );
+	}
+
+	void
+	HeatBalanceHAMTManagerFixture::SetHAMTTestWallConditions( int const step )
+	{
+		Real64 const hour( 0.25 * step );
+		Real64 const swing( std::sin( 2.0 * DataGlobals::Pi * ( hour - 9.0 ) / 24.0 ) );
+		Real64 const outtemp( 5.0 + 10.0 * swing );
+		DataMoistureBalance::TempOutsideAirFD( 1 ) = outtemp;
+		DataMoistureBalance::RhoVaporAirOut( 1 ) = Psychrometrics::PsyRhovFnTdbRh( outtemp, 0.8 );
+		DataMoistureBalance::RhoVaporAirIn( 1 ) = Psychrometrics::PsyRhovFnTdbRh( 21.0, 0.5 );
+		DataEnvironment::SkyTemp = outtemp - 10.0;
+		DataHeatBalSurface::QRadSWOutAbs( 1 ) = std::max( 0.0, 300.0 * swing );
+	}
+
+}
@@ -0,0 +1,228 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// C++ Headers
+#include <cmath>
+
+// EnergyPlus Headers
+#include "WindowManagerFixture.hh"
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataHeatBalFanSys.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/ElectricPowerServiceManager.hh>
+#include <EnergyPlus/HeatBalanceManager.hh>
+#include <EnergyPlus/HeatBalanceSurfaceManager.hh>
+#include <EnergyPlus/Psychrometrics.hh>
+#include <EnergyPlus/SolarShading.hh>
+
+namespace EnergyPlus {
+
+	int
+	WindowManagerFixture::SetupDoubleGlazedWindow()
+	{
+		bool ErrorsFound( false );
+
+		std::string const idf_objects = delimited_string({
+			"Version,8.4;",
+			"Material,",
+			"  Concrete Block,          !- Name",
+			"  MediumRough,             !- Roughness",
+			"  0.1014984,               !- Thickness {m}",
+			"  0.3805070,               !- Conductivity {W/m-K}",
+			"  608.7016,                !- Density {kg/m3}",
+			"  836.8000;                !- Specific Heat {J/kg-K}",
+			"Construction,",
+			"  WallConstruction,        !- Name",
+			"  Concrete Block;          !- Outside Layer",
+			"WindowMaterial:Glazing,",
+			"  CLEAR 3MM,               !- Name",
+			"  SpectralAverage,         !- Optical Data Type",
+			"  ,                        !- Window Glass Spectral Data Set Name",
+			"  0.003,                   !- Thickness {m}",
+			"  0.837,                   !- Solar Transmittance at Normal Incidence",
+			"  0.075,                   !- Front Side Solar Reflectance at Normal Incidence",
+			"  0.075,                   !- Back Side Solar Reflectance at Normal Incidence",
+			"  0.898,                   !- Visible Transmittance at Normal Incidence",
+			"  0.081,                   !- Front Side Visible Reflectance at Normal Incidence",
+			"  0.081,                   !- Back Side Visible Reflectance at Normal Incidence",
+			"  0.0,                     !- Infrared Transmittance at Normal Incidence",
+			"  0.84,                    !- Front Side Infrared Hemispherical Emissivity",
+			"  0.84,                    !- Back Side Infrared Hemispherical Emissivity",
+			"  0.9;                     !- Conductivity {W/m-K}",
+			"WindowMaterial:Gas,",
+			"  AIR 13MM,                !- Name",
+			"  Air,                     !- Gas Type",
+			"  0.0127;                  !- Thickness {m}",
+			"Construction,",
+			"  WindowConstruction,      !- Name",
+			"  CLEAR 3MM,               !- Outside Layer",
+			"  AIR 13MM,                !- Layer 2",
+			"  CLEAR 3MM;               !- Layer 3",
+			"FenestrationSurface:Detailed,",
+			"  FenestrationSurface,     !- Name",
+			"  Window,                  !- Surface Type",
+			"  WindowConstruction,      !- Construction Name",
+			"  Wall,                    !- Building Surface Name",
+			"  ,                        !- Outside Boundary Condition Object",
+			"  0.5000000,               !- View Factor to Ground",
+			"  ,                        !- Shading Control Name",
+			"  ,                        !- Frame and Divider Name",
+			"  1.0,                     !- Multiplier",
+			"  4,                       !- Number of Vertices",
+			"  0.200000,0.000000,2.100000,  !- X,Y,Z ==> Vertex 1 {m}",
+			"  0.200000,0.000000,0.1000000,  !- X,Y,Z ==> Vertex 2 {m}",
+			"  2.200000,0.000000,0.1000000,  !- X,Y,Z ==> Vertex 3 {m}",
+			"  2.200000,0.000000,2.100000;  !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,"
+			"  Wall,                    !- Name",
+			"  Wall,                    !- Surface Type",
+			"  WallConstruction,        !- Construction Name",
+			"  Zone,                    !- Zone Name",
+			"  Outdoors,                !- Outside Boundary Condition",
+			"  ,                        !- Outside Boundary Condition Object",
+			"  SunExposed,              !- Sun Exposure",
+			"  WindExposed,             !- Wind Exposure",
+			"  0.5000000,               !- View Factor to Ground",
+			"  4,                       !- Number of Vertices",
+			"  0.000000,0.000000,10.00000,  !- X,Y,Z ==> Vertex 1 {m}",
+			"  0.000000,0.000000,0,  !- X,Y,Z ==> Vertex 2 {m}",
+			"  10.00000,0.000000,0,  !- X,Y,Z ==> Vertex 3 {m}",
+			"  10.00000,0.000000,10.00000;  !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,"
+			"  Floor,                   !- Name",
+			"  Floor,                   !- Surface Type",
+			"  WallConstruction,        !- Construction Name",
+			"  Zone,                    !- Zone Name",
+			"  Outdoors,                !- Outside Boundary Condition",
+			"  ,                        !- Outside Boundary Condition Object",
+			"  NoSun,                   !- Sun Exposure",
+			"  NoWind,                  !- Wind Exposure",
+			"  1.0,                     !- View Factor to Ground",
+			"  4,                       !- Number of Vertices",
+			"  0.000000,0.000000,0,  !- X,Y,Z ==> Vertex 1 {m}",
+			"  0.000000,10.000000,0,  !- X,Y,Z ==> Vertex 2 {m}",
+			"  10.00000,10.000000,0,  !- X,Y,Z ==> Vertex 3 {m}",
+			"  10.00000,0.000000,0;  !- X,Y,Z ==> Vertex 4 {m}",
+			"Zone,"
+			"  Zone,                    !- Name",
+			"  0,                       !- Direction of Relative North {deg}",
+			"  6.000000,                !- X Origin {m}",
+			"  6.000000,                !- Y Origin {m}",
+			"  0,                       !- Z Origin {m}",
+			"  1,                       !- Type",
+			"  1,                       !- Multiplier",
+			"  autocalculate,           !- Ceiling Height {m}",
+			"  autocalculate;           !- Volume {m3}"
+		});
+
+		EXPECT_FALSE( process_idf( idf_objects ) );
+
+		DataHeatBalance::ZoneIntGain.allocate(1);
+
+		createFacilityElectricPowerServiceObject();
+		HeatBalanceManager::SetPreConstructionInputParameters();
+		HeatBalanceManager::GetProjectControlData( ErrorsFound );
+		HeatBalanceManager::GetFrameAndDividerData( ErrorsFound );
+		HeatBalanceManager::GetMaterialData( ErrorsFound );
+		HeatBalanceManager::GetConstructData( ErrorsFound );
+		HeatBalanceManager::GetBuildingData( ErrorsFound );
+
+		Psychrometrics::InitializePsychRoutines();
+
+		DataGlobals::TimeStep = 1;
+		DataGlobals::TimeStepZone = 1;
+		DataGlobals::HourOfDay = 1;
+		DataGlobals::NumOfTimeStepInHour = 1;
+		DataGlobals::BeginSimFlag = true;
+		DataGlobals::BeginEnvrnFlag = true;
+		DataEnvironment::OutBaroPress = 100000;
+
+		HeatBalanceManager::ManageHeatBalance();
+
+		int winNum = 0;
+		for ( int i = 1; i <= DataSurfaces::TotSurfaces; ++i ) {
+			if ( DataSurfaces::Surface( i ).Class == DataSurfaces::SurfaceClass_Window ) winNum = i;
+		}
+		if ( winNum == 0 ) return winNum;
+
+		Real64 const T_in = 22.0;
+		DataHeatBalance::CosIncAng.dimension( 1, 1, 3, 1.0 );
+		DataHeatBalance::SunlitFrac.dimension( 1, 1, 3, 1.0 );
+		DataHeatBalance::SunlitFracWithoutReveal.dimension( 1, 1, 3, 1.0 );
+		DataHeatBalance::TempEffBulkAir( winNum ) = T_in;
+		DataSurfaces::SurfaceWindow( winNum ).IRfromParentZone = DataGlobals::StefanBoltzmann * std::pow( T_in + DataGlobals::KelvinConv, 4 );
+		DataHeatBalFanSys::ZoneAirHumRatAvg.dimension( 1, 0.01 );
+		DataHeatBalFanSys::ZoneAirHumRat.dimension( 1, 0.01 );
+		DataHeatBalFanSys::MAT.dimension( 1, T_in );
+		DataEnvironment::BeamSolarRad = 0.0;
+
+		HeatBalanceSurfaceManager::InitSolarHeatGains();
+		SolarShading::CalcInteriorSolarDistribution();
+
+		// Absorbed solar and film coefficients away from the tabulated conditions
+		DataHeatBalance::QRadSWwinAbs( 1, winNum ) = 60.0;
+		DataHeatBalance::QRadSWwinAbs( 2, winNum ) = 15.0;
+		DataHeatBalance::HConvIn( winNum ) = 2.5;
+		DataHeatBalance::Zone( 1 ).InsideConvectionAlgo = DataHeatBalance::ASHRAESimple; // keep the inside film conductance fixed
+
+		return winNum;
+	}
+
+}
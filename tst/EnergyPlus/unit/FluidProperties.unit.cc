@@ -62,12 +62,16 @@
 #include <gtest/gtest.h>
 
 // EnergyPlus Headers
+#include <EnergyPlus/DataSystemVariables.hh>
 #include <EnergyPlus/FluidProperties.hh>
+#include <EnergyPlus/General.hh>
 
 #include <cmath>
 #include <ctgmath>
+#include <fstream>
 
 #include "Fixtures/EnergyPlusFixture.hh"
+#include <ConfiguredFunctions.hh>
 
 using namespace EnergyPlus;
 using namespace ObjexxFCL;
@@ -106,4 +110,175 @@ TEST_F( EnergyPlusFixture, FluidProperties_GetDensityGlycol)
 
 }
 
+TEST_F( EnergyPlusFixture, FluidProperties_FindArrayIndexWithHint )
+{
+	Array1D< Real64 > const EvenTemps( { -10.0, -5.0, 0.0, 5.0, 10.0, 15.0, 20.0 } );
+	Array1D< Real64 > const UnevenTemps( { -10.0, -4.0, 0.0, 1.0, 10.0, 18.0, 20.0 } );
+	EXPECT_DOUBLE_EQ( 0.2, EvenSpacingInverse( EvenTemps ) );
+	EXPECT_DOUBLE_EQ( 0.0, EvenSpacingInverse( UnevenTemps ) );
+
+	// same result as interval halving for any starting hint, including values on the grid and out of range
+	for ( auto const & Temps : { EvenTemps, UnevenTemps } ) {
+		Real64 const StepInv( EvenSpacingInverse( Temps ) );
+		for ( int LowBound = 1; LowBound <= 3; ++LowBound ) {
+			for ( Real64 Value = -12.0; Value <= 22.0; Value += 0.5 ) {
+				for ( int Hint = -1; Hint <= 8; ++Hint ) {
+					int IndexHint( Hint );
+					int const Index( FindArrayIndex( Value, Temps, LowBound, 7, IndexHint, StepInv ) );
+					EXPECT_EQ( FindArrayIndex( Value, Temps, LowBound, 7 ), Index );
+				}
+			}
+		}
+	}
+
+	// the hint follows the value
+	int IndexHint( 0 );
+	EXPECT_EQ( 1, FindArrayIndex( -4.5, UnevenTemps, 1, 7, IndexHint ) );
+	EXPECT_EQ( 1, IndexHint );
+	EXPECT_EQ( 3, FindArrayIndex( 0.5, UnevenTemps, 1, 7, IndexHint ) );
+	EXPECT_EQ( 3, IndexHint );
+}
+
+TEST_F( EnergyPlusFixture, FluidProperties_ShippedFluidsIndexHints )
+{
+	// Evaluates the properties of every refrigerant in the shipped data set and of the default glycols
+	// over their whole temperature range, once with the index hints and once with plain interval halving;
+	// both must agree exactly.
+	std::vector< std::string > idf_lines;
+	std::ifstream dataset( configured_source_directory() + "/datasets/FluidPropertiesRefData.idf" );
+	std::string line;
+	while ( std::getline( dataset, line ) ) idf_lines.push_back( line );
+	std::string const Glycols[] = { "EthyleneGlycol", "PropyleneGlycol" };
+	for ( auto const & glycol : Glycols ) {
+		idf_lines.push_back( "FluidProperties:GlycolConcentration," );
+		idf_lines.push_back( "  Test" + glycol + ", " + glycol + ", , 0.4;" );
+	}
+	ASSERT_FALSE( process_idf( delimited_string( idf_lines ) ) );
+
+	int RefrigIndex( 1 );
+	GetSatPressureRefrig( "STEAM", 100.0, RefrigIndex, "UnitTest" ); // get input
+	ASSERT_GE( NumOfRefrigerants, 12 );
+	ASSERT_EQ( 3, NumOfGlycols );
+
+	for ( int RefrigNum = 1; RefrigNum <= NumOfRefrigerants; ++RefrigNum ) {
+		auto & refrig( RefrigData( RefrigNum ) );
+		std::string const Name( refrig.Name );
+		Real64 const LowTemp( max( refrig.PsLowTempValue, refrig.HfLowTempValue, refrig.RhofLowTempValue, refrig.SHTemps( 1 ) ) + 10.0 );
+		Real64 const HighTemp( min( refrig.PsHighTempValue, refrig.HfHighTempValue, refrig.RhofHighTempValue, refrig.SHTemps( refrig.NumSuperTempPts ) ) - 10.0 );
+		std::vector< Real64 > Temps;
+		for ( Real64 Temp = LowTemp; Temp <= HighTemp; Temp += 0.25 ) Temps.push_back( Temp );
+
+		std::vector< Real64 > Values;
+		int Index( RefrigNum );
+		for ( Real64 const Temp : Temps ) {
+			Real64 const Pressure( GetSatPressureRefrig( Name, Temp, Index, "UnitTest" ) );
+			Values.push_back( Pressure );
+			Values.push_back( GetSatTemperatureRefrig( Name, Pressure, Index, "UnitTest" ) );
+			Values.push_back( GetSatEnthalpyRefrig( Name, Temp, 0.5, Index, "UnitTest" ) );
+			Values.push_back( GetSatDensityRefrig( Name, Temp, 0.5, Index, "UnitTest" ) );
+			Values.push_back( GetSatSpecificHeatRefrig( Name, Temp, 0.0, Index, "UnitTest" ) );
+			Values.push_back( GetSupHeatEnthalpyRefrig( Name, Temp + 5.0, Pressure, Index, "UnitTest" ) );
+		}
+
+		std::size_t Value( 0 );
+		for ( Real64 const Temp : Temps ) {
+			refrig.PsTempIndexHint = refrig.PsPresIndexHint = refrig.HTempIndexHint = refrig.CpTempIndexHint = 0;
+			refrig.RhoTempIndexHint = refrig.SHTempIndexHint = refrig.SHPressIndexHint = 0;
+			Real64 const Pressure( GetSatPressureRefrig( Name, Temp, Index, "UnitTest" ) );
+			EXPECT_EQ( Values[ Value++ ], Pressure );
+			EXPECT_EQ( Values[ Value++ ], GetSatTemperatureRefrig( Name, Pressure, Index, "UnitTest" ) );
+			EXPECT_EQ( Values[ Value++ ], GetSatEnthalpyRefrig( Name, Temp, 0.5, Index, "UnitTest" ) );
+			EXPECT_EQ( Values[ Value++ ], GetSatDensityRefrig( Name, Temp, 0.5, Index, "UnitTest" ) );
+			EXPECT_EQ( Values[ Value++ ], GetSatSpecificHeatRefrig( Name, Temp, 0.0, Index, "UnitTest" ) );
+			refrig.SHTempIndexHint = refrig.SHPressIndexHint = 0;
+			EXPECT_EQ( Values[ Value++ ], GetSupHeatEnthalpyRefrig( Name, Temp + 5.0, Pressure, Index, "UnitTest" ) );
+		}
+	}
 
+	for ( int GlycolNum = 1; GlycolNum <= NumOfGlycols; ++GlycolNum ) {
+		auto & glycol( GlycolData( GlycolNum ) );
+		std::string const Name( glycol.Name );
+		EXPECT_GT( glycol.CpTempStepInv, 0.0 ); // default glycol data is evenly spaced
+		std::vector< Real64 > Temps;
+		for ( Real64 Temp = glycol.CpLowTempValue; Temp <= glycol.CpHighTempValue; Temp += 0.125 ) Temps.push_back( Temp );
+
+		std::vector< Real64 > Values;
+		int Index( GlycolNum );
+		for ( Real64 const Temp : Temps ) {
+			Values.push_back( GetSpecificHeatGlycol( Name, Temp, Index, "UnitTest" ) );
+			Values.push_back( GetDensityGlycol( Name, Temp, Index, "UnitTest" ) );
+			Values.push_back( GetConductivityGlycol( Name, Temp, Index, "UnitTest" ) );
+			Values.push_back( GetViscosityGlycol( Name, Temp, Index, "UnitTest" ) );
+		}
+
+		glycol.CpTempStepInv = glycol.RhoTempStepInv = glycol.CondTempStepInv = glycol.ViscTempStepInv = 0.0;
+		std::size_t Value( 0 );
+		for ( Real64 const Temp : Temps ) {
+			glycol.CpTempIndexHint = glycol.RhoTempIndexHint = glycol.CondTempIndexHint = glycol.ViscTempIndexHint = 0;
+			EXPECT_EQ( Values[ Value++ ], GetSpecificHeatGlycol( Name, Temp, Index, "UnitTest" ) );
+			EXPECT_EQ( Values[ Value++ ], GetDensityGlycol( Name, Temp, Index, "UnitTest" ) );
+			EXPECT_EQ( Values[ Value++ ], GetConductivityGlycol( Name, Temp, Index, "UnitTest" ) );
+			EXPECT_EQ( Values[ Value++ ], GetViscosityGlycol( Name, Temp, Index, "UnitTest" ) );
+		}
+	}
+}
+
+TEST_F( EnergyPlusFixture, FluidProperties_SupHeatTempTableAccuracy )
+{
+	// The tabulated superheated temperatures are checked over the whole range of each table against
+	// the solution of the enthalpy residual at the tolerance of the table points: they must be within
+	// 0.3C of it and closer to it on average than the iterative solution.
+	std::vector< std::string > idf_lines;
+	std::ifstream dataset( configured_source_directory() + "/datasets/FluidPropertiesRefData.idf" );
+	std::string line;
+	while ( std::getline( dataset, line ) ) idf_lines.push_back( line );
+	ASSERT_FALSE( process_idf( delimited_string( idf_lines ) ) );
+
+	std::string const Names[] = { "R22", "R134A", "R404A", "R410A" };
+	for ( auto const & Name : Names ) {
+		int RefrigIndex( 0 );
+		GetSatPressureRefrig( Name, 5.0, RefrigIndex, "UnitTest" ); // get input
+		ASSERT_GT( RefrigIndex, 0 );
+		auto const & refrig( RefrigData( RefrigIndex ) );
+
+		// the table points at the edges of the data are not reported
+		SetupSupHeatTempTable( RefrigIndex );
+		EXPECT_FALSE( has_err_output() );
+		ASSERT_TRUE( refrig.SHTempTableBuilt );
+		ASSERT_GT( refrig.SHTempTablePressHigh, refrig.SHTempTablePressLow );
+
+		// pressures between the table rows and enthalpies between the table columns
+		Array1D< Real64 > Par( 4 ); // Parameters passed to RegulaFalsi
+		int SolFla; // Flag of RegulaFalsi solver
+		Real64 TableErrorSum( 0.0 );
+		Real64 IterErrorSum( 0.0 );
+		int const NumPress( 37 );
+		int const NumEnth( 23 );
+		Real64 const THigh( refrig.PsHighTempValue );
+		for ( int i = 0; i < NumPress; ++i ) {
+			Real64 const Pressure( refrig.SHTempTablePressLow + ( i + 0.37 ) / NumPress * ( refrig.SHTempTablePressHigh - refrig.SHTempTablePressLow ) );
+			Real64 const TSat( GetSatTemperatureRefrig( Name, Pressure, RefrigIndex, "UnitTest" ) );
+			Real64 const EnthSat( GetSupHeatEnthalpyRefrig( Name, TSat, Pressure, RefrigIndex, "UnitTest" ) );
+			Real64 const EnthHigh( GetSupHeatEnthalpyRefrig( Name, THigh, Pressure, RefrigIndex, "UnitTest" ) );
+			for ( int j = 0; j < NumEnth; ++j ) {
+				Real64 const Enthalpy( EnthSat + ( j + 0.61 ) / ( NumEnth + 1 ) * ( EnthHigh - EnthSat ) );
+				DataSystemVariables::RefrigTablesEnvFlag = false;
+				Real64 const IterTemp( GetSupHeatTempRefrig( Name, Pressure, Enthalpy, TSat, THigh, RefrigIndex, "UnitTest" ) );
+				DataSystemVariables::RefrigTablesEnvFlag = true;
+				Real64 const TableTemp( GetSupHeatTempRefrig( Name, Pressure, Enthalpy, TSat, THigh, RefrigIndex, "UnitTest" ) );
+				Real64 Temp;
+				Par( 1 ) = RefrigIndex;
+				Par( 2 ) = Enthalpy;
+				Par( 3 ) = Pressure;
+				Par( 4 ) = 0.0;
+				General::SolveRegulaFalsi( 1.0e-9, 500, SolFla, Temp, GetSupHeatTempRefrigResidual, TSat, THigh, Par );
+				ASSERT_GT( SolFla, 0 );
+				EXPECT_NEAR( Temp, TableTemp, 0.3 );
+				TableErrorSum += std::abs( TableTemp - Temp );
+				IterErrorSum += std::abs( IterTemp - Temp );
+			}
+		}
+		DataSystemVariables::RefrigTablesEnvFlag = false;
+		EXPECT_LT( TableErrorSum, IterErrorSum );
+	}
+}
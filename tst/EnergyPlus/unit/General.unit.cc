@@ -58,10 +58,15 @@
 
 // EnergyPlus::SortAndStringUtilities Unit Tests
 
+// C++ Headers
+#include <cmath>
+
 // Google Test Headers
 #include <gtest/gtest.h>
 
 // EnergyPlus Headers
+#include <EnergyPlus/DataRootFinder.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
 #include <EnergyPlus/General.hh>
 
 #include "Fixtures/EnergyPlusFixture.hh"
@@ -245,3 +250,117 @@ TEST_F( EnergyPlusFixture, General_CreateTimeIntervalString )
 		EXPECT_EQ( "00:00:59.0 - 00:00:59.9", General::CreateTimeIntervalString( 59, 59.9 ) );
 	}
 }
+
+TEST_F( EnergyPlusFixture, General_SolveRootMatchesSolveRegulaFalsi )
+{
+	auto const f = []( Real64 const X ) { return X * X * X - 2.0 * X - 5.0; };
+	auto const fPar = []( Real64 const X, Array1< Real64 > const & Par ) { return X * X * X - Par( 1 ) * X - Par( 2 ); };
+	Array1D< Real64 > Par( 2 );
+	Par( 1 ) = 2.0;
+	Par( 2 ) = 5.0;
+
+	int FlagPar;
+	int FlagLambda;
+	int FlagRoot;
+	Real64 XPar;
+	Real64 XLambda;
+	Real64 XRoot;
+	General::SolveRegulaFalsi( 1.0e-8, 100, FlagPar, XPar, fPar, 2.0, 3.0, Par );
+	General::SolveRegulaFalsi( 1.0e-8, 100, FlagLambda, XLambda, f, 2.0, 3.0 );
+	General::SolveRoot( 1.0e-8, 100, FlagRoot, XRoot, f, 2.0, 3.0 );
+	EXPECT_GT( FlagRoot, 0 );
+	EXPECT_NEAR( 2.0945514815, XRoot, 1.0e-8 );
+	EXPECT_EQ( FlagRoot, FlagPar );
+	EXPECT_EQ( FlagRoot, FlagLambda );
+	EXPECT_EQ( XRoot, XPar );
+	EXPECT_EQ( XRoot, XLambda );
+
+	// iteration limit and bracket errors keep the SolveRegulaFalsi exit status
+	General::SolveRoot( 1.0e-12, 2, FlagRoot, XRoot, f, 2.0, 3.0 );
+	EXPECT_EQ( -1, FlagRoot );
+	General::SolveRoot( 1.0e-8, 100, FlagRoot, XRoot, f, 3.0, 4.0 );
+	EXPECT_EQ( -2, FlagRoot );
+	EXPECT_EQ( 3.0, XRoot );
+}
+
+TEST_F( EnergyPlusFixture, General_SolveRootMethods )
+{
+	// strongly convex residual on which plain regula falsi keeps one bound fixed and converges slowly
+	auto const f = []( Real64 const X ) { return std::exp( X ) - 10.0; };
+	auto const dfdx = []( Real64 const X ) { return std::exp( X ); };
+	Real64 const Root( std::log( 10.0 ) );
+	Real64 const Eps( 1.0e-9 );
+
+	int FlagRegulaFalsi;
+	int Flag;
+	Real64 XRes;
+	General::SolveRoot( Eps, 500, FlagRegulaFalsi, XRes, f, 0.0, 6.0, DataRootFinder::iMethodFalsePosition );
+	EXPECT_GT( FlagRegulaFalsi, 0 );
+	EXPECT_NEAR( Root, XRes, 1.0e-9 );
+
+	General::SolveRoot( Eps, 500, Flag, XRes, f, 0.0, 6.0, DataRootFinder::iMethodIllinois );
+	EXPECT_GT( Flag, 0 );
+	EXPECT_LT( Flag, FlagRegulaFalsi );
+	EXPECT_NEAR( Root, XRes, 1.0e-9 );
+
+	General::SolveRoot( Eps, 500, Flag, XRes, f, 0.0, 6.0, DataRootFinder::iMethodBrent );
+	EXPECT_GT( Flag, 0 );
+	EXPECT_LT( Flag, FlagRegulaFalsi );
+	EXPECT_NEAR( Root, XRes, 1.0e-9 );
+
+	General::SolveRoot( Eps, 500, Flag, XRes, f, 6.0, 0.0, DataRootFinder::iMethodBisection );
+	EXPECT_GT( Flag, 0 );
+	EXPECT_NEAR( Root, XRes, 1.0e-9 );
+
+	General::SolveRootNewton( Eps, 500, Flag, XRes, f, dfdx, 0.0, 6.0 );
+	EXPECT_GT( Flag, 0 );
+	EXPECT_LT( Flag, FlagRegulaFalsi );
+	EXPECT_NEAR( Root, XRes, 1.0e-9 );
+
+	// a root lying exactly on a bound
+	auto const g = []( Real64 const X ) { return X - 0.25; };
+	auto const dgdx = []( Real64 const ) { return 1.0; };
+	for ( int const Method : { DataRootFinder::iMethodFalsePosition, DataRootFinder::iMethodIllinois, DataRootFinder::iMethodBrent, DataRootFinder::iMethodBisection } ) {
+		General::SolveRoot( Eps, 500, Flag, XRes, g, 0.25, 6.0, Method );
+		EXPECT_GT( Flag, 0 );
+		EXPECT_NEAR( 0.25, XRes, 1.0e-9 );
+	}
+	General::SolveRootNewton( Eps, 500, Flag, XRes, g, dgdx, 6.0, 0.25 );
+	EXPECT_EQ( 1, Flag );
+	EXPECT_DOUBLE_EQ( 0.25, XRes );
+
+	General::SolveRoot( Eps, 500, Flag, XRes, f, 3.0, 6.0, DataRootFinder::iMethodBrent );
+	EXPECT_EQ( -2, Flag );
+	General::SolveRootNewton( Eps, 500, Flag, XRes, f, dfdx, 3.0, 6.0 );
+	EXPECT_EQ( -2, Flag );
+}
+
+TEST_F( EnergyPlusFixture, General_SolveRootStatistics )
+{
+	auto const f = []( Real64 const X ) { return X - 0.25; };
+	int Flag;
+	Real64 XRes;
+
+	// statistics are not gathered unless requested
+	General::SolveRoot( 1.0e-6, 50, Flag, XRes, f, 0.0, 1.0, DataRootFinder::iMethodFalsePosition, "Unit Test Caller" );
+	EXPECT_EQ( 0, DataRootFinder::NumRootSolverStats );
+
+	DataSystemVariables::TrackRootSolverEnvFlag = true;
+	General::SolveRoot( 1.0e-6, 50, Flag, XRes, f, 0.0, 1.0, DataRootFinder::iMethodFalsePosition, "Unit Test Caller" );
+	General::SolveRoot( 1.0e-6, 50, Flag, XRes, f, 0.5, 1.0, DataRootFinder::iMethodFalsePosition, "Unit Test Caller" );
+	General::SolveRoot( 1.0e-6, 50, Flag, XRes, f, 0.0, 1.0, DataRootFinder::iMethodBrent, "Other Caller" );
+	General::SolveRoot( 1.0e-6, 50, Flag, XRes, f, 0.0, 1.0 ); // anonymous callers are not tracked
+	DataSystemVariables::TrackRootSolverEnvFlag = false;
+
+	ASSERT_EQ( 2, DataRootFinder::NumRootSolverStats );
+	auto const & Stats( DataRootFinder::RootSolverStats( 1 ) );
+	EXPECT_EQ( "Unit Test Caller", Stats.Name );
+	EXPECT_EQ( 2, Stats.NumCalls );
+	EXPECT_EQ( 1, Stats.NumConverged );
+	EXPECT_EQ( 1, Stats.NumNotBracketed );
+	EXPECT_EQ( 0, Stats.NumIterationLimit );
+	EXPECT_EQ( 1, Stats.TotIterations );
+	EXPECT_EQ( 1, Stats.MaxIterations );
+	EXPECT_EQ( "Other Caller", DataRootFinder::RootSolverStats( 2 ).Name );
+	EXPECT_EQ( DataRootFinder::iMethodBrent, DataRootFinder::RootSolverStats( 2 ).MethodType );
+}
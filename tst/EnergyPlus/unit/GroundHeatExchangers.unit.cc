@@ -61,10 +61,15 @@
 // Google Test Headers
 #include <gtest/gtest.h>
 
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+
 // EnergyPlus Headers
 #include <EnergyPlus/GroundHeatExchangers.hh>
 #include <EnergyPlus/DataPlant.hh>
 #include <EnergyPlus/DataLoopNode.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
 #include <EnergyPlus/UtilityRoutines.hh>
 #include "Fixtures/EnergyPlusFixture.hh"
 
@@ -265,6 +270,9 @@ TEST_F( EnergyPlusFixture, SlinkyGroundHeatExchangerTest_CalcGroundHeatExchanger
 	// Initializations
 	GLHESlinky thisGLHE;
 
+	DataSystemVariables::GFunctionCacheFileName = "GroundHeatExchangers_Slinky.cache";
+	std::remove( DataSystemVariables::GFunctionCacheFileName.c_str() );
+
 	thisGLHE.numCoils = 100;
 	thisGLHE.numTrenches = 2;
 	thisGLHE.maxSimYears = 10;
@@ -286,6 +294,107 @@ TEST_F( EnergyPlusFixture, SlinkyGroundHeatExchangerTest_CalcGroundHeatExchanger
 	thisGLHE.calcGFunctions();
 	EXPECT_NEAR( 18.91819, thisGLHE.GFNC( 28 ), 0.0001 );
 
+	// Same field again, read back from the g-function cache
+	GLHESlinky cachedGLHE( thisGLHE );
+	cachedGLHE.GFNC = 0.0;
+	cachedGLHE.calcGFunctions();
+	EXPECT_DOUBLE_EQ( thisGLHE.GFNC( 28 ), cachedGLHE.GFNC( 28 ) );
+
+	std::remove( DataSystemVariables::GFunctionCacheFileName.c_str() );
+	DataSystemVariables::GFunctionCacheFileName = "eplusgfn.cache";
+
+}
+
+TEST_F( EnergyPlusFixture, VerticalGroundHeatExchangerTest_FiniteLineSource )
+{
+
+	Real64 const length( 100.0 );
+	Real64 const radius( 0.05 );
+	Real64 const depth( 4.0 );
+	std::vector< Real64 > const distances( { radius, 5.0, 50.0 } );
+	std::vector< Real64 > responses;
+
+	// Short times: the borehole acts as an infinite line source, 0.5 * E1( r^2 / ( 4 alpha t ) )
+	Real64 alphaTime = pow_2( length ) / 9.0 * std::exp( -10.0 );
+	finiteLineSourceResponses( distances, length, depth, alphaTime, responses );
+	ASSERT_EQ( 3u, responses.size() );
+	Real64 const x = pow_2( radius ) / ( 4.0 * alphaTime );
+	Real64 E1 = -0.5772156649015329 - std::log( x );
+	Real64 term = -1.0;
+	for ( int k = 1; k <= 20; ++k ) {
+		term *= -x / k;
+		E1 += term / k;
+	}
+	EXPECT_NEAR( 0.5 * E1, responses[ 0 ], 0.005 );
+	EXPECT_DOUBLE_EQ( 0.0, responses[ 1 ] );
+	EXPECT_DOUBLE_EQ( 0.0, responses[ 2 ] );
+
+	// Long times: finite length and ground surface bound the response
+	alphaTime = pow_2( length ) / 9.0 * std::exp( 3.0 );
+	finiteLineSourceResponses( distances, length, depth, alphaTime, responses );
+	EXPECT_NEAR( 6.7094, responses[ 0 ], 0.0005 );
+	EXPECT_NEAR( 2.1564, responses[ 1 ], 0.0005 );
+	EXPECT_NEAR( 0.3603, responses[ 2 ], 0.0005 );
+
+}
+
+TEST_F( EnergyPlusFixture, VerticalGroundHeatExchangerTest_CalcGFunctionsFromLayout )
+{
+
+	DataSystemVariables::GFunctionCacheFileName = "GroundHeatExchangers_Vertical.cache";
+	std::remove( DataSystemVariables::GFunctionCacheFileName.c_str() );
+
+	GLHEVert thisGLHE;
+	thisGLHE.boreholeLength = 100.0;
+	thisGLHE.boreholeRadius = 0.05;
+	thisGLHE.boreholeTopDepth = 4.0;
+	thisGLHE.diffusivityGround = 1.0e-6;
+	thisGLHE.maxSimYears = 1;
+	thisGLHE.numBoreholes = 4;
+	thisGLHE.boreholeX.allocate( 4 );
+	thisGLHE.boreholeY.allocate( 4 );
+	thisGLHE.boreholeX = { 0.0, 6.0, 0.0, 6.0 };
+	thisGLHE.boreholeY = { 0.0, 0.0, 6.0, 6.0 };
+
+	thisGLHE.calcGFunctions();
+
+	ASSERT_EQ( 37, thisGLHE.NPairs );
+	EXPECT_DOUBLE_EQ( -15.0, thisGLHE.LNTTS( 1 ) );
+	EXPECT_DOUBLE_EQ( 3.0, thisGLHE.LNTTS( 37 ) );
+	EXPECT_DOUBLE_EQ( 0.0005, thisGLHE.gReferenceRatio );
+
+	// Each borehole sees itself, two boreholes at 6 m and one at 6 * sqrt( 2 ) m
+	std::vector< Real64 > responses;
+	finiteLineSourceResponses( { 0.05, 6.0, 6.0 * std::sqrt( 2.0 ) }, 100.0, 4.0, pow_2( 100.0 ) / 9.0 * std::exp( 3.0 ), responses );
+	EXPECT_NEAR( responses[ 0 ] + 2.0 * responses[ 1 ] + responses[ 2 ], thisGLHE.GFNC( 37 ), 1.0e-10 );
+	for ( int i = 2; i <= thisGLHE.NPairs; ++i ) {
+		EXPECT_GT( thisGLHE.GFNC( i ), thisGLHE.GFNC( i - 1 ) );
+	}
+
+	// The same field with other soil properties is read from the cache, a different field is not
+	GLHEVert cachedGLHE( thisGLHE );
+	cachedGLHE.diffusivityGround = 5.0e-7;
+	cachedGLHE.GFNC = 0.0;
+	cachedGLHE.calcGFunctions();
+	for ( int i = 1; i <= thisGLHE.NPairs; ++i ) {
+		EXPECT_DOUBLE_EQ( thisGLHE.GFNC( i ), cachedGLHE.GFNC( i ) );
+	}
+
+	GLHEVert otherGLHE( thisGLHE );
+	otherGLHE.boreholeX( 4 ) = 7.0;
+	otherGLHE.calcGFunctions();
+	EXPECT_LT( otherGLHE.GFNC( 37 ), thisGLHE.GFNC( 37 ) );
+
+	std::ifstream cacheFile( DataSystemVariables::GFunctionCacheFileName );
+	std::string line;
+	int numLines( 0 );
+	while ( std::getline( cacheFile, line ) ) ++numLines;
+	EXPECT_EQ( 2, numLines );
+	cacheFile.close();
+
+	std::remove( DataSystemVariables::GFunctionCacheFileName.c_str() );
+	DataSystemVariables::GFunctionCacheFileName = "eplusgfn.cache";
+
 }
 
 TEST_F( EnergyPlusFixture, VerticalGLHEBadIDF_1 ) 
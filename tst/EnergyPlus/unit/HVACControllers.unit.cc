@@ -65,8 +65,11 @@
 #include <ObjexxFCL/Array1D.hh>
 
 // EnergyPlus Headers
+#include <EnergyPlus/DataHVACControllers.hh>
+#include <EnergyPlus/DataRootFinder.hh>
 #include <EnergyPlus/HVACControllers.hh>
 #include <EnergyPlus/MixedAir.hh>
+#include <EnergyPlus/RootFinder.hh>
 #include <EnergyPlus/ScheduleManager.hh>
 #include <EnergyPlus/SetPointManager.hh>
 #include <EnergyPlus/WaterCoils.hh>
@@ -219,4 +222,57 @@ namespace EnergyPlus {
 
 	}
 
+	TEST_F( EnergyPlusFixture, HVACControllers_WarmStartNewtonStep ) {
+		// Sensed - setpoint residual Y = X^2 - 0.25 with root X = 0.5
+		auto const Residual = []( Real64 const X ) { return X * X - 0.25; };
+
+		ControllerProps.allocate( 1 );
+		RootFinders.allocate( 1 );
+		RootFinder::SetupRootFinder( RootFinders( 1 ), DataRootFinder::iSlopeIncreasing, DataRootFinder::iMethodBrent, 0.0, 1.0e-6, 1.0e-3 );
+
+		// Solves the controller from the min point, as done after a cold start, and returns the number of iterations
+		auto const Solve = [&]( Real64 const Sensitivity ) {
+			auto & Controller( ControllerProps( 1 ) );
+			Controller.SolutionTrackers( 2 ).DefinedFlag = true;
+			Controller.SolutionTrackers( 2 ).Mode = DataHVACControllers::iModeActive;
+			Controller.SolutionTrackers( 2 ).ActuatedValue = 0.45;
+			Controller.SolutionTrackers( 2 ).Sensitivity = Sensitivity;
+			Controller.ReusePreviousSolutionFlag = true;
+			Controller.WarmStartNewtonFlag = false;
+			Controller.WarmStartFlag = false;
+			Controller.NumNewtonSteps = 0;
+			RootFinder::InitializeRootFinder( RootFinders( 1 ), 0.0, 1.0 );
+
+			bool IsConvergedFlag = false;
+			bool IsUpToDateFlag = true;
+			int NumIterations = 0;
+			Controller.NextActuatedValue = 0.0;
+			while ( ! IsConvergedFlag && NumIterations < 50 ) {
+				++NumIterations;
+				Controller.ActuatedValue = Controller.NextActuatedValue;
+				Controller.DeltaSensed = Residual( Controller.ActuatedValue );
+				FindRootSimpleController( 1, false, IsConvergedFlag, IsUpToDateFlag, "WARM START TEST" );
+				if ( NumIterations == 2 && Sensitivity != 0.0 ) {
+					// Newton step from the previous solution with the saved slope
+					EXPECT_NEAR( 0.45 + 0.0475 / Sensitivity, Controller.NextActuatedValue, 1.0e-10 );
+				}
+			}
+			EXPECT_TRUE( IsConvergedFlag );
+			EXPECT_TRUE( Controller.WarmStartFlag );
+			EXPECT_NEAR( 0.5, Controller.NextActuatedValue, 1.0e-3 );
+			return NumIterations;
+		};
+
+		int const NumColdIterations = Solve( 0.0 );
+		EXPECT_EQ( 0, ControllerProps( 1 ).NumNewtonSteps );
+		int const NumWarmIterations = Solve( 1.0 );
+		EXPECT_EQ( 1, ControllerProps( 1 ).NumNewtonSteps );
+		EXPECT_LT( NumWarmIterations, NumColdIterations );
+
+		// The slope through the 2 best iterates is saved with the converged solution
+		ControllerProps( 1 ).Mode = DataHVACControllers::iModeActive;
+		SaveSimpleController( 1, false, true );
+		EXPECT_NEAR( 1.0, ControllerProps( 1 ).SolutionTrackers( 2 ).Sensitivity, 0.05 );
+	}
+
 }
@@ -65,6 +65,7 @@
 
 // EnergyPlus Headers
 #include <Fixtures/EnergyPlusFixture.hh>
+#include <DataAirLoop.hh>
 #include <DataHeatBalance.hh>
 #include <General.hh>
 #include <HVACManager.hh>
@@ -73,6 +74,9 @@
 #include <DataZoneEquipment.hh>
 #include <DataGlobals.hh>
 #include <DataHVACGlobals.hh>
+#include <DataConvergParams.hh>
+#include <DataZoneEnergyDemands.hh>
+#include <ZoneTempPredictorCorrector.hh>
 
 using namespace EnergyPlus;
 using namespace HVACManager;
@@ -140,4 +144,80 @@ TEST_F( EnergyPlusFixture, CrossMixingReportTest ) {
 
 }
 
+TEST_F( EnergyPlusFixture, HVACManager_NumSysTimeStepsWanted ) {
 
+	DataGlobals::TimeStepZone = 0.25;
+	DataHeatBalance::ZoneAirSolutionAlgo = DataHeatBalance::Use3rdOrder;
+
+	// Zone temperature change control divides the zone time step by the change
+	DataConvergParams::SysTimeStepControl = DataConvergParams::SysTimeStepZoneTempChange;
+	EXPECT_EQ( 1, NumSysTimeStepsWanted( 0.2, 0.0, false ) );
+	EXPECT_EQ( 4, NumSysTimeStepsWanted( 1.0, 0.0, false ) );
+
+	// Truncation error control keeps the zone time step for a steady trend, however large the change
+	DataConvergParams::SysTimeStepControl = DataConvergParams::SysTimeStepTruncationError;
+	DataConvergParams::MaxZoneTempTruncError = 0.05;
+	EXPECT_EQ( 1, NumSysTimeStepsWanted( 1.0, 0.01, false ) );
+	EXPECT_EQ( 3, NumSysTimeStepsWanted( 1.0, 0.4, false ) ); // cube root of 8, plus 1 for truncation
+
+	// Control events shorten the system time step to the control event time step
+	EXPECT_EQ( 1, NumSysTimeStepsWanted( 0.0, 0.0, true ) );
+	DataConvergParams::ControlEventTimeStep = 5.0 / 60.0;
+	EXPECT_EQ( 3, NumSysTimeStepsWanted( 0.0, 0.0, true ) );
+	EXPECT_EQ( 1, NumSysTimeStepsWanted( 0.0, 0.0, false ) );
+
+	// Other zone air solution algorithms keep the zone temperature change control
+	DataHeatBalance::ZoneAirSolutionAlgo = DataHeatBalance::UseAnalyticalSolution;
+	EXPECT_EQ( 4, NumSysTimeStepsWanted( 1.0, 0.0, false ) );
+}
+
+TEST_F( EnergyPlusFixture, HVACManager_DetectZoneControlEvents ) {
+
+	DataGlobals::NumOfZones = 2;
+	DataHeatBalFanSys::TempControlType.dimension( 2, 4 );
+	DataHeatBalFanSys::TempControlType( 2 ) = 0; // uncontrolled
+	DataHeatBalFanSys::ZoneThermostatSetPointLo.dimension( 2, 21.0 );
+	DataHeatBalFanSys::ZoneThermostatSetPointHi.dimension( 2, 24.0 );
+	DataZoneEnergyDemands::DeadBandOrSetback.dimension( 2, false );
+
+	EXPECT_FALSE( ZoneTempPredictorCorrector::DetectZoneControlEvents() ); // first call only saves the states
+	EXPECT_FALSE( ZoneTempPredictorCorrector::DetectZoneControlEvents() );
+
+	DataHeatBalFanSys::ZoneThermostatSetPointLo( 1 ) = 15.0; // night setback
+	EXPECT_TRUE( ZoneTempPredictorCorrector::DetectZoneControlEvents() );
+	EXPECT_FALSE( ZoneTempPredictorCorrector::DetectZoneControlEvents() );
+
+	DataZoneEnergyDemands::DeadBandOrSetback( 1 ) = true;
+	EXPECT_TRUE( ZoneTempPredictorCorrector::DetectZoneControlEvents() );
+
+	DataHeatBalFanSys::ZoneThermostatSetPointHi( 2 ) = 30.0; // changes in uncontrolled zones are not events
+	EXPECT_FALSE( ZoneTempPredictorCorrector::DetectZoneControlEvents() );
+}
+
+TEST_F( EnergyPlusFixture, HVACManager_ResolveLockoutFlagsChangedAirLoops ) {
+
+	DataHVACGlobals::NumPrimaryAirSys = 3;
+	DataAirLoop::AirLoopControlInfo.allocate( 3 );
+	DataAirLoop::SetAllAirLoopSimFlags( false );
+	DataAirLoop::AirLoopControlInfo( 2 ).EconoActive = true;
+	DataAirLoop::AirLoopControlInfo( 2 ).ReqstEconoLockoutWithCompressor = true;
+
+	// By default any lockout resimulates all air loops
+	bool SimAir = false;
+	ResolveLockoutFlags( SimAir );
+	EXPECT_TRUE( SimAir );
+	EXPECT_TRUE( DataAirLoop::AirLoopControlInfo( 2 ).EconoLockout );
+
+	// Only the locked out air loop is resimulated with ChangedAirLoops
+	DataConvergParams::ResimChangedAirLoopsOnly = true;
+	SimAir = false;
+	ResolveLockoutFlags( SimAir );
+	EXPECT_FALSE( SimAir );
+	EXPECT_FALSE( DataAirLoop::AirLoopControlInfo( 1 ).SimLoopNeeded );
+	EXPECT_TRUE( DataAirLoop::AirLoopControlInfo( 2 ).SimLoopNeeded );
+	EXPECT_FALSE( DataAirLoop::AirLoopControlInfo( 3 ).SimLoopNeeded );
+	EXPECT_TRUE( DataAirLoop::AnyAirLoopsNeedSim() );
+
+	DataAirLoop::SetAllAirLoopSimFlags( false );
+	EXPECT_FALSE( DataAirLoop::AnyAirLoopsNeedSim() );
+}
@@ -64,7 +64,9 @@
 // EnergyPlus Headers
 #include "Fixtures/EnergyPlusFixture.hh"
 #include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
 #include <EnergyPlus/DataHeatBalSurface.hh>
+#include <EnergyPlus/DataSurfaces.hh>
 #include <EnergyPlus/HeatBalFiniteDiffManager.hh>
 
 using namespace EnergyPlus::HeatBalFiniteDiffManager;
@@ -193,4 +195,65 @@ namespace EnergyPlus {
 
 	}
 
+	TEST_F( EnergyPlusFixture, HeatBalFiniteDiffManager_LinearLayerMatchesInteriorNodeSweeps )
+	{
+		// one surface with a single six node concrete layer, interior nodes 2..5
+		int const SurfNum( 1 );
+		int const TotNodes( 5 );
+		int const Delt( 180 );
+
+		DataSurfaces::Surface.allocate( 1 );
+		DataSurfaces::Surface( SurfNum ).Construction = 1;
+		DataHeatBalance::Construct.allocate( 1 );
+		DataHeatBalance::Construct( 1 ).TotLayers = 1;
+		DataHeatBalance::Construct( 1 ).LayerPoint( 1 ) = 1;
+		DataHeatBalance::Material.allocate( 1 );
+		DataHeatBalance::Material( 1 ).Conductivity = 1.95;
+		DataHeatBalance::Material( 1 ).Density = 2240.0;
+		DataHeatBalance::Material( 1 ).SpecHeat = 900.0;
+		MaterialFD.allocate( 1 );
+		MaterialFD( 1 ).TempEnth.dimension( 2, 3, -100.0 );
+		MaterialFD( 1 ).TempCond.dimension( 2, 3, -100.0 );
+		ConstructFD.allocate( 1 );
+		ConstructFD( 1 ).DelX.allocate( 1 );
+		ConstructFD( 1 ).DelX( 1 ) = 0.04;
+		SurfaceFD.allocate( 1 );
+		SurfaceFD( SurfNum ).CpDelXRhoS1.dimension( TotNodes + 1, 0.0 );
+		SurfaceFD( SurfNum ).CpDelXRhoS2.dimension( TotNodes + 1, 0.0 );
+		SurfaceFD( SurfNum ).LayerSolveCoef.dimension( TotNodes + 1, 0.0 );
+		SurfaceFD( SurfNum ).LayerSolveRhs.dimension( TotNodes + 1, 0.0 );
+
+		Array1D< Real64 > TD( { 12.0, 15.0, 19.0, 22.0, 21.0, 24.0 } );
+		Array1D< Real64 > unused( TotNodes + 1, 0.0 );
+		Array1D< Real64 > EnthOld( TotNodes + 1, 0.0 );
+		Array1D< Real64 > EnthNew( TotNodes + 1, 0.0 );
+
+		for ( int scheme : { CrankNicholsonSecondOrder, FullyImplicitFirstOrder } ) {
+			CondFDSchemeType = scheme;
+
+			// boundary nodes held fixed at their new values
+			Array1D< Real64 > TDTSweep( TD );
+			TDTSweep( 1 ) = 5.0;
+			TDTSweep( TotNodes + 1 ) = 30.0;
+			Array1D< Real64 > TDTDirect( TDTSweep );
+
+			for ( int sweep = 1; sweep <= 500; ++sweep ) {
+				for ( int i = 2; i <= TotNodes; ++i ) {
+					InteriorNodeEqns( Delt, i, 1, SurfNum, unused, unused, unused, unused, unused, TD, TDTSweep, EnthOld, EnthNew );
+				}
+			}
+			Array1D< Real64 > const CpDelXRhoS( SurfaceFD( SurfNum ).CpDelXRhoS1 );
+			SurfaceFD( SurfNum ).CpDelXRhoS1 = 0.0;
+
+			LinearLayerNodeEqns( Delt, 2, TotNodes, 1, SurfNum, TD, TDTDirect );
+
+			EXPECT_DOUBLE_EQ( 5.0, TDTDirect( 1 ) );
+			EXPECT_DOUBLE_EQ( 30.0, TDTDirect( TotNodes + 1 ) );
+			for ( int i = 2; i <= TotNodes; ++i ) {
+				EXPECT_NEAR( TDTSweep( i ), TDTDirect( i ), 1.0e-9 );
+				EXPECT_DOUBLE_EQ( CpDelXRhoS( i ), SurfaceFD( SurfNum ).CpDelXRhoS1( i ) );
+			}
+		}
+	}
+
 }
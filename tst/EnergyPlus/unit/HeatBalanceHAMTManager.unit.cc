@@ -0,0 +1,172 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// EnergyPlus::HeatBalanceHAMTManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Fixtures/HeatBalanceHAMTManagerFixture.hh"
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/HeatBalanceHAMTManager.hh>
+
+using namespace EnergyPlus::HeatBalanceHAMTManager;
+
+namespace EnergyPlus {
+
+	TEST_F( HeatBalanceHAMTManagerFixture, HeatBalanceHAMTManager_UniformTableMatchesInterp )
+	{
+		ASSERT_FALSE( process_idf( delimited_string( HAMTWallMaterials ) ) );
+		SetupHAMTTestWall();
+		GetHeatBalHAMTInput();
+
+		// the isotherm has repeated moisture contents and the end points added by GetHeatBalHAMTInput
+		auto & concrete( DataHeatBalance::Material( 1 ) );
+		EXPECT_EQ( 12, concrete.niso );
+		uniformtable isotable;
+		SetupUniformTable( concrete.niso, concrete.isorh, isotable );
+		ASSERT_FALSE( isotable.firststep.empty() );
+		uniformtable watertable;
+		SetupUniformTable( concrete.ntc, concrete.tcwater, watertable );
+
+		Array1D< Real64 > rhs( { -0.1, 0.0, 0.202, 0.449, 0.4515, 0.454, 0.964, 1.0, 1.01, 1.2 } );
+		for ( int i = 0; i <= 1300; ++i ) {
+			rhs.push_back( -0.1 + 0.001 * i );
+		}
+		for ( Real64 const rh : rhs ) {
+			Real64 value;
+			Real64 grad;
+			Real64 tablevalue;
+			Real64 tablegrad;
+			interp( concrete.niso, concrete.isorh, concrete.isodata, rh, value, grad );
+			interpuniform( isotable, concrete.niso, concrete.isorh, concrete.isodata, rh, tablevalue, tablegrad );
+			EXPECT_DOUBLE_EQ( value, tablevalue );
+			EXPECT_DOUBLE_EQ( grad, tablegrad );
+
+			Real64 const water( 200.0 * rh );
+			interp( concrete.ntc, concrete.tcwater, concrete.tcdata, water, value );
+			interpuniform( watertable, concrete.ntc, concrete.tcwater, concrete.tcdata, water, tablevalue );
+			EXPECT_DOUBLE_EQ( value, tablevalue );
+		}
+
+		// unsorted data are searched
+		Array1D< Real64 > xx( { 0.0, 2.0, 1.0 } );
+		Array1D< Real64 > yy( { 0.0, 4.0, 1.0 } );
+		uniformtable unsorted;
+		SetupUniformTable( 3, xx, unsorted );
+		EXPECT_TRUE( unsorted.firststep.empty() );
+		Real64 value;
+		Real64 tablevalue;
+		interp( 3, xx, yy, 1.5, value );
+		interpuniform( unsorted, 3, xx, yy, 1.5, tablevalue );
+		EXPECT_DOUBLE_EQ( value, tablevalue );
+	}
+
+	TEST_F( HeatBalanceHAMTManagerFixture, HeatBalanceHAMTManager_LinearizedSolutionMatchesIterative )
+	{
+		std::vector< std::string > idf_objects( HAMTWallMaterials );
+		idf_objects.push_back( "HeatBalanceSettings:CombinedHeatAndMoistureFiniteElement, Linearized;" );
+		ASSERT_FALSE( process_idf( delimited_string( idf_objects ) ) );
+		SetupHAMTTestWall();
+		GetHeatBalHAMTInput();
+		EXPECT_EQ( LinearizedSolution, SolutionAlgorithm );
+		InitHeatBalHAMT();
+
+		// run the same four days with both algorithms from the same initial cells
+		int const NumSteps( 4 * 96 );
+		Array1D< subcell > const initialcells( cells );
+		Array1D< Real64 > insidetemp( NumSteps );
+		Array1D< Real64 > outsidetemp( NumSteps );
+		Array1D< Real64 > insiderh( NumSteps );
+		Array1D< Real64 > water( NumSteps );
+
+		SolutionAlgorithm = IterativeSolution;
+		for ( int step = 1; step <= NumSteps; ++step ) {
+			SetHAMTTestWallConditions( step );
+			CalcHeatBalHAMT( 1, insidetemp( step ), outsidetemp( step ) );
+			UpdateHeatBalHAMT( 1 );
+			insiderh( step ) = surfrh( 1 );
+			water( step ) = watertot( 1 );
+		}
+
+		cells = initialcells;
+		SolutionAlgorithm = LinearizedSolution;
+		Real64 MaxTempDiff( 0.0 );
+		Real64 MaxRHDiff( 0.0 );
+		Real64 MaxWaterDiff( 0.0 );
+		for ( int step = 1; step <= NumSteps; ++step ) {
+			Real64 TempSurfIn;
+			Real64 TempSurfOut;
+			SetHAMTTestWallConditions( step );
+			CalcHeatBalHAMT( 1, TempSurfIn, TempSurfOut );
+			UpdateHeatBalHAMT( 1 );
+			MaxTempDiff = max( MaxTempDiff, std::abs( TempSurfIn - insidetemp( step ) ), std::abs( TempSurfOut - outsidetemp( step ) ) );
+			MaxRHDiff = max( MaxRHDiff, std::abs( surfrh( 1 ) - insiderh( step ) ) );
+			MaxWaterDiff = max( MaxWaterDiff, std::abs( watertot( 1 ) - water( step ) ) / water( step ) );
+		}
+
+		// the iterative solution stops once a sweep changes the cell temperatures by less than the
+		// convergence limit, which on this wetting and drying wall leaves it up to a few tenths of a
+		// degree from the solution of the cell equations that the linearized solution reaches
+		EXPECT_LT( MaxTempDiff, 0.3 );
+		EXPECT_LT( MaxRHDiff, 3.0 ); // percent
+		EXPECT_LT( MaxWaterDiff, 0.03 );
+	}
+
+}
@@ -65,6 +65,8 @@
 #include <EnergyPlus/DataGlobals.hh>
 #include <EnergyPlus/DataHeatBalance.hh>
 #include <EnergyPlus/DataIPShortCuts.hh>
+#include <EnergyPlus/DataHeatBalSurface.hh>
+#include <EnergyPlus/DataSurfaces.hh>
 #include <EnergyPlus/HeatBalanceManager.hh>
 #include <ZoneEquipmentManager.hh>
 #include <HeatBalanceAirManager.hh>
@@ -585,4 +587,60 @@ namespace EnergyPlus {
 		EXPECT_EQ( 2, OutputProcessor::RVariableTypes( 2 ).ReportID );
 
 	}
+
+	TEST_F( EnergyPlusFixture, HeatBalanceManager_AccelerateWarmup )
+	{
+		// One CTF surface whose histories approach their periodic state geometrically; the
+		// second surface is not a heat transfer surface and must not be touched
+		DataSurfaces::TotSurfaces = 2;
+		DataSurfaces::Surface.allocate( 2 );
+		DataSurfaces::Surface( 1 ).HeatTransSurf = true;
+		DataSurfaces::Surface( 1 ).HeatTransferAlgorithm = DataSurfaces::HeatTransferModel_CTF;
+		DataSurfaces::Surface( 2 ).HeatTransSurf = false;
+		DataHeatBalSurface::TH.dimension( 2, MaxCTFTerms, 2, 0.0 );
+		DataHeatBalSurface::QH.dimension( 2, MaxCTFTerms, 2, 0.0 );
+		DataHeatBalSurface::THM.dimension( 2, MaxCTFTerms, 2, 0.0 );
+		DataHeatBalSurface::QHM.dimension( 2, MaxCTFTerms, 2, 0.0 );
+		DataHeatBalSurface::TempSurfIn.dimension( 2, 0.0 );
+		DataHeatBalSurface::TempSurfInTmp.dimension( 2, 0.0 );
+		DataHeatBalSurface::TempSurfOut.dimension( 2, 0.0 );
+
+		auto endOfDay = []( Real64 const ratio, int const day ) {
+			Real64 const decay( std::pow( ratio, day ) );
+			for ( int term = 1; term <= MaxCTFTerms; ++term ) {
+				for ( int side = 1; side <= 2; ++side ) {
+					DataHeatBalSurface::TH( side, term, 1 ) = 20.0 + 5.0 * decay * side;
+					DataHeatBalSurface::THM( side, term, 1 ) = 20.0 + 5.0 * decay * side;
+					DataHeatBalSurface::QH( side, term, 1 ) = 10.0 - 3.0 * decay;
+					DataHeatBalSurface::QHM( side, term, 1 ) = 10.0 - 3.0 * decay;
+				}
+			}
+			DataHeatBalSurface::TempSurfIn( 1 ) = 21.0 + 4.0 * decay;
+			DataHeatBalSurface::TempSurfInTmp( 1 ) = 21.0 + 4.0 * decay;
+			DataHeatBalSurface::TempSurfOut( 1 ) = 15.0 - 2.0 * decay;
+			DataHeatBalSurface::TH( 1, 1, 2 ) = 99.0;
+		};
+
+		// Steady decay: the third day end is extrapolated to the periodic state
+		for ( DayOfSim = 1; DayOfSim <= 3; ++DayOfSim ) {
+			endOfDay( 0.6, DayOfSim );
+			AccelerateWarmup();
+		}
+		EXPECT_NEAR( 20.0, DataHeatBalSurface::TH( 1, 1, 1 ), 1.0e-10 );
+		EXPECT_NEAR( 20.0, DataHeatBalSurface::THM( 2, MaxCTFTerms, 1 ), 1.0e-10 );
+		EXPECT_NEAR( 10.0, DataHeatBalSurface::QH( 2, 3, 1 ), 1.0e-10 );
+		EXPECT_NEAR( 21.0, DataHeatBalSurface::TempSurfIn( 1 ), 1.0e-10 );
+		EXPECT_NEAR( 15.0, DataHeatBalSurface::TempSurfOut( 1 ), 1.0e-10 );
+		EXPECT_EQ( 99.0, DataHeatBalSurface::TH( 1, 1, 2 ) );
+		EXPECT_EQ( 1, NumWarmupDaysTracked );
+
+		// Oscillating approach: the histories are left as simulated
+		for ( DayOfSim = 1; DayOfSim <= 3; ++DayOfSim ) {
+			endOfDay( -0.5, DayOfSim );
+			AccelerateWarmup();
+		}
+		EXPECT_DOUBLE_EQ( 20.0 + 5.0 * std::pow( -0.5, 3 ), DataHeatBalSurface::TH( 1, 1, 1 ) );
+		EXPECT_EQ( 3, NumWarmupDaysTracked );
+	}
+
 }
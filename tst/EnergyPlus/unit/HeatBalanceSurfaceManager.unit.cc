@@ -61,6 +61,9 @@
 // Google Test Headers
 #include <gtest/gtest.h>
 
+// C++ Headers
+#include <cstdio>
+
 // EnergyPlus Headers
 #include "Fixtures/EnergyPlusFixture.hh"
 #include <EnergyPlus/DataGlobals.hh>
@@ -69,6 +72,7 @@
 #include <EnergyPlus/DataHeatBalance.hh>
 #include <EnergyPlus/DataHeatBalFanSys.hh>
 #include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
 #include <EnergyPlus/HeatBalanceSurfaceManager.hh>
 #include <EnergyPlus/ScheduleManager.hh>
 
@@ -325,5 +329,77 @@ namespace EnergyPlus {
 		EXPECT_EQ( 12.5, DataHeatBalSurface::TuserHist( 1, 3 ) ); // Now check to see that it is shifting the temperature history properly
 		
 	}
-	
+
+	TEST_F( EnergyPlusFixture, HeatBalanceSurfaceManager_WarmStartState )
+	{
+		DataSurfaces::TotSurfaces = 1;
+		DataSurfaces::Surface.allocate( 1 );
+		DataSurfaces::Surface( 1 ).HeatTransSurf = true;
+		DataSurfaces::Surface( 1 ).HeatTransferAlgorithm = DataSurfaces::HeatTransferModel_CTF;
+		DataHeatBalSurface::TH.dimension( 2, DataHeatBalance::MaxCTFTerms, 1, 0.0 );
+		DataHeatBalSurface::QH.dimension( 2, DataHeatBalance::MaxCTFTerms, 1, 0.0 );
+		DataHeatBalSurface::THM.dimension( 2, DataHeatBalance::MaxCTFTerms, 1, 0.0 );
+		DataHeatBalSurface::QHM.dimension( 2, DataHeatBalance::MaxCTFTerms, 1, 0.0 );
+		DataHeatBalSurface::TempSurfIn.dimension( 1, 0.0 );
+		DataHeatBalSurface::TempSurfInTmp.dimension( 1, 0.0 );
+		DataHeatBalSurface::TempSurfOut.dimension( 1, 0.0 );
+		DataHeatBalFanSys::MAT.dimension( 1, 0.0 );
+		DataHeatBalFanSys::ZoneAirHumRat.dimension( 1, 0.0 );
+		DataHeatBalFanSys::ZTM1.dimension( 1, 0.0 );
+		DataHeatBalFanSys::WZoneTimeMinus1.dimension( 1, 0.0 );
+		DataSystemVariables::WarmStartFileName = "HeatBalanceSurfaceManager_WarmStartState.txt";
+		std::remove( DataSystemVariables::WarmStartFileName.c_str() );
+
+		// Converged histories for two environments
+		DataEnvironment::EnvironmentName = "WINTER DESIGN DAY";
+		DataHeatBalSurface::TH( 2, 3, 1 ) = 1.0 / 3.0;
+		DataHeatBalSurface::TempSurfOut( 1 ) = -12.5;
+		DataHeatBalFanSys::MAT( 1 ) = 18.5;
+		DataHeatBalFanSys::ZoneAirHumRat( 1 ) = 0.002;
+		DataHeatBalFanSys::ZTM1( 1 ) = 18.25;
+		DataHeatBalFanSys::WZoneTimeMinus1( 1 ) = 0.0021;
+		SaveWarmStartState();
+		DataEnvironment::EnvironmentName = "SUMMER DESIGN DAY";
+		DataHeatBalSurface::TH( 2, 3, 1 ) = 27.25;
+		DataHeatBalSurface::TempSurfOut( 1 ) = 31.0;
+		DataHeatBalFanSys::MAT( 1 ) = 25.5;
+		SaveWarmStartState();
+
+		// A later run reads the file again and restores the state of its environment
+		clear_state();
+		DataHeatBalSurface::TH = 23.0;
+		DataHeatBalSurface::TempSurfOut = 0.0;
+		DataHeatBalFanSys::MAT = 23.0;
+		DataHeatBalFanSys::ZoneAirHumRat = 0.01;
+		DataHeatBalFanSys::ZTM1 = 23.0;
+		DataHeatBalFanSys::WZoneTimeMinus1 = 0.01;
+		DataEnvironment::EnvironmentName = "WINTER DESIGN DAY";
+		RestoreWarmStartState();
+		EXPECT_DOUBLE_EQ( 1.0 / 3.0, DataHeatBalSurface::TH( 2, 3, 1 ) );
+		EXPECT_DOUBLE_EQ( 0.0, DataHeatBalSurface::TH( 1, 1, 1 ) ); // every history is replaced by the saved one
+		EXPECT_DOUBLE_EQ( -12.5, DataHeatBalSurface::TempSurfOut( 1 ) );
+		EXPECT_DOUBLE_EQ( 18.5, DataHeatBalFanSys::MAT( 1 ) );
+		EXPECT_DOUBLE_EQ( 0.002, DataHeatBalFanSys::ZoneAirHumRat( 1 ) );
+
+		// the zone air histories follow once the zone set points have been initialized
+		EXPECT_DOUBLE_EQ( 23.0, DataHeatBalFanSys::ZTM1( 1 ) );
+		RestoreWarmStartZoneAirHistories();
+		EXPECT_DOUBLE_EQ( 18.25, DataHeatBalFanSys::ZTM1( 1 ) );
+		EXPECT_DOUBLE_EQ( 0.0021, DataHeatBalFanSys::WZoneTimeMinus1( 1 ) );
+		DataHeatBalFanSys::ZTM1 = 23.0;
+		RestoreWarmStartZoneAirHistories();
+		EXPECT_DOUBLE_EQ( 23.0, DataHeatBalFanSys::ZTM1( 1 ) );
+
+		// Nothing saved for this environment
+		DataHeatBalSurface::TH = 23.0;
+		DataHeatBalFanSys::MAT = 23.0;
+		DataEnvironment::EnvironmentName = "RUN PERIOD 1";
+		RestoreWarmStartState();
+		EXPECT_DOUBLE_EQ( 23.0, DataHeatBalSurface::TH( 2, 3, 1 ) );
+		EXPECT_DOUBLE_EQ( 23.0, DataHeatBalFanSys::MAT( 1 ) );
+
+		std::remove( DataSystemVariables::WarmStartFileName.c_str() );
+		DataSystemVariables::WarmStartFileName.clear();
+	}
+
 }
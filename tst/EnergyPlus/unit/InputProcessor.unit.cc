@@ -68,6 +68,8 @@
 
 #include "Fixtures/InputProcessorFixture.hh"
 
+#include <cstdio>
+#include <fstream>
 #include <tuple>
 #include <map>
 
@@ -238,6 +240,42 @@ namespace EnergyPlus {
 
 		}
 
+		TEST_F( InputProcessorFixture, preloadDataDictionary )
+		{
+			using namespace InputProcessor;
+			std::string const idd_objects = delimited_string({
+				"Output:SQLite,",
+				"       \\unique-object",
+				"  A1 ; \\field Option Type",
+				"       \\type choice",
+				"       \\key Simple",
+				"       \\key SimpleAndTabular"
+			});
+			std::string const idd_file_name( "preloadDataDictionary.idd" );
+			{
+				std::ofstream idd_file( idd_file_name );
+				idd_file << idd_objects;
+			}
+
+			bool errors_found = false;
+			PreloadDataDictionary( "preloadDataDictionary_missing.idd", errors_found );
+			EXPECT_TRUE( errors_found );
+			EXPECT_TRUE( PreloadedIddFileName.empty() );
+
+			errors_found = false;
+			PreloadDataDictionary( idd_file_name, errors_found );
+			std::remove( idd_file_name.c_str() );
+
+			EXPECT_FALSE( errors_found );
+			EXPECT_EQ( idd_file_name, PreloadedIddFileName );
+			EXPECT_EQ( 1, NumObjectDefs );
+			EXPECT_EQ( "OUTPUT:SQLITE", ObjectDef( 1 ).Name );
+			EXPECT_FALSE( ProcessingIDD );
+
+			clear_state();
+			EXPECT_TRUE( PreloadedIddFileName.empty() );
+		}
+
 		TEST_F( InputProcessorFixture, processIDF )
 		{
 			using namespace InputProcessor;
@@ -3441,6 +3441,71 @@ TEST_F( EnergyPlusFixture, OutputReportTabularMonthly_ResetMonthlyGathering )
 
 }
 
+TEST_F( EnergyPlusFixture, OutputReportTabularMonthly_GatherPlan )
+{
+	std::string const idf_objects = delimited_string( {
+		"Version,8.3;",
+		"Output:Table:Monthly,",
+		"Exterior Lights Report, !- Name",
+		"2, !-  Digits After Decimal",
+		"Exterior Lights Electric Power, !- Variable or Meter 1 Name",
+		"Maximum, !- Aggregation Type for Variable or Meter 1",
+		"Exterior Lights Electric Energy, !- Variable or Meter 2 Name",
+		"ValueWhenMaximumOrMinimum, !- Aggregation Type for Variable or Meter 2",
+		"Exterior Lights Electric Power, !- Variable or Meter 3 Name",
+		"HoursNonzero, !- Aggregation Type for Variable or Meter 3",
+		"Exterior Lights Electric Energy, !- Variable or Meter 4 Name",
+		"SumOrAverageDuringHoursShown; !- Aggregation Type for Variable or Meter 4",
+	} );
+
+	ASSERT_FALSE( process_idf( idf_objects ) );
+
+	Real64 extLitUse;
+	Real64 extLitPow;
+
+	SetupOutputVariable( "Exterior Lights Electric Energy [J]", extLitUse, "Zone", "Sum", "Lite1", _, "Electricity", "Exterior Lights", "General" );
+	SetupOutputVariable( "Exterior Lights Electric Power [W]", extLitPow, "Zone", "Average", "Lite1" );
+
+	DataGlobals::DoWeathSim = true;
+	DataGlobals::TimeStepZone = 0.25;
+	DataGlobals::TimeStepZoneSec = 900.0;
+
+	GetInputTabularMonthly();
+	InitializeTabularMonthly();
+
+	// all four columns are gathered at the zone time step in table order through the variable pointers
+	ASSERT_EQ( 4, MonthlyGatherZone.isize() );
+	EXPECT_EQ( 0, MonthlyGatherHVAC.isize() );
+	for ( int i = 1; i <= 4; ++i ) {
+		EXPECT_EQ( i, MonthlyGatherZone( i ).column );
+		EXPECT_EQ( 4, MonthlyGatherZone( i ).lastColumn );
+	}
+	EXPECT_EQ( &extLitPow, MonthlyGatherZone( 1 ).valuePtr );
+	EXPECT_EQ( &extLitUse, MonthlyGatherZone( 2 ).valuePtr );
+	EXPECT_FALSE( MonthlyGatherZone( 1 ).isSummed );
+	EXPECT_TRUE( MonthlyGatherZone( 2 ).isSummed );
+
+	DataEnvironment::Month = 12;
+
+	extLitPow = 100.0;
+	extLitUse = 90000.0;
+	GatherMonthlyResultsForTimestep( 1 );
+
+	extLitPow = 200.0;
+	extLitUse = 180000.0;
+	GatherMonthlyResultsForTimestep( 1 );
+
+	extLitPow = 0.0;
+	extLitUse = 0.0;
+	GatherMonthlyResultsForTimestep( 1 );
+
+	EXPECT_DOUBLE_EQ( 200.0, MonthlyColumns( 1 ).reslt( 12 ) );
+	EXPECT_DOUBLE_EQ( 200.0, MonthlyColumns( 2 ).reslt( 12 ) ); // energy divided by the time step length
+	EXPECT_DOUBLE_EQ( 0.5, MonthlyColumns( 3 ).reslt( 12 ) );
+	EXPECT_DOUBLE_EQ( 270000.0, MonthlyColumns( 4 ).reslt( 12 ) );
+	EXPECT_DOUBLE_EQ( 0.5, MonthlyColumns( 4 ).duration( 12 ) );
+}
+
 TEST_F( EnergyPlusFixture, OutputReportTabular_ConfirmResetBEPSGathering )
 {
 
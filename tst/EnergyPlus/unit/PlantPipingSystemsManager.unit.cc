@@ -1636,3 +1636,111 @@ TEST_F( EnergyPlusFixture, SiteGroundDomainBasement_CheckInputs_BadTimestepSelec
 
 	EXPECT_TRUE( errorsFound );
 }
+
+namespace {
+
+	// Builds a small uniform mesh of unit cells with a few non-field cells inside it
+	void
+	SetupFieldCellTestDomain()
+	{
+		using namespace DataPlantPipingSystems;
+
+		PipingSystemDomains.allocate( 1 );
+		auto & cells( PipingSystemDomains( 1 ).Cells );
+		cells.allocate( { 0, 6 }, { 0, 5 }, { 0, 4 } );
+		for ( int X = cells.l1(); X <= cells.u1(); ++X ) {
+			for ( int Y = cells.l2(); Y <= cells.u2(); ++Y ) {
+				for ( int Z = cells.l3(); Z <= cells.u3(); ++Z ) {
+					auto & cell( cells( X, Y, Z ) );
+					cell.X_index = X;
+					cell.Y_index = Y;
+					cell.Z_index = Z;
+					cell.X_min = X;
+					cell.X_max = X + 1.0;
+					cell.Y_min = Y;
+					cell.Y_max = Y + 1.0;
+					cell.Z_min = Z;
+					cell.Z_max = Z + 1.0;
+					cell.Centroid = Point3DReal( X + 0.5, Y + 0.5, Z + 0.5 );
+					cell.CellType = CellType_GeneralField;
+					cell.MyBase.Properties.Conductivity = 1.0 + 0.1 * X + 0.05 * Z;
+					cell.MyBase.Beta = 2.0 + 0.01 * Y;
+					cell.MyBase.Temperature_PrevTimeStep = 10.0 + 0.5 * X - 0.25 * Y;
+					cell.MyBase.Temperature = 12.0 + 0.3 * Y - 0.2 * Z;
+				}
+			}
+		}
+		// Pipe cells are skipped by PerformTemperatureFieldUpdate, so they act as fixed temperatures here
+		cells( 2, 2, 2 ).CellType = CellType_Pipe;
+		cells( 2, 2, 2 ).MyBase.Temperature = 30.0;
+		cells( 3, 2, 2 ).CellType = CellType_Slab;
+		cells( 4, 3, 1 ).CellType = CellType_HorizInsulation;
+		cells( 5, 1, 3 ).CellType = CellType_Pipe;
+		cells( 5, 1, 3 ).MyBase.Temperature = -5.0;
+		SetupCellNeighbors( 1 );
+	}
+
+}
+
+TEST_F( EnergyPlusFixture, PlantPipingSystemsManager_FieldCellSweepsMatchCellEvaluation ) {
+
+	SetupFieldCellTestDomain();
+	auto & cells( PipingSystemDomains( 1 ).Cells );
+	auto & solver( PipingSystemDomains( 1 ).FieldSolver );
+
+	SetupFieldCellSolver( 1 );
+	UpdateFieldCellSolverCoefficients( 1 );
+	EXPECT_TRUE( solver.IsSetUp );
+	EXPECT_EQ( int( cells.size() ), solver.NumCells );
+	EXPECT_EQ( solver.NumCells - 2, solver.NumFieldCells );
+
+	for ( int CellNum = 0; CellNum < solver.NumCells; ++CellNum ) {
+		solver.Temperature[ CellNum ] = cells[ CellNum ].MyBase.Temperature;
+	}
+
+	// Red cells only see black neighbors, so they match a cell by cell evaluation of the initial field
+	SweepFieldCells( solver, 1, solver.NumRedCells );
+	for ( int FieldCellNum = 1; FieldCellNum <= solver.NumRedCells; ++FieldCellNum ) {
+		int const CellNum( solver.CellIndex( FieldCellNum ) );
+		EXPECT_DOUBLE_EQ( EvaluateFieldCellTemperature( 1, cells[ CellNum ] ), solver.Temperature[ CellNum ] );
+		cells[ CellNum ].MyBase.Temperature = solver.Temperature[ CellNum ];
+	}
+
+	// Black cells then match a cell by cell evaluation using the updated red cells
+	SweepFieldCells( solver, solver.NumRedCells + 1, solver.NumFieldCells );
+	for ( int FieldCellNum = solver.NumRedCells + 1; FieldCellNum <= solver.NumFieldCells; ++FieldCellNum ) {
+		int const CellNum( solver.CellIndex( FieldCellNum ) );
+		auto const & cell( cells[ CellNum ] );
+		EXPECT_EQ( 1, ( cell.X_index + cell.Y_index + cell.Z_index ) % 2 );
+		EXPECT_DOUBLE_EQ( EvaluateFieldCellTemperature( 1, cell ), solver.Temperature[ CellNum ] );
+	}
+
+	// Non-field cells are left alone
+	EXPECT_DOUBLE_EQ( 30.0, solver.Temperature[ cells.index( 2, 2, 2 ) ] );
+	EXPECT_DOUBLE_EQ( -5.0, solver.Temperature[ cells.index( 5, 1, 3 ) ] );
+}
+
+TEST_F( EnergyPlusFixture, PlantPipingSystemsManager_FieldCellSweepsConvergeToSameField ) {
+
+	SetupFieldCellTestDomain();
+	auto & cells( PipingSystemDomains( 1 ).Cells );
+	auto & solver( PipingSystemDomains( 1 ).FieldSolver );
+
+	// Reference: lexicographic in-place updates of the field cells
+	for ( int Iter = 1; Iter <= 500; ++Iter ) {
+		for ( auto & cell : cells ) {
+			if ( IsFieldCellType( cell.CellType ) ) cell.MyBase.Temperature = EvaluateFieldCellTemperature( 1, cell );
+		}
+	}
+	auto const reference( cells );
+
+	SetupFieldCellTestDomain();
+	for ( int Iter = 1; Iter <= 500; ++Iter ) {
+		PerformTemperatureFieldUpdate( 1 );
+	}
+	EXPECT_TRUE( solver.IsSetUp );
+
+	for ( int CellNum = 0; CellNum < solver.NumCells; ++CellNum ) {
+		EXPECT_NEAR( reference[ CellNum ].MyBase.Temperature, cells[ CellNum ].MyBase.Temperature, 1.0e-9 );
+	}
+}
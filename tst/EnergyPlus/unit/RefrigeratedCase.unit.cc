@@ -0,0 +1,128 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// EnergyPlus::RefrigeratedCase Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <Fixtures/EnergyPlusFixture.hh>
+#include <DataEnvironment.hh>
+#include <DataLoopNode.hh>
+#include <Psychrometrics.hh>
+#include <RefrigeratedCase.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::RefrigeratedCase;
+
+TEST_F( EnergyPlusFixture, RefrigeratedCase_CalcRefrigZoneAirStates )
+{
+	// The zone air states shared by the cases and walk-ins must match the psychrometric functions
+	// the cases and walk-ins used to evaluate for themselves
+	DataEnvironment::OutBaroPress = 101325.0;
+	DataLoopNode::Node.allocate( 3 );
+	DataLoopNode::Node( 1 ).Temp = 23.9;
+	DataLoopNode::Node( 1 ).HumRat = 0.0078;
+	DataLoopNode::Node( 2 ).Temp = 18.3;
+	DataLoopNode::Node( 2 ).HumRat = 0.0093;
+	DataLoopNode::Node( 3 ).Temp = 26.1;
+	DataLoopNode::Node( 3 ).HumRat = 0.0112;
+
+	// zone 1 holds cases, zone 2 walk-in doors, zone 3 both
+	RefrigZoneAir.allocate( 3 );
+	RefrigZoneAir( 1 ).ZoneNodeNum = 1;
+	RefrigZoneAir( 1 ).HasCases = true;
+	RefrigZoneAir( 2 ).ZoneNodeNum = 2;
+	RefrigZoneAir( 2 ).HasWalkInDoors = true;
+	RefrigZoneAir( 3 ).ZoneNodeNum = 3;
+	RefrigZoneAir( 3 ).HasCases = true;
+	RefrigZoneAir( 3 ).HasWalkInDoors = true;
+	RefrigZoneAirList.allocate( 3 );
+	RefrigZoneAirList = { 1, 2, 3 };
+	NumRefrigZoneAirs = 3;
+
+	CalcRefrigZoneAirStates();
+
+	for ( int ZoneNum = 1; ZoneNum <= 3; ++ZoneNum ) {
+		auto const & ZoneAir( RefrigZoneAir( ZoneNum ) );
+		Real64 const ZoneDryBulb( DataLoopNode::Node( ZoneNum ).Temp );
+		Real64 const ZoneHumRat( DataLoopNode::Node( ZoneNum ).HumRat );
+		Real64 const RHFrac( Psychrometrics::PsyRhFnTdbWPb( ZoneDryBulb, ZoneHumRat, DataEnvironment::OutBaroPress ) );
+		EXPECT_DOUBLE_EQ( RHFrac, ZoneAir.RHFrac );
+		if ( ZoneAir.HasCases ) {
+			EXPECT_DOUBLE_EQ( Psychrometrics::PsyTdpFnWPb( ZoneHumRat, DataEnvironment::OutBaroPress ), ZoneAir.DewPoint );
+		} else {
+			EXPECT_DOUBLE_EQ( 0.0, ZoneAir.DewPoint );
+		}
+		if ( ZoneAir.HasWalkInDoors ) {
+			Real64 const Enthalpy( Psychrometrics::PsyHFnTdbRhPb( ZoneDryBulb, RHFrac, DataEnvironment::OutBaroPress ) );
+			Real64 const HumRat( Psychrometrics::PsyWFnTdbH( ZoneDryBulb, Enthalpy ) );
+			EXPECT_DOUBLE_EQ( Enthalpy, ZoneAir.Enthalpy );
+			EXPECT_DOUBLE_EQ( HumRat, ZoneAir.HumRat );
+			EXPECT_DOUBLE_EQ( Psychrometrics::PsyRhoAirFnPbTdbW( DataEnvironment::OutBaroPress, ZoneDryBulb, HumRat ), ZoneAir.Density );
+		} else {
+			EXPECT_DOUBLE_EQ( 0.0, ZoneAir.Density );
+		}
+	}
+
+	// the zones are only listed once; a later call follows the zone node states
+	DataLoopNode::Node( 2 ).Temp = 21.1;
+	CalcRefrigZoneAirStates();
+	EXPECT_DOUBLE_EQ( Psychrometrics::PsyRhFnTdbWPb( 21.1, 0.0093, DataEnvironment::OutBaroPress ), RefrigZoneAir( 2 ).RHFrac );
+}
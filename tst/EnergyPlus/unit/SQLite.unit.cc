@@ -347,6 +347,69 @@ namespace EnergyPlus {
 		EXPECT_EQ(2ul, reportExtendedData.size());
 	}
 
+	TEST_F( SQLiteFixture, SQLiteProcedures_restoreReportData ) {
+		// Database of an earlier run, which reported one day of the first environment and two of the second
+		std::string const fileName( "SQLiteProcedures_restoreReportData.sql" );
+		{
+			auto earlierStream = std::make_shared<std::ostringstream>();
+			SQLite earlier( earlierStream, fileName, "std::ostringstream", true, false );
+			earlier.sqliteBegin();
+			earlier.createSQLiteSimulationsRecord( 1, "EnergyPlus Version", "Current Time" );
+			earlier.createSQLiteEnvironmentPeriodRecord( 1, "CHICAGO ANN HTG 99.6% CONDNS DB", 1 );
+			earlier.createSQLiteEnvironmentPeriodRecord( 2, "RUN PERIOD 1", 3 );
+			earlier.createSQLiteEnvironmentPeriodRecord( 3, "RUN PERIOD 2", 3 );
+			earlier.createSQLiteReportDictionaryRecord( 1, 1, "Zone", "Environment", "Site Outdoor Air Drybulb Temperature", 1, "C", 2, false, _ );
+			earlier.createSQLiteTimeIndexRecord( 2, 1, 1, 1, 1, 21, 24, _, _, 0, "WinterDesignDay" );
+			earlier.createSQLiteReportDataRecord( 1, -17.3 );
+			earlier.createSQLiteTimeIndexRecord( 2, 1, 1, 2, 1, 1, 24, _, _, 0, "Sunday" );
+			earlier.createSQLiteReportDataRecord( 1, -4.2 );
+			earlier.createSQLiteTimeIndexRecord( 2, 1, 2, 2, 1, 2, 24, _, _, 0, "Monday" );
+			earlier.createSQLiteReportDataRecord( 1, -1.6 );
+			earlier.sqliteCommit();
+		}
+
+		// The resumed run has reported the first environment again and resumes the second one
+		sqlite_test->sqliteBegin();
+		sqlite_test->createSQLiteSimulationsRecord( 1, "EnergyPlus Version", "Current Time" );
+		sqlite_test->createSQLiteEnvironmentPeriodRecord( 1, "CHICAGO ANN HTG 99.6% CONDNS DB", 1 );
+		sqlite_test->createSQLiteReportDictionaryRecord( 1, 1, "Zone", "Environment", "Site Outdoor Air Drybulb Temperature", 1, "C", 2, false, _ );
+		sqlite_test->createSQLiteTimeIndexRecord( 2, 1, 1, 1, 1, 21, 24, _, _, 0, "WinterDesignDay" );
+		sqlite_test->createSQLiteReportDataRecord( 1, -17.3 );
+		sqlite_test->sqliteCommit();
+
+		EXPECT_TRUE( sqlite_test->restoreReportData( fileName, 2, 3, 3, 0, 0, 0 ) );
+		EXPECT_EQ( "", ss->str() );
+		int timeIndex, dataIndex, extendedDataIndex, hourlyReportIndex, hourlyDataIndex;
+		sqlite_test->getReportDataIndices( timeIndex, dataIndex, extendedDataIndex, hourlyReportIndex, hourlyDataIndex );
+		EXPECT_EQ( 3, timeIndex );
+		EXPECT_EQ( 3, dataIndex );
+		EXPECT_EQ( 0, extendedDataIndex );
+
+		sqlite_test->sqliteBegin();
+		sqlite_test->createSQLiteEnvironmentPeriodRecord( 2, "RUN PERIOD 1", 3 );
+		sqlite_test->createSQLiteTimeIndexRecord( 2, 1, 3, 2, 1, 3, 24, _, _, 0, "Tuesday" );
+		sqlite_test->createSQLiteReportDataRecord( 1, 2.5 );
+		auto environmentPeriods = queryResult("SELECT * FROM EnvironmentPeriods;", "EnvironmentPeriods");
+		auto reportData = queryResult("SELECT * FROM ReportData;", "ReportData");
+		sqlite_test->sqliteCommit();
+		EXPECT_EQ( "", ss->str() );
+
+		EXPECT_EQ(2ul, environmentPeriods.size());
+		ASSERT_EQ(4ul, reportData.size());
+		std::vector<std::string> reportData1 {"2", "2", "1", "-4.2"};
+		std::vector<std::string> reportData2 {"3", "3", "1", "-1.6"};
+		std::vector<std::string> reportData3 {"4", "4", "1", "2.5"};
+		EXPECT_EQ(reportData1, reportData[1]);
+		EXPECT_EQ(reportData2, reportData[2]);
+		EXPECT_EQ(reportData3, reportData[3]);
+
+		// Nothing is copied from a database that does not exist
+		EXPECT_FALSE( sqlite_test->restoreReportData( "SQLiteProcedures_restoreReportData.missing.sql", 2, 5, 5, 0, 0, 0 ) );
+		ss->str(std::string());
+
+		std::remove( fileName.c_str() );
+	}
+
 	TEST_F( SQLiteFixture, SQLiteProcedures_addSQLiteZoneSizingRecord ) {
 		sqlite_test->sqliteBegin();
 		sqlite_test->addSQLiteZoneSizingRecord( "FLOOR 1 IT HALL", "Cooling", 175, 262, 0.013, 0.019, "CHICAGO ANN CLG .4% CONDNS WB=>MDB", "7/21 06:00:00", 20.7, 0.0157, 0.0033, 416.7 );
@@ -58,6 +58,11 @@
 
 // EnergyPlus::OutputReportTabular Unit Tests
 
+// C++ Headers
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
 // Google Test Headers
 #include <gtest/gtest.h>
 // ObjexxFCL Headers
@@ -93,3 +98,155 @@ TEST_F( EnergyPlusFixture, ScheduleManager_isMinuteMultipleOfTimestep )
 	EXPECT_FALSE( isMinuteMultipleOfTimestep( 22, 12 ) );
 	EXPECT_FALSE( isMinuteMultipleOfTimestep( 53, 12 ) );
 }
+
+TEST_F( EnergyPlusFixture, ScheduleManager_ShareGeneratedSchedules )
+{
+	std::string const idf_objects = delimited_string( {
+		"Version,8.6;",
+		"ScheduleTypeLimits,",
+		"  Fraction,                !- Name",
+		"  0.0,                     !- Lower Limit Value",
+		"  1.0,                     !- Upper Limit Value",
+		"  Continuous;              !- Numeric Type",
+		"Schedule:Compact,",
+		"  Office Occupancy A,      !- Name",
+		"  Fraction,                !- Schedule Type Limits Name",
+		"  Through: 12/31,          !- Field 1",
+		"  For: Weekdays,           !- Field 2",
+		"  Until: 08:00,0.0,        !- Field 3",
+		"  Until: 24:00,1.0,        !- Field 5",
+		"  For: AllOtherDays,       !- Field 7",
+		"  Until: 24:00,0.0;        !- Field 8",
+		"Schedule:Compact,",
+		"  Office Occupancy B,      !- Name",
+		"  Fraction,                !- Schedule Type Limits Name",
+		"  Through: 12/31,          !- Field 1",
+		"  For: Weekdays,           !- Field 2",
+		"  Until: 08:00,0.0,        !- Field 3",
+		"  Until: 24:00,1.0,        !- Field 5",
+		"  For: AllOtherDays,       !- Field 7",
+		"  Until: 24:00,0.0;        !- Field 8",
+		"Schedule:Compact,",
+		"  Always Off Compact,      !- Name",
+		"  Fraction,                !- Schedule Type Limits Name",
+		"  Through: 12/31,          !- Field 1",
+		"  For: AllDays,            !- Field 2",
+		"  Until: 24:00,0.0;        !- Field 3",
+		"Schedule:Constant,",
+		"  Always Off Constant,     !- Name",
+		"  Fraction,                !- Schedule Type Limits Name",
+		"  0.0;                     !- Hourly Value",
+	} );
+
+	ASSERT_FALSE( process_idf( idf_objects ) );
+
+	DataGlobals::NumOfTimeStepInHour = 1;
+	DataGlobals::MinutesPerTimeStep = 60;
+	ProcessScheduleInput();
+
+	// one weekday profile and one all-zero profile, one week for the offices and one for the "always off" schedules
+	EXPECT_EQ( 2, NumDaySchedules );
+	EXPECT_EQ( 2, NumWeekSchedules );
+
+	int const OfficeA = GetScheduleIndex( "OFFICE OCCUPANCY A" );
+	int const OfficeB = GetScheduleIndex( "OFFICE OCCUPANCY B" );
+	int const OffCompact = GetScheduleIndex( "ALWAYS OFF COMPACT" );
+	int const OffConstant = GetScheduleIndex( "ALWAYS OFF CONSTANT" );
+
+	EXPECT_EQ( Schedule( OfficeA ).WeekSchedulePointer( 1 ), Schedule( OfficeB ).WeekSchedulePointer( 366 ) );
+	EXPECT_EQ( Schedule( OffCompact ).WeekSchedulePointer( 1 ), Schedule( OffConstant ).WeekSchedulePointer( 366 ) );
+	EXPECT_NE( Schedule( OfficeA ).WeekSchedulePointer( 1 ), Schedule( OffCompact ).WeekSchedulePointer( 1 ) );
+
+	// Monday at 9:00 and Sunday at 9:00
+	auto const & officeWeek( WeekSchedule( Schedule( OfficeB ).WeekSchedulePointer( 1 ) ) );
+	EXPECT_DOUBLE_EQ( 1.0, DaySchedule( officeWeek.DaySchedulePointer( 2 ) ).TSValue( 1, 9 ) );
+	EXPECT_DOUBLE_EQ( 0.0, DaySchedule( officeWeek.DaySchedulePointer( 1 ) ).TSValue( 1, 9 ) );
+	EXPECT_EQ( officeWeek.DaySchedulePointer( 1 ), WeekSchedule( Schedule( OffConstant ).WeekSchedulePointer( 1 ) ).DaySchedulePointer( 1 ) );
+	EXPECT_TRUE( DaySchedule( officeWeek.DaySchedulePointer( 1 ) ).Used );
+
+	// the shared schedules must survive the schedule input being processed again (as unit tests do)
+	ProcessScheduleInput();
+	EXPECT_EQ( 2, NumDaySchedules );
+	EXPECT_EQ( 2, NumWeekSchedules );
+	EXPECT_EQ( Schedule( OfficeA ).WeekSchedulePointer( 1 ), Schedule( OfficeB ).WeekSchedulePointer( 366 ) );
+	EXPECT_DOUBLE_EQ( 1.0, DaySchedule( WeekSchedule( Schedule( OfficeA ).WeekSchedulePointer( 1 ) ).DaySchedulePointer( 2 ) ).TSValue( 1, 9 ) );
+}
+
+TEST_F( EnergyPlusFixture, ScheduleManager_ShareScheduleFile )
+{
+	// weekday office hours in the first column, a repeating two hour profile in the second
+	std::string const scheduleFileName( "ScheduleManager_ShareScheduleFile.csv" );
+	{
+		std::ofstream scheduleFile( scheduleFileName );
+		for ( int Day = 1; Day <= 365; ++Day ) {
+			for ( int Hour = 1; Hour <= 24; ++Hour ) {
+				scheduleFile << ( ( Day % 7 < 5 && Hour > 8 && Hour <= 18 ) ? "1.0" : "0.0" ) << ',' << ( ( Hour % 2 == 0 ) ? "0.5" : "0.25" ) << '\n';
+			}
+		}
+	}
+
+	std::string const idf_objects = delimited_string( {
+		"Version,8.6;",
+		"ScheduleTypeLimits,",
+		"  Fraction,                !- Name",
+		"  0.0,                     !- Lower Limit Value",
+		"  1.0,                     !- Upper Limit Value",
+		"  Continuous;              !- Numeric Type",
+		"Schedule:File,",
+		"  Occupancy From File A,   !- Name",
+		"  Fraction,                !- Schedule Type Limits Name",
+		"  " + scheduleFileName + ", !- File Name",
+		"  1,                       !- Column Number",
+		"  0,                       !- Rows to Skip at Top",
+		"  8760,                    !- Number of Hours of Data",
+		"  Comma;                   !- Column Separator",
+		"Schedule:File,",
+		"  Lighting From File,      !- Name",
+		"  Fraction,                !- Schedule Type Limits Name",
+		"  " + scheduleFileName + ", !- File Name",
+		"  2,                       !- Column Number",
+		"  0,                       !- Rows to Skip at Top",
+		"  8760,                    !- Number of Hours of Data",
+		"  Comma;                   !- Column Separator",
+		"Schedule:File,",
+		"  Occupancy From File B,   !- Name",
+		"  Fraction,                !- Schedule Type Limits Name",
+		"  " + scheduleFileName + ", !- File Name",
+		"  1,                       !- Column Number",
+		"  0,                       !- Rows to Skip at Top",
+		"  8760,                    !- Number of Hours of Data",
+		"  Comma;                   !- Column Separator",
+	} );
+
+	ASSERT_FALSE( process_idf( idf_objects ) );
+
+	DataGlobals::NumOfTimeStepInHour = 1;
+	DataGlobals::MinutesPerTimeStep = 60;
+	ProcessScheduleInput();
+
+	// workday, day off and two hour profiles, one week for each of them
+	EXPECT_EQ( 3, NumDaySchedules );
+	EXPECT_EQ( 3, NumWeekSchedules );
+
+	int const OccupancyA = GetScheduleIndex( "OCCUPANCY FROM FILE A" );
+	int const OccupancyB = GetScheduleIndex( "OCCUPANCY FROM FILE B" );
+	int const Lighting = GetScheduleIndex( "LIGHTING FROM FILE" );
+
+	// both users of the first column follow the file, day by day, after the schedules were moved to their final arrays
+	// (GetScheduleIndex processed the schedule input a second time)
+	for ( int Day = 1; Day <= 366; ++Day ) {
+		int const FileDay( Day < 60 ? Day : std::max( Day - 1, 59 ) ); // 29 Feb repeats 28 Feb
+		auto const & dayA( DaySchedule( WeekSchedule( Schedule( OccupancyA ).WeekSchedulePointer( Day ) ).DaySchedulePointer( 1 ) ) );
+		auto const & dayB( DaySchedule( WeekSchedule( Schedule( OccupancyB ).WeekSchedulePointer( Day ) ).DaySchedulePointer( 1 ) ) );
+		auto const & dayLighting( DaySchedule( WeekSchedule( Schedule( Lighting ).WeekSchedulePointer( Day ) ).DaySchedulePointer( 1 ) ) );
+		for ( int Hour = 1; Hour <= 24; ++Hour ) {
+			Real64 const Occupancy( ( FileDay % 7 < 5 && Hour > 8 && Hour <= 18 ) ? 1.0 : 0.0 );
+			EXPECT_DOUBLE_EQ( Occupancy, dayA.TSValue( 1, Hour ) );
+			EXPECT_DOUBLE_EQ( Occupancy, dayB.TSValue( 1, Hour ) );
+			EXPECT_DOUBLE_EQ( ( Hour % 2 == 0 ) ? 0.5 : 0.25, dayLighting.TSValue( 1, Hour ) );
+		}
+		EXPECT_EQ( Schedule( OccupancyA ).WeekSchedulePointer( Day ), Schedule( OccupancyB ).WeekSchedulePointer( Day ) );
+	}
+
+	std::remove( scheduleFileName.c_str() );
+}
@@ -85,3 +85,36 @@ TEST_F( EnergyPlusFixture, CheckThreading )
 
 	EXPECT_TRUE( compare_err_stream( error_string, true ) );
 }
+
+TEST_F( EnergyPlusFixture, SimulationManager_SegmentDayRange )
+{
+	int FirstDay;
+	int LastDay;
+
+	// An annual run period split in four ends the segments with the quarters
+	SimulationManager::SegmentDayRange( 365, 1, false, 4, 1, FirstDay, LastDay );
+	EXPECT_EQ( 1, FirstDay );
+	EXPECT_EQ( 90, LastDay );
+	SimulationManager::SegmentDayRange( 365, 1, false, 4, 2, FirstDay, LastDay );
+	EXPECT_EQ( 91, FirstDay );
+	EXPECT_EQ( 181, LastDay );
+	SimulationManager::SegmentDayRange( 365, 1, false, 4, 3, FirstDay, LastDay );
+	EXPECT_EQ( 182, FirstDay );
+	EXPECT_EQ( 273, LastDay );
+	SimulationManager::SegmentDayRange( 365, 1, false, 4, 4, FirstDay, LastDay );
+	EXPECT_EQ( 274, FirstDay );
+	EXPECT_EQ( 365, LastDay );
+
+	// A run period starting July 1 crosses the end of the year
+	SimulationManager::SegmentDayRange( 365, 182, false, 2, 1, FirstDay, LastDay );
+	EXPECT_EQ( 1, FirstDay );
+	EXPECT_EQ( 184, LastDay ); // December 31
+
+	// Without an end of a month in the run period the segments are of equal length
+	SimulationManager::SegmentDayRange( 20, 1, false, 3, 2, FirstDay, LastDay );
+	EXPECT_EQ( 8, FirstDay );
+	EXPECT_EQ( 13, LastDay );
+	SimulationManager::SegmentDayRange( 20, 1, false, 3, 3, FirstDay, LastDay );
+	EXPECT_EQ( 14, FirstDay );
+	EXPECT_EQ( 20, LastDay );
+}
@@ -677,10 +677,86 @@ TEST_F( EnergyPlusFixture, SolarShadingTest_FigureSolarBeamAtTimestep )
 	SolarShading::SkyDifSolarShading();
 	CalcSkyDifShading = false;
 
+	// sun up in the south-east so that the ratios of the time step are figured
+	SUNCOSTS( 4, 9, 1 ) = 0.6;
+	SUNCOSTS( 4, 9, 2 ) = -0.2;
+	SUNCOSTS( 4, 9, 3 ) = std::sqrt( 0.6 );
 	FigureSolarBeamAtTimestep( DataGlobals::HourOfDay, DataGlobals::TimeStep );
 
 	EXPECT_NEAR( 0.6504, DifShdgRatioIsoSkyHRTS( 4, 9, 6 ), 0.0001 );
 	EXPECT_NEAR( 0.9152, DifShdgRatioHorizHRTS( 4, 9, 6 ), 0.0001 );
+	EXPECT_EQ( 1, NumSkyDifShdgRatioSets );
+
+	// The sky patches must not leave their results in the beam solar arrays of the time step
+	Array1D< Real64 > const SunlitFracDetailed( SunlitFrac( 4, 9, {1,TotSurfaces} ) );
+	Array1D< Real64 > const OverlapAreasDetailed( OverlapAreas( 4, 9, 1, {1,TotSurfaces} ) );
+	DataSystemVariables::DetailedSkyDiffuseAlgorithm = false;
+	BackSurfaces( 4, 9, {1,MaxBkSurf}, {1,TotSurfaces} ) = 0;
+	OverlapAreas( 4, 9, {1,MaxBkSurf}, {1,TotSurfaces} ) = 0.0;
+	FigureSolarBeamAtTimestep( DataGlobals::HourOfDay, DataGlobals::TimeStep );
+	for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+		EXPECT_EQ( SunlitFrac( 4, 9, SurfNum ), SunlitFracDetailed( SurfNum ) );
+		EXPECT_EQ( OverlapAreas( 4, 9, 1, SurfNum ), OverlapAreasDetailed( SurfNum ) );
+	}
+	DataSystemVariables::DetailedSkyDiffuseAlgorithm = true;
+
+	// Later time steps with the same shading transmittance reuse the saved ratios
+	DifShdgRatioIsoSkyHRTS( 4, 9, 6 ) = 0.0;
+	FigureSolarBeamAtTimestep( DataGlobals::HourOfDay, DataGlobals::TimeStep );
+	EXPECT_EQ( 1, NumSkyDifShdgRatioSets );
+	EXPECT_NEAR( 0.6504, DifShdgRatioIsoSkyHRTS( 4, 9, 6 ), 0.0001 );
+	EXPECT_NEAR( 0.9152, DifShdgRatioHorizHRTS( 4, 9, 6 ), 0.0001 );
+
+	// Anisotropic sky multipliers over the gathered exterior solar surfaces
+	DataEnvironment::SOLCOS = SUNCOSTS( 4, 9, {1,3} );
+	DataEnvironment::BeamSolarRad = 500.0;
+	DataEnvironment::DifSolarRad = 150.0;
+	AnisoSkyViewFactors();
+	for ( int Loop = 1; Loop <= AnisoSkySurfs.isize(); ++Loop ) {
+		int const SurfNum( AnisoSkySurfs( Loop ) );
+		EXPECT_TRUE( Surface( SurfNum ).ExtSolar );
+		EXPECT_DOUBLE_EQ( dot( DataEnvironment::SOLCOS, Surface( SurfNum ).OutNormVec ), AnisoSkyCosInc( Loop ) );
+		EXPECT_GE( AnisoSkyMult( SurfNum ), 0.0 );
+	}
+	EXPECT_DOUBLE_EQ( MultIsoSky( 6 ) * DifShdgRatioIsoSkyHRTS( 4, 9, 6 ) + MultCircumSolar( 6 ) * SunlitFrac( 4, 9, 6 ) + MultHorizonZenith( 6 ) * DifShdgRatioHorizHRTS( 4, 9, 6 ), AnisoSkyMult( 6 ) );
 
 }
 
+
+TEST_F( EnergyPlusFixture, SolarShadingTest_CalcComplexWindowOverlapProducts )
+{
+	// The precomputed beam overlaps for each incident direction must equal the sums over outgoing
+	// directions of overlap area times lambda times transmittance
+	int const NBasis( 7 );
+	int const NBkSurf( 3 );
+	Construct.allocate( 1 );
+	Construct( 1 ).BSDFInput.SolFrtTrans.allocate( NBasis, NBasis );
+	BSDFGeomDescr Geom;
+	Geom.Inc.NBasis = Geom.Trn.NBasis = NBasis;
+	Geom.Trn.Lamda.allocate( NBasis );
+	Geom.AOverlap.allocate( NBkSurf, NBasis );
+	for ( int IRay = 1; IRay <= NBasis; ++IRay ) {
+		Geom.Trn.Lamda( IRay ) = 0.1 + 0.01 * IRay;
+		for ( int IBm = 1; IBm <= NBasis; ++IBm ) {
+			Construct( 1 ).BSDFInput.SolFrtTrans( IBm, IRay ) = ( IBm == IRay ) ? 2.0 : 0.05 * ( IBm + 2 * IRay ) / NBasis;
+		}
+		for ( int IBack = 1; IBack <= NBkSurf; ++IBack ) {
+			Geom.AOverlap( IBack, IRay ) = ( IRay + IBack ) % 3 == 0 ? 0.0 : 0.3 * IBack + 0.02 * IRay;
+		}
+	}
+
+	CalcComplexWindowOverlapProducts( Geom, 1 );
+
+	for ( int IBm = 1; IBm <= NBasis; ++IBm ) {
+		for ( int IBack = 1; IBack <= NBkSurf; ++IBack ) {
+			Real64 Sum( 0.0 );
+			for ( int IRay = 1; IRay <= NBasis; ++IRay ) {
+				Sum += Geom.AOverlap( IBack, IRay ) * Construct( 1 ).BSDFInput.SolFrtTrans( IBm, IRay ) * Geom.Trn.Lamda( IRay );
+				EXPECT_DOUBLE_EQ( Geom.AOverlap( IBack, IRay ) * Geom.Trn.Lamda( IRay ), Geom.AOverlapLamda( IBack, IRay ) );
+			}
+			EXPECT_NEAR( Sum, Geom.SolBmBkSurfOverlap( IBm, IBack ), 1.0e-12 );
+		}
+	}
+	EXPECT_EQ( NBkSurf, Geom.BkSurfBestTrnState.isize() );
+	EXPECT_EQ( 0, Geom.BkSurfBestTrnState( 1 ) );
+}
@@ -1618,3 +1618,152 @@ TEST_F( EnergyPlusFixture, StratifiedTankUseEnergy )
 	ASSERT_LT(Tank.UseRate, 0.0);
 
 }
+
+TEST_F( EnergyPlusFixture, StratifiedTankImplicitSolver )
+{
+	using WaterThermalTanks::WaterThermalTank;
+	using DataGlobals::HourOfDay;
+	using DataGlobals::TimeStep;
+	using DataGlobals::TimeStepZone;
+	using DataHVACGlobals::SysTimeElapsed;
+	using DataHVACGlobals::TimeStepSys;
+
+	std::string const idf_objects = delimited_string( {
+		"Schedule:Constant, Hot Water Demand Schedule, , 1.0;",
+		"Schedule:Constant, Ambient Temp Schedule, , 20.0;",
+		"Schedule:Constant, Inlet Water Temperature, , 10.0;",
+		"Schedule:Constant, Hot Water Setpoint Temp Schedule, , 48.89;",
+		"WaterHeater:Stratified,",
+		"  Stratified Tank,         !- Name",
+		"  ,                        !- End-Use Subcategory",
+		"  0.17,                    !- Tank Volume {m3}",
+		"  1.4,                     !- Tank Height {m}",
+		"  VerticalCylinder,        !- Tank Shape",
+		"  ,                        !- Tank Perimeter {m}",
+		"  82.2222,                 !- Maximum Temperature Limit {C}",
+		"  MasterSlave,             !- Heater Priority Control",
+		"  Hot Water Setpoint Temp Schedule,  !- Heater 1 Setpoint Temperature Schedule Name",
+		"  2.0,                     !- Heater 1 Deadband Temperature Difference {deltaC}",
+		"  4500,                    !- Heater 1 Capacity {W}",
+		"  1.0,                     !- Heater 1 Height {m}",
+		"  Hot Water Setpoint Temp Schedule,  !- Heater 2 Setpoint Temperature Schedule Name",
+		"  5.0,                     !- Heater 2 Deadband Temperature Difference {deltaC}",
+		"  4500,                    !- Heater 2 Capacity {W}",
+		"  0.0,                     !- Heater 2 Height {m}",
+		"  ELECTRICITY,             !- Heater Fuel Type",
+		"  1,                       !- Heater Thermal Efficiency",
+		"  ,                        !- Off Cycle Parasitic Fuel Consumption Rate {W}",
+		"  ELECTRICITY,             !- Off Cycle Parasitic Fuel Type",
+		"  ,                        !- Off Cycle Parasitic Heat Fraction to Tank",
+		"  ,                        !- Off Cycle Parasitic Height {m}",
+		"  ,                        !- On Cycle Parasitic Fuel Consumption Rate {W}",
+		"  ELECTRICITY,             !- On Cycle Parasitic Fuel Type",
+		"  ,                        !- On Cycle Parasitic Heat Fraction to Tank",
+		"  ,                        !- On Cycle Parasitic Height {m}",
+		"  SCHEDULE,                !- Ambient Temperature Indicator",
+		"  Ambient Temp Schedule,   !- Ambient Temperature Schedule Name",
+		"  ,                        !- Ambient Temperature Zone Name",
+		"  ,                        !- Ambient Temperature Outdoor Air Node Name",
+		"  0,                       !- Uniform Skin Loss Coefficient per Unit Area to Ambient Temperature {W/m2-K}",
+		"  ,                        !- Skin Loss Fraction to Zone",
+		"  ,                        !- Off Cycle Flue Loss Coefficient to Ambient Temperature {W/K}",
+		"  ,                        !- Off Cycle Flue Loss Fraction to Zone",
+		"  0.000189,                !- Peak Use Flow Rate {m3/s}",
+		"  Hot Water Demand Schedule,  !- Use Flow Rate Fraction Schedule Name",
+		"  Inlet Water Temperature, !- Cold Water Supply Temperature Schedule Name",
+		"  ,                        !- Use Side Inlet Node Name",
+		"  ,                        !- Use Side Outlet Node Name",
+		"  ,                        !- Use Side Effectiveness",
+		"  1.0,                     !- Use Side Inlet Height {m}",
+		"  0.5,                     !- Use Side Outlet Height {m}",
+		"  ,                        !- Source Side Inlet Node Name",
+		"  ,                        !- Source Side Outlet Node Name",
+		"  ,                        !- Source Side Effectiveness",
+		"  ,                        !- Source Side Inlet Height {m}",
+		"  ,                        !- Source Side Outlet Height {m}",
+		"  FIXED,                   !- Inlet Mode",
+		"  ,                        !- Use Side Design Flow Rate {m3/s}",
+		"  ,                        !- Source Side Design Flow Rate {m3/s}",
+		"  ,                        !- Indirect Water Heating Recovery Time {hr}",
+		"  12,                      !- Number of Nodes",
+		"  0.1,                     !- Additional Destratification Conductivity {W/m-K}",
+		"  ,,,,,,,,,,,,             !- Node 1 to 12 Additional Loss Coefficients {W/K}",
+		"  ,                        !- Source Side Flow Control Mode",
+		"  ,                        !- Indirect Alternate Setpoint Temperature Schedule Name",
+		"  Implicit;                !- Solution Algorithm",
+	} );
+
+	ASSERT_FALSE( process_idf( idf_objects ) );
+
+	bool ErrorsFound = false;
+	EXPECT_FALSE( WaterThermalTanks::GetWaterThermalTankInputData( ErrorsFound ) );
+
+	WaterThermalTanks::WaterThermalTankData & Tank = WaterThermalTank( 1 );
+	EXPECT_EQ( WaterThermalTanks::StratifiedSolverImplicit, Tank.SolutionAlgorithm );
+
+	HourOfDay = 0;
+	TimeStep = 1;
+	TimeStepZone = 10. / 60.;
+	TimeStepSys = TimeStepZone;
+	SysTimeElapsed = 0.0;
+	Tank.TimeElapsed = HourOfDay + TimeStep * TimeStepZone + SysTimeElapsed;
+	Tank.AmbientTemp = 20.0;
+	Tank.UseInletTemp = 10.0;
+	Tank.SetPointTemp = 48.89;
+	Tank.SetPointTemp2 = Tank.SetPointTemp;
+	Tank.TankTemp = 45.0;
+	Tank.UseMassFlowRate = 0.05;
+
+	Real64 const SecInTimeStep( TimeStepSys * DataGlobals::SecInHour );
+	static int DummyWaterIndex( 1 );
+	Real64 const Cp( FluidProperties::GetSpecificHeatGlycol( "WATER", Tank.TankTemp, DummyWaterIndex, "StratifiedTankImplicitSolver" ) );
+
+	// A draw that cycles both heaters, starting from a stratified tank
+	auto SimulateTimeStep = [ & ]( int const SolutionAlgorithm ) {
+		for ( int i = 1; i <= Tank.Nodes; ++i ) {
+			Tank.Node( i ).SavedTemp = 50.0 - 1.0 * i;
+		}
+		Tank.SavedHeaterOn1 = false;
+		Tank.SavedHeaterOn2 = false;
+		Tank.TankTemp = 45.0;
+		Tank.SolutionAlgorithm = SolutionAlgorithm;
+		WaterThermalTanks::CalcWaterThermalTankStratified( 1 );
+	};
+
+	SimulateTimeStep( WaterThermalTanks::StratifiedSolverExplicit );
+	Real64 const ExplicitTankTemp( Tank.TankTemp );
+	Real64 const ExplicitUseRate( Tank.UseRate );
+	Real64 const ExplicitHeaterRate( Tank.HeaterRate );
+	Real64 const ExplicitUseOutletTemp( Tank.UseOutletTemp );
+
+	SimulateTimeStep( WaterThermalTanks::StratifiedSolverImplicit );
+	EXPECT_NEAR( ExplicitTankTemp, Tank.TankTemp, 0.2 );
+	EXPECT_NEAR( ExplicitUseRate, Tank.UseRate, 0.02 * std::abs( ExplicitUseRate ) );
+	EXPECT_NEAR( ExplicitHeaterRate, Tank.HeaterRate, 0.05 * ExplicitHeaterRate );
+	EXPECT_NEAR( ExplicitUseOutletTemp, Tank.UseOutletTemp, 0.5 );
+
+	// The implicit solution conserves energy over the time step
+	Real64 StoredEnergy( 0.0 );
+	for ( int i = 1; i <= Tank.Nodes; ++i ) {
+		StoredEnergy += Tank.Node( i ).Mass * Cp * ( Tank.Node( i ).Temp - Tank.Node( i ).SavedTemp );
+	}
+	EXPECT_NEAR( StoredEnergy / SecInTimeStep, Tank.NetHeatTransferRate, 0.01 );
+
+	// Inversions are mixed out without changing the stored energy
+	Tank.UseMassFlowRate = 0.0;
+	Tank.SetPointTemp = 30.0;
+	Tank.SetPointTemp2 = 30.0;
+	for ( int i = 1; i <= Tank.Nodes; ++i ) {
+		Tank.Node( i ).SavedTemp = 40.0 + 1.0 * i;
+	}
+	Tank.SavedHeaterOn1 = false;
+	Tank.SavedHeaterOn2 = false;
+	Real64 const InitialTankTemp( 40.0 + 0.5 * ( Tank.Nodes + 1 ) );
+	WaterThermalTanks::CalcWaterThermalTankStratified( 1 );
+	for ( int i = 2; i <= Tank.Nodes; ++i ) {
+		EXPECT_LE( Tank.Node( i ).Temp, Tank.Node( i - 1 ).Temp );
+	}
+	EXPECT_NEAR( InitialTankTemp, Tank.TankTemp, 1.0e-6 );
+	EXPECT_DOUBLE_EQ( 0.0, Tank.HeaterRate );
+
+}
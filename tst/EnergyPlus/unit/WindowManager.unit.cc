@@ -18,6 +18,7 @@
 #include <DataHeatBalFanSys.hh>
 #include <DataHeatBalSurface.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <ElectricPowerServiceManager.hh>
 #include <HeatBalanceManager.hh>
 #include <HeatBalanceIntRadExchange.hh>
@@ -25,7 +26,7 @@
 #include <Psychrometrics.hh>
 #include <SolarShading.hh>
 
-#include "Fixtures/EnergyPlusFixture.hh"
+#include "Fixtures/WindowManagerFixture.hh"
 
 using namespace EnergyPlus;
 using namespace EnergyPlus::WindowManager;
@@ -281,3 +282,50 @@ TEST_F(EnergyPlusFixture, WindowManager_TransAndReflAtPhi)
 
 
 
+
+TEST_F(WindowManagerFixture, WindowManager_ResponseTableMatchesIteration )
+{
+
+	int const winNum( SetupDoubleGlazedWindow() );
+	ASSERT_GT( winNum, 0 );
+	Real64 const h_exterior = 25.0;
+
+	Real64 inSurfTemp;
+	Real64 outSurfTemp;
+	Real64 inSurfTempTable;
+	Real64 outSurfTempTable;
+	for ( Real64 T_out : { -17.5, 3.0, 33.0 } ) {
+		DataSurfaces::Surface( winNum ).OutDryBulbTemp = T_out;
+
+		DataGlobals::BeginEnvrnFlag = true;
+		DataSystemVariables::WindowTablesEnvFlag = false;
+		WindowManager::CalcWindowHeatBalance( winNum, h_exterior, inSurfTemp, outSurfTemp );
+		int const Iterations( DataSurfaces::SurfaceWindow( winNum ).WindowCalcIterationsRep );
+		EXPECT_GT( Iterations, 1 );
+
+		DataSystemVariables::WindowTablesEnvFlag = true;
+		WindowManager::CalcWindowHeatBalance( winNum, h_exterior, inSurfTempTable, outSurfTempTable );
+		DataSystemVariables::WindowTablesEnvFlag = false;
+		EXPECT_LT( DataSurfaces::SurfaceWindow( winNum ).WindowCalcIterationsRep, Iterations );
+
+		EXPECT_NEAR( inSurfTemp, inSurfTempTable, 0.1 );
+		EXPECT_NEAR( outSurfTemp, outSurfTempTable, 0.1 );
+	}
+	EXPECT_EQ( 1u, WindowManager::WindowResponseTable.size() );
+
+	// Both methods agree over a diurnal sweep of outside air temperature, starting each call
+	// from the face temperatures of the previous one as in a simulation
+	DataGlobals::BeginEnvrnFlag = false;
+	for ( int Call = 0; Call < 96; ++Call ) {
+		DataSurfaces::Surface( winNum ).OutDryBulbTemp = 5.0 - 10.0 * std::cos( DataGlobals::Pi * Call / 48.0 );
+		DataSystemVariables::WindowTablesEnvFlag = false;
+		WindowManager::CalcWindowHeatBalance( winNum, h_exterior, inSurfTemp, outSurfTemp );
+		DataSystemVariables::WindowTablesEnvFlag = true;
+		WindowManager::CalcWindowHeatBalance( winNum, h_exterior, inSurfTempTable, outSurfTempTable );
+		EXPECT_NEAR( inSurfTemp, inSurfTempTable, 0.1 );
+		EXPECT_NEAR( outSurfTemp, outSurfTempTable, 0.1 );
+	}
+	DataSystemVariables::WindowTablesEnvFlag = false;
+	EXPECT_EQ( 1u, WindowManager::WindowResponseTable.size() );
+
+}